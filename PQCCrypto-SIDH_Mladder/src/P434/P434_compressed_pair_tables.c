@@ -1,4123 +0,0 @@
-/**************************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: precomputed tables for pairing computation on E0: y^2 = x^3 + x when using compression
-***************************************************************************************************/  
-
-
-// T_tate3 contains 6*(eB-1)+4 elements from Fp. There are (eB-1) 6-tuples (l1,l2,n1,n2,x23,x2p3), each corresponding to a single step in the Miller loop. 
-// The values l1 and l2 are the slopes of the doubling and point addition to compute the tripling, n1 and n2 are coefficients of the corresponding lines and 
-// x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
-// precomputed values.
-
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
-0x87CF42AB4DB902F, 0x2DC7847A25C2D0BB, 0x2EA717C1089170B, 0xD648387AF59D578F, 
-0x16EC71A5BDA7D98B, 0xC02025B1BDE6B5F1, 0x482FED00DCBB, 0x8AD7A8F0578700AE, 
-0xB317427ECCC5FA27, 0x43EE31091EAF92, 0x2D317292BB029F77, 0xFBBB529BB4CBB2B4, 
-0x60580C9725507661, 0x112DF39343123, 0xA434F3F0FDB57E43, 0x1F19074AF93E2F11, 
-0x543519D9822F9BCD, 0xA37D58CA3D49D484, 0xBF5FA675ABF1AF8C, 0xFB287704C7B40291, 
-0x1BF7E42435225, 0x87EE9673F98AC980, 0xBA0821247ABC3FA4, 0x15E15DE1E6F42728, 
-0xC0113FC5F784DFF1, 0xBEF4D30A12CEFB55, 0xDA6EDD9E69F8D979, 0x5095BF6E331A, 
-0x8712D8BFF33A915F, 0x6FA3BBA2BCAD2B3D, 0x3DA66FC51C479D41, 0xE4664DED73E4F4F8, 
-0x1DC84EF123484BDF, 0x3830A0CBC1A1FB32, 0x2093CD1FD32C3, 0x52BE5D7415D580B0, 
-0xA038215031E30913, 0x5D7CF2307F86F392, 0xB6F68C9CA159295E, 0x7C91CA90411DDBD2, 
-0x738CEC7107271928, 0x104B080B38D23, 
-0x782F2E6790E469ED, 0xC4B78003E1050FA0, 0xE0CA084A7EE5B883, 0xAB2ACCCF86F46C37, 
-0x1F32B66BFB23DD49, 0xD5960A518B29111E, 0x11F1B4E73A529, 0xEFC5D3474A129A11, 
-0x5576852523BA0748, 0x6B93C9ADD44CFFC0, 0xCE812E5B9151006E, 0x2C9F8A0911FE0C97, 
-0x910D0523327E636C, 0x11B72F214EA79, 0x1A0321DD62C5B1B9, 0x3F9DD61C3034ADA0, 
-0x94741AF0B2D3B8E6, 0xC74C38965B4D0043, 0x21C00F3322E375AB, 0xC26D7F847AC9EAAF, 
-0xBCCD45776F12, 0x799308ADD29259EA, 0x6B7CD64D6C3B7F04, 0xAC37BFD305C534DD, 
-0x7A5D6FB2163561D0, 0xAC47BF7A3D8DCAE1, 0xAEBCD5A1549AE57F, 0x10AEB563DEFA5, 
-0x870E74E9DDB6717F, 0x887B67035BB681CE, 0x6C589E63249B07D5, 0x23462ED5BC57928D, 
-0xA0911EE4D14324FC, 0x86C5A1C6E6D7610A, 0x6EE385585755, 0xF99C75D5FD1C99C8, 
-0xBD786788169F0B16, 0xD870C3F4FC4D3405, 0x883E82ADAA7EBAAB, 0x45F9810FBA0BB397, 
-0x742954D5E7597601, 0xBC1CEB24C698, 
-0x567D28386337D588, 0x451A058E61D82479, 0x9682171F6F2EF6B9, 0xA30AD92F6A21E952, 
-0x6835DA5DA162FFBA, 0xCFFCFC13DBE63182, 0xE18A5A20B5E, 0x7CF1E2C85A4336BF, 
-0x3BD672C9E247B93B, 0xE64AC73819FD063A, 0xB6229AC036E0CA04, 0xA02326A8503A3520, 
-0x2A0755DAAF4169B4, 0x1E6959E0B87C9, 0x8D6D2A7F6F30837C, 0xBF902E6320D3235F, 
-0x21647994DA640189, 0x5C1E206F4038BD47, 0x33BEF2EA45AEE25D, 0x160FFA08EA8FD067, 
-0x13202524ECD23, 0x8B52AD13442077CE, 0xE55F2B037EA7ADDC, 0xBB4EE449E9D97433, 
-0x3C9C89020167F595, 0xEA9B9E3A82ADCB66, 0x1E08BA4129BD5B25, 0x1CA2DA5BFC577, 
-0x4299DCB647918CB2, 0xAF86EB07DE2A69D2, 0xCE24B54DD0C4B65F, 0x4231A1A4B650B923, 
-0xEE6DFBA9BBEBABE8, 0x195BE1CE395BCA2, 0x1840939C66720, 0x9AE6708F03788550, 
-0xBFC33006F72C5178, 0x6FB8B0073442F23B, 0xDCC091F52DBAEFF, 0xF34F1009782EE835, 
-0xF567D3A9073710E5, 0xBD48650F0ECA, 
-0x590DE17FB7AFC380, 0x7F7A56940C607B76, 0xEA34A1DED0626E92, 0x2A5E86FC27A7919D, 
-0x2A939C77E67228A, 0x902EC93718A484D8, 0x1D525EC65922E, 0xA338F9FEA0D9FD2B, 
-0x3AE49152EFF3EBB1, 0x72EACC005FA0B6F4, 0xEC65DCD4E95F675A, 0x7CDCC1D8A54EEEC6, 
-0x1963678E2115897C, 0x68C906CC71D, 0x4ED2850CD8521CAA, 0x37B668E8B3464B4, 
-0xB0538F23955CC4A0, 0x89317CA4D87495E6, 0x682016748E5AF9CE, 0x8E8731A96729969, 
-0x19CA49150D970, 0xC8CBAB39A17258A8, 0x33177D7C5D70BC99, 0x4F766FC8ED881455, 
-0xAE27E8930854CD7A, 0x3D422E5E0D4FB34F, 0xE52EC94774679E91, 0x158125921CDFD, 
-0xD958C12302FCB427, 0xCC1C7CE47DA3923A, 0xF48BEB644D67B3B4, 0xCB3E85E981789F1, 
-0x690E38488F855778, 0x8DF571936B9DE3C1, 0x1697A828BD480, 0xBFB5E671A41DE11, 
-0xCB6E6ADD07E16041, 0x7F6F7E1F0F59312C, 0xA0C84CC72C66CF2C, 0x1BFACA064061C7D1, 
-0x81920D03644F54B7, 0xF51E62948FFB, 
-0x10BC57E9486532BE, 0xFAF9AEC6841ED41A, 0x2A4104E64469CE3C, 0x202B80D69318DB79, 
-0x417CA89D2A5935D2, 0xA991C6404CEC3BEC, 0xB47B0A935EF0, 0x6E7687B28A998E7D, 
-0x2BC789694ECBD01C, 0x3F6E60BDAEB97F, 0x556D30AD5D42D1FD, 0x60C2A6D0B08E7835, 
-0x867D4D0F64B409AB, 0x2192BBD62698D, 0x37CFB96EC731556A, 0xACD0CCD8FB2E14F7, 
-0xEEB912564ACA878D, 0x3EDF98CDDA176443, 0x36A39D2C28ADB9A8, 0xEE9427130BF5E0A, 
-0x13944C7977D23, 0xE71E70C0472421C5, 0xE5EB07ADE978903, 0x2960B1C908E63B43, 
-0x5E5C8461A3D6BB04, 0x25449D5F39BE1CD9, 0x7D38319C4E8FA1D6, 0x1B28945723E0, 
-0x2E4D063B45948CB, 0x5FCDCF2209C009DB, 0xE86EA48B5B6F3F39, 0xB84BF12AD9132FE2, 
-0xDC6D825944811BB9, 0x381B81898F0A201E, 0x22059964BCBC4, 0xDA3C7C2FCB5DAAFA, 
-0x74F84B725AB8E5A3, 0x720E9D56CF17EBEB, 0x736024360E3A21E6, 0x529A2C8828A26EC0, 
-0x869C50C4297976A4, 0x61588CFE53A, 
-0x858EE17E03A95FB3, 0x6D179EB603320ECD, 0xA79F512866434C99, 0x89A85A54E50F173, 
-0xFEC0CC93361E6BEB, 0xFFDE8D620EA6E9AB, 0x21A20B4098F6A, 0xCA888F57ACA873C0, 
-0x9A50D95DE7A71205, 0xBC7CBEB3C8A98062, 0x2A2905DF61B87ADA, 0xB291F326FC02A2AB, 
-0x3E609C4E7ECD502C, 0xF4589C2CE8DF, 0xADAE53CEF38551E7, 0x34D0CFFBDE9619CA, 
-0xAC9A701D7B5C7C0F, 0xB14E1F10C87D96E6, 0x48D6572A797B36FE, 0xB9683A45FC90701A, 
-0x13DDB71DE40BC, 0x2F9C779613D1EB20, 0xBD55351AF620C75D, 0x97E623955DE2C6F1, 
-0xF00BDBD7698387C, 0x51CBBA19E50C3C61, 0x5F3642423EA425A5, 0x1B81B90642DDE, 
-0x4C2EAEF1CEFCDBE7, 0x736480464AA31966, 0xCA127B84714F101C, 0x7E419C0DAD15DD90, 
-0x7CCCDAC3DC01253E, 0x1FB3B5BDE2C93EBF, 0x17C77D3B6FD3B, 0xE6F54C1EEFA787D6, 
-0xEFD4296AC605632A, 0x8EE5AE0226B2A8D2, 0x9ECDD8D398024EEC, 0x2E1CB33EA04D00CF, 
-0x464AE77AA92E13A9, 0xAFF71032B956, 
-0x8477DAECBBF7AFEE, 0xC4CEA77FC65DD0AF, 0x708D21475374EE8A, 0xA9071AA7FFD218D2, 
-0x74299452AA96A753, 0xC1D694EE1C0F6758, 0x307B19DD1825, 0xFC7252D4FBF8C849, 
-0x269C191CC6929A6, 0x9ACC9148C0F65B26, 0xED2DBBCAE7A3E486, 0x45B19AB48ECE5D56, 
-0x5F7CD50692571186, 0x19B34DCB42909, 0x20D1D5FDDFFE608F, 0xEF7F528260E40225, 
-0xA1A23C15C212B507, 0x3DA7B29B1EC33EA6, 0xCBAB15C5235A0297, 0x609F3E2D4D738CE3, 
-0x1542B656331C8, 0x1E65EAE77C59C667, 0xD17B6DD36F481322, 0xA3DEF060B572C354, 
-0x9C5A706D158433DE, 0xF2F48D157A95AC5C, 0x5AE4305B0A56F366, 0xD438B9D41AE7, 
-0x8FD509195F1D6C55, 0xB06FA1C951ECE50F, 0x3E9BE721FCF076FD, 0x85B2919E8DF876C2, 
-0x79636DCF86FD975C, 0x84C4EC3664D33000, 0x7C341F157510, 0x137F69B41C015930, 
-0xC13C66ACA7C5CD52, 0x6492B4371600668E, 0xABD67760352A65CE, 0x895F4E4B73A9CAFE, 
-0xA1AA295248E45B89, 0x1EE2559C3EE26, 
-0xB6BAD24034A03275, 0x8434793738D2CCD, 0x8D78BF7226ADF2F0, 0x6600AAD89C607B03, 
-0xC2EC1554C5311D19, 0x8661531B0B8044D5, 0x1BD87A13AE9F3, 0x9C5135CD8D563E7B, 
-0x773229CE34DCDD93, 0xF1CDCBEFF33D96EC, 0x422C54F8ED4D022D, 0xC63EB1371E0151B6, 
-0x2D30AC650D3057E8, 0x714F41AE5194, 0x1433C9C9A70DBD1D, 0x96177D4DC7B0EC62, 
-0xC41FE314F28DA6FE, 0xEB893CEDE552E338, 0xEF3611F3972C9B7F, 0xAC47F0BDD64891AE, 
-0x14FCD79113CFF, 0x58ED9C42626AA8CC, 0x5EA466A92F640AA5, 0x74B558BE552CF55A, 
-0xB09F4E37F0477C2B, 0x83C8435A5F56810A, 0x13C032465CD89BD4, 0x173FD49FB3167, 
-0x8C7D55A2C5804302, 0xAF9048CBC478E454, 0x8FA3CB85FF47F215, 0xD0B42F4887B1DA9A, 
-0x465EF4C975A9F36B, 0xEA5FBE9067832AED, 0x11E1D319D90CF, 0xD3EB64FB1111F6B4, 
-0x837CE168D01EB541, 0xAB49D8A50F1B523D, 0x7DABC602E9122DB8, 0x1B7926B5B10F285, 
-0x9CEA4D8D552A8D77, 0x2259ED960CCD0, 
-0x8647501B2F078D49, 0xB3802C6ED273AF1E, 0xA87D2315C283F992, 0x6BB53593406745A3, 
-0xA1F5EBDEDFA6D925, 0x60C03516B28987EF, 0x531C8F5E5161, 0x1087A27BB6FAFBFA, 
-0xDE0A2350B689EBDD, 0xF3BE02383E55AAC7, 0xF66DAD79943D273C, 0xF7AADBC781D4D992, 
-0x6EF3455BA83E8D3E, 0x20CBA0508A718, 0xB682C827FE77BF49, 0x3793D366D2FA081F, 
-0xAA66B510CF133D7C, 0xB7A6BE26294FE615, 0x8B05154EA28946F6, 0x99B7DDCBDBA0CE91, 
-0x118EA775F78AB, 0xE50BD823B2A03542, 0x45C0C53C17CA55E4, 0x5BBE0E61E28A8516, 
-0x1059D843679D0C84, 0x84390651B63D4BAD, 0xF9B3AFBBF4F4D600, 0x17F38E897BD6B, 
-0xE8619F571E12C5B0, 0x1E5C51BF1B03D967, 0x85EC0895F2F570F9, 0x4FC66F6894FB2A42, 
-0xA3A269AC854FB597, 0x3768E4AC9352642D, 0x1E50C13265613, 0x43FF722F23E7B39B, 
-0x8AAF76417BEA3D6, 0x337DE6591F20B252, 0xB7555FFF557EAB97, 0x92C0ED9C05F6F674, 
-0x5CB6EA4B35632EC0, 0x1A32D2B13AB99, 
-0x7C0B19DD9795431C, 0xA3F410E327550376, 0xC14BE091BBF57DE5, 0xEC922FAC2CE3F75C, 
-0xA423698F6E32C7FA, 0xBEBD575278CFDA41, 0x1ED5C0FF427E4, 0x4478FBB296C574E5, 
-0xCB72B492D2B84210, 0xC4B5E2251DE6E0E2, 0xF2EC4E0A1E3306ED, 0x3255CB0724E4424F, 
-0x4381CD7B95081559, 0x1F40D655CFA20, 0xC59C39DEAF46FCBB, 0x99EAB749E62FF19B, 
-0xF25B1FA436F8941C, 0xAF8996BB2BACEBB7, 0x999663137E79F393, 0xFC895F26610594F1, 
-0x1F1999454001B, 0x490CEFC70473E7B3, 0x93A7F7ECD872039F, 0x428D85225E39BDC3, 
-0xD52FFDBA472A120A, 0xAFC00C86EE6C6B3E, 0x9A7D27F38C8C3B72, 0x143E21D7727E0, 
-0x7B9D42B01DE49B6B, 0x2758F20E54D3F6FF, 0x6625862FA68DE442, 0x8CA3CFA8B3E3B452, 
-0x71D32C6BBE7187A5, 0xC45BC036A7A8B755, 0x1065A9DB65B6, 0xEC346557EEE05735, 
-0xBA710B61DB246F29, 0x438EE09DA5452FF3, 0x2317284DD416080A, 0x5133D1A4C7EE864, 
-0x7614F7817AD7E28C, 0x535261D1835F, 
-0xE19D75885A0348BA, 0x6C06FC0E298C147D, 0xA4ACEFCD7ECA24DA, 0xB5F6172800DDDF16, 
-0xD2A0E0C5573C613A, 0x86E8618A9F8BFA2, 0x1E0E51425ECB6, 0x8F95B5D9D0CC0AA0, 
-0x39D14BFC8A6836F5, 0xC0B44B9EAAF2ED69, 0xCC8F001DC363A2CF, 0x984E37B715D4B51A, 
-0x8E43E4020FB09280, 0x228CECD380EE5, 0x835B1DED08CE7D35, 0xD8A62AEF039669D9, 
-0x2658D941ADA41B59, 0x3D24AA4A5CB3EC76, 0xD8F3DAB2407526E1, 0xA1801D5B200E3EF0, 
-0x96BD1EDC61BC, 0x4CBDA262398A1364, 0xFD2C9D5146CC77E9, 0x3AD2AA1BDE3F9CF4, 
-0xDFADD925DC043D0C, 0x6E3BCC240F2A90B4, 0xF74EC14529FC9689, 0x29AEA9CC62F3, 
-0x9762B237681EE8D2, 0x6607554FCA35799C, 0xD369ABEAFA64D7C4, 0xAC854490EBFEE4FB, 
-0xCEA9D92C3A947F6E, 0xBD971CBE37DE1382, 0x177D6ED8C48FA, 0x369DB1D3E70EBF53, 
-0x88CD659600C8EC18, 0xCC332FAACAA3D393, 0xA673F79F69FB7101, 0xB0740DA8971199D9, 
-0x9B9430CE5CA7DFE1, 0x13C30A3479EE7, 
-0x239E0B7B99D13ACD, 0xC53ABA801782CA40, 0xE11FDDF26B448B36, 0x378963DE3CC0C1D3, 
-0xF598CF3069EAAD9E, 0x35245FFB3479BAD8, 0x83511A13ADA6, 0x7E0B3C8094CEE771, 
-0x2C8FEB1BADA65CD9, 0x5B4703D07659F54, 0x8C96265BC9DD86E0, 0xBC2DEBA901B02F19, 
-0xD98D49B706DCA243, 0x22308539C8095, 0x1F4B40ACB4875FAF, 0xA7B85ED9F006DEBB, 
-0xCED0EC3829A18FDF, 0x15009B60A3ABED5A, 0xD8A8CED888D0229A, 0x628BDF2E187B38EC, 
-0x1A95276866026, 0x86C72E906503B572, 0x43339911F647A1E9, 0x7F47D5021AD9AACB, 
-0xDF9C1FE903A1D9F7, 0xC9F85B78AF919557, 0x7DE1BCC892E37999, 0x3093EF87B8D, 
-0x87B7064E1F8D40EF, 0x5C78F1D59BAC5B55, 0x78C54D70290309, 0xC5CEEC1A103AADCF, 
-0x6C7138316B14A6E1, 0xA98FA02E6D7410BD, 0x97389352BDA1, 0x88BA3308B84FEE03, 
-0x55114EE30106FFB5, 0x753E0E57EF982D8, 0x4C2FA3FBCF6D9052, 0x22582218944892B6, 
-0x1115DEF5CEB61B08, 0x11FEF53EC5D9, 
-0x59D56C3AB8FEEE1A, 0x9ED838C20904927A, 0x2B600488E266C228, 0x29375ABDDE09778A, 
-0x5CCBD231B205DF81, 0xD67C6349B34933BD, 0x1BC163C1DC525, 0x280355B58C110F4D, 
-0xF10B7DB19E93F35E, 0x314199DED0702BD2, 0xD2DD5757D34EF66A, 0xE96B85E53DFC194A, 
-0x6DBF236D22C3BE74, 0x21AB2443C5218, 0xBE997A06FD1CDF15, 0x3CBF09F6DA2324B9, 
-0xE794011365F2C37A, 0x93882439EA7A7E3A, 0x61F249F4DD488323, 0x2BF431C0931717FB, 
-0x1105441C04494, 0xB0F6FFC7015BEACD, 0x33EC5DF84FC47D3C, 0xAF0A3E130DB79B6C, 
-0x896AF85CC18A9EB1, 0x3E8EF3DDC69DEFA6, 0x6AB020270CCAFF59, 0x166E79C86D126, 
-0xE7C2306FE90BCC86, 0xB0499DEB5C683630, 0xDBDD3E06A3A8C319, 0xAE5323E7129F9B4F, 
-0x5DD3B00DBC22005E, 0x4B1F18C0A3CB00FC, 0x1C634AB98D71B, 0x7979376AED82459A, 
-0x19F3D3BF09C8AC07, 0x587AA7C0A12E9144, 0xA644BB174460548A, 0xB5E129638BBB96DF, 
-0x863B9301582C18C0, 0x1C4417D6362CA, 
-0xBBF0227C2BDFB4E3, 0xA0F2F336BF7F931C, 0x8D3666343D23F172, 0xAD7FD7A1A93ADE6D, 
-0xE8AD3883022A2E61, 0x7E932AFB0FBA5311, 0x1E91645550DBA, 0xB91B60AF5AD69277, 
-0x9609B94BF41EE8B3, 0xDD931ED87A2422A3, 0x84F1D9239A9825D2, 0xACC506FA6E1789E, 
-0xC1904E8CD588C85E, 0x9251B76633B4, 0x550BF45122BA375B, 0xC1B5C340BD82F421, 
-0xA10B11FC92C595D4, 0xFB69C34BCFBCD423, 0x6D0EC53E65C6DE6, 0x6F7D37F6406837BF, 
-0xBF7DD3975BC1, 0x6A458DF6C7E26BA0, 0xC2D9755A89AA9E85, 0x74EA76F08EC65BF9, 
-0x5C10666442B1AFE4, 0xF67FFF9F03864BD4, 0x2D08D930151CA96B, 0x14E2E48F9E52, 
-0xB43780B1AA404BD5, 0x1EE0F4EBA436785C, 0x2C5F871347D6857, 0x220D59AEC68637D4, 
-0x5F7E658540E49C0, 0x279F98E9BAC8308E, 0x1F19D2E92E2B5, 0x7048D8191B321C5A, 
-0xEE7254801B494496, 0xCC1C6B456584D4B4, 0x8DFFA438CEA9555D, 0x199CCDF4887360CD, 
-0xD0AA3D9E39DEA6E2, 0x1FEC898B4E64B, 
-0xA1167705CC604802, 0x9B0475E804B66EBB, 0xAA74374DB1D02C07, 0xC5F9051D584032F9, 
-0x1943AE86ACE3FD71, 0x3E6A71D30181F87C, 0x1CBCDE59123F, 0x599B52AB71D7268C, 
-0xF3484FB328FC310, 0x219D02462C485995, 0x96813438E13E2630, 0x884F4F0AA13D44B, 
-0xF3DD64C9126A7927, 0x61C76B751FF1, 0x22ED0D64BE52CA7C, 0x528980035F395C15, 
-0xCAE03D0D5A43C73, 0x1C1287264D5C1AEC, 0x84E9789DAED7AFFE, 0xB4D9CA0724DE85D5, 
-0x9CBB00506503, 0x9697F12BBB4F9E15, 0xC540123C632E6148, 0x563FEB07C62FEB33, 
-0x60E96983F436FADF, 0x142F689696B92FE6, 0x2BE7B97EAFB4CCF4, 0x175E3DB54C653, 
-0x56466284DA74FAC5, 0xF7CE3453F2560361, 0x59CD652D860735F6, 0xC5B1F498B026D1E8, 
-0x6A46771D4DF854EB, 0x7B54C0443FF94936, 0x17B0792A0D27, 0xC6C2623A2B4B782, 
-0x65C5D5CCA5852FA6, 0x14C01FDF3C34696A, 0x8DBA5CB98F6B1427, 0xB648AA37245B17F5, 
-0x50286375AABA2BA9, 0xB7AAA6A8056F, 
-0x52EC5D6A5EE7D806, 0xED3DEE0C046E62A8, 0x8B9665851068329F, 0x83C26D40D5F05564, 
-0xE490AA6D9063BFC0, 0x1591B5FA2A448FC2, 0x7DEBCCB15816, 0xF513A62CD4F86622, 
-0x12D53765336B8AFB, 0xCAAA83114D2CB2B1, 0x865327D8FCA47DC4, 0xF45EB1F8C73CDEB4, 
-0x8FC57FC89FB43695, 0x2C3D4552FF2A, 0xE838C6E6429259E7, 0x7C7411899F6CF3DF, 
-0x95768E648101EBBF, 0x41D8099C8544F62C, 0x517C557CA8678977, 0x5A9A890DC1E584B6, 
-0x2F9118CE7D77, 0x2005760ABE9FDAA5, 0xC64FB2E8C999A3AB, 0x4FEC519E158CAC5D, 
-0x74B5031081A1523A, 0x55FBE3DAAAC9FB3, 0xF55E353BF4600419, 0x134F4F456BF0A, 
-0xF923CE1B72952198, 0x5632F2DF369A7270, 0xD23F9A2E1AAAD6D8, 0xCA99754637E329EE, 
-0xE8B0C4BF2F474B96, 0x9DAC252ED3ABB446, 0x9260A82C0946, 0xDEB616C093AAE330, 
-0x53880514BBEFE53A, 0x782ED92E2DF9E6D8, 0xFEE32B2B2DE0B081, 0x1C47090F1C5A953D, 
-0x670803DEF462AD9B, 0x14C54E5932CE5, 
-0xEB6D78D8DB18A05D, 0x908ACC004FE7AA48, 0x3E341378D9D6CB64, 0x1B9BD602A8D4953, 
-0x2201E45C5452991B, 0x3AB75F313A6D5EA9, 0xD9D595CE563A, 0x2067247DABE833B6, 
-0xB8B60516F45C65C2, 0x7EB5D46365A4931F, 0xE85BC3737CD1A201, 0xD437A28C0C50ED6D, 
-0x36E0C9A653D5F4E9, 0x65241B21F647, 0x3CE693046D18FE26, 0x97D3CB4623E24788, 
-0x5D04D524DB413EDF, 0x603C77B7364A12A3, 0xF712FE6AD4D5D237, 0xC5E6E682B724C891, 
-0x21E3610B487F1, 0x9C5A7C8AB674E87D, 0x59F719E4A89E5E31, 0x9AC89EB43DB82E6E, 
-0xB18919E5041A0D11, 0xF367EC405470DB69, 0xA2988CFE34964CEC, 0xB53CDFF37DA5, 
-0xCDFEEDD820E107C8, 0x34992D65F7EA965, 0xA95BF9A707A7DCD0, 0xAA411E13BA542D4E, 
-0x67F82E08E15ADA38, 0xC69454A28DB9035B, 0x1C8B3E0DF6990, 0x595D773002D49B7D, 
-0xABC6F7E98D944C8A, 0xBA4BB388BC5B7752, 0x2155F90A0F7EA448, 0x953DA43650A1F12B, 
-0xF71B2ED7EF6E4BF9, 0x2069E25F59719, 
-0xC62117B322B679B7, 0xCFD35A3E8FE0B469, 0x865474FBAB2D7CBE, 0xE94AA8BBC1FED13D, 
-0xF6BADF5906923671, 0xD3E0B17A18DED721, 0x16F03466B979, 0x139017F547C76CFD, 
-0xC4CD171FB62530BA, 0x460629943BB5700C, 0xDFDD92829CF80672, 0xAA8DA5D45B0168B7, 
-0x4A0ECDFD65BC0948, 0x2056D441349F8, 0x7D67D8AEBE772690, 0x51D13A8924EB30B8, 
-0xEB051B1A30638CC7, 0x8446BBA5B4394581, 0xFDC6430D38FFCF36, 0x6AC52C9F1CB0EDD5, 
-0x96864BD65FB9, 0x96431B2C57A6C9A2, 0xD107BE550A8CE5DF, 0xD8EB4C8091C4582C, 
-0x5BFA034E400151D3, 0x2B651C2360CE35B6, 0x7ADFD66DF540E7ED, 0xD466AE1DD6EA, 
-0x16770B0138AD88DC, 0x2396203017DD5238, 0xAB4679509EAFCFE9, 0xB86AA9BBDDB82A9C, 
-0x2E5205584CC5E657, 0x8312A2B97E997BB5, 0x5486E4EB507E, 0x281E06C8FB1A9CF6, 
-0xA057BA3F45CA337F, 0x90C62FC80CF9838A, 0xA9A2EAC35E19B5A4, 0x104824E446EFA4F6, 
-0x51CD21CF2E263CA6, 0x1D9E214EC518B, 
-0xF4D5858502BEE612, 0x3E7E47AA53D7A61F, 0xE97EFFC1323D4939, 0xB148D2F00D4895E6, 
-0x5F7C9B35B13646C6, 0xB1BA45A292EA1BC1, 0x121BC84F21887, 0x2BB387BC7668D247, 
-0xC8FE3B8F40101302, 0xB5AFF1158E7D004B, 0xAA9FAF9493D86B76, 0x2DA2BDE1D553485B, 
-0xF6D6D3D355D999D2, 0x14408E95C3656, 0x7A921AF479B8018C, 0xFBF10D450D60796D, 
-0x4D62000569562FBC, 0x2EA9D2DEB125EC05, 0xE5B01B634EAFCDC8, 0xC8D296AA92F4B29F, 
-0x4131623D8295, 0xA997F7718C608823, 0x8A1F8FDC6D627DF0, 0xB16750F3141BC4BE, 
-0xA9D85AF18DA101FA, 0x47156B1A0AE76641, 0x151701260F55A966, 0xFDBD6776537E, 
-0xD7DCFE43F09B1CC9, 0x755D7C03F798DEE8, 0xDF50B90E371F95C1, 0xAA9E1F3875C0CF0F, 
-0x936F50B27D53D764, 0xFF9772D61AE08D6A, 0x110235B24411E, 0x661FD00D189CF43A, 
-0x1B9D2F82880E339D, 0xE58B0888031466DD, 0xA30B147FCF7369D5, 0x9E75A7501BDDEF1C, 
-0x1C254B428C8DEDA8, 0xA995B7D59AD0, 
-0x417AA7CB12F5949F, 0x85AB4EE232BAA7A, 0x76E5C8532C0FDE72, 0x1DA5A0135F5F8F1B, 
-0xF4E8F13A636B3162, 0xB0AF2C3C55D1FC5F, 0x2C7F10608014, 0x9DF9CA0008906968, 
-0x37A669AF80DDC861, 0xF332D5A5083126C8, 0xA6BC9FC053E1B199, 0x11C8091724786D08, 
-0xB91604E0D883B46, 0x21748136D8270, 0x32FA5653ECCC0907, 0x9320D2D74D97F342, 
-0xAE07EBC7435E2195, 0x3E4A61F38A78C7A0, 0x17A3CAD1913216DC, 0x416BE69959FF68E8, 
-0x207D4565CF746, 0x9D9F3F1E81F3735B, 0x6DFA831936FAFB74, 0xE9F7F6FCFF20EFE, 
-0x7B5001A9F460DB15, 0x6651E738302C8516, 0x882F9A96F2D6B84E, 0xFB63F85682C1, 
-0x1E86CD7681F49752, 0x23A4431F542B898D, 0xA009B12DFF118789, 0xB9E7486C76C15B68, 
-0x665DA95843519EFE, 0x276147DEE9A6CE10, 0xA6308998658D, 0x8E59433A8928D537, 
-0x87B0D3AC14DE3206, 0xA0A764D765C369A3, 0x5F19D90A92B980D1, 0x5116EE65CD6B1A28, 
-0x1CB4A8B5CD626268, 0x1CB0F468FDD70, 
-0x7E8162A73C42EDA9, 0x6E84D36CCB936BEF, 0xD3560F1A46AF4246, 0xF948E2E1DB08D532, 
-0x6657B743D033357, 0xC80C8D8BDCFCC4B0, 0x630017B8CBDE, 0x6813C2CA78EA6532, 
-0x239C90DAB42CB8B, 0x828A7C1E1D539084, 0x3F8D3FDC3EFA47E3, 0x1EF9A368EA7C189D, 
-0xCB9D162A07D0B223, 0x122D43C537743, 0xC9F636E017E3B1B2, 0x169F3FA9EF4947BF, 
-0xE36DF7008112862E, 0x62EE22415849A2C4, 0xABD5C7C940155AAF, 0x6F795C3F0ED34B94, 
-0x67341A0FE224, 0xFC640D49F99BC842, 0xED5B99A8897FEDD5, 0x3BE81C9AB23D280D, 
-0x276DB255CAAA6A2, 0xE965AD3D756D56FA, 0xB3FFBD9AFC917767, 0x1CF00D0E0800D, 
-0xFE36BF38356BE66C, 0xB2171C2712CF3B35, 0xF91AC8B1DE16767F, 0xFB075D0E3DB01C67, 
-0x6FEB3C7348477B34, 0xA5F6EE511CDA4B49, 0xD6F772E5D55B, 0xA9F7A9B6186BD93E, 
-0x5186044E8809F756, 0x5C35FE492B0B7766, 0x1A45537E1601E5C6, 0x331F6A993C4C8CAC, 
-0x3C2BFF1889FCD6BF, 0x1C53CCE51B05, 
-0x9826DBBD6605AB26, 0x46E86FA1200268BD, 0xA2F260A9B28D3670, 0x7BC117A02D0AC6A3, 
-0x1FDCE7FBE6027308, 0xB409FC13CF6A1492, 0x1CF91BACF82A1, 0xE907F75B3A968B99, 
-0xE47699C02AFAFB85, 0x48768C4CF9B98425, 0x7B16DA5471A9E53D, 0x9EDD43701335C6B7, 
-0x4B791853F21A6322, 0xFDCA029F9EC2, 0xB6CD17BBC7A43C8E, 0x36D19A5B43178CD2, 
-0xED306A4CE53245BA, 0x38C7DB7A81EC9B57, 0x853CD3459B9115DE, 0xFABAEF09391E3BB3, 
-0x159FCDDFFC63E, 0x560B307BD4200FDF, 0x67A9679AAFFFC3BC, 0xF8BBC28F967F8336, 
-0xE3338C68DE777232, 0x34BFB6FCC9A3E4C1, 0xACD3E854C46DF59A, 0x4F4D6CDD103C, 
-0x6E927859F2DEAE0D, 0xC8977DDCF38A908E, 0x99583037529B14E9, 0x3ACA2A118E1C7976, 
-0x45FD85B46B5E951D, 0xB29C4AADECAD7033, 0x11D1AF3CE2564, 0x14D736500F9FFA12, 
-0x4450F18DB3AD616C, 0x1C33F9559F67F7BD, 0x32899A1FD204A0D5, 0xD1534D316EB7591B, 
-0x94DE464790D7A3FD, 0x2117484AA15B2, 
-0xCE4F84F56F402BF4, 0x2233262072C7DC79, 0xD98708B9A05D814A, 0xDB716CB98EB4F9B7, 
-0x1989FD6C0C65FD53, 0x1D7F883036BE507C, 0x11526FB9B975D, 0x79F6B268817F4515, 
-0x65E0A8BD9B838236, 0x46764493B66C9AE1, 0xEAECFD9638C813EA, 0x3F20888D7774682A, 
-0xFC2BCF942BD3B72B, 0x1C98CF7087F4A, 0x50A13912001CF605, 0x7AAFB190343D01A1, 
-0x28CBC8D1DF727051, 0xFEAADBB9958200D6, 0x37AB86C82A7B3B1D, 0x301B93B95E3AB8F6, 
-0x1F84AB9F39AAC, 0xC54A5B714D8595DD, 0xFB03ED8FA8DB469E, 0xC41619A2FF6367CC, 
-0x31733E4E59C0FE7C, 0xD9CD40C63E3F5DA8, 0x2B2520E37CF66E80, 0x2072614B572A9, 
-0x5CE501306BBEBE1D, 0x2F15F9232688E728, 0xEC4805C61DDD146B, 0x1147AD22A32FD34, 
-0xF708DC7CB2F6B6A5, 0x96228A56F567BF37, 0xF6611B611886, 0x11E9CE8A49DE36A2, 
-0xF3F90225833DFAFA, 0xB4233396586568D8, 0xD4F95AFB622DFFA6, 0x548F577872047156, 
-0x5283DCCB7D4D6269, 0x1617A4F7C9EB2, 
-0xA2F3AF8C811333B6, 0x31EF97B3682461C5, 0x1896E09D065D24A4, 0x5BC2732409C4FD02, 
-0xEDC25375FB3499BA, 0x58B623AB99F3C477, 0x17040FE8A8E4C, 0xCFB05747C092C915, 
-0x47403FD4F98D7742, 0x70D779AF48CB7C05, 0xE93CA1051213E1A1, 0xF37DA0649E7639FA, 
-0xC9581E723FDC14FD, 0x14D02D156DD97, 0x7B40D017096FBC87, 0x95CB3FA51E87B11F, 
-0x67960769DE4F6E2D, 0xED95497968D0979D, 0x89945BA628768A31, 0xCC07F158FABB9292, 
-0x98F681ECB226, 0x7DA25C82C2613F1E, 0xD1A0A71AB5D5171C, 0xFB36057C0E5FA944, 
-0x646B6DB171D0EBB3, 0xB9E035817805D2C3, 0x6ECA7CD9AA80A428, 0x1D81B070C09B9, 
-0xA742B97646AE469A, 0xBB009D3C3F641F5, 0xF26E1DB3AA2CA33C, 0x8D63BCDB84F918A9, 
-0xED12E49E86B3BAE5, 0xB7D243ADB845F38F, 0x1A6CE763994B0, 0x2388CB8973932AB9, 
-0xB41231883A37C1AC, 0x257020E822C15094, 0xB7E22D56A2BCD6D3, 0xF608F5879DDB1B7, 
-0x7532A8ACEFA95A3D, 0x181350ADF2307, 
-0xE333A525C71AD637, 0xA9FDE30BFF75328A, 0x26EA1E4BE37EFDBB, 0x43BD72BF1A084A60, 
-0x58448A1E79872FD8, 0x51BC2341C9149ECB, 0x2108053F49EE5, 0xD6FF8610AACA8BCD, 
-0x6C0B2E287C8CD67B, 0xADAC6CE29FE7FD6E, 0x9C87ED532819C20B, 0xFFB1C6745BF5C8C6, 
-0x4CF81148056F886D, 0x178FC6046DB00, 0xE6B34A8ADB1EF7C1, 0x2570DAA91CFDB43B, 
-0xD35508C9B322CC99, 0x2E2B67A20ED412E7, 0x7CDD446A2A9B2304, 0x869571A32D9C1286, 
-0x1377B80A5E825, 0x9F10F20C2A7BEF72, 0xC6C44746E9380A93, 0x7DBC78A426BDE220, 
-0xC8DEFF7CD6726E9A, 0xABBEBE9B82E9E8C7, 0xE68027465AA2E211, 0xB8A985F5F29C, 
-0xE8EA6E9333FF7547, 0x6A6AB39C8DD50C70, 0xCAEE39561B2C7D66, 0xF69512EC39B11BE8, 
-0xEB6EF99E5E748210, 0x3AE3FD876E59B518, 0x6B75BFA4B39F, 0xB4F3080428A2BB6F, 
-0x1853B34104C7E88A, 0x6DE8B7709913AD85, 0x6AD9FEDFF3AE11DD, 0x3D3773D6CE6E8493, 
-0x1884B84DBDCAFA0F, 0x78578AEC6410, 
-0x8D3872E258C5E98C, 0x8418EC1C81C6245A, 0xBF601CCEAA632E7, 0x2CFAF5CF92537759, 
-0xD32CCB8CEDBEDB10, 0xEA31B38508F2E4D8, 0x151D254FE3B2B, 0x9199119B0D01B6AD, 
-0x766EBFD38F8265C1, 0xBA539ACC32DD28B7, 0x913F8A84E9C001, 0x86A640087FBA90BC, 
-0x1CFE3142E75A7EF, 0x159C99B689E64, 0x169010C789897E6, 0x9CA63A6F9AE67F1, 
-0xF073F6459C758BF5, 0x482BD7BED9FAB52D, 0x891360E28857FE16, 0x67ABD48788ACD4D4, 
-0xB539842FA121, 0xDE351B253F126F17, 0x17A435D436BFAF31, 0xD0DF6BD44C6AD3A5, 
-0xD7FE84876D5316E0, 0x8AD5043EE56AA23E, 0x1AF037E264DD7446, 0x1BC40E227431A, 
-0x51B9F56A80D5FF0B, 0x699E561073423020, 0x27B7C9A5A63ED0F6, 0x219B234539C2A3FC, 
-0x37102E2FCC56D989, 0xE47509D00EB4E9BF, 0xC63191073E19, 0x82E72911D5E03D45, 
-0xB09AC2C3F4773BE0, 0x6DD920BD6070A394, 0x3902B40E64B49EB1, 0x716105DD4251C547, 
-0xAD5AE3E65B15948, 0x10B5BE0BF7890, 
-0x161475B90BCB3CCB, 0x4E4B1A76B4C6AAE, 0x6A3F40495DBA2C61, 0xAD5E385AAAE70B6A, 
-0x9B713FCAE3919774, 0x4175285380063A04, 0x10C2E7EA03BCD, 0x51C5152546CD9E7A, 
-0x13943EE8E92E8AFC, 0xF3C4D20BBABF67F9, 0xF98AB344B32D3BB2, 0x6FA91E9F1F39339F, 
-0x213B118B1251C91F, 0xEBBF84D6EA19, 0xCD0B67BDD5E019AB, 0x8CBFEE99A3FF3320, 
-0x4C76B2194F5E4F2F, 0xF8415F475C5B55E, 0xA244359070331116, 0x5E91FF7DCA61A6AA, 
-0x13B0FE596F113, 0xFC745EA1FFDBF0A1, 0x9847D39BC71BE897, 0x836FF68B585DFF2B, 
-0x6AF2117C72F88638, 0xC3D6D6CA8202D43C, 0x92F6C294BF5333BB, 0xF72F55BAD358, 
-0x5847D19BECF6D882, 0x6C4723B9EFB5F78, 0xECFD355DC8052910, 0xCB7E951D3FC1BF07, 
-0x5364F1C05A567DC6, 0xCF79D5E02DF5DD8B, 0x1D23A29F3BF33, 0xB3A4F7702DCF304A, 
-0x866AC329404D80E, 0xF23333B1025FC6, 0xC3E8C70EFB5B71CC, 0x7B2C97766F12F126, 
-0x9CAEEA3BCC5243D0, 0x21E0D985601D7, 
-0x972847F559F87F5, 0xFC7194E6D8E993B8, 0x37F6023DA541787E, 0x4E2F20143B8367BF, 
-0xFCFDCAB2D85560B, 0x120BB2E917AC752B, 0x1B74B5A9E7E16, 0x8C21ACE04BFEE555, 
-0x4EE17C1D7728A20D, 0xF3DF84AC161E8F1E, 0x6BFCBD80662B3B72, 0xA2AF5B3577B02546, 
-0x4EB51C00ECD7DE1, 0xF1CEE5FA3DB4, 0x31EFA80C86A9CCA2, 0xC2F1B078EB8297D8, 
-0xF0847DF1D602D170, 0x4AB9CA9D28E2B612, 0xE009558CA6B033F6, 0xD685733A2AF4BC2F, 
-0x135A24559C81C, 0x757B995A06394C5, 0x9FDF0B1F84CFEC4D, 0x379A5A07B384D817, 
-0xB42AB36A732FEFCB, 0xF0E29A2F5FFDFFE8, 0x6DF493528B935228, 0x207183A2B5FE5, 
-0x2218DD5E9634EDF7, 0xFA75BDE23CECC193, 0x36A0EF3A49B1D8D2, 0xE716C2A03D9CD450, 
-0x5BA96CDE213AB410, 0xEDC23956F534B820, 0xB497BDFD72D7, 0x440A73767CF27C37, 
-0x841FE6063B5773D9, 0xBB9BB99F9935C1, 0x1BE40C7E0C4FF896, 0xD24FE03897F87C7B, 
-0x5D8A645D0B0FE2A1, 0x2245230AF9EB7, 
-0x9F468713944687B1, 0x170F9106195C47A2, 0x2D93C4CF4C878918, 0x34FB7236224F52FB, 
-0xC85B1AEC48928E30, 0x86C8FE1B4FCC827B, 0x510B602D6A7E, 0xC945477921794C1F, 
-0x199D5F500B774985, 0xD9FB4CAB60A68BE7, 0x662703F3BB33813, 0x5CCCF23E1A3B4338, 
-0x46C3147C1DBB5400, 0x1700D82C32199, 0x440E4415B0265045, 0x2EE74C9DDF523CEF, 
-0xE050C40CA5CD0C6C, 0x947ED2904653554B, 0x7C70754A7EDFEED2, 0x6BE9AC3014AE0741, 
-0x111E385708613, 0x24535B206B14117F, 0xF14A4455139898AB, 0xA3F127B45EB7D4A7, 
-0xBADEAD4D85910028, 0xAAA3808BCB15E441, 0x37628BAA92E8C4F9, 0x7E1CADD10EF2, 
-0xB0E22F213DA3510, 0x1CF0F8C010E35A4B, 0xE04DCACA80AD1E28, 0x86B1695C5211BBDB, 
-0x37C0B5F5CF2BA5FF, 0x38859A3C80D5AB85, 0x836D531FAC4A, 0xC891706EF73B2B0F, 
-0xDFFBA0FCDAB16047, 0x5F097CA4079B3D82, 0x5A5C6E09D573B441, 0x3427D5654CB1D53, 
-0x87113575EE049D5B, 0x1B5CD36C1416D, 
-0xD6A2C98D7BE78DD5, 0x761B45FA26156D68, 0xB3F3DBC7F7A684B5, 0xC9D6128808C9CFA7, 
-0xB871B08E870D2631, 0xD645E2397BBF3E48, 0x1F9EB2AE8F6CB, 0x9C49C3B84C9349DF, 
-0xBB03305EE7FFEC91, 0x39A920E47FED7ECB, 0xA7C68DC0B4987B72, 0x6B573504858741AE, 
-0xFB369FBCECDB0857, 0x105903164AF59, 0x4ED06B094647F704, 0xAE5BBBED4CAA8D52, 
-0x8CB4073FE74CC9DD, 0xD629F07EEE9409C7, 0x512D156423F32582, 0x1589A1F27292F625, 
-0x231F80561FB3A, 0x2339B8DB87F7E886, 0xCDAC08549EF72E3A, 0xB95A6CE5FF6FAEB6, 
-0x651DA51DFB7A6268, 0x62C3BD92869AFCBA, 0xFB3855FF40949E86, 0x61697C51A3F7, 
-0xB0446B3436872E50, 0xAFAD37090363957F, 0x81FC701D7BB7676B, 0x36CB880CECC3023, 
-0x904520E4949CB5A9, 0xE9FF8DC7DCEBA48A, 0xF2C11BD9A907, 0x34D417E3DF7DBAF1, 
-0x512657F13047C31, 0x41769A91A8DFCE46, 0xC07BBBF0F9E96DC3, 0x5BCAE0982179FE0C, 
-0x6CB3D7671B5FAB9F, 0x1DBB65F044433, 
-0x49F7A3BDAE9765E2, 0x329D77AE796FA340, 0xCEF5A1BB7DCAEFFA, 0x548643E85C448327, 
-0x8B0242FB9DAE89A4, 0x13F9EAE19A94F5DD, 0x1A6C5163ADFAD, 0x4B4F06479107C779, 
-0xFE17A51F6D984DAA, 0x77538C5768464B48, 0x5186D65B7685F133, 0x5BFF8466A34D5498, 
-0x9020363580CE3907, 0x1483067B161D2, 0xE51504DB1DD0DC2, 0x1FA24136101184C1, 
-0x7F2659383BE9B4A2, 0xADDE9CA18DD5B9D9, 0x3F81153E789C9F75, 0xC3775BD15A3B965B, 
-0x1D1D53EEA7073, 0x14E32B853D08BF67, 0x3095933732B971B0, 0xA4DA7D6974E66908, 
-0x924735F398D102A0, 0xBEB64D8E5964F30F, 0x87488469EFD1BC4A, 0xE0FB6568166, 
-0x35B0744E79B68BEB, 0x8669097111BDE82F, 0x3CEB5DAFDEA458C5, 0x69AE4858693B9CDC, 
-0x1A8AFC22BC552B8D, 0x652B2AA165BDD8CD, 0x19BA33F6C32F6, 0x78E21540794C118E, 
-0x7191AE089D34B5DC, 0xA130D3B1B2CDC1A2, 0xB7A26D443E442DBA, 0x8ECBD0E011FFFCD7, 
-0x83B87B388767AE7B, 0x7BD1F059854B, 
-0x900C7210DEEA63C1, 0x750E4CD088AB8525, 0x27739B2FC9B6A5BF, 0xACA1E45FEC52D988, 
-0x722902AA724875EC, 0xC82EB4F3726B43F7, 0x7556700092AD, 0x2A8117A282738D41, 
-0xA161286A17034792, 0xFC6F048D4AB1BC42, 0x8E27140793BC8428, 0xD7AF87D805ACF482, 
-0x50A88A97F5CFD0C9, 0x10E0649BC4F1A, 0x142B645EC8CA7983, 0xF7296E91BA08BAFC, 
-0x9506A81B2748D65, 0xD60BDECC02A51379, 0x43EC3954AE183A2, 0x7C3F025636E3952F, 
-0x1E2E701B14761, 0x78480A9ED4BC11D6, 0x6B91F4ED1BD924D4, 0x1A05D80B77126674, 
-0x428DCCF170B5D5E2, 0x34A2652EB84ACD93, 0xEA81167D1323C22B, 0x9B68A4759A01, 
-0x12492DAE6C2174AC, 0xA4580164E3CD6152, 0xE4847AD5AA7FAB8, 0x2EDA10ECA61B45D5, 
-0x91A7CDAA4AE9D0B2, 0xE862BDD23300F8F, 0x1EFD166BDF8E4, 0x5C283B97C3392540, 
-0x5B4B1D62DA72989, 0x5277895DF708EA5A, 0x429F3267AA47AC12, 0x7992EA78178DA6D4, 
-0xD77AD8C4F5A151C7, 0x13091D434D113, 
-0xA1CD51A3336D3F0A, 0x1A2311C4E7CB33EB, 0xA3E4FBA6BCF38E24, 0x8FE070423C9EEB2, 
-0x8D66212F010BE5E1, 0xDC616DECEC906CAA, 0x1E6AE15D128BC, 0x697CA1BA337208E0, 
-0x7EE17760B3EC641D, 0xF8971A2DAD2D308E, 0x1E0C3E456EF8B856, 0xCD95FC65536F3DFF, 
-0xB15A7E104D74AD43, 0x73AD4DB27A2A, 0x70A6B9D639E6C7B5, 0xA2C170220ED2C02D, 
-0x81CFCB4DACCA31DE, 0x608660AE190B2D25, 0xDFA67F65ED89E8F1, 0x3B949943633349A6, 
-0xA45341401111, 0xDF0F371D728C7100, 0x468809375DDC0C5F, 0xE3F2D624B0B17E20, 
-0xAEFE4B6DD7D6D61C, 0x5EE7575F3D9DD60C, 0xFC97A5E4DF4D66F6, 0x5293F56FC81E, 
-0x430C4FBAEAE32351, 0xA5A6E863AC48A334, 0xD0CFF15989EFF580, 0x9ABB8FF7720351C7, 
-0xC2BA3734867238B1, 0x251FAE217F9953E7, 0x651BF3F92F5D, 0x9115CF323B795883, 
-0x8976EA8F1357B684, 0xE172CD6AC6F2FC48, 0xC380165586336937, 0x52024E619ADC9EC, 
-0xA76E00C82264E5E2, 0x182832B2CABAE, 
-0x4A342D3F07BE63FB, 0xB38722BEBE5F8E86, 0x8978F684A9235ABA, 0xDC4F71ADF3A6676C, 
-0x483B0055EEE5826F, 0xE740D12C9D6D5B11, 0x8B758AF8A619, 0x64C5EB4CF849FE3E, 
-0x3223A03713CFFCA6, 0x4ACD72FD85833356, 0x1F9830232BF05D70, 0x314E56B3AD974321, 
-0x7F08EC8D6760FF81, 0x1CDD8498AE203, 0x771C58B8144435B9, 0x292ED37545FDED5, 
-0x644C90B4831C8D97, 0x4C34FB3CDC9EECD1, 0xBC7093D9ACEB5473, 0xCD0317DC24D7152F, 
-0xE7588859F381, 0x40E45A92EF8D3F74, 0xA7D2D3AB7DDECB8, 0x5FF09DD578B5D205, 
-0xC7FADBD1B161C428, 0xB9DD688CD08D1414, 0x83EBD1424D5DD9C3, 0x1E9216DE7A064, 
-0x35F1E494ED1CC41C, 0x10A8E1B82C8144E8, 0xFF6866E5277ED927, 0xC29F2332A65E4DC2, 
-0x407159C0F9E03133, 0xE02FFE623F27FC3C, 0x176588F6281FE, 0x40D18071A7BF094C, 
-0x26D5DB2C04407FB7, 0x5CBA318B45497A7D, 0x220AE7F44F23C5CA, 0x5354240124E0E692, 
-0xA83C14C5F3E308C, 0x5C05F58E4373, 
-0x7EE085E373DD31E8, 0x2811640A3C486E51, 0x2E899E770859AE53, 0x170F82D6E917957E, 
-0x56AFED3698934C76, 0xCFDD59D1D8CAC235, 0x1DAEBC41E71DA, 0x11EFB9793A0480D, 
-0xE1E31195E9084673, 0x9CF95A13F9DD2E36, 0x88CFA782697F0393, 0xCF8D66095B94FAF1, 
-0x256DD4C6F7EB3496, 0x3961B64209DC, 0x21E5E7243F51C944, 0xDD034CB11CC8F116, 
-0xCCF0A390CCA74CAD, 0x402017335F6F4AE9, 0x8E333D8A73D28C0D, 0xFE66DC5CEE7D1842, 
-0x28EB1FE39BE4, 0x3A3381B6C131DE68, 0x92133C4F28132DBA, 0x867BCC9E9F5811DA, 
-0x346D95579BAFFFE1, 0x96918FBF0F2A4B6E, 0x776AD86F88F32F75, 0x61D294257F71, 
-0x85C9A5D3A8DFFC5, 0xD1AAB0B6D323E742, 0xE9DBB2DA67E75333, 0x62041DA12E37A062, 
-0x2A5B45087872FB16, 0xE0B2EB5686C8323E, 0x141BC811D58D9, 0xEACEB86F027A9598, 
-0xFC8FFDF99EAC3A4C, 0x3C533637F45BCC3F, 0xE74A63253C1583D6, 0xCC88667FAA643D34, 
-0xEE4ABBB031E903A6, 0x120D6ADA390D1, 
-0xBD36CE2C05F93D03, 0x9270B99A3E27B91D, 0x43C8545F29A34D03, 0x71754149C6CC41B2, 
-0xDD6F53A9051DAFA6, 0x435B9D1CE6B94133, 0x1F59B3E07B6D4, 0xEBDDADC99A68FFAE, 
-0x77E83D1A5BA93, 0xE6FAF29D0D342E13, 0x9C770E70688EED8D, 0x4F67116D2954BC54, 
-0x10455FE00ACCC502, 0x1C2C5442F3B43, 0x4B93603B729B88EA, 0x6ABCEAF4358903A7, 
-0xC3582876985F58D6, 0x49BC6FE506B680F1, 0xE2623AC4754C72C2, 0xD1354E02D98B85F3, 
-0x18FF37ED2DE46, 0xA37C3BFBACA8112B, 0x46A104ED1F7A0224, 0xA80AD17274CB4800, 
-0xB1651EDEBF970F7C, 0xF94D47CA71632FA3, 0x8B95CF963EC0B52C, 0x1209AB2840197, 
-0x7D9F3524A3757D33, 0x1D29E3D8123D00F0, 0x46C9497FF9537FE9, 0xCA98F78E54F48924, 
-0x23AF13A0C34A809F, 0xBE3BD45F8371F3AC, 0x260C92718503, 0x11B13960F0681A3B, 
-0xBCCD055D50CFA8F, 0x6E5AA1557632D0C2, 0x320FB8D12E627CE3, 0x5E2F619300D35728, 
-0xDDB7A0FF7B34D64, 0x20C7564B096EE, 
-0x2968B12383123DE, 0xDFA11E2CD3650FF2, 0x510F891DD5B65A3B, 0x46B5568C2632B566, 
-0x8DE4B4EA4E56157D, 0xD4533905A9A33ED5, 0x14E0E81D1180F, 0xA64ACE11AAE7F01B, 
-0x8143DA4812D31828, 0x74DE31FA3B15305B, 0xEB7050A32D01233F, 0x2D7B164EE5E0E359, 
-0x75C38A141D569623, 0x1EFE35159F4C7, 0x95A1E4201E870D85, 0x9DFED2BAC1F55E18, 
-0x7BB8258D4B68B81E, 0x2140082014DED918, 0xC7C5A97B59F3B4D7, 0xFE77BCA52360FA3B, 
-0x12B02E5FF9E06, 0x40B5CE501086BED1, 0x8B5AB3659420244E, 0x79851EB1EDDF5397, 
-0xE97ABBCDDAE239DB, 0xDB6AA0C50B627D4D, 0xB629CF74F7EA9CAE, 0x10690556AE07A, 
-0x3C50A6BE954196FC, 0x27D7405FB0131F0E, 0xA58F8C5B28ECC94, 0x3C1E7550C10B4505, 
-0xA8C6A73B1025A95C, 0x10C9329DF50AC5E, 0x1F0E37FA93C73, 0xF60D05B60460EA0C, 
-0x51B50231465F23BE, 0xE0447922EBE80BB2, 0x235571CA1222AF5C, 0xD6C250C26E4D9231, 
-0xA6610FCE5DC7C7D3, 0x201230BFD9B87, 
-0xE53815DFCF57AF40, 0xF8E597419FE1919E, 0xB23BD512845B0CD5, 0xE41628CE95B70A4E, 
-0xF2FEE4B4532EEC88, 0x4841EB18E33862B3, 0x210CEA64E3359, 0x42BB0F701FD85A29, 
-0x1EEAC79A9C5C0127, 0x361CD68264BB1647, 0x9E325AAA358159, 0x10A02191A0BF2C86, 
-0x8EFC36FA1F1436A4, 0x839AAB3D5BB0, 0x982C741F94BD08D3, 0x1A294BC442BD6112, 
-0x3F5998B443D3433D, 0x7853B1CBB05402A3, 0x93FA1305B5EA6FAC, 0x77F7894DDBF40C29, 
-0x44EF55C2788A, 0x7BB8190E5160EA01, 0x94720CC1BABF7B37, 0xC8E298D0B7A64732, 
-0xBC9C367BCF8DCEB5, 0x4686E3B12137C4F1, 0xDEED47F2921D01D5, 0x2CEA420E749, 
-0xFC8906FD2F63D73F, 0x2F861CF5A3736C1A, 0xC97B5B065A7C6FAD, 0x50CFA8C02F1BA68F, 
-0x6081E6A510ABC81F, 0xF157953E0DB1B63F, 0x22EE60423A038, 0x5DDD7E970E548183, 
-0x97C13CC1E0FADC2F, 0x5E0FBD6B3F9E7838, 0xB0791288BF03480A, 0xB58283D2B1153EBF, 
-0xB055C054045FD8B8, 0x17E0FD95AE70E, 
-0x92BC9451108AD51B, 0xEC4AAE98565256F7, 0x13EC12ACB6B62CC4, 0x53B555B03B2CDE2C, 
-0x2E9E53ECF4052757, 0x79FD1984CE863193, 0x59DA17A6D3BD, 0xC23CAA213B325651, 
-0xF19DC27BE9D08DF, 0x2DC5F79C48D0FB47, 0x899358578E10CD9B, 0xE7DBF36CC71BCD7F, 
-0x61DF213AD3DE9A43, 0x20AC39D1E05ED, 0x5A0C7F61801CB5DF, 0xCEC694C4848C51FE, 
-0x792551F8F18CDA71, 0x3EFCF0D81D4E4C7B, 0x325C1424EBF30642, 0x11703780BCEFF034, 
-0x20B1358914CDD, 0x8BEE8AF3407AF49C, 0x88717DACE88A856C, 0xFEB2C2F3B519E382, 
-0x12A44F430649471, 0xBD62E4913B5B25CA, 0x463222B5E503073D, 0x1A374C36814B2, 
-0xD2960B0DA787BCDF, 0xEF5CB8244D209665, 0x7DBF423EE34864E1, 0x651BE9F699FEF461, 
-0xF9629890BD717F5F, 0x25599DE6EC2F669A, 0x70B29FF65728, 0x5E809D9DDF6D13F7, 
-0x4C875B8CF7A99D76, 0xB68306BC2136AF15, 0x9E6403BC2C521710, 0x2421C40FD2A889CD, 
-0x9DB0411CA2EDFF46, 0x1A9B81A55669, 
-0xB29C6D0C502706E4, 0xB649F2EFCF21F303, 0x8566D0BA59154A97, 0xAE8AD207550286EC, 
-0xBBBD73FBD607E409, 0xA03E993FC6BA6258, 0x1B46F14D19DF7, 0xB63F4178B4E870B8, 
-0x86D3D4B31984E3EB, 0xF9FFA40FEAD2407D, 0x380364E2376558CB, 0x21668149CDFFF7FD, 
-0xB076CF0BEBAEB8BB, 0xEDC0EFAFBA42, 0xB188996CA22A1012, 0x9E428BA8AEB79F78, 
-0xAE310F5C756B5E49, 0xB292208F50C0C521, 0x678BE2FCF03B248E, 0xBA9085D07BCB404D, 
-0xDD8F0A9B91C4, 0x7708B76E420FDBF8, 0x32F0251BEBD3230C, 0x947DE8467AA136DC, 
-0xB9CA1013281B427D, 0x90A2C714EB930912, 0x2FBAEF853E987DDA, 0x230F8EA86D8D6, 
-0x91F2B9873FF9F185, 0x52548F278B4A0184, 0x950D18AC46C988ED, 0xDD72D5407BE755CC, 
-0xE9C7583A75833081, 0x6DA9F3660E1EAB40, 0x1EC09160D46B1, 0x5612EC3288182720, 
-0xA4E4F14E08B7E367, 0x25EA7E7BF305CCA4, 0x18AF48CC15AB2B33, 0xC52C7B589E3090AD, 
-0x77302FB70E3E6574, 0xB9B5AE068C58, 
-0x2F885FB031310186, 0xCE464E23F96A0437, 0xC728C06C863D7AC6, 0x78BD965B6A822062, 
-0x482DB5E2E0F8D1E9, 0x5FA5925E2F80A064, 0x51B067F9F1D6, 0xF680AC6D7E909AF2, 
-0x49FA8275D90D167, 0x3D61B7E320BD4D8A, 0xDBBEF12B55F2789E, 0x154F1E2AECC542EF, 
-0x7AE304DA2FE8DB1F, 0x109E1E7F6AD20, 0xA20A9F6CD06715AA, 0x4337ED911C9AFCD4, 
-0x32CB8F89129F9077, 0xABF33DB593D529C9, 0x2ED76EB1AB14FB77, 0x73A0FF6A308754DD, 
-0x1AD19961D6C03, 0x20581C111F91FA5F, 0x7C4E3ECF97E2BC9, 0x1037E64A547CFE4A, 
-0x1A0DB58D1C1D4C85, 0x6310C57D1F8F3592, 0x3A44C68C2DC222CD, 0x3C3018750C1B, 
-0xA670E11793AB53BD, 0xE5B033E983B50C6F, 0x47483AFEFEB2D63E, 0xF31BD2C83C13865A, 
-0x707B4CC6ED995E87, 0x6997899FEA018327, 0xB5B65CAEB6D4, 0xB47E9A8E9DFB3A6, 
-0x8C8924B03088DECA, 0x8FB268E26F0DD9E6, 0x2E9E4EE5FBA7DAD7, 0x1FAA175456AB669C, 
-0x72EE16018AA1A000, 0x18524BD0C50C4, 
-0x352DF1F1E338EE0B, 0xD9240741F65FD54, 0x4AEFACF2DC8A2A70, 0x5189A9FBD0C3BF11, 
-0x894D8700A8CBBAD4, 0x28069E8F8F831BFD, 0x1B13C96BE5C6D, 0xC4B57DB667CDEA8F, 
-0xDE32240E9ECBD884, 0xA69365DFB7459564, 0xC9704E7D81EE4BDE, 0xB157BEB1D362860B, 
-0xA59D6D8DCCB28BF4, 0x168A9C0C4BFCA, 0xEB66967DA14E1AB2, 0x6EDEF0D242714A28, 
-0x77671CCF81036ABD, 0x2F666652DDD86F11, 0x53001850993EDA17, 0x699185D1F4A258D2, 
-0xB33C5AA033CF, 0xBE5FB545332A65D9, 0x2C9097081C7099D1, 0xA508BD033D788BBE, 
-0x3EAE1F7149F772C7, 0x76EC7D391CD296BC, 0xD72C9DB08A4C302, 0x9CF6CB0CCC12, 
-0xA5D8A1CAE35593A8, 0xA75C3A48B399A494, 0x6BC6280FFBF8EC4C, 0x3CF66C7F63AB559B, 
-0xFEDB1802F4F09C1C, 0xB10F16D9C1AA5055, 0x1E1167422DA39, 0x8B15732721ECC2CE, 
-0x4DF0E7B380F09F7F, 0xD69AE2FB5808502C, 0x97E89080C2E0A028, 0xAF778AE2EEAC576B, 
-0x268C00BF9F8CA93A, 0x6838398CE566, 
-0x3763393C39B7BCB9, 0x8A13AB776CC4384D, 0xA630578C478FAF37, 0xCF0E7117FE90792E, 
-0x9A35525AC4DAA2D1, 0x5D6F24896EB4FE80, 0x2C18C4DF8E15, 0xBD04F8216CF03027, 
-0x471A7DA573393D8, 0xEA962E0C0475165E, 0xF3190977EB5561AD, 0x556FAA6E5761397, 
-0x1F1216091C8A9E8E, 0xA4D6BF7FC89E, 0xC5131CAF08E81655, 0xF044A6FA15D902D4, 
-0x2F19C071EB2BDACC, 0xFA64614CA4472717, 0x738F575993EC09A0, 0x966E9A767F73C2D9, 
-0x1C35B2F0E4857, 0x9353B1A9CD9CFF9C, 0x7EBD59576D8A97C4, 0x3F5B9F6644FCC5FC, 
-0x83A8C7E1000E9B18, 0xCE7064916D3D87DB, 0xC8112347751089F2, 0x16831C80BAB59, 
-0xF37FA8A19BBFA0C1, 0x660AC67E46214BBA, 0xB7182140541F1337, 0x2F777B7CA861FF6, 
-0x68DD27B914B3559D, 0xB3A385BF038A7784, 0x46F144070F41, 0x4B33CB2CF7C9C32F, 
-0x5C2CB19DDB827142, 0xD65B45D54CBD0872, 0xB6CC6AF1A4A61BF5, 0x7F9499E61A104882, 
-0x5063EF7F80B9DE33, 0x51595400F5D1, 
-0xAA2382D203C22AF3, 0xAF46B6FCA83F75C5, 0x2C524D1D89374C10, 0x6D2D2F7CF56F636, 
-0x3894C73B2C9C18CB, 0x902E0DDC22AE5741, 0x206BCC4967965, 0xD52FC40CC215D901, 
-0x8D8EF94D42606ACA, 0x63A4BFA86CCEF8A9, 0x125D6D441422A8BC, 0x426833ADCB3DA6AA, 
-0x4BA756B1BFEC9D4E, 0xCD1914EE9590, 0xD69767AB5B4FB3A2, 0x3EE1EA31280273, 
-0x81FF950317C5792A, 0xB72EB583F98EF323, 0xA4FE0777914A2432, 0x755725526955EF02, 
-0x1C0499DE2B560, 0x697019583FBB5377, 0x6E6730F15E85512, 0xAE6621C9E637101D, 
-0x9889784C92D45F89, 0xCC46BC291FE6FDBF, 0x6DC330E774E143FE, 0x1369CC538947D, 
-0xD1B27B887204D904, 0xD424FCFC344A12BF, 0x399CAC53859218E4, 0xB4BB281D73D45F45, 
-0x5C2BADDDABE11716, 0x155777862F5B42EB, 0x13DB173875F92, 0x77ABD9E8E1B43DAF, 
-0x4B6043152130D934, 0xCC735E4067F77C6A, 0x4F10A61A08D976F3, 0xF481AB1C389C4C8D, 
-0xDF4817D2FE237022, 0x64AE7DF0DCAC, 
-0x85F63608A5E904B1, 0xF632C8E4F5606004, 0x50B0DDF349950B4, 0x15DCD874B92A4B73, 
-0x2F81763B3479D06F, 0x660270FFD200937F, 0x6D2DBE1E8454, 0x76B393E7A7F32F26, 
-0xEA64F565343B9838, 0x22166EC452BC79CF, 0x182374C732E62382, 0x590EF01B393AC91D, 
-0xB8A1A217EFE25D7E, 0x4779B83036D0, 0x6646C8E2610C0249, 0xF312D973756E4333, 
-0xB43F730CD0A2DC84, 0x8A38E85EFE4DFCC6, 0x6C6F00069DF843C9, 0x4FC7CDA337353755, 
-0x7B0B89B74F60, 0xC966CAFABF97F78C, 0xE127B28A4BE5D4D5, 0xC4CAA53BA4B74EC, 
-0x3A0D6CB375CF93AE, 0xC5D27FDC6C6C362A, 0xD6F8E8D6A5FFBB15, 0xD724D58F9006, 
-0xFB31A57A97045B3D, 0x97CDCDED2A1B940, 0xA3C9C971202D7BAB, 0x2BA5DC919A98A139, 
-0x3A403B4AC4608688, 0x7DC86A056EA67718, 0x110C709DF355E, 0x911188F433E7BEBB, 
-0x52394A63653DFFC0, 0xCBBE124D44190088, 0x4895969C59BF5B5D, 0x692364BDB73D3036, 
-0x5A692EB89D736408, 0x1709E4EE07D6C, 
-0x70EF3E3B9246C79F, 0x24F391823F1E8D4C, 0x8BB7DE1019D1C6E7, 0xD1E844972D67017E, 
-0x40D21714475FB552, 0x2157FBE5EF5910E9, 0x4DDE9835D24, 0xA7B4E90655FE4ED2, 
-0x2350C513EC7BF192, 0x6B1A517036BDAB2F, 0x33565392178AB194, 0x2D5957F5CBDCF097, 
-0xFB818AA871783180, 0x7132CD1390D2, 0x76D18A7C128D644E, 0x9C27FE4A7C766A87, 
-0xB63BDD3D47A34BB1, 0x81B0B6F99D55EAA7, 0xB35AA4D6898AE73D, 0x8ADA28C43CA7D6, 
-0x3C1F575DE863, 0xEE26D9E8743F244E, 0x868546F6E4BA8C86, 0x6122A2CBE0BF3D01, 
-0x5E92F3C61CA1F1C9, 0xD599926AD2C2DEC1, 0x2EA894FCE157CAD0, 0x2BA94066E5E6, 
-0x47E4D198E6136EFE, 0x86CB354E08E1FCFC, 0xB92E58640E415212, 0x15F86E4AD4BDF9B6, 
-0x2F0ED6C0B5DDD20E, 0xA5A2808D2540C218, 0x1749E1623C4BA, 0xFF2948E195A529E3, 
-0x98BBCEA70EC0234E, 0x3076470899A994F2, 0xF9F976BCFC89B5B5, 0x29667E85AC0F5EFF, 
-0xE902E9A409031F62, 0x471C5A77B0D0, 
-0x20A98BC45F7733, 0xEC0A5020192B1404, 0x7CBC42E2836A222E, 0x2AAD21FCF2A6358A, 
-0xF4B738E007E98779, 0xB69FFDF3D9178C5, 0x212B0F983E686, 0x7C792D4D512EBFEA, 
-0xAB82CEAA25FFD434, 0x8BAE46E2B3B4F2C9, 0xD1E873AABEE438A5, 0xC5A0861998F089F2, 
-0x66361B726DDCEBC9, 0xADF77199DA12, 0xFD869DF5175919D7, 0xC6A3EFE86700E154, 
-0xD8749F06B251022E, 0x8094625F6FA633F3, 0x7668E9CB5856930A, 0x372F80C27B225575, 
-0xD34B6AE98F9F, 0x73904ADF7D95A0F7, 0xF7E8288987DD242B, 0xCB84AC0F3B6A7315, 
-0x338F5718E08B25BF, 0x12A408037A4C1D09, 0x98711F1C09D17B2F, 0x1BAB1D0C34045, 
-0x239BD4555DFB16E5, 0x29CD9258C0188B2E, 0xEAF2999DFB5BC5CA, 0x2E8BC53420E8F1BD, 
-0xA21ED8840B989E29, 0x59D1DAAEC141E8BB, 0x116946BCF5D37, 0xCCFB8764065A88A8, 
-0x27AD5CB4A7AE2598, 0xD3F72B00123EC26C, 0xD5A8C6F414E4F9E1, 0x768C9F2471FBFF9E, 
-0xC797AB4B4DD670E7, 0x2171F0B63B1B3, 
-0x28124248F9F0CC87, 0x930A36C7CDF93AAC, 0x2713CB15CB9F5B65, 0x9795FCB9593ECD53, 
-0x5A81968173104312, 0xCBDF2A7787C4413B, 0x21AA55C90D506, 0x3579861386661767, 
-0x89E29943FE92C69, 0xB4C9F05715CF759B, 0x52A2DBE04D2C534, 0x1C21CC5F6BEA945B, 
-0xD8F9DCD4C410276A, 0xD978C22D6196, 0xF8857CB2A32871C2, 0xBE620709DADFDA04, 
-0x4A31A0A23B983EA4, 0x3AFC03181F8F5D20, 0x4654E6E6531626E6, 0xE0A9C610BE3214CA, 
-0x197143183CB73, 0x945704927AFDD154, 0xAB84D3361BDF0EAF, 0x6FEC284F8F4E62B, 
-0xAD167EC91382C9D, 0x5554C296649E3650, 0xEE2A89D3D177BC6A, 0x150FA38DBA3A1, 
-0x8C517948FEF25C55, 0xD82C64BD25048330, 0x4EBA322462C7C4F6, 0x1E4870A37CADCBF4, 
-0xBD7DCE4B88AC802, 0x6C42BDB46F45B479, 0x1F7ADCC2A1BF0, 0x2A2169CFD0B257F3, 
-0x7722A890D3C66E5B, 0xFB41CD7BF88D4ED7, 0x59C11FB86D507976, 0x435D6808624369FA, 
-0xDFD4FAEF4B05CED8, 0x1DE18501C6911, 
-0x9FB0085CA40CECC1, 0xF31E13AEA693D2B, 0xCF532302930C36F5, 0xA6D25D7F805B9479, 
-0xECACC3A2E98D2FE3, 0xD4965872C6B0CD01, 0xE1D659183215, 0xBDB9F02A9ACBDB25, 
-0xB414FD6EBAA1F1B4, 0xAC520ADBD3C8EB15, 0x62658A17110E056B, 0x323562582C75246C, 
-0x24B20EEDB10F775A, 0xDDD0001745EE, 0xB3001479C5C92298, 0x2E65A25223DF9F02, 
-0xF99045FCCFBE6A69, 0xA7A3B971AFEF0F4, 0x21279C533B5AAA47, 0xD3139B62B185DFB2, 
-0x1006F10EDDF51, 0x8D39F991140CED7B, 0xBBFF58E73F92E14, 0x2D94E7E89EED6ED4, 
-0x2697E136670F8DA, 0x55ADA9CDDECEC4E6, 0x879597CF7C21BC73, 0xF8215B5343E, 
-0x92E6A9E7D335D4AA, 0xAF201E5743DAA0BE, 0x8133CE2E67545053, 0x6F9CD6D110A6A85D, 
-0x67DB32ADAC09E2E8, 0x2B463C61D65D5069, 0x20920C8E0D78A, 0xA9252EB39AFC4763, 
-0xB80212D95D53CA8D, 0x17E37C3EEA8EDF7B, 0xA44D690377656D08, 0xC917902BA3DDEBF, 
-0x74C1FF092CC11A04, 0xF49768E5728D, 
-0x3F7583F381462AA1, 0xA5FCFB09E022BEDC, 0xD4C610E5E65D2927, 0xDD3F607239172677, 
-0x1EB6DD8659B306E1, 0xE093808DBB825775, 0x1BB989231F881, 0xEB7A535CFBABA823, 
-0xADDF411472F09F26, 0xCFC3E5ABC3AED66E, 0x7022B713403DA916, 0xD4EB45EC696CA7D9, 
-0xED34ABF58582B05E, 0x16421F951045A, 0x749EB1173AB78618, 0xFFD0F46EBB1AB54F, 
-0xAA5F1E02017FE393, 0xF50ACE2705F5BAB0, 0x94E378C88779F03B, 0xD6E34A4DFBCAAA7C, 
-0x32A6689DB280, 0xB9864757BDE796D2, 0x86F3C8694B13CDE, 0x50249BE45567D281, 
-0x59914EC0803A8571, 0x4C0CD6FFD9599B07, 0x5DDDBA0ACE3815FA, 0x1AE5ACABF570A, 
-0xE3E47A3C00456B2F, 0x1C0FA9B1795A885F, 0x2E97AD7FAE487CD3, 0x1405533341A39B13, 
-0x2D3E3E0694F173DC, 0x9205D498A89C9AEE, 0xFA3613095EC7, 0x164EC4313BA687A6, 
-0x9BF6EDA2B854C7CE, 0xF04E5F505604D052, 0xDAF340220C18421B, 0x7F55A79E61D2B694, 
-0x960F23265F49E75B, 0x1AA1A7F89C5E3, 
-0x79B41DA437094C3B, 0xEC41DD0CB7B24790, 0x5440EC1545AFB9DC, 0xBAE37A44935DCBE3, 
-0x5588D6C73C94C0AB, 0x4C50A3E7441D328A, 0x22F307473E48D, 0x2DF8F75CEBA59E31, 
-0x1EA3900A3AD4506C, 0xE6D0CD89D95A4A70, 0xF62AABF2F05B5AE8, 0x813F477F5F2AD45D, 
-0x939CF1B7E02E1C3E, 0x22DEA83D20A41, 0x45B2E12381E04C5F, 0xF699060362201508, 
-0x518137BC1CF442, 0xA0CD0164AE681C94, 0x6E238E8DD748C6E2, 0xE3BC6424DD11DAEA, 
-0x1A6238D2C0352, 0x23B4115BF866103B, 0x949C8C4AC5DC27DC, 0x5C027D57C217F87B, 
-0xAFE6FE261356060B, 0x899D78AC636C6F9D, 0x31166C447949FEB, 0x3BD477CCC316, 
-0xCE81B9CB9807EC8E, 0x15CE009E86E3141F, 0xD842A4099BB0CC0C, 0x97537737451C456F, 
-0x195A4431BEB27CC3, 0x11C1370FE3811344, 0x12316433333A0, 0xF77DED3BFBD3A2FE, 
-0x5ABE380200643C2, 0xA5BAE91CE62A896C, 0x9C81887EF886DEB8, 0xF496A960B6AE9F57, 
-0x355D1B4A8CA9434C, 0x17EEAEF7F3CE4, 
-0x52D06A6F0CDC9DF3, 0xCF239C4C2C86FAF9, 0x731ACEBF09F4C473, 0x24F614993E34099, 
-0x534DDAD407218662, 0x81353DA55AAE17BA, 0xF7BC52D6E694, 0xD755705E9A3CD20B, 
-0xC059B49A679FD3C3, 0x59C51EA8B2B435F3, 0x2186226B0BEBEAF7, 0xF8D150B189258872, 
-0x40E8FB943341D501, 0x8712151A60C5, 0x7C2182BB14DA3D3E, 0x8D821B9E86073081, 
-0x9C96ECF5030D6FAE, 0x235A9578EBA02AB3, 0x208ADF29C01DD2F9, 0x91E6EE09FEFC66C4, 
-0x4649A6B9722E, 0x83AF09196A1E7423, 0x5C4BBA35FB48DD64, 0x3DE359D51C8A8ED, 
-0x696450C2776CDBC8, 0x75B821C83ACA302B, 0xD7FCBBC21DA68E81, 0x16C0CA637CDF6, 
-0xB14A09FEF9E4D959, 0xEB3AF72B60700669, 0xD28B7BDD89D9B1DA, 0xED3A1EBEC352C587, 
-0x870A63D4CF310211, 0xE3250D4233E2474B, 0x1D27E031F6B4D, 0xD3855A5EC2BF2979, 
-0xC4F6556F229A3AF3, 0x82DF3795B792615F, 0x84A5F806B8943172, 0x31E0AD5F8D4AC6DA, 
-0x509AB0EAA6936E4F, 0x143A71104B627, 
-0x6669D9EDE9959C07, 0xB69426B4729D9669, 0x26F34A9AC5823890, 0xFE825990708884E6, 
-0x3510D0ED9C12D892, 0xEC4CF9D43537D3DC, 0x7FD326879DFC, 0x71F127E3ECEDBB33, 
-0x30CE5686E78E34B7, 0x22F9F3BF43EEEBF4, 0xFE01F70D7656DBC6, 0x6F667F56BD3A8A11, 
-0x1983F2AB56C9480A, 0x123CBF46C92A7, 0xD3E69A579E4AB302, 0x87A42518B96B35C5, 
-0x5AA6C364E88F7839, 0xFE3E4A8A63ECA1AB, 0x4FF3409B6666625F, 0xDDDD6A57A7B798EF, 
-0x2047888C9D5CF, 0xF3C1BA00E18E9CEB, 0xD2C306380B8F0CE0, 0x431C74E5C7658DFA, 
-0x52D5F5DACBA812D9, 0x5709B37FF60B128A, 0xB71BF659B5D47243, 0x1E3072392F36F, 
-0x1C23FC26A5207BC7, 0x8EFD2CEAD0BDC788, 0x11FB717F7B9BA0E8, 0xEAB4966EFFD2496F, 
-0x5CF6CD6DF19561F0, 0x20DD7B4FED2A4E4B, 0xB75B7CD1878A, 0x7C49CC3464E8D162, 
-0x52772D4CE760B791, 0x71430F8953D98F13, 0x4022EECE27F940F3, 0x48D93CDA62092DBB, 
-0xF9E1A0AB2E9939A4, 0x3FC0F9D6E912, 
-0xC6E0CE9481B4414C, 0x1459170AB018C487, 0x373241BDE50FF0F9, 0xC79AC8CA64B84792, 
-0x67F093175A960286, 0x70C6BE6A7D66F70F, 0x1FF7295F98A42, 0xB090C4A68BFBD607, 
-0x3B460805A6110676, 0xCC802900A89EA9E4, 0x343B7395A7B2F74, 0x2566199CDB6377CB, 
-0x18F562ADC41B251C, 0x17EB0FDE19B91, 0x21890D5A726DBA1E, 0x43ECEA4B269FA3AE, 
-0x229460F5BB56F121, 0x4B103441B63F1B93, 0xE1054644D8C327AE, 0x548E7BF4E62BFD, 
-0x3FB2BD8ABA2, 0x7366C4A86A718ABF, 0x14F411F0810483CD, 0x96477826238DEB8, 
-0x6AD6885CD02AEE70, 0xCB6E0D73C2D1935B, 0x5BED15B6698F7B7, 0x1889F4B3BE926, 
-0x9DA56CF0BC285780, 0x3CADCC8171429C99, 0xAF71DBE92DB7ED4B, 0x675F61C24E3E0D6B, 
-0xCA62BBB2ECDFD7FF, 0x82CE3304EEF474EB, 0xFA23ED4FA8F5, 0xFBBC4979435DFF4A, 
-0x4F76F40C7822D922, 0x48E279407D405BF4, 0x9AF51CE384A8D899, 0xC1243850256C8CA8, 
-0xB69107A38A0EBBF9, 0xA41378DB77F, 
-0x8FBBFA402C299349, 0xFE40D9B3774DA4F9, 0x1A28894BFF01AA60, 0xC7AE522D0965EA57, 
-0x81E6FE46D237E7B9, 0x65CBFCB843652A4, 0xED540871FA0A, 0x7770DD3F014642ED, 
-0x720A8A1A2D98B2DC, 0x8DAF6BD65007EAFE, 0xACAFEB40733F5CF2, 0x3FFAFA1569885790, 
-0x5B1FB7E98E4F7E58, 0x1880538CA69CB, 0x401F0247EEE949CB, 0xA248E9020C021420, 
-0x6B4028C7F2B0DBCD, 0x5D4BDECD085CEBF3, 0xC92EE53C55DC5241, 0x8C0E8386DF06F34, 
-0x193EA6381611F, 0xA72DAD79BE848D19, 0x149D45CC5660CE23, 0x339E9455E76BB291, 
-0x794BE4BC5324D975, 0xF681125D975B485A, 0xCD63C3F95D28CF05, 0x1F1B271AE4FE7, 
-0x4A63FA2914DBD44A, 0xA5AB378AF1AFE9BD, 0x7F69F6CC757FEE5C, 0x70509FDCFD3E155C, 
-0x3F89F47540B63DB0, 0xFE0EF5C97E4DC962, 0x1A7964A59A472, 0x536C42543E3FCE1E, 
-0x3F80B0A7B17ED7E3, 0x1C1E9F8F54568C55, 0x48F24896200C5A1D, 0xF91DAF0BF5E9EA1A, 
-0x91F21EA70E5CD3BE, 0xCC064ECDEF07, 
-0x2761A3C527A983BD, 0x4969848A87DBCC30, 0x35CCAD9718998717, 0x8BB61B788D37AF56, 
-0xE4734163FB1CDF55, 0xF4826D175971BCC4, 0xAD15ABC06346, 0x28BE3D926520C660, 
-0x30E89364B461B697, 0xA51B89352A123F45, 0x6DF2D63EE11E9F61, 0xD87A4FBB883521F2, 
-0xD92CC8BACC0EE6CC, 0x28E0AFC9BA70, 0xC05CF53BDE1A3821, 0xDB6A000D884145D6, 
-0xCCEC054D29B98A16, 0x90D8F382E04F3F90, 0x5AE261E1F2E872AF, 0x5EB7289657CB752E, 
-0x158865EA81D19, 0xC303E77129C4F193, 0x7DE4C21ED307FBAA, 0xDBE986ACD12BD98D, 
-0x52F33871F70B9E44, 0xEA54A77979CFA437, 0x51533257BB0C08BD, 0x510AB2191A59, 
-0xA24242257400CDB8, 0xC37DC6D3AD3DE897, 0xD159449E5862CAFB, 0xDC007C97CE951BCF, 
-0x4992909F79E74BA1, 0x38F28CF570F53976, 0x239609C64EF0, 0xDE9400815A47BA99, 
-0x9395969FA6BB5260, 0x1CD251C1417063F1, 0x8BD1A403431BE46B, 0xA6602897C068A8AB, 
-0x2B81DB11999033EE, 0x16FC2AE2CA00F, 
-0x872939526423125C, 0xCF2639CDF015FB4, 0xCA4D08D90782B2F3, 0xCF6810D3FA08AE65, 
-0x764AC32951EB3A65, 0xDBDC76B64794853C, 0x1E0E8C2CF3566, 0x425C256EEDD00206, 
-0x12B7D3543C5E14D9, 0xDA94D4DC67B0379B, 0x80771BAB08C67B77, 0x697115FC4F6AEF68, 
-0xE48DBC3D11E407D5, 0xC739379DC2D, 0x751D79F2063E4855, 0x938A92E731E3BFB, 
-0xA8DE22DF46A23050, 0x231006F05DD5AD51, 0xE11D78FFE002DC85, 0xCB6E932FA0D6F675, 
-0x13DA8D7C5AEEA, 0xB18C77D6228C81D, 0xAA12DD1550F575E5, 0x575898C82459C3BB, 
-0xE66D0182FA7E8667, 0x2F2B94B8A782C5C5, 0xF5A294C053251D57, 0x1D0D65F5D6B5E, 
-0x9938F5881D133145, 0x8771BAE8312D9397, 0xF127E3C49C8B6322, 0x315DFC3190A07B88, 
-0xB40C4316F21839B5, 0x6DDBBD46E8FA13FA, 0x20AACFB071B17, 0x9EB8A8C1378997DB, 
-0x5A77612ABC0EA0FB, 0xFC9ED83F0132A94C, 0x4641F98309467A0, 0x8816E54AA629514, 
-0xA462B39994197AAE, 0x134886AB3C74C, 
-0xAA219A9A06888BBC, 0xC2F0BD84D2BFC00B, 0xA445EADC5CF8D846, 0x41309879A40F466C, 
-0x445DB80D58A8B771, 0xDA889A121F803ACB, 0x1089BF141B8CC, 0x98005350FEA28F8, 
-0x9BCD86A9348CA99B, 0x54337B3F61F17280, 0xA5A910915924C33, 0xC6196ED99363BC12, 
-0xB8F24D344681ED8A, 0xD9BC20C4C40A, 0xE663262CC51E963C, 0x430F9E0E2C8BF5C, 
-0x72D2C615F59EB1FC, 0x6BB3036C9E286FA9, 0xC9CF69D7E75363ED, 0x15C80D2F9510C854, 
-0x207D539E4909D, 0xAA1B6E3BBBBEC5EC, 0xFE9CA4E6CEE7CC28, 0x352AC3CDAF6E492D, 
-0x3ED0BF0CAADB1EC4, 0x448D3BC237EECAF5, 0x47776A6E1126DEA0, 0x20D05E9FCC55C, 
-0x23DB7335D0BE66BA, 0x49F3FDECB09EC314, 0x2B662268B178D3F6, 0x344F128D972F15BE, 
-0xC3F3CCFC8D73E0B5, 0xCBBA733C149B2038, 0x26B0647D10EA, 0xFC29AB05E65A2CF, 
-0x5B88B8305E110F25, 0x86819294E942ED3C, 0x4513B2C3D69299A5, 0x1269BA411EAEE24D, 
-0xF2748A6F08722312, 0xD84A2E5B5A0A, 
-0x289FFBF3C88C2A, 0x9A0C19187B7D0084, 0x1FEF60BF3EA13895, 0x4D921671EF51A51C, 
-0x913B66A2B26D46F1, 0xE9B9E6574850FBFE, 0xFFB65B6E802F, 0x59CEC6AA41AA095A, 
-0x7A44E9459253541F, 0xDE61444C15733D66, 0x336216A9656D2E4E, 0x97521C35EB1C0A57, 
-0x8B3085A4C2EB0E8, 0x1A081C85314B7, 0xEEE4E793D11C73DA, 0xA83829407196D12F, 
-0x66FFD109B6A9021E, 0x4B15EE53B0F990FD, 0x28BD888CB61BEC60, 0x2B023046E8CA4FB8, 
-0x1F2E3652C0F0B, 0xDBFEF3C1A9C0536D, 0x7DC89F5D99E75EB2, 0xB727771DA3C5C8C7, 
-0xE90EBED484266231, 0xB2AD06C7E1833A31, 0x8C359AA868194806, 0x10BFEB7F82408, 
-0x8437D60EDF4CBBCD, 0xB65EE6EECFCEEAB8, 0x57C946A2B6F54831, 0x8C6FB113577B9B7B, 
-0x86FC3B19F967A855, 0x1DBE985264DDDE48, 0xDFBAEB8DAB61, 0x23759D32C8E8AA00, 
-0x4D94BF3E24733487, 0x7C47A52F5E923758, 0x428176DC8B3E56D7, 0xB50AFE3AC641CD5C, 
-0xEC7B36D7412EF53C, 0x1EB6A8A973B17, 
-0x38E65535F08F5A81, 0xF717F4EF93306728, 0xF5BF6232AAEA052D, 0x22DB00EA9E7861F0, 
-0xC2750D710B9839E, 0x3AB66C0D0AE3C699, 0x561F67BB8357, 0x4F71157227E9B563, 
-0x3C86295F73822CF0, 0x1C78F11FA5C0B124, 0x6C5A7D3BAE39EE1A, 0xEE1F82FCD1556068, 
-0x5BA273515A7FB41D, 0x126AB173C2AA6, 0xD95888CE8BED1E27, 0x11DF92AE9C120C27, 
-0x6BFE3A368A01141F, 0xF2D4B7FC7B75FFDA, 0x6491F8A79F9F79F7, 0x2A5AE0C3BF492576, 
-0x13D96BD19E2E7, 0xDC754BC53BC4873E, 0x532132F2A6DC3BFE, 0xDF38FAFC12EB150E, 
-0x27EA5456FC5E0FCE, 0xD8284841BBFF819E, 0xAF34BFE1249FE2E9, 0xC5ECF7618182, 
-0x89E4BD12E892492A, 0x4170DF1429714BD0, 0x8753AF416FF63FCE, 0x25662BE57B28D0FB, 
-0x30E2771F4A2F8406, 0x90BC5DCD44609E72, 0xE27FDFB10C66, 0x46EAAEA80FDF1701, 
-0xFDEF184AA7A5A142, 0xA020266236603511, 0xC775B5EBDDCDDD81, 0xA12773A9C9136C54, 
-0x6229EEF4753CA7A1, 0x1644F3D25996B, 
-0xDFF67C3CE7B4A19D, 0x176AE837541A82DB, 0xE68E29F77E5A178D, 0xCB61942BF27DBCFD, 
-0x4F4EC5D8E087435F, 0x42CDF8A005AAE61E, 0x226408EC04748, 0x6F424529C522DF42, 
-0x93107887E92D282, 0xD332F24DD5C05DC1, 0x15598F9EA18C8EBF, 0xAB9206DAB7E21713, 
-0xF72705255410CC, 0xCACCE7624409, 0x5DF0C8ABA1514D5B, 0x1117D87D1DF06109, 
-0xF536DE9522A944DB, 0xB67F2C48DA4C2FAC, 0x41A2F244E0A6C78, 0x12C0AAF7EAE98272, 
-0x640A1C60DD59, 0xDB6D81D6B481DE6C, 0x80371B5B96EC855F, 0x3F326799F8A1DC8A, 
-0xA2D3041D0B61684F, 0x9BCF894A5FEFCEE, 0x5F1D21CBDC9FA5EB, 0x16CDBA13D9914, 
-0x4CAB6CE1DE509963, 0xF4D0A309434373D8, 0x74333F6EF5365E97, 0x8006F59D6813ED11, 
-0xC62C7573F0DD1B24, 0xB95410DD9FE85C49, 0x1DB997480AC8A, 0x716A332EE9BB624A, 
-0xEE68916A90FE017, 0xD78094794A2231D1, 0xA61108741ACBE9F3, 0x8E3B00C0B1B46E98, 
-0x28C1F112A5364E63, 0x7D8F16A9C888, 
-0x1B7BD2E7280EBD6B, 0x629C0A12625E3131, 0x4E0126A4DF8340B0, 0x3F00345DE018AD1E, 
-0x84C06FA675D0D386, 0x8838AA6E1781CC12, 0x2F5BC08E830C, 0x2DF2A926EAA13E7, 
-0xD075D458EF1FB956, 0x2B3DFF76B5D74570, 0xCDC967503391161C, 0xFD20482587A8A968, 
-0x10C46B7A3502F168, 0x7ABA1F63B371, 0x1A1910DCBD513C7A, 0x4BF52754A175D048, 
-0xC25AFC29BA7F8CCD, 0x268381FC7703A397, 0x192DBC2819D09DA5, 0x3588AD5BCC81EA37, 
-0x4E4E8FC2ACF2, 0x249FEBB4C6DE45A7, 0x4CDEA07DDA69E347, 0xF1B03DC0729856B1, 
-0x761534999DA16708, 0x4E7CD48EFE46EAC, 0x3EF99C44C6066EC9, 0xD1087EA9D892, 
-0x3B545D500E64FA63, 0x16E053D573F84252, 0x7D0A50A3D7BF7DBB, 0x1E2CB23A5633E53A, 
-0xE49A1ED620682E82, 0x14AF53081ADD6488, 0x7CAB3F2FFCF7, 0xDC1AD6558F61ABCD, 
-0x4A3D3C0A9C1E2642, 0x420EC2D24470F5F, 0xA0A399702B8CABBD, 0x7FB75B34D1B9C858, 
-0xB3EAF34A37610BF1, 0x18702D4543726, 
-0xD7806EBA803D7EBF, 0xFF61A3B112B17580, 0x9C6F092C12F35C88, 0x21EC0E58F2D3799B, 
-0x4A9736AA7CE97FFB, 0xB0ED5B9A1183D92B, 0x1FE50B70AEE32, 0xA3E740B1856D927D, 
-0x4BD9E7CE7C1DE7BD, 0x942A464D16647129, 0x7ADDA87B14245B47, 0x22391D80246DFCB2, 
-0x1C61B26B70F722FE, 0x1D4556689B589, 0x18D442599247AE5C, 0x1C2837914D3F2C17, 
-0x15BC0C10639A1B80, 0x202F51F00837C91E, 0x37C6BD343280060B, 0xC7DBA04DADDAD775, 
-0x20BBB0EBD4C17, 0xBA5C7E01B27A11F5, 0x89EC6EC2EA1456D8, 0x58908FCB1E2FFD53, 
-0x3F79DC3E1F8B24AB, 0xF9E9E3829ADA507D, 0x369AD4026BED0634, 0x22B1CC8CDEB2, 
-0x216E7DD00FE0AE8C, 0x9977314F93180873, 0x7913CED29175B539, 0x196D640CA34FE79B, 
-0xE63C02302EA238B6, 0x339FAF6FA7E30AE0, 0x110938B53F465, 0xCBA3AC195E1EAD2F, 
-0x4191E99061B60F09, 0x5F1D344135E993CE, 0x5CE9EDAB31ABDEF0, 0xAE3CEB3A6D39BADE, 
-0xA36707C24852989E, 0x1C07964B01F6C, 
-0x94D63EA742088D30, 0xF53A26717A1B8E9B, 0x365E027D715E2283, 0x8EB225A4384803BE, 
-0x33CBAD1DBF0457A5, 0xDC4C231A2C65DF5, 0x17AF1083ECA42, 0x1A8EE08748320B2C, 
-0xC2649EEF66E9A9C6, 0xDFF30BCCABFAAA87, 0xC485D9DE730C6DB1, 0xE2768DD349B36772, 
-0xCDACC659CE4B3E2C, 0x197CBB96C5ABD, 0xF6F1AC5A77466E1E, 0xCA6CA46BA94FAB, 
-0x1FE3414D15249B85, 0xE7A0EAF0BCB89830, 0x1AC6AE138B15B337, 0x274DA36AC062CDF3, 
-0x22B9D3EDC167E, 0x25AE848004851A5D, 0x2921F0E9A9019E2F, 0xAC8994D0AAEF607F, 
-0x4C313A235778ABFD, 0x3CAE2441E16DD57C, 0x777A95A3625D9505, 0x59756660CE93, 
-0xDB79383D5AC0396, 0xEE1AB3686A2319D, 0x41F4D17B1B8CDFCA, 0x4557E490AD78F041, 
-0xCBAAD4A18E232D99, 0x4C99275493A3D961, 0x346417CF6FC9, 0x42AABDD8E29D7216, 
-0x373303BFEF76C90C, 0x49B1EC787DB7F957, 0xE03E11D88A222EE8, 0xF30FE08D4BB8AB3A, 
-0x5442C27AE443F9FA, 0x4D6A68C7AC04, 
-0x59E64DE13335B4A7, 0xE3C9289F8A45E2C5, 0xDD9DB69D31EA318B, 0x34C85C4C125BCC52, 
-0x1CBAEB3A030DB8EB, 0x457EF38500E833A, 0x216B61190114A, 0x8F785ABDC50EA12F, 
-0xD4669C21B7D9B1F0, 0x5D37D3FEF45CC2B8, 0xF223820F707E7EEB, 0x21012AB51778EB07, 
-0xF4F55F17C8137F4D, 0xB9215CB50D18, 0xFA21E9DFABEA0CDB, 0x4B85DB233B6ED45C, 
-0x10744AE23E0EA544, 0xEAEEE318D6E41853, 0x2A2ACD8287174B73, 0xC3E9EE1102776B0B, 
-0x124E92FDBE5C, 0x51D4E36781905FEE, 0xD3A88FAB635CA0B1, 0x90A1E77B6D0DD01B, 
-0xDBDCBC5B60138E13, 0xF24C4692415F252B, 0xC8C7ED3180A80B6D, 0xB1EA2026D7E4, 
-0xBA9B6BA8DACD46C2, 0x41A1A1FBA85BE96E, 0xD26697FBC25F278F, 0x67923176A7BBEFCC, 
-0x6BE613B0F4D6E373, 0xE0348F4F75F2085, 0x189700367FFB0, 0x7C232C3A83A0AC84, 
-0xB193642304772D1D, 0xA230FF80964F50D5, 0x8C34D56E8BA82F71, 0xD62699620414DD4A, 
-0x4A09ADDCB35D48B5, 0x60EDE5754776, 
-0x8A4D075D2AA281E3, 0xF502079CD04E063D, 0xBE05AD9B000C0F91, 0xEFF61BA693256C8, 
-0x4D81ED688500AB60, 0x8B7757A4724BE530, 0xC11C48764E09, 0x7DF7A3202E7E648, 
-0x3A6FA85B933072A4, 0xA23C98FEFA19844, 0x7DFBE15CD4C05017, 0x917E66A5AA47D83A, 
-0x1C4F07E9F5AA4C2B, 0x1E64D31BE4A3B, 0x4DDD529DC406C929, 0x2C8F828CBEBA6CD8, 
-0x3E2A96EDA72569E3, 0xD2B6E7F1062A64A8, 0x4627747DA40B2996, 0x39811ADD781971DA, 
-0x699D8734B373, 0xD0BC6C64DFA7DB5F, 0x7F1F0B768518AAA, 0xD49C1F66308BA34B, 
-0xD983A3D33DF8C04A, 0x6367124BDC111446, 0x325F7CEDBFA28B5D, 0x2CA5DF00A871, 
-0xD53886E3C6CC60CC, 0xC469872C779CAB70, 0x9B330C23A231E01A, 0x34143A30A9847904, 
-0x602346E355C34E0E, 0xBECE4E9365A30690, 0xA5274619BD6C, 0x439837EA2C10B93D, 
-0x342060EDB5D6FF96, 0xAD86F0BD617B9DAE, 0xF62564CA70CC5349, 0xC1967EE0E35B541C, 
-0x73212DE74E8BECD9, 0x4D1FACE8806, 
-0x856E17246E885014, 0xC950F47DDBBFBB7C, 0xCEC291EAF34BF38, 0xEDD19A8C5FD000BC, 
-0xBFC4062ABE9AF6B8, 0x3011ACC1CB679F08, 0x1A87EC9AC2F95, 0x25C8BC6F48816839, 
-0xB0B4A7CB45819957, 0x85B17D3EE6A8E59E, 0x8BCDF50B3ACEB60C, 0x25456895EA3144A3, 
-0xFDD195CC3E6A407D, 0xA4EBDAB18ABB, 0x34778158F98459F5, 0x88266D15716099B1, 
-0x8E1B19E91C2FDA13, 0xD31C92813DD53E03, 0x62251B6F09633768, 0xD11EF22A210E493, 
-0x1F5277526DBB4, 0xAE8D6EF791C8B84B, 0x4A9D128D67FD0E90, 0xE989805D1B7DDC2F, 
-0xD30A3C4574C90F29, 0xD5D659F0B758CF92, 0xC57EC47DAABA33B7, 0xFFEE1F7D2605, 
-0x651D2B50514051AE, 0x67B6DA2F58382730, 0xF29CE460F7E33A30, 0x393B1904F8C1AF8C, 
-0xEF72256B15508D97, 0xA67475BE1B517188, 0x196D859CAAF02, 0x7C63E77C964A56B3, 
-0x84D37044D65BC722, 0x917183037CB272C6, 0xD6D8291612E4F334, 0x682825DFC71E150, 
-0x62EBE91F59544235, 0x21FDE41D4D209, 
-0x8368FCFCA9681028, 0x52677464C80E2354, 0x281A7E9CE661D0A5, 0xF50FC20E65E8C044, 
-0xF45FB144A7CF77AA, 0x4CDD56F6C0675C3, 0x12BDAA305EF10, 0xA3ECDD2C50FFA39A, 
-0xDDFA0C574E30DB38, 0x6FA6AFDD2B4ACAA4, 0x5BBAA35A4190AB4F, 0xA9A5E09EC88B7448, 
-0x74E8D4C68877929A, 0x10871E0ED83D8, 0x55E1696C2DA8EB9B, 0x4D90865D52E4F7B4, 
-0xF250C3E547A7CFF4, 0xFA3CC94799F23B40, 0xFBCBC56EFE3B798C, 0xB17FCDF8FA166AE9, 
-0x1B5F08D3AFA19, 0xA80AFBA9D96DAF1F, 0x63F171D6F1BF2AF9, 0x97F15F47C71A7240, 
-0x2EC301BD9A3D1EF5, 0x7A0ACC56E4A1169B, 0xA1F288480BA99164, 0xC096D89AA1FE, 
-0x391130D02782896F, 0xF5E9C2A375D73134, 0xC0B394E1A6E9250F, 0xF08DD0766762D6C2, 
-0x9DA5CF3E676420EC, 0x62272DDACCA4AD4D, 0x165EC125589D7, 0xD7BE42722B469ED9, 
-0x6A775E30AEED627C, 0x26AFCC89AFCA6E23, 0xA3BD7131A776E148, 0x956425D9107EDDC5, 
-0x66C7E0D52B82A9B, 0x58325E47E1D4, 
-0x9239520E039F5D03, 0x92AEBE8A6F8557BE, 0x5406DC66C87ECB64, 0x50B7639129F5F7F1, 
-0xC5285AD7ED80CF95, 0x985FD10ED4EE67D6, 0x7C30D705AC71, 0x8464F5EC5966EFC2, 
-0xDAB2F53E7C55675D, 0x42F0BD3E616F9FAD, 0x8AFFA62649CABED, 0xB68BF472B4AADD6E, 
-0x8AE27FD49F348C43, 0x18FFD1D4C2BA5, 0xE93794A203444DE5, 0x6AEB67F58AAD3DD6, 
-0x36AA9BD2E2AA5D5A, 0x7800DE206253C65D, 0x28E0C19EDB51B037, 0x9D1A2DFBB2789605, 
-0x1F21DF684CBF, 0x85426276540FDC70, 0x20F280B18F6256C0, 0x3FA9F082329C0465, 
-0x19FA2B7C294FD3C2, 0x1B5E031D26EAF208, 0x248BF1385AE8068C, 0x145051FEF6EB4, 
-0x3516B361E8599270, 0x924B7AEB6EF9F130, 0x601DD6B17B12268E, 0x8690EA881F300F01, 
-0x168F60E27C51BF2, 0x9945D82389A751A4, 0x2FE09FA749D, 0x2305730213640A1A, 
-0x3F54AD798C3ABDB9, 0x9736EB3C33F8255B, 0x9FEA5E068586AAE2, 0x242DF0B9D1F37221, 
-0x78E69A862AFD629D, 0x1ADC58A8C1071, 
-0x23539806CC3F9187, 0xB24704238ED2795E, 0x5A96C26F22D6D66F, 0x1CFCD8922600797, 
-0x8AD321364C22C38B, 0x4BF3C5856AD5D5A6, 0x19A967B0361B7, 0x36D22BA4C742DD4D, 
-0x5E5BE2999ADEF0D0, 0xC884DD732764307F, 0x73E7B35DDA2BD8A2, 0xB73002DE32C7C5B5, 
-0x99C6DC0E49328EE4, 0x164822537742, 0x6E5E8A3F93AA9B49, 0x83CAD65F1F46B253, 
-0x91DA384692717BCC, 0xDBCB006A7079F4E0, 0xAFA3690325C24783, 0xD4126B4BF639C221, 
-0x1C5D18751B30D, 0x7802EFC07303A98C, 0x422D538C2D236E03, 0xC5878A7539B24304, 
-0x148FC4449D1C72E6, 0xD173F4A440CB1FED, 0x94EC67D5906C52A3, 0x21E59E13F21AC, 
-0x97DAE280760CD32, 0x4CEFA710C87105DF, 0x109ADFFF06CAD233, 0xB173C46C2E07E67B, 
-0xDC4083653A6D7B72, 0x891AC377239E42E9, 0x193046DFA044D, 0x343A08A509A3DA60, 
-0x75FEA52A4EBD7874, 0x9AB01095A608C1C1, 0x16DE864F072601F7, 0x5FDC3D0603FE9BEA, 
-0xE48B2A9EF8F4656C, 0xB8828AEC0410, 
-0x5A36426682402891, 0x2250EC7677763075, 0xCDE135D6A1ABF7D8, 0x5BDA5C6827AD885B, 
-0x91B859311DB47B0D, 0xF31D9BD2B2CF3C6A, 0x13FFD0D1065A3, 0x62F43EAFE01AE309, 
-0x838DD977D995966, 0x26FDD35ADCEBF92C, 0x78C5D50356723ADB, 0x5D8091372C3DFD72, 
-0xC56BD85D09549CC4, 0x1A684BDF92EF0, 0x82FC7A208F6B45F6, 0x8A0AA55537AEBE6A, 
-0xD9653168EE9D8BC6, 0x1120599541F5B5D4, 0x23F6B766EFBF5856, 0xD49B6F39765F0B1D, 
-0x16B92278CC407, 0xE2971B961EDA1795, 0xEEE747499EF210DD, 0x6B36D6BACAEC7337, 
-0x5313456DA72AC818, 0xF8228D984286EE5F, 0x875CE2C1A4DC8202, 0x1946556748832, 
-0xCAB1F8E3EDB96CA1, 0x70C02190675DA922, 0xC32732C40B036994, 0x565835F4311A82F9, 
-0xEF6309E9DE2A6155, 0xEE524F19D704BC1E, 0x3A1E55EE08FA, 0x3E7AA3CC2A58E438, 
-0x4ACC2966198978FA, 0x948DC67276056D9C, 0xB61BD93D4E69A1B3, 0x7613D464517E1DC3, 
-0x4F11FA8F8EE97955, 0x280FE6D30D01, 
-0xCA053AB56B4E0B2, 0xDB1EDF708036CF05, 0x211FF71D966A18F7, 0xC02AAB0EE8E0E5E2, 
-0xF5EC4A8BC6A2379F, 0x8E1B18F5BC14406B, 0x6B7389930FC4, 0xBBAA9B0279B626D0, 
-0xA914D20DAD377DA8, 0x94F3FCDEA6D30EDD, 0x17869060548F704, 0xB508B4B8CC12F101, 
-0x472D7C8107231B05, 0x1BE4D38349BFE, 0x85765798263797A2, 0x9FE987E328A68CBE, 
-0x988B352D0FDA025B, 0xEF4D8E1E8DC58B3E, 0xC6AD9DDB2356777E, 0xE7E9D6684375A04, 
-0x22B369B6CE6FA, 0xF9ED5BBCBA02A5C2, 0xA45D28D089B3A2FA, 0xC849C8E40A778C19, 
-0x4299D6E37DA32EC6, 0xA56768CD0B80613F, 0x5E51DF5A70159DC0, 0xE2184F1E1070, 
-0x86E429A3D31F89BC, 0x6BC9548DD05BFDD0, 0x3E33C4645B5E97E, 0x316F8C91EA1A9773, 
-0x4964EE5D19286B16, 0x769AFFBDF4387104, 0x40209D163E4D, 0xED81325E5331F052, 
-0x76046F8839FB21CC, 0x63BBE61A58E42CD2, 0x8A7469DDA9959AF0, 0x6BBC1DA476BF2693, 
-0x517205CC593DE6D6, 0x29F35F787390, 
-0x5DCFB032FD49911C, 0x9C05D81B01EFB21F, 0xF8FB2D34D347ED52, 0x4606791CF96F6A86, 
-0x3145C1964FBBD99B, 0x446013C7F1C1044F, 0x15EBD9AB5117C, 0x79751EBFEE0B20C9, 
-0x1D097D8647E270FF, 0x90FA155E83911F40, 0xF53ED948F858840E, 0xD5658C030D07A5F, 
-0xBA25F4B3409FBFCE, 0x5BB4B6FD3403, 0xB2951B9FD03B3282, 0x726C46312316808C, 
-0xE32480D8D251BE77, 0x9CF97B7937FB406F, 0x8E7F062CA86B4D96, 0x2B895FD2F2BDF581, 
-0x1B67AE813FF9C, 0xC1C464CB060EEBB1, 0xC3E4C2A14AFA9722, 0x767C13A8BF866241, 
-0xBB462E990041FB98, 0xFD880A89C9A0F7AB, 0xF5CFCD984629515D, 0x89D2515D8770, 
-0x80818F5E94BFB95A, 0xAE2C678DB1A35E59, 0xDED19F766E848324, 0xE4B958769BD51CDF, 
-0xAF85FD701E029248, 0xE42C99036DBFA18F, 0xC9CA68C9B6C8, 0x6B2E20CBCBBC9308, 
-0x6283932F26AC0AC9, 0xE1A74D286C23DD74, 0x46E4F4D981FB8E98, 0x9A50A1476FD698A1, 
-0xC637BCD5032DF467, 0xB62064BEFC15, 
-0x3D6DE58E1B29C6DC, 0xC14512DCB68AA4B3, 0x4CA07672C6456DAE, 0x4A0E27D70ABEA6, 
-0x6D82915ED0017AA, 0x6A760897E15ECE10, 0x19552716D81A2, 0xFDC7F90F2B8B4843, 
-0xC1976388F7A495BE, 0x15F99016F3ECA30D, 0x8FA7BAE00B095627, 0x3BE501CD241DCD5A, 
-0x4220081E0250ACC4, 0xE9C9DA727837, 0x20AE68C2BD36AF8A, 0xB6EEEAC958DB6DF2, 
-0x5BF3D94C9DF2F01, 0x8659E19ED9713B53, 0xD9CC530629A3D05D, 0x4D91CEF28C06920, 
-0x2638BBE42C4B, 0x36AB81A830CD0CB8, 0x613CBA6B03134A02, 0x67504987AD59584C, 
-0x805ACB49BBE5E674, 0x60656AED017ADB83, 0x965471E107AD5676, 0xE7D0520F077E, 
-0x1746E364F22E87AB, 0xEC895655AB7E6F33, 0x2E673CE1198873F6, 0xEBA7C9E632B853EF, 
-0x2AFD2465AACB386B, 0x25262E1465A604BD, 0x1331A7EC21394, 0xD89219E20A2B71EC, 
-0x44D77E528D919FE6, 0xCC55B1A8C3048C1B, 0x9D49AFC8DC093ED2, 0x3167D3FE5875C2E9, 
-0xFB6F73FB2DE658F5, 0x1647004B0EC37, 
-0x4ADF101C6C3A0F78, 0xEB919ABA58FDD709, 0xBC550A539871153C, 0xFEA51B9B6E75B3EF, 
-0xB7140D27FEDBD669, 0x194C150FBB6530B, 0x1337374948891, 0xF343FB797001E6AC, 
-0xBF42C1AD2D4F50CF, 0x385FD7B63F95CDAC, 0x556CD7D51C8E7AAA, 0x1762C6F700371BFF, 
-0xAADD5C6DB93F8A1B, 0x1A270D807158B, 0x8F6E6A551696B3E4, 0x60BAABD4742B3609, 
-0xAB563EC672762557, 0x34BC93287A0B0FD, 0x8DED227A0601E230, 0x4D22577FEA720DD9, 
-0x167241C33A775, 0x51755AD193D39FD5, 0x21A56165EBBDB012, 0x443FE4E06C48B2AA, 
-0x6A95C46906356A16, 0xA089B2596E3D879C, 0xFCBF0C52BA9CDF56, 0x2B1C63847F55, 
-0x986791388B2D803C, 0x489F9BC56D197A83, 0xE225EB1B90B8856A, 0xC07B87CE90D17A0F, 
-0x22D009EDE830E4DC, 0xA23F57C16E4FFD2D, 0xBDA39E607A01, 0xC556AC2CDB55CE3, 
-0x509C424AEAC50F4B, 0xD8BAC529C86DA7BF, 0xBD2A5D3D9AB98A10, 0x8C3E8D1EB23B25C2, 
-0xA6D425DAF53B4B0B, 0x117EE8BAF860, 
-0x61C048D0782A5C11, 0xBC076E1B0803F86A, 0x97FD22A47EAA6A5A, 0xF0C8DD2952BB598D, 
-0x29D5DEE9A52F3F4B, 0xE2A60B5F8DB6D1BB, 0x22C946AB3D188, 0x4ADFD8AE9D5CF1E9, 
-0x49C94AC6260F0F67, 0xB1F822960015166F, 0xE6BD1C806D425B6E, 0x1BE3F67976A954A1, 
-0xDB99F94A340D0DC6, 0x1A5C3A29A01BB, 0x528B81BB03DF95B5, 0xE099CB9B2DB45FAE, 
-0x7E4733DD976D5DD4, 0x57690E11B096EB25, 0x4CE23F9231F86C81, 0x9CDB6726CCE540CD, 
-0xEEBA054D63D3, 0x74620420D03D7BBC, 0x8CEEB35DC3956CD3, 0xF1429C776048E76E, 
-0x89E53F07511A1DED, 0xDAD538EC833C2F37, 0x2B00B7941ACF26EF, 0x1FF3F4FDCC28E, 
-0x686C407846A15653, 0x3B19C90B3982306B, 0xF891093FE02486CA, 0xF8005F82FD57D5F5, 
-0xBBC97F7518909B86, 0xE9B74A91575852D0, 0x13127B010996E, 0xE0D045D7A56558D9, 
-0x8FB79ABBDAE3BAAB, 0xFEE2925FDF51EB6A, 0x82556F251FD948B2, 0x64F33A96B73D60FE, 
-0xA1748B13E237D097, 0x20E1F5ED00944, 
-0x54963CA1C87D00DF, 0x8DBDFA7EE181A0BE, 0xD013073FBD893CC0, 0x1D40ADD6D39FB259, 
-0xDB17CAF608F7F61B, 0xABE66AEFF1CBE7AB, 0x18AE54CA47A84, 0x5643BE2FB7AA3AEF, 
-0x7385F8CB04506729, 0x1D6D70A6C81A789D, 0xEE47682AE036F897, 0xBD15F59E7B0C5BF0, 
-0xD75F610AC0488505, 0xBAB184AB574E, 0x24C381DEBD8C2630, 0x6B7E7AA849787B58, 
-0xFF5B86C554980252, 0x44F392D3B964A6BA, 0xC29079FB349861F8, 0x21D6D12C58DFE2B8, 
-0x16AB709AB5FC6, 0xE8D68BE1FF4CA0D9, 0x6C99644DB69E03F5, 0xC02B6A8092CBC2D2, 
-0x19839DE0D7203AC7, 0x47463EFB3D433F12, 0xD7F69E3D5AA8167A, 0x93A23C4BF596, 
-0xBF35EC887531830B, 0x6084D9399CAAEA4F, 0x1E359003A710287D, 0xC382AA854E7C2119, 
-0x262A9CB7E42D1DDE, 0xECC03BA7DDFB99F4, 0x7891CEA027EA, 0xE691670CEE253F98, 
-0xC8C7E2190E4FB3C0, 0x193C772592674869, 0x75A63313572497E2, 0x9E4B76B209C15D1E, 
-0xAF86678BF304A564, 0x1842846702D00, 
-0x5A554B4E8840B9AF, 0xC2162CB8564B95A7, 0x660D04FB8C6D9637, 0x3AC4F1BEF5461FE8, 
-0xC77C876C7F830FAC, 0xC2E7D20BB71014F6, 0x1895385E3BCF9, 0x44BAF4BB0B6A5A, 
-0x79EE254E9B254A64, 0x2D775AD5954A17F4, 0xB417989334DEAA33, 0x810CC9D7C8195C4D, 
-0x7CC9AEDB23B5C8BC, 0xCB64497575DC, 0xB78F7912AD22C7B0, 0xB1B5C004DAEB9113, 
-0x78681F3D3DBCF42D, 0xD5B851E8C930F49B, 0xB242B29E8FA04F45, 0xEFE544FE4A9DEDFA, 
-0x1D74C1475BE7A, 0xC34603A9F7421143, 0xC01FE788F1E5CF7A, 0xADCA1ECE161BCE2C, 
-0x18E321F47893C76, 0x3AD2FA9C6A45BF54, 0x7B91076D5B615A30, 0x19722966B93FE, 
-0x5445CB997DE1240D, 0xE4258CFADFC8801A, 0x54A9159BDC551C28, 0xA863D62E4D950705, 
-0xEDC4298D1B14EF2C, 0x918CE46C74CA5CC3, 0x4DF10492FB64, 0xE87998CC9880A06, 
-0x71D7D14B03FDCFD4, 0xEEC4EB37F0E73D15, 0x93B9498D8D826AA0, 0x9174EB60EEF75EE3, 
-0x848B9BDB29E5B3A4, 0x471F450FFE6E, 
-0x5550AA78F2F80C32, 0x6C1D576656C7193C, 0xBDD38BC5C803D8A, 0xE48F2C2B7A4FA9AD, 
-0x4A3E01F01051F8E6, 0xD390120910155BB7, 0x934B63029F9E, 0x5AFD82C3DDFDE7C3, 
-0x255B05E55CEF8EE2, 0x823E97F36BABEC0B, 0xD01F3D66E4F76896, 0x2EDDFEA550FA73A4, 
-0xA3D7BB93B6BC20A1, 0x298C1B15E8A2, 0x7ACE42ACE5E1D6F4, 0xAF158E0F1B8822AE, 
-0x430146CAC232D44A, 0x338E1E5CFFA45891, 0xF192F53B51AB8693, 0x690CE90BD5764729, 
-0xB013DC0E526E, 0x5FBC9E46135DE9D7, 0x8EAA3BA687990ED7, 0x52C8C48CF3D98230, 
-0xF6B4D99FE896733C, 0xDBEA0CA0BF39D323, 0x712BEED21D2B899B, 0x13473A0501C5F, 
-0xD11233B641716CE9, 0xADEE09F168687540, 0xD59349EB979BA0F2, 0x3E5FA588D7677B9D, 
-0xCF8DCF3D17051300, 0x2E6CD4A663673EF3, 0x7AEFDDEF4452, 0x4E43957A4A64AEBA, 
-0x4A5AAC5937FDED21, 0xF330AB9CD918D54C, 0x56A3A25C7831C99D, 0x2FCDF4A3C4314428, 
-0xB3416CEDED1D7159, 0x5F5B7FACDEE5, 
-0x6BDE5D99C4476D33, 0x78487B068BF17F59, 0xB7505EF00D975BE7, 0x2EC65BA455682DAF, 
-0xCBACEC9A91953AE5, 0x4F4000D030AD2402, 0x1DE595CA3C437, 0x70E632D36C2E5DAB, 
-0x5ECE0B5ED735F6D1, 0x8000EA9AB7BC30D1, 0xA2233C0AC507DCB3, 0x56EEBCF09DF9EC04, 
-0xF4E889FE10BB2072, 0xE60A694C55BA, 0x278D829EAA5E5EFA, 0xD8D055605D651F93, 
-0x3DE547FAD2DA1C8D, 0x653820A6097C9D62, 0xFEF53265CA6F30F, 0xEDF2E87D96606201, 
-0x22D429EA9D3FE, 0xED150499AB4A8CEF, 0x3B1E1A084E8A2777, 0xF07D3DDE993C489D, 
-0x5CB7D80952D4B2FA, 0x514353C782B88C8A, 0xBB26998A5E39541A, 0x11A3003F6F36D, 
-0x125C82C0CC1466F8, 0x8440E46C39A4711B, 0x809ACC61BDF795CA, 0x376E9CF23BD74FE0, 
-0xC0B8909BFC916EC4, 0xF2AD7693C9750BA5, 0x82ACF2FCCAD2, 0xCE18E6B26274D0B0, 
-0x77DCB6E6B6896CD8, 0xF7758DAB9E5D0191, 0x3C5C2A79FFD1D9B1, 0x459C725B4AA50754, 
-0x7C8DA150B865F7DE, 0x4B8CB65EE1C, 
-0x213B756291ADADE, 0x36430B12AA6AC27F, 0xCCF798780BF8FAB4, 0xB7D73BE4B4599B59, 
-0x144634729ADACA2B, 0xE58424C24B3C238B, 0x82B01250640B, 0xDFE11C265488E035, 
-0x9D191F2409833F4F, 0xDFABE8F026893956, 0x6C557181388F5704, 0x38BD5EF519519CA2, 
-0xF103D694CB5E15EB, 0xB71C882D6E85, 0xA2A7C95F79A0E84D, 0x7FDAF7801D284040, 
-0xFBF40A7BA4B062E, 0x74056BD4486525F, 0x6E924945733CF12B, 0x5BB12FE0B6985394, 
-0x22AD88B924E47, 0xCE6C09FA16DA5D1A, 0x306669C50A8B534A, 0xA79F48013365520A, 
-0x7409E510D9FE9461, 0x12A4F2B8F4D96622, 0xB3CDC9F56EB3E50B, 0x18F7F361843B2, 
-0xABB03CCEA01EAD34, 0xEF6E86737610FC92, 0xBD869738703A9EF0, 0x22300AF0BEFBFA47, 
-0x4CEE44809E791F31, 0x482C042620596275, 0x19EB9FE6566D, 0xC58B340745FAA1AD, 
-0xEBE958C706ABB297, 0x79822FFBB3FD43FC, 0xBC3EADD4E7C078A7, 0x46806F1F8B062B2F, 
-0x113DCDBBD68FBBAA, 0x20950B11BB3ED, 
-0x96522295AB2A15C4, 0xEADC6D3D85EA9B1A, 0xCBE81AAFEF7CA279, 0x8FD2167598747CD3, 
-0x92FA00B852E1FAA3, 0xDAA3C12B7A7D82FA, 0xB4851EA01642, 0xFAD4030A02DB8358, 
-0xFB1B22F346CA60A1, 0x1907C174C7C5985D, 0x6F23AAACF22A7E25, 0x51FCEB46D5B6BC31, 
-0x266F4C0A9846D26, 0xDD7B188C8269, 0xA284270FF527D7B, 0xFE2839849E8A8A18, 
-0x1B2F3AA0BF63C8D7, 0xEECBE97409A826A1, 0x8E18E359EF5D746B, 0x4753F95F587AC60, 
-0x1A5359E5D8EDC, 0x49EDC2DF09B519E3, 0x862834E30A07C006, 0x179FF92A77DBA460, 
-0x11709811A7BAFC43, 0x66E19F7BB35B153, 0x2CBEDF3BD40E12D1, 0x12AF4C3A8798E, 
-0x5288F8B44570A4B1, 0x330F6DFAF2F88BD0, 0xE88912F6AA521BB9, 0x834EBFE2F77AA24D, 
-0xAE6CD48984D299DD, 0x35221A47391D148, 0x16B91BAFC08FF, 0x7F98C2B06E6D3C6E, 
-0x6E04383E6A455706, 0x674F04B88AC3A6A3, 0xA5DB0CFC3094C68F, 0x5662284304BED671, 
-0xAB932117CCB87B1B, 0xA3FF89B9CA28, 
-0xAA925BC63BFB9FE0, 0x22A918ED40187786, 0xD93E64B4068BF9A9, 0x843E1061CDBC5CDF, 
-0x3B156A7ED662DD04, 0x1A6311CD687A78CA, 0xD25A2DD8870F, 0x5D6074A1B118FF05, 
-0x29940BBC8C3E163F, 0xDEAE13DD1D305E46, 0x5A09E931F0B0AAA0, 0x471F1C76C123727A, 
-0x692EADD7985EED94, 0x1CF14A852671, 0x5E0556B96010BA7C, 0x71B5C5A4EB5ED435, 
-0xD0D2961A6650DE04, 0xC1831D05ADED5FD3, 0xEA4230D85715E806, 0xDB9B8C33930C17D, 
-0x11105D17CEE16, 0x1C87A68E527A9B7F, 0x65576AC4834D7D84, 0x60761A85ADCD6513, 
-0xAF8C34B6ACD20AF0, 0x3B6B3456DC6EAFAD, 0xCA6AEE428C02B001, 0x21C285C2EE760, 
-0xE30AF3F55E329F3C, 0xAD877CF8F704EBB8, 0xFFB898AF31A9CFAD, 0x3C84DA4BEA778FA3, 
-0x728A78C802DB3AE6, 0x97EC91250557B43, 0x206B8F74E04B6, 0x419AFB3ED9CD8CC, 
-0x996CC40A709AFE10, 0xB875485C068DC6D6, 0x788622CE1CB020DD, 0x339B2A6D5BB679FB, 
-0xA2D88B219FB414EA, 0x6AB6196A50AC, 
-0x14E917F20EE1E7FA, 0xB9EEB0F594DD25D6, 0x923C2AF220FFDF9C, 0xF53B67B0F7C13B07, 
-0x1336FDECE0D1587F, 0x982DD64AF2DF6991, 0xAF6F242A8C1, 0x1A992FFD09AD8873, 
-0xB77C649E38E32EEB, 0xD3854CCE074F9213, 0x9CF2FBA1F2A85ED, 0xA7B8D18A70F15C6A, 
-0x2DB2BF7F14DA3A12, 0x114E647E2F0A3, 0x7FA1DD90787052E2, 0xB31BB8B534EA0F30, 
-0x70AFDC7980F706F1, 0x57DFC53F6574972F, 0xA6EFD4C81CA48405, 0xE6C77F4E8EF763A3, 
-0x1868DB1CBAC1F, 0x283BED68CC2EF92F, 0xF2DEAEA87D4535B2, 0xEBE8A1DF14CC774F, 
-0x7A6C469713164DC9, 0x17D2EA726CA19613, 0x6420D2AEDAEBA3F4, 0x80CBE16950BC, 
-0x9ECF78E2B879D38E, 0x7AD86D2886045575, 0x668F1F9346192ECF, 0x32F47B2D89DA0D97, 
-0xD3CBABEE65AFA737, 0x7219F03B7811C7D7, 0x12D917221B3B4, 0x40230014B979FEC1, 
-0x147FAD34D54691FC, 0x27B4DE025591D9E3, 0x70E042D8E0CE5DBA, 0xE2DDF4E4C4511825, 
-0x1B72EE8892FDD85B, 0x1252FD1BAF6DE, 
-0x3A32C2DFE5E3FA84, 0x74E05C4EB091D0E, 0x2E46AD48C62B75C2, 0xDD9AA19FE919AA93, 
-0xD2450C5A19103C56, 0xA772EA9755BFE4D0, 0x237E3D18A45E, 0xF56CCA23C09643A0, 
-0x656F54AF9B0FBDA0, 0xDB195DA9A8091363, 0xA14985C277A2C411, 0x1137D247C9F2231E, 
-0x4E437096AFB337A7, 0x70BA92603946, 0x8BC0DB2F5F6F7F50, 0x461E38358C6DEA08, 
-0xC457D1971CAD9B16, 0x636BDE25D7632C42, 0xF6B6041707E45887, 0x325C679444C986BC, 
-0x1AE4AEE1C2A5, 0x8A5CD8EFFE98AA62, 0x908E900A96D71089, 0xE0A03AE645FA287, 
-0x284182624CE14734, 0xFD9C6AB6F00FCDD9, 0x6E432A7131734D6F, 0x153AC0FC90F77, 
-0x25FA2B41C71ECF3B, 0xE66DEDAF412991D8, 0xD3B9F059766A5EBB, 0xD7386ECBBA6BB4E4, 
-0x8E462EE4D3655AA4, 0xE118511ABE2D508, 0x1CC1F586DB2A0, 0x5F9FC2434A597275, 
-0xEFF31D164269012B, 0xC85816B23E38B379, 0x23B35AE536558C9A, 0x25220C31100336FC, 
-0x3C421FB35BF04F64, 0x225317BCB3EC8, 
-0x42172BBE449C9CBD, 0x4CACE1E653CCCE7A, 0x3959D261B8B35900, 0x86FA4A7F77276594, 
-0x73E0112D52E4BC97, 0x16F9EE69A173C71A, 0xD2B978404EF7, 0x5BA10687D68AC9CE, 
-0x200553EB3C04ACF9, 0x5F919628BD562874, 0x4BC300FD1A9D8936, 0x8B370795ABB4DC15, 
-0xA89CC604D51ECBD2, 0xB44851A7AD49, 0x4DE3F37F8D11D013, 0xDD98BD3409657085, 
-0xFD5175E71B452A49, 0x1440F6660B583E37, 0x599E499F3780F30B, 0xB47BC104402C2C4B, 
-0x1CA3D3AA0F379, 0x6791028E18C9F6A5, 0xE027E7EDC5835389, 0xB863150D66862C2A, 
-0xF2A68BBC2375EB88, 0x51290D42FA785564, 0x6665565B0B9EF245, 0x125B29769C3E5, 
-0x7C935FC1524DDE29, 0x2960841CAF0A4A65, 0x4EE8EE790B67448B, 0x13CA68E5F80FF83B, 
-0xFA7D801E6660BAE7, 0x8C0C755FB8B20C83, 0x86FDD2D55506, 0x224D8DB9D74648B0, 
-0xDA6E86FE344B1351, 0x5A33C2B26E270B8D, 0x3C5D59BADB41CE4, 0x591B9E0417240CF9, 
-0x476D171221E5C762, 0x1561A00BE3994, 
-0xAB26F6AB7FCF68FD, 0x2802333B06B32975, 0x6E6F5DB174AD84EB, 0x119EC176EE9EA87C, 
-0x3AB357A452488655, 0x324E9448E2DD33E7, 0x12DEBFEDD3F7B, 0x8CC77EEDBBB615DA, 
-0xE7033A5679C9EE93, 0xAE7DB8FFE9C057FE, 0x7A62B9E280635F33, 0x102A3BA2BA0B4DCF, 
-0x7E93B124366931F, 0x37B04F426B3A, 0x96B93F6EBA9E5FEA, 0x7D82CAA8CD242F7A, 
-0xBCE09442554876C9, 0x7DF8A767A22D8A2, 0x43E69CB9DA7BCA89, 0x3DAE94B1D603DE0D, 
-0xFABE236929C5, 0x1DDBB1D142EFB95A, 0x421041B1348BEDD7, 0x1DFCAE227D2CCE5C, 
-0x41BA2CCEEAB19370, 0xE50C3EDDEBF90B2C, 0x603115C856828ABE, 0x10CD286429915, 
-0x68AD950EBFCC58D5, 0xAD77B10BF40BB32, 0xF16E1CB44CE63174, 0xB0B69DC74E556F1A, 
-0xB2453D6508184F7A, 0x43D2912552F22AAB, 0x11C7C7DF23273, 0x77DD5BE6F03A2809, 
-0xFEC77197A6B82217, 0x4D93CE8D32EA0103, 0xD116394EAD103C70, 0x71ED0602C52C8C22, 
-0x40000B28F0FA69E2, 0xE1EDCB97D537, 
-0x6BCA9FE0904054C6, 0x5369891367099502, 0x7A4E1855B1F2027F, 0x628B3156FCB426B6, 
-0x4092440D04E60DB5, 0x2256BC77254C92CE, 0xB6319FA5CB55, 0x2D59D12DF35FFE24, 
-0xC0909BFBB09ADB6E, 0x9B44AD201DA4B2A3, 0xCEB060E988AD5200, 0xA0A578F8FCC19A6, 
-0x2845AD0EE08E1556, 0x13F188DB8C5F, 0x85C942C4567B2AE5, 0xA97445C1D2041EF9, 
-0xD1A62270E7CF1866, 0xA433D4F2AC3FC090, 0x6E12B6998A05AACA, 0x5E4E7352FED9C2C6, 
-0xECF3194EAE5D, 0xC76B573370AAEBEC, 0x1893364350F7F07A, 0x42441E247B49034F, 
-0xDB54A34DCC8708CD, 0xD24428C36609ACA4, 0x1A678EA9F0CE3E5, 0x226887175BEA2, 
-0xFED53D147CCE3243, 0x1750D1F964531435, 0x9A31B1660C87AC5C, 0xAFEC7C35CFDABC08, 
-0xE2440EEF01AA589, 0x841791B6F2F28E84, 0x3624CD473D2E, 0x5374F637CBD3C0B1, 
-0x2876E7485C1CCE4A, 0x1ED5B78644098364, 0x81350FA25C4F4672, 0xAA01BA589B2855CA, 
-0x7514E4B410727AE6, 0x19728B123D69D, 
-0x16DD253E62BAA341, 0x6765A109E688D072, 0x9A9A649339122FDC, 0x44D532C37B35EC7D, 
-0x11DA8401C7535203, 0x66EC067874C2803B, 0x145F350A3C065, 0x17C132ED723680A9, 
-0x55CCF7E2F3789E44, 0x4087321F028F738B, 0x38121B819CD99B6C, 0x3801E50FC37C3162, 
-0x701E3CF8C2E646DD, 0x2192A54406C13, 0xC6A073426751B7A6, 0xF5A1D499CD5973C1, 
-0x444400F4DE00EE5B, 0x68138ED6058D820C, 0x41561AAB7FB9E346, 0xFC54B7D90BC422F8, 
-0x118998046DDC2, 0x452A872FA3CE71B, 0xA736556A97E93E49, 0x2E34088AC2161A77, 
-0x7053887349A87949, 0xBABDB643CFDBA59B, 0x7AC06F59443B1C7F, 0x1B7113372A0ED, 
-0x542C343A75870AA7, 0x3D9E26609A9BBB97, 0xE9C85F0829FEA694, 0x4693E3059C6786F1, 
-0x1F2A4347AE4C5111, 0x5EA0FFA39956D872, 0x400FF6567448, 0x238B62D66FDFF6AC, 
-0xDCF56E344E477896, 0xA1908C7B7EDAB10F, 0x43029DC68AFF221, 0xFAE2C100F5A23EDD, 
-0xA3EF66F9F1AF6982, 0x9D7223376D9C, 
-0x81A940ABBD2CCC0C, 0xA5F436916A9B271E, 0x1BD2938C90DB017E, 0xC12D2B2EB59907DF, 
-0x9555FAF72CEFE318, 0x557094D0C938AE0E, 0x321CAB685997, 0xEA40FF1365A2ED51, 
-0xFA7EE6F8B9CFAF70, 0x7A2C32CF956C6AE1, 0x4898478F5BA598A0, 0x368BC1AC73DBE5FA, 
-0x8892148805E4F737, 0x18AF4481EE91E, 0x731CFA44431B63C5, 0x83B99BE24152F9AB, 
-0x4226672D1AD3963D, 0x10E69C1D559F8937, 0xA7C94A3A35A9D887, 0x4C10F136F3B7826C, 
-0x13DB5CBD558AF, 0x6D7FF6970B67E4ED, 0x5FEB8DCBDD0EF1CC, 0x95369D5231F0A349, 
-0xE1E63EFFDB1C678, 0xCFD618CBA5A00D1, 0xA6333DB1544A1676, 0x8B9FF281877, 
-0x3A63CF1B6128257E, 0x7C9BED5FB1E5B09A, 0xD54020AB764EAC30, 0x5D0FE69F700F7737, 
-0x45C4648634414F82, 0x13328C966CCB48D0, 0x171FCE406F062, 0xE77EA29FB0DBF01D, 
-0xA4D051DA24B830BD, 0x5F57FC5352E2F5C7, 0x98B1D7BB84050D28, 0xC910610655A305EA, 
-0x2D94F68066A135E9, 0x13044DCBEAAD7, 
-0x94A47DE985935CAC, 0x3EA6E3FA2590430E, 0x7E3E4C1AA59063C5, 0x5E953A286FFE22A2, 
-0x6E820EB5478CF053, 0x3044BFDF011E81B2, 0x7D2DCC4B1D3F, 0x196D7710C2DFE012, 
-0x386F6FF6BB93205, 0x4DAAAA9CAB34856, 0x24A30A0293C58B22, 0xA04768DE22A7F8, 
-0x562972B4DDA65C59, 0x147CA0C2EFFC7, 0x21A44C81C650A74F, 0xEDB1EA5B483078FF, 
-0x761C6AEEB844F275, 0x2806D04507E2E743, 0x98F261A2030E1B61, 0xB872B9D1521DC135, 
-0x16BC6F516CA9D, 0xCC5250A27D65E586, 0xBFB656F2FD748A5F, 0xC6AEA72136EE8A, 
-0x2A632E92F0C622C6, 0x9C4DE770D4AE4A5C, 0xE5D9CF157AAFB9EF, 0x1635537481978, 
-0xC1586C91E570E1F5, 0x922D4C0A42C5C493, 0xFA680BF2382A0A53, 0x5324B020BA3A6160, 
-0xF8226F5AEE850AB8, 0x576DB88147FB5530, 0x1C559D2FF8B7C, 0xA71C524AB08C853C, 
-0x4CC5D915E8BED2EF, 0x8D20C00DFB018C36, 0xB9933F53C594BEDD, 0xE008E58513F9CC3E, 
-0x8CB5C9917C4D71CA, 0x2AB869C8A3A1, 
-0x13309A521CD19308, 0x1C31A9B1A82ED6FF, 0xF48A0E00300021E4, 0xAF82FC91233F55CA, 
-0xF95B5F8D874B28F5, 0xA78E5C81C3942EC0, 0x2304162D92628, 0x61E064CB56488C61, 
-0x5A524C29436B4BF5, 0x29D0E60311BA456F, 0x926026441C50625E, 0x645BBD35C82635E0, 
-0xD84B5D9739D660D6, 0x1937ABE614994, 0xED4BAE9D0626D96B, 0xE0974AAB495B2AA3, 
-0x187A7E80F9547606, 0xEB2EBC6C7E421C6A, 0x31C131940DC8DF12, 0xAE202C753BA2D430, 
-0x19F5210A3BF99, 0xAD7479B6E9F403BC, 0xF42D162DDDD0F4EF, 0xFBCD385033B81E50, 
-0x915C08AD5C3A1356, 0xB30BA748114FBE0A, 0x916177FBF71481AF, 0x9EEFEA6D2A80, 
-0x6B63BE0EE18F8200, 0x449285D43C4D9766, 0xD054168C1D5E621A, 0x839B34BE4D557C99, 
-0x935FECE706E2DD5F, 0x17F278C82AFCB951, 0xA65A4C2CDF1B, 0x5E43A85C0F7C390A, 
-0xCDDBF5FE7F51EF7F, 0x61BA252A7155AC6, 0x49F48E42F0929F03, 0xA4937E538955A8EF, 
-0x47C7561BF1ACE8C4, 0x1379D4DDA1A37, 
-0x28DDC5E5B1BE8CD9, 0xD977930B8A9D69A3, 0x4B539947D1E21E61, 0xC0E929012EC083A4, 
-0x1246E99EA698AB48, 0x2C0FE020BB025FF6, 0x1A6CCF90CD84C, 0xD3FF447BF2EBEB47, 
-0x2D08E2412EA97B79, 0x9928D4A70CCF6674, 0x6B5A7596E467D76C, 0xD9261D4B3D3BE1A4, 
-0xD3D54B43507BF26A, 0x8D3E2F059B99, 0xED46771AAA5C20F1, 0x6435B3755E8C4678, 
-0xE7B843FF42E5E6D, 0x203695794E404F3, 0xC09F581F29A7C4C5, 0xDEFD61C49B5A9DF9, 
-0xE1919E69CE91, 0x6C20C442D1D41B0A, 0xE6E5DADBF4A8FF65, 0x4210B1130F84D80, 
-0x6B55875C89AD260D, 0x946EFA0DDD01E05E, 0xBEF9FDB2C39B3240, 0x139EE777A8742, 
-0xD476C7953B371080, 0xC1E87F961044315D, 0x116A8219F7F941BD, 0x5FACDFF217A62207, 
-0x9DFB61A1F68105AE, 0x41C0B3232A47F09A, 0x18CBB20FFB272, 0x7CB6BFC24C5BFC71, 
-0x4299265991B88000, 0x6334B7E3D1BEA2FA, 0x78B1D27B4BE7BB24, 0x1E177D3B60D1B9A6, 
-0xFBE5A0CD25485F5F, 0x98AC3309B2E4, 
-0x66957F7085D784C9, 0x1E131C75ECF64557, 0x52525655E6B383A2, 0x12305F926A9FA95F, 
-0x5FE9AADA9B3E8A12, 0x334E6EE43F49330E, 0x1DDFA46CB89DD, 0x232168DBFBAC7AA8, 
-0x1AC12BE4D81C4E2D, 0x344AF3F76DB638E5, 0x19ED427ABEBB75D5, 0x8DBAFB3515CF7D7F, 
-0x4941A5DF96A4E5AD, 0x14BD76D8C38D0, 0x73B1FDFEAB185580, 0x5A303277AB5CABB3, 
-0xC627DFA44F6DE310, 0x7B5D59FC787AE0D6, 0x1073A15B9FC61DFA, 0xBDC9FE5AC2928F49, 
-0xA2EC26C4F0D8, 0x2832E6F0C5A798B8, 0x759C0E75D74F194E, 0xF8ED5AFB7409DBC, 
-0x5C242FB42B76D122, 0xB17355A53F59BC98, 0x704ADA41B9252AD0, 0x1576AB3CEEDC0, 
-0xC8BFDFD936032102, 0x39D43B28538CB8BF, 0x6610917768672BAC, 0x1C190F4F8FFEEEBA, 
-0xEC3A6021A6A7C5E5, 0xF5CE971974219ADE, 0xC6BC19E8518C, 0x652CF9A2917E8EBB, 
-0xBABC4E43310DAD7B, 0xB411A35F376DED47, 0x3865F6E3C20C92D4, 0x2C9828ED3BF1781E, 
-0x47193E0CB902EF21, 0x1196251437001, 
-0x36B5E1CAFE97C3AB, 0xCBBAA747132CDAB5, 0xB55EFB896F9FF949, 0x91D9A3FBAEA49AB8, 
-0xE94B424702EC05D0, 0x8A112FD0AD6C63A3, 0xEF909B5951C5, 0x1DDB5975C8CB67F5, 
-0x843CF1269A84F2B5, 0xBF19E1B60B2DB764, 0x38D84BE39B7D599F, 0x46ABB6E16E364005, 
-0x1A0F00152DC1C827, 0x1F3E391720401, 0x10935AA2ACEC4242, 0x2D2D0BB85191C580, 
-0xF26F7AF1F537445D, 0x68C744241A7071D9, 0xD6150E55C70B995D, 0xB89D08F943A0DB1C, 
-0x1824C8911BD96, 0x303B5421A72BAABD, 0x41C44BB454EC40FE, 0x5AF1702C0BE7913C, 
-0x8A07F7A30B097D13, 0xE31E6710344E5700, 0xDBA503D90F2D94A, 0x1152B0D40B300, 
-0x98D410EAA14FECA4, 0x3178AC551FB1FE4E, 0xA474610C1C15DB23, 0x1B9B2DBFCBCB5096, 
-0x102E532AFB2D3417, 0xB575E86A65C29B47, 0x1712B5CA05C69, 0xD205ADA7C2CB1DB1, 
-0xC0B89D176CD9DFDE, 0xE0A984A50E29D8EB, 0x8CE392CD317713C1, 0x62EA5E544855C45F, 
-0x4F593A6E8CB9FE25, 0x16B6A4091959, 
-0x2953DEC3A4D3125F, 0x4C20D2DE7B92129C, 0xF557EC91D3BBA356, 0x18067621E925950C, 
-0xD9C85C555494868B, 0x13D399D88E4EB881, 0x18725D9B7880E, 0x8ED7194BFBC6ABAC, 
-0x424A598BD7CAAEDE, 0x735E84EDCF1E37B5, 0x2C3A12F9ABBD661D, 0x4EB89243E5EC1093, 
-0x1F6C2E9963507C3F, 0xB2983381D5E0, 0x36BAF4E07B880DA6, 0x45E65FD0E7C89AE0, 
-0xFF1E19972B58F63D, 0x1541A7C129264302, 0x8EA223A6343943F5, 0x3AC72C03DFD50227, 
-0x21FCABFCE4966, 0xE74430B741A75FE0, 0x6B2308F529028FD, 0xAF9F2CD16F89DE8, 
-0x94A2E99DD5005DB3, 0xF211CF25A89377E9, 0xEE92C2AF115C39C7, 0xD3195E44BA6B, 
-0x45E4AE2CD6EC4555, 0x7FDEB506E470AF1F, 0x3AB133415822E1E2, 0x37EEA8AB95A93433, 
-0xAA5B4E911DA113B5, 0x37FB104E8E529A46, 0x2BD73149D902, 0x8F2DB7F3952F2B2A, 
-0x6424A0835BF5D894, 0x1B868F5A058D0098, 0xB273F3CDCD2D8455, 0x60B240C0239E47D6, 
-0x972CA065B15B891E, 0x8D0E8040B34C, 
-0x5C7446C2851F3DB8, 0xC2300F7AEC3C0200, 0x253B023760B95D46, 0x9A1765F2FAADAE19, 
-0xE1183E4044DC4375, 0x6FD4D0C618252015, 0x1E78693A26E6C, 0x8479A8896D115629, 
-0x53826063F5F9DB5D, 0x90DC79A747BE8015, 0x2FF00EC61F723B13, 0x2522F1A71A175995, 
-0x7935B3CA6C5B136, 0xB8607890F5BB, 0x6DF90155D1C9C65F, 0x52E1C15BA30563AB, 
-0x78F3D55947BD273D, 0x651AE636591EA668, 0xD125FCABF1B0ACCE, 0x71EAC3DC33CB74E8, 
-0x12087461F66D3, 0xD447D646989E2D51, 0x2C342F58429FD77E, 0xB27AB1DCD47607E4, 
-0x8D844AC941F4F35, 0xC4CCC37C53EC8623, 0x5EB69EB9282498DA, 0x18A7C49114136, 
-0xE7A43FB4379803B7, 0x2A878A61749F96D8, 0x3A59540397125FF7, 0xE75BC40960C973AC, 
-0xFDE112A029BC9F9C, 0xC07871CADDB51D36, 0x431765ED8FE7, 0xB544D8F4D5D660E3, 
-0x24CAD74CAC839D, 0x105B93489E4FE3A2, 0xFEF3F10AB99D4020, 0x26EA80D98E9B52F3, 
-0xF6DD5D86222A31DE, 0x1378643CB750C, 
-0x82DA997EA84F1D91, 0xFFCF2C79D6EDC6D, 0x4852C734C3CDF4A6, 0xB479749810A399AD, 
-0xF46DB6909C17A59, 0x7AF725B13EF7D9F8, 0x8C8688D2CA6F, 0x71281B2DFECCCD5, 
-0x3EC8205599998F45, 0x5B9DCA10E7FBBF45, 0x53254F3B2764FEEF, 0x6255123B0CEEFB33, 
-0xAEC00A28906D63CB, 0x1B7FCD983EF52, 0x4435E81D4BA1120B, 0x62C6F28F0109D1A3, 
-0x52BF81C0C5C4573E, 0x890E1E187E46B1F2, 0x740919A8D33B0D39, 0x5DBEFAF614A9F5CC, 
-0x42759EBE57C4, 0x4FA48CA38290ED7F, 0x4A388E53C727FF41, 0x46BE02F21D2344BC, 
-0x9847AC8D1AF2509B, 0xD170153881BE6A78, 0x70BCBC24C90FD2DA, 0x118815150265F, 
-0x11E8C2FC0B9C8B80, 0xB8FEDE65AE73FED8, 0xB561D6DDB6EA595F, 0xD98624018D10896B, 
-0xF5E9B78F9333801D, 0x705CF3259551ACB2, 0x11F0BCDAB1CD9, 0xD7264A2006B97204, 
-0xB462EB7C3816C9B6, 0x35E44BDF97E66095, 0x95453FCE291AC758, 0xE07A611D5F9EFFB3, 
-0xFCF78A7AC9F3CB0F, 0xC856D04E3F64, 
-0x109B5601C2FA87AE, 0xF3F64F23DE7071AB, 0x4B0B2AECF3BD35E6, 0xEBC23C6CC7819B11, 
-0x728CABEA9E5BF3D8, 0x2C21D0B3010EF597, 0x1C6EB2F61312D, 0x75DED298F0C3C9B4, 
-0xAF18308C77FEE8DC, 0xC9913656CB90D5DF, 0x56C881FCE8ADF79C, 0x389DD1D9558A788A, 
-0x942C85EF9E11B86E, 0x177E3331F7ABF, 0x66ED94C65C05E5BA, 0x9772841F820EBA37, 
-0xB139314B6EEF20F3, 0xC44F22048AA48B8F, 0xEE9E5CDAE4BC70D6, 0xADF5FE763CB2F05, 
-0x10C90591BDE58, 0x2DE38E0123E87C4, 0x86A1D707EE6645C4, 0x60D114CBA8F5BDCE, 
-0xDB6D95C77198D31D, 0xE915078310DFB1A2, 0x7E8E4290C17EA0C, 0x157004A00B3F, 
-0x6580E07DA4D75ED0, 0x95985AC65FB45014, 0xDCAAA9C2683331E7, 0x1EDB0D8FEF6FC1E0, 
-0xE36BCA189ECC498E, 0x576F78F47D310E44, 0x1B1AA5AF83526, 0x54BC80AF997B8119, 
-0xCE2C815288E2E680, 0x67A6ADD3A644E8D5, 0x91F8EE65D58F7872, 0x9158C080F53D36E3, 
-0xDECC564913F84724, 0x9BD705B6D979, 
-0xAB079AA5428A3FA0, 0xCD40E2CDD6479C86, 0x7EB5C346D12C3BB6, 0xFFE49701CDFB3747, 
-0x32EF19EA8F2BF9E4, 0xD4BD8703BEC6CAF8, 0x12B8983DFB2CE, 0x875531C4AC47FF56, 
-0x70F472331662FC0C, 0x3059EFB79932C185, 0x45B0EBAD8FB4B345, 0x77C714654DE9C6B4, 
-0x69290C579DB468C0, 0xCFC71A2F63FE, 0x21BCDD60D0CEC4D3, 0xB8FFA3C468A16C5B, 
-0xE04D0C3003CE1525, 0x942C50A210BC5C43, 0x86BF7157383D8A93, 0x45E58ECBB13993E8, 
-0x20C7E9A4695F3, 0xD35140473B462A50, 0x87A5A03110D5252D, 0x3D9B600BD5991FC6, 
-0x16EC015E2A19A604, 0xF06C9287183793EC, 0xA048B6D50F391483, 0x10CAC160A2E04, 
-0xCE33964F4E1A3359, 0x78F3C0DDE777634A, 0xCC4B3C7A5129C6C9, 0xF2ABF64469E208, 
-0xBEACB6B640784302, 0x8D1109677E4AA43F, 0xA5BF212300BF, 0x9ACC249EB640C76C, 
-0x3EBE0C766D70EAE4, 0xA0BFA1A122A8E172, 0x9194D2CA621DE3FA, 0x17DF973D154032BA, 
-0xBF643F4458DF6397, 0x201E9BC296D29, 
-0xF4213E561E046273, 0xCB621D8DC4E3A423, 0xDA5DD9AF230ACB7F, 0x977B40A531F20305, 
-0x305EFA9A30FEF53, 0x152B61BA53A1A092, 0x63E48E759548, 0x20C4DD45FE639938, 
-0x5C20B8DBBCA2554A, 0x4A31A4894BB1FE48, 0xD294366A110735D7, 0xB07B542096B1C2EB, 
-0x7CEFDCBAC6109C97, 0x1C5876198141D, 0x5FA2481D3C9CCCE2, 0xCAF73197FAD78873, 
-0x73C1A61CD4EAAE7D, 0x6E067F1236E50E9, 0x5C27CCC45BA80418, 0x73EE150752AEE0C8, 
-0xEB8CD5CC5AD8, 0xF66255B5A0A655B2, 0x4A526598ED24CBAF, 0x1D1316CD5EA6F2BB, 
-0x78D89027F4B9AE79, 0xA0FD8471570AA405, 0x5494748A2346B55B, 0xCC1542CDF0D6, 
-0x72C6D1C9B72BEC73, 0xA76DAAB1CFF3B23C, 0xDFED9DC6E424788A, 0x681300CC44A19494, 
-0xC2137F9EC56E97BA, 0xF3FC4B1CA47B460B, 0x1AA9A663500AF, 0xB3EE2E13AE32F445, 
-0xEA892DF7B66C817E, 0xD70C9551CA0DBB83, 0x33FE11DF7710C325, 0xE1CBBEDF8F69F743, 
-0xD7B20675B43D351F, 0x1B83F6A61C36D, 
-0x8BB2214E6EE1AEEA, 0x99E7809D664CC2A0, 0xF6E6FDE31A643987, 0xC12D8730986E4757, 
-0xAF1D43A364E0EAE6, 0xD966C17BDDED0B09, 0x122E98FAD7C49, 0xC41C863B4A9EC144, 
-0xA35AC6F1A6D9DDB3, 0x886902378D091065, 0x5EECC25759C561, 0x7EBB1ED08122C3D9, 
-0x6CEBA843A5E9C8A5, 0x20E8D523A39C6, 0xC772FD7208A28A6A, 0xE6BB727AE53FF92B, 
-0xE3604018A7E422FE, 0x3F2B95F6D129D744, 0xE5D4BAA4A56C9F2F, 0xFCFF330F47C497A7, 
-0xB650AD98F61B, 0xD0364165D325E6C8, 0x874AF22D696405C6, 0xEB60909300D3DCB1, 
-0x7D6A9F634EAD9D6E, 0xBE7307E2416742FC, 0xD5ED3C1FB9D1A918, 0x12C075DF06E03, 
-0xFBECC7B13ADC073D, 0xABA212BA02CFFE31, 0x9C1AB8A25C6544AB, 0xBADA118846F907AC, 
-0x43819601A73EBE3A, 0x5AA14EABD3E66AA5, 0x4D6ED38C155, 0xD65730BB6EB1ABE0, 
-0x4AEFF39077AC9ACA, 0x3FB87E5E7AF5386, 0xED9C917C1B708FDA, 0xA6D138A8D211424E, 
-0xE228D4046A571F95, 0x218249CD38691, 
-0x76AAEAED31FAFA6D, 0x3C44AB8D546EDB7E, 0xEEE5620DF418F9A7, 0x917605435180F60B, 
-0x91E2C74A8AA3F7FF, 0x581A9812CA1411B6, 0x9F6E201BA99E, 0x95201611B7005355, 
-0xA0739F034BCBBC21, 0x91DCB77B4A25ABB8, 0x189525750258620, 0x3562A94BF8790D24, 
-0x58AC05BD59506521, 0x915297A8DA85, 0x5F8B21361D8CF3AB, 0x1CD1D7A18574FB76, 
-0x203EB21A7CCBED2, 0x192080E861EA1A2B, 0x27FE8AB207785B17, 0xBD3F335F011BB0B0, 
-0xBC3F9058D866, 0xB7F21F6AF80CC25E, 0x628B7075AFCE92AB, 0x7CBCE0D6113A083B, 
-0xE0A810DCE1BC40E5, 0xCD22D3C48D3CB256, 0xBA8C6F9E3BEB2C0F, 0x17D4253484AA4, 
-0x38B4D4FC69B02D35, 0x8609FE21FAEADF06, 0xF78E9B3F6527010D, 0xF6A38FA87B881B27, 
-0x1CAF6A398B37F5D1, 0xB334CCB98A6BF9E0, 0x93CCC461CCA1, 0xB00168F75415D8ED, 
-0xB890045B17F2C52C, 0x31E52E9C06299EC7, 0xACE8133D1C5567AB, 0xB9FF0A7D436627F5, 
-0xE81D10766C55D583, 0x1E3B1FE42DD69, 
-0x36C51786C8D0FAC5, 0xCC60F99CA79A80D5, 0x3E806BAF9DB50DDE, 0x7AB388E152B0360E, 
-0xDEEB2F0693A14746, 0x65F58AAAAF4E5A12, 0x1EE73895859E5, 0x4C5B9E63E3F423B3, 
-0x55B0A4F9B5CDC66, 0x7401C97C33897DF1, 0xC1034D41598C772, 0x622715CF83E1AA1D, 
-0xECBE0362FF88BEE6, 0x1623E1555BC2B, 0x86C60663A9B9D2BA, 0x9385D1AB1EAE6B7E, 
-0x2109387D39D19133, 0x2210117B6CF10E43, 0x325CA5D13C427B2F, 0x67530F5BCC030CE6, 
-0x1B0B270832B6B, 0xA322F4BD3C010E29, 0x77F913BF92290B88, 0xA98BC55E9D1CB0CC, 
-0xB25539652B5B00CF, 0x5889D32BC56D04E2, 0xD1C8C2862F6CD595, 0xCA1DD254EC48, 
-0xDE0EB2F7EA03F984, 0x28EC4E8EAC4A021C, 0xD240E1317EB35044, 0xAA5D2DFDED1AF388, 
-0x3A6ED887E4C9021B, 0x589AB5761B3B9F6C, 0x160A9E06EA929, 0xC56822CB5947F0B1, 
-0x812D49BBD832B4BE, 0x7C8947614E19D94, 0x1CFA88022A83DAAE, 0x8F4D9F56F08FC4B8, 
-0x5CED39E98F7CF730, 0xFC5BDE2A9695, 
-0x3E6C70B2830D0A0B, 0x49245C2097BE701E, 0xF17B3EAB81596980, 0x6DC86306082C9338, 
-0x381512C814751546, 0x42ACD4AE756576BC, 0x11CDAA2244D4C, 0x8696749D9D56245F, 
-0xD015A60A8A81FB4B, 0xBE4722A90E7858A2, 0x612D6EE270C92258, 0xE31458EF7A584A97, 
-0xE9C6396C35376033, 0x11EFD7798331B, 0xA2FDF9B84BBCF6C0, 0xD2B7C1F64712F69, 
-0xFF025FCFF8F8A004, 0xE73B1A7DBB7BBE03, 0xD9C984E2C5727B73, 0x8726986CED04AC66, 
-0x1339BEE79CDA3, 0xD2C72A2683C81FC4, 0x400D642263510C79, 0x8EE3938D956C3D35, 
-0x6FDFA21F49E0E4E0, 0x13F7D35768C7EBE6, 0xDE2602FD8D3B8580, 0x1018467595250, 
-0xC6476A8E992AC365, 0xF9A0D13F62B63D77, 0xC9A54C20620E9B38, 0xEC27E11DE5E15CED, 
-0xDB054CB11B8B84CD, 0x2F4D697873870D5C, 0x183B713E76727, 0xC4562FCAF43ADEFB, 
-0x17909CB5769415D8, 0xA56A28F0E06017D6, 0x63F7447A597E57D5, 0x84BEBD120200FABC, 
-0x6CF91A11345DDC3A, 0xB4055D865D55, 
-0x334D81DFA6504979, 0x9F5B79F451EB604D, 0x9677356DBBEEFF1B, 0xA6313AC1CDD40E6C, 
-0x863FEEA57CFAD334, 0x4810B22EDC9C1F10, 0x2BC88B172CEC, 0x5A37AFAE0338A106, 
-0xBD4A13470B0549AB, 0x267B159F167E5320, 0x36E26FAED799F3B0, 0xA8B1430BB53F8FD6, 
-0x18B100AD06F56F08, 0x91E4AC288230, 0x4C60B8B46FDC1C24, 0xD0155121B531CDAC, 
-0x45260AEF90A0C2A8, 0xE916F3E79A59B51, 0x6507DE90813DEA77, 0x49FD806F644C313F, 
-0xDFCF98A79A25, 0x11E16D73438E810E, 0xB8D39FBDFF7ECDE4, 0x589A969F38487995, 
-0xE48F8F4B6FBC318F, 0xB0A61588064AF6FF, 0xABB970DCF33BC485, 0x1D5AE925DB90E, 
-0xA75DF81AB56D484, 0xCB874D7540E9F703, 0x6801E61A51D086CD, 0xD272E964838B425E, 
-0x5D7D9F1F700D761C, 0xF27FF0117E02CE3C, 0x12EA2407F4397, 0x1CB224F7C249B03B, 
-0x6496E00AFBAABCB9, 0x6E2FB46D507C62BE, 0x452E96C7A9F05EF7, 0x3F5C0D20CED78D70, 
-0x3C5360AB7C1DF34, 0x77B3E7F7AA7C, 
-0x95D54E0AC5E9D51A, 0xFE95A4B3B7FDD177, 0x8BA7F3C7934168E5, 0x2C2FB4C9EF14C0B3, 
-0xE8DDE3C5C3DE63A2, 0x816F4CAFE4A81D39, 0x18B1F219F05E0, 0xAFCB18D280FED4C5, 
-0x66360C3DD1DBB2CA, 0x20E9FB1068BF703A, 0x237F1FAB2B46AB18, 0xA95DCB1727840E5A, 
-0x2C42AD12F27CC2CB, 0x225798B1D4413, 0x1FB33ECCF3DC557F, 0x8C5BB92A73755DC7, 
-0xC37AD58BBC9FBB84, 0x3BA8524CF36E879A, 0xE08C4748150980EF, 0xF8E8855410D28972, 
-0xD40B74BF097B, 0xEB8E4508155206FF, 0x3D81B4EEA552032E, 0x477AE39EE283DD20, 
-0x83915A8317ECFB0F, 0xE5179B0B11AC57FD, 0x4D3D82D0713586D2, 0x2AB5BEB53945, 
-0xB5CE8C3B6C896D7, 0xA2FF33128EB976B9, 0x4673F7C07C78CE2, 0x23E4AA0754086698, 
-0x13CBFBA510B2C0BF, 0xA507B2E905250E65, 0x148D34CAC3526, 0xADBF5B4D552D704E, 
-0xEA8D66467E99FD14, 0xBE7468F9963AD156, 0x6A98B07066C615E6, 0x605F16DAF6526563, 
-0xD1E0F5B6867249D1, 0xAFE5BCF9361D, 
-0x4F44E8FA3D0E136E, 0x770024EC08D4F5D4, 0xA6881151D3139C80, 0xDFC28DEE3A8F434A, 
-0xA73E6E08DC833B66, 0x504AB7409E9631D1, 0xBD3283A2E9C5, 0x1109E7772C0FB3FC, 
-0x98B6F806C8A812C2, 0xB8C513833159FA0, 0x28C1D0FF3513CC5A, 0xE61EFC82B18E0AFE, 
-0x32EA3DA3C9800E48, 0x1071A3E091DFB, 0xC98DEDA06579065D, 0x4C4412E22D204B0F, 
-0x1B6F2953EE47BA17, 0xA04A132EF098E9F3, 0x63186073BF2F3FF, 0x47B194885775913, 
-0x1A40E2CD9DD4B, 0xEDC8E967AECD6D8, 0xCAEDD3B99D55D88B, 0xA640481F738B3332, 
-0xBD79D32CF60A3673, 0xB69F3C753811EADF, 0x68799A6BB64CDA9A, 0x15AC7FBC73377, 
-0xF6999109FE3DD190, 0xD331676FE89271B3, 0x77301C178B78C225, 0xDDFEFE323CDCAAD, 
-0x42F860A3AE7E4BD9, 0x574835B9008F454, 0x66E7A8DB4101, 0x95FD00CFBB18A3C0, 
-0x6EBBC4A9BEFD101, 0xA24D2DBB4F0B9737, 0xE9A49719B3390DF1, 0xD0FC0ECA1B04403B, 
-0xD2CF2510EBB3D5B3, 0x1DC19C3E1CF97, 
-0xF51AA674E444B08E, 0xD8940C78FDA6A0CF, 0x82B0B8F23706B2AE, 0x10306E552AF16CC4, 
-0xE331E63E30BA0839, 0x5845B1732F03B9FA, 0x1A45FEDF358A5, 0xDABA39F82BBFDF90, 
-0xB6F3037C7384E40A, 0x9169FADF0CF02B4, 0x2D651D1DFD3F1EE4, 0xA33CC492910CC461, 
-0x603519947E24656B, 0x7A0DE322FF16, 0x4264A1AB0E3B3401, 0x6BC25B7EE4B65420, 
-0xB48859C10788CFA9, 0xC017AF438C7187, 0xBADC90F4AD830521, 0x53405F02883C19C3, 
-0x200ABA815668C, 0xF35BB5D33FE3F37E, 0x6A98E4D2FF340488, 0xA3548CF628978EAA, 
-0x6C6641CD5157AFDA, 0x12A7F0C03F8A3B4, 0xF848C9FA3D4A6407, 0x13C43973B6367, 
-0x964E14EC223BEBC6, 0xE737093E3CCBFC99, 0x5E3A1FD9F745566, 0xDC5F47810B7FDDF0, 
-0xA1C6F55E7CF13997, 0x2F0AE60FEC43E4F5, 0x1D51DCD8CC0EE, 0x5EC9E76BED3CBF95, 
-0xFF9D22343058A68C, 0x3B7A23ED50A2A050, 0xE768328432A00DF1, 0xECEB4931FF91B99C, 
-0x2155A753F082012E, 0x78E0D6094421, 
-0x915E18F9229ED8BF, 0xF70E040B0F82C61C, 0x8E0A49CB431E2220, 0x11896E130B7ED516, 
-0xECE549AD68334456, 0x429D48786AA6EBD2, 0x819331686F5A, 0x445C7E41C29216C4, 
-0x63AF4DF5B0517EC8, 0x7B4781ED73E6562C, 0x84B34F64E789F3E2, 0x28124E2E7BD8B64B, 
-0x147BBEDA27E6F002, 0xCBE99D2B4C7C, 0x2EB64DA202255200, 0x800F6709CD003B9E, 
-0xE9F3FA3503EB17B6, 0xDC87E93F4241767B, 0xA9DE61D676533394, 0xE930DB4525BA3936, 
-0x1ABC4DB58DF6, 0x349CD2CAC07EA157, 0xA4AC60479115D169, 0x8A1B09FE1988066, 
-0xC1E5CDA6D2355E1F, 0x14CF5A0738C2A39, 0x3EC36983EDCE60B5, 0xD95C9717B6C5, 
-0x2CB23C78C6C8B20E, 0x1B97C13D20A2DC02, 0x3F1097605FF1E4E5, 0x287AB8FB34032A67, 
-0xEFCCD29E6602FBE6, 0x4EBBEEC202540AC5, 0x1F7AF57D0E2B, 0xE3CBDF342C39F713, 
-0x214BC6B6D8175D52, 0x743C42DCD22F27E0, 0xC740970A81D6D648, 0xA164CD2A5E8FD4C6, 
-0x2E7D49A3A773A8D2, 0x165D7AC373523, 
-0xD9918F1EB82903E7, 0xB4455FE71C8A48A0, 0x26D2FC4FFDA7F7D9, 0xD252E168B903B7D5, 
-0x1A65B8A6052DD106, 0xF90618128C8C001F, 0x1F094AFB9B88, 0xE3A536A5EAD3CC23, 
-0xDEC985C6B5507E45, 0x484A45F2713D1154, 0xBD3EC6BD1D5E251, 0x8C06D8377C33A88B, 
-0x7C20778EDBD50ABC, 0x1D9FF7EF6E00C, 0x64F8711EB4882EA1, 0xA50646FEB3C1F8EE, 
-0x7CA2A45EDC464890, 0x55B68118DF560BDE, 0xAEA6BEFA5AE54B29, 0x2578B727BF635403, 
-0x1546EF6E33972, 0xB577EDC434AEED3, 0x73C617F4AFE92155, 0xD320E15386D8E49, 
-0x2F8C5C1A71A31B23, 0x8108051D9B3DC8B4, 0xCE0C56B4EB153DDC, 0x19B02991C16D, 
-0xBE7F3E473932C857, 0x4ECED925BBEC4CEF, 0x16415C4EA667D13B, 0xCB2F3A17E8AA183F, 
-0xD53FD63520A7560C, 0x409B80A00015E7A1, 0x90C6B872B1FD, 0xB12FAB1CC8BD6956, 
-0x1E12CD3D60304A4B, 0xFA4A62056891DDBC, 0xE5D90D56599B024E, 0xC99EC12627666AAE, 
-0x8C48117643B3B4E5, 0x1241DE9495D39, 
-0x7373EF2243026713, 0x2A58AE967C478B43, 0x52AF43866EFB958B, 0x614EFFCBD209E129, 
-0xFC0CD3C94D37AB81, 0x42CB0E8CE2560C45, 0x5AFD99F6DA15, 0x15867A0CCC9600D4, 
-0xB7817D3497535AFF, 0xD02B953842C0C34A, 0xF0FB3034697C1448, 0xC3451A444B21E3B7, 
-0xC86198A480035BB, 0x1B418AD6EDE22, 0x5616F3E70B14A037, 0x3127A4C7F49F83D, 
-0xAF260EFDBBD96C5E, 0x53E0D5A25207E127, 0x92F3389288FE7427, 0x79CAB0A255526A53, 
-0xF731586A7866, 0x1486584830984B32, 0xD6339C6C031A0F4D, 0xBD63FE3097790135, 
-0x31E7A29F95B7A2E4, 0x7A8189F6712C7B28, 0x2CE48127EBFEC292, 0xC51E647EB4EF, 
-0x25F6550A1FCC5309, 0x51A7FF770839202A, 0x64B088D7353643E9, 0xE2698062E484C224, 
-0x24EEED6C923DAEE2, 0xF09E2098C08C127C, 0xCA65A4DF01BA, 0xDE7D12A86193981A, 
-0x19FD1025896BDE85, 0x37E2E3D97C73A418, 0x27254C6DA776561B, 0xF6043F5807CE494B, 
-0xD364B1096E429312, 0x1963389D9B628, 
-0xF95E2D57A39D66E1, 0xACFC651CBDD51D38, 0x46BA9DC6B63B38E0, 0x83AD9AB81E7882CF, 
-0x7FB21C0299C43A23, 0xD5247CA54431A6AE, 0xE3F391061C2D, 0xBAB413A314433E7A, 
-0x5291F28CDB6F5058, 0xB606406C441FB846, 0x1AA73DBB1C76D2C8, 0x4B89B0E0F871563, 
-0xED48E26869033AA, 0x19325A83F5029, 0xD99C2DEAC3C59186, 0x85011233DC6C9F19, 
-0x3B13106DB355796B, 0x37CB27C37A974FA2, 0x3AC877157DC08571, 0xC574BDF25E7EACD2, 
-0x14F061DDFD7BC, 0x38A400E2D6CDD587, 0xF9E6866B465E4AAE, 0xAF608750DA74E94A, 
-0x659B2590D79C9319, 0x344E3BC798C8E10D, 0x3164EBC36340CC8D, 0x16E60C57645D0, 
-0xCF7E77DB2F3BD11, 0xF76D0E732171A832, 0xD3AC8EF529FDB085, 0xF018F01D437C1832, 
-0xE4619F61A648B62, 0x4AD870B06CE5CD87, 0x21AFB2AABC1, 0x540D449D72F7532F, 
-0xA7C452959BA45253, 0x346565EC20ACE7EE, 0x3E50CFD43BAA6CF6, 0xDA778553E67FFBA4, 
-0x6387B68644F97550, 0x213D594C97C31, 
-0x862EF03D04CC57F5, 0x8610D971970F11D4, 0x42BAD9F162A36CC5, 0xC73B0826D1B7E9BE, 
-0x26E4C014E23FE81E, 0x232005EDD9C66177, 0x108E717AC9F67, 0x3C59A7134F96BB53, 
-0xA4500CCFB1B99424, 0xFE0505032F7C8CCE, 0x784A871B20B312D8, 0x8CA3043F072C674F, 
-0x9851979373D38C0E, 0x13F742F0694DF, 0xD14A5B59B5E79A19, 0x9DEEBA111998137D, 
-0xB45CA6F16019F35D, 0xD1BCB40D3209C177, 0xC4935E839DFA6A62, 0x81908917827A6D71, 
-0x1CDD97028EE48, 0x38E909FAE1B2E5A7, 0x381E567D1C60B238, 0x554816EC4779C24F, 
-0xA9B2E466322944EE, 0x2207550514AC2857, 0xD47ACE47FA670DB0, 0x28C6BB29AB60, 
-0xA762943FE0627F39, 0x486DA780B118A213, 0x5A487F09F6600866, 0x9B6EEE250F20A37, 
-0x5713B2704F9C2662, 0x6214A52157A2130D, 0xB907CD5C418C, 0xCD146219DB2049F5, 
-0x175EEBD26DDB199D, 0x59D00C7DCD940A5B, 0xEB0B90F1BD008968, 0x54FB81076C04B7C0, 
-0x7832F55A202414D9, 0x1826091CF68B2, 
-0x5877397D07C17F86, 0x7861E131F6B5585B, 0x23341D74B9997285, 0x25FA0CF32237348A, 
-0xA8535A8694CC602, 0x2FA5D5E50DA9225B, 0x147C4C2EB8C5F, 0xB9AAB619656D5D7D, 
-0x12FB3E78770054A5, 0x1ADC6EA483AF816F, 0xE58CD950D458DA43, 0xFE04DAD28952A7CF, 
-0x5D0D175C3BB228F1, 0x1F44F4DCDB05, 0x8FB56C06B8E475F6, 0xF4CE48AE5301B09F, 
-0x6EB3ECD9DCA5B3DA, 0xEF63E064C9E90B07, 0x7AF57E229867C358, 0x3B02B0A627B088F3, 
-0x1917A87B78B7D, 0x2A48566827F869BD, 0xBB6EFD6A57FD36F5, 0xA0E32800AEE9E67C, 
-0xF68D15A9CCB0AFC2, 0xEE0F3543C455B424, 0xAF079AD8A43253DC, 0x20DD705B29D17, 
-0xE3CEFF5021E19EAE, 0x78CD2B4488368B5, 0x9A34AB477C2B9AE, 0xC0454686234B295C, 
-0x6A1272C98FDE0AB, 0xCE6B82286A4A14, 0x96CF68075AFA, 0x9A64109491A64E29, 
-0x7D01391CFFEC9887, 0xCDC4F46F3181A8FE, 0x6AC0C9BF3F2C8D28, 0xDC919F986C975CAF, 
-0x3B64379F3629DDC, 0x121E55BB762DC, 
-0x88B028B338AC60AB, 0xB212354B0D3A3747, 0x31FD8AC92D6C45EE, 0xD43FE0A6FBF56CF0, 
-0xBD88E8D30C77F4F9, 0x554A56760AA8FDA8, 0x1A1ED2D6A0942, 0x335E03D3A84F0B63, 
-0xEEFC6511D46E5583, 0x99CF8BED2ECA0EA7, 0x2E6FE12BDFB0B24B, 0xAE104B7B6D4F96AE, 
-0x8A05D39EEA0BFB98, 0x10C809D0500F6, 0x9B01D4350F62F8A0, 0x4B1F2D102DDDE1A0, 
-0xFB8B2AE29DBC82E4, 0xBC296874E07A392, 0x2F9EEB92D0053A7, 0x7A990B71CF8B3438, 
-0x13E747A9347DC, 0x7E272009C8A74C7E, 0x80D211834CC68FFE, 0x3095165DB2B0CEF9, 
-0x8EEF1E5462EEA8B6, 0x4A4D6CF3AD460C93, 0xF60D72A07BF4E4EA, 0x1B76F1F49D0DE, 
-0x7161D76F8BEC4DB5, 0xD45AEBBDAF342DC, 0xE0E775E400021688, 0x895D329D491A899C, 
-0x260E24B1A22D0BF2, 0x1B31976AB20FFDD6, 0xD1AC0D02D453, 0x16A365C5D98362B5, 
-0xF8C1E9F6FB674267, 0x98944493FE2EE1C6, 0x9EE3A96FBCAFB762, 0x5D89DB2385E31EE7, 
-0xA467904332A1D1C2, 0x11D9121E4FBD6, 
-0xA680534EFDAA4083, 0x60C218CC1E628D7C, 0xA18D738444B069AD, 0xB225B739D976CDA5, 
-0x1D36C052151B19A4, 0x71E0F783E5EF3EC7, 0x1659978BF6724, 0x69674A5973A6C105, 
-0xCCDEBA64E574522C, 0x92FF3FC117D15EE2, 0xBD504174998ADF46, 0x5A314F759D0A4922, 
-0xBDD61B6635C7BEDE, 0x10C7BF7113E83, 0x9A8C22C55E3338A2, 0x55E655976E52D4FE, 
-0x993AF411A0C1FFB1, 0xA358E0AB0E103D52, 0x8211A5C15EE7E883, 0xBFF75992794CFDD1, 
-0x12AA6A952CF5C, 0x20B9DD64A1AEF7B8, 0x4813ADB8B8B7C99C, 0x47744892224C6064, 
-0x657B0A06B28A3EE1, 0x2681D07C0D68021, 0x1AC0B216B784369D, 0x945F40618FAD, 
-0xE397ADDD5D249944, 0x7D5E16BFBB08F2AE, 0xC9074DAAEEE8E8F6, 0x401A30EE54794EF2, 
-0x5C41249F5C44714B, 0x62FFC905D1426535, 0xCD3E51C189AC, 0xBF33D5515CF45BC5, 
-0xBD8589D2646400C3, 0xF3D97FC7FA3D9F8A, 0xBF6DD53764C3191F, 0x144C55F7809C3AF6, 
-0xF2A0CEB48FA2D1A2, 0xADEB2A40854F, 
-0x5FD15C7ABF0CA369, 0xCDE0A7F781E7FB0E, 0xAF3FC8B99154653E, 0xD60B5C342034D9A3, 
-0x680A248AE9D8A4A3, 0xC8A118D6C6D84EA8, 0x1DE324D75D812, 0x19A7827B4DC3683E, 
-0x40FEFA2DD627ABF6, 0x43725E127C077C00, 0xBF8EC60AAACCB871, 0xA6C49A2B3892420F, 
-0xA3DBBB5F335DE1CC, 0xC13EE473B452, 0xD3657C4CDD9BD50F, 0x855C21FF0D94E3AD, 
-0xBDE4B85BFAFCBEB6, 0x878DB926C6F646ED, 0x44B11C0215458D64, 0xAEC21594277C0A33, 
-0x49EF078FA981, 0xA64C72455EAA0EED, 0x8DDC9695FA3D6F9F, 0x54DBA249262C2552, 
-0x41EA9B230FB4A911, 0x78C8A0EAB6C907BC, 0xC2E7DE9D794118BF, 0x14479D8C514D9, 
-0xE77AFA67C8549FFF, 0x65B9F37FDB632B41, 0x3DE3CC42A5936526, 0xB5926D123595678, 
-0x4213EC8E431905A1, 0xB3B5BC8982636CC8, 0x21D86EA4A3CC5, 0x28F9B8C57C8D923A, 
-0xBB94124DBF520AF6, 0x727536EDA1405F12, 0x37BFB99B0A86B339, 0x19000D1B37CD8EB7, 
-0xE75907105CDDB38E, 0x6887A6E4ED50, 
-0xC859196EAB3F1ECF, 0x39D52D7B905072C2, 0x1F5E227F638AE19F, 0xF54960D26433360A, 
-0x5705D760602EAB52, 0x6FE9B9A5E4D65AD3, 0x7B236BA152B4, 0x8EEB7F0F89B633F4, 
-0x4139930A5508F7DF, 0xEBDFAA5111929256, 0x7E20C5B275B7D44E, 0x8091D0F2A5B4A430, 
-0x1CB9134431665D3C, 0x1C0077C6493E9, 0x361DF375ADE52B73, 0x1749E2C27D86396D, 
-0x468D6C32F50C691, 0x60915B5A6E1A147F, 0xCD03AD0854484579, 0x126B55D0C0CCBC29, 
-0x10484321BDC7A, 0x56ED45A25DA99AE0, 0x2A950F8F650A340F, 0x456F735B8F12A828, 
-0x7047200BA3B925F0, 0x5EB5BF25C3D6D251, 0xCBE75E10A6B725F4, 0x2274B72826757, 
-0xBC72428CF2C28CEF, 0x85B51D486933FD78, 0x379A101C3AEABEF6, 0x720629AB355375A, 
-0x3B974C4F2CBDBAAC, 0x65E0670708E0AB13, 0xE6389545D329, 0x3F9F690A4323E243, 
-0x43C39E4E9F99A97D, 0xD90E32C3AF21B681, 0x6FBB2977C0889201, 0x99A67CE268F02B7D, 
-0x81BFFD34E58A5398, 0x1A84031226D1E, 
-0x7291FD44DABDD77E, 0x41BC597BA83106D, 0x72BCC2C324C3676E, 0x68ABD28D7EC70478, 
-0x4C3D982A5875B92C, 0x7B0A9E401505E06F, 0x1428811D593B4, 0x134DBFDBECA8A23D, 
-0x9DF10C90E48DEB2C, 0xC619DBBA7E690C53, 0x1A3732E288FA8CBA, 0x5FB2E6B8DE89C297, 
-0xFCB3ED3B25090A25, 0x9FEA37288DB, 0x19F58D8E34B21676, 0x8BE6E4B0D074C147, 
-0xB6B2F109381FDC1E, 0xC376DB9F085911E8, 0x1538EF498E716CBC, 0x1E9ABE675232ACD2, 
-0x2174533DCDA6D, 0xECE04E05686BA11C, 0x28A08C2B58B6D8E0, 0x7C163D7ADDEE27C0, 
-0x5F8BBC95BD2A487A, 0xD8419D167E2BF0AA, 0x76A2A7ABE9500F31, 0x3217206EC109, 
-0xCF4129243153E322, 0x18F3F39861A7DE43, 0x28BE2F645BFA44B9, 0x32A4ED80DE323F2E, 
-0xDFC8C56659138136, 0xEDE2C57BAC62CA08, 0xEDAA6E6874F6, 0x9010EEF6601C0D84, 
-0xA9E8D6FBDA096B2A, 0x6D565B4C5CB2CD04, 0x146303C7652AC052, 0x6F18332530DF50BD, 
-0xEB37EC9CE041C601, 0x13033867B028D, 
-0xFBA0CCD8435A3230, 0x111D41210311C3D7, 0xB0C8E0A091175181, 0xE73637556A7AA39D, 
-0x6C644310A766D2A8, 0x971E03340838F049, 0xFC65161F478A, 0x3F72D119C3DA9D89, 
-0xE6BCFF0609E9D0D4, 0x3A0CCFFD4D3E2C38, 0xC5D87D124BE137E4, 0xF4858813199716C6, 
-0x2B89B4B581AE98B2, 0x1A8051A6E556D, 0x98495CF6914AB669, 0x8237618FAA2554EC, 
-0x80BA7784257EC3E6, 0x454ADCBDA48BA825, 0x4E30937D88434A5B, 0xCEB301F342CBE9D7, 
-0x82E493E42FD6, 0x33169BAD6F28CADC, 0x3A71592810E28181, 0xC8BC913B94616610, 
-0x89D99A6FC00309D8, 0x291F61A1B006D2C, 0x545681BDB86619BC, 0x1C314B319392A, 
-0x22EBDA0B21AA34DC, 0x9CCE12F604475AA5, 0xEDAA17770B519E87, 0xDB56A3529747FBDB, 
-0xA834914531468D12, 0x68CF358A32C173F9, 0xD041CA2B056C, 0x4C9651D70BE03C9E, 
-0xEE535EFACD1E221D, 0x7427BA3D9E09A1C2, 0x259CAB8E34878379, 0x8CCA558AF14CB7C7, 
-0x8F42369112460039, 0xB8E3F39122C9, 
-0x33B153D0A14F05A2, 0xF6798CB9D7A2ACF7, 0xF6C45769D477A192, 0xC38C19528D6A3D25, 
-0xFB4325181229C158, 0x8BCD3FB3100DCE72, 0x1B12D926B628A, 0xE7472CC7033E9123, 
-0x75C617B4E769CDCD, 0xFCD2F9E87EB53EA7, 0xD6FB5F9BF2828F16, 0x7618FFD5F3A3D97F, 
-0x1C18BAC1B2F1D137, 0xFE075FD382EB, 0x8677F5A8EC790E9E, 0x5D432DFF074B0447, 
-0xA6BC5ADB711D7915, 0xEC61BFF6FAC5591D, 0xF5DD9946E03D2E6D, 0xA1F053F0ECF4BC3F, 
-0x10C2961FC5968, 0xEF3B8FBCB45954D8, 0x995660BE986A42E1, 0xAC15EA0A5590A49B, 
-0x88764662FF717AB0, 0xEED9EDA0E2260317, 0x145743178E97D50D, 0x1D6076DC52D0D, 
-0x4FBB014CAF62CF24, 0xB2271C7C719E11C1, 0x63EF14EC25712162, 0xF7B12076E43FC335, 
-0x2A976C570916B43E, 0xA19AA819D13A8EC1, 0xBA7E7F3419C9, 0x830191D0CA83D9F2, 
-0x20EF009A735F96C2, 0x94BF72B085C3F26B, 0x3FB18BFB9E00C513, 0xA01748D6384AFA14, 
-0x39F95E01B58A877A, 0x2155C4A848735, 
-0x40C03CB18B999739, 0xE8158D431E441DCD, 0x46F114B8B569C4EA, 0x161E49C8A72F059C, 
-0x7A59CD724332A06B, 0xC7ED1F25D455566A, 0xC7FFBD845C19, 0x49CD9AC234D7CCED, 
-0x1EB051D740185818, 0x320E342CE16EFA80, 0x84B88F72A22B0665, 0x4D083A7C64C21743, 
-0x779D461FFC9CB160, 0x5A7960E1EBFD, 0xDEAB389413620713, 0xE624EF15CB91C6E2, 
-0x37AE648C159C59B9, 0xA928E481A44B3F86, 0x34F21A845EEC8E03, 0x1A1E250472B6B556, 
-0x17CAADFEFC97C, 0xCEA88349E9DE9739, 0x3CB29CC360B86BCA, 0xC660EE89873D6145, 
-0xF757046D85302339, 0xAB3AE62C015C6855, 0x471929413C8BE2A1, 0x641CA2DF88A6, 
-0x5C9EAC02E2BB4F7C, 0xCA03840B56EA2E1, 0x236DC0F9F08C67C0, 0x30743FC1C7E5074B, 
-0xFE0608311BDBF688, 0x355AE78A6B3C42D3, 0x120CA1AD4E121, 0xDAD5ABD7CB21991B, 
-0x5522C999EE2181FD, 0xA0E4FCCF9838AC7E, 0xE7B141F499755C3E, 0xE0E88CB1674B5B01, 
-0x69117AE83CEA2E8A, 0xD008534D6303, 
-0xB4682EB2CBAE5BB, 0x44A171546182D22, 0x13A5985BFC1B6DDD, 0xB1C77D86CF1FBFF9, 
-0x5A854232D6243CC8, 0x995F831A31937E9, 0x2193179E53322, 0xC0E6DB982373311F, 
-0x84F32FDF9F11502, 0xEB4A2E9921A64DB8, 0x1B964474E19A59C5, 0x62708E5AB18B123B, 
-0x83295BDF9D75C3B0, 0x5369B6D3090A, 0x6D58C9CA5A185826, 0xB39351B00D2CE155, 
-0x9BF4662D80F6775C, 0x162623EB9CC08914, 0x2B2128E810FE4C50, 0x9A8E08CE6CFD9488, 
-0x79D972DAC7E1, 0x34747022A39EC00D, 0xBB4C7C4882E91D97, 0x730CFABB25B94BF4, 
-0x93C1E307393E83BD, 0xFE19F95BB15EB275, 0xA7BCB1FCEB57E1A7, 0x16A34F457CD95, 
-0x7DCDC0CAF9C2BF6A, 0xCAC7C9B17E0EB6AA, 0x71DA6D47A78AC328, 0x93ED151A41939C64, 
-0x920602DBB7066D7A, 0xDA1F86E49CAF8A45, 0x21D2AF7752B7F, 0x87F2D48955514871, 
-0x10B14780258AC7C8, 0xBBD4952DF93272B1, 0xECA28C58DC5485E9, 0x576C088CB8334152, 
-0xF888D74F1A92E392, 0xF982ABEA1064, 
-0xFF86C14CB565F954, 0x1C46FB0D154B4EE4, 0xAF645DDBDA8C6398, 0xD0023820290CCD67, 
-0xA59A71FF8BD67952, 0xE8305E7577500554, 0x1F7C3C9D129D9, 0xD5BB1709DFF9FB59, 
-0x3CF57FBC6D9B95DA, 0xB298CCD6830A90E5, 0xF5AD6240C318E482, 0x88DDD64B872047C7, 
-0xAAAA99444E5A82AB, 0x17A98E532FBE8, 0x6FC6372D72DB01A0, 0x42512A5D1F7DDA78, 
-0x86F3C6CC06750CE9, 0xA95B5002F12DBBC6, 0x264A2C4FFFF72773, 0x14ABAA77B92AC446, 
-0x92EE2B5FA5DE, 0xE384A9ADDBDC8947, 0xEAA5F4E7437C1522, 0x87B6EE37F725FF94, 
-0xBEFB152ADCEF0E9F, 0x9A46A15DE55724F, 0x6817E89E00D0D9C1, 0x1B3D3C1D31FCF, 
-0xB1778103BA8141DD, 0xD8DCCDCBB0E10B6E, 0x4957DDF2BC71093E, 0x73578C818F2098CC, 
-0x1D4A8E2EC75A8588, 0x93004B0C9FF9A6EE, 0x51432B7E861E, 0xE5A0A1A14E736EA5, 
-0xD1548FD4EED7950B, 0x9B51751506CF70CE, 0xD98435D59255A372, 0xDB26B65E688298EC, 
-0xE47573969F1350DD, 0xC2DC5BE5FC03, 
-0x6EE9E49AD5ACAC20, 0x98C0F0BD148C1504, 0xBCD5F16B340E6727, 0x10DD2E190A1AAAF, 
-0x57D0A8633AC94F3D, 0xE792A0F2FF0AB8D3, 0x17D62F3203935, 0xCEB7C843E1E7AFA, 
-0x70B76805B874B32F, 0xB61C29C5235E71CE, 0x2AAAA7525ECE8080, 0x3F1C6AF29E235849, 
-0xA82ACEA8FFB69875, 0xA14107CB10D5, 0xCA39C94DF440C665, 0x4BF97D4D9131FAA5, 
-0x9017F1C4B409DA59, 0x71CF256B868BB79F, 0x9A7B8261B6459576, 0x4FBBD5A93593133A, 
-0x2102B34B3D24, 0xF00AEF350039D2FB, 0x8D4F01831D914410, 0x292EA2126ADEF121, 
-0x35DCBF8CF5F0A433, 0x67338778B46BCCB0, 0x50B3D4AA3386AC1C, 0x3518EAEAA4D3, 
-0x9D90DA923D122AA9, 0xDA6E1288C0DB1F2, 0x8D44D5B1C6369545, 0xFACADFDE554426EF, 
-0xE91A260D0C810BB, 0x148B8A31950FDD88, 0x96AEE0766895, 0xFD9172D0AB456F98, 
-0xA2E7A2DD25224393, 0x9249C65279610539, 0x7FFF1C809F0A395F, 0xEA24484F48F9502C, 
-0x4F37C7A8FF7E59F, 0x14041921A4259, 
-0xC9B80367C4F9BC41, 0xEC221A6DE4E2AA5A, 0x9874A04272C952C9, 0xF25AEFF667A9DA48, 
-0x5CD16E9D0D6C3B30, 0xE307FF8C757B726, 0xA07F2BB930C, 0xC2C7D7DB42D4E35C, 
-0x6831DEA00BEA906D, 0xF1972B0B1B95FEE5, 0x340D60C14FDE4434, 0x23161CF7FB53F10D, 
-0x5F83324EB5FEE38E, 0x3AEB3384E9A0, 0x205BF5E1D01C2F64, 0xBCDF65CAF5666AC0, 
-0x462E5E85DE28CE61, 0xF4BC578D3A6BB9F9, 0xE8D9B3AD7474C53A, 0x5B8D49F5AAD392CB, 
-0x18E4B09E124BA, 0xEF25C97FF51F3A62, 0x2577DC6B020FFC1E, 0x744F55983FE8E346, 
-0x7A63DF17ECF6CF8, 0xCCDC763CD26146F5, 0xC471CC32DE906BD2, 0x225ED685EC9E2, 
-0x7421D058AC7D2220, 0xBC8992B1F58C4B72, 0x90E1F967281025CC, 0x7C867141220A1A02, 
-0xE4C31003C23B1D91, 0x40BE0113AB833129, 0xE532E89CBC00, 0x5AB1471A2E5EEFFA, 
-0xB559E403E9011070, 0xBCFDE4E620886765, 0x454A1AF7C2F0BA52, 0xE7E6171A4DE5E2E5, 
-0x4DBD77E72E8E0737, 0x447CF92D4892, 
-0xBB61C03A2757760B, 0xE0ABC84AE56A9F7B, 0xD89E2334734408B, 0xC135DE9C48F9B2C5, 
-0x33296DD9165AB6F4, 0xC661CB9FB1D28DDC, 0xD3A1CB03836B, 0xCECE3CB3AD8F4747, 
-0x6FBE8942DE44F934, 0x4C913B2499235245, 0xA50C3BC53BD95B6E, 0xA955339216B2A0E6, 
-0x1A99C1BD757A6D86, 0x1CA72D5586936, 0xD4D1B12363BE4D51, 0x552FCD74E342461D, 
-0xD820FA1DD8037BC5, 0x194E362595C5AE8B, 0xD5B504C7E46C29EB, 0xF3B5A7E2082CE03, 
-0xEDFDE0C92D0F, 0xD79C7F75C04FD59F, 0x76B6946C8CC2E920, 0xCDCC45DD0C650DB3, 
-0x952A6A18E05D1C53, 0x5165330F22BE6EC, 0x1011B88C0E8B0896, 0x1D38A69628F43, 
-0xACF16BDF5C30539D, 0x87B0EA08B7823C54, 0xD0E725FB113F852E, 0xCC3AF005823BB87D, 
-0x393CD91F62E68700, 0xE31D2A515634A676, 0xBAECB314D06C, 0x523A215F16204966, 
-0x595E201A8749CC27, 0x10B8FF2A6BB221C5, 0xB1ADBFAB8BF9D413, 0x718AEE5191498513, 
-0x29B01E970C06B8A2, 0x3C332116D61D, 
-0x27A8A9594DE0F58, 0xCA960B3C06FDFDD4, 0xA02B1283F46E00E6, 0xE3BF8B4E7676FB7E, 
-0x11B9737503EE84AD, 0xC3EAEB2F6E1515AB, 0x1C8A0DB5D41BE, 0x9295530DBAF3D8E5, 
-0x90325DC5A0AE629B, 0xABA90A925136AE80, 0x87F46357F54D9C73, 0x90E474CE183BB014, 
-0xF937D341E6022FE3, 0x1E58B7113FBFA, 0x67C93C38DE354A5B, 0x999D84156DCD8796, 
-0x88C85619FCE161D2, 0xE88DB0B5749A5B30, 0xFB3AC5D8006224F9, 0x2404810D81F068CB, 
-0x1CB0D4BA98E26, 0x7F66E1755045A0DC, 0xD4198C361E9ED5B, 0xF44AA277690B8A71, 
-0xF3DC5B683DE8E854, 0x592771F75BBF2DF6, 0xADD2311BBBB0FC1A, 0xE76DB8CE11CD, 
-0x1D84F50443FDDB56, 0xB18B72DF571AF5E, 0x5BCEF3C9D00424BE, 0x771D8857E619C19E, 
-0x98320E7BAFF0C5F5, 0x4F2166BEDBB30443, 0x1D830CE1C6DB7, 0x108EDC760FDB446E, 
-0xA7AAA4979978C8B5, 0xA28279203E30484D, 0xF810F5C8F3CEC86E, 0x2CC66BD3F8BB23D0, 
-0x7F9D4587381E5A74, 0x1E4CF7EFBE302, 
-0xDE2A873C0D7635FC, 0x745262516BF50C2A, 0xEED570958B8B3432, 0xE135D5C68B80007F, 
-0xA3336407D1BEE140, 0x47BF95A9297E4E16, 0x17DE2564D3EDB, 0x4300C2E7FBC7F047, 
-0x3C9809B85C4E1417, 0x809ED788EBFDD244, 0x2E8A7BC30AEF1E17, 0x22F7BE2F92CE3957, 
-0xD9F14433D5428C4F, 0x1D1480DE5CD02, 0x2211D15F8E262331, 0xBC78BD1CA3153A7F, 
-0x3D431742689C7926, 0x9880A8E1336AA5EF, 0x6D19C5B42E302B48, 0x5CFD361762089D64, 
-0x27ED3F6E656E, 0x9FD607AB7F5BFB8B, 0x601D1E8F28061F97, 0x9D98562D23CE58F2, 
-0x867F1AFF9E856FAD, 0xB32AE445CE79EE33, 0x28A8152261DF92C0, 0x21322D6719C7C, 
-0xA7D064F19A3B766C, 0x6C70FFF87FC880EF, 0x64A71182A8173CC9, 0xDC01420CBCE0F083, 
-0x1CE34E007DF3E10E, 0xA27CDA41DCB50501, 0x788394289850, 0x321A468385F3C4CB, 
-0x2E8B87337E5B2DF4, 0x55CE68D7346011D, 0x211C4F75F283503D, 0x760E7474AA7D4D65, 
-0x4A0E0253F940ED40, 0xA916FD5EE6AD, 
-0x50110D646390C270, 0x86E8D3951EC20D9C, 0xB6FD16E075C5BD48, 0x5F07F24970C115A1, 
-0xCEFBAF35044B271C, 0x3FA8653FA6D2C397, 0x21FB7CF70963, 0xAD63406878A34C94, 
-0xA450503F2F889C83, 0xB6F2A238CAD9FF55, 0x5023DDF6E6251AD, 0xBDB4345F05DE7BC3, 
-0x2B5CE771D30634FD, 0x128240CBCB559, 0x2CE714EDC3BDF356, 0x217E6C473EB94A0F, 
-0x57920D655C05E18C, 0xBB126101B6C25A13, 0xE30A2B768E1C6796, 0xEE3FA706678A73D6, 
-0xC3FD63D644FA, 0xB735C051475DB5A5, 0x3BF1095B6D64E1C6, 0xAA49CC37E57D16EE, 
-0x26C0E20CD9F6600, 0x35B1C16E1F053607, 0x230EFF870D31C882, 0x67D73F288421, 
-0x25ADCA312A6EAE9C, 0xE3E1C51C5694C8E0, 0xFE82EF9822A4B866, 0x27BD4C7D0BB97C92, 
-0xBAFC69C4A8C421A6, 0x53F5C5C0CA06323B, 0xE1F46E647D51, 0x5A2BF604D8C1763, 
-0xF2B50258CF506E30, 0x6EA0D11B05D949C3, 0x8314B9C8331B9A16, 0x531F09DFA1D95CED, 
-0x15379B7AD194C054, 0x1372AC736D509, 
-0x3BACD1724318472E, 0x8DBE4C45864051CE, 0x3281343E3E81F7BE, 0x69515F477DC165A9, 
-0x21DB1C63E82703C7, 0x567227C494402924, 0x194E16265B465, 0xFB088C7573C04246, 
-0xD9D2BB685BA4D2A6, 0xE9F226E6A4EC0009, 0xF1E0A5436D1514E1, 0x2F3C22902F310CCE, 
-0x2CD76D2984306B2A, 0xA404531E770E, 0xE7572FDD04B018E0, 0xCE009909ABBD420F, 
-0x82E5E15477934400, 0x21DC976085B80962, 0xF8542C3F9344F4CB, 0x6D6F2EC047746A4E, 
-0xCA2CE1C26D48, 0xA5D6195D7BCB4C0E, 0x7DD8EADA8BE3D256, 0x3C1B81966558900F, 
-0x3EEF54ADA4962011, 0x76F07142D675804F, 0xDEF95C79D5787504, 0x72EB27BD775, 
-0xC18A3DDDE53E66E8, 0x61B300BB1D994D8F, 0xC7320432EEE78FA, 0xB727166634FAB1E9, 
-0x889A27FB7D155BA8, 0xA5D21E1C141244FA, 0x13299C740CC26, 0xDC9EC3CA3562323, 
-0x8F093AE1772A81FB, 0xC45E9E3A45EEF070, 0xC231FCFF6FD14E9F, 0xC36CE3ADCB07F4AD, 
-0x18D79D4E8872C8BB, 0x1BE584D130CE2, 
-0x5B38B7ACFFF69FDB, 0xDE8175476D96A43D, 0x35AC0492BE5961C0, 0x98AE41101E7A91CF, 
-0xC054957B5B674A2A, 0xE3ACD33058015675, 0x3EF049C9C556, 0x249A1FE943A1AB78, 
-0xFFBA40FB0B3D3BB7, 0xE9241DC45B3DE8FE, 0x2EA0032E8D6BE2D7, 0xCC7BBF86DA3C2673, 
-0x54081B7288F687FE, 0x143372CF1353F, 0xE9340A646C3D6336, 0x792C64E4919239E6, 
-0x1CD7F6FC0AE998CE, 0xE47E45DCD6F1D39C, 0xEB64A7DE32637127, 0x19E930C01DB61B28, 
-0x1A14586E66FA9, 0x5F7F36ACFF66E52B, 0x336CD8997CA7A2D, 0x6600E5645BF5B406, 
-0x83E0D73530A99859, 0xD984C3549A5F9C6E, 0xBD3F256ACD1832B2, 0xBFBECE59FE03, 
-0xCE52ADD9B13961B8, 0x32139337A15B9FA3, 0x8D60C99085A75A75, 0xD79AF63122564C76, 
-0xB05DE5BD32C812BC, 0x8BC4F1EAE4D26168, 0x220801F9818EE, 0xB29276B081A880BE, 
-0x4720DDF0CD2B3198, 0x66AD048931E14380, 0xB4823652C5495F31, 0xC61DB15B6731F3E5, 
-0x86AF90528124EB39, 0x1F9A90488EA90, 
-0x64D9B4792067E15C, 0x26EB9580D7573612, 0x4B2B9BECE0C15118, 0x1F123C825B8BEAD2, 
-0x7EC28F7E437BF1C7, 0xDD65FAD83A0D051D, 0x1F824EA6FB3A5, 0xFEC1D7BADBED9BB5, 
-0x17FE5E55FC1B0FC0, 0x5A596858014EAED6, 0xA6A1753568BD0C67, 0x2B967FE08968A92D, 
-0x84358A7999C86278, 0x1CE063451AC53, 0xDEC3C3D557271CB5, 0xB1E6C62B09DBEBEC, 
-0x5AC67448586F9A57, 0xA0B622450784A3D0, 0x5A60BC95BA23D068, 0xB1039D856CEAE08B, 
-0xD1B5A75F36BA, 0x9C230F1BA354319C, 0x8617F024A6F4C893, 0xB46F0030B2797C5D, 
-0x17DF4FF2274CB434, 0xDD9D91CCCEB67F3, 0x80DC6AD4DDB3237E, 0x14F958130A42D, 
-0x7973A16188DDB1B0, 0x89979C9C0357798C, 0xFFFD7C78AE3AB490, 0xA069B5648991C1AF, 
-0xFA4E0CB7C176FE5, 0x539A085F4C9E957, 0x122CEC918D3AA, 0xB4999DFB62B2F209, 
-0xB95281F59FC290DF, 0xDFE07954A9C00208, 0xB17F7F2BB2D43655, 0x64E68AC1C936A797, 
-0x8FE6337825E96E18, 0x2BD519660667, 
-0x2AC6449E13C4492C, 0xD97807C01BAAE84A, 0x6B906B1A303C6FF7, 0xCA8A866D61061BFF, 
-0x2243F350913B539D, 0xD875D65B5B17A7E5, 0xC6FE838E9C4, 0x2DFE0C7D9D82F12E, 
-0xD2AD3EF092CB42E8, 0xDC0684C29F47D1F5, 0x9F1C8289161952C2, 0x798E8AA232B42171, 
-0x94CCFAAA86213CE6, 0x2306FFD022510, 0x9D2E23C936E0A543, 0x7C9D6265D35F598D, 
-0x24134294A6359F5, 0xBA94C6CC3541DB2F, 0x944DF32A94D860A4, 0x8635906C03DEDBFF, 
-0x210DCCC627733, 0xEE3FA10811682C45, 0x9D329A0B021BF33A, 0x36A1F8895E4533B8, 
-0x488B32CB52369293, 0xF9ED9B78413CCA40, 0xF0FF66E3A63A3397, 0xABC2AA32C41, 
-0x6124A70277F1D15C, 0xC149800072287933, 0x78B4F3DDA0B24173, 0xB12C514941670022, 
-0xF794BF268229589A, 0xDB62AB898CEFB25F, 0x9CF4C4D12225, 0xF04D98170810855F, 
-0xFFB6B417564FCE74, 0xBE9FC0C057F7AB6, 0x38B7BB8A63575670, 0xF1CC9EC1E031685C, 
-0x570921D01EB88A87, 0x1575DC510BE2, 
-0x9FDA088A5FA2876C, 0xC7CCA6229BEDA074, 0xEC88EC0498439475, 0xF4A89D7DE5A1D984, 
-0x19D978E372302083, 0x9F2A444BB54F36D4, 0x9089056D8DC, 0xFA8ED7BD6BA567F3, 
-0xB849A18C68BA3397, 0xA6E2409DA5E46E7E, 0xAD41CAFD1D1F857D, 0xFC18D3401F016204, 
-0xDC60D8378D80BE0D, 0xC42E1B0A1B38, 0xDAC964848C952111, 0x134B8EAAA786F5EB, 
-0x76F738494920F34D, 0x86D7E8768F1BBA44, 0xF1154A3E03BC7F41, 0x6BD4E97463BDAC89, 
-0x13E65360D5A86, 0xA9C4262D03C9088D, 0xF8C761483E64F21B, 0xD820EF12E39D86D8, 
-0x43E1B9B7663B4A82, 0x62B431BF20E21131, 0xE2140E9E875FCF44, 0x79D64AE8FAD0, 
-0x81DF8CA3A850A74E, 0xBA5A2CD79C3A71B9, 0xEFFBB2D8905094A0, 0x7B1CF2C7149FA99A, 
-0x1E87E02164A50F1C, 0xDC33C8090B4188BB, 0x15E0A16D8B8E6, 0x944BF31371F77FB1, 
-0xE984B27B708C2AE7, 0xC01EE730E35EE82, 0xC36CDC432770EDB1, 0x66C4FAC4D9EDAB4F, 
-0x760F0C021937821, 0xF4DCFC4C5C1C, 
-0xD697601DCA7CA4B5, 0xD16726DCBE0FD988, 0x8119DD7AF0E6C87C, 0xD1E1BDAB620C8DF9, 
-0x27ABDBB336AF35D0, 0xC36900B91B5F4914, 0x1E21CCC021AE9, 0xDAEB901A8B0B1BF6, 
-0xCFA413FEE3DEEB, 0xD8A152FC022EDD7F, 0x69AEE6F393ADDBE5, 0x45F3B54D85AB6DDE, 
-0x19F7181A0B697BAB, 0xE1C0ED0125C4, 0x374B1CE5F2781984, 0x71D5AD70126A6664, 
-0x4389E57D7715FCAE, 0xE3EFE78A9BEAC09E, 0x455C8B14585F1F17, 0x5F372F4049EBCCF7, 
-0x1AD446F6FFF06, 0xD697601DCA7CA4B5, 0xD16726DCBE0FD988, 0x8119DD7AF0E6C87C, 
-0xD1E1BDAB620C8DF9, 0x27ABDBB336AF35D0, 0xC36900B91B5F4914, 0x1E21CCC021AE9
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
-0x16747C943533BF87, 0xB4497C90231C8CF6, 0x5ABB26BC14FB0710, 0x457A7E552E14B4D2, 
-0x6E92EEF549069079, 0x565AB7E75A1BA5C, 0x21F0CABC7F726, 0x39645C6B7CF4AD82, 
-0x72CA8B9E5285631B, 0xB778021E0CE0E39B, 0x1255EAC0AC0F8ABA, 0x6A43AE42E0830B36, 
-0xC85CCEC4E3F3764B, 0x10F16B11E4DF3, 0x44D662245513A8F6, 0x4926CA3671265135, 
-0x1BD215535DA13B6D, 0x18FE224B9795814C, 0x4010C29A1FC10E03, 0xB72E6E05D7DDD73A, 
-0x4ECD639F7DE7, 0xDFA0E79BF5633D28, 0x5F9B46F9C06602E, 0x22B17FDA14F3A36A, 
-0x44E15C64A71346D5, 0xAA9205DED17FC6DA, 0x59B8583E58373D72, 0x77D7B7A0BE52
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
-
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0xEC805BF7BF3C44F4, 0x9544F219309FD605, 0x57266A162ABDBD16, 0x19BB58DC7DB2C684, 
-0x94AC03F73CAF41E7, 0xE74ACBA50EDF2704, 0xC3C8774EB007, 0x8D6C83984DF44C50, 
-0xE0465877BEE21C8, 0x84AF8716D3A72CA4, 0xB24BA37D544FF41A, 0x55AE1D1FDDE2CF50, 
-0x1FC6005B0A3BF598, 0x1F03B0D3AB5AD, 0x9DECCF4D9DED8FCF, 0xB174F8838F39077A, 
-0x57F83822E25CAFEB, 0x3102E1391CAB6155, 0x227FA1883A32B238, 0x16017735CEB0AC74, 
-0x148CD6FD6DB5D, 
-0x2A01D357301F926A, 0xCB4D81CD7FBABD64, 0x6B82DEA4A30AB815, 0x76E5F2AF75BEC38E, 
-0xD26B0D0ABA831A53, 0x1B9143452E5F9339, 0x472E47104E30, 0x6580B4E8616255FE, 
-0xBEB1D48213D4135A, 0x8B8E530E0979FFBB, 0x7332BF0175E66A6C, 0x1FC991982AE560F1, 
-0xA63089887981F8A2, 0x10651DF93EDBB, 0x138A40B5B601F403, 0xDBEBDEEF56F7172C, 
-0x850B270EBB655B18, 0xEA99413F5D06C2EC, 0x62E8C519B38D16E3, 0xD6A087AEE5AD7907, 
-0x13BF25988A35B, 
-0xBDA4E8A80BD58554, 0x8F5AD2D24CA205E9, 0x9FB501A9A3361E8B, 0x795D391E5533B114, 
-0x7AE37A1A8755126D, 0xDF2E2F4B20CB4625, 0xCC1D3836F3A4, 0xBA317AE90A9F1F40, 
-0x5CD96B10E8B594F2, 0x363A99B394562375, 0x16D9907278F5B7B8, 0x3AD00C23270F99C, 
-0x268847B06792AB18, 0xEDC9BAA4479B, 0x9B6A0789351E26F8, 0x232122287972F869, 
-0xABF334899D2596EF, 0x3ED05B4EC3155259, 0x7D153AE088BEB1A1, 0xEE1400032F6CA07E, 
-0x22F95CC45C80F, 
-0x7E95894918D79779, 0x928ECBB76806A6E7, 0x4E2B5CADC7FF9D7E, 0x3EF12F8FFE36B356, 
-0x6D737A7E43CD3BA0, 0xE4806271B8F12A28, 0xD0A7EBEEE94C, 0x408E6739BCCDB794, 
-0xAFA9839E9ED686F5, 0x9EE7977709708BFA, 0x25F8FF292CBE439F, 0xC9592A5D7646E46F, 
-0x41A47FDC9F47D842, 0x36971DB625B, 0xD7DE6837A1ABBEBB, 0x20FCE0F370405436, 
-0x8869DB8FC8418E06, 0xA5C42D3B0B9BB347, 0x7FFA3574D7D5EF0D, 0xD16DA2322F7EE3F6, 
-0x78CFBA1DCF15, 
-0xA815AEF0BF8399F4, 0x8CDFE4B9C791F68D, 0xB69B40AB65F50C78, 0x7A99360A56DEB801, 
-0x73F1372B37835BAA, 0x52B46F01879A8491, 0x196D0BCBEA9F4, 0x66D9042B7AD20631, 
-0xE2F40994B640041E, 0x803BAB14A520E115, 0x4B8FB04BB4407C75, 0x2746731DF016AEF1, 
-0x52D95DC473A19231, 0x1E688353A84FF, 0xEADB60B1FA225B1C, 0x5829844ECDE44538, 
-0xA8BA69D1157F1438, 0x9A5013CE37BBEB9E, 0xA55A58B80006659A, 0x4B36EA4E5661125C, 
-0xE65382B5CD2A, 
-0x26656337D53A935E, 0xFE987B7E89B1904E, 0x436D2F9722F581AF, 0x8F8B3F66A8F46A4, 
-0x9FF207863CB9DD39, 0x7513BB4EFB10A0DA, 0x1F93DB55F5B81, 0x791730F0307313B9, 
-0x7FE8FF1A56374977, 0xD2955E67E5C7E2BC, 0xC9B6294FEF5D4306, 0x30A601C9B98C9AEE, 
-0x284BF19491A4209B, 0x830D23D448DD, 0x8D8A5A0DF5A3B0E3, 0x54A28EABFA1FFB3C, 
-0x5BA10B3F803A058E, 0xC54D364353A14233, 0xABB9A859710CB096, 0xF8F1F93A83990040, 
-0x14978080CDB86, 
-0x1AA49D3AFA98A463, 0x6C6DA2FA9F14B6CF, 0xE26903D621527B64, 0x547FC7310D472B4B, 
-0x181E14EB3AA253E3, 0xA0721B617FE0783, 0x1E99EEA34B165, 0xA9B8C03406426554, 
-0xF2B4C5825F09678A, 0x981530252C4749C7, 0xF29F3AF85B7E7AB9, 0xECFEA4DF9FA9F013, 
-0x51A67D8E5665BB0A, 0x9F3012AFD23F, 0x5530A83019C37B7A, 0xAF5AFDC8C3EFBAC9, 
-0x809F533BC34A7F8D, 0x3533941DD50EC17, 0x89B4146CADFFB9CE, 0xE4EDE6B5180628CA, 
-0x193D642291ACD, 
-0xC52680F5A1D5D7F5, 0xF26A16EA220A67C4, 0x51683DEA555E736, 0xC9307DF26CF08349, 
-0x3400369D2D68531, 0x6CD36316EFEBDD37, 0x835FCF304968, 0xE9EEED9A49FC4107, 
-0xC111AB8833D02EDB, 0x1577C41960237790, 0x759869DEB441D1BF, 0x271966E27233557D, 
-0x7EFB1183747CA62, 0x180C94F1A1040, 0xAA64A278C44DB707, 0xB40B3790036F4F6E, 
-0xF2F57F2AA9B2F7B4, 0x6D586DB0589D399B, 0xE2A3BB7BFEDA900, 0x98D09766D631F998, 
-0x21B347969E01B, 
-0xB506D47E4BFEC3F7, 0xB25652C1BCF5DA48, 0xEA70506FC28B1499, 0x2A3666DED90E9479, 
-0x9E1E6860FD9C462D, 0x67FFC42CB5322928, 0x179434D8F8A0A, 0x9728BC42F646B3AB, 
-0xF1AEE70E07D4D70F, 0x59EEB6357C35AC9, 0xB23E0EBA39E1B2F7, 0x5A4542BC35E8FD34, 
-0x4E017D5C7725B7C3, 0x27CF73C827B9, 0x64A527550DCD5907, 0x3678D09161817EFE, 
-0xBED115C5EA63801B, 0x9736263ECDB012C6, 0x6B903280A8E74DAD, 0xBD6C18152B8296A9, 
-0x12F2A1077202B, 
-0x48D9422DB4A3B891, 0x3EDCDEE2B344539, 0x25B146C62D60B2AF, 0xA4F160649E0326AA, 
-0xA291E261A82338AA, 0xEEE5E3064E0B77DA, 0x105BD35B40E, 0xF4783294C135E1E, 
-0xA5056685C34208E6, 0x821C7ADCCB5496AF, 0xFAB3049F340E60F3, 0xB290A6682B4ED813, 
-0x8E099C0AF76DE046, 0x124785BE30A9D, 0x6FDD10D2556F813, 0x2810FEE45663F2C8, 
-0xC1846948C575D352, 0x56DB785BE231144F, 0xD696AD1BA6CE96CA, 0x29514A98D851387, 
-0x15571AFD5B61E, 
-0xE8CBF8001C741815, 0x77B0355995A8F28B, 0xBE4CFA44D8EDFB3B, 0xE03758C6281A9E95, 
-0xBD2BF821C2AC5C54, 0x6F7CF1D311270F5B, 0xF6A83D28167C, 0xE00134075CEA80D2, 
-0x39F53D0CD51BDF6C, 0x9EA5BF410C5C3222, 0x4DCE756CCEEDF29D, 0x3CDD9D8B9B946992, 
-0x4AC197F2379A720A, 0x21A5EC40B60D6, 0xEB17AE69CFA246C0, 0x32AB8A55FAF11D62, 
-0xA34108F3AC58ABB6, 0x26B8F2F3195613EC, 0x14C63EAD61B4D5E2, 0x365E422661915515, 
-0x1A24591098012, 
-0xE2E6D1E1474947ED, 0x42FA4D623EC16323, 0xE90EDE5521144F5C, 0x91CE2D331E2A7E0E, 
-0x850E6D98B922CB75, 0xB556CB1D67A349A2, 0x2114FE415E8BF, 0x779255107AE35E3E, 
-0x9E6D0061AC12A9D, 0xBC60D00D01AE4026, 0xA49F8250E4538090, 0xFDBEC6D26803DBF2, 
-0x86C1FE821736C7C4, 0x24C6915F258F, 0xCE8BA2749878FA9B, 0xE859F9258EDD3175, 
-0x8A4265D885141FC2, 0x4E51167C4F0E592C, 0xCFBB67893372F87, 0xEC365D0DC5C4EB2D, 
-0x556EBB8E388B, 
-0xCBECFFEE9D0E49E8, 0x4BA22118880EBAA6, 0x78BB39B967C71E2B, 0x887CC2D8910B6D72, 
-0x6CAA7599C21DE9C5, 0x5F38FCA2D8BB592A, 0xD29EDB7D6BCF, 0x65B7E0A8477B667D, 
-0x29DEBF940550FAF1, 0x8B31EA5E76AD46A5, 0x732860309056EACE, 0xED98A8EFBCC1B997, 
-0x19FFE4D0F727DBDA, 0x3BA2B40F82CB, 0x60E457EAE729D731, 0x600EF128147DBECC, 
-0xB9590B8C64F9BB28, 0x5E3C420EF97F4680, 0x93476B581D6CA303, 0xE6E9F1CF72812AB4, 
-0x5003F03BFC0B, 
-0xD439D6D5EAA73560, 0xF06A3C80062AAAC4, 0xAF4335CAE37F5A58, 0x74BA9BF16A7DD5BD, 
-0xC89A68E2F9A0BF53, 0x900E6ECAC98A891F, 0x1932C987ABB0, 0x3CA109071F25F058, 
-0x758DA3DE20BBD2D4, 0xA5B958E96387B49B, 0xD9BD787164AF5633, 0x4FB1B19C44984020, 
-0x3AB302C4F7C2158A, 0x12515483B15A3, 0xB6528F8CB35D3BF, 0xBA4769181A02C48C, 
-0x3537B032B2D8FF07, 0x1C69541832F46446, 0xFBE2C41D50D0E1AE, 0x21DE168D7F787302, 
-0x7220AFEDB032, 
-0xAF7867D34F3BF6B0, 0xDB4C91FCD5DAD187, 0xBDFDF76F7B17064C, 0x232BAFFA1A02AC8E, 
-0x50549D1F80C29BC, 0x10AE173A14542B1C, 0x1BDD3A653C0CF, 0x2E539937FDFE7D29, 
-0xAE7ED2C03C24C3F4, 0x4AA63D4EB4F8504C, 0x2346DDD13B081DF7, 0x13A0D691575A35BF, 
-0x7AFB1EC81E8194D5, 0xF4F8F2A2C320, 0xBF23B1F69D1EDAC2, 0xA39ECD16B70125EE, 
-0xB0E53A50D9EECE0B, 0xB22CC704EE8439F4, 0x4840F99D830FB492, 0x1DD8BA3FAD131F16, 
-0x18EFA369142E7, 
-0x60DA859ED995FB4A, 0xEC5EB0B7C3E7244E, 0x6CE35165BC3C9E09, 0x94740EA96A023CE0, 
-0x32E556A128025F16, 0xBA45528485F4EDD5, 0xEFF0985033CD, 0x6E158D126DB2DEE0, 
-0x82FB9165FB521F54, 0x3564147F9581D527, 0x37A57CEE7A3654BC, 0xE9156B8B4E47EF3, 
-0x3A7D3FD6D9A54B83, 0x5B1C49C6BCDA, 0x559DB8E736B4F3F9, 0xA519659F1124F25B, 
-0xF2477A0585F8AE45, 0x5671E973CD91B9BE, 0xDCD7A48C8C3C97F0, 0x214CBA473CF8B1CF, 
-0x9FD2B65E417D, 
-0xCF52D82628DCF1D8, 0x97FEB86048FC880E, 0x450231D4783A4B19, 0x847F6411A65722FF, 
-0xA95CE3350E7B3566, 0x97B2F0D1C47A68A7, 0x1208EF04B340, 0x3BE0EF689F5BB450, 
-0xC76F8D29CF9B6BDB, 0xF9AAC51986968F4A, 0x56256F725F6F30BF, 0xA5E1B70EEFB49BE2, 
-0x8BCC908A33938A96, 0x18AB876B614C6, 0x6612C9C5D1794A59, 0xB29357609F4C37E5, 
-0xCC887976729B553D, 0xD0B386D693FC0827, 0x1FDEB4D44B64A1D7, 0x565F7D573A7E9B5C, 
-0x2191576EEF553, 
-0x85879C670E2DC088, 0x12242C35BB697A0C, 0x8526D3EE0EDE7472, 0xDB5DC97753DEB6E5, 
-0x2399900DDB6F8C0D, 0x573146154B32DD6D, 0x325F55372262, 0xBA994F6EA5431FFA, 
-0xF5C3F913134C3318, 0xA8EF722CB20BD1D6, 0x9A11E85CCDEAC7CB, 0x3EA776C6945B7DF8, 
-0xEECFE2889EE181F2, 0x20537B246E1DC, 0xEBFF24875AED5B33, 0xDAF5286243D128F9, 
-0x23F33DCC4A5ACDB1, 0xD224F507EC30453D, 0x9A22A4BEFC7FA3D6, 0xCAF88503AB48F569, 
-0x1178C5516E662, 
-0x18E6027D4233E649, 0xE9EDEBF20EEAD413, 0x6B09697E29352C33, 0x736EE33D69F9A9F4, 
-0x8267768A86DEC9E8, 0x16A7CFE6294D02B5, 0x3A43907C8837, 0x8D80F73732FD5C8C, 
-0xEBC5B2707CD96B0F, 0x4F58A96ECAA4DDFE, 0x1178709A071EC1EE, 0xDAFC4B5BF4C91023, 
-0x58E37310B575C8CF, 0x1CD2F757C98D, 0xD2D24D9C3DEC9B66, 0x55764D2A3FB0C42A, 
-0xB64D4B8317F30545, 0xDA8E716688B68F63, 0x97C17DFDD366C677, 0xCE7245F1198A0F0E, 
-0x13EAAFF0D6029, 
-0xE6E48A44B43C89E5, 0x729CEBE84B6942D2, 0x164E27D64781A163, 0x1CAC477220437833, 
-0x45A3E96D49BF87D4, 0xC6FE846712ED2BA1, 0x21B72315663B7, 0x7A469AB0A6702F84, 
-0xAEA9F8638D12D040, 0xBB052C5B755AA1, 0xEE52128794CDAF92, 0x495DA559392F87B, 
-0x1E2C02254A1FEA57, 0x12231DD7E481D, 0x187273C1C37C6622, 0xC9C7517D5C0B6928, 
-0x34A7092D320B11B1, 0x9249DD4C05620084, 0xCA9EFB8591C88F3F, 0x52D28AF4714725B5, 
-0x1DD56B54910A7, 
-0x60E6F39B5C74C7AC, 0xB5030DD06DA1667A, 0x2175642C60F3D7F5, 0x308ECAD7DFEAE2BB, 
-0xF73516A21B97FB78, 0x1BA5B72190DCB248, 0x814A4017C80A, 0xE67E5CE4B226D943, 
-0xCE154A47A33B21C4, 0x94D875AB1FE1C199, 0xD5483DBF0A988DE5, 0x441C1EA4E829DB4F, 
-0xD561CF220941ED83, 0x96749EDC2A04, 0xBF73DF457B525792, 0x3C58A39EF96E0273, 
-0xFF83338BE7542DDA, 0x3630AABC466C745F, 0x60B9D65A3C4FE8B4, 0x871BB8EB8F9B9AD5, 
-0x1135758AB7C72, 
-0x40CE9D13DF0E370E, 0x6DDAAD3CCCC6C750, 0x4FBC4D2E53A9992B, 0xEB4E8EEB80C686A9, 
-0xC85F619F10828C06, 0x50D4DAD71D81060F, 0x54D92587DEDD, 0xAE06A87F5BD90662, 
-0xE9627C4A7A64B6C4, 0xBB743848A6AE2604, 0x374FA0A07416144E, 0xB233F465B37BFD12, 
-0xF61D02CAE88CCD3F, 0x185A97C9D19A4, 0xAD696B376924772C, 0x5AC02B5A506A3610, 
-0x80A03934B03DBE7, 0xC33F4BFB9450D0EB, 0x56667418085DAC07, 0xB4572857CAF0DC9D, 
-0x24230F6CBCCF, 
-0xA1AAB1BAA37583C5, 0xC22CA59BF0E0333A, 0xE03E802AB9B4DEE4, 0x3B29042FCFCBFB40, 
-0xDA929CD11E32E8B0, 0x66077E4869255DAF, 0x2830C635D6BE, 0x177F1811FA04CAA8, 
-0x4836D14C30233589, 0xE1EE4266BB52CBE3, 0x20D5F503A51D4190, 0xCA43478014143DA9, 
-0x59D3E7173954F91, 0x19A435D18674F, 0xE3967A755C076502, 0xD0BFEF602071471A, 
-0xA58FBFADBEFF7AB9, 0x433DA2CE99EB6B74, 0x391960B98B84626F, 0xC00B7E1F1977AE49, 
-0x27D260A8B5A4, 
-0x5A836453DE1CBA8B, 0xFD616603A337363B, 0xF9393B0BF8671490, 0x3AC8527CABB7905A, 
-0x8D1BC7B150AC6087, 0x5A5B1535DF3F9442, 0xEFDD3198BE80, 0x274D0598A60C7C7E, 
-0x95202DD451175148, 0xE2FEFDF91D536F91, 0xC470BA28B4F3ADC5, 0x59C5952F6EEA2C44, 
-0x27100F13C937058E, 0x147DB847A4CD3, 0xE38FF97A6B2F1AC7, 0x4AD34D95B2868834, 
-0xE0AD04599AACF7D9, 0x2BBCFE084F17FB1B, 0x20A63D8F4448B883, 0x1D99DA89DC47F45F, 
-0xE918D24E63CE, 
-0x11F3A3E530688049, 0x13B66716B1EF4FE1, 0x6166686B0EBE8682, 0x82F8AD6D3178CB8D, 
-0xEDFC3907F5F50C27, 0x82349522D1660EA6, 0x8B0D17E0EB7B, 0xD53305B5135CCFDB, 
-0x644E27D7A3939FB4, 0xDE2DBED0E35F7B30, 0xE13ED92C324AB378, 0x95DC6139424AA1E2, 
-0x15F728AE0F02A5CB, 0x10BF78DF1A955, 0x39E878AC8593134F, 0x2325B5A46390971B, 
-0xB852F0EB171EADF1, 0xEEEC8FF18D97F50E, 0x2B33E0ADE5398ADE, 0xAF307F18D6637BD2, 
-0x3341ED4DEFB7, 
-0xE687D442A106EB07, 0x8331C391CB831E8E, 0x8094566C126A0280, 0x5CB50AAA7D9EA242, 
-0x2B2AD6ECD26FD7E, 0x367DF402CF27BE28, 0x1C7CECA385217, 0xDD4B0E2DD7DDBC14, 
-0xE9B67E85AD89775F, 0xE2087FEE03644152, 0x69620A55CA7E4357, 0xD2E683DF35B1E0FF, 
-0x3130F5EBB934809A, 0x1B7C926018879, 0x77E3B58CD7605288, 0xF0DEF5AD0E4472A1, 
-0x4590F3CC27CF3E8, 0x22920C0C566FB80A, 0x4F44A42E97AD22D0, 0x29BE271E3B496AA9, 
-0x1147505FF6665, 
-0x5AD5E44749CCDAD1, 0x8047497239A91F04, 0x9E3AFECB44E831D2, 0x4AC36AE57000C5D3, 
-0x67250EEF5D7040E3, 0x1A71830D8FA8FCCB, 0xD82D5D3F5B49, 0x7A9B0AA9CA69812D, 
-0xFCEEA7D9581A7D3F, 0xB08636B23463C52C, 0x7F95961642116295, 0x8DB0517680360CFF, 
-0x3BE2C06C7F73DD6D, 0xCA8B7F8CFC22, 0xCCCD0570AE0673A7, 0x2686EAE265A85F1D, 
-0xFEF11F7E3DAFC3D2, 0x9D67B41DE63A9041, 0x155BB7AA8B166149, 0x29B6D78FE87157AB, 
-0x10D7B2D2BB6AA, 
-0x466404F3F7442766, 0x40EBB22AFCD81CAA, 0x735E14211655A347, 0x2353817082FD414D, 
-0xC6F55CA742A1F822, 0x439A4FCA50F31E5, 0x65EA324C62E5, 0x3E2C7B6DF0FBB32E, 
-0xC797A8B8C12C979D, 0x1D10213CB149DC83, 0x1148B2C79B15A730, 0xA81BE19B4E52A929, 
-0x9AC19781468F47F7, 0x7CE5F0D05BAF, 0x50348C2EEBA2EEC8, 0x494B655DC6370024, 
-0xC64B2492B20A7B9E, 0x759D88D47EFE343A, 0x44C0C69C31983368, 0x5F7857C21B3B885, 
-0x18A431626585E, 
-0x7ECD193AA1896FD8, 0x2F087BAADA186D25, 0x51E52FD9E04FB07E, 0x887E0FB3010F5981, 
-0x7DAFD8E9FE1DB04E, 0x1DA39016C7BF888, 0xF0CB6458D166, 0x225E7598E2151CD2, 
-0x951F38951B470D84, 0xD56AAAE60F72E146, 0x77587084FB0D1924, 0x95963E04512362E5, 
-0x7AEEA02B2F2115AE, 0x1B592E82DD6AA, 0x268E948ABB6D1152, 0x3917B6062DCAF5D0, 
-0xF0D74C64625ED86A, 0x6D76AC540F782A2F, 0xEC19D13F659D1B98, 0x202DA50D58CEB050, 
-0x22C86EF5BDE90, 
-0xA734EAF2A84CA491, 0x19C299100EC7D43F, 0x98D1954EF0A26298, 0x471C3FAB0B20BEA0, 
-0xAAE1914FDB490BAE, 0x5B932972B90B6245, 0xB9CB030C5E8, 0x1CCBA32FDDE25787, 
-0xEAA51A8DF1768262, 0xAF47EA613741342B, 0x13C883E1302F7AA7, 0x606C67352B77E68D, 
-0x1585D1497D37DEE0, 0x13A558C4192FB, 0x71253818505D82C7, 0x142C2B75FA87086E, 
-0xEC09FE11871F3DA5, 0x9430A09A029E3971, 0x2FB65ED26B57EB15, 0x21C0A5AD5DC864B0, 
-0xBE043E8C4643, 
-0x7700D04C33E854A4, 0xAA02E3CF7010D8AA, 0xB8F9DA0996E5C218, 0x6F5EF41BA3C72B83, 
-0x37BC4BC873D5BE74, 0x593209E449B061D4, 0xB0BD82FE8FEE, 0x2413042ADAE4F9BE, 
-0x6E68919A3F9F520F, 0x6D6FF86D609EF76E, 0x5F03626516623592, 0xECB52C7CB2BCD8, 
-0x7F68229DC659A96B, 0xC36F51C8F550, 0x4A4DBCEE66CC5657, 0xAD87788CD4DC3BE, 
-0xCEF299D42AEE66DC, 0x9B3D72A3EF740163, 0x67137BF882ED3745, 0x8C68B0297D1A932D, 
-0x17B9459D22822, 
-0x1F4C20ACD7E7ED20, 0x2BA007237746E49F, 0xE38902D142914DA2, 0xE685DC008902E5A9, 
-0xFF5E1E1104EB8F1, 0x1DD2C97332FE69AB, 0x1F2B7C8E5A3D1, 0x9497B379043F8502, 
-0xC87937F32408F729, 0xB8B96C9B777ED3C2, 0x435573BE3E876A40, 0x75C4290D2F4D7B90, 
-0xFD485BC57582DF70, 0x226C55409E1B6, 0x5C9825CEA6878000, 0xBC42F285460627C, 
-0x38571FCAC48B9C06, 0x746C846C79D3AAC3, 0xB5214576B416867D, 0x384B758216E1F8DD, 
-0x19F3237FF2BB9, 
-0xEEAAAA37F9C0341F, 0x3BEBA6D9A962A4D2, 0xFBCDFD09CE598BC4, 0x2F509AF242E79B, 
-0x78DB1F3251D72449, 0xDA7D053B91B5EA88, 0xD21153F1D5D4, 0x143DF1CE74B49BC0, 
-0xAE90824B3741E76A, 0x6887499DFA10169F, 0x2003E289C92A4E5E, 0x370A661EC26A528D, 
-0x6A899A5682EE73E, 0xEAC9635A586C, 0xF73AB0B598C2A449, 0xCE7FDCBDE1324E3D, 
-0xA11F508F2E35A4CF, 0xC4255E2C4783626, 0xF44AB8DE707A6838, 0x63E417A183B25A2B, 
-0x93017CE2A851, 
-0x1A6354F1BC4EC2FB, 0x8F283005F918DC00, 0xEDB354F6C4E9754F, 0x2AD9F00571499369, 
-0xB2753E81FEC4DCD7, 0xECF4786D46C71E6A, 0xE01E40B37E5D, 0xBF37EE6E7C164F0A, 
-0xBA6DA7AF17D430CD, 0x1DFFE78ACDCF9655, 0xD523D13CF3BB6219, 0xD4E246F0B53FF8DE, 
-0xF0F650ACA85CD532, 0xF4CEA38E03A4, 0xE4F8174DC7914DD1, 0x82611EC56B1F75D9, 
-0xDDA7EA743D9EE5B5, 0xD8657A5676F1BEF9, 0xF01EBFBE581D0C25, 0xAACBBE117F522FE8, 
-0x2A75A8C1020F, 
-0x76799A7A2C4F866B, 0x2AFD04AC63C03BA, 0x8AB7B19D71A65219, 0x3063322A7C3AB35D, 
-0xE0957088B9415A79, 0x268CE0438252973C, 0x9283E93E59F3, 0xDB819FE63D7AED28, 
-0xC6FC71D8D72C3FB4, 0x3A55B8DA022A959, 0x8A59B3AD83875858, 0x8CE62B25AFC1724D, 
-0x30085ADEA92036C8, 0x11DE95BB715F0, 0xC13FBED57E7734C7, 0x5DAAE0DB2A28BFB9, 
-0xB4EC05667E7AADC8, 0x1ED3A82B37681D17, 0x3157993A65E29168, 0xF4696FFFD8E72ED3, 
-0x41CB2BF05715, 
-0xAEDCF2D46B85F1B7, 0xAA34108E4ADDCBA9, 0x3214B5366EE44DD3, 0xBC87738883D9AAF5, 
-0x6764179DBE3AF403, 0xBF54C347D46AB1F7, 0x2149A459CAF5A, 0xD59E1B1871D8900F, 
-0xFF0AA74278D595AE, 0x77C3B9C68003A3A9, 0xC2F7F1FB0DFF2614, 0x281F3BBD38B2C913, 
-0xFBC4FD1E31B775A3, 0x22D6A5C64C95C, 0x7C29037BC2F52041, 0xB1A31686A99ACB91, 
-0xDB552D51BB6E8971, 0xA6C169B9DFF1277E, 0x9DE725BDCC7A23DB, 0x47A9A82F6E989C34, 
-0xFE1DB512BB63, 
-0xA20929F1FDAFD96C, 0x4617795C154DDD58, 0x3BF2F1D422B1EE50, 0xC3668CA6AF3259D4, 
-0xE578A01491CCF79E, 0xCC157C03B457F8ED, 0x120344D71B9A5, 0xCE8386B7E46A310F, 
-0x47A8289BB64E649A, 0x606749FE1AE330BE, 0xC8370BE8EB019BF6, 0x7D10966E5D939BAD, 
-0x5C6FDA7483E23A6D, 0x79D65EBA7A47, 0x65861B5D4BBA3704, 0x3F4553039308774D, 
-0x5DB3A4CBC9960283, 0x15F5F27AC0AC7DD6, 0x840044044ECF5D55, 0x6C7BCBCBA92FDFEB, 
-0xEE7B7BB88AD1, 
-0xED18EBB499BA95D1, 0x69AD6C48ED86EA01, 0x8D65D15DDC7439D2, 0x40EA0FECB3F7CFF6, 
-0x3A3CBBAE991DBC3B, 0x9D2E6C8C0A3B6AFF, 0x20ED203BBEFAA, 0x6AB7D10C2AD27552, 
-0xAE6C86197A0AB19C, 0xB3835FAB32008883, 0x446F0A909146E1B0, 0xB317457AAC4949BA, 
-0x9CB305C80DA06612, 0xDA5E813754F8, 0xF07BB2B27E318814, 0xB4859B8A8154DB1C, 
-0xDCBFB18CDC968D1D, 0x60F66C74D96A54D2, 0x236F6A506BF044E2, 0x9BED08577B463E62, 
-0x90C421A1944D, 
-0xBFB748B42FECB593, 0xEAFD684FA83DA057, 0x8CE98FD9B7A455CE, 0x89A27B4E528632B7, 
-0x651C2FE59B6D9965, 0x786B53CF6E2DEF1E, 0x161A8C5337D42, 0x94D231EA7A49E792, 
-0x75B0B1BDEEF85B48, 0x15B58B9B5AAE1C39, 0xDD58719C544C95C8, 0xA9DB1A7782F1D58B, 
-0x4DD2A558BB2B14D7, 0xC0B4EF8EDA57, 0xE5D0DD8CE9F27546, 0xF301CBFD26DD5657, 
-0x7D979200125B0325, 0x24A767E4FCAA14F, 0x67A161EE3DC4BB63, 0x448EC9CCCBEE3101, 
-0x1E0D747CA9E69, 
-0xE94A63551D45C63, 0x4861D89252FB6EB5, 0xF658D308CFC6B850, 0x43A02BD6C5C25308, 
-0x895DB9612AC6091A, 0x8C54A8D1A64F6EB5, 0x75B28E5DB459, 0x94BFF410654B4E72, 
-0x7D64E59D9005772A, 0x5C89CD8AACD6F97A, 0xF24FF4566FA408B9, 0x94580A86AA90D160, 
-0x68E99D088BEF8A70, 0x1F0C5961D1B00, 0x49CE2831AE2E41CD, 0x2B6430B1282E4248, 
-0x9ECAD102EE89F4CA, 0xACA1303085B17A6B, 0x1B5FFA4A9C450E7, 0xE834F97329DA3808, 
-0x8876C03F1778, 
-0xB8D5ACFFF8DAA9DE, 0x136E348A82A3B014, 0x1A8C766B2C9E2B07, 0xF426F0C27696F0DB, 
-0xBF2AAABE7AFBCAF4, 0x2FA5AF665DC6DE8, 0xA810E61AC1BD, 0xD55B18E90BE378F9, 
-0x3F9FFE8DB0CADA53, 0x7916D8EC36C839E3, 0x9C29A7CDDFA5448B, 0x88309E19ED3A5F58, 
-0x5410B1B79E8E8E55, 0x12250886035E4, 0xD339A9586315123E, 0xD150199FED821230, 
-0xB59FFFA993F08BE3, 0x5A309588EE5DA8DA, 0x4A4A3D5C870A70FF, 0x3050B1CDF466F4FA, 
-0x19604EA345DD6, 
-0x54F886AA41C4B41E, 0x800ED21A7AF992DF, 0x6C371565EB36BF56, 0x5D10D8AEB0305BCF, 
-0x1F71D5B50474C4D2, 0x79BDC1D0061695F4, 0xC4D31C98B975, 0x6E6495EF5108F7C3, 
-0x6C9A905CF3E98362, 0xAA02DD548EAE07E8, 0x990EC1DD949B0B7A, 0x66898B0CD06E4B3, 
-0xB765B8289810460, 0x17530BBA6FC61, 0xC95193E6AC920F8D, 0xD56C9589A74A979F, 
-0x8C7908E9FB1AAF76, 0x5E96ED643B6BE6A7, 0x6A55DFDBB65106F7, 0x9CAC60F2C17A2986, 
-0x1EF5FA5ED38AC, 
-0x6E1FC65C6EBD50A1, 0xB653DDFE834FBFFA, 0x1017F9AC08C38B47, 0xEE73BCB9235B08C3, 
-0xCB1335700122B396, 0xDDC84510B9786F91, 0x20348C1C6F43F, 0xCEE12AC20FA6D9C3, 
-0x7EF1160C17B682E3, 0x465BBBCB75E506E, 0xCDC6E65DB1F6F364, 0xC1D70F3FA2B3BE5F, 
-0xB10C24AB211018D0, 0x1BE276FFBF9A0, 0x742BD8217D616FC5, 0xCF784A6F467E5315, 
-0xC640E0F2D3BA124C, 0x36ACDA0569869B12, 0x2A763ED6F7F7A10C, 0x53778674E2678BE8, 
-0x1611BE3966E23, 
-0x665075C75BE9180A, 0xDC23C241600CD699, 0x456BCE352F0D5F79, 0xFC4088544E89FBCB, 
-0x6E45F19D40B6C458, 0x1672522A8E50B7B2, 0x1BDD395FC5F26, 0xBCD88A90BCF4EE1A, 
-0x956AEB72CD514C23, 0x26389D7E998B113A, 0xFB8C8A8CFA4B97E, 0x423ED1207D02DCD8, 
-0x6EF5CE2F56D7687, 0xAD8E8AD7D5BC, 0xEEB84B3A72E026A, 0xFC42BABC6BD5302, 
-0x68CD226C532A4B76, 0x6372947A936DBA13, 0x404A36CCE12B111A, 0xD5EB8866B3A372ED, 
-0x1A0F901993FA9, 
-0x64A212DF55D2BF58, 0x5F790C3A32D68C10, 0x2E35101D5B0968CF, 0x9598CCB51B7D2564, 
-0x35FDFCB819BD12E, 0xF011E6F01CC723C7, 0x11F8435FFE1E6, 0xD202298966E9F7F1, 
-0x882F73EDCAAA1BAF, 0x800DAF96785ADE3B, 0xBA0AC2E5FEA5A8F0, 0xF2FC3F18AC0447E4, 
-0x4AFC412AAB4D7CF, 0x118740442FD17, 0x8C86F006A5451F40, 0xF28D1E9D88F67264, 
-0xC395C3C072716D75, 0x2499FC15AA561486, 0xFF3F0B8C617209C3, 0x64A30A1F53EF247A, 
-0x121EC1F1F9361, 
-0x7E809696C189EF72, 0x6B95E761F371642F, 0x3ABFEEB7931A0959, 0xFF8222A5DDD9E60E, 
-0x3A29A2162CDB14AD, 0x4DF77169FABC13B5, 0x2D9985B378B2, 0x1BB63F32CC41E9C9, 
-0xB886FA297B309A69, 0xC3505985E61657F3, 0x4BAA0BE1E2871DD5, 0x5BE053537E68E0BD, 
-0xD643DDBFDB523A89, 0x318CEA93BCE3, 0x5DED0564E69AEE70, 0x7A9B5BC4A0365D8E, 
-0xC435DD8C1744D179, 0x3B0C4187375731BA, 0xB51D404CD622E106, 0xDB8FDF0DDF7E9BB3, 
-0x6CED7D4D4FFD, 
-0xE7C14FC05747E773, 0xE1D3406A9FC6F545, 0xD2C512BD7B53FE23, 0x8C3F752C91673BC9, 
-0x43CC149DBD387193, 0x97115F0542208E4B, 0x226D76965170D, 0x1B8F86847B24EE0F, 
-0x5B4BDFED7D77FE34, 0x4447907A63C4BD31, 0xB5B97F6163047C58, 0xC51736963E28029A, 
-0xA8540982D2417D59, 0xDB829C861CA4, 0x5E2D5515B55D8069, 0x2E653735B3767B5E, 
-0x27192C1B39EF537B, 0x6FFD59862E5CA309, 0xD36057B1584219A7, 0x2C32EF4C43B11D47, 
-0xCBD68D47A8BD, 
-0x1338464E7CD959FF, 0x69B92CC604FFAD3B, 0x76C3DAF05DB1A78C, 0x3B930FDBC2B1630E, 
-0xDA6DEE0F7682A48A, 0x5C6EED4B165E72C6, 0x1029AE37135BC, 0x9923F056F4961487, 
-0x2FB191AC91A7FA5E, 0x9DBB356A9DF0F58D, 0x4497B56A55590A80, 0xF5AC6F11CD2CEF32, 
-0x3A80682E8E34085B, 0x1B5B36343A382, 0x8009CDADAD24B6A6, 0xC210107C92BBEBFC, 
-0x463177B52E7199CE, 0xF307224D2F57EA44, 0x5F5E263359A074C4, 0xBCADACAAA150C1A0, 
-0x18C0B21C95AE4, 
-0xF4E8A047FF1EFCC1, 0x2FD543B8BAAD56AD, 0x62857F87EFB4621D, 0x91BD6A26DC41A608, 
-0xE09741C9628B375C, 0xCA9F00831E2F1D6D, 0x1E6569E7987C2, 0xD2DC093D24207122, 
-0x9FE7E9597148DCEA, 0x6C7707B693C2ECC3, 0x57957FDEEFB4EF00, 0x3B249B817CF41F4A, 
-0xE583DC2A14C71E98, 0x10845E3917D69, 0x4000B6E9E8133C2B, 0x28189823DB2EF6C0, 
-0x1486AFFBD2874773, 0xA63E496299C02F11, 0x5E54AC7E997602B4, 0x6BF2DB0EE1E0DDB0, 
-0x209FD1139A630, 
-0xEBE017429F57FEAC, 0xA6C15A7B27D4BF8A, 0xF0FEBC02E21A9E02, 0xEC8FB6E3455B23BD, 
-0xEB9CFBEF4ADEF3BD, 0x20941CF3797B717, 0x199CCEF83ABB3, 0x7424C9BAB2066AA0, 
-0x6135D5AF4D19A386, 0x345CD5EC84917BB1, 0x4A13F45D768972DC, 0x6CD51B9F999979EB, 
-0xFA713079C8759000, 0x1D5E8A275FCD9, 0xAFD8CD2EED6DBEC, 0xA2012F90B0B6C7B4, 
-0xE673A6BF8350EFCE, 0x292AADF76317B0F7, 0xBDE6D0A561819008, 0x6C21AE18663D825E, 
-0x2ABB04BD6513, 
-0x4FA48297B04E9E93, 0x464353B38D8AEABC, 0x9F0E4FAC9229C0C6, 0xBBDE4D257189582A, 
-0x2A80CCB80759DF62, 0x57E119E942680929, 0x23764AF357A, 0x2FBDFB429210A652, 
-0xBCF47FD32BE90AE9, 0x7CD2505728BF90D2, 0xAE2E5BD874EDD15E, 0x647681BAEC30297C, 
-0x177BA8FDBC058F2A, 0x19F5A2A8A7567, 0x1F5D2415F615BA4A, 0x131C5A245EE2B417, 
-0x216BB52AB232078A, 0x920988D7740A8F5F, 0x6C5A18E13520E50F, 0x6FCB2F40B527338A, 
-0x2068FC773DCB1, 
-0x3ACDEEE7E5FACB2F, 0x2CD8E9B5C1878972, 0x37225D2BF74A333D, 0xDFA2912D865DAACF, 
-0x67CDC4CC667CCF7, 0x4091293340B76957, 0x13B86753A2C9C, 0xA7E83C3955E32764, 
-0x1D8018DAD5B444DE, 0x1BC52D3FD83A97B8, 0x83DAE013FD1A99B5, 0xDA7EF80213F1C5B2, 
-0xF6805B17CBE1E989, 0x7B4EAD93F849, 0xCDA56C207CF329D4, 0x2FDDE07F7D2DE44C, 
-0xC92C95B374C1F502, 0x94B02BE18333F7AC, 0x65A2E840A62D415D, 0x43DA52B43C1F37A6, 
-0x1393E9025AC19, 
-0xF3BF549623FF8804, 0x382F5252CED0381E, 0xA99F8B8789F3E1B, 0x5C2BB48A8CA8C036, 
-0x96FC7754DEEFAADD, 0x6544E5C676DCFA76, 0xAAA27301EBD3, 0xB2520E8064945A09, 
-0xD91B4DEE9418A84A, 0x656DD32709D87747, 0x43290B283D498DAA, 0x59BC2176E909E8C1, 
-0x77AC13014CC37A93, 0x2164096B1AB3D, 0xB821FF0E12230B94, 0xA338E1D490DB6755, 
-0xEE73087D518D5186, 0x43AFBC6B45B40750, 0x2DA01A6A0B31109C, 0xB98F9A4CA0F19FA4, 
-0xEC01416092B4, 
-0xF424F780A0FE9B1D, 0xEA9DFDD10B99D252, 0xDFDCF17E94DADBD9, 0x36856B4ECD3077B, 
-0xBE2D1564B9DF4B8, 0xC8CA10EF5140FC42, 0x14A51AF8C2D6C, 0x6365462CE867D4C1, 
-0x88A212B69C4CE555, 0x12F621862F5DF4CF, 0x4FE290A62C73A74B, 0xCCBA2859EC5FD7FA, 
-0x2F74CBEC606BB9A9, 0x163D732EE7381, 0x45AE11D243D6D350, 0x3497F77503972728, 
-0xD0B708DED55D22DC, 0xB0A833D8261CDDC1, 0x86ECE4A0D0C21754, 0x42668D8A3E165CA6, 
-0x1DD0390B7B919, 
-0xC218CE1D00A5688D, 0xAEC5D4A95CD23687, 0x551445535D6DCD9D, 0xD344DEF13ACD84EC, 
-0xEF4E153BD3765E67, 0xD879B9B26940662C, 0x21DCB644B01DA, 0x5D5636EC93BFEABD, 
-0xAB79259842A4BE03, 0x617B9C2A2082B6EB, 0x5DA56D984449553F, 0xB47DB8ADC5D4D523, 
-0x7F8A3192E2A8F3E7, 0x1D13AB3818F25, 0x7B8A6EB12B9F1225, 0xF1857938589F4134, 
-0x3FA2C0EE600DF50B, 0x48050B7775E745F8, 0x64984E77DBCA2D1D, 0x5B7AAAB42277724B, 
-0x1C0D52C6C541A, 
-0x4DA86C1BF5825BEF, 0x4447E91BA674CB36, 0xB61ECB9A6929FE23, 0x680D31F02DD89654, 
-0x7BBE189B303771A4, 0xD294BC2DF327BEE8, 0x1A4019E23BFCA, 0xF2B377EA37B1506A, 
-0x1D95F8FF21B1110, 0x4F482FE29FA6F69A, 0x295B6EDD37957308, 0x99C5BE212C8F7B9B, 
-0x4E3B84A4178883E2, 0x24715C6D7FF1, 0x4E423D56B20EFE0, 0xAD2CD1E6311B5EED, 
-0xA3A483787005D938, 0x31563EAAEC88C9A0, 0x387B01CEF1C96C82, 0x9E00009F4EE23B00, 
-0xAB9F3CD89C3A, 
-0x761FF41E7077FBB7, 0xC09698D1E04F6B9B, 0xE6DF4F068A2624D7, 0xFB4B380814508D91, 
-0x9AA72A495DAF9294, 0x667DCA1D802C12F8, 0x1743D89B1DB7B, 0x6C2511FE793C87A4, 
-0x214A7F7E817E56FE, 0x9207470D9D789694, 0x919AE39F772EA2EF, 0xF49C87F4EF3FF65E, 
-0x311247B421C81A81, 0xAC0D17FD2A33, 0x7780DE1297A6048C, 0xED451ED325570229, 
-0xC21B119DBF1E35C5, 0x1BBC0BAE6C00582D, 0xC285039E8174732F, 0x8F626524720BB0DA, 
-0x213234A41D534, 
-0xDBA4BDCE343841E2, 0xDF1D8BFEECED0B2, 0xC09907089D299854, 0x53850AAE6A5F1976, 
-0xC8BA9010859127B7, 0xB5B321220B08195B, 0x9649F8E7BBCE, 0x5280F8C4B974180F, 
-0x826B9ABA6E72D7D3, 0x907EA2DF19212A5D, 0x74726A9C96A3CDF1, 0x2AC72754D6FDBB28, 
-0x54A638C81C61E9CE, 0x55803B4DFAB4, 0xA63B51A1DD127635, 0x868888C56370EDB8, 
-0x9C1A7FB57374630E, 0x174D7B324F49EF69, 0xCB8DBB4EE40B8DE3, 0x4BA86979E3FED7A3, 
-0x2D4A9389B0EA, 
-0x6D0C72D0ABACC61C, 0x67FF8A8E24CA5C66, 0xA48B31CAB70A5369, 0xC3650E057CEE2AA2, 
-0x7CFBB80FDE56A73E, 0x34253E2BC7737DB0, 0x217BEEE6992E5, 0x28C995EA8B7DB515, 
-0x17BB5FF606ED9284, 0xD60663CEFE83EBC3, 0x411FD82E7BF5DB6C, 0xA22A00A4211DA36F, 
-0xF703991F49437C78, 0x1DA89B4A5AFC5, 0x89619FC4E015BA53, 0x15358E54CD8EFBE5, 
-0x8BE4C22E6F5835C, 0xFB8846E41326D933, 0xF863CAEBE32412C9, 0x9751D6F440EF5679, 
-0x6FFBC4D9E150, 
-0xC78F6405D1903AAB, 0x748623F45FAF406E, 0x4B65BB434E54F5EA, 0x532BC94DA7D73C72, 
-0x9030EC04388CD370, 0x4BEB2EC255AB0ED1, 0x179F4C66B7360, 0xC75A01EEC1D80739, 
-0x8BC90E58C2A1CFED, 0x222BE3929CE2BAE7, 0xC64D6EA83FB8407, 0x24D373920772D1EC, 
-0xA43E3EAB72EC8333, 0x1012ECC941452, 0x17B9230B923061F, 0x32E03B5C2E8DD065, 
-0xC1606877B122E356, 0x8E93DF02FEEB6201, 0xCBEC251C7045CB2C, 0xA0ED8B6DD90264B4, 
-0xA49B6A4CBE0, 
-0xFA4487E5C84DD509, 0x8216747DDE1AC07E, 0x5E3B7EAD8574089F, 0xA9C901BFBCDA69C0, 
-0xD57E8EBCA22F28F0, 0xF9A3C461943FC545, 0x10E787F543E96, 0xB0355AB8804264C7, 
-0x9CC22DE6EAD0B098, 0xDDFD575FB89505C7, 0x33A6A5D1DD9FFB2A, 0xEECFACA65A25A0DE, 
-0x84E11AB51B1EB388, 0x11628BA8C454C, 0xB311DA319C87BDEB, 0xB62F68B393846E62, 
-0x111CF1C759433289, 0x9960B4546CB7EA4, 0x26DB3AD56381C72D, 0xCB64328FC2E2E667, 
-0x1FC3C4BADB765, 
-0xECF8097CE63933B, 0xE78EBB33C31AF26F, 0xC6B001115BF3AD46, 0x97382527C3AA6BC, 
-0x73BFBB459947175A, 0xD09449417CA0F9A5, 0x1201172EF84B9, 0xCE9A341D3F5EE721, 
-0x633D0F0019709CE2, 0x77A185D0293DD8C, 0xF5BFB29143FE07DD, 0x7E63F00BB78238B3, 
-0x88F23B5B78797299, 0xC2DD1E20DEFE, 0x59620B3CD0EBF862, 0xD5F76D198AA53A6D, 
-0xB7FA31A4DA8481CD, 0xBBA00A7E007E524B, 0x84B7306FC33D44F6, 0xB885BE9FD4DF0FE3, 
-0x79EB6429A338, 
-0xF59222A8501712DA, 0x344622A350BC29F9, 0xB973920019C6567F, 0x9FD7536A0E6FF9DE, 
-0x886BF1591EF8F7F9, 0x4A7A08E9C0E29C22, 0x11902238AECD5, 0xB350FE03E8F41D95, 
-0x40C793DEF3DE86EF, 0x81722403D2995BD4, 0xE35A3205EB78194A, 0x910E25393B79A5F1, 
-0x36AF2D7A574F8539, 0x6171AB20667A, 0x9F556F28F04B8AF5, 0xD954C0F5D4045BFB, 
-0x61278067C7AB476D, 0xE944AE563977934A, 0x1AFD028E34C6E657, 0x4A8BB659781A2135, 
-0x1B75189666923, 
-0x574899DC97A813E1, 0x55C8BB3F5B52B652, 0x191DA0889A990323, 0x22DA03EB21881C87, 
-0x3CF3EBB780F87937, 0xA65005BADAFCE8A0, 0x1E8B504E18AFF, 0x44D7F3C5D3EB5023, 
-0x61CF2AECC1B47290, 0xA38309A4CEB91FEB, 0x284A10C4ADC8B463, 0x8C4E51B6ECBE42C3, 
-0x84E45E3ACCEEE4A5, 0x1C26E373106CA, 0xB0C1E133625AB786, 0xF449E81491353F13, 
-0x67173B11177DAB90, 0xDEA134902F6A712E, 0x86774A03417C9689, 0x4E74BF7C73A4F33C, 
-0x17CCBFBC20594, 
-0xDF976ADF4B23D154, 0x71C7F5D5A481EDAA, 0xECBAD981EF90D05E, 0xC9D72E3AD79841CA, 
-0xC2F777CEB62BEAC2, 0x514850D8A2936C54, 0x11F44BE04492B, 0x1DCA40AB41B12D97, 
-0xA1D7034AC792AC04, 0x1B463C0A22ED6E00, 0x2555C36E8D18A958, 0x22E4A0C932237152, 
-0xB04C3675A7CF77AB, 0x19024D1766A3D, 0x74DFBC9E22925AE1, 0x6A5A25D43D671536, 
-0x9958A07031ED7B2B, 0xF734011F974D99D0, 0x6FC3BAB789C81D83, 0x161789AD5328553B, 
-0x1492CD4ABA699, 
-0x76C8BE7BF72FD49B, 0x2604B829C961F1DC, 0x3548D92400A789C7, 0xCFEAB16D97C483B4, 
-0x9FAB6728CF360C8B, 0x17F6314503846EDD, 0x18A5C563F0A1F, 0xCD640C77C65DACA6, 
-0x4E1FEBEDD788A70C, 0x8CA02A72A0EB26EC, 0xBA1AC0936CFCA88D, 0xC127B9118E920A2, 
-0x3B8BCCA71AF7EC87, 0xF0EA89BE6DC, 0x80F1C7A8DEDCBCE9, 0xDA4FE804CAEE8CBA, 
-0x1CA935B2B27A6693, 0x4FB4BFBCB65A25FE, 0xC0DEB252574B960E, 0xAB013D72DAC23DFC, 
-0x189F6E408D8CF, 
-0x1E7AE47F67327C79, 0x7269F4FEF748F3B9, 0xD0BA9932FB051717, 0x725A0710DCEADECB, 
-0x1F9DE0E722EDD646, 0x3E8A184B22F39C72, 0x4379B5E803F5, 0x908C0A3EB989C58E, 
-0x3B2727E0BBA1F02B, 0x3876816F1975A5F4, 0x3D06EDDC9E856897, 0xF101B54C04ECE492, 
-0x19FF0C8DC7478E08, 0x404ACBD7D000, 0xA2E120407ADD444C, 0x4FC8D9A4D452D6E0, 
-0xBED9EA02AFBB8522, 0x6AC15337A39CD56F, 0xE072A0739629DA5D, 0x4B36A8C8F14BF4CF, 
-0x20AC744409C26, 
-0x6497BADA2E023E17, 0xEFF47761C6BA6D7F, 0xB35E116E986AE684, 0xE27BD223FE337358, 
-0xF516990E5466A32F, 0x392B6522A9A8062C, 0x1A1C886744341, 0x8164B768C02D4675, 
-0x9D88C0F4181FD7C8, 0x45E1653AD229278F, 0x5ED0C4CCC562925A, 0x8AC21E78B1F8E928, 
-0x94127AAE19B1B77F, 0x1B67A61A4B5E0, 0xA8B044C66C65E682, 0x58D15CEE91FF3FAD, 
-0xE255BCA7196D2ED9, 0x7D800C065D935C02, 0xBAC49B96C85A4F37, 0xC31685006573C61E, 
-0x1CBA997EE367C, 
-0xF958FA750BE9B457, 0x2EF86DBF1836B4F8, 0x99F58CE2075A1970, 0x183D7C93DF87CCC5, 
-0xD03A96B74A59B41B, 0x83DED3E4241864B8, 0x227F7495C4E10, 0x2E88B26FF7185A0A, 
-0xF51C01B96799A553, 0x3C0923CF20082111, 0xFFBDCCFC70206FD8, 0x1EDC9AF47A924907, 
-0x2790D1533C6FD156, 0x184092860A877, 0x9FB83EAB4E690697, 0xA1F84A86EFD53416, 
-0x47921E8D1CDAEA61, 0x526E648F124FF127, 0xC20C84B9BB8466A6, 0x88A8AC021173C481, 
-0x10AA4DC8CDD3E, 
-0xCEC4791F72B38AA1, 0xA32BF277E373ADEC, 0x7976212917FE8659, 0x1180DD0EAB2BD0FB, 
-0x2564C9C5B9536628, 0x9DE12F350FCFA2D4, 0xEF95EFE37A41, 0x1571FCCA71CFDE98, 
-0x80331E45768F0614, 0xAB72F3AAA10748E5, 0x7E76CC125A8F5A8D, 0x674CC112B31EB6C1, 
-0x635A3E84F5AEAF81, 0x19F20B380CB58, 0x7BF176E9CB68AC42, 0xD5EE710F3DB570ED, 
-0x5C241531819969AB, 0x114D1685225F8DC2, 0x9DAE31EB350CF235, 0x515707632DC237A4, 
-0x202B1BC5CC125, 
-0x1BF5B344A6EEFA0D, 0xA0D14BB2C2E44F4B, 0xD2A624AC61E0571A, 0x267717C17EBC0B48, 
-0x3E9895D0831FC1C, 0x8F87071782886AEB, 0x108D51509BF78, 0xFCF0CCF6C5AF342F, 
-0xEC9CA9363EADF617, 0xD6F625985A0E597F, 0xAEA03237CED636C7, 0x15D35775DBA79FEA, 
-0x902FA8F363A73DAD, 0xB7848B5943E1, 0x3A5D320171FE697E, 0xB5BFD5A90B1C6646, 
-0x5F64E8C0CDE8E105, 0xAC25FF161CD79EC4, 0x842AF7C5A470CA76, 0x97B0C552BD4C4FAE, 
-0xB9A508E50809, 
-0xB9BC2E1151FBD82F, 0xFBCE2A6629186478, 0xFBAEECD091A817CB, 0x32605523D714485, 
-0x48B1DB685DA60998, 0xF124929B81779F40, 0x3873C7B6D767, 0x1E5D7D42A4567FC5, 
-0x3E43ED29B7EC63A9, 0x4F1608DA099C1A10, 0xA24B02F6337760F9, 0xF4AF0A8BC99933BC, 
-0x449F1485FAD107AC, 0x1F16EE07BED9A, 0xFC5B43C2AEDBB28C, 0x5E777ECC0E971BD, 
-0x2D5162EE498D906C, 0xC1E9013993863C81, 0x9D32EF7CC3F1B507, 0xF1238AAF8A6780DC, 
-0x13A4BB041CDC9, 
-0xE91F0F6F2CDA5C35, 0xF616FAD27A941FC6, 0xDE849468DB3E52F1, 0x58B84EC40AF07531, 
-0x76E636B28F12C227, 0x2A3F245D67783766, 0xFDC2D5BFB8D2, 0x97602019EEC98C5E, 
-0xF860DDC3DD4DCC02, 0x711DBB839E0C0893, 0x354CB77E68A64E3B, 0x73EAA643C1BFE1AE, 
-0xED79641E4BF5E99E, 0x19E8643DAE376, 0xE8F07B7A9C505FAC, 0x68CB1D7622AD32B, 
-0xA0EEAA01618A445E, 0xF593870CBF06D1DB, 0x4B2409E6ACF8E844, 0x2252577E3EA6EBBD, 
-0x8CB1B390DC21, 
-0x2362A5D0975C4F32, 0x938742814E9B7C3B, 0x1196EC97799A6C6A, 0xC3F9622EE69A0217, 
-0xEF7B960090686AFB, 0x4D760B9C73011302, 0xEE96496D1F03, 0x82A854E009B107DD, 
-0x25871A346A4D9CAC, 0x68A8216F97A0B5B7, 0x85AAB71C43E785B3, 0x79683DD6BB731211, 
-0xF2EB72FD1D20E45, 0x1AA811CD23321, 0x8A14A8764597100D, 0x8C83C099F194AC3A, 
-0x1600C07AEE4A092B, 0xB4EA647EAF2F47B1, 0x8C11935CFC5F4AE3, 0x819FB9AD814B2642, 
-0x73CA59FB9C4F, 
-0x26D150097BC02E94, 0x327922AE0CAB73EE, 0x736D37AAC8D0D8E3, 0xA6879A3EF7D99D99, 
-0xC775E0371A355761, 0x46F3C12CF65A1F54, 0x6A6B6ACDF5DD, 0x66C9F1C6C511FBCB, 
-0x1C499C8EC3120186, 0x959CA138955E71D0, 0x6467AF8AF49259, 0x8DAC101CEF156156, 
-0x52E6C2C3E37B94EA, 0xFEC0347722C, 0x85DA5B77818614D9, 0xE191C416FA2DBC38, 
-0x60F208F2A7940400, 0xEFDDE525B3DAC6C7, 0xA5F541F7377C8A89, 0xDC2498875B04F2B6, 
-0x227255EAF53F4, 
-0x446050CC5664F4FD, 0x5FDF63F954CC3CDF, 0xD132BD10CAA78683, 0xD995528EF0637FF5, 
-0xD2264C7713B0832B, 0xEED093EAB81537B2, 0x6A8407FA56A6, 0xC144D76AB8D43678, 
-0x3C98ECF58089C1C1, 0xFEA2997490106B8F, 0x9580B5F3CEF57058, 0x83214178ACA73DD4, 
-0x8AA1D7E69460B7F1, 0xE001131E1A2F, 0xB6E6BEA5B599FB12, 0xEE084B0B727ACE2C, 
-0xD654B9F76237E67A, 0x7F39C15D90976B74, 0xD9058F66EAD44FA3, 0x3AF7A2C01A6FEBB9, 
-0x1C7C05B6DEE7F, 
-0x9A67CABBB1C8C084, 0xC304311FFC5F57EE, 0x7927E9331B2224B4, 0xF139C398B2F1028C, 
-0x29DB4D3EB982FAA5, 0x391E307FDBB02256, 0x760F0D6AF192, 0x460350F950950F, 
-0x51382952F83A8898, 0x184F4F44F3028AAB, 0x229C8A606895EF00, 0x318BE9D25CB7ACD1, 
-0x734CAD13DCD42D88, 0xA5B1FA879B0D, 0xC3869C60E19FBAE0, 0xDF8020005C755187, 
-0x8AD1E5C1F02C6B9, 0xD019239D5178F7C7, 0x5AC839E59F0B10E2, 0x4BE987C502539B5C, 
-0x8A2F61CD9C50, 
-0x976FAA36D439822C, 0xCACFBDEE4255FCE, 0xBC2C690D9DC103C4, 0x27736B1C19A4E5A8, 
-0x1D6833E9E30FC54B, 0x5203B3BD8A5FC66C, 0x16E0A69521CB6, 0x62D18C80071837, 
-0xD7058BAD69CC7E08, 0xAF8CE0D33BFA1766, 0x100CF6432E498A62, 0xE4A98FF983868CF4, 
-0x8A66799F0FF0B2BF, 0xA623E603DFA, 0xACB1E3854E7C8E95, 0xFEF5D727C51F6AB6, 
-0xCD5D083B373B0093, 0x69B1949429FE23D0, 0xC8EC2FD4EC15462A, 0xC884A6FF402549DB, 
-0x1808E1911AE54, 
-0x25BA279B4AA2688E, 0x92B2C1DCCA4FC4C, 0x34E4048035D2D7BF, 0x879AEA07DA757BBE, 
-0xAA0036C7F50D3213, 0x416597DF1E2942C0, 0x3A2A9C936FDF, 0xFD9D85BDB8810A91, 
-0xFD0A9FBAA7BAC4F0, 0xDC0F26DDA58EE34B, 0xA0C4889FEC4BD8A8, 0x8BDD6397C973C3E5, 
-0xC3EE5071FD27F60D, 0x14FF3FCCB1F0D, 0x3D7A6BCD61212C22, 0xE67015F93F22B001, 
-0x1181450648364685, 0x46C357A5B96AE4BD, 0xC3915F6D224E0126, 0x70E26F9BC6B84E5B, 
-0x3EBCD90212FF, 
-0xE95AE847F60BD03B, 0xF175D5B185B8231F, 0xD724F9B1A4226232, 0x1D8A9CE7E5824045, 
-0xBDFE64A9ECB1072F, 0xCD0082DF6C1A576B, 0x9AC48C20EAA2, 0xC17E744792956610, 
-0x533E563548B24F9, 0x74F5195B1ED6E450, 0x38ABCF83A6CCFE82, 0x8D806BCDF9C42F93, 
-0x8F00E2B2E86E0CC1, 0x764D94B4EF3C, 0xA4DCD033E0E0C89D, 0x88483569D0298DF9, 
-0x5E993A74F8C6B006, 0x61966A154399D3BA, 0x90D822366EDA2744, 0xDBAD69ADE04A4D38, 
-0x10210F2782A62, 
-0xE9B1AC94CB9C11DD, 0x442F6D226EFA824E, 0xAB1822B72E838941, 0xFC45A41092404732, 
-0xBF435DC48F877586, 0xE592D33768C5265E, 0xE9820F2683E6, 0x8AEB0B58018584F7, 
-0x2019B4426EEABDB3, 0xE1692A1E341C668B, 0x499D76BB8F85617B, 0x1415F3C8FA31E77F, 
-0x45978F1C0E533C72, 0x1BA8D0ECFF238, 0x2A4EAF5DE4A3489C, 0x638D10C82F3CC99, 
-0xE774796890F4DFD9, 0x902E028A299C3474, 0x44C9150F1852CB, 0x9607310ADECDA08B, 
-0x1EF6A88CCB8A6, 
-0xDC5F6706E17C43CF, 0xB3FCB4A45216690D, 0xE8D3BCC81A28F351, 0xE23B91F0F609B959, 
-0x84A6CB956F047BEA, 0xED802DA98B35D47D, 0x15E44F28D2D53, 0x187918D91CE5FC80, 
-0xDB7D912A4E7F4495, 0xFD4C1209B5CA331C, 0x75A9DAE2FD63F61B, 0xF8FEF38C52C427C1, 
-0x13D709F7DB3BF1F1, 0x1FD90F3F18E4E, 0xBB2FD912711506A, 0xE3464E6F351BDFE8, 
-0x6CC99417DD8E6B6F, 0x1848FC9BBE52FEC, 0x34B67B6FE0B16AC3, 0xC8484B3A9950B239, 
-0x53124165CEBF, 
-0x9BAFAA6042EE665F, 0xF9709C433C35719, 0xFCA6839EAFC63DCC, 0xF2497C386483E6B8, 
-0xB9503452C175F406, 0x5BA81357C62A9B7, 0x4C6BDE4E06CA, 0xCC87608AAD83F5F9, 
-0x8A0E2171291704A7, 0x8E8E33E3449AEA8B, 0x5B15D00B126DD0F5, 0x8896681F797569E5, 
-0xF6D21393D0491EFA, 0x64CED3B8DF11, 0x3D0FA4EF99D7E431, 0x648D2F0267EE11A, 
-0x271AAF2A26DFB391, 0x12EC02E992D393EF, 0x1F343CFB2B9DEF31, 0x84402092CC68FC1C, 
-0xF1D702A4A158, 
-0xD2ECBD0E44F9E6F9, 0xCA985D2115633CF4, 0x74049AAB7278CB27, 0x7A9C3A477495F060, 
-0x22A6335002486277, 0xCD6FAA36711169E0, 0x4AF03E23CCC5, 0xEF19AFC5D7F655BD, 
-0xE6C450B3AB99F8C1, 0x3C77B9739F137F20, 0x1DA2AD0ED01F19BA, 0x5DE523E61B721FF7, 
-0xD599719A18243799, 0x1DF43B460ECC3, 0x43853BE60610AFEE, 0x162F009BB3093900, 
-0xFBDC4671294BD911, 0xED0C81A21E84E09, 0xF43F45FB066564A6, 0xA75525612A76831E, 
-0x1AEA100BC3D23, 
-0xBCA33B59A48702EC, 0x57954ABC1EDD17B9, 0x65D945C5F283BA8A, 0xF37C62E084E1F810, 
-0xB0819092DF10C6CA, 0xB294DF1DD3CA9062, 0x5D85C9C85E8, 0x6F2E4DCC358C1888, 
-0x42C73EB0FEFE058D, 0xB9AB7A0894F9EC7, 0x419ED91961BF167B, 0x4845BC629113B218, 
-0xC3673B17327C585D, 0x30ED36C75694, 0x4225886FD26DCF40, 0xEBABC67BDC035389, 
-0x2D58996599D827BB, 0x61799CCCD553FB48, 0xEA65A3CDDE484808, 0x332106AC68E5688D, 
-0x1E5E009557B26, 
-0x85AECC869899D97B, 0xEA3C3F68E04284, 0x2E4A977DB23A45DD, 0xBDC0D15AA2793549, 
-0x9C80558F9FD68001, 0x85212C2112E87525, 0x1226710CCE487, 0x71C458D3ED96FDAA, 
-0x6EE2143FC36433B6, 0xB625E7CC13AD5861, 0xD251FE829F224813, 0xE0AD752CD5C9494A, 
-0x649CDF9B62DC5DE5, 0x88B47558EAF9, 0xBDDEC7D96A54183F, 0xC0D55B017C21D662, 
-0x54010DE92F967402, 0x807B5FA21DAF3FA7, 0x50F8F19DB0A1AFA0, 0x4FA7E71087D36EC4, 
-0x69A97FE33273, 
-0x39344F7CA3EEA9BD, 0x3A140B74C2DF8BC9, 0x2B5BD70FE78C876D, 0xB886D6FD8753D1CC, 
-0xA2CDB25B014409D, 0xEF0CB8C7C9A68941, 0x582787B406F0, 0xB3F7B94E869B7530, 
-0x2E23F4D11CE957FB, 0xFAC436046767B2B4, 0x5A19B2F4DCE8E88A, 0xFE0F7E474E434F8B, 
-0xFA27075A97C81836, 0x1C8113267E60F, 0x1FC2F4C5B7466A8B, 0x9CDE6772F765362D, 
-0x9269D4F2A3AC48AA, 0xCFB83E9ED9BDA26B, 0x39741A05637E24A3, 0x1AF0DB8DA95AEC5C, 
-0x101D2F4A993CA, 
-0x6B95FDFB198F06EA, 0x6017C10851E1C9B0, 0x20C162CF2CB26538, 0xC13DF801907E514F, 
-0xFADD903DC4D836A2, 0x5415BBB4D95CFF65, 0x21A42DD74CFB8, 0x7DFE0A77192D495F, 
-0x5DB6C9FED4B46131, 0xE6BE7A51F3B060BB, 0x3AED1BFA58935DA6, 0x70BB56F77487D7B4, 
-0x3464ECB5F5CD3F62, 0xC8EB32B21437, 0x6856AD443B65BD33, 0xE6FEEEF736555771, 
-0xA36A84CAC26D4A01, 0xCA95135707D1CF03, 0x27CFEED2EE18DDFC, 0x25FBE35D4B1D2DF, 
-0x1A59B122EF0B5, 
-0x8C3D20ECC1E8CF6A, 0xF134BF05C99F95EC, 0x51FADEE442FB7269, 0x55DB03ABE33E148D, 
-0x4007388A42EA532E, 0x1CA88834FFF8121F, 0x1B58245E35CB0, 0x7FD4F61682702EBE, 
-0x45ACE219945906EC, 0xF51D5A1023A3FBFF, 0x76111D9850E78B29, 0xA265EA8CE57D1DBB, 
-0x864778BBAC6D46CF, 0x186C704C5BF49, 0x31DE9D6578135659, 0x5FC97387506C1F25, 
-0x7DA1A257081A76D6, 0x6AA43B9DA8C89496, 0x8CD1392BE2966409, 0x76EB8095DDC15088, 
-0x2E40370EDAA9, 
-0xF5C31646DBA23C63, 0x1E954CDCF699D6AE, 0x9EAE78ED4C83772C, 0x46540C942762A6A5, 
-0xB4C47C7DFC04DD7E, 0x263B23DBC75DAB9A, 0xA0DCFB15ABC7, 0xEF3CD9F8446CF645, 
-0x151832651FED8AD9, 0xBF9997B957A5D861, 0x47CC291FCC0D314, 0xFDDA7D8E7A10B82C, 
-0x4A4E5AFA92E34728, 0x989080EED296, 0x9FB38AFC39B5A93B, 0x2D1E764A537AC33F, 
-0x5F185628DA759A72, 0xDB10A3A94C03A4F0, 0xC1B0C09E90BC98B5, 0x951D3A1032715A9F, 
-0x9A7FA1962109, 
-0x4D3086EC23517814, 0x6C00BD189A976820, 0x66D599FFA5335541, 0xA9954D9202BD5B5A, 
-0xF7271C30CD53C026, 0xA3E5E3916FB3992E, 0x189F5186BD9C2, 0x6517E5FF937DEAC, 
-0x6828A4A6E5B4D987, 0x57D2C1A3CBA8B422, 0xF47CE006A49C29E9, 0x62504640305BE023, 
-0x7EA809647201C015, 0x195D10EAAB376, 0x858BBBB30A68F5EF, 0x138BCDC9C16C5141, 
-0xFC8C5567455B7C26, 0xB8732C952F3BDDD, 0xAB31632442EE0A06, 0x3A0245381D1FD40D, 
-0x122FCA4B4BADE, 
-0xEA9412785AB74583, 0x24E00A7153A7B2B9, 0xD2BC39648211F623, 0x9740EE7C97454365, 
-0x1F9A049A41A2C72D, 0xC820C97EFAFAB4AE, 0x1C927B67C13E5, 0x7A213C06469F23B8, 
-0x5057740ECE308B4B, 0x6AE7370503D1DDCA, 0x7247E60EB9446BEA, 0xB61317394C0EFA8B, 
-0xB6D2FF230A5A5529, 0x18A4B78CA2751, 0xC07B2E6240E39E59, 0x4BA0F086ED928D9A, 
-0xEBD78677B7126230, 0xD3A9959937E259D8, 0xC172111724112E6E, 0xF776F0FF5DFF2C77, 
-0x880CBA0C88C7, 
-0x33D4A1AF0B81852A, 0x52D4E025F1385D5C, 0xABF7BEF28D485163, 0xBF46ABB7A0618BF3, 
-0x846AF3411E74A89C, 0xD50FB50598A0043F, 0xD8D5BCBBAC08, 0xBAF31DA7B2D3BC8E, 
-0x657411DFCFE19EC1, 0xFCCF69BC8B442A9E, 0x5F91D3F2320C9F9F, 0x7D539D4D24D808AD, 
-0x6604CB6BB7077527, 0x153730243C7E, 0xA03A2C39BB8E32B7, 0x60E0AC013C3AF8A1, 
-0x6DCFE47D7CEF9047, 0xA8B729C83AE9E66C, 0x709D8CF244D9B593, 0xD1CBBC4D6AB879E9, 
-0x59145171D73B, 
-0x25F5540D995A2BF8, 0xBDFF516A56A90EEF, 0xF13096232BD18F4C, 0x8E50987F2C5E4C00, 
-0xA55E329979035318, 0xB4857E03A4F4C413, 0xE3EE0441D7EE, 0x82205D908A465BFD, 
-0xF5AEB77DC15E07C4, 0x859C48733E1D518B, 0x3C218CF01D0AD2D6, 0xA639A81134E1D2EA, 
-0x5C5439C12A1AE614, 0x760F002099BB, 0xA3E66ECCBB39EC5E, 0xCB2C133607FBBCF1, 
-0xBD1A00C9F9A238B, 0xC0B4B9720675102, 0xF1002B15872799D2, 0xF01D7662B760A87F, 
-0x1F9A118A37E1E, 
-0x9D1F75494B947C68, 0xA44956AB085AF808, 0x97802D6FE9DE9A80, 0x7C0C2F46AA54997E, 
-0x775858E1EAC6846A, 0xD8D3AB4B239D7EFF, 0x5D4AAC8F92B8, 0x2D9ED6EC9F756F58, 
-0xDC91BDACA74B1802, 0x11762AAC1C98B2D9, 0xE4F41F281F740F9, 0x4EBE30A67259B6CD, 
-0xFFB3C75EEFD1FAEF, 0x8AEE69FC148, 0xE1F49A3F6B621FB2, 0x992F2EDF2BE34425, 
-0xD937CC100EFF08D6, 0x6C162861FA27EC85, 0x735C067979E5F5BA, 0x67A70E8DB9BB3FAF, 
-0xDE4A95F589C2, 
-0x47A304EEDC25EFCC, 0xAA577733F1B4FF29, 0x64D9241636B1E229, 0x557940FB5AADED7D, 
-0x184DF10A261A729A, 0xFF63E745F45C6A39, 0x4894BACB7DCE, 0xD39E5021545227F8, 
-0xEB216975C4435627, 0xC861B28A8C44F98, 0x3AD04DCF5D9C66B, 0x900D2C58D714836, 
-0x771B800DF443FCFF, 0x14900E2063F3C, 0xA228BADC577C84C6, 0xFD6C3535DF91519, 
-0x40F6F7124BE8EF5C, 0x5E18564ADC76E1C5, 0xB972920E949874FD, 0x29B178F9BBC50F3B, 
-0x15C8FBFE5C21E, 
-0xAE5A5D25A95567DA, 0x285A8B6A4C679606, 0xCBB751C8F950E8B8, 0x8F2106D4126D4A61, 
-0xA968855B29B05536, 0xE14CE8323A623303, 0x6076795EC216, 0x72A006C906BC8EB5, 
-0x8991F188107937D9, 0xF01370308C26E6F5, 0xDD6A1B9C90752D31, 0x348B3F89D5D4D391, 
-0xDB284B5A9C38333E, 0x1901C8A6D68F6, 0xEF3119BD0EE2BE1B, 0x8FDBE17F23173EBB, 
-0x6F7EBE6070DD6962, 0xA68BB5C452FF2038, 0xC19334398E8940FA, 0x1AF63942829284E5, 
-0x6891C1CB21B3, 
-0xD4AB572A5A6127D, 0xD39457050D392011, 0xE2B9E421EA7E4E7B, 0xEAC3E92EDF5BD580, 
-0xE8DD75F1BF61949B, 0xABB7709A3076C15C, 0x1A23C3622D972, 0xE6B8AF412AFA0F79, 
-0x384E445D23881760, 0x8187D8F8AA442D19, 0xD721C030CA28D4FF, 0x4D00ABDAFE9EDED1, 
-0x8A7FBBC107348139, 0x57758666BADC, 0xDDFE322F4702372B, 0x673C52AA0E6E05B9, 
-0x7AA8508B286624CD, 0x2D94BC4BF71D4BC1, 0xC896ED17C931F3E, 0xA1B81D912A29A84, 
-0x12409DF9B92C8, 
-0xCD98C984C623A343, 0x8A6AD711330EBC1A, 0x3424B011E3C18002, 0x1EE9B9C2E08DBE96, 
-0x5CA59C4964750E55, 0x66ED2298FA645FC3, 0x1D3E5A58E9896, 0x98CF324FA377534D, 
-0xC4A62A66D985D45, 0xF2ECBC2CB237A4C3, 0x5757F06DE9C82690, 0x4ED77EC0A08E97B4, 
-0x7740E6CF640C17C1, 0x1F242E2C93B06, 0xF8408BAB9F55CBEA, 0xB671A8AD4A836B28, 
-0x338E22B134B7A9D5, 0x86536C61EEF82290, 0xF857783114B1CE87, 0x8F44BC9AC00A7782, 
-0x1E0D2FAEF3EEA, 
-0x8F8BC75ECCECD304, 0x9ECF60B9CE46188B, 0x46CDD5B08AE7DFDD, 0xF79EFF5B89E0AB49, 
-0x376E411D74F863F5, 0x57E3A31826763FCC, 0x112DCF55D7B5, 0x3DF4748460D77467, 
-0x9D7654BCE5207057, 0x7041FF0AABC0E0AA, 0x3D6DEE80EC938856, 0xC6878946431D1078, 
-0xB35FE6D6DC2D1ACF, 0x1B82C78A8B3, 0x44362FFFA9527A55, 0x68B04EAB1A39C25A, 
-0xC139C9310AF3CC62, 0xF2E67CDAA6D428EC, 0x359773BAA5D2156D, 0xD8FAA84BAB73F6DB, 
-0x4CBF4E1C744A, 
-0xCCB3AD043B98FA55, 0x715DBB802789EAC0, 0x8ED6BE1053B2C666, 0x54CA0D76B967E912, 
-0x70CD10F546F4E1CC, 0xC954E3FB8D31776B, 0x1F3B89A728CA3, 0x740B1719E398697F, 
-0xEC01D82EA620AB63, 0x4C96FED3C19D172C, 0x934FB6120CD9E36A, 0x5EB927E2593CAC3E, 
-0x15C3530B66143A4D, 0x201C82B950E3B, 0x8332C71B36C04529, 0xE647F34EAF6C1001, 
-0xD51C42864B729309, 0x9390D547A825E385, 0x368A172A7BE7CA0E, 0x67F163963B70F212, 
-0x10B9411BA061E, 
-0xB75CEA14E8EBAD55, 0xCD0F3F6D7D81336E, 0x4A1D0BCE8EF6CE2F, 0x690656AC7465B79, 
-0xE0B52242BDB39A64, 0x5D4A1A120860016, 0x446AEFAD612E, 0xAC130E88E2B251A1, 
-0x7C74C450A58D4C98, 0x67511475788175D8, 0x44E0937118F6490B, 0x33F0D80F883710DC, 
-0x1C37AF6B4C911B18, 0x17BCCE19F1A22, 0x44FE951E3EA7B422, 0xA37C96B6614194A7, 
-0x663566ECB3A670B9, 0xDB5AA797242BBE8A, 0x85765DF553478A32, 0x552F5C1387F5B935, 
-0x2F7E383D0281, 
-0x5B1D909A1D22F0B2, 0xDB6AE2E5F0C2469D, 0xF74558AB50FB3BF5, 0x154847EBA22E5E8F, 
-0xDF3E1EF2A9BF48E4, 0x6ADED035F5649E2E, 0x1F19249B8E7D5, 0x84658631FA851F63, 
-0x217EF19B9F62FC50, 0xFCF592051774D2BC, 0xD79B50C9C2D75952, 0x393DAE0EE90E8E20, 
-0xB71E39213E97AAB1, 0x1262CC187E0CE, 0x79D9E7F932141641, 0x7639FB7FB131F51F, 
-0x79C49DAC7D3512D4, 0x915BC4FAEE7F39F3, 0x5E3403184435F08F, 0xC6C04BCF7C8F5CE9, 
-0x203DA6FEB58C3, 
-0xB54E68352B16AA56, 0x726AFE527C3209D7, 0x8037213488E211A8, 0x926579A8E1C41167, 
-0x936A8578517C693, 0xB6094904A09E8932, 0x10F2F4DF37539, 0xA42DBF0C7BBE8C0C, 
-0x9E3D0572F30A7EC0, 0x958C284486BB2C31, 0xFE9A44AF1AAF1931, 0xEBC35815D4A3DE77, 
-0x2A902A2986D193C4, 0x706F41D2C990, 0xCC914C313DAA1B52, 0x34A98BE35393AEBB, 
-0x20478AFB9494E54B, 0xA7830B7E069ECA18, 0x8E27ACD1C95D1EBB, 0xB042E13019990214, 
-0x1B3467990E7D5, 
-0x4C879446AD89A0F4, 0x5F03339E881BB122, 0x76AB32F87E2B4A73, 0x9BFC1591917C6568, 
-0x131A24702B68B174, 0xE41062ACF1CB8E98, 0x18B9AE88074F5, 0x2979312D32D7ADD2, 
-0x30C1649BE4A55B81, 0xB593AE42E9EBF589, 0x173ACED58943734B, 0x150B4709F9F73D3E, 
-0xD41518A83EFAF304, 0xD6AA71339E88, 0x9B9BEE62A1EB5CB, 0x473C3765357B54E0, 
-0xE08CB24BA9401EBD, 0xF69FB75E4308CED1, 0xEDEA732AA51A8771, 0xFF1EF086CA012D76, 
-0x1D476F189D18C, 
-0x5BC49A2A33C527E1, 0x455DA56B94F359DC, 0xFA68AA5C806E9E7C, 0x3656F8F1D6160BCA, 
-0xB627B2F48AD0458, 0x2A54FE52684C611E, 0x1E7514D786FC9, 0xF8910C76C5722BF7, 
-0x43873F26741BE24F, 0x116598E0387BD97, 0xB62A89ABABFB39B2, 0x4412F8675A974D4E, 
-0x2D2AC3EBCA63D259, 0x5A71ADC0A137, 0xC9AAB50AE538DE81, 0xAF2FDDCDE2885ACA, 
-0x5F3CC951EC11EF78, 0x4AB4773977EBDCCC, 0x3D5473A135928727, 0x177685722E1135B5, 
-0xF556F19747AF, 
-0x8CB8D09443DFADFA, 0xCA7CD18E4F45155D, 0x4E857012ADB175DA, 0xCDC75DE5FB7DE487, 
-0xB5DB6F89E4824D6A, 0x78AB97D77F87E161, 0x6AE71D61CC38, 0xEDF92FCDDC0F69B3, 
-0x22054E33CD29F4A1, 0xD20E17E22F89900B, 0x46783A48D792E6AE, 0xACAC5FAF24B1A769, 
-0xABD83E01456862A4, 0x18E8F7AAEDFEE, 0x5D8B3B4E835525F1, 0xD338EBD33639C7EA, 
-0x439BE49F066EB03C, 0xBB48764247230B5F, 0x68885BC65E6DD646, 0x8366871A6615AFA, 
-0x17D55D26D7B5C, 
-0xC6E164E0CB86B86, 0x2785EC516CD9DC4, 0x52DDA332B2D4E3CA, 0xC8A390FE25ACA3A8, 
-0x5851C18327D0EBAD, 0xD6E9CFAF53E78D42, 0x6D3B17E9BEBE, 0x3DE570ABE75F4D2F, 
-0xB30A5CA799365E26, 0x55DE6DC64986176D, 0xC1CECC6644E8A5B2, 0x72535EE49093D6B, 
-0x9E520F8C201664BE, 0xC19A9E893A1A, 0x840878E7219E743F, 0x39DB68F53EA7EE4, 
-0xFEC1F26B24283D94, 0x228AE2231A867951, 0x2AA22E1920FAE30C, 0x631CF651608C7D09, 
-0x1C781F804340C, 
-0x89AF5F30FE5DB82F, 0x16DA0567B94B6C12, 0x51DDB36C8B590112, 0xEF13339C8A11EB54, 
-0xFD41FD0D1EB1AB0B, 0xB2B9776A2DD95AEE, 0x1A33C3DFB5615, 0xBC42B82FFB15445C, 
-0xCE0E1FEE0B5CA92D, 0xEB0ED23538AD67B8, 0x9021B731E7CF0265, 0x8DD238A3B7D24098, 
-0xC5648D6365055936, 0x1EC9AA7DCAF9E, 0xBEAE19C66BF85F15, 0x3FB7AFC677C35AAB, 
-0x49065D3A134765CF, 0xC23095116FF27C49, 0x2777F1DE183475A1, 0xAFA644C81E3AD290, 
-0xDD63CC92A3DD, 
-0x69F8646475D9D40C, 0xB05870F3D6337E66, 0x30525F1BF313D0D7, 0x990A57F173D2868D, 
-0x99D59B478ABA7247, 0x39A25EE6DD42587B, 0x7E8DEECE72E2, 0x47473EF7D079A9B7, 
-0x38EA88EDEE3B78C2, 0x25AF458653A2E42D, 0x546BAAF33FC4B816, 0x8F0BE7A87F5515C4, 
-0x6225C049D0F7157B, 0xBBC857AD71E5, 0x941BA3DB7B5E7109, 0x7626E2A7BAEBAFEA, 
-0x7E30B54679B13EA4, 0xE6C9E151B01BD742, 0x763150C8A5416F36, 0xA1DF0825EA859573, 
-0x173C262DA53E9, 
-0xCBE7A2E3F12BD2AF, 0x38A5CF8941774553, 0xF04ED3214C2D0A6B, 0xBA477913541BA068, 
-0x80D8B1058895E364, 0x1CA12EC144119424, 0x406D70257429, 0x805F4FA0A1B9A0D2, 
-0x5C915B6DDA337589, 0x78A688BB9BEC018A, 0x220A64CE49070E09, 0x822B601B4C602932, 
-0x3CF4338ED857D0E1, 0xEDF1E2D64EB6, 0x3049ED4FBCCA2B6, 0x9F97CE74CF6A0C6F, 
-0x3460BBA3DDDADB53, 0x5AC9047E9EDA8087, 0x8924B07EEBCA67AE, 0x5D4FF1098EC592CB, 
-0x20683A60CB246, 
-0xE0220A65831D96BC, 0x62781468636E629A, 0x923C182863EEA071, 0xEB3CCE42F254724E, 
-0x1BAD92D19206238E, 0x17A8D9454BE6F478, 0x17EA83C22F718, 0x7797D6B17F965EE0, 
-0xCBC25447398034E3, 0xCB205BD37C27AF97, 0x5BC8EE281BDEC6B7, 0x7E1DCC13605C265B, 
-0xB4FC4F8C2E95811D, 0x21664A2B8B5BA, 0xF44C7EBD00C514D4, 0xA3346FEBBDDC894F, 
-0x88F7BC7AD27D590D, 0xB303B8213BFEC2DB, 0x6865370B74E9E69A, 0x3CC0C76CA5778890, 
-0x1E340865375C5, 
-0xCB3E322B047C0B52, 0x51CE9AF6214AE413, 0x9F732D883E2EEE2A, 0x1C7FF250E06968D1, 
-0x96BD3CE8129FB084, 0xFDFAC3BED2B6BE46, 0xB51460F511BF, 0x43358239BCB9EE8B, 
-0x954D916CF3DE60E4, 0x16A181718FAD4B6C, 0x82D6FCE9FC51C00B, 0x53635F8773B8221B, 
-0x982338FDAF574CF6, 0x541661AE3EC1, 0x8B9DFA88821814BD, 0xD323DACE14D90038, 
-0xBB151CE900F4F04F, 0xE5965701DBFB7B81, 0xF716FD89448F6DE6, 0x5D39EF230E82E562, 
-0x1F352D096732A, 
-0xC009B1A980F57387, 0x2C17F75C29D640A6, 0x1BC001C4BC28ED9F, 0xA3AA7F06B184047B, 
-0xB18D93BB27F4C894, 0x9AA4E60DEE025E92, 0x1A342E3621D35, 0xD8D5488AFB0DA019, 
-0xB416982D249FCD83, 0x414E7095EA3EF950, 0x3ED9E9B782DB6C05, 0xD847946C62FFBE5D, 
-0xC31AD91FAF41FCFE, 0x2FF07899934, 0x1893AA083E982B5B, 0xBF581580CA989436, 
-0xB92F0EB9CD6FDFFF, 0x8A03B49F9D71E9D1, 0x67ABEEEB37E9DDC0, 0xCAD9F045ED162083, 
-0x1CD80808D9144, 
-0xCB796E0CE98E1998, 0x2453827DE907DE8, 0xC1BB6DE08F5AB030, 0x81144E89614B8950, 
-0x983AD46A8216C3F7, 0x752E7DD502FE5018, 0x1B1EE574691A7, 0x26DE6FF4EF164CCC, 
-0xE81A5570D7805943, 0x84709D92BB34B34B, 0xA331BD7A3EE7B937, 0x6528FEEF6E90CE23, 
-0x3032B937B08E2A94, 0x146D0222534B3, 0x8803BAE9FA5F7D94, 0x11BFCFFBF13ACBEA, 
-0xA99BFD280A998C8A, 0xBB699A5B897DE5E3, 0xC4B1EC7D6518E2E6, 0xEBAECED2971DF74C, 
-0xF84F5239B72B, 
-0x366B7EA1C6BB2140, 0xA92A9D2DBD65E4AB, 0xF2C72A5E4F043D22, 0xEF50A12F47360366, 
-0x2F7F76B221A8CD85, 0xAB4180B4D7D4164C, 0x1542523BD673E, 0x9FF5F55B6B14EFAA, 
-0x354F1E30449E7FFF, 0x3B174DF521ACA39, 0xD609F4C8B3229347, 0x8AEC61429EC7BB6, 
-0x7FCF152C33B6CEFC, 0xF033CFAED7A0, 0x8D5A5DD7C6FD139B, 0xCBDCAF19C7B5186A, 
-0xC182B53C1C068CA6, 0x23505BB5E9E621BD, 0x3CA22CB43736C6C2, 0x12F7B0827878F9B, 
-0x1453FF079419A, 
-0x312F855212002BBD, 0xFF4F3C97DFC2253C, 0xAE7E1D3C0B01C2E9, 0x2F852E17DAE984BF, 
-0x60412AD6066726FD, 0xC70C7186641DC123, 0x1834DE952FBAF, 0x77D5985CEDDD0D16, 
-0x896F81F196BFF169, 0xB22CE55B277F5B29, 0xD53C289B2956AE7E, 0x7E5515D0A2D8A21D, 
-0x923C02BDB76A9749, 0x1F050A03F3553, 0x2B37D45B35227170, 0x8F89D95DEAA0148D, 
-0x64BF2F150CDE18B, 0x452585C9B36C414E, 0x228ED0E01C66F34E, 0x9E7D87034F27E7FF, 
-0xF08F7C717179, 
-0xFABD9AFEDF4A67A3, 0x65FA193B0570397E, 0xFA363B8E43198807, 0x7E00117DAEC14326, 
-0x8A84D9132515AA75, 0xC90641152A31C6B2, 0x7BD95835D0FA, 0x7E0CF3E34F3340B, 
-0x842AD80BD1135404, 0xB433B271343B66CA, 0x6319CE48F3F19EC0, 0xBC06377C5EDC1F08, 
-0xDEA658F0245BB295, 0x115156A25C72C, 0x7A2ABD0FCBE0D709, 0xABA0CF2F46441FB7, 
-0xC78B68E63C8F168E, 0xB6E6DFC3897EE0AA, 0x1D39AADDC56FAACA, 0x4D16B082774510E0, 
-0x739DE70F4EDA, 
-0x91A758A749ED2CC9, 0xAA12C2679CB50096, 0x60FF52B79D5FDDC1, 0xC8E7A1C9845B3EA1, 
-0xD3CAB86BA1B1235F, 0xB2F9E87FCB77C7C0, 0x1259361C11DBE, 0xD98815F744673D2D, 
-0xF6DB2D8FFEB5C5F3, 0x32F3A2FD336289E4, 0x136A1DD0394C9BCD, 0x7E7256AD3027B8EF, 
-0x11D3CC397413B121, 0x1D12C4C43A1FA, 0x65F258B388380983, 0xDF2856CBD5354951, 
-0x7EB09017CB5DC89B, 0xEDD96DD547AFF391, 0xD7F1F4B9529F1BCF, 0x8BF24EA8B9D35E03, 
-0x122BD01900CAF, 
-0xB58435C42B445EA8, 0xFB277EDDB98F9406, 0xDB226A156FEA8A79, 0x54FCA892B640B6D3, 
-0xEEB3B41127AF3193, 0x8F5AEB945131B825, 0x18A6A1EF221D8, 0x16FAF5854C18C39F, 
-0x7DAAEF9B3DFDA298, 0xC0BA3C887373546D, 0x994D52D19781B819, 0xCA357E423B77C1F2, 
-0x2D6DDAAF64CC875A, 0x137CB3ABD274A, 0x3A7ED4D98DE7B16E, 0x58CE378E227282C7, 
-0xD51A961EEC2CF335, 0xCE9F63644AAA7D32, 0x1136845511D7723E, 0xBF91BF9BF2498681, 
-0x160DC78B94D27, 
-0xD4E6BC1A0506D9CF, 0xD2EF00FF38B88804, 0xA925230F9A33BF97, 0x7688AF5A33A01AEB, 
-0x62D5051A31674ACB, 0x982C2A41158192B5, 0xEE92EAF8C22C, 0x7B03854F051DE589, 
-0x620EABF7081C1694, 0xDA6D7ACEB41EFF1E, 0x8C3EFE3FCA877C42, 0xABE82094C05206DA, 
-0xE6467DFE86C943BE, 0x1E981FCE9C4AD, 0x69D6B6D1CBA1A21A, 0xF6D69D6FC6CB1746, 
-0xB118E174CC344D6, 0x174148ACBD1228E0, 0x7C8CDEA0C8B2AB50, 0xE9BFDB4A8130ED30, 
-0x105B6A14DFF0E, 
-0xF059FC459D5E7C19, 0x29EA4F7619FB14FC, 0x898932A92E602C18, 0xA2CFB8FECC165E4, 
-0x48F93481001F8B15, 0xEB86C11F38AC648, 0x460BF51CEF1D, 0xDF088AE5987193EE, 
-0x3E923DBED0C6C7DD, 0x5D5AD459EF1C471E, 0x457069CF8EF5554D, 0x87FDA1CFF6050221, 
-0x3233D812A6E46279, 0x165ABF63939DE, 0x583EF502E5536F6, 0xEA6AB7FE41ECF01E, 
-0x18FD0B025AFEAB91, 0x3A481B88B68DBDB8, 0xE4DEA0E2B3BAA4EA, 0x3254D3C77534AF1, 
-0x1CB921D9438CC, 
-0x8DFCA9F10E122B30, 0xC604E1477E74DB10, 0x8FE626BFEB7ADFEE, 0xB2A20EBA2097798A, 
-0x46CC10B723102646, 0x9EC525998D16209D, 0xB9C9343396D0, 0x9364A17E1A86458C, 
-0xC762F255026E40D3, 0xF766B9AE6E352C2C, 0xAC8DF26B05CEAC7A, 0x22F64C0BC874C96C, 
-0x30084318BB06C39E, 0x2134C9964D2AE, 0x963B2169A8453A26, 0xD779A5AB20F29DBE, 
-0x4E1E426015DD64AE, 0xB8526EA06B09E49C, 0xFF7C2F56AB950097, 0x8C430ABBC47A1D09, 
-0x1BC71DFD92BF9, 
-0x8AE68FD81318FF8E, 0xCE68E68A7D23B6F6, 0xF85027A10F3D8A06, 0xBFF1D4DA1162C718, 
-0x386E6C2945BC6C96, 0x4DCD83955C76A5EA, 0xB2148C329ADF, 0x80C4BF1D4BB4F60B, 
-0x150EBDE869D79B1F, 0x373DFC572D08C0E8, 0x8154339F754F4F02, 0x4E8A2F393E8BDE5F, 
-0x5019304549E4917A, 0x59AEC46DE6AE, 0x7E91710BCFCC75F9, 0xCBB7706C172D4B90, 
-0x2921D427A15E4974, 0x64F41786CAB58F78, 0x20C78A53B36EE626, 0xF7A2D537BA4C557F, 
-0x6D8AA373C0D1, 
-0x9FAD52B0D8F6C552, 0x28C38E9E1BC330AA, 0x3A16F3990B8720CA, 0xB0A93B526D2958C1, 
-0x3C809F2607873AB7, 0xBDF20D45CD1A5F27, 0x128A133AEE011, 0x43A1D6D930B83D47, 
-0xCF3AFD93B53E8F43, 0x8BF28AE8D9FD20F8, 0x7958A33D58B8F7FC, 0xD2B2AF55CD29A510, 
-0xACA93C0B0DDAE739, 0x1E09AA2AB9232, 0x3BF0A2E02E4606F4, 0x91712125C0F37D67, 
-0x15C6593DC04237C4, 0x4F33C4A41D9AE336, 0xD69239226F811C74, 0x4C8E750043CAB269, 
-0x1361F06226DC7, 
-0x2CE80A610D7A01C4, 0xF49AC9929D995C3A, 0xE1C5DBF88F73BB66, 0xD0522E324E4DA59F, 
-0xC1DF5BA5852D08F1, 0xD8387847D74CDA8A, 0x12B98E448C6FB, 0xD49D8BB583AEF9AA, 
-0xCBE7960B2A8C6301, 0x45F038BA51ED2867, 0xFD31F01690C7AA03, 0x6A2E64DA831D6AA2, 
-0x2F70F15FC28EE344, 0x11282310A74A4, 0x33883E9822B178D7, 0xB175CE8866D94306, 
-0x87A0BCA5C92133FD, 0xE2A8BC975E4882E9, 0x79B99BAC23B9298E, 0x83512685AB58BE08, 
-0x4EAA03BA6E94, 
-0xCF1302E6FCC960C9, 0xD3DE8806AAF27ABC, 0x63BDC94A62C1FA64, 0x71CF3A2C3A8106B1, 
-0x913F62B8D5F93D3D, 0x7F132D94851A571A, 0x1839C4EFDE7A7, 0xFD672E133636A0FD, 
-0x83B8575BE225F3D5, 0xA9520DCC5DEE0E38, 0xE048848B418092C6, 0xE181374127848EB9, 
-0xC1E10A7DEE271287, 0x110DFF41A2F4B, 0x423B491EBFF0F6F4, 0xD294DD9137E4DE57, 
-0xACAE1FBECC4EF057, 0x7D27002876A6A328, 0xFC2A204358081BD2, 0x31BA3B73AEB96744, 
-0xAA901DA61B35, 
-0x295741240979CDD3, 0xCBC36ABFF5FFD5E2, 0x6968A0D2945653DE, 0x34C85FF22BD40E47, 
-0x936F8FAC926C2F5F, 0xC0A8FD3640A9B7D0, 0x22AA5F5EFC93C, 0x7AA3AE0A1B7B9F4D, 
-0x9D1ECD81EB4EE358, 0xDBF0EDAA1910588F, 0x1C051C3DC24E1129, 0xB481D61993B91574, 
-0x1C21851CFF912C15, 0x116912EAF3B86, 0x77C5002717E014D5, 0x8FC0ED74AB085511, 
-0x9C59BA94DB253CA2, 0x93CC461E711B39A9, 0x79AD68279F13D5EE, 0xE6EC95BFA83F5A5E, 
-0x5953CFA51955, 
-0x20BB6C661BE9941C, 0x79288470604DDFD9, 0x5BB4CD7338A15423, 0xF1A3F36D2B60C879, 
-0x4527216B63D525D, 0xC57A2E113CE87E5E, 0x1416BE1523484, 0x6804569C431AC569, 
-0xF1453936A2B5A337, 0xF625497E63D9B436, 0x2158F31AA0434E3E, 0x565B25D09C722074, 
-0x997EB591055B3E67, 0x31FAD984FB8C, 0xE39936CFE164F744, 0xE418145957D6DF5E, 
-0xB4756BE12D455C67, 0xF7A1036563948A87, 0x6F07864F6DE0CB89, 0x6A8E60E4F309A78B, 
-0x17B87BFFFA072, 
-0x8FC0E2421F35AC2F, 0x237D64EB7C7214C2, 0x36E8BE4635613B9E, 0x36D2E119301B9662, 
-0xAEDB450F75920D5B, 0xCD70E3230A445927, 0x1096E421B1A23, 0x2EB9DC8FCA259C8E, 
-0x4741FEB1E236D52D, 0xF521BA9C322B1BBB, 0x75C158F34D0937F8, 0x9172BB357F5A5256, 
-0x58A2B1412A689C10, 0x1BE807E18FB22, 0xCF6B4734185AB3DC, 0x53192E442DE5A368, 
-0x91FF759B7028E89, 0xABC2C4983D4A04E8, 0x58159CBB77BDE370, 0xF212007DCAC0C80D, 
-0x2185DDD852AAD, 
-0xEF70A3CC55641149, 0x967CA1AD3882C893, 0x6B33B1D11F758EC3, 0x152EA046E394528B, 
-0x4C189D4D79E83F71, 0x18A0FF8ED0402DF4, 0x3C97A67D5BDE, 0x665F8640B6D82C30, 
-0x3143DB436D9C0885, 0x6FC63F5C7ECCC08C, 0xA1907E5B3A6E397, 0xF5A6395ED921A50A, 
-0x9627469D7C9EAB0B, 0x21AF6720095C8, 0xA14775FCA7632702, 0x41CFE8985C682454, 
-0xC8704CDFB044F266, 0x3737655BF76FA233, 0x1B5E7F184B796C77, 0x375AD9AED949CC6, 
-0x3BE20E8FB77A, 
-0xBDA9168813B96D87, 0xEC55198091DEC30D, 0x706D49EAE61F53E1, 0xE4D46424D324907E, 
-0x1758108294DD7A28, 0xDD88CD15A0E6373, 0x3D137B9FDEFF, 0x5C3F208F9CDA5CDB, 
-0xF49C42B4F546363C, 0xD55B20C5C6E8F9B5, 0xA4EFB6F0AA58A5BB, 0x55D3765DC2F0E18D, 
-0xEE3A37CB5787B7F1, 0xD3E95D7113E1, 0x43D5DD45698CA991, 0x8D1D212F6B0BF9C1, 
-0xD3B06E3FFD71651F, 0xF0F38395A2E4338A, 0x7325F9906EC941B8, 0xB1C984EE0B94A2AD, 
-0x5D2F9436D067, 
-0x9876E267CAD5D0B, 0x369820CCB1E3705D, 0xA58C9FF4C9E4FD90, 0xC505F439471844D6, 
-0xDDA28340927E3C1A, 0x642BCFE6432F75FE, 0x1D142F181C22A, 0x1CC3C750177EDD19, 
-0x7E5E8B4EB69E3717, 0xD55822D37AFB3657, 0xEE181B9AFD6C39BD, 0x753E9B9B9F867963, 
-0x353F7DBFF083C398, 0xA738E0899E0D, 0x7F0C997933193517, 0x3C169A33FC859D35, 
-0xB1E502220307E235, 0x13E4AB5C3E6E7579, 0xEB6D769114150C12, 0x914AE707CE24BC57, 
-0x14EBB9A365537, 
-0xC849D4249AC55C9B, 0x324944E3E10004C0, 0xF5D3CE0C5F917FB8, 0xF7DB0C3777DCF392, 
-0x878F33EB03AC27BC, 0x3A094C2F6C71D90D, 0x137C24B40A2A5, 0x79EF7BBFC6326FB4, 
-0x6B79FAEC29C748A5, 0x280C90C4DF72C810, 0xE762F9C62DEE647B, 0x8710B6A695875247, 
-0xE6F2417372E15933, 0x7325B0A90262, 0x76023DDE0B3C45C9, 0xDA80C36A5B058EF1, 
-0x61772146DDE98F62, 0xEB521DAA58325F3C, 0xE62DB54591569BE9, 0x4FB14D268E87B617, 
-0xBFAA858B5CAC, 
-0xD2FDA71CD6388DE2, 0x2D408E9E9B247A4C, 0xDB7F2C04EFFA8EAE, 0xFDC2CA4E729F805B, 
-0x175C4078D39359E2, 0xDAB3A1C00F507F93, 0xBFFAA4968B8D, 0xF5A069E4775B551D, 
-0xC5503CCFCAD46C15, 0x5F1AF37C3F8B60A2, 0x66DCC26082CD681A, 0xDCF73F5AB7F6D4AD, 
-0x8F65738577390291, 0x1D40AC21E2030, 0xC3897B3261CF14C4, 0x3C5AEB9058FFE92A, 
-0xEE28E88171BC692E, 0xCE29B0E457848DE1, 0x5B77FA55F86151FD, 0xA53F633F7B2A2FF, 
-0xA749A6A7993C, 
-0x94096C1192111C18, 0x92BAC2563A52A2AD, 0xDDD1DB27D96E9881, 0x134A0744E53F2956, 
-0x4069D678315DD3EE, 0x81C46DBB8EE966C4, 0x1CD4DB8C55F43, 0xAC6F5BAADFCFA3CD, 
-0xDD7972CEBC2EBA1F, 0xDE55A94CD7D41699, 0xA3031317A9136FEC, 0x62F871427A776DA5, 
-0x19C876B37CC7EA89, 0x25136D54E3D, 0xDA45EAF296EACE4A, 0x1217EDDBCF733A0F, 
-0xB0050A8AB0D2C513, 0x3EE84B7F42E3104C, 0xCA1751FE63E71DBC, 0x3630556E48E9626, 
-0x12E8969607A61, 
-0x5F7A02B2FFD4DFD3, 0x7F25C56FE246A155, 0xFAE2E2343FDFC80C, 0x7CCD8C216795CA56, 
-0xF9C881FB8394AF1F, 0x8CA40930975A6FAD, 0x9FD6B7A1943B, 0xC515BD1C79D60253, 
-0xC462324BDB4E0F63, 0x6901D5F40BB48D34, 0x5DF97FD6046FA89C, 0xEB4DF411FE412AFA, 
-0x2F5A2BAF590B7D5A, 0x1139AF00E368C, 0x1C0F6B3DF1E1AA08, 0xEDEC8BB8AFF6BBEF, 
-0x46C5E8384B1C01EB, 0x9DC6E47861082462, 0x1C5E6D030E74DBBB, 0x45A8D55B85A98603, 
-0x1673DAD08B73A, 
-0x66BB79D307EDD27B, 0x65B9388F35A3051, 0xFC846D0443F91DE6, 0xE9771ECBE3C2C72, 
-0xDE554752E479B0A6, 0x6E6B42C06E717B2F, 0x2104149E55743, 0x33D0C31CF4803657, 
-0xC65DC5540DE4052C, 0xD78980950F8E7B66, 0x7CDD74D2D7DD30F3, 0x107DC282BAD401FA, 
-0x145573AAF347598, 0x38001793CB89, 0xFEE97C11E4835D60, 0xE8E826BDAA55AEBD, 
-0x74F995281FCDFB82, 0x16E830B445CA62DA, 0xC564C8BB1C6CDAAE, 0xB3A7048E5B6B9CC6, 
-0x217B322EB51A6, 
-0x43B26D8D6BCB8D11, 0x6A79CB7C8C18AE41, 0xF0740C750D60DCD3, 0xE25D588B4F9F292D, 
-0x2A51D108A80AFFBA, 0xE765DEE69EA0960F, 0x14C79D62E4C2F, 0xFB17A7F5F253C45E, 
-0xF70A4B0BDD1A9716, 0xB0C84B1EF04E5D7F, 0x724D4218B86180C7, 0x272CDB21CF284402, 
-0xDDAD7A672FD500F7, 0x832D8FE385D3, 0xE6C8BBEC7130D409, 0x93D4182C185D9DD4, 
-0x50B04234497EF25D, 0x17F5FE346DD2D20D, 0x8E5C867B70EE1B0D, 0x9A1BA122E655DA54, 
-0x1AD57F922AE94, 
-0x8505208D4D1925F4, 0x23614BF8EC569A18, 0xA0F3DD01795B67EC, 0x3DAAD5235ADC9587, 
-0xC9B9F39B8CB473EB, 0x97B823168B399C09, 0x21C95123EB9E9, 0xA8151E9E667AD66A, 
-0x544F42BD2FF76EFE, 0x44929B0AD062C635, 0xDE61BE63DD0FB3BA, 0xAD39A11C2D7C1849, 
-0xBA34B4E2CDCA42E2, 0x51EFC24AFE0B, 0x8A63DEBF6E79003F, 0x2B0E8D653029188B, 
-0x1A8EF1279EA0E7AF, 0x1DB28F677E8C9807, 0x7BA8E8A5718D7F7E, 0xB83F1FA6BA960047, 
-0x4CBCF5FAF783, 
-0xC007F813261216E0, 0xB0CE64508DB5451D, 0x278BFA7439801BD9, 0xFC26C2D728C3A1CD, 
-0xD7F0DADF63C3EB69, 0xED81AA717FB0900, 0x1675C54676CBB, 0x14C81BCDE5D8D693, 
-0xFBE7A90DBFE9C40D, 0x91A78244777FD37, 0xC9A24010812329BA, 0xAF25DBA1954CA774, 
-0xAB80273A36A3072E, 0x6823C4E62FEA, 0x1854D9D3DE12AC06, 0x950E56EC477A9A10, 
-0x515CEB5F27192A64, 0x2E3DBCF3D2A3E506, 0x3792736898BC775B, 0xB2D53ACD7A3FDFDA, 
-0xD5AC84CC3BF9, 
-0xDB5583B49E01A4FC, 0x9078DB10146D490E, 0x4C54355276D1CCBC, 0xAEFCBCAF9729F800, 
-0x115BBC1E2FAEA91D, 0xDF3913E9EBD3B6CE, 0x122FAB30DB591, 0x1B82D67CE37F7D83, 
-0x1F938EA6F4B4CE70, 0xA9185D0DAC200CED, 0x88773CF4ABBA02C8, 0x786F4AAEF81BE4F8, 
-0xDD360DB461542FC7, 0x1F83D6AE483F5, 0xE60CB0123964B39C, 0x9CDF42F3B4D9DC79, 
-0x97F344AAE7D7A968, 0xC5709ABFCE7C3D10, 0x7434DB25A0662316, 0x3BB07EBA168D95E3, 
-0x2099B9F07414, 
-0x1DD958CEB4AA4751, 0x2340FBBC032B74E0, 0xD3E4CB4BFAA06286, 0x3675E354980C1DF3, 
-0x1451B8B92D3704A6, 0x9DAF8FCB9760CC13, 0x1B41D32DA8F4C, 0x73408AF8144574A, 
-0xE952D18E82AC29F7, 0xE2901AD2A80F51B1, 0x46E0B653E6A0D559, 0x9236F94C1E86818B, 
-0x8BC0610353B2FAE9, 0x6C2CEA2F2CD1, 0x36CE8798FA3FAA96, 0xF2A2DC0879D24EA6, 
-0x52147E57E273BC20, 0xECECE12378A35034, 0x5D3CA219DF669020, 0xABE1EEDB6F9393E0, 
-0x51727C9C1D10, 
-0x163A6F23773EB673, 0x9253ADBEC7A2FBC9, 0x942183A38FC63659, 0xB7F19C7E3C901684, 
-0x95CE00C1778FC810, 0x942601DFDD26EFBC, 0x1DA11DEA9BC91, 0x48104AE1C2DEA44B, 
-0x8F4D02641BB51F40, 0x55A1DBCAE9199FFC, 0xA482E611EE9552D3, 0xBE249B1650BE3F92, 
-0xB5A44E1D2BAE3AEF, 0x10DC35631365A, 0xA1E5ED4F4AC6C43A, 0xD7C9A033F90BD3EE, 
-0xD32F128DE3CED018, 0x9E635A51B8B98055, 0x3F495DD5E29B1D52, 0xA5084E966212FBCB, 
-0x1F893AB529EBF, 
-0x916E585CDED1F0B7, 0xA391BAB711F9260A, 0x26DBEE77FAAAAFB4, 0xBA5A8EBE11204C1F, 
-0xC235F839819DA4D6, 0x9654A39C4FE50A6, 0x1B1888CDFD0EE, 0xFE77E9C14C910E4D, 
-0xE611CC89FC7D8E15, 0xF4B94D8C4D02347C, 0x340D42F6DEEAB600, 0xBED598D503C7284A, 
-0xD62CDB3DEFF1C42, 0x1DF579041858D, 0xD142547B46A05359, 0xC8511663CF8E0216, 
-0xE1E521D9EACA9D28, 0x83ECF1E901A5B415, 0xBDAAEEAB08D0C9D3, 0x4878C02B76FE4B8A, 
-0xADC1F4AA15D5, 
-0xA94DDCE6BD3C2F2A, 0x8398B09749EE70BA, 0x8F5C8E4AE529832D, 0x4F911F1DC4FB9959, 
-0x376FDA3E39F09914, 0xE7417078E4A933F2, 0x11BF22D1FF40, 0xF618423B5C596EF, 
-0xDA01D6C09B33190A, 0x42879A1B599829DB, 0x7BAECAB77CC5E3BD, 0x528A77C174E333D8, 
-0xCB83306990AD21F8, 0x7F00EF1BD60D, 0xD52BF021AF365A70, 0x424EECAD136DA1B1, 
-0xA123D915C8B5ADAB, 0xFB0E0D1FCA587DB, 0xFD4D32336C3C5EF5, 0xA75C8802359E930, 
-0x8731E3716B59, 
-0xA7DE48762D9F842D, 0xFB4E7941C41B7D6B, 0x78B57B073C2FEF83, 0xC655133342277D89, 
-0x5483B01E3112B6CD, 0xCBA06AFBCEA1A95E, 0x1875716DEB46F, 0xB1AE5C4E0E68887C, 
-0x5231F572D44F4A34, 0xC32F422E9EBE867A, 0xA7BD524D72DCC1, 0xA7B4C3C27602E660, 
-0x8C3CA1E1CF98C7B, 0x1CD9A37A01A56, 0x701EBF3D403D4F2F, 0x94E79BCC53DF0BD3, 
-0x5C64E882FD2740E3, 0x133DEC3393CBEE4B, 0x291AA73CA0D75449, 0x6D68CFFF9007C093, 
-0xCF99BCA824BA, 
-0xB6F77B28C09EA029, 0x107F7F9B63E596D4, 0xA9FBFECB076F93D4, 0x89D16E669799996E, 
-0xE91EF340BCA4AAA5, 0x274D35C55D42953F, 0x1DF062D5B15D, 0xA7BD278EC8B69C20, 
-0x249FD22324875C34, 0x5EBF0E43967A0E17, 0x9F80EB7F08777200, 0x12F5343E641B8A49, 
-0xA4623F96C1AE4EAF, 0x184C2F2574689, 0x72E78B4D0EB8003B, 0xBE4C176D97CDD61E, 
-0x61A3E57598D7CA2A, 0x1AB9E0DB1E4D7427, 0xB9DC3FE3D68AC4D0, 0x356552411060FD59, 
-0x1505CD1BF29B, 
-0xB57357B8031A6C1D, 0x41B255F8C0284357, 0xFAAF24BC84527E6F, 0xE2FDE8523BFA8135, 
-0x982704A24AD1D261, 0xCCD5F3C5DDBFFE46, 0x160C1CB04AD14, 0x52F68440950C0FD6, 
-0x4E50B57B336EDD13, 0xD764CFF41CE02362, 0x65A9D9F967ECD99A, 0x37C6F9B26548C360, 
-0x96B38E0B818C8026, 0x1C64272FB2BDC, 0x9396C496BC5943EF, 0x98F8FBA93C8D9448, 
-0xAF7C9ABD3FFEA3A1, 0xD35C7D6586882ADE, 0xC511AAC584F7DC5B, 0xE4059996C6A2B1E3, 
-0x233EF293865C0, 
-0xE2F30E271DBCF02, 0x1C3901B79F9A0A37, 0x80A09160EE6175CF, 0x233C772144C7CD66, 
-0x66FDCE2F6795DD6D, 0x8F475229DA3BCF88, 0x182F276735452, 0xB1B721D87A281A3C, 
-0xA1AADB46609D8727, 0x8E53432E02C5AD35, 0xE32D7155D62D1252, 0x602213EA3E42CFC2, 
-0xB8070F3E83BCE3B2, 0x2088189A6BAC6, 0x110239F8D5285CC6, 0x96D8C3F0DE9DD91D, 
-0xEDD5AFA6B99BDC86, 0x81A738EC50BCC076, 0xF1137127F4E4FC0E, 0xE0E56FFBD736E53, 
-0x20BB8621A385B, 
-0x6699D9A56501643, 0xF9F23D62F07D5832, 0x5A6B21DE5B1B6649, 0x9A4B66F65132E269, 
-0x14B127C00FB6C943, 0xA9CE2B2B36B268D8, 0x8B431B2C704C, 0x48E84A4998C8FC2B, 
-0x8D8FF4664325F6F8, 0x29E6EDB7B7A7C348, 0xC64F9A5BD00FC18E, 0x1170878CB37772E5, 
-0x138B9329EBABACA4, 0xE302E803F1FF, 0x7798FDF3838373EE, 0xC3A48E6DCBC9A163, 
-0x6AD5A56E04F7DF0E, 0x6D19E018BC0C7D2B, 0xAE976189A66062BC, 0xBF8CF90DC420E06B, 
-0xBBFB4AF48E84, 
-0x7AE929360232B4A3, 0x35CE5E0A013D8C03, 0x3E49173662D98431, 0x46ED81B4B156D3EB, 
-0xE6187E9084D2BAAF, 0x4B7197CE75A8E054, 0x184080B5EC129, 0xEF3AE2F89A2D1D15, 
-0xCEBAEC979A2A89D0, 0x46BA7AEAFD87580, 0x1C5A32260D925D11, 0x27D3DE9A431270D8, 
-0x87FBEE171CA24100, 0xE9DB01A3C19, 0x64B9434F36F0DBC9, 0xDD50F06FF19C0F74, 
-0x6D260C61EBF7A3D7, 0x842E41A5A03F4A8, 0x98FFBFEA75D13EF2, 0x5E3EE0334012DE18, 
-0x14ABF41AC76CA, 
-0x4F3A12DDA2B57319, 0xE1680E56E2ECEC02, 0xB7593E9F24BC78B5, 0x48912306D0E6582D, 
-0xAD576F0D52054969, 0x28D19FABA9514B98, 0x48AAEC323D96, 0x78E6BD0C3D073D97, 
-0xACB7DEDBAF1739BC, 0x8768A1A90C4B2097, 0x7EE3CE8C5FE26166, 0xA5BCB00928AF5048, 
-0x47B768B075878635, 0x6A3CE0373713, 0x3ADB9634E593DBC, 0x102703DAC197479D, 
-0xC0D2726F6FFF4739, 0x95482A4BC1AD0A29, 0x8C2557E95BBD8F43, 0x79B2CACD5FE83E40, 
-0x1DCB5081F0AA8, 
-0x824C4D07D2F40DAC, 0xE2AD257A32F60759, 0x51C0B55F0E5B982B, 0x3A7FDEF7BE774F04, 
-0x98877BB40A507145, 0xC69E949D71DC8CF5, 0x80B5F86181A9, 0x533DCCEF1A8773, 
-0x4CD91FBFAFFB86A, 0xC11698C1E6B2176D, 0xB1C9A6F4B03EA9A, 0xD3D091357E4EE9A1, 
-0xD8B2F9E071EFE8BC, 0x192D7829F4814, 0x2FB33FC61B9C05A8, 0x5DB30CDD784309D5, 
-0x14D57C31355E0FF6, 0xD957857DB5E7CCFC, 0xDBC324FA1284433C, 0xC291A38A98D02C3A, 
-0x1BD17FB67BADD, 
-0xF6D705E43FA54790, 0x859B8EFCD8B1BFAA, 0xA70B94F600A6821B, 0x2D7F88F7286B7D26, 
-0xE19015AAD0F88B91, 0xD70B08AA533DDE29, 0x1E62C82D7FBB3, 0xD51B81D85C05A683, 
-0x1D08FDC7E788E81D, 0x372C797D51ED5897, 0x636E4DC3F6223B9C, 0xC2C1D66B1A37C210, 
-0x453D9F7F17508370, 0x142B4D42F7BE2, 0x2E412A5D93FD6F96, 0xE861CC56E263B228, 
-0xD59F98754DF53173, 0xFA61E3F91902607D, 0x970F1C3AE5EF6E6D, 0xC499DBD388645D0, 
-0x1A80FE0B5D590, 
-0x74B34B6B7C66C5F9, 0x19F9FB6876BA240A, 0x546A1883C923DBE4, 0x66948309B6AA4F90, 
-0x86BA360F7CCAFF3D, 0x45A802901A4F5835, 0x232C7BD2A46D7, 0x53B361972DB450C, 
-0x783227BC80B4011, 0xF8624E10CDF4AB4A, 0xE12AA9397C42D8ED, 0x80DE366ACAF90F0F, 
-0x91EAC7938714477F, 0x182FF504257E5, 0xA571506A74CB7F5D, 0x1AC00A5C545B8EBE, 
-0x1AFCE6D141BF8EC3, 0x547642978AAE7183, 0x887B8899D332994A, 0x5585DC0B81F1E361, 
-0x210A6B94A9C27, 
-0x271294AA7F92EC49, 0x170BB80167FBBEED, 0x9854D5D06AA1791D, 0xDA70936057D9B5E7, 
-0x6A4FDF6D2C5B03B0, 0x99A224A954CF63B7, 0x12AB0BB21FB7A, 0xF6028D60F72E7790, 
-0x7B70BA2B906783AD, 0x8D26E46119B92B53, 0x81DC7297F3B40AC8, 0x2A2FC3618A74CA30, 
-0xC405AA697365DFC5, 0x62D0A1B19836, 0xB20BC504AFE76EF2, 0x3D96B6ACC66CE388, 
-0x5E01B84774C4EB68, 0x7D8C8091C2A49FF7, 0x80BD7C68CD8C63EE, 0xEC3F91B774144AB3, 
-0x395A89AC5687, 
-0x5A1170222187785C, 0x63310812F84F33DA, 0xF5D01DBC07B5ABC7, 0x95CF5D0210E08E8D, 
-0xFBABCF5D463B4CDC, 0xAC7D03363CD6537, 0x6DE8D2AAF7FC, 0x80BA935DBDBCE374, 
-0x545EC22DA3C6BB7C, 0xB41612A3CCE03066, 0xC1F6B19E3B21B5CA, 0xE4D63503FF776C40, 
-0xEDD415CD4274B7F9, 0x5DB86F6E23E0, 0x8A6732A884B22943, 0xDD6583E29EA1AE35, 
-0x5E1A8FA5E342469, 0x62FC4579BD1E747, 0xD0108EB1306C3272, 0x71896D6703C9C3ED, 
-0x1C5141D0F1345, 
-0xE6D9E4F7940B14FA, 0xFC45142EF9A6B388, 0x6B50691831DD68CE, 0x385209F2A5AFB8D6, 
-0x121E1B2B2F6557C7, 0xEA3F43D761442286, 0x1A51FC1A963C6, 0xFF31099140935219, 
-0x7E605F0889C7D2FA, 0x656F71A19C7F6292, 0x2EC062E893B337AD, 0x40F691D465096186, 
-0x5957983DE56FBCB9, 0x99F76684E456, 0x71BFE026E2FB6603, 0xA1041ECAF524630E, 
-0x38DD3BB138A3BD09, 0xF4BC93B19D7EFA29, 0x959305C977835993, 0x874AF1C687958D5, 
-0x186DC96FF8019, 
-0x5AF8503288ABC554, 0x826FB6D11BDB9A8D, 0xCD5CE62AFB7D48B1, 0x37FDDDE07BDA6351, 
-0xC18883E9783B8E03, 0x7A19E7C922446A79, 0x8E047917CA13, 0xFEF5C0B2FC42AF42, 
-0xFD4BF1989A9D16CC, 0xE576B3466DD2B89, 0xD35B28D9F6D9EED2, 0x5929A5E04D011E50, 
-0x515682720DEA70C0, 0x121EB054261EF, 0x1064BA8C39308B01, 0x4B6008AB3A2B0179, 
-0x18812F04DFC6AF2, 0x9CF4C5C8847B1DCB, 0x25CCDF543E650FE1, 0xBDE556AD5B6AC46C, 
-0xE520408D6588, 
-0xEF9955C77D6D20AF, 0xBFD2C461E5E712FA, 0xFEC7D9BE95DDCA, 0x37242F0908479AAB, 
-0xDE245FA618189C96, 0xA8585D9E403D2E24, 0x22C4AB087E8F3, 0xAD7756DBB7B61B49, 
-0xA0E6322370C84BCB, 0x805CC42D3CBB2DEB, 0x820ABDD1FD26963E, 0x6095A2B93E61EEFA, 
-0xC59F95B786520D53, 0x5AE2EA952C5D, 0xF22F7E5C71968EA8, 0xB38EC8DCA29142D1, 
-0x8B8DF2854C1FC214, 0x9601BEEE590A4F52, 0xE9DCBD6A82705A69, 0x27A57122A3D73A93, 
-0x1DAE2483BD003, 
-0xFFF9C1A19A1E0D51, 0x2BC685EAA27671E1, 0xC29CC9806D703E82, 0xBC5B5DB9D9BD32C8, 
-0x896218EF4407E271, 0x4C3C0B74FC7D132D, 0x21152E2BF590A, 0x1D4A2298BB3B354D, 
-0xCD328881E749E5E, 0xD3330F99CD0F2257, 0xC8B26EC990E8C236, 0xFC4EADA05A4C54EE, 
-0xB9105E4C3DD5E777, 0x8DDFCCB8D290, 0x4FFEF2B55EEA48CC, 0xFC82EEFD8ECC8723, 
-0x27947A08C792F1CE, 0x1ECEB74B2465D1AF, 0xEF21323425A74F93, 0x4238396ED4FEB8E5, 
-0x19D2E38316F3A, 
-0x8803A940C5EE43F1, 0xE72CD502FA26C9D4, 0xB534E8CE416B382B, 0xBC1DF13D5F352AB6, 
-0x32262D65526D6D24, 0xCC762FBA372FE0D6, 0x3FE5AFE7D3F3, 0x6115B961F6C52FAD, 
-0xEEC7D5763068CA14, 0xC68D1D93595F391A, 0x27DFACA57F3BCFF, 0xC8E2703E4D1CC809, 
-0xB546F652C86796D5, 0x1790337BEFD39, 0x5E19B73432A3BB53, 0x57DAEF92F645C80C, 
-0xB3418693CBB4CAE2, 0x328AAF5972ED6044, 0x1344FA0C96C6A7CC, 0xE4181C17493FFE76, 
-0x1A22548149D0, 
-0x9E04243AD93DB3CD, 0xDF513E6184FE7466, 0xB3E9D06F28268B21, 0xE5491142E3256024, 
-0xBBA8251A83DE4AB1, 0x3259A1989470FD02, 0x1551BA372542F, 0x8DFBF56716E8597D, 
-0xCE41F8AE45BF24FC, 0x799A2661488136CE, 0x934AAF649E7DB6CF, 0xB7293A9EB5B353D4, 
-0x1B62DA625E20F334, 0xB93DCA38F076, 0x300FE30CEB9822A1, 0x3ADD5289AFD6E088, 
-0x8955DE48AC6C790E, 0xB6E4A0F615D02F29, 0xC381B7A46A25C979, 0xFE3F48BF22CEF7B0, 
-0x1D70CAD774962, 
-0x3F0FFCE463C76519, 0x382277D4CB9A3592, 0xD6912575588481D8, 0x4027860278D9EDBD, 
-0xFBB22A11E15F8437, 0xE06734E67DC9A559, 0x1CB0357B406EE, 0xD98B13E474B7B263, 
-0x98132DFE09E09C1D, 0xCEA75252E22909D7, 0x56034095FDA4772, 0x203E7A4059A4B9B4, 
-0xAD5C9C7665945BD0, 0xC6EC89F41AA7, 0xB7C0CBBEF18972E, 0x1073B362825F2030, 
-0x8F8F4AD47C7D4088, 0x5E6014AC0817B3F8, 0xA2D904F8FC5C87FE, 0x6E4980BCE843DD6F, 
-0x81C58CDA3476, 
-0x55C0AC0A714E98A5, 0xB06634A676A961FD, 0xE62A848656EE3D6A, 0x12F8A5107C1C9F5E, 
-0x93E11B59A62A01B7, 0xFE3E9B464D50DCF6, 0x1C39CCE48999E, 0x25A1FDCF1AEF82E9, 
-0x185AF36C7AB9B884, 0x1FCBF88B3541FFD8, 0x479C8B8AB11AAC77, 0xBE9BED59D820A93F, 
-0xA023884554662B6E, 0x35306C341D03, 0xBDEA5542416F5030, 0xA0E51F7CDC7713BD, 
-0x2EF56240BDC47DAB, 0x7342B530B0B8B73C, 0x3E6EC754F14A41A0, 0xAF5E698C54ACC25D, 
-0x276E62436F08, 
-0x1B90B80A8C958535, 0x8AB86E002FC1837F, 0xD55297C61DD272F4, 0x3AA9CCD0348EFB81, 
-0x1B59C8AB8F96CB48, 0x940B38A77E6297D1, 0xBBC45241272F, 0x156C4B21E11F6254, 
-0x542CD35DE0193B08, 0x55C897B9535BB6B1, 0xFF373530E989767C, 0xB05BE68F2CA801AE, 
-0xE7D686FE2C5BEA86, 0xC25A7572E8E0, 0x5E8181D3353C69CD, 0x4F3C75292C360E6D, 
-0xD57E355E7EA3C761, 0xF2D8ED350F3FCE63, 0xED147A0FDF5B6ED6, 0x5C2CC9A8E2FB7748, 
-0x1A7E333BA23E2, 
-0x137B643D9783EA37, 0xB1AA144D9FCB169F, 0xDE712CB87F4981D, 0x904C16A2AFBAD3BF, 
-0x3D0C444A28B4C9D6, 0x1739FA9CA12C48F2, 0x18765A368E214, 0xC700F0722913439F, 
-0x98C87FA3026B842A, 0xF7D1A4A113D61163, 0xEBF1B503278A2043, 0xA489477ED50C7EB8, 
-0x81B3BE299935D8C5, 0x1A992B085ED65, 0x15A014025815B165, 0x77D5CBFFF813A4DC, 
-0x3B023BE06F70DDF0, 0xFDE221EB7D1FFC37, 0xCA4475FC84FC0EA9, 0x5E07B95CDCDFD99C, 
-0x7E7A10AF9D74, 
-0x7C33A5B3BAFB59D2, 0xFDFADF16606EA065, 0xA4153C0492884A22, 0x726A8270910D4C7C, 
-0x2554DBFA656F50C5, 0x59ED3B5CAB358CF9, 0x9C1ECD8E09DB, 0x7705BAC435C7656B, 
-0x85CD848B71D60357, 0x416609201B8845C6, 0x65CC383C8AC1009E, 0x66F96B890B8DE3BA, 
-0x95D0D5A19BEBEA8F, 0x43B1B4173C27, 0x785F484FF763C186, 0x8BDEAA843284E756, 
-0xAB6F58673496E105, 0xB9691A4D4363569D, 0x58D71DB2DF95492A, 0x54CDE77F8F9612, 
-0x12A835E8D8A99, 
-0x409450531603797E, 0xDBA1F6AED08322B0, 0xED69E7E3D03FAE6A, 0x38A8A668DB1D2659, 
-0xA65BCD1DE80FF513, 0x9781AB97CF78EFC1, 0x12613EA286815, 0xC58F3CB1B75E5762, 
-0xDF3422ACA15C5787, 0xF232217ED5F9818C, 0xA94F19FEA1B3D8F, 0x33B5429235601E81, 
-0x1FE56997C9F1D751, 0x17A0D348A7A4, 0x1365382120BA2C30, 0xC1B2A04240FEBBC, 
-0x8F7E7F187BB51B7B, 0x37992F25C81C7227, 0x605BC46ABBF9302E, 0x96031F56C2B64282, 
-0x20477311C62E4, 
-0xF73ABA5889F4B8C5, 0xA3466F1C23AC11A0, 0x1E7F3273DA4E97A7, 0x62CBAD261C9D9207, 
-0xED337227DA6627E7, 0xA3696E20D22B2CE1, 0x1AE1CB4519682, 0xCEFC63B593475EB3, 
-0x87C54975F09FD597, 0x58D81AF37CDC975F, 0xF5048E0A96EA10E3, 0xF72C9BE31C7DA22B, 
-0x82823D6EE37EAF83, 0xB61E14F23D9, 0xA30C5634F9AF95CE, 0xEB392CA9FC275CF0, 
-0xA027320889821D38, 0xAD26FD90CACA76C0, 0x67117F5002F05641, 0x34D93DB2C511E3B5, 
-0x1F84FC177C4C4, 
-0x6CFA70DD0ED2673D, 0x280E37E38C317B8B, 0xD5C8A4F238A289F8, 0xCB56C30A06EA0F10, 
-0x4634A5026CBD69EF, 0x88F70E41573C0437, 0x23407F09D8B2A, 0xE818CA642F729E4C, 
-0xA23628067F974CE5, 0x3EDBA3D46AED9837, 0x6EBD9778986A0941, 0x4A06D28930162B52, 
-0xAFD860ECA2D475E3, 0x19B6BA6823C1E, 0x81758342454BFCA5, 0xA9C44BCC2D173C15, 
-0xFEAB826432F1CCF, 0x2FBAC9F89078C27F, 0xD1326AA32BFFC697, 0xC2461AFB11E72EBE, 
-0x13D647ED49408, 
-0x7442CE63873ECDA8, 0x8B3209ECDD3E804B, 0xC498D0C6881FD2D7, 0xB1AE56503237AEA0, 
-0xE5107C07F3FF0AC6, 0x6A0206B883B57DDB, 0xCD0EC31EE6D6, 0x150150A8132E88AB, 
-0x824441DDA309D8F9, 0xAD6BCA1D0FABDF7A, 0xF18468885498CE85, 0x9D472CE8E8F9C39, 
-0xFB8CE1A1DAFE84D7, 0x117DC3560EC7F, 0xE493E2F7FD994585, 0x94775FFADE5A1A36, 
-0x40E6C751892AAB52, 0x3F035541538ABBBA, 0x733AF84623032C27, 0x6D3EAC93606E4286, 
-0xB048FA62CE7F, 
-0x134B160DEE40ADA8, 0x2594D70C119D6E4E, 0x849C98B411BE94A5, 0x9A3941944037B809, 
-0x7E8A39D3C5A006DF, 0x7CFB4BC59C508BA3, 0x903C7ADF75E5, 0xFC96982749282CA6, 
-0xF16877D765F19A45, 0xD54D0687894F7C0E, 0x74D4643B63AFF644, 0x1F20FABCD44D912E, 
-0x45AFA4923F817D35, 0x1722978B89632, 0xF8F4E3B60EEC20E7, 0x5D30977FD93096B6, 
-0x8524EBAC3896B98D, 0x261AF7F83DF4421B, 0x58BC8E2950C56F74, 0x6D07EA33DD1A3AF5, 
-0x857F6B0A6BF3, 
-0x7BA1F77D48B46141, 0xFF265F40996FD054, 0x48FF997BA843425F, 0x7CFD8B82AB4A3A84, 
-0xD7C07E32021F8471, 0xDEE9EE51B446C8ED, 0xE9E142C6CCB7, 0x21E6CC721158F1D3, 
-0xD806A32FD5C7BDE3, 0x56C6C1F954E5A7A, 0x1BE8A74B37064DB4, 0xC38452673DD7AAF7, 
-0xA518D30E164D68BD, 0x98E40D7DC484, 0xD82E0FFFFAF42E71, 0x5B66691838C4EE17, 
-0xEB28F1EA06B1890A, 0xD9A03D95E54E036E, 0x6A8C33458F72B8FB, 0x6F0075F96E28CFDD, 
-0x10A6733ED38A4, 
-0x25188589DB5BF2BD, 0x73253D64AD791D25, 0xFBBC5EC40829B333, 0x4119569BDA5223AD, 
-0xAE64C18AA6DE95DF, 0x7F0B2E497F3D920A, 0x60017B802052, 0xEA193958483BF3BD, 
-0xF9E1EAFB22D9DF3D, 0x93EB26FE8A9C3C16, 0x5FB9FD07E987B108, 0xCA22A5092542C62C, 
-0x556C5BBFFF7D8BC1, 0x1323A3380E28D, 0x159C3E1F1841E3F3, 0x9AAB4AD2DD95966C, 
-0x12EA0A64CA6BD345, 0xDA1A52713AAF1BEA, 0xCC69B33801833C3D, 0x8FA105E60A251049, 
-0x423B458670E0, 
-0x51F2AA6B7F8AA6DB, 0xD92C2ED995707B8, 0x8A3067C3FA16772B, 0x1B4FFE6319FA10A1, 
-0x55E64B74692E79C9, 0x457135D9A4FBF82B, 0x6831AE8FAD66, 0x3026F96A0C2297AD, 
-0x911D3135180294B6, 0x27BB009ABB39B751, 0x2E72929B0AA1CC10, 0xDED80F688CD10172, 
-0xE75C8930AAD334F1, 0xF16E26492D19, 0xA51708AF822DE137, 0x8E01A3218F2DEEE1, 
-0x1C482CB8485B9091, 0x69BD3A01BB57F9D1, 0x191C20DD3A2A57D9, 0x50F5E17B6199FA5B, 
-0x10A3749746869, 
-0x6B859396445AD74E, 0x9432792F167A42B0, 0x3A236F5ED422F451, 0x8FB34DABD4FB80D1, 
-0x6D8972A49D2458C3, 0xDA10197F37912CB2, 0x98E9900F4F28, 0x598026C71E6A273, 
-0x8AD858093BA7C2F3, 0x8814B1B80630CE54, 0xA2A0313A072AF768, 0x7395A82D51E68095, 
-0x9387D88EDD98CFAD, 0x1C05F9D004A55, 0x1043C8D345B24970, 0xA555173999C7825D, 
-0x8EB17C40482E46F6, 0x685DECA897BA64DF, 0xCDFCB1A791274E95, 0x7CC74A72600D48B8, 
-0x126C0CEA2C13A, 
-0x256F7C20FA02DC9F, 0xEBCE8CFADE3B56F6, 0x81A4E3E826978900, 0x2BBA446E361ABE8D, 
-0x13971F679603C988, 0x1769FDC730A47D05, 0x21B0CD1403CE1, 0x55C18D0A2A2C7ADD, 
-0x23FDC5FF1E8A1B51, 0x895B02F69896E400, 0x8BB54E5B100862ED, 0xE49C3D47503460C1, 
-0xDB260D7F213091B1, 0x146404412AF9E, 0xD3AC059F736C7C77, 0x4697BCE15572B41E, 
-0xB23E542AC780F9AA, 0xEB74CA320A05B84D, 0x14102E71614B3E57, 0x44C96452F0A0E5F7, 
-0x102DEA62939E, 
-0xE43771E6270D905F, 0x32E5479DF41D5232, 0xBE738281E30F9330, 0x950C4E258589C77D, 
-0xF6BBDFEFAAA27751, 0x22A1CA7A0545C296, 0x1BB5B4047D2C4, 0x1D737C8696418A8F, 
-0xA29B725FAD50B232, 0x8BEE049CE0E6B94A, 0xB676E51812F3822D, 0x23638B055086A9FF, 
-0x17355A1C5C6BE083, 0x75E01E6DAAEA, 0x5219BC0FD2C0891C, 0x502D108C1E351AA8, 
-0xDAE8A74753A8AF40, 0xEB355CF157E471D4, 0x1B093C4D415B9782, 0xC45D78F7ABFA59FC, 
-0x82FC83EAED7A, 
-0x42E416DF4B054FF, 0xB4A701504C1692C0, 0xBC9B6F4DF8ED8124, 0x1DA2009FC44CCAB2, 
-0x91207218F843BB53, 0xAF80CB0947BA8203, 0x211C12787A2FA, 0x75BCC97559E12FB8, 
-0xE46DCA5D3B3A7C79, 0x83DD3090B6D8A898, 0x41EDA35CAB8DF3D3, 0x4F5CA9A7AA80DD86, 
-0xDBBE5D8923B4E71, 0x1B58BFE2650F8, 0x98A343B21C93D350, 0x978382D305CA8784, 
-0xEAF69726E01B9851, 0x6216C87D6611317A, 0x6FF7D7532588BA4E, 0x724FCB31E48DD8E8, 
-0x1E5A44D93BD03, 
-0x7E32DCE5F889B7DD, 0xBE6D9A4189488557, 0xC7B0FA437703D4CB, 0x3368EC69017684A0, 
-0x2DD7BEE616F26D3A, 0x57AE0701396CE03C, 0x82D6D578C4F4, 0xD606F3E87CB8B434, 
-0x1589EFD58EB41097, 0x726C703878BD86C1, 0x87436EDF8F30EEE3, 0xD673B1B9C5FCAEFC, 
-0x4EE371BCE978DDD2, 0xEB630C1BBF9D, 0x56BB75791CE5186C, 0x52EBE1A15DF753BE, 
-0x6F3E2B4B889A6BB8, 0x9FE2C80F3CA7FE2D, 0x16A3621CBFF78591, 0x29F9BA1A701FF96E, 
-0x10FD59446BBED, 
-0xC93936CA5EE153F2, 0x182E042AD7CF6B95, 0xB7F909EC9E9075E9, 0x8EC3925980D852F8, 
-0xCBFB58FAFD406CAF, 0x4DBCB168FA773BB7, 0x116CF667896BC, 0x7BC3944E53C57900, 
-0x8D689B041EC7C4C, 0x869FCCF078B5D492, 0x9EB1D015D7DA44DF, 0xE09ADC5B3ABC1534, 
-0x7DE8DC4794221038, 0x18F7BBA3F7C4F, 0x5ED9E32321E28C09, 0xC0C29ACAC17D0D67, 
-0x889D858897270407, 0xB61D5D1C4B7B55E1, 0x67F31AD821718D4C, 0x3D926E7B09D3D4A7, 
-0xD178D4D3D47F, 
-0x337CCF4F386B1C51, 0x2292DEF2346EC0C8, 0xD015C672AD66B870, 0xB3CFB9F36F09F1A9, 
-0x941B54273D5D478D, 0xB288ABB71A45C726, 0x13DDB0BFB62A7, 0x5B2ED8A3A89EE8A5, 
-0xB950E96CFCD26BE6, 0x7CA8D5D873B11AC5, 0x5365812EA776A169, 0x5BAEE388CE59DA55, 
-0x7C25B6B9705B945D, 0x1817F2FD9A7A8, 0xB0E26CD16077AB8F, 0xC7BCA85E01CE102, 
-0xDCD8F7F45D0522B, 0x93842FE76A18D678, 0xDE5A0C0B3C09FD2D, 0xA1FF0799BBB0DF2B, 
-0x67455CD2132D, 
-0xE25E131A6384C18B, 0x3FED2A9375C2D6DB, 0x962BDEFA92E12075, 0x35DFE7A82FC6FC, 
-0x1C96CE4B569ACDED, 0x1C38EDD1A70A9145, 0x1603905E84C8F, 0x31324B86629C2B72, 
-0x61D6CCB2BBDC22A, 0xDB089D8B884BBE5F, 0xEFB988830B48A1E5, 0x3FBFC06C15B7C58A, 
-0xB52EBF9AA8EEC077, 0x23E26908AE91, 0x62569C53E143CC64, 0xADED0D047684BCCA, 
-0x57B804DCD9156E24, 0x6A6F770DF23807B8, 0x662043A8249DD37, 0x412055DA89C6D36F, 
-0x1DB0CA32B80BE, 
-0xB6A8E28EA30D6047, 0x2D94A76E4D6A647C, 0x2022C86E4A6FE120, 0x16483048069BF7A4, 
-0xE3EE047A9FB179EE, 0x87B5FECBF8CDBE12, 0x1692285911631, 0xC2378089A97EAF6B, 
-0x6A5F59201A41A949, 0x5149E59D919173ED, 0x1BF0A5FE881DEA6F, 0xD3F712AB85534276, 
-0x66DF1BD87D204F0E, 0x12C7975CE745B, 0x40DB79DD4586591C, 0x5EC14D3F45A51C92, 
-0xFED134D67C2AD071, 0xB0EB374AC188C3D2, 0xA6DA37C6BF1EDB3D, 0xBA1BD67DDBC73EB8, 
-0xA277AC05A1C7, 
-0x157ACCD641B82838, 0xD893C1E5A1E74F87, 0xDDDC9197A1105159, 0x9043856375AF2A94, 
-0x5EBDCD0BE47B5CC9, 0x9B7001BA8AB2C5E, 0x53C085063915, 0xA85770E3BC7E796, 
-0x413DDD1CDE9A04F6, 0xA7D6CB86106D42A6, 0xAC0929114EF76546, 0xD52E893EE56D3031, 
-0xED7DF7B4F4A19092, 0x13735506B386D, 0xE667D2B8671E6A54, 0xD5A992B67DB2900B, 
-0x91D3CF5FE90617CB, 0x8FC21D1D0002247F, 0x513B80740982B795, 0xA69391245328F021, 
-0x2E419AEDAF3B, 
-0x67DAB27D73A75458, 0xC6A2DFBCA575DE10, 0x1EA5C10528D27795, 0x1245F0EE0B51685F, 
-0x6D7490EE10A712DB, 0x269CF85B9972C873, 0x1DF13D9D56F09, 0xD289220A47E615FB, 
-0x5563487269DE4A4F, 0x96EA927731041ABD, 0xA34D007572DFF29C, 0x8086733DFAAC4F81, 
-0x639204FA8BE4B110, 0x105330929D33E, 0x7CAABDB2B5348064, 0xFD5E4CFC47AB3BE2, 
-0x929E398EC6C0C748, 0x91FBA9ECE61E113A, 0xB3B9A2BC61AF33EF, 0x9DFA3797808D7245, 
-0x785FA85E74FA, 
-0x9AE240535DFA1E28, 0xD91F8249275942A, 0x187060CA4E286AD8, 0xD6DC92E96B2C49C4, 
-0x5C012703AAB653AA, 0xB670B87C3D75A932, 0x1267B5D55A910, 0x5EF56DAE2329BC6C, 
-0x129AF9EBD5FC2989, 0x603DA13142F6221, 0x20479C0B7499ADF2, 0x5ED576CEBABC3E2, 
-0xB8DC30684A6ACC7D, 0x2C54792C3081, 0xE784C7CA4C8E9BC5, 0x186056777690417E, 
-0x332E257F12088EC7, 0x7BA1552275BB542C, 0xAC2872D24596C750, 0x1450E4F57E2D3495, 
-0x36DA8589ED3A, 
-0x60655D6A59BF29CD, 0xDAA231E555066849, 0x2363492B3F2FCC7E, 0x2864C540319D9D16, 
-0x21908A3FE0748246, 0xE52B6883FEA9F023, 0xCE5074325E39, 0xA570BC2BD037FCFE, 
-0x502864D2F1087E46, 0x50211BDE4C28683F, 0xBDFE6BFFB248551F, 0x14D70A1528904CFD, 
-0x3AFF62B487EF7A2B, 0x212118B1275C7, 0x18C8B42924FFA7C7, 0x984D332C7607A89C, 
-0xFC5A70CEC5D43791, 0x626D6A6B9121155A, 0xC2CCE6818EE83B42, 0xD7B2C1537DDC66A5, 
-0x1252427503EC, 
-0x3E10CD967257757F, 0x2979A20A92F442D5, 0x2BC9E766CC83368E, 0x87DBF727C3C9FC01, 
-0x9D98DB88F9B49CD5, 0x1F54B14538DF121, 0xBF72D69CAF3, 0xF9733717888CDF, 
-0xD3AC1E6DAB7F28A3, 0x1694FE4087DB5C53, 0xBFD4EC6FB18223FF, 0xEE362BA55C8D088D, 
-0x12ACD41DFAB67948, 0x1E72F6B01566B, 0x8DB74913962BBBCB, 0x878A2755D38EAF1D, 
-0x64294478198D58F8, 0xDB97507176B2DB13, 0xAA2CB63156F14389, 0x10B2A154CB9686BF, 
-0xD97E096E6D81, 
-0xD2EB61F9789A5483, 0x443561E0D3186530, 0x391E1F42DA9E7321, 0x257A5525AB75D4B7, 
-0x2E5016D842E18088, 0x47600A452C04C1AD, 0x1598E5C2A7F5D, 0xFF08F6B67816D203, 
-0x27F96B0F39B9F1A2, 0xDB429EA0C3264354, 0x1EEDD5866C25FDDB, 0xFA93136EB5801BEC, 
-0x5E0CBB7176532991, 0x8857786D45F8, 0x78698F0F1336809D, 0x7505DC0E9DF90716, 
-0xF74A955D1B817B89, 0xC95F3FF88869947B, 0xB6FA3D729E7461FD, 0xD78C3AE055D1320B, 
-0xDDCECCCC052D, 
-0x66176241282994A4, 0xF538E2B06A52BB95, 0x7DAA90FE0E95C862, 0x84CEFF972E78C719, 
-0xD3EBE27545B5B511, 0xBBC2F172F3B061B1, 0x97BE95E769D3, 0x9D89D8FA6D699D69, 
-0x34605B20A95C6228, 0x463100CBA85C0111, 0xEAB602EE13802B99, 0xEA0175848C6D9C90, 
-0x4F6A4EB3E3E122AB, 0x1BF07F3857F34, 0x4C88EFB422DE3796, 0xFD65D3403733C1DB, 
-0x9575D53E1E0476A9, 0xA7354CD1EC799D5A, 0x786FFF74CE1F675A, 0x66BA8CDB019898AE, 
-0x1656BEB193F08, 
-0xE71C04C6F35FC39B, 0x11BDA6677EA414D4, 0x737FCB9EA24FFC25, 0x112CC92D58D660D4, 
-0x4736B17F639A7B, 0x48356960819B2979, 0x2297BD5B51209, 0xFEB3205C4BAABDE7, 
-0x273FEAE91926DF37, 0x8C7DC36C219811B9, 0xA5415EFE672DD45E, 0xCA186B9328D7798D, 
-0x17DC5E20F3864CD1, 0x1F2306580E5CE, 0xFF4EDE78FC607C84, 0x3028768166437D8D, 
-0xC678ABDDE876AE1F, 0x831947E0B2E1D3D5, 0x6A0CD4184FCFB436, 0x9C4E03EC34FF6A7B, 
-0xE8CB05132D0E, 
-0x100FCBAECFDA3187, 0x5FE399BF7D748250, 0x2CB32A3EFFCB2871, 0xC4767052BA76CE59, 
-0x2608ACE723DD1F68, 0xA0F5FD7F7311A6C, 0x1A47A32B12094, 0xFCA628A00A58DE67, 
-0x7BDAEFE0080568AC, 0xDDDE64D9087D5649, 0x4CAF63FE287F25FF, 0xC572227F55922C10, 
-0x5F7B62E25CBE200, 0x109925DB2519F, 0x634D97A860C7E486, 0x6CF49314C1AB1401, 
-0x3E13CDC17DD424F8, 0xDD7DD4D0EFFF6BCE, 0xB28E37B49E9E3D88, 0xB96BBE125D0D958D, 
-0x1E75D9BDF371, 
-0x2C61D4167ADA4EA7, 0x55EF452669F9B08B, 0xFAFFAB5A26B4B521, 0x97EBF5BB0413CA1B, 
-0x65F5F0399D10042E, 0x378539AE755CC2EE, 0xF7E6F571701B, 0xB133CCDCB450863C, 
-0x62CD4BD015DBA372, 0x82F240B82E979D2B, 0x894EC1762F0959EF, 0x44894230F96A1929, 
-0xC6E52CED6F581C7F, 0x19EF250852C32, 0x7B2A53FEE2246AC7, 0xC4AD57F41C159AAE, 
-0xED90570DD8FC268A, 0xEA172A07A207CD92, 0x2C39006090B14391, 0x2AD2AFB3258AAC28, 
-0x13CE85A6A9E3B, 
-0x6160DCDD43C5F01A, 0xF0A8182D032E5761, 0x2E46765D0BD6BCB, 0x49B26A00D97E6CA0, 
-0x83709D7AC47468AE, 0x1A97A231F0932621, 0xB951C40C4AAC, 0xF06A2BD33A3A1337, 
-0x532548637E1307EF, 0x279FC3B7B14B9581, 0x89BFE99B2FEEDBB5, 0x53FF0F3CF20110EF, 
-0x82AB1BE8E9021008, 0x19D9AA9B6A632, 0x3D05060E9453E15E, 0x6FC50D0F0FCB26A4, 
-0xBE0917335F55B505, 0x4F1372B94CE7A156, 0xA7DC57DDD3CBCBB1, 0x3BBEE4769BEB9517, 
-0x128C340C20E24, 
-0x326FC857CE8EE9D8, 0xAF5023A625C3A738, 0x8C7F9CE4074A46A8, 0x52DA9DA318B9377, 
-0x838710035D8B2935, 0x7094D3575501E3C1, 0x74D0C76420A5, 0xE5659DDBF10CE7AA, 
-0xC635ECBCA45E6BBC, 0x6494EB65C2828AE6, 0x50F8BFA661FC440D, 0x78F33EF6B3F96223, 
-0x87323F25D6FA4F55, 0xF07E6214BC, 0x29A3352DA0E014A8, 0xB5B6DF44BADC19D9, 
-0x9CAC46D041D86096, 0x1C5AF5842D8E2FC4, 0x5A467197C647A03, 0x5D63A902AB511246, 
-0x1BDC9A796518B, 
-0xE6DF273A22C513B2, 0x210A9B05BDE1F9B9, 0xF7993F5274140F05, 0x132F4BBA6469E322, 
-0x5A19D8344F358F76, 0x4FA197A4CF7EF4C9, 0x33EDE59AC801, 0x7F328681DDEEA951, 
-0x6ADB71A38B1A32EC, 0x2A1AB8DB36E27495, 0xBF1AF23B31FB0636, 0xDAA2CBE73457D9C8, 
-0x6C68AD3E766EB70A, 0xE6CCBF0121D4, 0xB8C902F10B3C29EE, 0xDB1A5FBB97DBDC16, 
-0xDC7E3830FBC880D5, 0xBA1AB97B7F0A0C37, 0xD73322CDAF34FB53, 0xE4A7E45CF4ADA74D, 
-0x20EA5A9FCC958, 
-0x3FF59BFD5CD0A9DB, 0xB2867D82AD300B77, 0x378378BCA8874840, 0x7618C7BE8556914B, 
-0x81CDFDCA77BAF73B, 0x68CA7ADF14F9404E, 0xE5522F1BADA4, 0x7E62126999B275D3, 
-0xA592B9CFE30EAA3B, 0xBC2B74F302C12028, 0xBF45C86BD4C572A, 0x765A6F61F95BDA8D, 
-0x688E91D0F341ECD0, 0x77F87F66D7D2, 0x57259608FEE1981A, 0x558FBE503DE1827F, 
-0xFBE7051C7437A255, 0x8D2BC846036F4C78, 0xF0AC62000C415AD5, 0x4FB9860F2E3DEF5D, 
-0x10D2E4AF8B313, 
-0xF6B066EED9C073E4, 0x5CEBE34DD93E6646, 0xDA81BFB6A13E768F, 0x4B8BD94E7AFC809B, 
-0xA038722C28A80854, 0x865D3628E7AE022C, 0x18021B0DACC67, 0x9A9EAB23DE5096C1, 
-0x2725624B3BEE9040, 0xC505500A260CF54, 0x4C488629520BF762, 0xC1E09283C678D520, 
-0x9CF05BEA5B55A36A, 0xEDEAA426DC1C, 0x812C6E71BBBE22FE, 0x8863E3B7BA3A30DA, 
-0x3C03FB6195B96834, 0x4C5D93F0F366BE5D, 0x1F1B01E2C5E370D4, 0xC769BD00CE903AA5, 
-0x88BF8882651B, 
-0xD924734D6838E8A8, 0xE032EF50F764C0EA, 0xBDC974A72FA63597, 0x7F63D2801993552E, 
-0xB744501397607611, 0xC97074C1B70BAF9E, 0xDCC1F5D60B37, 0xA77FF91F06C34A0C, 
-0xBCCD3E2ADBC68880, 0x86CFB04C666BFE81, 0x1491F439AA8FCE29, 0x34E53ACA62D46701, 
-0x3D241D615FB0E495, 0x3D488DDEDE5C, 0x47A38DE8B426B70E, 0xF0055209D0C572B4, 
-0xB4EF0D9BB5EDD245, 0x13B08634289C8F6A, 0xB1B7C53EA36D7EE7, 0x20A32207CBD34F88, 
-0x1DE07E4B1C8A3, 
-0x7B0F123126DCDD9A, 0xD3F109BE1AC6218A, 0xC34DA953564B9124, 0x71B96F4704C89DBE, 
-0xE955258F4A4A8E48, 0x2EF86FDDA97913EA, 0x152801E2C1551, 0x3EFBDF1506042582, 
-0x29C3795BFE798F73, 0x5445ED37FC95741C, 0xB8CFC52FCE1FBA65, 0xEF616F3B5943A59B, 
-0xBD37708CC1AF856E, 0xB873E6AC8BF0, 0x757088BA8DF6EC16, 0x38E548CE27460CFD, 
-0x2AA2020AF78D6A6C, 0x6B832DE64D091D35, 0xCF5DBCB384750210, 0x3BAA71E8F678A3E, 
-0x2278A3585C000, 
-0x4018A7BF8C6E6A4A, 0xA8768E67C5D3FDE7, 0xBAC7E42D2C56CF27, 0x750216370598755B, 
-0xF364B21FD5A117A3, 0x361A4AFD2F46F534, 0x1A1FD24B5A110, 0xD7E6D79AF0F1D333, 
-0x2EA7BFE5B515AC22, 0xBB4B009F8D1B24C, 0x5B8367DDE9ED2580, 0x87D708274CA5FC87, 
-0xF850436FC2B7084B, 0x1E7C782490350, 0xC51F3B523398F02E, 0x4A79621211FAF384, 
-0x806F29E10E3753E7, 0xA920A7A0140623FA, 0x779DA6F9D265555F, 0xD87E7F53D7CDDE05, 
-0x149F7B7E800E6, 
-0x33E040541E0B745E, 0xAEC0E429C27E0DDD, 0x2A9300AF6C565525, 0x85B6EAC32CAAC581, 
-0xA53C319AE2249FA0, 0x70C9AD13F0DC4CCE, 0x16FA1C6726729, 0x39403CB547AA7BF1, 
-0x898FC22A39C8779, 0xF8E6EEFA86FF7A2D, 0x43146D92233487D3, 0x2C540159448F46EE, 
-0xE70225C48566CF02, 0xD1C3EBA4F5A4, 0x6E9E623A006B7FDA, 0xE570EA2F6E57C69E, 
-0x668725A90D995223, 0xE00987B98C5290A8, 0x5BEE2C4D49F48591, 0x14960C315FDC6FD4, 
-0x1700AEC7DA845, 
-0xE92044731DEF1AED, 0xABF8B2737E298E6B, 0xC4A65180B676C2A3, 0x29050C0F7B4349A7, 
-0xB289FA5D6249A91F, 0x59B7A8626D9A8A90, 0x15E1E1423FA3C, 0x18D17F18C6502B45, 
-0x3FDEC7BFE1F5789F, 0xD45C729F42B81362, 0xCE9CF6090E2E7FC6, 0x3A14D6B7FF21B790, 
-0x41E58BB03D532CC8, 0xF99601B0E71E, 0x7B89BB899167644C, 0x8582F6D7E3521C22, 
-0x3AEB37DE39DF42AA, 0xB8F203CE27EDBDBD, 0x6DB03359CBD94B41, 0xFC64822FF1D62C4, 
-0x1B14973FD16FD, 
-0x175B144B2092B503, 0x46F8542E2DA36003, 0x9333CCDA0BE10C58, 0x6574F4D7F9F1246D, 
-0x88134479D0B920CE, 0xA1E7C3D606CE330, 0xAC3F2C0AC417, 0x6DF32EABC2E82DFC, 
-0x36CC436913AD233A, 0x6C515FAA12B6BB69, 0x32B798A9D5165D61, 0x8EEB1056C8806008, 
-0xD0B8729094194671, 0x154014D45EB57, 0xDA05C4D21992A737, 0x5DE6DE9938307D3C, 
-0x356A6074009158A0, 0xFA5D7C1FCE001389, 0xC686F8A324BA46DC, 0xCE3F61A7893AC10F, 
-0x1699470F035E1, 
-0xE56F3C89DD88827E, 0x54C2DDA7D67C72B9, 0x9597ED45A77C7ADF, 0xE9A8D40A47CBD095, 
-0x3C763B1CFB3A28C, 0x24779FA2A9BB62D2, 0x3CEFB9AB456A, 0xCDBC4B19E670D500, 
-0xD60BEF4F82667437, 0x18049C63FCC8790, 0xD7854E3EF9824064, 0xA3E8F23F3F20AE72, 
-0xE2346EB12B286EC1, 0x175DE81E67D97, 0xC936C115D2074BC, 0x69E75EE93135AEDB, 
-0x36BFFB9FD0DC6A99, 0xB1FBA35023F17FAE, 0x7522E95DE309556C, 0x68D4BDC75560F8F1, 
-0x1FCE2B47CFD1D, 
-0xEAF9C5ED2AF7FE7B, 0xAD1400B4E61AD2F2, 0x8CE64A8BC6FDEFB7, 0xEE4B0104E91EF51A, 
-0x757EDC61BBE15B24, 0x40F0C89BEC91C483, 0x12D2202634609, 0x8C738AE3EABF4F3E, 
-0xFE89CF744B096129, 0xF6294A1659578553, 0xDAB2034B763F6E12, 0x1F69F8232FEFC826, 
-0x8BF00BCEF2A7D837, 0x2E1D491D2E2D, 0x8F994AF5702E337B, 0xAA076EC11F16BECC, 
-0x4A3D03B1C1946C0E, 0x43E956551AC23B6E, 0x9111ADAF6DB54B91, 0xB0F73A3D7B60840E, 
-0x1EC29D12CACFC, 
-0x4F26A97B509701F8, 0x20038DA5D24ABC38, 0xBE819956470BFA04, 0x856441F6BE71EF4D, 
-0x7E80B190AAF15BBC, 0x241A9E050C1FA794, 0x1A833D6CD6BDF, 0xCEDBCB3808B8EAF8, 
-0x5521C674B7F3C238, 0x3969460EE8175E2D, 0xB3AE5CB32FB9C850, 0x4CA2C90D1426F39B, 
-0xD1FB460902647BE8, 0x1AC8AE3032E8A, 0xB3208C7EAB19A50E, 0x9BAE8940B45A638D, 
-0x786C30F5D9BE629A, 0xF2A8C2F9A06E21C, 0xF8DD91C9084488EC, 0x9C9652FE0B22EF60, 
-0x21B52407F008, 
-0x10004CF4EF9A2778, 0x7BB915417928FCFB, 0xE436A88FE206E42D, 0xFDACF0DC0906AA43, 
-0x2CB2AAE91AF6ACFA, 0x53ABB62D4C13AC52, 0x48B7B5A1BA72, 0xF7278050566E9249, 
-0x300F4FAFAFDCB153, 0xB203C65DFE4BF5BD, 0x9B2316CE116926DC, 0xE068D39489B9E2B3, 
-0x32DC2F27ABD7EF43, 0x129D4DBAA1DBD, 0xF881AB66A8565072, 0x5129D22EB84CA725, 
-0x64DFBFACD7D97E38, 0x617095B8CEB2829, 0x4F0648F9A8D4D397, 0x862ABA78ABD6F1E1, 
-0x9CA0BA951C7, 
-0x33BCCB49A10F6CCF, 0x722A27581E91A825, 0xDE9CACE4487370CF, 0x2B13C432C62C6E2E, 
-0xC4FB6140991FEC89, 0xB96520008DE2DA04, 0x17C6B378DFF7, 0x5F810376E65C5E64, 
-0x2545C5FF7E725327, 0x64243E7E04CA2540, 0xDD85A177D84F2C26, 0xBFED32F42167E35, 
-0xEEC049DF3F761609, 0x146F7CC513DEB, 0x1F467D1130299114, 0x399CA3044A276FC, 
-0xD697A305417ABA1E, 0x13704E1F1DD64EF5, 0x31453A4AD52CB3D9, 0xBF05ADCF8E8DADC9, 
-0xE3F3D27616B, 
-0xBB53D0FE83464E86, 0xBF445D9784300712, 0xFFA8EB2455C27BB7, 0x4D6C52C7E4F20B48, 
-0x9B981F403C4BAD5A, 0x524AF53683B6BC36, 0x53B3B31EA192, 0x103842ED515C2F19, 
-0xF66AB3B74BAE4B16, 0xF533354981EBFC0C, 0x6210648B721EE08B, 0x34D76F38143C125, 
-0xB11284AE3BD5AC0C, 0x11A0EDB895DDF, 0x4FCE2114A73458A9, 0xB14E0A5E226A58E, 
-0x39A3E15E82EFC52, 0x97FF4631FD2AE50D, 0x6966FE8CA9E23D39, 0xD867C32E7F94B69B, 
-0x8365EC759703, 
-0x76717089790C96EC, 0x1DEC88520EAF6BFA, 0xD3D873FA36F2C707, 0xA46FBBF3FAD6D34A, 
-0x346EDBC445D9A69F, 0x8BE85426317A0024, 0x19AF1E1BADEE1, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x4BA72CA59B6001BB, 0xE5FD2ABD4CB6A33E, 0x8A98D19511F78FF8, 
-0x2C5C5AFB9A978D78, 0x73C9F51BE2B16F40, 0x671834E521007F4D, 0x451B04879668
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
-0x6448CB5BD9770D67, 0x3092CF8C8803D8B4, 0x2542331C81C2C2F8, 0x8066DFBFF024AA32, 
-0x5F4E163CD158E1A, 0x87C8B0AC7FF6B89F, 0x18466971777FB, 0x414795F6A70D543E, 
-0xDC7D2E0B9229A814, 0x679CD711C5B2AC8E, 0xCC92A943030F0D18, 0xC2BB3CDA074E0076, 
-0x19332E71DC423BA4, 0x1C95A2FC045DD, 0x6DB3A00833C75E25, 0xEF23EDA1ACBDA616, 
-0x72B19555F79DDE6E, 0x9DBA3A0E78EBE79E, 0x1D187EE5215D71B3, 0x1D24D175B4C3C65B, 
-0x10AEB3555065D, 0x508F3D07E0AE1491, 0x1C7EF18B886FDB38, 0xAA1001FC42642F0C, 
-0xD5536205F2F93C34, 0xB647092B16484B6E, 0x899C89AEA084752F, 0xD0C508EA68B4
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
-
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0x750FCD24D96F498D, 0xE74B7652658B6360, 0x54FB85D2945C71AD, 0xA530239B59D34B1A, 
-0x5E729DB52488A584, 0x8EF15300FCCB833, 0xCF9B1759A390, 0xB751C3B1450C3CFB, 
-0xFCD2CDCDC975A71C, 0xB205AE03102DA534, 0x2A92457AFE850487, 0x11C5DE0150BB9277, 
-0x92583FABF57B00B, 0x1DB45E9F74BA0, 0x6E2824B9A6CD94A6, 0x326996F14616B5B, 
-0xB8B059926FC41E14, 0x81C1902B47804230, 0x4AED4C52162CE0C2, 0xFDF011A61D93A862, 
-0x1EF5325739A5E, 
-0x78B9C0B9A3BD2967, 0x71CB2BC7320553C6, 0x316F5C32407BD0A7, 0xE55D1AF3CE7A86A1, 
-0xADA2BE65BC44F08B, 0x6DFECE85DFCA3C66, 0x1FC0E23853261, 0x2DDD455D97F32363, 
-0x46045C35F348D058, 0xEBED02F21182F5E7, 0x945CE83599BB7C39, 0xBFFC17B98D65562A, 
-0xF2939B5BA82E954, 0xA00560C80C10, 0x474F1C272489BC2F, 0xA564E546E5A201CB, 
-0xB957D75CFF3FF629, 0x3A76D34BC39747A6, 0xAA8D48E8E9B4698, 0xCCA8F309E4BDB606, 
-0xCAA0E8A11964, 
-0x976CCC8431FB6C34, 0x8C8284AF61466CBB, 0xB0AF134D7B823472, 0x1A04747E8B17FAF1, 
-0x5E2440D685E770E9, 0x3DDB066DB9B420C9, 0x625F7441AC17, 0x7CFA008777AD43F9, 
-0xA4B6C0632363D1AE, 0x9336E4719A6D77FC, 0x5EABF971D76F3F31, 0x626FAB5A44137369, 
-0xF40400CBD713FCCB, 0x14F6A0CDB44DC, 0xFDB139668120B384, 0x1DED27FD8F13D564, 
-0x9AC2B6A0F21A8FE1, 0x67C90AA701E803E0, 0x8D43D97FBF09947C, 0xFEC1313BA4FE8713, 
-0x1F2633D52B220, 
-0xFF1D65CA3CEC7022, 0xB42F77A4ECD38FDD, 0x10D4A99EF3C7A955, 0x1B2303D6B0FD913E, 
-0xA572DE48DA807A48, 0x502F9A6E3E3A37E8, 0x37CC76C9CAFA, 0x2780B7621B977D32, 
-0x7C0DEF25CD7EA965, 0x4DD4316EEEB248A1, 0x305AC1CBF3AAAE7D, 0x76EE1B4562B0B550, 
-0x448B64F5350DB407, 0x5445283D28B8, 0x7D0C48FCF2971A51, 0x5603D7D476DA47F4, 
-0xF3EA2E2B18DB0180, 0x9FB26BEE17EB7153, 0x9979BEB62FE54A8F, 0x7BEA62C58A6755ED, 
-0x433EE8B58E9E, 
-0xEBECB7300254B1E1, 0xD0BA966A73B96166, 0x6A80F889DA560535, 0xBA5F9AB3FF24BF95, 
-0x83ED7166FCD75963, 0xBDAC93405D97A232, 0xD861C6B948F9, 0xE3BE6182E764F224, 
-0x207EEC37228E7DDE, 0xE63CED9839EA5FE0, 0x25C5DEC25FDD4617, 0x1F8E938E85B1CDB7, 
-0x75274B7A209FC0E6, 0x1839F3198378E, 0x6B6F952BF801101B, 0x3B790104ACBCA620, 
-0x8732A25B16A39F6F, 0x58838C50A4F42CF7, 0x6CF709BFB949B38F, 0xF7B30AD8E2FBE8BE, 
-0x10AFD93F23D73, 
-0x5BC1E231775DB25D, 0xBD14AAB4EF0F7D0E, 0xB16B666A646CDD6D, 0xA4B23B30157407A5, 
-0xCC196DB00BAECEB0, 0x823C20C85890BA32, 0x166D4CE5942EB, 0x92E0CD7EAC79931D, 
-0x98AC6027E2E6E739, 0x7C5B6749716ED8F0, 0x9587208313A6421A, 0x1A264889F1AB32C6, 
-0x986D989217672862, 0x6F058AD03407, 0x8A28D792AC68A4EF, 0x758DBEC36CFDC047, 
-0x4A3BB5480742B492, 0x737F130B7B7B07EC, 0x2C2410E5B8112DD8, 0x88461660FCA94625, 
-0x1A9B7CA9A7EBD, 
-0x3F0D55442DF08455, 0xC6FCFD68C4543DF4, 0xE8FDDA0B8B397428, 0x553102BC463B8655, 
-0xE5FBA8DFDBD0EE7B, 0x2259D7A195D96B6F, 0xAE763E0E16F1, 0x7C873A06F4E87392, 
-0x483291D3C46E6149, 0x630FCF37481539B1, 0x55749A6554255C40, 0xE93BD8E4541A00BA, 
-0xD6052323E9AB7DBC, 0x1D9E8E2B76ACE, 0x4C2240A028DFD1C8, 0xE5E61CBE05C1B35C, 
-0xABB89AB8647CCD2, 0xA652181A694CD8A5, 0xBE23EB2730D0E41E, 0x93A4368F83A8C22F, 
-0x7F25F33AE96B, 
-0x9BB49112E1992786, 0xFF567E8A6A208CC3, 0xE82B79721517C379, 0x3D25B6E13998867B, 
-0x2B1759EC761146E5, 0x848B6C4C60858B, 0x1581E213BE60B, 0xFAA58AB579DC241D, 
-0xDB9AD8ADF806E6C1, 0x8DD926E84E3C8530, 0x21A6AB3DC79E86B, 0x815E030F6666EF52, 
-0x83273E8F1FEC66D7, 0x910F40660D28, 0xE9D5AE8EF786F7C8, 0x381ADEFD696AE953, 
-0x11775446545AFE, 0x61047775DC13B67B, 0xD1CD714D5B833F65, 0x630DC4B85564086E, 
-0xF9019F945C63, 
-0xD3696E6951EAC453, 0x8D3A301B3D438D24, 0xC92AE0676C6F85F6, 0xF08D5878E41056CB, 
-0x5F01D4CC3F1C6991, 0x7A46CB006E86FCF9, 0x1ACB66191B170, 0x5DAB8F66ABC12F71, 
-0xD31ADC09529629FD, 0xCA5462533F93EBF4, 0x1FD9239820B35EF2, 0xC4006DB9D099E737, 
-0xD33F192F3C60176F, 0x194C33CCE9747, 0x34FEAF8B42A7E67, 0xAB831F7FA796DBB0, 
-0x1C079D015E7E2DBE, 0x9FD78DC14C4FB1D5, 0x32AE7FF62C72850F, 0x7CAAC8E174CCA7BA, 
-0x22041D2B129E2, 
-0xD6D341AA9C65FA0A, 0x269CE4DA19787A0F, 0x5C40364FBEDB730D, 0x1E5BDDF054C72EDA, 
-0xDAE41EFA9FD3DE60, 0xB9E24619E36B6BBA, 0x15662A66F5914, 0x5CD18C2F5D6C35C4, 
-0x9BED59102C378CCB, 0x2D42AF0D2A5D691F, 0xDACEE58A11F684A1, 0x197C8D9EA914E123, 
-0xFE0106C5A328B9DC, 0xF9958E1DD8EB, 0xE1DCB01D0EC5BB24, 0xA8C8965084B59D42, 
-0xF2AB73AF5445D89C, 0x353F3DA2A09B895D, 0x448A1BDA9F45BB88, 0xED4CA9F58D3CD69C, 
-0x18641D1221F20, 
-0x99766C73104FDD34, 0xA0EC15986B4E96BF, 0x56FD2630B8FE894D, 0x37F6E0A38F687DE4, 
-0x7155F8F92BD9CF3A, 0x10BAD4A97A19C91D, 0x2D12F4F62D7C, 0xBEEC749EB21AD7B3, 
-0x7E4A5802AF46E40E, 0xCBBDB4823045A57, 0x16C2AAF84AC0A36D, 0x73FCB5D8C923A60C, 
-0xC81696869435882C, 0xE7FBAC22A3A8, 0x1FA28C25DEC25548, 0xCD267A99D02AAA05, 
-0xA06C218D03F4830A, 0x88AA3FC65324C470, 0x3A1643BD10F7D37A, 0x2C077987A57ED136, 
-0xF8D12F1E90B4, 
-0x982B36BB77C84893, 0x21351AB71BB1755B, 0xD170325D69937E8E, 0xC9FFC37128F13C3C, 
-0x2BB1EA58B3E3B52B, 0x497FC1C7DB647619, 0x1BFF4F5970419, 0xA849C7DA82EAFD6A, 
-0x432F43E215122330, 0xE0697EE4307E6357, 0x8AFA2C96D5906B08, 0x62910BCC532ABA04, 
-0x8365333F5666343F, 0x17AB82A1C17DB, 0x20B0BC62AD66E26C, 0x83C5E378CA181D81, 
-0x30CDDC6C68519055, 0x2EE7B32CE5A3C27F, 0xED3BED5F9729B254, 0xF462AB18AF63ED41, 
-0x9B903749BD4E, 
-0x9E8B6D6ED4F2013B, 0x26B43C36DA612DD9, 0x15B847B36354D5D3, 0xA973422CC6C26BBC, 
-0x9090C35E8C528BE1, 0xAC6900114D2426EF, 0x222E4EB1A855D, 0x368DEBFE21C9F228, 
-0x7DA13C45615E58B4, 0x7A1EEF8121CF946E, 0x1389B603541060B7, 0x35939F7C849FAD98, 
-0x5612D5495886080A, 0x126D9F7666C62, 0xA59E23FFC30D7F08, 0x4E863412FBF7537A, 
-0xE12D5C2B11B3EA72, 0xFA2DA80117B7E529, 0x829D2C4BC870471A, 0x55D25AF55CAF0CE3, 
-0x17E58E9A60B00, 
-0xAE7AE0E86C75F5FF, 0x5F731A8E705CDE2, 0x58D769F2E36FF7DE, 0x695C5EA9378A6292, 
-0x3800F94F79ED92D7, 0x95571F8C30FCC4B2, 0xF95830B84254, 0x736DF6FCAFEE78CE, 
-0x4187189B5DC95A2F, 0x624AC9761F193886, 0xDDB9D8115854F372, 0xC0A14EFFC8B7CFB1, 
-0x98AB4109ABB6B169, 0x9A3B57476653, 0xFA5379F67D64F895, 0xE8DA1DC75B85E197, 
-0x66AB894EFFFEFF69, 0xD07F3ED21FD321A0, 0x50CF0F089CAD08FF, 0xF41CC7E5C71FCF78, 
-0x49CF3C122C1A, 
-0x8839927AF53F1372, 0xDB5E77050B6270A8, 0xDF500C79F8D3E234, 0x7397E4AF21489137, 
-0xFB074F540CF5B358, 0x24937D8B699276A4, 0xE2BEB58E1F43, 0x6C09EEBC3B808501, 
-0xD08F5CCBE480B4DA, 0x18A7DA53E2FA206E, 0xD1475AEF5FF06038, 0x224C25D316F1BDDD, 
-0x9DF5FBF015F68464, 0xF6CF4101CB6F, 0x77D66053CB379B05, 0xC30F832597978504, 
-0x2502B8604C8092DF, 0x3B8505BED298AFD6, 0x16A7F7AAA19AE877, 0x489084A274644201, 
-0x1520AE384EB88, 
-0x4ED3669DF211CE2F, 0xA947F59FB6D56130, 0x5638C08919F3E836, 0xC752FADE9CC53F0C, 
-0xA0F96535831E8618, 0xFC2AB5351383C7A1, 0x592D92B69080, 0x6E5D4DBA90CEA065, 
-0xF18827A2148F9149, 0x2D95C2B574EEE1C6, 0xE45DF60BA50CD91D, 0xF186C5FB7061474F, 
-0x748912DFBE7E289C, 0x12C5D5F96EE84, 0x9AAFE769FA51D697, 0xDE1047885327BA69, 
-0x6A5E24FF211F8572, 0xBADE71E4BCC6ACBD, 0x84775B0F03B8ABA6, 0x3A0B4AF076484734, 
-0x1EE715D2BAA11, 
-0x112166B515BA4D19, 0x86EC702AF6897D6, 0x15A1E4A44D712A9B, 0x7992F8B85FD31C2A, 
-0xA11306EAE3E7FFEE, 0xB886F4D254477E21, 0x8989E6AA5B25, 0x6840E0ACE4B22049, 
-0xFB9993EACC8508, 0xFAE632398F41F6E3, 0x6EEC63929229AABF, 0x67B8C615A76C3FC3, 
-0x6735EEA6B63DB765, 0x10C989056CD98, 0x5E0E035D4869CACF, 0x6478EE750E4BC97F, 
-0xE4510F8F46C1539C, 0x55BC95BCC99271FC, 0xFB9C777517663A, 0x6F3E119669FF2B5D, 
-0x39292ECF566, 
-0xAE520B158A1FF06C, 0x80A75BF1A049CF, 0xCB34F7C15C6EF9D2, 0x37BD230485704A36, 
-0x371D40187C0F944E, 0xDBC6C6F6859511C2, 0x22CC2104AFB41, 0xC4F21C38C5B85958, 
-0x77FC5A339ED63183, 0x7149B5D638A75E1F, 0x8384F5A1B6181170, 0x195FFD7ABAB3096F, 
-0xF85F05D350A77AAA, 0x119E4DD8CA9C9, 0x45C5BAC286EE7FB0, 0x4344528D50651C4A, 
-0xB6495C96DCA65927, 0x42904F323A584C6E, 0xC10D98101270F3C, 0xC7562A3AC2978FDE, 
-0x8B416F91D036, 
-0xEEAE7E7259BCB358, 0x18AF927D1101692E, 0x78987E28398D7C06, 0x3AF66C5F09A98CCB, 
-0xDF2555D6732D3EB8, 0x6C92E1BF5F717600, 0x138E67EF2A448, 0xF8319F1300F7D2DD, 
-0x91939965262F1B40, 0x51891307FA41820, 0xDED0AAF0E9A4011A, 0xA991918474E277AE, 
-0xC8341FFC284AD381, 0x1011F23114641, 0x92EEB0CD4A3EDA72, 0x37A29A8CCAC3443D, 
-0x5D9F1528FBBF870, 0x7FB61F292D692FC2, 0x88D15383FF4A56BE, 0xA6FDB103368A3EFB, 
-0xADD27B910248, 
-0xC010B9E5FD0B4E22, 0x1B87860533FF8C1D, 0x3F8520CB51C8A321, 0x16814AAD7B5281CA, 
-0x270DE611657E481D, 0xCF3CDF9123F41FA1, 0xF662AEEC196, 0x429C2CDDCC05C2BD, 
-0x7F3A3055DD5EF785, 0xA0E4E46191BBC4B2, 0x9E9460E9E12E022E, 0xDAF46BDB8E837D27, 
-0xDA58050843AE7588, 0x207DF30753B7F, 0x3550B48AC0200D55, 0xB745C91EE805D147, 
-0xAA298E7AE492D389, 0x704565166CD5D5B1, 0xAA59A4FB0BCC4426, 0x1A7CF78DAC86648C, 
-0x44B0601391C0, 
-0xD1A661450726B498, 0xB58BFB5D1193F955, 0x6FF51B55704C4C9D, 0x55E3C6E54F0199D7, 
-0xE11C76C9276C9192, 0xA7662CDC876A0A96, 0xD9E0829F8EE3, 0xF4BF45B6ADD51874, 
-0x8B3899A96438A89A, 0xF4E8550053FD8473, 0x42601A829975ACAA, 0x39C77F5AF67A046, 
-0x69240151C46BB4DC, 0x688A0B45CE62, 0x7FCA34CF8155041D, 0x904479945B8A44C6, 
-0x90115CED17794956, 0xD51DB352ECD38947, 0x48860447B4CD6A02, 0xDC8991BF90F26B11, 
-0x1523F7D99DBAD, 
-0x9D63610F7D3D2F33, 0xA247B8A729F6045E, 0xA6F3A4CC7D418900, 0x983D8C6E6CE8688F, 
-0x786C9C109ED1143A, 0x50743DF63D0CAA90, 0xCC4AA483307C, 0x8DA2896921B1585C, 
-0xA07A41C83691E425, 0xA288EAE31405F044, 0xBE28C17DC0BB9597, 0x818E8648C8B24F3A, 
-0x65EC5DA20D613131, 0x223F0551C0A59, 0xE2BD65B5CC4BE833, 0x1150F4749FF54D9D, 
-0xE768E05766B411D, 0x5C41D45CD9FFA54B, 0x672DA1B72A31AD99, 0xCF7002CFB6326951, 
-0x3B6968E09EFA, 
-0xE38BB4C3F4F620C7, 0x2E79F60B32D74EAB, 0x21DDEDD47725439E, 0xE5D9F6BF09DC77F9, 
-0xDFF664208756DD15, 0x428ACD53BCD120A, 0x1226BBB252DDF, 0xFE31E477C986BD88, 
-0x7AD0AD939B079CE3, 0x45F0FE7F39A77A65, 0x8D6EAD24A09845FD, 0x9C71DAEB9BBADD28, 
-0x12B38197606F8422, 0x101877C5DD102, 0x9C541EE9A0A1CA84, 0x55B2C6C7A15D6F38, 
-0x4ABB1535CB634990, 0x3A62123C09E11340, 0xBE09DD098D140749, 0xEF9567EE5A4180C5, 
-0xE7381E9AA5EB, 
-0xE345A5D1C0267391, 0x5F95A27369ECEFF1, 0xFC36026BC8DFCD56, 0xE4706A91F95D3911, 
-0x3B066AA2199B8411, 0xEEFDE56330889865, 0x15B40BA009FCE, 0x33C8FDD8DABC2405, 
-0xC62C02D4311B1194, 0x1957844458129140, 0xE9831E61E297C362, 0x9DB76C70BCD4C3FC, 
-0xE9FD990132BF4FD7, 0xF3504F8A78F9, 0x348AF93894735D74, 0x796EA6488296A85F, 
-0x8F7A74EC62EBC8B0, 0x53B43FBBE5B492F3, 0xC246950105DBCFFD, 0xF434493D77CF333F, 
-0x898EFAF26309, 
-0x2DAB6D0820CC0615, 0xB2ED03D5539FFD3D, 0x85ED74D694B9BB65, 0x78F6B5291A412D2B, 
-0xEA031A135DCF3B05, 0x12734A94B8B95848, 0x16EDB379F9798, 0xF77BF0E1EA9D4B52, 
-0xDE093F6538580471, 0x6017F905B867C6FD, 0x25C9F644F04E4D09, 0xFC479829C3E766D2, 
-0x4A043A6E53FE59D3, 0xD41BDC2E1B8D, 0x635F4BC2F9226D77, 0xC77C66E3959ABD25, 
-0xF31C0ECEA54E5F27, 0x85A272BD9DCC9A05, 0xFFCAF2D916B530C8, 0x5485831CE1226319, 
-0xD0B47CC61D8F, 
-0xF43CEEF41C8B5C55, 0xC5F2F562A4FB10EA, 0xA9AFB7F8CC902821, 0x51DB94C6D445B6FA, 
-0xBB7761B3707B30BA, 0x41211E5822CE20DD, 0x232E891AD2984, 0xD1ED3354B987504C, 
-0x72AEF8172490DDAA, 0xDB01D82F56A8635E, 0xFDEDD1EEFF62EC, 0x151F3FF349D4A001, 
-0xEA7B63C280789A59, 0xDB81758E1942, 0x331B87CC87DDEE57, 0x114832EB52ECEA6, 
-0xADF930A744B8453B, 0x67D838D15D42B5AD, 0x46775D0582447784, 0xEA89D0462DD5C91E, 
-0x1153FBEF53CDB, 
-0xA5DA43BDB0FC096F, 0xDDAA16CEAE940CAC, 0xAE3FBC8C349279AB, 0xE28C41678FD348F, 
-0x27B96FBBBBA37CE0, 0x5615718307991E57, 0x3BC3C98B48BE, 0xF530B1230AA0FCD3, 
-0x665A488958531090, 0x35BB424D0050BD5D, 0xE6BED192A33BF4D3, 0x2B84EA50ABC9D109, 
-0x5DFA07C324DAE3B5, 0xBA6116E07D48, 0xF2FF5CB16DAC164C, 0x302E38C76DAA9A5D, 
-0x92CC63E5E0FD5468, 0x51D7632DF8046B73, 0xC755E2B8731EEAE7, 0xF718DF52CD4834FB, 
-0x12BFD94EAB720, 
-0xD9889D6D1280CD16, 0x529FC0B8E1862BD2, 0xA22D3F7306E4469E, 0x9388D17F3AA53C4C, 
-0x796FE152F8A2FD99, 0x3F378694231DE2BF, 0x1E38273E3E7E3, 0xC6F8DEF4D664CE66, 
-0x1F9927D097D3B18F, 0x589B767C74678A7A, 0x4E22485AABD9A3E0, 0x985DC1E3F341254B, 
-0x972B717EE08A9546, 0x1BA05397A0D8A, 0x154E78C82620D1C3, 0xD417468647A3BAE9, 
-0x91AF7FC2E32AB089, 0xDF52C692757E68E9, 0x217ED2B2DB60A4F1, 0xE2F4EBF1D45E242E, 
-0x122F5CDBB25D8, 
-0xA6D0DF501959D27D, 0xCD58A2C210A6D2DF, 0xBAFAB657C1023509, 0xFA2A4E90DF61459A, 
-0x1B8D2D227E2A32A5, 0x518C4E16BFFE0B01, 0xE3B3F06CD1AE, 0x2AE40CA2237517CF, 
-0x1057E91B1E34C8E8, 0x798B723CA0AACFBC, 0xF8C4EBB86513A4DD, 0x5ED2EC691A9FBD22, 
-0x9AD0849937350443, 0x13F0AB9B3749D, 0x6FD59DD48ED29E4F, 0x73AD37F91F6BC02A, 
-0x6D69E86711514693, 0xC4E6AC81493C619E, 0xECF8957ACE020BB8, 0x392FFB5E5A30CAC9, 
-0x233E162CA13BE, 
-0x606B0E043703DBB8, 0x3EF82DA8F543BDF6, 0x1280E417AAB7A9C4, 0x98C89457480D612F, 
-0x55A5A0E73D9D8395, 0x1EFC4D4346E7AA25, 0x184B87AB398A6, 0xB43328672FB9B2A6, 
-0xF5135022A33F9D02, 0x86D9127EBC05EF2F, 0x33336B4E082F2113, 0xAD148250868D0D36, 
-0xF2E28025F009CFBD, 0xA9FA1C2958B7, 0xD25DB04C800210A0, 0xD16C3FD5C634310A, 
-0xFA855808AC027AD7, 0xF2DA2CB31A93C0A9, 0x5D9479C83398C784, 0x7CDF735EBC8521B7, 
-0x6F73C02CFCF7, 
-0x2FCC4A773833BB7D, 0xD04BDD554C99F904, 0x2B2ED3A903D304D5, 0x66A53F31DF18DED3, 
-0x5A9CB198137837A3, 0x96609B5A48894468, 0xDC64E6C06339, 0x7897EB11B6711070, 
-0x50E2819BF860579B, 0x1FE5262AC4F8748F, 0x78B28D888A48AE50, 0xC731F0B03F1116F0, 
-0x59FAAC280C694B5A, 0xB3E49ECE7134, 0x28843823DDBB920B, 0x22A4B937B8867D4D, 
-0x1BF40909C48AC2ED, 0xB97186A08B17908, 0xFADFB9841E862353, 0x676494AE782F0AA9, 
-0xCF539612C621, 
-0x78BE5E202622D06E, 0x84D3DC1081AA2BED, 0x8575A16213B45A7E, 0x1929E9FE9F259C83, 
-0x795C8D53B1CE6F0E, 0xC0C39F424B767E7E, 0xD4BD30818760, 0x6844845EC1A7DD31, 
-0xAA3EA7E6061B386, 0xE93CE99F5B180E05, 0x1D8F2B05965E2776, 0xC42DC299D11DB097, 
-0x6B41E262200D6CE3, 0x1935DBF7EADC7, 0xFC4119977EF52A2B, 0xA71DB91C2D7A8815, 
-0xE88DE1FB970CCF4E, 0x5FD7D3C40F6D0B88, 0x85147C5B3667DF75, 0xA7A5DE2B7857B29C, 
-0x1291C7CE345AC, 
-0x57E72683298B9229, 0xAFA5DA8CAE3F8629, 0xF9DF3595F07CAB62, 0xABE139025C397B58, 
-0x43202C1354BEDFF9, 0x37911924FDC094F9, 0x2107D1C956D1, 0x7E88D1012A9B2B1B, 
-0x3DA110E73B2FD926, 0xD549B788F7EC7705, 0x268D1A15DC8BDC08, 0x9807DCF1728C622, 
-0x5A5A5A72FE302DD9, 0xEC660A640F3A, 0x171157ED47A21E71, 0x311BA5ACCDC854D9, 
-0xC68120C1FE1BE015, 0xAF3F221E7E1F541B, 0x97C8C1898B545EF8, 0x145F8983A2745455, 
-0x2299F617AF7ED, 
-0xF4B10D80C76E2639, 0x430A75E3CBD13271, 0xC2FA5F3D889B8341, 0x710984F3BCC0EE81, 
-0xADE87C9B8C0D2524, 0xEFB2758EA1AD0D1F, 0xE9C56D5CB170, 0xCE0FCFC28E6E452B, 
-0x7DBA8D37E5640736, 0x1C9399FF513A963F, 0xDAAE4FF25EF11542, 0x23CF54B1247B57B1, 
-0xD53DF587081875F, 0x1B76FF559708, 0x94F0F92618D699FB, 0x5891CA1175B01FE7, 
-0xEE8D50D495DEB9B1, 0x278E0CCCFF6AA2B5, 0xDC171662EDD209A6, 0x6EE787237CA7C1B5, 
-0x2108141E5A802, 
-0x1D8DFCCB16B200B5, 0x14FB2EBB54D331D2, 0x28DFF699CE5B1D74, 0x44128657F412F55B, 
-0x4025722B7121DAE0, 0x2596937FFEC24A2C, 0x384760E7FE76, 0xFF1B4AA5B0941651, 
-0x9EE1404828F6F0E, 0x4445BA71B3DDACF1, 0xD2B2A7AE03E834CA, 0xA296DB6A900F4911, 
-0x604934C557B74AD1, 0x108F2976B3AD6, 0xB87058A52BD5FFA, 0xBCAF7BE53992436B, 
-0xC0B66BAFA8A77A1F, 0x99461047EF1AEC1F, 0x1F1C8E18BFAF2459, 0x210D8DD96CB1E1FC, 
-0xA7851A34C031, 
-0xF765528E4B4BA9C2, 0x1063C4A2F0146747, 0xF047DD7B8E5B387C, 0xDD833540B34FA5FE, 
-0x6936C8784DF0105F, 0x44496DF23B8369F6, 0x1A2E46723F58E, 0x674B3E8B4D276C92, 
-0x25B12CB4C1E5273A, 0xACC90537EC54FC90, 0x9804AC89FABF39D1, 0x2BFD0A63492D00F9, 
-0x71D53946A2C3DEDD, 0x7B9FBD67C01D, 0x3C9D54EE74EE2470, 0x2C8AE0BFB25302D2, 
-0xCA2903965930AAD8, 0x3ACEBB22DE157FC2, 0xA1881AEAF4BEBC8F, 0x885FCD2DBBCE8380, 
-0x10830D500E15B, 
-0x34FBD138C0A2E859, 0xCCDFC33C65E43639, 0xFA4B682B2D07F38E, 0x4C7CD2949AB02B1A, 
-0xF24424E87DA175F6, 0xD3C4366077FE2E86, 0xB14D1FE272B1, 0x7E258E3296B20003, 
-0xF762D9151D1EA233, 0x2BFF26BD2C813105, 0x61E75C78E179D7E1, 0x6B44153D6226AAC5, 
-0x2A7E968D4023B648, 0x17C8FCB67B4F2, 0xD88689D22C585D9, 0x5F71237E2EFB9C19, 
-0xB1DCFCBEDC185A36, 0xB17B7F006D65065C, 0xC9902AD7256C0FE5, 0x7568C8768E9E8355, 
-0x1B545152835F7, 
-0xE794362522F4A72D, 0x9CDB852DB9738D95, 0x62181633E73B1018, 0x158C0056698372F1, 
-0x4A071D4A179D92CC, 0x482BCD1F612D26B, 0x2089139ED4557, 0x927E51F6373191C8, 
-0x4809D6B5DEF910B0, 0x52258A9D151E4D2A, 0x8A3FD9070C614928, 0xD32F8FFADB2F6A89, 
-0xD1E687584E1B9663, 0x2014D140F8C80, 0xBA1B9EE4C60BC9B0, 0xB00F45449EB5E057, 
-0xD2460C2E65FA8AC8, 0x4E0D8B345D83239, 0xCC33D75BF60C19DB, 0x656CCA61EDB7CC9F, 
-0x1D488D02E016A, 
-0xF2CDD9CAD47513AB, 0x9592381B1962D2CB, 0x6F1DD8D81345DFBE, 0xF80ADE19A34CCCCC, 
-0xFD63699D448D7E80, 0xE326AC7C4FB6BFAE, 0xF441A22A1C70, 0xC949CC973FFC3A2, 
-0x1E6C9A28849520DE, 0xE7DBD9CD41F5992E, 0x9C2F4AF9D44C969D, 0xF73BAF0AF45780FE, 
-0x36C4CDA508D9794C, 0x1E850B9845BFE, 0xD919F07A05CAAFAF, 0x9F18A862F442A2D6, 
-0x79F831FD2A97B879, 0x9987F0DF81174DA6, 0xC983C8EC8DDB9B4A, 0xF656BCE03EE4A662, 
-0x208494A1EAB0A, 
-0x3E653BD6A2BC85BA, 0x9EA04F24D3B02703, 0x786DEFDFC5D4F6A2, 0x8044AC6D8FD4CC91, 
-0xC1D9BC6D3AC56615, 0x6E79ACAE603C235F, 0x13D43210C059, 0x2FD0363EABAF0456, 
-0x4059B27BBB4E650, 0x2357E36B738002B3, 0x168DAE28F8B2744C, 0xD55AF9843075E46A, 
-0x11E94E93F66CA78F, 0x1A71B1B41A7A8, 0x618DC0B85ADF04C, 0xBD261A33043F16CC, 
-0xD2F35FFF5639D3DB, 0x8AE7C2B88EAFB607, 0xEF19079A730E99E3, 0x79294FB02F129B7E, 
-0x230DF964D0C2B, 
-0xF0B68D0EF0D6F844, 0x681B2CB7F791727, 0xFF6D547AD5C6BBC0, 0xD0CD9CE5564B90DB, 
-0x76C30CB919096825, 0x9B420EE3C6EBE946, 0x14D03D8BEF2AD, 0xC5D9854C3F47A53C, 
-0x555AC6FF73723070, 0x3A4AEDDDB37FC12D, 0x2F48010D225E673, 0x5960FE9973318F52, 
-0xF0971747E94568DE, 0x16538A8686F3D, 0x9F86CB7A864BDADC, 0xE39F480451FC2944, 
-0x8B2C96470E5A8EED, 0xB4BC404B53A78853, 0xC8392A5A610F8609, 0x37666D17185D8C2A, 
-0xD61F19F8D590, 
-0xE3F9CA11C347F21F, 0x9C5F0B053126BE4D, 0xEE90BA59DD4080C5, 0xE1EC570F161B2457, 
-0xC3FCED00F1D284F6, 0xF2D6803573CEA3B2, 0xEF609FFB6CBE, 0x6AD053CA234CA572, 
-0xD38BA45BE0C40522, 0x54AB67AEDDB865C5, 0xEF26A8D4C95A90F3, 0xE8A557CCB8F97997, 
-0x7B4AD59D3E0ACF65, 0x1BD108E861A32, 0x7F8F4FE7D1307A81, 0xB6E15EA19D04DE89, 
-0x289022FF34D6F164, 0x2235D5488883DE64, 0xB49CFEC222395EB5, 0xDF16490FF92B2EF0, 
-0x1E4E682F05C68, 
-0x3400570EBF4F0F14, 0x37C8C495C85D56CA, 0x996647EE855DA493, 0xEFA88EAEDCA9DD3, 
-0xE4CDDFB198ADE043, 0xA7F016B1201AA942, 0x203FE00F5306D, 0xCBF33DE9CE66E72, 
-0x63F39723713ADF51, 0xC2F9D49BDA02214B, 0x490734377DCCC85C, 0x8043B3BD3C698B53, 
-0x2B8E30D4B26B8A34, 0x18C7FBB5283E2, 0x35EC99377995D535, 0x90DFAE57AA6FD576, 
-0xA26A32BFEA846D10, 0xAE31E473249B5E5F, 0xD99A52981890578E, 0x5BFFAE3DC2DCFE00, 
-0x116B1BDCCD54A, 
-0x77930D5B0D1515EA, 0x5E88B99ABDFFA177, 0xCDC1E94905CF2EC1, 0xE3985146BA3E895B, 
-0x4BD1F138B8E98D73, 0x32C70187FED2C1C0, 0xC14C9D918586, 0xD26A42EFF144D2DA, 
-0xAE51B4AC93E97249, 0xAFD523D101813D35, 0x6CA665D6793F9A38, 0x650B6090ECBE4FDB, 
-0xFD10B1132204AC01, 0xC24D5EDCE75B, 0x1213DB60B55680B3, 0x22E42ECA7DD21006, 
-0x670CF19ED211E978, 0xB99B359C8E7EE458, 0x84FA5E025A25D79A, 0xD58CE95A1CC77AAB, 
-0x19BF2818C2D11, 
-0xE6FF85813CC4EDCC, 0xC05225DDC53D3FF9, 0xA4C8D4D0A2B651E1, 0x95A3F1A4A992161E, 
-0xE222D61AB6355E2E, 0xCCCA276B8AE5B296, 0x1E63D8298B61E, 0x3AE1AABFA7BB0FAF, 
-0x8DD12643668D5C3, 0x1A4E104CB28D9030, 0x128D0F7D979F1365, 0x2190A2325B4D61, 
-0x34902E405161E575, 0x11011655F84AA, 0x74DB558B1AC08D96, 0x82D49B4435332FA8, 
-0x8430C728238EBDD5, 0x2F2D0A8EE7589FEE, 0x70C476F26584758C, 0x7BE1C7F205752713, 
-0x9562B99261C2, 
-0xA2DB08A51BD073EE, 0x2432380F66E2808E, 0x8464CEAE12A4965D, 0x8A8797B75B31CB5, 
-0x939442FDACA17FC6, 0x51079E2B60E8E67A, 0xBB33DD2578E5, 0xBF70C0A23E7A5DCC, 
-0x5C6041EED04E65E0, 0x78250EB2E6C5F073, 0x523F0761C14C6E4E, 0xA65C89B9627D52E4, 
-0xC895E81CBF189513, 0x3AD7E27FBD78, 0xCC72DEA9331F0069, 0x44AD99EEE844A27, 
-0x243086F78F554A1C, 0x649AC2A7099469D9, 0x1DE9F90ABB63D324, 0xB4FF993A55D07AE4, 
-0xB935B3469C7C, 
-0x7A234F6351008DAA, 0x650F112609094CF, 0x8CE7E713C145A0CA, 0x2A185F475736C663, 
-0x2DE2E07936489F7B, 0x49C3D7203D0D761D, 0x1F672619BC433, 0xFAA836B6C1E99016, 
-0xEBE07D5EEE7D860D, 0xCF960E525DA09081, 0x686D65A136153EEF, 0xAA28B64C17C1FA06, 
-0xCD268E9CA64E8BC4, 0x14A4D34273239, 0x47A91FE6F4F33FCA, 0x1EB3C146EA8AF366, 
-0xCA79B729CCE76B34, 0xF3B521B2277FB500, 0x5365945372A16966, 0xD0AC98FC5E4EDCE3, 
-0xF543DCF5EB33, 
-0x301C04CD96DED4AA, 0xF17335688CDEFEC3, 0x2E4F7610B347863, 0x4F610AF2B39FAC5A, 
-0xD061538F2ADDFB62, 0x525D439ADF313F47, 0x1883FCF08D9E0, 0xE9AB716B9399538F, 
-0x10D725BB0CB41B01, 0xFEDBC320F18F1A93, 0xF980D3D28C7F9258, 0xEF815801B70F861B, 
-0x3ACCC7E2DA2A54CB, 0x145932BD17E7A, 0xF4C592EEEE53F6B9, 0xBC295084D2BF9926, 
-0x926C7A7712C768EC, 0xD41D51AB263B9B2, 0x72508BBB3229E91E, 0xD6FCF5FB059ED9CD, 
-0x4293AFEB0983, 
-0x2EB58A6D489FB27, 0xFFF1FEAA7B2294B1, 0x8E5F8BB82F22E0E4, 0x425C4F439ED226FD, 
-0x87472834294B091E, 0x14C6C54DFD9C69A1, 0x1752B22793578, 0xEC1E13EF6AEEDC03, 
-0x657075803E53909D, 0xC350E7D2D3066CB4, 0x408ABAB675C609A3, 0xC0DCCF980ED1D08B, 
-0x42A7E9C218E0172B, 0x1534730A952BE, 0x8C9B7BFF78E757C7, 0xC9A02632E18D33EE, 
-0xAF6BA3547C7B5B5, 0x3E08307ADD136239, 0xF9FAA76416A77DF2, 0x4F690B26FE43BE2F, 
-0x1FB8AD5CDE633, 
-0x587DAD752BACCA0, 0x7E2C0C487E90BBF4, 0xCBC6FF5829AA4ABC, 0x79E2E636B5E3E93F, 
-0x9C99F006C2B70BB3, 0xA262CE0FF3E781E4, 0x1AE4B1A48298B, 0xDFBE385C1F05D481, 
-0xC9D310D30BB002C7, 0x8A4DF6B873826BDB, 0xE422A79A1DF45B0A, 0x8139BE7A1E536183, 
-0xB57BDA077F024FDC, 0xEA77109A0BE5, 0x142009BD5C32C014, 0x55E04974F0416D70, 
-0xFFF0E6DEE9588AD2, 0xCB279A927D6A7321, 0x76D3316030B8D71B, 0x1CA80155E1EF4BEE, 
-0xB30C0FE90C15, 
-0xB684605EB60F5CD1, 0xF37776387F490518, 0xFA39E744B6DE8D92, 0xF579F767029C1CBF, 
-0xE943E94DF91C2A9B, 0xABC0A1A3F4F55BC4, 0x258B7F5E8902, 0x41993BEE1555702, 
-0x45696D1976E9C06F, 0x75FD01AA22A00CBD, 0x2BE5E74BC3F5087F, 0xD1121019A0680B78, 
-0xE5D3AC242FC36128, 0x1EE7C23CABA88, 0x78E242EFDD9F6592, 0xC12686605D7C701A, 
-0x401B6D65133C6C03, 0x94134BC81265ACFA, 0x4C90D258C5911858, 0x60E050B43B734941, 
-0x205ED43A746F6, 
-0xDDBFD5974FD45EB8, 0xD2F7C511D6B5AE6C, 0x17B7D41E1437F95A, 0xE09CC1F139088AC1, 
-0x10340A9E075D1C86, 0x683484A5E1FB1AF0, 0x15C0F3E56C231, 0xA8FBB1CB7E2F9432, 
-0x4E672084DE87E254, 0xDFFC125D604DBFAE, 0xFEB9BF3FA0E3C73D, 0x3E26A27AD6CCBBFC, 
-0x79F38C26D6CCDD45, 0x9511231CCDD0, 0xBA19E84DE0A36558, 0x8F8855C89FE98588, 
-0xB965D2C14D46EDB2, 0x33B7831F5BF98D8A, 0x4DB6EE477BF29065, 0xA28484109EDDC13, 
-0xC0482216597E, 
-0xC56FB8C8650BBDD7, 0xB64C9DC5A984B2FE, 0x11F5553BDC0F0184, 0x922DEF124B57747E, 
-0x35E434C559290EE3, 0x7A3A555D2593772E, 0x1B7F0C8C8623, 0x332C0AEF5D326416, 
-0x270B50CE325F491F, 0xF55E54A726FDFC36, 0xA60A0BBE6E9274F4, 0xB2234EFE104FDE29, 
-0x5FCF4DE2F26AA370, 0x87F13C53A25B, 0x67A59C5441A2C320, 0x75AEA67306A16540, 
-0x567FFBA7E9DB8BA6, 0xDABF7F0C110DF151, 0x6FBEBE27760CFE20, 0xCF5DD2F0A7219A99, 
-0xAECB925AF651, 
-0x3C138763CF994A72, 0xB53ED28A746AABBB, 0x22080277B9D6D8EF, 0x12C6F070755F0953, 
-0xCA1A6ED2B89CFF6C, 0x176AB0F706CF3884, 0x1DCFED1FE08F5, 0x62F823016BEDEB17, 
-0xC74340CC1E369999, 0x829753DB1D14C9DD, 0x9A9B83CB89111505, 0x45EC3BCA9FFFB293, 
-0xA1807E3D444A9C76, 0x2339AFD348D88, 0xC854CF4154A99456, 0xB474ED6CFDE85BB1, 
-0xB35E9F9D3E0F724C, 0x2EBE654614F7BCC9, 0xF0CDD0564F8CDBA6, 0x9A9B57864C1E9387, 
-0x1A1C5E84E8E7E, 
-0x9375DC2C7A3D088A, 0xDD9A8F8052949DEC, 0xCCFC13B4DF856898, 0xE8CB80D11773FA85, 
-0x73832D1799BE2187, 0xFAD91DF4D9F8D50, 0x12FEFD8E87E1, 0x323E5D702F6FA503, 
-0xE80D3973D21B2F86, 0xCB67209EBF32F951, 0xB4FDB1A2AC3540DC, 0xCAE8E2A6BDD6AEE7, 
-0x903857BE73C91DF5, 0xF1D03B13A043, 0x3D351DB6917538F1, 0x66FC6D6D61DF35D3, 
-0xF9ACCBB9F4AEB7E5, 0x2F9FBF5987A6FF8F, 0x6D817118B09E9E4D, 0xCD5A0CB965B5B58E, 
-0x52CC30F434D6, 
-0xADD3A0079D75DD73, 0x2D6B210894ADDA68, 0xAC543D1C7B7E8292, 0x3A6033E751D57E42, 
-0x27A1CEA6CE0E07E5, 0x338DB4F5F493AB34, 0x1D53EE74CF543, 0xCD7FDFB89C36DD5, 
-0x4A3CF9D5EA5D9ACC, 0x37B2875FD4DB77C9, 0x7E74C8AB712522AC, 0x40ECC3DDCBD05071, 
-0x6893613FDE3542F5, 0x1F0EF414C1114, 0xE8146898FDD3BD40, 0x7ADC4A7C2A15A971, 
-0x66F68460C56E3F95, 0xA1944BB650115B8B, 0x8B52C1776D022158, 0x86849A9FA0A5876, 
-0x18E46F8D5286F, 
-0x38AC52A8D13C0E3B, 0xE24DB7122E13E0AC, 0x1E3311A924D40B6C, 0x63C7842722DD74A7, 
-0x74D5562DD7805531, 0xD1E73CAEFC80ABCF, 0x21E193D7CFA78, 0x302B1D4F2D03D003, 
-0xE349BCB6BD1EAEB7, 0x5EF87BDC28D31474, 0xFE185CB3FB65AC1, 0x79402C193CD4D678, 
-0x3022CBCEE94AA868, 0x144BF372494A9, 0x7008F2BCFBB126B, 0x54893AB5D5936BFB, 
-0x554A0A1BE77BBFFD, 0x8AA3064387DB11B9, 0x23D59D045973554B, 0xB35D58ACB226C96D, 
-0x89915CCF38EE, 
-0x3EC47527F44F7F2A, 0x54FEAE18D9AA940, 0x27D744AFF4E7FBEB, 0x49D428C460C49881, 
-0xCF93FB15F27A70EE, 0xF7BE22A4CEC0F587, 0x10CD6F7FA6E4A, 0x9B175D83CF043DDC, 
-0xB79C5256D1A1C515, 0x3D2F83212C2D857C, 0xB61EA8593125F7D5, 0x3D88EFB357A8EF99, 
-0x744FDFA4E6B31F21, 0x161134E1AA461, 0x21D0CDA24053EFC9, 0x624117E76F92037E, 
-0x998A57D25BC89D6, 0xCDE8E5E333DEAAEC, 0x918C077547B931AB, 0x52ADFB86CF158DC2, 
-0x456FA09C576B, 
-0x76D8B5A17744F984, 0xEC64485FD9175E9C, 0x931D80DC85FA78F1, 0x546B5217D9EAD70C, 
-0x88AC8FC34A9F5D97, 0xF0316D811E81A3D6, 0x46C9339AACF0, 0xCBB34B9D89BB43EC, 
-0x86E7EC61A5A23B15, 0x86D7CF1B45167C7F, 0x87D3696DF4BAAA0F, 0xD3530A33170616BA, 
-0x1ED9756A83DF90E0, 0x222902002B703, 0x1CA6C3D2B2E2E1E0, 0x16ADFC353257E80D, 
-0xE9C5BF59006614CD, 0x36CA15F5582A3DE8, 0x5358BA58B5207D48, 0xFF4DC683B7FCFDB, 
-0x1F608EE98158D, 
-0xFC28A4FBFA65DA8B, 0xB1474B0DC0BFA92A, 0x2C8EF2C7622C97B2, 0x68C10BEF3E0C95C6, 
-0x8A17AB524DD917E6, 0x197857B8DCC360F1, 0x1641150FDEA2D, 0x5D3AEBD878427AED, 
-0xA595F596D56EF34, 0x58080EC5F25702DA, 0x4B04B56C669D122D, 0x98232D1AB1A7BF76, 
-0x2D8A4038FFCF6CC1, 0x1475E35588A65, 0x8F1A467E185B02B0, 0x4F7D39C893FA5BF5, 
-0xD791AD1ECD2BCA0E, 0x358DC0B01FFF616B, 0x68ED91B60BADE7B9, 0xB06427632804D6AD, 
-0x87A43B9D5D31, 
-0x1800B8FBB8FC798A, 0xB03A02285B53AC05, 0xB01A2CB5FFB7CECF, 0xC868699292F52BE, 
-0xDBE4590776ADC240, 0x20B3FA20AB7EA465, 0xDA80BA5B7741, 0x4A18ED41CD795AAD, 
-0xCD4B539C65280673, 0x8D983A9724260496, 0x9E0A2830B3CFDAE, 0x6BF2A3FF55446C38, 
-0xEFB3FA72C00FB5C9, 0xBB57EF9A59F9, 0xE0011FFFB13DC712, 0xD48B19945DA4910C, 
-0x3E1BB665AA46C470, 0xC07DDFA9D7051FAA, 0x2C7DEAC9CEBE157, 0x3C2B317A39ADB6FC, 
-0x1510800CC8B59, 
-0x8B7F2D718EEE389, 0xF568B2597D5DBB4C, 0xF7BEB892EC39F50D, 0x7A1991741A93FE7D, 
-0xED75EFDC263CAF91, 0x5C8CF66EED677667, 0x60B56AF7D72F, 0x3C8E9A3B2441F7F, 
-0x7986CD3EFC13BF7, 0xBFE8838766AB09A4, 0x45B59C53213A4A9D, 0x5E5F0D09EE0556B2, 
-0xD23A31B23BABCF13, 0x2252F6842216C, 0xC2D09281803834EC, 0x1E97064D1A2C41DF, 
-0x87FD828723B958E6, 0xDBBF6EC42BA6CFA0, 0x108F46BCD53843AF, 0xD09587C708D8B6CE, 
-0x189C8ADB3C20D, 
-0x23C7CDD6D100CFEA, 0xC9F19C20ED1184EC, 0x9C8D90A57EB0098E, 0xE2E05BC2E130FEE9, 
-0x40B5AC71F9317C44, 0xAD4CDAACD0C49D25, 0x1F6B5909F3C75, 0x8BFD81B32A71F2DC, 
-0x99CF65C5F1C2AFC1, 0x5C0E7AA28F725F4F, 0xA7ED4C812B1CAA97, 0x74DE912D9C490B68, 
-0xF200BB350DB70B4C, 0x21AE752818364, 0x917ABE0A58AD0B49, 0x75D96809F6DCAECF, 
-0x86694E0F5F9B94B7, 0x367CBB2D8991508E, 0xB50B4A52F7B73A03, 0xEC4C99C657326F53, 
-0x1063B0D5A0270, 
-0x7391227E2F3940D2, 0x16546E147F1085E2, 0xFF0004AF6F2B0CF5, 0xB74EDE1CAFF1CD05, 
-0xC88958F4E05A02D8, 0x692091B124383D3D, 0x1C59E491C9DBF, 0x3C138B2667FE9624, 
-0xDB2EE5BF287DF247, 0xE7FC10A195AE5E75, 0xB1AFFB47E106DA7C, 0x42A7D67E0C3063D7, 
-0xEE6A36C2D51FB3C3, 0x21EE9FE1E523B, 0xC4B428465B34D1D4, 0xB6A85BE9F4E145FA, 
-0x7F352009EBAF0E73, 0xA7395F4D5496FC9F, 0xB22519FDC5CF921E, 0xA62049ADD545618C, 
-0x1D3429C7DD58D, 
-0x2866BC18CB46BD17, 0x1C58D567E13DB996, 0x72C4A57B5D5A7541, 0x201DDF99CC6B3BD6, 
-0x3D7A2A4AC0DA245B, 0xCA51DCDBC07BD234, 0x5110BAA3D089, 0x1116D30EC55E2CDF, 
-0x469F44626B9451A8, 0x5B6FAE4F802265B2, 0xDE5AFE003510C2C3, 0x84001F3737E6E5B3, 
-0xCC892254D0671BA, 0x1216BDE1E7437, 0x571AA7461F23ADF5, 0x7CD8A68F8546A671, 
-0x33AA613D421E560A, 0x92B2FF22E9BE3F3E, 0x25C4C59534E579A7, 0x204FD28E9EC5E8A9, 
-0xB744BD89DD00, 
-0x8BDB47FE78C58A63, 0xC8AF96E36154ED6B, 0x48CA77B0CDC0D9FD, 0x4A76F15402B4E6AB, 
-0xC54821764B36706E, 0x3C310BC3CAE37214, 0x156B0323A0EDC, 0x11C4B546AB650B, 
-0x2FB1832627AB7A36, 0xE928DAFC1EC60447, 0x614ED00BF97455B, 0xA06BAC697C6C109F, 
-0x7E0789D8C01F7692, 0xE43B338C83D2, 0x13D36B2E0A82993C, 0x82F771DFDEA9C153, 
-0xE7C2D2BA3621193E, 0xEF4C94DA9B01B3B8, 0xE1A0C29966E8EDB0, 0x715B1331197EFB71, 
-0xAB8D2681E7F1, 
-0xCDE41A4D8A7B2F38, 0xA17198B6471E015, 0xA6892808FD52E49C, 0xE790A5A9BA1F0E6C, 
-0x6C72246B49A57BBF, 0x4C7EB3DC4638D272, 0xA8321E2F343A, 0x4C693DF2D402EA72, 
-0x1F66A4451F1FA9D9, 0x6B7A389E612C81B0, 0x24845D952DD3C2C5, 0xAAF1A3BAF75436E9, 
-0x4046EEDFB08F1E47, 0x1FDC2B1AE14F2, 0xD09C7048B2693602, 0xC695F335861CC110, 
-0x3D753B4DC95F0D4A, 0x147503B9BE53EA72, 0x54B5A00195E2A82F, 0x9C3C20E78077E728, 
-0x860054859461, 
-0x644172A1EA9E4088, 0x206FF42A4F4A348, 0xA93C783264D738A9, 0x631D107D59F640C8, 
-0xFE0BA60D5B04B5CF, 0xC8CE2449FE2EBA76, 0x15678C7BDA9E5, 0xF06C1736F9B15964, 
-0xAE17762508937BFB, 0x56FB2C75A284C71A, 0x37E0807DC1E42489, 0xEE72E0DC7E893FB1, 
-0x8E53FC875D42A13C, 0x719FB8FBEE26, 0xCDF93667CDED5DC7, 0xC6F00BB3DA476B48, 
-0xE7D67CA55432F05, 0x3D89F1D7EFFA56FE, 0x707DAD6CC7F69745, 0x4BD786B67A96D6C4, 
-0x7EC9B721B144, 
-0x7A9147565FC88C2, 0x38F9DA45BCFAA755, 0xB45C3C0BC75BAFA4, 0x23FDCFB2BF1F4AA3, 
-0xD4B06526852F4729, 0x94B3B4CE42C8826F, 0xE6E131FF7431, 0x50115ECD29C252AD, 
-0x563E32B8C8F96EB6, 0x3475096041F619F, 0x4C8AE40BB5ABD7E9, 0x82DDBB833206A05C, 
-0x5D02B459BC59C29A, 0xA790B0BEDB7E, 0xBEEE458B606566E1, 0xC9FF6198FA803325, 
-0x5B95D01412CE2003, 0xDA2EA59D7FAEE8F7, 0x5C2B20ADEAE0B6DC, 0x5FEBE137B4CE7255, 
-0x120EDD9EE527F, 
-0x8C9E2F1E345DA0CE, 0x8EAB7800406DEAED, 0x2A9F68A067B46DDB, 0x6706A08ED4937B2, 
-0xE2F37840CEDBE1D1, 0x39A4D5E6D00AE582, 0x18407837E6928, 0x7085353078CEF7CE, 
-0xFE0521C0E4B3FC18, 0xD2AC37E4A8136051, 0x1A51C993D7D8C202, 0x76D8D888A3609C94, 
-0x4B31571DB735A83A, 0xE6912C387E83, 0x2AD470C13F5BE011, 0x5A25E2A5170E1687, 
-0x15E32F5F6FD25315, 0x942790FEAB3E34C0, 0xE7A7379C8989171, 0x5B0BE6E3C01BA44B, 
-0x16DA8BBF2656B, 
-0x1D573E6738D507E5, 0x6EC3CCF804604CCE, 0x68C2B5B032402C80, 0x4332F1E9C6EE3925, 
-0xDB5A5011AD12422E, 0xDA611B7E0514B894, 0xC997E4B07614, 0x2ECA13A788636A2D, 
-0x19C7B8747FA1CB3, 0x3CBE8316B19C8D1D, 0x63DB466A8511E55, 0x2894B2485EB7C911, 
-0x91CF8FB66AF0985E, 0x1A9B449B0870A, 0xBCA642E857C69A6E, 0x2A33C733CC98648, 
-0x93BD861ED33AE173, 0x721CE8F40BFA0C74, 0x86B59D0066D84CDC, 0x32AC4109842ADE0F, 
-0x1C9CAB1218A38, 
-0x14164E4BA40C66F, 0x89919DD73E4FFD73, 0xB7D9D85605DE8EED, 0x953E311A1E984E8D, 
-0x59B0DB523A0B70D7, 0x68C9D0ACD8582C56, 0xCCE90FDDB59, 0x60C103C57AEAC2B, 
-0xCC04A384ACE34985, 0xC5E3F037F5619732, 0xEC811F49B2E13282, 0x68F8949535C6699D, 
-0xF6E1CB5C029D9574, 0x1661F1FBCF906, 0x17F5F87E581DD90B, 0x76C75C6DF6ACBDB4, 
-0xF8425252A03D20EE, 0xCFD56D2E1396821D, 0x72C8635D8D6AD936, 0x49DA47D5A840FEAF, 
-0x18F8065DED14E, 
-0x81C7F31D8220B884, 0x3A412B3001EA5CB5, 0x873E7140CBFEFEC6, 0xB2B2CC6B88AC84C5, 
-0x8AA5AFECDB5A5E46, 0xBECBA35116516F27, 0x1A5B415733677, 0xEFF17513DAB4D8E7, 
-0xFD6AAF0B8982188, 0xB0F4E4E1B9B6E64B, 0xBA1F049576763849, 0x775F9B5189A008D6, 
-0x5A204B35C39C21A0, 0x2054328F3335A, 0x64E488C8AE2102BB, 0x7E576576DDB0FE3D, 
-0x4FA1602913AB5887, 0x4C9CBD4ABD1C9F34, 0xB762D5E4DA2A5C59, 0xEF256164ECE4DF8A, 
-0xD8DE48CBB4F2, 
-0x30F5D8DD9BC09F3, 0xB8F7DEEC7D0D26A4, 0x567A5FB5D33C194C, 0x552D3E7DD367353B, 
-0x9228546BD3208263, 0xFC29154E4F455D64, 0x1CE3C35CD8991, 0xC305106B26D2C77E, 
-0x26C4FB697C1D807F, 0x96F34594B87AFF3E, 0x9819AC00B484843D, 0x707A6C70D9A41C8, 
-0x36A8FF403940ED2, 0x15A422416F895, 0xD5713D0161251F67, 0x988F6AC779B32BFC, 
-0xAB6E9B87FEA799C4, 0x196274F2768ED7B5, 0x34FE23EE102F317C, 0xAA811D9E41C864EC, 
-0xB62A2ADAE17E, 
-0x639E0FEDBA8F533A, 0xD3EF707DD977E1D8, 0x8B5100CEE274AF72, 0xC964AB539057A84C, 
-0x359182836A510FA1, 0xE925CDFEC4EB535E, 0x155EAE50CB348, 0xE226A8DC0FAC8160, 
-0xA9A96D6863695A58, 0x735AF6C9BC45063E, 0x4662B8CB37E7185F, 0xA8CF11BD0F2A31C0, 
-0xF7078CF89E67F676, 0x22DF11F1DBA72, 0x3135C0E9A66549AC, 0x576E31C4026E58C8, 
-0x2D360A3F153DF333, 0x8D78860FA6DFD8F4, 0xBD2AC0C16E2F575, 0x73D4274A841EB0AD, 
-0x21DE311DCF983, 
-0xF66C2DF73CAA5FCE, 0xDD89D0517F62CE0F, 0xB1213FBC864106AE, 0x909B53AC064FC3ED, 
-0x6A060E16D52ACFD7, 0xB1C5E0BC823BA286, 0x21CC677B945EB, 0xCB4BA71B806985DF, 
-0x7E4EE57785A7D0CC, 0xB79F5346BA30AF21, 0xD444583E6FDBEE4A, 0xFBC87789D9CB8F8C, 
-0x43792A7BE59386A8, 0x24FA2500B1E0, 0x4588B0C884E33CF8, 0x985976A107824F0B, 
-0xB28371C6221B8DD1, 0x5D839B2890D03C17, 0xC78ECEE962543D30, 0xCB00D17A602BEDB0, 
-0x8756461348C2, 
-0xA004A03F20E5B63D, 0xDF759DA453A906F8, 0x30A9BF93340A9DDD, 0x13351B17F5CBBA8C, 
-0xFD9F70C74BECEF79, 0x901BEA04E3FE7E89, 0xDE30097AF79D, 0xD7BA4E2A8606D822, 
-0xB16F5F17044301E3, 0x49B2076A7479A069, 0x4AC85DF8A28CB9CC, 0xC4C5A36979DDC7E9, 
-0xC38692A0F7F2028F, 0x1FFA2DF6C5548, 0xB2A96FAC951349C6, 0xAC8D42B8DC1597F7, 
-0x138203922F993ABD, 0xE99FC10E608DDE4E, 0x50876EB46DA4D507, 0xF21B3C6484E55199, 
-0x17B29EFB903D, 
-0xC7BB4489212CF68A, 0xCB68CA2E20D5E89F, 0x7FCC4E073EB8E73, 0x167F28BF1D650526, 
-0xCAE4AD9409A43C, 0x8CF282B4A622253C, 0x1DBD125A4F22C, 0x984BD63103D5488F, 
-0xB7E3EBA73D6097, 0xF91954592649933F, 0xAE33DC00E84855, 0xC3FEAFEC10C7D528, 
-0xE4EFA47D7961EE87, 0x1AB870E79DBEA, 0xCBD8A54FD79B8A6C, 0x416E620CB2CB5D82, 
-0x42D91FDEF7A7FA35, 0xD2F30A6271EFCAEC, 0xA60DA40344A5E808, 0x5CBE259E18128D73, 
-0x220C29F94DE9A, 
-0x73C91411808DC80A, 0x3491A42ECA0AA62, 0xCE26632F66FF18F9, 0xB442BC97EB01697A, 
-0xD2418CAE179700CF, 0xC23B2CB73FA4E183, 0x14117AA3D141D, 0x964102E56F84F6C6, 
-0x3EB5055C4391E5F8, 0x9497777420A6C167, 0xF229228A95207113, 0x4C86B4AD5CDFEFD9, 
-0xD59057A8A0E5CCFB, 0x167CC724B7C4B, 0xDA99CE5A72F48F3C, 0xB56DDD08437C101D, 
-0xD8685683F4EAD341, 0xEAEC180E28FD5536, 0xF7DFDF1708075354, 0xCB3E9F1524000E51, 
-0x145356669D8DD, 
-0xE6E31F32FD35B128, 0x2ED431C2BC798747, 0x7D0C00DC95049B3A, 0x7CF706F6DA45D73A, 
-0x631790885C209640, 0x634E4ACCECF57216, 0x1C56CEF8AC6F, 0x7FB51DF97F825E0D, 
-0x512D8F04AFEC4D0F, 0xC879D4E785D811BA, 0x8B2C587AEEA60022, 0x8D460617146F9DBE, 
-0x5C358FCB9C4FCD36, 0x1C02AED73A974, 0xBFF135BCA8DFF260, 0x9D19FB5526B911DD, 
-0x4CE74F4D395A9669, 0x2751CDD6AF3D933D, 0xF2E63D4652FF173, 0xD8EE0481DD63E654, 
-0x1B55011716155, 
-0x17E336E3EACD0462, 0x415A523E3531AF63, 0x3BF3ED186532EDB2, 0x9648C44F42942BDD, 
-0x25CF04D5482C2C1A, 0x49B34D0C765BFA5D, 0x226E8CAC7EA85, 0x8FA17BAED0B117AE, 
-0xD3E059A1614E1AA1, 0xB197DA5465E8B033, 0xBF33A61B5D4DF4AB, 0xB69D6CA017336FF4, 
-0x99C216A91074D132, 0xCD5CEF213D7C, 0x2FC15251645460EC, 0x444E04E7BAFA305B, 
-0x6A3F3BB476B1C964, 0x75CC1A0D9CC71981, 0x37C083DD6328E180, 0xEE7DD99F4DB50C0B, 
-0x18DB0CB9CD46, 
-0x2DE0E7095F9E432B, 0x402279E6DCAAA087, 0xC122885CEBE1D192, 0x4530366A329BAD29, 
-0xC7D8127BF80A327C, 0x3F9A52142A5341E6, 0x12DF0D8747CB, 0xF015D1198BF89513, 
-0xC7295616FBC390A8, 0xC828DD93B2C88244, 0x9EC5762588D7DD41, 0x871CC1F5D7638CFB, 
-0x1D4764F1AB084D94, 0x1C3BB7D39BFF6, 0x3603CBBBC8415BF, 0xA263ECD11E1EA27C, 
-0x532669C04539D538, 0xA3FA40EAE86F2E8D, 0x7AFA1DA9CCA13A64, 0x69CA2836FCA13D5E, 
-0x10031240E70B4, 
-0xBED38F08994DB923, 0xE5EE785B8870239A, 0xB53CB4FE55087EAA, 0xE10AF74D5BCFA7BE, 
-0x81EBDCA0FC2AA63F, 0xF17140ED8CA25CB3, 0x105A18E2FEA52, 0x27D57278F4170F3F, 
-0x351DD83485585A0C, 0x4CA9C5F935BDEED4, 0xD23749FCF4088B51, 0x686C775F9752EC22, 
-0x94D7073E9DD868A5, 0x1DE5125B305A1, 0xCB68A25F740B5A57, 0xE6DBA61A4C8269EC, 
-0x5DA202768649B821, 0x793FA5073BD0B3D9, 0x5A63B42388F07F23, 0x5356B558F403B61, 
-0xF0A19D805918, 
-0x9315E5EB6F77BC63, 0x2AB9F7EB2A078B60, 0x7F06A91034A56907, 0x5A5453DAB980A401, 
-0x5B0AD99A941896E6, 0xDBF0F9F7CB74F3, 0x219EB76846A15, 0xCC2F54AA41A33127, 
-0x3C0A66AB31AE8618, 0x1DF1762F1BBF7146, 0xD36FB447EEFE27AC, 0xF9CE137885299BA, 
-0xC9037C0E53AE4D9D, 0x1A3C52F4709BB, 0x81A736028FCA9B4, 0x6CFD2E08C45D85F1, 
-0x13037DE01401FC78, 0x10E7748FD806282, 0x74A0784FDFB5A3EE, 0x74641417CC54ECD2, 
-0x1965D210B9B76, 
-0x74CA9A8DF0828173, 0xC017D95337986AFE, 0x908D0976502F47F, 0x7B0E617C10F3A719, 
-0xA5810608CA0B61B, 0x29A3EDB33AF4A51B, 0x16BAA741D438D, 0xC7AAD347C1F7CEC3, 
-0x92C280D4B2759C2F, 0x57BEE8AA537402A5, 0x678B69295E34F6A6, 0x7C713AD087631AF2, 
-0xCBA05CBE63C5D501, 0x854DFB6B3AB, 0x956A29DF83F0E3E1, 0x4DA966F8B92ECA8C, 
-0x8F8398FED7D3B174, 0xE37F46548C209668, 0xB219E858CF8F0AFC, 0x14D4056D74C2A65, 
-0x1F5F2428F91DA, 
-0x30FE8DB8EB9B955, 0x7E18F1E2E26F58F1, 0x7163E9AC574AF5C, 0x2971C981FAF3D808, 
-0x5EFFE6EE2E77A3FC, 0x542C2ABA37CADC41, 0x12223805FE42C, 0x108A6BC68DE3635A, 
-0x46E368D25E43A987, 0x8BA1901BEED033E3, 0x25BE01076DE2659A, 0xCAA13D2915C066CC, 
-0xF05EDCEFE0E1AD62, 0x21374403B79B1, 0x2F743C02463DDCE7, 0x217B3588EA10CF4C, 
-0xB95910258A684F8B, 0xDD03B1DFE0C18D3F, 0xE86EEEB01D62894F, 0xF418E35CBBE6A180, 
-0x180F61AB004E, 
-0x8D006F420F845F02, 0x930B66D7FC41C35, 0x81E51DDE184629CC, 0x4684F2A491CCEEA, 
-0xDE12A8DDA7F74523, 0xE60E5DBEE40DCAFF, 0xDA5B775101FA, 0xA1F3184358E9899E, 
-0xD24984857518C270, 0x8CE51CF7FB337759, 0xE78D859147E88C0A, 0x3A35A0630567190E, 
-0x276B17D663F773EF, 0xF04C608D35C3, 0xDC1744BDC2282BE6, 0xA20A1CB7B76449AF, 
-0xA152AD8E5B89DE00, 0xCEBD7D9E13472AF5, 0x9F83976DCE4DFD24, 0xEEFA65EBF2EC9708, 
-0x5A52EE996A1F, 
-0xEFB429D56857C868, 0x53E85CA24277AF3B, 0x562636995BA13223, 0x195728F853ABF266, 
-0x8840A82F442DB5F4, 0xA36AC3EAF9A9AFAA, 0x15B35788367D9, 0x6A8143E61354D153, 
-0x6F84336C35DAB238, 0x95E6DD5389FE6D76, 0xE99542D84394EA4, 0x46D89671845262D, 
-0xC81DC7956E9C71AB, 0x1377DC9EE1C16, 0x3094E5BF64EE8446, 0x6AA9D2FEE499E1EA, 
-0x166A4425E255F8F5, 0xE549230D3987677C, 0x953C32858EC3CE36, 0x6CD3BBACFDDFEA3F, 
-0x4831EE8B4356, 
-0xCD27C68D25989EF9, 0x4B165542E7756B28, 0x81029A70176C7C0, 0xCBDB74A045A870CD, 
-0x9E028A39B28E2E89, 0x7326540625E94F30, 0x102FF6D7CC3A3, 0x7DF239F46B469385, 
-0xC71E29FF4BEC24D7, 0x14AB2A3D24A3B118, 0xC3288CDBBDC79599, 0xFAF421ADA9C50152, 
-0xB7927152EA7D521A, 0x186EF1C780FE2, 0x55BDE2A7C37ADCDA, 0x819809A5CD0BAEBA, 
-0xBDFDC925345BC0E, 0x426244668DD92547, 0x559D759D3F269DFF, 0x7CCBFC0E4A248802, 
-0x8744CBB41749, 
-0x2DFD159A84E3D935, 0x9DD7EA4765E130C2, 0x8CDBE4D7EB2B8CF, 0x1E35C82440020B28, 
-0x58E078D7A0060583, 0x164588B223AA2FFC, 0xDA9B105C647C, 0xC16C6C6857E4194D, 
-0x793D04132C169E0F, 0xFD38F5D003166FB8, 0x8368F1EB6D3965A, 0x2195C251B2BAB984, 
-0x2B8586165998105C, 0x21830D052D788, 0x49E78BE05122C405, 0x8A7DC217F7435FA6, 
-0xCEF9FA6C1FF3A345, 0x1D581F7459D53D8D, 0x806762F17ED6D6D6, 0xFBB99B4E017BBBC4, 
-0x1FCCBEBDAC3CE, 
-0x1EE272F0CC551CD9, 0xA91E6DDAF322DBB4, 0x6C625B9B52FA453B, 0x4BB140A5181776D5, 
-0xCE8CDFF4B907A4B, 0x8768297F0350BDF9, 0x1AA2D2448B202, 0x2E85871CA7164EFF, 
-0xF5E64B30E1513418, 0xD8265C8D46907338, 0xB7D2E92395785E0B, 0xCB3215E55AE640AF, 
-0x7BB3CAF6F812E698, 0x167F2CD2C942, 0xE05F7B29FD73B095, 0xE9C47A2D3BA1F0B5, 
-0xC5289C3B954352D, 0xF059A65C867976E4, 0xF69C62DE9335E579, 0x887BAEC160BB0AF6, 
-0x1CBEEF8E61927, 
-0xD770E5DD00F37F73, 0xEA42B8D69FD89D27, 0xE49AC4EEF38B9323, 0xAB6C12B98B029DB7, 
-0xC8BFF6286381241A, 0x1D3D501F742699A6, 0x32D531FB88B7, 0x1410C01F8573A46D, 
-0x108A27AEA705FE38, 0xCACCA3BF7AF7A7E, 0x61C1CD4957B43001, 0x6E18780BB301434F, 
-0x153B8B33A48F281, 0x22A111AD78587, 0xA2E09B4DDDC5459C, 0x9A35782BA8C59C0B, 
-0x58EDD50DD192BA89, 0x43FA10E767F3AA1E, 0x3B052596CA183C45, 0xBC9C83397DCE1B27, 
-0xA8DCC67A9854, 
-0x32EEB6F7BEF9F880, 0xED80D3265F64AB1A, 0x5D90898C7417EA03, 0xC331F5CD121121D8, 
-0x8ACAB7496375DA1B, 0x7DCB4778C045E38A, 0x74FE500E117D, 0x87883B9FA0E635CC, 
-0x1C72CFC51C6ABD86, 0x800D557FA904CEE2, 0x1CBE546A9C0238C4, 0xBE9E7FD23A1935A1, 
-0xB415F0AFF27B7152, 0xC7FDD331A185, 0x209200C726598D53, 0x86EFBE705E47A6BE, 
-0x6B6819B5A304AEB4, 0x385D11E4665E3F48, 0xD79A3B49852FD657, 0x420F584D1C478415, 
-0xD4359DF9F980, 
-0xE219C920EB55B75, 0x37158299E4315B61, 0xDD2A64132BFEF70E, 0x4209644F31987E7E, 
-0xA9B2F9A9B7524BB9, 0x51C2A8CAE8C7ACAA, 0x1D55C17C1A929, 0xE547B9BF0B0F1A58, 
-0x285872DEBA5AF50A, 0xFFD08CA052FEC47D, 0x9D2025F9F5CD84F6, 0x6A54827778085E0F, 
-0xF7B7B2A699650322, 0x1A4A2B00CA97, 0xC2D24E7515F2252D, 0x770E4293C6F49BF4, 
-0x30BC90C5D3FC546F, 0xB1C9ACAB4DCFAB21, 0x3C05C57ECE7A0190, 0x3D0AABF17DE76BF, 
-0x211E87293D95C, 
-0xAE7CCFBC2D96666D, 0xB4F8E23B0F24FBFF, 0x7BAEBDBCA765B5CE, 0x11315B75883502B0, 
-0x34662F0D679173D9, 0x6822FC9EDB6B259C, 0x3116468DC55F, 0x84F43166599C6964, 
-0x32D145CD6DED600E, 0x560899B5C44DDA1A, 0x9E523E600179D7D9, 0xC99768C62B13B97E, 
-0xB7FADD7519AC5C42, 0x6815859DD6FA, 0x2BF583E878A9939C, 0xCA32AF9E8EEB7469, 
-0x8D05E1A1A6A16227, 0x3CE580085F1655AF, 0x20DB88E775C72DC9, 0x6E57501B74A170A3, 
-0xCB66DB56CE01, 
-0x28E3A8A709802C13, 0x996BD8D647AECF0E, 0xA6B09BC15DA60AFE, 0x574DAE815200D49B, 
-0x10F5B95CF32152C8, 0x1E78671E7A787533, 0x448263285A9F, 0x8B2DD406D31DBF65, 
-0xFF1FE480A06A43FC, 0x624308666A6BDB29, 0x46ADD5459A73CD61, 0xF9CFFB9174BF3555, 
-0xF79C43ED8D9D711D, 0x30CAC80CC048, 0xC7EE404FAE8C4B93, 0x13265D769DEEFA50, 
-0xADF2B419D043D512, 0x2BF2F7B455F647AD, 0x6FAE83ECA115F074, 0x184958E6D16848C6, 
-0x110C46B420D64, 
-0xBFB518424FAEAC9B, 0xC42E8214A6769335, 0x65DA3932E38F7D05, 0xE22CE0D4F5270EFB, 
-0x8A35C5CCAE0800AE, 0x5C4C88DBA65D1C35, 0xD23810109B95, 0xCC9785563D0863F0, 
-0xC33B152A09103E5, 0x848022B87F16F5B6, 0x73D15EAD9B301C77, 0x18D0171021CC5693, 
-0xD1AA17FFD93EE64E, 0x1020A8D58E1CD, 0x129AE46B16A7563C, 0x9BDCF04DAFDBF40E, 
-0xF3CEABC6855677F7, 0xA959B80477C772E5, 0x8BEDE8D5C931E151, 0x7D05FFA5C03B90B8, 
-0x7B80E6BDDF2A, 
-0xD9BAF5EDBEDED3E6, 0xEC7698BC30B530A8, 0x3558B586DBC33C03, 0xF7758630BC9250F6, 
-0xD03CA0C2543DEDC3, 0xF12E7B162337C887, 0x199F7CF03164E, 0x831EE0295A845745, 
-0xCCAB4FEB03214231, 0xA1E1260D6AE3569E, 0x866AC937CA4BEA45, 0x207946C0CE60511E, 
-0xAA3BDF3BE6473AEA, 0x1CCC887E4930, 0x80087ECE06FA64CD, 0x1A1CD6D232012188, 
-0x25A93126638840B, 0x88AFA87AFCD33478, 0x39C6223D02F51718, 0x53D88316635D9040, 
-0xF2CFCC601155, 
-0x3363301E79E7D4D9, 0xA88A7B32CD8AC315, 0xAC440E8E744F0600, 0x4DDD179AD10DC4A0, 
-0xFA24DD12B5D66993, 0xF9F95858416E02E0, 0x1A765AF5E2975, 0x1E2744D55AE87200, 
-0x1921DE1FA00682E6, 0xFFDB0DE0C45C34FC, 0x38EB445A40B67D06, 0x8966A3363A7F9770, 
-0x8715DEC6549C2C5A, 0x19F40192723DA, 0xC11BCAC845C0A278, 0xC284D43F0FAA5950, 
-0x7C364B1B3E29054, 0x3723C6D239517BD9, 0x372CEF626B95C145, 0xDC155487AE2E931A, 
-0x6C16E7D5E4F2, 
-0x2AA757DD1E04E97F, 0x2FF7938521154260, 0x1E58BD78E525C765, 0x2349821B9A8472FD, 
-0x19C9600A098813DE, 0x6B73D650C8BA8FB7, 0x1600EC9A55AB9, 0x84A7C78C6DD146D8, 
-0x3ED1E8AB8A2173A2, 0x4B6F85555D5C07BF, 0x30473F111FFCCE50, 0x798CAD07CDA9DF62, 
-0x4EF7EC1A2CAF54D2, 0x224E34F89ED6F, 0x32855D5917E2375B, 0x7B85A1CBE5F7C032, 
-0x3AF6AD32B081DC6E, 0x2DA55F17464A4CE5, 0x9BA1DA17494FD095, 0x7120E4C4EABD4E7B, 
-0x1FD0288879289, 
-0x26B5A9BD516DEFA4, 0x7267F8818A0D0F96, 0x5C6451B8F6D8B82E, 0x625E1B8882A12FFE, 
-0x9A10E7F9C1374411, 0x21D8E691C13650C1, 0x20CC5B74A98D7, 0x443DE0BBA824B0C9, 
-0x5C41CEE787FF22F9, 0xC0BC7C893A3C1725, 0x47115565371ADAC, 0xCA6A45128D004BD0, 
-0x44C0686A95F1218A, 0x8C05A9146AD0, 0xCB7F017F793688A9, 0xB6F893F161F7AC7, 
-0x216C4D6CB5C45CEF, 0x629B62DDDE5CC8DD, 0x75F00C9552FB6CCA, 0xDF774A43068D6896, 
-0x1B7EC15D03C74, 
-0x5AE07D5D42B75B3A, 0x1107872250A2C8A0, 0x5566EF3AA4E6F788, 0x2D59668891D8E0F, 
-0x4170CE15968F3CE1, 0x366509182BA372E6, 0x5C04AC223DCF, 0xE2812F2129D2E30D, 
-0xB3376E743CCCB419, 0x84F6BAA8749F30B7, 0x1F72F1534C834EEB, 0x66606AA2CC2C6743, 
-0x17383771B6877A59, 0x1ED9771E01F7F, 0xB7EE682865B22D3A, 0xBD4AD568DA4424DF, 
-0x7F43899B74D43A06, 0x6489A3061B335CE2, 0x7A1DB2B688517940, 0xB055DC3481ACB3B9, 
-0x1AA866A039326, 
-0x14511CC10D4DA9C7, 0x28E8B70FD2BCC827, 0xED96440AE7EBB121, 0xB90D7C8F2C8BBB8D, 
-0xD581F2718C222E8, 0x48849F09118A7F83, 0x7F9E06755547, 0x1F78DC539AC32C46, 
-0xF87D5660462397F2, 0x33E5A3EAE5EA39C5, 0xE2987424751CD2D9, 0x2BE0E8299DCBC21A, 
-0xFA24A868CF26DBCB, 0x18A56E915B02C, 0x5C3CC7B660750027, 0x5AEF691080D350EB, 
-0x655E5698AACEFBB1, 0x2F260ED054322662, 0xBD07367CC21584D3, 0x6DDF11F6E6E41889, 
-0x11C0CB8B73A4A, 
-0xD965C5B012CCDB19, 0xBB2A1606B739B3CA, 0xE1408FE2BCAEEE21, 0x9B601A9F7B9C01EB, 
-0x6CEED0B1BACF0801, 0x3A599748E401D853, 0xBF2DAA2E4208, 0x8F31FAE9D580943A, 
-0x4087A885EF397E8F, 0xC36BDF1B200734CB, 0xDE33012A8A6C066D, 0xA049A91ACC0E67BC, 
-0xC97E543A138604F8, 0x2085E419C8B2C, 0x18577818774D32F4, 0x5A0B999578B0A220, 
-0x494C6C04C69874B0, 0x659B7BD4274D12E4, 0xFFB31661588F5D15, 0xDC8B22E1F64ED4B6, 
-0x88D3545131D4, 
-0xED7E3520268EEA4, 0xD21F55F57489D267, 0x670722E419F27606, 0x6FB10CC4C054B2F2, 
-0x4AFE9B1E2588C368, 0x7335EC9F158DFFB, 0x19CD7BE99D91F, 0x5F2C637D0F187A1B, 
-0x3C20F77197577173, 0x139EE50D9B3D9C61, 0xE6E9CDD3AA3E83ED, 0xDAA21906C0BE47E0, 
-0x1010CA9042F3F674, 0xAFDBBB398A7B, 0xAFE1490679C57FB5, 0xE4566328EA19A0, 
-0x5DABF1AB3EDFEBFE, 0xB0BD0FE2919A94AB, 0x3FC27F5AEF36AB76, 0x26FB65E3AF8B3345, 
-0xF42235954360, 
-0x34CEE389A3FF1189, 0x1C18720BEA83FE77, 0x6933E9BA3F4CCC61, 0x6F9A17D33902D61B, 
-0xE6DADD35CF766B4A, 0x628AB5A69163C8E6, 0x1B729A9F0C2A8, 0xC6335C5CEC8AF4E8, 
-0x45F6C219B568D701, 0xDD975DAD50031223, 0xCFA3B26FDDB1AB3E, 0xDFD25632094FE84E, 
-0xD9F62AD025B4740B, 0x1F69D13BE3EBD, 0xB7BD7567818B275A, 0x895ECBA365BB256A, 
-0xF5DE88A55583562A, 0x9FD08EACC8BA94D3, 0xAAFEB1F4DD80A0CF, 0xCFFB9803D85659EF, 
-0xFEBF4A62972, 
-0xAF23BB44C2F21EFA, 0x685DEE8243356D69, 0x4E0CA280CD0B59BA, 0x15F96F1BF3E98872, 
-0xB1462EC7EA089B3, 0xD91EF72E9119825F, 0x378485DE1A19, 0x516747B2EC4A6C7A, 
-0xD70E3D75DC26032, 0xABB48EE144CEFC9C, 0xC10B734C9AF098F1, 0x7BA9C04CB0E31900, 
-0x1988899F9ACF5B16, 0x10ECAEE119172, 0xB219826480D60B41, 0xEC4D2827578D2699, 
-0x6583C723733F23B6, 0xE0C410E9F0315353, 0x154B5EDBCFC99DB7, 0xB0627DE28550F43A, 
-0x2111913E9294C, 
-0xB3DA4468CFB744C5, 0xC06ED6B0F282B7FF, 0x6CD133B00BEF6819, 0xB3B9679F431E86CD, 
-0xD9956E2615805CF0, 0xAB50081490CEEFD, 0x1287C8C5CCC93, 0x4D960797D35FBD8F, 
-0x3D7AF175B81FC783, 0xADA14CBB02064C93, 0x264A15E8104C94A5, 0x82BE28A9383678BF, 
-0x7B6E43E6871C65F1, 0xEB382670E50A, 0x824FBDC87B4D9071, 0x8A3532A73E9CB6C, 
-0xE3D4572AF1E61DEC, 0x142C0A77A3FAF141, 0x60793072EA5A3EB9, 0x1CACA85F6A0E666B, 
-0xB606CD594B97, 
-0xCC66248117B9BC6, 0xD611BC7A2C15ECDD, 0x885B0E2B341172EA, 0xE285AFB387AC9423, 
-0x3F695A73AEF3533, 0xFF8BF9EBA5C19398, 0x883DB65F9322, 0xA476622EB2EE9FD3, 
-0x42A4161CB4C3A1A5, 0x253B77B3984C344A, 0x98AE8863DBFE57B6, 0x3C5E0B17031E7B24, 
-0x8C602044F4394217, 0x4A3E9F015989, 0x949C369803C27A4C, 0x98BC91517BAE4A, 
-0xB56F7A5E7FE54865, 0x25217B17A505B873, 0xD8C4399B8CED2320, 0xBC08A5A4ED0943A4, 
-0x217FF568B662C, 
-0x808DDEA0BCC197A, 0x4B0B1BA1D71A4938, 0x111ACB3737EAFA21, 0xC125AC47744F1EF2, 
-0x11866D65560C6AC1, 0x516D0FC3052DEC87, 0xA199B26F5EE, 0xC944053DC687ED71, 
-0xF17738E3A50372E9, 0xC79F3149D7B697E3, 0xCAB04A56CC35699B, 0x23FEBAED57F2F582, 
-0xC9DDE5A35EAB44F1, 0x1F824FBE76959, 0xB67E535CACBD5C1E, 0xABADECC9958011E7, 
-0x236FB2F47E59D1C6, 0x7F9254974139CA36, 0x6E888F391B740DA3, 0xFBAD94C756F52A16, 
-0x7B93900796E5, 
-0xDAEFFC6EA5BB9F59, 0xFDE45C25C374289A, 0xEE5AB37598DDDB5E, 0xE5D72A20D1CD58D, 
-0x55EFCA05D695C251, 0xE2AE69A7DAD93D9F, 0x20407149C5282, 0x62F67D2F2222EF28, 
-0x5AFF309B4564C0C3, 0x72CF7D0BE95317AC, 0xC27FB41C3379664A, 0xC47A3A22E93A87E0, 
-0x6127D0EE5EA68A46, 0x405A6D3EA16A, 0xFB160FE0E3CFC294, 0xE9CBAC26FC388AC2, 
-0x528F22DAC7B66184, 0xD994076CBE4671CC, 0x3CF754CBF56080D5, 0x6B10648475614DB5, 
-0xFCDBBBA549F7, 
-0x1A4AA13096A3867E, 0xAB9628CD6A9674B3, 0x96462E186B11C39A, 0x88B961A041FF966B, 
-0xAAE2505585E76BA7, 0x1D68FC5F71C84A0E, 0x3D94788E69BC, 0x84B4BFA1560D7C3E, 
-0x3EDFA10ADDB81EA7, 0x9120E11D33219C99, 0x744381A4693CA35C, 0x964745449FF4558, 
-0x924440472EF5A3F0, 0x1AEC741A04C7D, 0x2730B150978EEA50, 0xD30311C970FBE092, 
-0x44FF8758EFF5AD6, 0xDDB2CC26F84CAAB1, 0x51466C925E36D267, 0x89191B0EA8DDD4C9, 
-0x1DE95795D24AD, 
-0x194BA597B128C915, 0x3317A88DFC365523, 0xE4C9FDD8F2B12A3E, 0x88672B792A7A0176, 
-0x5487DD726A65D52A, 0x752244275B4B3786, 0xDB342135310B, 0xC6FFF58AEF13726C, 
-0x996126071DD46706, 0x4C61C01739E2ECDA, 0x24477EB177F28EC9, 0x690D286C49F788EE, 
-0xCC46F0CDDEE2950B, 0xB085064D36A5, 0xE6C2DF9A84DE0A3C, 0x5F60FFF5AC8F6844, 
-0xA501075CDD111634, 0x621A006435F888CF, 0x3858A368B8B1F8A1, 0xF7293A6EA1FB5CBD, 
-0x1CB3C0FD1298A, 
-0xD5D952255F0902C3, 0xE8256B302163E940, 0xDF91E368C7344D46, 0x81D9607DC86FD3DF, 
-0x9D189F9CB7240899, 0xA7E73700283896D9, 0xD8843BC39CDE, 0xEE00BE0C1BE58988, 
-0x62ECA98631290F2D, 0x588D46502B229701, 0x625C70BCA65C8789, 0x6791709E52D8A817, 
-0x40525B0A2D5D44D2, 0x1BBC78CF52607, 0xFB84559A45A69CA3, 0x68A4A7DEBE647822, 
-0xBCC4C9C09DF05032, 0xA04FCF20E1FB2BD8, 0x675B580309AA4A15, 0xD9C056236FDA724A, 
-0x1012650A8E178, 
-0xAC788A680C40AA7C, 0xF98CE4A9992E4470, 0x39C1E5531B28BE9A, 0xA1E67B88FB1DF13, 
-0x78BA9C752194A4F1, 0xDFB04E077710C2C0, 0x45359E967D44, 0x38FD5351E8F83DBD, 
-0xC63F16544CD8A09B, 0xFCCD44D78099AFDF, 0x6401175F505E5183, 0x56A1E6A581B629DF, 
-0x54B7866AEE784836, 0x224512FED666F, 0xEE14F9157D08207A, 0xCC8488ACB0DE2979, 
-0xA74733FCA479E453, 0xFC1FAA1D78B497C5, 0x72CBC8339F8EC400, 0x603BD9B4DA6298D6, 
-0x1EABF2624D621, 
-0x30692C9E73886D47, 0xF9C084D7B71D2E4D, 0x325C0FF91A405724, 0x645ED7A610574714, 
-0x2E470EC33E19AACD, 0x49D878633809C675, 0xED5DB0F4F598, 0x702A6F5209C3726F, 
-0xB27D4722C35E205A, 0x950688D7E94B338, 0xB5BC0AF63A8B9BD3, 0xE892BDDA2BF0044, 
-0x4B995040E46BAAEF, 0x14A8D3589B3D2, 0x6A126F7775C084B0, 0xBF5C52176ED59B41, 
-0x8D3C251EDCF490D9, 0x66F99EC89C09EE7, 0xE35C68234557091F, 0x41C19DE9ADD7C3B2, 
-0x2312F93557A4C, 
-0x21B4E08A6022A316, 0x271680FCC438591, 0x418C4AAFC5DB3527, 0x69C4079058E0D25, 
-0xF14AABEF872DD8A, 0x4724C5D6EE0C183E, 0x13CDEFCAE36F1, 0x99DF76829EF6A030, 
-0xF9C3B6E2AE2CDEF5, 0x31413996A5CEB83F, 0xF70C386C3022C7A0, 0x2A2EB5857670D68C, 
-0x54E85D20031B14CC, 0x2112F1D8D97D, 0xDC8931D82E355C13, 0x613165AB500C989A, 
-0x12FBAEF02DDA434E, 0x420A9D22E63EDEE5, 0xD7BC12ED86F91B85, 0x415A1C77F591F29E, 
-0xB0C633E7AB53, 
-0xE2A0605105789EAD, 0x4B8C1459203C3F5A, 0xE846AC0EA896634E, 0xCE464409AB9CB5ED, 
-0x3BBFAB65E4182570, 0x86200E55D7D47535, 0x3039D21171EF, 0x283FB8D812BA5F57, 
-0x717BB21805552FF8, 0x44872F219B3E1CE5, 0x21DF326985AACAE, 0xB50E1A4822445C55, 
-0x81C3E361B4427C82, 0x1AACC0B9B5ADA, 0x3D50C1715A32AFB7, 0x3A895D32F6C74ACB, 
-0x3D1C17E3DAAA7B03, 0x4039B73B2E02894D, 0xADE2FA12B6A9C843, 0xE98EF923807B9710, 
-0x302BDC30B68A, 
-0xE6315A9AE1307D95, 0xF2282B5D50B97075, 0x55463FE020DFD65D, 0xA56F5DF8BB26CEA1, 
-0xB7008472DEFE1C39, 0x5BF3D79747081D76, 0x17788648F863D, 0xF30A1865D23B9612, 
-0x5247C0335B2B1F7B, 0x3705596393CF20A8, 0x856E4DBA77902B62, 0xB36C785F31B91DF6, 
-0xE98AC0408D05C884, 0x107D694A173AB, 0xBDA7DB94588F1C0A, 0xAACE731CAA1529F, 
-0x485123FE1AFF560E, 0x664E1B59A9C7C969, 0xC254481D550D2AC1, 0x3BC83399DBCB2F21, 
-0xCAA6CA670D9, 
-0xC62AF1CCABF87CF1, 0x355F94384D1B28F1, 0x4804DC218BA761D1, 0xA86BD9BF03483C89, 
-0x49FFF18DEE06DB28, 0x33C3F473C467F840, 0x20E1335C2ED8D, 0x21D042EB906098B9, 
-0xAA452A88EF795714, 0x2AF6C3FB2C29EAA1, 0xE0F474AD86F2F4A8, 0xC018B33DBE859D81, 
-0x74FB588F2F0F6DFC, 0x11BF4B8ADD92C, 0xB2CA8FD2A5EF2969, 0xA56A1970224D4993, 
-0xF9EEF99B817E4265, 0xF4CD5ED56B2B420E, 0xAC9B91A66AC311F0, 0x990BCC9D9BEDABA2, 
-0x20592BE256A27, 
-0x48F5A212A01F1363, 0x52B413564743080B, 0xF295086BF6E1381, 0x6BDB9E7F3D258481, 
-0xFFFF7D17E3DABA4B, 0x6015EE3EB1BB4FCF, 0x22496CAC9CE79, 0x66C0259654400228, 
-0x5A7CE361C4DB0505, 0x88800D6803D411A, 0x9BA925077651F12D, 0x9CDFC36990C7CE54, 
-0x27145BE0926453AF, 0x1D31593C2516A, 0xC9DEF35088D0DBF1, 0x103E73BACCD938F8, 
-0xAD1A4031B0AD5F2D, 0x8412FD19CC88B592, 0xF27A4A47AA5EF630, 0xEB6357610275DF35, 
-0x129CB474F3DAA, 
-0xBC9ECA01F6AD10F7, 0xE5AC3D3D99EFC3B5, 0x9FC67802C846BBFD, 0xE11C1502A5EB4A1B, 
-0xEA18F1D61968C0CB, 0xBFC1EBD61F6BA350, 0x967CCFBC19AD, 0xA03EE6D168EB0FA1, 
-0x19BA56AB81B47561, 0x5FC33739E4F36BD4, 0x8E1F50F504BD3E4C, 0xD271038A49830AE9, 
-0x6C905C731DB8A1E8, 0x10CC5982B0C57, 0xD6FF60792E390051, 0x4E284DF835E2903D, 
-0x601AFB86B9D3A4E, 0x55A2FD35933FEB3C, 0xC0D2E310686DA142, 0x36468EA49F745F7A, 
-0xD00C83579B66, 
-0xAD5F1925C7C1DFD8, 0xF305182398AE7152, 0x6308C4D9C0EBEB8C, 0x6221EB2D41C9B170, 
-0x5A2C69A638B81620, 0x4EA4074FCEAC131F, 0x25609791C140, 0x7D71678DEDB48D09, 
-0x21D53C22E7FAEBC5, 0xB8E3EA5AD00FEAC2, 0x5722F75ACD508D24, 0x63A3A450AC85BFCC, 
-0xA0F9A6AEA58D2B2, 0x9C05C90F736D, 0x8C4EA022B0F9CCC2, 0xB0B50EC48B6D7556, 
-0x643570E61BF329E6, 0xEA11FD09A306292D, 0xCCFA5AEDADA4FE15, 0xDF3E7DD903204627, 
-0xDE6CD87F6800, 
-0x2135CD2441E197BC, 0x8CA11D5E075D504E, 0x88EAB81879C2E171, 0x7916C8531F28DE2D, 
-0x5AB0302FA55D3819, 0x32FC12353800D0FF, 0x20C575AD12C32, 0xFDE98FC6EBC1BBE4, 
-0x71D1E0E063A5D82, 0x888B9A08BFC9C148, 0xE4042AA337B25589, 0x4F1823F233E5088D, 
-0xD268FB48827F306, 0x100D6EC272BD4, 0xC91932B0CB6D53A6, 0x849ACFFB6F5A2661, 
-0x999778C3A1785AF8, 0xA33CCC9932E210D5, 0xF275F7920084BFCB, 0x780441842E414BCF, 
-0x865E1CE5C82, 
-0xA190A311CAD8742F, 0xE8487B094BAAA80B, 0xC0C484370A187053, 0x84A010BD995305FB, 
-0x6D97B8E8CBB7007A, 0xE98A85DEF7CFF6B1, 0x517CB9872647, 0x19C9DDEA4B1BBFFF, 
-0xCEB60507AF1E8994, 0xBD0136B40A73CAA, 0x14841F4F5781E229, 0x19EDB800FF55EA9B, 
-0xD32AE948195130D4, 0x2DD16E745004, 0x2A1124E53B0FBDB3, 0x92C178FFF749678B, 
-0x463E9FD2EDCCFC8D, 0x8D9B019E68697141, 0x99D574F962333D7D, 0xAB8553C760B2F2F, 
-0x13E731586E369, 
-0x4BA489E3E9B6CDCD, 0x9270BA881BDA3937, 0x440D235746A318FA, 0x9621C0193C2A51F5, 
-0xE7767357C2E671B5, 0x44B9353F3A5AA791, 0xC5453F89E602, 0xCD4E9471349674AD, 
-0x1AEB39F78D7E5B41, 0xFEF2A55E65C6FAC0, 0xC1CD75EC65AC60B2, 0xD28F1217288737E, 
-0xD96E226E8580E1AD, 0xD1A68A58865, 0xF5889CB5199EB449, 0x1AA2C742C9A6C98D, 
-0x576B51567D03CF98, 0x1688661A043CE20C, 0x5EEE989B1E675496, 0xB148C437C75AF88A, 
-0x17C75DDA27CFD, 
-0x27D37C6F3B5B5E50, 0xE68D5D88F4D2E955, 0x6C7F8D6914A8A237, 0xF2534A55BEF4112E, 
-0x215AEC752AF16BAE, 0xF6C5AB49004250C9, 0x21D46716180FE, 0x1C513C982EBF56F3, 
-0xB3BD64E1A09EE13E, 0xA9F5BF5FBA3F2A63, 0xF7BE5378B2FDABC9, 0x9AC1B7ED41A7D271, 
-0xAD24D33179A1ED01, 0xCA358D7DFFB3, 0x9C1718E8A25FD4A9, 0xB4F683FB21E15BF1, 
-0xD17992E38C877F57, 0xF112B9A98CA1CEEA, 0x9AACE12318527A47, 0xAA2E7EA8C581E558, 
-0x10305BCCC8E19, 
-0xC179F1451F59716E, 0xE9DAB2760C219FBC, 0x3E209DBF639B7393, 0xEC6569B61221EE01, 
-0x1E9BF9E17E933491, 0xCF80F272059DE0B2, 0x2CC7FA5829FC, 0x900A370BBE3F25B1, 
-0xA9B0FA960F868188, 0x50A32D794C7F5B17, 0xD0B74B1D138A6511, 0x57BF0B0D2F188F44, 
-0x9276C74EAC7222D5, 0x2D0606B2616E, 0x8018D34C54274599, 0x8E34D2248E705FB1, 
-0x99101B735170702, 0x2A47365F4FD043FD, 0xC40B7B844493BDF3, 0xC64DF9B8D90BB87E, 
-0x1E44BB3BCA7F7, 
-0x762E053FA0B06C82, 0x2CAC26D78DEEE6A4, 0x5F4955A4D40D2CCE, 0xDAD1649EF6895F44, 
-0x214997333A180C11, 0x3CEC66B5B6358278, 0x238698B4A386, 0x778D75AFC6D4216F, 
-0x9CDA738BC275B42A, 0xCEE048A2B41F399A, 0x67A42D87A782ADE6, 0x3D06F8DAC90D17DB, 
-0x734DA4F615D8F09, 0x1AEF0F242875E, 0x1117250C5997BC77, 0x6E6485785A265E82, 
-0x22FDC5E8D9EBFCF5, 0x2A46E27184BB05CD, 0x91258DBA9487A233, 0xAD6E9F4A8AAB00E1, 
-0x72A9872D1371, 
-0x120024BE028D0572, 0xF5D909A020B1BFD5, 0x58805012397F10FE, 0x4B8CD2681DBEEC61, 
-0xA3DFABD2D3009B1E, 0x3413E29E3F40D651, 0x1A3C40EA74EF8, 0xB62D7DBA9E5640BE, 
-0xFDACD032D2C3C859, 0xF8801CF090256F4D, 0x50803B65B266CF3A, 0xE9E5D17C48BDAF19, 
-0xE90F34184912A4DA, 0x1867649585DB, 0x64710ACE2C333C54, 0x994B5B09951C8C93, 
-0x18B8F140AAD42534, 0x163EF9FF56A0484F, 0x33EB7DB446ECFE04, 0x695E3B68662E1BB5, 
-0x2117C6558834A, 
-0x2C3F926AD0DE44DF, 0x8258C018CE873740, 0x439D47E2DFFA354C, 0xC3A17CAE4782476F, 
-0x9B5A7EFC6D99B149, 0xE3B64E080CB4C047, 0x5704BD77B10B, 0x7D45240AAE8E6D92, 
-0xBA9E747552C2D94, 0xE8D8EA0B556C7609, 0x50A5A903B66ADDBB, 0x94A604A82D9E28EE, 
-0x7258A97CEF4B21B7, 0x144C03E455BAF, 0xDFDB85E8B8F5C307, 0x7D6252007CC3E614, 
-0xA16E05F2EAF93E31, 0xEC85C426C63B56A2, 0x2E0CE09FA5CB2206, 0xD9E57D22EE1178B, 
-0x1E4749A579365, 
-0x43D6D9E2AD7AF37F, 0xEBD4883D12312F4C, 0x89F1D090F4FB550E, 0x95D0915AAA21B3E7, 
-0x51004DBB5592D8E4, 0x45DB3915E2D71F11, 0xA5EBAC53A077, 0xCC4AC2AC98D4AEC6, 
-0x31E7E5E6DA974A01, 0xF85BBBE273B7B9CC, 0x5DF4D6496672E11D, 0x17C26414DF64DA0E, 
-0x8345DC17BE58D612, 0x95F0F548B2E3, 0xC8EDD1B9BA3E896F, 0xB7FF95549F5FFB27, 
-0xB31C808D0809D0AD, 0x350D20345ADDFFA9, 0xBE2311A5F6F942A7, 0xB60FE66519459F99, 
-0xAD933DE53FC0, 
-0x2D92B30880D4B500, 0xDB62C63BA0AF3166, 0xB696813D51C9B3AD, 0xB3C1E1F3955D1355, 
-0x3DE2BCDE9AC12A5, 0x8140A62D5B59435B, 0x21701DA1A52DB, 0xE645773332890D94, 
-0x376B9FF07AFAE827, 0x543485DF46844780, 0x7A5079A12F8C0C4A, 0x25FA15D969AEFEDF, 
-0x3DDF083AACA14BDB, 0x1F296B0EF0E93, 0xA9CD45F1AA4E9885, 0x823923A355FD85EC, 
-0xB3F24C830F0D1DF7, 0x736AF9621EF301F3, 0x888241C4B9C0EF5C, 0x26D3264B24011BCE, 
-0x1E27994F597BC, 
-0x4098A691E07A85A2, 0x16AA8EB4808401FE, 0x6E91554308617912, 0xEE8FBEF97988AEAB, 
-0x15063060B8F5474, 0x875A3017DABB3176, 0x1EE02701DC0A7, 0xDF2AB9A36AF680DE, 
-0xAD882F5660A41829, 0xF932D2800B955A4B, 0x9A1B74BAC3A981EB, 0xB70919602BE6C993, 
-0x83493094C3EB982, 0x1EE376D7FC67A, 0x59D11ACCC7C6DB46, 0x4959C3D7F4392EF9, 
-0xE5D2FEA28094A184, 0x333A19BF9B36E1DF, 0xB25FC2E4C463C160, 0xAABBB815DEF7AF8E, 
-0x2297A65818AA7, 
-0xA2F19CF2D5731597, 0xB77FBC97D78CD338, 0xD4882A71445A9A3D, 0xE013A3DB9D19EC3D, 
-0x56AD87A3BDFEC224, 0xA19099E9B264AC9B, 0x194EEFF00004, 0xDE4790B659620F8E, 
-0x1D8EBE8A6A938354, 0x14F75CB966B06C10, 0xAF9B6D9D5D7F52B6, 0x2846D61928B1A9F9, 
-0x70E1B1FE4C2676A0, 0x72E062EC5FF3, 0xB5A555C1E4891A50, 0x362E7C9B5A9A1082, 
-0xA036D4D506B583D9, 0x9274385D399840C, 0xAD596ABA3A822989, 0x2F21D9FF9A6702CA, 
-0xCCB2384D5488, 
-0x66C47FD6DEC87FD1, 0x30C692E43CE579EE, 0x18BD768B676C99BA, 0x73DB19ED4F6795D, 
-0x51B98507AE269F84, 0xB63CD9CECDEFC114, 0x1120D1FB0FFAC, 0xFEC01B601CAA958F, 
-0x4153848C216C999F, 0x8CAAB31B6E44343F, 0xC867D86BE0F7723D, 0xBB714A0FC4F2756D, 
-0x3DB636779F7A437F, 0x3CFA562D33DD, 0x6D20747B9D582CE, 0xF138B8A405548942, 
-0x48D8BEF52720B0FE, 0xC1C61CF8DED42E61, 0xB3E0F852BABCE44F, 0x67CBA90FB6F48885, 
-0x78EDC65F5F20, 
-0x11B3DD1654A382E, 0xD95FF89EF801322E, 0x546ED4C2A91702AC, 0x5E31A87A007B2C8F, 
-0xBE9C9F3F90B1668D, 0xF759911F049B3BC6, 0x213EE758D9754, 0x9B0D6B11043FC250, 
-0x3A3C4A53355F5EA3, 0x560A50544B5AFB6A, 0xD285F98904A8B970, 0xE4B03D7F79940006, 
-0x4B655D933F707862, 0x15A7EB415D7DB, 0x4F80B1679BBC65D9, 0x37582866FB47E1F4, 
-0xDE15F9F47DD30251, 0x4D5449B7F5A6E541, 0x6D08C69A8DE47626, 0xC35E887C3557A3B9, 
-0x47AE663E676C, 
-0x561D15746210360C, 0x28B81AE9C1118A5, 0xA510FC007928F845, 0x38196EEDB23078E6, 
-0x63AA0C300157EADF, 0xB08F005B6C1AC7AA, 0x1EA077B7084C7, 0x6407674C502FFC1A, 
-0xFEE536C8F03C9617, 0x1D0BFFF2001DC98E, 0xCB44B09A21DB9BC0, 0x6D5BDEA5CFE68E43, 
-0x4F24BD46705EE98D, 0x1B7D014C7B03A, 0x593FB46A5006ACB0, 0xD37155E26BC0B24F, 
-0xEF2A89F3A0E09B8C, 0x1047C8301528DAE9, 0x4D0FAC98F140350F, 0x15A9947E311F9FD1, 
-0x11B825DAB9812, 
-0x46D6AD82F483BB18, 0x9389687FE5CDCC22, 0xB39CEA78D808825A, 0xD3574003C1A852AF, 
-0x456E3C69A3A19431, 0x11EA7ADB222CB2E1, 0x1F2CBF09A2AFC, 0x1E744BE93DB0F851, 
-0x58922852C0629E9B, 0xE015AF6775DFEB3F, 0x2FD9BA64E5CE16BA, 0xB106D19621821104, 
-0x7F34E98F73FBCC0F, 0x16192EED40960, 0xFA0AEB44A9DBDDBA, 0x8A695729DC17A6CE, 
-0xDA97D76309A39114, 0x949D9A00C5EC7A73, 0x74FE0EC80B1831FE, 0x60DA8FE69F129CA5, 
-0x1BE545E35D040, 
-0x75340372513F335B, 0xC23A17C12BB136E7, 0x75798B9F82B5D37D, 0xE80CD889C4260E36, 
-0xDD152DEB37FD8B57, 0xE6E575E56B8DF007, 0x6B9821A7232F, 0x712C27504E6B7D7E, 
-0x388390E60E5216E2, 0xEE24EFEF5A714BAA, 0x256DD6C3F87BBCDC, 0x28709A6211CEEB5D, 
-0x932368E528C3005, 0x4B77AC9F4DAC, 0x675843A3D9387BD6, 0x90A693BFF71B2B4F, 
-0x16DAC8FBC94AD2AD, 0xE139F7877A83EABB, 0xD9AF4677FE701576, 0x46F4467693D17233, 
-0x13C9101105026, 
-0x2E19ECB98F74A1B8, 0x4E30DF3E9C80727A, 0x4B0EF53F15ED86C3, 0x3806B4E3E6F45597, 
-0x712297955BA09E02, 0x235D33ED876E0E8B, 0x1C225F4DB1764, 0xCC996477AD11550A, 
-0xDDB0DBEFF9FF2EB0, 0x2CB5F8C0AE5A8546, 0x8D4578231A11AE90, 0xF5EFCF7DBF89C4B4, 
-0x82C4B104DDA846AA, 0x14859B52D8BC, 0x99FDDECBBEEEFF16, 0xE153AF0FD610F5A4, 
-0xD8140219C2B98108, 0xFC9B7C12A71B8AF0, 0xAB1E0B8B9B632F40, 0x8F0396FE3F803FDB, 
-0x1146167EDF4DF, 
-0x3B3C95E16367E52C, 0xF489688939E1ABD3, 0xB02D59AAB6FF9C08, 0xCA2D51C56D005678, 
-0xCF4D13F9E61CD78F, 0x297053DC69C7EFA3, 0xD72B049C86B8, 0x53D8554E64EB007A, 
-0x8E59871EA140063C, 0x34BE31602CBDDAF0, 0xF2E0901E347873C, 0xB6F5D30AD1A8F84B, 
-0x37412005D46E75DB, 0x1B979EDC14206, 0x28F0450F1A0A8FF0, 0x8EE94BAB6DC9002D, 
-0xCCF06E71C2C3C4D8, 0xD90ADA806DDEFCBE, 0x1B9DAC779F45E08A, 0x647AC4C339256D97, 
-0x1E89958F8D7D2, 
-0x88245EEC552430C, 0xE47483A4AC27DA60, 0x33EAC5AA442A726A, 0x4DB92DA4DDDDD0FB, 
-0xE3AC168D240C66D2, 0x38865601A5231B39, 0x40939D5E2713, 0x9489F974E9E9012, 
-0x20370C1A96BD06EC, 0x2A7A96D967E10A6A, 0x544ED4DA1483A180, 0x5AB046BE04D2A458, 
-0x526EAB765BC6170C, 0xB9B3360051DF, 0xBB3FA13DCC714BC1, 0x380611E9370FC308, 
-0x18CF2EA856DA05DC, 0x466B5F68464AC481, 0xDE2CD18DA4A8A8E8, 0x141D805BC84A6A49, 
-0x210E8A307F94D, 
-0x481724E6DA35F60B, 0x91DF05BB15A95E7B, 0x194A34F6319D29AB, 0xB001785058EC74B7, 
-0xB520E30C356EC9F9, 0x26EF6C824EDADCD5, 0x1AB220EA66165, 0x47467FFF7522A4DA, 
-0xC1FEA82150FD8740, 0x1F0DF1FF14B57BFB, 0x9F358F0224F34E9C, 0x3E03404AFE4330C8, 
-0x794677EF6DF0EC0F, 0x149255F457855, 0x9D231975DE427EF0, 0xAA1D124DAB81F777, 
-0x9E511F116B23A118, 0x920F4078502B6716, 0xD7DE36D360D817DD, 0x78938D2E4A8DEDCD, 
-0x192CF8C72E232, 
-0x4406A19F7EEDD074, 0x38BA3B3E64A5EB2B, 0x86AFE67DDFE2ED24, 0x60185AD73474A032, 
-0x2C85E30D016D2870, 0xE8B7B5026FB61B46, 0x1ABDA93970EBA, 0x8A56EEF0C471621B, 
-0x7B503769F662FFAA, 0x30AEA8296A5F3E7, 0x881330F4DBA67438, 0x32C452CB7A45C9E3, 
-0xD214D7139C229149, 0xF4C287D42B2C, 0xE634D57463EAEF1B, 0x1371504488C49273, 
-0x3748BE3800A70930, 0xA4A66325C85C238, 0xC3A3A5E143948312, 0x69B4EA0A2B3B8B2C, 
-0x1473BB3BB12C0, 
-0xE7224A6452129E90, 0x9F539E67EAC93103, 0x70D95B59767716FD, 0x166E549077C6CE04, 
-0xFA72672D19400F65, 0xE0D737164135DD54, 0x61CBDA520370, 0x338094C04C7D49A, 
-0x600EBD66C1505331, 0xDEA7581A40FF9EDE, 0xCE2AD3C6A65F936B, 0xC6AC8BD830C8D5F0, 
-0x4B4453769A024243, 0x97D655D13653, 0x80FD895AC3192B19, 0x177A0ABE5A28F5AC, 
-0xAF93D6D359535489, 0x53DFCD78F8977A34, 0xEE59DB211ECE7622, 0x1040DECFB38D173A, 
-0x17A2814EA50A9, 
-0xB426151C02BAD612, 0x74CA3AF4B122D7F8, 0xCB59FC6BB6589FFE, 0x6F1E5CA344B4D37A, 
-0x877A8672825F8DC4, 0xCB653B91F392762B, 0xD2D4CFBB7CE8, 0xDB3D34D5B1FC2BE, 
-0x4BF3D4735562B53B, 0x1D39F6219F551093, 0xF7E78D24DF4312FB, 0x75D30EC348BBBFCB, 
-0x59170E5B08611EE, 0x1CCC6631CD6BB, 0xD2E37CD76C58A9A7, 0x46F71E92052B23A5, 
-0x2348486B8AF6D29D, 0x2EA794492E17058B, 0xEC2CD2679D4864A5, 0xFCA9B1E4848AF9D, 
-0x5CF766B33F4F, 
-0x7213A0A1E91B4AD, 0x8776D9FE5F70C2D7, 0x51A804EBE71FD034, 0x369D4083A0AA579E, 
-0xB7D2C4070CA39DA6, 0x316C6E327C0C0834, 0x1EBC9B6F284BF, 0xE1DFAAFFD9653183, 
-0x84C6AE18E70C39AC, 0x82FC652124BD727, 0xD5EED5F32B529528, 0x422F575B2C8DBC1F, 
-0x5E10A004DF14A08B, 0xE4C6EE890C33, 0xCF7E218686CC14B8, 0x1E9610BD6CCD1AD, 
-0x284AD8BAF35C229D, 0xF6D47D2D0525DBB6, 0xC17C3D67F756202F, 0x8D9289C89ED1D12D, 
-0x216F4B0CAB053, 
-0x78161DBC5EF9CEF7, 0x22D345061FF830A8, 0x35EFD4464396E886, 0xAF110ED976F785DB, 
-0xD8975F505AFC7EED, 0xD2CB55387B912F90, 0x817B3641E29E, 0xECB9354338428F4D, 
-0x833FACF77E8E55FF, 0xF592D202CDCC7269, 0xF216626397681900, 0x8E4DE85DA11B47FC, 
-0x68BA26B5F88CE7FE, 0x5BA33BD11949, 0x21968C7D5288243F, 0x1EB38E6E8D23F4A5, 
-0x3F3EA2AF6F7D1A07, 0xED6899A0ED167DD4, 0x70EDD03CAE5EF588, 0x916FA19C2AB6976D, 
-0x1E0FA01675AE2, 
-0x3A213F353CE006CC, 0xF2AFFCD1292E34D9, 0x57CDA82C0FBA5506, 0x23647C6075128F28, 
-0x379FF9C0BC8042B4, 0x5F9EE5CDE44FB343, 0x822B3AED0244, 0x4CA5FD55B3694168, 
-0xC3A973E190D2FBBD, 0x8B3D86A87176A3B9, 0x42CE6D32DBC78158, 0x2B7B4A18B4B64EDB, 
-0xE9D11DE8CBAB0BB7, 0x141726CC3DC6F, 0x4F10FEC0B30144EF, 0xE799361C0F913428, 
-0xE6CD011E4DB88D22, 0x722B8CB0E2C1444D, 0x6401685D92E8173E, 0x26B6F205B994F2D5, 
-0x191246242AE4C, 
-0x1F8BD1674721B47A, 0x19AF0CA51774C228, 0x3245F4A3FD159D97, 0xE6B17B0FCB3E9EB7, 
-0xA0D36820B706E01C, 0x828E6666A7BD87C3, 0x47F0D3CA9F75, 0xD161B710D7B52E97, 
-0x622BAC75ADBF5F63, 0x9A709B2D97ECFC38, 0x8E7EE581373B117A, 0xF15A153AE5CD77D5, 
-0x88DB04775C7E9AB8, 0x9BCA7C44601C, 0x55AE4927482745B5, 0x1C891988D600B9B3, 
-0xB004673EDB858772, 0xA03EF7B3389DE68, 0x29F8B288B7531423, 0x2D50212ADE8AA3BC, 
-0x1B11E2E5FED37, 
-0xA21A09D8A2E7F4C5, 0xDABDDAF12CF23C9A, 0x7A12034766BAD6A5, 0xB2C57B5C88EB0C83, 
-0xAE175BE5FD690185, 0xDC19438BE004AB7C, 0x13456FECB160F, 0x7BF470172D16F41, 
-0x21A0CA8A23510B48, 0x3B1014A7B0D9703E, 0xDC0DACA54CE159AE, 0x6C7008BAF411C62E, 
-0xF7CC0654442AA13F, 0x1829B117A00D0, 0xAE7106F42202FEB6, 0xC46C450176163AD6, 
-0x1D7B8BB249FF7101, 0x644673A9211C7191, 0xC4D3BA3DD4CAD6F6, 0x7601619FE8503ED8, 
-0x1EE704315DCD6, 
-0x4E051C6F57AB634C, 0xC6EEFFEC2C5C6219, 0x809E79A39B957305, 0x1CEBA0DA60A0815D, 
-0xC82C3AAAA74DA406, 0xA745F227E012A740, 0x18DB0858B4D51, 0x34E318751EA7D311, 
-0x8DDCD943DDCBA095, 0x12C05FDB3675726D, 0x1CFA0FA1BDBA7A89, 0x6C7673A492EAA3E5, 
-0x1AEFA11A3077E7A6, 0x163AA019871F6, 0xC81B2029E47B26A, 0xC6A1F8DA445F686B, 
-0x47986C5A1C4A82FF, 0xE4BE1018F68C2054, 0x7540C53E6E172CEF, 0x555360E2934D2B2E, 
-0x5764BCDA5082, 
-0xCCE0042B279EF44C, 0xB90B635363D64FA8, 0xD37329E92E8EF0AD, 0xAA18AEB250D47224, 
-0x4EDAA0C5B067ADC6, 0x6A416BB9451A1F2C, 0x616E76A10E02, 0xD3D1C8EFD1D9B825, 
-0xAC76E5B1F4B57D8F, 0xFD00C097B1D9375B, 0xE69D0AE1BD3E51D7, 0x6A0D1FA2C689C3B4, 
-0x5F1BDFC53E7E318C, 0x22E3635B3EA59, 0x9EA195D7A7C81714, 0xD3330A9298C4EE0A, 
-0x286FF1FB7B3B2B18, 0xBD48AF69EAEB03F7, 0x77A1AD478857E25B, 0xA8C3B748C74E5461, 
-0x20226342E2066, 
-0x3092A6DA2CE8F46F, 0xA00E56D1B9FD3210, 0x7AD0BD58B1D493EB, 0xDD9D4A8A0E98B1D4, 
-0xECBC61FF3ADD4FB3, 0x858DE730DAEC7B90, 0x16EED08105F45, 0xFFAAB901A6FDF8ED, 
-0xFA2BC8AED9516AA7, 0xB9370204DB03D13A, 0x99121EB8B9190747, 0xD309DCC7D889EC3, 
-0xE93951B63C05388E, 0x103FB48FB9ABD, 0x6AE28208F9775F7D, 0xDAEEF885E009443B, 
-0xDF57D977600EEC8C, 0x83937CBCE8B15234, 0x3BFB08D6DE1532BC, 0xB73A0A0F656DDF16, 
-0xCCC7B1267F73, 
-0x2608D1820510AFD, 0x49473D13C9544C5A, 0x4918BF0BA4DDF5E8, 0xF231570CDA63B893, 
-0x48D2D395BD4F1846, 0x6CD124FDC90F0C73, 0x5B4C55112B56, 0x361E98CBA42142C5, 
-0xF66ED2564DC8D86D, 0xEB9F281244E9BC2E, 0x666673C1EDEA0C32, 0x71E74117903C0B1B, 
-0x7655BE34C2F4F9FB, 0xC5647FE9403B, 0xF9CEBBB90E698CAA, 0xB13CC83DBD2F4CDD, 
-0x41B8B4733EA6CF01, 0x62BE57A5543D93CF, 0xABEFCEDC2B9F0D3, 0xE91B8964828776A0, 
-0x13302F3FB0582, 
-0xBF29E39E8074ADB2, 0x9F5386CBF422906D, 0x9119B3CF41404C4B, 0xD80B0DE690A91CAB, 
-0xF00E68373E7EBFD7, 0x7B0BC4C0DFFB6080, 0x179708661F1B8, 0xEFBF0677E3784E96, 
-0xC4AD7434F995A1C, 0x5B340156ADC20154, 0x8AC2F2EDFB8B9536, 0x1DBC439FB10D26FC, 
-0x5F0D840761B061AC, 0xF478F1F9A896, 0x45068CC2206E35FD, 0x1FD82040DC975A41, 
-0x40354971C6CE9F2F, 0xA760C4DC3BB9B544, 0xE2B134CBAB8A7AD9, 0x60EE1C820C2F8BAE, 
-0x229BF00C8D96D, 
-0x8C118CDE015B693B, 0xAED823A93CDCD746, 0x28D668A2DC7DE144, 0x6189A840BDF16806, 
-0xD310BD2E8045B0D5, 0x5CF5066552D295EF, 0x1443545D752B8, 0x46E3CE59BD0FCC91, 
-0x797BCEE3EAC01D91, 0x84BE318CD5B73D90, 0xFD5B0CCF0BFBCC09, 0x59C2A46348D4F465, 
-0xC281AC21D73C4122, 0x217A9806CB883, 0x438036B70A14F458, 0xB5DC001E36EEA849, 
-0xFC018AB18DBC02AA, 0x5778BC5A2EB9E9CE, 0xEED0E9EFD4A80327, 0x33707794A7D60F67, 
-0xA9E89E21E93A, 
-0xF8AFD562FD97E0C8, 0x2389347B48446517, 0xE9F8C5C6819D1293, 0x63E46474908B94ED, 
-0xCE07F95B973D6877, 0x340FF7CA0018A5D1, 0xF9400FF5B03, 0x7225FE4950CACF33, 
-0xC49BB0A08C467A00, 0x6C6F99E1B96C12B9, 0x87F419E5BDF50020, 0x48B832D2F12634DE, 
-0x58A117807F25995F, 0x9AF1B2F3E92B, 0xEF4D574A62AF12AF, 0xBD833FE8AE3C30E1, 
-0xD83A5A59B4A5EDD8, 0x2E623692A1C9B198, 0xC253213C9D6B89B3, 0x20F58299268CF9B3, 
-0x151900EC61E69, 
-0x73A6F5AAC158E006, 0x5D01D6050EF525A3, 0x79381C7F1ED47ADA, 0xAB9C1D3405843892, 
-0xE846BF239BBD3D3D, 0x9BDF64F04B80A65, 0x19DBDD8378E4A, 0x39B851D92ACB81F2, 
-0xFE476C5D44A8A5E2, 0x5A7411B65C3DE4A2, 0xCC838711A94DC1BA, 0x11C4FB5E1B7D615, 
-0xE17953B430B63EE6, 0x2173DEB1C9C83, 0xAAD9A4194E914227, 0xC35F2D401CFB86AD, 
-0x41E8051E2B94427, 0xA1608C909CADA827, 0x6194793F443F8601, 0xED4453B9AD0F33C6, 
-0xF04C2EE575F4, 
-0x9F19D9B9974F952B, 0xB754FA65B9AAA880, 0xC13CB955F71EF91A, 0x6C4249A15E540869, 
-0x250F10A9F15FE4B, 0xEC663A4AF62B0260, 0x358C1D492268, 0xF6E449AB8B0A1EC, 
-0x6906514BAD27351F, 0x6705FA26B0AA6391, 0xF1B7814A6BC75F4D, 0x733030BC67A6F0, 
-0xE2A2DD7F353E6BFE, 0x1512ACE963DDE, 0xAB03CC9FA99FC908, 0x3F927D0D92B1E871, 
-0x1B60A69AF058012E, 0x48123ECF1E2A6BD0, 0xA5521E6C72ACE9A3, 0x7C9CA25AE26A02E7, 
-0x75A34F550BCD, 
-0x3FE561A36F15BF71, 0x49CB13D323695231, 0x9F080FC53187CC5A, 0x45999232B1169951, 
-0x4CD4EC393094C455, 0xD698A97D5CDC738D, 0x16BE14D820F52, 0x5E6DC62A392D16C, 
-0x17DCA5A91D139C1B, 0xE25B3838A27F1999, 0x4258A4C8AEF5707B, 0x4390B42DD7A04D35, 
-0x1FBE1C3881A47958, 0x1816FA6DECEE, 0x39CA515215CDD08D, 0x15483082981FB91D, 
-0x828941593A46035B, 0x658B87283CEB74EE, 0x49585DE098283845, 0xE1972F109EEB4DE1, 
-0x1AD73D37CC07C, 
-0xCA172D06025251C6, 0x2C6C5EC81A015E43, 0x9555FCF457534E10, 0x40DC87931476D42A, 
-0xB616B89D710D4A35, 0x7D86168C394C3602, 0x2ED8AE4259F, 0xD60DF7D2DF1F94E8, 
-0x27655CAD33440CFA, 0xF31835486D7351F6, 0xADB7B31A0694CD58, 0x84A5E045993CB193, 
-0x3E88CFA559D0BEA0, 0x52786A620E91, 0x8321507D26671D60, 0xB8E9CC889621CA83, 
-0xB95331F50165435B, 0xC2E6C1F9C0178A02, 0x1F7F1F68C21540D7, 0x33E03E8956DD5C33, 
-0x1EEA37870AB12, 
-0xC03072B7F1DC9571, 0x4648E2C0628DE696, 0x3FE54724742E42D4, 0x773679BDE9D4DDC8, 
-0xCEDEEDF8F71B7DD2, 0x78C1A61411DDF5B5, 0x155D63CAB6094, 0xA3A4441D144115D2, 
-0xCBA4C841F92790DA, 0x1913216BA15EE11, 0xC32A6D81C87085C0, 0x9D700F80468ABC45, 
-0x90D2BA368219CBC3, 0x1CADBCB3BAD14, 0x2A8A0946EFACBC22, 0xF0729369A5502C19, 
-0x9366BE7CECD66D9E, 0x5C76E32E6C37C2F9, 0x8B76F42AB2B8F67D, 0xCF99670E1666CE40, 
-0x41A79D229E00, 
-0x7F635FF58E9608FA, 0xB27BCA8448AEC3AE, 0xA58C80E084B0385A, 0xF3F33CBB4ED05018, 
-0xF83AA44B13490059, 0xA603E860B8B2F0DB, 0xD194908FB4E0, 0x498C986BC3DA1A1F, 
-0xB9855352817ED2AC, 0x1B6538FE457FC1F, 0x1CFCD70DA14B3A4D, 0xED69F162C44CD3EF, 
-0x29F3CD0D8AE5ED, 0x60E479C07E35, 0x249978203555D1E6, 0x596B6A0EA93CBB38, 
-0x89EE91416B0C712C, 0xDFF78A8B182987E4, 0xF84516F7FDA42EE2, 0x5A07FA3F47C8CEAD, 
-0x1FBB1F570800, 
-0xD4F43FD184841CAB, 0xD11AD33E8838DFCB, 0x37E3D68ACA898623, 0xE68EC1954F0EB2D, 
-0x90AE19A542287F25, 0x715F8A9A72EF2EEA, 0x1761E1D46D488, 0x174A281BE1D4052C, 
-0x60FF55C66576248E, 0x2A33DF9C29C58753, 0x4199B20BE579884, 0xE85A0BC73916DB0D, 
-0x4750F93EF57347D1, 0x22E5D34B81E79, 0xD550C04DA9AA4D6C, 0x4A3110DFED974263, 
-0x9B0F0F5390C70D0D, 0xF87A5BD3A3BAC4A, 0x52C8C3BC6862D995, 0x1806E1D935578F2C, 
-0x11A3169AFB5A2, 
-0x223FB1FEA20C173, 0xF80329428AD9FA9, 0xB6900372AB8830F8, 0x9D005E155AF896D2, 
-0x310C44CB952EF11, 0x1CF11E79E8B19032, 0x1BC6C1CCFFCE2, 0x128D9649D3C3445A, 
-0x390EA9029BFB7D88, 0xD3AC7C64D8A27F1D, 0x92AA07AA280DD926, 0x2D09FB1BE53E4BF4, 
-0x9BFC8A96B4C52A65, 0x69FE6645BBF0, 0x644F04FDE3D25752, 0xCD23D5E01D888E28, 
-0x2BC3DCD2CE6363D0, 0x2172BAC4DFC96B67, 0xDB431C01F7315B9, 0xD19127D35203CD7F, 
-0x176C64AE89F94, 
-0x8D6D31B0B026194, 0x3741A3B46B14FE5A, 0x7FD3BFA7A1FDF20E, 0x5B11644E6A72C0A1, 
-0x99B71CEFE491965C, 0x680B1B6BA52D3B8, 0x15E5727F8AD6, 0xB33C4E7B32ADAC19, 
-0xDE714D430A9A535C, 0x7EA0E010C8301DD7, 0x22566D24A3BE5FB6, 0x6633AFAB3CFC2FE1, 
-0xC65BAD8ABE059721, 0x4A01051C2CCE, 0x1CCDACFA31C3AFE3, 0xF74139F183075909, 
-0x3DBB57B46D83E998, 0x44A267DDD3E2CB9B, 0xF18DFB0FBA031B8F, 0x8106924B75F0C57E, 
-0xFDD68FAA2F1E, 
-0x17B24205B645DF8D, 0x2273E23C12BEC813, 0x1DABC93328149D2B, 0x26E8FD8429644F84, 
-0x2C97939630B34F34, 0xF5F9881F5F2B9E82, 0x90AD7447BFF4, 0x7CFF0BE3C0D32671, 
-0x8D13E931B65A0600, 0xFF9BAC3E12775A8, 0xF55E0ABFFA504828, 0x9B08D89000866E71, 
-0x6ABCB43B03C894C1, 0x1C2B98E82F8E7, 0x9EF14F626A5B0968, 0x4F28464BF533F90F, 
-0x5CBEA1059E12CCFE, 0xD6EB20C9C9D65E7, 0xB09F95D1BD264769, 0xECB5E52E99ABDE93, 
-0x6818691FB807, 
-0x931C93DEE78F8D9A, 0xF8AFBD593A247EAD, 0x83562757AD1526A7, 0xC950BA752C59AA52, 
-0xA802D7177D460D65, 0xB48BE82A62210E7B, 0x6D85AB3F632B, 0xCC4F8432E1D0B6E5, 
-0xAA1D2831B5392C03, 0x5F3A0D9ECBD6F6C5, 0x357534302497F4FC, 0xF34A4EF395610315, 
-0x14438D14763D767A, 0x1F6CB342528B9, 0x66C90AA3C25B7ABF, 0xD84FF95A090C017, 
-0x21AA0D8845A1602D, 0x402492062BDF0EAC, 0x40F323D06767104, 0xD757FA0BB63F3A3B, 
-0x1B6B136C18B29, 
-0xDD743941FAFA3EE9, 0xAD030604165FE546, 0xF0041371E3CFFB08, 0xD5A93E488A294A32, 
-0x99506A0DD725F28B, 0x7BD7A2B557D9D2DC, 0x139BDC4521C45, 0x1E635C5B1E53F743, 
-0x915E0A7A7722FB3, 0x55D02B0481E40FA5, 0xDF926A6F61197507, 0xCBB0FA81B3A0DF72, 
-0x77A89DA7164D5710, 0x14E60B865D9CD, 0x1C76A58A06337643, 0xB95B45E4DEBA35A5, 
-0x5F77622F2295AADD, 0x95B05E9672DAEB4F, 0x7EED400F79A2825A, 0x91E01C949101BD86, 
-0x3571A91DE7F6, 
-0xDCB4365BA13D25C, 0x6C8FA18CDC1A74E7, 0x8E1C53C91A3ACA5B, 0xF62E2A852A0CFD3B, 
-0x40A2394CD9D6F1FE, 0x4FD909C2AEB3397F, 0x1DC94587391C6, 0x6CA06CA83AB428EF, 
-0x2696505EC733587C, 0x3363792D7FECD041, 0xCDCA60A3DB80570, 0x4B8BA4BD686F5143, 
-0x399673E7C9F6F51B, 0x148BB37CA8B0, 0xBEEDDB030C6CCD58, 0x9DD064A95F371CDF, 
-0x5D8409F478373AE3, 0xF661745CE89E03B2, 0xFD795A3CEDBC707, 0xAC11C8E403873D41, 
-0x43989F7D2FE8, 
-0xC6656FCA558362E2, 0x864B2D9C28D84D06, 0xA4EF9A3D6054DEAC, 0x52D72E79A37327C3, 
-0x2FC54208CE16E823, 0x5F3B947224B6A799, 0x2CB57F4DB904, 0x2262ED8E00862BFF, 
-0xEC1EFDE0C1453A54, 0xE12CAB7E769D7074, 0x914909205713E5D9, 0xE3AB67D9CD40B0A3, 
-0x1477A7E43F1B2C95, 0x3DDC0C23CD1C, 0x8CB5227C54BDF9EE, 0xE3CA0B96885F38D3, 
-0xD92D791855ED5FF, 0xC84A352E7721363D, 0x8763AB27D78CD5D, 0x42B4DF62E77790C7, 
-0x218738C641831, 
-0xD61686C40CFAD5BB, 0xBBA7D4EA3BCD041A, 0x333DAF2D9142151D, 0xA63CE59C86E720A1, 
-0xC5625043A94BBC3, 0x909113756D923AB7, 0x1BF5EE874E368, 0x3196BF540EEB3F45, 
-0xA5454A74194C5EA7, 0xC4AFF5D69AC1FB99, 0x730A160BB9DBE10F, 0x5C39EDF2BDDE4881, 
-0xAB4D7E3E602696EB, 0x2FCE14440B7F, 0x28A63C1AAB3794D1, 0x5CBE328F8DA07876, 
-0xB52FF0C5863E4A01, 0x2D95EEAD51564E5, 0xA0BAFE9C55258613, 0x18A773A831EF4B50, 
-0xAB963F6A0C6C, 
-0x8F21E79D5D8416CB, 0x99F491224A19137B, 0xDE4AD415CD11B19F, 0x64C667BFDFB16C39, 
-0x65C1640A92445F4A, 0xC032D8D282A7DE7A, 0x12D50E30E8BAB, 0x7EB94B7F78E0A801, 
-0xC88B5F995CF32606, 0x946328E588D32BC5, 0x46DF53A5EEAD0A35, 0x28646ED6978C0714, 
-0x4A67787E9778DC5E, 0x133D37C3F9E0C, 0x6F88C3C56F3EC76F, 0x7774E4E2327EE19F, 
-0xD8FCF230DC9F0DF3, 0x86573ACDC9D68963, 0xD10B2811B25566DE, 0xFA2FA38800EB3C39, 
-0x118920DA279A7, 
-0xCCEAD13988C1363B, 0xC36B962708EFCEB7, 0xF0DDCB2DFE9CCEDF, 0x529BE48800837D7B, 
-0xD8179AE6BF4E4383, 0x94A41C430F563983, 0x1AE1B71696E7E, 0xDE7A833F307BAF9A, 
-0x6E623AED257515E9, 0x3FD4A4CDF0261AA4, 0x29D5A2E064CC71FF, 0x13BE636798DEDDFF, 
-0xF4E605D1B9A00793, 0x9D9C5E337736, 0xA91DD642740C9985, 0x696915965FCBAB3E, 
-0xC9EEEC5D006175DF, 0xF626C539B2A4F01B, 0x6F58D19FEC150AEE, 0x13403B4A8912C0AF, 
-0x399132F0803F, 
-0xC79F6ACC7A74F5C8, 0xE577E43EEDEA330E, 0xA53F39F793C4A661, 0xE8774CF477302CFA, 
-0x28B2813DC94CF0AE, 0x10D8DC4E1FDBFD08, 0x4FA4B5F32584, 0x4A8305467786376D, 
-0xBC3E27A9838D5F37, 0xEC296C7EAC6D2DF4, 0x9BEA228FE88BD31B, 0x2501A7E769F542F5, 
-0xF3616C6E826D2C6D, 0x204A8827E82F3, 0x120DC938DF610204, 0x3071EDF6AE249D46, 
-0x5F06FB699F6F5F25, 0x4EE214529D93392E, 0xB8799CEFF87A2899, 0xBC3A94371638F539, 
-0x10F8538839295, 
-0x5F4773544B449F0E, 0xFDFBDAF4A5D302A, 0xD138794D82630266, 0x4B4DF8FCA7E068C0, 
-0x6445C6F9E7C51EE9, 0x92C8D8D3277E78AA, 0x16D7930C830CB, 0xB38BF45B0F55A02, 
-0x9688D72A618DF907, 0x2665BC378E786676, 0xADCDC0996E6E13D0, 0xD5D295A4101DA92D, 
-0x7472E096FB9BB1E1, 0x142FAEB833D9, 0x45DA51FD934E69B3, 0xA99DF860DE0A525F, 
-0xAA6516A08E07E5C8, 0xF0F4CD156E286A9, 0x8BD5A632E04962FD, 0xAE52B5FFF3A86A39, 
-0xA3EB2F52CF04, 
-0x9D60AA206FEC0B3A, 0x22CD6162F6FD932E, 0x68EB408366601487, 0x6E385166B90BCA23, 
-0xF01D87A6B0FBCD11, 0x7B8A78E86B73AD92, 0x1AC4942023479, 0x7F3BF113FD2ADB89, 
-0xE26CF289CA3D093A, 0x740D52B609620416, 0xC62FD487B5758F24, 0xCDFE60CA2E09C87D, 
-0x35943BE690E638D8, 0x6ED6C8E13613, 0x4DF4CD78F91ECF80, 0x2D23826BE51A8E5C, 
-0x886EE4DED56A2DC9, 0xF001F08D3E31935B, 0xD20F59573C159709, 0x98BDE91D2BD788DB, 
-0xAFCA5C022FC6, 
-0x61A3B5F9FD0EDAF5, 0xA4BB68C8390DF532, 0xB72312FDA16D6252, 0x6A3FD35774FCF309, 
-0xAE991209D6F1C9F4, 0xA53640193B26AC7B, 0xFC108BD443C9, 0xAF697B7B27D3B998, 
-0x2E410A79C176B23D, 0xB240B26AAA533803, 0x4B4CB3A343101905, 0xB5689D5B1CA0E8D6, 
-0x166E767076AD3560, 0x149A9B30673F1, 0x748D2C960AA5D08F, 0xC97FE0A4AC8A79F5, 
-0xEB7A4517A4F098DB, 0x41FFC38A668764DC, 0xF87E459329DF0080, 0x50C71FCBF220F4CF, 
-0xB4752FA01D11, 
-0x46BE20AD0DC4B28B, 0xD997D73FD6358FE1, 0x1C102F3209CE678A, 0xA113D8BE95242C45, 
-0x2E1ECDB0E5FAF381, 0x938242571BD4C1D9, 0x16A86E3D59B9A, 0xF74E07F1CDB7906C, 
-0xA7569546788E2E98, 0x7645C92058851372, 0xB1AD19D3A53103FA, 0xE3095DC4671AB21E, 
-0x7AF9A2DFD5C6EBED, 0x34F99006DD08, 0xEF8B7254F23B028F, 0xB0EC2C4E30DC5D2B, 
-0x69C14D75F99B445B, 0xEEDDA90C85C09951, 0xFAC3939829C69E74, 0xF1176FC7193539E4, 
-0x146DCA5E4974E, 
-0x80AC9419D6F57B92, 0xCB0F687DC5077A45, 0x26312579460F4FE0, 0x4168008404F44A14, 
-0xB2C77D27C24B5294, 0xC4E509166F431A11, 0xBEB88E1E74E4, 0xA59E5D8854419C39, 
-0x3F918A3FDFCA6985, 0xA4570FBE424FA026, 0xCB480422325497AC, 0x7DF40E23E53E7CE0, 
-0xD494FE952FEEF042, 0x1A5E3674E6C1B, 0x3B5FD3AB940B7716, 0x9BA4178FE4464876, 
-0xACC4B6E1C9EF69B7, 0xCD2DF51E45BFD360, 0xAB8ADA4A73A12FAD, 0x518F94702F01C0C2, 
-0x210E2D7EEEA46, 
-0x9E9E6C5C7D4FCFC9, 0x948F15624D3DBD5A, 0x44D5B4197754CEF0, 0x2271F655B633815, 
-0x930A484A9355C77B, 0xB8C56D3DA05EA940, 0xA75C625516B0, 0xEF80AE7FE95E909F, 
-0xB11C82F0F2C0A88C, 0x2DC07D9EFB5A4590, 0x5E58FFF8597B48C6, 0x9469FE21D193F7D8, 
-0xA6E3BF5D09F22F0D, 0x2F1FDF41052E, 0x598D25EA469D8BA3, 0x897470DCD3DC8D02, 
-0x48D216B1370FCCA2, 0x55501110533A9D83, 0x329D1BA71051CC4F, 0x987552745FCA0931, 
-0xDE730920837D, 
-0xF47DD4E45EBC968A, 0x889DE3DB4B97AFAC, 0x555917B863DB95D6, 0xD2AA894EC8015890, 
-0x15C3A485727D2E05, 0x73E89724C68C6996, 0xBD263E2635F7, 0x7492AA9C58B101E9, 
-0xCAF3B5E2844C771F, 0x4FE8EB195CE2BC3B, 0xE487418F88F5D332, 0xBD0684EC022C4141, 
-0x56991DAC483B6263, 0x5DB69DF37A11, 0x3FCAB036B46C4D73, 0xC14C1C08442A069, 
-0x23E1EE040431DD50, 0x6C407F6DE8B8D1F8, 0x3825177BCB362EF8, 0x76C0ACC0A70CB8F2, 
-0x5D2ED43FC52A, 
-0x166DC22DD1D6D792, 0xB1D62BC34A508F3B, 0x659CA5EF42E2F712, 0x599213FFA5EEA4A7, 
-0xACDFDB064094EF00, 0x9A24552F5826A792, 0x5FF9209B683, 0xCD57D403DA40AEBF, 
-0xFDDF15187770985A, 0xC5619577FC362292, 0x94B7043CC1BB5ABA, 0xA1DF983939F15430, 
-0x931165EC081D98EB, 0x20FA91E9DFAD1, 0x8F91D0E8F5FE7E22, 0x68FB08B18D868EC1, 
-0x5C47D9633D2F3D6F, 0x2E62E4834745EF16, 0x7DAA4B9B632F44C2, 0x2CBC7ECDA9FBE955, 
-0x1344A1C741376, 
-0xA6F86B2200B048C9, 0x42CA1A2DAD079D6D, 0x9C6579ED5908FCAD, 0xE8AEE86F80049A3B, 
-0xC7BF190F7252AFF4, 0x135E78AE16C927B5, 0x9AAD513922CD, 0x17DFB7098EF515AE, 
-0xDE0B43A164757DBB, 0xC1EA4DAE4ABD03DB, 0xA79487F2766CAA85, 0x63CE740785E2D481, 
-0x9F769E554C2E115C, 0x21953FC8A7401, 0x3846FC0E7D7486D7, 0x9193260B12858E70, 
-0x444A0BDFBDE3DC70, 0xF4D1553E81B1F231, 0x8BB74844DF3B3074, 0x4A7F7E3BBB211D22, 
-0x5AA2E14AC71B, 
-0x1511BA378B579302, 0x8447FB713C86E54D, 0x20B85C232020B611, 0x7B2DFAB630407386, 
-0x4C61673F1421B2CE, 0xD084800C959668F4, 0xC21BF1E6516B, 0xC862EF7588B0FA4D, 
-0xCCB1E3D459FF5C06, 0x1517B25DEA81FE57, 0x80AD239428140433, 0x3A6B14492101D06, 
-0x58C5FA5090B2C4A2, 0x6F03641BDEC8, 0xC4A312A856F666FA, 0x9F837A7ED5364AFF, 
-0xD85CAD84115AE00A, 0xD03DE0D32E069FEC, 0x622F8D8902DB9323, 0x1212958BC6EF964D, 
-0x28449B95D5CC, 
-0xBF790CF820472332, 0x1DAEB58E61D65A8B, 0x185BB692CA9E08FC, 0xB7A53DD524E7DDE7, 
-0x928B25C710E1645, 0x341DA2751227AF71, 0x1178EC1BCDB92, 0x42A08F588EE46FDA, 
-0x9682F8C91E0D607D, 0x1439A1B3E9EEE31E, 0xA6150AD0150750DF, 0x2268577E84C7CE57, 
-0xF8236671DD1E455C, 0x39499446E61C, 0x46F97F09FEE9F93F, 0x3B56401B4D217D3D, 
-0x27A4F30FC6F5FF3C, 0x80A85FEEC9AEBA40, 0x8E23C7366356F958, 0x7C6A4BAD9CC591F4, 
-0x22569419D3342, 
-0xA581F492F00E9402, 0x4C00C194DC9C14D3, 0xEBE227BD2C7800D9, 0xB9D5E5DCF5675D2C, 
-0x707E2A578B203923, 0x6B086C327853FDAF, 0xA2BDFA972228, 0xED8C42A1B0838972, 
-0x2D9CF6E50BC0C7C7, 0xD474D06A3E4495B0, 0xF3AD8D0C5C2A763C, 0x1CF3979489CB50E2, 
-0xE87D1CC5D7292495, 0x530A07116FF9, 0xC9DF6DCD9221BE8B, 0x69BD422AF592A52B, 
-0x1E9523796B99787, 0xD5FBA5CF175EB06, 0x31C131EA645B9BC8, 0xA8669046A3BE1AC6, 
-0x1CD2A72600BB9, 
-0x5F6562B87826E01B, 0xCE4DC73D90145400, 0x7C6E652CEB2D1DDC, 0xD3FFBDD6C9288DEE, 
-0x11622FB7B2E03F13, 0xB979C64D8879C6A, 0xC345A5078E71, 0xDBB3FBBA09B27708, 
-0xC84BF178717555DB, 0x5601D0D0B74564BD, 0x368508415AAE840B, 0x614F24D56F15838C, 
-0x200417BEA91E18E3, 0x1F0FA9A67E067, 0x3E035B28F7FB48E7, 0x9522BF63B9392F86, 
-0xEBE07369A1E7358B, 0x9BC475E605680FEF, 0x1794B2743DB8411E, 0x4C0001332FDAAEEC, 
-0x21F951A6B9E22, 
-0x4830DBD5780B5942, 0x64D64E699272B0BD, 0x123A9F3D329A875C, 0x5CEED18564B066A1, 
-0x84DB7AD0AC1EFA56, 0x646D30380949C92E, 0x12DA324D0AC48, 0xA4F8D6E4A2CA7EB2, 
-0x20929CEEC7C03DB5, 0x691DFE81991BC66F, 0x6A96B28215295D75, 0x4BC94257729265A8, 
-0xECE78BDB75EFFDAB, 0x11C535B4AA3C2, 0x28D713E847E4A748, 0x6008A4F4D5D9AE71, 
-0x25A7EE6DC884CCD4, 0x1E1ED5B1A33E0D, 0xB137C31B19946C89, 0xBB25D5E1EC633210, 
-0x1F230778FAE9F, 
-0x5D1AEAEAB38AFE6, 0xCE4EEA84AAC67654, 0x4E1EB17C76B80A52, 0x1E6B97742159D2C0, 
-0x7406298453D92F73, 0xEF312CD8D4F4E540, 0x1624EF93C52CA, 0xDE54112EAF2B7895, 
-0x17F33CA34E94287, 0xAB698129E7AB8228, 0xEBEFFF584581419E, 0x32F911A89AF8F1B3, 
-0x75859C409F724349, 0x14E4E8B4D47CA, 0x7C7786DAF0506E88, 0x21DD9E31A3E0C2F0, 
-0xECB1615552682DFA, 0x33C6992C43EDA9A9, 0x1172569AF902DE83, 0xAF3962C1E359A20D, 
-0x10EBECE4F631F, 
-0x5039D574AE1B779C, 0x636B34232422853C, 0x6886CA54F3839851, 0xFA1BD16C77E90F4B, 
-0x5B717CA723A00311, 0x3C1C0E2A8F30E888, 0x5DB4F431FF31, 0xA8E30484CA2A4D32, 
-0x73826B5CAD5A7219, 0xB3C5E96AA2379952, 0xAFBE95831850F296, 0x45E9DE24D1E6B2B8, 
-0x93FD355834C5300A, 0xB3E96B0735A4, 0xD595E9E42C5A4F03, 0x2321E17F4B8C2ED2, 
-0x98AE3F429ECCB371, 0x9540E264C81246DD, 0xC3750E523F24E5C4, 0xD9BEC18FC1426368, 
-0x7F045FB6B23, 
-0x796E1E80438D9E0, 0x3C450145C448EF4D, 0x9C9F9E877BF93227, 0x4F03163A9B24C1E6, 
-0xE6DFD88CC77DC494, 0xFD4F48B8E0EAB2FF, 0x146A86360F1BD, 0xD2EC040C554536A, 
-0xEF566B980DC7FCBA, 0x2C1E8E715393B156, 0xEA085AAF5EFD7B4F, 0xA7793FCFC955D901, 
-0x7AC0FA0654BCD11F, 0x303E4480A75C, 0xB74DCB0637445673, 0xC27AFD6378FFBF7F, 
-0xF4BC4F62CD438BAF, 0x7165B11589E76FA3, 0xB19D81188DFF58C8, 0xD274294FB47DBBAF, 
-0x22D10EBC4271F, 
-0xD9377AD30F840974, 0x7E0B114876DE30F6, 0x75693CE4E13AC6D7, 0x2396A45EC85FF5FB, 
-0xEB1E1D1628028D3F, 0xF243CCB8D590F74A, 0x12907F577CAC2, 0x1B381BCBE74A622E, 
-0x4C2569BA0E8D8B00, 0x4251A4AE3494E255, 0xEFD29D556A6A3F21, 0xE2282B641054FF34, 
-0xD31C4F26E87000F5, 0x1D77635F0A80A, 0x6608019285890CB8, 0x8E9AFFC1AA2E9521, 
-0xD391F62342911902, 0x7066121F4F1333E4, 0x8B7DE76B9C6B172B, 0xB7303F2B0CB151A2, 
-0x20EF76D0386EB, 
-0xF11C546A56549BDE, 0x86A6B78BD12CF229, 0x5910DEFA329B5C8A, 0x10AB69F52FF05070, 
-0xA0C23E1C1B42C169, 0xAF787FD8CE458269, 0x10D92DF917011, 0xCA9401217A52B693, 
-0xE2A8238FB362DD76, 0xA57071232F09999C, 0xD84EDA4077581D30, 0x2FE806D32A055281, 
-0x27C06902FD88EB49, 0x16154912DFA2A, 0x8EE6A5F2F0BA4B2D, 0x339751E61CA197A6, 
-0x7484272C422880EE, 0x1980CAF3C281B13A, 0xC878CE71BF68FBC4, 0xB1263F111708B2F5, 
-0xF6BCDC99DD4C, 
-0xE417DF0DFECA49CE, 0x9C71112BA5311042, 0x41D0C84895EAD2BB, 0xD316F3BF9D98D6, 
-0x8FED598312371EA8, 0xE9DB40357AA237FB, 0x1D205AB11BDD3, 0x9E98107947A43657, 
-0xD4EDCF3A503B8B2, 0x15E0EBA73D6F4F2D, 0xBD3026A1460F83AA, 0xFE306BE65A7BF2B, 
-0x2BCB71CC82FB7F2F, 0xC2C2A1788997, 0x9FE56A28D91A1049, 0x8870E8B48B68386B, 
-0xD39C1CEA9E301146, 0x5DD020E9EEE80B93, 0x207581B356122315, 0x2C9B61945AC6A820, 
-0x1EAC0FDF5BFD5, 
-0x9D4D862C2E94B430, 0x27B342B2DE54641E, 0xBE8C955E54E93CAA, 0xC2D4584C77647C65, 
-0x62D4B39101093E41, 0x26E1A3A194CCCEFB, 0x3CBA15B6CD59, 0x3AB86E8EAA4AF042, 
-0xB7CE1B15B72A153F, 0x60C87649346249E9, 0xA7AC0CAEF8F25E80, 0xB3701A9F63EADBB8, 
-0x7442F9A412D4977D, 0x1FB109BDE7C6B, 0x3ED41F3CB491881F, 0xB9BB779238A45A9D, 
-0xDD85F8763F8DA976, 0xD468A1458A338EC5, 0xEFFAE02189F8A602, 0x9F2CA02130829343, 
-0xD8F83CF2D84C, 
-0xBA5AB82AE49E6893, 0xD4676CA641B9D170, 0x88D501B3EAF62A53, 0x7B4DB491F9D66D25, 
-0x518B5E9EF4DEA9A0, 0x1BCD4BD9B07AF42, 0x17D3FE6068EF9, 0xDA1552C3300996E3, 
-0xE9465504AD1E7D44, 0x779A315216C370DE, 0xB7062D7A03016A0F, 0xCEA1276622C49703, 
-0x943D38C0CA4978E2, 0x1CCB2E520B4F2, 0xD8718310E005119B, 0xD44B36049DDA825D, 
-0x5445F9E5E62E5547, 0x13D29E9C652D9462, 0xAFD77F806F494700, 0x5282F8DFA1AB5AAC, 
-0x18CBE56DA9A25, 
-0x3E3BC46CC146CE6B, 0x6E434578501EA507, 0x720DCB9C506F9E0B, 0x72ABF94414BE6308, 
-0x960058331913E899, 0x85DB8B25DBA2715A, 0x52531CC74ADE, 0xE6B97AAADC75330B, 
-0x6981EFB5D6FAF8EC, 0x57E262FFB4F88FB5, 0xBF7CB86849478DA3, 0xE7E93E17F0B7097B, 
-0x82F7AB85FB26CA9E, 0x8EC691EF319, 0x489F796F09BA8817, 0x71D9D24BDDFCCA84, 
-0xFC9BD8C23DD7A897, 0xDC5427DCB810B7A9, 0xCE7EB3A3D2EE215C, 0x95821A3245FC6E28, 
-0x9911F3EFF893, 
-0x76F41226DC8A3023, 0x7BE200A488E52102, 0x487627195F3851FA, 0x4178EA05091B286A, 
-0xC5821D7BBBC8D1AE, 0x39E8A975376BCBEE, 0xAEEB22142B4C, 0xB8E3FB4B8368EAD5, 
-0xFA2CEACDC78819FD, 0x8C7B0736A4F4235D, 0xDB39AF50D758F37, 0xEFAB2A6C37EEAAB8, 
-0x32471BF3E9437ACA, 0x1698D34A2FFC4, 0x94E779CBB06174FF, 0xA710C2D17913F265, 
-0x74CF8CEBC8216BB0, 0x873E3C89E109A2D2, 0x33CBDAD174E42AF2, 0x556B6E273C9CBED7, 
-0x4CDEF5523B5B, 
-0x59479F58397D7D49, 0x6E409F3B94C939AF, 0x8199507BE7FC16C9, 0x31D51A16516BB8DA, 
-0xCF4F30A5246D95A6, 0x6D367CB671A8DB5E, 0x19943E87FF1EF, 0x58700FE8CAC4CA63, 
-0x9DC551B810381FD, 0xDAD8CF1B6AE8A85, 0x46198234D62C5A6C, 0x58083F4F805ADAB0, 
-0x33E7758B76EB139D, 0x219BA0312203F, 0x3C42CFE6210B3F5C, 0x941A71AF0DFBD2AE, 
-0x507B75FF78D4748B, 0x69B2CBDECCB89C5A, 0x94C898B57C8B59DE, 0x98CA17DAA6DBCF26, 
-0xFB3627D437F8, 
-0xCC63B1CEDCE3A0B0, 0xCD32D70C9B3CC30, 0xD5613FFC0ADC8958, 0xD5701D8FCB0B23E8, 
-0x4224B275443B8D16, 0x9EFD16964724195E, 0xBC4AC548ACBC, 0xC4F50564AB0A898F, 
-0x1191E0E421D96F90, 0xE60159DAE586D25F, 0xA5B3DD9044641C78, 0x1439F6A2AEEF7B09, 
-0xEF77FC9113AB6B8F, 0x52D98B48B1E6, 0x9313E6BEB895D0E, 0x6AF38699D035397A, 
-0x4FBE29CCDA8B85CD, 0x6C564B1A52E8E3B5, 0xC8D117642E9549AF, 0x1BFFCC77AD0410BB, 
-0x131387CD80395, 
-0xA894DE296055FB87, 0x5DB8470A2CA41235, 0xFEF5B8443725D1B2, 0xFCA66DE405FEC730, 
-0xC4C544BFCFE70903, 0x74CE0044E253EB18, 0x18259F34D009B, 0xC3273CA14AE62F90, 
-0xE31E217F636B3E94, 0xA41C63C97C7965C8, 0xF8991686F607B1FE, 0xE37BC311F302B66C, 
-0xE2EF85D8FE6FE9DE, 0xD1664DFC3881, 0xC4D90C0F00D51B8B, 0xE59718F079173E13, 
-0x608CD12E7902DD75, 0xCCEAC254C5BEB15F, 0xAC5F815370ED6199, 0xD3295DDB1DFAE34C, 
-0x19D86F9D8651D, 
-0xFE2A6047FA56CB14, 0xD004D6A4BA6949A2, 0x24689EB3FDCAAFC6, 0xE1EF935B69FE5C5B, 
-0x6CDFF99FC1866C35, 0x212117C3E11F21E4, 0x79BCA3AB78F9, 0x82FF06210E3EDFFA, 
-0x272E07A6431EFD5E, 0xE719B1822C5E921B, 0xA906001B221DF812, 0x52E6585D606220B, 
-0xED05E3331F99E229, 0x579083AA0038, 0x367FD304A45FC4E2, 0xFA11EA91F1C6ABF5, 
-0x39E59FAA6DC66EBD, 0xCF88A0A6432AF727, 0xA62C398E372E227A, 0xAE74A8E35645BAC1, 
-0x15EEB6E65BEC4, 
-0xC634C4819A1ED8F, 0x632268FEB06EE93B, 0xBECF722F1E15D90B, 0xC951162D2DA8FB4C, 
-0xB02A1B6BE8A9AB68, 0x9C324ACCCCC8C38C, 0x1B695A42186A, 0x8E53D97D3EACBB01, 
-0x1546816422E55F82, 0xDED0DAD160D3FD5D, 0x8249B64710AD203B, 0xFCA69B2EA8E86113, 
-0x7AAD296BB1437B7D, 0x125423B1330F9, 0x7091AB1ED7539F4B, 0x28419925E4BAD20D, 
-0xE39DCE03BC0C1115, 0x49EB10415FF2C1E1, 0xD56389BA809F1E88, 0x53122F69D5CBAAE5, 
-0x2572A0410415, 
-0x94408985DF01B82D, 0xD7EDAADFA0E53F14, 0x4A245907960DB392, 0xBB226A43832CCB13, 
-0x7B277BF33DE3D23B, 0xC4AEDAA89EB73B67, 0xD21752580643, 0x84AED6258A895C6E, 
-0x36B24217E57E7491, 0x9E6F1E0A51D27F06, 0xE4F5E0643E93D39, 0x3896A837DD4BC3A9, 
-0xFA18FDAC49BBAB04, 0x34EA6AE877E5, 0xDFB4F8B82B5C4CB0, 0x545BB1A058955AFC, 
-0xD01068891A87987F, 0x79F9D88F405217D3, 0x9AB64DD5C53DFFC8, 0x940D7DB71D845B97, 
-0x199FBF16DE3A0, 
-0xD9379C3602EFA740, 0x14DB81FE5A32C517, 0x419B8B23501EBE3D, 0xA6D8EE39DA5D0125, 
-0x56107A9442B7C580, 0xEAA6A10898EE23FD, 0x22EFAC42E1589, 0x992694C146B577DE, 
-0x910F1157BBB6981, 0x637CB38160574E0C, 0x92D8EB069447957E, 0x63EA8765CB69E1C8, 
-0xDC9E59ADEAF236E7, 0x12D7DCC203D36, 0x3AABADA2FB2A69D3, 0x5EDAFF782EC99D1E, 
-0xF10BB55F7ACB3D91, 0x177BDF5BD06D132D, 0x34F24DB9ED124120, 0x54114B5129B22F2A, 
-0x49050C0B45AF, 
-0x2F5CA0C247A406A8, 0xDDE367BF0F642412, 0x58B8950278FB5185, 0x29050BF178AB4D40, 
-0xDAED76DCF5437F7E, 0x4CA8F29E78198058, 0x1063F8ED2EE7D, 0x86399023050A95F3, 
-0x1C06CD3E959204F, 0x1A417A70FF5A7888, 0x2B66036DD80951, 0xCAC6D940A116FCCF, 
-0xAF420C1858C09DAD, 0x73B6B8943D47, 0xFBF1853CF4CA38C1, 0x64076146CE220140, 
-0x7D44FD9728E266C, 0xE1D1C30AAE15B92C, 0x2C65251123C21040, 0xE84884BB24035B65, 
-0x185D07ABC9FC7, 
-0x2CF9C3DD57549E80, 0xFF75C7C5C8411D8A, 0x5AC86B4329AA1E30, 0xD4A1454728E83789, 
-0x88F9A8848737DB2D, 0xEE329A298C8E04A1, 0x1DFC97FF288BE, 0xC44DD075B441C425, 
-0x64B249A6E8D7A3A, 0xE5E67E0D973363DE, 0x6E7E9B098493454D, 0x5B0C18272FEA045B, 
-0x463CC69FF3B34692, 0x1993BD0E6A84B, 0xD82AB92BDFDEE8F1, 0x6BE4121F868511E8, 
-0x9FCBFD369DBD1FB0, 0xF4E3CE88DBBC3646, 0xA53FC3CD2515EEAD, 0x611EE870BCBA5C35, 
-0x1CDC2390317B, 
-0xD4A38D9831C8757D, 0x17181235735820DA, 0xCD59E34A61783856, 0xDCB8A1A8584EB55F, 
-0x156CAFBA65D8FFC, 0x4D8CC567AA9D3DE6, 0x64B26D614845, 0xBFEBB868B8908A57, 
-0x5237682F9B452750, 0x59CCF79AF996FB66, 0xC05F593FFBF60426, 0xC182D64E091F751, 
-0xEB0EEF94889460C9, 0x1B5E585AFAA16, 0xFFF263E252B6E6F7, 0x6215F00F1EF47715, 
-0x85124C7B65F1FED, 0x90F179181E54CF0D, 0x5BD793B9654C55A4, 0xEA53F96F9A483B6C, 
-0x10602D666D5AA, 
-0x4E5E5DE514C96F13, 0x2AC2C798BBF7B098, 0x976EE2F3D5641BC4, 0x74576C261CEA95, 
-0x871FDC0176077F2D, 0x2BEA33718ADB38B8, 0x207B71701C5BC, 0x50D3ADC2CCB580A4, 
-0xAB07618076260833, 0x18126A46026F52B0, 0x74FA761F2E4CCD0B, 0x4567554AC3F5659A, 
-0xAD891EDE812893AB, 0x193060A996EDB, 0x764D68EC155F7730, 0xB7F19DB9A5ACF80C, 
-0x677FAFC16F572F8A, 0xCCE364F015C2E6C8, 0x3B6AF86FA7CD3340, 0x2BC1F998297666CA, 
-0x200C6C4126A35, 
-0x15C85, 0x0, 0x0, 0x2D6E659411000000, 0xC3E9279CF8657DA, 0x4E9A9D269CA0A2D0, 
-0x92ACD020194C, 0x898E8F7686F2F4E6, 0xE21377ADF1509405, 0x2C278C05C90D38F8, 
-0x9E033CFCCF292CB5, 0xEB1C3830C73809D3, 0x64DE17327298FF7B, 0x1E05DC4B6D8CC, 
-0xC4CFCE6E8DD591D4, 0x48AF4FEACAA71C92, 0x6B4756EE0C56E2CB, 0xEE12A8E041F3BDE0, 
-0x67C6B65234E8CA53, 0x61A3D36CDB18D779, 0x819B29E8027E, 
-0xE858, 0x0, 0x0, 0x721FE809F8000000, 0xB00349F6AB3F59A9, 0xD264A8A8BEEE8219, 
-0x1D9DD4F7A5DB5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x898E8F7686F2F4E6, 
-0xE21377ADF1509405, 0x2C278C05C90D38F8, 0x9E033CFCCF292CB5, 0xEB1C3830C73809D3, 
-0x64DE17327298FF7B, 0x1E05DC4B6D8CC
-};
-
@@ -1,49 +0,0 @@
-/********************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: precomputed tables for Pohlig-Hellman when using compression
-*********************************************************************************************/ 
-
-#if defined(COMPRESSED_TABLES) 
-	#ifdef ELL2_TORUS
-		#if W_2 == 5
-
-			// Texp table for ell=2, W2=5, W2_1=4
-			const uint64_t ph2_Texp[((1<<(W_2_1-2))-1)*NWORDS64_FIELD] = {
-			0x1C4C7ADDD4F8363A,0xAA3D5C25E1E5C316,0x6154B05446DD4A24,0x4A252561F82EE267,0xED73ACD2395CD661,0x68FB6775625746F3,0x2C719EF645A9DA4C,0x15231A8F93CDD4,0x9FE934564C2138AD,0xEE22B57E2E7BC52D,0x6543363F9A42F7CF,0xA8D28B0FCEB28DBA,0x92D91991FDF80ED3,0xE5561938C2C3266C,0x9DA6493E6483F484,0x261E82DF3AC031,0x4E4E84A359E0E3B1,0x9E398C5073E6B1A1,0x695A55B375D037CF,0x9298C764F52BDE9F,0x2A9BCE426003E62E,0xBE590BD31FAAF004,0xFDB73F40F1BC821B,0x35AA60E4151E89
-			};
-
-
-			// Log table for ell=2, W2_1=4
-			const int ph2_Log[(1<<(W_2_1))-1] = {
-			8, 4, -4, -6, 2, -2, 6, -3, 5, 1, -7, 7, -1, -5, 3,
-			};
-
-
-			// G table for ell=2, W2=W2_1+W2_2=5
-			const uint64_t ph2_G[(1<<(W_2-2))*NWORDS64_FIELD] = {
-			0x3F9,0x0,0x0,0xB400000000000000,0x63CB1A6EA6DED2B4,0x51689D8D667EB37D,0x8ACD77C71AB24142,0x26FBAEC60F5953,0xE3B385222B07CDBF,0x55C2A3DA1E1A3CE9,0x9EAB4FABB922B5DB,0x69DADA9E07D11D98,0x76576D9C6D81FC53,0xE86D361804276C89,0x5E5BD8D0D50866F5,0x11D894367B8B7F,0x320209C584E8B171,0xF3FC302A9200EE8B,0x805A55F2EF2EDAA,0x5073A202FCFCFC38,0x8DEAE004AB73FAE1,0x8B2A4B22A853DEDE,0xFBCD5153EC4D4441,0x71BFFD90F8BEA,0x7C63468788D70186,0xBC1AA6A7B369FDE8,0xFC117A14AC9A5254,0x55529A52297C54AC,0xBE65ADAEE2439A42,0xD50DEBCA0612D404,0x1998CD7EFBD82709,0x160046766866F6,0xB4822BAD468724E4,0x770F770BA532B3C0,0xCBC2FE30104CB58F,0x9E81B6DFBBD7641A,0x8B9E2297EE93C018,0x5CA07C0B761C2CE7,0xC61EE2F0D5471C5B,0x38064049A175AF,0xA25AB6EE24D5357B,0x7C8D1073A759A8C5,0x7C4641F432125C35,0x1ABF9ADF5A48AA55,0x324BD381CE4B0D45,0xE2AA5207A7D72073,0xE8CD4FBE6D9C92DB,0x35CEDE18013B86,0xF69EBA7C02E6BE6E,0xF90540A14F3EAFB0,0x39FC1C53F17B30ED,0x408393E62BAF4AF,0xF20750584CF1E945,0x77ED03E465AE9FB3,0xED82BC4088C469CF,0x1C28E98A3772CC,0x87AA233DA352CAED,0x3A55C4864FBDC9F5,0xD9B00CCB4E4A5387,0x2F0B743A13731EFA,0xBB3F91F202E414A8,0xBCC390C9D988C102,0x2E1C99E9B1F351E9,0x1759D6661476B3
-			};
-			
-
-			// Torus tables for W_2 = 5
-			const uint64_t ph2_CT[DLEN_2*(ELL2_W >> 1)*NWORDS64_FIELD] = {
-			0x6800439AE47E03AD,0xC761BD256F241B96,0x3D06DDF142F5B969,0x744DA77A86C1C1FA,0x5F4930321EA6798F,0x7AFB4885B8F80E74,0x5753442C2D21182C,0x550C8CBE86F80,0x36B0CCADA34D1C43,0x9049E166546AFE19,0x5DE926A9146071B5,0x1B737BA4BE4AC3BE,0xF2BCF9AD8D38154E,0xB89F7947240990EA,0xBCB5D1C1CBF00207,0x2DF238F887D23F,0xD1CEA100AE6D7406,0xC9C52E944314BA51,0x60EAF6F2612CBF0,0x5F7C2AB98E6A6E4E,0xE131ED2317BBEA93,0x9D694770907D68B8,0xB98D6862AF55F39,0xE80F518E41512,0xCF23CCBDF16E3077,0xAC4DE4424C914A01,0x3EFEDFBFAC67590E,0x79A68F5A31B60F92,0xE02315FB4B456389,0x5B8F75BE1DB896C9,0x428A1895461B389E,0x1736989B95528B,0x99A1DD04CC604742,0xD2D8A1D4CF218FD2,0x9A1408A9F7D79601,0xF3B3064334627870,0xABFF802BE983E798,0x4925F54DCA18729F,0x4AE557B0A7FFAE9A,0x1342D4B94190CA,0xCFDD813BB794CC2D,0x804C6A55DCA9E8EA,0x5F9C2C0745C7488D,0xB808897722C12FFD,0xB6CC2526A5E282DC,0xE4AB920147D263E1,0x70FF4BF8791D5C3E,0x37CF83F0434128,0x9DC40D9DB321285A,0x970EC08D26A6B6FA,0x2826F52B4BD8EC1D,0xFC7B5AD41A1BB3DD,0x8D64F3768F40DBCC,0x678EF136708A4C49,0x460EEDC30D75552,0x15543FAA828AB3,0x6BE1C3E04702939,0x540AD7316E1DA2DF,0x5D861F76D70755A8,0xDC68538153B6BA44,0x77A9E45F3BE4F7CA,0x3206A8F853548B8C,0x71E1AFA1E607E31F,0x26A0A5295506C,0x171C06499AC6FD16,0xB8F126957C7812E9,0x88164774FC2802C4,0x56704E44FBCE22E8,0xA0C479FEC9CEDE4C,0x593FB1F3C832BB56,0x6227DDFD4B6693FD,0xD009E4FB83AAA,0x624F71A888631D8A,0xE3931763A1D5D7C1,0x15D56A35C53EF56D,0xE2FE3AB960CB070B,0x6AFBC77D62AF8912,0xA10689C60AA9BA79,0xF3C50F16A944D2EA,0x2450833B9F1C5D,0xDDDE9C11B3DD461F,0xBD7CD7AB3D75B806,0x7655F0166E198FD4,0x71294ED68A1D6D2A,0x99DA07F01F5B0D08,0x458012839C9C0E6E,0xADBEC28E6413A494,0x3A383AED426230,0x7E465ADD4EBA9767,0xE08850F8645E5D9A,0xEC1949259B38A4BE,0xBFE044E585F1D0BF,0x190271922BF39ED1,0x259CF4011CF44227,0x6D43243AD09667AB,0x1319C4B43914EA,0x7B178EAE53A8974,0xDF127B4FFDAF0CFB,0x15B3786C8BCAF365,0x431D96922179AFA,0xC07DF9197FFFB3F7,0x649A45C5D71A6392,0x7043F30371921F39,0xCEC84EDFC0221,0xFD4B9E196CA96AC0,0x2A1FB815130F803E,0x3F34552FE3CA8FA4,0x8754E8094DC59633,0xB377003B765810DB,0xFA47FE5E54DC4861,0x5861F1259C458CF8,0x43DC8A1E68F92,0xB25F3747929E344E,0xF6834CA6991BAE46,0x1BF93F3D81D13CBC,0x9920AEB0DD8EC87F,0x8508CAC789096129,0x7ECB9EA757AD7E11,0xBDFF8494D6685D9F,0x3F67233A428ED8,0x9488DE2599C0C260,0xF28DFC924573AA46,0xC5E55D5DEF3966F0,0xED97A407D269404B,0x6EE75EC9BCFB1D96,0xCFA3BCCFA9FA62E9,0x45F3CE09F4228071,0x19FCC0133C5874,0x7A54AFED2F705729,0xB4BA090F0CC210A9,0x7A590FCAC2987224,0x24BDE8C34BA43FDA,0x705C63E5F60373AF,0x14515292E88BD1DA,0x3D7085EFA87012F0,0x233DB9752D3026,0xFE280186728FB8FF,0x73AB63BAE75A1CBE,0x49198E67427F89B9,0x5251192BC1F68D55,0x923DF71D9E6A56DB,0x46E17ECF2D43A98E,0xBE28D44F4AB9E288,0x3061A5952A07EB,0x378582CE811951C7,0xD7EA9E5DF62BD62,0xDEA1E2DB92CB24A9,0x9D27035D4979F6EB,0x9612BDFA65FED6CE,0x9A1594832F107D59,0x4218565850FE4982,0x13D6BE76B8BFFE,0x864086E2EE8EEDA5,0x7EAECD1B57010AD5,0x5E7F91A4E33570A,0xF2BA0E12837334DD,0x8B8AB3E388834530,0x21316A0C0E3B01F6,0x9D6251E3EA71A39C,0x2627DF2C6E12F1,0xF23B1E0AC98092A6,0x7D8424AAB87EB04F,0xEAD788DABF0642B2,0xF2D89814A2617B1C,0xD117274FEDC1CEE2,0x8ECFF5C23E9366A4,0xBD9ACBED9B0F7529,0x234D1D0A6A79C1,0x21917932AD118AC0,0x246C63DA85099F4C,0x43E4ABC08EC4EF29,0x24E2DE45FC8F26D0,0x650440281BCE650F,0x512D2E866E2546F1,0x5346058EA1DBA968,0x241123E1F8CA79,0xAE3CFB319DBBA547,0x2744A194B681A63,0xE146C9344481BD0E,0x7F03ED10FD9F3639,0xEE82C34CE6DD675F,0xEA14388A24DACCCF,0xF246289B57283796,0x1FA750D9A7CD2B,0xE0F56C0CB4DCF211,0x7D049812A1A31A8C,0xEC09A9F66B6A40B5,0x544F074BD0BB2CAF,0x33163BE9820ED4B3,0x96D5C6B1109BB4A9,0x878F0902049B63DD,0x219220F242406B,0xCF87CDC2478C521B,0xA37909CEAB92478C,0x5BCE1CCB2B627098,0xEB1450B39009037D,0x592A32FD38224737,0x8E9AC84FC66C771C,0xB6269FF1C2CC941B,0x1D73F8D3A04558,0xD323B42614C90CA2,0x4DECF37CC66B38BA,0x2E3E3D1676B73A0A,0x518E7537EFF2C7C6,0x7980DDEDEF10A9A2,0xC54070D78C3B4376,0x9210C7515894A05C,0x2ABEA26F116A7B,0xDA53B74B3009F56D,0xDD92DA0F1C133B3D,0x703811FB056EFD20,0x482B870770506DAB,0x38409D6CC56AD7F2,0xC09F7675355719A2,0x17F775D54FC6450C,0x11033180051E8E,0x7F032E943BADD5BF,0x22B1FE41CE418584,0x3B3B46FEC89BC402,0xFEFA290C31A72345,0x71235918B39EF3BB,0x11C0D35FA82A3158,0xADF5A49F74873CB3,0xF5BBE35F154CE,0xDB7755B5349EB1BC,0xB7AF3EBAC1EEB9C2,0xEF0E9D541334297D,0x7E3A9AF60FA116F3,0xD579FBB07189EF07,0x894732B2D586D619,0x5B69B37E297A3B5D,0x3A562A37F4C4D8,0x9B20C199A9F8F76F,0x8FC47D40569A808,0x623A12E4F04191C2,0xF4DFC30A4DA15AFB,0x7C2E9EFD25BEBE2D,0x23B6474714F2013B,0x5DC54579386CF022,0x20F34804589B68,0x7B4B2351705E5E4C,0x488D3C15C9DCB547,0x8B2B1A47292A7E4E,0xC43B004A65692F0E,0xFB2414DEC11E9C0A,0x9F54A7D668055F6C,0x90269F466023573A,0x2B525B6D75C3F5,0xA6F3FF258CA50168,0x527A5E880D107D1D,0x91BB4D82BDC96DA1,0x1B602DF4F9F02326,0x863FAC2E96C10834,0xAC807D2E564FE59B,0x534DBCA4E59BEF1B,0x223540ACA7F316,0xB8F4F8BA660F9D7C,0x12CCF25BC9FAA8BD,0x823634044DD24B7B,0x6242C85CF5B1531,0xBEFDC53736C38D5E,0xD00EE951079D1979,0x44B6CED73ADF78B7,0x138B64174926AA,0x3B58FA1BE9815DD7,0xB1A765D37A7835AD,0x1019070A4E69F275,0xEAD050D39A1FD4ED,0xE645973F56653C4E,0xE791001FEFB01424,0x6255F5214FD0EC85,0x17590C95712CAA,0x8F3FA8E1ADE6092A,0x4B11743E45BC5069,0x19381BFE184AE4BD,0xC82C4B2A38CEF12B,0x77D464AFEC4757C5,0x2F3919702635F8D6,0xFB1A64F890FA6873,0x3CB0803927D8DB,0x5635522CAD347AF2,0x40DC99C5ED80E54E,0xF657A9A0741488B4,0x158F64A9F00F5C23,0xED25EEAF7B9C4A42,0xF69FF83B4B465E82,0x9D661F512A925BC2,0x305C999903EBB6,0x2B35B24D55983E59,0x21FAC3095AA655D2,0xE6F8BDDBEDFBD0B9,0x1B5430D08FF63CF1,0xD9522F483B9B0630,0xEC384FF6B62E0E50,0x93B4321689DEE838,0x2C1E5B1E0C3622,0xD4B83508B7AC1134,0x2F7C15C38F5022E5,0x2836AA76EEF0F35D,0xD7F233F52CE211AE,0x2F4137440D79DDCB,0xD3168C338DBF9117,0xB9F0ADB9501AB361,0x5AF896A65A5B3,0xF4A995664CF02457,0xE06FD0F71922CC96,0x171FC6F41EC0CFCE,0x45528F5F89FA0718,0x5ACF83B22F9F5B3C,0x3D923FF43E644C27,0x64384EC7E313837B,0x3AAAAC0C2EC8EB,0x471B00F6731AEA91,0xC6B4D3D92D157E71,0x25339AF7C87C865,0x71B9131575B97B6,0x30AE06AE5D888B0,0x900F06263C08C87C,0xAA30F4689C2517F2,0x31A4218E5FC02C,0x4DF1D5B9B486781,0x31665E71750873F8,0xC1FF1BC6B72F1565,0x4C402CD674F3D834,0x33F76DDBCB29C989,0x7C3595B00E96BF00,0xC31459FAA61B142C,0xC5EEB659B086B,0x1AE2FF5F5A8F69B7,0x9A95AFF19A862BEF,0xB3D3816A7DAE7E0C,0x618C880D0B76819D,0xDA9D41C22056A730,0x3B948C4A39BF5FE0,0xAAAD534C0BB88C21,0x1CF6052F07C2A2,0x53BA4A40F8620C8,0x79BCC012790C2CCB,0x1FE602B6AEA6DE2B,0xA983D364FBC1511A,0x2A141564496947,0x91E630AC6A693F85,0x84F101AA2DBBC1ED,0x1E12F77D8A3638,0x85AA6D1EE352B9A6,0x72515D7A4A17A579,0xFE37D6E592F60D9,0xECE56A0B972AAC28,0xD8278958B53DCA45,0xAA0DBC371C0DE62F,0xB559EE804A54AB31,0x73461E7E984BB,0x540B95C0A66032BE,0xE649A496C46E8315,0x8AB169D483116BC6,0x57459FE4416A782A,0x6A66852EDF2D9689,0x3C3E8CA3B20D9168,0x3706629EB3CC221D,0xBB2BF98E604AD,0x4BC2290B66C634C7,0xE9B48926F18B519C,0xCEAF739DC2C0A604,0x7941833EE3EBBCDC,0x23A9A6AC3022736,0x7D497FA9F1E03BD7,0x40ADBEFDD3CEB0DE,0x1B6EC19F3B5F2D,0xEEFCAB45D105C000,0x126FE17CBF68678D,0x6CC548308B432054,0xF2AE1FDA8F1CA71D,0xBA00D28047CB4C59,0x3235B7D6BA3A5A6A,0xD037EC9EEBDA4513,0x3F70A5D38E9CBD,0x77EB1DD8486EDF46,0xC4FFB62AE7657629,0x4385F8563AA9388D,0x517E16E6E86C6550,0x763FF024F91399E5,0xF661812D2A26B9FD,0x7D79F569E0578C47,0x16E8BEC2436E14,0x90D018A6E59D5CA1,0x9CE4E9FCD9A8AE5C,0xDAF5B4A4D4511596,0xD46EB3FF11054F3B,0x81799B585FFDCFA1,0x66594E0D93D55E9C,0x7E32B295AF5E4ECF,0x23A6AB0D2699BB,0xB64D7296E73D8DD8,0x3B96743691795D7,0xE2D521999140C311,0xB8038DD2C4B33659,0x61ACF6027E924087,0xC323C230A1599AB5,0xF133E977BD31FB61,0x1F2C6DFAC166BA,0x4272974269C62607,0xB5227B14C25C0DC8,0xFB8805050BCBF8A,0xCCDCC05433BFA8B2,0x81DC8897B7FB316F,0x1F035F6D09FEBF7E,0x29DE92F41C70DAD2,0x1F0D9526BA98F2,0x9F7C7F26318D8C0E,0x76A3C6C462B8D627,0xC840C65ED04E4C2C,0x677DCC9ABD4AE1B5,0x9DB1792939D2079D,0x430FA4FA175EBD5C,0x2C6497E239526135,0x169B86358C6EAF,0x89B545AA91FD804,0x60D3291E32DC2A49,0x811A98779D579184,0x755EEF1D506F84E7,0x341F47A2CE0FA986,0x586090340D17F5EA,0xFA180B9053444AD3,0x31D8D3492B9122,0x4E694C006D2CA3AC,0x4BE1E0E78DF8D8D0,0x9214FE52A28A03A3,0xBAF66E16D107DB2C,0xCED60A75BC197C2E,0xBE76BD7F87A55658,0x8938E04A91663A03,0xA5458817EBAC5,0xA3D3BB2DD30C8708,0xD32A171AA7E02BE,0x5F0AA6EACE643001,0x3A09258DC308B35E,0xC74C574B2328AD6B,0xB9AB761D3ECF5FE8,0x2C1D098ADFDAB24B,0x207A562514B54D,0x10DE91FD0F69CD7A,0x74B9E3373E53F1D8,0x50D87DCABF251C21,0xB52CC7DC994D7119,0x23692B38EA4CAE41,0x387A4740E515037D,0xB06FD21892D0E519,0xA66CCF2850A80,0x6809C8C5B9D96FD4,0x36C6B667930E86DC,0x6F5544C8FB78654D,0xD3C4963263FB6DEC,0xC6A7D7712E3F5ED8,0x1B58247C8F502AA5,0xA6583DB41215555C,0x2BBEA8BA18E8F1,0x9A7EABAAF9F83246,0x8B218AE55B071191,0x4AE9375F8664D0D9,0xA1582BF0011E61E4,0xEE3ED0BCF40E26D9,0x2E31097623F4E36D,0xCD05202141F3E6A5,0x2B32C67819FDDF,0x1FED03F37B5CE3B,0x5DAD413A7B0584,0x702477469044DA96,0xE54686C7EE86D436,0x2ADE623097C58394,0xB8D2379487796B03,0x40B8C0DD1457292B,0x39E27D175D09F0,0x2047AD2A282CBD32,0x199F8799396811AD,0x37CFE835EFC453AC,0xD40F4B16C41C974D,0x711567DFA9EB9D9,0xE8D805150D923DA9,0x5F7091BCF4C9F560,0x183EFB409D0EC1,0xA1DCEB332F8D738F,0xC748363F37722342,0x61570E3525AF38AB,0x60AD5E301F1B3238,0x3F11EBFD1B7F2AFB,0x9075E4193A4D216,0x8061899EF0D53435,0x1DB2EC5E25B684,0x3708E4EA569BA67E,0xE5F62E9AD97B0905,0x8EA6B388DDD63189,0xE1001EFC5848B963,0xC9649AC836CFAAF9,0x307E71B9B4E8F15F,0x1B331534AE61EE0E,0x3CAE27D7312D5,0x4E46CDD1BB5978A5,0xCF95318626E6CDA1,0xDDE34AC1D2BC82C8,0xA6D9AFFB21151248,0x6512D6D625E6646E,0xB739436DB4BE9479,0x2F6E84B5F493A3A6,0x1EE86C56094222,0x64114E85957C041B,0x9280D0D2BBC3A962,0x53668F60D3F2667A,0x9740035DF90ED6CD,0xD28FA28CCDD8EC4D,0xE0A08A796F1EB25D,0xA137B8B6C4AB63E6,0x1CD9FA4C3950AD,0xF6FAA6A138ACF2FF,0xDC9B2DF341E51DEE,0x35436BEFD5BD674C,0x5CCDA5036171B484,0x88442F815AF05376,0x236A467510D9F32C,0x8D72D019C3424596,0x15BE6BEC211871,0x1810D0C8E0743B5,0xB6D0512475CE0F73,0xA50A8CF763B1E0C1,0x3BC5AD5BCF7285FA,0xF1C73BDC2EED05FE,0xFF4B9BE922C3B8D4,0x8FAEBE402E36CDD6,0x18DC87BFEAA206,0x9B7BCFF40320C782,0xFB8B49766AC61503,0x45642D5BD73A7A63,0xE4270F0AD42CDEFE,0xDD9517B32581D059,0xD93F1E409FCC7700,0x2B253FA7EB51D1C6,0x64819478C30D0,0x2B73979B60584524,0x8901A5457A84A69B,0x839E979B3BFFD58,0x6346B646CAC915A2,0xC5A16E89EDE1113E,0x2774171C4953E750,0x407D5B5A2CB144F9,0x1178DB62105E57,0xB22AE3C80D32B5A5,0xB5C92B6277655506,0xEA47456DA869DC7C,0xB529B2FE29EAD80C,0xD0E6900C6E33C9AF,0x6D65FDACD1525855,0x63E475B2E2006CF1,0x136C4E9F91D5F7,0xAC9AA42CC6C6B27B,0xE13348A57DE01910,0xB11C85CE3F468C09,0x1190FCF5A728D6B,0xD4B80617706108DA,0x2DF3BEF004E7B5B7,0x488734DB612F9641,0xF691518E1B632,0x177D7AE1C5CA70C9,0x90FBD8A0B187B605,0x15451B3A601EB140,0xF2C3EE0E4DD9A8F8,0x6AAA62A4C1AF940D,0xB85F80C83031A70B,0x607714EAE1D0E2E0,0x1AAD6D9FA02267,0xEB6819D24AC0DDCA,0xB182CEBDCE34BB79,0xA5DBB6F5935A319F,0xA4481367E02B7FC0,0xFE88E83958F9AF01,0x4D1420B8743F75B4,0xB3A83544D53DF196,0x21FF03FBDDD71B,0xEE847A171A9EF903,0xB67995565BE75E4F,0x16AC528D6D3DCAC1,0xADA638A05DCF0B1E,0x994C593626B2CDAA,0xA41ADF5FD3FACE36,0xBCBA1B907A8012F7,0x29D28D702953A,0xC48A51B6E05C3B34,0x39AC3EA6FA665856,0x8248C3430F72A3BF,0x2D6AE78A1227DB80,0x665BCD58BC47885F,0x7FEC05F757952DC6,0x96A513D1F02446E7,0x175287B0907D66,0xBEFE9C43973695EE,0x878F88FC1C0D689E,0xC0C2AF7D91599E10,0x95F7B4748F41C8BC,0x1C2DEFF63018FF3A,0x5496E92FC7E00600,0xAD5018F0B94DA4E1,0x3E2EAA408E4FDE,0xC34F1A7E4F1AF6A5,0x5909C15A1847311F,0x24C8CC0D571AE854,0x48406A6A00DD01CB,0x917AE20EDB1BE4F3,0xA5F676C8764D65F7,0x91EF24349F29D2F,0x2F21F0984ADBEA,0x8D46460029B5C8F2,0xD17CF0551070205B,0xBD3F9693B3C3C392,0x2B7CCE828DC86EDC,0x36C128BF00F9CF4F,0x1075DF193CD770D5,0x77E234E5F0E35805,0x70413A64F16DB,0x82473FE5748C13D2,0x3E9B867FF768B4EA,0x1C1DBE0CCBCAD1A2,0xA2D9EBED4B45E1B4,0xD3C1DE4A46E85744,0x6EC8D4ABB293E594,0xC4847D5397D0322D,0x4058AEB79E136E,0xAB900C32E3807C43,0xCF29CDD8E3E09EF0,0x418832E70FF43E51,0xE29196DABCF6B643,0x91EE6638D96422C,0x25042FB081C14DBC,0xCCC98FE25BD91036,0xEE2D00610F017,0xFBD35A9AEADF348D,0x676ED0912DD8197A,0xC7429D7FA938D330,0xAD3F60507183B290,0xE7CF4210754F41FA,0x6E9FAFCE620C670B,0x939D6BD5C162A903,0x18BCF2D9E6C6A7,0x69564B857A6A6B72,0x2B5DDE2CFDF9EBF8,0xA9E0E2D52701232B,0x783AE961DC06D71D,0x5F2D0120129495F,0x6DAF27236499C4F5,0xC3FD560D7A1E4CB9,0x3AA777194B437E,0x7E1633E22DE34670,0x738E8FB8DCB40B3D,0xBBFE829EA84CFF96,0x8E87436991C5D9D5,0x8666BEE3B487AA65,0x148013826DEE5244,0xEA6C2FE8F111D6AE,0x1C9F612947ABFC,0xD47E7172C0BFFF15,0xD4BE86A8ECF41F77,0xE4F60EB56118EC2F,0x7C24A909F38AB25D,0xC663C6CCF642D3A6,0x1EB55BD046DDEB25,0x27721B14B4CEF722,0x15B2756EA18DB0,0x8A04F7F42F4BB91C,0xA325F564F36FB557,0xD4C232D7D2BD18D1,0x7493BB5BF425BB8A,0x20B0D39FA8441C02,0xD6B6E78C5811FAC3,0x5F2D934459469F53,0x3B972E52584883,0x978B577C8BF83926,0x39305DEEA3044945,0x257847B7D1950683,0x3A7A3566D5A56A58,0xB70A8DA87D867D6C,0xB8695524E01BE3EF,0xCBA5147D3309A6BF,0x1BF777CE256DC3,0x82A0ADDED89BC3D,0x9DDB2B08496E9AA7,0xD3CFF0B0B2DBC993,0x156BC4DA59E07003,0x2E7DD47D0527E0F7,0xE9D73E0E6DF1DFB1,0x2F4A0AFB6C5E25B0,0x13C2890FC50BFC,0xEEFB455776D868D2,0xE2D06D73DBAC7E59,0x1E54152BE96C30BD,0xF4F819B813BF43F2,0x41A0A630140D949C,0x3209E7A25B70444A,0x82230F4F6D723828,0x24E4A645FA315E,0x445F32C4F60C8AFB,0x63B836CAC4A7830F,0x2856E41A4EED816A,0x65457BF34FC123E0,0x3D34A83987114F88,0xF3E0FB7C948C23CC,0xE7CDB1FD60E82B83,0x2EE33A53C68272,0x10B87779EA9A6B92,0x228B5270DD0BF4E,0xCA773B993FC64750,0xA4CA9A87BF767D41,0xE8278A420E085443,0x3859DC979B1A87DE,0x613BD465436723E7,0x3E25EED1873E66,0x6C2446D3CEB6BE1B,0x600FD38260592A95,0x66C3136D22FFFA2A,0x69FA4C9E1D490457,0xD3B97FB57275AF29,0x6F03B06E7F5552DB,0x22B93AC8A82F8944,0x1E80B477980B9E,0x11FB87B9BBFE1429,0xE45EE2CCFB29C1E,0xC6FC0A61F4727C5E,0x16EA38C708C4BAAA,0x2E1CAE5E7E90F1AF,0x57838A3E63E7DCE9,0x6FE5EACC77E1EE3B,0x2C304713DE4823,0x56DBFFA321052199,0x17A4B34A555B4328,0x30D48DD392179681,0x638C43AF03F375EB,0x16FA99009FD4E746,0x20E382FDC219744C,0x7F2A909558787B18,0x3717F683677D44,0x1BE6DE4321A8535E,0x1B8A4579933B5278,0x8EE70BD4898BF14A,0xC96881F69C8F7B19,0xE1F5A2113908CC1D,0xEB306F831FE2A018,0x8962040E41FAAA71,0x463C80EB74AE2,0xC95A0FD37DF9ED8D,0x9C0EB14B5BD493C4,0x45E42E7538ADD8BA,0x2817511A418BA69D,0x8F48E50F63355681,0xAD2DE38082EB383D,0xC1B4EC3BD3C6B4D9,0x111DD87CE5E688,0x4E49125F62B9401A,0x94651ABD57CFD4C8,0x7C9BF9D5908608D8,0x55DD87B107F53AE9,0xB9D5BD83D2B63796,0x64BB1D4FD5623865,0xBD849AA1FF755119,0x2091AF3AA615C5,0x65057C71D79AC95,0xBF077960D9B172DB,0x61A944222CFC0711,0xFFDFABEDFA65E97E,0x4733C66CDA7A9ACD,0x4A4DAB97CA158227,0x7BDD73FE27B7ACF3,0x2DA8FBE336538F,0x96833509E653ED91,0x5486D90A57928D79,0x8611F8A64282F0A,0xE374CA77071233C,0xD3912DA2D8934805,0x145885162F447FA3,0x993089170FE1B32E,0xEDBB9CB35DA67,0xF4B9BBA147B501D1,0x915792790255A4A0,0xDBCD2E8BC3BAD816,0xE353E4B280AD527C,0x320060B532C232D6,0xD22F76AA4DF68214,0x5556CC129CA972E0,0x121A76D503208A,0xBFAA86DE76A54C88,0x3291FE2444B2A002,0x6399C42DCF75902F,0xB718DF07E3FE109,0x55F291A6779ADAFC,0x3FE77BA1D56BB732,0xDCE435171BB3FBBA,0x19C99D632DDFBA,0xA238FB4569F3C3E8,0xF18EC1F4A5C35A5D,0xBCC3A8BA366C553B,0x64A303A119E54CE0,0xA20281BA96022B46,0xCB939D83B0DDE4EB,0x3FA96CA39EFEC16D,0x9E23BA7111277,0x571AB7E1E2A929CC,0x82976D3632508B9B,0x84DE7F1F5BF0C40A,0xFE6799A91E99E1D7,0xF355B93F63054A73,0xB3095243A3EF9D85,0x5F148FC4D1E9D975,0x1C601D50D2135E,0xE492FAA6816A6F16,0x7AC24C2440501C4F,0x868D14727EEA9538,0xEF4F6CD2699A17B,0xEF520F47D034CCD0,0xE6DE2507ACEF57F1,0x195FD6BC31D9D471,0x2DD5FAD5E60DEB,0x9D2C166AC1A70B82,0x875DC34B62AFF26A,0x5B7FC82D7202CD30,0x1D2B50A0E15492E7,0x4B295984AE6A8144,0xB69D152049787CC6,0x288CBB80BE75318E,0x3421E91CEB61F1,0x8C337818DAC5A4D6,0xEF829A3E9C2D7644,0xE5C5A1AB2D21B7E,0x4BF30B7941A84013,0x5CD21BA172115A0,0x7459F9B663B1232D,0x2884E3D55A063D4B,0x1A10E73217376A,0x791B531E836A890F,0xBB53489C1F331DFF,0xDFD3AFF83DE62DE6,0xF79571A8BD005CEE,0x630C8B44FABCF326,0x713C6A568A56E2DB,0x2C5D067D92D0669D,0x21FFFF3CDB5D71,0x774C56D4CCC9FC0F,0x809FFBDF4B81C1BC,0x1EA524441D529061,0x7739CC57CEC619BA,0xFF9752CE01CA70C0,0x8842D305FA45AF7E,0xF7517D176845C797,0x20F0B5F5DB9ADA,0xBE749AF2D5C8B8C5,0x28B8578118DAE6BF,0x4E5132AA3FB79417,0x9E578E03C34D039,0x5F81122950BCDF2D,0x2CAF112100546772,0xF6407A185C21F2C2,0x1048103AC3D108,0xA693237BF191611A,0x9365EE10FF3958D2,0x497E8CE1DCD20F83,0xA67E4574A68336DD,0x37137EC734BD030,0x77F08F3D772D580F,0xFDB5C5A40A48C21C,0x2CD0FD70ED3196,0xB8C5C4C48058BC6B,0xFE89F912E4D8E07E,0x79B37D27176F8BA5,0xE56FA7BD7800208A,0x9CEDA5967A5A458A,0x7BA452F1C15A72B7,0x43696BBD48F53A6B,0x29B634ACA60C23,0x4308A5F73CBBAB94,0x613151BADD09601C,0xCC8EC83F5093EA51,0x296EB084CDFAA081,0x8056323370802661,0xED5A99E3181EBB2B,0x811CA71C9DDA90B9,0xCDD6C53071C66,0x965DC236FD55B413,0x99B09AE9117FC5DE,0x9C36B24C0BADCC08,0x96CB7E0428F0297C,0x1FA77FF05743D3AE,0xADF25220228A0287,0xDBF99565C67DAEEB,0x19A8812E280E80,0x3E113535D3455791,0x20936A01E33E24B,0x34A746355894974A,0xCC0381A4F0D3AD62,0x63DFE13278135985,0xFAA06C733137DF84,0x7C14DB07D8FB43FF,0x3878B171FBFFB,0x798AD3BD5FD50167,0x8F009D154CDECB7,0x3A771627600C5D58,0xC3549E637A19A417,0xE54F49A77939276D,0xD8EDFCE4DCBE2604,0x290BE7CD4F6C3F62,0x3368D7B07EFD7F,0x3A2E51B4864E6BB4,0xA3C4A46A5AE9A54C,0x920306E6703F84FD,0xB3A4397B3D3BB73,0xD95B7F28ADF820FE,0x6FE86ED295EA0DE8,0xC82BF5177342181,0xE5AF9CA7C47DC,0x77F6A186A17E7AE2,0x3D5DE620B409F10,0xF2A7042EA5767C74,0x5E0506F238906679,0xF5DC925162A6B653,0x1D338B55FCE29317,0x181E43222382EDF1,0x222BF1A003260,0x4A16F45861B5C30,0xFEAC9C0BF4C81838,0xFB4892D4740C2AC1,0x612F00B39E0DE0AF,0xFE7839F055923A5E,0xE94192B702F2AD18,0x2E91863CAEC47BD0,0x21508237AF3981,0x1164F6A41291B520,0x9105A8DDEB2DF039,0x7BCBEFD66E964475,0x6699D569F4E3DF37,0xF1638B18A84A537A,0xFADBF8F92BC2C259,0x77646A725AE9DE99,0x3468D073F6EC5F,0x7F30C76B7657507D,0x54EC30E36BF01DAA,0x4D4F4EF92E7EAAA4,0x67EBEA63324F091,0x9EC1443087C38F4E,0xED1773FABDED6800,0xCC6E806E8DCCA2B8,0x37F05BEFFF0804,0xC6001E5B8DECA138,0x45F23294ECD45E85,0x229E93DE992E43F9,0x1887B6777C22629A,0x75035976AEA472A2,0x17D97E467E1DAD0C,0x981458C736A6CDDF,0x2AC5F69482D5AB,0x5599772955C9563D,0x76FB3188F6BBBB16,0xE657E6C1EB7E0240,0x5F8E511FB965F22,0xA88AC60F48096B47,0x493F131BF266336C,0x9C4CE04B0162C643,0x183601C694A962,0x1604F2AA3B3B248B,0x7FBCA13BBCEA1E8F,0x80554E5C3CB8F555,0xA0EED95D0B91C020,0x869498B4969E9317,0xCB18EE955D458875,0xB329C48820B2952B,0xE532DF70A4237,0x3BD61BC7699AE9E6,0xD558342F60E4F0D2,0x89EF50FE1C28423E,0xEBECE5662C11A695,0x3988BB5D5B738C33,0x9A7823FC1BD9B5C2,0x892577C23CA5B563,0x3FADF72DA2D9D4,0x9D8B0ACFF7A50934,0x3BE11E965B5C439C,0xD9057112D1DE79,0xD3E45EA6657EF3B5,0xE28380F7659467A4,0xABED7F836725268B,0x94F8468A9D1CD87B,0x168EAC3CEAC625,0x81405F50FE9DE24E,0x190F52A9F28058BE,0xE086C5B1F25C2BDC,0x573FDB4C3362F7B6,0xAD053BEA6BC5EA1F,0x69F518B07D7FA44C,0xC9A0C74A38BCBF54,0x26DE204F57C7C7,0x7FF5E53C739DD97C,0x4537A9041D6F204A,0x5829817F05F10BC0,0x4A5E27E5D51F70D3,0xAC84BFF67E53E8F6,0xE3AA7626A17E6DC6,0x7CF97B492E4100A0,0x2B65591D8D1C8,0xE3F6EBF94D27691,0xD6992BB89F542509,0x904CEB48E690F25,0x2A4E3E180A7CD4C9,0x4C96C544EAFD3340,0x520CBA5D59E0072C,0xCDE02DD0D0826649,0x116EBFF5CEC77D,0x37B56BCB8F2062A2,0xC7B9F750B9899834,0xE29E8D801D767179,0xDD71D577B05D7C79,0x4AFC64F0B497FF82,0x7A9B5575D579D86B,0x822FFD40C3E9F26D,0x1ECDA7A6EE0C29,0xC474CEED53413B7D,0xED2CF7D2104A70F2,0xCBACA49F1E8C0A72,0x5B2A1C511CBE9238,0x22B8FA790D6D0D02,0xEB5B3AA9ABB5FD3D,0x89FDF30C685A7FC8,0x3DCBD162AE102C,0x99D2EA6F2A328431,0xF303B1E45DCCEB6A,0xE034D7354D1845C7,0x5E220A6A9AF11EE0,0xB0528E7CB2574829,0xB15E1693BE13D997,0xCE60322BC7463B93,0x8B4FB9C80DEAF,0x9BE2E300CE6F69A5,0xEEFE2EDE0E5E618,0x1ACB040DF0C97A6A,0xB20B3034A7569112,0xA13436B22D10D353,0x9B2A3E9E3D429FB4,0x574BD574E07F3644,0x358FCE70D0DF8E,0x550B38C3F3AF8C78,0x6CB563544A309CB6,0x12704B878F9BA318,0x2DD608605924AA2A,0x7B4BD25AEFACED7D,0xD820D8B408D73B9,0xB10124D998D22B1E,0x3E37434337BBAB,0x796EE85931ABA9E9,0xF4A751AA815F3B58,0xBB00E84EBDDC6052,0xC9EF442C23671F28,0x94FCA9FD9C22AE95,0xD2C28BD6C2937506,0x13622663A9392112,0x2CEAD87CD0A194,0x44521306FC23BAAC,0xAA6460CFD3B18C8C,0x6D008CE1FE0EC430,0x7D662754D8EF7E97,0xA07E688DFAD06B5A,0xEEE49806AD93DD83,0x3E0F1D7DFA04EB10,0x3AE81D87109A80,0x324AE11A63D05BE3,0x2E927F71DD5A6E19,0x5BD07B2F64D2A28B,0xB6C8EC2212D44AED,0x477D72B2AD13907,0xEE909288DFCE56AD,0x257565E84AC1E144,0x28A738DA84A56D,0x9E0547F6FB269FD6,0x24487D3BB1DA35EA,0x81974AC60C3A9E2F,0xC80AF411195559D1,0xFFD30F53FF4B29A6,0x3DC5B790C43D85CA,0xF502BC4E4F3D95BB,0xD80DE7F5269B5,0x274BEE52CC50A944,0x4489EE09F7DA16A9,0x729EFFC5007AEAC9,0xCC2E29C84D2F4CA7,0x505466CC8202D96F,0x51CCEE8B20781916,0x2FD74DE1169CBAE0,0x71BB0AB0B72EB,0xF17D981652BAD7C3,0x84EB26CBC581AE72,0x5D6CB105086A3740,0xA50B6271357E33C1,0x51242B1543551A5C,0xBC9B5FF5046764FE,0x42E34F3DFB52B32,0x18E0D5221974A4,0x1B86FDB712E195C3,0xF8FBFF1D52C4B685,0x3F45AFF2B4643EE9,0xE6B922D531AA1927,0x1BBD27E4962443A9,0x42C137C73F2AFFC8,0x675B10DCC5618EDF,0x2DE6C0AC207419,0xA277DF716C63A727,0xA35B51B24CCD1F3A,0xBD45B3A5A2FE43F,0x829CE5FB2B9D1097,0x5BD0635576617064,0x9A3596CED4C47848,0x9BE7C127686A4D77,0x230DDB849BDE5E,0xCBA946A3F476FFD9,0x6774BD57F947A905,0xB7B762617C725A16,0x3B05658557EE09AC,0xB0BC375724FACCA5,0x4D167759632770E0,0x2EB8317A24FAFC5A,0x1D6006B8EA6298,0xB9AEC54813231DA5,0x14D82E8278A1824D,0x27E75AAC49AD8A67,0x35385204AAA8F59F,0x7145EAF478CA233B,0x6560E4B6F2F103FD,0x4C05C8C62C8C1683,0x333E5AD29EBD4C,0x8912C3960886D9D4,0xF3B234E8CAFC7813,0x55C6E94BB92F3882,0xE64E19CD5D8C2D9F,0xA1293542000D7BDD,0x3337E5D5CCD61F96,0xC026C6EC9DC93D0E,0x11E2B0F0BE6BF7,0x91DC1975419733BD,0x346000C4A6D413D,0x1CF37F73D349F55A,0xE98643B34C068BC4,0x1DCF933CA65638,0x9CE63444B5DFA324,0x23DE936C4A989A77,0x1B57C87CC29A0B,0x4A8D2852E5D202E6,0xD0C0E4596861D696,0xC075036E02F09C38,0x4C586330EE1799A,0x682BD036F9C148A6,0xC85526BEE03FA95B,0x5BFB190CD5D060C7,0x23A11225FEC8F,0x7A090E4BFE7153DB,0xE78098367CACC662,0x19EDF4203C411A13,0x65A62152A7E381F0,0xFB96F9E6B64C3FDB,0xB65E63EB6C03B6CB,0xA713686287B165EE,0x88A7C1543AB06,0x9DF17BE58B65090C,0x815FC2556213902,0x4637CAE40B527239,0x8584CA5B84577EBC,0x54CA131877783056,0x2A6540A8B41EC417,0x9E0C1568DB4D6912,0x3F3757D9168C57,0x282DF927BD220ABE,0xA548BCA287F984F6,0xA39886D3FB94DDC4,0xA2A388A305BE0B9,0xFBC42F2C8C3D7777,0xF989454A187AEAD4,0x46C50ED635A978D1,0x4013A6930C555B,0x94489778A612E048,0xCBE7DCBF467B5A8A,0x8DD8790F7C988EFA,0x56DED634B96F6FD8,0xE321D7AE4A24C978,0x2B9BDD43896FCD64,0x5592DEA295C36930,0x39B1C80AC1DF4C,0x7E1B7228458A1BDA,0x26C603FD1C7D3B64,0x395A71EE945D0FEA,0xD94E975CCB24890E,0xC99E9518F53E26C6,0xA1875B2CE9DBF738,0x36B10503CE159109,0x1CCCFF54887E52,0x5532B18EB0B7A1A,0xB7FA1A221F797795,0x88F7EB8A95861CD2,0x6908B287588D7687,0xD1C4B003BFD7800D,0xFD668DC1C9D1FA96,0x79C51C1F39C153E7,0x2B503236342EF0,0x8A86C270C9314DA5,0x240DF7B8F8EB97A8,0xAD15920B7A343C59,0x3667E5F4548A9633,0x3D02205D16241E68,0xDBC5F2D31BD38470,0x2A28B3A6F6CD5D02,0x3F3A6A29B677D7,0x29804CB5394E7666,0x3729221B6FEAF3B0,0x21840F99AA2CCE63,0x6F24912ADC305A97,0x7D62896C8FB696D9,0xE41A3FD7AFDF6216,0x1BA55D0C7D61455B,0x37A49AC9D05D1C,0xD0D79EF204F3E593,0xEC16B19E2B502B7D,0xC87FEF9B8FDB4760,0xBF2F75665CC533C8,0xD9FF4E98E9F71E19,0xC094DD1F6B12B94,0x80A25EEA45851AB,0x1E960F38D96D02,0x2A6F9EC8DD1F4ECD,0x8EA37C57721977A7,0x2DA4DE39913C52F5,0xFC3B638D27B8C7B8,0x33E6D3E2D86AD334,0xDC4070EF77FA00A3,0x9B968756D70DFA78,0x4EDFBA3865A67,0xF043970C41490EC5,0x8CF416E868829727,0x1DBE64DEE95202F,0xD30F94B13827DE9D,0xA857C1D84640C270,0xBB11E7D9EE3F9663,0x5D5579BA27C4E3F1,0x3A8653EDC2EA5A,0xA1F49C09A6289224,0xAB1E26E02BCCCCE6,0xE276C0CFC9B947A9,0xBF273B4160B13E65,0xB2FA721A73A7BEF3,0x86E25837FF491E78,0xF5F6075E6F183B2B,0x2CFA11EE6D5F95,0x556951791FB2C6B1,0x166B20162EB8C7FF,0x979B9B9F768DDBD4,0x98F99C59CED69E13,0xEE235DEC425C8753,0x4FC828CE5688BEC6,0xCA65535ABD988E2B,0x7F8BE0874D922,0xCD87488BCA2BD8F,0x7CE8C56E0798CB96,0x93FE73637675D0EB,0x52968AF38509DFBA,0xEC2E53AAFF4EFD9,0x705776E4ED852671,0x839BE8CDD23A9C01,0x218846363BF42B,0xC3EE9FB3BC9F6A85,0x56A16168B28E04B9,0xA6BD1F4E2FC5F4D1,0x1E2B5356DBC77920,0x138B44F7CB98DF66,0x75C14707D8DF4B1,0x15392C380C3556A1,0x32F965B3A5E2DF,0x32A6EB9587148530,0xCEE1A3AEE27641AB,0x69587ADD4E565A5,0x97A0C42658833F27,0xB67798F8E7892540,0x16C70430876345A1,0xCF919F5816627B24,0x16F5B995901BE3,0x861D52B1F59833F1,0xE6E5C319138E0D16,0x6D94513F7C54DA94,0x42BC9A714AC1B540,0xE0C27E409DA79E96,0x409832882A8068C9,0x99D7BA1772FC3151,0x3F0B8124B3F942,0xB181BCE55123AC68,0xA9D4980D3CA87B47,0xA7BD0E02C1804407,0xB331EB6E30E33AAE,0xDEB9F5026976A5E0,0x7E7D51315D7A0BED,0xBEF20EDE80423EC1,0x22F9FF7EA021A6,0x9EF73C0F1310116C,0xFF5F4201824251FC,0xA95EDC9B50F7CDA9,0x37E616E8F2F4BCD2,0x9A98EA50E70EA8B4,0x2F7BEF51BE419A80,0x2E2EA5E7484DA74E,0x24D11C00658DB4,0xE2EF37D98732013F,0x49F4E82ACF2878CC,0xC88EBC8EBD8689C1,0x4D38C69F5A705A22,0x2F8615E169629039,0xC0F6B6CBAEFF768B,0x8B1FE328B40A7B30,0x6519244B11E88,0xBD0C46ADE328AAF9,0xA741B8831C872D82,0xC363411DEDEB90F3,0xBF66ED9044A5CF38,0x28394C43BE6F0625,0xAA3ADD39C7CA0CEA,0x6A71EDA375D43F4E,0x1BF7C12476FC3F,0xF609EE0E9A275664,0x9D008231558BBEEF,0x40387FA65AF756E5,0xFDFED23177AF33B2,0xB2FDF317B836663B,0x7BC4FA448450A153,0xFB27C2E90697F0D4,0x2CC66496B17433,0x6AF2C9C5121964DE,0xCBB6AFFA4606B0BF,0x795DCC679B7D56C1,0x389502D0A7D67ECE,0x23CDF6E21961D2C,0xADB7E8622154840D,0xD067E9AAE8BE171B,0x99565FCDD3DCE,0xB1605C6D272C7110,0x7476C69144DBC064,0x68FB45AF3B5F18B3,0x81F28AB661E140FE,0x5FD569839C9C5D1C,0x892A5440B6164DED,0xACA3CD4E506546B8,0x26E1E18DD3C55D,0x8B98F9546A453A66,0xD05FAB9417A8911F,0xB64EA9218C7869B3,0x805D0946EA86B33B,0x31CC8DC8880D138B,0xBF1AE9B33AD2E5B4,0xA37777D3D829EC3D,0x74C17C9534023,0x4239FF14E4E0802A,0x9D5E597272A197D9,0xC2BC568002F97FF1,0xE2AB739C2F29E1E5,0x50CBAB013ADF7EB0,0x10D44C5C264FC2E4,0x5B00AA4B55B0DA67,0x2D5094BA9C8507,0xEA1D2687AD4C61B7,0x328FB9A82D9A92EF,0x7C1AD952DBE37A0B,0xDFF240B146C5BBA8,0x8353F8573E4C3630,0xF9DC7A57213AAD6F,0x3BA6B633CD2EFFDB,0x247851A5E725BF,0xB0D3041819B65061,0xD453BAA6EA926D62,0x4346A52E248E06A9,0xE3C93AA7C9D02D0B,0x342972E251830D86,0x67C64920117D7D,0x50ED506975C864AE,0x160134871A61AC,0x23ECC72826F5D1F9,0x20AE26CCA3FBA7EB,0x33D895E2312776F3,0x16F18F4D9330D74,0xAE0862F468DDAD9,0x2167C4FF7350EB16,0x1386486985E5CCD7,0x3AD534F22083D4,0xF9C737FB737453D3,0xD0DDAD627A2E219D,0xF9E869B6412E2AC7,0x53B284B51E09AAE8,0x966E18DF00E3C5D5,0x7FFE96DBADCECEFF,0xA32FBE674FC7C3CE,0x309561AF221859,0x6791FEA788509AD2,0x91C8887BC6D07A33,0xA7CD06E02F0FDBB1,0xFAE298EF5B6A5458,0xF1F9CA241072C07F,0x1BD4BD794B6CF3C4,0x8ABA844D7D6AAB94,0x355921C44A18E6,0xD6C23B1FFCE146C1,0x9736F99D72656D82,0x76E041166BDAE576,0x829FB954957F5820,0x8F4559A7EA7911A4,0x673E5FA85D3F3C82,0x1C4BD457D7F47542,0xBC76195931DCD,0x61F2300E56A3171F,0x9FF3F6149D45D46B,0x23F9C257BA346CF9,0xC853F9F21C796AF4,0x1C44C4B19D20A933,0xB9A0265DEEC6BEB3,0xA0E27CA3D36DD842,0x320F0683CAD7BD,0xD1E7E86E68FF8676,0x10B4B68CC43B716B,0x9F760F8C74473DA0,0x501BB561D970D74C,0xC1697390E0E4341A,0xED8674DC725F9C7A,0x7D85B8E2019EB82,0x19C187A2185F4,0x4F9E69732A29E982,0x52190F301BF8AB79,0x7965914F3223DEB5,0x509B9F09A22167CE,0xD47D8ED3511533FD,0x1E47DE398B21BBA0,0x937E28AE3EB155B3,0x23517C4650A7AA,0x6B655BED52A9761A,0x897A3F75864B8F89,0x643E5D2F3BE199B8,0xE3FDD935F4552B9D,0xEE63E59F3247FB14,0xFD627BA9FBE05BF7,0x27518A400064A433,0x883400C988F98,0xFA99A203B4955DFE,0x23D9BD5363158B5F,0x13E30445BE1FD132,0x2933BF0828037198,0x135F651AEC009E47,0x7EAC02D8861B1900,0x72811D2E8955B956,0x2B245AAF2D218E,0x37A482BB3DF2D133,0xCD3AA665C0ABDDA,0x9A1CAD6678B15FA2,0xB8A31549844BF76E,0x27A2852C396FBADA,0x66E8B2BE0605DAF8,0xF227A9E040CFE815,0x17B52988B42BBF,0x12A0ADAE3A3A1B6F,0x8B14916711D4C33,0x7302E6419087121E,0xA729C495044FD47E,0xDFA36DD89FA43D92,0xC425F70BC165768,0x1E2A916F9B3F4847,0x2807BBD57F4FB8,0xE75F14669B2429CE,0x99332F675DE9C28,0xEE1DC133A01C9BFF,0xE3946F91DD1C2035,0x7CED93FAA0250988,0x83B3B164366E6E85,0x61ABB68DE49360C8,0x3AACC4022249C0,0x7DCB89487F5499A8,0x56BF77F8B64B35A4,0x3B2B79AA4CEE208D,0xF3B0FC1837B8BADA,0xF8A9252C30D85CFE,0xAB927F7363B15C8A,0x36806C140F69995D,0xDA9C314EAA009,0x6E74BB1F149EDE4A,0x5DE604CCD30429AC,0xFD16F4190C970556,0x64876C10D6870A6E,0x56E87AA774C36734,0x3B86115D32659E11,0xEF254D29E191D3E6,0x389E7AF3A488DB,0x991B5D5525DCF02,0xCCDD5891472E0A,0xE9C62CDCE9FD9E52,0x2D572882EC10910A,0x4DB638AAD27FD619,0xE9F14DCB09BBF4C2,0xB1C3FE469BFD0CC,0x19245934FDC470,0x1F513E75E0EB333F,0xF12D5709D7BD977,0xABE2BE6FAD59C2F7,0xA6112B0F13E0DF31,0x8EE4DA14052AA27,0x2714D4C74F1ABB11,0x781090585CCAAC0,0x86343FB723932,0xEA6849656242E394,0xF7FCF0A5E66E6D8,0xFA9C0798F606ABEC,0xDD840348012504D7,0xE22369BE0F7F9297,0x1E3DF094F9EBD8EA,0xBCED0F753062FAF9,0x2A83DACB5D6E04,0x76765189F6E16F83,0x3701A5AF2AD4F885,0x22196F84059C4E27,0xB19A0A2DDE2A5093,0x4BABF0A9DDCA2041,0x62A549AACCF03F39,0xD4C725F845C89E69,0xD78BF2A7FC3B5,0xEDF5701EE29ABCF2,0xB0163A8B0852D03D,0x1382D153B16792BB,0xC1F1451511053BF6,0xE1E9CBE9987D865E,0x305EE19DBD41098F,0x54D5D47744A3894D,0x474BC6193D50E,0xE4CEE5260733F7AB,0x67B06C75F9507F8,0x3F7F58530C90FD64,0x5754DC35DD85C24E,0x698435FCA99D5432,0xDEA26BD202187DB2,0x40C3322CA7DB6DEF,0x3A9CE689EB3DA2,0x43F6FAF51D7B3EA6,0x4B1628CF5C47A22B,0x73B3A2044D4E15D1,0x516EC4AD5EE602D8,0x15ABC53AAA0CC5D3,0x4FF5853157E8F424,0x33CACE911CCF989C,0x387F4DCBD3C129,0x8D8A4BC3A65D80C7,0x423588FD82326137,0x7BE81AB16B0764CC,0xF4EE2B84A242B64F,0xDB02C9F78178F0C3,0x97D1854F5E6031E2,0xAA3845E017ABCDF,0x31511B1BBE814A,0xD65850201623AE5,0x42725C89D9EBA34C,0x663EFC50144F39DA,0x513EE92EFDC8F635,0x32B22E4528AD0A5F,0x3D578767F07135FD,0x16FC4B16C332E1A5,0x58402DA1D6413,0x23FB37F3396A3BE,0xA27A016CDCBA85A5,0x942E0FB6FED4AFE7,0xAC361E7816AC1B19,0x851EBE96FB57192,0xD90C185DB1A54CA,0x2427617E9C94F831,0x1643B293131A53,0x6DF68A1B4BCAAD18,0xFBE9D8B8BD9F56C6,0x758C812E8319C7D0,0xA0ED671E09600EB0,0xDD5B75B904552E39,0xF9AA869E6B9E6709,0x4221C1365DFA5DAC,0x290F4E0B1571D7,0xFAEFE863F777DEB2,0x76E3713706B7E154,0x49F173EDE7802121,0x20A77C29DFFDE310,0xC81F34CC5D72B185,0x7128199799FF3422,0xBB6BD601652C3697,0x33F1C5A027C821,0x811A3FDC81A3F384,0x99F37279230F2230,0x5C4F9366690C0A37,0x8C9680BC3D490454,0xEED8CE117ABD8F2,0x6559E644E80F9A08,0xFE12EF40777D071,0x17FBF2838407FD,0x76F9F824746962B,0x9DB07314AA044D4F,0xBEB5008F9C68CFC3,0x6751F53F1342CB96,0xBF857F7F29883A95,0xAA233EE8C226B235,0xCE54DA068BA11565,0x7EC2330910C3B,0xC31963899D659880,0x93EB34EA066624F5,0x3C17BBB7D21A1677,0x2F38CB2A36A8F1F5,0x708396DFD460B679,0x56894D2C567D6031,0xAFF7DEF3C2FBE712,0x2D0C670BB5C8B5,0x61D16CBBD8586ECA,0x9E07C660097454CD,0x53CAD9A936ACAF9E,0x1A9BED3ED36D29D3,0x9526A1B5F88DE0D9,0xCFC72A4285CC116D,0xBAE96F87D0345FE1,0x282E0F13ED9152,0xEB5D6A9B70D33890,0xA14941320FF2B441,0xEB0AAFA69E8C265B,0x1E83509BA8400EBF,0x985B418370B9ACA,0x9678AB79983C416A,0x4533DE11DF41CD2A,0x1C8E3646F79148,0x70E5924EA0CA0659,0x8030816F2DA9EC60,0xFE03FFD0FD9E4083,0xAB1CEE9F82EDD347,0xA0AF20D93197EAC7,0x6E7B88F3B28E38C7,0x368ED248E75109A1,0x2F094222EB70E8,0x5AA48DF0BDA82BA0,0xCDBC949106FF0331,0x46A0D1732FDAD650,0x45B1F35DF088EF11,0x7002F326D1E7E554,0xB0B7F2384CEF0220,0x782A42772C6DC919,0x3F0CB272972F68,0x6C39F727E1E7ACFC,0xEC0AA9754388A574,0xDFB14B26BD5CE334,0x646A3EC8EC97A66B,0xB17001657FA88502,0x934CFDA7D7D5F6FC,0x511382FAAC88A03,0x139624345DEACD,0x98D6EB9CEA88D6D9,0x8ADE2A909683E55C,0x3ABD7E7C9E16560,0x1274FB1E7BFD12A7,0xE1779A2288622718,0x3F36E1D04CC9F4A6,0xF6E85E79FD0F0466,0x111BA19171E897,0xE0377F9D0232BC87,0x5F61FB5B009A4068,0xF5525D154C63FDA8,0xDF3925DDD55FD23E,0x36159C183F8E9D46,0xC2BE8909237B0F75,0x5499FA2BE9A6DFEC,0x631C981FB74F8,0xCF92BA443F1FE6C9,0x3A19058E1AE7A15F,0x25563429687D81BD,0xA2D03B5F6F4BBDB0,0x2F7F213A82DA3E0D,0x17E5C2278249637E,0x99C8CB80C7946AB5,0x1590AC509308C1,0x7FBE89D69ECB2B26,0xEC6AF1A5C7A06C2E,0xB09EF1F530FD7C65,0xB4C882CD594631BB,0x4C4A83390DFB90A1,0x75866BDF01C887CD,0x1B69AABA39D6413F,0x18B584F97496F2,0xF3173E41E20DDAAB,0xD24F9DDFBFFC2150,0xB00FF3B5EA3B7472,0x92E6295D49B77715,0x57AB5FB5905EFA21,0xA2BF783293CFDDBE,0x20D0FF299CA70D18,0xEA999E9EFEAFA,0xA8E218282E9CE49C,0xCADD0DF368F4145,0x9FA145321C499908,0xC60C050935B560BE,0x32AEA3DF26134269,0xF0A5B03CFAA16533,0x9FE5D4C07C862711,0x177C282B3E3958,0xC380A7348E02C73E,0x33E1D4F9F990BD3A,0xEBA878CE498694EC,0x42F7597AC6961C89,0xF90CF8624A320E6B,0x97E61A74908F4C2C,0x1C1C894E77D2945A,0x127F594AF7C7F8,0xAC980FE69546FCCB,0x8EB0A70989C0E2F5,0x3F565E6DB3DBA42F,0x3A979EEE9874CB1B,0x52987F4F0BAF541A,0xE007C2B49AC92B1A,0xB6EC8A7D49B407E3,0xAF45706CBEC87,0xAC814457CF2CD11A,0xDA6659AE564B093B,0xC73C160876CDFFDF,0xE0BC11C7891A9E4F,0xF66BD9E2D7073569,0xCFFD12587081D84C,0xCA42AFF5A834628D,0x1536E2131DB149,0xAFA3A87AA43D7CBE,0xF80246C95AB951C3,0x914169B0A60851A2,0xB833DCF5A0392E37,0x968AE24F17346159,0x55188148DA10FCF8,0xE0AF04A9E844C5EC,0x2215145CB665D0,0x1F0CD43D075C51E8,0x2F15B5AA143F09AF,0xEBF06336FAB20B0D,0xC55515CB00548C25,0x2BD780D10D147EF3,0xFC5858D6C5E1C914,0xB3686FD93837F481,0x1744B85CFF8B78,0x1370273CA89C0E17,0x4E49EDAC722A8925,0x462656D1909A4051,0x8BAC44053CB43F2B,0x9EFE42907E3553B,0x3701F6D6732E04A,0x7006FE391B701394,0x29FABFE4C0DC47,0xA2D84439C2970E72,0x357425825821C6C1,0x4A2091A6F96A2CB,0xF82AAD74E3787A3E,0x393E71E87B823709,0x82B5607E7441F889,0x13E99341F9542CC8,0x3A9C58C4893E17,0x5076AF2C74AC7262,0x3AF00405AE1560E4,0xF1D23AF3A287BBFE,0x38316F5CC4002CA,0xA804FF7304B1B84B,0x709051B0000F5B58,0x9B43445037BE5EFF,0x13AC1FE6BAAF0B,0x891994B27F680018,0xD801E6DB18F8F5D0,0x2FB3FCDBB8C2B572,0x451F8D2F21206C58,0xA97D9DCB683DDB1E,0x2DE9CE34B20D5F97,0xC2AAD649B667A333,0x24222809C95608,0x21AFA9F8CA5819B2,0x5C9F3B20F91665AD,0xF5CA54C6F7087999,0x9F46AD4688A9201B,0x8A752B8D591E6E16,0x5B96E1CF92EC0A78,0x745CC0D6B4F230E2,0x197AAAA6BACE74,0x1DA56B1345FDE7FF,0x9A4EB07CCDA137DC,0x373FF6C9ED9593FD,0x54B520A59D4D0EFA,0x5AEEF87A014C7E53,0x116419898A516022,0x88765CC00944897F,0x211FA405F9D038,0xF6551C87EE5B696E,0x7976B51B674C6E6D,0x324B8DDD550E8131,0x39F02873101AE2D8,0x7C98563FCF5FD829,0xAA327CFC1937B4BA,0xB8B2D46F7D2F4521,0x27F68E45534F4D,0xE3159BD5098D0859,0xDBDABCB4D1CB18DC,0x8BC04A3AC37AC16C,0xAC6C8AA0FD1D2C7,0xFA063D86EF486E64,0xA2E6809761D93BB9,0xB7BF2AE0988589AD,0x3DEE6D9E970EF2,0x77D5336B07CFFC36,0x3FB94864718F06F4,0xB68303BBCA53183C,0x7A214094AA1006EC,0x5E11300EEB639A79,0x16560249CED96044,0x6B7795FD291160F4,0x2173CF68FD5764,0x3C0C7F51DFD63777,0x98D2159B52E2E0A,0x496B0995C837FDD5,0xDB58B0A00CF2B472,0xFA6A514076930931,0xB1E4441533EF9215,0x154D2852960AAB89,0x26F9DD934E61AB,0x5EC163BACBF1C301,0x6830642CED0ED7E8,0x22CE0C6DD1FB9287,0xEDAAC11A75AABEF3,0x3E01225B5525A181,0x186E4C3C00281031,0x348A04CB2481C43F,0x1B5383A9DBCE4B,0xE1E23847DB38FB30,0xCC51B06F04D79AED,0xE2386AECD202E170,0x52ED9F7D836B034F,0xB3A88A12DC5C42E1,0x4F8D38C8D8530101,0xAA4F8D686230F083,0x14CB1A54FF1F62,0x64FD3BBF621AC2,0xD1EFB2C84EA964B,0x555C18EDAA2350FA,0x90407ED40BB4D9AA,0xB1B59F7776C41735,0x113698028DBB223C,0xE12F7CABE7846F16,0xC4CC6D77B87CB,0xFF689E98692D891B,0x374643D2C9D8C829,0x30957051595DF0F2,0xA0CC45D296F811D2,0xE343A4A1B06569AB,0x25C548E068626922,0x2B60EEAD2A866E29,0x33E6E11ECC7354,0x371EC737BB3FAE37,0xDB310C642FECD6E7,0x87FCF1D4B1F21E52,0x5F0749536AEC6AB3,0xDD28EE3E2BA0086C,0xC8510F90EC7E4769,0xEBBA16EED1245D53,0x25276858DD5502,0xCAD134B46A23B190,0x2037806F6B1BA034,0x343D97673AAFA7C9,0x21AD48F699D347B2,0xA7D4DF040F7014DF,0xB8D28D2130E24A2E,0x8DD9828DC3C3D56F,0x1401479A2D600E,0x25939BAF140FF9C1,0xEE32F35E389E4A93,0xCE38667DBA801BC8,0x31124285CF2BE29E,0xAEB22CB723DFC0E2,0xBA120D2AE7C3755,0x75DA0B950456E741,0xBDCE68C33C135,0xC375E00CBDED2F06,0xD173E3E2EDA54A27,0x158D3DB5902B52D8,0xE59629F648618C14,0x55CC998E502BA0B2,0x7EC5BEC6BB452C54,0xBDC9993FE15E8B81,0x14171BB87838CF,0x24C758690C1E7AE3,0xDD1F27A4AC6DF49,0xE1C970B413180CFF,0xD623FAF376B3E80B,0x8DB6164D9BED9F45,0x1CB731FEDFF1E65B,0xFF61921154E885EE,0x3B2657B5DD4931,0x66A062E018FA35F4,0x9E1465A3A071E03,0x47CFC2F2FCC20C4B,0xB5194519F3A665F1,0xF93553785FEAB0EA,0x717A0F79258F7485,0x4F0EDEE51251ED73,0x3085FAF37EDDA6,0xF0620AB2FEB0A15A,0x546A8D0BC0D4F4A0,0xDF78153079B99FCE,0x382D45799B5D52BC,0xAEE201ABC2EF0010,0x4F364A1B84BE7868,0xA0C44F31B9863EE4,0x30CF4F20707C4F,0x71DF82391EE3207B,0x5BFF13C91368E132,0xEE8371050090D50A,0x9880D419CEAB753B,0x96AB936973819477,0xA5315046318A3407,0xC6B2E1C96463DEBD,0x14ADA177859F02,0x34599760599C0A70,0xF8132E7D910C51DA,0xC6F9DBE0CA25894A,0x614EBB55BE581AC,0xE8833C2D65DA311F,0x5C966EE756C20998,0x5C33C7EF7A34D66,0x3506C2AA193835,0x847236FC98A5B56F,0x80ACAA8A404EEB02,0x89D8081244767138,0xC3DF7D5CF2F918B3,0xDC8BB55B27E14354,0x197154A265A3EEE7,0xAFC9A5E704884D2A,0xE00AF36AAEBEA,0xBC33B82ABCC68FB6,0xF496E5D2C0ECC5E,0x2EB7E4DF0F2A1226,0xBE1BAF95C93EBC94,0xF073BF842EB6EACF,0x82E03716EE3E8CBA,0x2BD11A2F360D1294,0x270E8A3E289B9C,0x8B3E17D02CBF8C6C,0x1FA07F2FBBE32221,0xD5579BB026CAF67F,0xCFE5A97CA6BF8B98,0xE184AA258A667887,0x63D86054531DB25,0xAB640F1861FBFEE0,0x32121FAE03C32F,0x38D02A0A524E6E06,0xDCD77994E1568AB,0x2BCD61A1AE7AB6B2,0x40F933E0956C1C51,0x24F585FDDB160B1A,0xE9E57590D8693D82,0xC39BBE5A8D969565,0x31D8B38F592187,0xAACCFC623A322B17,0x902319BB5A3A13ED,0x7EF6EA914D80B5D4,0xD8CBF55EC24FE1FA,0x4BCC269DB57A3888,0xAF225ADD7807FD68,0xCF883240C7C330C0,0x9FC5E1F11125,0x125BB44DC46F503E,0x7DF9EF9905023F18,0x6FB3B867C3629AF,0x38FABA0E8420A3A9,0xA29087D931B82C6D,0x94182DA91432CB5C,0xF02A2FDD752EEA6A,0x3BB153EB2B96D5,0xF18E7B947F2E1D45,0xD716FAD1A3DFAB00,0x435A568537BF03EA,0x5327D2B987542360,0x15334642F5237633,0x9063D46485EEB742,0x65B27F1F03FB3463,0x389A7EBB0BA161,0xE992AA15DA5F91A4,0x7A52980AC07BB5ED,0xB61E01283FAA6302,0x54689A101AFFF93B,0xEDFBACACC70C111C,0x8B822F5463FD328C,0xB38936A09E081784,0x2AA4C83800E7B9,0x670D17D20F13D463,0x676035B149413B82,0x2E0DBB89EC9070C8,0xF6A10AC6CA35A9BB,0x24A998A22D4E39EB,0x47105A2D17EDFD14,0xB9B051EA68EFCDAA,0x324B65DE15DAB3,0x3BCEA80E5B51F1B9,0x4842FAD757541B35,0xD27BD4FF4917FAAF,0x993879FCC209948B,0x32F035E4C1900CAF,0x36650BB68198E3B3,0x712ECD297993A0F0,0x31452DE261193E,0x230E1AC362490FF6,0xE2F5B37CDB372116,0x839CC4860B4BA05D,0x6C904E5774F0B06A,0x5BF889F254E89FC1,0x7FC50CFE64EBF781,0xF8FAE3C1284DC21A,0x2F0F91CE07214A,0x9090A49B3EFB90A,0x7099E73219BE4525,0x293436B2584B04D1,0xC8D03F7D16F73CB9,0x1B76F077F40D60A4,0xFA08A945BCE2EAC2,0x33626357E183F3C1,0xDCA949164C46C,0x2223D995CF228238,0xE1AF80B20201188C,0xE242CE65126343DC,0xEB8F406F71B76ED8,0xDF5A2014FDE7816D,0x725D034AFC8C9A93,0x65E39B66BAA3DE04,0x30B9EFDA0F6E1D,0xB9BFA9A582BE56D3,0x7EE7DFB5586BF50F,0x5F33D3E146F195C2,0xD2B4ECCE2D37802A,0xABAC5A050ACADBE5,0xE356B07E60C5E4E3,0x2F97C300D3DE46B7,0x27B2F39BBF1C32,0x9E4C36716FF64B62,0xF49EC257D43CFEF1,0xAF2C4C38DF694B4B,0xC9519FDA5B10F376,0x8C18186EFF531074,0x2442C244D72C298D,0x74CF5902E4325E14,0x2C38150B85DCA5,0x299F152BA841C28,0x3D522DE281F2624B,0xDC81596613D90081,0xC6B8A8ABD69362FF,0xCCC2B85D78B1CB8E,0x872237229A57BD93,0x84F7384775F9ACF8,0xA902C8C3529B3,0x52A1F3072AB2E537,0x84B18A4F85D5BEC2,0xFAD2998AB881C7CB,0xCE2E26F49E5E134,0xF79A14E9F2D94393,0x329A8A6E61A66972,0xA971B5A248EBB6DA,0x7632D815ABD73,0xA12F74A34637DEF5,0xC401E13E1E296C2C,0xAFD50F77F58A81D8,0x3B75E77BE9494A75,0x3E87EA5B9C023EF9,0x805E0B6C7D8332CB,0x33DF212F09586734,0x173540B6A27F1F,0xFE2B38CEBA3D1535,0xB4B1A8C0CA311B42,0x65B3953A4C089803,0xBD6366D514DF4A79,0x4BE2A7DD8A4A819D,0x546339367EC8BE6A,0xEF9B820EAFA333FB,0x1EF9212ECA05F0,0x47B451D3D4D4748,0x37C585B2947DD073,0x522B93CF2CFE9C13,0xDED985DAA0A08DFD,0x5A495AC3CF63E3B2,0x2CF1CD2DCC6A28B9,0x2402D63DC509BA12,0x362759F409353F,0xDF4B3BE60F43D23F,0xE4B2AC471326A1D0,0x2100B2A1FFF703B5,0x89FF9BD79FE47C24,0xCECA962DE1683501,0xF5EF8B545E42F521,0xAA9256A0CD450E1D,0x35489576F686C,0x40305BE4B708B16E,0x4B508BC54B8E1D66,0xDF6AD9D85BFE7D3E,0x56332152FC07C87,0xE04EB933B13D306E,0xDCCBA39F78A272C7,0xE727C180580B17C5,0x1CC583973E8A00,0x5221497057845097,0x2F05F476BD85598,0xA2893823EB57DFB7,0xFAF26B7FFDD88749,0x412118541F403A8B,0x85E0AE20D7372E6B,0xAD475E25A3225146,0x1F3026FCE877A6,0x4E207D1027B52E36,0xBF618DE897942E75,0x4024C7F4545443B9,0xAB0A8C2AA7FD7377,0x9E9D860E9CB14D22,0x3EBEA47950919EA6,0x6765A075C4ED62C4,0x25C96B2FF6062A,0xB41C637D9EFA2328,0xDDAF8CA6234528AC,0x219897855D34E380,0xD9FB317C4C7D1BCE,0x463D6E88DB0D3A3B,0x1DE4F551BA2694BB,0x2D78E3CA94354F07,0x20F8B7260EB667,0xEBB54A510BFE3F6A,0xEA78D6E155A5612,0x26EF55ABFB3EAC97,0x6F25C4998A762CBB,0xDEC496E9C6908C01,0x84971144FAD87D0D,0x81DAAC8968F5D957,0x2AE8C21B73D12,0x3046B8F6A05126E6,0x82CFD91B9F2ACED8,0x59F0919794077B2,0xD3258E39728E3880,0xDE782B6C13905801,0x1B36198848FCE944,0x7679C3574FBA219A,0x3CF6FEA1782C0A,0x39544E606B60730A,0x8B55F9EEB657466,0x333DA272B430B410,0x306211C7D93C7F1E,0xDA39FFA96E0E9FF6,0x55728CD8078EA147,0xD4C2880B86D255D2,0x316F1357BB26A8,0x494744C29FA622A5,0xBD3777D330CF1421,0x7ECC3D0689E50CF,0x6DAF323256337EB6,0x67655E6E5E66552B,0xDE0600AA858BC425,0xDF631FC59FB6EB45,0x2A55266EEA7068,0x9D5D32B340ED6143,0xF7191D3259C136B7,0xB65363A36442F1FB,0xAAED9F346EE38DED,0x6D5A763A6F7CA222,0x88CF906816067BF4,0xFA5950F186CB7937,0xF9FA256D52A40,0xF840FB717C95B1C6,0x6B42E91A363F93EF,0x9A14E7BE416C6507,0x78D31CF7952BF02C,0xD76CFE7387F0FB73,0x300FCDF4B8683D45,0x4BD5838255D6CA1B,0x2CA4A06130984D,0x4550325BA074880C,0x7CCE4D8D0AF7FA8E,0xCB3E8F48FDF93D04,0x74052AC2D7ED3F81,0x26FC5150127FDD5C,0x19B3D9FB164A51AD,0xDD3D082757CE6440,0x1DD52A9352FC52,0xFB140A2D19845A04,0xEF884298171352EB,0xD3E85F7598DF8700,0x1CCFB334AB36266,0x442085B863DC1C5A,0x12834F02E751E5F5,0xC33FE85B2921AC94,0x2BE085062DA9DB,0xB6CD67DC8D5AF1B0,0xC479A892C57C69CF,0xFB37C9942234AFDB,0xF226A0536134EEC1,0x48A1252CD46E55D8,0x4DF5D1A33291E9E8,0xBD486C5E73BBD961,0x1E161C16337A46,0xABB8C1D8433B4DC2,0x616834A997C52E56,0x503A33B30549DF42,0x559949244ED36EA,0x356FB4655B1CA57B,0xE57380766F7DFE45,0xA7D2D6E7A7452007,0x28F943009794F4,0xC6EE0842077E6129,0xC1B5B197ACD682C0,0x9628A5709D77C7B,0x6DC319A89CFB1769,0x2965CE434F2BEC74,0xDB7737C3B8752C29,0xA772578981F3F5F1,0x3704AE39F76E68,0x70F901C0A636AB3B,0x1BE881CEC15770F2,0xDCEC927251669FA1,0xB3A6D25566678494,0x4F620842E99DA44E,0xD12DCB5AC13FBCDD,0x24ED663B148E9209,0x155FA1CC88F05B,0x688FA39990D9BA28,0x344E688BCEE6A998,0x7E595AF9E15A36AC,0xD0835EADE1241D27,0x744C6E61759AF320,0x1851D7CF2D3DDF59,0xC542208ADEF8B80A,0x3FF858CA145B37,0x2598735140921E77,0xC9C8829F18A443E8,0xAE96737523E0183,0x6369F409A5A5E345,0x332050271A43048E,0x4721398030F6CD83,0x40358EB67784C35E,0x1E91628D131A54,0x41954FAE637C62CB,0x679B9033BF4C84DF,0xD17DD286F599E916,0xCC9DDF9FC9B98725,0xBCE559ECCB11AE39,0xECCDCC78BCECAE52,0xE0D7681B55149849,0xC1F0E2F6E8BDE,0xDE96F3A4D7FED9C7,0x659651E405F0D720,0xA78177477E67A3E9,0x16029770D2FB403B,0xFF0DD19AD8679028,0x9457787A189FD48D,0x4BED5A0344AABE4C,0x12FBE6ECF74F1D,0x5B1A9C68F247FDAC,0xCA429587ADE04B71,0x49E7F75D1CEF0029,0x81F7359A6342B682,0x3D4521F210DFDECD,0x8E6F5E155C60D768,0x5E546CCB942E5F00,0x2557211E035CB6,0x250ECD27E936BAF7,0x369FA73161052EAD,0x217A0E5D76AB26B3,0xFD6A992F6C4C510D,0x168DF649781456D3,0xC26C245A03193B62,0xFBA181987BBB5CC8,0x2B35FA7B0228E5,0x394F2F1CEACCD4A9,0x8D9A48FFA325F015,0x8A5DC4119448110E,0x3308010A3A3B3D81,0x4E23957073618DE6,0x3B61911C3962E312,0x40EF9C56990949D5,0x2F36969CBF16B9,0x89D9E5EF6E1329A0,0xEF442C385B3CC83C,0xB17A369C8BEAD8C8,0x8535AD5F5CFBD8AD,0x445BCC759AC4222A,0x5FA677202FDDBD32,0x132713DA1DDB4DBF,0x1A298074593243,0xF309BD395669D4F0,0xFA36B5EB163F01F6,0xB1E59CA35827A64,0xB3FC5463DA9EA8F7,0x245B907D935DE3D0,0xBC8ACE6861528756,0xB4F96F0C867F5DD8,0x305BA47A49D09A,0x7F5E4322C765991B,0xD2B3142CD50AA795,0x91CEE1FA4BD32E1,0x6E671A9817C955B0,0x72C033047B91C02D,0x22191363F26C0BE4,0x5D0C7D1C2339B5EE,0x9C71EBBBE8401,0xD15E1528DAB6B993,0xA3761F96282FAAAE,0xEF99629CFE2DCCE0,0xDE88A0F728A78CC7,0x1144C1CD79A3C325,0xECB82E1096150C0C,0xD953F402FBFCFBD,0x357C113910A472,0xB62EEC0760B0CAE7,0x41DFE12AE0A72475,0x266259C006A0CECB,0xB6B098916775E5B9,0x793A232A9908345B,0x50433CE810457FF9,0x830A13560DE05E37,0x1EE77A352BD5BB,0xCB711F9482B748D,0xA9294B907115A4E0,0xA654311EA9E64D18,0x378ECC3266880AEA,0x14112253C1B180CE,0x78FABA110D827991,0x45D53D40F35D7D23,0x13BCED149DA8F3,0x46B57FAC7E6827DB,0x53AFA1F4D2779CFA,0xC31FDEA1A022AB84,0x58DA62C76BF460E7,0x47EAD963AFC6FDD0,0xBCDFAD38AA36AAA8,0xC6ADCB262639A106,0x1ADA38D61C184A,0x6FE7FCC7BFB616DA,0xA229771FBE14E2D8,0x956DE9A72F9E8B87,0x9878966824E38E09,0xCF1D8B55364F7ECD,0x9FBD80FB91001F01,0x7149424F96287A4D,0x399AC5CB63DDB2,0xCAB6722143A4AEB6,0x98ADB60F16171361,0xB9DF4D957AD6B986,0x6F618777BFC93437,0x600B6DC30A1E234A,0xBB7B02B69150BE9C,0x6C7CE5E4CA3C8AFF,0x1EA50EC0FE69D9,0x245248473C9BBE8A,0x823818A1413C53EE,0xFD53DD500CE6949B,0x1357EE370B63018C,0x92F8FBEC881A3C61,0xB4BB12A0CAAC9811,0xB1BACB147838623E,0x2E1AED36EEE891,0x9D6AF79F9827606A,0xFA1F9ED41A42DD6B,0xDB9D8BA491EAC095,0x4CC161243017F277,0x6460889650BFED49,0x780D7E94972B9078,0x8F46E5C81DB31817,0xD794D73935F48,0xC81601E681DED57F,0xF84BCB6F46B59C88,0x3406638D70E32D,0xBC60758C57CCA1A7,0x3FD5A82B0DFE6171,0x6DA27616B6B86266,0x8447AA0553619B38,0xEC10587ABF5F8,0xF7F520CACF565E39,0xC5DFF379757BE8AC,0xC6CA3F0656C423BB,0xB837BE4F0DD1AAB8,0x5D4099BEBA3708FE,0x6AFC05065095D107,0xE16D43F20812AE5,0xF449E68B0EBAC,0x641E2C935E0747AA,0x29F25F48770CBBED,0x7960F2726B8ED1A5,0x34EB57897381B193,0x80CE06CF2E0997EC,0xE006E96AB9F38D79,0x2867BE9A9DC9D8D6,0x2B5309D6469E0F,0xC7FD6D36A1AA1250,0xB42A899719E21B8A,0xE5EE6537CFFB8746,0x6BEAB3C731895C07,0xF0C5CD784CE09EE9,0x18549CF6B3CAAEA9,0x3217FC6952807FD0,0x301F57377F1AAB,0x2E9D9E87FE7F052E,0x47BF59F7A1FB17E9,0x4C18ED05E48AB60E,0xEB84B16903AADEDE,0xBEFB3F2B454ED5CE,0x77DDEBA10CEF10DE,0x52ADF0971DDDD245,0x898007EC7A079,0xF36FCE5C6A4A9AA7,0x5766F73466B7E857,0xBF2A0B2E7A680EE3,0x55E3AA0BD0B546E8,0x2513A80E49AC3E36,0x5C60D115210F165C,0x205C28A9D638E8AC,0x3EE4EFFCE7B63,0xC5244A444EAA644B,0x229FE74F27EA42FB,0xE2F2CBAC5752E23A,0x58D244FD58D9D62F,0xECEDA29C70E0F5A9,0x652715D63A6FE79B,0xCEA1892ECA4EE446,0x17ABAFDBCB385E,0x25FC83F1168AA184,0x4D665F6AD9EFEE7B,0xDA893BDAD563ABB9,0x53EA7B4FEAE06273,0x2219A40E2046EFEC,0xC203229A18260CEC,0x51A5EB9117086C63,0x3AA0D0D4DAB916,0xF73DD738C52A0F3D,0x9284C4D3C0FC0F77,0xC64E2D02FE285044,0x99CD698F05C56864,0x2886B84F0D26E285,0x8C1E5BF5A3DE06E3,0x83A716C49ED191C6,0x3492C2258BABB5,0xF275B233917C03A6,0x2E1195EBC775C87,0x869EF61D5DF7383C,0xFB8EF8FAF9EE7DBA,0xE7A6650D6AE23694,0xB0334C3FC3B986FF,0xE7F31420F03E809D,0x81D9EC4559069,0xBC18CF9881FC4D6A,0x9F9C37098960F88C,0x48A7200A4079B84B,0x7C16C60B31349FF9,0x779A8177AA1C9669,0xD2E876106AA584DD,0xD797162F125D6C91,0x3BE186D0E02252,0xE73D05FB6C2C634E,0x725674A59771DC14,0x2942E7613D075E28,0x76EF009BD3AA25B7,0xB9ED48D634864B9F,0xB55783AF99846C0D,0x7A07E781A605ED5A,0x36C1CD635620C1,0xFAB0766A4C7E9291,0x11734A2B42017FD5,0x1411E56ED97C8F70,0x48E13D733DA5D806,0x5BC5E4508431FAF5,0x729E1AAF953628DF,0x46EBA780E598C61E,0x1D2574668DDEB4,0x113F71D0DA24C295,0x6DFE92D71443D1FF,0x3FAAF1556E414E0,0xE583735837DE8282,0x294B333A9C3753F,0xA9FDCEE046050E5D,0x39BCF7EE65AC33A8,0x7B8C37B8289D4,0xD8B1962A25107819,0x7043B645BE2B74F9,0xA3AA3856204BF18B,0x8EF2E2D1FB220972,0xDF26D10191E5810F,0x871A59099B02BE85,0x425D32B72CCADA9A,0x5B1FA8CC18644,0xC49AC54647F675D8,0x15EE609CA2BF8EB2,0xC7BE2BCCA918877D,0x4E6FB9EE3D3DEB4E,0xFF3516E4003A8D1C,0x32D7B964DBC8CDDE,0x2008820065A17F56,0x31C7A281B3A188,0x7F45C6C46BEAD76D,0x8DD0E8AD3DDCD9D3,0x2E75918648ECEC5F,0x43BE44B6C333A200,0x27C2F6D69F221D25,0x19B53D5A1197E71D,0x466264EC37EE9752,0x2624ADDEC2EF8A,0x61716652A253ACFA,0x1D943158758286E3,0x4051648622D76FE7,0x905178C820FB7739,0xC5B24847329B2D4A,0x18596FB27F32F16A,0x198C9FED762AAE1A,0x1B452F3D7ABE46,0xBDE97786F3572913,0x61AFB03C4178E40,0x846D4365D54D8041,0x642B2156A80B14A3,0x900795174648776F,0x17C259CBE0C668D4,0xACA771FA9F352BC1,0x36AC799407929F,0x1AA68A3A4F5C52CF,0x2D0E7FF78163241,0x518188E8E95AF967,0x2E262964DC63E6FC,0xFC31F8AAE9B66525,0x3209403275BB63E8,0xC1A8A54CEEC0DF11,0x22F81473707E9E,0xA4BBA8F9FB1C2301,0x9D724855FBE10964,0x93473D477890AE94,0x1814C03B445AFE05,0x2F356B4747DC9680,0x868594AECEBC4929,0xC75AC70D4AA54378,0x1061D738FF091C,0x4E021AE577E3E101,0xD9A261E064D48780,0x56574B51F6DD7746,0xC3BD1D56378D1188,0x5CE4654F765CC193,0x1ACD05AAE660BE73,0x53734261B75C7B19,0x28FCB929E7F08F,0x3661160367A7AE47,0x88D9DE1B119C7358,0x64B1D648D26A2B41,0xE4CDB3EF70C5077A,0xAB620704D281E4D8,0xE83F91A8CCED15B3,0x24057C77F20E1A15,0x38E92B6405624C,0x9D999C00B0ACE3D9,0x9B769B9921BF4DCF,0x7D2E163CA81AAC81,0x8C0E8BBD808A1312,0xD69221770955422E,0xB4AAE328F246120C,0x94F9FC323286E4FD,0x2E284A7C70E30A,0x763D527429B95821,0x2433DBA8ACF2D7C5,0xC1A58CC20F3A604,0x18CFA5AFA3C3E099,0xC0D8FD590F95F259,0x7113F93C80809B9D,0xAF90962D13FA37DA,0x21448FF9F00B52,0xC178DD54134296E2,0x96AE79024661E993,0xD4E4403419B52AC5,0x189BD4E75B157EDE,0x9845781A9400A507,0xDC3B9DE5A6A4F2B5,0xF230A4ABCA74CCC7,0x3ABEEC36DFDCC0,0xDB7496CA8B97538B,0x90AC89CE46B7C3AD,0x833AA8F0F72761AC,0x5C86B94AECAA1B2D,0x743440112EB47893,0x66B797838A4CAC12,0xE6A79DC687CD9702,0x33B6EAC171183F,0xCD909810B18C3D42,0xE3486CD0A770B1CC,0x5BDC3A92FBDD1F01,0x1A90301B20070180,0x3727F9D6068A3F36,0x34A93C080682B5D4,0xE582446034CF9134,0x26030FF5EA774E,0x75284E7CC78014A8,0xD93E0DCA4E4E16D0,0xADDC93F4D97603EB,0x9FD5DCC08496A47,0x98E386DAEB3C7C8B,0xA99C27754D7F4333,0x5A5F74F9B871035,0x17A2F627DD669B,0xC7E7C164303B4AD0,0xC712FF9B7BB004BA,0x8E30B25E58B632D6,0x6518AE30F7213141,0xF49FD19CF25EBB7F,0x3275B4B5B1E3B43B,0x7695D24F8304E4FE,0x2F75CDD31F6051,0x5192E0BDC4C0A67F,0x27B985144A36A70,0x919B104DA86235CB,0x76681E3F2E6F39FE,0x1B899AA27F84967D,0x5FE38A3FA048FE35,0x127E4C59D5A54EDA,0x2277321E3451C2,0xF8341D0A383689D,0xA6C72A1563423199,0xD18409016BA50F3E,0xB6E4DE5E8D98DC32,0x3AAE1730282204AC,0x2A0260602406DC3A,0xF6E6C4C3A998BE60,0xF55CBBA74E883,0x8E6B0E57794DF4E5,0x24543DD70CE8FA78,0xF1C904666DE6B17B,0x4B72BF78C5D0D832,0x1A51F1ED1B3227F7,0xAE03A6036FE12197,0xFC8B507E1FA2A22E,0x80F52693ED4AE,0xB78F7C076BE40FD8,0x21C6BA4F628D4927,0xDE32F94E5FC15BF,0x4362D300B5E4BCA0,0xF6D88607D9AD7170,0x5D00C8EF0EEBD858,0x8B8291B2BDA758EF,0x28816E32CBDA9B,0x5950A18302042373,0xF9C8E53D7230ADBA,0x2BE8650B826913F,0xDB9339D9C53DED28,0x3F74A4FB40A0E801,0xB7BB8463AA9BEEEF,0x1B37BCBBEB6C237E,0x27E38F6F0982C8,0x64E3B742BE30CB3C,0xF14B7DFCB47556C3,0x64BDEA6CA1E7D899,0x807E33966098571F,0x4B5DB27BD835E089,0xCC95DA68B71FFC6F,0x56A68FF0682341A9,0x3E6C77A23152ED,0xE14781C7214C37E9,0x3F089AB86450A06F,0x74AC1363FE7AE071,0x20820D8C71D84D8,0x370A19E8899058E3,0x7F86412FAC64ED4A,0xB2DC1AE270704FA4,0xB10A6F514BC66,0x3A3D0F13ECF5CBD8,0x8F0B0D4FE5A7F0FC,0xF14E863D67A0DAE1,0xB534C1B708CFD8D4,0x2086BD4C409FF3DD,0x9A9D80F25C4776D0,0x96C75F3617B2F6D0,0x40015F2AC611AB,0x281D7F28CF04F17,0xD92B5843F025910D,0x421AC2568E489BAE,0x1FA0B475271092E4,0x12889C4CEC32413C,0x6261A6CD4260F7AD,0xCEA643BF04897FE0,0x12502E47CEC4DF,0xED9EBCAF65D20F7E,0xF99BD3A09BC56214,0x4AEA4DD06045B128,0xB1E77B6044365907,0x95142C7FE0314AD2,0x8851D678597573BB,0xC14CFB361761A6FD,0x29214075E30CCD,0x7D9087C665B93A1,0xBC75EEB8DFBF22A0,0x5F6DC985675CA710,0xE921CC55A7A25A21,0x72B11AD3B348B127,0x5EB38F1AF5A6660F,0xB2324652DF71A3F6,0x328CAB8D0B11F2,0x8BE6EB8075D1DD0A,0xAD5434DB9042964F,0x61C9520656FB12DD,0x232B2FA9630889FE,0xF5B529EE3B554175,0x52CA59F0FCC77191,0x4E16A8B07840E246,0x39DE1E8B748EBA,0xE08522E86F084C59,0xC258CDAFC7DE9367,0xE193B9D36FAE2C05,0xD437C2327FDAADF4,0x680003669B390574,0x20B691B382B3E3D6,0x93820BC16B0F093,0x283B764138BDBE,0xF856E26F704E729,0x9DCA934CFC2BF956,0x85FFDD8CE0B4A7E1,0xB20C825B0F0D2D1F,0x30B7506EFC83F808,0x6AE302AAB6E6C037,0xF188317F36BC1CA2,0x3B018136547D8,0xB576BBD37ACF52B2,0xFDA9726360A81898,0x915A16CB4CB21B4F,0xC842859093DC71C4,0xDB460214A4FA0AE8,0x26108F17B1AB23E8,0xECCA69DB231B5CD2,0x2F1C4C3F50CD14,0x7B1985A9DF32331B,0x1CA4661F26AF3E01,0x6AE1234CB049ABE5,0x3ABD70A4E28D38BB,0x521C86C16CD6726A,0x60441ECFD7733811,0xE3605DADF5689521,0x19BE306F107CB5,0x80A9EE193BE2C70D,0xDEB1E6952B46CA1,0x5CE230CC1479F133,0xFE6003276C59DB89,0xFBDB09757AA823C8,0xB0361D4E8222A568,0x58319353A39FB39B,0x47B9E2514BDCB,0x6D9CF891F454A25F,0x933EE8FD2BA25FB1,0x37A9EF87EB0C5803,0x739E85A0E2D32C05,0xC06A6DA76640210C,0x8AC514043AD730D0,0x8784F76D82E0D2C5,0x3CDED26AAA398E,0x636129033A89F4AF,0xCFC9BEDF73EC87F2,0xD420CBD233F722C3,0x1D74B128EF4DF712,0x6CCCA3A201D96638,0xFAD41D9D5CA57200,0x45911293CFF03812,0xE25882C56E57,0xA34899FCF6E96,0x6180ABD5102E8A05,0x4AA7971B70489784,0x432D39C465880BB0,0x979E0A2542B5B56A,0x57EA5760EE7AD94,0x2FF56FCA43574108,0x1EF15A0DEE014D,0xBADEDCDED4AAA945,0x191F9E354DDF0F5,0x6A356F10261F8B8,0x6168DAA9778D14D5,0xFD57E16D4A740D51,0x150DD6A233227BAA,0x7FCEC5ACEEDA237E,0x11E9F5CCB74407,0xDC817D48CAEA8EFD,0x687AEDD1A969B7F6,0x61628880186C9A0D,0x237FC17FCB156F1A,0x56D91D8C38BBFF3,0xF9B63FE27744641F,0x54C324E9185FECA5,0x1E279697F10C5F,0xC402363D369DDAF,0x4734EB034CA0E879,0xB790A4E8A7A6DC41,0x502580F5D0F1AF6F,0xF1CFF64BB99D5001,0x89E7F82114B05319,0xBEE8A5CCF122BAE5,0x1BE6AFABCF9C84,0xB9A2C2CFE1C1AC38,0xDFB4546EB8926B89,0x2FA5CFEB94579F30,0x6F1BCBEA0C15BFE4,0xE992CD012E1FB03A,0xBE317B95F38C6563,0xCFFA33DDF41198A,0x16EC69DDBAA26C,0x4098F82062BC5627,0x5C85834E0E01DD9E,0x6254D716222365AC,0x55429F4E89324355,0x6C1A4BBD875A3512,0x12A2EC30ED71E8ED,0x7D757B40308D96B0,0x1FCE2F68EF61D,0x752C0ED093603C90,0xAEF4D50B99F83912,0x71F35F26F27542A0,0xF424FE068A1147D2,0xCC8DF844847EC280,0xA5C78A4E37B615BE,0x171409E8F09FB2AF,0x19DA7BD833FADB,0x1114C1B5143AA0A2,0x5A1F6CC78FA1EF21,0x2E70B5BD8E4BEC01,0xE59252AC093FA949,0x53D2AA2569D09EFC,0x531E9C0C6B4AC236,0x6A404A0B587EC659,0x309B9D312559EF,0x6008363CAE21A1A7,0x5A4373909623A4CB,0x949FF05D97F1D4B1,0x32C0C1784B00FD1E,0xA650C690B4FB6A4,0xC4FF5F73AB2F3A84,0x65015CE565D6D931,0xC38C48C9EB19C,0x5DBCA52D2B5AF0BF,0x745DFA141935F839,0x808529799B71132A,0xEBFA12D91EC85111,0xF78D878A90E809D3,0xE7A6F7F06051534B,0x5242E4CAC1731224,0x2A86758C9D7FCF,0x540C908D5CF9EE9D,0x750C781BDB231226,0xD922D648ED883E23,0x7C58792B209852CE,0xBAC7F1E876F6EFF7,0x40672383193F4C52,0x8D034B9C212F795E,0x3092EA02EB04F0,0x2A97A6FB515FF730,0x46F97AB8BD8D90BA,0xC2425BE8384EC939,0x81F84E9F2BDB40,0x769F8EE06E17D2A2,0x9A266649B7C1AD43,0xC2DB609D4000263,0x2BEFC6371094B3,0x789C9A0025B1DE38,0x72DE1CFC37952EEC,0xDF578C072952574D,0x39E16626DCEFB624,0x595CC8838E3DA47F,0xD1B5A91C423C175E,0x9612037B5667B18B,0x14D16FA8D51B58,0xAD0BA2302C7DF769,0xED43A91A00600B35,0x20FCF2C4166511E0,0x11DDE34393C53913,0x46023D4F6F46521A,0xD7C7CD090A5D1D16,0x6B20107BFC79B3FE,0x3EC03AD31DB563,0xDB049F98008F4047,0x5DDCA57C6EAF5A6D,0x678813872D1EFE32,0x3340C2F6262AEB8C,0x3D34FC1AB9D023CE,0x85FC23BCD88D52AD,0x79AAF8FE77C76F43,0x27E618A083C66C,0x539C8C2143FDE4D3,0x4187F5C30EE48118,0xBB2AE144B24368A4,0x8C7B447F27F72899,0x41397F2577D4AA18,0xFEE6AE5DF5719303,0x3CE197AF1C05E59B,0x12A7332639FCC3,0x524254318C81EA6F,0xD3BF0BED00A3B4E4,0x9D66A838FA77C4A9,0xF5D1052BE44B22CE,0xBA60401807680E0A,0x975DB566BBF6C8F,0x1BB55A520F2380C9,0x323EDA1F776537,0xDB61E0B6D85676D3,0x21FA8BFA5EE944EE,0x982EA885BA32219A,0x40833F7168B63CFA,0xCFB544BC8BC11381,0xBCC508518375C05C,0xBBF9A4A568CB040D,0x6497777E67EA2,0x43213AF83AB5E66,0x394B735EF8DF1766,0x91AD4C3886C3C8C4,0x93A8E3995841DBEC,0xEE4C77A278134519,0x455E63B4FE16B411,0x67C4C6C4BACE142A,0x3F661F07591FAD,0x316EAA4600600608,0xDD5A571A4F44BF6E,0x368C0CC3CE71FD0F,0xC3279BF5CB4E87AB,0xCF263758B8DF2827,0x85BFB2B9332FACE2,0x6D368347B9E370B6,0x29129AE00A7C97,0x7D68374003C37E,0x257F44C5232F52B7,0xBD1C8E5E9CB5CFC8,0x5EC3FDA61A3FEB72,0x51B77B6F23A2BA06,0x98F6C1A7E86EFA96,0x42B43425D7D85A7E,0x10FACFC9B347BA,0xDF4C8B1849021491,0xEA09B8E1E37D214D,0xCAA28A3983FCB4BA,0xBED9032DFFC24039,0x39047120BE73F772,0x5B025EA1434ED12C,0xAFBBB3BAE7222A0,0x3EDDC36BF453FF,0xEF6426BD40B8E321,0x8EA57DFB6B3CA48C,0x80F01B0D2F4A2A1F,0x938E3F63EAFBEC86,0x59E110569E841B16,0x2EAF039A98C4AFEA,0xA00612AD1C182449,0x1165F6F7691FBC,0x456A63538AA79760,0xEA2B1F0A4CAE0E31,0xF50EDC47E44A0D1F,0xFF5862C4CBC215BF,0xB1FBCC44EC70D879,0x104076B2BE305E16,0x31FC5E8FCDFC7E89,0x269B1F1B231EF3,0x32F80A274A2F5133,0xB8387E8B3A4FCDF,0x8A7AC3C016C4E64B,0x7B6E5FFC178FF220,0xB6B72C5E48FB6735,0x2CFC48956E3CD58B,0xB78CAD36264D2C15,0x2968BD039A08C1,0x92F22153F177577F,0xCEDC82A4335FEA91,0xFF5B61D21CBDF4AC,0xE7FE43444F212C6A,0xFF5F1153A5CF3010,0xFFEE291D6A15837C,0x9C1891A60400B592,0xCC038812EF335,0x4756AD86F24BA55D,0xF4E0EEFCD7F78B5C,0x325A9322C462943B,0xC96EAFEA907F2DEA,0x453E6C2FB4ED4B74,0xEA653A16542A9599,0xDB8C16502E150A0,0x3FD6935CC26240,0x14F1CEF5338EB7B7,0x1CF7115C0C300A7A,0xD4FE8D47D8EBA099,0x5EBD01FB457462DA,0x6ED15EA0C2968E51,0xAF0C4E749F12E599,0x7B2D4226980C9BF9,0x352798AA985B3D,0x6ED348CCF7D31BAE,0x5F87DD95C5560812,0xB82225C2027C174,0xF1DE4C8767FA25A8,0x4ACF6D4B61454986,0x51CCC3792D7927D5,0xEF751B28050B2383,0x3120320EBB6954,0x613AA126DAED3957,0x995FE83D3BC9F820,0xA19F146D4787E88D,0x2B2784040900E9A3,0x8A1B483FC82B358C,0xDD5AC976E93EEC9B,0x27D1B62E08E4F5F8,0x1464D5D5A1F461,0xF76FB34056989800,0x7158CC203E2D2F0,0xA1956EE86FB0B597,0x9C9D29C04552F7CD,0xE200FE68E8ECB18,0x66BED23A17C555A4,0xD55A262C920ED6A9,0x28E62897776E30,0x8E333E6A3638E491,0x4960597C519F6FCF,0x7542315172896320,0x745999ED8D5570C9,0x9CAD1D8B108ACA11,0x1721294BABF77A67,0x99BD38EBD389EDD2,0x43FB073D3FB2F,0x2B7A94DCCDC6A60B,0x219FE86B6FDD3B5E,0x6CB431688E96EF53,0x85B3DA7876B797DA,0x2EFC2CBEBF64E8A4,0x8C63432AB89EDCB6,0xF7FC5C1D198B41AD,0x1643210D43BF4C,0x954D2D8AD6D3C79E,0xEEBD5307C85C4A9,0xDBAD37EACAB6CC55,0x8BD80CD733452E2B,0x8402701E0842E0C1,0x109A908F1A364AE1,0xA3DAEEA8C210EA75,0x1CAE0072DAAF9B,0x924C97DEB70FD75C,0x2B57868BBC31ED1A,0x756FF15DF016638D,0x1648751AD35BC9B2,0x97061815CDC5DDEA,0x6D3DA030117F0E7F,0xB6B0E1EA5ED4AA66,0x252FB6D783A466,0x3BD2A9583EDF3DBF,0xD522BDDB4175B3D1,0x5330590BCB9D561E,0x2D71EA875709B627,0x5FCEA9629946E9D5,0xB1566E5E06F07DE8,0xE662DF1E4C44DAF8,0x14C1E4276CFF45,0x7E76930B595E2029,0x7347A4517959B5C9,0xF1773FD8E0D324AA,0x9E8E273EC8BE1463,0x52EDA3AF77BE39B9,0x97CB4FB50489121,0x8AA968D0B5459DA0,0x1260C9D7565485,0x67E85FACEE931AE4,0xA6E796446B2914D9,0x91DC9809DE4896E2,0x8F754B07123D5551,0xCFC26D4B002092E2,0x427A0072D9AB2F1E,0xCA0F7444AC791F,0x10A17DFB81788E,0xF8F45DAD66EF9536,0xDF262582D63A778A,0x4648F9E7DFCC273B,0x8540DA5CA91D5A89,0xBD6901A38C8DBF67,0x3B1E891C7C405E97,0x8EAA08B4E435286E,0x3D61087F77586E,0xF584B2D97F897C4,0xB762CA93ECC3FFDC,0xAB1100BB8B139EEA,0x1A6BBE6200BFFAA0,0x381589548DB1CB46,0x14474DD0B695D8F4,0x654D4D565B732649,0x3D705F6A19FA9,0xC9DBB98396FB2469,0x3DF54F6D2E21ED92,0x9E589730354A358D,0xD1B1D7ED6A598C1F,0x2E67A827AE0C1F65,0x71F44ADBFE4B162C,0x4A8D1A513AB37C1B,0x3309CF3EAE94,0x90B94078CCD95E,0x8BF12C5417ABE727,0x10D41FE6A5F86299,0x3C92ED3844502213,0x7C6D327357AEB16,0x5A8C2883625DEE84,0xB07D32F1CF770D81,0x301CEAF6059248,0x85B7A04049555E0F,0xFC32E9A4926E7EDE,0xF3D0FD438339797C,0xA047BD896BA69416,0x3670FEB5EA5B1D16,0x9DEDB79D8BB1C020,0x9A6ED0C1D67A9FA0,0x3C7443639BCE4B,0xFE30F18EEE77A5BD,0xA9E9C2EDF6CA0750,0xEA0111622D757906,0x40A91BD8E45D0337,0x7B2679522A4BD952,0x9FD1B9B0EF955E6E,0xE9893D2594E2C29F,0x18894857F24327,0x69F812774AE67F26,0xB74BC5289E9D7DAE,0x7DE563B0502EADB4,0xBFBA7F21C14A7767,0xDD2CC8A16C27B0CD,0x2E4858A70E8CE62C,0x47C20A7CBD4FFA5F,0x28F58CD6A27820,0xC6C62954D7C9EE4C,0xCDFB4457FB42E4AC,0x6695B51274E0CB6B,0x1ED0EDCF6895A0DB,0x11785451793039C9,0xB860F0A3E8A985D6,0x7F1C68B4B250850A,0x38B3A152F50E9D,0xAA46CCEA5A571EAD,0xCD63D17EC6EE5810,0x84977FDEFF69CDA2,0x7F972687E6E954A8,0x338B5341E9C69FDE,0x26F8919140D26722,0x62D23AB10A561ABD,0x3F34903D832024,0x7E5B66FD1F150AD9,0x7722F29D7F949FBD,0xA05B46EEB114B090,0x5057507DCC27A95B,0x7E059DC55AD8DCD5,0xD0D69496016A8AA9,0xD93DA620B7345566,0x11DEDF5E74259F,0xAC2B5747616D9670,0xA1EE8FC2FCE888E6,0xF909BC306978B028,0x5BD5125F410D8EB9,0x8D0BA26A297C3EEF,0x768426A4B03DA6B0,0x823C7D3EE1ADFF5,0x872375C83EF71,0x3BFED07D6D987EFB,0xC6468A3F5F319D18,0x6337C0E474CBF7F7,0x7BA032283AAA11D0,0x329C3445EE00E440,0xAD3C7D58530E1F28,0xFD87B24270B8480C,0x28047860CCCC60,0x8BDB1F560922ADD8,0x2A60779F17E1E303,0x370190C382BE23BC,0xD146586E945C639,0xD9330395C0CCA538,0xDA9DA416A7C1A729,0xFCC638B958BB052D,0x28BD71EB4810C8,0x949751875DD88425,0x41A50411655C426A,0x2964917BB90F01A3,0xDCE0DA135BB86BC8,0x9659B5565850576B,0x6B233EEC92DA54A8,0xC7DCC73025403CB3,0x29734A01D65097,0x8D47BC83B94BFE54,0x63B24A64570224C1,0x31FAA6A2E2D0BAD3,0x8C6A0BC3D4A024A5,0xF570051A99DB58D3,0x969125D4356AFC4,0xC9160934E3FB2785,0x13D532C937245C,0xED47ED38E763771E,0xB0405EB18FC27AC3,0x5EFCAE1991378BCA,0x22924D60DF740DE8,0x8EC9DFC2F4156C7F,0xAF4E38EFC8F6854B,0x6CA4B0BEA218E2B9,0xEA7F3102EE257,0x8DE75AA5A11FFEBE,0x63DFE1A7F2A7379E,0x1C0BFA1B2978DA01,0xB9EF23FB5FD358C8,0xC20B422D45BAFBB5,0xBEFD5CC686DDF4A9,0x934A4B9A29F36FD7,0x31F3A06EA64940,0x10C73C629A27521,0x9C212E0C1E17F31,0xBBCC6DD7C2103EA,0xA2B05A48B53DD5F1,0x7FB98E3C52269B23,0xC95464E5C629A72C,0x97900C1E8249A9D,0x31F7DAEBDA555B,0xD5F44D39D79B79A9,0x844B392E27A9C3EB,0xC3D8E502ACE20E23,0x44B9841131502B7,0x14EB502ACF7080A8,0xA7DC243D96B2B482,0xDABD3920AD803587,0x212F9821062AA,0x378B7219C9BEE058,0x895F0070EA7B44F8,0x1223D9D81C40C03,0xA6381884A8547ACF,0x9DEBF94899B69BC4,0x6D99387E1215B775,0x29BFA1DE9242C45,0x2E1FE58A5D2F24,0xB6D293B8C3C639D8,0xACB9477EAC7DBD92,0x881DCE9F5CC6E63D,0xA991568E6B32E3C0,0x33D2DF46D664610A,0x53F5ABB2B622D78D,0xD293FF93870C2F25,0x16E42DD5D39FF3,0xCBC5DF2006D81D1E,0x4FA20E9C09E8254F,0x44C3AAA7F831C9C3,0xBFB5CF9B6CBC1AB7,0xD1BFBB51B974ABC,0x70D4AC353CEFE914,0x5EDAB5E0AEEE0F5B,0x3CE27E8D04374C,0x7CA469AEF1A6846A,0x3DA9570D02211BCC,0xCC1BD9545F3C9CD8,0x5D2AD8B9A42194AA,0x69B1062AA5EADB39,0xC304D1A5A81A40CF,0x87852ABF43D70C31,0x1436C9C299D0C8,0xE479D42A3E801927,0xA3CAB10D70B96E0F,0xB0A32FBC34D06BD1,0xF26BCD4C0FBF4D48,0xC7754AF7EEF5D376,0x6C18B48F4386F849,0x7BBDA2E8E178C1F,0xF040BED76C12F,0xA9409264B2330903,0x80B9AC483F8D5A8B,0xDA0F86663A411452,0xF7D0AB4B979100A4,0xCB41EEEE48ED91CD,0x8A50776829EE293B,0x8010D281154FCF4D,0x3ABABDF460A80F,0xC9F1C4269A57FED7,0x6F0DC9304DAB0072,0x4F97F6B216AC1DF1,0x391BC04EEC5A489C,0xFA0BB33379421A56,0x5887AC868717A597,0x3452BFAB0B53F329,0x2CDEE3B3D1BBB2,0x5DB225DC4D3105AD,0xAD80B97D0508C1C9,0xEAB7BB05F8C44FED,0xECF60232B7A25A9B,0x1F57028428E0F747,0x79248BADF2834FDB,0x24ABC28DAA44C1D1,0xD67685A8977D4,0xA0245C185AF10198,0x47EE3FD204C3F622,0xABA4866D4F1F9EB8,0x679DA9EB1E8F7E24,0xDC3F3FFA0C18D828,0x7A17A586B88B16B5,0xE32567ADEEC42557,0x307216CC431280,0x69B6BE9C4208A6F2,0xF42BBA39E2DCFF33,0x27A7DADB8C76D89F,0x66300C740FEF644E,0x84582E10EFDCE866,0xEC5BDC65E72E572E,0xFE65DB9BD18779CA,0x80A23F60CD4CE,0x9977C9A0AB0E7886,0x6A8030C32BDB6EEF,0xA184C3821B7A5F4C,0x78B1050FD99DC981,0x1CB920F7CCE332B6,0x1DF04CDFDFCA9C64,0x509B84ED9EE7E05F,0x2E93EC7330C0B1,0xCAA9DD17ACA110DD,0xF52EC91DE31D8FD0,0x788FB547672E1F59,0xC49655FEE50B45A4,0x774796AFED844263,0xE175B22C74628150,0x2AC91BF207BCC903,0x3401D6D01E805E,0x23F9A38B62C91D6,0x988D55351DAA2A95,0xA8A3F8DA1475E86B,0xB6F35A094375B399,0x922522A7BD5A4DEC,0xF81398AAA29A0EF5,0xCC919742B01A8702,0x5207F0D766A45,0x1A3B9298B65704F4,0xE4A600FC4D9FE287,0xEB673510BB9F084A,0x9198EF5D99E4EAC7,0xE2D49D608C25CAB4,0x71C22349D9B49851,0x4C3B261B5A40AD3C,0x3EC786C45278BC,0x5D491D931A4A4273,0x363921EDE838331E,0x1AA31828283519E8,0xDF8F948768261B9F,0x7654252FBE1100C3,0xB9B61F7207C6E453,0x4AA9D70C589323C7,0x8AE6A5E5520B0,0xFCFF1CAF75495193,0x89C4C261EBE263B5,0xC6AF3E499F96FA8D,0x8C2AB722CCC9FAAC,0xC9660580272F95EB,0xD3F6BB610389D3DD,0x64096C4AE4E76A8,0x2CBBE04C5F2909,0x9841365DBDF8C013,0x2CFBEFA04193188F,0x68836FB43C926D11,0xEBC8DC11A7638832,0xBC879F0CE310B57C,0xE51BD39D770D5B31,0x7D57A92E717014FE,0x809B399896921,0xC23511CB0B0149A0,0xCB3A45CFC31DBE99,0x5EE449B4DD23C9C7,0x91045F54CA522305,0x1CF2796B2BD67BFB,0x45B3660547CF41A3,0x10CBFE32E8ED49DC,0x3EF6F5CD079829,0x46186E9B5218484A,0x37D3FAF196DE3CC6,0x48A8D797263B7C63,0x1A5D05F60E5926B9,0x8C8935449B4A1A46,0xD9B5E32D59720B0,0xC18C7436B046DB19,0x426D5B4B4E8D0,0xF24C0736C2366BE8,0x32B570EB0350A42F,0xE1E20FE49F9B780D,0x3CC1262FAAF6A388,0x45C57E9E86D97443,0xC9311B07B08BE014,0xB25A01A9C833D7B5,0x227020C86463DF,0x65BDD282E5ECBEA8,0x2BBAC4BB0C75B6AB,0xD4FBD794B02E9621,0x41A8930A9C82FD41,0x815199088872B998,0x1DBE5ED7957F5CAD,0x1148A902FB989F5F,0x28D58379AC1096,0x911ABC3D0947D3D6,0xD53CDB0EA3162DB8,0x87BB34A556062436,0x7910612336D3BD89,0x69474EADFE888610,0x2FC9B1F29278703F,0x66EEFA31A1A76FA,0x1DF60777CD8466,0x882AD58FCD2A671A,0x9B0050E2992B87CA,0xAA7D344AC630EF0A,0xE5FC8DDB48482A89,0x58324B740967A40D,0x6FC417D3E8980615,0x862F8C64D5CAEF0D,0x17F93D16F7E869,0x8D97AAB909B31F10,0xDA6FEA016015F1FA,0x3F2CFEF7CFFA05B,0x1F3787C172CA2C74,0x821C5B1E8268998E,0xFD201204FE45940E,0x6B144C7A98437A9D,0x2E523C72EEC5E9,0x87950241E3D865DD,0x6C5E31674F001DC0,0x5258374C0F7BC653,0x8A2F5209FF02FFB0,0x32FFAD62C0932869,0xA64DA950D591ECA,0xB661A87D08393C40,0x88F5FE995460D,0x180443AA1868FCEE,0x296D9AC168307D2,0x92A3E30DBC9F222,0x9E1B1BAC2F51FA6A,0xCA6FF3E5F9773A0,0xF65B59B04166E371,0xDE5D2A638ED9EA6B,0x339DC2D950E911,0x1999AFD97DA63E38,0xC88C99289340C9F7,0xD9954C330232C1BA,0xBC848BFAD07E71A4,0x8D126D0B99CC347A,0x28A6E85C65FB2C1D,0xA3637D1DA8FABC84,0x2D735307ACCB5D,0xE77E6D03AB0DD388,0xAFCC087A96EC7F80,0xC90B42ECD0C80EB8,0xD3C3693CA39BEC0B,0xF5EA6B3A953F4BDC,0x181FA098AB4B6085,0xE9F382C8E381AE02,0x1E25481015B79E,0xAACC698923E40DBC,0xF96307C23C1EE2B9,0x194FB9DC1ACEBFF7,0x6E149C8866318E90,0x1871A7FD8098A16A,0x2607AC5F531B5622,0xEC6EBAB0447C701A,0x1843F0DAE3C3E7,0x6CC317D9F127C910,0x964DDA9E8DDD872D,0xC7166854D54F58D4,0x8E1EAE5745F16CF4,0xAA49A4F4E11E4845,0x4318D22451725E4E,0xEAFBA5881044A04E,0x93C85C7DD2EE8,0x7AE77869A7C23FCC,0x3E588FC34CB2D071,0x3FBFE807C8B59590,0xB183A0528AEDF24F,0x68CDA0A96256CD29,0xE1F16956C96F674A,0xCFE1D96C69483A59,0x141F55B192DC43,0xA1E8A3835108FC29,0x79514E5E904BA9BD,0x9BDD7BB8B051FF80,0x801CDC1D635E4C5F,0x2AA2FC37ABD0FC2F,0xD3D5704F65F2FFC,0x92C2C3A24A45A299,0x25BF281389DF90,0xFBF0E914EC2DB34A,0x99A6C052EDADBCF9,0x328D539F66921B1A,0xB6E8444834A80ADC,0xE264C0A6EF9225DF,0x1E4B37DD2F635B2E,0xF5B818AEBCE1D64,0x290089494AF838,0xEE9D6E90D87DACBA,0x7B33728D3CCCE769,0x74AF4842AC936C74,0x637131A92C87BF64,0xB7A3A414EFE7AFBA,0xD912E4006E6E5B32,0x154D4544992000F6,0x365A5C15C0B90D,0x1DCA265BA7BA4306,0x8C439058BC5139EC,0x944DD9301C12ACE0,0x8FE33D4BB7EC8D47,0x8E778EDF9FB07960,0x709497EFE9CBFB01,0xA4DF115C7262E6E2,0xCCBCE6D75633C,0x24953948D2CB3000,0xBDF6A7D4D8BC5EF1,0x3CF8BC613216318F,0x24CED23348845D5C,0xC01BE79B2CA99B1D,0xE5389D5535F84A39,0x7EBF84FC3F43BE2A,0x390F17950CBA81,0x8CFB755FDA111A3,0xF1BE32896DA579FB,0x3A363213CD8E0D21,0x67807C5A5A133F4A,0xAB9B786AA606DDF2,0x4E87D0C1F9490530,0x29135F2955B51E6E,0x31D3898E745263,0xF884E266BFC7B1BC,0x710EA28B891F67A6,0x6173A18A7184CAF7,0xE18DF720BF7B8C41,0x6D4CAB929C342193,0x626583ACDCFA4E0E,0xAC544A81CF99A693,0xF08DCF277069B,0x4CC8930B5178151D,0x25F48F060F198B11,0xB96991E102D02A0D,0x390189FD4C4EB6E5,0xC1B4ED0DE624D2FE,0xC195326419256826,0xAFB3E0019D98AA43,0x3B26A30DB9299,0xE00E3B92049B02D3,0xB5AE3E60B8E27749,0x5500E5871C10018,0x39DF3D747DA0DF6,0x666B6AB7406DFCF4,0x7870D1538C8DE089,0x8D11856B2AE86966,0x3816D99CE0503A,0x712E29ACC5103E88,0x349117600F30D96A,0xD8CB63687978378F,0xDD2977DF9BAC040A,0x672005330ED84F6D,0xE2806491A947ABC7,0xDC0A293F21E6C87F,0x1C369089655DCD,0xBE8871E37A9F24E8,0x3D0E23F633BD6533,0xE6C6B256A8AE8A83,0xA340B22ED2AE319A,0xD863D753824A5603,0xAAD6F90B55146331,0x6752F678ECD934FE,0xFB63424D12ACE,0x8915A8826E4DB869,0x13B916469E1EC0DC,0x4E420CE0AAB5F085,0x21B336DA9F7D929E,0xE3B3FA024E6FE6CA,0xAA4066391663EAC4,0x8572F02505EDC5BF,0x26565A3BACB17F,0x8ACDE23E35AEB8D6,0x34086BAB42EF5264,0x2452CB1A993417A7,0xC8B04650ED78CBE1,0x5D15C5A1A1CB35CE,0xD20A4F4EB2385A55,0xFF200D0CE6BD1E86,0x37832B2083E8EA,0x9DD6A126379870A3,0xCDE71BD7C9F9AF6A,0xABA968F82186BD97,0xD10C2EB3B683F2BD,0xB83B6C5B7C2EF358,0xFBE444DCD1BF8340,0x4A2E2ACB53085804,0x51BB98F29506D,0x6D9843C79B7D4F68,0xCD9B738E14735D8A,0xF5BD52F9B5EF9F7B,0xB0DD78F053C45A47,0xE41FFBD555726BE9,0x799887A54A03BD5D,0x27C1B3853A513DE0,0x3D970C7907395D,0xD28F963EA3EC11F6,0x2DA4AF120A5FEE60,0x57BA4E7A5D28F3F6,0x93B8FE77EEDE5BE9,0x758A9644FE8EC43D,0x2FF07114262DE716,0x5310BC1DFB772C65,0x30CA809156FBBC,0x5057167784028601,0x97D55AB3BB03BB8E,0xE89B568A73ED6881,0xD061950253846E31,0x79A7885EAA6A2806,0x7FD9D5E12A845109,0x86E0E9839128A768,0x3BA13D1D9A2460,0xC21DED107DDBAA11,0xA3CD2D8304E1462A,0xC9C3FC7AF78CE496,0x272C554F8FCE542,0xBFDF04DACCE89327,0x590453AC7CE650A5,0x690ECFCE3C0A7F15,0x2298AA997082BA,0xE5E9E96C22B7C8C,0x3CFECFFA49637728,0x6B4044946054F22,0x45A09418C2C15F71,0xFA8D3C5B6A71D1AF,0x834B24F9910AFB26,0x34C3E4C7E85A985,0xA6B6D550E9638,0xD58C2CB68598EB53,0x3778DC8709781D1D,0xC930EAD8AF0BED75,0xF100B14C243E1FB1,0x5BC6CB535EAB850C,0x89D539C5E54A6D1B,0xD6E440B2079F1730,0x3042438B879A25,0x18A20CC25ED8BC09,0x26FE76E7D7DF5451,0xEBA4ED6E24C59F1A,0x743BC921DF3BB529,0x47C4960B2C619428,0xD84B06A5EF950B3,0x9B74A5C46B1104DD,0x2B7BB5DB929347,0xECA55F5378ED457,0xB7B0D1F1CD2A4C82,0xC49693C35CCF61D4,0xEF7AFABF8F12DB5B,0x5C0AE7587F9F438A,0x82DC3A586FE6748D,0x7B842ABC32B42C54,0xB140E9D6FCA59,0x5E79F7F012B88504,0xCBB59617454D572E,0x12299F0C23BEBE91,0x2F400AB62433AC9,0x7C5E33402A015986,0xF94DE37E46C7D9B7,0x1911934D16B7938E,0x36E503BA843C82,0x987C644447AF8B4E,0x90730832B621563B,0x6774F033D1421A44,0x15F1A824CFDFD42A,0x33A3BD40A68F0B0C,0x7695797554C93654,0xF55C1C10C6AD458D,0x1920938719D725,0x2C741869A3237A64,0x34D0876E2CF1EED,0x4BF231B1B00B9900,0xED76409F0F5B7AFF,0x9EAE89B71C3A10EF,0xAE1DFB154DFED2A0,0xB159C1620B45546,0x3C497AB92DA95B,0xD43443784BB0AD2F,0xE6A6D7D4DFBAC459,0x27869B48D39891E0,0xF9BA7B46328DCC16,0x9BAADBDEE6AECD59,0xF5422DE005B2BF0,0x28B54E7F844751A7,0x2D507994531FEA,0xBDA89269AFB021A8,0xC0E3CA55B0F5E79F,0xD9A203FA164A4E2C,0xCF6B6CEB6375B9EC,0xD3FA91192AB616BF,0x52F6B4FF81E0677,0x96EA58555D901CD6,0xF759A9E051892,0x825BF45E2694831D,0xBFBB294017B1747D,0x2DCAE8A386A66879,0x4185C1FC450CB513,0xCFD2E388F447BD28,0x279EDED8A0DB0506,0x173035D2353D2538,0x1C889198D8ED42,0x911B936F7254B1CF,0xA38358A5CC92C181,0xB2DFFDEC5022094,0x8A086FA3701FDB0B,0x3EC31492D0E920AB,0x41DB9B6AA2DE749D,0x7C472C472F3673C0,0x2A89F6E7C3D0E7,0x1BCBCAC4C6F07A23,0xE82DE677D975BC21,0x368AA2C8D88F55F8,0xDC9C57B6E0FC8984,0x6E269E6BB0C7D78E,0x2B7ADABA536F62BA,0x726BDA61C0D08D9C,0x3214D19B70C089,0x24DAB31322D1BE66,0x970533B97332C4D2,0x5456E354F7C448C6,0xD8160517CF0AC325,0xBC5964A09978BABA,0x4590751D5F01FF77,0x2C5B62EFA4232318,0x12B1C6235FAE7A,0x3C6B20F2550C5E29,0x441FC1D409F4AD9C,0x1894D1A0F0598858,0xBFB4280AEC4A6161,0xE0F5F229DB3D748D,0x25CCF686B2136DF0,0x7BD2D059DBB3D0F4,0x95A01222B54FC,0x17C2D195A8D0CB7E,0x45E0539AAF00B8E6,0x981D3CB4AD015AAB,0xA364B7E3BBFFEAAD,0x706E21029D6EFFA4,0xCEB1738A77D72DA7,0xCE2D6B9B6A260BA1,0x18EE971BDFE812,0x393869B42223823D,0x486FBCBE823A5667,0x406957A212EBF7EA,0x10FF8680CCA18FF4,0xBE2443862500E9D3,0xE6683D6920AA5B84,0xA95710B3BB31BD6C,0x2AB6C0A5FDF8A8,0xCD77FD87DD38154E,0x649488AD3BC8D8C1,0xD054B6FAF29823B5,0x3AC160D13332B2FF,0x425AA35D36206526,0xB872F431077AFAC0,0xB880403468B8A2AA,0x393BA6D3991384,0xC7535A87777786B9,0x8F3D41EB7941AFC9,0xC7230E448B3EBB94,0xCC60CD278A128BA2,0x819CBAA128C380CF,0x99E0A764E2ED4449,0x56059B47BBA72F6B,0x25A32002F9137A,0xC52E887201B4404F,0xAFC1D38BD362330D,0x6F08FA5500C27AE2,0x71E945E56F0E4989,0x1F6E6DD1D0F189DA,0xCC3372CC9A9DB9F,0xFFDCDEFADCEC6117,0x31BC87395C1AD3,0x64E816CBCF5EDDA2,0xF0673280D6F3DF5E,0x5149C21300493F55,0xD9EDD97E983DEE2A,0xA251A34209DFCDE4,0x38A7CC108C6D1301,0x92B326F7A23473D6,0xF175412B172D0,0x33738F7C3791035,0x2761EB2200C76E1C,0x6BA56EA018EB8DF4,0x5D499D7FD59C2CE0,0xC9723DDF1CBFC3C7,0x51F51212191429E,0xF6DAADCEBACE2D6E,0x30F60444A250A9,0x8DBCC21493D6A4EA,0x6D798AD3976BFAD7,0x511C104ED02DDB4F,0xE26A3EEEA774D77D,0xE604DAA8BB3F1D87,0xA31DFB7F78BC3533,0xBB0272BB4DAFE205,0x2EB28A50BD4447,0x206D222BED76C5AB,0xF42F80C0E713A80B,0x31C6AA1D802A6BDF,0xC53E51C61FFDC8EC,0xEDAC124C50DCE71D,0x4DD79B58CFA97AF2,0xB23938DFD9E257E2,0x3BCF97385E9B75,0x870F765C59960F67,0x7B63B6F780EC734B,0x696959EF8E8215A5,0x5F8E8EEEC194F2ED,0xEA7B7E0CE72299D,0x47374C9B14E51931,0x677CC6A19D6E74E5,0x183C99A84F4964,0xF1C3D32E8F17CEE8,0xC6924B912B29FBA,0xCCEBCEAD5438DB37,0x8C89521F3AE6CB29,0x4E53613DC3C1F64F,0x11467D62C5B6EBA3,0x2ABF6EB0C184B924,0x34CB69278FB60D,0x699D8BAD05AFD584,0xF8F9259C062347F1,0xDBCD44A7434EF698,0xB7864C86A304E27C,0x664B8439C4A8ECBB,0x4FB8AFB0633669D6,0x5A3ECA535E6C5CD9,0x3335835C0E0A9C,0xD385E0AAF74A4B76,0xB11E8748D54C37BB,0xF55B782FC9753916,0xF813088D30F43460,0x86485478760E36,0xDC043F80A0BD81A1,0x4555AB8943D67A9B,0x1B49BB1AC5532E,0xB859E4ED1617827D,0x8DDD93FF6BCD0246,0xA5F91F431DDC11FD,0xAD3512FDE4B7E026,0x8FA3BF51AE204EB6,0x772952B924EB6F06,0xA6C866A2D725DF8F,0x1ABDA738C4FA2,0xE07CDFF36A7F394B,0xDBCCBED6103DCE11,0x87E04037206695C1,0xF67251867D8906A5,0x72E203F4D4F3F9B7,0xD409185F39A6A356,0x89C2AE963BD1E440,0x12E8956884032D,0xA0EFAE6024C6B994,0x77E3A6BC994BD967,0x51B007BAD4051A94,0x20394C499418611B,0xE324A7EF37FEC2D1,0x14529B9D7CB66DC5,0xAE7B845B48DED65E,0x2F6D14D1B87F21,0x69CE1580A89DA45,0x2D605A873FA10C0B,0x5B6EBBC8542441D1,0x7D6CB975F25B697C,0xA7EA233D42B0FB3C,0xE4B1711D5FF2ED47,0xA56CF54B0A71B9E2,0x3413E57525D2E5,0xBD0C5872027BFC77,0x1A847A964EBADA81,0xD75427042CC80AC0,0x1AAEABD99AEB7CE3,0x446D4B2856B4FE02,0xCE20D6A62C1B6843,0xADB0669A2BED82DC,0x2881C0BDFAD1BC,0x2CF935814499590D,0x8B18772EEE3F6C73,0xA761D6DC5A9DE82,0x775A8D082DE6127,0x597993648610A93E,0xBC4B1040EC425C2F,0xAE791FA64AC01BEF,0x3A12681F6A40EF,0x2AF5FF9A63653F4E,0xC65C573EC0377027,0x205AB74E36757CD1,0xFB1C9F53DD31A771,0xAFCC0D75BF42A36D,0x16B3089997A93395,0x515C7F3EA714B19,0x3AF890842AF4A7,0x762A07FC1608652E,0xDC2C769DE8172C6A,0x56857243772906DB,0xD4CE4AB6ABB55018,0xEAB153F490F65196,0xE0A89A385B513A86,0x316FBA30F97D90AF,0x49FF4ACED3188,0x28A23B79FBC744D4,0xB6BA938772A64D26,0xE701FD579A32A2F6,0x235FCE25292D854C,0x96C65877A8936415,0xBF476CC1FB270AA3,0xBCBEB88C5924BD8E,0x22690DB9327B05,0xCE4E0C65C5534F32,0xDA94EE5E95F293FC,0x145FF4970E194DD6,0x6F4C11F3D99A59D0,0x70F060C37DEACB57,0x9C5D8979F74BAC0D,0x1D8516AE1414ECF7,0xE69A491A3CA78,0x592699C2A51122A1,0xCA4717A06917002E,0x311EC08C17270148,0x2DA73D08F86C546B,0xE453191D1289955E,0xC3C13C9B206503A8,0x1FCCD4AC54F083E3,0x1E578C9F3C78FD,0x7CC32FE0AF74F346,0x598F4219EF082C39,0xBFFF564E25E12B47,0x61127321DD5C4DB2,0xE2DAC1BC97FDBD9D,0x57094593D7B98FA6,0x4ADDE673E347BF1C,0xDA67F34D5CDC0,0x71A333E832DB7D2B,0x1464150F37CCE575,0xBE6826284B6A10F5,0xA75C557C3496A273,0x5DC9759EEA0D915F,0x341F4DDB6551A069,0x2E10F6C4FA861DFA,0x27B75F4EAF4984,0xC50BC8572E33AC0C,0x2301F7829A48F9FD,0xB850857F9F518521,0xB8982A3244934EE4,0xD29A1FB87993035D,0x87DC4F3D28B801B1,0x498E5077CC8B0A06,0x1E8960991A51A1,0x12F3D39C7AB080A6,0xCCA1CF5ACA80C8FF,0x4A6CB07CDCB3BAF3,0xFB19DE2D732212EC,0xC2585667EDADF282,0x64023B41F6628205,0x8FB134BD23B93A1A,0x277D36AF6C31EB,0xB0BDE2DDA27613C3,0x706015C7B426017F,0x759B6AB2A364971E,0x6FBB593A65CF7880,0xA5D3D85320997F58,0x4C7413E22C4B8386,0xEF2CF4735E39CB95,0x38DF32776E4FFE,0x51A43A805828982C,0xC464142EAF24064E,0xFA08D68E761E2D71,0x77F207FE636540DB,0x54D133596E6373A2,0xBB258830724F0981,0x3DB5CE617D36B83,0x2A9C33C582D6FF,0x82D5EAC6FAF69924,0xF482193EC51583D,0x4E9E0446371F8B59,0x8CA1B7D9A6CBB878,0xA4ABF9569B44EF8,0x98EA410E83B8D2C3,0xE80C69CAA8AE5B55,0x207ACA6A2F10E9,0xCCD284ADD1798D20,0x1D7C78FF68FE43B2,0x67D900D1690FDFF4,0xC6BD1CB0F9C2A349,0x887E47998349AE8B,0x16CFC96FD51EFAA5,0x2B287F146B2E8570,0x161BB1E4B5A6A,0x5C9B331BDC64EE46,0xCC98F139140F622C,0xF2F4DA98A86B9CBE,0xB88DA1D9853F8008,0x3B8007F9C5C9CEF,0x480875A9075917D0,0xDFD44E4B4EA88191,0x3D29EDC19DEE49,0xCE291D265B903CD5,0x130ACA97AE662178,0x698CC8F219EA4B7B,0x74469C1C4DD8D421,0xFE564997607C962B,0xA594D465EE97F11F,0x3CA4DEB386D7A972,0x15A7BA6BCF727F,0x9C3EDB44396A3BC0,0xF1BD62D1C1241627,0x64A57AC9A71F8E3B,0x93DE105970DCB223,0x94CE2FB15C62F771,0xB4E36EE5F774D8,0xC9D057214682E3F2,0x28511363F3706F,0xE897F5602C6D2C99,0x12768AC1A8A86ABE,0xB6932202085278F7,0x98518C4EC5422E8,0x5EEE8720A94696C,0xA00DF6949AB37057,0x53344136F856BC20,0x27D94B15E32713,0xBBB394241231EEA2,0xC5E3B34AD80C5886,0x146327F5D1608303,0x5729AA5B216EB051,0x5492A22C20631C0F,0xF33F33FF0CFF6226,0x2E47F5D1A1AED302,0x1BDF364BC5A6F8,0xADD5F394387FA3AC,0xF8F7CCFA5A2581C7,0x49B637D5862BE25D,0x80F0D2CCB96F437,0xF382EB7423E0A2E4,0x89C044824C662FF3,0xD20E1FC0F3568FE0,0x8512FF4A4FB89,0xC62291B26C26EECB,0xB2809B76E3995FAC,0x1C8247719A140047,0xD4869CF29168DC8D,0xB124EDA899148E72,0x65DC1678C6DD97A9,0x4A2DB6D241E30A1,0x762AC1CC920A3,0xCE1DD3A62F3961A6,0xFF3ACCE2ACFE3E06,0x3809D778BF3C5BE8,0x7ADF31C4C575A295,0xF17EC68405EB9780,0x845A8F8DAE8EFFB2,0x34364B474CCE340F,0x39963A52E1A73E,0x6FB94ADC16CBFEBB,0xE925E475694967D2,0xD533CE019BC829BB,0xAE7F9EF9794C7F2F,0x2425A81825F19EB6,0xD7FC79E36088FC6A,0x7144940C5BE028F,0xA26567328013F,0x73ECFC003C27649C,0x6AC063D1F364301C,0x414A736A4E114DEB,0xC9EE82B67BBB37BD,0xC713A8DEAF8D49B7,0x6009C29BF9DFCD18,0xBB618270A5E3F5A7,0x211FB0FB35700E,0x4AEA0009A1B26426,0x7DB75EB28ED601DA,0x113350015D407556,0xBE31DA877BAC4D0A,0xFC652B4E474AADC1,0x505DC36D4123D684,0xFB7C448F85AA798B,0xB5F2B7484FE38,0xA574C1F09CF780AF,0xFAE7E281F6CA70CB,0xB48DB6226ECFD3ED,0x1AD142E50530FA72,0x977A6E915F36C652,0xDF018FA37DBBA67A,0x9C35E083EF932D62,0x39AFFDE8FA83A0,0xB065EC63161D648D,0x5321843D8573BF0D,0x9A78E9F88E39DB15,0xB05BCF41A442310,0xA9F0A3774C4C7817,0x5C63545056CAF5EB,0x9504A13BB8338D7F,0x3C2D80E80F7892,0xC8A995891E2C4124,0xFBB11ACA300F6141,0x8642435215FC316F,0xFA1F290A5BCF95B1,0x7CD4471213C9490F,0xF85BA975CED6C43F,0xAE0235A12BDC13D6,0x1E39B911C2AF18,0x5E34ACD83FF64307,0xA6340BA69154E74A,0xF9A04C95BF14299E,0x88594439716E3E34,0xF7D25ACBFC818B75,0xE6CACD089A5BF58D,0x9F9F088B558A303A,0x3D4C8E79D73105,0x41AFCA9F2A0A89A4,0x9161DDF2B82873F,0xB4093EDEC118252F,0x86079F48031AEE0C,0xFF8E8F4CD969AEAF,0x22DCAC23FC5EE602,0x279B52256CBE4669,0x2CCDC17D9144EB,0xFE9224789015A429,0x41DA43D4FA29F924,0x3FA77D27FA767164,0x93480C5CD9F3799C,0x7BD1D2DB5ECE6A20,0x9C5E863B7ABCBE47,0xCC9762B6F03A4C18,0xB5360F0864F15,0x978DFE869F183C91,0x86E53D81BCD7F6FB,0x551834DD869FEB39,0xB45E84B6D66C574C,0x103B03DD960FF4F9,0x3A2C8EC5B19AA52,0xA1A90E12BDBC1FBD,0x385CAF06527AED,0xAB17CBF38028B2DE,0x442B7C91197959EB,0xDDCE288F2C539173,0xA44CD0A2D4986CF7,0xA465C095187387F6,0x417E2459FACA7CAF,0x1AB379DE3CF5C0B1,0x27B556B5FA60F,0x4FFE9301450CF411,0x4857753DCD2EAB31,0x72DF69F01736272F,0x42C2040F2AC046F4,0x2BFDDB1573E8C9AF,0x7B3E821C17E092F9,0xA2AF8841821BB169,0x9B4143B8F4126,0xA2593BC96773D233,0x60D7D297F226584C,0x2B54A8B9F96B406A,0xF8A394CC60FA2C99,0xFE390DB14EE02434,0xB16F7B948EA2FA94,0xDB5D523FBA9204B1,0x2600298FE29A7C,0x331385057001718,0x5C9770F18CE559EA,0xE8971D8008A7DFA1,0xE2802DF8C5129B0B,0x4E7B1A9236D3A8A8,0xE99FFD66F140B35E,0xC3FBD9566E5B1AE8,0x14BDFE149E795E,0x4EF2127106E1746,0x5EA024E268176640,0x628B7F8D045D5CFA,0x584AF9368D16B9B9,0xE10E4CCB7674AD65,0xD75BEDAB921C7623,0x20B43232A06D5334,0x69411DAB48443,0x339799222E1152CD,0x8D6D96C60367038A,0x8E89384198DCB43B,0x24FA1CEB0F2B7161,0x9D796B086B97E0DC,0xCCE660C8CDDBBFB2,0x612B77AD863F1EE3,0x373DF8954E6AC0,0xB8F58702317D210C,0x2376B21CCEE2CAE5,0x46786EE79196EF48,0xACF0CA7C83540789,0x95A094AAB344CB67,0xCA549B467574C7F5,0x1277F87A030F4DE1,0x2257DF5AB78BBF,0x6C61946E1D35CED0,0xC00444001C5BE795,0xF251AAFB7281E5DC,0x44409692DAEAE6F1,0x5264BBB2F9DAE85,0x93E48326C2F6EC06,0xC0540F73CD85814C,0x3C2D8B51997716,0x75FAE0E6FA36573A,0x986FB6DBDD99CC86,0x1921D782B9F9F36A,0x188E6DB6C603E377,0xB94D7E24ABB2DC44,0x7A9830FB52CFF433,0x44FD64CE6E77191B,0x1D9D2E2AE5E8FA,0x3FFAFB22946706BA,0x845F1B3596E83357,0x66278A06105880C3,0x164E044FC2E26C36,0x2A4540E8D79CA474,0x6BDF8C59E80DA2FD,0x4CE29763942047EE,0x31A37646FCCBA2,0x8A20E9AB6122DC0E,0x13D63D32C6518CA2,0x443F24F7966E4B9A,0xA0E8E5E0EC2F6308,0x44F51A9CD8D9DEC1,0xE5119EF2079BB633,0xB20E6022C1E0DC8,0x4639DC2E67B53,0xB081A5357A846A32,0x400B1E685028036B,0x5C26809D20650FD1,0x74E812FA6050B4F4,0xFFF6009CAEEF3356,0xA0B406993A35CE5C,0x41CD56EC1D44102E,0x286C5B84BCB768,0x402A2328072CEB97,0xB303E834A4D53C6A,0x79C2113CFA103475,0xA7A5D3FD910EA09E,0x590B8E0D7CFC5C32,0xCCF9ABD53BA5FF3A,0xC1A16BFF6D162E28,0x3AC70D7B10532E,0x1F80BA4B9ED56DE3,0x3EAEB3D49B0FC57,0x2AA6CB67C564281F,0xF7EFA2A07D6C6899,0x7760E793A8001610,0xBBBABA1C793C7CF4,0x9EA5A796F6054313,0x1927D0443B3C9F,0x92C526304B61C51E,0xC0DBE112DA196C16,0x319C1A64E9FFB740,0xCBA6A49CF3056F2E,0x88D1EF33387ABBE9,0xF3BC2910C53616E5,0x229BDDBBA574657A,0x172879FC8F7FEB,0xBB560B2A77D8C474,0x7C4B6B8610552F31,0xDB71F83743597135,0x10D009041549F2C9,0x7CCDFBCE4942003F,0x7AE0706528DF9BD7,0xBAF6CD458E75A7D5,0x1F104867F1F9AC,0xA7DBB0C23BC365D2,0x1635D395CB672C10,0x7BF4F93715F2CD98,0xBB8C2F12809A7C5D,0xC74C9174F1E3A271,0x90564F286915885C,0x31A109A8CAE63451,0x1BAF09ADCA52C6,0x1FD7F100C1726FBC,0xFFB23B3EEA119C84,0xC0070295404DFF24,0x6394F2CAC9242C19,0x5A8801ABF3010401,0x8230BAAD658BC251,0x8FC0B3BD2D045FBF,0x13622FE12C17BB,0x3614361EC22D4F34,0xA938FDD19E30C032,0x549C3543AE2F074,0x54CD0FF691864784,0x4FE7F77E49DB0653,0xA55386C52DB38938,0xDBCE9731B41661BA,0xEA399DFA536,0x598B54417461D6FE,0x909D44199FBD96DD,0xC6550D8D7097233E,0x25D1D1DB773417A4,0x2661CED36ABAE766,0x8ED252D0F810E9B5,0xDCB88F8132C11335,0x3B7C17B859DA38,0xD95C69ABFA6833C6,0x16C8CBE8243D2531,0x46EBB7321379FABB,0xDCBF83C043CFBD98,0xED2C9FD6641F12FE,0x3C2A47128ABAF36,0x7833CD4BDD2A66FB,0x42016BFFBF3A1,0x7FA7D8F78E818E99,0x5AAB2EA058D9693B,0x90D6BC91E0288A9,0xD41E33F98D28877A,0xA3C2C1B60FAF7D64,0xCAC9F24D0CF2CC83,0x9C5B416F8C55D90D,0x402DCF840923A4,0x93650172A8556D16,0xB55F1E8F1DACA8D7,0x942EC3C4FEACD107,0x687B1E59D8F6067C,0x58528EB64F424587,0x8C89D8683C6C7CEE,0xA633D2ACCE2D86DF,0x1A1270B8A82059,0xD02556B100FE41EE,0xBCEC58293C283E3B,0xB33CB18F0BFE0910,0xF63CCC574D58A3F3,0x2DD4F787DC0E14A5,0x38AA29519E2AB9F1,0xCA8A31C330A6A224,0xAA792B7ED5688,0x66B3729006FA7EEE,0xF689C7AA7E9D9002,0x8BCF75212F863A2D,0x38762D684F1A7EDE,0x9A8F2562AE116821,0x8999C98494C8F4B2,0x9B8FD83579FA31E8,0x37D7255796039C,0x63D5AC72F920C85A,0x6211DA43DEF323DF,0x80E1891219F7A912,0x6F2A591B700D265F,0x35A70A1DFBA63A1,0x8AC5655292719100,0xFC59DCC413A28718,0x2E243079A0E9B4,0x35001DE2C42798C3,0x78105369303B009,0xC54F81D40769F744,0x6689DB0C7A5F74EA,0xB2050AB2AA1B376A,0xB097C6EF8CCB591E,0x4D2C051D4DDBC0F5,0x3536A142C66F2E,0x578EE86BB32B3BFA,0xA6E62E6CBEF59C52,0x4F5BDE6BD7D17FEC,0x6C4577625E75CB74,0xF05D0E6A58E1A597,0x288F1ED71B49F9BF,0x5FABFE7EDF9AFE1B,0x92A1DBDC5DC1B,0xCBBA574C67490AB4,0xB0DC41376BD70F79,0x3C8AA9192FAD60FA,0xB6D138512955A9E9,0xA23425FE028C49D5,0xFC9EB6F9A4E77073,0x73D435FE96EB496D,0x2BAFCDEDF1002B,0xFEEF2C0CA6A08E6,0x8D0D6CF348D00F42,0xE03D90C2090D29C7,0x9A172BDFBDCD0197,0xE667AE1240A6AB0A,0x3259A671429CE9EC,0x260A1FFF9BDF1113,0x3A9F45739B8DA3,0xCFB0DE41BF164AE8,0x6AE58588E91CD291,0x16D7EDB08217542E,0xF1B7DE26279DA3C6,0xB5B7BB770EE66F16,0x2779691ECB956D03,0xFE862E797FC2821E,0x146ADB1411188C,0xB38504BB705E5681,0x7947C2153CD3C14F,0x63AF3AF4FC51A505,0x9DA63F96827A45CA,0x61071100F3B2FE8D,0xBDD2EF990021A2,0xC2A89507A20D43FE,0x3D26439AB8463F,0x8C9921F3BA597B94,0xD3511CB912623129,0x446DA2D31CCE06F0,0x5B867B93250BE715,0x77478BDA7540260F,0xBF5153CDA0DC7AE3,0x30FFB2132F4FE3BA,0x3033214C2353BC,0xE90384DB2688571B,0x285B7385B243BF83,0xC685B966B0B62108,0x21B1A70B505524D7,0xDB9C9E7DBC67998D,0x2157171A7AE39843,0x4A56A1350532016B,0x3E8D95716AA843,0xFAFCAA637C6D0CD,0x1D75D11FBC26DB35,0xC164744B5CC34DA0,0x20ADEAFFE6549CEA,0x9356C0F8410E9905,0x4AADF9585CB77D18,0xAE2FBE21EF3BCEA7,0x69CB415BBAB98,0xDA25D599F152C4B,0xDC6FADD653DE7995,0x71C0545A5173649D,0xE674C0DB2038C5,0xC34288547CCBB67F,0x8A43EED264787C2D,0xD6D45D2D8E23E8C1,0x1B066100F3F301,0xD26264F455FFE999,0x4D4D364B47785E2E,0x6C6267A2C2D89443,0x118543F57FB61DCD,0x6CA03B96F3F405A5,0x163AFC39EDE1CF2C,0xAC86B3C93E78B081,0x1FA751ED2545EE,0xCD7085391F7757F4,0x8EC6E8361BECA34A,0x414DCC9C6FB0AC72,0xC8E5CD6673773091,0xE6DCE79C4E253AD1,0x2A0CCE75EA565BDF,0x15B4D5A0524CA3B4,0x3EFEFFA9F2A6DA,0x1DB82E967588A29C,0xC4F26B4F1CDC4E80,0x187B4477ED46E6CA,0xDB52DCAF93513466,0xCCA6A8A5F2AE5CFC,0xEFE622F9944CC698,0x203FC83F342F196B,0x2825039E3B9368,0xE67D0135DAB9688A,0xC9C779D9B0B1AF37,0x280D36525563CCA9,0xD3F5214645DBD3B9,0x6C61942D48FFE8ED,0x8DF658EED9C8BB64,0xF907DFB1FD1A8026,0xC2108D6751795,0xB8592C249C46AEA8,0xAA2F0C336586F08E,0xFE85BC53627CC303,0xEC32BAA2B83ED392,0xB949B5126D206544,0xACC9B8488E18B630,0x2C6E6BC39FCD6E9E,0x19725D73F8A7B9,0x7EBA7B3F0FFBC809,0x9C8356360DAE56F4,0x2BC61C9443037970,0xDB3B256E086E315F,0x53AF7D4338D9E818,0x6DBDDCF016519C09,0xEF32C66519DC6B74,0x281AF69F796A19,0x88BF5857A9B762FA,0xB5E2D97802833D87,0x1D22495DA0BD6499,0x9CE21030A0FD4AD7,0xD4C87C95E99E38E3,0x6AE22D0C896494E1,0xA726FF8C6DB10EB5,0x3304E9D6986ACD,0x6CF4897C37757177,0x8482F988ABA69088,0x4CB82F2D51B297EB,0x93CCD9CD6850D55C,0xFBD3898A7A799A40,0x797285227936B606,0x9DB7B5204D7F8E66,0x2752E91D0924FF,0xBD929EAC65DF38FB,0x115C8FB142758C9C,0xFAAA93E1678BAAAF,0x93FBC913500F90F8,0x940926DCBFF399E4,0x6BB7C32905BEE2AA,0xE5FB0439660A5725,0x24308873438460,0x53644309F7A1027E,0x80ABBD5FF1E75AA1,0x7E946957DA4AAC50,0x2820E7DAAB1FDC68,0xACDA87906AAE5ECA,0x3DD0A232BF495133,0xD0C962F460B6CCB,0x1043EEB09684C5,0xC2370E6588B8F0E5,0xEB41DB2CE545936C,0x83A4E265A55D4221,0x91937A161F83B8CF,0x304789397F9EF737,0x22D24BCB22CE7658,0xC817D79DB3639F0A,0x23BB34224863D8,0xCE4659B5ED586CE,0xC4A584979E79F813,0x4AAFFBC5683D7D57,0x7F44FED9C1DD5890,0x7AA14E95972E6693,0xEA290F03E66799BB,0xD191BE13A3DE903C,0x3CF07C782D3B4D,0x3D325FFBC58622EF,0xC0E68C0C68B94802,0x2E1A90DBCB918B81,0x7F479E7D1285C10B,0x80C5A3292A1D6835,0xB498365C0CA62BFD,0x2C5DFAB514D418C6,0x307E8A15B076A9,0x4C26FDF1703AF009,0xC289F40DA85701E4,0x9182D3F185D6E391,0x828512815622A56B,0x445481D9312CCFCE,0x7B86A54359382D6,0x7D9625785CF82A17,0x124F16BC9027D4,0x156C328A6A9F8B3E,0x7794B25B8534F6E8,0x4ED0919E5AA450E7,0x2032441B7418F93C,0x956266CAF9D815D4,0xC28E620FE685E7E8,0xCA1AAEFD6F61271F,0x3FEBAC9B4D7EFD,0xC2EAA77F7051D99A,0xBFEB6F635C464102,0xCD110C7C676E5085,0x6A81DD3E10F23E13,0x890DEC5BC79FE03C,0x7EAE9DAC91D3A08D,0x98C59EA49C53D613,0x24B5C1BD085602,0x2E783C4AFC062097,0xACAC716D57670FA,0x3C0AE6BC7BBCEB71,0xD06BDDF2A112CC8F,0x7DA5A4E58754DA49,0x9719FFA56FE883E8,0x2ADDFC42E46DA2BC,0x2C4FC74F7E6213,0xF43A6F126B20B7BB,0xE8E05CB8E47C2F3C,0xB721ED9F896D39E2,0x548008AE78B3BD30,0x1C2DB2CE81A930ED,0x5E25578DD7A596,0x497E3140313290DD,0x2297EC987465C4,0xB9A2DFB6CBCF4581,0x93381DD04FB7E623,0x5D5EE3E22AD7536E,0xA66AA44FD9FB4462,0x50F4179133496540,0x109631D3948BBB2E,0x7EE1A89CCAB30537,0x35B91A07DC794A,0x9D026F758958B27D,0x4944F9A9E291CFDE,0xF33426241F9ED783,0xEFF33C26B6977266,0xF86C0D48854D91AA,0x71BB77F2E5DD8821,0x17C8B6A86F134A07,0x56E6377E35B46,0x87B2030E67FF9E3E,0x4B5E19BD4317684F,0xE333D86BC856A93B,0xCE8F148A1B92BBC5,0x1CD11530D6F35F27,0x5871D664B8E78347,0x374E43A073F344A7,0x13C8CE5C392FC4,0xB04C0EA2D74B3DD,0x119A6A7A35259BA6,0x976E179BA71F8582,0x1977D0C8110C4350,0xB553B36A4FC252AC,0x7AE8B4FC5F9B4239,0x1F71BE47B1D55D7D,0x2C5A4383D5F387,0x683BFC771650849F,0x3459EAAD0A89D33F,0x80E165E2D837F208,0x19A95DBA12A2A853,0x5214C5A8B877F305,0xA1E8E0FE668655A6,0x37975B64177DEF85,0x1D0E255D2AC270,0xC25C38108937756A,0x96BE8D31E5D9F956,0x45481DB4CEF60E6C,0x6CD0FCB3EADD3EA5,0x86653F8ECB56CF8D,0xE5CA5EDCE015BC92,0xBB16E6588B18D9C5,0xF3048440FD3E0,0xB163776FD46D6209,0x706665E47B9B86BA,0x879ED3145B55ED59,0x532C4EAB7983D562,0xC0B42CEB8A3D0FA5,0xDF85476923786F2B,0xDCD888866B758B2D,0x6F36ECBF57A14,0xDD941AD249C3048,0xB748C4768C5344E5,0x548327A7749E467A,0x68A8C851AE6576E0,0xC6C0269CD1A67497,0x69334379748B28F5,0x5363727D73DED11C,0x337C893054340B,0x8B921737B438A951,0xD071AB1EB310133C,0x6A7A42D7BDCBFDAB,0xA0D398CCE6AE3CB9,0x1997E3D865793E2,0xB8FF767DFC52CE8D,0xA64A94ED054E6689,0x2144F9046FF17F,0x8CB4969D2435D1C1,0xFCB307ADB6FC7F3E,0x630086397114E185,0x459C5A99440D018C,0x8504C6FE1DD9863C,0xB1B20D717A548014,0x81E5DB4C264AE19,0x2FDA2382847093,0x235C8412F81915EB,0xB9B199384C453665,0xACBCF109AF8B2CA0,0xE90EE478ED90C81F,0x6FFD23E8CC08905A,0x69D37BDC75370B38,0x8CF6612C24D658B,0x114D5802069E02,0xF8D09424BD124A7B,0xBA1033EA4E288D97,0xF0193276791E884E,0x7412186955F6C625,0x6F72833FA6F54561,0xEB7AA813558B939B,0xEF4F1A6B67F55157,0x524920EA37E7D,0x7C4F0A668C8543BA,0x88373AD1B0F5CA59,0x7FA1CFACE29C5218,0x14B860D092C08666,0x8B06D8E0A36FCB02,0xCEE7BB8EB73307DF,0x8AD30F92A5F40AE6,0x39C152C98F3C58,0xCFDE1B1F1104AF08,0x752E096A494CCC1A,0xE13620A0F18FE5CF,0x4FBD6DE4E4B0CE66,0xB837CB852016177F,0xBA96DD12B5A51A2C,0x2FC317F8C6873CA5,0x2D0C4ED383AB2B,0x60A620BAD77E4B8F,0xFCA35D26B07B7D56,0x990D9749414D49AC,0x63F96EC4D2125F30,0x3C23AE54FB9210E4,0x5EF101D0C8B27BF6,0xBF430713D24BC2F8,0x14F31945D13A9D,0xE95A177E9497048D,0x74067EC4D7D7E4BF,0xBCA36C09A8EAD129,0xF52D85049B590873,0x89E7571A404C0FBE,0x5AF977A0645F36BB,0x568C74E629E22680,0x21AE7A8D737061,0xC73223D496C6D6D6,0x67B947F06F152B18,0xB625539DA32F16,0xE4119696C6B9A4AB,0x739A8D55FEB00FEF,0x531F7FD324F16F3C,0xB5D89C56A88B1780,0x24A80106A21B29,0x2C2B9F42613B718B,0xB4C558BD30F847B0,0xEE245BE4FDAD0E39,0x49C721001F32BD3C,0x719387977B048DA5,0xD4577D6332693C47,0x19980BEA5320B110,0x23FC81A35DE746,0xC8AAEF6066D18BB0,0x3BFF23DF6A98F278,0xDBE5122CBEA355B5,0xA78700F0369E0C00,0x696921CBF1116CB5,0x16553CB1157A72B,0xD16C71972E9DD1A6,0x1A6D5F1ABEF00E,0x897F597AA5AE956E,0x7C688154F82673B8,0x522BC1991FDB4CF4,0x3E58F88021D15782,0x8454C018A41D799C,0x6C9FBE4C80095E4E,0x8EB2BAD9E3CB2AFC,0x32F4BDF414F1FB,0x85A4AA0509A81661,0x56CD4934B04B093B,0x6D560D46D2CB22D2,0x2C0313A47BDF873E,0x9A39939396977470,0xC3C540C9FDF626E6,0xEDBEF9A09322DE11,0xB0145049B3EE8,0x12DC64917D3DBE4C,0x610A1658B221341D,0xA3BBE8469B91EE88,0x2F597C30BB3ACD3C,0x42349EE1AC90D6B3,0x1F39287FCA51EC86,0xAE92BB21FFE77A14,0x10475948D6DF21,0x5E4D41E00132D3EF,0xE94595AE5BBDDF3A,0x3CA73B181413E4D2,0x54421140F16DAE62,0xC246F600F18F764B,0x10AF3764CD5A6AFE,0x6530B059C917E009,0x3A5608ED8AED0F,0x66C7842292A2302B,0xEF855386ADD89CDD,0x7F2459F18BFFF50,0xCCCDC4F0DF0057AA,0xD3587F280702674A,0xABC48CFF4F10C101,0x4D2793494564394F,0xF3D2251F835D6,0x67EB6301F1B40F59,0x873FBF003A161B12,0xB8DD5A3BDEDC9AD2,0x9F9EDB2A51973309,0x9ED5DF06CFEF8A38,0xE0B8CD7BA0964F75,0x6CAEB26E3531CBD0,0x3DBE8A10B374DF,0xF82A4AF0B26BA16C,0xD1FEEAC1909C00AC,0x332F2E262575B38B,0xF6C4BB75B60827C9,0x415F1DF3C378136E,0x85F4827FE78F33AE,0x4B7BD3E41063E259,0x29D27DC90073E8,0xEED68A4B8205B11D,0x10B453A1C692113F,0x43A29EB95DB00FE7,0x3265DB0F3CD69C11,0xDB2EDD40DC81FA50,0x119D194784F6594E,0x3745BAD2852D46E5,0x1A148CC96AE3EA,0xDA7F36EE083B1566,0x8F353C1BD8EB90BF,0xA8D7C232EB86B554,0xB3C758D72F7BF87A,0x12F91EAE41026BA5,0xB2540C93111F1428,0xDBA7EC707B9D5A70,0x1C8006E30B171A,0x72E197CD7137DEDC,0x9367F67AE51BFD96,0x86EE594D015D4898,0xC6056C329CD45EF8,0x36567ED413FD3299,0xA63C7AC9F042CB4D,0x620CDCB184D456CA,0x3002B16933E75E,0x53D669A3AC666870,0x1004BE43E2D74215,0x598A631234648529,0x11BB557D034D9D57,0xDDF74B0CA6198137,0x21E517D018D4FFC6,0x5EA6F61025A547D6,0x1B590544270CE5,0x7C62B15FC347CF04,0xB004564E94E7AE24,0x6104C720FFA82520,0x8AF792A93DA09BDE,0xCF85E189E56A0FD4,0xD7EDECA75A2C73B1,0xE9ED4F04CA3D83C9,0xE06FCFAAC105A,0xCCE8D9DFC109AB12,0x9AE9D07ADF1C9797,0xD30BE329EB435170,0xE390D5EF660F73A3,0xBBEB929DA7D97330,0x929136BA653F9808,0x49BA30217BFA75B8,0x1FF5C2072D69EE,0x431DB57E142249FD,0x9DDDC2AFCBEEDD96,0xFAB40B24F22E60CA,0x223806734FB19205,0x7E0A6FB2E96ACFBB,0xFA70809E48D85163,0x76866D15C31C7918,0x42FF3E1C4E714,0x9CD3305198A6B130,0x6C3EE6651ABB9C4B,0xDAE526F234091818,0x56C0B6E0CDCFB20,0xD33740F7A189308,0xC235CBC3F913E63C,0xF76A535658069757,0x2EFD03301EF581,0x8CDF699F8973D553,0xDB95EE806EF30923,0x3B038430B0931465,0xC830CBA011F4E350,0x40AD3EAEE77E0869,0xF22D6C075762E19B,0x850963D65248EE11,0x1F69530115A15F,0x65B4EB7C98F4C4B8,0x7DA67CFB51AFB716,0xCAFE3317F0902B8A,0xE72C644B7C348F62,0xC9F02119F2803A41,0x85C7A9FBAFBA2289,0x934CBEDB5AF86068,0x7BEECE07CB5A7,0x683627B57763E775,0x6C3217F0AA32CC1C,0x1AA25125E745549B,0xE09AD0749D5E7EEC,0xD08060ED530B24D3,0xB1E62E34FF942F15,0xEAB6F13DCC1BE43A,0x904F2A3C24D8C,0xEFC416090626D68D,0x8CD81DBFB97F3FF7,0xFB4094C3DEFA3F14,0xEEE85B158F042B9E,0xB8F34DC8594A6C8C,0x99105F9DD7DD865F,0x43DFA24A2648C29A,0x203E17ADC7FE7E,0x149E1CD0DD9EA048,0xE6EB02573758E820,0xA707056CE9DFA5D3,0xF74B5BA953CE694A,0xA058D02F65E7D93B,0x93654A865FF0A3D7,0xED68D8A5B7E81A96,0x3692239EE13B4C,0xE70B6652474B8F7,0xF1C627CF21A9631D,0x1C0CE0259CAABF15,0xF707E1567F2F05FF,0xB4DF2D3227211283,0x9DAB630C1BF3683,0x201921DA4E1A4728,0x35C7E540324EF3,0x683AD6AE37779D35,0x2530CB65357B4A8F,0x71924EA32CD45CBB,0xA6056D4C6B00EE6,0xE253BC934853A5ED,0x6E20259EEB826371,0x2B1E08AA71512B67,0x132E10867CF512,0xDF74737173934130,0xF8BD61D16A95DA37,0x389B22230979B7E9,0x40092630496E3EBB,0xCA068797CF59B6F0,0x13F9E03460F3B7B,0xBD6BBE4663EA32F3,0x30FD990FA662DC,0xD861D3E385EA33EA,0x553E1E51A48A20FE,0x52831545583B5544,0x7FF6D8F0D4D93026,0x5C8B1858765572D3,0x9FB08AB89B1C7621,0x9173CD3670699B17,0x3909A74D4BA4EE,0x10D8723EBA3BA89A,0x82481BE2F4E534CE,0xE6329379FA128601,0x2EB22D21B326F847,0xE1D5EC93898DDE37,0x8B1FEC164EDB5E1F,0x65A54098A8743DBE,0x17C8A784837F1E,0x166F466B84C3A37,0xE27288C162B5A603,0xE79CAFC9DE3A41E8,0x43C036CE54879E6D,0x9B30CF7F77A06FCC,0xB81F3E284988A853,0x322C6D4BD544A31B,0x28EF02179012F5,0x3F4E9EFF2C920D73,0x8DA9CD429C90FA2,0x11A760466AC8F8F7,0x6EF23A4772982486,0x9C49E64641FE1A60,0x7ABC1D03A24226E1,0x8486C71CB92E5218,0xCDBB742E4A9FC,0x89271D0160755F8C,0x4029EB45703A6E6A,0xBD4E5AF99FF6F7F,0xA599AFA4B6543AEA,0x5CA921FC1FAD0EC2,0x3CD0E02B554C7A7C,0x8581A463CF769C6,0x1B451A340226C,0x322EA1E5CEFF0D34,0x24F67E87C8D849C4,0x6C87CC28E7B727F2,0x1894C295232FD272,0xA58393B33B7A40F7,0xEBA2E8D2A841BC47,0x282DBB0B7BFA8D47,0x3E44E26291E5B,0xA4E2645D3315BFFA,0x92568593ED1850C6,0xFFFE377F6B68FC9D,0x4FA07D9E3296A480,0x1C41FB1ECDD6F176,0x1AB63AEE2B6E61C7,0x9AC043B1060E5F20,0x250A4EA88BCF2A,0xFACD58CFEA6222D1,0xFDD1DC1703C214A8,0x2450CE46B4779761,0xCD9250F30051EE39,0xD9C83A11861E96C3,0x25D4F4AF99471E58,0xBD93E40D3DE52122,0x2A435B47DE4D0A,0x9D630F5FBB836F30,0xC4CABC60DC6AAD23,0xCB470B86625BAEF9,0x3D10E10F41E3EED8,0xC50D71FB2DD108EF,0x86BA93AD9D75C1F4,0x975741DFC1717652,0x21EEAC92CA68E4,0x3BFF339C925C2BDD,0x1E75909DB28AC42,0xEBE47E9BB552EE74,0xBF5A9F3283E94FE6,0x55988D7D0213B927,0x3ABCBE41BFB1FD29,0xB97209FD2D701FEA,0x363DD5C0B593A2,0x46066B7A0BBD3807,0x73262E6D98E620D4,0x6C35F6E90CBBBB8E,0xD887AE5DBBB92FF4,0x6AC3DAB32190E98D,0x2D9C1BCC85D82F44,0x2E13666223F665AB,0x9C6BFD47A16BD,0x176CCF174C63E961,0xCCBBD432C260D061,0xFC5415B81DE0216B,0x5454D66EA3B03C0D,0xD66D0DB0DA7729F9,0x645E42A02986430C,0xCE91768197AC6645,0x1CB93B077C8343,0xE3410E0A314C86FC,0x225059BB10EB1955,0xEC8D3CF383871419,0x16DFAF43B27B10B7,0x2117B2AE32354B84,0x5679396F093C58A1,0x470EBA14A5DF3495,0xAAAAB5CA5BCC1,0x7549003B9F7480D4,0xA16C6E80665C663D,0x2708BCDA73729402,0xA42FDB6591EFB32B,0x894077EC7C2AE58A,0x3CABD07110BFDFFD,0x9E25BFFEE25C7218,0x3FC09B2D4C6520,0x960C22E508719901,0x6196159102B8A622,0x2B6F2E822B43B55D,0x7712F87ADD457557,0xC6BFD988C1BB2B49,0x892D67A64B914DB9,0x39911140E07B27B9,0x59A5930DB892D,0x6B9C00BA94427298,0x9761E390A29AE0D8,0xF7AFDE9B06382884,0xEC428079BAB44E1,0xC00C1BEEAD4F7F17,0x7127217F39111716,0x44215C6CDBA8E1E7,0x3BB2B862795436,0x7F649F5D4884CD4D,0x7263C56533EDFCD9,0xEA79057633D1BAF8,0x74A9BC81C0C7CBD5,0xC9A2AC481B1B2613,0xD1C30DD22947C265,0x714EC2CF6271DCC0,0x17739A45DEA363,0xF7721F356BD9C637,0x64CFEB83B55831B4,0xCAF75AC7D356DAA3,0x518A6227C23254C6,0x8996346D95D3E4CF,0x5795A771D80AB73F,0xD279AACA63044B12,0x14687463F912CA,0x29F7B8A4A40986E6,0x7A37AE86F5018299,0x3C4BF3EA53EF69E6,0x7F7161A21A73F4E3,0x44B08934A2695F4F,0xBDDE6DB33CEA7C4E,0x1AAF6092DC48A91F,0x4C4BAC69A3AD6,0xDFC5228802F8A977,0x65836AC13BE193AD,0x5BEB8483A1D825ED,0x7A2C3C235C6E89F8,0x5B4E5047A3229BC0,0x76BB86C898CCB3B0,0x2362102B5B54EF01,0x1A2998E1C8E220,0x8258E3ECA0546A87,0xE436356293C36F24,0x65C30999A2065FD9,0xB4123CF3A0DAD4B0,0x3A0C2D2160E19A05,0x6930F6C0E77FEA3B,0x7586865B2FDC2390,0xD5F6C4B665A5B,0xB16FD25C7F40DA0C,0xB303AB3418341450,0x61A3D9FA0D1C95A5,0x63FFE72584AD52E7,0x18325CECF9920317,0x356622490F73D20A,0xA744D5A645BFBB17,0x3C752834E5B2B3,0x60088E547DB38459,0xEE2C299EB51F6DE,0x3D30701838C30BE7,0x3065ECEADA0919B2,0xC1D2BF8322F088AB,0x6FA44A073D802BE3,0x109EF83088F494F5,0xE3BF4DF553F2A,0xC6A2BE48D9597FAC,0xBE94942D42CF1A11,0x3E4B5437159268CB,0x4A672D8056C5281D,0x191C0F6C4DE50ED9,0xB0582D2185431FA1,0x93FE8AB70CBAF04F,0x121D368BB433AE,0x8B28FD5CFAAD6DAF,0x3DFBCBECD0880CE5,0xCC97C758B380929E,0x70A0587D0DEE344F,0x1C648E4716310395,0xF5D1DF88CE91C2BA,0xFA88093B66E70F0A,0x230C45B50F2570,0x976C98E95C38C14F,0x158C545220FC136E,0x5B38A57E63D274D1,0x523A6EE477DC09A1,0x368BC55C5DEE243C,0xBAF3CEEB2B7C08E6,0x1948EE0CADD67FE6,0x23E97CFDE68B8F,0xE5239C639931B415,0x7652F60AD5D6CEAA,0xAB36BFE44CCC1FF7,0x71AB67D007806A3E,0x5FD3EB2EB7D45588,0x96078A3E724CD781,0xAF36EA14DB0B9A3,0x2DFF2474BA4A05,0x4B74773CF999EB9C,0xEB81C9DE301D068F,0x353C6D8EFBF87AC0,0xA0EEB5592D34A344,0x7F9F3E8ED95FDE38,0xE191BBABE27A41EB,0x9EA954E923786009,0x220490A7ACFA8B,0xF3B105CD7739FAE9,0xBA9723FF87414667,0x1094683454F1E571,0x7E40D5C35FE98766,0xD3FBB174FE298733,0xD4803326E64ED1B3,0xD4A8CFC225886E93,0x2DCB88B2904C68,0x576A04C86168AA2,0x704887956EBA5ECC,0x51D841D441086E2E,0x3809AAB854978421,0xC7046D8DF53487C0,0xE7F59E0468E36082,0xA8D096C49EF2E8B6,0xA425354A58A39,0xEBE4BC9D56E4663F,0x264959BEBBDCF6FC,0xE59A2C02E0001A80,0x86AAA28BBBBD28EE,0x56DE961D5FB398D8,0xBC075ADC176452D6,0xA9F47801D4CB8A65,0xEFA0559DAEF02,0xF16F0C82DFE01A5D,0x73CA2C4CC24A6D5,0xB0F730919FC913B,0x50617C1170259319,0xF26CFC3C293A9734,0x149E4CB71A9C5866,0xDA9125F78A755CD6,0x1DDD0F7AB810A1,0xFE5D63DFC0646D2,0x49454706153A8DB3,0x805404070F1A071E,0xC53376E665E8BFEC,0x5BFAF78E6B75C90B,0x2B569978BD5F43E7,0x8A34E8A3372A316E,0xC7812E2D44438,0x8CE18C00ACFCD4A2,0x17E9169A9A8A0B07,0x34286EC194EA38DD,0x4B71BDC995D3C46,0xA97CB9A7A602F9A5,0xE6CAB0766357895F,0xE6AF56AD7C4C2A16,0x220993E1607737,0xABF64CBAF541A7F6,0x69998A0DFAF157D5,0x995E0D8CF17DFBD5,0xC0EDD0E868EB332C,0xD6B8D77F0B99089E,0xCE06CAB3519EBC96,0x699B2C219DB0256B,0x2DDB9788F29077,0x837AA6803A18A6F0,0x24AEF71AF51EB694,0x1C7CB5802E29977C,0xC6C6CD58B6B250AD,0xF1DBE40EDB815CF6,0x36A99CC02CD2B589,0xF04C06DDF4153CA5,0x39ACE8EA199ECC,0xC859C45EF983EBB9,0xA07F4952B3383660,0x673A45180667F4AA,0x81CE6F7A09F06EB8,0x973564046FDA3C00,0xD732D5C2235F6473,0x863A8949EE1F6722,0x2F6F6DDB1E5BE3,0x72AE417467A256FD,0xD4B6F0141E56D5D9,0xA84033C8686B4BF3,0xCAF939D74CBFE5DB,0x79139FC3625D7CD1,0x69CAC202C8AE6011,0x603928A3DF48AF52,0x403CE4E7482A2C,0x321402D4363E42A7,0x587445339A8F167,0x52B134CE1A199C18,0x6B22C5743454170F,0xD1831E803E8129C9,0xDE5D2E9B8CF0AB46,0xE022DA0A3B61DE83,0x400AB821E939AD,0xD09BB758FAE41141,0x53CAA07915DACB2B,0x803DF3943BF19C8C,0xF3C26C2E5BA527C2,0xB3CF92D526FCB1EC,0xFA690E30366660CE,0x5CED1C4CD71D3ADA,0x4D405AFC996C2,0xD69D5BED95DBD3F,0x69E3F5078DE536C9,0xF8AC5AE264D70D33,0x5EC5DDCD816501B1,0xD25D0D842B55506A,0xB9D01DE95F8C72F3,0xA2DE62CAE59E9443,0x25A2329265C289,0x1D5A528833F54D40,0x164CCD28147DB855,0x120246C2C26C58B6,0xCE0FE26C19E5569,0x99906242D4AFB4C1,0xC3CA5E460119C6DC,0xC0335CC2723AFCBC,0x2E281D70E5571D,0x6B2567562019089E,0x7C9B3C775D142A86,0xAECAA7D9545E060,0xD5174AE5A75D9E0E,0x70F266F7F1752C65,0x372D15B5CBCB5126,0xAA0B560E2FA724CA,0x328EF2B10F3A6,0xD40A3B066F1B5CC3,0x26F2D0864A16E628,0xCE6519FBD8EDC075,0x29961440E2026AC9,0x804E519D9F954023,0xDC6DB065F7EDFC53,0x92474F11B251550E,0x16376F911650A0,0x754923E1A7FF816F,0x61FB14D3A5F4FB92,0x2291A115CDC42FFB,0xAF6DB9C479229B59,0x45A2E689A8C7E4E7,0xB85DF788DCA34807,0xD4AA45953764E0E1,0x8C2B7A5A01486,0x9CD7F78CEC499A19,0xB9CF6DED4D8CF6E,0x7FAF34827176B064,0x98D6AB44847B8962,0x43B3612E7A4F7A14,0x34BDCE8ED6C3EC5F,0xBD505413A923939B,0x1CF5E663AD8E94,0xC570D3C270B3F10A,0x52B13F3F091F42AD,0xF7CF70E5EA87DA98,0x6403B7B76C0CBD01,0xB3411EBED2A7D8BE,0x3F9254047C1BEEF3,0x1356FD7356CA8843,0x2D1CA2A3445B57,0xC9CCF8E0341DDC4C,0x8AFCA5878DAF9B7F,0xD929A8745944B55B,0x93EE2037E89C1110,0x1E1D99CE9078F048,0xBB72A0B4C6CA0E62,0xCB421AAA67363105,0x1608520445BFD0,0x4309B27E965B5EBC,0xB8CC237E46146C64,0x4C0646453AB35A21,0xF763D2B9057513FF,0x33DD511D12A3A291,0xC1C6721EB78AB2A2,0xB0A4C06982FA3FFB,0x1C85C5AD12E1C1,0x58E13EB9266269D4,0x892D04AE157BC28F,0x661FFF6C32730A23,0xF042546C6EE73BC0,0xE7E3870F1F1C94E0,0xBCB4E87299796503,0x68A5932203C7A7C7,0x2C3C0C2992DE9,0xF45B0C99D2813317,0xD92BEBB1B27BB348,0x5C324415E6AECED0,0xE29176D612B0FDD8,0x4EBC033D65325F95,0x7C16EC6939DABADC,0x7E64122EC99AFF9B,0x7D219F53F3CE5,0xF813C3AE352C5A11,0x8BBB318DB66279C8,0x428FE862F7429CE8,0x572F71C68BD18BD7,0xAFE822ACFB99A2C4,0x1A3A492A5A46AE9C,0x4D886866185170B5,0xCEFB09C15B46B,0x8049361BB06125EB,0x9A4A5DB100B5C558,0xB035232AE48CEA01,0xBD3460EBDD99A662,0x25DCA792BF6450FA,0xF450F23F5CA82547,0x188AE48E2C640751,0x3175804FE6810E,0x492503B51AB6DE05,0x36B1CAF14BD82D91,0x28275B57652BAC1D,0xE64A46BCF13B19EC,0x511C702DFDB587D9,0x4FABE118634E3E53,0x4146E97D3021CFDB,0x14A48C4F5E2849,0x2684AEE0786CC482,0xC39B9868DBD57CA9,0x11F457798E006B23,0x80413CB7790FCEA2,0x8709EF8B26349945,0xF2E3947333E4354D,0x2F504D0913BEAC80,0x665BA1ED7B3BE,0x6453F30190E6B8FF,0x4A49A2CA17D1AF40,0x4D592CF470C5A2F5,0x4C1F482C7829BE63,0xF1F53D461CF3321,0xBEDD3D22953B6693,0x7358CADE0D0FBA84,0x3B950C55DF5E3F,0x3DD9B39FDEF96C5E,0x83BB347B58616F7F,0xA1C0E9864FFBB737,0x38DF9E481F765C9E,0x9FE0040CD9C8AC26,0xC0ED2E9B734E3F34,0xEB707541F9FD1E2B,0x3BD69BD7649D26,0x9A338C10A297EDB2,0x7DEC3C2681092A4C,0x557A9D0033AFB71B,0xD1360506519E2610,0xF60E26B5237AB8B2,0x7C211D569430DE0E,0xF950D8B51EE99177,0x10EC3F01E5D2BA,0x3F4873E0EB6E1204,0x5821AFABEADFC067,0xA174928933550DCE,0x4053E6C642C64450,0x96ADAAC9C3FA19D6,0x5FC52820BDE02556,0x1A396CB17FEA9E82,0x1E8F7623EE771,0x34C9A72D8A505A09,0xD0CCE2D53A0B8C6C,0x81D8C3C8E4B13412,0xE59E17C4A7C97F33,0x581BE5D0B0A5F83D,0xC3B193005AE5AC07,0x85504E01BEB7264B,0x39791F146CE0E7,0x8D50826E29656B63,0x15E71991F62E3112,0xD2BEE4E5C6274121,0x702561216DE8FFEF,0x5305E3BE1E1C6D77,0x6A4765B669F5AFEF,0x55EE8B36916A4994,0x341A59EF6AA671,0x5887383B817F5C97,0xEB463A194E1A4B22,0xA2E6F866571D3491,0x3FA7F03C3F332D99,0xCD1DC443D889A206,0xD41622119E311FC5,0xCDE5851F7FAB048D,0x2FD15E0C620F19,0x3D6D5624B4B78DA0,0xC33862B03F5206AB,0x7BE1C753F74CEE01,0x3AD3ADDE45252DD0,0xDB05A490BFC55A87,0x2179BE8CE3A630C9,0xDFD3700CA2FEB923,0x1C4FEDFD50F32F,0x3AE981038EAB059A,0x709022C214CBE4FC,0xC72091C323C8C7CF,0xB75DF54CAC5FB48F,0xB108EA50775AF033,0x2E4A13292D4C5EE7,0x9F27051F19F19C0F,0xC8F6EAB3366A,0xF025B4457CD48974,0x28D464A0A042C22B,0x7A3FDE8A4782041D,0x33E4432D31F9C66E,0x68639AA6694FCDD0,0xACD32AD742239EB5,0x469D3BEC1824CB54,0xE9AE03B0297EE,0xD309F1442949C8F1,0x77D7469E93D6085,0xD7E06BD858416800,0xD9B5D0B87489D13,0x2A7BF2CFD82574DD,0x435068E718F068DD,0x40D400C6309B28A9,0x17A016F2F222EA,0xB74CAFEC31EFA401,0x1EA06D5A1D3705EF,0xE92E2D15D8CB3AA1,0xF99C99B9B2558DCE,0x87696C79F2EAF484,0xAF01FF1AA51D8035,0x4968F8093322157B,0x2B4EC6A4B611E8,0x440E40D9F31FF506,0xD1AAA292774BA94,0x2E6A54D66C1808D9,0xA7797C07E26FBACF,0x8A5C685FA0B1694D,0x59F80827D7D3BFC3,0x1A8DF5A59399BBF1,0x24084491E9D09B,0x4D457E0A234D7F86,0x3578CFBBA50D493C,0xED96286B6C318182,0x3928D5321A07D16A,0x318B33561698BA82,0x968D73D7215EC09E,0x3B97BB769CD4E9D8,0x3529C08F819C1B,0xB32B14EA4D3EE4FB,0xC2FF212DCDB3CE6F,0xD048C5F3CED1D4DC,0xD534E6A5384A0E1E,0x314832A5AE2FD2D4,0xD825339F74D5BE8,0x6EB4EE2B6E2DF788,0x1B318493100A3A,0xCF427A97EB0BA8F3,0x70FAABB8EE4A831D,0x15A4508A1669D87B,0xAC20285011BF2164,0x36E77CD6DB29C302,0x1A859C3414CE2F38,0x5BDFB10237FE623F,0x1E3FC6A2A71C97,0xF5F4FAB859723130,0x72E2B7FC205A0460,0x31AAEF38A0F85D00,0x72F638649DDF33B2,0xD573A7A4A73E10A5,0x7138D0E0C75E6B8,0x8CE7DF79DF1FD86F,0x3A34F7CE5F884A,0xBF8DDAC15680F1CB,0xF8CBAE7865AA7A0D,0xEC63A5CC355C4851,0xAA67292FFFFC53B4,0x4910622E2CF49060,0x8AFA6070B8925CE1,0xD30798E2D37047B1,0x20EA4FB8CFB9EA,0x492EB2C6D723D49,0x1E26BD6F1693EFE9,0x734B3D77D4FE2B95,0x853CB43238FA9910,0x2FD8F896E361C0BD,0xF22D81924FAFB304,0x1EB4D99F3E494C26,0xC2652321BF382,0x2CD142E53A130E1B,0x139AF3DE10E96132,0xE94CED69F5BD07AD,0x90008DF586747C81,0xB1BEAE9F738DA08C,0x1D5C17170F1F394F,0x267A8AB51B901171,0xBDEF966801446,0xEB697172E1C4B0C,0xF91CF91C11D3734B,0xEFB909CC2D03D41A,0x9D75AC431FE49778,0xA65D97804D9E87FA,0x85EFE64A2EC00707,0xC154EE416B714FA3,0x36B0F22AEF58B3,0xEDD9A546ED03F13D,0xA17B1FE56E125470,0x542FE236E03798DD,0xF909F1960F35E623,0xC17C7301E8ACFA5A,0x134F3950DDD88967,0x4E51B22BD2ABFC91,0x1E207E47131C12,0x9BCC2DED5B75CEF0,0xD8E0267BA2CAD575,0xE293EADC40C45EA2,0x63A9A0DCE6683895,0x9A257752C12AA3C9,0x4EAC76CC9B06FCB1,0xED1F6D0C527615A6,0x49A9F7741FAA7,0x847F13381EC6009B,0x24B1B4A4F9830711,0xA33E28BD4981F5C7,0x4EEE6D1CC1900578,0xDFBFEBD5904B00B,0x8227F4BFE6821B65,0x3152EC68D3DE1EC6,0x22EE3B31D9DF0D,0x2C7C24337D180F24,0xBE02E054773CCC72,0xD6B0EC7D093860EE,0x38C28F43392DF174,0xF7BCCC2FA84C1504,0x7AC783D5293E63C2,0x45BFDD238E22FE9C,0x2A1C5491BEC530,0x958CD4D43A5246EA,0xB6A57FCEFD2A6F2A,0x6014549491B3185C,0xEA34D51B7F56ED31,0x39C4CED020D1EF8E,0x3EE9C9C3301F7779,0xD80D5FA2B5AB298B,0x22A7AD897DF2C8,0xD0CA130732D0C2B8,0x4DB973B9ABC5DD19,0x96F7EA6B0CA09443,0x87F1BD760AD87CD7,0x8A90F2849FF2C684,0x404650C06F3658A1,0x3893AE716A8CFC8E,0x3D8EE692C42114,0x640B555DAA237F04,0x915E75ACFF539513,0x10200E41C1710D12,0x825B0D4A366E2092,0x3D574F380133014F,0xF9EA0EFC42007111,0x865C086C42DED980,0xB4AE3307F9D13,0xFFC03BDDF7BB578D,0x8EF4A83222C70FE9,0x8E6F69D1692E8997,0x3B300F5F0887F0B0,0x2AB597A51FBDA1EF,0x47C5D9326EF31BFA,0x16FD592814B1A058,0x220369DB2F6612,0x9B49D7DFB0BBE92F,0xA2A8B8D40A7FC402,0x557E796F8DA8681A,0x7F273F7A0EE1F969,0x7605E187D18490DD,0x2A20952D69240B6E,0x4BB353B033965917,0xCF1596F562CC6,0x1AB5F0CFB16D7E2A,0xA98DC6AA4D8E6F75,0x5149814D69BE74B0,0x70AF126DEDC6E581,0x434558C0F75B1432,0x1558426E7885D46,0xFBA85574809F833B,0x6D923FA5EEE62,0x9EFCD6335ADC274B,0x9B9C295FAB891194,0xEDD1955D70DFC61C,0xCEF20D2BC499F83D,0x28EF7D05ED90E7BD,0x1632FECA899F742B,0xC96C7D6E7CCC31C8,0x36B88409075D22,0xE3240E9C8ED5727D,0xF1D51705942AB66B,0x878D8EEF20AB650A,0xF9FB6275CB8406C,0xD0D29F3C1F5C4827,0x57AAC470028D416C,0xDA96AF3F528CD57,0x2C1E2D9CEC2EF9,0x8CCB65C303404E0E,0xA6F6D01B2584C8AD,0x25D22F8D9806DCF3,0x3C2DA3C446A69645,0x2141B790024B04A,0x8F6253BF55C9CA0B,0x2B30D48018A9F346,0x3333CB876A4225,0xA84A8FB86119BAF1,0x5FC8DB1B93677D7A,0x89F23BD5696C94A1,0x3E9E382D2AF63674,0xCFEC0530C22B5225,0x32AA0E2B6B668B8D,0x1B57D8E63C51B6AB,0x1966180B2B067C,0xEBAE8E69CEF1BBE6,0x6CE07F55DF339D73,0x6B1ECA6899D8B358,0x95746470C5864A31,0x88EE7F639F064B21,0x3DC6CB29E7B5EA88,0xE7000E41D0A31AAA,0x37314053DF1AB6,0x4BEDC7B24BD03322,0x1E53AFE0E74DDEC8,0xD4EC544D4755BDA2,0xE094513ACD646A5B,0x583F32F842B365E,0xF2AA40D0D64FB230,0x2EEDFDB650B24E5C,0x928F0215188B5,0xE55B7F51E9EAEAD8,0xB671446DD806FCFB,0x5681C2CD83F03C71,0xB37803B53B9CE82,0x3D9CDB55F969275,0xDDAB27D687218321,0x43A62BC3F2354674,0x2BE08DF6C40788,0xA02DE8971AA3ED12,0x5ABE9BF6514FC074,0x4F590DB171C38590,0xAF81598F220A4769,0xFDB41D5D053B1F22,0xF2870DAE4176FAE8,0x21123223194183CA,0x1F37EF3879AC77,0x12ABB63176100063,0x2E82692C090CA3D6,0x2A02228FB47859A0,0xD3B53EE7C5361478,0xF07AB1D0A57AC24D,0x2D09FD5270F0E6C7,0xB9375D638FD627A8,0x2212631063FE35,0x17ED851B711531DE,0xCE37017F733270C0,0x2195B2071B2C0A40,0x740BD48F60DA25F6,0x1C7A0128585202A5,0xB4F39AA2D10D125F,0xD9088582A5267F2C,0xA98D688FF0149,0x117A4A3C3E73B7A1,0x10AFD0100D4B26C3,0xB89E3D6C54E2F614,0x5E0653D88D3D7ECF,0xCCA60C338DFD557E,0xA609592A0B0385EE,0x9CC14F8CD879FD38,0x341562DEF35BD6,0x7805C80DC3F6D8B2,0xF4C06BA8E563B3DA,0xE42B13EBD997B78C,0x76BC0868936913F9,0xE55ED6F755F34682,0xDC360D844F44D941,0x912F906ED333A1BE,0x32DCF723AD8EA6,0xD8F8A2EF87C1754B,0x52CE5DF3D4D54E77,0xD203C2C9393B5964,0xF903C93FD23D9658,0x4F4E4C08D26E48CF,0x82029804541C7D97,0x2A136CF3FC0CD7B3,0x13BDAC67964B50,0xDDF641C47AE80359,0xA2088C2C3567B95C,0x43655DB24731F761,0xFD3E9362D64AFB26,0x447D7D6E5298B816,0xBF25F0E695BE0E1B,0xBABAD95DC729E63B,0x232444B538227,0xC360FE68C27DCB74,0x71CA00D79FA2DD08,0xB18C256A1A262A3A,0x3DA820A838C96830,0x8CC940A5E0CC061A,0x6E3B5ED6B273A471,0x5C435BE6ABCBABCE,0x1151A0CCA945BF,0x23C37114067B6B96,0x6FA653EE2AEBBA7,0xC7C52DD39615BC7D,0xED2B0D511B5D6F68,0x65D965B5EB4F0D1A,0x39A7138BBF6FF8E1,0x3644F9819A215F61,0x24CC8F3A916AB5,0xAE969F43558F74FE,0xA4094DFFB0115F17,0xAE10BAF0459C1115,0x5BB4F7A5EEEC7768,0xD712C6035A537FE5,0x9B0748AA6463F68,0xCE8FB54D4875E453,0x353C6587611DCD,0x463F101531B2EBA4,0x9F2514B6755AD128,0x8C855E7335CE3EEC,0xF9EBF423E51FEFF9,0xDFCCE2778E1B1A93,0xB7CAD10638A366D0,0xA51152A2053DE9E4,0x2FA0CCB032E921,0xA46B122A7E201E66,0x736B67DA4E69076D,0xB59BB6E335D0B2D9,0xD2BCB85ABAC365D3,0x861D663E5D35541A,0xA9FE21C2170D25F5,0xE761A85BDA34E1A,0x355C1617CADDE0,0x52642F8969569611,0x4A8660B7B1479301,0x51881854037BF46F,0x3FCE268E49F163A9,0x7A158410142105C0,0xE720E10D01D887E9,0xC4CC1934BE0B90E1,0x18A73389950B77,0x6425AEE803B1A11D,0xB22F5B9239068B1D,0xF36F10C0D25DE6F,0xBF7AA9A2D2B65671,0xB45805E511E3FBCE,0x772026BA9EBDC6F,0x77E56C365BB391E0,0x3B46EA6850475B,0x617E55A8E96C82AE,0x8415B7D8B694ADC2,0xCB5AFB08C93CA34E,0x3BB1EB89A62133C3,0xF707EE3555A75696,0x26A833F0D79AAC57,0x5DA59F08F0E62D88,0x224A4B70047A9,0x25B0DC82832635,0xCCE47BDC92BA60A0,0xD872475C31E3D311,0x50FDD3DE5F5F862C,0x369744DCFF542090,0xD6B80C1C31FE73BB,0x5366D4063F712CE9,0x1A67B70861B535,0xEFF985BB4B227A6F,0xC2DCBBAE4CBB4539,0x1A86112CD9334812,0xF87938DAB35B8B1B,0x23DB21AB93054659,0xDF6D305496625958,0xDAFE80864AB3BE09,0xD7142262A9EE1,0xBB33E028C193ABA2,0x9BB8D84409659566,0xAF137D433708249F,0x8B9F97DADB6F9D43,0xEBB3B02252C636D3,0x4CE0B29A9BAD4BB3,0xA353B040A65840C1,0x28A9C4E630B582,0x92E60FD6F90987EA,0x6830B198F57E0535,0x9D76FE1069EAB904,0xACD788536AC4B765,0x5FB7266CAD8BB736,0xC0F718C1EE8FE203,0x16584CC6B91F70AB,0x197F53D9F48F1E,0x6BF8E0D4D6034081,0xA26EACE9BDD8701B,0x155D4FE40B790379,0x72E2C16D9264CD33,0xE3D1F43B398B2011,0x87764B2A9947CAD3,0x4414F12C3E1F73E4,0x25A3E7123B9756,0x499652EC45403695,0xB8433AC0FA1AA98B,0x65C497DEF091BE0D,0x47F48ECDA3E74E55,0x9C9F8A8FAA14FF8E,0xD0A12BDAC82F60A0,0xDBBBCE33638B77FE,0x1D1FC1E2BFAE5,0xDF2E1B0750EC02BE,0xE393404191AF7FCE,0xA9476070F6B75616,0x5F78F115048B8652,0xE5483A7644D7B11D,0x3E4466BEBD688AFA,0xD25AE610ADF0B83B,0x3E113B179FC6DA,0x4E52C34CAEDA748,0x2CA04486575375EC,0xE9045D3CA90A8881,0xE3A4FC918951025A,0x853CB8AB807A4A38,0x97D9088B42D14249,0xBE7FCD9BA711C09,0x355E4F7C98DC70,0xE1BF2BAEA9508860,0xC6FA23FA079A46EF,0x9B718619605E6773,0x9FF03527C141598C,0xBAE9F1987375914E,0xE7B8D7E6EFB2A0E7,0xB8944E9388C7A4C1,0x4735C6944B5F4,0x211A908578B40EDC,0x82C02A08380902F8,0xD872D1EFE9AE2CAF,0x17CB4FF5D2C3C887,0xFDF43D5FDD367E4F,0x25E7B1E25883E883,0xD67AAB1F5A62B9D8,0x338D6CF4524169,0xA1760E0A5F24364E,0x95928496535E579C,0xCE00E0F252816ECE,0x97C8A5BD7BAD6D75,0x833E2C14BD3D7312,0xCC7E5BBE0A11D6E1,0x4982EF44FE78F4A5,0x2F8BDFB6D47775,0x9475DB2ABDC68388,0x5E624BC05547378D,0xE431AE95E9FD7E87,0x2592A5CE4E0DA16,0x6E4DB07FD814711A,0xE3A2CD8B19A321,0xE16A54FBC52C5357,0x1A133942B2219F,0xCF95553051A76572,0x833106AC1A9F7A18,0xC593E7B67E85924D,0x84378968EBC7BCB5,0x589C2804BB9B0896,0xBEA2CD6BB146AE30,0xF23022197555CFE,0x1F7EF8D672DDF6,0xA27892682D842518,0x7612E5714E75A882,0x2991BAE26591F09B,0x398314C94D0CE49D,0xE8F78D20E8518E93,0xE729B692C7C705C0,0x30155C9FA0395DCE,0x278D995251BEFC,0xA7138DD30C459F38,0x4695A31B03FCADBF,0xC2E5AFFB68113970,0xDEF75E88AC8FCA89,0xAE181171FECBEFB3,0x28BA58A2288C2E5A,0xE7A846E4CF81660A,0x39AE69E3B6019D,0xE0366D095A9F1B7C,0xB37D1A74D00B43DE,0xFE50FBD9D429533F,0xC897E3D8DEE02600,0xF50E6F4F6A3DDC60,0x1F37DC3D1B30DB26,0xE3AD83E238E1C2C8,0xBC5841F70A2DD,0x53AEE0F57F618FAC,0x57D13D0F84773477,0xA3766D4F78C92C38,0xF1A4E0B0C1F59DA1,0x80A9A92B99597B72,0x648183C7D62B64C5,0x4D16714E3C428C98,0x1FA35C02C7B80B,0x2E68FA0169930D43,0x5B84CFDE8BBA0A5D,0x696E6ADBB5AD5729,0x4F5653DCD5E13012,0xC5AC33A1AC0D2AB1,0xC2CC8A3D30B66B4F,0x3294F9D89C2F0614,0x1036B163A6696B,0x1D862EC80F311D1D,0x82756E329DE65546,0x546ED85193560F00,0x8E9546984435CE39,0x8DD5388AEF61E540,0x3D72BD6699120216,0x81C29351C6DB6298,0x2B3AEAD4F677B,0xAA6554834347AF3A,0xF52D46F9BB3D7A71,0x5D53FE92F3D27AE1,0x6C563B9125E3AE47,0xB081552222FB817,0xC66B14E15BFF6347,0xCCD7D5F32D89C45B,0x1FDDF0B95D8B1C,0x98DB31E0255BF202,0xF4BDE9D34FACF45D,0x46EDCE5D4A6FC4E4,0x957F9A61B84D3FE4,0xE3EC1B7C5EEBC588,0x6D17DC4EFFA1383D,0x560E9E25493B7FF8,0x332A57FF6F4D22,0x6FDA3DCEAC3E8229,0x354C1E603588A52A,0x6B43625F090B4C41,0x685837DE11A26E77,0xE0BBE2325A5A73B9,0x738DF674AFA6D091,0xD8AF97EC9A097886,0x3AC36B3C2A3E64,0x31EC1A4059A2772C,0x3008E0332F1A9982,0xB806F305BEC73953,0xF36088CAF8A012A5,0xD202FAE8E3148540,0x25DEEEB22988C35F,0xCEE64AF137919234,0x3B23B5E07FAB13,0xE0D38239F4C526BC,0x2ADEAD2672129F99,0x9D00CB373F3AC04F,0xD18E3B6ABDB1EB6E,0xD3761B4D1883EFCB,0xC6EE0B92B63F1BEC,0x318E7E6D03A93715,0x24D8F6B10B1304,0xC306FC8C01767877,0xE73F31C320025637,0xFCB652B590D4356F,0xC3058FA284026A94,0x374C3B4D901C5171,0xFF48535529A527ED,0x5814422BD5D40D27,0x104568A6919C1F,0xE38993E1036F79CB,0x425ABEF5C493C213,0xA1048D7B90E85B7D,0x7E19480DBDE83E34,0x3EAD2B74845F46C4,0x876A6AC4E88CC4,0x154AF894901EC42,0x1D4FE27F82B05,0x2F059128EFF2D602,0x78CB31553696362F,0x886D8B33F55C5CDD,0xA230AC27973BF874,0xB1F3FC977C7853A5,0xFD9C79DC1A5C4B0D,0xFCDAFA679E5444B3,0x26A83A126BA93,0x6C17F407801FD9AA,0x7A37FF0E5EF9D93C,0x58A89B86249E5C84,0xCA4D02E52A0FC0E7,0x932B6625269F5DBC,0xD3D9FF76C245F0F5,0x5D004BF07EC0D52C,0x246C4DF0BAAE46,0x8A96EFAE2E2E388F,0xD1AB9ABFF5953F44,0x3979958FCA42887,0x9BBF508CAF681ED8,0x39B9EC15AC8A8801,0x24B9CF7FAEA708B1,0x18AF11FECC3B92A8,0xF221F8471D133,0x5F04B1B57B67CA15,0x62A88C8CFC8B276D,0xC5431DAC20D62EF4,0x7FED7F802E04C7AA,0x7341ED3F4CD7B043,0xE5A244C2F434EDB8,0x3A072722B3432EBA,0x272FCF7963D80D,0x15D2C61806863D53,0xB1B3A90DD6913C12,0xA13A21F9B4601A2A,0xA32C26028528FA90,0xBB89F31B60692103,0x9B62A8363AD7194D,0xF1840FE0243A81F3,0x3CCE8EE6AA7862,0xDBB3430E38EE38B2,0x836C6FA6F0ED9161,0x47E83C7E47FD7815,0xE1692111E147663C,0xB88BA5B07FD20535,0x9D1ACE33687B670E,0xC6DC4997817FBBE8,0x2E8597599D7D8E,0xA3AD23BAEDC06A69,0xE21831DED7BB2D78,0x2DD16DA332D88F26,0xC0D4F4782945C564,0x7704496568508E4B,0x9DFDBA907AAC9B88,0x16C8A9C680D0AD3E,0x2A38D5C743C50D,0x1E346C308912927F,0xF26D7FD9C46A4DD3,0x3D60837983D620A8,0xEAE6B20256D0396A,0x1892DAE11023E89D,0x56DC0B833213EFED,0x530DFF6D1596DDDD,0x3AF6593D43CC62,0x82966C3C9860267D,0x871795B4E9239097,0xCCE90EDB1F1EB490,0xE6BBCAD81AB4E944,0x50D55E4E49ECA4F0,0x6C6EA5CF10980150,0x8CB494FD1BFF39E0,0x1D6F95E79B61F1,0x29C8249AE1AABC4E,0xE2DA1BB11B53D3F6,0xBD98C7E853804CA9,0x623327F5A9806849,0xD5082D47F484321B,0x455BB08B10028E0B,0x4B08771C9EB68907,0x1DE47EB16A193F,0xC063A5C354177A02,0x76C8F91523C96FB8,0x4B84E94EBF5049FC,0x4CAEEDF54B4E0724,0x84FE1AA186EFE11C,0x9DDA101B1584D406,0x192B99F33031FAC9,0x256B8DD86C7A11,0xC68852E7C7D161A3,0x1E93C073A2A22B3E,0xB90F845B6FDFA885,0xD6E1D2D3F8CE0050,0xE4CE77A86FBFFE0E,0xFD87340416F8CCAC,0xF1BFA80513161B4B,0x134E0B049D0BB3,0x2662E439A721D578,0x3C6D54F6587209F1,0x1EEE21A9A74904E9,0x2ED0D04814F3C59B,0x74BD17BC6F41FD4F,0x5E9BBA0C86858AB,0x3672F88C5E23762D,0x21342E6D34B7EB,0xFAC8E8E649F04261,0xA996788ACB639215,0x4156B1EB165F65B1,0xF2E43B0A7976505A,0x955B8569873BECD5,0xBDA0BA0956ED2C0B,0x2F832138C28297E2,0x2C85D78736662C,0x1E4219FF885B1262,0xFB17969B9BB568FD,0x810D62CA577B0105,0x6A2C5C248D2F72E0,0x51197A08D126FF76,0xBEFA70D12C2B69A,0x72A96E4041832460,0x2B48861FA5BF77,0x4C384C376EAA8023,0x43B71BD8558DC635,0x932A5E2B997D37,0x8EF5109DD2C8736,0x13AFA74859B55952,0x75B6B2A8F3668201,0x86A3B509254D20ED,0x3A5057420726C6,0x1C59EB18C3AB1356,0xE824473EBA445377,0xF29900C037BE1709,0xE0BE284AB9FC50DA,0xF579758B809BC617,0xE8D1769384AC139B,0x7A37F09A46A8B5C0,0x498046DE62F00,0x81C50EC0C6FEED90,0x6158F0E194CBB3BA,0x2B1149D6BF31BD39,0xB472A1840B669F7E,0x97B6FCB02B859E54,0x454405E57E88EC33,0xAE2E4985B7154533,0x25B0F255660242,0xA0803A3B8C131C26,0xF84CE5D6611EBF35,0xC732149887477895,0xA2EF049C1DD8184A,0xB5C6A396DC13C20C,0x89AF0F607E299CC8,0x6F9B755DE4F91E3C,0x1C077605BDE094,0x952A55CAC9AEF36,0x31F088566A6BD2DC,0xB890F8711C9C3456,0x2FED3A7BB8CFA33,0xDFCB1AAFBD8ABCE,0x99DF472F396DC7F3,0x52B63C942FD0B557,0x281E7E43CAC4B0,0x5978C1F75563F7BB,0x75C2C0DF31E08FAA,0x3C49B71C289C399B,0x47A2F38A57052D4A,0x28D176D3456BF17C,0x4775E3396C4EAA0A,0xCE8F8B1CE23B66F0,0x389A3A3CA41812,0xE2F46AF7317706C,0x73484FC61170CAC0,0x3E8A31624615BC6F,0xFCABEAC4C60CA406,0x99AE0DFB7408A5E6,0x3692E50708FCF9EB,0x4D3C4B3772DF2FC,0x10D9196CA8205D,0x160BE86D2E62F6F4,0xAC7F545F3F5B9AA0,0x559553F5AC2140DF,0xAB65BE5C8CF81892,0x6B0D0D3B48E2F110,0x4C3BC71E94259757,0x291BFFB330CF660F,0x2E02A98481E1B,0x70549F03E5E9E045,0xF4CE0B2230715CC8,0xDE3DCCA8618E7D54,0x5A68AA680A710B3C,0x3641DB007C6E4F40,0x12E4C045FF98C5D,0xED51C910293CF685,0x12A245E044DBAC,0x95AB9DAFAC8E170F,0x9E5366EFBDAB4DC0,0x32C6F72EEE9A92AE,0xCD45A3535BB9B950,0x8D00C962997A68CF,0x237518D433DC3FFA,0x4D9A25185D3433D6,0x29E1700DA71B76,0x1DD0D1D3BC86862D,0x95533F75EB7BCFF6,0xEBB1D3941DCA68F1,0x737D9446E10E0195,0xD6CA45F1FF8CFC20,0xE8E47311ABA458F7,0x59EFD88687A0BB1E,0x3D64129E52985E,0x947DC28D4E3F82D2,0x6CB566146E586314,0xD7C55E6E6BA4BDC7,0x507436F7929C1FFD,0x6317BF815C3F656E,0x651C24591FA94821,0xDB445A6C1F27861F,0xC87893BDEE02D,0x2B65D4F0CBFB5EAF,0xD2477CE367A6D72B,0x5D76AA0E6E3B5C86,0x35B248558D060F2F,0x76B3562BFD12E042,0x79C5D1CC53BC887E,0xE8E07A4E0F9339C0,0x3144A1BF00EC1B,0x4D604336A63DBE0A,0x9E69AFD8A30B44A,0x5DA137373FC78A24,0xFB10C32154311A03,0x758E2FEFA7E6FF22,0x90B5F6255C623CC7,0x3B4685648365A67F,0x141F1A5C0ED838,0xCFBDEC07A69C889F,0xEC398AA4419496FD,0xD2BF5A093D59E94E,0x8540005443DFD62A,0x2267C59D674010C9,0xA6F33EAD33ECC0D8,0x348F23D0936B3DA3,0x4BD79F814FABF,0x6345CCE818CD838A,0xA77139FBFDFAE957,0xD25FE3147FF7D96E,0x4EFA0CF7A6112475,0x15C45F5085E4A353,0xE73732C9CC5FF269,0xE996BEFF106B871,0x3B652F519A5BD4,0x1A95BF497F76A1FD,0x1F70A1551AF38EB8,0xF50065E7EA6CA3E8,0x25F134A35B99076E,0xBBD8FB6376E525E2,0xF0FFBCE10A893019,0xAF2C72ECDA2BED13,0x278CE158ECC0B1,0x4E56A23754122DC9,0x8D22FDA95CDAA59B,0x544A5868410737DC,0x23AD95582745F993,0x9D929FF4AF71F8FF,0xDD4E9E6822DC352E,0xB634B894F0823CF9,0x3FCA0B549F2A3C,0xFC2D3CC320508EEF,0xFE78A4ABC75D87E1,0x5DC21906431F9E82,0x230B3AB7B5D30D43,0x867399292F711EB6,0x66F179E6373ADF21,0x987DBB4389FEC706,0x3B8C7DCF73437D,0x384606D543BD113B,0x9095A60044A82B51,0x755D241713D2220A,0x83E6E96E37A241C6,0x154719F4C69FDED8,0xF390370BACA42975,0xC5542D3B476BE32D,0x3A0C9D9339AD97,0xF2197F41F902917,0xE09C353ADD496807,0x93DB389D49AA332E,0xEA608361B6EEB516,0x2098AE256672F468,0xC6BFBA80D643DC9F,0xDCD4780A91675AEF,0x14AC6F5090D8CD,0x67CE4391984F33A9,0x1EEB3E0DDD3759A4,0x7A388F4EB23D2323,0x4027D80BB6DF5B27,0x759314F330AC7E28,0xD0CB94B5A0A5415C,0x65D7234F80A5F6A6,0x25CDC8BCBBC013,0x4EE8B7AD41B63A0C,0xF46B8E6BCB6AF717,0x861FFD8598B81072,0x8790A2E2C023EEA9,0xA38025375500E974,0xC928B19363D4384,0x4CEEE9AB84E9A4A1,0x67C7AFEF69954,0x1C9842CC007BD664,0xEDA4010DDB8B676D,0x1C5171107CC0034E,0x77DE5921311D28D3,0xB49D47A40A0A85A,0xB0147990253145C5,0xD44E2BC263BA38D1,0xEDD0F37A23DA8,0x753A7DE3AA1A2B7F,0x281F4A5EFDD3AD30,0xF0B660AB3DADB39D,0x6060294596B6BE3,0x48A3270D8B6CBAD0,0xD608085EF72BA9D5,0x8CD93CD661F1F1E0,0x29A05739DECE57
-			};
-
-		#endif				
-	#endif
-#endif
-
-// This is for \ell=3 case. Note: Two different cases must be handled: w divides e, and not
-#if defined(COMPRESSED_TABLES)
-	#if defined(ELL3_FULL_SIGNED)
-		#if W_3 == 3
-			const uint64_t ph3_T[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD] = {
-				0x9C988666C8802654,0x8184EAC95BD2440C,0xE200344E0D5D28F9,0xC9BA078F1956DBA5,0x2906BC1E03C540B7,0x547D46164CD844B4,0xB1F040F7A98DCAEC,0x149C072F5EB3E1,0x7F0D799C1910B629,0xBD86D4FE2D8DA37E,0xD093E71B785A0563,0xE3CE2A52349EBCE7,0x21843952BAE5404E,0x901EC526F4BB88C0,0xDA7FF2CC132EA904,0x36A6DB4332CCE8,0x9C98F5B6D5C81D00,0x1E85D999D78C8540,0xB72ED89EFBDC2D38,0x872FFBF30252896,0xE24A83FF782611A9,0xC174117B147D3FB2,0x93702F73CCE04D63,0x279143ECB8AA7A,0xA3B0A72938D02581,0x7972EA180357F6B1,0xA240CE057EFE1076,0xE0736E8251B1BA71,0x2D710EA358B4FC76,0xABB60C1ECD9CFE18,0x17AE912AF3591E5C,0x3E86FE0F9EB0B9,0xAC6B631F67D056B0,0x592176278AD019D0,0x8C681ADF943DCF80,0x8B534119923CBCFA,0x8DC5AC3D0DD5A847,0xB346DDF4C6CFDE16,0x1D852513DE83B7B4,0xECA0BFB5A4B7B,0xD2666711F049454B,0x7E454BE952117089,0xD3F999FFAE1B21CC,0x5CC07F0AE4984E8A,0x2B9C84A51DCCCC3E,0x1A76A2495250B61D,0x6F594C9CE6AEF270,0x155EBF4ED9D36E,0xCF0EEDEE483D60F5,0x4AFB2C4D7F9DB8D3,0x9658325FBCE90413,0x97130CF056D15346,0x9F94EF01022B7B86,0xF53C8DF574E06AF9,0xDA2ABF66E22C84E7,0xD751467B84986,0x507E896424C44313,0xDA0EA3BAD8D5CB8F,0x5AB1B42D97251EEB,0xF56EE4D0B8D7B88B,0xC1E1CE9F96BB65B7,0x1729EF296ECBF6CB,0x55AACAA7CE1DCB59,0x13017F00154667,0x78D22D0C97EBF8E0,0x18597966B7386399,0x53735DCF43F1061B,0xA5AC480D2846C991,0xC0EE9E1228E59BB3,0x4A161A71AC030EFD,0xEE9FC4D499C05B89,0x3F54865C2A4A02,0xDEBBE76F1D22A738,0x8C8CD4B910C8719C,0x38877D494DF4FABA,0x77F2CB203884E2FD,0x6353D7B8C6632982,0xC701C3FDC2597FED,0x612A54C833D66F28,0xFE5F367ACBC39,0x62FAD5A60041DA2A,0x7DD1A770A066F36C,0x566D7F581E9E39DB,0x2D7BC50C204AB39A,0x2256883E7DF85482,0x618034F61CAAF443,0x2DFD0844BBB8105,0x25C9CA351A2E77,0x546669B3472C36F6,0xA2E071EF3F64843B,0x9DBA1EA75EB35A4A,0x7B4651D77CEE37A,0x80825DCE2C14BF80,0x2E887EBD2669B73B,0x834813581E66FA1B,0x3139F77D99E40,0xA90BC0631CF6E5AC,0x52FA636BD1BDE54A,0x4569C1E84D737D5D,0x7AF91E7B8F45FF79,0xD382D3650601FF6F,0x41CBC0BEC2980F9C,0x645DC6F280A28864,0x190E4A54AA2EF5,0xE518AE940B80EBB5,0x8F15EE0BD2B84DC8,0xC06452E6DA589432,0xB17EC5E19BE7E192,0x9B49EE5A181C8D4E,0x1175EEF9987380D6,0x2265C9A44EC1C1E2,0x203D92A40728AC,0xD3C8687DDD8C0F3,0x1719CD406BFEAA24,0x42884019B6625731,0x4B234660D441FB57,0x434275AD468E7A7E,0x17A7296E893D8B15,0xC243EDBF870C8B0A,0x2EF57CBF885576,0xAD5C7265891471D4,0x29729F561C8ED100,0x512590D6FA5C206D,0xEB134103EA32CB25,0xE9241137F91476EC,0x38C7EEEB1E271836,0x5DFB4F9F5AEDF5F5,0xE5B36891B85CF,0x3AD78FFDCE75375B,0xB6FA684A8E9F7971,0x4808B4D98EDD7ABC,0xA8859CD33A43B90D,0x737D8D5E550A41C,0x63670E0C46594321,0xA2C2B55E84BA804B,0x1F73293B5D3588,0xE3B936DBEA5D1B2B,0xFE361969EB9A153B,0x60364FFA640EE8F,0x24ACD933CE45BE83,0xB6A042BD7209BD3,0x82522A1B55F3082,0x820244F73E8468AE,0x288698C2CBAE40,0x115B174D8BE8887E,0xC4509994CED876C6,0x81F6A9050C32625F,0xE12F6ECA4B5BA601,0x5FCA4F5B0CEDA62,0xB76C8398E23A1065,0x79E613D8DE35EE2E,0x31F6B174435810,0xCD09C27EFB4569BA,0x801BC242D4A240E1,0xBC7CECB19D0FEBAB,0xEF770D9F566CF40E,0x2D9F7EF61BF2510B,0x7B79B80AE1D267AD,0xEE8BF3FB6F61A79,0x1A7305A8B38DEF,0x62E0B307DAE8E929,0x327737D48348FDBE,0xCAE811F7A8359B15,0x7FB113BF97FF9BCD,0x14142F90896BD74E,0x2400F3C256E311C7,0x5368A50F2817B421,0x39E0B5E5DF18EA,0x6671633D77B71F3F,0x2205E5F39540643A,0x400ECAEC05E94E79,0x581446F77AFA1E71,0xACF0CA2CCD7D9263,0x87BA351589031753,0x8902F4BF4223B754,0x1F0CE138A430CF,0xF304A171E9F7AF70,0x46572158652C9587,0xA92CCF2E7EE0F8E9,0x6D060B26ADEBBE0E,0xC334BE167E88C81C,0x48685E40E8E64029,0xA98E761AEED92A19,0x3877A0759267DF,0x4AB164CFEC84DCEF,0x6EDCF2C6C1F0A10D,0x5D15DC872CFCD260,0x6F5FC91B80DD5BC8,0x87CF65FFE9BDD69F,0x68121155AED7F3E1,0x16B4F4CBF7BF6A1,0x1BAA62EFDFF6B2,0x9B296C0B5A1AC63A,0xC5716037BF82A646,0xA62DB264B742BA86,0xD12906CE154598EE,0xA7CEF23AE634A18F,0x6C72484F4EEE38C6,0xD139D576E8449DCA,0x3927CFCFE5E3CB,0xFC24CB6BA03DC80A,0xB47566D5B14A1768,0xE218F1668F74998C,0x8B78C509CCC58B96,0x23BE099151A6A8FC,0xF3FCC4F15F5CA7F2,0x6D3F3E146B3ABA0F,0x2348E2192D5E0B,0x9797B7CC41254786,0x6788012BE1026E8A,0x6613F2D7B29F2DD8,0x595D0587E9C6DB1,0xE06F5BE1FC396346,0x692EE10DA58ACE84,0x4B4601C57528EE5E,0x1702D2CC5ECBFE,0x9BC7A1E7FDC0D446,0xE5261774B2E7FDA9,0x4328AE86AD85AD4,0xA1E4593DB83578B0,0x23B7E31E6A9E3FD4,0xDE8146908ACF95A,0x475DEF9BEA0750D3,0x1D8D5E069FD7E2,0x95C51F3B69166BF5,0x9563635268555CFB,0xF41684BF221BF384,0xA77B3A361E39BDDD,0x6E0CF1085DA7E0EF,0x4AE7109DBD004336,0xCABD5E8AF75EDD2F,0x275409E867C1C2,0xE66592A3729818BD,0xF2F0A84A3BE47DB6,0x841E5084367AF0AC,0x71935E86D1265F31,0x1B6AFF7139CF7969,0x256771B02FE232CA,0x21BCADED78B48377,0x2B02CA94A5432F,0xA4512247F22D5B84,0x10CCB1BFF38FAFEA,0xBA3EAA132959F687,0xCCF684050D68E311,0x80174653C92569D4,0x995827DE8A85855F,0x590585BB8E4B3CDF,0x1F8A3A82D05BC6,0x13B5E8DA288BEB83,0x648A5CF1B0BBF7A6,0xECC523F104342E64,0xF2839C6C4642C30E,0x8DB0BDE8549ED2BD,0x524E46D5105638DD,0xBAD828BED1BB06CE,0x1CADB13FFC683E,0x71D19B376C88BBA,0x47F4DAAF5882D067,0x8AB555DE77C837,0xED2F2F8968F214F,0x7B6D4873EB7FBC8E,0x24DFD97CC14249C4,0xE10235107426D2DA,0x2DCECDE21CD7C7,0x63B8BB9C1DF4B734,0xCDEC199282226A12,0x16348B5C1F98D48B,0xD2489DE3AE7D96C8,0x1C7A85E78135A32B,0x79372E37B9DE5DD5,0xA700310FF67EA5C0,0x48E60877C67B1,0xF519DED21AE6A5DC,0x226D33E52E876864,0xF865180314503DB0,0x575F2692E8287376,0xE101825730E5BB88,0x8804B0EC216C20F2,0x86D7569F65D0D2F2,0x2A86A266744DDE,0x5D0134D9FD850616,0x5CEAEEE191420E8B,0xA209E140D44D2E3B,0x9BC8F64229CC0162,0xD8BD0AD08BF328FA,0xDF36063C6BAE32B4,0xA762906814DD6BBB,0x204C7933FFA6C,0x105ECDEADD973F64,0x9B096698CB8E7F3,0x16C24B5F04635096,0xB9356A08C73D5828,0xA0C793F14B1E89BE,0xD3A9D3B77F9B12F0,0x233840E15E7E29A5,0x8D26781D0C424,0x84A6262E1E110518,0x840D1233EAA689F7,0xB2C4DB97B16EDBBE,0xDC19966D81F4082C,0x9B1960BCA1895A2F,0x7757002E5513C2B8,0xE541CB565F9913B6,0x1B11A1FFC00FE1,0xDE48D1616E75FF04,0xFAAA70535327D7C1,0xC50C4DB73CDE62DC,0x5D6DB2F874128FBF,0x7EBDC7C5983B63DC,0xAFE5BCA500081268,0x4D84B4ADFED672DB,0x8334C1F9AEEAE,0x74293120A4367F85,0x3D07C92720106B50,0x6BCB1C45E0276006,0xE5931EF2EDF65338,0xCC923B23A0FCDC8,0xDCC750C0B2BB13E9,0xABFFAD57D5D5DC98,0x266D24B6849A90,0x4FA437BEF8D3A76B,0x7CC84787661D284C,0x52108CA30780A2CF,0x1CAB4D374FB5B34B,0x21FBA05A9EB9F527,0xACB30B22FEF1801E,0xD4776876F305EB95,0x3866120407F95,0xDA778B113B76319E,0x3A7211FD762C5874,0x2E6B7D7E23BBFEF0,0xEDB6A525B77046E2,0x55CF08AF7E3AA71E,0x43CF6783D64453FC,0x20EE50E2F873B410,0x3AA734148CD1A9,0x5F8B2DE052941095,0x46A6CB34FECEF48D,0x4ACA1371C8CD8EDC,0xB8885DC889FCDFB2,0x127C8B5F9C7D3CCB,0x4BE1E0754F15E940,0x937638741090C250,0x12FF3F46E9DA9A,0x6B20A65CD8EEB5BB,0x2919B0DE43A052B1,0xB839E592F1221A2A,0x336AEA552382BD46,0xC3CE96940C2394E5,0xBB390BC5230117D7,0x38DC27C415D696B3,0x1C3528B9BFBCA6,0xBC50E2B04469C326,0x9889AB899D91C771,0xFE38AC4A165DBD13,0xE634885E9E9F49ED,0x6026112EB9D2A21A,0x8F9FA6D5372F6DE0,0xC5520AB13EF93D8E,0x2E31B822BC03BA,0x21B82332FFA4A26D,0x2A25186D3D4AFE31,0xF643CAF1F61965CB,0x7091B9041215EECE,0xFBB4648562E01C2C,0x9F53A9C32E6A38F7,0x4BEA434E4EC6B476,0x244D9A31F528B7,0x5458C24D90879F42,0xC2FF2CF799A6A69D,0xA087FF0C6476CF51,0x931E7CD1F9E934E5,0xC176213F95E5C73E,0x8766A202B83EAFF8,0xA157CF81C64178CA,0x5B6238A0B48B2,0x96BD0016BB6A5FF4,0x8B08D7986041D4D4,0x928CB1C422ADD4CB,0x15C4565C769768D2,0x6C85EAA33F5739FC,0x27142F4A9EC2B508,0x5A1E647775C9B57A,0x35324392705CE6,0x4E4E140C02A95632,0x689A034D3F21816E,0xB8E8BE5394BB20F9,0x4C932F28D0730008,0x29DA7FDB4788DFA,0xD2CF146118A17A4B,0xF89667A3C3CE73E8,0x361D33F76E8550,0x276298EB0C587937,0x557D2E1598FBE5D1,0xBE71A7924B569EAD,0xD06044A78DBB89F7,0xAFEDAD73544B4B2C,0x97AC7843D395D881,0x6B5322DC368E296B,0x1C933EE316FFE1,0xAE3819A10A74BBE8,0x56FE820EFFDBC28D,0x31A950CDEF516164,0xC33E61FE2718FADE,0xD7BE15AC8711B029,0x9CAFACF9BC5F192B,0x29B3F0F41639A36B,0x70A7967090ACE,0x8F2CC8DC8764BFB5,0xD48D146CBDF39DBF,0x4B2C30284D501590,0xBA91AAB6CFE68893,0x3EDAE1C3CF02942A,0xA1B8B073F56A9B18,0x340465EEC0CCBF4C,0x3407C5089AF8D3,0x9299B5F034A9F886,0x7BD264F43623BE,0x54ECB2A746EE1166,0x36F2C064E17037AD,0x5D5514E14CCC79E9,0xE8B71B008BCFC5B1,0x8BF40408FD697046,0x392928FDDC2D97,0x11B6001D8D68179B,0xF92DC485239063F6,0xB7C8C4A28BD9FDE,0x9224922DAB3773F1,0xBC483731A7A1C9C2,0xFBBD8DEF671EC174,0x1658844308D791AE,0x3F7C08A4AA5345,0xB9DDDDA6C85473DB,0xCB65A9A1F96A92F9,0xA092CCBE6B802EEE,0x3B1DAE43B1567BDE,0xB5DAEF6B1C3F83C9,0xC81278094AD73C1B,0x1452D49AFD88F732,0x25C42713ED67B3,0xF3994959917A0793,0x63AEF5702EAAC7F8,0x3CEC8C717A72CACF,0x4E30984A58DAD801,0xFC0E9BF701BECB3D,0x3E63E9AF82D17496,0xEA5EDA304E8ED77C,0x344495AA4FC389,0x96CE8DDCAE7D8BD0,0x51DECBA3FB401E1C,0x7E9D5CCC2555E2BE,0xB356BDEC3F5E7900,0x1ED724E8678BD786,0xA15E2510B6C0D559,0xA568134647B5E591,0x217EF93EF14E04,0x937A8503C47B576F,0xC8B9BECEC58A61D2,0x3E64BE43CA0284BF,0xEDC5075D49F58553,0xE7F60A1DB59EF562,0x2FC24FD7104F9056,0xB381BAD353A3DF93,0x2E806725885546,0xEAA9CF88045980F0,0x9ADED2BF8AFFCB79,0xB7BCFA54A15EEC17,0xE2733A005EAD5F41,0xFE4A7A957485E989,0x16BC1F3D5EB4AF48,0x684C98980C03FD0F,0x3D521701E4E5B6,0x8051456501547900,0xDC8A73D662C69E7E,0x93A9B69C7728597F,0x7029095B70E31E40,0x7FE593FFA978B1A5,0x5BC8D96F0718EED3,0x4C5F360AA500DAE3,0x18EE82DBED1799,0x13F2282A400E16E0,0x84F8D3EB2A9A36ED,0x70322B55ED127FA5,0x7830063E2A51900D,0x291DA19E130F7620,0x9191F2851DBE2CD9,0x940FA686823587D0,0xF751DE1DD5DFF,0x20C20D8E6C76BA20,0x51DC8AEE9765434E,0xD87C05E3DB5636DE,0xC0F808311B3486AB,0x130FD48E4F90B381,0x87C59B37BEC82FD1,0xFA7C0D10E7DDABD5,0x385AABD1D57A08,0xC1912C116309310,0xD5D79D8C99934350,0x4C80BDFDE20D38CC,0x9F78BC8C1E0586F1,0xBD957AF3EF807415,0x4F535CD1A44FA093,0x26F76D0A1AB3B6CD,0x35FEC54C91B5E0,0x9A1AB6D416723262,0x619F15F5069BA794,0xE07686BB277ED2E4,0x1F393BDE2257E3B6,0xA84C926A905BD872,0xBB57E1EAB530E052,0xE409E9CF6F9A55FC,0x25ED050273DB29,0x82A8DC3AABAD28EE,0x88CED05DCF79A42,0x87576BF3681E69C1,0xC8454429222D0447,0x4884F2AEA6FAB43B,0x62CAAD263C34BC5D,0xE5798F2078A04EC5,0x1A34746C6C9F38,0xBAE387D45608BAAD,0x8398438AB497F3CB,0x5835733297A1E400,0x129B2AF745751042,0x8AA934C55B3F592F,0xC96B90298BB611ED,0xDA32D56CDA5044D8,0x316EFDE345F34,0xEED2D8259750921F,0xEC1289BCE5BC3622,0xDBA842900D16425A,0xF723BAF02F1BAD23,0x53A48A34C1DE758B,0xCBA8C0268EEBC8D7,0x2AE75F46B1D7AEF8,0x6077477757227,0x7579F7E16970E26D,0xEEDEDC64272087A4,0x618D07BE03FF9EE5,0x59A69F70A833045D,0xC7507B7112251123,0xD8BDBF0499BEF8FD,0xF2ABBC486715D98E,0x552FA815EF81,0x7B98045A1010A86C,0xC16A31E405D862BE,0x8D3CC3F2D533D8FA,0x89524BBEDFB65969,0xC6F6ACF04A4476BD,0xC8A13A02A78DAC0D,0x54DEADA757C7AE18,0xCC47B5BE55160,0x1035463AC199806B,0x43A35F65253FD7D5,0xEF022A4EA7B26B54,0xD1412B8F896CC5F5,0x64583E4B4D59CE9,0x7E651B47A7B407A7,0x7015FF70C1F265F2,0x2643339AA920E6,0xEF127BC173D940A7,0xEB3E2F7469CF8CB3,0x31E3957E7F84D69B,0xA8A9BA9BAF6B4AC4,0x5EC97B707FC3DDBE,0x4AD15BA591FB892B,0x482B08F2DF1B756E,0x19DF99319BC129,0xC8172326F3491CD6,0x52930BB820E78493,0x8B0038D89A0EB1EA,0x5A020D57D0CC62FA,0xDE2B8CDEAF280463,0xFE9CAC8EF3127068,0xF91069FC2CAE71CB,0x2B3986FC4F1394,0xB3ED8CF237A39315,0x47B04264DA66466A,0x1630C964D307B36A,0xC8EE02806532B371,0x95F3C489BB519B1C,0xA2460BEBE3C680CE,0x53895026258E6836,0x2F198CB69F51F1,0x47018574647673D6,0x1483E00852D5F2D3,0xB47D96B22572CD53,0x873BAD5E0AB90379,0x56BA133F91D24DF4,0xFE113882C1D85A41,0xD7F2842D5EF56E8D,0xD0900181A7C11,0x6275D3FFC23D9CCD,0xF5669C1E670EEBA5,0xDCB9F0DE83569AB8,0x6C9310E39B7BA72C,0xDFB280D8305BA625,0xDEE0D20F39EE3D,0x9717B143A8066C48,0xCD1D41CAE0473,0x6CD79CA56FFC213E,0x3D29686CD7BA4845,0xEF2B0FBEC57F4178,0x8725522DFE92D49B,0x119A7D5A7E2D2BA0,0xBA07BBF43C9051FA,0x273F57CE9F064A0D,0x2ED9EF9866E98D,0x10CA791633FDF14E,0x51F12F543D804262,0x8D6FDA33A756D755,0xD59A984A1080E7D2,0x3E12A219272B4FEF,0x8E7A2FA82BD11C50,0x17D98D5ABB1145DF,0x2745751553309A,0xD84D01D434A22E04,0x73798E81DDFFE7F1,0x41BDD2888F72BBA4,0xCFBCBD087645184E,0xF9B8AC2EB3054D14,0xD870BF19E2FAFF16,0xB0AB37DAFF08D511,0x19312E7C023D7B,0x31397522C95E6D54,0x4797B3C3FEC67D98,0x4FAF12CF3E03A17D,0xF14591513663E560,0x817F80CBFB6D9CF5,0xB66F39DE310B3A85,0x1B52BF13211A6659,0x3350F5CBD5C701,0x291F2583FB04A7A1,0x9C1E81EF3193AED5,0x13C82698B8F1E4BC,0xB4B32AACA4BB9B50,0xF136F58AD3B55ED1,0x7A1AB8840E88CCC2,0xA0A827373A3D3A2D,0x1D1CD00A7E4CAF,0x947C230F07E07301,0x1867108A6274B06C,0xC056F7927F506061,0x1D658B0C81DEBDE8,0x3FF9F1CFE8C73020,0x54833D9961BABD97,0xA7AC2F5E60ABA1D5,0x1215E63E0E5B2C,0xDF97EDF082E86F6E,0x7BC7A6424474E2D3,0x89E4B398D8EEC06E,0x9D3D1CC1D47EB5BE,0xC76BC08AF5400645,0x31991DCD646B48,0x65E53D0DD879B23B,0xF239EC8C6C2A7,0xC535E951FFB4CC,0xA1D6A61B6124D726,0x3D2B8876B7D1C854,0x85EB53E4848D5B8E,0xBA61FC77C76BF8E,0x1D23AE540466AE00,0x81C352B8F029CBC1,0x28B28CB3883FBD,0xADB160ADA9251D1A,0xC4CF52FD6D82B6A1,0x31FA8C045CB15931,0x92C11807DAD5CF6C,0xC0E59F9441D5E67C,0x880B0F7B9DF35000,0x56E5EFA5EDF791BA,0xFD0B25C85A0DA,0x513B7C736C47BADC,0x28EFE9D56FE46C19,0xE3C9247E13318CBA,0xFA3E529DB770E89F,0x4FF8758671657366,0xE7D4A1F1151F3B45,0xD4B30D2E8AA93110,0x2D42AE21483935,0x6F9146F254DF7336,0xFFC47421C91D64FC,0x4DA28159C5F39A52,0x75445FFB58F9AA0B,0xC571049D312C3B2D,0x805913646A362EED,0x16559A89C75FB6AC,0x10F463E912D546,0xAB643B5ACF3FD087,0xFF9B2ADEA7888157,0xACCC22B49AFEB447,0x5DDCD039CA1F339F,0xC8251D3F24D4C443,0xF9C0310C714FEF95,0x85AE6221DEACDD46,0x3FD79BD84604EB,0xB14492FDBC8DF1F0,0xAF11D3EC05267172,0x1E7CDFE9144D5054,0xEB5CF1CB85712076,0xB6DB3949499EECDC,0xE6CB4261F4F3B051,0xC07CAF8DFFD2F7CC,0x21F238F422B413,0x457C7115F0838AF6,0x4C4C1770E8CA040A,0x403CF759A6104A21,0x7472E1978FB6B02E,0xFEEFA04CBB5B4D0B,0xB32C0ECA7252AE3C,0xEF7140DBB4073CE7,0x1DE1CDF3035DC6,0x7ECCD51E078A9E59,0xBB1099F06E448284,0x8BE3D916700CD9C3,0x3D1D1FC322CCFD0E,0x4B8952981228A7E1,0x9628C1F7D306F574,0x8507B98835A012F,0x1F3E48B105EC56,0x2B0BE2AB44914502,0x7D290C8A70A7E88F,0x2539136933164827,0x8266DF3B3DDA0BE3,0x52D65875C32150E8,0x175273BA8CF8E157,0xF63EB07229AE242D,0x3EAC9955B2482E,0x668A8AB86C3DB03B,0xAA379B8FDB78EC54,0x7C0420CCFF4368A6,0x40ACDACF8161D2C5,0xDCDBA7C6122EDA28,0x5773807BD32D42A7,0x3827605C4313670E,0x111222B06F1CAC,0x392BF19560A0B9D0,0xC8BD13BBD84B1650,0xC2BAEF239E9C02FC,0x719A465840CF85C2,0x73BA21420AC6D862,0xAE2F62B6486CC5A7,0xEC7DA6EE877FD3B5,0xE16E9D7757673,0xA9099067C41759C9,0xCD209A5C1CE7D1C5,0xF58A57231C712A22,0xBF4228BD14D563AB,0xDAA01D99A650BF4,0xF8F5CC9F2C21D4AB,0x22F5567F772BA57,0x1370E63B23ECF1,0x67642E57345FB7B,0xA71A13C191361495,0xE0644A307DF53ADF,0x205A5ECC872AB40D,0x712EE262FE9A5B01,0x8715A7EE8DF29575,0x23A734C0CDF88B19,0x2D43E8AED6D30D,0xF54E019F3B773F08,0x78127CDD7132926B,0xB99D8C3EAA94FBC7,0x952704A97C114B98,0x9B7491E6F4F037E6,0x64523A95616A3EC2,0x347FFC555933820,0x1F6DA0C8CAAB9C,0x2D058314B1ADF2C8,0xAB53561AB6CCEDB4,0xE46283A8EBE208E3,0x1A28331A08F53D67,0xBE884A7C7B2A197A,0xC486480EEB9F0B61,0x734947E4457B18C5,0x10BA50EF7AD378,0x9264D552273DAED1,0xBA069046A80178E1,0x42C0E9A102AB63BC,0x95E0A52E80D37A9D,0x9450AFD671DD5074,0xB753B74DE0321011,0x3504AEEB6BD96B45,0x3423474CC6E6F7,0x9007F999027F897,0x8E5B0A541A0CBE42,0xCE4EF467B788BD12,0xC91D7FFD908F1533,0xAC9498C533075F8A,0xD8306755963BFD45,0xB5F9EF334CAB19E4,0x1B9E78D2DF44E1,0xF03AA0062E79FAD0,0xF53115A85B094C48,0x12B60D87ABEBB80,0x47D14E2B489EC005,0xB063352677CE48B1,0xDBF1C17EE02EFF68,0xC5A8A727FDC5A818,0x2BFFBDA81A0188,0xA0A54FBAF8A49E28,0xE8E0FCAC57476E5C,0xF01BA86646DC1AB4,0x34FDDBB6E56DB28D,0xA31C86F1564B2FD8,0x795903155F7DDE2E,0xF4FDC6F44BB87A82,0x16CAFB8532908F,0x9E1C80B7C548CB65,0xA3E7BF864B205771,0x9B7BE3036768029D,0x9E8F3F73283354BA,0x9F7ACCEDE4F2A473,0x2F3A47011651F569,0xB32535A37189BFCC,0x17C17FBDF2F728,0x87B2203FBAA7F7D,0xD243B87F1E8B6085,0xF5713B66BB2CE1DA,0x23E1AB8AD30BF23F,0x8E3FAD35C01CE670,0x6F68944D78D3C537,0xCDB37F1A000A161F,0x2CB2932FE49923,0xB200437BDDDE3539,0xCDF8949F4EC912C1,0x29FB48774A3928B8,0x1CBED14692177C8F,0x7FCD2DC8BFCBA461,0x2054A37C6634A25D,0x4274A9D0FE8B289E,0x2BD1CBB1134DE5,0x25A23221BD1279D6,0xF0D8520190368D58,0x664F693E3A9D2726,0x869DD7CC00563100,0xE2DE80B277F51953,0x16CA256A2708A6B4,0xCF5000FE7732E995,0x3C37DDBC374C60,0x45173154DB7EFDBF,0x9BF69F6F54FB713E,0x3447FB1462521F09,0x6342F189C55178A,0xA048544D15B7CEB4,0x3F29DB91FBFBBD71,0x55A6EEE17B5E6D64,0x91B97F71EC248,0x422E87540EA88E15,0xCAD0C6350B61B87E,0xBADAE7C7A5EDFFA6,0x49155A48CC0B74C6,0x586E85D693A366DE,0xDAA057945EAC182D,0xAC741CE4A975A73A,0x19D4A752A634C6,0x9213861034521952,0xC0B2C2EF7006C4A8,0x8536894A64B3C5C8,0xF0095B061EC2B0D7,0x43C09C5DF4B30C9C,0x928A0E36A4F43EE0,0x1CCD3E8434DE829,0x30F4585AFFDAD5,0xC0159BFD212D8087,0xF15B4FE9A5537ECA,0x134A4C462D99CF5E,0x82BC290792ABB66F,0xCCDC54BC8D40B345,0xF07A69BE17DD14A9,0x33F64103FB84BD0B,0x39C61EDBAB4C0E,0x18656B1E2277E6B8,0x91B298224C11E521,0x7E40790389E3B034,0x77D6570F19F42E5,0x9EC2A2D8A2105E7C,0xE4AF514FA9ECB349,0xA305CC2E3B9FA049,0x256D361533428F,0xA4BC1E6963E5CFE5,0x4942E934A10DC70D,0xF10E7F21E99CFA36,0x6081B0FEABFDA38C,0x464BEA0E4973128C,0x7D911BEC2C4B73C9,0xF9D718DE1738CDA8,0x2389C5BF9AE96A,0x464F18B92EF07E5D,0xB83CA36F8150F09D,0x14EB644E75E58F3A,0xCB8DEBD2C9D30578,0xA8DF54DF65C10FE,0xC7E06814FDF07A5A,0x828ABAA5B45A8879,0x2598A35024DDF9,0x95AC51E29D35A8B6,0xF6E2FC3D6D73D7BC,0xE73B17B0FFD32EFD,0xF59DC9D0E6652235,0xCA06D4DDE79B0783,0xBEB696A80E50438A,0x322FB02A08193B01,0x1A28872CDA341D,0xF696C192C0887A8A,0x654AF1E6812F91AA,0xC168EBB7C7469C74,0xC65B754E6744557C,0x1835BAA5639EF2F3,0xC2A6E678801CB650,0x159E575F4C08E1C1,0x2CA55816BC9A25,0xAF6CB2EF06461E34,0xB596A24E2679C76E,0x75C3A72F4A1C7EFD,0xB19858E4362D78F7,0x22E8EAE57CEF6621,0xB6300290BF77369,0xB3D57FF29C5D98C3,0x351C499504CCFB,0x133771B8944B511F,0xC858805FCEA5E470,0x38667EC4287D2B75,0x5F21A34E2A1989E9,0xD73A62B940F31BDC,0x60AFAC4ECB5A4AA5,0xB7B170FD45FEF8A6,0x30B5D6178B52D0,0x5CAFDB07972FABDF,0xFA69D92233959B83,0xE66A8C6ABF572C25,0xF352705883F1C553,0x37DA29E8672B47BF,0x77FA05A768E29E7C,0x81319D24D3FBF989,0x13F821D8134867,0x6AABF483319721AC,0xBB8951899C3704B2,0xE6947AAC4CD0B6B3,0x4A7F8A5A4CC33F9E,0xFBE7AC73A28B7E37,0xB6B5436323C44AF3,0xC16980AFE07CADAA,0x2C4EA6C55B025F,0x9227E2A749087232,0xD8473AAADF1F0069,0x2AFCE4944DA5C0B9,0xDAA3712915FC5594,0xC9973BBA90322AFB,0x9FEEF1DEBBBA6D20,0x77631346538D3E1B,0x5120E95616261,0xDEB3DA5235B12F47,0xB1A01790AE46B7FD,0xE3F996CA3AA86825,0x2522098BCD20D198,0x4996E1037F196893,0x71767A1B7C5C5328,0x997E0B9220964520,0x3803605EDEAF45,0x5482CD3AEE93DBEC,0x9BEF115034D1BD7F,0x6F260E076EA4CED9,0x24B534DDE0F681D2,0x53B3B81537F72248,0xB1B74A1C7519E20B,0x76575B649BCBF854,0x3906A6A9D8002E,0xE7EB4BC2DD2B120A,0xE8E091832B33D67F,0xA04AFCBD4D04873D,0x282A8FD4E845D9E6,0x22BF2DC0FDDE0233,0x965193281C576578,0xDDD25BEE814A592C,0x2F8AA24883503C,0x2F2AB0B529798F11,0xF5300AFA3B37617,0x454D8B94787D8DFD,0xCA517000CE812977,0x7D34705C75D4D1B,0xBB6BBEE06D1B1C2B,0xDE54E7D73AF3AE0E,0x86964EEFCE912,0x6DEC6B9D809C8ACE,0x8563C70EE1D770B0,0x7B540380601EDEAA,0x1A97004C4E4B07E0,0x6321553FC0FA59FC,0x655963ED4E2AEFD1,0x39FB46D6AC01E833,0x2BF40FCE65E6F2,0xB07EC1B1B296535F,0xCB4204041BB430D1,0xF3BCE0C166BD81AD,0xC236566E0F43E4C1,0x82F4929E686A1B6D,0xABF2A275B9F5BD87,0x7049F6CB3817EA2E,0x3562CCBA33073D,0xFF5D322AF6164555,0xE7398CCA4407E757,0xCF8886434BED3042,0xBEA2CA762B9BC51F,0x2AF213CD45E77DCF,0x4243955E279CDF87,0xF7CC886FF7917F07,0x1E6FCE28D785F3,0x2A7C933FBB1BA7EF,0x944B07997D9C1D77,0xF0DF822AC5F72DF4,0x60C8E6633E3E1160,0x5C3533C42F80E53E,0xFBD5BFAB2658C076,0xBBDD1EA0BB05DBF3,0x7057E7F6E1CF6,0x6BBBBA28C9C6D941,0x39159EC8D8E9F004,0xCE49DADD9F06FB14,0x45A8B7092797D587,0x48735143B1DFEB7A,0xFB86FD812F17C86C,0xEE70509F6E09EF57,0x25B8D1A6FD35AD,0x69B952C47B02B27F,0x4DB7D8508B7FEDB2,0xE0FB2C8F3ACEA6F3,0x942BD1733D9580C,0x4E2A7AC88F06668,0x4567273F1FB74655,0xE0A7DCDADD6027C7,0x31C2A0926B0F17,0xCE15CD2408C92A1A,0x58594DA317F38FE,0xF1580FE2771C30A,0xD765BCBD6FF8E071,0x558B398C846A01B9,0x2F5ADDE2ACD87498,0xAB54030E8381F480,0x14EC1C709F089A,0x5347FCA735B4F710,0x52203F0620F416C3,0xC038EB8EAA425C4A,0x6263250616DA741B,0x40120FC2C6BDC225,0x4173DB5FD04307F4,0x9B7B618BC57225D6,0x35F28186A07330,0xBFD0E893356B081E,0x825124F051299D3E,0x34EC73A663CCCB6,0x35BACFFC2547427D,0x16FB915D637312C9,0x4E11D74E4CC3E4B0,0x69306EB2B9BE1833,0x193080EFE8B5DD,0x9FF85FDB7130B4D0,0x9709916E72B11371,0x8D8948AFEF7F5D07,0x2A9AFA75EC298272,0xE6758E77B2D9AB89,0xA13BD9721E345319,0xA830E2250C548C65,0x111F6A513F69A8,0x414C705E25A39274,0xEF44AECEAA03D4B2,0x2FABB5583BA685D2,0x29B4606D0E218A7B,0x7805394306E3697D,0xC67CE1B3A01CAF3B,0xF8D638DF0A93B157,0x209FF168FFECF7,0x40997FD0D8892196,0x8C7A9F2C86CD6F9D,0xD666057636AF6EB8,0xE8291440737EB15E,0xC76CECB72CB63D17,0xB8BA4948B37D136F,0x194A4E956BFF7E40,0x1AE02F85AE3271,0x5A438B08D2EEF43C,0x790C52EA48E84B6C,0xCF6F4596D01B6272,0x46FBC80CFE5D088A,0x79255AF2069077FC,0x224C8D304017F55D,0x567DB8CD03108282,0xAD734F5476B3B,0xE843830DD8A5F5F9,0xFE6559BC8BC47B17,0x514E32B1031EDB01,0x45FE90EA877EB0FE,0xC7339F2B081760C1,0x79C130FD54E6F735,0x1A96783C2E37F0B6,0x2BDD3A74D8B3E7,0xD3E6FD60D0114C74,0x4581388F89115662,0xB51E80BDE4009C4A,0x35EE446F49EF4604,0x9EBBE8678DBAB5B,0xC154AF57041DFE95,0x96F518CAB0E39A72,0x2F28EDCAEC905B,0x8A487100DF973A19,0x4803AF9C74105D7E,0x1B534682D296F141,0xEE90AE120A4A3AFE,0x94927D5727BFE764,0x297831360C6C7C7F,0xC5C44F0C03E9D280,0x3F00C0C12F53F5,0xD027E696C1E4E7C7,0xF0AC565027306465,0xF170451F5DBF6BAB,0x5E08B0BC4D5C621C,0xBCE96139D63CC3E9,0x9AF13375F0D11B4C,0x68C6AD4AEB9E2A2B,0x3FA6FBA42CD8EE,0x53B9A56C8E25926C,0x72BBFD85F7D0A7AD,0x3E0075EF665ADA68,0xCE15E2768788FB25,0x95423D1F27042EC1,0x78314E8A5816AC1A,0xC7CAA808BF594269,0x685B42CBFF91A,0x546D81282527FD3D,0x4A2E415CEC1E58D0,0xFB144E9148FBD8E1,0xC031579929C834F,0x3ED29556CC8D4924,0x845F9D9B08C8F7E,0x1AC9B60FA12DF0E2,0x34BF1AC488C540,0xC3E325665F5C6115,0xF5152E14B7B9570F,0xCB1AEF688D031AD0,0x879B9E5CF7B708CC,0x24E926D33F8BC7B9,0xD20F7D95B89CA941,0xFECF308130991EF2,0x20BCED2D4C9C8B,0xEECEF0D62956C2CA,0x93FB0B574F4853AB,0xAEFBB23913F63E0B,0x27D6CEB96AC95BF9,0x580F5253DFF664DF,0x59314AF0EA3ADE30,0xDCEAA4A81645FFF5,0x2DC2357C3867F3,0x40764B2FA0F76E18,0x3F8F168D9CCEADEB,0xA19410EF63E3640B,0xA4EF737A53D81E03,0xE5EA395F4C79A6C,0xA662E8B49F6E7A83,0xC1E26132AE69E9CC,0x248B12BDB89BBB,0x85B8F69C474AEFF2,0x4F66BA5B0B79ACC7,0x90286EABF96C391A,0xA7959A5C3AE61022,0x6459CCC668A8F29A,0x2F1CB00010BFA7ED,0x18192C9EEF8CB278,0x169BBA12E5D763,0x6AD3E8266617CD16,0xE6E1CF1BC2DBE391,0x4F7671D1B736AEB0,0x6C3F88DA878BBC10,0x5711DD39E711F2FF,0x71F7A521177373F8,0x6334A1F8C50E26BB,0x8F5128EBCD733,0xD8D0064288E027AF,0x5D5E74C48D079EE4,0xBDA8CA30063811D7,0x4B9CA7A0A61C8D8E,0x3F1B8A4F9430A55D,0x88BC460AE98C2E56,0xA6ADE8F69A7918F6,0x176525130B5A8B,0x9681911BD74666EC,0xF002A8EB5E1E0A4E,0xF4947C2BEDCD89B8,0xBD231E0C512047DB,0x23A30B4CEAB4477C,0x7E7E0213951E3C98,0x2048A3AE03AC3091,0x3D270F5318AA39,0x8332682F8369F2A9,0x96A5081BD097D4EC,0xA16FEB5BE629F520,0x758E4BC4275C3098,0x76A9D0B8AF4CD555,0x86B8A51B1AB53165,0x11B466BD9EFCB15E,0x241714617EA195,0x785E3AAC66F1FC26,0x885FB32301E22BC1,0xCA08C7BED20BB6F5,0xE69189699FADEB22,0xE28737663C13775B,0xC12825719AC8142B,0x98C910A816085BA5,0x3230EC8D34C928,0xEB0D21D824A15240,0xE2BD4B8F915C3C0A,0xA8C96549E962FD47,0x50D0CBF1CEB828AE,0xB0D110A2F6E14DCB,0x3DFB58E3EF5ADF68,0x43158B44C2637F08,0x1DAAE5C50020AC,0xDA77C372ADC9E14F,0x747883BB42DCEBF3,0x74E5112BD18DFB64,0x460D776DAF52AAB4,0x83129D780C7C87D,0x635E1A4A36CCF7CD,0x8EB397647BBA3B24,0x63714C69598BB,0x59A82A859C4BABD6,0xA6C4E14B286B55D3,0xF76EC7A97FA12052,0xA88615FC03A21274,0xF5F562C52C5822BF,0x552CD1DF69725FC0,0x420E5CAFF12C430B,0x3812288E4A2612,0xCA9642C70D05EE2D,0xB060A8138336082E,0xA2CDF9656FDE6123,0xFAF56F07BF55F512,0xEF707040F018F79E,0xF27F8A4E3193EA8F,0x88A3C2FD4FAA1E6E,0x2D739D43790C40,0x57A998E4D5793F1C,0x78D25970EDE46955,0x641037C96FBD2C58,0x883DCBC351BC64F3,0x7FF3475F20E87EFF,0xAFE21BDBF85978F9,0x19D6103430FC59D3,0x1F94B190CFF83A,0xAB88F77B26C2FDBA,0xEDE79AF03617A902,0xF37EC3626D7A1E1C,0x4943BD59DD7446ED,0x9A1ABD23FCD78A6E,0xF2664C708890D77E,0x5A60CA9261189FA7,0x16FC572AC2BBCE,0x7B78FBB90D61DB47,0x952AC14BD66BD522,0xD215255824BEC0E5,0xFB284AA1A4B55A8F,0xF2F2141A493D43E8,0xA2E6ABEC63EEDFA5,0x433BB256DE3D8CD8,0x3500D7313E9E72,0x23D0403D1D5230E7,0x937565EA83BD0723,0xDFDFFE4231E7C192,0xF7798B297A9E21C7,0xE1D50352A867D7CB,0x6E6609A1C80056B4,0xDE21DFA6C9E52B8D,0x1CCABF06B663A,0x504D8ECC484E6C52,0xAE488B6821196921,0x973D8BDCB52C6974,0x470C5148D31ED88,0xD8A5C703DC35385B,0x8451910D396BA46E,0x1EF2F3D721093328,0x33336983814CAB,0xED3D9FD6A65E1FD3,0x816460A10F72C7F8,0xD40B324DD4889403,0x339AD50F87EC1792,0x8247E7B8010265C8,0xDF760FE9114DBCDB,0x2C3EE24DC644B770,0x267BB338CA27A1,0x187A2D7EB1EB2B2E,0x2B0A22A8BA80B6B7,0x3CAB5F0AF87EAE97,0x307289036F31A7B5,0xDB1561AB3B276D50,0xA034F6F0370079D4,0x933A481579C04EA1,0x399044BEC2D3D6,0xE35CC12D0B552784,0x1C5DB64AB7F24E35,0x2E8BCCC9A97BAAB8,0x36E224E3B3502B27,0x5BEE9495A7A16159,0x373D1C510D6DDFF4,0x8CFB88F9C15001BF,0x2FFC2E04B15132,0xB8A3E62EAAAB9A7F,0xBFF4EB73F5568C0,0xA9C6057479E419D1,0x45EA0E2706F8039D,0x24164353292B4697,0xDBFBF0BCA03D1DA2,0xB14CA5C69BB36E1F,0x3438D737890EAA,0x1617D22C9CCF5E0D,0x5EA151211F04BC7E,0xB350EB6F06A72797,0x7C8107E6A57588D,0xAD02DC5A58C9F5F6,0xA56B221AB4CD1B89,0x39C7D78DD2897186,0x127620AF5B9765,0x463227B27E6547DF,0x1D048C82FA7587FB,0xF352849D4A5B0BB2,0xD691D27D7E8740F9,0x5CF2E9BF2D4DFC51,0x2F763D3C8C3C245B,0x3C1735A13D62E1CB,0x14A7C6AC9BA41C,0x343294BB2120B4B2,0x23FCC7F3B23C7FE7,0x2635097767D9A840,0x18C2B10F32E48092,0x7273D85D535BEDA3,0x34E12FAF1D0345DD,0x5DAE9A236624003E,0x12D37E3617D8F6,0x98978E55CB6DEE68,0x1D8435F7F16A6F2D,0x45EA8A4B718F1957,0x36CFEC299C2AC5F5,0x7549EDBA7473574,0x9B2B53F56BB1224E,0x4C8151E5ECF6C095,0x20DCA79F9E15F9,0x97BAD82028586DCC,0xEE5198BC272F06A7,0xBBAF6DBCC4EED809,0x1C1F8AFF16C74B8B,0x6BC90FDFE7635DB8,0x94EBAD449928C520,0xF6FA00E24FBE0557,0x29E3913615C01B,0xFD2C38F2F0CA3F23,0xF4393A980D3A9266,0x1452B9274BA73AB3,0x2EE2FEC2103705AE,0x33731C7FB8043FA6,0x4A870812ABA7C7F7,0x9A9B9E10ABCD8F77,0x31F51615F1D4B2,0xEF453B74AA481493,0x76CBD52CB9DFA215,0x12231C10CF8250E,0xEC8BC64E5DA5B222,0x6542BD0979A7DEE5,0x7E02D5835C65482D,0x5987732FBE5DEA89,0xD6BF844F7FAAA,0xC83DC96FD5E1D707,0xE5DE5513E1909B0B,0xB99124B36B2D67C0,0x4328AED8F419B1BC,0x9EFDE131C82345DD,0xEAEDC37337917C68,0x9CC24BCDA130F5B6,0x1FF89BC650D8DB,0xC667BFC57F3E7413,0xDD99A616321E2AAC,0x772FBA2D1E4DA5D8,0x5DD9C4765D780CF3,0x69FC833B2BF321B3,0xD67C24AAB278BF23,0x288855AC736926BC,0x2C619972C8511E,0x523F3B17CDEC2F61,0x1E6EC3220229AEA1,0xEFE76C67BA201EE0,0xB1B7EFEB18240BB7,0x4CD317EF18DE43E4,0x6DA0ABACE4D8578D,0xBCDE06656C3684B0,0x375C9397A30CA5,0x2DEAE115B7B0EAE3,0x1C4F29A846337EFF,0x5DF9F4B6F849ADDB,0xF9466E0D36BF5EA4,0xE4D75E0BAB97AAF1,0xA301839E037D221A,0xDDED265FC9E00427,0x2E2422F02CF2C2,0x2E55CBD206C84609,0xA332D896A91B35D0,0xCC8E0C83BB8FB1F1,0x8A610E2287996EB,0x4961A3E91A9A626D,0xE3EA66E5B90170BF,0x9C2D4371697253F0,0x34D934B1F8E26F,0x74C4E6E16949E354,0x3A08B2ECF5B5FF33,0xC0646B3960368996,0xCE83C3D589D1BC18,0x1313CD90D2CB1D65,0x4CB60CD0561A4443,0xCF36B25D8622E4FE,0x6D320A965A55C,0x9E3798D22EFF50C4,0x2A4742C863615666,0xE53B960AB6CE57B1,0x2B63090A6967790D,0x28F31D9C521225F7,0x8C4C6EBB01EB229B,0x58EFA3E5877E984C,0x1AD09C84055E5F,0xDD24CD8CBCC26188,0x708450105271489F,0x3F5B02D308D07A8F,0xB048EA39A397C38,0xB0FCBE0D305AB971,0x8893639ACB2B5DBB,0xB412057ABDCB1755,0x29ACFA1BFE8DB6,0x83C0F55848B571E9,0xCDCF75CCC23B338F,0x683973C0772F6037,0xF749EA89FF867493,0xC3E2E0AC1BCECF79,0xD4D55BA8C8C88137,0x7D7A7E6935CAA8A8,0x11AD18E4129EBD,0x1B3F96ECD7699ABF,0xEA09985233FC6794,0xBA234B03E3A477D,0x631DEF536C54AEEF,0x83332DCEF62784C9,0x3B3E58610FF1275B,0x8B41F610F86BBBF0,0x3598E38BE1EC13,0x167002F45AEB955B,0x72E4581CB51D2C14,0xADEC53676AAB4AB7,0xEFEDF179FF90205,0xBFF6480621E7AB17,0xC13AD050C82D255B,0xA8015AF0F4CD1984,0x3777F6D027BA55,0x78DDB8BBF8653756,0x3D844C4231F6FAAF,0x37925855ACD42394,0x5B71FE00A631A416,0x945AF86FFEFD3105,0x88ACE64BA0730378,0x74A831003F7A9D34,0xF33B833133BC3,0xCAC1C4F476C59011,0x4B21DEAC5304DBB,0xEBACFDD60143DA10,0xA0E5CAF90CADEBD4,0x6B772DB85723176B,0xBBEDA6D0AACCCFA4,0x33F7A4342FB150AD,0x23B36357B901ED,0xB459E7D41B8D5627,0x5309D80BF2663699,0x744089E66B0A2007,0x51B5D61BA0CD86A6,0x1FBB59A786090ED0,0x5ADC116E056D884,0x67FD72644FC479C8,0x1D2388AE014F61,0x4E183529639292F8,0x9CAC5EA013EAB40B,0x77C8C4B8DEA77FE7,0x9C4B69610FF0558D,0x33E587D2A37FD29A,0xE07BFD2C6022C7AB,0x9D6BDEE9D6F49A48,0x35D68D1E855408,0x458A3D98D32B63D8,0xA838410B982E7F1,0xDE2841B43633D8A,0xF123A7F3A06661B5,0x6B52ABA90B7FB4D0,0xBDB8E375C035DB48,0x28B4369BFF59D684,0x1ADFF8C4339EE6,0x57F426EA14F4234D,0xC9F946CA0AB90EB3,0xD1130798EB165F75,0xC0C906AA2FC8175,0x3D9CC17D594AEA72,0x5A00BCE35E76C569,0x4C2CF3785A8D23A9,0x2128ADDB4D3C25,0x27DE51FB2A06C4B3,0x5EFD3301BDEFFF9F,0x4B93439AD560C0E5,0x926F2C2A40883C7E,0x38F7B4E3BA249D85,0x66C2E4C31348C994,0xE093CFEBF89A2F4D,0x20A09F27DFDC1B,0x55AD51885A7EF5F8,0x45DBB03C6B66C141,0x80A432BD2621E1E1,0xBDC898DD7741C3AE,0xA12E96D26CE37CD7,0xA6546152514D1753,0x856263A987C0C0F1,0x156AB5FF5FC544,0x259983A4D37A984D,0xA153684E850D4358,0x37B032160EBC4076,0xA28B06F5BBD894F1,0x6507E0DE0BFD6658,0xD53133072959FA48,0x71D9D66BFC43FA2,0x47A716095DBF9,0x70A50009D5659210,0x9B02A28B6FC397BE,0xA2DB2DA4EE22EFAD,0x8FCE4B0EDD8D152C,0x6335FEB6C0ED304D,0x6844F3B2A7BD16DF,0x4E4AA5FAF34F9B2B,0x29AEF4159D8463,0xF8079D36464681B1,0x48C04553626253F,0xAA791F4A6DEE0BCD,0x3ADA02CEA507B80,0x49639116D89802A9,0xD6768C7D13DC48E8,0xCF6B8C7004D85C95,0x2443CC10FE6A0D,0xA8D7BDE61721ED3C,0xE1C332C3B9D6ADB8,0xE0E5332534A203F4,0x226F21D5ED9621,0xA9C35F71B2EC4422,0x637441F88F64168F,0xA1091EBBC38C6E46,0x29C141FE7A26B9,0xB82F2DBD897333EE,0xDCC638C156780F66,0x7EB98553D3794834,0xEB81482E59EB9C2B,0xFB4E8C6AC66AE2C4,0xAFE7E9D32E2334AA,0x4F0FFEA852F7C7B1,0x73A86D890323C,0xB3FFBB4736FA007E,0x269373A1B4C7A5CC,0x1E327EED97B6C9C8,0xC2DEFDD6AC9E8F32,0xBF285D47E33133F2,0xA9C6F4ECE708CC01,0xAE7CEC9D7C7D3AC,0x3B8FBF31668F22,0x7319A714F265C370,0x5FCE44DEBD62864B,0x51FCE4CCBC2356A5,0x7FEFB2F2F5DAB9B9,0x88F7D6A4EC75909D,0x16115711944ED60A,0x609F5050369D9525,0x3E3DC328CDADCB,0x5FACE985DE6636E7,0x621B2B8CD8E1FBD6,0x38D60ACB3DDB6852,0x2AEB6C37FA779FF4,0x67A841564A808945,0xAA5808F45F7AAA7A,0xE2859AC2E763E63B,0x110F7E96C1A71E,0xB2682FEF4F3CC3A6,0x3EC19E0A1578CED4,0x48C3D6053E04563,0x55565E9349ACB88A,0x8CD6E65D72F4F8F0,0x1BFD16AEEBCF0F90,0x9964863263B429CA,0x3637E592916093,0x5F1967B4111AECE8,0xC55248BAF1674948,0xC67B69C209830EB8,0x3CA2D031BB9F9E3C,0xBEF4506EDE520DCF,0x4A09029AC6BCF883,0xA0AB3962EBA9B3CF,0x2ABA11E8D3E329,0x6A0E8277E0FCE606,0x5E839D7204F9C4A9,0x3D70EEEB8FAA7C45,0xCBFD3ECC3C3899A4,0x7D86B8F18BAB2051,0xB94E1BAB194F8FD,0xCA4BD164D7D60592,0x1C66F1F7A00531,0x5F1E60C05370BA3C,0x856F31E1D7270201,0x1D32F6A78A10BEA,0xD6CBD4E1C79EC9AA,0x58333339D657D635,0x6699963180112E3D,0xD9321E86935FF66E,0x8F807608C0EDD,0x25DF614B42B2D188,0x9CD9701C4EA11FD8,0xD5828D75BEE68408,0xA8894EFD4B3CB895,0x95CAFB5D974BC03,0xEE4793F6C890C69F,0xC25B0CB0BBD4591F,0x2EEFF9D4040D7,0x804AC4EB3FDFC18E,0x1E1631E002DBAB5D,0x5A6F1A46F9FC43E8,0xE8588E289FB40C45,0x320EF031BF35C9D7,0x59D9590B3F6E049C,0x3C58A7F6ADC5CD40,0x166F9F12CD08FD,0x3C46F6BA05079838,0x75F5A8E61C25FAE4,0x521F8B89BD6A5BB8,0xB78DF922DD5E61A2,0xF425E1BA7BAA0E37,0xA21DDBD60E1DA995,0xA6C4CEF171F50D8F,0x785C0B1CF9A87,0x4B2101F16052649F,0x8884B18A63767CCA,0x46EE29FAE4FE7859,0x63C4BDBC9B08DF7A,0x4743ADF1BD61A971,0xEC47A698A68C224B,0x912914B0C8FA339B,0x22A36F6877373,0x7B7A76C39D8E2302,0x38BE719C00C8020D,0xB1E7888A6D95EC0A,0x1BA23A449AF34150,0xB3D1E419F3849CD1,0x5A372AC73388A7C5,0xF9F76424CAD3D353,0x156E3635050DFB,0xC0D8AD7B16C65F7C,0x4206EBE54DDD8F74,0x92920686F3788C30,0x7636AB0BD81C08A8,0xAAC359F9311DBB6F,0x278935545A75281C,0x69D1FA9E425592B2,0x3586B457CF47EF,0xB10BCFC84E6F1999,0x1364EF77044F3A65,0x7880A0B8A0301FB3,0x952F70050F169453,0xE08237BE978600FE,0xCBA64CED62CC30EF,0x9B8C7F74CBF20664,0x38160CCFCEBB46,0xDE8BAB8031491529,0x17329AE4D8E13FD2,0xC4D6E194AFBCE4ED,0x1E589395B04DFE86,0x96D44D7EAFF398F3,0x85E3A9EDB50C3ACA,0x5FDB077060841F58,0xABBE6C02ED99D,0x2A0806982F23AE77,0x2C0EEF507AEB18F,0xF53AD23505AB7B25,0xD029BA45B6CA832D,0xE236BCCC038CB5F,0x22523BA3EB69CC1B,0xD26C8A7A72A8690,0x24E52F10C6FA14,0xE6299F922D447564,0xC579E826E699C6A8,0x8257879C54417F57,0xAF1817C78394BF24,0x5477DA8C85158334,0x33FC13E1B99B5874,0x6118A138FE3A2F80,0x2247F34BA489D3,0x74CA3DBC89439024,0x86D287AD60B541D,0xFBB49C0753874738,0x551F5839A25B4C5C,0xF3C1AF9B43C94065,0xF1D558AD7A0F921F,0xD5049D9EED8FFE1A,0x1E530DCC835DE5,0xD0E8EF68C705D14,0xA6DBBB83BD0CEBBF,0xD6D6C0655BE6388C,0x555C5BF1A8962399,0x4ABBA45C8F9147EE,0x30364A2E619B87FD,0x83652C0AF5BEA2C5,0x3A7A0CB30E4E49,0x3E5B446B17FE1AE8,0xF5E4BF14C76AFBC1,0xB4E93CF6E26BBDE7,0x429238E07DCC8581,0xEB4C1FE51EBEC4E9,0x9550A4F037E02339,0x2A732543617F4432,0x39AE7DADC580CE,0xBF7CA64B337114CE,0xEB7778AFD94739CD,0xE77CE7C37FD9CEB0,0x65442585B2ECA7B9,0x6C682954559A7938,0xAF4A3BF79E67B288,0x29E4101862445B33,0x3584F804E59E70,0x80001B3F64C916A8,0xD153584E5161BEB3,0x533534D2DF127AC5,0xA668754826C86E07,0xE13E2C7F8A87DAF7,0x6F124478F2848F9,0x79EA1E844D40A447,0x866D1CC7E84E3,0x9FDA8190E8A871D4,0xB267EB52893C0D96,0x71FE8D8762150B3B,0x544C73D410570784,0x8CB6BEFE81C5C0AB,0xD8D401D9775009C4,0xF057A095749DC4CF,0x2C00B0F0026D7E,0x32B4E9B4BAD0D363,0xDA9C670DC2B16573,0x1CE1968EC5C94BB2,0x44108222A3F6D620,0x2864252370F5AA69,0x3F4AE00D53FFDF40,0x6D51120D9D0089AC,0xD7DFF8DFE02AE,0x7A17A2E73A936FE8,0x104334F85647411C,0xCF6A90DF2F4F5A63,0xC8B8AC6BD96E5FCB,0x6B72EF348EEC4FE3,0x90565DF3C5B7B114,0xE8FAAC9428C1ED16,0x2D5CCE44177E53,0x90DDF310113D0C17,0xBF8A76BC7ED0034E,0x2C9316E6F1C21292,0xFCB661BA4E3CFAD9,0xABF3F2E2C5490261,0x22F4B218DA01AF4B,0xF21019D2DD882AD6,0x186029E5C8412B,0xB1C85ECCA083486C,0x567F4E6CFB7346EC,0x466A444C27990320,0xBA74109422332CC9,0x1BFAC7C2E68BBC29,0xCFB070E4C6115A8E,0xFE0A515DFC7832EA,0x3D4F352F89FE34,0xD82612903771A5B8,0xC235014774D2C3EF,0x4A3553AC7F384349,0xF9A9E196ECD9BFC8,0xAC4DB72CC5C8C623,0x128B0155AF538C33,0xD579CE36D5395352,0x199948B1B0215C,0x6A4A65F3A490A618,0xE359D4766F34E4E3,0x6A0A7F83F80CBB08,0x19B3D9CC2E39D68D,0x43F16323354ABF3F,0xAFEB65CE644AB47F,0x8A533AF56F068D83,0x3EAA1F0D55C2EB,0x2BC5158988F64224,0x200EF83967C91274,0x2739E99F8EB889F1,0x72AC63DDBDABB4A5,0x38BA2D9BF86CA69B,0x7461FDEABF1796E,0xE4FC0C1C4A6F2010,0x1CC9C4E03B46E3,0xC290622E399326EA,0x60AF2EC206BB828F,0x40FF4999C689A908,0xC95C9D133E08CE34,0x70BF73614AC72150,0x4ADEBEFCCB77DD1,0xB3EF7D6E0C0C147D,0x1196BA061D6298,0x7E6280BA027A5C51,0x850C067BA907032C,0xED96F7B7BA9856E1,0x125FB2A22F0927C4,0xD140D87A2752325E,0x326FE5CDA7A1D09E,0x7899E9CCBB4AEFF9,0xE051F2C6B72F3,0x4CEE586FCE20F669,0x289E06D4E8295DA2,0xBA0744573458524E,0xFE380B7DEC54D90A,0x64D5D5AB0FDC3027,0x1A83455E7ACDBFB5,0xF5BEFB72381AAB6F,0x979A927DE48BA,0x2A6B0A268BA5F61D,0x1390AE29CD97D49C,0x3F0F61FC0863DBF8,0xF8785A823D6452BB,0xDA65A8DEAA8BFB5B,0x2416F4B1C9167717,0x2376BA30E5E3FAE8,0x4015863C817E72,0x8D729540251D2F78,0x49C6D68FE48643CE,0xC4E27AFD52D67C9F,0x9961CC78B00D1C41,0xEF33DCC2EE84A883,0x9FE49ACFBFDE5F0F,0x7B9496B807A348F8,0x2771DDA67618DB,0xB02464D932AB94A5,0xFA745D755D639E54,0xE254533D5BF2AFC5,0xD3A09A89FFE5D92B,0x8D4A00CD9D528358,0xCFEBBF04F13887B4,0xA29AD7EF3054B273,0x79E87348C343F,0xBC35D3C102025F7F,0x4CBF1CE8C10FCCB,0xA49710AE8E6302E8,0x95B865EDE373D45E,0xDEFB6D16F7C2E547,0x3891C246B1D989B9,0x9860967D9B78A8D3,0x1B7DAEAF0DEA10,0xF20F197F1B3B06A2,0x25952F6CAAE6B8D0,0x8BDE5A319E975051,0xAABB3152FEB9460C,0x1BA34A1FC7A6CD5D,0x6D39DC9D3F544DE2,0xA11D3FAC278F3C86,0x2E58D0AC9FC9DA,0xC792BAD2B3775D2F,0x2A61B38FD8B80C4B,0x73CF5D8224DC5A70,0xF86AD6C63C73FBAB,0xC00295F5A2E9EEDD,0xE4FE9BCB836E904,0x960466A92FA60D4,0x1CCBA6BCAE95B8,0x94B439868BC1F786,0x2D413AE44B7584ED,0x3173EDF6DC2AC47D,0x2A067F32BF1A9AC6,0x60678A1BE4CB8106,0x43CF218F2EAF6C60,0x9F47BB6CAB2462B2,0x3861822ED50BC7,0x13F78042954F10D3,0xFD49D9A53FE60ACA,0x6392AC5B3BD8BE48,0x58793C9E9D64F204,0x148EE345F7590355,0xCD0F7AFFA20D706A,0xEDBAA5D8C90ECB51,0x1BFA461A39251C,0xBB9919BE83284909,0x21633A09ACF9104B,0xE72EB47DEBFEFCB2,0x81B80586F943AAC5,0xE7DCD74A059DE3B6,0x2DC34A2E8FA74E9C,0x95A102F05E8499F8,0x362A06C25178B7,0x1001355E4953F534,0xD186F072F845B11A,0x853EEC477530C9D4,0x37DBC5C94F9AA3D9,0x21AA0E5CE8505FD8,0x4B6BA31C5D561BC0,0xBE8809B36E371C7D,0xBA8ED6079B716,0x2CF3D91FBB43EDB2,0xE7B9E358AAEC1CFD,0xC6B11C9B2C6E22E1,0xF9887032F6717DA6,0xEBF32768940B97A9,0xD994B90FA41C225A,0xA736DD910B690BA6,0x108452F6A3AD15,0x89D112839E7AFBAF,0xF8375E9646A8B02C,0x68ABE7B848F8362C,0x5B95838A8E9F3C28,0xAE6DDAF542254CB8,0x6427663607502FF0,0x8783EB7DE0E445AB,0x2E0641C2DB90A,0x36AE10D1B4C27817,0x2CB2284746675E2,0x435D6AF35CE40D40,0xB4ABC45061327BCB,0xEFBDFA1A4CAB06C5,0x6D3E1B3981454656,0x9CFFEB1C0AA50B21,0x22416B9E06EBD6,0xA15327F2FD25AD35,0x1726E304A5658D3B,0xB9F73C5D2E10B23A,0xA399CDD9EB63D897,0x7E208B7C05CC7D6,0x8852B5EDBBDF4902,0x415AF9FA66D5F174,0x10C8EA48EE0960,0xE277842DE0657817,0xFF55BFB5FE88F8A9,0x51DB266618112B8B,0x39276371E4958655,0x4D35D216204A89CE,0x7C3AB99749672F4,0xF0400B155E076825,0x24CABFA13511E1,0x7885EA6A94CE32E9,0xA27C8928346EF815,0xB195B78F95643DA7,0x483DBBDD19D1D1C9,0x2549AF4517798EEB,0xE772D9B75E5B4429,0xD2BE029F50FC8B5A,0x813FD7BA6DAA4,0xC6383101CEE9CFBC,0x59CC0A10831D5DC6,0xCE88ED45790283BA,0x19E510143DCD2E86,0x9BBA19AF59682E9D,0xB614474FFE2462DE,0xCFD37D344F7950E4,0x3A68F5D3667839,0x8D87D89A9603F49E,0x5F8339F41955815D,0x21895CB6927A5DF9,0x76F92D78B2A6783B,0xBF61E5A1173212CA,0xF8A0F47DDD8C185A,0x2B0E8E5602C39222,0x1C770ED1C87D13,0xE0E507E4DC2B5811,0xAE8286687E74B6A8,0x3D712624E086567,0x502C351D30DAE69,0xEB0BD48D326EE2C0,0x34F46272AA601095,0xB80B05E84607390E,0xB79D3E26DE1B7,0x63CD9EB5EEF1C3A4,0xF64614AB26EC1AE1,0x45285D8EA1047D67,0x3F1651E614769318,0xC7244525EF52A932,0x2523295006477E7B,0x61C011AA649C62F3,0x1EF23F696F1E47,0xF7DE7EF81C8B3DAF,0x5155B5688F337445,0x5E942658BB9036F9,0xD38B8D7531CACA21,0x42455B52B755421D,0x9409E2416681F960,0x4CD19393A05FB7FB,0x1E0287BFE7A484,0xA66D32C20E45CFB2,0x3DC2BDA789F6490C,0xCA3A191674ADBF4,0x46C6C945FBFFA7AB,0x32994E37B166F6C2,0xEC2E5F408BF86E95,0x37B7F967975C60AE,0x1A9450E4DE9550,0x3B86551D85A25E45,0x1A5C47E869906C54,0x9C275D7B6BAB582A,0x5F9DD7F59AA4274F,0x49EF2A0AAAAC33DE,0xC940BE99DA7D4093,0x479434C439583C8B,0x3A03BEC9AE3D,0xCF57CBFD78EDF6E1,0xFF39C4057788729B,0xCC51B55AF6699C7B,0xBA8DACDDD0EE98FD,0x9E5BE97E8932EF6B,0x378A972E65360728,0x321D4053850216B6,0x25FAD6083FBD85,0xF92AA73799E93C20,0x500C3B714B2A1E87,0xCC3044A79AF0D3A2,0x85BD50B55EB965A9,0xBAF3983A7509C05F,0xADE096C528F9DF74,0x848E9AC6AEC71F46,0x1B76C5AF5FE0EC,0xEFF5E7A84F653457,0x663BFC2AA30C2DF3,0x12427E7E33B75648,0x4C3A1EA1A971A7A8,0xD96B1BDD0032FF4B,0x3EB4ED83CF5C6E6D,0xC927734F41AC9236,0x393BB2B5954C52,0x91025A370ABB5FA2,0xAE3C53EABF6038DE,0x1F5EC808EBA39483,0x8D9A1BD40BA33D81,0xFB9F7CF4BB39CBE9,0xDDD578A25EF8F6C9,0x82163DDD4529505F,0xA8F60A583DC1D,0x6D67235762EF871A,0xF6696D43E7B917B2,0x60E23D8F58D28A9,0x206BEC78B6B8C48D,0xF2750E08D9DE0E77,0x4517AD72F94EEA13,0x13E5954DD8C916AF,0x25805B0B808F48,0x60097FAE9CE1E71B,0x238CB06F7EF911B3,0xC255C6574AF0630F,0xFF2B2903E7273C93,0x9011FE58F4EC7E,0xFE7B254359C8B8AC,0x44F2288FD7CEDA8F,0x421197C44CB0,0x238B8DE25BCF09D6,0x846125EDFF6143C9,0x88629296AAFAADB1,0xC2702753A987987A,0x63328D6365C5203,0xDB957320C8DE7E50,0x1DF2AA6D6FE894F4,0x32E71634A9BA4,0x15A98F5C8BD22075,0xFB5AB98A2E9B655,0xD7435433CC2A3520,0x91CE358B55AAFA48,0x5D075D2118445439,0x532778113187A9F0,0x7F985538202C48A8,0x3CE12745F60C90,0x13AA51FE613B91C1,0xB1FCF54CA0B24E8,0xF10B13D9EBF68465,0x4C4C7671C57472F9,0xE9B6819D84E15AB2,0x6E03BFFABF7DD38E,0xA97799D05340F8F1,0x3C8E398ECF4B0A,0xADC6750AFC4C5509,0xE912FDB389064760,0x52674274D22448E4,0x9BF64AAC969A8E37,0xF73A314C9F9E33FC,0x9911AB80D937B953,0xCEF5248F53B118D1,0x37329891617416,0x292EF4253211BB98,0x9E0985C1B17ABE78,0xBE555DAC489B3BA1,0x42874CC033F5901B,0x838EC7EE01595E9C,0x689749843AA1079A,0x16222FBF56710B8E,0xDDE18AB90E638,0xA3B35F1E77D5F27C,0x7587671B02F116B0,0x1A252558A65660CF,0x95CE7C0EB5AFC3AB,0x215AF448DFECF9E,0x3ED1090B49484929,0x8DA4EF46A1EF8E11,0x2D27FB56AE2F88,0xF393B94C3E6A7D61,0x649BD9C258FC85A8,0xB14820C46E5073E1,0xF05F9C24005175CF,0x4ECE1382B3B56F6,0xA1BEDE1ED884196,0x623648C74D88732B,0x147772CF25B648,0x2DF10D2E2774CAD6,0xCC5DE86F564733FB,0x3B3C38EC1BBDD349,0x3D3074C98FB8776B,0x9FFE2F3BEEB99F12,0x510A48B06B60A51E,0x13C58AD3A8FE88FC,0x32A5FD0DB305,0x578EBBC62405E59,0xCCF7D1740817F589,0xC623D407874405EE,0xFE70553C19FEFB19,0x83202DF0E4A7A20E,0x6CEE0DDD34A2CABC,0x81E3A525E7C942E2,0x16F722AAA4E726,0x70CD8F5D95736080,0x4B5BA8B1A618ABC3,0xB49665BE7B03A8B8,0xE83BE38675AA1443,0x5B860EA40C0BFB93,0x6012C4D3CC0B44C1,0x1D37F0D4DA3DD712,0x8C73D46C41F2E,0x3D6BE0D646946EE4,0xBD0C4D5D4AC21FFD,0x5B27A993658F32E1,0x601F4026D470E724,0x62BB320F6C722469,0x47C91EFE3BFF442F,0xE9227389A7BB64ED,0xA318F8B03F575,0xCEEB8AA00211A353,0xAEFDB3B2398D063E,0x89BA31D443CE3372,0x76626EB6E2A442DB,0x339073C5B32810BD,0x9D22005FB67FB89E,0xABEE949C1E7D9416,0x22A35EA90AA0A,0x9CE2238268CFDF45,0x52683E8EDB6B53E0,0x57FEA90E2327710F,0x81423EE079F16590,0x887547A6F38F8A8E,0x41BD181A06AEC942,0x821A4CBEB61EBCE6,0x1D5936D15FB623,0x714A8F0CB0D9BE1E,0x523E49DBD5C931CA,0x530AD1E3C020CF45,0xF8FE13A463F366C9,0x53CD4B65E44513F2,0xBCD3D1AEE732E48D,0xD70137605F63BC9E,0x36177605E3C97C,0x8C5EF255947626DF,0x95979367F6CFA24C,0x6BB54E983F980C51,0xE114B67A4B50A21D,0xCC679645AB852E38,0x491CFE2DC5EA167D,0x16946A9F591257F5,0x16C17A7C250CFE,0xD6E1621656B9B9C0,0x58F416BF30823BA1,0x606D7E87ECB9CC1B,0xA846D4C9EF9AEA01,0x98F0B454367528B,0xC8E91DBF7EFFEA13,0x1513E612443A4FC4,0x2D5A8CF89D002D,0xEF17C6EBF86B5B4,0x8B689C263425E798,0x96F9707A325EC81D,0xC9C5CBF5BFEBD153,0xE21E8008518DCCF6,0xEEB7FB934F04F3,0x80B29E607E76B869,0x3EB6702F8DB462,0xC390F414325562B7,0x97FF31F875FD2EA5,0xEBCB7F1CCCBC1D6A,0x3D5F088E0A648DAA,0x26977D746C8ED6FD,0xBEB064D43BF89663,0xAB09EB6C35D967D2,0x2279E4C3E50107,0x4FD741D5999C303F,0xF8FE81EB520A9D2A,0x5C072D9F1799139B,0xE33FC6EA7D540C3E,0x1CEBF797BFE3D4BF,0xC6069FC5D6D4B851,0x1001096CD46A3788,0xFB6BA6F642E27,0x5B2C4E7A7A9BBFC,0x6EF797290D0D7615,0xDA6DB5FE277011B7,0x38D3F51BD4D62F78,0x7E556768FDE52B74,0x94988EA04D12DD8F,0xEB790EB60049E885,0x7D2000E504273,0xCBB0BA145D37F82E,0x25CED5A695583C43,0x495CE00F2883CFB7,0x3D7FD3C006A83B5,0x4150772CFD929D30,0x4E57EFD863CDC371,0xE73E2714C06CBC0F,0x1C4757B301C824,0xFB26FEE0D72F78EB,0x5C5E438C23DF142E,0x5B5C68BEFE7DC8B6,0x2D9755E4E724015D,0xBFE4D721C3FD10D5,0xEE0D003A0D665968,0xF1171EA499569415,0x1770FC20008314,0xDDA73220CEC97F81,0x56977AD7DD29EDEA,0x24083A3F76A8180E,0xA08595BD0893D019,0x32DC1EB9DDCEE7FC,0x38DCDFE4DE07416A,0xC7EBCD6AB1D45037,0x9AA6197D4AEA3,0x9B343AF68606236E,0x90A7522E97B05626,0xE19792C973F47B4D,0x3C68CB513A4BFD8F,0xDBBA19E3DBEAA0BE,0x6E66CA5D589D0D04,0xE0AA3EE1D1ED7D7F,0x3763E76141F277,0x2DA2C627C72A892E,0x12AFCB93E0E42DA5,0x1426AB1C4F26B006,0xB6E3DB198386AE28,0xEE4823CB897C94F9,0x25C315B586CFDCD2,0x52842F19BCA33FDE,0x32D779072EF195,0x2D69F6B33B2965BF,0xA63AD42EA4EA03AE,0xAE5F87673C9BFF8E,0x2780409DF4AF30BD,0xC8EF2BA617D7EC90,0xD1FB1B103F50CE9D,0x92B0409F98C8131E,0x318F4574A481C7,0x40CC77DFECBBC1AF,0x9750D431B02BDE8F,0x33C526BCE01DCE21,0x7CA2E7917F227656,0xB9A4A66F41D9E199,0x491EF013AE7C7F9D,0x24FBD07ADE3E6436,0x1B41B643FF8851,0xCADBF79CF76F3C8C,0x2513EC69AAF93C9A,0x98C8D0F567B5402A,0x73018239E16E6B59,0x69BB02D860B350E,0x6814CF6D137FE97A,0xF0001DA593475031,0x2F846BCE824862,0xA40E4E26CE709913,0xE47D5B3BC800804,0xC854256BC293F3E2,0x6F1C993115614035,0xB67F976F2B5E5522,0x4385078460AFF90F,0x18C060B6537057F2,0x3CDC11214FADB5,0x3AF71A9A48200FD7,0xC23FD3139DEDEA03,0xC1C57838F0070F21,0xD950290CCC1EB3B8,0x2AE263D6CAF27360,0x41D7B6481B4A0AB,0xB9FB5C27969CB3A9,0x27B231C7076B59,0x4B577EEB7D0A28FF,0xEB6D3182341019B,0x5CC5377F90DC5EB2,0x3F0ECDD5EFE0C608,0x2AD68A83D019CD50,0x476A234D5C8BF91B,0xDE5B6DAF152C3B52,0x1D89CE4E714117,0x728A8CA14D92A00,0xDD69952FF22273B6,0xCDA5BF1E4D52D117,0xF655342EF42EFC21,0x36703B4D410123F5,0xFE5E4DBBAA7A34E0,0xC9608E52D6A2BEA2,0x1353D65A34F6C8,0xF139D0A458695F12,0xEDD92CC6CB929736,0xCE54C2A2D8328633,0xA57723BC39947ACC,0x9EE2678EC6765A64,0x23139316BEF31AB2,0xA4B1AE3D34FFD0F0,0x21165E8776A51E,0xD53E884284441E2E,0xDDF493EE390AB485,0xA5807E37B88D4B0E,0x91F6CA6100E6F6A3,0xF82EB7D3344714B8,0xA7A9E92DBA9A389D,0xDE83B06058AE1D3D,0x1B38B5D86A5BC6,0xCE81CE89B3615907,0x287E8BD4B206203A,0x9D9883E761BCE52C,0xA01D02AB9773BFD4,0x3A5F5DB22453935F,0xC17FEF17FE22B0FB,0xF516B6B48951503C,0x2D1B0A48B34F7B,0xC8C3CEDC285238C9,0x4877A5399A6CF267,0x72F0D1D135647736,0x839F5130102113C7,0x37D8FF73021664F7,0x33BC06B020AAB53E,0x5DCE04EAEC74B3B3,0x3F9EEE1E9E7953,0x603528FCBBE5B02D,0x2AB8E5367BBCEDCB,0xDAC10D35816DDAF4,0xDC259528CC2B5381,0x64294D6AE854AD70,0x4685C102AD690F65,0x4F0C8EC8062B65E7,0x3BE663BBEFEAB1,0x76F24C59BAE4A063,0xAE1DCAC2D8683338,0xAEA1231DE6C61AAC,0xC6649593DDF4EB94,0xCF30E5B41775865C,0x331E05F9ADAAD159,0xDD07DC853EB61C85,0x4056A6F1B9ACA6,0xA1CFC42C3CEB7DB,0xF3E381894C9D3A32,0x9B236FB119070620,0x188A5B19FDFD0DF1,0x32E51E0EC1B10DB9,0xA6181130CD9444E,0x9189E5A01540967B,0xE74588143CE86,0x4C873FED7A4BB723,0xED4327FA8A90FD17,0x4C65446EADC44DA4,0x2B96FB81E98547AE,0xBBF6DBABB3026ADE,0xEE99B80848552DBA,0xD592C823B40B63A6,0x3494D2C2DAA511,0x34CD8C0F66723747,0xD7B4CDB122944F7F,0x22EB07B49C9116AA,0xFA1F14118417EC04,0xB16EC4A374C4F146,0x6FF121EB4C7D0C9C,0x3F8DABA08C560F48,0x2EEA5483FA0DFC,0xEF9EEDBE29689983,0xFE5EDF7905774AE2,0x17F36975D6589C85,0x1BDBEE2222247086,0x8C807522B28F97F2,0xED98E1B4515CF6EE,0x45934CD5CC53464F,0x36485C5711E985,0x3F6D060AD352E012,0xBACC0CD4C8DEA150,0x9603126EB33ED3BC,0x7E72A5902EE7DE69,0xD8C0ADE2B139C4A2,0x53FB286955F21F34,0xF200AF7A99F9FD40,0x17E087B0B65EF6,0x615A088F02815A79,0xF27CF480B4AE56BE,0xED9CF68BEE95CBA6,0x3CE299259EF090AC,0x8B733B4332D03E29,0x1DDF5E9EAA24C177,0x6CE60A53B55DC9E2,0x5AE00A2D71669,0x863507D25BE0051E,0x17A608C3E86F1E23,0x7895AAD626D46469,0x24330A36A5BCDAE3,0x91FD8380E3B2DD55,0xB1572C421EED98BC,0x192BB2D097E63D75,0x31A048BAB3A35D,0xFC003CE9186F331F,0x1428775B187FF1B2,0x638F134C0CB9D230,0xDAFA2DBA823E7352,0x289FC235EDEA0B98,0xD0CA918051AB6EF,0x1E841F2A79ED6667,0x17247277B44B42,0x84C952E8CC397303,0x362EBE2BAF28A6FF,0x806C8BD27C1BC19E,0x4E3C7F90D8F6534D,0xF257783461349D03,0x2AC68E66F3C1E228,0xD20C10F43CD2603B,0x7E2998D8CC7A0,0x866A88A2DF750C18,0x61B5FBD3EA8EFA49,0x7FB3EA2AF4808A72,0x3EAFD80CC55B1CF0,0xA67F0643AB60C2F8,0xA02EB28824187C3A,0x3DC3EB5089F5831C,0x1E770B7CC69683,0xA2960F3AEE79EE40,0xDDE9F52C9E323CAF,0x1BDE7FBC11BAB917,0xD553BC8B51723BE4,0x5227CBAEB12AFDE7,0xE6ACDDF86A41212A,0x4339C3A480EE8CC1,0x21C63D44197954,0x72A0C3BF701174E8,0x744AC6967D5108AA,0xE18FC09C8A8FB43A,0x985CF363CF769726,0xDA2492D6781E0D7E,0x9CA5E6739FC6C28,0x6318C4BA813E61EA,0x3E0FD8CAB862AE,0x3D3C87FAA90301B2,0xC82BDEEFFC95F610,0x2ACE0D4BF5B81035,0xFEE280D56DD310AB,0xF914AE976BB54268,0xDFAFF4CE977488D8,0xD3B9F8086BCC23DA,0x3F806219FE83A4,0xA839C411305B7A3E,0x1C99A171EE29DEB8,0xAAF20510C16285C5,0x2E9B5B2BB240F846,0x1EBF46516A442B1F,0x341D6A8275F2BF17,0xEA9D9861F5C556F6,0x34495C9DAD14B2,0x426CE85008FB5516,0x9D961192E93E158C,0xFB328984807216DE,0xA74A53AAC8E08A72,0xA285A851A880E2DF,0x52B5C19FFA2D0A75,0x1817D4DFF31F1374,0x1F83400959927A,0xA024ABF37352F21C,0x19B67BC44638EE0A,0x1DF5F3130FDABC96,0x53B9E094F505EE7F,0x5D944B0D208BB713,0xB64D534CDD37D267,0x14C79AD6526B8411,0x3F5E97284FCBC2,0x51638F543C6EE865,0x524651F0736AF80F,0xE9BB997772BE3217,0x9B6A1F78C00A0086,0x4437DF562661499B,0xCF4F17B288580974,0xB56689D6BD477264,0xFD244E3235D53,0x369B23F951ECB9B6,0x1ABBC9353C93D337,0x355C8BDF78001DB,0x76575E41B6A2E8AC,0x440D3AC2ABE7606C,0x495A620371DE7CA4,0x899F7F172A720782,0x1DCB18DF31A7A8,0x5469B8A30C10D9,0xE34E96DAFD134CC9,0xE1CBA832A34E2465,0xE1FDE73ECC33E7F9,0x42FA1D49F8B12FE9,0x682631A58D1D72BE,0x7CD8EB0340306E9A,0x1889187206C8DE,0x1A2F2832696B0DD1,0x6A607665F2A22C12,0x68231C68A66F3D0F,0xD8A177A89190AEA,0x7581DD9E36E1D18E,0xDCAFA6188C8C5CCC,0x54BB7855742D0F3D,0x3B2CC044D63268,0xEAD077810D53845A,0x4C8CB30109CD2ACD,0x6B7A5FE8240B58EC,0x8731D16379B274C6,0x5B5F46877B63EED8,0xACFCDC0AFE00FB12,0x5D720D7934CF9723,0x3EAB25651617DC,0xF59D49D34F0DEB41,0x4A267DFBC9B2EDB8,0x2FACF3F57A5C2104,0x97F8E2560EC1A004,0xDD59E8E4C60CF2C6,0x3517DB65584F5062,0xEBAF3E49393208DB,0x31A3295DC975A0,0x91E3D8A3F8C89D0F,0xF030EF99F3D1ACC5,0x5333BB8CDBF28B6B,0x7E57CFA1C72313FD,0x60538BF4C8FA87AD,0xFB0C26BA4C3AE373,0xDE6CCEFD187D8915,0x2C5F1CD0B5B119,0x47F31A06AEA05B68,0xBE255F3B9A8E80F9,0x508C0259B154A09C,0xCF70CD753DDF1509,0xB128ECBE15B905FD,0x4802D1A0B94744A,0xD8881ACF05EC144B,0x22FF950BACD8AA,0x103EEB97B0DF2B64,0x7A498047921CB116,0xD1A92EE4E069FA8,0x14FB5BA45CA2A310,0x34F4AF35C3D486E6,0x7F5A734DE408B8F8,0xC1D3EF85BB2B55AA,0x3D7EF5DB6FB66D,0x14E856AA59B85B62,0xD58D198E5319A998,0x41680C4D78CD225,0x24497E0D1133189A,0x2EBA8C881CA36C05,0xC6EFA62CD6AF957A,0xAC27F8F595077F18,0x19C9EDDF69F04F,0x3F9BF2A7018A29D4,0x6FF6F8F9BE5AD26E,0xE309EC43C708F176,0x35DEF7D474546E5F,0xA523C51C2ADC289,0x836B16EEBEBDC577,0x9F6330AA82AC0FB7,0x13353A86764CB1,0xD85940AC9F606506,0x2DD5683879BB0D3C,0x42A9CFA5752ADEEE,0x8CECEAF8E30E2F77,0xF7D8D27CF06E9841,0x1538774A1E6364B5,0x3248DC577947932C,0xBA1B712D0573A,0xDCADBF1B0572DFF1,0x7CB2C96C520B7DD4,0x50E98BC173F3576B,0x2155F59B0A1ACE9C,0x5F3498078E180A8,0xC84BD48950F6466,0x3CA8B138C0E6E023,0x2AFA7A845676F,0xB54DF56754D2BF9A,0xB9EB4BDD7EDC24F5,0x580220CD28134ED7,0xDDFD949FDD2D283D,0xD78AEAB8C4D6D98D,0x731FC92473D8B1A8,0xB883C0A587EC7CE8,0x138252667B6D0D,0x82A34DC1AB201759,0x6B487D088623571B,0x4EF9BD71C8E2E410,0xDABDA217788C8404,0xF513B8449C390408,0x975819BA21D4E308,0x4CB663C98CEA0FC7,0x3BD516DDDD235B,0x58C156F0B0CF6633,0x97A045CAE1D6EE34,0x3D8226DB683747EF,0x14EA6AAB64DA658,0xE68623A97FEDE8E,0x912D7762EE10E199,0x2F1A6E19257CCE15,0x238AA672C05D7B,0x5F2134D7B5BEE18F,0xDD0A18D1FA6ABC8,0x22B4E4E4C62A1169,0xF3321809B586EEB5,0x442511DBE58EA3E0,0x18AF59F75B5A1D81,0xF613E0C78D09DB39,0x38F9A909A4AAD7,0x7216BF81FB76D2B2,0xCF839F84F5074003,0x3544D0FFBB3D8119,0x180818842D857328,0xC8B018EDAF81E942,0xB8C9EBD4A97A0332,0x57125CBB93AA98D6,0x119CAEBE483077,0x85F40C0DC76367DE,0x61D01480D393A0C3,0x4478573FBED1BE2B,0xB08909E94C46C045,0xB4A05FDD03BD3FF,0x994E4261B278E49D,0x4D4AAEE9A93BE296,0x13C27B3F18FCAB,0xBDA409ADFE282B13,0x321E5AC91D3F6FB4,0xFCDC3B7E8000EAFE,0xAFFEC8178FE2D640,0xA8101A260BF23371,0x9FD5B2B3405C53A9,0x35E648119223A8BC,0x30B5B0715E7CE8,0x80E07EEC04FCEC17,0x7CE98A62BD6326F5,0x927F745FFDB92384,0x65CB5A0E1314000,0x31F4D5849B14CAE0,0xB0620439C39DC5B7,0xFFD16820192A45F1,0xB89192C462FF,0xCA6B4D21441EEB2B,0xE4C994901A14261A,0xE5BCA779E7A6F4E2,0x48DC4B88F10DB451,0x579FB1A063702836,0x998D5EF0C793BED0,0x25F18DB490C8FCE,0x3C6A94175FAC7D,0x6295D32A798CC55A,0x1E6C6DFED162D860,0xA985D62DF6862E5C,0x4784E07ADF5C78B9,0xA9BCECE345BF5060,0x79C5742E0A21B6B2,0x9FC13F9403385AED,0x346F389017764B,0xAECAF2E70184385B,0x1066D46F5750E381,0x46A128C79011FDE9,0xE7C4F0B18D12FD19,0x46B936686F52C27E,0xE81CF2F3250477DD,0x3A70AA1C6DD2538B,0x32628A79FAD0A0,0xD9F91EE83B8A980F,0x72CA9020A16D52F6,0xF1387C7C37ADB6C7,0x14EDA8E15010048,0xEB41C41EA63D90C6,0x3AC0B092A3CEFD38,0x3D2A851E64577B68,0x1813D0BCD62416,0x671BF674261B6967,0x8A648DACD54588FD,0xD23EBA465D48EC45,0xA40FE215C47F6CB0,0x885155DC95D5309D,0xD0035E04CB46F0C5,0x7C400DC9D5DBDE8F,0x3A2DC0B1443582,0x55D126E5218802E7,0xBCB2DC00712EC96B,0x48DB003B33A8B447,0xF03CB33E7118110F,0xA5DA17988CF16EDA,0xBC9C18E551C87BED,0xD4CA4952331951BF,0x305C0851AF9F29,0xD4065E5F889CCC15,0xEEDBEFA8CF496A15,0x41B24D331375B6CA,0x1D8F9D0F246789AA,0xDBD4429422AED81,0x393A4C4AC6CD25CC,0xFED1A717EF7C1A0,0xD49AF088CAC5E,0xDF04CEAE8E75CD7A,0x3C5C9E7861143897,0xC614F256F39626F0,0xF704965E0A717BDF,0x56F9CB426F430C0D,0x93D23A8DC45339FB,0xAC716AFAD57C094E,0x1A48E8E8AF2F92,0x15F9022F39D1FC96,0x20E31B5FAA772239,0x3F1543B6088954C9,0x4015193C49155847,0xCF7164BE84260119,0x272E28CAB30A172F,0x92D0C4650153A887,0x20EFFB8688AA05,0x1C836810818EF7F1,0xE67418492D3A9D83,0xF5EFEAB3DB1D615B,0xC65B849191DA8DBF,0x9CB6FA8F0E3137C9,0x2222070B1FB32198,0x4D2238D8C229907B,0x2B037348CC21E7,0x99813C0C96D0157D,0x95B984A41886525B,0x4EBDCDA070A16125,0xB396AC29E08CC7E,0xFFEA69AA0A51BF9F,0x6F956E7FEAFCA9EF,0xC0BFE6E048E2EA5E,0x11BA884358DB8E,0x1461004352506267,0xB5E5ADB36DD7BC7E,0x92043E0312CED09F,0xD97F9B48480D3B2F,0x9549C900808EFA49,0x2837FDC6F3FB439E,0x51D0B5A231BDA4EB,0x32AEABB738AC4C,0x4273F45B78CD1E2F,0x188472BE164978BF,0xFF1EC16580F92BEF,0xBC755672517DA57A,0x3F2DD64EBD5424BC,0xFF3F70FD4CCD73B,0x242FBA3A14781116,0x22D27DF88764C7,0xC928791D5E021CF5,0xF0C5D035578862A8,0x7EE536CA145C79D6,0x5AC460F3FD05F40C,0xF9AD0789C6E98D4E,0xB395662E28B621A2,0x1983C5A913F88D8F,0xBE39CC3DCFB5D,0x8C465FE6A5008FEE,0x86DDD18D8C9A2032,0x5CC9A316390CD236,0x2EF05A65D9C3D835,0xEA5593EC149BD130,0x2D09D529F65392F6,0x24227E5DFA92DD28,0x14E3F8FA837841,0xE1AF95614B43D7D,0x386CCE844D88EECF,0x33EFD7924B8F3C51,0xCE027E925E02B0BF,0x93214CC31248BA40,0x79342A927436C3AE,0xD4CA9558C050E64E,0x15A066D7CED515,0x6D37E0CD723CC6D3,0x1F4664D3C5B46D37,0x5A9FA917553594C2,0x343374EAF709FAA3,0x6C4881D6CD4F89FA,0x5AA461A959D3B23B,0x655F77646AB92C42,0x350AB3B5756DDD,0x91154D4A76B607AD,0xBA15B5E37868BA2F,0x36A5011D0A0D140F,0xB28BF325F5E9D593,0x8C440FA4F62D7FCB,0x85073732464DB1ED,0x1AE173887901FCD9,0x99539813A25DB,0x952FEA8D029645B0,0x5980D15AC2FDBF60,0xDE9AE176B881ED88,0x3CF4E751E9123F61,0x5B660242C90AA7FE,0xD3DE090B82434C42,0xB5E08D5991E8C352,0x16494A29DFEBB1,0x41870177448D4058,0x5DB95F33AB37023F,0xECEB5D71985557D9,0xF01A5F64004D06FA,0xF42A53BBB95CCE46,0x41ECD3E4677FD331,0x72C25D1D037570C1,0x27F86E423906F7,0x8D875A77DB1333F4,0x46F8E2DDE383722A,0x5C97A2F433654D71,0x31D3EEBE8698FFC,0xA3F18B6605948A8A,0xCE93A936F7379F7A,0x73F3DDBA463C6074,0x5032CF7B15D80,0xABE80CBB5E9EA27C,0x1EEBF6C07B06D56,0x9E9EBA5AD2194094,0x7A2D84152A541F1D,0x80315091D827DF07,0xBA2D007B15197DC0,0xF29B0F97653B5E3F,0x10BD3DBDE18494,0x6607F4FFA884372E,0xC8A56A82F7F13E6C,0xA0D5AB23C47AFE81,0x4EBC11C1B42ABF88,0xFD47DE307196D9DD,0x79FCF3930DF70329,0xAD4639888A3F9B70,0xB0FB1146F488E,0xAEA62FB863FCC5DE,0x54EC6A8D42E262B2,0x6A27229E9E4DCF5F,0x662B6229A042095B,0xC20B0988BBD267AE,0xF0E7FFE2CB85EEA9,0x903CE205758A7F19,0x13BFB387DDDEA6,0xFA20852B4C386A26,0x42B73C0635620829,0x63D65FEBBC7AA629,0xB41BE5BF31E2D1C4,0xCD045973F44014FA,0xFAC46AC824DD383B,0x24A2E87CB4E449E6,0x1EF954A0BA5F55,0xB1F57C91738D2BF5,0x84EB37296A426FB8,0xE75BD8A26D921CC9,0x82416FFAB890AFAD,0x585CF9C86CCBBD84,0xA1DF0780ABBBA582,0x73DE38A505498951,0x48B2F47BF6B21,0x306397BC03F27C,0xEF1609940FAAFAF0,0x6B2C441B754C1B11,0x28AA01A1BC9B9418,0x3F43E7FBDC70403B,0x8436F066E3DD628,0xE002373D9730B2B2,0x1D1293C3624743,0x83FE11015CB2B856,0xE158282039E5660F,0xA73D3CF9B046CB5D,0x3E822344285DEA73,0x57F09A7BAFFC0644,0x8DD02141045750A7,0xD840836D405057AB,0x21B2B9BCAEB4B8,0xEDFCE7ACEDAF5FB0,0x42A7C6B50870E497,0x9D53D3C9B92961FF,0x55F8BEB06E6042B8,0x1D9C13692797FC89,0xE80D625FB6959A8B,0xCF2EDAB34340F6B6,0xA35C58C6D7DF9,0x254807DDAC70A5B8,0x12DE889337C7BF42,0x5E9A4EA8629E089A,0xAD235BDF1BB48B78,0x3C1344133664F11D,0x97ED2EF908834476,0xAD6EDE050912336C,0x24C0249853464D,0xF53AD258C005E143,0x202C87EF4C67A5A4,0x560AFCE7CE500CE2,0xD7DA35641162D069,0x36F8951D775A4A98,0xE919627BDCA56C6F,0x559887148EB6CFEF,0x1DC2CFDAAE0EB3,0xBB4D8FA334B9FD44,0x3C9506A7758776C,0x5556526EC73258D2,0x5B32B1240451920F,0x43FE0CCB27985BDE,0xFDEFD05D7C1DA00F,0xC52A2ED4185D9769,0x2C31AA4B343DFD,0x22C5D9CA7D02D19D,0x5CD7638C11E0BA63,0xD13B550B9BC566B8,0x291E20E716CE1A28,0xBDDB43862F598460,0x1677D7496D430442,0xAE8C6F83B891A90B,0x3F4BA35B7E5105,0x9D26E498BBC30B6C,0x6D546FFB2971139E,0x3EE6837B46467A58,0xA759B41A15A14AFD,0x424F02D68ACC21EA,0x415BCE7F828679E4,0x9D6FF18C04E1DBE6,0x322FF3511EFAD8,0xE39D939FDFF5B01D,0xAD032AB372660EDF,0x5CCC5C056B805586,0xA2E79D9F4C156BE9,0x1FBDAE563773A9B6,0xB4ABCC1CBE332F6B,0x4FFC1EAD488B895,0x12E1DEFD360787,0xD3B7F6DE5B450F60,0x9C21EA333131D0FF,0xE92934D49CEC5FD2,0xFD99B0BAA6AF874E,0x9608D7BB0A914D82,0xD87089DB4ECD0E72,0x3D2B829BF50AEB9B,0x3D66804702F8DD,0x4C6D2B11ACC63229,0xB5361D1BDF013BA4,0xF8555D40336E2C8B,0x2609F4DCDF4625B3,0x6EE524DBB592588A,0x621AD71819E06E81,0xA414312E556F8104,0x198FD48360119A,0xEBAAB1ED1A6E9F5C,0x32107ABAC72E1CA8,0x1D85452911D1DDAA,0x492C886C7A0145B0,0x28E31ED74E4C3EFD,0xBE315E524DE35B1D,0xFB3E3904E4F9E27,0x1787469535F571,0x14D9399095CA02A8,0xE6FC090F630CF41A,0x8E150A852294E6F,0xCB20B2734C6419E4,0xCF679AE04031E37A,0xA4C88EE802899886,0x7B00FED4BAB936FF,0x32275B63C75065,0x69F54176BC8F8F20,0x1D7EEBFBF3CE8643,0xAACCBD66608969FC,0x7D9C35BFFEA301A,0x3582F2DF82227928,0xED134081EA2C0725,0xFCB3826634C2E8E8,0x25339A9387CE5E,0x7688620909E026A1,0x8E1CFEAEDC29605D,0x480CC56A36B6BD98,0x444553E378963398,0xF198D838A47EA72C,0xE32AFA0DA9498F66,0xC1F8B04188DF193C,0x2A47AEFB9A8033,0xA55E1B5C85EF9A08,0x9E6B336FCCB9175,0x93C52399A8C43478,0x7C81D40092A90D56,0xC21934DB57D8485F,0x2D920F791A5DD2F1,0x35C35CD05A422655,0xA366CDA633F37,0xC3193BB2E776C656,0x27CD0C07D703D7EE,0x914300F5CC97AC10,0x1F7A72DD534F2EAA,0xEB17169759ABB8FB,0x9C301F15ACCE6FAD,0x5F5EEA3344A80C4A,0x19080CD4E6FACB,0xC33354DFB75AC2DB,0x8A000E4B8FA84C35,0x48AB869905E1D128,0x13AD89C285ED97A3,0xBF8063F36063341E,0xDBAA06BF6B50D580,0xAE7F1B2E86B84717,0x296533DBDD021D,0x4FAC8334D7F1E990,0xEA813AF5D51CFD66,0xA435C1EC1F5895D3,0xDA42249736DAC847,0xEB9B533BD454FAF,0x5B876FEC27D3C383,0x830FAEA8E09AE2C3,0x302DB299580ECD,0xD981E716FDA050F8,0xE8E3E81F046CADAF,0x96CF6F873C0481D2,0x1E3BC045978A784E,0x97047F347653612A,0x9A68CA607A2E07D7,0xCAD50C24518A759E,0x2C4D2494141DA,0x4E20BE214F44519A,0xBB8DBBA3947EBD7D,0x4FC8E042973B2C88,0x9B193303074D2D07,0xBFE4BDEC8E78C658,0xC845357FD29070FF,0x60A40711BC3DBAD1,0x24E3B0048839A0,0x983592ABA709E25F,0x997934D5FF5C2DAB,0x577996251B4F2247,0xF266988815282469,0xB3E93DE9FA26B3B8,0x1D5C980E2E19DFA0,0xA78B2FE0B37CEAF2,0x1231DE5E8C5C8C,0xC0B1EAB4747B5939,0x265DA8C1CE419E7F,0x16B2C33B568528DC,0xF57E99F4FA46C27C,0x7303F7167C3C0787,0x5F577E254B73B1A3,0xAD0010F59E4BE8D1,0x136A7413636BDF,0x5716384689B26F9A,0xAB5F4087B3B8656F,0x32CF6F5924BCB27D,0xAAA593B724BC995E,0x65C6E390BD7F581D,0xFB352F2178FF0C25,0xC3EB9F72A34478FC,0x3D84ECDAE4C5B6,0xF39B070ED0571271,0xFA8E2D1DE371621A,0xA46D97EA72DF4E70,0xEA591C6A9B584910,0xF244795CDEB0D7D4,0xAB4AE12127DFB819,0x7C1B44F4DDB22AC6,0x3842A1B217F229,0x5E787019866B0556,0xFBA472CAFCE2AA8F,0xFCFC72860F689FA1,0x8E1E052D3C249624,0x5992B16645F4B9E0,0x8C553567E3D8AFA5,0xEAA4E7ED6D7709CC,0x1D64FC558960C3,0x2FC55E37B6F2FD1,0x7EFC6EAE3BB1E326,0x36DCD5E5FCE7412A,0xB6509374C8A46B2A,0x36CD800639DF25D1,0x1AAA5FDA75763C62,0xDA7075119AF1581,0xA238B6A22D310,0x20FFFEEEDF4F3F9,0xFCAEF1EFD825358D,0x74197A906C0C468A,0x5CC8A2D69495919,0xA75A6402E15CF35A,0x51E63D890457129F,0x44E6343D5D989239,0xBB259C8D1BDF8,0xCB0ACB94217404A1,0x7C7CCF027F0EB288,0x380F0AE0C177E063,0xE58100C6CA49B0AF,0xBF80610D8904B9DA,0x55EFD8F47C52E40C,0x35A23E1287855BBB,0x1CECEC072B65D1,0xB216DC3744BC8B4F,0x36EDFAB2F2885CA3,0x91BADC9249A95B83,0xBA1DE734BC6CC543,0xB9726050149EE0D9,0x94A59286E8F931DA,0xFC2FED97973CA19A,0x34C56634C18D65,0x61AD24D69E6B0F76,0x1BEC2961AE9A3946,0x5AACFE86E6FD649E,0x969E89ED72BAEB2C,0xE02BEB43268A6B00,0xFD31BCF69AC77B8C,0xAAA68AD36411C542,0x16F7C21757F3A3,0x57C1914A4EAD3D0C,0xCB0F0D9D3C5D8F51,0x13380F5B39D25031,0x39377B2B4B8DA08D,0xD6C9B16FE42B8D3A,0x831A9EBE57D40593,0x371CE28C987B254C,0x2428730F4E1887,0xF61AE05DA907E11D,0x62C33E42D6CCB7D5,0x889D2D99CB6EDEE1,0xC0B3F2694212214,0x417FEC3679584F80,0x51B4E95DE1161B7F,0xB6BA7661D65D3A2F,0x30CB28DA9B39A3,0x64B6A4CB47E1C332,0x27053B4A84F2D8A6,0x4861B327F5CC3146,0xBB41B8BC57E71F3,0x2F910C195334BAAC,0x5AAC84D81F9DF6F1,0xF0C1C05FB16D6C38,0x93DD0E3F15B9D,0xEB5E8F6A8891DA93,0x669BE78E68C699D4,0xF36A6D1951A2282E,0x14A45FF2940F5AF5,0x9B3D835D618BC5B8,0x3B9ADCB40DD3A9EC,0xB6F3CDC75B58056D,0x311AEC40D7E739,0xD5C491DB08645118,0xCA43E84F5B24EB9D,0xA098E5BAC7113547,0xEC7A112605E2EF9A,0xD625778DDDC0A208,0xBAFA4C3176516B67,0xDA7D65C01F86FA6B,0x102D6059EB9AC8,0x2E8F0FD91BB3F9B3,0x52A17EFAB074062C,0xB15305773023BECF,0xE93D58C299BBB1F6,0xA7098FD85D462,0x9F4842BF9545B1AD,0x1F43021F3852E6C6,0x2FD26325C77691,0x2AC8754C620E6AA5,0x2CB814880DF124F4,0xDC353466BDF5A5F2,0x4F27467E4033F0FC,0x883ADDFB35C2C3A8,0xC4420748145BB61D,0xCABB7596E255E210,0x3672AD52545E3,0x8763B961B7FE5425,0x4CE5572050C3D363,0x372B7C9BE86DE419,0xE20076D8C7117988,0x157C2461918DE713,0x6B85109A3B860927,0x43AFB6D3153FFCC,0x3702D563CF1473,0x750877FF7480A0A7,0x75030F868DB5B709,0xAEAA0DD0A0C7AB82,0x838F90FCEB2022C0,0x5A0D2C85799E17F0,0x3BEDFFCEFB008F6F,0x8DA8484C728FDB8F,0x38EB3D7D26E299,0x505005FFB5D94C68,0xCEBAB61C80146EAC,0xF86D82FEB6519B05,0x21EA29EA92E5B00A,0xB909F025E95A3C37,0x610CA71E4FC8EAB0,0x7236FC31750FA674,0x24BC8CB34AE6E1,0xD2567183EE678537,0x91D40562F631C508,0x46826B767D5CB7C5,0x3F6E48DA2ABE4343,0xF4D8F4F0403906,0xE37D979BF4DDF352,0x68D5ED0F34B84678,0x2E2A06D6B5BC72,0x78A66BF5CDDEAFF7,0x2CF2195AD8CF8BC8,0x7E978EA9A74C46A6,0xA801E2EB9591D0DE,0x28CEE1BD74FEE7B9,0xDE08C985C25C9CA,0x6893D076AD9C30A6,0xA12737B90DD94,0x7858839CD26DD889,0x32A28333673E3048,0xD9B5F9180BE529A0,0x3EFD535326F6E9,0x8B7F45F5458F7EE7,0x12F71CF7A0FC28A2,0x125D504EA6A9ED82,0x163AC860345E51,0x4EDEC061024CE75D,0xDF938700082DB37,0x2C0A078FC450C27,0xB719FEAFA4137FDD,0xDA77AE668B540555,0x57FBA7A7BE60B6FA,0x8B6D790355DAF227,0x1E6F329547A78,0x99BAA1BBADE474A6,0x58905D5EEB85D691,0xBEDA47D2DD4528E8,0xED88B1E09C8E7E0,0x44274125021B95CF,0x3340BDAE9F281523,0xDCBA07EE5A6756F6,0x25AE0544D3D8AF,0x9356DC9C18EEF278,0x9D6732EEF8E52CFC,0xFE2436855CFF46B0,0x733FD03FE98F9347,0xF57BED59E415F644,0x3B00538A5914B2FE,0x9378CDE06E337511,0x3FA17C26759E1A,0x5735BEEA2430B320,0x16EF76B0B92D29EE,0xF81BC5BA3134EAA4,0xB12C1F70EDCF9CEA,0xD5E9DF6CFFB3D10F,0xF84AEA857561B4E,0x82E1D99E0B9A04BB,0x127C676C13E9DE,0xD513F92983E09BFC,0x468B60F945CE97EC,0x26CBD7BB1162DCAA,0x5FC7AEB3C385AD28,0x3835B77AF6588DDF,0x7E2A688A3BFDFA4B,0x1DD0DEC6F4CF1D6C,0x37389D1E032D02,0x564AE9590B08B7C0,0xFC03E004083D0B9E,0xDE7361A632DCD04,0x6F6588185B16A3A3,0x5B2E2BCA3169A7AF,0xB0AF5E591404CD07,0xA1C2EEA075C918B5,0x2C5ECBC9E5B122,0xCE44085426D0F222,0x694EF8F7C4945050,0x4ED95375061A898E,0x4B9B53CEC11BEEEF,0x73C39319A4CFC848,0x109B4D364955CB71,0xE6034ADC4ACF92B0,0x10A3D08B82C153,0x8E4438CD14D592A,0xCB2E5E1F0899A298,0xED50064A7A5A4389,0x12D0C4BE6531FAC4,0xE294257520A8F156,0xA11BC0BCB8518EF3,0x7D1C11F9707090A7,0x9AD3160880A4A,0x5EE2E230090E3BB4,0x745C43FD209FCD4,0xA03B61D81F60B52A,0xFF62ADA4B4443172,0x3C0E38DC31F78273,0x651C45380E1CD417,0x81FDFE8F04FE14B6,0xCB3CC876743D3,0xFA752D3A1DEB91B6,0x206FDC4D82A0EDE3,0xAB0F828A554EDF5,0x7931A9B5EB7339CF,0x75C7B6F3438BCFAF,0x92F58D6E4FCAF164,0x3198D856B91AC4CA,0x3CB5824A98F8B6,0x212951D643C68C85,0x34DE5665697DE03A,0x6F15B9122A43B5D8,0x74C64F701EE920CD,0xA306801F5DE37192,0x8EB2837D2931BC75,0x9672420C634F53AB,0x3193865C583F98,0x19978A645EC93582,0xCBE0DEC11B5B1B00,0x30426ED3448A11,0xC9749812705D37B,0x50E69E609B4BB4F1,0x6E00941B20DAF6F7,0x6A16263BBD012092,0x244E68A1EC0FFC,0x73C97D8A26716349,0x8D9ACABECA58D287,0x42E4449DBD94F0A3,0x7B381F2780E035F4,0x96DCEBBD22C97372,0x69E90AE4DD6C58A,0xC35B7C5C37ED1E5B,0x1F89258C196B13,0x20C98C2A554C35A5,0xC1B1D6708BA8B3E2,0x7B40595828DD34A5,0x546DC718BD1F8CC6,0xD7ED8C712373B134,0xCBB911B985ADBEDA,0xDEAEDD8CD669B532,0xA0184BF9DD651,0xF14DB235AC6B1D80,0x67727340C606C313,0xB1ADCB1B11AF4D8,0x98264CD4504EF11C,0x44F2829E189B85D9,0xEF73965725361309,0x53F4B1D8268724A4,0x37572B5CECB6EA,0xC4AF31D8ADFA7744,0xB7F6D49ED7C8BCBF,0x5C9912A3E9E810E6,0xD57C14C061DA7B7C,0x41643AD6C011A1F5,0xFC7BEE7053AB2DF7,0xD1988C718120B806,0x1F5C04412B731D,0x287E009A0BA64CCE,0xBE6C1402CD5AD48A,0x95AACB2A54019F6,0x8672F922D3B4ED47,0x302FC9DB73275903,0x6C181EDA1A35997B,0x1A6647B3236262D0,0x1234F2A3ED1533,0x5EEB2CE7B0209044,0xE43BA06CA99C793C,0x83F6774E375AEA64,0xA2D08FE9B71BDEDC,0x976CE7B9370BDD52,0x65F28A3B0A0E00AB,0xA6A970759676509E,0x2CCA695BFE8A8C,0x3A931AD4291CBD23,0x7CC7AA6755C34733,0x1A1291B318AD2676,0x7A4ED82484493E5A,0x4586D3578087F27C,0xAE97697601CDB8F2,0x4ACCAFBB1C24E58F,0x1FD3A99B0AEA24,0x75C7CF176B1575A4,0x78B99514AEFBFE0A,0xE9EDF34EF0DD9AA4,0x5BB32C21CA2D6160,0x532E227156397270,0xC5FDDA80C3CD6099,0xFBE0CEFE58F86B22,0x13A4B28B72D17D,0x7FB547E956D1BC5F,0xCFAF79DC970133D5,0xFC17CF767CA8ECA2,0xA33A9F6B7B09E80D,0x32CA4B88D3096342,0xF54CEADBEC9E15BD,0xEF7938F1CA82A3CE,0x71A4E441FC34F,0xBA65901357348397,0xF7A2047866E1552E,0xD0FE731D3D3734D4,0xA288F781EFDC2055,0x857B66189EE5731F,0xAB9E9925614E9486,0x14946C4490B6A19,0xABE630FA13190,0x83C185D701E213B2,0xF0A7E55591C3E313,0x4DD0E95CBC8B7BAB,0x37CEC852D00EA37F,0xD95C884AC4132395,0x145D206B71BE894F,0x42FF8715583F120C,0x78BED481D374F,0x30948189F3DEA916,0xE42910CF7173D60C,0xB1EDF8D49166FDFF,0x3640BE09D37F96BC,0x9F58B785273C2D8E,0x9A6F665EA1474724,0x3D3724CA87A4429B,0x2F42ECB8D57780,0x5F8D213F0BBE49AE,0xA9D875AC2591B474,0xB34C8CFE396BDB8E,0x3675569ED8F52863,0x6B88662AA7A4C483,0xAF279384E21008D9,0xB05F1E12AA764543,0x23E8475045901A,0xBA681EA3FC57D42,0x725A16751E8DE777,0x5243C38254F8FAE2,0xDF0397C1F65D5B1E,0xDB517E378D81FF8F,0xF0DE9BC246D28529,0xC7BED4D2F339CE98,0x2A9D80FB07BDE2,0x1483818D6D83EA8D,0xDCC532F9F1F2FF72,0x8E2085B23905F604,0x12DC0117488CB992,0xD46272C617406F5F,0xA71D6756EFBBF5B3,0x7680A6C2BE3D91E8,0x16BD90C875F5D5,0x8CED944C01F4B1AF,0x695283F05173144F,0xEC8FDF42F91D0EFA,0x852D4C97FB65D3CC,0x45BCC0A0EF08533E,0xE8B13897917DE0AF,0xFE0593CE5C037117,0x3D015BFCC8D821,0xE9AFB31E5A26D4E4,0xBBDE6F4D65820081,0xACA8DDBE7CFF7EBA,0x548A9E7707344223,0xEBC4330AB004F360,0xF9F7C3E59F0234E4,0x617E9D451CD63A4,0x1D8A0A269D1315,0x94A901719C36D0CA,0xCBDE7DF6D9C082B5,0x7DBE48B123ED3480,0x3C787AE461B02213,0x56DED308F7366F05,0xE0D853BBEA4F8173,0xC5C105E791475023,0x30F1774D980BEC,0x7DEF47364665E084,0xF608AFB820EC7DBA,0x485D1B8DF98FFB38,0x25E058498BE94392,0xF78D927BE900D4C6,0x6177C198E5ABDE67,0x2FB0DBE726BA7B3C,0x361A640331A2E3,0x484872EB5479CC77,0xBB52ABE51957FD85,0xA896CA3118132932,0x330F9F5683A93A13,0x726A93B4DE3B60C3,0x6DD35B8E1E2CDE20,0x696FBBE9103CE3F2,0xFEADD99507A7F,0x775B5C3A89A8A62F,0xDA1CDD929380DE4F,0x4712E4B3BD8C36CB,0x2171E610992C0874,0x31F1268540B7D2B3,0x4D0A01B311D7A725,0xDAAF732ABC1D7D37,0x39BCB5B7BC4D24,0xD165BB00E26FC5DE,0x698C9B0E18C10B05,0xBEB03CDBB49460CE,0x80871BDDCE5189DA,0x8348F6FFB17632A4,0x897C0B2107D57ACC,0xB7CA58D7D23352CC,0x50FCE38F28D4,0x30107CDE2A05EFA5,0x20942D6F9A24B525,0xE633FAC33035EAFC,0xACE13AB543B1D33,0xF254FE464BE483ED,0xE56118CD0792D09F,0x3E45588F9B726E20,0x3F55649FF2F30,0x74ABD370EE5B1AC8,0x79CA0E481BCD80FD,0xF201276D83DD697E,0x84C7CA9DF313E474,0x5B1F94C3CBC50559,0x4878BC341754D311,0xD601820CD58757F0,0x29A6B592D88582,0xEE448E6FEE94EE5F,0x80F157FBFCC0B078,0x239754017436304C,0x3B16D4C3D28DB64C,0x6D8FB35F2079F062,0xF446FB8B923277BB,0xC64A62B73B35C89,0x3239D73EA6156F,0xD417B8CC81218BEA,0xBD28304BE6F478B1,0xCB2D829557916AF4,0x41A625896D0875AD,0x457F2069FFE1FEA7,0x4369D0D26FEDF9C3,0x4927941AC6F2C223,0x128D43F3FC78B6,0x494648D529E2E34A,0x75C3A51CAA72C34B,0x2952431F41F7A228,0xA240DB7CB0B3DD93,0x57EDC611A243A475,0x588BF1214DD690E5,0xD2049F432548E5CE,0x1AF42128CCE18A,0xA7FF3D30BB2D034D,0x34D8E63CCD11FFBB,0x87276093A6008B00,0xDC9D23F3D24E037C,0x3C537EF921E11777,0x328430EC92B070CE,0xB075ED126377EE12,0x1447F6BC627823,0x2A1E3A19E9A413C5,0xF010D7AC372C2E22,0x8E0C7EB311D52151,0xDBC6DB6D9169DDA7,0x91FD6D5208EFCB5,0x9B565D36100924B1,0x5405FAA2D834DF74,0x375804A68EF36E,0x69323930CCCD1CAA,0x659FA27C4F2D6FA5,0x2092963F4AE22D74,0xD200281F45F12137,0x9EF962C18D736015,0x7ECBFB59745B551F,0x2B884F17FD6A3991,0xFD97AC3D3BD01,0xF6ABFC9751C2FF17,0x5C499A110173F9D8,0x50CC18DFF2F3782F,0x991D62AE216D8951,0xD5DB480DEB1B42F0,0x1E5DA55BC57C8F69,0x254836A37E0FFDCB,0xCDFFED2E76062,0x5D0C2645B2238BEB,0x9F272FA8CE3F4756,0x6246927A2EECC2C6,0xD8CE3773B6E3D68,0x63325BD0391AC0E5,0xDFCD82AD868279BF,0x71F16C65423320E0,0x1F8E9D2E2077E6,0xE9022A7A7CAE818D,0x523F1B12A20FACF8,0xC96E76A85B40E50F,0xEF5F71DED745CD6B,0x1D7F1ED2D5377A2D,0xD84E3379606C1CB3,0xC2259A75AA90165F,0x7AB4140DA8B08,0xE2B592E9AAA4B01,0xE3F0EBB78FD6C4A6,0x125F4B31EA0165FE,0x5CC8EBE300F82DD6,0x22D047ADBED3B4C7,0x874EC1356B042DAE,0xD30B769A7AC085FF,0x4030D70A162A81,0xC5707FD7065E8A3F,0x4CBB26E32840EB1,0x98A2FF688ED78ED8,0xF33E01C6C6B96CEC,0x2E653F66330ED6C2,0x9CBAD385759B9999,0x53AC1284C68BD6D6,0x3947F2735906A9,0xF7079E38B1E31F7A,0xFE8030CF9C3B03C6,0x4E2DD1D24F39E33F,0x18D40537E21396E9,0x6DEB7F9423CC6132,0x39A9868405AC80FB,0xEA862EBAE178E245,0x188D9401CDD1ED,0xB14FE14363FB675E,0xF130FE74750D2FFA,0x5FA1144B0907E73F,0xA56D8845C5814CE5,0xC221144112DAD112,0x215F95918EAF106C,0x9401CBEA645CB5FD,0x310850C5F563AE,0xC93C305167CCDA29,0x6DDE498CEA18A937,0xE0E3E927BB78D6C5,0x6707CB7AE1E735D6,0x8612E1DA17E2BDD1,0x14537BAB2A73BCE8,0x63D4B2662D74FA86,0xF51988AB12D43,0xA0AF46DD375A72F0,0x15F2BBC2C195A1C8,0x35051AE3999D9859,0xB9995A916729EF99,0xD631336A47CD67A1,0xD320CBB2D88A8A95,0xE4F0127752E3F25E,0x2BC9E87BCEED63,0x82C14AF058506E6D,0xA2B6F323D8ADD6AA,0xD595FC5A5FFEF2E4,0x99B9E4B45CDDD332,0xA9C7BD5D3212BD5D,0xBAC2FC487D102C22,0x793819483BD00EB1,0x3A79797DFE06F4,0x256FF87B1230EF44,0x76C6AC226D2E441,0xD91B28ABD15D5878,0x865F7EC8980CE1B9,0x7EA02FEC26CD66C0,0x4B01065B8A7484FE,0xC907787EA217FCBD,0x16FED507E1CCF1,0x668C3B2DA85D52A7,0x62B4E8AE67A86908,0x8548FED7F3E1233A,0xE863FACF6E1CCA9D,0xEA046D3779435BEB,0x6074915D6B1AEF19,0xFCEB479C8620B3B2,0x23B0347943D21F,0x5180C305BEFCD846,0x446A6F232E525BC8,0x23B22A4114C214A,0x79B0D29058BF911,0x9682B719F9D5419,0xE085461EEA86099A,0xBA8FB6CE03CE0C30,0x303DF0A5C245EF,0xDC9127C1E2283C3B,0x371E42755DECE4F8,0x9163C0B6384F2D98,0x30855404C1CBB5AB,0xCA77CE0CE0F9AE58,0x3E591B8C6BCB5048,0x2E83EAB9349BD19C,0xD135B74E6373A,0xEA7D8379BCCE3DE4,0x7F82437E8852007C,0xA9FDA6C8596D6365,0x1FC37BC64050CC30,0x58C4F771D93D096B,0x2165CC2BF5057D22,0x3A6E00A3A939DB11,0x28A3949151E680,0x5DF2F18E7167D40C,0x5BAFC61532F321A,0x38B0CBFA464BC4A7,0xB736FEC93636B1B1,0xEE7A26A730C8C3FB,0xD9524699F7461044,0xEE574E122F58E22E,0x34AF00B10C4494,0x7756BE4AA0AF902,0x25CD136A8D49A981,0x8B316622D5FF9558,0xCF206BBEE71A6B19,0xBEA5289B51B50A00,0x742C6BD687E323A9,0x674A0AC5B8432F01,0x165F5E488119AD,0x5F8EBD3C47A3519,0x14E2558308FA92B4,0x85C819F84C9E9056,0x71A503B3F8B0DA38,0x8E638ED293B79FFC,0x7FD0969436B7A541,0x39332E616F5448C,0x1691BA94023619,0xA2076C95C0E9D3F2,0x18EB4940F30695E5,0x64453EBD2409AD5E,0xBC848683204BC8E3,0x231F7AE25ED6B846,0x2D866952923D93BF,0x555CFB5240001A5D,0x3BD85207DB5C25,0x592FADC83E143D5A,0xB79C41B01A75D1AF,0xD60FA52CABB39413,0x5418BD839AE04503,0x23E289B5403E717A,0x9E079ED27B4CC32A,0x2C3EFB2B2353F6EE,0x141D24645EB471,0xDD526F5935A9D962,0xE57BF3DAA0E8B5E3,0x43D9618F980A1602,0x31AA422AB037DAC,0xECB0F6492DB19766,0x93E088ACC91E402D,0x1E7341A0D34EBC50,0x16CBFFE31CC620,0xD77D194D88696BAD,0xF5CCF96DF9292ADB,0x9EB489DA0A7B15DE,0x385DEF9C51F56032,0x78A7E76EE1C045BD,0xBD5D7BA29022992A,0x4FB1300B7210F43B,0x3F7A97A12D991,0x66F68A509F8BF278,0x1FE6EE63C13B8914,0x56D12125DA02F90D,0x687D0099A8F5B9CC,0xEA5AC32E6976B569,0x9AD4DBC4AED7FC15,0x6934742F412EDE96,0x3223BF9DFE6E8C,0x5F7A8C4E5B632E5E,0x52A9BAB57C6A983A,0xF5D5DEF62069BC23,0x6A23903E61A906B5,0x13AF2B762BC97B84,0xC4F7B1B94A74F387,0xAE8F36EE8E044AF5,0x6E8D093A966C,0x3CF5C53C8747BD84,0x8BAC2F053C7B63A4,0xD9AC4BF888F3B5A8,0x263BBED01E86C7BD,0x3E8E1B337E6E927B,0x713E5D43BBE84436,0x410DE18CED169702,0x2337FD472F39C9,0xC2CB4003B85AC1D5,0x40392C0A4080E775,0x457FACB527824D65,0xD04A5AF49E88531C,0x4F83CF35072EF4F2,0x86788E06152E75BD,0xDF7BE9CB4643A4D9,0x29B0C6099E0882,0x9B71BAC0425F1229,0xF601EA2FCED8A62F,0xE51176AB94B37C3C,0xA8D638D54E1579DC,0x54D07F3EF7E46B3B,0x56A9BB477752BE74,0x86F673C52CE8A99F,0x2C8069B2BBAF17,0xB00C777638663F8B,0xFCF2ECC8600B7B8A,0xB0FFD7429FB905C1,0x792F230F9CD92F79,0xAF580C892A67FE62,0xD6AD5AE121751D2E,0x422142393AF1D8A3,0x372F49E5B03602,0xA8CA6DC1D25ADD68,0xAB3EBF9B14C0F0CD,0x23DAE822CF78BB72,0x25A096703162AA35,0xFE81CF3BC0A03C1A,0x8334406BD6324197,0x1EF8C061CA9E5C55,0x31FB9A960BD6E5,0x9AF30049778F8F9C,0xF4C89138635ADCFA,0x436CCB7CE696FA62,0x13DC67C031937414,0xBC8D00A97DFA24F5,0x982F0E6AF7812E4A,0xDE2493C9A091FB1D,0x26BE878EC8D756,0xB92A11C91D3C101C,0xF886411090D3DC68,0x9075EFFF978EC334,0x35C58E483A0EA50A,0xE785532ACC5B1BFD,0x655DD3B251CA13AB,0x4FF72D8997D30099,0x2439E1E5AC7D6F,0x9A030412548AD7B5,0x10F06A3F55F63085,0x9FEC298118BEE321,0x3E60E394EE631609,0xEE3E4BD689E630CA,0xAC79076B411D3A9B,0xD21961436A08CC1E,0x1A5EF0C5559CEE,0x133569BD87317A52,0x525ACA0D890E60ED,0x9046EE3C9A86C57B,0x1EBA2451EFCCDAAF,0x72ED10140C8702A8,0x5480CE95553CAE82,0x767475F4ADC15D1C,0x37DE45594A5A41,0x7BE509CFC31F77EF,0xD7C46C994787BB6D,0xAD5019891BAE538E,0xBBCC874C27135EB5,0x81584659AFE29443,0xE6B42648EF147F27,0x50FE64A57BC3B417,0x3CCB31BA2CC206,0x542E5616918C2E49,0xCDD1D9B7CBAFFA08,0x509B4F735F3C5C03,0xCEA5D5497B944F66,0x73D5563252FC12B5,0xE0221112F0DE160A,0xBB08AAD8E2A7BB99,0x25222499A7FE93,0x700021E58586549C,0xC03305425F01A1A9,0x4E63AD15B9EC7EB,0x1CF5ECF9E0472D6A,0xDBFEC082079593F5,0x5B8F17F3A326BBEA,0x9D4DECEE7EE3B9CB,0x1C0ED06309859E,0xA694E89184398E8B,0xF70ACF874F08EEA4,0x1F3F198DF36C6E2A,0xBC873D422E8751CB,0x43315F87BEFEC32F,0xBD30C806F0EA4A18,0x183EFAE5448BD5D7,0x31C5F19C1CB1FE,0x748CBD14A91848BA,0x59BC36D5865BCE1F,0xABB6508A50E15783,0xEA0C21D7EBFF2DB3,0xE35DA7D036CA9B32,0x93C5CE31A0678828,0x9698EF98D6D5C94E,0xC6D7A4AEDE265,0xBB403EC97E78E0D9,0x6022020A1F5F3538,0xFE4A9D8A8D841FBE,0x8A29F21DB12A8F1B,0xB3B7B149A9BCBD8F,0xAE9B6CF6F3771AB8,0x5B1B6810B0CDC706,0xA930116AE488A,0xBE8370A52E4D8C25,0x9D36B8B20F2EECF5,0xA54D2CE6AA1D26D3,0x1B169B1D65F92B37,0x9BAB79D30D839E51,0x8DCB04B90A23E218,0x84DCD137717B66A9,0x3A986F97FCDC5D,0xD1BD6B28CC362499,0x27851B93DBB4FB49,0x1F1B617D9175C9D4,0xF4DBCA915B29D611,0x38FAA300E378DFA7,0x387D917C2C2644B8,0xF19C38094D35CCBE,0x3A8018A5791D2E,0x3727C53BD12D8BFC,0x6E28E4542153E4B5,0xACB6AC5B279342EB,0xC2FA6B7FA8CBA811,0x8E78D449696DE2D3,0x796CD7A287BF49AD,0x8A41082E48A21C85,0x8B6774605B21,0x6CBFCCD673F3EFF0,0xB9AB40BFB85647B5,0x2AB3E8CF4F7BAEE2,0x1E726B980597946,0xD042A98302B9D929,0x50E99EBA20706BDF,0xEE53724CA219DECF,0xE7C1DA05009EC,0x8B7802BEF7A3649F,0x338D4A88CA6BE8F5,0xD1973A667BA7B8B2,0xCF680178E6DF6659,0x8BBD7DCBAFBEFEEA,0x64452F3A4EB18DFB,0xEB52739D414C16A5,0x12A44D3E3B99C7,0x729DE26F772D7DFD,0x94A68DD6C4774019,0x7A4BE1A42F7AE07C,0x5CC9387FBED223,0xB23C26FCC148BD1D,0xFFFB0EA7A9E23FEB,0x11E62440B48E5FDD,0x37C89113D03F7,0x32BD944BE3D51B1F,0x496E095B869A411B,0xC771FBA421DA4402,0x2EC912C47E58E585,0x72819F1199E2B3ED,0xB666598DD338E10C,0x9CF3A9F9C15EE907,0x3097A5433C2689,0x93CBB10B09C11E47,0x3EA0A98C6E60B04D,0x8A74C0D00A2253A5,0x3A6E078D3C02EC6C,0x3C6694107D8D836E,0xD8DF4BDA5C196286,0x7CA692538F3EF5B4,0x1B0B9180831B48,0xC546943B49C6D609,0xA21149D8FFAEA62D,0x6264CA622DDB50C3,0x327BA1B19BE61B3C,0xF059758FD0938206,0xF83F428A7A4373AA,0xD395CC9BF0CEA18C,0x1AE76F8D72C4AC,0xC57B774C101B7D99,0x24B602649C328A81,0x12439FE64E503F8F,0x425C899C917533A1,0x986A65F8AD4ED4CA,0xDE2DDDA6F8F718BF,0x9C185FCDD5F5E5CC,0x3D873440974AB2,0x1A1B8969FE299C5C,0x8E23FABA274ECFE7,0x44EFFB3B961FD1E9,0xCF897CC3DED28D8,0xAB4D7610BECAF80B,0x7CD400801ACECC63,0x732587F3D2338A09,0x8BA2E78D5497C,0xDC5EF7CEAE6C4A73,0x33D62B4322A86952,0xA13771648FE0FCCA,0xE3F5CBF2C58227F8,0xBB2C7D06EAC30EA1,0x9844F28471976FBF,0xA25517A8B247D797,0x342C1500AC10EE,0x68A3D5069B2157D8,0x26E84AC25DAB7487,0xF9C8617BDFF31892,0xDCBDA629C226A7A5,0x3CE775C7DD0B7296,0xC18F1439D87AD8BC,0xB1D656D4EC4EE1E1,0x100FD0333AC5E1,0xE8AE7C0FBBAA7AD0,0x3CA9FBC6C43D8963,0x449D3177369EC354,0x17207695465374DC,0x77D52546543C1E6D,0x307774010A22258A,0x68918EE875B22E9C,0x251E631E1EB9F6,0x7B2B6E8C49DA1077,0x3B7ACBB07FEDA73C,0xD3167596CEB4C458,0xB84853337452F0D8,0x62E67597486F88B7,0x8669575ABA1DD147,0xA96991BA65EB778B,0x33E8779A29DDD,0xCEB97554F6347A8,0xB5C125B6F49853E9,0x3BC0EE6924BF3364,0x8AD7556E81D79E6C,0xABA4005669D7A460,0xFB27FEA25406F7C1,0xA4085886EE434639,0x35EFA7D66CB0CA,0xD14545B54C9170D9,0xE1F4BB663487D90E,0x35F5E4C68179D4C8,0xF833E82D1758B6D4,0xD6843BE1ED3E61D9,0x7F8D1B108D658496,0xCF31F4EF52E04E37,0x31ED76CD3FFD52,0xFB5756E6376032CA,0x1A006291D92FF870,0xB263692B26A3042D,0xD26681EDA7DE6FE4,0x9974AF05DCD23A3E,0xC073CDA335F811CF,0x369940940B08BB3A,0x29FD783A54C973,0xBE1EEFAD10F6B779,0x90988217A2690E4D,0x9B2ECA49BED640DE,0x53BE1895065FF2AE,0xFA8318C5D6F6630,0x476FC30455CF7CB9,0xB3095DEF63B5E6EB,0xA86210F473CAC,0xDFBDC0C7E1134B83,0x57B2BB07C28146B6,0x6363293323D6199B,0xC1071AA8A40AC9D4,0x7C70B9E82CE3D784,0xFD4B5EAE16C5CBFB,0x63D1084F0F8164D6,0x33B35247085539,0x350012C9E786223D,0x216F5E0361B0BC26,0xE77045E5F103F0B4,0x51245AEE2F8C0338,0xBA90473A98B4EAE1,0xDC66FBAFBE29A16C,0xA7BE6BB161EF5970,0x2076D25B9CBCA1,0x4FBC212841DEDFD5,0xC4A3CE4A601BF592,0xF728D4BCB65FC6AC,0xD1CC72E28D742CC0,0xACA299C23168CFDA,0x2251A4D40FB3C55F,0x96361DAE9C8C0EC1,0x27E9DDCA838B8B,0x87EAD6411B9334BA,0x5C5B8314D72BAEB5,0x57F260A00580EE7E,0xC7CB9A2DE75E12E1,0xCC8B69909CE29D68,0x762CB36DA1D466E,0xF5FBAC980A61A818,0x210BE33C58CAB5,0x9F9E778A839AD25B,0xCC57B20E08D561BB,0xDEDEBFE9F0A7695A,0xEE60012399A8513,0x9492DEDC38E41E95,0x78A2B3477DE43FE1,0x84C0657D03FAB48B,0x2A64728427C20C,0x567BE6269BB104AA,0xD1024A175B686DFC,0xC954735D8ED328E,0x88C3028CF01BF1C9,0xB72BDF749F2B0833,0x68D4879D491E30D1,0xD70D1285D4B38387,0x1B6F28F26FB7AC,0x2EB62942400216E6,0xB5AC9D487EB8E3CB,0xFAD8398FA445206F,0xB9959AB23A382B5D,0x2967050C0452F1B5,0x7528C489BB98104F,0xC8121F456F88BBB,0x1981111CDCF3E2,0x7FBD498CE603D42E,0x42E23AE0752ACA86,0x5962E5C451024987,0xF328A91E78207B6E,0x9CD29F0E20814190,0x65B3718DAC2FE40B,0x6B2A8AF828CA57F7,0x52B2BD49346C4,0xB9C1B6DA9BC26CD6,0x4BAB9DBE3B0AB477,0x9E26A43C5F52DE5B,0x3819129CE7657AC6,0xEDDE1867EB060FFB,0xB85E269D86994EC1,0x80E9B88BF7BAF392,0x1FA1608BEFACAC,0xF3E68517038AFE41,0x6CC50A8696653A1F,0xDC8ED43DE5B61174,0xA69AEDB153A77181,0xF754CD6B73B21AEA,0xDF5772F71510F9CA,0xA8094AF17803251E,0x25720920D26B31,0xE5FDD4B19F261BF8,0x42BD3FB635739271,0x9B340578A17ABFB5,0x2451DB154E3FD494,0xC0930436E1486114,0x2300C1EC2719B841,0x9A0A737A612BABBE,0x2D5CF76F04E364,0xF0E8B836EA6F313E,0x8EEF39E2E6B2DAB5,0xC00512A5A62D7623,0xB50B40DB16F20795,0xDD652381CA845B27,0xF99DF3B79015B04B,0x48F657D4D23EEEE8,0x306BB51A119CED,0xFAC8E0C7D1FD16F9,0xA5F74885A3ADD9FE,0xA401BE7413BFA289,0x7A1D87042F9F0BE9,0x24A1BFC691A80F77,0x6CDECEB3EFDCF0C,0x9CF1DAD4DC78874,0x3A98A81612C1CA,0x88E63DE8BBE68B05,0x79EF315AA710A9E,0xEF7E3973B18AA256,0x345308380D71DE,0xAC293BCE0F96AB8A,0x1C4459422C24A635,0x72CE2840E64630A,0x2EAB603790FC17,0x2E6CFA4ED6330562,0xB4C72620D6078533,0xC3FF10B6C27B1D95,0x407064063E4EA60E,0x5AB9D52FAABEC898,0xBF3D6781BB591BAA,0x9F642629C6A0FE96,0x9D2171035AF8C,0x382BC81C6CE829DD,0xE2BF790B66FE201A,0x29E9DB0239CF0A7C,0xC46C372A88CA1BB6,0x450004F3AF4A42F3,0xA670374503937FE2,0x7F0862D62F87D638,0x26C523A41B0333,0x9A5F1B5B037AB9B8,0xF7D8029C116E66A5,0x4DA036C9119E29E,0x3D33A6CDB9C1FC90,0x4ED925D47669BA76,0xE8C1C161D7944638,0xF5050824807FFEB5,0x1C04EBA5791C7E,0x9571070ACF85D11D,0xC06F6ED84E66C982,0x5E3BAE62AF23A79E,0xC2FA5EB2DC7F04C8,0x20D7F027E85C293B,0x3EE156E5885BA918,0x9B91BB83C0C9A564,0xB78CD5663C51E,0x7DFDF1007B73740E,0x73068A43BA2001E3,0x23E725C0C6E37A26,0x29F0E6D68519638C,0x8A1D1680F0D5B6B2,0xE1C565BD3C4E9EC2,0xE9E697382F96704E,0x3C7887C0E2F747,0xAE7232CC1D33D716,0x24EF5F29AF806C48,0x260B6F06A9C10D84,0x21BF899AC9AEEACE,0x836B0972B929C465,0x955067C2D073494E,0xC3135711ABC34C2A,0x1964E287CC9F64,0x7AF30672662663E6,0x741E5269987179B5,0xB7432CCB1E2A57B5,0xF9A3BAF044E425D6,0xE3B501EEAD2DDC77,0xE7B99D39F7147BAE,0x5DD5C4F1E42BB638,0x1CC02883582723,0xC6C0BCEF97EDE4B5,0xBCACFA46DBEC5C1C,0xD86DE7792D12AADE,0x91E04DDD251B6621,0xBF4B4DB8E1EE46AE,0xB6A09A8FEA0B245E,0x8406A30F35EAB581,0x3DC7F9DB3FE5F7,0xD47A5EB81755D07C,0x73D703E871C7BB1D,0xE63A96E20F6BA5FC,0xB0B37A1BC4EB88E,0xF0575C9AB25F0BD,0x3BDC04F0AFF49347,0xB9934739A03C84FE,0x3A8CFD944DC612,0x2668F381FEA1948E,0x306107AD73C6366D,0xE5A392A97F8B91FF,0x9BEE5DD0BF9205CD,0x77677211C7274718,0xD14EE383E2F1D4DD,0x220A3FE7E49BECC6,0x340032DA35BB88,0x349F58BF06B4170B,0x6D605BB5DF0F1C13,0x1440E64AC708B30A,0xEBF3D028D7E44C03,0xE9A78D66549BA9B6,0xE0258049F5026AF3,0x4E61832ADB9D65BF,0x2EAA323F20EF68,0xD15E521CDFDD49DE,0x1FF6AA347CE1068E,0xF081F45E862B8E71,0x38B2F3D321B22B93,0xC0D3994C36D6C354,0x4B6299AD8CB3C4DB,0x4174CDE376EE7074,0x3735BCB244B9FE,0x9071612DF72B051C,0xA455B92631CC6113,0x7F84CDAE05A5DEDE,0xAF302F6966FD895E,0x5F8AB7B7EF5D91DB,0x85B275BF937EC6E9,0x30551D30BEAF9EED,0xD38049A931AE1,0x459EF2FCE92F8F59,0xF8728F73BD27DA5C,0x3C62E912D86F6B99,0x3C3279A680E6FFB6,0xBF2ECDC4AC840310,0x619CB26D84F22C2E,0xCCE0D57A3106DE7A,0x1ABA919E2AF717,0xE401BEFDBEB973AB,0x17A47CCA1EA2F97,0x5CFEEF6C3C4F966,0x1668D867AA6E9ECC,0x744F2B13D23AB9D7,0xD583BDEC383982C4,0xE3ECB4030C2AEE10,0x6F9254D7F5DDA,0x4C00D7DAEF5BA76E,0x39C275C08CC4C09F,0xEF1925A77FD189EA,0xBA4A17A2A2A5AE0,0xCC1FFE6EA36F2A21,0xBB066C0D15DC3B92,0x580E4FB5AE82682C,0x2E2D3BC1B3CACB,0xAF74EA9490901CE1,0xCFAD3E627B14CC9D,0x342A4E4CF1587040,0x9177B672D98DDCAD,0x57EEDC709C417E23,0x6C63E3409B8A803F,0x2E371800E7593348,0x83AC48FBB193C,0x62768C863B6E15FD,0x433027AD54136ACE,0x9DF72FCEEA9900DF,0x2232ECC9C7F3E482,0x8723178DAB8F4DCF,0x46A7AF72F89BD49,0x8556CCCF0B90C027,0xC9BEC4AB2D9F5,0x9CB1C0B6FE4A76C9,0x59060832C907CB1D,0x5E438B83B83627C8,0xD17662CF88A561BE,0x8B6BECF04844BC40,0xCABBDB7AC505FA0B,0xB5F02616E1B24A58,0x19437A9DD6178E,0x4D99D29D741608F9,0xCFC605901CF04200,0x3D3CD57E704A03AF,0x5EDC57D149D6C861,0x93B54A43CA928329,0x3318619704CA70DA,0x5915AD2BD861F76C,0x17DF146457C8D2,0xD9609C002B22C823,0xA512EAE5C53CB72F,0xB34A203001977F5C,0x23E4E3466A3BEF8A,0xBF63C5B276DDACA2,0x744611115287F5F1,0xF94DAD11CD93FA5B,0x21B3AD117FCA59,0x960B64C25655603,0x675325D7A9F30446,0xDBC8930E5A179F15,0xB09D6C964B240EF3,0xE99EB0F82EDD6A45,0xEB40A902350789D0,0xB92E48E87E79A9E9,0x1661C4C57488E2,0x305376A644DA038B,0x1C994ECB381D6D4F,0x9176D17A8EF593BC,0x25D1F7D8DA543974,0x7C6863752A7EB7FA,0xD9D80DDF680A8146,0xA9845413F8CFB656,0x22EA1B7920070B,0xCB016C3BC6FFA72A,0x7A2DFF413B0C2F5D,0x861D2AAC028416DA,0x56E44DE3726AEC2B,0xDD8A23CC3A0F35F7,0x13510C1463527ACE,0x9D17EE51E567019A,0x317BB85E8F955B,0x844D131F651D1FED,0x17BADF9BDAFB97A6,0xB7B393752E2CA55A,0x8C244B866951B27D,0xACCF0855136DFF2E,0x4C0A70DB7DFCB2EB,0x296B593FBF95C40D,0x208AF28398F3EC,0x5B61266859EBF597,0x99FB5CAAA37A585,0x661A2129412C3176,0x96DDD5790F4D3AE8,0x3A9CB684999302E2,0x8DDD97622C964101,0xB1FF230CEB0C9CD6,0x3068C405C07C39,0x7608DEB8FB0B02D,0xD45F0C6E2587D66E,0x29BF3EED40EF21EA,0x16832F4D9D464AE6,0x2A51D76B585DE324,0x9FDA9A0F36727FDE,0x1059E0CF69630C1E,0x174A3B18D99F58,0x5925E75EB36DF360,0x3A16FDBF77FA6430,0x2C44CDFDC64E4240,0x234F68F094776D1C,0x809907994D8E5077,0x61D4AD0C87A3DC46,0xDAFBC313B79C4E9B,0x3C5F48BE63AB92,0xED430D36F9EF0EDC,0x7290FA2057B8DC3B,0xBB8049A3A4D1D465,0x96425208CCF216F6,0x2452A02562ACC16F,0x7F05BA18F7B6052,0x6A56BBC77A66A622,0x249A07C08DD337,0xAF99EB90520894BB,0xD6D8F943D0375805,0x97FE7F54789653D3,0xA27FCE0BA757D1E3,0x76BE7B2DEBE3A832,0xFEDBC2561C89B9B1,0x5ECB541AFED86C5E,0x30E51A804E76E0,0xAB77A09F2DCD6B5C,0x9D3FB468BF2427,0x8001E295BA153257,0x84F495244E6D3891,0xDFCBF48BDEF97207,0x591380D47467FE22,0xE15DB233D036CC3F,0x177E9F92F817EA,0x1A802BE79A51ECA9,0x7F0AF6679E61ECFF,0x6D27E2EC250C0E38,0x1A87D43783EEAA3A,0xA9334E9C01A5E776,0xB85277793F833225,0x9E035B358DAE70EA,0xE6F09CDBC1E8A,0xF18C8FC57BDDAC9E,0x8F35771723A311AD,0x595534492BF0FF97,0x696E14A71CD303C5,0xFFC16ADFBCFADBF1,0xE20E9B85E9BADA10,0xEC0E35D86C84FB28,0x38D629B9A08F00,0x72FDA85909158D46,0xDE8024AE3D3A337A,0x33130337EBB05769,0xFFB20DDBFA459D88,0x57098FB517B4149D,0x5C591A05EDA84F53,0x8301D65E98CDD0FE,0x1E8B1141DD0DD8,0x19C9A86C08F6F2CB,0xC975D29E731D6017,0xD75141CC31D8AF35,0x3CAD1E19FA22DBAD,0x28ABBE1A74EECA55,0xA10628C89A674BAA,0x766412C97133BF2B,0xCFEB7E325A34A,0x9363356A53DA44CA,0x8FAD62AA65F7B5CA,0xF6E4C75942133415,0x3A22230F92B4461E,0xC614074143FE6510,0x3BC4CC60B38CF9AF,0xCDEC47FC4DEA98DE,0x404000F822C70C,0xD3EF08B488EC2472,0xCD896CA3BEE9151F,0xCB905229DB125439,0xEA6F55A4D678A5A7,0x7548CB88B50A57E0,0xC1810D0AAF2FB281,0x4FFF44448329F208,0x30FB67B3F1A0D3,0xF9EB39C893FA42DD,0xBD400D138DB61C87,0xD987DD1E4A97070A,0x90A464493FA812DD,0xAFABCE6ED7C5A1C2,0x119C5284EEBFA362,0x9C410D12AA6B7CED,0x2BDF72D685F33E,0x9FF15C7407E9644C,0xC8ADC6466CC9365C,0x1CA864D95884719E,0x2A7E60696D5416AE,0x1C82D9216305D9B6,0x7F2043277763CA1D,0xB2ED136A82D22AB8,0x15A94EDA5C53EB,0xC33401D46AF4A36F,0xF8F700C44F1F3F10,0x5E7B17B150C1199,0xBE71FAA3F1EECDDD,0xAC884BDB4E73F9E,0x67F9026AF656D120,0x9F63932FBF0630A0,0x11DD548F9C8642,0xD98E06941A2ADD8D,0x63AECCB43403E4EF,0x53C80F2410441112,0x24E91BCDBFF9D039,0xF745D3CCDEAF7E97,0x7A1379379F470AEB,0xFF1577D9BA64542F,0x5DAC3E061F14B,0x2DF10E6541C166E5,0xB2CD4FE172AC1A74,0x938CD7F0E9CE2502,0x156324CC0BC866A,0x95A51ADD17A0734B,0x761514CBFFAD9FFB,0xA7108FF626F49CD1,0x32F4053D86249D,0x9AC4A5E521C85439,0xB9BE1F75EB7278F8,0x17A3759FD158A92F,0x98171A1D2B0CFAA3,0x61AC70881F42D054,0x8B57A8E9F68EC11,0xB7CE59C0B44A1530,0x9905D095FAC6A,0xB64192CD90D8B5B4,0xFAD569F06C948D9F,0x1567D94C659C6B9F,0xB11F56E3F8E8243B,0xB9FCED850021E90B,0xAF5E8338B16FAE1F,0xD9F9386F0D253803,0x56022DC59516D,0xEF2258E546DCA9E7,0x87FFD96BB7B8364F,0xB2BD5DC52865508E,0x7C22566AA43D5F26,0x5A5A37A200BEB83A,0x7676A0A9AAB7256C,0x1B5128FF69AFC9A7,0x3748E007D6C157,0x343CD6CC92F3792B,0x6277A55B66C9697C,0x7DDD4BF4B9500B87,0x4DE0A0A080554EF3,0x6EDF6A71F9A14E72,0x8FD50BF1831D6A5F,0x39E4875FE48BBCBE,0x244FF6A96861ED,0x9C1F4178500ABB02,0x7041F2B4F99E570C,0x92F3C5BA697DEA3C,0x3FCAB4A6FEC19C3D,0xA389CC027A34CD91,0x7BAA94D769DD44D1,0x15756CD6970370B8,0x364FC16B615885,0x1C910DE15B6B71C0,0xD196F5BD2105618A,0xB9B3370DD3355C52,0x3910663A09BF0838,0x77A3963C170FFF8A,0xD5172AF60ED24951,0x1966E3F64AA63A73,0x31AA05C1D301EB,0x5550B59D0BF954A6,0x1693F5D25BD64F70,0x2FC4DEDAFF3518D,0xE932D3CD3BE28671,0xAA0881E31A613625,0x32ED86E23442E2D7,0x6B5B1E99B27BBB4F,0xD3590C6C6DFCA,0x79DEFB2D6C268E9B,0xBABB50A0A64FD8F5,0x48E5F173AE2693BB,0xC5168D80FE1ACE4D,0x2255F10857D48E50,0x21B037C440BFF82F,0x90834C9603B47FCE,0xB6F48BCD833CD,0x1D5DB2A1AAC89E6F,0x6156F013A6CBBD59,0xBAD7DFA91DDDD42F,0x519D2D46ADB2517D,0x6A0F03D4EE53D944,0x98FF62BA1C9F6884,0xDC23DE7BFB75541A,0x13231C1D79F17D,0x8DCAF5BB48A9785C,0x33D0CC6DE9A0C310,0xC2447415CE75D37A,0xFB83D69B6DE9E2B8,0x8621CE2EC8E9299E,0xDBF762A759B93533,0x55E3888660E48DD,0x36D3FF8085D604,0x200012C0D9FFB0AA,0xFC9BFC3734BE73D,0x284003A5AF299F9F,0xDCE2E2FC170ECCDC,0xC3F57A60B7AEAFCF,0xBB9ACB169866576B,0x9C84D751677455FF,0x2CB40675FB932C,0x3A47A7525D351671,0xDAE3C027CA2B4C24,0x7F22DB5CFD7E9CF6,0x8013CEF78EC8A32F,0x41D5B49404C3D908,0xD0388A82BA4D8DA1,0xFBD6B3A66F26D440,0x1D924C282F7BA3,0x8346DC9C8B5094A4,0xD5B4EAF514199648,0xEBE6459F0366FE00,0x3417DD17535B6CA5,0x52D2C211FAB6EDAD,0x83337D9ABAC19609,0xF2666019FA51723,0xC52338671183B,0xD6608CF67A26B770,0x8676E77043F4B7F,0xEC2912830B6B193C,0xB656871058486984,0xD29E0052F7C20AE5,0xC8D654097D4AEBDA,0x4717FBB2502B4702,0x2AC7F1F632551,0x442B175D5AAF4E6C,0x22C57C9466539E3F,0xD88F26922EB035FD,0xE5994EF5851B5AAA,0xCD2A91F05F167F0D,0x799984BE450314DA,0x52DB3CD27154482C,0x20C40C669D8858,0xEC85E73FB59DE607,0xA3154F6FA6B74CF6,0x5C61B8D5B3A21D30,0x444FA85F6CDC167E,0xB41264C66BBE8669,0x6D7F846E49DE7172,0x640BAD9C23F3BA9D,0x2EA3490EAD8089,0x240EA277B96C03DE,0xBE492C0E09B19005,0x46ECE397B26342C6,0x80B4245CD2611FDF,0x85ECCCB3CF5C01E9,0xE5FCC40698F13A60,0xEE2E351DC8B8395C,0x318DE3F36EEA90,0xEA37FF75BA408009,0x285D7600DD3D1122,0x4C8ACAE6621B774C,0xCD100D9FC4310C27,0x744A86FEE4194FBF,0x3E208EA5FFE4C29A,0xB10A97C6D2D46AD1,0x3378D86BD6374D,0xDEA5328CD029499A,0xDC3EB186E44754F2,0xD211D354A4152F2B,0x1F8E98E1995FAA7E,0xF56905188A99E382,0x6710392FDD92F450,0x5EB5BDA8FBDF0707,0x3C5F858259AE95,0x32446C38F6EFF481,0x25021D5B8E7A269E,0x90025F29394184A7,0x9096F69D36934C67,0x6606CE1DCEB024FE,0xFD8624050146BD6B,0x2C888EA7CF8105E3,0x500744A067C20,0x69D9028B5AE7C2CD,0xFF0D9FE4169F6EDE,0x9D5D30946C31BD8B,0x3E9A7EDE7028FA45,0x1A609C52C5543433,0x2951E5EF4834C09F,0x957D0256B35E940F,0xE363CDB4D4445,0xA89E4973E71BEAF6,0x449A37134CA8D718,0x4EE9D05F2C1DD3D8,0xA6B5FFD87330DADF,0x96554037F61A6D57,0xFD35423976DA81C1,0x65917A7DD7F2C688,0x3FC1C0F332C058,0xE7DD9E2A80C944B5,0xA1696BD52E516546,0x1B1EE8AF1C2D5A83,0xB691E206BEEE102A,0x39A7EDBDB8D57C68,0xE076DFF1639CC084,0x4972A4DDD0B2C6D6,0x10648F3F5904C6,0xED7D0A386AD4E009,0x342188BD68089289,0xD159F338BAFAAFE7,0xCE0D86C5DF52B87C,0xA361A79A196BC882,0x8B414CC93B60ED16,0xA8573C0A7D9BB746,0x808C796B3BB5,0xD87AF32EC9681DFA,0x33C6B9D9552B295D,0xEA55B0BA4C572C66,0x36208F17980155ED,0x5C2B7920ADADED3F,0x76AAA00DABBCB0D2,0x9DB4DA9E02E2E0D8,0x370CAFCDC4ED9F,0xC28BDD92E2A0304B,0x8856B7352E5069F7,0xF7BC947D2DC8754,0x87A8D09FFEEDB1CB,0x817E011492B567DC,0xEB8F6BA96BF5D8E,0x66D5BB006D3AC3D4,0x2E88D6571D12D9,0xBCA27EB87DD93EEB,0xDC26176F6AC4D918,0x9D71E50E663B97E9,0x70489B6052B33130,0x62C526D7C3A562E2,0x6001976DD160B333,0xE3EFB00E5D5B544D,0x1FFC9A63AA3F81,0xA0196B6DE99C254F,0x52E1CE0CCE403D6D,0x80B62A89570D109,0x9A63F02E8BD644CD,0xB623F6FF187D565,0xEC73B73670D9F76,0x966F0187831B89A7,0x111CF533F41B27,0xD4074BC503625F5D,0x974A12E33A6A5392,0x759A0334F39A5D23,0x5621F697570A9B7C,0xC3EBB31180FC8E64,0x37C4DCC5D6BE1A96,0xC6D82D2886DC52EA,0x3F1A87D0083C0E,0xE8FD14AFB6D063C2,0xC9D1A7D46410EEBC,0x2F383850E08A3F27,0x7FEDD55EC5EE95AA,0x568C9F310ED2ED26,0x462512D0AF54536C,0xF67B076BF22B5DBB,0x8724A2C9E2C37,0x4D0BFD2C218B3B5C,0x89CCD81FD136AAB5,0x52D6AFBAD07E9A1,0x90FC8C3690B4781,0x877ECAA6B46F7ABB,0x56389D5599E7544C,0x2E6E68FFA744B5D1,0x3338777BD9B445,0xEE9AA0F7A360849F,0xC3D725C7DEE17247,0x37670ACC85181894,0xC135DF30264A71BD,0xCAD01BB75452BB15,0x540DD42454C62CA9,0xEE0DA2CD06D7864E,0x20C7EF11E0E831,0x7D2EEF85244689CF,0x79ED10E1C61C9133,0xA75F9583A7FB85E7,0x79190A9A49279D85,0x4BE160EB994DB7AD,0x5E898675AA1C77F5,0x5446FBA2DC58EA68,0x403A76FE4E3A72,0xC3A3AF3E26A5ED81,0x8A54F30852146491,0xC21EEE78CE565C4D,0x23FDAA0225111F2B,0xD9613265BCFB5A4F,0xF98909A3C0575779,0xA07A829DA2FE5478,0x694106E661351,0x9ADF437D4B011ED5,0xDA1F23A14D1004B,0x61CD2E29C1CB5DBE,0x6917489388B440A1,0xFEFC249E3049032A,0x4BCC744E307FF90F,0x34BD10E0FF689DF7,0x26F58B078663A9,0x4DA45F804BD21AA5,0x258BA99C25662966,0xB053CAFE6935F46E,0x1B09D51374F96B68,0x41856194A3F64304,0x392CFF5FF9DA4040,0x3E2451D4D21EEDBB,0x2590EC3ECB15DB,0x60A7DCF94B154428,0x22F45DEFD705221B,0xB3321E91B61FD5E7,0xEF48C2A9F8D22EEB,0x90E132251A88FCED,0x6F980034B0587437,0xAF47BDE646188971,0x37E16D39A8FE92,0x32F8CED8DD13812A,0x8F672BC9D61F2B47,0x50F00F207DAABF60,0x1EC83C930D864EFB,0x2F7D97695781485E,0x38EA0D7C7C20C076,0xA9303D22817629B7,0x1BC39E45A233D7,0x98105FC76088E138,0x61A2CE27873F074F,0xE5E18BA0975E3BD,0xF387C628D8E4DEF5,0x250D793F87094DA3,0xE20AEC4313194864,0x611BD2CC2E3EFC4A,0x7F31468FDE8CB,0x6EA967826DF55AB6,0xF595BF879C247E5C,0xA7FCB7F2CE95C16D,0x2538B9EF02DAAA43,0x709748FF300F9AB,0xEE2B249486047C92,0xC8F4DC2D5F0D8F05,0x36EB57E82C83ED,0x853163A062AE9D6F,0xA233663B2AF2CBB0,0x44412CEDCD4F2BBD,0xF695D99F57D145B2,0x728940011723F6BD,0x47DB09A684EE0EBF,0x7256CC391C0C3380,0x2EFBE9384CEB3D,0xF0B664F3DF7A89A1,0x9EF43C017B1E2D6,0xB0892F89F6BEE1B1,0x1ABB61F748B881CD,0xE55B4091A682A8B3,0xC704B861D83CB67B,0xB78076DE3C4C1DF6,0xA6CBD44890D69,0x167A1D658B8CC205,0x1B9C6E7FACE5293C,0x6A7E6D00E0856CD7,0x2D7F575B7E61840C,0x30F977BA92C63F0F,0xBD3519F74C9EABD3,0x1BD263BF152E79AC,0x64D531C10A27D,0xBE96464CC18E408,0x73C777A4B6F1E3C9,0x809BA9F81915F273,0xC51859E1AF537028,0x9CEBB22338600183,0xE2197753D8077471,0xF30ED9317092753B,0x2209C1A4F7E26D,0xA3099EAB509F7A7B,0x90D4B3AA7C2BA4B5,0xD99DA1640A4FD24B,0xB055D34F44C7580B,0xE7A1610B4EAA730D,0x4472E6AC0B465CF1,0x1574742C862A408A,0x1158DE21FCF46D,0x46642FC39216911F,0x67343557001B90A0,0xB76963E0DDC1DDA9,0xEFA6976E218942E2,0xD16C1EE479D33B6B,0x1DDCCFBE9069ACA2,0xC6F51D6132D66A33,0x3F90821AF7A031,0xE3D65763522CC01C,0xD604EA81A1A3549B,0x53F4FE98198B98AB,0xDC02F7FBA1C70258,0x22BDA77DB181EFC4,0x90DF4AE8C19A11C6,0x6357C74DA12326BE,0x391B58011F064E,0x9CBA907FA5F1F8E3,0xE245EAEF447B8CD2,0xAC31DDEA5F263A51,0x2D9D32EBB2CFC00E,0x2C73B296B25E5053,0x6BC920C6CD60B7F9,0x4250EE3F2D20CA2,0x36F15B85368EA7,0xB7DBF7A50EB2CD4F,0x50F0AFF72F4708C8,0x8E5E9F63F5EB24BD,0x58ABB878CACCD82A,0x99F32844C96A5D3E,0x8EE134FA05AC4D43,0x952269BCBF958C7E,0x26CD3490241B85,0x5D52883211E38036,0xACE03CC3BA7F247,0x72C1879140398C6B,0xEE4CC41693477875,0xE5CADBEAF4AE8947,0x31E76E28156F3C58,0x702A4C5512DD197B,0x3B18F714956C38,0x170F0CD5DC0268BA,0xB7F12D922EED0568,0xF61012A850EAADD5,0x5089BC3BAA894774,0xC20A097DD474B530,0x558B5723BB808B01,0x61ECE17B8FEBE029,0x57E4D65812A9D,0x38BD24366271D004,0xC3C993DDD22F9225,0xBAA6109459612623,0x2E6C835C64532DBD,0x4DE86BF3D4653FE,0x19FE09764842F8A,0x7EE42CABF2D4DD03,0x2EE70F63AD2510,0xC292CD16B6C8D3E8,0xFEC549A17989A2B8,0x6D369D8E230FCE9A,0x4CD91E9CB16955AC,0x70D07AC21E124027,0xE69735638F877DEB,0x38A61A08450A837A,0x2C6109E2033AD0,0x217FE648A970F2D1,0x49980C0B94C8C141,0xE4E9F9F0E50A7FBC,0xBA4AC983C57169FF,0x71C09C0E4F53FBE0,0xCF9199D0C588BCD9,0xC16D5B6C7C4B5D07,0x388D7AAE448970,0xA20934F3B3E02EFC,0x9FEDD917C780797B,0x1ADD407012ED5B83,0x8266C9975AE98139,0xECEBA93EBAE4C17C,0x8E41A22472256A8A,0xA4D60962E22AAFC4,0x2135A9B6C4374E,0x341BF8B0A147E713,0xD5F2BFBAC7FE7AF9,0xD58B53C61FB768DD,0xA7C56BAE84FA7670,0x3DF7093A37AF4736,0xB6DD3103D98D200B,0x925C3810F442C56,0x3A45494689A327,0x176ECFF23945B954,0x17E231EC9DF46F39,0x8671758EB2B54305,0x804D3A6F2FE2FC1E,0x2444D047586A1147,0x751A7B49E7B76A7A,0x590354C5C7A6BB60,0x22EA9ADBE7686E,0x54C86F8A5106732D,0x45D2B986499630E9,0x78B975AA44B25936,0xD2DCC56661219517,0xA05CB1EC5A064C23,0x5BD37D1AFC74BC63,0x8358A2550AFA97E9,0x24013DF0596D58,0x4E8CA1ACE7B002E3,0xF12C01DCA19589,0x97FD82255AD6FD9D,0xFE53AFB85FC7A82,0xF73F7D539A31492A,0xDF79DCD88F87F945,0x87F01308E5197D18,0x3DA516D802A7BA,0x455581D561E08DFD,0xA891820C0E6DDABE,0xC194FE678A69E1D8,0x23C3C80BE8C1CFA1,0x84137D11FA87DCFC,0xE81273AB925DBDEE,0x2960064BAFD50638,0x3CB630835085A,0xFD5D1F7556B9CD0D,0x2403350C3128BA88,0xF2871210CD6C6A1A,0x213EA90E6E8F5B30,0xE810CA9437FF2A8,0x20FD1874109D6C5E,0xD4223E58E7AF4D49,0x20A330786411A9,0xB7AC612DF4F9DCE4,0xF009E44B38771047,0x625E5FD1D64FB0B0,0x2A82A5D12E17A38D,0xFB729C8F4E7413E7,0xCC2F2B1CAB243ED8,0x4A3A1A1D94D8501E,0x1D5BB2ECD2BAF5,0xAA8A8E80A90CFDFC,0x81D3DF5CBB24C334,0x70B11421D4F73542,0x5C77175ED4FE7097,0x842608676547EBC7,0x98B6D6DEF16C7CE8,0x63A74A3F05C20A7D,0x18D0C4EEE77DA3,0x500921D972008A9F,0xFE07ED32DE6DEABB,0xFE48C7045016CC05,0x2599E0414946E987,0xE28432BFEE0FAAF8,0x23A7605E69757FBA,0x461FB62E08A5CF68,0x2D12B650977912,0xD840F2E2036C1D6D,0x1B4827AE3F8682D0,0x7874B2E051A530B7,0xBD274720B9E3F695,0xE3E604D5DB8044BC,0x87A8529808DE7DAD,0xCBF2DFC7AF6C81AD,0x3A72A2AB3D2063,0x5B4528387BF54E5A,0x177EA9BC5D06084A,0x7A9187E26AB2C55B,0x914E89FA146AD3B0,0x918367103FB8380A,0xAC2DF54695367262,0x79BE05F51F900922,0x24FC41249593C6,0xFE1E348C548D1FBB,0x4D1F494D84B6E209,0x783F4D0CCA61776B,0x718EFBC56BFBFD44,0x845A9771507C32B,0xD9E784B9FE97C6A5,0x67E578D017EE8001,0xE327E86836943,0xF105387B22C9CB53,0x5B2A209A2F1AF22C,0xEAC05BD277A57C11,0xC606D55E7757328D,0xA2DC254D87074F9B,0xCCF562A6CCCD9EFB,0x75FAB83CD0AD7753,0x12D0394F9630AD,0xFACA6CCF9352CD4D,0x87ADE27749F122AD,0xE18437D846CD2C8C,0x4A2F97E56A78C40B,0x2A3CEFEF712CBBF,0x1D0DF05A82B1E757,0x923B71ED4BCFF251,0x1488DCF2CB1C5C,0x98E9E25251D92337,0x34F335D14C2E1F4B,0xB580A5B08EB06E8E,0x80ED862D50303CE9,0x640C2D5DA7B044D8,0xEF5E3F9E31867351,0xFE2D1316B7602F35,0x1F9F69F88F504A,0xE56BEC3555DD3462,0x1740E4805ECB2F3,0x988B79528F293E25,0xC1241C4A1ED39175,0x5C88A509B8293531,0x109893AEFEAD7F40,0xFB01D708E396C61,0x2AA3B03DBE2DD4,0xA2FD952CFFC9E131,0xE550367A5DBF3E35,0xFC74EDBBB7131AE8,0x469107EDD469E671,0xFA5AC4ED028292A5,0x5FAD0E21880DC956,0x44039E4DEF65C6F2,0x32008B44D4DAA1,0xB32938C6B0E7CEC7,0x1DBD1E4EC1F5B1,0xB8EDBD5E6A6D13BB,0x396C413040C07ED1,0xB83C4E8B28AFB348,0xC457FD2D4D6B9F3,0xC60DD8FA3023D29D,0x25E4B40D0991D5,0x92F4A78E7404DD2D,0x317CD090AC97DC95,0x403C6EE81BDCE582,0xD99D853C40311E8A,0xDADDAB5EE48623E4,0xDBD3095511ACC9E0,0x326AAC09A2C854E7,0xABAEE4B50520D,0x4BEB3913B2B52CCE,0x1E6DC029CABCD19,0xDE5737C96B2F3187,0xC5C79A3F0C35A03D,0xED430DF88D2F79C7,0xF15D9AC880717E75,0xD88F6DAF4A3D57BC,0x3C7D98BB289D5C,0x7FCCD66402764ABA,0x99B606850C88F366,0x2F225A3BD71BEE21,0x712996BBAA5E3EA4,0x127B3BC4C9B6376E,0x639A03EC96366624,0x9E74A5D9643DEE4E,0x190DE33EB3FA72,0x7F71D0543FAB4D1F,0x524C6B17173B11CD,0x763F1702760140A5,0x218434E9D7C6AB87,0x21F38C0CBDD06FB2,0xE5011419C1D9EC8B,0xDE3166CE2766C8CF,0x39516A2B4C6EA4,0xFFA448F01C774C73,0x29C4F8A86164BB2B,0x456D7A305F6EE66E,0x2C4833DC199FDAA5,0xD24977F0FE15DFAF,0xD7031C875835D904,0x62E52FA237FE3BA0,0x248197F9C24D3F,0xA46DFA2151B95E80,0xD3ECD95785A72094,0xAC57BD494987DEE1,0x78BE54A1031207F1,0x665972AA01E58C44,0x83BA717D200ADE0D,0x2C11A0D91EDE9A2,0x20E0500FA54F6F,0x69C26E948AF8A445,0xDDAFF992BEBE60F6,0xA7E6D64582A7EB5F,0x80E87F9D0E627A2,0x6B76E37CC0333159,0xC354637C2D8081B6,0xD7666CC743498F0D,0x173C25C722A6DF,0x4BE703F0E0577C26,0x1D87059D01C0A8EA,0xF94FAF4B8BD4DD7A,0xC0D29AFE57A58093,0x2AE9C3EC94922A12,0x699141ABAA6CAA14,0x97926BB19559594B,0x3B2C2BD72D275D,0x2543F8417E166B2A,0x7C9B9069943BB5CC,0x17B59BB202BF6A31,0xFE3F01A1B99220B,0x16A1A83537BD7C8C,0xADF1ECDC1660DC3C,0x680E29BB198EA1DF,0x2F4689D59968DF,0xDD002FDAB113F1A9,0xD789CA6143EC5B9C,0x77FF83A2B2BDF189,0xBC7324705F576A31,0xC374A0623C85EAF0,0xE6FA24A23628E859,0x9D5383FA1AEA70CF,0xB3BD9A2D4248F,0x67172249DBC26824,0x2019F6B22ED95302,0xD4431ED73003B2,0x74F9756BE0F07D02,0xF7FDD5E9D179D668,0xD2F7EE3F76888391,0x747B001640EE2BCA,0x8E48CD82A18E1,0xDA210C4DB9FA1EE6,0x4AEF8EEEB19198CD,0xE8CE72A645DE6F6C,0x53399874379F70C1,0x1D41582D5BA1FAB9,0xD5B03C20198B0660,0x48E51FBA742649A9,0x459E29BD7FCAA,0xD3BF28C793013210,0x43B9D87E9D3C7E79,0xDB9707BEE52CA347,0x8EDDC8529DB3FE7D,0x343DC23B4D36166,0xEFBA8A76F6CE6504,0x75F1C2A28E9A27CF,0x231D0A294C9737,0xC64441C2832DA237,0x3D2D48C41D0155F1,0x5B2E2D695FE2F5CB,0xC2461E14DE37A74B,0xA347A586B79BDC18,0x2A9C073A77EBEC75,0x32C119EEC0C12789,0x2D78FB221348A2,0xF35EF30D280C483D,0xC41F2FDB9ACE4CED,0xE76CEF3A90E5CFE3,0xB849FC4650B3D7E6,0x17B16EB1E2DB6E43,0xFDC0E9003D2C02AE,0xD7CABA98265AF9DE,0xB383ED074EB12,0x7A4B6221FBDFF48D,0x801BC8BD155C7761,0x5622423CE12CCD43,0x488CEF194D601615,0x4B3EF39C028B452E,0x25F0EA3A78A145A3,0xBA3F248CA86B792F,0x50D28E39F46DE,0xAD3D01B9C34E58A1,0xA26EF4CC1F37C221,0x98854FEC6058FA74,0x1636AA22AB466864,0xA628990EF4C3DBAC,0xE0AC166C24E00814,0x2BA9C53B8A624E,0x368BB9634E5B68,0xBDA2652611DE12B4,0xB077A9A634AF0399,0xD5D863B75E3FC36D,0xE6767EAC232E64D1,0xC497ECB9B93003CF,0xF18037BE64224DE8,0x8A11C4E657D8721E,0x29E18D0996EC12,0xBA1C1F5960A5AE6E,0xC88AF60167BA9A57,0x190856625D5D708F,0x2971A0A151A39CD7,0x24D721C2357484C9,0xCD170BA51AC9167B,0xDCDC1C6ACEA480CC,0x1F0581505F4AD,0x5B13DE9B1C162A09,0xDDB51EA11499DFF4,0x26A837761BFE26DF,0xA33AF690A33C70BC,0x4BC55524668C2010,0xA38CC8167CE95CE,0x26162B15516757C6,0x254F5AE26D52B1,0xB27B88FDDB0CF7A5,0xDFC542792DF3D638,0x64F9D767D668338A,0x1BFCAD0175133A97,0xED2B0BE48C6BA5EE,0xD9A7424280736A79,0x379B8D04CB047EBF,0x34828619864838,0x6D070FA9DB792179,0xDCAE655FBA25EAB7,0x5FB0998F39BFA8D0,0xF64FFC2C9E2C658D,0xC7A6159A65CB7E19,0xCDC02BCB635DA8D7,0x665A2FAF0177249B,0x32EFFA9E773B7C,0xC1443E1024A71F1,0x4A71137E4DAF423E,0x8B710503F680AB74,0x84F6CCBE2208C852,0x500CDA6A1AD3FB48,0xF71E73A23793EBC8,0x6E0E467D0F481250,0x395AAE34DE8B6F,0x28E63EB230B76186,0x17A3442DD7F4F90C,0x79C21EF8E229838E,0xFE5D8504A6821C26,0x7A508805283606B3,0x663AD7429AD9D4BA,0xBD22769BCBD7058E,0x29D0520F7FE57F,0xBB2F7FD1FF545F81,0x2D92A83476C6DF07,0x5B831EFD5CC8BA9A,0xC7FF667A313403F7,0xF6A7F47821B699D8,0x20DD7EF04F130A07,0x1A5660FC611BD8F6,0x26D09698F3E614,0x56449510ED252686,0xC97ED2DCBCAE8EC0,0xA1481B91D32A4687,0xCD5838584AD5309F,0x9FCB3D2C365AA033,0x97B9859B389C6FE9,0xB7AC2FB674B161DE,0x112EC25C06EA4D,0xF789F2FED3C88179,0xBD996489A109616,0x16CD9880C7E857D5,0x5AFFE18C86DE082B,0xC072661D6ED8775B,0x828921910E87DF2,0x92394477950D2C00,0x2483042F7B5D0D,0x92049E0ABD24FDE7,0x9C8D35D7DD4CE4A2,0x477C11054861B059,0xBF1F9658FD47447C,0x73E414400BCF4E34,0xA64D7ECD4E91069B,0x98FF07D12191AA20,0x2ED753A36190A6,0xCF732AE643C79D3,0xF252FA4E502EE6C,0x726E9DC64A97C533,0x1929B42A5DBC2457,0x9E852A34EE51BEE3,0x8CA550C7D427241C,0x7631F9AA9B18071A,0x21D2853D571866,0xDD8658058321C0C,0xF52E93708BE953EF,0x25FB4BA92095F22C,0xBA1BEAD9B4B0C750,0x742111957A5F9E92,0xF7F44879A5420789,0x2D9DC1B31FD78570,0x178269E59A1AF,0x1A8239C6C5CF6F60,0x45BD32C05D355318,0xD5B835A680C3FE86,0x1471607E6A2A0E14,0x4359D29AA225F5F3,0x7F3BFC97553C1EF5,0x63276697319972B,0x26763693C9060D,0xE03875249175D09A,0xDB400F5EF370B6ED,0xADFC102CADB8F68A,0x5A09339E4AC35E8A,0x52EE039E06D8091,0x70625A8022C46EC1,0xDF0A8E4FDE476CC8,0x1CE9C61B81E35,0x795869149F9A7E0B,0xBDE7DA61C702CDC4,0xED010F10BA69B2D0,0xECE9B110F7E3B243,0x3FB61DC51B42FCBA,0x9B08163CDD0F61A4,0x9D08F8B30328F771,0x1C352D75B2690C,0xE09FDBF87D89AC57,0x96E546EA9779A74,0xDB4A66631ACFD612,0x1B7B1369C2A57FC,0xC6D1405C8832E2B0,0xAB786B91842C3B3F,0xD97340941D7DDE,0x2D6A60C729A9FF,0xA75937EFF674DFB4,0xEE012A41E7865B22,0xB9A11D20ED6AE11C,0xCFAA252A9EB57DC3,0x2A869992A5AAF47A,0x7BE6D79B84586D80,0x716B0965E87DE2BE,0x3E242711DC7EB1,0x1ABC23F3EE96D460,0x8A41E32F204CE679,0xA90E86E964B7F2FF,0x6D292BA20120778E,0xF6414EC5602E4321,0x15408C7A4FDF1D84,0xC1EADAFE4668BBC,0x31E1E7A54EB2A2,0xAD4A7556BC0DECA6,0x786CDD9F07F005BE,0x60A50EE487034396,0x9F657892C39633ED,0xABD4514471214DFF,0xBC75277FFB60249B,0xA4ACA039CC84696D,0x39D76F18A9A37E,0xFE8CA72F3A6CE92E,0x90E488791F4005FD,0x19A4EB1B032D0FBD,0x135C2F79158DB2AB,0x6273F25EE1AF1CD1,0x8D4F0DF78FB75535,0x587EF614705BB782,0x264D5622D7FE15,0x2F95D4EFE70C6F8E,0x288536F6BAB07228,0x6FB7DF3A6A7BBCA3,0x3032A08DEF4D6A8A,0x78823BE5A19212DB,0xC4609A3FD7AB686C,0x81129B85D088423E,0x137AA317EF1D50,0x86C4D5EBA568C954,0x556DD17D6286D687,0x1C7BBC965634F830,0xF5800D383ED54013,0x5A89D5CE60B0FD22,0xAC5755CDD2C73D7,0xA05D9AEB2C0BBC09,0x1F28F7131CAA9C,0x3FAA4437C8DA349F,0x9365C2B420897C52,0x5C23736BF6505915,0x1BCC77A51253775A,0x7AEB134CF9FEC995,0xE07C170DE225803E,0xEC69C0AFD88DB209,0x3C85839DEF937,0xAEAD00800EA3A4B0,0x4BB578DFAEDC28B7,0xEA15E9662B99C4E6,0xA3EBF78065D233E7,0x89E35C24A1443F55,0xFE72DE5D8DB91BEB,0xF7465155299D180E,0x17F40D9047629E,0x9CA79FBCB3E77313,0x5CB8D41CF06F6937,0xFF114D8682ADFBC6,0x7C225EA84ABC35E6,0x7C19FD7FD0F5CB82,0xAC07E15A636CF0E6,0x8969D8213199CAB9,0x34016BC3639479,0x8317615E5A02AA88,0xAD65D6EF7EDBD27B,0xE9408FDA7A83E8F3,0x6D13D8798BE3DFF1,0xFFD1A61AAA46121F,0x7D15904033B01BCF,0x425F8170CCD4383D,0xADCD09ABA684E,0x976DC943CC7AE81,0x9A85487898FB1562,0xC882FDF6773E4396,0x570FE32518F55632,0x4A53D8B5F75997E2,0x3CE8C192504E4D7D,0x4940FC59A816A843,0x27678FC9BAC93C,0xFFF4C018FBBC8EF2,0x79F3107512DA9D67,0x1B5D97F498DF6EA3,0x30398B4B8C59E7DF,0x25C05F9738E78711,0x3464BFE7D5EBAFE8,0x8B7951BD6A8023DB,0x2F0EFF1F9E3738,0xD2B9E87C06F94C5D,0x97CD2D71DB6E6D85,0xE9D269A91BD0522C,0xF1BB995A5B95E37D,0xF600C0009169812F,0x5E74545E3C51DD82,0xA61047B2A53BE107,0x3F7D324B0DFF21,0x92CB9BC2D9F7F609,0xD7C25A2CBA1775E9,0xE67134D6226614FC,0x9A13C4E091EF7370,0xF947834A9E1AA315,0x69913D47D9AAA608,0x28AB445551B65456,0x3EB24E881145B3,0x6890FFA9D2F6868A,0x820EE1A42E8F7A64,0x864C4FA074749D76,0xF58F64AAA02E418F,0xA37E31AEE8BD26FC,0xF81F0CE05F527F07,0x63AF8730BD12AE4D,0x2847AB0C4C425B,0x70BFB8C9E59FEB9F,0xCA86663606F12107,0x79E5CF89AC075A2,0x43D20A4ADB1FFD3,0x280CE9ED60DE07A3,0x9D80D6EA87EBEE32,0x3EEC0D48CCB7EA45,0x2EF661BE040E9D,0x7B3226806D0634BE,0x9FB32594FF4BC86E,0x131E924B28FEEDE9,0xFFC0124FF7A067D8,0x56388397A51186D9,0x994DD2BA55C9698F,0x751446197C6A2E2E,0x2536949E1D3B6D,0x45AC6CB3A0B643BC,0x81F66B1D17BDF40,0x5F39F15E5D715D17,0xAF7CE30B6B3EA443,0x7FB884BD06FF7225,0x19436967B60607B,0x459B4B661109EAB7,0xE3FCFA88AF971,0xA98E581D553CC37B,0x789512B539195BB5,0xCCAD81816603611D,0xAC219DF3D5C7EDA7,0xE4CB5072E4CD3CEA,0xAC8D43CF7B3AAE34,0xB2ADA5B182CF1A1,0xC267370422AC0,0x10D97DD37C8BB3A3,0x5EB30C10FE3B7D0A,0x2D77C62A6F83EBB7,0x8DA66088E03C3DA6,0x9A6D48C929E4D77C,0xCAB8B78F98D1FB3C,0x5141618C6E741C81,0x3DA4E09364839A,0x4DD3333E1A5C542E,0x929854A193073B84,0x20D98D04DD312A8F,0xF16DD505DE0327D9,0x3591C5EA1ED96FBE,0x7A3D84AA30D63E6B,0xC8D79E537E073F11,0x19049F72B208BB,0x59AC208B47A1409A,0xFA8B782108DDC170,0x5E955FC977622A1B,0xF97DCE4BB10C971B,0x480864377D0B0CF3,0xBDE9B6658AE436D5,0x854E3E67F9CCB0A5,0x32B6FA7D56E15B,0x8722833BB0221BEF,0x491E115D8680362B,0x11BFDD7DBDFFEFC1,0xA509E72F4EDCFE75,0xA97756EF79B6D30D,0x32A170A70BC39186,0x988DB3545CD51705,0x258A19DA388CF0,0x4484361BE2068F03,0xCCFA09FA79AD898C,0x549F45593086CEC3,0xBD9B0CC7EE911FFA,0xD5B7A2225AB87D7A,0x146364B7EDA74F3A,0x6BCA893B69761846,0x209FB17569EF22,0xD8A842348B40A1A1,0xB64AA32E488FD4BE,0x9736CC27C24F669A,0x51EE1E0ECA025496,0x432E9766AEC6723E,0x9783EC3BEA2C805C,0xF9313210BF5B5E90,0xDDCAE5E79E800,0x6420BC74C1F63ACF,0xF93901B4074C4DF3,0xB98EE11559F2F4F8,0x65E9B592F07F303,0xF63081D1A1612ABE,0x6152D2FF07CC39BF,0x96A2B6899991F2AC,0x17623A39B6ECCA,0x3F5648131A7BC568,0x58B34A4E8F784534,0xCC219E1A8E41882F,0x8A33C123905A094F,0x508A559FF58BB7BA,0x57CB9D37CE2B0665,0xF7D10190B2F7A69D,0x31B9D48885D7CB,0x85195202FB447E83,0xCB3E13A84EF1806B,0x9EFD0D8DEB7FFE,0x74BCE6F0561E19EC,0x57AE04BFCE2CCF62,0xCCBE3BC48B0FD68D,0xE6351E43D710FE44,0x3467F782F42AA3,0xC22AD70BFF4B7C2E,0xF124449498F93C7,0x8285A07BC98B4059,0x477ACC9DA832015B,0x546A35528DB7700C,0x8B1E147292F7CF2D,0xB605BD122979F9DF,0x35FBF57624DD0,0x1FE5A1CC37B5FCCB,0xBD234BC4893F464F,0xFD102044835AF164,0x3E0B6C431757CAB0,0xBB3B3E9FE68D745C,0xD1D20972B0441D0,0x85E29CF056F23ED2,0x19C02CF239DDE1,0x8E6586D8E2E50DFF,0x8BAACBD5464DA876,0x615BDFE10DDBDBEA,0x8B6D6ECA684B6870,0xD512BA6638E19FE2,0x5CAA8D4F2713E6AF,0x62767E0624576F0C,0x6864D2BD52C4A,0x179B1AA5C1FD15DF,0x84E6DDE43A4A1F11,0x311D4306B648FCB7,0x265D64C01E524F89,0x2CBCD246E72EBC83,0xBFFE6CB3DE42E7D4,0xB424361672F850DD,0x2AAB3050E70139,0x38A67E46EC85CF16,0x348EC9481843BD85,0x3B1333824EAC494E,0xE89203AFD76D16E7,0xB91DA8CEC763D2C3,0x6836053F592CEF83,0xB95CE2DB40D04F96,0x5500FF136A520,0xCF0BAA2044AA6F8,0x7756339CF567E050,0x7C01CEB4455370EB,0xC0946F3C561DC02B,0x6C9CE4C36DD78CAA,0xDD4436D8A5FABAFF,0x18F27DAD2AF5B8D0,0x27C9FF9FF2297E,0x927D05A6EFBD0D88,0xD33CEEFE4CB8D19,0x52D213A0C4C6B4F2,0x1A849834A3B8C7A7,0x559812A80063FBC8,0x58B4FFA9753BE13D,0x6174BBD7138AFF10,0x10D47467D80A5B,0x32E1392338BCF785,0x3AD3BE87AF9A3D9C,0xE5EF41F907C4739B,0xCECDFC072ABD4694,0xEE843A5D1FC9436D,0x97C3A47B26A5EF9,0xABC72F817A8E7954,0x37A650BD7AF817,0xFBE8FCE64DCC6F2,0x886EA78DCC3E27D5,0x45C8AB844F032FA2,0xD0F1041A566EF4D9,0xD48EB28FB234CD52,0x335E35C77E2E328A,0x2C0A3A661ED06B85,0xCF2AAC4EFD183,0xD8CEC322D36BFA09,0xCE238F6E25BF9637,0x29D0CDF8F521DA0D,0x982FB6E9788DDD3A,0x75CCD040677AD71B,0x53BF5701294AE26B,0x948D65D12D916226,0xE3617F5E525FA,0x3C501C3875A10917,0x2DBACD663FD18993,0x53AFEBFED674DC11,0xB2F0572FB92FDFCF,0xFE21DF2210B831BA,0x93A760FACCE5015D,0xCCE32CEB73DAA922,0x213C9B2598C46F,0xABCC5236D1DD1EC3,0xD24DFABE3D45442B,0xC3F5A17BA75B838A,0x9B75C26FDDC51827,0xE9B0FB764DE6A39E,0x59B0530508F70934,0x5B9AF6EB200CB4AE,0x3DE6045EBBB517,0x162CBE0420BFA917,0x61B9A85A95008ACF,0x6D7A21C05223FD28,0xEC235ECE8D957751,0x94A473411731919C,0x54C4972E471DDF87,0x4DF717D75A194217,0x2157697D7DF49C,0x4DF744FC1B0AED79,0x3EC951DD37C4C772,0xE4616919FC7F6F3B,0x8FD92A7A9099B703,0xCF6B30C2681B6FBB,0x6DE1B990BA3E6852,0x968352890C3C31A4,0x327379ACEB59CE,0xA7BB6186373913C7,0x70104931822130B7,0x238746724DF71C68,0xABF3D3633CF3741F,0x6CCAE1573E5BD073,0x4AF7790CA738D146,0x893D504E7867FE72,0x18B522845E4B49,0xBDE9DDC074F43DF1,0x2B9F8D4080A6311E,0x7503932126607F26,0xE9BB32D5EE966EEF,0xC6797AD0C1AD1832,0x4140225A7AA45068,0x2B60B87D7D33BC8F,0xC886088FB75A3,0x9EDA0F7F99D27FEE,0x10EEF2B0B76C3D7E,0xEC06AB8CA7AD4A4F,0x4AE28EC504BB34C,0x8744BAD1248EC361,0x50D7F98C8B6326AE,0x4FA748253E6DA40A,0x25A3AD3F23FC33,0xDD056EC79BF3E69A,0xB0A7BBA9525EBC00,0x67C1751B9C57DDC2,0x64ED6A83B8053BD4,0x9837FEDF623F2ADB,0x36D20FB8C44CCB30,0xB0D4DDC3B2884A4E,0x2553FFA8B55DBF,0x7BFD73BE6D961109,0x43A4FE9488F9952D,0xFB914CD1C765B5D9,0x6EB87AD8671B869,0xB5F126F8DE407D59,0x9A13491B7A7766E,0xDAEF7020D3D6AE29,0x3D97FD3747D71D,0xB5769798B36384F1,0xED515D13F223D1A9,0x191A6F42EAAA2091,0xD27B3845ECC9C532,0xE03AAED98DA728F8,0xEE0005712A120F0F,0xB3EE5515F0DEDC8B,0x3135728ED57758,0xB31A7BFC2DD8A6F8,0x647F13B047BA84B2,0xD7B02B2B81678BD4,0x2361E935EB64739F,0x3843BCABE618E565,0xE8CFBD36AC85940D,0x8FC5CA13F873B8D9,0x35737FAD4C92E4,0x6933829DBBBE5243,0x2271A4137DEA8A37,0x5EDFF09D712B772D,0x718574C9BC969506,0xCE4B58685ADAA391,0x173C7D96DD0F810D,0xF4482D37500F84F7,0xA20119C21B610,0x6659B159D237FF24,0x9EDDA5B103369CB1,0xE48685E5540585E0,0x3A9AAAC31BE1A84B,0x78682C0C4BD6FC45,0x63BFF1450DEA8C94,0xEF4D31B7A24D6555,0x115B32246F316C,0xD0DA92134E198CD,0x607C345D5BA64357,0xD1A7AEBB8C915BA9,0xF77EE93B6682DF39,0xD7032134B660B7E1,0xEE3BC71BB909F91A,0x14C06ED32C24E025,0xFF6058712D7A9,0x90623A92B9602F4C,0x3CF8A84AFFE6403,0x81C085E8D0311455,0x10CDC6991FF0C5F9,0xD1D764D50215496D,0xD960795ABFC97471,0xE10D58EBF2E04C63,0x3E68E4AAFC93E1,0xC5C4B946EDAD3C22,0xF9C42DC5B5B7B3BD,0x7BF3D2FE23B41080,0xEBFE604BD5E8DA8B,0x6FDA1B02CE247C09,0x97FBC39D01B0A396,0xD738DE953E62CF32,0x1879E9F8901B0F,0x766F4308745EE6EA,0xD7ED835A6AE7E27C,0xD481B6503752FA26,0xB0A84CA362462497,0x42ACADF048F5B48D,0x73D2DEEF1DE7721C,0x845D3B6DF04B7F56,0xA021BA1B5F5F6,0x200C5754970E94F0,0xCA5595FC778FFC1F,0x8657BF91D1CE406A,0x968EBAAA536F937D,0x1B1F66B6B8500916,0xEE3CD681BB1B4692,0xCE534B56E3B48550,0x364D45CB535346,0x4A38E8C81DF399A3,0xBCD5F6DC6C7C2D13,0xD2DB50628FF0DB8,0xC73BE2E4294A22CD,0xE3EA8242EE2D8E1C,0x7D3107524BFCED9B,0x7516DF406B8DA1A,0x3C69E5E9F2641D,0xD0853002FD81FF51,0x18EF069E18B765DC,0x4EAD782406AD9170,0x84A4F0219644868B,0xCE1F47E430956CE9,0x938F80221E9A8F0B,0x3168BA4608A00741,0x2D35070F28B506,0xA50E5E4AC13E8AB,0x4C970D767361EB01,0xF9C6A2FAC3BF3918,0x41DD7D67BD6DDAD7,0x91293222271C2C32,0xF92804B07C31F137,0x8ECBB2556353F4,0x24785369188353,0x88F728270F1FA310,0xF7C863506B65BE3B,0xAF897AAE884A687A,0xF1B5407CE94830BB,0xB747C666420230D2,0x3389CD3D7602BD4B,0x56D787833B3B84A6,0x10851457F71773,0xAAF8D6C4E1507BA,0x42BD7A5FBB8A856F,0xAF99D5DEB3BA35C2,0x4DD5F15C46A61557,0xD693A4E67879B47,0x692A9245DFB44FDC,0xA76DA40615AC0030,0x348F788ABCB68A,0x88D9BF8A63FB4557,0x526E0A37741548B8,0xB8FBD515FD881930,0x25C8C80FAC0366CC,0xC340C7CC9DC6D136,0x4AF7AC88EFA5DC99,0xEF2A2BE0AD7D1C55,0xF014732C54EB6,0x73652360EE1AD9FA,0x5C57D76029F217E7,0x3CDCF9277A5AA67C,0x880347EF505F6C80,0x60BD8765B20D1FD3,0xA1C2A277896C4B75,0xCC20FB07AEA34C6F,0x2A3B4CFA66EAB3,0x649F3037C358E1F,0xB165CD39B06D63D4,0xA680629BC32687C1,0x72C15AB20448BA0C,0x5B2D526CE881819E,0xABF2DD55D34F4A34,0xC506598CE45EBB1D,0x15577C40C98654,0x1BDA561505EB7A,0xE439C2D51D0DE8A7,0x9A41AEF083227BEB,0xA3F13624361C0FC6,0x9828762D2308975B,0x2B5FF87D1FBCA1C0,0x90ECF895BA0A4A,0x3CC6456B2039DD,0x1DA17BF06D3C3EE3,0x40D8CC9BE0AC63E9,0x6865A739FF04E27D,0xF6FA411EBC52D875,0x2959AE8A38B7A841,0x1D105437FEDF3CA2,0x36DB8F7B4F1FD159,0x2999F0BDBCA301,0x5C0FDD6D6BC15AFB,0x412DC813A269DEBD,0xD12CCEC1E744F16D,0x9FBF5ABA5527FC7,0xF083C0546566E97,0xB88D4B0EE1982322,0x4C9102E783646ACE,0x3670F427DBE95C,0x527FF04ACEC98F36,0xFE01B57F64120507,0x9864CCAFBADB093,0x1A5B69736A9BE06,0x85F5F83B3C478296,0x26C9AFB308A0E873,0x73D5AF69E2FDCF4D,0xD29418257D498,0xA61382D30F9CB646,0x30597D47C0FDC5AA,0x27BF9AA3087895E,0x7010348778B326E5,0x81F447B97DDDC209,0xAA0EDB33C3EBE454,0xA9D206FE94A31EB9,0x27218888A76B4D,0xF7357D1265B5E59D,0x35935D3A0CC069AE,0x126159B66E0CAD72,0xBF89529E0E1C9C31,0x3A948E08393136F4,0x808615C40204C246,0x2CD6717938A9128A,0x323BDBE9B169B4,0x1F12A2EEBC7F105D,0x87DB95E87DA9098F,0x65B1DB61D3A42FA0,0xF2ABC2261E074689,0xE3D30F48CD4F257D,0xF115EE7F75B4E9E9,0x5E32FC83C8C1A93C,0x2DA4CE790405FD,0x8C948E48E62601B5,0xEEC0525BA8668838,0xCDF159DBE30F7F27,0x6B44FB9E6C79D714,0x84F89EB6698D645D,0xC4028B98F7CD2334,0xE626E284CA3161CD,0x391ACB2DBF134E,0xB631DF0BB599B2E9,0x70DD982DFA6E4638,0x259C5A7C78B0FC13,0xB3244795995850B5,0xFE61828CF61DA93B,0x1E76559D7A61EB6E,0xDF2B99B27A4CE81D,0x290EBF501CDDC9,0x4A9BADEF1280E509,0x514436A7F6DBD2A2,0xAA6D1128689EBA80,0x63AF632147EAAAB2,0x5BDE15F916CBA33E,0xD5C056B2778A8F9D,0x5BFA09B576A6F911,0xD9A0E1CCF2674,0xBDBD5C6765E2A782,0xCBBFE58BCD3D4D06,0x4D6D0C4B23921DD6,0x11681AC0548A50F2,0xDDD6E930952223FD,0xEDF5A842DD06EDA1,0x6E1DFEE51264E51E,0x405D5F7D2F3D9A,0x232CE566885F6606,0x340E1657D006FF4A,0x75F3676EAA29068C,0xCE86AF1E56E64F76,0xD3DB61B84D85058F,0xF72B717FF23D7361,0x134157E2599AE41D,0x278872EC57E83C,0x26E46F1DCC671CE4,0xF33BB889A74E374A,0x3D14480C5EF86711,0x50BA74BBAD6A282A,0xA83D7614A34205FE,0xC68BAD9DB006FCC7,0x2C8AD123BA08571B,0x2757765035B519,0x62E5FC2253C1326A,0x40AB9B29F0096840,0xF45D4D3CD8263777,0xC3547909260D1C0E,0x25F2B11CAF5F6C36,0x49F353D151AD7D95,0xBBE2D18BA73B424A,0x2259FBEF0AA55D,0x90266951732B01B7,0x36DCCAB243B2230A,0x68E2DBE8CC116DF4,0x7F22B00A962A223A,0xF6292B6632EEF3E,0x1C1BE5EBA0579C6D,0x8A861FD49E1348AD,0x2E8FF44B67B286,0x4CEA5C82525E1865,0x1BDEA36EEAE27BCB,0x62C5FF3831BFC14C,0x99C76D642FCF3F12,0x74B5EAD13B2FA6E7,0x95B58F2501BDA9D1,0x4C08217938173782,0x39D77EB1E8E467,0xC75C58A132BB998E,0x64A97CEF60755023,0xA754743EF52D994E,0xDA996A3A12508C9F,0xE1609A0BC2696151,0xE438E23B3223F38B,0x2B38DB01A9B8DA6D,0x2A9A2355E1997D,0x2CA67699AAA9463,0x1D9814FCCA24B76E,0x5BD0BE13AFB3D0C4,0xFBD94AFA7C219DB0,0x26C47DF2F622DAE7,0xC19D8F4F134C47A4,0xE7F6AD4FFF5929FD,0x2F290172D18CA1,0x4149517481128C84,0x7155D260503C5797,0x8A30D64A448146CF,0x8F04AA8CAB22E7E5,0xF5E454F03C45166,0xB380698E962A6ED7,0x883535C2A3B0432E,0x3B55E904824D23,0x92047680F975FF43,0x16D42DA7FA24CEB8,0x3D3FE45D42FD6477,0xC7F7AD59F77B7D70,0x1F96B6ACBBAF6199,0x4BB61158C1F5E68A,0x244D39C3FFEABC7C,0x3ABC03223C1C43,0xC82D5C0B70408E1D,0xB0CF82832C5FF5B7,0x8FC72AC33015C4CE,0xFEF2A6229C078C29,0xFC467472AC3DB499,0x95DAA0D44B0DD251,0x89A0C31708F9A91C,0x35048C29BAAFF5,0xA2F0BE55FDF5313A,0x58D8184124BC3142,0x3D5967CB8D3DFCEF,0x30A5F706FD6C2AEB,0x23CA446DB9214318,0x6644A3DE8E6114D3,0x8D2DD2B16E3B300A,0x3071FF6C070C,0x93DFA364ADEC5426,0x15ECF66FDC76742C,0x17D7EB73363B8D19,0x6D929EEF3AA03AF8,0xEAC675AE033FC9D5,0x5246895533C62D0B,0x91E6D01EE09FD586,0x578826BA284F5,0xDD13ADE160CE3A27,0x549DE1D84D509FEA,0xAEB7AE44310B560A,0x5562B7B04F4677EE,0xDA5A1FDAE8144902,0x8E7A8A12F720B7DD,0xE7BA3263FDABD0E2,0x16B0B2B59E8C85,0xEF8EBF0812CC664F,0xF600B968DB079D06,0x2CF40D19892E888,0x5BEFE9402214906,0x9F2E73F04DDCF85F,0x565962F8DABEB1D6,0xA5DC9F8F7D7AE728,0xB96FE4535FEAF,0xBD3367C19908CB01,0xB6A6F49D98EF3CA8,0xCE28632ED0F53B43,0x354A932F7B8F5F52,0x21A4C61655866340,0x1E9EB24745E1460,0x566B169CD44DC8C2,0x519136C995AC6,0xF085A05B64276D4E,0x6F5164E803C56096,0xCE38CFFD68ECB5F1,0x38C81295D678A14E,0x72392A53495229B4,0x3F682DEF16FB5586,0xA7FAEBD1FF6E4854,0x6CA4FA4ABC0ED,0xBDB1D52B18B8B32A,0x6157FE2BFF78D7E8,0x600D682A1375744D,0x3F1834F06CAECAC2,0xC5C9B8FFBA34345D,0x6DC635B934021136,0x75C993BECE0F6583,0x10E5FF8EAAC7A4,0xE9F242AA2E77843E,0xBB12F41EF478C99D,0x46B2FA47A02F73BE,0x34AB5D3225F783A,0xC688A0D03263A3CE,0x62113CE6DE5FB037,0xE59470FF8187DBA4,0x37E26CAE787045,0x1B0EDB958FA6BA2,0xEB2468CB3EEE35FB,0xE52165D5B4CC6967,0x84DB49A7EA8E69D0,0xD3B5DF39EA46D158,0x81860760592D6845,0xB8C9418B09D8DCC9,0xFB0040AC8A972,0x966609BCB0A89CF1,0x9309CC164E666585,0x6DB3A66B9FBDCA7D,0xC4E0209597DB992F,0xF2B35643CBED525F,0xCDAC6D89ED04DFB6,0x7990E55AE62D1D48,0x6B399A8EB0BF8,0x70E76A618643E05C,0x21639A2F037F5763,0xB3AF0EAA49B36214,0x23DF3F4031D9904D,0xD20C33E0EF8EE8CE,0xAE15D35AA7948EC5,0x9B39F5AE57E4D0C6,0xEF6A78078FA02,0xAC8C531516963BF6,0xECB5F1CF9B9CAA2A,0x400BA047E25F112D,0x2151D18232DB720D,0x663C55D793DADC2B,0x795E8F2ADAB9E331,0x2B689369B6E9CDEC,0x2A06CCD70423E5,0x4BA6B34C2720E091,0x2D3AA414D19AE96E,0x926DEF0B3F3D653F,0x7A6360FA322BB3D2,0x8A05306964F7173C,0xA5043CBFC46E07CB,0x8F9173942BB37398,0x17917880ACBB0C,0x742A01E192658A18,0x11D41E8ADC5DD0CF,0x5BD8D8A66210BF6,0xF2A3FDD692266FBA,0x87BA4ADAF9A55281,0xD5B998747ACE8E42,0xA49E4A548B29DF86,0x1C71F741099DD6,0x9474415CA4D8914E,0x88EAB44D34CE58BA,0xA9A4FADF9F59591,0x251C81856D2DCAA6,0xBABB8FC0C2022B0E,0x9629DA9B1FDD104F,0x134DC343C0C172CC,0x31E4AB667C978D,0xCDD0627F77542445,0x4C3039374EBA2DAC,0x512FFC01A9C8EA0A,0x4BCF4E5B61D7FC8C,0xF422E394A08E306,0xD2096904B0E4AFBA,0x36A6C7458B1DE702,0x38431D78E42DD8,0xD9705134EE12E875,0x4A2583328958EBAF,0x37E9F0226681EBC5,0xE653BB0B73D72A41,0x88C08AA2A77B9151,0xD800E49EF49404C4,0xFBF4020EC7006544,0x207271466D7C01,0x793226F513CC8F89,0x717908768517C0B9,0x5B2C6F58E0CEABEA,0x1A96AE7E914B58C5,0x3DB1CB66AC4BF52F,0xD07E4C5B7642008C,0xBE37C997ADB03773,0x3B32B9C9C84D2C,0xD1F8FE9B96469B28,0x732244A8F4534A8A,0x54B695F0D9EF242A,0xA05B7BF80BC20600,0xA1C4B3B077297618,0x722E0C134262DCF,0x71B3A72562E04411,0x1A1838B64B6D73,0xF53EC0C44902EF4F,0xEC69310636B8D799,0xC51077CD30641863,0xC6DF965303A74061,0xDFDFE56B8A312042,0x9110CD86161C06B0,0xD86BBD74D7BD085D,0x128C25713EBDA0,0x5D8A816E9332DE46,0x841B22E3C361F680,0xF5F1FC850327C114,0x814621A70ABB31B9,0xCA8294B48F7DFB1D,0x66524D89B4D852B9,0xB44856848C2514A4,0x2FF150083D87B5,0xA027D6D3DD52EE,0x3B551767E6E9F855,0xE5BD3C6E507B3FC0,0xDCF10B7BDC5094B7,0x5F0FFEC99C3B5567,0x6D55714233D4A579,0xEFDA60E379E0902F,0xEA35ED8AE48CC,0xFCF20083F5F428C3,0xA18E4F5418871812,0xE0E12E7ED5D5BB15,0xE85ECF54CD9331B9,0xBE5A6D48AD9184F3,0xB17500795FAEBEDC,0xA6D7AB1EDEBC1102,0x1459EC2BA206CE,0xF8E657D366964B1F,0x6717796E9EF07530,0x3A987D9461789025,0x2EA9B32B2563AECE,0x1738E3C90DBA9979,0x75A87EC09F14C84D,0xAB3EE50F8D39CB4F,0x17F4E16E39008F,0xFD7EC18FF9EBA36,0x616A27E038D8FB90,0x6E2FDA0864B2243C,0x157775AA9D3F3795,0xD434F1D1EC79CEBC,0xBA260FE4D6D2B39D,0x67B56CD39B6667BC,0x403E625063D69A,0xE74E782E85619910,0xA4F3DDA6EC31614B,0x4640DD90CEFB4E4C,0xA5629B9EB7CB33E,0x75C0FEB5A26BAE5D,0x75A2C4E0EBFC56DC,0x3A1146FBE14A75CA,0x2935A215F02E94,0x6161BD6D58FA8A41,0x4BD7B66502AD339A,0x97420E426C2AEEE7,0x4D0F21C0031A6E19,0x5E2EFEF5FFA2F82A,0xF15DD0BE7700C710,0x431FB39A993631,0x39709174CC208E,0x37C870963A57592A,0xB97A63D837B120FC,0x2CC5D03CD7150CFE,0x1AE92E1B7EC38ED1,0xDF33E7F840FE027E,0xC981F4AF85F829C6,0xF70D0CF1324C125,0x27E9531837C565,0x1B28D7540D0063F4,0x2EF0EFBACFBD78A8,0xB51278963685430E,0xB27C53C9EF63870B,0x3FA3D43201DD78CF,0xD27E9183FFC1C3D5,0xD1C5E00C3C2F07B4,0x38FC5BD5E3F0E4,0x2BBC1EE7861B1BA,0x9E7F01F9E7A7F4E2,0xBEF8453AFBDC31B,0xC2D7B60633A68E89,0x3E6662E389A58119,0x1A7661A29355BD87,0xB098D47BBB3492A,0x11AFFB61E7CC79,0xFA47632FF3FFDD00,0x2C5768FDC2057976,0xB8C786C0AD1E3CB4,0x6F27B11E80996464,0x7102088D0E874D5F,0x408F198F1412565A,0xE2C194DA65214D49,0xFF2E04004EB88,0x31F80763739179F6,0x80F015D405ECA8D5,0x26D3957487EA4C4D,0x3665B9091C2012F2,0xC411ED9AF937E249,0x8F42738D55B0E367,0xED5AD578904E57C7,0xE8EB812E87D3F,0x7863D279557553C2,0xEC9DA5A7B7E6DB10,0xD5863A25F291AC5B,0x4C04AE294AFFC9ED,0xAE89E0FA7FC6008C,0x5C6C35A78BA1BF59,0x40B03AC3D7D9192D,0x86DC32ABCA521,0x67BEFF968A6C4A47,0x3B4B1B972659625B,0xC3A159D203871DF7,0x9B5559CBA524DEBF,0xD1631873642194A1,0x370571A4C72195A2,0x85698FBC875173B9,0xEEABDA62271BC,0x29F2B5867F163341,0x7FAF149A7966EA41,0x892FED12FBD6307C,0x1055DD04C0F48511,0x39CF6A95DA0386F8,0xCA7591715724CD99,0x276CD6FF3B8A9C8,0x3C26DEB60AE7B7,0xFE5FC0BC32FA417D,0x3008B080E6F67407,0xE39358F06A29789,0x706FF23B1EF87AF5,0x1E4A5156CA2447EC,0x505C3C220130E0F5,0xC81D5653592A0857,0x3B626CB362BC30,0x41F4D7F3ACADCF2A,0x3FDEAA0ADF3B08A6,0xE1FA47B04ABE4E54,0x96C7E0E6AA7F6E21,0x13545E7FCD1AA894,0x75FEC220E527FD80,0xD747E4E76099044C,0x2B8D407D2E00CE,0x67B4CB0515CC1E98,0x530BC0179C22C5B4,0xFC94E6DE8E8F5BF1,0xD96987A217EBA4D3,0x3AB06D004C618681,0xF1E623F198196D14,0xF202602964370BFE,0x21A5FCDCF059B7,0xBCC695F9B1F686E4,0x364A879AEA5E57F,0xA4A123BFA862A324,0xB370BC21C8A1833B,0x97F67C7FAC7AF2D1,0xB6043C639E016C25,0x11F2FDDAA8FD7B5A,0x3D77BDADBD8BF6,0x6A13BB52FC5B47FF,0x5A3DF2BA6D51D114,0x1213D8870CBD1089,0x4F67E858BA8DC36A,0x3E4671E45D144132,0xC3B670A7B74C7961,0xF2F07DC7D1F225AA,0xC5701BA8E8C08,0xFCED64CEAAEC8F6D,0x7F381DA5A1739CFB,0x4717C363A5F3408D,0x8737CE0E6AD47D00,0x2D44137468761A1A,0xDF266A51E00F34,0x7D723A4E56C370A8,0x2E407BEBC99010,0xA237832AA17E2DBF,0x1862F35E788F9CFF,0xACB00CF6BFBAE25,0xD1BC805DF8EADB42,0xBE49C1A194167048,0xC8DD38407AFF83D9,0x532F5645373CBE93,0x92BC914680E6A,0x221B6660A13F0562,0xD9F7036FFB22B1CD,0xFB588661ADCAE250,0x3049BFFBFD34B272,0xB5D9D5C749B6F1D0,0xEC94DAA08A72E751,0x1C9ED264F60E26FE,0xDEBF0A95C7627,0xB89B69B4FC1DD9C1,0x7574CB9EE7F1DDD0,0xCEF148AB7E5D1A2C,0xB6160DF3AB2199CE,0xF906FC8D9191B062,0x42A70202D9C4F11C,0xAB6B737646B81B0C,0x16A9E47367EBF3,0xF1904383B1B6A61D,0xE098A4D38DD6BD62,0xFC48C5B79888CCD2,0x9B74AE22BAE8F07B,0xE896C0ED7852D29E,0x2D6A521B5028E20,0x558F112681E4CD0F,0x2C4CD8959C15FF,0xC06A2109D61472CB,0x3A7015AD35F83019,0x255340A0CDB2FB44,0xA831C08E0CF7DA62,0x1B66134E15F1B90D,0xBE709E2EACE87D1,0x3B7DC2A569AC8F88,0xD927220E82124,0x2C1EB9CDC3ED9F3C,0x5A08C29223E08778,0x703170B21E2AD32E,0x666819690FE40964,0x13A6FC2F32A79A9D,0x279D745844E6B628,0xBAE53E336EEDB002,0x273C3CD5EA4337,0x9A5AD49EA46EF1FF,0xCA9FA1589747BB59,0x61D453DC06BB2BD0,0x5EF3B933952CE468,0xFED0DCA303728D58,0x119ECC73AE98BA3B,0x20FB8324B7295AEA,0x36CC94F1D75BB0,0xAB22E99C544A31D0,0xC634467E1A0E55EB,0xCEFDD2B68BFA5D6E,0x68F964097AE0B949,0x208469324ABD8EFB,0xC349AB4D92196013,0xEA84F6C0413EC323,0x3956112E51BC99,0x39AD582811CEAB58,0x47D38E4494C5E6E7,0x59ADBE2C291131,0x918DB334E80AA8DB,0xDAE0C771BF9E558D,0xC75BC23AEB988E55,0xDDAEE3154EFFBB97,0x3002EE9BDD4506,0x60138C0A91CCB6EA,0x8A74DF515057D18C,0xCA7AE11495CA2D9C,0x6CAABD2302823E81,0x5D64208207EE43EF,0xEF6319F421B6AAEE,0x67A3AACE9A0E926D,0x191C76D5EA93F9,0x7C2640D16FE44BA4,0xF3F23DF312602500,0x27CCAA0FEB9DEE5E,0x33970257EABE5368,0x630332BD7FE3C77,0x7D3880A4A89A6783,0x684292FDC64D786B,0x1D67E6AF18A442,0xD0792A1E38B69119,0x3F51362318D79635,0x41E961CB5D78A14C,0xA68A2D1C39AF1D8B,0x99E885C3B4B150D7,0xA6785BA6CC2644A9,0xD85176DD751AB73A,0xD19927B30A4FB,0xDEBE71151FE8045D,0xC1766F8AAF8C6912,0x6BFAFCE4F844FEE9,0x6E5AF272BDB266B4,0x30DE908A84353C02,0x2E6EF9ED49846671,0xADBB182DE3A0DDE,0xED6930CE8DDDC,0x765E102C079996D7,0xF7C98AD7F815DECA,0xC69EEC99AA2E0627,0xD15744171B14E96C,0xE9765AB258BF5EED,0x89E245AA9F0F302C,0xA593A154DDC7FAEC,0x5D16F71183B48,0xB12ABF29763C19F4,0xBB89A4FE29A0D21,0x1175D35F6C780BE,0xE052FE171F9B0AED,0x5E832A4C61A50EE4,0x65E18CDD31CEFBE0,0x1274A8C1BE6CE29E,0x6177324EFA752,0x49D16E9B03A9D126,0xA26C37857ABA3CAE,0x20C8BB07F2A5FBA3,0x250DC817F05725E8,0xF165F6846B28814A,0x383FE7399725CE9C,0xD7AD4CDA58DD1F0B,0x199DF4B74CD3D2,0x2ADA847D44870F6,0x3881F23C5D203363,0xBF23C93A3C946AC9,0xC53149CA9F9D662F,0xE1651F4E4F0A642E,0x39E9251D8F78C0BD,0xB25E538CFB711CF8,0x1CBE36087D21A4,0x3ED8D00ADA8E7A27,0xB8F366CE2F351F4B,0x1D30808900DD6437,0x7ADC32F20B6B8652,0xEA6FCA234F63877F,0xD040CE38C48254E,0x4DA3BACCAB834918,0x3907BADF34AF7,0xBC568C222C132001,0xAA12821499A2DF7B,0xFDDFE63056B658FE,0xD650BC83A4254A70,0x8B070C40DED7A32D,0x747BCBE6D56B1C97,0x779C49804FE651D5,0x338FE34E9EF191,0x56E2F7F09625A807,0x8EA912AA46B14B00,0xE3DFAA8AD80C0A1E,0x73732DB11359D630,0xA77DF9ED87E15489,0x6805F31B888D4496,0x7056C2C01F070C3C,0x1FC8EE42DBF51E,0xB898972EC700F163,0x1AE83530C6F4017B,0x5D49AB078B36952A,0xEC11035E638D3947,0x687511FA6B38E589,0x9CFD7CAE059F1032,0xE074843B93924BC5,0x2B534A1DAC4054,0xA97397D8BC6CD49B,0xF2BEEF956A61ABD6,0x6033393B374B8DE0,0x9C5C59FE6537F1F2,0xFEBDD0880A5EA3BC,0x9BC081908E84E127,0x7B228182C73B31CA,0x13145C1EE2E5E5,0xD7A0AF28E7CD3863,0x9C3DAF631B21698F,0xC08DB009C1CFACC8,0x5B836FEFB1D0F85A,0x7E078B0860B03324,0xFC1F821DE80BCE6F,0xE2B41BA465331D7A,0xDB8998D713870,0x4CC6C8531515E8F8,0xD7D269C90AB9FD9D,0xBA6BBDD74DE99578,0x4EC46C872C0BA0D2,0xEF771BF24EF81503,0x87EAC009E46BD5EC,0x380D3B3979107100,0x3CBA3EEE884D2D,0x22BA8ED232B92A0C,0x577D03D30707BD39,0x816FD57B3AF08A04,0xCC582BB3795DD45B,0x8768B52462113CD7,0xE40C3CADA3CE392F,0xB4E6989C0419875F,0x3C1342A3878DC6,0xA34B985B45C2428B,0x48C28BCCE4D5A26C,0xDFC8268951337C18,0x3BD2224DF0BCACFA,0x9A8BC53701A372BD,0xC411E8A067F974C5,0xFE1BB4144B79E9E3,0x30F783EE280758,0x1923B3840D3DA3C2,0xC6B681984D8E946B,0x64771BE195147AEA,0x4486BAFAE6D746EF,0x498B5ADC93274D99,0x2B47FA1D63D4E693,0x3926E0B5E4D45009,0x2304A14858BB82,0x28441C16E3614CA0,0x6C05CED309840657,0x2C72AFE274426FDE,0x38D87145E2506A7A,0x3B8EAE36C9AE5076,0x32693E7C060012BA,0xDA88ADFF1C0F57BE,0x142DAF20850D18,0xE33F81FC2AF866C3,0x50C2CFF348C3F6B9,0xC80C39FAC64D45BF,0xA5070E7E1790E335,0x38D41FE6AFE34BE4,0x8B701915312C81AF,0xFB1EB5A9FED43ACE,0x21C2F054741C1C,0xFEFBB89394F47AB,0x2C018FDDE12B67D4,0x7DB41995A8B974C1,0xDA772F95594C7350,0x3EE9B439C1CE349D,0x98628CC5EAD12DCF,0xB1EBB8914D9C818A,0x15F29E1C0616A0,0x5AAA57A833E1E328,0xD667259386DAF51A,0x1E530624CE0C1171,0xE41FCDAF4B979BB2,0x2F04DBFC0DF12CF9,0x5B808B34BFC2B8D5,0xBEB39E0AEAA45FC0,0x2B16ABFFD15857,0x5E1501FCDAE3C0E,0x945BA87AC6592C87,0x6095808675144A91,0xF78BCD780884A16E,0xE55EC1209D19D7A9,0x86A1403B8A6C2183,0xB520AEB24F544C5C,0x30002ED9AD11F1,0x503CCC9F2B073DCC,0x9BB7FD3DBECE2467,0xCC55D5E38AEFA9D,0x2E56FA18A2815065,0x252393668A1533E2,0xD009E74A5BAEBD77,0x64BC9A1963767A2F,0x21E0149C760D09,0xFDCC9A4A6F456377,0x6F288D6965975FC1,0x4F0B345EC4963DCB,0x17A30901B815AAE,0xFD685D1D6D5A1041,0x215EDD8A9A3AB496,0x534DE8FDB3FBC09E,0x31D26182AFD8D3,0x5DB22F4B32FA57BB,0xF7929055E786D42,0x5D9CC3DB93EB1FF3,0x861E3501C88DE75,0xAED6362DCBF8DAED,0xD06779E159D76F6C,0x9C431003C17B05DA,0xBF246D7BD6369,0x8722610DDA7D12ED,0x422F6ADB41C2C4A7,0x1E530C2DAF0FB7DD,0xA83773982601792F,0x1B4BD6E142B8895E,0x66824A24062D90DB,0xFBDAED787F15255C,0x38AB4714EB71F6,0x5A16FCD68211FA06,0xE90649F573F01E75,0x2AEE94AE5C0FCEFC,0x6F267F46C7B26AC3,0xD42ED2614F5D629E,0x1B08F62C11CA5D5C,0xB3F715AF201BAFCA,0x29E7ECA4AD9983,0xE89002F7938F1848,0x2B83BFFA1F13CC1,0x2FDC4BEF7616FC21,0xA8C69543B97EEFE8,0x873C160ED50C504A,0x1EEE5959CB02C891,0x31FB760630AD6B56,0x2317796E1C411E,0x9909766BE05DBA62,0x9129E3CCFB2A660F,0x516C85C6EEE9371D,0x22C8B3C546526FE9,0xA4A663341162022B,0x13C9B3D8CF7B9841,0xA0E8D326695B8D59,0x351C2BD9E1516,0x8EF89FF2B009672C,0x7B71BCF502DD5EA7,0x75A6A14D487CF86B,0x3DF76D8DC43B5DD5,0xB2120DE1D627DB5D,0xA9F7F8B7ACF66BAA,0xEF34BFBB6B45E930,0x1253417275D104,0x8ABFD12DE35B328C,0xFA877FAF8423608E,0xC6A21FF63B2E41A0,0xA4321082E0E0C1F5,0x90F3F6A6FB4DA7F0,0x823FDE6AE5B4B089,0xA4987291F8B5EF7B,0x27A47CDB7F4D35,0x897B1523692CED22,0xEB241575E872E8A1,0x5789B3680A31E88E,0x105294F962EE4002,0xA1F434290F3BCC82,0xF62CC2F405B1B09F,0x6939CED68349D43B,0x2CE3E410C10734,0x8CD3271A98612D13,0x7E51EBA3328CACB9,0xA7B693457A5ADFA6,0x4A2BCB6DB901DF13,0x6E52A32FFD1DBDB4,0x7254F168ED58E235,0x115FEA7591DB9D61,0xF925F9248C93E,0xE6711FA7AC3B1A34,0x6E01A0696252798C,0xEBB2B0DC1EE96F64,0xE6549CEFEC1A434,0x64AB83BA1C51CAF1,0x3AB472A0E56B7AAC,0x9B90CA4B2AAC242F,0x1615FF488B4909,0xBCB76100EC5A9484,0xB1E95EC56C212A9F,0xA38ADD99B48831D1,0x4AF1C5C3419C04A,0x356FF247BBD4015A,0xB4D63C1C9CB6784B,0x3357CCBBF9DA0549,0x3FC97F996859BE,0x82390E72A28575F4,0x252452AC59698A4F,0x7F8DA1D7A1A00F67,0xEA61C43632CA03BA,0x41A004FBDD6A0C6D,0x8C4A9B5B39C8BE7A,0x1E8533C51C31813F,0x1264E8B9F4857D,0x961FF67D593D15D4,0x8C80E6814791F955,0xF6ED42971DD7117E,0xB271F44A5CA4915C,0x76C348D36D2E250C,0x170CB0EF7FF06836,0x925DB2CBB01D89A2,0x2AA1B7632D2AA4,0xCD72C7EB3B903517,0x69799A6CF766BAF0,0xFA5FC0578ADEF41E,0x4AEA3F65A21A1C3D,0xA23B3A762AA7996F,0xCBF8BECE7C364484,0x1A743B8A0E94571B,0x2FCE5E249AC3ED,0x7E3CD5F2F891D38,0x864CCABFF3CB6330,0x630396646F371DE7,0x79C9013F41DA19CC,0xECD56F22E0520904,0x7125B41CE7927204,0x433A0C878F32D93E,0x5F964E5EB0052,0xA7AE7805B1E9AE00,0x49A5BE19E3041C27,0xF9BC405FE95B8F18,0x66909C7D7D1B5DB3,0x9AFE24926063987D,0x15C15AF51139C475,0x68425395417F9412,0xDD3752E9BD7C3,0x6072BC5210A10A11,0xFE51022DEB2EEC44,0x55B45662BB5C234E,0x8E3FAFE8C9ED923F,0x137B40D4E4D4E41C,0xF7CD7C2CDAD4EB95,0x8F1C94853C295FE1,0x1C7382D4FC134C,0x222A8B0539B19EBF,0xEE592608474967F2,0x8C40ECCA8360A0E0,0x80C931E6F8CA7EE9,0x98F0226B40B9AD0D,0x68FF4A489699528,0xC87BD8972D9DBCA5,0x3AB851CDB01ED8,0xB69523BE8A417461,0x237C16508970CB98,0x45B84F1E40D178F4,0xAD07C5F118146275,0xF8191F001320280C,0x40618EE9EE8BFEF5,0x9FEA96723938BEF1,0x381F6BD56ACE5C,0xD23FEBFE702144BB,0x5626D59AE3D109A4,0x40EDBAB6A8E372AA,0x3B097D0DDA9CC0E9,0x91D135DCBE5CB079,0xC747FFE70037877,0x84D50D187904EC6C,0x3062A5CDBEAC56,0x91FBC2813493AEC2,0xE63880093A0A9809,0x3920ED948E0FA3F9,0x8B275849F7C2FC98,0xDB73C8BF631B7463,0x567A03D936E95DA9,0x4ADB6F486C9269E5,0xF508EF1FA7447,0xCB2CCA792D0C0643,0xD9D831E1848C5AA4,0x7FACD6C7D8BD22E5,0x4C29709C661B4832,0x5A062444BE4D0973,0xA3B22A80A8741EF3,0x4CF4520812648B8A,0x579B5015187EE,0x243626AAF89C1E01,0x6C94F4A37BEC84E7,0x3429694B47A27B36,0x99FD9E21D798C62C,0x94C7A859F1A27933,0xFEAD208C4E12C7E6,0x9BDFC7FC6CB6E7F0,0x24232534F6BE7E,0x5B90E555D30F9D5E,0xB326A80EF97F6C6C,0x4B591808489CE650,0x4302218CD338223C,0x47DB8E950366ABBF,0x5F90385DFBA64457,0x3C95E425EF3655E1,0x3226006C11D276,0x8D08B52E48D6248B,0xEDAB5EE2E4D2B8CD,0xBAAA6E4FC1DB9B7F,0xC2078BFA41CD0494,0x35C93B20ED3EC8FD,0xE09498D02DE77E3F,0x51CF2D3D39A9CA31,0x32F38258CE3DCF,0x4659593505277744,0xC50B35BBBDA9F7B8,0xF93765424A1F8DD9,0x1BC06DE87B713FE8,0x12FAE20179A12D9C,0x74211188A685AF7F,0x973F645F23E0FB94,0x13CE96C45370DC,0x55EC239EF328833,0xBB7DE7345FB35F7,0x86A1ACB45ECE81F0,0x487D71ACE0C31164,0x2A1626E671013696,0xC792E95FC745B70F,0x81582B138D90F865,0x1544A5C5B8EF1A,0xF82C9FAC713B3CE,0xC0255349AB31019B,0x29F4347FD5754074,0x10CAF7EE2BA4BCBE,0xC8EA8D3276A2B316,0xC81E8DEF7BDA6407,0xFF1F0AEDA1A2F353,0x1538A8EDD3EC07,0x25C444A3E5A1D340,0x9C8C6B69093A6CE6,0xF5B614A7E4EE5903,0x8E5D8111F15F897C,0xA34F261E8B304083,0xC68F581EE22C9FB9,0xCD2CFDCA1C402A97,0xEFB8885AEF785,0x2D5DCE444BD2ED66,0xA198D1DC3CA95B46,0xA14AECC85508E25D,0x1C543F63664ECF3,0x2594ED12CFCFCBBB,0xF9B0E4C8C98826D2,0x30F88C027759712,0xD67C362A0087B,0x5398258722D2A292,0x6B8921DB72A767DA,0x778B5423A8F87355,0x6B5F7832798E2710,0x949FBB5B2EC6E8FA,0xC04791F5CF0E3D30,0xFEF5BC417C3FCDDD,0x19DAE6A44C8701,0xFD961802FE79DD83,0x495E1E02F5ED456C,0xD04517CE87DEE3A3,0xE8FCCF09175CA4E2,0x66F0D37B13B23FF2,0xA23E560E6A61E94D,0xBD889B9E76938B11,0x5EAF64F843E33,0x539370EE8C9CC0,0x4D0493269F0FFDCC,0x445A50A348FA9CA3,0xB9D2FC4119F2FCA5,0xE57867F36DA4EBA2,0x55DCE2FEB41A9B3F,0x123ABDF913228D6D,0x14637B8FC0C829,0x13F2275D2789F638,0x311F4266749430DD,0x4B242E2BE4D3D6C1,0x1CF16CFACB159FD5,0x108E50F5F07A56CF,0xE14DC90CE196AE8A,0xEB151ED604B1008A,0x13C361D8387D2C,0xA539B9B4A235DC7C,0x9B316C806582A315,0x46DE48EED00A0527,0xD0A51E243DC9187D,0x90F6D852DCB3FD97,0x1644F8F58470D830,0x895B8B2200048E3C,0x2A78432D2E00E0,0x72B63DE1B65452D6,0x293437F65E04A9D6,0x4B0FFBD88EA50C7C,0xE089B6D2234FBC3A,0xCA45B679BDE1E2B9,0x33EA173EA26815DD,0x526522F9460BE1C4,0x1DC404E12C37F7,0x9AF0FB6FF3484C16,0x8CD61EB4CBAEBB34,0xFE3241ED247C650C,0x62C454C0661636B4,0xF7CD01FAF6A4C295,0x5F02851136597280,0x6B665AB9186FC07F,0x1E076C6ABD9717,0x114B8CA614C60E9C,0x2833AA8A3D5440EF,0xFA375D300AB0BFE9,0x5C77DAD5560232DE,0xEADE366FF3135B1,0x64F00F12791FE10D,0x83EB421E9AF236B1,0x1D75239A4324AE,0xF177B1BF78E7BE71,0x7931F7EA26A7E103,0x563CB31A5067FF2A,0xA1565707721F70BF,0xD42AA79D42D15597,0xECF46B6CAA39B3ED,0xF69C61333DE61D3A,0xB3C19F92733C4,0x1172259B1B2337F1,0x4CC7C2BFE2E4D55B,0x3D6B5BAAFE564AE0,0xC7829BA0C68AD57,0xA8EAD78FD963304D,0xF54D85E36FDB22D6,0x59513C03AF5B99,0xE0CB333717D9A,0x2C03DE5ABDD43C95,0x2A7167ECD91A8A60,0x1F5FFF067FB06718,0xC98348B73B12A5AF,0xBE752AD8ABC98EBA,0x3C374918619F45ED,0x5BC2BBEEAF951D45,0x2C11FD85A1DDA1,0xD84C65C38A9E130E,0xD9479E89F0A2B1BD,0x85E6CE8924A97B82,0x269A8B4DF6BC28DB,0x11B22691CD45EA56,0xA93BF4A7D9D0812D,0xABC9F339CF6F4D5F,0x24DEC28A90144E,0x2D0DB175EB70583A,0xE4B1F390EB12A2A8,0x7E3C992D9C0996F8,0x4D905726A67AA7BC,0x775DB475F293D7F3,0xEC2623EF00899EB3,0x1744A31C6F35822B,0x253D37B49ECB94,0xF2BB9DA4D4E120B3,0x477F038809C55DA9,0x4BC5E1C21F11C1E3,0x203E34D42B61A982,0xC85F99FB40E03C25,0xA5191B5E75D9182D,0x21D83091013FDC11,0x29283B44E565C1,0x858D8E10A65170A,0x27B3093F90B84EA5,0xA8AACFA3B62318AB,0x3AB5471BD9C656AF,0xB43A1DC11AD6657E,0xE080B2418A87958C,0xFE2D2E62CCF4D376,0x2763E1502029C8,0x86E34146BDA23345,0x634A1060D4109398,0x81C500FB1AE6FC4C,0x3C6E005A89CBB0C5,0x4468D497B04C1A93,0x63AF7B01D585FEEE,0x3814980E6FCFB14D,0x3E2146E03FB622,0x4A05B99C482BCB26,0x2E9D0D1002E013EA,0x3AA8987C07A313CD,0x9694A28442A6F14F,0x652EB32D85C360F7,0xBE8465D93FE1E4D4,0x9DFF5DD9023B7AC9,0x2275D0DE47C70B,0x1DF8D1F97E875A52,0x71D2AEABA63108EC,0x5B16593126FD63B0,0x9BEB8BCC7F3D2758,0xAF3BF70F87FEAF0C,0xA9046A93B6E11330,0xA074CE2C99BAD72A,0x3BBFC2BC41C18D,0xD05D80F8914B846E,0x819C3499201CFC75,0x5E4468F01F0EA916,0xD59BE71157C3E0D0,0xA1B66BAD0E7AE65C,0x4BDA756F6B2A77E7,0x5189C52759F9C501,0x2A71F728DBFB67,0xE79331917DFF7877,0x7874B1826A677F35,0x507178606F6D3309,0xFE753C58007C447,0x57972DEDD52D58BE,0x92E2E96AD5C41178,0x3F3E0149CD4DAF4D,0x296E4C53950066,0xC6F67ECD825018B,0x69C7566CC045EFC8,0x9F9C9233344515E8,0xEF0E70AC0CDF746E,0xA33E9D4CED402A09,0xDB9C3682476BB5F2,0x55887AD2D5FEE54A,0x362DAAFAC26C81,0x3D278CDC3B147680,0x7432B11CDCFB4648,0x7F57F9485A673F3C,0x6A51F287F73D55C2,0x6CB236ADA7A19ACE,0x406D9C86C9180F0A,0xF577E09C565F30A1,0x2463074059EF5,0x80F49A1B96EA8D26,0xF04C15FEA892DB02,0x341A16CEC6872955,0x3B7352BA5F6D9E4,0xC23A50642525E81,0x93452ADA63C560DE,0x51F74DAC1DE8A06C,0x75B086F0FD7C1,0xCC03819A4828403E,0xCD138FCD98D8A467,0xD679D4B53ED19473,0x792F533DBE190782,0xB689EAAC608FD126,0xBC0A787C052DC9B2,0xB14D061E236D1641,0x308D70AA27D9CD,0x2CADC5225BD19AF0,0xEAC83BBC4F3CF7BB,0x78282BA70E66861A,0xE9A80DF4A25C0B84,0xD095FB77F59A8ACA,0xD2AC22799F01CFE,0x983C1FCB2BBBF6E4,0x1F31E02665C69E,0xFFF09A9139213B48,0xD36450093133005F,0xCC1EB7C40FF2D1CB,0x519459FA6CC22470,0x9191D9FBA1930CCB,0x6D35DC2EAB369D77,0xDF8C331B4AE754B9,0x701206233F9E7,0xCDA0516E7575B9A1,0xC6F198E898CFE53,0x1AC1B38E84E4E8D4,0x655B8BEABD824A5E,0xB75DEAFA98B18060,0x2F07FCF8773AFD4A,0x57518A72F2622365,0x34D5CDCC814829,0x73C1AC9E258A99B9,0xCFC59B6BDC99DD7C,0xC2595F8408470AAE,0x7681C8865BCCE405,0xB172442DA8DC449F,0x5C906886CB49B25A,0x9A1BC93F52CE499E,0xCDF961FCBF8BF,0x2FF20E2DBC1D35A0,0x21D0AEBC30676B30,0xBBD5C5E7D9FDC042,0xB1F64DF92EECDA9D,0x8B6B632C862BFE17,0x676AAAC88791831C,0x156F8B022B3471E3,0x1FFCEDA318E237,0x3FE83B9C4B054914,0x4F66DD6181B2ECE7,0xC7497F6812409D02,0x9DAE32BBCBB3361A,0x5C1F128E0D8C5BC1,0x1DE428E99BA64910,0xCE5DA9461ADAAE35,0x3913E63F032C34,0x563700EED870B410,0x4D4B20F7E4BD43B3,0x3F00BEDF21627F1,0x237A807CC554A1C9,0x4785A8677255FBD6,0xF354D109E113529,0x9D02E8E0D7C07D58,0x21EBE6547678D0,0x53DB9BA3478787E1,0xFE43E7927A59E5E6,0x8CAFA3F3A4439FBD,0xD967C0CF02642422,0x44868E662E1290F2,0x1D12AB6E930FFEA2,0x713AC301C5814B1C,0x16518793287654,0x3DE8F28596CD66E6,0xABD566CDF2D04B93,0x6506329DD925FA9E,0x86DC82F0B5BA113D,0x26E60C26E0AED1DE,0xDDDAE800D52860A0,0x125BC270626E5951,0x1DF12939B0774E,0xC563465EB596441F,0xF82C120AD0DA820,0xBFC30E9889EC8FD6,0xEB59751EBE08E74C,0xEF68FE86BD57760B,0x5C1FFE4DC244FDBE,0xF1CCDF7DCDEE2157,0x1FF22F601EFEE6,0x8025D27C9D509D9C,0x31C76825B675BA94,0x2D803122E32477E8,0xAB3B1EB113A414E5,0x4D0B93B13C3C93C4,0x3B42F7A00F4B6B55,0xD02553DBC3E989EF,0x17EE4680516CEE,0x53709AC92FFA7CF2,0xE01114E598EB047F,0x61A31E128ACDBDD3,0x2123A5F884916DA8,0x1FFEC9D4221C9760,0x34F3FF7BE3FAC900,0xEF53A8C318D871A4,0x1188B6409F6F14,0x126304AFA76C0450,0xFD6D53C2407E28BD,0xF5DE0F0E87536785,0xC47BF3B99C5EB943,0xB0A237DC4DC9FF80,0x70342B7D31BDF9D8,0xF96FC2C3883D2D2D,0x39F767994822F3,0x86B8F19B4EFAFD2A,0x53BDE5FB4A60ED22,0x233813C4160E605B,0xAD60CF6DCB87E67F,0xA6A2063AD6E59B,0x4690625B2A930FC7,0xB5120E25EE29F6E3,0x2C595DDF2B98DD,0xE8B75231070DAFE3,0xB9495BC6564EBF1C,0x13B6FD3DF3EF64CC,0x1765B37170569C56,0x9F4FA46F52F85174,0xAD8FFB186B368C43,0x3494302879F3A54F,0x17BC003224D6EC,0xCB1BC4421304F6E7,0x9FE3130AEFD6914,0x8825B97E8DCB69F7,0xA791CAE50BA06F6E,0xEF3167BF96F0D11C,0x9D8B9DB7CA066BA0,0x1A9BF85A92D8FEE5,0x26F069514A3BD3,0x6DDE5EEFCFFCB095,0xEC1968D08E75BDE1,0xE8F9D2CB94F37050,0x2A85EF3DCF1E3102,0x81DC7C2E87A87581,0x63C7B0EC29EFB598,0xE9E70E6EA118ADF7,0x62CA6645B8619,0x9FCA177DC74E90BD,0x4ED567E4C3A61823,0x7479CAF4E675ABCF,0x102C8279E3DFCC4C,0xD015E0433B9ED9C7,0x3A293861E167FB66,0x9BB3B83D19082339,0x254C7EE33A12E,0x6352F80540337E04,0xAAA371AB13EB5355,0xC10E606D7167E896,0xC7BD1863D7DE3948,0x3F1465B55B4C1FC4,0xB696863B1A5F445E,0xE500DB9D98A2D08E,0x36363BFDF68DAD,0x24F4E84BF807EA3E,0x5CEECB247473D814,0x4AC9DAC98EA5819C,0x6F4571437E553E08,0x1C55209A4A51A5A1,0xA44F1F7C7A2A748,0x7C3BE0DDECEBBC3B,0x429DA4034901D,0x118418B54B44DD92,0x92F26F2DB46E79A2,0x659429A357FCE653,0x1E728806CB4B430E,0xAA120B6514A19F66,0x78862ED3D08C8088,0x928354554B4332A6,0xC17812DC3B39C,0xC7ABD3504CF70551,0xF723DBB5E9FD2CBC,0x61FC7C98830D4526,0x68ABC414D24B592E,0xC0D4C5B932D3AEDC,0xA652A63F1D716711,0xE778E3C6D23773DB,0x2D4C46EB7A705E,0x97E1963BD362D684,0xD59EAA70A45E52C1,0x93A630DD8A392F6A,0x8A28CB323A841823,0xF610FDB012E7C2F8,0x772F35444C07BF6C,0xCF007B36760BE73A,0x382E29ECCDC68,0xA1698C15990625F1,0x174624A2025BE99C,0x6D12498ED55E304C,0x28E47DACE082EFE1,0x4A565411136595A9,0xB78476A7948135CB,0x2DEBA6D3851C4728,0x3A03D31EF6428C,0xC4974BF78CC846AD,0x7DD59BA4DA44099B,0x609AFEBF6FAE11BF,0xE0EC69083E6C3CC0,0xC64580F1B6E7240E,0xE43AC890675CD11B,0x24C44E0E2BBCF51A,0x2F078F4B1261F8,0xC17244B87721ADC4,0x375817DD7F08FA21,0x6A248086BA7A5064,0x24BEB7AA05BD62E0,0xB7274F065C165B34,0xE975D3D7ECEBFFED,0x20B49977A90705CE,0x3BE683FFB72DE,0x4B1AFFCBFEA2014E,0xEAB103DB3D958F0,0xF81B76EBDCDC618,0xD3670E9ED45E8E20,0x18A738278D30C9,0xC45CF28735A3BC1A,0xCA2F7CD3094583B3,0x146419D1EA47CC,0x97F88DB389E6175E,0xED85D197070C8E29,0x60CC37F5D8106501,0x72208CECECA82962,0x43C69A28865703B0,0xF6AF078DA59D2EA0,0x4C03BBABD6DA6098,0x2B683EB80D9E4A,0x3135266DA0F7FF12,0xD5E77E2BC4B35992,0x92EE6CF020C5970C,0xA35DB4AEE65298D0,0x39C25AEAD4C9B6E2,0xAA98BCD99558CB55,0x175BEAA42FE925F8,0x16B7C4FE35A5D0,0x7C5F3A711170EBAF,0xB23A8A6C5425E460,0xF1F08AA96EA85174,0x747F127C99079E15,0x7A43831CC825331C,0xAD1EA45F2D723F38,0xA5BA8E5867247AB,0x173E0F3B84123F,0xAB2B17152F4D792A,0x7249F1BFD79F5AD7,0x732B1BC03EADC5DD,0xC1EECE8103C04C31,0x443A435D841F7FD2,0x20C400830903BA82,0xB5D5EAF219E9F286,0x355215818D8255,0x8938A081E57CD990,0x9FA5B30274E710A2,0x7115C13AF41AAA40,0xD77E3BE0775EC1A0,0x80F63648C15ECD34,0x1C99C65BC4FA2165,0xD82E231E2E7000EC,0x305A9A7A29BB6,0xF38AFE46E30E2CB3,0xCD0C631CBB3F5EC,0x3D988AB9820EEE1B,0xC8D01F6D54C02778,0xBF9A732139C18B4D,0xCBBBCE812E307A56,0xCEF71E2CC77C25B0,0x22E06D6A6D31D2,0xFD6D488AC04DC1DF,0x5A50C8F00B86D0A,0xFDC26F8CE3D8C66C,0xD65FAAD69A4A3815,0xFA9C5519EB4538FB,0xC15091045C859F3B,0xC928280135FD4F,0x3F468173725306,0xC26E87A84A3C9B15,0xFECB8F7783C3EB0A,0x143E2D07F1E5859F,0x950B92BEB7E3AE9,0x2E3ACB74A3BA964D,0xF2EDFC5E9D79877B,0xB312D61CE731BD9B,0x2F1CC9765EF15E,0xD01AA314E5B2E37,0xA5EEE909DDD404C8,0xD97E71E9742A866F,0x252104412287C4FE,0x4982767F66F3EF55,0xB87AAAB0390712ED,0xE27C53746E3F6D87,0x19232B4509B448,0xBB9FC04D0874288,0xB044D2DC35F3EA86,0xD4777FC0D9901F7D,0xEF5F597A8F09607B,0xF9E1BBB82F964367,0x3C19A18B2F971056,0xA4E63D7F8C97A091,0x5662E3CB733B6,0x9AE7DA64C6BEA3AB,0x72615FC7E2C79D2C,0x578D29E11A183804,0x2CA0BD6C27E87AD6,0xFB53007075DB3190,0xBFF29B99A311E998,0x4F587B5DDDBEB84E,0x3CF53BDD8B6240,0x9076A72EC77EDC46,0xAD8E5479682BA317,0x3BEDDFD8CE652AAE,0x7408422463B20793,0x36993F55F11C56BE,0x637FD7A97F77CC6B,0x8FEAC584E97E3D26,0xBE2E1A9EED8E4,0xDCFDF21DDD767B1E,0x1879EC359A12276D,0xD007F14C3FAA2759,0xE69C605DE1F490F,0xF0A02281BED8892,0xC2CC4DC1250370D8,0x9B1F32AFA9C3A0BD,0x21E706A663CF0D,0xEACF0D82872A5DCB,0xB6AA83C741B66511,0x6D8D1500EE175A42,0xA6F3F2BBBCFA9B01,0x83CD40B676DE4DC6,0x827361F98AACADCA,0x3328689B9428E08E,0xCCAAF78B92896,0x363AAFF3DE040D04,0x7F1CF5EF79F3A127,0x63A4D3A52FE44404,0xAA94D4D5C4624919,0x6FFD33949358B6FF,0xA4556F807B811AFF,0xCD6E245DE39E127B,0x27871B75AEC1B8,0xD839E9F138427C98,0x837C96DD0AB53205,0x14D6527F05CE11F6,0xC440F6F1D3DD4965,0xFDAAD6DE8F147C84,0x44E04D1CFAC6530D,0x61ADA64A0FCE1D5C,0x175A7DB4DF11DF,0x947E7675031A2D71,0x364511B4DB60B56A,0x523DA9B82A1AA821,0x8507D50FCCD8A640,0x51BE6F2619689293,0x425B5B2170E9DE8,0xB56A2E60A437B94C,0x124794716A699A,0x924F286C4D462C6C,0xFF0BE6530C14A273,0x23701AE090A86128,0xE4AA2058A52B2783,0x6D168CEB6578D29,0x8A598AE17589E71F,0x856872F04A26DC17,0x2831FED356F1D0,0xBBE40B6B89CF077C,0xF2032397FD4A9939,0x79C1BD2A3FE6007F,0xA9308109F50041AA,0x41C29FE3D7A10F3E,0xE127E0F5F07D86AF,0x7999F3C7B732738D,0x24359FD46A466D,0xE497CFAADFFD4BB0,0x14AB8220148FE51F,0xB6CE762B7AC9449F,0xA7BD2F4F631FE4A3,0x7873E778205EFEC3,0x5E5BD8F8FC189696,0x844D5367C32EE044,0x13E5036E1A449C,0x670A14F0A49401A9,0xEA754C09DA3F818C,0x815F1ED34CE42B4,0xE6E702289C964455,0x8B7F8A872A1D72DF,0x38556656BFD4E9E9,0x54B67896F2E33BD6,0xD6F3623D8F91D,0x40186E68A8A5F1C4,0xA4A077FF00024C5,0x9E7609F17086DADF,0x81F239E200215A4A,0xF17A2B88D8FD430B,0xE48E7732CEDE70BE,0x39C70547DD9FAFA9,0x1ECB672280417C,0xC6C3E4F67EB5D470,0x54D61C43F1CD31FA,0x2ED71F8760AB804F,0x50BDE567B0522800,0x71479DD6DBB01ABC,0xB02F66B0B440D13,0x5A85F7381F54DBBB,0x2CD79BD1189F94,0x51BB9FB0233C098F,0x3D00939CE5F56059,0xEE2E6730A015CE62,0x46819370F18BA142,0xAE061D33F96EE037,0x7915074D689F805D,0x4FCC0DDE3C1DA57,0x18C1E24E1CDFED,0xFF4759292147A2C0,0x829A83FF62EA1DA1,0xB0F8467FCCDF7B96,0x70454C34EB6C56BB,0x7796AB2D9ACACACB,0xA85EEA63C0AFD946,0x6CD99915339C3B80,0x308871580A59E6,0x252544E708D3DB7B,0x72A8620B1CD559BC,0x7BE1837F96FE3327,0xCDE02382433D8FC2,0xC0F4A40BF15A661C,0xA6F6801F6EE62577,0x599E16ED32CA4D6B,0x3B1684A711F6EA,0x15FC4544BF44BC34,0xB7B8BED8DB084F1C,0x221B9D61FD83CE8F,0xC1AB34D6F5AFBFBC,0x2C4221D7B6AB9D56,0x6C6A47C8081F5E7C,0xA1244FDD34BD98A9,0x46446B644DA83,0xF754162F69A26997,0x41E00E1B8758D40E,0xF52EF55C8B1A71E6,0x4D78D673FB6BBC5,0x911094E7E7FB3C4A,0x74846C7C55FB434B,0x6BF9015AF9BAA22A,0x39D43598766519,0x56790EA8FBC9E319,0xAB6B7F2D20C24422,0xD91950B82CDA7B97,0x7D2FB84480640E3B,0x697A5267EB277B32,0x987E091BC44383D6,0xC3AC195FA84016AA,0xFD75F88C4FDF2,0x9046125CB0785B6E,0x37431D5C2C03C8E6,0xF8F9E9D0D7F2EA1C,0xCB4F1448610E12A4,0x23E5CC3760D873A,0xBA2F8FC1A344A2AC,0xB33237DE1C4E9535,0x2F1DB3B4301D41,0xEB5CCADC08E3576C,0x341247230A924B0A,0xA2C04E8E093224FB,0xA5F19D5125B710DF,0xBC059F669289A521,0x51A3C3F419B05E78,0x616B9D47ABC444CD,0x2342C8DD6F437A,0x2B9563FE2FD82CFE,0xADA178C66457C91A,0xEE6207D5CC2ED2E6,0x5F26294727EAEE26,0x98C84FC9A91EECDA,0xBD7EBA5732DF2136,0x3B1169D2B079E7B4,0x3E191904496BE8,0x9417D4782789B280,0x5DBA4048536F6B4B,0x9D55603AF99C1BEA,0x2CABAAFE6DF1E2DB,0x4B2122865ABAD27D,0xBEAE4F9A7610E18C,0xE5261C28304366B6,0x3D32B4A9369C12,0x98EA0C918F797C2D,0x537C6B5749C48983,0xD80D1644C246313A,0xE83211467783F70B,0xC54A4354A8EB79E0,0x845F65CDD5D725F5,0x1710A6ABCF950BAF,0x1BF27857532FC5,0xB0E046229CB7CCA7,0xA2DECCC536A1B490,0x2BD4FE7866BF418F,0xF90CB501A8FEFDF,0xD816D1B36EEFEF3D,0x26195B52E080970E,0x52B93B478D1C16E4,0x28A53A89AFD30,0x991B26DE98730391,0x92310C8BC15ED8C,0x121D56DB603A7A94,0x5FEC77E8F032C5D2,0x88835848742CFD73,0x6B802E8277FA1862,0x1F7CF3F0459CAB31,0xEDA6A6D820450,0x1F71ED3CC5C54A9B,0xED6E06928C28ABEC,0x3AB5DDC42EA5D5D6,0xEE6E77D98BB7F54B,0x379E09C9C405A654,0x524F328FB43C4452,0xED20A008D857206D,0x511D8B90A1DC,0x9D8601768E8F3E0F,0x4FCD7A75A407E95F,0x52B643F0C5EF208B,0x6220AAAFBE014879,0x53BC3F8481A58BC6,0xB466C150C0B5020D,0x1C33D027858D2729,0x35EFE65EB53180,0x871529A6A0590BA3,0x19F3D2A7D4F7ED54,0x47191CBA1D6FC93,0xA442F02EC5FA4168,0x23A6DCDCF05BF40E,0xC574A6D5CAC812E9,0x346F08A451233F75,0x31680AAF007B52,0x61398EEC8B79512,0x79F36B72F480F4AF,0x5D219AA93FD72E9F,0x80B13EC16974331C,0x4CDDB17C35314CE,0x231CB4F0A47B85C7,0xC39BF747B93B9E70,0x14CCCBFF62EE49,0xB1AB58E60386BEF,0xE8923377C8B3D58F,0x4C37DB11F1294FB6,0xBAE717AE5FE4D940,0xAEA8EBE1EB24DAB,0xCD68687B74959ED3,0x4358AD00A8B0C57C,0x2B4697EDEE1D1,0xE41D6EFBCD13D110,0x30AC9BD630FC538C,0xE08EDDE1AC923568,0x1B960D670EDAB653,0x7F346C77250281AC,0x5D7E3BA1B4819172,0x353C8C625BAB9D3D,0x20C62C4F938C30,0x8A45578730142561,0x70A92EE95E500BB0,0xA5C4C83E11069012,0x2284E570A0F69FBD,0x65A01F772FFF5523,0x7E04CBF404003F0F,0x37D8FD811D41B8E1,0xABA22B835401,0x4394F33208A4C3C4,0x4C35F7CDEBB19C69,0xDB570A67FF8DBCA2,0xF29D42285625FF06,0xDFAE2D2218BEB7B4,0xD922C2BF87FC97CF,0xA19B3E35C20F0B2,0x195569B3ABB4B,0x4B8031EF2007DA2C,0xF6D11B603390D98F,0x94293181D2B7FACE,0xDEF819783CDE38DA,0x61194FF897AE3FF5,0x934EDC2E6B2765D3,0xC8B5A51927FDE9BB,0x287FCBF4A0C6E4,0x7C7C8CCCB4100263,0xF34626AC5E7B3A89,0x3D589CD71B4921DD,0xC265F3934C5C14CB,0x4C6503ADAE26E261,0x64022DA619F5CEB3,0x6A06077E61C73870,0x21FBBEDC9F0A59,0xB2AFB4DF50FC9B85,0x18180CCAEE47CD,0x99B629402A8E434C,0x1D64845D1C262455,0x1D8FE81DC023588,0x5F0A09AFB869ED74,0x6AE88F827037DE57,0x3F1C48EFAEC928,0xF5D7BBE9DEA0233B,0x58B580A7609B7C6C,0x2F40FFEF75464E17,0x2F027F9002343971,0xD579BAC098B9CFF1,0x63B15A583F2627B8,0x8D8C5F46B871DD4A,0xD03055CC3F7AB,0xE55E88F3F92A5F8A,0x3AC1B9019A514E1B,0x1BBBBAB2B5636DE0,0x8D2990503CAD9822,0x698E08332B6A3EBE,0xE8E160EE1332116A,0x9B97A68440B3A00,0x2D7731AC8A4722,0x75196D0845AD49B,0x6D1AEC4F09847585,0x32FA138C2DED9116,0xDB11DD5447F748AF,0xA4F782D48BEA80E1,0x9CAAA9B06E9C5573,0xD3167163E69A3001,0x3317CC4A15C2E6,0xE79B238B8EC6C5DE,0x1F4F539AC9BBB748,0x4FBA74F878591073,0x6902079313672828,0x448FC602184EDB5C,0x3FBF15FA9C5A40A2,0x1A232141B828A7BF,0x277A714C0675AB,0x93C2CD76671A3A10,0x4D27BEA10C003D9,0x36D462950211E3FF,0x5F35CAC178F8D59C,0xBCB9782F4DB456E,0xCC2D547FF44629F3,0x4826D87ACCECC1BF,0x19F8389513B38B,0x1D2BF23BB5DC9D12,0x93BA7CDE922408FA,0x94DD1FF41CEFB9C2,0x2598E90C0085B33A,0xE2A9ED2DAC515507,0x7DE96254F717001D,0x2574E5DE488D06BE,0xDDCE589D8CA10,0xA89BD801BF3D9A29,0xB1A1B267C29DB7,0x471413C0FF5F04A5,0x1BB53004EA5A2C3B,0x16C153789D3DADED,0xD30E483B4A08EC98,0x2AE4133791B59E8F,0x3DB66FB1060B21,0x765C0E22232E1116,0x507917FEB820C00C,0x81A6B8F9960D9F9C,0xFDDF00F3133C78C7,0x3B380CA25367C43F,0xDE82CB189222C054,0x975E65744A1031AF,0xB45D3B31F4EDC,0x3B54047F95277C1,0xE395D8E3357270CA,0xFC86E6921015D704,0x2742F8D513787918,0xABD45EB5FA92AA2C,0x8054CBD619C3FC2D,0x8501406B06F6326E,0x1D6DCFF4394EA2,0x41E259BB6804CD9C,0xDBD0682B663801,0x90CCBC730AD17480,0xBA807F05F4AD0655,0x7833BD5B58D202FF,0xD8AC42F72F273899,0xB66A2C4648778370,0x9BAA722657C96,0xBDBA1FB679F66B99,0xFB44299711FE2FCB,0x4BD18B449CF453D9,0x7A2C1332204F9B1B,0x2BF0E87E657C5A7A,0x8B25B706E2430FE6,0xA9E4446368AAB211,0x911FEAA4154B4,0xF44BD8CFC16E6A35,0xC52BB03BB23ECAEF,0x67B480B35B226130,0xA76C64125DDC224E,0xF2B249D72A31C4D,0x409D6EC8E0ACB68E,0xEEDDCA946BF5A3D1,0x2C2717AF8B7D2A,0xBFB43A3639C7DAE,0xB20F0677BF5DCA99,0xE57734C203A0D761,0x8FA5C864C22EBF12,0x39E4C9A32FCE2D68,0x378DE0CAB5FED447,0x961970A44CA9263E,0x2D98009F106C5F,0x9A7BACFD613CF30,0xC8972C3BF1F8D61F,0x4062DC5CD7112469,0x7504D36D896AF7F3,0x36C1C8FAFA2CA03E,0xE35AF82049FDE2D2,0x9B2412A5993B03B1,0x6F79892BB7E6F,0x20F82B52AEDF4742,0x4BA8E5110DB6BCF7,0x533F8D0341BAA89E,0x5A721822708981C0,0xE563A76FDFAEB500,0x18678F804ECA6F54,0x5038A0C2CBF61756,0x14458F6FD9AD00,0x7BACA36E63796A75,0x36A0382568505058,0x422DFD8273541724,0xAF7D95064A3A472B,0x1594CB7DCC2E29A9,0xDD799FEAF7A0BE5B,0x8F8EE10622FA464A,0x2F88924044856F,0x2C80C895413203AF,0xC3C579C5A6FB4195,0x17FF4BF123550447,0x606735277CBEEBBB,0x39DA5AA949EA3ADB,0x5EDF04925591E46F,0x4C9EF0E6C0085078,0x11D3B55152E098,0x938BA2EC10A3A893,0x12C44A892A959B0A,0xE8CF659AD3BA284F,0x78810A4F87F927CE,0x196D4D6E429A125B,0x8D5E7F5D15CE4A52,0x7D567CF8D56A768B,0x2018EB1E91D20E,0x769200E2580E7F13,0xBFF180959D3B9120,0xBE4079980D9F4971,0x434CFD56AC7AB9FC,0xCE84B36E232E445A,0xA0E81E42C784313E,0x9E4935EE8A5091C9,0x335CA945E6D978,0x203AA0187556EFC,0x5BD6BB67DC8ABC05,0x3E0ACE3A7A2DB312,0x9F95454A530B8801,0xDA7D68151313990E,0x27B34CB5D7DE573E,0x601D9A92FE8FEC74,0x2A5E1F30417C5F,0x114842FDDE3C2140,0xFC23D82BF6767CD8,0xEFD569A83D16D928,0x5074528A35BFC700,0x53C3CE2252C6DDFE,0xEAC8B5A117A62C21,0xA2C172D976607F4D,0xC8C5F38F32A73,0xF97A478960669CAB,0x68202BD5E5A0A7C7,0xCF12F7A33739404D,0xCC896DDEFFE05714,0x44BFF1D14297A14,0x399CE742BC029222,0x95C59B2F7E34D118,0xF91AA0966B3E,0x2586B04A768B00A1,0x328FDDA7B55CD5A8,0xF875B9D20D54E398,0xABC6F0B176A68A6E,0xB9B68491FEC1407,0x6D4377DF45FF1325,0xCB416928ACC75711,0x31B962527698C5,0xAD31C5409FC4D25E,0x4E1021FFF6C21B6,0x98B23FFE7C83387F,0xCF2952AA18923217,0x73E82CB3B80F37C9,0x46AFE3ED3F3238CE,0xC8D57ED1A356E73D,0x3469BA13223147,0xE8733649893008A2,0x811B183FFF7DAF7,0xCD177FAA378871EE,0x1CC3A2274630D8C2,0x5EA33C7573473AA0,0xBDFF34F2A9DA8E8D,0x5A00245617078EDA,0xCB28CA2C3DD25,0xDD85C4BC213DF01E,0x55740169B82FE0F9,0xABAAABD1D7FA3552,0x517915C9AA24EA76,0x66D86C1D23524649,0xFF44D293479D190E,0x1DF2981BD5365DDD,0xC26921DE5C4FD,0x27A6A086082DF293,0xB2182687A45D58C1,0x16D0B815954AE983,0x553D5C152411B868,0xE1A61B8530D059CC,0xF7A17D4C13316C69,0x96B0000292B25863,0x28F5FC024EEAC,0xC2C7EC092DB5CA65,0x1B57E52742A5699A,0xDC5F9B878010CF88,0x326A0C9320E3CF4C,0x48E3E2B9E6E4F6AE,0x77A1F866EE083E5,0xA652370A695C55E8,0x23293AB5596114,0x995FB7920A55F8A5,0xD7FE8BAAD52C6B22,0x7E22B9BCB6F4EAD,0xAB3D4C68E2C9546A,0xE0A5B8EBFC5A1C3E,0x278664117342C691,0x195552DCCD3A2ADA,0x2FA74AEEE0949B,0xD2AFC5C49B312C69,0xADB3560CCB8CD09,0xA6C7EDB88E5C81B3,0xAB4E1899A40DF0F8,0x18433E52A66BF492,0x65D4933E5102BED,0xFC79F30A37C45692,0x104DADA6023E15,0xFB985778E9283D29,0x3C777A049BCA2C64,0x787EA71D0BCFDDA,0x7668D347B5514A02,0xCFCF5D92B64B9150,0x9DAA8302DAF00F12,0x968279EA1D24D1F6,0x8AE5950373E5D,0x1D2D98B055DE2C4C,0x4C4F953800074EED,0xFDB33BE51166FA18,0xF32989CE66EAC536,0x62A998676B801D6E,0x14C59040F0FF87F5,0x2ED1F2937973CB7F,0x3686EC507B9C34,0x46D0DEB3A746BED6,0x6143801F4D983E,0xA032126EA20EC1F2,0x766ACB08FC394B51,0xB783639E2AC6D1E7,0xF58653FCC0C1B928,0x5EE556C6319C6B83,0x29AB2409BA7948,0x5C12A311976BC451,0xD512FEB81FEBCE8,0xDF77A9AC2200CD17,0x8A399298F812F42D,0x8081D71DD772A32C,0x76EBE8385B832893,0x3A1D37D0BA46AD49,0x15B283BCFF9DE4,0x6BD6A0344AB8D748,0xC76CBE0B602D5BF4,0xFF16F9A51398A200,0xFA7525EF8BED14BD,0xDF92DC3BE0AB4B69,0xF87EBAC76D14DA1D,0xA91CAE165C5916DE,0x32E7E4615DB03E,0xE3E77604C9146F6D,0x92048E3DD1FE8F1B,0xC2EB38A7D8A1F38F,0x865338A0AA3C9ADE,0xEFD7F7CEE57793C3,0xCD863BCAED1F889B,0x382E45B960F1E4DC,0x57CA765C14A75,0x731A220D7015822A,0x2E8D0BA49D12942F,0x64C0FB3628284FB3,0x4920027E14B3FA8C,0x39643B9E6EACB9C1,0x2C5C405CBC760B82,0xB86FDBE4E30A36C7,0x3A15CB553C57CF,0x8129198ABFF8C37A,0xCFA8BD3D7EBD2592,0x69A42A97243248D5,0x8572DCC676548799,0x83212FEA3349019,0x33711223A2E3521B,0xCA77D662D49DABE9,0x356FCB8D4EB0,0x86AB77D36E426F43,0xB53BED17E59AD506,0xF18C810B9E3FB29,0x689BB0EFCFBD6B6C,0xEB1BEA5ECF04D7B9,0xF3B33781AD2A8DBD,0xCAB5E38A1A0C6889,0x267A39A462F56E,0x5AAAC859F705C697,0x863660B2810182D7,0xC655623852C94712,0xF978775CC0A1717D,0xCF53E6A26E367845,0xEA7B2249636DC688,0x74DB5AB65A6820A3,0xEE8517D43E3F1,0xE39DF59384355060,0x516940D460796783,0x3DA2DF556EAB6713,0x6DA532636F36EC8D,0x37D2A3A00575FB33,0x8B3EB34A51751957,0xD5CB888E67B56415,0x3EF3A5D5685ADB,0xA17578638CFFD0D1,0xA3B0BDC8768E65F8,0x4288DE862551D04C,0xEC76C26704EE50C7,0x5A76F62CAAC60104,0xB95612DE84A4DD66,0x97C862EBBEFFD4D8,0xB0ACFFB37DF04,0x7E39AB67B320E53D,0x629D3191BCC2C6AA,0x9932A53835261415,0xF1F00D5CAB1D11CC,0x52EC6261015A450A,0xD8E9A89A0E8D0F84,0x8C179DCF7097DA9D,0x74A99EBA5289A,0x9FB70BFFF8ED4750,0x43DC2DBC1E2CDCAD,0xC528DCD386F11BD6,0xF6053B2FAEF26DEF,0x28866B39342DD6DA,0x9F223AB0B3A27EF7,0x26E6B28B82AA0440,0x2D09C6D52D2CB1,0xF9EB06E44A1E29AC,0xE1691B4608AAA772,0x7030DE32136C0614,0x94DA83A2C91D5A04,0x19A75F7129D9916A,0x8305B60A92A34FA5,0xA2CB03CDDC9DB8C0,0xE838171D4FBED,0x6890D12827C8EB11,0xDD89A5610FB90ECD,0x8B6A16DC98D99AAE,0x66791EFD66844A80,0x9F2EEB349D45AF8A,0xEA81A200F8F704D2,0xCCA9620AD65E1A95,0x2887B68ED25AA7,0x41E51983E3122B75,0x8C6CB7CAFBB98293,0xBF5EF9A2DA443061,0xE52AF6445B198B76,0x42160262F219F795,0xAD0384A76F0D9FCA,0xE052D9FDA4222A34,0x2843295CC41E7B,0xF62F64A930032897,0x839A9C1A4DB06A85,0x11E6BAFB8A6AA2DA,0x717836740A65003A,0x62ADDA57023A2B37,0x3A99D5AF87241008,0x6AE04E66329C6340,0x26F65F86F85929,0x4FF684D87D61551F,0xAA3A64AB2946BC0C,0xEAE69C27C99CABC4,0x485E2465ED9B5C3,0x815BB02E3507F306,0x54B1DDEFC3D5965D,0x3F1C9AE256BE9B9E,0x679B6D4EF442,0xC58E4CFC6AB0D46A,0x71B09318A5BC908F,0x32B7FA25E5989E7D,0x8E12D13B2C45E33D,0xDB5B7D57E126C92F,0x78BFE5DF6D9BA983,0x61AF5BAFD42C2C2F,0x42111394C935B,0xC04B7F221BE5284E,0xEE9F2FC222594BAA,0xE629FA6EFFFC360,0x4FC36584386E7A69,0xFFD2C48DDE886C9C,0xD90059909EA6C64E,0x69B96D2BB44EDA70,0xE2026AA67428A,0x24F4B7F0D875F6F,0x80AFAF2E3C893AF1,0x1F3A3A9B70381E77,0xC67E951F078DCE71,0xFF98D854A130287B,0xCE10B26DEC72AEBC,0x59BA5F927C8F4DD0,0x20B67EED4A79CE,0x5E384E46ABAEB8BB,0xA1E5EE5B35D8F84B,0x4C6469117A946730,0x32D4BEA7FF9A0827,0x92C643F0E48493FB,0x744A13961499118F,0xD2C0E689E7BC9A4F,0x8CDA7A960CB8,0xCA33E8845574DB98,0xC6F30903EB077F2,0xDFCA6CB76E169935,0xA55A756CEACDAF47,0x837314F504B45B51,0xD9186404BC21A02E,0x401172805D74ADF6,0xA55E5680ED27E,0x220EDF056BAD7F11,0x340695ECF52ACEB,0x6554A0AF5E6DA466,0x358B25892E98039F,0x61D9529DADABAC5,0x644454F4C45B52B4,0x36238FAE606F1A11,0x151BEC9C6D5D3A,0x79435DE8C48EBCE4,0x8F38811C4233C19D,0xBD2965628C10026F,0x53D899CDB3C6D92F,0x142E92CA05AB3EBE,0xFBA5470A6D4EE065,0x429A1F5C35035707,0x18E889439233D2,0x3A2D1F70E6986418,0x9B70B75D9C72869,0xB1AC1E0AB49E80A2,0x7A1F4193EEA09ABF,0x730FA050274A8771,0x198044E2B067A658,0x477F111DC18CAD50,0x12205DBEE400D1,0xADA30EA6EE2EC003,0x903AA03A4306022,0xA91A816494EB5AB3,0x324ED5E8B31B1538,0x501FB61A9B31A9D9,0x75A9AD71ED9B9AD0,0x8DC2CF943AC2F8A2,0x1B5D07CFC22973,0x8C813E77912E5396,0xD2600477F742CD90,0x3EDF668A4760EDF3,0xA2DAD4BFA0B72E7C,0xDBF0DF3538E54792,0x15261B21FEE3C54,0xFC548912C684A3EB,0x3D18A9DE3684A1,0x33A88FE3E5F4AD60,0x382B7A5E2647DB77,0x6ED617D9CFF7F32F,0xF96792E7AFD8123A,0x192AF41A40EEE7A8,0xF713D97855C9773B,0xDC642906DD7905D0,0x1A52CAE814FD1E,0x5774BD1D79266211,0x5F22558FC1669829,0x688D9E5F7EB34203,0x80E8393042EEF534,0x94642BFC7357C575,0x2D9E53E8D7964176,0x649A5CB99486990D,0x811F8A6C45772,0xFABB7D6BDDCA3899,0xAC0BC6B4C6C8CF8B,0xC87FED48EF7DA46C,0xF6DB6824F6726E77,0x37D856D8D31F1415,0xFCD33740C07D7932,0x28221115DBF5B1A,0x2CBCFF0C74D87D,0xE594F91BE9F2D97F,0x5DD1D33B54167042,0xDDB2D08A6DCDA9E8,0xA4878411A3A9603E,0x78CF233F501FBA2B,0xDF2DB034926A0FF5,0x3F0E7D74CBF3CA65,0x18533EE702D5FD,0x51C7D08F353345D,0xF91E9459B1CB31AD,0x672E058716501BBA,0x7A4B08BFB8EFF357,0xEA22CF8AA49E4ED9,0xD121B4F8B14F9E1B,0x1FBD133977B5E6F3,0xDF232C5DB6811,0x8301CB1180AA116D,0xC280CB5BBDCBC74F,0xF02E6AF164820453,0x6B94E7BEABE58773,0xFE9DCAA3568C8C1,0xB71CE4262DC616FF,0xB323A6AE659ECE5F,0x35F01821D95C81,0xC1821832420E2D0A,0x6E75E72FA307D006,0x63FB43B0BDCDC697,0x31B018F582088672,0x3894D9C4F282DD64,0x3CD602F00BDF9D6,0xA331C3054B903297,0x1611C2BF317245,0xB49E6EC86CCE5806,0x2AE12A06DD472CB2,0x4CB9CD503F02443A,0xC154D46D6B900C0A,0xEDD623227632D35,0x52D7B85D014107C1,0x515B60DA8BA83252,0x1A3D699C7C968,0xACCB0CD0077C182E,0x7CECF91B7FA07DEA,0xF2DB804D7E20E9D6,0x24224F00F9A4D735,0xE89B5FC85518CFD4,0x4601FA9C70BC7A8E,0xBDE02C1088718120,0x28BB60503D068C,0x9FE73C4C333BC0D1,0xFEE2134FA27E04D,0xBF0D6C269F94661,0x3BD61BCF3F078FC9,0x90A7FC707A8398E7,0x34B8D4486D4B161E,0xAB04600FAB32628D,0xA4A777C17BBBA,0x55E4FAF39D45837F,0x88DF44B59A51B3FE,0xF365B98D86E320DA,0x600F5B640BBD41AE,0xB05AD63CBEC81FB0,0x9B9DEDC0B5080A09,0x6D960A9BA799854,0x1E1EE96AA2143C,0x8E0FC2761139F206,0xB41635C1C87BAB38,0x7D7F126807994D42,0xB8D58A8FFC5C00A6,0xAA63AB187B6523E2,0x2A79834E5BA7A446,0x9A7CEEAB2CD748BF,0xD105B18154E6A,0x1852658608E5B8FD,0xA486B345FDE0AC8E,0x7F509B38419D0F3C,0xD5C41CEBCDADFA26,0x6523B1A161DBA642,0xBFE0DBB7CA076360,0xA8A2AB2CCACD9E4C,0xCB13A75D5AF69,0xC87C3F50C5E68EF0,0x777EBAEBB832C970,0xFEC8D351AD259D5,0xF666937BD65C68A,0x15CDF5D343B3758D,0x32FDAEDEB1EF345D,0xD0581812E3AB9822,0x377E0CF1D1A8F3,0xD7F7C63368FB1243,0xB492ED4FF7962CAF,0x9BAF2229DB6801FE,0x294E4B3C0047F275,0xCC12113EEEA66774,0x469C79F280248D33,0x329981E65745ED07,0x23A55107A92FB2,0xA0B779FDD3E9B2BB,0x7278768CFFC40FCC,0xC390C13DCDB702BB,0x5BECC9254B36B3C5,0x52EC4EEBCAE1BA3E,0x8E5C41DB53A156F5,0xD0D0127CF2FF1628,0x3C04F6500D243C,0xA807936B350B12FF,0x76787F2E2618EBD9,0xCC7F9A44406BBDAC,0x5C4B28A3E009921C,0x5C6809FE86145550,0x26E054B74011983D,0x1393B0AAF147C335,0xF59B396FB2DDF,0x9F9EA511400D532F,0x47DC3FD40AE4B824,0x953104D3D0395083,0x405AE9A503ADD61E,0x55E7A9B9FFFA03B7,0x89008B2C030481B1,0xCAF37EB41B9A8B11,0x200D1D253D104C,0xD8FD031E99167069,0x314FCFB01A7BD1B3,0x95D257C7268C3A33,0xF7559F644C44E00A,0x751C092D5810A910,0x1DC5878B064BA63F,0xEE4D69231948B3FA,0xB78BA0A7FC87,0x200385274410CC8E,0xC96362205AE7E918,0x518C78F94C02F380,0x150D2788CCD9B0B4,0x1D7F5C2906CEE908,0x3A85EEA35B2E70F4,0x600CC91A4D967356,0x17966DF3A90179,0x29AA19A0A9FCD5F1,0xD179C07E5E7D7688,0x7B13FAF81A009579,0x2007A98AF14F28CB,0x929393E833177FAB,0xC761ABCB14ECFAA1,0xB700D1C778B6D499,0x363687468CFC66,0x55AAA5C5B3F1A91D,0x28B710F20CB1BEA7,0xD2670F86BFCEB43C,0x5875359498586DBA,0x5550FEC793C1A1ED,0xA0270FD916EC15B9,0x68B726D27BA2366C,0x1EBD7438DDE7A,0x143C249872FF8948,0x37088EA28661A8C8,0x8599E40A9F6A226,0x9D028CDDE02E443E,0x5CEFF739DCCAB4B0,0x5E8B26CBCDBA9EAA,0xB3E26AFFBCCD10C1,0x609C35A58E374,0x67B41B56A28FA0DF,0xCCB9002D37C28BE9,0x567A82C7ACED57E6,0x21831FE9D37F57AB,0x8DC838EBCE285591,0x1A3890DE1617701,0x6890A3FF54952BC7,0x1D373C2D66D367,0x6F0E7978B3CBFB19,0x3F81467F09BCB209,0xAC98192AE6C0B3DF,0xFB051941EDA240AE,0xDE5B2C3AB81ED6F7,0xA49BD6E8C991ABBF,0x13D1F5A59AD75E1D,0x138B45B2C8FB98,0xF6038AE2E7303857,0xF4707AA79E0536C3,0xD70B0338B54FF65B,0x1DCAA07BF4690236,0xDFA4857BAEAA7D30,0x41CE6F348E13A623,0xE6A89B62DFCB2237,0x18B5CFD48026E9,0xA57BCEE566F4AA59,0x60D3E45CC7A567AB,0xC5D036A5A6DEC6C0,0xD0512D250268D386,0xE89C77778E1CBA5,0x9B5B6E28828EC769,0x19CFFCA36576C510,0x3FEB211CC777C3,0x90D71CA22BA1DEFB,0x28D48A27D773DDD7,0x6BBFD4A2A5C74EF2,0x7EBBDF696143C53D,0x456D2E497EFA20DF,0xA7F9B173F7AFEE8C,0x5D19F66CC66CF6B4,0x26767B51797902,0x2D1C8363C80B866,0x89F3E2D68ED6A405,0xA95E24C55C0076E6,0xAFCD59B23F7DCA02,0xE6B4C7A01102E6C6,0x959B47A6C56635FF,0xDFDE5DB5B06208A6,0x2C0BE332A5503B,0xB76ED5D1CFDA2BBE,0xF53FC4CA931164EA,0xD836A6122A4EC158,0x72FC78AF23C0D743,0x9A4DCDACA1CAAF34,0x546272B79C8F40B,0xF6158C709B0BD059,0x672ECBDFE28AF,0x7F93392C79063E1E,0xCA2B9C3C752D05AE,0x74AE3392A702BD96,0xF7EDDAE8ACC299AE,0x4A549BDDA5081002,0x28DD5023E0939D9,0x21D33915E7948018,0x3DFFF57DC33C15,0xC7785A1CF9A1E35A,0xFF2C647A0DCA6801,0xA1A76B5757C1088A,0xDF21E599D19D4842,0x20BD59C7613E6A1A,0xF884C54A49D30A65,0x3595C0B54B2B93C3,0x3F8CB5DB59C9D4,0xA3B84D27D11C8FA9,0xAED5C16932179E8B,0xC669A83C03BF040E,0xF8FFA5165B810293,0x4C476848BBC647F7,0xB06F63A480D306BC,0xA55D3EF790C2747E,0x3598ABE1D7F5A0,0x25FDCE068555B7EE,0x1AE2FCCF650679FD,0x3213EB8EF80D6AD9,0x73BCC2F043D115C,0x7BFFEE700F6B42BD,0xDFE39E18F1499E51,0x9DC7247DF8866DF0,0x3DA25355DF3B5A,0xE439F0235F3C6CCF,0xFC7443A640521E36,0xFDDFA635FBE89B95,0x4F0FC835C9D5456F,0xD4D9D820A301ECDB,0x8E23ED88A020B22C,0xFDBBA6D168BF15BB,0x2763089050AD9A,0x1BDAF6BADCAADA0C,0x3DF265F00B33144C,0x1E2DF11983B2899A,0x64AE685E7C4B6E1D,0x37D4FC5034CDE730,0x9926675AE241ACAE,0x8260725D2875379F,0x5E670419C10FF,0x198BFA07B317CD73,0xFE3ADD9D5B906B5C,0xE4BC6CB2B6BD14FE,0x8AD694FB2EEDD28,0x4FC2E49ADC9754AE,0xDFAE6044904BA2DC,0xFBE4E75757A804A8,0xD48363BBCFC2,0xC6B4E65A6A78AE78,0x41D33D74D4A3A87A,0x5E93C800FEB17D48,0x1BB8E06A3A767F2E,0x95A905FB76F0581F,0x7D70FE78A9174F98,0xA95C55FCCFDCD09E,0x1FE8AC6DA7D179,0xD54AEF8425D0297B,0xDA3402FCDF4CAC43,0xD4FA927B31B1EE5A,0x19E281382A6E2BAD,0x2FEEC1FEF4D0DB68,0x641FFEFB773DC529,0xA6A59AAB4FCA3E4E,0x2B6BE1CD3B0FD4,0xD8B2BF6336B75A76,0x24D8F13AE6A09A22,0x2A2703937AF88F4C,0x5BF8DA88C6323794,0x716261EB55C29CA4,0xD53381D9E208780F,0xA491085B24355631,0x11240A673D961F,0x2738E5D11EE66A48,0x8E6743AE1B40E37C,0xBDEBFAA66C86B174,0xD8FD34B7F9374286,0x867094CC5CAEDBDA,0x42AA1534166DB0F3,0xA379C2B5198B7B98,0x1997A2490FDC26,0x66E5C8D7478CD34F,0x825F3040154FA79,0x4521FDE6D759F9A,0x33D2D4D3B4917CDF,0x4462037D0750BA98,0x833052E1B73D94A3,0xE27B55835CD8CC8A,0x236054F26CF090,0x561B60A9CD418B2C,0xF11E2D533A538A4F,0x9CB56FDE7FE3E3BB,0xEFA11D9D52C40998,0x3BE75CF47E05BE8F,0xADB3BB12B233886B,0x5D7451BAAFDDD99B,0x22835AB908895D,0xD836277F8D6A359B,0xD67AAE27F8AC2ACF,0xF44A990A34748859,0x1976C8AEE0504B1D,0xBA743CB2947BB953,0xC9E176F57CED0EAE,0x79932B9B16189EFD,0x2F22B81A750562,0x5922972EB406A39D,0xADCB11A5E6FBB755,0xD73CC5D4B0432D47,0x6248769F8CE7433D,0x7B6C5E558BEB7F38,0x748A8BD776C4A779,0x968CB13C33814ED1,0xAFE11CC5F69C0,0xDFAF1577EC5F3D91,0xF65B0D42A554417E,0x13126D1D39615EE8,0x6CDDF61EBA360951,0x49350469B8C4C2F2,0xEF61CE2348541EF9,0x1CF54248C71427B0,0x2DAA6AA458CB4A,0x64E5C1E5B45D5A61,0xD4071053AF6E22A1,0x27A6A0531053A4D1,0xC18CD6338490EB5C,0x14008FD77E7956B0,0x24BC3B90F635CAEB,0x68253B31625A6DB0,0xD0E56AF256633,0xFF10AEE9207F0F52,0x1A41405D65C9C472,0xA2B82801E192CB3A,0x3DD0E10D1D64026F,0x55C02AAF61C06538,0x9FED93EDA7B668C5,0x58303FBC786BF5FD,0x1D9E9F689F6F08,0x1AFC2BDA67652B99,0x87D1A0B228735547,0x839DBEFB6FA14B35,0x8F1975F58851A5E6,0xB1B7BE616F7C06B3,0xFD18285CB539AB24,0xA956AD744E594FE5,0x22E1C3C5501AEB,0x6DCC4BBDA204656C,0x627B52FA2A60EEC4,0xDADB039443B06287,0x1280590211A56639,0xF8355FA54A78A88B,0x3CB28EFA608E6B07,0x99CEA2D4AF34F95F,0x1246E76CF13239,0x7796A5EF5C4919F8,0x60D667310826A3BB,0x911A469B6A68EA2C,0x6656655E44A9A987,0x1EFCCE66ABEE8660,0xE3DA663DB872AF49,0xB532FB2B23AE30EE,0x208757810354ED,0x917861C5ECA2289F,0x4A5FD03C69213EB,0x63B66D137445700D,0x424A0B237A2C09B8,0xF4FB6FB5A2AFEC7F,0x675B3DBDC326EFA2,0x7E2C855207E6A94E,0x3BE686CF5B2BD7,0x8CE3DE1683AD0D52,0x1333D0D78B84F6FE,0xCCA905C62ED661E3,0xF8231F2280A3FCF8,0xDA0C568FF4B2195B,0xB9140E523B7097C7,0xD1CABFB23F5071CA,0x11216BE1A06AD7,0x9C4EFE33FB3BD580,0x3ABDA3FC4E44DD77,0x7DB6E2481D74DE4C,0xB2AEF24284268D29,0xE1CEDD53B3B5B8F9,0x9AAB7FB99585EF36,0xFEC9B24DA2540E8E,0xC97779675D9AD,0x5070ED74A49CAE7E,0x26193FBD1859A082,0xA3AA596D60B0895,0x5B3ED5A5CC03C58,0xE47F7B4A482043E1,0x1D712E7F3EEB2816,0x8F8F009878B7DFF5,0xE08F0C981B209,0x413FA7FEB454F87D,0xB6A039D093AC1F8E,0x656CC21E7AC267F4,0x71723AF05685177C,0x6F1DC2BC560BE13B,0x3EF3A698842F2AAA,0xD7CB6EE263EAE54A,0xE8146B6FA76D4,0xA7B8AC92C2932427,0x4E7A8E4B3F6633A5,0x1F43BE07E48949EF,0x177F16482C5BD8D9,0x2598A14D2083F710,0xCDAF2DE47D790E20,0x16B73B81A4401DB8,0x22677754CBFFB,0x1B43C0B62F61B209,0xB443BD36230DB468,0x3789F8DB3B898CDD,0xB698C31C2972CF6F,0x97EA56EE7CEF2127,0xD6E41E2FE3D7ED35,0x974DFF2E9299C25C,0x201E7E9BBD21,0x1032CBE8580DED5,0x7D623EFF3906B382,0x1F451C5623EF1E23,0x3BC762D0B3DD7A0B,0xE62C5B2CC88DB5DC,0x7CB0F7E47328C9D2,0x2BD4EAC8F84C7019,0x1478C7A22F1859,0x83DF048E46BA153F,0x461A2DF5052600F2,0xF6D1CB7BE7D20369,0x438050D1BED7C25,0xEBEB77BA4BBE1E5A,0x4DBC4B6741468BAD,0xC2E2F3F186AAFD57,0x32BBDC0E8A35BE,0x534332E42F7D49B0,0x5F94D35758A39906,0x5410B1A227740ACC,0x5B914C56DEBB1795,0x7C03D55C8B9F73A8,0x435EBB793D6027ED,0x3F37A7B69CDFBA8D,0x3D952AF6131B9E,0x23B78F8B4085CD9D,0xB040C51424D9BDFE,0x5E1F0E87DDCF6C91,0xD2A577C645BE3C9E,0x5D756414D6565502,0xB17E5A7F184AF521,0xAC9EE3EA5605EF56,0x3FD8F12E2D1E6D,0x7762BC75FEE4BDD6,0xA71C1BC22505F768,0x8917C3B9BB85886C,0x57AC59181C333F05,0xE03E949723877E73,0xB29B1966301300CA,0x3AAD5DEED5A689CB,0x1A2CFC7EBAE112,0x937F21CC7A40F411,0x32AB41471B17588A,0xA4741E2D79B486FE,0xEFD7F181770A632B,0x252BCFB50CBA9AEC,0xB4B085DC35D85D95,0xDB078ED073A43136,0x11E5C10FD0CF3A,0xB2995DDB56751EB1,0x61475CB78051621C,0xD992140134DFB45B,0x20BD696F5AC08F2C,0xA9270DCBB0FFA041,0x33A0AD97D275A4F7,0x1C336659EFF10387,0x13078B7BD77810,0x8D9A8970D977BC35,0x8FF7FF2FEACB17CD,0xF6C06C09440E2AB,0xB519AEE6A9474260,0x6C640466F6495B18,0x1F72AE2BFF8710E3,0x3EE916575491485,0x7B9071A0B8807,0xDE26B1C59CA543B5,0xC8CFC60A5536600B,0x5BBF4572564938F8,0x863424BAB1A44594,0x8536190060B38160,0x37342A90F9504FC8,0x9A6A113F87B6C9DF,0x10431B578B58E0,0xCC0B49200054FECC,0x6BD9622058A8176E,0xFA6AFEC0BB86AF21,0x360537D9BC4262B0,0xA1B78D8BF9A348E,0x2CBE0D7875E58268,0x7D50F92B7BEC4F02,0xD03CF6DA8BF3C,0x21D952616351863F,0x582C73C3357753D,0x1DC716FDBDF61ABE,0xB618ED552674A069,0x8F4D5ED9DEF02C98,0x39355087AE81538,0x36DA9DB1171D9A46,0x2B00F486FB071F,0x5B4DFE5A0337D254,0x619EE67C6CA91E8B,0x190491B42C7DB076,0xF95C59C36F932D18,0x977BFD6428B83792,0xDFBCE28E439391DF,0xDB538EBC2A8D91C5,0x2D7D2D7BB24620,0xB978B273A849CC70,0x1FA17E2432E3DA21,0x48A0F1181604F66E,0x76FC9CD9DAD33CBE,0xA6AE1B44DF56CF1C,0xA6834DC3D1B23BD,0xDB31BFD296910D78,0x3FFE55A747B56E,0x44B2598E8A4FAA4,0x5B56F36813866E01,0xC733ACE25BA27458,0x556C4E39C460D574,0x2A8AD2680050A051,0x10FC260E052FFADA,0xB19AEFDF1D13AE2,0x3B83C3A4A360B,0xECB579789426D472,0xE586722F555D4E50,0x9018F044B193BAC1,0x44F4AFFDEC4F5FCB,0xD377F7C95594C86A,0x99E0B04D00E0C8A5,0xEA084B427849928A,0x27FD83E634E13,0xD810F281ABB1E538,0xAE292504B02C97E1,0x35C39863FABE6A02,0x9D7FB0FA11581EC1,0xFC31DF35E68A982C,0x3D9447E135327F07,0xDFAAF68DBB7EB770,0x9C59387FF0AC0,0x6F76B6DE7331FBC0,0xED1F9E0DAC1BCE3A,0x722179059712AC05,0x66EFE705714D12C9,0xF6BA03D809DE5EC9,0x44351EEB3DF46552,0xB691AB95C3147F41,0x243152DA8B8D1F,0x8F5D5EEB361DB71A,0xEACF09E48A2D0B31,0x7BB78AB83FBCA920,0xFD9AB8E86E1AB584,0x3EFC47AA5E3F63BD,0xB19935EBD9DD5E28,0xCA10E574A872ADF3,0x2D9FF4431EAEB2,0x18AAC54BAB10FF02,0xE579D9A254AAAA3,0xB7E921FC5841FEF2,0x4AD4FC5C1DD8665,0xB0E91FCDF3325A96,0x3F81FC22DE02BDD3,0xDB1A561B961FB964,0x1E56E1B17D0EF8,0x9248C6A275990B53,0x1DD1E2D872D49506,0x6FAF6C40F49D83A4,0xF9352096C2F2FA00,0x85A8E0E7EA633B96,0x7F4185E5CA3FD741,0x351FC51A90FBA03B,0x2D18B380CD5BC6,0x629D04B063ED2A67,0x9EF9286E1D54AABF,0xC42DF4C24610CF8D,0xDA81D08928ADA23F,0x7A157034373C21CD,0x7594A62876CEE2F3,0xB45AB0D74A0C5A6A,0xB692D273D8D3A,0x92DE665F128F4B75,0x749262938C74C334,0x9E56EEB93597477B,0xCCF8D9F390CE4730,0x7EA9F95138C7E658,0xD26A7A6DC216FB03,0xA98A7D529E2C1F18,0x2347E530715C4B,0x8AF84132B0B40E09,0x6A4F8E085BB98D57,0xD94AACEBD6014D0A,0x2D4FDB48666DD740,0xECEC27803BB117A5,0xC2A302AD719D6FE8,0x105157F7CEC1839F,0x1F33A5AF39D9A5,0x73AF7589B580125D,0xB15227F5168C4DC4,0xA947998E7433BB29,0xA6A2D8268A0AD263,0xA8F86F5A9BA25C0F,0x89D602D1ADC4940D,0x5ECD02BCA2DF8D3C,0x3A9DED85B0455A,0xDCE45EBE971BED3C,0xEE00068011FBCA6B,0x6A6CE986D41C0F26,0xED3BF79E5598F287,0xC9F927852EB289CA,0x6535BFFFF73EC737,0xA26440C56B6F6A2D,0xAD5CAF0BB100C,0xFB40C81B8577C24B,0x6A228EFEF2857457,0x606FEC144877C8DE,0x8984BD0AE02AD191,0xDCFD0D64A79B58E7,0x230DB98CE54F6376,0x551D0DF8CE796364,0xD9821E7501803,0x66FA0CDC8E0CBCE7,0x718C11096AC4FCC3,0x1D49B6A40F445E19,0xEBBF54ADCF2BE142,0xB34B16DF17BA98EE,0x6746F6445AE61E19,0x39CCBFDAC797206D,0x2918986EEF7A82,0xB7A4E6A9F1F887A8,0x71164A4BCABE0D2B,0x4515E87014065497,0x87D1D2AF5B7D6095,0xED69DE2E6F97C091,0xBDEC5353C8B0B7FB,0x48B73620BA31BEA,0x40519B449A5428,0xE9EACCE6B8C199EA,0xD7C16262CAF8B47C,0x6A7311492F260186,0xA9868DAABE661458,0x671745269B8B6796,0x7F9859D7EEB4168,0x2D4EEEC4AFBD4A96,0x13A2A74EA8819C,0x30DBB7CC14A0907D,0xF1E1AF975DC6BA82,0x550BF6A3977130E8,0xB5C8215A5BF21031,0x1B4CB1F8B68F7052,0x59F9E4EF4530D84F,0xA2E0984532DBAC86,0x3FB08EBB2145BE,0xAEC77A75D6C1064C,0xBD949FE95B6F61F,0xD28250908F82C557,0xC67C1B117CD2211E,0x994527CD48241B43,0xBF393BA0A81C489F,0xBEE5F0D8C230605C,0x1D51A0451018C,0x485487D977290E1E,0x1FABB83E1CD14E83,0x9C0003502C7BAF7C,0x4701C389182D3505,0xC4E55F94EA70227A,0xA390108443AA024A,0x9C0013F8540A6638,0x7C5D30D311888,0x6222D67B7DEF5C02,0xD5B345A2C48DC0,0xC3F97C316CEF26D5,0x53D7F3A4DB1FA663,0x8F2E1EF8CE8BDCB1,0xDC418A5390574B3A,0x85005E785B536CE0,0xCC08D15EFA512,0x6E7FE88A4FE82A93,0xC85F70326533FFA6,0x227F178622A173D5,0x87485158AFF435DB,0xEEE688D5AF114155,0xF18F8B9AC371B6F4,0x375917E165B046C6,0x23AC104D20409A,0x6599CF835A28E6BE,0x568266138A124307,0x47E92285A53C98BC,0x9E329FCCA12383FC,0xDC8D352636FFBF12,0x8E6700BE5F703CA4,0x8568F92FD8C718A5,0x2DCC1097B6DCFE,0xF5DEDFDBEDA43F86,0xD1E5CBBCAF4B2E4E,0xEB03E874032A100,0x96E0DE0426F8C871,0xEF19AA827E30535B,0x390E385E4A93A202,0xDF2D183BD9DBCF0F,0x23805BEE538EE8,0x90685F0DEC330896,0x73CBE06CFD3438AF,0x97323F16EF5FC63C,0x7E97957ADDE1F736,0x8CBA507299385A3C,0x47A522EC78777051,0xB121469697B133FD,0x3E1C15FAD3955,0x58BE1E194614F247,0xAC15236BA4577010,0x4BAA4E4F43132ADF,0x55A6D3A7A114339B,0xADC996D4E3980C96,0x1F566F210DDB01D9,0x9C429275C44423CC,0x36A996C5EE2D20,0x8393E8ABDDCC8D88,0x6D4A7776CA64A717,0xE4FA9430D0795EF9,0x5344768BE4006474,0x2B15DB1C6A0113F6,0xD3EE3C6B6CAC0B38,0x250E6F2545A50F9E,0x2F1179AF575120,0xF0B705E5EFBD0D9F,0x2CA23DDAF70419A4,0x9813CEB2414F9439,0x15FCE5687DA646E4,0x3160AD95086A78B4,0x8A69CFE5AC1DF33A,0x8AE956756A9708FA,0x3EED5ED7FC5A95,0xEB985341033C5C93,0x80E4431A6D2800C5,0xD623FAFD2DBAED6B,0xC083DB8B5952612F,0x6109EF683BA43CFF,0xF122B6C2C6BE5BD7,0xFE27E3664BC56806,0x105A229B3DD05E,0xD8018D1CF18A5E2D,0x8DBEE2F119738125,0xCFFDA6A3B45662D8,0xEEA05C8337F8F0F0,0x264BC55CBD4667C4,0xA4B387224D8F1DF7,0xF1568F897CC01E32,0x1794382C3F7E48,0xBDD6D8CDF8977071,0x38103F5539FC549A,0xB07D7560880CAE4F,0xBCE8DD0691FD4C3A,0xF8588472472D9C85,0x33E0D0EE721719B0,0x4E91C4A796D7CC34,0x168638C2C3302D,0x9ACBF96C32155798,0x3ACABDEE16D89D54,0xE7B4E73BF4A77C6D,0x94C7A950FF0F7EA2,0x7AC80B961C8A326,0x1EE277CF8607E14,0x5C0C0DE755F4EC5C,0x28F0ACC33A652C,0x7AD6194C761A0E01,0xD8EBB01C4136DE05,0xAABB6F1E54692841,0x6514BCA14977A020,0xB74FA27EFBB729A6,0x415A527F10385511,0xBDA13B58CA662FBE,0x28B9C34D873931,0x659A879965E9AB19,0xC47257E5ECAFA9B1,0xEDF7BDF91CEBC599,0x3702358EB37DD551,0xDD557E9F0C8AD8DE,0xABC489531404CAB4,0x6628F096F7D337E3,0x28CA6A654F83DD,0x3722C1B623888225,0xCE39DA15C6443D82,0x988FFA6C8B44EB44,0x9E6DC12EB30CF70,0xCDCB498E47B3573,0x583C26104FF6195E,0xA83C0FE53FA839EF,0x103193E84D370D,0x9E4EDFFCEBE2C014,0xFEA3A00863DB87DB,0x36C69CF7CBA4BBDA,0x94050D071BCBB370,0xF6A9D28876297CA4,0x9577EADFCC241345,0xF41B4F440AC293BF,0xB462FF1523601,0x8B0129F157B86B2D,0xC4918CBF886C07EE,0xAEB59152E86262C8,0x7A907E82EEE0C10F,0x4290A4713299DA28,0x1EE1CA9CB5D7026A,0x742D211CE6BA0BD5,0x99A25FB5CB2E1,0xCDBF3EDE0FC7728A,0x2B8B2BDD117177A,0x2A307DD68531D1D5,0x3737BC38595EB5FA,0x2C718A3B15481D39,0x5318BD220C8C0BA1,0x709B3FD332F5E768,0x2D11BF8DE38D16,0x1A73C01CAFFA5D54,0xF088C6F1E0F091C2,0xA21D8306D181B9B9,0xD261BCAC5D367060,0xFC97580C73186F39,0x9E653AC6EE1FBE6C,0x285034D605A37683,0x54E87069A45B9,0x487E72736932F80B,0x85C52DA93E83A6E4,0xF092C771B3D0AEB2,0x32EFFC24E82490DC,0xD6BE36849C46A727,0xA2DD6C3CF9C48318,0x48A45B8F5EAE5088,0x1897A277A27FC2,0x851F3475010DDEA2,0x980F7640BC60A75,0x2F8756492562B37E,0x74BA6F76C9E4F8B7,0x1CBFDE0971C4E195,0xF9261D02BF6C4D05,0x43BC4A79B341DF71,0x1DAB02301EC390,0x458AD3DC83E9F8E1,0x1C72207532A98FF4,0xC4C79690897B2D3D,0xC8DEBFB0DB9EB4C1,0xC97A1DF2EA713C48,0xF5167D4829BD2F49,0xF15703E7B06BCE6D,0x2D2BFB2FBC6E89,0xAFDD735CF259336B,0x5EABBB263BA4220F,0xF6BBDC53673FB39A,0x5BC46D50CD968D38,0xA1BE6E22F94C28DE,0x6273C238BD5BD908,0x37543501881119BD,0x34104F3BD9ADB8,0x6457ADCA58B4E637,0xA4F0EB2A0F1B21EE,0x3EB261487E3E513F,0x25DA3EDBDF83C506,0x1AC321761190C5B4,0x741A8CB23A8CED0D,0x96B9D3778A1A232F,0x36E2E1C3BE7330,0xA1AAE273E4095CF,0x615CB764828B56DD,0xF93BC7E14D81B1E4,0x158497D36A719F39,0x3ED2DBFCE529E8CE,0xE8F9BA9339F6ACCA,0x8D431382F1677A3C,0x2A707F3DC8D4A7,0xC266257D8A9A1197,0x353280248C35B9C,0x621F05A2AA4BB20A,0x3E144E3D3006B92D,0xDB31C3F1F881180B,0xD8C70D8B93C84CEC,0x219B176E8C8E52ED,0x3A4BABFDB97713,0x5BD39EEBA08882CD,0xEF0D8ACB1272FE21,0x647895AD3CFDBB76,0x783D0E2913FE118A,0x1796ABE1B3686D9C,0x8EDFD3930304130E,0x649972E2385B69EA,0x130ED26767A121,0x7C869C2A14FB6898,0x22108C89FADFBAF2,0x118479A99DFBB001,0xCB336AAF2737F3F4,0x84DBAE17ACFCA0FD,0xCE9FBEF961397D87,0x3A877302901C017A,0x262EB4FA206CFC,0x69519B0D6B8AD023,0xC60AB0B51258A079,0xBC8A3C53EBACD540,0xE066A4F1FD769780,0x3F91B988D2D2C9F6,0x2D171B0166300E48,0xEDCF4B161B535EDD,0x18E400122FCE38,0xD26D09DA942407B7,0xDA7707851626013,0x514935F9FB103B6E,0x978C728EA2C6B77E,0xAEC8AFEF4D216C58,0x2BF860FA58D0345F,0x8749EAF0C93837B1,0x3B9368F9E3BCA2,0xD82F48534DADB5B5,0x8A32C588B7AB6A61,0x5E86045423A232DF,0xFE1F0DAF1D0E402C,0x15C366DE0390C96F,0xA4F2B3187623D431,0xBA4C4854D5CE4C66,0x3334B371DCD2FE,0xDF896C1802EF762E,0x631150D17E75132D,0xEF34D9AAE8C60FA4,0xE3DEF839A85C09B0,0x2ABD3404C26193E3,0xBFF5A2052EA7A8C,0xE79F497ACB6B0E8C,0xE2DCC5BEB3BAA,0xD91DC76D45362458,0x4F247FE054F02954,0xC9EC4A98A0E65DA4,0x5E397234EAEBD211,0x5ADB9EBCB3B2C5C7,0xFC2746549B148A3C,0x654350FC85F16151,0x2BD82D0F559C5C,0xE55D5612FCC3E5D7,0x6C8B37611401C7CC,0x8E1F62816A8D4FE5,0x4083F3A76C3FA3BF,0x8BC27583EC61433B,0xBA31A88132120FED,0x5A801FBE6CFF5DB8,0xC2FC170E7014C,0xA8BDA24A0B1BCEE7,0xF7AEA855E2B95A5A,0x850DC131345EFF29,0x7062564DD7463144,0x534E31812B42C4BB,0x61EBF8D1443CD87F,0x4C2F727FE7A7F25C,0x1E8A76EE559E10,0x1DFFA2A656B93C33,0x94258B872E2C7C1A,0x56A45C97A342F738,0xA31F848536C007F1,0xFA284F77F9CBBCCF,0x74A095A8FBAAAC3F,0x332AA94E0D3DDF6D,0x3D9D778DDD196D,0x46029A648709441C,0x2ED0F63FD21B017A,0x733E104CBC8776E0,0xF48AF8E708507B7,0xE547B78D1420624B,0x279AC329AF8464A6,0x571CB791F2C81712,0x2EB4203C9404EA,0x226DE8F21327E8BE,0xA7DE9577FF89481A,0xD14209BF23B45D8A,0x2425C850AEB947C9,0x960D07883188EAAD,0x36F09349E6C2BCF1,0x34CD80E354C09B65,0x335B783192734B,0x931504F68F084062,0xB834DD997F86A83B,0x7E5FF6895D24BE2,0x1C9A082106A65479,0xF1840391ADFF3BB,0x779BEB673009C70A,0xA2A576D3F7A01AF0,0x3280B8E02DF1C0,0x932936D39E9AC6BD,0x5A50A2BFA1803C12,0xDCD07C5F5BC940F6,0x3323E0838AB7907D,0x58C2C72FAEBFFC75,0x77E05F13202A10C9,0xB7A70388737AA74D,0x404015F83E2AE6,0x6C98172DB08FCFF8,0xF7505F7DC0BD7D45,0x46CEA6D56655FF97,0xB83ADAD4C1A2762,0x737A13B1D9C5286A,0xF0B72292F22CDB36,0xE217E8913145F53B,0x1B931D1936DCB1,0x8E2EFFC12DFFDA78,0x6FE86CBFFC276117,0xD0BECF5E06DE2C5D,0x5641063FD1647BA4,0xEB1FEF452777D024,0x69AEADC2AE3B2961,0x4946B977DB713E95,0x1CE4CA362E1097,0x29C6301632B41313,0xF88B03EDE62EA0C4,0xF14EDF270D4DDC38,0xD06BCDCE07E8E46A,0xAD541F745179EE8C,0x625004AC08C81598,0xB61B7108E656CF17,0x4B2C2482E1E2A,0x6081B5A35E1BBE1B,0x15181B8F439FD5F,0x447F3313A6F418D1,0x40EEB5B8447557BE,0xA2C50EBF2FE4D2AA,0x717C64C062D6CC2F,0xE52D08D2CCE38E6C,0x3314A179A8CDA6,0xDBC3A00DF8FF3D5B,0xFE179750A29BE18E,0x38A0D7F0BC8B4F3C,0xA2BBF5C46B02DE61,0x6CCCDA958C077AFC,0xB8DA6B7C3427035E,0xE6FD7CEAD00CE5CC,0x2C9DA58D903358,0xC3F19DD4D122A8A5,0xAE40BAF8112E18BA,0xDCB2E106EB5C161D,0x6380C93BA0008A38,0x67EE0F3840D816C8,0x1A0F599FDA873F62,0xA3D2FAAD4687CDB,0x3F0CC736F2F962,0x85E160BC1C34081C,0x3576E078C46457BD,0x3105EEC353E06AA2,0xB9996D8BB5D1602,0xA4BD8064978E8AD2,0x27924D35F1B4A053,0x147F55CEAE896DC2,0x694782164B8D5,0x5AE26B7F3FEF5B6,0x753A85E6C69F67D5,0x54C9EE9F294F33D2,0x4D7D4FF825A01C8D,0x15F192E9304EEE40,0x49CE463FC97E5DD3,0x524BB0B5EF7BD929,0x6C708D8337EC3,0x870D677F0C1F1FB2,0x360A8219161A017B,0x719821B21EAE4D21,0xB1AD4FB02EFC395B,0x90E53458CCAFF9B0,0xF6661564663DB7F0,0xCE50469C7014112E,0x20EF0E298EA96E,0xFC86397B542F76E0,0x3F6BFABA0D9C5BBE,0x7DFDCF99017E3D43,0xDABC81DDC14F817B,0xC4BE9923D3C20CB,0xD0880936FB7BFFC6,0x391927631599616D,0x1FAE7FF590B081,0xD753E11B214B4FFA,0xD3BDA48726738E26,0x2FFC245348DE3269,0x17A7A845D777D01C,0x13CB180406F449E4,0x632C88D7E6486195,0x69183E1510871DAE,0x1952436FFA8E44,0x8320E20E6C7A5838,0x6B924E6BCDEFF7BB,0xEB8883CFFAC30D0F,0x609D36C9713B2315,0x4964BDEB117B2141,0xBE825F5AE7BB642E,0x63CA5CEF57521566,0x2089470880DE66,0xF69400CFED890E40,0x87E62FBB53B1BCC1,0x36542FB2B599D081,0x3070B9EC5C774C0,0x554B3FBCA7678803,0xCE25730BCAD959B2,0x298D5782FF741880,0xEED975025ABAE,0x2E45EA8B3F87126E,0x3F752C19FA2BB30E,0xEC29298DAABF0ABA,0x274BA6B9759DDB98,0x18EE26729B77167F,0x4E8368440E47534D,0x57149676C82F798,0xA269EB95DA448,0x880BDBEEAF1CD527,0xDA1972CE5205899D,0x2AFDFB3736DC256D,0xA3ECAB5A270BEFDB,0x5BE8E995148C30B5,0x863A9185D16A3F87,0xF9D6B861EE423950,0x33D9A09A76EBC7,0x282D909398436888,0xE71242F036C813C,0x43899F6261846D46,0xAA129A0AF05662DE,0x40E77B95D6C51870,0xAFDFD6C10FFCD959,0xB689A51C0A188F1A,0x980C671293ADB,0xB71DD2AB18A5EB7E,0x5DED95C835D12185,0xBE2C986996564C89,0x6FBBAA45ED768EB0,0x97329D9A20041CD0,0xAFA84FA64DFD7F90,0x9EC71FF053FD0B8E,0x207EB48CA4A518,0x9BF790C5C7621006,0xE41811FD0C9C2393,0xCAEBA0883B8034A7,0xBD6A09BF63B8302A,0x92BC5AE21AC17D03,0xBBB696B13907B58E,0x43A3463F150C8E15,0x22A8E62184C142,0xD30CA6D944F52040,0x62CCD86C88EFF727,0xB3FFAC33F174AEC3,0xDF061A159F0AF422,0xB4858744F3CF178F,0x91FBFF24F97514A8,0xCF58709E08CB107D,0x360A0BC8401278,0xBF64C2A921DDC0B0,0x7D53CAA19DEDC2D8,0x36AD298499908F5E,0x6A5EA2407FAEF0D,0x49BBEA899B85374C,0x320ADCABB6F85926,0xF01715273FC3FD08,0x23AC3BA02CBED6,0x847765BF27E76147,0xF73AED5EF79E7FA7,0x6E93D7B1BAF4962C,0x895C99D9EBD1CB00,0xCA8D20FEAA898F,0x14FEF1C142C6AFF9,0xA14CFA7DDC5CF9EA,0x36A0FD7CAF5A77,0x1619BE2F760CE01D,0xA84964A38BEBE5E9,0x5B500517DCDF1DEB,0xB7668034422E918F,0x9C8C449784152E68,0xF80FEC8A03C9587,0xA053DF19EDEA4D39,0x1CB41FCB757257,0x751FC3803BFB8204,0x1EC2DD591FDF7526,0xF43FA99676577E77,0xB7FD8E0705E4A7DC,0x5DD5CD84315C50F8,0x8581FF37893C19A4,0xE653A370389DA3F7,0x2C5DB2C9F01D15,0xBC34337D627E77A3,0xE1626E3D72452C7A,0x70DE1564728AA22D,0x482EBD51D6A8F9D8,0x6C8C0246D118E880,0x178193118D4A6A8B,0x37515A9635D0AC9B,0x10C5FB8D66086A,0x8D75FD96DD8C81A3,0x7662980C9D3AC74D,0x869E28CF9073FFF3,0x231D83F2AD978703,0x36E402076A0C2550,0x9E548D6305DEA787,0x324B7ABC5F912673,0xE16B6280FDE49,0x3A4AC32AFDCD5846,0xA318B9689ED6C60C,0x8579FAF06F9A30B2,0x166D030A2C6511EF,0x55F017D3155C6A11,0xF4D23B3651F12CC4,0x36FC915F6D1B1B79,0x1B5156EFA8AFD7,0x21B3774BCB607D22,0xC202F2F51385B197,0xD6DB733ECECC7888,0x1FBD8B7257800194,0x38053A2D2CF74127,0x745A3E878A805D6,0xEC27D34727D033AD,0x3E909C9D6D35DC,0x6D75855D23604123,0xE135C5EFC3800248,0xD9646CADA685D82,0x90EE3095C75DBBD5,0xBB91CEE020516859,0x44EFE3131D53FAA6,0x2FBD2287304B6F22,0xFFB8344BB777C,0x5E86F72F3DFB8ADB,0xD3183F06E5859F08,0x1AA7BF4B08499E75,0x3BFB423E7F975994,0x5A24C0F8505F1400,0x296D80969047D047,0x224AF37B38E7DCEF,0x316B81DB7D519D,0xD556F1BFBDE45C8C,0x7857911D150E1EA9,0x427127DB00CBF1AD,0xED561ED11A700056,0x2E2FF7A6F9AE997E,0x54B5C42BB4574C8E,0xDFDF48361A40B1D2,0x37926AAE14CD81,0x761F69BDCFAB61A,0x80017266A58591E8,0xA68F29EA4B1F10BB,0x832FFEDD690ECDD1,0xD40DBB57A0D750AB,0xB310927E062EC566,0xDC6D11D598DE9C70,0x2BF3EA9E582926,0x1F09BC2099158C8F,0x2241B289DB9D0E84,0x5D506C6C6364B64F,0x44EC09B7C5803DEF,0xF50F96FBA2C88EE3,0x4F8CD6EF0FA4F840,0xB38F14E25E654735,0xE4D6658C481C4,0x1557C8F956364660,0x53E1700069B7DFB2,0xF06C2E6DF8A7FF77,0xF25092F7B55533E0,0x6E7C0B6C6F01C6B2,0x4E3C12664306CD2F,0xA16087C127B9ED66,0x39D9F9734E2491,0x53490080F7D2A979,0xE64BB39D01436B15,0x1819BB5DBF62C865,0xD65886260CBDD1ED,0xEB3F34D2059F58AE,0x72C684C888427808,0x2E7701347760B7AC,0x25A22F4D92268F,0xF00574B00AC3AA6A,0xB668AA4C73A1C4C9,0xE31F13303D0A3FAD,0x50ED2F715722AE3E,0x30EC158F772AB009,0x9246B64F5CB283E,0x72C8C05D8BAFD866,0x3A3FDC07DC5113,0x6A9F9853906A7CAF,0x103E05623C27E55,0x13014AC698717188,0xCDFBA895AA7A93EA,0x1B40216B4CE7C0C4,0x5E7D125C81832619,0x3CFF6E7BEDE51C6E,0x2BAD522917A5C4,0x56265FDCE4A74D8C,0x1504F17C23CA1034,0xB813E32443FDD326,0x9EABDCA97417D7B2,0x6BB8A50936F5C95A,0xAE5E43A7B93E47FA,0x18A76F932D1A7DEA,0x1701C0DD6CA3E9,0x884325136FD15B81,0x30ED0DC6BCAD72E1,0x9863B1F07CCAAF37,0x65DCE02CB3D8FFB,0xA096A9E45106F120,0xE068618AA7A6CA7D,0x1F33F0158BCBFFB4,0x3A7F540214162E,0x8C5E3D576661F672,0x96346D76ADCA900C,0xFCB868282BE7465D,0x5AAD06FCD891A013,0x1141757232F802C0,0xB68C2F5B189DC2A7,0x9D8A531D8178C340,0xE7875081DF65B,0x598CDA137C877CF6,0xA9B0039CCA7B3969,0xB3C2925944A0CA1B,0x198182942C40C012,0xEB3B8D9A512C3C0E,0x25EAE61268E7CBFF,0x35B8C0353D18532B,0x5417FE75CA8B6,0x1D64ECFC6570BA7B,0x4F25B5C4B9AAC860,0x75F7D1DBAD1DB97C,0xC97A6B17BF75D8F1,0xFBEAEC70EE236CE5,0x240E9124AF3452C6,0xC244E2DB791D42D1,0x1D5FAF64B2D62A,0xB344E619D3809880,0x8E1CBBE4BF4E5798,0xE542ADE3DF804D2C,0x19258985A2D0C6F7,0x46549B04264771AE,0x640B35907106CA1E,0xB81773172B54C4A,0xE8D713C710A1D,0x5D3F63DC32EDCE27,0x6455FE0669E2769A,0x295CD68C79668922,0x2D32FC0E28724F37,0xB77F8B45C5514B6A,0x20FF36F455162E3,0x5714B74F74950DC0,0x2E9DD04750DC41,0x1909B8D496C0568,0xBD6BCF61A91FB453,0x68DEA1A4A62B6371,0xC88E4910FD4AF11F,0xCA78DD3659F8CEE1,0x8927A959E09A9B96,0x58AB890872427D28,0x3394E76946AAAC,0xE8F4F96835573AC6,0x11068D13141BE2F0,0x97212C2D48103C8F,0x3C153CD6DE51114A,0xD2B6D52739AFC77,0x9AB4D1820A42A3BD,0x6F9BC53C2997EF6A,0x358D39CB0D388B,0xFF58C9418E0F5B45,0x2AE6CC8115C06D0,0x99215BBDD1416C9E,0x3C1D206AABCF3678,0xCDC53B7D1609AE3E,0xD60AA1A8B3E01D22,0xF4D874A8B2726C20,0x318E3FED703838,0x3BA05B4E21ECD38F,0x435F9A599A820079,0x6D81CBFB4E3F0F90,0x6960374E454EC37,0xFFA6FE49C1F11780,0x7D6BE3F787ECB837,0xBEFF7CC2E2B8EB17,0x2A4597B10FD71E,0xB2E9C7AB07474617,0xF286426BC6425CFF,0x90A5FA917FE559E3,0x67DED3AB920A793B,0xE1E29D4E7774AECA,0x7B8EDF04D2A5B4D8,0x53FAFCCAE50C1CCA,0x251C54AADEF798,0xD503241A22ABB492,0xB7D3602E0E2930F3,0x2C82C3C166095352,0xA3F5B7B41D57CFE2,0x2619B01F9A58DB02,0xB010E6A4F4797282,0xA55E8D78BFE34B26,0x9339645ADE491,0x5BC38F94B6021FBE,0xE37D28D75174BF1D,0x80EAE68943CED6E8,0x5FE358C81CA4D8A,0x823699885D3CAD6A,0xCE4803B55A631D64,0xD5FE3DE5AD8EA01C,0x215C967D273291,0x859950C1CEFF5948,0xCAB99C414A6B2602,0xF086E38A715E3F6E,0xEF9FFD6344D7ECC4,0x787BB1D74845D799,0x60E985425240C62A,0xF2A8F5DB7B5E96C0,0x3B1ED2569B93AF,0x88A20879AA253B27,0x36DCED442A1BCBBA,0xC87B8D8183E0500,0xA0D960E795C35F0F,0xE56C500CE5A33CD3,0x3EBD5250F2FE8305,0x81C49271A44F34B4,0x73DE467453EE3,0x14675BB4F77506F1,0x6CBB72F1808807AD,0x4A525F658A191E31,0x6A73FC600B459454,0x3F8B5631FE61F4E5,0x1D35CADF8D9562F7,0x15B509BF3F3972C9,0x244F905C4968D7,0xC597FC1CAE350C45,0x7D2DF1388D96A335,0xF1135C1D58F2C525,0x3515FB65EF91C23B,0xDC52E63537C595,0x30B58A0108D3DF9C,0x579D3B7BA26BE5EA,0x1F1B6DF250C8D7,0x2B32FE9EB1C86075,0xE8602DFDCF446E72,0x907D6D33661F2D08,0x3D8B8F52476A154,0x4586DEBE0B36AF64,0x857CE69A559CC752,0x11D8D1551644211A,0x2D6CCACFDDFB61,0x8B291B4BD49CEAFA,0x2FC64A4A7C6EC4F,0x8717E1F538ECD13,0x3F1497B05A29F5D2,0x239693F1C8987F91,0x52C1A8A992079900,0x2F7793490DB41C7,0x242F438D1096CA,0x3B796CE149DD490F,0xDCA924D16C92CF4F,0xFABA43014DBCD025,0xE947F00DF3363113,0x483331E19E83350A,0x78DDC1D00AB7A993,0x86EDEB6F8554CEF8,0x493E759F6BD72,0xD172470928BDE4DF,0xDCB9F5EB867807C5,0x836A5A8EBCCDB936,0x769211D88F9333EE,0x5B74C9E95485B0BB,0x3FD2453F24D4DAFA,0x9C49A47094430E41,0x376310B03B28FB,0x43EB1C369C0BA677,0xF4C4F04C5AC623BF,0x357A70000815A5D7,0xAF70FF577AE4B07A,0x53E2199BFC04C976,0xDEA09246FE4E57A8,0xFE0561D08188E2CB,0x174CB45FA78931,0x75ACA19112564E12,0x1C98190ADEE74C2D,0x492CE2495DA843A5,0x4A3931F1AB3BF78,0x12D683C6CF030E55,0x576712E3D516E277,0x22613915A5D90D61,0x8161A40279081,0x681A4BBDA36240AF,0xBFF010CD44159382,0x4159408B1F347FD1,0xFA94CE1BF78EE1D0,0xE3B1EB724973739C,0xF4F6F25613B54596,0x9BF18B5298D608D0,0x266E896070FF67,0x92BC14BBCE612028,0xD42BE17A36EC5BD8,0xF21C64A17A2ECE8F,0xAB827F57654C59C6,0x20E8B219586B25CA,0xDACC3ECD32A6626A,0xDFC1E3322D713BDB,0x2D1A038982359A,0x5A1A83F4174823AD,0x51227800A9075ACE,0x6AB7E04E75B10D76,0x583D4E205817AF03,0x5D3E1EDC1A602E96,0x9F724E0EF57D43A3,0x24734605140068F7,0x135E7AEF73FA28,0xCAC5F838BA4DA5B4,0xB8107583FCB904A1,0x1FE760B7120236D,0x45336B0A30A2EF2C,0x78310856FF9C9144,0x20AE64B27BD95A34,0x32454DD8A76C211,0xC177E086B176C,0xADB8EA3079C6CE80,0x9CE810B08915ABB5,0x4FBF16BAC97009AB,0x935B374058849ACA,0x82740F09A6B1AED4,0x42B2CEBD4ACACCC5,0xA88CB7328231E5DC,0xA7C32935D46D4,0x9101EC5DF2C3F879,0x3E33A1D74FEA9698,0x36E831A1D2B22DAB,0x1F935BD70AF6772E,0xBFF1F2BB7C1811DD,0x3A8552A303A5A9EA,0xF193A4933223F15,0x2698C20F0891B4,0x2BFAACA813AC955B,0xCBD999F314DE5F44,0x54602358AC316BF2,0x57A1F0414E24ED9B,0xD20021B2F9816C97,0xD8C4D51966F84DD2,0x5D78937E60121F5F,0x2D786ACA295700,0x36F19BD72EB8EBF7,0xB5B2FF0CBF0FC4C5,0x35EF2AC1047CACD5,0xF206FEF57970573,0x8A5BB83F39D4F514,0x620C196E03264A5F,0x25F8AFB54F55E724,0x26F4D524DB98AE,0x27B5E559F1E8A402,0xD195FEAB37F21302,0xE891F0DA48D501D2,0x3D1614B4F4CA957E,0x5E81469A184A750B,0x2B38F2933D2EA87F,0xE1E5EFFB3D034910,0x1BC2557654AD8D,0xF3C0BDA14A5258CB,0x86CD6AA7454BC3C,0x1F4E16DD3768F293,0x93371157DA0AF597,0x8115A390AC502422,0xC9F2C27E03675EA5,0xA9386DC61D6AB272,0xC58756D9580B5,0x1893DFF540C150DC,0x840AB53724315EDB,0xFC9AE229A43887D8,0xFA947E1D1D078CF5,0x62BF0F94FBCFE499,0x10DF2E059DF14C2F,0x6E3CD4D273CD4D22,0x1031F21A998992,0xC745DE7C857C656A,0xCC27E41B08D8190E,0x10DC6C4D9190A75,0x585BE9F07D11CAFB,0xC3F74D2675D04914,0xF2615D13F264BD31,0x6B29F2BE60888DF9,0x2E08BA8F165E63,0x16B017E63F66BCEE,0x2C72108A540F0AD7,0x6779CE72F4CD7238,0x33B2D04C5B9551BE,0x329F3FDD75CC6268,0x61703502460D3643,0x7595891718A8F623,0x2278CD0726DE51,0x7AF89B9A35C24CA3,0x765064466A46804B,0xAF025B26E4CA0B51,0x25BC736A017E6107,0x7AE01265321D4E54,0xEEBAACCEA8D9428D,0x602857CEF14C89BF,0x32DD7D2C027B35,0x3269FE313104AD91,0xD03D81EB80F26B13,0x4FDBA7026292148B,0x77BEECCAD2C7CE47,0x24F677338DCC70D4,0x9D12B135C466C5DD,0x65CBBBC6C60ECE0E,0x301970DC68A44C,0x1F578D95C520E17E,0x910BCE8DDF494442,0x96893C34C86CD92C,0xC57469476A06A48C,0x5F26C5590F71D15C,0xA769EA6C3EAFE69,0x544C0EB9357204D7,0x3B1BC2463FC9A1,0x762780433A863860,0x6BA571E2669C0324,0x8A6AB390F6D57D59,0x4D88882D9CA3A4A9,0x90027EB59CE14E97,0x8F5C6F222F5F38F2,0x2A50E1014F9A98F4,0x107C069731C7B1,0x67FC8988CE029644,0x731B04791E8C09EE,0x8AA284A20BBBAF11,0x5712BA2AF9C61E64,0xE1E7A3E66C936764,0x6AFD2A259C4A92B,0xAFCF7B60108E34B4,0xA5A310144709E,0x2CB4D75B1DEE55B2,0x2427169449BD5976,0x269BED9097E2CC96,0xC945DA918FABEBBA,0xC8A1EB2A5B8C6ED4,0x3254AF7E1E93696C,0xDB49ABC3C51E9E61,0x11A1F790B80985,0x1C96F093D6BB0C59,0xD96B6F8838E26736,0xEC845C2017A6D24E,0x2BEF364A1DDA5EB,0xCB699BC30492E859,0x3733E438C580EEA7,0xFD005FE1DED9E2D2,0x5B682CD990B07,0x8870A69A0ED0A61D,0xD239B3DA9F5EAE12,0x4E31B8A98049FC1E,0xB90EDB07988AF1D3,0xB42481BF794865FE,0x1FBA0A22B1A743E1,0x1F9B8E47CF9C1AF9,0x1BAD534DEA6491,0xBAFCD93D63EB639B,0x37F67BDCE160E48D,0x66099B7FFC907257,0x7EB429FC87310EDD,0x95A586FDFC102A87,0x960A0A45A4D2CB82,0xE2259B661CF1662B,0x1ADDDB643C75F4,0xA21AF945CF86D780,0x6A4397397F0BEF21,0x9B6BFD66FE76D0E8,0xB24C98A261F2D5C2,0x5E287B95C622F4F2,0x185D16A79D85B0F5,0x94EF9BC265037B6B,0x357F30BD930E56,0xB69400CD8075A7C7,0x24E172AEC932CD94,0x4E9938E57E92C3AF,0xDA8A9B0428D4CD9B,0x4B27F45DCAF15CD7,0x58B206E0FBEAF1C1,0x764F3A624D27C948,0x354AD5A79B2697,0xDC70BA266CEE00B8,0xFAB69C20B7ED2ED6,0xEA807E34D890D0EB,0xD770F56EA9BF7373,0xB34EF7E894DA31B4,0xBF4DEEFB3536490,0x2BB606FFA12F5B9D,0x1657F7E68E2BB7,0x90D71AE6FC33FFE,0x6390E21D35FA941B,0xC664F99EE1B769C9,0xB4AB5D2E199DC8AF,0x5EAF54742C4B0845,0xE8056A90FF653C33,0xB0CB454FCF8B4D50,0x2D7225C05825D5,0x33EA0179203C0587,0xC4B71E3B4B58ED4E,0x1D2BD05541E803B2,0x23EE57260C9AB39,0x978EEBD88B9D2124,0xE5743F3ABA56FC5D,0xD0F58FC4CB312D8A,0x2A1F5E7591933B,0x6BDCA273B9A9CF48,0x26CA62CE1CE6F884,0x34D4A9DCE5EBA8CE,0x894078AF66E14568,0xE3013DB8B3C17CB9,0x7F66BAC17A933A29,0xB95DD150C13EE210,0x172E1BE98EADD,0xF07ADF6378DDF9DB,0x2C477EBFA0595889,0x89385DAA43695FFA,0xF63AF0295CF015B8,0x7D07268F2276F1EA,0xE64588B9389B84A4,0xE318639116CE63D7,0x3081185D36F1A6,0xDDED725623FDF5F5,0xE17576E632752598,0x25B0A134DFF6165B,0x940484CC28A23208,0xF599D78BFD2A063D,0x8B5C50440E13BFB8,0x4928E2CFB3AE0BAC,0x401F95B302CF55,0x606481E41528ED41,0x37B330A213A7D9C,0x23E13CF14FBE4510,0x29BE8E06B4EC39E2,0x8E99672EA95F67CB,0x59E0BD78FA01710E,0x313BF74DAEEE46C,0x1758EE338BC292,0x1316EF10AA5FC7BE,0x76298B9CC8877987,0x790905CBF865F945,0x1DD29234F6513EE2,0x76D54A5355736862,0xA64027E9A3507C,0xF3173C210FEDC6A6,0x2EDCCB7C7156E4,0xBA5EFF9BC5990F74,0x82D0EBE0A3A69B6D,0xD4144B1858F09EA5,0x4244363774F9BC35,0xFB049701F6D84F59,0x2A386C62F962A095,0xAD0EF8C2B5957318,0xDF512BC960287,0xB16F9DE060EC1780,0xAE382182D613C417,0x86CB5E35AFF37E01,0x9C7CAF6FFD7EB26B,0x5B897AD85C121394,0x2AFDE484C6234B74,0xF4858493823EDBFA,0x28BB5EBB68524C,0xB575C21C276B502,0x86951F357456C3F3,0x97F138980542E326,0xF08CE642BA6E5CF2,0x35F30B3E174249D1,0xF5B7878E4E94B9EC,0xB3318F5C23A24416,0x3DCAB3F64C67B7,0xD08215114B3E4FFD,0x73CF41317C61FFB6,0xE14AEC68EBE278FD,0x80733DA76A8A7B8F,0x449D215A027FD9F1,0x9FE3055D9D06E3A1,0xDD120534462F989F,0x1FA5B1FE7F61C4,0x19C55B16B147795F,0xF43EB97876200800,0x8736F821C40AE840,0xDE856CAA7D85CAED,0x939D5C9777FDE34,0xF031BF32A439FC2A,0xB1F97533A174ADF7,0x33AB4E62C8B407,0x67689EA54A9140BF,0x40B542FFAF8683B,0xFB2A0CBFBCA578A0,0xE6148F4FB11FF6EB,0xF299185A8A6F654F,0x26CD23CC4F2F2852,0x2AA61F40E4CEB2FE,0x16EA8B43049046,0x8B93B28D108F877B,0x1BF1EFFDE73429A3,0x29481B4E9F5E757C,0xFB697FB603D2CB28,0x416FDE897F029369,0x5D263D6EA954D8B3,0x76A389D8B3908551,0x33F3F689470611,0xD0C7601C7ACD7D3E,0xBA8B73E7EE79EC72,0x77C7D23BFD1865,0xB24704BE3376E580,0xC150C52DD274A478,0x312B0E88391F63C4,0x6FFA25DA00F02643,0x15483967B034E0,0x2577221796FE3FD9,0x1C61C558DE23B6AA,0x50943ED48708B282,0x678D1EF2B0BF13CB,0xFBC319787F4EC4BE,0x8CA18841124095EB,0xD2D0FE718F707D5A,0x3F4A743B090B16,0x4B41DB3C8E979716,0xCDC4D5AC75E2DCD3,0x3D66CE225260B23,0x16CB5D655E870AED,0x294A7DBE7B76F001,0x5F1D6D2B83AD9FBA,0xA5C37A87C61171D7,0x248E8F31F8B248,0x3F2C6BD55DCE1E1C,0x237217B590A64B8C,0x88CE12949EAD956D,0x150678F2D821DB03,0xE2CF9DE37AE3769B,0xB9D36211D7FEC238,0x4CEAEFAF83569B2A,0x2F2146E53C90A8,0x5323DBE478DE1BCA,0x9F0513DE4DC6A8,0x62D555CB680D6073,0xB8BB43E5A220524A,0x3AFB026E911F7F15,0xA96D2A955F827095,0x4FBDB64D89141CBE,0x4ACCC1AAD4E0A,0x7263D2A6C5A64478,0xBCA2EA3F38E58B1F,0xA3F8185614F10023,0xE7640830396A9B50,0x6D48B96DB0644668,0x74A43A3D09C82711,0xF3B97152C94DF3AF,0x1995CA9C8FB993,0x6748F1A9AECCB15A,0x346A16BDFA839A68,0xDF64E56FA476BBC9,0x4EFF93C3ED9E3834,0x26C6AFD7A0A0DCF8,0xFF1BB950EB997C9C,0x3076BDFC33B293A2,0x2F97E7630EE907,0xB5CFB75D827D5473,0x2F35ADE60C75036C,0x4E132BA5AFC8C946,0xD2D70B5F7ED5890E,0xC402F48A842ABD3B,0x9F5C62456E2F6D02,0xA74A6BDA84232719,0x2F1EDCA7F17243,0x8BB72FF78C904F14,0x5668E12071175F64,0xE20D6857572F89CA,0x8E72B0C795ED0184,0x8598D332CF40C1FD,0xCB99BC9CC9187EA7,0xCE9356E16D8388E,0x28BD723A62D14F,0xBC4925017007C28D,0x38EF5BE711B7CBAA,0xFF33FC935AC3E2F4,0xDA30C492C301D99B,0x822C89AA284E7B44,0xA7E9D563C150507,0x5CFD378C4705BCA3,0x2CF2A056577BBB,0xF8B27CAC37E67F26,0xAAE3146D38460B01,0x9A97DDFFB8A40516,0x4F719F0525C4FE2,0x9BD62CB9C2E2A9A4,0xBAB281063BAE8B0F,0x81A908BB20B98F1F,0x155C106FDA3714,0x7B21621FE158B095,0xC46838332E76C163,0xC37C7026284DF410,0xCCAF241D62B3972E,0x9123A41D1E12005A,0xF90ED47F80C8EE51,0x48C4E190009E15BD,0x1DDE032C1FDF85,0xA731AF3882B741DC,0xEC5C00E2B4D1651E,0x74A948EE491BE7D,0xB788346DD7FA461D,0xF92C2ECD141C81D6,0x20E79DD326A56C5,0x83DB23BC53DEFEF2,0x3704AFE3CDEAC0,0x1EBB9ED34710F79A,0x6239C74048BCD2B8,0x15FF4FE8045F2FCE,0xE5BAFDA28CBB2AA,0x9630560B363FD863,0xD1832F367A326ABF,0x11ADE34CD7EF0DCA,0xA959FE95D1461,0x4101790C51964F97,0x8A8B77E57635BEA7,0x91A4048DEEBC229A,0x17AD50335BB8D9ED,0x5B6918D11872097F,0x664F96DD297F5E5E,0x5C6CA60E288D1BA7,0x320A1A2B16BDEC,0x90F7F1835AE4D868,0xF8F9106E6041F3FF,0xA394957B5F3A81D1,0xFEB0601638FF3128,0x7286B43FB253E2E1,0x29A53415A6B515EC,0x7494D97319E5FD2,0x18CBE97689EE86,0x7B42762076C5C912,0x30F27A56856E3CEE,0x805433A3B3840920,0xC299BAF1A3001762,0xCB9356957CA1300D,0xB2A70B10DB90BC76,0x4A9D64677CF85AB1,0x33DB1352D6C0F5,0xED268B7F54689C9E,0xDA1D40375EA1B432,0x3B82C9F568B4617B,0xEFD204DC1B2DBCA7,0xE8D35F09AA705295,0x55E241914C340D9,0x349B8E1185B2EB5D,0x349012BAE4A621,0x976607A0BF9690D5,0x21D5948E841C79FA,0x908F1187C94E5533,0x69C539F458A9E262,0xD191DA26667A4CDC,0x1E8499283BC25C47,0xA9D7344421DFD344,0x287848F812D847,0xCA82898C0AE2D708,0x82E91796311A6AE6,0x2E97FCA5E399847D,0x7507F712E29CCD1A,0xFAEBC8F3F6E96B9C,0x87460F8B6602BEA0,0xA61434360CB5DA9F,0x3CE9270BEDF719,0x90FCD82CD6B0B07D,0x273DD3367CAA575A,0x770520F38278D23C,0x57B55C49FE51183D,0xB3C8D3E14CBB1664,0xF3B99AD89AA02490,0x74EC852786D5488B,0x2EDAEC4B4AD590,0x261D4AF4D4812CDE,0x1F7F6F0CF1DBF2E6,0x7A9BB69B6FF02872,0x66799EC80AEBED5D,0xD9E077DABA39A9A5,0xD98828ED1C1E656C,0x6B62FE73D779016D,0x1433B3A587084A,0x4806017B9911898D,0xECFBF96FE313488,0xD7583F3378D614F0,0x9057220581D001EC,0x76FE3911D83BF101,0x29989EAA3980789D,0xBFA7D29238041FA4,0x3F9F5CADD12D66,0xC7CAE2C2516D534B,0xF2A1CE3C2154311B,0x3F4C80CDDA6C0DC2,0x574A21D5423043BF,0xAF5372C1751D89C,0x867B8EBBB8C70A9A,0x93DB221FDE4688FE,0x2F0A74212FFF5D,0x8242B4509BFFBDB0,0x27B28ADA922CAC0,0x3842583DC37E1F8C,0xC2913A9D59599D36,0x917B147910359AF4,0xF99D2B19AF549A8C,0x3AAC90C9FE047BAC,0x243899130E498B,0x320A6CD83EEB3349,0x4309A0E16F761129,0x6F61A500F52E3611,0x7E1FB58804E3844E,0x34F9392144A727AF,0x8543A609FF110F5B,0xDEE669D741C6D287,0x17693E124A8B98,0x6ACE0908D0C19235,0x7C9A5D2025400D3A,0xA9B299560CFDC998,0xC9A0832D3919E546,0x587515B12579CB92,0x41CC3A94A012CBDC,0x773B34A0E2D69B17,0x19792B9FFA62CC,0x23A8AB9FCB7AB70E,0x6E360CF4BB548573,0x8204C0A13498424F,0x2E8700FE023EB9A2,0x71DD40634DDC5868,0xD418218C18E28C03,0xD83556BA7D4B2F71,0x2FDC8292BEC922,0x9D08295CC96A69AC,0x5655CEDF6352AE85,0x13A574CD8B81CF0E,0x4F970F4D47979C7A,0x575CD7C2500F622,0x4E2EC50E2689E051,0x93B7EBD6C5A8F438,0x2D98DB954312A7,0x9AD618C930340C7,0x9598D8FF9E6D915C,0xE9B8E5AC8BFE06CC,0x83E6BA259F6AED4D,0x884743CD4D352CB6,0x4A5E018E0B2D019E,0x484D96E78DED2F14,0x1F2B081C2A7C13,0x6B39610A928AB021,0xA8658050DB7C6F2,0x7D22EF1324066FC8,0x95B544E514347FF7,0x369C03460177DA78,0xE99A3ADAC75F9BEE,0xC7E3CFC4AF2EABCC,0x3BF6B63B21F488,0x35AB50967625BF6,0x99CCCADB011C0955,0x69FD1860363B7DDD,0x79E4B85370AF397A,0xBD45BCC88D82A7ED,0x6E8795C217771A31,0xBC0131A00C66BC54,0x30164EF2134F58,0x3BF8450DA965C01A,0x3F257C85A324832,0x21D52D107E25D73E,0x74F4B7ACE5FD5913,0xD1252C23822CA51A,0xB4BA15B687966504,0xD9D9E7D50AC90791,0xAD7CEAA5FD62B,0x292A9F2C162894C3,0xEEF317B3D5F55D6F,0x8255A2AB728E275C,0x4F0C84E83B450B2E,0x7849703216EBBA32,0x838E471DE3641794,0x80396830DFE1661D,0x34677865DACC56,0x8C769F067D4F6D8B,0x21232AFC94C96828,0xFA24DCD7489D1BEC,0xD08E0FB4E5FB17F2,0x20B1F24E82F5354B,0x633A60F5FCC67F7E,0x2FB9D1D3F876ECAE,0x2076CCFE9AD0C8,0x33CFB2F79623F738,0xDE2E47315BE716CC,0x80FA38DBBBE99999,0x387AE36CD770EF7F,0xB036EFC30B82F87,0xBE29068389624D3A,0x95C14694B5D8335B,0x24AE176C90DE6C,0xCF99A3EEE7FF907D,0x4ED65BDB99FBB731,0x2FAE48EDCE1ACCF0,0x22A101984E010F1D,0xBB178A10FA25D43F,0x61F9AD32432092D3,0xC713D895E2E90895,0xFCA82E5315FEE,0xEF650A7A980D2DA,0x7C90B3018525AB7B,0x1B6D96B664EE3D65,0x289BA821FFAC0F3E,0x8D1D0739FBA3317D,0x7AD0CCE71F289399,0xC99B8A673A9BB867,0x1318D302CFAE80,0xD375167059DDEE3D,0xC39BB22E8E808E93,0xA7972A0F5E405668,0xEC625CFF54CD66F2,0x36EF66C387EB113A,0xBD711808C7B98AA8,0x7FCF5CDE65941527,0x297CB63567488A,0x29499060D3710ABB,0xECB56B9C346C5DEC,0x80AD25DFA42B5DE2,0x9513E0D29A4C14BD,0xFC17DCB031B21332,0x30DA7AEEC4C7BB4F,0x8E88AC06FE870444,0x292CA88A33FD4D,0x538E4E33AA4C0A0A,0x5973501ACCAD98D6,0xDD12682620DC5AB2,0xA2D6989B40FA11AE,0xEA1F7DBE43188109,0xBC14DA1EBA04FE6,0xDBFC8FE4EBEB9CDA,0x4E323F66F426C,0x83A310A5A5283B93,0x78FC14DC96638813,0x2A3CDA8E77175092,0xAC0DA5C7964D0614,0xFC168B726A7B3D65,0x5D426F7773CE3955,0xEDBB3AF673FC0263,0x18B5FBD685850D,0xCDE3D7C4F766675B,0x755D9C5B26B05101,0xFA9BB3B4834ECE24,0x7DD402037A9E17FA,0x45DBEC4B1FEED47D,0xFF91CF38227B9824,0x82D3FA5FE1B79D3A,0x28163E670FE00C,0x4F68FCF9B1790BFA,0x8B0235E8E95FF604,0xBE982C99F013B94,0xD786FA655BE63236,0x71D4019D047DAC0,0xDDF4F57F29670455,0xAB87787ECDA07222,0x36B83A069EFB45,0xF29238E3D5EF59F9,0x32FE4B327385AD26,0x61B0769BC73EC11B,0xCD4E2904E8F0FA6A,0x1870C6B8A945F327,0x34CC56AD08F0473,0x8568B2F81389F6F8,0x3F2169FFAE5CED,0x4A6320DE2116F322,0x86E0CF91E1D38858,0x38A8AF678CEA782F,0xA8FB57BE0CF2909,0x6B65A96CB3BADF8A,0xACAD0F5CC9FF9D1B,0xA8A4D6F0CA2BDDEC,0x433160E148813,0xDD023FA5D8FE7DA4,0x9965169539226BCD,0x8ADF46A2E692A447,0xC17DAF2DD0B12466,0xB036D11A9D78D481,0xE9FD479641E6DFF5,0x63D13AC1AB21B37,0xCFB38559F2DAB,0xF430E3C5BEA524E5,0x4E4FB4744DE7DA24,0x16B7C1AD6DE6A6E6,0x9F4FDB09A45F1191,0x5FA1036C824469B2,0x2F5D5C3DAC360B0C,0x47C6F5CF15373061,0x3AD61F93C7EB4B,0xD13DF6B25B4E32B9,0xAD03793F51202EDB,0xEFC862BBA073B0A5,0xF90ECA4C2E534A08,0x4495A28164DE36FE,0xFE013B34EBD2AC98,0xF9A321EF1AD9AF2,0x3401F8229F08BC,0x72CC4C0F1D9E831E,0x3BDD6E84FD8F5A78,0x26D2867DBB4EE2AA,0xECF2F7660ED8D197,0x6A195CDE6967E34F,0x2FF9F037C4A62123,0xF1455C7EF03554CC,0x1B5A8BBCA9C177,0x5E645D8428A0AA1B,0xB559E0D1B196E15B,0x12D1D26ECB361DAA,0x3B5D9DEE2CE89DB2,0xFC21E16D7750224C,0xDC7EE40AAC951999,0x580912EE29BA0C3B,0xD11044B6C2628,0x93FDAE1EFCEF3438,0x3DA86F83FBDE694A,0x1AF2F85ADF9D7519,0xFDECD24B82D74C9,0xA052D036B0DD2B07,0x13B8EA6B3840EFD1,0xF1F4E8469CB14031,0xF87411C97FF0B,0x644990AF809A3376,0x5C566B31D65E2AE9,0x225AB25900478D84,0xD67D5E4DF3C480FB,0x42ADD079EA502AFA,0x28014156753D450E,0xADA69BD9A51C8991,0xDAFC5F45A6B8,0x12C2A00BBDDC91F3,0xF3C02B3F55A4956,0x1FFB90F42C61EDBD,0x6B5C411A91A05D72,0xC79F4159433EC669,0x4B93637C36167897,0x5321A2B83C237AF5,0x22114CB9C72AC2,0xAD2B95BD7B542926,0xA0F615D49A076B57,0x1ACD5A9BDB672880,0xABFB9A877F4E0B08,0xF6D476C1BB8F5FE1,0x159173361B188500,0x2FB273B1493CC544,0x16196C4EAE714E,0x3782788CC9693E3E,0x3557AC7BE9C41C19,0x62AFA18F4644D968,0x69CDB64B11CCDFED,0x10747F20D59C407B,0xFF4EE1D277DDD4DC,0xA434421834A741AA,0x3DDD4EBC10202A,0xA4189A2825D159E1,0xFCB0B7E9D66C21B4,0x7CF9C7EFB9E5A800,0x44441A38ED2BE26,0xA41978EB45928498,0x8F21ACEF572C1FD6,0x41218889CB9BEF70,0x3575CE8F05EF33,0x415019EDA11EBD2F,0xBBFCABF3167A7558,0x2E30BF4941645984,0xDE8BA0845D40E8E2,0xACD515B533F002B2,0xB5CEB503099DA2EB,0x7636742C549F0CF4,0x1A2626E92F675A,0x7407D2B9758FE5D6,0xB01F8763E8288467,0xD947C84098BB96D9,0x3C53F46FEF98F3E6,0x256FFF84693DCC,0x6A1AA0DD98BE1EFF,0x9EA3BEA2EA05DA97,0x3593099ABF1588,0x62DD2242BED177E8,0xAF916F080362D8FC,0x19E280FA75C2B996,0x9213E4FA437ABA3A,0xEEABF3D6516AC164,0x76DC55AA70338B6,0x32D063512C902DBF,0x28EA4E4BD33FF2,0xDC345C8620E83DC2,0xD48E115183A9890F,0xBC458642C3D986DC,0x3759409874750A51,0x1A0EC369C0B052CF,0x12F74DA8E9679A16,0x12528641D18A7314,0x2AF97291599780,0xD8DCE22BE613C38,0x3C6543CBF1347619,0x64C2AB74D4E2A2A4,0xFF14E27C659747B9,0x864A18E8486F39AF,0x28D427286D4FA8EF,0xF3C32E81A9324DC9,0x223E06C1F5E94F,0x805441FCFEEE9629,0x3861C24A19418231,0x343BF8F7600BFA28,0x8844A75CF6C6CA2F,0xC976CC7CB0779536,0x7FBA4F212FE9FE63,0xEC075EC22E6DAF02,0x27B69211C1144B,0xE4B75677BEA7F2FC,0xD81C3F65D1217C2D,0xF98D5E92A56D24D2,0xF61B2F59F65F061B,0xE63C2C76D4A352D2,0x534079ACDEE1887A,0x724AA3F8C5387679,0xDB07857D554BC,0x9837CA18D0600A2A,0xA0EFE642D28416B1,0x83F85EA27141E336,0x31BE83893A4AD25E,0x4E1C3E6E5C611C70,0xE3D9CFE0B9E2A0FE,0x3D62C3F502B429CB,0x1C1439DF5A004D,0x3C7AEA147967DB3E,0xDD9F3F8F098756C3,0x6364A017E921FB69,0xCC78CC3BFDDCFDF0,0xD4929FD153388737,0xD7E5E0C89E23DDFF,0x51E3AF93CE6DCB27,0x17934C421B6397,0xC2F002E2FC0014B5,0x63B777E1286F1327,0x1849B0A5D434F026,0xD770DABA3153F8B0,0xEF6922F88B65A9A,0x62FD24B1FB0FE8E7,0xEC7B5A48906A42FF,0x2F9889947C2B71,0xD94F25F52412D41B,0xF6B767AD7B51CB2B,0x5CB5F6A2F853AAAA,0x453636513BE9E646,0xA50820D95395663D,0xC8D439ECF399F323,0x14E29D440910B3AD,0x269F7D20B78EF1,0xABE285110104121A,0xFBFFE565EED1B5F6,0x2040C8F8C21BF6EF,0xDE0D3AE77C158C9E,0x7F39D1AF40917B5C,0x4F04A7ECF7D3C669,0x4AAA52E4DD1F1854,0x2A5C3D7FD4FB39,0xF3A3ABC8833287CA,0x9BC04BC0C0046EB4,0x52C115D42EF71BE5,0x1F23EFC22EE060E6,0x2E6BC37F29EE2804,0xD11E8EDC04E48D91,0x7623F21B1590FEE8,0x23FF6417FAFE42,0x8211F2193369F1C8,0x162EC7804B83C200,0x6B74A73901F8D19B,0x7178FDAF3C7391FF,0xC3FCBF7BE0B890B9,0xAB682E7B07803AB1,0xDA297829ABBC9178,0x25A439F955043,0x433D3A8A83ACFA28,0x53DE562D6F4164C1,0x913BFD2791FA922B,0x8F2C8DA463B24624,0xA293E6DFF4E30AFA,0x20A87A34466F6D66,0x54B3E78754A48BC5,0x9C704EE9C86C6,0x69F225A507365243,0x41344701BDA179E9,0x5F003E3AEFA8AD8,0x935FF45EB58F53E8,0x2BCF3CBAAE536074,0xE3D94BB6D08E5476,0x3E3B5B2F513970EE,0x202BFDCD7FEFD6,0xF70BEF71B171B8DB,0xDA76D516BFFA1CB0,0x978AE0291C16383F,0xDCEC7843DE620DDA,0x120F79DF7292C2EF,0xC45DC3B4CABF5268,0x92FAABA3AB2474D7,0x343F1E38122D4,0x81C44B1D9FCFD012,0xD5F09B4F43549FC,0x855857BF2656E99F,0xF72A9A8F52776C24,0xDC4F759F4E9B36C2,0x1AC2467971EC84CA,0xCE732D7F4A06D0FC,0x20883031E33DBF,0x452EFE76ADCC28E7,0xCAEE897904356ABB,0x30418B9537E5F601,0x430DE05F733C2C94,0xCE17AF3217FF1E54,0x792C1F68B62DD140,0x833D5E72EB9EEE1B,0x5EC0803A16BEC,0xED5B5ED4AAA255FA,0x7EDDD920D9E4DF8E,0xDEBD271942E79C43,0x9BF0CA44BA11F340,0x515D6E4BD54120A0,0xA0BE931332014859,0x67BCC5EAD13812B1,0x9135677DABFDA,0xF2E809E42D0FE7A9,0xD162113EB08FFAA3,0xF390E0613D0A3228,0xEBB3E24BCD2B34A6,0xFD2E18916F7E4B02,0x65B2209F3A005CCC,0xD0D2782DCB008479,0x7CB8095D48F46,0x5892615C5D86CC69,0xA511B4D16A267350,0x2E3009C755955D12,0x1247A237230BC42E,0x8BAFD761141B501F,0x7C5C33916F34B31B,0xA9D08AC16A95726,0x90A13ADAEC445,0x5AFC70F8C1222E39,0x462DAFDB5C8EA695,0xB096835C442AA482,0x83E4ACE15DB1455D,0x28B9CB6634AAEC80,0x64BBD2D447C8A567,0x2DDECD7A582B840E,0x229F21D2AD563D,0x7DD3D2340F8CF58F,0xDF4720EE4E13DBBA,0xA5B41CFD81BB50CC,0x9E80A97F23A5B7AC,0x2E060BFB754B4934,0x87493E366E64B5AB,0x9498AF41B72B5DCF,0x3B0FC55EAEF2D3,0xF97EB225230FAB5,0xF4A2A5606779DD3E,0x49A1F3632DF08F56,0x500D419ECACB9D7C,0x4AE446C0DE6FEC98,0xBBBC6D5F5297C63F,0x306C0501EF160550,0xC9130F006A225,0x3CC6E6697EA0F827,0xEECC937FE86CF8E2,0x89DEFAC738BD25DC,0xB17E4F9610AB4B52,0xDD3BCA1042CFEB10,0xDFE224FF1B516030,0x3624F1E22F264D02,0xB61691B7A7959,0xDD8DD2C098407BDE,0x4BFCEA4032B539D4,0xB2899CEFEC9405E5,0xA3F452C7C3DCB87E,0xA8C4313375323A14,0xAEE59E29AB4F62B0,0xF380F9A1A6A81EAE,0x23133869C6A7E0,0xCED885CA6897FEB,0x459D15104E9BB5A6,0xA2D2DFCE37F4BE77,0xEC553984101EE56,0x7A73C725C79E0B8,0xB49AC04EDE7D31C7,0x6DC03FE5C03E08BB,0x3F0029C0200A3F,0x912CB02186640490,0xB9EFED1B48803C93,0x8CFCBEBE2F9F555E,0xE477621ABAFF7B7F,0xE95A7C0EA2EA6F10,0xA38753D8807F91C1,0xFC063DCD93F73DBF,0x3AFA464C3AC6F,0xF37BD638EDCCF3DC,0x103602E97C7BBCC5,0xFF8BB7C90CB120D7,0x3CEEEF8B33F12A13,0xDEDCBA7A772E8D08,0xD11F74E469B1301C,0xEB69A2F093E5FB02,0x3014911A0DDEA1,0xB7A65ED834F6F16A,0x260CA4485C8158A2,0x8F8802EBBF6F0D01,0xECBB4DCB02F3FBCC,0x68FD6A7B16182915,0xEB9B623E1BCDA856,0x5C7D9799213D2DE9,0x2D424FF3B0C5BA,0xCBC38759188E4AF3,0x1D91F254F4B9D0E7,0x368B6E8660DB8456,0xE5341DD80F62977B,0x2F66B28F34767B36,0x8BDB060C84A86D47,0x67B4175366017FF7,0x10E86F57E33126,0x27833BA6EE12ECC9,0x402CC8299C61FE34,0x894E549F5810A908,0xF8F41E01D9E15076,0x8C3F84D91916AA84,0xB67314EE8B4A5F1,0xD25477E80486C660,0x2A2DE7BCF6E8DE,0xA9291BC3AD42D82C,0x2D8631C8A4BA8FCA,0x252DC532EA4CC24B,0x7F9EE6CB0916BEA8,0xE37A20AD0083CADC,0x2574F446FCEAFB9F,0x637AACDB6A787ED1,0x37621D422B10E3,0x34565238872DA0DD,0x34378EDFFCAD5833,0x2940A927CD3B2B87,0x4515B4116A6A315E,0x5C94475F58AE4FF,0xA0595D8F7B81594B,0x461247F34B230409,0x3036B1993523F3,0xB17BD9D27A0A80DA,0x8A321D36B7FC463B,0x797D3A7DF057DB3F,0xDD1E82FB5FAF4A84,0xA6154CDFF59B5979,0x5B030EC7D9EA8118,0xA14397D7D319240B,0x1EF4493B3CC722,0xA738C594CB451397,0x62DB69DBEF5CA275,0xF1753B10DF3E9405,0x5C1157DCA3EE7AD,0x62DC07E1403EA0E3,0x4262741C1922D2B5,0x8DB101876C1BB906,0x1EC63957DD9DF6,0xC50E8811ECE805DD,0xFFE021488E48D838,0x3BB6A59371B41C5C,0xE06EC26B2AF77812,0x5B682336848D495E,0x8ACAB154E8E5D3B4,0x9A084D32721D6145,0x2C0DEB4FFA5F80,0x4A58D86E159F74D4,0xA2CCB262F07731D7,0x44373B3F9E3576A,0x59CC51A2D0D7B37F,0x44C94695BCE57B26,0x578F9AA0379502A5,0x98826F7757D85C40,0x1FF23E84BD3F14,0x4278F7C5C09CEA52,0x306D97F7C3D78A6,0xB3146B547B9C90E1,0x75D2CA489E42E0CF,0x7112AB46D544BF97,0x274F4FBE9C9AFDB7,0xDB0252649274471D,0x11A1E3890B3F4E,0xEF6A9707B8AB21A8,0x2C70810C7119DFC9,0x1966A0C4A6615B1C,0x55967181D561BCE0,0xC19F8BF9ABC5489B,0x6E9C2AEA9C7D51E3,0x9F2421DB6FBC56BE,0x1B357737408DF8,0x64CEFFE2BE2778A7,0x3787F2191214733,0x61E5021831255F7,0xF8872F489E16F926,0xD156A6BE25E04409,0xE178C6EDD32BE188,0xEFFDAF6B8EF30CEE,0x8855C9C763C7B,0xB8A008B48213E5CC,0xE10C841EB95B7C41,0xC6366FBF3C62EEDB,0x5343CB88382FC289,0x9FA7509F476852A0,0xD1595BD6CD9613E5,0xDDC1FFCD104308F9,0x4A0D0C5B704A4,0x3911820509CF039A,0xDADD7DC578E498C9,0x51BDE989A1F9C4E1,0x8A0DE7F741FFB1C2,0x306B7302C615C8C2,0xDE1F98FF933CA28B,0xE7EC08EA34B3C914,0x1831E1EFD8AC3F,0xAE7BD29CE0FC09A,0x8F3D554C858606F1,0xD332A0A3A7F175A8,0xD1D36064C16846E1,0x320916A3FE0B4B1C,0xB109AE65B9E97B4,0x381DF5A64306C092,0x342A6998CEE0F5,0x2AF5870B418BD69A,0x40334E903C5B9C0,0xFB8320B3C2CF6920,0xC20251EE1D3F64B,0xDC22BE400F374D8C,0xE34784BFDDB0A55,0xFE3233C420481C96,0x583BA9759CCED,0xE2EC594DC0302FC5,0x69E03616347F5D5C,0x13C8EADDFC347684,0x50D2D1FCA87A5C59,0xA2D36571F079A6BE,0xF696B37E73B5A641,0x87F2955524CA3B67,0x33D986382E288D,0xE9A9377AE9C29E29,0xE12EC2DC9C65A999,0xC347933D6E052F2D,0x337CE741382F24B7,0x58D30C9B496AF21D,0x324A1E33B113AA2D,0xE47BDF9DC6EE8E47,0x2B9E0F8AD18012,0xC09DAFB2B41D6DDB,0xD72B4BBE1ADF21D1,0x2A02147C677BCA0E,0xDEFBE873B4DE214D,0xF5150E6D6D3C9C27,0xBE125C5D494ACC97,0xFC0549C18C86D7F9,0x1B9E1E03FF02D8,0x91B17BB6FE6E5436,0xACF938302A7CD0AD,0x9F894E8597975DB1,0xA952D70E00BAF2BB,0x63B2C26F0C15B605,0xE195DF0930F5821B,0xC2D756CF7F39B6,0x17799FED93F2A8,0xCE970059361ED16D,0x30C2E11CC95BA2DB,0xBF2CB64507605CFA,0x5823E787AFF23083,0x8C1FD7DEC5662673,0x8B18CAC50CE7A772,0xBF505A0C47A1DD84,0x4ADA2F230D7C4,0x232A18F24E59866D,0x6C534433EFF79C75,0xE476C903DB7AA16A,0xEFAB15766BEB61BF,0x98E89ECB76EDBFF1,0x546A5E2360DAFF47,0x6654BC24890C9544,0x121A8CD055C2E8,0x160E679FF467DB3A,0x2E3640D7F9D41F81,0xEF79EC7FE2417219,0x8EC4966E59C9C842,0xF39C8667A22CC462,0xCA35E838820E9006,0x3B467C8E78EF02A,0x1FA4AB66709713,0xD912D47090918039,0xB10682E3CDD3736D,0xC9331DA1A32FCD0B,0x120E829F74AFC1AE,0x3C7B2370762F02FE,0x83CF8A89E3B6484F,0x31390A959C3C864B,0x1A7FD8AEA7BBE2,0xDBD43A843471FC2A,0x48B835D64A7E22BD,0x2D9E937CFC1F81E3,0xAA084E33C512FA45,0x27EC71CD5962D27A,0x312136DC78F00958,0x15E797DBE0D2EEDC,0x138FD914B1CC3E,0x1EB35152575D15BB,0x76DDC22027EC230B,0x6B9B7BAFF393FE54,0xA53F5CB8FC13A1F4,0x862BB0FD541B395C,0x586E63B4C00A56FE,0x8D4B4604D5C31E85,0x8818B7345AB78,0x1D6B777DA600F5B3,0x15AAB2660F8077E9,0xA0F1B8A23428E590,0x43821B573E1B83A5,0x5DC6D8079A739E5A,0x423B4F4F46106BE0,0x492E02B3FAE0985A,0x3C320DE43D104A,0xDEDFA9964F90AB1C,0xE301D9DD810219E4,0xADCE13765EC31220,0x1A42F507E3ECDC46,0x9DD415607186D918,0x1409CAD167901282,0x423B122E21C36759,0x1EDC50612D3133,0xFECEC24BA9DA8C58,0xAEF80A36454D4A69,0xA113C434F31B805A,0x71EC83B82B6F348,0x5865E36DCD8C435,0x9EED85177FEC1655,0x8F5CB681351310FD,0x3F927FA5EB22AB,0xC4523E5DE3DCCBEE,0x99B4AA7C7203CFE8,0xC042CB0704F850DE,0x7844EBE4152EA612,0xE6E055037EF71225,0x9D37FCEA77267794,0x31A47839AB99C923,0x216597A82D16F7,0xA510A89A28E80484,0x7C35801850320E82,0x9E0201DC8A2598F8,0xC3AD664AC0D13837,0xF9F2275A3B8E65F1,0xFA6F3248AB4064A4,0xAD2069004C4EB521,0xAD59DAF6DE8C3,0xAAA43C74A21D8344,0xFCD6C75C40470F6A,0x8DD13B29D1A257BE,0x65D8B6004CAFCB71,0x188EAC9A0405D683,0x4EF4C54B9D014889,0x891763AB977F5896,0x2274AD3FCFEF,0x77D2396E78884781,0x738C1A88EE40D48D,0xCD07FDBC13F5EFEC,0xFB48CD790EC20C55,0x8F3D5DE068F7055B,0xC74667A8034539FD,0x5995F205B35292A9,0x28EB6192CB23E9,0xAA9337164D1A9BAC,0x7A723F772E098059,0xEF5395C3588A93F3,0xE8731EDE0A5F323E,0x5CB03B4C4D5AC193,0xB4D18C31FFDEE4C9,0x3BFB81D344B75E81,0x2A48DBABFB7DF2,0xA64D5525AE9B547D,0x9604F80B26FFCF25,0x8592A7FDC8709918,0x2B83028004F55393,0xF94E6A39910FC080,0x40E29044F882DD00,0x3C22EFB7C9BCED63,0x1661252867A8CA,0xAE110652CF96C0A6,0x78FA4824B1A9B477,0x2E53B8B58E5A79E1,0x5FBE8C066A376964,0xDCDF464CA43E464,0xF1549A4B49F4A22C,0xBFD99A95BB92DBAF,0xFB15E0E9347FC,0x8988BC18177F0FB0,0xF9495AC7B61EA073,0xA6A64E8CB021D0A8,0xA298C9065F1CB10C,0x4CD5AA84911725E6,0x10EA5AB5FC07DF3,0x1ED7C07EFD3D4427,0x1E0C262DB5DF05,0xA7C4E3A3D2C50A76,0x70F6C744BB3C720B,0xB99B604D98B4369F,0x258E6215205EE3DF,0x7F2B6D2A0F98E014,0x607637F5298230EC,0xD4C41B96A06DBF39,0x17EA8EA160F1A,0x86FD3B3F401248F3,0x4E85E9E43EB341B3,0x2FDAA5AC372104A6,0xC230AC6C13B8A083,0x2BF0242086D7EA64,0x1325AABF5DE571A1,0xE9DF21ADF68253B0,0x360E744A203906,0xEEEF1F5A3BC53B04,0xD208D291B704D596,0x7A037B52A674DAED,0x55A229AFE41B76BB,0x69E759B7A92AD141,0xCA34ED6C7C862EEE,0x6160DA46D873D96D,0x1B95612659B032,0xFFFFFFFFFFFFFE03,0xFFFFFFFFFFFFFFFF,0xFFFFFFFFFFFFFFFF,0xFBFFFFFFFFFFFFFF,0xD79EA0B5BD998A75,0xE519AC9D8A7FE518,0x6ABC277B5FE2B1C6,0xCB5A33DB8E265,0x8B314DA448916AA,0xEDFBF2D66CA2F803,0x6A1816BCF0E14E02,0x27B4D9C85940A5B6,0x23B534D9BB88546A,0x7966455F91BC3C8D,0xDF14B2D53614CCEF,0x144BE19EC808C1,0x9D2E8A3C8B7BBAE1,0x68C1E04576CE9B8E,0xA286C6D6CCBF7976,0xEBC7056027346537,0xD23421C663E91261,0xF2F10BF520278064,0xC0C4D3F1DD9A0713,0x372F9D243036F7,0xD03BCE07E4682549,0x5B2B10718F18B28B,0xE67FFA2B2E0DC99,0xB062CCF6E807D4C7,0xE3BBA8BA550F97E4,0x71C689B7BC7BD7EF,0xD415944202B0BAE8,0x1313D5B31404B9,0x590BCC6A427FFA9B,0xF10BF2D23A60E7A3,0xB867F8D11BB549C6,0x71E51BA262C7CB4D,0x7B74352818990B00,0xF3EDF896512C118A,0x5885CA48BCD16D1E,0x268FB6710F4CED,0xC8E53A0D83345F59,0x8DF4ED673A3A5826,0xBCD4CD739F1247E,0xB74B6D0D3C720799,0xF45FB3A3C023EE9C,0x680863EC3D709C18,0xF2CED0265921FCB0,0x23094DCA69FC05,0x5AE3E88EA78A1F29,0xBB02FDBE93B2E670,0xD95993CD4473E68C,0x255E35447853B923,0x273BEF43D63B4A8C,0x5767D8347E8E0808,0xF50BE742B61F4B3F,0x2ADA45B4AF70C6,0xE9BEC7F4EBB9F4B7,0xDF459DA83FA5E48E,0x6E10EDAE89622902,0x9379A0225508C351,0x39F5FB3B6D5EB9DF,0x6FB894294E4CA846,0xEE7AE919EA70B75C,0x2EB2BBA7E74F23,0xE31D1DF75E8FB3FA,0x103E655EC18D1CEF,0x94F6006761E4771B,0xED09CC3C306CBB72,0x89D8D69F7D8C7C52,0x59E65CD7CCF8DF0C,0x598F6BB7DAD65D04,0xCA5F5FF481171,0xFFEEFAA1AAFD1868,0x7D9B781AEDC270EE,0x61825A9986E83C34,0x829A68DDBDAF66CD,0x44218EB24954EB10,0x65DCC6E662DD9C40,0xB2E41E27AD3805EB,0x2A2666FEBBAE02
-			};
-			const uint64_t *ph3_T1 = {0};
-			const uint64_t *ph3_T2 = {0};
-		#endif
-	#endif 
-#endif  
\ No newline at end of file
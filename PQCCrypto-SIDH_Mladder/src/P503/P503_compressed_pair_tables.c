@@ -1,4936 +0,0 @@
-/**************************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: precomputed tables for pairing computation on E0: y^2 = x^3 + x when using compression
-***************************************************************************************************/  
-
-
-// T_tate3 contains 6*(eB-1)+4 elements from Fp. There are (eB-1) 6-tuples (l1,l2,n1,n2,x23,x2p3), each corresponding to a single step in the Miller loop. 
-// The values l1 and l2 are the slopes of the doubling and point addition to compute the tripling, n1 and n2 are coefficients of the corresponding lines and 
-// x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
-// precomputed values.
-
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
-0xC8958D5CEAEE9961, 0x15656BE866831334, 0x3DBF0E58FFD1403F, 0x2A2E6D76A5BD8030, 
-0xCB8B87470EB10976, 0xBF2B2AC3FF0E5842, 0xAA01464195495DC7, 0x3301FE417ADEE4, 
-0x1774317C1AE747D8, 0xF622B72338E21067, 0x66B109C419F65B51, 0x3D8711EDC6BBD998, 
-0xB63D65AEBC6BA7DC, 0x1291072426592F1, 0x1BD9936571211946, 0xDD17AD4188A2F, 
-0xF88254ED9673F23C, 0xFE13BC2A7A60FD32, 0x5C477D4791512FC9, 0xB60D285940223FBA, 
-0xD4F04D230B01D6D7, 0xAED3BA7AF814D35F, 0x50DE8541ED8EB69, 0x70D8A04CD0C5F, 
-0x8F6D06DEB1BEEBA7, 0x728845EFC2E41EEF, 0xC0899F1BE099641C, 0xB2D53A9A6FFB638B, 
-0x81DFFB91EE670A12, 0x7F6ED051EF6DD383, 0x56FE7CC0F271EBC2, 0x27A62D7A33CAE4, 
-0x52F209522A9A8F2, 0xBF15EC49DA5F9607, 0x164BD51C1FC2F4DC, 0x2E24296622C7558F, 
-0x578D487C382796A2, 0xAB9ADD2F0B1DAB27, 0xA71611FFD3196A6A, 0x1C93380BC6A35F, 
-0x6FEBC2CFB6E541F0, 0xA0E90B20492B299F, 0x58D1C7665561D204, 0x726AB02F7704DD1E, 
-0xADCAF51273B66C35, 0xAFEC72698D7A86F8, 0x6B938FF75A01AD1F, 0x25E913D3900041, 
-0x3D782D5FBF4E9D25, 0x8CE0A7CD3D244A6A, 0x5DE270BA6D676D73, 0xC7137CB67CD0CC07, 
-0x8A42A49B803C1B06, 0xA6C6BE61B5F9D23, 0xADB2D782169A7FF5, 0xCC514CA84D8C8, 
-0x494C083C726D319A, 0x6A7A0544AA7CFB48, 0x20BF934A99D0A326, 0xFDE6116074F7AFB, 
-0x9CF64B6FC92E8B3B, 0x1996D1A2E28860F, 0x9C527774AD244155, 0xCCAB220E2CC6A, 
-0x558C076E1F240A33, 0x4E11EA9EA5AEC610, 0xC5E1F18FFBCDBC66, 0xC9A0DE18266F12AE, 
-0x83E9A9054C991729, 0x64F28BF07DC4BBC0, 0x4F98AB9C8248C641, 0x380130CBD158A5, 
-0x13B583F5FE1445EF, 0x2E28143407376486, 0xC3388A75AFF33517, 0x1180CEEC3264360E, 
-0x9AA81B55A88A713E, 0xB0B585C6D4E7871A, 0x7727044C3A91B54F, 0x34090B82AED8CA, 
-0x43B9DA643352346E, 0x5CD80A2E547931A9, 0x52C64DEFA2869297, 0x42550BF0D51F925B, 
-0x7A5C596ECA3ED13B, 0x41315CCCBCB0EF42, 0x59A69D5A2907E724, 0x18FA7EBEF3D7A0, 
-0x17B4FF96AE5486AB, 0x98A04C523C0F8004, 0x7588FD11603A8967, 0x75D3A9FA885976C9, 
-0x319EB1383D272E66, 0x390D6ED7B9D98336, 0x4F178CBFE6278E11, 0x10FFD3C9A1690F, 
-0x59B95A5F65DC83B1, 0x611AE8D14E568ECB, 0x104FFA7B7F94B97F, 0xF0EBFF6D81837480, 
-0x3E0FC0257BF0208B, 0xA335B99DB95D061C, 0x3A05D7396AF06A4A, 0x25BFEFD95D3454, 
-0x777847DB261D0C8E, 0x316D64AD0DF8761E, 0x1F7BDFB78BDFC95C, 0x12D68D75520F6CE5, 
-0xAD8922594DA44BD6, 0x52D2196B26BEE2C, 0xF56F8AC4937139B4, 0x337B4607E54134, 
-0xE28F853A3580BBC7, 0x6AC658838B3D9CAE, 0x75711438ADE90FF5, 0x90B042B090FDD7E7, 
-0x396F3E95707FB6A6, 0x903D06BCB61F51F1, 0x7A89595551A0AF7D, 0x3823C2BCB4ACF8, 
-0x30FBC722A0A8D1E5, 0x5C20FB9E09682F63, 0x5EDA785D78735AC6, 0xEACDEFF413E25C76, 
-0x5B6CCE16AF1FBFFE, 0xBAA204B461C736D3, 0x3A2C5DA9681E38F4, 0xD873080ABDF7, 
-0x48EA7D1A8EAA38C8, 0x817C468377955430, 0xB36941B46040DF4F, 0xD4D353AC3A3506AE, 
-0x88875C3AA6E17B17, 0x913E3089EEAEA7FA, 0x4A756EC91340AE78, 0x23799D07E58FE5, 
-0xDB8BF50A3795D736, 0x91F358BC8714D0C5, 0x94653037769E2588, 0x71391585F29F6D3, 
-0x3323D1202F4B91DE, 0x1537C77A96148FF3, 0x6056A81907D4C433, 0x2121EC34AF435E, 
-0x215197FE6EA6E31A, 0xF99AD791E0E90BF1, 0xCBF0A844BC107235, 0x92998285C0447A1E, 
-0x7B6D6B57A26B0385, 0x163308F350FFD8A1, 0xD75DB0B3BD04C81F, 0x380259EBA432E2, 
-0x3A1B603C9748B921, 0xE442778BF7E68F7B, 0xC18D7F7912EB3BA8, 0xA97738AA6A94B292, 
-0xCA75DC8EBDBA768A, 0x9EA20EE8BE90961, 0xBFC40FB0608DDE23, 0x3437B4025F50CF, 
-0x59ADBCD79A4CD43D, 0xDFBB504AC907DE13, 0x1B320674C30D8AF7, 0x19130F0C4D890FAD, 
-0xA51C4182DE07371E, 0xD51E6A288043EA17, 0x77C9D0181A5D7095, 0x1474DCC530DE65, 
-0x2FFF407EA2A5AC4, 0x4C1F998FAE9AEA08, 0x1F18404A859AF280, 0x58D9E124B68B9102, 
-0x558683EE964318EE, 0xC70041AF357A5CA0, 0x7BF6DA77FB7FFBF4, 0x24F2DBE4601F9E, 
-0x410262939B802A04, 0x1C6C3272E99EA472, 0x2CA3BABFC6D7B31B, 0x1B27459EC0530457, 
-0xFBCE8F37D551AF07, 0x1CA4F10EC70009F5, 0x45E564B687157DF7, 0x2619882EC74442, 
-0x41FD94D3816493F, 0x3C43AD27D4DDE1BD, 0x8E6524D5E6F70274, 0xF124A431D2885B3B, 
-0x77D49DF03BF4ED70, 0xCB719BBCC7F877EC, 0xBDD570A4AE5F4E6, 0x35C1B86C412524, 
-0x5C27C52F336B093C, 0x760E352F13CE0F9F, 0x3005961C7E83724F, 0xB910D0879B11A93C, 
-0xCA6250054F49E93F, 0xC2B4EA9E521006D6, 0xCC7F250134D90E4A, 0x109F0DA2F06B04, 
-0xB31A22E737D960F1, 0x54F35A87C8BF3BAD, 0xB64A22864F9DE445, 0xE76935A149ABDCC3, 
-0x3A314D980FE6562D, 0x89CFE04D814E533C, 0xBC988C62FBD1175D, 0xE89CDC935EF7, 
-0x32AF9BC2289DB649, 0x1748FB4EA48F5876, 0xB59B2185EE4AE2A7, 0xF67B98DB2060ED3, 
-0xD6A0940F2E8DDB73, 0xFE11002C43D00FE8, 0x8FE34DB948A55EB9, 0x8FA142A65DD9A, 
-0x3A07B154D3BFBB8C, 0xA89023C326755A79, 0xEEEF615D4B42338C, 0x6F85FD4BDEA87EBA, 
-0xCB0A581FB61C8CF5, 0x5A3D9879C6DB166D, 0xED45C7CF88EE4C19, 0x22D56528470E3, 
-0xA13D9D61964CD379, 0xDA8C473E933BF48B, 0xDBFA60AC3B60F7ED, 0xE82F50C2AD350D3D, 
-0x36A822C9786ABF2A, 0xA590A2E855277A, 0xF40625E007D6CE4, 0xED96BB72BCFCB, 
-0x55DEF0577BBFE8C4, 0x550A31D9A1652217, 0xC72D388FF8569303, 0xD85B0FF4F21A2163, 
-0x344702DC9E36C473, 0x3A3738B89E55EAE7, 0x77BBD889350CF856, 0x20D9667170E607, 
-0xEE654EBBCFD99BF4, 0xA51754E593C8BD24, 0x9EE410583CE28A66, 0x959A3A1C0637EEF0, 
-0x25B018DB2AC757CA, 0x5C999C11E8BE1A71, 0x406E15821AEFD399, 0x23E566DBF968CD, 
-0x8B0556A8CBDD09A5, 0x29A330F02CB9BC71, 0x2C7A4CA49EE08EDA, 0xA20BC85C23DE7881, 
-0x2B008CB2ABA75ECE, 0xD9DAD51971C97CE3, 0xC299DF6E1090B2F, 0x3D366FA90735DE, 
-0xC4A80F061484271E, 0x57FAD14D646659E6, 0xAC47A7E1EE5915BD, 0x79228C14AAA868EC, 
-0x9FAB6233F405979B, 0x9FAEAEDDCD5C0B7B, 0xB1ABF3654CE77537, 0x2B7EB1000F0EEE, 
-0x1ACB510F9BDD6C9, 0x300626F7AB298E48, 0x19D4AB3BA42040D0, 0xF2244C65099634E6, 
-0xAC98B66BE249B8A3, 0xD54BFE9A19638B55, 0x38BB6F006099B783, 0x3EAD979CFAB042, 
-0x562B64097C0E3D15, 0x617A23EC3EAD0D16, 0xC16ED610D3E26DB9, 0x39CFD8008287C87F, 
-0xC086978264A3CF3F, 0x976297406CCCDE6, 0x4D29A168F4C24E5C, 0x2BC6550814EAEC, 
-0x21B04A0861AB56AF, 0x81AD267496B0723A, 0xD0A6B1330F2658A, 0xAA43D8AE67E02AEB, 
-0x8C758B566009EE53, 0xDB673CB9F69599D1, 0xC7817897B57ABC15, 0xD6E2530200C64, 
-0xF3BB67FB8D15AEB, 0x6A373275A0F9691D, 0xC82F999933CFDCE7, 0xF3C21A92123729D3, 
-0x2AAA8D42CFF0166F, 0xBA1D7820FFF9E3FA, 0x3351E475C37ED977, 0x28B1856DB6B8D6, 
-0xC6C147A917137F9F, 0x115150CE171910BC, 0xBB815EC83C01EF36, 0x2FB127AE73D17E09, 
-0xB18FF8B689017F63, 0xFF8EFF8ECC1700A0, 0x49E53A8E60F49646, 0x1D965B930CE232, 
-0x2D49263D0A9F5A06, 0x2498081DA7E396B8, 0x50F26C9D424D441, 0x593C798D4917B122, 
-0x3ECCA5107001C6DF, 0x5A57EC5C0C24985A, 0x3D2477C73B18234C, 0x1367F6E2E2718E, 
-0x9FE8B8D126C87071, 0x522D05A4D9BCA6E5, 0x5EDA963F2AB9CBBC, 0x937686C66CDA1F34, 
-0xC6779B5840C7D648, 0xD3F011BA549D9CC6, 0x9B45212BEF14B281, 0xFE3E85CD0C96C, 
-0x7E00DD3B87271A0, 0xE1A01ED5AF4628, 0xDBB843F55DC762C, 0x5991C124A6636800, 
-0xCCCF5AA4973C0E07, 0x28E2EE0E23520DD, 0xC122201866705C71, 0x1DFEEB2631ADB9, 
-0x2FDA3DA37D56BF05, 0xC5FFC6606973DB12, 0x3A6C43CD9BC36D4A, 0x2F722B325D4B976, 
-0x326A2D1FC3596CCE, 0xBEAFFD9D4F74E1A1, 0x4803282EE21B9278, 0x392F11ED22988C, 
-0x4853F1EE22BECACE, 0x6D6F1A0248082567, 0xEDD81C10C97D4036, 0xC6C6919A6BF0D920, 
-0x2C7F97C64804117F, 0xF0E8764612D0D63D, 0x4CE1C6178B2BBAA6, 0x1CEAC0F775CC99, 
-0x90EDB27DC607E009, 0xB5490C02C50CDD50, 0xF9C35B037DE3C0A, 0xFE0369234CD36A70, 
-0x7FD8C7D067CB42C9, 0xC8D135E6ACC397CB, 0xABDF5827C14ADE3A, 0x3479F89C145EB5, 
-0x77342C2DF94CAE02, 0x7FBBA379E84D0B4C, 0xBFEE92ED3F99A1D5, 0xD81201938B6F48A3, 
-0xE7D1044B05667438, 0x461F1665EF57A27A, 0xE147E64A892FF6DC, 0x16E022F892A0BE, 
-0x2D623EE5FE5AFE33, 0x37E6C8B5BAF01A07, 0xE4E7BC2245CA7313, 0x2EC198AFE2B1F360, 
-0xF0A9E7E730369EC9, 0x8B1253849CC85BAF, 0x84298A884AE8BBA7, 0xF2855C467201F, 
-0xBA0D9C53664C111C, 0xF343B0084862DA5F, 0xDA0D21E3D3294BC1, 0x1AC43A3FC7AC3F79, 
-0x8D3C52F86ABAF529, 0x6850329404CEFFDE, 0x301BAA527CB2E260, 0x2B40985C0F2178, 
-0xF321BDCDB73DDA09, 0xEA464E4C9E08EE42, 0xFD7EC5C95BEAAB0F, 0x93F21A307A9D12CA, 
-0x387E17D7D0EF456C, 0xD924FD33AC95D92D, 0x47A0E9ECD0695BB, 0x2356452B8809C0, 
-0xCE69BEBAAD414EC1, 0x86D870FC8FAF2F10, 0x94D3853A2625618, 0x247D36F4FA0BDFD0, 
-0x72508F97DD7DD18C, 0xFC2ABE771A92A683, 0xBD2D982CDCD7EA4A, 0x1B1797E76399F9, 
-0x282BC0758B7FC94, 0x3F38B35203F6C8DD, 0xA2A503010B6085D9, 0x3F1CDE784113B420, 
-0x3824938BFAE808D3, 0x49181DCBCDF7CDEA, 0x8F46E81A781667CC, 0x32A59F67224000, 
-0xDF2003DE7763A6A4, 0x5AEC7D558ED9E452, 0x7E20854603DF162C, 0x86C3B0E69A59A03, 
-0x10AEAE87416CC623, 0x2425DF04C1F853C4, 0x92BB528E935A35FC, 0xC460C4E6F0A57, 
-0xB2C3A4E4E033FA22, 0x87BF93C8E652A2D7, 0xE09342302D9D150E, 0x11EB187B1FA67FD0, 
-0x3584671E69F80DD2, 0x10B31168EA471815, 0xE0C3081752989039, 0xB36D45AE5E62B, 
-0x584FEF06B71B5999, 0xF3389713AAB4017B, 0xAA31756C1A8DFABE, 0xC8D0EBB6053ED1AC, 
-0xED3A29B43599CFAA, 0xDC5D5825736DF5B9, 0xC9C47B483F3B638F, 0x3106757EB1622F, 
-0xBA506D5D96975A38, 0x64316B6D7A9F1ECC, 0x528BAFE4D9F6D493, 0x6A4F0C40B21F7E59, 
-0xC30B213A35042FCA, 0xCA06DF89E035508F, 0xAC38655331D6A33C, 0x812687D0F4438, 
-0x4D25479F15E0DAB8, 0x3BBED84CD70D00E9, 0xFC9E6839D10B8ED8, 0x750ED957B7E0A0F5, 
-0x88BDBBF16F86A39E, 0x499A6AB13E35F7D1, 0x621682C224418082, 0x2755DD1CD7B1B4, 
-0xB38583EFBE4EBEA7, 0x2622DE43A687A112, 0xED4D301E8C6212C5, 0xC755777EAAABFFFA, 
-0xDA1952C76C69BB8C, 0x492B439EE76B0B9E, 0x2991F601543653EB, 0x4035E4A9B15C2E, 
-0x7411F49456F80962, 0x598AC83665879F9B, 0x453292A161EEA54B, 0x7D35BEA6250589D6, 
-0xCAA4437FD8A63082, 0x3CB1F128C1A3753, 0x5EBE8981BF41D6E2, 0x3D2704ECBFFD5C, 
-0x2A3A42BFEF96D753, 0xB4B38AA8F4B29D1A, 0x1ACA4A8F30C039E0, 0x46FF641C96C948AA, 
-0x8840F27C49421AE0, 0x6AA75B7B60F9134A, 0xA75EFEFF070B73A6, 0x1D81ABEF85D08B, 
-0x4BA4846983372123, 0x114DC6BBBE5B5E2A, 0x21F7A615CE7A3E67, 0x993A3C7767A5685B, 
-0xE07A7A14A10C17F2, 0xE93FC2AA075B7D78, 0x92073F4FBA3169D8, 0x345C4840B95DC2, 
-0x54FC84614A2A97BB, 0x3BA73336B3145000, 0xDE790F93D8731BFE, 0x3B8BADD1C61CC9BE, 
-0x5FC958A0C1129FC8, 0x33BB83611B26B190, 0x31334884882CD974, 0x3A930285DE115, 
-0x8F7922EF5AC36FA1, 0xF777B79D30F83FF8, 0xC90671DFDB5CBB0, 0xEF0FC04361626E29, 
-0x49D5FF514D8FCBA1, 0x5D5C496DC99EB0C4, 0xEA43770B34B3FE53, 0x389D14C0E967ED, 
-0x9F72A976766F2714, 0x903C8359731CD843, 0xB7170A8F7D9236C0, 0x8E10DC5CBDF391DF, 
-0x87FF837AFD73C834, 0xB3350774EEB37694, 0x7D21A8EFFA78A7DE, 0x7B6C38B69373, 
-0x37EDDABA0CC5D7E9, 0xB15122F0BEBE4FD7, 0x9DAC3CE3942FA72, 0xE61B46E52B84040, 
-0xDC93DD8905C94CB2, 0x24D3D67D0ECEC227, 0xD40939C16C70CDFE, 0x155AB7130A876B, 
-0xEAF6FEFCC4EBEC0E, 0x2369BD1469250EFA, 0x5566E7238F78C63F, 0x6C77F7DE14F1053F, 
-0xC3F8D5016F6EC56, 0xC7E7CC43911E95F0, 0x82628621D0C55216, 0xC38BE0CC0D22C, 
-0xE77273C5D735C315, 0xB489E366D0BDF7E5, 0xA7D4F3DD23083AE8, 0x447C6D8E49EC330B, 
-0xD29E22F30ACF2907, 0x8F26094F15E68A13, 0x3DFE15F9E8C0CDD5, 0x2E3E8E2A43E98A, 
-0x245C4D9588590111, 0x8AA3D39D42BD4C0F, 0x374715F8A26652FE, 0x7DDB3DEFD69C121E, 
-0xF344A1BF5CFFFE75, 0x754D321A023CE2E1, 0x4091B51E7EDF4D01, 0xF89E2AADF018C, 
-0x1986A3A77C261209, 0x836C6450D826B45F, 0xA2F0AAE2789665EF, 0xD0FDA0FA7F7C3974, 
-0xA44B6E755AE0670C, 0x1F69EE0EC6443BF7, 0x4EEABD7A95795443, 0x3026E70427CF10, 
-0xF0CA5000FB005FCA, 0xE0F11D92D5BF9740, 0x8382582230E62A5F, 0x545AC5342B7A3FB3, 
-0x4292076663CAA4AE, 0xE25DE9A4826A6345, 0x46BCD59C8EFEE162, 0x2EE72E2B189C30, 
-0x2E2E8A516EB29A09, 0x63FB2C3B7EC3522E, 0xAA18342BCF88F857, 0xEEB88785D98BF61B, 
-0x5D433D9744CFE3F3, 0xBEF0392BE00EB485, 0x53C4A26942BC4106, 0x77455A2C49351, 
-0x61DFBC5D3671B149, 0xDA6B59207EDA517A, 0xE55968E6D1D36134, 0x517769F1C47B0CDF, 
-0xE6F03782781D2B33, 0xDE249FB4CB5344C7, 0x1A0E685F74654A3F, 0x22C81B84C58A9D, 
-0xB9F2D9BE2BF48E09, 0xB8E10B8A7C9FFC7A, 0x689196E5ACF0F2B4, 0x41E3872D682E1704, 
-0x9C8A2DA3AD177BD4, 0x8410736AB7C91FBF, 0x69B7A00E56E1647C, 0x2DF49719286E0F, 
-0xF0EBB77C49AE166B, 0x3BB4F219E61E14B2, 0x349A3735D511F8F6, 0x3C45AE2B868EAD15, 
-0xDBDCF31D737AB3A2, 0xFFBD671A08997ECA, 0x38ADAB66D1B6ECD2, 0x2A47FE28E95C51, 
-0x1E0EA7CDC0FF20, 0x548ADD75E4E85DDC, 0xBB50EEF7511D7B4E, 0xA2338FF61F7EA92B, 
-0x1CBA3708B5E7EF0F, 0x81B0C5F59F5EF200, 0xE417F49A48066190, 0xBBADBA7247F42, 
-0x40392FB2FE982765, 0x6E0323B5247BBF3B, 0x4A293951A5775CD2, 0x71EB84EAACDC038A, 
-0x1B4A6A972C2E72C, 0xEC187C20C70C6579, 0x766A8DCE73FBCF65, 0x1D462C39EDED9F, 
-0xF9AF735D90CFBBB, 0xD368D0631EBE121E, 0x286F3AFE4932AE68, 0x3E605298DD4716C2, 
-0x6A539EC30487728D, 0xF94896D980B61A09, 0xECC78AFE9AF2EA61, 0x11467A6DE4F6BB, 
-0x4653B5E4BE9F26EA, 0x645B52DA88DE018A, 0x9F6809CF6BBE0F64, 0x1EC4C3027D3E4E90, 
-0x58D98A7FDABA5047, 0x1D186CE781CA57B5, 0x44E3DD95CF12CDA5, 0x1F341C336EEB5C, 
-0xD94D2DD0950AF19, 0x9FF725D2A8208BA, 0xB24EEF7723C83A8, 0xE6B6FEA3FBEF1C6C, 
-0x204AA70A03CDC653, 0xD3445315F598DF86, 0x40146404A98E098F, 0x1FADD644D7A91C, 
-0x4DF4E621AA40BFFE, 0xD042A93B5874CBE, 0x8767EB430F019F22, 0xF443DFBF0C07531, 
-0xFF452AC1B80455D7, 0xEDBD357505011528, 0xF901E6DABB2A6593, 0x2FA3554E508EA8, 
-0x19FF19847227A3C4, 0xBF045F0E599C55A9, 0x6309A6DAB4312376, 0x2F7BB10E2B933197, 
-0xAB95264FBED9ABBA, 0x4FF94F641525290F, 0x39AF01E2292533F5, 0x20DF93570443E6, 
-0x43D1F40D362F227A, 0xF168E9D558A12D52, 0x2AA82295DFE8BCDA, 0x44DE7579F6FD3B0A, 
-0x373EC860DA8B2ACE, 0xC2298CF9ACE8B47E, 0x362997010860065A, 0x23283F82E17D08, 
-0xCAD6AF4DAEFFD26B, 0x36450114A474D7FF, 0xA3F94D648FC9F98D, 0x5AB3ED0AD226D8EE, 
-0x3476A338CB73DCD4, 0x4C57CE009F65722C, 0x30EDC8A1EB512A90, 0x1B18D10C31A82D, 
-0xEE56D34788E0B283, 0xE236C233760FC331, 0x373C77ED6E9BF2AE, 0x33438B895DAEB55E, 
-0xA74C68FCBEFE4508, 0x45DC747082CEEE02, 0xC7C8C950FFA76D9A, 0x2BB821E97CD798, 
-0xAA67F1D5FE33D409, 0x4A42A0234A606384, 0x3529A0D00CF3AF1A, 0xA8FA8DDD97DE0801, 
-0x9880006F0EECD8F3, 0x7A969887BD9EF229, 0xB5B855B35407829C, 0x3C4115A5D3925D, 
-0x616CE3035469CC64, 0x5F4441B215C6BDF, 0x410C0605CC8D217, 0x8331BD36058DB4A6, 
-0xD10CC487A9B092F0, 0x298A7ED0943B9FD5, 0x4F40098702B951A1, 0xF59C5466FCDD9, 
-0xCD1043B945474987, 0x1C7857505D12DCA8, 0x7CA67136FB10F0EC, 0xB5610309219609A7, 
-0x96AEF8974726EA91, 0x8ED5CBCCA3B568C6, 0x8E7EB9B6FD1E467, 0x415C6D3CFF947, 
-0x43CDE1A5693E10BB, 0x17777F63B9E66F71, 0xD4A7112002C75E7, 0xBB910C281C8B7C0A, 
-0x923DB0F33064920E, 0xE1947E09EDE6FE53, 0x3F7F54330413C8C3, 0x2700E43966B4F3, 
-0x1C42FE6F0A3A45F2, 0x2F7104BEF57C594B, 0x21778325361B0BAC, 0xCD25889F2EB78E3E, 
-0x822B850DBC107F1C, 0x2E0410BE5D79486, 0x32AF76FB2FA97CCE, 0x787E179207641, 
-0x33B4D14752E4E9DA, 0xA124F1F4E5EF0F77, 0x8B9A5D0536ED898, 0x6D0AD3AC6993B094, 
-0xA61BEC3E591B9773, 0x7027ABC0EF36FC05, 0x6FD70F7D8A6ECDD, 0xADDAB2F3C0A8A, 
-0x89019DB54DBF80EC, 0x12532F9F6BBD5129, 0xDBC3D94A838A80A1, 0xAFFFA23F8793EFA9, 
-0xD0F8C7BEBE873AF4, 0x3643A167A86DB431, 0x8088C266DB8ABD13, 0x19EDAC05533FD6, 
-0x8DBCE53EE8018441, 0xE8335B6A765A2AEC, 0x44C703E5C48F504C, 0x1DBD7134FAB340DB, 
-0x3F30F4785DF8739D, 0x51E5AF0784AE037E, 0xA50DDAB0AE459957, 0xBCB9751930BF5, 
-0x36EF29A1600C7B7, 0x3435DEE05ACBA8E, 0x603ED0E0E8F974E9, 0x9A3841F0A8937C1B, 
-0x5DE201CD73E5919F, 0xED66B01658DDA40D, 0x94041279B979EE71, 0x86C95E97C627A, 
-0x472B8590BFF42266, 0xD4E36E4438A458E7, 0x6FF399F82A355D21, 0x9AFB1F3CBDFA6083, 
-0x17E72771426137CD, 0x2D3C1526904D8FDD, 0xBFA0CAB423DEA1BB, 0x146DCE2AC890E7, 
-0x35CD156ACEC7EC61, 0x251734F25BDF37C8, 0x48C4BD9BC61DD67D, 0xF966C08927B2FC46, 
-0x92F0FD36E9A03F03, 0x8672F5BC8E1F78D4, 0xC14FBA8A757A0DD9, 0xA388387B89B70, 
-0xDADB20448DBFDD20, 0x4DF3B85542DF6A41, 0xB3221A2E39748083, 0xC1EF24DB9691CAE5, 
-0x28C123A8EEAE01C8, 0x283AD140FDB218EE, 0x27755A3978DCD352, 0x2FB3D407771EA8, 
-0xD05D84E5B4AC0E45, 0xEBE0CB36B1B4CC7E, 0x4E0822A8112BA8DA, 0xE9C05DD8CFD569E1, 
-0x878195D8AF2100EF, 0x88A5B1A7A81F4BF8, 0xF5DE53FB471EE2D7, 0x1A6F3E68B88963, 
-0xB85053974714C276, 0x55DCCACB58AD452F, 0x7A5BA0E307EB3C93, 0x5AEEEFD546E78921, 
-0xBF0906E7D1E4870E, 0xF81B85444FBC6B69, 0x36D6BE3E3A58A7EC, 0x1A78C7683DA946, 
-0x4B5F4ECF88629A5B, 0x1235059DE16A5DD0, 0xA0D1203934DE4B55, 0x6E25FA308788F47A, 
-0xD0A93F2750B89686, 0x79F3043613B9BF48, 0x86B9DE3A36352658, 0x2B49B1B9D78438, 
-0x9E4F31D8BCBC8342, 0x8A0E9D91B6F457B5, 0x9F57FAC40D2A2E03, 0xC208B734BB699048, 
-0xDFA9B28F1F57C4F8, 0x60487203B7ECCF7E, 0x92306F409ACE99B3, 0x390E7A6031E6CF, 
-0x802AF661775A1636, 0xE9B552F89CC22423, 0x77C86D3EE177E5E2, 0x11FC4A3BB3B2D8A1, 
-0x3B84E960E813BD66, 0xF939006680CF1514, 0xE9E52A03C3B3703A, 0x2D3B3D8340D571, 
-0xBFE73FA14D4A18DB, 0xA192CABBE552833D, 0x91F0CA460D7F6C32, 0xC6D4B72492A0C372, 
-0x881B3D32D886DEA6, 0x9FCAF9D6D3236A55, 0x77CB1695DED725E8, 0x3CDBF0432C2E43, 
-0x2CACC1965539A16F, 0x1444D4BD0FCF3A5D, 0x692F79DDB787E16D, 0x92B8B9870D8D5D88, 
-0xE32E4EC22037779E, 0x196CCF707A683F6C, 0x583ED5708F8BC371, 0x2EFB584C64952F, 
-0xBEA38DBE4643D98C, 0x7E90DF5ADDF6C48D, 0x84DCA818D39C6F7F, 0x1499CFA090DA6CEF, 
-0x6950713E288CFE16, 0x6BD53566DA024E63, 0x14B2C152CCBE2E35, 0x3C83FF2724236D, 
-0x89E25322395E702F, 0xA13F62AF08819E1F, 0xF8694EB6734CBE18, 0xDB15BF7A670A90DD, 
-0x2491FA006A1B698D, 0x28D361278213C257, 0x8A9CB53680BA1E06, 0x1DEAB3D06E23DE, 
-0x462BF9F1F71FEDB, 0x3DA41A22F47B5BD4, 0xDF1BC331D936E90, 0x77CA3E7C939F87A8, 
-0xB207B7FA9352DF48, 0x174E5F6C6444F7C, 0xEA77D60CDFD46B74, 0x160B16B9786967, 
-0x609F678B6697381A, 0x2BDBD4D02E5D8134, 0x277C82CD6CA1F0A5, 0xC7A8C4EFDAB52682, 
-0xBE251796B88DA11D, 0x4D890348F3704430, 0xEB2A0C55D884E482, 0xA23D31DC124F8, 
-0xCE482437607ED196, 0x34ED0228B7ED5ECF, 0xD5491BF0D97EB8DC, 0xBD25272CA0A8600, 
-0xF491DD993D81A2DD, 0xF69195E6FA1C2F, 0xA4033AECD23B19BE, 0xEFB5528A46A52, 
-0xF674D3268FA923F, 0x3704E220974F26BA, 0x1A200EB4313E5C27, 0x9D85B71DA1343FBA, 
-0xDF33268109C58652, 0xED6C15D1DAF1FAE0, 0xCBF8CE69E296B025, 0x2DDB049DE17528, 
-0xA0E506301109690E, 0xC0A07AF954A8F06C, 0x64FD23751F87C8B7, 0x416D25B461ADDD9D, 
-0xAFA0DB0EBA14F841, 0x6B84687D04EE58A5, 0x9A3E75F7CF26E5C0, 0x397D797B5B5487, 
-0x979C29025A936B6C, 0x4FD475A1891BF77D, 0xB19E066E764EB693, 0x15F60469669213F0, 
-0x442B3BE3C73B4857, 0xE56CDFA108DBC2BB, 0xBC493899CEDC09EF, 0x2E89028C5456EC, 
-0x57437B91CF5A73E8, 0xB1A1953BA1F950D9, 0xB82D257217F9DF49, 0xCAB5790EDE78005D, 
-0xE09BBE1E131AC90D, 0xD57028E8C9EC036F, 0x7F0101345379E758, 0x1E83CC91B41EAF, 
-0x8D07976B68406683, 0xE2B2646C1814A8EA, 0xBD39B4E00E7EF862, 0x8A9C443A77265094, 
-0x75C25F87757BA53D, 0x4DDF8C6344296E02, 0x44F444C14C773116, 0xCA31EADD31399, 
-0x32327699EF153FC6, 0x74A131BB666702C4, 0x10CEC5E163F7F09B, 0xF0EE126AB0929224, 
-0x2E5CD467BCA23F6F, 0x456D8345004E1BF3, 0x82BAA9150AA40D02, 0x2AECFD821DADB1, 
-0x5F99A67229591CEA, 0xAC5955FC193012A6, 0x9098D726A81D19B7, 0x84800C0D79D30569, 
-0x74738F5D5D6B1BDF, 0x756365DBDD2A556C, 0x2343E245707F66C8, 0x2976F61621431C, 
-0x56EB555E4289689, 0xEB15751C51FBB899, 0xBA048171B426F01E, 0x11D5572F360BE6CB, 
-0xF979C6F64EFC8FDC, 0x210F851FA8793641, 0x5753A965F0B4B515, 0x35697DCCF8A526, 
-0xC019D1C1316B75AA, 0xBD7071D6C4A3162D, 0x6D638BE659DA1935, 0xEEAF3508ABD93AA0, 
-0x122295108C6B6D3F, 0x71A2B3EFD5210C3C, 0x5679AE22F6A895BA, 0x25F7E07FF202E8, 
-0x6015EF3FC4E5F3BB, 0x93F7510EC295028, 0xB52F87F0AA9CC936, 0x3BE3F2D1B2DA8BC1, 
-0x1CFD107E433A1B31, 0xCD6C0B15AF6D9AA, 0xCFBD84BAE91C8CCE, 0x6D0D0A9105E96, 
-0x800F0EB3E01B729F, 0x85E0A05F5A3BF790, 0xB61926454767A77E, 0xC82313F9E15770CC, 
-0x106BE10A07AEAD9C, 0x9CE8154E70A1C302, 0x6ED64ADDF626C684, 0x3645CE3DB733D3, 
-0xD321D0428D48070B, 0x4958E5E73C5FAA4B, 0x9D3537F30EE3B43A, 0x811EE7FFA450888E, 
-0x12A12BBEEFC6A676, 0x1B86640C37DCB785, 0x6C098995F8B178E8, 0x2D9FB8D05BC4CC, 
-0x728E7E45A14618D0, 0xEB73E6868480405E, 0x8C2837E881A1F801, 0x9725BF93AE29754D, 
-0x516956847B7BACE2, 0xF6C008E4CD32BDFB, 0x317935C73BB6AABB, 0x3FCF29ABB87252, 
-0x6ECCFF2433B83903, 0x9320EAB0D91AA40C, 0x24DAFD70A0B7D394, 0xB6575785437B115C, 
-0xB74D2C56C560FACB, 0x36E8FEF5EEE8F882, 0xDB3DF00854AEBC44, 0x3F172C671D99BC, 
-0xB17219E5A6579225, 0xAE486D46F9DC26D, 0xB2809EAD9C6260D3, 0xE961DAAC6292C74E, 
-0x25D5685B5E7C7F56, 0xAF1C5DF1E052E7C7, 0x3B1DEF0B1F21977D, 0x21703069343F98, 
-0x4373559CA33A58B2, 0x5ABA36B457733342, 0xB6DD2342E0519FCC, 0xA85A07B1AF76ECAA, 
-0x8A2C8E9B4C0DF83D, 0x90B5BEB6920699D1, 0xD05B8787C0A7FADC, 0x301C9307505F5, 
-0x3B8B45D0CD911AED, 0xD973F04B97EE54AD, 0x93A69C63C7692751, 0xEA38FCDB0BA9E7, 
-0x3790DE330E6F6EE, 0xD206BACC817EEE7F, 0xFE699A1D2BDC584E, 0x3A4B4C9E6E5730, 
-0x4E0AD8E9BF266C9, 0x32BBC0BFD92CE93B, 0xDD065A1C86DDBF7A, 0x24D0D80D9DE6CA5C, 
-0xC92ABE1FA0510052, 0xD8C500DBF07FF909, 0x241AD45CB9CE1095, 0x20146556B92879, 
-0x2A33FB60C4234395, 0x7B60D2E3A6080249, 0xC21A66F9AF26AD95, 0x3A74A2DB74556751, 
-0x4A08C9D916953D24, 0xB0B4160941529D72, 0xEA1AC59CB87A86F6, 0x252165CABE56EA, 
-0x82C5ED002F870B20, 0xADBF72B352A14D91, 0xAC0AF4DAE121EB9C, 0x7C735BD962CF697B, 
-0x52D84C63F4AE1FD, 0xB452F7E768A2AD5E, 0x7EA0314FB98D9A4, 0x1C7E62CD343832, 
-0x27BE2A3CF9CD1502, 0x59642ADD9ECDF7E0, 0x2EDD5E7657AF551B, 0xCAF25453AD41C52B, 
-0x6E68BEBD480A414A, 0x710C81FE9F7C4FF, 0xE9A0CF317209052F, 0x1611B28553979A, 
-0xC953ED8C14B0403C, 0x7B73E6457AE04C9, 0x86995817F318B9C7, 0x40931F896010BD66, 
-0x1B2C883E79D9BB97, 0xB85AB01FF13744E5, 0x82280183A78E346C, 0x380EAC85436498, 
-0xEF7E025A28DA1A9F, 0xB2C38DF61E9AECB9, 0xD92C9E7697BBB980, 0xEA1D02D587049B03, 
-0xB1BA6E3CDABF695C, 0xFA512794AF4BA0AC, 0x3F275B6C782CE9C1, 0x17E1BD94E5C869, 
-0xD9F1F0ADA684D15C, 0xB390011C182100DA, 0xDD966981B7829593, 0x4C6B7EAF20FA37E2, 
-0x7713AE670DEF817E, 0x1F2391081EF44847, 0xF8245C9AC00C8284, 0x2683CC7F878E7C, 
-0x3024FB03513BE58E, 0xCCA5743F77CDC027, 0x8288591E26076BAD, 0x72B7A5A920414F19, 
-0x4144C51DC0BBB807, 0x84BF87EDAB8C5E8D, 0x8838CC47F2FAC99E, 0x19A262A874E4D2, 
-0x9A34F26BBB9C9AE2, 0xFE3437533EA60B5, 0x7B4A7BAE4FFF4F75, 0x6D23C35A1C54C5E5, 
-0x256EAD7399A3B0BC, 0x4D13B01D775B869F, 0x38784EC399F68A78, 0x2883B7E45E8D5C, 
-0x78FE41942F244171, 0xEC3090E677D8F629, 0xE0F42652C5466BC4, 0xBBE9C30B36B8B016, 
-0x8514E732EA57436E, 0x88AF5CFE73BA9C98, 0xFF913354355777F, 0x12F14532CA3871, 
-0xEE809F44B172F262, 0x40F8EB011BFD0B01, 0xEAE209C03D1BB65A, 0xF5DE6B596C8152D9, 
-0xF46DEAE6238CD483, 0x80F23CFB6185EAC2, 0x86F29F02944EE98, 0xC3E9D867EE46, 
-0x76558B3F5BBC4377, 0x22B90EBB6CECF4F, 0x1265B71309398C7B, 0x11DE59BE68CEB699, 
-0x914AD8D1E3C2E32D, 0x2B553A96EA87A5CA, 0x5CD24C4E3268F7C7, 0x1E4ADB2690D6B8, 
-0x75D57C8859A686B9, 0x1F3FD34FAABAF8E, 0x39ADBC8136CD560C, 0x8D834525DBE4C2B1, 
-0xCBB6EE355F22B61B, 0x2C2B57103650E27E, 0x9FB5225AB484CDEC, 0x179358AB355218, 
-0xCD2F5CF3BF909C42, 0xECA9B539D403FE06, 0xA9FA5F32F72B8DD6, 0x25B8516A154BE988, 
-0x19E6F65D95618FA7, 0x7E85A031B092FBF, 0xB5B987C06FD8BA12, 0x35D84B3D503875, 
-0x554963C4565F358A, 0x6DA10437D70892A6, 0xA80512E421A518F, 0x659674526264960, 
-0x76CD3C1FB0F87684, 0xB22F64DEFADB84E3, 0x5575F7E95AF4A3, 0x1B2838FF21D75E, 
-0xD045560CE3C7A817, 0x8AA27520B6AD4E9A, 0x1CC22CBC60B2EE4F, 0x99FFFD2ACEED907B, 
-0xFF23473E54C8C8D0, 0x253E6A8194568FB6, 0x984CCADC5030356A, 0x37B5D42369659C, 
-0x808FDEE52C09CC2C, 0x3DDE574A7BC276AC, 0x5B2176102F0E0B2A, 0x64737689858689CE, 
-0xA7FE4C2BB839BF6F, 0x62C0AF898F03AAF8, 0x6AB604B25715BA81, 0xE096C659B3F2, 
-0xAF9DDCD2C29F087A, 0x9478F229D8D8C748, 0x5D4CECC9CC657DE0, 0xE12F72C0DBD9DF1E, 
-0x6ED26D507889A88C, 0x1C8160031D9FD8EB, 0xD0CC42932A80B8FE, 0x389A4CD3E89FE0, 
-0x69368691D8078F22, 0xA8E334BE138B64F9, 0x692A631BF9AB8F5F, 0x8EDB21184C86B871, 
-0xB43D261DFB3F99ED, 0x9D4B9E6FF1208B93, 0x99A3609AEC225370, 0x210755DE81DFB, 
-0xDCCB4A02FA0BBA83, 0x913C3C75B9EB22C4, 0xF05B61AB2CF29B01, 0x584C24332BC13EA9, 
-0x8E584247F06B550F, 0x7E2F43C81C8F042A, 0xDCB6A981A350BBDE, 0x20850B217FE321, 
-0xEFA0378FDD47CD76, 0xF09AEC5F4F7FC666, 0x6F5F44DE73F19E10, 0x5167EB087F3124E7, 
-0x64219CADAF7E48AF, 0x8EDA2D9A986B8683, 0x55BFAE950222EEB1, 0x3E2256755BB80C, 
-0x80058C01A53A1BD, 0x7B2C248998D813D4, 0xD0716F0FFA936453, 0xFEEEF61B7BB395D9, 
-0x437D12DB7ADFAF0A, 0x436130B5A4987D25, 0x84AE73DB84B4D663, 0x14695B4F0C7763, 
-0x3A5166577941F9ED, 0xC8AF6792BD29620D, 0xA0E4384C2BE8AD13, 0x3F372FEBFC623CCC, 
-0x9FC3E1E0424240C8, 0x5C3EF3BB38A35E91, 0x3A8A8A43B2DBF5C6, 0x31BF56DD51A3DF, 
-0xB2D9787F2C108361, 0xF2C16F6680234AEC, 0xFE08CA108D9ACDAB, 0x8B298FBD4FDA84AE, 
-0x1CF3004232DA3C99, 0x21556908C7F200F6, 0x97044C3C54207C46, 0x1C8B868B47C4B5, 
-0xBEC25F1A1C6D9DCC, 0xBA6C600DA8C93D2F, 0x2CA85D5A9978030A, 0xFF0C40A6B174763B, 
-0xC27062B73F1FA529, 0x7C20857FBCF02F5F, 0x2373757BB978F291, 0x3623E6D7634131, 
-0xB66B858474CF6315, 0x7E58251D187429B6, 0x66F941272EA54B69, 0x96F5B2E1AF26B6C5, 
-0xCC1CA444E17207BF, 0x54576B0A8CCF912, 0xB4ACB6CA7231C3EE, 0x10A13ABD856852, 
-0xCF44A772017BE933, 0x41D4A59012E6E5E1, 0x4F716F7BC7610043, 0x18EA57DBD3642C74, 
-0xAF8BB0B758A831CA, 0xC2E65E40401F4DCB, 0x40611176F0A87E14, 0x281D44E0027F9E, 
-0x5005AC58B4FAFC1F, 0xC3D5032B618844D1, 0x6936F99A1225564C, 0xE39085AE30A2F218, 
-0x1815ED4391D23CE7, 0x80923A1659DFF71E, 0x44C32D12D42563B, 0x15450C6E117B45, 
-0x40329EB955A0FF98, 0x3F7FA8B7AB47DB3F, 0x1687F5D3054986AB, 0xB8DFCD4DC7F3E2D4, 
-0x18E3D6292FFFF0F, 0xB18C16476EDFC591, 0x2F35B040F0907739, 0x7B4F7EA0C87BA, 
-0x3895A7F9F780E6E8, 0x5085EF7159679825, 0x92C9A940ED2D5E7A, 0xB5CAF05E8EDB9D64, 
-0xF50F5D9F7D1FD533, 0xE8884EDDC700A40D, 0x2ADD8E6F45159916, 0x16633447CA0B, 
-0x6A3DF8085508681B, 0x38E07752872EADAA, 0xE9EC34AA2EEED4E6, 0x1CCD5BC4630BEB5C, 
-0x3D90C1A9314E818A, 0xF84E160F086D5263, 0xB17C5A63BD8E4BB, 0x20CCC3D572D61E, 
-0x489E34733819C40A, 0x151343604EBC06DD, 0x44E000641B7F1A6A, 0xBF4A7E2C33CD072F, 
-0xB6884F00473F93E9, 0xC7A31F4503E3F6E3, 0xBEE3FC9C15019DAF, 0x13E40A094DFF8C, 
-0x24B76D35FC50283B, 0x42BDF1F5DF175ED2, 0xECFFCB7E82EFBE5, 0x7DB2BD211F25B5D5, 
-0xA705C93AD203A13, 0x86D43DF96184676B, 0xA030E7E261EA7B8C, 0x1341E04C845FB5, 
-0x5A839039FA211141, 0xCB5D6C2F61BAF490, 0x3B7F97B5003D1336, 0x82446C7CFADB3589, 
-0x3FA153FE1567357E, 0x9F32B4843513E98D, 0xBEC52C1622C29FB8, 0x33F1148B9BDF64, 
-0x55661DF2E44FC21B, 0x14B31E74DA019AC0, 0xCCE5F8267B5FAE5, 0x368C36517FEEF691, 
-0x5D4BCE99E4ED0669, 0x7D94FEB2FDCA8457, 0x506936603E58EDB3, 0x374AF37CE55799, 
-0xE7E21A995DD38CF4, 0xAEF7A33B9884D49D, 0x3FE47352DDBA93AA, 0x7E16399978EEFDB7, 
-0x9B5C008B7CF4E715, 0x7E0216BD6D868B18, 0xA103E92F170CAB87, 0x1CCF370F72575C, 
-0xB484F70EFAC1B72E, 0x1B97D9616F71CE14, 0xB3DE9CF2F6698270, 0x8248FACE6BD1F262, 
-0x3E2CE2F3900D6937, 0x70863EC33617133E, 0x85F5BCBBFCB03CF, 0x8B2FEFB35666F, 
-0x396D49CAF26F2F15, 0xB521179328D17D0A, 0x10756833312F03A, 0xE640EA17AE0170C5, 
-0x6A9A384F05AC709D, 0x9E1D4BA936F762D1, 0xDAB3B6D8ABDBAFDD, 0x2F8FEE91185C25, 
-0x7FE9A5D9CA0C56DA, 0x3BD976743AF0A728, 0x57B6D48FB471D44E, 0x7660BA4F297450D9, 
-0x51F824E6C7705E29, 0x1F3CB1E1B2BCEAFB, 0x63A76D0EC0FDFF0D, 0x147665BF868F10, 
-0x91E801D28D1B2A5B, 0x12EB3B8B91A995E3, 0x6DEF2E28931FD07B, 0xE2BF07EA9E835CFF, 
-0xF71557286C0948AC, 0x572F27B4203F125A, 0xED5B752BD81C44B6, 0x22E2545F8A3E96, 
-0x66CEB1CE201CB559, 0xFCCDDB907231BE90, 0x94F121820D1E55B8, 0x95417E57E607F21, 
-0x4C100EA2A303080E, 0x946430AAB8617F41, 0x4D0B205E94503044, 0x31A10ACFFBDF63, 
-0x9725FC0F44EE2BD6, 0x163DCCAF40D2590A, 0x6C953E2F3B982429, 0x905DAD9DD9ED20DC, 
-0xB56CF688E311680, 0x2D97BDB91C698F24, 0x893816D8FE85915B, 0x2C7A76FED9295A, 
-0xB049EB85407EB30C, 0xB6364C28A98F9FA8, 0xAE545CE50BE03162, 0xF54214890437DF0B, 
-0x300D870375617220, 0xCF79210D5738DB6, 0x2232A3F3DC6A4E1D, 0x4A8DCDDFB3104, 
-0x9AC45FC3F415065F, 0xBB444FAC85468059, 0x123D9906BBF95572, 0x326AE496281B34A0, 
-0x6B43C147D1F506D5, 0x3D757AC95C091CE3, 0x7F605FD8425C3071, 0x1C6745A93987BB, 
-0x544052B806C95788, 0x9537FB8CAF7C9331, 0x37725027B68707A7, 0x7F5F08C0A68BCFE6, 
-0xE5898D87E5F1D735, 0xA97658134EFC39E3, 0xCFB113A21695D437, 0xDB250BCEF81AA, 
-0x834E663545595A44, 0xE1AE5B0B9B4B2BD0, 0xFB8083B8390FCC39, 0xDCD4527009AE5380, 
-0xB510D97C8B5499C2, 0xA1FF49B6470927C8, 0x374181443F12442D, 0x221FCAE1241C9, 
-0xCFC6BF11DE44AE6F, 0xDD5802C718B2F2C0, 0xB251BE7996DA1107, 0xC5D126ACAA2EA3FB, 
-0x466ADAC0FD2B694B, 0x64CCF760431FEDB9, 0xAB529DC39562E029, 0x152744D4EF9C6D, 
-0xEB8A628E2CA89364, 0x5B83C5AA89E6351E, 0x8705B736E6F977C7, 0x11A51F9F3604F324, 
-0xEC6743457D3CF817, 0xAA9F543818847AAA, 0xD9BD4E425BDF4796, 0x33C2EFD61D91D2, 
-0xD57AB9706F302601, 0x56386F9BE79A0E8C, 0x3FC9A6E44B76E9D9, 0x70A7E63A6B1F99E6, 
-0xEFD7A488E16A3E51, 0x6F97D7E0F955F359, 0x4F31DF86B025F690, 0x28E0645CFABD1, 
-0xBA8EFAB87F68DD4C, 0x40139C56A042BE4A, 0x51FF1DC8A4755DDD, 0x2474347B9C1E457, 
-0x80C78B1304D6BD24, 0xD7FB12D927F1EBFE, 0xF6C7752237219178, 0x3C4D3C22769E75, 
-0x98E3DF3743EE06C1, 0xA6F1791E356715DE, 0xF07F8F0DB6E05057, 0x2E615F3D41C7DF70, 
-0x6873CD0327876A9B, 0x49E82B2FE436C257, 0xE23179D374761919, 0x3D55D5CEBCDEEA, 
-0xA9FA6E8B3B00956F, 0x93224D63B5C96C85, 0x890A1C3D9DF251C3, 0x50E1CCCFB8C53AD9, 
-0x36F7A8FE3846FCCC, 0xEBD0078C1EDF372E, 0x474E7B2CC861448, 0x48FA16FC1438D, 
-0x3E22952D885BD8F9, 0x549B9C52821F04BF, 0xD18423402F2F56CF, 0xE94A4A15004EB864, 
-0x30CB73B1F3F0B412, 0xED83EFD7E9DC0D5D, 0xE3FFE5F4CF1D3F73, 0x9DB6918AF3E0D, 
-0x281ADFC69CC0DE5E, 0xB2CBC69CA8178433, 0xFD1139A388683240, 0xAEF4B7777B67D3F6, 
-0x11ECB3C6430DB99D, 0x47394AD36A66425E, 0xBF39EF62EE9802C7, 0x1A4DDED7CAFEB5, 
-0xC015325C24C0D9FF, 0xE968ABD52BEEDCFC, 0x19AD7CE1EF30F329, 0xE04B890F409F73C, 
-0x9965C2423794C1CF, 0x40B6FCBE31C1415F, 0x465758BCB9F18EB3, 0x3BDC36AD081105, 
-0xF70A8B630F23CF51, 0xAAACA813AFD54697, 0xD406C05BCAEF1433, 0x9EE9DA69C4D4D1E9, 
-0x353B4B86CB4F27CB, 0x9003BC2D24794241, 0x6475D5C9C581083C, 0x1711DFC806A64B, 
-0x76A943FF6DB1FE24, 0xBD9C17A71FCEFECA, 0xAAD85453B0A48B6C, 0xC9B5D55086AD62A1, 
-0x82D94D61862F0FE3, 0x6582E99BE5820A0B, 0xC44E5AB6A1074762, 0x360D2E031F2F8E, 
-0x8B0AE785F56087F6, 0x9738CE14C10DE7EE, 0xD6F65F55BCB66E24, 0x7E962AA2A8F01532, 
-0x8EC3394D25FDF446, 0x6FBD4E9FFAA67699, 0xF06BDFF69B2234F8, 0x64AA85EB90B3F, 
-0xF73C4F57AD7CAD12, 0x8F5A94522BD88769, 0xA10A1AB6E91507C0, 0x5CD2678A16D2AAA6, 
-0x9854CBE5A3CC0F4A, 0xC59EA6635E9E9400, 0xC1849D1E43C896D7, 0x256DAADBB036C4, 
-0xADDBEF719C59901E, 0x442793E2B052D506, 0x62259A131C382528, 0x1DE79E59E25C156F, 
-0x234BAE23CB8FED59, 0xE841EFE7E1BF413D, 0x834554ACD57D3153, 0xF1768BABF0989, 
-0xCB8870E52C4B15E, 0x6F0B401FECD05F1, 0xC1EE6E9B0BD1430A, 0x5814F973BF4BE531, 
-0xAC28381D5859D4F2, 0x793943AD101006B9, 0x96DC4FBC6FEC3208, 0xB848D6763EC15, 
-0xB23488E56430098A, 0x2C2EC2EB03BB54A9, 0xFDA7A872B71557EF, 0x3C80362776CF01A8, 
-0x28B56EFF094D213C, 0x4EB885B30824DB3C, 0x3A2DE7AF3D2B105C, 0x3A4D6C84BB0BA8, 
-0x514708FB8DF9FD0A, 0x4AE0657B9D376A06, 0xE6CF2C49A4C47852, 0x577F9DCC33CD7894, 
-0x934D52E1CB2B8F4A, 0x3E27E4C77D5D961A, 0xECE0751241BDA182, 0x2098A2C91B364D, 
-0x88FD022724795541, 0x4287D7A22825BC47, 0x87C4CE6B075BA740, 0xA24DC93CAC9EC4D1, 
-0x5F03A363546B552E, 0xDF462420908CBE07, 0x56519CF61CBD3E18, 0x4CB8418569510, 
-0x3E2269207912F44B, 0xF0ADBD4BB8429A16, 0x31547556147BD067, 0xE974C7F1306E40EE, 
-0xDD05C6E8A45500E8, 0x3DD4AE8253DCA5C2, 0xC695C6ECBC17EC04, 0x30694B32EDE53A, 
-0xAA3372EAC8DD2D56, 0xB1FE64F2DC001679, 0x4A4A86C338C41A8E, 0x1177773ED611EDB4, 
-0xDA3DA1BB65B49531, 0x143AAE929E1A9345, 0xD8CC730BC95E3477, 0x298C0FAE7DD740, 
-0x6598F6B46C894B2F, 0x7C0CED8FAEA7E844, 0x7A3D19E7718E8120, 0x21911797E0B9CF89, 
-0x5A1656E6CABB3436, 0x880D666D91473260, 0x84CE6646C495AF2F, 0x3E58CA88A5355D, 
-0xBF147F6EE7D92221, 0x17A3C2C9117181B1, 0x6CE0E8BCCC8078B, 0xD51BBBEC1E5F68E3, 
-0xB3458AD0888CD8F2, 0x37E494ECF252D7B, 0x4CDEC8459A01D3B5, 0x2FC586440A9727, 
-0xE3E71697DDFE3632, 0xEA8D378DBBC7F211, 0xE54B191435BE1F84, 0xA7791570BBFD659C, 
-0xE78523C7E327089D, 0xC670082F8C9DE007, 0x990F4C38FAB6CBA3, 0x2CDA72D960E416, 
-0x3F71B028EE39C379, 0x759E58FA8D7B1673, 0x34FBE55A4C7B781B, 0xA4F56BEED567086E, 
-0x298CE403AF4F6443, 0xE61D646E9C2E6DCC, 0x3B97A36D91FA61BD, 0x1E13CB1E233101, 
-0x9619EFA7A8467913, 0xEECDA425D9176C90, 0xC0140FDD84944632, 0x774B7B540909039C, 
-0xF4F90979AE416914, 0x72170672CB3731A6, 0x1D7595C22132004F, 0xB81C7D5E2D5A7, 
-0xAB638B4A2F0614CB, 0xA052447C061B44CA, 0x9EC3472F4A2518A3, 0xB1B7C85F507DDF24, 
-0xBB79ABB06F7FEC0C, 0xF8D2FF1367D1EDBD, 0xE76B012891C2A262, 0x1A5E585527107D, 
-0x5558EC96B5047422, 0x56A1FBD0F56DF266, 0x6DCA2BA62356EB99, 0x2372848FFC35BA3C, 
-0x5B0585DD7B717B84, 0x9F099320F36F0121, 0x34BC93CC22B6BAFB, 0xF840BF79E15CD, 
-0x7FB94B8B77AEEE54, 0x97167A768360D99, 0x1D3EF29F4B9938EC, 0xAE2E0D8C54877041, 
-0x396CFCDB20E6E08E, 0xCEB5EA97B4F26647, 0x4040CC2A6E3C164, 0x35EFB58A3C1046, 
-0xB4AC67480AA4D978, 0x9A0968BAFFC22B00, 0xA19615827BDA46CA, 0x41B0726FA823B24, 
-0xF79D9A62EB98D027, 0xA8CEAE1940F9D5F4, 0x3C4570C8BC3F968A, 0x21A18362900972, 
-0x34EE652FB688CE36, 0x183174A7AD968B92, 0xBAB9AEE7310B807C, 0x87D7CE1ACDF6CC6C, 
-0x94FC7CA9A14B330E, 0x93271973569DDB60, 0x1954B65EC734E8DE, 0x148AD715D0A8FC, 
-0x822F89C9681BDBDD, 0xD3ACBA94A09AD802, 0xABAE4579C3E387ED, 0x38AD05DB2A750A32, 
-0xD088E4005864511A, 0x50CA0E3433C5DE97, 0x890CC97C302AB55A, 0xDEC4E6CEB6893, 
-0x6C547C0993DAE219, 0xAEFFA3703D33B743, 0x7A28506B366C0451, 0x21B17A07197BD963, 
-0xF373CB0E23EB5374, 0x5B82A40E061E2241, 0x1B52673D98B5A0B6, 0x1BE859336654EA, 
-0xAF0C27FAFDF92C81, 0xB892FA9CA4C92C14, 0x186E81DEA212CB5D, 0x259D28B978F01B45, 
-0x8949E1261B9BCBA1, 0x25A5ADEBF0D4813C, 0x6EB9F0CEFCDDC348, 0x244E0C06D7F5F7, 
-0x99F042C7BD80C51, 0x9D29AA37538B1D19, 0x5D2B191C97AB9A88, 0xB21991361D744727, 
-0x8A136DC940445490, 0x8D632A5D73FE1AB1, 0xAD4D1B5F0819B393, 0xC3BA62011CFD5, 
-0xAA5C170AC6DB7242, 0xCE7F2C7C2A4BCF23, 0xAE2DC38F2E2947B5, 0xB32027DDC6A002FA, 
-0xAB1A6AFCEA5A0CED, 0x3F7E0A2007C1A18B, 0x9BB5E479DF9C9B8A, 0x3F5ED2118FF7D8, 
-0x106089C1ABD2D693, 0x8CB818CA9423B7F8, 0x3C55F42A0D792592, 0xFA38D2D8661FE5AD, 
-0x41155D3B4162824F, 0xC492D5EDE4925B5D, 0x5D97A131A5C77251, 0x2F7FA7173B6D06, 
-0x6B4ABC5D21951AEE, 0xA50A1A15D29A2345, 0x4CF99DF8F75E4E0B, 0x2FE3578852D404EF, 
-0x1ECAE3D259F7EDC7, 0x2774339CC7E7451E, 0xC0526A676F71CA71, 0x7273BCA73453, 
-0xA7EBBB3C6A36441, 0xDAC55199064C0831, 0x91A93D09A677E9F9, 0xB3249D3AF6FA840D, 
-0x31BC075629530DF5, 0x3CC865F17180FB61, 0x286F69B4CEC29B6A, 0x2588CA8F1EB5E9, 
-0x1399D25EFE5D063C, 0xB722E06657450555, 0x850D06594EFDBA02, 0xCCD8E0CC041584C0, 
-0x1087A684DFA35C0A, 0x9B24D4C7D91A6C6F, 0xDCAA54F71AB1EC30, 0x146B8A2CC92DE1, 
-0x51ED0BF47E9C4E5F, 0xD92CABC21B8577AF, 0x86F6C823084BCA66, 0x8B1A285DCB0E05CE, 
-0x47DA5421B33A82C1, 0x2C23D8B9A8FB45D7, 0xD73CD5195817D823, 0x2A653F6BC448BF, 
-0x9005DB727C0C37FF, 0x8E3555443AA53703, 0xF5D6EF713B1F7E1E, 0x293529DDDD2B2A69, 
-0xD6F04FADD3A5787C, 0x8E30B3B821457DC2, 0x1A98D5063F9063B6, 0x3E2BE733DD10A6, 
-0x2335CBF73079F0FA, 0xC5112F033C2379FE, 0x8FB5BB6C912FC1C8, 0x34F2ACC5D12940B6, 
-0xB46FFF58184B675F, 0x7769664DC0245927, 0x6583636CF6B3E995, 0x22AE9DBE74A244, 
-0xE6F2A5EC1E412F4D, 0x3B89B8AD7474BDD2, 0x9490B16ECAD35F03, 0xE4529806C3A83853, 
-0xBF4E47495268CB5C, 0xA8CC6F74AD0E7360, 0x16E0186EDAFF7004, 0x8A89D992393E9, 
-0x13932E0536B4A9F4, 0x5AACABF9C824CA18, 0x60A2D09A531BAA9, 0x53ADA533DE5ED2CF, 
-0x552F8EC693D40221, 0x8B483BB68ABB8545, 0xD4897CDFA1F257FA, 0x2BE7A45B73F72, 
-0xE9AE8A8A6827648C, 0x14564DA3A61F39A6, 0xABF69C2F356CB22B, 0xC2E7FFB181177CAB, 
-0x90AE306DBD9CE786, 0x7CB469F3532B4F50, 0x35BAC2E3733CEFAC, 0x2C8AEEFF8C217F, 
-0xEEEE752575AA1DE5, 0x47A949E51C8439A8, 0xCC7A99FD9E305644, 0xF8043A3817E63054, 
-0x6A1E58E024D68BD4, 0x9A2A61B68448A930, 0x9C411E90B88D911C, 0x357A7339C853DA, 
-0x91DC2C458D99A262, 0x8A9593359F85A331, 0x551783F1FE57FC43, 0x6979E42561B60C77, 
-0xCC0A169D87B43AD5, 0x8C9CA7502F8E961, 0x42C27322A2AEAF47, 0x8FB699517F0B7, 
-0xA8DA026A4322A9BA, 0xEB5A3BF6F8B0A892, 0xFB8CE0F08530817B, 0xDD2958CE47EC21FC, 
-0xB7FCF65C5AA76FA6, 0xDE66661E73D090E7, 0x1F5A4CEE4BE5946B, 0x2A483A9FBDE42, 
-0xDAA09116744DCB67, 0xBD6D1EB8B1790683, 0x1D01F9370F4215E0, 0xCD8B7058059EEC68, 
-0xD5AFCA1023DD11A5, 0x6C959B68E8B11F6, 0xB6D596DCA71458A1, 0x290B02B26EEE2C, 
-0x4AFE625BA9590CCE, 0xEF4C6CCF926D5AB4, 0xDA8FE2B4BA25E58, 0xC2CB3CB5C19F24E3, 
-0xC05150FD291ADA1A, 0x9E1A65582B935EE9, 0xC96B17F4D25F545E, 0xA076DA05BCA89, 
-0x206F724F9FFD0915, 0xE8C12A7D2DE54589, 0xDD51CDC520A0FD82, 0xB337712B70FC5FC4, 
-0x37581D9932688490, 0x56C6A4C0A57168CB, 0xA4FEF6CB886493F4, 0x173408530F0A0, 
-0x88109DA2002EEB2, 0xB25E6A4E588F983C, 0xDE6A74E6814C887, 0xDF5DE0BA6FD54B64, 
-0x41BF77BC59FD2393, 0x7D69C16E597942BD, 0xC770875AAAB7E6C0, 0xAB2A5AF3B1C5A, 
-0x9C9BD2D9B84FD983, 0x1F0E76540752F9FE, 0x2754F4D17862E490, 0xCA8F5E289FDA328D, 
-0xB82E40DC8A56BE0, 0x9D4E0D3874732D53, 0xFA6C42B7DFC3580B, 0x12D05EF97A4242, 
-0xA18B1AE38264B725, 0x1C23E25881C0F947, 0x68F984855AF567CB, 0x8C5F41A131A931C, 
-0xD6619A44FEA46E3C, 0x8021B69E44E56335, 0x73759D4ABD223FAB, 0x1FF5FDA75FA5B8, 
-0xD9EB0289FD3D4D84, 0x65721DC48961DE6E, 0x758D88E0875FDF4A, 0x8FCD2F56E8C7602, 
-0xA6CA492E6130878B, 0xDBE17D65F31338E4, 0xDFE8D14601F20FB9, 0x34211DBE1CD46F, 
-0x9DE9CA3C0AAFF65D, 0xEE7009AC864F20C1, 0x76C2A03BB24294E0, 0xD8189D6A2BE37E75, 
-0x1B391F899C2774DF, 0xEAF6022C518EE963, 0x2A5000360DF1CD8F, 0x2B5F5E3BABBF88, 
-0xD54CA793BDC0C673, 0xF312B3FF8E378124, 0xC00C781EBAD7A698, 0x3BD7181D2F778D79, 
-0x6A75E434B3454F37, 0xACE0D87962B786C0, 0xEA44E646987E880E, 0x144888AE5F37C7, 
-0x839320B82E306D70, 0x54769FC440846ACD, 0x76B6000C8FAB539F, 0x66B8ACE3B459E001, 
-0x84AD315C35AA4592, 0x7D5DE42A8F367F21, 0xA71D594073D8D88B, 0x3C0D46E3B86BE3, 
-0x2C3FE495453BD580, 0xCC5F9B3560E47840, 0x7D80040ADCB997C5, 0xAE7BCE80E38E5AE5, 
-0x5AF7C9655511F21F, 0x75DAD74BB8A26D3E, 0x70AC306538439978, 0x25CFD4FC533818, 
-0x1E88DE2AAC79A704, 0xC5C7F4AE70511D00, 0xDF8C854A1FB71B67, 0x4A9D5B1D86F3569F, 
-0xA149E1D485B863B2, 0x55D1DE226EEA6416, 0x1DCDED0E440EC030, 0x6DEF433DCF613, 
-0xC8200451A48FC7BE, 0xC881933BF59E57CF, 0x71D0A09004896596, 0xFB493F739F90EB59, 
-0xA8CBE0D8A3103642, 0x6E059288F362D087, 0x272D8A09F4C19562, 0xDE3CC6B2B8554, 
-0x12AA0EBFBCB6A66A, 0x816DD144D76399AA, 0x7C9E72A4878ECEDE, 0xDDA38E5BF57F6D12, 
-0xA1D98DAF2C4D423E, 0x482BF6608A277FC4, 0xD822FDD2CEC15D6C, 0x250EBC641B7D44, 
-0x3FCEFF4900DB99E5, 0xD4CA2EEE75F49C46, 0x5E2C70730757CC0E, 0x923A40594EA3DB4F, 
-0x6AA530AC8B25B9F7, 0x8797F17256260255, 0xE6F781668DDD3CDF, 0x288F7D501A3AE4, 
-0x5F1F5057DE968869, 0xFE95B8A70CC2636E, 0xA32095A6D5657A27, 0xE9D8B739BD7B7A99, 
-0x180DF15A1B3FDEF1, 0xE50308DA5F42CF37, 0xDBFFD673F97B2A7A, 0x3D470713663F28, 
-0xBFA25736168035AF, 0x49CCCF5FF087D4B0, 0x54A3FC4C128D4763, 0x2466094A75207B04, 
-0x5222A501DD727F93, 0x1E2BB835C2E27EB9, 0xC4247E98E1ECB416, 0x39F661E727E043, 
-0x6BF595869DEA8227, 0x24DDC2B8D62A56A9, 0xD3BFDDCA9F54B701, 0x12387345957BA724, 
-0x4AD0750B270FDBD4, 0x4BE0A07EE206E6EC, 0xDC1B6DC47B6C653E, 0x2C2E418DE2B597, 
-0xBBE9804F772941BF, 0xEF03A56C4CC3BF24, 0xDBA3CBD6B1BDDC9E, 0x8AC9E1D1C3635A9C, 
-0xC7D410F63D2B8618, 0x3BB9EF624EFBCBB8, 0x8891507AF33C90A7, 0x219B86BD051F3E, 
-0xF34F81DA9C578B60, 0x3A36F7909AD93E9B, 0x2A6D304BB61529F9, 0x658BF3BDAA230D2C, 
-0x695F4717649E2512, 0x205E38494276EF42, 0xCC66E2E24E5F989, 0xFDDD55B87BFE0, 
-0x9A350380E034C581, 0x60C0A4F70C2D920E, 0x91E62B26E860365C, 0x94480734D9BAD772, 
-0x2236FE0B4D9D00BE, 0x5782B49B3D18EEA8, 0x47445CE69F7CB640, 0x90179CCD4B243, 
-0x619D3E8CF77F705A, 0xBA73C7F6B0885F86, 0x99260D9ABBF2D6C6, 0x2B49C478F875CFDA, 
-0x2CAD2C3876661087, 0x131D79A934D5CB40, 0xB5756D559EE852CB, 0x7BCE84394AC51, 
-0xF88AA71A863C52EE, 0x418F760355B92C88, 0x4DBBCBABF005A91F, 0xA955B440A988D772, 
-0x920D4A5827B1DC1F, 0xC8FF39CE8E8D040B, 0xBD7A1E784CCBE590, 0xD53AF4DBC8F75, 
-0x8640CCE8B0B03CB8, 0xD78EF6E7516C1F09, 0x336E33EAE38155B1, 0x40222212CE69EE94, 
-0xAA181A828DC520D3, 0xFA62B11A0184057C, 0x8E9C2D3583533F11, 0x38BB3B6C931381, 
-0x5FC53D16053BE0F6, 0x20C37BB85BEE877D, 0x1C9048178442A2CC, 0xD6BA302E1EE24D9C, 
-0x83B19F778C316C94, 0x4BCC9B6E1102B171, 0xC5A3900CDFF3714B, 0x13788EB3570A29, 
-0x4879741396712CAB, 0x628C5F7D966EF506, 0xE6D7CF46D01BD886, 0x5B933F42F0564749, 
-0x3D214B91F09AC1C4, 0x49D0B6EBC9BA23B7, 0x5D1A21FCF07806A, 0x234ED340CD4404, 
-0xB609CE85667D9734, 0x79C7BD8F986C70AA, 0xCD5286D051B89FAB, 0x4064DA16A93C0F23, 
-0xFACFB4CB30396CC3, 0x4F5C0B6E9A4CBEBB, 0x4F0D11374AC6AFAD, 0x351D4EDA78894F, 
-0x1E1BDDCB871E63AB, 0x85F81C06919406BA, 0x362EE835E37A50D3, 0x57BEFF8E0AC2775, 
-0x2CDE86BFC18D3B, 0x384D0F14043E6E12, 0x489DB9D60F360D9E, 0x3C384E24A3D289, 
-0x9B9A92CC022980A7, 0x3EF8C6CB6C707DB5, 0xD4C491D9B7E6D740, 0x67CF5F3F57E1D422, 
-0xFBAEC178B98BC96D, 0x7F4694F4BFEB7538, 0x7335E1605DC4A65C, 0x10DDA94AA93BA4, 
-0xBC50D1234B3A348E, 0xF4E90946DFC635E0, 0xEAC74675E8FB0F21, 0xD00EBB5D9C0956C2, 
-0x78500F11E1D516AA, 0x146B74A280277C58, 0x61E761FC941F7963, 0x2F282CA376644D, 
-0xE7D3AB7ECAC22CCF, 0xE8937F0B3FC757AB, 0x5D4FB10154FC265, 0xB20EC865A74EA930, 
-0x673D8D2FF0C30E52, 0x37A993BCEC18FDC0, 0x191826315B2F243B, 0x35E812EFA2C653, 
-0x5330370250614B7E, 0xA73050F769DEB7BB, 0xAF9CA977B6D48178, 0x92936D0917EEE0B2, 
-0x395860987569B513, 0x7CC4E6FBE7E016E6, 0x4CD575A046731F32, 0x3E12813F3C5189, 
-0x8D05D63D1B60A702, 0x946F33BA47804284, 0xF612F8F6146FD531, 0xC41205CCE502E9C3, 
-0x8A0EE59368846A53, 0x37A8DA60E4C06994, 0x637AD17810684D80, 0x2F0E44716A0F72, 
-0x44F3E2479B12819E, 0x4D9165433B724A2D, 0x3E77C5AFEF287A4F, 0x348817CA428F928C, 
-0x90896568535E313B, 0x92747435622273E3, 0x277512BE6EEAFA45, 0x3B0D1705FD5A9E, 
-0x539C56217D1B3216, 0xF197D68BF984D28B, 0x9BBA7DD275864C28, 0xF1A276F8F7E86C1D, 
-0x2EBA8CD9C3E92D59, 0x60CFA5A8AC483594, 0xC8BFBF87B6C06A4C, 0x39B982C64E3C23, 
-0xD9D7A17320B0076B, 0x62454665599A50D6, 0x56342860587C7849, 0xD0DC20C3C8EA35BC, 
-0x600D9A881DB65BE, 0x337FB13067A63A27, 0xEBD2391251DD6633, 0x7898AB2340E1C, 
-0x5E925BBECC276F66, 0xCA26FF9A66662CC7, 0xD7BBFE55B720D274, 0xEE7DA16644A16D42, 
-0x8466B8CFC7A2D78B, 0x8AC4205DD876629E, 0xB7327504258D4125, 0x15547BDDE45CB5, 
-0x5E4E2A29F061B917, 0x8A87DF73BB868B34, 0x7857EEF0DD93A96C, 0x361D41378C11EEF6, 
-0x54914E471C13FE38, 0x28B5C1A02C37EEAE, 0xA782C083EBA12F67, 0x2B037F2BE431C, 
-0x3A804358B8BB0C4F, 0xDD0C0C886AF5C35D, 0x4BAA226620C84154, 0x27B8FAB740A6B285, 
-0x9FA28CD525DCE09F, 0xCCBBDB33C40E462C, 0xC55804DC2C36C3AB, 0x3123DEF54959F2, 
-0x6415C23C55DF3851, 0x1C7CDE5E9EA70D0, 0x4D50BFD404B6EFB, 0x6C5BBD4553C6594, 
-0xE3DD4233AF07B5ED, 0x5261F3B4FCECDD9D, 0xFD5F8B556F46E3D8, 0x3D7C2C1CF89EA, 
-0x48104E3C0AED4F0D, 0xBA2F8025B171AFFE, 0x9B92D4B5A00E9B27, 0xA0FED17545A91A78, 
-0xFBE92B0B65B08DBC, 0x100CF80F84BB6CA2, 0xA2497668F8C89DAF, 0x402231C81FA918, 
-0x71287B197C7EFCD0, 0xF3AABE82F0D07CCD, 0x184ACD9C0F6E150, 0xCA7A9897EB273657, 
-0x4187F313AB8CDBD4, 0x6ED8F90683BCAE5D, 0x2620F137451EC083, 0xE45B3B592FA97, 
-0xE9EF9D1203F0A6CF, 0xE67D1DB92B06E117, 0x27D86A7CA093F745, 0xD542117154CBFD3, 
-0x21E57AAD5D42925A, 0x142CC23FE3CACFC8, 0x2FCE8EA8A82657AD, 0xA2D77676A6AF8, 
-0x1EAAB7268260D0D1, 0x67071EDDC179DDFD, 0x700FE834B64F072C, 0xE2A8E543326E8A9C, 
-0x78A1E22FEB3F6886, 0x13663A6DDE1D8760, 0x1CAF05E50BAD0A6, 0x8FCC8B6C1D9D7, 
-0x44C0384818687117, 0x969CB817DDBCA4F8, 0xC95C46CAE546EA1B, 0xECB7C3B16D99B263, 
-0xD18799DA4FAB011E, 0xE837BD0E2E474F22, 0x2245664CD3B99444, 0xFE9972C216AA8, 
-0x4EACC14B5F245058, 0x746BAE114AFDB8AB, 0x12292636B007496B, 0x2735C168B5E301F1, 
-0x57C0AC4EA73CD452, 0xD98325A89D30EB98, 0x35DDECF7B51DA4A3, 0x513DF301E2D55, 
-0xCA032679F82361CD, 0xB64DBCD46A1812A, 0x3BE07FBDB1F44C17, 0x8553598236E283EF, 
-0x3AB55F97673FD89C, 0x56531F110E46ABE8, 0x3DB0535468870FFA, 0xFE38A5ED11B65, 
-0x69C9F4C93BBFCE97, 0x51D485DAECA5BF3A, 0x855BE62517FE6DEA, 0xB29294B18E82506E, 
-0xCB596BBEFDF60983, 0x9500EA40EEF28EAA, 0x19199A2D78C45417, 0x6DBE07422B02E, 
-0x15879212107B5058, 0xA7A5E88B4CE27B38, 0xBFADBE0AF7F2ADB9, 0xE542564FBD1DFFA0, 
-0xA8D6BFF375FEAA1, 0xCE96EB285A874168, 0x9BC23F91DD1F0FF1, 0x2905AA90E91EE, 
-0x8A2C20EF473A53DC, 0x961D20F533720DFC, 0x21B1491BEE9ED528, 0xD5BE089B1CC41805, 
-0x11F6BF8DADF7C157, 0xF3728DF4BC0C7A96, 0x8EE3C3E944B2528A, 0x2620FA5CE9F989, 
-0xA0FD1D550523E308, 0xD8C40F07488FF334, 0x6EEC497C310B6560, 0xB4F339FB6D663566, 
-0xF0685BAB1C6AAB83, 0x7C712D85B94E585E, 0x9A43154A4CE69E5C, 0x3F7E1083DC6776, 
-0xACECC8C11145430F, 0xE242226C6681B7A3, 0x55EA22EAF84901A9, 0xB15FDBE9ABC3593C, 
-0xD9D532F7CC6BA5D2, 0x127C76EA1954196D, 0x77A78413C6A81603, 0x81C1F5C05480C, 
-0x20C320047C6812F, 0x7290161BBDD6025B, 0x1FC2477925FA1CC1, 0x64F245990AB54E40, 
-0x561D61C5437810AF, 0x4D5F4CFF32FA49CA, 0xDDBD84F64BBA4AB6, 0x39AB26268D7BE0, 
-0x9651F2048B3E35C1, 0x3DDF87B3C3866F23, 0x6F288920E2C9C938, 0xB1A221F6D2C170E3, 
-0x1D4C95EBC3E596D9, 0x71168EAE4E67975C, 0xAB4F3A4AF2C0475D, 0x2EE322179C7CD, 
-0xEF6FF524FFC6E925, 0x1DFCD72F7CBC3C22, 0xEE523B58837698DA, 0x9C7B6CF9C2E8278A, 
-0xF69CBAECEF8EDC84, 0x5CCC94F40FFAD392, 0x65FEF2BD536A1D8F, 0x2624AC5B63E57F, 
-0xA397AE96C239E88A, 0x24E68CE7F4A92C15, 0x837A371B1E046CA6, 0x43829BA37CDC004D, 
-0xA1639075B51CB6A2, 0x6D4F9525025B0A5B, 0xB10680E655E0C9FD, 0x32A33AD4F66797, 
-0x4F2F9F8BBC0C4852, 0xD89757A387D58F1, 0x5E3E019349555173, 0x66639D14337B0588, 
-0x59DA8456413181C3, 0x92A8953EDEF44D17, 0x99D7CDDF92931E81, 0x26805A6D238978, 
-0x34CDA652760115E, 0x4785D532D75A8388, 0x4BE3E88303E21B0B, 0xD03606787A612A57, 
-0x5991BD01E9358A59, 0xA1ED8EDE99AC6265, 0x60BCF4ACD6F6EFE8, 0x1D799E993FA496, 
-0x20C21651CA4A5A6F, 0x4A0521711678CB11, 0xE9C64C91302D9092, 0x77F4759E9B9F6EF5, 
-0x709EADA0B5DF6E14, 0x61E521A61AB2181, 0xE12DDB07EA4A451B, 0x1E792BD518F8DA, 
-0x8A03BA8118F0ED86, 0x6995E175A4675CAD, 0x39B4AF946C380B38, 0xCE6B5993E453B, 
-0xE1DC794DB6F3E10B, 0xA8413BD0BEF77BE8, 0x923AC5610CE2A4D8, 0x251B722A2D8431, 
-0x82B13F2CE482FE43, 0x972BA5E475C8A7DC, 0xDE4E14762DB01F29, 0xAC3457F719966444, 
-0x98E6040747824BF5, 0x19D4B41F29CBFB3E, 0xB55A82780E24A14C, 0x3E460B7E9C929E, 
-0x7D3AC336E49D2896, 0x811AA9DBFB37A67B, 0x397D799594A945D6, 0x526F296DE6512F22, 
-0x9D2E8D58F1F3564C, 0x60FD209D1AB91CC6, 0xC151FBFFB8F3A828, 0x222B99262E4A85, 
-0x5C373986F471629D, 0xE1E88CD4C5AC04D, 0xFBD222B7516B57E4, 0x306B2D1CCE7B0E8B, 
-0xC7631687FD00F17B, 0x110020FA43214C63, 0x3A8D50CEDD4C5020, 0x82D6C5F026BB5, 
-0x2906B13A1924A14A, 0x8D2670FA9D7E8DE5, 0xD5CF13EFDB6E7540, 0x72E8A040ECA33D62, 
-0x9FD7C1B1789EDEE8, 0x4F96F1F382A283E2, 0x4A55858C94BCF964, 0x534C2F0129B1E, 
-0x68E3899CAE2385F8, 0x2E7CE8B4C1B77FED, 0x629770BA69D8FF15, 0x1E8CB0836BF0303, 
-0xF5617561DE64B04F, 0x7C0FFCABB7337D9, 0x9E0AC19B6080FF82, 0x350E7637D3AB55, 
-0x4EAFEB1CF6D49FD0, 0xC7A592641B7FB1A7, 0xC648AD6BC42F31F2, 0x2C88BAD22E72436E, 
-0x723FADA3AF35850E, 0xD5705653365E23AB, 0x54E955023047B495, 0x3EE377AB795767, 
-0x31FDD1EB985B78F7, 0xBD19309E0DEF70A8, 0x638985484A838CA9, 0xD23E50D31D9D05CA, 
-0x5CC3EEA5E05B2C60, 0x54884211634EE1D4, 0xA0939EE18987D564, 0x3643B814B9F02D, 
-0x9AB0A34C5155F38D, 0x973B374337AD3E25, 0x802D6DA431C845AE, 0xD4FC0996ED22074B, 
-0x718052E9987E5E3B, 0x781794506E94C8FD, 0x53801FA263C7D099, 0x551C3305A9717, 
-0xAD4D9E59634FBC0E, 0x1301579E1EAD1C91, 0xD60FF0F35FA27537, 0x5E1080B6C12584C4, 
-0x1A9334CECD662A9D, 0xF493F26036DD10EB, 0xD821F40A43F9D732, 0x129716F4D4F1DA, 
-0x93E685232962E0A2, 0x4EF6C999F8209C0D, 0xE0987ADD77C84CFE, 0x36EE334871738C1D, 
-0x3EAC9E3AC831AA18, 0x3BDC27287F58D319, 0x54D867A3198AE91, 0x1EDAE9C5C10241, 
-0xE07B782F239D34BD, 0x23B70F765985ECB, 0x10FC0CF17C1814EF, 0x662AD72AE8F03E65, 
-0x269996D5DAC48B60, 0xE0CB654131523435, 0xA67012A80C3A942A, 0x3A3908969893A0, 
-0x5B3921B8C995771A, 0x1BA708F665B8C68A, 0xDC37CD5C6D17E20E, 0x48BFDCDF55721E10, 
-0xE51604E5176A5D14, 0x1BFE0E30BDECEA68, 0x62A329CDA4836311, 0x37F066B3F32140, 
-0x6F986CD09F1F9E9A, 0x7EF1174552DD0B94, 0x1D05A514BB4934BA, 0x17C2BC2A3432A8F9, 
-0x5270ADA2533C9DD9, 0xEEF50EE29909EF92, 0x19AF82A1E6864CA7, 0x3DBBD6AEDF5604, 
-0xEC55B836E12A39AA, 0x47A13619967DD21B, 0xA178E7684D1F2B6C, 0xCE80950821CE89F7, 
-0x3162EF27754BD851, 0x6AFF22A3133C0F92, 0xD2DC7EE6759D36B4, 0x17D6FF7F87A177, 
-0x5C6AE619BD9957D2, 0xDD919BA0DA8987CB, 0xC7208F42A56FA5C8, 0xD4E2C904DFE7076C, 
-0x26B85F2D1145B286, 0x304BE014F33311D, 0x68C8A152EAF076D3, 0xED483B8039DDE, 
-0xE306598AE79C5B5D, 0x62682A6B49D95D10, 0x9E10EF0202FF2068, 0x6598A31BC9268CDE, 
-0x3BDB6A7CA20CC0EE, 0x9D37AFF7A6D19DA2, 0x24E4F7A73FD5E763, 0x27B679AF6FBF8F, 
-0x880B00EB8206969F, 0x9E6C65E4B6573391, 0xEFBCEF699F3F25CE, 0xD94E82C8ADD9BB89, 
-0x3359E1C76E66C9FA, 0x89EE0C3A7C9632A0, 0x426BFB12CA988010, 0xEFAEC5B855AAD, 
-0xCB7E6867D418C626, 0xFD56CDF93496CA51, 0x6789A4B0F47AAE24, 0x8D94B39DE4D3A779, 
-0xAA5D4BCFB3D5D4E3, 0x2D748877C7957AE1, 0xB490F6B06BF9F341, 0x1587668D51A84C, 
-0x62D8EFA50643CE2B, 0xA669C446B162FC90, 0x339AA9E27CDC03F5, 0x609E29891F3006F, 
-0x2AA48FA070787E1A, 0xF3551BA1F23486B4, 0x56E98500C3C207E2, 0x1556611818DE7E, 
-0xC45F220F3F7BCCE0, 0x9A8FB65BC29AFA12, 0xA339AA9DBD7B4BEB, 0xC9A0D60205EAB0A1, 
-0xDD5442684BA15EB6, 0x9417FA7F305B202E, 0xFB07F274A40CC566, 0x24476B9E68D1E6, 
-0x3F7348E7F45DEC52, 0x44F1674D45EF7873, 0x82225D4EEB808D94, 0x3A21F44201CDC3B2, 
-0xC4EA4767E94ED73C, 0x3DD728146BE68EAD, 0x8C6A03770182291F, 0x29F6589D3C22E1, 
-0x5B6F82D6EB09ABCB, 0x4C40335BC0BD906, 0x97384520E538BB26, 0x1FA520C9BB270B78, 
-0x2C6311C3C2673701, 0x57C4ED42C90D2F8, 0xFD9782EA9AC04126, 0x1DF39FA9D14F9F, 
-0xEAEFF52FBD1E4697, 0xE2D381E042A868FA, 0xDCE21ED0711D6BC6, 0x1BB512BEAF851E28, 
-0x3527E008AD54E272, 0xC625CB5856BF4FC2, 0xFD29C75F23CC7989, 0x122BFDAFA27E9C, 
-0xD715580C850610E5, 0xCBCC75B55B181994, 0xA86BBA9695772338, 0x46F74358AD02285B, 
-0xDD51FDA0A60DFB82, 0xC6D168844694821A, 0x2E212959021E4A11, 0x38340040D86EFA, 
-0x899F6A7D349965D4, 0xF23A4EDEB02494ED, 0xCD48E19EB07DE49E, 0x77290FB98E19D4D8, 
-0xB44CCD9A313B51A7, 0x2175288F924879DE, 0x4C569FB945DE6AA5, 0x39885F3FDE73F3, 
-0x4CC6D3069DA1726F, 0x63D51DD9AB4ABDF6, 0x8D5F0A6360AA02D1, 0x616A09108EB0BA7, 
-0x53E1229605538C4, 0xEF335B232243367E, 0xEF152EC4D3307400, 0x38A5FE7A6305AB, 
-0xC7433E3BC30F9E9B, 0x129C1D0C8088F08F, 0x3CCFB34BED9E2B99, 0x3095651C1406BED, 
-0xCDA1D2031834E852, 0xFF4E3B76CF8CC2B3, 0xC5EDF8F7CA9178F5, 0x1140FC488692C5, 
-0xA8C4A12FEE726B78, 0xBE8743199BF1CF76, 0x3F16C1FFC8F448BF, 0x3230EA826E2E86B1, 
-0x900BF7BF6536FAE5, 0x7A13D97C19C5DFE6, 0x72A3AB9CBF327D4D, 0x946233215B4FA, 
-0x506AE109502DB719, 0x8BEAB67EE143C029, 0x2D79739616119956, 0x62BA12D16A882942, 
-0x9D5AC5462F4D4B4F, 0xF28B40633CB64596, 0xAC0C0C966F97BA5D, 0x32D811DBB0BE81, 
-0xD285CF779E0D4317, 0xF6B7980E6BECEACC, 0xD9BDE5D2817AE198, 0x4D891E5AB7FB71CA, 
-0xF9FB153DBB8BCEE0, 0xBECF211A99B97430, 0x9C74A9D0E062ADEA, 0x28CFFE572E94F6, 
-0x9C24E4929D9D4481, 0x174E3AB1F1C4F2D9, 0x86B3DBBFBED79114, 0xD3DA0D0AF7FB3789, 
-0x7C8195A23FDDBC8E, 0x5C48F1F3769538A8, 0x28C62378004A8867, 0x37C0A47A295200, 
-0xDCCECAF91EFA5E3F, 0x5394CA52986580CE, 0xC4ACC46FBF550011, 0xC82E16DF1082835D, 
-0x5824F1D08AA0C3AF, 0x3E802B0BF20CDD55, 0x50FA4C8FA9F9ED62, 0x1AD9065C7C93C4, 
-0x8F41E5FB88A5ACCE, 0xEB61D59A4729DA08, 0xB0E03D2572D63020, 0x92517E480B891D5D, 
-0x33BCDB9EA89412C2, 0xE9CA7A57EF2A4C24, 0x53C57AFF01638142, 0x2D007CC8BB5539, 
-0xD51F8FC620BA8363, 0xEB9B5C94CABCE251, 0x3AFE763599A89867, 0x6FCF29065E4F06CD, 
-0x6D632629EE741F69, 0xD884CF5A7A0FAC66, 0xDB5F7131196FC8AD, 0x6470B8FBC9E2F, 
-0xAEA71423C7B30C5, 0x2CC9894A0BDAF702, 0x347344B0F9C9597C, 0xF4694FD75AD84735, 
-0xB470AA621A72B4E0, 0x26264A58F4532927, 0x9CF161E1BA13235C, 0x3412B8B9A0365A, 
-0x6B087C0B39C8101, 0x21E469E16C640378, 0x210172A3D15034A9, 0x92B0A658EF95413B, 
-0x91EC122DCEBFA9D0, 0x65D8A7DF38398AE, 0x3CC14F6A8BC23327, 0x2BD0D7FF79C95A, 
-0xA67D4A5B3B8464CD, 0xA194593F0165AF2F, 0x9C98AE4327E00262, 0xE2CC9E55F507DE0C, 
-0xB2380274095FD75D, 0x355AA6ACA22F50E3, 0x6BC5AE759644F354, 0x3A6429F968AD0C, 
-0x71B7C3564E888B91, 0xF3BB9CD3932A3313, 0xE2CDF2CEF714586E, 0xF7A9C145EF8E58FD, 
-0x5779967C38422257, 0xA396CE7EBB396EDF, 0x7BD3E583CC83BE81, 0x2AC09C9E7A2057, 
-0x9E1FA057BB8EDFE5, 0xE207CC0D2E448CA7, 0x663A20AF1371AE4, 0x7E58EF2AACB7A82E, 
-0x121DED016E58AA37, 0x1F2C3CAB6B88C1F8, 0x188714831D9C8D4, 0x308E385C8EAFF4, 
-0x74C5E436DF60541E, 0x8F5710A517435F80, 0x56A604EEAD319BCB, 0x1F6474CC2F0819F2, 
-0x47E0E5B34B18F3FD, 0xCA4DD7F4D40FCA6A, 0x566F103B494C4267, 0x1A8D15B2E84466, 
-0x473CAAB6356BD410, 0xCC5174CAA71A7297, 0xDFF25303B24D7807, 0x4D986DAB59652A1A, 
-0x1D623DDF26432974, 0x56B7FD2FA6E7821B, 0x4C55BA4ECB683A99, 0xA7A77E56E924C, 
-0x723FEBF32574F05E, 0xE2A5B691CB390009, 0x7F01277C9D9E54BD, 0x84850CDBBC857CA9, 
-0xA579AE7E96A656DC, 0xD39B58BF3D18ABD6, 0x4EF024924FB07DBC, 0x57F3511E44858, 
-0x77AFECDAD8870A2, 0xADE5B0C53EB432AE, 0x618D90CEE62D0EA2, 0xC1DA22891C9459BF, 
-0xE9034D67F19BEABB, 0x227362F03944C181, 0x8BCC077599036A8E, 0x31DF465EEC0C80, 
-0x21C43C3D67E03C0F, 0x31788372961187D5, 0x35B31FF0D4A8AAFD, 0x4B4B68025DBB4DA5, 
-0x8F9073729CC412D9, 0x857ECA6A89E06187, 0x7E02A99A108C9791, 0x1B0132BD4F5533, 
-0xDC1007FA1678ACB9, 0x20D3B924892CB85B, 0xEBB2EE22672C4713, 0x638B3651E14891B8, 
-0x521AD75FA3197E48, 0xDC2F1DB6BF927DA8, 0xFFA9B2D18B44D497, 0x2932BA1B7B7AFA, 
-0x9288C2932E6C824E, 0xC2059AA43AD638C7, 0x93F058766B627C84, 0x596C41F412C7B22D, 
-0xEDCF21F437FD29C0, 0xADEDB267BDECA456, 0x7F42D9CF0ABB8383, 0x1E2AE88FB22748, 
-0x7B4B2B7FC0CE9CCE, 0xAFA39EF95DE374B2, 0x93F88C6C2A9B5E41, 0xF95C9E664C4D8D9D, 
-0xC952E930444945E0, 0x4FBEEBA7F80B393B, 0x1C9FCFDFD80C3DE1, 0x2CD29C1B855DEF, 
-0xA46B45BBA20AEB3B, 0x5E362E94E3B1A4C4, 0x9F6156E6FBDEAE91, 0x8E6EAE8C472BB59B, 
-0xD81970A27A33C8EB, 0x8152F4A06B5E4071, 0x55B2536EE9F9005, 0x3269B51D4CB296, 
-0x39DC36B040E51F6A, 0xA9D20FD31AA3EB69, 0x8CA3A0E6211FEC50, 0xE9E102CACFFE99BE, 
-0x2D0ED3C3C62E6AEB, 0x502ED1990C1BDB56, 0xEECFD724C22590F9, 0x3213D2D25C8E57, 
-0xE0DDDEECE7DC7CA7, 0x41B1CF2159D3ED15, 0xF0029E685F41F388, 0x421779A135258063, 
-0xBCE982ECD5D95A45, 0x4B0993A2BD879FF2, 0x9C7AF511561B5C4, 0x1268635874C87A, 
-0x116FDA4684796C0, 0xB3D2E6030C559883, 0x817133D0AFAAB24B, 0x331B5A6A4F6B1517, 
-0x10456AE3D977508E, 0xDEF738E48B9F693C, 0xAFD30B355479E25A, 0x13EDFB48C0722B, 
-0x15181D11F2673EF6, 0x4E5C7816A97CF00C, 0xD4242A6D82E51AFC, 0x679555BD69F32229, 
-0x68D2E63424AA3FC5, 0xCB423EECBF41FB4C, 0x8FB1CCF8D6039FAF, 0x3A687332C4A791, 
-0xCE4E2CDD034F7811, 0xFF1CD5D4A7124932, 0xEEB0C886286782E6, 0x2F0D208FC084CC2A, 
-0xF7BBBBC9B5A13AD1, 0xD50BAFCCE159537D, 0x5510FFF2F849D1D7, 0x2AA11B6BA12167, 
-0xBCFA287513F59258, 0x922A98DE67656C7, 0x88AE22F5D0630AE6, 0xEB4B102D54054E90, 
-0xBF6AFF8BF030880D, 0xF477B9CD76C25E2B, 0x517ADFD831ED9CCB, 0x374B76077C81EC, 
-0x9948DFFADB1743B5, 0x896A92F89B83B88E, 0xC8562D357649C053, 0x6C3CFF149ED7D58E, 
-0x971830741278DC09, 0x276FB872E11F1752, 0x5F0E313A9CC9D535, 0x88B6C66F7EE79, 
-0xBCCD82D44938FC04, 0x7128864DEB77B0A1, 0x6FFC99015E6704BF, 0x4BCED7CDDDF69D4D, 
-0x3666CFDBF04B387C, 0xD5F1D99B2CFFD1E5, 0xA4A99A2620B093F4, 0xFD063AFD7EB4D, 
-0xE59DD18829108869, 0x7728DE6889FD5EB4, 0xCC3F0B627F3905C5, 0x514C2D5BA4BE43B5, 
-0xC783D15A881F6F7D, 0xDDF430EE4321DDB1, 0x52A71DDDC22989CF, 0x8B10A4CB43F50, 
-0x26907BAE399C184, 0x9C594805E902CAC5, 0x247F1671861645F8, 0x7AE9124111924D6A, 
-0x69BF5D38750C621B, 0xE9976C5DA8142A2, 0xFD26CE3B1F018600, 0x5878732F75FC1, 
-0xF49A785D9A9452A4, 0x1A03CEAEB34A25CE, 0xEAD7B3A6556A2CC6, 0xCEC344A706AAAC0, 
-0x68D84B0E0621B97E, 0x56D8C9681B0C3A6D, 0x8222535FCF1A7C22, 0x3C60F047450E37, 
-0x4EE8BC8781319671, 0xFE005C850DBDF38D, 0x1911164A35BD0F3E, 0x5E9E854FAB48424E, 
-0x50251D49DE4720E, 0xD722257C855F0351, 0x429E3D8E20F628D2, 0xB6601DD33901E, 
-0xA2B3A52CC30FFDB, 0xE3FF6A670064B3F7, 0xDA97848FE653CEBB, 0xD1C5C2E03C182C00, 
-0x6674097CA8C264E5, 0x1074ABB52F2A4EED, 0xE0CD6042B38F7B7, 0x3AD4AA78F6A75E, 
-0x75340FA9A77A97EA, 0xD092B8DF1C20AD1B, 0x4C08189C06147CB5, 0xF0C189AC870AF67A, 
-0x1FFCAB4457360CB9, 0xD995BA2AC5EAFFAC, 0x63A8A4C5070B0350, 0x320812A3A88898, 
-0x2DA68D56D0E8C787, 0x425959E0021D084, 0xC1E573EC2C60191A, 0xB706FDD3F5E28F17, 
-0x8EEEF9FBC2FC909D, 0xB799147CA0CB1143, 0x449CC06A931AE33E, 0x2DFF43E675D841, 
-0x4C48E2E10A52AF19, 0x9CAA5210C322C5F, 0x80C67CEA637FADA4, 0xB31EEB047560C182, 
-0x2E06787F9C85BB26, 0xE2EB965D1F45015F, 0x405164B80CEF8CDC, 0x1FA85B650EEAF0, 
-0xFB0FE1D7A92CBC03, 0x1A23AAEA8ED45A7B, 0x8FC0DE2F6C306E3F, 0xBCE7AD4CA9B00822, 
-0x5EEFC9CA5E4173D8, 0xB5D59329B50701BA, 0xF88F537B8FE0F556, 0x362F48EBA4D13E, 
-0xE66973EB41E89AF6, 0x1FFC68F59E25DD9C, 0x3CF4A079EC887157, 0x3282C261CA0CA513, 
-0x91BF482C6C18B804, 0x9513B25E9963C394, 0x33A3E35963643C7D, 0x165E88F4200C30, 
-0x78903832A459C23, 0x5FCB1035FCA21E78, 0x8C6DEF61C8FA4950, 0x956A8CCAC0CDD7FF, 
-0x951C17B549262076, 0x988B3862DDB1CBD3, 0x5ED8545C54741D7E, 0x1984BED4912DE9, 
-0xFC89A514DDB3A2E9, 0xF9268679792A2111, 0x4310439290499012, 0xB49319A780F97627, 
-0x6A8A047D9F45F74E, 0xA55822937FABC2FC, 0x7DFC3CA594660F38, 0x3442620CE4FF04, 
-0x2674428129A1CDF5, 0xCEB221996DF4D4E2, 0x7BC2609873DF6AE7, 0xC982FC4D1DC4DA07, 
-0xBAF115EB2AC2B809, 0x712B838848656A2C, 0x9101AE9F8713B30A, 0x6ADA246587903, 
-0x8EC2701F5E0066B1, 0x9D428B309AD1F733, 0x432F9EB8C74B446, 0xFD5C27ECD1DB934C, 
-0xD83F51E1DA317CF7, 0x1F504F0BEAE21F39, 0xB7AC601B51A25F82, 0xBD59108213778, 
-0x2157710764245BC0, 0xD82741F95F3B8B40, 0xB862831415009884, 0x3F5D32E228611D65, 
-0xDD8FF5F6E6EBD773, 0x8FEC2431FB0E372D, 0x2CFA916CCD01F52A, 0x16E399954CB315, 
-0x1AADBE2783D69B1E, 0x5B2850CF463E001E, 0x4967AA4F430B0095, 0x6D2B5F0138C6E9C4, 
-0x360A2D5C350100E2, 0xD11D075A2788B7D8, 0x7ADE0492DAD69A97, 0x35417E6AB3B144, 
-0x308E5D46B299E69, 0x57F603A21EB48EBE, 0x5B7D45CEBBA681BB, 0xC5D68B5BB7060078, 
-0x9233C2192CC44A43, 0x1766AE8024CA5DBE, 0xCB3A433BADD08DC6, 0x38FF2613998F40, 
-0x29D077E3962EB313, 0xBE242D6364407146, 0x4350E8317DCDAB96, 0xAC866EF8F4EB9E64, 
-0xC1536A9C4D1DE0BD, 0x1EFF63A4C9A80E75, 0x91B7AA95F9E37B0D, 0x385E3D07360C4A, 
-0xE8DACE754787D44B, 0x1F6CCD99312BAF20, 0xB3BC5FA8649D7A0A, 0x417E09F794F27FDE, 
-0xFC2D313AB73C8DE1, 0x9495A1C769EDE8FA, 0x5C8EA1EB5440F5F2, 0x2220D9757D4B09, 
-0x62E70BD53926BA64, 0x2A3B934D85C33F05, 0xC05A5182EECB4A05, 0x8BA502CD1B5317FA, 
-0x77B2A18B18B02411, 0xE1F6FE5AA2D36080, 0x1DD4DB1FD93C330E, 0x3BCDCD84680B50, 
-0xA5E3C610E499CBE2, 0x6D0F748711D597B3, 0x99A6A7B2125EAC7C, 0x8BC16493179480AB, 
-0xAC5A3D0F726C7AC8, 0x91187734CBFF91F2, 0xEBA5D7283283D9E3, 0xAABEE419EF2B8, 
-0xC9A80F4FDCBAB127, 0x957A78EB74069B48, 0x3D34AC746C228910, 0xD024744DB071739F, 
-0x3F3586CEDC0804E0, 0xDF89A326796628CA, 0x9742CC6E3D4E8763, 0x3A985E5C215D64, 
-0xB7CE8B11E3C4406F, 0xC61A44471A610982, 0x99F92557280D5540, 0x445087EE6F268526, 
-0x3747A416FA05462F, 0x339865D51B466D34, 0x450B61E2EC2F724E, 0x361AEE392191B8, 
-0x721F084C92D9F365, 0x100E93C0DD81BB9F, 0x14C28F7EA279989E, 0xECDEF829A23C7295, 
-0xC709E411B987D0A3, 0xF90BB13D6F977E74, 0xAB10C4E113CE6E88, 0x33ACF6837175F2, 
-0xCEC9B693ADFE5CC7, 0xFED886FAD3182C7B, 0xBC624EADC1606A51, 0x4D2FA3DCBCB5C0E3, 
-0x7F2C2885D15E21B4, 0xBCCCE1DF91187768, 0xFF3F411BBD5E5FF2, 0x1F046318B6464F, 
-0xAAAE1038CCFCDF4E, 0xBA4D3DB64655AEC9, 0x6E090F82744F4E9, 0x18FF57D91DE2634C, 
-0xAFA3073BD7E864D0, 0x8D78B47244191A0B, 0xF3CF4F16DFAAC9EF, 0x15093DE28C28F9, 
-0x760D6599AA0C9BB3, 0x86A081EEC8614EDD, 0x1EEF13A537664A94, 0x4CE6BB67329AA20D, 
-0x64B9609C6453C772, 0xB08B9DD8060333E3, 0xCB4D3432D6094AEF, 0x3E9A97112504D0, 
-0xA0D3688154C5463A, 0x72797C168D40C728, 0x8DE653B82E5B800B, 0xEC4BD9B1B3140CB, 
-0x64F65741E2C49C43, 0xCB69F98D5404B2C, 0x6EC386288832B887, 0x2EAA2474B4BD45, 
-0x69F564A116F7D150, 0xD5AEB39000239E6, 0x59FAF114ECE6F9B3, 0x29A263D7FE0B80EE, 
-0x9E65A5FBF722352E, 0x2777A19870D9449C, 0x1122C6FD53F75FE6, 0x1654513BC49C28, 
-0xB3F2024BF7C2839B, 0x89DC1711B6FBDFB8, 0xA914B5B36EA8138B, 0x364EA06DB11B26CE, 
-0xCF22AA8BEB7F4B48, 0xCF5EC6682027D3E5, 0xA667CD676D84FCBF, 0x3AF4888F976F73, 
-0xC356057544859AB6, 0x9FFEF7383E858EBD, 0x5EE63A23E2B404C3, 0xEB50A501C4B1189D, 
-0x71841FE2DD6EA067, 0xEC8C1605C17C0E14, 0x442993E73B82BF41, 0x349DCE0753DC9C, 
-0x50640F789D21EF4A, 0xBC143EEE38B08C0F, 0xF93160B059A11663, 0x70FAC7C03DD14A79, 
-0xEA4126DBFD0241D5, 0x455DDF2B2715C671, 0xC70D4E9B80741EDD, 0x84A80BE60C542, 
-0x2E29D4962FCA9FCB, 0xC87C49D4506EE2AA, 0xE32CF40A41001B04, 0xE3767AF1B32469F, 
-0x83B56CE84CC78A0F, 0x8385E6CCBC0B543D, 0xA91514514F6A7CD3, 0x367C3196D0D4E6, 
-0x24CAB0017C900614, 0x743A352C0EB387E6, 0xF5171CEB66386E0C, 0x81342AC24CAB85DF, 
-0x9CEE36715958FF53, 0x171617C726CDFA74, 0xD8440915D2B11595, 0x140E5226D304CA, 
-0x23870B2B8FDF731E, 0xBC800A26F9611FD4, 0x956CD9F299167174, 0x97B93429E1F5778C, 
-0x95432815C0B1706B, 0x8DB70BF146A1DCCF, 0xCCE680D3B58C8ECD, 0x1F364AC5C4EF92, 
-0x854FACCB78838A03, 0x4C4F6CDB49FE1E1F, 0xC80F568B7F0F5D9, 0x43BC188CBF2841CC, 
-0x7D8ED3A0C0683B51, 0xC3898F049B23063E, 0xD9A8F76CAA2523B5, 0x3CAB1847C9F075, 
-0x3DECD1B8A6ECA921, 0x77E4DED0D40EEA51, 0xCBE3E615C4C13399, 0x7A4B044AFA7C702A, 
-0x37FBD1BA3840786A, 0x7946129870C71B82, 0x33A7894BEB22AE6, 0x169ACC9C4516C1, 
-0x4938F8BB45311292, 0xAF4509EF20568B5F, 0xB98285E6B0FC98BB, 0x5DD6EB75CD849684, 
-0xF1EBC74E7670917, 0x993306B6BD2117FD, 0xE4E5112E7018F497, 0x11D15072A3349A, 
-0x1B67DD46AB731201, 0x55ED4F273076B1A9, 0x79639DB640D3D694, 0xA2CE7CDF2301E75A, 
-0xCB9F0B7814D4206D, 0x5896DE479A6CE4D5, 0xBDE92DF105229C9A, 0x33EB0203ACDA51, 
-0x7ECD963C66EBA721, 0xE9842B3A19B6EB66, 0x93E190FA0C1913AB, 0x92A08C9138B20DE7, 
-0x9F26D43467CCB0E6, 0x875D0C867CDEAB02, 0x7EDCD6FD48BB51D1, 0x1C5121971E5E78, 
-0x75BAAF4771B3A256, 0x2ED58D980389679E, 0xC8AABC6EEE212474, 0x584A0CD59AF5C644, 
-0x14B189BC904E954E, 0xF6FFFF43650AD713, 0x618D21F887259848, 0x1A6DEB70A14768, 
-0xDD78135E29DFCD46, 0xBA2BD555905A0F44, 0xAD21E0B6DAD953E, 0xA0167559038005A1, 
-0xDB2224992CFA37F4, 0x163B2347A655C80C, 0xCC01BA8946BD1E5A, 0x2DD5A52647249F, 
-0x5895F7BCFBB7DFFB, 0x3C8A07DE27E7B003, 0x6FE58127B9734F8A, 0x626BB23AE3B8F02, 
-0xD559D97C2CA4BCDB, 0x545BB36276CBB2D3, 0xCB33D1EA8F11923C, 0x27DA129DA4293, 
-0x5AAF125911D2AF40, 0x80FFFA2482A51308, 0x813941E1E6F20EDD, 0x18721058111D7D4E, 
-0x9792FE7B41E4BB83, 0xAD31B9D0A92D99CA, 0x969BBB17FCF6EEE9, 0x23687D5949904C, 
-0x471BE7FC6357619E, 0xD2839BC52243355F, 0xF2EC035AAFA8547C, 0xA732A47D8952B91E, 
-0x5E25A3C2742FE254, 0x6C482C9E98742ED8, 0xE39254E6BD61425F, 0x2B958BAE0336AC, 
-0x7072426302573F20, 0x6D77CD3DB71C41FD, 0xA80961DF7D340547, 0xA202E3E95B3C13E7, 
-0x46BFB780BC9D87C4, 0x3A4277DDC10DF351, 0xBD078AD14181EAEB, 0x282BBFA30503FB, 
-0xD6B342AEE3164087, 0x60209128625CBE50, 0x96D7A690419FC888, 0xD7DA0B7C8C921D17, 
-0x88DBA70967B86134, 0x38453A6A71363829, 0x3D1288812ED2AEDC, 0x17122A24286695, 
-0x1A2FF4D3DA2711E, 0xF37ED62FF5ADB47E, 0x8BC40F20C230313, 0x48C3BCC945281325, 
-0xE10B87A6F46AA432, 0xFA65606A811687BC, 0xAC608EEA7E8D93A2, 0x3F675048034338, 
-0xFA26EFBF56AFC0F2, 0x72C7571FFA5FFE06, 0x578DE1D85487B440, 0x768D202BF1916D9F, 
-0x499FF5EF76E00A4, 0x430FB0A4B7EFC25, 0xB4DE91D06405B77, 0x3046F787CE73EA, 
-0xF0866B9646E1FC9, 0xEEF81EC7C7953277, 0x3C3455A34B767F47, 0x774B741A5CE65E9D, 
-0xD817DCDDC8ACC2DF, 0xFD68C715D126BD19, 0x29BF192618E168F7, 0x155865DE4B27F5, 
-0x86347F24C1894BC9, 0x1D23B702204DDFD0, 0x8BB529B1E1B349E4, 0x260961AB220E2AF0, 
-0x2E9D001310EE1F76, 0xE3C7BCA0F6576926, 0xE14A8331D5192BF6, 0x2D5A76F8BD6E7B, 
-0x8A498F86AFB67BDF, 0x85BD97B3C229C771, 0x9E22CDE3EB32358C, 0xBDE8DD27141605E1, 
-0x1134D4CD2BCCC685, 0x924A9485B12FA196, 0x53A118CC1190B3B5, 0x37267732E3CE90, 
-0x3EDBC81049D69A8B, 0x8830F59EB2D8D48A, 0xDB1AFA58FE4E4D32, 0xDB5A62343E711FCF, 
-0x5E6989F40BBB6D68, 0xD908634F3A9DC80C, 0x8B0736438B8B165F, 0xE7FA32FC0AA6F, 
-0x9112313FCEB94AE4, 0xF2192955239AA99F, 0xA0BA7DE6477FD093, 0x9635BDB9565719DA, 
-0xBDB9C9AB44DDFF34, 0xCB0A7C2BA9BC44B1, 0xCCB63816B4D107CE, 0x289B3D4DF4CB1B, 
-0x42DCABEB301478A9, 0xC350894F03317591, 0x969FAFB913ED96E0, 0xE255A32CFC5D2FE1, 
-0xDC58503C3632D0AE, 0x4FA0AF315A5776BD, 0x3BFEB2ED083AD008, 0x30BAE1BF3BD2F, 
-0xA7DEC04EA9956F4A, 0x7CE4C113372169EA, 0x72BF7E06192AFF75, 0xDE5806F2D1F48664, 
-0xD6D44090CAE70A4E, 0x2D5B0612B7952F19, 0x95209E96B35E3347, 0x135399AA1E4687, 
-0x4F0B179909DBE1D4, 0x6BDA0BE61CC134DF, 0xC2F6601D790104ED, 0xBFA54B8EC8E42F8D, 
-0xD95F0D9287BAB4A6, 0x128A62F111C128BA, 0x30A6AF961D7CBDC5, 0x2111477BDF1757, 
-0x16C76456BA9A341A, 0x1D3583999F8D5FDE, 0x53FBC457EE47A522, 0x589EA9A05A574DAB, 
-0x83D4084144B3618A, 0xC2B6B3630CF1E348, 0xCDAB5C6F201B259F, 0x1C98C981681375, 
-0x29AD3407CC0BBEFF, 0xBF55E431F3FD4C00, 0xB7B396DC01772E, 0x2A72CE39568330EB, 
-0xF315A9553A5D70B2, 0x40FC5C9177E1B760, 0x8B53DBDF2BA756F7, 0x110362DD7B278B, 
-0xC09B8A123BDD22B5, 0x41E323A3E38EE735, 0xFC140B584DA2180D, 0x34B5C49C62D0987, 
-0x1647D7E87EA369C3, 0x78A5BB18D07040B0, 0xEC10F44005F917F2, 0x6754C4FE2FD54, 
-0xBC8984D455A45124, 0x697D2D2464FDD1B7, 0x21125D9175320D24, 0x69A11B55EE3F5C08, 
-0x401C6313B6FF44A5, 0x98DA5B5B13CBF6DD, 0x454DC9A323A9663, 0x13CF33574BEC8E, 
-0xAEF470929A8B597A, 0x3FBD6A9D37475197, 0xA70C7A4129B31918, 0x41DB04C911F7D8B3, 
-0xFC5FFFFC3158796C, 0xC6EAF9DADDA8ADE2, 0x4A1AACB3B514415B, 0x2050D13F7C676E, 
-0x85F29D18F89BE844, 0xF40C268B84FE2447, 0xF7CAC5D1E69B41A5, 0x44A2A4850C3EC439, 
-0xAB4192336A71BE11, 0x573DDA91C763FD62, 0x97B29EF477B0A7A1, 0x10118993EEB0E7, 
-0xC93BD6424EB7F2D5, 0xA88F01D2CD1F367F, 0xAEAC469B9F273B7A, 0xBEE20233C3D9526E, 
-0xCCCFA2B6C6D58B7D, 0x3EC1815287B30977, 0x4F22D905177E50C1, 0x200A3B8F523AE2, 
-0x7EF5C87FC0B702F8, 0xBFF1E90FA586D19B, 0x961CB8FA1C6167EA, 0xDA70E561501CDAD5, 
-0x9D19CB88EA7712BA, 0xED461AD55A2F8D3B, 0xF3ACDDD03EAB88B5, 0x39F745B8BF5C35, 
-0x9F0A3E848FE38E96, 0xA479157840FFA940, 0xD777530A7BE97A71, 0x5A708D869F15E45C, 
-0xBFA464951CECC517, 0x85CA61AF391EDBBA, 0x94BFBDCC3577C29D, 0x80BD76C9A36D, 
-0xE96A5F9D5234EC31, 0x956A9F26584AF281, 0x1EA5E59C13FA593B, 0xCC1FE2343FDB611, 
-0x64468346749CB789, 0x531D9A7B7D31BC18, 0xB32EE0C1C1C72029, 0x18D19952C454F5, 
-0x8A58820BAC540B21, 0xAA6C3C837D015F61, 0x3DC0129280ABBB98, 0x9B14E776F0F4409E, 
-0x532ED3B90D17149B, 0x430317B2A3F66E75, 0x7A0303F373444EA1, 0x1D572B3A58B033, 
-0x8E00B0526F86CDE3, 0x25EFE34898C76BE7, 0xDD10774AB2E89346, 0x9A17AAFB4CFF1E09, 
-0x69F267781D1DBF8, 0x133CA6F3BB030C55, 0x966309D562E741A1, 0x2C6A6B4070781D, 
-0x3EC576169AFE0AA8, 0xEBA3E54EACFD55DE, 0x6A77D08D306D191, 0x8890C5E49E7D3BF2, 
-0x71CE4970A19E5F91, 0xE53CD4FB259CD234, 0xA46FB4C96DCA9F5D, 0xBB69A70934686, 
-0xEAE6A91740B62A6C, 0x9D91F5CB4212D6CF, 0x6D0D655B7546440E, 0x25F0624A85A6319B, 
-0x513BCE0D2ECFAC64, 0xEA18619CB27B3029, 0x324A902AE206B4, 0x5EB469F76A25, 
-0x4B9E8BD28D58BD1C, 0x7041A4F834C3468E, 0xA7E56F6A8660196B, 0xE8F6E73512866FD0, 
-0x192D2D9BCA694FC8, 0x653BEE5C4AAF447F, 0x375312F620FA8709, 0x261EEF9970D68D, 
-0xFBB3884830870531, 0x89F527A1B9F9EE22, 0x8824C9306EB81F4, 0xCE123E6956CE3EE2, 
-0x6A56C3CDC9FDB366, 0x8B61A60ED754B3B9, 0xDED6020B9B9E901, 0x2EA300E199DF59, 
-0xBDA5D33E8A74AD36, 0xFA2CD4F27AAE21C, 0xFC45245096F2A8C4, 0x850341637E6DFD87, 
-0x6E3CB5743C4BA096, 0x299E49DAD5A2AA64, 0x350FEACEA19351C8, 0x1EEBA35F6D13DD, 
-0xBC2BF8A3A33F7CEC, 0x4E0D409D77DC8BF9, 0xC2D96C7072443CD0, 0x8D58A6AA062F604, 
-0xC2C078A6A38E27DA, 0xAFA7774C984081AC, 0x65F674113D9CD725, 0x3E81C4BC350EA, 
-0xD437EA2D333A4FA2, 0x3ED9BD49C483D4B6, 0x9B79E723234B534A, 0x974F877BBE4A454A, 
-0xEDAF828A8287FA26, 0xDED6E11FC07A6E85, 0x51B35CE671240F55, 0x3130D946FFC268, 
-0x8CF713006120F411, 0xF4BACBDEBDBEE8B3, 0xA40C9FCFC94A15C6, 0x152240AFEB8DC4ED, 
-0x211E32C9207B1A0F, 0x796913537F3C4987, 0x9DD686915F3A1714, 0x1392F6BB8814F6, 
-0xDEBA14FAF0FDECC7, 0x9520A29A8F24EDA7, 0xA162A2652876A991, 0x5575E870FD3906A5, 
-0x8F00B2ABA4380FE0, 0x45D033BB3164A97B, 0x7C3720673447079F, 0x1A429AC234FC1D, 
-0x9BA084013EE0617F, 0xDB4912E043D0443, 0x6C91AF433C864F2E, 0xCE3B4F4EDED91750, 
-0x7086AF54256B5C55, 0xAAEAEECEA79A00F8, 0x81DA8F934C53476B, 0x48CD398EE9364, 
-0xE3C7352A77EC3A11, 0x315145416C92903D, 0xFDBFF8988838B44F, 0x6F37B6577A19CF4E, 
-0x1378DE48C6A7E930, 0x4E0A652950BBAEF9, 0xF58C71DB60F06FAE, 0x165902DE801B50, 
-0xBED387B36C5D479C, 0x5B2B8C410A4FF528, 0xBBF5C4A60716E298, 0xD1CE52976AF04F47, 
-0x100D08A9957F6AE9, 0xFB9173018C4B6F9B, 0x51F5F6B5ACE88B76, 0x1FC0A7B90EFA69, 
-0xF9FF776381574459, 0x714BE2188CD59A5D, 0x8C51432AA7F21A37, 0xB7EBF812D07AB099, 
-0x32800365CFD50295, 0xAA5B3B5A9C75332F, 0xF83EDBDA50AF131B, 0x368618AC5B12DA, 
-0xE1A423F6D10C4195, 0x63F066262A08F0D7, 0xBE945A5751EB4FB0, 0x308D1251DC6CC67E, 
-0x8555A94D059E23FB, 0x8E3943F7AB6EFC63, 0x6C089CA12C00A6FD, 0x214160B00FC6C1, 
-0xFC432579B31518C4, 0x5D41E10A7B8C531, 0xA1E7AD9ADC464A33, 0x96154644A145B0B4, 
-0xD739968E38639028, 0xF58B52D4E981F34C, 0xC7A58B3CE4E325ED, 0x21D914E510C889, 
-0x4150ED64ECA4A5B4, 0x51040DA157D59B30, 0xE556E490662285F, 0x5DE7A920B4BE221F, 
-0xCC0A9A1369B2D3DA, 0xCDB3C9F6465E7572, 0xB4B9BE7D512934AD, 0x11AF4053E1443, 
-0x2FC668C2F15625A0, 0xCE8022EC5C900B62, 0x75BD442F956BA9F0, 0x2D96007EDA234D9D, 
-0xA49321AC42F89CAC, 0x313AE9132A0035DE, 0x2928AD67651C6FE5, 0x136F90F33C57C9, 
-0x946BB76F629168CF, 0xAACB84C1EF01F0B7, 0xBB35B71CB51A25DE, 0xC33A887C703CA9D5, 
-0x1063150F910205D3, 0x9BFF8694AC10D3CE, 0xAE539A61BCFF62DD, 0x2F48C02C73AF0E, 
-0x767322D71B96B45B, 0x7839C8413DF88253, 0x76DE1B1525283E92, 0x34849EF017A80EE3, 
-0x593415A8A147244E, 0xA1F9C76CAD23F90A, 0xAE52F202B12483D3, 0x391A392599F19B, 
-0x3020F44DFA448F86, 0x166F91E8BA5C3F9C, 0xB69804BE21457031, 0xDAFEE9494FF709F8, 
-0xCC5114CD3111D351, 0xD78E7F2A1EACFCF6, 0x4EBE658FE6F8EF49, 0x1D02BB12A516BB, 
-0x7F85039465D3078A, 0x67AFBB3563166733, 0xBD45E64658A4F3C, 0xA343338A5A97D33, 
-0x79CA6B979DDD4A96, 0x92C0D399C06E3796, 0xCA6942D68D426163, 0xA6A38BFC1535A, 
-0x368C6254D4E05011, 0xEAEA7A103227F21B, 0x57DBDDBD2DF8C418, 0x722F943C22EA5311, 
-0xF5BC5FA53E95FED4, 0xC9B1750CA3EF1F41, 0x44096B8D9043CC30, 0x298D19B44A1801, 
-0xF318DF02A5AC8826, 0xFE5451230B1C821E, 0x4BABB50436CFBCFA, 0x7BB343FA8FF2277A, 
-0x8883DA108AA7B0B4, 0x562CFFBEA46F1F06, 0x51B07F465EF1AB93, 0x26D8808BA9F5BF, 
-0xA88AB1A9833B4E95, 0x8A3B75AB519D99CD, 0xACAF8E7E0026C08A, 0x9AC6A3A00D6FA9CB, 
-0x4DC79B8B8F981952, 0x1938F90429FA8488, 0x99726C4A4C1AE934, 0x3CA80968664FD4, 
-0xF5EDF90829902AC8, 0xC5A6DC8461C8DF6D, 0x872E1C1DE7D1F7BE, 0xBC5C95998B612B0C, 
-0xABFE8E9B040B40A5, 0x365F76DCDA16BF6B, 0xC335764119DE58F4, 0x28AEE9BCE3CCCC, 
-0xEC588DD4D051D04D, 0x1A6FDE696D9FF1FF, 0x7F0EF498E5D786D8, 0x506A9D609714F4C, 
-0x3409C29939B37CC8, 0x6CCF84AD76E20D4, 0x6DEBB0612E4C17DB, 0x1A5C7D06BAB8C1, 
-0xCA30FA38F6992C6, 0xACD4C5ACE6FDFFCA, 0x40C4560A31101C8B, 0x5E58B32148019EB7, 
-0xF42DC2AC0117F98A, 0x67603D88C8A9F728, 0xED7602B79DB9E747, 0x388B157D8A3FF8, 
-0x2AF94725002E61B8, 0x4E0A3808DD36C745, 0x18DF5C7514D45973, 0x723C91A253FEF7EF, 
-0x6035D45C02190381, 0xC779733FE44B49A, 0xDDD8A42C92F4AA8D, 0x3E0E10BE38D07F, 
-0x7FE88A28F4DD92C5, 0xFE916749D3B717FD, 0xABAC64282E880CE5, 0x6488C5F31FD57CA9, 
-0x1D75C412C99839EB, 0xA0CAB0F123A25E57, 0xBA124D7FAD93B67A, 0x12C98F3BD2B45B, 
-0xEDF9B2109FF006E5, 0xD2F02D199E7BEE8B, 0xAEB4184E7F388934, 0x5232DC9176098742, 
-0x8D938AD735C277CC, 0x3CBCAACDA9E8120, 0xC391F4A24B62E03B, 0x2EE67C854AB661, 
-0x27CD295765E1CCC4, 0xCAA33E62ADD07AA4, 0x3F0DDFDC67B724CE, 0x4F19B84AA9BF8B80, 
-0x4EF96F231F588852, 0xB48CF7AAE27B391, 0xEB54EBCFD26E0BC1, 0x278B315809A91E, 
-0xD8A9B3D747C19D44, 0x31309B658B74BDD1, 0x7C0BE9BEB5A10A65, 0xA4E4193FD3BF5CE7, 
-0xB11FDB37819CD623, 0x2C006E37E530BD99, 0x95B73FB943F6DA46, 0x134DDAB09FC13E, 
-0x372CE257E42AD98F, 0xE0F5FB5A3C2E500B, 0x6790E3CFB0F44816, 0x60367A815C3458EA, 
-0xF0B3B59BB62DE9A1, 0x75E508627DEDF0CC, 0x52E811A5529F30F4, 0x11A6E8652EA4EF, 
-0x7AB4B1C0329856E5, 0xC7B5E24AED68C205, 0x1C9D01AD092B9464, 0xF23D855423017092, 
-0xE1B4B3BC10762D0D, 0xA90D52F9B074B116, 0xC1E631D9C4A9CE19, 0x66F5040B8F512, 
-0x41E014CFE322FCFC, 0xAAF8C215730C3173, 0xABC8CB9851161707, 0xEBCF663D2DA1835C, 
-0xA85C6D14BCD01A5E, 0x449455B06472BF4D, 0xE5A5DC17F7D7FC23, 0x256335340105B7, 
-0x671D0E61BF977035, 0xE5723CF89998B02C, 0x3D88E1DBD578E26C, 0x5153B1A5DB9F768E, 
-0x3B5EBC8C3C9463C4, 0x533D0B70932260BC, 0x31A7E0E88E638461, 0x2B8FDCD6EF3507, 
-0xA375B1177BFABAA1, 0x5FF8B6640A56E8BB, 0xFFF06D1D767D91EB, 0x3E07DC03ACEE65FE, 
-0x209411BC165680DD, 0xD6E74C48ACDF8730, 0x6A0425EE327DA0BC, 0x31072F0FCFD4DC, 
-0x79CAB56727ED72C3, 0x38B70CEE92831C1A, 0xB400D8CFF8A44F58, 0x51D0420C6F15A28B, 
-0x203655286DB65E72, 0xD218273277B4680C, 0xF440531EADF83326, 0x3726CF86C0209A, 
-0x842D1F408DFEA3B3, 0x4D58BC2BE15A2585, 0xDADDC73E5486D837, 0x781B3154ECC90FEF, 
-0x26BDE6F5794BC6D6, 0x6254ED956BD0FD97, 0xF2534FB222C896B1, 0x3B1F412D895E0D, 
-0xB66954D0091DF4C1, 0x6DCBD95C5800C0ED, 0x59346BB952023FEF, 0x247ADB1AF77A05B9, 
-0xD0C693A07646B9A4, 0xF9B56ACAFE3BA98A, 0x4413F314AF5DF0E2, 0x345E766C2164F0, 
-0xE2A5F66788E2F9BA, 0x87B36FE3EC124722, 0x6AC4FEB05AD637B4, 0xAEDC95E91ABE6934, 
-0x8A3DFF9D8BCD3CC9, 0xF71850DD33E7F67B, 0x88F1A07343127098, 0x2241C06EA858A2, 
-0x93CFD7FCCEC996A1, 0x674D48B5D1582B49, 0x45946A56CDF4CD0D, 0x66136ADF2E5893B0, 
-0x4F7F37684C6BCF54, 0x111FE9FBC0BE6399, 0x2D13599693774C6A, 0x2E6FF880EDFCA8, 
-0xA28B8B949ADD9576, 0x6A73CC0F9C6F1FAD, 0xB234354E3BFFB14, 0xE8F6305974B0E82F, 
-0x5722750B9A82C794, 0x88934486FE765382, 0xC697639AB47804C5, 0x3248AF10F7EB04, 
-0xF2E6B0F1889B85B3, 0x768DA9BF907DE487, 0xD0F22FDEC50125E7, 0xE34B58A977545D58, 
-0xA178FC731C726A14, 0xD198E85ACC4CA6A3, 0xB25BDEA6F9B2BBF6, 0x273429B8413B85, 
-0xF20ADE3AC0182F58, 0xE4931907EF560A60, 0x86CCDEFCA1B1329B, 0xE06DF7C7D96C5984, 
-0x321EF2225EE5D553, 0x56FD38ED964AC005, 0xB32A64365B91524D, 0xC414943577575, 
-0x80B1F0B7DFB58B10, 0x77062D0440E71A2A, 0x54D8AC4156926342, 0xEE0E6BADEED29F67, 
-0xF674457FC9634373, 0xDB6BA62AA56F2983, 0xDBCB2D83939F0FBB, 0x1349F722A51DFB, 
-0xAA677CD2D96C5307, 0xDBAF8C9DC72C8803, 0xA00D48D1E9C43C4F, 0x8BAAC500D4F8A9F2, 
-0x76FB9BA578511226, 0x51A682BFB5608912, 0x54022F2D6A41BD03, 0xC2BFF57315136, 
-0xDE8A1F8F3B51962, 0x6BBB26E25B6973F0, 0xB66C414BA13BF9BD, 0xB29EECCD6405293D, 
-0x1B6C7B2F6A895849, 0xE2F5598CD1046768, 0x7FE4C39454C80FC8, 0x19DAB82C48F2A4, 
-0x3477E40EACFA66DF, 0xFB22E3042310BA03, 0x48C80576C719DD28, 0x9D7353B3EDD280B0, 
-0x5B250A7C19F35875, 0xB4699759EAB3C777, 0xB7127BEEDF65ADF, 0x2AE5689085DBAE, 
-0x5A54C5925E5E7CCD, 0xA0752EB2C8DC8EDD, 0xA2466B774A54DEA2, 0x6FF33A04F8AD2D31, 
-0xA7E570514FB1ABE1, 0x8CAAF3AF68F17084, 0xB1F17A6CD8A6457C, 0x26CD4D3877589B, 
-0xE9B98FEDCCF2193B, 0xFDBAC5EB8D1BC1DA, 0x5712206CB8E0EC9, 0x92B241CF54DF9AF3, 
-0x634C7AF286026FE, 0x56F0198FC8AA648F, 0x467939C49B076569, 0x2FE8C3B2C44159, 
-0x1A6F62A757301B36, 0x580633528A7EF7CB, 0x87734D5A249B0C4B, 0x67AC5EA079352B15, 
-0x4D9480A72B37FDD, 0x3D59B3A99F1539C1, 0xFAF527251B2D52C3, 0x2C2A28D2BF6708, 
-0x242D372C24B3BD84, 0xBBC70077A1D91954, 0x91AC0771F700A0A2, 0x11F4C534F543F5A5, 
-0x4FBA19A9C0CC20FC, 0xF3CBCA18C9E4F805, 0x329FE7AFEE1C7BA1, 0x3B54911535E54A, 
-0xED13F6AA53862EEC, 0x5888B9CFBA9082C3, 0x1AF28C690E902B63, 0xB63346564F891D48, 
-0xC0BAA0B86695AD54, 0x986F44D7726FC271, 0x5E52FDE8E8C0AAFF, 0x364AE3F625451C, 
-0x573828CF0FD1C864, 0x7FD6F1D903C26711, 0xC8D0967E482E3446, 0x22993E30DCA28E3C, 
-0x3F781FD4BCD1910B, 0xF55656AC567F0EE7, 0xF903372D5D4A8152, 0x16B835779B688D, 
-0x3E3587202AF14BA7, 0x8A255C30227299D8, 0xDD075225F9C32A75, 0x956B476ACC4CF46E, 
-0x798DA7976EDF2B37, 0x48941F28B310A4FE, 0x6C5CC316062DF739, 0x15A7774BAB5C90, 
-0x3EBFA2772CE57D19, 0xE14C75CF9E6D4BC7, 0xB1B64E6AE5613D38, 0xD3A05CA8B9F0593D, 
-0xB8308D10A5F3D4A3, 0xB897BBA985CCB5C7, 0x7C5E3F56997BD12C, 0x1115E9BD088F33, 
-0x9FC37DC4642ADD8A, 0x5BE671796F17288D, 0xEABF4A83392D6ABB, 0xC2C8DB88818D93A1, 
-0x58513EFF29E7CA04, 0x7F1AD20A960C1889, 0xAAC5C385CE8607BF, 0x29BFF7A19983B, 
-0x33FFFB784DB0D4D, 0x550E12010871DDBA, 0x3B73230EB58AD902, 0x74CD9BC96E248A70, 
-0xF618767AC621FC60, 0xD5C221FB1388C97B, 0xA762CE603D195690, 0x14AF98276772B0, 
-0xA476057808BDF8C0, 0xAFD4F115F18ADC57, 0x5A90931408F06460, 0xE15D9CD09156D0D4, 
-0x85EDEEF6D291B58D, 0xCC38627C25999C96, 0xD1197B086C47D229, 0x3AA86016885524, 
-0x3ACFC139A802B1F7, 0xA4FCE9EFA582370A, 0x46A67261993BB1A6, 0x309B346C05338B59, 
-0x57BDEB5653FCCEAE, 0x917B5FE94C0B0B09, 0xB2411463B3CA79B5, 0x2101C96C4C45A3, 
-0x2206A55371B6AC28, 0x887160190FB4B54A, 0xEC5D99E23B6FCF4D, 0x264C1F727B18B034, 
-0xA38BBC22918694FA, 0x4F370268C4C4A4D1, 0x3CEA2275AE169C1F, 0x83CC54340EB02, 
-0xCFFBE68BC58CA309, 0x4F32682B61F95118, 0xC352BF71ED03859E, 0x67FDEEA7A8FAE34, 
-0x3E5B2A24AAE28FF0, 0xFD898677F996555D, 0xAD0F281A87F24F06, 0x1E8C14FDE6A29F, 
-0x109DA349B393BE06, 0xC4E0F9E451CD5C8, 0x10FC9FDD306744D0, 0x701B4D4B7B486873, 
-0xE5A8AF98B393161B, 0x22F47A82515E2254, 0x5E7E7890E5589821, 0x299307BAD1BEDC, 
-0xB50DAD2FDC062C7, 0xC846459DB1B16457, 0xB07CC781FFEE2CC, 0x9A393943AD333013, 
-0x4EFF09AB92B53278, 0x34341DA11C039B00, 0xA7D6E9352862B589, 0x1EBCEA1236B29, 
-0x55583900297E4D01, 0x4C98267474A9E152, 0x63086EAA42824BE0, 0x5748527428847045, 
-0x7E4CEA1EFF12FD17, 0x29DFA60626F08CEF, 0x5430830130557E42, 0x1859D0E321E6D7, 
-0x58DE608600A0B2D4, 0xFB666E17775F0C6A, 0x69208D5FEBC522C7, 0xCCB0EDB67883F183, 
-0x4828B6CDBBA74991, 0xDF1F541322B4A7B4, 0xC05E1F06FA1DF932, 0x1DA5A5773341F6, 
-0x820131A9AFD2535B, 0x723DB253BB1DA742, 0x5A89FD82311D8A0D, 0xBA57D33689C10A91, 
-0x133E0CA740FCEBCD, 0x452C55C580DBD9AE, 0x57900914D9C24ED7, 0x2F943B58E87EF8, 
-0x122BD098552FE858, 0xDF1A340DFFFD6E81, 0x46C4B782AAFE480D, 0x58EE1FD12BE64355, 
-0x4081C246FF911AA0, 0x411F66AB0A7048CE, 0x625D8776B14BEFF6, 0x1C2981AD0E7EAC, 
-0x775B192204BC5910, 0x8FE318DD475662D5, 0x37109E3D5CBB52EA, 0x206EE03ED639FA41, 
-0x6BA82C794E86997E, 0xA2031E27C7D1E1F7, 0x992EF7768484B0A0, 0x1D5DA2FFFE3A61, 
-0x2B2864181BEE292F, 0xBF197001326298CE, 0x877F9F7C94ABFF0A, 0x82B4946154DB63B4, 
-0x26115214C733ACB4, 0xDB707D6B10977011, 0xC4A67F4D7010F670, 0x287CADA7941178, 
-0x89165E0A5C15A3CB, 0xBD68A7A0B6DE8422, 0x1DA6693F067A8A04, 0x2D8E75C773DEFAAD, 
-0x7BA833FB32F7819D, 0xC1F43C929A56FC12, 0x7533E4BF3C6A46F5, 0x1DA9C2F1620190, 
-0xAFF365B19444F5E, 0x7F0358050AA28C0A, 0x264D7CAA9C8E4CBD, 0x64AC6B5E18CBD336, 
-0x9F56568A83F1E473, 0xC886B4F8DEA81F8D, 0xC3BB844CF306FBC9, 0x1BCF971F5C19FF, 
-0x419B02926CC936A1, 0x960E843DE22308CB, 0xA7894CF57D49149C, 0x3C0DEB149B44988E, 
-0x5097E5BF7D762822, 0x17BA7ED5BAEDE9D0, 0x4B512D723341289F, 0x228F692F6C33C6, 
-0x6A77277DCEFEA0E5, 0x5F741E1A932A5FA9, 0xCCA16FAD8D586262, 0xE0B86231DDDFD9, 
-0x63080D0CB527438, 0xFA0921E621D502CE, 0xC025A8D15AC50A37, 0xC1DD4120A6810, 
-0x7BCAB7D4FF4828B7, 0x7D1C402F85BD2E65, 0x113F68441A98FE7, 0x127C9A45AE07850A, 
-0x681E620973B4F092, 0xA4491E09C9D9B35D, 0xD8B80919886D167D, 0x3949DB7B21BAD2, 
-0x51431196C770C653, 0xCB8357DD981D171E, 0x703DB1B7D960EF00, 0x25C58739FC1D8FCC, 
-0x23E174546BEBAD09, 0x89F2E36912EE2827, 0xEB9FEF687C263F33, 0x32B178F796D93F, 
-0x114C4EB36A6FCADF, 0x3D511E31CB6B125A, 0x3A54B07D17100132, 0xB7683585BD48CD10, 
-0xA233CE7AA010C10D, 0x2B9080BFE5EF4625, 0x4D8F6CFD5CB55FFE, 0x3556B860639B8, 
-0xBFD1D1F3175F3C6E, 0x536BDA97F7E0A886, 0x8E9267171B399ECA, 0x8E0E45150D4FB591, 
-0x90F56248832570B2, 0x86641821642547B1, 0xD5E428E134F2A528, 0x24DDD34C284779, 
-0x30751C9BA8941C84, 0xB093AD4AF6E65D8D, 0xD7D24DEDE14AEF6E, 0x90771195EDD3A412, 
-0xD82741788A2F80AC, 0xAFCDF9E1326D3492, 0x4CA7C4DDF24451A6, 0x371F2C3707A992, 
-0x13E954BE1C361FAB, 0x3436633D2BEA1DDE, 0x39C68779618E1296, 0xDA9E963DFA905460, 
-0xAA77BBFFAC0266E2, 0x387FDCEEECB0B031, 0xD768AB244E1A5E91, 0x13B6ABF6BFA2, 
-0xC002C5D9D9112B60, 0x9F7CFC2394951B9F, 0x1191A93C1F345238, 0x661E7BEE14CB0F68, 
-0xB575ED468342ED20, 0xA0A7C2228A8AD9E6, 0x9E42879E8732C36B, 0x2A81F4CBB86CF0, 
-0x15F87F1B028AE5EE, 0x980E63F81DE74D9B, 0x9784ED204A491E6D, 0xC508FA0AC82EB058, 
-0xC44ADE9C7DBA248A, 0xB57DE730787464A4, 0x63B9EFDD3BDF3244, 0x3169E152FFEA17, 
-0x7B22C6C1DF3BDE01, 0xEDD1D7E676EB3871, 0x728136B6708156D, 0x1EA7EF71878578A5, 
-0x59A9C207EABD8F33, 0x18847590D4ED99B2, 0x6F35252F96C3A011, 0x3AA6BE53B8E07E, 
-0xC9ABA2FFF467B5C7, 0x940E7440C8203F65, 0x6CFF6D6C06A4E186, 0xBDB13C45C73F6796, 
-0x9E3DD815EF681AB4, 0x40ECA513B7DFEB5D, 0xF4DAC282BEB27692, 0x2B9BBACB74CC63, 
-0x70F4824EDD6725FD, 0x27847D12ADD4F6E4, 0x4AECE4CA0492A1A9, 0xD2F5F3369EF7B145, 
-0x9FFE129EADA548BD, 0x4270535881CBD087, 0xA57AC215192FFFE3, 0x3080ABB6AF253A, 
-0xB7AD8C4C6B64A8BB, 0xAD6CDB46FABC04E6, 0xABF33129FEA8AAFA, 0x3A4AAD72C654CE7B, 
-0xF49010BDA0C48716, 0x4973075DD2D88E73, 0xE7D7C083D8F90ECA, 0x388A9C91E57E8C, 
-0x564CC9DE9FA32DE, 0xE1C6A04F685CB304, 0xDF8C079ED29BB5D6, 0x191C67B4BE3B1B96, 
-0x74611FEE8A51D6E8, 0xD886BBAC77F06B85, 0x2000A2F156B54B2F, 0x2BCB73F7CD972C, 
-0xCB97BCEF738CE9D, 0x244071F2F18108F2, 0x8FFB2B2D0D9768FA, 0xFACE0BD7C7325E3B, 
-0x52861A1E30954418, 0xC57150714F29579B, 0x75AE00E9AFC12145, 0x2A6CFCDA610F52, 
-0x14AA75BB5B205864, 0xE8CF58BAB53AEE17, 0xD1BBFE8A273A80F2, 0xF0B88E0D97BD8E08, 
-0xA2369596FAD48C6D, 0xF64E6D5B56575B3C, 0xCBD6BE5394AE3686, 0x4C326F610DDCF, 
-0x3459328CDBA473DB, 0x58C778ADD0586571, 0xC2FB597AA85AA245, 0xB89767CDE5BB67E1, 
-0x23C3FF0DA0D0DDC1, 0x37794F08192701A1, 0xB1DD5790B70BE6EF, 0x280B28AE5F13EB, 
-0xD8D9FA062FD96FA4, 0x7C8F6BFE285B6A02, 0x30DE5A7370C86446, 0xA3E1275FDA6D02CC, 
-0x597B25F63A51FFD, 0xA096D9D00D313614, 0xC210F8C72D8E574A, 0x7D48B622F940, 
-0xF892893DF33A004, 0xFD887AC6288584F, 0xAE47519E967991C0, 0xAD5FDA1C2133FC2E, 
-0xFA3424857028BA3B, 0xE66727372009165F, 0x2DBC79EC8C79E01F, 0x36814D27E6AA19, 
-0xB772201116E01481, 0x849B15CD149C3816, 0xF5D18854209BFAC3, 0x71340E42068E9427, 
-0xBC29DF714582F4C6, 0xBEB92DC842BD6070, 0x343CA799E5F70C82, 0x20DDCE56B03780, 
-0x2B3715AD6E9F51ED, 0x1AD8BBA64022021D, 0x5062CDCFC7AAAB47, 0x6FF619D4B0F1B724, 
-0x7854CB37C4667240, 0x92EDAF4985F3082F, 0x9AA5B53891138DEB, 0x7A3FB764676AC, 
-0x9F48462E59A6DE65, 0x51B402E0D07247B7, 0xBEF7D0541144B2A3, 0xA73CA79471DD52DA, 
-0x45D34A9225DA256E, 0x89EBB0BE2D448B2C, 0x317F585F28F62EA3, 0x2F6404793BD10F, 
-0xEE538317033AEE7, 0x11E0F32A4F4B3060, 0xA8DB763B980AC016, 0x93B3315DA5B021A5, 
-0x1A41BCD4EDD0C3A1, 0x4B3197AB533E6A57, 0x1032E9340A75C0FC, 0x2CF37070FC661D, 
-0xC401D87E9FD517A1, 0x828C6C40E03244FE, 0x76BE6F32F4B80186, 0x7066EFB19F5E29CD, 
-0x11BC40E1549D3C2F, 0x453072D35157D12, 0x82B9C533C7E539E9, 0x2096184DE74717, 
-0x17528702C01387D2, 0x936725FD9B3F3870, 0x1460FA3293BF0AE1, 0x30C172240A9638F8, 
-0x8BE1D777ADC3DE61, 0xA252F0C4D081F3B6, 0xC9CCA9993CAEC421, 0x36C92F7857880B, 
-0x1A2028A2B14CE147, 0xC02D73471EB8DBF6, 0xA17BB638EB15BBBE, 0xC5D96FBB45645E85, 
-0xA448FC66EE350B4D, 0x4CFFC45A9CB5EF58, 0xFD915D9BACE3EB0D, 0x74305F0B604BF, 
-0x2C6418CBBE5B2EA4, 0xA7C44CE1957CC4A4, 0x23735D5FB8997B7D, 0x90E44744A3A619D8, 
-0xF060A28CB6E8899D, 0x39CDAFE04F86019, 0x7B2FE2811518EBED, 0x2FF0095BEAC23B, 
-0x4E973B1CE7E7EEBD, 0x174FCC865C19C01, 0x6123E29B9F32232F, 0x100CAF4D64E3BBB, 
-0xD31EA683E1106863, 0x944988381889474B, 0xEF6CADFBA4D22402, 0x3487CC2CF140A9, 
-0x30C8E44E40BC660E, 0xB7F0B1F3F5933EE8, 0x99A91C75013607D2, 0x1ED183D4776573D5, 
-0xC153EEDFC84DD047, 0x4EF9CA32BA92E24D, 0x81F7B6DB55A09C0B, 0x1919C5231BD590, 
-0x7E36A1A94F40AE78, 0xD16E522355178350, 0x3F8E56DE87629AF4, 0x243730A777AC96C4, 
-0xD2620CF58E7658E1, 0x3142990771862EC, 0xEC9FB06DF7190A9D, 0x26C5A541DCE179, 
-0xCA8174E50DBCBD63, 0x5789EE24E03D9448, 0xCA6E2EFC1FB051BC, 0x40B700FF8AEE3795, 
-0xC60DD0CDEC7EFC8D, 0xD0C3E49C52F6483A, 0x897F93B9DC1E8B30, 0xFF56DB832D626, 
-0xF793B6EDA061E7B9, 0x843795390A208E99, 0xD716DD0F490FDA8D, 0xD1507A0A7DE5CC0C, 
-0x80A394D4561BFBDA, 0xD0C47597D68454C8, 0xD97D6BCC29C33C74, 0x1A932F61000953, 
-0x573EE53D451708A3, 0x218862891886DD34, 0x165EEA8A2FE7256A, 0x2A90C19DAEEE533B, 
-0xE002796BBD325854, 0x841C643090514898, 0x53F839EBF8D2D254, 0x3609E62C884EA3, 
-0xAC3F1058B0D3B661, 0x5AE937553A04C5B4, 0x653EC519E12C037B, 0xCAA7CB8146021D7, 
-0x6BF5FFFA1BDD24B3, 0xE6345B4CB2B6C80C, 0x1F5F10F395B008C6, 0x322DAF82E1894A, 
-0x2CCB179DFAEC53D7, 0x66825611AE6B115E, 0xFAB10D154451CF70, 0xA696F24962760F50, 
-0x5ADA5E4B4730D92E, 0x5F4264D6660FAC59, 0xFD920DCBBCEC02A8, 0x3F915EABDC9FB0, 
-0x87A39429F1650BB6, 0xFAD9FF9F66233C4E, 0xF28DE8027DC5D608, 0x5A232A5516543D8, 
-0xD718B5DA7CE64A9A, 0x378A59196B147FF1, 0x15C527E209E9FFD0, 0x3C3A8D046C3B1A, 
-0x797E109E74F7F590, 0x9C596885E88DD773, 0x7CD5FCC8DF243EE9, 0x77E00FBE1E1030F8, 
-0x641344B4B87D4FDC, 0xB760986F5B8F6DA5, 0x297E571A5F6103A6, 0x2A3187AF765938, 
-0xC4F384A482800B91, 0x4DE309900355DC71, 0x1C0B1FD94A8B71B7, 0x9ECB254AED5A2B3F, 
-0xE58C81E02328EDEA, 0x131BBEADDAA7DF48, 0xD1F47E00AC04CA41, 0x14F54F181A3C85, 
-0x9E0342B194C09412, 0xEBDA23DB8EB1AB07, 0x6E8076822AE5EB38, 0x322BFA963E8AF824, 
-0x28913692D6FC5A5E, 0xBFB2AA762F0C796, 0xB912959E4C76B080, 0xD060287A94C6D, 
-0x139307628CD59AE9, 0x6E63C15E329A6BA3, 0xDBC40F61D6CC3D44, 0x70ED1010217348EF, 
-0x168630E6E287EFBF, 0x6474E1EF2D03CC15, 0x8383BD56F8EC2B2C, 0x2491F8E4ECE17A, 
-0x4420BF8592A956FC, 0xC10BAF325FD9B7D, 0xDDE90FEB70350CEF, 0x1D56FB40F72ABFE6, 
-0xCD2CE80F3E2BF78D, 0xF0D024D6D09D73DF, 0x1DDA0EF5418D50C0, 0x404A4DB89D87A2, 
-0xAB480E2453FAE650, 0x5CA89D84F6214D0F, 0x9F16C94EBD3BDE48, 0x7502D7DDBD102538, 
-0x8F437EF8EE8693EC, 0x86E22E8144B0D18E, 0x812E07D8C731DE8D, 0x21EFFAB23A793B, 
-0x12998AD18FF64DE4, 0x19567B4C52D4264F, 0x54C04C29F4C7C7E, 0x3D3FCF3F24C73E01, 
-0xE827A7F84A0BDFD, 0x274C636D4A7D3828, 0xD2842EF22B1DA5EA, 0x3F095393495621, 
-0xCA165E067ECF8963, 0x133151C4DDED6A8D, 0x76DB5F79980FEA5D, 0x4D2D5964DBCF73DD, 
-0x9168C76099AD51E5, 0xD99FC14F290C139, 0xA213C9A20DDECBF4, 0x2E10B3F5720078, 
-0x74E1DF6CB15AA578, 0x40F25BDEC2D7A532, 0xEFDF976907F3B405, 0x3DB223B6B39EF0E7, 
-0xCDD794B7280E8824, 0x2FF553A30F2F9FFD, 0xDBFF12C29FCDEB56, 0x3BCB1B930F9402, 
-0xF1EB3E0E861AF726, 0xF0A9FC5002BBA59C, 0x8C28F232B7FB1DA7, 0x17B68329CB741AC, 
-0x3BC8EA6345927201, 0x155DAA23DB0B2646, 0x41A8B664CF74D1BD, 0x2DE6236530255F, 
-0x2BEAFB3E0941C109, 0x8F50BE6D9A32D6D9, 0xEEC252003DF2FB28, 0x1702252AC4E5B57E, 
-0xE07C7B066F93D7AF, 0x470766CF5F6FDC65, 0xD98BD9062544E710, 0x1C4CBE4872A37D, 
-0xF383875E2E5239C5, 0x51D49CE33D34BB09, 0x6E4D9C702D148AA8, 0xA21ADA2F0C4E8EB6, 
-0x2ED1804F4ED636FA, 0x2826F0933DFDD2E8, 0xBA89E00139DC78E3, 0x2D92CAB7D1209B, 
-0xC117CB7191DA08E7, 0xB0E7F6360284E610, 0xA8EEC9BB4001FF73, 0x9B27FF846FCA55F0, 
-0xA87FBD3CB244FB7A, 0xE845991DA03DE32C, 0x510754B84AF09DAD, 0x3D97AB17AD517D, 
-0xA14F9B6B35E068E5, 0x38DD8C5A644C37D2, 0x1ECF4792C9147F32, 0xCE36BCE9531774CE, 
-0x424CCEE97996F0D, 0xB493AC26BBEFD952, 0xF547D88F1FCE7078, 0x25073194622B36, 
-0xCA645D0673702FC4, 0x9589A455AA0ABCD8, 0x37362C67684D417F, 0x37968D5D682E8F5E, 
-0x287D90712BADE188, 0x2F48FBDF5FED023D, 0x729527A3756724B8, 0x16D13D623C146A, 
-0x4A726D6922B9DA04, 0x4CE72C02B0A7B167, 0xA743B4E1FADB18E1, 0xD0ED204BAF786EC5, 
-0xB032EBACF7B03B75, 0xBD3B7B2E3451F699, 0x46AAC3AE6CFFDE18, 0x3D000A7FF1777E, 
-0x818C972A5549ABEE, 0x49836F06FE405381, 0x5DB8AEC84FB5F844, 0xF5ABA5088822573, 
-0xBED105525B82CD69, 0x1EC4E072E909E101, 0x2C59C5EABBAFB587, 0x39484D10EF9A27, 
-0x1DD2FC079DBA3D65, 0x901F7789C4750A16, 0xC1B3D3686968C910, 0xBD1C31FA9DF3CB99, 
-0xCD085753BD486F4B, 0x1E431F7B0AA43787, 0xDFDA06A98D32EF6, 0x1230762D0D3661, 
-0xA8B81D400345E266, 0x291D3B8018C95915, 0xDAE90DE3509537E1, 0xF63C2DC3759D44D0, 
-0x153B0B0EAD06097F, 0xA99733687ED34DC0, 0xADFB9E3F944610AF, 0x21A105D39B9B8F, 
-0x1715BECD3C9D8637, 0x7EE12D3300712C1D, 0x6B36DF1B9A474864, 0xD3F942986E7C2F5A, 
-0xC7CA71441BA323B1, 0x5FA7D9F601B90C2E, 0x364C54E6CE5F958D, 0x18ECF089067D44, 
-0x5E09DBE6DFFE27CC, 0xBDC0D9E803E4F610, 0xA5C9F95863DC76EC, 0x126E3AEDE42ECF53, 
-0x6F1EA40CF3927BF3, 0x69B876CF6149AEC2, 0xDC20133F1F5F2113, 0x9EE50430091CB, 
-0xBAF5DC9A710BCBD3, 0xAF5C9EB185B52F40, 0xC07B8A78A0CE6F06, 0x94C02D663086980E, 
-0x14987F3B9F47507F, 0xDD9661261A99CA88, 0x40D369B8263B47D5, 0x127022B7391AE7, 
-0xE31747F8E95B6402, 0xA9234DFBD68C53B2, 0x3302F241FC9D0CE5, 0xEB98D2370176CE8B, 
-0x432FD9C821EA7C71, 0x38DFE1D40959E5EA, 0xF875B6A16C40A84E, 0x1399BEE4C4AB86, 
-0xB8A5FD580B2D05A8, 0xA752B345CB916AC4, 0xE4EFDC1D09DFF77A, 0x1AF88038E969D7D2, 
-0x4D60A9FD4C7A83AF, 0x9B4B2CD468D9A57A, 0xC74DEE12F2F5C950, 0x32B1806F8DDBC1, 
-0x8CCE7D6DA1ECE2A7, 0x1D8D2DE5642DBC41, 0x6F820895385FBD9C, 0xEBCFB0FE4873CC2E, 
-0x64841A14941BD98, 0x2C1F708954FCF6AA, 0xEF020C20737E6F19, 0x2E9331FE6DBD96, 
-0x2C5F793E8A13D0BD, 0x44554E3FCB2BC94F, 0x4F99D2DE5DBB8C1E, 0x4A1FBF543D24A093, 
-0x707A5C43EB0058E1, 0x7888BB7ED1D77EFF, 0x522C799D0D3AFFD0, 0x3CE172F9685168, 
-0xEC209FF7F789547C, 0xAB5CAF13859FD45C, 0x8BA47944E2A81E82, 0x68DC5C0D6B5FC397, 
-0xC7E69285B01F6784, 0xAB5B381E40635C21, 0x26B397AB14CC3242, 0x2E17FD41B34038, 
-0x3974BF38F11C5D99, 0x17D3AECAB9AD988C, 0x96F16E5EAE2DD920, 0x8645A60B1B8C7EF6, 
-0x7C9E2AE51EC4C6AF, 0xF287BCA152F99BC8, 0xB4AE7ECC1C9DE946, 0x22E72AE1EA4AC1, 
-0xC4A45360117CC13, 0xB15CEE40B1B82769, 0xAE7ACD131EC065B6, 0x5F9034E109684CBB, 
-0x110BC76455AD245E, 0x63EB181F64D0EF0, 0x22690A421A1C31D9, 0x19EF0946E3CC90, 
-0x869C87302F09D601, 0x746EF5D4AD918125, 0x11BACCE00F657AD2, 0x574CF8CC599EBC0C, 
-0xF5F40AADD90F1639, 0xDF90B00194D45FE2, 0x3ED6B67378EDD811, 0x367E697A424251, 
-0x81705F303B867A8A, 0xFD474EEBB60F5187, 0x6F07FD3564175D36, 0xB8D9BD18F9A8F453, 
-0x91F2625C14329A, 0xF4E89F9B04FF12E4, 0x820FB177F955BF35, 0xECE093719C8A2, 
-0x165C0BB5C455FB07, 0xE3E2131DEEF119A9, 0x7917C77CF81C4D14, 0x97A787A90F17F1D2, 
-0xC3912340D87E3EE8, 0x35E3670FF4E5F44A, 0x6F1E1AB4C9775AB3, 0x161C0EA8F2BCDC, 
-0x426343756C30576F, 0xDC9913D38E4C2AC8, 0xB4DE451D034B01F0, 0xDA8C5F7E58C9FEDE, 
-0x7A2A011D5F9EAC9B, 0x6DDBAEAAF9FE9BEA, 0x5C3678851F48F5E0, 0x137A48E741D868, 
-0x72D6C6DA38AD0003, 0xAE4EF8BFAECDDCE5, 0x1440631C07475635, 0x2263DCC311F7490A, 
-0xE0A03BF4E3484A78, 0xC48BF5BBFAE4E686, 0x126E262788FD3B58, 0x3C9A9D3803A699, 
-0x4304602E8D1D8A8B, 0xBA3B5DB5F0E65E6F, 0x250F1DAFF372C337, 0x4F321C743BAC7F18, 
-0x628EAD7534D63567, 0xEE983E914DB47172, 0x10F882AB3D2BB089, 0x32AC94EECA0113, 
-0x6644095A65445912, 0xF966E86CD335CCE6, 0x5F98EBAC58F0CC89, 0xB9640B7B6B0AF5BC, 
-0xFE36AE8745C72C8, 0xD2C8BB65EA9DED0B, 0xF918312F6EF1897B, 0x15330E8EA87E2, 
-0xB72F3EEF8C4F146E, 0xC7DD98A9F2FA1346, 0xB8E79823E054AF77, 0x40FF3902E36C8E77, 
-0x45E135B4FBF92AE, 0xA21BCDADEE3C34C7, 0x34722C76B71B5BB8, 0x33D40CAEAC0204, 
-0xD2394DF58D3F61D, 0x8CFA5DC80219F3, 0xBED7CEAA75F6F205, 0x7B8C3B459F41CF19, 
-0x361A9642E558E6B6, 0x408EC3A28A3B09D5, 0xEF0B07628E9DD833, 0x1C401E2B75E75C, 
-0x56385473EF9098, 0xF11ABF70E92C92C1, 0xC77B9801BF370210, 0x12232C6B3778B8EF, 
-0x5F4DBC91191BCDAA, 0x53F06676099B63E0, 0x3E2EB55944F84134, 0x30601644BC8463, 
-0x73D04C37DE8C821, 0xBF50EB3F842E14C0, 0x6FAFF7359317BD7B, 0x3C802C49F7AA6ECA, 
-0xD34C001E426600C1, 0xD31D103A53715785, 0x10FDBC456DF21ECE, 0xE5F92DD5688F8, 
-0x701753E03CF16793, 0xE98583A8E7E60DAA, 0x9C992BAE970FACF8, 0xF1E25D85B307ED47, 
-0xBF7B4BEA6FDBC786, 0x3D9F965F6B0C690, 0x1DEA641E545C4D65, 0x33A9A5866921A3, 
-0xEF8EB7DE23AB94C9, 0x5BA3E6887EC89CF3, 0x537C63CA9537EFE5, 0x20CA226A0CD7C062, 
-0x7059FF8D93E8AD4D, 0xB004A266A68226FA, 0x30A674DAE45ED0C8, 0x32F4C4366116B4, 
-0xF6B192C7859ED87E, 0x3449AF98B474FBA9, 0x14737889A89D62C4, 0x52F3D7C011528CF, 
-0xD52A4A987A77B16C, 0xF9630EFE2A59C6B3, 0x6F09FCB0BD29B7EC, 0x3471F23D0A5EC0, 
-0x8025045DE7CF266A, 0x21970EB121BFC9B, 0x375778838B444B, 0x2A67F41A79BFB9ED, 
-0xBC96F21299999368, 0xE4ABCEAD3AC36C1A, 0x671F721984E410FF, 0x91D1AC7536B40, 
-0x2EFEBCFCCD4873C4, 0x5952BE697A06D91D, 0x51DF50A324F9664E, 0xC727FB28705F90E7, 
-0x4D3867335A178137, 0x547DD70EF7CCEA1B, 0xB45FF464EC264ECB, 0x103B352139029B, 
-0xBC90F3EF9B10DA6D, 0xD608BA7263CDCB20, 0x5BB33DC31F628B87, 0xAD8A1ED71C545CFC, 
-0x8805FC34DC82E13A, 0x2CC8CC59F280526, 0x92CFD88B99F70293, 0x1BFF3BBF32F003, 
-0xBFBE102283183B10, 0xB47DC872E17B1C95, 0x9C11F05EEC50B926, 0xB67556AA8BED47A3, 
-0xB78C5BA28C07A1E2, 0x9EB0D3A750AB051B, 0x29A6C611E59C915F, 0x1406FE2733EFD9, 
-0x5D092F250714676, 0xA2D6D9F1F9F45E9C, 0xEDEC210847ED2972, 0xFAD5001FE08D7C2D, 
-0xC094ECD4697FFC84, 0xE38D92A1782FFAF1, 0x2581780ED410A59A, 0x2218A4AE68E095, 
-0x60256F1D0ECCA2C9, 0x65B97D1AFED66B44, 0xCCB14A3AEBC6F0AA, 0x6A491CC0ADE39F85, 
-0xAEE07A1245E09F8E, 0x7A41CE91EA321F1A, 0x2E1EF3BDE3CE7E32, 0x1B0EF19689D780, 
-0x52AF7BF78EED9021, 0xEBC6E24A2EF44A8E, 0xBA82CCEBFC70BFDA, 0xD4E3E89180DB15ED, 
-0xA1EFEEAD184C01D7, 0x18521CA2F8E21628, 0x7132C81943FA9C3, 0x2847938CFABCAF, 
-0x12274A9B8B092392, 0x1611D379EEB6FE3F, 0x8362F1A333EA5E1A, 0x589287691B68B975, 
-0x91B5CAAA15706556, 0xEC76D5E5307E7369, 0x766C4116A0DDFE68, 0x1D754E98B6B728, 
-0x3D73C2C1187A0CB4, 0xACE19BD632406409, 0xBC9CB2DB6371C74E, 0xEAC5517D6DDE0FAF, 
-0x58C785244528DEBA, 0x640D06B71E027EED, 0xB1540F582DB3E1D5, 0x168B07C361CFC7, 
-0xAC8CDE18D9DAE6A7, 0xAF90ECCA2070E828, 0x41951C41A87401ED, 0xFF9F800B2FCB375E, 
-0x4DB6A7B7D79050F0, 0x77F73EC0AFD19017, 0x3DB891981F892766, 0x39C3F4F3F00254, 
-0x8F19A35B6947FD5B, 0x386E26D956F231B, 0x2E894B94AC5D9C47, 0xD05CCD296493A1EC, 
-0xCB569D24AAF59BE0, 0x476D734F33C52444, 0xE5E476D4B20D24F, 0xAAF894F828F8C, 
-0xE74CB21FAA8B2CA4, 0x376A4A35FC4BCE7E, 0x3533BAE53B8CE7E7, 0x53FEC601D022468, 
-0xFBB29991BEE11519, 0x323EFEBB739F3DD6, 0x4F075B01B2DA9FB3, 0x28BA853A6CA3D9, 
-0xF52C5D9F83FCA5EC, 0xBF2AE2297766ACF2, 0x3AC16CEE1C0BEAF9, 0xE5C11EE82FAC5A8C, 
-0x79933D40B76B25E0, 0x4FFED8F1D6016C13, 0xEAAFB7AF3948792B, 0x31EE342AC9C8AC, 
-0x2192E30158D114C8, 0x353F76B5CA20C10D, 0x92238174C85478FB, 0x38F3FB161B70B3AC, 
-0x9D391A984F1618, 0x4E74B81E9330D249, 0x3E3BFE108EAB8A9E, 0x2EB11A8D92D63A, 
-0x85FCF280C02F68D9, 0x80CDF2BB122AD011, 0x5DA76FCC01BA431E, 0xD3C41840055C08DA, 
-0x5BDF34CAB89137AB, 0x64625D82D2372DDB, 0x3C2CC83D4E10CE6B, 0xA71923035835E, 
-0x4EFDF5FA9C8A77C0, 0x6735910CE5D8A8B2, 0x1957A02D6544D5FC, 0xABAA1D07E3239125, 
-0x760359F4E092CD7C, 0x4F8ACBF6E69742B4, 0x70EB0F61CEFB5498, 0x1AADC99C9EC41D, 
-0xD24B8EE2BF84285C, 0xD43E7BD60CBE0A4E, 0x84FDF650D47FC27F, 0xD5AFDF00181F00A8, 
-0x89A04DAA90CFECF0, 0x78BFB6B16BE9FF8B, 0x510520341BE57B94, 0x3EFD7E435FB064, 
-0xF14F299D3CEBB643, 0xE9CA388E5A4AC163, 0x2A3B22AA69E92D48, 0x36C88B2D356A1409, 
-0xB017E24EE3AACE4C, 0xFE4DEC6BA4D1CFA7, 0xFC7BA1F9B6FD50A7, 0x2CA7CB201114E4, 
-0x23555091A6AF1D78, 0x7821D760CA5469B5, 0x100007F7C5F7261A, 0xB904619DCED6CB39, 
-0xDB41E98514F08FA3, 0x7E52D3DD66B121C5, 0xF15F0BB3A9099F6, 0x1AE71DAC55B5FA, 
-0xFE9A5ADBED7CF470, 0x9190BEA8381AC7DA, 0x1C54EE54A9B06E1F, 0x126329869CB98903, 
-0xFA4A6708A6F26938, 0xE3F2A87FF1F91B2C, 0xC5ADD63FB19FA44B, 0x1DF836BD265C68, 
-0x165B28F1C7E26A86, 0x87E80C6B60E9D672, 0xE014FEA067FC2F49, 0x118F56C199C287BD, 
-0xE4C036B5BAC42620, 0x9821C7152AF4C628, 0x3703527B79BE373F, 0x70DBBF9BF2CFD, 
-0xB639AD02CD8C55AB, 0xCDB69D007B15BD5A, 0x52D11E64B31080A8, 0xA1F559F7C5E1025A, 
-0x69B5071B4FC418A3, 0x6355C3C024248D4E, 0x40218EED8491B07, 0x25FD57609B9BA6, 
-0xF5650081B4879FCE, 0xCAC6455D88549973, 0x82CF2447DCBEA163, 0x9CD061CD4B8220EA, 
-0x94DF763ED3940B40, 0xF442F29C0E9717B0, 0xA6C4499744DAEFF2, 0x1F97D62ACFCA6C, 
-0x442C7DC46AEDA402, 0x9B2DCF2C35C950B0, 0x755071A998ED2F8C, 0x4A95990848A9EEEB, 
-0x8C9F1706A7DA6478, 0xDF3F62944AC4F362, 0x98C04DE0B064C03E, 0xD53893687CDA6, 
-0x316AAF6DB93A8804, 0x249A45CBACDBA11E, 0xF94A1B659719A399, 0xDB440A2B6C09459B, 
-0x23C032CA3FEF338D, 0xF7E1E3DC1D217CF7, 0xD0EB3CCAE28F6FE6, 0x27A7DF1848BA47, 
-0x894EDF6AC606AA1E, 0x73DEE80D197ABCF6, 0x2C00338651E4C615, 0xFAE9EE7DE19C7192, 
-0x8EBFD3987FCDAEAF, 0xF9C2D6BBF02000D8, 0x49F3316EEE4FD3D, 0x30474F16D42EC1, 
-0x5CE7AA241676BF30, 0xEA2DF0D70B7A8B51, 0x48620175B474824D, 0x72D6F05910ED3BBD, 
-0xD150876225C2753D, 0x19F51BA05F8AF1E7, 0x258072E6C85EDC30, 0x2CD4CC14640797, 
-0x5B01AF211C9999A1, 0xAAD7FFAE004EBDC7, 0xB11FD54D6D8FD79F, 0x2F5528F065447E3, 
-0xFB75F91EEE77C33B, 0x6530280FDA3D6E75, 0xD682BD1DA4597037, 0x212A1039920DFE, 
-0x24DAEBB7A580E6F3, 0xCBE6D9D501FA7F95, 0xAA9210809054537A, 0xC076BD4DDD372AED, 
-0x53A570250940DFA, 0x7B2FB8CC81E21C8, 0x56C592E25CB22AE3, 0x32EB899BEEB125, 
-0xA1225EA0C41ED7B, 0xEA56FAF411408D44, 0xD3262B883BC7D006, 0x5C5A8A1C3746B8C4, 
-0xD4F065DDBFB17F9F, 0x79089596222DA735, 0x32DDDCECDAA3C0CB, 0x1778D117CFF9F7, 
-0x3653E1B694150C07, 0x256E0A48E9D6B517, 0x1614C430E7E5E2D7, 0x78F7C6C65A03F2A9, 
-0x12E37857EE008AB3, 0xCA4C57ACDB272492, 0xBA47425E36186A15, 0x26E3E61D3227B4, 
-0xD1152125B3FF1A7D, 0xF67DF2DDDF2B69BC, 0xEF644EF4047FBDAC, 0x86828F1C5C26A26, 
-0xA00DC9158549B02A, 0xF165D04B25445EE0, 0xF177DAF49CA3B5D6, 0x1827D9078CDAA7, 
-0xFE57E6420BCC371E, 0x6ED976C0DEB60132, 0x5C986443C61A65C8, 0x5F445A140A1A5A3F, 
-0x79F883E734C40D1B, 0x6072B1A98A8DF76F, 0x67C89229E8495644, 0x206338464292EC, 
-0x10119E8C20EC0892, 0x17393D6FDEC76808, 0xFB5330AC393CA51C, 0xD43DEC27A66A62E7, 
-0xD3B610D304682AAC, 0x48A69ABDD15EDBBA, 0xABBF24564415582B, 0x36621D6AB42F0D, 
-0x790845999364C746, 0xF5884AFD25B6117C, 0x3CCF91273020B516, 0xD70460D8340F318, 
-0xBE8AA48C7B88A88C, 0x4DB4A33C93BBA299, 0x319D2AAC500E0C5, 0x11C8653FF16E74, 
-0x937964B23C196AC1, 0x1D60DEF75CAF5E87, 0x59AE162C1612B08C, 0x6DDF38E11021C576, 
-0x165F28BAFF73AA90, 0xAE469CD0D191B335, 0xE481DD5313F190C5, 0x1A942333B0B2DB, 
-0xBC00930F01EF2914, 0xE29156496FD69B81, 0xD3B53394DEBEC764, 0x8AD2B788DA405BA6, 
-0x19787885599BC3BF, 0x70C66D47502AD5DD, 0x85FCDCE0F3EE2F2D, 0x2E8D1FC2ABDA82, 
-0xA8E91400006081B8, 0x1CEC98A9392CB152, 0x3DC0C99FC813F68E, 0x8815DF8C853CF3B2, 
-0x2C4490A013674866, 0x473D192D3ED4DA6C, 0xDB68394F9584347F, 0x6BCBA0F2AD9D0, 
-0x70244675FC1E1F00, 0x85E43FBA86E72E71, 0x5AD638E67C6CF890, 0x67522D277FCF1841, 
-0xAAE8ACEDFBECB0E4, 0xE8E862BBF8BCE1DF, 0x366F4B4C647D5E90, 0x1EEBDD756C0D67, 
-0x93261F9EC7AA7691, 0xAC056AD6B73C6560, 0x81DA22CF59B6675E, 0xB814F5918CF1229C, 
-0xF76AF37DFA761D7B, 0x56859EAAE252B36E, 0x13D42EABFC34807C, 0x31D3B22B0C9F60, 
-0x682CEBBA9924622D, 0x7535D53F5FF294AB, 0xB8BB0D9585055B55, 0xF8FFAA89BCE42509, 
-0xF2F28B37ECE157A4, 0x882924BCF06CFA6C, 0xCABA95279583AED9, 0x26F05D2F9D59FA, 
-0xC80B49F344CD683F, 0x836CA95D51C91EF1, 0x9F9236E98ED16269, 0xEB9E65EE774CB0EC, 
-0x35DA8B4E064FE32C, 0x2B31F28792E79EDB, 0x68BA5562AF8DF27F, 0x3BA7712A2B6FDD, 
-0x73F2A71F55602BC8, 0x92CB2BD6470E6B35, 0x676E18F8B217C253, 0xB6C483BDE8C6C465, 
-0x47F24B00D4452835, 0x6AA7A0B73DC8780C, 0xBE32A4EF2762A81D, 0x1A70B9670D250E, 
-0xCD0020DFCB7EC4A2, 0x73C16F353B0A1A68, 0x27C6C671F2C994C7, 0x25180CE94849C892, 
-0x1951FCFD8F0BA9B3, 0xFD97FF71D8303EE6, 0x2EBADC59B9ADA8DD, 0x3489495FCAB887, 
-0xE3AE25C40F9FC9DB, 0x99D0AE5240699CFD, 0x2CE0122C95DF0423, 0x9F00D10254787C86, 
-0xD15FBFD4FDF4E4EF, 0x2326511F36019D9C, 0x31C70463CA6A533D, 0x379256F125C7BC, 
-0xC6F0F157F8813B60, 0x715DAB1AE1D905A1, 0x7A392641E9007997, 0xA6CACFA568C08494, 
-0x9043641437CE2876, 0x8F697CD6CB9F27FA, 0x1351D2823C0ABDB9, 0x3D6D05E30F0E05, 
-0xD9AC58FEFBEB2B46, 0x28C0B3EC7E8FD774, 0x7264438C6DEECCBF, 0xDA8FD5B7CE66DC17, 
-0xF64F3129B1EAB5E, 0xAF53BE7594CB86E4, 0x771688DC6AA339EF, 0x3D5C36266CA805, 
-0xC834F218AFDBD30F, 0x7D720391EF36D340, 0x3685BE01E2A0DD30, 0xFF0094ACFF9508C3, 
-0x88BBEABC44D04599, 0x4EF3868005365A2A, 0x33C4E1ADDA203737, 0x3355D0EE8D81AC, 
-0x8DC57FA98078C453, 0xF740F682C2522108, 0x35AC63FF5CB89F0D, 0x2101BEF8BC501, 
-0xEFC9D1309B4D7B9E, 0x34B4726F93D2A204, 0x4347D1E27DA03B21, 0x27BC3F0C8AA5DC, 
-0x99B7FA92747F886F, 0x31CA02D8F1BCE937, 0xE594DFB19E6F98D5, 0x9D4CB4CFBCC0F866, 
-0x934F107472C309F8, 0xD099CB4B2A6B83FC, 0x6CDC1F2FE0C33B3D, 0x133AB0B35E4497, 
-0x3149B21EAE1A726D, 0x1AC100748128F9D9, 0xA0F434187877159, 0x921B298727B906A2, 
-0x31C661E86B975A78, 0xC35553E98292C1DF, 0xC1252FF6F8282C5C, 0x24131B26DC6FC8, 
-0xB69A7146437BAB19, 0xB1E37F1F442E9F5, 0x6B1FBBA31DE6EF83, 0x670F337F120ED5F9, 
-0xFA1A662CB0012E0D, 0x3896D1B780DAE337, 0xFE7ADA90D906C066, 0x1BF7E2F3F80F53, 
-0x6627C9F1DCAC60D4, 0xB629BDFFE2B48332, 0x47ACFD3A57AE7B6A, 0x8DCE197CD0934CDE, 
-0xDF362CD2B6D09722, 0x839E64F392F3C6E2, 0xB94B979E647E26B5, 0x800105BD034B0, 
-0xE47D76B76CE8AFCE, 0xFD21F15594BD105B, 0x4237C563D2E161DF, 0x16FC114518F2FDF8, 
-0x16B5CEF4A830D713, 0x786954D799C291D9, 0xA815625DD453A107, 0x883079CCB3196, 
-0x359442ECF54064AB, 0x308D15CCEE726906, 0xBB902D0FFA238B40, 0xF75027ADAE2B49DE, 
-0x889B22619F50E7C1, 0xBDC2D450F3C8436, 0xC883B879F544AB4F, 0x13C6A3027CCA16, 
-0x936E3DA7267B709C, 0x7C2A08E2FE669F07, 0x70241194C9CB57B3, 0x2F5D4F4CCED4C5F0, 
-0xA34D4F5FE31D7431, 0x985C8035EA7F4818, 0x1C07EF59768E0060, 0x19F3F47A8D2336, 
-0xF14D5708478EF209, 0x5C8120D06D055225, 0x8E69EF9FA9EC843A, 0xEEFB3DBE45A5A874, 
-0x26ECD45B86FB010E, 0x2719626381A03C1F, 0xCA2B29FCBB6E9C1A, 0x342AAAF003FAA0, 
-0xC7A7507746DEA22E, 0x8CBA71C8117FE352, 0x1D998F401641CD5, 0x66EE20DB27EC8A88, 
-0x5FA67B753FBE5CC6, 0x864FB048B24C6DC, 0x12350E9FE591B096, 0x3A8205E6C504D9, 
-0x32D847D75EFA747E, 0x41CFE2645B823933, 0x30BD1EFD18FEC148, 0xA9E378B22661BFA4, 
-0xAE0D5CC75564FA16, 0x2FA7417D6E9B6928, 0xA1FBD980A1ECC842, 0x2E6C9650E4B86F, 
-0xE0B9AEC36BA0F2D2, 0x25B62C1A5F4AE0E3, 0xB2DBC0ECEE6E9670, 0xAE7C70129C8DB210, 
-0x2246D73823F06262, 0x8343565342D14644, 0x3428A5900275624B, 0x78BC60C4BD64E, 
-0xBC100EDB1FAAB40B, 0x482727805F0B9D93, 0xA8143D7BDC41526F, 0x16044FCB5FCE4AE3, 
-0x73C4CD122133C270, 0x48257A0E8EE5EBB1, 0x86D733007A9FC0A7, 0x14A86C5EF0CD30, 
-0x3ACBAD38EB0740D1, 0xC608E5C9FAB37FF8, 0x979BA0E81F29D8AF, 0x6C2A9795A48C3330, 
-0x5189CC5999F7326D, 0x934329DAB99EACE6, 0xBDCF2F0D5166397A, 0x373D20CB93E3BE, 
-0x810CE3C638235314, 0x3514BCB4D95B21B9, 0xC01A652684EB03D3, 0xC9B7EC071D49EFBB, 
-0x687A02DE9EFEB343, 0xFD41B8B12B96FAA9, 0x7701E744122D737B, 0x20DE8B78DB8FC0, 
-0x6D922FDC0F69A3C2, 0xE0A79D11C50B84E2, 0xE5C8870580127C76, 0xBA371BE6A19C159D, 
-0x3BA771A5F6B46063, 0x6909F32717200643, 0x110E4C2788F3D3F3, 0x30D764C6EF9117, 
-0x53D6E5990F4C0313, 0x3F21FDFD32E578B4, 0x5CC9D07680695F03, 0xFD914B0877523613, 
-0xD4A038CF709A5936, 0x584DE7EC3D8C9A69, 0xD6C220CDEF3D792A, 0xFEFB98883B99D, 
-0x991980ED63B84199, 0x6671878911E3C3C, 0xB6F483E789754BF0, 0xD3D262DE6999B030, 
-0xAC822FCD897CC596, 0xD906201D1C6E2223, 0xBB522F97090D7C3F, 0x2BFE53864A1E9E, 
-0x8F9E16F20DAAD2E4, 0x86D34927B4431248, 0xAB14A422D0C691A5, 0x78E00B93119BAEE5, 
-0x2E328C43A785676C, 0x5DBE6766486A7257, 0x3B45E1271D3EEF3A, 0x3929DC1D4BFEAE, 
-0x5649A9991BCC8BB6, 0x489B633C708FD7F, 0x2FEA7BCB3434049D, 0x3F88C8EBDF12BB4F, 
-0x61B18A19AE49A535, 0xB47467978D869BDE, 0x38005F6714646AE3, 0x351EDEC9D81364, 
-0x89C6B20BC0F8E3C3, 0x9B64EEDA3256B0C4, 0x89360FDF5B85C300, 0x8A53318C20E779BC, 
-0x67C69649D4246D7, 0x2E73F5179A270C2E, 0xA26B3510A9449335, 0x3B77FEA4A257B5, 
-0x75F18E55960CB58F, 0x13DF41568140559D, 0x6E595FB9F798C746, 0x5E419DB4864940AD, 
-0x53AAC4A618A96C60, 0x311D475434A0445E, 0xB8919C951C4FFEE, 0x3A7BC63C2EDF54, 
-0x2D9E534E0BE76F53, 0x8B5BF78439BA7C1B, 0xBBCFB0006D00C8D5, 0x29403D2122C464B3, 
-0xD6A8877897DCF398, 0xCCABB4374857318A, 0xF2D3AF38B6053A08, 0x2158C7433D9411, 
-0x44278689223BC62, 0x94E03AD178BCFF34, 0xAF52B6D87A9E39C9, 0x3D0526FE69D0DD38, 
-0xEB43CE54D106009A, 0x697F0D15E5B59A5B, 0xCDA06ADBB88D1697, 0x2DAFE02B2F904A, 
-0x8EEE0DB83815272A, 0x14FF68780A727333, 0xAB63F9709E064BCC, 0x9C6B51C21977431D, 
-0xBB388443F441BA1C, 0x23F5424139623545, 0x11A820DE02BD83E8, 0x1BBDD790C2697C, 
-0x48EC9A5A84D4C15B, 0xF35B25A6C4DECA8D, 0x5143460B3119584E, 0xD4768F268ABD9AC6, 
-0x5E9AFEA5B782ECC7, 0x29F4B4CEE68E9393, 0xDF2CA07150D7817C, 0x125E6D15A17173, 
-0xC4D8F319809EBEAD, 0x3E365BFA76C1EF0C, 0x2D7E2633340822E0, 0x580F39121A74DCD2, 
-0x14A06E13C70D78FC, 0xB21258F156737382, 0xEDD4A1C9793B5669, 0x30AEFDD244AF23, 
-0x285EE0C61D42D36B, 0x6AF4864BA1178A2, 0xF91E8FC960C1D458, 0xF3FBE37F4BE08728, 
-0x72CE90B74BE9437C, 0x628C83CBE91F6616, 0x68618980F486EA57, 0x399ECC344C3D47, 
-0xD20E448C4160E87C, 0xEBEDE65E3BA3C25C, 0xCB2FA930E8DB5446, 0x4BD0A3152F46792B, 
-0x3F337635DF01C7D7, 0xC8008E46B16583C3, 0xA792E71ED5A0E616, 0x3073ED07E3D934, 
-0x17833134CB41B7C4, 0xFB8890FD47A17AFA, 0x502DDCF8B9B197C9, 0xC7E8AE3CB8E4F36B, 
-0xB16D00CB386D4523, 0x70C2AEB7FFD4D1BE, 0xBAE29A79DADF7B3B, 0x3B48BF8757623E, 
-0x4AE4C918A0393CE4, 0x9654768118A63861, 0x8A9EE75039F9FDD7, 0x6EFC31BDD7118991, 
-0xAAC226EBBD1E999F, 0x552F122DFA1F5F02, 0xED44C72DD948857B, 0x67B8E0C6BE5F7, 
-0x1C37591FB328A3AD, 0x214E957D4330592D, 0x1EB6132EB44AB8D2, 0x6D62982200DF3B99, 
-0x76447157F5C2ED55, 0xC2CE2D2B963BF6FC, 0x77108F6E81686D54, 0x8ADA360E88690, 
-0xA5D4B29C549C8829, 0xAC1C76182EF09D92, 0xFAF9554051D2E83F, 0x7082D6749B027849, 
-0x88C48194B757B391, 0x4527EA5D2A183F06, 0x20592EFC1E57E09D, 0xF3E24E103E8D4, 
-0xB0497AD3CDD70A1D, 0x1B3CB6FA6CD51D87, 0x836C18FCA7E451C4, 0xBA2DB8BCF1888B9F, 
-0xC383BF00B0566671, 0x14325E76DD67B407, 0xA4299C22FAA02C75, 0x1D04CF787ECF54, 
-0x6992B3B78D5D5C0D, 0x950BF0EA3FD9E7EC, 0x4E025419847D0159, 0xA97C84386BB9FD65, 
-0x959CB6F20F668D23, 0x16637587601AE77C, 0x4863B79D3B319C74, 0x1E0EA5D088F3FE, 
-0xBD147081C3703B6E, 0x4F3D33235324357B, 0x4F85E1AC206272D2, 0x892E3EFFD32652C1, 
-0x31EDF3C36290CFE8, 0xC864354DBAB14AB4, 0x1DB92BDF047ADBD4, 0x3528D0316063CC, 
-0x774504D87D822142, 0x3839E3EDBB1C8B7A, 0x6238EC0E1F703720, 0xD599E32C06DE7C2, 
-0xCEABD0A2DC97E46A, 0x9FAEF947B84AE32A, 0x78E38B4AFB0109A6, 0x18DA0A5C319369, 
-0x989478F6EC032726, 0x5538D328B91FFC25, 0x2B377C76C857D965, 0xB687FB49B400E0AE, 
-0xA1A9BA67C95DB85E, 0xB0313946EB969D21, 0xD37B0DC902A0AE7B, 0xDF7A21F03E8BB, 
-0x6C3ED22DB702F8BE, 0x11CE331338D7E7CD, 0xD2781D328C43006B, 0x970453AFDCA7DB06, 
-0xDAD04612C256B7CB, 0x7F6729180AB571C7, 0x4B9B043C248450EC, 0x30467E2C9047FB, 
-0x1448272D23CB6155, 0xDC960B77383C5AC2, 0x60A546AEC30ACE43, 0xE2FA8F27E9CAB832, 
-0xA37FF9F0D21DF4F2, 0xD3DE98D09E53245E, 0x8B1BA71E4A048B5, 0x140EF6F5D91D1A, 
-0xE8E34E6C010C630C, 0x16ADC9408932E205, 0x232BED112A0091AF, 0xF2E278426BFEEEB5, 
-0x7CFCDA8A7A19E5FB, 0xBA75F5D07EADB9CD, 0x51FD34F714D5B1BA, 0x15181DFC27DE7D, 
-0xA6D9FE9133761C59, 0xF0DB60D462DFB9B2, 0x830A07B2C83F51, 0xB67F9A4D204F835C, 
-0x97AEE1586976A47E, 0x8F1857462CA193D7, 0xB3425BDD9F093606, 0x182291419647CB, 
-0xABAD5B991800C3DD, 0xB40D68CDFF5ECD3, 0x57ACF9C70CF96F4C, 0x87FB16C7ECC57E3, 
-0x4608787D8EBE0D71, 0xD022B64941B8745, 0x236F23B31FAEA5C, 0x303AF38F6A86DB, 
-0x2ED87E9AC46DF753, 0xCB852E9CB54D279D, 0x84107FF0A797B235, 0xA217AB0AF87C3FD8, 
-0x6AC694718B1631C6, 0xB2388AEA7D2142F, 0xC5324B1713F76D4D, 0x2C8A03826ECE87, 
-0xD03EE9A0E16076BE, 0x66984A775988FE76, 0x7EE7998ABF5A7056, 0x8CE60821F5EF55DB, 
-0x8C9D85EF9D66A18F, 0x2E9D2DBDAE87D759, 0x315D9BF7E5A60E4A, 0x3BE66A4D8DC312, 
-0x10250AD9A2C184D0, 0xF47BFCB3CCBB4532, 0xE1A139F1EDCA2AEB, 0x44EEEF8E6B2C9321, 
-0xD7BA6154F68A5CB9, 0x54B009AE45FCC07A, 0xC31B476C103553DD, 0x33D1F559B380DD, 
-0xF947A585B1BB2A2E, 0x3216CB085C320D0C, 0x2C44AF9EB92201CE, 0xCBE5793F2576B07F, 
-0x7A85549B8C69CC58, 0xB638EFF4060929CF, 0x6E768302311E2911, 0x3074D123757669, 
-0x21B86C3DA88C0D2, 0xDD70D98FEA8CC832, 0xBF6EDFF793FE9150, 0x3B5705681B2A6F39, 
-0xE98A6E3FF3BE7EA6, 0xFDB948AA4322FD4C, 0x37A48BD524022BE6, 0xB38F08AE48961, 
-0xBB3C78FD62ADDD87, 0x17E310DDB980CCA3, 0x2B9BF546544E1021, 0xAC7A3403D3314EF8, 
-0x748C1E9FF5660C51, 0xE83DF90A38165C38, 0xE50CDCFDAA02A7D7, 0xDB6FA453FD49E, 
-0x15E3EFAE36B9EA7, 0x5F958D41BD10AC2A, 0xAE2C1A92192B16C5, 0x69FCCD0CEDD67DCB, 
-0x147CB3D0347D3297, 0x1D9E5BDC8AB6908A, 0xAAFEA9CEB1C02E21, 0xEFDF375FF0595, 
-0xC824F9FC9F39659, 0x17D4A519E2BFCAF7, 0x1A1C958C4A913A76, 0xAABD6156FFC95BBE, 
-0xB131CAE640E79994, 0x3F580399CF537A71, 0x83B9E04AB823F5CB, 0x8A09E381D4358, 
-0xC1D373790BC18B1B, 0xB6C4D6880892FBAB, 0x40216112B43EB23B, 0x18EEFA991EC513F2, 
-0x6B5C1C18F45C874D, 0xF5491AB35F0BFA19, 0x25B1804626F37F91, 0x65B108FA52D67, 
-0xA1BF96F6BB0B202E, 0xE34B5179008823D3, 0x1FE85E6708C3573C, 0x18BA310E9A3229CC, 
-0xBEAFB13F4DDA518B, 0xEF1FE5E0DB1E512C, 0x1CF33AAC0F81A862, 0x3B400C87633542, 
-0x2D0245034E2A1F76, 0x1A852BBAEEAD44D0, 0xA8AE93F8853384E0, 0xFA4A07FA691AD345, 
-0xD1B8AD3509722BA4, 0x4CF3AD01761DDD34, 0xEA682A36924F9562, 0x12A1E6F6F2C8D0, 
-0x3101AB0238C7F066, 0x8A4A919E2CC5F37D, 0xB15F29B55C7E8F18, 0xD0F231CA8BE71D15, 
-0x53F8BC85941AF422, 0xC36AF68F31E86EA1, 0xA75AF5CA135BAD64, 0x12285F74D1549, 
-0xB3BA4448A4805500, 0xCFC949D14C4C1CF2, 0xB0693EE2435BE14, 0x578C0C76A80AA191, 
-0xC6EDB0D894E104A2, 0xCC678354D693B656, 0xF572471D707884B0, 0x6E09E25DCB56, 
-0x95B35065E0291ED7, 0x81AB9F4A8AE50C7B, 0xC9BF2BE93CC0E94C, 0x3015D4DF951EA792, 
-0xEBDEEA1AF922910B, 0x61EF7BFF50337386, 0x29A628E22C3FE5AB, 0x2328E40A091FC2, 
-0xAC8CB1AA47ADAD6D, 0x758C59489AC8F555, 0xBE89EFF4613F9AC4, 0x4C3C5AEE8773FF8, 
-0x613EA5E6B48B0E07, 0xF1E76F08195833C6, 0xDC099C632417A57, 0x27772668B0AE1C, 
-0x8A8B2747B7FBBB02, 0x34142535C6F77C08, 0x1BBD3578ACDA859, 0x65DB2A038A2A0DEC, 
-0xB6CDCE136E2A8364, 0x2B2EC11F33454F7B, 0x9082754C3CB73309, 0x6395071E99519, 
-0xADAA77103C23156B, 0x56516FD081C221EF, 0x4B1B0ADC9BFD7D82, 0xBFC2979795A655E, 
-0xF8A0E927AA4647E0, 0x3F969E09CBB2F620, 0x1F75C8A9E945FA74, 0x3DBF6EDEB94BE, 
-0x208A00F73106274B, 0xC840ABCD276BBC31, 0xC521E845828C45F2, 0x5316657E7CC84FDC, 
-0xAB46555F0307427C, 0xA0380D06AA24DFCD, 0x7B5204A7D0AE2110, 0x395A4B290A0A01, 
-0x5960365043772349, 0x1669D8467DCD637A, 0xF9974FA1815F53E1, 0x1BC13495619C8BB, 
-0xFB238A7418803CF3, 0x8DD3344F13C2C992, 0x97981BCA68235692, 0x394A10606FB97D, 
-0x678E078218E973FD, 0xEDD30EEF15A3E122, 0x9B41D8A95510F2D8, 0x53C60850D9F2F38C, 
-0x1366CFC877221D18, 0x90A85C1C29B9E46B, 0x6FBFAC3BDAA22D24, 0x955842E86F9A1, 
-0x64B442A6BEF521E7, 0xCABB5094B91E8261, 0x77BDFBB3F46E26F1, 0x9CE42655A10AF0DB, 
-0xB22E4AB493E2867C, 0xA21096293A4F1A3B, 0xF94641DADC53852C, 0x1AC5FF14F05991, 
-0x2B18F09C839A6E85, 0x389C119277DF0F09, 0x8768EE1833C355C, 0xE91200931C042658, 
-0x5A6F08F06324B661, 0xE0D61D2DDC88EFCA, 0x1594F3844B21C7D4, 0x1011D45CF7AF62, 
-0x385398C982E332AC, 0x46F4A0A82547DA86, 0x104C4FA22374CD04, 0x4AB0FC9BCD331B3C, 
-0xEFCFE3DB5C2D39BC, 0xAE83E8CC8BAEFE6E, 0xBD6959A49757B7A, 0xC5B1B5AA1FD10, 
-0xA50378F2BA94C6F0, 0xEE5E9DF28B67B5A1, 0x1373BA2F7B0214DA, 0x65A45A6C5202CD48, 
-0xA998440F969A8A01, 0x3FA4CE7EE5996AA0, 0x7B50AD8A9A352C23, 0x37023181D0AD44, 
-0xCF74138F4ECA3D7, 0x80825D42E7CB603, 0x305B296A5E983117, 0xCF7000FE91E60CBD, 
-0x2183C09F6E4237, 0x6F11AC4B7F0EFFF, 0xC8F0962CA369676E, 0x86724287CDEA, 
-0xAF166AA11194E003, 0x379B5ACC1DE9B3C9, 0x86F1848DA8BF8FFA, 0xEE14BA14DC979EF7, 
-0x72ED33C426987B9E, 0x4BA8FA471F31EC88, 0x9EEECB732DB4E608, 0x1088069EA136D3, 
-0xC2F7A3D6F23F0E58, 0x39775025DB8E0274, 0xFC12FCF7DF417E29, 0x38D6DA0BBB656729, 
-0x62EF23F4349E5A07, 0x35B2D338C854619, 0x48F10F20F46556D0, 0xBCF6FE16E481E, 
-0xFA606BFF6E26F1EA, 0x1FE450E8AC7CF8D7, 0x324F1EF1180FDF82, 0xCC5F02960697B583, 
-0xBD6D9AB825641B7A, 0xE8A2658A4462F0CF, 0xE7BBE5C3DE792AB7, 0x318A937322AB40, 
-0x376A354082DF050B, 0xBC017B8292977243, 0x9964C1562CF3DBD3, 0x6AEB44DC0B493C62, 
-0xA67C56A82BE38B98, 0xAED5F08315242423, 0xC4817AC56C6C6A20, 0x1F9B846C400C23, 
-0x206A05C1C984A94B, 0xB7B0BC56274EACFA, 0xCE9DE9614405C924, 0xAF0439D7E2A30AC3, 
-0x739301A1FB2F1AEE, 0xBBEAC2784C64F41F, 0x6303A72958641D18, 0x2863D05BC0B8C0, 
-0xC18A3DA141848CC4, 0xFAE49319E80EA5F2, 0x2F2575BD9B1E603A, 0xD93F9ED85836F9DC, 
-0x2233DBEC6C7AD6F2, 0x691B2F74BADD3622, 0x180B941AABFE75B2, 0x31903A48164586, 
-0x560D0E31C94CEAB5, 0xFD5B79E7ECCA18B1, 0x85DBEC94EF26ED42, 0xDFA3464090397C2B, 
-0xB74224E751335558, 0xEEED3DCCDB8976A4, 0x4E635926BDD0A02F, 0x23615D94E92283, 
-0xDC61E5B3A818B3B1, 0xD81260F09276DC8F, 0xE1236E6332E733CF, 0xFE763CC5CFA94F60, 
-0x5AB69F505B1C7756, 0xF3429E68421417DD, 0x7149CA2F9074151C, 0x30252B6B66B74B, 
-0xFD659F69ED634B72, 0x7BC4BB2E839468D5, 0xD558DA8799985492, 0xA91C543A53EE8175, 
-0x1B83FDF6CF38E0CD, 0x8F22EE8C9163378D, 0xC799AE278ED9F44C, 0x25ED384BBF7C00, 
-0xE5EC20926A4424D5, 0x593EECACD21C5A46, 0xE6C43CC6FB8400F6, 0x96FE9475D6ABB1BD, 
-0x5C3D0B11E64827DF, 0x94552B9B57919638, 0x5A3B82DDCBE00AFC, 0x3B0AA2F08E6472, 
-0x501060B58792C49F, 0xA7F1ECC590DBE921, 0x2858EB4E9969A3BD, 0x6EE92198234F02FE, 
-0x8FD2E01375D51F77, 0x7778B4A9FC056A4B, 0x9E356D8FF0EA818E, 0x28CCB1F96C4E58, 
-0x453743B0210B3F2, 0x6113A1C51EE00EA0, 0x8B6C515D91563A7B, 0x4DCD99BC5838A3DE, 
-0xB75BDA848F09D05C, 0x316A1A7C8485D074, 0x505B1E0AE9B4C54C, 0x2465D7B97FAC9E, 
-0x6763F7FBB0600F1D, 0x5DE405CA9D87BAE7, 0xBC3F4CB079CFDB15, 0x6E77DA5B80EF2418, 
-0x5A644461B2CBA5CB, 0xBCFF7F1242599F14, 0xFF225624FBE2ED3, 0x2A111CECF1EA86, 
-0xE372DA2E1837B0E9, 0x488DDB545B042FE7, 0x4640C7F8B678BDA8, 0x8DF519490708270D, 
-0x22529EA924749331, 0x2C2E0D25C8CA33C9, 0x62F59F1798B48A00, 0x298B6D18715C0D, 
-0x3D37951D5559CDE0, 0x6657B7E0248710CA, 0x3A2326E0B6B39911, 0x3907DD14DFC107AC, 
-0xBDFA9EA84CB3F639, 0x2EC671F6EE01B848, 0xED287735938E1B22, 0x18A2D150EFADB8, 
-0xEDD1A8F9AB4583F7, 0xE296895D7FAA7B6C, 0x372333CC40410F90, 0x56C7074085BF41FA, 
-0x15EB7EC074B66CE5, 0x99F140ECF0288597, 0xDAB564419BF934D7, 0x18BAD64F34D74, 
-0xD13A500464059445, 0x15AEA7DC50A2E546, 0x2CF35C52D3408E2B, 0x9E8A945C5B743677, 
-0x98FF64B551EF936, 0x2D13D9C18F33BFD3, 0x580F93B66AEBF047, 0x25D3B432E64F88, 
-0xFFDB3318E6F0717, 0x1C7DB76E42327C67, 0xB25B87E1EB643E53, 0x400B767C54106B59, 
-0x7C5E008D411ADD09, 0x8E2A8B61C5B4767B, 0x97F890949D241FA9, 0x18FF37F1EF7AF3, 
-0xA28D64BF46728198, 0x5A061D799D3C9A7D, 0x72B88413CEE5D7E8, 0xEEC2C0637889E68F, 
-0xED0922E0C53AAD32, 0x817A959ACD1E40B9, 0x7BC0D243A2159A62, 0x341C0B698358DA, 
-0x46ACAC4B47EBB775, 0x83F9F7C24F969413, 0xCB65591AFB3CE8AA, 0x593938196DFDBE64, 
-0x789F53305F4D5B4F, 0xD3292CCF53FDCF69, 0xA493DD849416512A, 0x380881610713C9, 
-0x5A97466082AEF352, 0xCFD343732C61B5B, 0x14E664C1F2D44224, 0x890B5951E74D5ABF, 
-0x77EF69A6D1113254, 0x80230BD78578D2AA, 0x322DA34088E29711, 0x36F1F51B6D377B, 
-0x59DFFDF2F180618C, 0xFFA30D1C20400A27, 0x441811FDF846FF65, 0xDEF8B426CE3E5BFD, 
-0xBE60F5B116EF4313, 0x4F4424E6B8160628, 0xEF862885270EAF33, 0xA5A0D6C3A85BA, 
-0xD5CFD5F3F9C18DAA, 0xF195002314383DA, 0x5E026A3CD297794B, 0xEB7EC8791EE72C3E, 
-0x411D1B51E97966C0, 0xC16F862FA805EA51, 0xF0C1E2736EFC10C1, 0x1A85498D61358B, 
-0xF7BAD07312A1DE4D, 0x9A3B71A61BC4F85D, 0xE9E1D89F7774027F, 0x974D3C3BD23AAEB4, 
-0x9DFC9F2EA5E215C7, 0xB78C63CF2D7EBA3B, 0xF3F6CD8F72C64A39, 0x3309924FCE6031, 
-0xEE6B592D0E8A67C, 0x5FC52903C2612229, 0x9D24E065633C8DCD, 0x2B752D8B88E16118, 
-0xEC15544CA1B41D4, 0xFC64952205D86EA0, 0xA0A6D7DD7F0801C9, 0x32A1323568DF1B, 
-0xCAED3976B079E499, 0x48CA5A79ADAF6F3C, 0x1F3F70198DE1320D, 0x8B8CDD9C952716F, 
-0x7FFD55DF33DB793F, 0x997D941FE014789D, 0xD559024858C7A22B, 0x31041C23BE296F, 
-0xBF27FA3D99B2211E, 0x7DEE512B119E4CE3, 0xFF3D9846202F9C11, 0xC53987ABA89EF463, 
-0x81F77E168E1AB234, 0x4A6D03BEC25E041E, 0x9AF9D8B0D6CBBC02, 0x97122783E3F7F, 
-0xF4EB89AD329DD8A5, 0x3D49E54B6CDE2F52, 0x72275109F906A34C, 0x6AC91DFE6067EBC0, 
-0xEC1A2B548D918EBA, 0xA24E8B705D78001E, 0x584E6841E7B936A5, 0x20417FA361D40C, 
-0x616ED5F456FA2CE9, 0xA954A3F3ACAB1A50, 0xD72D796923A2B49C, 0xA8C5BB3B019874A3, 
-0x9BCB081B41943D6C, 0x9912DFDC9CB5C5E4, 0x4D15FA6FB6749E6D, 0x1F95C589D7A468, 
-0x28CE50359C82C9EB, 0x73F8D68329D399E1, 0x7211F03EC691B095, 0x720A8E1B76354CFF, 
-0xB8E973D5F4B6D755, 0xD5AB574F909B8845, 0xC9D97BBE86E7CF4D, 0x1B66B0F17077F9, 
-0x39A976FF3B0905EF, 0x13A59BBF45B931E0, 0x82584DAD7955010C, 0x145DFE36559C14EB, 
-0x4C4D860CAE4D1CB2, 0x8A8F2858F5CF04A1, 0x86AD29A0D5D88F89, 0x155722FE4D208, 
-0x10E73E0088EE1188, 0x521105BD8DBB4389, 0xDE3F2BC0627BC782, 0x9134407D20B1C465, 
-0xCD1026CB053D0A90, 0x8626249C2008948A, 0xA3B7C75AEBA0B916, 0x21EE200466F9D4, 
-0xFB3D0866916E2115, 0xB92685D234DC340B, 0x95D6262B02E88417, 0x8B94E29D09F3720F, 
-0xC7899C898AEA5306, 0x9AD504B73A7664B3, 0x14E927225080AFF9, 0x35018DCCC3107D, 
-0x291EF56D17ADAED5, 0xED9CE127A8114AC, 0x30E5D54E54416745, 0xDA4350F79F83CCF6, 
-0x58D5FB0E342ACB2, 0x5C59BEB10B087CE0, 0xBD31FDCEF7684A3, 0x2FC8B43E4BC0FE, 
-0x5FE74C4DD80E05FE, 0x38E29074B713313, 0x8539275D60CE974A, 0xBBBF77EF8B8EE021, 
-0xCBF26BAD6903F457, 0xDC7ED540B6688BDA, 0xD81F20469EB9C5BF, 0x1FF63A8A1D3230, 
-0xA114C1849C3AFD78, 0x6426B7D4A1EA5D14, 0xDF62268DC343D0B6, 0x15EC3570143FB339, 
-0x61D439ADBF642958, 0x85CE0C4CEC4BB5D9, 0x6EE8431376E7AC79, 0x3411945B0A0F5D, 
-0xAF6967A925CAA9B0, 0x14C1866D9C46E455, 0x23E5A0A6A4A7AE5D, 0xC4BF14F888828ED8, 
-0x9DBF8A71DA122A06, 0x6301869C6017087F, 0x87C658A77EBE3F0C, 0x11E2CFDC428C23, 
-0x672EB615812CA4B1, 0x3855E1F8F4A6BC88, 0xA8AB9BC3D17DBCA7, 0x64C28CAA8DF3685B, 
-0x5DE9CF4A7BCF61BC, 0x5294DA46840423AB, 0x324875B9A60CECAA, 0x314E3EE85A6513, 
-0x5A91B4A7084982E5, 0xDAAF04D25E3AB8F8, 0x952443C0ED518D0F, 0xB9F08F5B52DA9C06, 
-0x852FFF270480E2D2, 0x9F4F14DBDF8F8A87, 0xD0A0CDA5B17FEA9, 0x1C6F29CAD0146B, 
-0x7C2CAE91B88C6F37, 0x3CFC1D158E52764C, 0x6416361F2AC71A7B, 0x6B153B1F83501913, 
-0x248C2955A9520BE5, 0xC4D3A1B41B36D1C2, 0x674B053CE5940A3E, 0x6875FBB0C39E4, 
-0x48C2C86CFF0DC588, 0xE5E8845E33121BF, 0x1C726B4F56F50D14, 0x35C48E590E1B3B06, 
-0x85A87CE0DB0D4365, 0xF5A9C23F1A7BEFC6, 0x5F67DFA0EBA08A35, 0x1D6986C60CF52D, 
-0xDB5D9E132BCD59C4, 0x7785443E480E8538, 0x99BB48877844511A, 0x7A8E22C0A1178F09, 
-0x5F53E2F1A929B1EF, 0x3E14131342F1B122, 0x76BF78F54E9079F2, 0x124ABAFF787F9F, 
-0xE3930DC39C72819D, 0x857597F1CD0666DD, 0xC2F837256B27ACC5, 0xF369DBC20FA1F167, 
-0x9464DC761C5EDBDB, 0x9823C0A1DB7DC3CB, 0x863A779F5FA9B34F, 0x33A56609472B18, 
-0xF48527561AAB6664, 0xB6131D3F0DBB186C, 0x266D263000EEFE5C, 0x5D27347C927F09EE, 
-0x3C3910176BB7D875, 0xBC1063849796BC4F, 0x1ACE3362333A6481, 0x74E42A1ACA852, 
-0xF9404B60E3DE8582, 0x63139E3678DF5602, 0xB717E800E1CE3110, 0xAA65C4AFE8247C68, 
-0xE594AD0FEE8E70C6, 0x10741F08774D3CA2, 0x7A973532E3EA0D47, 0x222896A5A60A5B, 
-0xDBF06E433E0307D0, 0xEA53CFDF277D7F66, 0x94F26987C4888954, 0xBCE729C50C606AB3, 
-0xE26DD592E91ED9DE, 0xF71C90998D2C064A, 0x879068A96A76A299, 0x1833C6B0258BC6, 
-0x45BB9F4A839BB2E4, 0x85B2AFBF22FAB969, 0x13AE16B32B28B60C, 0x310DF71AD22A3FC2, 
-0xB2EB59C0E3622E92, 0xE41BBB5DFD6704BC, 0x3AC89F288536E9A2, 0x34E60B5ADF4BD, 
-0x8454E4F9B7F1E826, 0xD9F439C1834385E5, 0xC75260ED29F9EF54, 0x821F0EC1490AED5D, 
-0x799449E2388FF264, 0xF1E1840E54D886AF, 0xF15E8F080BE79CC6, 0x2E469D2A9E5069, 
-0x47C8D2E6F253A4A7, 0x4BA1336065CA811A, 0xBC98BABA99E23DE6, 0xE4B65E37457ADE8A, 
-0xD9D6E8009423EB8A, 0xF368F3469585C943, 0x53C41601D79BE6A5, 0x1C4FF17A687190, 
-0x68995D81A766E64F, 0x9E636AEAA1494ACF, 0x1AF982D8BE4E1D0B, 0xA59325528A6DB7CD, 
-0x507A1C165481F15F, 0xC91F934384D2E220, 0x14410E688A03807D, 0x29820FCA7D20F1, 
-0xA3ABB9DB20EAE98E, 0x9FA8D0C27E40853D, 0x96401824365F16B9, 0x55C26873CDA91FB3, 
-0x199A4E4EC17B3CC9, 0x7CDB31594410329E, 0x63ACF72D6EDBCD45, 0x3C2B14AA0AD914, 
-0xC99B729EBDC54F1, 0xB416645EF1CE723E, 0x3AB37C5971F2F43A, 0x4E45770BC13CC867, 
-0x5B791E293EE4CDED, 0x6603D4BBD11C0ED7, 0x8D8791D229124A65, 0x3B4F94690AB0FF, 
-0xB0181D986453720F, 0xE7CBCF78B2F0778E, 0x55BAEC0794A76C8E, 0xAA0B79B33FDFC62B, 
-0xDEBA24C0BFD38926, 0x8A78125BB98C672E, 0x197C41A5150B2E6D, 0x3EFC3E4AD64616, 
-0xBEF1C89D19986889, 0x9836E12E8C3D8B30, 0x7FF3C581301AB8CC, 0x5ED22435BFD2C918, 
-0xEDCD9E616A9B97CB, 0xFC8FDB5EECB02AB9, 0x748838F9E77A956D, 0xEF030642D0BD8, 
-0x73825F91635AD5CE, 0xC5B08C746906E00F, 0xF2AE3CD2FAAD261D, 0x60E34AC0E270AD4C, 
-0x3D362E470007CA32, 0x1DC975618C798184, 0x4547F645AD691D68, 0x2C9126D177562B, 
-0x97CEC28CCE8E75BE, 0x99AA8B96780DA207, 0x482D516850EEB7A4, 0xB24E56C78CA68074, 
-0xB1FA6573F9201FA7, 0x6CD04F79DD77896B, 0x9F66365FEDE8FB0E, 0xF3BE81875641, 
-0xE38CC8E469F0B3FD, 0x6A2EF3A5272F400D, 0xEC761702E049D94A, 0x9B7DEE290ADD29CD, 
-0x36368900C2EBC1D0, 0x2B0B235D9D313C16, 0xF68075DE6471E11F, 0x168A7414B4FED7, 
-0xB5E2901D8128B737, 0xB216C8C0234365DD, 0x19E0E24E22DAE047, 0xF0836C634D6C7B1C, 
-0x7161A6DDB9779FB0, 0x725FA60F7A50DCB2, 0x2CC6A215D1B75842, 0x86DDB7378C7B4, 
-0x1F5C3DC5AD81D366, 0x6837465D484A4A7E, 0xBE734254B0FE05F3, 0xFDC14B5078274862, 
-0x81FDA805F281604C, 0x49B825A70F8ADE99, 0x4AC20F04846F8E2F, 0x39E3BBA62726AE, 
-0x1DEAB68D8F353DB1, 0x5F78542E785B6D7D, 0x87187DE93F40B8AE, 0xE7A2F46648EBA2FD, 
-0x7FAF8477D4CCB8C1, 0x8EF68EBD9F4E3C3E, 0x22E2F078A9E88739, 0x1E1CF90A28B5D7, 
-0x3990E532CDFD83C7, 0xEDE28E549A8E7AED, 0xF858A2EDBC040A5B, 0x7ABC8D58262F3E69, 
-0x6653BECF7A7B781D, 0x7F15731D12738D23, 0x1B0AC6B240866BA5, 0xD91E4B111A368, 
-0x2A0032806B2C4CA9, 0x1BA5656E2891F6E2, 0x954EB5767EEF7F98, 0x612F2A2AC342E429, 
-0xFF54F341963D505D, 0xAFD9B97AB7400690, 0x28999F30A9AFA656, 0x1BE1BBC652A8C, 
-0xD5881A73C38958D5, 0xB51F4A50A87E0BA6, 0xC3857EE4E1491ACE, 0xED1B435A704592CC, 
-0x90AB4DD684600B4B, 0xAE5209EE17C8C8E0, 0xA144C436E3A2A6EF, 0x1B3C090A1DE49D, 
-0xFF97DFB3B5188264, 0xA81F67D07C1A78D, 0xB81650958D56B1A6, 0xE9C36A45B515BCF9, 
-0x6F01C81B71B4C05E, 0x8FC6D9AC3099E12B, 0x1EBCAC5AEE2E1449, 0x29F6417D9DE077, 
-0x5588008ED2EFD30B, 0x3D4371B67E65138, 0x6F979B86471691B9, 0x82C5C9B0C4A776BF, 
-0x6D3D1A36933711AC, 0x24171BA13721C31B, 0x62EF1F220CF773FA, 0x402AD26821B1CF, 
-0xE1F7399BA49E2642, 0x1DA9893DB833B9B0, 0x3BA07D53900A440A, 0x5CBFD221AD76CA30, 
-0x573ABC36129C94B7, 0x692067992E3F35A, 0xB561D4833BF06B9, 0x18596C54E53261, 
-0x48343973DFB212AA, 0xD7BA5B6F9E0EDA95, 0xDBADFE3D7FA8113C, 0x8CFDBB6AD517C7A2, 
-0xAE53D7EF344DCAEB, 0x5DBF8D05F0F11D79, 0xE491F3CB126B1D45, 0x1385AEC6A20283, 
-0x33803595C1D24DA4, 0x6810ADD4E15D809C, 0x6379303BF7765AA3, 0x3A8B78DA7976E4CB, 
-0xC49E41CB5BB381AB, 0x20DF837E2FDC6B94, 0x4468A1FDA491E425, 0xC7604EA9A4CC7, 
-0x3BC5F97EA55D01E9, 0x2AB6986E267ADA04, 0x1CD35766C667E29F, 0xBC02690295B74469, 
-0xE2E330EA42D4A0DF, 0x3F6820E040439345, 0x425E8C7564EA3B12, 0x112C6A38A6147B, 
-0x7F09764C56F525F, 0xE62FAD630A6D5E95, 0xFD69ED48A8D63E76, 0x3E4431BAF0567EB1, 
-0x39C79B8AC4FB08DC, 0x9405A9CF47BA3E84, 0x5EB6579A1AEF9C5F, 0x15CEDA5FE683C6, 
-0x16814F03225ABE00, 0xEFFF372C16214DA7, 0x72E9755D75A9D74D, 0x3768C1484B2ADE32, 
-0x75CCB17175DC21C1, 0x52E03C2D79CBB70F, 0xBE4D48D005273D00, 0x3BA16CA3AB55A2, 
-0x2404835350BFA0CD, 0x92D32BDCE206894F, 0x515B00321F9DAA51, 0x5EC1BE2D9D116A13, 
-0x5621DD7B8EE3BB2E, 0xC9923993DEC0263B, 0xA73AD226424D94F2, 0x2886CB020E8F75, 
-0x23305D29B038156C, 0x98359E7EC297B161, 0x8715A0C6BD2F9800, 0xD3674B66EAF6D4E7, 
-0xCEC6F0E023B84B7, 0xDF6F1C47083FAAEB, 0x2E25C6BC3492C23D, 0x8AF5E0C83F9C3, 
-0x1CD019697FD26713, 0x4596CE7D41AC4AA3, 0xB25CD75037B3F49C, 0x194A612A5B002B91, 
-0x8C4EDBF139A3FBFB, 0xFF074169BD8E00D9, 0x30099BD63702ADEE, 0x2AA64A3EED58C0, 
-0x425A7558649CF532, 0xBD1F357B30EA0648, 0xAC23FF8A2A57B5CC, 0x5151C6D380F93C31, 
-0x271E48231AAD7E96, 0x4F4A52D08924EF3F, 0xD525D7108EE5DEBA, 0x357E2436C98972, 
-0xBFD1D06FC19548B1, 0x8FBCA2EDC6BF24FE, 0x83A72BD4741A513F, 0xF6BBFF22D64D6808, 
-0x1E588FCBC44208CE, 0x7487AF23997630B5, 0x18D089B9D0F86A40, 0x14025ED9B28974, 
-0xA318A329C3A87355, 0x6DE2BD5716974062, 0x4D3733F36E155DAA, 0xBE9285B78B123F22, 
-0xEEB12939400E1374, 0xD190E0647C98A21F, 0xEF50C8989D4D86FE, 0x1059A5CAF9F153, 
-0xD304176F8CCCAD76, 0x83FC9C4454214AE1, 0xA06F575CEBBE5B32, 0xE48A366D6DB3773E, 
-0x8E8D403C201C45B4, 0xE0ECE31716953B10, 0x3A207D4CEB5B678F, 0x3AADBD4CE10B2E, 
-0xC259912F7AF16EE1, 0x497F7BC266E881D5, 0x417B0BBD6F64D1BD, 0xAF173CB741D2D172, 
-0x97C74469BE195E76, 0x44A2AD7438E7C8CD, 0x3E7115473D29770D, 0x142AE7F03A8074, 
-0x16ED988F3F35D61, 0x2F70F14AEE175B6E, 0x48F4CC8915C4CE7D, 0x5E0D0053A2B4A6EF, 
-0xB19103FA76592B09, 0xB0A7C2B8F44E8A09, 0xC7954B0AF49A6AE9, 0x3E636A1EC4D9B7, 
-0xBD9FB97474BE9AEF, 0x2254547EE5053EC6, 0x44080AFEDF9923DF, 0x78CB2431C966298E, 
-0x15C3C00ECB279A24, 0xF4885A6B08156D9F, 0x96E034FA53B68B1C, 0x35A26A8D74DF36, 
-0x77806A3A4137D48, 0x9F2D61BD11C8DA81, 0xC93797ECF9578093, 0x4D26C45593404137, 
-0x4F22919470CDB1D6, 0x844A96E46CF05371, 0x15822A08412B7F21, 0x7B7058D8C4EBE, 
-0x7ED711C8E691BEE7, 0x623EE5A3262A4471, 0x5D449F7F5206170D, 0x187BC033C01F3075, 
-0xA063F85895263CB3, 0x8A3877293E16A65A, 0x56F3A4CC1690D9CF, 0x809B56117D1AB, 
-0x8EBB93CFF5599265, 0x75321817BCD93889, 0xC2A6A7B1AD72F74C, 0xA5478DC16DF32BD9, 
-0xEB8BDC5B94DEC1D6, 0x5A32177B48988039, 0xB5BE400C023953E3, 0x7DC909E0F2BB8, 
-0xFD9AA8ADAC1828D8, 0x55454C4364262BDB, 0x6B5446FD42AF6E2C, 0x2C35F24C4A53D8ED, 
-0x143DAC668D0121BA, 0x33133620B1D53624, 0xACE16844383B4728, 0x27EA87BDFE8C3F, 
-0x7FBEC77F307947E9, 0xE6FEEDB8B0110800, 0x16E635685B84EEAA, 0x6B91596E607C0A01, 
-0xB572669378A666E, 0x540C6172F12A5E62, 0x1595DC55B3ACA222, 0x3CCE59BD031E2B, 
-0xE554E931C9C3C3E8, 0x362775AD93C474C9, 0x4CB01E2A9D180C1B, 0xDD74970E5C19CFAA, 
-0x5F3D99B19ED51155, 0x504699FA9023C4F0, 0x463E3C96AD3B7A6, 0x745B263A57C45, 
-0xA7F40B25284A37F2, 0xDF6D1AD79D8BABB3, 0xF831133C999A8D89, 0xAAD5FE20A3A6CF47, 
-0x856A644585510EB3, 0x81FAB32559BE5B21, 0xEDA957B533E762C4, 0xCAF566887DF28, 
-0x4C8DAE571431C6E6, 0xDEF4D3D3D5982A34, 0x9199AA4738A8B64F, 0xC7064516EDCE8B56, 
-0x49065EEDA179135E, 0x8730C6194320CB4C, 0x78F08EDA10074402, 0x31B922A5964B08, 
-0xE8D812C315856058, 0x39D15CD594DF9257, 0xABEDCFB1863CD2A9, 0xE520DA5D84B5D445, 
-0xCA90E504CB2FD0A4, 0x5DA948CD1CA2C82, 0xEC719331DA90281C, 0x3EE9B887A4D581, 
-0x194E4C3A51774B81, 0x93810CBAF82870AF, 0x80380777FEFE5DE2, 0x8D803F8589823AC9, 
-0x83AB2A3324AA53B6, 0x7F475357339DECA2, 0xC4D53B050C294499, 0x235CDDAC4359F, 
-0x8A06B858C8950A33, 0x4AD16044BE878FBF, 0x856D450F39052C1D, 0x363C13334EA0C728, 
-0xB1D6CC5F263666E5, 0x61F712E804638DB5, 0x3CAC76C0AF7A3CD9, 0x147FF05C3CDD60, 
-0x5E64D997B1DEAE60, 0x5A4BC037DB27C9D2, 0x28E88F2B425848D8, 0x27E0DE772D424A40, 
-0x8BC9E54301279647, 0xE9FD01F61B3AEE4C, 0x597D8C1E3C0B7630, 0x2D5D43FB86A33, 
-0x2C53A3F3232F3D99, 0x333554C6979E2379, 0x26399F1526BAEC47, 0x56AE3553AA2E88B1, 
-0x3120BD229A2C43FF, 0x565EC9161A402539, 0xE4365FC848C89D4, 0x24E930CBC5E8EF, 
-0xEC44BAE4992450F5, 0xA3ABFE295A829A78, 0x7162BD2F9BEF2D6E, 0xB1A30F717C55FD83, 
-0xE94800D9F8A44AAE, 0x35B6BE227156BFF, 0x94FC0CA26B963883, 0x12CD20DF5055D5, 
-0xC770A8BF6223FA51, 0xEE85AA935DCC9F82, 0x7C127DB6613F3B21, 0x952CD0AC176AD872, 
-0xB1B432FCBA6B40C0, 0x19A5C990D6A57683, 0x961277C9F63559A, 0x2DBC0FBA34B997, 
-0xD7E8D468E964D9EF, 0x86B35A96F337EB4E, 0x44E11069106D7856, 0x9C36F784A8A3F2C0, 
-0x46BBE9F8930B2EE5, 0xBA93C03D7478F7E, 0x2CEC3BD6FBE3CEA4, 0x12E47E80AAF488, 
-0x6F9A05EC3C9F5FC1, 0xCEF15DBABD1A2FE6, 0x2D2BA5CF23837883, 0xF074C05C5EE796A, 
-0xC5519632673FA595, 0xC3467C0F72928CA7, 0x8E7B305B4117985E, 0x3F26E3BD356B5F, 
-0xC8F1956AEA568B38, 0x2B562D11DEA8D175, 0x42BC28B97E1203AE, 0x5AFD7EB8AC631707, 
-0x895A4748196FF15E, 0xDF619D195672C236, 0x58A5CB62D27620A6, 0x2E790C7EB8D41B, 
-0xBB1C4750905F8E73, 0x1ED19EF3CB8DB854, 0x3D04234625CCB5CA, 0x48415FA6121C6C53, 
-0xF5671A35D2DBB4A3, 0x9817DBDD02687845, 0x5A7F9BC64BDFB03E, 0x2D7BA02FAB03AB, 
-0xDB92EDE3DB6C0D88, 0x7A3F06BE415A8F7F, 0x211E927BFBF20E19, 0x43BA732040C37F16, 
-0x47AC43CB3483B7DA, 0x1C4D72B1EF7FC1CC, 0x6F37D076A1D6640, 0x1063FEF9A4D607, 
-0x6BC62B30317EDD1B, 0xA772E30FAFBDAB20, 0xCF7E27CB2ED31977, 0x4D4D433030EFB2, 
-0xBDCCB77A6891A9BF, 0xFBFDA69722B1F032, 0x9019ED7F0881BF04, 0x1A416BB8772908, 
-0x60F38FC9347A0208, 0x64991A5EA043E37E, 0x8BBCFD379D62ECD4, 0xC3E793FB5D9A802A, 
-0x7935769CB72B60CF, 0x380E0F2FD51E5400, 0xA064455B913BBD44, 0x347006E7B2D857, 
-0xCBF79D1C9FB33CBC, 0xDD4B4CB4FD5400C1, 0x9EC27710CBB2A35, 0xD574208C10F40F68, 
-0x948B3D0545C4BE92, 0x4EDD32D0129BD252, 0xA15251F3AD3EEA48, 0x196D50E579B182, 
-0xAC84F4270E7BB5C, 0x6E20E3513466B3B3, 0xFEB6273170BB5EDB, 0xF8111B1FC4921A73, 
-0xD2E3D5AB668D07B1, 0x9106099F66BB291B, 0xEC726C961A53F35, 0x8F3A83AAB17CA, 
-0x3BD4BC73DE9C377B, 0x63F96924DDA17A8, 0x5271E54970703B6A, 0x6C76E7EE6D85A725, 
-0xC365F4E607EA0AFF, 0x4DBC3A6C631061F5, 0xCFD24A07545F177E, 0x35AF66643A15A3, 
-0x1DCFE6A66632368F, 0x9C99E888D97C748F, 0x6E02ADBC058526CD, 0xC7052AEF8CCB6CAA, 
-0x829E9462A312A73F, 0x3D6F4F4267B9C4B, 0x43945B3A8A842437, 0x877085E88C7F4, 
-0x4D158287ED5AD12A, 0x67BC5E3A84DF0874, 0xF13F94D7359A6FE4, 0xAA64690E759A20D1, 
-0x5FC142B48D6520A9, 0x5330FD3F547174CA, 0xC78FF6D98CAF87F0, 0x5B250E3B3E9D5, 
-0x1A015976AD54C7AF, 0x12F1BD3631044299, 0x86562E2B18EFBF47, 0x43F4617C7400680E, 
-0x4BFC1E3897104C41, 0xEE47F22031A7D114, 0x1F28F5C7E3292DC8, 0x1AA8E0A9F603F7, 
-0x9396C0A04A4B372F, 0xC192B9D60B29A89A, 0x106FC8E2BCB8812F, 0x989AC695B562CA73, 
-0xD66CBFFEA2E71E96, 0xCEB7DA16791FA136, 0xFF766B55CF66561F, 0xD68D70BE024B5, 
-0x8DB0F586447B532D, 0x8DFBF7D88F3D90E8, 0x3C7C04B7F3F0D903, 0x741BB0198CA2BA3D, 
-0x7149823E7DD45415, 0x96747F045E1B47CF, 0x7126AB4F7ECC9ADE, 0x3945E61215AB9B, 
-0x4A16B5708625F2BB, 0x600C2AAD3B640091, 0xE066BF5E09F93E1, 0x5F4BBBE0DF16053A, 
-0xFE47B49AD856EC92, 0x2DE5409FB51399, 0xF96C466422A03D8F, 0xFD3D286AA3D75, 
-0x35CCB2ED9932B00B, 0xA8DB9B2CB653427B, 0x953FD89E7550C3A5, 0x4009EE36BEE9A3ED, 
-0xBB262373FD80A5E5, 0x77AED856A5971C22, 0x90FC6C881EA983E, 0x9DA44E3684F28, 
-0xBB46F879B926C114, 0x2CC3CD5A032C9E59, 0xD311E27D48D3CB, 0x635E9A2F51C74DDF, 
-0xBEF7095504A4059D, 0x5AFC03E893EAEA2, 0x4BA62CBD57907269, 0x31566DAF9D73D7, 
-0xA252F188EA154800, 0x7ADE7000D114E914, 0x32D91C63BEA7BA32, 0x6FAE2B5939265E5, 
-0x872779F3A91A0DB5, 0x5ABC4B20818614FB, 0xB088312F9C81640F, 0x1BE701C3BC58AC, 
-0xE741DAAEA6726DC6, 0x9DB32FFED08E4B1, 0x7E683679E5D3C40B, 0xB28DE072431ACE32, 
-0xFA5C28897B64AE60, 0x1A72A1827730FDDB, 0xC943FE082C9AB28D, 0x29191FAC977AA8, 
-0x44EDE8FC542623BB, 0x2AF06852A430116E, 0x22AECB4F87CCDB73, 0xBF75555E71121607, 
-0xC2B611DCFE0EF7E2, 0xE2919D290C3D2BE1, 0xB990693AB78F386C, 0x208D795462B655, 
-0xCBDD7A741F5D57E7, 0xDCED64B276A903C4, 0x3BC4A1BF259F30C6, 0xB11FEB401D1685A, 
-0x866E50C7E32A2211, 0x11F928C5A008F07B, 0xD49F442A3C56822A, 0x13EAEA59C4C005, 
-0x92AFD163664526D5, 0x42A3492FC35FAD99, 0xB4B77CBB0C91BD70, 0xBBDCAC3A8A623696, 
-0xDE07D176E28D5C7, 0x54D93E0B46DF1A23, 0x87E7A8C9C6AE35B4, 0x52F9B83B13CE2, 
-0x2B1B191F91CD80D2, 0x7CCA870F00179E89, 0xEA557703F1D0B3D9, 0xD5261B3F636FDB84, 
-0x7A5E72CBB328976E, 0xD09EAF501C182050, 0x6015B92ABE522449, 0x386341D969A7D3, 
-0x12E5CB3C56BF7F75, 0x965936BE64E46504, 0x3340B26CF6CAAC82, 0x3D13FB4D25287CAD, 
-0xEED068B0CFF8FBF2, 0x2E613EF12A7E1E0, 0xAA523B0636FE2CD9, 0x10E1D3BEC95DAE, 
-0xD6BE32D357DB59F6, 0x2BB4C796F4CBCEE7, 0x3971D81605D80E68, 0x242EC44EBD0D0BCA, 
-0xB3FD3608B13912C8, 0x66D6A02F49BAC11F, 0x3668F19F63B75797, 0x1AA986BAE834F, 
-0xF68BF9CE511AA411, 0x2A192B7D51FC007C, 0x1C611F536F885670, 0x5B919D3D7C98020F, 
-0x2476A295E10FE316, 0xAAE84AF31660F237, 0x41308FC77741DBEF, 0x17D51CE041F5E3, 
-0xBF7EEF59D6B83998, 0x206FF20D5DB05410, 0x7E0ADD31B4F90F0D, 0x6EC637DD1CF8007, 
-0x927B5D5378698523, 0x54A10149017B2ED, 0x73645EA4927F2096, 0x1E1B07789E47C7, 
-0xFCEF96CC27846A47, 0x872CCECB74B16097, 0xAD5B5DADAFA829A5, 0x23A9AAD0B7471625, 
-0xD913F0A3C80DBF05, 0xB169474341AA3676, 0x7109814C8CCA2CE3, 0x2CCC750D805447, 
-0x7FFCD552F34DE14F, 0x9A6A160B38C5AFF6, 0x26A8685F19606992, 0x2DC22A7F0B93D81B, 
-0x46813292612516A7, 0xA9876C091B84D2AC, 0xFDC034B5F32DE253, 0x376FEE3AFD9F07, 
-0x3EAC49DFB3AAFD5B, 0x7F01A0A9710F53C3, 0xF8ACB1508D6EE206, 0xF2A9C78E46A3ACAA, 
-0x529BB9C3D7497BFE, 0x4EAD4A8C4118CE6A, 0x5A2718BD3D7167ED, 0x3AC36077AC80FC, 
-0xD7141D65559DC2F7, 0x9EED920B0B977DCF, 0x3E3D46D794707EC5, 0xBB38E7F66121D573, 
-0xA9B0098B54F3BEBB, 0xBC3D63F81C6181A1, 0xE67C7E825EB5984, 0x1927828F03091B, 
-0x1DBF9CBD3E4F234F, 0x6D3E57A88C9B9374, 0xC3B9B4F63229B870, 0x25D2F5970C2D5163, 
-0xC4E92687733A7813, 0x6BD8063A1B013FAF, 0x9B7E35735BA0299B, 0x2A6E396C7E1385, 
-0x3CC8974B404C5A61, 0x8A4876385B2EA10B, 0x3120464F6F094573, 0x2814238E2E8CE25D, 
-0x6E4C6C4D2C873373, 0xA37D6AD02A6F8CF3, 0x848591B8F468408F, 0xCE5701D1B5C61, 
-0xB027C939FB8A272B, 0x2C50D7A67F6CE2AE, 0xDA42DD1B1660E33E, 0xDD00F510260D0AB, 
-0x9E17A1E5D4E7FFAF, 0x20E3ED84A833ECF3, 0x7A21BDDCC3D1657D, 0xE13453CEFC9FA, 
-0x2B8514ED53462F40, 0xC4FA3C4D29456AED, 0x7570FBC9561698A, 0xCBC21CE603D2888F, 
-0x72307505830EE28, 0xF6E863E60C54DACE, 0x8B86CE0F912397E2, 0x4F2967EC5A1B8, 
-0x104B64F259F83320, 0x3B2ABC0E049E4EEE, 0x4F5216E7180B0E00, 0x3BE100A0EBD9AE24, 
-0x3DE682E33A6BBCC, 0x3F6EC4909828479E, 0x8EE149DE07CAB562, 0xA308BD37928D5, 
-0xE4C19585421E2035, 0x786BAFCBC7A72149, 0xCEB64F3158769102, 0xC7DB5887FF98F6E2, 
-0xC0D067C1E753D90B, 0x5BF1D89767584E49, 0x8ED285DBFD1AC775, 0x5425E5D60944D, 
-0xD6460C6D17E65349, 0xB1674963C6162607, 0xD3CB1613FE9805E, 0x6932E404F435DEF5, 
-0x8C44797537988068, 0x314D4D2D793AEC9B, 0x20A49C895269458C, 0x768747BB98B5E, 
-0xFDCAB370E61221CB, 0x610831BCADC7A79F, 0x5304EAA2F4F3F615, 0xC355699E1B5A0990, 
-0x7B7B107CC3155E8D, 0x70D5DFC82EB4B066, 0x1E53D126B82FFE14, 0x40340D11393752, 
-0xE5E2F7F0A0F68DFD, 0x3451956371F70B9E, 0xE6090213744834D7, 0x84B3C8A02508A69, 
-0x7F6AAB761803A031, 0x711154E0AF7EB9B9, 0xAA48F531B35EA365, 0xE5E391288F97B, 
-0x974B0ABE74EC1A8F, 0xEFD354A0B42A397D, 0x4E69B39F3578424C, 0x84777D513C4242C7, 
-0x77B6D37D8701F054, 0xBEF7E005D0830D5E, 0x1422E32CA6A54F40, 0x8C9BB9517F9E, 
-0xD620CDA6112EC0FA, 0x758312C4D82AAC90, 0xB76D807AD04C4076, 0xA2E7761FAF34D3CB, 
-0xE6F2BA38DAC2D942, 0xB5454E6F6034C4C2, 0xD8F65D451C3085C1, 0x1D781F7D8F583B, 
-0xB37ECDA0518B7991, 0xAF96ACC83AF9B164, 0xBA410ACC26568846, 0xBA1718ECCBA7FB88, 
-0xB061705C3006A8D0, 0x6092C66BC92A1094, 0x6788E09675FC77C5, 0x3C04E9F4711ED8, 
-0x23D84EAD4080D4E3, 0xFD92B39B15CD2D40, 0xCF5D2C63EF60F126, 0x9076BF3936B9BD2C, 
-0x33CAB0B586A770F9, 0xA717CBB3843836F, 0xBD1FFE5E0FC3FEE4, 0x239B527A06C914, 
-0x54AC6793A92861AC, 0xA9DB78AD3D5DC9A9, 0x30AD9574E47F2087, 0x68E027ADF9BA322B, 
-0x579AE2B93FCA077, 0xA857929EC394F23, 0xB2B420526158E7C, 0x3365EDFEB7B1E, 
-0x77F5FBCB8A5004A4, 0xA5A829D0C293E7E8, 0xB677DD4ECA55866, 0xA1FC43A302CDA8F9, 
-0xEECB50DD28B71553, 0xC8DF3561E1D172FD, 0xD35EEA212D6DBF88, 0x1BD5B4B5AA1E9D, 
-0xE5FE58D0A44E7299, 0xD0ABBD71CB9C6C73, 0x2292362AF816129D, 0x1FF3EF68110EEEA3, 
-0x9FADAD971D0490C8, 0x7D26DF43DAB402C, 0x20BFC5E1FE8BC314, 0x4051C78F8DEACD, 
-0x8504DA178D7A9347, 0xAC0CCB6AC834B43C, 0xBC2C8B8C4F95FF14, 0xE8EA28AF36D0DB56, 
-0xE49DB1FD4D709720, 0x9D7A598A87DC4663, 0xE7CCD1518F5E0109, 0x3E6FD84D75A1B1, 
-0x57B9F30CEF10E50C, 0x81C2523E949564A1, 0xF889F37F27CB6DAA, 0x251F297E107F5463, 
-0x216BA14C0C8E7146, 0x948555E2036A27F8, 0xBCF6F93A10172B99, 0xA91F30F21F90, 
-0xC1819BD987C141F6, 0x32781013604FF091, 0x4F3A49FFCBEC1BCA, 0x2AA309669F01150A, 
-0x87CCEB9697E74D3D, 0xAE5C67E77FB6B352, 0x8AFA87C5B72E8162, 0xC7E3CADC13CC2, 
-0x7D48CBA04CC3496C, 0xEAEC2A338AAF8574, 0x60EC45E754A54C73, 0xC28285F7707940CA, 
-0x52B10A1814D32C1F, 0x1E9402C45B3CE643, 0xEA175DA2E95E7467, 0x3CE2930E9E1F84, 
-0xC076ACFAF02FD9EF, 0xD1FCDA2F27DF984B, 0x2E7DF56E2B299165, 0x2B28E5EF89E583EE, 
-0x8F7DF9A767EF637A, 0x1AE7ABC541C75601, 0x87201102CA98C4E8, 0x110E421474784, 
-0x567C797FC821B953, 0x571DF3BCCDB9C806, 0xEFC252E03E9AD44B, 0xC220829C470031D0, 
-0x78060A1D3010DF5D, 0xB2265E31B2A058FC, 0xEA71E1AB6BE2DA58, 0x24D9253917EE6C, 
-0x234062B6F80A3C44, 0x1CF3E4E4F777947E, 0x95FAC773482E19AA, 0x109A4D5721E01FF7, 
-0x4A303EEC4372D83B, 0x9549566414AB4E54, 0x3EFE03BCB1900ACF, 0x328D3657714344, 
-0x2F757021817650E8, 0x24016380D99CC1F, 0x9725A9C1EE9650D5, 0x86B44F09A5D78A9F, 
-0x3F9637C463E4CD28, 0x65790CDA4B7ADC39, 0xF6C83D2793697F5B, 0x1B35F0AA31798E, 
-0x6D2AC7A58CCE9A9, 0x8D9B82C69EB97AE3, 0xD44E1742DCC7034B, 0x4EC011CDBFF6B39F, 
-0x2A1A7C0AA33D3BCD, 0x903F2019142270FD, 0x5748185834577EF2, 0x3F1BD52089E552, 
-0xA4FBED1AEF51B926, 0xC7895B2D6CE53C97, 0x56E86B2450963848, 0x82424745AC30A196, 
-0x397779D7D44DA0F2, 0xA9ECE13AF608453B, 0xAAD060B535909BBB, 0x137D521E05EF26, 
-0x80B51B27E37AC1, 0x628EDAAAF9C48563, 0xBA3C6088C2C075A5, 0x81A616993753A097, 
-0xC532F9FF182BE8C, 0xB307C0328807E5F, 0x364078B33C16731A, 0x3D9AFFD70CF7C2, 
-0x4A24297C4C73BCA5, 0x2C1BC1DCAD811DF2, 0xF5DA6DDADBF584A2, 0x17AE1816FEB7F6D9, 
-0xCE5C7B51E0BB9AFA, 0x5F84EB54FEDE6F62, 0xB8D14CDD8BD980DC, 0x383BBCF4B9570D, 
-0x38D68CB3130079E, 0x127CCA87A7B4DE1F, 0x2D31EE3C3A6D3467, 0xA4F4C4B7B885B02, 
-0x7FF064A50BE54E7D, 0x877C83FE377667E8, 0xF464C3917D91B925, 0x3E0DCBE77039A3, 
-0xA07537D416424E5E, 0x4575F34F76066779, 0x89D4DFDE091818B5, 0xA1B868C620F14DD8, 
-0x44F6AB2A157D2908, 0x3A42C3014B8044A9, 0x815BD4D6469963AA, 0x118493574B4DAB, 
-0x921CA98BC8D90048, 0x7D637CD4CC53FD3B, 0x41ADD36AB0513AD9, 0x1A00896C5CE9CE18, 
-0xFE185832CED9EB60, 0x4A28EC4B074406D0, 0x79A9C7C7519CA122, 0x1F466E2DC223D8, 
-0x8D91B3EEAED87BD3, 0x1D125F569AE5B14F, 0xE57AAF9BC3BDDB81, 0x703AFF91248CDDA3, 
-0x3CC1A3F0578C2C40, 0x5A7B3AE195A88A0, 0x18BAAE305736FDF4, 0x2EA8F5923DD75D, 
-0xDE5467A6BA6730A8, 0x30EC9F1859894CE0, 0x1E3730076CF8E7E4, 0xD729393B43503F56, 
-0x723891627E4863F, 0xF81055B6E6F682F9, 0x34F9C81CE5B01BA4, 0x2CC5ABB21E74CE, 
-0x11768593527D63BB, 0x5D5587C5F325A50D, 0x3A4CE088385CF6A0, 0x69E99218ABF2C6B5, 
-0x6719C8CB54B6C7FF, 0xBCF60EA0982D7DFD, 0xB173706D016067CF, 0xD8A6E5821D432, 
-0x85C4962DFBF6241E, 0x1193208B80E76FAB, 0x2EB955F6837807E3, 0xEEA63545A4CCF0E3, 
-0x6E05FC3D03A71EF7, 0x87F3C30A901B65D, 0x6A126FA6BC8AF63F, 0x3F5703CBE59BA5, 
-0x3F3408200ABF661A, 0x64547C632E65A71C, 0x44A84DD5BEE4970F, 0xD888421975673E22, 
-0x5080233DE1E72E2A, 0x13029C427BE5642C, 0x7243D027F6135333, 0xDBE794800B56F, 
-0x2916A58A279626F4, 0x3AEA28AC8DFF7F2C, 0x3307C5DB20DDA031, 0x88EF8D33385EB8F6, 
-0xE1A6D64E2170F1ED, 0x5B2C5BA466835F9A, 0xF08399F4D55538D7, 0x3E4EF85CF19039, 
-0xF5014B9DEB5C7B81, 0x744EE0672CE1E203, 0x36F15B23E8CD599A, 0x1235CDB4CDEA7455, 
-0x5B5A094557314769, 0xCDA05B11A7BCFA91, 0x3B3B9C518828BE46, 0xB260AFA8C5D91, 
-0x3F6C784C09FE5275, 0x850C48C341C65D28, 0xA17AD3C30E0E4D83, 0xA5BE7BA9942865BF, 
-0x665E0F06CB5225D4, 0xF603DB6F67784206, 0x575BC5B0DE834D6E, 0x313F6E44017DBA, 
-0x2858C291CAB4B851, 0xBB07A5AD7825B06F, 0x2EA81FF8943206C0, 0xFE88D5CAC90A9B60, 
-0x638A5014469EE4B5, 0x61470AD2483E3D, 0xB656A372DE0A3F4B, 0x3F0DB76284D03E, 
-0x7729857475B15211, 0x4C6976D850051CB8, 0xD1A539F05ED5A2BC, 0x93FC4775F36727E3, 
-0xE2524D9CE0F274E5, 0x10FB2035463CF544, 0xCA6743E95AAF2452, 0x1AD8FD5456A2E, 
-0x4BFD85AD73A8F24, 0xD028B2ED811C4C8E, 0x57CE3BA806694733, 0x2E4889D48E5D23DE, 
-0xA7D9C6575C1913F6, 0x2B9D60B771E3A3B4, 0xC6AB60835D6136E1, 0x216198C285A6B2, 
-0xC9DE9FF0D918533B, 0xAB71B5350FBD89CA, 0x329618DCB294A557, 0x2FED1D8DD078FF2D, 
-0x915666F101A59B82, 0x17CB16720F7D24EF, 0x8E87B0AA0799EFB7, 0x14B56FDEB364CD, 
-0xCC7795CDE291B93C, 0x837C9F7B006260FD, 0x1C054C6B46B423CF, 0xEDB8EDC66FF10C5A, 
-0x45547C7881F5939D, 0xE1BA1A28485DEE0A, 0x43240B99E36342A9, 0x3C20B98B0C12D6, 
-0x6ABD70928E50925E, 0xEDAFF304BE345879, 0xF048278B327BD6A9, 0xE27DB78FF262D84C, 
-0xB1C339E12180656E, 0xF7B01554ED72AD1E, 0xE1A7F31D6A637BB7, 0x1506DF3AC4F15E, 
-0x5914AEDF07C37C8E, 0xDF2FA44D9CCA97D7, 0xA0E8F9150278B0B2, 0x6F9136A99A35D50C, 
-0x33868E2066377576, 0x83FCAC47FC3034C1, 0xB429DB358EA3DB93, 0x3E6D71817014D4, 
-0xA3B24FB4C2FE2589, 0x3EDFF6B241A60B20, 0xCF3ECEF5D36F4D2E, 0xB83FCA455B747FF, 
-0x897327AB06BA985C, 0xAB48C28DFCAFDAC7, 0xA032E487C841FBC5, 0x1041104F6866DD, 
-0xB1B935A682EAA3D9, 0x9A36FCFB058080B9, 0x2A35053C4ED74DF9, 0xC85A4ADB5A9DD1B3, 
-0x19839B3D4DC877F2, 0x5233BA7380C8390, 0xB64AB477F40B1813, 0x168BD6145CD74D, 
-0xAC61E90E604093D1, 0xF3627F07FB9C6A2, 0xA5F2FA3BE9396AC2, 0x10303CC40BF2CE01, 
-0x96520B40DE7A20B7, 0x9BFFC2E01950E4FB, 0x481A3D52F2762911, 0x3868386B03CD2D, 
-0xFEFA5ADCBF5EB42, 0x52592721EF9F16F6, 0x465F3D5260EA92DB, 0xC32063DAB2A1B2C0, 
-0xF4DD6A9C6D33A11A, 0x18376703AD5E136D, 0xAD5060EE6C73ED46, 0x359DE5ECDCECFD, 
-0x297BBA0C70F2AE2D, 0x5A9A948969AAE9C5, 0x312A0A8D684EF686, 0x13EAC2E8EA0A52FC, 
-0x5E5E6421A837B7C5, 0x47C9FB01F97BB8A4, 0x6604C2590B4680C5, 0xF463A7F9F7D07, 
-0xB1B7B3E90A0197D4, 0x44C66B892B3A755, 0x50634EBF8F52096, 0xD2E1172BD2C09FB5, 
-0x687191DACF267752, 0x7BE4052D686F8F60, 0x4F3BACEA52B35FB, 0x1423D99DF4322C, 
-0x3F5A5C8E983326BC, 0x315E6FE98D357308, 0x37100597596FA194, 0x4E90CEF3F507820, 
-0x63DADD6B6D6372F5, 0x48F9D1E66454CE43, 0x5D07A85B4E81342, 0x26378E0C0F4969, 
-0x85C781969C7B7925, 0x730A74874BF892C3, 0xD2ED4ABF5580AE48, 0xB797B5F674D9F58F, 
-0x2AADC286F4A05A6F, 0x9BECEECA2CF4DA84, 0xD422C569929CAE83, 0xA8F55010C7650, 
-0x371DCD6D3A4A1270, 0xEF0D3EDC4D65A80F, 0x33071F707C32304F, 0x80BC7782CB920A7, 
-0x21EF5C2B62064454, 0x6B35292340D6F0D6, 0x9F694F874A474CC0, 0x37464E6F081FF6, 
-0xC2EEFC8BFB2826D7, 0x43D1E0B9C0572C0E, 0xB84684239741016F, 0x1E6036CE40B20DA1, 
-0x750EC5547035A655, 0xF3856E32864D371A, 0xCFF105C16DA227E2, 0x2EEDD5A0372C22, 
-0x193E4CBB2D7CEF5B, 0x443D8D207109B291, 0x7F74D15F0E7176A4, 0xAD7530FEAD0B560A, 
-0xBDF4D2DF0672E1C9, 0xD09AE43D3D12B0AC, 0x6CE1A2AC3B96EFFA, 0x34D00595099A21, 
-0x263168C8873B3F22, 0xAD004127D6AD9E8, 0xF77EDB120E85E794, 0xD6F66399B143D42F, 
-0xAE14DC80C5CC3534, 0xD2A019726F54B6AE, 0x176E02B613F0F3E7, 0x37B8887A456C68, 
-0x5FD4AB888390717F, 0xA6D973AB7D858D01, 0xEA27C922D08E5DFC, 0x133AA7477CB494FE, 
-0xA3EB8B8AC077214, 0x78ADF33D80F4EF9, 0x9038865A7A449B5C, 0x251510D9BEB1AC, 
-0x271E1118571EC863, 0x7A1CEB4E2C143B6A, 0xB9FC65CB3EA8C1CD, 0xF4E1D61196120AB7, 
-0xE19945E783C9FA1F, 0x2EF5CC4E6D412479, 0x2D3B28AAE8BDBBAF, 0x188C87CBD23CCE, 
-0xB8F589AD52C417AF, 0xB19BAC2FF279114F, 0xECA6AA6CFAA66820, 0xF6DB81CCB445DB4, 
-0x61A5A70425E65B65, 0x14C591F4065DFA2, 0x84583A647F770E10, 0x39BF1EE55CCC81, 
-0x4CEEFB8145C91B15, 0xF6150686AE08D0E1, 0x2EF0D300F844B183, 0xE33BC267A58F0852, 
-0xFFC4A0B4712C289, 0x955593FD801A9EAC, 0x2DE24102B2226C8C, 0x2142029E0D436D, 
-0xB7DA3D03AF4B9A6F, 0xFCD194F8A331CAAB, 0xD513E58677DDF47C, 0x6BACE525D6E6CA70, 
-0x5E299FEE938FEC70, 0xBCA68FEA1F1BFC54, 0x2A448F74466BC3DE, 0x360C34065BC34C, 
-0xFF402F74D5AB47DA, 0x180F15C0CB4B1E7B, 0xCF9291B98C2AF670, 0x11743328E1F17D80, 
-0x8BEDE3C35ABD7F35, 0xF8D47672B6B322A0, 0x5515BF59E69E870D, 0x17FAA9E6F28D5E, 
-0xABDECD2607C26B00, 0xEA4E8B0A1A8B05CF, 0xE10FB6FD875C55D6, 0xA9C805B9476FB766, 
-0xE6B256E1081DE69E, 0xD49F378F46F0A42, 0xCFC66DDBC43620D3, 0x1760E5D79D4BE5, 
-0x4923FEE4380FA6F7, 0x4D36FD4473A52F77, 0x76281FB0CB67087C, 0xD19D7731293DD7B1, 
-0xDB2B80C42D852E5E, 0xF1096489FB8BF32E, 0xB7BE30C5DB1D5234, 0x31248D802D29A1, 
-0xF013E55D283F6EE3, 0x97CD5529724F4E7E, 0x1EE2952A5A7F37A0, 0x32ABE5F773292443, 
-0xC8325F4BC3C0A75F, 0x1301A9CDAA28780F, 0x60A5ED5D57E4FAF9, 0xEE07E25485CDA, 
-0xC64DC887F96AEBB, 0x9D56A35A844CC273, 0x370B6CC680499AE5, 0x8EA0A3F76FD35770, 
-0xAC1198FAA247178A, 0xFA37FB19BC06C659, 0xE58FE3D34787B998, 0x2D952BC9FB713A, 
-0xDAF5500AFFEEE98B, 0xA10E31F036FC0727, 0x1B04C61251EDE681, 0x531C93A950B23804, 
-0x1AB686029C2C3D95, 0xD0822D69097C839D, 0x9BEB1305F3A45031, 0x3C591B92644F19, 
-0xD08DEF95D83AF945, 0xFAACE1C25CC7B639, 0x4E22BA05B0C56402, 0x80438C2D1ADB1DCA, 
-0x32736BAF139925CC, 0xA05953BDE17AC7D0, 0x2C7886022781C53A, 0x1E980003697401, 
-0x8AA75B8AF366CACF, 0x697FD4B42FAB35C6, 0x79B863A64442BE97, 0x98DC59260EF140, 
-0x279E7F7C75C56BC0, 0x788F8A2F4E4E6C4, 0x5C255C547910AA07, 0x1CEC2F1C77EEDE, 
-0xC9FB67FAE09BC2EA, 0x7B7F69872444CC42, 0x7B7671187D429550, 0x50AA3B0AD237D0C1, 
-0x680493649C68A37, 0x8E8D2D66F06002ED, 0xCFCEE645342561EE, 0x87FE99987276B, 
-0xB3C38E829AA30DA7, 0xA821585AA64765FD, 0x9097EBAD84E93A91, 0xAEAD74110226EB9D, 
-0x5E0856E235365EB9, 0x7916D386B9B8DC8F, 0x94D2F4D7605511C9, 0xE82D4202A8232, 
-0x78E4F42D7C998652, 0x1AFE7DDA7E63887B, 0xCC6F874D270AFCA2, 0x7E867922EB89D1C3, 
-0x578EF852BC46863D, 0xD69C8A657DB1041F, 0xD36298D7754D7AF9, 0x23E0D106E66351, 
-0x3400890B707DB6A2, 0x675466F19E143C05, 0xF9585EC6EC8FDBC3, 0x575935DE82D3C8C5, 
-0x972BE647E379DDDA, 0x64AEB162DFDA48FD, 0x4051CF32E8CC318B, 0x1E5ACB016773B2, 
-0x3131B99BB4D82335, 0x81AD9CF1159F588E, 0x425A12AB4E9E4054, 0x19595423977E839A, 
-0x2BCBAB65A84E12BF, 0x9504B9001A0980B4, 0xA737EF656BBFEBA5, 0xFEBF689E578D2, 
-0x781BEED8DD8FCD17, 0xDC987A7F012F8FF2, 0x903B616C4224E379, 0x9081233DB3AE36BB, 
-0xC8C5E5AA96664044, 0x187F522A47EB6F30, 0x450DC8A4FF2C384F, 0x2F27E7B693786, 
-0xF82443FC5DAA34D0, 0x8006522F8F87B9AE, 0x9ACAE9BC422A5089, 0xED96194CA1FD8D3, 
-0xC44E4269B401C98F, 0x2543F8CA4FCC797A, 0x8291E4B539EE8CAA, 0x7C2373B81446B, 
-0xA2E2285D09E86622, 0xBB6AE5FFA12892D0, 0x1517EFD2B3A6A78F, 0xCC24F855EFCC0EEA, 
-0xD028898A9B4CCE7B, 0x8E3CF34D1FCDA754, 0x55294C3015B575DF, 0x3B8F64EB97CE0, 
-0x739B1E07A11DD0F, 0xE11BD904D24DE0B4, 0xAB7A3E5731F0E38D, 0xA791CEB24A6076BC, 
-0x399C4A0419866CBF, 0xCF66CD90745BA6C, 0xDB4F46D5E8551521, 0x3675E76AFCFE71, 
-0x49549152FE4ED339, 0x1D6BEDC745E7A624, 0xA701756E004A1329, 0x561E4E7760E413D, 
-0x619EC964BC5A50B, 0x703A358CB327B53B, 0x4A547BDE2DFBCE40, 0x251A64647D13AE, 
-0xB7FEE3BBB2A0544, 0xB870E3B050924DB3, 0xDF433F271B1903BC, 0xFA9B24AE31643E51, 
-0x77757D84690048F8, 0x9CDCC5AE6A35B2BC, 0xA3D1A2949EC15411, 0x267725A3ECA4AF, 
-0x968E0A4DC54D4050, 0xCC885FF3C2F6A587, 0x49F24D27A5771C36, 0x9E7EE69D296733C3, 
-0x6468B4A569A9B81, 0xE3301E56BB8722D4, 0xA0312FFCCBDA664E, 0x13E435A654CBD8, 
-0x5DE1FBCC0A15FD7, 0x1DE452A5DBAFA566, 0x86AC616A104595B4, 0x7027593A4FA37C14, 
-0xD0A8FE92B84852BC, 0xC568BFF0C3B1CBA7, 0x842C5ACA7A399655, 0x2A710BA8A444CF, 
-0x4852E15514A9C00A, 0x515DB50836F071DF, 0x68C02215B14B231C, 0x4BB06490F75C8706, 
-0xEBFAEDC7FAE67FC3, 0xF0AF79AF73E0572D, 0x9D3E8A475B5609A6, 0xF15FE371C4390, 
-0x6E30290AE04E8652, 0x94BA766F776D0CB2, 0x13BF73097120484F, 0x52AB1D2677999B63, 
-0xB5027554CA7F482B, 0x53DFE89351E4E546, 0xE54D586A9DB9F0C2, 0x2AE4143EA4A4BC, 
-0x4FD51C4FBBB4DAD6, 0xD37CDDBD79E68012, 0xBA7AF5E3E1F845EF, 0x8170A713C314D72D, 
-0xD2BDDD74CA84B944, 0xCB9AC1475C217DA6, 0x4BFEC2BAEA651EA4, 0xFA4623C8010B, 
-0x8E1215A017D7BEAC, 0x92A215F96AB2C746, 0xE97811D47B3C362, 0x340B3218D5FC5622, 
-0x4A9FEAFB505BE7E0, 0x70625F33C84070CE, 0xAF8E76A7F1A33174, 0x3122A030C9D1B, 
-0xA2886F7A1F42FE25, 0xF4619F625CB64971, 0x80F904F606ADB6D9, 0x34905282AFA80394, 
-0x94FED0F02FB22218, 0x839A94AA73A54D5C, 0x7052F42A446BF790, 0x3C3E7A298A52F3, 
-0x843728D8029F7D94, 0x348D7DF0328B06DC, 0x273B63A6029B4855, 0x8CE5650BE840071A, 
-0xC861FBC7626A6D7C, 0x649BFB447C33C31E, 0x86696404B80CFBE6, 0x20776195C730C1, 
-0xBC4A57E0FEC8CBFC, 0xE4E848111D796D48, 0x18BB97120D32E8B8, 0xCE0A347B7CE415E2, 
-0x54AB4790556E80A2, 0x56F552D7B12A05FE, 0xC6C6CDEDDE81AD47, 0x10EB22504ED1F9, 
-0x1ED6FE529628D6A1, 0xB7037F24424D7366, 0xD4A0E31E81784B8, 0x26876D3AD49E20F6, 
-0x238375F09EE806E8, 0xD17F7A5C48CD38C5, 0xCB0D477A812F0CCC, 0x2762FEA32B6C3E, 
-0xF65732E1F688A9EF, 0x4FBF97977FC11FEF, 0x23819B774006D273, 0xCD9BD9AA399AA2DB, 
-0xBD6261B3506A719F, 0x51509B0AA40E9E2B, 0xED7BAEBC541B2580, 0x24C3ABA9B410EC, 
-0x9E50D975CC1384, 0xABA7E24026C6BB0D, 0x8F06E7672D60B4E, 0x28B136502B44A92A, 
-0xB395441EB77EE53D, 0x685E9EAB988586F5, 0xD5F4F9CD72A96B96, 0x13E1FAB3146B5E, 
-0xD4A9C7AAC3414C1E, 0xF33C32AFC28584A9, 0xD5DB0B2E4159F213, 0x985C309B1B253CD1, 
-0xAC963F1ABC535382, 0x1778E35FCE7C299F, 0x4A58BE5B83FF8D33, 0x9F81732F036AD, 
-0x82A2A54B52E86936, 0xCAE5DCF53F4FE308, 0xAC324A86D0DCE89B, 0xCE5704632EA74756, 
-0x83E9DCE82ADC0D57, 0xF67EE3F51B074851, 0xF2A0C62395F0AC94, 0x3959DE7F45B37E, 
-0xD11C71901B28A1A1, 0x879D34464D090946, 0x4F1650C02AD31EE7, 0xAB38B7B21688DCF, 
-0xC2ADD548E323879E, 0x129A19E6A3E4DF32, 0x215D345FDEDC8294, 0x1C0004970A195C, 
-0xC69C4DF641FC332C, 0x10692C907CF0A1C9, 0x868B26CAA9304E18, 0xCBB7F942EB223634, 
-0x1A3480ADA4A34005, 0x8099635F991953B9, 0xC3B8AFFF724D34B1, 0xE273C7B71B70E, 
-0xBA7FEB5BD53AB89, 0x778E7337D21E0751, 0x740D95C7E799D887, 0xC45DE58181FC5EF7, 
-0x913AC2E7F20056AB, 0xF5A1BD53F7A21326, 0x6BC355175CFA3656, 0x237E68C7E12533, 
-0x90DD36F62B045F59, 0xD2245DBEE50C7A0F, 0x87DADC88A68F7082, 0xD2AD9EC540D52727, 
-0x9DF854A5039ABBA5, 0x92256FFCDAD86C52, 0x69388D313268CF86, 0x1A06679EE2BDE9, 
-0xAFA5BB252B3AE22, 0x18C5FC7EBC26BDD9, 0x1B2A3470F4301751, 0xCAD93A42FEA78C7F, 
-0x1F6F9DEA78A15329, 0xCE288AB24E6F520E, 0x18EC936048C903D8, 0x24DF0C1B80A297, 
-0xCB4ECFCE6D2303DE, 0xEEED790A2F2CD0D3, 0x9ACD1DF19E89985C, 0x34EB9F34B5A63830, 
-0x9A737273CB585379, 0xD333152F6D58C716, 0xDE57F02995834EE2, 0x13DE4BDE6246EA, 
-0xDE0C1283208A1B93, 0xB880F86A5514D9E8, 0xE3D8B010B3AB7350, 0x555A60A7BEBF3D65, 
-0x837255E97A60EF8B, 0x7797CB04AAB974B5, 0x960371C2B645F16E, 0x39C31CB54BFA64, 
-0x1BB8934414437596, 0x2A5FE94996BB2A20, 0xC5BB960C02A68E35, 0x3E7A63FC6DC792E3, 
-0x2D6CB1DC8FAFDDC0, 0xAEB3405072F45CDA, 0x774F780B9AC0204, 0x9B70E10B4AA8E, 
-0x9F895D2D8C14396D, 0xB1E41D5F0643D386, 0xA39EF56108001119, 0xFEE092E7A2F15C6, 
-0xC9D828DEA464D964, 0xA48F9AFD56D7C78, 0xF41232AFEE518FB7, 0x2FA4C1D13ED278, 
-0x3A482D84076D497B, 0x87913A2950856E5A, 0xCA6491EF13F40293, 0x10DFFF16F54E8CB5, 
-0x4ACCDA4658546FE5, 0xB35A6FCCC34BB303, 0x25E6BE3578124F80, 0x27BB2AA8DF0F3B, 
-0xF07B7EEE822794CA, 0x16D09FD67DD691DB, 0x4C766A628150B7C4, 0x74D3B79EBEFBCF02, 
-0x359334600E2C747B, 0x71445901D5277316, 0x438AA81D7E8C67F1, 0xB0E647176E88F, 
-0xBB8CFF498E827CD5, 0x312FDE4A9E4BA6D6, 0xFF3EF17B996D1862, 0x9C23B90B9DC78DC2, 
-0x14A3965C82CECD7, 0x5EC34F79F03AA621, 0x54C54923C3151A41, 0x723F1BAB2A0FD, 
-0x168C4C88115E45D4, 0x9C3A61BF34CE31A8, 0xD4A10C959F5A1E21, 0x87070D7BE7A9636F, 
-0x36F9177FF030D4EF, 0xB859CB20FA2BBD5C, 0x9BA2D99CE04CFE94, 0x288B371F9BB831, 
-0xDAD0C2BDFA52BB56, 0x5301D60A8CABD921, 0xA4646AF89434E79C, 0xAF791DB1F1F853AD, 
-0xBD7B3F343CAECC6B, 0x7782066403C1CD2, 0xC1CD94E29C13C8FD, 0x1116E57E97931, 
-0xDC1307A6A18A3E24, 0x77ADE03B708A4A0F, 0x1AE297987C3CDAC7, 0x33201081F439D9A1, 
-0xB76F341DAD5826A, 0x8B32A8829BA05A65, 0x827600F6161076FE, 0x392BFFDEE85EE8, 
-0xBBA87FA386488D69, 0x202C59F62D89887B, 0xCC7F140D73EE04E3, 0x6944A7800BE20C53, 
-0xB3AB878CFF045831, 0x4A4333CE87E67679, 0xC8BC02CE12D3DDC5, 0xC092C271F674B, 
-0x38C2552C60924EE1, 0x3C2E455976F417B1, 0x9DFECD3BD6918896, 0xC45E88668C593E33, 
-0xBA8C43C787E5307F, 0x661E951F19BB558C, 0x7C1A625F41F18C26, 0xD0FB1D71F7483, 
-0xABEB9A8F4A40FAF7, 0xF5A5A0C7FE1E0010, 0xF759A6C160BFB012, 0x256112857F3885B, 
-0x22CE674C5C968947, 0xBBB8ED8475DF701E, 0x3F57E125B7957783, 0x117A5346825E93, 
-0xB303664E8331A19C, 0x9928A6A276E3EA46, 0xE0E60BE2EABFD38B, 0x8F3DA00C970584C9, 
-0x3FD101DD5C6B6CDF, 0xDF3904228B6F0FD7, 0x283A8A2536888AF3, 0x250EFC0898DFA8, 
-0x2CAA33276472A126, 0x7D4B6A7A3D881BE5, 0x63919B840464C310, 0x2080363C93694890, 
-0x2CF45A781F55513E, 0xA95C48271360FA9, 0x3A36DD2AA3492C8B, 0x2D491CDBADA6E5, 
-0xA5FFE180704CC894, 0xF464C038FC1695A8, 0x9A94A47C6615F8B6, 0xAF69B45923E25C83, 
-0xF829FF55734469EE, 0x6789EF8BCB25B7BF, 0x6550D19286938F3D, 0x137FE71CA23489, 
-0x22C0F73168BDBCAD, 0x69681A22C84CA72, 0x8C938B2555656C00, 0xB6AC217ECF75178A, 
-0x2E9935AAB218F561, 0x21DA39985D3E23A3, 0x7E3DF8F9E200D7DB, 0x123B5A8C12DA2A, 
-0x1555482BCDC13DEF, 0x37B9690E7D405D47, 0xCDD9C2C02559EA20, 0x418B1703B82A01C7, 
-0x5BC2FA1DEB5511D9, 0xE6D4FE59BA73C688, 0xA3E12D7457D26CAF, 0x30B7CFFE411326, 
-0x4AD803219AEA015, 0x3B127AED74E9E6E2, 0xA1B372DC9EA15C09, 0x66104E6C7DF26B58, 
-0xB0CE79CEAA320AF2, 0x96AF9F8DD1AF658A, 0x8137A8794E772FE0, 0x16F36E5CC82192, 
-0xA248F9A712FC0334, 0xFABC190A39DB8D58, 0x6A02F0A7A4A35818, 0x473967E98A1ADC3A, 
-0x430DDB76CDEB9D9B, 0x4F2EE227219D8B73, 0x34F82CBF436DA16A, 0x35ABF270F9B859, 
-0xF3C5BE4290AD367, 0xED0365BD00803009, 0x78560A61C5EFCAED, 0x492093FE7B818F3E, 
-0x70BDBE48D8841644, 0x96635901DE8FD7B0, 0x1A89B1784B12AA52, 0x25109649384628, 
-0x2011DA342AABE4F5, 0x382CDE111D8F56BD, 0x2D9018C8ED7CDF3A, 0x842BD9A95C4119E6, 
-0xBABEBBA8BDA512FC, 0x63764C8C023EE439, 0x7B2CD5A52963D9B8, 0x5675588287901, 
-0x364705CAC2B9E31F, 0x963501D713DF38AD, 0xBA575E9986DD6C80, 0xFAA3E9DA370E4E12, 
-0xE1EF838042543A94, 0xE20081234EF456FD, 0x14DAEAAF6EFD7D11, 0x1EC2CE718A3EC2, 
-0xD4771D5ECC381EA9, 0x10A20021D425B7ED, 0xE60FBB275A22C6CA, 0x6732C6FD0836D17, 
-0x79B3EE79BAC2E4, 0x6783645AD86DF950, 0xA1EBED41E9A54BE1, 0x2D1771D5777358, 
-0xD5EEA9841C7BA200, 0x8FAF2AC75417114E, 0xFBA2266E67798488, 0x8ED17ACBCF483CA5, 
-0xB9034E006419C405, 0x20CCDD4E5AF18868, 0x5A79BFC89466B013, 0x273D781F6DC679, 
-0xA58C50E6B57D8223, 0x1DC2B7FC09D1AC0F, 0x5F0A1690F731EAB1, 0x73A3024D44F7E4C6, 
-0xAD7ADB9CA9424E51, 0x9C81A715ECDBA06B, 0x5D17407821590129, 0x8F100FBEC8A6, 
-0x66528367A9F40798, 0xEC9E7778ED29211C, 0x690D671E36B643F0, 0x2A9F229689450856, 
-0xA2B92585F1D8862F, 0xC029B63C0755CC6F, 0x6DD0BE9D437BEE07, 0x115CB39157EA4F, 
-0xED374F0AFC9ABD7F, 0xD078941413D0F4EF, 0xBDC4CD48B58A34A6, 0x2B35D43376FF9510, 
-0x72C7DCD49E00991F, 0x1479364B573E5AC, 0x3C061DF3ADBE3130, 0x2AA23122F56111, 
-0x99B2AE22BBCC28DA, 0xBFEC81FFADC6EC30, 0xE1401303CDF33BC0, 0xE650107832288D09, 
-0x2044562384E2F0BF, 0xF02F2F05C83C075B, 0xC68724995FFD394, 0xA9E9D2B8C94BE, 
-0xDB33B34A10888926, 0xF2D0DA74613B1D1C, 0xEF68956ECD83A03E, 0x84518FA4351C56BB, 
-0x328AAF3AB61BA04A, 0x57FC7A343D5B74AF, 0xA1C871D002F1BEEA, 0x348341CCA32194, 
-0x7F5EC5B888B9F865, 0x9E5C9E22D66CC5DE, 0x6525CE2F727A1015, 0xDB8325B20C320F36, 
-0xF89EF08798378634, 0x39E1D4A39E714E13, 0x67357AF27E9F3CD6, 0x20348CFD0EFE4B, 
-0x7C9241B464165481, 0x15F85190C4F7D5E6, 0x78B9C23B339FF7B6, 0x39614CCE4CE2CE83, 
-0xBFACB512355C8F8A, 0x2F49FE11BA9C6809, 0x7CDFD252F09C197C, 0x120E9EB6761AFC, 
-0xBA5F153D0AB59BFF, 0x9072CAD46A1E59BF, 0x775D5DB04F989048, 0x98DE6DAF455DD684, 
-0xFC80EDF40678F837, 0xC0472DBA504A75EB, 0xD0C9588234AF4436, 0x369CCAFDA69382, 
-0x139F6A61F2E4A98B, 0xE332FE2085106157, 0xBC57CAEE869F816D, 0x6DEECC5DBB591660, 
-0x2BD39864D3850D4, 0xA7F9C7F7B1320CE0, 0xEE1A72C0A1A8CC8B, 0x2C9B648E485241, 
-0x85F50F2868AF152A, 0x8BBCC9945859D4FB, 0xF60A234877AE9F3B, 0x523530E9567B73F5, 
-0x8C9A49760628D5F5, 0xC93E1D8AF2DD7BEE, 0x819178A8E7CEBDC2, 0xB4A097CA258E, 
-0x3612D264B4725676, 0x5D7BAC06AE94B7C0, 0x10AABA2A5F15FD79, 0xA7BD19CBA25A6394, 
-0x129864CCD972F4AC, 0xFE3EB380055473D8, 0xACC358640642C937, 0xADE6C3102BBDE, 
-0x7356C641AB543BC8, 0xFA35C706BD5B9D30, 0x5BFB0B59C014402D, 0x395188374158EC5B, 
-0x743A219DFD2E63A4, 0x339759CDE854A98, 0x9AB65D7F129B8934, 0x177622BDF2DAF, 
-0xEF68F3A169AF128E, 0xCB6CAA002759CFD8, 0xDD7B7EA14732B81E, 0xD5A5CD2735175146, 
-0x59FC41486CFD5743, 0xBA0706C64FD4C9D7, 0x352770138259D369, 0xCC3EEB7F475AA, 
-0x633B1A93CC9A599E, 0xA0D8E8676E93D37A, 0x442B24D022EF33AF, 0xC7929F968F907A7C, 
-0x7A0E256C43F4148A, 0xADF9C85830E93578, 0x7FD8CCB35B764628, 0x1A15602F5FFB28, 
-0x19A4FA8B85928919, 0x4B27C6942EB897BF, 0xBDAB4D549F06CE93, 0x6007D16CA5610221, 
-0x8A59DE2796C40195, 0x3762F014B088C4B4, 0x29997AAB63EBB7B8, 0xB4F034CDC3BD, 
-0x30552236DB32D68D, 0xFEC3C7B9ECD181FC, 0x4E3590DF10CA8896, 0x5C9CAB3B380B57D3, 
-0x6B20E4ACC1A218, 0xB580D9E8D4FFABDF, 0x9C4743BD4086AF5F, 0xFD322D9F3FD84, 
-0xAEE7ACF01B3EDCD3, 0xDCCED786BA3AA8F7, 0x5F5D3823DC8585D2, 0x1D416CA9A3ABDF01, 
-0xEA91AB88345237F0, 0x852E19ABC77B57A9, 0xF32CE825D352BA43, 0x20891B2ECB9492, 
-0xFC621D9694F86FF8, 0xB1BA185A3ABCA920, 0x2184C4BE6BC533C1, 0x6E695597FB6F2927, 
-0x77B2AAF092E92F14, 0xAFF1E40F88007EA0, 0x3081ADEAB631F670, 0xC1EFF74E15585, 
-0x48E51512BF3D46BA, 0x24903B794C62D4F7, 0x8D86469E68D9DF0B, 0x2EC50BDD1338704D, 
-0xE5572ABDAE3B8467, 0x884398292EC3F8F9, 0x7D84E7C31F8DC84E, 0x19A46DC94F19F3, 
-0xE656202F676F6C40, 0xCD8FC839052033A4, 0xAB143FB3256F4C51, 0x5A97FFCE66B1C257, 
-0x2BF35CF67FAF9F07, 0x17A8AE8B521B02F3, 0x8DBFC8929D2EEE05, 0x20629FF9623D0E, 
-0x93BD99E046E9911B, 0x15B9DE0502C6E79B, 0xEB42504C86C8303C, 0x1B956670A4C32F65, 
-0x1473DBC179311247, 0xD60AFEED3B65B487, 0xD5FC98D115B8DD15, 0x3773E18AB36630, 
-0xEB824734D2473888, 0x8146C5DA08388822, 0x8DFBC6CDE26325F4, 0xACED0DCE8ADEB80B, 
-0x5F8469180FA11791, 0x3E002FED2A4D7ADD, 0xD018400BF0022613, 0x5B63BCFD85195, 
-0xF9652105CACB8B73, 0xCA5B4F88BB963C32, 0x3FC224B1E5F5ADEA, 0x30E94D86F8359FC9, 
-0xCCAE232C6BB25801, 0x2F984EF62E4C643C, 0x9F1A9B03F550856, 0x3056D862D0FF96, 
-0xAA6FCA1A7DB3B9C1, 0x8D12C496B3D530CE, 0x909089D6DB66CE9F, 0x26979B12182E911, 
-0xD838DEA96EFB14F2, 0xC70C12A9DB5E8DEB, 0xBB4D79F4A6E1AEEA, 0x2F6E7532C0487D, 
-0x565D24EF17871BCA, 0x5547441AA7195322, 0xACA179D99F24388F, 0xF764EBCF575D78CF, 
-0x6890A45614A3A134, 0x545AF60FF4DCA38, 0x4730B86C7FC40E22, 0x25DC757FF39EDC, 
-0xBF8E2EAE49386E91, 0xB99940C92BD7882B, 0x60C7FB2173F8D4DA, 0xA764A666D970DBC8, 
-0xBFF3C598783486B7, 0x8431A95843DB6C8, 0x3CC7639BF98D01AC, 0xCA9360BFA6359, 
-0xAA6FCA1A7DB3B9C1, 0x8D12C496B3D530CE, 0x909089D6DB66CE9F, 0x26979B12182E911, 
-0xD838DEA96EFB14F2, 0xC70C12A9DB5E8DEB, 0xBB4D79F4A6E1AEEA, 0x2F6E7532C0487D
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
-0xAEC40A3D269C8FEF, 0xC901D47D0A3E4250, 0xF92DBCF459BDCB5F, 0xD1FCEC504243AC4E, 
-0x35513B7F3D8DA9E, 0x4BCF1E8DFB823BE0, 0xB644A35C2747C746, 0x1387681059CD8F, 
-0x6A2A72A338B50096, 0x8060F6343072AE2B, 0xA41CAE35AE87535E, 0xD1B133E259ECD08F, 
-0x51410B1347F9CF32, 0x2AFC37844B4AB202, 0xBC46C5B8E68E0B83, 0x11FB79CDC2C0B8, 
-0x4F5496068AC8BABB, 0x2650DB615718D577, 0xD0B19FC68436E291, 0x243E6839C95A5B7A, 
-0x300115D56D3DF938, 0x5D16DD7EEE5A01ED, 0x2EE0160F48638C9E, 0xC5AC73FE3B483, 
-0xFBD0D3459E1F91EE, 0x81858CC7C1478D5E, 0xF96E35FDC26A7257, 0x925AED6C82566ACD, 
-0xFA2BA728C44C8FAA, 0xE6F6402117FCA3C5, 0x58A8F674A28C12BE, 0x2BFFC6D4ED3CAA
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1). 
-
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0xE15E54C7E1BF6AE1, 0xBBE023A52C58B9BD, 0x4773C7868E2AECDF, 0xD0F31194C4F0F0A6, 
-0x9B6996444464D978, 0x65E876D83C354F, 0xDA6CBD8E40EF5ACF, 0x15CCA1A19B1051, 
-0xEFDF6E4E6C0536E5, 0x649BB3639B1EAC0C, 0xC18DB1639A6E0FA3, 0x6162920D5DF367D2, 
-0xA709862B237844E9, 0xC50C4249DB3BD4E8, 0xE5D92B58A4AEA3BD, 0x29697FDB257476, 
-0x3B872D3AD7E0BEDA, 0xAAAC956261023780, 0x70190ADB81D6FABC, 0x4E1CE92ECBA70616, 
-0xF500301D56BCEAC2, 0x87051A2B36A943E6, 0xD63B6735CBC97B42, 0x1ACE03FE60013E, 
-0x66AF64372C624662, 0xF696F2290E102519, 0x41F369211B7B7552, 0x9A322E5A79C55355, 
-0xC7D1D9FA4DE54101, 0x717587C03144A77F, 0xB32C380222BB1B21, 0x302D39CD6ED1E9, 
-0xAEBB7B2EA3FCEECB, 0x53D3CA97FC288CE1, 0x7A398038449AA9B6, 0x7CC60D7C50D8AE90, 
-0x36973C257530E81E, 0xF1C27F812B8AD4A4, 0x1430510471B0B075, 0xFB3305F079FA7, 
-0x6DAA239526566852, 0xB2995FE00B68E765, 0x8593F0492DE80A85, 0xA5CA6D4055578C57, 
-0x532E561A76D8257A, 0x28EBED3231F7F11E, 0x62D6F52397EF8068, 0x28E7267745552, 
-0x468BBC2D95772E19, 0xB2E1C62CA88A7120, 0xEB10936312056DA3, 0x806C9EF9B1561726, 
-0xE72249A802556594, 0x80ED06392AA902CB, 0x4CE543889ED8364E, 0x27F87C1458480, 
-0x69E441ECF8772463, 0x9DF9DA550F8E6201, 0xA53686138BB14EFD, 0xB84A64E46493ACC7, 
-0xCFCBB2003A302D56, 0x5C02C10EC256DE4A, 0xDC60F48476A2E8D4, 0x395CACD38AE3B5, 
-0xB87F059172C6ED76, 0x2932FDFCCE69E4D0, 0xB416F82BD24B0FA, 0xB6DCCC6B4E8A9CFC, 
-0x93701AF5335830AC, 0x29F75A15087323B7, 0xFF003D2F00D8D34E, 0x3A26CEE191368C, 
-0xF3EF2C0AFBA895B8, 0x6D45204E9C4D19B9, 0x28DBE2644D7528DA, 0x38E371EE6E15EFDD, 
-0x127CECE338AB45A, 0x13D4C7E1893B91F0, 0xB962D4CCBAA4FAB0, 0x16D176542EDE88, 
-0x42203947D6C06948, 0x4BB905BF6EBB203F, 0x2B7BE18BA628ACBE, 0x72B234EEA79086C7, 
-0x5160DCDBC5D7E8BF, 0x2FD811B105ED10C8, 0xF9DA215B8DFAC028, 0xF625997335100, 
-0xFF17C2F57ABB9030, 0x54DE338756C482A2, 0xFA364465D449501F, 0x9175FB41E0496DBE, 
-0x166DF21B0335172A, 0x19187B7174B5BF20, 0xB0741C7C46FBABB1, 0x25BA7896023A07, 
-0xFEFFC7D2AC702A6E, 0x59CE9CBAD2F27073, 0x113DA67315FC5E2E, 0xD76BF86E8CA8DB50, 
-0xC9EB985911FC4FE, 0x49069554D8B3C6DC, 0x41A1C5BE8B94E11C, 0x257E4F254EDD01, 
-0xED61E2ED61F58EFC, 0x41C3760267FBC88F, 0x85CAE320285D4075, 0xC6B780661903771B, 
-0x94D0C0810B0F72EA, 0x3DF026AAB87F4582, 0x93F673FA15A9D880, 0xACC3C203E7351, 
-0xB42AEAC8F7D6E27B, 0xBD6409E19C8019A6, 0xAD50331C834B566D, 0xDAD3689BC01AB78, 
-0x32C457DACF80DFF1, 0x224F6C8340B17255, 0x8841166DBB02149E, 0x3F31ECF46340C0, 
-0xF18441D4124FDE87, 0x3350ED0247BC0F93, 0x30C8FBAFA5DE4AE1, 0x45753E34C9F8CAF7, 
-0x63514595E095D04E, 0xC07ADE75971DE0C, 0x7CAF53BC83C4FD5E, 0x1B1752B7623A1E, 
-0x54FF46192257CED6, 0x401B2CB2E4EA9C35, 0xFB92995B7BA05295, 0x333B487DC95D7D3, 
-0x47F05B6B620CA279, 0xBD79CB7931683638, 0x65C0E17D2DDE2BF2, 0x204550CCA8F1A9, 
-0xF0939C1464755345, 0x719FAB828BD4584F, 0x202ED13B395D9A6E, 0x47A80BD43374AD35, 
-0x4101CC3E3FD46C8E, 0xE1B571BB2650968D, 0xDEB1D79F1370DF78, 0xE5919C57A925D, 
-0x541BEB354356A59E, 0xEB6F34C2C221E394, 0x59819227414959E0, 0x48ED4FC8A982379, 
-0x4F70CBED553F2465, 0x2E9C67D2CEFFC9F0, 0x9320E7440CECEBE3, 0x169264BC38A393, 
-0xDDCDE127F7786D1B, 0xB1547D524EE3F5B4, 0xB7C90DE3E6C5A4CF, 0xD120ACB3A8D1E78B, 
-0x73109B5A0C8C81B6, 0x43D3A78713601B46, 0x6EA91624375C33D1, 0x2275A20DD0F9B6, 
-0x10DC9C67F752F6DD, 0xD374D09CDE8D0636, 0xE841BB01CBE857F9, 0x8E6E1C3FC97617E8, 
-0x663386301E371F4, 0x620AC2ECBCD0F210, 0xB9FC4B559E6D1679, 0x1A84D56A203C53, 
-0xC3140AB54B0EA626, 0x350A5021A22B7ED3, 0x32FDC484C8A39896, 0x5906F7BA27D83AC, 
-0xF48EB70C4659CA80, 0xFE18D249DDF54EEA, 0xFF3932E4A2C9AB91, 0xB2BDCE81EAD63, 
-0x7723EBFA12852698, 0x35317D2737EDD95F, 0x93118E00AFDAA29, 0xBB8E773126124A98, 
-0xBFCF8A04A71671EE, 0x2583A77FFBC73C7D, 0xC65A1506078DD6BF, 0x3F591B9B315F78, 
-0x8D96EC7B17C33B63, 0x1629EF29EC637531, 0xD29F473876086E9E, 0x78AC820EA27CA6DA, 
-0x65242C0BA614DFD9, 0x9026FE6F40536C3F, 0xEDC685E952B61740, 0x104B43844D672E, 
-0xD90E6480A3D0338C, 0xF27B240BC2B47195, 0xE7AB41432018AEF, 0x2759024B28277E7, 
-0x98839685CA190A0A, 0xE01E8C369429D5D3, 0x199E73C5E0764E75, 0xAE85D34F87FC5, 
-0x8180BAECAD2D95ED, 0x757F3E2E72B7223D, 0x6A524E49C732A555, 0x7F09CFE7F3ED8E79, 
-0xE299410DDE3848AE, 0xDBB6C0B3E9DC1A15, 0x4E5A9E4381CDF2FA, 0xFA6C13B498AC6, 
-0xB94BC01EFFC7241, 0x5934EB3D0742D36D, 0xAB906E08DD6C95D8, 0x7F754AE680FC9348, 
-0x9B805513A2C4EB18, 0xFE6E684DB6BE15C6, 0x3D461BAECB444065, 0x3E4589F0CF6657, 
-0xFE9773AE0CCAB40C, 0x8B8D4183DAC892D1, 0x303ED6A006012B62, 0x543FDF8863221EA2, 
-0x685DE9BE01CB15E7, 0x3BE65844FA2EC03C, 0x5D0B380B54A6FBC6, 0x303761F84C8DFF, 
-0xEB673F469BBEDC35, 0x7D0EC3CEDBCFFF3F, 0x9EC6E3E2F93A8327, 0xF3C345078E0D035D, 
-0xAB3010C3EB051645, 0x78F1FA0B868103C5, 0xCF970083593EF175, 0x2837E8F43E261F, 
-0x6C91AEFF22E99502, 0x2BBF067C8577B4E7, 0x813886523F7A19DE, 0x8AD6CE1F64DB3007, 
-0x447F06C6248A1604, 0xD15AAAE2ED3A8A6A, 0x284188CBDBAC1FD9, 0x10F5BF9DBDD49A, 
-0x2DE4B9D7281CF59, 0x86FE4C992432A428, 0x1AB88AE7A8D8746B, 0x1A99FC14E55D4E4F, 
-0x821D34ED734EDAE9, 0x3E82D47EAD64052D, 0x152B70F4A4C31142, 0x1E3B40AADE9355, 
-0xDEB33E75EBA16598, 0x870E35EE440FBAE7, 0xCC95E3809C694B70, 0xD15B0620C34851C, 
-0x176D52306FB9DF6F, 0xD7544F9CC04DB893, 0xE5C54205DAC38489, 0x39AEA9039DBDF, 
-0x5E632A108F996BFA, 0x92FBADF8465B9DB2, 0x60A4C123D378619, 0x2B659207E80244CF, 
-0xCA891F118A2C6DAC, 0x17FE4F9123B9EB3E, 0xC4A161771F33CF44, 0x33EF5A1AE1046F, 
-0xC85AAF1294CDA307, 0x65D11275AC77D8B, 0x57635D778C0C73A5, 0xD7D10390AF4009D2, 
-0x7D582C16FDF86FBE, 0xDFDB7E204D69B52A, 0x7F9C59F6F32EF670, 0x1B9CD228B30FD9, 
-0x849CAEE5B64618A1, 0xADA0CC1A2AFE278C, 0x271E9E0BC8C529A3, 0x56B4B88631584390, 
-0xC7B8A2E97FD23384, 0x8A867C6CD1CDF122, 0xA1E040315001939E, 0x1115280F06D680, 
-0x889F9CFF478EA3DD, 0xF3F7DB1DD1560A57, 0xF5385C325AD9CAE6, 0x7B5A9E3A75AC080F, 
-0x13A9E90AD8AED44E, 0xFED2A810E4107104, 0xE8D41A737013F7D4, 0x20E4C39F6CC64, 
-0xE9904305CC595E34, 0x507F09FC05DF37EC, 0x97A2F0F6FCFE8C65, 0x48B1DEC2DF99EF7F, 
-0x324DB7D20FEFF200, 0x251B93E5BE3289D1, 0x1E4BCB0F76D46990, 0x6EDA6544800B, 
-0x87ABE04F21799F76, 0x586EFEF9668222B0, 0x24775AE96B7037A4, 0xC258BE372CCE4A38, 
-0xD9C3095AE569CA30, 0xE30215E52505725, 0x4BA4B200836908EE, 0x2F34302EF50069, 
-0x310D621E763EA8E4, 0xC92C91BE090E8C8, 0xEC8DD22CAE76FB5, 0x488DD1B3BD41D333, 
-0x575497A1A831A87B, 0x50EC8D089E052F08, 0x68785FE21F65CE62, 0x1262611643A70E, 
-0xD67EAE4E3AB857A7, 0x91639AF3C8C29F48, 0x6BCDAA1A21766E22, 0x92ACB50A9975B0F, 
-0x315D02C1FEF39292, 0x20339A54ABA9E617, 0x260B0731D09F6ACB, 0x37BE90DC4F7F3F, 
-0x8F6C0F39DA552D29, 0xC4E0086C6F8C80AF, 0x1FF987B1B86CE823, 0x6C5C71902AF53C2D, 
-0x7CB079F196C16E60, 0x219A5151D6FFB82E, 0x28D64BC13CB33BD2, 0x3452B8CEA83BB9, 
-0xD6FF821611B5FD65, 0x144CE60B9276A018, 0xD47D0E63C446EDB0, 0x4223B159E842AD2E, 
-0x9CE454751716C62D, 0x9DCF891A01AAC92F, 0x6724E360983BD4AB, 0x3B37F451E0D6E9, 
-0xFACD8B86FA8B137E, 0xECAC0BE18758CAB9, 0xBA2AC92C2572D425, 0x456822CEB3283C44, 
-0x7A878245CFE53484, 0x2D62B5F87C4899C0, 0xA6E98590D1272A38, 0x3A52454D4249AD, 
-0xDBC848601A0791F1, 0xCEB0065C762FEF8E, 0xF2451336AC6799FC, 0xF8FCB990E31D7492, 
-0x13B3CB6FCEA44880, 0xE02B631B7456106D, 0x62B639F0060849FA, 0x9ADC921562F53, 
-0xBFBBC4DF6675B9F2, 0xD9379144D814054C, 0x94CBCA854735579E, 0x236F9627EC96ABB3, 
-0x4818C7FF99776B7, 0x3993C9E101455D94, 0x89C857AB0567527B, 0x3A5036D0CDD8F0, 
-0xA33E79AE1656CEE3, 0x7F8F1B3434BC4DDD, 0x6A02BE414DDFA33E, 0x714356967D6097E2, 
-0x23A1382ED992137B, 0x4F40C1B5A4585691, 0x33CAF0976FBF0DF, 0x133F1C70B83FEB, 
-0x3E91788733CC5B43, 0x165C46263733442D, 0xAD299E1F93206265, 0x319F365A617E23C3, 
-0x818B6BD9ECAE4A85, 0xD2D5D5F4E64E703A, 0x84180A49DB9B52B2, 0x28EF11107B4ADC, 
-0x1816EA6F7DD5D905, 0xBFFD911E5786321B, 0x187586B385F2734, 0xB7CA2C270951767A, 
-0x87973C7AC63BF3AD, 0x4203CEC917374C1, 0xC14FC8B581BBCEFC, 0x359273D1E2F4FF, 
-0x4152CB2B3B9035BF, 0x131FDF048B615D0A, 0x8F7AD400B0CFF723, 0x9D3A1BD3A72238C8, 
-0xC6DC85208FEEA1F3, 0xD560291C734A5162, 0x51407ADE12CD6851, 0x211BB2B2891D1A, 
-0x46F800DAF49F684F, 0xDDF22A0EE8CABC46, 0x84F774F985A783A0, 0xBE87DFBA08E66FA3, 
-0x7063A91201CC8CB5, 0xC48B8C7BB485A907, 0x94C5F972E099FA08, 0x18E62F73A80483, 
-0x3213BE39284D40E6, 0x1FFC79E5FF4B1A5C, 0x5A91C034AED14245, 0xDFA9B90D6B118AE3, 
-0x3C0ED8A6DE8CD1E7, 0x42FFFC53949D5C0D, 0x258B96C5A3C3822A, 0x3EC8DDFD03CED5, 
-0x83FAEBDDA5C88734, 0xA8B47010D69ED425, 0x4BCE8A14837B051, 0x7C51342145047001, 
-0xFEECD3EAD16E7AC6, 0x3EE9A6A0519E16A0, 0xE142A6CF99DD3AB1, 0x2F079B3BEC373D, 
-0x956B2E9BBF478D59, 0xBCF2D626AB3797C5, 0xC5834AE64018F932, 0xA914C8A81932F04D, 
-0x73229B82BBE1BD2, 0x9BFB1A8A157C1FAD, 0x9942526833652554, 0xFA4625CFF34C2, 
-0xF27D62BA5A1731B3, 0xBADFF72944406F4A, 0x392960619027CAB6, 0x717EE528CD74B5B3, 
-0xE6D9E3EC243BF4E1, 0x28160ADBC6D175F1, 0xE2865DDE5C797E28, 0xA7373F66DE3B3, 
-0x36D03CEBE4E1CDC4, 0xC6BEA54EA88E200D, 0xD71230B52B5D82BD, 0xD0A9774D3B37788, 
-0xB88FAEDA5571323, 0x8ED9CBC649051D0E, 0x1FED65548E8A4337, 0x1CB797673853AA, 
-0xA6751C6F876F04E, 0x108601D3F1B72BB2, 0xFEAEEB2D679A5CD0, 0x4513EBDB13698C77, 
-0x2FDFB60BF3E2E893, 0x7AA37B447FE4217, 0xC4B18B2E08F5F1CA, 0xA400A7612DDD3, 
-0x8AAAC129351CBBA2, 0xCC4390400D2FE639, 0x2F32ED48680981EF, 0x9F31DCE6BF5B4164, 
-0xB2F3AC0DBED4BE9A, 0x32D9489DA5695353, 0x27BD4101C01B9B5B, 0xAEA3F9AF37220, 
-0xDF7338596A4E2B3C, 0x1AC6DB70F8CF65FA, 0x4CD79495251056C7, 0xD40F950AB9DD3E36, 
-0x66A40EE40E80A95D, 0x679402CCE935A2CD, 0xCF70141A0DD2E2C9, 0x15B8E927919692, 
-0xB114D9AE1E573752, 0x7A2DBB1F04A84931, 0x1F989C0BF842B410, 0x32085221C82EA7FE, 
-0xDDB8F7A4B49D7201, 0xAF19F5C4C29654F8, 0x52CCF6091B39E2CD, 0x1DC3DAC528FD88, 
-0xCC7E8F4827519CE9, 0x12F67A7448C6A5F4, 0x16F8592A4DC66D29, 0xF3D782324C8911EA, 
-0xEB69742D1EF820E9, 0x44FBF37D76339341, 0x56EDE23E1D651C70, 0x3E1CDF5D587F29, 
-0xB2540DAAFCA7BB0E, 0x676CA56F50BCE9B6, 0x62E8E52B0DB623E7, 0xFCA468DCDAA7151B, 
-0xE6CD39D3079C507, 0xBFFB5DE1194FD0EF, 0xDB3D4A80CFB082AC, 0x3C232D628C1C41, 
-0x5CFB507A64F34472, 0x8772DD96709CF6F, 0x1D37987A27D119F9, 0x55D92807FAF5C8DA, 
-0x72397049759A1C66, 0x9FAFA2D6344407E1, 0xD27688D2DE227DE3, 0x59920D3E74886, 
-0x97C3A450EFDD5644, 0x1B0EDDF4316E7745, 0x1B30857182EB9E21, 0x44D9EABE59EEFC8F, 
-0x269DD1068D1AFB84, 0x36A95CA13A0F265A, 0xD7BA5164063A174E, 0x1552A5B5623792, 
-0x6AA389C51391C407, 0xD32045124398A546, 0x20B391A2904AE4F3, 0xF6F9E172E2D59396, 
-0x1C9F427015702046, 0x3C20155E8BE7F4D0, 0xBA4E0BB1D775FAEA, 0x969ED3A94D3E3, 
-0xB0B9595C63053F12, 0x8694AAAB6C883F2C, 0x486D16EB0E2993D1, 0x9B0E912DBD00B762, 
-0xE997B33C1F31A86B, 0xBD9BC01FAE072AE3, 0x52B1D3F553D2ED1A, 0x119901EBC7A2CD, 
-0x4A7032DB2FE27812, 0x2DF7D761874FE0F2, 0x5288DB5A31D512F5, 0x68419039A867117B, 
-0x8220FFD3CEC44441, 0x36600B384C3FE84A, 0xDEDD163EDEFEA511, 0x1CE3914065ECD3, 
-0xE610C902ABD9F401, 0xCB8C72A0DC3E37D7, 0xC1856C4CABD81FEE, 0x81C3230DC9BB28EF, 
-0x9719B2F553C43F87, 0x89EAD288A7FB01FA, 0xBDCE513C2533BA0F, 0x2301BA86ED7825, 
-0x762E7575A0D2A9A4, 0x9AFC4C46C35C94C1, 0x6EC43D1F6FE55353, 0x46E57EA6D4A86E22, 
-0xC51FAB60616652DC, 0x9AB82485F0A6C1BE, 0x4C823774DE388C50, 0x26E48A6A566ABF, 
-0x4B04A18CC099E246, 0x76080DC94C4FABBC, 0x1FE3AD0CC0F68E68, 0x4679281BC8AC9DCD, 
-0xF29BE43CC477DE19, 0xB478861192B3A794, 0x2256BC93F2C18675, 0xC6483918290BA, 
-0x52A5B388F2D9FD7B, 0x79FDB3D411915E17, 0x638831F88CEFC1BB, 0x5404C711889B09C7, 
-0x79306BEA8B2785BF, 0xC87D50FFA7B20E3D, 0xF4F09B6E73217D89, 0x301D4A88077E69, 
-0x495CE7EEF6651DDF, 0x4AD146F6A1DD0514, 0xA6D71DA371F4FACD, 0x5E1F030208F31137, 
-0x7F2A2BA105FF2BA9, 0x6BA81F626D458DC3, 0x64BC5AC82C3E4CC0, 0x201DAC09086D0F, 
-0xF650B396D80B657, 0x1961BA17C230CC85, 0xDEF993F730D532E5, 0x61B87BA1DC3F1633, 
-0x97F4F4D62307426C, 0x3D7A628500720BBC, 0xCF34E2AAD783AE93, 0x145B6E2C5E5D7F, 
-0x5CAC2CD9C7CBBE5, 0x2E9212384B395B8A, 0x43F4AA182DEEA632, 0x307BA3B9D4328369, 
-0x4DB6BF665713A8DE, 0x856A33D03FC29792, 0x8F3BB83B58D4E9A1, 0x123394C675DED3, 
-0x1EE7E1F53D6E7FBE, 0x68AD4DBE5DCE279C, 0xB945CA7C44367D1E, 0x17EEAE4DA317AAF, 
-0x2B69941DFCD71192, 0xAB30146C70480D6F, 0x895968AF05E92926, 0x34C92981650879, 
-0x1D1F6E2DBBBD8B7E, 0x13ECBF82BE40B24B, 0x93360FF31FC39808, 0xE7FF2E9E5FD8E043, 
-0x8F19FD421FDD889D, 0x45FBAC4DFCD83546, 0xEA2FB0EAFA297309, 0x2A6B8E24B5B3F0, 
-0x77F9241A9436EEC6, 0x69981DF53C49A79F, 0x6E63EBE9788457FB, 0xAE2B4DB2C189C5BD, 
-0x90092AD0B0C3EA6B, 0xBBC062648F35F5BC, 0x763D8691BC0CFA09, 0x2403E63718804D, 
-0x4311ABAEE62E190D, 0xD08A36C8B80479D, 0x1926D43E2F444099, 0x4B4BC4359465CCBA, 
-0xA686D1A41658F311, 0x4853A02FF6C75205, 0xAB5F53C78968B988, 0x18BB67AE65C11, 
-0x1B000BCE2F11609, 0xA570C261EC0AF32C, 0xE28F2976B5380636, 0xCC99FBDB77E4BF96, 
-0x113C5D872E18A5F7, 0x360A43B0819EB9E2, 0xD96C7DA474598FC4, 0x1626B66057B97, 
-0xB8563BD292A896C5, 0x81129A39C6A7D2A3, 0x27B814B5A97F5A23, 0x9EC5E14159228D11, 
-0xE0C4A7B1930A6E09, 0x45ECB44566149678, 0x6DE9D1BF1CABC348, 0x22AD297167C2DB, 
-0x149C8E3D0CABCD6, 0x62629728B05E89C6, 0x2076DD22DC67C44A, 0xA521DA6FC805B3FB, 
-0xEEABBBF6D6DA98D3, 0x88C357F59322F3DF, 0xF1B11EE288CB78C6, 0x23E1E062C90BAC, 
-0x5FE0C3677E102F59, 0xCB9E91B9B485E258, 0xDB520CD6B03A5918, 0xDA3B935BC402E781, 
-0xE48EF11324602F60, 0xF8D92EC2D547CDFC, 0xC6571885EBED4412, 0x37EC9537E9EBA3, 
-0x753A09FC8839D5F6, 0xA25E3F1BB529391B, 0xCBF43AE24C5D94FF, 0x1D743BF8801C1FC, 
-0xDA03A0F9074837BF, 0xB39C11E79DD3DD6B, 0xB46A9F2A73D47B9E, 0x37085E6B1C2B05, 
-0xDB585B6D51E8BB20, 0xB348CFA5B6AE6CE5, 0x6264A6A377FFECAB, 0xBBFF59A4002F02F3, 
-0x68919F4F8760F666, 0xEDB65A42C1F304B, 0x49438D7668639614, 0x17EE0B97A917F5, 
-0x81B03047FB598976, 0xA7C01AD1F0255375, 0xC44C96AA67036FF1, 0x61B87725A8961425, 
-0xA9FFFB31E306D58F, 0x56FD645EE9DBB332, 0x70421BCE60C758BC, 0x38BF93E49983FA, 
-0x2D7124EA20C07D22, 0x1E29FB38CB7B2BEE, 0x4619A7484953F93, 0x82D466BCD1D5F35A, 
-0x9DB1B24D41AC6C33, 0xAD6E4B4A6C73F352, 0x667435427F735D41, 0x343595D726E6D7, 
-0x160B35F56C89962B, 0x9909B0AB08082161, 0xAADB69721D23ABC7, 0xB8DBE63ABF7D0CD9, 
-0xF18A044227967527, 0x28FEEB07C26E8451, 0x1BE676B434142898, 0x15E13C9A9155D3, 
-0x6BD85874F92438B4, 0xF2723457DD508A44, 0x371536736E6358C3, 0x253F51728DAA9826, 
-0xEF2FA5DA0789A739, 0x2A92F5B345DF00F9, 0x6542B521D05B4A02, 0x20559BD14F7FD1, 
-0x82185850CC1359D3, 0x257861722354AE31, 0x607266F198128E37, 0xD7AC10BB0C1D73AA, 
-0xCD1C4B71A532C6D8, 0x70940D2A86DEFFA5, 0xA04E30CB4347F1CE, 0xE400435A31FB5, 
-0xCD5D020E5971E710, 0x9C22F4EC0975F5ED, 0x700CF6430CA49C4C, 0xCC9C085C7694748B, 
-0xEE74046E36FAF419, 0x859FCDA965E9CBF9, 0x817C06D6B96E8C44, 0x1CE18195B9B150, 
-0x872F220B45E1517B, 0x9BB13DBC8A8BEAF5, 0x83AA179D67FCCE69, 0x5DFD09C9D9B0163, 
-0x2E49453C9AD8A92E, 0xD35893652A6CB03B, 0x9F6F915C96F67340, 0x1CE8B942559488, 
-0x1E40B4031BA11040, 0x11C692A0FB30D0D0, 0xAE85A0AACBA17FF9, 0x9229506BC50C6667, 
-0xCF2B4EF5CC02659E, 0x85058364F87C06DE, 0x6F64EEE980BD72E, 0x1AC08BFF96C668, 
-0x98FB8AF06EDA28A8, 0x2D7E9966ACAB33C8, 0x32FEBE1800EC97AB, 0x840844EEFAEE36FE, 
-0xF1520F5DDC45AFB9, 0xD10232D7F8A28B9F, 0xC3D5B5FF528C4C35, 0x3BC214DDC8CE6E, 
-0x6E63CA49B72C5481, 0x93D6E6D8F839ABB9, 0x2459B7F8BB271481, 0xFBCAB3432E61992C, 
-0x8181E19C5AC9DB79, 0x4744B3E55A09994A, 0xED1A2CB9B94EDA25, 0xDCE875CEFB207, 
-0xE390E3D54636C3F8, 0xE32B620DF9129F74, 0xC977B814367D5700, 0x65736890571C7E15, 
-0x8B887F7009B8A4E6, 0x6923546D54BFF93A, 0x903F63CD8D1373BE, 0x3851D78145EDCB, 
-0x218AA4DC0DB9FC7D, 0x27A8C3E713BEB39A, 0xFE642B5152FBA4E6, 0x356EC40E041BBC52, 
-0x94EA15D83F606740, 0xABD2CBD693F794C0, 0xEE939DC82F5746C6, 0x338E9E17F23459, 
-0xA2DC782DB6810FCC, 0x3855ADE1D0D9C960, 0x68D3D891E0F98BD0, 0x9591A938689F62BE, 
-0xEABD1F96F58E7560, 0xFA3C2BA434C45902, 0x5071F0DB0894FAD, 0x3CC94F2CA75E1C, 
-0x7E89D1EA46AEDFD3, 0x393362B309C188ED, 0xB7A2F0B9D06EB654, 0x947BA8D1BD29BF55, 
-0xD62994A6D5041EB1, 0xA5C6F33EB38E60A, 0x3D5CD16D1EA08B97, 0x33C23BD00E2B42, 
-0x2BE4AF8BD8AAC626, 0xA98EE98A635CF49B, 0x1DD040DFE75C4EEB, 0xF1AFFF1F694ADDD2, 
-0x1E8DC2C1E27ADB67, 0x3B5DD4549EB6EAE9, 0xF3387C6C527F3AB1, 0xEA2FD90406352, 
-0xFE95CC1DFE359598, 0xFD15BF736377BD96, 0x767CDFEEF44BB98E, 0xB51BD24ECD64AE89, 
-0x4FBD16D690366847, 0x8208205C7235818C, 0xCF558DE3B533B5BA, 0x3EC45B61C40682, 
-0x82ED41F535F5DCF, 0x9CAE0E399C60A870, 0xF5BA4D9040284CD5, 0xCA928392C7176516, 
-0x3B4DC02C85BA894, 0xEE4BC7F376020942, 0x55983D1D1572AAD6, 0x3135EF4EACD55F, 
-0x443FDC940FC1C1B1, 0x4A27D17F6B6F08D8, 0xFC2BE80DE00041A8, 0xB9EA2010E52CF44, 
-0x90C95AFC4E86E587, 0xEC9CA5E00FB00849, 0xA97D93F9A5FD9623, 0xAFC514256658C, 
-0x2811B0FAF4BEBC16, 0xB062E29B3DFCF34A, 0x9FC3A1951CA10A7, 0xDD238DF1EAD1F195, 
-0x30B8A7EF25562873, 0x501D0D67F6996AD7, 0xC0F57C4364EC44A9, 0x1C9E04C96B256E, 
-0x36A7D72BDEAED1D1, 0xD747EDBD6F55AE30, 0xEC6D22B21F4D5733, 0xC4A0B31294C2BA8B, 
-0x561E14E0E9C8F3B, 0x285FDED248A90E6D, 0x5EF0C645F1C8EA52, 0x190D09CF3F289C, 
-0x12A4E02E2091093F, 0x736D7C1A6494F445, 0x76AC3105FB3B2537, 0x3160CB8480658858, 
-0x25DB50C2D2233B2, 0xF1581F64960B2E5D, 0x9BC16FD6A9F7BB7D, 0xC0A554ED62609, 
-0xA55E423C981C3B76, 0x8E304EB581B14CE1, 0xD6240E408C69BBF7, 0x2F45F87C8DA9A94D, 
-0x97D36F3D5A0C4A56, 0xAE801A640665C2E6, 0x1266112C7CC8CF3B, 0x1B5EB981592644, 
-0x78CDA75C350801B3, 0x347ED587D902D626, 0xD6F050D8FDB2341A, 0xD44E049B2E765159, 
-0x37397373DB20754A, 0xF0ED3EF252A86A15, 0xD76B1B95C710A4F7, 0x364CC94E8C2F22, 
-0x3596A6F0E707100, 0x8A27AA45D651E670, 0x2FFD38248B7389EA, 0x7C4568D366D193A1, 
-0xF03D42F6574AB53C, 0x3147794742B515AC, 0xA957391D641F3FDF, 0x328D7A746F741B, 
-0xF281EAF771CE3BBF, 0x31DFA809CA99293B, 0xC52661190104DF2B, 0x660C3F657469D13D, 
-0xB65F7C920DCFA215, 0x568DBF4C71A1B345, 0xFD3204D2B8783C67, 0x23EEDA7E07EDDD, 
-0xD3BFB116CD648BF2, 0x8E8AA8A50F62AD2D, 0x94D456D5DA3DF884, 0x93287F883C7C5967, 
-0x74307ADB060C49C8, 0x78ED403315EC0E76, 0x8EF9833CD9B40496, 0x3D84ADFC064BDA, 
-0xCA0473503BC5D8BC, 0x69481E6D96B09976, 0x5FD98AB4F1BD6874, 0xF965AE874A229F61, 
-0x853E44FF19B8913C, 0x66F813B77CF43403, 0x8BCC1D1004B46156, 0x1DB6DA3997A389, 
-0x1BA49B84A2360013, 0x96108230853F9FD7, 0xA4773403896C2C46, 0x2C135E355C626359, 
-0x934BEB2928C3B0EB, 0xBE24A39D1BD7D517, 0x712498F51A52E046, 0x16CD507306036F, 
-0x3FE0BA9EA88F385E, 0xECA60F9D5ACD8416, 0x1B53EA963D78079A, 0x3A45D648AEA6DB42, 
-0xDDCAAC3B82F45B39, 0x46C41A59E7B376CC, 0x5DD58BE7F91D7544, 0x715567DEDB714, 
-0xD031BA6A08A73F73, 0xC82F6160CB9CF87C, 0xB87262E81795D25, 0x85938E733BAD1040, 
-0x2E62937354887218, 0x599F8C25F7B51FE7, 0x2241698BC0370DF, 0x804756F6D0FA1, 
-0x9FB0E9EE78E81259, 0x3B5FC08B66AB41B, 0x7EC0FF818A9DABB7, 0xBA326B3312B12B68, 
-0x109AF1E858B36289, 0x1AE23F90915F324C, 0xAE05AA834AD40351, 0x16628C042A5B8C, 
-0x985FA2DC1E7E3DA, 0x8200B81FB2E1786, 0xCE225965133F761C, 0x8E4E90A1CB89B74C, 
-0xAF9EAF10ABF734C6, 0x510A17FA63AC9233, 0x2F813D5D014A6037, 0x3CE8056925AB5B, 
-0x67FBBFD0F32346E, 0x3998C57A9DBF2707, 0x47B01AA9F0063AA9, 0x3D66DD85AED3CB8C, 
-0xB21A04E07EEE7EF3, 0x86CBAE119C5F4D9F, 0xD34D89396D290024, 0x69D5FE9448FBA, 
-0x588FA04152FD8DEA, 0xA0EC43D32CFA3D5C, 0x58A0A6D9202F2A3B, 0xA9B52BDC3DD7661B, 
-0x445EE286559E3CD6, 0xE7387CED34280421, 0x628424B3E9BE907D, 0x18080708A86DE3, 
-0xAE9EC38F35A1C39, 0x6E21736E3C0D2C4E, 0x1E89269138714042, 0x6E9078C8B9E48D58, 
-0x6C436B4D2A382C18, 0x76AA5CB0526015AD, 0xFF5E69D5D4019A40, 0x2307D42C748891, 
-0xB3D07C9685B6A7B3, 0xAC21608E7A0C7FA3, 0x2685223CDF1758CA, 0x9A0E49FF9DE20AF1, 
-0xB95B2D8847EF092, 0x4AE9FA57F194F57D, 0xC46ADAD750E9C3C9, 0x82C3D8B5CE907, 
-0xBE816C02A2A87A3E, 0xF9A5C69723FAA8E8, 0x2578DE91B8621DFA, 0x77193D13AF0D598, 
-0xA3566AFBFF8FC467, 0x8BE86A92B7742948, 0x13682A9897FD7FC8, 0x29A4145E97FA49, 
-0x52908E9F956107EA, 0xF2E49041F1C0FFFF, 0xAE33F68C3007E5DE, 0x52953374C04D561C, 
-0x603AA3242AEB7450, 0xDB043FC6213A5A12, 0x4160CFAB80B31953, 0xC2718C3AC9416, 
-0xB66A94FBB5B38F4D, 0xD3F0CB8F7C3E5B8F, 0xA1DC688A34C83910, 0x2D04B84A1B5FF97E, 
-0x2674DF73420038D3, 0x5CB78A084D76A274, 0x318176E08D68CB5B, 0x29ED0B89D996C, 
-0x611E79BC9183124B, 0x6056727D81C3DF63, 0x2ED313BBE9542BA7, 0x79EDBCFBE7E4C062, 
-0x5B05D6BD11AF3410, 0x3108A72049A2948E, 0x26D332200F9FB993, 0x1328AAA86DB6E3, 
-0x528FBD5B169629C6, 0x57A20D686A65D97D, 0xAE83D365BB968D45, 0x418C02ADA7D4EB85, 
-0x3F5105FF4F15A487, 0xEB54855EE15EA581, 0x759E6301EEED716C, 0x22BD32A8F7CDB, 
-0x1F1351330072166A, 0x2BF306595B82D5C3, 0x7D43BD9968AAD500, 0xCEDD8D3FFAB1B639, 
-0xA7D7AB9EB2C03107, 0xE5C407984EB295AE, 0x593B4FF379760D8B, 0x3F51D692562785, 
-0x729CA6DF3FA4BAE, 0x1FB9C0D5743D7668, 0x2A3EEC327F2ADD99, 0xA3A52CDC3A5F8B62, 
-0xFBABCDD5C8D2557D, 0x64B16AEA4DEFB52F, 0x3B8FC096BFE8AC40, 0x16236A4C589A53, 
-0x8A2E5EC172E9C170, 0x219FEF82F25D72F8, 0xA403166AC76A7F62, 0x6EE3F59EA8EF3314, 
-0x8C7B09BC5ED01A88, 0xF5613504A72F78BC, 0xED8D17386DCE6B8E, 0x21A2CDEFE67596, 
-0x38CECAC2EB77501, 0x3BE9039792F03738, 0x7DFCB84F30CF23F6, 0x872750E933F5FF37, 
-0xDF2C37A38D99B9D4, 0x72E30703969E56D, 0x6F7E628A85AF4B97, 0xBCA9837E9033, 
-0x43DB5D20516228A2, 0x177990A4381AB2AD, 0x242A6B0C78988212, 0xEBAB83DF0233E2C5, 
-0x4A4D0FD40C2E6092, 0xED5FDE82CB4D804D, 0xEC185E7000B45FAE, 0x3D009757A170A9, 
-0xAC43AA305C215CC3, 0xCD0622354629A632, 0x93DFA85E74B94F32, 0x8A962BE21215EF44, 
-0x99662178FA11BC50, 0xB0BE0407FCB49092, 0x889A4967AEFDADD3, 0x13829784210139, 
-0x9DBCC27BBFC2EEE7, 0x4774F22F86AAEFBC, 0xF8923F74C162EAE3, 0xE4DEF5A1FC457821, 
-0xE67F54873C3C8C03, 0xF9B0D61F6E628028, 0x42ECFE0C50E46AF5, 0x13ACE11C040DDC, 
-0x65D8DEDB0D111B87, 0x611C2E8367B42915, 0x218A3E7FD40F0AE6, 0x39B2962B8BE62772, 
-0x8CBFDA8969E1158E, 0x662EFCCF653E3B6F, 0x824C2188E027ED00, 0xED302771EF5B7, 
-0x8F4B5430AD6F11EF, 0xEF67A3FA02F9E76C, 0xDFAEC2490174960C, 0x96E999BE4D685FAA, 
-0x57A6DC959DE29CB2, 0x32C2B3E4863BE0F0, 0x8CA031FC7A21A579, 0x1809F776CA5D8B, 
-0x26485D859A95C4C2, 0x455A084B646D986, 0x3449C07F5643FE6, 0xF586B1D959CED014, 
-0x376F7EA38E652951, 0xE8B657EADB1F3C9C, 0x52BFD68E514F21ED, 0x3FBFE275B0CC97, 
-0x58FB7630BF5B5194, 0xF87CA05355877253, 0xAA6C0E4EDEF8FD1D, 0x863C836B48CB9221, 
-0x1E472A2AFCAA3733, 0xA594747D5922A46C, 0xB5F9B483834970E6, 0x1AA5C4D5D7E6F4, 
-0x2410B2B21C63FB7A, 0xEEC17F2A80663588, 0xDAF59543F5C94111, 0x747C1E10205E4CFF, 
-0x358ACD8B17D5CDD, 0x68AD77E60926AFC5, 0x4FF02EFDE6E7FB41, 0x3CA5F91BA46963, 
-0x4A0A2D13319FD9E1, 0x5F191D55D603B0E7, 0x5A3CC3FAE7E4EFC6, 0x262F99E45FCFD36C, 
-0x751747A7FFE4D461, 0xBCF6013A602512B4, 0x7732762AD8718D0C, 0x43C05055C4040, 
-0xF969E43051024A24, 0x67047A9CFE6F25BB, 0x432BD9D818405CBD, 0xBEA10A26F7E2D9A6, 
-0x12A86AE92A6E44ED, 0xDB77471C5668AD8D, 0x2AFAA849C0850D56, 0x3BA3E5735369B4, 
-0xF196DCF857A46266, 0x4AEA54F61910095C, 0xA0E514D12434EF4C, 0x3AE1D702886D0E58, 
-0x58D592A6E5A15CAF, 0x53637942960B1602, 0x77B1E598884B145A, 0xFE4123C179AB0, 
-0x6E031CCE157FBBDF, 0x5C62C3853B57B7F3, 0xF810D0EED932C8EE, 0xFA718EDA9EF5AC90, 
-0xE01758DDB86BA9B4, 0x73152CF3D3B14DF0, 0x7F3C332DB4E1F7BF, 0x113925A42557BD, 
-0x2C3F3226B64ED7A0, 0x5E46767069DC78B1, 0x76D7D858C82553A, 0xC578585FAFBF8829, 
-0xC4AF7F5F917AB0A1, 0xADDABFBB49166E05, 0x570CCA9F7F1ECF8D, 0x9AAF0B72FC176, 
-0x66F5B1B46FC61515, 0x9AC45CD87048435, 0x1ED32B0517DA32CA, 0xB7D89EFDC2F1159F, 
-0x60899C821192DA99, 0x58CC71E0B6FA66B8, 0x8DD97F2F519BB849, 0x2839939AB648D8, 
-0x8D1B406FC8821E3D, 0x67380B65B6A68CDA, 0x3F33EBBF38F76AAA, 0x8EA52F24C03EB1C, 
-0xC352A28290FE3599, 0xF71853D4A8694B94, 0xCA76A2C33C713C40, 0xB25CE6889FF43, 
-0xF1537FD35F6E7001, 0x7620088A2042B58, 0x6118E4C5686A6A12, 0x4DF376A8048EBEB9, 
-0x1E07E0144E078E53, 0x15F677D3A9F751D9, 0xA766BC8D60427B58, 0x1BC0E8A5F2F8A, 
-0x445CD213700B3F53, 0xBF4106E02FD650F0, 0x96787A1F3A43D3F9, 0xC6354C834F07B2B1, 
-0x6709F5BC3A18B669, 0x42184F01DD778956, 0x27ACB7F7DB7462F7, 0x16EE8D2691FEBB, 
-0x1016C5BC129AF021, 0x7862A3CDD0D42E9B, 0xBE79EEC8A2DB3754, 0xCF99EF1CDBD76919, 
-0xF209DDFABCE7837B, 0xC403873786ECF677, 0x522B6511C9A5DCF7, 0x3AE45CCA47C28C, 
-0xFE5835813DE829FD, 0x4EB1117A65A7C5CB, 0xD5AB05EADF2E65B, 0xDF18B1944E41A01F, 
-0x98F97BDA5982F2E4, 0xFB673FC2DF351C65, 0x1C9EB4785F3B3B8A, 0xAFE45A09DD10, 
-0x64426306459B33E9, 0xFDE29D02EDB57EC1, 0x3D64AD7AEC85AAE9, 0x3A1D2511601F5B45, 
-0x1B3DB1D49DBFD531, 0xF8A188BA285F2A90, 0x3C0F5F4DC03B4115, 0x226255E962EF03, 
-0x9AA3C4407576C123, 0x512EA53E7C6FC456, 0xA1351CCE4003F5C, 0x967BC4A430BD7038, 
-0x9F28235798A62270, 0xED89CBE2A38729CB, 0xBC3C774852BBD71, 0x1F30EA53BE1086, 
-0xEB34A27AA9A21FC9, 0xB202067C251D52F8, 0xC07DEBD8C1382586, 0x32B4A5850A0ED30F, 
-0xD1FC718AD2336508, 0x846C37C5FFC85DFB, 0xE2ECB8D2219D93DB, 0x4062F9B9695F93, 
-0xA3FBBF4D4C9AEC49, 0x2F7C8FA851E557E1, 0x730733E2A55F9801, 0x20DA307FB48DA311, 
-0x6B9EBB914F70F2CE, 0xDA2AAD961299383E, 0x5C7FAED8A78D578A, 0x24E466E8D85565, 
-0xC30F4C1DB7354111, 0x9C2DDBAE016193AA, 0x5BDB8F2BA480640, 0xEDAB72FDA7E7E82F, 
-0x4A46006DBE03D066, 0x175C1F11B4B9DD2E, 0xB8C6849A519F4139, 0x1147E475B81ABD, 
-0x21B9379945BE8803, 0xFF699B7C88DFE454, 0x218A05E55712F9F5, 0xC6D2ACC31AB7708, 
-0x537EF1DC31C359F, 0x977BF8A449650F04, 0xCC1C097923490BB9, 0x3D456333FF3EFC, 
-0x96E2FB0DA73E42B9, 0xAD22B8AF384022C5, 0xFBD6FA9AF07A2CF, 0xC0D877166E946ECE, 
-0x7A9A79EB2F7E42C9, 0xE4199D86BBBFC94C, 0x6A860303563FDB5, 0xF8EBAEB95FA58, 
-0xEC74B106FEA91E7A, 0x1CED984B09196619, 0x399D4D0EC4F9415E, 0xF1348A79E03F5484, 
-0x63B61EF9EA233738, 0xF08208B72466855, 0x26E3BCE8B7346096, 0x3C5D766DD45590, 
-0xEC896B68C4525E86, 0x80C618226A79E114, 0xE77276D58904D650, 0x1A9AAF2865A00B, 
-0x50434FB27D65D0D1, 0xF0233E004A334C3D, 0x22AAD6128ECAB338, 0x13F5C83C455F87, 
-0x394457CF3B28A483, 0xBE3A3E1957E83557, 0xD9EC07064C5E4CF4, 0x5F0F48A4FA242C7D, 
-0xBC0044EED1D55438, 0xF3C4EEFB99BC8321, 0x378165DDE24BEBFB, 0x1BD0FF72669D8D, 
-0x2652D510518CCDB1, 0x7F30A7A1376DA6AE, 0x8400ED8291F6135D, 0xEDDB591AB2A1FE72, 
-0xDF168BF350389527, 0xB33E547FAB4F3A55, 0x46E5C3D26CD5EFD1, 0x19622E520C3408, 
-0x32F4A0D813DE88B4, 0xCC08E39051398E78, 0x31BED6F52409BBFE, 0x7F19A72024F48C00, 
-0x8C45FA1F7CF19D18, 0xA451387B7958387A, 0x861AA1734AF12D8B, 0x17974879ACD1, 
-0x3CDD34D472068428, 0x114200B168AFE2A6, 0xC749AD7EF04D1979, 0x2CB4FA2DCCB844F7, 
-0xC479440B0ED91275, 0xBB2B43DD0EC882AF, 0x3CD3CD79B5F7DD10, 0x18EA3568D098F1, 
-0xF4405D11747FC790, 0x5AFBBEBF8A39D33C, 0xD6443DD814E50CB7, 0x4EFC7C6B29077E84, 
-0xD69E231A5DF05A85, 0x14A9EC2061E830D8, 0x1C87197292C42668, 0x77093219353AC, 
-0x4B06C5D382CD8C74, 0xE598EB9A3A63D6DE, 0xF6538B318B1FC3E4, 0x134233848960E735, 
-0xDE76D93555719746, 0xDBEEEA29B57771FA, 0x9E8D162C605221C, 0xB76EED7F68D15, 
-0xE9709C347421ACC7, 0xFF8A665A69AE901, 0xBBF900637A1A958D, 0x9EB5CA16F3AE6C2A, 
-0xBB8AD0BE63BE8296, 0x99EE2799755A7D87, 0xDF7FFA3606FA57F1, 0x11426FCC5F2482, 
-0x4218FA2C06E9E11, 0x5F50F40ECBD7D7F8, 0x9FEBAF1ACBA74B9E, 0x6F24A108F1665D78, 
-0xD303C647CD295CB5, 0x7BC99C5BCBD783F2, 0x5B9F082EA00C57FD, 0x2D823EC008ACDF, 
-0x88BED526A0FD39B5, 0x8DE7E3C68EE558C, 0xED625E1609B43ABB, 0x5EBA4CD902BB31D5, 
-0xFF5C76049FCD3871, 0xAA81207217CD27A8, 0x1E910819FE8CC85E, 0xF2CFDC5B10392, 
-0xEBD9AE86EB1F8CAD, 0x3E5B64237FC06EA8, 0x61E23223DF1674C8, 0xA71ABFFD98E81293, 
-0x357CC37F397A708E, 0x77C4FD5333802ACA, 0xDC5FAB7D3C53FE14, 0x1E9EED706827D0, 
-0x9F79450961A79883, 0x6BCD7BD744E57FCC, 0x73071B35CBBCDA95, 0x72D87F9035F14991, 
-0xC6CFA8F16DB4EA13, 0x41596EDD6A2C1E2C, 0xAE43A24295AF21BE, 0x23419687C95FC2, 
-0x47AB376E32A026A8, 0xC5B6E1B6866EDE86, 0x505723346543991A, 0x86E68F313CA5B8D3, 
-0x8A48859140DCEA6, 0x59A4642F5107241, 0xF21B40E7AC935A0D, 0x357BB28C2DB97B, 
-0xB5194365A4667E73, 0x97D56E5D0432E095, 0x24B15E85E157DA1E, 0x32DA1413D58DB9EF, 
-0x8C660CA13D51471B, 0xB7EE3E440F7AB651, 0x9E9BAF677AAA783A, 0x2C8073B46B7CCF, 
-0x8F0B6BBBEB178709, 0xBD2B2A89826C7914, 0x1237F6EF2A2933B7, 0x1FB6EE2604D21D76, 
-0xA2FE14BB2BCE1037, 0x7777E815467A58F8, 0xA6C7189D8FE0C8B2, 0x26D6DB4C0DAD72, 
-0xCF2CB78A4F1147B6, 0x1425F0EBC74956FF, 0x36239BB3EA80FC4A, 0xFC87113B6548C4AB, 
-0x19ECA6360D8544C8, 0x8F6590C10243F227, 0x2120229F060089F1, 0x2A5E099782D628, 
-0x9B77FA7E0386FD34, 0x58AAD06E1AE3F7B6, 0x27A020E1AE993F74, 0xE8F028A00876F20A, 
-0x1B0F9C447AB16397, 0x8AFC8632754EF5D8, 0xC6749EBA6214BC7F, 0x198464EA582EF6, 
-0xD22FF5474D6F810E, 0xAA24898E0F87EEE5, 0xE6ACD8B4EC7A7947, 0xA540D39D2530EF82, 
-0xFB980F7076447830, 0x1707916A3FDA9DD4, 0x8B0A5E1CA8379DFC, 0x323599C1FC2029, 
-0x5B31D30B812E4F9C, 0x21143093A1CEAF1F, 0xA599D0C828AEA55B, 0x86DE486BB3EAAB8B, 
-0xD6BF9F80442C9874, 0x30865A2E54022C19, 0x9744309568955456, 0xB63C4069F1FD2, 
-0xD11493DB7CD53E5, 0xE6BE663EA19B3260, 0xCC218EC9DFB2D178, 0xADEC42BC73CC2E8B, 
-0x3EF34E8FBE7D1346, 0x7858841E1E9E649, 0xD56956BFC6BE418F, 0xBB4CEC9BDDC3D, 
-0x17B84551DB5E12E3, 0x85DB6075C73EC9DF, 0xF3910055E9F1A579, 0xE5F8D5E21F943AF4, 
-0x790FD12B89FC6D9D, 0x2F7FA0C6572A7973, 0x9A1B7DFF14B2138D, 0x1BDA74EAFEBDFB, 
-0x46C13FF3CEDA6107, 0xEAF7CE455D608666, 0x9BC5502463C8E971, 0x5C419429346ABD3C, 
-0x514FA532B365AB38, 0xFAB2866BD9CAD1E, 0xD12651917EFE6B81, 0x3DB10AAFA0A28, 
-0x49B46048A9A30FE, 0xFE4A653E910E30F3, 0x74C064A23E853C83, 0xC34A8FF1BA3CBA33, 
-0x6BD750B58E37B89D, 0x875B14E38B8FCC3E, 0xEAB3BC1414348F1C, 0x30946CCBF77B3D, 
-0xA0D175E5A5782052, 0x9A068C4F35A1A7CE, 0xCB8309BA5337AF3A, 0x5B2E9EEAD2B5CB94, 
-0x1E4F7D07B1C0B77B, 0xB5BFCE2242DA5A62, 0x2433398C31DC947, 0x333B41AF4B060E, 
-0x1A06EB10E46624B5, 0xFAB66C4BDC59C0A3, 0xC3313AB573CB525C, 0x448079A83C6AEE77, 
-0x70923A737239A8EA, 0xC1AA445EA76400CC, 0x8C014D9FD52FA767, 0x303F3DCF1C7018, 
-0xCB0B4730E1A9A55B, 0x95EE6FBF60827D93, 0x2826EC6911228A7D, 0xD4BBAA4AF3121005, 
-0xD1ABE0EBC7760554, 0x9072032FFF2D4A25, 0xA9975ADBE0A75344, 0x332E390C9629FD, 
-0x36D165E34533AB04, 0xFBF63BCC5EE32A4F, 0x8BC3D8B917C6C11D, 0x81018D8FC5BA059C, 
-0x3F38962A9B85AE9D, 0xBB99351ACE0953F5, 0x1D63AE6B1C6A057C, 0x2425EB7B9400E8, 
-0x3165D1C273B60ACB, 0xC4366942FF255BD5, 0x339D78C537230D9F, 0xA0A4938581B610E0, 
-0x2C4B190DD1485256, 0x709A69D53E1ADC59, 0xB0B0414396D56C64, 0x10F1E763404AC4, 
-0x25659E84EF08760F, 0xE1925DEA624E0DCF, 0xE93256220B1613D2, 0x9848DD50E0F3C81C, 
-0x5C3258C868E2376D, 0x30C8D71D5670368B, 0xAE8CC55B14CF3E70, 0x36EB4352C07E31, 
-0x10B70723F0919847, 0xA00B6A32BC2392C, 0x6D850709E20F1F08, 0x7869AA483007F6AA, 
-0x918E7881BB8DD615, 0xBA0D2EED8A9A4C6F, 0x16F08C992AB4BF57, 0x33380745C89479, 
-0x74E0633FBD9A412C, 0x4ACAE87416EA73E8, 0x28E39A023F42B4BC, 0x78EA151387CE8BBB, 
-0xA5A8C6F3DF4CA1C1, 0x14B486AFB06E61DE, 0xAA39EB2DB1BE9004, 0x34132B96939FB8, 
-0xBF7235BFAD8E9312, 0xF493EB29CF829F5C, 0xE4C60EF963C72642, 0x32294A29F272B4C1, 
-0x87B8F1F000C52248, 0x451160037B131FB8, 0x178879DB3C4360EE, 0x3E909C9F2098BE, 
-0x88C672D65EFA9FE1, 0xD7CE3C22759AC549, 0x18330F41226918DF, 0xE96A40C5AB192D6F, 
-0x928933AF5950906C, 0xB05A2F69DD878F48, 0x99B11CD36ADB1F53, 0x405B0DF056C6DC, 
-0x8B0C684F78E96102, 0xFFEAE5669ACCC14F, 0xF99D7AE46965F12A, 0xADB9FD306626DA10, 
-0x9053C39BA2996ECE, 0x5D3F7767756C7677, 0x244CDB442E19730, 0x115421BCF20153, 
-0x1A32FB73BB507A24, 0xBE2FB4590DE58B75, 0x9BE77D13E8D58E34, 0x555F2076D320950C, 
-0xA626AE66C558C586, 0xF89840B29925A624, 0xE6CE508931F4FCB, 0x1758ABC283486C, 
-0xF4E370CB9962A3BF, 0x4B7C2C2C8983286C, 0x1D3E5AC23553E752, 0xB0DA1CB070C9DD39, 
-0xAC81268E06ADC9EB, 0xF55FE53EF4A19C23, 0x590893D20A07309E, 0x34A316EEAEB0CD, 
-0xAB2F66C6019A2C5D, 0xB2D3AC05ACF09B74, 0x56CA6F21B7B25E93, 0x49D61D8427DDC524, 
-0x440720C7E4A21041, 0xCF1E06E7978FB67F, 0x7C673E53180B2F5A, 0xBE84BD7E041D0, 
-0x86D1F3DE890147AC, 0xBB04987BB6A12911, 0xFE10630E8B41F418, 0x3E02C58B2174BB13, 
-0xB0A1A13EEA19D4C2, 0xACE4CB35E2E00245, 0xEF3430A9936FF8DB, 0x79D907502CADE, 
-0x22BAD499AA3827A8, 0x4B3F1E119E5C1FFF, 0x6F080FCD5AF1AF09, 0x29A93D4E05C93B3E, 
-0x31AE0602447AF489, 0x29CD35D79757DFB1, 0xA5B8EA1DBC1E3B96, 0x13D7E595CAA0F9, 
-0x58946FBCD5DD4CC6, 0x2CC8008989443EAA, 0xE2BB52F4D5C282C4, 0xEFF44C8F8C3B6353, 
-0x45FB3020B5EA14A6, 0x69E69A9F2F471499, 0x31AFD7A2A10BE890, 0xBC96D91B3720E, 
-0x3BB29EBD9335996C, 0x3838100AE664F291, 0x20040944D616382F, 0x18DD4AF83027781F, 
-0x8BF9480718EA32ED, 0xB98602F89AB81282, 0xE809E39DDCBE7A21, 0x2224A7B9AEEC35, 
-0x5BA28414AD1DDD06, 0xC140EE34EA02A1AF, 0x906A1E870E7F4E3C, 0xAA1B6BD771AC8B68, 
-0xD69DB0BEFD8E8DB1, 0xC3C130CFA300AA03, 0x165B8CE49AE5DBC6, 0x258651909CE260, 
-0x55C4B04729F2C20D, 0xBE99A2D495761382, 0x841E2E6F510FBE10, 0xCC7AD98DC8730C6C, 
-0x9E101271DC694850, 0x1278ED0684E5737D, 0x4F1072BE4639B041, 0x35A14A1C9B4DED, 
-0xEB15553A5709A9C9, 0x450B4ED98429A3E1, 0x1C9D2D23367F26C7, 0xD562182C5EE3BC6C, 
-0x5EB1A9A8B74F6C63, 0x8B0C7DE094E1221C, 0x2EABF93F1692CCCF, 0x2F42821BF9C249, 
-0x1E4E57BAE436B61B, 0x7DAF2C0BFD0F937E, 0x40FA07236D8D2647, 0x7240569597B142C6, 
-0xB737FD65A4E3D6BB, 0x703FE66C031544E9, 0x8653CDA0C2168CE, 0x1A085DA0A4C7B4, 
-0xDA491A791F43A339, 0xABB7600BA7B14093, 0x70E3CCE8094C3E14, 0x33A4DE98A5A1E8D3, 
-0x440FE618F4E56B3B, 0xD39D75514C6B1256, 0x1C5A249B7B08281D, 0x46161C734D26, 
-0x85049B5E8DC2B092, 0x999D75BB439080BF, 0xF073A83F1DED81E5, 0x1E73A023B92338D7, 
-0x654E027B15DDE902, 0x6FB585760D837E18, 0xC86FB667D6ECE0F1, 0x14D054D2431AE1, 
-0x1347E4250BD662DC, 0x1E45F8C289A0207D, 0x84652FA71012FD5B, 0xD8486B964E52586C, 
-0x5F706568755C172C, 0x23C6B4354A2B7418, 0x1D788B591B1C230E, 0x18008BACDAFF1C, 
-0x80A7F5E6A421EEBB, 0x828ECAB0508BC656, 0x3935A686D5BEBFD5, 0xFC2E4BB08CC9F415, 
-0xCE1A132042CEBF5C, 0x85AF8C8514600468, 0xC43EBDAE9491692F, 0xDE602D88A4203, 
-0xE237911207648504, 0x8BB7BE827E073004, 0x3AB562FB1F7437A2, 0xDFC5FD03A24C7AF5, 
-0xF6C695CB252390DD, 0x3667965601555FB7, 0xB6FDC18C3E6C6CD5, 0x2D2AACFF43EE62, 
-0xD12EF97F00D11574, 0x52A1C7B56F78108A, 0x7CA8C9B02689C2A4, 0xC9AA045389C7BE63, 
-0xA754A4B132B742CE, 0xD800480B740A5B81, 0x38F7242150BBD4EA, 0x28C69DE64A684, 
-0x8A2CF033FC45AA51, 0x6A525E128AF89663, 0x2F0396C9D5CEF9F2, 0xCDDD8A0F3FED9FE3, 
-0x277769192D52B1B3, 0xF02A474F5575C357, 0xB1EAFF7AE2951785, 0x3EB549D3C8DB9A, 
-0x684A98D694D527A9, 0x3993656F21E4D8D8, 0xBC9662032A05F1EE, 0xEB897927C8AA8A16, 
-0xE6CA344902805918, 0xDF6615363CEEB0C7, 0xADA0FBD7805D319F, 0x34014C205CEB4F, 
-0x1BA597BF5EACAD9E, 0xA29BB7673EFA4D54, 0xA17F38A663B456E3, 0xCBF4BD6F69267C43, 
-0xD4D785422F42AB3A, 0x1AEB8DB3390DEA95, 0xD16DE200EF888757, 0x3A028B3B6FCC43, 
-0x9A30EDC32DD484C6, 0xBB35495BD98F7703, 0x9CAD39151CE294BF, 0x25389D840F6F0313, 
-0xF455BD3973611F2, 0xBF7017047AEBB291, 0x528E832BB0EE8FC0, 0x3D02B15EA8CB16, 
-0xD28BCF687ED079F2, 0xE1B7B87DD31595F0, 0x97CAEE6055A88D98, 0xEC91CC1939AE4E72, 
-0x5ED4140AFF3B0A53, 0x3B46B3B6ED2190DB, 0x42F4F8FE56319747, 0x36141371CFCD0D, 
-0x6AF590E7B46A07A0, 0x36B3AEC898A934AE, 0xB79C006F2ED1C99C, 0x229332AE6B82EDD1, 
-0x7FC2F8D29E6E6D8A, 0x8BF4F584D233F310, 0xA7F6BFC13C7BDC9B, 0x226BF38548655D, 
-0xFD97AE250545B392, 0xF3A79F2269BAD5A8, 0xF17C97CAFE7091BC, 0x245F00DBB8DEAF28, 
-0x6BD528EEBFA46FD5, 0x1536A7E9B8680616, 0x83EA0F95CD97CC9C, 0x1906D439356980, 
-0x9341D52974EEC63B, 0x641FE51C19F54745, 0x508BB97B2BE8EF09, 0xE068926705294A71, 
-0xF82ADB1F93EDE103, 0xAC80B7CB99CDB7F3, 0x4997551F9DED0BE3, 0x3859289C816A89, 
-0x2450C480A6A234DB, 0x8D0DCB2D91EA16EC, 0x5127B59A6CBC5EE0, 0x77FA104EDFC9571F, 
-0xFE1F85BDE8E97472, 0x8D8F1E7A1EE55ECB, 0xC62C99BC55ACC580, 0x150749F3025401, 
-0xC2D82CF3BC0B7B29, 0x7DA5D59809DBA692, 0x333D046695A27CCA, 0xA90CEFB112E049F8, 
-0x4B7AAD3607DF377, 0xAB3FDF48BB20A904, 0xC33BBB0EC34CECA4, 0x3461789D7D088E, 
-0xA6410C729C23518B, 0xCA7C2FA04266800B, 0xD9FC8B912D984F67, 0x9FC19E615BB94468, 
-0x1BF8801978A06557, 0xB9B1668CFFCD9C7B, 0x41A3E5C96AB7A388, 0x3E8B791B77B2AF, 
-0x790C76C92A222BDE, 0xE269CF1D12F69FE, 0x4EB25C9B5D2C2C74, 0x88E35D83A3490912, 
-0x7580885D45BF5DBB, 0x5C7766A1EE629590, 0x3766D2C7455D1ED3, 0x2B51198D19D466, 
-0x6511BD4F3D88881F, 0xBB5FA24AD21EB5C, 0x1E7E1673933570FF, 0xE114ADD69F70B8B9, 
-0xFA5A7821F4D8A129, 0x80FCD4DF2061703B, 0x6AE17AE4233C4A18, 0x36C76DE28DD9DF, 
-0x4294A4967DC4D31E, 0x68CA71B8DA4C100, 0x591A5CA5C9CAFBDF, 0x2FE1E044C538FE96, 
-0x55A21570E62DD5E9, 0x916390315C77D887, 0x4D18407091BF61C, 0x21F5FE2B159BBB, 
-0xDB7FBDC9DE947C67, 0x94E47BB6D3774758, 0x27DCE8E836DD09F3, 0x9F79DA08B5A54F51, 
-0xFC0C49789E007039, 0x85591AAD6FB3D331, 0xAD7ABA03467F817A, 0x3C209860AF625F, 
-0xD956C8940B16D0E6, 0xE99C168FA8647E8E, 0x443981B12158A0B, 0x62A73DF528CE43E6, 
-0x12BDA7F3B2E58F06, 0xA258E900ED001B9A, 0x3E827DF2187FDE6A, 0x1CF454D601DF7E, 
-0xE8D41FC1C6DA6CC1, 0xF27DA4B3D87EE219, 0x8B956FB9CAF0A9E0, 0x9AB6714415761B16, 
-0x852EE1E7FE4F84E1, 0xF1FB7AF94863178F, 0xD4F5F92772C8CBEA, 0x1D9D6D97DEB55B, 
-0x9608223DBB03C7EC, 0x6F73048FA477992C, 0x26C67DC384A1A5CC, 0x185B3ACB86AA195E, 
-0x54AC275135854473, 0xC9CFC656BBBB45E1, 0x22035E06BE3D4189, 0x1F0E6191FAE1F7, 
-0xAADE5859AF740BFD, 0x1E971698904E9CA, 0x10591D76246DE61F, 0xB5699653BD7A5DA8, 
-0x749499EBAA6A1151, 0xD69B1A32292C66E4, 0x3AE8CFF4DD8BB071, 0x2633AEB0860B8B, 
-0x5FA27E4387D53E04, 0x51C8321967C6C873, 0x431D50BC65991A8E, 0x53E42650F50D33CB, 
-0xB6C0B73752E161B, 0x1B309D4DC3328085, 0xD58292ED116615B3, 0x375DEE5471B5BF, 
-0x42C26E752EB1FC1, 0xB6D0AF09454AD11A, 0x37FEE0769940122, 0x5D49A9EAABFBB288, 
-0xE8AC47B732E41FAB, 0xE29D280204D92D7B, 0x55330973A36774F, 0x2837CA42595E43, 
-0x84A60756EB7460ED, 0x294F4E71375C9B63, 0x4B974DA51B11E6, 0xE679D6169965F788, 
-0xBD12F10AF3DE1E4, 0xF9064A851F1D599F, 0x40824F107929936E, 0x312E08D710A34B, 
-0xAB492B7E77F1A722, 0xDDA9B7B6374E2AD7, 0x628F55EA4126A72D, 0xDE9213FB7B1C0563, 
-0xB35853FCC480FDDB, 0x3FE86A18C62E9E69, 0xFFB68AE526855371, 0x1EA56CED5D3B3A, 
-0xD3266F43B31C2EF7, 0x43727C43EB63A2C3, 0xED82E22D156D3184, 0x8EC5486D333A2DDA, 
-0x5FBA48F3CC129FBC, 0xA17FCA3707FC7F5D, 0xBD1D0C818F04BFC7, 0x16349E263AE5AA, 
-0xCEE0078D21A51225, 0x304399D3777B2930, 0xE55F9C9134694EC8, 0x4432A2592F115737, 
-0x265274ED9D87CBD1, 0xFA8F7D2FD26C5691, 0x8F8B0B47CA7ADD02, 0x8AA0A796F8C8B, 
-0x94EED86E62DFB2A8, 0x2D59B2C691D14BAA, 0x9F28DAD9F642D39D, 0x476F5DD5254EC662, 
-0xAF7398D436088F06, 0xF8D79192B24791A8, 0xD91CB3EA1EF269D, 0x3A25DFE61BCDCA, 
-0x1AF4BADA6EA9566, 0x178C0F124F70F19B, 0x243EE7A2D154D8EE, 0x33C152028687F7F0, 
-0x9255A20B07A93BE8, 0x952EEAFB71FD5265, 0x74A21C3350378909, 0x3306CF33DC1830, 
-0xA63225F393C7980A, 0x83C1317F8505B9DA, 0x59CDD03E3F1A575C, 0xA4D6FE76C1F197DB, 
-0x90249C39A4F53DE7, 0xE2742B13D0F9BD7E, 0x5D2411C605A6D17C, 0x24392AF80B010, 
-0xEC80EF1D21F52C33, 0x20B87630C00BE2C6, 0xAB495FD8DBC68F4A, 0x4993947FF5FB0584, 
-0xDF68C7063B458E77, 0xFEAA512EC1A85C97, 0xB8DB234CEB8FADC2, 0x117D72B29AB2B8, 
-0xF80567DD445F4190, 0x27B344E83736F311, 0xDE0FE0693E86D288, 0x80E5C39AC243B12E, 
-0xE731A8390442697F, 0xB52995DC10D85BBD, 0x983A908D958E001D, 0x14EB98C8A88BFC, 
-0x7172A2A45CCD77D2, 0x6FF18419AEDFFD58, 0x44E8DE05E672F56, 0xD5E1B1387BFD1054, 
-0x29D1769CC93B777, 0xC4CB7D8DAD3E37E5, 0x2B2271050C5D616B, 0x2AC9F1B34E6816, 
-0x5964EC174A548BAC, 0x2C361D88AAB64A6, 0x57B1749604E46C2B, 0x6FBC74F1C4B2BC10, 
-0x8568C042E06F1E2E, 0x5BA2E4683436926E, 0xA29E613F21DD35E6, 0x25A65EE02FF8E, 
-0x6E92A688A4BDD8C6, 0xF0B8292BACC18BA9, 0xE12573106B312252, 0x6B3271A6DFFA14F1, 
-0xA3E2673700527601, 0x1466FCF69D624777, 0xDB679341C2F83A3A, 0x2EF5A1642748EA, 
-0xB4D3F3E4F8C92F9C, 0xDA6A388A1A12A6C5, 0x3F20DEC253AA2DD3, 0x5D31C2811166130E, 
-0x55DEB5CAAC4A1C04, 0xAC88B39B00B954D0, 0xB91496C59EA25243, 0x26C7AD6C28555B, 
-0x68BA3C1AF0449E72, 0xB31FF8516251F2B2, 0x66660C9153363B34, 0x738E9723B448FDD, 
-0x7CD8E90585B20898, 0x1DDA63E7289E59C2, 0xCD55EFFF4D4C5DC9, 0x2CFED3A1E79E6B, 
-0x23C7E695A4663F7B, 0xA33A91CF41A6E8CC, 0xAAFC738D4FE65DDE, 0x41354E6C4EFC3F6B, 
-0xCE09ACFDE0A88351, 0xB9B5D59D84FFB394, 0x320E700A5B4A70B2, 0x11C07C6EB6B0CD, 
-0x9A2B92D2CCC0B7E2, 0x2CC322DC947F06AC, 0xDA802EC9FFA78188, 0x729A1576C75F6485, 
-0x58DDA8DC31FA6231, 0x12631F873B3E1DF1, 0xCCB209304997B3CE, 0x157780BD4D6289, 
-0x7A45709B2B25DCC6, 0x772C166EEA2BBB6C, 0x6EDF483E38C6A664, 0x219A6159DC453E21, 
-0x7CACE4BC4200B7C3, 0x682C7029F7BD31C3, 0xE0607BA36EBCB8CA, 0x336036D4CE929, 
-0x669D3B924DE9507D, 0x36F4011C2D1E2348, 0x6B88C5BF3977D55E, 0xB5B6D0A444714E3D, 
-0x47CCA405E7965E95, 0x1C12225588E82A43, 0x78670B0E17F84683, 0x18CEC7F5D12C7A, 
-0x5DA139D18AA02790, 0xF50D387407304BED, 0xD1BA23AB2D5A2452, 0x2C1105899229B53C, 
-0x3ED146116D15F200, 0x9D8E41FE99E5488, 0x5AE953753572C499, 0x346DAD0FAA1F33, 
-0x62F404648A5194A8, 0x65764FAAD907AAEA, 0x585E5252C191786, 0xBF40B59B10E2C680, 
-0xC2161173C837B1F7, 0xE07C6D2A74859836, 0x1ECDE61A3F74F2D9, 0x97149A405B505, 
-0xFEEB8F53EA66B66D, 0x4BF7A271ADE8B01D, 0xE7007F9C02F8D5CB, 0x965246982E51A804, 
-0x290E657EFD7ABA26, 0xBC040697AB106A12, 0x14AFFC1F1DC62376, 0x2D37963150FF7F, 
-0x66496558448BB985, 0xC716B523E1F41882, 0x7BC241D6E1544928, 0x9C532D3A1A126F6D, 
-0x8F6C690DF10D6A2B, 0xB818C8DA7DBF2B2, 0x7BE2EBD6C3F69AB9, 0x299FB85E7B17EB, 
-0x7AB3420A07944A24, 0xF59A52FCCB68000C, 0xFE3A8452CDFE4D8, 0xE4E2BA8BF36C65AE, 
-0x41145093BC69B1DE, 0x6BEE25E4C624945B, 0xC677029E2FFFADBC, 0x1712D0912AEF0D, 
-0x4A413C927195D2E6, 0xD2A5059E2666E326, 0xFEE7E3F05555C9A2, 0x4CD7A4691BB0BD52, 
-0x27E7BBBD585D8D76, 0x600C34A32B1B146F, 0xA682FC1DD1F45234, 0x1CE66B6D645DDE, 
-0x390BDEAED233E32, 0xB9A4093C601AC152, 0xF54EEE0949FE611B, 0xBEEAE782E291C0D3, 
-0xAB7FA434AA95C9B7, 0xBBF947B29E0DA2A3, 0x39CB325824A55526, 0x2FEBAA458D4F2, 
-0x546B51205606BBCF, 0xD94CA883E6AE35A5, 0x6CDF13C97D55056E, 0x5D01CD588E244E7F, 
-0x361EDF937C1E2CE7, 0x3746CEAE590545BA, 0xCC9983E6410D069F, 0x3CA5F3C26130A8, 
-0xF1B63250AC5F7FDC, 0xBC0375C25A3B5858, 0xD3FFDBE288C8BF63, 0xFE07BF0522C314B5, 
-0x99C58660027E39D8, 0xE5473DF92C8744E1, 0xB84CD249EBA475F, 0x2E8EC2E14F6FDF, 
-0x1D48D7438BD2E58E, 0x818AC2EB4EF02F11, 0xD91FEC9A73698A09, 0x9B3E992DD001888C, 
-0xACBA49EED62A3A0A, 0xD0ADEB5508D8C10D, 0xF4F140EF2D04FAB4, 0x1E44C12F3052C7, 
-0x93BA6542CC091641, 0x92AC91BBA2AEF8A1, 0x2DD68678BD641512, 0x37995142B5BD4C81, 
-0x4D4598BCD6B2CDCA, 0x7E0C0262B791EDB1, 0xED246B0E2413396E, 0x3C80014C42DDEE, 
-0x10DA41DBFE09BF37, 0x752899F83ED28366, 0xC0C7C22F68E90ECC, 0xE30975EEAEF5A8CF, 
-0xD63E8E15E87EFCDB, 0x199E6379042AA847, 0xDE59F47641205165, 0x302FC591230A19, 
-0x809C15014AACCB39, 0x90A8B0D1CBC46D2E, 0x7EFDEEA27715A5DF, 0xC55D80B940803DFE, 
-0x8A9223264EC832E5, 0xCAA6E7D90632D306, 0xFCAC08E3E0DA5E00, 0x2F0E3D02F8263D, 
-0x5B51072DBC626948, 0x10B3D64D19FB7A5B, 0x4CAA128D47B15DFA, 0x3559986213C5442F, 
-0xB3B69DE04F14D4DC, 0xCA38B8B90E718D8B, 0xFFB451628E6648AA, 0x36D4771BB0E3A1, 
-0x3AFC19DD2414D09E, 0xF517312467CD9197, 0x309A8E409E03D67A, 0x140A6AC5106D2EF0, 
-0xA02428A86007500B, 0xCDEBB5F991C1EA59, 0xE7C84FF114FAC30E, 0x2955FD717FDFA5, 
-0x35C4A0080B415274, 0x7CF9B96E9AEF6340, 0x5E9D61C823E2029D, 0xA3A1449825B03EB0, 
-0xBF7B8F9D645450D5, 0x80B16D688D9B465A, 0xA2E60BA7A5F8DB03, 0x5FF1B830D7C4C, 
-0x99181B17CF596049, 0x720B8556900D55, 0x95DFDD18DBC36B49, 0xBBE69663E2EB4C1F, 
-0x885C48A4A7679D44, 0xE7AFD85ABA3DC16B, 0xE6CB9A00DC9F6580, 0x399B5C4F9207EF, 
-0x7A00CB0D5F58A2DF, 0xE7515F1DF9ABF3E, 0x67AE924D6E10C4D0, 0xA8F3B73A28D025E5, 
-0x9DA783D3667B7117, 0x192E3158EFF0DEF5, 0xFF4F966AA0A332E0, 0x1F522D621AFC89, 
-0xD6E0FFAE648CC168, 0xAAD177A91EF5DE60, 0x12BA0F542F632D9D, 0x324CD8292E1ADF00, 
-0x32B73212C274AD47, 0x7E449AEB2A85E4BB, 0xF32A5DFB315E9060, 0x737FA105673D5, 
-0x6FD146CDBF97BFE, 0x6B4ADF1B4E5DB30E, 0xC862619DC9230F4D, 0x5C9DF46F2C4FE8C4, 
-0x19DD437C3226E6E3, 0xD7B668FF0016922E, 0x9FCDCEBDAE510F77, 0x28F671C4AE4484, 
-0x6EAC6668A322F180, 0x781D5AA3D3B04932, 0xAB250D7177A90423, 0x88883867A352801F, 
-0xB2DF8BE8AA7DEBEC, 0xB18C0E7191B25BC9, 0xE453C8C61382CB58, 0x1E1512BF0B8652, 
-0x5AFE141F4823C952, 0xD5E4265E49211589, 0xF4C12F9318EA4520, 0x4AE90781843AB51B, 
-0x1CBB3C6C35998965, 0xBB3693B2AE46B3CC, 0xFB78A9E4B68ED6BF, 0x3CC8F19AEA347F, 
-0x62D1F2EBDAB1F3B9, 0xB17DA9BA3D64F7B5, 0xFCA40BFBEA967594, 0x3335CFCE3A4FFCCC, 
-0x8C3EBA7C2211199E, 0x9EBE17D030988C1C, 0x27A331FE51E84D, 0x1B117D99AA8D33, 
-0x8B6A85E2FEB4C9A1, 0x1C8385049F73E63D, 0x65BE7FC56C961DA5, 0xF38FECEB227BB791, 
-0xC9D6B4DD0AA5F97F, 0x2B2F03422807E17F, 0x5B2E03FA35F04B37, 0x32C802DAC3129B, 
-0x8A459636AB042B93, 0x74155C0466162B64, 0x4B358CBEE8F52185, 0x59526C0B4509A556, 
-0xE659D33C0DFE3088, 0xC2F6413270588753, 0x67041C3C637DA95E, 0x18604658DA5051, 
-0x3CC33EF2695BDF91, 0x643126F876612F05, 0x7543070E47B87237, 0x1863916C0B4D213A, 
-0xF7B97FD152F7FCE, 0xA3DBBA475B64486D, 0x756F8483EECEBD8C, 0x1FEB4A65CE81CB, 
-0x99B962F84815E70E, 0xEDAD99C8C744E109, 0x2137ACEC8C2016E6, 0x92823D94071E0AB3, 
-0x9A5DC381AC3D1945, 0xFF9347EAAB507746, 0xE6E26714FEB60D02, 0x2DE9E749388687, 
-0x7B576E2CBA8028F4, 0x2FB8EC9D328DFC5, 0x6E213C8B5856462E, 0xD01C855737C670F7, 
-0xF7E24D65030B4, 0x8CD6794651B8BEE0, 0x450DA019113768C0, 0x101260FBA2E43C, 
-0xEA669BD27A7E7BA7, 0xECE4F90FCC26EE58, 0x52C455C7D4AE2082, 0x1BB4C2687F9411C8, 
-0x6F4404DB0B0CC7C, 0xCC431410689FC680, 0xC85A43864C2AFDD8, 0x2FCB65893821C5, 
-0xEB8C6287B88793B4, 0xA17C9CDBA819DA64, 0xC80AA6C12BC008DA, 0xCC45CC09203FA38F, 
-0x21E13B8F8597E290, 0x30C6FC09D2242042, 0xA5AE02CAA27E8C5C, 0x3367D189D259FF, 
-0x5CCC269873BEC13E, 0x1B504DA2A33D2825, 0xD565AF851F517C7E, 0x257533E41B6ED468, 
-0xC594AA4B01BC2215, 0x3B0FF1AF0FF7F378, 0xBEC7AE26371D41CF, 0x2EDBEACEFEB9E, 
-0x69BFAD19190DF3CB, 0xA4F5CCAC0773B334, 0x295C438F7D1675A6, 0x2B7D506A5D7DA457, 
-0xCC3FFE505D16A3EB, 0x59CF4BFAF225D634, 0x52C289D0FF7D3D4B, 0x2E58C1409B8557, 
-0x8B3A5E6983E78136, 0xA4AF23B0198A2C92, 0xB52D8BB300009947, 0x27A8220C5AEB01E3, 
-0xA5CB8EA2C9EDCDAA, 0x69269568B3F1AF72, 0x15458DD8F47C2EB5, 0x25F1392492C842, 
-0xF349E0B200CD55F9, 0xD23F5EB77B50A16F, 0x2E0C74AEA5F7112, 0x2A9DC357EBBCEC9E, 
-0x2FE8F1B399CCFB75, 0xA7FC30C183EE986D, 0x31395CC72C0059BD, 0x3CFDF7CE90504E, 
-0x1EAAA431CED14213, 0x5484384D4CF6EE23, 0xA1510BDA83B54C57, 0x3D43142DF07BE2CC, 
-0x76892FC9101B3A6D, 0x7249645164B06663, 0x106AB04E35BAD81A, 0x1B578E0B80B3BB, 
-0xB239F803A916EEB1, 0x3432544A9390F14E, 0xAA843628CC0B4D7C, 0x7EB411FB918F34CD, 
-0x9C9B935D803AD916, 0x1908698D801871BD, 0x34E6036CB15150BA, 0x1448151E73870E, 
-0x934BF00DAC94112A, 0x55209E7F113A0275, 0x302048360A487B50, 0xB5957C48ADCD5DBE, 
-0x486247ADC736F655, 0x6EDA684266960FA6, 0xC2980D8D9464533, 0x39C19D54E526A7, 
-0x49E4842CCAE70980, 0xAE89228D0EE38365, 0x16DC0E5C20821D3, 0x54265619F7869A76, 
-0x7C97BF3CFA5C0A2F, 0x1F2A86038DBB9F73, 0xD5987CBB6FBC3982, 0x1757A127797752, 
-0x216DAFDD0D207E4B, 0x8330EAB8649C6726, 0xCD7749BC248C0022, 0xE7BBC5CB077AEFE6, 
-0xEA93C453B69F1D60, 0x459FFE7CF74BF23C, 0x651CB5ACE33CAC45, 0x1BDB57153D6654, 
-0xB559DED8824DF2B1, 0xF30E2A2565E9839, 0xE3BE19210DA89DE8, 0xCEA6E544A5ADCECE, 
-0x8735F384AAE1A263, 0x55C57BF58DA6AF8, 0x1E1E765D20687E79, 0x1ECE0CBB134E7, 
-0x81874F9189BABBAC, 0x1D07E58FB7403BC6, 0x30784DAC183C7D56, 0xEAE153421EF69278, 
-0xCA22686EA86174A, 0x761FB718BA3BD586, 0x3778D38FCFB8A47E, 0x3A7AEEC5CD7A82, 
-0xCBAE013D19E3EB14, 0x1B9C9D704082D22F, 0xE068081B87C1C5AC, 0xE5F355F4625D7B35, 
-0xC6B1216AC1DE1EA1, 0xE72CE450E95E84E5, 0xC850A375DE829D94, 0x3CB35CD975FD0A, 
-0x1BCD923F6AE6C7C5, 0x99EA7BE0A7AB82F7, 0xBDB1BD2D85CF04FE, 0x123ECF75AE4CB0A9, 
-0x676BADA261CDB58B, 0x7CA538A7E5604680, 0x70D37D4ED6C09215, 0x18F2AD940EB411, 
-0x97C51DFB727C6205, 0xAEAFBCAAA02AA800, 0xD47754711FB76423, 0x1C11E59576C4E615, 
-0x4F4EB8BC8DD582D9, 0x2489D25758AAA190, 0xBBB8E009DAD9AEFC, 0x228E5E4330FCAF, 
-0x21FEC562B04FABA6, 0x756DC88881F6139C, 0x2FC362AF35A97BC9, 0xE8CBC8D7E5969ED1, 
-0x6E9714CCCBB66A13, 0xE883BC62F1CC1B4B, 0x1A03B145C6F2E4AD, 0x5F4697EADBD44, 
-0xCD8C19FF83129122, 0x98154B9DDBC0F90D, 0xA5A60DF368CAACA3, 0x610E2D42CC03F527, 
-0xBE2763FBE52525B5, 0xA0B782EFBC514DB5, 0xADCD37A99872187E, 0x31A1FBF5553BAF, 
-0xD3C8BEC669FD3D92, 0x160507F112F51E4A, 0x6163D6FC9C69BE52, 0x92A4B2454BAB05AB, 
-0x95C90296C5C258F3, 0xABA32ACDB5186F4D, 0xDA681711CF4702C2, 0x330466AA957723, 
-0xEC13E3D69328BF9B, 0xF73812A7C31A6A64, 0x7BF7460A2E92FB75, 0x3579F3A26274F327, 
-0x94505501629DA2FC, 0x270B8D1D5D047AB1, 0x411D3516473DA6EB, 0x167E091326DB8D, 
-0xD9D2BDFA5A1067A3, 0xF7780C7A17C441E2, 0xCF755123470C31F1, 0x3407CAC0EB6BFCAB, 
-0xE6C41684FE6AE364, 0xC460414D14248356, 0x51D8C4F10B1050F8, 0x1D9C6610DBDF6B, 
-0x29D6BD6C92AA2CAD, 0x2B4E8D508F6A6ADF, 0xBF692B23C10B17EB, 0xE867898CDB8E835D, 
-0xE818EF535E43D623, 0xBA84B74FBC5C42BF, 0x19000E07E0DF2174, 0x20326C56773102, 
-0x454CAB3EF66B8FB3, 0xA8D4787F370B96D, 0xAE6CE7B711236347, 0x8D588B640FA3D444, 
-0xE7C14B267291B37, 0x46CFF9699C943506, 0xB2422BE51C8CCA38, 0x4BB47481226E7, 
-0x47B83E230FDF71B5, 0x75B1FD509212B2A7, 0xB77D8EBE0EE8E4EF, 0x31C24FA85CF2B97F, 
-0xB0262C4B584350DA, 0x93563FB9242042DA, 0x99CD56AB67D6F699, 0x31766C835748EB, 
-0xEB200E601624C04A, 0x7D8189836813F421, 0x8E1A5F20C21D9456, 0x1B532D51CF3E11BC, 
-0xB5DE2F76D4FAF8C3, 0x1FDC53E4FB04D75A, 0x349302E8F6DC0DB4, 0x6B93859C9C52D, 
-0xDF821ABC43C5C7D7, 0x6239C551442260F3, 0x1EF29311B31912DF, 0x3815814483F49E3D, 
-0x38AFBE61AC6E6ADF, 0xD6875672C745E7B8, 0xD8E32DAA544013B6, 0x2BC3124163E61, 
-0xF8E3E9529E18D683, 0x269D14AA9694DDF3, 0xCFB5F307A1D7505F, 0xE56FD178A9EA9223, 
-0x32137313AD9EE39A, 0xA7881B9A888F7012, 0xF3D0C56EDA0B0B1F, 0x2B4B016779074B, 
-0x5AEF835F53CE2F88, 0x361FE40771509630, 0x1559B6C6DCB0DA4, 0xE1775135D41CCA37, 
-0x8C483FFAD2C32B7C, 0xDCEC39A3F9A06FC4, 0xC5660A87BEB8224B, 0x68124C8185F3, 
-0x51E4AE9F8FA05E0E, 0xBC1235F3A6F82D31, 0xAB3F0D6F17C09B62, 0x39C29E84660E254F, 
-0xF425666EF9A1CFE9, 0x72C9A19F61D68404, 0x6D968E6F5C0ED151, 0x65576439F7538, 
-0x96F9270C22BA998E, 0x9EA9ED0F275FB6D9, 0xC6E8C94C3FCE5876, 0xC38B558398AAD1BC, 
-0x9F13BEC40317734, 0x181B95DCC1B36CE5, 0x9F88F0E66B40CC50, 0xB103AE1E1A348, 
-0x6F5FCD4D8B853B53, 0xAA909D3431BECFD2, 0xD44EFABEE75E30C8, 0x3E5568BE69CBA57, 
-0x5A8319DE24144E13, 0x57AFE65AE4B36A3F, 0x2F73442BDD4E84B3, 0x3DDD172787BEEF, 
-0xF8CFD979AD6D258A, 0xEDEE19E6FE806E93, 0x1C735E89A180B2F8, 0x4149E4609544B24F, 
-0x758357D6A6018E89, 0x7C9246D4CECFD221, 0xC8A962B3D9C97C86, 0x32F6DD1D9E5B65, 
-0xF7C5F605897DB630, 0xBD007EAAB5974D2A, 0xD9422E413ED1FD46, 0xA41F809F350A824D, 
-0x6DBFD6852229395A, 0x6FECF76818E6486E, 0xB4663AADDEAE75DC, 0x2E45F491D324AE, 
-0x6619BBD56DBD6E76, 0x97BD9FB44795BC56, 0x1237A1CE54B8F045, 0xBEEDF3622202BC4B, 
-0x40DD01078DBD2EC4, 0xE6ED4111BA63C995, 0x9EAB11AD07D457B4, 0x3F877529402E7A, 
-0x12513AD413C2329D, 0xD304DE6D1AAAF4DB, 0x9E8E9C5F4AE669E5, 0x5FF13964255FF579, 
-0xF7334615814E3BE8, 0xB47FE726D5ACB60A, 0x7D16EBBD3CFE0140, 0x37BB15D6329E08, 
-0x9020524360D06C9B, 0x160867207A3C97FE, 0xB76C81EA146AFE62, 0xBE2272F72647F87E, 
-0xDE7E3CBE558708D8, 0x8B0A99DCBD399FEA, 0x257FC85996C90CA3, 0x2B52EC23761A87, 
-0x691731558C0B7A2C, 0xC78EEF7ABC86220D, 0xD1CAF994E3E6EF11, 0xFA6171115FF2CA49, 
-0x3D01CC1D41CCEF62, 0x4EDCDA02DBD41FCC, 0x819E745D4BC60A9B, 0xB73C07B9563E8, 
-0x8193335F929D26BD, 0x7DD2DA0E7AC3F6D0, 0xF7EBBA0A6120470A, 0xC59572B64E37E13C, 
-0xF1EB40D99DA4BFB3, 0x3DF6397E4ACC4085, 0x99102C8FDEA2BF69, 0x29ADEB52E74314, 
-0x2A4EAF6D494EF602, 0x9595B0E6A559A11C, 0xB4F8F2F90C596CC5, 0x671DF87DDEA7C777, 
-0x8AA76F6C5696D599, 0x4CB82935F2D01A7B, 0xE0A9CDFD714C1C4B, 0x391E97885B46CE, 
-0xE5D7640C3B8BC99A, 0x9C7968DBEC9AE369, 0x9F51A28348D5B249, 0xB74F2B5CBAB827D7, 
-0x6BF2C53F9FD1ECD9, 0x76B27F280904D502, 0xA826361465AF2CC7, 0x2DB0CA80C528DA, 
-0xD1C2780653998329, 0xA7F160F61EB53B23, 0xC1F72EE8D54C120F, 0xEC5877FFB914D7A7, 
-0xAE9471B98710F75C, 0xF3DF319087BBE665, 0xE27F41FD6E119000, 0x245ECDAD95858, 
-0xC26D9EEA4E15A764, 0xC4A5A8037E3BD382, 0xF46F70FB4CA614A7, 0x715DD65057427164, 
-0x907F4B6A1329217D, 0xBC5622CC0DF60B4D, 0x1F87D4CD84C7649A, 0x3425796BCD44C1, 
-0xDCF149C13CE4958B, 0x50D29FEBA1BC9568, 0x39AA9B09CA6904ED, 0xCD5CF49BBF0339FF, 
-0x553FE262F4B1A4D4, 0xABD8F53743C4259E, 0xEC7592E1A17D14, 0x82719D0D72006, 
-0xC046D5272BC887BE, 0x64725F9737FDB31F, 0x9EF37F2A947C9605, 0xA6067BD3085AB3ED, 
-0x749909C729114CFD, 0x2306F81978835BCE, 0x72D59C8A330F79CF, 0x3DC42AE5E1E3AC, 
-0xF17BC1380BD444DE, 0xA59CDE6D7B18DE8A, 0x946CC6B2AF2127B9, 0x716D8AD11CC084E3, 
-0xF4F382F31DF18944, 0xB4E9A15A43050165, 0x6084C32295B8EFA7, 0x3FE07EC4B71BC8, 
-0xD031E928B820155B, 0x4395D43EA1D5F99F, 0x42FD0ED68B5156D4, 0x31E4A45E9A7D414F, 
-0x28505ACEDC323C4E, 0x67A79A16751288ED, 0x609F9E41A296BDCD, 0x35E42EE5DAA184, 
-0xCD664D8874E06D89, 0xD81CD697B521A188, 0x360659F29198C5AB, 0x9E8DF1DAC484C034, 
-0x8C286F1E21FB2193, 0x53B27E87ED57C70A, 0xFA01C182A44357BE, 0x34D43A6D620734, 
-0x5D44820105226959, 0x840B05E1BDD8B8A0, 0xFC1EBC3178AE5B03, 0x849E014973946E67, 
-0x74D74A50C1A3CFCC, 0x407C36E15411853E, 0x55E5A9F776C292C0, 0x36BF410203DF1A, 
-0xE9343DD0A903876, 0x33B25417BE058C2F, 0xD1AFCBE76A7393E7, 0xECEF9582C877398A, 
-0x653ED01923B99E9C, 0xECBC10C11BF1A07D, 0x8B438105912625D5, 0xFE54C8A893734, 
-0x22361E6186C89C45, 0xB51BE1B63CFDAC74, 0xC2698F53ACAB4A4A, 0xD905AF30B75897A8, 
-0xFB44319989DA67F3, 0x3EBC537C46D24AC8, 0x79C019836C11D900, 0xD1D5FF118637A, 
-0xA7F1BD9E73F1A5AF, 0x30CBA20663E4ED4C, 0x85523E0EC6C3D1, 0x7DA59783C927A46C, 
-0x74DFE180669B7AF6, 0x3F135C1DBBF274FD, 0xB8C341F51C6C185B, 0x993E9C0286C27, 
-0x48A67CEA439A382B, 0x6470383B9C80BE60, 0x1DED6D75C9CFF3A2, 0x1C2BE2B85A224FD0, 
-0xDCF82B30ABD71142, 0x495C5A8F860061A6, 0x836FAA6A9A445F46, 0x3E371E4B7AF701, 
-0xEC6389468D621793, 0x61C087F9FE1B5EFA, 0x6F6F0B276414E0B2, 0x55806E64D69E01A3, 
-0x1DD392E7941211D8, 0x8C5EB8E3E60C3698, 0xA117A5E6FE0D860F, 0x1AC43F0681C5F, 
-0x6A31FCB0C06A17E9, 0xDC1CFE1E96B91EE2, 0x8B5577D95CE54204, 0xDE596B3E1B5A50F3, 
-0xF8F6653B5100E614, 0x831992FE07E63EDF, 0xA7B0AFC791DB664E, 0x1F54A8AD1067C0, 
-0x84BFC08E27DD8777, 0x361B5C2C84EF4FC8, 0x4CB78A0458C50231, 0x78C6BD938A7D97A0, 
-0xB189F85409531B, 0xD22C33FA99DB9103, 0xB00A9DEE046A30E7, 0x36088EFE592A8E, 
-0xF17DC275702A38A, 0x9F36CBC656D5ACBA, 0x2753279A7B9C237B, 0x85FCE40DF527B5A1, 
-0xBD91A40134ABF946, 0x2EE12185B64C20D4, 0x4C1DC78ECA9AD290, 0x31A778EAE7EF59, 
-0xDD234D2BA92AADA1, 0x56304ECFB4D55545, 0x45BFEE76FDC66071, 0xDA44D85456D7D8D1, 
-0xB458F52FAC08F551, 0x84349A257F17BC13, 0x1D8600E1012A5FEF, 0x1778FD641A8D99, 
-0x9A8500C32BD2DEB2, 0x4188628073C47082, 0x9F280928D242AB2A, 0x742360203BF02467, 
-0x849347D7505B56D3, 0x2B2E31331788D627, 0xAE8453DC2FD8571A, 0x2F76F57FD57487, 
-0xE800188203343219, 0xA03408D0C694FBCE, 0xBA4DD41C3E6D189, 0x49A63C815DAB405E, 
-0x1597A6D91394D5D2, 0x20A49971BAD55101, 0x8FBC25A76F9D42AA, 0x214F5714599E17, 
-0xE461C284A5C29F3E, 0x825C24C6EDFFF386, 0x91FA457D03FC669F, 0x65ACE2F985C860CE, 
-0x401E717CF5F3E4BA, 0x37AC68767C80F060, 0x5ACBFE5608B31B08, 0x5FE3AAD7FC938, 
-0x75735D41C399761A, 0x9699E01AF9C91291, 0x4C43A0DCC1E00C48, 0x715F2157A187877E, 
-0xCB172DF3B5B9C34C, 0xD410CEDBEDBCECCB, 0xA721E87ECA6B5240, 0x10E2E7DBA124C8, 
-0xC626F4B5C8854BFF, 0x820BFED366FFF406, 0x2B758A75B56A2202, 0x2B56983A3269FEA6, 
-0xEB827A25DC4DA5BD, 0x533151A891E3F345, 0x90AAF2DE02A630FC, 0x33DFE14F9887C7, 
-0xD956452549CBA2D2, 0x472C79D501897527, 0x8AA37E8FC354585F, 0x5EF905EAEBC225C, 
-0xA8FFF37E4AE7FD4, 0x843E62A5694A0283, 0x3545EC96A1F46226, 0x319857DE4AF8F8, 
-0xA75C434D9C23F5CB, 0xC4AAC86892E7FE6F, 0x68C270662219EC7, 0xE5F5282DB8FC718C, 
-0x5B4E6591572FF6C2, 0x185A29DCC6EBDEED, 0x7BE2551696737D16, 0x3D2F27519C079E, 
-0x7DDBE360F4695AAE, 0xEBE036E24E531B9E, 0x88E85361167EE373, 0xA7AE3ECCF8C262D5, 
-0x8BEEB11B01F6D36B, 0xE281F9050E5FFA2E, 0xE2F6B422F05DBB51, 0x38F221CC61691A, 
-0xE348D84DE29DA92B, 0x2B3625A6C818E5B3, 0xB9FA33FBB7C206FF, 0x7117B9C57C491965, 
-0xD6FFFF4650F14A77, 0x54967D6099076244, 0x350F35F536ACF5BF, 0x21512FB4F8F044, 
-0xF93F47EA199D0317, 0x1C110CB7CB269EED, 0xC4DE980128A3B3DB, 0xE7E9DAD0D9C9667E, 
-0x7728021EDA5A20B0, 0x722D8C266608FC14, 0xB692EEF9068C8B2E, 0x37DF770E0117D3, 
-0x1C0F5B8484C02D2A, 0x16DADCCDDCC7446C, 0x852CDADBCBE0A0E0, 0x6276A0A605426315, 
-0xADBAA546DD0E2457, 0x57761B53BDCBF019, 0xDF1C29DCBD72274D, 0x3F852C02B42DFB, 
-0x5FE741A3EAC0ED6D, 0xC506397F3BBDE7B2, 0x85CB8675E379105C, 0xD99FE48CC5E0EC42, 
-0x6EA6DCDD064EEF6A, 0xAD394983796AF892, 0xB1E641A467F28707, 0x14163499C73525, 
-0x40E3F9FCF85F9F65, 0xBA4F4F4CDCC5CD27, 0x325CD276DF8284A0, 0x4C46EB81506BEDEF, 
-0x6C488EE5F23445FA, 0x93E5629D1AD3CA1C, 0xE0AE905E532F9330, 0x34F69A729D4F5F, 
-0x4449A5401ED55D5C, 0x906AD19B53FDD3CF, 0xAE8F4AB6CE9C2E34, 0x650B438C2E60B01E, 
-0x9E2FB6C0ABC50F20, 0xD8DC950D469DE06F, 0xC69670D7382096A3, 0x3AF800C0BEEFC1, 
-0x82F28D227FB8DC2, 0x460BCB5246D316F9, 0xF05A8A6EC57A4493, 0x7ACDD89EBA6925D5, 
-0xE63B1EC564BF21C5, 0x55745A2547C7F41A, 0xFDD1044AAA8823A6, 0x6E5F0C97B7799, 
-0x8EB97CB1E524E70, 0xF5263D2045C1A17D, 0xC7183CF9AB49B70C, 0xD25223D4C7BBB13C, 
-0x7823A9EC22AD35D4, 0x460D94C8FC0DF5D1, 0x7EBE88771F3E86B2, 0x1862B5C49E92C8, 
-0x30F8DF6D41018F28, 0x4E0292547EF80F46, 0x536DA484D8539842, 0x235B343C0E58CB10, 
-0xB7958C5E15CDB1B1, 0xABC3B6B3E343B0C4, 0x9F7882C62A157A44, 0x2255EFA19F9621, 
-0x54870D52D52C6A32, 0xE3A9776E9C12DD05, 0xBB733B7F7CE9EB2E, 0x2CC052397A6656B3, 
-0xC675ADA8793F455C, 0xEA17CAD440D91B65, 0x9404558121E8BD12, 0x3C5F27D9FBF633, 
-0xA9F460457BD873CE, 0x242AC98AB055DF59, 0x5A070BB9F7609B80, 0x84F4DCB06D8F8FDF, 
-0x25D2062FC1ED5BE8, 0xD8762F1290B9C8ED, 0x9EA653DBF3909FD5, 0x2FAA9532DA3E2D, 
-0x514229239B6C2F9A, 0x634C8C95BF106706, 0x5C8CF5DFFB3FA956, 0x2D0233D26D571212, 
-0x3B0187535A875B01, 0x447695C7D2070385, 0xAD8BAB8A97550307, 0x3DBC15CEFB8BE6, 
-0xBBACDFF11AB96AAF, 0xDBAD836821B8A07, 0xDF8B10DBCACADB23, 0xC20C2BD038034658, 
-0x9266A3851062AEDB, 0x1409897B7E6A47A9, 0xB191393D2A106839, 0x47C1360410948, 
-0xF0C70BC7046C1114, 0x8F841655AECE2F3E, 0x2028365D7CB702F0, 0xF6119A0333B5C8CE, 
-0x618A85572CAD0914, 0x63632AE6B33072BA, 0x47B099A6CB4E3865, 0x297B7893425DF4, 
-0x3DB66F2A96E96475, 0x1E62476925BA67C9, 0x1BB17650844C993B, 0x9E20C1B94A6FE377, 
-0x659E1B6765DB1815, 0xFCD022C4B8621823, 0x54A0E8CE880C92BD, 0x13D461ADAA2B8, 
-0xA58A1B0854C1637A, 0x9F935D57C906101D, 0x23A7CD5071ADB7F0, 0x4A60D7146DCF807D, 
-0xB8C61DC5A83D7541, 0x76D81DB10F918670, 0xBE2A9BADF6739013, 0x337B270F994AF3, 
-0x22FC52DB36D45E6B, 0xFE90E8A95085405A, 0xD346909867568402, 0x5F499D15356CC2B5, 
-0x542A80D2CD63AD8A, 0x31E84EEB2F7CA83, 0xCC4545A2CF007EEA, 0x33AC6E28AFFA55, 
-0xF838307A9484F20E, 0xAF7981A980F41957, 0x458E43466E889E24, 0x5A2CF3BAC8F8356, 
-0x9B1640F6EC7EF753, 0x6E7342FA89284B86, 0x609F3B05F3B1D6C9, 0xA40CAB3C5B8FA, 
-0x8D06C69EB83AD8C4, 0x4D1D13E907F189D4, 0xA861F6BDE7CCE09F, 0xDD638EC2BF43DF20, 
-0xA9C6682EEFB4F25F, 0x13D26EE365B77A94, 0xD263B1B58BFB037F, 0x34AF8D9D85B2B5, 
-0x5AE6AB579942265, 0xE630338B17B299B0, 0xAAD6FDC2655C63FD, 0x142A47CBAFC22D32, 
-0x62EDE09A01780EC6, 0x2159DE3C1A706893, 0xC45757C024965413, 0x332D7D3BC52E8A, 
-0xDC1B9A75E8FAD574, 0x1A127BD816877FB8, 0x1FBBAC68E06C5FA7, 0x202052C8F593C6A0, 
-0xB6E8CFEC261083CB, 0x9E523EDB46053796, 0x8D4B6B238E75789A, 0x237778B0FDAB6, 
-0x3C9A2781049A8618, 0x5C9B50D5AA87B2C1, 0xD59CDDE36645CCD5, 0x8D4D9DACAB7B840D, 
-0x86C3932B04C65C08, 0xAD6F5FDE47180E4E, 0x3EFA9628BD0FFC6B, 0x3AADCE1E2BBABE, 
-0x3F8BD4FA61706F85, 0xD89E7E8F81C88F57, 0x1F8DBB90C791A6EC, 0x11002843AE0A8DBE, 
-0xED43AF2FB515130, 0x7CD80B323A9E81, 0x918EA9C710B38A1A, 0x1785F84C1E3250, 
-0x9259E5A11B6042E, 0xDE2FAD1783CD3B43, 0x5C887B82B69D1FB, 0xFA75E42B5678E3F, 
-0x359DA41D30605E5B, 0x48FA9053756222D9, 0x6AFBBDC2D695F423, 0xE291EFFDD5E8E, 
-0x15CB7577F91A1AED, 0xCAB2D5B2FF953BC3, 0xAC56CB4BC1B8CA2A, 0x5F3D3DF2F37B326B, 
-0x6849428A4BD2839A, 0x9232AEC85614A329, 0x4B8A43646B08A2DB, 0x2049863ABA89C3, 
-0x3B8E874A6901A031, 0xADF1CF02B97E4C7F, 0x4B4C8798FCE80C43, 0x5ED1FEF246748739, 
-0xA7EA2778B6ADC0DE, 0x53908D99D5386321, 0xECDB891A0072DB46, 0x3EA170E0847137, 
-0xC88B4C03B9B35B37, 0x262354425567B94F, 0xFED818B57FFDF656, 0x6D07BB6760CDF9, 
-0x58C136A64B1CAC15, 0xDD225BDF98B2BF25, 0x6ED44B13534B9199, 0xA951F91225257, 
-0x898C6AAEE8600D47, 0xD813695300E3A83, 0xB895ED032240442C, 0x3DC2F3F4ADDDE2E2, 
-0x3FFB9E749E6133AE, 0x8074B90A868CCF1C, 0x9AE95A5222B81F1D, 0x29E6D63D834E6, 
-0xB7C64114EC6F18BD, 0x65E4E9F15C7082EA, 0x2FA4F55C26A4D5DB, 0xD237CDCA55162793, 
-0xE0DC8B72583D6BCD, 0x9F0296C7B11CBD40, 0x669887C5986DF5E2, 0x1A9328C96A4554, 
-0x64439D2C8406E257, 0xE62B502D6ACBCA84, 0x723E28B62C13B9F2, 0x141DF9527C62F529, 
-0xC9048F889AC809BC, 0xFD5B3A0F6C059505, 0xF2B869100A7C42A3, 0x12131E44F48021, 
-0x7C23157676E6CF62, 0x90DA15BDFD7F4840, 0x3FCF1868A285B4A9, 0xA7503473949609DB, 
-0x21771840780C5F5A, 0x4160C8E43D40543C, 0x12BAC44BA015CB03, 0x36E1A8D19CEB02, 
-0xCE5E0C7BAB65A9B3, 0xC051A5CE5DC1F1D6, 0x2A1310487732310A, 0x24C20B98C5CC20B0, 
-0xEA205ECAE711AD11, 0x23F058EDE1F3D740, 0xB6EDBE3DB9EBDE1D, 0xF63A6F2B77BDE, 
-0x988D21A9C30C38, 0x5F143398D9A12CA2, 0xB853D86F4122014D, 0xDA4FCA12211E9B5B, 
-0x6A5571768D7A1335, 0x1AEB37926E5EAFD8, 0x84DB19F1FD5567BB, 0x36396BF59B406D, 
-0xD5DBCA6E5550E93, 0x62A87990977A7B56, 0x8A0F6906ADEE03F4, 0xF09EE1231CDCFB8A, 
-0x19FD76F2C01B59AA, 0x15DDABDD01496524, 0xCC841B3D9BDEBE73, 0x20A7E47FE95566, 
-0x425700E8925366A5, 0x64F340CD3CB05A46, 0xFED1939B53BFE184, 0x71E4177035329295, 
-0x7F5C0A321E9CDA05, 0x1C1A497E9164EAB8, 0x48FA7ADA93E6B499, 0x2B1916EFCC06C2, 
-0xE1FF5228958BB400, 0xF300CFEF81B1C95C, 0xD1205DFFF57DA0AA, 0x9EA21689375C6B48, 
-0xE90C53EFC14C4B22, 0x4A7215EA8B819A6, 0x46096C1E28CECCB3, 0xEC0B41919D888, 
-0x7946DBBBEDEA7C10, 0x5B09C8DEEA7D9E1, 0xECE893DA264EB2B3, 0xF78ED247C4C7A098, 
-0xCA0E4861D2911B2A, 0xFDB6C70CFF1B3C89, 0x6DB833EB6050B8ED, 0x2E34E8F76B4E2F, 
-0xBC4AD32E868EABCC, 0xBDE854DFA556D4D3, 0x591F9CD96B544DFF, 0xE497DAB3E3A8D389, 
-0x209634BFDB0CF5C6, 0xAE0B03F765CFDF17, 0xEA49894489896769, 0x2B42BD4E77DB8A, 
-0x20D3139D30419F0C, 0x9BFE12696D5BDFBF, 0xFFFEFAD8512C5448, 0xE532A2ED48FB432A, 
-0x844F60577211A150, 0x6050E7E060FE9D35, 0x97C5A1731AC04249, 0xFA3AA7E758434, 
-0x20862AF2CD570DB7, 0x28FBD4B5BC778A02, 0xCC26AA8BE492B06F, 0x9ED06A8C12B0DFE9, 
-0xEC46391A4F128ECA, 0xAA9914E0E0535266, 0x18B630F9722B23CF, 0x2B179055833FE, 
-0xC66F96701C7F733, 0xC213F0C1EF76F739, 0x24AD20BCC1015147, 0x30D8ACFAEEB02B2F, 
-0xA10138FF3E61699B, 0xD16579775F02CCF0, 0x1F8B61D294DCC288, 0x2789498784914A, 
-0x1262AD32FE7F6A0E, 0x3EFF7BD4FB8387F1, 0xD14F549E0040DED4, 0x5C38C34443D069DE, 
-0x81C5659BB6F81E32, 0x3843C67695A3D079, 0xC837DB8FC3B0DB22, 0x183B52DECA0D0E, 
-0xFDADABF0E511C3ED, 0x60C2DCF07A4BC082, 0xC8DE4E0D0CE7ECF2, 0x88CE1DF1276BA70A, 
-0x9DD8B41CD96DA95E, 0xBE9862519DB90571, 0xC246B7285B736383, 0x2E1BC7A8DF146F, 
-0x4646D4CB726C2C9B, 0x2C25738231A80D95, 0xE3613D18FFCC470F, 0x7AA17E932B69AC59, 
-0xF499AB85B6E0DC24, 0xAB2F031EFB8DC793, 0x9C0EE443EA390CB0, 0x299F70771F6F12, 
-0x7017226FD3D1D0BD, 0x23BD38AA4837C673, 0xD18C71DAF7B19E, 0x959288655FAC0D75, 
-0x27260C266E7A9B53, 0x385401641E4A858E, 0x4DB05CAA9C6F00B1, 0x13E3618889CCF, 
-0xB242D99F385E6D68, 0xFA5BBF8F887DE67B, 0x55A0C72F04982A, 0xB15D931D28F741EA, 
-0xA744C83668E228BE, 0x4036F729725C5DB4, 0xE94C175FCCA1061F, 0x2D09379988270B, 
-0x833E779B2CE9B391, 0xFE44A706A9C9D81A, 0x9FBAAE146583258C, 0xD1D3D6741208DBEE, 
-0x3E1A40DF542FE6C5, 0x9E6FAE8E3D965ADB, 0xE6E2A12ADAE56B18, 0x17F68C517EAB63, 
-0xAFEF4CEF5AA5F58E, 0x6747E905A3062264, 0xB959C8A87424060A, 0x8880C9C95F5AA98E, 
-0x3422D6C1FCDC0C54, 0x57875DBC9ED09048, 0xF87A03F72FFE7A32, 0xE4542805EAB42, 
-0x87357A92D68A2771, 0x1722115966C6D118, 0xB11863A28922893, 0xCA9A2FCA25DF3CB, 
-0xAC83CA438045C962, 0x4D35B0AE09BC739F, 0xB96D3AEF8444436D, 0xD630514399B3E, 
-0xF019C0F306B95619, 0xDB0A5F9E587687BF, 0xB92CD0C079812487, 0xFA07983EE51DCBC1, 
-0xF8E2C583EBED06DE, 0x5654CE1B7E7D366, 0x76EE8F46C81DB5A1, 0x2E91AEA2A43C91, 
-0xC8D28391593AEE50, 0x7B1253698278F497, 0x1069635E3B534765, 0x5630DBC522404D16, 
-0x496E11A3C32A647C, 0x2C9052BA7400C669, 0xB67F38DDD8B5355F, 0x3F225CFED9C27A, 
-0x6643709F589F4DD8, 0xD57ACEF47CD8B179, 0x548DDE50F8D8D531, 0x61E4FE196DF7E08C, 
-0x604B9B7D22CB62FC, 0x43645211D17645F, 0xC4813C561F079DF9, 0x3AA2F948245246, 
-0xF8EAE26F3DF6EA0, 0x93ADBEF3C4015448, 0xAE3D926DD00F3F75, 0x4FF98DA8DE79987F, 
-0xA3C500C1D6314DBF, 0x22446B83C0D06CD0, 0xE52711B9FE77AB18, 0x3FD7DFE608AD9D, 
-0xC9B5C9B537E50229, 0x6F76272B66629673, 0xEEC556AEAEB9A407, 0x6B075B2F757E881E, 
-0xFB0C48E3E8734EF1, 0xB5D9B5F4E466BA9, 0xB9AF58588648A9A3, 0x2D9324958AEED4, 
-0xE7756AC48AB19722, 0x87C544186C70718F, 0x26B9C38D69417565, 0xA48AC0DB5C029016, 
-0xE067E1024047B3FA, 0x3544458571E0E1AF, 0xA05D92877FFCFE23, 0x3C69B2FC03F636, 
-0x4DC0EB36B1645B1C, 0x6729FC340DD1395C, 0xCA6B7ADAFFD4B63D, 0x8D716C2B0D15E5C0, 
-0x92518E7726050CDC, 0xE459C42F28E28E3F, 0xE5E7D351564C4683, 0x34D7843270B20, 
-0x604EEB059A0147AC, 0x91790245E1EA53C, 0xC298E6047D7B0674, 0xEE1EEE1901C0199D, 
-0xDC84E0DBA4CA4CA9, 0x80F030A49FEAAAEE, 0xB98A4D48AB688745, 0x30CCB56437E9C9, 
-0x6E197161093ECE46, 0x438DBF61F31ED630, 0x36BF64EE61F47A13, 0xE4DA23B0192EDD4D, 
-0xAF87CB6141FFD446, 0xB37D61F9784B21C3, 0x7D89C884EF226156, 0x36AF7077F040D2, 
-0x818335564D444C32, 0x2BB37AC8979B0E5A, 0x273385675DF3772F, 0x327B7989E9C15CD8, 
-0xC129D2C8EEF1FAA8, 0x69DA7067E0544CAC, 0x6ECB24CCC50D61A5, 0x199D35B3EA7DB1, 
-0x4A2485FFF1611A75, 0x116D683C43AEE4C7, 0x35A210EB38BC7DFC, 0x7B94A6532F1BAEB9, 
-0x3E6C3894B094B1AB, 0xA54246C0AC9CDA0, 0xCEDEAC819EC84FBC, 0x6474D56B38048, 
-0x8E065EDC8660F14, 0xBA5169A04C45F040, 0xB02122D52C9648BE, 0x6D431D462B40660E, 
-0x872D26C15A65F983, 0x7A29C7161FE11D30, 0x7319048BB761E1F9, 0x293139AC84DF93, 
-0xAF043B54A4F100A9, 0x6967D4E90CA4C971, 0xAA01B4C0EF8851C6, 0x90A1C00B5E3F33E3, 
-0x5D858217CCBF29E2, 0xDCC102257987324D, 0x40F1BE7BCBC6D2A4, 0x13135100795D03, 
-0x517E00655F982829, 0x48D6D628D02F2B46, 0xE6A784552C503A, 0x5F4F24EBAD72263A, 
-0x9C60AB501860363C, 0x80C7E630E610AF3D, 0x8FAF2FDB503616C6, 0x38E925EE96B061, 
-0x90BEBCCCE7EA611E, 0xFA076E8A9D0AF900, 0x70BE981390263551, 0xC97B254C2D268300, 
-0x518E6B31A525133F, 0x430D969A1A272782, 0x9BCB20BC25BD9F41, 0x1389C465FA950C, 
-0x78E89952E09D3CF7, 0x5412D7EC53A5B7C6, 0x69F36785BD3B586B, 0x1B59EC8B009811D6, 
-0x892E9C3F5FD20BD3, 0x6B2D8CC4D5E2EB59, 0x5BC66FF22002A972, 0x13B5793D8C8043, 
-0x8B4724301C55C58E, 0xA5A3F9A076782DA7, 0x5360B8ADA677CB5B, 0xDDB233B83F9F353, 
-0x2BE9E43549898F9D, 0x3EA84579F89D6DAD, 0xFDB698F0939C3DA4, 0x1A501C6CEEA9AE, 
-0x84BF5B6BB34DF0B8, 0x38267780421767DF, 0xF56B7CB3B0E25AD7, 0xB65A9F400277032A, 
-0x4636717DD37FFE97, 0x792D1563F87624F5, 0x3DD4FAB359D6A9CC, 0x364043A723328F, 
-0x3652A7146772366E, 0xBE450AA4D123135C, 0xD999E3E010A3CF06, 0x8EA6EE9C8B842801, 
-0x3EE3FFCE7A7D0527, 0x7BE32455D249B898, 0x3D04555CD3E8ACB7, 0x1A2E1ACFB28554, 
-0xDF92DB1BC5DA0073, 0x861B1DE54D007129, 0x18470B897C2A4FA5, 0x5EF70AE4EF3786DB, 
-0x62E8573BBE277D90, 0x41B16E3B047A55A, 0x8C40F7A644E06B4, 0x984C6AAD97125, 
-0xFB73E3DFC1553A72, 0x18F1BF337CCE79CB, 0xD3CCFDB7E0C7A1AB, 0x83200ED82691FB30, 
-0x1C1B1A85183E61B6, 0x983DAADF8866FE67, 0xD4C95D60FF1C7A04, 0x1EE59CA6312D4E, 
-0xD1FA864ADC06EB05, 0xE742869628382DA2, 0x2F7516CDF6C7B6E1, 0x1E13837B4863626A, 
-0xF3BB6634B9A9836, 0x2DE3ED9473B17CB8, 0x1EDF7F97E008B24D, 0x11F30E5A4258F7, 
-0xBD3079CDEA99C7EA, 0xA51C042F6B5839D3, 0x4F8F12426D2D5113, 0xBDA4801CBB151F48, 
-0x1AC06FCE7177C895, 0xF045D535910838D2, 0x4C30B67E1DFD0CD, 0x27F283C62BE631, 
-0x2EC68CB27E2C5154, 0x4DCA1C93703853B9, 0x154B3B08D0A57D84, 0x4A05BE1076DD1C7, 
-0xAEFEF91EE16FC4B7, 0xF0F79DCE4939BFC, 0xDC5AB58999706C44, 0x3060B0A2FB93B1, 
-0x5324C0622D7F94F4, 0xFAC9A625B9A08D77, 0xDD75D3291F3C18B1, 0x6A5DD4D9DF8381FA, 
-0x775880483E95C705, 0x56FA00905F480933, 0x9CC288FEFF4BA339, 0x1C35A8D8DFAF00, 
-0x1449DAB57F14E350, 0xD76FC36B23D3FA8C, 0x854B7DBB5E8350F2, 0x2DAA15F11D4C9F0, 
-0x75395EEDC3A4D0F1, 0xB2DC7DF3F97F8B79, 0xF9E66A82504647D8, 0x39C4E3E54DD94A, 
-0x71D4C6FDA935723B, 0x973CF9EB0E0B63E1, 0x46CBAE5643D0232A, 0x351D623AAA946535, 
-0x67EE2BC19CCE7A3F, 0x865BC2AA88B9E695, 0xC5B1FBF423DD6AB9, 0x2C6BB95CF3FEF2, 
-0x32923C873027ADE, 0xBBA01C559A84E008, 0xAD01C79547F9CC1A, 0x106E89A63ABA4DFA, 
-0x6B4C4427F940096B, 0xF01D38461EC9280, 0x796728CE86E2D9B, 0xF9412100D2385, 
-0xDA1741C1040A6EA8, 0xE67556C8475DC842, 0xCD169CE96160916, 0x8038F814E5614058, 
-0x8EA5C211F850D593, 0xA632F9CB9B5B30A7, 0x1A01E1F59B786337, 0x35E640A8BD82D4, 
-0x13200DC4173365F5, 0x3DCDDE6E584BAD7B, 0x3BB106388E2A914F, 0x5DAB5651690F500F, 
-0xDBFC77469CA6649, 0xCC20E39590CA3788, 0xCBF19370EBBE9016, 0x24C76660DA2FC0, 
-0x518F114124591A56, 0x3EFBC90B86582EAB, 0x92AD58C73CCCE0DA, 0x9884BE0E18B0045E, 
-0x55E86890765E0267, 0x42426C26CDE3F226, 0x801C61EC1D6FA1E, 0x2C24F9C365C8F4, 
-0xBFB072911F968325, 0x2CC767287DFD2E0C, 0x81EC5D3023E1418, 0x5ED6D4C334DF5B82, 
-0x545CC5C625426700, 0x4D8CCD29B8B4CD9C, 0x1BC26D8A9B7BB413, 0x2186C0EA5FE8FD, 
-0xC27E82E9A23E958E, 0x255E36BA46008B70, 0x7F18D7E20A14534, 0x3298BC769B3C7F38, 
-0x969EC923F6A6DB49, 0x49ECCAA2C7ADBF31, 0xB61E25DA7C833615, 0x27F5122682BB14, 
-0x480D4A743DB39C25, 0x633F284BB0CE9D2A, 0x7F9590391E3AAD60, 0x369F35B68B79414B, 
-0xFDC04C8BB49E35F4, 0x7B8664235AB7E2A6, 0x543AB51FFE2C9F12, 0x24F497A7FE7B3B, 
-0x23EEFB806790198F, 0xA05654D8DD340282, 0x745E963B992213D, 0x11702C8C24AB7823, 
-0x9708E9A379A6753D, 0xBECFBF928BB277A3, 0x1DF1C4A53A5A7956, 0xA221D64EB8492, 
-0x910D19C0950FA5A5, 0x180FD208CE5184E0, 0xE06E0F099F0C6076, 0xF329726401150BA7, 
-0xF5D8F50643E656A3, 0xADB549EA653EF6E8, 0xA3E02C2E3D9985A3, 0x2F8F232344363, 
-0x62B51F14C44B91F9, 0x957E966EC10E7F6D, 0x91AADE7AC552D0B1, 0xDC99DECE5B4C362F, 
-0x78DFB4D10EAB9C85, 0x6F4E6BB844DB3F14, 0x90E464ACA19B0745, 0x26D03F8EF3CF74, 
-0x37AD830AD8814961, 0xA2BBFD76CF5246AC, 0x9F04A15FD7447E85, 0xE15A809E0DAA1E96, 
-0x72064F66CE001977, 0xF289D7BED9573DAE, 0xCC9FE6791DC8362E, 0x3F20D834E0B744, 
-0xE558ED082D0137E9, 0x9C5A7CD0628E2E29, 0xD01F60184080BF9, 0x307C6D608DCA5A6, 
-0xAD62DDA0D2A59A4E, 0xB9C88B007B5D5FDF, 0x3DC66C4D28EFFCDA, 0x2903A9A5F94F01, 
-0x565B1D0AF835F59C, 0x712763EF094C8A32, 0x3C9C312D67C1690D, 0xE57D3DFC825D6AB7, 
-0x9E466566F285A80E, 0x4868BC07D9D7B14, 0x39CA4B4057AE0AB1, 0x39979A29C0D4E8, 
-0x88388083744EE657, 0x13E4DAC613A56AEA, 0xA74501BA8EE5B755, 0x937D7A5591AF996B, 
-0xFCC29C7AFBCFAEAC, 0xB13E91D570A24038, 0x2329100C94E68BF, 0x3A4A1ED8430033, 
-0xA8F1A62D61B9C5F7, 0x9F06CFE521352E6E, 0x689AD283D1929474, 0x51B8AE7E93CB955F, 
-0xDA9E30B5A00E8A17, 0x6EC7DAFC75123EAF, 0x623DEF4BD26233FB, 0x27E693FD99AED9, 
-0xE55EFD6CA67363F6, 0x667E8F1781D7247B, 0xBED3CC178EE64916, 0xAE0DFC0DB82C41C0, 
-0x9BF2A00E34959AA2, 0x1029577E7BEF555, 0x63C952103FB7E33A, 0x110F9331CC43C9, 
-0xB7AF6BDB373C17E3, 0x57771011CE7D1F61, 0xEC6ED4D40E746CF0, 0x677134A1B780DBE, 
-0x2721F0C56B02127D, 0x54FAF98C67C26C1D, 0xC10AA605CA9AF6EA, 0x375F168033C09B, 
-0xB47207519525517F, 0xD5CC3F3D3DB497D7, 0x720D6F4890055F8F, 0xB269FBF5033F51CC, 
-0x7A4050C66494A4F, 0x2847C55076204712, 0x967A543587663DC4, 0x1A742409129697, 
-0x9B3B874A3A809E25, 0x80BC1FCB61279C45, 0xAB43EDC5617F73DE, 0x19FEEA46CBAED6DC, 
-0x762C07CD3DD9BF7F, 0x7DA2ED18F2ECF08B, 0x5B689E6FA9B3ED10, 0x1D195BA4F91610, 
-0xE3127253D258A7F, 0x835AE2383F87956, 0xAB749B1C860763B, 0x9F08FDA1C722E104, 
-0x3A9DFA5F869B8B60, 0xF882C4207FA1EBAD, 0x45AF26EA0FA83A3A, 0x1FEA5452DCA751, 
-0xC69E00D546EDF823, 0xFF5C692A14781A9E, 0x57DEE687CB328A18, 0x988A8F901B161067, 
-0xAC6743A1B6E32BD8, 0xF80DBFB4FD770133, 0xA8B6BA37DC146EC, 0x65ECF08743274, 
-0x38B38AF41F60E091, 0x5B387F22C32E2709, 0xC4418487FAA82F4F, 0x8C26E9EC16DF6F54, 
-0xB4B6C8DA60925226, 0xCDC087381C0A4227, 0x2F8AD41712C0C541, 0x3F13A97169CAB8, 
-0xEAC9E0DB308802B7, 0x1A16F5B8A918CA46, 0x602DBDB588A8FBCD, 0xF37CAEAC78434C0B, 
-0xDAF015EAB9FA8F73, 0xF042E5FE67D27DC, 0x62A6EC7657B5084E, 0x1ECC785562274A, 
-0x56FFB3785B466E33, 0x18D7BE2AB7F019F0, 0xF72C59FAF8CC4A41, 0xD4F79FCBBC3480B, 
-0xB6AA296E4867DF2E, 0xB1BA53C1182CF708, 0x549A28EA1ECADC7E, 0x33A738B6BB5CB4, 
-0xAD04409DCB0FB96C, 0x6D0D6C648623083B, 0x18087CB30F213935, 0x8D18D8EF73052585, 
-0x5A1F9A5C554DF43A, 0x86D5F1A77EBBB8AB, 0xD5DCA81E7E986D40, 0x3AFC52302FFC37, 
-0x6BFD476CA06A15B1, 0x29C91298E4503692, 0xBD91730E3D7855B5, 0xC897D70677B4DFA, 
-0x66B745BC5AAAEB2A, 0xF4F63990B7264321, 0x422E17AE4BA04F4E, 0x84E23815F7812, 
-0xC0D669B8278150C3, 0x38C28A60B97EAE0C, 0xD2D88243F6D46419, 0x5FF9E705641BECF9, 
-0x5ECE3A4B9188D82D, 0x9B1C88E4182D864B, 0x4F3692A13DB9A7F5, 0x9ED18037A56B2, 
-0xFFE0206B64885FAC, 0x4B94E922ADA5EDB9, 0x3448B88A8B7041DC, 0x2F1CCCDE7877B90D, 
-0xB47F9E7A942EDF8E, 0x5CA99BB3A6A5BEED, 0xA23AEB9C9F2C0401, 0x5AAE02119174C, 
-0x25336BC06B3481A2, 0x7E99D9DD3203BB41, 0x51886F85BC3356DA, 0x8A8419A144093146, 
-0xD1143196C757CDD7, 0x17F74B426BF04BF2, 0x9834D0227A11F81, 0x208EAA4A9A864F, 
-0x3CD441C1311872E8, 0x8F1F0236E880D7BD, 0x22A29460CF09BBE5, 0x7C28E9820075C69C, 
-0x31A5F73B381924FD, 0x60619D598E1F9BF1, 0x1672CB70C0CA5333, 0x27BFC4B40385AE, 
-0xC9BA30505D07D746, 0xE8CB40E64476B37B, 0x96F439756D0EC2FE, 0xA852E30B2B86C7A9, 
-0xBEA9DBFB9090215D, 0x23A694A2C1D7E14E, 0x202B6F68C2A836A0, 0x83A3DE1C0DC99, 
-0x1CB37B5664430C87, 0x51C862107554B667, 0xC9EE1FE4EF747CB9, 0xFE9AD5445B7E1E52, 
-0x176E0B855C1B9F4B, 0x54843D0D94A1ECC7, 0x4C36EDD5DA17D044, 0x3A21D99CF4834C, 
-0xFD44397230A4CFF9, 0xCECE75B0BB0A43CF, 0xAE61910E8B3C3CBB, 0x181D4471E2489908, 
-0x87B79A6B443CE4A0, 0xA94C10AF464D7218, 0x4ED1AB6DED04BF8F, 0x833FC8FD03922, 
-0x97532038CE89CFAA, 0xEC2EAC72BCAFACB7, 0x3D9AF1A417D1D333, 0xDBB84E7AFB6D8C8E, 
-0x698B6C2738ABF59A, 0x18DFA6EEC1766D82, 0x4B3C5A5012E9D449, 0x1CD8C6BC87F32D, 
-0x3EFCBCD1C19E730F, 0xC0B4567AE679B831, 0x86EA018D8AB73F8A, 0x281F2CD7920DA3F1, 
-0x4024F8143BE78EF7, 0xE9D097C730CDF840, 0x6000C81CF9884BEE, 0x3785C4E22B56FC, 
-0x9789124662F47E77, 0xC7DF4E2C97CC287F, 0xB5FECD312910E6F6, 0x35E3DF391752F8B, 
-0x5BBF33577397F412, 0xC2407CF629B88D80, 0x2318DCA9444EE36A, 0x2C240052D2D386, 
-0x9B6F9F47F61F6F55, 0x8E107B386A625D9E, 0x5FD707A4E2805383, 0x4B8B888C0566EBD4, 
-0x80A6E0AB7924CAA8, 0x4BA47FB859A6B8CC, 0x2A25527E2968F366, 0x1BA2570544777F, 
-0x8CCE83EFBBFF0A3, 0x888A467B64FEF15F, 0xAF0DE1AC396F04B7, 0x13AE2B5EB7679528, 
-0x3F5BBE581D2EC4C1, 0x29EC3B6FDE0580A7, 0x21888AE28EB6606B, 0xA61E792CF991C, 
-0x1E3621A31A8A92BE, 0x270B2FAD63379479, 0x3881E23DFBD671DC, 0x4DB5CE58A92EDD16, 
-0xFFCFA489F8BDE456, 0x7E2367F57FB4ABD4, 0x6A4A531C6CDF4030, 0x380A79D798AAE8, 
-0x60245F76DFF6C972, 0x9A420CFDB5C6B0E4, 0x94EA5BACF8A7DAEF, 0x8EE8AE4BDDBC98AC, 
-0xAD1B560A4A8E10B, 0xF2D772A83B20E67D, 0x91449F2B3EB6C6E6, 0x2113E8F14AFDA5, 
-0x8C2E4FE3EAAB569A, 0x4125730C1E693985, 0x4836666CA244E85C, 0xAD4C466F936CCDAA, 
-0x9AB221E67FC3BC61, 0xD9A6A1D84BBB6E4D, 0xE152AF47D55D4D75, 0x16DDEF67CF2A22, 
-0x2DD4A7816C53A2EB, 0x38988F44A96EB41A, 0x43C87807AD6D2CC2, 0xFD5F6A88688DE68A, 
-0x88C919683556B788, 0xC7D96629B6F26B23, 0xDB66426689AFDEEF, 0x3B4AE6315AB9FC, 
-0xDB6E7AE7E471CE46, 0x8DF093D6D33DEEDB, 0x7173D74724B4C1CF, 0xC0680083487FA284, 
-0xAC3E9D02CEDB6DC0, 0xD813D32FB373B950, 0x423191987FE93B63, 0x1649632424642B, 
-0x109DD2871C409A14, 0x1154A200B0D3FB55, 0x9242A59750C36AC5, 0x3B6A4E7B11A2B1C7, 
-0x10FAB3892F148D0A, 0x9AB2E83FB7A508A6, 0xA76122404B9EE147, 0x3A2AC679B66EA9, 
-0x4E68977C7BC6A2E6, 0xDAE2386270C3699B, 0xBFC14088BE82CBE4, 0x116C9CD617A9919F, 
-0xAFD59BA16DB71920, 0xCAB6CB173B0F3821, 0xF45D270EA8C0C581, 0x229522B55320CC, 
-0x4EE675E3F0D307F6, 0xBBDF8CAFD5231F53, 0xA3787B1F94EBF2EF, 0x9E6695D7BB1E1588, 
-0xB125EFFCB98B4C35, 0x9AED1445F392B57D, 0x6235C0BDDAD2210B, 0x24DA6B28F0E1DC, 
-0x56D6BCCD42351605, 0x5F08BBF217F30F4E, 0xFCED9077CD9F52FA, 0x20BAB3962FA35B21, 
-0x424A3B878C0131F1, 0x36F198135CF8CF4F, 0xE423D51E180E8CF9, 0x2C3541C8063F7E, 
-0x16EADA07D7EADABB, 0xCC6C6DA9A72BCB9C, 0xCFF1955462BF847E, 0x3646EE7870003DDF, 
-0x57039F385196D963, 0x984BF200D334DDFB, 0x46407F71890A1772, 0x1D064F739EA165, 
-0xC0F032041C80E47, 0xE408F0A903C6FD0D, 0x71188BD4B05DBE2D, 0xEA702E7D1B27777B, 
-0x862EE9A9A2F822DA, 0xFBF6F9B87CE9CEA7, 0x305DE43BEB546211, 0x26F7984BD864F0, 
-0x2CDD96ECCAAB1FC8, 0xEE3741131B7ECB10, 0xA76D0ADAA6615B37, 0x697FE0A903CA86CA, 
-0x72384D993C417CD2, 0xD55F519225773034, 0x7FE18B31F31DB694, 0x2871880B35A5E4, 
-0x3A6B1717F9C81B40, 0xF9286689138FD3C4, 0xEB703950ED3FB7CB, 0x5EFE77502AEB068F, 
-0x137798613888C460, 0x95B1AF8E2F0A2BA0, 0xBB61454750DC6426, 0x34894DFBBD01A0, 
-0x76513BD72FD56013, 0x2CD473CCC68A9495, 0x13EEB62E1EC29853, 0x99B3D00E0745D14, 
-0x37D130CE959FCA55, 0xC0B1CAF11A6BC170, 0xCCA2567E27E0AAD3, 0x39642FDC16190A, 
-0x77FC829778F00000, 0xEAF128A6D7C1DDEA, 0x6F601B912F955FD6, 0x6898B96EA0394C19, 
-0xA9DFF7C2AAEED369, 0x4399865CE49328A7, 0x3578E0F0C0EC523E, 0x311FDDC12E4086, 
-0x3EED5FE37EADFDF1, 0xC72040C9B6240C17, 0xCA650CAA5019CAF3, 0x49E71EE68053FEF2, 
-0xCE61F9E170352C5F, 0xBC3FE8931BDE81A7, 0x5FE6E1E2FD619477, 0x26C59BEDA51D44, 
-0x77745F48982ACAB4, 0x49664D93DE045B78, 0x5D7BE22421BF7CE9, 0xCE5AF3D02D35F4FF, 
-0xA1381E7F9A55469, 0xB9557B3A530F2928, 0x6FF5B7C07A173716, 0x6B423FA5598E5, 
-0x8F7B6DBD56234E34, 0x2E7C22DA566E04DA, 0x79941241C435D94C, 0x398B2BC0E678D2E0, 
-0x5C58FBCC74D1A0CD, 0x67605E8BCA3C480D, 0x7C40ADC0437058F9, 0x338C574779A302, 
-0xD24B1C4B19A8D241, 0xE6299D26FD2010AC, 0xAD75A29013173544, 0x70AAE8E16609AF2D, 
-0xCAD88FB0353BEE52, 0xA1159AAD663E5E56, 0x5A08E33AFE19B228, 0x365E3BA525BC4C, 
-0x9EFDC71A6C446990, 0x12E5F073E8DDE119, 0x496A027AA27828C2, 0x6BF45AFFA1B0B803, 
-0x3A37E744795975D7, 0xD756B21E094543C4, 0x8CE6A09128BB0EFB, 0x28D4CFCF8EBBF2, 
-0x87D26451D951B2C3, 0xCBA039CA404F1C86, 0x7816D045D9EC1151, 0xB3380CEB19E2E37F, 
-0xF64E874A70B0ED57, 0x34A6B746D9C458F9, 0x53976F21D7749450, 0x312F27D2460E1D, 
-0x63A5D0493568BD73, 0x46B5D097FF51A837, 0x73AE1F0CE2E34AB, 0xC17C99D2CCE3BD20, 
-0x1C2D2C716738179C, 0x51A5C78566FC0A5E, 0x940E09387667B7F, 0x16892F4B6B711D, 
-0xAEB4A105123360F, 0x225B432009EFDDBF, 0x12A0E09220A820C6, 0x904DA94E6E02D526, 
-0xB86FA78D6301BCD7, 0xEB27AB960151B6A4, 0x4E9E2DFCF746D0E5, 0x5B547A564B5DF, 
-0xF37B3B6E8E1C70C, 0xE9098BB8E90CC85F, 0x69C852CDB3797563, 0x6ED48DF5AB02D0DB, 
-0xA8391AB0AE407286, 0xE77B65AADC78E65D, 0xDCF45FAC7E23555D, 0x1D0FF193BC8613, 
-0x1886E6951AF38C9B, 0x80BE9746471C060C, 0xC8C665AD6F6C3AC9, 0x21FE51AC5480B05E, 
-0x8942C4229572456B, 0xB1A59AE1AF5BA363, 0x45085E840078FD43, 0x81FA84D79CF1B, 
-0xD8C00D358AECDA50, 0x4F4DA0F68A2EE5CE, 0xEC711704961B2971, 0x43C1D62536A1BE09, 
-0xE107C3709C8EC0A4, 0xAA1D71730EA37034, 0xC7814BE0DB32EB43, 0x655CAEA459A96, 
-0x70913F42860805C2, 0xE9F7096E59D9CBEE, 0xB5D7DB5BF450C492, 0x1A7D3EA9C653BC79, 
-0xBBC2AC55C55F1A51, 0xE0D1BA94C5B58CF5, 0x931BF9D19715B0F0, 0x7C447398F2CF7, 
-0xBCF03CA0837FDECC, 0x80FE0E2D99A2D896, 0x3F459D8782F47853, 0xA5196C822A340D7B, 
-0xC9A02B80E080B61C, 0x57529718BFFD4349, 0x3C8CA2E0E63388E2, 0xB2A1CED3EBF46, 
-0xBB845D0CC077F345, 0x483E2A9DA14AE306, 0x32489F669E5DC9C0, 0x51187E13CEE4A932, 
-0xB6DC43EB618329F1, 0x87D1392E3BF9FC7B, 0x8B9F266FD5BD0A11, 0x1CA33DF767D6AA, 
-0x4F1D6CFAEE9AFFFF, 0x43F5DD5B98992D4A, 0x1E93BB5972110150, 0x92DCFDB77CD5D997, 
-0x73D88095D9BC2324, 0x351E32F20BD36EE5, 0xEC6748710AB60C9C, 0x3DA9283CE9075C, 
-0x7A1F02D3FC2865F3, 0xDA6B24AD50D6FDB8, 0x9C4043C3234EFBBC, 0x664036CDDC34A1C0, 
-0xCED95B9E917794AF, 0xEA5195C8C9BEB8C8, 0xF97950B82A8BB481, 0x3C967AE4292FDA, 
-0xDEAB113F1689526E, 0x14E4225A02C5B689, 0xC525E219B5F02CC2, 0xC73E02EE4598F833, 
-0x33A7DFD80891293, 0xD0A2C0E1C28448E4, 0x7BF1401FDF39144C, 0x1BA7323047F36D, 
-0xE1AF0F753F4AE95, 0xA8E0ADE490089E10, 0xB1290E669378712D, 0x955CBA5EB3AAED68, 
-0x2CD6481A0287D674, 0xBB213A721685E651, 0x7F02DCF7DD770D5F, 0xC32883920E68A, 
-0xD01F410CB9213482, 0x24DA0D937D27D92F, 0x275F09962AE71109, 0x724C415279B94E4A, 
-0x4BB4E4A6F4291CDE, 0x7248C25789818688, 0x80CDD252111AD120, 0x72DBE58024690, 
-0x7A797F11B8B2AFCD, 0xDA50C2D7442EFEC1, 0xCE290362D78A8050, 0x5008113F9A0520D0, 
-0x38C98FFF202EB9C, 0x9607B6E15A3EBC08, 0x3CCC236DCED48A0, 0x36DF55DC7AD233, 
-0xE5FBEA59673299E1, 0x1031B4D679BD4A90, 0x3DF780B95E0BFE72, 0xC55C01FB72F68BE5, 
-0xD8792F95C754A75F, 0xC1A0E17D4322397A, 0x585C344FF092983E, 0x1ECC40CBC558AE, 
-0xDF90FB64703481EA, 0xC567E0DF26FF33D7, 0x1B432F020E2EB58D, 0xAABFBE1F62002FB2, 
-0x5A48CB35535C60C6, 0x396DC697F9DD0380, 0xDF0BC199A29256C9, 0x85A61288B79DE, 
-0x6B7DCBACE3C422D, 0xB366B76CC36C1F84, 0xCECA6DB3CCB152B8, 0x62CFFEF48329E01E, 
-0xC3A550561B88F300, 0xA647A8409B3B575A, 0x9C317043ED127051, 0x2F09CE373E9997, 
-0x768AFCE70DE0ACD2, 0x3872F4F4B51F28DA, 0xFD96B84C301EF069, 0xB9A3CF73B18D2371, 
-0x16451DDD4C835EE3, 0xCDC454F322F72515, 0x1E05E635BF3249BA, 0x233F47E435C415, 
-0xD1CC8218007FAF4F, 0x92F59D77FE623F14, 0xF0D17D169EEF8B03, 0xBFA77FA2515CF193, 
-0xB1BB28D0D6A21A89, 0xADD064AA7605E71A, 0xE2DBA7317E17441F, 0x1E3508600AA4F7, 
-0x56A43C55A9AB6229, 0x5A2EDC2F2DF60B39, 0xBC7185833B2DFF86, 0x1DF86D60FE090361, 
-0x40866B9E13C20080, 0xAE07ABF346EE4308, 0x455943F1F8CFF08E, 0x11B2478A4DDA34, 
-0x2636910A50A222AE, 0x7E5CCEE6C6AA31DD, 0xB3C2132E72F87CF5, 0x11C0904BB7B4C001, 
-0xEF2F2519B2BEA830, 0x2EA37BA6B9868BC7, 0x12194F274CD7371F, 0x3C053D09F1A97C, 
-0xF2D3BAB95B59AA55, 0x8B3ED8E5BBF66465, 0x46443F5CC268F4A7, 0x1751BB97BC734AE2, 
-0xE4C769A85BF5A104, 0x2865F17D958B504B, 0x861F876BCC5CF36B, 0x3B3479722E2E9, 
-0xC3398D9E32CDB3C0, 0xF92D0D23704A2B68, 0xCEFE8AC91211B85A, 0xE8C925CE8A1BEDFD, 
-0x66FCA8D8C1448F08, 0xE55E57C65BFA0792, 0x42C1B8D680EF97F5, 0x3F4CBD42D754D, 
-0x7E33DD9C0508B291, 0x41545A7B782DA3AD, 0xCA44CD4D9DC05018, 0xAB82D342FDE0CD9, 
-0x2C2849A7AF09C7E, 0x7376E30813305516, 0xA99240CD4551674A, 0x1787E5C590F006, 
-0xDF4B65590B8EBE23, 0x5646722359657998, 0x4BC261B3F431EBD1, 0xBA72B2D8D1C719FC, 
-0x4FF00C01242872BE, 0x155D754F4F171FCD, 0x99B3A6E87140A7F, 0x361268073D8C71, 
-0x23EE09FC38A38A94, 0x5CA2A6ED931255D4, 0x30DC9BC211ACF9CF, 0x3572C17EEE479AF0, 
-0x19C00E8695CCD385, 0x321395A672199793, 0x5782ACC8BA269A67, 0x19CF2220D606EA, 
-0x64553F4EC08238C2, 0xECA61D7F0B28179F, 0x8470FE4D24D2D635, 0x6744D9A71241B688, 
-0x6CEE519FA3CF20EF, 0x7EF696B8B65055DB, 0x238A1D6704A4290A, 0x5CEDBBB086EA4, 
-0x2F317638A12CE0A4, 0xDDDEDB57ED7A3DB5, 0xC59C818D6E0AAA69, 0xF0E4E50F1C49A7F9, 
-0xD184D85C26B771BB, 0xB8BCA9B24C0C7C0D, 0x42E8B1FFE1AA276, 0x32FD35D7B1E66, 
-0xBA8374362CDED7D0, 0xF8FF44F0AE47E84E, 0x3547AA41ACCEB952, 0xD844CEFB12551DAF, 
-0x23C7234FF03B66CC, 0xFFB39876142400EA, 0x7EFE5390CBF74897, 0x21F8C8D7DD8535, 
-0x3258C787F2B09618, 0x64683CC7C15A81EF, 0xFE09925E6C01034E, 0x14D4D74E52272327, 
-0x113E7D3ECB79AC85, 0x3C6C0C8F7531ECE5, 0xB5C2B667EDAAD9B9, 0x3675AEF65C4D5F, 
-0x65FAEC2DD9A995D5, 0x6789C70D3BA87653, 0x636B9CBFEF5626CD, 0x7C13C5897B26CA16, 
-0x5933586B00316D49, 0x4441156984111B82, 0xF82897490A361F4E, 0x6CB84100562E6, 
-0x564BA419CA8129FE, 0x416E5CCA3BEDD0B6, 0x21454BB447AF70AC, 0x645BDC5B27E2933, 
-0xEB1E5BA4A1AE1B4B, 0xE82568B52D575DEA, 0x17CBD55AFFBF3158, 0x5B70B5CD6625F, 
-0x478AFA84BE10DB2E, 0x625825A571496CD4, 0x7A9055E8C52C87F8, 0xC5444E1EC6E6F738, 
-0x8EB75D96B98CA526, 0xF70F76D10C8A6233, 0xBA1E22CAAD6D49B4, 0x2CFA1E886D0853, 
-0x6DE09FB61A9A19DE, 0xC2AAB09F07ACB7A6, 0x2515C0F72DF4F5F0, 0xC68B552B0019A955, 
-0x8598298CE974AC0F, 0xBC15D60BF55AAC1B, 0x48026A10B8A7BFBB, 0x25A1D5CCFCB687, 
-0xAEB71FA92720FBCD, 0xA22E9A2E709832C3, 0xC3029A8D5525D5F3, 0x1848BC1654060C8, 
-0x980931657D61284E, 0x7BD7BBA61FBA28C6, 0x827D9C6AE7646392, 0x3C1BA89C37F0AF, 
-0x9A4161BC3725B587, 0x58FA59878B1F04A2, 0xA48C479A9185550D, 0xE6F5C3EE69077E6B, 
-0xFB8419B35FBE3E1A, 0xECBF0E09B0A5B42D, 0x94AA5FDDE60D605D, 0x6B88ED8C6405C, 
-0x18776239173E1F93, 0xDC94E06E1882751B, 0x4D164CCAD0722B54, 0x8EB979DCDC1D799, 
-0xB78631BC957AA601, 0xBFCA4F43543486C6, 0xEE446198FD3E5161, 0xB58766BBC944D, 
-0xC4B8975A9D395F18, 0xAF25D6E45323B27D, 0x663DC535281C3B64, 0x1C68B8C80C9B2077, 
-0xD1F6060C85B7F6D8, 0xD69D18306BE780EE, 0x6BE4E7C4B775F982, 0x3CC2A1E92C1292, 
-0xEB8556EEB924D98F, 0xC3353172AD55476F, 0x876A10D6DCECCA25, 0xFAB630C3A5ED3129, 
-0xF1C0139430E3DC41, 0x84DE952C619B7CB3, 0x850FD8CF880E45AD, 0x1DFDC424DF1EFF, 
-0xF557A98493F98D20, 0xC6D026424A8E6661, 0x3F9572E113E55483, 0x2D9143649763CB4F, 
-0xF6B6AF891454E6C, 0x902D61126EA9DA75, 0x62966707F2B45021, 0x1D270AA25D39C7, 
-0x28F36CAD868FF1E5, 0x4815209B71D3666C, 0xC0AD2B911B249463, 0x1565DDAA807027AC, 
-0x5FDB93E69F4059F7, 0xE4722876734A3401, 0x709276BE43898DA1, 0x3014A79E1008BE, 
-0x46D478F19E8349B3, 0xBE6A0C7AB2E68FA9, 0xC1E6D203B73A67DC, 0xC6BD02A1282FFF7D, 
-0x7424ACA9808B0629, 0xAAA835201F0AA6DE, 0x1C48A087663A171C, 0x61A03F8F344E0, 
-0xB25498F5E544A357, 0x85EDCFA6B3734E65, 0x3B2B9C8001B4E7E6, 0xA5BAB9E7F857E73A, 
-0x428D2EA118EB8FA8, 0xBAC178D1DABC4D7F, 0xFDD8AF86BEA75EDF, 0x1124E5F32BF791, 
-0x3F700892D0C08AF, 0x2195DE84900DA9F4, 0x8AD37686C7C1F82C, 0x2CC4A6975521BDAB, 
-0x86CFCE874ABC10AC, 0x639CF5F0EE75E17C, 0xEC7AD8B6A2348776, 0x3C65668350E962, 
-0xE02245EF3EF0446E, 0xA2519734E0D616EA, 0x73E93B202AC14C96, 0x17E6F577F800F783, 
-0x9D68B1DAF6F45A46, 0xCD24155FC78DA0D, 0xE517653F3A2A65AE, 0x201AC648FCEBC9, 
-0xEDBA85BE4A9BF3D1, 0x7D06838173E821CA, 0x7D759CCEDEC93046, 0xEF824CF496F1D170, 
-0xA19423D57D118AE7, 0x3BB088FD952D36B1, 0x2A029F0C13F6B234, 0x2F0A6A309B3008, 
-0x88E60D88369EACCD, 0x5BCAA07CC895250, 0xA1958CAD24EBFDC3, 0xA51C41B3B26C40B0, 
-0xBDD5E697E1A0E080, 0x49423E35376CE441, 0x15DBCD344902BFC1, 0x238F45CF1025EA, 
-0xBF366D0EE20F7802, 0x3312F33CCBDE8A36, 0x666153EB573E9D, 0xBA81602D86C3A360, 
-0x7B3E907A813033A6, 0x6D68A08F642EE98D, 0x69912C721D2AE87C, 0xE935E8910FA57, 
-0x9382D7BBF76CF9C6, 0x918ED62CCB496EC4, 0x298EC96424B4A6D8, 0x9495CC2F2F3811B7, 
-0x290F1FEA8E57FD91, 0xA43560638B6E928E, 0xE5560EBD3BF32B7, 0x11814622A6CAE1, 
-0xAC0D05DBF786A927, 0x3C7621C18475A444, 0x99D81CC904907586, 0xC5AE4FA701778CBA, 
-0x1C66799890DDAF76, 0x7BF7638CAF733612, 0xA4AE198D26698FC4, 0x32BE973AB92A5D, 
-0x8ACD2526B9DE4857, 0x1989127BBE454DDA, 0xFDAE206BA572C52E, 0x9431A380B7A9CC25, 
-0x8701EDF5D2CA3B75, 0x991A8C8923061CBB, 0xCBA3B649461C7205, 0x2D88281DE0D3F2, 
-0x38937BDA3DA2B83E, 0xEAB2636A06B51FF5, 0x2B9DD0AAA7B3510, 0x4D011578E3F318E8, 
-0xC2A00C742ED0D7A6, 0xE6277665AF36967F, 0x78E585F448F21492, 0x33A81DCCA16EA8, 
-0xDCD9CF863272CC7B, 0x104FB1BDADAD5B6C, 0x1DA8B19384F81C66, 0x92F813DC529027F5, 
-0x8BDE6D560965AFA0, 0x6B972DF498F7A109, 0x3F47A0F16EC4B22C, 0x2E742BF20FDFA4, 
-0x94D1B42F37332550, 0xC934B42EEEA4B534, 0x34CF84DB1017831F, 0x530588879137D9DA, 
-0x9284227EA9D2539F, 0x879FD9EB44C503CC, 0x124CED33BEC92FE7, 0x3736ACB914BE6E, 
-0x110E7C3535755708, 0x471B55450D418A5E, 0x6552AB08D2ABBC65, 0x20C52DB14FE5A96A, 
-0x8E6599F15BB08FD2, 0x358FABD6487D2277, 0xDB0A49F725184C4A, 0x296EEC22506EC9, 
-0xCCDBFA5EAC4A1A71, 0xB01B71CF8A231A25, 0xCA4D7F8AF59CBD0C, 0x3CA424796AF38C22, 
-0xF5C87C8BA7F1CB6B, 0xAFC351192A53A645, 0xF5E73C3638E5C618, 0x36D7BE734506D8, 
-0x267B38A7A622A942, 0x660B5BA3881D2EF2, 0x4B8FE22DE7D69668, 0x25E66383D66A60F9, 
-0x1965FD83070ABBDA, 0x9F463F90FB5BF865, 0xF8714D20B6FBB771, 0x2722C88A4E16E, 
-0x7213C37B2FC80363, 0xD3797C8E971B3E25, 0x10653960F29F860D, 0x27D354E56EBC8D49, 
-0xD2D999D5EDE35C17, 0xFE9D90FF70D369C7, 0x67A8BE443E32C9CD, 0x7E17A129A7BD2, 
-0xE40D73C35433976A, 0xA34A630879FEB60E, 0xFDF02621AD51314E, 0x82D4DA737845A9B4, 
-0x1DD3DA07E2A9F22B, 0x408EF86A785CDA59, 0x9DA0C10595223B58, 0x2BC9703A041074, 
-0xF460827A9BD9FE1A, 0xCC1D7C413D7E3A7E, 0xB12CA7A99B534086, 0xB2AFB805A89D104E, 
-0xA57011994979F79A, 0x371DD3D08A5BB4B7, 0x9336870A6BA1F09E, 0x2C3EB59C6EECA0, 
-0xD6E4B0034D4B334C, 0x130281A81CD3CC48, 0xA78AE6FE0C51A339, 0xB734C3AD74435D7, 
-0xA7884159644A3810, 0x8DB9798DEC21517C, 0xB70B5A73FCC51512, 0x10038EF80FA130, 
-0x63ECB7C3673D3CC2, 0x1B78D61B468D05B2, 0x7751E71AC78DCCEE, 0xC496994D07875361, 
-0xAB8CEDB39D5E0431, 0x25F99256F92AFA91, 0x8E931813B3980431, 0x26A9E8E7A65D13, 
-0x262BC360E817EA6E, 0x3BBD56A42DA364CD, 0x731098BA509A3B10, 0x4F1E3D932951BF31, 
-0x43B03A48A79EC455, 0x15CC578CB399E0DF, 0x786F85ED35FA9F4, 0x36BAE3E90E1CAA, 
-0x1CAB5E35EBC82E3, 0xEB7444B04893173, 0x6A3F2554554AB473, 0x87871D68416E301F, 
-0xB12A8656201F990C, 0x2B37F391FC1724D, 0xD3EC4E2ECEEB7E01, 0x25EA56EE55BA5D, 
-0xEECFBBE7AA220CCE, 0x91747775D2C4DFAA, 0x73F7B89C05D8D9D1, 0x5CA6E595EE9235B6, 
-0x20E71AB2738CF201, 0x8BFCFFD1A6C179D1, 0x801A8C3C401DC4A0, 0x2577B406942AC, 
-0x40AE2F5DF62CC300, 0x74EE81427BB0FA22, 0x3C956AC87935C3FA, 0xDD468C6A9742CCB4, 
-0xD4A1CD4B37AE1954, 0xFF95B7B5E6A909E9, 0x410864BFA95B9CE2, 0x21F769F786A4DA, 
-0x7E3F354B6C05B979, 0x1776E96794FFBF9, 0x30648BABD2FFD3E3, 0xC3ECB69F866B926C, 
-0xC4345290B791ED51, 0xDB51D0F3BE30E3BD, 0x331F53AFE9E4AB59, 0x2D9563A7C60B7, 
-0x89AB94D8C74BE56D, 0xF6CD9F10E3F25460, 0x56781339E7ACF49D, 0xD93757BF8669758F, 
-0xEA455590CB110795, 0x5FC681C88DB1FF9B, 0x60534224E96A50FB, 0x495881CCF95C8, 
-0x8D594E524700F140, 0xCD9E5CEED939FE04, 0x5416817FC5A89076, 0xB418D387AB0B68C4, 
-0x44F9A976E6C20BE5, 0xCDFBB1FFCF70282A, 0x5884C8439F586695, 0x32251342528D0F, 
-0xD684E7F4AFAB737, 0xAE91087766BEF656, 0x9C9FD976AAB4F409, 0x11DF801665990BA8, 
-0x1665037F8A43178B, 0x2FC235B1192A737F, 0x559D6A78A87DAF79, 0x2A09FEF7306245, 
-0x80732666D09369F6, 0xEB27372C92E43165, 0x8476F8C93CFCDDFB, 0xA90566817B18264, 
-0xBEEA8B5B55E95C0C, 0xC1E36F7974994CB, 0x9C0CB9BAF37A7CB7, 0x134AABE8E4BFCF, 
-0x75418A8EEA990361, 0xBCF037C429C5A9CF, 0x4B1DC169E3F57C6F, 0x70A7288257074198, 
-0x42402A4D219DEAA0, 0xA9FDBA35193BA4F6, 0xEEB1F8A918C61C9F, 0x1C7EFE3E1E23EA, 
-0x5E074C42CA0AB55A, 0xA665C7D361E4C6AC, 0x9840F3FB1C62F5FF, 0xD49A7664AA6099A9, 
-0x5D957A681A458FBB, 0xF93A6A787E099BBC, 0xC308AE073DF423C9, 0x2AEC8BDA9B4067, 
-0x3E53FB1D1F12A228, 0x3F28BEFDD8030F6A, 0x4D38E13EEE3A452F, 0x280F38B00B09DA9D, 
-0x6A85E3207D55BE65, 0xED4B10EE8EA8396B, 0x8459CBDEE1CF7588, 0x201CDBE141FF60, 
-0xCDA40E811E4D22B, 0x36BFF03139447624, 0x541E6131DB13EBBC, 0x6E6DF7BE36B73778, 
-0x129CA1257D45C46, 0x987DF5402238D3B7, 0xE623DC7ABCE58554, 0x3B5FB1B5A09576, 
-0x5860E85793124054, 0x4E310DBA83991726, 0x333CFE8A0466BDCD, 0xE5D3ECD2593822A6, 
-0x10F569C96E6EF341, 0xB36A90D448717C43, 0x10C0E346A832802, 0x5072061357AAB, 
-0x29A8B0172E5F03FD, 0x73ECDE6C66A38947, 0x39CFD14E1A414B12, 0xABB38A8882DF5A9E, 
-0x526D7822ACC80C6C, 0x829FE44B4E9CC2E0, 0xCCE3D4C46018BB48, 0x1C3D1A106AC909, 
-0x86A0D3B575589DE9, 0x8F8FD6BD0E2DAE10, 0x6670A5CBD69CBCA5, 0xE0F76530FCAD6FC8, 
-0xEF0B7284A48A9ED1, 0xA4DA9DF2CEAF14B5, 0xF5C44A6FB2CC3C6B, 0xBA74A32400D0F, 
-0x83349A51BB99A27A, 0x8B686F994290D6CF, 0xE216CBFCA7DD72CD, 0x55DCB395D20E8DA1, 
-0x2A9F549EAE620549, 0x6F9028A9BC32AFA1, 0x99D5AFEEB4909622, 0x2823BBA9DE6877, 
-0x1E1A2932495295C4, 0x5261239F7BDF6730, 0x9486ACC38B50E329, 0x84AB61B25B3C1A1B, 
-0x85525985DE319903, 0x87A83326262129D1, 0x249CDC2C0EDD73E0, 0x1511E32EFFE4D1, 
-0x6F7C841494186E59, 0xF1C831E33E67B606, 0x39E00F6F74408CC, 0x342E63176804538A, 
-0xC5B145231014DF7E, 0x8B58B621204036DF, 0xF931332393B182A6, 0x35EEDE6BF1FE85, 
-0xB0D6AE4F449DD80A, 0x4773B885F6741745, 0x96EDAA7043329226, 0xE5ADD365254B7C59, 
-0x84047DCC98248743, 0xAC83B0033A9917EA, 0x75A0A11D212E3E78, 0x2F054D0C73C5ED, 
-0x25727750008ACE57, 0xD1993E59BB9A0E6D, 0xF22009FF61908E1B, 0xF097BEE51BDB7C1D, 
-0x53DD49E791C0F5C2, 0xD0A44B136869B249, 0x3CBEB02F773C2CF5, 0xF433DF900E303, 
-0x520352A156C4D9B, 0xFBFD642F42984F1D, 0xBC91DDD096AC62C3, 0x5F06AF772B326492, 
-0xD4AAB9D880DEDF2E, 0xA5DF2B303BC925C2, 0x4CBF75C71F17EC5E, 0x28C8453E898D1B, 
-0x2A041AC637127AA8, 0x2B815ECC718B007, 0xD9F605CA5C10AFE9, 0xF04DC8AAA9D82477, 
-0xF61FACBAA3F6907B, 0x63E8439E510F6ABC, 0x138D2DA15CF9E5A4, 0x19274F44A0DF8, 
-0x6BA6433FBF0FE0AD, 0x4B2B1617F65E5514, 0x2192403E53EA97E5, 0x533E1AEE3340651E, 
-0x470F457F3E936596, 0x373851F27405D24B, 0x282E2FEBD2D0B421, 0xD1B044B31AF88, 
-0xE21E7A874CA8E24F, 0x67B0042AFD063DD3, 0xA39BD809BB9F0986, 0xA915244EDF367A33, 
-0xB6E734BE5114B21F, 0x45D4C33BD639E509, 0x4C1DDFDFE8275398, 0xD115DD03CB1EC, 
-0x9944D7E7FDA0CAD6, 0xF515D6FE7FFC7B45, 0x8B086046203EB907, 0xC2D4D8BC52BCA998, 
-0x4390F7EDE611DC7, 0x4F0D5DD4CD0E43EE, 0x929193162CC6B0AE, 0x27C81D27DA5349, 
-0x711CCBDA596520C9, 0x168D8E450954F169, 0xF8DEE6637D2AFAFE, 0x1B1B947410BC144D, 
-0x4592BC270BD260FC, 0x622136C93AB1CF1C, 0xA3463E64B008D832, 0x1DA72B18A46930, 
-0x34106FB04A62F229, 0x7A31FCD09457C38F, 0x94BAF4721E859397, 0x7B898B4FBC829220, 
-0xF3E963BC029F9671, 0x26F8DE25A95FDFEE, 0xEA67D08E295FA535, 0x228B9B8DA567CF, 
-0xDE1FDD9E9127506B, 0x953534C4A859AF7A, 0xBDCD038D47662B96, 0xA29F018D0D15E1AE, 
-0x30D9A7B43032D7E5, 0xD1C70AFA31E0E3E, 0xB4A7A350D9AC85B, 0xB2698B9724EDC, 
-0x1FEE40C6FB3E02AD, 0xCD855BBD7E286C9F, 0xA5BF69F7A275F379, 0x129E89522800BE43, 
-0x1E13CA43516E09F8, 0xDBD08E60CF679B8A, 0x7D44CB9D93E5EB69, 0xF6FC1EC65AB57, 
-0x5F1838A150EA16C0, 0x44F801489F8A3BA, 0x7A65D67200634180, 0x39AE9B661FF2AB9A, 
-0xFAAA8CCDB3DB44CE, 0xF5642C900BD244E9, 0xB8EF09F22952090D, 0x30D8483DE12EA7, 
-0x35170CA3BC88D828, 0x6C9923552A27497F, 0x43122EDE1CD06FDB, 0xD6621034B0B490E6, 
-0xC5345E91081B91F0, 0x6AA8BD17949798F, 0xF6463D1313D6F420, 0x20021EFF91004C, 
-0x8969BC44A616066F, 0x6E3966DBAE4C2B61, 0x655D4BA97E1F9934, 0xE74616F5C1EED2B5, 
-0xA8A95A5E66225C6, 0x72F47AEDD0F948AB, 0x7D76E76745C6DF9D, 0x3429DFC72C6FFF, 
-0xFCE7FACEA02A3B99, 0xA73FD3D91EF7556D, 0xB374184B50A96F62, 0x4543A018F1C47B33, 
-0x706C9C830C6B1054, 0xC87E2207B5D28A7D, 0x7FD648BBF65C39C7, 0x1D6E28C3AC2AD9, 
-0xFB34C493CF097905, 0xA0D629CFAC520683, 0xF61D8829822F486A, 0x49046087A7295686, 
-0x5FD65EE4BDFC2DAB, 0x88C93C21E484009F, 0xA4C7A8EF1E83F4D0, 0x2C218ABA525526, 
-0xA45C8F644626CA36, 0xAEF90A4317E53799, 0x277A53D36145A4B6, 0x6CDE872243A7A89C, 
-0x48E0C1B87946D113, 0x5DA348A24CED3C47, 0xFD4D37C875A4E4E8, 0x3363BFA7F05101, 
-0xAD198D74940CF56, 0x6A341D71C7F61689, 0x36075D378563D624, 0xBE05B4E238F63F56, 
-0xAE60EBCDE894456A, 0x8A997E2BB92037EF, 0x12217D564987CD9D, 0x210DDB2A4DF2DD, 
-0x2A52C1B93F8B0027, 0x86168836280C71C8, 0x683B7B03CAF02ED1, 0xAEAAC66DA55B5E4E, 
-0xAE40AA7A2B124D72, 0x786DECF0692015BF, 0x35B21040BF9378D3, 0x3A352C16C187D4, 
-0x77BE3AC4EDD8D296, 0x3EA9C2633E9E6F95, 0xF720DDA9ABBC2BB9, 0x90FF62F1366915CF, 
-0x66C5DD97BBFEAD9D, 0xCAE52B8CDF456583, 0xF20A5ED7E9AA1CAB, 0x197FFBF26752DF, 
-0xFF80B0547BB3898C, 0xBF4C1C48A3B72BA2, 0x43765766708B51ED, 0x82943FB02AEFE135, 
-0xD581587526D7C241, 0xC8A4BB63A5A69EBB, 0x34775463857A091C, 0x39FC134C639AAC, 
-0xA8F9AF19B16CE541, 0x8EBECB586533D3D, 0xCCF3EAC42F3C2A96, 0x4E8D27A05550F281, 
-0xCC6A3F94BF581A2B, 0x926BBEB83C90F9C, 0x3A9F2793048BE93B, 0x8FDDAA3319232, 
-0x9BA99AD3D45472B, 0xDE9D5CC6EEA6997C, 0x3688E594B32D87BA, 0x5F7C05BAB42FC2F9, 
-0xE2E59D992EC9B05B, 0xFDB055932560431F, 0xB3A52ACED482F690, 0x2591A50A0B4969, 
-0x6F0C3156ADED7871, 0xC192469E402279C5, 0xADAB39BF8DCB70EB, 0x6B3B369AFE9C63AB, 
-0x853BCB4AF3A4A76, 0x14BFE771A28BE137, 0xE75748C99137061A, 0x3865F72D81280B, 
-0xB6ACD8E50433F47D, 0x72FACCF526C96855, 0x4CBD656E1D05C5EF, 0xBB936895A6CB2B4, 
-0x7643549AF840FB2B, 0x51CD5E386CB3BE34, 0x9E87B964E978B208, 0x4C3DB0392439C, 
-0x7212FB9357A2B669, 0xB45AE5FA705C8B5C, 0x2D76A00AB3DE3F6A, 0xE0012237E27420C1, 
-0xD3CFDA5A025A2ED8, 0x984D8BC7697E2531, 0xB2EC207504A1D7F9, 0x195A87C62C3036, 
-0x571679FDEBDF5C65, 0x5C76D009DE3DDD4C, 0xCF2A9DBA497E1109, 0x83097B0297609D9D, 
-0x53ECEE09BB4628A2, 0x86422F4DAAD67ABD, 0xA24FA1E161E86317, 0x18D2046907243F, 
-0xFC6E1B8E1BB4529E, 0x8C63780C8D17ECEC, 0x9A738A31D62D800F, 0x137E1782B0FDD9A3, 
-0xD88FC3AFCF6BD31, 0x64600625ED8D451, 0xB669224C15470883, 0xABBBE1E93B4AF, 
-0x35242AF4CB84BA7F, 0x5E72728E74E21C37, 0x2259DCBE4B310EB3, 0xA47766AED581FC0E, 
-0x809A027E5DD22F42, 0x71C646843C33097B, 0xE55418C37C80D247, 0xBD30A503F01D7, 
-0x4CA593109B79C8B8, 0x2714C7265F333AFF, 0x50415E9236795D51, 0xDD96A4A28C10869B, 
-0x16DAB9C2CA0B9D34, 0x19BA498BC17DE4D5, 0xA3C5EA83D12BA7C8, 0x3513B82D252A17, 
-0x56C14AAE6EB2A80F, 0x77991D5D810067D5, 0x8BB993D3EA89A66B, 0x7BC056C859EBC3D9, 
-0x75D4285F33CED114, 0x745E3BF846BA1738, 0x4A0C108DD6C56140, 0xEC779155C7FC8, 
-0x60C63406C7225904, 0x5F409087C3E2CDF9, 0x3A59176CD92F768B, 0xF225F430EC316C75, 
-0x1DC3D2F413DCEC86, 0xD6608BB33616E106, 0x4F68CDAAB1148080, 0x142AB86153D619, 
-0x23448B41E8C17321, 0xC33BF6857181CD9D, 0x71D46C03F2D8EE7E, 0x9EF17B050951C832, 
-0x4F07A1C506F07234, 0x5BFE5EEBDFDE867C, 0xC50B322C86EDF8B6, 0x166810531559CC, 
-0x2209548D913B38EF, 0x368D964183E3997C, 0xB0FEA01CDDC0276B, 0x78EDEA22B1FCAC97, 
-0xB8F80147C2CCE668, 0xD7FB764A7FEAD7CC, 0x1579BFBE2B14E3BB, 0x1A49200C7DEF43, 
-0xF3BFDF576C97C30F, 0xA63E00656BD05693, 0x49AAF0622398AD29, 0x97CE4A38B67DDFA1, 
-0xCFF45CF7799DCB68, 0xA45E07A59B7F26F0, 0x900FF2AC65082DDC, 0x304C982A639F2D, 
-0x6C54E61C4D8AFF22, 0xE499E418DF2E69E4, 0xFB374E2FE7C87A5, 0x5563403995838148, 
-0xCDC1466E7F115DA9, 0x290F0F4E7A57D03B, 0xDD9374F33546E993, 0x24183D65C3B9B7, 
-0x6D75C67576B58D64, 0x297AE9E9A931C5A0, 0x818C17051F7DAFB9, 0xCF6F833412B40734, 
-0x16BA7BBDD27D592B, 0x63D70627B2191BD2, 0xF372A8D9F15B6B3A, 0x363F8BF1B8A10D, 
-0xEDB07792337BF80D, 0x644354C86018656E, 0xB649CBA6530474DF, 0x69C2D554DDE9BF0D, 
-0xCB459BF53610682A, 0xB810DAF25688B50C, 0xC58E5B7F459602CE, 0x3F79F51F258258, 
-0x43AAD1CCE981A467, 0x4B46CACD178F0F56, 0x847139BB4D085E9, 0xAAE27CF2D515D20A, 
-0x19F7ABB41789152B, 0x9E7176F899CDA66, 0x3A407A92764A3F8C, 0x6B599CA304D42, 
-0x3C2C4BD365D12BC, 0x3A53078B6DBF1C2F, 0xC4CA46AF4BB64122, 0x60378281BD23E0BC, 
-0xCA3B4E4A36C1EFA5, 0x67A35C8F74D073D9, 0x7E26D71ABCC2E5A9, 0x392037B604BCB, 
-0xE08ED4B6C565B01F, 0x80E30F8D935CC09D, 0xC10F2BE175AF6623, 0x33228C5CAB1C1A38, 
-0x55E62B01FCFAF570, 0xCE6E19C25DA9D61D, 0x24822F4DA929EDAB, 0x2CBACCF9999D86, 
-0xA3239A6268BB0E53, 0xAC22EA0481FF3B4, 0x70B4DA35BD96B93, 0x8CD75B88162643BB, 
-0x7BA5FDDA74F840B2, 0xD0C9043506FA1F37, 0xCEB30EBBA23EA6FF, 0x51377469B489E, 
-0xE2F53D51AD51DEFE, 0xB60BDE1779E57B59, 0xF6F30D6A2CFAD4D8, 0xDC0F766F3865885B, 
-0x3B74EC9DFD96C115, 0xE8548C5BF75687E0, 0x3D81228357C91CA2, 0x38848FA8EC1C2C, 
-0x56188BDCA100C589, 0x88820D2C3B6A39B7, 0x14422058B4723D5D, 0xCD5C610A8679A7B0, 
-0x70F665AC1CC85102, 0xE6BCF9F072F834A, 0xF1397690A54844D0, 0x779A56DFBB8E2, 
-0x5CCBDF7551EE0930, 0x24A36EC4CA36B035, 0xF6E85236A8A540DE, 0x65AEBB757E9AA6E1, 
-0x699D659BD447A3B4, 0x53BE8D2FEBC5E64B, 0x18DB529B89399078, 0x14EA5A0A6AD238, 
-0xFA901CD9AD073EF3, 0x96C779AFF12A72C5, 0x15A38ADC40CF283C, 0x9733EB8F68AF7D85, 
-0x79E845DEA3860B29, 0xDFFB674C481DD4CA, 0xFBA273CD0B061ED5, 0x1752F0995CD92, 
-0x30200442CFD66DB8, 0x9C0EAE6BAE49C514, 0x7C33A3F3BBC78721, 0x70AC008944221B98, 
-0x76ED6AC60D9489BB, 0xAB0AC5EC057FA9F, 0x840B42467BD3F4ED, 0x1E084EAE9B0B72, 
-0xC1144482B1829265, 0x4302F15D0845D9, 0x40D24042BB5FE4C0, 0xC49421D16C83E4E0, 
-0xD480E7BCA4FBBC3C, 0xB14FEBADECCA279E, 0xB13D7047893C069F, 0x3F73971D7B2722, 
-0x2E69A4D7D9928FEB, 0x2F330172251715A, 0x6D5B53E9B6E9267E, 0x83B4C597C4C97135, 
-0x549BA77EA229BB9, 0x5AAFB9BD58EC5311, 0x33D4F110F9AF08DB, 0x14FBE25BF18AE5, 
-0x277F6532B6199958, 0xF5E1AD79E43FD360, 0x917E208553A33E45, 0xA259484DE4344CAA, 
-0xFC3EE867640D911A, 0x657B31AD6F040DA4, 0x560E410EA4DBDAFC, 0x28E3F8D735CC48, 
-0xA4CDFF1E52064B22, 0x399E2B41F5D164D1, 0x32B95524CC470532, 0x9684C01AD19A2A0D, 
-0x165998A02D380F89, 0x3B1C312BD527D3E1, 0x41F757F47089A2F6, 0xE2E25A970E111, 
-0xF9460FF74E76F3A, 0xD4ED74060E71954C, 0x85959DE61DB0C62B, 0xE463E1C5921BC3BF, 
-0xE815396A5E179A00, 0x9842DD302D39C02C, 0xAF783C9EE2B5F6EB, 0x20A12436AB816A, 
-0x65DC0459ADD31A22, 0x3A57EAB0FCE7245, 0xEBE3D307A618155D, 0x335D0CBCA3998797, 
-0x4E87A269E86480D4, 0x4A426B58CE0FF01E, 0xA4C4B8A244EE3EB7, 0x10AAF1F4D09A0C, 
-0x239B7ACF5AFC0EEE, 0x551CA0A622D6D72F, 0xF5205307AF40EE9A, 0x98853A93530ADA3D, 
-0x7E06C178856AA090, 0xB79B07DEB31460F5, 0x9D2415ABB98CF87E, 0x33F11D2AB19273, 
-0xDFC775B5D2FA71CF, 0x78E2A11D02DCC951, 0x257679C32727793D, 0x889B1F618AF65BAD, 
-0x2179C815C6280AF, 0x90356696635DFD8E, 0x3592F1A102F68BFA, 0x3FDBEF0AB70470, 
-0xE05BCFD22DE23218, 0x96DFFB8F98C739E5, 0xE68CAE0E6FC9AB13, 0xDE66E5BD701177C, 
-0x59372792CF7004CE, 0xAE83A4D2037D27E6, 0x1905E0A3C0C3E04C, 0x219083BDF9F0AF, 
-0xE3F10E2E22906FCF, 0x1AC048E2E9B55915, 0xF7F51CC8D34499D2, 0x207BCD02EDACDA48, 
-0x7AF274150678916, 0x38FCEB81ACF0C4D, 0x58799E938543BA27, 0x3717B7C87C491F, 
-0xAC65A773271EB2A7, 0xF5B43175BA3AF624, 0xCEF2DD7D71161A75, 0x176620DAF38D78DA, 
-0xB4830523D187CFBC, 0xE346FB6FEA14DFAD, 0x6601DF7D8F0FFB15, 0x3B0FA29DC70206, 
-0x501AFD20265E8033, 0xF0828EC3CE50633, 0x830026CB5507BEF6, 0x60261500179BCE1D, 
-0x9462E61C554187B2, 0x5BBD6CEDB08ED02, 0x3A05C8097D7323E6, 0x52D1104A3C254, 
-0xB866846856AEAEFE, 0xCC4CCBFFAA88E97C, 0xEE9F99EF6C607FD2, 0x7ACEF93234288A88, 
-0x5F04CC98EED5EA67, 0x62D9DAB3716CC59A, 0xA6CF2B12FB7FEDCB, 0x3AF7ECFD5FC03C, 
-0x74B51F6415E8BCF0, 0xA3256EEBB27C2104, 0xF68E4354A0693717, 0xEC9AD9458C72BF0A, 
-0x6699037407FB5B4A, 0x17EB581B93AA78BD, 0xBEC67C7011ACE5B9, 0x3FE021BECD09D0, 
-0x11A7F372BE51EF30, 0xE631431AE26021B, 0x8E03AB4942D78D79, 0xF81E4F4142297369, 
-0xB655F8A7C8F6B186, 0xCB92A75D3BFEB9A4, 0x32D1EB0E8AE5CF55, 0x2CCA516D03F29, 
-0x197103B4C07AA213, 0xA625B4AAA628BA24, 0xC31EB62EF4FFD6B5, 0xCA42DB500E66444F, 
-0xB2754DDA4A217135, 0xC444D112FC86315F, 0xF18343C5628625F2, 0x15AC23BC61F5F6, 
-0xA7F5B388E6C2FCC3, 0xE150205E19629ABA, 0x89713839489402E2, 0x4700B9D9114482EB, 
-0x411482E97A29EB97, 0xFF89A22342627760, 0x5BF40F47D655EAB4, 0x12E6A93C4DA179, 
-0xE98AB47855BBF436, 0xD7F067F63E078317, 0x236E63E9E0609CA3, 0xAE5E2678AC5868F8, 
-0x549F296761473142, 0x86EFB11990031A69, 0x509B7F34EBE8995B, 0xA3BF9550B746B, 
-0x70EC83992704A82E, 0x36F79A98DF005A22, 0x92497E33D3602951, 0xB72A4C4FC4C8E5D1, 
-0xA0316CE07EA5D32F, 0x7D7EA177662FFAB8, 0x2C64F07C1EC193C, 0x1491A1874F1EF1, 
-0xF0D251B808E33DF5, 0x993259322924B31B, 0xA0A0316288FC4EB6, 0xD60EA58C52F8720A, 
-0xB39620552A9CA5DB, 0xCCC1774B97BC2CA7, 0xFEA16D503E12800B, 0x1EBACF089A0E44, 
-0x6857B61D86F7E211, 0xCA9D1A74D8515FAF, 0x51958DC1EC0FC2F9, 0xF46090B7F55B0CA1, 
-0xD305195746F0BDA5, 0x56FBE338A5B51E3D, 0x3D717D7F9A7EAF52, 0x3EA30F5D1B4FA, 
-0x63E622A27DAB676, 0x9144F8A3D42158FD, 0xD5B691AB3498F211, 0xF41FABD870FD190, 
-0x75A622D0585CC3D, 0xEE24F665201FAB50, 0x961F3F71029E68EF, 0x17772CEF86E706, 
-0xB6218E855B59E3D8, 0x82E16B31BD2E6CD5, 0x2FAD1802A97A0D74, 0xF7D461A1DAB5495, 
-0x3FDECECF757DC160, 0x1F95DC06A58C8DB9, 0x53C6135318F91E78, 0x1D275E058E185, 
-0x96B06DAD841D7B4B, 0xED7C5C80DEF4BCFE, 0xE7E41F501E58976, 0x71A3308AA340EA, 
-0x11988ACF97B9A640, 0x46F9E234F51F0650, 0xD11CF4BF4F8F8B05, 0xF4CADED4F315C, 
-0x851AB84719FA1F37, 0xFAC73051A01E6B5C, 0x9400662627BEB04, 0x1C72A590629637E1, 
-0x3A284E5E1B83CC57, 0x5E1CED4F5C12E50F, 0x2F12492843FBBA48, 0xC75D6D9B1BB65, 
-0x732B451C4AE5A7F9, 0x4F059DE0FAFBC8D0, 0x7F014D66EBC6954A, 0x4371F5E269B8FF9, 
-0xAEEC8369377DC39, 0xD63A56F349199E0D, 0x63E71B2D0F3A7B2C, 0x15EDA643525B8A, 
-0xD8BF593819763F63, 0x959F62113EB97ACE, 0x497ACC8011351261, 0x6897BC106D2CBA35, 
-0x14B5F7273BB06585, 0xAE7746CDFD1DC0A6, 0x5D45DE608B645DFB, 0x2EC7AAC792ADCB, 
-0x37593CACC60494C4, 0x837AF3D4AF41BB95, 0x7ED1F868DCAAD32E, 0xE80CFCDDAF1F8181, 
-0xF5ACF4D16DB0DE62, 0xE6D5D0FCB7D0A07D, 0xDBED490CCD0F4542, 0x22B1066845373A, 
-0xC81F667BBAE3E3E7, 0x3C787F55B89E8637, 0x7A0BD4F2C9DA961D, 0x3562FAE5657A2074, 
-0x592728E18C486061, 0x83A95118E3ACE45C, 0x6D2B715C380DE234, 0x1EFEBC39397019, 
-0x33C3A84930892384, 0x1F2652EA401BFE03, 0x946C2521D9EFBBD8, 0x5ED2223C2FD216C5, 
-0xD2A70457835D600B, 0x29F7BF29C67BC166, 0x92BFB805F16E91E8, 0x19782573DA13F9, 
-0x16FAF4FCF5A9BE7A, 0xBD9DCA2B0E062981, 0x2B71187D7BBE97DC, 0x8EA36E895556D91C, 
-0x8D1A15D8570C609A, 0x5CDF060D893EF308, 0x27C5A0CC331F607E, 0x3121B6087B5578, 
-0x4A94ED59EA487BD0, 0xEC7528C1D5F019B8, 0x92F163EC51BD301E, 0xD1CB4CC6A66D8FF9, 
-0x98035B66EF6D0866, 0x939952B6D90BFC1, 0x7CFB1682527E2482, 0x52481F46E5BC7, 
-0x84B5230328710554, 0x47331344CA62DC43, 0x74D0F4BCB57A6481, 0xF881CE26A110E74E, 
-0x3345CE663BB1DFB0, 0x7B0FD7371A29B33B, 0xAC3710FB3458C1EE, 0xDA10BC549358, 
-0x3D06A356FE52436B, 0x3DADD39C847E464A, 0x91B11D0FA6590EA0, 0xE08162FBFDFC94D8, 
-0xC7C2B55FBE37881D, 0xCA8437D19C03B5CF, 0xEDAE4AECAB93F936, 0x1B8D27A2DCFC2, 
-0xC56DC947FB11070F, 0x43BF57D0B1DD3344, 0xD9CAF737B26163F7, 0x6C1ED22AB214BC89, 
-0x12FE47DF6057C633, 0x600E6797735D2D23, 0x46A51BC99B022D3F, 0x34DDB9CF64BCBA, 
-0x1E5C4ECDF3E4728E, 0x2FB0AD735C2B0F28, 0xF715A96C5BE07211, 0x52071086EE1CDF9A, 
-0x5E17834F316DE664, 0x243EFA8EE8CA34AE, 0x51604639E9D367D0, 0x2851E79E0EE114, 
-0x1DC710827B58EBC9, 0xE8DF9508809DEB4B, 0x499BD757C5F2B3BA, 0x6FE450EC9F18FE23, 
-0xE24D13D60BAE6A04, 0xEFB970EA3F36DB86, 0x3C7563FE355566AF, 0x236EA43BFC9F1E, 
-0xDF4D121B853E7EFD, 0xC00BAFBEE4DC33EB, 0xF14D0A9542CE7A13, 0x5E653E24ED384BB1, 
-0x174248C569B38F3D, 0x7EBF1BACDD7DB19B, 0x1DD291CA523D1142, 0x2DF36BA7F2F85F, 
-0x8C579FA6A3D37F8D, 0xCCA46EB6009DD255, 0x710FBCEB30DBDE94, 0x923F2936B214EEC2, 
-0x61C4CB7DDF744C77, 0x130DEFBBDE27C662, 0xF23150AF5EFA89CC, 0x378DB3E848E403, 
-0x4951A40F04880C48, 0x7229B1C93D30BFB8, 0xC876A10B9AD87D21, 0xA64C980796B61F73, 
-0x1829909AC754C364, 0x6A6D349FF38D22A3, 0x24DCD71BCAD87D87, 0x3F866516736519, 
-0x6DEA1EC761F1D729, 0xA2F05703DD593884, 0x398CC8015BEC61C1, 0xE0BFB8432D170C84, 
-0xC09FAF411245B629, 0xB8E355BCEC4530CD, 0x8F13099B4D6CF7E8, 0x20928604155EF4, 
-0x2EB66C032BBAFAC0, 0x170730A1EC592E0F, 0x36AA2FF67E221233, 0xE02190AE4DAEAAAC, 
-0xC53EE351B2FE56C5, 0x83597D3556EBC9FF, 0xBEA0E92863E9DF7D, 0x3767E79A0CA025, 
-0xE56D3489B2994AE6, 0xC06C99F4406E04CD, 0x686EF706A507B00B, 0x41A8F93305F6B94D, 
-0x4DA09B4238E7CAF, 0xC5E6838EAA208168, 0xA6668EDD08D1E3D, 0x394B2C8636991B, 
-0xB06D409C3F816AC0, 0x1AA054DAC6CA067B, 0x963BF73E6F27F737, 0xF6AC93041D78CCAE, 
-0xE2100F282B74C9DE, 0x456D45BB0A30298A, 0x72394C387A15046E, 0x33A558B706D93A, 
-0xC4BFE7708AA79247, 0x1E688D727BDFD925, 0x4578F27B15E7D3E9, 0x4F4DD88BED667E75, 
-0xA9AC54E8B359ADD, 0x765171D758BCC1C9, 0x9D34C1A1C586E298, 0x2400E76D5CB2FD, 
-0x3119527F5BEAE480, 0xEA6E028C99576560, 0xDB63B1B22EAD780D, 0x24D6629724B4706C, 
-0x7C9769C350A33FD8, 0x1AE97D10ED8C4124, 0x4939B3E6AA15F4E9, 0x296B729F2EB265, 
-0x651B34100EEF522A, 0xC5AAB0948FB61499, 0x9B0A97F8EA7C9863, 0x70CD033D81B8DD42, 
-0x4B4DCAC96F3FCA90, 0xFD794A06438251D0, 0xD440991ED92E9FF7, 0x212FB16EE9FA29, 
-0xF59ACC8213E71CBE, 0x65F311E94D95E068, 0x72F7EB599DC83C03, 0xBC02BB83DA12736F, 
-0x7BA3446159696DAB, 0x3EF3E3C3F8A2E182, 0x37BC96A7F4A32660, 0x330305D6E607D2, 
-0xC2DB896A599C9C3B, 0xE001AD5E876817A7, 0x1598A97E6ADCF3AC, 0x55743863D2599A4E, 
-0xE92859B3C28D7CBC, 0x33A865D14D28544E, 0xDFF5EBF564E0AA09, 0x10855F8E706294, 
-0xB5A5DB1D38E633F5, 0xF18C4FA7380C1E7C, 0x226B79ACCEC40AB0, 0xF720FBDAD34B6E14, 
-0x851CD7144F4ACE06, 0xC2B15F719B748880, 0xC05112D84393C718, 0x624C35C279E72, 
-0x9B18658F0436B5A8, 0x3701A73740613358, 0xDC688C8B1D1F18F1, 0x38D654218040981F, 
-0x16378053C26D84BD, 0x89DF23C4DB75D81A, 0xA8A714631E0205B0, 0x61BE25BD31821, 
-0xF5B9A8FE2B424DD2, 0xFC224696A26BB756, 0xD16D12BAA2E46008, 0x135D7F84F8783F21, 
-0xDA926B9990B33066, 0x8A82D655CD944CC7, 0xBCDC4D813F0D2CCC, 0x2E237B296E75D1, 
-0x41B10D3094A465E4, 0x7D0C7AE5075D0FB2, 0x6D4560F0117C8503, 0xBD21F24B861DCEAD, 
-0x1C0B5BCA9254D5FA, 0x9F8DA475E14D8003, 0xCF6484F2D2E916C, 0xEFA8045C481D5, 
-0x2BF8D523E5A06E7E, 0xE11E6C710F0559B8, 0xAAD24363001BD0B3, 0xEF4802464CC0FF58, 
-0x6A2945A71533E8C2, 0x8793AE27E50690B5, 0x2A2CE891F41579E2, 0x31ADB11C46ED78, 
-0xF264DCA27CD86F5A, 0xD00E1093C3A74AFC, 0x5D414070598AD923, 0x9899BD9122411455, 
-0xF5B885BC70C56E72, 0x1F39106B9D8EFB1, 0x7D6DF9684E57B856, 0x8CE7378065A87, 
-0x885D2D0E74079273, 0x4130C576AF4376C5, 0x89335FA6774B5C53, 0x7749A689738906B, 
-0x76D670B97DBCB934, 0x92270A9E3E09D1BA, 0xF2937200AE754E22, 0x31B75B258A3518, 
-0x4EF405876BB96B2C, 0x683E940BCCA1FB6, 0x3AF3F3DB2F1FDBA4, 0xEB5077B140283D2, 
-0x6AD20F36645C02FC, 0x80B3C878AF180DFC, 0xD603B709E12727A9, 0x1C511EE70CBE6D, 
-0xAE59F1C0E2B822FC, 0xDD3B10F1EE45FE73, 0x417D7E5409FB8E1F, 0x71A4AEC55CA893FF, 
-0x764CAEE32E4E4DD0, 0xEC0CE3D853BA15ED, 0xE8D4A1700021AAF3, 0xFD86AEC88EE19, 
-0x80E5EF71790C7591, 0x2CA882E162AB0751, 0xAD8B029F2A33B5D1, 0x95ED88FBE128EC77, 
-0x67BDCEB9AA21275D, 0xBE55926DBAF02B30, 0xCF28F19AAD18A467, 0x3BEF5A92EE8705, 
-0xE7C95A8475CCB61F, 0x3512F1C41BBC982C, 0xB8B2CE3C03CA2547, 0xDF2A4E50A26BAF28, 
-0xEE20C4114AC0015F, 0xD52CC7742DF6B1AF, 0xC903B6E599C34FB, 0x2910E32F97B714, 
-0x32EDCC49F179DEC2, 0x9058B851754704E6, 0xE19EA0C7154AECEF, 0x7E5B22800AC7E7AF, 
-0xF5C81055FF2B5F37, 0xEB75FE2F2C1AFC6D, 0xAA5FC125AC5C2E77, 0xC4E782F24C937, 
-0xF57D167B5CCFEB5F, 0xF58F360AE0FB88CD, 0xE6E08014F9D2751E, 0xEE0FEF655DE77607, 
-0xEFCD38EB7A095096, 0xBF3EC9322E2E46D6, 0x1870287EA6AFAB0B, 0x38F3EADF810D44, 
-0x74206EDEBCD2C249, 0xB7BD07BFC143BE01, 0x27108A6C180BED9A, 0xD34639072C141309, 
-0x4F823565EC25CA0, 0x74C86C4608C3E248, 0x959E76C6FA98B9E9, 0x2BF13451263FF6, 
-0x66609E8806CAD0EC, 0xF4F298A38F177EDB, 0xAA0C131AABF55E45, 0xC027F853DE0A47DE, 
-0xC768B36E515DFD2, 0x56476294812447B9, 0xDAA28715F9F6D51F, 0x1340DC8D414A7C, 
-0x60168399F1DEF4D1, 0x606660EC6521678F, 0x8E2852BDCCDB4FA5, 0x91A0B8159ACF6FAC, 
-0xBFE36F48936DC32B, 0x4D7D0B79FB5377DA, 0xD38B8C105A731075, 0xE10EF81FD9798, 
-0x2E8608E530D30060, 0x5AA8416DE8B2107, 0xCE1A0C97065E2DD9, 0xCCA9D9C8848DD102, 
-0xB0BA0487BB0FB329, 0xB26B205305C8055B, 0x1A1056A3474976B1, 0x1BFBEB1A93E2BA, 
-0x1C480AE40FC5494F, 0x2A5E765BE3BC6CCD, 0x213D9FBE571ABB6C, 0x777D165F78E29C3D, 
-0xCA9979F9E4D90864, 0xAEB44807385D5FEA, 0xD382DD893ADC5F2B, 0xB2D75DC990313, 
-0xE322685C3FC97B02, 0x68173265F6C4C234, 0x29F04C5BF1173DE6, 0xAD22020466692E01, 
-0xA589CE3023146F2E, 0xC832B1F1F6820C3D, 0x188CE0C2DDCF6444, 0xDFF0A7A9FDD56, 
-0x9F00CC116D46B823, 0xD5D4EEB5AAC061F1, 0x3CE401BF1AE9731, 0xA3FC436E9E1213EE, 
-0x551189E75517FB8, 0xAE9FD4D5BFB76A87, 0x9BB7CB27EBBD6E48, 0x77177B719DB0D, 
-0xBF8F7D9FB9A0E655, 0xAA1C49503086B101, 0xF31CCAA701ABBEDA, 0x7EB1E89CE19D685A, 
-0x674A0CA04E922577, 0x2E80B389A89EEB61, 0xE41A5AD22F13E49F, 0x1247DC9208A15C, 
-0x57987AB8352FE862, 0x4492354F45560B82, 0xCB2AE11B70E54F1E, 0x10B50FCFA29C7641, 
-0xC605CA3222617240, 0x85DE5960D177B798, 0xE459D9A46A078041, 0x11F4A768F61E4A, 
-0x31C6ACAF83A9EAC8, 0xAF406AFCC7DC52F2, 0x9BA33985C1C5DFE6, 0x890F177A95682468, 
-0x8E663D3D03A06F03, 0x984969C81C9389C1, 0xA3C2450FB7285372, 0xEA13FE024282F, 
-0x199A842CF792B722, 0x4111BFDCEA43E954, 0x97AD45F9D2412C19, 0xEF12B93CD3778D17, 
-0x64DA511F632A28DE, 0x8C77DC27B27671B0, 0x27821D7CC04A86C4, 0x7C1F92023DA39, 
-0x4ED2D350734EE720, 0x448E8D76A25C4735, 0x116230C17624B0C6, 0xD893462B1676758A, 
-0xA6EBB986BD068C21, 0xF0C21E41216CE0D7, 0xE8BAE5721AE86A9A, 0x842056B7ABDCB, 
-0xFE7D97091A5E2E5F, 0xF3E33651D80FF16F, 0x1DC6DC81AF214087, 0x838417FE821A2D24, 
-0x97241A6726B505B0, 0xD37EC99E5624B990, 0xC32230D6995F282F, 0xA5D9FF37EB0B1, 
-0x5EC21345981A49A4, 0xD5404C469AE92752, 0xFF000AC64B449F27, 0x9F02314E32D7783F, 
-0xEFDE11B234DD47E5, 0xA06BB470113D0F69, 0xA8895A8F626F83C8, 0x3DBC11171F1FF4, 
-0x9EB7FFA366076385, 0x54022EDF42C5B222, 0x7934193C5830E0C5, 0x14183210B388B3E8, 
-0x647104604E59826B, 0x8A2E47E92F7EFF2A, 0x5D2E596E8A4FF69F, 0x3F5AC12DBA056, 
-0x5CD79B74B8D71727, 0x9B2A488B8A4997B7, 0xAE717A86E8C91008, 0xAF2460AE1E42A35F, 
-0x546169D29363E6DB, 0x755F282994427E81, 0xA36B584C379B0D9E, 0x1619989075CF55, 
-0x77E8EFC63F3709B8, 0xAD28CF8ED200371E, 0x6DFE341D03123222, 0x132237FAF69AAB61, 
-0x1F4243B4CB79A696, 0xD8A951B1136BB9C3, 0xC5C73571E024CA83, 0x11A1D6DACE8A40, 
-0xBB5699D724A19FB5, 0x35EAC10099D07266, 0xF020B134FCC9F9A2, 0xFAB217AFB224C5C6, 
-0x5D7CE2E6C03FF681, 0x14D8110AA54B6A0B, 0xFDFDD9D217E0D2F4, 0x1C5A10E2349983, 
-0x7230F9E121F19704, 0xA7012328EE3F606, 0x1CC2D6EDC4C58546, 0x12191CC79FC853ED, 
-0xC1408571B9E10BB7, 0x1CC23DC0B5E31041, 0x415BF31EF738597F, 0x32685DC7D9DDA1, 
-0xA5B0103239517364, 0x1153D3F1624A7BF5, 0x2AAA669466E97686, 0xBBA357174076A7F5, 
-0x3C76D3C53B1E8ACF, 0xDE34B2CABDEAE265, 0xAF78CDE7793677F2, 0x24D1590EE24DFD, 
-0xE707FEBE7B1DCABA, 0x8676D1FCE2F5CB59, 0x2847C885A90C01ED, 0xBC724195783AA3F, 
-0xD9E79992B8DF2D0E, 0xE6FDACC7F4DB5DC6, 0xE7D715603BF8ECC8, 0x12DA6320A68886, 
-0x7963D995DE537634, 0xD291BEAA2D1F06A7, 0xBA6656237CF9C317, 0xE360470B334E49E9, 
-0x93737A46E504844E, 0x89729252EAED80F4, 0x3C8ED539290AE4C8, 0xFF4EE7518C142, 
-0x11904C2DCAB35DC2, 0xFA5917CCD509D4A5, 0xAA2DAFFA4FA51628, 0xE5F64FD78E3485A2, 
-0x9928F66CC247A455, 0xA6402679A5B6C99, 0x25A7FA63511B1EC7, 0x34758410E3C071, 
-0x4707822A1A150AC, 0x21EC2D41C50A9128, 0x3F7BF1373EE4F442, 0x945BD651F40B4E34, 
-0x68F6EA858C1F89F8, 0x22DD4AB4424F7D6F, 0xBB5D8B9A4CD9E1B6, 0x2A3FF76BE4C221, 
-0x2FC7F14CB8DBD522, 0x7AE4C5F5357C6609, 0x4B1E2E3743B27E8E, 0xCF074325A98D7923, 
-0xFF3FD435E1638180, 0xE861A2D529E203E5, 0xB8762C9344F6845D, 0x124E887DCCE057, 
-0xCED385CBD5C9E783, 0xEA683083EAF8E56F, 0xEBDAA67FD155292, 0xAC0F997B58E6C3CF, 
-0x9F54A2E39DEF2E9A, 0xDB822C8FAC33EA4F, 0x3FBB722693535E76, 0xB2187CA097BEE, 
-0x2CB6BF2A9637161D, 0x2DB144BB0D694018, 0x24C67A2F1F7F4136, 0x3F696AE6B78340C6, 
-0x330025E48FC265C, 0x7C94C33FFC74D76F, 0x12326E8B0C6DD6B9, 0x3FAF416EA7637C, 
-0xEE06FACCE7CFCE76, 0xA15A6C012A143581, 0x7E777001191582BC, 0xCCB204A40E62CB2F, 
-0xE3080B2462518A5D, 0xF84872AD413DC5D2, 0x68E7CC15CCF69371, 0x3E98DA9DE5A9BB, 
-0xC851A6CF483DA816, 0x2A1B4005D4FAD2AE, 0xFF2B47C57EA4E0DF, 0xFEBACE6FF1AF1777, 
-0x70E8F47215607F99, 0x5926DC818360265C, 0x3483DAB66AB6EAC3, 0x321C3D75D2D916, 
-0xD75C5214121877ED, 0x924EEAF7BE22C198, 0x748F4F8FB7B2970E, 0x165BF3843CB47D28, 
-0x1C3920E2138D17DC, 0x2F5E8E2D6726F3CE, 0xBB17ED78C94E336E, 0x21D184F2413119, 
-0x4B440DFA95AD7F4D, 0x8E06AEC8A3324C9A, 0x776722DEC5ADED4E, 0xD2FC6EFD81FE3084, 
-0x2A1B79DBBE448845, 0x912A8719D0BDA80A, 0xCAAC07C4C7775BA1, 0x8B0B0E0189EAD, 
-0x66270CA73B796CD7, 0x783CF42ECDA34DED, 0xEC6DE1D7354DACB4, 0xF73D914ACD4A2A66, 
-0xB83119669AAEA264, 0x7429D9F36657F492, 0x96632147E62B966C, 0x12E66B895305F7, 
-0x5B80667254A592AB, 0xB71AEF88FBF9F606, 0xB798CF330072CF89, 0x516B1A50BAEC773A, 
-0x237616F2F15CEA18, 0x559761AB47194203, 0xBC6B1B50AD83AD0A, 0x3AC206E23E1CCC, 
-0xDB8C53C65D05917A, 0x31A2183C5CDAA49F, 0x9EB2800F95566346, 0x45653F022788ADEC, 
-0x5F362ADFEA283A2F, 0x3CE597FE0387AD5E, 0x9B3EB20DEC97E4B7, 0x355BC9CC1645B6, 
-0x5FC25BE4716A9B73, 0x23559011B3331F92, 0x9CD8DCAF28793B2F, 0xD0258D3F4F35EB5E, 
-0xF9E7F175DFA82C33, 0xA708544114536C9B, 0x93D78E9B98FB4F05, 0x1CF2A5E4290356, 
-0x18A9778FE95D3B88, 0xBEB84B5F58E35360, 0xEA75D1ECC1D9279D, 0x69FBCD5EF57B8738, 
-0x2767B1B2BB60E09F, 0x8EEC6F75B7714B71, 0x7908225F04AE3CCA, 0x9F6537B454193, 
-0x96E122751EEC6A9B, 0x66DCA93565826745, 0xF6BDE0DCBF7452A9, 0x5988008B2D03B02, 
-0xC625B54CE6DD5618, 0xBCB7BB6888D993BF, 0xD6DBA33F03FB2481, 0x34102E96B804F6, 
-0x1A262D31010051B0, 0xEE2ABD5AEE8F0AF2, 0xB161A380FB46F6FA, 0xB1A9B198ED72D9C5, 
-0xC6317D896D1E7C2C, 0x8D745EA65CA029D3, 0x7D5DFD564A8E4BA0, 0x14A06940896B3E, 
-0xE3611850E445542B, 0x59FC6E330B4036FE, 0xFE7E25498E723FD9, 0x76556269ED0417B6, 
-0xD0A81CBF4B18DD62, 0xD58A9744B5844554, 0xA28B72E895EF4DC8, 0x371459525FA15D, 
-0xDBB716892E46CF36, 0x491F6A0295DC6058, 0x9A91F876794893A0, 0x22D0F37C83FF2A8F, 
-0x54D0F524BF4B3C29, 0xDC12596C35098CDD, 0x16D60675A4724844, 0x12A6667BCFF443, 
-0x44DDA42510C9F463, 0xCDB409382D930CA2, 0x74CA40002DDAD19F, 0xF4D49F9640B3A84A, 
-0x789097C3C9DBFE4F, 0x670084653218197, 0xD27FDDBF2285F0A7, 0x38FF2F47BB4043, 
-0xFD4FBB6379CE7D04, 0xAC71A42222C0CD1A, 0x49E3F2B5BAC5AD30, 0x44CE7BD50186AA92, 
-0xE418F0D809E35307, 0x5EBFEA43AFE48723, 0x41215226A36A2D94, 0x48F0750A31AE0, 
-0xB192C198C942F93E, 0xC1FE4E122497A11F, 0xA3E666DDB601D122, 0x9D3B1E4BD8A42201, 
-0xCE7DC1080C876DA3, 0x793135B80200E7C2, 0x4D0CB90A78C893AD, 0x397D7573DB19B8, 
-0x4FEABC5543CA4EEC, 0x632DBB55232B201A, 0x86D767840FED4818, 0x98C3D439E9870915, 
-0x8B359B227DAE6DA5, 0x51E09E10A2964BAA, 0xB9B01646D180C3A1, 0x17B717E57CF2DB, 
-0x38585DB4436B2322, 0xE1F46490F42D85FA, 0x536B5062B93BF41B, 0xEC48915CA8A837A, 
-0x5ACD711FC9EE441E, 0x5DA2694B93B7594C, 0xF13F56A7AC858172, 0x2BC59E609A529D, 
-0xCBF18AA402150616, 0x5B340DCAD2D76D2E, 0xEECAACE002125040, 0x21AEFFFB8766AC4, 
-0xDA400C1733763C1E, 0xEE6C0573C5076EE7, 0x2F0BAD7E6467AF8A, 0x3240528CB38E3F, 
-0x3127D9EBE2965B5A, 0xB1C7D7C5E6F4C16D, 0xA823927FC33E70A9, 0xBC7CE44D996DBFB2, 
-0xFEB8576991650DAA, 0x7D8114418CFF2DB7, 0x2A6B22A74FDEC85, 0x2A3EF36E60CAF6, 
-0xF1FD80E6F0289D57, 0xE9BC8E9B75BF993A, 0x81F423EABB202915, 0xDA0D616810DA4947, 
-0x4868042A078B4A67, 0xAD472A9D3D9E4D7F, 0xF173DB1BE5FD6B67, 0x2ED99F229D55E4, 
-0x207A86AC5A3302EC, 0x98F7E8AC8986C1D2, 0xF845A1E1CD25235F, 0xF4CEA81350E5FBC0, 
-0xFC8248CEABEDB8B4, 0x6012FDFC2AAFC9D5, 0x90E4604C4EDBF288, 0x11718BA3424E5, 
-0x477E1D5140841A8A, 0x700FDE069A778B7C, 0xE4550563D5460F39, 0x1D98C40D3D50884E, 
-0x47B9516BB969D615, 0xC69B41B795BAD650, 0x801F27D2AA632CC6, 0x1B85A287B22BE6, 
-0xCEBEA794E5EBFB99, 0xC3CB84134D81CEDD, 0xA4768B92FCA3F853, 0x26907CC33E383B83, 
-0x67051B01DEE8D620, 0xA68FADA8251E53B3, 0x89C564DC2C89669F, 0x22FA0FD2990075, 
-0x3BB6AE42F3169FA4, 0x89F4309FC453823D, 0xEE86BB406176A768, 0x94B89AF9737BEB87, 
-0xBF6A603823F02E76, 0x61A1CA522802FD36, 0x51CD7464AC883E51, 0x643B230A01A4A, 
-0x57D33E4E4B602067, 0xCF7388C77A9CC1FD, 0xC3F9F80CFB7A4D75, 0x7C968AAF75ECA7C4, 
-0x295EA90D8242A1E2, 0x8A0691AA45BED0E9, 0x649142FE7FCB581, 0x12759741A959BF, 
-0x692051BD1AFAE33D, 0x741EED4CA5FE84CF, 0x60DF37006E48801B, 0x42D7A7FF449B4186, 
-0xABED0A24AE308180, 0x7D852F3A11D1672E, 0x574E76B34A8F8D59, 0x21963866ADFECD, 
-0x5B8849921318DD07, 0xDB388953E12106C9, 0xB0186BFF2C172ED4, 0x8D021A5A501CF59C, 
-0x60769B3C3C4B5F51, 0x47E94467352679E5, 0x7A963E251C933A6C, 0x14D156B4ED2359, 
-0xC91EB9501ADE5584, 0xE6A3730836663311, 0x9F4BE3F1B86FBA05, 0x32EF4AFAE436F37C, 
-0x81A95F357E59CB60, 0x86ACAFA64461AB42, 0x9335BEC52E6DF854, 0x6BD43ED3A8763, 
-0xE4DF3A317803A47E, 0x2DE4E28249B668EA, 0xCDADDB2D2C486D85, 0x63CE86EDB349C1D0, 
-0x235927C0D81FEBEF, 0x4E8E7FB04AD5E1AD, 0x1897E39DEBDABBC0, 0x240089C34BA61A, 
-0x24D177980F692F00, 0xC800C45DB8E57D21, 0x9C52F93E3FE21C24, 0xA0F8023DE96F8BED, 
-0x7F131EAF0151EEDA, 0xE322309781340EFB, 0x547B6343A88E2B2F, 0x17C118BE89C777, 
-0x13598CF2892BC6C2, 0xAB7DA12E2F2FC734, 0x5E0C0D69DF2A5A3D, 0x2C2023945336CF75, 
-0xEEC09C0D4CB46E73, 0xC8964C9657F29DFF, 0x2A6B0FF457209735, 0x85C93E4D5259, 
-0xC451CA144B4EFA82, 0x10A3F56DCC62B12, 0x73E9264875F0EA4, 0x207166B1A7452203, 
-0x7A9C3E44BB41505C, 0xBA133E768A63FADC, 0x296F9604A44B7AFF, 0x20A55F6128F55A, 
-0xBF610B6FB52E1DB0, 0x91F3203B0875205F, 0x497645CB6C9F70A8, 0x257734B956B9923, 
-0x670B028BA3E9196E, 0x326D91A3145F8244, 0xE3F11602051EE8E1, 0x6B8F1047A4053, 
-0xA8501000BC480776, 0x4FD7CB82693C403B, 0xBD4AD98AC34CA6A6, 0x199BA22710A86AEB, 
-0x3DD8E8CC5A8B2870, 0x25D2370C36FC23E5, 0xD7F8BEB5FB9452, 0x7207CF250F345, 
-0x349D07C84D8D1ED3, 0xB67A29115CBD65F4, 0x4954E43D2A8A790E, 0xC8A6924649DC5CF9, 
-0x1285FE9428FBC3A5, 0xEE30554ED7E6EDC9, 0xCB568AA0E4FF6B01, 0x1060B748841C08, 
-0x7B58DCED84780B47, 0x6B6C14FCBF98C90, 0xB2E8D725668EE1AA, 0xF196D3912FCEF04, 
-0xF89FB34163CD0D0E, 0x37DB5E81FC238CF6, 0xC5721E4D4D0E82F5, 0x36C92AC0527A52, 
-0x1DA6A55F9582951D, 0x80E28B3D4DA77A72, 0xED558FF9883CF6, 0x62DDBED0AA59985A, 
-0xD4F6786DBB4F088B, 0x44AE2026C2884CFB, 0x23D1A1E456061E6C, 0x10B0BC75341D61, 
-0xF466F60AF65532EB, 0x82077D7C185A79F8, 0xD1277A0796348B3E, 0xE7CB5ED03B288DFF, 
-0x137BE7C37484D751, 0xFB35800A9B1FFB4A, 0xB5F82469F742968E, 0x41CA1761BA250, 
-0x613CB00507B423FC, 0xD2984D57450FC9A0, 0x6B0EA24CBFF5625B, 0xC5A7C2CA0DCF1AB1, 
-0xF832FD36764C72D0, 0x67D747EFBA98A4CA, 0xF40D39FD06F2B09F, 0x2D3253701E0875, 
-0x640D0B7ED2040A18, 0x6E69B17628BCF469, 0x713ED3A3F801AF4A, 0xA269F921925CD9DC, 
-0x577A29B48205D0E0, 0x29C2E66E71AAE2CC, 0x2E985D266C9036E8, 0x58258BFF58EAA, 
-0xCBD778C5BB434D69, 0xFA9FCE8561DAE905, 0x545AB790010B1322, 0xED6923D780971672, 
-0x4F13D21FF2F41AE1, 0x50A4918CC107AEE7, 0x5999C125A9476B85, 0x3B89E7DB44AEE2, 
-0x7C60A6213FD93E67, 0x8A80A06925A4C403, 0x830698A08342FD62, 0x7831B8249CD6CA0, 
-0xEF6923F19A4F5E3B, 0x5C65EDEC8F6BAA7B, 0x479662E847FBBE5C, 0x25AE05A40A644E, 
-0x3BCA8F118FE5C56E, 0xA1F2B27B8BE0E1E1, 0xFCCF54306E5D7385, 0x1AEE6DD57A750F11, 
-0xF5DCC41FC69C75C2, 0xC0AC6E4896015546, 0x2F80752B8A3A5D09, 0x215EA4FBD4523C, 
-0xC7398F0D12FC3A2F, 0x2751D507CFB1BF47, 0xAC9E1AF3DE9D43F, 0x5406D5631941F0AB, 
-0xDA1FB2B7DCCE6D55, 0x607C999F04451B4A, 0xC2C87FE3CD30FF08, 0x12BA80DC37E685, 
-0x15BC795994BB700C, 0x2A9E086B8E1D9687, 0x5259ACEB963FFA17, 0x38BF1665794F1824, 
-0xDCCD88FA728967AD, 0xC05BF42047244590, 0x38EC07C9692C939B, 0x7153536A190DA, 
-0x87AF4E23452D1D33, 0xCFD4696764E7DBF5, 0x715556542E7E0D4A, 0xB4DE7F21066290B6, 
-0xB47C1FB725FCA9, 0xD5582FE0FD390600, 0xCB11418A98365314, 0x35E72B43A05135, 
-0xB755E3445AC4D025, 0x7D51012DDB24B560, 0xC160A773E31D7704, 0xE6AD5A9E8FEF95EE, 
-0x6F4B3BDC30C4A0D4, 0xF4F52B6E36FC7AA8, 0x6EECD53DB666B51C, 0x2DF30F94871E13, 
-0xB10514173E7A23D3, 0xF51AA9EE1BF46125, 0x9FF0221A0E16672A, 0x3F6AE38C6B9189B3, 
-0x510870D8AE88CF60, 0xD590F20ECC00031B, 0xF009459159234D5E, 0x132CBD570E2E07, 
-0x3310E94E704202F2, 0x3F26CF6ECCE36F36, 0xB58EBCBF288520D1, 0xF3BA7775C96A1E28, 
-0x209DE4B65F82E151, 0x20D1241C3E4184CB, 0x26D7D0BD7EF5B854, 0xE94382A380048, 
-0xD8215C231998DCDE, 0xCCF89A92C86DF92D, 0x51AF622F834ABA0F, 0x4262B81F46F39DA0, 
-0xEC0622A19882FAA2, 0x8516C9BE30E53B30, 0xFD048A25ACF756D1, 0x58A7AB0C20642, 
-0xC7670A44560F8F91, 0xAB8547B43C3479D3, 0x3D569F5772456BB6, 0xFB5B53C0FA23B31, 
-0xE75E43A12A8B4FCA, 0x13D88118CBCFB9F8, 0xDCDAD7C80EE953C5, 0x2F8C069DCB4740, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB1678C5AC22E6CF3, 0xD3997F70E6B1F497, 
-0x56C3B1478B8F394B, 0x90B563F098BC13F7, 0xE33BA6C4F7BB082D, 0xD51B497D2F1C4BE0, 
-0x3DE4316EA65A30B2, 0x7F44E0C9DA7C7
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
-0x273F6C464CB9B30E, 0x83722DBAE9836B36, 0x7236DD158D1A1BBF, 0xCE84ED2FD6FC9B11, 
-0x96804584C42BBFDC, 0xE3D6BF4D45241A13, 0xC4D8AF04CC4F6BEE, 0x653193B290C00, 
-0x3E3209393CB32A2, 0x689964CCAB348A84, 0x74471EFFCED8819B, 0x661D7240B28E2790, 
-0x71AAE7BAAE2179CA, 0x5DA64F579D150D5B, 0x17919259B69EA954, 0x77328AA89BBC7, 
-0x3906E0889D1C2FC0, 0xC75AE81624C4EC7, 0x8B7480889B54EE7, 0x64943C09942FDB32, 
-0x44E4802923DF1D79, 0xF56CE97EE0F89851, 0x1DF1A01FA1863680, 0x315A043E1D0C15, 
-0xF50FC07FBDA91B34, 0x617F5AFB158C037C, 0x31A682FAED0AB32D, 0x4CB68F9AE1F01D7F, 
-0x4F468A61D183C4E9, 0x692707D7F3EBE901, 0x5084C7D3D549991F, 0x136698F774A6F6
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1). 
-
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0x85C7CA3E9EADB8EE, 0x97873829844CF9A5, 0x96510E240E86B156, 0xEEDE7282E40EE2EA, 
-0x834790477C5D787E, 0x3B30922B819FBB12, 0x503CBCFF9F6EEA85, 0x310DB49979557B, 
-0xB19D04E98B392C8E, 0xD2E39BFF2A5E96F1, 0x1360F52AE4A91741, 0xABE9E841F06BD82F, 
-0x9B0F10004369DA05, 0x9773A80A2D5B4968, 0x150F402F78BA17EA, 0x267889EDDA82D1, 
-0xE4F3317EB16BD357, 0x8CB1BCD465AAAACD, 0x5BD63B8AD1EA3E14, 0x75F4CE2332B5240D, 
-0x58D711071848D94B, 0xC3A1D6B6ADEFFDC6, 0x2E60A7A9993D40BC, 0x2A4DF4CCDEDB41, 
-0xC1BD72B10DA4FA9, 0x84A26F4EE4496FA, 0x34589B9528ECBF9C, 0xB6222BA5EECE380, 
-0x27A5FA02EAD7F3F8, 0x7663FDF274804B47, 0x4954C526AFA4A7E1, 0x36648BE8A9460, 
-0xCB251808FD734F84, 0xEA1DB9DBA11457A8, 0xBE247A8E2EE186D, 0x275FE19B2EB7F43, 
-0xDBC4D02713E06C40, 0x5C7D6AEA148B13DD, 0x657E84E0CBDAB22B, 0x2432F09DC4483B, 
-0x1637A27855823819, 0xC3DC5597D4F788D7, 0xD251D69BE7F1CE68, 0x785BF32F873C30E8, 
-0x4AD8725177438524, 0x45DCB744C6F8F13, 0xD216FC7A1F74ACFD, 0x619711080F21C, 
-0xE01B02B0FFABF430, 0xED5F88D2590604A9, 0xADA943FA1DD8403F, 0x5E330D59DC77889C, 
-0x139080687DC5E98F, 0x1CF2B81CD54F9FE8, 0x4BB02BF0902937A0, 0x188104988B2CB4, 
-0xB7D8CACDD61A57E7, 0xB1AFF074D0533E5D, 0x6A5C95740929D714, 0xBAB26BB2A69E78A5, 
-0xF277141029706195, 0xC9AEF881ADC3BA1E, 0xE5715B4D01CCC2B, 0x176A061CC47CC7, 
-0xC09FEE1625AE485F, 0x8633DAD9226734EB, 0xBF88C965D8CA54AA, 0xEBCBD4B6E769FF87, 
-0x543DD3C8707D9014, 0xD35E50A6F9FD3B4B, 0x7A28A562FCB3C67F, 0x405843C342F10F, 
-0xF238C2032DBAFB12, 0xE29F7AAF15F306FB, 0x45DFA909E7653EBC, 0x9325C090B921F541, 
-0x7D18BD7B8A2FA1DE, 0xC3036FC258CD9EC9, 0x7D744123622097A4, 0x10E3ED466E3E8C, 
-0x8132CD2F847DA8B8, 0x4AFC83F0068DECEB, 0x30DAEE5EFF8CEA14, 0xD89FDB2B91756EBE, 
-0x3BF36981E1ECF64E, 0xEBC4FE8E9E8212CF, 0x31D29511C2723BA7, 0x3C1E06F04F5653, 
-0xCBD8B07F4A9A3E45, 0x1443092D9F914C9F, 0x33A88AA7136FDD85, 0x17F517BE8449ABD1, 
-0x8A4E91AB3AA503F1, 0x8372BD7EAEDDEACF, 0x56450B847931748D, 0x6FDFC54AA439E, 
-0xF6D3936A7E8712C4, 0x525FDE819DBEBAE0, 0x2874E4ECC2630B74, 0x1FBC2C7D26CB7E36, 
-0xF75681CF0E5462FB, 0x93909F88676FC573, 0x295E93A843BE4E64, 0x33CEAF9B01127F, 
-0x9B8A62C5089194EA, 0x2474CD26C67ACF1C, 0x9776C45076A0977C, 0xE805E224A4E0EAFD, 
-0xACB7D10D3BAB10E9, 0xF8F389F69B8F5367, 0x86A9B41152D32C07, 0x20E2F3D52A54BF, 
-0xF4314B5F9E42A846, 0x4721BB5334E50C10, 0x2AF52E2277F6A2A0, 0xFEC9E0B07EF0A81E, 
-0x64D012D951925CEE, 0xC1B86D0291FE861, 0x279EDD2B4083148E, 0x3843ED590AC7F2, 
-0xBE269B61D16536B5, 0xD03EF1FEF08E1497, 0xB699A3117FA61D4B, 0x512788543423CF68, 
-0x6C7F64B39A4E2E15, 0x6B4E8D0ADCE0BEED, 0x52ED5CE2D6FF84C8, 0x2271E0661F2B91, 
-0xF66F83C841E5822A, 0xC4334FE8A1E1D72A, 0xA042BDCD86E19192, 0x570E5ED7AB554437, 
-0x76E232A73F137EE0, 0x2BF11712838E81B9, 0x620CAD3081CF4F40, 0xABFA98FA91B55, 
-0x3E51D21636E0A903, 0x9CFA6AABDBB555A5, 0x8785D31D6B816F69, 0xA7AC7754211FD4, 
-0xB0301E0BB9F4D945, 0xC1592A4A7959CE02, 0x9E4549F8438B08FC, 0x196357117C9D02, 
-0x8C24774ABB7FA431, 0x5341695414714243, 0x7673CE34ADCB8932, 0x9E4D78196166C3EC, 
-0xB32797EA20E361FE, 0x328A84C13F177314, 0x78E496C747C09D29, 0x1350733DF5ABC1, 
-0xB7042BF0D6B8E130, 0xC6A689E163EB578A, 0x593BCBC303ABF6E8, 0x1E4B4F8C9A09B9FE, 
-0xE15DBF9ADD7DD378, 0xBEF91FDA06BAFC65, 0x6A21A6C54EEDF611, 0x2F3FBE51ABF33, 
-0x8CD0DA012FA7D205, 0xA86097FA989CF40A, 0x4A7285B013F66F1A, 0x5A7FA82A56ADE8F7, 
-0x68637425CD3F8883, 0xDA57D6A35D194D22, 0x94EA55988E64D5E2, 0x11FD6C675540C6, 
-0x4A3BEA3AE93960B1, 0xE03E165866FDBEDD, 0x925C330C1E7D8226, 0x30FB772BB1A85AFC, 
-0x436A12091E97D9D1, 0xEE98C9A0EB42B05C, 0xF63CD3C900A0A350, 0x1D17A39BDD6600, 
-0x6086DE8F8146C8B0, 0x40566185C25BA161, 0xE901C89884636E6A, 0xB578BE00D22D4401, 
-0xB58916BFA27EE2F6, 0xBB29C4CD5D3D1370, 0x561BFAC5817EA571, 0x3261F12EAF245B, 
-0x51C69FE4C2BD6C90, 0xBA93C7516B3E3562, 0xC914015B590A73D, 0x112F9F42FB703305, 
-0xE86D0D63682C6968, 0x89D08909C7F53035, 0x95D8E48B6CEF33E8, 0x224CDEE2EB9524, 
-0x655858D5FD89F1DD, 0xE47C518457856AB0, 0x6EDE0F13DF8B80D2, 0x1A7A03582B70F298, 
-0x62B5A5C54B3D490D, 0xAA840FD16257E005, 0x67E4472CFA384456, 0x48C971ACB01E7, 
-0x5AB1C2CA90CBEB5C, 0xA25F64938BC48A66, 0xEC946017823C05DF, 0x896C703B4F137BC2, 
-0x32EA49999D906542, 0xC8B0D06EEB790E74, 0xBA60C32EC55C62D7, 0x1AA03D36CF8502, 
-0x86DB15CBA6040955, 0xAF4C4A5B90F3C56A, 0x2DF9587824678BA0, 0xAE49AC5DDD49376B, 
-0xB39B01B40BD1D99D, 0xD968B251D800B4CA, 0x1FB9A82972F38C8C, 0x1A2DE56B250C3, 
-0x9E8FFAF253556784, 0x308D2F92623A0758, 0xE283E03D68849D09, 0xA62A3E8DC4720855, 
-0xBE933CA1DEA1F275, 0x6009F11D5EEB04C7, 0x48CF021AD85286E2, 0x352903B55112B8, 
-0xD043C2E2D1B77306, 0x63FF12D119064271, 0x36F29C4ADBA2CEE6, 0xFDB6B49216D3743F, 
-0x97583BFB1634421C, 0x62F50B77D0D5602B, 0x4BBB0B43D24A746E, 0xE9F0633ED51C6, 
-0xDFB8B695F3B4F26C, 0x5926C2AAE5838D27, 0x91BCA10F9B44E726, 0xD1FFF3CF57DA04CD, 
-0xA557509AE62E5C1E, 0x50B1A18402085750, 0x899F58D853D855A, 0x2E5F28E5B5A275, 
-0x5E3A092F11893DD2, 0x7CE31E0C582ED837, 0xAB07330F1F006699, 0xDB71C77A33D38014, 
-0x37D84F386EE42EB5, 0x77A216FB5ED21C3, 0x826FC664DDB3B6CB, 0x39BA5D5EE95E97, 
-0x455360834F72B7BE, 0x5965D9CAB8F4EE6B, 0x232B72F1FD1FE273, 0xA230386D4DCA331F, 
-0x94A0A28561ABDD7D, 0x54A05FB6BB2173CA, 0x7175AA2C518B12C, 0x117D3E02839973, 
-0x5B11E861840A8078, 0x5B447B97205FC6DB, 0xCA02CFA6A69FE8B0, 0xC07409C6A41936E, 
-0xB589C55662216004, 0x28B0E362E168B785, 0x11D6CC0D36BCE4BB, 0xC53B7973EEB92, 
-0xCA9A36B9F4CD5A25, 0xA2D743ED9D94288F, 0xE11854245C2BE3F9, 0x18DD5D0EA9C62B77, 
-0x71B5DDF069A38239, 0x462FF85D662B5739, 0x8F0775F6EB9F7067, 0xE9028CEA5F5FD, 
-0xEF7DDA0A270B0FAC, 0x8D5B15C4B85CFDC5, 0xA3DE0BFBA5540069, 0xA6910D57AB8EFF6E, 
-0x4781ABC5C99EA8FB, 0x8CC560CA2BCF0E00, 0xAE945E2C3B9CB9D2, 0x2AADD1B133219A, 
-0x3B176193FED733A2, 0x8BCA4B181A55CBD3, 0xCC578CEF7ADE923C, 0xBFE1BE006218D884, 
-0x841B3859467B2940, 0xC77D877F581800BC, 0xD98044F56633E791, 0x3983D8E1C488E2, 
-0x8F23E62C402FDECB, 0x947EF73A4794033E, 0xDF63C67CFBDEF4C2, 0xC7A1E3299594F62D, 
-0x2C3F5E6251D15207, 0xDAE5AC00D90CCED1, 0xBC7E64AEE5638D51, 0xBA3C4739DA95B, 
-0x93FFE0DE8250187B, 0x1D145333E5899F46, 0x1904EEEE43EBB312, 0x1383058CF8C03C87, 
-0xF92EE48461F96224, 0x2DA38D983DDB17E8, 0x6D2186D33E59C36B, 0x250774ECFFA4DF, 
-0xB368385C28DF4763, 0x931E6BF4DAC47FAC, 0x34A28F276A7C3C07, 0x34E6BE5555D20E25, 
-0x3423691989928F92, 0x598AF984C0AE13FF, 0x3DF9238A7426BC3C, 0x1867401DE4D7EE, 
-0x216C54D5330CCE0B, 0xBC2C3DB4CE0888C2, 0x2C92AA85C95B4DA6, 0x9D0E9A4B6E7210B1, 
-0xF6E6762771B5AC97, 0x2EC536B830889B61, 0x807C10D3B11DDF68, 0x3FF77B9E0A89F8, 
-0xC8144E0C41F30695, 0x3E3216EF624A9A97, 0x1CEC3E595606677F, 0x25EC1B46F719664E, 
-0xD3988CCE8D90BEE4, 0xA6225EEEAC9FA979, 0xBA1D02D6F0F81FC3, 0x16E7C4EE3397F9, 
-0x35DCCFD70EF557F5, 0x8D1980542AD4762E, 0x5E0B1073DFE2159F, 0x827FAEFAD1E0137E, 
-0x34B5552A179F9441, 0xF6246D207B94E9D4, 0x93007594B4F7E044, 0xFE2D687655527, 
-0x60DD66091EF9F724, 0x1713DA394C304A7C, 0x93650F486A1E3823, 0x4748A18300898763, 
-0x5CF0D9565529F133, 0xE04370653045DB14, 0x4C826D11D78C4CE4, 0x33AD7C5A501721, 
-0xD9942C04B985BA1B, 0xA04C0FCD1FE51A92, 0x9CA6E9006C195EFD, 0x4C4553E980A95FD3, 
-0xF8BE423B25A8A7D, 0x5A1F67D1FFB29FE4, 0x91A5BE542B0A932C, 0x63B25B749D19F, 
-0x16A29B9201E906BA, 0xB10E1938815305BC, 0x5608FC5B5B876DC8, 0xA5F59F40A6141C4F, 
-0x198990E366A4AEFD, 0x1F3483AB7FB179ED, 0xD0BCC3CF8F74995F, 0x1BFAC67531314A, 
-0x36080686BF9215B5, 0x602D018177CD81D2, 0xE3641F6027AF998D, 0x3B8E0FDFBB079394, 
-0xD2A122A54B97B729, 0x17F44B964268FFC6, 0xAE4D570FDE71BFA3, 0x14C7D16D56D1E2, 
-0x6466107E7069561, 0x346E8735EDF6CFE9, 0x8555074D6550572C, 0x2BE3DD8E6CE42FE1, 
-0x7D49E486C984BDFA, 0x7E1FC7D4C20D1613, 0x55C7A2DB2D5E0698, 0x1D9DDA3B632481, 
-0xDB9B3258205C48FA, 0x67D583A5A421505E, 0xB3527021E1986A5C, 0x33C4DCECEB1A6B45, 
-0x48D6918C40FE9C8A, 0xCC046BDC8FF41783, 0xB2D54654918CC0A8, 0x3EE566368BFC87, 
-0x4C1AA9CD5080A8C7, 0x12415F1D2B7C1C47, 0xE42D8F52EA34738E, 0x2CDFE05607ADE66B, 
-0xA3C5939C4B7FCF1D, 0x8DDF73AF50F16E3E, 0x31398F59CA516063, 0x1CAC742C9EA0D0, 
-0x4736685D0DC78377, 0x7A9E13039FE5298F, 0xF11631E4026205C3, 0x6525796BAEED916D, 
-0xCC54E633784977F6, 0xDDF4964C37E2E2B, 0xD24A23B4B6FADBD6, 0x3DEFD9719D7A6, 
-0xE322D17049627462, 0x1FBDF2EC1BC4D507, 0xABC696715CF3BCFD, 0x91AB243F06E274EC, 
-0xFC5422F7E78C36AC, 0xFDE102D5DF6E66B5, 0x45790CC96C4AEBB4, 0x331AF62D67FA57, 
-0xC2B0DCCD96D923B4, 0x84FA2BAC0D3C859B, 0xC17ED893C59886, 0xBF948BD94C3DC842, 
-0xE5E8E516AD745041, 0x51DEF67C63D51EBA, 0xFF263CB3B7DD9069, 0x4C7694FFB5BC8, 
-0xAEBE3F2B5F1491C6, 0xC44EEEF5E128DD2C, 0x8254867236B5A579, 0x28009270DB328E6B, 
-0x519CA7E8917CE06F, 0xB44DB1F9E9B4DB12, 0xE3334898D9E5610D, 0x393DAB9885267C, 
-0x85A06E3AE4FEC073, 0xA3D647A36A446ABE, 0xED36ADC92A5A996F, 0xF8CDEF4AC24F3746, 
-0x5842BCE637F98D69, 0x5E77EAC96EFC10EE, 0x63FD47C69362DAA7, 0x1712B1AE643E7, 
-0x7D304F8AE560CC28, 0xF5DAC6B99A25356, 0x1CF4C58415593775, 0x7FCA44231F25C19A, 
-0x4CDBC8ABC051A5E4, 0x72D8EDD946CDAA49, 0xB46753FF109F5760, 0xC307D695E4A56, 
-0x86062BA4B21EB80C, 0x3B42184AA93CD213, 0x5A116C8CE0189032, 0x501CF7F8103717DB, 
-0x284CBEFD3305DA3C, 0x6A08B7B622A34532, 0x712CD8F1816AD4F9, 0x1FD9B26CA27AF0, 
-0x4DD5D695E595A32A, 0xA077A742183FC75, 0x598989699CC18805, 0xC2617B819981E73A, 
-0xBE7C7DF06238CAB5, 0x75ACC7DF17ABCC3C, 0xA07B0F723DDFAB29, 0x3E6FC04801B1E2, 
-0x2F9420C8E8DD440A, 0xD50455326469FF7A, 0x6D2A21A9C77AEB7, 0x1888356EB4EFD335, 
-0x17C9E871EAC65AC8, 0xD9FD6DCCAF50F40C, 0x44903FCF9BFB1D85, 0x32C96C494E613A, 
-0x33DFEBF9BF435BA8, 0x8DE71856F6276769, 0x8C0443A3D1BD7CF3, 0xFA2F513362F81A32, 
-0x3388B27A29F79BE9, 0x8009AE009FC0B146, 0x7C83CBC4821BB624, 0x21AA6406D46979, 
-0x7BEA4D6BF644AC2A, 0x715A3391352B1354, 0xA8D5ACDA8730C050, 0x60EBE04F5D109161, 
-0x456FFE0E23BFE4CF, 0xA3BEEEABE95EE8E9, 0xF7294F5AD4EE823A, 0x4101A0480A75C, 
-0xC9667FEEE14BCBF9, 0x3ABDA0FF19DD27E4, 0x11E9C4C666AF0D2B, 0xB8DB81838D7FB021, 
-0x355EE3390DD73CDB, 0xDE5F26E8A1BD10EE, 0x64BEBD1EBF5151B5, 0x18135EE1C69533, 
-0x29A01240B1C2EE1E, 0x67CAD17532A3C508, 0x54E1853DA437B5C8, 0x6A8BE5F77FB465BB, 
-0x3C076A2CF29A6C19, 0x5624367DB7953190, 0x9AD77C804DB00DA3, 0x6DB7FA8FBC1D4, 
-0xFFC3100EF5E51DD2, 0x110A27EE50654AA0, 0xB1A8A39D27489B6B, 0x3EF9B5FFEB96A871, 
-0xB05DAC70A59657C5, 0xD235E6653A3AA0A9, 0x651BFDEAB80A8CE9, 0x1019F4E56383A5, 
-0xFB7A89D1955B20BA, 0x924C5A87BD5AFB2D, 0xB0B0D6C7D4232D21, 0x8D98880C758D5D1D, 
-0xAC96311AA4B67097, 0x56750BECDD4A6E48, 0x109746A8DA5B66F2, 0x3100355FDDC6FD, 
-0x8C6443628F7AAA41, 0x3BC15BEFAAA1CBC7, 0x7921319E5AA0EC47, 0x8DDAB99D89312A0F, 
-0x3F8A968C2D716326, 0xA539134EE39F9910, 0x5A0FCB7F7A6B8B66, 0x134C6473BD6149, 
-0xCBEBE2065884124, 0x743A7B4068112DEF, 0x978DC72992EA15D7, 0xC95C55CBA28D081C, 
-0xFFE633E4860E1650, 0x35053B4CB601AAA4, 0x2205D2832747310D, 0xFA8FAE9C8FE2E, 
-0x1C7D160D890CDE05, 0xD8742A80A183A819, 0x1886ADF7A0B3BF7B, 0xDBA31CF776DC029F, 
-0x72226680AC97C44C, 0x317CFB844C3A1B34, 0x49811E09CFE94A99, 0x39B448C64B933F, 
-0x61E0EE4488589E90, 0x27789E855B9C821B, 0x86FF520A723A163, 0x887D996B18FACA24, 
-0xD6020E3A901FC02D, 0x1F75E92931EC9BEA, 0xF6CBC3B1A1AAF575, 0x179D40229B56DF, 
-0x2EFDCC85AB8B6967, 0x2D1802D75A852B82, 0xE978331B81D633EB, 0x8C53088A1FC33386, 
-0x9AB4A3352C56E2BB, 0x48E725BAB5931871, 0xCBBE052C4BABD19A, 0x1CC6A97C96885B, 
-0x348427C7A43F127C, 0x3B4E3840FEE58440, 0x1AF900E7BA995443, 0x39C8816ECC8CD8EE, 
-0xEC20FBF864EC0EE8, 0x229113EF2BF000D8, 0x39E5C0411E22843E, 0x220DD50847279, 
-0xB10A9D33B9D56524, 0x28F47398604C4E55, 0x9A40CADE380C7AE7, 0xF9825AA6520E4102, 
-0x4C224E01A87B0E11, 0xE418576A1E9D06A0, 0x974F408227C6F6D1, 0x1FEAF83F938B69, 
-0xB7F679C1EEC748BE, 0xB027B21BACF66B2C, 0xC7E475CD4A4C6D99, 0x60EFF192D2E288D2, 
-0x2729484C78828664, 0x6CE25D7CEE015049, 0x4D4ADC0CAEC19189, 0x2A1152F78A3F32, 
-0xAD8D3EF219B169BB, 0x850C2D3DF19F74A8, 0xB6FF920CF9060745, 0xE4D82DD90B77165D, 
-0xCE88608E441DB5CA, 0xB97932BD74D7358F, 0x3966E6A5E7879CB7, 0x1CC62D760A1BBB, 
-0x87EC741B5D1D3071, 0x1E15992F2CAC10D8, 0xB33834E9C9CD50CB, 0x328F08183F17EF2E, 
-0x4901EBC5CBEF7338, 0xB34D9DE6DA244B5E, 0x63AE35671528DA50, 0x29D96F18EF9AB1, 
-0x270CB6EF9DC49F0, 0xA5905922947D744A, 0x6316C6A2223E6B00, 0x1B7826B9048F73FC, 
-0x957C62E606440492, 0xC180EBD3407C4389, 0x63C0915CC2C1F15, 0x178AE4D6887F7C, 
-0xE204FC1954A7BD09, 0x54E6ECCAA01104E7, 0xCDC90F59BA28C8C3, 0x15F92A53CE3183F7, 
-0x1606EC1AB1CA5BBE, 0xB2A50BA15FB7FF8, 0x5F438D65032FB0B, 0x1E6FF75E62D5B6, 
-0x92C23A92F18D1F23, 0xAD36E265A848396F, 0x3636017D186CE0B, 0x69BF74C8C05E9C14, 
-0xB8E484C2CE33E33F, 0x8B65E50B97F7DBEA, 0x26CE6244F5F476A8, 0x2E0AA168AF4EE5, 
-0x480CE9792B6A0773, 0x8A804F9E0B55BD06, 0x864B17B813A110D4, 0x5D8611F3909603E6, 
-0x44404937761D1C2D, 0x667635DC0E20626D, 0xC88DCB751B28AAA9, 0x144EAEB10E9A8B, 
-0xF9D9C38E6C953A36, 0x4D3E9C9679B8224A, 0xF56F5A259E8A090D, 0x44244EF93A232DF1, 
-0xCAD8CB902EDB37B7, 0xA53174FA3DE07571, 0x9293C3770D1680F3, 0x1E5EABE8851D16, 
-0xE8B33FB4518F47B8, 0x196B5D41E04BBC77, 0xBDCAE9102FDDCBC3, 0xA79BF400A1372432, 
-0xAA64F46BA8F231FF, 0x66CF354F003EC308, 0xC1AF4DF9BE30A866, 0x1AAA5ACE7D8C80, 
-0xEF9E9147D6821265, 0xA75B2DB81C85BD20, 0xE0484E709A8DC1FF, 0xB5E924E6BB15CDC1, 
-0x1400960C9DD43689, 0xC296F66C0CB3B2B4, 0xB3A71ADDFE532B15, 0x16A8FAA727A0E9, 
-0x207655795F5D2ADC, 0x5D5477DA9C7D11C5, 0x41212F9D7C7E7972, 0x6AFEECE8B6194D7C, 
-0xE664272694D338EA, 0xCD9FDADEC45BDFB0, 0xF580EE41ADD39D7B, 0x1BBD580E8D4C28, 
-0xFACD8B3770D70307, 0x82A66D6986974E18, 0x547F4D48AE611587, 0x160921D3650CB700, 
-0x60801A978D0D9FB7, 0x277C9CBA8F9678A5, 0x3F7DCFBC9397374F, 0x3E1A4E28CE9D8E, 
-0x4DBE26B7B2AB6A08, 0x98FE946E2334CC7, 0x18254EEFF78DE57E, 0x67AFF373973C5D4C, 
-0x8969679A022727FB, 0x3CB6E43AC0BE7D66, 0x77642FB4B796941A, 0x33B98EE342561F, 
-0xD40A3759B50F7573, 0x8C11372753F4D466, 0x9E4984B03947D2BB, 0x666C8D2E04AE1E88, 
-0x5E892C34F0DA0791, 0x1DB46CE01E3D2E04, 0x80BEFC1D62E1B981, 0x6FB2D6904DB2A, 
-0xC0A247363371E214, 0x6244F1855C34ABCA, 0x22D7D24AA782F9F8, 0xAF15A7BACE7AE9C5, 
-0xF3BECA4247A49B3D, 0x1E147D42B5C51F7B, 0xC3C945EFBC2F5AD3, 0x2A0223524BCA89, 
-0x91D2F3A32F028084, 0x512590D7978012E3, 0xE0A90BDED483CA3B, 0xD1AB59EB55D3C251, 
-0x9F4ED0A8956C02E1, 0xDE7B72EF9249CAD7, 0x7F5183F0CFEE30F7, 0xFE2576AB6BA88, 
-0x726FA5887421ADAC, 0x1676D2B6343EDF71, 0x64F870687CE0F93D, 0xCA750118FE836D7B, 
-0xE6DC2CA8211A6A50, 0xA94B4B725A483502, 0xFC1E2F013636D275, 0x12BD210CF7BDF8, 
-0x6BD45DF51B99EB3A, 0xE7CA6FAC72DDCC49, 0x1AB6C13B5CAFDDDF, 0x4A9B0FD485D0EF8E, 
-0x8477A8E273011A56, 0xEDD0EA6554B39A6F, 0xDF6CE01A73FC4518, 0x118BDA0E8D2A30, 
-0xEC11592600A941, 0x6367D137AA9C715B, 0xF0B40CEC608208F3, 0x339769FD4D336889, 
-0x678BF0D232FE1C4A, 0x5EC1DD97A896E22C, 0xA46419B9DAA46A81, 0x62DBED4564A66, 
-0x3983A001EA896008, 0x1103D63BBEF8E930, 0xE8141486D35B1298, 0x8E02F260F0C6E817, 
-0x283292B869C9C940, 0x17C9DDC498EE5F7, 0xBDC0DCFB8D8474C6, 0x2DB7C1EFB55E34, 
-0xB523943F5FDAB9E7, 0xD275D27EE4CC7C0F, 0xD76BC10F1EC58207, 0xE8E26A59C19AA01F, 
-0x105E5EE1CC7E2A58, 0xCABF66D6B22F1C0C, 0x3397DF8480CD13AD, 0x245746E2D7DE6C, 
-0x1398F19B7E88C47C, 0xEC612FA62327C4FD, 0x57B9D1C0BA99571D, 0x77E0A094D49C2DD3, 
-0xF1D48EFA3F8CEEF, 0xFB71DC8E5C64A548, 0x9B982376BDEA2E3E, 0x37C94CDE9E101, 
-0xE9F67B5625F5A41, 0x644D19873C84A1C, 0xA408DADF509C039F, 0x8214D7266AC91EB3, 
-0x7E53F617FA48F934, 0x2C43659A35EED4C5, 0x11AC8CD36ACE83B4, 0x3BBA8D14FC838, 
-0x326E7707DBAF3B44, 0xC974444750E9197F, 0xE68A4580BBD2B575, 0x32E49A9EBCFC32F7, 
-0x7F7836B8587303B4, 0xD1DA706FA75886DC, 0xC19BF72F246B7DEA, 0x3C2673CD369D4, 
-0xD2243CED46E848CD, 0xDB22C0D1367A603C, 0xA858569DD9AF37BB, 0x9601D8BCF2A87686, 
-0xA1D9926C7E0541B8, 0x89AEE0321D1B7878, 0xC1FEC1F3B382F884, 0x24EDC04EEFC185, 
-0x1A6B1F3953CFAE2E, 0x9D942A8F71B7914E, 0xCF20CF94BF3E63D6, 0xEC697C1D8C8610E0, 
-0x195599C98E66A49F, 0x65D2B56D04D2E197, 0xC5AF0808AFBDFF15, 0xD7B9D832C7419, 
-0xB938606538D2E35A, 0xE066402BEC86FB46, 0x3D717129ECE111E3, 0xD6175640DD2F5556, 
-0x6402B11EFE03D18D, 0x1DF0474CD636BCAC, 0x1685E1B3A95E02FD, 0x1A1B41B81889E9, 
-0xDD704126FE9623E5, 0x2DCF53207C769117, 0x811CDAE98EB707E4, 0xF875DDE415DFAEC3, 
-0xF05FA208150ACE36, 0x34332602EC012151, 0x432FE5CD48E1E6E3, 0x3925D3D3D47484, 
-0x7179426ED33A00F1, 0xC95C088DB6AC5581, 0x4E9EC64F542AD219, 0x7153EC343C4BC3AA, 
-0xBA1DC1DD293C9F8F, 0x1881CABAEDEB6800, 0x9DBB555031A241EC, 0x71AD25D8053B, 
-0x5C0CBA997A824085, 0x434D27A07247CC24, 0xAD018016D8C15586, 0xE41E2FD2D8CCA16C, 
-0xC4975B92ABF03546, 0x3E766CF785440089, 0xF2C9EBA6EFF8F7EF, 0x357E05442DC70D, 
-0x80F618A6D7458309, 0xF3261350CAEAA962, 0x380A322CDAD4B4C7, 0xB2624E2986C29B87, 
-0xE784CBAA2EB7F53D, 0xE4DFA949C056EF47, 0x93DB8F10959F5992, 0x2EFF3B08B618A0, 
-0x4C7EF82370759C06, 0x8DD04D3829E397A4, 0x1D83974E5AACC19F, 0x85730FD9756CB8A4, 
-0x21D94B25747FE587, 0xF437EC7A34CB2BC, 0xCD158099608EA822, 0x3C864C8E3A6669, 
-0x71C6415D9FE7708A, 0x92EADB843C6FCE84, 0x6DFA3BEB91EA6C70, 0x6030BD32567D228C, 
-0xAF0E82A35C872B9F, 0x2DA0CFA3A529567A, 0xDA64E949AD90C0E7, 0x26DC47B622B3A, 
-0x25181423E9400763, 0xE14B44CEA93D3B7D, 0xA33FCA57BFA771AB, 0x9835CEE72B0370B8, 
-0xADAA1D2AC57FCF65, 0xE0311936E27CE5D5, 0x4DB5E37EB8AD524E, 0x2679AF58DEEB85, 
-0x4683641EC4025726, 0x7FFF9B467854DBB2, 0x1C336F8BE4BFC89A, 0x20A94B7F5C212505, 
-0x12C1D0E912D95C0, 0x6CD81B70EF7A732C, 0xDAE248892ECAF182, 0x1549440735526B, 
-0xFA1E0E3AC620C56F, 0x5EB0EFA160D71BBB, 0x8642FDF632D5EADA, 0x605C7697791FA569, 
-0x8652002F8CF906D2, 0xA014F3C429E8566A, 0xDB759D59E93895DE, 0xFDE585FF9BC3, 
-0xC5860C979D2BC086, 0xBB53690E15B6C52B, 0xF76274D9F5DDDCD3, 0x4454CB6EFF6E4831, 
-0xD2089AEEB8791E63, 0x45C22421D098F5D4, 0x9F20BB6A5CD6DFA3, 0x15CD6C148A99AD, 
-0x2DE16D82F4F83C09, 0xF9B162B6438D8DEE, 0x6CD67F54429A923F, 0xD235D4BE4889A969, 
-0x8E0AAC5A032CC0E9, 0xE807A54C6F6C6846, 0x4468051C3EDD4EC9, 0x2AC7A39FD3C4E5, 
-0xB85D9D098796B113, 0xA30BEB0520D28F9D, 0xB41131625252BAD0, 0xB335024E589BB760, 
-0xD9768E626454EBB4, 0xBF66E773DDAAFE7C, 0xFD12526FEDB08F36, 0x3CDCC46CB873CB, 
-0x8CCB378042EC0634, 0x25D8CE4BE1BF8336, 0x3798034279AD4C7C, 0x88D7F87B59FC3983, 
-0xD5C2C0EF56B02B2D, 0xD41531A6DBCDC0A2, 0x77ED14DAB68168CA, 0x14A1DFEA055D22, 
-0x829D14BE24D678BD, 0x5D8840379FDE8E5, 0xA3104BC1499655DB, 0x54742EE25410D39B, 
-0x413027A42BC6A9C, 0xE8D8AEC5094B7F73, 0x8A3DF4653F45234E, 0x77DD8945A3EE7, 
-0x44F9F412D74C6F39, 0x259C856EEB13B7EC, 0xD1C6D26E90149D51, 0x3E3BCF538F9B3376, 
-0x1A803747214A2CE, 0xB020E263A34976D5, 0xFB61F65E59E831FE, 0x95E16BBE1788F, 
-0xDFA26C264AD17D2C, 0x5E138E8A300F2437, 0x68D77F2A1EFF4D71, 0xD28DF124EAFC7BEF, 
-0xE1C834F80675505C, 0x63EA6F15C66DFB5F, 0xADA30D555E0341BB, 0x2A8A898199ECA8, 
-0xBAA49BE6EE62AE07, 0x9258C939A57D41C1, 0xF3D3F452B6DD9D5A, 0x88FF98FE150B154E, 
-0xD2DDFD099FF0ACCE, 0xEB874A016B9B4BC3, 0x26C76DBA66E6E848, 0x4008418CA0CE90, 
-0x1E5D4DB016D6DAE1, 0x60810577922AD712, 0xDDF55B7B8DFF7BBB, 0x2044BED8BC622EAD, 
-0x32D46DE576BEAB09, 0xBFCFD62A1953FF83, 0x3AF871CCF7AA392F, 0x19D2C79120494F, 
-0x7FB3DC9E426267C, 0xFC685210CE1D5B58, 0x7C7EF55A60C75B24, 0x7C285FFA3FBC66FB, 
-0xA38B676BCEBC1666, 0x3092924CDB204F27, 0xB657A9503A6727B4, 0x1014190F0F0FB9, 
-0x2680476EC17CF0C6, 0xABE893014CF95CD3, 0xF0364EAEDF0BDB45, 0xB2BAD4D4B06AE7C3, 
-0x9A6C75C9F484052E, 0xDD0035947AF5F314, 0x9A5BEC28269AB97C, 0x220FC89C6EB57A, 
-0xB8C19F0909188095, 0x4AE92354F1C281D7, 0xD1CA1DD10916E56F, 0xA077F725AAC3ACCB, 
-0x9C3D694A625F846B, 0x5F9EE25121CDE32A, 0xF0413A9BFC2347EA, 0xEF8EFEA647173, 
-0x6C8FA4E56ED00350, 0xAEE1A81F2E0B713F, 0xF54C9385B0249B67, 0xC3EE61D9173EC593, 
-0x6B1FE0038BE430AB, 0xAA68621AD96D9324, 0xCDF7E1368AC98F50, 0x3B5B77BE9A57EE, 
-0xFD74AE5FE556C761, 0xD06C0EC19856F3B5, 0xEEAC21BF0EA6160C, 0x8516A0565E9554E4, 
-0x8EE3B5855CC1278, 0x3025DD3FC7C347EA, 0x8512196D42276AF5, 0x81417F5BB2E18, 
-0x7623A9326CA53DCC, 0x4E937398F4F085FE, 0xE98B8CE58AA88498, 0xD2FFDD7F6AA2FD8C, 
-0xD85CF1462395C453, 0xD00117764180B843, 0xE288B98ABBD8DF24, 0x379B8F9E1C440E, 
-0xD4840E903346B36A, 0xA79BB4F4887E14E6, 0xACC280946B4C2BAF, 0xB091C85E460D69, 
-0xB60F4F6CBD1FE539, 0x46C57C4ECD6885DB, 0x6DA4A2E0A775B7DD, 0x110E256455D62, 
-0x62C4EB49B761C1AB, 0xB6D878926F4B22D0, 0xFDE806E02D71D9D8, 0x449744FB96838D0, 
-0xE0CF7FD5ABB8F4EC, 0x2417CDCBE5DB4092, 0x1B81B71D573C1F, 0x97D9DFC1EE850, 
-0x25EA5177B74CA8FC, 0x667A16A861A0200, 0x21A67BF5638A9455, 0x4C4ECF1C74F27A77, 
-0xCD31C1C95B76061A, 0xEE187C4EE1DFEBD2, 0xDBA458303BFCBADF, 0xC7FD57BA420B5, 
-0x7D960477CA6BC08D, 0x71DB24E2D36601C2, 0x5B26AA041427DBD4, 0xAD28AB44FBEA48E9, 
-0xD847CF6B53442166, 0xA9F1427040A2034F, 0xA64875DAB5516095, 0xD98C0691BC588, 
-0x530087A2685049A9, 0x997A435E795C8B70, 0x5C4746CBEC6FD705, 0x4F857FD5175D3663, 
-0xD661377857B2F30D, 0x86CF368A1261EE7B, 0x4E93D2AA58F8CF2, 0x38B676053BEB32, 
-0x63D0F40EFA027D5A, 0x2846FDE6D92AC4FE, 0x29AEF49497C40615, 0x1B42FEF4743B87BF, 
-0xDB207C0A79A196CD, 0x8BDB7204079A29C7, 0xE247E32F34C63BA4, 0x69AB83D781F71, 
-0x25578F4A7C5E7733, 0x83D8D6C23C13C091, 0x693CADCD6BE004B9, 0x2CF35857042EDE6E, 
-0xB7A7440B1D98A4B1, 0xB0EE32E5CD1EFF9F, 0x6CA8EDAA9816A435, 0xA307E60F9C64D, 
-0xA0DBDEFE00A7C3C, 0x234F8748B4B3A097, 0x84D97B7ABDE189AF, 0xE25E0DB63773C6A2, 
-0x4852C95B91EDFCA1, 0xC0F3F2A1438E30D0, 0x40083815C3E8F1CB, 0x357BBAACDA124C, 
-0xDAD856970F358060, 0x95183BA93EA5D9AD, 0xC84F31B7374C1E3, 0xCFC5B468BB365F29, 
-0x8DF28B0CD5E1C746, 0x30C888536F994C5A, 0xEAD23071579D3CBD, 0x92CB6D6AA53F6, 
-0x31F128BC03D90B7F, 0xDE704C06464EAC02, 0x919FABB9762478B0, 0x74A90EE7607F5432, 
-0xD301C10B1B7280D7, 0x9E1FFD9310105007, 0x899CB3C5F5285CD9, 0x1D257C0CBCCD4, 
-0x3F3AC59B62D02E5F, 0x5B64111CB1EFF9F9, 0x73267ED600B5CBC0, 0x91AA3942B5524F65, 
-0x93423757C29615D7, 0xAD87D97BFD8B7F33, 0xCBE079AA15819A59, 0x2E2A981EBE8219, 
-0x477B1A89DE2AC4E0, 0x3C491F7D20424C7C, 0xF73DB38604D70C42, 0x620A02E2CE11B9DF, 
-0xFA717D739E39D3B0, 0x36E2425F175EF98B, 0x5C77D9D31FF6AA68, 0x37DD8954DD017B, 
-0xCE1854AD5D1B5708, 0x8A563C015F46D2F4, 0x79487C3F31D83DA2, 0x5950B96B9A686B54, 
-0x4BEE0EC3BFE1185E, 0xE54DAB0A9C910779, 0xB7E7D8931BBA53E0, 0x3518151D902811, 
-0xBBBDA130364A1569, 0x42375E17B844072, 0xA83833AAB45E103C, 0x7024422869721A80, 
-0x449534090692B943, 0x10AD5999BACC9A49, 0xB20D8A3E3538C68D, 0x185BEF44DF3EC1, 
-0x76B2E6ED88A82A83, 0xB87AC3C8A5A03AD8, 0xC66BBEF5A7D01448, 0x51880A8AF804F718, 
-0xB889C273D8BD50E8, 0x51B417267EBB6981, 0x74E3DB3AC255F77C, 0x18DECB12D605D7, 
-0xADE1DBD911589F69, 0x836B5A2F996FC07B, 0x1246C1C7B60A2E5F, 0xFC9E61129F5D1C3A, 
-0x53B23569AA593215, 0x3C44190F4FAB0593, 0x52E40C75D82C3EF, 0x2A79DCCF05EFA1, 
-0x765951770CB0DCF, 0xE3D7DFB47A9980B9, 0x78EDB7FD4CF668E3, 0x7625D28BC58183F0, 
-0xC64DB579E71CFB6, 0x95C23FBC88D0F062, 0xA30413828F451224, 0xCEA8A98BF9B00, 
-0x45D2571012E58F2B, 0x86754A706234BF7E, 0x6DBD511D7071AF30, 0x409312F7D7B7354D, 
-0xCD1D892D99CFCF98, 0xC5FCB930B07B01E8, 0x5ED13849298632E1, 0x1BAB757651EA63, 
-0xB830B66C0DE9D1C, 0x2524C890118D3520, 0xED55D9A7F2A572E1, 0xEF847CD773379690, 
-0xBFF784D6EA3CA0FD, 0x69E0319628D2F8C6, 0xE301F5B198DBCCCD, 0x160FABA219DD63, 
-0x38AD04EBA916D2BE, 0x2A3E39755CF5434D, 0x7409225BEBEEB85A, 0xAC1D485D4A8B3A50, 
-0x6ED6D3B871680267, 0x59232244B3F6C6B5, 0x44F534C337386FB7, 0x84FE9D305B11C, 
-0x5BD07669558DF112, 0x70285DBC0D331BA7, 0x64FDFA5E5D328DA8, 0x37CE823E8A5EAA68, 
-0x175101A9F44EB2C0, 0x58544362CC1A0FD3, 0xB8A2CF805092028D, 0x2A6AA2A6192001, 
-0x9C5A8BE914DA27D5, 0xD5697F951F850483, 0x904589DFD67C80CF, 0x8152A2DB14DFA827, 
-0x751D6083EED499B2, 0x125353F10948B575, 0xC4F849FD97ACDAA8, 0xA918D254690C4, 
-0x1E0100EED689CBB6, 0x43F9ED46E1E4E9B1, 0x29A1E63DB1DEBF84, 0xF88F422BFC0AAC18, 
-0xBE15F1B23C4106E, 0x514C14A93F0DB9A6, 0x5A1B7AC694411921, 0x2D81FEEFD3C823, 
-0xE98F400ABE5659B8, 0xA24EB8FFEFF0EFBC, 0x935C5759CA277111, 0xA5330DF913AE9B28, 
-0xC47D645870009FC, 0xA5066A889BB105E2, 0x45922D13F943BEA2, 0x27CBA4B5241B13, 
-0x897B0EEDF58BBC41, 0x98E38BD882FEE876, 0x5A19A8A1E2C34D66, 0x60A3AF0A782C20EC, 
-0x805A5818AA3B9F6C, 0x585BD71EC49D45E6, 0x60456E9248EF91E9, 0x185E1640BF851B, 
-0x8DA0177AB3AC5DFC, 0x2FC2A69C2BDAB93, 0x9821AF901999A336, 0x76E71847B000C1AB, 
-0x9901FF41ED78EB79, 0x9A3591103E9295E9, 0xCC789F5D2B5F9C51, 0x2D44FF2C27ABB4, 
-0xF1FCC6378950C5EA, 0xE31690BD5CEA91AE, 0x5B1891F4EC467070, 0xBAAE7E8D2D363535, 
-0x5C5E26330E7CB480, 0x3849A1421A86E02B, 0x78304D9ACA1FE321, 0x1AE8F0CBD8075E, 
-0xA635C23C3987C859, 0xB3C1E069C69A5A38, 0x1E4D360146DE681, 0xB583015DAB0BBB4E, 
-0xFCDAEB07EB09DCFF, 0x469C8757FD53B231, 0x95551E1E2221F9E8, 0xDD44163E40EC, 
-0xEF96CE955867622C, 0xABF76671AF13E49D, 0xF2CD534F6BA6174B, 0xE96C3C39DA399CC1, 
-0x3D772C0929802AF4, 0x234604F2DBD61850, 0x2B1B68E2BB2B76BB, 0x2403085318D4CA, 
-0x1C93D71AEC9EB2A9, 0x8A196FDA79733648, 0x12E2E3EC67B7CB72, 0x4ACA7CD788BCC596, 
-0xB0D0589BD1775052, 0x77D5851967522FC2, 0xF7FCEDD9977A673C, 0x2226337D349572, 
-0xE9B50A4300B3D06A, 0x5EC82FD55EE0FF0E, 0x72764B0625CD4500, 0x98353FE4BCD904A7, 
-0x4CA543D06094332D, 0x86B5AAA64FD3E6D, 0xB2EDA05DEB451160, 0x327156BE72728E, 
-0xD99FCC134F65EF19, 0x3E2F87EDA795A170, 0x7C5B444B6814FFBB, 0x2FC0F09B668D28E0, 
-0x44CB2D58B82758AD, 0x97727CA3C8A1112B, 0x410F5FE5178E1BA9, 0x28D45F256842CF, 
-0x6952251403957405, 0xA5BAF15EC8613C37, 0x6576C085D04D5AB2, 0xB724F281F6008F65, 
-0x6A606BF20BDDF86E, 0xD9EB3A6E9C2947F7, 0x6DDFDF2FA7D425AA, 0x3178DE840C2998, 
-0x88C279932BC88A7E, 0x3E6124DFDEEF11D7, 0xBBA4DCC3A60D82A1, 0xD87515746BE8F535, 
-0xD33DD1D40E1A3236, 0x62EBDD67878D916F, 0x3B8B2EF5712EDBE8, 0x339B5201BA38DA, 
-0x36A0387E8413CD76, 0x8D76D58B224D4496, 0x380F7653298A22E8, 0x44A279C01EE651F0, 
-0xFF837667CF10A72F, 0xBABD35D519B3B4CA, 0x372B65DFB1A28157, 0x3B9109B9D11517, 
-0x2A7D3FEEE19C8AA1, 0x3D307F1163200FF2, 0xA0CC490B269C86D0, 0x9B9847FAA23CF9A4, 
-0xBE1C9959C9C36971, 0x46787A0F12454ED3, 0x72D7631A90BE7336, 0x3C4581032D0DB7, 
-0xDB91CDA344C176CD, 0xAECB25B0B052F200, 0x1A66DA45D80E2BF9, 0x60B4892A8FCBDF63, 
-0x85A2F904A5A9F6A5, 0x3D7A7D951F95C8E6, 0x97454E4A8EE48802, 0x3B7A2CD6B42C1B, 
-0x2481649F75450EEE, 0x97E471AD7ED219CF, 0xAA19750F3D18E9A9, 0xA8EBFC572F2A8E58, 
-0xCD18019332CB01D1, 0x6EDA18AD7A8C24E7, 0x28AB46842647BBE0, 0x2C08856EC636A9, 
-0x3BD4ECA256FAA97, 0x171A12BA2056EF66, 0xBC269634F9180968, 0x2E1A23617D4D1AFD, 
-0x2AC8FFC841A9C40D, 0x3828837ABE425323, 0xFA9624F6DA20B100, 0x3CE1005CD9EE25, 
-0x8FE400A0740F4091, 0x840B8730541CFC11, 0x53EC4B497585519, 0x81399D176E0FFDA0, 
-0x9C612633DDB353B6, 0xB2B89EB007A3B15C, 0x1B7BD4727DFDA094, 0x273C066A578E5C, 
-0xA1878DD95D86E217, 0xF285C5122B6C4F0B, 0xB5B7168A0FAD4B41, 0x45E2CB08BD53E211, 
-0x2E8316227D57D4C0, 0x53CE5E42EA5C2F5E, 0xB26EB4F46DB0C10E, 0x13C6F1F49CB306, 
-0xE1C6738AD2568643, 0x92A1F12FC2084B35, 0x49CA8334CD44D75D, 0x68ABAB76BE12960F, 
-0x230AD76C96E21F10, 0x890F216417778E88, 0x17D21D8AB028F08, 0x6329633511AF7, 
-0x772AED680D5A8D81, 0xE24F881B033566D7, 0x4935CF4CD5C3A262, 0x2C25E1F8367D214E, 
-0x288DDEB3D62167ED, 0x75CEB293E2829615, 0x5FCBE81410658037, 0x199BFF4C4F0043, 
-0xAFF1320C7A738E2A, 0xD08F51A3E7EA8E07, 0xE5DD52189BE94FE3, 0x8B3314A5F8E157CD, 
-0x785B07F0AAA53F18, 0xB2C4159680F1D550, 0x79CF060030ACE467, 0x200A285D040ECA, 
-0x4ED38856E2C19044, 0xCF54B5B921B916CB, 0x252A2A7F828D9FB4, 0x6A0023C352F14368, 
-0x78FE27DECA43AA99, 0x27E962F4020DBEBE, 0x82CDA38BE35C84C3, 0x3C4350242681F9, 
-0xDB06E86338544A68, 0x23EB4AD1F3DB459F, 0x1FFD9DDA4920886D, 0xD8E743E0A44633A3, 
-0x4A76640E862E4861, 0x9020512895F8AD41, 0x1E3EF9B0C152A202, 0x21EADECF7145BE, 
-0xD9E28E19BC86A08, 0x3748071B4E426F03, 0x9C8E4C44436BA202, 0xD78F61128CB058A0, 
-0xBC2C8B9BA4368388, 0x8ECB1A8DCDB93FF5, 0x3CA99DD4E44597A7, 0x1348D6300281AC, 
-0xDDE145E559E84474, 0xB5009516C54D72EF, 0x9B7D4F6A607966CF, 0x4F9C4C4DA83D622D, 
-0x21D301A9EE542DDD, 0xBE43D9269CBE9EF1, 0xC4F1E2B21ED30757, 0x3BC5B96EAE73DB, 
-0x899C792EFD35F980, 0x6E99D4C8E29027D7, 0xCCEE7516BDDD69DC, 0xB5443FCCDF8D829C, 
-0xC68C580E9255FC9, 0xE1D1472D74584187, 0x3A0B124D78601669, 0x191E01CD0C3BF8, 
-0x56E7562A330ED7D7, 0x8B60E6FF8A3EAFC3, 0x4B093BE14B73166, 0xA31C1B506AEFC909, 
-0xED9477A481D2894C, 0xC4D587D3354FC3C9, 0x46B89C253A61B565, 0x2D76F4BF599B9, 
-0xD102F141B575E2FA, 0xFFDE0CE408638C1F, 0x563F0DEE374B05BC, 0x644EBCAE84F29638, 
-0x21CBFE06B4D1B0DC, 0x8AE8900CD49334B7, 0x7F568CAFC14343F1, 0x1E168BB9F71C29, 
-0x1F301B7FF7B393F9, 0xF132A0E89CA89F89, 0x23F796E0804E4C7F, 0xE8FFF91A2D277005, 
-0x3DEFFE0F4AC34B50, 0x84E4DA7EF4747C35, 0x15477CC152335D9C, 0x1FE0B75AB72BB7, 
-0x1078353CF384299E, 0xA978861DF7FFCF28, 0x1524F4B9C70179A8, 0xDB5DAEBA282E3148, 
-0x52ED795E67444BC2, 0x3093BEBACFC8C1E6, 0xCC5535571728CFC6, 0x1907A1B140555B, 
-0xB3584D25ECD625A0, 0x84B515DC097BEAC0, 0x83877F238974F262, 0xF3E810931FC01D8F, 
-0x7138E5FD263E65EA, 0x99559233B3EA12B5, 0x1A6ACFA720A9B00, 0x18F4444CC0DB03, 
-0x4C526E5370862804, 0x94F741702BE280B8, 0x94FE018632BC8B4D, 0xCD6018A9BFD734AF, 
-0xBFDD861CDA02A87E, 0x8B0974115E5ABE99, 0x7A49B078F76672FE, 0xD8A8C9D50F044, 
-0x534319E087962457, 0x5656C54C7E3D33DA, 0xB1E58CF193722D73, 0x89FDB13CF05E5B84, 
-0x20CFB64F2CF487EE, 0x1C0E70D1325D9E0C, 0x57792B409D24C89D, 0xFF6B2FB5B6DE3, 
-0x58BABEFE319CFDA0, 0x67C17AB6A603420D, 0x2757808E9FB7097C, 0x1BF509787C636D77, 
-0xCC6BB9B1DB5D431F, 0xD3BEA2E8FFE80152, 0x2E38636FD910C1FD, 0x38B7DC1ABA79C5, 
-0x65AECCF4D6B335B, 0x2724CEB70D9E6B2D, 0x7821F2EAE7C957F3, 0xF4E1F36C318E9681, 
-0x2623639456A27A8A, 0x8D0EA70AEB1253FF, 0xA7FFC10017C90885, 0x947AD67FBE54, 
-0x264510E2E839FD90, 0xAE6093B709F1F9E7, 0x290451B3091878D4, 0x9DC2C6FA8C93DBC8, 
-0x3E6D927430FBA1D9, 0xBFAE5BC99F69BF89, 0x8B002DB6A3E8EDA, 0x1CC0590E8697A7, 
-0x6EA541D87491FE14, 0x8616A8CB94D5733E, 0x39DBC3DABB094B90, 0xDB2006C8D5E496AF, 
-0xE1FEC3FA1C1474EA, 0x1CB8CC0DED043B05, 0x6677DC7BBCC8491B, 0x2E2C4BEE80FF08, 
-0x3FE98D284F449A5C, 0x8A0EB1908C7CA5F9, 0x3E374719DCAA5B7B, 0x204AC94BEFB7FE5A, 
-0x641E9B47BEF58254, 0x95EC03999A2AE744, 0x73F275BF7BE3A84B, 0xD2F9C51E7F915, 
-0x90F84D8EB0C2ABE2, 0x335C5A5486CB457, 0x565C20F2E98D77DD, 0x2614B113E60AF7DE, 
-0xE2F8FD343768D607, 0x57BB78F6B2A7BA37, 0xC337768F02B3A9F9, 0x370FFFD9CDEFFB, 
-0xD88BD6E085AF9870, 0x75E77EB02AA0F8CC, 0x473C5681FB42CE24, 0x5E71ABEC78BD3C42, 
-0x2F7BDDE02DACB82D, 0x7CA21A7EAD71FFDB, 0x9E22C01E969A6682, 0x31E66B6896291F, 
-0xFDEB56876C0B351D, 0x2F6D5EF5A5206994, 0x76789E358FD62C3A, 0x558DC0793AD13F0E, 
-0xE2C16940FE1874AF, 0xD5B99973D17DC2C4, 0xDE865DED6C51C47, 0x258ABFA61D3FB7, 
-0x88726D458EF35AF3, 0x8A9FF7ABDF529D6A, 0x3B11A254C99EC670, 0x4E5A6A36504C751, 
-0xB3BA634F5D68A91A, 0x6660A8E3E3D7D04C, 0x1E096A449251B49, 0x33EF842D0C46, 
-0xE12B899C7074ED5A, 0xE10C4149914E3AE9, 0xAF96880E28FA3319, 0x57CB7EC13265C70D, 
-0x47483AE8E6FD0B5A, 0xFB857A766A846DD6, 0x14CD8DB953AF8827, 0xFD67523C8B000, 
-0x7EC67B3F1DF73667, 0x71E2D0EBD5E345E5, 0x378B8FF1B8CDD35A, 0xC94615E8FC2F8447, 
-0xF7C429D0255302C4, 0x18E03608BFF9CEF, 0x88C7692BE23551FD, 0x1567F219D40536, 
-0xF00C4F470373EF04, 0xC67D3A96938ECFB6, 0xA7225F8F5087993D, 0x783273B5CF9DED34, 
-0xF8D5B5E7E18B6B20, 0xDDB3224086E653C, 0xC974EF4E91B9A29, 0x1F4E4DD3E365C9, 
-0x3FB1AD1817E3FFEA, 0x8C8CC25D5B1ED8E6, 0x59C6CF66FFDE1405, 0x42FC2030DAF5FF74, 
-0x2C0054FFB4958D13, 0xCF78481FA8FE53B6, 0x5B4AD68A3DB277CC, 0x331D2854347353, 
-0x3E468E8437867A28, 0x67AFBC354AF6BC9A, 0xCE9D7DDECE7D5CEE, 0xA76E6C52D07DEB7D, 
-0x63648F4D37ABEC3F, 0x9E90547C6393C024, 0x8586693660164EB3, 0x35F8F2E81A2CC5, 
-0x88219AC7A6390098, 0x36C594C219377691, 0x45AFE246B805A101, 0x5E2437F2E14398EB, 
-0x72F24E994955901E, 0xB767121ACED08D25, 0x9D7F24C87EE11F, 0x15B34704FFF7E6, 
-0x73D0D2987EEC815E, 0xC0F153B445044583, 0x2D13A95078097449, 0xF0AF4EFC0738D7E2, 
-0xA6837163F3B19981, 0x65391EEFC292C0F6, 0x4DDD2F14060BD77C, 0x2BCA15F975F430, 
-0x5A793A91FFA3DDE6, 0xF0F06BB2571179ED, 0x59C51CCD75ACBCE7, 0xF94A139E5FE49B91, 
-0x851F270200EBC7BA, 0x988312AAA0AD9A7A, 0xC695EEE6FC2DC4F7, 0x2D3FBCEA3E73E, 
-0xE286823819BACA6A, 0x2759C962924C36DF, 0xD65C6EDA2F4D5862, 0xE23A4CCFFC9B0BDD, 
-0xC6755B34C2BAE354, 0x1E79CD295E0B61DC, 0xD8E0CC11102A4B, 0xA65D9DAAFECF6, 
-0x57F5B3396AE7EC7C, 0xA27880994C84CEB0, 0xA108D49B1CB7774F, 0xFE3E9242D8BEF8A9, 
-0x5913BAD3CE790C53, 0x6F9D9F7BC7D2EF9C, 0x2465A683306CEFC8, 0x22CF994AE5864B, 
-0xA66E7E8701637B98, 0xE6295372DCE7E887, 0x1E3D485FE79A23C8, 0xE22C64421839F69A, 
-0x2E6E51A78EBF896, 0xB4D527E563148CE2, 0xBEA0C8D6D7EE8851, 0x16AC25ABD334D, 
-0xD8AFC0EE42ECD5D5, 0x6D7BBE9EF122F4E8, 0x88ED0DD14F9D1AEE, 0x41F5836D5670B9ED, 
-0x8A2C931675330477, 0x9E3D9654C69B67B5, 0x95BF68B8F4327444, 0x254AFB0B811C49, 
-0xFB5C4EF03B77159, 0x443BF4FB9F4914FB, 0x3AB41756F336C9BE, 0x79B213E3E518DD3F, 
-0xE45D06D509B41EA7, 0xDF6A53BC1807B152, 0xE42196825D5327BF, 0x366947BC79F193, 
-0x80E8D4681BCCA9E4, 0x39BE06E229CEE4AE, 0xEA74585486FA9228, 0xBAE2F41A170ADFED, 
-0xCC5707B9E6A0429D, 0x3FC8776414806C29, 0xD1F07420DAB33D09, 0x1FB59CA2FD9800, 
-0x79F0B4B4449CA594, 0x27D0EC71A18226C7, 0x4B2734B295638CEE, 0x6801E3DDA230D3FD, 
-0xEEFFA0D0C6081952, 0x21B894593FAEEFFA, 0xB60F389B24BF6B1F, 0x32FC08FA154AE9, 
-0xE47EB04D5C81E19C, 0xAA3F2545032F1A11, 0x325D4581E1CE996D, 0xD0125121A923E222, 
-0xC527FCE909272E02, 0x3669B2D3A145CAD, 0x72112171C3B2D57E, 0x3FF660C2005158, 
-0x16ADB9E27456C1F0, 0xE8219BE1FAEEEE12, 0x3A96D265F5DB0522, 0xA46E92015BD360C5, 
-0xE18A0487626297EC, 0x10D6EE1BB4D8272, 0x21B902C03EE9AAA, 0x80221C2E3C41D, 
-0xC7CD443A6E6BB30, 0xBE1933430E6967DE, 0xA1E370D0D1C6373B, 0xE048F1EB79C5C492, 
-0xA6B28B98662C0FC7, 0x2A18110FAEFF1A47, 0xDACC9A98F1BB5758, 0x2E38D9C8C9F209, 
-0xA4435EBEE9B49AAD, 0xF1252C691A48CF4D, 0xED2B62D2D58817B9, 0x3840B55A490DA8D5, 
-0x49B468125286BF91, 0xE16486E895F446BF, 0x79D6096194AAE22, 0x3C51A8C2DEDB63, 
-0xE0EEEDABF60910FE, 0x7E1D5FF49EEA87B4, 0x13843C67A3BAF041, 0x2AC81A887206337B, 
-0x138CF0E63867C661, 0xEA1C59BE06304587, 0xE751ECDB4597129B, 0x31F54E26C90BA3, 
-0x19551D83751E330C, 0x85D9DCF7389D2C25, 0x6848A69AE9DC1405, 0xBB637575E177B1, 
-0xFBB724F3AED0CA34, 0x8C428A035D2233B2, 0x63F51A9E8E9E4328, 0x1EE9EFDD7D31BD, 
-0x8F82A17784790121, 0x3398A3859A81FF55, 0x3A5F7FB3EB5AA816, 0xC804CA97D1948A91, 
-0x2D6BA62BB1FC4D23, 0x97BDA6D05605C1BE, 0x7A492FAF39090CF9, 0x27C0C804E3920E, 
-0x3D510F3318EC4EE0, 0x10D6D9E74214CCA4, 0xCB21734F9EF49E2B, 0xE0D69AB5CA53425D, 
-0xF2B7A1E1691668E3, 0x64362A95AED21DBA, 0x40709095BEC431F7, 0x3D7541B546F3E8, 
-0xB3128A80229847C8, 0x4DA8243E270A36E1, 0x70F7DBEBB901275F, 0x78FE0548777736D0, 
-0xF55BB9F9AA1DE88F, 0x8E6E8178F70CDB21, 0x7EC2D14365B7D5D6, 0x1F8F67575D7CAC, 
-0xC5C9AE9294D64EF4, 0x8D822BB1933C2CF0, 0x16B2D8C093FAE622, 0x1F44EBE1BE627B82, 
-0xFFCBFDE53973E979, 0x3F1793F0DCBCC798, 0xF6DFBA0B80C13F79, 0x3608147B8B7324, 
-0x4FE0EC853445D58C, 0x5017B8021B4F19A6, 0x53DDF15CCFFC3BAD, 0xE66585612E7DBFD9, 
-0xF922291E71C9ACD1, 0x320E83BBC9070109, 0x4B9EAE0373921B72, 0x12D85F40056F5D, 
-0x313B0098A7FC1C30, 0x27DE97D14AA410D0, 0x8C9C363F450A3057, 0x3E91F992D7FA07C9, 
-0x90D24F7AC7C32E7A, 0xA7B8CEDE6159DF8E, 0x6F3D1C0FB1524A8E, 0xEBE5961655E26, 
-0xE34873BB17BFA945, 0xA92137B991E385CB, 0xC1814049F0E21D2, 0x4AC3D59AA6E6584E, 
-0x7451D7266D218A1C, 0x7724215D749094B7, 0xB0C45837459D1EA5, 0x1504D0E84D8807, 
-0x12F369F669F2A978, 0x2EE50C7990DB1A90, 0x46669B0A5619C8AC, 0x90556C871A04E829, 
-0x55CD5710D25F788C, 0x58FAF42D7CF7FF78, 0xD8AB4BC26F75CF7B, 0x2BE0E0734C10AC, 
-0xF511BFA9E282D87C, 0xC8232FDC845D13FB, 0xDB7E476E0F92EE1A, 0x6B7FC0A6911ABA70, 
-0xC4C21A7C308F4CEF, 0xDB699286D7FE43D, 0x3941ABFB914F1AD8, 0x3020E25EBB5946, 
-0x3101DD85C96F272B, 0x2C9642E6D400E52A, 0x7F6DA080EDFB5989, 0x52663ABEED863F43, 
-0x62EE49D4D6C7B30E, 0xE1C47B7E94A1EB9B, 0x88ABF2B89D7DDA4, 0x30479E53A5072F, 
-0x351561D504EA8FFD, 0x96353F8C28AC6426, 0xFC69CB58899C6DA8, 0x516DCED255EFC183, 
-0x9188A3908E68C3D6, 0xC2D22ED76F5AC486, 0xDCFC0C7EABE745DD, 0x5FDFF94E4D514, 
-0x3DD2B1BE08F16AC1, 0x917F85F5F0E1DE63, 0xAD54D14254031604, 0xE1A1490C1ACC54FA, 
-0xB3E9DAF0D786AB50, 0x408C36C838DAFD47, 0xE34A2FAE98180C9, 0x3589F2FFD78A08, 
-0xFE284106596E970D, 0xAB7876CDA9411B88, 0xCE6FD98B93A957D7, 0x43E31C5235F46C2F, 
-0x83A95A018F3F9AA8, 0x8382441DA2A4F8CA, 0xC437D69EB223B823, 0x2CB5C87FEB6228, 
-0xA8A403CBA0FF19B0, 0x5E266D267662D407, 0x305B52CC7A5002C2, 0x41333DB1FC47D0EA, 
-0xD42B784E8A61BCCE, 0x4A2C55C2C5638479, 0x508E5D81309C176C, 0x8A1452129B32D, 
-0x423B728B9D9F09D, 0x82C0C848ECA75D67, 0x41BE0C82CE9EC872, 0x7DAC8A3D03B6F3D1, 
-0xD62B0DAA5DE7B0CC, 0xF75E36CC36C0E010, 0xCF6D22012F5DB24E, 0x6756CB5FD63C6, 
-0x468786E1FB77CAD0, 0xEC7B5DC72ABB8957, 0x619F42EC9878958D, 0xB456E28922D96701, 
-0xA815781D2E09641A, 0xFEF512A0C6A5824D, 0xBA0CBF694050837B, 0x39F5C7A9834512, 
-0xD4A0A89E8C2D4F, 0xF1917D7CA2F3481B, 0x87B9FEF6F9CB3004, 0x909227614E099978, 
-0x99EB7616D021247F, 0xFE01E74767AC401E, 0x274EB769B629B0F, 0x14E2FBA95121C9, 
-0x94A75A75BBE7FF2E, 0xDA75BA6E23E5F433, 0xF828BAE75AF9616C, 0x311DD75CA4E89118, 
-0xF0525B171424E0BE, 0xBD2B3AC01FCF5A66, 0xE35EB80372499014, 0x309B01EEBA916, 
-0x8A53B2AB3C3A3109, 0x4D9198E1D3EC01D, 0xD8957BC70A7BC831, 0x753692B7A1CD24DF, 
-0x4D089A39A4BA3F3F, 0xA47D6E44451D3CDD, 0xCDD52E28082F56CA, 0xBB35BBCE29F6E, 
-0x73419EF74C26CCD0, 0x4B8FB30AE5CF8D16, 0xFE08B15FEE594BFD, 0xBEB8903FF717CBFA, 
-0x98DBC53912A6366E, 0x3241ED9977C0665B, 0xF469020E692955FE, 0x39899AF0CD68D5, 
-0x8425E7720221BB70, 0x30B9D738F5F077E3, 0xAABF0AEC5528476E, 0x6811B185BC271733, 
-0x73EF819E07A6EF0C, 0x4A5DEAA3C9F04E58, 0x559318B98B4CA196, 0xC3D5A971B047B, 
-0xE715475BE4A170FC, 0xA3F00FBFB950F535, 0x49AF6397219ACF01, 0x3EC2DD71C0EEBC19, 
-0x80C02F0F1B51223E, 0x8F435BFE3822ED5, 0x581D8FF1FCB9A556, 0x2B8884E95B483B, 
-0xA222525FCBDBC192, 0xBB37D760DF9F19AD, 0xBE5F9CC0659474C0, 0x1C3F4819D93C509, 
-0xD6D42E075BF202BD, 0x33C131154EFC9CE8, 0x3EF65690ABEB6CA7, 0x1011D066A3F3B5, 
-0x6F350B41B0E2030E, 0xEC5AF6CA1C8018BA, 0xDA19B9C99394CDA7, 0xFCC1E865B0CA7E02, 
-0x74608F326FD050A3, 0x9C1933C5C0CCE223, 0x3D3B0B3904225B5D, 0x188901582632B5, 
-0xF3E9252EFBB346D3, 0x14443C9A9E2F5BE4, 0x74B956625B2153B3, 0x77A59D98B8E2457B, 
-0x68FEFBB7ADA985F3, 0x53F806100289FC68, 0x61AA662C51047ABF, 0x20DFE3A01FB45E, 
-0x99AA6B1A45651321, 0xA3CFE7BCCF5F6C4, 0x7DD26CC880D1B995, 0xACB2743D18121404, 
-0x212503804A04AD7C, 0x93B8394DA1FD4B64, 0xFAE044F5F79D9D6A, 0x2ACB5B533C5C4E, 
-0x2B9FA38F8721215C, 0x94E6A61157AA0B3F, 0xC81C29CE24BFFFCA, 0x79ED54406AB5D2F6, 
-0x308759D82D3AD61F, 0x3C2F7223C19FC661, 0x7CC6D271FEC79528, 0x330486350857BF, 
-0x26615F7B8A62BA0D, 0xF4A7B78420E031E3, 0xB7F47119011915E8, 0xBD2D4DB8E56BDCD3, 
-0x762A8954379A958B, 0xFB34A0518B0DCDB4, 0x3205A9056032DCAF, 0x1813377CFCDDF6, 
-0x6848C716E24720D5, 0x8DABC858C3DBB58B, 0xDFFCB828D7C2D8D, 0x4E65D59EC6D37BEF, 
-0xC6B4506B81F4EAE2, 0xFDA81357F04479BD, 0xD00EECE7E0C089F4, 0x2750E0210210CF, 
-0x988FA996A8485EEA, 0xA0FB1D79FC34ECCE, 0x439A5E68F976E925, 0x3883FC15F3B3C96, 
-0xA4A7659381F01D47, 0x3842CDD791E3968D, 0x3D52DB376AC83AE8, 0x384967C5098F2E, 
-0x9A06CEACF43F197E, 0x4B496A033C0B6D4A, 0xB9D10FF000937F02, 0x8DD87BB11653158B, 
-0xA230C5BA53108202, 0xD80F55306423956F, 0x2AE258BF1549D235, 0x21E435403E3437, 
-0x6198EE2290442495, 0x1A395D2F4ACBDF63, 0xA2CBCB0BCC9BD812, 0xD79435864E1CE8FC, 
-0x22DBDF46B212323, 0x394B4DA3ABBC9F2C, 0xABD92B2C1E3811DB, 0x379CA219886F0B, 
-0xDC62B3C45930FA21, 0xA345B17AA2F3A849, 0xC6DCE60D7EBDF424, 0x11622ED918D97D6, 
-0x253F30B81DC90DF2, 0xCC419139FD6BD18E, 0x23EEFE20EE3DD71D, 0xF9CD931AED018, 
-0x617415AB2036F66C, 0x386E82F035C8F84A, 0xDDB74387521DE814, 0x8578191F3FB15B8E, 
-0xAE102220387D8E83, 0x49A553CAC8A824B4, 0x68051BF29ED1CA7F, 0x3329719A7FA60, 
-0x43BD05729152543A, 0x1E04BF9934F08581, 0xE8DB1C4E747C3A6F, 0xBB3EA1974F8D0F43, 
-0xA06AB925294D06A6, 0x1ACB8AFF5016FC7, 0x279E40F9B6F84414, 0x7FB1F19BBD2BA, 
-0x69E59024279BC9A9, 0xA535C16FC07CCD3F, 0x922C0F631639BB04, 0xA84EECC5684D16B9, 
-0x28653374BCB8C93, 0xDEA97F1FAC83CCBF, 0xCFA2FB6C22EE4535, 0x37666FD8DD5A3F, 
-0xB64DAA4540494ADA, 0x74F65F084F078B1A, 0x44B16BF9044DB1A2, 0x87EA69F36E9A3186, 
-0x8FD0006A183A430D, 0x606C6640B4F052D7, 0x2002AED1610B2904, 0x3FA50E5F36D391, 
-0x44F19BA5A0D784DD, 0x6EF7006CCD563CB3, 0x8E42A26E01235C0A, 0xEEDB77C4D5417528, 
-0x2EFB4A9F9A3F26DE, 0x5FE7A23EC806C04, 0x82367D0758C89C5F, 0x21D90674A3C388, 
-0x1400B7EE02F899FA, 0x2CBBBC9D534F5A14, 0xDDFD61CCE19B7F5, 0x4729BDBDD7D90C1D, 
-0x669148510F08FE5E, 0x9919C31AE811416A, 0xEA8ED4E5331D681F, 0x93195FF28F15A, 
-0xC263CBC8AAFE4EA3, 0x4DF0B218D5CCAD59, 0x80F7AD3A83B9678D, 0x2E87785F43554719, 
-0x71B6D258D084B26A, 0xA007ACB227F68FB4, 0x8E0D708E46ACFDFB, 0x25658CA00E73CD, 
-0x270F086A78DAD7A0, 0x44B7E0C9A025E6E7, 0xFE7BDECBFC7CC9D3, 0xAE3780B8D8E79B21, 
-0x625D10E57C0BB81D, 0xAB72A54C5DC0198B, 0x5557978AD4F284C6, 0x36EF0FCCE8083D, 
-0x46BD285F4F017B2F, 0xBCEEE8DEDE44729F, 0xB266A608304C43A3, 0xA5A0AE185A98080A, 
-0x35422A88DCC876BF, 0x30DFE372DF0098D9, 0x235DC6EA67D48A68, 0xB6294288FD136, 
-0xD56A3C2E01BC31BD, 0x72B3D30A2A85BD58, 0x3CF80932DF2BF04B, 0x4634CB34E5BBBB55, 
-0x398D4842747F8B48, 0x360C39A89C1484BC, 0x1605F9093FF6293, 0x1ABAD51E5BBF21, 
-0x49348A69015DBE0F, 0xFE6B8D78930CC53E, 0x6308C722001077A6, 0x8640652D83250EA1, 
-0xB0F88675F9393789, 0xDE5BFBF8BD247DE4, 0xB93FFAC0DD315E59, 0xFEF197ED80584, 
-0xA4903A876351BC56, 0x6185CACE787C3AA4, 0x391CB180688EC9C2, 0xB4DA4D3FAC916CE4, 
-0x6DD173217C4B2A7D, 0xD1CB7E8AAB35B7E5, 0x8729F80D8CE2AF59, 0x338E9C199529BA, 
-0x1E8F47F4FC6719B7, 0xFF9FAAFAB1CB68A1, 0xDD72CC297A4CBA6A, 0x2414F8F1B99DCD78, 
-0xC51A2C881FDBF3B3, 0xDC5E29D025939918, 0x1449B1996B6D2FD0, 0x1EC44014DB5A3A, 
-0xE7380719FB330C8C, 0x70EE00C1AA2C4A8A, 0x7F8FC4CF56EBB5B3, 0xCAE893D0CDC80C5B, 
-0x5C2E162C40DD761E, 0x930E08BCDA1B4E1C, 0x438F3EC46BF44D86, 0x2EFB7F072B4770, 
-0xED2828254A805AB0, 0xE3D03F798C3C7D85, 0x2F980501BC14C42D, 0x871CC1504CD88F0B, 
-0x847564E81CFBDCA6, 0xB2C41804F3EC303B, 0xB31EED244890F97, 0x37A4036E49F06F, 
-0x6A350A11B31C1144, 0xFF54733DE87A801D, 0x3572732BD06E02AE, 0xB24108259A6483F6, 
-0xA569484CBD247B26, 0xEA8D96CE7482D984, 0x7187F654B940EB15, 0x332B0F969F15EA, 
-0x4030ADFA554CC628, 0x35D2B9E1F2A524C8, 0xAA924F10B9113AC4, 0xD85F3A0E4B41AE83, 
-0x21BDF508C0259D51, 0xC15C8B2A462E3701, 0xDDD27BB0FB1C83BB, 0x1A7183FC07CC42, 
-0xEA5D0FD44E270C56, 0xAF0FD99F9D4C3FFA, 0xEEECE581C71D909F, 0x5AAA0EC966667E03, 
-0x626E1673E65B18EC, 0xE184FD5724AAF897, 0xB14962740CB5DE0B, 0x19EC6DD3A0BB49, 
-0x785EF605726D1468, 0x22B0009D9CB65804, 0xF29FB86A299DC063, 0xA95C7F5570258076, 
-0xED7AC6932ABE63D9, 0x845568C78327CEC8, 0x2BF75BE151488F81, 0xCAC2FD3EF2735, 
-0x38D3CDAB650F6675, 0x8CB85D334F77AEDE, 0x789C7952368C3F7F, 0xC9ABC4DCAA823433, 
-0x86F819E94871B52, 0x8059646CB4ABF3BC, 0x3FE4B0A2AA254D77, 0x33CDA21E2A6A28, 
-0xF95865B79CCEFE81, 0xA53841D7D8636560, 0x8DF60FE3FE9D5BE, 0xD73CFAE53A2450D6, 
-0x1ACB4B1AAEFBD76C, 0x6F9AE5553C47DA6A, 0x22F01B82D9D5C3A1, 0x222683E40896D9, 
-0x2458EDAEC621C537, 0x973D92BC482A86FB, 0x6106D491703571A, 0xC18671D79B002327, 
-0xDADBEE6453678703, 0xF0F375ECE74B5A37, 0xE9CC103BFCA75AA5, 0x9A8822DD6FD2F, 
-0x84BE80B67B1302D8, 0x7916720C5E1CB465, 0x66C4825669D0F4CD, 0xD1737ACAF1B78DA6, 
-0xF6979DB9A81647CC, 0x2435E87251C826C9, 0x13EE419BE462CD35, 0x1211B57446F0A3, 
-0xA88DDB1582857A70, 0x3B306BD1524FD81F, 0x2CFD164F06F3D5BF, 0x9DB1B397861C7ACB, 
-0x4680863A8BAED816, 0xD0DC2D10D9FB37FC, 0x37F17F8FCD224416, 0x158464F6CEB2E1, 
-0x28805FB758720449, 0x97096F71D510436, 0x8465A57C7D0986D2, 0x9F0510A4DFB0EC51, 
-0xF098E55AB1A76120, 0xA2E3CB6DA25507F5, 0xA21C7A4751644AC6, 0x1210613505E329, 
-0x9318A04716D6C2A2, 0x282BD96E421844D8, 0xE2F0FDD727B78B5F, 0xA40BEA0C619D19CA, 
-0x84F53E8754CB0B61, 0xE018907468F3A218, 0xE2FF2B725FBA15DF, 0x263591649A1CD0, 
-0x950735EE4DF03E7D, 0xAE77DCBF9C4F5BDF, 0xD8DB0F61AAE7967B, 0x7D19107ED6FC25E2, 
-0xAAFE36F1260CD1C2, 0xF035B6B6DE840B7A, 0xD7F332FAD0140B5, 0x3A19854DDA4545, 
-0xDC857901FE025E6, 0x7727B1074193F32C, 0x77127292D7413F44, 0x1512F32D0DCF1DD0, 
-0x3F52DE509F288987, 0x6886186C1B608CE2, 0xF5BB74BDF4111DE4, 0xF076311D128FB, 
-0xBF67CCA65C16974A, 0x3DE3B3EB32B1147F, 0xEC289C7105A9DC05, 0x57A3DE8AAC392F49, 
-0xA0C9616E67483A9D, 0x5321A675E55EF65D, 0x23CC8EC5279862BE, 0x3877F3B197501C, 
-0x4C5B268E90FB519E, 0x2D00538E3D23914E, 0xBED05266F5B5D748, 0x99AF59B8782CCC41, 
-0xA80C9B40F0770F12, 0x6452550A25E6236E, 0xDC6E147A36DFEFBC, 0x38E93E6C332F82, 
-0x90B7311D6AB70ADB, 0xB8D12E0E7A352D0C, 0xA236DE897DB9FE08, 0x28B7C4AB7CD37272, 
-0xAA12E3EFEE94D441, 0x5E5ED1088D2B8DC2, 0x142E68CE96B1718F, 0x9711A85BE6AF9, 
-0x8BFA4902641C9B13, 0x86C50B53C8D6ED1, 0x69FAA0613057BB3, 0x3255850E89D1B895, 
-0xB96712AB19B6056E, 0xBC69F8E8841982B, 0x953CF852AEFD3050, 0x2CDEA37229ADC3, 
-0x7B70674CA5F0FFE2, 0x3B3E9FA9C40B28D0, 0xC1A0C479D4CE362B, 0x1E2F8CACE2045627, 
-0xBF120674642F4DAC, 0xA59D3159CEC424F, 0x4D7166E501076B34, 0x2E7CA4BE5BBFA8, 
-0xFE2AC67825D3A6E2, 0x1CAF7F9D6F263465, 0x6B1FC3751CF2A6FA, 0xFAD134DA52AABA48, 
-0x1AD2C0DA02FF7DB2, 0xEA94024437D7583C, 0x9EA0EF519F288066, 0x4B4EFECA67C3B, 
-0xBE30441539000C28, 0x1F1A3D8DFB58C3C4, 0xCF676FE941C4D7F0, 0x6D74646B900DC3A8, 
-0xCC123F5EFC75ABDA, 0x7E533258E48D5A01, 0xE0321EF8E5644922, 0x2FB43824E3958B, 
-0xED1A70377820DBEB, 0xB4677E84D6AC8F49, 0xE6F1DC6EE5FBFD64, 0xCC9553685CC37CC8, 
-0xB2BB20E8299DA73D, 0x8EB959C054617D7, 0xC221E6C76955EF9E, 0x23B99919DC4A56, 
-0xB855520750A3B4C0, 0xF22E536979361A0, 0x942D0AAEABE8374, 0x40682D731A491556, 
-0xBE1367B2C5C202B3, 0x3DBF009C7D740C70, 0xE379FDCB61FD2B26, 0x1883BEF5DC36B6, 
-0xC602854139BD258A, 0x93D2FE62C24FB759, 0x5AD1CF7307BD42BC, 0x2D5FFF7E1E96FB36, 
-0xEE57393D7D622E21, 0x118DC774BC422957, 0x2F62EA64A7DF8B24, 0x22C9BC1EB01D8B, 
-0xE0C0108B8388AF4F, 0x2C42BBEC754056DD, 0x54BEE615E6C7FBC, 0x38FC59EA32CBEAFB, 
-0x9F26BF363058EC8A, 0xA76150B4E3F29514, 0xFE3AC077917C7555, 0x227C0A6D0AD268, 
-0x4BF96EC998A9FA00, 0xC4EB4C37FD58576C, 0x3EAEC45DACD24955, 0x9B306F4096925606, 
-0x6B1E9DB27E9A9E62, 0x80BD5795EED3F125, 0x4F6C497F0E29DD57, 0x2401483C8A4800, 
-0xE1E30CF683DFE784, 0xF23413A1314C3A07, 0x1D5EAB026635837B, 0x591993B1A55A8BFD, 
-0x5FF8A16BCAAA0CCA, 0xF701BE89CD9E04E1, 0x9C443497B9A0B416, 0x14B0F4D40AA634, 
-0x69FF2187F902F56D, 0x15B5694D301D3CF1, 0x724D7BF142B212A9, 0x98DD53E6B21B649B, 
-0x2448A11472A981DD, 0xEEEEF6AF6352B6A4, 0x992C6DF3BA37AD7B, 0xDD76C8414C8B8, 
-0x3B90519FAA531741, 0x71A161B0808FED81, 0xEF495C5BD4006E87, 0x80BD62F0BAE0539A, 
-0x19EE93F1520CB69, 0x470577DC35C6741A, 0xCEADF3AEF744DD6E, 0x308E1FA9CFE27F, 
-0x53693A1040096A83, 0x7B581AB560995BD5, 0xDFA780E31E23F07E, 0x2DBDA631A1BBD00, 
-0x452018F982636F15, 0x15A045593CDBC22, 0x92FEE4117402CD3F, 0xF6C97E0ACD5DB, 
-0x240926855E054D35, 0x7F7FEF162B4C827E, 0x5226E6FC739BD052, 0x293C870CCE7D0816, 
-0x38833B1F0AEE9492, 0x681A6263106862A1, 0x511B7E5C1A780385, 0x5DA98A16A8C67, 
-0x7EED3FA743D3F53, 0xA5DB36BDFA4C30E7, 0xEB75BDB075E3D53F, 0xD1188944EAA741AE, 
-0x412FD2FC16F80EEF, 0x79BCE1F75AB73CFE, 0x30ED8D24CA0804D0, 0x6209011C3A977, 
-0x21E8E43FB1123270, 0xC91CBA5664F75811, 0xC77C69C1E4566210, 0xBDC9FAB3CF479D52, 
-0x78F0669395B270E6, 0x2B0D156436CB1C6F, 0x41966B996C68A1, 0x15D99FBD6D2766, 
-0x1A2D284056579F20, 0xAC01FBED2571D0E6, 0x831AAE78204AC38D, 0x8C488089C0B42EBB, 
-0xFD0C6D9D6979C4A7, 0x4F1B6C7D398D725F, 0xBA2B4FE9F84DA9E9, 0x255E7A84679769, 
-0xF8EB6FEB477B4DCC, 0x321D26C35207EE9D, 0x61802FFF8E3D9544, 0x99349FC46A58F86E, 
-0xE58E97796CE0657B, 0x382B8361B7F93660, 0xAA6D36E749396B8F, 0x25C25B7B103661, 
-0x6C0A6FD5DAC93229, 0x81DD7CFA295E77DA, 0x8301ACB20ECD2BF4, 0xAC79456FEE1708DB, 
-0x1B63C767310E49E1, 0x59D0BB38A3DA1B2C, 0x2FFC656436C2BC30, 0x14DDF2CDA13142, 
-0x6F669A179A9B8B52, 0x6BB5B43431CCC687, 0x3378C207A1F931B0, 0x1EE2C79DE8197EF7, 
-0xBAD36941DB597506, 0x2EC7219BB97BE32D, 0xC69802949F32A2AC, 0xF430123282487, 
-0x4F47507E8FE97CED, 0x5D689D5DD29760DD, 0xACD04B45A3232BB3, 0xFB5DCF7F6E952FE2, 
-0x7BC4C96A80C333FF, 0xED2DD19F504C5BF0, 0xAD8292A2A45A1028, 0x2BF6E42222046E, 
-0x5AF5717938C64CB1, 0x10341DD56A58A565, 0x34920E6C25BDD842, 0xE8C18A02F0C3E738, 
-0x7696F3EA1CB6B672, 0xF073CDF1337D873B, 0x461C8C0EBE1BE6E4, 0x40442E0D19ACE6, 
-0x2ADCF7661FE09264, 0x6B210A2CFF4C3073, 0xD444734596E24594, 0x1041D9FB29CE3406, 
-0x792ACC26B54E223A, 0xB0B7B7737521BF65, 0xF7810FB372E87F77, 0x21F9AFFB31FCF8, 
-0xB57D5FDB947F379A, 0xA54074DED4A53A45, 0x397344FDF1D6D461, 0xF5CDB0EA615C7660, 
-0x5604EE7B41CA47A4, 0xF714BFE6B529DA47, 0xA69CE2112A7098ED, 0x9700A1C837255, 
-0xB97481F7F4D6212D, 0xF3DD2BAB9E1F67A7, 0xFFF7B72E4D2C685D, 0x242D0FB55D3CF406, 
-0x673EFFE06F4C4EF6, 0xDDA1BB01B8DDC36A, 0x476873A35626C49, 0x415DD3C98AD60, 
-0xD4806CC55BE5B1FF, 0xD10DECA34F7910BB, 0x5D24444EC920C625, 0x302C7D72511FA428, 
-0x448122B65162889A, 0xE8A5A7EA770FD38C, 0x92D65192754C5D4, 0x1F3C97A2770C6E, 
-0x9307E65E05E76D7A, 0x819661B26441F20B, 0xFC782E11BF98BBA2, 0xD45132271D0F5408, 
-0xA7D446379683E4D8, 0xC7A570E78F001530, 0xE963F14A6304A414, 0x26BD4AE2397FD2, 
-0x1BC84A9550FC8426, 0x2E15FCD73964E330, 0x3DACEF0AD382E9C7, 0x299E7433A2B0D73C, 
-0xEE9D68CD110B6665, 0xAFAA41A00230E576, 0x1016229C00FEE900, 0x231EDB650CD0EA, 
-0xD2E8AAE8E90B28D8, 0x64B74E0623BCCF3B, 0x8D88848FB5C684CE, 0x5F1956BB42D6AB44, 
-0x4F502957B798963E, 0xF135D3108BFC81F0, 0xD56215F8F803DA6, 0x3DA1CC82FE0B7E, 
-0x62A982B8B5626BC4, 0x9249A9098612F751, 0x11E4C214524C1B17, 0xC121D4240DE9656A, 
-0xC7F0623868742AE5, 0x8F13B7C6D29D3913, 0xAD4D2B9CC419EB05, 0x3DE39B0A4771D, 
-0x85D57B3A538FE0D3, 0x793696F50B3315BC, 0x80EC9FC20933F233, 0x797F02A025CCF158, 
-0x3CFB531A7FFFD708, 0x67EB644526CC14B3, 0x44AE5CCD6F265353, 0x2FDDB51D758EFC, 
-0x9B7794C9A332A68A, 0x8DA2896BC1F3ADB5, 0x43FCDEE1A1242D6, 0x3A7D4ED83F93DA8D, 
-0xD797AB237B43C338, 0x8A4962E841018A3F, 0x90F3F533FA3D1CE3, 0x2EC99EC785053C, 
-0xDD779E3179FB8CC3, 0x2A4758BF84250C92, 0x66445F4F3DEFD596, 0xD3496CA6984BF628, 
-0x1BBFBA0ED47D56D7, 0x6433277A2EB70195, 0x2247C8507F1EBAA8, 0x3DA1087990FAEF, 
-0xC1411072ADFA67E, 0x9BF8E4FFC541C867, 0x5821C61C138DB1CC, 0xC4DD799091A11791, 
-0x22A72D7B1C6F78A3, 0x248C8916F5CE761C, 0x8B7D5A61660B3B0F, 0x218C18CA0554EE, 
-0xDD8354A676872ACB, 0xBB860E2F0E2E6A0C, 0xCA8A1622ECD6D29A, 0xBB06DB3D72B275CD, 
-0x9B73F7CF3951AF6B, 0x7250F43BDFBFD683, 0x6A36B2E8EE329F23, 0x177D7D1E1E85BB, 
-0x8697AE77DC89D770, 0xB4E7711B30C508B1, 0xAE0F18F8B5DE9941, 0x110580E1E294676D, 
-0xD16168044F3CE0E, 0xA3729C58B5D983BD, 0x7D098FF85806B1E1, 0x2B0A72F5D22F4, 
-0x9A0C91E69A382A1F, 0xBA6180454D43DBA2, 0x15F47FCCC5679A90, 0xA2E046E952542673, 
-0xC0478ED15A376FAC, 0xE4E76C12BD6E619A, 0xCCFD5DD4D8CD2DA5, 0x1BE497BB0F23D1, 
-0x5519978390006034, 0xA8253A86FFF2E350, 0x9C38544011E80208, 0x14F6140453F6D4C2, 
-0xF837BDFD731D121D, 0x9DB2E50A6C6DE2DE, 0x5706E82976887FAB, 0xF7C3C05EE2AD5, 
-0xB554C71BA04E694A, 0xA05356E35A1252B1, 0xDEF9B8D075EEB1A2, 0xC7104ABD70D04E7, 
-0x32F6E3E10E12F378, 0x3BFC4C597C707442, 0xD8FB190684B1B9EC, 0x4AF8AD05B6289, 
-0xC321547C087BE948, 0x69EA4F3686BA5937, 0x643599755E1D7262, 0xEDD6F2253AD8EF5B, 
-0x4D1E240AEA281A71, 0x433FD0ABDA481DD3, 0x778D992BF591AF8A, 0xE9C49E837FA9C, 
-0x96AF44ED4F2FB982, 0xB833A179F965BEEB, 0xA9C6CC5F7DBA8C14, 0xF1460F3DB21C7431, 
-0xE3B8C3EA8DE930B8, 0x3B9CFF486338578, 0xD1CFB9248B0B571E, 0x2469C6871ADFDC, 
-0xC98870D2B5722980, 0xD262EA07339A08B3, 0xDBDA618A429135E3, 0xCD033CDA26B0F21F, 
-0xB77284491026AFE4, 0x66D3DE57168B1069, 0xAC890DB94B844194, 0x1C8191CCEF8464, 
-0x91E75263FC521ED9, 0x3F872CDAA8B802C0, 0x4AE174DB1006B94E, 0xAC5E5A89C6A36DD5, 
-0x8D5AE1AB8F70E2C, 0x775652ED53070E9E, 0x86A304CE97DDC0D6, 0x3EAA3C19DAE7E5, 
-0x1F79CF2FE90F15B2, 0x16C99901E3A06BE, 0x9AF066A9F143710, 0xC876F3F9B5099BD, 
-0xA9AA7B03E3C49D13, 0x5ABFA44F184F03C9, 0x6C3EC451289E4B5A, 0x3FE78ECD665F5E, 
-0xF844008C1FC149D4, 0xD3F59528AC9307BB, 0xB593EFF89CE5872E, 0x950C08D83A269005, 
-0xCC6F51CB7706DA84, 0x90F0C2BD1C67B61E, 0x21FEABF835FDAB57, 0x3CA1501B7598C1, 
-0x45228D918D934C20, 0x1F25FA7DD34BC67B, 0x5850639F2FF177D, 0x919BE5DCB3D886D, 
-0xE5F9415902194FA4, 0xCEDA55A4F05BE80B, 0x459B626773F56F6, 0x1B1FFDB2D762F, 
-0xF8BE181BA7F1F0EA, 0xCCB667D74D5B0DFF, 0x7696E760790E13A6, 0xE691A4F67074F8B0, 
-0xDBEDA10ECF0951BB, 0xA431AD6E2D12723, 0x304E75D7BBBAA5F9, 0x33EBF5FAFF6136, 
-0xF594BFA427D53756, 0x608E67F94ACDB5CD, 0x31A2E90D51BA27E6, 0x440576A1A7E102F6, 
-0xB5E781AAEA600099, 0x1A436CDCA9AB0D47, 0x9D86E0E666549115, 0x391B2B2554FB48, 
-0xB6AE74041D30B11C, 0x2C71078E35474926, 0x5B7D3729E5E35697, 0x1B160EB1303CB3F2, 
-0x54A830543E2DA32A, 0x6E661590FB7A273A, 0xBF2566F1AAEA1F23, 0x2D06A1D7E5F444, 
-0xBFFAC8B7A5F9B112, 0xDEB813D9D8A871B0, 0x9A3C63F95C2BD259, 0x8D73778D0739BBE8, 
-0xCF64DE70F171A64, 0x6090539EF1F118B7, 0x6325F5C8D96FA623, 0x41EE177A1EDDB, 
-0x7A7F375F128E730F, 0x5CF2C962BA6ABF36, 0xD591B844DC8AA1CA, 0xF1B5A4410E6ECC6E, 
-0xEE61EB741058B95F, 0xCCA246AB9D2A002F, 0x3DA926970D0B20AE, 0x1BA433BC59F63C, 
-0xBA73DFBF562511A4, 0xA035CA48D114381A, 0x8091DAC83183453C, 0x3B2B74B249CABA79, 
-0x6AD01DE89C601CB, 0x36CA60C35870EF8, 0x31798552AF876A09, 0x214A8782D7BD24, 
-0x8ADDA757A6F8A491, 0xD6381ADD2C37F8C0, 0xA37F951137FE034E, 0x1D565CFDFD93505F, 
-0xA7B1F146696E7B19, 0x60D024AF7C458268, 0x6E27901E8C80AC84, 0x27A89A6F1806C4, 
-0x4AEFBB31FAF35AD0, 0x5C7AFA2E5AE3F37C, 0xF715C0498069B7F9, 0x4506B12339A730E9, 
-0xC9EDA7E704B17885, 0xD04B1B8663281FB, 0x7E18B3D73E335083, 0x2C359A53188828, 
-0x56C312EED7C3DD23, 0x69A86736B832F1E2, 0xFD105586C4142BE1, 0xEF7B89FB778C39D0, 
-0x6D80A39907424B64, 0x267692EAC2EB1778, 0x55E52E5E963357B6, 0xD38EE15DE0283, 
-0xEB26198CD6C04A91, 0x7F0893F175B71D5D, 0x34B181CF921320CE, 0x92C64F5D890BFD3D, 
-0xE14DE33B7F111C14, 0x42B83E4B686F6C31, 0xD3E25F9CE3BF6621, 0xF1D1693675DB5, 
-0x8A50792B340185C8, 0x95A6FCE94735B417, 0x46E92111528FB5, 0xC73A1CAAE8395694, 
-0xBFE7EEF77E8235E4, 0x2F10879722A03A12, 0x8926B84DBABEADFB, 0x3463FD9D8151B3, 
-0x79FFD62E6B3B0DD5, 0x5F9E6F4E87E2AFAD, 0x9209C4B2DE0C1430, 0x2EEDE0028BA9CCDB, 
-0xE41D6AF70A2FEC07, 0x4EA4ECFF090382D2, 0x1352045347D9C3AE, 0x21396CC90FD873, 
-0xC048735E87488EAE, 0xC0C96D143545C73F, 0xE549B9BD4CF416A2, 0xEFCEDCC8CFBC8418, 
-0x33413D35FBFF1087, 0x659390FBD8EC94D7, 0xB6F4B4D2B14DCE88, 0xE5C335479A13, 
-0xE245A66DE1FB24B1, 0x81B7E0644DD401B7, 0xF77DCB5D9FA817C1, 0x24E2F35FBD605940, 
-0xE0B434F5249251D6, 0x7B8057E6D5ABD23A, 0x65C9A096EEA7915A, 0x340E8A50D38950, 
-0x8652D6CB6DBCC942, 0x1FE2F4B603B43E3E, 0x88B308262F1D595C, 0x4E7E11DE6DAFAA1D, 
-0xFF147D032874FF3D, 0xA8D079F95A45836E, 0x9F329BDA06E06F91, 0x32C588F0408C60, 
-0x6FBDFB444E9A0476, 0xC66B41117A6FC7E7, 0x89BA8AF7FE89B5FD, 0x1EE51D3AA9A96D31, 
-0x550D86AB2A5BECB5, 0x4D3F0FF4246756F6, 0x3EA847267EDB77B0, 0x3CF49AE39A417B, 
-0x510C422C035EFBFA, 0x551CBB5B1AB3E2, 0x5A44102BC3FECD7B, 0x339975D8A2032B50, 
-0x8A81C3D335B24A1E, 0x95A7DCAF84B5978, 0x236EE927E8B31A94, 0x388A938E6EA9AB, 
-0x87E8231C28733136, 0x15BCB19D6C7360E8, 0xF144414BBD3EB4CA, 0xDDC75AEB05A8CFD7, 
-0x981BD5D6F0F9BCDF, 0xA9101482B6963017, 0xB0C6EA91B917405D, 0x3E0C35F61AD04A, 
-0x4685E92E6F2E361C, 0xA90FF5B347924C55, 0x5F91B4E562762877, 0xF98A95FC5D9CA289, 
-0x5277D34BC866852F, 0x8E3ED15BA5412BD8, 0xA81F9E63C23E2F3C, 0x271728E32B18BE, 
-0xE94B6521C696769B, 0xA2872FC74892C4D5, 0x1D56F978A858E07C, 0x54EECE72A694CF95, 
-0x264FA5AA7FD335A5, 0xC948D5908AAF0DC4, 0x688822ABDFDECCE0, 0xDBE34A5FBAA1D, 
-0x3913D47DA2E1EA4F, 0x4D026C675B5522A1, 0xAE83CF09D1694A58, 0xD978C843D5E7F262, 
-0xD802F99DAE4B2C26, 0x25FEA3584F26AA5, 0x750F84FD1B8267A0, 0x62C45732B261C, 
-0x28E3DDDA44DC010, 0x3589CC501E75E89C, 0x60942C0B8FA8A9EF, 0xAC14C180FD2062C6, 
-0x2F424D9002C6ECFA, 0xA91DFCABA16798FD, 0xE12E230951AA7A7A, 0x22C0FE952EBEEF, 
-0x60AA9226EB779EA2, 0x705473D270EC8066, 0xE709E0661510C76F, 0x382A24936C2A42A2, 
-0xAC0EC76C10BF2E93, 0x59D1EA8454D42215, 0xC040DCE2B7BB70B2, 0x2F52C774B930E5, 
-0x574222D00AE4FCAE, 0xA9170523F34CCEA0, 0x79D4D4A018BF5DF2, 0xFBC69154BE0B5AC, 
-0x439FE43FE029FDF2, 0xECE1F7C06A6CC539, 0x7024188B5EA2C2D3, 0x8AFC3CE16BDD5, 
-0xE1FF2D05D38F031, 0x36E8F0DBBA90D30E, 0x69FFEB66E415890, 0x653AF19F3B3EE822, 
-0x4C8F81217BC689FB, 0x92EA22B7A595C09C, 0xEB4A517CDBF02240, 0x2184ABE1FDD421, 
-0xEE143B86B916167F, 0xE921A2A725BB1E85, 0xA22EC39C1650025A, 0xA1E35024CDC20923, 
-0x6AF743C2C40C7B8D, 0x516652FEFD5ABE57, 0x8BAC70DEB16C82A4, 0xDDC42960F8CFD, 
-0x85BE403C5F94D572, 0xD2BFA730715815F3, 0x6F6B902EF8F6D947, 0x2982E9666649E107, 
-0xF2F7381169EEAB54, 0x5247CBFB00F4F061, 0x5D0ABD317EE28DE6, 0x1353E8AE50223E, 
-0x1A6901FF2102A68, 0xF8B5E3F5E5C86D34, 0x61482D659FE64E08, 0xC9198D474CDB497A, 
-0x264A36C0DBD530A, 0x6D79EAD747DF6ACE, 0xB5B0C408C8919542, 0x1D757A94B8A2A1, 
-0xA6B5DA194FB212F0, 0xFD47F4C990A4A1B5, 0x6F37E556429748FA, 0xA791B48C22BA93AE, 
-0xEA70DD5EFA8E991E, 0xEC9CB7BE1EF575EF, 0xC8402E37E627F27B, 0x5EC8E947970B1, 
-0xA227406A4EA935A, 0xA5734CDF2997BD9E, 0x6867542E72C16046, 0x5E38888CF91E8D9F, 
-0xF13F4940F94DA1A4, 0xDB952A7705FEB666, 0x42F85F8A271D1E9, 0x2CB06DDB3026B6, 
-0x33DD4D6D895D3207, 0x3E5C5711FFCAE6F2, 0x37AB5ADB7398F4A8, 0x1B18BB7A6A734F22, 
-0x61F715F9AA8ACCAF, 0xCC32FCDF317AD82B, 0x2949E3CEC22B7DA1, 0x21C09874B53376, 
-0xD18FBF578CECDE5F, 0x6DF7CD9B63861078, 0xE65C94AE30770778, 0xC4CE23C87DEA5182, 
-0xED6256CFDD940D40, 0xDEA1138D9A059570, 0xA7D2D1A3D3D6C6A7, 0x1B2433AA70D5AA, 
-0x3FDDA70AD8F5359A, 0xE60B99B9A48E89E4, 0xC43C730DC1B0FFBD, 0x746ACE18F2889B91, 
-0x6C59F4D06AEBEEE4, 0xB3B1AE7C21BD98A0, 0x3B8F6C508235AA90, 0x189ED4E343C1E7, 
-0xB1781614EE3E036D, 0x25DECAD6B0B6A309, 0xF88DF2C0F6E6F282, 0xA15AE13AE2FB0920, 
-0xB4BDA6EE6914BEFA, 0x5C35C99E19F6FCE0, 0x4B74927B8C7401FC, 0x59E6E88CEB785, 
-0x77ACB9D647E37620, 0x1E29369E52580F7D, 0x3F922A1F8C4D6D48, 0xF54A7280D56B9B64, 
-0x8EA7D7816ED979A8, 0xEB4D5F03E23A9198, 0xBBD8DA21547B217C, 0x1A2BF6DCB8821A, 
-0xCAC31CAEB119CA16, 0xFA9671AB0CA80FD2, 0x2181AE5577756EA9, 0x2AB58925ED382D5D, 
-0x190B06F23D409F79, 0x95C31898FF2E750E, 0xD31FFAEBA3E559D8, 0x1F5BC6AF3CA4DF, 
-0x45A0CCE5FFFB3C4D, 0x5DCE1BFC5FB682F, 0x5E628E2193357366, 0xF795BDFC7AF10A2C, 
-0x602F61FBF856EC47, 0xB1F644F558EEA60A, 0xAF2880DBA8AB3604, 0x2E2B6C181BC868, 
-0x7B7C2CD0153A71CD, 0xBCD12F416EBC8B4, 0x95AD8657FBC2C7F3, 0x73009B95610EDBDE, 
-0x2723F5E87D7502AE, 0xB29C8E948FEB4846, 0x4B29DE591DA28B7A, 0x1586B3873ADEFC, 
-0xF0001353DB054CD3, 0xF8ABA1F87C150911, 0xCE0E37CF49666022, 0x55E4969E159BFD41, 
-0xC57567B2226C3594, 0x3CA899CC11B56E6D, 0x4B453F0C512B8CB9, 0x33C661477AA72F, 
-0xAF9EA8F0B5AD24E5, 0x7358EF1185FC19C9, 0x9D40341A8DC3919B, 0xFB8E320BA6A618AC, 
-0x21BEBF694B3F261C, 0x8357E7503DB50D47, 0x182AE6B9B43D9CBB, 0x3C29EA548D724C, 
-0xC81C20BF1B83F194, 0x8E5C5A45BC7FB454, 0x1DAE0FC69C81DDE7, 0x712288C58CAE3898, 
-0xE12C65C2A6939920, 0x54A45994C36DF6ED, 0xA13311DD01B53769, 0x277343981AA34E, 
-0x376D44B19C85127E, 0x5D3D418C2E92E38D, 0x29C1AB7AF8A30CC, 0x4DCBDF75DC70D5EC, 
-0x878DCF789E9E7952, 0xD42A20CABF20DB69, 0xF40DB46A8E51C4FF, 0x155763A3316E8F, 
-0xA56FC3307D3025A8, 0x516E6132D30389A6, 0x61F4FDE11814BDEF, 0x6E604BD59109EF08, 
-0xA6B44373FDA338FE, 0x693ED85DEDF25578, 0x8CF1C3B81B6FB917, 0x1E529EA1A6140, 
-0x35055CA344319FEF, 0x6FCF08E38113995A, 0x8C414418649A12AB, 0x29DFABD50C23B10C, 
-0x750A0F86C5F0642D, 0xD6915968922DD8F1, 0x52B52DF98482AC8D, 0x2AD2FB5941C947, 
-0x91BAB3DD702698F1, 0x2DAF649EE4BA43C0, 0x922612FFE71CB896, 0xFD88CD4144998C8A, 
-0xE934263D7176F18, 0xF66B14487751211D, 0x1E79F57EE1FA390E, 0x2EF9EFFFDEC55A, 
-0x2B66C8D54490E8FF, 0x7AA7F4362FAB58BD, 0x98CEDE4C3A551363, 0x87B84DE883540BA2, 
-0x5297A19081C216BB, 0x1922DD927FA76DC5, 0xF1802E3131C386ED, 0x2272C4A2BD0E8C, 
-0x5FBFF266C2CCD0BA, 0x101D54F7A2946AA0, 0x5357487D5C4A8C73, 0xBE4F6B891644A383, 
-0x2FF0A28B63529CD5, 0xEA8CE33C417972D5, 0x35CE6068F51EA475, 0x31B840DDD5C27, 
-0x5692E09A51BD21A6, 0x466D1022AB020011, 0xF88F09ED79D9AA74, 0xF53C38AF6ACD9FE2, 
-0x8B57C89384208927, 0x743C3D3F1151537A, 0x3B0161E418CEC1ED, 0x1F5ABFB3D50786, 
-0xC44F2C7AC9C214F7, 0xD37CD80AF4FE21E8, 0x3A30FE09CAB133F4, 0xBF19320291E7AD65, 
-0xA054D1483A691561, 0x239DED736D097A5F, 0x10F0BCA988CA146, 0x342D9F0C229D07, 
-0x5011C12CC6AA2A30, 0x24F557F59BA3DC9A, 0x9FE0079855882BEE, 0x17CE19C432E8684E, 
-0x9D3EB8CF68677B7D, 0x40A17676EC876B16, 0x26BBAAE2F056130C, 0xCF39F808BCB13, 
-0x770CACBFD2926AEC, 0xDD2E4F28EE75AB94, 0x1E64EEC69542F814, 0xD57F66D2DA1A2CFE, 
-0xB563FAE87E7A6B5, 0xFD792AD324D103B6, 0xCCBC22525D026620, 0x17C7B610E3822, 
-0x4D05965B10AA2263, 0x88D70875860FB263, 0x44FAA5FA98B268ED, 0x13A11E22CCAEDBC0, 
-0xCA7CE2171E297075, 0xAE6346828B60B0CF, 0x48B5FA6E505B932F, 0x397794DF551572, 
-0xAA70B463394FB0C, 0xDCB8C6C13370B156, 0x2D2066DEC3DFAB91, 0xD67086F7D09C1A0, 
-0x8A0E127003620F37, 0xBEB59234F7658E58, 0x1F8D01E69ECBE4FD, 0x255FC9F655E3AD, 
-0x32946A70847A5CDD, 0x3A64B4BD69F50464, 0x3E497E4A1A0A2942, 0x5B66B931FC17886B, 
-0x983B47D09E146CF0, 0xE12183B424D0F9FF, 0x23A46997E518E819, 0x3B2FCB5BE3626B, 
-0xF14535C706D49050, 0x7349555FF2A1BB4, 0xF00280BAF94367F7, 0x9801B2549F396785, 
-0x832917ADF4B49132, 0xE3476D03094395B7, 0xF0F8B0B059496D69, 0x208FE6C421391F, 
-0x62F4B5600A224496, 0x638ADD23B847D083, 0xD0B781C3782630E3, 0x7F8CBE6A102257EB, 
-0x8FCD93F755E35C31, 0x97C893C797CC60D3, 0xBE7E37F411BF5FC9, 0x1BBD54EC00360F, 
-0xFA986EEF81D32500, 0x2DE5E3FF598FE5B3, 0x52A2EE8CD41A4208, 0x8F103B9B17325140, 
-0xA72A5CC3ACD07F32, 0x38DE4457E026BBA, 0xA4FA6DD094956E6, 0xA25FEA9BFDA38, 
-0x809BEED387C5A203, 0x5B87211ED776BF3F, 0xF0176282A26DF489, 0x65680710AE673D51, 
-0x3DF4306B0D09961A, 0x7A17EBEB553D91BB, 0x35E561F08473C2EE, 0x1C408D22486602, 
-0xD3767C5156E90F91, 0xCF677E64DF221BA6, 0x655C73EB14B71D4A, 0x887B60C6AD0AE803, 
-0x92E024A78B290040, 0x905C410C60C2853E, 0x5B8582C96D864909, 0x3D4E3DE8D9E797, 
-0x4EF456D28DCECBC7, 0x217414A71392B692, 0x2ED71009D4D5BB52, 0xBD704DA2FEDBC977, 
-0x1180C45EE1A7867A, 0x9794F843DA942A7B, 0x440B6A740D293856, 0x8D91ED2F4EFFD, 
-0x63520D4CE937ACFC, 0x2CBB579542DA5E7F, 0x86EC9802720A6A5C, 0x74F8A727F4314213, 
-0xB201C65AC5B8F9D1, 0x5A08115B0A03B3E8, 0x70A952FC9A07F37B, 0x15EE5CBFE61DD7, 
-0xF161805BDA5663EC, 0x87F64E09C1181D63, 0x2817849E1A635475, 0x54E5F2FB82B8889E, 
-0x5EC72B5342F44352, 0x763A04C090A0CCAC, 0x11F26A479D63839D, 0x30CB354C45EA49, 
-0x950D4D15150C452D, 0x91DEF6C8CE529ED8, 0xE1687544AC1B964, 0x7D201891032EF27F, 
-0x49FDEC871BE4A05C, 0x22072745573B59EA, 0x4CE191A7C780A466, 0x2451AC90D08AEC, 
-0x6BA2ADF990A7260F, 0xE2A1A2EF4003DA49, 0x57D2C64D7107EC44, 0x3A249EFE8FFA448A, 
-0xEBEC4239EC993C0F, 0xEF7377871F579D2E, 0xEAC1FFC68838C2B0, 0x3330C85FF9E855, 
-0xE98D65D0D8619E58, 0xE5D27ABE703E2518, 0x7D9C447194F7A7B8, 0xF2A606CC35BBA9E2, 
-0xB6D9866F02D23C3D, 0x7DE98733B966375, 0x1F07FA5D3BD223C5, 0x2551A10912AADE, 
-0x781ED872F8C5989F, 0xBBF752751EA329E5, 0xE807562584B358FA, 0xF6B1BDCDCD531CF8, 
-0x7B670D7500907390, 0x1378EEFCE1B6F8EF, 0x8B72D9071CAFAA0B, 0xA44F4E877AF9B, 
-0x73D83A9F7155EB19, 0x80AC997B4C77F360, 0xDAC2A7EE11DCAD60, 0xA7673E41035F420E, 
-0xE2127D12A269AF72, 0xE8E99E42D2CEC5A1, 0xBE809EF0654E650, 0xCD5BE915B06E2, 
-0xE3E478ED25EBC28F, 0xDB104D6F061AD1FB, 0xCE458BC2F211B8CC, 0x4459DBD178367DC5, 
-0x5A06B29D2EF33529, 0x8638D485010625CB, 0x7D17AB068CBBB19E, 0x727F9C16E1FCA, 
-0x4A1C7639F98C0D9A, 0xEFC779F06BD5D8D5, 0x1494CF223016F28F, 0xE68833184C9D7B7D, 
-0x36035C684F53BF2C, 0x7A209CF88AEF22ED, 0xEA73A4A9253B1688, 0x955B66BF6A738, 
-0xE8E4066B2A51861E, 0xB8864429D4F0BC87, 0xB717956CB55F7D9E, 0x159A01FE289F9F7A, 
-0xD052887EBD208288, 0x442D7C655AFBB885, 0x881CAF62FB209C41, 0xD96AFA127E4D4, 
-0x12C17ECF3B13C408, 0x5BF743C40BD37D27, 0xE90495027D4E8570, 0x24938C2BBD8989A3, 
-0x1368C4E60C486CB6, 0x2F38D3278D93BF79, 0xBB373427533541A9, 0x392585EA0140F, 
-0x796868799871DA2E, 0xB26EBC5A06CDD2A4, 0x4A71D0AFA077085C, 0xF37439C86C32D26C, 
-0xE0343E7DACF4D4F2, 0x3583FB0CEC9A71E8, 0x96F4FFC1A7DA244E, 0x554FF44319F64, 
-0x4497A8049AC5EC5F, 0x8F6A705B5A3E38F3, 0xD9199AB2043CD8E2, 0x2494BB97A8BC10E2, 
-0xCC060F3112E83AD1, 0x4E6E0C684336E22, 0x540046623A8D9581, 0x101B23FF96F5B6, 
-0x354518BEAA81CFE5, 0xB663A508DF92CE6, 0xC8EFFE8FFFDDFF99, 0xB0EEEDDF417E40EB, 
-0xF6A63FE0F03899FA, 0xB1464EFD6A32A290, 0x63561574A8A54AA9, 0xB345A20052B53, 
-0xDC767BF1C3383A31, 0x8D94AF0AB43DE40C, 0x868343A07460BAB2, 0x741B871929F19677, 
-0xA3B550A386DBF16B, 0xA9BD91070AFB9D24, 0x373DF56245FD516, 0x2034D1DCD66A2C, 
-0x9227BC08543DC0DD, 0x1977AC8D995C7B7A, 0x87CF60AEE878DC41, 0xA0E1C26E176ABE9C, 
-0x49FB1406324864D9, 0x1E101770605EB6F3, 0x13DEE88887AD518, 0xAC77457446E8F, 
-0x142DCEEF65D69B1C, 0xB98AFB52A0431401, 0xA941CA8457EE74BF, 0x14F289E8AAD730FB, 
-0xD80617CA16DEDFC, 0x3B244F2004C08FD, 0x9FAA3CFB482410F, 0x4E2228C3ED4E8, 
-0x62F9696877CF96A5, 0x7AB63A6F3E0DE27F, 0x964E8422C7260DAD, 0x6318B4D9E297AF6D, 
-0x4BFA02AB265DE063, 0xB86BFA3DD5296FC0, 0x40B7F712004F94F1, 0x32776F294FEC75, 
-0xD60001B835D88365, 0xB60D85472D9B0685, 0xBF048A370A79B030, 0x5B2319E0345DC02A, 
-0xAC8B8ECF79E1F101, 0x578C89CB5517CD6, 0x887E2197D654A2C1, 0x23F56A4F04187, 
-0x9185DCF263A633B0, 0x593A7292A2EB746B, 0x36D1335B33639360, 0xE0C9A7D4B6E18881, 
-0x93595D328772436F, 0x27C30AA880D79317, 0x7E277C7D0B15BE86, 0x3FD3C6D4811B1B, 
-0x8351C3A76156206, 0xD088D7DF6EA51D22, 0x286F63694FD0408, 0xA6887E8FE86335F, 
-0xF554D19F3109CEDE, 0x4B064AA1FD241C93, 0x1953F23F1ADA1479, 0x2532DFD5F2893D, 
-0x68E98C8F45C735F0, 0xFD6D79519D3333D1, 0x8286EC5F328BA109, 0xE8B53E4AE0FE676E, 
-0x57035F1DC6BAE8D, 0x78E8966B2F1188AF, 0x4679F13F504DCBD6, 0x18AEA6EB6ED3C3, 
-0x74FF91EC9658EBF7, 0xF976026E4A20A04D, 0x3D1F6B20BBEF58BD, 0x6389B476714F925D, 
-0x124A6FD50D4CF213, 0x4C43CF8E458BCFCD, 0x48131A6A9AE716CF, 0x218819793727A7, 
-0xE2B9E0272E8F710, 0x464DBDC4B16C01F0, 0x522AFD84F75D8533, 0xC259579E1E784484, 
-0xB98522AFF86D9505, 0x82646EBFF797FD2D, 0xD755F51FD01722F4, 0x700525A50FCCC, 
-0x543623D83E84CDAB, 0xEFB5D6F067DBEE17, 0x394ECCB3030BD90D, 0x740315680F3577AF, 
-0x87848384F6D7861E, 0x17FBB66548CACD06, 0x9036537F89F7F911, 0x22EA1C0167DF5B, 
-0x1A65FE7A38D2EA7A, 0x8A854E9F718C9C25, 0x91717CB4E85DBD55, 0x22528EFA81D34CEC, 
-0x6187E6E8539299D5, 0xE14BA9BC375F7E85, 0xEE4EB70A55E88EB, 0x32ABFDFBA2F7A6, 
-0x415C7AB790D1F0F7, 0x7D5EA5D71891C103, 0x5975B450F16A0B59, 0x6EA4BBB9FE3918E2, 
-0x2FD58000937A7385, 0xF4E0761088BACDB7, 0x56E2E5DC81201EA9, 0x23EBB691F0A1F4, 
-0xB9C256AA695CA46E, 0x3DDF9650AA14FBE8, 0x4248162C97703EC7, 0xDAC9AF2711E8FFCE, 
-0xC728994F78EAA365, 0xFDEC9B1DFEF903C8, 0x1FA2F45F12D35C17, 0xE178D7FAD7805, 
-0x45A370C9C2A0B149, 0x81E4850BAF2AAC6A, 0xF529ACFF22E3AC02, 0x70622CFC74DB0D39, 
-0xC8FBC68AA195120A, 0x3F8C44483211AEA, 0x938D4DF8994B7157, 0x1B11F9EB8A945B, 
-0xE5E2B9ED6D829B39, 0xA86144A141B5615, 0x497B9C0C1CE1110F, 0xD0ED9A47E9BEE6A4, 
-0xD3DB268EE4C63AAB, 0xB432C584AB122D93, 0x112E8884B9BDFB47, 0x696F900DC6C2D, 
-0x37FCE04C6D19BFFB, 0xB86A2211C91A07BE, 0x9F599F5E382776E, 0xE31B30F45B033647, 
-0xA64649555EFAC4B5, 0xA87D7DDC8E4920CC, 0xBD33F38CA96347DE, 0x5F732092B3173, 
-0x665572D2B3A30188, 0x21DC64409E6B75A2, 0x2941D2625FC48118, 0xF1D227E9D05FDFC6, 
-0xAFCF0CE36FA9AB8, 0x79B81386A67BF26B, 0xDCFA3BB5CB568853, 0x12E7C52CBAC325, 
-0xCD85FCE211412E2B, 0x96D02E15301F4022, 0xB12F3484B9D30F95, 0x5A7A7839EAD303C, 
-0x6476406F02BCBA8, 0xE146386A1BC3AF0E, 0x256BFCF46FC45A50, 0x22282AF64BC073, 
-0x81A2B035F796FCE6, 0x2088F0CE012D4B27, 0xB6825EFE4BAB0E99, 0xD28899140BDDC2FD, 
-0x748BAF160FFEFEF3, 0xE38883488D0FA097, 0x65C81FA7091C2B68, 0x2FBD1889B58F6E, 
-0xB14DA03B5245BAC0, 0x58967A9DD2CE2678, 0x1770D71598DB660C, 0x47D2859A449975F2, 
-0x1CECF8A6033EDAB, 0xF53048E42E7B57EB, 0xBC8003C16A961A29, 0x246952976F389D, 
-0x2E3DA410544D4E72, 0x6B9BDB4CF0362580, 0xF3A87F0AB5D39A8C, 0x4E02280ADF59DFC8, 
-0x7FEDBD15F9356CBE, 0x993A268343CDBBCD, 0x56FD1B8D61E1752A, 0xD1C79D2B70B42, 
-0xF330F84D269D846C, 0x7BE19AAC189FFEF1, 0x78706A5111D75BF6, 0x20B67CD7BB3F7E3B, 
-0x18AC5F0B120DE6AB, 0x7899969EE07FF835, 0x88AC235CDAA45245, 0x261B6ACBE7A6CA, 
-0x19F0F661C1C7C04A, 0x74BF7473D58B5DBB, 0x3D2E8D58DC113FE7, 0xE0EC832851EC3907, 
-0xD92419924DA92D1D, 0x7733A6AD9F7A1F57, 0xCD641EB1E648077, 0x3AC60404166EC5, 
-0x1C2EA564241A7182, 0x8D04A34B04629494, 0x9D41C698457843A9, 0xA9A2462D2EF59F92, 
-0x31483D1BE95F1DEC, 0xE3D2584CDD27B4EE, 0x788EC92F63D593E4, 0x2D18C0D922CE21, 
-0x9C9F3F7F8C5A08EE, 0xCAD78B4E365903F3, 0xDC57DF0665B8EAFA, 0x7007FAFBB06CFD3C, 
-0x2EC8C63AC9BDF5D0, 0xB26F2D77905900F1, 0x59E3A05C6BC9DB60, 0x1DA62E88A1EC1D, 
-0xD452AE3AE07BE91F, 0xFDBC5FE8615CEBA7, 0xC0ABC24BC34CEEB9, 0xC37A10CCE08FCCB7, 
-0x1EF767DA561F1863, 0xCC8991B407329330, 0xBEB818F5E7D71AC, 0x2F7056508F18DD, 
-0x74EBB1072DEA12FE, 0x1D7A8F42357A243E, 0xC704E803260ED53D, 0x793F1508E1725F14, 
-0xB6D808BB290F42B5, 0x5FFE4C3BFCABDE36, 0xA53B7D8F21F7455F, 0x11F4DBC7A4B57C, 
-0x9E14BE0ECDEEE02A, 0x96DB752A3CC904CC, 0xD77E6875BB12A25E, 0x93EBC807D6CBAD1E, 
-0xC52E126484718380, 0xB1AD903CCE1C4888, 0xD2F55476E81B13CA, 0x2ABD0B486889B, 
-0x58ADB76F0C24241, 0x413B527D1D23B60F, 0x93CA6C5C1E621EDF, 0x8428DBA53AAA490D, 
-0x219D4D711566AB0C, 0x142DFAEF803F3B9, 0x9F8252457A6617C0, 0x338E7CCFF1A764, 
-0x936EE19F7968DF5A, 0x6FB8A46F1A161F0D, 0x9FB94F426997D7FD, 0x1AA555BB0354408A, 
-0xD622A8F52FC0F9E5, 0xD06E7D971EBAF008, 0x3D9183B870FEDBA7, 0x2C6C36DC70A84F, 
-0xDF8BD7C95EE5C8C4, 0xC01BB011598F9469, 0x7903534075F1C860, 0x1563FBB45D4E1BE6, 
-0xEE9F3CE9C2117AE, 0x8B190A37F9D4C6E6, 0xB2138BE4900F35FB, 0x2F2C607D790152, 
-0x9AF326100BCE0E2C, 0xEEF9F46E226D9D16, 0xE71E3C209C9EE922, 0xB39536CFD7E64DF4, 
-0xF4CC5F8F27EFCE16, 0x557A79EB14FF5F52, 0x5F15384B77E1F89C, 0x3395D8162C55EB, 
-0x69B0A6180CEBAEE0, 0x839DE73B3FF8BC23, 0x20714F1C99484EFF, 0x4AF7393F0264327F, 
-0x577D829DC74B4FFF, 0xEEE4BE8259485F48, 0x6BC39527F918CEC2, 0x4026F3B9D076A8, 
-0x568EC71ED0192BB1, 0x20F7FE27565CE342, 0x594CB1DCBFE84736, 0xA01566220767E8A1, 
-0xEDE9B5BF57455C0F, 0x3F539B316D5014AE, 0xAB671C1B65D3C65D, 0x264136DD813D41, 
-0x3FE10DB160544063, 0x177D234AF820513F, 0x6798EA88D75E31F6, 0x8C5E24D612DBE6D4, 
-0xC94EBC6223F90AC7, 0x21860CE3CA0FB4CF, 0xCD5E8669DD55FC31, 0xCBC34B475ABF9, 
-0x8A7356FBD32452CC, 0x3F712E5C1068F31D, 0xBD121C608293FFE2, 0x88C285B3B6167EF2, 
-0xBD7B091DBC6B6D36, 0xA5BC0799E90EB638, 0x5E9272F55ED13C61, 0x11C30721677D4B, 
-0x54767D8DF1937D91, 0xC01CC4C15555EF55, 0x70DF637C9513EAC5, 0xBB50C332827DE04B, 
-0xA1F473C5FACD0011, 0xC0D4F2A92B6B11C4, 0xE7780D48849B0E79, 0x15286A87C49509, 
-0x537B2EA1EE0EBCEA, 0x756A19FC02C3FAB2, 0x90F2F9F12CADC9F7, 0x746AF394149BB02, 
-0x2EBF3AD8104B99E3, 0x65AE7F02B8EB36F5, 0x78C6BF41A5708EDB, 0x7D6476C41BEFE, 
-0xCFC3312F95CF0B2A, 0xE37446C148B5A845, 0xAFC984CB8EBCFFAA, 0x4A9A702C0B2DAA82, 
-0x86B9E1E2D73DA55B, 0x63B5700D9CF6AD8B, 0xB79FC42A254BBEA1, 0x16601A12B2EAA9, 
-0x535325B61DD7B3C0, 0x804AC7F824861753, 0xC11D0C995C1C6F7C, 0x14C63B4D869EA675, 
-0xB0474AFA70F351A2, 0xE5FC1059F84E7CEB, 0xF3BE8F20ECDB4A57, 0x7F9D1115C28E1, 
-0x7766F1C4653F73AC, 0xED398D8C30866567, 0x4AF7C26D1485490F, 0xCAD6B73A3FBAFF5E, 
-0x8C720A94FC2DC676, 0x3EB5B18E26BD1D2C, 0xE7FE11E635EC568E, 0x130091BB1F99D7, 
-0x768C66C31D0FD7CD, 0x46870B92F7B0F669, 0xB7523F9A65D832F1, 0xFF748799540ABFAE, 
-0xA7372BEB920A3389, 0x822A08377060F23F, 0x10C795C7FC498C4, 0x3EF91562BB94C2, 
-0x64778918348C0FF2, 0x45605412FA49102B, 0xC954F1B1A623FDE7, 0xC38C616CDB5B76B0, 
-0xDFB63764034D122F, 0xA824AA66B52588BD, 0x15A121A5F49726D5, 0x3A7A61D3FFFF70, 
-0xDCD6F792E86A15E1, 0xF483BDB775B80173, 0x85FF10BA034C608E, 0x2BEB4C04AA6AE9BA, 
-0x9F197FCEE6B2CE14, 0xED3CBEFBF9F4B805, 0x7C98802572BBDAA5, 0x1277087E59B896, 
-0xA1872FE083FBCCC1, 0xBE112C12E6ADBCDB, 0xBE416F4B8F970A6F, 0x1A1F658ECA40893F, 
-0x20C99349CD77F302, 0x9D299D84BD4A1273, 0x4A470F1B1654B167, 0x1F815BCACE15E0, 
-0x1D69ED7416D84D99, 0x62CE4CC58E9B0562, 0x4CED04B8FA49FAAB, 0x5B7E200E84389123, 
-0xF6A3D368641EA0E9, 0x9DD04560FD277F9, 0x3A869FDFD2E90072, 0x29D02CF368D711, 
-0x8116EE88B70DE671, 0x9BC80C64F2DC6913, 0xD609F3CB61919F8A, 0x7C21A71DBC5C91A8, 
-0xCD3CF7F432A9CA00, 0x8A6F6F7A5869EDF4, 0x1CC1468498E763E8, 0x98F0A2870E304, 
-0xC4CB21B825A64584, 0x6A1ED7DC877A046D, 0x176D545E24F773B, 0xEB12739759ECA35, 
-0x624B4AD700884E95, 0xC415C83ED46F6651, 0x650CB06CF7456CE, 0x1163C057959926, 
-0xEF216B57CAF7E882, 0x8D9A8F13AB4809F, 0x39A26D1C7A9DFAF8, 0x8C00389C8E8DBABF, 
-0xC905A7FB7093A7A3, 0x987FE6C7ED691A85, 0x4984E7C3F3AB7359, 0x2C19D4813B27D4, 
-0x5C705422E2679D80, 0xBFB7D5071FDF3F2, 0x231032306BAD3C68, 0x71556BEF9ECEFE1, 
-0x890E93CC724BD8A0, 0x7E8BB9C69AEF00C8, 0xA4496FC0851146B0, 0x72C1910B72F9C, 
-0x80159AB81089A86C, 0xD065B4417B70C367, 0xBCBCCD26F285762B, 0xB73798A20B8C4DC3, 
-0x1958A1B00F3CB09F, 0xBD95A90E6CEC41F6, 0x21D60466E3519FF4, 0x2A2AFF24B7C225, 
-0x527C64A901E25C9F, 0x90FC7F75B933164B, 0xFAF93F939900AFBE, 0xFDA713B8F11864FF, 
-0xD0B5BC32102FFB93, 0x404B4429D77B1C94, 0xA45DB8976FA549EA, 0x4FD34519FC03B, 
-0xDA292CEC6AF18D87, 0x27C944BC44FAEF6F, 0x54CDFD26DFA962, 0x569CC44B1ED1D17A, 
-0xF35E93474189F3DF, 0x36D5EFBFDE669A09, 0xF309207CA97ECD4B, 0x1C284BF8407503, 
-0x31FBA7F940958385, 0x8F0EC9DF7A2429A5, 0xEB37638EB95BD439, 0xEFFD0B9B94FD2580, 
-0x2588D643F86D56A3, 0xF019F153490517F8, 0x5FB855EBC3F70FC2, 0x6DF24D9BB796B, 
-0x91ACB9C671ABF24, 0x88FE9E9CEAD2612B, 0xD91A4DF94E36CAF1, 0x7820032AC6336ECA, 
-0xF05F416276788CAC, 0x3CB7F6D027B1349, 0x9463391EA376C6A1, 0x25D36EA750EFD3, 
-0xF77FA6E3E4C3C0C7, 0xB8F6F471AB0001A1, 0x6423530FDD8AB3B4, 0x65B6139B84CA41D9, 
-0x24EDC50F9F01C307, 0x8D7337AEA598CDDF, 0x2A8D3EA45A505BF8, 0x4024DB63F837D4, 
-0x266974F6E9E10CC4, 0x793E8D793DB06B9B, 0x38109B2FCD0CA211, 0xAE1EFE8C45CF8D96, 
-0x310FDDF5ECA60D74, 0x6BE34C381BC34415, 0x74F7BE78CEE06E4, 0x2C3693EC51A971, 
-0xE938C313912244F4, 0xAEFF76B57D5C1C40, 0x7CCB88AD6F09D186, 0xB6E940576B138AF4, 
-0xC8292141B5A746A2, 0xC1C002BEB761F0B9, 0xDB41F5237BE7E1C, 0x12507B5804EDF0, 
-0x8FF0AFA7625BFD42, 0x41E5D43B97C6BAC7, 0x1DD46939FAF26F75, 0x800AFEFD2C0A1E38, 
-0x5CD1CA2F0BCD2FB, 0x6A4E1D142C5FC6F, 0xF367774187773910, 0x2B22BEF673DD18, 
-0x59B23F2E2729E65E, 0xC7AF9AA164480BD, 0x369019948B93DD3C, 0x6F15EE3B98A10A97, 
-0x4B3139BFAF0EB559, 0x38A5F1CEA5EB2199, 0xE5986AF2981973CF, 0x60FB367A2FD55, 
-0x925912B8EFC9D31B, 0xF544DC7F4B1BA484, 0x9153CE3B3A662523, 0x905CE33D47E36BF7, 
-0x8266550B27ABD598, 0x155A0117573FBCA8, 0x71F90CBEB5B5C17E, 0x34704EAD34FEE2, 
-0x1C650BAC8779AE7C, 0x452279C14FA7EFA7, 0x49839063800598D5, 0x3BEC54549DFBB701, 
-0x45FC9754D61ECFE0, 0xEF25AD27A71B897B, 0x932CFF4753E64F44, 0x1121DBBB31D6FF, 
-0x528C450F12067A8, 0x11255D5F34617CE5, 0x6DDCD4269C217C39, 0xFB32450CAFCB9B3A, 
-0xA96AECFE63703A73, 0xB8127072AD93265F, 0x3F1DF7A403764A9C, 0x14C28C98D189E7, 
-0xAB6C874965C8D03B, 0x6F8BFC88F3B08D59, 0xF49740255CBB5EBF, 0xC5D132B179EF9ADB, 
-0x791B8FFD71EA90EF, 0xFFEEC6415A9A5A83, 0x9DF747DDFE6EC708, 0x1441E27A55A113, 
-0x699D781C78184FB0, 0x24F34CA8AC305731, 0x45ED5F9EB6E418C, 0x61C4160E4CFE72AB, 
-0xF7E6DA11AD5CB40D, 0x822D0F4F5FFFE677, 0x5A3E2F8D9CB3E8B0, 0x27F425929D2AD5, 
-0xCFEDC8838547147D, 0xCF2493A07EA82E73, 0x34138A2A2FB814C2, 0x1259F6EE7D12E07B, 
-0x8BCE35971EEC22CF, 0xBF5DDE22CDF4924C, 0x30AAD42AEB1EC4D7, 0x3446A1F300F8A8, 
-0xC8A9081D6CB85904, 0x3C99A2CB48B3730E, 0xA6A0AA5D9A012171, 0xD03DC1E36A2DB690, 
-0x45F1638730DA3A94, 0x5D34684A43369E5C, 0xD67D94765A942F22, 0x150AB19EB64470, 
-0x88FDDD6F5559E3B1, 0x2C552390BDFE75ED, 0xDDF3DE7C3A68AAB9, 0x7351146F5C6AA2E9, 
-0xD9568BCB17DB055E, 0x18286777ED7BE08B, 0x16C643134B8D272A, 0x266EFDE80451E7, 
-0xD30C16EADAEE5E40, 0x550993494F9340F, 0xD766ABED456048E6, 0xFEA8D7D683F502D3, 
-0x4E0B4A9FBFFBEAC7, 0x78164A600392C5F0, 0x6B5B2680450F869, 0x6932CB2E13805, 
-0x6F80A4BA1C513E1, 0xCCC66CD69939D8C9, 0xF9940022ED4A23EE, 0xE59BAD83EE4FF727, 
-0xD6227806E364F72D, 0xE2BC601B30BC0D3D, 0xF8674F4111FF04EC, 0x115D1468D04E44, 
-0x81FA903F3CBBB751, 0x7AA3F0175624EC50, 0x75FEFD9034582776, 0x2DB3C5299B6BE260, 
-0x237240574CC39DBD, 0x1B84D3612317B906, 0xE5B1AB4DF50DFCF8, 0x9CAB11E74F034, 
-0xFE83F7A7538A8C1, 0x6C9BCA8037CFE80A, 0xA49C74E7020F200D, 0x6F15EEEA60AB729F, 
-0x9797131264D2E069, 0x3074948FC0C9CA05, 0xFCB3F240412AACCC, 0x2BFEA10436B16B, 
-0xA826EC5BC676B1D3, 0x4BA28952AD7516E5, 0x6A5427F6A38E00CF, 0xFC0FEAB0BCCE3E3B, 
-0xFB5D4E689F12F1A5, 0x8711F7B215DDB4AF, 0xA9F013AE3938B5C7, 0xB31F2A08AC894, 
-0xD871EA5FD770088E, 0x778C1679A389BF88, 0xFEF9D0E5FAA2AB89, 0x665C9D08AAAC45F1, 
-0x5F1B8588177BC298, 0x73D8433323DAC097, 0xCD74F46134A368F6, 0x1D8CCA7151356B, 
-0x652C60AC4BCEF4F3, 0xD47E79C003B94C7, 0xCADB985757C9094D, 0xA1457305023B3858, 
-0x87D3B69105A7681C, 0x7A04600AE2F56D5, 0x628B4F896BE4461, 0x2DC8EC5EA5C23D, 
-0x63EC7D437E201105, 0x53208DE521666D60, 0xC997DA7A372C92C1, 0x9DE927765936CB28, 
-0x8BAEC97A756F5A3A, 0x2BA19851A64FEBA6, 0x8CDDBF9F75FDB758, 0x25D8EEBB076786, 
-0x92852E522E3C320E, 0xF15FDBC466449454, 0xD686D23E7A4207E6, 0x850A7DC61CB30487, 
-0xB480647BAC4D8E12, 0xC170A26714E3CF3F, 0xCFEB7FC9AA8F540E, 0x2DEE53802BFE2E, 
-0x451905DAABC2B5A1, 0x9CEE9EFFEDFCF083, 0x8EDB3514AFF4FD14, 0xBCE5AB1E18826605, 
-0x968136DB3766F18C, 0x1EFC8D0D98D166C8, 0x664ABAC518E315FB, 0x1FC4B142C8F3BE, 
-0x489ED6A4B557D7D2, 0x8A6DB2B651950C0, 0x524A68843A6054EA, 0x3E7D0F0BB7B6B384, 
-0xC9A1B0876E24BAEB, 0xFEA719BAF68E23BB, 0x9379E13F4E9C7FDB, 0x2227D90D17B517, 
-0x609737113B95F8E6, 0xB1C72B4EEDF9F7FD, 0xA4249B01F2EF4068, 0x614D55F4372CEE3C, 
-0x82C2387851FCEFA1, 0xAC4E85C72B33EED0, 0x8ADD5DB82BE61C7F, 0x2C8BF1DA40C34F, 
-0x5A178B20CE8FD166, 0x1B7DAD03099BAA00, 0xFA7D667696257023, 0xA3E5FDEAB7A5B5D0, 
-0x609BDF53FA1D51BA, 0x3F562AF8EA732C28, 0x73B1EEEA80769AAF, 0x30D5A49A5EBED4, 
-0xF657CAE9EA86328A, 0x6F39AB8D3C5AC3F9, 0x442691FB392F976B, 0x8925FF4ABCCA90C7, 
-0x5B746BCBB462528A, 0x4E8B0E14BAEB153A, 0x5FD1CAC1F49A9B56, 0x3414FE1DA5E7FE, 
-0xAA482D0247ED2CEA, 0xC3C6D2EE1B222A3C, 0x5E330018D254B198, 0x2D726F2EB3C867C0, 
-0xC23AF793CF452C8F, 0x48B17AD2F6F545F3, 0xFE6468A2AA01E209, 0x2EBDCBCA8DF1E, 
-0x988024CF18924B54, 0xF5D4E071962047C2, 0x5E82745D8E9CF41A, 0xFD71DBCF875F7657, 
-0x1AA37C749A874795, 0x13D56F3E28DBA931, 0xA89607E9759A4962, 0x3D76D8B53B21B1, 
-0x27D8E311F5CB052D, 0x6727C75FA36B3742, 0x11E7B8DD06C058AD, 0x81AC7059A987731F, 
-0x3552DA16934B049E, 0xB90DF865F4EE483F, 0xC6909E8DCF143A00, 0x3355393C1BA084, 
-0x98DD72A6E4052324, 0x8518D4D03B9361E8, 0x49E6944D706DE03A, 0xAC36129B49F8815F, 
-0xBDC2E0C5A6D61398, 0xC3BF52E9658F812E, 0xC3D875D20D6E92AD, 0x2B3D12FC1F43F1, 
-0xED54E51714BEC3F3, 0xA82413FE1C5B442C, 0xFA56015EF64CFA7, 0x8F4BA2AD580948B9, 
-0x8B77FF6DE4DC2822, 0xF6388F0656BFA509, 0xFA88ACFEE6C98610, 0x2D15AEEB49C50, 
-0x2C5317436AA3AE4F, 0xC7E1E7ADB96D8AD1, 0xA5B7341BE4DD48CF, 0x872A031873808B9F, 
-0xDFC3B9750E49AF2C, 0x4722056DDC198DF4, 0x9AEEAA6B524EF83D, 0x20F28437B5A5D8, 
-0xF8EBFFF0E15753DF, 0xE8DC60250A67A915, 0xA218A949CCE764E2, 0x255586AC44CE22AB, 
-0xE6D488814B17D487, 0x8391F7B7BF5BF6C3, 0x46E4E8C7589D6BF1, 0x3AEE6D70B30B7E, 
-0x139EB66853044282, 0xE5694548962A2DB4, 0xEBB4D896D711D553, 0x55D2DFCCC3818903, 
-0x91F9BD94C6801A1C, 0xA010D205BF92CD47, 0xCDFDE47FA3EFA957, 0x34F6B4F3AFBF08, 
-0xE2C322BEEFB4C4DA, 0xE922F2DDEF87B6D2, 0x1CFF76C98CBD30BB, 0x1EB588582099A005, 
-0x40CD46F6377DA9F8, 0xCC276106247691F8, 0x3C65585141BE4F67, 0x3C4380F7F738C8, 
-0xF74DCA8B91F49B22, 0x15775C3D499BAA32, 0xCB2DE0A3DB02AC38, 0xBC556A0D8592E137, 
-0x7D47E9F392DBFF40, 0xBC73BDC8B5DFDDD1, 0xC53CCC39E49FB239, 0x236D0B9E1C208C, 
-0x90A46AF46945576D, 0x5866E7A76D448EDF, 0xAF2D4B6AE6DE7D76, 0x53DF94F2B8A01184, 
-0x317C2222ADAFC582, 0x1C86C15BE04E049B, 0xD552CC0D50A20958, 0x2AD354253EACE0, 
-0x507D8458AD4AA50D, 0x775BA4EB9F27D402, 0x3CA8E9A0CA60FBB2, 0xC3AA02C16B81B780, 
-0xBA6D9F49C9E1985E, 0xB02A302E4B643000, 0x35C4AAFF3FD53043, 0x2F6DF179B397E, 
-0xCB8EA1855C2741C5, 0xD51ECBE06E7E5E13, 0xA3F0A8EE22FFD234, 0x23234ED7085494, 
-0x144AE10A9408F953, 0xA003E6214E8D5585, 0x32B4B45FC60B6853, 0x20F21E51E9BE4F, 
-0x3536AC9C465EE73E, 0x4F899C7040AD07E7, 0x8AC7CAD3B82ECA19, 0xC8E7A945162F4B75, 
-0x689E001485084FE6, 0x67BB6EE669E57F34, 0x7D6BAE9FAE1751F2, 0x1AB2EB12EAA90A, 
-0x2AE5D4F5B1C9B9F9, 0x1C63A11F51220F5F, 0xC2C4164B618ABB6F, 0xE7F13309031D4FCE, 
-0xB9636A0B8F7D55F2, 0x175B706475A3CFB3, 0xE1A21ECBC9892F61, 0x3DF0E548039FDC, 
-0x3A984FC7FF5ADC5F, 0x661A421E9317FE48, 0x65502CD7CC751059, 0x7108EFFF5D553927, 
-0x9A0F96C8CAD61A31, 0x573DE382C4462E0F, 0x73F42820492050A6, 0x12F37A983DB57B, 
-0xDEE7CA309442DB0E, 0x86BE1686DA2FE7C7, 0xBBE1ABF884D916F2, 0x3C0668619537FE2F, 
-0x39D5A338FE41392B, 0x1F19BF58DDFE4C71, 0x132F30659F52B575, 0x15DA12717B0808, 
-0x7B38132C51CAF123, 0x4A7FB08616ABA90B, 0x62F9C8F945A6F494, 0x5C5763FBD09F26D, 
-0xD8EF94C853AD78C, 0x14C827894C7D11F0, 0xE51855E05AF273B1, 0xBA63588CA682A, 
-0x6D44F8C8CA8B1FDE, 0x1D4494FE3D827E87, 0xE5C1CBDBD9A94076, 0xCE27F702D32B4867, 
-0x76A4ACB7B9FE4BB1, 0xC81CDF8AB5997005, 0xE4BE77E7990D5289, 0x391D296BF8B004, 
-0xD509CE11BAE7C7F6, 0xEBD5F8F540383221, 0xBB31138CBE8A1D17, 0xEB51E8700C514ED3, 
-0xBF8F53A0F8CD70FE, 0x44A1BD2A1CF36A1A, 0x9CDFFAB27E7CC09B, 0x13BAA073103BE1, 
-0x6A16EB484DDC2064, 0xFD015449F09681DE, 0xA40667F04E8ED2AE, 0x2D98832FC9C026A1, 
-0x24DB8EF3C657497B, 0x581DDC35253C5430, 0xC9731A967CF07C71, 0xEC2902F1BC511, 
-0x812C1C7941E5EDB5, 0x9F199105721F9A19, 0x67521F9ADE132D3A, 0x1022D52BD6DB1EA, 
-0x690EDBFCAE13229B, 0x82B9EDFBCD2B76CA, 0x62FF7D0E5C9E206D, 0x5A16D45BD6B89, 
-0xC7BC7B36C9F4ED19, 0x756044E71777287D, 0x7A1EAABE1D04D5F1, 0x487B91962C97FA96, 
-0xE760D9993C9EAE44, 0xCF8372F3F692368F, 0x516A8CB5F9F3B9F8, 0xC2BACE881E1AA, 
-0x77D1B40E29F65729, 0xA7A1D760F8884D7, 0x207DE24163B2A966, 0x302555532E13188B, 
-0x3BB65C0B8A7CECA4, 0xCF2065554764AB06, 0x854B215241A97CB9, 0x3FE218FB615E64, 
-0xA0B906658700E56B, 0x1922B87DB25BBA2E, 0x12C89A2D6C0C548B, 0x4E1DF6EAE0C7EF20, 
-0xC0EBD6CA26D7D648, 0x380BBDABD7261CB9, 0x51B816BEFF363BC6, 0x328F6BD7A715D4, 
-0x3DAC5DFD5CA0FBD2, 0x64EF75936E2BD8D0, 0x379EE9D702B16249, 0xBA15DC55682DDF91, 
-0x68533A60B0904167, 0x4687245F420BAAE0, 0xECCA64B75D732B42, 0x36FC8486F348C0, 
-0x2315FE084482DFF1, 0x5480CD17F6B93266, 0x81633221858BDD7D, 0xA5E982F68F509C1B, 
-0x678E99975AAE4CCC, 0x3D7B95EFAF11DDD, 0xCC476F8F1E6F401B, 0xD554A52BFA1AC, 
-0x432EBB975078FEA8, 0xB6FB3930DBF3F056, 0x52DA43D5B3970D3A, 0x3BD7560E8E00005D, 
-0x4303E2255B182E69, 0x8079BBBF0D3142C9, 0x857952793BA8AE3D, 0x484B6D28072A0, 
-0x97E0E2A90F6921B9, 0xDA6ADAB41779F566, 0x159ABAB45EEB54D8, 0x8DD4891B15D24CC8, 
-0x403E11F89023AE95, 0x839D1F288DB86E37, 0xD8DD8E7339583214, 0xDD0313927834F, 
-0xB356B4D9498E05AE, 0x67E1474FF6526FE5, 0xC17E416E7EF2649E, 0xF57A71679C12F12C, 
-0xA936EFDA102D8166, 0xE9E18C8CEE9AABE7, 0xC2737F7E18D38EE1, 0x3124C7F1037C16, 
-0xD1DBF0AE3335936F, 0x26149F68927EE041, 0x55251FE67DC9E038, 0x9D7A5FAA2F33F52, 
-0x487277B702C873B9, 0xC1C408FF7E018206, 0x1C9EDC2516EFA38D, 0x3375E1247A99B7, 
-0x3297A137B53B6916, 0xA9C2B75C1C641B4B, 0x98A8ABA2F71C9D77, 0xE6B48175C765011C, 
-0x7E9ECAB415D3DBD0, 0x412217221ACA9BBB, 0x555A797BFD452EBA, 0x1C854B0CF52548, 
-0x2BBD625D24C611D6, 0xED0620932A2A0BC, 0x7ECB7D96B39B9986, 0x2ED8D0F28FBA3AF7, 
-0xC1ECC600C2012DC7, 0x3DB9909129D9DBB5, 0x438D64AE687A04A2, 0x35901C51153F51, 
-0x9BE912346C9109, 0x41576881C630D149, 0x6D056D1D168D0539, 0xC1A331F6587A9BB5, 
-0xED51AD5A39B63DFC, 0x2AC22E474266C012, 0x1AC9F7488CFFE8CE, 0x2DB2E6976192C0, 
-0x26C426C84A257DDD, 0xFAE15C4EAAC4AA54, 0x60B76701299012AD, 0xB321656F50F73B62, 
-0x379545E8FAFBB1EE, 0xC2F47936CC028B88, 0xCA02A08A7F2B32C3, 0x20C5C7AC58FD2F, 
-0x970F04B169397933, 0xD717C689C2E9ADDB, 0x2862D2E0D3B5704, 0xDC5E7EE29042647B, 
-0x79C5410967D5D068, 0xAD405F50B6E63F99, 0xF7194E9863A54C13, 0xA2B3ED899A273, 
-0xD815ED259CC63930, 0x49C37560CD9CFB06, 0x6F5EB5A7BF85BF27, 0x4707DCDAA2C60EA0, 
-0x675DBE94CA8D8340, 0xC0646B5EE6CE1424, 0xD5940E27FAE2EE9, 0x32151D6FAEE39A, 
-0xE71AD35DA56B8648, 0x18A1F9FE093AE254, 0x32F5B17CB460ECCD, 0x13E49ECC4A28E02, 
-0xDB3BD1B6B40C439C, 0x5F8A537D36CDE679, 0xB22DB8F4D13CFFB8, 0x3E6C69663CF72D, 
-0x989B1E4AF1FC427E, 0xABF141DB43971C73, 0xD44C430C9CFF3E8F, 0x3CABC6B64EC923BE, 
-0x9CC7C1D7D81FD25D, 0x51AF0EDC88AAC210, 0xF59B03AFD8FE62BD, 0x2FD000D4E02CCC, 
-0xECE98738BF3C9CBB, 0x105C2E52CB1932B0, 0x4B3E90841C6F66CC, 0xEBA6799DA616FBC6, 
-0x13E0CDF11BCCE5E8, 0xCE0FF9A41CC1494B, 0xF6026D2DBF447A69, 0x3E28D887826E7D, 
-0xD3C4A30B07EAFED2, 0x1E460E56D6668C91, 0x7D3F168D7FC2B8EC, 0x22BE892659F515C3, 
-0x5D6C48F6A5FE7420, 0xCFA265F9B6FC7A14, 0x468B2814030F571E, 0x10F24CD0E14EF0, 
-0xEA1C291FFEE50386, 0x97FDACB79FA9D3A3, 0x3156E529035C3DEA, 0xE3E7558082337037, 
-0xC8A403BD667573FB, 0x97DB12AB278C1FD6, 0x5D925E2528C34FE2, 0x36393BB5F50CBC, 
-0xAE5C8B737C863BCA, 0xE0C6BCADAAE2D5E3, 0xE3ECC982C032D778, 0x1C6C5DFAA617725D, 
-0x128606A4E9BF14BE, 0xE2178F7E17845432, 0x12C70FDD3971B6CF, 0x2302985FA727AF, 
-0x4A6EB7A7C0E08A11, 0x45E5D49F38978F4D, 0x7B36FBB9AB828FB7, 0xDBEF6D17D1D1E6FD, 
-0xF14AA10B80434B12, 0x5CDBF654BFAC5B04, 0x95A476E4E38562E5, 0x2435369C53ABD8, 
-0xA00650C47568C26, 0x3C43ECD6B5DC8179, 0xF78BB79D760B0BD1, 0x5771A4C3EDC44016, 
-0x8A0D9C8A93CBD55D, 0xB9BF713CFC647890, 0xA843FB9C42FB509F, 0x3518FD4630E4D, 
-0x5CFEF941EEEDF29C, 0xAE97474BF4425338, 0x85D45DEB404E752B, 0x3A653CF016CF30CF, 
-0x13F47A8385D87E87, 0x9921E48B74EEBC8C, 0x16819DA66DC1824B, 0x3084ED2A5A8920, 
-0x7856B639949BD395, 0xC2B1FFE099067074, 0x2D52089CA22C4B57, 0xCB1B7D176F312156, 
-0xB68F1623D55C0915, 0xE94FE111C646ED0C, 0x6E6D2B5D9D8085C, 0x1DE686A38A783E, 
-0x278C221682E95182, 0xF120271DD13C10B, 0x3E0E6F6EFFED7770, 0x22C1E6526636B35F, 
-0x70DFA3E0F3523ED2, 0xCB7C2DF72C2147BA, 0x48C6C4CFD2B1DBF2, 0x3B7E9C93D000FE, 
-0x874891D44016F01F, 0xFBC62CA576B53086, 0xB7274A845D20C1BD, 0xD3ECAC0F8681F68E, 
-0xEC593134C1AC3766, 0x246E6C877E5B86BA, 0x760EA13CDDE88DE3, 0xF7CE284CBA85, 
-0x5AFCC7B1AD3A4B97, 0x29A531FA6E4BEAD3, 0x2754D124C5B7EA83, 0x4FE498306A4AC05E, 
-0x30D9766F9103DFC2, 0xA8D57D8463DE5EBA, 0xC78EE734D49259DB, 0xA3A99E9BB1A74, 
-0xD39AAE69091A5B7E, 0xD9966330DA15A7F0, 0x60BDD2197E5962E, 0xE33E44DB925F3021, 
-0x1053D03B8B57E85, 0x91C29947F46B5BD8, 0xE49A9DFC4343B78A, 0x3599E8B2D55FE2, 
-0x91FA1EA88A37F2AC, 0x7B702AF299259959, 0xE8CFC1EE8837AA96, 0x6ED35303E3749299, 
-0xE92F2DEAB017CFC2, 0x1D47692D15EE9061, 0xEA39D4DA35611926, 0x3BE4A5485691BB, 
-0xCF43097860D37D86, 0xD4388E6F8341E87A, 0x381506AFFBDB3A4B, 0x33593E5A6F513877, 
-0x22C143DC21E5342E, 0xA85671022BC87957, 0xCB4EE167C5AC7AB0, 0x132D81A29D149C, 
-0xD6AEBA44270FE895, 0x11B34EC32ACBB454, 0x80D48ACC4C80A607, 0xD5727E7728C57843, 
-0x5451534AF9D91000, 0x72D2A234BEF68A4F, 0xE45BB0D4ADDC671C, 0x1EBF5279BA5B2E, 
-0x524BDC21D7ACBC2A, 0x6377236958BF92C2, 0x122B606865A6B3EC, 0x2F32E0FD8D6E78E8, 
-0x8B822717EF63A87A, 0xB2180BAFEBDDB5F7, 0x445706949319B114, 0x201C62CDB0EE95, 
-0x14352AEB584ACD0E, 0x8DFD3B02F7FC3525, 0x5E83807A3A4E1CA1, 0xFB884D9979C6E26A, 
-0xEB3F579E9E681B3B, 0xD084121F3A168095, 0xB653F6E78BCDC934, 0xCD86EB89876D2, 
-0x28BBDA3B81BD6947, 0x433859058EAA534C, 0xD770AD2955A1A1, 0xEC2A6B83AC1A8E78, 
-0x4654D1A32230DB20, 0x825BFD06C267CA06, 0x17B87786CF298126, 0x3DE909B7230AD, 
-0x56975C6659EECDD9, 0x98C99F76D53EAF70, 0x2130C453F58B2F9, 0x7426BB02E4C0F8BC, 
-0xB672AD535DE92569, 0x669E0334166BDE99, 0xA431A5280D725571, 0x3937B7400FDAA4, 
-0xFEEB2C4C41F5D15A, 0x9838ADE6432D62C4, 0xCEDD78228628FF96, 0x46A597E95492829B, 
-0x2842534465D15857, 0xFED0DAB7124567E9, 0x9E04D413AC631DC2, 0x7875613644B84, 
-0xD8991FD938C92F1D, 0xD39C5CD20DA49B4B, 0xE019155D0FA51576, 0x9DB0DE05546A8899, 
-0xDA56FEC5DD00B97F, 0xD8FBF6B0B2EC9AC0, 0x8C55037D86E28BF2, 0xCD290BC8C5B6E, 
-0xD5622C5BA127AF3C, 0x72F1F19D502AEA48, 0xACA969630CD7A18E, 0x415E48D2C54E17FE, 
-0x8C2482A250F8B53D, 0xDF59568F10E2CC51, 0x28BFD6E04FDAA19F, 0x1F1B691EA24DAF, 
-0xE4A1704955C2B0F6, 0xE2F0CAD04146F313, 0x443CAC2EB55A7EF, 0xDA42FE24C8809116, 
-0x9B149C06B2E8E351, 0x99610916B4346289, 0xD0348569EFAAA3D2, 0x1838886FD212F, 
-0x2AFBF090AB0E892B, 0xE69FC43A09F860F3, 0xC569DD6C4C187864, 0x384B00299DB37C40, 
-0xDB652BD9BB88736E, 0xDD1618F0C5B3ECF7, 0xAF48F3A1144E8DC2, 0x1694CB4624D7E6, 
-0x4BA67AF586405497, 0x87703FDDCEED7599, 0xCA02A0C61EA4C8B, 0x7F9CEFAA31C762B4, 
-0x96BC687B5799BE8C, 0xB9D4E0590F121231, 0xE161D41AAC2FEFC, 0xC56F1E7C7BEA1, 
-0xF93A00576B741AC4, 0xC3CD338BD2D4F998, 0x480B18BDECE27D41, 0x52DB9EAF717C99CB, 
-0x3112CDE8B98BCD9B, 0x32B3E91861DA5089, 0xED52B5E602870DE5, 0x37BF0C095D97F2, 
-0xB48AF92423D189E, 0xA6636725E2D2D112, 0xCFCB3AD4203FB56D, 0x93F3F28CA293AD1E, 
-0x9C3DFD32B98F52EE, 0x63EAB7D5D239A8F0, 0x7C088FEC2AF2554B, 0x314128D2EEFF12, 
-0x7A82E99A21777977, 0xD5C4CA9EF49CBF5, 0xD4AC773F1EBA7FE5, 0xE10B3B5176F567CD, 
-0x1326B5D1C433A6C2, 0x4B9F634D0213637C, 0x33CEE9AE1808141A, 0x6E736C7977F99, 
-0x17E6FE2EC4B32FE1, 0x44C909FB643A84AF, 0x8EAA287105350C98, 0x584F4E04A2218996, 
-0xBC4B59C83075D300, 0xE84D03DFE4C7ABBD, 0xD22939B9DC696238, 0x19BE6C199729D3, 
-0x9DC3283CF41847FD, 0xD0F623EFECDCA4CD, 0xA4F2BCD58FA2D8EC, 0x95EA298E9EC3C694, 
-0x8AF5692A09E86E6D, 0x3E671C65E8EE1979, 0xB66471175FEDE947, 0x21604FBF4A4546, 
-0x6394629BDE06F1E, 0x1270AB4C279FA3E0, 0x8A8F548195A95967, 0xE45F0ABCA3DFE059, 
-0xD79F5F5F9AED2250, 0x84187179A8D2A830, 0x196CFEEAF39141BC, 0xB7DD38F75EBA7, 
-0x7FCBB6EF4D53184E, 0x626DBEFFB5C06B67, 0x528C431ADA807021, 0x6BD8C8EBDA359470, 
-0x3E3A3F05A3EDDF8A, 0x1EE4A491ED9F3539, 0xBEA8C47F6E8ECFF2, 0x25DA8832573F5, 
-0xEEC08FB722D42E24, 0x2119F06A95351EFE, 0x4DA052B9C99150A0, 0xB43A4666EC405E87, 
-0xA469BBB85436F39C, 0xF9377506355EAAAA, 0x9719990B3A89808F, 0x6195AAE105794, 
-0x73B9052920C5A1CC, 0xABC3EE679996EF3A, 0xBEB3DFF132F4CFEF, 0x8F78AD464813F353, 
-0x51A059AFAF5575D8, 0x5366FAF5D7E898D5, 0xBDEE43A29335F3B6, 0x3855FCB92038FA, 
-0xCD7C4033511C98C4, 0x92728225DD24E301, 0x742210AC58C5004F, 0xCD14D433A8365B67, 
-0xF944EC9900FD04CA, 0x518E3DF9B0EBA971, 0x1F460D127B782B02, 0x3F4289E65DF466, 
-0x2522809D64553BD4, 0x36DDD8410FB3BD7F, 0xE5A9C43305CF5C15, 0xD64603F01EC62E5D, 
-0x273BD3E0E9A4C44E, 0x3C62CD0D91F0DCEE, 0xFC25EBA527D52A98, 0x1462C2DDADC471, 
-0x5DA82C09032CEE40, 0x8EF5080476619FBA, 0xF496F1FC19091302, 0xF2917FD3898513CC, 
-0xC0A46F6D2DB2635C, 0xEE285CD032F1BE6, 0xAD4B4D8A84BF6184, 0x1274ABF631EF6C, 
-0x526CC8FCE1F33E66, 0x53938CEE39F01A6B, 0x9B060EBB3F2CAFE6, 0x11C31B455E6DF31B, 
-0x776E630BEC3C6462, 0xC58F46C26D23F801, 0xA7FC8EF071EA3800, 0x3FC9C31383F234, 
-0xC189EB84929AB0AC, 0xDB10FD8BD2D3B31, 0xF45402A91DA10EDE, 0xC13050E782AD38BB, 
-0xF1902AFFD87643C1, 0xC777C0804D19C3F2, 0x6FE7AFEB89FC8FFE, 0x3D8DA3245C35EF, 
-0x2F2CA3E00B8792AC, 0x3038D78808535582, 0x2B9C6244265ED26F, 0xFADEF2B90C302454, 
-0xB775FF0A3F24284A, 0x27C08FAD8AE18A61, 0x7E1F91B90FE1EFDF, 0x74C375DD4D0CB, 
-0xA6E8EB9E25406647, 0x7B1948D4C343AB88, 0xE68917C9414DD061, 0x4A9037E692FACB25, 
-0x53FC51F769BEA456, 0xF43CCBE6FE792C8A, 0xFBD2DFB0328EE198, 0xD277CF08D8FF7, 
-0xDAEE9777512F6ECD, 0x2BFF4D684A7C09ED, 0xCE5F1A93A2E1B8A7, 0xD9BA6DA20ED3E772, 
-0x35F42DC07CD06B40, 0x4217CDBA3B9E2FD3, 0x3E7BA7247F79FCEC, 0x763E83944B4F4, 
-0x347EF329E7DBFCFB, 0xDA83E50BB867B22E, 0x4F54C0D91D91A5E2, 0x67578F0B015CA3C9, 
-0x1BC05F25FA85F315, 0x9A1240CA6C095C0, 0x4A742CBC02D6819E, 0x3ADE63668E5364, 
-0x9BF53BBC66DE82E5, 0x9745112065680070, 0x8D928CFE77546F29, 0x30A2EBCAA20D0A64, 
-0x8050A48913D7F4E, 0xA0909BEA0E31673C, 0xC2F60E78636D8A91, 0x25A979E7B3617, 
-0x9F87AE1A69D71DFD, 0xE4B9515BA757204C, 0x7C9EB68A2FB39BD6, 0xF367A61C1274607, 
-0xE3B1285B40DC31BC, 0xC16C53CBFEE6054E, 0x81A20886ECA7B83B, 0xAC27969A82B18, 
-0xD7A5C628667D9AED, 0x756392D856D2AF01, 0x6EF9C6255BC2F9C7, 0x69DA9FD5FEA582B5, 
-0x7B46226862E491C6, 0x81E85C8E0859A1DB, 0x38AF6DB525DD427A, 0x3AAFFD72B0513E, 
-0xCC63AF17FECB8E22, 0x59F341ABF111F23C, 0xECBFD8895E749F85, 0x2EF3022B462340E0, 
-0x8F6A92531BE7D921, 0x5249B014361A33B, 0x1A8D7E695C03A940, 0x23E69273A0A0A0, 
-0x31A810F6D7DE19CB, 0x165487E4C2511C83, 0x16735B1D0368C52A, 0xE67010842579C09E, 
-0x86CC9AAEC089B518, 0x5D1F6A9404946CFC, 0x4A291EF0AA47D3F3, 0x1C5E7F47BC34D2, 
-0x593F9EEB5576CE93, 0xD5ACF9AD19E12363, 0x2F6C302076778CD0, 0x37A79D10B67C33F7, 
-0x51164C193E755AE5, 0xB928897DD5D3E571, 0x10128484DA2CA2C7, 0x20D18778A87644, 
-0x74E1187070E63B0A, 0x6BA182775FA65917, 0x50F6443C478A31E8, 0x85CFCAE36E0A32E0, 
-0x2D450189DBED912F, 0xEC4310537457C09B, 0x85BD7F477C3D58E3, 0x2F544C7A468C58, 
-0xE04E3EE89DF9CD10, 0x2D5F391E3AE0C010, 0x9B35CE7620268597, 0x2668BF744EE7181F, 
-0x6A92C614163F49BA, 0x1D70378F07C849AA, 0x6E1F04AC4B4576DC, 0xFAF8493D8921C, 
-0xBE0F1EC4E87FF10C, 0x98355C62BCB83C4C, 0x4D8F1F24418A82E7, 0xC07B869DF318A161, 
-0xA112611B694B206D, 0x8602267F7F995C55, 0xCDFDC143EF02CE89, 0x1A9859969CDEE0, 
-0x8F5C220FBC1B61DC, 0x85C3D69F6A1D198C, 0xBA9790DFE36303E5, 0x42F8F250671B0E9E, 
-0x11089CDDE8D8AD4F, 0xA79F2FA83C561CB, 0x5DB244B815A8D58E, 0x4072E8128B2EA, 
-0x5310D0C9E6E727CF, 0x3379E34C8255ADE9, 0xCD6DB0803F4EA612, 0x6A6F0239CB3283D8, 
-0xF79918FEE6F01DCD, 0x5D94F5CAB8E4960E, 0x5F052F8923CFF7B, 0x2A44B615CE7E8F, 
-0x4CA668B9151F1FE8, 0xBE8B7071F553AB51, 0x26E51C369FF6ABE8, 0x3AA93C0D1A9FDF3F, 
-0x754AFC16468AD206, 0x8D54131DC55CDFA9, 0x4C537692AE773105, 0xEC07357F36227, 
-0xEFF183F5702D684C, 0x68DF3E6B51F2D586, 0x15DE6D956F474F42, 0x3A56EDF1FC46A13E, 
-0x4AE84FF2D107B3C6, 0xE6D2090E73FE1BB0, 0x35A679808C2F1737, 0x38A92FE1DB968A, 
-0xB4DF80EB1CB1183, 0x85DB43DBDE8FF6CC, 0x399EC33DCFB22C0B, 0x9DA53A64A8BE9663, 
-0x3B2E79C583144CB, 0x9561AAB56FAEC546, 0x50151490B0E14412, 0xD9B6C7661436B, 
-0xBC7366E0175128ED, 0x54D507EEF35D5DE1, 0xF7E61DE527E3F6C9, 0xA1D0E997EF053BFE, 
-0xD121A6D4C033D662, 0xAE664F0A348F547F, 0x42B4BF690A3FE7E1, 0xFDD21F5261996, 
-0xC891D6148267F1D, 0x318D72A930658DBC, 0xC88218AAF5B9C1A3, 0xB73119E36399BADC, 
-0x816BDF40D519B37F, 0x1F0B6C112ABBE3E0, 0xEA892026B67A726E, 0x14725248877B0D, 
-0xF22B8104366C3B05, 0xBC9A4EC1DB3718FA, 0xA96B127EE280331C, 0xDFE8D449D8915F13, 
-0xD2A5B8F7CEF3EC03, 0xF7E5FE3353DE92B4, 0x96CDEEA90FAD7C1F, 0x20585616CD393F, 
-0xE1C308D06B335253, 0x49B77B610AE5EC72, 0x34B4C128947949E6, 0x53D75B2A3BE70FFE, 
-0xF1B2E2C5F4307693, 0x25D0EB51E9A0B7F6, 0x605523A223760FBB, 0x20B58BE108A584, 
-0xAC87C59568E42E89, 0xB70296CFC4494FD4, 0xFE8CF94A14248549, 0x62E66F6164DC7BCB, 
-0xC1D31C9440C49797, 0x544BF90A08CE33A2, 0x345774241DDFECB, 0xBDB0D79A13885, 
-0x5973911E4F0A73FB, 0x1405D5F6AB9232D6, 0x3BA323A33F6AE9C8, 0x921AA708A677D68E, 
-0x9A5AB588D1BA2150, 0x41C0881F7AF4DCE8, 0xD452A88D3B1967A8, 0x3C4E8002CD7F0D, 
-0xB368288FB280B0F, 0x30CA5CC6B5CFCDF8, 0x30B8B68D14A97EF7, 0xB15E628A8226A6B9, 
-0x4A81FF01E7049173, 0x54C02E9AEF83EFEE, 0xDD5A0E31458D4C8D, 0xBE1DFA0C7909, 
-0x3462635A756BA92, 0x9FF9C6D30B49E7CA, 0xF7635185781688B4, 0xD92479B05F627D58, 
-0x939D0BD79B2B0978, 0xB603E41006C3351E, 0x73ECBC7C579ED5CE, 0x1909673DE9EF68, 
-0x3AEA64B8061F8E26, 0xFEFD059B76566DD4, 0xA2FBF3BBB343CD72, 0x32A06DA51D9A145B, 
-0x64B8E1472BFAC74C, 0xD05340D18930467, 0xAA1DAEEDE436F9A2, 0x198CE4377F94F7, 
-0xD4A6704158ECDE3D, 0xE1DBBC37692F2D1D, 0xAB032799CD847D20, 0xF112A09763D841BD, 
-0xC94207B46A50E640, 0x2A226B6CB21E58ED, 0xC901C2A8BF17C073, 0x3F925ADB023E75, 
-0xE345BAB791AB7BA7, 0x3FB1FA7D72A15642, 0x4907374984F7B188, 0x89C6AE68B6433092, 
-0x306BD36C0194DB50, 0x626DFCE1FC64D683, 0x7E63B14DC1925FE7, 0xAD2B300DDCDF3, 
-0xC49A8604C9EB4EE0, 0xC57C68411C37EE7C, 0x1972AACDCF6BFA5, 0xFB2799CA78D3C64F, 
-0xCF0178447FB47ED3, 0x2B1202B2B07FE32C, 0x8ACC78222F68312B, 0x3867009532B82B, 
-0x20C0E2B4978C5618, 0xE3089D5F1FA17D56, 0xF5BF801BAD0D9AE6, 0x42F8BAA87ADE2B1C, 
-0x9752E7FB4E618635, 0x1B3E471BE4A0E0A0, 0x27B723C5FEBF97EF, 0x3BFE6389A823D1, 
-0xB61C290E385C0508, 0x8263DEAD2A825054, 0x9634D3425306B7E8, 0xF33DDFC7C6B0446A, 
-0x5C63E5F57463A4A8, 0x704485D515CEDCB4, 0x2ABDF0CE08F45227, 0x245E1B633B02E9, 
-0xCC8E965A42A43E10, 0x4305317D40B2D996, 0xB406CC6F3C2A5734, 0x63AD76A3A0106DE, 
-0xC6A2C6598FAD8A49, 0x964C9C4BFDC89711, 0x866BF40E998C7B90, 0x30E17193E64540, 
-0x98FD523E6FAF845D, 0x130EB338D55FE2F6, 0xEED3D8460FB58360, 0x602A8F327516C9C0, 
-0xADADC25E1BA11183, 0x378F811113F5B8FF, 0x8FA4118FD7382581, 0x4416BD82C4E54, 
-0x9EBCF9B0B02A91AE, 0xD2294877EAFA4F3B, 0x8D11F35B927806CC, 0x7A2BDD130FA0A1E5, 
-0x7021AB6254EC75FC, 0xBA05F1AC2353E37C, 0xB879D48F682D1813, 0x15B6B5116C7A69, 
-0xD0FFD8FB1E865E9B, 0xED38DFB6A2EE4C7A, 0x1BCC88130417E7EE, 0xAAEFCABF636C98B0, 
-0x24B0775A10379EBF, 0xDA89B2C300DFFF65, 0xFB8BD7CE48BFEE70, 0x273F4C6CFDD86E, 
-0xC57F62A6B4D2A35C, 0x25F5D61DBD328920, 0x323D0843805C90A7, 0x477014AE43FB2BA7, 
-0x6A675B6C0EFCA370, 0x2D9D08E2DA1155B3, 0xB4A888580B24A7E2, 0x3359EC9DE7B4CA, 
-0xF604AC66B74131C5, 0x6E0EDD56CF17358A, 0x4EFA07B31D17DC3B, 0x2D2D7893729449E9, 
-0xDE96F8B56BBFE985, 0xA0020DA33BA162F1, 0x97992C855428FC1B, 0xF6EDAE585924D, 
-0x5EE54C1CE7E4E6BB, 0x518893D19CA59310, 0x7C92872DCB2452D9, 0x4C248197608C4E44, 
-0x1E8580CE179AB2C, 0x106B2E07386ED9E4, 0x9C9B94BDA66A901F, 0x255E668E951530, 
-0x22E7B12E24328B0E, 0x1560E6A29B961DE7, 0xD3B37AECF9546D16, 0x27329B486C6AEC75, 
-0xE7D4583A368F1D64, 0x950909DB923368E2, 0xA77A620C2B5D98F2, 0xB1543696C4C49, 
-0xC2FDE51314D22CC2, 0x8CB55BD405DBA7F9, 0x9AB4672A79CAA8F8, 0x763B40929579608B, 
-0x735DFC4F49A9962C, 0x988C5CC89FEC09DE, 0x816C6870978CD048, 0x11E910925CA26B, 
-0x4C5E33C0A541BF81, 0x6CDA0AF2A323A3AE, 0xCC4FC1358A3440FC, 0xE35258976DBDEB02, 
-0xB9EF3FB756646888, 0x471FABAF062DE1B4, 0xE83EB0FC90D6CF8D, 0x1190C7D13869A3, 
-0xA0137EBEBCE44DDD, 0xABF346B5AF5E0D95, 0xD7A1053B802E65C8, 0x845E84A36C78C511, 
-0x4278F04019602CD6, 0xE71A5E211D45AA5B, 0x1A0516123DBF2A86, 0x1C59DFA56B113D, 
-0x34B6EC5B0734275B, 0x924E7DD54F11F430, 0x4C464CC7FB1CEA9A, 0x1C799299ADD696EA, 
-0xFF243F5797364628, 0x44EA6DDA8D861153, 0xCC929F747AA7E93B, 0x8795FA1E21C34, 
-0x8FAC0E3559E1835, 0x6EEF759BA02E98BF, 0xEA7CBA27E06CEA5B, 0x77A297B066B2E61F, 
-0x7CF86F479F56D2F2, 0x5A5FE3EFA3072A4F, 0xAB56377DAA9809B2, 0x2831BE1D185CBD, 
-0x7684BFE0AD303C56, 0xD8D2A37706DEAEE9, 0xF37E6FE8AA31F8A7, 0x2CE6505A812FDD87, 
-0x73A0D6EDDF66D11E, 0x35389CF804692B5D, 0xBC3B8DBCF914E65F, 0x16609257DC2111, 
-0xDA076217DF1E97E7, 0x843883C003463E65, 0x5A58D6ED22F05921, 0x765EDB199782DDB0, 
-0xF1C974B116E38927, 0x1982EAE5B4EF5B79, 0x65F820016B243472, 0x1152E86B2013BE, 
-0x7B4425E0E165B1EE, 0x3E23159511DFC7AC, 0x9AE3A16DC1932F4D, 0x10A6E5C24B582DEA, 
-0xF2B799B355091DC7, 0x3F78C92B83CD8F88, 0x8F2B20E835D13959, 0x2380836AA77EDA, 
-0x7A2057A14703F3DB, 0x7EB841E8909AA12D, 0xABC16AD6C21541E5, 0x531FF9D2F193A970, 
-0x984F0593C41740ED, 0x737E8D1546930F1D, 0xDA1D7AD1136D8681, 0x3A703AD2A1C86F, 
-0xA8F71E8DC5C87CA6, 0x8A0B75C788A5B173, 0x292F82F2CEF5E9C5, 0xAF9FA8CF39EBB954, 
-0x54E38F700E2E2316, 0xCEA338CE234AA448, 0x21C0D34D2EEBC13F, 0x30269321068F78, 
-0xD0D9067E92AAA6DC, 0x5A2AD78CE79F4CE4, 0xA91419C80465E323, 0x59AF1023E41B7975, 
-0xDA12F09080A4E917, 0xDE8AB856FB7ABB61, 0x54F25516EDF04B08, 0x35C3962C37F81, 
-0xC566AA51C105A6DB, 0x716D2667F5CFBE64, 0x1B0256BF399E64F9, 0x5C0BF2F0C1D4010E, 
-0xED1D5D43E7F323CE, 0x91EE10DA5AF8FA4A, 0xC1F1C6D2954B2D70, 0x36227CE8A03E25, 
-0x3E41C47D71A0CB95, 0x63EFA0409CCAD891, 0xC9633CEC47CDCFD1, 0x8F5025846A4FB6D, 
-0x3C5ADD28872C9559, 0xB04669BA4EAF552F, 0xCAB60C2F8B659181, 0x1855CB97FBE8BE, 
-0xF55C42816868B4BE, 0x70947EBD506A3A80, 0xC1BFE31E437A6313, 0x357FD845DB1D5F2B, 
-0x15A6D3F4FFA495, 0x957FA42A5D93E4EB, 0xAE64BA9C98483441, 0x36EB627AAB6BE9, 
-0xFBFA5EED78922DBD, 0xE4062C3E7ED6BA8C, 0x98EAE4AF2A3B51A6, 0xB20F7729E6727448, 
-0xEA7EEA4D44346106, 0x557AD14A4AC6681D, 0x27182D8405EE16D1, 0x3080E22A3FF98B, 
-0x72214248A6DAB585, 0x9F797D74199701CB, 0x1C31A37A57CB7498, 0x8A61C02CBF5BD727, 
-0xEFA1AE900C37838D, 0x52FF51A0199DFF25, 0xA663FD52FC64509A, 0x137C39208818DE, 
-0xA5E47425C43875AB, 0x367AE5A5B4ACEAFF, 0xDC9BE6CFE56DC639, 0x25564700ADC88CE, 
-0x39F9AB9C1465D621, 0xDD53A59971F2A98D, 0xCA6B6687C302D02C, 0x184E471AC1AD8A, 
-0x5080E9F335C9C349, 0xC31F8946838556FE, 0x15AAC611141872BB, 0xCC777D2B6EF2C3D4, 
-0x2F1DB4931CDBF4EF, 0xF0B86316DEFEA031, 0xEC02242AEB2E9919, 0x1DBB2DBBD7125D, 
-0x4FE94FA6382DCFAC, 0x13C589708DD36A27, 0xE813F2A366BE2D69, 0x291E0773309AF183, 
-0xD618AE821AEB3862, 0x3D486647C55BC76E, 0x2AA8B812A5B39663, 0x1DD11F98BB5296, 
-0xA1B9B4EE408DD655, 0x55106A3B8451038F, 0x6950CCF46BEB659B, 0x56EABDE59AB81A56, 
-0x699553E782F737F6, 0xA7BCAA68AD6C5FFF, 0xA0617BAD903DA4FB, 0x3BC41E6701037F, 
-0x68F63A78C3D44274, 0x993284AC9E1427B3, 0x7D72B13A9C645AE2, 0x109E78B179399397, 
-0xBCD7E46E431D3343, 0xCC770C03259CF721, 0x7EAB1B9BE4167F09, 0x2780FF602096F6, 
-0xECECF7FBF906FAB7, 0x7D490FBF161D8950, 0x375B5B8B11EA5488, 0xCB885FB4FD1499D9, 
-0xCA115742298451EF, 0x9A1C03A5E890AD6B, 0x2E426AC7C10ECA32, 0x26122FD0E542FF, 
-0xC5528511CF1043C8, 0x7C3746CE7D544EAE, 0x70B146FCCE54AA71, 0x214614815BC52566, 
-0x4D773BD191D08901, 0x798A6CD8B2892B63, 0x39FCAF890C393A08, 0x23BAB1EB6126D0, 
-0xBAE0B21E5930013B, 0x605066568E6FA5A1, 0x8469D8F671E02C37, 0x6C00B629DA5D14E1, 
-0x121D49557AB50F2E, 0x74C63D5BD659E70, 0x809DE545466C4216, 0x3AB4DC214F2C77, 
-0x2E5C4B458C9471B0, 0x7C8D7F769EA22D79, 0xB073990814871EA4, 0x2CC4D377BAF56728, 
-0xD7F2FC2313AAB170, 0x6676F579D4B4AFFE, 0x7B3EB570A60EBCF8, 0x17C499C301CA5C, 
-0x32BBF391284D1387, 0x11CB90413E07F3EA, 0xC21B66E54E952078, 0xD084AF3081B48712, 
-0xB2FD962B9A3BAC7B, 0x7E3339109AABE029, 0x958E349B04CBFD3F, 0x1C3D80688BF593, 
-0x9DC9D1898D632084, 0xB94EDA89E453B432, 0x3D05991A0C7C82AA, 0x38835E6436D8897C, 
-0x13CA7DBA6DE49277, 0x7A4870BA96143C96, 0x6E4B4FE4F4D6FB29, 0x26CB0D639F138E, 
-0x58D76182CB798667, 0x1A718FAAAFA1EC48, 0x8B2C9CB0FE9EA782, 0x8468309D1321A735, 
-0xAA1C5F2C43F7FDE7, 0x747457CB86A700D2, 0x101DAB2D6CFBBBF3, 0x15EDA9DE58B689, 
-0xE17FEF9C82A1B3ED, 0xD8DFF1004CCFF8D2, 0xAF277BC20656B9B3, 0x4532C862A1362014, 
-0xFA14EDF29427F4E2, 0x45D29E2F7E1F42EE, 0xBABEBBD8F0C24264, 0x32998C9AF4EBBA, 
-0x3307F72272C4DD56, 0xA98E6723BA205571, 0x2CEA98995423E32A, 0x6C679224D3862A5D, 
-0x7EC63C5EB2BF5A4, 0xAC91F55B51DBA4FD, 0x6FAF3D410A2779F9, 0x237041DCFFA004, 
-0xC1E19C24054A3B5B, 0x72C562504417BB7A, 0xC80B2BFE3B3AD768, 0x829F80FB831D3778, 
-0xAA4D295AF19CFB5A, 0x77D36876E3F6FC5F, 0xFF9F3F807C14563, 0x2C8328B10AAAA2, 
-0xD73106441814A204, 0x6A3FEF11E3F31E3, 0x98264948E8E9A3C2, 0x7E64864827F6F6A3, 
-0x22E85B97BFC74387, 0xBE0904CA8477887B, 0xF6D2075B14218FCC, 0x1D0B26030F4758, 
-0x39382851B620CB00, 0xC42E230577A47A90, 0xA808371D97CEB451, 0x710E60D86FC992CB, 
-0x3C9DE054A0925083, 0xD6BC67645C96B9BF, 0x9E24CA585F0D8DD9, 0x3C1104F1AE69D5, 
-0x7D42427504C5B602, 0x76B8B1FE6501BE1D, 0xFBFB40F61ECACFD2, 0xA5F269BC79C0BA6C, 
-0x89A7FFB13C0FAD6D, 0x2042BE5B5DEE75DA, 0xFD70AE4A6FE54F3, 0x38ED58D26F7134, 
-0xEFD20A46822BB253, 0x3C43B1693B9F7750, 0xE83CA0444D69C62, 0xF4E7D7C0E3E1F2F4, 
-0x5E3F21971D03417D, 0x8BB3D87787AC4C0C, 0xEAEDE33B4AC23B27, 0x128854BA177D97, 
-0x69B252B125B46ADC, 0xC368060094395F29, 0x7C095BA7BF7F227C, 0x1C1D6EFFF4771575, 
-0x35A4CE373EB659FE, 0x9A037F3F83C893C2, 0xE4D2B17983307DA3, 0x5DB30FFE3F3E7, 
-0xC0D364194B578848, 0x7D125E74E320E7FA, 0x1B8E398C086685B3, 0x901F090B098A5094, 
-0x56383BF1B30A1438, 0x5F276CE9A7CFB9C, 0xBBC25D28BB83680E, 0x1A7CBF2393CD77, 
-0xB04B082EAE0963DD, 0x8E5FB9B3BD80EAA9, 0x926852EBD9C787E6, 0xBDD4C7C33F91D7A2, 
-0x426F225809089970, 0xD24DA464BE5D33FD, 0xA53BE668F1411A16, 0x203F9B429769F3, 
-0xCC9D08DD7D539, 0x1CE994C33B56FDAD, 0x7FED10C284F926A0, 0xF6BA6658A909AD07, 
-0x7C6A4D9DF04AA04C, 0xDD6A6E705E3CB55, 0x454AF3F5D353D5F4, 0xDE52AB6C85A73, 
-0xD309DCB1D29A82C, 0xF026CA05423B46E, 0x3561326AE5D73AE0, 0xF0594D500060A385, 
-0xE28E3F83FFE87EB9, 0x200B84EED73EA037, 0xA09C83BE87FF4785, 0x26F98A8B6235F2, 
-0x1846FE81B2BEEA4F, 0xD1B8A3CACFF2EBEE, 0x27A6C160D1228C3E, 0x1D59AB05EFED9D05, 
-0xFA9A0D1317553C92, 0xBD52008F79942A95, 0x5F825824DBF46E11, 0x816AF69AF4882, 
-0xB7DD61E2A35D2887, 0xE581138540D8D18, 0xAB86A26D1F5C6079, 0x442491CFC515763F, 
-0x3866E5400DFC533E, 0x5256D81E9FDE55C4, 0x1358B277515D77BC, 0x1AC67C6CA3AF51, 
-0x9E0C928EEF7BBD25, 0x23FC3EB7CBA1A61B, 0xC04321230B1E68ED, 0xE788023918888F34, 
-0x6E13C06636962791, 0x56EBA05C762C6203, 0x19A73A4C54E6F337, 0x1DE4728A0C747A, 
-0xD2FA60C227C1873A, 0xBD2B95D031EFB1AE, 0xAF707835D5C08C4A, 0x40FE23154C730B82, 
-0xC86A204DDE8740C0, 0x63585F28313C9427, 0x80CBDEE8D5D1BFE0, 0x14525875054E63, 
-0xAF06BB7CD39BBD2C, 0x7D88EEF1F6B78AA1, 0xA24C96D0B614D6D, 0x401D5517A8336CBE, 
-0x1A669E78C13BF9CB, 0xCD72F60314F38D39, 0x6A2559FB41256BB6, 0x20A718B2A2B313, 
-0xFDABAADB5C1AE354, 0x628011FA0A82EA14, 0x7215A92107917F34, 0x46C32885C7173C0, 
-0x65163EDBCDB0AA7D, 0x59B033E13E63E755, 0xE89DDF455F111075, 0x1E127056432E2B, 
-0x1920D9143382CE7C, 0xA6258F8FB0484E90, 0xC86AF2D906DF64F1, 0xD8EE7752BEAC8913, 
-0xD9FB49F00DFB64B1, 0xEC20D868A6C91787, 0x4359D6027811DA66, 0x308DD398138F35, 
-0x3E82959450FAD176, 0xF776066FDACE77A9, 0x9F342C183834083A, 0x8C2B9A09035CF984, 
-0x7AF6F39B69A40738, 0x4CA640DF2C6093CF, 0x303E887731383D59, 0x2E90CA6F3D25A1, 
-0xD730DD796D26BF10, 0x140F3A2A7B079EB9, 0x9DAF3E3E064603A9, 0xA0BA11BC14E35CBA, 
-0xE56520A70262CD0E, 0x31E9FBFF6C1BEAA4, 0x84EC17F90F1A38C2, 0x25A60EA23C3E56, 
-0xA43B30402E168E2B, 0x41EFDAE13D1BA659, 0x27623B1C51FFB8C8, 0xA6297763E56AC927, 
-0x88E4599C695C7EFE, 0xB0E69858ED63F1E6, 0x7412A8E37F60FB13, 0x6784017637113, 
-0x647420061023CC29, 0x5A53EE21188761B5, 0x71180D88B1A67B30, 0xFED48C2F49B56ECA, 
-0xDE9B0C76BD448667, 0x890391788E5A62FA, 0x550F0166BEFFF210, 0x108D92031C1E8E, 
-0x47E1BF269684DC21, 0xC94E15C6777029E8, 0x3A3659A96AD153A5, 0xE6BBA92DDD632D0B, 
-0x490362AD976B34BB, 0x22E10A300A143BC4, 0x3EC4E6779681D748, 0x31423BDE7E85A8, 
-0x7783DCFC5E41B2EF, 0x9E4637AA609C6C78, 0x29F1818BA2677720, 0xC2193BC24A42E8F7, 
-0xB9953533699FDC77, 0x4E2B836CF8B4DD11, 0x931F4C20047070A3, 0x1907585B6CF65B, 
-0xCC3082679F09FBD0, 0xD7FC0F7C623A9501, 0x17BF2FE728874D60, 0xB77EC2F87FBC403D, 
-0xC45666EF38264B9A, 0x17093F85997A03D3, 0x4190D3F725BC779, 0xCAABA9931BCB, 
-0x6581F544EB828755, 0xF3706D17D4E2EFC, 0x621052396C8AE800, 0x3B6542B3C3156688, 
-0xEC50FBFB0C366C18, 0x3F4A3BB67DA72927, 0x71B2210D15F3765F, 0x219C57E2F9B443, 
-0xB7906280D9067CF8, 0xEEEFFF867BFC23AF, 0x8D504191A6D92DBB, 0x9CD014F0FA8429E0, 
-0x743581CAFC2822AE, 0x8EBA1072B6F29BD4, 0xBB8D9677CA26094C, 0x371549466FA8F1, 
-0x27DACF79E0AC9BDF, 0x625DB3527D7ABE18, 0x3F688B3115F1C677, 0x1B7A316909768A, 
-0x17F7E9554EA2D10E, 0x3D3B2CED18D91546, 0xF340EA8117F105E7, 0x14AE3E09E4032E, 
-0xAA2985DE3431D58D, 0x905218F0A72B371, 0x1D42EA79A76A873, 0xC2E07F8227E8AE79, 
-0x6C47252F73E4ACDA, 0x4B22534F2769C015, 0xCCBEA568592EE7F7, 0x89B5E9ADD6F0, 
-0x7DEFB50D32A2BD28, 0x57204E151AFB28C5, 0x39F9B857FFCE828A, 0x39997C9E58AB9AD8, 
-0x76483010A3DF9E7C, 0x65D3F9428196EE4B, 0xDD128886E0239899, 0x12E1E2DB473C3D, 
-0x3431BE64E71E4D67, 0xCF2D9AB6FC402C48, 0x844029D9D19C21B1, 0xACDFAD192EBDB524, 
-0xBF18748CD068B831, 0x35B5A10F02D85F35, 0x9DB5AC1C465942D2, 0x444703D65707A, 
-0x7CBA7709958F7C9B, 0x286A941F72D10930, 0x9FB435B137BB308C, 0xE89A928AA71379EE, 
-0xE143EDCA7B650838, 0x3BD6A6A1838A175D, 0xCEDFEBD499B54391, 0x3E84457126C94, 
-0xC5D1154C50092EE8, 0xFC744D2F2F2BB1D3, 0xFB63F0C4FAA28511, 0xF428D90CD5F739F2, 
-0x2849435E839F96A6, 0x8883134F56FC7376, 0x6AC77AD59D74FBA2, 0xF135A7F94741A, 
-0x283A881D03F15BF9, 0x155B713C950508F2, 0x1167DB27DFB06BD4, 0x26986218E479EB49, 
-0x46B38AF8E6BDCB67, 0xDDF51FC79798E5C1, 0x6D26D5859A8B290E, 0x1F3B7987172835, 
-0x9352AD92F8785D07, 0x6686044C895FADD2, 0x6BE27D95475E0373, 0x8A4800A9CAE388C1, 
-0x79B0D6A1589560A3, 0xAD20313A906625B, 0x8A3F0AE6D690588A, 0x2FD0714BBA8400, 
-0x5218957BA2BF1EAF, 0xAB426E55AB30AF73, 0xE468A22E533FB22B, 0xB40333411D060EDF, 
-0xAF3CA9BE7564F02D, 0xF0ED1B1746F8C93E, 0x58BD03CB9971DF1C, 0xA6CEF8E52D2AD, 
-0x731B957DD61A45D9, 0x458EAC690E2AD0F9, 0x5D3D2EDD8E0481E8, 0x115327CC79F2FB25, 
-0xE32AA6B498431E15, 0x9F09946A6458AF7, 0x8F8EF6BDF5CD5BAF, 0xA0D5F929B8F06, 
-0x4324BB41C08AEB37, 0x669D591A2AF37994, 0xFAA01DB11A21D67B, 0xC0453D74FF27FAAB, 
-0x21311D61D32FFB07, 0x326B533FE149A39B, 0x28E0A6EF4C7FB806, 0x3D8186AB696681, 
-0xD568B869534470D2, 0xC6A219F0CC420EBE, 0xE226E5541F415CE4, 0xD4D8AB3D575B16A1, 
-0xF704594C77C1C27, 0x8362ECF87DF0226C, 0xAED88C1693C116A3, 0x2762EEF490C32F, 
-0x426823B9BC27AAC4, 0x4A21E54A8464F589, 0x136D418C55417385, 0x79D56039061F2FA9, 
-0xB9C780B8D94932C3, 0x582B43D26A774B42, 0xB33C668F676AFBD4, 0x3F4764ECFB97E8, 
-0x3DE78269918E2DC6, 0x2798AD071969FC5C, 0xB89864775722E2EF, 0xC24582603BA42B05, 
-0xC1B54DDAC63E37D9, 0x73942E5E8B344096, 0xAD7EB2FC73F67CC3, 0x1232B406988824, 
-0xDC22B10DBC0DEC60, 0x54E86E768CDD4D96, 0x4C7396EB07ADA2D5, 0x269A86944EF2C544, 
-0x3F4D6BF4B0CFC40, 0x4690F3861A58DF7A, 0xD2B191209791DDFE, 0x1657256EDF3A61, 
-0x84C089D3C270298C, 0xEC27F3E3491FEA35, 0x31B6737F72CFE394, 0xDEF3EA3ABAE42152, 
-0xAE720BB63C73A630, 0x36D4E1533F4627F9, 0x54DAE5549CE52B98, 0x3C8B7978675540, 
-0x68351D45BCDC19D7, 0x3359433C014668C7, 0x99CCB57AD3997023, 0x8075EFF3C6BB1B9F, 
-0x7891821E0EE7D223, 0xB8F55E111AD04FD1, 0x2E17E72B069EC1C0, 0x35C4578197A550, 
-0xF0982D8883D7B70C, 0x8DBDD2B14DFE51C8, 0x9E65888C378F68FD, 0x86FD0621785B46DE, 
-0x39E31084EB5EDD68, 0xBB8C5E992CF66AAB, 0x9FE7D2BD37C31F0A, 0x25A73C9EFEC41F, 
-0xD7298593641078A8, 0xBFE7D9F0A55BBC3, 0xC779CF97EFFCAB0B, 0x5C45122F548BCC41, 
-0x7966264C5245B4D1, 0xEBEB9199D07C9503, 0x7DB42154ADAFC448, 0x33D87179E4FE2C, 
-0x4B1F22946028527E, 0x5DC1AE829267013C, 0x8EF565A2A5C481A2, 0x57600B9D9551D289, 
-0x26773A4A9757F77A, 0x2545F50E35654FDF, 0x3A96E81579BD100B, 0x3B93389BE00742, 
-0x19DFF2C4FA57DD64, 0x4F9F498DB7A8D03B, 0x80DEC86414E2F5F2, 0xDF254B4808869C58, 
-0xE9C0A0576EE22974, 0x3F3958750935B337, 0xFD13B9D89EA5C67, 0x148B882D00B868, 
-0x7CEDD19311F2B21, 0xD878485B994CE6C8, 0x2AC339A0AC18CA64, 0x1C75E5DC42DBFF5C, 
-0xB7DBEF909B904DF, 0xBEE9644AE8FBF92B, 0x636ACB9E2BE60688, 0x3ACA900CF0BA08, 
-0x77FF8053066E1502, 0x10F3A88D44784931, 0x18F635A1D63D8463, 0x3257506DB5E17F0F, 
-0x3390C9CDEBD1E28D, 0x4C6E4F4AB1E1CEC2, 0xE7D6899AC6987DD2, 0x354941D41F56D9, 
-0x239EB158A34DAD38, 0x3D2EDEA4F3C739B6, 0x4EF86C1D926A7802, 0x9447A0F20022BCCB, 
-0x7AA5D9BDDC258D83, 0x28F3FB3902C07E0A, 0x3360A5243C932CD5, 0x2A8B29C60B4E0A, 
-0xADDA7E531DDA30CC, 0x1E7BC38F8556EF00, 0xA099ED84E70A4F9F, 0x42D038DE33E68DA2, 
-0x34B094318F3F1A4C, 0xD487B8412E418C73, 0xEEC714737D95E18A, 0x17921BFB0ED32, 
-0x2F9374856A877BBA, 0x751A52E2C2790A9B, 0x755D6FAEBF964B32, 0xBECE7540A773CB2B, 
-0x2154E1C376563AC7, 0x9A2829C02DD7056C, 0x39116873358F7E52, 0x3925CCBD381BCE, 
-0xE184E5E009FF4F40, 0xA2FA69300A46765E, 0x7FB75C449BC0402E, 0x253BAE299AC46632, 
-0x1635DB9F9F6DBAD, 0xF754CB7CCDB346F4, 0xEC8211524AC187F5, 0x266D901ED70F67, 
-0x4A20CC8BD68356F6, 0xE2CDF854D9857351, 0xDBF7C1958120FC7B, 0x53034B34C6751704, 
-0x9842197F51B1CA58, 0x92680FC58D7EBA60, 0x6442C851367EF3A7, 0x3AFE5B7571BEC6, 
-0xFEC0BE7051AD2159, 0x7DBD7814AE9A66CA, 0x32A39FE108633A9B, 0xD62C2B83C9C76DA2, 
-0x53227DD67BD382A8, 0x19A124523C607310, 0x7C8B5781C30A61CE, 0x2659E32288A68E, 
-0x3E8F4A894E8A960D, 0xC7EAB3F76ABC8A18, 0xCD16A56C2BCDC18E, 0x9551AC47C1D488AE, 
-0xE1FC787CEBE013B3, 0x75F687FD6704B632, 0xA3DD5EE7994D5119, 0x54A65BF3E9A11, 
-0xAA85236241AC465F, 0x388C4C31D7958471, 0x1F586E9796B00037, 0x3853F08140ADF073, 
-0x90E1DCED2671CF87, 0x66C388E10F38296F, 0xD4BF39BAD8C4BCFA, 0x27EB3B02A0552, 
-0x117F19059B6D6603, 0x404918EDA6F53CAD, 0xC3B1764210F9754, 0x2A951282AD0AD7AB, 
-0xC4852F6ED77A65CD, 0x4BE9AE734D6601C5, 0xD5D25294843BE7B4, 0x38D219BA5212E1, 
-0x886996AB9A112B5B, 0x2C78D0E1456DB01E, 0x167E7B3EE37C76B4, 0xB56F50BBC25B1239, 
-0x3A7E925AB5FD8373, 0xBFB9403DFD1BECA4, 0x37F6E14836F023DE, 0x68AD3A58BC850, 
-0xA7DB5DF3A0A08069, 0x7EB9EB484648518D, 0x14D86D941F3E2209, 0x59FADD95AE545654, 
-0xDE7DC9554EA754EF, 0xA50E5ED2F7726442, 0x7D06BB28DA829D3F, 0x2F476D8DDF63EE, 
-0x1D4328EA8E463B2F, 0xED387BFF059B9024, 0xC6B6983A824540B7, 0x5C77A08F8CBBEEBB, 
-0xC648DE5F9EDE0C20, 0x51BECA7B01292347, 0xEBEB85F96CCE5A6F, 0x13DF321C391FF2, 
-0x77E0F48001D66789, 0x67DAB41753E4D84F, 0x726C55593A8A6AAA, 0xDAFB4DD3AEDB578B, 
-0x38687C9600F1F991, 0xEBB422914F78B4E6, 0xB32332E9774F63ED, 0x349AC8F60B6B41, 
-0xF9D1655DE1F7CEB, 0x2B1719C7CB199B80, 0x86337147C666BD10, 0xEDA865573340C402, 
-0xE0C87FC685370813, 0x3361F0DB37B3F481, 0x2932BFA4C9E35169, 0x39EA55F06A9D58, 
-0x75A4E8948343B518, 0xA8541542D2CA922D, 0xEC21B43AED570A08, 0x9E6683DEF8BF8CA8, 
-0xA2ADE92DEC61854E, 0x200FA68A14E5BAC5, 0x612A52626DFB0A40, 0x29CF0D0193DA7F, 
-0xED0F71A007369CE1, 0x668FFEC134480DBA, 0x753D6D782A88BA78, 0x38ED84D608D5A932, 
-0x2AA2E76BF32633E4, 0x3903A36ADFAB59A5, 0x99F234FD109005F6, 0xA9FEC10DB3DB, 
-0x5C5DE39BB5DC4B2E, 0xB63AB16334E6BEA5, 0xBBC6A2F99FC59C4C, 0xD7A0DFCED2A144A4, 
-0x854E3B597FA6846D, 0x5D085162B627FF78, 0x8DCBB97FC3E941DA, 0x1396ED63559FCA, 
-0x4B985E487A0205EB, 0x1D28739998DC1F8F, 0x710B483D06305455, 0xD82121B2F1EA98F5, 
-0xE573E234AD88B70, 0x496460779A83BB6B, 0x1E89692577A69826, 0x3B12CC9A0750F4, 
-0x37947EDC31EF1860, 0x6740C7FE33CD6841, 0x51B8EEB572BEFC1C, 0xDEC267CC958130E7, 
-0x99E613A004953B1F, 0x589480CF7DE76FB8, 0x3AB0EE27FB7C2B38, 0x145D9AFF2714A7, 
-0x1B0999912069E5FF, 0x25C6ECDCD193B575, 0x25C924C1D5B88799, 0x4187DD73F19D7282, 
-0x9DAB8F0A9CADE4E0, 0xEF1ECCF096F997B2, 0xA34271F6560C283D, 0x2F1062990307B6, 
-0x307EBDF38C0F12E5, 0x3799A89304C94287, 0xF640EBEC023B63C0, 0x59D494BCADB516FA, 
-0x49F82D1C87E5B091, 0x2E807D5D171F6407, 0xDFD14F949BA6C118, 0x36C3A97F9A9DF1, 
-0x5C2FE6D667395FC1, 0xB2E02AFA647DD648, 0xBBF4D48038CF7162, 0x509AEAF7A07260F5, 
-0x456F71674BED3559, 0x3224DC7137632544, 0x5003FF935578FF99, 0xF63203DB73ABB, 
-0x34FA9A75CA7652D7, 0x34F9424F8F2E8BDE, 0x71E93A8FDC2490C5, 0x943A87F137BAB8BC, 
-0xD937C0ED52D4630, 0x99119C27A6E3117C, 0x638F1E45BC4EADCC, 0x16F3817DA85310, 
-0xA968F4B154DAA5C5, 0xCAFDFAE735292514, 0xB447F0BB0AE1D702, 0x8E87884F827A7608, 
-0x6EEA49758D51A9F8, 0xC6953FC6ECDF8922, 0x4379767F16A18023, 0x2FC64DB6453E63, 
-0x3B5256C6AC8ED8B8, 0x991C72E5A6C774D8, 0xAA26CBB18064EFFB, 0x66649BB5BC2C343F, 
-0xB30F88D68539942F, 0x9630799B141B938, 0x2D3C0E6ED98D161F, 0x36581DE1ECCCDF, 
-0x734D3D9CEEAB20AF, 0xAD95C4C8E80A7EB4, 0x89183BF37198C10C, 0x8B6DB3B07BB9EA5B, 
-0x65365566CF0268B3, 0xD3BCA911C5C5F199, 0x5E2FE2CC91C408D5, 0x1BC2FBD23EC2F4, 
-0xD431E8F177F5125F, 0x3F4F2AE79F4A8D24, 0xD169F13B6F3AAF5, 0x2E79EE77911CBFBE, 
-0x49EB7D99704E4E6E, 0xFC0E4CBF0342B1EF, 0x91CC3259A138B52D, 0x307FD7A7C585D4, 
-0x1292011A4F9C1ED8, 0xA01C14E0B4A3F35C, 0x5A78799C25406073, 0xE2E1955125177B8E, 
-0xB43CD4A41CDABE74, 0xF738D7CC5B93EB6, 0x3557A4AAEB8D122D, 0x35F943E6E56A54, 
-0x908BB99BAD39CF34, 0x3F7FF7687372BE08, 0x5355B6151C63B096, 0x908B8CA2FD6F040A, 
-0x7B1EF9D829AC3C4D, 0x6457557F7A089E7E, 0xBF486DAE6783F72E, 0x1EA9B3533B073E, 
-0xDB85E3A2D08C244C, 0x3104C3A075E320FC, 0xC1098114FF2918DA, 0xEEE371F097F26ED0, 
-0x331FFF33D4A6BD76, 0x316F0986CF3F2150, 0x83350FD149EA113, 0x356E8D9FD432D7, 
-0x87B4D7A5346090FE, 0xAE760E523D10C41F, 0xBE85B02F41FCC1E5, 0xDB8A8032A88D91C8, 
-0x246B1AD0A387B293, 0x46101DDED3B23072, 0x9EA5A3D57FD730B8, 0x3F9A5FCF7CC873, 
-0xAFA7846A7A7C2FEB, 0x737EB536F3340B23, 0x426A25A2E267C427, 0x71E08C109D2DC8E7, 
-0xE13A8A3822FFC4F8, 0xB5BFCDADD5919D0A, 0xDB0821B34F8901E, 0x3B09FAA2F4DAA, 
-0xF9BE25D26E759627, 0xC022DF1B38C7D305, 0xAF8E510B4CD7E2B2, 0x6F2952C7FBF662D0, 
-0x450E3653D813E400, 0x3D01DE38C78F6160, 0xCD68EF802ABA7C19, 0x23756C2690B1E9, 
-0xEC015B20598D3949, 0x219FB828424697A8, 0xF64982521E7353BA, 0xA17F4726D124E30A, 
-0x721B335373702AA3, 0xCC134076C36DDABC, 0x8666CB7F1C069C6C, 0x1E11618E8FB770, 
-0x291B18E78005586C, 0xC4457E4EACCE410C, 0xAA634B593BF7D7DA, 0x3B564DE164DF11BD, 
-0xA3280F50E8F5473F, 0xD1157A83C81BB173, 0x2294112A430AA68A, 0x1B8704A90FE9E5, 
-0xF35ECDED4E7F3276, 0x8B10B7F4A9543332, 0xE608366934CF9F30, 0x432B8C52FB7683D8, 
-0x39A07B1A743B689B, 0x33D32CDB4382158F, 0xABC25C233708D34, 0x211A5EE1867669, 
-0x56B7E5F1CADF3313, 0x47B6351D7109C43D, 0xDD5666E5339FC4F0, 0xDA8946080066E593, 
-0x36994943E044F666, 0x6A2B8F4464FB3E3B, 0x6775ECBA97140B33, 0x2F0B20C119E257, 
-0x4CBE7B2A035321B7, 0xB31EEDF4016AFC9E, 0xF853E0F9EBD7E953, 0xC88E9F8FE1BE7272, 
-0x7DB096E448017615, 0xD6FBF30304DA0BB7, 0xFEF5D9A874327177, 0x3AC6FA54D7DC62, 
-0x82005D007C9AED13, 0xE0B6EA116A5D23B7, 0xAD65717EA4DE6487, 0x15639FFD0B558EA8, 
-0x76BFC178C5F2BDC9, 0x461944B49557A700, 0xC66079DF0C57F9D2, 0x3B7DE01528082D, 
-0xD5693E97D8B53A88, 0xE4365A9243F7C564, 0xF4FC3F444CC54747, 0xDB2BF03B2AA1BFC2, 
-0x3382B49DE21B8238, 0xB839CE1A807B14E7, 0xD648CB971E2DF0F2, 0x195B1F31C8B985, 
-0x5CF601EF691C8411, 0xFB61B0468185AE7B, 0x9C8370B8A4F911F1, 0xC7FEB02F1F842E0E, 
-0xB516DCD90887BFE9, 0x8B713061E5E0E4BD, 0x2C17AD49DE6AD232, 0xFE60868C75312, 
-0x4F2A7CF74F28C8DF, 0x52A61BF256662287, 0x46D63444B75DAD47, 0x99F19B8F1ED887CC, 
-0x5BF09FA62D79BE44, 0x7C053959512E0DEA, 0x3980E77E98AEDAEE, 0x1AB407D73E50A0, 
-0xAABA9D1340B05A22, 0xFA67356ACC404A0D, 0x5C87FC45FE5BC1F1, 0xC24F06241A283FD7, 
-0x5873FF137240B6B7, 0x4F2202DAC0407A09, 0x7622F95D076787DF, 0x3E32D3538BA52D, 
-0x71CF043B02F4029E, 0xF2E0C6DCDE4B5E4B, 0x9B20D0ABD80ADB52, 0xA342518DA9C937DA, 
-0x506C510850829AE7, 0x47C6CD2CCD05EF9D, 0x205D8CA94920A22B, 0x381E7404CE0CBC, 
-0xECE83AD9352C2823, 0x3860D22F6A9F1B74, 0xF6F983EE0F555ABB, 0xE54974EA7B8F545, 
-0xAF6EF5DD3F2DA352, 0x3175C4C42E185DD, 0xFE146E5AABAA6307, 0x2E82CAB178E922, 
-0xAE98986FBA003312, 0x99AC6AC39159C882, 0xBF9ECFC393993307, 0x65762C6F29AC779D, 
-0x387A8CC25D4529CC, 0x65C1CE3A619696B6, 0x7E64DCB7C333CEED, 0x13E4983CB2C9A4, 
-0x4DED04C4720EE33, 0x5A64CEAFE858F85A, 0x8AF32312E11774D7, 0x274CFA6AA509D361, 
-0xF7A0488C63B5A4CC, 0xC5584635A10FC961, 0xB0398F65333BC999, 0x291F2ABF0E10EF, 
-0xD92E86099675CDC8, 0x803A569E83862284, 0x5308E8DA552D68FF, 0xC796FFF8CA7256D6, 
-0x1AEA521AC7316631, 0x4FF75D83A7D6C6F9, 0x4F81F1D8F31119AD, 0x1770DB9DF8F60, 
-0xA1076A18D981D2A, 0x8F06FCF5D6DE4C70, 0xCEC9733838097057, 0x50FB065EA1CD9094, 
-0x93161ACF5A59E2A9, 0x845983D6512FFF79, 0xCD0E1C06541D52E5, 0x42C7AAAA0BB1F, 
-0xE285AA7217ED5CFB, 0x13F7367D4AE539C0, 0xFB9C59AAF663AA40, 0xABD3304310774662, 
-0xE4214D6AD98968E8, 0x5CE1BC2F5FBBEB13, 0xEA77DEFD87B7B3ED, 0x2AC905FEE0F8AC, 
-0x9FA860ADBC72C2D2, 0x989C4D2948CD6DDE, 0xB18EE90BE1AD4BB5, 0xD685F9B04E49181D, 
-0xF38D785033731986, 0xDA8FAB3E7AD81DC9, 0xC327E652862489A5, 0x22ADE9F9C0FA37, 
-0x7A813D7910A7AE4D, 0xCD7698379F20810A, 0xC2BD0C335C47DA8C, 0xEDBCDEB6E1651F37, 
-0x20C9C7D4D4E5B3B3, 0x6694BF77D77167F3, 0x9A99ADC1AFEB8EF8, 0x1CB2E021CCF274, 
-0x4FE2DCF4FFDF1F06, 0x9A604B6CFE16FB30, 0xEC3E031F268C7972, 0x10E9199993B50D99, 
-0xB089A13E702AE83A, 0x8385530BDCA34E51, 0xD870E484F8FC7945, 0x3B2EA55231BB81, 
-0x449D115DA5EABF56, 0xAFC072E8F24A38EE, 0x2ECE330359640FE7, 0xF6E985D905956893, 
-0x58182C9B435CB992, 0xAC2A8C54344AC281, 0xA192F7AC0DB51A0, 0x1B294C2F036521, 
-0x30F634EBB1F06E94, 0xB17576DAA833A32F, 0xA256DA0896115659, 0x5FA67941E88E3639, 
-0x1350EB959F2EF3B5, 0x788BE520132861DB, 0xBE9D413D9492119E, 0x2B2D7430BE22E7, 
-0x1E07E360D490BC33, 0xCEE2D395831BEC36, 0xB0A948F75E8A1614, 0xC1D62A8E9571A44A, 
-0x945A1DD9B4339624, 0xD48311E2151A0EA3, 0xC77D6FB21B8CB73E, 0x3054E58242A23A, 
-0x2EADFD02C8B1622D, 0x17BC72FB655AB2F4, 0xB2D0DF3CDE1EC71C, 0x2F4239B2A43FFC20, 
-0x390D4F85A306641, 0x5F003E2968FEE3A1, 0xBF137C501F23C0C4, 0x264CF89AD79961, 
-0x1BF08B36A5181E07, 0x6FEE26D63FD6D9F3, 0xF4600638B8A000AD, 0x95A71A77F83EF707, 
-0x66C290996DBEC194, 0x179D3ACC9A54B8D7, 0xDB9334DF62BF7313, 0x142B500FC6EA78, 
-0x8DC81B1791577D69, 0xDBE49752CD507631, 0xCE2795AAF59E2BB7, 0xB38CC1B3220C2762, 
-0x2BDBF7C667CFD33D, 0x2F8658F790565B53, 0x172AE38594D0A033, 0x25DAD03A1C2361, 
-0x4BAFD338530545F5, 0x882026B53661251D, 0xA8861C4BEF1BEE28, 0x8406C5861729CD70, 
-0x28D90BC89980F9F, 0xD1F68357340D9715, 0x61851BF560009B7B, 0x14447D3F8D7749, 
-0x41FBF1E190B4C6B8, 0x86BC4E8C911F7164, 0x683816115099D136, 0x952357ADE621076, 
-0x9A4ACDD90EE870B3, 0x3F1A3B5C44294382, 0x36E78468EB62B975, 0x35D80D75E99C3B, 
-0xA8FE70D5806CC71F, 0x10E16A8D72145F33, 0xD612B61A2EFAB7AF, 0x3CFF7BD03534952E, 
-0xC28FD239BAE71B72, 0x34CFE87FE7424E58, 0xF669A119840A237F, 0x35B3566567FA80, 
-0xA8D5FF10491C8F8F, 0xCBC997451C543D13, 0x3E59F3855CF7E03D, 0x85B0BE9B87591599, 
-0xCCBCA3F11DD449CE, 0xAAD1CAD2C2C7C11B, 0xAB5BC2FE400F8C07, 0x4FF9C26E7AB5A, 
-0x4A613CC203EE5C02, 0xC81E767D21690F5D, 0xF40BD4B57DA764A9, 0xC8DEF84F2C7F5874, 
-0x35CB6541E748483D, 0x6E58BBE9A3E1440, 0xFDA85604AAB25CEF, 0x309686C84AAC8, 
-0xFCAA9EDB82A6065F, 0x9BF1A72FD4BA7F2C, 0xDE57A3A05DA9E64C, 0x1A20E92C1DED19A5, 
-0x6DCADAEC9FA7F808, 0x5CA8E407A2A37175, 0x2A95C7A08B7DC3E0, 0x290DEE95F437F0, 
-0x7EF9A695A17391F2, 0xE2471E611CF41741, 0xB1DBCC0CE323B56F, 0xD200C280E6F8A664, 
-0xA32C246ACAFAD250, 0x1DA20FBBADCF29A8, 0x41580A644CE4FC5A, 0x39BA2590AC90CA, 
-0xBEC, 0x0, 0x0, 0x7000000000000000, 0x1858F371D28A907D, 0xD89DE1DFB7FD9CC9, 
-0x4022A097759F1EF6, 0x348C1710ACEDDC, 0xC7670A44560F938B, 0xAB8547B43C3479D3, 
-0x3D569F5772456BB6, 0x17B5B53C0FA23B31, 0x38210235AF583ADE, 0x49A527DDB6CFEFC7, 
-0x76288D14F23F037, 0x1620C022598276, 0xEE37B8F9A6021865, 0x8C5C41CEA26276CE, 
-0xCE9D8BF310132F9F, 0x876B5274C3DE6C59, 0x59A9CD65B71D224D, 0x5246877E7BEF62F3, 
-0x109010B83B8E355E, 0x34CD34FD408568, 
-0x7F3, 0x0, 0x0, 0xBC00000000000000, 0xB48DD9032BABBDC8, 0x87354452517EE94B, 
-0xB55528D05AECDDB4, 0xD90684A9D9488, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xC7670A44560F938B, 0xAB8547B43C3479D3, 0x3D569F5772456BB6, 0x17B5B53C0FA23B31, 
-0x38210235AF583ADE, 0x49A527DDB6CFEFC7, 0x76288D14F23F037, 0x1620C022598276
-};
-
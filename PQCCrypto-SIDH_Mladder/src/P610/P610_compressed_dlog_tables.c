@@ -1,51 +0,0 @@
-/********************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: precomputed tables for Pohlig-Hellman when using compression
-*********************************************************************************************/ 
-
-// This is for \ell=2 case. Two different cases must be handled: w divides e, and not.
-#if defined(COMPRESSED_TABLES)
-	#ifdef ELL2_TORUS
-		#if (W_2 == 5)
-
-			// Texp table for ell=2, W2=5, W2_1=4
-			const uint64_t ph2_Texp[((1<<(W_2_1-2))-1)*NWORDS64_FIELD] = {
-			0x7CC6FD0F23BF17C5,0xBB5A276A80E821A9,0x8C1EA38041BB2DAD,0xE19A51D63C472E78,0x1369BBDB4CDEEAB3,0x719861EA8A96CC98,0x81825E2BAB696968,0x308363B7C8F9C427,0x59A3A18CA5F6EE9B,0xCD9B8327,0xD81CE6D57A477950,0x57FF8F7BA47F9110,0x32D2553A99013C7F,0x40839770DB1AC75A,0x73A489B85D52F561,0xC004A1C32FDEAD4F,0x73E512333F748A2C,0x87E75B5DE337BA0A,0x6CFC38C78BDC2DD5,0x11F3F88DC,0x5BFF42581E1F5B97,0x9B58196C4113C0A7,0xEECE2BEBDF44A43A,0xBCF7FCC8691325ED,0x43CCF6052225F97A,0xC7CD308ECDA5D4F,0x89BB805328F9988B,0x1E21AB2A2AB28012,0xA76746FC2C6FCB76,0x93BD93A5
-			};
-
-
-			// Log table for ell=2, W2_1=4
-			const int ph2_Log[(1<<(W_2_1))-1] = {
-			8, -4, 4, -2, 6, -6, 2, 7, -1, 3, -5, 5, -3, 1, -7,
-			};
-
-
-			// G table for ell=2, W2=W2_1+W2_2=5
-			const uint64_t ph2_G[(1<<(W_2-2))*NWORDS64_FIELD] = {
-			0xFFFFFFFF98F33719,0xFFFFFFFFFFFFFFFF,0xFFFFFFFFFFFFFFFF,0xFFFFFFFFFFFFFFFF,0xD3CDFFFFFFFFFFFF,0x63DE8B2B81E935EE,0x909DA70B616C258F,0xDF9F90E440595348,0x6E270E53CBBB294E,0x17361BE04,0x833902F075341F54,0x44A5D8957F17DE56,0x73E15C7FBE44D252,0x1E65AE29C3B8D187,0xC0644424B321154C,0xF2462940F7526956,0xF1B48DFB602BC26,0xAF1C2D2C775F8F21,0x14836CC725C43AB3,0xA5C63ADD,0x5B55E9C5EF7B98A4,0x9CA5681123976F67,0xA6B3B1BA57460ED1,0x5EE9459A9ED398E1,0x3408CDDD10740AAD,0xB24ACB04273116A6,0x83005B12F5774653,0x3703888A5A97492B,0x817FA58EB1A06889,0x1C505C3B9,0xD8C63F66DAD1AA76,0x56B240D6C1FBE250,0x7AECCF6C20FFD1E8,0x9E924E9EA55A5466,0xBD02B1E06F04E42E,0x307B72364EFFAFA7,0xF3C645313F2DD7,0x7BEEECCC23417258,0xEDA1E61A4C3A0AD3,0x58C42D68,0x914D332D80767FB7,0x9F6AC0CD18AD0AE2,0x2F13B22810507324,0xF1BB19C2CFF1C13F,0xCEC57CD683D3FC58,0x5E21948ED601A763,0x4BD98A2CC696A09D,0x9B108593DCC62CAD,0x98E797D368C1A3AF,0xA77448F1,0x369169F04B220444,0xC666B3A5B643A0EA,0xC467402D8B5FC13A,0x2D9BC99B742C7357,0x978566A023208EF,0x89D1247010987E09,0xEDB26F18005023E,0x7205350CE0351361,0x14740B259C11D0D1,0x26E84B9CF,0xCC519C0FDDE8503A,0x980A336CBBDD85AF,0xB468855E43DD793C,0x85BD25E68A7AD0C3,0x50B08441D22151D0,0x775C79D845E5A346,0xC235638F6402F35B,0xF510FC7D29CC058F,0x3AA9204FFE0EB6D5,0x34CEF550,0x6245747874889EB,0x3B63C30DE1975087,0xC133701C03FE8F60,0x77489EDC227CB16D,0x7AF01E267BDD7380,0x7155B19CF8DF7281,0x5E3D05810C0938B2,0xD77747702BB71CF3,0xFCFD3F1ACC61654D,0x290FA7D1
-			};
-			
-
-			// Torus tables for W_2 = 5
-			const uint64_t ph2_CT[DLEN_2*(ELL2_W >> 1)*NWORDS64_FIELD] = {
-			0x39A044D1BBCA7DF6,0xFF33416DCA2EE68D,0xF4549156F20600FC,0x6AF40C48EBB36D3F,0x5B871051CF935B65,0x782A79BB90B7A339,0x9B67D9082F63D495,0xE3724D564F064083,0x4A392E0621C5C765,0x1D90D4D89,0xFBBDEFC8E3393F37,0x6DAA1BB29A1CC55A,0x57752A7C5B25F6B1,0xFF3997D436E81F52,0xDD00EF13CF28FE15,0xF0A135E49BE61533,0xF5C8C6C36DF3EE84,0xFE2E0494EA81BCBF,0xD83C470841959177,0x10D06715C,0x1EC538D73D8DD53B,0xC9E8B7A0C37E24AF,0x8A6ED38BCD27A629,0x16B00F255C190F00,0xD98EF7186807F9D2,0xEEC1D6AFD588E42D,0x807637F85CD0D649,0xB6E0F30BB1C53D3F,0x6BBC69D40941D4A2,0x14E55201C,0x4B4F401220104F9,0x1D883770B26FA2C6,0xE7B621ED3C7F77FF,0x96FCC85B7CCE6093,0xAC65BC3551849D66,0xEDD276BD71B81E86,0x2E50A2C45FDE1CFC,0xAE858CFCC9B2FABB,0x6DB0B7C65B692A84,0x2034E200A,0x1FF30394570ABBC8,0xC5F7085F2F9A934A,0x34C0ACA6679A48AB,0xB12458AAF94099E5,0x4D3D39C87EB67B3C,0x1A3311B64AD20E70,0xD8C1A7E78B026D0C,0xC262C72D034C74FF,0x6AECCDA87FC80EBE,0x11F178B41,0x2B3FCEE70A75E7B2,0x148163BCA000B3CF,0x95DBDB01818246FC,0xA26BED1BC44CDC11,0x299E311C42322911,0x611D9D167B3DA99E,0x29834952C8D88837,0x42AB0C0799C9EEC1,0xDDC690189F0E72C2,0x1C07B7996,0x2C41F8F2021B24CA,0x2608B83095189C25,0x64F9DC16837A9824,0x6EF7A08BB30E24F0,0xC2B266807C4E3DD7,0xEA29B3F0923BC537,0x70CDCE8B4B33B7A6,0xF04EB2BC55B3CD9C,0x3793109FCCF60BE2,0x1822C4C3,0xC1C74DFFF8B24BF,0x24D4C71D0AA9D58B,0x70DDF071F0CABBF6,0xEE608CED8178E1F2,0x3383C84F3CCB91A1,0x49B8EF33A34566DD,0x20F5FA6B132E9EF1,0xEA42579716D7F087,0xAA7EC5487A1E3AA5,0x178FD5BA9,0x34A506777A35F9FF,0x4E3659133F427786,0xC0DB8EDA58821076,0x43FBFC5149CB9866,0x215AFE03941DC196,0x6E979E4FF15F0755,0xDB76C097BFACC2B3,0x114FB4A373D7FC2F,0x910547FC9BFECDF,0x745F5987,0xEDD560B846F3631D,0xF9F9650BA5D5DF0C,0xA648F6BDA2CE3A9,0xAD1A5794B924001,0x4FFA6E87F060F1EE,0x1D43D9473E0A8BE6,0xF4D66FDFDFC907C2,0x6517372AFF7B9695,0x5BC308BF08DE3612,0xCE2D8610,0x4A0DFDE216185EFA,0x575E2B34C16EF364,0xC3F2ADC29B09ABC3,0x6213DFC8A520DB2E,0x63074E6E38D8BC2,0xE50186EB20008EC8,0xBBCDC7AABB25CC96,0x4255CBF173399825,0x65540F58A8919C0B,0x1FD3D2192,0xA7B37F1F5ED6BCD4,0x4FF813A7F769B31D,0xCCA56B853447F1B5,0x7AC88C3130B39477,0xE1BF081254447FEE,0xB588C821A8D52363,0xB65AA7813212D3BD,0x20AF2ABFF018262A,0xC1C5B38EC3597A34,0xC3C5BADB,0xBDBDB4BADC986BE2,0x882D93D062E2ADDA,0x3115001CE0590833,0x6B43BD8B79A6B188,0x63FCC1109CB46703,0xB7D56C95FC0A0779,0x58850B87FB9363B3,0x9CC0D4C4A959EBA5,0x7D0C2182836926AF,0x15BEACF95,0x48DF9B8FDFF509C4,0xDD9108AAB42518FE,0xA39A6CCC649E93FC,0x93D93E012E62A570,0x5FD95B45CBD2E478,0x651AB1DD45467015,0x3CA73A0C9C663909,0xE781827131F7E337,0x141636A90B9D53A2,0x56375935,0x5591D8B4CB7DC862,0xD0CC81B070A4D0D2,0x5C00343FD150B9CD,0x2E6154A0B8F2FEA,0x5E877F62B20AACF5,0xEC7CA41641C2CDDA,0xC54B3870B2CB59C3,0xB6AA03299481F910,0x719EB25D3F34388F,0x14C1A875D,0x890954545857B669,0x7969B9E8BF8C35F3,0xA5F9AB956962153B,0x7BF208AACE441E8B,0xE770EAA30B4162FC,0x680FE203893DA307,0xF5CD65264BBC7994,0xADCE60AC44F4E52B,0xA8CF9924E7E52F6A,0x24F18DDB0,0xE3F5219B2B41B08,0xA573E5BBF5F9F432,0xFDA65C70A1085060,0xB607BB1DAD1F4C68,0x13DAF41829845A95,0x4BE030BD68671A4A,0xAF1066A6C08385A0,0x4E7988B80261222D,0x3982514A864BF13B,0xDF2B9AB5,0x717F2E1BB154CDEE,0xEDA39DF513407284,0x71A56279E791B172,0xF66B4804B9E357D8,0xDEB74EA060FFFCEC,0x6F03CCCBC7BEF493,0x9518EFB0CC86C609,0x43A0A731DAC22AB2,0x5D538A1F6421F50A,0xA3B835BD,0x433742FD816B8FE1,0x4A9D1BB22696176F,0x52DEC9970DADA4B9,0xE766CB01EE3CB067,0x70F1D6911A50D942,0x61D4D3712825BB96,0x2F0A27CCC23177E4,0x975D2E6CAB04E3AD,0x2F10B6DE9BD20F79,0x1F4A9AB59,0x1157F40267F8CC50,0x2C4DD631C7FABD0E,0x6D6C2F5E66AB6BBC,0x969A433B9B3B17CA,0x276805A0C3828DE6,0x9E5313C16F784C26,0x8CA416CBE6C3D732,0x7581D9C419B72847,0xA6DF551A948E2281,0xE8AC0F7D,0xFB4733AC044B079A,0x1C56180E0ADBF2E1,0xC2E85BFBA15839DE,0x53B630DCA9BAA42A,0xC879562CF90DBD61,0x7A8CADE801B7D277,0xBFC37EAC6FBFAF51,0xF2304387B03272E8,0xDA5F2E6FF11937BB,0x16739B28B,0xC6FB5574577D2381,0x3914B6E45CEC1ADC,0x8BA905FDECC0D807,0x4BA1871369DB5731,0x9EE5B8DD63C4E9A8,0x8C2617E1AADE3C0E,0xC31C8901A4AE84F8,0x271C3E4CFB026547,0x908B108E60CA7C21,0x27617A874,0x22A908FE72E92C56,0x76C1F5D40780EA68,0xC2B2B33E0E7C99D3,0xB2DF58B35549B7C7,0x3D77C240A6787398,0x27E974E007755A21,0x517470B4C4EFC272,0x2AD8D538CC3120C0,0x79962AF4EC3AC1C0,0x1FF94149C,0x89A7D3AB41A1B734,0x1B2824A65B4CF096,0x6E765532BB7DBCDB,0x552EECD3971BDF09,0x66755DC63369A1A7,0x87D284302C6FE960,0x10D645A0F8031438,0xB56EC3A297A544A,0xE56CC44F94366F2F,0xB1891478,0x183B113E189CE6A4,0xA49EAB6C816511DC,0xA8523DC5ED0FE073,0xD5E96FED0C55F7B9,0xD6304B1BCE2F2981,0xBDA11DAA005BA3,0x2F0876417265F385,0x31EFECFF8C0F632E,0xF7F5FE74D72CFB41,0x131D8B4C7,0xF26B19841B31CDB1,0xA9F68BF1EBFD5AC0,0x6F26B77ACAD091CD,0x52F5A4B4F5178D5B,0x17C9DA9FC26FB9C5,0x681651D0CB905D4E,0x8304A42C4CCC3AC0,0xD3B7F4FA979B128E,0xE872ACE7517483FF,0x17CBB47C6,0xC652FCF09D98FB1C,0x6964DF9A299EFEE1,0x21B941BEA47D52CF,0xD76D7C333F5098C8,0xDD3A33B1666F7F89,0xF1350D9CF8D96556,0xBFD22ED8781007DB,0x454BD9400C16BEEB,0xA93B2124D04A0866,0x18F188D46,0xE2687B8E5C532314,0x93809788BE200B2,0xF6BA7AD7D39F8173,0x3A4EDD8F5AB86045,0xF622C924A1DC2451,0x53872175700078BA,0x8D72B7647EE6C747,0x4BCB005DF8DE592D,0xEDD067D5D6B7B76A,0x6ECEF047,0x9E72A6BADBD23979,0xF8A7FD9F6536BE55,0x157721173B4BFAF4,0x2196DC084AA47D0A,0x1E0AB27087BD275B,0xB4C527D8E0A7A025,0x62F16E0A2A634CF5,0xFA42E8D34BD9D2F2,0x7C9DE07C15BF546B,0x161C6FA67,0xA7CDADDA72C57B9,0xFBCCDD6EAF6E7F48,0xE59C3C2D6A33A934,0x28E1389BA5578DD,0x5DBE312A19756D62,0x8F027239DA3B40AF,0x6C88CC5A44B35022,0x497B2D1FDEDA028,0x16B9922B08B3B8F,0xE490491D,0x5FCCE9C139981009,0xB431281D09A8D96D,0x8AB950DC2C5D217,0x6BAEB67A366ECC83,0xACE919FFE77EFB1D,0x23DC3BED630074BA,0x670838FCC8DB31A6,0xEE1778ACD4ADC12,0x49530F74DAE24B7,0x761AB95B,0xA34076B0F11AE604,0x1ADF1595AAD8CD71,0xBD3780AB8A171F7C,0x778C18B2E1F1907F,0xBA182A7782E70F4F,0xF74E9A76070404FF,0xAB0170B156D917FF,0xF19E028BAA0E64E6,0xF65D8E4555D49FAC,0x34BA757,0x2E56AF3C8C236006,0xE97F10ED96C20D97,0x7039D06BA4150189,0x26BF79E062C03560,0xECFD400432D4A4A6,0x72E86C1DE3FFDE3D,0x84F35CEF3468F091,0x65954D28E1D2EF37,0x152CC5ADDD003FA6,0x10B075BCE,0xE76C9FD660EC306A,0x13BDFB03713728FA,0x56457A7F3F2FDAC2,0xCB4BB7E774BE19F0,0xE64BF0BB3DA03F17,0xD3505460F7836729,0x4E44CD09EDFC2962,0xCBE5DB28D271EF2C,0x5176157ECF18B629,0x15B2F92AA,0x3DCE099B420489E7,0xAC62F49CC36AA7B2,0x94EFE1647630D671,0x5AED35D742A60B71,0xE08381836466AD45,0x136C4D0C9B22C089,0x88A0F23ADBD58B8B,0xA2B91D70623365E1,0x158665BE8302BF18,0x19709D89F,0x7202CC6B87D26007,0x3AC6BFE9863E0DC3,0x9846CB802E5B5DCE,0x7C5E105879EE1251,0xAC83B797F4628C37,0x52BBE60BC20454A3,0x93198E47B593504B,0x4B4CFF2E3A6887C3,0xE28D70E3D945DEBE,0x1DA2730D0,0x1841366BD9A58148,0x968774113C7BAE41,0xDF00BD4F8F04F496,0x891E67BE6736E29B,0x93EB665E5FCA29B2,0xF3BD66A3D7A066D4,0x5F8E0B39EC42CCDF,0xABC01B7477BD0C6B,0x184E402D11C17EF2,0x167287333,0xE620156EAB914E52,0xEC6BD17CC931411,0xB1DCEFA2FBBE21F5,0xA795D6A2BE16A44,0xB3F702ECFEDA8B08,0x78127603BF0E187,0xA45546319701FFCB,0xC01BD2A80F743EFE,0xE48BBB7113FA43C2,0xD716297B,0xB98141136FE8613,0xF1CD785485E44A0C,0x3DC0DB90D63F4BFA,0x17858C857F53C391,0xCB799EA22D8CD8D4,0x9F53C4A7976DFC93,0x7C162A7F9B8C2E83,0xF16AD6A5CD4FA2EB,0xE50F5E094BB25CD0,0x22E63F8CF,0xAF76C5F77A4BB57F,0x689B81697FFCC19A,0x6A63AADFEE31713E,0x9B54BC464A2DD86D,0xF2C071AA4D80BB7B,0xE40AFD37E988E827,0x8A5EAA2F60ABF271,0x5FBA581E34E2995D,0x169811B78E77D15E,0x1DB1B6BE6,0x46B780268A9CFE4F,0xE803EB75CCF97B99,0x292F85CC89B5B108,0x2EE1198E8549160E,0x1FFC6FA546FC95A5,0x7C1FB78337E08D73,0xBBEB059626A566A9,0xF1853419E4B1CAAB,0xE9CA01E86ED1B3D9,0x14806ED57,0xDF1FC22AAC1C8FEB,0xBBB8D3A06916DC06,0xFD032B250F808982,0x3C22CD470330EC13,0xC57B47C3EFBE5B7E,0x945BFA70902739A7,0xB5B384973C444E52,0xB42C73019E983E48,0x8DBB5B7513DAEBC9,0x1671582C0,0x4FD8FD68B2A5EA75,0x2F0A638676FB21F1,0xB6EA855416255DC5,0x1ECA90CF6FFF9E2C,0xE63F856A19A80F0A,0xAB3534E03074E9B3,0xAB4E3CA7A9192673,0x734B6BD778A0F9AC,0xDEC1F2F1623C6FDE,0x243932587,0xA860BD0FDD9CE700,0x8E70C918B1B326DA,0x2126D542EF4BBE0E,0xE00066B39B21DE0C,0xE1410807B3737728,0xF40473DC27B41B90,0x9661EF477464FB33,0x9403453D2C143131,0x665027A7149784F0,0x1F582910C,0xCF669AA299C81F6D,0xCB9F7569836C37CE,0xBC23D1F4BE6DE791,0xC1B765B6DBABBA4D,0x13248B2747A182C2,0x1E1C0564B5951529,0x116541C8BCB41CB0,0xDC66DB84E4F9C52D,0x8439EBC08236064E,0x11774278C,0x78D7F9AD38618599,0x2B6C9C26A41FAD28,0x956943D591742C5C,0x14D60713C0686452,0x97C95128CB4D138,0x71CEF62B7990EE53,0x240BAC065D7078C8,0xB4A20E971D3AE924,0xAEFA046E10C98F0F,0x3C5D5C9,0xD76000C35871246F,0x7266E26917FE6B5F,0x890CB5E893B9DEE4,0xAA85A3D9B33FAF26,0xB5FA90A8BBF4D79F,0x75F360386D373A4A,0x5823B1A4F576C5D3,0x3BCAC69DACD19177,0xE42EF581E5BD217A,0x26DDF3256,0xE7EB35CA8C9F8920,0x3417F950A4DA83E9,0x5247948AD723C5D8,0xDB0B60F9C44B3253,0x1DB638F28667E16B,0x7FD0955F2B713355,0xB19905F45B6759,0x10C8B4D074B61E5E,0x2101848071F94D84,0x2639A3A16,0x1FD41A2B79FD504C,0x3A2BAFF15CD0FB32,0xF9C58A93BA7768F8,0xA89967B7F73371C7,0x5EC889E65E8892D9,0x7E0FDC5D5C706C02,0xCCD28A0507409A3,0x4E7E90CE99AE92DF,0x2DB3238A13D50C06,0x1E10117E3,0x509496E4095911A0,0xEF51E18804BB0D6D,0x827F2BF86E0E24B1,0x3AFAB2FD1D7E760A,0xDC54382800569ED7,0xFC3D75922DDA52B2,0x843C270591E00559,0xE007B13FDC0EEBA6,0x3D301A230404DF79,0xEB12DEF0,0x61098CECF549DA26,0x609AD65DA235D38E,0xB7FD3B9838F522F0,0x4ABDE482E786D3BC,0x715747C0F123C191,0xAFE42C79BB64BF92,0xF0B01911F4B0F0EE,0x2D5C649900024830,0xE7CB2ABCC3AF8909,0x26F853B1E,0xFCCE27866323CB15,0x792770EAD031C2AC,0x18323A76AC9ACA79,0x830E31528B11A2C0,0x68A5536579500F5D,0x3EFB0DAA7DCECC0F,0xEC53749737061056,0x396137316E2AA9C5,0xA1EB57C7B99D11CA,0x1B906B277,0x800F99B284D6EF09,0xFC2C2D725B5A8B7F,0xEDDDA4C9DBB50BD2,0x4D0AAD8B0CEAE7EC,0x179013FAE0B6FE8D,0x21D8BB974FFEBD81,0x747BBA1CD5620B52,0x722366B3EF4B6F93,0x58D7574280988022,0x254343E87,0x71B492D7B9825EDB,0x313F59415E9209B1,0xE558601788385772,0x477474DE6BCE1A2D,0x8E64B4ABDB4FB86E,0x8B938AFB31E7A74D,0xB6F33D3BF353555A,0xC8286460E78197FF,0x4969DEE3240C4D34,0x620893FA,0x967E75FBF834AF97,0x921B07215A6A3912,0xE516E59F433567DC,0x2A3950F9CC95B66F,0x8F5A4DB25D59F00A,0xE3A81A3BB5ABFFB5,0x499AA03009B4B1E0,0x14C820187238962C,0xCAFCF9AB7878BAE1,0x1074A951F,0x14711E91724AD65B,0x5CCF2646AAB18AB6,0xD978F890EE0FA874,0x3CE3EA0D55D6869B,0x656C0C1D3C57D3AA,0xB0D31559C08EB589,0xF784481E0CC27EB4,0x9AE261DD91E20DB5,0xAF884A7CB0BAFB78,0x149B73A06,0x79A4FD41EB380C85,0x6E7E9C8507CB75FE,0x22FF73D501447903,0x424BE31182597FDD,0xBE4AB881678441B4,0x53006858EEFADA8F,0xCC12B54CBB386699,0x14E833307FED4571,0x65331D8CED00E5C2,0x1C176BF0D,0x5A071816B624165E,0xD00EA0206E1B0458,0xBA8D3293E07E15B8,0x23AE45BAB0F1DB50,0x8CCC4B5910071333,0x3AF3E99ADBA44CF3,0x32E71F17B680D53F,0xF6DD2EF49BD9F328,0xD3EE6D9B14645FD1,0xA1EFF565,0x2A029E3143CD9F83,0xCA845BA722C5330A,0x57CD16A2B201AA64,0x40CBCB5B569E225B,0x96AAAE32648E0919,0xD392E68A57736804,0x1EC6959E84FBCB7D,0xFD31DC6FAD3038B1,0xBD3DCCEFF61F67A9,0x1F5316E7F,0xFF27FA1C4BB53CEE,0xEF4F876AE38EBFEB,0xCB69096150718007,0x70270D8645DC1FCB,0x6E056E0DBB8C120D,0xDE5B8FAD5EFC77DD,0xADD4D9B49CEC0397,0x830E2863AAB363C4,0x84FD2AEB188ABF05,0xE33C3D30,0x3DDE5B7415C168A5,0x45674B1B7311BF08,0x6FF208AB30380982,0xA9C4A0C9B891C83E,0xED237A0B08212F53,0xB1168DC987769B27,0x3D2C4D3E9BE99C5,0xF153A248B922E4CD,0xDE6689B6E6426D5B,0x10501BD60,0x42914F44E6C290CA,0xD40E942120410F36,0xA291A46591A1BC1E,0xA8EA6862CE247BF2,0x820EF174883F6ADC,0x6094A82650D60DE6,0xF2B994999092ED45,0x114173D25403E963,0xAC300E9F524ABDF7,0x1D6BCB653,0x691737B9C39EDAF3,0x4E5B30CE8B088648,0xD1771E29669BFF40,0xB4EE4B7215751261,0x8E997FBDCD277AB4,0x67BDFE5A63C81A26,0x85BFE35693CEA0C6,0x71E841CD97496995,0x120C9D121D8F29A9,0x16BFC191E,0xD543861EAFA0D175,0x38D57D21825425FC,0xD9B532CCFF95945B,0x66EB133F5283B2CF,0x5E353A11C02C7CF4,0x9BB5D1CCF08BCBA3,0xB5C9770D790A4790,0x2DFFFA7E41397B30,0xBAAC7861FDF1C1E5,0x4B1AF5E5,0x39412DD3B717D80E,0x2B21F83F6DDF3975,0x1EF180439B9E1D0D,0x18979F28475CDDFA,0x2B1A698E8468AF81,0x8F2C90275B77DC9A,0xB4C930A843ECE3E2,0x46D5FF1F7B723773,0xD7E2FB2C66CD49DF,0xF8D7374A,0x153EAA1B2990FB6B,0x4B3013908FE6108B,0x830B919E0E2C4F1B,0xD16313D02E13FF44,0x82627629EE8998D8,0x154ADC5B6880D7F9,0x252457E10C6C78A9,0x8099E77B498CFA6,0xF91D9C868B0B47B7,0x1E2E9E7CE,0x8D3D4CD892FD88D3,0xBB5871A3047E27DF,0x190F850FF638E8F,0x1578E112ACE899F8,0x15EAD14C37370869,0xAC43F0D8E2E9B15B,0x3C03A0B27A95F524,0xCBA352D0497DA45,0xABBDC87264B0526E,0x11BC8A017,0x79C1EFE5256B07E2,0x5EFCA9F5A3C1B5EF,0x512C2FF4CF9F9897,0x7EB82CF77F439629,0x6FD3147EBCF65EB,0xF3643FAEC24622D9,0x11A381CC7033D414,0x1ABF25905C1F89F6,0x62B3E201B3B42970,0x6D3789DE,0xBABB5C557E4EF190,0x5B89FEE949DE81B2,0xCFBC49D52C26ADF1,0x44CCCE93F69E0C21,0x97344535EDB1647E,0x9A2920048154603B,0x2AB6904B849BEBC9,0x9E014E633A0736D6,0xBE938982C11F184C,0x219765FDA,0xEDCDBADF3B33673,0x78F9EB64FB6879B0,0x7F680EF4D57D4A15,0x1A4D9CF363C67579,0x93EB401A1ADC836E,0x2D36EDD38E674FEB,0x41F55A88C1B25445,0xF544C58853325E8C,0xB21030D9379B99FE,0x1FBD4011,0xAE427DBA8F527AD5,0x5EC56DAC80418D66,0xBD088D2E16BD4ACC,0x398D0A14424BFA57,0x36121A578F80EB3A,0x1695DCA530C2F04,0x1503856837955283,0xCC58BFC6A9A0AD01,0xA93186FCDA7F0116,0x112B28112,0xBB76F97E2012497D,0x54E88E59C52BBFFB,0x65174C5255EA68D3,0x18EA64B0B01AE4BD,0x9DCC0DDF1F61FAA1,0xCAD25EEE5E8FFF63,0xE02EAC27EE63ECE9,0x92964B4833AB1FCE,0x41E5A7C32573BA82,0xE551CC37,0xEDDAD3084F52C425,0xCAA0D47A998E3C67,0xB0AA27D4F32793C6,0xCA66E18D88172CBA,0xE29644183A96E55F,0xA5A3C30EEAF5B4C,0x92A06FE95F3851A,0xDA4C59E6763A466D,0xB9D510DD75D68AD,0x2576DCD8E,0x859FF51057A06EAC,0xA8930345F86A4FD2,0xEC636C2DA1CF4CA2,0xCDBF61EC32ECBBD1,0x1BCF2049F1B09644,0xD00EFD93BADBD808,0xB19A3B6ACDDA9CDF,0x1F6D9D7861CA8BF0,0x521EB7943334474A,0x149C5C684,0x345A15F752A85DC6,0xAD80EF4FF4BCCC10,0x2A682C04F09CE68B,0xA4B39F26FE3165DD,0x5D62C94F6B5AEE1E,0xDDB0BB186BCAEC5B,0x6A76C1E03CF6AD67,0xD2992157A0F06E0B,0xB740495654EDBC01,0x2663D2E3F,0x115FF449A9E87FFD,0x1A2F2876AD42F98F,0x2735E0805C7D6CB,0xF22B1D1AF10A800A,0xA407D925592FCF76,0x6A66742BA6C9F5AC,0xD5F551586E4CAB3C,0xA94D14238B074BCC,0x7191A703BE5D9739,0x1D5DE3D60,0x55D527A77881D967,0xA40E3664116CA3F6,0x4CC98FF4A3B878C0,0x450FC44FAE377A5,0x182A14060142D511,0x75FF2A59BAE133D9,0xB687B1DB2689A0F2,0x61394ABA24B8E270,0x30310A73890B16A9,0x26388A4B9,0x2C4FDF057FDB42EC,0x20290657B49CDE70,0x5F877AF46BD08A51,0xCC0A2A676DD10C0D,0xB6425FC9558A97B9,0x5DD5DD9C38935983,0x4B9A13C3ECF5074,0xB90EE0DA6D90143D,0x3C4D094F5BFF09E6,0x1C476291A,0xBFF8C06DD12F0F6,0x9AC095DCA154F92C,0xD2E82364F713F7F2,0xF2D46A78DE06FE69,0xA5DDC76BE4CF9CC2,0x8DA4B05404EDA27A,0x1701EF036E0E687E,0x30C5E45CB3A4B6CE,0xB9F543F8912D692D,0x248D4CD6E,0x1F3F4DD2DEC61089,0x6C2AA8960F6919CB,0xEE7EA40214C06102,0x9D01CA375724E285,0x1938B59D8255C07A,0x29F4A56D08E18211,0xE6F5683DF645D948,0x27117D700204EED9,0x7055094C9DDD5E50,0x1CE54939B,0x631F3F5802E59C3B,0xB43DB691515F959F,0xCADDCFAD2E7D932B,0xC2D0D0F7BC792116,0x9C63397326E8EC99,0x3DB8ADF78509C551,0x37B6B387E1C2F484,0x998BAF9EF93D2DAE,0x26CB12E29CDFB890,0x577392E0,0x7BE7731EDA0A16F9,0xE9F3438B562E9206,0xF260CBBEBB2DB8B5,0x34A5C0D1826212B8,0x6E24881ED15C4268,0x5CBDBF725410411E,0x4C140E7010229DF5,0x49DAC954711DCF93,0x5544AB8D50EB7CDF,0x1E7CE8792,0xD2EE55386451EAA9,0x1439344D48C136F2,0x6B706E7F7629D798,0x3B6D1718EDA23D37,0x9BDE40AF014DEB99,0x44057D0D1ACCB714,0x7277FED9D49A565D,0xB45ECCBD1EF53864,0xA7CEB700FF85C042,0x1EC75A3F4,0xBA589E3CA583B05F,0xB49D58A73548F6BE,0x37D92EB841B27CAA,0xA0DFD59BA015ADD3,0xA140916836682147,0x9056FC3A7948569A,0xEF88C87E0160C1E4,0x7DE9BDB87A5BC5E5,0xFBD12564731D5771,0xB664887,0x4D51E926CF2863E4,0x2DFC532971F6D1F0,0xCF44539D46E35D16,0x87FBE43B68363ECE,0xE7391F32F86E2ECA,0x9A25059A8D1B89E0,0x6340AE40BEC65339,0xECEEB3188717C83A,0x72B505022AF4BF16,0x35E03A86,0x75DA4AB10CA65E7F,0xB0848138B984D0D8,0xDBE52A4AE532A591,0x19EBED3C32B3C6F0,0xB66C414129E29D29,0xB7962FDD2B2035FA,0xED74C3D1F4E1055B,0x8E0E691CF2ECBE8D,0x2FB211D8C965A3C,0x223A7EAC4,0x81448323AA2A6CFA,0xDDA1D667553E653F,0x43E71447B1FE8277,0x140C6347B0ABA1B5,0x790F474897E8701A,0x94AFB9DA93ECABF9,0xE68EB4DF322D45F0,0x101B33BD5528CBE5,0xEA196D2012B9396E,0xFDC305F,0xD5F2EE9228DABF97,0xBC766ED69A14E443,0x1069199E492B68A1,0xF6B864EE8451FF6D,0xE0DB935AB9C5F066,0xAE23FA89201D13F6,0xA0C026B8DE009CE4,0x1A4E594A5463059B,0x19757A71189D0041,0x10FD0897,0x6000E3169BBD0C44,0xF3B1B413857C70DA,0x1F126E5FE4083166,0x60FFB0BD5D205351,0xCDF11560B0D95D82,0xE698B10E626E69E9,0xBE63072D8F1242FE,0xB0E2B5F1A82E5525,0x5A915EF9A174D359,0x25B93E256,0xB45A197E84207FF3,0x39D7E666F21C1FB5,0xAB7DCF014F8A5C1,0xA013086181A403F,0x7D6553265F023357,0xBBD09CFB90B81AF1,0x5CCB6E9C78BAFDE2,0xE3E4869E149B1631,0xF4BD072C1B2EDAAA,0x167CD0CFD,0xC4AB7BCBCD631479,0x3687E5D062221169,0x75E78C090E62A47E,0x3BDA391363692E13,0x9B0CB287056B7B32,0xF7546D2365D416BF,0xC495C969CD4708FB,0x32018B4CE3D63BB4,0x6C77A310819D6D21,0x7FD82469,0x9CE16D33AF19B2FD,0xC21BBB94487AD821,0x2060BBECE4930B80,0xDDCBC7D29B266F75,0x2BF2BCCDAE991730,0x6A7E3C034D06E396,0x82EBE108EC6CC7A4,0x7022CA6B2A776417,0x1324D80427A40044,0x314C0483,0xB6E708407CE78D4A,0xF8C4BCA62E31C141,0xAE6E4625D61AB141,0x912BD301E594F25A,0x12BBA5C18F5AB73,0xDB9238DD42FEC391,0xE13162155DFD51CB,0x26BB029B1ED95765,0x2FBD257B5E9B7C3B,0xF3EA997B,0x4FBA414645320DD4,0x993C8F8F1ABC8ECA,0xF3CEEF39790E5793,0x48F0A11F3B5F8B23,0xE456E30E6FE5B983,0x93CDF8BD8D08973F,0x47E04030EAEED2DB,0xB046D35A650E852A,0x6BC10B9505D4B241,0xED9878A8,0xFD7C08C90327EBB6,0x196917443B2D7455,0x3670F3E8EC46BC9,0x9C5E95778B21B893,0xBEF6DE513E2462B6,0xA26BF4B96C5EED54,0xAE38E2BA3FFA78B2,0x25C38B28C447727A,0x241592BAA58A8711,0x1A4743B2B,0x47CC2AA83B89CD3F,0x66B5237A8A85B1F9,0x1B6E31A1E916F0BA,0x4C7D7D3E679A6ACC,0xC21F37C700FBBEA9,0x695567CBED04AB15,0x1D7D1E402082E993,0xE5263E38A1488217,0x75666149E3E1CD42,0x1E1A291A3,0x8AE9617FE738EF11,0x93763CC8DDD6069E,0xF503993A93964DE4,0xB2A35DF35045935D,0x8E4FA2EB5B2894B,0x37550EAAB2E7ECB9,0x43833E889578A373,0xDB1C0156080EADE9,0x8C7033AB003B08AF,0x1CB9F25F9,0xABE4C3F5EDD721A8,0x4A176714125564BF,0xCE406D871A0A9DC7,0x20B7EEF37AD56AE1,0x61B49F9224E3F3BD,0xA7BB04B57EF64740,0xE57F9FE4871888B9,0xF435C2D28699AF17,0x6F08100A5DA6B76C,0x10EEF2F6D,0x9A8C20BBBF61B6BA,0x7EA57D1825BB7684,0xADA8A5E9BBCFBC87,0x17A1F2DD0E6125AD,0x30DE12D0CB7E3C7E,0x5AF31A14ED1FA206,0x7D478246964A7892,0xCB223EB25DF03386,0x44B0D6186D2DE569,0x18C980ED8,0x4DAB4DC3F04F8CBC,0x2699C5C6E17CF2A9,0x11988C293CB1EFF6,0x565076F6D86C174,0x9656020970EEC1B9,0x1A4CD251144F02F,0xF4ED5ACF70ECCE8A,0xBE1B45C1809160FF,0x52B0F2013E7C8A8A,0x26C546076,0x1DE4DA2D40AD7416,0x28BA3BB872FB541D,0x80A9407AAF303D53,0xEB298BF8EBEDA2DE,0xC210571E9D919154,0x57E89F3F0B8F7AF1,0x46E936FA305D80D5,0x37C8ED2F6B192BDD,0xAAE4FB88CAB36F0E,0x1D131215D,0x276DB842468A60EC,0xDB32B05E5DDC7441,0x7C83E45A6C523640,0x867AF7FFCD97990F,0xE5617BEF33DB71CC,0x82B649732478D7EC,0xD011517D96BE0DFC,0x4B02E633A7A70046,0xBD83865C69181A1,0x13B4495C,0xB6F95AD5FDB0B5A9,0x39CFDD2B0A67B5A7,0xDB2DA830AA95076F,0x12D0201D99F72D95,0x16B402924E1C020D,0x68919A8470E6B6E,0xDEF729E552D28D2D,0xA2D72DD0FBA37534,0xC4F47CE7CE98B4EF,0x120FFDFA9,0x20BFD2C7AFC58D58,0x628F8897650251F6,0xF6124D23722CCB6A,0xE0CBE884817A18,0x1D08907C0CE9BD14,0xF0D550E4354EE676,0x7F35BEF6D6A5A546,0x1458B4E9A986AAC8,0x847521F69097BA99,0x2726375E3,0x60D92223BD5C3CF6,0x5C8D0EC3FB5B0A61,0xBA74F21C579D1E37,0xE728E6EBB307F75E,0xAFF16CEC4FCDFA2E,0xA236D2E0D42FECB2,0xFAE1F5A76CC45BAD,0xA2A2E08709BCFB22,0xC01884F900099F4E,0x1FB41C1EA,0x2BC24B5EC474D167,0x18A3A857B6592B02,0x1ED8357E1218A78B,0xD62D1C87C495A24C,0x92765B926A3976A3,0x25F49CCA64EE830B,0xB2E6C8F95ADDE34A,0x83FBC53C70027EDB,0x683A180488A999DF,0x2441D752F,0xA5D5BCC52813494B,0x30B4CE1EEF26005A,0x53A784AF84DC3F07,0x3B360C2BE2AFD522,0x6D68ADFDC8728546,0x8A80226D06E95E37,0xBD4B2D73DFE4F27A,0x949D49FE26DA38B8,0x1FED2126234D1DD,0x200D8180D,0x98B5D5E88E5E4451,0xEE4ABDD2515E9B9B,0xD2686A1156B17CE9,0x16CA3CC3991958BE,0xA7D4E2900D1A7A24,0x25F7128E71AED8A,0x1ABE5903526E4D1C,0x6AF79EF3564F41D8,0x65AA603C8991407D,0x247CEA74D,0xD34F6CA2468DB009,0x8494B54BB6B83E94,0x359E839D07FDC512,0xA4B61BBABBCE21CF,0x696463F0D796C3D7,0x7C53E71DA0740383,0x2DC8A2AE138ECA0,0x8F0C1D520ED47497,0xB657B7A01D8C5690,0x197DE2F8F,0x5827587A3AD0B1C6,0xFB1BF178BEE7B242,0x7190192B59004A8C,0xA773745871F138DB,0x7A6A303A28C0089D,0x3701F0CD51101176,0xD0666051020F6561,0xD10BE722C9B424A7,0x3EDA0D45F57A957E,0xE324B429,0x63983B4579F0B267,0xF1CA57BA25427BAB,0x685CB48F188BC661,0x2144675811C1A11F,0xC7B51BA4578882D4,0x51BFADD39531B4DD,0x22AD78D1382BFB3,0xAB8354B2A45514CD,0xB9DBD82A9B680B5A,0x2241BA4C8,0xB66E2D47DACB10B2,0x4F48651E0E4753B5,0xA9EDF45F822ACA8A,0x69208D2A70BEFF47,0xBF35FC2595013A7C,0xA134E9F3718FA08D,0xE261E01A9A5A2EA2,0x4718A782E3DFAF8E,0xCE88FDF4311675D1,0x138150268,0xD0B608D6BA4C3B48,0x9B376BE486E948C8,0xD7AD1232D1156B1A,0x9DF3E040D7D2D7F6,0xF397C49366F47884,0x873EBD533A07B5D,0xA6CB53C07F88E20F,0x18EF993D5B9A133D,0xADDABC688474806E,0x12DDE4312,0x2F62F3ECD2E4B878,0xBAECE191BCE260CA,0x5F7ACFD633E9CCE5,0xC0B27820A69F7951,0xA07511CE60A09A0B,0xC656E1DE20E863ED,0x3F8AA1A65CBB5C42,0xE28B97337452F747,0x1D864A7FAC503FED,0xA6886169,0xDA12F0338460B9F8,0x73DD898D86521C5C,0x39D776660AA9EDF8,0x1B909C7680025EC,0x94FE5DC5A8B8F089,0xA890CA103410B30F,0xC19445B8837C88E7,0x6923FB0CA2A995E2,0xDEFC84AD70B4D9CC,0x202625810,0x6C9A060CD7D6AD89,0xB3B68544411F9EA8,0xDA6198E87AD39A1B,0xC305FC20515F1618,0xD99188CDEC57D98A,0x15D5CD0387AF4941,0x7BACAE25743E9733,0xDAECC3B8B62AD589,0x3FA5E75E8453E748,0x736584FF,0x8AFAFCF73C23995,0x3E676CFC0C9B7009,0x5A737022CD8F452F,0xA15E91A74826C9F3,0x55180F74C1B57EFF,0x7ECFA14D263A69F,0x1351BD5CDD59E204,0x61134EF53E50EA13,0x4E575B9AE1037693,0x166EB91C4,0xB1C792E1FE84A46D,0x9125D92E166BC816,0xB6EAD4A54A0D5DF1,0x6034EDF8A2383B3B,0xD3185225B4D18C92,0x588AA867C2EA5647,0x87B30BDA87ACCA1A,0x601E4D8D84534E8C,0xE94798B3C106B1BB,0xC27BDC0D,0x862A81E42A5F59A8,0x74988B5831765893,0x52DA7EDA2B696B59,0x71D26C659B6C44B,0x428E9F17F5DD8466,0xC33F97205EC85DBE,0x5169D2E875C40F6F,0x695C9384AB524C22,0xF5129235FFD8F0FC,0xFAA5EF88,0xD27D53DC5B192672,0xBFC478EA7C9B8747,0x7FB7ADA7BAA1ED7D,0x728A7BCF0EB0E22A,0xB61FB1AF970E3F86,0x13249351F87993FD,0x130A7CB91D6CF2ED,0xB731B6ADC537C958,0xAEDF9944D4531C65,0x2D464449,0xD4F035AAE5EE55AD,0x63C120F2CD94E63E,0x419C5B9D08E05F81,0xFC62183CFA62173D,0x8BB7BA73CB8F93A9,0xFD9A23A7EC78FA43,0xE85058826315008A,0xA58BF5AFAC3D09F9,0xA5A7789EDB219B62,0x434F60F1,0xD19D913164E921F6,0xF23DB5101743C13D,0x42873E61A20099C5,0x1841F5F7E1C7478D,0xBAEB6A3E583D6992,0x690BBEF0721D8E90,0xFC49418B790087B1,0x3E692A3EC1B60FFF,0x60B69E4232AB4DEE,0x1C440370,0xDB6A0D68DA6D7940,0x2497467040A2B6EC,0x261E7A2E419293BD,0x5D802B2FBCF868A7,0x35923DED1635F795,0xD9FE987273772619,0x289BDDAF13E76C42,0x229EBF5CDE80B702,0x531C27E716BE9CC6,0x11AEC2729,0xB7BF5360E28B8324,0xC0CC9213B3A02485,0x88AFED172D22B31C,0xFB9E3C37DB9F2290,0xB5BB182CE755FB85,0xEAB3C986AF8016A1,0x7AB90C06B4E748CC,0x63C5E0B2BB85C534,0x32C33589EF183C0D,0x2235D5133,0x277D3C0BDA932113,0x5D73A4ACCEAA5357,0x8DECAFC1E50846CC,0x62F40989981EB04,0x1E5AF394CACD9672,0xE308F9FF3D7D3183,0x8F8023864C4FE01C,0x487158F30A0FED4C,0x793AD318B3D0CD5A,0x1C2E593B9,0x861E1CD80B9ED1DE,0x1D0DB21C4C152334,0x90E4D78D10D61BAD,0x129D7E309171021A,0x1F19D8C14D75FA95,0xFE347E39AE4A4359,0x793679FAFB75B5BF,0x33FA3E716A970C3D,0xFAF9204F55A31F49,0x1AE3C9F87,0x4DED44CD12F32D95,0xD571CB147CD3704,0x2A6B77E7521DB8D3,0x6E89B0AC4BAB680E,0xB40BFA237322114,0x6432CA33E1FC17AD,0x28C5B952B72E514B,0xE67F0DA7A4057215,0x5AB07E0107E4BE10,0x22F357658,0x12B7132BDFEB2F2E,0x6A7FF4FE29E24C18,0x32EECB4328E25C51,0x5E248CD9822D2E0C,0x90F25E383E00F839,0xBE4CB9897C29A0C3,0x9A98CCC1551D3838,0x38E9B2EFDCDCE388,0x13BE536D4C7D0D35,0x20BD06AD7,0x2DD8943E1BB7E1F4,0x472549F8F8B1818E,0x27F171968666DE5B,0x2767A2894B9C9DAC,0x6A4D80A45C863A98,0x113EB0B6E925AD98,0xCD8A6AE4CA92458A,0x37F3035C4301851E,0x2BCF7CF44A688B7F,0xF7D27913,0x6202D329B5C4EBF7,0x71E0978F0FB2EB4A,0x93C0788B42F6CF20,0xC4D564A6737CDD32,0xE1845F30228202BF,0x846A060010EA8FAE,0x82D3F96ED98EC8FF,0x438D880532176BC0,0xEC5E4F7607AE3C4A,0x846CB5BE,0xE5AFC5C0800D9179,0x2B3101A7F0F76D73,0x593F27F617A743AA,0xC579B14E12570E6C,0x6D939C4715FE0BD8,0x86D9C6C0B0BD25CA,0xF1160C8090356FCC,0xBA3CEE1795E9021B,0xBF6E0F9579B316F3,0xFC61A025,0x8D1F98E132360DED,0x4DCDE9EA3206BD9A,0x4138ABFAD6A7CAC5,0x443403B5251B4D42,0x42227207D84E8A4B,0x33CE2BCBA0A75BAD,0x2CF7664FE496FB1D,0x7DD30B3F3FC406B2,0x2BC45CBE328F27F4,0x86953895,0xDF5339523BB90BCE,0x19F8F5A42541B70F,0x851C381AB45E6D90,0xEEA487F74067EB9C,0xACEEB4D4CFBCDC41,0x2010D7D99AAB0FF7,0xDEED91DD714E2606,0xF5D5451F29355B09,0xFAB8F06DEC62C74,0x1C9494E6A,0x9BCF0F7FB009976D,0x469640EE50E05296,0xCA9515E59B39B3A9,0x767B7457440EBB5B,0xFA9E4C43590A9BBC,0x27906F43D35DFF13,0xF4FFF7906ED4D81E,0xD567BE273A2D64A2,0x9C68BBB71A2F6320,0x198181D10,0xD12DA13D63DF2D1A,0x1747003C94A411AC,0x5C902C96537C8646,0x63BCDB086AA9BCE3,0xFFBF312316850D39,0x9C0C467DAF6AE4A4,0x3072F7224BC297B1,0xDC1818A211B8DC6E,0x35E072FE77E5C280,0xA4DEBF1D,0xBACC5C812F49E7FD,0x9C4248469C7E537F,0x28C8D30735A2DB8,0x567736812EA27376,0xCD1150BD62AA127C,0x9BD262A6798C3F6,0x8D58DE1143B1726E,0x4D4468146CAD64E5,0xA5D9C7592F81CC76,0x14450B8EF,0x65C184C9D40993A0,0x253372B103D77C5C,0xE2D2FEE405DB0853,0x5979D3CA9BC9B95D,0x4DDD4800491E1A1B,0xE4B2F1365059D042,0xA301856BB3E9D3B,0xA10E4F50797DAD04,0xA01F42BBBD9844FD,0x1B8DBAEDD,0x9E4151F793FF7C2B,0xCE3E0E7D5FCB1AAC,0x17AE1D164DDD1462,0xECA3175AA1B3DB05,0x9CCEAD0D8A0E61BF,0x2F4AAB4ED9AE7B52,0xFBB6E68A06B219B9,0xD0D0AD15B07C8741,0xD881B5BDD3A33A39,0x18C86D2CA,0x16DA38D3AB6A6C89,0xD47B4163C19BEC6A,0xEC483C61CD2E6986,0x5F31BD03E21ACF23,0xC8D0F1570183EC0C,0x16991FB9109188EC,0x9713AB51DC37DB2B,0x174BBB842FBC2D9A,0xD3AE8F39B1D3A53,0x16AAC756B,0xB10F626F457018E4,0x36CABCB76509C5F0,0x51CEC52337AE93E1,0x7BB7C723CBF8C61F,0x69916D11BD58ECD2,0x84EB4345EECD3477,0x7DDCD7CA6E811B37,0x50E675AF59AECF37,0xD59C3CD7C8671608,0x8FD01C62,0x893C24C8EF423B9C,0x75DB5607564B3D54,0x9F4126CA88EA5354,0xB667AC3924B65905,0xAD9EE1DE5E003F69,0x76EFA2B84A9254E2,0x493E1AD43247DBAD,0x9DFC410F6DA91A48,0x909DE034EE92D3D5,0x26299242D,0xC8D0F5C8C71B36CE,0x1E2C944172CEB529,0xC56EB240E8B7FD0F,0x877EC200391A510,0x8900C10C0CC2914E,0xAEE8A3ECD600037B,0xD8F42C6E4BE7EA0C,0xAAFF7F7959DB8802,0x573EB537021EEF59,0x9B9047E0,0xF0368DF80B33A23B,0x9DFBC19DE42E19FF,0x792DFA3028BAB8B2,0x5AB46AF519A1DAB7,0xD83F28E2056AF79A,0x37528BA1400CD497,0x682FF6B5F0911F58,0x3F69FE30EF61F9D0,0x8674582044460004,0x12CD45914,0x75B424A692FAF3ED,0xB568EBCDBCD8DAF,0x32130C0C7FCFBCD6,0xDAAB0123332E17C,0x42EBB556DDE72108,0xE4939051C351EB79,0x99E5452CAFC51C40,0xEAE482A6C0331EA,0x61D05E06C8D980DC,0x10543E531,0xFC2C633FB858C33D,0xAD4AB734B04ACA33,0xF4D3427CA12E1A12,0xEBC44B312D97750D,0xF6DA35E8393FD541,0x8900ADD4E0D8EEDC,0x33F1F0F295101E58,0x313B524763330724,0x3847EF4F77B7BEE3,0x10CDF5A30,0xC9F9DD53233C98CB,0xE0934B5DAF86C363,0x886880C93383F8DC,0x553A090147EEB334,0x422400B5FC3FF4B4,0x79EEDC421ECEF069,0xB4396B8D1A5904FA,0x29C2AA0817F2804D,0x86AEFDC3578E96C6,0x66BD6A48,0xD0FBE42FF9031C85,0xE356040D5D33D230,0x38B54C36DC0D82A7,0xF11CF7EEF89B595,0x7D97F295F852FE34,0x911B1B3F7B42FE14,0xD6F88B0D2F7AA167,0x849A8F828ED4ED91,0xA8F14379BA1467C2,0x2486F821A,0xC6063A669EE9817B,0x56184C6668EEBC57,0xDB36F2042F22A5C6,0x759D935EC6E3B7E7,0x5ECA331D01A1889D,0xB7E0A6BB9B1C0FFA,0xFEFE51817891C788,0x8C65268012234936,0x12340FA3DA80BADB,0x256EA653A,0x6F9BB0DB67131078,0x995C37003ADE44B6,0x4FE4E02CEAA70A90,0xCD05FA6043507B58,0xAFA043805B5D0F86,0x16E29E90CE487AA,0xD1DC71BA797E30CF,0xEBFB5B194036F6C,0xA4140D02648834F0,0x3089DA8F,0x1E0AC98B29ABEDD9,0xFC6676AFF9931D1A,0xAF8D4A858957CDB2,0x7C74BD35FA024052,0xD2270B67BD438AA2,0x1B625796E5D0BFBB,0xAC257FF77F489984,0x113D55276236BDD3,0x94D65641300CFF7A,0x1F7F29987,0x2B391AE38394B51A,0xFACC97790AE63193,0xD73180F32D1263DC,0xF4D47480749BA0F8,0x68889582977E844,0x8442EDFA8BCE7738,0x3E6C5C34A7DA4B75,0xF1C3A954E3CF8DC7,0xE3C155423FB8632D,0x21428A9BA,0x12EF91CC3F846486,0xF2D33F5E7ECC7798,0xD109046AB0A29B7B,0xC52489ABFBE2778F,0x7B773F0F6E5913F2,0xEF03D0B0A4F7021C,0x6203010C879E1D20,0xBDD6B3A1B78EB13E,0x3E6B42D6AC41B4C5,0x218E4B958,0xDE0A479987515705,0xB25FC59B04819244,0x161165DCB11F3955,0x96EF7DB2DABF96B3,0x4650A67BDA177162,0xCFD8D88DA30F59F7,0x64827D499DED9837,0x68B33CB00BB1DEA6,0x8A87D4FA75A84A29,0x139A65721,0x2D3155D18501C070,0x4D4C7227FE14E5C7,0x9B16586E5167DE07,0x1CA0BF7268EC31,0xA51705DD159A97DB,0x7C9B391BB0BCAF60,0xD8843474CC43C7D9,0x34A63E382711C322,0xF839BFCAF7E7E637,0x239D22953,0xC51555461A18165B,0xB3045025BE9823FA,0x35D7E5C3DF886654,0x47F539D07E9C5A3,0x438715F8C6FAA706,0xF7F11BD88BA0A985,0x6B6ABE6AE7AC388A,0x8F559FB77C45A984,0x414A6DE2DC3AE636,0xF83464A3,0x35243207F2C81C87,0xE4AF61442C16098F,0x1220E6213031279C,0x2C5677A3B1A360BB,0x33BBADD7EBDF272C,0xB4304E01F78A5F36,0xDF361C866957758,0x60B2CD239E78E73C,0x5FFE6B82BF5CBE2A,0x17062B872,0xE2A522A036CB4D82,0xCFA16E65E9FD7782,0x9EF5BAE1A4C7134A,0x8AE03702A6215E5E,0x8F180E5F29FE7158,0xA9F3F91635798304,0x98F9DAB718E5494A,0x7C25A39A2D7F3820,0xA2AB77BB08469248,0x43D91A6,0xF80500878A86A55C,0x55D76582E567DA75,0x6C4AAE6680DB731F,0xC62CF7A0CD29F3E9,0xA19C826A3C6D4B1F,0x14F73792000C91D1,0x346ED2189EE302AC,0xD8EC1E50D6FAA8BB,0xB1517A1DEECC8DA0,0x13BF6D2AA,0x32D1CC8E1BE7579A,0x71A3CD8BE852B74D,0xFB3E1E098E0C576D,0xE6C9B514A061D4C5,0x3AD8D66FCFDB3B9A,0xCE519895C8386E43,0xB61E5A8DAA83AE2E,0xC4D39EB3E12411D5,0x96B4AE4D47FB2857,0xEA956A6E,0xFEE95BC08BE163CC,0x8EE77F7CB06E55B6,0xB0A62B24CE907BA1,0xD2C7E895BC7DD3F7,0xD5A049AE3BBDBA50,0x9700666D034B54E1,0xB5C0BB186F399769,0xE0221D46ED5CE22C,0xF9DA0533515AF189,0x2585AE219,0x3B62228D3FCEEC86,0xCC7ED6ACC160D1E0,0x7AAC63874B3ED551,0x23C0D3C91AAC7C72,0xD5E2836A22EB7BDA,0x2B5D2610B06BDB95,0x59F8594CD4971B72,0xE362A905ADC0AAE7,0xE8B68301451957F5,0x161920033,0x9B66C19586EE39CA,0x8B643BE5CFC8EC08,0x9819CFC2E0286519,0xF220B4101D2B31BC,0x470DE0BD5B052926,0x796C3CC81EA49BB1,0x18B89DE98C7B73D8,0xA94E5435F96ADD84,0x84F9A8C4425EFCE2,0x1D2602B07,0xD830F1008CD8649E,0x2399C403D53F9DAD,0x2BDCF0147AD42088,0x60244F78C45C31EA,0x89A9861172DACCAF,0x2034C436D26391C0,0x2EB93BE1BDD153DB,0x92F38F2DB39BF05D,0x6F44953CC8FD27BF,0x16AD1CD82,0x588F3766897AEACF,0xAE490CB344C759BB,0x2D151230062F77AD,0x6208169E32B57519,0x160750E393E821B,0x1387510D4FF92355,0xFF41923E14358087,0x79171F938EDCCCA6,0x14462DE44B5FBEAF,0x13289091B,0xBF06424DE88EE8A3,0xEF44A6FAB716DD73,0x7409ECC264B3849B,0x3CC0CCC1472C16D8,0x32CE163C8BC25D6F,0x284CB56897DD4FE6,0xDBEB78702A05FBCA,0xCD2DEA3617067611,0xC5A613AB52C80E99,0xDEC8CB51,0x5495A5D86BC6F8C3,0x629CF04E61E6CCA4,0x65B75188BDA3EC9D,0x1B51A8E8723B5F32,0xB8B710A8703530BA,0x8EC5454B918C3C7,0x4728C178D6A36DBA,0xD40BAA6A5EFA6B2E,0xFE5D03333DEB040D,0x10878B117,0xA2E26473066BEAAD,0x5A007D6D377C21E0,0x111F5F88E377DCE7,0x2B8B5D062B2DD962,0xF4FAA376BEDD1004,0x1D88247CA6B0B120,0x7C58E65091BE2FF0,0x132359081E7EAB94,0x57887554BD00360B,0xC00AE79D,0xFF2B5ACFBBEA5ADB,0xAFCA3A5F4DDC2E9D,0x9EAB5B55B26646F2,0xD0A64EFF5174E079,0x83790AC6D8C86300,0x6EEFB9A70699C60E,0x5BEA8A7842763C3F,0x43F5F06A7F51CC18,0x22614B0401203F18,0x24AC9E345,0x65E305ABA9E29621,0x71D63AEF62306A60,0x74C69267B2F7B31F,0x7F024EC59B4F2996,0xCAE60E032237A410,0xDBC71AB381720351,0x6A35CA52DB0E6D07,0x419A89D183126DAC,0x152F2EA9245B8A51,0xC94C8500,0xD638330F77053FF5,0x35C60FC290BBBE06,0x99B6EFC9C0CAAE3F,0x4039FB8A6DD9085A,0x72A5645400406988,0x899A46FD04496EB2,0xDFA8AEF2E4FC9486,0x31756348B44A462A,0x1FB95A5CBEDAFE5E,0x74CF08D1,0x5591E8DADC5B7D88,0x75C9B619657A6C75,0xF9F209EC57C38518,0x2A329F42F423CD4,0x535DCAB09D6B882F,0x30BFB662230DE66B,0xE7DAB0424277E905,0x4B28826597150A38,0xD62164BADF47C3C4,0x158E4BE6,0xDB9362D98620F60E,0x254F2BB84BF352F4,0xC8679029B702A11E,0x64E55CDA52F69C99,0x1A1EA49AD01AAFA3,0xFA3CEAC12428DCEB,0x4C942635F4A60691,0xB8B2EEF2A45F3B02,0x309F0EEE59A293EB,0x21B920CFE,0xCC060029C5862C6E,0x1AACBA163458390F,0xEB3B20790C25B600,0xD7BD126DE8A4AA0A,0xB7433C5D57871C75,0x6B982D35CBB4C1E1,0x1B5A1D9DB9528D8,0xA55649E36F6B3D7C,0x49D9F5DB4B19BC6,0xD286CE3F,0x3B735EA2A5839BDD,0xF64A47C3EE3FC6B8,0x2D6104EE8E13DEDB,0x96A0298DC75C465B,0xD0438C168ACD9477,0x7E0E922A40ADF2BC,0x2841126499C8FACB,0xDC5F1BDE962959E7,0x714E7B72DB17D4F2,0x271CC5F19,0x1DA91130E9E555E1,0x67B1270D98307679,0x373AD603FF4DDA50,0xD461D3C60AD63A28,0x1A0D65214E8E36CD,0xFA76290D640F64D3,0x9C8D0E00D9D07C3D,0x58E167F144D95D8F,0x8372632E7349C1BB,0xE17BE6D9,0x402022413B74859E,0x8E0392C13861F060,0xE01E03269BB6337F,0x4F4D201EB5F5EB83,0x3E5589BD6BD96419,0x2DE8AAAE89B5BD8D,0xB5772D060E8D9462,0xE052340E71440D4A,0xB70A2325BBF5FEA5,0x217C3C4B5,0x65845D347AF9564B,0x477A77204D0EA72D,0x234ECB9A33981DC1,0x93F4E09CCA8CEA2D,0x3AE68F3F04AC8E6F,0x1398ADF9C696E963,0x2FA370D03E8B8177,0x1126109BE9563D33,0x6D3B70DE8FF6342F,0x162EE51F5,0x796CC630497D8CB4,0x1F1E7FC5CCC7DAB1,0x65D6BFB41E7A8EFF,0xAB80B5D9B362C9E7,0x88DCE98541BCC95B,0x6DC1F3DE5D5D6D5C,0xA82CC4567FEBBAB9,0x6EF9FA082C86AABA,0xD1EFC7AEA32A6111,0x13A10E5F8,0x8305821D70AD0220,0x63136E4376652D4B,0x64C144569576A295,0xA762833AB1D04C49,0xBC32B909DB143E1D,0x51DC59E095EEAD33,0x4C002F7AD40EAA4C,0x864B4DF62784877,0x3C2A10E64EED5774,0x1405A76CA,0xDB858EB2FD61A6FA,0x8A95BCCC6565D315,0x34C5A50E852E22AF,0x23938D4FEAC1377A,0xC35124D32DF3B9E6,0x3C68B6F50621DAB4,0xA5BFBAA46E0681E3,0x8FFB7DE82ED60E89,0x3F0137443B1C3C9E,0x19EDBAB80,0x9BF1DCDFE65D9C92,0xE29666DE2B0FAC01,0x52EE0868B4E75D08,0xBCCDCA689406E8C7,0x47F2BCDE0FBB3CC,0xC0681BD6705304F1,0x747D0C1DEE8364E,0x933CACE8CDA4734A,0x4251FFF2736F0CFF,0x1B855BED1,0xCBA559D462373103,0x1ECB8E0A9EBCE0E3,0xA3379E76506F1895,0xCD7A9E1A3EE82961,0x61FB76127B3E7B8E,0x1C68B38774127830,0x3256D6F90C829AD4,0xD93272AE2A209FEE,0xF347747A8F4FA1A,0x1B701089F,0xA2600F5BA6BD51E8,0x1DB13C0795AEF064,0xCF65577B852EA650,0x6F281809E0FCEF3,0x3C26325EBBBF2A33,0x51A3A8223D06460E,0xFC85248B3618FB10,0x75E63B2D051DAB2,0x6358D137F44CAFD6,0x228B0BDE7,0x6928A0FB43AE0B53,0xD030071D33A85093,0x70F019F5E47E92E2,0x3EDA5AF26D31F3C8,0xB3AD744C3AB05EA9,0xCC8F104C75A82B4A,0xB21B39B661B63874,0x7A415A6B42E60003,0xC5E253B7188EB94B,0x149036A5A,0x725EAD9E0856BFD7,0x88B357BC4FD11B4F,0x4FD8C1F41475F76D,0xB1E1C3FF67EA0EF,0x2A73F9A9AC828499,0x5EEDFB79B1DE9A68,0x247672195E712756,0x7E704A68F36648D2,0x9F3BF207F8F2606B,0xB323AB4E,0xD0C938695B123F9F,0x34E1715C704E6700,0x9EFC666CAF6084A3,0x3EA64B1174C6564D,0x5DD62FB5B46510F5,0x3B9B8D9A0A280B7B,0x11C9D99F4CBA9F49,0xFE5FD72B5549B1B7,0x71755BD354883450,0xDCE3EA30,0x4C6474CA67B2C0C9,0xADEC80E13892A5F1,0x799B65C6BB95A5D7,0x6D47AB78E02EF1DE,0xD30BDD29FDE65099,0xFB7F41F8F1C5736C,0x2E07D96F124DBE64,0x7AEF2817FD76DB7E,0x7474ED3AC4D19A12,0xB91900BB,0x7D85E32704D8F17A,0x71AE45847CB619B1,0x8079E77529F137E6,0x4D435573D76C9D6D,0x6B5A4CFAF664EEB0,0x67D428E8200555E8,0x29E4B04A31608426,0xB97976A878A98C43,0x70D963DAE2A9BE85,0xD38C9A16,0xBD6CD6EDA8F0B021,0x64C8AFA414BDCC87,0x19DD58639DC51A25,0x36F6CA9330A5C8A2,0x3929743BD6F287A5,0x2C1082EF42EC92CA,0xC3B00439B6641857,0xB56496D71388A641,0x40AAC8B9DEC7F45,0x213A2338A,0xA40EB61BF23A937A,0xEB154C332D4D745D,0xF60006434D1E24B8,0xA5BCC37BDC36EE73,0xAF3B60C0F8C43FFA,0xD2966BD2588599DA,0x2567230FFD84E12D,0x2DDF1E864016C0A6,0xAC82F89362A7C019,0x2BFF808B,0x8E3CD0D5466791B4,0xD9B02C1BFD2D309A,0xD5153D0507082640,0x2372DBF609DFE79,0xCF8E66C3AA689CBA,0xA7F4E38205F64103,0xF30CA2C36F68ED9E,0x73B1A1C646ACEAF7,0x374535F8BE7741C8,0x9E86A179,0x4B010BA9AD2DEA07,0xCC0B1AD11CD9CA20,0xBE6E2D78A74B54C7,0xB764CCD8C06D7ECA,0x85073F6DDEF7D241,0xBE0861F30D4E8078,0xF78FD13089654E5,0x9A6FFBE07393C840,0x14461D5994A39EA3,0x113FF3146,0xE2AB91A19295B7F0,0xA140FB71A47F5911,0xEE3F8950F4041BC8,0xB90D01AA2DF541E,0x7D74ACE06BA36069,0xA7F1634DD2CB79AF,0xEFF8B003E6915B02,0xDECEAE9A68D3A796,0xB26440ABBB6F4482,0x263B06046,0x6077CDEA93EC75EA,0xAEE7406FB1C2F523,0x18D7668CF38D68B,0x61662D525D44EF67,0x3B6CED7FE9DD3E85,0xE155A171E6BBB5ED,0x999250F28937350,0x618510DDBDE2AD49,0x62BA3F45AECA04E1,0x16B9C550E,0xA5A7B38033DD2624,0x99630DF6E6E55F3F,0xF4A7B385AD296EA1,0x5EA710E914B0B257,0x31C5FCB923448B14,0xFCCEE47CC02BA01F,0x6F1DC217BA609E70,0xDA996281FAC2ED9F,0x38AC0CC742F2C296,0x18FDA7AE9,0x9708A29063868500,0x1370F9F10E3C0020,0x98039B78B822B4FA,0xFDFA14153B24789,0x4FA8B63E5A815FE7,0xB412F3B6D81D9608,0xFDBA452C3EDF9ACF,0x2FE589DDC4D4BF46,0xF4F12C3901A58DCA,0x245AFFB7,0xBEA8798769351E1E,0xF63376609DCA718A,0x4A01FA3EFAF9EC22,0x1C3F0193E8039EC5,0x71E1390545002722,0xB41FA8B2680E652A,0x54114BC6E43D77CD,0x282E15E4AFAAD488,0x576EDECE24C668E9,0x5F515D62,0xBA6AC0BF6801C18F,0xC503BD0C0176BF9C,0xF01FE6842B1A4D70,0xE085B39FCF61A3E7,0xFBBD0D3C56CD5329,0xA2B7E518B518188D,0x963AFC5DB55A9758,0x9CDE7FA8FFBA30F6,0xD5159240F747F6B6,0x2451B6009,0x47EB3237442433D1,0x6EC93AF3364AB57A,0x8846A2CBEF189CCB,0xDA3ED93EA0CDA644,0x28A6F16A331702C6,0x76F0855A620CA8C7,0x259656DE55467552,0x9C2039096215B659,0x6B0704DE13B841D1,0x13F59C179,0x40D2DB416B2AAA0C,0x9E911055316BD2C9,0xB7E07819A4BADE5E,0x70E7A0B8DAA85DA4,0xC824F95F294658D,0xB6C4D7826793B408,0x3028DFB2EFBF9BA,0x6F9E64939EF96F36,0x840B613DA78011FF,0xC1CBD1C1,0x2F5ED1B8FA8D66F4,0x2F6B734B8A9CD18F,0xE58F598307A8E34D,0x803E6DE692C464A1,0x8D47FFE9B09C4C56,0xF4FE73DD1CE4232B,0xDA2DBD67805EF367,0x17CCC1FAB56126BC,0x8B1E0E573DE03C84,0x1E4B57057,0xE62246B9BE34ECE9,0x60D615FB67FE522A,0xE096C80AF6BA06B4,0x4E5E592EBA6E02A5,0x63A980189B2983A4,0x1CD85E337C1766D8,0x955C0A989468B6F5,0x595E49018DA25B9C,0x44977DC9B9DE5C39,0x1B4CCFB32,0x52B8592068E8C345,0x49384C7ADF1595AF,0xB41FE74CB8064CA,0xBA07CE1C008A3A7B,0xD8E17BE5764CE266,0xB63BD520CE61F9E8,0x5622251020FAA36B,0x6989FE5A32CA499F,0x58B8A551BBCE3B88,0x11CAC9AD8,0xB58295F60885AE94,0x4DC02A38F161956,0x2B6BD918D2169C8,0xDF957AAAD846B1F6,0xB6F4F22167C04760,0xCFEBB5A96B1C294,0x7625C1C11713FBE1,0x480753E747FE14D7,0x3005BBAAED78B1F2,0x263F5C3A8,0x3F7B1AA2F5B394F4,0x2001E6D79E2F9F9F,0x7D39EB20DC90FDA3,0x53404226EC38207A,0xC9F2F08372B9449B,0xC20AE5B0435F3518,0xA631C58EFE7C388B,0x866EC17C415285D3,0x5ED68AEA5C3C9C1E,0x60CAAC02,0x223B4372D9E9A8A3,0x38283796E7F5B9BA,0x740F509DA3C5E57D,0x23C1E9F02A74BC66,0xA781F5D7E1FD13A2,0x97C049C6E1DB2916,0x7454E7D40788F635,0xBFD3D72AED44A6E9,0xC7E2E0DC7D215E4C,0x78CD7964,0xBB27C1F882DCC6C,0xA388B3568BA31086,0xE40C8772C2D69BC6,0x5F783195DFCEC35E,0x750BA879306FC90D,0xB385B50061589C9C,0xEC8AF0F7C859698E,0x21E62B7F857367F8,0x1576F0DCBB37F65F,0x1393017B1,0x47F5C162A7DBBA88,0xFD29C7653A47B9D6,0x8AE431C0FFB85073,0x9E0F4718B5B21425,0xF7F6D9B0F2F305B7,0x2A24DFDBDB8A7AB0,0xDC888BA9215EA46C,0x772E960F2F416A83,0xBB4FF526277205DF,0x78584E4C,0x70BE30C29C93226A,0xBFE2A35F31ED5F9D,0xDE06A1FB9D17B1B7,0xDFBDF54F944D39AE,0xC89895EE90B87C2B,0xEE2289D992998860,0xE5544F22F0D85DF,0xBE373DA64883207A,0x8382B303E6F5251D,0xEB1FE3AC,0xF3976C6FDE87ACB8,0xD7141D388610CB82,0xE29F5E5E48D82435,0x93841777674B45C4,0x177634D4F4B78C3F,0x911E9CA8A19BFA28,0xE9B1586C0723760,0x75103F36CD1864D0,0x469296233ECB4BF3,0x24F17F3F0,0x6B0B6C0C9842D00A,0x77475738CC434305,0x37C1303A8A2667CB,0x71D3DAB0E98558C6,0xACC1C5AC5B90BF89,0x7FB801EB3B749339,0xA3461375049D6C95,0x702B5FA2BBCE33EE,0x46242C95E4587978,0x21E499E2A,0x717ABB651B996288,0x1BB352BEFAD26D15,0x39C120F235B713C8,0x740CA51C9C337875,0x3CC4CD18F9F32AF5,0xE1B63F8B4636782,0x4DA40BC93FC22110,0x7C10EFB0DDAEB3B9,0xCEDFE0031D41CDBC,0x1F1C4CEB6,0xB80F865EDE54EF82,0x8732BECFCD943044,0xC2B656F9146B1551,0x39B7DA4EC72F7AD8,0xDF84077A1E40A9A2,0xD9A73887CF54C7,0x4D0C852CE86057CD,0xC5492CBCBCA5BD0B,0x7DCAD684724674D8,0x15E2B7C7,0x62BC066E73BA0E0A,0xC538BE38D5CA4B15,0xF433872537FA9BC7,0xD46BC43738CA3190,0xCC63B6B85179565,0x7EB8A72459BF9903,0xAE9E2669B8A9335F,0x1E7F51CE9A2AAC1E,0x2697C5060EE383ED,0x11442F8B7,0xCFEBEDC4D159D72F,0x799B90C23ECAED88,0x2FE0CF78651E35B1,0xF73E58B583AAEFE7,0x24D974CC4A00E2AB,0x2F69388AE7B8A59,0x3E1E1A95CDF93F2E,0x1546AFB4B657F97,0xEDD97E99B9FC832A,0x17DE532C2,0x3E2704F1AC4CB79F,0xBC12DB317A58D8DE,0x4CA9AB6ED6E259F1,0x29C79AF8C662321C,0x3A7E22EBE294590F,0x1B2AE16705EB396E,0xA70B35A45FA97818,0xFFB4AE47DC61D194,0x3F63F3A6D000A7A4,0x62DD1B8A,0x4D06ABAF281FC3A6,0x9A05BD4BB3A0C4DE,0xBC2C06AAFA8A029C,0x390F4FBD5A894A95,0xFFDDF80BE2868702,0xD2949C854EFAB44,0x30CCB1581C761223,0x288B3D40D3BA736E,0xEA8C92609E4C22ED,0x6959A67F,0x2A9C9FDC552BA03E,0xEB1A8A7870248AC,0xB859D1E9F0EBC89C,0x1CBE8B3DE039EC73,0x2BED5FA4C482AE23,0xF1FFB2B69D3D5B39,0x5EB345D714AA934,0x877D320DA054E273,0x1028715C2CDB8D7A,0xB4DA4170,0xA1F743D5494EB0F8,0x26ED51FDE8611BAB,0x84DB58B9C65A491D,0x49C1AC0027FA34DF,0x20DE7B193CE4899D,0x8D87B44F888023AC,0x33399B64F6FD188E,0x2D0A07B2A8172C9E,0x9E24F51CB196AD17,0x259A99FC4,0x38CCC92AB41D8629,0x190DC93889128BEA,0x71509FF546DF9C11,0x8CCEB768299BD327,0xB74C70B1201EC73B,0xC1A6AA5B112BC9E0,0x4171764F68692EC0,0x476FE1CAB95437F5,0xC9CF2AA03CE56D97,0x1A464FC86,0x9C95750D7CEC83B3,0x80FA89BE117056AD,0x54CBAF84AEE4091F,0xD594DCB68DA9D5B2,0x8A293B5EFEB9C027,0xF96D2DC17B43CDC4,0x355C0DBAA2DF93DC,0x268254D99EFF0847,0x9F6E6D8DE7E0037C,0x11280C5C7,0x70F2C5F4298155ED,0x88C23218DD23C026,0x6E4B965035351811,0x79236ED1FC7E2358,0x894C2393AAFD45B4,0x1AC0B987F259C175,0x6C2F41E213887AA3,0xF4016074C0021BA5,0x9A453D9523868627,0xEA392300,0xF646AF98764B3429,0xC9D434652B0DCA5,0xC8C8C78063417B5A,0xC998F89850E8853,0xF76DB883DE2E9873,0x25AEC04317B2F32E,0x670DE45C40449F26,0xB4D266D4BE876926,0x2E295AEC5B5793C1,0x1F1523582,0x8DF5C0F8779C6F3C,0x7596429A01E0798,0x1E2035334F5FEDA1,0x37934942F2C04DA6,0xDF5C4690B16FBDD8,0xE20246023140F588,0x7488186D3E25B676,0x8D9B83445DC75502,0x5A7CE3483C2DA860,0x1005A1634,0x8573422198667950,0xB81E49A55ABCF778,0x67AE980FC7DED1D7,0xE1E61784E9A2816,0x7DBF9D2040E4347D,0xF6DBC69E1C2EABA2,0x6AED12ACC4477E8A,0x761D8B04E93F2588,0xD9C583CC8FAE69BE,0x37898957,0x2951E3DD59424AFA,0x29324B52F0740F4C,0x19DFABD19F43CB11,0x754443B04F77F15F,0x47AD7F9BF5FE045B,0x6F50C331A1C9F507,0x3E68BA375599165,0xF4C5DEE99698D239,0xCF3D867F4EAB0B87,0x7D8241BB,0x5152CA757536B1CB,0xCDDBD2AB13848733,0x1E18E74ED04F86A7,0x39A46BB7CD671274,0xCCBB83029EC97859,0x39D4E1BD68F85356,0x2E49C74461A2BFE2,0xA37234934E2DCA02,0xC15DE8218FFD7CC0,0x229C21EF,0x92376984FF8AAD53,0xC6307736CB6A783,0xF2981DF0EA2D010E,0x501C385EEE45C521,0xBF2E9E3C70B7A334,0x6C34C4828D1171CE,0x28BF1E1983602886,0x4E38D24E7467BC5,0x5C7FF01D35857391,0x824F708B,0xCFE67536702D435A,0x4C674D3207AC47C0,0x7602F1F21BA1788,0xB733BFCC47D52E3C,0x1ECF1F1D8584EF1A,0x543F3E8107EE31F7,0x5D06C4ED45364C7A,0xE315D3A5ED70CB76,0x87CC281B3514D398,0xB75C07C5,0xB4302F963B1F3306,0x8C893AEBC7375883,0x6A86E033D5053BD0,0xF57EC0AF0288C5BA,0x8E43E25DD327D9C6,0x86A2B230FE966DF6,0xFC54DA57C727716E,0xE31DE2E0FD1987FC,0x4C3544FA02BEA684,0x22BE3043E,0x6F92F1163BD6E7B1,0x7E61B1FE0BF70007,0x2C5C41AEEABF710E,0x968C3FB967975146,0x1FF59EE91251BAD1,0x625186DC926E1AC5,0x1EDFC25E0CBE22F7,0x5AEB4B94CC0E6D71,0xB9DE0B5AB54F3666,0x1A13D1557,0x10D040888515D49B,0xBE6FF377908F66FC,0x2B96CFB42F2723E2,0xCA4C13D58343747A,0x9FA3C00722E821D,0xF05EBFCB22A65DC3,0xCAEAF1E1BF4773A6,0xF6D057E0AC97224C,0x4BCFF27680B2CDA8,0x1F0C930A3,0x7FC0EF6AF8103158,0x803AB83D46EAB4FE,0x5487A989CDBAFA55,0x218FC8C2A1336D25,0x56D43C8D365E3B03,0x1873D7FEE3C615AA,0x39E98CDDA0586C34,0xE5492D040DC24D56,0xC93084513AB1C2B6,0x17AEAC4CF,0x9EEA81CDA72E9EF2,0xDDDF6FA9FCF26802,0x64E5B3A69FB3B13F,0xF0AB88A36636B246,0xCE8063087831D502,0x756B0547AD0AF24F,0x2509081F9A84C8DD,0x1163E326F5DF5A69,0x7126031258123956,0x18B83C0C0,0x51ED10985D917577,0xECD6FB6C36073072,0x92FBB9D140C0AA5D,0xF48C601942A576D,0x85E23235E9CDB0F3,0x1A74397B1899004F,0x1869FFB840EDE725,0x5B32E37A07824075,0x1AF5DCF96F9EDEE2,0x1253DE25D,0x9E57BD4AD211D1E,0x16C0505D08C55DC2,0x9F7D9B271498E113,0x446CC691C74E903F,0x69BEA2F91A311718,0x8E5699D464221C0E,0x521B7F47B076A0ED,0xFEF818D07DA381E4,0xD91A5AC6B67A0B2,0x14DD1C36A,0xE37A12B1BFD8AC94,0xEB6E7C305516B8B5,0x75E8D5E3D2E2719A,0xCB79B014A5F2AED9,0xAAD124AE167F0F17,0x2612F25F387F45BE,0x9FF9AEBDF4FCC08C,0x5A722859AF787678,0xF7B2C76E42C805BF,0x9007EA3E,0x4E4B68C92D650944,0x1D5D1619EB028F68,0x6006D5D591070CD,0xA48DF12517507AC3,0x2D88434B9C2FB929,0xFB7BEB421A56F666,0x679EB7EF0EFCA63B,0x6A885094BEBF9FBD,0x4F024AF9FEACE0F1,0x22A5EE0D7,0x50AD0DFBCB0A5BCB,0x13BA7C444E419828,0x989942FB351B623A,0x604FE0582D1FCF56,0x5269EAF2710F9B11,0x16AF131DB480B4E1,0x31259CF6CC9622E1,0x44315D1D28F5C3B7,0xAC8B6111DFA0582D,0x70DEE5DF,0x49270E1B882DBD6D,0x59ACAFEEA1FBFE2E,0x9D60E4E681F75480,0xDFDFF48C343E480,0xB3349CC9755A0AFD,0x28273474C201AD9A,0x5A34CD6FF98B2621,0x67422297533F4A4B,0x65E65F6F66EA4D38,0x168CA6265,0xD8828D13017BEEE0,0x3A4ACFCE1F214840,0x68F7A557AF5ED45B,0x532D946316CC749F,0xCE53773FCA4A0D84,0x71B97DD12D2B8667,0xB7302F3D48CA562E,0xDC0A412660472D37,0x74684A9D6C435BCB,0x236EE673E,0xA08C4E3FB2577B47,0x1559276E6D37DAE7,0xD09A994018446D50,0x97EFDCF25C161E76,0xB8F53B0BFCF829CF,0xF93A97D61209EBD2,0xAA4249FABFEE9F61,0xC61829231E411BD2,0x53E14122D6C56765,0x11378E861,0x7FED71C0F6AACD40,0xF54DE5D18357B347,0xA2FC4BD713936456,0x94137EE57BDF44C7,0x43CC06FE91D5DF68,0xD5C50BAA7E43D0C6,0x83906178CE6F4C61,0xFAA678DAAFAE824B,0xF5EFCB4B3C745F6C,0xB96CF10E,0x101E1F32A42BA9B0,0x613C0B9EBE388390,0xAF37E4FF65C13958,0x6E0EB7C0B06D2BBA,0xCE243B9886B5FABD,0x9E27C677954437B0,0x1A750DA51239935F,0x39D6D4DC92E855B7,0x68E7751B43E10001,0xADA954CD,0x81F1E07449E11172,0x85C0111879B5D187,0x9D826F506660FAEC,0xF18F266B08478ADF,0x5E8BEF08E5FEC9E5,0x6E11421CB8943678,0xFC8429B133BFA30C,0x81491B80895842FC,0x8F8A09A8229C3C54,0x2423CC3A4,0x772D51AD918D2B03,0x7ACB8D072941DB6A,0x5C76BF95FC10AA45,0x16BC963AC04FE37,0x4E995FD55405E5D3,0x6A319CB84A2CD859,0xF6FC72F74B9C25DC,0xF8378F16DD6BEB69,0x4EFF9834E8211433,0x202128E4E,0xF2886E1574FF100A,0xE33DD5FD911AA694,0xD30C0A3E19625BAB,0xB525E092B17216B6,0x3A5DC7A734BD1E38,0x32F4F48F64D7F64B,0x66752211A6C25A44,0xD906150FE94D3218,0x318C380EB2F4513A,0xC075BFFE,0xD2C32B0CF525EE4E,0x1AB371AD405CDB0C,0xA9124198B17BBEE2,0x4367F5487E4F7884,0x40A0F8FEF7D0FBF9,0xFD3BD8E3F88602B3,0x870552F1F8B3E24D,0xF5E09B919D9B2B66,0x2CBE26200D763E1C,0xFB29B4D5,0xA649DFDF219ADE0C,0x15EE1D5E2C5076B2,0x1ACEEB7FC99C639D,0xF04D364FD361AB94,0x44B390B52DD55044,0x95960064F4BB1690,0x8377C47305D48A99,0x78E9DEAFB7E513C5,0x663E195D91FDF2BE,0x20588ED12,0x3A73654BF24750C6,0xAF13C814207529D5,0x1DCB692FECF1F10A,0x4B2088B9C57B35DB,0xBDE3D5B71B4DBEA9,0x540D03989591F27D,0xACCAF57E2FBE15FE,0xAF30F8E8807D84FC,0x88EDC83C9C64317D,0x19C5D596,0x6C9836CE6293A43D,0xD5A3D86F8DFCF0F3,0x8AE58D397AC899F4,0xA6369D7542629DC2,0x1337879533C5D0F0,0xF7D95B27E64A8A,0xBBC262F166202533,0xB659E6D4EEA6427,0xFDADF3EAAE127182,0x1F37142E,0xF95AA8043517A59C,0x4082ADA2AA0F5528,0xCE105EBBDE3AFE46,0x32D5A5D1AF838333,0xF98C22B826571595,0xD68150499A07A42A,0x91840F27846E8AA7,0xC80C7BB671907E9,0xC25E22E1AA99E231,0xC9839BE4,0x75FD02ACB89EFFD3,0x53E83B54B432854,0xC50106195059534D,0xDEEF7DE8FAA5EA91,0xFE0971845AB2E8ED,0x81BE8795EBEAD044,0xB2FD45F7483926C5,0x2BCC95B3A24A0472,0xDAF007C834D7DEE1,0x1D510E1F8,0x8EC15B62F1458B3B,0x6929D6F8DEF3B6FD,0x9D58C6E1C84439F7,0x4498E8CD55147B1E,0x1BED7E6F2D4651C0,0x79D6938F3E8C0324,0x676077EA2ACBE467,0xC6D4F594586ECB27,0xA16EB2AFB8D1743C,0x2410FDC2A,0x28656E428F7D2D7E,0x8CF8C940BF06C9FB,0xFE4A4ABD3D469274,0x48E2ED6A1022EFA,0xD01F78D3AA6F0750,0xECB7BC65714C2844,0x1239D17A7BE592A4,0x4054C70222A0F72A,0x3C8971556512F9D2,0x10836ECE,0xD6055F7B67863697,0x7933DA3B47ED980B,0xF82E371C0566866,0x2A4D686C95943DEA,0x44695959E28737C0,0x77C54782FAE10D10,0x54D97B4D73EB0EC4,0x26A83CEDFCEA7B6,0x6E64432FEF18996,0x848BD2FA,0x10F2BEFFBC9AEFFF,0x8028A820114BF05B,0x99D4734BC4187FD9,0x3217D5475D85E29A,0x8E162C47B55FD7AC,0x2330B75FF365A70F,0xB3C59D2A3941D25,0x47F0B5689FCFAFB2,0x34076017C0B2BDFD,0x1D9E8AC81,0xF7D31A9570C07DEA,0x8736B6A356D46844,0x90F896D7CA527BCD,0xB6CB08D363063E7A,0x11A66B100A16D05F,0x661FA4BD781E312E,0x80C8D4C3D25D91E,0x990A71C9A8EEE5B,0x6E5FCED25C2E199F,0xBE0F9FC2,0x7F4ADF7941762E2A,0x9FD90EC2A0FF635F,0x1F1F53FEB251D979,0x23E41829A422F8DB,0x2074D1B5A0487DE,0x3A774DCCF4D0C7A0,0x32C5A66FD434A8FA,0x907357295F8BAC16,0x45D0AAACF36BE238,0x1C29CB269,0x90174CA4EFFBCF73,0x4C8C7B89A159940C,0x20C168FD5312381B,0xA956C716894B5524,0x7ECE01EC39F06A4A,0xB3E07144262C433C,0x29DED93FFEED1FFB,0xF673DC9694371018,0xFD6CCA909D170BE1,0x2649A8B,0x81368A69F83FEF62,0x3BC4DFAB1E2DE0C8,0xF0DCD49845C8B4A0,0x70D04CAED9ACCE39,0x9CC571B696FE73DD,0xF1D7F046FBE35A6A,0x59AF5DEB5FC822E8,0x88B4D540E0BFBD86,0xFABB7C5297913630,0x1ED56920B,0x8DB911870F02A941,0x4C5EC5C55E14A735,0xFA98D10EBA830172,0xC5C0B2A920B0461C,0x6B3F6AF6376D8CC7,0x5EE2C46C231DD57F,0x3B04A59801AED4DA,0xD2E8D302F71D3AD2,0xAEF1B026725C82CD,0x234B13355,0x87D2283FD85B7AA1,0xEDB77029A552BE2F,0xAFFD40BEE18108F,0xB9DAA5514CBF742E,0x6B439D09026C5C52,0x187627F1051525CA,0x158725826F76E7E6,0x8F08BF078053D960,0x1D81939F3039016F,0x1A8C92E9D,0x33BB995955E58843,0xBE205E3EB0731DC0,0xBF4BA140D41194F8,0x4ABE107AB9672996,0xEDA3C08FA1D7960F,0xEAB86C917B570599,0xA3211B608D8F3395,0x7B0114B64264EF1,0xCDF1E2DB97046C1,0x1D2A51CBD,0x3BC3DFB6E82981C1,0x7F94E66511C72295,0xBAA8158D4DDBE203,0x441DBBE2B5F4E838,0x5FF7B971F0F71A4A,0x57F6CC01F01101E4,0xAA18557F9303143D,0x4A9BB967930EC28E,0xB3104823E2AE70D1,0x12E462A73,0xBA4DE2ECA955B92E,0xFFB9B2BD9688B2EB,0xC37B4C5882BFE268,0xF8BFA4CE5A0E9CF9,0xA0B727B7A6A5A78B,0xDD6C57C52EF7F3E9,0xF3565079DF8E8524,0xF6AFB3B9F2B6BE62,0x2E4063E56793CBD6,0x183EE21E4,0xD93920A1B3A6FF09,0xD22E3E9C9D5641C8,0x17C945CDA3B50618,0x624A7B8432E4F0D5,0xBDFF977E2423D95C,0x4F1FB8A123C36905,0xF743313C2FB7E6FC,0xE405A1189DA66A3,0x58947134EC45820F,0x3C8E1589,0x6557BC71651438E4,0x2A8B5A1033E1176E,0xD2CC26A87C22472C,0xD3A83B55AF96CA01,0x403C87851A97AC29,0xB5429206EC77EF07,0x874CEDDD4DC44DFC,0x4F83630546B1E851,0x67E7D4CA246250D6,0x184DF5B97,0xD90EB9D3163B04AA,0x2FAAEEAA4015A794,0x800A89BD9BC9209A,0x3B9E41BEA9C12DB8,0xC20857051E510293,0x791F559DA14AAB45,0x612CAE182E234044,0x14108B4D9A56693D,0x8DB5FA3CE3DCC9BB,0x7812FCAA,0x9A265E67093335A8,0xF749C577D4F2157E,0xAE80941E43167E3F,0x46E95C47055E11FE,0xEB13DB0341A851CE,0xED55D2845667D570,0x42518A8EC9609CB7,0x17686E46ADDE72D8,0x2331A04E78C7BBA0,0x4DE5720E,0x589291888EF6394C,0x90C09A20EF474F69,0xC96F50100AACC70,0xDD912CBB66840E40,0xD4D837E5E742DEB9,0x9AAEC8D595FC0A28,0x153E6E8CD38D6012,0x2232FC4F2347BD65,0x756FB0CB8EEE505A,0x11E92F75F,0x194FE7D68F6B1C5B,0x67837808BA966178,0x2B8236C29A26D411,0x5FE3EEC4C4488801,0x2AA19877F9E80C95,0xB3C1313C9B31A611,0x80EB0D098A3DE48F,0xD434D3A3E526B42F,0x9F0ED4B7AAD3FA49,0x1C64A2B6A,0xF4441E80EBDBA229,0x2745A94AABA484B9,0x2ECE5F3021B96FCC,0x70CC409207057444,0x83B843D95A0A2ACA,0xED4DC568518F71A6,0xDE5A91EA5293121D,0xF5CB09F3B9A6A91A,0xC57C411560749ABA,0x10FBF2955,0x8DB87EA7F8990D95,0x27A463AD90EF07A4,0x72B8DC9B99B94BEF,0x7B6112490A2ACDB2,0xD5FE841A7298BA51,0x21F0332748605436,0x11D4BF4555BA0D77,0x8865026E3E501CD1,0x45D3F78E5C594982,0x15F654051,0xB2C1D2D4E70B410,0x831BAB9D403133BA,0x16D364ED9AA60346,0x2FE207533CEBECBE,0x8A54027FEBE9CA2C,0x45394E236DF50394,0x8D48C9B07E80E4B4,0x4390FBBA23F0744C,0x80F2D8BF62800F5E,0x258BB64E7,0xDF46E86F4889272A,0xB8B928925C290175,0x40205FFAC41AE872,0xDF7B4FFB0136468B,0x45C1D4B41D585341,0x57BB0E5FB32B80C4,0xC4B557F4862DA979,0xE746DB04D084AA32,0x3BF73145F493FCD2,0x2240FCBDD,0x5A3158E34E120AEC,0x14CC75411598206D,0x44DCD41AFB53EA,0x4BD6B7C20D75622E,0x4B0499D8701E34B0,0x864704A747718860,0x2DA03B91BB8FA396,0xF4AC0D27476EE7BD,0x21AEEE2661E24889,0x254C94CCC,0x889655ED870AFAA5,0xE3519919B51AE489,0x69596506D7C58C4A,0xED176FCBF9D5B5E7,0x13246FF36D86000E,0xC387A9E85F9ED00F,0xBF1859F9B878017D,0xBC4D0788D235381F,0x84EA950BB076F0D2,0x1B6CDDE41,0x24375E6D22CE0DA6,0x2A2A150FB22D0214,0x3DC775354FA00078,0xB0922E693DC4B2D2,0x8BFBE8FF6AC20819,0x6B1E26FC03D3006C,0x4E61C9E910BB8C4A,0x1524640477A7751C,0xA21D1F693FF32206,0x345634D5,0x7D3AA4749D8449A4,0x7963D5755C61977D,0x50E0C15BAB77ACC1,0x95B302AE3A7D24D6,0x28B0CD7238471D7C,0x255334A56D74FC19,0xD8D2FBE7EDB5846F,0x656BB47FAA7783D6,0x1E2E005A4BA92DE3,0x1D40EE2C6,0x7D8D9434E2EF61D1,0xC5AFA6A253FEBEF8,0x18AA822C0C679E99,0xF75E892CD5749AEB,0xF173C07AD082C6B4,0x174FDD4949A78146,0x944D89A9B7A960A3,0x3CB97D2A7D490D44,0x5D3D8B4BB414A68D,0x140D317C9,0xC62AA62B307C5458,0xBAF17AAA1A0D0726,0x7B36CEF93A5A14A0,0x9B21762371C6126F,0x5BF5CEC368383A9A,0x62F5C8B7CEEFA4F4,0x63766AD2CE010531,0xC3E59502DE5F000C,0xCA1C052F5384DC97,0x6A1CEEE7,0x17092C9D1F02C3DB,0x44AD5BB1C9F7BC41,0x17DDA74B086ACD11,0xD1059854F4A87768,0x72E7AEBFADD58163,0x2B689A695F802781,0x45D958E49DA6BFC4,0x879B022EF537ABE7,0x625700E3238D36ED,0x153C37AC2,0x42B205118EF0AD22,0x73555328C460B804,0x45DF7F2F4526C6EB,0xEEEFE6B08675A1DF,0x66122334B82C8BC0,0x418CC423A9E5391,0x6949575C1A6595E9,0x275EC7195902F6E0,0x383FF83B51D963E5,0x186E534F5,0xB39937D589DB18F8,0x72DFEEC455CEFEB9,0x969D84168C483BE6,0x8521564E21BD6F6,0xEB2FA70E3DE87E66,0x3355FF9CD0DAC383,0xFFB8A207A4A71348,0x329B7263C277807,0x7B1A40B8F59E550,0x23F1BE2AF,0x20A23A87C677B2C3,0xC5ABDF5DA43F8624,0x11E81FA119770BF2,0x9D5243BCBD125F71,0x8842B1465468B62C,0x889CA9FB9419A3E4,0x6D4610FF03419298,0x18CD7BB9D3EBC696,0x17894FFFB46CF561,0xE1AD4FB1,0x8F8CEC875E2FABA5,0xB3E5FC6F71C68D20,0x48A8E357A5F9AD62,0x9164FBAE3F20982E,0xE9E845E00BE8D92F,0x1F8438B6652977B1,0x8C5096BA508E485B,0xE06C330C9461C883,0x42071EB604B5C3B7,0x14682115E,0xDB0AAEB3A04A1455,0xE3B55613E668ECF,0x4D640F617007CAA2,0x8833DAB3FCFBCDF,0xC97639BE18A292F8,0x54E2FB6806639CB9,0xA75F1E516EC12714,0xB5BFB3423EBF03E1,0xC76AB8623B5283B9,0x2E8E2373,0x4858C56195F2330E,0x985D87C267D623A0,0x868B81189EE857A5,0xD64A93E5A7449532,0x2B74A28377B8E24A,0x8C725873F52C3199,0xDA61C538EDA9BDE2,0x6F97EE4065D4374F,0xAC9951F85A2C3B14,0xA94AACEB,0xC512D31F3576DFFA,0x472574EC325A5869,0xB95915CB81890206,0x74A4F1E9E2ECE229,0xD15B4451E717B0D7,0x4783CBA2F259182B,0x1656776838351965,0xABB19F7CA5D61780,0xC003B0133D184B9C,0x74AF4141,0xA2B47546ABD36536,0x1CF723F45509BD2D,0x84FD5F08CE0980F1,0xFF67667F09043B3E,0x2BC8A1921EA3811C,0x3FD8AA0B0B44F8B5,0x8C66E3EFDFC234E,0xD90E576885320735,0x6A3CF58679A2D41,0xA59DA8B5,0xCEDB1A62DFFD3531,0x49CEE677AEC4DDA4,0x65FA61B10C213592,0x8ECF55A4379E0C30,0x73CC5687D6A119BF,0x3B7FD917407B5B78,0xA470D42211F388CF,0xC95A47BDB128CA56,0x9F939B1561AFD7AF,0x1EC5E36E6,0x4FADBCF3D46373D2,0xACF0818CF517598D,0x9E1873123158EA13,0x22FF03A8960FBFCC,0x1C676C6C6E00E39F,0xDE033692CB3169EC,0x50DB58569D780811,0x1F8D6C5CC4EB342A,0xF9464F6016FA54AB,0x2226A7D01,0xFB070ABF0FD961FD,0x35CFB6E1CE9C5CB,0x9F6977E8B0FCA9D1,0x7E20E8F76818F577,0x39BDEE691BCA77FE,0xA9860A7DD9663713,0x863EC98556A39213,0x8B0D377907D334CB,0xAF77054035E788B4,0x2312786EB,0xC5CD4FFCFB2446AB,0x4DD1290F346A2C54,0x5957B49503C6B902,0xCD4BF1A7548534C5,0xE8983D90A8699F06,0xE895BC7061008F16,0x9FCD81435A08220A,0x4F72450FD4527353,0x9612FC6299517B67,0x27A4EA2CD,0x23C73538D24D3992,0x7E3CA196015E6B49,0x54B32F6102136CF,0xAF56EE97AE097839,0x35CDA1F486278A3F,0xFF77C2F65C2BEE7,0xA8AC6377A631DBF6,0x9E540DB630B597F5,0x6AEA066299C9DD3D,0xECFFF37D,0x5B0CA07A8F623DAC,0x1B4BC7D2CFC62C7F,0x88FE5B3EA9C10CB3,0x97F1122C2EFB54EE,0xE4F2AA0717127C2E,0x272E383557398D73,0xFC586A60D1CC7403,0xFD99E9EBE879307,0xFBBE439383FC692B,0x21E3A0AFD,0xDA1474C4F6E358A3,0xA4CE91DA6E38712,0x16FC222E958F867A,0x581B1E377B90B98C,0x186E2BE108914D9D,0x56C692935F771B4F,0xA00D24747618F844,0xD5C1478BC875CE55,0xA623E098500D9401,0x25517E32E,0x666BFA52467CA786,0xDCCA6E181967E7D1,0xBCA1537B72BC1E1B,0xE01A805A52505D9B,0x1C6684172B23D13B,0x1207CE5A77146A95,0x28EF26E450494090,0x7548D72E78D3F052,0x4EF536E778819891,0x1AB26C14F,0x75B5D6EF32458CAD,0xA1EE3A133F9CBDA,0x1551AE63C255C7DC,0x9881DB91C1EABE6E,0xE53C47BD1BF193D8,0x416E7F996C57FE6A,0x6E0AFA5E2B5C68C9,0x14A6FE2C6C86FF1C,0xD4E13CED2F4736DF,0x1FD79698,0x4DAED1E4AC082D56,0xB33119B45DDD023,0xA0FC3D6D737B3103,0x3B8A1FAE8F45B9AB,0x8D9CBE290443E8BD,0x7C9DF6EAD118B4D5,0x2BDDFD7EFE6CB127,0x2561B7F551D8352E,0x75EF9D8CB4A2716E,0x12C73ACD6,0xCC2CE0E9206238DE,0xE2F00D3A4EA757E9,0x794470E9DEE4E400,0xE0D6F678DB70B907,0x807B791931C560E6,0xF0D3BFD723D7282C,0xF62318C1E63DE297,0x54DC7EE98B247048,0x6FA5EAB066DB58FF,0x158C03DDD,0x7AAD4D68A8145BF2,0xFAD0F1917E263B0,0xA3091FD13418A18A,0x4811A8D21016761A,0xFF5D80535C943338,0x531C17D311B8BE47,0xE9C2E27B6F7788AE,0x98134278087C11C3,0x343836A1EAC366C1,0x26E5915C2,0xCE5B4AF2B695F16B,0x289D3EEF1E3FC608,0x11A1F7762AB4B566,0xC9B5098429CE9F32,0x629D9C52553B1EBA,0xAF5750CAE1CF7403,0xB2D476DC39AC5A8A,0xE27BD2DA4E60703E,0x8EA2F6846E7CCEEC,0x27716825,0x43DA3A2EF696097B,0x2157386D1B0303B4,0xFA083050CA101C1D,0x913F5307037658C9,0xF4788107589F9C5A,0x1BC6EB6B2C9F5EBB,0x33BA86D3A04CC73D,0xF43FB779C7970581,0x7D094FC88EFDE936,0x7A3E8169,0x139CE1E72EF5592D,0xF9B3AAA2430DCFAB,0x5084950D2DB2AFFF,0x234D4A8F3E8AEB7,0xE8468D240E6F6B37,0x6B2D8C013DC874EC,0x9869D0193CF487C9,0x5171A95088749C2B,0x6DE18EB10CC9E2C6,0x4CAF514C,0x403B10524420DD81,0x593E75067F3A5EDD,0xA775528D4C60CE76,0x776067C9B279BC0,0xD6B0D266E6292856,0x81FF4D43F2C8A7E5,0x32E85F16C05E4F26,0xACF6D61C72C818E6,0xDCC3FD2CBC4F46D3,0xDF92056A,0x29FD741499C9EE7A,0x8FB0BF4F8AB04E12,0xA754D8BECE82CB1C,0xBE81B563BA76814B,0x7F5EDAA7753E8B83,0x3FF77AC9EE076715,0xD6E3C796A12DAC5C,0x33B0CB666C4F2986,0xDA824623AE997929,0x1652A5C24,0x3D1040EFEF30316D,0x8977AA17E9E7D456,0x1F9DFA6B977BF942,0x6417B314871B8A9B,0x238C2DD5008A1C7,0xB80428BD042E4528,0x663DAC468A64EA71,0x7FE38FEA4D5E397A,0x32EA22BCDD69384B,0xE020E300,0xA50F3C2742F59FD5,0x141A2582699E9748,0xA60AEA9B08F8364A,0x35720FBAB7D92069,0x2E6326CF8089FB96,0x8F06E2152E3342CA,0x95AEA9E5E0FC2FC1,0xD4FCE17D46C14AB7,0x78FB934669C6F230,0x7B7F4F5D,0xEE2598BF4BB93A57,0xF53BC1D3955ADA1A,0xC6F19A48878805A,0x99768624A7248FEE,0x257E7F19842AD8DB,0x12755E17F1FB8029,0x721F7BA50E4F9B0C,0x54C2E12FB9B911B0,0xAB6F766705C4B894,0x26006DE4C,0x2A7A0E85078F5751,0x966F5B03A1DE48B7,0xFAEBD88732975605,0x6ED661B2741BFF61,0x97F193F611909E42,0x8BE67521463F5EBF,0x6FEDD48F8DDDC779,0xE8D75D0376A88566,0x762A71477BA75BF2,0x191AC6217,0xB73C91238F3941AD,0x3DF56DDD8A4F689E,0x1AC16E1BB1CCAF8C,0xF93F15BB0969C875,0xFCB917B64980E758,0x43D736C276F2CE07,0x1CF523341E2B2EC5,0xE861839EBF260482,0xC31B4D2553564C5A,0x7F868663,0xCD216911FF3ABF69,0x68A24ACE33C52C14,0xB99C3B8C2F90DC6F,0x72B47DA21AFAB13D,0x8EF018F604A23426,0xECBAE38F6782E9A5,0x5740678261547B5A,0x761C2ED45FD31B4D,0x82E4C46FABC1D596,0x1FD9F6788,0xDEAF709A7880F0A5,0xCCD7C14775E6C0C8,0xCC05FE3BEA0CDDD4,0xD6CC3402A6D42411,0x1091D684DD1CA51B,0xCABE8003161BE4B8,0x475C3A644F2012D9,0x8C08EA8097B7D7D8,0xEB488AB8C2C81531,0x96BBCF4B,0x7E992846DB254A09,0xA6210613E21CA958,0xA8D0CD46331AC6B2,0x2EBB39DFCC0BF372,0x48F6D2894F3AD5A0,0xE783F98AD887F2E0,0x7C2B50CACD91CB36,0xACF7A2B211C589EC,0x13985EF315E51359,0x1CC0AF9D3,0x480D3E81BA53C470,0x43FF86F4F1A059B8,0xB638C1E9D0A6A40E,0xF3E7AA9839E16DCB,0x3A568AD9F27CB87B,0x311F01E83FF8521D,0x45569D0FB5869CBF,0x1D0B46F4B7B01055,0xB03F2E3C94641DCC,0x258336B27,0x2FE73BE699315B0A,0x8C463F086CD6C22D,0x43DF8AF59269767C,0xC67EE98494510C48,0x81EDB1093800060C,0x4517557968147BC,0x3A8BCC72C17D779B,0xF1CD0E3554FA88AB,0x80689FBD9E3AD27E,0x23091EDA2,0x3F433DD63E5FC3C3,0xC74B667D43D9A4AA,0xD7BD2F8B3418D03,0x55E8D7167B1EC58A,0x88CC7761400D6309,0x6301A15B42E8ECD7,0xF1A1007D15B4E2E5,0xDF7AA9088280F9E2,0x216672299FBDED66,0x2198EE603,0x4C7159CDEF9F324B,0xF6B3ADD04FCB010A,0x408C88F6574E1C18,0xBC804AA39063FC27,0xD3BC226C56AB561,0xEE25456E657BBDE3,0x28B12D152C001C69,0x1CD40EEB40F829CA,0xA91912E4EC98C3FC,0x1E91F08A7,0xF68F564012C49051,0xCDAB1B39407D037C,0x2D823D2B1234C6BA,0xD84665BCC6512CF6,0x6EDD4F4C6C2E1E1B,0xE167D932DF294145,0xB1923C2EE30A73D4,0x8C1BCEEFAB70CA1,0x17A98E19117D8CB6,0x1B10E3FE2,0xCAAF0702020F69B5,0xF044C71134766C1F,0xEB883E254ED470DF,0xEC552846A0D1DB15,0x40888BBE3425B7DA,0xB4A3477046FB7F15,0xEE36B6C101F72B2B,0x9020C0711D7BCC3B,0xE58813106B4AF359,0x535A9F3B,0x7392B322972FF610,0xE3668E9AA15D2DB3,0x7B2DBD0180906142,0x9E84CBE8AD83EFB8,0x466F7CAFBC2841D7,0xE82A6B590BA53D38,0x2C71C31CAE5F417,0x2BC16583F2F1109E,0x6F57FA38B2E8DD,0x19346F545,0x221F84E0EBBF808C,0xE45D9B644ADDD3A4,0xEE8269B09415C3F6,0xE07D0438940E73E6,0xBCB19C0838D26028,0xF5CB7D06A344EEC7,0xD261B671D4C98A5D,0x565523229CB6B4A1,0x32ABA3E4C947B88,0x21F384F3C,0x6C8E3E762942AA73,0x49645D8B8A2DC477,0x785BB381A29D495F,0x188D8C503B5DF531,0x14246E445CD074A0,0x9169EDCC1F69F769,0xB8178F2100C57DC1,0xD874B6209A9EABDF,0x7A99FE6BAF403E24,0xE7BC0845,0x2D61E18ECAD81F4A,0xE741BB6131D32182,0x1B5F15275AD5FF89,0x800374375D1CE341,0x20113A7CD1DDAAF0,0xA5B7787604F189BF,0x64E6E90BE1BB5352,0x4344ACC14D532155,0x138B929161BB508F,0xD4C69655,0x23BCAFD93B75CF05,0x69FEF522C85ACFA0,0x81D598569D6167D4,0x96A5DC50A00EF8E5,0x602FD7C992575F74,0x67EB0B4882B2655,0x883A263A891253B3,0xAAE88A2A0F6BEAA0,0xF9B055A2BCD56DFE,0xC9CC6223,0x3A7A683B4B0CFAD2,0xA36A1CAD6D62DFC2,0x178BD1C7C68EA7B7,0x17669F068B1D6775,0x4B5E810D770CA3AC,0xB7DE7A1D9F25F898,0xC38F44099C4CE3FA,0xAFA359F0DD1E6392,0x34416D3DDB72B34B,0x1832A34F9,0x48C332259C81D7FE,0xEDA8F09A62ECCDAB,0xB18B72B623023EE,0xBC7638D8296D9F29,0xF34ED95B3184D5,0xC62C9E9D15E7D9ED,0xEBA342A53BC21FDB,0xE3574E109362CAC7,0xCE8EDEA876500688,0xE8887FE4,0x4CEC8A52CE5BC7E8,0xB5509B2911DB126D,0xD58B80B7B45E7F99,0x41437ED33080191,0xC57B319F80D83C72,0xFDF268BE16396404,0x9CCDB696E04FC20E,0x1AD71204BE41507C,0x4C0BA1F992FE7113,0x13BDC66F4,0xD17AB6B6DE000725,0x5B88B3410C491444,0xD9455F878DB71B4A,0x9C32B78FAC5C542E,0x42CFD9495405BCD8,0x39D36CC95277ADC4,0x169A3B19303C81B3,0xD0449DDF94F77D06,0xAE5B2408E54DF053,0x6CA0F8DF,0xD0D3FA56238D7E1C,0xF17E75AB2AD51CB4,0xE49F6F39E5A5F830,0xB073F3BF2DF9DE40,0xDF4F7416BC6B748D,0x56526E0138D2021C,0x5DD16652FCE6A5F9,0x4EF1B488A89955AD,0x44A8735535FDE568,0x11F94E80E,0x7304E952E6DBAA5E,0x3DCC2736324493D4,0x9A85FD3C8390ED9B,0x8672B0D4BAD04DBB,0xD6AFACE823843734,0x42F35D920EDEBAF9,0x179A358B32E49D15,0xCA4B2118E589A4C8,0xC08CE474AF7D2202,0x4884C9D6,0x547C48F1A6841119,0xC42D0566080E593B,0xF9491775A0C2614B,0x221F9343B3C3DA35,0xED6ED4D5987C5D77,0xDB12D0392E142F3C,0xE7266F9A166CB871,0x23AA451C3AF08A5D,0x4C5EE2D885B07357,0xA2DBF590,0x238589D25F69CA53,0x8A4F0933EFB5E217,0x3AC0F9A0C41A212C,0x19DCBE1E612562D,0x4180CFE4A0C78208,0xF94A1F7BBC8009B,0xB8B7FE8BB819F762,0x18ADE2237D2F5B0B,0x988A83B11D97E72F,0x3802B3A7,0x3312A9E154134C21,0xF5EC3BB4AD65712E,0x365A78ACC213577C,0x3DCFA7EF2C36E83B,0x8E8918F9364BA8D7,0xDF2D045DE6E45C3,0x78E0340610893920,0xB27214E38F9ECFE1,0x26064CD1B67B5B17,0x12F6DBBF1,0x20A8B67B31A80407,0xCDF7C029C2948096,0x65DF2C4B22921901,0xABC7C879B0E227CD,0xA5AAB378F4585329,0xDBC359F3BBCF0FF8,0x9FB96661C6D69C80,0xB2AF99B0367F91AB,0x827C9B7A11F84DAB,0x26EB8A977,0x4D5E2E339C80CD52,0xE85707F176CC4F78,0x9C375486538C23F7,0x3E3C33007BC5DD06,0x6CE69E6E16B57692,0x105BBDFC945329D7,0xC8A4E3312AB59C00,0xD4CB53EF0AC12276,0x9C41D836EF93B376,0xB58500B5,0x9AD971AE54524140,0x47EBA6FE168ECA23,0x5958D2B17E29E2FF,0xC157FE88DE5E92DF,0x2704E6964003B0F3,0x9B99C05A5CAF0974,0x748B260664330A23,0xE2A3DD272EE54575,0x216828707A0757A6,0x16DD467EE,0xFE7E38539EA11ED9,0xB9D4B63E16764363,0xD367A3564F973E65,0x3EEF5DD7FFB8D335,0xD7D0D6BA70DBA425,0xE447A31584525BF7,0x41E2D727A651D2A4,0xF7E5FEE6605D133A,0x409922712473D435,0x22D37AE5C,0x19E8E7C1703748F5,0xEFD4C31505A977F6,0xDFEE5EB827CCA87C,0x70124F0BF9717C3B,0x60C3AB1538292A82,0x7180695E9E80AF7E,0xE942BB30BA97A804,0x59390F0BF4BA6E26,0x1CBC400C8883DAB6,0x25E2B913C,0xC0E26464D3C7B912,0xDB6A42EFBACD501A,0xCDEE1D1D016BDB75,0xC218200976A447CD,0x901B883F443BCB1E,0x4EC8C43D0C5AE845,0xD30625B375B7D0A0,0x1061CA819DF0F757,0xE0EF16DE19F8CECF,0x1FA560F2D,0xA2D6EE576AEB091E,0x8625E94A0F5941C8,0x6FB2FDAA8A23BC07,0xF557F14FDA10AB6E,0x8AC13E007B4AD03C,0x27A5183D426B15DA,0xB44823CB6271C3A0,0xAC82497BF658AE43,0xE214E73ABA1F44F6,0x1996ADA13,0x2ADB8112EF30A2EE,0xB3AD9A1BFDC131FF,0x51F08739800DB34C,0x7C8F2414C6ACEAD6,0x4B120B47E246621C,0xC630C2EF6F344E5E,0xDB213D8B9CEEAF5E,0xD0A22EFB78B1030D,0x77F9404BF9F0349F,0xE8866199,0x358E9CBA9F96C81C,0x1BED396AC1CE4BEB,0x77F43E4706DE7E3D,0x40FC0F02046DDD15,0x5888F1618CC2BEEA,0xC38457B52B176E0C,0x181DBAF2FA4145FC,0x8B8A92479D8F100C,0x55AFED406729B22F,0x1AF06CDFF,0xB904DBC1909A9DAF,0xC60E02B2B3556096,0x6E091C36430615E3,0x12463080B44B0261,0x30EB649078D83038,0x137F7BD95C948AB6,0x4460F8484CD49E23,0x7F09EE77FA542B22,0x565670BEFB9D207C,0xC67A3DA9,0x86054E630B94098B,0x979CDD3816044CCF,0x40340A22BF84D732,0x927262CB29C2BC6A,0x3FC3642A4C7FB1FB,0x941C30C5F73F03C7,0xA670A2040816F009,0x5A69D9FB02114B1E,0xA249D9B058256808,0x75E66243,0x8F50F0371CE36B6B,0x798D939E19DCCF5A,0x40925842B99E68EE,0x6262F4FC31DABD0C,0xCAABDD7BD360409,0xC75268EA04469A70,0x3590D5D60AF402B7,0xF7F0DA78FBF8419A,0xECACF038CC443FA8,0xB1AAF28B,0xCE2517537878BAB1,0x65E912898E75BF10,0x79C085C91AF25826,0xB2750B31DE82EF88,0xBADF2E9416236BEB,0x111FD498610E9849,0xD62D7000E2431A83,0x4E37CF9A00CCB843,0x503641C4A89E84DE,0x1C5B16730,0xE6A04B563102B178,0x7071A4A1EA814286,0xA2196FB479AA68F9,0x4B3121FA65BEF466,0x51EB672A54DACE1,0x6F5F7C9D814BB427,0x29E9E2AE09C35630,0xF00E7A3E3682B9FE,0x284EA3D8BDD10F30,0x5226FD2B,0x80EA6DE4DC891898,0xC57BDB9D9E1CC476,0xAF2623B7F56F77DA,0xBEE7A02026F91625,0xE98592FFB2167EDF,0x808E0317E0E619D5,0x24EB7E34AC462478,0x5075157CE9079D2B,0x952CD6407BD54FAC,0x8B2C549E,0xD996A249BFA81D1A,0xEF8892A0C6258336,0x5E1F1DA06E29299E,0xB46FBB43728CEF0C,0xC960FA629BC8A47E,0x1DFD9A3E9FFC4672,0xE3E23D274A4C840,0x2D782CF6F86FFDF2,0x60C042636D905CEA,0x47D0D51E,0xCAB074CFDA5EDF31,0x1DFBB3CF7EB64AD4,0x524B2E57514305F4,0x86372547A1E950CA,0x49358EB7EF4DA1A5,0x73280A1F6BEF2BDC,0xCAA364A8A5583BD9,0x1E215D8B241B18E0,0x18972C139961A8BA,0x170038265,0xD470EB4944213FEA,0x29AF066194D966DA,0xDD587BE1676BC4C1,0xCA602108E8346FB3,0xFED84D58C3209A50,0x8FA752F2F710A091,0x33A348F9AEAEFC30,0x35EC69D32F3D9115,0x71518C5FBEF4E2E3,0x24D199BB7,0xBC51210A3872532A,0x340F212CF039B549,0xC08A7A59EC916B7,0xADDD55ACAFDD66E8,0x7C4F012ED7886930,0x2CC4813AC19636D1,0x94665B13F7E7CB6A,0x67FECB02728B2234,0x68E6996A13141FBE,0x1D017F2B6,0x6C0E81BAAEA741D1,0x732245A3D4DA7E0,0x3165B5B187F8AA2C,0xE26952CCA90A5C83,0x9F1171C3679579DB,0x4185196EFCAF1B36,0x9367BD560BE31BE9,0xCD136A994D3D15D8,0x73079C255FA1147C,0x19DAFBE7,0x8AE5B43C2DD691A2,0xC76CA8BF9E68BAB,0x71997181268D7FDC,0x29C08D222422A41D,0xA41E38EA8ED5488A,0x94EA2B381432F303,0x9A79E03E5C930AA9,0x5EAE50916AB1827F,0xC1F8514B7C1BF092,0x1FA864A75,0xC59762E6CC090CB1,0x2F9FADA93ACD7C69,0x2D9ADA4BDD5A9286,0xF7F2739F27E86659,0x31E74A45BE1C1FFD,0x2B65482B20377791,0x834654D79CB87180,0x8CBD0A641C8BD9F,0x914B48ED2460A60C,0x146C9BFFB,0xFD1CDF0068DDA489,0x8F554B70C8E84FBC,0xFAD6D7BBA4E70001,0xD26BE882E0809FBD,0x43557264BF1AB97,0x478294F531ECD92B,0x95FD0B34DF44B33D,0x98A4229022841595,0x76B2CE41092688F,0x1BB4C7554,0x4946EF31BCB12061,0x97A0B68A57D55805,0xF6F8E4F3E9B8F0FF,0xED5B039D1EEB08ED,0xE17666CB7BF45F49,0xBBE4F83708761B44,0xB559AA54F8C8DF52,0x70E6A54500F5808,0x96F94843EEE6B8AB,0x3CB045D1,0x29FD9BCD93CF2D6D,0x31E1BEF332980F11,0x74F2B0A4F6BD13C5,0x3D630ADA69A487CA,0x36F1980D41591BEE,0x853726AEB81ADB9B,0x762127D5731EA8FD,0xA85783285EB303AA,0x38CE683A2E88F010,0x1BE6D3579,0x6667E9812491A6F8,0x3F17107418871210,0xB88C1860AB680B81,0x4F26CFD49C5DA76,0xFDFD45240141E6A8,0x692631B0B0D7A16B,0xF162B3523ED27ED,0x5BD0267996EF3BC4,0x38E274F7B83731C5,0x17AA317E5,0xA216F60087012C1E,0xCA134206F58253A6,0xE8AE0B66D70EB0A8,0x4437A1AA467F8DB5,0x13D5F1DF068C6C16,0xD800E9568FC9F2B7,0xD5489D5714AA0CF9,0x74BDFA6A5E1C5304,0x39A29A4131E35518,0x22E87351B,0x9575C6D72EF5169C,0x310AB48310F10C64,0x3364CA86AEC28B0A,0x98BB1A06DA927082,0xE34E349300C0D5A2,0xCF62CBF6965F8391,0x4BD9514E5608E02D,0x78AF573BA334BD33,0xCEA69ECAD54E77E6,0x2537CFC20,0xC676A611B4CD2C0F,0xFDDE3EAEB098F5A3,0xA9EEB5F9D9DA6F77,0xD2A32C80EC229A1D,0x4255F57315EFC79D,0x84F69CE9507C58CA,0xE6B00C0AC832F2DE,0xB6E60486ADA2C322,0xCABDD59FC04720B7,0xCDF72DC5,0x2D82A4FDF521A545,0xB52C7A112695E074,0x3743FD7B06AD6D60,0xE01C361935C58265,0x8A695749DDF68E6B,0xCB992019C0249D0A,0x83EA434C1411E12A,0x6908BB45EEE3B032,0x2C0CDA3CC3B5189C,0x3BD6EFD0,0x6E409F3E9FD5841A,0x1DA44C742646DB5D,0xCFB958664B101691,0xDE0E026D7A5CB582,0xAB5B38B485EBD4C4,0xE8C234A0D664C192,0x27CF208E633EA870,0xFE7E99FD8798FE0C,0x75EA693BBCD3F8A9,0x2208FCA6D,0xA938A25241D40C09,0x6F4EDD28D44B5B49,0x2288A000DABC83FB,0x9BAD8511113216AF,0x9359920B538F9F3D,0xEBD2270A22571A66,0xAB833ACAB2181C8C,0x9BF5E19B0AECC188,0x59F1E5FE48C1ED9C,0xEE04FFAE,0x12EDD24383575C69,0x9ABA336666FE343F,0x18CC4568070AA72,0x9B9D32EB5174B17C,0xD5E3D8911B22927E,0x8CBB9827837FE982,0x97BBEF0351AC25A1,0x20926287B91A384F,0xF3063280901CB488,0x19124BF63,0xED0E08720F0A70BA,0x9D897AE7E2CF24FD,0xC131D493EEAB9398,0xCCEF4B5B0B6FF523,0x8833908AE73606E8,0x8CA6672EBD3E25FA,0x48255B7F396F2F4B,0x5E022A125C49CC3C,0xE76D42B898751BFF,0x12E1C6FC2,0x4C1AE0018320A423,0xBB347F2E9771635C,0xFFB281D26A41C629,0x62B53FB4D73EB727,0x4F57DC3AFE6219C4,0x45C4A3338F6FAA90,0xC499DFF4D84E44AB,0x3B028A7C1BC1591F,0x363D9BD9AF34B2F2,0x1FCD58694,0xD9CD6398476712BA,0x834B4AFCF2F1B23A,0x9926B8D53E5A4285,0xA033F0DB25332DDA,0x46BC9E6DACB42717,0x5DF65AC6B2256815,0xF70A29EE6F4EA5CD,0xA135D2937FDB8E0B,0xCE6FEE1AE89008EF,0x24CC8CD63,0xC0E6907705E46CED,0x9D5C9758E7F6D26F,0xE5604B319F991E45,0x5B27669C2E4EDC2F,0xC17DF636104D3766,0x313E86AFEB1EC299,0xFBD16963414F4077,0x7522837A2C99761A,0x76AF75A46FDD1F4D,0x436647B5,0x8B0CFC44832E9859,0xEB796BC3667C4808,0xB30EF51A87000F76,0x83565C9F800C9849,0x523D347E1DEE4B4A,0x4FA8BF116D2530ED,0x7A4A3FC753010FD3,0x12AEDDFA737C116,0x87767757EA89E666,0x19D415D0A,0x713B6DD16F040355,0x94E158F9E37AF7F4,0xD4A16C5C4A2E931,0x2C556659FE01F89A,0xE0F66C92A48A0598,0x42C3F2B8E80CF0AC,0x9FAC48F6D596C634,0xEEC9A18F0A8D08B6,0x7379DA93F3F66C61,0xEF2E8F2D,0x26EB194FA743055F,0x5D1C5ADBED7A57D4,0x65FFC5845DAC7F11,0xFC67CCA64ACE45BA,0xE59EB078D0CD2B85,0x7AB7928F52B267D3,0xD6EBF634DFA6A9DF,0xBE2C11D42182C78B,0xEBB29DED546B0B58,0x9126960D,0x95102ADF53E242D4,0xE6FCDDF70221229E,0x5E09A70DA1D3A130,0xA430759F37E92BD9,0x39E0D91BD43FCFF6,0xD686D1F149E95FB7,0x6853A7F6F3DA94D5,0x4E1B44DDFB4444D2,0x73A5C14C351E7681,0x18593D9,0x79118AA3C11F2018,0x9BC0CD50F8FF2E57,0x25D664BBBC3C6869,0xCCC62B3770DA0736,0xCCC10C3185FF1A4D,0x22864FD39875C06C,0x57709A0579919A8A,0xE98C9F45DE50A1B6,0xCCC5BA554177B87F,0x10A05F542,0x808B2D0B551D3870,0xE5DB56BB21FDCB7,0x4C8C7A5089A41EC5,0xB1BE9E4A178C643C,0xE516250B2885AA0,0x8F679974D1C16732,0x99A14866FEE1A23A,0x6A37DB14F03B2F5E,0x68E7CDF9FE53EAFD,0x33B06B32,0xA791C9F3DE25911C,0xFE7624A0E3B71778,0xCF8A9B52F0AF090D,0xFE0B17785C57843F,0x92020C2A96D22BB0,0xBA5A8F4966085E81,0x2771EFCD7B031011,0x99D4BF809917D55,0x3C389E9A51CB2D2E,0x167D83964,0x18B0A16882F181B9,0x2360F123E964ADB3,0xF95A3868AAF293BA,0xBDE3C389A641080,0xCBA6FAFBBC43D232,0x360E720FBDDA4A,0x31C2BF7C1200C6E0,0x10F2E5C6FE2D358A,0xFED1D15FA43DE5E6,0x263355813,0x121F737D9ED603E2,0x5D17D29A0D30D514,0xC459149013E0523D,0x8BDEABBBE52678,0xA289A3FB069E3728,0xEB5190824C5FC7C6,0xD9E2795B478083AD,0x7DF53746E294315A,0xD622F1E46F7321A4,0x15F988497,0xD9BF63A2E562AA98,0xE6BE5E9F435B6C15,0x31BBF21490AD3029,0xE9A3DE6F3CE53218,0x1F59FC8556DBD206,0xAA562E71A59CAE73,0x16783E3FDC5C7681,0xBCB7CE820771C921,0x891876E0B16EA075,0x15379E48,0xBB6D38CF9B6F76C2,0x455E19CC5A458127,0x77D2FE994A6E285A,0x38FB4528C86A9FDD,0x4D33D296C848114A,0xE2354D688558ED1E,0x7753EB81717A1804,0x1FB16C9942954227,0x1C998C2D1FF78CBA,0x24F679E10,0x3F0ED410E9492322,0x5BD1421B0A654E11,0x22C5B280F113C388,0x7E983A1C50B0346B,0xEDA09CA7219F7BD9,0x682358AF5AC77731,0xEFFF63E6AAC2420F,0xBB5B62E86566DB3,0xD408FE565CBFA87,0x113DBAD41,0x4B8DEAECAE2F4904,0xA37D7DB5971FE46A,0x2D83B42C5DDE5B45,0xA87EB1B697BF5DF,0x5C4A2E6F0DDCB874,0x6056344C31982C21,0x771BA8EB0C950084,0x577C78B3CEFFA672,0x4D384EEACD307358,0x1CC0412A2,0xF9B8BA0AF5D0FF6C,0x52ACB9DAFDE2C53F,0x37A9B262D776F442,0xAD3A0E99823ED960,0xADBF7D621827E9C3,0xB7B1968FD88308B2,0x5F886B916A050EF4,0xF201A8BE96FF70D3,0x1BBD953901AF82FD,0x439C78ED,0xD32BED04B28DA6BA,0x6A2646E5FEAB9928,0xA1561AADBF3D3941,0x2504CE3094592AF,0x109AA1B3FAE2BCE0,0x3EAB006E5A3D8135,0xC42A04CC1F2AF8DD,0x13A144D513D67F3B,0x99EE3E7A992F7DBC,0x15A14C922,0xCB466FC640B154FA,0xB0322EFBFE4C5744,0x2CC3B0536FE1E7B0,0xA485F0ED8731459E,0x12FEEE216D6A690B,0x5900E2DD3C7EC6CE,0xB0B8BFC91E876AE8,0x8CA0EDA8268DF9D4,0x737885AD802E6FF2,0x14D671F83,0x27E465F1752F8EF4,0x9D4BA301E24F3B2F,0xA1958AEB86B5ABF6,0x7E0EE7202EA4928E,0xBB86BED770E527E5,0x4B80D4F5F257F86A,0x6FC98699738E21E4,0x7D8B10573628CE,0x5C0C2783920234F9,0x13DEE4848,0xCAE4AAA7E850AD33,0x7F3AAF0114295D5,0x63DD005CC4B45D41,0x6E56EF37950BD897,0xD203F9195C771EC1,0xC3A92204968EAB4A,0xC83C50A3C2780E99,0x2DD13B4B143EE84E,0xB95C977BE5902336,0x1E1C87F51,0xC68EDB6A0BF080F7,0xD868FDF2BE5EED3D,0xCA4486FC00A9E36A,0x74B9EECC8B493DB,0xE721B15FF6CB6A68,0xBA1C4041A5AED53,0x1830E890FCF935E3,0xB6A314386273EFC2,0xDAFC353B96A64066,0xB8D80E5,0xDF26C326F6537E,0x2465B0CD1AFB99F9,0x51B7ACF0B634568,0xCC6CD7D7724ECC6E,0x5A12886D83B04776,0xA1439EF3BC9BECEF,0xA4B970E297CEE1A1,0xC7717DFF5EB850A1,0x45C29EC715093746,0x219EF507F,0xCB34520F552F39D8,0xF401F7163533EC1F,0xFF1D2EE5B946F3F1,0x56BC5366D864D093,0xF53AEE0F9B3F07F,0x5FA7F50042755156,0xD9DA876C373AD5D5,0x4EEA0832A19FC7,0xFC8BB11A307917A1,0x21390E2A1,0x75818D1BB324408,0xA2FC950A00814343,0x3108CE8A3D9EEFC7,0xBDE2D35ABB1651B1,0x8BD2FBBDE0173B2A,0x738B7604DAF2448C,0xCAE88C0009E0A2DC,0xAFB2404E25E02FC6,0x98CE744082E40F70,0xE535BEDB,0x466E31E3EE00B6FE,0x2693836E847F1F5B,0x3B17CC068347371C,0x931DE2E678780A38,0x1926B99C99319938,0x48F66BE2C048C36F,0x836E71688D760C56,0x4439E1BF751162EC,0x16E49012F4FB2E29,0x74188DAF,0xF75F502545124F26,0x12C63E9F829ACF5E,0x88163DE13FEA9A9A,0xEF7CB0261B098662,0x2FC0C9CBAB5ADF27,0x9EED98072EDF4A9F,0x23BF4AB0405A28A1,0x935D9F5A515CFCF2,0x585ACBDF3FAEED1A,0x12CB7D1CE,0x38B0F89D7B51A2C7,0x79C2781F4E764379,0xAFB2C1443AC499F5,0x529DAA9EE77768C4,0x6EBDA8137DF95673,0x413F9C4BAD10405A,0x2CB7CC9520020B88,0x1D0F90AEC06113E1,0x7324D505F90B9E8B,0x183339090,0x6F8099418A3ED042,0xBAB1641879097B87,0x5852B9AD6EC1593,0x3F231DA1DD7ADFC0,0x57A754A2E97FB121,0x4125F1859AB28916,0xABD9BE43CC53755F,0x81F32C1E773DC1C0,0xAC237CAD38D3F61F,0x261F75483,0xD4F194A3AB3509E7,0x81BAC2E0F57A648C,0xE173C0951E5C16A4,0x48A1938987283F55,0xBCB6A86EC05E81C0,0x7AD6225674AFA04E,0x8AB388DA1BDFADB5,0x3F19753B2E2E2165,0x6921CAC1A01CC5CE,0x190DE4DC7,0x96869EEF80516969,0x3659F9467DC5D803,0xDC009B891EC2F6C5,0xA68C5D673367C42A,0x37EED95CA3A030E,0xA354A7E44637A8A4,0x25780161F89D25BC,0xC8E3B189644A0C01,0xE5326A40343A7D21,0x1A73BDA09,0x9BB5931D786F73D3,0xDB7D2F5875CA8110,0x1A6871EAC8FE9C8A,0x41649576E0ED5A77,0xA461F3BCD8ED90CD,0xEEF6D09BBD2FE168,0x5752CF6E51728CE4,0x725E51DA4F9A49D1,0xD483F70C41E7C45A,0x12E9F2D34,0x94E78A935C09F7BC,0xD4EE83BE159E9181,0xA0DE1366B61A22F3,0x81A9274A6FED568F,0x83B4A90B35FD582E,0x6B400077C8F0F4E1,0xBF662FF10D95E6B9,0xEBB4711D2830211C,0x52F83D7033D3331F,0xDB02044B,0xEF83D2D02E49FBB4,0x974AFF7F25DA6DE3,0x16BD909A62B9B2AE,0x20C888D0F5CF9750,0x23508988B481AA6A,0x73B4F5E8EAD70F03,0x8846094668A7734,0xE9AA785140574BEF,0xEAA8FEE59BAA24C4,0x12C578B93,0x820BE8AE21A94323,0xC8BB6A165E6C5850,0xEC26A4D9FCAE89D0,0x8FD48EB3715F0DC,0x30471BFF0ADFA9A0,0xC4F473F2CD25EEA,0xDAE822DFE99E6C05,0xAA9CB85FDDCA59E5,0x55317999AC729FC6,0x19073C04E,0xC80919D93BFFD71C,0x6A7F5B51B7D592DB,0xF0F2ABAE325C15AB,0xE4561CDFBE99197A,0xAEED2D338D690215,0xEA83EF463D1E6E72,0x3117352E92277E56,0xD8C56E037D93948B,0x4626F5310753F9E7,0x966934FE,0x2AEB46D5E79CADA5,0x796CE7B137DBFF31,0xE298AB11089964CC,0x73672272F368AC54,0x6A75AA149564C3CF,0xDF76B25F8B12ACF,0x14934C9340B5405,0x1F8206DA85FC7A87,0x6A503863D4767336,0x17670784D,0x8E2B81B774FC5DCC,0x866E0902BA2852C2,0x394B35BBA3811932,0x858A1ABD3EDA0467,0x497B10DDD36D3194,0xD1C2B9E7A404377,0x790E6663B01B9828,0xC0DC52DE6BCD4DA5,0x9850DBF7B3B211FB,0x83AA325F,0x5367C1C810F721BF,0x765B95230AB04FD,0x2993B3F3D413525B,0xE90307588E440FA,0x2BFF42E6AC3B3987,0x7518941CEDC56FB3,0xE472EA157B56A51F,0xE906EE5BE29D5080,0xE2DE4DF83EC9913D,0xEF3BC0A0,0x9186C3518508D10A,0x6F182E7C1D468BC3,0x64C098694AA954A1,0x7D1F16010EA6C93C,0x460A04FF481E3452,0x5C86A3E5783E3D99,0x24CDE32BF6039E08,0x45E7CA22814ECE6B,0xDA363168947D3078,0x11D3482D1,0x5A8FB8C232305851,0x63261C20F79922D0,0xED1BF3A0663AB960,0x4405771DEEEF633A,0xE76FF88D941D5A3,0x448CF45B57E6D6D8,0x84ED22179F55B19F,0x9D479F1B6835385D,0xAD9049990CA941CD,0x9BB219FC,0x968CC6FBF42F9568,0x7AD9D8FC1FE30341,0x2549D7D3F6133D99,0x4D5CCE4390557D39,0x8301D0773D7995EE,0xB48A5BEF08438AD,0xD0BCCB50A5AFDB49,0x3E9645C419CE1C50,0x6214714125F9DFB,0x275AE73F9,0x353DA04BF177DE4,0x52016C240C3A672A,0x5C6A33BDE88780EB,0xB1F6553498FE8835,0x872D9E8885AD1EAA,0x9E2BBF1A9B053161,0x1B42E60DAC459CDB,0xD41BA91DF0053824,0xA7610DD1DAA0AE92,0x11461D522,0x646936AD6A1486C9,0xBAFFEC8F7EF8B24D,0x984D364F4365FC0,0x5013EE3BEEA115E4,0x773811A64AFC16BF,0xE38778E590749D0F,0x9797BFBB0556DFD5,0x711F1DFA6A5A3E1D,0x7CEEBBF05647C243,0x1587F5969,0xEC497283C0BAE323,0x5BA0D036B56DA66C,0x7DDC567D35797C0C,0x22DA51DC36233B64,0x865FFBFA1C5098DC,0x64022D29D80ED0FA,0xC82A69EFBD501FAA,0xDFB04E7E9B65E8CF,0x9FCFDB38820A7D02,0x1AF420515,0xEA834C914EAB839C,0x978817663F634BB0,0xE018865DA5F2B8E0,0xD5F8AE05A95A79C1,0xFB431A251F8DC07B,0x5C376EA65EF93EB3,0x71E272FE003DD4AB,0x47D9BE821B19A4AC,0xD6607E40562306C1,0x1E6649DD,0x3B620BA0DC777824,0xC20A7E8FD902CDD,0xA36A48C92CB28E91,0x6F7B2DC7A1D1AF45,0x81E6F5DBD70A0400,0xFC7B0B4E98C6F6B,0xE9125FEBD35915E8,0xD4EEE50E76ECF13F,0x2E71819E6D57D641,0x1CA07ECB1,0x677FA5277565E299,0x46046DC7C0E368F0,0xF79C264E8148CAC6,0xD5D17A3CD16B2E54,0x48CB59C0B103AC9F,0x371BFA686A37C284,0x7C1C404BCD60A136,0xC2E0DB7C70CAE487,0x3AFA60CBD1C71DA7,0x11F014F3D,0x1518E8BF848F8ACB,0x603F345E1581511B,0x75F8753AB1584E93,0x34F9B06B179989F4,0xE5EA06F996AD54E2,0xD6698C02F42916FB,0xB7BA448AC4A53D1B,0x4BF804C2AF091C42,0xD8E7635E6503DA96,0x6F42F05A,0x262678377FC3C77B,0x3A48E3A109B69272,0x5745E44F00D1F279,0x8A947DD17B1A1562,0xBCB1A32EEE5D4571,0x9B6702667546BEDD,0x68FA8EADC07202AB,0xE65D60CF7F3463D5,0xF7250B2A39AF5A55,0x3F970012,0x2048340DBDE25748,0xBC9EC28BB779F748,0xC2BB36931C23B020,0x3BD35831D22D5953,0xC7616AA23D767D99,0xA93A0E1F89BCF699,0xA96C26434A2DE0F8,0xEE130E61BF689C4,0x11E27918628A0425,0x161F73228,0x7CAC39F1D81C4939,0x58341EABC9487535,0x80D9AFF3205269A5,0x84B6B4107B7BD707,0x49931A872399D7EB,0x1C2E6FD707584F73,0xE42D717D4B2DA44A,0xD81350F25E198E81,0x27D2AF1BFD1EE06E,0x267BE8F0,0x7F13FB56D1DC27CF,0x7DD25116A618EA57,0xF6651A4E0E058A46,0x29E89A642E8EA05B,0xE177C56E4DA5A9FC,0x5E0CA4B367A3EE50,0xC4706CBE4ED9C06D,0x1EF3E28E3DD1271A,0xBC6D1C77E662A400,0xBBA45772,0x191E5CC8312B5150,0xD78667A5D5620285,0x17CE22D7D66B3157,0x4CEF238FA8B397BE,0x2FB87B0B5381B70B,0xD7E149A1DE2E0715,0xD6BE62752E422358,0x9FF91BDC85893200,0xBF03BF613E132A5D,0x1D65A302C,0xA86A24D46EA909AB,0x35EEDD417E541509,0xAC19264FDDA655C9,0x2E5BD46D3295532D,0x90F9D2AE3E5F1FD5,0x6CDBD0826B28F3F0,0x9DA778D5A17E8E7,0xD8A8DA748C9B6CA,0x65498784864DA2D7,0x1A0E668B6,0x43B619ECCB49D892,0xA48065A9E14EEEF4,0xD55D85CDEEAF2433,0xB0F3599B763E8239,0x3AA201A52E5BA5CE,0x78CC05DCEC31AC09,0xFDBD7F2E6175AEC6,0x6A21EC858E6E4A02,0xC6AB61F7AF835C5A,0x16FE87983,0x8F414AF13AE04435,0xCA3C942EFDAECD94,0x6A9BC07F3F7A8176,0xDD78DF2F98244EF8,0xE531E5F31FF98574,0xEA7CF8CA545090C3,0x88022E0543CB1825,0xADD1BB4D2D0BC8E4,0x4235B62E23304F73,0x46665370,0x7AC441AD4293544C,0xD6024D59A6ECB435,0x631CB18D93BAE258,0x5C190ECDE8C99B0C,0xD98AC9EEFD18F18,0xCE3F7F0C73A7D200,0xD8BA988D720F4E4D,0x3BC8824675394C55,0x74A351AAA3A480D7,0x16C385B28,0x2BE96DC13440D207,0x49398B1C57102D4A,0x711044875AF6FBD1,0x8374CA6F4AE4FDF4,0xEE297BD1F64601CC,0xB8CE1268DF67C436,0xFB968D33E9D3BF5F,0x6FC963BC674DC26F,0xE03F422DDD2A8B1,0x3A2D82E3,0xDC77BD7422A57580,0xC3F6012E296BA28,0x7FDB36AE91A15898,0x57E6E79F0062275C,0xBE29E782AAABE1F9,0xFA6DCD65EF7867F,0xE2BB1F22FC158DFB,0x8DE4A19625DF1360,0x7C67DF0EF9CC7A67,0x457E2F99,0xA1848D25F13CD002,0x83CDF09384022FE9,0x7465D1071FF3CF63,0x9B319AA799ABB4D5,0xCB1F5DB0DCF03C68,0x126E7BB0B83B4F6B,0x8E61AD5F0AAD2EE1,0x110186173277684F,0xF75F2D74C445C61,0x3ABE4001,0x5837F543A8A2B148,0xC440E58DDA9E45B,0x46805846B9356F09,0xE6DB4ED9B7BA7D35,0x6456ABE1FAAD36F8,0xA316844CAD776355,0xA843CE471263D219,0x6FE949C893C6ECF9,0x5C57290763EA8D0F,0x15644C869,0x8B18B2DC8816ABA4,0x9087A0FCEBB20FBB,0x617A9E9D6EF12D7C,0x21DC1DD372EE2BB1,0x60A2F36E0AB5345D,0x86A31A4A47413FC6,0xCCD716266C895BEE,0xAC2CED65A28669C9,0x453E313461207293,0xFDDF053,0xB7880907A66DC210,0xB19396978AC4AC36,0xE227F71ED3D8AC6F,0x1FDCB4A4717A947,0x9D7A9A08C901C797,0x29F22E755ABBB52,0x9AC5C370CDA0811C,0xF64F521E7441C702,0x23941FDE70877FEC,0x5ABF7293,0xD030BEF56D4EEF14,0x3AD84FF77B38E4DC,0xC3C80089C270BDD9,0x7166BD2514366D2D,0xBCCD944772E5418D,0xAD7855CAE29018C2,0xA778ED57DE1FBADB,0x6C0397E7382CFB91,0x12D1F518D88C8E6A,0x2A4F20D5,0x9E0B08ED0B3BACD2,0x6F6B21B5516F2938,0x4C950770257093B7,0xA3D6502D55CDE064,0xD4B6F1DCD11B9F56,0x75181F61A461B3A3,0x3B090B491C43D757,0x412B21D8080397A5,0x34796E4E0D1985FF,0xE7DB27CC,0xF1283FDB12913CEB,0x67090A47F426CCBD,0xFA403DE5D29A9C18,0x16FB4FFC1321F895,0xAA24373C945A2CA5,0xF55979300330559A,0x720514020CE9E9B1,0xC3925A188B03906,0x82B216837086AB1E,0x1DC255FA1,0x691BB0FC0AE2679B,0xA804B77F9ED6D8EF,0x2500DB34F7A76870,0x23102ABE5B798F13,0x4221F87EE81B219F,0x15E0A25138D58EB2,0x4A477B7CFBF6C6F,0xA00C58CA6CB4D6F7,0x4A46998D348BC6BC,0x1BD7B1D89,0x563468F33BF7F04D,0xDBEB105544F26AB5,0x721A5E1557144BCE,0x859B0E9B0CE6C9B5,0x9EF943BBEAAB48A,0x9D5455A735F4FE2A,0x6F77EF5A5C326E34,0xFEDE26D3EAAC38B5,0x41C663F712341A66,0x1BF7532CA,0xD660CAAC5D5255F2,0xAFA25823427021F2,0x2A540B06BDBB889A,0x28AE1480AF2C67A6,0x87B236E38DFE111A,0x509B459C8CFC005E,0x93815DD45134FE68,0x5541E29A6955506A,0x5EBC33F118DB70B,0x799E909B,0xA6B803EEAF9C4E5,0x6B0C12A3FC58176C,0xC9065C9BF91BCFAA,0x2AAE482FA12EA0B2,0xA9D56AB075E24561,0xFFCAB00827C95F57,0x2CA11398DC65C494,0xEDE3163015221BA3,0xD861AFAB3C5AFCC9,0x87C466AC,0xE4278B4E50218BD3,0xB903982277241D25,0x9E17F00FD308F196,0xCA65D516189CFE21,0xED1AB03548C8578D,0x842E0F46BDAFF29C,0xDB0ED2B95BFB9C93,0xA4DDC89234152D8F,0xC9BF93E3F44310BD,0x3064ADCF,0x9E95880219FD37AB,0xB6C308CA5CFDDE6B,0xA4F4D9A53F1AB312,0x75FAA586E1A4CD74,0xB22EFB8D02D8FC31,0x61E1963118EADE07,0xC90B006B0FCC2DBC,0x3D4629091F655045,0xAA1683DB96CA62AD,0x1125BD041,0xA75D9D46C6935503,0xEDE989BC62136EF5,0xB2DA51C25CB077D0,0x51137025E6723980,0xB22CC1F3CA0A4974,0xA37C4C37EA888334,0x23275A9BF8046778,0x4E185B375CF33571,0x4A329354CC6F36A5,0x1E127CA90,0x63F0661E961196A5,0x2D49D083E611CCAB,0x8422908AB433CA34,0x2F17D6BF5D5AEAB0,0xD1948AEB81F781A5,0x1A034BE2DF5A58B9,0x2B006750AA60DF75,0xD65933B99B24DCA1,0xAA6A9059CDA4A783,0x24B0CA783,0x8C487BFD9BE888A6,0x9C59C5154BFD4173,0x6264FA3AF02A6983,0x7BAE40838CE68E2A,0x7ED20102FA691CB2,0x6A31D8CEEDE585C7,0x1B8228A21F31ED36,0xB97B1069B81275B7,0xFB5E86016223C6D4,0x229A1E8FE,0x8FF58579095CE8BE,0x9E1955477704E569,0xEF9430F128967199,0x362C946BEB10561F,0x8FC500870B30952C,0x33D62F1B8AB36B3,0x3A4F2F2BB55CA748,0x778535485D0A23FE,0xA35A31AE08097244,0x1145AD4FB,0x7BBE8A58F09AE1A2,0x1CA5DFE6E297E9D2,0x4E047BDDBA3BBB97,0xE1475A62E32DC28C,0x332AB5797A7D8C2E,0xEF967C5C50309845,0x9E4873AC326B9FA9,0x32C98F2692B58863,0xC49D1C6833A446ED,0x268F3B8B7,0x93ED5010A39A1104,0xA7AE337429A4B80A,0xA33205D5C60AC416,0xEA4B3B8D7A79C11C,0x410DFC19EA51625,0xFAC4588E2CED61EE,0x740919A0CA33C10B,0x22B6190CC2EEE17C,0xDAC889BFE6B53E38,0x2CD76C76,0xB546FDA5BCB4683B,0x5D321829BFAD1244,0xC91F65110A72E5F2,0x2F1D573735796F83,0x41FC65390910442E,0x57B5388FEAB07917,0x80018AC0A7BF3DAB,0xAB5A08F94D8E52CF,0x94C7B53BAF0CC07,0xB2EC5757,0x7FD5A4D6AF237E89,0x41C5F643B69E0B33,0xDD6FBADF69936C63,0xB2EC8758B6F622A1,0x7450AFA477B6CEC4,0xD21A853B5E4A52BF,0xA6723F99FA0ED58C,0x9B7564964F9CD96,0x5A44D1921F1B150E,0x2158F929B,0xD012E8464C166A33,0x8DE4F69444535D1C,0xD9B177E9C463248F,0x64914B877585FE04,0x7864DE4FAA41FE25,0x7999031884D058,0x29FCCA458C8DFD6B,0x92ECCF3E62954540,0xDC9889A0A9553CB,0xD1075499,0x7F7BD75DD61F4131,0x8DCAAF50498B7646,0x8A09CBAC543EBF17,0x61691F52CE874606,0x7DB8B22030D1B95C,0xA99FA76207B81E48,0xBE340AEB486ADA68,0xE1D86AFA56E4A80E,0x56164A0D6C9022A5,0x1232F23EB,0x4FF14CC310CFE8F8,0x985075C1A568D504,0x345C146ECAC0C35D,0x1E37AE79242A57DE,0xE58D481883CC6318,0x96AA7D5323D49873,0xA10951A9CE842F84,0x9B202D52B2E50924,0xC9389EA500152A08,0x2BC35B80,0xA72B76049F957547,0xFB65830B274E097A,0xCE74B925F93820A5,0x2398C7B1645E42AB,0xC6B7994016A76908,0x29E5DF54CAB34390,0x55FDBFF93298D9AB,0xA12801B111DC276B,0xC9A58836789BA198,0xC4D04722,0x79C488F20B715A67,0xBBFA01FEE2A0AB83,0x622D01AE25DD40DA,0x80D6BDD733DB8E2,0x267BD427F33A158E,0xD38863E7BEACDDDD,0x5924F86097B1D9AB,0xBED0B39EF92FF2D1,0x8D8E0EC835F5E96F,0x573BAC58,0x6BDC6D89F94B110F,0x5A72975E818FAA64,0x165B4FC1C53E2512,0xC1253EC765CFAAAF,0x4799BF3FE6306358,0x10F9542E6738760E,0x3A58AB8ACF968FCF,0x97DD65F16DCABE53,0x5E3A3E06B1EC05A6,0x22BF12B6E,0xB46D516921BF2E65,0x45B28D850BB23BD8,0xB9C0D4830BB0F6FA,0x7D2A4EDA4DC49EF3,0x19A94F4C8AF401D0,0xA43F7DC62670D191,0xD2C7D2394EDA022C,0x58E715153333581F,0x1371C5A0C9978317,0x20E9C32D3,0xC1918964FABA597A,0xC13B6400ECF71FCC,0x6B3B3ABBC9043998,0xC85DB2A7841AB357,0x5415B3F7E9D5ADBC,0xA0A521C9471AB4A3,0x44BD4042BF8694C2,0x12D51E58D2B30D9B,0x4BAA73FA0B063762,0x272CD0A22,0x6A5C5CA23E99888,0x573970F737621E55,0x4EAD935F7EB30A93,0xB0AEF2FBD0AA360E,0xA745B11EFD29636F,0x12D7EF990CA3D0E9,0xA708D2C6AFE37644,0x9D71B9437174F9DB,0xAF6F4A983DB297CD,0x1D4B608F3,0xA12392212E05937E,0xB489ECEFC046F6F4,0x9445A1787A761F79,0x6C268CCB4D01B02B,0x91363A929736CC24,0xFA1F371D04129207,0xB6D656500A36C06F,0xD9B68472EC539EA3,0xAEE2516EC695214A,0x16E332145,0xD1506E11947EA2D,0x2AF992A97C530BE,0x7AF8EEFA9BC03E4E,0x1C208D3CBA510F74,0x4FA3B3A04B113386,0x398F70E2F1C18B0F,0xA44830A6DD94D774,0x46E847979466E2E5,0xEBE0D853A9BE1AF4,0x18C94D89D,0x1BC89C27DD808009,0x4E2169E15EC8C742,0x8292D714B38FF5FD,0xD08F4760329C0455,0x88FEDDF7822BC08A,0xDB5146345410E570,0xF4CE13A41104EA96,0xE906A130772EC5E9,0x51DE0F9AC61690A,0x139BE5A76,0xD2588E0FD2B2F5FE,0x15370B6E2069968,0xDC55A22F794795D3,0xAC4D0F4447AF55D1,0x565DFFEA7475E337,0x7FE6095DBDB9F7F2,0x6FBD51CEA885F6FE,0xAF03D9C0AB665E87,0x75BB618EB0D6D2D0,0x1AE959AEB,0xAB2CC0AB0985DA39,0xC4C5A5D33D919E39,0x99ECBC3728F0BE3D,0x201F328552D2C4E9,0xEFA5BB485231AEAD,0x1A9FB25D0AE3578B,0xEEC91193B59EF1DE,0xA203F72BEBBFBF54,0x4823F3E413C5B5E8,0xCFBCA131,0x82FD337A5387776D,0x93D73DC94D989D76,0x1D57FDF3FC9C329F,0x21E29B3FC57146A1,0x32AD8AFCC5DBC9BC,0xFEF718ED3D9F2462,0x71F6B059497EEE89,0x4FB29B1668B8675A,0x795A61DA7EBEF5AA,0x209286757,0x4819AE08FAB380B8,0xEB25C6379FB9CFE7,0xC0B6D8F21B745D6D,0x80DACF2F8DDC1554,0x70F4C31B69FF8BC0,0x491BA34DBC2DA2D9,0x7CAC2AFBB9163069,0xBCF4FBE2C73C7B9D,0x6A13381EA51BFC01,0x190FF7B10,0x8C99C5343DAC366B,0xED2E52334C7E0382,0x4FCD5355E1C29A7D,0x764D604AD2C08098,0x44E9BEE7A601EB73,0x1768A6EBE56EF7C1,0xBF780C1E58330176,0xF82AE60BA5AAB9A9,0x34D782E4F6C1684A,0x13124AD44,0x1353EAD049C33A13,0x15521DF7787332EB,0x1C28686A42DE1DF8,0xA6E40347E4BF2867,0x5DA2454721E4669B,0x48E31A1F7C41E19,0x51D9191419DFD4C1,0x69D1C75EEB6F759C,0x174FB57285BA01CE,0x4318B3DA,0xDDB25F6F10974F46,0xD021F377585BD197,0xC6285CFC278F438E,0xCFD0759A0900EBF2,0x1A9ECA479514A24,0x9FE50422FA8E29A2,0xEE15341D42B212BE,0xC420CB7D80B80CD1,0x2CA487F404058D0A,0x1F32EBDD3,0xACCF05FD35EC47B7,0xC7DE4F8CD629B5C0,0x9FCEBFE19171FBE3,0x6EC9AA770C10585A,0xF2B504DB19940AA,0x92DBC12B4A5A3F49,0x5E091853E676EC2E,0x56E71A1D4006D3F6,0xA0C3A003BFDB3B80,0x1E49414B8,0x80AD0787D883CD1,0xC77D43B24E447CEC,0x9B8E43ADD3CF2268,0x1E57DEDB6DA816A,0x7EF7B0BBAF5627D7,0xEF893A2EA94BD040,0x24A27DEF6FB4423A,0xC09F0B7BDB11ACE3,0x4A1A586DEC1BA05A,0x84F6A119,0x13233668D6D46F5A,0x26CB8E00A378C5E6,0x56434447400A00D1,0xEA678AAFEDC17F47,0x5772A6B434A85F53,0x69F30039E2DFBDA9,0x3C70C209BC6DB7D0,0x54532227F2C6A6C4,0x310A35B5AA7898D4,0x1AD2D685,0x4113CB7CFD6EAD85,0x32946001F8DAB022,0xFDBBF82F4EF56273,0x909E73FB6205D01,0x58ECC0C765D41637,0x7EE0D5C3DBFE0614,0x60D0C0AFD3F31FB4,0x55382FB8C99BA67,0xCED96B43C6DD1C5B,0x1EE474D65,0xA9C64AA20B61ABF8,0x90FB6B188E7C972B,0x4C8092F75D00CE3D,0xE8042A0339247052,0xAC1754FB46BE072F,0x7A1A81403395CD2D,0xDED4F803B13AA02F,0x14EAA39DC8CEDAC9,0xA90BFDA916F7CFE4,0x1B36BA699,0x5EC8E7C41DB797B3,0x654AFBEDA7185F01,0x6BF03BF8572BBA74,0x9C2FE49C2A1C090,0x5EF0012BD91BD225,0xC436C7B68150E12,0xF885F886AE9E4C09,0x5C3E7181BEF9AB3A,0x41783B8827E9AC55,0x1BF18122,0xC3D27EBC3FB55D72,0xBFA774D272E914C1,0x103FF0CF40C28DCA,0xA7099F41CC602F94,0x9D3A4E330AFE8FAC,0x134AB8943A4EFB6E,0x92C5099BF2F7CC54,0x8B5C55164CBC762,0x77759C3F06D26A45,0x22FD8DB08,0xC78BEC2C276A944C,0xF8CB03FC3B06BC30,0x74490CA4F55FD29F,0x965AB8E074EFDB50,0xDDB40F8665BF2FB5,0x3BEA82D56356DACF,0x1637E2EDB6DFB01D,0x8B4AABD8FA2A0B9F,0xBFC31F11CD2ABAC9,0x26D876DF8,0xC2040CC407CCAB6,0xD976142026A2B41F,0xA2D765FCB2E3EC18,0x6B833569068B8419,0xD2E82F8A364B17BB,0xEBE5F23C8A519E15,0xD5EED1BA4987D1F1,0x61C44A596AF565F0,0x3251264616FE4715,0xCC9A5F4A,0x7897207C34B238C1,0xF2D2F5F7AF428684,0x401731C519A8FCE6,0xA70D7E0F74134288,0x15CC60778E9134B5,0x1B0FF7ED1A9C87F2,0x1BD9C7A575B650ED,0x45FB62BBB72946B1,0x966EF88EF1C6A3BD,0x645F1024,0xCF39A431F5DE4018,0x4477A08C63302C44,0x539E469C47C6A243,0x5E3500F6DC722A0F,0xB82C772227908E97,0x2A32EE054D838429,0x7B6E46A2586436FB,0xEEAC4658EF5AD6FA,0x618902F30AEA02,0x1FC23D87A,0xC30A92716B074D54,0x18996AB235F81B19,0x8E56491EDD0E66AC,0xFEFB85AA0BC54094,0x7D5E85C5D68A4C6E,0x3C62334D54AFA744,0xAC895BF24FF49F4C,0xC7B0526598C12B36,0x55C831907710BF01,0xE2327362,0x4086AF614A8DF0F0,0x23A14D22AF1DA4DB,0x540510D950F7BCCE,0xA4001A72114EFFAC,0xE16B9E566C701F70,0x406C07551DA6505C,0x9A055F80F20C22A8,0x80B62E50C81D2B0D,0xD7F01C3D1398C6BE,0x1CBF50193,0x931ACD23377507DB,0xAC899D9B9EC0C24A,0x6EDE3C8ED76DA13C,0x97B3EBAFEE41CB35,0xCB23568187DE5635,0x27CDB7BC85C4588A,0x3377937B652E2099,0x379EDEADF5DE6686,0x4083D2DBDE4C87C9,0x135454A20,0x285EB777BBC9A86,0x598967D90508FA08,0xA59A31C5636525DF,0x139579895F6DE6C4,0x2EF34632EBC308C6,0xC7A786E7BB68898,0x778FADE6472CC29,0x29958D8ED77B821B,0xD8A1D23388FDBE3A,0x12FF2673D,0xB2B099D2A1A30CF5,0x32E93D41864FC83E,0x2A079EF5A80F10,0x94CB7B4DBAD32C27,0x57BE629EB5DA6042,0xB440C9E2A21B84C2,0x369693C25923C762,0xD7A0BC19D4264D94,0xBA73EAF455CB3DF0,0x112B493,0x7A83EE22259920F,0xF0D7089E4714301C,0x91226A3378A13402,0x77001025F9119F1E,0x6C2EF807A3925005,0x1CE9CAC23AB706E,0x60DA22EBB0DCDD3D,0xE6B6965AFA4FB3BC,0x1871E63152F68781,0x1A35F721,0x9BFD98643B2BAD52,0x26394738E15C883D,0xACB84E8839CD83EC,0x1AC1B37293F2390D,0xE919760602F58681,0xFDF7A93389E0F4F4,0xD5665D2C124E0C06,0x6CD2EED46BAE6DC7,0xD59AD87F5459DC80,0x21CA0314,0xED4F3F90A57D4BF6,0x5F1AE116310D4BCC,0x14F7A590AB990A92,0x1D71969EB844456,0x2B08ACDE2D1E7A84,0x32C8E6BC0690F3A9,0x85DD725064143E40,0x7302B8606E183A0,0xBB538C31652F0D79,0x26AB8D47C,0x2AA310C37E9C1360,0x84DD5BFB7E7A9ABE,0x49E4B663B1F973FD,0xDEC59C58E8E5C0F3,0x16D1577EA4321166,0x2AA9C0A6C5C78324,0xE47F488719236D64,0x12B8D9EF34FA5DDB,0x18BB2084A616721C,0x2260E045A,0x631DB3DC41036204,0xBD669A0F079734E2,0x8F50CF645E834F1B,0x93690FC3A770461A,0x2BACB5D7B0504A19,0x67263A4E97AF5356,0xAB703A43DB32E071,0xFE512E0173B9B389,0xEE0A068611A7BD7,0x4CDD100,0xE6B721C099FDA05F,0x5EC95360EDC2A57F,0xF46612CDAEE6028B,0x1FAB378D66BAEAB,0xCCBEFEF8BD7E9054,0xEECF93FC9D12825E,0x9106DFA1E9295536,0x8840611F6B8FB6F5,0xC49328C683A610C7,0xCF18640A,0x9463BC67DA89785A,0xDCBAE04B16DA86E1,0xA3438F4AC772AFDF,0x3F9B09E524EB1CB7,0xF9ECCF60DEF8C9DA,0x494D10BECDA52040,0xDCE34C342667C7A9,0x933D240B8DCE78FD,0x685B445EC1D39B68,0x1E5DE3E98,0x4B521C18DB7759AC,0x7579043C892F6495,0x855EDEE8FC7F5945,0x8ABA190E13539A79,0xB9471C5B1F321039,0x4A731F8DDC4ACCB9,0x8E300E13A2A65FCD,0xA9CC26BA174E3B6A,0x3EEAD9CB1A0A7B4F,0x1DBDF064F,0x2C579C3EB3FF4940,0xD21DF6914993AF33,0xC99A60010F3DC4C,0xD939FE7793992C39,0xDF36F9F217163149,0xE41A8F56B1E1BBAA,0x1CA06A5D206D828E,0xAEBF704EBBE27353,0xD1B5ECB16FC30AC0,0x2400AF019,0x4CEE9ADF70B5E1D7,0xB0467F1619D46F04,0x15C8AEDCE0FD0750,0x164D516DFB21A286,0xEA420FC68AF607FD,0x70C3DF4D392A421C,0xEE41F73A913CACD,0xCDA3941AA19E5D3E,0xD53286CEC1302F36,0x8A084132,0x5C4292A17DF59AB0,0x4FC218D0A55B1C32,0x3933084CF6D29C01,0x8AB767DCCC0A56F7,0x93622D6A218F01A1,0x18CC5A8E5993DD91,0x5C219EC9A70D16C1,0x98C29151327D2F5A,0xE24F67C859D02B6,0x1BBD96756,0x940E4B89E0250CA1,0x6C6C207E234C9B3C,0xA1BF505C01390BCC,0xA5D5C2711E5B08B9,0x5CCC31BE569449CC,0xAB9DF2A44D2C7E27,0xA31BF436C752C658,0xF820339F1A2F08C0,0xC14201238EB02848,0x205919291,0x1A9441A8AC1490F4,0xDD7E9E3A93C54C0A,0x69828CA35DC83A73,0xCCB1C34470897F44,0x9FD410368AE3F197,0xFEA3EDDC9147437,0x98B0A65473873AE3,0xB07DB65A82ED83DF,0x2374F0DA8A91DF1F,0x10F8B8033,0x5781838815C86ABB,0x6B4509CC14C72229,0x216CF9573DE0A71,0xF493817C9B73283E,0x6B312B112117B76B,0x44013078C6CE2A5A,0x76F5ACCAFCC5D85B,0x9D76AF9A224747DB,0x47551E96BFD6A4FB,0x1B9CBC2A5,0xA8248A38E22A4E0,0x25E5F0822487043F,0x5650D69508D96EF0,0xD974D8201641118A,0xCF76EB12EC289516,0x5582651C7B52CCE7,0x9D7895451F697338,0xF2E605C13E0DEF7B,0x5CE4AC54A7989AEA,0x1281148E1,0x98C618747C6E9575,0xFDA74115538A5D59,0x47A6E0C6A8B6B6A6,0x64B9ADDA6E0E8E09,0xC1B43229C23A4224,0x814E8D5BC96F97C7,0x88861354B734581F,0x235F456E5AEC4D9A,0x7B696921438DE315,0x17CD15F8F,0xBC1471101D4BD6D9,0x4D71871C29358E9B,0xAE04D74CE0BABB96,0x562E32EEF4A03E22,0x91163BD1A5664E63,0xCD5DEB5E0CD3E2AD,0xF1D8662BEFAFD065,0x6C73BF7611755AF6,0xAA2693D830B59858,0x1784C02BC,0xB7FE6A4F7CF28DD9,0xAE6EAFFF903B4AB3,0x3F61B2C533C75593,0xBEB3C65D5A15C5DF,0xEFFE07CD76C1F059,0x893CAC33FB2712DF,0xCC42083FDA39EDBD,0x54104102013CF4A7,0xB72C0AF82073F68,0x1E6A358BA,0xF13C4F7D6EE211FA,0x8E59C08F7CE07A62,0x1F663224DDD648E2,0x33883A3CE1770138,0xD5248D7FF6410867,0xB8ABF68F13CAEB00,0x1F5157ACB4F85F,0xCD44AA78F0BC232,0xABA51CCB86AB12C1,0xF81A48C2,0x75D813C62AC6552A,0x38C45C29829D8D21,0x8706638224FE6149,0xC99853B676172C17,0xFC8257F96DEAA546,0xB7F2340B5B4B683D,0xC4E464EC41D5BB28,0x3CF592E45363C6EF,0xC7EFBA6B7F7E3DF6,0x234172A95,0x83C90518876A80E1,0xEBF0B16D1D493C3B,0x3D4919312B722595,0x90A56171B08A251E,0xA149ABCE34C0314A,0xE92B4BA54E47C8B1,0x5D36A91465F7F0F7,0xBF155B93590C4275,0x7490C7AE1A5B2BBC,0x1B0C0655D,0x1906E9AC9CE79685,0xB5208B66EB97851F,0x768B4BB437170EAF,0x75ED10C158AFFA07,0x86A61346BC3703C5,0x97135FDD6748907A,0x7A498562910DD933,0xB0C9844141C939F8,0x93C4CFDC013D5498,0xD0B80986,0xF6CDD2E39A4EAED8,0x34FA70A9DE3FEEAF,0xB019079E069AAAE9,0x96C8E7FB68024354,0x37F48981E73D5445,0xEE8EF2120E41CCAA,0x35B047B1E41F0B42,0xD636A64072E2390C,0x1EA00B1974244368,0xF09AC18,0x397FEDDFA61A172E,0x7FA63B492989C5DF,0xD0F81EA0088CFCCD,0xC3A503B792B270D8,0xC49BADC6B903AE00,0xD440168BE6580B68,0xFDFBCCAA7AB7AEFC,0x844F2B024990DC5B,0xF0F5EC3323307178,0xD55A3878,0xBB296D725D4C2821,0x11A807859746B330,0xFE33C3274126D87C,0x775680197B5A68A5,0x91D37185ABA7EC6C,0x9FB4E13DB55C73B,0x25FDF867E613DBEC,0x63106E3A2744A1A8,0x4A5841A4BA5B0E3C,0xAEA89E9E,0x1E2C873C483E5E86,0x237633762E549ECB,0x3593C2A91EDD520,0xB599C9CCB89BCA7F,0xC48B66D7DA0C7107,0xA5E9DABCD23C2EFF,0xA6E0F050F7CB082D,0xF297D45086F034BE,0xA1B714CDFDA22230,0x1B0A6666,0xCE3C2921F54C2610,0x99E55CB0B71FA9B,0x384CB2D8CA89D9D4,0xD42604D9B9914584,0x4312F7BE037A51BF,0x5CF93716AC3261FD,0xEF22E52FC1B6FDB9,0x836E4D5515086DC5,0x56145919698B8BFE,0x18DEA09BC,0xAEEA3F2B380245AE,0x9EA646CCDC1FDEF0,0x285EBE6DE5F322F8,0x5EDEA5C5D84DE50A,0x8E30E386ECA269F4,0xDC0327964815516F,0x5730013C05170F12,0xCA838F0E024AA36D,0x352657D40AFC848F,0x1BFF9E9C9,0xF36BBAC65173CA8E,0x7257BBDB43BE15F1,0x22A810E3498B6738,0xC3CD2F7307C33484,0x5660110DA4366E6A,0xA428B6EDF2165889,0xC227F644DAB68D9D,0xDB70B8C0A0A0862C,0xA317E74C88B5BC33,0xD30EC0B8,0xF820682E6056A5,0xA6357BF72320ED9A,0x850AB9901FD154A3,0xB4CF8CF7B81D56B,0xAC3978E756865D8A,0x233497A8E7843677,0xBBD6C4DEFF7B94D6,0xE5BCA0725DB7CB04,0x3EBB9353BC76A83C,0xA0EA72C0,0x34FA66D8300AD1FA,0x38006B71B112C57F,0xC5E5401E43F2EF2A,0x937CD2C5F7A37955,0xCF8C5C026CAC9684,0x8A921F49DAFCFAF5,0xBFA0EA7DE57C1709,0x8CC5588957C7114F,0xA127F363522E275D,0xCBA24AD5,0xEBD527CBE99FB2D0,0xA5FCAE69B8D7C674,0x8C9742DAFE5AD129,0x71621774747957A1,0xF4D2952E4E4C859B,0x73EF2B99871BD8C1,0xA03D0029781A4EC2,0x2F66E4E0E8AA5C4C,0xB52A1A425AA5C18D,0x277EBC4,0xB46AEBE46E32FFA6,0x17E463312AD6159A,0x22FA887C4B5A815E,0x643354111E731C50,0xD09A1514A09AA43A,0x58D9F46A8B1BF1E9,0xA7000CDFD032E280,0x6A459E8A69BD6539,0x95E11A5C47813A87,0x1A65C9833,0xBFF83466A9BB4814,0xB6139BF3135C94A1,0x257D39AE8C67A64B,0x97115A8DE55C726F,0x2E7F85ACFE5FE8D5,0xEFAD09AEF5B149F0,0x441E1F63027B5497,0x3E62BD8283A9B0EB,0x81FDCA7D9F5007F9,0x10A839741,0xF2AEE4B72736315B,0xCB1520DD2BF0716B,0xD1689A8B1717C0D4,0xE0D6E5616CD5477C,0xF3415FF044C25706,0xA271D3B3C876491A,0x1F666AFFCC2946A0,0xB7921FC085B90404,0xBAC575A6B32D8FCC,0x595B0A1C,0xF5AE7174A29556FF,0x771C6E54011825DC,0x7776A5FE7632F73A,0x1EE11F1462C50F68,0x90B14662C162490E,0xF4AEE041A1FEA856,0x42A81E189B9E4728,0xA25342D4E3CAAA9C,0xDAA532188E77F07B,0x1DEBA6957,0xE9D1C0E9519BBC4C,0xB97FE4A946DEF682,0x4B3D058ED8B0942C,0x3B801F48F4016997,0xD62ED840E577851B,0x7418E12B2845262B,0x7161F5509635C622,0x931206AAF7216389,0x4D1B04EA5D1B8105,0x257D9193E,0x254DC8486E5BC3C1,0x27895634CECF3D7,0x89F03B8940422210,0x1CF0C98791C0C2F1,0x45A7C8CE83A1D6CF,0xF916DEC3D49681A1,0x1327B345F2904B22,0x5D42868B22667974,0x4447560EF0C0A689,0x178F0EA11,0x68839F9DF7949D12,0x96DFA99BCAD33DF6,0x3337BEA8C88C4778,0x26CD1DAD57D6DE4C,0x66F1BB63B112BC96,0xC7FB0DA064DD4795,0xADCFACB91371C182,0xF357CF2E0D4E9B63,0xA5B9DC226C1889BC,0x253DF940E,0xD005C1B0A02B7392,0xF9E09A99E65CA83D,0x80ABFA3006140AD0,0xDBC671DA306AFD11,0x1A5DB6FED53D8AD,0x3FCA60F0EC57DFA,0x3ECBF6EB08EA231B,0x3F8C50A7FCA5DC61,0xB8D435CCA2FB0AD8,0x2456C7156,0x2D3418198F08611C,0x7798B7FBE4DF6C34,0x34D33D677DEC7927,0xAB79B3B4C3682B3D,0xFDDA7B1E6029298E,0x68B73C0ED467E6C4,0xAE12C009EF7D65CD,0x9166917AF3DDD3AF,0xAD1172BEEB8D4089,0x996DEF23,0xED69886D0572DA17,0x3BC2ECCD1937457,0x82B2AA55EBC737B9,0x791E36A3B9B7385B,0xFF8ABE4B607384D8,0x3D328658A1D04DE2,0xB59D47CEB65E30DF,0x7AA00146BA9C1A1B,0x6D160DC1BCF147CC,0x1ADF2A485,0xE7A10F0234E2DFF6,0x50EEF43DC6D3CD41,0xC44C94EFCBAE7C4C,0xA954A4053500674F,0x56F799FF5B1CEDD4,0x6EF74171BB334F12,0xB3063D1BE4BC2DC7,0x957853C503D8EA06,0x61ADDD859D14903D,0x15C818684,0xE8F6407BC45FAB2B,0xD51AA11710E412A3,0x75C3F71274B3462A,0x26AD784896B9EB3B,0xB2B32152F988B9DD,0x3679BF9150A082B4,0xC7EAEDF86532F3A8,0xD20CFF7385387F3E,0x68A15EE32D98D0D6,0x69829B46,0xC2CED0475139D3E5,0x36A6EA9501F625A9,0x8CF9AE1484F8A10C,0xDEC6C2C322B2652,0x30190DDFC1AED881,0x2CB1AD6FA16EC93C,0xC9266EB375A39E6B,0xC6F2DF213AAFD17,0xEF429FC0A5ECB8A8,0x164EE2624,0x46251608F0FDF70E,0x3EFE06B4791BE087,0x678F0AAD3EA9039E,0xDD606E88CFB8F24C,0xC31CA65AC276E5F3,0xEB8A0522EF2DE13,0x7446FB760B46FBA,0x10ECB6B74AD58280,0x232662C1C6BA136E,0x26B83D266,0x7CF7B4D529E1977B,0xA6FA8A8E44A86601,0x499809DFD464C9A7,0x92BAE5CF8787F9C7,0x234696CECD5DC221,0x17F18E75932047F2,0xF6695C55237832B1,0xD01B73743E7D79B3,0xE5B418A425258728,0x21AF98F48,0xCC2EC6AFA12ACAEF,0x9171DD1589CE2075,0x82250000794E0359,0xE52D48EEFEECE164,0x536287D38C2B8031,0x62B8E4B575214443,0xB99F7027FC8E4F1A,0xD22698914523672D,0x3E6D3EC735C864F2,0xA9CA31D0,0x19297AF45AAAA1AD,0xC44F6F6E20B917C3,0x4C32D6AC9AFAA16E,0x12C09B0662E08BCD,0x37FB8991CA7CA8E6,0x4C39C1C015C0E469,0x91DA7F9D547D50B2,0xD3D340B1265D3B9F,0x93C551A2A04AB3CE,0x8AAB71AF,0x32505C5643AB7DBF,0x68062DA7C7F7BADA,0x4E49E1550E6A8A0B,0xFF2C5010ADFEB9F9,0x62AEC48EBDA72B65,0xB10E14DD5FABF194,0xAA85155E74CC7C22,0xA1F2B6302C07FDEF,0x8095F7F54E85B854,0x1E2AF33BA,0x7BD0F780F840702B,0x56ED0C98738B3061,0xA8CF29F3A8B575ED,0x1B5511091992D3CC,0x70DAD68AF8A93EF,0xF46DA014A22D2227,0x570800FC69269A40,0x35DEE878E5E30CA5,0x2DD1E763A4C6458B,0x268BB5858,0x5ECF64E87466D92B,0x5B808708B74492A2,0x4BB55C55C51E9B6D,0xE40A6A913779587E,0x3CF804D523136A72,0x5F8BE216286BE193,0x4E9E48DD730BA92D,0x7EB940C21A4BD2BB,0xA4FCAC693DE3BBBD,0x1F6920617,0x442AEC25404A2807,0xCB08D3B58255E3F0,0xEB94C1A54085516,0x1800C289BECCCB06,0x3E37F41061575CD4,0x22EDE6DF742AC208,0xD62CB63DED6F12F1,0xF5A88FF8A1918EE5,0xB88AE9E400E26F86,0x217F86343,0x5A4905EE8D04CAE8,0xFD297572F5044A77,0xA1F537DDBD3B326B,0x9744DCEBE548653A,0x7CAD061815BDC9F8,0x76CAAE84F1138305,0x178F3079FC29109C,0x7ACAC4912AA2341B,0xF0BED91B41C2DDD3,0x249EC7E9A,0xC7AA7E2FD9405396,0x5295B3567D68F440,0xA6FAFDEED89EA851,0x9665E8397416FA32,0x3C3F34BF8D24EA8B,0x7BA5DC5607530C8A,0xDAFF47E4D3B666F0,0x4FB21BC994C5BEE3,0x780946C424D751F3,0x14C63E43,0xD907B37DF6745654,0xC1DFC9D158A48C02,0xA9A4922FE33A6397,0xC5D7177DA51BB91E,0xB882971BB16F38D4,0x4547EBE2B20BAC0A,0xF6CEAE48A1999CF3,0x98755D4BA6891BD8,0x907D4EF0F0EB11EA,0x237E5D991,0xF367761F5023A741,0xA45F9A1674E3B1FA,0xC2665EB64AC76B8A,0x983F18C1393F7679,0xFFA4B524AE015CF9,0xAE4AB9043B441BDA,0x8F89E9B4FC890AE4,0x7CB7733B7D244CDE,0xF15112DC7BC361BE,0x55A80926,0x3DB57349252E4E7B,0xF32D9125057E4707,0x1BEB825D4A750959,0x1457CF8836D44254,0xC42AF349AF442BB1,0x5D3D0130B767AC4,0x47F5707288A6B949,0xE6BD75D22D068B0D,0x97BE5E39B7D8556C,0x1A35109A2,0xB8E4D24AB8E9C5BB,0x71B3D382BE8E34B8,0x869C063124AE38C0,0x629F704DCE72C65F,0x197401B52CE85C51,0xADB1E5FAC0AFD53C,0x4C3F27610C9ED336,0x449A9607CE81C15A,0x1CF64C0113812B6A,0x1341A2751,0xB93C89A4BFFA134F,0x715AED17FF393202,0xCFAEC3CBF93F306E,0x68C73CC9A1D53510,0x7BB587D91A9717DE,0xAAEC60A14193C488,0xB4D71318613D7391,0x32E044557336DDBD,0x626B089E0F161789,0xA9DE5097,0xB91224A0A191529A,0xD0206F01BB768E9B,0x34A3F92C11AFF94,0x2FB73BD102B6CDED,0xE074E711CCBC1651,0x9E1282DDABDF7524,0xE5DCE8F19734E0C1,0xCE7287AD555E216E,0x9DFBE789C3F56A2A,0x183AFA7C1,0x2D66F2FDC5949CDC,0x9C3912DF2692594F,0x2280B417222ED43A,0x73DEEF1B5667A2AE,0x9B644FB8D6FFABB4,0x1321081E03F884AF,0xD6A586CD7BA7D896,0xEA625FD77876B3B5,0x838D4082803FF0A5,0x1970A6C5A,0x96D473D0A7C99FA4,0x4D1B4D00211AA64E,0x322EF1CC1D9826A5,0x9B54521BA2C401E4,0xA40274B806DE693E,0x5F6DD3807738DC53,0x9AC38E637EC1D046,0x3DFC0A48E28C925B,0xF6FA55C6F21E4883,0x125380EDA,0x6C20785890143AEA,0x6CE3978E857BB611,0xB84EA016C45B2FD1,0x6F229EF8631E6D90,0x90A4FC2E373364C4,0x7AD8261456873D3F,0x7CE1E4556C85B809,0xD42E537ADA48630,0xB9F6D4C7379E41F8,0x6C1F1306,0x97E71E04A265658C,0x8693F6F0C8729D71,0x54BC71938EF796FD,0x957A3E972F51845C,0x368DF065AE0E5F9F,0x63003BC2AC934434,0xB4B2C5ACE4DD4B92,0x44CA267D1D3DC5D9,0x700F9CC1DE6D3BE5,0xE1EFC0CB,0x76072E4ECCCBC282,0xC40A3DBC4C711E5F,0x48307A0B536B9C96,0xD40A1D1522414730,0x910BD2ABC8A81FBE,0x77A414549BBF49B7,0x9ABC500DC5E21DFA,0x7027527C815CE1D7,0xF3034F594E745883,0x1A194D4FA,0x9232596BCC33C7A9,0xFA211B413D990694,0xF0943C0657B658DC,0xDD6206278480402D,0x7E2F615CB6DDD2C7,0xD14AB5E107B869DF,0x7D24B5D468ACF50C,0x181B19548DC8BA1,0x11D359109304417D,0x243FF3531,0x399986C55E8391D2,0x825021F662F506E,0x90C5AF564979474D,0xB9414F05040135A,0x1036D66CE13E51D0,0xDC9766046C39513D,0x95E4F41528F234FA,0x91305FF19E0CC3C3,0xAC66BDDE9BC06C68,0x15FD4DA8E,0xC71B3F3DFFABF512,0x36BFC591594C70,0xF7CF04CD4A5441D7,0xF719C7908CDDFC1D,0x642355C1AABFA302,0x2C7DAEFA6B3C8AAA,0xAF92C645D9D2CF5B,0x8234EADFDCA0A084,0xF220510F56582AE2,0xB61BD761,0x2B24EC1DDF1BBB6D,0x3C71384591380CCC,0x582BBDBB540130D6,0x3D4C93024174B14F,0x7C31336C8DB85E4E,0xFCDF768E683305C5,0xA17A65F21DA80181,0xEBAA0CFFDDB4348,0xC3B6F3AD25EE1C56,0x109BC1A73,0xE9A9AF76DB5CA33D,0x742046F447E336BD,0x2B4CA1A2F895BFB7,0xEBDCBAAC782852A6,0xC025BF3A40BD403D,0x8AD14210984F4F5A,0xF3862C0F4C7A6381,0x12D6767122ED8EC9,0xC6D642E3F3C53FC8,0x6E33A257,0x4469646A82A1949D,0x4352E2F6F9A328BF,0x81F6A6E9932343F4,0xC97B4421CD7B6243,0x4C191B3C90559B74,0x88A7CF252F0CF1F7,0x8C1F15568E882290,0x2F6163E5E208BB4A,0xB67A3522A68E5AF9,0x1CDAA499D,0x1D868BF230EDF779,0x52E452F81B6DCB5F,0xABDE6DB97E3954AE,0xC263FD84C1103495,0xA28EF7BAAB142A72,0x538B54D4518B1401,0xA05D9A574A9A86E1,0xF565270590F61AA1,0x7014A0C3D42C52DD,0x1AE8C3BEA,0x745F4D999358AB7D,0x4835097647A2529,0x133FE42BA85BC6E1,0xF9D2A706294229B1,0x8B7CE85E378F363D,0x90AFB740FC112947,0x9E45C09678EE6FFF,0x40DD0E21E79D176A,0x5EBFE0A8AF1FEB13,0x353E623E,0x44E8D843C318CF1B,0x5D4D8FD9563643B1,0x358F08D3065C9AB6,0x1ECF8D0647E1A62,0x4328C11B59E5BCB0,0x5609DF6CCF65D809,0xECBD1C62F3EED48E,0xEE50045CF1F167D4,0x80393E16CC0C2659,0x1C63D0F79,0xDEE098FCE99095AE,0x513527DE4A0583FD,0x4D26C535D76DEDF0,0xD84B2A603C3C5DCB,0xA366A65E5A4DFE51,0x748C0013FB01CE0C,0x25F4F5DF70B92372,0x4B72EE0A3DA2A1C9,0x800D995A530A744C,0x129010A7,0x36DDD8A1ACE81161,0xF349286904D3938D,0x9796AF1B93CD37B7,0x5771E0F0664AE2EA,0x7CF41DFFFE4915FF,0x1B8C33E20FF26A76,0xFB2E2B3F4C13572,0xB6851FBC87A925B,0xA94F2918BE6852C,0x898AD4CC,0xF14D9D41BD5583D1,0xD9FBA11DB5D05E51,0x1405C3983F6F1953,0x957F2CFC0D1AE93A,0x811F8FBE65DE55AE,0xF4792C24E7F04AF7,0x7C63AF9D5DECD4FF,0x6964877667F5D9B4,0xC924A965A17A6C7C,0xDF5CA7F7,0xA7C5BA8711928311,0xFB80994B2665359C,0x8E0B35F70B81DE6C,0x6108B7E16951F23E,0x4EA73D8C7029A83B,0xEBD7E0F84122BD72,0xDDA30D5BE400E073,0x59052B0FD54FD339,0x7CD68616ACB5B0BA,0x20679DE91,0xA5A7E4F55F21772A,0x7564B78CDF4A83FE,0xFC69BAFFB0694A69,0xC901F3D18CF8236,0x6700FB7E98C13403,0x4FE3E0A1E3971C15,0x46CEFEC21B808ABE,0xDC18AC82397BEBF7,0x50BF2A584793125E,0x25D1218ED,0x6E0AF1CE384500E0,0x4C07726936DA3FD7,0xAD399E03009120FC,0x58E803ADADF3317F,0xFCAA84D9A01DE0,0x70583FDFE3E3C00A,0x4EFE605B255C9523,0xCA758875C2692E52,0x674191B77EB11194,0x6F013868,0x302A31E281667A9E,0xD155B836B20585E4,0x4341E585754FABC0,0xCB5C2A77C41FAE9A,0xB05604464EE18AB4,0xF68E26CC593F7B75,0x7E1F821408B0BDF2,0x173446A123BE028B,0xA6C62AEC6FA0967B,0x23470F0BA,0x558548A359BF80A1,0x23FFC78B07D90921,0x3E94893560350C14,0x729F8F03FD292F47,0x2F415AFD7AE75232,0xEF730D3B05C2604B,0x6B02B3F76F549C75,0x218117959D9E0581,0x9F87E46C298AA22,0x260CABC87,0x6385B7767AFC82D,0x5E3C882D91CFECC0,0x5DB50286839C91A7,0x93957AEB0A15B010,0x5D70E3566B2B9914,0xC4DD0DF149398E52,0x89E2FBD723C68088,0x5AFFD457B9B0AC3F,0xCD0FA04A090BA0A1,0x223B5AB4C,0x2B8DAECF0FD644E8,0xA9504D064AC17A5A,0x83CD2FC90891AB58,0xE5D8D26D5CE7C171,0x9CA4CA6AF35AA54A,0x1FDC00B296D1E1DC,0xB61A98C746108A23,0x8A9F54883EE9D6BD,0x8F1CA1A1228F3A36,0xFAF6786B,0x81FD979C03EC0B5C,0x9CB6DD9351CC1819,0x43734E30E26DEFE6,0xBB0B5702224FF75F,0x94DC4E91D6C04C1C,0xF6901077E8571750,0x70D0441B2AB5D8E6,0xDFD298415027664B,0xF1396A2866326AB4,0x1AD2A6125,0x7E43943162E83C9B,0xA62A85A0BA7B2735,0x5C250A6D9BD48602,0x66D8CBB9E0D3A985,0xE2CF4780C1CF137,0xD508BC675B42B9A4,0x74434031B5B21742,0x299745C1F47B61D1,0xFD7ED0AEC6F6EE67,0x21530308F,0xF07CC395F2F8CFE,0xCFF751D03DEA7BCD,0x71890C53B8371504,0x3ED9D4F4CAD59400,0x98C3BADC7BB2D569,0x9CAC63B17E4CD414,0x6B92B0DD43619C71,0x8B47CFCE876E98CC,0x6989160EC09709AE,0x21A5F67AD,0xE5E18F66B6988F5A,0xCB1B7DF25FFA585D,0x36FBE25185C08C50,0x10058E887CBFB1D8,0xD4759F6D822C6CAC,0xC0EBBFADADFC3928,0x3085FDE1D6E1E034,0x1D1F3AA91E2EB63C,0xCF0ACF3E9B3FACF3,0x1FD5F0037,0xB0B3E5DDAF9746F0,0x6789B771370DFAF7,0xC3660F96E01A4895,0xE929F5D44EA5C6CA,0xC0B99DA7D31B82EB,0x3ACE73A3251F65CE,0xC7CBD926BE9921A9,0xE94DE289FD5C324F,0xAA9801EDD8DB642,0xE6084AB9,0x2B024C49A6D7ED6C,0xFA3E4CB8F844240C,0x32188C307753E01F,0x9E376C9C81B66E82,0x7A2B2892EE1FB1E7,0xDAD6968DE9F49D5F,0x7ACE8D1072B1D33A,0x85DB1CB3BAE84E2D,0x9BA706F8EB9BF41B,0xA97C2E09,0x77AC64D510A67006,0x37EFF7FE559A4FEA,0x57FE2E7F9ED8106E,0xAFB6693492D5A8AC,0x7D9E7115B0B0C263,0x739FB42B17168FDF,0x46476BCCB65DA226,0x256463A979D65B04,0x115C0ECDC0D8D0B9,0x14CFDC27,0x53425E8DB9FB644A,0x4DEA52391E6F08B6,0x99C1F2103506D702,0x395AA12A8DE29110,0x402AA734CBA7516,0x324D8C59863DABBB,0x88B039C9814B472C,0xCE99E416B344E20,0x8A1D205C54035324,0x22B330A52,0x7BF573579CB7E897,0x36C014B283F5EBC6,0x69AD96F4CD027854,0x5AEDC5432FAE0C64,0x4CFEED48EAF99519,0x9880D1C95FC7B815,0x32637769B8AFE29A,0x6C120BBAFA0147F1,0x41F2D87980C71364,0x247611E3E,0x90C17610C84D80E8,0xB111FD49E3152FD7,0x3A1BFE31F784F00A,0x559AC21E74A1F4F7,0x39B491C8287212F9,0x6E6D74ABA4EE9E7C,0x5F7AC8560DAE91DE,0x6E0BBBA8F8F1E7F3,0x417F3EC9A5355057,0xD05F985,0x852ACD5E141D1760,0x7C8D8DD2966D4744,0xC4087CF14E6F9FD2,0xDAB85973CDA79990,0xF86C31CCFB87F44F,0xFBB6D3910CF12A59,0x2D9E8AC67C0729A,0x68A4F887DB1E96F1,0xFBBC98A91858A73A,0x17137815E,0x87CABDC9CC1E5264,0x411AB8CC14EF4825,0x9492964CC82A3370,0x1BB05CCF3693A770,0x442F1BF34B267D4A,0xA8AC597A73E25C9A,0x66BD60DE33E9ABAD,0xD5BC16CAB7296490,0xE204CD264CE6EF61,0x1AB47FB1F,0xD9A8C20FE192C946,0xC0DB26DBAEEA4AC6,0x5277A709D9E965B9,0xAFFD6894823937A3,0x280FFF9FF9F74233,0xDD4C4A7BBE79001A,0xD072B48CDFDC0AF3,0xCCFAC4AAD7EAB8EC,0x6832737465D83D4B,0x8D884C82,0xF3F3E82EC79B3A4A,0xF4D74E396F8400FC,0xE45F8E3EAC9EE7A1,0xF573CF70130B6950,0xA76F2B5712964052,0xFA77339466B6BC0A,0x37F298E3A55A2F03,0x6E6FB0427BC2412A,0xB185F0580AED83BF,0x1F1DBED38,0x2BFE651779D1429B,0xAAA85E2781B2E40,0x547EE6A2052AC62D,0x5E439581AA3506DA,0x65141DBB5783C37E,0x45B57CABB0C83727,0x151DD13F3EC5C24B,0xECA303A7C8AA5305,0x94E932B99C4E7121,0x1913B9FD,0xFF36BFA0F0D89E83,0x4D2716E684447388,0xEAD38E79641BA209,0xB97582BC5C28503B,0x110DB985E886773E,0x6E13AC3A097A0C9C,0xF1430B469522C0E4,0xBFAD6C001D5B363A,0x7BD669EF2B2F2B6,0x1D1ACF77F,0x5324030241F8C94A,0x680B881E7F484E3C,0x68533BFC2971061C,0x46F273D947F7253D,0x37C6738D2CA10AB3,0xD3A898D1B607450D,0xCB9DB4E669FCEEC,0x68FFD0C392D5D1B6,0x38A9C86960ED083,0x1C316953A,0x366AEA3B6FD90523,0x7E354E138589F1C7,0x209A0432F0888129,0x4FE4E2AFBA090089,0x6E0D2C67AA0C270D,0x36E6930DA1A6C5D2,0x3E12871A82FEC123,0xA7C16DBE26F4B80A,0x43535EC12369A099,0xB9A3929A,0x9EE2815487CAA4C7,0x92526C301A2DCFDC,0x33529DC804BB0BD,0xE2C12DB57D0451D7,0xB2E292C03016A289,0xC1AD1E2A1F03162C,0x33200E6400AE5D1E,0x7483AB15F68F9BAA,0xFC2E7806D2E9B1D,0x158966049,0xBE07B623C96CFF9D,0xA711430ECA2D4ABF,0xE54FED228876301A,0x67F400DE1A351565,0x863987AD56E07511,0x688D4AA7F864B967,0xAB9FB1C7ABDD2687,0x4AF84CF37FE4B60F,0x5509E2EC9B26674F,0xDC4A3A65,0x816B45F0ACA9EF0F,0x9E1C0DAD0E614A7A,0xB14A8479F7ACE986,0xBC911D76801295C8,0xCE8DEDDA6FC50EF4,0x41D74396A54D964F,0x6572851E05F2BEB4,0x6571521C5F00D57B,0x5D3883A8215E9F19,0x851332D0,0xDC8CEB285956F387,0x74DDAC5D845D208E,0x2EF34D2E1D369DDE,0x2EAD1B40064161D3,0x4467804BF5A204AE,0xF78C0A17EB1C84C2,0x1A1296E47356B557,0xEB407281311001E8,0x2213D0B5295834EF,0x101BFF3D7,0x9DF69AD494618B02,0x163D1DE5932B25D3,0x370463DA76370FF0,0xCA188F2118A501F9,0xF32B080DE8998957,0x5F28ADB5F0A91697,0x2AE04D1D400A00F7,0x6A4204EBE988569A,0xD43D57530F0D9555,0x25B7977BF,0xA7847A84C77C91E4,0x14A5D824B39EA2FC,0xA242107F656B1445,0x66957F79E86BF7B8,0xB8B2ADECD7B1A358,0x81A7E7508CBE87AC,0x94162ED1019A0FCD,0xA4C165DC2D0E78E3,0x81E9068AB52EF21A,0x6E47D2BE,0x98D75A9B719E1EBC,0xB452A0E5980910D6,0xA5DA24A3522D5EED,0x2FC071F286CF5BF6,0x67DBAF8389A7706A,0x150153436F55FF00,0x13FEAED3D10A43D4,0xADCEB874D41DC661,0xD89423F99B71C8D0,0x18A5D57E6,0xA9B4CEE725DCC017,0xB98FD7F6533303EA,0xBE330A06722CF1A9,0xB72DD0016B9D495D,0xE7916243E75FAF8E,0xD7AB354339D2D2F4,0xEB0CAC000D7A5D23,0xCAA9273D6F4625CB,0xACF63F49D8AC80F9,0x1AE888538,0x29D203D5C3F205A7,0x448B8A10910532F4,0x992F8F97E9A9B83E,0x485115662045D9A1,0x5E71E2ABA952875D,0x4F9E6B6F0E400416,0x6E5B0A80499C24A2,0x9DFD61790A35956,0x1CF493313B3481CB,0x265E798AC,0x7811F3D116DCE5A8,0xE016F12BEB882A18,0x8646323D5F8AEE15,0x842325AFD6508C22,0xC6E92FD6724E2DAC,0xBDF6EEEF73316069,0x5FAAC7930AFBF12F,0x4D4EED08F7934BA6,0xE083D9CFD13508B8,0x78B7193A,0x857A90847541F8E9,0xB3BA85B4C1A941A9,0x72186AEBC6DE77CA,0xCB21549346275F29,0x2BF463F152F02A8,0x708A97F229036280,0x8D9EFAD3B0230207,0x72694F15DE20D41C,0xE566C35BF8D5BEE4,0xC6048028,0x996C1076725B1EE6,0x1E00350276A0C29A,0x4CF72CED2C9E8E9,0xAD6BC279846BEE74,0x88C867CF823414B7,0x3BFDA87ACF96F128,0xC2B4F0C3F49C7CC7,0x1229262121B77508,0xF961664FC5CED53,0x1B3C19D6B,0xF8C1FA735A9FA7C5,0xF9C8306424A097E3,0xF931D1B48B6FFF4C,0xA7AB13EBF96B04C,0x2E0561DC69277B66,0xEA28E53CD0ED8199,0x9E9270BEFD2CDBF5,0x85D932177682C030,0x5159AAA686A561C5,0x2126372,0x341152AD38682C5D,0x8652015E4B6A61DB,0x980366BD4EAD3B3,0xC4CCCA305F076892,0x39854271540E935D,0x8092E9896D5F8089,0xA29A6790B376CCFA,0x56EFE75034996523,0x6AAF9EEC74AA982E,0x1EECF9EA3,0x647564918CCDCC4,0x8F4A3B7133064E10,0x1275DFE4990E935E,0x4E14135834D47205,0x99F42F362337C7E6,0x464200BAF1CE19C9,0x31F3A409062CB88C,0x84CABCAB72E16975,0x993A730F089BF8A7,0xF0193DF5,0xB688F6ECE49FCC3C,0x5FFCECD0BE1498C2,0x136FB21C5F05B3DE,0x2A1AFB490D0FC73,0x9E9C108BB9AE2E9C,0x8D66239123870D87,0x327E260A31D8CEE1,0x402A1B20292B31BD,0xAD9FEEF8B6A43FFE,0xB27FC2EA,0xF17396374C7F870B,0xC53500928711CAF9,0x2073AA15F419B6A5,0xEF8D89BE0EB787EE,0x513346F3EDF4EE87,0xA1BFE21E1939FCA5,0xF0E79FC117804D68,0x7909337ECCBC0193,0x60300AC1B695FB70,0x1B42F8FA,0x6B782545E2BFD524,0x8C48730A903D1199,0xAA57D132D133D00E,0x9732ED126A94CEBE,0x85C87D5D48ACC00A,0xE42709057502EDC9,0x286D0630CC1D95C0,0x4419FFFE266C8EE3,0xC1B56C873A09BE1E,0x14195C590,0xD7CF92D4E800B86C,0x5F402E2B9792164E,0x9D17D93948703FBC,0xA63B43D95EE62C85,0xE5E1613E45751E96,0x99831083F47F393C,0x77482841B508B875,0x925C7C9AE690994E,0x456EAA870298F322,0x805A97D,0x641182BF9D233B06,0xCC26D4AD9B8B3BB8,0x500AE6EB8D61921E,0xF1C2B516B5E5995,0xAB8701F05530AA44,0x2B43CBE27CA66EAB,0x400CFAEC3360EA60,0x9393A50B210ED71B,0xE639D83D54088529,0x168B6D087,0xCFD131FAC3180B58,0x5D730DBA802B6C28,0x80AC75BF5F78D214,0x25AAC7089A85ED2D,0x1E6B5B964AD51A9A,0x9F6F05DDB6A2F6CC,0x41E91A33C7967E9B,0xF30055617432F159,0xDAAB3974100E14B8,0x1606F828B,0x6437C67E5A432717,0xFBFC369BA0007CBC,0xC5EAF3E5BFB46D96,0x4B9B59274319B584,0xF17789741A23A20,0x40ACD28F60424EC,0xBC2D5E95F870969C,0xFC9CB4CB5743F32,0xEB5A4D5887723A3D,0x11477F5E1,0x19FCA0F8CF1963A0,0x5870F8C0795F63ED,0xC634684387CA5154,0xB2C8838615B3EA5E,0x6521E62E7FADAF54,0x77FB3AB26FF616E9,0x680F00B49A402CE0,0xBB7BD600F6429A06,0x6AE426483D9E72CB,0xDC262598,0x299C5F1FE365576,0x408F576A655B45E5,0xBA72F6DCB9481075,0xDC71590B0D047740,0xB93359F2758CD68F,0x711600E577D086FA,0xEDB260479E7E5FCF,0x62CEA1F4C4E705FD,0x438039A0A8AB7631,0x514A243B,0xB5E3A027772E7505,0x75B7C26654471A06,0x9F89D2EC7EAAD4C5,0xEBCCE073B558FDC4,0x74E36E2A05810A4D,0x4A441F7AA81FAB4D,0x7ECA402ED735C2D5,0xE0C4530F8E3F9E04,0xA82DA9015FAF5156,0x28EFD628,0x537500DC9A06CE8E,0x199F6C21D73CFF14,0x57D29B6160FAAC66,0xE1C3FB4A2021A89E,0x1C77B12DA1F6E9A3,0xB25E1311D6B8447,0xBE4022F71FBFE600,0x346B7D9AEF228641,0xB8082E86D2D319D6,0x1E0589C6B,0x79EEFB59C1E07D8A,0x8FAC12F64B086B91,0x2709459A562C26CF,0xB3528C117162297C,0xFC93A383FE1FD167,0xE575F1B5FA1B0869,0x38BB37135D19B6EA,0x13D22F4489FC2509,0x15414A910A156E45,0xBF333F8,0xE44AF5DE0A7FE2CA,0xE57AE55B1468582C,0x6200549918B89331,0x3B5980F9737F458D,0xAA453A872BB691ED,0x12171BE477D83FBD,0xB90F41DDEA8339FB,0x985D31B5C9C06049,0x2BF0A1ED387B6051,0x2C1BCDE3,0xAECA0DBDEFA3DD99,0x688817263D23169C,0x19CE1BBD48BC45D3,0xE86F775CEEEB39B0,0xF0EC82338E1C6E68,0x25F6578C5FC538DB,0x644C3D4061DCFAD1,0x9A99E5B3A5FA6298,0xC02D09E758F1CB5D,0x1DADB30C6,0x1B750A52DD8EA235,0x44A0E6063DCB2A25,0x93E676CCB5042379,0x6C14847CCC07A947,0x3A67E87ABE3DCDF3,0x77AEE101364F332D,0xA61250D9EEA62FC7,0x406FA403C5D4CB44,0x11DFB417F190A811,0x1BEF5DDAF,0xB23AB179C3CA1D25,0xBC36E54D41F91D91,0x8AD4948683DFDBFE,0xCAB87836A62F60F5,0xA7753A5C0318C03B,0xEB70494DA812CC00,0xA6DE53819A558599,0xBAF8A7B35B92A024,0x36656ADFBAD06F61,0xFAF6A263,0x1D19C41A3F90881,0xE403A30B5D5A77FC,0x2278077D5E600540,0x369F0C823C1E522E,0x3F79EBF7BC4BECD,0x60663C34D6200C0B,0x1CCBE2A64B3CF3F5,0xA6E8DDEB4E6C82B,0x30B5713CF8466EFD,0x129ECDE0D,0xBFD4ED7109FE77F9,0xEB7679C80F372A69,0xD51C6C733D855F4B,0xB0A107272222B5C7,0x113AF0802A17F2DB,0x800136557D0A9377,0xCC4DFCA4B4F5E106,0x7A05A04DCAF37A59,0x7C12D3369DD689EA,0x26E42CD88,0x73348360C5D0C17E,0x615CA9395717F482,0x4156326F05AB5445,0x31C6886D8FD461A8,0x3030F737E99E938C,0x243EB623B32AF392,0x7451FC9AEDA390F0,0xCDCE959A4CF96750,0xD1EADB3D926C6F57,0x172DB1EA,0xDDBD28D2B249F444,0x7184742979B28778,0x2928F207FFAD9FB4,0xD830ACDFFEE61C51,0xC9F9A3B272A5EC92,0xEBA5D8A836680C1B,0x2E98CAD0D244A3BC,0x366ABF0EABCF1650,0x80C0C51525B8C3E2,0x1765A2BA1,0x302211F2E20B7E25,0x40FCBB5120642AFB,0x67C74743A9AB23DB,0x6AC1C6069155B774,0xA6219F4BC8086A54,0x43838BF7ED3A6D73,0x2E7086FA546D4FB1,0x9835C736E5079FB4,0x7883FE07F0550D38,0x1AD9EBFC6,0xFCD9E61054DD7922,0xE13538912117FAE3,0x1F456C1568824F4C,0xB51870A2D2B8AC9D,0x88FF315516BD2F4D,0xFD695A5DE961AB96,0xB39B336D0E17FFEC,0xD09101E14C74B8B0,0x36E4F77F17CE1CB8,0x2099FA6AC,0x1C192695363A0EF9,0x85EB5A51BC50C61F,0x53C4E01EE945CBB3,0x6186D10101E6C0CE,0x5D065A48418927DD,0x9359C90E7C3DA646,0x7F374A25C2DFC67A,0x29E3FD0894C42D30,0x3A8EA52ACDABF52,0x99CB8C60,0x759746F3A4189312,0x793DC2D249B42D68,0xF62F89A1AFEC2D4,0x348301115FFB71F2,0x9652953D86CD5786,0x61F80A5401B7A4FD,0x719A55310995BC04,0x8AE26BFB11F9C9F8,0x98F083B155112154,0x5C7D7379,0xADED1E43FA672640,0x194E1A3BD93C914B,0xA29ACC443EB2387C,0xA447E16F24E11417,0xAC349A74598836ED,0xBB36175F979BD1A3,0xD39BA4B606588B6C,0x6D8D954E65BE7BA7,0xF2C9712F148A071D,0x2033A03EE,0xBE1CDDD5E30E0E3A,0x5F1910A0A03359ED,0xA6A44419C178B7BE,0x53D21C38D5D527A0,0x99C344DE4867D38B,0x57219A33F789D776,0x5660B86070703DE6,0x61B912F4BDDEB23D,0xFE7F6A8E3310F2C0,0x12A655DDD,0x27691A55ABCEF37F,0xCC34EB30571B2DF0,0x4FBC6E251BA3CD36,0x73089C27DF1DD2AD,0xDFD94956E3D7D48E,0xCDE95296BCF8FA15,0x6EEDCA307C80CB37,0x9DCDA19DCD66DD07,0x8ABD0DA84C6631AA,0x21ED5332B,0x4FD67611AD80EADF,0x1BA63093FDDBCAC1,0x2D7EB08199EACB6A,0xE96F4DC4FA7E77FA,0x766EFC13FCA566E5,0xB31E6051CBF229CB,0x435E27BF3022D65D,0x2636917F665A3EE0,0x7F23E22DECB97885,0x1710063C5,0x678A9E1DAF5D6A2C,0xD6E40B5540193DF4,0x73C773EE0414B6AF,0x43BBB53D78670C78,0x8067DF3653A7BE2C,0xFCB05AAED3FD0453,0x9789E7E073979824,0x30F3C1A05B45ADAC,0x111F7AD91E7DD700,0x1DEFBABC0,0x92A00776ACC6ABAA,0x46208439D2083C6A,0x6B4F0956D7F58D24,0x889A3EC3B24BBADD,0xF2D532AA07FB9CA0,0x2FAB99ADE69FD996,0xF490540CFA5CF887,0xD097574E87BE1C70,0x96707B00BE08B7AF,0x1573AAAF1,0xF7FAA765B3B0F28C,0x7E6A88D78EABB1F4,0x1FDDB6EF086BC14E,0x8648281E57ACFBFF,0x19D389A6D02714D,0xD66349B17BD3136D,0x639A24A00C967776,0x69204D9452D17E5A,0x9081197B883936E9,0x260856ECF,0x570188701449E893,0x7BEEAAA6ED2B924D,0xAF6645C2112E2F20,0x161A16CB34BBA8EC,0xFA5609E5E50402BD,0xBF5DB101B734168D,0x5D65966A19BED567,0x550EC0CF6DE16A9B,0x79FB424881F1D5DB,0x1C8CE7390,0x2EA2C0E24060217E,0xCED4E898C0CBB1BC,0x111F52ABE9F67408,0xAF2CCA5DE7FCB6C8,0x346DBB4AF62085D8,0x2C4B4A99A1C1557A,0x64E6D0F8F5A37276,0x503BC712FFB6BE61,0x6B26D1CA51F2C204,0xC62751A4,0xA7A7BE51008BCCE3,0x3C6DEA3E602D93AC,0x7B11CECDCFAA8202,0x755AC6194AB3E4D1,0xFC40727BA5F21B2A,0xDC646C8D4E0BA053,0x3DA11CD208576AC5,0x10EE2B8957D7E36B,0xCCB0962002976BAF,0x57E118CC,0xCA85F0013DCE74BF,0x1824876C67634C50,0xBCADB6A46952ADD1,0x18CD52A01AFEB656,0x39D605D7DDBAD64F,0xC410DE8655502EAE,0xBA9DC239F4D86BED,0xF01455A4B6637524,0x3EDDFA9339477F45,0x23C702E9E,0x835A68D074B4686A,0x15E5EEABDDC169A1,0x2FB49B8A2578FAAE,0xA46F89DA8BEB746D,0xCA55454E3A250271,0x515EE3DF1D54BAAB,0xBB6C0ABB58418803,0xB804EF8F7B1D48DC,0x99A3C97D9A059F8E,0x406FDBA7,0xDF12D1D5A994F9A1,0xFD87BF5FCF9D9CE6,0x6615434E3E4389BA,0x593D86AEFC3042D3,0x3884BACBA3265C88,0x5C4ADCEA504A6098,0x1DA989F95A9E1D0E,0xBA2A774C700E11EE,0x757EAB96C8BA5AA8,0xD84149EA,0xADE4D3D34793ACB3,0xEC983F089C59215D,0xED898176F12BE5CC,0xAEE5E5E5C9536802,0x164465C0A7EA590E,0xA8DFA3FDD8275E6A,0xDD9B9EF1ABF5CA41,0xF0F69215545BD675,0xECEE1C61203524A0,0x1FF2521BE,0xB06F02A30CDBE153,0x421C3DE1311BB4E5,0x7665906FCAAF521D,0x21D416A2258AA900,0x710317089335607D,0x3A2B8B6C432CC4B9,0x19E606C5F9F2E137,0xA4E80D0E8939CC96,0x8BA8C62EC54D2D45,0x748B8F5C,0xCD7E565B35A250D9,0xAB5325B2989BA1C0,0xA4C4590DDDBCCEAB,0x857F71A7212F9C1,0x7E8F27786ABC1B81,0x67C4A5D9DE2A236D,0xB420BB01822389C1,0x94EB3DC15FACEF39,0x7ED65B59ACF8FAB7,0x114B73C61,0xA295F536B295C17E,0xCE6156619BD32437,0xD99F0D1490232D7C,0x7785BD0EF51E59AB,0x1CB09A26A2754A82,0xFD04E7E7AA97A6BF,0x7BF4735D82939861,0x9136562E7B1513EB,0xB60F827857C311A5,0x5E51FD02,0x1384693EA7A5EA22,0xDA48317F20F1B93B,0x8CF4426E057B0A35,0x4A39E351C431B279,0xAFE3688B99704C56,0x43565FAC6A823658,0xA091186453AFD5B5,0xA4C62C7FF9DC7D04,0xE03DF755264AC4B9,0x8382C3F3,0xCA30E06DB3FEBC50,0xA207F7FF2EAF7640,0x2FBE96BB483566EE,0x3F0A1AD24CD8BC9F,0x574481609253EB6F,0x74C39A1F24426B8A,0xC902793C6FFA4C2E,0x2C6F4D2C65D12C68,0xA0DF72AE7A33AA60,0x4CD091A9,0x996DF940D97F6CE9,0x903E6B7B66FE03F2,0x8AFDC6BDE69F0660,0x6B3F790313C968ED,0x8F88442EB9D7571E,0x1ADE6854C51BFC36,0x2DD0BB780D0CBCAC,0xFF074BF7A7CF39E9,0xB1711C803B5AA45A,0x1B4FCE79F,0x7DCF1340800A2B72,0xBB45F6F09B4A1FD1,0xDC191B53273AA34A,0xA88AE270F7B28934,0xD0F9663AC82C5993,0x3C965A3B38BA7D2D,0x4E021068E95AFF22,0xF6FAA81919C17F75,0x392FCB9285D348F0,0xA9ED1662,0x39390D51C520761B,0xBD97176057EFEA3C,0xE8A5F78889CEE35F,0xAED4545A47292165,0x91D258E733B1A7C6,0x3F21E461C43EBE7B,0x94C6C5C9A9B3BA9D,0xE04C9D82FF37F105,0x837D513543E7C7B0,0x1AABD4537,0xFB74947AFAA6BC0F,0x3C16DC69EFB2862F,0x2F38B4E41F474B96,0x777C7451331CFE79,0x7D9F35164463FBE6,0x6D38CC106DECBF6F,0xA3639AD425EFA746,0x805D0BF02155A9DE,0xDA749AB55B3C54C5,0x959F699,0x7A308C50BCBF0A56,0x4253910A223000C1,0x21417CBBE4C17288,0x749F284AE2254774,0xF06A2BDF38534AE9,0xDDD44EBBF5669C42,0x53918561DF27CEE,0x7D7A992C0DC06348,0x9E8F5818DD4FA97D,0x1A6191016,0x163800BD92FDCAF1,0x3C85DC80EA7BABB8,0x9AE027701F1E89E6,0x426346EBA4F6DD6C,0xCED92338AE902E29,0xF3A0E7D101D1E603,0xE0A52D46EEDB1F84,0xF3760A7DF367124E,0xCAFDD0C8398AD45F,0x903B4C74,0xB73CDFC529B96E02,0xF3610BCB01331027,0x7C252947AFB69BEB,0xE4448A31D2F53F44,0x3332E83360E7A64A,0xB754638DD95573B8,0x3C84CFB45F630B5B,0xF37D94080553F2B0,0xB1038316808C20E,0x16FDA24CF,0x1E48D00B3AAA9844,0xD00B7C457C545A89,0xF8716DA119F1762E,0x315E5FDF10426147,0x7E99D39FBD0DF3F0,0xB3133DC551BBA114,0x7290177DDF50B5A,0x3EEDBA96BA975D1,0x64A7C2D46EBE35AB,0x1AE310C71,0xA26B47FC98785D95,0xC4CE48ECDD7A188A,0x13AD2ABD0613DBD2,0x5376DA2DD2743B97,0x10D2BD745BF571A4,0x40B202C63FD4B510,0x6F67C7E0DA86DAEF,0x504FB852D905BBB0,0xD1B7A73D1985ECA2,0x205940A41,0x94E7C8765F966697,0xDE58F501247AF8CB,0xEA15B03FEF686249,0xDEFBCE77A5F29F27,0x937105C05707DCF7,0x57C4AB29E3CE9701,0x213FBA84BD279834,0x5ABF74740C77BEF4,0xBFE7B903F827A1C9,0x94EA0974,0xF01E50F41498E0F6,0x2463128BA0CA2C43,0x9310F8D8D4946304,0x13DAE2E36BF8709D,0x2AD138BEC7253141,0x5EF9DD7771B4F32B,0x85F47BAD78DE254,0x9B7348DDB0031AF7,0xF86586C4B34B870E,0x25EDCD7F6,0x1B57A8218C8395C3,0xF92C1CD936AE518F,0x1CCC9B184BD39B30,0x2A245B9AC8A77890,0x76EDC5D7CC1EFC28,0x4DC2EF830765E1CC,0xC95E4DE5EFF872C0,0x63CE546120316627,0x153951D26AE221E5,0x93731ACC,0x8CAF2897E3BFD491,0xFC911901D190280C,0xFFC1F2E24F520E2C,0xDAF0B4714285807,0xC81454AB93567958,0xDB83907211FBFCB6,0xE7645A52A78FB001,0x5CB8F0A7D5D4B102,0x3818DD226BA9B549,0x23F8E8ABE,0x4CB2B9507E75DC77,0xE15265B55ED30902,0x78643D68F94926EE,0xEFBB54A08E1FD6AD,0x3CF8155ADA3A551D,0xC019A28B1FB540EB,0x806174F949D58078,0x193A18C32A0C51FC,0xD3E72CF5706FBF8F,0x10D8B75CE,0x4597D89A75C388F5,0xA801DDBA45074BA5,0x47FFA7BFDB1007C9,0xD746DF458A3FEE12,0xEB31B158870A7F2A,0x1BC3B1F710080E9F,0xD5C96B3288BDCDA0,0x590DB36F15AAB739,0x1AD7077608BC8528,0x24FC459F5,0xCD4D2E1E1A1DC547,0x96C1865C014796E8,0xF69CABA0144A334C,0x116C29DFD1A456B1,0x5F52942E1C5B2E6B,0xE78A6F86E3DFF3CB,0xCECB8071726F526C,0xAA767DCF3DB0A70D,0xAF6B850DE7F0B24D,0x23FC7445C,0xFF881655C9BECB42,0xB76954BA09DE87D3,0x5FC194B776F66059,0xD227A8A0DC202DF8,0x2B7B47EE2567DEAA,0xF1DB44FEF5081CB,0x17D389989CF97888,0x7FE30F81379C19D2,0xD35B3F0AA53399FE,0x14536DB4C,0x46619FB1A8DFCBC8,0x9E3E3B3D26D1D012,0xDB25CB0932BA6A99,0xA0D95F93C64AA743,0xBEB3A33AB9449C92,0x8975646075F9EE88,0xFFD7BDCB74A81DCE,0x16353FAFB10B9FA6,0x35C45163F726F99A,0x7BE2C2BA,0x5353B0097EFF6DDA,0x555105D5276A32CF,0x37CE06241C7BA6FA,0x15FB9A3B6BF8C10A,0x5DC6FDA1564094CB,0x34B1DCAE7CC76FAA,0x768AD07AE15A791B,0xC0C2B4532E701CC9,0xF2C12BC4A4982995,0x65691B0B,0x4383BB4BF5C1532C,0xB69901CF02E0C8C0,0x224C2E9C20395F8B,0xF3374D30FEB653A5,0xD6DA6B1F5B7E6BE7,0x905805466A1D31B4,0x85ED9FD1B2E7DC5C,0xB3EC601A41394F95,0xFFCBFEDF6CBD4FEF,0x17D23F1A1,0x806F658BD97FA48F,0x9E1B4A61FAD88446,0x212B61156ABB4F4E,0x9F38F6A53CC674D7,0xEC356BEE7C20B0A5,0xD22EE3EDE0765101,0x9C4B13635A8DEED4,0xC3616012DDEB7687,0x5CA914A829BBB8F6,0xC93E7A4,0x437984686047D454,0x30D086E637599CA9,0x7481FFD361BF64C7,0x6E08725230AA7135,0xAA5692983280A631,0xC236EBF110E29364,0xB02C64F1FF7B78C,0x1ED9A6D36E6A042B,0x71F93FE7739EA5B3,0x266388566,0x79013D142852E2D,0xFF7D0C8E6D461E8,0xD4818D8715559589,0x454CE91997964B49,0xB918A161439EA620,0xB388D6B3971945F0,0xCE646D14F45C0A13,0xF4A1221099771833,0x1D2C106BDF4D482C,0x8620B8F1,0x39B142F0491B3CEB,0xC20FB28D5B0C3D8B,0xF03B5623C2302941,0x51613757EE014D1F,0x64E83227268ACED4,0xF39DA42F914B5B8C,0xC90B01F070932C10,0x10CC6DB7F8C4F6CE,0x5F0B2668EA3193B8,0x45C606E5,0x5C07F7E460465953,0x35F59EE017BD8E55,0x2F68A25AB54DBEAB,0xE1E645A9ACD444FB,0x752F8B183582F65,0x3AC35165A555F34B,0xE8F655ABB4490C41,0x860CBB8A9CABFFAC,0xAED4BF344D8F1BE0,0x243B3A788,0xDB786CD3DA311DE3,0x8A0673A3BCA7280E,0x13B89529EEE40CA2,0x275E1F3975DF1F29,0x266883D7473AE28,0x970EA7BDA04A5D9,0x7F50E0165B495C1B,0x85ABB2151A24FA61,0x50A2C3941217E550,0x1DC5C4AEF,0xF20EFB35A2BFFCD4,0x2918AE11E2AABCB1,0xC0C7566C8E2B80FC,0xBCBA86EC9FA14D3C,0xE93DE7D0636732BE,0xD45141BF1081D1E4,0x2DE24172650304F0,0xCA82965166C378E0,0xC7592F82A0D0F218,0x90710F92,0xE80A78E083E1454,0xB65B7AA38DF2FCE0,0xAF9E4E046A27D827,0x6FAD1A87AEE257F7,0x75F2730730F7BB10,0x21F972258E33D68A,0xF80875F59C5D3EC1,0xB9E4E0A45A9650A4,0x9ED4507B24A74156,0x2FF005F2,0x806A649A191B7903,0xB06CCB6A75CC925E,0x232E56805289C7FC,0x309E84359A4AA9A3,0x9E912ED0E9ACFEA2,0xD58C59974E04321D,0x9324D2F1B89461CC,0x4381E7B28BB376AF,0x479F564E39C2CADB,0x29EB2D33,0x8E5BAC594C1636A9,0xE5AE750D5FA7EC22,0x41F8154EB7322C1F,0xCFEB15DFA17D2AF4,0x82AC0612153A63F7,0x1D21380BC96F8C6,0x2BC9E38212512282,0x4130916FE0EBD314,0xC3EF59F7A015FE37,0x18E4BE6E7,0x13D89589D89C33F5,0x9F41B79E8E3BB1DB,0xE587E667969E3C01,0xF502E6BA47185E39,0x402EB0CC2A468B6F,0x6B925620922EF16B,0xF24A18D9E6CD0A3B,0xE66126DA7107633F,0xC08634292DA1679F,0x25156501A,0xCC6BA65108BBF221,0x5C0D7FB2D25DFC82,0x102CB897D2215A50,0xE3A334C545A56D0B,0xF2813B7384F1CEB7,0x6833AE95B91C4071,0xE006EC8C1C3BAE31,0x6BE2BAF3386B97EB,0xD723E8A852FCBF06,0x16B679590,0x1C8DFCD437CC7AB3,0x9CD25B6BDFEEE044,0x6B0A5CCC6F94A277,0x4963994E50DADED9,0x8D486175037C8F84,0xDFCA1E1BAF0DC853,0xE60590791B6385F0,0x112680B21ABDF754,0xA08D04FC88521779,0x66B1B0DD,0x7953C3BBF0C31D6D,0x4DD5483D404FC021,0x26A1315A3D9546C1,0x50B8ACF4CAE02A14,0x6CD9B91312C30B02,0x72A0C4715D8FEBD5,0xABFD650401BEF56B,0xB832A3B5ACAF86AD,0xA8092DBDC29FF320,0x852A1F4B,0xA3BC70AA8F270C96,0x9522061BE10D4EC6,0xD9F69698B93D28AF,0x5AAAB73CE6D57342,0x8E51AC42737E121F,0xB50A940D38908C5A,0x89321B193FF97630,0x32A6B02E739CD7BB,0x9D131388B2AA08D1,0x59D5FEF1,0xB23F6F260003321A,0xEBE412A7597EECB,0xE6B61A203CF94E64,0x4378720399F31DC3,0x112E19A8ED46B8AB,0x7B98960B4E17D8E1,0x9AE971B278AA5CF1,0x5584BA0FFB34AE99,0xB14E95EE353F5FC,0xFC0B5E67,0xE3AFACBF4355808A,0x7046B73FEA11A914,0x743F9C3228B9F357,0x1B0BF5D80A731FC0,0x9D1A54A04F8433E3,0xE86580B6C58E28E9,0x601CBCB833952B79,0x24A832E21F855E0C,0x27B34AA47AA7D5B1,0x1D3EACD1C,0xADC3C7B15DE35164,0xA51A94CEE9120F99,0x2477F3A283BD7A1C,0x2AA3E7F14161F469,0x437EB5B353DE6A0E,0x46B316CB3DDE7949,0xDBE09F658B448FD6,0xFE040A149AF37A7D,0xC00C5A967934591B,0xA71688E3,0x68B4B835936B73BC,0x2126A5E97EF9EA8B,0xC4547235116833AB,0x59D8FDF3E13EE3A9,0x7395ED5388EF095B,0x6623762197144928,0x734805D4C6CEE950,0xB9D8BC4304CDCCA6,0x9C2C3B16016FBB05,0x5E86E5E3,0x6CA2C1B443B5E491,0xB485CE212C6C4502,0xCC0655E2811B6C8C,0xDBA5666B7FE26C0F,0x5FDAC2F6C186DC51,0x79BEE775CCEFA3AE,0xF9A242878FB375BD,0x9A739A646262F7B1,0x43F34F5CAA84BB91,0x1F929B4A1,0x112682936C9C823E,0xF6EC9DC9D19707DA,0x2C72574838775672,0x12CC348648F2EE12,0xF68A6F267574F7BA,0x2E74125124961573,0xED7C2D3C1D8E1BC7,0x40CB1657A4390250,0x75654E00C9FFB588,0x77DC17F8,0xA31140430CA59F0A,0xA71CA4F2A7E74710,0xB7421DDFF507E4F7,0x4258DB67969754A7,0x9E04BAA5EDD0186C,0x4B5ECD7200F2134,0xB88B2CF4E0ED1E3F,0xAFD60D3D52C34C96,0xDA572AF469D0F581,0x276BD3B2,0x4120E49E3E7B3077,0xD5873E82D3A89817,0xF9622C27E22D2C12,0xC2C85A2A5AB0889B,0xE57F57DDE52F6A03,0x60FB1BB7B4D8DDD4,0x3DB78F8AF42E80A2,0xA1D224CCCD24775,0x20108405E1E656DE,0x2055CBD2,0x6D6ECBE035DE2BEE,0xDEFA3AA75CA32AC9,0xD6EF68CBD593A50A,0x346C6C2325276323,0xDC7EED8EFAC10171,0xD61FEA20FEA34455,0x937A683802D77B96,0x2BCB6F499A3B3ED9,0xF74134E4D25FE7B8,0x1EAED8A3,0x78218D53DB430331,0x5E342BDB3D424865,0x4DB16B2C6649DCBC,0x29152691A96D5392,0xA809B0C371C89B2,0xF80D6680AE999B0D,0x901BE0313E0EA7C0,0x8B8BA58EF63DE9B3,0x7ED2DE4CA4AF3A81,0xEF0B68CE,0xE23486BAD1EC30BC,0xD3828C143600EDA2,0x824EE34B4BE650A2,0xF75CC1136724EEFA,0x68D43915F925FD52,0x57CC80526FEA3086,0x4B99E8CBF34D79CD,0xFFE80D8A61AE33B8,0x6E97F62C960E2CB8,0x274C634CE,0x411E663F9DE87844,0x500257879766CA09,0x93B5369D00E8F76B,0x6441D28C8B0B11D8,0x39B2AD4F2C8FFB9C,0xBC47D544FBDB3686,0x956DB4556AF719FC,0xFE89AE8D7AF732CD,0x3B004D31FDF0CCCB,0x8636DE1C,0xB7EA745659B4CEF1,0x9B370FAAFEEAC9F3,0x91E38967F236551F,0xF18912DF089CCAF3,0x5A99F0DB017D6718,0x3818363A4233CAED,0x9F2F76DDF9F04E8C,0x642E8F594E10EE23,0x3C378CABDF9F77BD,0x38280E3E,0x4FEB29A64E00B522,0x6C8E19D5404F99D0,0xB1935A6830A48190,0x21F7767D5C501BC3,0x9BAFB287BC8E8734,0x6B488FC8E61B8B69,0x1F7B6703043F89C8,0x95B26D460E19E166,0xFE6494083BBDFEDE,0x138935633,0xF78A60019865B4BC,0x9698EE12081D4021,0xB8CFBE7C237955E0,0xD92E8C086E7C60A1,0x268297CC656D02F0,0x51ABD1ED08B79FCA,0xD1F0D69B78433910,0x2E1855C88C44BCED,0xCD11393695A7A718,0xAE9FF71D,0x7F43A351E88F2B35,0x6A464890FF624C0E,0x3D14AF64C98B07D2,0x43FAAC70A7A2BF7E,0xF9BF166FB6EB25A8,0x228D9E719C93A9C6,0x59394CCE2EB49AA9,0xB282FAE2102EB9FF,0x5C90EA9C937D6E4F,0x10438D999,0xFD68D48886FBA816,0x26FF9DAC5A643CC,0x52440D1381A13DAD,0x3620F35BF72F3057,0xC27686A1C817DC68,0xC706464E68218684,0xC75D91EC8CFC4FD6,0xE48ECBE0A4844463,0x18E1ABC0C3740980,0x1ED8CBB70,0xFF7D7B742731CAA8,0x457783CD586CB6DD,0xFD49F2FE3C00A904,0xD84B7BB82567F859,0xF3DC9565702BBF73,0x9049B307333FDC9D,0xA1BA5ED6EC5654AC,0xBD31A0B99480E44C,0x8B1A6524D9F7928A,0x13B1A706A,0x2006918970B953EB,0x69BDC03AEDF242CE,0x8DBA550CF22495CD,0x2D0056FB1A44079D,0xF49A42F8D3C1EEAB,0xBB7F5F644F8086B,0x2C825678FDD54BB1,0xAD3762F3FF940C42,0xAC5272EF7890EDE1,0x174158E83,0xA1084AA6CD9C4C4D,0xA6D6E17D27CF5585,0xA973B3FD77EC5E4B,0xD30243A2044AE4E3,0x43BE8B2207873469,0xAA55FC7CF2CCB0BF,0xD08E0D7C60ECF4B0,0xC86CD99F01428F5A,0xDEAC4818043335D9,0x22E7C45D6,0x942FF1DBBE29FF14,0x38B8628485039C78,0x4E565C06F0FAC42C,0x637903F009C173CA,0xD0A513CEC42C63D7,0xD4314DF8B39C96E3,0xCE15D6EDCE418245,0xB388C89D293F1F95,0x8D241689F9997538,0x394D1429,0xCCE9F342109CC434,0x4571278306AE3308,0x83DCE810B08D2AF6,0x5867524B4384FD0A,0x171BBD63FE354378,0x3602EECE1A32DF45,0xEE97163D30F8EA9F,0x1DDA39B560991EDF,0xB0FF984ECA6DD4B1,0x194ECC644,0x321A722A04940EC9,0x1ACB3D0F26D571A7,0xD9B72ED8A356D243,0x73A63DCC023F4AC3,0x8859A9E8D832A4CE,0xE6E139697F50E252,0x809BCAFF48DE8F2,0x1FC152CF66641612,0x86794E401F9D5EF2,0x267F71737,0xCF08D788AE0BCC42,0x75ECD21FBC8F302,0x93152D9B001EF04D,0x102CECF35869D885,0xF30AC2B6E6A26EA9,0xBAC3346212489EB9,0xD010E1C5180306AA,0x7CF1691636D535B4,0xD020274F0155B0B5,0x1764DFEE2,0xBA86B73369370693,0x433F4C57E7E819B7,0xF737BC1F5B18A496,0x3755C349F8AEB5D7,0x5D60C3BD9EE7D733,0x4CC9DFAD683CE503,0x3CEFD32CF366D56A,0x38CABBAEE54B5314,0x61BD10035E8CD73,0xA6AF12C1,0x653DCE0B9A701F37,0x4BD3CA4DDDBC27D6,0x7091106EE488A9F4,0x8B1647FCE9E28983,0x20B83054E8EEE7B0,0x2F84F1FC3B69D1B4,0x71065DEFD89A3CB8,0xBDB2E1DE42F3ABFE,0xA12DAF8E9F5676A5,0x2583A0DF6,0xA34326239ECECC0D,0x9A87195733CB6F11,0x37172A9D6A8297D4,0x6E529D5AC2334D82,0xD1376A69B9304684,0x60BF9328135A199,0x8CBBB3DA21C0C6CF,0x576A2ADBC1335057,0xEED06D2AECC55569,0x121CD67A5,0x2F21992EE1B43B5D,0xE850800AE219B7,0x398B44D4C05F0415,0xB7E0E5C6CB37D9E7,0x52E2EBC2AB6CE945,0xFD2FD92EEE861CDC,0x8D56FDD48568C1A7,0x673CADEAED39659E,0x87D8E32B3B36D566,0x1528D8BD8,0xD18E54E8C8245AE1,0x9DC5E885AF4AC614,0x9C3FE6C284EF2FE2,0x48C2E366B81B564B,0xBA801F90D246A744,0x7B6364D4265B6C90,0xAD6A1CEA1D26EF8E,0xFF9245974172ADAE,0xFD5A6D636632DE1E,0x26A974202,0xCA902764D8BFA664,0x174FF73487C4917C,0xEB8A49D5B93D7493,0x2FC59E294D6D3306,0x40D98687FC00194,0xA6C5A1C1AA9B9281,0x416EB0D38DD9BD90,0x35292DE795293B84,0x8D90808B067A3068,0x148E2CC84,0x21802A58DD5DD133,0xEF4B3585C715A448,0xB863F7510E18421E,0xA73712FE1DAFAA1E,0xEBCA60FA2FE4CDC1,0xDE8A31370AFCB3BE,0xC741BE64DB38400D,0x23CB56C13C60F9DF,0x69F2BF57A529F9AB,0x274CAB56D,0xB4DEBB9EDAB6AD87,0xACC58BF6B45E26D3,0x51DCE7441FAE2A9,0xF4FDAB1279FE535,0x723FA80B6F84E494,0x7B5A224B3C43C600,0xADC9E096D3DB3BFE,0xA5DCCB639DCE3A2E,0xC96645FE6D4C05A4,0x1AC999618,0x274AA9A60E0A85C,0xDCD8539673742272,0x1CBD1C297E511A7A,0xE96172F2F9D5C075,0x81B25E08F3ECC171,0xE46C01E78D2988C7,0x4D5E46427FDFFD34,0x7A2344CC9C34C69C,0xAB1A09420C6DC503,0x26DF94B1E,0x878660724EAD0ACA,0x8EAD2E9F8CA4AA51,0x16C8354D7A9EF543,0x6E92786D72F426EB,0xDD37BD91FE931DD9,0xE4008EB3C7F29F82,0xE1C8157E4C285F6C,0x2822A680CF35C76E,0xD96120FA368E799B,0x1D9EAA502,0xA40FD9EE7A97892D,0x4CBA9C3291D6626A,0x7C2496EF4076269F,0xDB7CA4DD7FC760D7,0x737A15CB25553282,0x9D61BA00E2C8A928,0xA25827080586F516,0x4465D23D3FB77562,0xD3EE41C2F9FDC9FB,0x1AA2F2E01,0xD42FEF2BA6253ECB,0x276A5C9E721865C9,0xB4C2973B9628DBCA,0xCBC270777E18ECF6,0x6A7ABACDE024B5F6,0xC52583AF4617248A,0xAC40A9906F84A282,0x9469DB2DE44C81B9,0x4E5CFF34A0A5455E,0x20C681AA2,0xD183731BAA439A69,0x404BFB54511F6423,0x1E2A852DD1712A70,0x5E759628273D02E1,0x397146DBCA0FFF74,0x12828C57D942996F,0xDBE13B0FC47736A1,0x56ED4C4BC3B61A33,0xA16AE2D927AA5CB6,0x26E218DB1,0x24324ADE8C83360E,0x1A032A50D9212B36,0xFA91D5E3E65A0745,0xA19B36F71B8C6EEC,0x1D2714995EE2F94D,0x309329B0249CFA2A,0x7F88AA25814A5BDE,0x49D27CAEB5C0752A,0x995A708EA46F4E56,0x1534BF645,0xBD1FE52748B45D09,0x8479D8C3A7B5B4B5,0x81DF4F79CB571842,0xB418994A83FCFEA0,0x7AC73DE206BC8A52,0xFE101EE64775269,0xE7F25327016C09F3,0xB3555B7E266953B7,0x99B5E0E5175CF2CE,0xD63DDB63,0x9D970190CC729E68,0xBBABA6EC5F4197EB,0xAA19D5AFCDD1B058,0x8C06A9A4D9B0F011,0x968E40CD4334F500,0x7D32D57742559C6E,0x12DA818C6F5041AC,0x868886841F83FD63,0x85EF2B147B09560,0x184E5F93B,0xDB6F881730291593,0xE2A3DCF0F3201EDE,0x9FA1BDCBED9E879E,0x67371AAB396E5A44,0xE8BFDF1366E878FD,0x85CDA85054A4F7A8,0x6C48F935BD3906FB,0x2A8E6E8128DFF384,0x89733CF54A36E557,0x2EF908BB,0xA3E351ECCF907C48,0xE64F46662052B37E,0xFD8D7336C7F8A64D,0x6A5049F0151B5E98,0x204F2BF024A0C15F,0xCA8013B369378B16,0x98AEF0BAE6A87A0A,0xF9399267AA25FABD,0x5DADCFCBCC1FA36E,0x18B9780F,0xFCF650339A99EB9B,0x5CEA3052A4E53895,0xAAF74F074A94E2C1,0x6DA7320961646EC0,0xFF9106018D9264CE,0xEF9ED55E9FA3E7CC,0x515C8B385333D48E,0xD10517BE403603A6,0xB6681E24213AC2BD,0x79095B1E,0x26E02CBF06747FFB,0xA7ABBD3E06DAAD5F,0x10A21AEEA0823930,0x65BCCDEBF3AE8102,0x6534356EE744EE56,0xCA36AFB1D4C1938E,0xEA321BE81CA7BCBE,0x8503982DD0B6A72F,0xF9BE6608594E8478,0x99DD1B07,0x5FE9496221EFCD26,0xF1EB7326DA59F7D2,0x4F344AFE33B7AA10,0x91AD6BA876833DF9,0x46EA9CCC5269A781,0xD19A9D348B6B4407,0x3A2D08495CC11F7,0x75803FC4CE3376BE,0x82BDA12016C4D960,0x1DBE4E635,0xBCDAF60718B67F90,0x5C01EDFECA5D7DF6,0xD973959836DD329F,0x1805C170F8EE0297,0x5392C756A62B9AC,0x3785E4428A0F20FC,0xF8F929628D8B81DA,0x7A9AE2D16CEEAE5B,0x1E0E3A44D9290524,0x2223E5846,0x24C7E9774E623063,0x1CBA6B8671DF95C3,0xBAECAE0D4CDE7B32,0x46B85FC838341448,0xE6BB699A8FB20177,0x790CE36966AE8C58,0xE1BA20392D166358,0xFB5773B014519721,0x2125DF7EE3A1F626,0xF8E873ED,0xB8A03C915E9C03CD,0x8A8C6B7B967A0EE2,0x7F52954E2AAC0303,0xBC2FDD9E078C9032,0x8849354F054EC7AA,0x96CBFF6A4B9344B5,0x170253726E313F88,0x554B3527EE796FD8,0x4498A11DA556B5D7,0x2FBB2668,0xBB9003EAF62B5DD3,0x3A2FD7A1C7D5D280,0xA1C23CA3552BF803,0x7E24D86C6BB73D03,0x645A9E96A9B4FFF6,0xA37BB4DE6EB34CD7,0x1EDF9F010005B981,0xC280D2EA3C3FEB61,0x2D7BB9A34EB5230B,0x12A0EDB7E,0x317A51F8D1947E7D,0x348BBA33C7A93CBD,0x9D3343094EA1C21E,0xAA2CF3B544D8D53B,0xFCD14925C1D44F92,0x3B982128D956663D,0x72F6372AA32BFE6F,0xA54E7034C9F2FFB5,0xC51B856C3384AD0A,0x1A1090A6,0x919C99B4A81C616E,0x4900F79F7BB2C9FE,0xB62E29EBC7063AFC,0xD1B73B953438CE4B,0x350B4D1487E51855,0xC5ACC92053D68592,0x86D60C4B474E3DDF,0x615062802492B741,0xF9F35DC9D8B8FCA3,0x1BB17675A,0x1537DE366B8479F5,0xCA76FF2A5F773FAC,0x726E74AD2474BE34,0xB9D65754C2DE5596,0x77433DA1BC86244B,0xCFE9417BCF2E1AB6,0x79AE00E2D1397B4,0xC3E36CAF8387B6CE,0xC171B745CAAEFF86,0x1661B3B62,0x782F3837A52903EC,0x376E9C0E1EFCD886,0x94713E88CE5C182D,0xBA5821B69B61744F,0x2E55A87CD4707CA9,0xDBE6A94B82F49F85,0x354C61DFEC908C73,0x8AB288636B10BC35,0x29EA41B44DE4A606,0xB6E5615B,0xB1278B35908ADB13,0x1C925B6B7B8973E6,0x9C0663AFDDAD0C7A,0xF223445B83889126,0x2A9B8E46F4AB602A,0x47A097C0B73E2ED0,0xC477B52D6D246A97,0x4CDCE12F79644310,0x9F810DDDDED35570,0xF63464FF,0xC35BF9F2689426E9,0xD3767070D45CF590,0x7012972331694382,0x6C3677D68CFE9D17,0x336369EDE5DC71DB,0x83583BB104E3FD0F,0x10AFA8F6A9558FCE,0x46136E02E3FF5C5F,0x5BDCCD44D84105D5,0xC065D3CE,0xD401D8EEA6AC3B71,0x695F0B82916DE78A,0x701FB85CF14ADDD9,0xB513D8BE48FD3935,0x4F75C1B4CFA79D4E,0x6D16C110EA5F93C2,0x908D924A510B2A43,0x5EF271C08AEF4942,0x136EF0D4C062CD17,0x12FB05BCD,0xB7A4CA6A995D52B0,0x944B7764DF444163,0x119A4FAFBFF703B0,0xA8CC80A6EFB975E3,0xB53465AE8AB1F872,0x474BCFA08A36970C,0x65B95A37B214B856,0x33BFAF99E4317BA8,0xCBC2C2B2999C8B77,0x2313BBE82,0x3916A5B2B2B61E4C,0x8A7B71937ED9FAF5,0xA57E60EEA8581DD9,0x3ED0649C1F487E31,0xCEB0BD68C3A41CC1,0x218E26C2AA7C061A,0xA5F45E936AD0F238,0x99A3CA44892BFFEE,0x5ABB99134B474481,0xE0EBD2B4,0x651BCF75262640F,0xBFF13E645F3918EA,0x4369A308BBD7E3BA,0x61F8892FA5F12CBD,0x7AA954317AF73016,0x1CF62B2065411D3F,0x67F3A57EA33D0BE1,0x643C6AF99C0C0A4A,0xCB324F0AD97CA068,0x127B07797,0xA063E4D19353DF41,0xACC94DDEE2803AE3,0x84EEB3701C643387,0x11169212B707888F,0x60D0584CB849314B,0x7D22E498D778ADFF,0x742235D8D9ADA056,0x796E4873210409EE,0x38C0834A1FA12B9,0x14DB775B1,0xDEBCE6C6B37A057F,0x2D1307FC57F78EEE,0x39A3ABD8364DC57F,0x556699543F5B1FA1,0x3EFA52A24E4BEF5,0x4737A9745213FEDC,0x99EA12DF9C795981,0xE32DE54676947021,0xC976E4573BED8781,0x1F9C3ECC,0x79F9B867B4A22B91,0x155BDF2D35038429,0x616941F8F77232C,0xE744FB67AE0A9665,0x2DC5474F5AECD44B,0xF20B616EB720DFF5,0x8E4BAF4BE1B540D2,0x8F5CBF3662663EE,0x88417D1D8DC3BAD1,0x70D6F84F,0x1925C626F5DD69DA,0x6684294756E2003E,0x455CC1E536E625B2,0xEA851404E55C13AE,0xBA318DB6D431DA4D,0x2809E28ABD0546A5,0x956A8B36016267D9,0xD905347E56F66B70,0x5D58B25854932B98,0x12A0D998E,0x69E8A6EB231313C3,0xE30B8802F004C3A8,0xAE6E1A675A65969E,0xA34A1E464A2CDBD,0x4FE80571EA22E082,0xDDE7B3775AE57C44,0x64B7ED003D70494D,0xB4818F6830EC2A44,0xB1252D814B5AED9D,0x10DC152D,0x1D958139605F80AA,0x634506E7D5F49C71,0x537C2E98339E2E4F,0x3B5486C335BD9428,0x5177D72081E8F824,0x678C1701663C5F88,0x2A248D9173A83706,0x2A39C57A01BC3EED,0xFF58FEAF29E1B678,0x1F8F678FA,0x295DCE61A95EF9D7,0x2FD55297C1777197,0x88798A1DDA24A76,0xA07A6F9F59203A26,0xA9D81ED2C3411C5A,0x71DA7AB6BC54891B,0xD5F843AAAAD500C8,0x9E5A03C2EC5681C3,0xB935C1344EAD0A3A,0x2739CA96F,0x2E78F3EEF93B80DC,0x8EB2F21498EADB3A,0x9ADEC33B232A7DD1,0x82A3479A701F03E1,0x8F7A5F18F6B6D3C4,0xBD1FE6AABE65833D,0x8FE9AA49C09AAA5F,0x6CAECAB750805D12,0x9AC98FD86CFD7990,0x25EFD258C,0x1A05C2967ED17181,0xC1EA4B5A02D2E598,0xED25739B5C785ACC,0x500F8AD670EDD31F,0x9CD308EC60FB792C,0x14DA94C0ADD7FC13,0xAC42C0CA4124DDA5,0xE7E9C840D3344EBC,0xC17911E3ABF3C779,0x1573EC995,0x844EB4CF361BF43B,0x8E66884468E60AE4,0xC0002BB70D4C0754,0x10582BEED3C7F295,0x8CB56F32C5CB0DB6,0x3175CF17B82F01C3,0x6629FB8291096B5C,0x5E5CD84B34A182F,0x89E8B9E133BEBE34,0x13BAEE83A,0x231A021BA9F62F3C,0xD66482B03B705039,0x7AD3659E125AB112,0x4D7CC5D7836BB130,0xC2077CF19C6BD3AE,0x780050F01B499210,0x459498CB469BFB56,0x7F7EB7D5047D18CD,0x965B9E0DE473A29F,0x64097534,0xCCEEDF7C3ED24367,0xCDE5D31D7E195CC5,0xBD405E4AD3D6F707,0xEBE1DF723E7AB367,0xF30F88F3C4443022,0xE538947C30C47533,0x763190EC9208BC46,0x655D081D946B2A3B,0xC89EE2F62C66C0B0,0x93867E74,0x8C84FC64034A5DFD,0x2771650F6E93DAFA,0x89D5BA36D9524088,0x1EE10E21B86A28D0,0x139AF5D04181D0E8,0x1D23DE08F164DDA3,0x952CD17244940B54,0x211BFCF0FB2078C9,0xF8D002A7BAE9A4E8,0x2215D1622,0x4AE6A47FAF97A225,0x7975487D74DE69AA,0x8BCAFD5E6EB49EED,0x69E8415939311031,0x12100001150B4BC0,0xDE89AAD7E691FB93,0x19CA43CE8BCC1EC8,0x4CF70CA2DFE6FAB5,0x5A2211F9E5A2C36C,0x1D4B6AC3E,0x4B1189218BB393BC,0x58955D3602E9B637,0xF6A714058E39F0,0x17A8B6A8DBA5EBF2,0xE76752A873AA2A11,0xD36C527FCC8A3384,0xA22CD31BB0BC85C,0x5DB74B1C3DB787E8,0x91329FBC55638E22,0x1E01D899E,0x275A6E8FCD034B64,0xBC6EEAA086B125C9,0x5C369AC2236DA227,0xE8885CEF2EAB74E7,0xDF347A9F97133F65,0x32E99CA57C9A3091,0x2D43367C7660CB88,0xB99D1EBE43F5B298,0x6B92D90C1BBEF49C,0x195ABCE2E,0xAED9916F669449A1,0x60E93E60C15AD154,0x45EC2954041D713F,0x5A2D95B63E96156E,0x22F1BC2819334F0B,0x94D906B9CC4CCC75,0x7B9A33D90D49EC6C,0x2C4292AD6B49B460,0xC32C3FFB53ABEBE0,0x23A5E303F,0xB2DB2E653884E9F4,0x62CBD64659E45EE0,0xFAB03FD08CC39ED0,0x5F546FB6E865EFF2,0x49BE9000EFBE72E,0x3D263750CC4BC3AE,0xD4AB7F744FFDCEE9,0xB398257A232ABF21,0x1AE939F9A28915C5,0xA6014240,0x90DA28EDA7BAF873,0x50B74A8B3F277EB0,0x6CEA68E5847D5EE7,0xF85BD6B9998BD5A,0xCE46A253D261627F,0x2872FB2B829619F,0x64BD723594FE2075,0x6FE69C8E770F3B80,0x71D8BEC7ADB4C154,0x2360A6A67,0x44FDA549F177E26,0xB67BCBE41BCF77F3,0x8276FA7CA1F4EE7E,0x678F01A79CB21F0B,0x6191EED3AA75A29C,0x632A8457D645D34A,0xE0CB7B952443CEB7,0x2151446EEE572E9,0x6D3AB35ADD3C26CE,0x21781603C,0x2E28041919BA710F,0xF513C64B2CA7095D,0x974C65B538F50580,0xE9EDC533EE4A351D,0x7049AAEF76878031,0xB3035CF2A96ECB18,0x603A6A4708BAC55A,0xA5E0538F154A48A1,0x701F815A5A128D1E,0x26EE56D5A,0xF769BC0E05574D01,0x787E93B180B1980E,0x65EE5129130926F6,0x913909333F09BA88,0xC80485D54E3D19E3,0x74B9E9FE86E1A08D,0x50A80B38B0DB0B18,0xF9C4E996D09570FA,0x68D4228F98583BE9,0xD8D764A7,0x46F22061C2B33A91,0x3C35B09357A227E6,0x7A017431B35180FB,0xD660958DEC204570,0x1A9FDF6FA56F943E,0xEBE9BCC27D27828A,0x9D9916EC9076EC76,0xAF7436563D2B3554,0xEA8E50F5385A61A0,0xD9E82E65,0x6CE3C4F60FFAFE0C,0x155C1B6D58BF9898,0xC34BD29BD68E824D,0xE6862AEE34AD7F17,0x9BFD5D3B71C859C,0x507E12C8CC2131BE,0x2415F7129EF2BD44,0xE1278E00F69C67AE,0x3150E0C150E4C6C3,0x11514EE63,0xF57263BB8AB8D43,0xE0887543DD3EAD01,0x96A9C6F6D90E90A0,0x4050D85C2A934F41,0xB29A2FF982A0B0D8,0xF8E182D6AB9F7842,0x46B6F6585DA2A44C,0x6AB2E19D1CDC8CD9,0x1EC61E06DDC64E54,0x1D4C1AE9D,0x1365E54D60F1CA47,0xB7A0ED1462789576,0x8EAAEE86E3F31AE0,0x7C18530CBF24A5C8,0x6A80ACB6A6641947,0x91272BEE66D9F503,0x5F195126386778BF,0xD67B46C67984A933,0xFAF541349C89FCD5,0x1A6F286C6,0x37CC1A3725BC5AE9,0xA3AD9844F44A15DC,0x823846BCCBEAF041,0xF4F1494E826ACB8E,0x779EC0BA40FF7DF1,0x929276BF1AF03E9D,0xBB490DB3CD945FAD,0x31650DCF7143F0AB,0x93C8EB9093CF1143,0x27932D6DA,0x4F8EB5C25F19CF80,0x1191F02A27B85829,0xD4A0254C3EA8ACD6,0x9656CABD2E101FCC,0xD796681BD5607A68,0x204A857DCA703A55,0x3674F1A4A1C83F45,0x3B1D09A409C6CBA9,0xC2968B0496110D96,0x145CD42E,0x2B2B93D70F1612FD,0xAEACE0E3827CC33C,0xAC1103518728D7E4,0x59C267DBDF7A545C,0xAEFB0C1C17881F22,0xA5F05A59E4E83DAF,0x5637000EB3C6251F,0x9A29D34A0135F2D3,0xBE163FA6A56C435C,0x1CC589B32,0x1E47719B3409C326,0x21E592B467B662AB,0x77632E2DA452CF0A,0x178A2501BD4D26B4,0xFA6FE2B759057219,0x4D844895000BD158,0x68050FA9352FEA6B,0xCC8960C9D685F48C,0x2945853831A1995A,0x37292C3D,0x9D9D3A30011D0321,0x7DB080D5FF57D81E,0x1B7CCC2EDEF00DCB,0x7FC09DC224D89A95,0x34AE7211662FD9F8,0xD5DBA4F225F149E,0x90629C2AE486896B,0x6B204CD880468D4D,0xB0EA526E727AFF36,0x1B02FAB34,0xCC8987900FF1DE70,0x61CEA805ACCC1ED4,0x1068C282400DADAF,0x429C934608F92816,0x208FF635C52F61B3,0x7E77D8CE04947D3D,0x54AC9AB920593EC2,0xB93F48BD07617E7F,0x7A8B486B6CCCFD7F,0xAE0F4AE2,0xC8D8F3F87B1A0BCF,0x6A7457EF419274C2,0x75CA360F6BE5D317,0x54E816A356771A36,0x84B95364DE6873B9,0x6021025925349F44,0xC906D8C12BCC9F09,0x3449A624D8D2EF67,0x326E7A1037E3A993,0x1090990DA,0x7EBD10F5B3107BA9,0x6FAB4A4DBFDC1594,0x9A46C1CFA0EAB458,0xAB4997ADF6F07577,0xA1729440BDB27866,0xFBB991D911E9068,0x2FFBB02997890222,0xDEC0761F739BA9C6,0xC38ED39FBF55BFC9,0x8A3F9D6D,0xCBA6A95B207947F7,0xC69A42630E477C52,0xDB48621925A2131A,0x61CBF08FF6165A2F,0xD0EC1DF64AC75A87,0xEFC6C8552FC8731A,0x6C501FE98C717329,0x527147CE1E74B019,0x8F2B13D8ADA04184,0x23F9664E6,0x3F688951803DAE73,0x72353DED5D79F872,0xAD6B048C0E54BB0B,0x971EE38A0746AD87,0xFD29C905FAACA9A2,0x6D71B308236F4214,0x48F742FE1FC11521,0x27A255A3646F72D1,0x9E53E43F0B039359,0x4E15F6DA,0x8BD7C401B0945D9,0x4A99A0DAB0D13DA8,0x5621DAF32778D994,0x946F34E2694947B,0x826B64A9886A29E6,0x343407EA78AF2CB7,0x6BB59AFB7F177975,0xD2CFBBF601019E13,0x7FD7E8B38417B29D,0xA1DE2A45,0x55C77A046EF838ED,0x6812DBEA93841460,0x288F610AF3004813,0x910FF93546F8A51D,0x577A9AF2714AE10F,0x521AA76A770B1495,0x9E35304B155D3CED,0xFDBB5C8F64325DB9,0x1E665AD1B14E259B,0x24E1FD4A4,0x72AAB7587947C062,0xE68E56906C65DC18,0x925136809113703F,0x88CBBCD24ED24383,0x58224AE314AA4BAA,0x331B02401A0B5200,0x608917F82911E855,0xBEF03144B895CC6C,0x38FE433AA463A643,0x1FA7F0714,0xBF57031909321678,0x1DC4DCD25F4CBDFC,0xD0BB57C64EDF51E9,0xE71480E6AC46493A,0x6062B1F3EDECDDAB,0x39504D7296FBC35,0x5DA011C0D49C3A09,0x71C91C0EEB7C8F3D,0x807BD0522F49F500,0x1DCE8680B,0x2EBC6C0452BDBFD6,0x35C635B8493CDD2C,0xAB6EB394361859DB,0xF6DA4A03CB93087B,0xC44B01D17266D906,0xB893C81927D20D7D,0x6CF2D14871235AA1,0x1EE4303130FD51B7,0x86CF8411F9A9FE74,0x485C18AE,0x2874AE4064C5F789,0x564B072475CDA31B,0x4D3B6B8548A3E099,0x5B5D4B24E1C069EA,0x1C718BDE05ABED63,0x172B07AAC603C6D3,0x46759205CA7FB181,0x66A162947D839BD4,0x714D6EF9F58589A6,0x174BCE5AB,0xD1997C5B4926323E,0x8939DEBCC72FCCBA,0x1BA891DCC6D5EC0B,0x77CD99325370E393,0xE469F49B192C9DA2,0xCDA1098DD20ADB4C,0xDAC5AE1BD6F0306B,0xB98E5BB4DD29A646,0x56E3BFEBD4A9E8BF,0x215D137B2,0x487A1CBBEA64F77,0x3D7B919274C65677,0x452F9CE860146C4A,0x87E4DD273DF03DF7,0x34A0E51557DB295C,0xA18B3C3D4DC2E23C,0x2B0414BE0C5599EC,0x7BAA403164C841E7,0x34A2CD651A68CB77,0x220663D15,0x4A678DF9BDE1F2ED,0x5BBF74B8BCE86421,0x80C019C8D91BA124,0xEDAF951564900478,0x24E407696D42E2EA,0x49BCBA502C52B94F,0x180F1B4B2B446DE3,0x2DD1B45BC92992A6,0xC38E88408431C261,0x712A4292,0xFDA477B79C5014F7,0x456051E55BBA869C,0x6F67F70649D9BBE0,0x2CD34A7D4EF404D6,0x724962EE9200A9ED,0x89B2AE95D96248CA,0x7E104031696EF471,0x534FC11C7497E9B3,0xABE59178D49B9BEC,0x8641384A,0x2A9DF1846BA0163B,0xF3828ED8A8A75AEA,0x892A098883943A8F,0x9969C600F45F7EBB,0xE30394D9D6A481E8,0x161A94222AC36F09,0xF14FEC4C7D0ED7E2,0xF5654ED6AE57B92B,0xB264FD5AEDBC39DF,0x52636D0C,0xC06F895C0EEFD2A9,0xF6C1F53AF507643A,0x8165F85877DFF08,0xA653F9C402F95F16,0xA064AB0AFB4E40BC,0x82191616C6C06207,0x1E13C8BA8A15FE7C,0xC01161BEFD17DA98,0x19212B32E51772AD,0x1895F0153,0x603E93842E417A71,0x7571A509742C8751,0x343CA95DCECA3C44,0x52B9C0C8E27A17A4,0x413641FC7485F71A,0x12A222CA9BA34B14,0x3063CCB51872700D,0x6E3B07781038AF04,0xB46DAC0F71B3156,0x235D2915D,0xA79EA7BFE050B36D,0x3FC444ABA99AB9D4,0x4D63F900D36CD020,0x44D1F56E034FEA36,0x7AFFEC416008EF14,0xC17B520106C082A5,0x9887F53BFFB9A848,0x6F53F55D6F1ED0F9,0x39AB16D01EA796E0,0x170840AF5,0xD7FBC3FE78DAC733,0x4B3014B643DAEE54,0xC0561041D83CF727,0x7085F3E03E7CDC8E,0x107A213C31189359,0x52D6A87177E12151,0xAA2FED1D77E28C80,0x8B0A22FD80117439,0xB23509DF3DEE49D1,0xD50D8446,0x26921974A159EEAA,0x4F450B7E3941ECFA,0x334E4EA94EFDA838,0xFB17F03A43A43972,0x44AA4A20A1DC4329,0x435FD6D6E4A3D21E,0x42BC2058DB024F9E,0x793E2F5DDCD36172,0xB2DE488BE4DED86,0x28B5FC1B,0x4C2944EEDFEE2B0F,0x72925CFC39C9C1E8,0x2B7B15E5A5623D9F,0x8A936739E45FF1B7,0x36F4AA5F2B4055F6,0xBDC161EB9423E31A,0x59FF7E7080076F,0xEF3ADB105CBB14E5,0x19377EAE1B6902F0,0xEFFBABAD,0x6D618F2B81816DF7,0xB29B80246F83FD39,0xBB51AF17192A3C78,0x530D29E3D29AFE11,0xECAF4EE3D9BD86A0,0x98F6F1C71F7FF2FD,0x921AFF42989B3FF2,0xB1A79900E22AE959,0x888C8B1D3C5D2B3C,0x1A4E09143,0x11A5DFBB711808DC,0xCE65BCEAFBD12FD7,0x5E8B344F65F3687,0xF011CFC70742181B,0x907BAECB28C81084,0xBE30780FAC888601,0x253393F475065529,0x54BAD25374546EEA,0xD91396ABA4BFDB6D,0x14C11DA15,0xBD0C11148F3046CA,0x71555960D355C76,0x9DF5C21A7980C934,0x44DD1A974DCF8F8E,0x8830ED415D41EDFC,0xC26E97457B28D2A2,0x1D1CA62E546730D5,0xA80A0C6310088192,0x7047D3FC0414F03B,0x205C92DC7,0xC40BA6439CB7DF80,0x351B5EB2B80165F7,0xF55B0B002C1930E4,0xE207AE3CA4A9AC61,0x11AC995801AF89C9,0x1A0A0F05957083AA,0x89C04ADF564CEB7D,0x763EF6C7D0AC63D1,0x7CF3AEAF84B60C91,0xA5AEA19F,0xD0CB82D7774649DF,0x6A8B680EDE22C6D2,0x897B796CF39BCF11,0x56C8FD1B7ADC5E,0x545A2FF99E841D9A,0x740985023F5FAFEA,0x536ED04EF8921919,0x3057A4EAFC157794,0x74FCB1BF6FF10E93,0xE3BA38D4,0xF18B9EA1CD625A2,0x126F9DD37D73F63D,0x32D7F913D4240BED,0xDBA2B4E5435DAEFC,0x42BF2B4CC0D0BE79,0x839F279C83A96385,0x353EDCEB5003370B,0x91229D8AAC1F503E,0xB8A0B7F69ED00F53,0x5C4A9937,0x584A1173F705A3DF,0xBA15BC7E6EE19DA6,0xAFED821DA5ABF2A4,0x20B154D72D0BB622,0xE4C521B6A2531FD,0xF3BF71B955A56A10,0x269535E2BF8013C9,0x9D534739FCDDEEFE,0x8A75FEC2BD8546D7,0x1EC7BECB2,0xE7B71AB08C1882B1,0x2B69CE69A0202EF0,0xFCA23FA1D8DE7826,0x5B7DF502E3F23AAF,0x676A2D50E8B214E0,0x3D67DE0462CDAD0,0xC6E427078F3E9D48,0xC3B92A59D7571C68,0xAE968B1DFB37C305,0x2197D8E7C,0xBACBD38C4E5A0682,0xE11C2D2E9A7173EA,0xB8A06099615D630,0x120C803B25084899,0x7D877094F5B89270,0x540C45A5A7D331B9,0x620011C66C69682E,0xD162F768384000E4,0x948E0504F54C8E77,0x115684CD6,0x2616AB7687C54E9,0xC0C786D5E711BDFD,0x5B4546052DD6C3BC,0xD1268E820A3414B5,0xE5EF2C62A511B24F,0x3B6B3E1B93F345A6,0x686DB8F5C23AF6FE,0xC5868B5E1E528368,0x5773AA7BB8B58D61,0x2C0255DD,0xFA58E8639161A636,0x55D4F7F5A8DD2796,0x660957A67A41DB39,0x7F0607B1E697DBA1,0x5227711DFA097AAA,0x1912B15CEE6E7968,0xC566C2D68B3E11E,0x6BEF20D23574A37,0x29C8831491EBCA3B,0xA2D8B8F0,0x860ADEFC1B0AC0A,0xFC14EAA94985486C,0x262A22D698C511BC,0x1E72CBDD201BEB95,0x8DC7EABA0CEBBAE0,0x2E7754EF4F96D51E,0x3523BE605EA8172E,0xA4FBEAC6C288D313,0x480C4B039201A7B0,0x1E3488206,0x292AA28516CE2174,0x95AB58EF8E520F20,0x490AE7D3407FE7D,0xB2D3001055EEB99D,0x4230F14EA51BD4BA,0x9B9232B35EFD2DFA,0x587FABE3E445D23B,0x5AA554DA980C38BA,0xC7D9FD3CBC3F6F6C,0xAF6D65B8,0xC394F3F716C9C3E2,0x734AEC9C6B125EDA,0x617D751259789442,0x8CFF8124E1772742,0x36E39E314DE6622E,0xC783204CB2380D4D,0x67D6F3636DD65E9B,0x1E00C8B3E3F893E2,0xD7B057BC689544D,0x27409C775,0xD1D55D736A02E5E,0x64470E61358BF5E1,0xEBDAA40F7355FE1A,0x2A5E84D650B377E0,0x4E5D2D37F4EB1C81,0x6F72874BD6911816,0xA108D82B734AEEFC,0x17B93AB8293958C2,0x89F6B999E104BB80,0x34765917,0xBEB6DAB46C48BEF3,0x66DA3CCD01640CF5,0xF517A7E56147D220,0xDD8502BCB86F9D64,0x7A4675AF23431FD4,0x351DA0E6FC5E452,0xBA072151661ECF1B,0x2F6ECF1F6FF61C5B,0x3719F7E318526C9C,0x6A3C88C0,0x9589440E73EE2E0A,0xAE9EDCD906E6B5F7,0xBA2A5657419AE33A,0x2BBCAE4CFB9322C5,0x4ABD2F34193ECCD5,0x9225C00491E58A1F,0x2BB3C8FD07E970F6,0x6CF8DD9A53CE2AB1,0x5F216ED2107DACAD,0x1C75ACA71,0x69BA9C657BCBB963,0xD5391A3568993C3B,0xF525AB55BE5FCD72,0x575B5254937F49EA,0xC8DD05D9309837BE,0xB72C32548E46DFFA,0x83E6D43ADC9E735,0xD1EBD83C651BEDB8,0x57E5B8D321233C8A,0xDAAFBAC6,0xE10E354E986BE4D3,0xA5EE435F9EBE25C0,0x71A8F9915C71DED1,0xCAA5536B8AED75E6,0x334736FD46E7749E,0xB42B3950DA40C7D5,0x26BC966404BC979A,0x2850F27078E910C0,0xB2932E597169DD08,0xC9F1D8FA,0x9E0EC86B0F0BEDBF,0xE7196460590EDE9D,0x9DBDB859093F29D,0x6DBFB3EFAD7A3BA0,0x2F5029BC4F45224,0x6B44597EAD130F47,0xC4EC75BF7751D911,0x1434D24399BD5073,0x9BD70618DF27E18B,0x25D401343,0x2E8EECF03FD6F875,0x24B0E7A9ACBB67F0,0xD719692E295F115D,0x79EE4FC3B66E1C93,0x2F5FA65176F81AD0,0x13EC9CA9E042D911,0x5485FFD7CD968E21,0x7333B2523052DE3,0x6B44CF67A019EE7A,0x3A26D271,0xCE56937C520783EC,0xE3DF925A5CEFB215,0xD106762239235CA7,0x791DB1A4A21F6C5,0x22842BB3563C9EFF,0x10715EC9EB6D72C5,0x3A07DFFABBD41C8,0x9D1CE389F27DCF56,0x30DF43401E0296E2,0x1EB5366D8,0x61B101E227B6CB21,0xDA4232B09BCEA906,0x81BC8874D12CCB2C,0xB12680966B88EF1D,0x153B0B7D0D8A7142,0x834D564B8B92FEC3,0xF845595B88D8E0CB,0x3EFF5D93B5669C0D,0x67A38D00F994950B,0x260A93BAC,0x2A40B1C2E66724EC,0xDB5964C1A89FFFD4,0x5D5F6265F32AD941,0xDC730196CB9D3560,0x91250C379872EDD6,0xE10ECCBE167308AE,0x37F0BBDB96A2B27F,0x5C11B83C54070B7D,0x16CB13961F385312,0x590E1D76,0xA9197BFF5F4D6598,0x8D83B1E6CE1280EA,0x9177D11E01BE8A17,0x5890FF6F8F640FE7,0xFFF4572399BB5ED2,0x563A1CB9BBEB1C4,0xAE5CD23870362838,0x1E5831EF8E7B2801,0xF83649A6281BE48E,0x133746327,0xA2C6CDEB54D543F9,0x41E48A881400B06D,0x9B756324D52C7EBD,0x907BF49EEB3C7C1E,0xD8F50958A889065A,0xFFA4F51FD2B2A9B0,0xD28CF912309FBA0C,0x8B984760751DB5F8,0x97FD4F076A1135CE,0x1FD1C3F84,0xE80948B81B5D37D3,0xD4DC6E093E7FA73,0x368B579FF0BDC071,0xD41C8B3CAF58632A,0x22C3ACBB9472A8F5,0xF977722AA807C30,0xBD7281A324268030,0x4CAA2F9AB96F7E9E,0x1712A5BBE50CE4EA,0x15EB6BFAC,0xB9FFC23A51F32CEE,0x41AA4261EEBC1AAB,0x38C1C78ED302F35A,0x17D6CA14412803BB,0xF496592803BC1FAA,0xCB85CFBB4E156956,0x4D73BB7780AD389B,0xAE1348CEA61D23CB,0x7C1287EB6E0BB784,0x4C4F527D,0x3DC6E3EFC23C18C9,0x130DFB290DC09743,0x7C939F018E5B3601,0x94D0D7A5C2632A9D,0x362001A2EA8BF5D7,0xEEEBBB1F0406A6C9,0x277BA8129695510,0x231DCC672D497237,0xA0492DBC1E419352,0x112BB67E,0xE00E261E2E567392,0xCA9A7A6B864F9BF4,0xDD6F437E0956BE7D,0x692BFE7FABA3E41,0x5E7950B3853932C7,0x5DB082F843E2DA9A,0x3498790379CE1F7B,0xFFFB4A6E6D366337,0x6BE3E964A6F211DF,0x2152AF89E,0xAF137BDC2324ABB7,0xF44B594124B8323,0xD4EAF4F5A5F73293,0x307A1E784D83E650,0x22F9505EA945463C,0x53664796906EEB3,0x470952A2268FE64C,0x8CC93669EB1E9104,0x53705C438A22690C,0x181D3DF28,0x55DC210F901C5778,0x1E98CC84E53E5458,0xB7B744C91EAE36B1,0x5F9EAD0F8995448E,0xF767520213118036,0xB0389450393C075C,0xD7A5330962ACDC7E,0x80F7B97915673F9B,0x6AF6E51D7DBAC30E,0x213F0410A,0xDD9C9DBCF8BE0374,0x5C4FA5C28DF658A4,0x8C4EEF1AAB80E1E7,0x62223E49DCA9F885,0xED339D743A4EB486,0xABE00F4AE6423B41,0xFD6725EEEF11486A,0x220D35B2D8249079,0x6C1B412F61827441,0x126FF20BC,0xF191ABB1074F2179,0x5244DDE624216819,0x847AB588044E815B,0x86A12C4556055D01,0x71120D8E0EA69A75,0x64E074E4CFFB6D9D,0x5DAF1AFD72572FDD,0x21D10721D8C66BCF,0xF231878B761E19BC,0xCE4F6787,0x3DD2F86B8B1E2959,0x1E27A3BB4B1FF578,0x2A660EE977766022,0x59079506C681C963,0x4EB793CCFEC47E42,0x444744211659583A,0x719017540E50F9D0,0x90D65A76067E796E,0x42D5BF677767F06B,0x1CB27917B,0xED83A3CB3D3360B1,0x4815AB8DB1AD9FE2,0xC077D0A66876E09B,0xAD79E8169702D019,0xD75AEDCFFECD5287,0xA4EB7B3FE86681BE,0xC305E8DCC438882A,0xC75C5AD00A0A428B,0x5C978FC52CA16B16,0xF7AD7574,0xBC7D3BE78561A87E,0x80E411FEE5342E37,0x887D556F1516EDFD,0x149A421A4036B5F4,0x450589CDE843F1D8,0x6A3138E8358D357E,0xEC179CF0536AB46D,0xA524A82357DED866,0x5C9EFF1D09DE7A0F,0x438E5DDE,0x7D4F9C7B89B8E52,0x4430DE9F2F5058,0x2837DAB632FAB695,0x7CD04579FF798728,0xF1B1B62D8099BCB2,0xFBBC356948C80BB5,0xBFC3A8FCC0C58BBF,0x6B8F1B12EFF2881,0xD5E432BCE6F4119A,0x135D4601A,0xDDF8C97DC65352BF,0x5B1E9505DEA6EE6D,0xF598F46F062DAB97,0xC10C6A8D67F15210,0x1EC223CA46D0156F,0x63D0456CA2DE9069,0x404ACDD4BC6AA622,0x46900ABEE31FB144,0x9E5EC9CD2E6C89D1,0x188DCC8E0,0x6B35B9CEA1EED307,0xA76C13BECEA40954,0x992759184F4CD011,0xBD4A2CC8448A4498,0x6D44819B93314EB3,0x4629F44041CDD310,0xF59B33134BCD13F6,0x3507222A05C1D4D0,0x69C9F420AA8CFDA1,0x24BBD9B50,0xB40DCBD9652479DE,0xA2FA16FB1FB36188,0xB412A2DB5B8B03CA,0x84E7D44EC9D7B928,0x1DE70103C38F0FB4,0x9E23505937A541D6,0x20B5131CA66FFADD,0x56C933297C93E503,0x42E7D1ECC254763B,0x27699254,0x1B52794D4366D15,0x91497D141A10A89C,0x12FEF32B3A66FC48,0x13E4375A2873593F,0xE52E3E3F44E533B9,0x199A9E279A761710,0x533AE250B0B51F4A,0x1A0145D5CC42A3B2,0x2E1BD355B1D6095D,0x25882E137,0xE233B689F96E3DC2,0xB14F37C0EA3EEDBB,0x36FB656DD7CBF4A1,0x54DA36DF8C8DA1F3,0x18FC4C8209979FC8,0x90F76788FE7B272F,0x1E3D31906F9D216B,0x9B826BEE691DA269,0x8A2F9F029CF6772,0x1B6050CAA,0xF813F6671EB45F41,0x7918E780F4FFE6F,0x82BF096083734AAC,0xA698EAD5F7641AA9,0x2E9EA50B3AD07AE3,0x8015D006F81F9D42,0x1262755918623B03,0x1F45027B6CF6721E,0xE32C48DD86560995,0x1CEB47B30,0xFB62B76838BB4789,0x89F1865092071D75,0xF0DB93597D40F9B8,0xCE18569495B027F8,0xA256E4C2CDA4275,0x4987C0C8D56F3A28,0xE1433DF496AC250C,0x64F7C44EB9998A10,0x8867D5D2EB1405BA,0x1F0965484,0x5F563197614699D3,0x29120072B466A1A2,0x9CE3C766E01E36D4,0xFBF6CCB50FDEEEF8,0x1AB78AD9C56E676A,0xD1DA3B92B217C4E4,0xD632503DF6CA725E,0xA16822D7705C0FDA,0xA7F093CD75292999,0x136767BDE,0x21C24D1387DE2FFC,0xD6470A5617E5C4F7,0xE434E2D26CEC3EAF,0x33E5F589DE0A80C,0x519F2B10A7F4F83B,0x5CE02B0ACB93031F,0xF7CF3B5229CC54BE,0x8FD4C1B7686623F8,0x8863C87B77B80074,0x99CC997A,0x28A7480BF7615D27,0x7BA3025B10AE4694,0x79C436FF9795D902,0x86DE235CE7DBFC69,0x47A88E589E7EF57C,0xBE8B89377A4F892,0xAE86B2CA65072E4A,0x2EBABC49957A94C,0xDBB03EF38510682C,0x270A2AC4F,0x8738FA63D6640A06,0xD5E80D5ACEDA9033,0xA67AA5C5DA6B33CE,0xBBECF49983C60F9F,0xC11FE4FD648434B2,0x2E3FD62EF0230613,0xA0E8A379B96A3180,0x3129CE5B7123D942,0xD0DE3C9A8FD71F12,0xA531B795,0xE6FF1FAADBDDED1C,0xFA0F8F841BC01C27,0x986C6F46AAFC2921,0xD1315B24AB7D0BE0,0xCD990F442DCC8655,0xC39F3801674201F4,0x3BE0786737A70E6,0xCE9973A016B64E0B,0xAD97ACA9172F073C,0x46F583B1,0x98BB89A4569149FC,0xBCDC5820B454BA87,0xCBC0075384052C13,0x6D43CDD4DC36F18A,0x195B0AAC75D2EA0C,0x3AB2DB198FDAE303,0xE46B38907D71D6C2,0x42D6C9FA583DDCB0,0xFB0B73CDBD8624F7,0x1DFDBFCDB,0x7ED37B9A6DF802E,0xE99D8F8780E6A5C0,0xEEA7FD1F77DBD1FE,0xC7FDB674ED55165A,0x645668693DAF3E7D,0x322B4E9B17BFC008,0xAF6A202092B9425B,0x323273A64D21776E,0x371DBBA456E1E25E,0x1E46D4DE0,0x150AA3C9DEF72207,0x20D98032E05A6835,0x4D989858E0807750,0x3E3FBE09A9A59710,0x157F1122D2C52539,0xC2227DDDFECB5D9D,0x19FC260C9E5B1E26,0x9B611253E1E0B7CF,0x21F4FBDFAF78F530,0x164E2A57A,0x340DEBECC884FA38,0x3ECA61A0E6051A3D,0xB9040D3274DFBA0B,0xC889510391FE04B4,0xBD43A15392700019,0x1429FD3646BAA3FB,0x65E5F650B36A9B9A,0x226FF05B1B8418BD,0x7FEB2AF4DF0C72A3,0x1AE4C9316,0x6290A64419852487,0xCE541EB7B6FC2749,0x8D0E94E3D73EA3C5,0xE3146D5816093724,0x8F048E7EBD78CC33,0x19CB49F4F12C5271,0x1E0A89F75842B0DA,0xE5F50E77D8022EEC,0x88B1F5F851EB1B7C,0x2148025D7,0x983A0EE366EA4654,0xF779B76BB09322D4,0x5654A30FEE923364,0x6E76AEB7A917170,0x2C1A8596BD02EE09,0xC5F2BFBF46AFBC03,0x558A4A8ACA0B681D,0xA7859D4639E333C3,0x4F5EEB128D6243DC,0x1EA687666,0x22B96E2655212361,0x968AF22417AE5661,0xEBAF3D26FC76EF9F,0xE9048290DC8448A8,0xA7C064D06FE499B1,0xA535D2318A07E0FC,0xC60CDAC09670593B,0xE1CCB4179679F4A,0xDCE90085BE27149D,0x13A6EC6C7,0xBDA4B75DD894E0C1,0xC08AFB62CE67A79D,0xB644B723EEA94580,0xAD47612A34CFF9BF,0xC172EB43F7C8493D,0xB5407835A652DAAE,0xC075ADEDD2EA5525,0xD44EBBEB806F26F2,0x8AFFB1CACD142ECA,0x19D8EBD2D,0xBADB8D1C3E4547E4,0xD9F258A8B58CB670,0x72D4D402BCE26D9,0x2452BD55E46588FB,0x5FE55741237C9B3F,0xE0F4A99C3C5B03AA,0x751855A2F17EA30A,0x13BEB5307B4527E5,0x431940A1CC51CC2E,0x10BF2E97C,0x58056D9F2F4ADD0A,0xAD3D2198ABA36804,0x279A8F8BBD4E3987,0xE051A422DDD993CE,0x68627DE776F1419E,0x60FBB289924E8F0E,0x838A9B636DF1520D,0xB6E09ABC9411872,0x87FF7FC1D077F1D9,0x824714B0,0xB5A85C24458ABFF6,0xA4567C56EA045B47,0xE9C96482C997B775,0x4C4360EB2D0ABAB3,0x6E662A48321C6F99,0x85FA6533BB840D25,0xE4D73909FCAAB3FA,0x73C3AA9BB5046F1B,0xAA2DF50CC542714F,0x206114AC1,0x479F714FDF0322A6,0xF818BD81E5E37954,0x8A1380B8E5CC9CE2,0x3DB30D068831313B,0xA18A04002688B86C,0xD7BC0478C301AC98,0xB69566FA5EB310F4,0x2C43F89E0321B180,0x198B79D0538DD34B,0x7A1F6C10,0x1172F6EB7AFF2E8E,0x99DF83930613B5F3,0xFC621971CF31266,0x596FCEFE57DCC106,0xD8FCECF02EAF9666,0xB01A934AD83438C3,0x8F3363C1673673E6,0xB9CEEF2BDAC10312,0xD198C4F81A444DEC,0xC57543C8,0x9DA4000685460056,0x8CB3AEDF4F0D76FB,0x91BC6A911FB9E364,0x61F13CB67DAE32ED,0x5177CE9F40A0CF7C,0x206032AD3C9FB18A,0xDC50CCD04A4CC915,0xF0723F7850C1423A,0x337829D844B64C2B,0x160D5DC4B,0x838FCD6F73A371AF,0x62F48970D98E2FFD,0x4B30D425D616BF0E,0xFA07306855FFF4F4,0xD5B47B3B11604FCC,0x8BB7C39D832974A6,0x7BB006F90F4E0D2B,0xC533CDB866E236F6,0x73506E0EA6AE5924,0xABFDDD00,0x17B6AD34000ED7F8,0xBD2FC8EE57856804,0x1E50ED5F6DA21AE,0x939DE85D61AD685F,0xA0FEAA1DBB3FAEFD,0xEB7E0F558EEECE9B,0x8EFAC6F960DCD97D,0xC7CD7876D21EA5F6,0xA52E8CE52FCA6924,0xF5EC47C0,0x75EAA624022968D3,0x8673B1DC19C75A62,0x8A907C9FC8385251,0x270870FD5AADDC39,0x4AC61EA44BEB2F6C,0x788175A69EB9EF48,0xC4BD4F23F33386CF,0x4512361A1E2734C2,0x89FC01B98C3DF6AF,0x124991BE6,0xCB98358C4C1B5DC1,0x6DBF276448E0E580,0x5AB5A4CF354F7C3D,0x97B5CD8FA678E39B,0x409E469CD9429405,0x3D0CB80A4C07F416,0xC81A6D58207FE955,0x606245D8FB3E29FA,0xA68902A74AE8C811,0x116DB4A36,0x6042A5EEF8F42A27,0xDAD03B8BD3261FBA,0x614444588A7DF211,0x6EA305281DB82633,0x7EC5B9501C28EAF7,0x3FDF388638882481,0xEC48C892F323E5CB,0xA86F36EDA8C5A3EC,0x36275A7AC384E3ED,0x525D606A,0x9BD8009FA167B559,0xB8AA4D7A905A8858,0xA9CBCD0B0DD9D598,0x8BE36F8F24491EC5,0xE7C6B5444501668F,0xE094F4C50FCBD6E,0x1770E563EAE60458,0x44BE937CD560AC01,0x61FD3171E96F5D37,0x639C26E5,0x639A5EF2CE42AB3D,0x1B504E169C6A8410,0x2D7454EE42015B51,0x48AF31E4523D7B47,0x68A6A9296DEF58A2,0xEF454057D2A267AE,0x2FB6F830EF646C2A,0xC39748092D96BA9F,0xA5A6CE0DEB348A1E,0x1E8F6DB3F,0x9523CFC212D475A9,0xAD0971F815287E02,0x116BBC7B7AB8CD32,0xAAC4DE2D37D77B1C,0x2A4A869452DB7CAC,0xFB92D3622A94D138,0xBDCF1295DF531252,0xD34F81B02F921846,0x26FC61D599726241,0x15E64F7EC,0x8047190C14D927F,0xFF0D9A870322352,0x6DDFE4F4C02AB004,0x3BB644D37A34F6F8,0xC10D3029D4E656FC,0x8E58958D792F2AB0,0x46BDF15E38D2935,0x62E123DF600B06B4,0xDF031C8792C44B56,0x68297CA9,0x5E6B67D4D271F32A,0x76A616E6DA210416,0xEDF4F62DC8DECFE2,0x86259DCAFA5090FB,0x7FD3F8FC2CF46397,0xF4EBFA8EF2FC0C13,0xD3E139803CA49268,0xE7676344BA3ADF8D,0xD973ADF06FCD2D69,0xEEAD211B,0x68D0E0F725EDCF56,0xA0DA6A34BE94F778,0x33DCDD10AB84FBB9,0xD2ACF358D2CD9000,0xD6B7ABEBDA84B74A,0xF25F74E3C8D9AEB8,0x36C7D271B531CB6C,0xDA2ADC05D57423DE,0xFF4AC8B6B7919A24,0x1C3665320,0x8677658E96F6073,0xAF4EB58E347BE1DF,0x47C79B923B69C11E,0x9D258073867A7A0C,0xEA8C46DB006272F9,0x2ABE5AD20E815602,0x474C78DED96AC639,0x518BB32C07AA66AE,0x721F0C4331DEDBB0,0x12E617B58,0x6952E005A6641783,0x5103F2DB10FD1BB2,0x7CBB34BD371E7D85,0xE375EB62C46551BC,0x9FCFDEE511120177,0x2B814F7BBC03AE16,0xB476DBC2F2D9BB4F,0x4FF681A44F1AF5FA,0xE56AE0B20326BF72,0x19B960E38,0x5EEA02E97AD70357,0xC8B05FBA24212B65,0xC08484CA839BD234,0x97EDD3464FDF2DAB,0x6BE7F56C7D9751C,0x2BAF3745DBD381AB,0x96B80D32AC26CA66,0xC449B07AA0BECED9,0x55C50597DE18AF4D,0x27B3F4596,0x6102BE57EBC65E9D,0xE1B3EF12FCE063CD,0xCAB206C67704C09C,0xF7473148433E9558,0xD25901707D8BC604,0xC9848B0315885E7C,0x460709645A559398,0xE8561100906D13CD,0x7134C701502D811F,0x12A20B149,0x779EFFFB1CD83A4B,0xDBAA359B196210BB,0xFE03C54E53278E39,0x2972B8C168A9DDD,0xF046F45DF51F69A5,0xF7F1F7A91D8BBB88,0xEB37BF5A54451C25,0xC5C4718141B447CA,0x7AA2253D34C40D6E,0x2484E00CD,0xD80AFAFF8C9A2875,0x32C0E9BAF92EA6C6,0x5C79F0E7EC484F70,0xCE70599ED4F28E9F,0x1BC80E4F1ACF3048,0x46B9201CFB924C24,0x2CBEA41FAD9DED51,0xC80039ADAB57CB61,0xA99BAC7D69195801,0x226CE23DD,0xE6A6CD0D8FABE84C,0xE8D1B87232FF70D9,0xA75944176CC04B7C,0xD82447E239C5AF77,0xE27AC36091A71F78,0xE60DE8D3394191D6,0xC9493393753046DB,0x9E99BD9114B79E27,0x6E067B3C8C30433C,0x100080363,0x914F85F6EEC9EEB1,0x28FE4F5A6BB81C97,0xE3234900CEC67217,0xD3420FCE4438841E,0x2E97CB963DFEC092,0x53F40CEC153A4B02,0x82FDE9B3B40DF3A4,0x8AC6325A7093A12C,0x24EA0602C8979955,0x215344AAF,0x8D483A970A8E42D8,0x8E4A26D2754D305B,0xDF52F10E817B1BFE,0xBBBE325C7ED55233,0x479AAB2769E3CE42,0x398E97523FEE8C4A,0x24666B0453101987,0xFDEA699068615AD1,0x6ED64D1C3EAB72B2,0x20CBE83CB,0x99B83280ED4BD4AD,0x8DC96D959B9AFCA4,0xD28C278ACDC24318,0x91B060E9334472B5,0x7CBDE7B669CE8415,0xE5FA6EDCBFF0F789,0x3AFB1A3933F0FD4A,0xD727BB672E4E071C,0x78EFD54DE0AD8879,0x1A4D630E9,0x66E04AE5E5334C85,0x5F49F5A42C72B677,0x6E607098FD2ACFD0,0xB87598082C9A2A12,0x3F7F5068B5621E4D,0xDABF30B8AB22C089,0xB95FBD394F7C20A9,0xFE5DDE92C76ADFF7,0x53FD0B7DD4397028,0x19CE16E85,0x38F0F79C336EDC23,0xD6CF71F0A5ACE58C,0x408D85B5423089C,0xFDC30BEEADB8D2A,0xE4C103CD10D7215B,0x5E9746C4E02BCA3E,0xA7C0944B48F1FCE1,0xAE325D244A24D580,0xD54724623AC46536,0x5FFDF1FC,0x5E5360600331B6A0,0xF85ABBBC7AC357EA,0x97A87E008A025F39,0xAC2E99145CB5BFC9,0x83BB84AEAD47BAC1,0x146C63994F5ED517,0xA844FB83AF4A3D87,0xF25A4E6C307507EF,0xE2E59DF68CA5347C,0x232643D4E,0xD97EB05911DEE0EC,0xA0CC734C44CEC830,0x9F8A13F3F34F43A0,0x875244C5C95F2A05,0x4905269CED0CA36A,0x14048FBE0459C8C1,0x670B3229B1112CCB,0x4A6FBF1363D807BC,0x6D6728FD187E3D37,0x191F9F8BA,0xCC3FEBE07BAD6ACB,0x44D3334630BDD5A,0x6FB08608606C5550,0xE1EDC77F7419557F,0x65405A48E0AFFF79,0x5FB29E92A3A3421E,0x4EDFAEE830C625CD,0x5DA8D89052D04271,0xBA3BCC99AED3C16A,0x426801F9,0xDBAE8F4739C4820F,0xE77709A158AA93F3,0x38FCD7DB38C82E6D,0x5CACC56244DC7A5E,0xB0E7D67A0E485E8E,0x4B7D43BBAB28723D,0xC7EE626A558EB293,0xEDC54D55222F8568,0xF9D288C3857F0451,0xD95F6B96,0x770D4733D8A1E1FB,0x1861235FB3E04C2F,0xBCC19A3E05E247C,0xD93963AD8F3221AF,0xB171742AD8117730,0x43D5DFAD5C9D9F7B,0x47A140A0E4DDB722,0xDCE98AD420CAC0C6,0xB05FAFB871BF5A45,0x1D621283A,0x4152C5A820B6AAD2,0x5CE46DF81297A726,0x4A6E6ED07718215E,0x3151F5EBAC189FFE,0xE66577B8A932CDD1,0x456970C6C7A1F6D2,0xBD40AA67D3F6BB98,0xAFC624CCA7B79DDA,0x264A1534AFD29814,0xADADD74F,0xA0788821169EBC95,0xFADA079C32C09553,0x25BEEA1AFAC22BBA,0xB7E6C2891F3D07E3,0xB0EA203ABB591858,0xC17F5626C9FBEFAE,0x9841F2BDD9F5D359,0x48A2F3C8B053D5AB,0x62FBA338FB53A674,0x1C11F315D,0xFED56FCD1D50E7BA,0xE27F652E899FF064,0xF3421C4E33C11351,0x7A0AC7CC60DB5D41,0xFEEE5961EB8F364C,0xBC117F11552502DC,0x457C6748D545428B,0x8C5AA96BAFE80F06,0x1E7748C1DC60777A,0x1270B7513,0x285EFEBA1D5FFEFD,0xA4179E9C12B3E778,0x79BD2B2152621661,0x5BE51F68CD50D281,0x8126C1BEF0CB49EE,0x615A2D7684906860,0x8026A3E93BE63AC8,0x6D3A57DC542ACEB6,0xEC83EEB508B40913,0x116BE74BF,0x3EA183B0B5325F81,0x3ABCA4AF2F3A26B9,0xF76C01E672019304,0xA0CC8A5F17E6F2F5,0xB7521E7032910CBD,0xCABB23538B6E71F6,0x72E4C09D48D7DF4F,0xD612EEE6C0437F3F,0x90E29091DDDAFA05,0xF0086054,0xB10447B642F6A3F1,0x511D49D1B84DF55D,0x1CEE858433A6CA74,0x10964F911B50418,0xF54E01FEB62305E6,0xFA5565A79EF2BB39,0xCDDCD69DC5C25A3,0x337BC5C5858D3CE7,0x6005A71972126AD,0xC57C3F9D,0x636EAE6B3FEB1649,0xAB4D16B296E12FFA,0x26C60FA463C58F05,0x44D20C0AEA8267D6,0xBDAA6DFA861D420A,0x82FEAC240F5439CE,0x5EEA67DB55C3697F,0xD34C3B613D5EC70B,0xB2EA27EB59EF68E7,0x17D8298AC,0x3A941CA54783AA4,0x9FDACCC36B0F8090,0x81B4F2DD2B49E42A,0xF5BCCF75ED37D1F6,0xCC5E9FE7221B2B45,0x53740B5848F9BF7A,0x159F7941F4CF3D3C,0x336D1510D9FE87CF,0x29C4A8512791B281,0x104529879,0x1B6162F18F5F8E4E,0xA857E080BB5C439F,0x3BE2197FF49A72EE,0xF8597D78AC1F512C,0x887B859A82FA61,0x2A725EF4D1E140D8,0xBCA14CCA7209CCD9,0xF9ACA3F3400D2CD5,0xB62BFE0EC15B1F5B,0x2754DB396,0xB920EB2E7E356D98,0x1215940C202D6DE,0xC5E507BFD7FA8CFF,0xF44AE435A79D89B3,0x1E88CD3F1477ACA,0x440C7B6F8BC1190D,0xCB6D93D68BBE0448,0xD516B68CDF59AB45,0x4CA08B323E7F4F30,0x1BDC6A08A,0xECEAE8CB0B15B25E,0x8F8662DC55ED79D1,0x129A69F73039AB96,0x3602D5C0F887C053,0xF24C52B221C901CC,0x8F589EA713C22313,0x73AD7A4D42F4501D,0xB4794C4F7B348687,0xDB6B66ADF9C7021C,0xB2D8D74E,0xAC32AAEC16FB4E88,0xD4C8442D4C1FF1E7,0xCA7767BBA211CC89,0x99756CC5668E84CF,0xBB8987D25666CA44,0x64A59BAA58EF3D25,0x4B8630879F552E03,0x781B7E6945D4B415,0x5973226163F2CD09,0x14D6E67DF,0x35B5FF327ADF0E3D,0x8957FE28FAF5160A,0x21C65765C6208919,0xC6502046D7FAA4CD,0x2FEB3B1AE77D88B4,0x3581D6B1C6528A82,0x1EBE9C2C332FFDEC,0x6495FC6B3EAF35FD,0x7945C532B6480575,0x1208A715A,0x4D3DB01DF430C93B,0x7CEB795C832EFDF4,0x809C570BD421C2BC,0xAFC7C0E4F2982F52,0x11827BBA29CB458F,0xEDA932B384AC5871,0x28F6738315E29A2A,0xFF5D1F756E782888,0x76F9806AC12FA35,0x11BEF963F,0xF97B3A3360294E87,0xD46A595F54C0ADF5,0xC2EA1FBC38FD06AE,0xC2CDEA661E667670,0xF4EF26085535AF77,0x80D96B8078B7420E,0x61B1FACD84B90534,0x141BE8AE8BBF9776,0xD6402FA3A9F63A53,0x219AFBC2D,0x5BAE24ED128500BC,0xC88CD2C1C42B2804,0xCDDCCD4BCD614D8B,0x468D1FB4DC91A9E1,0x64A8EA36578A369B,0xEE1E6C0D85921F9C,0x1DA7ABBAC2CE02C4,0x57D5074A6DB787A,0x55EB9068F7BE5B30,0x17FF2545F,0x5432831CCEECC901,0xF6AC0C304EDDE6A5,0x346420BB03BD7B21,0x41A63102F7F11B76,0xC6DF11E6088A7E46,0xD9E638402A007414,0xCB2B6BF5C443A4CE,0x19718E9DBDC8E23F,0x1F1E7A236A808B6B,0x26C8BD9F4,0x7F99286941448877,0x4F389402DFD5C583,0x865684B1428A2726,0xBF6C21A81ACF4EB9,0xB8FB6574DD5EB0B2,0x8B1158A13DBE8EBE,0x2C575E226F1FBE39,0x29207AFBC63BAA4C,0x958BA528050496FF,0x1BE2F139,0x58B6ECDD3F32922A,0xAD8B3CFC777E400F,0x56F7FCB1A27718D1,0x89B3E39B1AF7BC7,0xA0E62E6215E1041B,0xA45E21A01C77C1FF,0x7DC7BCE21039789A,0xC20E4F6E1B1A80C5,0x333C1F9C724AE8C8,0x2542469AA,0x629FE9BD96D36507,0x7E2E1CE428CFA34E,0x92E479D21B50A748,0x184D9C723D62767E,0x80C49A9378D4B540,0xB83F5A31B4732854,0xAC2018463653072F,0x1FA20172FD33DDC4,0x1B5E9AB4517CE816,0x233A620A2,0xE3BF179DD4CC736B,0x4C5CFA787500C271,0xA89C12CA737177C,0x9B5D2B8913D878E8,0x813DA91ED8F5C2F4,0x4C96DB8AA8B4D9F3,0x90890FF8A985A7E3,0xCC16FC9D959E0C8D,0xA3D202F1308729C9,0x1AEF6754F,0xA0B4D34D5B7AA648,0xEFC4CE69FCEF9B39,0xC5C7E6DDC2CB244C,0x76D07AFCF6491843,0xC1BDF518E3C81FC6,0x39ECCEB5B9707BFD,0x45491A320B8D6702,0x21E27F80BB7BF936,0x2F5865A3E53D66C2,0x1C67D7FDE,0x6D3E83C335A9D603,0xC7F13B58CD147BBF,0x2A244A4B62C98D5E,0x6E32B1B000737482,0xA89207FF3A764F3,0xD7E7BF50478F32DC,0xC973A52883D78ED0,0x16D0345C85FF81AE,0x577E5CB03227CA90,0xC91D64D6,0xBB50ECF2FC91300B,0x6A353B9A28A70697,0x374431DF875B88C,0x554801B72E8869AC,0xBF4FFC1D965DD7A6,0x7F6949A16921832B,0xC779C49D2C6E31F5,0xF409FBB93C9BB85B,0xC32AD99A3AA31DB2,0xBD076CE7,0xC5EC450468000506,0xC0C7B2367AD0EE3C,0xD47229DFF003215D,0x4648F10F1485C316,0x215679BDA28532AD,0xD0E21E161B69A37B,0x7708E2422695E529,0xBC794397F8474E2B,0x15C48F39BEBDE8FF,0x146C23770,0x67404FF360B6DDB5,0x5E4C803387A7C5F9,0x277BF159E31EE2A1,0xC7A0994A7FC4AF08,0xC01DCDEAC4AA1A83,0xEEB7C0A20907BB18,0x9E9409589D85744E,0xBCE03590BADD722A,0x72F0AB098B7CCBD2,0x218A1B7CD,0x9B627B1762F8B121,0xDA92C4DB403E6215,0x4A45C7391D7206B3,0x2F81974F4860F51E,0xCB770471CF5821B1,0xEB8F21E69F9EBD53,0x479A10DCE024E8D2,0xAE6FDB3E896F7074,0x46100B5F5D993D10,0x3850B445,0x74C6EED2F8BE4489,0x2928500C924158FC,0xF58C571B1CC82B85,0x6B41E918CBE32CF0,0x2F22AEF6319A84A6,0xF88390C7A84A426A,0x2A75E07C6260AB5C,0x58ACF67B1F42704D,0x72ACABB68DF85D3F,0x70E32318,0x44BD2AE69F404A37,0xF78FB49C957013BF,0x3967D641704F3898,0xB8EF1DCF054443B7,0x92E12F8639C34E06,0x75B03086646723E2,0xB9DB1B6074BD73F7,0x614C3112D19C904E,0xC9C3AD8092921048,0x71F4F9C1,0xB9058ECD546BB857,0x147A70C2D489C73A,0x20970006430A0E5A,0x92C264BFC96D7200,0xB23DA18B7A183C04,0x14A3083347BBCE76,0x2772DC052CE411E9,0xCEF0EB61214FCE56,0x33F58AEE6A22A676,0x1BE2DADDA,0xD9C26CCB6C413C9B,0x24AB4D89087961D0,0x896E6DCB783F9DF8,0x9E5EF284A7FE2773,0x85587872D1E1E718,0x3A09A96874E11514,0x126B1FD864C2DD9A,0x6CE45E0D2962636E,0x4E74F2E4B2BF0E39,0xDBABBA75,0x15FE11C314710689,0xE0AB7463C93C0A56,0xFF4C355992C1C140,0xF44481EFAB7134C,0x72070A095B338BD,0x6B17BC0581F85624,0x33E02C4C0CFBA3CF,0x442803896ED72805,0xE8DC27637DF01111,0x267A4D941,0x807398E9C62D19CE,0xD6E5928706E8DF3D,0x11EE52AC936921A3,0x6051CB5AE5B99A27,0x22B388F1B0502731,0xEE2A7662ADDBCDAC,0x5E70F13C5AE5BB6A,0x6785663F692349F2,0xF4088EA6E64D4F1,0x2A5C51C9,0xC02F051DF9CE77B3,0x2FEBFF2A12665DE0,0xD3A2E4F86BA4B874,0x4852C183407FC6AA,0xB9E1970360802477,0x702D3BDB92E517C8,0x44F36732A9DCA48,0xDD835F284136CBF,0x48D2E3750128F5F6,0x4BB12527,0x45B97C813A3329FF,0xCF4248BCE1986FEB,0xAFD9A7250C84A7B7,0x74489C73B6145870,0xBC7001F69CA15624,0x8217D63C6B6BA56D,0x25E69F1D04575D4D,0x8438C3E8AE57A55C,0x84DC535497645460,0x97132D1E,0x54199FDF04622405,0xEF3208E2A21FBF83,0xBD1980C1D4C48554,0xD0EAEB0336BA79EC,0xF8A384DE92FF2714,0xE840C1B19A35FB1F,0xBBA8AD5990A72542,0x666B410B5D038,0x618170E72A50550F,0x48B00C2E,0x46838060390DC449,0xA6EFC2C2993F77FA,0xD1731951AC6AA9E8,0x86A636228174F58B,0x8F75953CA4C71770,0x59D4027455C8F559,0x4F7C8F1BCC5AA098,0x34DF096254EAC226,0x321A61FED285A480,0x2386AFC40,0x698EBF763D41C095,0x30F8D84DA55D8DFD,0xBA8CD9138A1491C6,0x529E59A9F34BDF4B,0x941DDE8FD6E89FB4,0xF7DEED95C716C655,0xC99E0F407D3ABFA2,0x87471AAC47A91AC4,0xA2E2E0CE851DE934,0x1888B8DBE,0xBA5EE3384AF6DE00,0x1C1AA7984ADB4C4B,0x9A3CA426C7D53B1C,0xAB33E9FD80A03C5F,0x3BA9295F20E94DF7,0xB9DA100B1DF5B42C,0xD2018C87DC351979,0x8C1886BB87388C33,0xD82775A39C50C9C2,0x21080D015,0x29F6F2F18E5C5D5A,0xA790D7C92DD0679C,0x3AB0C998F2E8CBF6,0xAA5F7E47C983E23E,0x5B2ABA23F4B7A227,0xD5B247F1668B3404,0xE5BC78800F10FF9D,0xEAEFBBF8ACFE6F96,0x4CDCA84D589A3C5C,0x18E956CD0,0xE6C931D967DE12AE,0xDE35690E82906670,0x5B5233F0C80D53FD,0x6E952949E95A0390,0x9E7E8B4C69332E16,0x5BAA86F95F196F0B,0x2AD0D4BB5520873D,0x38A15C0BAC46F8DD,0xF4A12F2DF0AD6F1,0x320BF115,0x3013292C21E4FFEE,0x6D4671D727339A4,0xDB544AEDADFDBBA4,0x6C2E57D238209B46,0xA5209072764DF709,0x2851701BBDA9D242,0x4637DD95FC2FACA8,0xE239F62481E01D5E,0xFB45881AD2C1E8BB,0x49008AB7,0x9591A2926CE52AE6,0xD3292849D48CE060,0xF9865696A3FF3EC9,0xCD41EA7C96C5F796,0x2238C9BA8E4A01F8,0x7D3AF67431ECC964,0x58A56D94A05BC275,0xAADA877A27FA4690,0xAE6FB6D51280F18C,0xE9EFBFDA,0xA7CDA6F93599C90D,0x5FA818B799117E28,0xD0674ECBAC4D17A2,0x67E3607E2E1172DF,0x6D153BFA0435F755,0x768D236F47C4ED12,0xD189D70E772CB562,0x703FD490D4B989E6,0x3E0681BE40FD620C,0x206C87AA2,0xCCD42A6AC27565F,0xEFCDD1D6A18181B9,0xFD97C60C3A325F65,0xABF9584A4BD06A04,0x36C2A338290A8B12,0xD31E3C435E714509,0xE41470A5F432DEBA,0x7E28D80FBDD503C9,0xE7D85A30AA04D553,0x10B7C48D5,0x16F66085D65099F0,0xA6B1A4DB9B6F6175,0x4DFC67E24A26D26F,0x1F5A9B6E7711523A,0xEA5498B7C2685798,0x8C0D130916CEF07E,0x40A401F7E9DDF47A,0x73E0714C548B6F43,0x1735555E5313F625,0x1F41DDFE8,0x690605FE5941CE68,0x796E338402C4F823,0x347B9342EBAC4D,0x3E2A85DFC7979E00,0xD8ADC871034BCCEA,0x33865293F824B39E,0x649BEB5C073F0028,0xEEB82617B6B8F911,0x3258BC5E286B29F6,0x1A65C0D78,0x4725A818D5D0D70C,0x2E0C174B94A10AA9,0x50D7274FCABE3F79,0x5B3228242014B5AD,0x230E42EB90DE6B5,0xE763DF0E75076EA4,0xBD988B9879C31796,0x29B2647F68E02166,0x91D14B089D4C4A8E,0x1C7E918F5,0x5140447A4A02A49E,0x329057FFC490A31F,0xE7C56EB60CE59F5E,0x6912996C7DC9293D,0x52D80423023DBD03,0x882CC8A43B26AAC2,0x4D46AFA39846590D,0x639C9FD44E56177D,0xCDEA7ECECC05A961,0x1B95C87F0,0xD05DF65E750D313D,0x407217E1AD464C75,0xD3F812F228E5A99C,0xDBCB3A109EA1A120,0xDC21826DF98C12F8,0x2B34E3E9A58D54E9,0xE44E74438606E091,0x8DAB86C9C07C1A82,0x5D24DF745D38624C,0x7E5AD1ED,0xB8381E14D7979132,0x8EBBE3F3E9A5CE59,0xC043283B2267984A,0x414A45B82DE7A84B,0x3885539682F6EDC9,0xD033325387BE6E6C,0x9E7E89FB182D8804,0xE9ACB48ADE5417DB,0xF5F75E6E4CB6F4E8,0x1BCEE1939,0xEFD74E65AA2CA1E,0x330E7D9BD33A41F5,0x325A22832F1A94E8,0x2B98B83677354C8B,0x92BA23D9D40D40C8,0xB2D504AF838D2785,0x9948B5A85B6F1DDC,0xD8122BE218D1A228,0x9429E5F30EB15783,0x2055D7D55,0x6DFE66DD4542F0BD,0x51A7CEE219E0F998,0x9FD9972E855BF756,0xC4DB95D84D369AD0,0xF7DAE0ABDBE53359,0x84518E98DB97EF1F,0xF188FF24596B48FC,0x337E3DE3BB037B10,0x6757517A8EF8922E,0x2728773A6,0xB5578C3DC85286CF,0xA55EB40473D0F2A2,0x92C4B089E78D15D6,0x9A5DD0AE6EC90666,0xAA41B274DEF25359,0x83D445B79D78785B,0xC060B4B1F6BA45C6,0xE2E56CA174EF1322,0x1C570B677589EC17,0x82BECF6B,0x3DDEAEFC3AA60BFA,0xA6716DC045EF9CF3,0xBAC78B63F83313FE,0x8CEB594D7B21A47C,0xE6E139766F107FD9,0x240293BD5F0B4E8C,0xE1F05AD6D55389D5,0x87C433BEC301D36,0xE50377411F044D2D,0x156879AB8,0x8C9C71D24ADFDECE,0x34F69A3C4E8F2F5B,0x38B87E0C31275E5A,0xEE89B31188E83E55,0x2C4F89ADB0ADC221,0x2F2195FD46F49E32,0x2AF9A95A517F8FD0,0xD635784C348C4315,0xA2FD7F675CE6EBA2,0x14AF0F126,0x7B9AA38A594E5739,0x7235FE262CBF6E67,0x97A7F2579C624C00,0x64852F19EEEAEF3D,0xC9E472325E889005,0x2BE87D593D438C7A,0x92656DBDA022DA28,0x96A8F10D9C9673DB,0xD7602FCF39A72D1F,0x17F8AA3A9,0x832C699C1C6BEC8C,0x62536B67FCEFFF78,0xA04940AF515A7AE1,0xE57F99798C36AC8D,0xC11025E05E4C247D,0x28BD9DC9D5367077,0x189FD2FD595D0217,0xFC7BFAB30E2E74D4,0x5D75ADB59C52C46E,0x4090E30D,0xEA9272A853209992,0x96554CE0CC97D3C9,0x990B389244385604,0xA9495E163B5C20E1,0x99718BD60B839153,0xCBD4C290A055E0A3,0x8FD1EEB3ABA5195E,0xCA232C5251E7688B,0xC512E40D0279BB64,0x1EDA002D9,0x604A963935520597,0xAC654668CF064F70,0xE53001A5B958AD39,0x528EF415FE2AAF76,0x6353AE35D3A1996B,0xDD83DC668994D2BB,0xE935BA8C025C2298,0xC8F0D7760D4830BF,0xD2D5152E5AD6CC02,0xA19BCFA2,0x4ED084BADCC7B57E,0xE3F0EED1A082C611,0x4E9D30ABDF07C596,0xEF503F43C8FA1C02,0xC43D72770EF80D0E,0x3FB38B5B9AE0BB7B,0x6DA265DD3E164179,0x9C1D1B24CCD80465,0x3277866E0A75C370,0x18697E5B,0x16846B912422F1D3,0xCE12DF99837153D0,0xD5B5A94BF02BEB01,0x94A335AE4E4D3524,0xB2A35C9796D5BAF1,0x375EC3FF36BB473E,0x1375E4BB68A5D2F8,0xAAA887E2FCA3B65E,0xAE7D4095B6A53790,0x1E754FB8D,0x505C262C0503F798,0xA701692E3A1826E4,0xA40A2DC1DFD490EB,0x63577B9EB816DFD0,0xA41787B63EC632B0,0x5F6FEA5034999E03,0x4F7109E8AC34E9FD,0x6D8B372609B4763F,0x10FCEE90A86680D2,0x123EB2EBC,0xB8E59F9462A5D764,0x625B16009625703F,0x15EC9FD8F02F9727,0x25761CB03E4AA368,0xFFE37F98562936C0,0xB881C35DA8459974,0x11DE6030400540E2,0xE0B7A233E3DAC8F4,0x44E249FC5E41393D,0x4B9D6572,0x7E5514D61D8A6C3F,0x5BF05E510586767B,0x24ED815B1A8DF4B0,0x63F12F7F9D2EC09C,0xC20EBC527E1286DE,0x25BE4EF3EC026704,0xDA8066B86FCC1FE,0xF50B5041B44EAC9A,0xC4377B4443D86CC3,0x33484111,0xDA24A7A24B11BA54,0x7746828F204CC251,0x249C1B762DBFACBC,0xFFCDED26035A4F5C,0x996BA3B0DFC65B2,0xCDE7185F367334AC,0x9C23DFD4A7CC4F28,0x72F4B1B9622890AC,0xFD8E910EA5F5DEFD,0xEBD25CC6,0xBFA9F098FACE20BF,0xBD0B426A43B0F7C6,0xAD6B1F89ECE46ABD,0x77750B6B532F0673,0x8ABEB22BB7F78CDA,0x9ED7A7B63BE3E029,0xAF6E72A0314929A7,0x29017353EFBE3246,0x7269F17CF8EA947,0x18C568CB8,0xFA8AF04DBFF0A227,0x7BC48C4ADBDD9E6D,0x8A8B191A6D0D00,0x7F938016E0231B04,0xE5E7D6A46C71AAD8,0x15817B357CE2D9B0,0x8399A5F5FC4F8E97,0xD48AF65553A8A0C7,0xDAE9AD723DCC9D50,0x20519E67C,0x8483E30BBE62DC9A,0x569C784F7549C68,0x5627063E102D2419,0x79079C498DABF89,0x6A0C319511905829,0x21436E944C0BC6DC,0x759E95C5EF3F0469,0x49EBA06B3D17A93A,0x6F4B26158AAED521,0x25E5F41DA,0x164EA8FA347B51A3,0x568616EF438E5C5B,0x5F9C72CABD92DD12,0x13839DB6DCFACA88,0x45DDBCE3FE29F27C,0xAFF8962B6633B460,0x474954485B7407A8,0xA08584DF9CBCBBC,0x2D1040C29F1CE653,0xC6FBA007,0x5AE6E2D04ED14D93,0x1AF309919AD7165B,0x42D01E4D5A380037,0xEA3464BF95967E51,0x50ED294C00A419CD,0x3915210F341D34B9,0x7A4A2821C46D82F,0x43F78247D4EA75AA,0xC6D797B534E75CD9,0x360775C1,0xBFCEB83B8E9C65A7,0x913BBFD604354649,0x8FAAF619D3081608,0xD6B18FF9E2392461,0xBF0D0A8361630444,0x259D1B3F71F2B2FE,0xCADA03FC79A5FC2E,0x882C313856700291,0xDB1AF53862BE8BCE,0x220DC221B,0x3CC2E5AA05DD5E44,0x65C95A2E1AE8242D,0xE062D490F4633107,0xE4A803C7B675E82B,0x33D47BDCB370B1BB,0xBC3D7562D317ACB5,0x44AFC8A12391873C,0xB088B31AA20B016E,0xF0A1F9EB5086361F,0x2B7EFB13,0xC46888622AE3F28,0x6DA38ADB6111DCEC,0xBFB9E59ED7BCA5A3,0x241601CF0BC9AF5E,0x59114790354C1B09,0x5BC056FA831955A,0x56C219F948703B53,0x3A814AC400CB4E8A,0x1F8DB505F34E235,0xB9710861
-			};
-
-		#endif			
-	#endif	
-#endif	
-
-// This is for \ell=3 case. Note: Two different cases must be handled: w divides e, and not.
-#if defined(COMPRESSED_TABLES)
-	#if defined(ELL3_FULL_SIGNED)
-		#if (W_3 == 3)
-			const uint64_t ph3_T[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD] = {                                                                          
-				0xEFE0B1246E1B15D8,0xCE5E59D2C6A938B7,0x9421DA239FF6D260,0x96F33702CD2DAAC5,0x45CC46BDE3A5FCE,0xE855F2AEFA620E36,0x96D60B35087BA313,0x587DEC7923493D74,0xE9FDFA81772DFB58,0x1A4BC61E5,0xFCE11250E1823AA,0x7DE75D693DB489FA,0xDB547584F4D310CE,0xDEDA13FBB2D3E2C4,0x73E82F442A99394B,0xF41360FBC0F94A94,0xD5D12F662BDB097,0xFE4093C5B907F763,0x5F5BCA5AD0110C1F,0x9612E327,0x86FD022EC9F94DBD,0x5343F05AB1097F09,0xA3125120920E316E,0x4D2C9F0629D2DC17,0x767954328D9D6A46,0xD8B5FC2F6A5748EF,0x603DABBFFB73D6F0,0x1A9B4211D79384A,0x89704DFD1BA13165,0x22F662552,0x7F75B2FBE4552BA8,0xD8BBCA8D0697B755,0xAB964F06BC50D80B,0x68656927DA935A51,0xDB2C7A908DEE21C5,0x54207A7E2064E50B,0x548C5E27C54C5BAD,0x30663353362BFF6E,0xB229CA37822C2336,0x1F1C65245,0x6AAA0FFDA5BBBCD7,0x618EBEE72EA4F88B,0xFB440030DEC39C4C,0x156362DCA5EFC0E4,0xC7B9A7AA365C9745,0xF0CFDB90838A770A,0xDE36F85314F5540B,0x6934C51A2512C49B,0x90F6E835EEF6A55B,0x236073F7B,0xD61111C3019E6B9D,0x71995AFD6009DDA0,0x998D49598316D2E6,0x130E2EE2B4BDBE1D,0x235974B164108C76,0xF3C53A408E0FE7EC,0xB59255A6AD3B36DE,0x6D61681687E31845,0xF813C38433A7C7CD,0x2377A56C5,0xE9D68FB4864F476C,0xB73DADF725508865,0xB34B60AD7B5BF9FF,0xC9E642EA8FE13116,0x5FA481C91A5B6698,0x5D2B63305833C75A,0xC74579F19E78EBE4,0xC58D31F9ED86CA9D,0xB0696DE0B73C8891,0x7617FDF4,0x802E0B51FB6B186E,0xF8F6B70C9A398EB6,0x597A0959EBA4B53C,0x7B830DF4C24E2ED8,0x66B76D85642AA97,0xB003463AA38532E7,0x9AA87FF5006105AD,0x8D092F92733BD14D,0x4FD1ED446DF801D1,0x2ADA2E43,0x2352C7F5AF84E69D,0x14AEF2842031743,0x5C05FAC0CC876757,0xB8769C806EA6E20D,0x6EEC48E698AE64FA,0xF4B7B352C35612B0,0xD0CBC9DE5AEEA58E,0xB6FD9411C0784F87,0x15A85CC228A7D03B,0xE40F365E,0xEB75CFE28431D5E7,0xA5D634681EF68AF0,0xF22746B4BA4E42CF,0x545C96BA2069B50C,0x5F2EB55ED4CAF6D2,0x844DA1C7A89E93F9,0xCC7898A710274475,0x354A048276409157,0x167920483AC16CEA,0x1811ED046,0x9C3ABCC6E68E705B,0xE34DF217202355E5,0x107569E54CB351EC,0x1925215A7CDC64E8,0xF96FEB136EA58363,0x1370BA7C0A9B0989,0x9BBAB20692F31A5F,0xF2C57EAAC7BBDD17,0x45D63B1D687EE446,0x2DFCCAD3,0xFCC1F2BC081F84B8,0xB0631C98B1C51C,0x396E1D3A3322B175,0x1B2BDFCE9C2303E0,0x6D81852F855146D0,0x5CCB40C9522BBC56,0x454B4035A269E9D2,0x21081A95A6296B71,0x21A10AACF9574325,0x1C36A00A,0x73BCF7EFE36E9207,0x5906A4F704D3630E,0x427C426D7D84BCBE,0x1184EEAC60A368EC,0x9AB2BAAA38AF05BB,0xF8D210A9D02EE04F,0xB850A422E4834D64,0x68336583BABF0131,0xA8AA1FE153DC6AF,0x24CD8115F,0x94BB71F0DA02B0CE,0x7D055AB794B75E38,0xDFD876C4DD403D18,0xC15712997E7D36C6,0x4A1AD99ED1E83D9B,0xB33BB91E43784CCC,0xC802292D0AD68926,0x48E972B2ADDCF657,0x573DED5A51F69BBD,0x12EF39CDC,0x7206A16ACF028ED9,0x75F903438FC844C1,0x40F5F4D472A0AFCA,0xF9BD4FA7924BE49A,0x51081EDF59D780BB,0x9ADFBDBD0837D98A,0x47CAA05ABC98E2EB,0x86799F7A022D8FBD,0x7E07FEB593E35542,0x1EF3B1212,0xE38A0306AF13B214,0x8AA0ADDD6977AC15,0xBE55B1F99F93BA50,0xEE1C9D36512B8B96,0xE9FEBEC1E48D730B,0x7EDADBD9F466E6CE,0xF5C21935AC12E135,0x5074543ADD0B48F2,0xE2FC51409687AB83,0xDA2848F5,0xD58BE275ABA921A0,0x253A619C05AF312F,0x4BBC5C7DA24E4128,0x9501240F9BDAD1B7,0xCA14B0D23480D387,0xB3DE9FFBA6AEB736,0x473386736CF86606,0x92EB0B81FC674853,0x34FECF52DE6B40EC,0x803D786F,0x8FDB621E6BE55588,0xA9583254021E0437,0x807352FFE89037B8,0x7F212D4E7789D170,0xC254AF485B369469,0x6843BD9750ED6A69,0x781C1C13A76717E2,0x72501AC3225F591F,0xD15447E859830ABA,0x272F02DA6,0xD75ACAB0E0186235,0x9E03194519000128,0xCCB68D2B09807776,0x12C528F07F57922,0x1C968F8C79F188AF,0x3CF5D459B51D5334,0x79C445C479277C36,0x4E4F2C9A5662DDE,0x80BFD5FFDF2D8739,0xB7E1B432,0x66E69AB48B168BE1,0x4D14AC49DE2124DE,0x7CF689514DC14115,0x1457520A30F5E1C2,0x471251A605CF44B6,0x6ED1FB06EB71B001,0xB2E6E11C867856DE,0xC47B1AC7BAB20E16,0x488074D655E28E46,0x1C05B6443,0x84B87E8A05A91B40,0xB8FED3A9167E8667,0x8AC620666A78DE55,0x65B90DA63045158B,0x18BB62C862C36755,0xE8A0C97416FCD448,0x77504BA92CCB0D6D,0x6EBC2F6C6AFCEC2E,0x5CC7D24DCC67A365,0x69A610D5,0xEAF11B6AC0A05972,0x59DFB58B494F40B8,0xDE2EBD4F7EBB6817,0x73423090E2221DC5,0xBC61FBBF34996194,0x313F36343A94CA01,0xF022CB0DE06DF3B2,0x13ADA8AAB93A7C,0xD29F434A616B53F4,0x275C2A309,0x17F6ED15E7EBA15F,0x4B5E365E24C6D45,0xB384F482F7E60084,0xC22E5513C923C902,0xA65BBA8935170485,0x10016C207EDA2E33,0x32B1294C484E9BC8,0x8A5AAE4285858DF5,0x34ECFF8E3BE421EB,0xD3A282C4,0x10B5CFC56AB8F4EC,0xD6A5CC925ED60961,0x2E4C5CEDB6AE037D,0x7AB85146E3AC9FF1,0x559D6D5EC6EDF91F,0x6B9E6F216F70530A,0x5308947A204335C5,0xEC084C5E5211D3CE,0xCA992290752334A1,0x1BA2526EF,0xEE2AFF6029EF934D,0x39E3FB207F461056,0xADEB0F1174DD8AFF,0x989DA97CB54EDAA5,0x914C7B1E8AA1916,0x851D974682DFE3AE,0x69988E4DB1528B62,0xBADD2489D9FC9AB1,0xE420E7FCAC4DF9F,0x121E3CB48,0x7517545FDE166EE1,0x8D70FFF9A4881D6D,0xA84984DA240111D4,0x27FF89F3B7068D57,0x177C32DB1E5114E6,0xBF4277883CDB255A,0xD750941BBB9D680A,0xDDE4A87FAEB647E3,0xB196258879219747,0xFAD0457D,0x67B9A79E2430C948,0x8F095169B96B5C06,0xA1B07CA1EC62D59F,0x7638EEC9E7AA8FFE,0x348BAAD37C9200B9,0x69ED890BABD8DE3A,0x8289E9586ED8EC11,0xA0F7EE5AB7FF6FA,0xF05E917463C9B91F,0x7A5ABC80,0xF9D9FCDF30654AC6,0x21A4C726569867D2,0x1D248F7AD425534F,0x2F10CE1F6259E5E0,0xA90011969B483C4C,0x305711F1CCA45525,0x3B94AA8ADBFF1A33,0x2ACDB095FC45DB7F,0x741D952AF1C131E9,0x1FE40A0DE,0x2A8AA854B8AF090A,0x129EFE25553E2630,0x1F1CC518797CAC9C,0x11C183A8C7FC9E2A,0x9563A61667FCD4E3,0x3F123153FCFCE578,0x39654A29C009F7,0xA547B92A42CCCAE3,0x65CFB170222507F0,0x194F7C3B6,0x46F35E614C4EB2D0,0xED29CF542BC4E99F,0x8CE866D1B1658641,0xC30DB4F013CE2F01,0x70AA9D64C3A9916A,0xC3894CB6FE1B5B91,0x760B0E73143C38C3,0x24C3F697E18089EF,0x99D8C3D18C193DD2,0x878D08B2,0xB1C63F36C81BB1A9,0x70878EE896EB4A37,0xA4B8FADFB699853B,0xE22F9D6D44A955B9,0xD6AD72B071E673FD,0x8B5107EEC7BBA491,0x266B9CDC80FDBA8B,0xA1F10BAA320D2E,0x994A1880886E8427,0xF518BC17,0xF2B71E8943C2DCAD,0x273A02A8403E301D,0xECD2DC1E74275299,0x6B79A1BDA5F774CF,0xC281D20643FC1656,0x2AB0BC1331E89BC,0xCC01EDB9866C9C09,0x55F2D2B510863A5A,0x757152CD322C61B0,0x119A91729,0xD57B1ECCA71CD23D,0x5B96C23FCF7A3A9C,0x45800CA08E9AA8E6,0xD3634BD5FDA6EA65,0x9F904B321AC2078A,0x6D5120E5A436D8AA,0x7AB1E73EB0746164,0x2BCC352CAA3A6CB9,0x4DA57D6874146EAE,0x2362FA4F1,0xC97D8E622733A394,0xB963E47EBCE31C28,0x12CEF75053D221B9,0xB6F5DC197E6A5A3,0x47213360F3CAA3B7,0x68546BA1D40384E9,0xE75B7CE7E964CB4F,0x5EEAFC7F711004E7,0x3926E46791AE294A,0x253B957F0,0xEB4C532854C36A06,0x1A7A2049E01C7E51,0x237A49BF0AC79115,0xCA0DA7D38D4BEAC5,0x6BA2356774525B69,0x64B4B420F1421D1E,0x64D0F64510D57EA7,0x8039418050A32344,0xF8C44A365E9E480A,0xDA50A062,0x993A26DCBBCCDF6,0xB0DBD78B0AEA0B31,0xDCA045B9BB30198A,0xE9299CA622E98417,0xDA3C096AC7F12643,0x2AC94A59A74C2D1F,0x3EB1199C45E5A016,0xA4CB1DAA308D9317,0xA512C2429FF24295,0x1476641B,0x88F052E21CA08D4E,0x7217FCEDC7C20D28,0xD403EE44DC5A4225,0xE0DEACC7F1188552,0x72742D023B17FD63,0x97838D2742BB7E01,0x7585DC743FB9BAC9,0x43A11F9D4F3DA417,0x350C9DCDE65BF531,0xE1619261,0x542BCEAA8FC1A594,0xE455296733922F3A,0x41F013E6734FC983,0xFFF04973A381135B,0x90FBF2CDF57D327E,0x628AA05AE2274FDE,0x99B1E9B63D71A1FA,0xAF80F80C89492A17,0x7FB63584F9AEE41,0x1681D2317,0x81A21A22D11331DA,0xFD7D8CC13CF05475,0x67FCC0F44CC24885,0xCCAA2F11D4A1D237,0xCF5EF9D3248ED223,0x15068FDF5CA75C12,0x8C722D91C3ADA447,0x844C54CF32EC1B2F,0xBC43B2140F468E29,0x24223D367,0xA4B2E1794E7D6023,0x315FEDE8D426D088,0x774E931CBCBC5763,0x12BF23FE7D0BF9CC,0x848B8C2C7C239256,0xB300E6BFF4F4DB88,0x4A85B74D0740CFD1,0x2B0F60A235B4FD07,0xB0190EED22E06FEA,0x25CCE33BC,0x4F70ACBF430D9B32,0x12A2890BDA8D7184,0xD7981F7ADE7CBEAD,0xF53FAEC0CCF9A764,0xE39FF3596943240D,0x3181B0D9D46B3870,0xE5BA36AB8398E9F4,0x946CC4768EE9795B,0xEA9ACE0FC547E12E,0x173D9628A,0xADB8A6472C30D518,0x2ED9C804B4B792B4,0x9A5706F8A2F16382,0xEF7BA77AB9221AD6,0x5FA6821124EA556A,0x309E8B976600C301,0x3E78FC12659F4350,0xFE257F8CF55708E1,0x4C3011DAEF455AB2,0xD289D79B,0x7425BE4240AF8358,0xA5905F79944FD7F2,0x108201C33AB71091,0x360A06253E10E36D,0xAA79B81308599790,0x3E06080C58DA120B,0x9C5F4028E723CC7B,0xB094747933295DEF,0xB88A3E1F607025F9,0xB761759A,0xBFA73BC6F177891F,0x7EF3C19472EC6C52,0xF53DB043799C5B41,0xE35C0B0DBA06AD2E,0xEC78970E5FB81252,0xFBB7D66513954599,0x3D04D43E4FEEDA66,0x262D9AFC2953B3A2,0xF620C848046523BB,0x2049EBEA7,0x2F492720FD243A45,0xA716D86567F1F7C2,0x2815A6A3B212BC7A,0x39103130D812B421,0x2CCAB2200EFD077E,0x17CDFD0C10CB16D0,0xE34DEA11BE43F0F5,0x34C2EA9BB5E23C90,0xF22DB81A06780A49,0xFC749414,0xD57CD95B738DE45C,0x606DCBCF8F39D772,0x63D27839E9694B28,0x4F7705484693C471,0x7E58D9131886C80E,0xBB997B7D974BB499,0xAD7257A45D134D2D,0x2F1D57CB2F9FAC7F,0x90AD82DE05E5F627,0x55D4DEC4,0x4E864A8EE9CE456C,0x3AE884EC7DD360DA,0x561BDA0988F74793,0x27DFB5950210D860,0xA92DDC3B0C1FAC4E,0x74DC2E55CC33B3DD,0x7BE4266456AB00D2,0x8C8DD76F7C92BB91,0xF60E3D2B52A9C0D5,0xB714236C,0x1EC4943266B16E6C,0xB6D15E301D4C07A3,0x23FB59AD479B1A8F,0xF3325B35B585D14E,0x1CF93B7D032C81DE,0x362276EDD989122D,0x820749C63BEA0638,0x83777B3351F25665,0x4F6E534AD57F115D,0x297C0394,0x6EEF489C0BF4BDF4,0xBA01A715B2FB335A,0xC36ED72FCD4A6696,0x6C665A7D72801028,0xDF7C3B7FF2876129,0x98EE479D574BC118,0x1DF83E4A471A4429,0x7A08FDF1B225FEC1,0x7755E5DF3FB1800F,0x124D1834E,0x25F012D3BF517D1B,0x1A10062B0E7998E0,0x2BF58D2A0766454D,0xC4A6AAE5C52265C,0xD73F544C307F2387,0x221CDB5476772FA9,0x9184514D9494708C,0x8BA8BE5CECAC14A7,0x34032A3931B6C2A,0xC33707FA,0xB9F617FAAC729FBD,0x9D1881022E4F1039,0xC8B0F65D5EDAFC10,0xAEF656770253641B,0x83A8AF1824F8F619,0xC484F05AD2530181,0x159F6532083A18C,0x43797AFD7D0C51BA,0x779D7CD06042BAB4,0x2E9FDE38,0x2AD1E8104D5A90EC,0x98F00C2E62C345FB,0xDF44AB4D5226990D,0x11AAB9CE23D157C4,0x68C06C63276DE000,0xA21BEBA0BD62AED0,0xA4525FACC458AEB5,0x81E9FD928D6084BA,0x55184D1E918EB7A,0x18C1D0110,0xBE6BFC0AC3030A89,0x98B364BC2E6BEB06,0xFE5067652F4A9CE,0xAD288D0D185758E6,0xAD91367CEA1EF47A,0x538E874401098FC5,0xEFCCB6A4F508396,0x200780DEF859A112,0xDD872E63D2EEAEB0,0x233DB039A,0xEDBD26B1D038C358,0xF80BEFCF7A21FDB,0xC7EC288BFCF5D57,0xDBCF0447BB46913A,0xA42041C04D7CEFD9,0xB3E3757E30945093,0x2EBE6FC10C5752D6,0x2FD1AED1DE35FD3A,0xDAED7A3A63EA63EA,0x1C5FC3C64,0x34888C220C094332,0x4DC8B56AB981D66D,0xAF11C9D4114EA3AE,0x2C6F6287B37255A4,0xA1122E7196CDEACE,0x176A0AD49DE79AF6,0x4DEA47A5C56DCA21,0x42D7D93BFAD7145E,0x3FAE7F31B3DE7C91,0x1B733745C,0x4B2AF843457A71FB,0x8A97155A65B16C3A,0x319042F1D77192B2,0x16EB159F12EB6491,0xD32C2B57843DEB4E,0x53F564E541BCD2F4,0x1F0D7E70AD688165,0x93DF083341B16D70,0xEC8DACA72325418B,0x15D59BDF3,0x435AA0BAD7C2AD7E,0xF831B95343887A3,0xE14DB4288F895F2C,0x15FCD84867F96F45,0x6901B9A9C552AD6,0x3703B7CA6D482592,0x51C20FBE32A75EBC,0x7204A4A2DAF2C18C,0x5E2C9FB17CEA1B84,0x10EB43ECB,0xAECE6FB38326FDFC,0x97E0F36E1A5129BA,0xA9FD8192AD5E3726,0xFB4F18FDBF5762FE,0xE17E30DF389A511,0xCA7B917844D419CB,0xCCBBD3443FF753C3,0x853999BB895690F4,0xA2D4B57F94EC9239,0x1E1924C76,0xCBCD4E20F9789993,0xF40CAC6AC5EDB6FF,0xC1E8A735DE71D7B,0x6EE2DDB74D615561,0x971A47160E2BBBCB,0xB0C3ECE225C6087D,0x52B6462342DA6182,0xF3E432DBCB6927F5,0xA7BB8653B8B792E4,0x2FCC6B73,0x6631D125272D1F71,0x34CE189473F811D1,0x29DC837889A9CC75,0xAC8201A4AB9D963D,0x3CBED9C7C71D7768,0x66D7A105D2893DDF,0xE2D38EFF5F956991,0x3E5BD671DB5E8DB2,0xA736CC660E731333,0x1240CFAA5,0x962F61D294385D08,0x896415BFC7A8A192,0xA7417353D8D539D3,0xFB9B2191D6854F06,0x43372C3A938E2AB,0xC918662EDFC2FDCD,0x818D3736FEFB219B,0xDC976E9A736FB38D,0x7BCC1FB0B069DA04,0x17641F77C,0x15F2283E8C6D49E3,0x2B11AD9EBA330ED,0x2D50B73E4DC9B5EB,0x4277CA894DB1A102,0x9566E5F29C016686,0xD2CCE7B7AFBD93B8,0x6B22E8A32F0FBB9B,0x78899963900701E6,0xA545D07C7628F821,0x1A943F7E7,0xC5B5CB4D58A182F,0x961D00B7FD35652E,0x3B2A70D25235CB0,0xD6204508EE8D6308,0x83C9DB0733F7CDD6,0x2D7B219D2A6A32FC,0x7315418A958A3C7A,0x807C9C0183880972,0xEADEB7C60B80B07E,0x118B5105E,0xB8B4D0B7F750884C,0x3CDB30C6DCFF0AC8,0x9E87A171B0E0F2F6,0xD4AB7AFC3B209675,0x694CDDF124A82894,0xD3EDC09B1BAD4473,0x5EFEF301BE1E54DA,0xC2037622AC45E37E,0x4DA00E1130A5A877,0x102D2509E,0xA7476038853DA738,0xEB251381B5B563E1,0xBC4BDBE7EB099443,0x4C6A469115FD515B,0x7D9BEA3910BC90C5,0xAE71C965E675E420,0x92C9EEFF9464870,0xEC60745E31BF75DF,0xF50C2626BDDF6C96,0x16730F994,0x9538AD0F33689FCC,0x6F5BC4EC069C5A25,0x5D5E1A3751B750DF,0x49848B4E617BE43D,0x22019A4BEDADE2E6,0x8AC4D1EDA18B2B6,0x36495D8A2D20D009,0x1E3E528DD61E82C,0x2855512DD7D9E7A8,0x27B1141FC,0x573DE98607E7830C,0x4D4C838DD1E6DE7C,0xD8B52BAE0D00CC9A,0x7CA345C0858C4363,0x3F0CFFA6B04D276E,0xF5299B088C194F07,0x62B54A52FD6D910A,0xCEC8CBF44C7E5464,0x14FCEE94EC479470,0x19DCEA040,0xA7009B1E3D0ED509,0x1156212D404B0DE9,0x8AF3988A386A2E59,0x20B1448FA9443C79,0x2B12B8193BEECA8,0xFEA32883F599528E,0x56ED441B7A316B7C,0xFEA181ABF06489C5,0xDEE837903BDEF03C,0x1B5F9222B,0x242B176A499CE5E,0xFF8D6FA858ABC896,0x76B422BCFE615A4,0xF816C8CBF545E458,0xC85568ADE1EB6E25,0xEED6E3C208ED6EC2,0x4444E8875904B715,0x1E45EEEAE940AF,0x3B675675E75C8D05,0x213800A6E,0x9185B154A09B726F,0xBCBDF98170F9F43B,0x516C3A60902E1C27,0x5C509A2BED1A7A28,0xBF1B5BEFC1CAD22,0x3F25F643B5B6EAF7,0x6CF841464ADE486,0xC5D7EFF82043B236,0x3D67183A6FE988C2,0x2840E4F5,0x50F819F34E5330C3,0x5717CC43A8F128CB,0xFDB4194F69D2FA21,0x13D2863624271E55,0x2808DD11061BEA99,0xB7AAEC4437B52792,0x5CD9B32A1103611E,0x7213C21FEEDAD3E8,0x23BCE330C5C86E33,0xE5DF445B,0x8D06907C2CD6C8E,0xFFDC2F937AC23BDA,0x62A81CB9A75510FA,0xA9C5A036F8DF0B5C,0x93E3E77AD0B5E867,0x6CDE301C1A27DF33,0xC9E4BBB4E6FD6841,0x3AC53A186081B19,0x9EC8B6D747FF063,0x240B308A,0x68639A8B0A57F25E,0x6F89BBEECBE758BC,0x49B685B70CB5249A,0xFB691A68CD07C806,0xEF300C381C481384,0x97370138078994F4,0x80F65480E402460,0x861E9360574AE12E,0xDF38F9A1F779B163,0x4364109D,0x21528186264A6577,0xECBF835078FF8203,0x538E25ABCB8C2CD9,0x6C9DAF711A9A4BED,0xD858395AA016093A,0x8A957EDF78127C04,0xA1946C7CA4CB4C3D,0xFD9D54B3FDA33AE2,0x3F203AEF60A38E35,0x10B622FBD,0x3FBF8A58C9B97EFB,0xD8CA40BE288C46FB,0x343B40C4A29FEE23,0x11EDE34D4DC36F78,0x31074C30C4FF0982,0x7B4C5E2903A3B833,0x33E34F3C9A8A1BB0,0xEAD820CFB7051D10,0x70852930C3051C4B,0x1404E8BB6,0x1B864139FFAC7166,0xDECD79A49CB6A6CD,0x9DABED6D8BCAE288,0x80A12B32A844649F,0x3D29D81A8FA13AEE,0xDE82DC73490E58D,0xDA839DDB1C4A7C85,0x7909B2F002C8C3D8,0xEB52DFDA62099F8E,0x1FEA73C7A,0xF52BAF95DF2219B5,0x7C7C59FA385AA733,0xEBA6AA1676D4BC2,0xEFEBF516F5136B8F,0x7B6796FCB73BB939,0x99001717BA63045E,0x7FA7F0F3720C6C9F,0x70184A8DA9EDF031,0xA79668B44CABC96A,0x233BD345A,0xFD2DD8A22D1A86CB,0xEF0AF31898EC94A7,0xAD9887309EE1A9B7,0xA840ADCDD3B8DA16,0xE6879E4560225CD4,0xE94344CABB796563,0x89C0C4AF9BADD266,0x8BDCCB9C32AE1CC0,0xCC93CD00258D78C0,0x325C0396,0xD36DC370E234C22E,0x89C81DB0FE71860B,0x80566BEAA8310089,0x46D4DE079FAFA7B2,0xD60522AC916C5D16,0xA4B97FC62ED1D947,0x8568EE195AF66A5E,0x5CA2493726E8D537,0x6E0EF8ACDE517491,0x22C60FD8E,0x9FE40DC98EFB8DB3,0xCBFC5AAA3BF63B6D,0x9D8FEB72E1697251,0x7D10744CAED505B4,0xE38CEACE4BD6EAFC,0xAD138DA42C10506B,0xB42C28564BFEF884,0x2249E524859414F0,0xFFAAB38363982569,0x23B4B8318,0x435EFCEDA2CFD1B6,0xC39544C9C68368C,0x535FAD0A9D960276,0x244546E8A38DFFEC,0x4538D6B4E6167DF9,0x9587D1AF4DB697B7,0x877A709E801373AD,0xC80610A4D751602F,0xC070ED3444782E77,0x11640EA36,0x7C8CBCD8A723DA6,0x4FAC55512848A679,0x4D1721D6B4CBA17,0xDF377ED5459F9771,0xF6ACC05B9A77DF04,0x368365C92807FEF5,0xF2619CE5C9B6E79A,0x4D16970F09295276,0xE38477A74D43E13E,0xE8957327,0xC9708C548F9E3662,0xDF1D90B695A12DD9,0xAB1EB7312CE15748,0x6CBEAEF6BD39437B,0x8571FE51E6FE1DF9,0xDF572432940CD57,0xA3A8F942281EFC32,0x86D0F5FBA8FE5325,0x72A6E84AC09BD73D,0x226EED66A,0x9C8AE1AB213AFC94,0x6D6CA5131B3F9257,0x5ACC49320B2C6B71,0x36AA765AF8DBAA66,0xD4DEBABD6A248F0A,0xDBA2661B9FB1F9C,0x81862FF9E22FFC91,0xF08932D227B4695F,0x8D398E3DECE00220,0xA1200C01,0x7C8C44B4689CB166,0x288E410478ABE7F6,0x8F6BDCE6DE518018,0x9F9FC26A4110E080,0x518E24786055E893,0x14E1FEF37A6BA0CE,0xF47AF792E25F2933,0xAD707A6B92D65BC5,0xD95B81EBC4220A52,0x1B814BFFF,0xBCA6CA5A7216DEA9,0xFF2501CCB1753547,0x3AC0BFC5215F8BEB,0xA8A98BBC7E11215F,0xACC4A0E343BC7841,0xAA840FF8681C8565,0x19DFBF37B0082596,0x82B3609E16C41566,0x967738F7E786ABBD,0x1C92D5887,0xC012A0367C84DEC8,0x650DA26A9F272363,0x9611F4B865B1EC8F,0x51E5022B472E58CE,0x30BDD0FCB0A7A9F3,0xF7B34C2A0A1EC2FB,0x34EAA10003445ED1,0xB98CD5E1C9511C4F,0x8B52B43FD3A7BC1A,0x11D8FCC,0x2C5DFAED49361356,0x1A561F97BE3B5289,0x78DA2E4321FD9602,0xE9F9FBA857AAFCD,0xE2253B8E12F022F0,0x5F67A074A1C3591C,0xAFB66DCCAB785100,0xD6BC20C6FE315C4C,0xBAFABA7342CA3EF,0x12D443A02,0xA0E117089BEEEE9A,0x9A9EE9C23B7962BE,0x908C5D423F0C9D89,0xD3FA8F34A83C3E81,0xD57E667A03B803C3,0xE7E45F88BC3A8B89,0x7E4073A869772B27,0xD6F16392DBB9D5C7,0x70C1135AB96E2F83,0x16FA9867C,0xDCD8930402F83317,0xA0EEC414CED9BFAA,0x82929DEC298B4F0C,0x4689796B3012DDE3,0x1758D53FB4046EC4,0xA7A3BEF4DAB0BF9B,0xAEE83AE3A62396D8,0xEB09D65082AA5044,0x531DFF9983355B91,0x258966A7A,0x72E327BEFE95FB5F,0x8EFA8EC728215222,0x573A98E78EAEBED2,0x11174F41F88BBE11,0x67AF9B0BA5C42188,0xFD71042B9B2F6416,0x158575DEE2168E78,0xF0CC0DAD3BDBFE4A,0xAF8048787B7BEDB8,0x42BE4928,0x44F40905B5771C89,0xE77668E525123213,0xC250F8B769F13FD2,0x53C57AD96E44EC16,0x47F9B3F536E3046B,0x436C78FCDED94CD1,0x210AF0478BCA004B,0x4A118251D969B9B6,0xEF7E580935C32C9C,0x40F1414F,0x2BD46758018CDF82,0x37E6B6C6EDEEC17A,0x7DE66FB1CF345AF9,0x3BB3695BB89AA2EB,0xD9FE3671766000F7,0x1B4B513BB2A889E4,0x2063AEA1406DA46D,0x386A0824A7301B2C,0x45D598319703574F,0x1182C8EDA,0x4DEEB320F4A8817A,0x299F7136BBE42ACA,0x36F13373F20C7E20,0x6923553FADE05847,0xB485C23B053F4FB1,0xF2E31CE264292517,0xDB671F32433B10F5,0x205F7AB9B851E22B,0xB5FF2AF796B5DD97,0xE13689C9,0xC876A1D6FC82B85,0x4505242FE0CB3C3F,0x35F3C5B7E08C158,0x99BD51A4B7543E0D,0x182111B1666D2F58,0xCBC80908D2A3DEC9,0x13356A5AE97B9D4B,0x802424B9C5FF672A,0xE568F00F4E9B3AED,0x142F3D6AC,0x50BD416471573145,0x5A14ABCE917911DE,0x2DAED79B7BE4E313,0x7317CCA4ACB94BCC,0x51AA238BB5D1A9CC,0xA2A2296AE0596490,0x96703A53BA7770A4,0x4A8B72DDD35BFCF8,0xC1C9A99F73C08F89,0x2631A4A09,0xDC618E490137408B,0xE420E341E41A1B77,0x8951E76E03118171,0x322C8E6ED1E27A44,0x5D4CC3449ABEB728,0x4EE41BF9AF9714F3,0x35BD14538A25581A,0x3343F3990B8AD8DA,0x9CB40D013204DB4F,0x1C4576ABF,0xE1BE2E224EC8EF3E,0x588C3E638DF4BA0F,0xF39B5BEEBE1CC81D,0x40B5C09567DD9D59,0x5D28FB7ECB32F864,0xB8941E6A68B5C12B,0xCD5BD250E8B2BA64,0x55F07E4AEC3C56E1,0xA2CE25186B3126E3,0x3C8B1044,0x8CE8E9DB93D80C7F,0x9450ADB518F6259E,0x175DC127649E3A19,0x9EF45572FFA2E54,0x40F4C24C50692DCE,0x64455616D3842C75,0xFAB57254EEB5AA74,0xE372ECA0DAC17B89,0xDC19AB13608DF69F,0x18B8D6270,0xD8AE94C5B4DDB361,0x9ACDA6EEA310421C,0x5769C62DE2BC1D96,0x6D3D2F52CCA293F6,0x229565B15D81145C,0x83DA6A056A31E592,0x35FE27BDA7214500,0xE3A51C56506B931E,0xD46DA897A7C5D307,0x19D39E9EE,0x5A87FB706D0D5F8D,0x426EFDB1DED0CFFE,0x889B446EF373C3A3,0x9AD3035E774E3476,0xBBC32FEAC51F0C11,0x7133656C4099E1DB,0x7DE7BDA140DBC69,0x56FA2C9D5C0FA9EE,0xAB79D51584B574E8,0x1BD32672E,0xB89238280E8A2254,0xCCD03CC96EA4EDF8,0x200776AB9BE6F460,0xDC5E5EAF323331CD,0x8D2C76A4797F49E7,0x7C390DED9C6CB66,0xB16A2C3A6BF64A4,0x665B296CF8375041,0x52D92A6F2C438FA4,0x23D488659,0x15F0EB5622EE6333,0x7B62267503D0F7C0,0x3DC8F03D75B1D514,0x44E856D632976A0F,0x2068BA4B770F950C,0x78D4DA73FDC24BBE,0xBCB074E1DB87D76,0x23ECF5FB7635893D,0xDB333C88E9064FA9,0xEA16FD46,0x72E60EA789458EF4,0x43CB80086B44C90F,0xB9A7FBC27EC6DF7A,0x3C2A6F2331CDF1B2,0x5D9907F33747481B,0x992072FA9FE9F913,0x28B0D481ED5664CE,0xC885749BD9C666F3,0x56B8475E07AB06CD,0x58A2A3A2,0xB52E3FB04827B349,0x523EA2A2A463FFEE,0x3FA9BE66341D2A79,0x3C183938C8EF949,0x4DA6D97DF27ABC1,0x1E79ED30A19D2A6F,0xE5636C83BAC87704,0xBACB6CB470AE1756,0x7A378D0AF796AA8E,0x2002E33AE,0x40C29B96959E5BFD,0x608BAE14CE9E28CC,0xB133CA89E4EA905B,0x6056BBC7FD188EE1,0x7D8AD8855B2A5ABC,0x867CB0C40BF5AB19,0x99BC3E56FEE43846,0x67D78A54921C07A0,0x6D676A661D831AB0,0xC90F36E0,0x7ECD9C543463EA61,0x7954C058324B5FA1,0xB7F8BA200F5E48B4,0xB5A44A7E257DE4D3,0xAFF1CF4278163CCC,0x21AD357B784B7407,0xD4109151D113EFB,0xF06B09B869A167C3,0x4E81C45333AEF8A0,0x75C8A07E,0x9AF5F34DC2CCC7FA,0xE9B3CD998B7CA16D,0x572FE1C7D102B29B,0x10545CADD140A638,0xDEBF867203F0DD32,0xE614DA9B91F1F5E9,0xCFEB34ECCEC07619,0x26F261BE5BB967CE,0x9B0C1EE468BD1800,0x18A0F22CE,0x833E7C933C29265D,0x45C3677E1FF5F784,0x2BE185430051233E,0xCCCA53973DB397F2,0xD911EE7BF197507F,0x740D72A5134475A8,0xC532BE46DD124F61,0x74D9D97DBF56985A,0x39B559F4DC45A3D1,0x1A0F7338E,0x9E589E0E3A059405,0x9A1DCC3DB98B6BD2,0xD2FB4C662BD700F1,0xD4B1083BA14E7DA,0x8FFDAA3378C4AD56,0x7C7FDB080D1E73AF,0x1DEE8500C9F93947,0xC35D4E939C5C9BA2,0x25477E3634BB3D92,0x13D90CDC5,0x652A5D788595D9ED,0x9ABE49264C6AA929,0x4665FC0D51DFC94D,0x1C246B143C19760F,0x3C621CE35190A128,0xAD015763F0905886,0xD0FDCA41B8181BC8,0xD26CF49C4B461049,0x1829C3193E915A1B,0x13E9462E2,0xBD72AA17C6CEE8D3,0xE50CC04DD5DC1664,0x4A9354E44D7582C7,0x101015D733D6E138,0xA2F0EA76CFB11113,0xCC1BB2DABEB0713B,0x24C29983E4F22ADB,0x896B23FA8F973C54,0x1AB49C748A5B4183,0x126E64C3D,0xE9B5587B568855BD,0x710F023C2500C696,0xF21881B02ED1AF2E,0x92E0D767745FE964,0xAE9A1F7C73F9F12B,0xF163DE920ADEC061,0x2B242FB23FF96037,0xF6C6558B619A110F,0x98645F7118467B55,0xBA364F9A,0x5D09BDB96E77F365,0xFB63B5E8D81FDA10,0xC3F876D3245D9360,0x89290B616600E098,0xFF0400272A39B88,0xE310596181FD70F7,0x67EA5872C4AB5FDB,0xCB6895BF3C69BBB5,0x82AC5CB40901B523,0x25617EA06,0xF123F76E35D7FF07,0xC195D6A5791DE718,0xDEB324ECF9E19821,0x546FF959F1CE3D29,0x4A9859FC9E0826E9,0x2C1160855C20E776,0xAD994EBCB2BDF6F4,0xEFF844F5D19AFCC4,0x4F8F167C2F12B8D8,0x10B23AB06,0x51BD985001504FB0,0x7327EA2E3AC9B069,0xA9578511162DAA35,0x6435117F295B56FC,0xA9B5E7E4EBED4878,0xAD080B12333E989D,0x4F4351805F2BF363,0xF44DC29440886FB,0x7676FEEF676DC265,0x242E968E3,0xEBBE36DC9BDE919E,0x32D07A3DD3A736C1,0x894DD78E5EEA66BE,0x12A7EFD1159B2873,0xB7DBC02835AD5242,0x425E128CA7BFC6B5,0xCA979B6687BD39F5,0xF129D6BA75DA77B5,0xA33CAC7B2C07E1E4,0xBCA9321,0xB8FDBF2EC2C0ADE6,0x3B19D8175E34F040,0x3FBC7BD4AAD25707,0xB6E2742890B82ED4,0xB03D6A4E6FAB88E0,0x1F64A545E0D1A461,0xA7C3C12B081893B5,0x68948C261907164A,0xF2B4AF0EF36CB075,0x1615A6ED4,0xAF0FA1EB354C192E,0xBA7F64FAA78C6B9F,0xD32794994A808F46,0x515A311E30CC2367,0xE6D0445550072AD8,0x248682FFDB8D82C0,0x8BAAF7AADFBA8760,0xD20A1C8F0DE64180,0xD95E543724DDDD7E,0x8121FC17,0x5D5E74E70959A678,0x45A5C6DAFDA3C205,0xB3F61D09B95899F8,0x840B0B87BFB730D1,0xE7E59DD038D2FD22,0x931740EDDDF88290,0x20D4C484B59E0159,0x8D3EBDAB48224F1C,0x1B90FB19A4423260,0x36EC4E8F,0x7FD0BB3CEBB49D0C,0xEBDDAB78EB5C88C3,0xDCC18BA1EF1F5DE1,0x8587819747790BD1,0x23441FB04A9335D8,0xACD62B4FE86EDA8,0xD94F2439447B5FE4,0xA45FD813358B0344,0x5C1D6C1F13769737,0x266766763,0xB90964DDA48BD6F3,0x302525C05497BEB0,0x4955B99CDC81322A,0x90624CC2596C5A9A,0xD44DD0BF27996D79,0x819AF5DCC397B0CA,0x1460D50D24355542,0x2184D2743F5E5DB3,0x2E1818A2BCB2D2B2,0x13843C43B,0x98248E602D04D2BC,0xAB5AF32F5293AA6C,0x4550EFB0064905F0,0x8016BB9E89AF799B,0xEE6543E1096659F0,0xC266129169B69268,0xB9EA52353ADEDF0C,0x8BF0C8EE507A9219,0xF3E556D49C36BBA4,0x205B85030,0x8960FFF9474B56F3,0x18F6EE112418D65C,0x9D53AFB1FFCEDCEB,0x7AE72BF8A6045E6B,0xB301B750839D7064,0x85CAF09B5FAE19AE,0xC94D860203E93C16,0x9D72D6E5A536D238,0x420D500F271E1670,0x260C3E811,0xAA877324B183B4D3,0xE66B9F26E5A55C70,0xD01121306C9F6550,0x73ABEDE0C6CE58AF,0x6C458023E417A4B6,0xA5ABA8D8304D2088,0x8E1C54C34B729C3C,0x13EED28040FE84CF,0xB5662F6D09E70013,0x5E958A08,0xBCF3257A6EA30ED0,0x49F01C2B035BC651,0x49BDCC576C584FA0,0x7346D68BE611AAE2,0x97C04D40B1667149,0x525C8A66A3A16601,0xDCC676F802924620,0x6CE05DB3B947DD8E,0x2EF2D56590ED9A12,0xE874E5B2,0x15FD96CDFE0C1CE1,0x194F81A254A64072,0x6EF906B32B6F4A,0xD4AC5F85F3F94C7,0x7D4C51CB2F50552F,0x9FDE5444E05C6989,0x5E98FC863ADABC87,0xD5AE65D64FC3E520,0x20C5B7ED7AF9CA0B,0x1F4DAF305,0xA06A5800D03F425D,0x9CB98FCC737639C6,0x991B0FC9EAB3ABC5,0x4D98DA7D61AD8173,0xE4149096C88B1819,0x82521692C5CB1C0D,0xBE9CDC0AC03DA6D2,0x7F0180DB6E1FF827,0xA7C7487C16F5EC93,0x153D77E56,0xCF45B55C51CBF071,0xB69B3C240A10428A,0xB25CC5C0ABDCFF0F,0x9FF4E5359AFC7A28,0x4CFE96119E12EC4D,0xCD979D78143B3CC2,0x804F23BAC09CB835,0x37761C900DFE7BA3,0xBDB821590F13BBCA,0x2262821FF,0x1ACFD08EEFA05CAF,0x6E7E61C83601FC11,0x47243BF3AFF480F8,0xF4FF70DA2E1EE8AC,0x751D06F93DC49B97,0xFFA1FCD128D0C286,0x8E5FD9849A8A3411,0x62CF44E6DC58D736,0xA2042E90CBEA9E94,0x1946435F4,0x9D020B788D078A67,0xE9A388DA0C741CB8,0x7FE18F7CAF4F7A3,0x8E099430C7C1E23,0x31768B48D040E46A,0x1F4A8A656C4AD2D2,0xDB8974B7A0E2EEC5,0xD913CB8F8488ABC8,0x60E8A0FC71726280,0xEA7869E,0xB000FACF020AB63B,0x388851299DACD05F,0xC6D9029AEAB420A5,0x4C0A9879D05CD3B9,0x985E3AC1098846A5,0x51EA2C2FEDEC9976,0xB819121843FEEC46,0xFB47344771C3CC41,0xBA0E1A842E47A471,0x542EAA2F,0x51D845328E66ACD9,0x6FE3162D123C855C,0x203544E6D3812B16,0xB6426DA6B66A17BA,0x97827BD224472CD6,0xD3C64AF8B5CD8416,0xA9A8E0035B0B9E06,0x9F36280D52735B4,0x6EDB534A9CE429D,0x14E843624,0xD2D6CB71CD4D70B2,0xAA2C490F59F413AB,0xEAE155D43A0CD97D,0xA1D97775F0D8B693,0x9206918F7808B83B,0x7E4C8A234BA47E94,0xBE95DC314CE71C4D,0xD0F3B38BD7DEDEC6,0xA0CBB76757C43A3F,0x154F0CB89,0x7758A0798B0C04F,0xCFB01DD5F372E4E4,0x7D9FEC1F10966A93,0xA9510B13A3B8C138,0x9E3D26C188741013,0x9DA0859500E00846,0xA5698F0C66D67E7B,0x390EC9DA84A6E522,0x9146D88A7A00579A,0xB0E3812,0x16A850BFD2CE449A,0x3D447772293B219D,0xEE770BFA5C987F90,0xD040B68916C691F0,0xCB5E952263A9A4FA,0x3E1D6030B4340A6A,0x51947BD3608C3A2F,0xA3F1FCE9A146144,0xE77314DAF7D82CC2,0x3FDF70C0,0x44978F898E409C58,0xE3E5C6065CF72B50,0x2D91910D6910B82A,0xDA6B4A17833EA383,0xA8E26AA247B6279,0xAAA4834CB62FFD75,0x92B6EB5499DCAC6A,0xC37A24ECD3ABC72F,0x59AB5FEEC7D5D7A9,0x1AFF55721,0x7E3ED0582CDAB656,0x8AB4BD8624160CBE,0xFECC9790A45DD98B,0xC035449B3E452405,0x34FD4A143B174605,0x3034125558EEA0C6,0x3D07BF54604D0F9C,0x39C7847A5D09565E,0x4508514DE6084E8D,0xE465E69C,0x420A905E4EE3548E,0x43DB4197DB9C95A6,0xEB61F7CF0EF51173,0x31FF570CE4F9D1D8,0xED409D93CE57AB6C,0xB01A15719B0BB118,0x13E2418C82D7B2B5,0x253FD468FAECA042,0x86946A71EB190C5D,0xB7F0098A,0xB27995D0A13E66B7,0x21B2C966E6C63CE,0x2C588DAA9B9B2EAE,0x4B3E5A53F42016BC,0x12C9A1DD1E66E421,0xA74A20C8A944A40C,0x35063F975CB25305,0x271B59F71A15E24A,0xE54C461D052CDBBD,0x19F9E72DF,0xDA2D27E8B1D01706,0x2449690685A6877E,0xE7608C5A53198611,0x80568544AF486258,0x86092966E8A64A7E,0xA67323E8976DCC0C,0x4B7BB8E5FCBFC9CD,0x40859749F375E20A,0x71559B1FE063FFA4,0x62EA9F16,0x6F48C1107C42C291,0x6EEF7660AC594D94,0xD3D8CE589F53AA0F,0xC1B155770F27D24E,0x7F068A7B04462513,0x471DF30F7474E8A7,0x8B88AB9709CA1C8D,0x4FA5A2633265A9B2,0x8F0372CE69857A09,0x798EEC8,0x549BDD9E84F3660E,0x212B928D8CA1EC28,0x56EC5DDB55AB6835,0xE8F23981AF4CDE14,0x7FD0CB4DCE0C271A,0x594749901E29BF6A,0xDAD27091388AF57,0x67193642D0D63597,0x9B7B7C28335E217F,0x6A018F1A,0xFC71FE32DF5700D9,0x3F20CBBABD538B2A,0xB00A74A440B79EF1,0xA2F8001171E4974D,0xA16877E756E63D48,0x36CD1766FBE6959E,0x800A0ECEEA327959,0x8179781547BA3AD5,0xA310887358489D53,0x275F2C2D2,0xAABBDE8FF49A8617,0x2E06889519F4650C,0xAB026F31B9B22D50,0xDF01FC4906964767,0xA769A86907672703,0xCD14035EC7B87D64,0x12254072EE240C26,0x1E5CB1EF9380076E,0x9E5D6D51D22438E8,0x15B295A4F,0x791971CC16EB2697,0x7D956E5B655A26D5,0xBF9D66ABBB08BAB0,0x779580003A7B8B75,0x7DD7614DABC9C6D3,0x93E11B2286ACA6F3,0xD3F4583AC8E09FA9,0x31D76428D4B4989F,0x75E0DED7F3092D1C,0x28D04233,0xDD817BFB30A6AE07,0xE8DD7E11640765E2,0xAD4443CCBE6230D,0xB0A1D64FB4CE1EA1,0xED8F27B149F710CC,0xDAD673383496A3F,0x1779E6566A0BE87C,0x58A918A2080B5543,0xE979B8BB5C68CD6F,0x1AE052C79,0x98AF005CBA492E94,0xE22E407B0679612B,0xF54292FCD5E61647,0x834A197FBBBB6CB5,0xC3ABDC68F4FD8492,0xD047D34601B4DC4A,0x4275C07F531149FC,0x5B8F31F3B79BBBBB,0x7781A55448A27765,0x26238736A,0xBD68B50B31730EAB,0x115CAAC9158272F6,0x94B6D2AA5C7415AA,0x13106D1DAE274414,0x7AD87B6371C26E58,0xDAC97A84FAB25EFD,0xC2286A1223A1E11A,0xCD7D73CEFAAA8203,0xF81812B3CB0FAEEE,0x9F7F7C76,0xB43686FAE6C7FE7,0xD3FA193B70D78F3E,0xDAEB36E29329186B,0xA982CBA50F0BF523,0xA1999606F30454A1,0xF84D5C717EDE8B9C,0xB437761717F45E8B,0xC4BE2035AC7A460E,0x4F14D933D2620556,0x5CB4E81C,0xBFD56629934161B,0x971982812B134997,0x1EA5BBBC52314E73,0xA08B661D52ED5E36,0x2F4389F3FF86A0C5,0x1DE247BF1F74E7D3,0xE04A3C2A689F8663,0xD289B3BA14DD2ED4,0x202283B8B9ED4A68,0x9DE2B328,0x27CF803ADE99E27F,0x492B456E87D71C87,0x54488D46A9F82AF,0x18C2474005DB29D3,0x957F1AC6BA6959C1,0x8B7D4CAB43321184,0xD268B73EF12FDD3A,0x4C727F15E6F7E98D,0x1E7B75AFE315F544,0x8129D3D2,0x63622C98C0FDBA75,0xAA323700052B3ECA,0xD140BDCFE935C8FC,0x489082437BB2A281,0x8235088F73EFFA63,0xF4C867A4589820D,0x8C42A213D462AB86,0xD74B7CF438E5F9,0xD7D580647ADCFE21,0x1AE47FDDF,0xDDACAEF137505F74,0x524B9DAC61B256EC,0xF51249248B28B131,0x2F90DD5F1FBCE9A0,0x97FDEA2A5DE14166,0x114B588821FD415A,0x5D90E7A71AE2FAE9,0xCF2E2BB26C9E7BA2,0xA3D1A30B5B81871E,0x72A90726,0xFCD1EC81EBCE52C5,0x86D94D50F4871757,0x5AF592BBC3C67172,0x2F70E6648855538E,0x1B84E80A7BAAAA01,0xD6B76EDEAC7CD576,0xB879F99E38E7A353,0x14AC2395208A9A67,0x200B359EBEAE3A2F,0x1578B2D4A,0x751822B468F82A4D,0x3BCC76E2F6F7AA8B,0xC9515E9CBD1EA8B0,0x159E445743C0E89D,0x2EFD912972115E99,0x2D41A342B585BDAD,0x9E17C9427D38E5E,0x78CE3B407912C7F0,0x749454804A6FD6AB,0x271B2D60,0xF112507A17C53016,0xD858607C69D9E90C,0x11C4930629F0A999,0xDB2B699EE2800150,0x37C80B05FB3AE76,0x19C15B60B421D6BD,0x3ED102F38199F95C,0xD1594857846AE283,0x566D241DC4697D0D,0x17F16BA9,0x32CC353B81165DF,0xDFC56BEBBDF8A0B9,0xFB617C57B0089546,0x918BC7F69FFE8405,0xA972D47AC8276BD1,0x8F93593E8B652472,0x6BD748D15D971FFB,0xAAA49186498475B2,0x95A30C496CBB3A9,0x14D25319D,0x85AC3C32DAA2693F,0x39A05957625B86A2,0x84C7323A51E3EAF4,0x292FDBA67DEAB07,0x3E30C7AFEBB74182,0xBC8919C70CDCB569,0x38A2017E7769102F,0x2F195DA9DF4AE8E0,0x2918714EE38F68FF,0x258E33903,0x631899A19BFB4EB5,0xFA1B7842F56C994,0xA958E80E5EE3684D,0xEC93CC5CFF57BA4E,0x97F11B81F281,0xF5F907E58FBCDDC7,0x1255D7E5511BA4A8,0x2A434A9BDFD97F8F,0xD78160E480C62329,0x163FC6B6D,0x786D6786FEFA42B1,0x14212492EBB28002,0xFCD3FF95B4813254,0xEA8542C98A1F012,0xF0BF9CC3829D0016,0xEC8050444DC242D2,0xF524F92A30421183,0xC95A89969392C5DE,0xB1A414B265E3EB99,0x2762F5233,0x18D80BF52717FEE0,0x96A49202E64E0DBE,0x45031B7F781367FC,0x4E675800AD3BA229,0xEAA50A16397BEABD,0x21648F74E8F4623,0xEADD24C197F6DDDB,0x497490687D6FCAAB,0x656F3F9B53CA16E7,0x88C4845D,0x840604A1F60696FF,0xBED8F74DCE73A1E3,0x60C4D7017BF84356,0x596C65F4A3021B8,0x172429E75D3D5D51,0x36229954EFB1A48C,0x7432EEA6438E3C85,0xB88B3E0D26F08693,0x18C463F67647576B,0x201AC9840,0xA52696DACFDFDED4,0x6C730C9D29E92A43,0x85786764B9F9FEE8,0x3CCEAF5AAA0CE1A8,0x84B2DA63B3677671,0x91B2E35EA3707BD0,0x8E05D02751565A83,0x5166ACE0CCB9C303,0x8FB844DF1E80F951,0x11ABCA70A,0x4D429B3750F39984,0x89BFEE466FF76D3,0x8299BD4FB9A990C7,0x34FBE033D43C31,0x73D14B8B40CB6811,0xE65486671CA7AEF6,0x417772550BFC6F0F,0xA162B2464899EF0,0x83A4AA7AC437B3C0,0x1798D06DE,0x45A4FB56E5553831,0x41DD71680F9D7CB8,0xD33F35E6C83530F1,0x824763741EEAB404,0x1CF21601AD3BD47C,0xDE35422900110A3E,0x8FE5C2623CED3D18,0xC765AE28C5162999,0x4F683D93D96DC333,0x1F803AC8A,0x49A0E3D001ED6E27,0x714C642C3FB8DBF7,0xC15173ED4721408D,0x243DAEBBD0504665,0x8BE9D79FB98FBACC,0x82DC5B4BB4D6F91C,0xEE721B2184EA5A5F,0xF0F2CC6F6BFF49E3,0xA607FF81658E7D67,0x13D117134,0x124C034170AFD806,0xC1F33CE854AF0ABA,0xF3CAB14B80E84B3A,0xCFB201D369A714F0,0x49A8ACB331125C42,0x648BBAC923F321C,0x28AFFBA3A04D654B,0x6223C8F7801F619,0x38CF5FDE23241378,0x31ADBE41,0xE748A317D4AE5A19,0x81930072346C1514,0xDDDFC400B474B10F,0x362D79D55960F42C,0x5EA75D8ACAE42CBE,0x2E9F5B9DD528682A,0xA2AEDA40063DFB0C,0x3B76270C9E9312F,0x73AE54E335986675,0x1F2BC899D,0x23DE504A36646C48,0x63F860D8A983DE70,0xAB2F2E4AA8E7617D,0x5FC8F28D1A452BB,0xE919F25BEE9C4552,0xCF45FE02F6291EC2,0x5267E4537284A26C,0x3B7E782EB97C235,0x29796CA57E08904D,0x1C6533F16,0x7BE29509117CD3D9,0xDF5416F2BBB62012,0x9206B6FD05E6B183,0xBB3BCEB837D2A83D,0x91E9E68BA1FADFE2,0xFFEF608593C38D2E,0x277A0E8D09661AB6,0x38FB834A10DF3FF4,0x12A84D2AA44685A2,0x1B714BAD7,0xDE076BE99C32795C,0xF71D649998CD18D6,0x9C97096FDF72C64E,0xE4A553B7FADE42A5,0x7FDB318CF2D5FA1D,0x3A2E09A0ADFEB549,0xD0C483943957A601,0x456708CD98EB4338,0x861BE77EE0898F6A,0xD3E4FD56,0xD8CB85934CA002B9,0x161D76F2BA6E5CDD,0x40C1F8F70B667F6C,0x80F3F87D4225BB71,0xC3F3918F2F8F297,0xF1F59DF2DAB2B2CF,0xB83D0FD20DCF0558,0xADEEED09B52A2AB1,0x97AD37078D260F3B,0x211A6985E,0xB8B11838261D2259,0x6647C27B84CCFE35,0xD1F8E8763D4E10DF,0xA36F76804DE18E28,0xB94C8D79298FF4F0,0x9E9465A7066DF259,0xAA72AAFE61B5D3A5,0x371CC542A526EAAC,0xBDD30EE54C46D19F,0x64076D3B,0xAA11B46F1A903262,0xBE21E1A6AD1C731E,0x2DC6B160F2F2746E,0xC3C1FFEB8BCC80B8,0x539040CAC59A812A,0xF424150ACBBD7176,0x6FB7ADEBCC1E3399,0xDED3917B36998D1D,0xACFF96DD1BE6FD02,0x1EBED164C,0x576836EB3FA643FF,0xA74B1A9D1394C48A,0xA53A02E4D1E04C62,0xA809DE4F96900D8E,0xF4420636470FAA7D,0xF6EBF52D91D34CA5,0x3EC6E7C1567E6AF6,0xA92D61D3AC8680DF,0xE15216BA026A8AF7,0x25C002D14,0x2E889D5F34C87A2F,0x8115A08CA726CB07,0xB1A74FAB4DD9D4FF,0xED9FEA77A27EF3AB,0xAE205737C7DE9BBB,0xBEB4F7C9D01D00DE,0xB3725A9424D67956,0x225A48C0ECFF109C,0x36608AA598D6E0F4,0x202C571,0x3796AE1AE024BAA9,0x20A2C3D2EE4B3CD2,0xBA716E878D1F2127,0x78AA5ABAE8F9F096,0x9E14D4F24C8B1720,0x3FE85BE7F74A1EFC,0x971994607397105,0xC60C08CC7566C764,0x9540784144467B36,0xE9A2F200,0x11307985664D422,0x22B5506934FCF013,0x1462952DC309BFB5,0x2D0F3F1F5150144,0xB1C27F686BFCE9F5,0x5C628A0EC4BCB007,0x6D30CD8D75F60FC6,0x9A316A236BCAEC5E,0x2543BFF8374E8C,0x1DAEA4659,0xA590BF2FEE1FA314,0x119217D642BAE7DE,0x873B3B9C86C91370,0x94ED39E6080A7B46,0x95BD2C3288FC80AB,0x38FCAC87CBE53461,0x805CE4AD6574369C,0x3F04B0BE7E0EF85F,0x1563395B80190477,0x53B521F0,0x48F8CB84AA5FCF2B,0x2EA05579034E8D8D,0x9DB55037746231E7,0x64433464EAD834B,0xA676966C9B292A8E,0xCFC285D40944E56B,0x7C6F15457095AB4C,0x1B0A068AE12E70FD,0x5DDCE0970912ADA,0x26862806D,0xA8A337E22F650B69,0x3F05BB1D9F16EF3,0xC3580BF6A73B5438,0x56B8AA6364BE665B,0x45A763B9F2BB2EBB,0x70550E88AAF47B54,0x1113ED504DB68A39,0xEFD64C0EBB203C85,0x72C5746C6D50C967,0x1D04526F8,0x173AE3A3E4D29A14,0x4FC08531B14894C2,0x2BB6943D41B77E4C,0xC60B7947357A1059,0xFEE13EE61E8C8270,0x2DDF3FC21523A5D5,0x5B2C80D52762534A,0xC05659C05D75112,0x1707B5E8D50B112,0xAED4D157,0x129912DC5725DD7F,0xD79024DFF1DC5D86,0x914AFFA9E03619DF,0x9D45298A8962466D,0xDCE21C177443A7C7,0xBBE999192FF6A1FD,0x3B8AD78DB84889A3,0xBA4BD52BEFA2C336,0x93BEC0796FC5292E,0x151D8EA97,0x938B7C3282611D13,0x7D7ECC23CDE6A3F3,0x9348EEC84B646AB3,0x5467E1B5718FA132,0x4198A39BEE18B7A7,0x85C4600D76B961F9,0xAA9B95C1BE557CAE,0x3460072FD4FB6075,0x2057FEB0EC4E7463,0xD0D12CA3,0x5E33DE64346A1A3F,0x698D840698B23FB8,0x8B3227701265BC75,0x375F529E7430429D,0xF33630379AE4BF5E,0x615CE847616E5223,0x343ED5E9C6515DBD,0x93999F4E4B2BCE39,0x52CB6534D1C061DA,0x1664DEC66,0x833F983738BB6978,0x65BBD8734273AA2B,0xBCF2607465189440,0x687783712C2459DB,0x43C71F14A1E7678E,0x9FDF27F8809D6DFC,0x1F0D66FFE610782B,0xBC61AE3F47CC6F1B,0x4323B4785E3CF0D6,0x16A744617,0x87D86D94C2BAA4CD,0xDBDB4DF123C74BCB,0xF45D5266823DC2E3,0xCCB019B1CEDBCBF,0xD3B88364813CFA4D,0xE6395C8105955B7D,0x18159CF86CF9EC6D,0xA28C6E8D1D313DD2,0xF56084A93B15FF2C,0x1D514BF4A,0x8409791162D361BA,0x487D768C7AC1E482,0x1F554C58F94048CE,0xF5634804B5438FC0,0x8D05BA83C5849B34,0x45815BB9B6004CC3,0x672C1047DE6911BA,0xC4CC5D5479909E73,0x5EF1A717D9116BA5,0x111265B9,0xADAE2F578A2E2AD3,0xFF771FA03003142E,0x609CD73411423D15,0x6D4BE9157F610B49,0x81C75B8E7860EC75,0xE3E7F9698EC9EECB,0xA220BD04AEC40441,0xEEDA26AAEAC06C23,0xA85120DDFC7DFA4,0x2725FCF2A,0xF7BB455930446A32,0xC6AD03D12B1146CF,0x760DC0B7195B5BF8,0x2CA415689FC8EAB7,0xAAF566EFA5DC6CD1,0x7FCE2DAE48CD742,0x14659C4A5E65D491,0xAD62FA52CB1FC3A0,0x52930AD687010DC9,0xFCD2F0C6,0xC6E9FC0A2CFBEC98,0x54316D9569638DD6,0x62A9D3D7FDC7D8BC,0x696E3AA2649ACCD8,0xE7C4B964722E6B2D,0x76FF89F3039CA59F,0x871231730BBF1F65,0x8F7805B492E760F3,0x83C35BF6E608BAE1,0x18F632AB3,0xA0DAE0D78BF0C7A,0xA3B6F7073F6285E8,0xD28DF218D83FE230,0x2A324434CB3C871F,0xDFCCCA27A2C69EE7,0xC615B8087F45DC84,0x37F01462934036A1,0x3E38777D4BBF7ABE,0xFE545C5ECF605868,0x167EC865B,0xC7E4E616FC2BA697,0xA956BDA04FAF8951,0x6DD4DE21593B83C7,0x71DCA1B872AD3CB7,0xE544AC9DDD5DB05B,0x728E0C70E62B9E52,0x46B737E74BD4EF44,0xA8108385C01C6C25,0xCB1240AF86E3F514,0x17E05EF0F,0x381534615470A497,0xBD73E08E287A8E19,0xB227424C0E272D0,0x97F69A550D60DF9C,0x477B480280F2E737,0xA07BD8742AFAAF33,0x405E5F29A48FE89C,0xA80D6F41C0CFC5B3,0xA8AA14FF7E02998D,0x23DF77E02,0x8E7927E43F709BB4,0xE4043D1E47C74DDE,0x3DC59C1ABA14F25D,0x832BE9A9C8F8E0B8,0x7529DF0998437FBB,0xEEF302CC3E50AD6F,0xE79E4CC778FF3445,0xFBF1106E7041C71E,0xE74653467A294DEF,0x238D50294,0x20C4593A560E8236,0x3AB055D2E8886334,0x1773C82DD4265E59,0xAA413906E727B221,0xB3CD8183DF469162,0xE562CB5BC990B5ED,0x6130E72E24EF7106,0x5F0DA0CAD7F6DDB,0x2CE4B7E0A1130D7D,0x56EB5995,0x7334C271034165BA,0xF646F9D2EFA601,0x55D4884AE5C3B9C3,0x74FFAB233FB08D53,0xB3778A1EB5E8905A,0x40A60ABA4E0D96A5,0x6078491644B21BDC,0x47277DCEAEA2660F,0x61028CE2944CD62C,0xEDAA969,0x45DDC60D6BDE1BDA,0xD9733926845F3B88,0x8F7494B93855CC93,0x8434D63F9627BA4D,0x5D8DED792882349D,0x7B2A0ACDA0A832F5,0xCCA6B30BC2274E85,0x835E80B080B32F9E,0xF76050D2258BF391,0x1451B545A,0x4651059AAED184FE,0x2D9FFF707C26AFAD,0x4A586A5D9BC45C66,0x18D0FA779633165B,0xCD7EBF1A071BE0D6,0xF8B72C4CC28E17E4,0xA30CCEA53DA831A1,0x8019D31DE9D3FC98,0xBFD6D65BBCE228C0,0x21BF013A3,0xC6C81A10149219B7,0xF3E995A229B77205,0x6B28BD7F602E94EB,0xA7F2DD2B47198D91,0xD1480449F10D4FF,0xB251EE7214F409D9,0xDFBD10FADE771891,0x604387729C478765,0x9CC4CAC457E17581,0x9AA90FEC,0xB3E3FA6871DFEB21,0x151D1B4372090D62,0x227F94584751BC7F,0xB0B43F9BF1B5DC91,0x20F3E696E686241A,0x6666AE12E86D606E,0xB2171C97FAE57825,0xF3BC60C8D009EED1,0x936EAD1582C89639,0xCAC88729,0x4F29FC9DE80D7D34,0x83517BE2E1C9B8B7,0x1E3289FC1DC8917E,0x7172D23958171EFB,0x715D8F3F574D204F,0x8A98EB19114C5DE1,0xE1852F739080F907,0x46F76728189D31CB,0xF8512FC5BBCA4226,0x1F2193AD2,0xCB77589C07FDF562,0x35FE2BD7DD5EA1EC,0xD2F95E779194BEA6,0x9276FE38626D5644,0xB1366339391CD1D9,0x645A7D1C72786222,0xF74E7BAAD4032CC1,0xCEB842E7C7C197B2,0xE4D7AACDC35336BB,0x1C5549EAC,0x35F237CC3BA012E6,0x744128B1150AAD8B,0x2D09B909A587E514,0xC6B593705E2A7605,0x9016F196DEA81347,0xBEC6CD8FB29D899E,0x445DAD66F228CD58,0x6ECF82B5E99E0E4A,0x7C2A42DDEB367D3,0x4FAC54A9,0xE0F4A94EC0C2C1F3,0xEEB440DA8429A264,0x2B616CE698E27B7A,0x26067B106C92A9F2,0xCE2CED1CC7F99EBA,0x9A5DF4713EC0B55C,0x4C13476E3FD5DEDE,0x4365D44592BD7274,0x2BA788F59E28F022,0x8E120F71,0x25E3F3764243294B,0x86E2CB5071A8F5D3,0x82712B4C28CF7CE2,0xB5AA311832FA0BEF,0x7AFB972F189BFBC8,0x139315D438A2B420,0xDDB28B7084B66808,0x18749DB1BBE5CD8,0xFA585027763C8766,0x1C0B718D2,0xAC5E867672085909,0x59FF2C5331313A71,0xF7B47E8ECC19BEF1,0xE3C8845476AD70D5,0xBC64CE8FE1E5818E,0xA5562CD09734C76,0x9A3E327B92F649F8,0x4AF716C17C9F4897,0xAD2040A7E7CC8270,0x11843025E,0x7A4FA666F979630F,0xD2E431B21395DC6C,0x7860B3415EE8841,0xC18F554EEB8EB3D9,0x86B6DCCED42D7A12,0xAB0A9AF6C88ECA6D,0xB036FB6CA77EB4C8,0x8286B6B0E6367F5A,0x6F1C32C8531108AB,0x2745B090D,0xD4D8916931CE0593,0x2790A8F83C942018,0x3BFEBCD021B811FF,0xC6F2B709BE2980E9,0x16142E40F9B26807,0x8A3F1AD280880880,0x714AC49E58954B,0xFA46A782782FF632,0x6E36D79ABD37D517,0xD2FCB6F0,0x721605FA03780833,0xED891A0662CE3C4A,0xA8C1806134FE5C08,0x36C1B6DE77F1F6DA,0xF0810BF9D0CAEE58,0x8839A8B4C050C0D,0xFAB48673A3743B85,0xFA44443D4C7B03F5,0x810D3B7C9516CE9A,0x22A9E5AF0,0xBC0E073718C66411,0x30280C6F57D63F97,0x4098B2E6B155265E,0xD095CB9E1C984A12,0x1C6380878586A556,0xEDCA47194540544C,0x854BBF97CE24406E,0xA366E2F8FBA9752,0x7053D5E17083787B,0x1710E1CA1,0x7EE02AD56FD1CF6D,0x1C0234F5B5E024AC,0x4B632A062ABCB3E,0xD8FE75BB44B2B0BC,0x4F1E1269EF0E2785,0xDF3A5ADDD74C9A4B,0xFECDF2D3DDBA6D29,0x79A41C792D6F7584,0x6F6AAABE2988D39F,0x17C5B3F79,0xCBCB5A92C9ECC589,0x4F6058B17EDC4D1F,0xD54A66407418E3AF,0xAE7CDAE0A6807F50,0xF6BE9A4764DFF04C,0xC92BCAAB9DD82B17,0x94C19A2D2EB6A382,0xA3065E1380981E08,0x8D95B3951017A09C,0xB0024219,0x9E10BBE1509BE0B1,0x85C0CD40F9ADE643,0x6F7E57F05FEAF3D2,0x522DAA04889A0F28,0xA24D083466B12B22,0xAF52C5C71DB4B6CE,0x758B3CD8D9F5466B,0x7B91FD7C4059F32C,0xDFF4C57D213B9420,0x12D46C6E,0x638488511EECF114,0x559BD08E3514DDCA,0xC07FBD7A4B251FC0,0xB127D8CA2D07E564,0x2D716C25DB95F879,0x1318E23ABA64A633,0x6C8C2E161797527B,0x23A685A21EBB7225,0xEA42D988C2DFC2FE,0xC7B1C7F9,0x5B818BDE2070E5B7,0xE1C3B0B8161C561A,0x6C8FF21A25038EAB,0xED235211B5115CCA,0x9AB8A18939FD28F6,0xD9234D1F379AA1DF,0xDDE52807CCB386CD,0x1A8EFF0535FECF76,0x2DE3A10FABCAF1D6,0x15E047AF6,0x99CEBFAD916D8FF8,0x2834365231A8730A,0x1E089D16F54CF30B,0xAFF4BE345BE493C9,0xECA379289B652C0A,0x69F9390F0112448C,0xE5ABE39923BE6D50,0xA95841ED708C7FE9,0xB5F159B28490E0DE,0x109D426A0,0xD3654D53549D00D1,0x4551DE933B2CD706,0x2FCC31F0018B8C26,0x4C2122EA5F465D1B,0x9279D02CFE6CACB4,0x8532253A95756FE7,0x9990031A86F47B3E,0xFD0B326DC32B4B62,0x9525602DA3C18CD8,0x19BB9FFB3,0xB2616CABA52BF01,0x201AE6B5477DFA36,0xF7A99F770C1C8773,0x6CE7D624B90FDE78,0x508637D17335757D,0x50D0072D1C63BBE0,0xF3EC08A62A84977,0x171C7BAB1E517662,0xB2FF64EB3CF20BC2,0x1F2ACA614,0x1F1B9F5DE126E2E6,0x6D218D6C0CFFC91D,0xA98A9232207A6E01,0xC42FCEA462DC93F8,0x242D1A2DA2109AB1,0xA2C264E8298A7AB9,0xE22A589D112DB326,0x7748FCC2CA13CE7B,0x5C209A176274C247,0x243B3FC50,0xE661B794DD6DCCBC,0xFF78E0D9EA47EC7F,0x3C7DD37176F065DC,0x1468726AA7793777,0xC7F0843541B95822,0x1EA9A8E3EBAD11A0,0x7A8E7C57C7B9FF16,0xE5642C6A51E58D82,0x963F8C01B8DB7A82,0x1F1DF152B,0xC10CDAC14BFFD71D,0x57C652915B2DD4AA,0x4F84A53B7BD1138C,0xF66B544060ADA373,0xCCBB6468C6B7A983,0x2CCB4F16AB827F08,0x2F5CC99267FE155D,0x8E282B78B140C849,0x20446096E2621EA7,0x20D77EF40,0x51B17E514A123D96,0xA203684F92511712,0x9B40BA5CD3D4E77B,0xFA58D7674A6A0465,0x7A7A1FCAC272AFA2,0x15E2E5375CF8E27C,0x9582986806931F73,0x2E75BECA7B63DB27,0xD0C1DCAAD3980EBC,0x12842DC2B,0x2FEBB684ABE60A4D,0x743D4DB3008B9499,0x647AE8B5927EC5C1,0x5CCC3F60B14BC37C,0x90077D57CD7F8DB2,0x48E6FE7FCF960CBB,0xDBB922FEC548A991,0x8527706220D3E6D,0x314FB49891108CA5,0x73AD1A33,0xB083E84E45A32B67,0x451B916A35B20000,0x68A57C30A04B9B7A,0x582E50B55EC6ABC2,0x47E2EC1BC1F17E09,0xCCBC31D8AAC0EE12,0x87AB0ED53F9EF12C,0x7F293A53CB630E8D,0x1DD7EC633EBFD557,0xA5B330B8,0x57FE624EEB926845,0xAE49D76B534C88CA,0x6F00261EA82F1FAA,0x6DB3F7934B001290,0xD0807AA10EBB5FA5,0x125E0E4759857B7B,0xB58401601EBD62AB,0xA63206E6DD031060,0x2E97B6BA9153A568,0xFFF24D9B,0xFAE2FD53EAD9B12F,0x29F46643049A9F5A,0x82BD2C480F065406,0x8E0372A0EC2CEE1E,0x70CDB71CC204A7EF,0x2278BD5531BE9BBB,0xB74F6541C8DF27E1,0xCEC39367A3325194,0xABA63DFA4B9CC384,0x16A4EC24C,0x2588507EBBF83162,0x80BE18BB2827AEB4,0x594ED8244FBB4F81,0x727C25F35FA28435,0xE586257CFF8B791F,0x5CE3195968A0A6B3,0x57FFB279EFC778A2,0x6A0191363B88CD99,0x16DE1DE5C82FEE55,0x1E3B7E6DC,0xE25543158BB6DC97,0x9646411CEAD2CB9B,0x29E29DE9D2CA72AB,0x34E25B57EFFB6AB6,0xA98816CDDE09D29,0xF2679833E4A2F05F,0xB8BC6DC44BC7C68B,0x43CC92EDF6933F2B,0xB92B0A0699D66124,0x2D45C53D,0x654162C74C6D90A3,0x47B2F6E163F15D69,0x1F00A76997BD1776,0x399ED8D7650DDB6B,0x1A39AA67A6201ED8,0x4559FBEAE165F467,0x40B1202384011DD2,0x1193BF655DF223CA,0x6D7CC7B95E5AB6DE,0x23CA6CD29,0xE229217979FF653E,0x49651AA62B57223D,0x9E345F71134D95D,0x29D96A8A05001382,0xFF299AB1BCB60460,0x65575D80F7C02977,0x50E9E027C632F132,0xBA80DE252F090CA8,0x20DAEB4D14905D9A,0x2161739ED,0xD123AF3601197432,0x8AA6A601780C9DF2,0xD499F8E7790AA03F,0xD09E2211C502E6CD,0xE9D3DA8FCDDC79A3,0xA8B8F99FB409EFF6,0xD5B39CCCD47BFDA8,0x59DE9EF3D8DD7784,0x4D28CA1441F1723E,0x273AB3D18,0xDAEECB35D2B02CB9,0xB4A0C7B973EABA02,0x3A0DB50D51FFBBD3,0x788EAFA9F5710005,0x311B6E06B990F701,0xC34C4726E113FE90,0xC75FFBFD43587162,0xF859D118CCC5D2CF,0xA486368040749334,0x19EC8DD9F,0x7E8863FB51FB1519,0xD87930B571347BFB,0xEBC76B8C19EA5513,0x14DA5DBF9DFB7053,0x4CFE16EF39B3E8A5,0x63B7F56E0BEF3568,0xD689DF65DFA75AA3,0x26DB13A64BB62058,0xB030A142E6C0867,0x26C0D2EFA,0x2845C8F4C62889E9,0x39AEAB0EBB9ED805,0x3A7B6D3B2FD94475,0x8BE56AF69A310BBC,0x74F357356EC801A4,0x157AAEC8131301ED,0x5BD4A534BE76F0F8,0x5B60641C993BD21F,0x79C96F2B43B1C3C9,0x13BAFB9EC,0x875BD89B8533EA87,0xCBC9FBE2F3AA292E,0x753F9306963951EA,0xFAE4C21866AD03B7,0xA07DB75FAD11801D,0xCB0D6BF066F006B7,0x76A9E567CCAFF1FB,0x50F27E9A61470CBD,0x379EA766E1765AC4,0x185AC3C37,0xE1F1B70C51C588B1,0xEC8F6891AB648669,0xD7584108151B13B7,0xC07681F3C94F803C,0xAEAE8540D749FF6E,0x1CE81AA77AC352D1,0x3F0D07DC1B7BA657,0x7DAE37585C2463F8,0x2F6264E6E0410C78,0xD63C9DD5,0x4B6C2AB19BAE66A3,0x3F6D86B52528B591,0x5D3E482D4023F483,0x48B63EDE78C71897,0x9F7903662C9ECF6,0xE8A0ED425AE62BAE,0xAEC24BE6B5E428EB,0xB84DFF81628B13CA,0x505B7DE529C5208E,0xC5707A7E,0x8314FFAC5C19A52D,0x2DF633E103CD9C7B,0xAA8ECA96D0FA8C64,0xA6FF11DB063E4EE6,0xDE62258F0756524B,0xDC3E39B7BC3DFAB1,0x8563DF2ADAEEB447,0xADD0393F91359F6E,0xADF83109FF776B7B,0x1D2EDB0AF,0x14BDD834043F0E1E,0xE653B6CC803E2FF6,0xC88ADAB19B7A7EF5,0xA3C9E260C07C6D0A,0x50AEA3C2429A02B6,0x4B138E71DB31C96,0x3B29DB3C97FAB886,0x9BB004101AB8F5C8,0x40D96695791F19EE,0xD60022DA,0x7BA710BCC61D5E10,0xA0B5DB53895E7D0C,0x6EB80F1FD65514BC,0xF124F60495037605,0xF345539A4B12B006,0x7DCB7BC2A3D3832,0x1589B55B4B599DC5,0x74DFF4536B3B6BFC,0x2F7D94B79BAA3340,0x64B01176,0xAF3D953FB5AE467D,0xC193F6334B8D0B21,0x7E0182B7576E71EA,0x1A415B94200BB6AF,0xE4C129A1D9D9EAC1,0x5D4A789297E7FAE,0x49700F701539A52,0x9DD1C01E146837EA,0xE5571F41B880BDEB,0x8217BE1D,0x90A23E7A2ECC27EC,0xCB46E821EAFBDFE3,0xA3A418E22A698007,0xA0875E285BAD4BDB,0x5AFA3F20BF33F0DB,0x2BA40BACBAE3EEC8,0x18EBF3AE56A8AAED,0xDCD1C4F919334461,0xC25F34108567E5BE,0x1D20B2AEA,0xAD9F0E64EF776D7,0xB3F902A2FDAF7D3,0xD60376DDDBE06F47,0x70AB5941B9FB1257,0xF4291C29F6172FE9,0x133C88E429C27FE6,0xE20A1BF2DA1FC41F,0x308F065156D13503,0x58C7C5A5AEB60D37,0x128AAC3BC,0x9B7647B69B9E1689,0x6BD7BBA84BF121D3,0xD10C6EB3C737E658,0xDCF99E70C5306E36,0x3F24BBE573BDD55,0xE08C754DA34987BC,0xC1659F9F8D2C5FDA,0xDF9C4AEF59621F69,0x458714220393DE2E,0xE6DAC154,0x92D3E76B81D62760,0x1397970C1E999C,0xE8192648397600B0,0x7E9704BB46A37A6A,0xB94E3F8768F282A5,0xB156DEAF49452E54,0xBFE2923C1E6C5D6B,0xCD2FDE937C79D70A,0xB8149FFCB2B3C4E8,0x2769ABC4E,0x70F068CF823B78F9,0xE48B8AFA97CBF6BB,0x10A092E9CE6C58E2,0xF9264CE67F608A11,0x2869B9141BCF81AC,0xE762F2C68938BE29,0x2134D096E991EBCF,0x1C3B7CD0ABBEDC11,0x21802BA399320D1,0x26BF8E741,0x875A8B59520F133E,0xADBC5F1CB4CBD8A4,0xE3D675EA9DF9EAE7,0x821C176A5040511F,0x82A15F378A8AF12,0x7CAC37D4AA5B8570,0xBE8EE24F1886A1AE,0x7E1E1F7FA7CDFA7A,0x54CA794DD8364794,0x12B7D9EA1,0x207F34CF71366E1C,0xFD8139E1C2A2F407,0x1A9BBC76B3011409,0xCF84CD2EBC75EF08,0xEF88824D231CE15D,0x55B53A43F421C272,0xC4634C3D00171279,0xF0E170D8E1ABC027,0xDB1C0171BB13CCAB,0xEDB159C6,0x1A52F7D9C903C7ED,0x77E5520B8C98604F,0xD91A9F7CA2CCCC67,0xE1EBA52165A7906D,0x6FF9452858A54C7F,0x5D10A2245F21116E,0xBBDAED156BF01286,0x5D81943F4783EDC0,0x1759C3DAB9D066C5,0x7B759732,0xC1CB1672BC0A5F6F,0x4B5E9BD6D5902D19,0x79999418D250C748,0xE559909E7B8A93A6,0x707CB61CEE014889,0x1EEEC3E1EE166C3E,0xD65FF51FD1D6ED4A,0x1CA2F710AAB2D2AA,0x712DA79A58495D1B,0x1BB48650D,0x3B843AEDD08B5766,0x1282917D11A43E6C,0x4C2AE39E6F3BB660,0xD6909E57BF6298CA,0x709DA095B6012003,0x45EBDB99F6F2C102,0x96293E9F3C37B230,0x38A3C3F6DA68E611,0x469C1AA91088EF67,0x1E9CCC49E,0x741DDC7BF9D64B11,0x4A50CBD106B0524D,0xE5EBF673902C8ED1,0x58468651BE4FDF4C,0x29D5B3D92FAE978E,0x68F42C9B1A664F3F,0xC124902FE5DEFCB1,0x6F0A8676C0230FC5,0xCBFB01598543DC7E,0x27B30B10E,0x8E67416E27E933EB,0xCA83FF806A825B77,0xEB2FF4053CD5484D,0x98E3828B81008320,0xF7B0CA2150FA0859,0x78D01EDFB43B8CD3,0x7A532F59CC39B03D,0x7D07C7CF6D2DD20,0x7D711F1EAED41AA9,0xAAA4A769,0xB5899CF6EEDA71C7,0xE0461DF37867E62F,0x61B8D2E4FB04877B,0x387ED3346A9B1FD3,0xC3911133EBA6526,0xCD34E2FC12DE7286,0x7CC93878028E3BCB,0xF36B5C066924E7A9,0x8B8DE667625EFF5D,0x12818919A,0xE5A4874F2BBE9A94,0x3C744ABD4A55C72F,0xE74476ED6C5A9CB9,0xDFF022C04F136220,0xB875F087E86E4685,0x9BA6F9A583B4B101,0xD5C25CD219D7E436,0xECB31C9E17194734,0xE08413EBF8A38CB4,0x16A08F353,0xD07EF7041358C195,0x831C1354030EEFF7,0x564B1B777F0AC292,0x1565D9F83BF666FB,0xB80641C4B1509DBD,0x1C0331352E8AC29F,0x5142B97CE41F19,0x2B958C3870D1CAA1,0x2AED8E5527584D3A,0x326B83A1,0x622580B60101A1FD,0xF44C93102CFC73DC,0xC66683561DE63383,0x54D09120CE18444D,0xD0DBC0D7AA66FFDB,0xA1077030D03D767,0x84E8718416BF7977,0x114573312E51981C,0x45D81AF7C6F5B988,0x14C4ADCFB,0xD12E5DCD177834C2,0xB554849AB3FFAF8D,0xF23FB64B08F38677,0x367F9D618BF74F93,0x9592C82CC4391C3E,0x1B4A411A2E677B86,0x3706EFE559B2265,0x4F6B1203EA76C882,0xD8CC61CC715B3D3C,0x4A6AC977,0xF98D1CAFE7081C68,0x235312DE2A85BBAB,0x49AC772F6DED6AEB,0xCDF1E5044B4C5D19,0xCC614ABC88E45679,0x21A4A0E40B9BDC6E,0x72A1B64307E9F6AA,0xB581825F0876DE0F,0x8950B2033A9E4BE7,0x10604EC77,0xDA6F652D6B01FAFC,0x8483B89EBF538EFE,0x610C5E4F18C9E851,0x658EB3BC6F6830B4,0x4EE9415DD3555C7F,0xA0EBD3262BAB2237,0x2DA09AA7591F7233,0xE6A9E2EC2E468635,0x969A11B7DA1A24FA,0xE9F90606,0xA3A851772A388FA0,0x6FAE2A8CBB7D0325,0xF79B6E24542F3255,0xBAD461121C0D3EBA,0xE38A7497B975C1A,0xC989BD24F3312AF0,0x7ED1563FA441854E,0xD1007111CFF08691,0xB0ADD31585F87B12,0x9E85A6F1,0x8D39DB9806C46CE4,0x530AAC21174714BA,0x555389E9048C83C7,0x8358E1222371EB0F,0x1F2D4C6A9FF6103F,0x1731699673BB7F54,0x93BFAA356560B242,0xB785A9DC368F0641,0xDAF6D75B8A2CC2EE,0x143157482,0x2B52B113AEE285,0xB106292319DD8F13,0x914783964916028A,0x247E424EB1B0221C,0xA22699FAFFF38615,0x7B23889C6A545239,0x579EE0966E8C6066,0xB4571D2B878B84F1,0x65C14361666FB615,0xCF48FBC3,0x35DB929C1A0342EE,0xC609BB8A01078ED8,0x59C8A75C18A2E264,0xF2572962C4B5228B,0xC5E6B4231FED1023,0x80FB2E782B79D71A,0x8E47E3C21A218317,0xD1ED9845D2E0E87B,0x3DCA5DE318BFE927,0x12ABC791B,0x441AF256B46CC035,0xD65DF7288341D33D,0x429E27C72FCEF2DE,0x578FAA344280523,0x99BBD7B7A712E7B5,0xAAFD9D8EA43661D0,0xB23711BAB2E55C6E,0x6762D5C9F67C117E,0x1E1D7DC29A6D0CD8,0x24EAD681A,0x28B82C8DBEBC68A1,0xE3CEF565E34E1CE4,0xEF78C20126A7F8E9,0xF49F4BFF50FA9AB3,0xC7312F560CB001D1,0xD0B0AEF4B9454C87,0xBDE16416FD6CAA7B,0xB8345526E3F697B0,0xC79161A882B6F034,0x22B40593E,0xE5FBA73D9257FF3A,0x62AB80AC3FA21E11,0x6F83B808DD149784,0xA1CD42AC86EB1C35,0x3E5ECA386FA33B1B,0x5B9A37EB0175E7C5,0xF90BA3A7249E0AEB,0x348669D20E56F94D,0x9B63569338EDA5EA,0xC0DAF815,0x43CEA49A7F6E3099,0xABC331DC9B8D0141,0xD4B2CB8CBEE54047,0x47F4BFA4EE6FB095,0x2D121E3BC68667A,0xE2F5DF47763C056D,0xF05277654DE7BB21,0xF91F631B1573D95A,0xD924D81EC8430106,0x6E77FD1D,0x398EAC5A762ED976,0x3C879202341553DE,0x2667CD85D7275AF0,0xD9E172CE05CC4910,0x6EC0CDD4A2285CA4,0x80A09626BBA98FF,0x1E17029E96397637,0x4EC2197DF84C40BC,0xF4F9D44ACF1FD209,0x12B2A3407,0xAF0BC1C6CA579948,0xBD10F0C6749DE05E,0x83EF557F85A46C2A,0x9E034A1F1A29CB1F,0xCFB4EB2823B08DE,0x881AEEF3B4E3B81F,0xE8B6579F60A158B7,0x11FAD23FB3A8D76,0xB51D86A4E5D4FA3F,0x22EDFCFA1,0x3DAA1CAE4BC725C1,0x104BEFD6D64D6094,0xF2FC7CA6923C8888,0xA69F9F0519618C4B,0x8A2D8C701EB6CB5A,0xE2CAC2896718FD3,0x5EBDB22E09B65F7F,0x55F9D9323807E19F,0xDF7AE3C7C887550,0x815AF726,0x7C31348315E9F58D,0x8DDB54DDFAD40BC7,0x93FE2E342F9490A2,0x7645238BD5BD3B1A,0x18235F710B2959FD,0x4E2C17408394041,0x8D1EE9E6046C3BAA,0x45B33534EA340677,0xDF3EF37EED19A2C3,0x279F1A1EA,0x2212A3EA0D8BF977,0x3503E17D16F10AD3,0xEFA6D7163807E2B8,0x80BC544422F479E3,0xD01D779240C62829,0xD1019D52515C48A,0x70E7C77FA8315EF2,0x225EAD3164EE8516,0xD5337F98C7FAED7F,0x272A0F008,0xB486EA51EB14976A,0x42632C76BAE7BF37,0x78A5DBDF41FAE42B,0xF3F9D6CF6C31C64,0xBE865262165D6DA0,0x83FB7DCAA317D3AA,0xE1BBA7047E642569,0xC2E3B854989319DC,0x6A3A4672C76C055A,0x25A5522A2,0x6FABE79CFEEF77E,0xCA5522FFF9EF9F08,0xBAE8592399F36FD4,0x9E678E6D0F10B6B,0x15422A9CD661048C,0x9A5367D9D66BDBCC,0xFF6BA0B0298D03FE,0x2AD82190B7CEE50E,0x5B0320B5B578B18D,0x1A733646D,0xE8A84AB9A443EE95,0x6A0F845E9C65B7AA,0x2BAE4278C63A9323,0x25C3872225DA9438,0x9300B5C2AF58571A,0x1A3C507AECEA3487,0x98E1A661E88B3AA0,0xAA69FD4613BC88CC,0xD1AC3E12D1AF4F3,0x93C78CD6,0xACE9673951489A39,0x69E3DF59623A0EEF,0x6697A2A0769AA6F6,0x90D29393ECCAECD9,0x25C1D69ABEFBDA99,0x5CA4BDCED41BC5E3,0xA69FCBA1FAF49DD8,0x9757A05CB37DCA7C,0x9F150A879F9C13EF,0x5CE82DFC,0x531589BF50D24954,0x19D2DB2441510426,0xD26677F22E7FD15C,0xCA0AD5A5E2166880,0x8567E1063213615A,0x2C34327F356ED7ED,0xA243E19F6471934A,0xA67E590EEAC4C8E7,0x734A0AA334A2A7CD,0x22B34B152,0x598DAA29AFED4D8B,0xCA4C6305029398B8,0x7C7C8A6722CCA82A,0x43DBC242217C5BC5,0x5287F9BF13588A0A,0xB01C88D3CADB296C,0x6A1CA754800A3466,0x1F0D5A88FA4566E0,0xCF86EC9F403793A,0x179A6F054,0xE8EFBD8E1B8E42EB,0xCDF4F18BEA2AC363,0x928B8AFDB5D73648,0xD2BE8F46EBAC6D39,0xB8BFF27415DA67DE,0x8443627A92086900,0x39706D8D91D21CE3,0xFADFB356A14C0A87,0x2F59A1D20C958982,0x4D20A4EE,0x49954469B5AF8D1C,0xD1B07FF14FF0B035,0xED7FB70187A4D04F,0xE7CAEB607639F1A8,0xB480E3CB018001F7,0x33B136B450DFC2F8,0xA2DFB65B2F80679B,0xA0CCE82F56D215FC,0x8A115D33C8911860,0x1A07BE40F,0x2AB1DC5F1733C374,0x5CD4B1CBC8D307C7,0x62AA37255554F9B4,0xE87D2E8FD68557CC,0xF7BE0D07FF987F54,0x2F3A5DD7F07458CD,0x54F21A1A7430DDA3,0x6FD8A428EE534141,0xB2F52A9277CEDBE6,0x58E65DB6,0x2EFEEF0A8AFF1AA9,0x3289497815BB41BD,0x723FD4EC5520D80B,0x83E3AFBC7FA18DC2,0x2CE7818E98C56F73,0x8F776F50F86A8AF9,0xCE8C1011A142E232,0x705F342485DEEC55,0x3FA064296BA26E28,0x174241E15,0xE80CCED26431AE5E,0x46C0DAB7110B4FBE,0xD348E17FDEAB7363,0x899B369D88D1D572,0x92CF75D112092BA2,0x5D69930DCE8C3E12,0x121127C294D367B5,0x2A6931B28CCA4CA2,0xFB5B2A7C9CF906D5,0x1DE0D7A8F,0xC19DF6372CA8DDC5,0xED382528DE5A766B,0x1925B595BBCCC2C7,0x32B59213B80D6BDC,0x1C2908508159409,0xC40364286D4348AC,0x3A269535BC66135E,0xBF2EA9DF8491273C,0xEBD3CAB2C74057A7,0x2376564D2,0xCACB87666F315089,0x18E17987BBF4250D,0x4D557079A79E3D30,0xC3EE7732E0C88EAA,0x5180BDC60EA0BA54,0x214F7266173E1547,0xFEFF2FEC2AEC3CA,0xCBE92D8BD8399CCA,0xF0D2C0624C4CF9D8,0x22034E87D,0xDEACECFBE9EBBFC0,0xF56E6E277EC39979,0x2DFE96ECF08B6659,0x180D290926FB45FD,0xDE4C506FF31C97F4,0x32B2DF5E58D8D623,0x1340845CFC8D717D,0xDC695546E34CAFB5,0xC60BEE6310EA1BC8,0x16C4B4F3A,0x296C8C003E599B6B,0xC8B7B227D6A614FC,0xDF3AE80B0EAAA3BD,0x60ED3874FF0220C5,0xCF8933A986CEA4B7,0xB7B06D11302A0811,0xD9DAF06B32F58810,0xFB06145E73C28722,0xB94906FB17C952BF,0x119B2D71F,0xDC061C518293F10F,0xA14CAB15F79E20CA,0xFCD077DE28E25C0E,0x3A15EB727A9571C3,0x6C37A355F58AF07F,0x734DEABCCDA2C70A,0x4A63FBA38F3411FD,0xE62B305CB30A4298,0xE39FE08C46BD726D,0x22A3FBB52,0xAE2F76CF783F21F0,0x14628614257B6293,0x5F266CD53A763338,0xB8DBE7185CC8AA3A,0x6DC091A77F8C2B76,0x17E097CA17D02561,0xA09D183CE7A4F15F,0x339A551CDCDFE0AB,0xFD9D642B27E7BB3F,0x10843D086,0x7F831B04DC819A01,0x335E54AD888B84D7,0xB0BD75D39D59D03,0x76503E3479B1A62E,0x621450B23483C4A,0xCF4AE93D9473C0AB,0x942DE2F3719FFDD4,0x463215E8AA0C43C7,0x85D6008C2CB76059,0x1FF84BBD6,0xF0BBEF43EA8A1645,0xE502833A40269047,0x9FBAE1A10FF70B5A,0xB34D28323B3DC49D,0x54BC26175BAF34D6,0xD61A90A1C5E58A13,0x195D825CC6510534,0xEAB9D2B25BE4DE4A,0xD32A207EEED6B835,0x19A8B28C9,0x28269AD4BD18A973,0x99A2F5740643F611,0xEB7539219CE5E95B,0xC00C8592F4D5359C,0x5874908EE738FE60,0x3656590B07ABDEBB,0x2DCD1CA99C5FD79C,0x720B85E131F8F3E7,0x9AD8432FB9BA833C,0x1C8C4C7D8,0x141949B1049BDFF5,0x2C4FE2AB3DA05F60,0x6C1EFDF642FAC9F6,0x6127FD059C97A4DD,0xAB82ECC0C88A87A7,0xF3A44B1F344A4A44,0x16E2139041201531,0x5E9F41273742BB9A,0xF21972F3162B87A7,0x2B7654FE,0x422B435BBA57972,0x9F288C3AFEA2765F,0x9CEC174077410485,0x3887062C4CD0F486,0xA86181F7B9FF0514,0x90512088C1B20CD6,0xAB57634D8F7D5B96,0x1B8B9D18ED461F8C,0x3D2A6B925F238A71,0x2A229D9B,0x39742C67650EBD3E,0xE780E7058B5D226D,0x227F8E8CE3CF920F,0xB659145C92C2070C,0x935A6AA4A45D47D0,0x8929F714C109D369,0xB80CDA172DB0B8D6,0xEB23E7B652AB59BE,0x642A6B6853A52B1D,0xE1E3268C,0x3F1C9A2D7AEDFDF7,0x2BB6A8CB9D6205EF,0xFBBDE2F4CDC34E32,0xFB6D0E77F983E447,0x8AE09617F5F8C55E,0x4E9897A59DAC99B,0xEF59BA252A94CD7D,0x31C1358D7B05B973,0xC0C0EB9A6D049603,0x593C6F62,0x8D0533021111899B,0x49D6BB365EE53481,0x786E300751F1681B,0x5CAD36B6E18648FE,0x7F1FC9E1C7611E80,0xBD0F52D719E3CC37,0x43C9EE3D7558D7B1,0x404CF36C236C3083,0xF2C1BC370F3764B6,0xE9E50B3A,0x3E96C9E2B2D9BD1,0xA66CBC60DA6BD904,0x3E20B5BBA594246C,0xD61647E14BF12E58,0xF8D090483584D60F,0xE917103E61501992,0xBEAFC61F4C1E1230,0x83424AA1F5223D9F,0xE8608E3B56268E5A,0x1E4C3221E,0xEB852F64376A0689,0x16F779B1D2DBE388,0xB87D0E329057A7CB,0xCDD4024C3A6AF6B4,0x2FDFE6FB039FC7DA,0x7F7E00F58D77E268,0xECA41FFF2F05DF99,0xDE906CCEB63818CF,0x5E5726FFE77CBAAA,0xE6E37189,0x8368EA2F402E9BB2,0xB6CD87F47CA286D2,0x220DF639083011F2,0x92B4DD2BC57CE716,0xC318F5B704B9E9AB,0xD700DA176489FAFF,0xDDDF83CD46D249C4,0x57617BA2C2C589D1,0x7CB9E89F40B407B8,0x18D85ED4,0xF58145F09BC552A3,0xED08EDE5766C5B60,0xD76087A9364BB90A,0x3229142C73F513FC,0x13032061C73957A0,0xE8BD8D7FB8B99A63,0x6CE76EBC49D17599,0x6FB0734BA4BC43AB,0xF356A0C837F8CB33,0xCD48013A,0x79FBA8239A656E38,0x2E00098D002AFA3F,0xD9410214B08DEB69,0xB21D4DF44053B1BE,0x15B7C1A9AC9FB97C,0x1485B51F3708FCDE,0xA1CD5186D6E77A27,0xFEF971DC0E8664B6,0x48FEA79B20EED90D,0x880E329D,0xDF76DA746C707995,0x68F9532AA9B35343,0xB3A393620FFD813,0x9C85EBAFFEC1D276,0xBB263843B359B6E7,0x49CA13525E968666,0x2F46031DAE592DC4,0xE2BDE0C25D4D88D8,0xCC84BB306534AADF,0x1E54D330,0xEEA85A571318427,0x935F2D295A91666D,0x45AFBA6BDE5678E8,0x6AA8ACEAEF6F8EB8,0xD0E79A9458667899,0xB76D4425DBBB4BF4,0x4910A7099779E193,0x2026544E40F5DE6A,0x53E8B6385FD3CF50,0x1E1BA9701,0x2AAE5B52064C30ED,0x8F174F06A12CFB45,0xD0D24B1FDC8E866C,0xD5EC855203CF1F76,0xAABD59A0D8E0FEAF,0xAD4981CC7D3EE58A,0x1FD1E3012E66EF98,0xD5E2A58005A6974E,0x6E8DEC2DAC6C46AD,0xD010664F,0xF44A5E2C6CE64C7D,0x5B0F6D678F51F8E8,0xD0F1B551F05629F2,0x3EE4FB4E1975BFD2,0xD7F84EA660BAFD10,0xD3B8A0C9C51B5883,0x235B26364BB231FA,0x52BF05752B52A44A,0x9EE02B5B98F416F3,0x891EDBC5,0x9A1A5A083E6C4B6A,0xF4FF9EFA5BCA0872,0x79ADCD84F50D2E24,0x9CD0354B1B797181,0x8A6D0F5B22563533,0xB37F14EEC8919C58,0x8AD52AD2E47991D7,0x445CDB82EEBA59F2,0x2BFDC5BD2A2F78BB,0x49460684,0x9013C1A9FC3A5A18,0x221A4B74536845EB,0x1D62FB51C7FD1B3A,0x874B1CB16CAA993E,0xB88BBE5A9C15A230,0xF5D982873CBF2B76,0x624DFE59916E303,0x1E68CA947C7FAC07,0x62F11CABAC84FE82,0xBA9DCE5A,0x918950DF3B9CCEA4,0x4C740AB818D481D3,0x24DB5C93037D8EED,0x4141E7CF01256F92,0xD501622B8F926FDD,0xE7C78D954285DDC7,0x4C72A41009AEA27F,0x72C219E8E89D2EB2,0xE25F9A9A4F9CEAE9,0x7DEDA2AC,0x15845B98BCF2B197,0x4F73945D190C5774,0x2126D862D81FD903,0x3042A1BA4C8494D7,0xE7516E6F77FDED6B,0xE5BF44BB5AC6466,0xC95FF4C9B11D57C6,0xE0EB58DC7B948CA9,0x422C4B0B856B082E,0x1C0B53776,0x98D2C615ECAD8AA,0x46A10CD7F8F196AC,0xBAEF942DA7187E42,0x388C2373102E908A,0xFEB0F865A973BA17,0x20256A2946EE2FDF,0x845F6FE6111D3A8,0x50528AAC5DB776D,0x489FF2E76C85CA10,0x242350B96,0xD5D2EE11EB46FBC8,0x252CC9D84F256466,0x441BD443D7FC447A,0x2EC23DF5F97928FC,0xFE5881F933F6586C,0xB642566BFECB554C,0x9BE17F163F19881E,0xE01471FD10CB93D4,0xD5D42F1D8D41C391,0x5C1A7669,0x18450D29AF651E85,0xC46E39CC2F04EBFB,0x7D74A9BB52ADCD14,0x8DB79BC5DFDDB384,0x27CBC02566E0A797,0x90457F85669D893B,0xF7E948CFB888E104,0x683CC7C5E0780B5C,0x7E21EF6F096C0BF9,0x2258C6E7A,0x47E59D029628DDC8,0xCA3CB3AC3365F79A,0x4EFBF9D78193E6F0,0xFDA3D488CA46A85B,0xA49D9C190A90AEB9,0x297796BA19B9C613,0xFF281297DDADC4F7,0xEED0A9BF500D3786,0x949F874FFC1F0BF8,0xF4749955,0xCAFD42A08BE7A2AA,0xB540099E8EA7549C,0x8E93A791FFC7BE7D,0xE29441A345C443DC,0xAF502476A82ED70,0xED74AB225B16AE6F,0x62ECD6AF4C4886A2,0xAA37A9AA86C8B806,0x270279183718ABE8,0x119D5DE1D,0xEA8BFC6FC75E265B,0x3C22B64472144594,0xFE9F388354F20C04,0x5CD82A3E21E47A6,0x1BA144C093A818CB,0xC6DB54790BFB58C3,0xFBECAE1E72FBDEF3,0x62A90DC14E407E84,0x286E1CBF555D8FCD,0x1FE9684B1,0x1C35F3C9CC774FDB,0xA05C854AA1E25E93,0x5E30A37BEF10D73D,0x3133CA47678C0DB0,0x5B3A06464D13EC5F,0x450889C261FD46BE,0x6A7F5FD440553D15,0xDF3083295439CFD7,0x1776F8CFA85D01C6,0xE9CD9EFB,0x48A6A36E4B356489,0xE72EE5ECEF03D7A7,0x8A299546CA0DF4DE,0xF23C5C99D410023E,0x3FDAC6617C698C0C,0x55779992F6A0073A,0xB1B350BD87EA4584,0xE39F5D417736A13E,0x1249F87E74B8754C,0x19C9D0086,0x24DB6615F2106B81,0x4E7A1F1A5DF29600,0x2853D53A3AC52380,0x1B1A23EE5DD49FAF,0xFCFA6DCE1F422E83,0x2AAD62D17A5D6F7E,0x3497E876BFFCD46B,0xA83C04A6A7A407EB,0x27C8E05FE4DD603C,0x9A5C3E7B,0xBD332048712B1CB,0xD07CDC9770CF2E51,0x80D7A8B217841020,0xE34017E9ECEF49E9,0xB3980E72F4150529,0xD78633B14C552785,0x47AEB4AFE498FD27,0x205D3581E405F94C,0x2C9A23C7F49B4BEE,0xB8206164,0x8A3DF55E0C216237,0xEBEB33AA2F0756AA,0x2204F186A046EF14,0x44930A5927FF71B0,0x74AFFC9544358E19,0xC5703AFBB4F5B657,0xEB0849BF557BDCF4,0xD4F58DB21E976952,0xB6D879A890F94DF6,0x12DB18FE4,0x4E5DF886BCD0F0AA,0x6C9027E9F13277A2,0xB7640DDD4D6B89B0,0xD431BBC616B13C5D,0x41CAF7C1153B26F7,0x467717773B7C8940,0x1DA6F04DD032C511,0x89A1C1EEC768CD89,0xEB10C557588C5454,0x162A1A037,0x218FDBC71BE0DF7F,0x875B9CD8F7A1BF5C,0x4B5BDA7ABE689D20,0x2704E536EB0F901F,0x78E2436312435438,0x561FE92A94BB2BD4,0xDEA967F6B4AF21E1,0x3A74818427BCED71,0xB0DB9714F210BA92,0xC775B1EC,0x1707C6406B11EDFF,0x2D6DEC3E14225834,0x7529AA6BED1642FD,0xC69A581548B34E4,0x51A2BD7796869677,0xB386E9260F7005E8,0x9BCE24F0E77A283B,0xB3D159098EC1867F,0x9C808B024D7AD458,0x3858DD74,0x38E871220E2F5799,0xA4D75B9245A6F5EF,0xBEC34C4F0EA83E14,0x3E0382FDB67FEE1C,0x3308D2E46523299B,0xE82FC390F2CE00DE,0x2A5D7A6191C61C98,0xAFB6E38D69B6C54E,0xD537F854401782FE,0x4E5BCD53,0x6546BE4150197950,0xCB652AD397667F4D,0x8BE8E0144CDFB079,0x3739EACF00F1E1E6,0x44B6BECF8F911B7F,0x8406B530213DA824,0x5E05CDFD4AD6C0DA,0x7CAD3ADC0E8C1984,0xF6A9AEBD1906AEED,0x24C55EAA,0x39C4898B6CC055C2,0x31FA2AACF34FD1F4,0xF0032B6572712F71,0xE46D74D19A25A9E0,0x914850CFCAF20364,0x4E2041147465438A,0x962A89FE686123CF,0x101B7417641F9B5C,0x13798541C67FA294,0x19B40674C,0xC5BD03E3466B9992,0xB217D3D97F8B144A,0x6707A8BBF60E5A65,0x18486D032D29BB3A,0x8B6454B33573B249,0xE3F78F0D7DC92120,0x41CD9BB09006A1D5,0xBF8664AB0BF88C47,0x5A2A237CD7F1CFB,0x226D91CED,0x5DC9BD87FE8C609A,0x114BCBD935BC5366,0xD4C8C145C87C5916,0xA1CC098EBD588E29,0x3FD5F2D43EB3BCCC,0xED46224B28B78796,0x686EE62DEB032584,0x5FBDD47BC5434D4B,0xA93CD4179747CC0B,0x273A9961B,0x3BBA53CD0F2A61B7,0x8FCEAF063C850B84,0xEDC746C44F844CCA,0xD33900E6CB451EEE,0xE237F71EE1F83AC,0x499727B5ED8A1485,0x8B0936B39660AE91,0x29DC3C4FDBE97D8D,0x2E9F9970FD773FBD,0x363E7992,0x6E0003FBFF09F784,0x204FC092B42B6F2D,0xA66B76E1102DC996,0xCC883CA6E588CB4F,0x11831505A841CEDB,0x6C0249373BEBA189,0x9C89A3E571371D44,0x7756A931D31DCB53,0x3B35EBA0113FB5A9,0x2184007C8,0x8B64D5BEAC9BB2DE,0xE217D6FB0437E103,0xC54F88CA4C60C89,0xBC7AD583852AA555,0x1036D0D7B646CD01,0xFFBF8CB180DE1A7B,0xACA0A1D3A1E0C615,0xE2D8094BE398E44,0x1A996EA61E0EDA08,0x443C570B,0xD7546698FF5F9AF2,0x1848413213ECBE29,0xA88953761F1BEDE1,0xDCF6D0CE96E83A7D,0xC3FA7D35FA018666,0x1BAE6EEB48B3B335,0x4DDC79A3E5274393,0x87D71DCFDB168E85,0x370FC802D39E7D4F,0x146F0F311,0xD02CD5AD51A28D2A,0x5247019A32AAB6D3,0xF16789EED854F4E2,0x8EA68722A8FAED77,0x1560362B1C9E1F66,0xE234A430FB24FB55,0x7C973BB6D2BA9841,0xB3C19A8C7CFD42AB,0xD08BA8828E55EDDC,0x3C51FA88,0xA4E69AE2A8508512,0x5FFE9A9551E37211,0x5B460E4EABA6A773,0x357F93DBF041ED7F,0xFB652350FE40E17D,0x84F865261A359E3D,0x91C741F5E82427E6,0x243AB8A52AF53E4E,0xC1BBF77762EA15C1,0x1470D35E6,0xC025742DE4B070FD,0xA49C2B573AD3414F,0xC8F18DEDAE37EEA9,0x2C1143CDE877643E,0xC8FAF4FF8FA7E8EF,0x142CE1DDDC6206CE,0x53E8EE306003A347,0x1B9C2C3965135C30,0xFEB6EEA72AE25E3E,0x8814C34,0x3455A726DF0CDBD,0xB7BD45977F109A7A,0x2795B498C04B1359,0x2195B037EEBE30B2,0x1D701534A3A1746F,0xBB33DCFCD8304D60,0x44CA00971DE9B07E,0x6531ED06DA05BAB9,0xA16CF2EF09D5F780,0xF1E384F5,0xE610C678FD4175C3,0xC943B72C224F1E7,0xEC44400A05E05B95,0x84C50C824E78DC23,0x7712DB5F030330E0,0xA974893CB9E7C1AD,0x68D3004C66BE9AA5,0x4E8034AE3E5D9F64,0x85DFCC188F2DCCD3,0xC4E4ECC3,0x3E7EF60866053EB4,0x71FEE66EA6B08545,0x549E969C16B7735D,0x221B580E984D35A2,0xEAC1D2B7CE8F67A9,0x8A150F0D6F4AD804,0x234D6FDE3B9B1889,0x15BE2B7EA34F92F8,0xA80B084E1C543BC2,0x174075E8,0xD88443B73B277F09,0x5AE330CD2FE40C1A,0x9CA5D73A24711930,0x81A0A71FE2331272,0xA89B4C9B11D4668E,0x99759B0C89FFE09B,0x2E9AB74742561361,0x203EA5056F356023,0x7641330333FC979A,0x14F713A3A,0x8FC6E8A707C589F6,0x628DD942EB717191,0x7B41B2897AF0805B,0x92770DE7627AE0ED,0xCF95FF516377B55D,0xB1F99F55C014984F,0x8A3F32076B8174CC,0xFE7382B87EE4F34A,0x23AEA4216DA017F2,0x3D4E58F,0x6C6F9F7E4D3AFA8,0xBF5C6D61B73242CB,0x6180ABED170EA841,0xBC331C6F9E9A0270,0x7532EDE6DC5D9503,0xCCE6912D1252030B,0xF16026592E5073B3,0x2FD8972785654FCB,0xB69AEE1903FEF071,0x95F2A557,0xB4D9F8FF35F9973E,0x71E87DF776265E7B,0xD944F219C7920E94,0x9CCA8DCB0FE21987,0x6C2F1BE7CCFFFC9,0xA788E1569A27074B,0x81E190289B52FE1F,0x9EDBE45F922CF833,0x79016CF5A19DB5AD,0x20E93D777,0xEAC14A2750EF798F,0x5053EF39C43AF2EF,0xC0FD303E5EBFE2CC,0xB130C351D22F8F4C,0xAEC4C6135E1A2AB3,0x231BDE26DBD8C35D,0xE973BA00DC0CE5CA,0xA71C799FCAE6615E,0xB915BDAF803A97D7,0x104174D1D,0xD9375F527BB6937B,0x6A5C4AD21AF4F5F,0xF4F2C252A77A6F6B,0xDAA968255668531E,0xE12DBF1F7050BDFF,0xD218E6F89A579028,0x24F6EF65A62468E4,0x7F98DE2C38FC27F5,0xE8F40C34038E3BAA,0x6D6A84D6,0xA39218E22BDCD510,0x765D56D6E10F040F,0x5EB49809EB08728F,0x5295823908B7BE79,0xCDE257363116A3E7,0xFAD17A1890577EC6,0x8C68C3238261999C,0x5C2DCDB340FAC527,0x4D7041C54056FF34,0x16F61E7BC,0x2BD380DB118C1DA3,0x44972B578EB438C2,0xE50E9015DA0306F4,0x6C35387A4A731D55,0x6C438AD2E77D5AD0,0x8AA5B8E941BE35CD,0x79363E5DC9A8EA72,0x99692226A6D0416D,0xE19733E29AB42B05,0x7BAFDEA4,0x8D18B2D6C3DA1B8D,0xBE5450171C30507,0x460165EA3B2DD13,0x24827903EC677572,0x6DD0FE8190E593D0,0x7BF3C2E51FE3AE61,0xBD52C732C4C8E8E8,0x185002C72943161B,0x2497D3ED5AC9005D,0x190FE2F4A,0x24FDD5C01A186199,0xC4C409809A2CD8A3,0xCB7A1D0B0833216F,0x61EDF022159E6FF1,0xB192D0B261C49B0B,0x4FCE56B0FC2815FC,0x633EE7238D47B167,0xA06224312A2F0C5E,0x9D32448777599892,0x1925F4F15,0x397123A507E052F5,0xF345BAB6725A7BDB,0xA328BF2521C12596,0xCF8C136972C0646F,0xB5BBC97B353C6B8F,0xBECBDF4CBF1C1BD5,0x46D1AFF525C1BC29,0x934BDBF96F20625B,0x4A2821E6B21FDB75,0x24D9125A4,0xF4B0C9B10D39AFBF,0xB0FB42BF4E6C7392,0x69A6FAB2D9D002,0x735199D786AE7689,0x86CCA3489CEEC16D,0xCEC28697B457450D,0x1799D138B98BB2E6,0xA9022321AFCAB53C,0x4543D73F6AEA06FB,0x4582DDC1,0x3BF37F4F7322ECA8,0xCE1F5D5233989E1F,0xF3221B5D87E64536,0x812048A5D45FF22E,0x58AEF1B0908ECD29,0x56E989B4A853FEEA,0x4B6C07FEEAEFB0DB,0xD0E17E86043D5D39,0x7E480DB6C7B9EFBD,0x26FBBB096,0xD9EAC69879BE3C87,0xCD9A4A30098AEC31,0xC600CA29DEAAA1CC,0x17B699BC25DD3877,0x2969E2AE676882B5,0x4E721FD4E1DC9195,0x5726CCDCE37BDB8B,0x8AE044347B8A1,0xF1B67E5706A7BBF5,0x27A277923,0x326566B762405F71,0xA371AAC29A57AFCD,0xA7CD463B09B9E34C,0x8CC3DE43D788FFB0,0xAC0D24E9950B4939,0x6D39E2A6A9E66ACC,0xED83725F9502003A,0xBCBE9A63667386D8,0x7D0342B340BFED64,0x7143C2ED,0xE11BEC67CD57680F,0xB2289ADF13ECD485,0xFF2263FBE69BE5A1,0x6A082D0413B7378D,0xF3371199A276EDD9,0x4C9E92E9C0AB40A1,0x3816BC8799E27C02,0xCDFD8654A21FAD1D,0xB8381DE2DF11A2EC,0x24FCCAED2,0xEB406BD5717DD60B,0x1BF9694BFDE5B900,0x778B0C3DC34D4A2F,0x4D34D5D2D698B7BE,0x9D6EECF82B418B68,0xA1F5E3D029207C74,0xCFFDD995BD4167F9,0xCB64981553792F3B,0x971A6424EE7B6AB0,0x27B95AFED,0xA9D2DDB45F4A7C83,0x7A553194D3A73220,0x9186BF4895EDB222,0xBA324987777C056A,0xE086BE930C9818F2,0x1C02F5ADA6C801BD,0x2A74B2D724D2C9B7,0x5563F67FDD997E8F,0x92A3BE70307DB5DA,0x26F9CA481,0xB5A87B43C75C8B0C,0x5B7FB3954C89ECA1,0xACDC5AC22667504,0xD683075433EF273,0xB057714D0610CE73,0xA7A08B6821C0463F,0xA6E09344E12BD3FC,0x61E1D00209E3BB3B,0xA63F723B2C847869,0x1E48DA71,0x1500D2A2D3EA73F1,0xEA9454E6827370C0,0x86BF4D682B3AFE8D,0x5C77776391C15FEE,0x99F7300F5DA097E4,0x59941DB015D83CC1,0xC77D95A84B15D56C,0x51F14EE7497A9992,0xB1113F9CD4728FAF,0x277B33E58,0xCC349E6C9BB3DB26,0xBC9A5B45E3EFCB87,0x38B1258771F20C21,0x47B6EED9EF443DA2,0xE16366550F7763B3,0x2B38B1AB884EBD32,0x77F3E875E71CFA7,0xFB7DA5FA6F5F06C3,0x3B334ACBE93A2D0F,0xFC653E3F,0x7A634FF7EC04BA8D,0xC16340DF9EE2CFD4,0x43723B31BA70C0B1,0xF6BF191A1E9DFF52,0xE8C1031E8C3CB42D,0x7EE6D4856F94382C,0x750F55201D58721,0xC4E7C127E0B88839,0x97B8DFF6ADFBE39A,0x8AFFF85B,0x60B4CB866ABB7900,0x4259F739A7782EBB,0xE4199E1AE95FB2C0,0x5B13620B8B4C3DE6,0x1509B00F7881104E,0xB79C7BFF879A994C,0x981036C7ABB4B906,0xB11FA5473F3CB970,0x8401C3911AD6AB95,0x16143258F,0xEB3193F162EA78B1,0x34DBE6F3171708A6,0xB36ACDF64258099E,0x3C959C0F28D6194F,0x112463A28965C19C,0x8D8AA68FA725EF97,0x8E175347E0764AF7,0x200FFF6A36C34E88,0xBC17F79FB1BDB256,0x7F70A126,0xB529A1B7C46D75C1,0xEC34F5287493C9D,0x5F954DBA020AC194,0xF73C5322D802B489,0x5E940F8AAE8E58EE,0xBB0F037574C96738,0xE1C975E5B81EA3A2,0x9F71D43350B71BF5,0x4A6284605E85E82A,0x7EAF453C,0x39B661062AF94811,0xFF1B3EA160FC5A3D,0x6FF51351E447640,0xDC17D9B130163F,0xBC47DBBD111C7447,0xFA020E8560C1AB54,0xFC7A55EEC4768218,0x50186CE513FC155F,0x53BF7B0BECF2A2FE,0x1C4D5163,0x401EEA6751739F1D,0x97E4FDEF58CB7674,0x6BCE56190946F4F4,0x1684FDBE4FEFB504,0x110538E667EDD3B3,0x1373319F24D9DBBE,0xAFF03C157215B1D7,0xB95A599959CA22DC,0xAF0138194E351D28,0x1DBB1AB9B,0xDC929587B602F8F7,0x457C3EE89E86843D,0x3136613F3746A48B,0xD5AEF1ABE5DDF1E6,0x6C39C3CD688B16EF,0x9F018918C5FAA6CD,0x261BD251ADC72B8C,0xDCFC7E244C7D4DAB,0x88BD8B91A2538A3E,0xCEB5C134,0xE7DE7BD135F980D,0x4E9CBEA8E52CDC8F,0x108820698499C2C4,0xB99D797CDD6211BE,0xBDCA24DFF47D813E,0xB37C17D341C30EF1,0xF913EA353274613A,0x7C106AD24590063,0x7DBBC10AF6C24313,0x119AF5F5F,0x54D0AD7E8B71DCBC,0xA147D0DA6AF66456,0xEB2F6D6BEA686BD4,0x3F70547C1A28B712,0x627215C788C9DCC8,0x13641F4B6CA7059D,0x9DC7295315B00B0F,0x9AE21A6CE0226FD9,0x3CF68C50E4782B88,0xB1800777,0x131FC89ECE63ED61,0x2CA2ACB04A83D5D7,0x9A5A1E8B39A34851,0x1B02157BDE4794F4,0x97EF97C421214D90,0x75C0BD044DCB28D5,0x94F308CD0608FC78,0x7FF3B9C6E0938FB9,0x535A3351629E7CA8,0x1775C7981,0x5E7F80E37331197C,0xAED69AFE372BEA17,0xC845AA905F115E7E,0xBF5988FA21306189,0x71A69271F1CBA1F3,0xFF0CCBE29369867B,0x4EE2175DD445A8B2,0xC29C62708915AC75,0x33BD8C9BF31BE90A,0x233E3E889,0xEE69CD6B3479BD7C,0x7ECFFC6AD480ACB,0x99433C77F75A4DBD,0x2581DC6886D04FC7,0x6AE36B15F8AB3A23,0x4305B5DF5C2A30EC,0x88DF365AFCB3731D,0xC5140488BD3BE390,0x1708D17E5A76D6C9,0xE17CADF3,0x48F6674B385C278D,0xC8116A8EE37C1685,0xA33C6F3ACAE77746,0x632F119E09B4353C,0x8E5DD57CDE6D9F76,0x47938B2090172A1F,0xB4FEB88593A46458,0x3B67D297B7E43A14,0xCBA6833FFD05C5C7,0x234A94ECE,0x47DD3411E3F5A84F,0xE0FC2F8EA1A1FD9D,0x6CF25A4740DC9242,0xD4764C8619B1C2AD,0x4CC94E5EFA8AEBD7,0xBD50A71AA417C5E7,0xF6B331F354C1DF8B,0xC3D8C697B76A0CCB,0xF71BCA63B260FB12,0xA9BE9CBA,0xCC49727FED6208AB,0x27A85C6D65AF3ACD,0x75BDF2168A7A7EFF,0x388EFC65175CE6D8,0xB972C0F23200C7B8,0x7B1DA698855779FA,0x8C8A2DA196F4583B,0x7C9DD9BD799E9A06,0xBAF89C1F35C2793A,0x16E78B5BA,0xF924E7234E639820,0xBA4E796028878D03,0xA51E03E0FC0BE26D,0x48B7D67B49C43492,0xB5E9F9F7516ECF8A,0xFA99BABAF4BEA1C4,0x112E8960A0A39170,0xE34F2216143D88C3,0x3977245CFAFB0D9,0x262FFED70,0x895B3CF4A1397F11,0xA931AB0663D559AF,0x4558EB363206149B,0x40E192BC63E9AC9,0xB6556F5CADD73866,0x1C1C2B376A369D2C,0xE8B7BE750944FCEE,0x6DA8029A6BABE38,0xAF3ED4829D8AB3A9,0x1B2182BD6,0x13BF20BF5CFBCE81,0x81CD610EB34DC9B0,0x915B8AA0E9F54495,0x1B263214B63457D9,0x5170CDE698868DEA,0x2AE24AA0743142A5,0x52F0B18D1092A305,0xE6F426612ACDB770,0x3C57353F028F6C2C,0xF6BA9484,0x278CAD2F12F1FA0D,0xF092EF958F3461B4,0xEA14EA96B96EA600,0x14A3D85030342B25,0x26779F2D819105D9,0x759560CDE198E48E,0xD63F22388E08D58F,0x9A5DFED0717D5536,0x86C11361E7F08729,0x1E3B8941E,0x6816E8D359179596,0xC0BF1F0D86A1D449,0xD1620DD347B5A9FF,0xFC2C27FDE4BEF69B,0x2AA3FD7CE3604573,0x46FBDEA970628402,0x66130C2C709A0370,0x614112E18249A4A0,0xA989A520ADB045CD,0x1C14E816F,0xD81DD6CCCE5D5C3C,0x127525DBF752284D,0x3AF166D6713D268D,0xF57A3DA5981FA20F,0x4E388A21670DFA62,0xA0FD69A7F470A5E6,0xCD34226747230AED,0xC32A1AAF783AB0FF,0xE3C867BE9B2383AB,0x86AC62C2,0x9B15498BAEB4144F,0x4435D01ED735F2E2,0x3C0D4578B9383697,0xBB25559F8BBEC5E2,0x638421386FD65FC1,0x15ED37A8D999DD42,0x9BE16C60A20CA891,0xE681A569DFFC5F7A,0x45D5C84265E7BEC9,0x1BC12DC79,0xF55ED144CBC4E145,0xCAF91FD0016A028C,0x4A04D6E6CD02FADA,0x8B0730469B8FAA0,0x69D59D5AA17C54EF,0x82ABC31F4F6A0271,0xC700F0F5EDBA93BB,0x1BA6C646D79173CA,0x8B4378CC0478BA86,0x2205136CC,0x989A178898FE7485,0x813431ACF4D012A0,0x2B311602BD93FF91,0x3F578DB6F2A47AA6,0x1E6DFF063A32FDF8,0x7C134709851F779F,0xE03A8F15E8BB0BCE,0xA34C5F01127D4543,0xA82358DF3C01E0CA,0x15500A12C,0x1F1AAEE430CA3889,0x6704B794B25E1ED4,0xB1A0A47A6799C920,0x180706E2813794CE,0x11B6CF81DBDF4E3C,0x69FBE51886616664,0x31AF8C947D3D612A,0xBCB756078C1B3452,0xDA4AFD61B0BB5206,0x8CA68C78,0x5284399174991878,0x661A7CAE6FCA558D,0xF12B170636D22B53,0x3D1DE820C580EAA5,0xC7E65E3F6E68903B,0xF714C6BA8DB0D888,0x4ABBB90F020E110A,0x5987855E2080BB96,0x87027484C1E4F060,0x1DD3FA361,0x4049A3D91F02727F,0x8F9A53BEEAEB3544,0x30AA412A4B87DAE1,0xADB080388A417155,0x7EE6978E029C1067,0xFB1994BE0152FC47,0x3E930DA6AAB7F03F,0x768B7314F4210F2B,0xD56F7252BE0A90EA,0x1A8105B84,0x69329731ABB7669E,0xEF87FD4556FADE2F,0xA5C658A0622C91DE,0x5936519F5EF1919,0x8E004D8CBB68ECB3,0xC09F5FFE928B3D8B,0x54BA1B3CA6678A38,0xB1FF4F82346B1A92,0xE90D9EA8ECBD498D,0xEEAC8559,0xE6BB408D9AD8B37E,0x29C282E9A1CBD0AF,0x231BD3E083C427C5,0xF6E0B8A02121FFEC,0x392521FCE55EE69,0x1EB346C542DF8794,0xB826EF905C37CDD7,0x1C9B823A92A25A78,0x2DF1A15642B23614,0x2A551C2D,0x24D1BE73CFA72E5C,0x90B57C988A6954E7,0xEB66904A4AAF068C,0x4F9AFF6EF1BF9F47,0x1BBA906CF48C3DFE,0x5A4BDDE122493859,0xB0ABC4668A7F2091,0x7C80930B7F73A270,0x9F5C76DEAA989966,0x1F6E9E5BD,0xFCCB75B0202EF271,0xC975DA82972D53CB,0x7F18DAA6703FAA42,0x805A4A387A1B3BE0,0x70A5F8A43ED0B1B6,0x5A97ADC63A941FEB,0x3D4B8727C8DC4196,0x4C536F6DA19CF4F4,0x2FF8196040BD5009,0x21332A8CE,0x79B651D08A3D6355,0xDCA573DC4AE0C500,0xD45D5F749D7BF7AC,0x374925965006A697,0x7BADE1A7FE855920,0x5574FA70B13E05B1,0x2E086407B2C8F7A4,0x10909EA2A121FF9F,0x250BC26290E0D175,0x513A579B,0xAC6F1ADF812E8E19,0xAF14C09E1F543CC3,0x2931AD81EFCBA176,0x5122976F7057AC8A,0x476078E0F5B01CED,0xE280BAC5682496B4,0xAA6FDBAA9736CB0E,0x3BC2ECB39F587492,0xFE06D7CC88E7432C,0x7CFBE6B2,0x8F039C1984FE6DAB,0x4F919C8403FEAB92,0x3D54960C44027F62,0x9C20171A3B73AC24,0x7BD8C4123DBC0F59,0xE22D2D6302D3D2D4,0xB6737796A4F1482C,0x625D659C2B13C1D2,0xDC0004DB72453D0F,0x19D22CC97,0xEEF3F4DDBA11FB25,0x271DE62061D09879,0xA7CD6BBB14F931D6,0xF9F6384CF0E978FC,0x3E82456A9A031317,0x65769AFD36A3D912,0xBCC5225E903D3DB6,0x2786B7BAD1D3271C,0xA76AB17F8C142765,0xD40CA3AA,0x99E5E61B9F47E69E,0xF677686133514E9A,0x83A68DC9BA712CB,0xFFF8F5290F0755A4,0x65529BC033BB49DC,0x317C5C80B29588A9,0xBEFE13FAFB41E59F,0xB9342EACD4C60C19,0xF6B96B911EF24BFC,0x7D3EE75B,0xDFE9984A57F882A4,0x2DF66507EA8174F,0xA5AF7932E6F5C222,0xAF23632DC9ABD5BD,0x243B9B75E8CA1F15,0x63F12EE32F9924BD,0xC6584F4CE9AC8D4C,0x3E5E4312BBA4D19F,0x6EEC431D47A2A9C5,0x24BE5519,0x6C73635B6057CA5,0xD1B0E9C7E7974019,0xD20043E89FB156E0,0x8F19CD1486C4F723,0x5A680439A9B7D081,0x2F64D24EA6D85699,0x3F7BAF80E70C7610,0x2FB5500F1C1D57CB,0x7753041689D987DF,0x16D3DB305,0xA635091DE857424E,0x9B777B662913C7A4,0x1D92555C5206EB01,0x7AF52D4F4B3A4A84,0x5B3F84BB58FF18D4,0x2CD35D86496EAC57,0xA3CF8379248E4A81,0x9ED2B0DDE184114A,0x92701C322758303A,0x159D133AC,0x8C3A8BAA45B45467,0xBC43364304373C04,0x6BE24018B2011E07,0x68EECF80A224AB84,0x72D48606965D9E00,0xFB2A94BB3ADB07F0,0xC391DCE467CE80F8,0x7EBC48B79E0710F1,0x73087DE2F44324F,0x1E2559C41,0xDD99B290E32CEEA8,0xA84E915BB3A1A57E,0xAB1956AA792432B7,0x45353602894BFA1D,0xF478B3DEDD596E56,0x59ECF64D89901030,0xB3837D67EA0F4CDE,0xEF535803E2E1CA80,0xDBD99487930564C8,0x1A052B65,0xC7AB5CAAAC732CCC,0xF99424830826E025,0x71B2EE5A09A01491,0xDC352C0CAAF94CEC,0xA4B70D311CB7F8B1,0x90CD16032F6A704A,0x957ABD023377FDC2,0xC13D72886977277B,0xAA774A7C56648E5E,0x695F4F9F,0x9DB673251FC4C894,0x48C96B9E1C8CAF8E,0x9D1D347178D94E9E,0xEE8157741CBA93CA,0x1DDF30DDA7DCB74F,0x833E812CC4870E11,0x71BAB3FD809FD6E3,0xB1ACB8E71EACF559,0xBC61A92129D4E083,0xC4B2DFD5,0x2B943A11337A6817,0x95BF6FAE546B376C,0xD1B5561355D7AA5E,0x75C497C2A7C2946,0xCE764EA9288B88D3,0x8D100A6269358464,0x773D60E824828425,0xA2EEAA9F4CA31A6F,0x6A49BB732EAD0B9F,0x630D2FD9,0x6A5CB597C20D2114,0xCAA03C7022E1DF5,0x65AE3E15E5C73DA8,0xD7D791ECE92ED411,0x2309A994689D4239,0xF7434D70C3DF6E7B,0x50DC9BF0AD65462F,0x5EF4EB55D8BE45A,0xDCADBBE7878297E6,0x1DE8E499F,0xB84F6E4A75519735,0x423C1AE77BA2BB75,0x8973B163ECC3031E,0xAD49190A4DF0DF63,0xC57356DC5701C09E,0xAB3F53FD1260D244,0x80C5E208E3D790A6,0x3A1FEF7DB33AF5A0,0x54A3F01567B905BD,0x14F37A3BE,0x1A46F9454AF48A70,0x755FDF54B718A6E3,0x8E446E79128D5C06,0x74E1783806239D82,0xBF2E6E51FC16B86E,0xF831BF132DB05371,0x804B4F26C5E2E9AE,0xC73ADAA3AAB72C8C,0x975512899C9B11E5,0x12238AAA8,0x75575E1BB717AE7C,0x9666D483E63A232E,0xC4129E21184C8DF1,0xA1B52A81CBD7CA61,0x209C1385E56DB1E6,0xDBE2297DF79E081D,0x50E29CE1C70050A6,0xE50DEE1CB47C464E,0x7E6D07D00A31C92C,0xE546DFDE,0x62CB00DAB44BDF0C,0x2A0DF2F6A68E0D4D,0x482852A78B4D998B,0x65AF4BBBCB1942C8,0x78236FEAAF74F661,0x8830FFF466FF71D7,0xF770C0892B3B5AAC,0xFD50A9588C431B4D,0x546059F526EC0CC7,0x1AAA648AD,0x9D5F8596E83CBE3D,0x165BB9A89BFBA3F9,0x5F3A83F9031A84EB,0x509A2C6655AEEDD7,0xBD29D578A81767EC,0x95BB66843C07667A,0xB5EF131C965F62FF,0xE171929A611B7095,0xF6719E926E84282B,0x82193A9F,0xBE0E45CB5B5F572B,0x37E1BAFED2EA6FF7,0xB65870CC15ECE116,0x11619007F9103B37,0x1179796437CC0951,0xF89379EF247E1A16,0x12D748810BB92BF2,0xDEF015AFDFCC8CB,0x267B03DAA3AD95CB,0x22228493C,0x1ACF9392643BFC72,0x32091FF508B14B95,0xFFF56DC691F7B7E,0xF0AC1E8657FBD238,0x4F59EA48C25CF34A,0xC4D074FD31C95A58,0x4C7D4226A0FB0683,0x634BD4E354A1B527,0x575A90CBD568A036,0x24CE41E89,0x7B8DBB40F4E2267E,0xD5C0E5D4907D909F,0xFA458D29F578B2B0,0xC1F2FC3BC9C3FB4,0xFD86C5F052548DB2,0xEAA35291A2E8EF86,0x82D35942697DAFB9,0x1C7A8FA8812165F6,0xA17D0B1D73E3CB7F,0x1842E5050,0xA1C224228B789174,0x2A1E690D958D7E11,0xD6DCD1103AE8A42A,0xA989C94DBEF186EB,0x3567EC2DA4F05FCD,0xD8037BBBE9095EDE,0x37454E716515A5A,0x76C32A655F5C0988,0x6F386151C960492F,0x257804AA7,0x58A0D6263EEA1DA4,0xAC1AD97B45BF5E47,0xC00546CB2F823363,0xDE749D2E67378054,0x3471ED99E21F6D38,0xFC99DE95F44164FE,0x9EFA3A78749D90E1,0x26AD008DB1155AA4,0xEF31AD663CE933FC,0xD08DBA41,0xA48FEAEF72098E88,0xFCE28B8C016622F,0xD371DEF336CF59B7,0xBF7170E91E827755,0x780F8CD2550CF83E,0x11CF467C476A9A65,0xC5398251F25F0DA4,0xC199CD452520DE4C,0xD51F67F363714A33,0x177C90A40,0x3BC04637976AC34D,0x36988618A4176D7F,0x9E653DC5401593E3,0x478042C71B9D8FD5,0xC132EEC8EE405380,0x54D4A58F15466A01,0xC5591F9E14845E68,0xF33EC82B350D6F0D,0x7D57E09185E9ED0C,0x4860E0B8,0x8AAF65AD3056AA5A,0x9DD72BEE857E4DD6,0x53F21D66A5AE5FBD,0x693D70055EC093FE,0xFEFAFAC6B04A2C96,0xEBB14BF063774910,0xA73DB548660BC211,0x47DAB197F409821,0xED30D194FE01297A,0x1191D7713,0xF9A83270870C4355,0xA6FE88466C58D50C,0x214CCF3A7569B1FC,0x372E0DEC702A9757,0x39B2ECEDB040067,0xA0043D3DB5BFB245,0x337C9651214BF7C,0x7CC7DE26B08772B0,0x3E5D66487F01DB9,0xF6D7EC4E,0x11F4F1A5A5CB0BC3,0xAFDBBD574B5473D0,0x784A672C78019D36,0x1BE8ABF5EBE85262,0xBF83FBB3DE88BC48,0xD13718B9C6F5C5DB,0x264E751778F61D42,0xF81FBC7CDA27479C,0x327A99754BE63D6,0x1E124A1CC,0x840F30E8868FC7F3,0x3BFDEF79BBB1B278,0x300CC45FD1138E71,0x84E5AD947C7C0861,0x3FA0C5AECCFCA24E,0xBDDF60C0129CCF5D,0xEA090BEDA82F4776,0xC0B0192596D20E2D,0x8860080FA5C7C88E,0x2119C7320,0x36E9F31C0DD5B258,0xB4E7581AE87FFC2E,0x361B7681C1D4610E,0xEAEB86997851C99B,0x5939201BFF4735F5,0xF4858F9824189D36,0x683BC523CFD507AE,0x56012ABE4BDEFDEA,0xDAAAE1B45F0DD399,0x15643F1B8,0x5E4B9DB34EA4B7C2,0xE543E4135ABBD779,0x7958770150B62C7A,0x64F3F0D1450088B6,0xE3C930F7325AFF7E,0x994494BF1939C9D6,0xFC5020CA75906DDC,0xE6F6A51495021260,0xB6D0B50C7124FD2E,0x9851F9C4,0x144092E2C4BCBFAF,0xFB1A5F5E09880034,0x5CE43A218AD1170E,0x2C26405355CEBBC2,0xEB917F5F25A569F6,0x711B6F6B46BB8F87,0x30FBFF3DCB562C72,0x25E86339AF12B6E2,0x2C749BDF38B29446,0x1F1B1D232,0x85BFBAE407619D38,0x9CA17EEBD8E45156,0x73C2656923755C9B,0x6F9F343F2570B9AA,0x76B728E502B9AE39,0x65D54DCB38EF046D,0xEDB0DE9CF7EDB31D,0xCD9AEF787CB9711A,0xAF51D95820DE7C6D,0x136BC9A3F,0xE40FFB816D786DD4,0x9B8B4E21A3FB449B,0x54FBFF1CFA27BE63,0x7012582E3785F660,0x54A096FC2839465D,0x2A74F871F44DE49,0xB86695088818E3F3,0x3F42729D475F9A39,0x331195E9F5930294,0x69307CCA,0x7BE629021348F8EE,0xE12035D653651459,0x7B65326C03C088B7,0x360A36013E2AA12D,0x538D0B62CB2A539F,0xB627CDB2C72A651,0x70BA544054B64D0A,0x55910CF450FB95D2,0x44C62B09A0555281,0x1EE367080,0xB56508B1712EFE42,0xFB28C06FD5FFF264,0xCF523735F00E7891,0xF7146BC96F3A6A94,0x5A04B4967C10DFC1,0x3EA109DF6890C871,0x5AF23CB8D517868A,0x9441CCA146D9A22E,0xE6480DC0B0B1174,0x89E87765,0xA82632BF1BE3121D,0xA7B48C573AB2941,0x2F88095FDD613E60,0x9466EA062440F75D,0x7102EFB0F7354C29,0x612408D5309189E3,0xA7E7A1BF7EC0AF41,0x7D83BE0D54407D23,0x37FD868F519DCE20,0x15016AC9E,0x65947F50E1FD274B,0xA2B95D0BCC8A8233,0x486B4144E10DF044,0x5250C6791DCF6F43,0xF962B02F9A14EF86,0x91E4805FEACC0A8B,0x7BD6F990D5F92C9D,0xF2A749747650DE7F,0x8CFB6456575C49C8,0x1ADEF43F6,0x8EB9FD3CAD9BC432,0x98B948D827BDDD5E,0x3DC3B997CB86DB7B,0xB33B6505BB33A60E,0x27928C0B64B41420,0xBFD681E0A7F096C9,0x777671880CE9BC4F,0xA3C640C55C69B3F5,0xBE7F38CE4D3EEE19,0x14B7C7E2B,0x22F089E0941DEFCB,0x4FA3EBC821DEFAD8,0x1E3B1AA9DA201E25,0x7D2478CEC2FAAAC5,0xA257B277356787C9,0xCC505FEA75AF2744,0x17C718EE6CF41E7B,0x3A8FAABCD0876B14,0x597ABDFC3566470A,0x62DB963C,0xE444988FD1DCF77A,0x71B272CD60CBB1C3,0x6594D7B6603B1411,0x46E63897D31A6B4E,0xAA8403D4B7E6F4B5,0x82DDA1CFDA78EA6C,0x35BDED05453BFC4B,0x12481F2F4F94759,0x724AA2BF0A106EDF,0x23FFD7700,0x519A049ED8AA2B57,0x6C0809CFD86936C,0xC6D42FF1C468900E,0x9F9B1B57C932EA79,0x34FBFA8E343248DA,0x50DF85636DBF930B,0xC43703963F4C8798,0xC869C82F48022F06,0xAAB053795AEFBDEF,0x6DD4FF40,0x426B5A03732A16F5,0xFA2EBDDB665F56FF,0x2C724EA1FAF99B88,0xFD9CBDF427E0A381,0xE2FF26FBF5466561,0x3D3EF114055A1EBA,0xC902A04A2AE0B451,0x1160CB553FF08335,0x4159FE6ED823AAF8,0x218940D29,0x6B4D957678A75327,0x1EBD937CA5C925B4,0xD30750F7BE2BF24,0xA685A517F04601DE,0xC910798052698F3C,0x8DFD68CE00CB99F8,0xF5D1C602EAC57949,0x90862F035E5E7BE0,0xBE02C002B8167523,0x6889FCD4,0x4D8C127A41FA6514,0x74E39AFE20D3EC71,0x2CAFEBB972EBC818,0xA8611814DFA17F34,0xFE9437D0D03F9E03,0xBC3A1CC3877772ED,0xE6E85B3BFC11CBEB,0xC73953561BEDDBA1,0x7EBF3D3C47A5C32F,0x6692D48E,0xC539946D4DD63E44,0x57DEFB3E2FD1E89B,0x49CC21E624879536,0xCB3828EA75E7099F,0x8C7C9A1454EBDD3,0x8F7FF551154F1B34,0x4C80A9364C4D3ED5,0x44799ADB6F345395,0xE7C874C3F38E2574,0xD5A3C027,0xAB3BFBDC4BC94320,0x8ED1286826F779AA,0x6C8CFE5E1CA307ED,0x46A41CEE6F971D2B,0x76A594F3206F7143,0x64345996489E7C6,0xE8B54961F6783804,0x3116B093A5955D44,0x74A418B5F2AECD67,0x8ACDC75E,0x5FE0512502629AB3,0x146CEA6DF082B3EF,0x8C9A1EDA5ED34F62,0x2BECC02BAAFAAE7,0x14CD3EA627A3FB85,0x8874C403A191CCF3,0xE31D856CD91B77D,0x57435CC1C48DDB2D,0x19DEF7FDCB009DD3,0x24E73690C,0x174055789FAD875B,0x5A82BE8DDE3950A7,0xA411C49485F65ADF,0x64B09478C9FDDBBF,0x8CCB13A53BFB9573,0xCD7F235C0FDEA7CF,0x9E2F5E24A04753B1,0xFF2E58BDF8FD4CB4,0x213571F99BB00E9F,0xDBA58BB1,0xC82F32CF8814FB28,0x1BE8E9DC4949B4CB,0xEF41C81C03632580,0xAA0B3695C6436E91,0x442FB36CC59BB94C,0x6E207FCC84AF0D0F,0x91FA6E2203134F99,0x3C800A39735FAFD2,0xF7533EF8A7EB6178,0x6089E9CC,0x749AABA0165789B6,0xED7EC8AE057EFBC1,0xB3032607F28C6AB8,0xA52F57E1B4CDD3A7,0x5C3E74F65C1798ED,0x43F252877B5573C9,0xF58F24676BA01E84,0x106D8C9BBC9F935D,0xDB89315103480C4B,0x10A01C172,0x95A36D60F4687FB4,0x2794B93AAC2AAE2,0x4A82DE1C2D61370B,0xFBA9113BD22EE25B,0x1C530F8E2A0E747B,0x823EB96E42F72D8D,0x33F2606A9F0C9C51,0xFCC0EDD3EFA9E03A,0x85BB1EE8C3089717,0x260BB5CD4,0x2A8EF33C53E98D35,0x5D8C995BD7F792F9,0x3D39F1B8694735E8,0x5272F9E4ACE155CF,0xD15EF6F5628D162E,0xAA4C9903414617EB,0xF5A393EAE613AE3D,0x5EC2A4AE0740A336,0xDBF1E8989D2C1A71,0x25C0A25EE,0x2BF8966A1578FAD2,0x1CFC17FF8EAB2A3D,0xEB704205480D6B6,0x19F6C9ED1A7231,0x4EAF59710BC66540,0x791F24CC673CC87F,0xC312FF43A224BF87,0xB85E9BA1ECD3CDFD,0x802973ECBF0DEF0E,0x130E03C1B,0xC242706CDEE8A9D1,0x801F4944218A38BA,0xB57C660852E68988,0xFDFA0EE095CFE9AB,0xC29C981CE88F4767,0x49F616656BB65B0F,0xFC25C4692629C260,0x67068A22E232524A,0xA026A0A745FEE16,0x27194E2A6,0xFA875FD7B582E040,0x166B0139F2642D9E,0x204502E2E942780A,0x3D014927535D872A,0x3507F2FC2681DF11,0xC1955B1239CCE4A3,0xC5168FDD6CC060D6,0xC2C7065BB22F29E8,0x15EB93E9E3CE5339,0x1227B3B1D,0x2406699BCB9F1B52,0x862951898739C39,0x5271C5CF5A831159,0xF6F7F3073648D95D,0x8AD6DD55F9EAE437,0xDFBD78BDF5888DB1,0x1FEC0E41C43E504B,0x766B3CCD9BA6FAAC,0x2837021FB1A633BA,0xBA4901C8,0xF95A580EC6F84D73,0x20461485A7A7F8C0,0xEAF110EEF8360E,0x5D79A4C6737F565,0x89D7474A10E9D606,0xF7E0BF7B74F8325C,0x24185FC090F2A213,0xC27B9EFB3DEB8F4B,0x7D1B370C41AD67D5,0x44BEE9C9,0x2BA0EB56B81E239A,0x52E08CCAA3325EE6,0x24FC36DE10643B1F,0x2437BD647211B562,0x954FFB9BA45C713B,0xAA79E779044DDCE6,0xFBA915F14CE68810,0x68C3D45C0C17FE20,0xAACFCF111791E1E,0x202C2175B,0xF8964B96AC9A2C6F,0xDB748ECCB1ED1BF,0x7F200C5D054B8EDF,0x2200DE560DECD538,0xE500BAF70186413A,0x5E52799FF8E741B,0xAD4D837057B852D5,0x636890316B6280B7,0x63EE2DD0C19894AD,0x17D153D71,0x11E9A1ECF7CF4553,0x412F0969228E9DA3,0xC1BC1003B09FE389,0xFD187F0D2EB66C20,0xEF511F27477FE771,0xB496D4EABE47409B,0x7FBE29F0121CBD95,0x11421C02552E827,0xFF3DD81E97E27401,0x1C50EFF06,0x52390F53C24DFD07,0xC3CE1094A9DE4183,0xF619446F153E3295,0x343A360FD101E18C,0xEEAB95FBFDD4A412,0x9B44A631A06D78D4,0xA7FA8B5837D59851,0xA69A28AAD49875BF,0xF235981C8FD152E8,0x20A113993,0xFCE32E3A228D61EC,0xEC76D755365AFA2F,0x4271FA745E4D4171,0xAB6D1FB4115493A7,0xB7D781438122AFC9,0x24F2CB45AEF9FB94,0xE55715A1494074C2,0x69DAACCB016D11DB,0x797527428C30AA35,0x1BE151510,0xFA3144E681C5F27B,0x3D03F6561A4D7E01,0x36FBD5DEF3CD5F13,0x42C89F936598C4F2,0x6CFB10A81825C822,0x115501ABEC5EF29A,0xA140CD792E74888,0x2561644ED18DC9D2,0x1502548666A0F71E,0xC284B583,0x65E0DCE1E3976C66,0x4FFC64A70C1C20A5,0x380F691C0034D002,0x19D271687D6816B0,0xFB565C035CEE0063,0xE33F53DC215E0969,0x2157D4DF1F9457,0xB853E316C91B50B4,0x5226D3A118E91E2C,0x4B9E824C,0x5100D6FB6BE6CB6,0x13D2A456074275F4,0x74BE734B8FBB08D1,0x4781CFBE4C5F589E,0x6582D0AEEC2F089E,0x338F9A704B824986,0x90FA531DB7B24E02,0xD9F50B5DCEB0633A,0xD0804DD547DB9DDD,0x1FCCDEE31,0x292E477C8BC40668,0x38BC75AE29339730,0x94655EFA8D57AC9D,0xED08AEB09867F086,0xE23285CC4DF336E3,0xE096457692F4EC24,0x8EFE356C6369308B,0xE0CB7DD4CD9E5D48,0xB98393313B2F871A,0x5F9D76D,0x404536189CC41A06,0x6CAFA1ED2FFEDB4A,0x32ADE543AD14A30,0xDCC2020366D5A65E,0xF4D282C4B73A0A7F,0x1E05F121B3D9B044,0xBD52556236C33B16,0xAEA223E6A96719A7,0x633F7B59CF128875,0xD8B17E74,0x758C17AD26A80B4C,0xBBBEC7C6C78CCB52,0x64F0977092020D44,0xD76DF7F30A1655CA,0x2052EAFD16FE0023,0xD7BCBF94BB977994,0x919215618F877C9A,0xFBA968881CD2C752,0xD95791082E8F2700,0x1C8BF1328,0x55636D76EE00D059,0xC75A0AE71EEE970,0xDB348C6CE690A848,0xF1BDE0558397A593,0xD4B83C0A866E0D6A,0xE224E2E7D7C91782,0xB7BDD54744E81982,0x6E8344D8726BBE91,0x821A60B97F685F4C,0x6DFF638D,0xD950FDCCD81E68B4,0xCE25C33424D5F8E8,0x37B2E748F2DA79A6,0xB659BDADB19284FD,0x3C41B6BE80DCEC08,0xA908AFE36DED941A,0xC3472BC97BBAD9A1,0x853CD069F2F05A79,0xEA65395CDB33C5D2,0x16306B76,0xEA00BE7C978DA807,0x281CBD6BB0FB4BC3,0x6D55A0D8FD1500EC,0xB58387D42708BD0F,0xABFBC9B988893F4D,0x804761F0F571182B,0x14B1B0D2EE3515F8,0x20258699A5E79C86,0xAEAF219AFA0EA83F,0xEB129F55,0x3E2915BDD59A2697,0xC213D6B425F9629B,0x791729B0879E24C9,0x935AD378E506A6DB,0xFD70F904F738D4E6,0xCEF4C110C92814D8,0xDC522E856195EA27,0x6DE74F12BFC98829,0x8EDCABF084141F96,0xD7E55E8D,0x3031021B0E7C0B03,0xE89128AF0A7A47D2,0x8FF59DB9E7AC5FB9,0x75432E5AA8C1388B,0x90674593552AFB8C,0xDC17A3EF951C0915,0xFFBE9240D18DC160,0x613375F23D657949,0xEEF87FE9BA5186A,0x587C052B,0xF31B67D16E34BB6C,0x4C85BEC0C57AFD95,0x15D8386D78725D09,0xB53E3F8ABD7849B5,0x29ED3E883FB2AB10,0x5D9947A067B30974,0xC2CE81F090749F35,0x20CED00A7592F5F6,0x69F1088EC3036FC3,0x25749BA4,0x8AE584B5AF5A389B,0xCA4C9093326EFC13,0x8147A588CBAAFF37,0xD6A64919A467543F,0xD2D5AD873A78AFD4,0xC5B1E223BB3624E8,0x98D6C7792EFECD62,0xB946904692AB6E8F,0x3F9D73DD7B514C2B,0x10D4439C1,0x6D08EF8E105D6B0B,0xCDDC14F7787A14A1,0xEC5ACA252B3CD5F9,0xC3110DA3C184CAB9,0x5AC74CF113FB344A,0xC5E1E3CA98870CBF,0x76B826FDB621B4B6,0xF0AD1A6D1D4221D2,0x9888D2B14CB8582F,0x27657615B,0x978FE6A9D87BE6FC,0x891D36C0C293B599,0x14DE9792DF8AA15D,0x33EB95D4DDC3E8E8,0x944B4BD68B99CBF8,0xEE3807AB7EAF4E,0x73A3FCA7448E8C61,0xDD3A45737D3BAE82,0xC4030A3FED00DA3A,0x22573686A,0x9A602610D47255AC,0x3A177D7B3195127,0x7032D8FF9F417975,0x24B1E35766A5219B,0x6D2A8B47D639FC68,0x75D235BDC57F0AA,0x6AC1C40053D0A965,0x5DB1A6D24BB699B3,0xF8FAC8B513214A44,0xF9F2B06B,0x27E8C68C4A328A69,0x7077F88E6688EB7D,0xCE198564D0A8A442,0xF70EA547DD6E5AC8,0xDB4FAAD11BB99A,0xD701EB3BF0AEE5D3,0x91A0F18AB06131B,0x34B099FCF3CC091D,0xF371962900F2A302,0xC9B031ED,0x918C155FE92D8E86,0x84ABA9B60E69898D,0xF0FE685070FC9ED8,0xCC512B247B739898,0x6431583BDDE5CAB9,0x6126DFDF9F50C192,0x66F3CAEB92808381,0x4AF757817DDB754B,0xCA9775D981A26281,0x150DD0CCF,0xD8EE602E0A894BA3,0x78CAAA7AB5202D60,0xACE70051DF15D10F,0x27A644DE1D1C4583,0xD29399FBC4A35A36,0x5D01B759139A4304,0xACD5AF744D550372,0xD39BA1644A73E0F4,0x54B5AA43562B4453,0x1A940C83C,0xE027230CCABE8649,0xAFD971667ECDF435,0x210C707393A0549E,0x9A309C4D247570B1,0x850B85D536EA61FB,0xFF02EA6CAA71D4AC,0x5FC7B54CC979DD06,0x6C96DF2CEF20359A,0x7AFFF8FD04460755,0x7DE80DF2,0xE1242FE0F189F815,0x7719C873CFF63F23,0x94877D72622DB332,0xF13B2043A6338141,0x9EFED6CEAD68ABE0,0x5C1B23EBE2B060B1,0x843461F58114E3D6,0x1B0F31F2FF6B668C,0xED9B07637FC39026,0x96C33003,0x3B718A8B37CD514B,0x8DF786F63D4D6610,0xC11DF472EC8816AC,0xA716018CCBBA0DA7,0xC4141DB950A1F0D,0x2760E4639AC74DD4,0x6035D57F18EDC433,0xD2D9C42773ADAAA9,0xCF8877415865260,0x10B40A2FE,0xF0FB276FD70913B7,0xA6D53CD310817896,0x5F3040C29737C22F,0xE2D15B5C9531CC99,0xA1477CE02449C8A0,0x5784D1EAC2759628,0x822EF6EAFC162A0D,0xC2970BB042760CC3,0x8A7A21911FD6D008,0xA2DAD2EC,0x4D5BA89A0B1EC06A,0x6B3F811D50249B36,0xBD9F0D8956F3E6E,0x93A9C2B340B61F78,0xB240EB625DEC768C,0x97DA52F8B25F318D,0x84EC74CEDF1AFBCB,0x9C9EC671660E9F74,0x14F8C4FB532FD0D,0x1C0DB30B0,0x356EC24AB1AD2DEC,0x5400D86B984D32D2,0xA2711E4FA0B950E6,0xAE0D04EF0191007E,0xA56AB44C42068B55,0x9DD47FD370BCB6E9,0x4C5F1FF9A79A0E79,0x8A08134AD6D38FAC,0x7E1E2A0E5CF49799,0x36A6838B,0x4EBF42C01B54AE5F,0x13A526427AB32070,0x5576006FC674FFC0,0x5B23FCD252A282F1,0x9D76777B52DFFE49,0xEFF60CD70C9E3D6A,0xE907C70616471074,0x703B7290741F7AF7,0xB31D1E1CDBDFF8CF,0x5495D313,0xADA11748FD6CBA17,0x13F7257CCB987D05,0xD54F479420370AFC,0xD174CB5FBB5FDD50,0xF4017DEB5156275,0xD914B165CFE40D8B,0xFCA2FCBEFEC9E1E6,0xBBB666F1855C3F7D,0xAE536BBF7D204ED7,0x195ADA4F,0xEF49B129E8EA953F,0x627AB04145D9F5B5,0x7254C19689AFDB2F,0x2CC0A1C87A290260,0xE9F4DDB4DAECBCB,0x625D3D3852596363,0xF18B1C83A33C11E9,0x80D449DDE6AF428B,0xCAFBC2623A897ABA,0x1171F7078,0x7B0EF620F9C406F7,0x25F16DBFE2FD5CD7,0x3966C5051BA0CC4D,0xE57ED73139AFCA,0xB8EA2AE2DDAFA4ED,0x326C1CA56A530CD5,0x5D4166186CFD19C,0xC4B160A6B300548D,0x7BCDEA4E1D254917,0xE74A2610,0xFD235C51BEA72F8,0xEE89104D6BE814E1,0x88AC52533C8935ED,0x8F8A040F53B77B5,0x472A44EF8023804D,0xBE002157E42E2118,0x6818B1C9953448DF,0xD6285B60D736DE12,0xDE33EBD07387CF0D,0xB717BF77,0x8D47446437D9818F,0x28AD8680E797627,0xD2EE5811D18AA37A,0xB0E52D6E492A5F41,0xE6A2F14EB96B4102,0xAB249A23FEFE6F70,0x5461A5FED73270EA,0x84883B171E6FBCB5,0x7AED7C46404F3088,0x236979FF7,0xED3F7975A6FB21F1,0xB05BB1F6369A0B49,0x939203AE6F3C8577,0x261A98F9FB95D4AA,0x7D0FA198C523DF0A,0x79D794E235687772,0x7629AC90964E24A,0x143E6B24AD485C8A,0xF72732AE1F5AAAA8,0x196B4F480,0xD8668C56A735CCE7,0xB778235ED9EDCCF5,0x4B94C6F32523AC35,0x100B9CE04B5CF64B,0xEB7AC18506C8CE5D,0x15D3D1AD618BE3D7,0xD9A26AFBD200DFB2,0x74CE5A4786CB2377,0xCB34FCD9D92C4BB5,0xBC8C74E1,0x83A02BE7221491BF,0x20442331E8CB5167,0x44B64047475D1DEF,0xAFFD7C7DCFDC01C2,0x7444A77DC305EB4A,0xCFFE74740959D2DD,0x27898A9F5C28FFCF,0x56C1037999A7C4AB,0xBBC88DDC610346C0,0x1722813C3,0x550148555007A6AC,0x3A02DB33697D72FA,0xF583F41B3760D924,0x81C4C04A573E41C,0x69B18B5F92374EE6,0xAB7A01758A92109D,0xC40C5C065A95F9A8,0x64C199306BA11343,0x745AB75BBEBCE152,0x18E66588D,0x3D21D8DD472EAD52,0x25C3A65D15BBB197,0x49BCC9E0C4C3B610,0xB4A36FD79B377F39,0xAF0E6B4355B94BC3,0xEFA6F23A8570216A,0xB5802E7B34841C0D,0xC025AAD8CCA4A43B,0xB2ECF52FCF5D1DBA,0x163CEB12E,0x2AA80ACBAEB9F5AF,0xB93DC2DDAA402A9D,0xE33E9381F212CBB3,0x6D4D48EAE2338AD3,0x2E8C9573622BE858,0xF56D79A46C9C9E30,0xEBA5EE3BD3FC08BF,0xE585D99646AF6A3,0xB0D718DD5C380A3A,0x1ED4390C2,0xB92BBF63F1FD85CF,0x9DC1420AFE490539,0x3D9AA9037B1A5F91,0x9E43C77174480EC5,0xDC38E94417BB2D54,0xAC0026FEF7E76B54,0xB953D12AA489CC8A,0x4B185EF73ED87CF4,0xDEA64289C1008B73,0x117D08DD0,0x1EECACA4C12F74F5,0x1063509B6B63CB7A,0xA608151041D23BB,0x4513597ACD9E106D,0x42A29C62358AC3AF,0x2CDD946804E6643,0xF71F2AEAC8510D5A,0x173A58D091C2FA0F,0x56D19F6A8273FECD,0x66962572,0x512D555FC5575CF1,0x3C5EAD90462D5FA4,0x321AC69E7127C986,0x13AA3C9E2C721A5B,0xE22D8AA5D15B4048,0x208BD8B12486212E,0xD655C07AEBEF2961,0xB24B30CAD39D0650,0xCA32A046FEC6B310,0x1399839DA,0x1D86F8C925E316E1,0xBD12D0C2255A3373,0xE7A9001D08DA0B3C,0xC40C7C1D1DF12AFB,0xA2AF1B4227FFBD6C,0xA7222CECC91B877,0x7023737E082FDF19,0x53B86A64B8C02F33,0xF24C81C7C1CFA313,0x254FE3B82,0xCF98E1DCCDBE9ECF,0xDA9E4DD6AB4E7A27,0x65EF78E889BE3C18,0x8F2909CB9A3A5864,0x5C31AB3E018DB20,0x5CF1692BA932F571,0x402D8D7E419B5EA5,0x790BE7D0B3343BEB,0xCC21596879D96346,0x26F0F1DCA,0xD880F8525FD04B1,0xCB05B5AC2634703B,0xC7CF69C881EBC59E,0xBB68E89B9DF1A9BC,0x31E54B5A2CC1FBBB,0xC7D1F0B941F66989,0xD2F4BF5D14FA6C47,0x4EFE65223A3AA9DA,0x212C850A10D822D1,0x104F5AE9,0x8E8E9E7C7A6DB8C8,0x17E35E797A052E8B,0xF81D3E70C6324652,0x3AE6F354069ECC50,0x6D3FB18C194B08C,0x27AB0FD1A84FAFC3,0xF671D839D8B92E21,0xC6D5B28C698E2B09,0xC7F06BAB408B5DF7,0xA851E4A,0x69A807E3F1D4BB1A,0xB1D5607B146D44C8,0xBDD909CBACE38F72,0xF02CB1BF4D5DF128,0x78004B34F7B69D02,0x2564D2589A33081E,0xDA041A986DE15850,0x822A7B905C2782F6,0xB82ED41513FCD176,0x2138FA986,0xC9BDAE28FA19E1AB,0xBF4746F30E2280BE,0xC4471F7C1CC09A46,0x90B6725E006669EA,0x7B8737C8DC73E93D,0x9EE0F92E105180B3,0x243CCC55A17E10CD,0x124812053557BF90,0xD39663345F35E16B,0x10D35400A,0x2E6C5AF78E6103BB,0xA2C4CCB1674F13CF,0x1F94A2DDB8CF5977,0x4F629F9EA0E6B595,0x1463D9EEDC10EA83,0xA64307BCD39C9B87,0x4C99129D67937534,0xA77FDD173EA01C31,0xB6376B115E4B198E,0x1EB92EB61,0xEF361E332292DCEB,0xFB0D41F6DC03A0E2,0xC0DCD774F5C981E4,0xFED4254D3D6DF6C5,0x2E7F7DD1CE92DF57,0xBD3AE68F9891C25,0x270659A9CBC2AD88,0xAEEF8603E1897D41,0xF00E4EEF9BFD43FA,0x7D480064,0xB69EB8149CCA659C,0x708D6847E115170C,0xC2F8B2373FA1DB86,0x628237009FCD704E,0x81EC7FEA4391E571,0xB86844D799875D31,0x675A96E93BEC11B7,0x457489CCA127B47F,0xF084799CAE2C5049,0x26B78392E,0x9BD9A9E3E86D35AF,0x40DAC3AE78D10198,0x94E604868E98E6F0,0xBBE2FE7B65FC9E1F,0xA5D9ABF6815A2ED5,0xF04AD6B49966B0CE,0x76EC56FC5B02EAD5,0x5D8EFEB4C2DF392E,0x9CA377841B5373AD,0x1711563EF,0xAD4BF801139E54D6,0xE03E8C0AA1267B1C,0xB26BECD915257C3D,0x1C47669ACE8C9BBF,0x3476938D07506067,0x480008BEA664077D,0xDD4FBE1D681B9790,0x43123A2D06FE4B57,0x913B878959DD9E58,0x1BD2AC44A,0x868928F4C1B97E90,0xA6089E77BB55F11,0x66B0A75C723A757,0xE2A1EB3904C5D6EA,0x7510CA29AD77232,0x5788ACF46C22A9A7,0xB4EB88AB14E084C2,0xBFCF777CAD787683,0x362D07441F8AE64,0x236E430B,0xE1491B868A2F535B,0x677BBFA8BF471F36,0x5518CE554DF605BA,0xDF9CCA82382CB48F,0xB291F60575CEC7B7,0xA6494789CA9CF549,0x4953CDD1F633E590,0xCD9D6E5644C49BB1,0xD036E1B68E4C3E6,0x1F44F9E16,0x4F6BCF962D121219,0x942E7021E773AD5E,0xBF596FD583B8E028,0x932316321B781A8E,0x7637F427CB31FAD4,0x7DCBB751D8F6074A,0xBE3DA3BE996D4274,0x906F96021A2A8A7D,0x51842E10A7425DA0,0x169574D0B,0x6A282837E75A3BCC,0x80423B25652880B2,0xBD63F6E4F06B9EB8,0xB8350C683BF6AB1D,0xD6222E0B5F079CE0,0x2C81FD46590F0DB8,0x4DE535B8395AD98C,0x51E5975F9AF5EFF0,0xAEFA9CB38F36CDDA,0xCDC4FAA3,0x2D630A8686CB0410,0x3C6E233F2A870333,0x8F25E3C5E5BC26DF,0xC041F6AAA17CB784,0x80EB53228DC490AF,0xF1BCDE543ED18688,0xA31C50908203E9D2,0xD74D5CB2487573CB,0xB7179E14D6C34154,0x1AEA5718A,0x8332F571E44ECE24,0xB5C597FF6E54EB87,0x1C2E0729FF143D76,0x966D2064CE8DF38A,0xC865EB66CE03CA0,0x48A6E090BBA53F33,0xDF5027338DAFB84C,0x34CE95BEBFD30C7,0x5FB1D45E11B1AAEB,0x9B2CFD6E,0x885C12D4653A55,0x9E36FDC5244DC517,0xC610A629A7B65DBB,0x48D57B510B327902,0x7D8CE0BF80B94A2B,0x98D2CEA252FAD2FE,0xAD57753CDF4A3C26,0x9E89606AA8FFFCEB,0x2A09BC12D0BFBB18,0x1B9D9DDBA,0xECF95074BAD0836F,0x679ECCEBA6763162,0x4154D5DF4339F9FB,0x464CE6234A7F3A45,0xE45FCF70E3FC363F,0xA4C8295576B4239,0xFDC44574E1A48504,0x7EB5E31A9314E883,0xBC7FFE67C8338AF9,0xCD630C8D,0x783176302AA2A61A,0x77AC48C5EF262D4B,0x495CB3FAB257265D,0xDEFB35E7782D9ADB,0x523B26C6C37C6816,0x4301027E16673248,0x4B3F7328ECA3F818,0xC700BB7B72A2669A,0xCB8CCD1F4F38F874,0x51B72939,0xDB287222EDEE8AB0,0x2B92AD11CC650731,0x147DA785B0FEFCF3,0x5FFF45DADA0EB169,0xE6F7366214642E33,0xDE27B7C63674BC52,0x50B5968FEE6F894B,0x62B1C3FE61C864FD,0xEFBCF60C80B32BC6,0x18AF629E4,0x47BE9204768F45AE,0x58CBAC52F613617,0xBA4EFAEC35B1236F,0xE709284080DC3D8E,0x7154D1BCD7BD1F4F,0x63767BD46EB2A499,0xA8DBA241D7D57B86,0x973AB178B1637422,0x8B27218F78037ED9,0x12F3FB8F8,0x1C2006A3AB4B46A,0x901A2ED29B764EED,0x50AC53C1352DA9F3,0x8EED95A9C45A10A1,0x7011D885408887EA,0xEBCE5BF407324674,0x8D1255A227F62303,0xFB73A49A695B6E5D,0x2036E8836DE23A94,0x993414BA,0x66BE32F3D28EEDDF,0xDDDBA2570115179D,0x151FD18FC3094034,0x21573AC26AEF8693,0x3E44AAEA2F58E411,0xC1208EA1503BE1AE,0xF13165D908CD2ABE,0xCE8943DC7C7ACE42,0x9566F92EADA226D,0x1F501B134,0x8FC78A7BFE7E7D2D,0xCDAA781401744A34,0x7C2B850E5A545A89,0xE5AC6B66127353C5,0x99108BB5D111B696,0x89A7676B80F40832,0x9618152696E9F245,0xD77AD19F6868F1A6,0x97120933DA5C0225,0x129701DAF,0x884472F09B4D72D7,0x9CA43EDAA44C5D9B,0x3AABED20717CE330,0xB3D9A803CD1A0283,0x789E6DDC2ACD46BD,0x31E8F65132BA7A14,0x57B363E4715E4DBC,0x3A133AF2DC4374DD,0x7FCC119290782789,0x247681763,0x236E6868B155CF72,0x63EE1A96E49C6C7B,0xBB576D15C777FAC0,0xCA32E9F31E421143,0x162F23ED7AC24DB9,0x783679977A49BA8F,0x5CD317917C77AE21,0xB4AF58CE2A8AC0E2,0x5006C01A9FD02177,0x1F7835754,0xF772A4BDDDCE525F,0xEA0E00094A8ACC36,0xA950E6586D0A1526,0x90889950C4C7C35D,0x4E3323197C9EBDC0,0x69D4750862A17EE2,0x22B66BBF5D0C9937,0xCAA4F4D20863E35E,0xD19A634E0F8A9DB2,0xD55889E5,0xB8241103226D64,0xE335425E3A906FF,0xE8D9C2B410EBC1A5,0x7A36BFA2E6EA7513,0x58530E50409BDBC1,0x62238E3513DA2682,0xED8697A55AA6FDEA,0x6FBCA6E5B1D36E0E,0x47B1327F79FDDCDA,0x1DA3FF4CA,0xA83214FB722F7B3B,0xC91ABA99BB0FB230,0xE9F4BE267834E76,0x4DB66770AC774030,0xE279F011DB02B443,0x2D7B03EC4C1E5C2C,0x67A35C2F0016AB3B,0x59DA3A81E1D81EEB,0x1B60708E222ACD73,0x15C2B3EF5,0x8216593F72DD974D,0xD2695BAFB224DEFD,0x86F09CE019E80CF,0x5997293A2FFE2A32,0xA82CD4188612A003,0xAC848B978050611F,0xBCE270E384B85707,0x43ECDCCED75AEEF8,0x627341B7DCACCCA9,0x15E3A4380,0x4259F1A64CC8F418,0xDD7A6614E94B9D8F,0x8283C43ED4A1353B,0xFE4D35D02AF8732E,0x4625317CE4EC9D8C,0x5B12D40E33076351,0x37577EC3F466FD86,0x879C5B3290039C8D,0x5A6043BDBADDB99D,0x2568001BD,0x6AB8FB3FDB1E855F,0x7AA71169C6A2B83E,0xCD5B27C5E6025912,0x7C01FF5A0E0C1CA0,0xC22C201F6482FFED,0x6E79314A142A06F2,0x16A405CF129A4856,0x2463CF586ADA5D54,0xFAFABCDF528A957E,0x1B8892467,0xC1DA3690E9CE77D6,0x723C57B496336E4D,0xE9A1235A8A7F88E8,0x18A93F0CCA760A67,0x8826E973957DA40F,0xECBA6605DDA5D9DD,0x3E6F4FDE078DDA4D,0x2CF1AD4BB050DEE0,0x7B9425532C21611D,0x12D253044,0xDD7A377A0BC03FB9,0x1083256FF950F5AB,0x30244CA9E56BC3EB,0x13BA2861E42D413F,0x7A2D110DFC5977A4,0x1B70F6FEE3213428,0x3150903ADA3CD8C6,0x1FEC7F9375D1F9C0,0x170D5C9B0D0CFEBE,0xDE7C066B,0x502F2BDDEB5EDBBE,0x31A11D7A6F4FD8E4,0x37E9FEE69C4BB059,0x5579D31092683FA,0x700A128449891B3E,0x6CD2BF1CD27ADE64,0x1E59798ACC194B18,0xB09E321D7218A8B2,0xFF67F970379DC5CE,0x27044C288,0xB7AB9FE89971430,0x443AED30657D6040,0xB833163B0F1802B8,0x72F3EC4EC863DF54,0x8919F59C5914A9D,0x8815962FC52CD526,0x85509A0F79779BAD,0xB11B0AEC3409549E,0x51E29CBD27784F28,0x3C7754FD,0x241D7386F95B5C61,0x1406C54AE069086,0x6A9B09D4B6B1A7,0x683BA404D52F60C9,0xC510400E607B3304,0xB3349736C78639FB,0x7C4B05D6682808D6,0xF4427D9DA73D2D9F,0x967DD0C2BDEC84CD,0xD5A447C0,0x4FE6F363BF45493F,0x3113441DDBAD2D69,0xC250D6020203EB27,0xC80AB01FB7B1421F,0x3F9BE6C88EECE7BE,0xB199B5416F7809FB,0xD635BFFA70AF0C65,0x49D88402EB5E1829,0x2D17B13DF09BA648,0x4577B6CB,0x3B6C9CB1D3CD0235,0x8211E615771AF82F,0xAF7E438FCB0942EE,0x420313F632978343,0x5A65EF80D2A3F879,0xF2B073665FBC3A10,0x492B316C79162926,0x8469A83B89CB5651,0x78286FF9B5A9F48C,0x16AC9AB49,0x92F4EE7D0FAA1C,0xCE0136A2624A3BF2,0xBA04BACF53FF910C,0xD8029C37E49B542B,0x1D7C26DB9AAB3461,0xCFF5154CFF326866,0x6F87D57145A69D95,0x7FB823EF48B6BEBC,0xC8086608FAE41795,0x99FAB5D0,0x67F2BB37782569CA,0x326F2755734C0045,0x4139573C36759D67,0xE3393752F1B83199,0x1C4DD983533BC4A6,0xE30E54C6C5F7664D,0xEDB5EFCD05FD24C7,0xA796823FDFBC9122,0x560865B1E4C70855,0x4C571EEF,0xAE7265F95C3FE55D,0x9916EFA8FF83F4B6,0x1F59CD047C647FF5,0x49B2CE9AB8D1E7A2,0x392325A5F0605470,0x66C89BE524B0D3ED,0x3A6B287F49475A6,0x1EF0F5BDFDCC976B,0x5BAD96BFC4DB30BD,0x24B8231B9,0x2D8FA725148E56FF,0x7B1A18D2E0B7340D,0x72CC592B09D1AD0D,0x527DFFC0760E93C7,0xB972ECDA9539C83,0xD71D0F7937237422,0xB9345C593C915EBB,0xA066A887056402E,0xB3897B7FF9CEDDBE,0xE7C56174,0x770FE95EAC4DA7DE,0x3AF22732C119E231,0x852F7D65A2A30454,0xE73D5483B50332C8,0x8EDB1A1352547BD2,0x4EC6B187295F0DCB,0xE4EDCDFFA8D2AB1A,0x35B2D13585578D5B,0xB42C587BAC669AF4,0x6EFEF954,0x9DD72306634BBB3E,0x4D6DD1B4F946E6EA,0x5A3708735FC07378,0xC2C8522DD0DF8448,0xF51D8E06B3A0690F,0x8AE07A4D28144FA8,0xB88370E36DEF90C5,0x50F610726145FDBC,0xC2ECD41A8E36E155,0x2403E4ADA,0xE5FB5A29855EFC1B,0xA0364FD7DE6E9DBC,0x7FD349FE22EF06C0,0x3781BB75DC216BF0,0x109CB390DFF9C08D,0x9225E044B8A5710A,0x79BCBAA7B80D4982,0xB25A962DF8E31272,0x38C9DCAA9D8A2EFF,0xCD940706,0x6A0FF127E9CEE45,0xA63AC51844E4C2C3,0xFF6B109ECDD6D416,0x2196064EF6D757D1,0x832E66544409AC76,0x17F6972C47CF2BEE,0x181C49E30FA6C874,0x6A8256267C15FC60,0xCC82E3F6BA51D270,0x21B0DB971,0x4E0FD8B507765EF1,0xAD375F335C617350,0x138F385827462CC,0x80AEB29C84F1C27,0xF49070B67D3C82B3,0xAA7078C1C401495F,0x40B6643F84D0CEC7,0x1C0EFFD9A4254065,0xC5C7426011AE19A1,0x158A69629,0xEC9B362304A5C7D2,0x54419FBFAB46FC5D,0x2998B7C2F7CD804F,0x9565BE489CD4158B,0xE02050F54E2A218B,0x54A13477A445CE70,0x8A9365687046B591,0xC108E11963E2EEDD,0xBFC8E4B1904FA6E7,0x16F77ED9C,0x1449CFC256C8F741,0x57CC2BB488F18EDE,0xCAD80FB61A0D788C,0xC5C2BE13E9609BF2,0x906E39028519B6B,0xB03E06280A04C332,0x93E6D40F40E57178,0x8301C58ADA179E59,0x2DA101F5DB636A9A,0xD9399914,0xB57FD474FD506147,0xEEF7B06F9592F74D,0xC80EB0475EBC2AC3,0x1ABB5A7B72DA0BED,0x80A8D2133D01B83E,0x49A5CB7BEDF04D98,0xE98591CA35A2196D,0xFFC0CABD7CF19FBB,0x9CB2A7C885D2543B,0xC442F753,0x58DF4D2D9298647,0x981BF44D38A8FCCA,0x6D70F2CD6E8F9D81,0x456C06B770D0DDF2,0x2144A6C6C934573F,0xC483F659910C0AA3,0x4060D7BDA4515909,0xE78EC350ED4FCF0B,0xE1999BE0F3AEA13F,0x44E5F953,0x30063E13238B71B8,0x2B96FF05465297DD,0xD830D621A05925B9,0x9C00D65CC58BF5EB,0xF09FB0B7250B5826,0xCE983E43AEC03D53,0x8EC7460DFDA3E02F,0x9E2E30FA0DF9FA8F,0x1D2FE537CCA158D9,0xC21DAFA3,0xC628C02EB3862E24,0x6F00A5E5E686B548,0x71A49290B6016722,0xE09C1D4DDDBC54AF,0x106C1A83F7F04BE2,0xD3E7CF8896EABE54,0xC524C9BF298A73AF,0x97A27441ED717B6A,0xCA807EDA45FAE65C,0xCB0517DF,0x65A792987A308A73,0x7CAF4952750CE43B,0xEB15411E1CD97F31,0x648EBCBCDA2CAA4D,0x9ABF805604914246,0x94BA15F8ABAF5BD2,0x68FAA2723F278A7B,0xB1FE3FC02620D707,0x93BF4524CA7BA333,0x274A6F66A,0x1B88F5F5F93209D2,0x30B70A7461249F98,0x5CE2673C2B70BE50,0xAAA7A0211EDF41F6,0x369C7FA23F57F219,0x91A6268CDAAA34B9,0x634E63EE8143D392,0xEA3D9FC630F5E373,0x96FD8F468CA3AAF4,0x20E6E2876,0x1BF20413C6670EB1,0x842FE9F593B08351,0x61DD5D53670108BD,0xC5678D7B825A2636,0x1F8B98A808A16A3F,0x891384FFEBE118BD,0xBC6C137B00E51E76,0xE5F06BCCB8E95F74,0x2CAE667D8F67AD8B,0x8A3A67CE,0xEFF5ECEAACFBE384,0x3431F9118973CA08,0x7CE7335AAFA3ECC1,0x547302DD3BA3FCE1,0xF251FCB8E49A2A01,0x5BAE46DD415C6188,0x64A3EB6FD2F63EC2,0x1F50B756F158CAF3,0x45FF49F36248B496,0x3A7255D7,0x653B21C206F84124,0x5AFB44DA36E7B6A4,0x41718530BB6D521D,0x16D1D3E63F32F376,0x95220EC34C3B00FB,0x5E0B91A045F6B5DE,0x26AA514B84C71968,0x95A08E72A90674B,0xC199EBCB0E870358,0x1A5424523,0x9F0BEA5D26C2E796,0x10E8C5470E7F676B,0x1D8A1F763AA2921F,0x467A9D7AFB902C2,0xA6C5B24CCDEC1F6E,0x92D530637E8F463C,0x537D5CE3C1DE14C0,0xDB7C215208EC512E,0x2B7891AD2AA97B19,0x3E9228D8,0x482C81F1579F3964,0x82386083ED427435,0xBEB276B7236D6451,0xAE7636278FF7DBEE,0x7F87DB9F7B4E0074,0x91C593FF0913FF33,0x4F45CCE9A95BD2FD,0x97DEA3AAFF63D7C0,0xE30C88629AE71DA2,0x14F2B2B29,0x7F4733F74B6B7989,0x2D96BF0542D9BD37,0x224009CE169D6630,0x2E16050E68E6493E,0x2C9ABA9315B199C6,0xC60AEE61156951C4,0xBBAAE00CCE90EE06,0x89E2C40A9D2F5676,0x736C18F4F24D5050,0xDC3707F4,0x8FAC448263D8C24E,0x22BEACF8CB44E5FC,0xD612DD2F3843733F,0xBDE888D5E87E7925,0xDCA5DA6DB7A89C01,0xBEEB5EE97372B277,0xCB17BE9E8DA14462,0xA014238E3E391FCF,0xFD35D3CAB843A7D4,0x1751FB61A,0x24B8BE30E7C36CFA,0x668A9A7DD4477498,0x97E4941AB8A07557,0xCEEE8C02DE96CA08,0xA71B5B2CE10F9D2B,0x6A3AFB92A93770F2,0x6E932277873CA4,0x85D1FB21DAC3A,0x3D32D674EF8C19F9,0x2500991A9,0xE7ADF886AB4AF8F,0x1F7014B3FE5B215B,0xB30CC8DFFBBDD944,0x8D6AAADE0012B94B,0x98F8363DD28CD402,0x3F090E39D989B7A1,0x93979EFDB09003D6,0x6888D6C334B81F21,0x7D44ADB83803C94B,0x17C870EC9,0x9B93824BA050CD67,0x991F62777BA6A52F,0xB817F4E52DDADEE3,0x891D079E26DED17E,0xEA387ADEBE95C58E,0x89D431319C351780,0x2C4E94F3B58677F4,0xC475071A39CA4085,0x30A7571DE6374F84,0x184DD232E,0x2E428DC5D58BCD8,0x9D72DCC07BF172D9,0x2628102BA519A788,0xC3096E9276EDACFD,0xDADE777932574E70,0x7B54ED691794463A,0x1DBC5B5B1A68E6E,0xF27A7B5800ACC01A,0x88D16891F037D7D8,0x104F0621E,0xC150FB1B89E38428,0x3D2114460DF1013D,0xA3DCF896121E7279,0x554D8C9F484CF0DA,0x133635BCFC1953FF,0xB8B7F747DBAEF9D9,0xDD812CBDCD1D39AB,0xFC6672309A952474,0xD6CD508BB0F33D07,0x4926107F,0x71B0C9E75757D154,0xCF35A3960564B44A,0x1F791BCDF25D93BA,0xF3FDA98C79924EA0,0x69F0C51D74A10FF7,0xD4F8816A82D17436,0xCBC0FF64BFEC92D9,0x626FAABA5F2702E7,0xFF2763086601AD56,0x14012FB93,0x191610CD3E8B63DE,0x93D5FF48B2146EAB,0xCF6B04838D92BBA3,0x24FB519A5E9ACE93,0xFD6E95BC513E4C25,0xDC3DECDDA2FFE356,0xFCC2F15D6F1521CB,0xDE3BA614998496E4,0x4DECA91335B5F59,0x1AFFF5ACD,0xBD4203FE5A9E8A5D,0xB1D74A53ACB545F3,0x597C79539628A624,0xF7A56214D58307C4,0xBA7C9057DC0C0093,0xF8AF1700F7589AFC,0xF057BC3E6324E028,0x7473BBDBA425B3F4,0x2757DA859CBF4A4D,0x239C0647,0x8C5771867C02FC75,0x7928628D90B05D47,0x164AA8BD1C851FDE,0x8DAB60EC50212C22,0xFB92A45F3AF0EB37,0x41150683FF463BC3,0x46B66FF6A7DCD79D,0xA7F65E487306E372,0xCD978F4E5A6723EB,0x18B5C7234,0xE27E91F913485142,0xEB67988A59786C40,0xBCB7991C51ED5B6C,0xF26A06B3B1B96AD7,0x687B54D0D58BAC09,0x1E611172886B7C07,0xB8535716B734F031,0x5506F02CEB26FA0B,0x4FCB9E44D8268024,0x4AB1A7CE,0x45CAAB7B607F8FC5,0x4159A38FB916F48A,0x64DE10CE2472909F,0xB2A5FD42FF7B78BB,0xEF2D8FCBC56ADCE2,0xF5F90EFD7E10B36D,0x60405C3D8E2126FF,0xF43C8DC6AF350A9D,0x63483C2AD18F71E3,0x1D328B8F6,0xB68E29C70C66D885,0xA7EB109362004798,0x38993AD013379011,0x5BB835D45C1BBE3C,0xE4E19EAEB85B4010,0x92E3E7FBD5777CF3,0xD860C51AC117E3A,0xD208BFD314C604C9,0xFACFF06F9318657F,0xD4CBDC75,0x2EF9C37B005BF35,0x2DBF8F2FBF7CFB0B,0x6A93E0EFD994996B,0xC9CB66AC09157D46,0x44CE44ABA60FD164,0xDA8831419565729C,0x8845C1EA2E9EED91,0x37C97209BF2A300E,0xCAF91CBE8287A748,0x26E676EC3,0x38BAC6F19F22066C,0x7DE3543DE752648E,0x6FEB05FAF543EC51,0xEA4F676036613A6C,0x66E2E2329C192A76,0xE3314F445ACEBD0F,0x709333141926FF9F,0xA9B13EAFC16DFD34,0xFFFD48036BA10045,0xF0CE030F,0xBCA9AD3B54AE574B,0x70059C602F7664B4,0x41813AF8F6DED159,0x2BB2BB5C0DC39789,0x4FCE1BC2140EBA9F,0xC0CC7645C056D0D1,0x9E4CF8271C7ADA4B,0x2E71D2B949C02261,0x36C05D2EC86EC713,0x16D921FD0,0xDCC11FA46005C36F,0x37583FA484068A5,0x5701B522FED4625C,0x21496602AF6E5900,0x2F9A04F5B3D25180,0x6207A23608B00567,0xB7F5162AE1261BB8,0x9342BE9956F4731B,0xAAD31D942ABD8E89,0xA7997C47,0x9F4F11973DE70667,0xA8E455F143B22F4E,0xE7794264450ADD52,0x8461F8F4F143F898,0x57BEDB6C7D2B8F3E,0xC2FE43FB75ED428F,0xAED70E98F7E7582A,0xC50E1D37998A9B5,0x462579F2D3A650ED,0x1694BB82F,0xDE0869F3CAE3BC97,0xE40A39D28E2BA6AC,0x31D019C9C262B7FC,0x63E27DBF44086144,0x3932921CD4661633,0xD7199E91D90993E6,0x112F7B36DE0FFB97,0xFE8E32E79B2020BF,0x3AB0381F7A490A9A,0x8784CAB0,0xDB4ED97ECA341A63,0x86A8946FE64D5FB5,0xB73DC2A1417EDA79,0x66A3B80923119EA9,0x65F2DD8BF115658C,0x632376C0153D5623,0x3F3FDDB37106D093,0x8AAAC543A45E6C89,0x9831507C58B70AEE,0x1EE23067,0xB7ADB3519CC07272,0x110EAF498CEE8CF3,0xFAA8719D5B82313F,0x2E76789BFC60DE88,0x9C21F82141818128,0x46DEE27AAD4BC37,0xF1B9AAE3E9E8188D,0x2C3579949EE99232,0xA6E0D5A0C71FA759,0x277D7B365,0xA09BE7CF5FCD1C8C,0x4D1A20A55424F23D,0xF247E1201DC6DCE0,0x95C8D6FF2D1CAE73,0xBF1290CA2233422,0x99F6EBE7986A2313,0xAC1F38CA825060DE,0xFD6766D51000695C,0x39672264531A5126,0xD08C2D9E,0x35A87A9C5B49AB86,0x4A73EC733ACDD042,0x91993CBE38729E02,0xC1ADA0D631B47007,0x4DE97BA25C615CE,0x83E9CCC6B3E00325,0xAD1C155FC5633243,0xB282C810C2C8EE4C,0xEB92F879B21565D8,0x20AFC2EE4,0x6DF35DC710176523,0xD617C4352AEE33FC,0x8F3737102022D07A,0x28C4159EC7452AF7,0x3130B66603A55986,0x4F56B9D38AD7B195,0x18DCAA15D6BEA6E9,0x827E90DF044A58EF,0xF532E53593B4E31D,0x2286A15BF,0x3870412FA0E47741,0x3ACD251040846C95,0x72E15D56CBB1D300,0x1C8CB401A990508F,0xF721D4F4B27D1887,0x402DA99C2742392,0x24C8B4BB503C83BB,0x21685E9C9DD5B0BB,0xDC34F54AE52DEBD5,0x4F99ED28,0x7983D01AD672746A,0x12A13D5E950F26F6,0x6611507838D1A704,0xB536AC8C92EC0F05,0x32F8C0AC4EDAC754,0xA8D3E6F5F77117F2,0xE1D5BBAC0AC2CCD4,0x60BFBDB7E5AA5EEA,0x1251CB9C054AFC35,0xDC244A5C,0x6B39E2ABC3B8FD1C,0x1C02D5136DC766D4,0x6DF52BD10A635370,0x47F09828A577311B,0x10AF7752BEB1D623,0x4A9F1F059961D0C9,0x26F32A59A8F9CFD6,0x90CAE776130328BE,0x37317BEFDC6AE24E,0x2239ADE25,0x38C8B83C304F5000,0x8F92D78B918C4952,0xE5FA0855E2515ADE,0xFD4B16F6AAB2DEB8,0xBAA7D274163CA472,0xDDCFF1335164B3A4,0xF5BA528962B05884,0x1D04F50E92D60E28,0x3EB19FEE4DA4E3E8,0x1BD73C033,0xD0709B3CB5DACC88,0x2AAF2174D9E3D95A,0x526262CD9601BA12,0x2AC9590A0736092F,0x11FD250372C4122E,0xD5339738AFB67804,0x2DF7092416C2B555,0x52B2E19A0C06635B,0x81E1ED14C633D751,0xD4956C14,0xFE20C08324BC7258,0x3DC0763EAD690752,0xC572732BCF08FF8B,0xFF0420D87A56D4CD,0x263EDCC00D468B0,0x658766E934D33F82,0xCCED3851AFAD7838,0xEF4FB3BED0FE5720,0x6D3BE1995B9A14F5,0x1D6E9B52C,0x931479DEABF61C0D,0xB993F6A09999DAFC,0xCE9EC11C549E1FCA,0x2E801D287087A61E,0xFC990018DD8B7E77,0xDE1305A12C4FBC67,0x3DA2A2352A434396,0x6855BE99FF9F55EB,0xEB07C819AF966DA4,0x7A500207,0xCBC69DB0B849FF87,0x19691F952EF823ED,0x97341A0258E044D4,0xBC9C9C93DE786D87,0xAA5977D1BCF72370,0x27DBD30CB37006E7,0xC6FBF6658A241A8,0x86EADA2774214324,0x97ACA6D1BD4D4BB1,0x18A2A9E42,0x49C21686114CC7,0x7F3A05B05642288F,0x67AC2AD8951AAB30,0x2BD28DFC9CB6CCF4,0x3931B3FAF2C4A690,0xB11D9939426560F3,0x22212A5BE2BFAC23,0xE926A6F5C28170B1,0x892A8B6730FF0FED,0x258495FB7,0x9AAAA1A44A502EB4,0xCE3A8818DE7F81A,0x50941845D9812F13,0x9CC631F846B07682,0x28345153E92A9EC1,0xDB7CEA49EE214E7F,0xB565C60D0F7044DF,0xC0B2DE5FEB17F018,0x4F4972D25C2E59BD,0x2625E15BE,0xF091884B6C1472F6,0x12E28DD0877562C2,0xC4D65EB2B16A98D8,0x65C1238020A10A00,0xE100823F768D4259,0xDC295EF01D6F02EC,0x424F48AC10863DEB,0x2F1778C934DA22E9,0xD5E04EECA9644890,0x1C62B9ECC,0x240A26F04B486E91,0xAF5AECA4187FA330,0xF656E2F46F39328A,0x2F2ACD655EF5752F,0xAD4981A92D1DE444,0x243388D7ED7BD316,0xD0B11B83FB42FA1D,0x6D5B970CDA0E2A07,0x6F952E9259803B15,0x3B0F3C0D,0xE78A98D76DC267A3,0x37BCB795B7D4BF5C,0x2FC38C2C21DFAA65,0x9D13D4F8D5A7B4B8,0xB27AA13E88E8CBE1,0xE617F51F07596CAD,0x5F3BFCFCC57AA5E9,0x9187A8F98F5D8D65,0xE5536ABFDFDD822,0x10BAAA613,0x74E9F2B752B9D57A,0x7C88514533637A4D,0xDB1316844541D1C2,0x344D13D8414CF1F0,0xB77AEDDDC0E7CA51,0x9469B08C4A0AD9E9,0x5F2586827B94CDEF,0xFF9F81C455CAFC83,0xF0167DE658989848,0x3155A46B,0x3672E2BDEC28D318,0xF5B84613BC7B8C3C,0x2EA31E7BE039CAE1,0xB25ABD1AE8284D0C,0x14EA725BBD6E91F2,0x42F7168F7AAF1DD1,0xC9B4AA90FD165E4,0x526DFCB2F62D6A28,0x5069AA9B00017E65,0x250B9533D,0xC7A638D386A9DBF1,0x2A0D9F139874B540,0xBA5180FF7F1839B0,0x3B95CCBCB12861CD,0x8AD5915B3D027BA8,0x5195B91F6DAB6B5E,0x443641AAA6EB2477,0x2364B9EC37D34B8D,0x6CCA4EC22E4CBC53,0x13A88AA0B,0x4C1CC7585A52307A,0x904B55EBD1982157,0x2B74046E48FE9D75,0x20A0EEF9A41BC591,0x61D2166ECFDB2F93,0x26885BF95A355492,0xE90DD553345AD606,0x3FC39CEC9D39F2F9,0xB72E430715B78D7C,0x1020CEA6C,0x4E1B8BD40F376A07,0xFC9BA034C72E055D,0xFA0BEE06D957C388,0xCD21499B38EADEFA,0xCBE18D38E1C9EF4D,0xD6F2F224098DDD3A,0x147EDB37D6A52C66,0xED6961E9048E6073,0x9F03DE4A00924033,0x918772B8,0xB0C37A1E4F672791,0x33927B2DC18EC845,0xDEC163A1C28F1A2A,0x1C89D46D1777C3E1,0x4993F42FD265B94F,0x3D5E9975C4457A05,0xF81A3CFAF161CE19,0x50BF8DE3730D24E7,0xDA719F0050210810,0x236BA7653,0xB01F59E4535C12E3,0xCBB66950281C0D13,0xDB2D213BF93117DF,0x5C704D5E6FE9358E,0x988767C910B03B8C,0x8203A0871135C046,0x40819ADD9CF00FEE,0xCF7F28D96C16B3F6,0xF8CE010DB72A6E47,0x1465B7817,0x7ACF324C0803DEE5,0xAB5E955AB63B5FFF,0xEBCC482942E98AA8,0x314CFEA7A499A78,0x9595075377DEA456,0x776CAE0A3786BD0B,0x3BAE5C2FCF996D91,0x7794AE45EA050152,0x8106AC6E50FDFF83,0x44648E34,0x7A3A1D5C57F7942B,0xEB985FED410EF779,0xD874BBF3F0BB6216,0xFE2F642A4A74F707,0x88D2897987A170A,0xF593008373A865BE,0xC4D3ED6A89593B45,0xC7D8AE68D716DCEA,0x2933064D42CD9D06,0x246FC0E32,0xD6ABA46F280ED805,0x8567BAE66C7897DD,0xA3CBA7E4180873C5,0x1BB8ABA0A71FF778,0x437286FB3D46E66E,0x8050FBA289B2BAEB,0xDF63BABEA3930A40,0xB6CCA7E91BE12844,0x6118E58FB8BB076E,0x1E4FA4BB7,0xD3912302AE3E258D,0xB34D7B4AAE621C6,0x48371146936CC364,0x5C132D32A7584B33,0xE774F3A1DCE585C1,0xB0DFBF3ABD6B5988,0xF8F949B9C23AAFC,0x2294807989DFF099,0xCA9A4B604D142817,0x6DF6683D,0xED0A81273301C699,0x27560C7AFF1C10D4,0x1F374428EF098E41,0x9B3BF8122387A152,0xF0A3A6FE73673E47,0xA8FCAEF323041F7E,0x5DA5364270156958,0xA8227034C75BFC17,0xF4C8DAAF87ACAD8B,0x195CF97C9,0xAAA36EC56CE54184,0xE0E35454F83CF833,0xC72D40AA008D7125,0x1E54327406DC3D1A,0x10B9C6FB6CF3E684,0xCEB64B3B67582EBA,0x92D1F86E834822E4,0xED1EB9DC01DAE218,0x6463E7EB4A7AA8CD,0xFF947804,0x9B3C49102C4C00E9,0x6F6C8A7DA4C5EA99,0x75D0FE596D65E8D1,0x28BD9D9B6FB596D7,0x4C27471593396549,0xAB039FA6ECE5A03C,0x92C960073ADB6BB8,0x46BB9B237BFCF1EF,0x54D5766B35A004C9,0x115F041BB,0xC8CF955AFB0FBC15,0x8A71B696C6C9008A,0x222D5ABF07344779,0xCEE8820FC14936DC,0x81E36B4E89779EEE,0x2D9A279C0EE02FD,0xE2B02F4C74CC30A0,0x92DEF4B3302DF67E,0xB8B7BEFAB7107DE2,0x19C8D7E1C,0x214166BE170B9894,0x948DA0BDB5C24752,0xECD1F9E8EEA1AFB7,0xCBE65803B748C169,0x91A0E4722E77D862,0xF32BC680FB33AF06,0xA8DDD595D810D214,0xB6CA6FDBE506FF52,0x7D4A6C57D80E7255,0x15D41943,0x3EF61F6F4F46070E,0x3D36AC8A41E44CC4,0xA63B601E4CE8BDEB,0x95BBDCFE3C261874,0x3230294B33E7C01B,0xD9D82B80B0AD8187,0x8D7A82109F84AE14,0x4F122E804F106D0F,0xF582553E2FC1A83E,0xD65FFA12,0x89EDEE0326D69BED,0x7EC476A93BF42682,0x8C7ED58CF1165CB9,0xB371878A3E030550,0x63FA3A05D2ACF5E,0xF85A3DA2EC006576,0x82B67C1A48292E1F,0x65B7732654A8153D,0x9E8E1AEC48CC6AAF,0x1F2B22090,0x8918836859A5D64F,0xB23E33BDDD0B001C,0xEC6BC15DC4BDB926,0x105FF0DE88B85CD9,0xA2665C951851C8E9,0xAA1A12864B79918C,0xE47306F68D6C9FAA,0xD0AC19385538FC50,0x1933A6A40813A320,0x1A2F8B234,0xA5B646BC8DB13A3F,0x78BD53848E0E7AC9,0x9C711B6A9521CB8E,0xFA5C81F3F3776D97,0xF71FEDF9489B3EC,0xDAEFD5B4B846FD34,0x6F3751208B91BB7E,0x937B354D9F025D1F,0x8A0E9CAA808C73CA,0x177408807,0x7010F35E052DC0D4,0xD00EA2D55A4D050B,0xFA611C9CDC5C000F,0xAD619C7C9C3729FF,0x82F5657FA94388F1,0x4788C7364220617E,0xBA753EAF3CF24401,0x738023A2E6B4354A,0x12AB909DBF9FE3D,0x1F2470748,0xEB18AA7804CEEC91,0x9D074E05FB442381,0x50AA606A2616C6EC,0xDA0B4056FE266FD5,0xB7341E97711F8CD3,0xE921B6E9830773F9,0xBD1AA1EF327B278F,0x6E8D666E346E9BD,0x8DEA2585731EDF5F,0x15BADC7A2,0x37E9D80A2422E466,0xB212486FD9476B65,0x185C7989CE23A96D,0xAC6B3FBA418B6173,0x5EE928B14F2E3C4C,0xF261E94D8A32AACD,0x124805D7192C50CA,0x8F820B4E98C5BE8C,0xE369628F14B2F2D,0x5FCD550D,0xDB332868FF42CD28,0xB9B77510F06527C1,0x3872B63E41FEA838,0x3F41489D65622E4E,0x224D2DB916E21358,0xAE12732D78551758,0xC6B148960E2EA47B,0x7415E19CF3273B96,0xA7B0948E48E81A74,0x1E4AE7CE5,0x23F13C3D2B5DB7C5,0x58AF31316D84109B,0xFB4AFD1D97AB41B6,0x5E539D19F8E2032B,0x803047CF9E0F2B87,0x933A1C567DB69DAC,0xA939438C4C6E7DD3,0x8C114DE7F3A2C51B,0xB8113CE15AA784FA,0x76C01AA,0xFCB0F6644FD70075,0x22A1D247139677C0,0x99D02A533F18F44,0x911EFBA9FB9CA5A7,0xD08E67E894E91008,0x508B3DA78FDD28C3,0x99B80EDFC28BFF8F,0xA45097F3A618E693,0x7F9249E4194D1508,0x1790CB25,0x4AB7340709BD1FC1,0xCAE86312BBA47DDE,0x7D02BD1D83E45790,0xDD473E265FE6E745,0x54F3DC1812FE9F2A,0xBA510A2816081198,0xE6600A317DA10A0A,0x18BE13FCDA63B154,0x9B296AEDE64BF4E1,0x231A4D400,0x5E53076ABDF25377,0x9389965B02B19EBD,0x51C927236907CE,0xBE6481A881556829,0x26399FEA0060FE37,0x87A702F67EA5280C,0xCD275A240E7CA195,0x34C25CD7EA96B7E6,0xFE22094641F12230,0x212B27B16,0xCC32E46DC7002A31,0x7ACCEB7F144582B7,0xB1770FF771D3F340,0x4C81E90440CADEC4,0xE53ED40D76DED3BF,0xEBEE76C163E1F9E0,0x8A9C618E4567E2B2,0xB0738CD5A3C8890A,0x5AB4EE09D8A1CC28,0x1DA724B27,0x994313C5AE6D9BD7,0x67503C203B13FAA0,0x7845F0EB98B70D6D,0xED694750961DE2BC,0x7735D1FE26C90F5C,0xE01376B2FF1D1E09,0x9835ED433E64E635,0xFE96F5D0D336B082,0x7E697D994499B114,0x923F2E6D,0xB1EFB2CBF1FF5EE4,0x1F480E95667C9A0C,0xD5E7B081F69C9FFB,0xC15B888879CC6886,0x35CD1DDAB648D1CD,0xA9897EE26CBCF174,0xD02B52B94DCDF046,0x57D540B313258201,0xFC62A8E57A1D1B68,0x13C37C322,0x5D114C6A419CB5,0xAE7942BA35BFE816,0x2621267BCED97DB9,0x59A83D70C73D6A2C,0xD4339E2467052E6B,0xF20B153147A66603,0x48B4A1AB200D765F,0x6034275FEEFFF1A7,0xB4673B7BF1DAF646,0x33BF02EE,0x1FC5ACDA07DEA6CC,0x461878C2C6F83F68,0x5C62C036723901C7,0x3A7EAD2EE1727CB8,0x5771B4EF441242C,0x3BFA86EF23810669,0xF88318BA07AFC5C2,0xE01F1DE042270B8F,0xABC669CEE775D0B6,0x1EA240A7A,0xCDEF761F5EA5D3C8,0xFF57332F55593EFC,0xFAA18C59438F7D6C,0xFB1D41AB1F1936E6,0x204BFE609526A3EE,0xFB823A2A8C2FF147,0xAD38F244E01C64A4,0x1EB461B2B9DE8176,0x90EA0778945F4D1E,0x133CF205C,0x32486712689EF2EE,0xE7B713C5EB614F7D,0xA540B0C2E45E6D46,0x3EEB7BB6DC64F64B,0xB66D5F653F165411,0xCBCDB44B2B37CC09,0x6EFAF7AACED74D7D,0xD754D137294CDB48,0xFFA1BD907CEEBAD1,0x103D9D08A,0x5F5DB128439E1DD6,0x223E1B5159BD3630,0xB6467C18AC3DFD21,0xF500F2DEC9466386,0xA7E0DE9ECF5D6E70,0x74F08748D119F392,0xBF3B52E87378B0D2,0x15D4B6139F6EA63D,0x3E79B5DFF59DECA1,0x1B976A8AA,0xE6A8D99495504F36,0x854C0DBA7658225C,0x52261647D6F41935,0x6FBE834BEFB571D,0x4C396CF3129AF5E3,0xC4D52985A1E99D47,0x47DE02C1573E4B8B,0xB7B40FCB14FCEA9D,0xD31194D2BE155D71,0xC468A2A1,0x5C4B317F971F4B16,0xCF3E6DE72324A885,0x3FC5CDB20BB5F248,0x64BFC4641B95A932,0xF2D204B6D119E67E,0x98C241E7270392D,0x13A5B4FAC705DE50,0x9F645B771A9ADC0C,0x97BF498FCEEF8191,0x211FD92F9,0x7BED9B030EB536B4,0x5F41A693F3440CF1,0xAD872A13DF47B239,0x657C49A5B1DF891B,0x9FDDB73CDE1A85AC,0x38730A36DE370C9B,0xF0C697190EC6799D,0xE4E70764F4C7EE84,0x6BAFBBADF6D00190,0x1733B321F,0x5040D14F30911A9D,0xC279AA467483A604,0x25F507CF8FE55614,0xEF728F5996F12618,0x1B500EA49ACA3E8F,0x818B147989F63BC9,0xCF23DE7757BFA303,0xF05AAF3975D5DF80,0x964FB03A15EB7DE2,0x1C0ADD46A,0x238496F1F21B315C,0xDCFE5B391BB192DE,0x97F6E4BC110D2B32,0xEC96B3F227ADBCB6,0x3C6C15F8597675B4,0x7E4BD245F9DF2C26,0x503AF27A4E2852D4,0x7036A18A8B32AE03,0x19054C3897DD86E8,0x170864378,0xA7D1895E7C2E2982,0xE03B2A9908257DD1,0x87E930DDCBB2C14D,0xD7A9F0816EFE6F3C,0xFCC18A16F3A67FA7,0xCD2128CDECA95BE2,0xDBB060902685729C,0x22B0F351B6C850A3,0x1521A480FC41DC7F,0x450A0858,0xD74D07C850B8C433,0x5B34C705E5A9093B,0xA3DE573E6AF66B56,0xD23DF6C918642B44,0x1668AA2B00E2BD94,0x2A178228646498F2,0xD995AC1858AB4143,0x289E2B502CD25334,0x3C4F122497E93047,0x13A624404,0x32C93CF4EA4C39A9,0x76859B1BDEE686A5,0x15CB01781826A42E,0x63E72E4726059231,0x2912ADF2F871AB1B,0x17B81C7C173BF00,0x253D642E39700ADF,0x8EECEFDAC201D4BB,0x229575F76E27A6C7,0x1119A37A1,0x529595128BA1CF65,0x4AB3863B475E1F36,0x612C6A8AD36EA2F8,0x6B45AC0981E224F9,0xC4FBF355C7F8F7A2,0xD11F1C8E4FE33777,0xDBF8B1E0434D216,0xC6448E27525DE1E,0x216ACD2C738796E3,0x12B452DDE,0x2EE95A6A154BCCC3,0xBD1896D2540D4301,0x7E299DD8E5080471,0x4889B62E95B058E6,0x782F2BFE716A51CD,0xEDA7D760442205C0,0x7B5F070C578E17E0,0xE6E6783F716A95EA,0xE0C899BD52BA6AAC,0x3953B920,0x36706800D83CB0AF,0x8A37129C4579C19D,0xF410DA4ACFF4413D,0x17E6274AB6056120,0xD4CAC8903FCB180C,0x3EBF5BE4642CF009,0x202A816785DC2240,0x34F2557FA2266D20,0xD553CF1559BB4F6,0x258FF3A81,0x8EFA9CEDAD386064,0x726442E1E038C9DE,0xB30C2278E479F430,0x383929A4E914B705,0xCB240F759582006F,0xCE8C010E0DDAD477,0xF71CDBD1E2214FC4,0x5EB5CD623B9E4BCD,0xEE4D4BD752E44B86,0x1B62C7A93,0x7DDC3FEAC59DAC1F,0x15ECEF9504E1DC65,0x27C9CF72253DABF2,0x2080A440259D2C9B,0xF190A89D3084C020,0x4DB7D471D850F695,0xFB401EFD5876C1F8,0x798A22B09FF3405B,0x338BAC8A218013F7,0x137DE2368,0x23B3DEF9E618755B,0xEA4AFACE79EC2F20,0x37865617CC5350EE,0x5B237F192292276,0x966F7504AA3C40C8,0x93F4DBC5747FC9FF,0x93491464CD5680FA,0xEE67AEB8BAA5875B,0x8BCF614F100D7968,0x1C89264E2,0xF46A371ABD9549A3,0x989BDA9A14563F9,0x1DF53BC7D367E356,0xE14B06E5EF9B33FD,0x9B6BD75724807534,0x28EE154DAB5AA44D,0x9E7287E5B539D736,0x7163F2D85A0DAE67,0xA36CDFC29C9CBD10,0x1AA05F375,0xD65BF4464FEB05DB,0x2CC589748E3F5D81,0x342E8AE0C3517CAB,0xA4A5D5F7F791A19,0xC6D7597E3FC4AAA9,0x4083171B2D3EBCB5,0x6ACF27B10FCB3A0C,0xFAD825DE9C340368,0x911CD316465ECBAB,0x18FEE8535,0x26125ED14E365500,0x9B141766ADE68DFF,0x33F6FB062CCE8064,0x70761B3620D71760,0x7A319DB1D9620FA,0x5270F5976CCB026F,0xEE9BA7F0A59C9AFA,0x819CC12E3CA2665C,0x96572AE733024D27,0x855E56E9,0x643FED710F8D8A1C,0xC5FADC272F51A4AE,0x4DCDD4F5457553F,0xA784402A1B0DBB5,0x6DE62659C79E0B6B,0xD8FAFD8807DEA467,0xAA32ED1FCD6ABB26,0x5F696451887872B4,0x9C1F36247EB5ED98,0x7A972730,0x6164816A4790FABC,0x25BC9C7CE907D166,0x8161D9C37E463E96,0x4EE01B3F137F5FF2,0x913296E08EDF9845,0xE4DF2F76664A59EB,0xC90BFF5DF4800157,0xBC1F64F8BCC39854,0xD98C3B53D8204E9B,0xC7DEE790,0xAB687BA634620FFC,0x4F0E0B9093B5AD08,0x54E2B168A7DE8EA4,0x9D4AC482C60734D,0x30E307261E8B9DEC,0x174E7485D37BD952,0x54FD4F895B65DF9D,0x6AA734EE5A0A397C,0xAFC9096DF692948E,0x20CD4A626,0x4D86E2BC5779586D,0xE8C52F3C261C7903,0x447F25308A9A1CE9,0x7C6E4D5F9AEB2C3F,0x92E9C27E4ADE1B8F,0x69C6CD47209BAB96,0xE9A924E2B4ADC59F,0x5FD839A4D608229F,0x373ECB16A36C1E86,0x6A20FF1D,0x5884E4C4B44F5C6F,0xD6737F70BE560004,0x151EB0A0D1715A55,0x9F4186A2D53DBA21,0x14604D8D6296BB33,0x138496EC0C10BE94,0xB8808861156CB003,0x9EF25418320EFC13,0xDBB9F22EAA7B40D2,0x69399492,0x61DB33F316C36A55,0xCAF89E5BE5E1DF06,0x666C9F7D2F93365F,0xF177FE49CE4ECE05,0xAF002A21D0BFB656,0x2BD67F219A437992,0x16CCE3F79466C65E,0xED49FBDF7D019316,0x8D51E674F35B163E,0xA48E36A2,0x9A70569CC6B67AAC,0x5C2F9E5B76211B10,0x162A4D2254400089,0xC9F702C7749B7C91,0x7D90C76A0799CD72,0xE27F904ABFE20D9C,0xF310D8AB9D89AE8B,0x9B3F7D10A42EB44E,0x23DBAF3C3953A555,0x14D0C9902,0xF2C9A05816E0EFE2,0xC942B713CEB75932,0x5B69FFB9CC235F15,0x60B1FCA612B1DF92,0xAD0F5E71EC8697E3,0x98B2A3227341B5C5,0x53C50ECC7083E9AA,0xB4C02F69A695A762,0x1F221CAB96790979,0x1E2B061A,0xF46739BA3707D317,0xB0C6624987D71FFE,0x1FCABBF7A33F495B,0x43848D919CDC7BB9,0xDCDCAEC88B8AD451,0x8318A7F5DB868554,0xEF022BC9922B74D8,0xEDF837E9A6B2F4B5,0x192537F756E8969F,0x21CBF33BC,0xB1C5E94D5F9B6D81,0x1A2B60212108962C,0xBDC4A1F8A485369C,0x9223B014B7D8C6D1,0x705977287020F6CE,0x8E2E78A7BEC866D0,0x46B48B04B5FDF82,0xD88E3351F7A188A7,0x614BE39368EBB0D0,0x1D694AEF7,0x93D65EA66EB6A9EB,0x96CEA2E0B9C9691C,0x17AF7E2B6687A60B,0xDAE0C837439C02BC,0xA2B23E2F9430E674,0x91F1C09C62FC8867,0x1C83568AAB3E50BD,0xA139DD6546B54F95,0xA7E68EA363322B4E,0x14B2648DA,0x7B8A527D1E6282E4,0xD54F2DDB6596177C,0xFAEABF69E7529C89,0xE81D3EBB8B5F9F7C,0xA26509C9B0033666,0xD538DF82DC6DABD4,0x87E3C3724BE93B62,0x93DA29F2A3529D02,0xA761199D876D4347,0x95AAE7EF,0x1EC9E36996658E70,0x13A280CA28D6EEA6,0x552E59783EDF8369,0x6A22A456B8899D89,0xE3BE9AE302B1AF5D,0x454F1CF66219D1FE,0xE36FBA4DEAA92480,0x17F26E0DFECB30D4,0x90D62FDB1D4F083F,0x1EBA39AB8,0x45D51F4A5A00DC93,0x34D3E1D309C28E4C,0x36B47985C5BC664F,0xDA158F2C67C4BD4E,0x6145EE8FDAA1689D,0xFF6B5DCAAAEEA331,0xC8B6BF5E8D316AFD,0x111DE1E66FEB33FB,0xD5412125FBD90694,0x230AC3A74,0x1F63071E781E8AC9,0x24C1CD8297E7BEB4,0xA59BEDEB86BC68B7,0xA28E2F3BDF48B3E5,0x5B3BC64B41BE627E,0xA75C2770F6942324,0x3624CA1EAB9F39F0,0xD36FC5DDB299BBE8,0xF8E5B5ED6C2E1A14,0xA6D2F7E7,0x56E20F6E1AC4A56C,0xFD67B5C57B0161A0,0x608850D7518B73E,0x488A70ECCC78137F,0x708C28B844E2B6EE,0x17663080B0CCBD82,0xD022CB350195C44A,0x58EE45E8166D0890,0xC5FB90A10D1F00A0,0x1D824A3F3,0xD6E9725240C52994,0x80AF9649E4B7F787,0x1DA0DD7FE5B4EC06,0x998407101680468A,0x544886BCE4B6B6A,0xE1E7B3E34EC95DF5,0xB6C34436562C752E,0xD011926AEF98B849,0xEAB7D0C4E4BA6FE9,0x1BCE947C7,0xF26B33DCCC899CB2,0x9CC4B6D4888C3556,0x6ACB24C6D2D0BB63,0xBB3EAFE794E42BE,0xD06C815DFE3B83B7,0x67096AE04CFF8FDD,0x53CE9A7BA1F9E0B0,0x7772C46037350442,0x59AC83580B3CD96F,0x2735D5F57,0xEBE58AE26E38A59C,0x1788F34CD80B1DEF,0xCB2C4CA16CB4A114,0x4060B26D66E621A3,0xE7C61F6909016791,0x74759E587F127C6D,0xC27905E1575CB191,0xC06E0B5DF1B7BAC2,0xCA61ADF46D96FC66,0x160A87872,0x9BEA336EB4A6F568,0x8AD49EF8489D1E3,0x9DF0A25AB40053C0,0x2B8BB971F6727564,0x453074435487A1E7,0xB5743CE4A5FDE299,0x576A40F776E8499A,0x81D78EF2B16F552C,0xBB9852548E00B97C,0x73D8CB11,0xC94D8C2784C1F7A0,0xB3C5F5E8C92F64C,0xE9BD27982F28679,0x5C1097AA1F5C04A5,0x2B037D817622A00E,0x8E1BA65B7B6269A3,0xA8A158467429D36B,0xCEF6B5689005FF4E,0xD1DD610DAF41BC8D,0x1F7C697F7,0xED2ED8EFE0CE9CEB,0xDF9F668FFFE89E26,0x78952B3B398AE742,0xF259300DE5426FF3,0xBFFBD7B41D9655D0,0x204EA0DCF6292659,0x145FF13F651547EF,0xDDBE3C65D7C470CC,0x32766E4FEB2F827D,0x2443C1DEA,0xFDB4A9E3EA4E1315,0x57A09D0A1E006439,0x67D99DEBD54B765B,0xFEB465198E333B7E,0xBB7E6A0962641660,0x2230A5F5AC2EE6B4,0x679A46B09D6729B4,0x3E65DD7FED570146,0x63AE975056AD5951,0x22D7E5A7E,0x737E56EB28199B47,0x378CD7EF3B83E549,0x45640B9A99EB4AE8,0xE20963CB2A5C9ABB,0xFC8767383669B8FF,0xBF554C069AEB587D,0x6A7A053D06635606,0x9B156634E84BD3FA,0xBFCB0BBA8E967EDC,0x223BECA52,0x7785F105016F9EB8,0x1E6A61BAE1C725DC,0x4331D2562BA7E292,0xCCAE852D6645EB02,0x17CDD6BF99A41805,0x94B84425A13CFDAB,0x74612B7DADDA494,0xCA5E4D1EF2874763,0x63DBE042D6B4AF7F,0x19A2A5F05,0xD1E3CEED8E08E3E1,0x6FE411FA86BF1C6D,0x28991E85CBBB9FC1,0x424A7D661D302AE4,0x2F2EEEF13F6C372A,0x697958B9A8B202CF,0xA8F1C64EB1D68FF5,0x5490D4E2E663162F,0xA792C437948D1994,0x21C51FD7C,0xE303169FD9286525,0xEB69C5BF7ACCF273,0x76B56E8AB1B00F6C,0xC43A5FB1833BCDC8,0x37F62AF4A923E1F5,0x4804A0FCB0BF8FF0,0x9546482796A87205,0xC49108CF35681C4D,0xEF75D1FDA8521DBC,0x139009CE3,0xDCAAE67F1D03B7D8,0x94E5C4BFB9E3934E,0x258707C2A6CF949,0xFDCCCF036E8A759A,0x8AB1AD7E7847F893,0xD36CA7158C8DC9C9,0xD1C8A385D244854E,0x176BC05A9AB8D8BB,0xC90FAC27F53CC2D5,0x128725015,0xB7CDC30C61878F11,0x995C694D7319A055,0x31AE3AFC03BBB3C2,0x809916557BC5F72A,0xD68FCDF6C5B0FD5B,0x21B57E30A89ADA82,0x197FC9E255FF9D1F,0x1F93080DF4B264CE,0xE829D7D7BB0F218,0xFA7214EA,0xA763631F66AB0975,0x86AAFDFAA90CA6F7,0x858E72856F837D51,0xE2105E474E181B8E,0x32A47F58F90B2673,0x61CCD8A29C3C79D6,0xF0DBECFAEAF413E5,0x6A47DC9BF4A9E472,0x77194A01CA7FB4F8,0x56D84EA1,0x22321DFCDD3462C5,0x6BBA5EB9E11505A0,0x9EFC4784AC21A089,0x484F81DA7B6C58D4,0x937077056F1BADCF,0x31EF5506FACF6B3F,0xC7CC1C2683F6E42A,0x3D22B647764FA20D,0x67354676F9EEBA75,0x1A58240F2,0xDCF355A99A5AB06C,0xA3006BEFFFB22D53,0x1C0A1C497E50C4EF,0x78D6F029B09C4E9E,0x553096B0B0A18BC,0x82E3A8033354FB6F,0x16296ABD8BEC764D,0x1BE7CB3E45E23D54,0xC5094328103865F1,0x187BBB504,0x6AAF954C2EF25F4F,0xBEBE9AEA82E2EFB0,0x2C9FD6B8EDF1A0FD,0xDA084673D4177560,0x5DCEEC3C691305D,0x7B40DDA18AEF4124,0x4B3E5A4ACCF81B46,0x494E20E7871D4BC2,0x6A21EF514CAAC87F,0xDFAB62B1,0x505A2E949D548A9D,0xBB8E8C74684F3CFA,0xF8964EEFB9642F66,0x95E511B9C0A5D051,0xA4E4546B88D5E928,0xE1512C9A5A16FFA6,0xC68350E8A41E951D,0x1267703D3BA4A93C,0x43867289AAFCD1E8,0x220E30225,0x1F62B804D810E01,0x33343E4DF78EF236,0x37848607A9D10290,0xB784B4D5436D4604,0x12941121A35923F8,0xC5803364120D816A,0xA6D55B72C6E3AA77,0x2B10AD9C81FE311D,0xF93DEFEC082E7823,0xFFB9209A,0x351F9AACDDF731B9,0xA611E5EDD7B2252F,0xE289974276F47D1D,0x5BFA6428EE1E74E8,0xC6387C774A88C76A,0x78A1F267BD252E83,0xC35D14705CD232F7,0xF7AE37767BCE2C62,0xE735D594FEDDA75,0x19212C234,0x6A7DB83EAAA0B120,0x7DFDED7E3CAE84FE,0xCEDF7EEF86EE2D88,0x5EB74D5A3A27C63D,0x5266D21F9CA2E923,0x3FEB69D663D02937,0x8C2EC250FF8D16C,0xD3975A42CCF620C8,0xD01BAE3E97D8CDA8,0x21376E063,0xAA6408F6D8DA9ED5,0x7F458B6AA5BBC49,0xB08EF5B7A29EE357,0x5B8990C1ADAC5758,0x8B5A683F9927A66,0x385EC8863A915258,0x120A4D855118AE47,0xDA99F4AFE3D59DB7,0x22CC2C8724D71410,0x248B04255,0x749C5D490AE3B588,0x527701B8007BE2F1,0xF05A792FDFDAB94B,0xA47AC1B9CEF24BA5,0x54A3532AE2A668F6,0xA4FB95F4FFA4B274,0xE4570AD2794B8102,0x47B33F8672CFCEFA,0xC318516A33367BA6,0x24FC326D3,0xFF746C3C4D7415B9,0xE4D3F51A919E0BCC,0x1226E160FA169EB,0x4EEBF8088CCB2BAC,0x29DB3F4BF3A7E86C,0x53E26685988E05E5,0x1E5F628D8BFFF916,0xF41FBB47EB4AA983,0x1CB9E95BC46802B5,0xF392FA0,0xA050E44AE789ED29,0xFE81D8D28146D8D5,0x3D25CADA88A16943,0x6BC0C03D0B9BAF47,0x4797E174C5A7562C,0x637D003D9B455799,0x1C8117D6A808817C,0xD25FFE3683C2E541,0xAFA01D90F1ACC031,0x1A128F23D,0x9925C2DFC1E8A955,0x579D743E3095CC23,0xD1FDE6418834731B,0x7163F52FE4207941,0x2FDB5086AD130B,0x5F914181B678A475,0x607E5366173C3164,0x7A474065572B476C,0x775CD5FC81354EC9,0x166C18043,0xCF7800841C6A82F2,0xC210342F2B6C5F19,0xFB09819945B33458,0x2E8F3E590EE7E45,0xA4E89992EAD3D1AD,0x5A3141ABA76B5764,0x4D949363127A083,0x1C007B6B02B53CD9,0xDCEC648C8B56D19C,0x17A5F6C6A,0x338667C3BB149C27,0x7E1E2D38D0311DA2,0xE5E27EF0DE70809C,0x6613F2429F1233F7,0x6A232EC938957AD6,0x6B817F36B3BC7053,0x4CD2901BD15E178F,0x9AE04A1267B6A0C6,0xBFDC8923992A9467,0xA9C23E87,0xAD0BB64BE8B8BEFE,0x76EF886BB8DF52AA,0xDDF77ECE8FF315C3,0x3606123CB23397B,0x93B38A55F4B9E833,0x53AA44563CDCB271,0x224849686BF248E1,0x49EEE92ACEFE8A6C,0x2A07D7BD594B0035,0x159DE1A8,0x52D2A0D5CE3CE1AE,0x3A57FB6983984BD,0xBDDE878ADD901CAE,0x6876D87CD0EF1CF1,0x7945B6A2E2DF6B9D,0xB8139BBF26EC7EC2,0x85E6F8EB36E4FB08,0xB9BB8026E703355F,0xEA5A10DD0190226D,0x244FDE6D0,0x88FB63A44875422F,0x1272D3D6988E1443,0x35A8AE7F6A1B3A9F,0xC27B3F6FB9AC1319,0x4C1BFA148418AFE5,0x9F02A5308F04E6CB,0xD11CF568E3F52A15,0x999647DFF2849128,0x4ABFF04F1B765862,0x11FDA7F40,0x221B113407D3AF42,0xA4CFB2B57F67A22E,0xAA5677B8AB72309,0x36CA5CFDC89FFD07,0x20F8D6E13067D23E,0x590EAB8DE5461E36,0xC67D30EDAEEB0D55,0xBA9BB891800E2D8B,0xF14B9979BDD27F34,0x214BCA4B0,0xA54893C1A3B0444,0x7428CAEB1428149A,0xF306153948E756B,0x5750121E44AF9D73,0x9F32906ABCA64BF5,0x44257FC51C66F9D4,0xB367E034F4F2DF65,0x57EDEA1FE5DD27A3,0x12F66AC8901EF34A,0x111C823B3,0x4BF2A0083A130BAA,0x146FC6586F674597,0x67A6D1A7AA958811,0xA8911EC53F599F81,0x8F52958ECEDC4587,0x4675994247F91D10,0x409D67DF64DF1439,0x3185BB13218D6168,0x85A93B1B4D164739,0x24C453FE2,0xF3201E40A9DFA32C,0x4C32E1933BC40F59,0x56270F8EECB217B4,0x798F743C26308906,0x2740A8658A9E9252,0xD5431A7F099A8883,0xD0F434C05E1AAB29,0x78BCD98A7F1F7C3B,0xC8B533B10847DF2F,0x11D204014,0x616C43A4BF402BC0,0x2124EC791351E97C,0xAB0ADADF4A4C0673,0x77223606DD61A533,0x99C3FA9418C9A962,0x5E49732656B109FB,0xAC54B16630881910,0xA2CB284C56E25491,0xDBD32BFF6EB68027,0xB24D1552,0x8666D8F7F45F0BB9,0x2074B94C381DCB0F,0x1E059A860239E833,0x959AC9C473AD8B1A,0x281E61F0A7DDD8C5,0x6B9D96C40FB40FF0,0xD46F307CC02A0F7C,0x2A7BD0F251ED91CC,0x1B81EB907FC4CF3A,0x969522EB,0x8F768502A37FF640,0xD0434785E787B079,0x5D7C3C8EC7C5809C,0xBCDB55037D055248,0x8ADE19374550403E,0x502E514A521F5C7,0x6C5A855E6C6EA900,0xA689889E77FDCA29,0xD6DCA7D00BED31F5,0x1FDDEF826,0x1456CCCB9CEA4BA8,0xF4750D7DDDE7E055,0x88E183363B10BE99,0x7A5B62E1BA338E1A,0x90DA36DAAD9A73E3,0x2D4EF4011101A4AE,0x7809931EB14EC819,0x6D07D518BD010AFA,0x3654F0E59CFD89D2,0x140C6AB9E,0x9DABEF10546BE654,0x368882D223A1D7C9,0xE4C620EC4928796B,0x76D14C9BB26A735E,0xEE3BEF5022333C8A,0x5B4D8F9E5B8221D6,0x97337F17AA01697E,0x677108BD9D542872,0x89DD102915760C12,0x1136A8884,0xA0FD06E8B8B5AC2B,0x5BD685B60F67443,0x335B659C6FCF950,0x871AB437D27B5EE1,0x79F7048343D415D6,0x5CB9A99441790CED,0x9893D35B8475D44A,0xCA1B3FCF5A3E218E,0xBBFBE09B455B7CC6,0x22249CB94,0xCF8CD97BD4A3D621,0x95F900BA348188F3,0x674F13A008F8BC37,0x7DD49D417C868A3C,0xFFD81EC64544111F,0xB1C1F3CA2B684CF,0x3FC306C018DAFF33,0xE0A44984DC33A818,0xB15B931A3C4621F1,0x221A4E930,0x735821A626EBAE77,0x3658523974888D70,0xB7D74EC5AC4E7186,0x29DF8CF1796D622B,0xF45E543472CD25F,0xC1469A8576F872A,0x8344405283BEC206,0xDED0BE205F1B6137,0xF149DAAB848D4CAE,0xB52B28F0,0xE12C5C27D97F240A,0xE1DC7A2FD07E8EDD,0xE09EB599B6D64598,0x870967DBC83778DF,0x8FE21DA8E4B48191,0x93D6C5180290F427,0x5B7842FE7353FAA,0x178F437FFE7BADC2,0xCB9EA87E5363E1B3,0x5724ED30,0xB633251489023691,0xF7B61EB2406EC5F0,0x91F8E39823A83315,0x5A97819817F04A46,0xB49667FE9DEFD2DF,0x3C13F800E6405273,0x72AFEADEC3E91F65,0x71D9B510B8AA873D,0xFDB4AEDA6190A07F,0x2F943627,0xCE1A679A16D9032F,0xC2D612E4F860CE47,0x35A97BE3483A749E,0xC91007821B54BEDA,0x19F81D19A628BB77,0xCE4B57FFEC0C87B5,0x4FAA124E6AB08720,0xFE716FCC01A6FFF8,0x51CD9DB17EF9103D,0x19C4A9C54,0xEE59490DABF01464,0x2B03AE4EDB80167F,0xD0D1EAC6FD443DA6,0x90BC4FCFDA3D54DD,0x6D74477C876708AD,0x71998D8F3F7888AB,0xE7AF4A6B4862BE57,0xE66EFD80904EE010,0x13D8E4406BC0A165,0x191FD6EBD,0x59CE4B1072CDE79E,0x6CE309D2A7C48F9F,0x9CECBEA8B6769C29,0xE160A21A45074A31,0x1810A019ED34906F,0xEDFE4F1BB65552A5,0x3285BDBDCA9AD864,0x925D1623B773064C,0xD6457A331437E1F9,0xF35F251C,0xDE6F4AA8AA92C7F4,0x756449E1614EC084,0xC5A41B1708C02950,0x66CA544B2C70C79D,0x343CB6336BE8F73F,0xE0043D9E8D21C205,0x206EB78EDD70A09E,0x61BDDADC51AC1EC,0xC72F465B34130A0C,0x17D3A72D7,0xA80FFC86AA74D938,0x45CBD452F88891C6,0x122020489B0C4E6A,0x29CE0EF1B6569EB3,0xF1E73F12DB79AC77,0x2AE43C8C29C8A99B,0x1725130160BD348A,0xF3984507279068A4,0x2D00468CE4E90BEB,0x9F5385EE,0xD13E9A200C001944,0x2A310C0E1DBB9C9F,0x6A3021280FB0CA6,0xE37882C653849FAA,0xBE195E1689ABFFAC,0xD10C78F4FE6BDFD5,0x72328424F0A478F3,0x7064BFC9A139B4C5,0x59629FB5E0258A7E,0x11F510455,0xE03C0E7C464F2402,0x9F89CFC827DB93E,0x59D251ECEFCFC202,0x69E7072A5C15CC4F,0x8F5AC008600F35D5,0x4B055B315A52C3A3,0x85C99DEC15C9C9FF,0x874663BE54E58152,0xEFB030505180C135,0x22648D054,0x8E4F062567252EBB,0xD348F9E065C9C32,0x1DCBAE381438D3DE,0xEE11AB20E63B562,0xA662B1EF465CAE9B,0x530E21CB52C796CE,0xAD3FBEEC8C5E9059,0xC0138A6261060137,0x598164BEF08553C1,0xDFB4432A,0xA6984F9F76DBC646,0xBD56AA3A5609D3F0,0xD42F3742D6A4D926,0xABE6847F2CEEBED0,0xE8B08317C004B7FC,0x457F5B42F556F9CD,0x4E22E51451FB841D,0x103B33141F9253CA,0xAF77C02AB0A7334,0x1D74D96AC,0xDCF90675B47F128,0xA95D531B5064870E,0x7BEBC372C21BBD4B,0xB84D28FC8D6C7A11,0x4CFFF1D15B6CABFA,0xD3DAD0D2690DBAE1,0x23702EC78865640D,0xA96D7BD38023F80F,0xE9CB647ADA3767AC,0x1A201D106,0x6C260C1C670D7DE0,0x23002B24AB5C3E2B,0x782BFD65FCEF3D52,0x53A4D555887C638C,0xFF4923AE3DD57EFB,0xF120D0E2BBD349C0,0xDD57FA606CADD763,0xE1E06588FA641A3D,0x4154A2F5AAC27E,0x184C6F366,0xE6A3D01EE30B54AA,0xE9B5B3EA26A82FAF,0xA04BE460886C3EBE,0xFB80A6C826C94C3D,0xB1FD0B0A0F3C1187,0xBD30CA8AF255E5FB,0x9B2F65DB9E546AD5,0xBF95D12BA5F45717,0x3FC13BF1CC6659CA,0x1C7DB53E3,0x809DD430859960F,0x81B827D12AC4A5C8,0xA0254D697C35CE5E,0x7AED4D7A3FBDC1E8,0xC0F9AD8187BED4E,0x58AE9681015C9D97,0xED110981DDD18E25,0xC93F91BBC08EA4AE,0x594810D6B01159D5,0x24D987917,0x926EF5B21A091241,0xB02D33CC1183B883,0x3F0EDDC5F2556DBC,0xC13BAE76E6D057BD,0x11A82AF6A5AA3084,0xA26F037D4FA8708F,0xE8BDB2FF2E505C66,0x916BF0B029370239,0x966A43FDF3698E5B,0x97A8CB4D,0x66F8A967E6726022,0x20720E158A9C2368,0x337DCB7D922B0B65,0x51CA7E4C60E660D2,0x3B62DEF3C3EFE2E,0xF1B753DF65F4BBB7,0x84DCBCBF5F1E2E2A,0xBE5459F472A87E37,0x6B441597E6011ABA,0xEF52DBA9,0x4076007F68463369,0x78F13F40D0EB77C1,0x6D1F0C2E39E92917,0x54BEC25E28E572F5,0x14B2B375839429B1,0x1DAFD44F8698622D,0xD8E739633E3BF348,0xD48CC96C11F67920,0xD22FEF6F6FD69FF1,0x65C8789F,0x15F806646BA9A842,0x1748963527F077CE,0x681BC0C4491E7F50,0x710DC8284EA13C34,0xB65B23762F02BDFA,0xFAD2FCD01D5BBEC1,0x46817069686113DA,0x18AA2AEB2060E624,0xE744B933114311E7,0x172577325,0xFD1625BCF32B2EAD,0xA7BE9BE579A37D70,0x5D1A714F33BEE43E,0xAC3E784214232108,0x27C01E225FC68A3A,0x2751D4FEB56F4CCB,0xFF1A33E88F58912D,0x4207AF45B78F99CE,0x58B1B66038C5AADC,0x18013C8D4,0xA68E0422B95BEAF9,0x7A9E4E87B561443B,0x973CA58834B328A9,0xDC7B96A435EF68C4,0x63D501EAE237D86F,0x2CF9000498CD2D70,0x69D64EAB46D6B7D8,0x4673A4A732835223,0x5329E69C83C77491,0x12EC24B05,0x243D5654F963AB3C,0x20AB186E923EC5FA,0x6A6D805E19FDDB,0x8DDB0028ECBA56A,0x4EF7ECC22703BF7F,0x369F71B500BB115F,0x6962CD61A7D39ABE,0x8F38EFB9AE663A1C,0x2B6EFBA25D7A5F52,0xE8CD0730,0x4D799A942689E363,0x6819CDB77323FE62,0x4614D844A08FFDF4,0xA45B4BC9A891256A,0xA293A59C6FE9698F,0x324DC43A4BCC593A,0x8DE9E6144E94D5B5,0x240E257D9BD878D,0x630E2A7DF7622990,0xF2504B04,0x88CAAF76E0AA1B03,0xE6FC9769B8D67EBF,0xA53F40A833B65856,0x6CC9B21AB7FCDC75,0xFB6D4D2F4908C580,0x43C71D03BD42185C,0x21F65E05A69EE1D6,0xA2E6EF8C7E8DC184,0xEA8536A3CAB55109,0xC832557E,0xC88D31170D54846C,0x1355B12DE92A6247,0x835AE6429E0C2031,0xFE469AFAFE04E165,0xF12C46B4CFFFD10A,0x1C5A473F97897274,0xB1BF03B42C7ECE9C,0x724EB27A45A8FF33,0xFCECCD42F3FA323C,0x1CD14CA65,0xFDA1C1D99FBB63F4,0x93342E044BD67F99,0x6D8DA8CAC2968335,0x4675EC1691AE7600,0x6C3F490008CA876B,0x6420B07370B2B49B,0x38B9645BFBE8407D,0x529F88EE3AB66D9E,0x87870BA12A17EDBF,0x1D42A24C8,0xBB1B48DB83F71089,0x2135026AA0FEAC13,0xA289F58E49B8C583,0x8F60D6C6B519653,0xF55CEAEE0861E2D7,0x336E71EBFDCEEB1,0xB796312BE2A9B9AE,0x5434156D38FDE8AE,0xA9ED20EAAAE7B98,0x3ACA96EF,0x8BA5D86EBD191210,0xFBCC07436FCBD5FE,0x43410C99CF186EE7,0x7F70C5812E2B65FA,0xB402A27DA408A5F2,0xBFA5B2024E28BF1B,0x3C81EED6FDAB6C62,0x509BA05B16E3EF08,0x47484B13A260B58E,0x18D90CA66,0x67C44A4FF0996070,0xA50ED82E3211934A,0xB2080F19D20D44EA,0xA431170C935A64C7,0x2B8CD12F1B2BF960,0x98B1C0BFB3400513,0x1CEEBA13AF67E783,0xB3734602937DD6A0,0xA3746D9EA6369C72,0x11FA10BB0,0xBAB52EA309DDCA30,0x32584CFE743525A8,0xE60D3E8536E4C20C,0xA40402C0CB1200E,0x23BAC2891EEB4A2C,0x4FDBACA685C76D19,0x31205A9BC03D5738,0x1BAD997EB3F19BB6,0x46DE665235F14477,0x3A86109C,0x5DC2E1906F095E1C,0x57C885A736E39604,0xF0EEE778551AA972,0xFDDC984F391D9382,0x8959F3BB96EF762B,0x8C9CF82E33504FB2,0x4F055E8AF55363B1,0x4CF83FE4DC4E2323,0x97B78814F703BF76,0x93F9CA58,0xA34867695C4AD030,0x45817892906F0313,0x155731DAEE4234B7,0x282ED4C211097ABC,0xF521F7EDAFD5A551,0xCEB9C987F1BF88FD,0x2087679A3B0EE52B,0x9A1F5F7F785617F5,0x65629B5855BFB6EE,0x54691BA1,0xBA1387C08B75AA7D,0x24119EBF589FB223,0x8389519CCE03441,0xF4D13D7DD3C07D92,0x10AA90B2D9804FD8,0x58231A93D533E7F3,0xEE15C21CBD1BECD,0x267022476653F578,0xBEFB9EBA2D2B8CC0,0x14176F2F4,0x3480BF1BB3F64157,0xF21CA102C997537D,0x80C9194B82139BC9,0x947F5257ED4D857C,0x2337C519FA9A4C8E,0x3FDAE5A2AD7C8BFB,0x73E703B81472CBA1,0x22CCB325A63AA93,0x391EB8264DB7580E,0x99A1377,0x8E6EFD0ACC775AA9,0xCB66667133CA247E,0x89A4DE507E2FD6C0,0x8D76C46A4B7B715,0xB21E97C98FAA7C66,0xE73FC4501C6209DB,0x6C8ED34E3E38C0A,0xECFB7C8A48EF267D,0x56BC25CD311C719A,0x24853CA78,0x1C94C74DB46993B0,0x2A7DE142287C21E5,0x516A26E88BE870E9,0x18A4CBFB2BFB0872,0x86542002869C8B4F,0x2B3B40C4FE9EA35A,0xC66548F14CEBD033,0x71901C6C9693B566,0x6D0B7418D42FA356,0x3DC9BD2F,0x15ADB6CF678F21A4,0x61D9BB2BE13AEA6B,0x1124E2228FCDBB44,0x50FAA02271F8F7C8,0xADD7FEEAEAF8BDFC,0xFAFBDE1F83EFF00B,0xA0CC4D8E10E7F175,0xC78035886E52C01A,0xED2F87BDC2BEB5B0,0x144DF5A2D,0x12890B0E90721867,0xDF0313BFA330A527,0x739F44BF5B3F6EDC,0x294BA6FBF033AE4F,0xF2C496E534D693C6,0x60A37BDA2AA35726,0x10F009476E2352D7,0x9C4C449AD6F3F59A,0xFB2B2FC08107B3C3,0xC8C3AA97,0x60D961C76613631A,0x17DEEEF71606C5FE,0xCEE42B41D0EBDA5B,0x569F67F8CF96396A,0x276F1D23AE78DC82,0x326FCACDFCCE2817,0xA02115C2BD591B8E,0x5DDDBF1675812FA6,0xB426E9267909112C,0x48BB6958,0xB7C980CC0A34AD28,0x31430F0BC0E18A7C,0xA820342C18F3F3E8,0xBD6A8439EB11424F,0xEE754E3E969921FA,0x93686A375496F84B,0x4180D12D658D695E,0x3BE7FE0B23972964,0x37FF0A86EF6A41A4,0xE367D92B,0x462FE752E7742ED1,0x10BBC38DF0A27BA,0x5EA7E872D3DEEC7E,0x4EFBCF9AF7E59C13,0x91F3F0D0118E07FD,0x16C50D693AD25B57,0x17844280A0C2E5E5,0xB9F34C6CDDCBD961,0xB5FB33FF54EF25A,0x160B7747D,0x3A67DB8E151C81AD,0x97D95B0EFF087570,0xCC64245AD1F2152C,0xCDE1916D09568CB2,0x65C1D38B9F077879,0x34E08664E0D26C38,0x9A931DD58CA60386,0x4CCDD86E6FE1C9C5,0xFF41D1AE2CB25BB5,0x35E8DA82,0xDC405D17440CCC6C,0xA7229FF36D299D31,0x2CF11A8A268DB0B0,0x14870083EE60B725,0x2421842009AB05BF,0xD9C39080ABF750D3,0xAA662B99E288C8B5,0xCD357CBFFAE74A1E,0xB8B07816DBCEB155,0x91BF2710,0x98E71DF990BA0D2E,0xF6413731C57E3DE1,0x85F44B1CFE96633E,0x33F7D44C81BC48EC,0x189B83930ABC0019,0x6EF9C549E390681C,0x3D5096797A300291,0x58AEC41AC23191FD,0x3B606046B1DB0C54,0x6913C2AA,0xD35F5517D5BAEBF9,0x41601F8D6E15CB6,0xF731771F294678F4,0xAF322ED2B5430D72,0x80470153F4C78467,0x71AB395CEF251FAE,0x469BDCADE4764BCC,0xD4E289BD2EFED2F5,0xB96B3991FE99D8E5,0x17099EDA7,0x2D603565A87A934C,0xD537C96BAD07F68A,0x119102B9954FF86B,0x3BE0B5525D6F4FCB,0x48483840600682B,0x378925B8A80F9D28,0x64DBEF5E2F3DDCE4,0x14BA986B95BAFA14,0xD8BD4985540E8950,0x13A90410B,0x9958ED85BC3D6AFF,0xE2B0045C8DC63F5A,0xE372BD57CEFF862B,0x758DC66A48E2ECA,0x3A3614A35950690F,0x3FB30BDCB06150A1,0xC53BDCC7B1DECCE4,0xBC2CDA4A258F1311,0x3EE52487001314DC,0x240854AB,0xF11FFAEFC2C5754E,0xB05753F87D104E0A,0x7838ADB85D872F7E,0x500A234793627667,0x36D5C0DBE87BE6D1,0xE9F313454C0CCBB5,0x9DA2099DFF3D950E,0x3C56922781C32ED6,0xE2CFE45D30EC0A7,0x44963CB4,0xCBCA4E66F0A40FF9,0x704017A58468F3C5,0x47B64FD6D51107C7,0xED32E5633C979CDB,0xB097A1545DBBC3EE,0xA90E0E59372DAE78,0x31168F382B1C4DC3,0x29A9F831CB09C007,0x8F13231B6BB947B6,0xE7AB088,0x53654213B67215EB,0xD1F7270345EB3FC0,0x99B9292D12E1F0E9,0xC2A702C8A84E587D,0xC03DF6E88A63D50F,0x3A1AF4FB8C0060AF,0x371EF5637CB5F25B,0xCA0AD3C7DEF6D8FA,0xF49400116A5348BB,0x56251B73,0x7F7AC6C098C85CDC,0x73E7C8902F6BC1A4,0x2EBDD5EDE265904C,0x4038B846BFEFAC27,0x974A871C849721B3,0x9DE3256AE589B484,0x165A62E285D8AA13,0xD20062FE7E49BC89,0xB0DE250A0A4B23BF,0xB845FE09,0x4936E5B4C8E231E4,0xF3C15A4F209AD4C3,0xDC299DEDB1C4D97C,0x8F0087D3CE3E5EB0,0x74367D28594B268E,0x1318FF9BC8B89D1F,0x2BD9505A283C2801,0xBD7D93B1B31B120E,0xD08FCF4DFFAF0C2D,0x3FD6AED5,0x4ACC6F09801D67C5,0x3A4F2167DF1563D3,0x5C45F6E80DB37C11,0xE4806E723CC226C5,0x794980BE19406F9A,0xABFF39E4D477F514,0x4B67CB1504E6FCD8,0xACFC6945D68FC0A2,0xB88180F2B4996182,0x234135CC,0x848C0A18F775DA07,0x25A59E1A0647860C,0xF9D94BD1C9EC7F3,0xE0820940780117DA,0xD111137F193C40C8,0x1F77D5DB35276956,0xCD48B2638D58840F,0x4D6E9A3D9BA0C1B,0x9C5555D3400EBC82,0x278423361,0x1BB147C3DBD1D2C1,0x2A08D211441BE939,0x623212CF7441B5C7,0x701EE93B9620E66A,0xF938C0C7A5BA4FEA,0xE699C9AFACE4AD64,0xC80EE87E3991AE2A,0xEC31350CDD2FA1D2,0x37F52366020CD9C5,0x1F3385BBF,0x2A497B0CC913FB45,0xB676F5119BACCDCB,0xF3692890CD07326F,0x75096F5AE014DC6C,0x223E38F5DDF7DD03,0x16345C88141521CD,0x105268DBEA926E84,0x32E9BDFFECEEFFE,0xAB1783CA3D3FF91F,0x10672154B,0x95B759B4AE1052C2,0x516E7B1519E9573F,0x73034AD32CED5DD0,0xF3DE665F38CB23BF,0xB0000322F5B98481,0xB0ACAFA65C9B138D,0xA26E2E7B1AE79E25,0x2394E5794F989E7E,0x2F034123B4CDA1D6,0x14FD19229,0xBDFB00328B8C687E,0xC4571C233BC1972D,0x8E19A30809743ECB,0xE06D7E11E5C2CF7C,0xEB88A0532B09FF58,0xE863A8B9428414D3,0x9224A44FD7D13F24,0x1611A5A74B5D731A,0xCB421AEABCFCE6F6,0x2A07AE17,0xF44D492FC31E007A,0x9FE0D353D3C53F6D,0xB12728D87CB0AA98,0x2BD133B3EBB43001,0xC489082C42E172F2,0xD8C0CD64D380A148,0xA0788E6E025A33D2,0x865F00D2E88498E9,0x2413B5DA2A19722D,0x1CCB4D625,0x2D494B476295F036,0x3EE995ED9004C49A,0x7DE8A8F581CE6BD4,0x8F70B7DA92056BCD,0xC8CFFEC01C0256C,0xC51DC5C6D4F6881B,0xE30B17AFDAF5B342,0xC5CBDF933E23130D,0x7E81AA1CEA17257F,0x339846C7,0x977D72267CEA5FF2,0x41A7894E63C7414E,0x7B2B6666DF132175,0x86CA6CB27BD12C50,0xD84AF2E27F6B28D8,0x69CF4CE27FF9A072,0x600ECE9B7036815E,0x12B72622CE3216B5,0x313D7D7331F26854,0x19F9C0D70,0x862F65396A514F34,0x4840743A8E5F65EA,0xAA84F73D803AAE18,0x2BCE5B46F0A902D,0x2AAE320CCFCB96A7,0x749EB9D84C5C828A,0x1BB2FD5FAF8367D3,0xE2CC277CFBF55DEC,0x5B6E3067A44F5616,0xEDEA4E13,0x18E5EFC1A8EA103,0x432A22864BE0C5B,0x85016A0FCFFE2759,0xA5642DDEFAF43CCD,0x4C542B6E55CB18D9,0xE357698E59345988,0x771E53095C3F975E,0xAAF6AAB5C2BF9BCA,0x54F2933B5F4DCE40,0x179D06510,0xF00C3F6EDAF263AC,0x591E98FD3438B732,0xB956B2E4B5DF80E9,0x1C4AB8247CA83CB5,0xA1489A08B775D771,0x9F2B2DFAF8D248C4,0xBE290C1D1DC985AD,0xEFBBADF877215B7E,0x901EF491BDBD638D,0x2C63E967,0x9899896189B1A291,0xF0E6383ADB5A0F82,0x626217BFBF7DDB99,0xD36164BC77AF2C6E,0x27F8140ADC7D2E19,0xADF650C005BC3CE7,0xED54CAE1CABD6953,0x50E148D77525D3C4,0xB5326D39C0DD538B,0x1A6BEBBE,0x255369342A536561,0x88FDEF43B3D9D049,0xFFBC361A2ED35D2A,0x3EFA94109E281315,0x7E8036B259241989,0x6CA5B50F006AA0B2,0x59E466B6D94AD0D4,0x4B906F685DBE7662,0xBBBFD606A91EC50F,0x3D39CA94,0x986F7A4445DB5B8B,0xE7E01FA030DC74F8,0xE1ADC184AE57F695,0x9BCA0938107E433,0x3642CA3CC8B3B7A9,0x54C806FDAC577ADF,0x70E6BA60AEBC00F9,0xBE6631D4FFBA0831,0x6686630A5F0CA1C2,0x13497B778,0xB9CB9F5B2B790526,0x21191833DC6F757D,0xBB3846E13C7E0EA9,0x4B7B45511A8FC691,0x81699C0C7585BA9F,0x1B3496FC2EE81674,0xAF17FCC6D202E843,0x25C2CF154C98CC61,0x36E6E628D01A41D3,0x248F0454,0x9DDA89E4E84C9D97,0xE6A68C77B6CF5267,0x5A5483268112204D,0xFA61B8A192A18228,0xE023DD2264B2A6F0,0xC73FCE4539C2AD48,0x247BF4938785A93E,0xF9D4C24B3E5032BA,0xD91542A7A488C1E5,0x4D774D46,0x746CCC498D08917D,0x2C59D8A567E504A2,0x213D288C3E518E68,0x3D2FCFD5A2A4AECD,0x20DA39DA9BAFDD8B,0xC44FD6AE5213EE8,0x68EA47810EB0E734,0x4B6DEBA4C7F537A9,0x14586631977F2FD1,0x279BDF7FC,0x85B9D67BF4D8CB99,0x5EF4859E3695F5AF,0x36F3779ADA770284,0xCFA37ADB3D1F554C,0xD5369C5ECC6C7697,0x262D3287F42F4249,0x7D8B768727222DB7,0x2DB447BE244EB583,0x4340874FBAE5444F,0xB3946DF8,0xD1EEE6D20D00115D,0xCE2A1DA00882EDC1,0xE71D7865B790379D,0x9A24B9CD31C8251F,0x8C71955F90833CC2,0x4DC27A8C815D34CC,0x6A2560365AB95975,0xAD33E9900E533F70,0xB90AF5802E25DA1C,0x1E6482D1F,0x2540BE9855234C76,0x62B46316B75B711E,0x676DE7BC361CDADB,0x3D4D4E484C4F018F,0x8D777D942F6A2E35,0x8F506EB1A501D91D,0x5EC36981BD826092,0xE74758036F301D81,0x2CE8053F5547869A,0x6C62DFE5,0x70FF4F476A31E4D3,0xADD42E274D832AD5,0x2C50FF5D804E19CB,0x24D21CCB27D9D122,0xD3CCD6D25DD09F6D,0xB7E78C1B11E5674C,0x1BD983823CBBA267,0x4C85148456C721FA,0x5C0026631373A649,0x19E2AB34,0xA6DACB7309A4057C,0x41DF48A6E3537E57,0x1C52B96DDD10A616,0x2E2B22C396B6DBAA,0x367B9C73F0FD79CD,0x3B95CF6FEE965E3F,0x33AFEA02D36194C3,0x2479936E1E57EFD3,0x5A695FED11258A02,0xC131F7D7,0x90DFC9E0B72E3EAF,0xB4C176F61AFE0524,0x3969280B7192F785,0xA4576AF580E4322B,0xB2F12583B3681869,0x1C13CCBDD4F2D264,0xAA0D2016D800A1DC,0x73B2399FAD4219DE,0x1E0F88C1E420698F,0x8660D8F2,0x1C25D8CFF4A9DC4E,0xDDBE202C6B841DB,0xB23BF4EEE5446E3D,0xAE52E8BCE6AE6484,0x6BE8B5F180D2F79F,0x1932F29FBA38A566,0xDD6D9C6F0A1C52D1,0x7924FAD567A5AE89,0x4EA4E84B4DED6A85,0x9BECDC2C,0x82CE1157704A0090,0x14A13491656F2620,0x7046DB437D8DFC7C,0x7035E7680B39BC9C,0x374EE3248BC79777,0x8761824E17939EB6,0xD939733AC92A6702,0xE2DBA1D2F3C99D4C,0xBE6592AE78AE39C,0x154244624,0x7739F29723B9AF48,0x3F3C0E39D5746A7B,0x834635AACB27085E,0x97E076333566DD2,0x2E4EEF93E314FDDD,0x9CDE843EFE5830BB,0xAA2C3A46EFE7FF5,0x138512C9EF10DB45,0x7DEF82DA76B59EDF,0x295AFFED,0xC7899495F6393C8D,0xFE7B809AB25DEF4E,0x5E4046A8CDE9D9D4,0xB73F539083AA4913,0xFD046A5CC8251902,0xA5DC7FAE116C0AC8,0x8E1EFDA2CB3D8B2E,0x199AE604FE8A7DB5,0xAF42863022ADBE24,0x206E375F5,0x4D81249CF7F85601,0x83B0476734362D83,0x98B901DA60FB62E9,0x7B9AEB7D345E93D4,0xE09DC5E49B1993A1,0x9FA940F0686AEEB7,0xF35A5278B1A5CF00,0x160765F08F96481D,0x93AB3BDBB357F626,0x1D4AEEB8B,0x3B5A532C0EE10F55,0xF02F313A0338E724,0x1F94176AD5C466BD,0x1BE5DE8D14BAE512,0x7821ED2A7034DC4F,0x90C622A4CF87581F,0xB30C5BB8B9330A38,0x9D55F7B2FF538373,0xB1F1C279E35FE795,0x23A56F249,0xF35C92F4D9007ED,0xF3700F652878716E,0xC12541A4D7A423B6,0x2910B5DDDE0EB187,0x48E503CB54660F07,0xCCEB44C69F88707,0xC2B78C8CEF2BA1EE,0x933C05FF75F00837,0x3C797274FECF718,0x20F0B47B6,0xF66EDB1156205C0D,0x966CAA560887679C,0xA31DAF3C3DF8BC4D,0x9F5E3A7F0F01D53C,0x2D713C2085329A73,0xDE96F5AE364A30B4,0x475E4D219371C33,0x4D53278030FAE7B8,0xB05239F990A38323,0xF23158F,0x402A560E85613ACE,0x686E0A095CCC86A0,0x6290B1ADFBA9DDDE,0xEFFCF433B69C0610,0xC485CF4FA46B3806,0x48E07B7CFD04BEA1,0x3764AB669F12C56C,0xC89E507BFAB079B0,0xC712B7CA16AEF6E7,0x172AC7865,0xA7573ADB7090340E,0x5D6D67238F880792,0xF677388A67A5B4C0,0x95932B69A64BFA03,0x98F2C4C0C7B99BDC,0x9703FABFC5E45FCD,0x6BCDD457A3967E91,0x8506CCA09D1B704F,0xF70E0FE5F6CF0F61,0x7EAFE731,0xC726D038D061230,0xB77BEC1C0478B18C,0x3AB490FC9B2A84D5,0x90A2E25B6D666FB1,0xC4A8C96F66F46FFF,0x2757EDAB5D2822E2,0x7015FF7CB251EB82,0x2FC030DD3F24C9C2,0xB2462DD10DAE3A5,0x256FAF63B,0xC236A7E3252C43A5,0xE7CCA650D5B24D6E,0xA9CDD57A63791F74,0x8F3DABADEA3F4BA9,0xE0D83DC6FE5BCFBD,0x8AF0FE263CBE328B,0x4FCA57592788224F,0xF70FCBBF02170553,0x4F971E12BAF52B23,0xA216214B,0x2B288F630361D064,0xCC2022864ED292F,0x410B23B9C0B12FC7,0x84814CF25155D75C,0xFA0FBDC4646749F8,0x60160B182E6C7224,0xF2A91FAFD37E37AA,0xA1925882B22DE6CD,0xA4DE71AF2654658C,0x55B61D9A,0x98CF8CEB668F0DE9,0x9D16642AEB3D909A,0x3FDCF3D93279D3C8,0x691BAFC06285EB11,0x4755DFC33481A55D,0x5527E63E7C0120AC,0x1C5625397D80223D,0xEF8CFBF2C513A7DA,0xE18F05454E2BBBB6,0xFE5BEB97,0xF90A174F618A6B9E,0xE975E69C7C72EE8D,0xB963F01998A9C004,0xFE6E9F11E2E6FADF,0x75CF3D037C85B6CB,0x629C5C7E8F99ECDF,0xF43C3216CF065CDF,0x5C508F3FF0D91518,0x67B7AF1CD1D2F990,0x2124A7231,0xF377D154F404873B,0xC1F6DD0A76DCEFE2,0xBF949BE4B218699E,0x8435057F0C7B5706,0x872C8F455E31673,0x674EC6E465FA59C2,0x4404F2FFFD308B81,0x2DDA01D1DC028EF,0x1260E03D450DF455,0x21240A55,0x5472070EFC715203,0x7D738DCF665B36C2,0xEC3143ED93B5895F,0x361062AC583D4459,0x1660B2B0087BE466,0xD372E82E14605117,0xA96FD4E14BDBF0C9,0xF04CA13D1F5E1744,0xD20CF6ECB12D522F,0x1E95A1EA1,0x5FE4FF3FFF795952,0xF01955F72FD5E701,0x28BFB67BF6D496A5,0x9FDE8DBA419EA179,0x599B2F163C9C9076,0x9A581F7EE338A735,0x78587D58055094AB,0x5DC07D0D55A9AF90,0x5D7748EEC6852B41,0x182A1357,0x638904E0E1CF37CE,0x16EFF7AF68FB82B3,0x66A88236B51E98C0,0x36DE76BEB85F203C,0x569D5CC76ED768C4,0x7AF25E0B46E8B450,0xD6A218B6EB4E7AC9,0x7326147C58A26EC1,0x8E5DC9DE131435D9,0x14B31A9,0xDAC0E8380908B63A,0x5990441893A7D6EE,0x8B8A23EFC15700E0,0x13329C5C400555A,0x7EEB5023AB0454D,0x2E41C60C2DBF72E8,0x5913C8D6331948E7,0x984E09B1C57A29BE,0x9A1A751C2C060F19,0x217801A5E,0x94D318ABBCBDD8F9,0xA5648A0C3726119C,0xCB5FA299B431662F,0x8799E4E5D1B27FBE,0xEA8EB37A61D372B8,0x86BB3A252F63D01E,0x9A1C5CC9ACF33DD6,0xDD05ECBCD5A07B24,0x4415D39643085ED1,0xD34C8394,0xB1554ADC15C9174B,0x6EDB4971FD54A538,0xC6BE1165E7387A8C,0x8CCD8B4B78A1CDD0,0xD8EF5AECA5F22348,0xA3B0A233DD1BA741,0x7211BCD8D5DEA775,0x5700AE08DA0B36A,0x6A577624347DE8DD,0xEB8CD759,0x915629B1CED0D7EB,0x589B08E8DACD490,0x9DD43C4CEAF12E5D,0xE2B3CB04CCAB8323,0x9C95104D3B9C6B3D,0x601E469C6C371C6F,0x4E8FA24911103586,0xD197F90B905A7394,0x50C7D63FDC48E60A,0x14E8B933B,0x3A583396F419095,0xCB3476342223CA87,0xBDEE3C6F663EB236,0x5EF32C0B85222A82,0x4FF97C8A9AFFEA20,0xE12F0677CB2BCAE7,0x7460EF183065A789,0x6C13C11CF5A42318,0xAF693F093C173544,0x24DB96804,0xDE0B001083646DDF,0x602BCEAB67B5288C,0x88677A418335DECF,0x10A39FB35FE84273,0x59DC4CAFE82FE933,0x5F5C59D871F74543,0xC6FDD5DCCA300AD2,0x8F53939F040DEB50,0x7CF2644C7D2C2CC3,0x1EF440AE5,0x9817769C3F517CDB,0x4438C532E8230AF8,0x1DCD3292A67AA03A,0x584EA2137B4054A5,0xFC0F2EB73A94B348,0x4352188333A4E9DA,0x2BC5B13A95932E79,0x68FB878BB2EA0253,0xA3CF7E7E20FA9501,0x95416F7D,0xF017EBA6CD97D319,0x82AD602D1065683B,0xB9815739E084CF81,0xE0159AFF99BA9628,0x577432647D910A1C,0xDA31BA06C9569C72,0x9D682929B3D9507E,0x44968B01C23771BB,0xA1C5F66636AA7D20,0x5AD43B0E,0x3053E3653CCCB02F,0x2002D3154310BBB1,0x22956936B540CE4C,0x609EFFA320E5C806,0x441B0B55D7605CE2,0xEC7888478D798191,0xD9FFCDAE797E30F5,0x519871BD1A448AB3,0xF64000964D74AC11,0xB0FE683F,0xB4581570BC445B36,0x3EE96F7737919FAA,0x78FCA28959C695AB,0xEF4AE57E1E04651A,0xD6DE27FCC4B4B5E2,0x3D2F6F57B24AD04,0xCB02368E4E975533,0x28BBA7B524EACE7F,0x29D79C7815E75940,0x7718EE74,0x76258F7AC012BE29,0xFF5F500010DF2C72,0x78A64EF49BA3C64A,0xB16899E998F0B102,0x44A55F2026A05894,0x1AA13DA4D44AAAB5,0xD4E3A700DD4E0671,0xD7D4F77EBBB6C0E,0xDDBE7610537BE080,0xAF3F8A37,0xE7045D7EA83ED2CC,0xD21F5F62CC099D86,0xE72C2749FB3796AE,0x7790AC17EDDB5BA6,0xA3A0701F73EE12F1,0x7E9A849B7367C880,0xB33073BD05938147,0xAF34ACB5F0CB9666,0xE86FCA38E7E63AEF,0x11CE99CF2,0xFEBC0F546BD5A840,0x20FF8B7FCDC347AF,0x489561553DA6A52C,0x6222D7D71F11D56A,0x11CE25FAD8902F37,0xAF35AB3257933F31,0xDF55AA1541AF1BF3,0x47C5A39C7D77EA40,0x75CC2108FC31F983,0x253BC6250,0xD4A3162B76BFD0B7,0xF2F90A8A53B10158,0x2E9306CE349304E7,0x914929D53998FFC,0xEDCF4DBB2AC90F95,0x7893C6A1216E4B98,0xF30A55EC3D15B9DF,0x4609D60E7520FCCE,0x52E9E7BB73B262,0xDF225A45,0xB2607796686D8D8A,0xA1DB40182196A3A5,0xC3355C05E39D6350,0x855664DCC57B0098,0x2641892D11A547FC,0x97C7A291DD312272,0x618E2A2A1F4C218D,0x218E10D29D3C268E,0xBFDAAE240AB39D88,0x111F386E5,0xEA7B28CD23E0B0AC,0x896E053ED41872E9,0xDD9A29EF60611A30,0xE27FB01FBE8040D2,0x2ABF29173628F6BD,0xF44650EA6B52D803,0xD7BDC76E1AF60EA3,0xF7F10CF24CF950B1,0xBA78C1D3C56A426C,0x6C5CB70,0x1185D626E75EE159,0xE78F782DA9A9A7BB,0xC4DE9F34437C6D86,0xEB621E83101AE0FE,0x7A289DCDA8F5E67F,0xF727F7C8C07AC311,0xB6B54E6E41BFC127,0xD92EFF7175B461E4,0x8ADD03A25EB0DF99,0xE416C2B8,0x9570A536B6637F3D,0xCFF01F2340A3E16B,0xCC521BECB248850B,0x71202EDCDD2067B9,0x6AE53A5D52B4A061,0x7F387B63126C72C4,0xA094B34B2611F4FD,0xAB153B4FAD36AD44,0x799182B1B31D6B2E,0x83DEBA50,0xE7E88B3FAA277C45,0x8E39287234E09E6A,0x1F0103C3CCC874D2,0x1C115CE8F9E53B2,0x51E6005B5ABFD630,0x80DB47BE65F98358,0x7EF4FB0BCB2BF038,0x72CD7AF4F72BB1B7,0x4900C4DF3F2A9428,0x75F6A073,0xB7E1F5A03C525CE9,0x59EA89D70533AF23,0x53505928C24D5052,0x35B0642B45DD8286,0x1634D2AFDF4EC90,0xA04100EF438C795E,0xE571828DC4A2676F,0x4068C7D807E9E577,0x973CBC66D5C34313,0x15EB54B7F,0xB4805F9B540AB78E,0xAA28CD8EC1E780D2,0xB55702D54CEE9D61,0x561C67C79DBF2C35,0x95BA1070DAA6F66D,0x1141BB72209ABEA6,0x357729DBE87A1758,0xE4EEB640329B04E1,0xE0E92774C142BFAE,0x1AD638468,0x12381A0BB7883685,0xACBD8A6DA4A8A18D,0xA58F2B639E0BDBA,0xAE39C515E09A89A3,0xE38907F4D7605413,0xFEDBB90DB11B3D18,0x8B8F46B5AA642673,0x4D15D27E13DA4EBB,0x622D4304B86DFCD9,0x25D3E8FA3,0xCE4BE816ABA61D64,0xB6A1D42AE27C9E69,0x1DA1014A5A6575AE,0xA603F18D19B3AF90,0x44D3689B35B98A0E,0x3943644583304D0D,0x126916A786325E2B,0x2CD15CA524FC36E9,0x2DB117B22479F379,0xA1484386,0xB1089848464D1CAA,0x4421C6C272E024B6,0x35C0C69ECD92BE5,0x9529D8A6C8A2CF83,0x4ED6B1D7412ECDC8,0xDBF1FAA4DD2F8C25,0xF0A50130473CB7FA,0x5C215CAACCA479E9,0xA4D3D05DDD899BE3,0x224BD978D,0xB04EA22AC680EDDD,0x6ADB9E1E99660D63,0x12AA1797377BEC6E,0xCF388139A80BD5A4,0xA492A83581BFDE6F,0x6EC39FE67EE2671D,0x6A32D3E6431463F9,0xD934B2E18876A206,0x4EB5C19296CFAB18,0x54002835,0xEB94289D22394E1B,0x3D37FA538E07D8E8,0x6E74E9269E73A998,0x8321335C55F59BA7,0x5F30362E251208DF,0x41CC1C2DEBC28EE,0x97E82056C7BFDFA0,0x3D12E196C54D493A,0xF5939DF25E0D464D,0x6E6D2783,0x4301BAF299686923,0x314BCAF148823BB5,0xA3BD5FD9302C7109,0x4147BB1B96E91C2E,0xC7E028DB6FAADB1D,0x250AB75B407AABFC,0xBD36A1E958B70D3B,0xB0B92F2433265DFF,0x56D7B0269399C53C,0x157F06B51,0x583918278C284FB4,0x13D594F71B85F2C5,0xA7E56306C069610E,0x8754573E8AC1A527,0x8CE94258BCA8A51F,0x1EDD3242DD0EB58C,0x859AB7AF714D79ED,0x3981A3D843977950,0x276EA7A519E588B1,0x15662D682,0xEAFCCDD2DD016695,0xCC340582D7A188DA,0xE65FD6D7E68DE8F7,0x83D09E1292F1DC10,0x3FB47F1B5483A53F,0xE02BEC4B583D386A,0xD0F75DC61AFB38CA,0x8BD2B6ED7550B45,0x3E02693CF0D21FF5,0xA5929503,0xECFD84B427B16C09,0x79E6072CD3220D74,0x8FA5A1FB002D9A5F,0x2EFCDBB7444F7D1B,0x553363D498F014AF,0x7C83C6286F7E2B8D,0x3D95BF6765F33770,0xBBCEFC077299FA1A,0x3992DB7CCF90EE50,0x2579E7D94,0x82244114049DB4B1,0x643689F9AB553ED3,0x2A49348F7717EB3E,0x5C1FCF2B75425064,0x17AFC3FD2C5B0278,0x33D77BBCA435A5A5,0xDDFD4EDCAD6B5A85,0xA9118D4F9CB48DCD,0xD33BA4318269B30C,0x190BB5ECF,0xA7D417E44AAC3935,0xD3E48411E20B0ECD,0x254D4DD980BF7E54,0x9EEDC5923B191F09,0x1C6DFE3B76228CEA,0xF4AF1D2D4F0F239D,0x468A7900D018FBC4,0xA01B9D5C38D10612,0x9C32ED1D3CA04B6C,0x24906EE22,0x566AB5C6A9248A02,0xCC8EF03AD46C9940,0x3330D6FDF9D38841,0xF3B087B907F60293,0xD62F75A8AD645A44,0x5563F0E2E66B0AC9,0x5A66BF8712466A56,0xF0FAD0698EED7440,0xCFEE864AD9232148,0x10F0AFD5,0x3A0116D6C655E9D9,0xB01297BFB7870AF1,0x320917861F3DF956,0x927A89130D72E22B,0xBBD1EBD7D275CBC1,0xF1AB8CF2E3AC86A,0x1629D3C2CFCB8580,0x2C2C669E971E7D01,0xF76037783A907B82,0x170653C62,0xBBA2BB6B82A2F98D,0xF143E4E5E444CFE2,0xDE6692DCEE8627F9,0x99592E427DC05EA3,0xE3889C116BC63E46,0x7D91D6DF8BB79400,0xC4AB954689E931BF,0x474125DFB7027F79,0x3A97C45C9C703713,0x1A879F4C8,0x31BEC3E0D9AFAE6E,0x2FC6E36ECFCD891B,0xD030A5A5725163DD,0x7C2EAEF98FB8D5E2,0x2B340FA54D9D98B0,0x3D5CA68FD5DCBB9D,0xFF3AE4217196605C,0x19E3C87F6916616C,0xE9F2E8E420B7D0AF,0x1A97C60CF,0xCFCF105E0AFB4015,0x9BD6C4553830AD9C,0x15AFC6FFC758CD77,0x1935D126082D85FE,0x86AF197C7C0FE6E5,0x42B56CE896BFE1F7,0x2198A706D9B1308C,0x1050E64061B14B6D,0x6A9AB2FD7EE7B80D,0xE0015D73,0x3EEBC2F31AE910D1,0x658A6C6C232B5EB0,0x6D848587CE4443D9,0x5E7CBB27933717B0,0xDF88C542724A4198,0x7EEB13E3822C9BB5,0x133C21903AD01BD6,0xCCBA22DBD72FD03A,0xD87E065A4E41B3B0,0x1F6A69F2D,0x2BFE531927E95346,0x546756E651346710,0x2E96E3E80414D28F,0x2D2B45EA3B283AA6,0xA8547A78C6737B35,0xF4F4C36611688376,0x6BDD71D9E0CC2252,0x3DB63870D006F185,0x6D27913D594CB777,0x11E8B8454,0x25DE6C37A0A03449,0x47C9116DA81007C5,0x96597AB54A2C4B85,0x378B31A6FF4CD8CC,0xB1417B47A61F706A,0x6D35C37B1DD54E92,0x775B63C98DB484F4,0x4FA80BA8532702EB,0xB2A0CA2CBB1E159F,0x14DAA19E,0xA369B8E76C7E9B11,0xDB1EEC8DD0881B1A,0xCC6519979CCCB52A,0x416A99DB016196E0,0x301F874DD49CF78,0x56654B8E854F33AA,0xA02C1CAC0BF70D00,0x7D2771C0CED5CFEB,0xFDEF5C7FED61E267,0x13E41628,0x438C73A77B35F2D7,0xD472852FBC11C9A4,0xB0D471942E02E6CF,0x1282E33D2F12FA54,0x7545AA73288D6127,0xA2D07A12D8D2AB03,0x88C94C0AFB6DB0B0,0xBE3AE028035D4682,0xB3DBC487ED0DA89C,0x914328FF,0xDF2CA6AA3B69134B,0x46612199B7DAC3B8,0x7E3AC5A2F98B9D44,0x2A798F2BB219C90A,0x1D86212DB2187A9C,0x12701A8F269AA5DF,0x2AA954505A175CBB,0xBEF4FD02F8F4A172,0xE922E1F84D14F45C,0x1323A8708,0xE7D162F044622F79,0x506E51F3FDB594A,0x8445C717AAC5DB25,0x7138C7F3D15A8271,0x84ECD2966D59ED5F,0x81772F08D056A48D,0x204E4899459EF3D1,0x4BA0CB99B4D9D545,0xCF0925DBF788BBBB,0x203FED31D,0x7E03F4CB3CF8C5F5,0x6DDAEC02617B6CCD,0x67E95A1BCA07CDC3,0xE774638BF4DDBF7,0xF242F5CEB837A57,0x427B9CA61EBFCAFF,0xA7FADBC04C43821F,0xDD03B8BFC6A74EA5,0x1D95492B0D29CAC7,0x2571EBB58,0x4C331A744D935A59,0x2D000DB245919E2F,0x98FF2FEBBC76CF0D,0x916CE39CBC506147,0x9555BFB897D08109,0xDBD86E1696251161,0x7E81B59898507EB0,0x3C0C5D007587FEDB,0x893B4B5AE385ADE6,0x3D7B5D01,0x6CA7BC2EB3990EE7,0xBC99C0A09CDB4293,0xDDBC34A06116D86C,0xB3C3B26F4F8E33DC,0xFF681A6F1CBBE13E,0x1AF5E483728E3E44,0x7AEC98D774AA5739,0xCCC689D9A7807C38,0x19D77B68CD8CFA9F,0x11720A5C,0xFD755EBFA95D4375,0x671F01E048963C3A,0xD369FAB949FEA3E7,0x638BAE53C0BCEC9E,0xE66C5B928EC0A13B,0x892E78E0808E013E,0x942252F9FA37F84C,0x35FE98EA7C81D77,0xBAEC50B935BF4720,0x18B04055C,0x8C71049F194E0A2,0x5806241698370920,0xA670E670D5BDF22B,0x8A3AD1F192282C0F,0x498D9FCCC6942E15,0x3AD935C04A6D20BB,0xCD189F788F638C1E,0x350322449943341F,0x2183AFF88A47C988,0x3B0BC85,0xEDB72552BB3E24B3,0xA1C3EEB3D2FD7BB,0xD67E55DAC759C0E3,0x453A2BCBA45BA09C,0x20B27483AADF9BD7,0x559716587CAC3199,0xC414CA90737ABBF8,0xC36FA3B377EB4E1E,0xA0C72CBFFD330449,0x8E2AD071,0x55D3198A5F09C1EB,0xB7AAD3DCE26B510,0x633C2442A844CD03,0x9D9ED77C25D0BEB9,0x6947F9A805ED4211,0x853D0911DD3232BB,0xBA2FD4DDAC249066,0xCA179C6F3A23394F,0xB8E758B78EF7C035,0x1D0BC6675,0x489D70A4E82A35E7,0xF66BF14B4D25FD4B,0xF3D9DEAF4A3D595E,0x25FBEFFA41D8EBB3,0x1B843767E82D855F,0x27BF2C47B8DB4E2B,0x550C7AF12A5DAA4C,0xFBD2711C5BE6DBB5,0x6CED4CB618ED97E2,0x26B392280,0x2DC501BEC24A2291,0x5075B112EB3D7459,0x1A2B7EEBA5E3AC2C,0x920DCB372175DFCE,0x5E5B057620382BE5,0xE65B344AF7D4A745,0xF9997C3CFAB91187,0x5959D8D5108B285D,0x3CE67584F6237B76,0x1305E77E7,0xB20EB6CEC00FD965,0xEBEA628753BD9DD2,0x7C62112DFDE33306,0xB013E8B34028A58F,0x41F0C88E65A2A35D,0x6857EFEFB9E9BDE,0xAC34C5E6769212FB,0x1664219399C7333F,0xE1B25CBB6EB27A3D,0x11446FCDE,0xBD4B4EF33D522558,0x70302950B966929A,0xE672A215A57FB424,0x19E5765BD338F682,0xABAC846CD501B25D,0x91984B519B8E0788,0x35DDCABBBB40E630,0xEC4E8945CEE47407,0x2C5E31C896BDDD32,0x469CA450,0xC71F663F11E588FD,0xD60DA9D6C3C75FFE,0x40C39940805647F1,0xA75D3DB0EBA861FC,0x7CD3CAF06FEDE6AB,0xE16AC51FDD5A878C,0x4C41AEEC4F2580C7,0x85D965CCB4E60923,0x84307D85F25746FC,0x7EC704CC,0xFCC04CD298C8A92,0x5B765EF88438BD87,0x27C7914A6DAAE383,0x3FD26F9C7848F6F2,0x5221E5943F6A4F60,0x94087014DBF0A35C,0xB3EDACA0EDAD9AA,0x52E21539C1135527,0xE54E508317495889,0x1C66180BD,0xC052A4639FB00591,0x40FA45D7660546DD,0x7BF8451788EF7B5A,0x3EA477A856772372,0x15B9ADA0689AE347,0xF753D7BBA2C6F4AB,0x1ABD9A42682B1D94,0x29ECCAEA55915021,0x1044DC6DD9E1EB6C,0x6FEA61E1,0x55999E3CE7D8E5F6,0x6820FAF8D776148D,0xC792FC272090E7A4,0x5C47957B810779D,0x9A354EC7ECA035B5,0xB2684A0119ED14B5,0x7536A19242F17BC9,0xB86A71CD45C74ACE,0x54CD931DB9EBC970,0x22A73507F,0x7B76470CE20C4D5B,0xC6F0A1C5F536C564,0xE42CCF4D45F66690,0xF5533871E447D3F5,0x60CECAD0BFC5A152,0xBE5844B6BFF89FAD,0xF4214D94AACF7086,0xD391E9C5BD4519E,0x227718C56E5167DF,0x1E915B8DD,0xB36137380FD626CF,0x965B717E9BB6B71F,0x8060F4739EEBABBC,0xFF8BB75D23510F3F,0xFBBC6803DF81B614,0xB6C3033D60C521C2,0xADA7A8CE45998C33,0x4A939E74E849F640,0x259AB2A0EEAD00F8,0x28823E31,0xB06B8E6354083595,0xB55B85643F2E8D98,0x3B917BD90819855E,0x508F803E730154F6,0x9FACB208ED595CF2,0x5BC15C7361219B25,0xEF1789AEC3AC4769,0x2B3AE2CE96928B2D,0x67C35A8B41AB7229,0xD9F74B0A,0xEBF6B214714B3A3C,0xDDF756078DB6809C,0xAF0B1E40B9ADC627,0xB6DE4A9B05EFEA5,0xCB3BF7DC00BB5624,0xA69618CC72AF49C3,0x1B3A9274C8E3DD24,0xD529B5E4E326FE0B,0x45F77F6FE735AE48,0x165B1D8C6,0x703E9C96AEF853BA,0x2F84B3A0A783B3F2,0x3D9A6E2CE7135DAE,0xDF47831D9CFA8AD8,0xB3B5DEDA2E92E395,0x39EBE6CF50E21262,0xA4829947CAAF3402,0x725550257C4313CE,0xFF5A322E4E397AE,0x164B7168E,0xF18B5837129F8FC1,0xC33AF65B2A4DC8D1,0xB77F0A0DA50F0BFF,0x9014F2B6D3521422,0x9C9ED9D01261AF48,0xA495AD4E95FAFA8D,0x17891901610BA6BF,0xA9AE44E5076A3132,0x4B27769FF9E48633,0x222AC1A92,0x61F423747EF3B456,0xBA091AEDA0606A2C,0xA4C15AF335BFCA86,0xF4F957B0DD67BA59,0x528058749E552890,0xFDE542F3AFFD252D,0xD70D1D0A17496BEF,0xF4934A4F70F735EA,0x83368ADBA2C58E3,0x20A26F5D5,0xEB4C6FD4B2813A4D,0x15D99506824F72BC,0x6AD42340A490FB90,0x3BDEA876366E1D58,0xF93F00F70F5BA695,0x6B7BE75165E72978,0x7FDBC60272F3CB96,0x86E92E617E3A4A84,0xCC07295FC11F4CD3,0x233172430,0x62187E35643A20F2,0xE5C782A7591D8B2C,0x36EF89F64A6073B9,0xB859EDCC8CFE0684,0x407F4173AA70D160,0x7AD50637D09BCA3D,0xE78004D1B4A83A93,0x23B9D489FE2F534B,0x4261886EFAD903FD,0x1AFD4359D,0x7E2C95597FB28FB6,0x8EF31E42B5CA1483,0xF078B20DBAE8334F,0x8BE80E1E11DA1BD6,0xD1C18C4E6A45ECF8,0x4D71350761FD0C16,0x6CE69FDE27EAB33A,0x11EF5E236C302349,0x4FBFE23C1ACEA345,0x344BA264,0x28A29D92D1645827,0x2FD0183E45D2F2D8,0x2ABD0A0A9180C4A0,0x1ADE5F20F679B66E,0xA7963D45EBFADAE2,0xB54DF3DE465AE01B,0xAF09EC75533AA522,0xF93595F833B23E13,0x966C8D03FF661B7A,0x14DD35B74,0xE19BF615B593FB89,0x3C9085FF2898CC47,0x8B9F881240CD658B,0xDC56B9648F676FCB,0x34BAF9BAE39C0699,0x83B4632EF96BC46A,0x73C1EBD612BF1F17,0x7EB137DAF67D8922,0xFDE5D1A551DC3443,0x153EE21EE,0x3C2A9551B257C3AE,0xB9A760F6D90E60F2,0xA048B375F75C4942,0x8B2E086E86EE1BCD,0x53E9C294958C2805,0xCF7F32253E681F7,0x9CBE3B5E9C995F30,0x2D0760F250F6E35,0x24A4E78259DF1875,0x6487EA06,0x917C094B0D728B2B,0xA27BC7A6F645950D,0xE28E434B494E1968,0x97DDF498662370FE,0x9DF9CB3EF128A421,0x7E7550DA717C24AF,0x506B31F5B8447FA5,0xFE8842C0FBE4A03E,0xF14B7A69BD8DD3C9,0x28E7F851,0x4BC8FB94CFA2F8B,0x8F5285EE6F7560F9,0xB31D5FBEAFB9550C,0xF5E082930900375E,0x539708E86E867197,0x8003F1CEDC178C08,0x91B6A36BA1FF26F0,0x249C25CC2D981BB6,0x22FF5C586FF9F441,0x7EADAED6,0x260CA93C5DC7483F,0xA9920E24B2CDF599,0x739E075261D565E5,0x8DE23E4D25793789,0x69A649F4089F3E82,0x42BBA5C142F02251,0x5FAB58AA637890A7,0x7A24ACF190CEF1F4,0x3B82D398C0064F0E,0x6896FA79,0x882B4C31873A5874,0x1F4104B3B8E2D91,0xF573F32A4F8AEF5C,0x331D0949978268D8,0x9E140CC8D4250796,0x3057C39AE137720A,0x2917E21ECC53B18,0x3E2BFE46BA7AE4B,0xC96132C492BA59A2,0xFAF9338C,0xA9720831D7A41134,0xAEA7D012440E0B4A,0xF279C91D2AE4D098,0x49DBAA29E3574C48,0x3BD2566A071C84F,0x2A364876448F141B,0x71A72DECEE0FA417,0x92AF749BAA6F5DAC,0xCB880EEDF4B4751D,0x202D4C2C4,0xCA54D690685B1C4C,0x4A34E23493BA7EE,0x93B837B9371620E7,0xA1E1CC163DB56EB1,0xC24B34D68B104A9C,0x36AC1BE32B3DBAFF,0x821458ED0CDB689E,0x68BEBD54CA310827,0x9B23A5799FD0DC9,0x116ED021,0x7667B428E4D60686,0xF1EAE71C50FE1B06,0x8A40921DBDA36E3,0x8F4A910167A27741,0xCB51867668D182C8,0x784880EB792FE03C,0xB9FBD72EDDAA2A4D,0xDD803BB8ABF68D7D,0xFC9AECBF07DDC97C,0xCC6E763E,0x14863E4418952A91,0xD4A45C7DCC37FE4D,0x4D7755DDFFE23446,0x1A7A637FF25027DB,0xFF6D1EBCEA6E1810,0x92B49BAD2E86C3F,0x835EB98E29B7FA59,0xCB574258DE36ABF0,0x413EA0B7BA567117,0x7F6C3B0E,0x4BE6C3283CE6AC4D,0xA94627B950A45AE2,0x179103608B47CD10,0x8AC83055B51EA41,0x55D914429C3F20B1,0x98B453A620CD5E5E,0x1247A265143A2B51,0xB9594636E6B6D16B,0x83E13A92B92A2837,0x251532386,0x30022CC8386DE959,0xB344E65CAFCB014A,0x463AA6359F272141,0xB73A31C350995C32,0xFD02026A5F29F6CE,0x7AD1BA0212876046,0xF4C5BA1EEC14FB32,0x1D5F6E54C04678D,0x72E26D1F8E95C162,0xA9E8EF93,0xC22600BCAD15218D,0x6E2D53702642AB44,0xD7CDD79530F3DF26,0x6BAD84C6CB885847,0x158608A71877EB2B,0xE03EA154B4AFB9FD,0xA2F95FAAF82FCFA4,0x674A67BA1214305B,0xCB70BB9B9957FA31,0x2447FD556,0xC5660A4F1482579B,0xF499374FFF9A537B,0xBAB1A90DCF5395F7,0x8DFFDEE4713F1DC8,0x3906516D2FE7118C,0xF58AB0E5780C3E9E,0x53831843280BD8DE,0xE9C752A347E05DF3,0x9763B840906276B7,0x260780437,0xE3AB10460805863E,0x3933D1B6BBAF6FD1,0x6BEDE1DDE4F10716,0x795D2AA6A1C24053,0x11C4E0D391A03098,0xFB209927FF28238C,0xFE646C0D56753394,0xD782E1A1124DA571,0xD380CEF1BC59BC35,0x1649BC38B,0xAEF1A473E8D6AF71,0x2D54D91C49D35401,0x37EA470706EA3481,0xFC19E9C787BB0EE6,0x4D50D907700B8688,0x2CC9A143C9DA9328,0x57BF198FB36C353E,0x9925A1A3273D70F7,0xC0686C90612E2FC0,0x85A15794,0xDB890BC9BF5CE000,0xB818B37B67F1D272,0x5BC0782350684135,0x84B3AC52F60C8F8E,0x426AECE8A14F1C8D,0x4E2A4DD14336D96D,0x16E513D6297B9398,0xAE1D6292D84921DB,0xD59D1E768E5757DF,0x1B817754D,0x8D4BE12E13FF8B81,0x6BC66651F1D2EDA2,0x4D78D0AAEFE102A1,0xFF7D8E4851DD817B,0xF93CFBA274F81A41,0x96CCCD33E121CE6D,0x9994BA9005E572DC,0x933CC18D1DF5A965,0xF4B33FF77303FCC9,0x5C55922D,0x12ED65195491EDCD,0xE6C65F1A0F8B6620,0x87B8DA977DB36445,0x7F2F6042217009FF,0xF45DF6E2AE957A02,0x64B299032BC08258,0x8384FDD53FFA1AB,0xDE8DBC90F49C0368,0xC21AAA1BB44E5735,0x1633C2C65,0xDE973A1FF192640A,0x147B39E9CA6F3CD7,0xC29AA822C5198AC2,0x503C9EA82A4CF322,0xCECDD0DE9EDCCF6D,0x843B9B0622B04460,0xDD92FD0620EE5641,0xFF4D54694DCF47A5,0xDADCF01DE7090247,0xB5022DD0,0xAC15A721B294FCBB,0xBBEFCA5AD3A31D0F,0x9B7BC6730787C547,0x3896EBD3D8FC32A8,0xFDA59812102A0E9D,0xC0DD08282D5C71ED,0xDD25D818E7670648,0xB067CA579D6A996C,0xFD61393E3CE4141F,0x17692C936,0x1AE452C23E775AC3,0x8526498975B0FD31,0x38192130747BE899,0xC740AC38D44C203C,0xA78590B6F6735AD9,0x4225D9C1E9CF1669,0x6B26C3B150BDDCAA,0x659BFD9D237257FA,0xFA4E314378CE9030,0x20E4A2306,0x5810663D5230F785,0xF2A31AC6798C8FB1,0xC2F18F105D9914BB,0xFAEDB4CA7E4E149A,0x6C716C8C60552D96,0x54E77DF574DDE267,0x36C79120B311F5E9,0x1FFBC25AA4F072D8,0xF44FDDC5C2E4A1A5,0xF607AE42,0xE4FD017B3E501212,0xE310AF14DA3ED629,0xDC98610A524D4CDA,0xE34D986CA5D87CB0,0x404CF682CBF6AC01,0x3920FFCE4749BA89,0x2ACCD290562C19E7,0x48B8390434481257,0xEDAC4D7BDDE481E5,0x110ADF003,0x5CA51198BA7666D4,0xC0D4B2316A2D62AB,0xB52A28108CD961C4,0x3C15F8377FA35902,0xDEF5FE964B954C31,0xB046A4CD868BACD3,0x78E74446662E401D,0x9447C95FE2DF4EC5,0x8A26D7D81E9F7213,0x24A9FAECF,0xE03389F1E56F4366,0xD82F6F817779FDC7,0xD3C6FEA644711395,0xF2DA0BD6EB846371,0x7EB32AB1881CF6E1,0x732C073EAD0E8FBE,0xECECBACE3AE8BF97,0xC196BE8DC5FCCF81,0xE7D6BEE3B407E117,0x1F692F304,0x8665AB82587A7ADD,0x5A0BA83197A44ACD,0x5D6C282DDD8EA0B1,0x948BD0CBC2C8DC90,0xE6BD07BC6A263EC3,0xE121A9AFBFCEEE34,0x22FF5864FB4B295F,0xB4F76ABA7F88761B,0xD74428F8756835B1,0xD80E75B,0xD5E0D62595446708,0xE79143959CD9E9FB,0x7A5034C74D6E8740,0x21EAA0AB82C7EC6C,0x956C9B022898B1EE,0xCC963D03237DE2D3,0x74788C867D40CE4B,0x4C824F99B8D5B505,0xE83F2EAA7781994F,0x1D4415D63,0x2F0F338C8823AFD,0x5EC8D6C78C7B14EE,0x5875EE456FE58AB5,0xD6BD05FD6A836419,0x446C18F054326983,0x9D0E0794F4E354D8,0xC9FB846F147AF568,0x70B6CB6096E394D9,0x3E1372A0CBB9F486,0x234B7D08B,0xACB774431BCCFFDB,0x56DCA85162ECFB34,0x298C438821F64E29,0xC5AD051D0D3E5B9B,0xD116025CE352691C,0x50DCC4D8D69B6D69,0xE6702E781FCEF5D7,0x629D1B291559734F,0x3A899AEF0A05665A,0x1CB5E853F,0xB0DBFC877157A07F,0x3A68CD4E2A687810,0x176F0517510FDEB3,0x9C03BB7781E1261B,0xDDA1679E185B7994,0xFEAFE202B839BB8D,0x537536DFE459AC7B,0x6E4BBCEEA53C25F7,0xFD1CFF53AEC89FF,0x20DA5A59C,0x5AE6BC2226528515,0x539257872CF2857A,0x6581287807275024,0x476AD8A3A4CF51ED,0x64BE558997AC332A,0x52843CC74DBCA055,0xA17B0CFB22151E46,0x80682935D1F1CD62,0x20941DA5963459CB,0x24423B7DC,0x1990D092CCAE75B0,0xFAC3D82CB7B1FC5A,0x793493E20138F38C,0x897E9E4323205333,0xB8E0E27D51FEDFD0,0x8369769D2339FD3E,0xC57D945B0340B497,0xF0790F281809B3BE,0xFEAB403A5996181,0x17DFCE782,0x86EE254AF2499AFC,0xE62798E1CEB95B2F,0xEA0AC48CFA7857CE,0xE48C2BBDE1F00037,0x5339009C3F856DFA,0x74F46160B12A6586,0x6DB20612F73099D2,0xA6E3E327F7D3B5ED,0x6E1AB997B29FEE90,0xDF7AF311,0x29F4BA2518AED87C,0x6BB9C7674EB29844,0x2B785741AB10664D,0xC7147D686A470589,0x6EFA7F672C6B45F9,0x9D7D60CF05B703E7,0xD73839951C9DF2B5,0xC4AABD7F5A057618,0xE6F9A5B0F8EDDEA9,0x211932ACC,0xF9C9011508E611BA,0xC6F32A864583CEF,0x3BE9C0FD5618C132,0x2D6875C2A781D29E,0x8718E6F86EAC5774,0xC14C90450E0A01D1,0xED0102BF31018E70,0x785FADC6399D66BD,0x250C469C7E2036A8,0x28E23A0,0x87EDB3E205B0D6B3,0x3D5FDB6E78B6694,0x10F9BE0474D655DA,0x58748501771B5F95,0xCB4ABD9998C27CE8,0x78687132356DE757,0x30AC4B96FB267999,0xAC5F3289868FD24E,0xFC10BB3812EA8850,0x28AE189C,0x61251C683776B241,0x513CE338C24816FF,0xFEAECB382A5D684E,0x3BA7CEE70091A627,0x18E98FB290F6FB4A,0x9FC768F5038F3F1C,0xFFC7B445D38E9C1B,0xA8DE68602CF1BAB,0x93B859B88F025B92,0x2483CBC7,0x5FDEC77383428DB1,0x6FD78722DC161B62,0x405435C809E2F473,0xCB39EE234DF179AA,0x37D959226614BE38,0xFAC811E924D944B,0x3F6E2185F595BF4D,0xA186D900F26A861D,0x8B03C83A4A41DBC0,0x1223DAFD3,0xA5597B9D90195B1F,0x1A2AB2A2DB02375,0x78BF455DCF15E507,0xA1717663ECC79662,0xBE5583D1E270C03B,0x59DF7DF3F428883E,0xD27793AE3A3A8C95,0xA7E23285DDB9BE21,0x9FDD924702E2C0E1,0xC7311626,0x8A9EA6A244ECFC88,0x514BBC1989CF49FD,0xB3F83A3C4D1FD447,0xB29660FF079572AF,0xE4C4789257489943,0x92A164354CA92EE,0xEA2A61237A20A5CA,0x3709230D22B3F389,0xEC037DD9065EB657,0xE959AA58,0x482F4F6EBEE8B494,0xC6865CA41785ADCB,0x24ACAD02DD4EE34F,0xDA6D8424A6D5CCAD,0x48D5C6E4F594DF67,0x6E50AF0EA22C5353,0x37D87548042064CA,0xBFD303AB5819F950,0x3FD504A9BFA40FEC,0x2571C38BF,0xC7CC3078AB94BA08,0x7E205ECB3741E285,0xD618D319B73E9DA,0x89C31F9155AAF0F5,0x45B344B5388620AF,0xDFF5050248D923B,0x5DAB751F68CDA680,0x6F6FAC7276304794,0x77E22C52577A8A3,0x262823AAC,0xDD622BE0BA1618DB,0x38AA7624D56A7CD6,0x9C9381E134F640BE,0xE6D0832CD957194D,0xA8A9B70667C5B08C,0x1AC7E7EEA26D1D1A,0x5ABBD82DC98B6FA3,0x2D7D0CD4602DF74A,0xD5C451A3E50418CC,0x2388E6EEE,0xE245E046D682C8D3,0xC77516AF1F505CE9,0x4638B065EF758F00,0xE04C553141B062F9,0xE96C3AF18FAAD483,0x5013892BD4E51AF3,0x587AC4D05CD876DB,0x8B87624EEAD66E40,0x51CC69AE77DDBF74,0x218B1C415,0x1DFBF97A00DCB673,0x3A5A99C0E373A9A9,0xB61FA49D0326AEED,0x10CB67CF9EF837FB,0x3D1425986AF6D03A,0xE43BF134C561C6A,0x33160AEE71345B18,0x18A44BAAEB29D168,0x9AD9690A8457E782,0x1D71F57C5,0x677FCD84230306D0,0x39606CBCC4080673,0x456D8002C627C987,0xF585A948A5058559,0x2180628972ED1C8,0x9F1DE96ED839381E,0xCA1E5D052DB4E504,0xD4D3C65E8AD1A738,0xA711A74B2A545625,0x5F3953E1,0x502EFBF996C13FA6,0x81A5C07BE8B225EA,0x5581413C06C2FF27,0x9769D90DBF3FDA92,0x65924558ABF42D02,0xAB027FED8A7D232,0x213A12E2E0FF1EC,0x3C9D5B6ECC24E8E8,0x8F0CDEAEF8B3E51A,0xA11FBD7A,0xA30186E7944FF426,0x4F379E977E877D20,0x6500F99C0706F259,0x78FDA65FED3A6D2C,0x3E055607B1BF4CE,0x92CE769464258793,0xE2590B1FF870D2FF,0x46C9087632AA048E,0x13BCB385A88F80F2,0x9E966588,0xA3031CD83C62CD2B,0x1282D2879BBBEBAE,0xDEC95DA146AFCFE2,0xAD143641971AD4FA,0xDC9C429F51D68231,0x21D1B8233FDC8BA2,0xB6B1F7C02C08CF36,0x9A6FA3082CEF125A,0x712D3D229CEA247F,0x2FA9919C,0x357884BF4BF096DB,0xE1FAC83C13A272B7,0xA73BC4828AEB98FE,0x97AE5EDCF55E6287,0xBB6E056358EC2962,0x5A5081F0BFD1ED7E,0xF0A9CCEBAFE04E5B,0x4B05C23085C0064E,0x54A9D2D2782B821C,0x1DCCBC0F1,0x8EC1EBE05627B965,0x78B03A2830CDA1DF,0x5596113A0195CD81,0x3C82A8DF2CAAE30D,0x588B6CE442044641,0xAA4E8E06F97945F5,0xC50C1082B49771C5,0x8774C138BCBFCA61,0x57E7B1421D8985F7,0x1A5BA8DE0,0xB8FF3D5BAD2C1BC9,0xA484ACB0D6578849,0xE813D8CF2A272B8E,0xFADC568EA52B346A,0xC94403DF88849367,0x45F0B7ECD571A14,0xAD3899293C46E827,0xB9553A3F2D1CC256,0xA853C8DB0F7B70EB,0xEF587FB,0x43567B4C22A31F2B,0xA26C5CCCF8DC73A1,0x4F377B190228E1A6,0xE6E453C93A5DDF7E,0xAD9A6C964428395E,0x6912C6BD381A444F,0x16A24F31E3589783,0xAE9F271508CDA9A8,0x3E65CD23DA315873,0x888EA896,0xE55CA374E633E92E,0x312B90ED099D68A7,0x84F6BA4CC28E7355,0x4520F17938171BB0,0x47855D0552A22548,0x38E62630894EB25F,0x8400914CBC44C252,0x57EF1CAE148563CE,0x61F6D0B8A339758E,0x26BC4D215,0xE7CD67A6EF5E7F9E,0x238C560A1828D8EA,0x92ED693E44825B7D,0x36776982E725F21E,0x68CF8EE1CA3AD724,0xDDF894D706A5C0FF,0x7A943B54A5574696,0xD89F4741D54A79DA,0x7E624513753D406B,0x258FCED54,0x2EE9FC875E3115FC,0x6FBCC3C0770FC529,0xDBEEFF726B44716E,0x86D61BDC7CBCAE84,0xFBDC88B6F934F900,0x5161AB4FF7D323EE,0x668729331088F005,0x7F050B85EF0CA86,0xC2B03FFAADEA9142,0x20683E26C,0xF998F16D97D293A8,0x34823FCCC8815C91,0xAB7E26C89337885C,0x2F6E5FD3B740E6AE,0x9252DD0D09BD38D2,0x9374FB2834C8BA90,0x3083BD53082A806,0x7A496ED94FCCE228,0x77F88B895D9BB635,0x508CF918,0xF39DEE86D3B0013C,0xB49F45D11C536356,0xB0EE9A0D4EA0445F,0xD75C8E9D37364072,0x2ACFDB7C27580A2E,0x657F9257ED3B0B37,0x373464B8B14A8648,0xAF1FD1CBF826FABD,0x27CA23A77B1C8A7E,0xC562CFE,0xEA10CFB32DD7D261,0x83378D0869EFEFDB,0xF9DF28D3C4555C95,0x83F664C07575ED23,0x27B1A3ED0B75C8C0,0xA215D861CB3CE160,0xE0036640DCBC1193,0xD4C01F7D9D7A5A71,0x68E18E0428734788,0x671BB0CB,0xBF9204FAF3952B0C,0x1F5EE8EC2C77B25D,0x4299286725F96D16,0x1C60FBA65C0D24C,0x7466E7D9EF88C661,0x3A49F4F0642B39FA,0x50D08E35B7A2E2EE,0x196360BE912BFFD1,0xE99606B22E2DF68,0x2733150B5,0xEDF9EE79A90011EA,0x9202BC739DF63128,0xEDA47F24A9B80B83,0x7E7C06EC536D2F28,0xE17DB4D462C05758,0x8F7A04BDC65ED224,0xF7E09034AED09540,0x19F2893620AEEDCD,0x7F6CA1913E0EBC0C,0x980C3DF4,0xDDC98616C06DDE53,0x305D1BD73EA0C02E,0x75FB946D02539CF5,0x539080D7691F5AF9,0xF192740772C46292,0x27EDCA79AA960355,0x7087A827E6EE6B65,0x12B01125EDDD06BB,0x79C62A6D23AA5A47,0x236B4C7E0,0x8B8B9DFADD8E8F06,0x6D809F63E4EB90F1,0xA0DA51F3F73A7AAB,0x364761BD4316D9B2,0xFA0F8DF9A80A1F9B,0x59FB0E8786C8F767,0x66909DE0E8909889,0x60BA3B401A51F0C4,0x2B5A7031A6AF6D64,0x1E3C4702B,0x398FA2C6E8FD1229,0xCCC7F0A53EB832E0,0xEFDDA3CE82AF7294,0xEFB423E36AFAB30E,0x23DC9F7006831BF3,0x7CEE5FA98DC7B283,0x6AF586366CEE456A,0xEC946EC52EE19D54,0xA79B7F00DF7E05DE,0x11E73876C,0xE1E8D8E01BF8D5C5,0xA3F21F836539B35D,0x882FDE7C666FE4FD,0x1FDA39EC656F2EDC,0x298250EA4146D87A,0x701B9EC8BF5DCF45,0x8AF20F0DF5230665,0x8131E91A13E9910D,0x4516226C5253937F,0x17B148925,0xDDFB6702ED96CDFB,0xB68F78C1809CF946,0xBEAA5E92DDA40AA2,0x4DA235CDBE92BA68,0x3B684A95C253A533,0xFF8FAA4205BCC3A,0x5DFF9C9BFB04A26B,0xDACD1BBEE314E08C,0x177E4DA3D1F428BE,0x94891F6A,0xF3D0B5F6C63D0C23,0x5AE0DD7D97C56C9E,0x26E59D7AA7508113,0x7BC49A0C393D699,0x8E7CA1576CCF179,0x24FBBC66F1778D96,0xE93BBD343207633E,0x68C740370FEF4F69,0xE3A76E5E4D9290D8,0x86E5D959,0xEAAF6EF6F7A5C694,0xAC3567830EAB0FF,0x496304304CBFACF1,0x310B2558BB1C1740,0xD53FA7123633715D,0x69F087A07ABFEE61,0x2912062F24E9D423,0xB4B896BFF585D1EF,0x36D5E9E5CF45A7CA,0x163DE2281,0x885832F7C4093856,0xEBD8A66C90CF8F42,0xB9E460E509142D5F,0x83564C3DC0F69E82,0x9B00F657702677BC,0x2E830F9F207B0C41,0x801E1A09A857F2EE,0x26DBA6EB579510FF,0xFFF003E72D530DDC,0x1059CCDA7,0xE87D67136CF758C,0x132ED2F477E919B0,0xEB417C954C2AB523,0xD270B2BF7AE3A5B4,0x9AE03360717724D7,0x14876A179417A04C,0x33357197DADB8977,0xA841320B9BA1EA2,0x4E56FBCE1A446B99,0x271AE1E2F,0xC29E8465FCCDC3CA,0x5C03A7D291BAA0D4,0xB6A7AC6DD74B2FD5,0x98478761F6464D79,0x1BF64921B73891A9,0x8876DDA4DC19AE52,0x3852FE097E2E4A50,0x336CE3231A7B499B,0x87B94B11DC16F879,0x16FD2C175,0xA2B9395D0D4471A3,0x49DFA6ABA7E8F1E4,0x1C0DAEB0F6E60A65,0x83205E1158EA41C1,0x6ADD536FEC646E,0x1B19D2605739807D,0xD8184729FD55108F,0x48AAC1C3CC7E36D7,0x387B0E62E26B0D58,0xC518BD77,0x383449F51C45E48B,0x7B5308AEC5E3CEAE,0x7EC6E2C209335ADF,0xFD1001963E764DE3,0x950785B6B6BEF754,0x59E0EE307561727F,0x520619FF7740793E,0x9892FAD8487746F9,0xDED3CE4F79091E84,0xBFBB4928,0xCEC573AE84577EA6,0xBDA4076D7AF264D,0x231D648107730B4B,0xDE7D0F38125D46BD,0xEB4BAA89E4430B9B,0xF3643CEFFFDDE962,0xA06382FB73663B17,0x5FB8496BBD8BDDF7,0x68979AC84771FF8F,0x1ED2AB640,0xEEC48989F3ECE10E,0xC9AC8DC650DBDE8,0xCDCF6A2898B4FA69,0x76E3BFCF6B02DFA0,0xE534011AEC616399,0x7191E3FFF9BC9660,0xD9B392D444E41B5C,0x218A0177F1B7B9B3,0xF35723674AC6432D,0x14643C080,0x6CAF7511A9933170,0x4FF9D71B46158BD7,0xF1AE32FC8C3C3367,0xF94D967C33D1565D,0x10D4BBA08F9FB2A6,0xA74ED1D5EBFB3BFF,0x139E3D9BC57B0506,0xA969632D635B856A,0xBA2F9C5168F87687,0x3E3B8423,0x1CF9A1A425B2639F,0x8F41C3021796116B,0xD50825AB27F4A96D,0x42988A0C2AD5B58D,0xF38DFE699DA0D6DA,0x891D404E0D3D233F,0x85355DAD72D47666,0xB54DEBE194739A3F,0x3CD49B63C4DCB17,0x193D9B808,0xB09BCCD844AAF1B0,0x794073F8A99053C8,0x9DE6953521D6E585,0x43D60A7CC7B18E63,0x32DED720AAAD25E8,0xB5D9EF37119C7FD9,0xDDF2EBF1C1D4F53D,0xA7B68A3A70DB63B2,0xBB0C0BAC522195C9,0x26BFB0B93,0xE994E1BE3B2058B0,0x87C350F93C6CA26,0x8A4F7252F63F90F,0xA17F7E435EBEE641,0x9BB1CFB8C5FA0340,0xBFE98DA511D79121,0xAB09A97F4ADBDA94,0x718C27374A975F7,0x6651832B8B6D2C7D,0x11BB16A45,0x43B287C819A3DA63,0xB039CA10697DFA40,0xDEE65BA8B5085E5D,0x948DD5AC03E6E1BF,0x3E045D2964CE833,0x93A3BE947985FDEF,0x3D6F68B7D06B3023,0xF66DC2BF5D7408BF,0x1F32115C6555986C,0x166ED9260,0x6BEEFE8C833D8B0E,0x57F5C34297152C0A,0xC48C491AF08CDFEF,0x206DA94C0370608D,0x4EAA7E641E9FFD70,0xA13BF84DC21FB088,0x7A4CF7A2837C2868,0x48E94459D15BEEC3,0xE366ACD1C2340D2C,0x11D525557,0x4AB95DE05373F97E,0x8BDE6739297ACF99,0xF5DBBDFE502DA920,0x5AB55DEFA0E5FED8,0xD61E0405118105CC,0xA98E4B242F0CA8A4,0x8AA8A25C9248DAA1,0xEBABFB8074FAEB0F,0x6A2B2735DD60EC90,0xC498F313,0x1FA18BEB8679C8D5,0xFF7D196312F05198,0x3401E5A88F84D7A0,0xA00FB8A4783B18A5,0xB5281CB52D5900D9,0xC1609DE6316DEEB1,0x7C955A1503A70994,0x96C49D61D6299716,0x696B81087C615030,0x625BE06F,0xDF166CAB608AD3DB,0x5E9B89887134CC76,0xE3EB626CEF779642,0xA9D8FDEB3908392F,0xBAC27FDC738F6A6B,0xD07E3345FA6FD6D9,0x5DB11D80795BE953,0xECF7E0FD11A337A8,0xEF537C4C5209A129,0x155004D58,0xA164AD7106443C2A,0x4DCD7AF1116B73BD,0x6DD5899046558CD9,0x54BE9E557060DB58,0xEA0DFABC4FA2607F,0xFC4174F54EEA8282,0x844FA6A299C738D,0x92E225A3DA7952FC,0x545382E11D539B4C,0x9C216B0D,0x61F0CBE7C91E356C,0x27645279B702F14,0xF32CC43C91353D42,0xA13DD81E5CC2A6B,0x3EDCBA4F72C35A4C,0xA8F53C99B4C0BA6D,0xC622F293A8120CB9,0xCBA545F7E244D0AF,0xA1788FC1DEE7B253,0x164787DBA,0x7C5BEA236F6EC2C3,0xDB18EDE01D4AD972,0x3A9B3197A1D59982,0xAF7D221FE5240DC6,0xA4DB19042CA03E31,0xA4062E4FE5EE91B0,0xBA95C149CE97BF17,0xDC9BD3A09CDD527F,0x2454A323198DCE1B,0x2A9CA361,0xAA0FFB8932237ABE,0xDAA54AECCA60B28E,0xA490E022147D975C,0x4CC812067663EAC,0x595E76FC582237DD,0xF69CF3E4A48DD105,0x565DFEA07D78D380,0x7DC7E805A7A22627,0x4313F6F0A5E13F83,0x20EC2F171,0x9E130C34155F6371,0x55AE351E3C05F9E1,0x5D1077C8522DF1DC,0x50E358AA322DE35F,0xCACD99CBF3C5E049,0x819A9D3B7DF722C1,0x6DFA327DD38F1E51,0x377EF3F10B6C4F86,0x66B10FAA8315F4D2,0x104192584,0x6E04124EB458BDB4,0x3B91FD1D3A9ABB,0x76DCF9F881FA6838,0x717504FC593841FC,0x26063107042E4FD,0x39A0D9809DF681B2,0xA6A982E7F1E1669A,0xF5CE0E8A3D95B98E,0xAFAEB0F1AC72126A,0x1CCEC3C02,0x5F904FCCAFC629AB,0xC92FC02A0C95D4ED,0x8DA456FED216F54E,0xEFE2C3DBD2E182E2,0xAB6D18ECDDE60A95,0x670CEF45D5F9524C,0xA548606F1D2D41AA,0xA6EF4CF9F06049F7,0xA580283616B26723,0x13A8BA03,0x8B2C87D19B1A955B,0x88FF59193DB46112,0x1698315C7168050E,0x63C0C8DC1054FA94,0xD7CE0EB6C4C76F23,0xAABDA684B9E61469,0x893EA9E48F095299,0xC05B3A776EE8F534,0xD727C10FB8FCF95,0x1B7CF601E,0xBD4D1B31DED57D33,0x823256E05C3F5247,0xC5528DB4C1E78E2C,0xB1546383E26FD5CE,0xB2B8AEB76536DC02,0xC7CA81EC72F37D7C,0xEA25DB03FD4839C3,0x54A7D2568A70A11F,0x34E6086040DACF23,0x1C79FEBAD,0x8F4F553CBFB92174,0x672B45D5CF22ADE,0x22697D81670B5DAD,0xFF89CF863C90F433,0x36D8E66381873FFE,0x5E4DA4C45A2F622A,0x360EF7820170C134,0xC713347341C0E306,0xC07B7BA2F27205E9,0x1F4A0CA05,0x2EF7D911F8BF0F8A,0xC7665AFC267A9AD0,0xEE5793F96DC762E3,0xD705C5E8136B253B,0x733D59D437DA019,0xD5D444292EA651B3,0xDE23EAC4359014B1,0xCB4C82BD2C3BD046,0x78132A97E2392FB,0x1EBD51BC3,0xCC60F8004AE3D60E,0xCC682C0168C86F37,0xADE04FFF03504FFA,0xF15992C072812B97,0x3BD35FE46DB4F969,0x144C3955617691B8,0x79D55B8F8D5E2060,0x1A96FA8B1E920638,0x3592BFACC5E2B764,0x72069703,0xA27A6665AF4BD4D1,0x2B43D30274E2C070,0x89864AD2AC4E530B,0xE20A1FB47EEC0628,0x96937706280C156C,0x75DD80D6DCF37092,0xC4F36D8748012F28,0x37895FE0800AC21E,0x875BB4AD01C27446,0x11AE6AE0E,0x6F9390A4A1F72772,0xA8A24B0CEDD77E9D,0xA3B0200BDDF1A76,0x5478FADEA21EE163,0x4C6408BF618E9E35,0xCF6E4D41EA0A246B,0xCE2B6349A36A0E93,0xCAD4BAE02716B563,0x7F5BC74336FD7C50,0x41B3CB66,0x72C80A20481946E0,0xD0DFB477F386A632,0x6822A27207AE954C,0x71239A07F75C67E6,0xFF71170191D4493B,0x68475FA477247920,0x30305665C67355FC,0xA7326D178C4BEC,0xB26A61F0342B6818,0x1E906DA7E,0x5FD8B203502CDD5E,0xF36C896B6FD43EE7,0xF2CC5E5A12D5A7C1,0xC1D97262164E0BBC,0xC06D6D65F766BC5A,0xD382EB5DAD89F71F,0x69C07E7F08464AF0,0x9F02B3D4705CF940,0x255027AA968C02CD,0x8860D440,0x362B41F488619357,0x63C041CB03EA2BD5,0xF1B19930629F4709,0x772B3C397D369F9F,0xC1F1F85EC7AA659D,0x9AE7F99ABFDAFB1F,0x33C58421FAA59251,0x6D487694A5C5249B,0xAB0C4FB49094EC9A,0x252E66283,0x52DB0EAE9968B7E7,0x1C82F09022F754EE,0x33AF624C00BADEFA,0xC8F875256D54B304,0xBF7698D1232A4393,0xA578DC585803C23E,0xE2172201430EC309,0x3B5A46C765F763CF,0xD6997853512BDF11,0x14FFF28CD,0x880012DBC6C597DB,0xA69F9446F033300B,0x768053970EEF77F1,0x1E25AF3F51E7081F,0x4B872AD2520F7317,0x3BEAD342780FD964,0x2FC1797C789BAD6F,0x37F42F027588B72C,0xEDC15F381B392347,0x26154F212,0xC6082C58A6D3ED3B,0x5D147EBDCBE40B0D,0xC31EC82E3AC5770A,0x4B093889AEE009D3,0x8891958A8D55A64F,0xEAB5F60E5FE2E343,0xC089BFEC8E83FB80,0xB4C2E62CF77CEC42,0x4E63735536EC333D,0x41CED785,0x5B839EC89CFD9865,0x9C6D3DADCBA34A39,0x476B53AA24C3844C,0x5068F3C9C455CAF5,0xB6FE584E47EFB2ED,0x2B0FFE91F3918F11,0xF773C87A7A8B176,0x3570EA7A4767A148,0x1AEB42EE1E1C052E,0x1A2744F94,0x370038E1F92F77E6,0x4ABFF3E8D6B18926,0xD8029AB0CFF699C2,0x45128ED6D5BA4B3,0x56EABAC84E3F585F,0x67356DCE1972CCEC,0x6091F34F806E835D,0xEA9FD37E90EFF3C2,0x77624DAA350680FF,0x25789BFAA,0x3094B8590CEFDF0A,0x576CC9E907D5DF7C,0x7839EE99535F7227,0xECED76039DD28018,0x3505EDBA7055C613,0xD190342315C08AE7,0x1A6D84CA49235A5B,0x7E16218B57B19968,0x821B78C8C806143A,0x2571A1193,0x206AA057A27D3DB2,0xCCD53F9DC973DEEF,0x72EBADC36EA21B92,0x20AEA158B1E027C2,0xBAAC221EB91AE303,0x56553C72418ADEC6,0x6A37ABEAF04CFD6,0x55D4A3A9C02EB08A,0xA4D8AC764DD0630F,0x21B131B08,0x252A2E46BBD2FE7A,0x71798157904A767F,0x95C91FA1B9F8B352,0xB8963918B7753630,0xBFEA2C32CFCF165A,0xCC9127B83E070E63,0x9BAFB98E121A6F74,0xB456ACC8FC2C7959,0x21CFC10D4E14E709,0x213A75406,0xACA8B18BBE87A86C,0xB4DB4373E8EA2A46,0x1294A11942D78E62,0x79E5318480A2976,0x4791899B7AB4E2A4,0xDC1A0C433B10CEFD,0xE0C1D93742E93BF5,0x39213468B6BB341B,0xF8776A9998465DF4,0x130889E7E,0x14FA1F40110C7597,0x50A60539B264F6A3,0xDE2E26DFE20515FF,0xC9F9BC6FE81D6BEA,0xC0AD3B10138870D2,0x68E8DF0005067FB8,0x41BED0643F966E0B,0x15FD52102B68E023,0xEAB42A68575880A0,0x4FE5DC44,0xFA617159FEC0A9E,0x4C3291B83046532B,0xCE293F104550CC9F,0xD25A1EFEE46248BE,0xDE3F642559574C57,0x4FCBFF2DA5E238B7,0xF5E55CAB8119882B,0xE29150ADB8BA21C4,0x85124CA84625E9CE,0x1B22677D0,0xCCF3245CAF88D583,0x187EABDE218648B4,0x5318B9C2060AEC5E,0x5B50F9014D972700,0x5F4104DEEB63881D,0x2B72EDD1014A265E,0x5BC080A7B761678B,0x9475FA7D27A9E842,0xC0AFFC98E633B898,0x314BABA5,0xC835F45C02674977,0xA353ABEC47F66A9C,0xDCD2CB88864C2391,0xFC318BCEBAC6FDD9,0x215D30A20425656F,0x2899AC77EDA44F5,0x59486BD16C41A0A5,0x70DFBC40F9567F5C,0x2D02D96D4CE135EC,0x13DCA7244,0xAD229BEE18DD380D,0x79DA791794F53867,0xECD956E9B0A04AC,0x923F1C813F05DB5,0x372B0178EA7C543B,0x4CF28D21F03BDBED,0x5B7E77176BED30D7,0xFCF880EEFA4E6230,0xC25240027BF1E862,0x16055E913,0x4A72094FD7B2FD9C,0xEAABB3020A80675,0xB05031AFA84B0501,0x90763F560F01E9A7,0xC045C3B8EBA9C5A,0x5D26BA922B84B790,0x2891E3D455C0FA73,0x3F9A277491577A82,0x48F1747A9DA61554,0xD8E60538,0xC5EEFF17B1CA0310,0x81CC7F19DA0C5E1F,0x21CF2964B35BB8F5,0x11A401CEC5317909,0xDA1F5072B73A059,0x49FEF5C431BD963A,0x444BC5E5124FDE32,0x1AF0EDE11ED4BE8F,0x8D8C7381020064EB,0x1F4D32CF1,0xCF9CC603727E3B1F,0x9867336AD39FA099,0xA4D1D98B422203E9,0x88090B36EACCC430,0xA7F8F69A0901CB3C,0xFF6A08E24B8B721D,0x2D1C073C933362BA,0xFEA58990A20E933C,0xEC6D4B23A88B6FE,0x237FE87B,0xECC818FC95E02C1D,0x5E0D7B8B491D7049,0xE895F741D55FDDA2,0xED5A77DD5B7E7DBA,0x412C50056B7774A8,0xB7FDA2ECAC5E98E0,0xDE23DA5AC7B2A862,0x71C3907EF50C8064,0x3A2398D176CC6C01,0x738C7983,0x30B1FAB96EF3BA4C,0xFFAB75521B5387C0,0xD8ACC26DA6FED1AF,0x244125DCF9423354,0xB161AF1197695107,0xD0DA70FD35C8C173,0xD123DF47C4A4053A,0xCBE0D886D950B72A,0x7CF40DF9F1532004,0x2758C64C1,0x6459213C0FD19CBF,0x1AEE37BD53EDA059,0x37805BA269D28CF2,0xF3C41E9BB5CFDCE9,0x76323871CAD9F01E,0x68D7A584AAA1A70D,0xC924E7C25C8DD7B2,0x3349D9757D52F925,0x86617FD2FA56149F,0x276CE68A1,0x5CD81A790330A8FE,0x13676D00B4417F4E,0xEF77154C24D6D89F,0x2C1599653761B6FD,0x7606B2B6FACB6016,0xACF3929EB01638DC,0x426E387C38988B6E,0xE478132180C64065,0x5012674EFC6942D8,0x1895BC9EA,0x7CC4582204FCD035,0xCE0A6EEA2DF34010,0xED5689036F70D67A,0xE05C33650EA91EE6,0x99E98EFACEDC5F6E,0xDAB8530A57A1B7EA,0xD5823DF7323567F,0xC4D7E669FDDC1F1E,0xA90DEF5CD5AEB92A,0xF10A6AE4,0xE1D16DE763DADFC,0x4A8DC3500A3D6510,0xBAD19C6E5EE84507,0xC307EA9C9F767FBA,0xD10314CF1B3133D6,0xFDB2167D225F4D20,0xE16AB95C76E3EACD,0xADFCE8EA7D42A70D,0xE50DA39150073ECC,0x8FA72A40,0xA35BFB5A23996923,0x9D05B6AE664F692F,0x74AD40B75E9BF0F,0xBA043C46730B9D7B,0x813D5CF4543676C5,0xD9D763DA3962B3FB,0x813191989C20C5F6,0x1D1C561E8612ED7A,0x221B7EE43BF1C3AC,0x12BB08DDA,0x5AC9CE8D88FB75C4,0x943F0A089BF33377,0x9D9C857ED30ADF52,0xD5CB7DA12FC7F9F6,0xEE27323D393B9700,0x618FE4860BB34DCB,0x37358A6C353D8A0C,0xE634FABE578495F6,0x320644544CFB6828,0x14E5EF53F,0x2026ACC5EE0F3849,0xAD0CC73FD08907A0,0x11AB3475CA40FB7F,0xE0A6F7C5C28F3B17,0xE52ACD32738BD229,0x8817B78392B9A10,0x9FC7BDA6A727AE4E,0xB6866AEB3985110B,0x3B91C108EF11FD3,0xE6E6FF13,0x542301620F95D112,0x9037D533CB38B384,0x989FDEF6BE6FDA5F,0x4B57BEF34DACCB73,0xCEA5B198D3EE6194,0xBA45B8EB56DFAD55,0x405E14C6080DE8F6,0x9CE688F35BE57DCE,0xB7129A638FA8B640,0x2725B7B1F,0xC08EBFBEE1721139,0xC33CD604BA48BA59,0xFC3096F8796A788C,0xA32B9692B924B52D,0x1D009476E44D837B,0xABCA63EB0414465D,0x5328CC14603E9F3B,0x4A2155559D59E075,0x923905D74BFBE19D,0x19E97B0A7,0x47CC9264E6BB9FE4,0x7A1940B70A31480F,0x8B6B94C51481966D,0x765C2697CAF008E,0x6D145D8DEAD7AC6C,0xD0B68592F0474C5D,0xA3D78600866536AC,0xA18D90953283A111,0xF9939CAEED65233B,0x7202E755,0x7EE495DC83DDD2BB,0x662097AE8685FA92,0x3CE37856E82737E3,0xA74D4CF3487DA9E8,0x1D344CFA0037852C,0x6FFCA08FE707ADE,0x1CC0FFFE7063FAF8,0xAB94846B39F8EFFA,0x5305AF0B49A06E9,0x16836582B,0x572E3AC9BC405496,0x6EA205FCB221F8EA,0xB81BB2442F30C904,0xD4A43DA6114104F,0xEFB0CEDFFD952648,0x46FDFB9798AF0299,0xA83CA7DB05156BAB,0x9FE3878358DE695A,0x34D28CD923DAAC87,0x16E719783,0x599A58E282FE5763,0xFDE2F8285F8FA94,0xDE6FDE12A0B2EAB8,0x817036F5F8EC2A5F,0x9E67459744B14660,0xE5B1E1F412E0BF77,0xEEB8AD26E469F724,0x13CB93A82D7A8682,0xFDD62F3513D1F4A6,0x5E078BE1,0x99E42008BF04DF80,0x395599BF4AB07703,0x12991528B621244F,0xEEF94FA3496CE305,0x1501F1914509DBDF,0xC9F3FD34E0516E35,0x16D7A94B153DE04E,0x88FEEF1D4FD242BA,0xC20C6F8203015316,0x1F67DB1E5,0x23BA0AB8AF1F6A4B,0x6448330CB3736213,0xB64DA3512B604C8D,0x6BFCD301AF40A895,0xD33D16871C4B8208,0x4B365F70DB08559D,0x9B9E1D37DB31D176,0x28F3C4D7CF998DFB,0xDD836E279BB2A40F,0x19C921566,0x89E08BF770BECE00,0xCDE8D682C94006DC,0x294F9D5249BADA79,0x3E413CEC71029EE6,0x4D30F34A2F0EC94C,0x12D6033C847CA65A,0x3DD12EA6F56F2E61,0xB776CD8F2A046A01,0x4E1E6EBD89346C41,0x9F036085,0x7A6D32C5C7E4BFBA,0x1BDD501300B95471,0x95BBA3F6E658243,0xEF806A9DFB969D24,0xBE08845A51B3AA0C,0x18FCAC9FE2EDDAB7,0x395E6F3287F26020,0xA435166EC184E91D,0x98553CF834C82939,0x2021635BE,0x4C869C51E7B0C6D2,0x27A5C4C1849626C1,0xD8782A05D6BF3326,0xA65E617122469E78,0x2AC1B8AC545E8615,0x22A3FE20936D94B,0x5084B17777FCFC70,0x6116B66756B20461,0x7E4ED58B93B49DB1,0x125FF360A,0xCFF92CAA46BF19B6,0x132AC6721E98D04,0x37BD23FB7565009,0xDD850CA051C06B70,0xD1F99DED3EB8DF79,0x7AE93A4950499D26,0xDD3B585287754F08,0xF383A744E54A75E4,0x375BD2C681157856,0xA5545BAE,0xEB518D0CDB1AE21D,0x7DCC400E108AC6D4,0xD87A640789EEED2B,0x4BCE5CEC56DEEFB1,0x99416A940D1BFACC,0x26E1DB71806B45F5,0x30B480A5ED4D005B,0xF48FF3DA1381C9EC,0x7ABC6D54E4516291,0xBD7DB2C7,0x78B47BFFBBFF8A07,0xB457B22153FFD493,0x1934CAEDDCEDD5D8,0xDBA6AD97604A92AD,0x11432BEEE1FCD4D8,0x98832FA2BADEECB4,0x8F8C3302C2CD1AAB,0xEEAD223535F8995F,0x9EDB394EFA221C10,0xD2B2DC42,0x5D8C3F94D49DF827,0xDE4A466DBD3D7F4,0xA4DE5EF926AFEDF2,0x848AEB989878141C,0xFD21AF8E1B82729A,0xF9AA82751E5C6940,0x8DAAF5850B78C9F4,0xC92A1F4C1203F05F,0x1231509F01049091,0x12C57F656,0xC6E4B8DFD8A34FFA,0x9A6FF1D7708ABC11,0xE1FC0A9FBFE3FEA4,0x5E371317B67A04B,0x5E8BCA8422CF42A6,0x936B1E225002A681,0x44C8087A7E5C8BD9,0xAAD569335CA6714A,0xCFC8D8ED105BD8D2,0xB605DE5E,0xEF1F222F60305152,0xF4F85C40A4962C70,0xB31600A396C6D748,0x78A136265E556DE0,0x16525FF96DC7E356,0xBC2277BCCB42A023,0xE0260439050D48D8,0x7F42A40DF1C9CC63,0x9DC0BC771E75CCF1,0xF587BA63,0x2C55D52D5593060B,0xCEC9320B99FADEEF,0xFE80D9F8E7C7C661,0x1C61C0BDF72B0258,0x491A3D13116B4EDD,0x9D34ABFDC895EA94,0x7799CF9E0BB2DACC,0x4A37C11094BFD7DD,0x79908E368873D8B,0x126ABB0CF,0xF281E892DCAAE88,0x540D4939EDB28439,0xF0B18F94A453063A,0xC34F792B01CD087D,0x4449DCD74288DABF,0x3EE09AE1494EF721,0x342A0DE84F20840,0xE2D03BA98B8E8725,0x2C83B4D70A7130D7,0x1BB74C403,0x9131B7F61E98287D,0x6453F2EF4AA09B0B,0xA141CD8242977DD2,0xED02D8358799558E,0x2584A23B6BE1B58A,0xE17C1C270717D4EF,0xAB8185EC7155F63E,0x479CBE630274B1CA,0x4F48662AC0B8D61D,0x2142BBA5E,0xEBFC8273D3D5C11D,0x838B6E517A4CBF8E,0x143A768577E3D79B,0x1F315B08BD954D05,0x35C57FF6F73F3A36,0xEDE4EEACABAA0D6F,0x71BAF2E822C4D958,0xCA63993F1436F4B,0xCCDEA169F9B4EECD,0x2396999EB,0x8165BB886C7FDC2E,0xD849DE010F1BEAFB,0x935DFFC2268F78F3,0x256A66B29EA8623E,0x4F026F71F4543BE3,0xFCF510B34E62BF29,0x87B093F0E6BD8E8D,0x4C007775BA9446FF,0xFF84961F3D9954A8,0x194C55938,0xA84EECEC3DD9B038,0xAD2047D1E55B60C8,0x5C3FDAF2E3E16D8A,0x29C7784A79197E24,0x361AA294BB51D535,0xB7C790A319EA9E0F,0x6171E0328E614675,0x7203472C5C4B72B7,0x8ABA2720C6708135,0x1A548D9AA,0xDE6440E0B960BE2B,0x8DBEA76D77DD6F3C,0xD58306BCC4E22F0A,0xDB53D09183D5C553,0xEBDD18DAF07E38FB,0x44515BC27966E9A3,0x15C5A6F47C98F8D3,0xD35A1C2FC9AF4A28,0x9CB5F1EAA4CC2302,0x1F6D5BFB6,0xA8DCA414F769620F,0x218EA47C6602DCFC,0x9967188B73FC118A,0x694324F9B2432517,0xEA5B13CAF30127EF,0x768692217756D2D6,0x9E83E0CB4FB11B40,0xC11A4D352EF468EA,0x31925DD68F81FA2B,0x865EB8E4,0x14508D1F289E4CE7,0xDBEAEDA69114C174,0xB7B67CE473223FA0,0xF5925DEDF8E287F1,0x5AE05C31877419C9,0x51029C7112262B92,0xCEF78DD5D36A96F9,0xA6801614BFE24B84,0x5399581456575315,0x16F85E271,0xDC0AA52ECF2B4A19,0x8D1BF66BC07AB4CA,0xF3602F2B7FED2A19,0x61DFE764A8741711,0x6E689E024A89F3D1,0x2CC90C1B4275BD72,0xDC2FF6EDD6A34E7C,0xB6A00CC7A817BE24,0x530293D148798D8B,0xA506E88E,0x14D405DE3264DE8B,0x7BD2E5A23DA1439E,0x9C97B48DD3C8F902,0xD5C469E02580ABDA,0x59EA3C3DD1BEC017,0x5041D8356DEC53BD,0x469C1D249E80A376,0xD50392C2D5C7A61D,0xAA6B2DB9870B4E59,0xB05C8CB7,0x6C02466DBD51EA9E,0x1104C22EE7C4FAD2,0x8E9B6F19146AD22C,0x47DFD5B1A1B60771,0x7D10D19E280D4C70,0xD4C2F46E1313967E,0xB734D411125A03C9,0xBA30B578A4855FFE,0xCCDBAA6936783E0,0x117C4E93F,0x6571C51F023B35D,0x3296BEED40264DEC,0xBAB6B092D6954A1F,0x484EEB35D70C03E8,0xDD270080AE0C9390,0x6A091A64E647D9F2,0x31218B00BAB0C923,0xAB8A7AC1D05FA413,0xF0DBE7F70D2FF326,0x117671B59,0x8A71FB6189153376,0x2BADE700578204B1,0x37E0D7FC2B5ABD41,0x1BFAC91F4592D8E7,0x1165AA15FDB29EB2,0x7B9EB61477064B03,0xDBCCAFCA3E6D4901,0x62595601236E7F28,0x41931917639DF4F3,0x10A3126F4,0xFC33E033E9EB85DF,0x864F7B9AF48A828E,0xDAD10C92DF5B5EE4,0x61D8CD878508CF85,0xBDF9DA6CB4124FA5,0x38AE574E5B120479,0x99951A1439BCB279,0x21C463948C3E8C69,0xF09AA28FDECDE03A,0x186171210,0x4556B87DED2CDC2E,0x78CFA7DD27A93C60,0x5C1D24AC471057CC,0xDF0F6240C44E9414,0x9FF37DCA7481D492,0x44682761F88E57C8,0x4A1272B7E4FACEE2,0x2014838A8364A360,0xF467A85FFED331C1,0xC7A6E7C,0xFE08509F0433A51B,0xCE93C697B78F9906,0x8FCAC230DD0E3C3,0x5412BE228741CB8A,0x7D6E35A512BBCFE5,0x9E1DBB2F805497BA,0xF2AC87089856C42C,0xD6CD140A153C5C30,0x7D40B0BFA41C1ADA,0x23B1C0144,0x11C9EA230F65C205,0x493E2B2C72611950,0xFC669231941370B2,0xF0392CC82CFC52C7,0x87F70368DA66A829,0x83E1A74592F41C90,0xBE81DC409D742273,0x719EF45B91AEA389,0x9373B47A1B1C6F03,0x21D4781BF,0xD0E068AFF8C3AF23,0xE3FAC0143AD34BED,0xDDBEA63C9063B815,0xAE2568FE4A1437DF,0x8CE7D8BEB7A6D8B8,0xB80F3840EA148A80,0x8597F30D760AFE27,0x6780803919F8213E,0xDBBE4E97DE09DBC3,0x10EA6DE65,0xE88296B920F52F37,0x32A3E74D5A1807C5,0x44979D123FA4547E,0x883D5657D0807F1,0x408BBEE3A8669A9B,0x1582ECC91BDBB69E,0xA4FCAB82BFFA525B,0xE4ED8A85E3A4F64D,0xAA0D7D5C4E1CBBEC,0x1219FBE86,0xE4DE4885AB4BC7B0,0x38FFED3F0DAA7644,0x54A4A35F171B9073,0xAAF19BDD513908B1,0x55EAB92CD29FFA03,0x3A163AAB656A0C98,0x674F714AFEF43547,0x733E6DD1468F8AAE,0x4AD359C78A9F18BA,0x14546D280,0x6B9E88F22F5D4875,0xFFEBFB22940B75EB,0xBCCDE29377EF84BE,0xA259086489F26054,0x2747423E2B8D1154,0x130363C1C3263927,0x249AB2DEB65FA5F1,0x572618E87C63E0BF,0x8908FF6764E8C973,0x11D124AB7,0xF1FAF85EC9060EBB,0x53DFC26D66F25D52,0x60A161A15A442A79,0x22C0148532B8A29E,0xF69C0C6932AE0E1,0xFFD4C53AAA8269,0x3A5BC6BFE0C058C9,0x8C0A5CB7AA74696B,0x4330D63A61796F72,0x6484316A,0x59CA3ECECB907227,0xC876459F81F95F3C,0x962FDAA1099B3262,0x73F7A0FB6541446A,0xC7396B256DD3A493,0x71207D38E5223D7E,0xFEEC463F979FA7A9,0xA15A3B878EE751B4,0x716EC23BF782A2A2,0x82399DF2,0x946AF928C2404387,0xBF1E85E8AF4F4996,0x41CAF03D7710723,0xE21E9E0FF28B0FCC,0xD2BBCFFAB11E95F,0xB5B13A9DF05029C2,0x56B9746F4F6EC233,0x569EE3C0E54FB347,0x2A380A4049CFEB89,0x1D36FBC07,0x9522D72CF9B75036,0x5223AF4F191A8166,0x7165202F7E606445,0xA75683128080279A,0xA51DC475BD9787C9,0xFC948693294E7D94,0xF94CE2F42F3E93AC,0xB044F106D357D738,0xBAE06542618C8FDD,0x47BAD4F6,0xD66406E6D17CCB28,0x3E23308419F7D74A,0x91ECA4C829756197,0x54751DAC9F917596,0x419D457E9500C8E8,0xEE70E4263C849E5D,0xD2C9ECA414D9558B,0x7522847B7D47600D,0xE26CC8BBF35D14D8,0x84100415,0x63C227FBA5EFB04B,0xA1B30C27CC3318CA,0x58A15A2069627BE1,0xA8139917EF2C37C3,0xC91237E496FA3C15,0x753E03E0438BFC9B,0xA741DB5978FB99CB,0xE82D156F351C75D2,0x48C2C48FB3F1420C,0x1C50F9C34,0x1AB812ED410DDBDD,0x9A11F5154BFA7F48,0xE9C2AB51D0BF56AC,0xA8CD4EF4EE61A2C9,0x55EADF45D3F04375,0x9E04223E1D29935B,0x886A22DEFBADA8BC,0x20016824524F2599,0xE339F619509046FC,0x19EFDE4E,0xC179C81E4CBF8C8,0x37A53CE3B8412767,0x34304324F58F4F51,0xA7A2DD8B8FAC8680,0x6F34EE5200CB7B7E,0x89A887ACF19DECBD,0x676AE0E9CD1AD98F,0xD0B423ED5258E1D9,0xEA984824D0AC1F15,0x1A0CE0A69,0x60BEC82C8C073244,0xCB260A8083615951,0xAF84E4755B4F2E8B,0x189A71E8F97C94E9,0xF3155012975DBC80,0xB2002328014172DC,0x1ED95F9235F6542D,0x6AD32B27ECC4FB03,0x335C5BE9FDF575A7,0x22826DA7B,0x39E33A25E61293E4,0x92D39BB46311E8E5,0x672A7B1181820FC6,0x35DA638FE6C5AFD6,0x41ED2D5D5397E754,0x67CDCA47657CB1F9,0x82C0CF401B45F5B9,0x260530A961DC5697,0xBE0E1EA0563A299C,0x2290B0C7E,0xC233962431F31C9B,0x74023BB486FB68F,0xE83302C0ED1D2281,0x613278663EAD95EE,0x297B3893E9A7B831,0x23BED21E0F5ECEAA,0xC054BAE5AB1F71A6,0xC93B81BB6675E5F3,0x65B8DF5A5769EF02,0xF547F029,0xAD0C605B46CC3B9B,0x64CF0C015C8BAC00,0x3A644C30A12C407A,0xBE0A47E8C8C5A244,0x76035D1C2C97D2C2,0x742D7B37D77CC48D,0x2B0B04143A3341E2,0x5A0D11354B77B855,0xEBE54CB0158CC2B2,0xB3F5C282,0x47339C26598B6128,0x48497AB0A2BD9674,0x2ED4EB7B08C6D077,0xD08159DED7F62066,0xD589B1499BBDB07A,0x3247460AAD45D558,0x69B8DBC1B82C6F8,0x31D2CD8EA278FC51,0xF0EF347999213D9E,0x18C331AAA,0xEA4A66681D58D35,0xF22BDBCEDC7473C5,0xD17259ADE5568D48,0x9223BEB1AEB3293A,0xAA01F3F42F4EF655,0xC0A8CB413DC7F373,0xDF8C5C8D92CDB67E,0x802DF6C3926F6D5D,0xA54BA5838971AB2,0x22A53F844,0x12EC42149DEE4C56,0x702D6CB578B7DFA9,0x23B66A9B01D21E5E,0x75492E84EF9EF2A8,0x37B723AA7722723E,0x524E8ABAC3EFBF2A,0x636AA82E542240DD,0x9250BDD2C0733326,0xF887A3563DA2DEC9,0x55FC6D18,0x31183AD5E5CB3426,0x9237E8B5802F26E6,0x4D1262F28CF920F,0x5D22F25E13BDB85D,0x3A411EEDEABDD499,0xADB70CC4BBB1D436,0xB40D4AB2F0E9C006,0x41D73DEA9DE1384D,0x7A845E9E1D83F941,0x15D5EBFA5,0x900D875D760B02C2,0x9B024DCA41455FB7,0x2B125FB5FFFE8DB9,0x50DA35D1F479A281,0xB82DBE35CA862799,0x7C5794F0C3F1AC52,0x36EFF48D36E1614C,0x25D0BF4513EC2936,0xC9E44EECD0A24EFA,0x183ACD311,0xA98E8760C4B8BA8F,0x81247FF52310BC3C,0xAC3CCBE01D194CF0,0x7213D6730EDA2D4E,0x72E3BAA228ED2E41,0x4A7E29A90DF41D1,0x4F99BBB2E23EC1B6,0xDC78CC04A60B4339,0x525AA1E39915948,0x1E4C8D448,0x871567C6AC07EABE,0xB6DD2FEFC0F804A8,0x28B0EB2C2ECD34B5,0xFB8BD876AACC797,0xB9299DF4D162BFD5,0x8A4854E3BAA39563,0xB4579FB21A423DDB,0x5FF45B55639501AA,0x67D11187C976A10D,0x1CC095293,0x12E182753A4ED0AA,0xCD3D1C1096D6F324,0xC8D97477D926112,0xF6E186E4475F5E88,0x4D44BBD2B0949571,0x38F38632CBDAD0C,0x364703DDED2FEE20,0xC3BD6D7A33585C55,0x69D0324D69B50A48,0x1AAD68869,0xE0C47F5B4DF959A7,0xEE235FB45A0526E5,0x5326BA144934FE60,0xE124C6BDFBD2217B,0x9484BDAD72773B7A,0xB1FA0FF7B0B65768,0x3E43B20F787582BC,0xEF6164A6D6B49A1B,0x55782B8A0AE3E3D2,0x180123C78,0x74C8D12FA7176FD6,0xF0C86BAEA2BCD729,0x2433C6F2322C22AA,0x8E99BF1730775116,0xC5F9CA23DAECEB31,0x754FB1014624FA6F,0x53B7FD4CC1FD99D7,0xC8F9A63614221CC8,0xCA6453B5DCECA03B,0x7883DC24,0xD8B2F30B7599E25D,0xD66BBA76173CFC13,0xFDF1AAA7F6B0A710,0x301D3E4780D50E43,0x87508B942748812E,0x8D13D60D6983C0EE,0x24048FEFDB27DB63,0x94A71B9A2267C9DB,0xE7664437C732E9FD,0x1B3986E0E,0xBAE448AC87EEAF4B,0x597B52116C3F101B,0xCFFBCB41719ACA2E,0xC821006C50295245,0x764B6C26298BCE73,0xF05D27C22A0961F4,0x86752F76994F7EAC,0xCC3A43DB4908AD2D,0xB47086124B7546F1,0x13588FD61,0xF632BBDB9F370DD8,0x14C939EFD558EBCC,0xAFBF2B692490ADF8,0x59100B6F7DDD02B9,0xAAAB84E605774160,0xEB8A0C384B72954E,0xA2DD21A282773A63,0x3368827129C46656,0x7C02F3D619843E65,0xAA28B793,0x50D936DD05CAAAFC,0xF5224A6CDAC86F12,0x40473E1F41767DB2,0x436FEDE5F501D46F,0x269F03B10D1D6A37,0xBE02B4942BA4D96F,0x8D02DC2A2872D089,0x9F0BAF20DD6418F7,0x9003931439CDDD36,0xD2DABF98,0x73A2FD97E7B263FF,0xD890FEC685319DA0,0xEB5CD5C64C507285,0xF31650AB2F4C36AF,0x1076B93B649A27BB,0x6818B7769F45A851,0x313B1F669794EF3B,0x9A5EEAA1AAA953FC,0x581B670D3FC0308,0xE3DBD61,0xEC73FF1AEA0338BF,0x5E04DDC94E655613,0xCD235FDD0D8C0A34,0xEA6772076CEA8F49,0x4D492FA49BEF4775,0x1C01EAA59351DE1E,0x6658D128B5A1B340,0xCCEC081AD2947BA,0x41A244D08EEF682E,0x17BACD86D,0xEE4D6BE08CCB8D30,0xACBC1090ADBB02F0,0x7F9D0FC7CA98CD75,0x86A07C2F12AFA80,0x4ADB2D3F49164D7C,0x194CE4CCC45E3B85,0x3957AE6FDACC82A2,0xC7D75BE9D99498A5,0x3E26382E6A8565AE,0x2746ABA42,0x8669886B759E3D13,0x4F7330A3F9C054FE,0xB8C6373EA3759FCD,0x9E4A159A97421240,0xD377CCCBD21CF237,0xF0A204B79BF5E1AE,0x6ABEC02C1E6FF094,0xE2D05DA7F828DC1B,0x8569913D59F53AC2,0x794532E,0xD083B05D3C6C671C,0x4DE070C610637AE1,0x25C81D8C62E6D7E3,0xE26766839C3F2650,0x965D02C653250822,0x43D19527334C05E0,0x2DB1F0C2EBF09484,0x43AFC8A8C60393C0,0xD60380E3FE0251C9,0x671A981B,0xEBD934AB057EB225,0x23BF15A0FEB5CBB0,0x17DEBA07DCB1A201,0xCEA40805D8B9F477,0xE7EF98096656968D,0x543E4A4B5D394642,0x19540BCED76EB225,0xED92B4794C60A9FA,0x13FDFE3317A9C35A,0x1F79C2486,0xE320B9BFE59966E9,0xEABB18CD10428F1E,0xA9693BADFD496603,0x16C41B4BB94894FA,0x5D6F380479089AE0,0x2AE053B4245E0B8D,0x7E2F1F946488B605,0x6D6C673532DE005A,0x2D91352052D2CC2,0x17F681BE2,0x8F16BDAC45B9F0D2,0x89AD70C72A70BD87,0x51EA6CD8AC5EDA70,0xC20E7D44C56658B9,0x499436AF28953E64,0x495942973BB14DA1,0x8940617024737B4,0x55437CA06E6CB7B9,0x24576E88D11CB610,0x26809C13,0xE83A845A302E36DF,0x56560B1E8B9D644,0xA45F7F315F74B354,0xC5DA36F6E9B97570,0x93F801DBD37C9EC4,0x887C215768A2C5F6,0xC63E59AC47505530,0x92303B215386E625,0xB210A5AE1EE7C79B,0x1D5E31B30,0x372B15553A19F308,0xEC89B95557E61943,0x40352B1AAEC44C0B,0x3FF83427839CE09,0x6767519DD3D3CF15,0x6CF8CD4AADBF92DD,0x5D2DE66397243A83,0xC7F1409B5750BA4C,0xC43A5F01F5FB24EA,0x426641E3,0xE0D1085A88EA9C45,0x1269EF392AA7A140,0xD2D572A3A6CEB92F,0x76A08B8FEFEC969E,0x7B1BA9265CDB57C2,0xC87CE8BDA0EC1EC4,0x34E03B1FBFCD16B4,0x806454F4390D31D,0xA9B6CAFDD7446079,0x4DD4A16F,0x4928B7609F0C530,0xBCF5C853E20EE947,0x3DB1C92FE7662BBE,0xC8C3AB2384D7B876,0xDFA7BE2F342A7457,0xD3EA13EBC45A8ECA,0xCFB36036A90012A5,0xB6A45319985A015E,0x537EC3A57624844,0x19BB3D292,0xF530FBBF7A3729C8,0xCF8C486CF9BA6572,0x92C1691173D2A008,0x36884B565112C297,0x2648B0D9E06122F5,0xADFD843BBBE5A9E2,0x76D95665F17881F6,0x653B448BDD84DF36,0xAC851C1BB0D11810,0x1727041EC,0x58D23BCE8769E717,0x9E61C27072C91B3C,0x20BCFB9710626AB0,0x1A89E1D95F9F4D21,0x39F4ADED064C101,0x55ADE550C136C2B8,0x5E9282AC60E0AF1F,0x6A15CD01C8D8BBA6,0x7FFA64659ED861AB,0x18B7049FA,0x3BBF20071CF59F5E,0x251B42C0610AD5E5,0x35496922172052A8,0xEF67CBFF141A248B,0xBD1C2889AF81C9DF,0x239BF02DA5EC4D8,0x71B0EEC628971049,0xE87E541FD42FB095,0x55135D803DCFC49,0x19F509E42,0x22A2D37F4BFFA09D,0xF85878DA730038E8,0xA4670CA9D6B9CA22,0x17BDA9D9FA141476,0xA54AA76C47C93F23,0xCE525EE974BE9DDA,0x15869929CFB384CF,0x638F631A58B47288,0xA3AEE2EAC435CCFC,0x1AF4848C6,0x73A044264D5BF93D,0x97E1139BE8741A6F,0x4C832A0939CFC2B7,0x3E2CD7CCDAD75132,0x5D4DC522F0430CF0,0x93EE96A00F60458E,0xBD2C0F5BB106EE01,0x4B46BF081783F156,0xDFF526E39C9BBE4C,0x2526036DD,0x3003D2629AB67A75,0x49A95472637D2149,0xA40D79602DBBAE6A,0xB20BB7393CAF6699,0x25B0184890BF334E,0xB23653E909BF47FF,0xBA11FBB5E8422392,0xEFC7D74C6B9FB982,0xAD068ABAB79DAB3E,0x1E3C3E5A9,0x352621A414C8BA45,0xDEB93376F5932B33,0xE47E5FA91DE1F521,0x8C261FB2B087C418,0x2EB107C9436A563C,0x1D31A9A6B27ABB89,0x77FF4DE4B36E88E5,0x3B2ABB00C0628421,0xC20249A93E67612D,0x167428653,0x3482D56272081308,0x175D75C0252E3804,0x6FC3615E2D68FE56,0xEF065BA1D9993C01,0xE3F8A2F525F6C31B,0xB31D3FC58E94DAB2,0x8B44CF9F2F7120E5,0x74280F74148CA170,0x11F2226DEA26A54,0x66EBF69C,0x560BFA2F0F056D6D,0x56AABFAAF42083B,0x855F28A45BC2A372,0x718E11C5B067BB1E,0x689EC51AE0611CC1,0xB65A7FE821678B47,0x84FA756D8026D3FB,0x10BD3F4EA8D6DA25,0x2616542A6D7F0C24,0x89A952E,0xDD6CDA10B33F6B3D,0x509DD164299FC640,0xB518CCC30AF1C755,0xD7FD010C71E8DB4A,0x50A62C6E4E442D7C,0x22507B026F4BEC2,0x97F5F6F6A90E69FC,0x4F2A26BF3D7D61ED,0x6763772F07666F52,0x15DC0A7A2,0x7D8FDB9B22B3D058,0x9B8206E56F97BCF6,0xFA8A1315F25B2260,0xEA0B114816C0AFF7,0x277FFB9EE8FF3DF1,0x20A903B09FFB299E,0xCBAE7D71F6A0F6D8,0x735638E20984FA05,0xFB4EEA9B9F2357FC,0x5A70B54,0xA1FD8F072533E9C6,0xF8701C82671BA125,0x7A65A24D85C7E2FF,0x500B5CF9D5EBA07F,0xD07DECAD3F0A73A8,0x3BC831CE42D7E003,0xAD389E01BD0E94EC,0x79584CE5502A41C0,0x23F193FD320FC0BB,0xFBA6F0EA,0x5C9C65FFA2FE44DA,0x82363A87E972C5BD,0xC2FF2851ADF03D4B,0x311DD7D98AE6FFA0,0xC4084198BDC48803,0xCBD2DBE27DCD2A9,0x5CD4ACF5F4979B32,0xE8FC53E51195B79F,0x1C3F1A35EF1ADD93,0x6567FE9C,0x1FE73F4698876F36,0x6E32876CC1D48984,0x1BB95D80F166918C,0x2614B1294E0F3BED,0x36D86650F700B1CC,0x7EE154BC798D05A4,0x178805A29B97E425,0xFAD98CE21C42A2DA,0x9236ED24709FBC01,0x1441FEF57,0xD8C584F2A72BF1BE,0x19B7DDCEBFF065CD,0xFF855450AC6CAC96,0x5436969E6D50605B,0x76E7BA59311771F0,0xC3B8E7540169A10E,0x51B1CE83A76A6C22,0xE806AB8B7489681E,0xB493DCC4A9CBED18,0x19C114439,0x1ADBFD2FDA9EE325,0xEB5BD9C29C430172,0xBA8BAF28961A0E12,0x92F6E10CFF25C80A,0xF56DB367B7148A01,0x637CE08537AFE7B8,0x2FEB8E537E348670,0x63733B572D36ADC0,0x6B4F7DBE648AA1CF,0x11222321D,0x2CE545E02CB2292C,0xC73B2D627C509B31,0x89855235A29CDC67,0x48517153AA4E6C08,0x9BBE61A8BAB6EBAC,0xC6C599EBE199A76D,0xCC0EAD8AD5A57190,0x1C9EFF71A2DB2364,0x5740FE4F33F7617F,0x8F4A6795,0xB667D416DEF0D3FA,0x1414FAB9492CFBFD,0x8E9E61379A29787,0xA9F4B6EBBD77DD6,0x3A3400027F76E1CA,0xF742DEED30B424D4,0x24E19101BBD5D870,0x4E4A4771E287F22A,0xC25BFDE12015EA43,0x1E13D352F,0xC15C765BD335BF05,0xD8B930AF2504D510,0xBF7831AD110FEECB,0xC0A4C1B4309BA644,0x11C3A0207782714B,0x85637663A34308BD,0x4C2550221D923AD,0x2FAF061A21800137,0x7F22056DFE9AFC3,0x1D3A20FE,0x75082981A3F731BA,0xC8F98D5AD56B7C8A,0xCE1BE68A2F2F15AD,0x341A439D0DFFCEE5,0x8161A6301ADF0291,0x1F8AA0C4EDA91E3A,0x6E75EF8A12D815AB,0x82FC9B4570042F2C,0xBFD4A2553AB5F3E6,0x267E40BF3,0xB37FB459C517DD62,0xF718F54FB40294AA,0x878456FF6117FC43,0xC3C552B9FAD4462C,0xA5AA9995EABD00D5,0x339F616F159748FE,0x5D3B7E137DDB5410,0x70B0B13FE147132C,0x2DE4CA0A5F51B517,0x1B3BB408F,0x732A3ABDD61AE732,0x9348990A76BD3F40,0x573C305885271101,0xE18947A8AD00CDF2,0x4DB33F03D0396792,0x879B16166B1DE1D4,0x9C4550498F33BBC2,0x688447815A891E9,0x2A0EE302641D06E5,0x20792DB95,0x2828D0061D91CB2F,0xBA09C76389F635EA,0x9714ABABB4BB1334,0x76293B6766841BD6,0xFBE26EF889659DAB,0x3ED8BB7EE9B77516,0x1434EE31C8E02CD9,0x5CD0A6B91CD9887C,0x5AFD84682A92AE0F,0x26F213302,0x3862CEA1FAA51C9A,0x353C6DAEAA7746F3,0x12025697E9D0994,0x9BE3C7CA109DB3CA,0x2914FC22C5F85437,0xBE2368181B7C34DE,0xD19EC04FC38FF449,0x6534B8FE36593A88,0xBE31F6F49923D42,0x116FD0E59,0x14DCC93D87075053,0x67898A04044B771B,0xC6FC6B8494231F6C,0x740D4171251F0D6,0x72CCC96918FE8401,0x3D19104452C00E3B,0xC5DEE056B279462B,0x29C76E7B51E08311,0x4F7BB8F118738D70,0x124FE4132,0xECC09015C9830EDE,0x49B440B6C2A70771,0xCDDEFD246415C4A1,0xCA4F6E3F983C839E,0x17BF579275B18FD0,0x9F94C826B1C705C7,0xDE504CF640024517,0xED65B543D3D7AF78,0xFC675830BCC766A1,0x16E9B1C56,0x572BF31A781448E0,0x7944605D2BB66337,0xE7455E3AAC44FBDE,0xEE435FCC9A736E4E,0xE15CFDE98B052991,0x5CDDB01275CF7D4,0x326DF7E1305084C3,0x41E697FDFA73F90C,0xAD5C9FD3E596B295,0x1332713E,0x54FAB63696E87480,0x23C141BDECD011D7,0x66A670B0033E682A,0x369EE22BB4D81BCC,0x84892299FCF4D52C,0xB3E8CDC2344C1AC,0xA24A7C7E5DD8A699,0x9282C37950394C68,0xDB014AD88057AD03,0x11621BB7,0xA27FA46B3593B25F,0xD1DAF7497DE3154,0x2AB6F6F6BCB4F645,0xCEC8AD6C83367D08,0xF778CDF2EE054DA3,0x64DB7A96ED1AD04,0x6663DC5967826FE4,0xB9C70496D8E4E1BA,0xD7C04921CB55E1B3,0x1B2129DCE,0xE843223970987E26,0x5209156D99C872E,0xA29C59ADFA572328,0xF28F4E1ABC262E70,0xB5D5C2EADBEAF9FE,0xA16B1CD52B805695,0xD1111B612FF9CAE2,0x28B03DB2725EDE18,0xB730954D2F8D05AA,0x1A9B3123F,0x9846CB896A549115,0x7F23D2AEC3651C08,0xC9E99D7B90D939C8,0x228A55A93926FD31,0xA56DF8458EE8DA88,0x684B350618C8D23F,0x7894A5F1CFDB3C2B,0x507CFC29C7C36A51,0x3C556819C864193A,0x124149842,0xB41A76D799E54829,0x25BDCA7130BE6D0,0x87F1F4AE6C69B5A5,0x28A3FAB8932C3324,0xB4932ECFABBB2AFD,0xA6A4465F880452D2,0x674FE91755818589,0x5BD78CDA5CCB960D,0xC78316D8C56A62B9,0x1CAD2B9D2,0xC7D16F765D73F809,0xCE527C5C5FCB359A,0x52CAD1060F4F9DBC,0x77A1C7B282C2E74A,0xD2ED820C684141C0,0x89448FE2A1834EB3,0x581B0968C0498356,0x528AE013EDE6954B,0x854C4EE52758AD07,0x11261EC37,0xF8715DB6888AF705,0x3324FF4D305B828,0x49E98E5291FE9DCD,0xE56D001ADA4C067A,0xA78A0C91DB88D952,0xF20D1EC189DD76E5,0x47F0CD83B49494CE,0x67590B0D00AA7CD9,0xAA55F63A78E7B9EB,0x4E2BE885,0xA1D8E93DFD78D66A,0x1E1CFE08BE17E5DB,0xF1713CC4D1BF3322,0x161B4543C93AB61D,0x973FB271A8914727,0xEA376AF4ACCF64BF,0xF7069EA156608D58,0xC8C1AA1DA1AC79C5,0x7861585903681AE5,0xC81C00B6,0x487646A519FDF846,0x8CAE704F7A5E2590,0xF2DABBD48A736BFC,0xA027066BD3B684AD,0x143BCEB406EF92C9,0x1C7688AE670DAAAB,0x1C16E2D2D730BE46,0xD41C183A9FFAB7EC,0x64CAB57F409ED64D,0x176282D90,0x37DFA00DFC0981BE,0xB50CB08907E3E90,0xAEC91BCBEB673B56,0xDDECB6C3D79D26A6,0x711D7CACDB151D93,0xFA42C48B62964FAD,0x79AD6709517416D3,0xAED7B0823D88F633,0xEC1C2149A9BF3D1E,0x7503DA49,0x58060733E85FF12E,0x8B27B0578015EEB,0xB5ACBE6D35EF27EF,0x616B196E4D601AB,0x34827D6C4D1E60FF,0xB1B53D7971D9EC9E,0x4E291F092882E3A6,0xBC6B4100659904D6,0xC1BA8B61DF7B2D44,0x58E3E5E9,0x123D9846997CBF2E,0xB6E75C6E3E64E9E2,0x711B52484DBDC681,0x326AD9DD817F3709,0x2F70018A09CFEAE9,0xA2F41AE8302DCE37,0x9918F805FFE97C7A,0xE7B0883D177A25B1,0x4108645F45F6344F,0xD013CE7F,0xF0DEC27E9458F4DE,0xA5ED3984B7EB9E60,0x298E16ACFDE105A4,0x196509EF6F53F0DB,0x15D2ADC0A99256F7,0x4A7EF9986BDF5EE7,0xA1B19B411BCB67CE,0xE3B633D1D9B8E883,0x48FC7BC97258B41A,0xC658CD53,0x475C5598F1FAB511,0x66B6641A193491B9,0xF39A2D543D549165,0xA4E2A8A791A56E62,0xB6F89B0B0EC51A9A,0xF28222E548E6E068,0x2D6DB9624D2BFFA5,0x8564B94D7D9B31A0,0x64F65BF5D6B0CA0C,0x117954B9D,0xEF03D0DF3DFD0D8D,0x736DFF3ABCD731BC,0x358EF631FECB5660,0xDDCD415093DDE633,0x342D3A0ECA48F1B1,0xA210C5AF1D176D70,0x5DA6A4B176D0859A,0xF27CFDC185B0C976,0xB2215BE63BB1F305,0xBEDB140D,0x8356D5B542AEF987,0x2655B781D7820E30,0x910CE11259333ABD,0x11F9DF48CA14710,0x9ACC09B75B201762,0xDABC8937AE23453A,0x89725FA98658C6AE,0x160CDCACEF3DF59F,0x930CE596A3ABC075,0x2087B40EF,0x2F294F1BC43EBBF2,0xC6B00271BD44D4DC,0xB43C5F976B6A2041,0x4F6EB187D3507D9E,0xC9D27D65AA28AE07,0x84907BF775E0EB96,0xCDA501A086D5CB4,0x2DF9867AE27418AE,0xC307877F03098C27,0x18BF3C77,0xFE5F9FD4278808A0,0x1F4952D87FF883DA,0x4B151320F366B39E,0x2E22C05CE7B37992,0x84DFB31053EEE2C0,0x8159F43E32444D28,0x9B3F50141D033EA0,0x9603C407E46B4F40,0x7C9FDDC18D42A1B,0x2BCA59C3,0xDB8C94D93D1DBECC,0x66881212C8A7ACB7,0x4E67E0681AC4BE30,0xC5E8D0EA32632771,0xCBF833064388C12C,0xF098D3B7D4730656,0x52E14D8CC12B7CAA,0x33A2AF9E85E2151C,0xFB75436E3150A3D5,0x212349C48,0x89B58EA0C7CF100,0x8CA32C57AA54B8AA,0x8CD2ECD07BF913AE,0x303E8C229F630F77,0x6605D3E2CDFEE2DC,0xDC03FC051FB2AF9B,0xD65A1E2BBA34F511,0x990D69D0686E3EE6,0x810A64E36AFBD940,0x8DD2909B,0xF68B06A817B747D3,0xA20518A6D99B327D,0x704B8B5D5A069F6C,0xD2BE5F54797BBE30,0xEB26FE6C222C7239,0xEDFED0F5FAFEBDAE,0xF4FE1DCD0E972430,0xDED9EA55CEE6EF47,0x9D535F70CCA5C578,0x1BD37538E,0x129B344DA0760818,0x8C807249B96BFE74,0x6D6A62230177835C,0x573BAEE6B3C75A27,0x980AF2ED85BD21B1,0x634EF73759FB36B0,0x180C6FA2846B36C9,0x81B3A9F9BE609D95,0x6F6D99C69D8A517E,0x40696A3D,0xD7B5F680E9678366,0x7074582E77B72550,0x3C99AC42E319B5E,0x1B2EB4AA0C076021,0x938F42F13393471C,0xB160D26BE8451CCF,0x284822F346252F66,0x2BF06BC811C169DC,0x3F4D93D9AC1B4C23,0x825A21CF,0xC855CB511AE723A,0x82E25D516F159161,0x663CC0ECAF6347A2,0xE98006EAFCEEBB66,0xA082EABD246E28B4,0xF7C46B96F3FD809B,0xC76D5AE1F8039AD,0xBDF00FDD8C60111F,0x83E72C893390931E,0x845B6EC9,0x4B5496A383721437,0x1A332B4C14EA7837,0x1253EB0C86CF7804,0xD474478CC13FB99D,0x29DC7CD22BD74A79,0xC8DC2F1853116783,0x589CB7A6426217EE,0xAF44DDA05767F407,0x4D55CFB4CE55516E,0x1E6B63724,0x8E2357ECDEE119D1,0x64E4F4E496A28450,0x46A8476B29858476,0x405477EB07722FA,0xB4AA9386A92834F6,0xB48CC43A9623096D,0x661880A1DF85802B,0xF385A01F1198E5CA,0x73B54C0330D1F23C,0xFBF011A2,0xD928C82A843FB145,0x9697E9E9AF560EF9,0xB291CBDFDE78AEA2,0xC0C7CC8F4FCEC986,0x5E4AE55C0068F41,0x822EE27CF3B3B474,0x679CD37251E1D082,0xCA3A18258DBFB185,0xA6D7D78892FF4B93,0x101613E08,0x52D92331F3270187,0x87970DCA85E8FC7,0xD5EDC46B6B3F60F5,0xD3FF0E7EF3575353,0x7BC99C1BD8A32BCE,0x4BDE4433278945F5,0xE9D538E076DB7FA0,0x33EEDB8C65401C90,0x8ECEE9CDE91E4959,0xA4704759,0x4C512A748993EE56,0x77E9B643ADCB791C,0xA5D3F496182B0B4F,0x3D6A34A9BA438F44,0x8C61AE314DB8CDFE,0x15B01ECDE4A1DEF2,0x4AD9293DBEDC805B,0x5E6589F265A3DA87,0xD532D85BDDB5291D,0x79AB10FD,0x5DC935E4D9A53179,0xE4F2A6740C0C61D5,0x1F31132B7356F2AE,0x5A0D38E9D61381BA,0x99E397A637DE2949,0xC4C68224830A2A61,0x8C282E65C9C27392,0x3A1F82204FCDD71B,0x7275053E2F7FABC5,0x26213E41C,0x2466487E67EB8319,0x261258B9A59B6B37,0xDF0FE7D1A969653C,0x6CC9F88B8A44C75F,0x41C5F32CCE74C085,0x637D8206701749FA,0x1B61B19AD3B2F8ED,0x7DF1E6EDB6AE0A42,0xD7E96AD035EC6F99,0x1A894F905,0x2DE961265F014D9E,0x518F746464E67915,0xBA8144CFC5CB7442,0xAEFD70DC72D0B37E,0x4E783AA7CDAF6145,0x9979567926C779E4,0x7AFF2487150B2B87,0xC5E44194A294FA3D,0xCFDE2FFE2E50D30,0x64C932DB,0x1F1AE3EF2EDDC210,0x4F7120C2CF17F66B,0x798737415123A248,0xEC3664E3C833658A,0x2F205AE890A74E6B,0xE12FFE7D424B201E,0x82E987BFE64B6E79,0xF8FC484D6FB97719,0x51BA342B650F7131,0x20C0982B5,0xDED868D7C678B5AA,0x37BEF0926CB8785C,0x3D340DBB78A3AB11,0x1540486A932FFECB,0x3DEAE08989C14C02,0x75D0A147B9172284,0xC06F7DF0FF2272C1,0xBE15529B82B3956A,0x84DF6216A3E7F670,0x1B8EE3B1F,0x3D8C5825A9E44573,0x63201FCD70C5C9DC,0xDC81FD30F49461FC,0x39C5EC0BB7BE403E,0xADA98C31537302E9,0xA1F91042793D3FA6,0x38387D55ECF1C762,0x7152FC855CA271E2,0x69DC1E90D0CDF22F,0x2135BDFE4,0xE6EAE166589F6EA2,0x82CCB345B1EF3FCB,0xD8DD0877A16D9E1C,0xE3CDD92A75E652FD,0xEFA5096D395F76EE,0x4C03A4498D11CCCD,0x282BA3B9C6610BB,0xD2937BA9FC883F06,0xCC68A7E3163E661A,0x1E304B5ED,0xB2BF906760F9F0D0,0x6FFD0F7D52538743,0x5E93FF1F75B43E16,0xFCA8C1D294175B90,0x550298708B17B491,0x6DC613D664F3C45A,0x7FC362ABAE6027DB,0xB3CBE8C2BF43C230,0x4DEB14FAFC33D51F,0x7B42003A,0x5CA35E3E1C2B4CA1,0xC0CF5D7400B37329,0xC0A96564054CFBD,0x876B4B33DCCC6E51,0xAE4EB8920036A7AC,0xA9EB4C082A4FECE6,0xB3266EB05FCCEB55,0x6E3EE64B61001182,0x5BDDE21F3BD1290D,0xCD773B47,0xB7044181EE854063,0x36DC27FA9FC877F2,0x999BE754538673AE,0x671CDAE230ABF44D,0x8871E6088E3B3147,0x6480DF57AAE891EB,0x1E47A92308F12661,0xD6E43EC93BF84F26,0xEE7265F922236684,0x6C52CEC8,0x2B06D85B9B33DDE8,0xD06EF5122CF8DDA1,0x61355876740991B1,0xFFE26C8395745979,0xE5959F122751AA9F,0xEFE291F04DEAC188,0x7024947BD8AB5E23,0x1BE9AA93241EBDB,0xDD51816EE68C4796,0xB6F408D8,0xB7FFA139C5AAB074,0x7DE88D3954BA64D1,0x25463BDCFF03870E,0x3555D1A66F0969C5,0x8598D3FE7580E7FD,0x38C61803EF932B68,0x76179196293A29E0,0x597CD5C4A00B2E45,0xDC70A70613F3FD1F,0x18B699CE,0x6941CAC0692E61C0,0x830D1181BEE1EACF,0xE72616A9BA21989A,0xC141F0F3D48CED54,0xA9F9D85E40AAB38,0xA6F5D4A8A267BD39,0x29657CD8A10812B6,0xCF44FF3036E55AC5,0x88BAE75814454AD1,0x473F4EB6,0x8BBA0A601B6DFB73,0xC21DD19228E21593,0x7B7696BBC1D80BFF,0x38BD8327FE26521D,0x4CB6D1CFE435D7C6,0x807B0AC915B23FB,0x9235EDA97A0C60CC,0x1EB501CDCD3E75F,0x9711B1442B415906,0x23E9B8162,0xF4FC41EF248FA7E7,0x84E5F6398FCE8B09,0x7B40320A5F798134,0xEFF17F03ADCC2777,0x1CB2DF52B0CC2C01,0xD48B25FD8CA38219,0x6842831019C588C,0x2E924DCEDDB2D7B2,0x18371F140D56D026,0xC6867068,0x20E1A7B1F2DEC88D,0x6B77F66933E8EFFD,0xDC645577973B5A34,0x92C168399DB7FB01,0x7E62C7490206D172,0x262C6A21944152BD,0xCE8100D7D71E3CBF,0xBDFD5619EB2FDF0E,0x87CB2D4793678EAB,0x189DC4285,0xD25CB768641705A5,0xB4274A92217E5F21,0x9D2F1227B0A7D2B9,0x3A846D283AB32576,0x1F53617987067D9E,0x53A495B9A1A0EEBE,0x5A885AC4A293D7A5,0x34639C4D8FFCA73F,0xD46CD4B4CBBD14EC,0x1D9E64BDF,0x32AD2939D79D03B3,0x138F153FCAD57087,0x54584A44EA766495,0x6DD6221E7E98A2F6,0x5916F92BBD7AC13D,0xE20957DF9135E6C9,0x2D871BC548E956A,0x69CC08BAD9813A68,0xC1333040061DAC2C,0x1E6959AC9,0x19BD53E7B08C13FA,0x9FF566888FB81505,0x61376FB2F01602FF,0xE65D0B489A39EFB,0xDF66659F88B03298,0x9C5CE49A6756D2B,0x3D48B7EC837BA82,0xD012AE69277C6821,0x60A28F8ED0B2E4F8,0x107CBFC8D,0x487EF5406259DBA9,0xB31B20DCC06513D1,0xA04BBB5E5F499687,0x7BB69DDD4B96AC38,0x204346565E8F1C4C,0xF908990140DDE462,0xE94345E48B5E9EE5,0xB44EEB11F8EEBCC3,0xB89684A7C1579ED8,0x2570146CC,0x45889F6667B3B123,0xE1E3AD04EAF3AA80,0x22BC40CE68CC0EB1,0xA67D2B3AE250045E,0xAB947679F50AB1A9,0x78FDE1DE111E3EB6,0x13419A7EF2A15AFB,0xE2E9924CFBD55929,0x519FBB5D63E7A721,0x26CDFF7C,0xA443EC67FD8751AB,0x2C9C354D88AA0C5A,0x66C38F3308B9B9E3,0x52B33CEBA6B88D88,0xD6CDD4B438983AED,0x28E91331D087E230,0x160075F9C9A34525,0xEAE9EB8C58E81D3D,0xDF45761E2B7E4B7A,0x26BF92C84,0x321AB5C9A517F586,0x538A8750E7BAEBE0,0x9C78530D99BD69F5,0x43AD1B769294F21F,0x4446D4338A4A7D85,0x8A89C5C4FF086B67,0xFC400A7E47B43FC6,0xE42C73868E95CF0B,0x8BC651A1AC509FE,0x1B0105D49,0xA0E6B1CDC491ADA3,0x76321F291C6028D2,0x65D68EC97FBEB62F,0xF6A33D1D73860EA0,0xA5C8DF11C3057EFB,0xCD25D03E45D1B052,0x8BCBB8D72DAFB69A,0x131AE5CB406EF7B7,0x4ECEC14EC805639E,0x195CF00FA,0xA0578BCD971C4930,0x9A3F0137EE00BA84,0x58E1E7089277B2A3,0x1A261B11227B0521,0x12D37D146F62B435,0x7BF2332097468B9E,0x2551DF570441B1E8,0x7FD85ABE16EAEDF,0x815DF1FCFDA023FC,0x237F657E9,0x71936F914EF12122,0x2BDB483767CE004D,0xB063DAAC9A0247C8,0xED89F4B9C61B132C,0x19282D90BB5F7380,0x8DA4EE9090B00D44,0x8B895AFF3B8EC2FC,0x26D644B7F720C989,0x76D19AD964EC27F1,0x7F430D08,0xE9E8B798DB93E7C1,0xFC2E0C5EC202E39E,0xBE47DD55A52D41A6,0x4F11A00FD37C2916,0x238D7ADF8A37D87A,0x2DCB500DDB88B8A7,0x367AB5B1F342B8FD,0x2F7C11990852ADA4,0x7539DE50731A5770,0x2535B3399,0x6EA1F8EE9F7A5BD3,0x4D68BF9D66DCAE68,0x71BB162B7680EEE0,0xF0E26DB40DE31010,0xDB5FDC236916671C,0xF3E82FAF403F660B,0x67CDBE35DF27A0AA,0xDFB8C111E1FB2774,0x59E46115F23502D7,0x170F9C758,0xCEA49D555716A161,0x811CDF802E87229,0xC383B62CA4DCC502,0xA72927610267518A,0x24800D9A0DD19982,0x4356AFEB832354C8,0x267AC914B4FF9643,0x581A381566AAFB94,0xD4057D37ABD9FA72,0xDEE06660,0xB7102A281E57777B,0x235C49695F92D6A3,0xDCFECF6C537CBD48,0x887D25DDED7FAA71,0xBAB36F56B065EACA,0x9E00B65BE30DC9D,0xC78CC4879E1C97B6,0xEADA9E46564F79ED,0x72B31BF6943DDC61,0x4925B13C,0x8F90B06C2AF6997B,0x6EC9F7D76684BE5C,0x6F8606FF2931C738,0x95ABC7F8B87F802,0xD8E84BFE7114C5CD,0xEDD0C44E8DFC4498,0x936AACB19AE84984,0x3D5ADB494356170B,0xF3D3B2B5018C7EFC,0x1A73B9D42,0xC88C0AC4483B2434,0xD4F9EEA19471C81F,0x1D53827AFA02466,0xEA8D5B574E5BFDB,0x94713CECF644243E,0xD932B9C681F5B932,0xD7E7970B50D78984,0x65243128B8B1A616,0x308B004B41199FCA,0xCD9405F1,0x9CCF58D66A7CE6F7,0xA007E12A8B4F1F7D,0x278CC71CC4F4BB0A,0x889DB7E73DB82F43,0xF7ACBB2C0AE90582,0xDFBD347697797E59,0xE8ADEAA3B0124620,0xBD08F0AC00F09005,0xE80971CC94C33863,0x808D411D,0x50EF95900F90F86D,0x1F68AEB1408B9230,0x4F626D6031C52722,0x2DEC6EE9D8C8130E,0x71A0DEEBE9840CE9,0x4B405D4E76315B34,0x3B97E99D94123F59,0x21327F79DF016447,0x34C9C3D560B190A9,0x34AAF473,0xC5DF27C166707B96,0x750651F7A2722F50,0xE7D29666B73D65A9,0x35BDDF08B38D8092,0x62C98F4BF7766A2A,0xAF22BB276FCA9B58,0xB6A5BBE4914BFAC6,0x87D93E124964D246,0x3D00B53C12D2B1B5,0x96C3D0E,0xC14A5DE26737F8A,0x3018BEACF1BCBFB9,0x67AF69593BD6EA46,0x714E22D4FCD40E08,0x8BCCA5E36C930CE5,0xDB2183AEC5F0B4B1,0xA6489E08F525B1BF,0xEBA3D9B6CF84759D,0xF98378343D51E385,0x3F8E37D5,0x673DC5AA69B64187,0x27A94EBA94FE9474,0x1759D547EFCB50E0,0xAF5BDB60D5087B38,0xE99F8D67B3D2DC17,0x471C859764F2FD25,0x79703C108747ECB7,0xD12035797DE7E520,0xAD7FDCD254FD678B,0x102B742C7,0xA5250F09F5F65081,0x6F0B14CD9B93BDEB,0xEC40E6221A8A8B67,0x6B7A1EE938865042,0xCD3EA4218AFB8E89,0xDB69563FCE62A6FD,0x57F35C79823C4360,0xB7CA79D9C5240632,0x85EEE486F2921D50,0x8C669F06,0x727A291D87421666,0x8B967487EA00212B,0xD87A09CED71761AC,0x7BDFB0FC9F91288D,0xF282BBC8B1DA4372,0xA8D475825CC89616,0xDB70AC2B55DA2CED,0x273F9CF1C501AB64,0x92E3EBF6200CC137,0xE9A8356E,0x408F86A33010B6AD,0x526C87059E115217,0xBC6C1CCC65F53327,0x591DDBB6F3982AB6,0x3FD2100E3CFA08CE,0x63E3197626A0099C,0xF0FC7C5D0B847112,0xA1D1189935B02EC0,0xFA249337544C3406,0x10514A2CA,0x75BF7A009FD4BBA6,0x6F2E5F6222E9BC55,0xDCD2B0874386377A,0xE240466147776EA6,0x77018634F5031FDE,0x8C9E8255A0566BDD,0xA05B416C731D170E,0x75BDFEDDF229473D,0x5B53AA5F8145C010,0x1E6CA5FD9,0x126C96472F613937,0xF4DC70D16989C2DB,0xBA621FFE1D494940,0x47CF648CE442880D,0x498261BAE3A55A5A,0x41DDDFAE566877F6,0xE1B8A09A34E4012C,0xCCF941044AF7A675,0x8273D5B6C67F8017,0xE5DF9CE2,0xC82A1FB26E539D19,0x2D419A56C85F9B86,0xB63D09AE1A2E58F7,0x46597C580E9067A1,0xF9404C4ED9FAF769,0x32E19616E9773016,0xD4E5F2B520A6815E,0xD7EBFD1FB729FBD6,0xD9306D9ADBBEC9C0,0x90CD15CE,0x5A59248217B3F6D0,0x980D9BE8E9BBDEC2,0xFC0EC6AEF627E52C,0x618728087C71FCA0,0x64D2D801B76C0D68,0x242FC635A6BA0E77,0xE5D7C596F4186903,0x575E5CA37DA64D57,0x60247F739C83F095,0x26A848CC7,0xA10416B83D772C2A,0xE1D256E9FF21254C,0x9DD9795FF644C455,0xF38CB7EB19972E02,0x33AC3795B8ADF027,0xF3B03F101C37B78D,0x9DD097D51495E3D1,0x3AC62F40B287BB0A,0xB6B4D3FEE17AA602,0x181BA5458,0xD4F701E3D22E6BD6,0x266C391EC7057283,0x62C99B956F61EE5A,0xD39912FF20C1496D,0xA6E5D69ECE9A56BB,0x7B2704F0890874F5,0x77CA46B5B539CB97,0xFF9D01B1C758EE58,0x49A8B9CC57C84974,0x9F87ECE5,0x73F2AF97073B428C,0x3BE50DC43917FF6D,0x258C0D8345353D2B,0x8726398773742D1E,0x8A7C3FB3158FAF72,0x6AFE96214E1B76F,0x2E17E1B91C5D5E2C,0xE65CD738AE0638B5,0x71F7FF865345954D,0x71ADACB4,0xD715CB1059919207,0x803EB04DCF2053FE,0x13CD860BEC6256A0,0xC5A493E98E398F25,0x1794535510752190,0x8AE8A8E357EB95A4,0x3903BE90F96CBFDA,0xBFFB4FC84742C87E,0xB2A6CE42D6C51DEE,0x24415D71E,0x3AAE140750E2BCAF,0x97257C5BB29E3B77,0x1B8B20E8F8783254,0x73926C00E378AA8A,0x128E73F7A17DEE6A,0xB0F04B5C1C54593D,0x9525984A53650DF9,0xC2911133ABF00C3C,0x904B21BD9D319468,0x23E3F2BD2,0x45A49D605FCE3FE6,0xFB7A1C36BE9C146D,0x844197FD959E293D,0x524D1A1F61AFC8E5,0xAC7792918487AFF2,0xABE041B889B83D41,0x36DAFFB1E905A8A7,0x9C9C2A6F6B3ADCF8,0x44770A36AB797A5E,0x362A5495,0xECAB8E7FA80880FB,0x3825AE388DB751E9,0x287A5F78DB4C852D,0x7E9B66C39FF4CC40,0x6A7DA62D44DDBC10,0xE59CF4D7972BC10F,0xAAA1E5E6C8E8F06F,0xD6418B69D9EF3F5,0x27005F23F83CE173,0x157E88C47,0x8D67722B46A2A015,0x8041974C53251F01,0xE3D37C209C9640B5,0x6F7380DE761077F1,0x87F5B718CAB1DB91,0x30DE1902B0F15046,0x5B75FD8F65FBC421,0x6589BE92BE8FD1E9,0xC8F584A9C489F635,0x18D624DE3,0x922A9888A41ED24B,0xF015D5373BAAE9A7,0xF590A98BF501D5DA,0x72BF68F4810322B1,0x57EBADF42474894E,0xEECC489215B04C92,0x5DD2562F6D77D390,0xA73DD007BC15CA4E,0x62BF8E57EAB54C8A,0x26D8E573F,0xDA5347727B8D20C1,0x934B90064EF03E99,0xBCE80830C8BBE880,0x1A2210324259F7B5,0x4082480A33B38BDE,0x4892E32EA3FBBE47,0x96D698FCD34A604B,0xC1D9B8F38B6DF73D,0x61A075CE5B446E6C,0xE0CE8078,0xA621831A8D447AD1,0xB2DAF2FDC6B99F8,0xCB4A857582D6EB65,0x7BA9A4B1FE8A2E5C,0x5334D8D44EC31DF9,0x2BBA3CF5DD47F74,0x98B614411A34481D,0xADB99AEADD016E8E,0xB319B140E21E158B,0x1EF7975F9,0x16A2A2598F7F6BDE,0xBD61F97A960ADC2F,0x49A2FD1C501748EC,0x361DB2CC28B01C29,0xDC33B43FE0CE0DB0,0x6F61FA081089C8DF,0x223CE6B4ED08A9AD,0x6565B2703E786EB2,0x65CCDD59B9807345,0x264D25F5C,0xF1686AAE8225006D,0xD18F4FF7715A3FD2,0x5737205E56EA0A49,0xD7A30A5B3C4DD47B,0x3E93C168A23F505E,0x59C53531724BBDE0,0x5136D48AE93F85B3,0xA9DE596BE0F7C808,0xFA327484BC7537D6,0xE6EFEEB5,0xCAC04D8D0319DF37,0x2724738634EB95F4,0x63427ED628CB44EC,0x95C289070BC6895F,0x54DDBD46BF497943,0xC70D3DC80F689023,0x44D2EFFDA65F0DA,0xDC16694D5D2FC4E1,0xB562035E8E940998,0x1CF4E143E,0x624BFE09154FC148,0x606D32D2ADE227A3,0x38F5DF21DB9BA910,0xC30B5EC389F181EA,0x7EE85B42C13A7826,0x83B7F08532B05949,0x5A207FCEAD34E5A5,0x5AE8AC7C26870BEC,0x37AA2D666D16856C,0xCB4A7C22,0x4AE08C4EDA72FBC8,0x9E876B2BB45A2516,0x5485E19DAC062055,0xD99BDEA4C6CD7109,0xF68EAF874B4D447,0x63ECA5F163C99173,0x18C6A938647C02B5,0x7B47F3F53A9506A3,0xC1606BEF0763E15C,0x4E183198,0xE4028ACCBBA4D6FD,0x4B01737E222BA213,0xEA97421D6DDC51A2,0x75F646671D49CFE0,0xA2D2AA1F4BDE5B6,0x35F3E39817DA810F,0x946057366AA47178,0x2F229725509F5508,0xD29F8CE460DEE13C,0x20FE0AB0C,0xBD59043876869A6D,0x5D16879AB26265F9,0x78AE5F37917A5831,0x2A46D34BB2179D78,0x98BF89F46C38A722,0x13B5907C0BEE7467,0x592EEF41CEE59CB1,0xC691F35507081F2B,0x660E2C13CA24689B,0xB275E320,0xEBDFE12C19F80D8F,0xC99457D2B1F1A53A,0x307ED8A3D9F0ACA9,0xBBBDFE18EFCACE2C,0xF1C62B3B660EBFEC,0x136B40BFF28B849D,0x787B8BBDC9DC7BFB,0xE2DCE3E634255BE9,0x6BAEC579A30AAC16,0xB38C6F95,0xAB5BC70A73A5A6E4,0x34289C7F88A70B8E,0x4F26343B2C0855EC,0x9E1BD67A88BA4069,0xE5C72B090FACF5D2,0x54A40ADA3267821F,0xC54A49FE1B9A91B0,0x266D373DC0115541,0x5B6CD7CCA64C866A,0x1DAC728E9,0x8D2E619A32D4CDA5,0xF1EF8B511F0634BD,0xBF9B7C7BD0FED853,0x841E7E339FE9BC80,0xFAEC6E9C20E5B525,0x30821D8FAAF6BC26,0x452EC595EF94575F,0xB396254D24CE606B,0x2CD39E5361F80F,0x255FB0A40,0xDD94BC0E2540374,0x56312ABE2D3B3FE3,0x954DA965AD76366,0x13A060F317DFCA94,0x5772D98288E5F08A,0xB1F6E75BC98C817A,0x30D02C22DB8708DC,0x9AAE131446082E50,0x1301717A8BD7C41E,0x23F4AD8B9,0x986DA6683A8ADB0A,0xA908A762924D091,0xADA7232D43B8B294,0x9779C9B34DC119F2,0xB5D698F65CB718F,0xFB8069EBF0CC594D,0x42C0E8922E174346,0x165EB3584C0A9417,0x3EE9B75D6DD6F2EC,0x191B3D08A,0xE57D9544E6F10158,0xA834406DE0C472AB,0xE0E1AFC793D5F639,0xA4CE7B9C5DBD7977,0x6C8A604788435121,0x7AB77467EDE61DCB,0x16DB8F7E2216FAC7,0xD8D427BE59F38B6,0x52A08D27559D8E8A,0x72F4C30F,0xB6DB251F69461377,0x947570416B2F9774,0x5D5D5F48CB0AD160,0x78384751E2C49F49,0x1127EED9637FEDA4,0xCA2F1C968D10108B,0x9AB2B9D2C4BD97B2,0x7426C754FFF93091,0x89338F0D51F244ED,0x2619D4BAC,0x4378A43C9B24087C,0x29A06DA77FE3EE55,0xB51F4832F797553B,0x933AE0486EAD453D,0x8E92CE041589A78E,0xAF60E72D14A843A7,0x120BFBC96FDD4BE8,0x5D8F4F6A3AC6089C,0xDA87712D5099F8D0,0x14B234843,0x8ADF3D1590DA755F,0x23DB2ACA1173F0EB,0x2B38FD5E1B50A8C4,0x76924317EE0C4A85,0xE8E0D3DF501811DD,0xC5A025BE027F9F59,0xBC579F019D03EC8F,0x2E2FA94A33DC4850,0x33B9A1FF63006990,0x16A42CADA,0x8626D343653A47AA,0x2A10D9BF8C3C84D1,0x9601CCD4982D1E13,0xDBAC2749053BEE53,0xD2AFB26130BF78D3,0x6B7A2E301B9B245E,0xD1E8969D12EA8F86,0x5F05737D938E37FE,0x7F83793101D0E233,0x2487C6618,0x47BC976592D9EAD1,0xA58A4491E0F77F77,0x62FC6DF428FB97A3,0xB8EB1F292937CB2D,0xE57AF0C3DEC43C0B,0x2F9CAD3AE022BE91,0x5F8AA8A9BA79F01F,0xC754D9862422D911,0x8D1E60375640EF5A,0x20AC170B1,0xD378D517F21A603A,0x73B09F33FBB4754F,0xE867BF8CF0830664,0xD34651D81E46620D,0xED689BF2D28075D3,0x398D4E2751FA39EA,0x776D179F8E0FCA53,0xD0FDF75DB4761F5E,0x405DCA9B60676FD,0x1E645C41E,0xDF8108CB75CA4112,0x58979CF411F4A664,0xBDE2E08929F4AB65,0x58807DEA94F8CC02,0xEAB9FF52CEDFE024,0xB4C7560E44531EE5,0xD2DAAE974B749859,0xDCCEA26975D9B8DC,0x962274119EFC0CE,0x8B89BCDA,0xC430B84C97A3AB8C,0x9EDA5E7EDD7DE780,0x5CAD15FB305B7D67,0xBBD7C874A07007A0,0xAC0968332791ABAF,0x5CEE7640C671AF96,0x6E7ECEAF016AE0AC,0xBAB4BC81E7ECF357,0x5231D0456AE423AE,0x1C1A03CD3,0xDE2292AE95CBBD32,0x13AC084B3E0F4882,0xA3427C75539E673D,0xF629FF3D0799DF92,0xCC377483D5CD2ABD,0x2B717B247CFA9C13,0x2E8111D8052D33B0,0x19E1815022A6AE6A,0x9CE00D94D0F1095C,0x220F2914F,0x463D663A4E3290C6,0xAAC0043385593565,0x5560ED96EBFFA836,0x1F1139583B0D7414,0xCF99C0C0DEF01639,0xF0B037407D92F97D,0x884D5720080EB7C2,0x89C0BF6E40CC30D3,0x18CB8E422DA62DAE,0x4329C27B,0xD870FD0DA02EF1ED,0xA30933CB9FC68D7,0x372EAB68C855B54F,0x77B265119EF7729B,0x32E0990B9845CA4C,0x33F46C58186348BF,0xEB6CCE9B2A73E463,0x5E074C94B6CEB25F,0xAD21FC56B64E5B7C,0x1EBD19DE0,0x27A0E497CDBC318,0xB59E6AE10D9F2ADC,0x437531946117B8C2,0x2C4757D26E182982,0xB24A74B029D1D5FA,0xEE452AC42EBBB1DB,0xBB99BD6E1F53AF81,0x3683FC88614447A0,0xFC9793B7F6D2658C,0x1EB466343,0xA111B74B99C47405,0xCDB54FF989BC5FFD,0x938E500FC405740A,0xD87F3EB8793358E5,0x19BB6D3497174CDC,0xA805E85EA2B67A0E,0x3442E5BE8526E7E2,0xC87834A3AC01B676,0x4C64D88D36FEC85F,0x1F8C1C1E8,0xA5609D9464B7CEF3,0x4BE7F663B8BD4504,0x249CF769FF69E194,0xA90AA9C657D3169F,0x6274CD0C8A12053B,0x681CD62EEE07FB36,0x7C19FE1A660A1619,0x442C71D7CA47054D,0x6DA584EFFC4F273A,0x21D68AD68,0xD984058CAF8E3349,0x89A01428D46277ED,0x136E54AF8488D9FF,0xE361014313B7BEBA,0x89A87BFDEB5B0CD0,0x6679CDF4D171A904,0x9FF4AE1D153E33F9,0xC10EFDD28FC92DE4,0xE1F3CD94C9B933E9,0x1190452F3,0xEB30567E8CB52317,0xC9E3ADCF927CA548,0x24B02A877456037F,0x53A63D4A19862A9D,0xD90D5D1EB0E36D69,0x5699DF9A65F057D,0x3F37A926F1DA985A,0xAE083BDE022DE611,0xF488D3ADBACA06E6,0x16ED78459,0x3E75DDBCB4A0422,0x645052AB484CC85,0x2ADCD6D9F885D82,0xC7582DD7848D6253,0xFCB5DA312A91E7F1,0x9465F570A544AE37,0x56E38D717742A42C,0x80CA2B7C567B05DC,0x1041E49649997278,0x88AD1FF4,0xA660BD293CC03777,0x9AA763135732B884,0x3406F5DB7FF0426F,0xFC531AF03EAAAD87,0x8956EA7AED0E63DB,0xF8B0565EA03D370C,0xE964A938C76A8EA5,0x5C42DB997E0975B7,0x309D4012734D60E4,0xE67D8DB4,0xE7C71DECED737383,0xE0F32CF3C95330ED,0xB2D778F0F61F3407,0x4194C2784147F393,0x6B9E187D6DC28C9B,0x3A9118BC76DA745F,0x3A21A7C1D36D0A09,0x788786B60B32F053,0x6080FE3B0EC75D4A,0x1BA85287E,0xD495AB837D5DF55A,0x3A02359E40C2C5CC,0x58A3CB92E900CC73,0xE6B845C558C5E1C8,0xF7F3839C29CC0FC4,0x933BBBA40D056B57,0x92AA2BC415E516D3,0x57D18D992AE6E4A5,0xA69E93C6391321B1,0x253F560D9,0x639D678E85CD3475,0xC558A630D8F1FC44,0x515944F07A7C4EDF,0x24D62572F0C07EA7,0x39234C01D47BD934,0x66007A1810B8C375,0x3539D4DC24872F08,0xFE389A4331678D1C,0xD4EBA07B2ABEF631,0x215069469,0x977978ABB8BB8C96,0xBE9E77D6EBC8740D,0x6E2A48F8352E9A73,0x1E47806C723EFCB0,0xB15D04F287CFCA9C,0xE72786FD787216D4,0x5EA69FA1BF8698C2,0xDCBD996F831D69A,0x29B3302E6739B4DF,0xB247FBCD,0xC02A40014E757E19,0x36F7B9D284D504E0,0xDCF8075ADEFB504,0x50E917C022B83475,0x7EF3C44F71C37F8B,0x16A48A72BB839BBB,0xB1BE3EE9D4AEC766,0x506D074EF3AC4A90,0x3826B25AED69E9E6,0x1964F07D6,0xC2CD14FEB98F2CF8,0x13F268578DC83410,0x67D7C4C80DD02B1,0xB56A6BDE5B572E48,0xD5E89D01A15D6405,0x4F99A607A314FE05,0xB6EAFAC4383066DE,0xC8CEA83713110C67,0xE468623E8264413,0x1EC9D9AFC,0x99E7FA5253209D81,0xACD5B2444D8823DE,0x50C000DF9CFA1621,0xC6345D5B62857F33,0x80BC612D5D8442D8,0xD56212B5348A1487,0xEED3883E341947CC,0xA1C1425B576F41F1,0x247607A372DDEA6D,0x14FE0A25F,0xF67F8A523D4367C9,0x73DF7C041E13D438,0x9621BC7B7B3CA85F,0xA30B922B87E880F1,0xBE48AD00DD0639E5,0xD4ED70597CAFF7D2,0x4B886096E38CB928,0x7B405A16DD1A0A49,0x6960CD72E611F311,0x690AB57E,0xCD42CAD902D99149,0xE39B5B64E037C9E8,0xB95637F5E75C06BE,0x4145B2D1CF96C0D7,0x5C6EFDE7D37CC7D8,0x657A7A531598AB2A,0x54190188F2B6D5A5,0xE00E4E677552E0F9,0xD45115E7B4FA0EF4,0x26FE35620,0x6DA98D990A9FF2FE,0xFE34B76761FDDBCE,0xEC36B6DCCB659704,0x57AC4E8C9C134C4,0x4A30C8CC8C3FCCC8,0x95B308B585DC0BFA,0x74F100B5C867CF87,0xA44EAED75BF05BC4,0x914BAE2AC00F059,0x192D9E4D4,0x2715A183965EBF7D,0xA070A0407C28827E,0x4AE78FAF8FE3FE96,0x6A5BACF1D5F02334,0xAF6ACA7EB5CC941A,0x42FCBA6B7C587360,0x1E540110F40F3BAF,0x2D881011E3B2FB7E,0x461A43C3837E402E,0x137EA514F,0x3695F33951C14504,0xB0CB8BB670A38160,0xF77B6BC269878E9,0xCD76294807E18249,0x322FDD23F590DF0A,0x8C54C8F16F8D3601,0xD2A088940D205F2A,0x820CA11B0F526CA5,0x1153092032D56D8E,0x2061E61F1,0x33AD900C3AF537EA,0x7D9B68DFD0298A1E,0x84C1BB2A8482C6C,0x8911A37DDADDB391,0x21902A092B3D8B52,0x87B2082670FF1CFD,0xAE885E474A3C615E,0xD94B2B4EC0BFE433,0xCF73A6A6FD8885EF,0x1435CAB1A,0x8DA8186F31CCB35C,0xE3278DD94BE8D378,0x6CACF9187F60024D,0xCD7DDE12459F52E9,0xB8231575092D2088,0x84C454672578CE7D,0x25736D691D8D5AFE,0x8BC79848F9F65767,0x3B71C0972AF9DF92,0x79C0E52A,0x68987EEC5B110F5F,0xD1A5ED71E3E329C4,0xFC2265C5C0188E9F,0x3E4FC714690A1355,0xA5F7F9DFDCE758D2,0x7427EEFC4A74D493,0x821D5FA4D0B9114F,0xFFA64D55AB9523E3,0xC11A958463F4AA53,0x10FB0AF1F,0x6CC0DBA7F8A1D1C,0x14982A1312197F8D,0xC3AE3F2638FCEAA6,0x428A8E551DF80B27,0xD3C912638A6A4B78,0x8B7E61A7AD431A0A,0x3B859D0EF178FBAF,0x3263EB60AE2C556E,0x1CBD74DBE4313D08,0x264264D3B,0x4A0848FEB46F5525,0x774E2C45B37FA2E0,0xD1B5FC7D2CCE214B,0x1AF7DF84B1087ACD,0xE9E9EB8ADCB055D2,0xC1C992323C2F67F1,0x8119B262255632F5,0xDA6319DA982EE296,0x37E736E2EB282A48,0xFCA4A550,0xB158181181AF9A5,0xAB453956397F5B16,0xEB4364A2955CEF00,0x8EFCC9329A862990,0x408B7EDB921E5FC9,0x63753ECBCB06A2E8,0x280C1EE09EC7721F,0x3CA7BE732FFB6367,0xB6333B5293E77CD0,0x7B757B0B,0xEF0749F6AE47FD66,0xFF10710BDEAE9B2,0xF8B9C0A0F1D68FB7,0xA2309B38D2F98451,0xD4C90EDCB0419144,0xDDA4C65E4AADF723,0x5C5A68BD1DC3264,0xCC340531A9DFBC2B,0x29EECEFB1BD3D2B7,0x1A70C3B68,0xF70C3015134374D4,0xCB9687DD90207477,0x3DDEB88F510CEC5F,0x9CB1A6696EEA26,0x8716B587C23DEDD5,0x2C0E8F78E75DD3A4,0xE287F5CC0A607CA1,0x2391F30FD683EC37,0x57ADD940C3B03B56,0x6F9E2CED,0xF95280D717E9859B,0x64DC0F68A02D698A,0x3BA4963116F94006,0x5CC0BF988A5B90C3,0x9567E54DD20466CE,0xEDF794FB0434A7EF,0x396612087A552896,0x53D8BA07D82719F,0x481AF9622367C2CE,0x51A9B071,0xE813939FC65872F5,0x480BEAF669AE5CB9,0xCF899FD775773456,0xE1784A3AEA4FA6AE,0xA8B2C94687FD6F08,0xE94A37C3093FC955,0x12C14FD40831D525,0xF443730F0617AEC1,0xC16C69C59F9F3F9B,0x147EEA812,0x31F592CED49B9C27,0x250CBC1CC4A0AB5D,0x437E92AC008AB730,0xD8F51E6761BEB6AA,0x62188B6F75AC297B,0x99AB79D3EB417462,0xF4A579B59EBC8C7B,0x28A4C8E774E1A2B2,0x5728DBB3F1B89074,0x1AB1E2826,0x6D8F18C93EF7393E,0xBCA50B82EEC3A085,0xD5A445F67D708A1B,0x57E2F340F5B7423,0x5210F5ABF8D21A4F,0xBEF974A855F44582,0xD7EE7F0F2ECB3CD6,0x14315B6FC54DC2C5,0x564F51561AD3E98B,0xBDD3832F,0xD62C68565EAED84,0xEF075C4E2104DC2,0x13CF96F59C6F549B,0x8EDC38B60E532919,0xF3F340AE057AB43E,0xB7D96518D180063D,0x3AB133B391F91F5E,0xAAAA4E2AB1E1CBC,0x92EAD4FDECACED37,0x92A3B9EA,0x9399DB6C07E6CA86,0xA28C4EE0BD4351BD,0x8A433BA100AD45E6,0x5D81E98B9AF71E0A,0x1F17B4D64ED23414,0x99380D895A06A891,0x9F89E8A11E233C11,0xE3DA21E91F2C71FA,0x6B152DA7D3695BE5,0x1083CCBCB,0xE0686C503EE079A2,0x7A3756FB335A5387,0x973CD526E47921AB,0xC3033959F152CB3D,0x3F61C11406717FDE,0x7BD88040365FA1DB,0x4AF9AF28FF834E9,0x4DECE00788CAC407,0xCF1831AFEC92D78F,0x2D732122,0x5BFE2FDB1B6412A1,0xBC5BBF55AC0C523D,0xA874236346EA7942,0x7FE5A5FF21BD54F6,0x11528BD5A29ADFEF,0x35E6015D95CDFDF3,0xB36AEDAC6AE8E613,0x4CC7E30F92314B58,0xD71A3E155AA95846,0x21CACBB50,0x6475A964AA5FED86,0xBAEF8AE877E426F1,0xBFF6DE915D52AED,0x35ABA0B0C2EB4AC2,0x671B67F180C279DA,0xED50CCC2AC609FCC,0xB4A7DE849E0BE87E,0x6CB03A5C64550920,0xC42851CA311058F3,0x8EDE5AE4,0x40E33530FB6ABE3B,0x72F04D8AC7ECAFFD,0x311A7B6387468DBE,0x294B42E38E10D28A,0xA1EDF5BEA2FE1B25,0x83DB5B1DA75FF4C,0xBA24939EA9D95B83,0x702A4C1D65916E66,0xD5855EDCE268F20F,0x12184827D,0xC16B478A10513558,0x1125F9F08B8C1F68,0xA252E07302941A70,0x1396938F260232F6,0x54798F71B4FB0C,0x7F43C5C6D1E43F73,0x21AC041E72B824D4,0x1803A6E354ACD044,0x740DC1D007091001,0x20E7CF453,0x5636BF7D78D1E499,0x9371A0E7B6F8CAA3,0x66FFA8ABFCA3EB24,0x11E40DFF28C81136,0xA9BF42D374F2935B,0xA6324258ED790EC4,0x460881325766B7C5,0xF69C26267FD59AD5,0x8F1FD43C65E0ED68,0x1A86E15AF,0xFFA8F5E799BC9BFA,0xFD1BBAB90D5AAF67,0xD12BD70FF1B086FE,0x31EDD24CF33ADA3,0x2F093FAFAF367025,0x8A5C7E1EB27AAAF7,0x946664C352DC5C6D,0x32A291D20CE58ECA,0x90BB4DCE9C7956AF,0x1A7DDE425,0xE3A268A511E90CA6,0xFD7F8E5EC956B8E5,0xE753B02A3872CE80,0xE4B8DCD115B8A7AF,0x22707FBBE3663E11,0xF5555E185ECD3083,0x158742F446445E74,0x463C212277CF9F30,0x6C24110221ECF7C9,0x8A36C6AC,0xD6D8A1CAF2A3E6ED,0x3365A9C1C57E2666,0x43B3BF55336107F8,0x6F33FB2877BD9C17,0xCE79FA5F1A16056C,0x2709D5AF7EFEFB0C,0x40BCFC1949E7F965,0xB50E0C26674A8098,0xD29B36B957D157CF,0x276D199BD,0x77580F5BC1A76CB2,0xE91AC3F7F262D2ED,0xDAF6BB2A68E8567D,0x70B57DB6363D7790,0xE7E928B2BF22584F,0x582E65F7C6215ECB,0x5428E211157691F7,0xBC6A3BC123CCCF9,0x8651BFCB9D1825E1,0x254A3ED50,0x777F3620554A0042,0x9F3C97A5295B17F8,0xF91C1B343C439AE4,0x6F3A965299C2AB42,0xE0378BD563784EBA,0xABFC393A2CC00CB9,0xC51A02D2BEA0B1E1,0x522356C3B9F64364,0x47645EDABC1D7FDE,0x236DA5B87,0x123B34C921DF677F,0x3E84EE9543B566E6,0x3A9AE4A729ABC3C,0xEDAEA309866AE38E,0xF4DA8D2B83E3495C,0xA5CF67C7DBC1AFB1,0x93537F206973DC2A,0x577C2566F1BF58F3,0xBEEEFC8EA1709513,0x23D70735D,0x69EDBD91DD4290F0,0xA1FF3E30DB198AE0,0xBFF9FB511578F5A,0x65D07ECDA5AB725D,0x967DFA5953B43024,0xEBB4BFCDE877D024,0x7E74FF12BD6987F0,0x3A1FFAEA856C0DD1,0x2DFBC39C16712153,0x10B7CC3DC,0xD3AD7B865C124BD2,0x5D5DD92C39186DB0,0x347E9C5080706817,0xFFF2EF618387B9D8,0x7065937BC9C31264,0xED7E6FACEFB9B6EB,0x629D9CC7E61C242A,0x1F160335CF1F089B,0xA02B47068B5A6E41,0x169A8AFA0,0xF9E0AB9C16AACDB3,0x32C41837878B0988,0xD8EBF8D0CB3E6454,0xFB6188D230B636AB,0xBCFB08808B44600B,0x5CBA9126D61D3E19,0xD9585DD63CB072BF,0xC11EE010D76EBA3E,0xFB3E7784D92D350E,0x7E1D16F6,0x436EC53605F6196A,0x8537E64EBE09B0B7,0x9D6181133D618D6C,0x816FE77353262358,0x98A6013C213D6C49,0xF168E05B6BB92C13,0x8F14A819D7AA6B87,0xE5A857E45D0683D3,0x249274C6EFF25743,0x216A9B3E7,0xDA4444D80D3C87E8,0x7ECDE67E4ED7824C,0x879323C91B584170,0xA33056881C36D621,0x88709BE1DA9DDE23,0x859FBD8FB6D7A2AB,0x3B8AFDDFF427315F,0xECA1604803305F02,0xAE6E9A086C0FEEEC,0x1A17C6DD6,0xAEF015CD7B96F6F7,0x90E629A0064B4C76,0x553AF48AC5A91815,0xB23F173FC5C6C721,0x597B925D59178274,0x8B4ECEC81088CA3D,0x1C457F38A6814E85,0x61A7BE3746C2CCE7,0x92E88882CB364FEF,0x8D35C8FE,0x20438A396A01EFBA,0x6F6CDE14B88AA13E,0x51B7BFD686744A48,0x36ABAD0C72D73F2A,0x488E862920F4BDB1,0x86BC48495BA55C21,0xFA3E0FC67C3CA8A8,0xA35BD562A2C6D2D5,0x1B99C5C321471390,0x2541956C0,0xD6322CD0580E6EB4,0xDACDA8B27A0756CC,0xD2EFF96061435B3E,0xEAE2AA7428E8F339,0xD04ED159B83C86C7,0x63E726F8BCDEA264,0xA3BA2324D9F458EC,0x457F02EB0A6E88C3,0x7ED1E8A04A3F15DF,0x2066FFB3B,0x7113BE1BE3FBDA16,0xEB51A9ABD8FEC9C8,0x4D9E00554A726C75,0xC3A419AA0CD4A9F4,0x4BEDFE9257503B6A,0x33097DA6BC9B06DE,0x374EF9EAE6F28A4,0xA2B193F227B88B10,0xC15FCDD1237D3303,0x1DF4D553,0x162F7301D88461F6,0xEF8E766CFB85094,0x6F52E6EB1724E4E6,0xC5DD10FEDE0F0AC0,0x8FBCBB34AEBB8EDC,0x10DD79A60AD0F64,0xF1CEA60C09A3C395,0x86FC4B2547371DFC,0xB9FD773601DFD873,0x1780627DD,0x4C3758A48AE65E80,0x8AD6BF7BABA2CE80,0xAEEFE0AD989F5AB5,0x8EA18380EEBFE0D1,0xFA0FF63CE7934BC8,0x9F50AF05AC5B0674,0xCFD57EC9B8B22E23,0xB724F8362E11ECFA,0xC60D1595B23A2313,0x11FF99454,0x9FDEF5C0B0BB562B,0xC02BAB260CFBF6F4,0x76DE28F5D52790D7,0xFEC5D4906BC836A9,0x6093F1B4213A6291,0xC901154A8D722C88,0xC4B09760E1626222,0xA62F4E6817134E71,0xFD140C4F9B73E8E5,0x1BACFEAE5,0x5D8A6FC429A8D1B3,0x29271F9A5424D169,0x5411BF74B6D9C53D,0x64EF0123BC7F0EB0,0x68D9A5DC52C1397E,0x571068D43A94A36C,0xA92619B7573082B2,0x3396E91D4E8A07D4,0xBA33A8D744CE3B04,0x1A277F952,0x4AD9CEDFC6FAA211,0xFCB1144EE1119210,0x1946AAAF2FBED6D6,0x7EF79223110A5F4E,0x9922B175A0AD3CD5,0x38F5FFE76809F5D6,0x5B32245BDF6D411D,0x9409EA81A45C789B,0x5D298BDCE0A5FCC,0xCF8DC03D,0x80EB4CABFED964E,0x2207E93F07E8970D,0xCB6DF798AA4BE338,0x789C6B3B3C5C8DD8,0xA44386ACE9979D3A,0x903DB2EF933E117D,0xE18CA1FB7EE59AB9,0xD3FE1C3D7AF27C5D,0x2498A82EB73FCE2D,0x386F9218,0xE5317A1CAE61CCA7,0xD98E03B4FC1A382B,0x1318013FF5EC6C32,0x51AE2030AAFD362D,0xDCE6427466C82F3F,0x4DF13A03ADC8263A,0xD5CC1E0935C18F4C,0x7423DA711212CF99,0x6D9533D87D8DAF40,0x4192B78D,0x4EE039E89FC26DD9,0x648D935D58D6399F,0x6B4F9A40C0B2F0C4,0xA4C134604FF78162,0x81C58D381263E526,0xA7695474E12D0D9C,0xC123380627E63E8F,0xDAD463D0272AA84E,0xD546705752D96F82,0x7ADEC833,0xE73D723D7D49202E,0x1F0B2EFC9A735323,0x185C7E117416E78B,0xDB904E1C379D2296,0x1B8D017C0D6493F9,0x14E81715D5803104,0xF5B6A16BD6B27C3D,0x70F73C37770547E3,0x86C09885F37852E7,0x283874B6,0x148BB217255A8A0C,0xC8B10C6C46D7D8B7,0x13266FBAF4A66BAB,0x9E522CD7E8F82E57,0x68934DA363BA85F8,0xE6CBFCD7B60B1621,0xD69099F4C9F2E449,0xC0D24D762940047B,0xEA56388B1A6C9CAE,0x819DBB24,0xECD1AE7DD43D0F34,0xE044AC22F67BD3AD,0x6EA7482C06E957BA,0xBA47E605B2CB61EA,0x760037CA8425BC80,0x366DD718061ED781,0xDCB44CE1115E2F43,0x99269EC50EB03A7A,0x3BCE728481FEB448,0x2112DE017,0x2C7B44E38217EBDE,0x8F11CDE138C886A9,0x5D4CC8DAD54C4DFC,0xD5713B3AD112CB80,0xC74E158147F82D6A,0xA7F82D57F2DF1166,0xB44012C420000C81,0x40B57170A73FD827,0x92A0107A8670810A,0x8D4DBB98,0xF702A7C7CB79496B,0xDFB92382C540AC84,0xC8151655C10821E0,0x1FB86937B3543AAD,0x6C1FCE5F2B8858E3,0x8D60E554FE1CCEFD,0xF19B992818CA8E37,0xB6E2C6DF2334C1DF,0xFB075EE76AD27661,0x1F363BE3B,0x3E866490DC9FB2E5,0x179B50648DEA4EE8,0x3E183099DBD6DB12,0x47A814B248DE1A7E,0x16FDF2EA9D540572,0xBFA10BA2F1C6F6E6,0xBD6BE78F91327EDB,0xD77FFDE8E30E03C5,0x78D289EB5FEE8090,0x1259693D8,0xCC422D94F2977AE9,0xAA6DC80FE183CC4B,0xCF2AC8B48FDCF252,0xF253E4E2F3B30FDF,0x1DAC3681A47DF33D,0xCD8AC85AB040453,0xF37AB8EA1FA1BA49,0xEE83562B3B75E59F,0x78684C1C962EC1D0,0x179D294AE,0x35688F8602419B20,0x59AF499FA9D421FF,0x2723DCC6A22D44F9,0xA5D743590968DAC2,0x98B12A290F52F46,0x7B96783997C8A377,0xD1269DA8FFF6A507,0x2A88CB4DBA5104B1,0xD46DA0801D699919,0xBA6C4725,0x9BD3B62395A84BD,0xFAC4FC0F7A14099C,0xD8A4DFB00CBDFDDF,0x2F5882FA3888BCD4,0x35CCD96C9533B5F,0x913C39A5F47CF441,0x1CBDF0349C91CAE3,0xF196AB1E3C6FEE71,0xEB2077815F41899B,0x20C509914,0x4B090288B7607AE2,0x5C581AD9F1938FEB,0xF7E5291EEC33F408,0x889749764C12F04F,0xC1E7DFC43D6A413A,0x41B760283740E219,0x88CA05E1A4B70D9B,0x1AA68B9E22EA35A3,0x8011524B50A86324,0x118727E87,0xBD562910BAE5FA4F,0x4B4D6FF12A1ED5A6,0x59BB103183F121EE,0xCA6C0AB8C8B79516,0xB5A80EAAEFAB891C,0x9D6BAB2A1CDBF24E,0x2FBA762AFB2C032A,0x63B637301AFA42C7,0x8AB6D8837774BFF,0x14D90D7B,0xFC3CE8CF4DBFBF6,0xA704FBD2A717A6A8,0x8D60CC52C1C8E8CA,0x49246B23CA597F74,0xE212FCEC68217DFC,0x4B30B4BD70F7FA3C,0x6232FCFD1876B87A,0x943F8CF45FD45DB4,0xCB8B27F23CD55A4F,0x1E0F638A8,0x1095A60724CD5110,0x65DF9F5809F82F31,0xF8B0DC608A4102A2,0xD9E5DA09443F7FC9,0x6270B1A553E91888,0x807FEC241BD2AE8,0xC8062CCAFF54DDA2,0xDE4784C70587091C,0x89959A559C0F19AC,0x5D1089BE,0x902F800E180798C1,0xA81C844508280F81,0x927ADAD5601B28CC,0x411D1C2296D99AF8,0x9A13F9ED78999C9C,0xD38D96551856DBFE,0x2A584BC023E018FB,0x50D5C6760E5EA6C6,0x4F27267EFD4A807F,0x2F54CD46,0xC274B99634D8A0A3,0x72A3C74CE5762902,0xD239B76250DD976B,0xF954CF84AC18B8BF,0xBFED11DB8861EDE5,0xD8D53E0DBF7C6DFE,0x1FCBFF97FE475B70,0x92ABE5001B0F4F46,0xE56E09F454C33AF5,0x1CEBBFA90,0xE86C6399D4D114BE,0x45BFB848CE888B2F,0x17D48178643E7586,0xCE7E6A92813B5B5,0x46C98E7C6D4AAD3C,0xE3C1A8AC6BA22888,0xA5025E419C0AE9FA,0xF9BE4D1E767EB2D2,0xA4FC8666E88461FD,0x5FE7214F,0x35FA70A5C231E0B3,0x469B7025743E7639,0x49D4BF2C4EEB357D,0xAEEDBD59A86E8940,0x27414E3DAECF6729,0x1DB9E6261193D400,0x928C2A524A9B2549,0x4AEEA46EBBB39A5,0x71419C5CED4B2FB,0xB8C7A989,0xC0B7F0B44DEF0A01,0x2D7011BF2DAE1D08,0x67C01E90C4BCEA29,0x9B5484A2535D12FC,0x14225E77A0BD6734,0xAD0C8AF0CB6DC19,0x11305EAE3B82FDA5,0x315F40AE4817BA85,0x8301BFC45BB943AB,0x29B0FCE5,0x2877C9DDC44CAE56,0x2FBD434FE5F7E2B6,0xF2CAFDC2DACFD98,0xDC49749A67BEBCC8,0x1A08287D00B68DCC,0xCA690E0CF7C98D6A,0x9449CBBBF9FC75F0,0x3C7AD3E71EE9F58C,0x3A15DCB751FC9025,0x19A362986,0x82CA4E6ECEB79A58,0xE0B871BB57F17E13,0x4769A21E084089E3,0x5C12B7BA5823F670,0x65BACA97A2AF2110,0x25EA1888ADE1050C,0xE9A6A73D2D060317,0x6A371E0BC5E7E5B5,0xFF8F4545EAC40945,0xFC12A249,0x5454AA387723A2BE,0x38B1BB7B546E72E3,0x9685979A8B3F9F6F,0x97AD5E60492107ED,0x62E4FBC43505D8AA,0x93F1EE261A0B8BA2,0x184828798BE0B5F2,0x7047885D7820B8EB,0xE2FEE6A0DCCEF7BB,0x14965A8B0,0x37F11A78944948B1,0x899CD0B3BD671C70,0xCCF6BD27B068E075,0x1A90F137B129B583,0x7376EEAC81593BDD,0x4AC3946FEB066943,0xB542E531168A76AB,0xF8A25672D6535820,0x1042FE32B78016F4,0x1D32684EE,0x1163347F69B2D5F9,0xA49964E1646A3E76,0xB9453527AF4D28EC,0x7019355C72A5CA2C,0x829DBA330ADB94AF,0x6839DB946D1115F7,0xDAB1C15DDCCECD6A,0xD44CEA758E1DD89,0x538D5A67D84B05FA,0x17516A4AE,0xCAAF29360E9A5701,0xEA7757B584B8753B,0xA7F0E6CB5410688F,0xDFDAC76B2FFCD760,0x7833F6937C8D72FD,0x54A1AA01045AEC0F,0x2DEBB610FD92079B,0xCEB1FCFE019A0529,0xEC857C1859DEB6C2,0x155494636,0x71C0B2E6894EB5D4,0x68F7271835C2D3D8,0x7D8781E37BE60475,0xB27F2D198D1CA19E,0x8C2C6F707342A6FF,0x6E21A3FFA4274A19,0x61D0CB119A2CC732,0xD8D65E2D17FA8E9A,0x444B30F3E98E3CDB,0x4C14FB24,0x7FD621F5D2E70128,0x197FC3AEEFD33149,0x3CB609B7CBF11BE3,0x5F80B07455A915A8,0x1383BB02F180F634,0x4EEC651DA931D216,0x15926496A1E2F997,0xD4AE9E657B3EE4F,0xA68C84BD528C0BE7,0x18B173214,0x5F3292A447258E24,0x3B926886150811A4,0x9186A215127FB9B7,0xBC153ECC47E052F1,0x6881EC4EBCD7D0F,0xB3B48F6E4044445F,0xDE93FA421DA1AD5A,0x53090D0BCDA6B7F2,0x4F766C08FA109585,0x1FDC9769E,0xD33AEF0ED2A557F9,0xDAB77955397F17C,0xF2778BA68D6CEB9C,0x69FC75A5CFA97247,0x2938558A8ED9E098,0xE4A081AEFA645EDD,0xB347E3FEBE2640CF,0xE1C3B06E699223F6,0x8F613CD6447FF634,0x15FE3289,0x2363317AE79D0C47,0xCFF835C9F253FF8,0x2CC96ACA9F62D3D8,0xAEF5112F8A437846,0x8517D6666859678F,0x7DF254A75BD30254,0x83076C1711597FF2,0xCB029A6E88C92207,0xE9A970C05A866594,0x1F7A63D14,0x8CD6A931E97C3456,0xDC1764146A08AF29,0xC7685ECB81D28C6C,0x1AF887757771DC59,0xF7EF069239FDD6BC,0xF707A114AAA12631,0x9C078F75A9B54EBA,0xDED8D97DED48FCB1,0x679843B3EF48C3FF,0x1B964C660,0xDDB486763F06F320,0x4634772BBB143A9C,0x4DE685EE96C167BE,0x4661C2D724BD56C1,0xBA63412DBC825EC,0x723828B91E465418,0x953D4F1DCCEE64EA,0x392CBB903E735005,0x2D019B3529F344FF,0x1BBFF0F4F,0x30BF54DE29569F0E,0x975CE2AEBC66E171,0xA9D3C292C7EE6A42,0x45066FEA0B53A031,0xCA5CBDE72799B70,0x9D9DA7B773A4AF9D,0xC3644C512FB11D4,0xA3582D9965F6EF4,0xDDDC290E7A6B9212,0x172A5B9A3,0x821F0140E1705C0,0x11E0A4AD1C3F6F7F,0x12C2613E2B87D44,0x34B259AB88BCEF3A,0x1AE07C891B7EF01F,0xD7DB8E80C98263CC,0x90D69B01967F1F1B,0x2FC8F40049FD6456,0x42E22CC9359E722,0x43455035,0xEBA847C188CCD36A,0xAC622772976619DF,0xB8341BA2CAFBD2EF,0xDBEA543CB3C4B1B9,0x3303F7798853DA51,0x27B2C820BCFF8C1D,0xE8BD773986ED9B69,0xF0B2DD206D16E51B,0xC64ACD2174195435,0x7CF3CC91,0x6FBFD9A172D5E78E,0x30CC34E989167A59,0x3A65E8E14C0CD5EA,0x822F01C2E60A208,0x5C1C73A9ADB237D,0x783621918012CF44,0xB6F4902BBBA7112D,0x628866C03C33CF4C,0x563FDBA0DBB8D1A5,0x18A8F0BB9,0xDF272FFDF7E7FC4F,0xB159EDC59C7B8B8A,0xCDAE951090816F8A,0x1B1EDB6010EA7ABC,0x68E90969A8C79438,0x49EC64C41386E662,0xE015849C5BA3E307,0x6D7581CCFAE88851,0x83CCCB06286B59F3,0x926CE5AC,0xBEE252D98E3249A5,0x908EBB709B019BF6,0x8BD04DA514196F79,0xA11F3C9C70C57D90,0xC5757E9A1BFA3158,0xF33CB1FED10DB901,0x7D5A2FC86723BAFD,0x3A0DA0AF1A118CF5,0x7AC5D0481AB852F5,0xCA943EC5,0x675B7AF962EC05D2,0x62473D2F70D6C9F0,0xCB9E05443E339C29,0x2129DA8AFAAC1D55,0x67896A0F74797A1B,0xF0AFEE8D40623F47,0x8AA7436FAB9640D5,0x309F79131404576,0x16DFBECFE42FE52E,0xBFD6A13F,0x55D4DA4A61778360,0x91B93A1AD4A54D3E,0xE9363E5AAA914C28,0xB50D8A93C9498413,0xBC1B999B3394FD2C,0x3CA6D99F828BE538,0x395685CCF002C1FC,0x961EA8BDA5CA5678,0xBB0BA0E88D762CFB,0x99DDD956,0xB08C2663F76EB9C7,0x2BCF63D1DDD1F17C,0xE917FAA78EF918AC,0x8EEF6BD28BFAC18D,0x7DE4C31C0FFEDA16,0xB84D0FD3075315FA,0xFF47B5385E700F00,0x9EE433CDAC56E51A,0xFC24F37F27C83BEB,0x4AAD114E,0xE9B7A52E31C1F3AE,0x71573C4FF0A76A26,0x57D0ED77434E5CBF,0x839EDDE47DC4610F,0xAB694C56154462D8,0x11F44C3A66ABA18B,0x3FB58A5F24C80CA,0xF364A634DC7ED0E3,0x370E0A8FBE743138,0x1C975EB05,0xE3FCF14BAF3B1A47,0x362703A38AD4C210,0x77C93452E32E8923,0x26CDAD538513A132,0x38D14266C37BD7D8,0xB10C2D4EEDF3D99C,0xC5A145B30C8EAA78,0x16BCAA2B707D5063,0x50E7F0E9B432002F,0x16FB52C2,0xEE5F52AFDB1523D2,0x36FA88DB296D86FC,0x1672A60EC0DFBB1A,0x1033DED90E6FB262,0x789065686AD1566F,0x40C28454500B5A26,0x9C064A84AD5E6BE3,0x9200254BB9F2812A,0x38F203CCD36ADB3E,0x15781A7D2,0xC4C2AB01EAAB9700,0xB84010F257BF3CE8,0xCA9DD630CAD705C6,0x77325E1AC04971ED,0x5E4BEDFB26BF19BE,0x86F4242ED2F07DE7,0x6DDCDED7F662EBEB,0x5C6C6A8E6B53E474,0xCF98A6D646D4AAB8,0x13AEF5564,0x51B21F584F5DBCD8,0x3C8B8A75317E6B7B,0xDE16F1F92CA7B3A5,0x12318ABBC6D6449,0x6008A9FCCB6AA3AE,0x85D926F95CC51,0xE2A6720294D87582,0xEDFF9B1C43E250DF,0x6B925D090E47749D,0xFCC0010E,0x979FEDE760C14BD2,0x99BAF6F8E7EB6C45,0xF44B01AAA482D903,0xA16216CDED7BE627,0x411A33EE5195322B,0xC5AC1548A02F5AB1,0x327EDB4FA69ACA07,0xF86981024A3CA940,0x1880878B369AD4F7,0x8F21D122,0x29B71B1F70A3C80E,0x60E9248865695529,0x138EA6B1EE9EEC4C,0x4A302A2EEA385392,0x7E95694398C0860D,0x1B6B1E5C0BA383C,0x17FEC4A0ACD3BC32,0x48D2DD74B8E631C4,0x90B2ECC50A95DB10,0xE35DCAD4,0x3433A16F1C7CCE3F,0x2A56EBC7A99B35A0,0x41D9B318B5E4F0E8,0x4FD7E6375C7C9B65,0x27573761A9BBD6D6,0xB8D6A88416DCCDB3,0x2B0FC88A302E7813,0x60D3BE7C6CF7825C,0x88A01595C44A74CB,0x2444009DE,0xFE30F921B9AF4E5,0x594873CA86EEDB18,0xF4CED20919508257,0xC266CB2E39F17BB9,0x22E4895B0FFACC41,0x714790B82CA2CD7,0xC610CA38B950F7DC,0x71F29B53B563D028,0xB6BEFF7D683F570,0x128AB96BC,0x6212298A98C9473A,0x543CBA01F49CC064,0x391D6C395783651F,0xCCE8E2E19D9272D5,0x93422B72E8C2A528,0x5E44BBB49C58859B,0x30727D38FC0F8BF8,0x737FBF11BEF780B5,0xCA1BB1A94938FCA,0x135F4D059,0x52E77CB5C7B9972A,0x1B289DFD7BC1C99D,0x958045E8C6095D7C,0xD42E417B4D0EC364,0x2C4D0A845FE1028C,0x2B65E13CAADCD0CF,0x5889AD67B7FF17B9,0xF90102EB4770B48C,0xF9C0C840E9CCF318,0x11C501390,0x262C242BBD3ADF03,0x8A18AC7AF362924,0x5836D21084F10D36,0x835502DA41D70A50,0x6F46EE673EE7D25A,0xC8B7D2CB4425613A,0xE0162A5CBA451924,0x881BACAB5882E411,0x3A302C5F68BB77F9,0x7FD87FD0,0x75AD6F9C236E2F03,0x3197C7280269B830,0xC6F8A876AD13E858,0xA27E9A4388F28450,0xE4F0BA8F6D4CEB9E,0xE9A03364729A9DB0,0xA23E8ABF11FECE99,0x57B7F78F8BF9D834,0x367A63AF6BDFDCAD,0x21FD34797,0x1F95F740E647EFF9,0x923F3F710E493714,0xAC3E51D842846883,0xDF0E16E0DB2FB8FE,0x4623CBD9B6FB97E3,0xA4C389D09D1173EF,0xF570F10C796AAF7E,0x41BFEB631BA43D6F,0xEE0736AFEA475A7D,0x122FB3DFF,0x33526EA9B09D4AF6,0xAFD042C75CFAE878,0x4AA657CAF12FA298,0xDF26DCB813D3E437,0x7BE98CB6A66F3FA7,0xCB341E15FE0BDAC4,0x63BCB23C77C4011F,0xB8416F876A16CE3D,0x725D71C24366063A,0x9CE65898,0x2134A26340844DBE,0x8EBC8EB2FD5E99CD,0x99D16A746EF9F945,0x51D61761103FE055,0x9D8171AA18BA47A5,0xCD19285C220EFD0A,0x22AD713C2379DF66,0xF4FD8885D0CCBCEA,0xB871B10DC7A30690,0x19DDE1358,0x39EB2DEDC22A0FE1,0xBEC7071A6FF42BE1,0xC8F452458532C395,0x31CC10386D2B205,0xB08A26B8BE11E93F,0x3149EFA42C9C817D,0x775A0682F3C44714,0x6291AE8308BEA5E9,0xD59DC3442404AA79,0x20C828731,0x879C990A387FB32E,0xAE65C06A5872CC03,0x57B7C898833B2D58,0xDCC3DB595183D534,0x36455BF1C1A3E77D,0xF4A0B2DF2B88AC5F,0x934666C40F91624F,0x33556CCCA30EAD3E,0xAAED9BC159B74950,0x249BFE0C7,0x4930792345A4D10,0xCD9A64B5D6BB4A08,0x6EE04B3CC77D6A7F,0x9CB1AB41757F21B9,0x8988A63FEEF6C498,0x2919B3F88C078BA7,0x5FA732D8E4157AB3,0xB333357E21F71CBE,0x40A9D4C68B71C0DA,0x1093CF271,0x5227AA829DFD6EF0,0xC055A518D0DC4D8A,0x7481F649B1535602,0x2106903D0E525D3B,0x6CABC5F1DBB94C44,0x95426B7C1552F32D,0xC411EB396FCDBE1D,0x3EFE4FCFDBCB2BE2,0x67DE64A99F9B854F,0x23A7CD137,0xD503A1ADD9BBE846,0x56BFBE73E1C79B6D,0x6545C516B68047DD,0x43CEA33296BF0788,0xF8A81B4742FCB8E8,0x302230EE8FF8D25B,0x68FC57E2BAE2B36E,0xF5CDF3B3CDFE7D1D,0x9E6868DD51EC4D27,0x1937E1283,0xEF81154AD419BD92,0xAA7C9FD744BDC27D,0x75151F05ACF949E3,0x1E59694005343E56,0xF35C18022226B6ED,0xD2C054FE3EE91406,0xBAB5DB38C90EF885,0xA08AA75FA78FA524,0x6A6C0E1CD110A1B2,0x29BEA51C,0x3819F6F77040D064,0x510D469010C5EF4,0x14A5B13CFB8ADA4C,0xE8660E1AA918CADC,0xE608BFDC51056E8C,0xB528BB46F8FDDE72,0x7B8577321F09E4E6,0xA6896E180B266485,0x7044BC400C02C48E,0x9A9F456,0x5547744040316A21,0x3147E6C78C675713,0x4BFA12E96360153B,0xDAFFC5673517F2C7,0x642BE96318167100,0xBD52D63F10C3331,0xF3903A11F51E00A7,0x7F7D1924D17CAFCD,0xDDC5FA6A2D3DC4AE,0x203B450B5,0x5D86D1206AA396B7,0x6944111EC44FE894,0xA30E65512D120BFC,0xB13E65F1EE342406,0x8D3B1D1EE670F437,0x1364B816A2540C71,0x7552C9A0B9FBD51C,0x908E0172BFF212DA,0x912053457FF066D4,0x11E39DF1B,0xF6A68B941EF5867,0xE878D0F41F672F9B,0x3496F3C6BD8A5565,0x1177D923A511EE2E,0xCAD72C26B371681E,0x804A7D08581E2B10,0xE6F463F0EBA1D8A2,0x1852BBED6821DF72,0x8D21D1F251896039,0x1C3F0D8F5,0xFC9BBA32AD547787,0xA9388064DDE7EDEB,0x3D090C1D8356AF7B,0x63AED41335A8B5C4,0x206F17097FA216D5,0x5A5F3C3AF5CF014D,0x1949909182AC8C62,0x81B02D80174D7CD0,0x1BE487C21DD4C35E,0x554B555,0x1557A14F9368D13D,0xF5FBA60310C20773,0xAB286E57F9E3B29A,0x308518F4218C1EF5,0x8587A08DB99B00E1,0x6F8D533F21B12051,0xB3F1AC4574137EA6,0x82E817C08D1791E7,0x5395175D8FB18D3F,0xA9D62CE8,0x4239683AA4F41392,0x217EED40787E5245,0x96CCFBE3BD30E3B8,0x71BF79315C899291,0x222BD7D08962FE80,0xAAB78F7542CE4EEB,0xE283E2C26174BD25,0x54669EE079232BB0,0xEBA70BA031EA7FA0,0x26A501757,0x1C6448858886833C,0xF14979708F021572,0x3060CFD58945793B,0x3E7F1242A680B0B5,0x968C1C9949498BED,0x9ACE085F9EF74FD3,0x8B4C72F7C953C6BB,0xC25C0423E2E8DB92,0x38B75166B8771DA6,0xE89AC5B8,0xF6190A9C1B684E74,0x90BAFAFDA3AF583A,0x5EE0214CEA506247,0xF1A62828904C2AE0,0x88D628DF9E492BDA,0xA9B8D8D851FB9AE5,0xBEF4FE74A4618B70,0x3A862460CF07FC54,0x780A6C213BC320FB,0x23BE75A6A,0x6C35872D65DF98BB,0xF16CB3771B6BE2C3,0x2F57117CE72CE3B3,0x649BB0718F4D995F,0x57CE5F63F88EB1C3,0x93918FB833D97864,0xB874CD4B852028EC,0x171EB4788ECD58D4,0x85537FF8FBEE28B,0x111C068DB,0xDF3CC872D523E59A,0xEE4C8B8167AF00C9,0x38B25D20FE9AC4E7,0xAE41E9C3F3104E9B,0x1C9C4016F21A3B90,0x4EB321BB2E76C848,0xB599202EDF307E7B,0x5D7CD8449D0F383A,0x7F8FE11BD4094B9,0x27B122D69,0xCF07A09D0F70C54F,0xD0A4568010F575FD,0xF15EA14FD3AF7237,0xCC8FCF407B08E328,0xE4FA80B74AA57995,0xF2D611A54631461,0x8365E3995C6421A9,0x219876DEE5069094,0xBA65DB6C9B340D1A,0x1F8EAED0C,0x5A4B92DBB1B4B278,0x689BB4A63B1A5D63,0x8EFD646A96E440F8,0x8FF1A558E7156CD5,0x461595C7CF504C27,0xFC8B4C79ED6F8070,0xBE9C81FF48D0075F,0x2A7F915514705A7,0xAFF239EFE2B998,0x16C2F9DD0,0xBE1DEEA6EC39B7A3,0xA61BFD2BEF8052EA,0x31A88CF6DAFDE75A,0xB760F1ADD3985333,0x48DD9D0A9DE899A3,0x4E67179562476E5C,0x1365CAF0D26172C4,0xDBFA4FDC9A238A5A,0xC469680217EA154A,0x6617C4E,0x39E6B94E08A17363,0x916593232A75D554,0xD6A7CA11770D7736,0xE183610B5F6DCE86,0x1CE25B92AA03796,0x758E9DA7BF4AEFE3,0x7AAA65F900661107,0x97F2BAE8C9213D0D,0x14DDFA2AC2CFDC7B,0x27BBF7CE,0x6487B6DCE6D171A4,0xFB823A93975A828C,0x5B6AE73BDA93CAEB,0x6F8428F56370B7C3,0x5B96CDB2A0B996F6,0x30A1ACA80371046D,0x96C7A4351731CCF3,0x82B89983C24E476A,0x1FB28BC05169BAEE,0x40F60A3C,0xCF7A9BD525BE4E40,0x33CF07B20498D48C,0xCE09CF397844F5F8,0xA0A0D4BDCCA6B277,0x229FF2B196E00018,0x5F692059EEA58227,0x7BD02F4231CDF482,0x761AE566A251DD91,0x4214F00522F47DC5,0x3C12D6EA,0xB89EA455F87FD5E3,0x42FBF7FB7393D840,0xA019BB0F1808BD3C,0xAAC9CBF4D72E27E4,0xD6341085D216AA2B,0xB7B016F84F75E742,0xCCE550E3B2B92383,0x81CD2590F36C4F38,0x9AC4D9901A36301F,0x204AE52E3,0x4922F1655FA57847,0x210B06BF58A67C90,0xF299E828A2DA6E16,0x8B5085221D47CB28,0xBD75ECC4B5B402C0,0x649978A2C9D79727,0x6A5EDE1C0CC43D19,0x90A1307ED7CF6C5F,0xE9C4994008F75652,0xB814CC33,0x5C1FF6821F331C20,0x46E94D9E1EBEE1E8,0xDA7D6282AEDC7A8D,0x10929600315D4671,0xC3ECBDC5BEB22538,0xEC09750816D8036,0x7E7B4DC345EF0902,0xF9758F1BA09A284A,0x7D89C5C979B1771,0x2463A4DC9,0x7090877F9854D885,0x31084946A829C556,0x6273A79F45C28EB7,0xD7086169C9BC5016,0x440E09D9BADCFAF7,0x339B49DB210FF5EB,0xE0495EC1F7FDCA08,0xE67F29B1E9BD0A07,0xD1978781C694AC5E,0x13AC50DD8,0xC560E4065E90AA53,0xFAD02BE288ACCB2E,0xF940B407BDF1EA48,0x20918CCB13208255,0x26B5FE30AAEB5DA2,0xF5AF830ACFDE6C29,0xD2EAD8013BA79D8,0x6A1E63F31FD7E397,0xD526F6C062CF5A78,0x7E5D9C67,0xE37604009CA32E26,0xC02B9B3FEAD16808,0x76A1BC4FF65FCC94,0x4BE4B800E040B6F6,0x3552A2B3EFEE89B6,0x41D822BA46C78B20,0x8E81D1AA901641C0,0xA641EB9DC6FDE9BC,0x4BC3078B7BD4B277,0xD5640902,0x37C202013E404643,0xBAB52DD5E4F3E8C2,0xF112A70EAD977346,0x4B0DAFA6AB93FA8D,0x944A9148B1DB4950,0x302E3A118E146C96,0xF49E59FD5BD04DAC,0x2CE3152E7774CB26,0xF53EA204DCA25876,0x174D5B4D0,0xC826DF58F492733C,0xF245FE342F24A252,0x9F25158B510DE4FC,0x2AA6B88D55E291C1,0xAA2177C3A7F0D5B2,0x3F32EDAC6B0D8AD2,0x248B54FB1D1961D7,0x1F5EBF993F4EBDDF,0x43DBF5C0607E0EB9,0x257FC6482,0xE511BEBEAA7D3865,0xF1DCD4061215EECB,0x32ACA3701F3CF70D,0xA975FD59701A8F60,0x9B58536B38FB1A5E,0xDB35B07B5C9ADC0,0x47B014A4114E7534,0xD1587C2A7621E058,0x9CA234BFC699440C,0x16FA3E0C6,0x56F559CE632DF355,0x26D3F45D5905133C,0x965AB499266E7EEB,0xD90472F397F8399C,0x145FBB0CF2D593D2,0xEFF82599176BC6D,0x30D514410D5FEF22,0x97FA567A5A6177B2,0x772AD59EA65547B7,0x1F416D202,0x1DBE01DC8F3AB1B7,0x8C3AE2DA30CB895B,0xD22785E1E012F59F,0xFA82AD24AB0830B4,0x1112275FF59A3A8E,0xB5D2684C8A3B9699,0xAC31346A94D4D9C2,0x90657BFAE6FF2D41,0xA2CC6B923EFD554D,0xA4BED5FD,0xC65A5C1BB74FF963,0x249571E0EA22794A,0xCF53E28C51B6211A,0x8FB18566AC5387E,0xFB19F96FDA568AF9,0x4DDB668BE351EF26,0x2457E45A6C6BDBCD,0x62C8348E355F5829,0xFBB863051739F28B,0xCF85470B,0xF2E0000D46338351,0xBD0D5BD539B776CB,0x254410486181B47C,0x167C45AF7FE16AD0,0x7A2CE07FD4A4503B,0x3208339676144E58,0x7C1481FD34277EC2,0xBC673AC7BE5DC631,0x83D47C9F71D7342A,0x2372F93E7,0x3716FF7C8E998761,0xB06DAEB5E20FE8C,0x8F997BD0E6B55442,0x8F2183C3171016EF,0x190789E9B8DF3E60,0x8813BA74332E7FC4,0x9613DA582CFB276D,0x63CCD48063EC7AD9,0xF87F3B6CF1A55823,0xA30D5B7E,0x30D52186FFDF16ED,0xC536BCCFB31C819E,0xAA2593C451939B95,0x1AF419ACBBD2DCF6,0xD4498E1DEDC301BC,0xB80D17695D0EA461,0x57E7EF0D3C1B668C,0xE3098D920847EF29,0x9B5947DAA8E2BD6F,0x418A1E2A,0x2D8F7C8F03855AD0,0x7CDB80F5389E9A24,0x6EA0B17ACD6FDF81,0x571246898255430F,0xB8292359540B4FE0,0x30A01152D39648CE,0x350E84A9B5C2513E,0x200F37CFAE8F5DE7,0x6A51FC6C46588BF8,0x63C82EB4,0x7C5B346BE4665C81,0x134982140E3E9051,0xA0CD5411E45E1399,0xE264BB0F5A0FA777,0x1AC9E2FD5A2BD44,0x9AB9BFC5E4F6958F,0x16DD6B5EE09C0388,0xE4CFB5368B542DA6,0x68614FD689AD3A0E,0x112A7B495,0x7C4C34F40FC111BE,0xCE682FD29226EBBC,0x85C365AB824BCB61,0x1D5895BF19AE0611,0x9353B29D85C49EC1,0x3AC9A26DD8132671,0xE2B413BFF8E648ED,0xA5599C9174D3D5FB,0x7DED62C2C8B5456B,0x14D865ED,0x853F7F132C14CAD7,0xA8C09F756E92A137,0x5EC923465F9B34BC,0x87789BB414651B25,0xC83CBF0F32B4CD8A,0x39740D240E839879,0x1F7DD4C1A7A3EB5D,0xAEB19848D8268106,0x7274EAA057DADFBD,0x10F9FC811,0x6ECC70CBDE81874D,0x39813012CAAB451B,0xA06854EAD62AD1EE,0x3694D7E848860C53,0x2088E6E298B40F35,0xDF12F3198F236FE9,0x4DB836A96AEDBE94,0x327B8FBB8C00DA44,0xBB12A05153B4DDA,0x179E6B750,0x2918E9AC3DF4FDC1,0x1935DBDC11DAA6C7,0xE87F1B2EB0A44EC4,0x354D54F242EFFB1C,0x4081FE0D4DDDEFAB,0xA0B94FAC32252393,0x8D999620E35A081B,0x2FA06DEE0E5EF036,0x6AB76BE48C9D4C21,0x14D4492A1,0x9712A255018A5FC0,0xD24ACD1D6ABFD090,0x25ADFFD4DD6596F2,0x67B5BF0813BBE8DA,0xF84D6809C79612F7,0x965F91405DABCE54,0x114D6C340FBFD33D,0x7CA7FEEBB023E5C6,0xFED5ABC4F28026E7,0x19115C797,0x580FDD3BFB83E933,0x917C5FA6C4C1477B,0x8C34F1EA30A2CCD4,0x724490382611173B,0xAF2E73CA8DE4438A,0xB375C99573372956,0x4DEB6CFC74A22395,0x6FC713D9DBECFE6F,0x21FABACC37346618,0x189133D37,0x4A03FF19271F65BB,0xDF9962868B61FB38,0x71EE51ABCCBEE3A,0x2A0F995F0C8245D4,0x15F827C425AAE403,0x4D703CC492261B94,0x73509F22789F138B,0xBAF40CCD8B4706F5,0xCA9159E5B1B250E6,0x1603B620,0x7EC18AB851FDF5E6,0x38D7516E88AD2575,0x6009D233D30C9B67,0xEC48A6B1AAC75507,0x58244884B99B818E,0xC29D763B16D41B92,0x62F6AD24EE37E29E,0xC1F587A52C9A594F,0x96D748B55592B288,0xAAB191FE,0x9873B19434E887C3,0xBCF450FA7AFA0FD3,0xDDAB08E991CB1EE1,0x1CBDDBBC1E517DEB,0x450110F007F1C734,0x7C2D7F1D34AFFAF3,0x4EF604A608DD3CB5,0xB22C94B3D543FB47,0x99CC50F4F84E68D6,0x25C69457D,0x362D8644434CA77D,0x15736D0D4ED9E2A1,0x4C5B87F0B7587713,0x60D3C8A7B76BCFBD,0x49985EF2485E77DF,0x71BA0B19BBDD0B6E,0x935632F68CBBA821,0x1086C6DD5F133F16,0x249260852B8285B9,0xF8EAD7FF,0xB568A1D647B7012F,0x86057A9D673A111F,0x6A37822075A21DDE,0x7AE551E1329D7BC0,0xAB3687C599AC3922,0xA1169E36D2886A96,0x97A3E67DB930813,0xF38C1BFA7AFE61B5,0xFA93A01D50794A19,0x8993A74E,0x11EACCE21CE94CCB,0x860E82AF47D4FE3,0x3A553B24772CDB76,0x2D13A8B37D884DF7,0xF1AABEFF4CBE80DF,0xDD76983F34D0C6FF,0xE87308F0519CD82A,0xCD5087C6EA97B4ED,0x3C567B6D3DBC8AD8,0x161573ED4,0x76472CADD9783DAC,0xDEE65A070909AD58,0x48616D922751A844,0x63CBA91FF9A2AE96,0x95A61BA1EA0B07DE,0x233B455493273749,0x86460EE7FB213,0x359352C14324A483,0x52D2AAAE71B565C6,0x22E519332,0x5A667CEB2B8223F7,0x6DD9CEFA3B7FB7AF,0xEBC44771C902C927,0x8B7E59DD5B85E609,0xE1362D7FAA4571E0,0xA3896B9FB2954F0E,0x34542A0D037AC0E4,0x3A7B3BF12EB5493D,0x7C416C1FF23398E3,0xDA9EF558,0xA06154AB3940FD95,0x76AC974CA9A7D66,0xD3C2613C9D5EDFE3,0xF639E94F46C7B9EC,0x88516BE7187380DC,0x124AA397F77590FC,0xC665EBEEF9F542D5,0xB14BDADB5D5522C3,0xC9C66468BA109A19,0x1AD1C3AA2,0x2B421888F48556D5,0xADF4D6D1B9E22C4F,0xEB17853895E01B4D,0x4993C10E47537C92,0x23D1C322C19DD9EC,0xE194B57DC47C6919,0x86986630FC6DBC0,0x23C6FC8EBB159295,0x79DC63F5BCF0A7BE,0x8F826890,0x497F94E0BD2A1D16,0x9ED526FBAA1B327A,0xA6AEE4518FCA6970,0x45B84C578E73CCFB,0xD41B0309C9D1624A,0xA493DDAC00A261B8,0x1137D4E4C2CECE64,0x2445BB3FC35F8986,0xC0CEA328C3547B1D,0x96DF58E9,0x2BAECFEC7BD4087D,0xEA37C9001001CBC1,0x793DE8C521CEF762,0x13CC0C137181F948,0x7A2E01A95A682705,0xC80C77BEACA69927,0x6634D7730AD75A6B,0x1BED4BDD6B10C461,0x74B3AF2591B983DC,0x54237359,0xA79897527EE1ACE9,0x1AF668F17DE2A029,0x37B5A010C79FA075,0xB9503AF36C17E0D0,0x7CB9885D23A96F9F,0xF5290DE673B39155,0xA7507B258F951CBB,0xD09CAD79EED318C6,0xCD863C44FBF558EE,0x120C20250,0xAEEB0AF10D400E4D,0xF15C5ED8EFBF2097,0xA3AC59665A7B9951,0x2F66655B6F875CC5,0x8C55B22670C1A4F1,0x1BDEB49A8B553779,0xCAAC76B4D00690DC,0x871C69B9597AAA5,0xC0871BB6740FB536,0x1D87796C0,0x50973B597F30C5EB,0x2F6547D351E1583B,0xB6283EA0C0129EB8,0xC2392FFCE194CCFB,0xFCE44CF803D5D5AD,0xBE5AFC5E74E91655,0xF0DE6569E2D696CD,0x396126B42250329D,0x458185814A885B44,0x1887337BC,0xB462645ED26B44C3,0x12FFF887FBEC7B3,0x1911ADD52BF6418D,0xBF1C290CEAFF123F,0xD2C0C4AF2CFD0799,0xE3F84AB60841F1A3,0x8C0F6AF9B3422BA2,0x8A3933B8514C30B3,0xF5653184607104EC,0x18B1BBE8,0x946C44AA94F80CD7,0x2FEEA22FB54F8CA6,0x273BE6B68C780A57,0x5BE70309386369C4,0x16296C2F679DBA75,0x33176D2E539736DC,0x6898A6E19DF83F3B,0x17B4099D860E115E,0x8B8847E6AA2C6D04,0x1A95D4F1C,0x7CEF5A01211C31BF,0x24FA854138D21E6F,0xAD539116B1207108,0x363AE682378D28BA,0xECB742B8420848D8,0x5EBD4DF69EE85944,0x31CA3A9DA6216D94,0x445326C2E0802D28,0x11DC553428C15C4E,0x12D5DE691,0xDF73D1381ACDE1F5,0x6AE872530821EB31,0x2CC355D279436E57,0x5C3B92B830F12A6D,0x287A1929290434C6,0x1BD8124F0E6A03F7,0x37D1AD02DC9D01EF,0xC098D7C6065A3C0F,0x20BA3E1CECDDF3D7,0x5E70E73D,0x7540811F1757032F,0xB017C73BA984C3C8,0x37B48AEAE82AB26C,0x36A47531A8FD6D94,0x9246207961622E58,0x3BB61D50B3F6BAE7,0xBF05F8167EA5EF93,0xFF9F6E6B32D3BA6F,0xE39B8D9875400A35,0x1C1E6E414,0xA895D525831436F4,0x5D7949C54B000FD9,0x7E463A8E0A15C549,0xA7E96A4E6B31A12A,0x36BF442F7DACC812,0xA10317098563A0E3,0x6D3E473FE9CBB3FC,0x9E75EC24B9B90D8F,0xE1C94ADD404024F7,0x1364F17A8,0x15224C53A9274C4F,0xD0E0302C3C987E82,0xEE80ADB499E22232,0x74B9F1A994652152,0xE4FC8F02B7BF6D07,0x71981B2A20F2FC75,0x371F7CFEAEF37B8F,0x8141FEBE5D25DC93,0x4DBC8C8D55D25282,0x1BD30F949,0x724049D57AA4A3BD,0x5EC8B9070700573,0xB73583131C32BDA5,0xB230442CA738E321,0x78052F35650737AA,0x23C10AC874FC19AD,0x6FBBA251C3C9E5F2,0xFF49E8339DD4E5C7,0x67DA3A5AF04F527F,0x15654F9C6,0x97362CD540C4A5A6,0xB356F78DED954013,0x559595E39107BAF7,0x37C3B1A6DE029B95,0x7D119C3723E950BD,0x90AF2EF799E2FE0F,0xE08C2048E1D8EC72,0x97127764A7AD570A,0x36B9BA99A0C00B8B,0xB68CCC36,0xB02C787CB80E5C7F,0x3BF8B73FA665B46A,0xF783A5F819D17ECB,0xA9F80CAD9AE223F7,0x1F52F9E60891ACE2,0x8B709E4719C5CEA,0xEAAEA4613ABA030C,0xCFB17EBBABE6D54C,0x5D70C771EEABC1A1,0x50E40A9A,0xF9A3F83B0CF8D2E8,0x7B4F1ADD29068FC1,0x9FE2ACA4E6F791BA,0xAB13A55E400CB047,0xDAC8D5512A702AA5,0xAB8BBC740D1D085E,0xD7C66DAEAF4A3FC9,0xED121236FCC496C1,0x761E992D49527A24,0x6AD9A1F5,0xA4B973016F191326,0x4EB90EB164188438,0xCED77BF7F65817BA,0x29457CCC22A7A349,0x3A47718688A54A6F,0x2C379678A4AB287B,0x5CF90703C521DC43,0xCC7D292DE6C4CDCA,0x186E5B7E23D1C5D9,0x19B9AEC69,0xE73630AB3213F16,0x47B925559230E230,0xA6A72ECF9DBF7C1E,0xE3E4ABA63D7A7ED1,0xB4969094E2D3271E,0xE2258EF0D15FD4F1,0xC0935740C9D6C820,0x17A20A1AC785F41B,0x65936E15B5E3DA1,0x33292E7F,0xDFFD43946DF516CC,0xB3B07299083050AE,0x77166645937F8D32,0xCF203F3A5B129429,0xA3653E3CB7DEA5E1,0x5ACBDEE0AB92F3CF,0xFBF07198207E43EF,0x8A1411550AD98168,0xE2C343A378C662A9,0x92BEF390,0xF2359514858E5485,0xE130C209F02CA0AF,0xE8509C5E8668FE72,0xFD77AA9E55C12153,0x47ADE91A95A7F2FF,0x3F4E0BED9FB14EE,0x662C43ED35A1C624,0x6C576E9E70613E2,0x59152E61AB26D3B0,0x14D51D609,0x3F5546DB4C18286D,0x5CE02BD4B5E463E1,0x8E28DB994DCFCB4E,0x22A83C42CC8CC4B6,0x11845B7464712759,0x8C3E328FDE6D857B,0x217E4215FB56EA6B,0xCE02C91C2A978C8E,0xB991E0C878B80656,0x26544AC18,0x85983B1D6B686ED9,0x15FA7F02611C47A1,0xDA8306A04C7E45D3,0x4325C9E01B18FD9F,0xCF50BD6C110AE6E2,0x45440E4B1BDEA0CA,0x4CDFC2E3FF21F67E,0x96297A8C8F6E48A7,0x5927BF4A944D5A12,0x5ACE3A9A,0xE3760FF303F22AE8,0xAC78C68989480305,0xA174E8F2C4C311A3,0x9D62DA1D5F610D38,0xB9276CADAC6DFDF7,0x1A1A41281D4A8CAC,0x443DA6200BA22D4D,0x5304FB94D14E948,0x3E8041BA1698316C,0x1A818BD85,0x4961C292C8DF00,0x98937945C2DF195C,0xB908654F31136613,0x12B12F61CAF05494,0xDD9227AD40050B0D,0xA8772EE71ADA46D7,0xE76FBBE1DCF62153,0x4A8E164B470B449,0x5D6573DF415EE274,0x13EE0169F,0x1E04282AEB38B300,0x339645E134D1AF99,0xA21618D4691B225C,0x7AE4F9CA9F02337A,0xAB43F1118B00D0C3,0xA3E80C13C585D459,0x573FE042D2CCB9E5,0x62872742C2A86CE7,0x9CFD6F3526375B2A,0x215FAE6AF,0x4ADA58C0383EE925,0x7BB971C2FF58B250,0x99390CFF487D7A5F,0xD3D44933B751AC66,0x7E88A87277364DAC,0x7441300E46EC7907,0x8ECC023F2CEE62EC,0xA26526FF2F381EDC,0x9696B56D7B1483DF,0x2553753E9,0x1F517C61CB28470F,0x63C0692C952F9AEB,0xF07137A2AE5DD72E,0xB042B45A48D71516,0xC42B64ED0A0BCF0A,0x6B8EAC53DBE21A50,0x3EE39FF1DD729102,0x2BE07DCA0916CD31,0x8BD7C3CE96F56F66,0x30BF1482,0xDE1EC12CF74C147A,0x5E83FCABD630EB3C,0x365DD668A953DA77,0xDD68BFCA1A3E490A,0x23928AFF85213678,0x57680F3048E926F8,0xBBC9FE35A287B69F,0xAC00A6D41CE53980,0x438AEF789C947D9C,0x1534CF441,0xB6F51179C5FF9CEE,0xD4963A3CB47A20CC,0xAAF6A1C630E1CDA,0x720B5AB16AC4283D,0x7E4F25FE460DBED1,0x13F1F5A4953D9BB9,0xB3AD0541A7E4E5C5,0xEA3F39066DD34284,0xA7CA18223842CF5A,0x91190D66,0x243C79EB17374B2A,0x63412465FB49552E,0x83752364565BA9D6,0x7FE84945240EF780,0x59CF4CD7F9B18E7,0x27887BFD8E68E6EC,0x5883987348579F36,0x2031433CFB539017,0xBC2B35641A596B02,0xD7236994,0x6A2780B0D97BC2E3,0xD5747E678AF8A2BF,0xF5E1217887B807BC,0x11B0CB15588918BD,0x9F04D9A9FCB3B73E,0x57CEFB56569263FC,0x461B0F9C5B5D7A8A,0xDE43A248F61B7EAF,0xAD82BD55C3AC0683,0x1B7C51D1C,0x25F244244BCFE9BC,0xA4DC79AFAE7F2910,0x583A52CF5A6E4557,0x3C4FA90F3C3B9A1A,0x7010112C557480FA,0xF0708251D41E89A6,0xBAF0C64552E09F57,0x49AB3D5E9D0807D8,0xB158CC17B4109EDE,0xD20EE9FE,0xCFD904711EABD358,0x3C0D277ACEE7842D,0x3BD9B9CA90234CD0,0xA2724B8D87D79B14,0x6CFBB588F0C45CAE,0x1791B49389FA35C5,0x3A7AA40652F44411,0x600D687DB6EE0553,0x9894F7C9D0F89124,0x9353A83F,0xBC0C64C2819CB23B,0x54F9782106CE88BC,0x4EA75A1C21E5D48B,0x41007B38065D87FB,0x1C3E0F821DE9B524,0x8A49F2F38C79F7C7,0x2C77F25375D8E00,0x7A39367A285ED274,0x2F2C5C6318C44F12,0x402A97BF,0xA7D2B50061359C03,0x4027C09C9BE4659F,0x9CA4E93BE9C2D13F,0x5A13323F6B611B75,0x8F4E9720367854C9,0x9EA40456A022EF14,0x24A87049F5DDCDA9,0xF5F0DD74E9970965,0x138B03E9B45A9201,0x25DDF7B0D,0x1963D01F9F7433AA,0xDE799DB20CA84897,0xA1C2C78C1FC71460,0xAABE2660390909FE,0xF80C2601E030541E,0x24D9D8DD7EC37E37,0xEC3D47AAAB6ACA67,0x56E9DCE3B1581494,0x9B550898819D40B5,0x9CFDDD75,0xB4DEA5FD0DFE6CAD,0xF850D058A37D2EF1,0x636EEA0D70AA0592,0x3CBAE61B3AFAC017,0xEB00C68EBE91E207,0x3087045798F75031,0x158EB16A6C033ADD,0x36FF561F9BD8B80E,0x45BC7F6D1AF66FD7,0x40DD7A62,0x81E4895F7A0C06AC,0xC7BCEE9591221BD9,0x24C8E094068979B,0x7BE5655C8EAF88BE,0x5A0C737EBECE39DF,0x649D28C39ECE6CFD,0xC0BF9178DAB921DF,0x71D9766F04AB88FE,0x3F3D48EE555479F7,0x251F97C96,0x7EEB8EEF4900FD90,0x4F1C4374769DEF40,0x25F9C1D669F4E0A4,0x9F5C755B20164716,0xBFF12B958B74662D,0xE5635DFA08EA1325,0x1044725DDD6311EC,0x6228C0C1D81CE879,0x8F034B32252C178,0xF157F7A5,0xBF48462C64E1E717,0x426B257C123313BF,0xD44F11E32FDFEAED,0x80FC21280F5C8C6C,0xD9213774D91EA9F2,0xB6BC2C4970E4803A,0xB6FB6CFE339D3C89,0x43EC3732342382C2,0xF21988A938300F7F,0xC9708F7B,0xFD11ACB95F1A353A,0x19EECF2ADC361B2,0x919617808230AD02,0xB686FB92D77D2DBE,0xDF7FF767F7232CEC,0x12270C46AB1FB4A2,0x50C9B0B9EA5C9FE6,0xE67EFF68ACAAE67A,0x1E6DFD85181A8924,0x17C4ADCA2,0x31DA4A3CD6B44CB5,0xD60E245C48A421C4,0x1BF6E2EEE97B96F0,0x23429551FCEE412D,0x3C55E32BEDA437D0,0x18C01AF279E5DF41,0x4F60C607AAE3E28,0xD3C8946DB3A3046D,0x7AA2064383668225,0x1516D1ED6,0xC1CDC01D71A5C8BB,0x7BBF2CB00AA432DB,0x75F2FC23F091B15A,0x10F6B2091A04B79B,0x4D51787ED1CE52AA,0x8B5CCCA119B5DC21,0xE291424914D5EC42,0x2154C1ECA5C99D54,0x3DB0B4E7E3A1B86D,0x174208ECD,0x96F555900DD52EC2,0xF8413696B422C19A,0xCB139D2A9DFE7C19,0x6EE74685CE699DD1,0xAF73F4B1E6096879,0x9C1E0010F8730F59,0x58B624E9C97F15D4,0xD0B2B7A8D0FE433D,0x1C0FBA285C272090,0x248AC61AE,0xE6A7CAB617590467,0xBD7219A467002C96,0x121AD06C9F5C1E07,0x3FFC8FEA02AF0243,0xF7BA1636DCD80901,0xD11309F94BB25A59,0x4CBCE4302D26B3CE,0x23B90C30B7A30CA2,0x98172A5B5615534,0x1B1166E02,0x3FA4BEF48BCBEBDE,0xBFB3938A545EB990,0xA1F773B30E13D111,0x8FFC70EE355A7D73,0xA452DF41B8A6CA44,0x6A6B96B6344337F4,0xF636F1FAA8D1B3AF,0x170BAE9FD7FC6D40,0x3618BFC28D41A406,0x164468007,0x1DEFDF3BD95EEEC9,0x28AC0A5F88BB338,0xD60F5CFBB8D37A7F,0x2762DB25CCA4F84A,0x514400D703309BCA,0x9AF9D4C5B0D68BE4,0x9BD7F93775B13251,0x319DD2FC71BAE89F,0x344AF9F728270E4A,0x28D5443B,0xDB0B49D41128CAA0,0x1720FC4EF32CA69A,0xAED5FF27ADF64175,0xC84364EE33C9891C,0xCEC7A4EC02E1FE3B,0xF85C6A5D3E9EF97,0xFDBD60A7581A72A0,0x48DD7C09DDB6E7B7,0xCA3AA3C8A95E1BEF,0x973CB172,0x61B45E0B00FC6B87,0x1236B22C16E9C062,0x2F884377AD8719F7,0x2E2298372A5EEAA8,0x6B3F1288A561AF60,0x3495BC7F089C6931,0xF5D12BD9EA3F924C,0x6B3218B01F846528,0xB0183BD5839D67F1,0xBF52D7DF,0x12BE9ED14A254C0,0x9DC7F332A84FFC0,0x2151FFF9507C8F46,0x62C8F5449219207A,0x57E25A542DE65039,0xEF21E025EABBBD79,0xF9F7E1B90142546E,0xC30143B5DE884CD4,0x31E03024F6EAF652,0x49CBAD6E,0x74E8E8935C318C14,0xA2DBC887C117C09E,0x1563640A717CA7CA,0x352D925E2EA45C71,0x9332BDDF9B598C8A,0x5054B132C19EC4D9,0x3DD59D8A34F5DB12,0xCDBA34115C1E9701,0x8F535AB78A46EF33,0x231A81B81,0x6C22B31EA5CFA62B,0xCD52E7F7509673DC,0x99DA4A4A395B501A,0xEF0678F293B09E1C,0x73420274AB9A442,0xFD2F89EBA34241BF,0x4FFC600C40F3BAF3,0x7603FD3D471F59E,0x71B59B453D3498EE,0x34806525,0x4FFDD073298B1916,0x29F3CE50A74C90D9,0x49D75A69860D16D9,0xF10CE4FCDFF043FC,0xE15E29C20E87DC43,0xDA9348690A3CFFBB,0x98206160A84657EF,0xB90BD5FBF67E51F1,0xE40DF795C9026C8C,0x17D18623C,0x72807721D899DC6B,0xD4F078B9F3450EF3,0xDAA653B2E7CD0943,0x3D7E2F2C6785BDE2,0x4A236A205D2E1627,0x31079ED73639BF72,0xBA59754C3D6F585E,0xA5A1B174511BC04,0x8759CFC507AE0B5D,0x21748EED3,0xDC6479DA2648FCBD,0xCE21B846275FB210,0xEFD70DD033EADC47,0xE4ADE943E5C02C3D,0xA46F13FC031BF645,0xDA57862A9ED16C85,0xDC2CAD2F2D83E44,0x17E0B076DD5F2106,0x39D3C87D0F24C8AA,0x9B510DE1,0x955B6F29E8C194A,0x64F5FCB400B2047A,0xADD5780B7FCD1C7B,0x5D64A9AC1EC7F19F,0xB02BC3A415D5DA49,0x737F2294BC52AD1A,0x2D0498BE9126C718,0x748A7048D0D04204,0xD319C5B6FC0DBE31,0x1AE2D1575,0xF86834AA0E05D14E,0x98C66A36F5535778,0x838A4125555E3CD7,0x68FDC0C0BAE88D39,0xFCAEB70DEA8A645B,0x736963889214DD7F,0x385F4A941B5C5FF,0x2E7E2158C62DBC27,0xC51547D0805307B1,0x134A6D768,0x52D9538070FDFDAA,0x825D278DF40F5EDF,0xC8B267C5296539BF,0x46D1CA0432C83A3F,0x43B6AF04205DF69,0x7450041135819D58,0x946BAD35B93B5226,0x88E40BEF82049CC5,0xC6E4FBA91C1E3E68,0x228FA1B34,0x9C77AAC15F145963,0x52586419508165CF,0xBB98F5FD1912CFF9,0x721C196B6E70756,0xD65C8DA183F22AFF,0x5EC937408FEE5632,0x90F8FC3B30D940B9,0x3C1955474B3CCEC8,0x6E2E895C2988593E,0x8939B42B,0xF9D53E8AFB76C683,0xFEF06E1DB293D7EA,0x7576F191A7854DC1,0x2DAF3AFB2FB43C01,0xD2EBE54219C1F973,0x7279CF17DA144B3C,0xC95ED9E7C193D039,0x667EEDFF5BB14B00,0xEB30329257814627,0x1BBC3D4EE,0x8814D9F7DFBBC82A,0xC2CB0BBE1D246A88,0x9E82F817E905BEBB,0xC6E0310ECA2D23B9,0x963E29BB28096A92,0x2C6AA731BEC9DEE9,0xB5565F5B44466E96,0xDDD5394EDD07EA2D,0x53FE43DE481B6143,0x13071DCD2,0x2FF083DE8E826A03,0xE4C34EF8107DADE5,0x97CF287704642A0,0x355655FE67666B5F,0x6E00A737078FDE16,0x5739EECD7DE306E3,0xE88970E868FF6A86,0xE32E3FC6E5A70F87,0x7FE1BFCF282AFF48,0x1F496690B,0xF4FCBA9BE0896FEF,0x6B3BDE4C201B1607,0xA6C0061D0DF3DB6E,0x1B26B0946DCE5333,0xDB0E84872FC03445,0x390D64FEB06615D,0xD13855127C2A422B,0xBDB84A0BAE0805F1,0x40D5459E2427CA2E,0x1129C49A4,0x937572C6DF592DC9,0x43B0960B0A2DC959,0x5953DC9C04676931,0x51D94EB5B2DD56AC,0xD5A2800D76893C37,0xBC91E02BABE3DFE5,0xE7C20AE57F9573B4,0xBF275BD666CD2553,0xFB99A6B6A0664B02,0x227CC370F,0xBCDDCC66BDCCF98A,0xA19FFB10D1562C1D,0x8512F03B940CF37A,0x177088BAA63B0785,0x1713ACECA30204FC,0x6E49A8E65B3857B3,0x4C8CB3D1B5A32A27,0xDDECA0AA2061D542,0xB87CF82B3B47ABC4,0x24B08400B,0x3EC6D8299716054F,0x97DB0E4C9ED6F115,0xD4D8BC0E39C5BB01,0xB8BD5FD734AF2E2C,0xE16155974CEE9646,0x34C46065D48230B5,0x73923972AC2E40FE,0xA8E10473008D35CE,0xFDB51F3333FBD106,0x4E9CBF30,0x473A021577C340FE,0x8E8A150640337286,0x4358A52F95C37FDF,0x2B1DC31EB3ACFDD7,0x4A10D5F84C7E5A0B,0x8B719B448F09D0BC,0x8CA8E1A180588602,0xBA8DA59A3B990746,0x6774F0DDF0E2FD51,0x5FED4B53,0x6A40E24E1ED50A9E,0x6FC17650774C105D,0xEB9DC5DAA5A7C667,0xAB9D448BBB3750F5,0xFA225E4317FDE0E5,0x352BCCAE69EC2DAD,0x7D1CF2B4C9BEF333,0x54937DAD74246052,0x70C3AB9A1D240182,0x19EDB739B,0xF572800677A7CE76,0xDC08C5AD6FDA3F23,0xD05B60B39C26360,0xB6AA3670902FF55E,0x332CF647268A0F40,0xE568E1001CED09F5,0xB109077D993DB2D5,0x57969F9D8994BC87,0xB29BFACDF494A06,0x1FFECDE22,0xE1C29A5533E5EA9A,0x84BB158A4F97E083,0x16808C717AFFC4E1,0xA5FF67312C99DF59,0xFFA5EBCCDD736B04,0x172C91A8AE31F02,0xD36DD3978EF3E377,0x1D16B8F2DDEFA73F,0x3F91D7E9CA3E8C55,0x176B808EE,0xA5E700DBCF4AD3F2,0x7B72461C041E1355,0xA488A0EC6E16A3D1,0x535F4D51F2D274DD,0x91DD301F517BDE6E,0xEFF888305D4FB20D,0x421863148A27CD50,0xDC0A7C552A51EA8E,0xE9F266122A7AAE2D,0x11A0CA8B9,0x982109CB9ACEEAA,0xD32EC1D675CF12C1,0x922568789077CCA7,0xC5697177FAED35AA,0xC49FAEEA3010B74D,0x47977D69D2FE3261,0xB3ED220AA182CC00,0xD57033D5B0FDDE63,0xD3E276A313C0A9E8,0xA908D296,0x6EF0DAFA3FD500C8,0xF5358726D2F82D85,0x7D5B690A5C904302,0x9423E4F2B82FB98F,0x8831428AA9CAE1DD,0xA5B535A13BA277BE,0xA7A6C1728C1EE20E,0xBB3E4A54C8FFD6B9,0x63AEA2B17ADF1541,0x1B848B1DB,0x20D5FD0B318A081C,0xA13A0E0071D3D63B,0x617B7F89736D448B,0x455213777617233E,0xD5D24B509A07A7FC,0x9FCFD1028A1FDFBE,0xC1F000E02C8868EF,0x9A5BCE2DDE53506,0xB4682B911D1C0E9E,0x12E66C04C,0xCF18FE4E71C2AC90,0x54F1BC9A2AD30CC7,0xB18E88DD70495FD6,0x4B7F2C8ED4AEA355,0x1CEB34AD604F91A9,0x2D0413367BA8B477,0xC909291D61080F72,0xF72C14C66713754,0x7B4E416B0FE29CDC,0x8E8A5AAA,0xD5EBE47D3602F9C0,0x3F3746221BDB0257,0x51A638EADB8D597A,0x6D58BCA215209851,0x9CF2A664C70255F6,0x838A151A832F74A2,0x8867B81A1E9CB503,0x475CAD793208D5EA,0xA45494A66A0D2C5,0x1B63C6694,0x1B18385D5940D783,0x3863220552590A82,0x3D6232D0CF4371E0,0x802C8E0169A1832A,0x7E0F887FB27AA972,0x6151FF48D2ED07CB,0xEB35480DD5E3A1E2,0xE2C0FFADF40AB456,0xC37DBC178206CCFD,0x20B4A81A7,0x554D409AC7F1B1AF,0x1DE9DEFAD55BEC9D,0x7EAE4E9AB052E3D1,0x3C8ADA7A8040F7AB,0x20B852F599C57081,0xE6844DBAA844ED18,0x6B2FE15C1A7BCAD1,0x4C7AE6E323CECF31,0x14A67304F64B6742,0x7B838C39,0xA07AC85306BAF5F4,0xE31EFC25138FE8D1,0x1FCEE278952F79D7,0x4586630819BB1C60,0x6694EC65AD0DA24C,0x2348902E0DB2F68D,0x4759987D721E4F94,0x7DA90033C69296C4,0xECE2EF8ECEE44B3E,0x18712565B,0xC79AD326332EFC0E,0x3C860CBD6881B1B3,0x53B59D7F4F539E2B,0xDEDD1010456BB89C,0x768AA53FBF8CFF14,0xD32BBAB03F31D3C1,0xFB9FCBD4FB10EBC7,0x67F5583E203B3CCF,0xEC1126A58028889F,0x15B29D068,0x356A15651691B05E,0x832A6C76AC41AD1F,0xC2250A2E5BCB50D3,0x8B2FB61D67DEBFE9,0xF8C1758B59EB19B4,0x82B797A180FA9E4,0x60825BBB0116D0B5,0x5E0EE5B92ABEC129,0xCCCFED93B13BC579,0x7E0EC274,0xDB046C293AEA271B,0x835BE4DABA06EA43,0xC25701F2F68A03F2,0xEFBEF4154F5E2259,0xBB3C1AF9D3672EFF,0xD557B307D603E2CD,0xA97C97300A3CCFD,0x6D65A4B3497B8ED5,0xAE3C98DD89B43AB7,0x21B7A1E21,0xDA0AC45F67F9B2D0,0x61AF48BEF802BD19,0x4F2016171CB1069F,0x3CA32CF426D5B105,0x3834BFC4BF2124C2,0xF9C3130905623FA3,0xD7E1A0522D848417,0x7BBECA5B410CA23,0x8034FE8E387621C8,0x26178A0F7,0xB90565A9EE1BAF4D,0xCADAB3B81D35E5AE,0xB38E4526194A12BB,0xAACB88D19D39FB77,0x1C0A49A339B0470,0xC5335AE92E401BD8,0x5BFA0BC0B87CEDE7,0x2D29A5EBC8EA721F,0xA90465C77FCB4218,0x1C37F8929,0x3FE6E19A2A99FB15,0xF50184C45B061844,0x6598A910127CFE94,0xAA869E3AE7A1979F,0xB55BC75F09B90968,0xA4DB11153B5620D,0x7B3A2A84723E4DD9,0x36DB51066BE3CB6C,0xBAE5F831A1D20503,0x15A6407CF,0xFD2FA85335214AD2,0xD6732075F9EA32DB,0x8D27717FF14962F8,0x362AB12136EC3E4B,0x1AC4ECF3BD09A270,0xA7D4381812300D59,0xBCABE5BC1617E447,0x933ABABDCE468CD9,0x25F90843F0901B95,0x18A6F1C9F,0x941E9C80C87AB02D,0x2FD35FF87C99C57D,0x3C17917FE7157817,0x9E649EA5A33DB9C3,0x8B376754CE3B278D,0x9A437036AD32EAF6,0xE21C97AEDFDD507F,0xF2812BBDB2743DA7,0xDE6FAF9215F87127,0xE6B4792C,0x1FBB8D0575E528FA,0x8C1771E502CEDD12,0xDBF8830DD5CAC0B3,0x97C456D0F7861FCB,0x1F7B682EEBE8E94E,0x569413E3BC4204E,0x8338445D86F2142B,0x415F44858DA172E2,0x6E22A1BDB4D24F44,0xA60F8739,0xECF2C66B06EDC2EF,0x3C0382BD7B2412C7,0xE7625C30CD0EC847,0x62C8C34C44F9D886,0xC8480EEC67B2CC55,0x848511B8C2821316,0xD9879358DF19D954,0x53B02D15A5C5727D,0x17EC8843D67A751F,0xA9449D40,0xE5352F169E11CF62,0xE9DD27FEEE300F85,0x38E2E011347A4AE7,0x6FE47907D0B13423,0xB5AD738DB384461E,0xC6A1F316C393B8E2,0x8899AE82B492F28D,0x745433BA706C6040,0xFDFCED953C61D76E,0x2F440B3C,0xE02A8AD5978FE189,0x95A607617ACD191F,0x4F4906B0580CD6C7,0x4BBA52EA756EB58,0xBB8491F0FB83B785,0xEAAC49C304432D7A,0xCB19C9E58B1393AC,0xA8BCBFFC5E427E7E,0x72969F53F813F0DB,0x95FCEE14,0x150E515FDCA7CFC2,0xCAEBA4EEA3A01F06,0xB7252FC44AA0D2E4,0xA9810C2BE280795C,0x3E0CE076E85CDF73,0x15E7AA713F4125E5,0x76975D8E9489767D,0xC42A874659DFAD36,0x5FDE3A4986CD98E4,0x25392EEDE,0xF64A87F7B47ABCF8,0xB79FDE75C44F7826,0x9E70B42083D7A832,0x85197E42D64E6ECE,0xA055FAC2938929C6,0xB50FA6E1EE8CCC77,0xB8306B8FF2FD937A,0x4837EE9B766287C2,0xD4D1B298DFD29667,0x25B6DCD71,0x84631EA25745AF7B,0xCA94C008396445C1,0x1D8547B4ED963E7F,0xC7518A3581853508,0xDBEB06F012C170C6,0xC5AA3D74064B9862,0x4DCDE2B1FBF2D43F,0xA6D9CD66177A4BE7,0x61DC31979EA9948,0x1963ED61F,0x4105B546D2C72480,0x1B3F74D465D2676E,0x3B9F04EA1F45ACBB,0x7552DCBFE8FF2B1F,0xB866A41969681EC,0xBA57AB6F40E4E2B3,0x5CF871BE9A5D0DD7,0x1A4402E48EAC5981,0x65DFC3A4E0E83CCF,0x695D72D3,0x617037871D2142D4,0x307AD127900F25EE,0xC35BA40D39FB6621,0xAEE79B91DF6C7828,0xFA694CD0ADFFC5A2,0x48CFD2A11015B7B0,0xA2A663ECB9AC7DBD,0x29A3E936889554B9,0x81BAF76085287EA6,0x510FD7B6,0x6FF85FB69607C73C,0x4C01005413B189AC,0xDB5771FE990D779,0x679F832EECA8A383,0x3B36E4D394D9895F,0xACB483268D69C4E2,0xD01306C3B961BB55,0x6234F3275E1BB37E,0x5F1464750F703E58,0x18DFF9A2E,0x9CD90EE4ACB60169,0x8A1EC1280F5C13A0,0x5874F2DE5A6FBBD0,0x44A7469F316C0475,0x7909029D86BC3E66,0xB35899B1C9E245BE,0xD278C5E20443AB1C,0xF2D794969C0FE8F1,0x71EA5FC4E69A43FC,0x1EC87C61F,0xBBB52C69126628F9,0x6BDA3A1D686AA6A0,0x5B1C35B69E1CC8AA,0x123CC213E1B957C0,0xF941B92F33C93440,0xC67D44C4A51B5DE4,0x69E3A656A7A2525A,0xCDEBC28CD39A0778,0x4F399B1C596AC243,0x1B52621E2,0x788206EECBB9910C,0x242EDB7FD5E0EE53,0x7499657583946FB5,0x760341828B0AE0EC,0x66135A13E3E6E36,0x7BBF2B971992054D,0xC83BFDE586A36774,0xC3541CCAC6788421,0x55908758BE42AD2C,0x191BD24E2,0x827C2C20D45418C0,0x32DA758D2662E7C2,0x6A8F37182D6BCBF4,0xA30E1269FA7E45EF,0x850C89E069D83F00,0x708DCCAA9DD42B3C,0xD5381C6E2E7AD4E4,0x8CF71BBEF7E9F2AD,0x1E86B476B650AA21,0x3FB3B2D9,0x1414FB59FA53550D,0x957897BC85A43623,0x224FEEAA789263EE,0xDF4984DD999F9553,0xE54E1F036D2B29CD,0x25578A3B5000103B,0x99F2AE7A8C71F32F,0xD8930EF43FF352A8,0x22EA9511E164FC4C,0x4A75CDCF,0x6BE6C670C544CA6B,0x2A61F34DB83D3441,0x9F4EF5DD65EB809,0x9A8427450CE2168D,0x80AA0F54C280EEB0,0xCCFBC9ECD131D97C,0xFBB54569B880A6E2,0x6FCCD3E253828E73,0xC52223E2224E3449,0x743EC58F,0xBA69252DB3760A24,0x1BE63FE146F85648,0xC3684E4B3268AF94,0xF9770942C7A4BBF8,0x56C3ED27F32F6C20,0x35406881E46FD53B,0x2E8E024A90285C71,0xD08937C3BECB963B,0x3A58B89FB9C9702D,0x1CF29CF7,0xE92EC1C9FDB76BAD,0xB917D25CF07D962B,0x52943D6667C5AC1B,0xF32C5C4D4B1533,0x4C42A37AD86455E0,0xECB79935456E11C4,0xB7456255776B4B9B,0xA4BD9EF28CB8083,0x25B41186D869CF91,0x17F1B4A85,0xBF97725559A36FDB,0x9ACE73E22CA1F0BA,0xAEB2FD0C60C0F4E2,0x83C4279989545290,0x344A7B929D3C7CC8,0xBF1F8078FC9A7A23,0x9C953D5DC3B956A2,0x6DCC7A5D3F44C3DC,0x7EBB89EA7A5D29F,0x1A51E68AF,0xB984FCD28FCA3476,0x4EEA5E79A80CA2CE,0x549FA4B1C759CFA1,0x1AC4E5EA5DFC5BF4,0xBC9E86CB5DC87390,0x14D8CEE37E74E328,0x278DFAC5C8AAC784,0xF9468C4FB7E8037C,0xDED39DD735E66EDF,0x52C14940,0x7C4F82CB17179220,0x1228925389C50F4C,0xAF86B881B7219E21,0xFEAE99625B19B697,0x2CB81B8CC40D9278,0x40F63AFABF0B4964,0x36FB8C658EF0598F,0xE10B28F299056023,0x63B8968301FFCB71,0x1D787896B,0x136C28F24580F6B1,0xD4CDC8C3ED2232CA,0xB6A3657D33FE66DD,0xA6360BBAFE8E5A3D,0xC1B743DC7E11CEF7,0x403637F600DD1EC3,0xC9F86F9E846E2FA6,0xC3B5E7AA692A46DA,0x18D31DAF80CB80C3,0x26EE55097,0xCF5429DBCB2AB83B,0xDC489B3CFBBB5D4F,0xA9DE2BA503C8722E,0xD81E21AD3CC6A62,0x5F189F98FF2CBB3E,0xE0BD9EE414511FE0,0xF1B26BB9D9F31D9E,0x338AE9E6FD3C83CD,0x27105679F47C38E4,0x1F852991,0x90AB0396ADC2001C,0x4FEBD33E0F53B28B,0x19B90399E44CCA8B,0x1698AD1FE449D468,0x72EF4EE1C4FA615A,0xEE52172150145D36,0xBE11738B731735AC,0x406253F19C5B8556,0x44E7E787DF738B23,0x27739AD25,0x467C663A0DD96386,0xC69A25836D36F651,0x7F9447CC0E95504B,0x6689C0D1A9ADF314,0xFEAAF01DC6B341D4,0x90BDA2C04CE5FBF8,0xAF0B04FD5C62FB29,0xE815720D85A14ACC,0x614F017CDDFDBADD,0x99C8E49D,0xEF74773BC9755A17,0x193C0E73866B538D,0x197A8C5667872BAF,0x27E9A48ECB98E9F9,0x8CDB9A153EC51084,0x4B48DCA557E08BEA,0x93D4BB6E1A822CA8,0xA1595580F277E342,0xF1440116FDAF7FED,0x1AC334070,0x26083CF7DB3976C3,0x27489C2950E004D0,0x60E18DA49121CAD6,0x7D52095FC270DA6,0x594982085D22DE3F,0xC5103FC8F10E54B6,0xFD6DFA48FA55CDD5,0xEA97E68AA8CDF0CD,0xB2889373FF7B1CF4,0x1F727A5BB,0xAB034231E8BE8CAD,0x6CF94757EB33FF3C,0x728A67E1359A04F0,0x16955DC895C017EB,0x853226A8732F39AD,0x7F740344EE01D1EA,0xBC61A6FD0DA0644C,0xBD7C38F5ED238A68,0xF3BC7F8A71CF6053,0x19CCCE7C9,0xF231A8B787626EE1,0x2FEE8087A23AA739,0xE2CC49E6F3A57A94,0xB94A13941EC5C369,0xBF301A2D54D0AF96,0x1B4C17C51BFF6D5E,0xA64AB9C38B8E1517,0x23098DDB7BF1B82C,0xB3008A2E506885E,0x21580113E,0xD06A1367D8252EEA,0x140E3D9EFC9310EB,0xF3BF85A88A3E10E4,0x350FA423486C8938,0x6EA19BD4EA338715,0x514DA43AFC34414E,0xB1C45910EAFDA6A5,0x1EB206EA5E7D260D,0xB869CCBDEE9B6E13,0x142C06E67,0x38C6FEF0362B68B5,0xAA6E3AAA60BC3A9A,0x5C7E887355AC5755,0x507706E629B11542,0xDEB9EC7BEF8C52DF,0xFA90019B15FCDE5B,0xA50AA3F7F820BC11,0xF57A97722D4F518A,0x7738371E22DA5EE4,0x1A6DD4560,0x38097C15CDD57F1E,0xC9580EF2FC1DFD33,0x18D75C0D13051426,0x182B90CA121BABD3,0x571F0B04CED5247D,0x6F15F5F309C18861,0xF333E54C2DBD5C2D,0x34E5FD1B505DEDDE,0xAC6B92CADE9F5208,0x1FBE83AE3,0xEBA3C21A7BF99F40,0x266DEA196716F3B0,0xC4AC9CA8200E2CD3,0x7F48BC3A6D3BBEF9,0x20809AFF69E075FF,0xC351202006B4D9C3,0x8932651DC5D22EA0,0x57D8FBD81D9ABDA,0xC2F02346D036391C,0x1D43860C3,0xFF1BCBB1CCA4656D,0xAE520B958BF5CB0E,0x60102F100C8F1412,0x539FF6441F566CD,0x8908CA20378C8306,0xEA5FA88EEA79F7B3,0xA0FD46F9823FA3D5,0xCBBD83F30AD17CF0,0x73977D82243D25F4,0x8A3ECF6C,0x1CE6D24E7B2E6F1C,0x8A7C7139A5AEBA29,0xD539523B55514BD3,0xD8252AFFF2DC2911,0x592A41077E3DD4F7,0xA69BEC085CE8742F,0x1F6BB0692994CEFB,0x6E3CA56BC404485A,0x45929630AE192B0A,0x16D17A382,0xAE5F7130B5380107,0xAF23AC1E242BB89F,0x5DDB83699918F166,0x734DB0011928DA42,0xCBBB2C2C1824B539,0xB94622A3A0E11E7E,0x5F120C1A6B774C88,0xC915010441AD0792,0x41637D60B08F496,0x1A6E62731,0x40355A135D1BB8EF,0x2DC3FC1F6EB43CF4,0x42E7D2E956BA302A,0x5C95B5F46030A0B3,0x39A5BFB8941B6A8B,0x72A2AA864F3488BD,0x30D9B7AFB3AC6634,0x36B7829578CB013B,0xD934BA1CA03D3CDB,0x206CB4F20,0x234DDB9A76D485B2,0xB8E8F17ADCF91DBE,0x5F525308CCB55E63,0x8F006CB42AAC2DA6,0x9C3A1B278A597683,0x7787A5655F2570B4,0x414955794F1519B3,0x7D640B02FBF20047,0xD399702FBD939F5F,0xFF4312EA,0xA9AA8013634DED19,0x3F18C82F6806A626,0x7BB075BDC2FBEED9,0xD29791E225839DB1,0x8921636AC298DA9D,0x251C30976F6449C8,0xFFF5DE58929C36C5,0x52B10E03CC7A3003,0x758B5992CB483BB7,0x1C9FD2939,0xD6C4B26CB394D549,0xCCF36D1A6B6DD4F7,0xFF4910F4324DB0F8,0xDDB39010BF9F57F0,0xC956F9062DF39C8D,0x3B03604FF4D9A4A1,0x1966A786A4200C55,0x1575F76682A4BBAC,0x409F80D6402A9E37,0x262D3AAB8,0x8D938A27E4CC1261,0x54C53BC936812937,0xA96D5C22E33EF961,0xA7031A1D6F5ED722,0xDA5E7819C1C69141,0x95B7C3EF142716AE,0xD5DA4312477D6B5F,0xE2A0E8D3B4515C65,0xA35078E5AFAA642A,0x9BAE6E0D,0x1E18C8FA194D5FB4,0x977A4ACDDFDDF51E,0xDACF4A479E536205,0x59B8A280B51E26FE,0x2E5CE0354FDDD0A0,0xC2D2FFACD5248F01,0x3EC14C625703F82A,0xB382F35D8DAB5A43,0xCCC5A79428D495B6,0xE25E3F73,0x835D58ABDFEAF3A1,0xDAD0D15DCBAFAC2,0x13B3DC0E8FC0ECCA,0xCA9785B621769670,0x70AF28378860C775,0xA100831FC9BE2EF5,0xE32281F0678D19DE,0x9C048954770C6E51,0x412A3B98DC6DB452,0x23024006,0x3C4A5F7FDEB21C3E,0x73E624517ED4DF52,0xF8909EBFE9138211,0x5CC37E0829132B86,0x853CFE53FBB701A1,0xD2185CB45A7E58DD,0x55D809CA02D06E03,0x9A30CA3E89C984A7,0x3225287B66CEC6D3,0xAE336D56,0x209F4D8EB790D40B,0xE1EBBF5E5B8CF887,0x79DEFF03BDE90303,0x705514AC0E240F45,0x1C198A8A5608CAAB,0xA6A9EBCDE2B43512,0x7C7F97A17F1447AA,0x847352AB5EF87D13,0xD963C2653E0D7B3A,0x6B9FEB26,0x81B9225959C3B540,0xEA2A328C7F833F11,0xE1F16AC5C1C00CFC,0xBF9E3AEAB17202DA,0x36E5C06B577EBD88,0x148275970FF8DD4D,0x8C6ABFEDC4EAF31C,0x5E83AF16EAB43677,0x7AE2BBA911C1902D,0x133592EDC,0xF0BC87A75B0E3AAF,0x2AF8C9208B987FC7,0x86C5CB3BA46D0CF6,0x3DCFC4580193E513,0x96CFB0180D97CC36,0x98B7AD39A6EE9DF8,0xD15C1BD95A6004ED,0x7C4B0758979DBF70,0x4126FF74BC337976,0x13E62E48,0x674A901CFD5A91F3,0xFC9E9B4E21029A0A,0x74EB8C1939F55E8C,0x1160888CCABDFE7E,0xDE6CF0A7B2822514,0x464E8D3439E42B64,0xEE105EB075F72A95,0x91A1B92AF03A136B,0xCCA4FCA1F89F0DDB,0x24E18C0BC,0xD106DF3173908463,0x96DA1BA9DCD0A276,0x91A3AC93F9F5D2BB,0xE3A92464D772BC9A,0x99067C5450235324,0x5BF47944468A6822,0x4D6849466B901E74,0x6C7D85C52089A994,0x3E994BCCCB23A00F,0x86A2E657,0x1AE18BBDA4781C26,0x18594D2CBB03DA66,0x75C90347AC3EEF27,0x14CACE6D44CCC261,0x86AB043B935D382B,0xA1A4535BB69ED110,0xE48814E15FB72CA3,0x9AF2EA6E5CEED10D,0xCEBEC2FFE6CC72A2,0x27B2356AD,0x329C561B293A2FE5,0xDF5CBCF851711A37,0xD6D62486779AC84,0xF77AB6E896E5775C,0x800FDAB799F05030,0x48FB567E94D63742,0x4D86EDD6202DA682,0xB977426DA8A6D236,0x4D3284706CA6D48C,0x818B2770,0xFF95E74D31370725,0xA6837615D2624E93,0x517A218A46648398,0xF83EF4FEC49C1A43,0x609C2402C9CC1164,0x2003DF9685AC32F3,0x6F02694C34170174,0x9281C7CD91BD73FC,0xB1A2E59B055C3E3D,0xE68ED009,0xF882C5294668AA28,0x67F5CCBB8681042D,0x60828CBDE600B837,0x2BC99DDF0B9FD566,0xDB555E24A49DAD97,0xEE4878BA434C9D41,0x8D389062813CC310,0xDEAC575C2413D97D,0xDCF061BF7778993A,0x7E68191,0xEF4991C5060E5EEC,0xF78367E881764DDD,0x93220D1305AA4A54,0xA3332AE0A23CA9D9,0x4F07A1114EC601CC,0x20AB10C14CF6D9F3,0x21686F9A6574A4F2,0x909CA17478B0E1A3,0xAE015BB15B6AAFA2,0xFFCA1CA2,0x28B9C6FA7AEFC3F,0x269CE8B984D1C2BB,0xE0CC22EA1D77E0A,0x69B10CB9845C0B95,0xBE8EFFA0CA8A296C,0x108B2D8FF31361EB,0x7C85E29E9DDEFF1F,0x466549F6AB7E98F5,0xABC2BA8301119A8D,0xE5351AE9,0xB60B108E5F6E337F,0x5E2867ABAB422E46,0xE2512EFF2C332D69,0x612A228C83593928,0x3BEBBF314507D3FA,0x6853C58018AC76B7,0x602C25CFBA985BA,0x4B73FCB7C2034B78,0x4AA97038F62412DB,0x2666113A0,0x89AB5D16002CA605,0x2B6D75E1C44D646F,0x8F1982C5A6791F61,0xAC1EA8457E76E188,0xA42BD5852684D25A,0x45A29C8888D7EFE1,0x37CDA92BAA8E0AAB,0xE501539F31962FFD,0x9C1D2C1922179327,0x256CD40C8,0xA7108EA03FC47CFA,0x686B68AD8419166F,0xDDE51ABD13CC5753,0xFE110EB93EA367E0,0x720EA6B7C5903265,0xA2A2C739249579DF,0xB8C6D7E27AAEAACB,0xDD049A45424439A5,0x5CC9DA515D585AA0,0x25F5FD9AC,0x2660872AB477C18,0x2597A26754B544F2,0x8DA188E38E09C05B,0xD705013989F57666,0x51B6CB93C06075A2,0x88A9C622F29E10BA,0x4746FF3CB7675C7F,0x47883A93C4F9CB94,0x6D351507898B4C76,0x115164B40,0xAB95338D582453E7,0xED828FCB9FBF5FB2,0x2217F0CC228B4B74,0x2A6D8355342B5100,0x9E47E3DEDFA06739,0x71CA656B46BBF9B3,0x1774BE9C180E4781,0x551BAEC02E5BC0F7,0xC941EA28E5A06D92,0x2583AC854,0xBAAA0D1A284FCA6F,0x84DB2D750B0629D7,0x2451B9BB8D3513FE,0x73B5F36F49E10CD7,0x1829E08DE8C72B21,0x840A51EDDAF9B172,0xB40C8F1A3E1B7F8,0x38E027D2A57F04A8,0xF16A1C846BCFE4AD,0xD7F3FC50,0x77C636D6C891F8AC,0x6F1DDA949A0491E4,0x7C3F38494B8A0B83,0xD303A43A607147E2,0xE6C7ED213DE0E0B2,0x7A335487EF700D1A,0x2C73283F546E1CE8,0x323618F2F269A259,0x6E5BB89C827AC751,0x25B1E910D,0x3C2174996B28FCF3,0xD80B5BF2C453110D,0x25E0CF8188FEBD9B,0x56BC570B5C92AEE4,0xCB56A35D8DDDD4D4,0xC5893B5AF89D9F48,0xDD1E181DA7D3A6F3,0x59F4020859254D10,0xD5DF6339E5B9AB65,0x153B4FE64,0xDE7BE6D4F4060AC2,0x960ED9E78FDE56BF,0x5994C960CD018D2A,0xC7BD7027E070E352,0xA45EA16306E67EBB,0xBA9E977BBC653677,0x9A18BA4CE3B5FEF8,0x3AF6820B4E0A4DB2,0x9A2EBD1E90259D37,0x52CF44CB,0x52B37529240707CE,0x25F995100D641033,0x6F8C4545EC8FBF1F,0x6BC8E2B1108CCD5B,0x53E11D39611C5925,0x49394DFDACB93D19,0xB792AE9800AE38CA,0xBE9F9DC868EB81CE,0x95AD2E9241F8C755,0x4F0B1D6F,0x8CE5C717B783DA15,0xA147F7B67A76E2C4,0xAF84C4A1D37B1A4,0x18342B9E3B220841,0xF1AEFA0681B2DDD7,0x806667F33E934747,0x52DABE8CA3C6FC64,0x5A7A5CA72799CB09,0xAFB8E896B34EDEC6,0x59BDD269,0x93757CE7DED6E353,0xDB99E4B5CC217C4A,0x14D0A13B81F7E955,0x3710DC8B93767FD3,0xFE215B832169A1B0,0xA8D4B100CB2BE51A,0xD8822EBFD11E9136,0x909CA3DF9AED3C69,0xC919DD823B68398E,0x211A83A3C,0xD2A28AEA5891415C,0xDAFE5FDE29107EE6,0x3A5288A84A5FEE34,0xD9D04545391CA9FC,0x878915ACC30357D9,0x14FEFE0F77AFCFD5,0xF7A7FFDB6F2380F6,0x25AA54C8E601A16,0x677594E51A8649D,0x8E5E3C89,0x207F3528C8895D7,0x1D20762E75C2188A,0x32DEC2B3A9A13BEA,0x73B21C8978757F2D,0xED8B163D536D55E,0x776FB3E31718A735,0x353C65B30522634B,0x8AE76471B6F572FD,0x52AB3250D22828D,0x96A94B5A,0x663F604CBF28BDB1,0x6684162A6BC93640,0xBB9D44CA69ABA1AA,0xFFDC95CBD2C04CD0,0xC68CA042DB5F1519,0x4A1FF8E3840B410A,0xE79347CA1923E0D6,0xC53689529C006FDF,0x699313ED98BE11C3,0x262163319,0xC26DC6A07B301084,0xED32E6D0746420FB,0x6CC3C43CAEB07407,0xED1143C0ADD3502B,0xC40A687569637196,0xB07CF2032771DCB6,0x4EC0278D6A9DC588,0x729E3B6E2CCCF5EB,0xE0D69FD70D8E4B4D,0x1380A2F03,0xBB85B88DD727BC89,0xFABE3F94C0C7BBD9,0x2BA93AA9F8D10753,0x9045A614B355FB92,0x9B5F6CA304310C24,0x20CB6189C632CD68,0x7461EC583EA6CBA1,0xFB09C4AD16184D3D,0xC88FD21D377E9E40,0x232D983D9,0xBC511A126DF8ECF4,0x44EC75D449106A39,0x95CFF95C33EF728,0x41673B8E00C96A8C,0x1008937EE5F4A61,0x379EFAF24C18DEC2,0x385C0CC2167ACFCD,0x7B584C10E8194F9A,0xC8DB42E6BB5A34FB,0x1C2240248,0x6FCF1CDBC4CE0DE,0x227CA6044D9D448E,0xAF541E1518DA3CD9,0x3B5D17B82838F1ED,0x348B44D94A5ADF0F,0x78D8CC43E7B696FB,0x242E71DA22E60EEA,0x46BA3DE7C2462387,0xF842C3DFA3C38ED8,0x1388A1C12,0x10D4294391911D98,0xF9A3A43C1810F165,0xE5BFE5857A190EB,0x8A8370D56AA09629,0x18DDC2D1EC25C867,0x392D2D155CD6B337,0x2A534F502B6A3A5D,0xA2C03E572A992FA5,0x2536502689888027,0x1F0B44B2D,0xDF4847A7B723C6C3,0xF57EBAAC3CC74C18,0xF0C50B25312EBC92,0xFC769FF1460EFA6F,0xB216BC1B32FFB7E0,0xDDCBF7AFA070A4C8,0xF10C435BF48CF457,0x9E7D9A24DFB3883A,0xE53AB12ADDC97CF0,0x150386841,0x9D7FC4D0DC4FC5D5,0xC7670B345EF95B5A,0xFE5E9A1466B379B1,0xF3D4E53BFA18541C,0x844B042F7DC57DE3,0xA62DDE85DE4B942D,0x43A716851B1CC18A,0x25FB0E9F5FB267A1,0xC663428C954D191A,0x171E2B061,0x158F182C364C7707,0xF29EEF92C999BFB,0xC280184A4A37F648,0x9F084BF7117093F3,0x1F6CC426E1AF4A1A,0x65AACF4B2B5003F3,0x4D7BB056D3BD2E32,0xEA97A35CEB98E3DE,0x68B5BB28DEB4EE54,0x4A9E17E2,0x2348CDE5C6170F55,0x4169745B2B7B065F,0xBBF0BADE38CBA961,0x355D1D0E6845D101,0x2D221312152F1B4D,0x8D18ED93432FB0B0,0x8BE381A20659ABB0,0x34059802E03E6ACA,0x77D5C79D900752F8,0xF26AEBD7,0xBDCCC5640E35E052,0xFE491230B78C145F,0xE07D79CEF1C08B4E,0x57ED8608327D8441,0x6F303925827766E6,0x2935943DC6D0BD4A,0x1924B90374666255,0xF9835FDDEEF9B6A0,0xF0A2BC0DBAD1F992,0xCFC643A,0xB4E852E7AF6F7735,0x1BDECA127BDBED80,0x3822E189FA417BBC,0x1117EA3CC65E072C,0x2FD2F688CDB827B,0xF8D77677BC61635F,0xB472A83DA0C6A930,0xFB259262818B28B9,0x7590016038FC422E,0x14060D251,0x51C1917EE725D179,0xB11CD192A788B5BB,0x17C0D0F0A6923E6E,0x12C03E94BF23FBB,0x2BC3D64E5F23FB27,0xC7B34D1665B611B0,0xD4E77BBB9A3BA0F0,0x170B60DFB3F630BC,0x3E0704EBA1B69AB5,0xB0B12A19,0x24D5857E9F5C4283,0x9A31A9D44BC178D9,0x8481E9B16172689C,0xFB53EA1BD98121F5,0x578F04CD7D8E87E2,0x1AF9CD2A21B12B1A,0x69F77B9742C3D3FD,0x384906DB5C567B02,0xBA1548BB3AB06145,0x24744D36F,0x5980E364BAEE4613,0x7D538BADAA70EE1C,0xE2E84346529E101A,0x458846B067CA3A0D,0xA7B753EC2CF34DC5,0x3B8467B5D95243B9,0x42BFE280C6AFE054,0x608AE48681907FDD,0xE4B3B971B32B28A0,0x265A851FF,0x5F257E96D08431A0,0xF2813344E56732AA,0x4974DC10407D0EF5,0x134EB79CB5F722EB,0xC2F51A8D8F8FCBA7,0xD2997D4CA79DB6DE,0x3930AE758EBC0A10,0x86923491D03AF0C1,0x3A0A8EEC99C5F853,0x3039BB5E,0xB969E61FD1D7928B,0x67720FD746DD8B8F,0x7A02E14B8A55704F,0x23ACC3A9303F6D82,0xF1487AEA31BFF3F2,0x3E0001C3EDD284BF,0x5AE86996D087422E,0xB55F806C7A3A050,0x22C2D54647830B7C,0x1FAC3BC01,0xB28C7425C97A6AE,0xB39CE5DEB05E145E,0x5B7C701F0CEA869C,0x2B0AEC4A7FABCA7A,0xDB1E28A11CE2262D,0x9B167FC861001CB,0xF3D69BD5E9C06EF5,0x46AEAB768BD5B8B2,0x6F42F6676C278469,0x6474BD5,0x2029EE8349724B7F,0xD9B031893CC30FB8,0xF0FF91B38FEB5C0B,0x340D4B71D9CF8E08,0xDE0A638A790A1ED8,0x91C7FA3DE4DBAA9F,0x34B41B7A9D680773,0x48C32155E181DB03,0x54C4E48D44084368,0x26AA13132,0xA9071FE5079E58D5,0x769A18A1CC33D4A7,0x8F5FA0EC92294CE1,0x60A046CC2412852B,0xA95FC8EC0E22734F,0xA6DEDA4A569E43DE,0xC21A7CFB27E178CA,0x85F25FC31E87E037,0xF170DD0909DE3F4B,0x15CC10379,0xEF7F939B8B0B3413,0x7354BCB743DAC0B9,0xDE74FDACA28CA21,0x6A3AFB38DA2E22D6,0x71C7F6FB65639DB6,0xCD0FE2347ADA2D24,0xA673AD0C6224DBA3,0xD76D46FBBDA87BD4,0x1A49D803EFEF35C,0xBB7D4D0D,0xB77918E70B084273,0x79FEB139DD112078,0x1B84632B5FAE29C5,0xA4EAD7AA4792204D,0x139642AA2AAA85,0x98A1143566ADDD80,0x2FB30AE3882D2AD1,0x4A22CB072273CA61,0x48EBB2E22E0578D8,0x26CDEAAE9,0xEAA9FE64B2E03E72,0x5A0E10DBEDA48FE0,0x4D5FCAC8968BDB4B,0xC48E0752515D216,0x3B43EF69BBEFF8B,0x1FEA2DE70AA36B17,0x78611EC43A8152B3,0xFE29A21C2DFD6B32,0xA91633BF623EE73C,0x1BF81F635,0xADD86F23BC230EE3,0xBD4FE130E852FFE0,0x6ABF56832245715D,0x98400C69B3680491,0x81735D07150680A7,0x7C30CD130E915F7D,0x4AC1E1587DC2B3AE,0x32F6E3C8D7E40ABB,0x81B3AE11620F296E,0xFDDB22CE,0x3743DE94F61BFBD4,0x778D9DFB693B91FD,0x8F44AF07FF2A73AE,0xDBFE247CF9C388B0,0x4824BCEB9E91CA12,0x5095DB7C2F80470A,0xEDC101720ADD008E,0x361DA2F68839E7B8,0x8F453CBD398C99C,0xDACD3BAB,0x1485DAE1484D3D30,0xC8A38233501553D0,0x93F469BFFDD14C71,0xC6D8D7AB426E57A9,0xF4DB886A829CFE89,0xEA75E842EAFA8DD5,0xA3FD23F3E0A8DC83,0x960482B90736D44D,0x4278DBFF38C33E97,0x311A7246,0x33B9909198DB61E4,0xE3A8ADDCBDEEF610,0x205901D05EE59551,0x659B78FAE35A5DBF,0xD1928F9812747319,0x38A539816D0DBA2E,0x266992B75684DCC8,0x136B5BA1D202B7AB,0x590D7E47F41DE2A3,0x20FF0FE33,0x40AE5F9610C3C393,0x3CFFB2B14C59CDE8,0xE7AEE2797D13965A,0xB1D3EBD83AFD3D55,0x7BFB2A1E5CA47389,0xC86A0625269EAA81,0x40387281EDF8005C,0xA4C35EF8FEA16750,0xB128B1C2F8C1079F,0x17A2F882E,0xCC6FD7D63F5ACAA6,0x480D73319D822D54,0xE9E2B3F6DDABEC1D,0xD4F202EB754BBAB0,0x14B1A93D9F1185FA,0x6BB71CE8019F706B,0x5C4E7AD66041EC5A,0xABDFE3EDE372C6C5,0xB2117F03B40E669F,0x217C7912B,0xA9601E9C60EC22FC,0x18965E4420B53AE7,0xD0E2E438B1070C81,0xBC5E5B8F4BF51BC6,0x8A2C1C8929A7AC44,0x966A8825C28F3E3E,0x1862C26C5C99345,0x45E291FFDB952BA0,0xBA59C1F31C4240D7,0x191E2CB67,0xDCB6AEA4B23F9A85,0x4358F167374D87A7,0xB21A07EC02BF04F4,0xF8F69031EC8C886,0x490C2DDF42E62136,0x9BEC9BB3B88E87C9,0x666432E4F8865A58,0xBBAE27FD6A102C19,0x5F1B84E02381D984,0x6605A99,0x16D112E8373BCBE9,0xA7AC57E35D396664,0x612172D95BF2CC15,0x9E534A9C2B6D1535,0xE094A7A499484073,0xC89D9378A3B59F9A,0x7B621684C1A193E0,0xD1B5C3159CAFC73D,0x6713A9EE2B4BDF45,0x1B39D7175,0x8EFC773DF4059127,0x8DEB9F6555EC014A,0x8B76077C8DCAA2B1,0x661719D2EA65759F,0x467964E4C711E8B2,0x5B4A0D37457C26C6,0xCB9EEF412C10EB00,0x78D6FFFBBA35E797,0x7B4B31CF5293CCA5,0x75318CE3,0x3F914587A8C88535,0x89E3F31B949B0369,0x1D95C98552A7E396,0x4B23D0F65D2A4740,0x357A37EE958F290F,0x86F16AAB705F14CA,0xEB88F83D1FFF6B74,0x426BEEA8DA8E24FF,0x626C4E26895549BC,0x19599F5DA,0x1768DF183B245AFD,0xFDE9D3BED06AFFD2,0x1043AB9C1F5DD462,0x1355DDAA03397398,0xD0383764ED4DF748,0x50FC1C7937174C68,0x1504537A8F45A61C,0x153C1B09718073F3,0x8FAA00EC0D3FEBAD,0x1EDC7CF66,0xBBBD80D2750CC561,0x8FD98A8F42D7CA66,0x67A7D2F36FD2DA3C,0x9CFC2952996DECA8,0x99CDE4E877B9B98C,0x74D73AA42DDE89BA,0x6C31C0708F9F99A7,0x55B4C17740C861ED,0x3808C333F12074E9,0x3756968C,0xD50D88DAFDC8F6E3,0xDCF5E316FF2276F3,0x7ED8E11FD000B840,0xCDB3C3EB5523BB4D,0xEFF2CA47E29E4C81,0xB64B09FC65CBD087,0xD9FD3ABED1CFC112,0x43FB6FB813BF82A,0x92A299A4C9173CE2,0xCFA428B9,0xF196A4DF53E18D23,0x7BC2B0B4C46A37,0x8A0817C788E810CE,0x2AB39442E52F252E,0x9C46142DDA723D8F,0xA6AD3117C97C92E6,0xCAE63F6C3E75951B,0x7F64038BEAFC5D6D,0x309C952D75A4E8B9,0x18BF08991,0xC68F94D9DA15FD0,0x531DDD65D9896827,0xF178EABEAF81DFDB,0xF01E5961AE14C971,0x938124810F0FED77,0x2520F77F83098EBD,0x8E0DC1D483F49BDA,0x1A657E1AB610EAEA,0x158075F708F2DC40,0x26A351BEB,0x11836D1B313D07B3,0xC6AE57B0FC1D6E41,0x7647DAA7A8E625F9,0x54B64CCDE3EC34A3,0xCB07A5D8465E37AE,0x52CCB1B46F478DE1,0x5F8D9945EEB93463,0x90E441ACA1E17C3A,0x82C9190E73F3827,0x23D70930E,0x6F9CB306DE38906,0xB9F25D6CD242A0E5,0xCD8186831105F384,0xF1D684C918EBB105,0x587DC9B74B56B338,0x6115B655275026F3,0x6BE07658322F4332,0xFAF5FEE6C530FA7A,0xA9B9F98394226346,0x1A1DAC4E,0x3349EC03C566F1DE,0xDC469E1B53D8277C,0xB179DD6ED09090B8,0x8DB81DBD773B1F29,0xAE4FDE8BBD1C0841,0xFBFD6F679F7B60A1,0x17D01DE339BA2EFB,0x2298D253AA70558D,0x36931B9A0922A304,0x10C4224F4,0x2C29673A9BC4690E,0x7CC4F3C961C4C3C0,0x13BEE7A7785AB19F,0xBD2A6FBF0CD33858,0x155D37C1D30D36C3,0xF36DE591A10C405D,0xAF997B83C99C2F9E,0xED0325D714FEB23D,0x7C314570F91A31FC,0x25AADA0A4,0xD724EDF695901EA9,0x5FED8A766514C4D6,0xEDD44BE089660DE6,0x1655F552D195B01B,0xEADC33DC94098F4B,0xD8442041C8FD799E,0x5DA8044450405701,0xAB6FDCC6DB16B91C,0x779A8176B43ECFA3,0x15D612894,0x115A6C418081F633,0xE80BB6531C818BC7,0x1067F0C949AFC530,0x66FB4C2213211C8C,0x7FB86EAC80F5F1DF,0xDBC1953214315F4,0x1C6051C4F2CB97B,0x4E1214C1F604B465,0xBE99EFEF1D3E623,0x75DFA21C,0xD322DFC66D510780,0x32D43EBD03B2A0B,0x1445CD123678C803,0x182E25F758BACFD5,0x1AB69D053ADA1007,0x1C3BD0C9CB3E7D38,0x7738856C281E8311,0xC94B94B890A53A77,0xBCFEAD9A1E668A2F,0x271B22DEE,0x486C6AB9A9821B7D,0xDD588591CFCD57CD,0xF666EEFD7F90835F,0x2FB0D2E6F6F4FD38,0xB62C925DEC2D110D,0x889F9B518A87A251,0x872BEFCCCAF5674A,0x6843951C34F2D257,0xDF142E06EB8BEC08,0x7FE52785,0x9FC7D4299BD3DB55,0xB99132AC2238F035,0x40437FAAE3CE2CD2,0xF39C714DC9CC1EC1,0xE39750266775EC8E,0x801AF260D33D342E,0xF72CC4051C1AA7FF,0xB590E290DFA24D72,0x2762632594CD332B,0x1A9DF1E8A,0xD2F43F6A49ED3E2F,0xB7034BD1A1723122,0xAAC8A6949EF54C5A,0x446A63782183558A,0x39906C4C895DB68E,0xB9027A6570C47104,0x2B3675CBCA0959BA,0x6BF97502141FB5BB,0x1E7A863557B5E7FD,0x14AD2057B,0x122D26B54F54CA1F,0x2F2C64B91D537638,0x2A8E3E1A00B57CC0,0x1724558E0918C0E9,0x5E9D87236188FAE0,0x543564D032EAF340,0xF855B09E0F0198F2,0x9202EF483EAC2C97,0x9C9F75D413B7A3C6,0xFAD6F4DC,0x3603F3F5242A4E47,0xBA2FC86B416AF99D,0x4D8F6AE45191C0A0,0xFA82CBA3A126EA97,0x12F5264066CC4BBA,0xC8D4D0AA0B396F47,0x15057174744213B9,0x39FA42E1336D0F5,0xB4549493D6A9F749,0x20333A69F,0x9684C358399C9F96,0xDC6E743E2116A528,0x44A0A018E5D02595,0xCFF3D9A4CA0F0D8A,0xA27D7B0B24F4EB3A,0x4A6C3111951A4479,0xFA364CBBD6D7AA0B,0x15AFE651B3A352,0x7381F7036666557E,0xF3939B95,0x25907FF8EB4154AC,0xBDD1C67310751348,0xB7E6D7678B3F01FA,0x4048354F8983182A,0xCC07278376963A31,0xB0292A94B7D3550B,0x7D12D51E5C71816E,0x753BFDD93E9BFE5F,0x70F70F5E42370D7,0x1C90E201A,0xB6FF58459D09C271,0x4A0A6CC11CD24CA7,0x266BE022EDFB75C3,0xF68C9995D32F25D4,0xC7088C3068B77286,0x2C2203A1C035CE73,0xF3ED6C64E4D1A960,0x6A266CE1E147AECE,0x144F5E21A8BBCDC4,0x1B937118E,0xDB5CDB5E9BD69948,0x596FB984B60A3D9B,0x3AD540CC7BDB228F,0x8C790AB9EC945382,0x5F08019084C3C00C,0x9C32AA016E3C5C30,0x29882B216BADE88C,0x7573E09724136456,0xA1FC8AB1172CB63B,0x198DC0409,0xA69EE0F525EF88F6,0x7A40D89B047EBF18,0xFCB2B41ACEF294E7,0x160408312003BED5,0x4B519D4A5C6EE5F1,0xB2B8AB1EE089F1CC,0x6CA92803A262D8CB,0x4A11B9639C51727,0x8D84B7C654EBC40A,0x3E7E25B8,0xBF0BF8B1DECD68F9,0x20AD52A7593C50DD,0x6927136A9EC3D9D4,0x7D89D7B66725F9D,0x18FB56AA2372719C,0x2D1048311BE54126,0xC9669DBB707BDE61,0xB364F57B57376B50,0x325318CF49EA027C,0xA22772F5,0xB9998A81EA9DBFA1,0x7C090BC40AD1300D,0x7FD7C0CF88B2ED1,0x5121CB0655FF2344,0x2C56FE2B667CD805,0x9261D8C6A8815D41,0xC5D101C44FA9A8B3,0xC3C95C212A970530,0xDB9606183B6FD0CA,0x153108BDC,0x76A56A22087D8959,0xD82E2A6DFE283499,0xF36E0064FFB16AAB,0x79F38D29ACD818FE,0x9A48A5B4CE48B7E4,0x135F447973DA2474,0xC9F8A9E9969306A9,0xBCA3E1E2A27424F0,0x6140FA38B995F443,0x82F28A80,0x36D4847222B87484,0xC45BD883DDB3AF8F,0x3ABC387AECAF5DC0,0xAF24A842DB9BE46B,0xE21C6AF08883240C,0x6256E827120D912A,0x67CFF204DB7AEE3A,0xBB3A4E984F156D44,0x4A2F92D525D646E3,0xAF8B709E,0x970D3A4F3612862F,0x91E0005285F70F0B,0xE5D65EB95E2DDFBB,0xFDFF9646C9BAA4D0,0x3DF38B89C44B7554,0xE186503F472D2F9B,0xAA21BAE98BBEAEB1,0xB3791B91CD25F65F,0xEB300C4E30544BC5,0x221339D22,0x70654EB38FEEC6ED,0x5A5EDBA66D71223,0x129C175531F5AB03,0x138FE9D497FF57EF,0x30F8529EE1930C95,0x2B6053C435F4387F,0x1656A3CB5AEA1B06,0x49D68D6B56FA5E6D,0xD4BC5ECD6E11217A,0x2477959F7,0x555A989B08AF1CD0,0x69A9D0E2CE07CE66,0x4F790B756ADCB097,0xEE75029E10A6DAFB,0x1EFFAA4002891B3D,0x227B0B1BA269E25F,0x3D96CF4EC8EFD1B4,0xDF942E7BCC370AAE,0xC9DED0809424FBAF,0x19C84FFE8,0x8B42CFF009A9D17A,0xDA652433A5C26E16,0x930FE6C4CCBC031A,0x7EFD9A01D5BC4FDB,0x9D3A41400A027E9B,0x7EFC5B4F3E4B02A1,0xFD909E54FA9B46D5,0x1B95CDB903415FCB,0xB819FB32663D965A,0x72D4EC11,0x140348A58599749,0xEA459F72B97F2EBE,0x7C49EB10EDA60EE1,0x3D3A1EF78328A4AD,0x7E88F3120CD724C6,0x72638403E3BCC74B,0x34824D7E5CB56532,0x8E9988640D263FC8,0x7FEFF9C674601721,0x1031E7497,0xC5313B88DFC9CD53,0x8CEE6DDF0797B52D,0x1CE3DB4A1EE11A0F,0x8A5AA2C58E29204C,0x89BBD489C4BCA900,0x3B403C7A0942AB6C,0xCF862E0F6A13F0E4,0x9B87FF090007DB63,0xB8D5393A735B1F4A,0xD65D2AF2,0x2D73753636FA79F5,0x7A5C408E938CEC3D,0x6DDE5EF38A825E60,0x9375AB379DC6774,0x131B2316CD4830F9,0xB55ABEE05CB06FE3,0x6F5B6EFE75DBE88E,0x440E6AD58DF03B57,0x584EAA4FFD6E5B2,0xBF035327,0x45F1532681D6C166,0x8FB73F873DF92D13,0xF549F27110B0C9C9,0x98418E8B5CD7C8D5,0xCC1221CE5D315336,0xA8006252EFFC5A7E,0xBDF1E75828A40B8C,0x1E6BBF6A7A430E34,0x7946F463E1FC836D,0x9D02136C,0x7F62F400DC2A9D3A,0x962A321985B9C37,0x79DE7D2A81AD7DD7,0xB77C9801FD0D780D,0x33C58E6D05845F0D,0xEFB734101544B150,0x4B14E6BD3CDB2F18,0x5DC50382B21972B7,0xB53D847447B3A737,0x95A0AF3F,0x34CBE31424A38DDE,0x5D1B6B5E0BD94EE6,0xC70511DB778315B3,0x49B7853B78C84F6,0x1F657707A5804911,0xDD71652338A91881,0xC45F32E90555A164,0x765A77E36A0ADB14,0x7701F728B0580380,0x27BF2F8A9,0xF19594C4CFEA4722,0x11C7F4F6BBC36E6,0x2EC5F1E0999A2858,0x7B9379FB7E0C70C4,0xAED29C74E74B806B,0xE1F242645F7BDB9A,0x4016B6B631FBE1DD,0x1F727D18298E62A6,0xE49DD0CE15995E7,0x264FB1669,0xF37F2A02191C9F85,0xE4F64329EE20AC16,0x892C9797F3BAA392,0xB196FC38E3E42843,0x3E2E3011F443CF62,0x46B871517ED46391,0x499DA2ED3A9CA636,0x610D070E0ED45F6B,0x7397668F471EB9D0,0x47345D18,0x2AC73B450F81EDCD,0xE28359AB4BEC37B1,0x950B98E0F0AD1FED,0x2F1368C92CBAEC71,0x130BD591A8EB0670,0x20313D6FD65C1F46,0x95490C3F64618942,0xE22EC89C9F380E01,0x407D33C7BCEDB8AE,0xA748FE13,0x23C63E44D3C67456,0xC041DFF7AC12B7D9,0x8B7CF235A29F5FD6,0xB4FA3F1F73DA68FB,0x6D869C6166E05F6C,0xE573496FA481AD43,0xD6D1B0C83010D30,0x2412781687293D14,0xB393732469B796CB,0x1F30F0130,0xCDFD731B4B960906,0x2F1FC33E11124787,0x1E57D86A8F903D,0x760F0B2CD7382E25,0xCCB66C454A282EAE,0xB8050433391EEA2B,0xEF4162997407B2CE,0x2324C83E07A72EAF,0x72FD6E15D7A9F92B,0x46EF284,0xA3C0B3101E41A848,0xEB94AB6A6FEC3C54,0x8544A97F9A02C5B7,0xC6FB87218FC4C0BA,0xB80039D006CA4BB8,0xEE1D30FEFB700947,0x614C7C8E36BBBA9D,0x6FB1AE08781FA72C,0x7F1351836E1CA12B,0x560EC85F,0xA2881B7892DECB55,0x9673599F267118B8,0x53677A8084F73D43,0x48D53E0C097B01C,0x576974C1ACA855FB,0xEDD5797FB6B4EB5B,0x3D4DE049C67B8DB3,0xF3245B47AB2958E8,0xCA4247FEBD6D68F,0x402BDC71,0xDDF2D092C3F8029E,0xE51563CA13630A67,0xED016046C968DE79,0xC86284E1B101F073,0x72D11D89F1E5D848,0xD69C7FC451C863E,0x3197898DC1708E28,0xD6D70F97B0D18564,0x153E12F61F99CE86,0x2636F833,0xE191D6CC5C6EAE9E,0x698FDBFBAE38AB63,0x8B9182AB3A45B665,0xB7C024CEF05E1354,0x60E6E4F9E8CF99F,0x14068447B9E8447F,0xC6694C71A02F122C,0x7B5C715531D2FB6B,0x6319C304A777C120,0x58EA0C23,0x1835ACDC0852DD27,0xF28493F7D010E6F1,0x2012518C8259AA8B,0x8A776F1299A6B513,0x48FE2663BA2CFF85,0xF50A5E8BF0FFEEA2,0xF2011438711E9F2F,0xEBC90E3B0FCCA8E7,0x80062F05DD83E1AC,0x204803748,0x39E12C6012C4414A,0x676BDB2CC6D3E93C,0xFCA8918CBF161CE6,0x571519B00DEF2341,0x4A60651C9C04CD4E,0x3DD76D0E35D55351,0xD605BE802B582F2C,0xC9A6830247822906,0xE82B40A763B9E324,0x1752BBEC6,0xCB52939FB4CD1F39,0x8855F2279B3D62AA,0x1AB1311E100E886A,0x3B7D4DC3B9960B26,0x9F41B27126D1454A,0xA5EECD227E24ACEB,0x4217FFDF1F3AD9D,0x2AEB73C606656187,0x417E568F73F693B2,0x18F3C1E4D,0x94E49FDFB36AF887,0x4AB9CE603639C367,0xCB2B229AB7ADB2C4,0x106D5A9527CC43CB,0x250A0C4BB3D5D06A,0x517C262F35B384BC,0x743AE0BEDF5DDCAC,0x50A04B546C37816C,0xB6AB374D5F38B950,0x228BFDC02,0xF094BDEA6B8DD1A5,0x4F4E4D39F331462C,0x938A08FC58153F5A,0x8CF5BCF9ABADDD8B,0x41C72999BF8DED53,0xBBBB221CC7D4A5B4,0x6345BFBAAE39F4A7,0xAD901516CD63C75B,0x15D84CB8EB5B13E2,0x166CCBADF,0x915E9178378BF0EE,0x87DA42EF730F1C29,0x8201A34843924DBC,0xB3222EEE34949241,0xCDFB6884E5716D4E,0x4CF4E46E5E6A819E,0xC118460897A1E244,0xAC7AB5AFA2995BC7,0x78F456AF1003F4B,0x1B4A8341F,0x216FC83D0E3A7447,0xB7F0CC7A94684D2B,0x42FA80FD55A40C7A,0x8960448D33FD8EC9,0xFAA6270BCE4F5874,0xBC5E2220AF5E2B4F,0x9A2A51C03F8C8B22,0xA4FD45C2188F9A84,0x1D680F935A592CA4,0xD718A3B1,0xA785CD5567BC7E9F,0x97D111B05121440A,0x4C7A6760B3D3A0F1,0xE013B756FBF1F4C2,0x62EC8D43F14C2946,0x815F3F8AA58A2375,0x731A3C05FCED2C2E,0xF80C93BC88AC0363,0xEAF38EF88E0C7717,0x1E1D0E3F7,0x9E19866CE51C0B0B,0x6C9941CD7808ECB1,0xA64198B02B420B9C,0xE646A3508C9C1DFD,0x1F3B15579510F3E3,0xF28FCA23C7D1BE4B,0xAD1478E018D60F64,0x48DD5A8F33ABA020,0xE8CCC7A3F2515B7D,0xC09F15E8,0x373ACABF9C0C62D4,0x92057E3F84DC9AA4,0xE0D05780718885BC,0xA4C265746088A411,0x189B93EC116787,0x58DE35FE1FB93419,0xA24770573768FA1D,0x7186B66BE375772C,0x7FB0236F85F732E6,0x27A94B1A0,0x4375B93832E97F2F,0x155C9FCB7588AD35,0xF3ECDE88E92D068C,0x25940E08B9A7B57,0x1508BA5A9D8EE205,0xB8A4B6CECBF073A8,0x4F31ADF1DF761471,0x16226771628BFD76,0x13BD7C612CC682A8,0x2690AF836,0xD09510D3C80D86AC,0x65C2F71144140792,0xF5A149D477FCB82D,0x3C95EC450387F6AA,0x353F5B4A4B9C440E,0x4F804EC3598180B1,0x784AE631E117EDC,0xF4435338C1392718,0x435A80B0F91F0585,0x14F2B19D4,0x7D460B334CE74C19,0x9640A08A630A9FD4,0xC1074EADC0705C28,0x827880949F8C0DC0,0xF9471A99B5E4EB3D,0x24633C8005570601,0xAD49219B6F86A09,0xE8297C3EA1AD9BF0,0x334C7B1752CB797B,0xD3A14823,0x47932CBAA87B2F7D,0xA8744634064EA37E,0x79EA8798340EC516,0x1F9ECFA58272B855,0x13091DA01D240748,0x14FC3EC7965756FB,0x35A7F83899367A48,0xDECF56FA98787221,0xDD01EB492FF91B94,0x4D40BE22,0x33CA3689CED1FAD1,0x4C1D3A64AFC5A304,0xFBBCBC59BEF4A94F,0x5C0246F623376B2F,0x3C794D1A32131769,0xA473A862931124EE,0xCC44AB3BDE965DC7,0xFB7ED7A91E86C32E,0x3F9B612A1C17E781,0x1651C4FF6,0xF9B23E5D74D823DD,0x8861C8BA817C5642,0x3B4C4A3326E2A714,0xD5155DBBB68C4813,0x55CA7B3D7E4EE55F,0xD27811D9F4C1A7B0,0xC7024B9A58A8BE99,0xF1043E6DD8057F,0x2544636200096401,0x15DE3C241,0x9B6C858A66826481,0x46109B952C0A5734,0x4543B0AB41EB6DAE,0xD535DFAE4E6721A2,0xDD3380FEA2026116,0x30EA6F67A305E1DF,0x9970A903D62445DC,0xD61F07409C4D2E46,0xFFF0B0724352D595,0xF50C830D,0x6E4828CE2A97F684,0xC995B068672AFEFB,0xDDF347DC06954800,0x510661A0FFE60CE9,0xC58A20AD2ED06A78,0x210D401A51872189,0x8D949837BE6C32F8,0x5BA8E1DF00F1BB7,0xB9C9782920DF6839,0xC8B5C5B5,0x743D1314FD146CE3,0x6D0C467BC5D5FFDB,0xD2B1B3A3FAECEF1E,0x85FE6D45067D8D4B,0x589A751A5750FCD8,0x1B8A39F85199703A,0x1B3E18FC3E86D6BD,0x5282348D2E1641B,0xF1539C35DB2B0160,0x1F7FFC578,0x34BD2931860DF1D8,0x2C89100574A4FDA4,0xCB604BE7E5A04AB3,0x255E54688E3172CB,0x26787CD4F7520C00,0x9F40E728D7A1DFBD,0xB8262C3F3E4C239F,0x8776E2321D205FF5,0xBF8DC43D8D958BF2,0x14EF7FF30,0xBB47C17E21D322C,0xFB670A02035407EB,0x279F68E308AC2A5E,0xB74C2A39C630AEA4,0x5288C1604C4B8,0x117A4B487D6FA30B,0x9BB5F3208ACF4C91,0x645EA2AE22B5B200,0x7565C0562540F2BB,0x242749A44,0xCE35E8F489347A4C,0x91478C981870DAEB,0x2431D05E8E864832,0x77A1008F8953E9FF,0x5D223A60B454214C,0xC8CBC5DD2DC03555,0x1435BC71F6C6A786,0x10AD9B94B512E7F0,0x38315F7F70AE5F45,0x76C87DD5,0xF0204D8CD5ECE0FC,0xB7055B6BD3A532D9,0x2B3E8CF63816E942,0x2850FECF416ADE9A,0xD6860D2FD21AFBF8,0x802D67331C0D3F79,0x34B211AF31593F0,0x979849E31A2E4D1C,0xF73FAA2BA9132FB6,0x1FCA582D3,0xED92A76BC3803EB8,0x9F8B1291F80E4FB,0x8B741B09A22CE590,0xAEBB7034DA7ACB50,0xD1ED5736F792CAD9,0xA0D34B098D22E36D,0xA353C628178456D8,0xAB94D78C237D6CCC,0x9DF464F2C4574C7C,0x161BEE508,0x95F390A3D16929E8,0x2FD0A62B3DA004AA,0xAB766728868D8041,0xC73F0A2DF15D99A4,0x22EB3FFFF3819E44,0xE45D16EC76D3AC3,0x6455A0FC9198B1CB,0x1E491EF19E28F7AA,0xF50FA6D59C44870,0x17D7B0967,0x7D9A4AE625B4E814,0x66C749259E8389D5,0xBDE32B0CB64A3630,0xB23E12C0151DBEC7,0xC05A282D4BF84051,0xC696E3B9A3B0762C,0xF5F43B286EC4B649,0x89AF11073812A547,0xF0FFCBD3FAEC4259,0x1B7232BCB,0x34D1E37A4F150358,0xDBA081437BA9EE46,0xA0C71092A8CA1B6F,0xAC4D315A2B987558,0x6275E22CA62B86DD,0xF1741E1697FA8BB2,0x8716C72751E05793,0xC2FF9DE075991CED,0xFD0A8A28553972B5,0x13106D210,0x6AFDAD526D4E2EAB,0x97481DEBB653D286,0x52FAE8E895BF9095,0x2E051D34E6B21023,0x970D7718CB0389E4,0x77B1841A58910A8E,0x67FB31D4F8530DD5,0x12E2B0827790B6D1,0x1D1D321593F01684,0x23C6BF933,0x40D634BC1780E690,0x84E57078C05306BC,0x822F4F3B58092CB2,0x3BBCAA03993D9C09,0xE44DA31EB6242B2B,0xD54003A34173503E,0xBF7B6615FF810A8C,0x46105857A7D3B7D8,0x84337C54EFB1DC72,0x238A28CE,0x1406047FF22ABD31,0x3CC3A9431AEC7945,0x12B82A735C929226,0x7C8FD7F0C2114873,0x4E63197DA4B8AD94,0x59764B57E3487AC4,0x19B7CD71E581F392,0x74ACE7D9C912FA79,0xE34A9E502A431DC,0x19C7BC784,0xFFFFFFFFCC799B8C,0xFFFFFFFFFFFFFFFF,0xFFFFFFFFFFFFFFFF,0xFFFFFFFFFFFFFFFF,0xA0E7FFFFFFFFFFFF,0x8AAB6C8A1621F30E,0x95C2B32832FE0F9D,0xC8FAA1EF288EBC39,0x77DB8F8B0ED180ED,0x1F7AC32B6,0xA746D1C4492361CE,0xC1D7F06F5A7E7425,0x740CFF53DB571965,0xD1ED1B8FFF4F7079,0xBDE6CACEDFF66F16,0xBB3BFA4D62A50B2F,0xFB76D038C4953FF0,0xE298590E2E80958E,0x631185E85CB1C339,0x1B9190568,0x8B5F94BA19AD1E9E,0x2EFD55228FE7563F,0x8213F46AE90229FE,0x68410F06438AF8C6,0x4D3B0FC717C8BD6B,0x37C4A1E2D5D63B01,0xF27ADF326789157,0x70C682F94A69AA23,0xBDC13343461E1498,0xF3502EA3,0x1A53C6227D529954,0xB461E08899702302,0xD76BE04035AFEB11,0xA77A7A350B85005F,0xF8989E402669C834,0x86FE397DEE86D313,0x52B581D78CD934F8,0x73BBE39B5B3AF4F9,0xE8F04683029ACDDB,0x3E980542,0x2FC196FB4A689826,0xDE4EE327584BBA85,0x19F53EC2154A76E1,0x7E7CEEF786006905,0x2E589CD4B7D2180B,0x8F19C06A6F5A429C,0x7A604F19DC8B5C3B,0x19370DD8FEDDD9F6,0x8494D627B95B9041,0x55E35249,0xFCB5848442B63827,0xCDB26D834F28D38A,0x7507A10C8F2A4894,0xDCFEBB93E6CC0339,0xD183566B9C331F6B,0x56A444000709E904,0xDA66999D39E6DADD,0xD28226487819B19,0x6353B9EC7310AE4B,0x173B6337D,0xF5CF5C4731826933,0x63231358FC89FB79,0x81D7E5337E8590A0,0xB2C2888D0824D90F,0x607E4AE5B52D64E2,0x3920906A3BAEB55F,0xB63BC49139006ACF,0x413A23B9B07DEE8F,0x27B8AE16EE06749,0x182727FF1,0x48DD21B49FA6F63C,0x3A3E392029DE8C31,0xF282DF24D0A9EB7D,0x8CDFBE5786EC4BFB,0x99E1AB5854A63451,0x2755FC90CC0E966F,0x3DCE0EE9307892AA,0x2382ED51AF24552,0x317207966D56B667,0x682B2C9B,0x42B365B47F5ECD6,0x4D939A922906C53B,0xAD220A26BF3CEC5E,0x2062D6F6F86472C1,0x578CA4417E03F4F,0xD148E955BB387DD8,0x96CE6A4E8B3B12D5,0x68B47962E4A44B38,0x967AB702D57B8EA7,0xB8D331B8,0x1F5CBE773A4BC46C,0x78B1249107100A10,0x67424AAB13A69D5D,0x371A6FA55126E151,0x74CB1CD6433EA98D,0xD807852C5F62AE18,0x8F1E09B620BDAF51,0x9AE73BF76E6A84DC,0x65C3057353A8ED37,0xEAF66733
-			};
-			const uint64_t *ph3_T1 = {0};
-			const uint64_t *ph3_T2 = {0};
-		#endif
-	#endif 
-#endif	
-
@@ -1,7781 +0,0 @@
-/**************************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: precomputed tables for pairing computation on E0: y^2 = x^3 + x when using compression
-***************************************************************************************************/  
-
-
-// T_tate3 contains 6*(eB-1)+4 elements from Fp. There are (eB-1) 6-tuples (l1,l2,n1,n2,x23,x2p3), each corresponding to a single step in the Miller loop. 
-// The values l1 and l2 are the slopes of the doubling and point addition to compute the tripling, n1 and n2 are coefficients of the corresponding lines and 
-// x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
-// precomputed values.
-
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
-0x1ACACEE95C25B36F, 0x8283860F86A452E9, 0xE463E8A5F4ABDF67, 0x5F4496B7DAFFDFB8, 
-0xB96E4571923D8135, 0xC0A7D039BB9DBC00, 0x5B4B7691B62F4EB9, 0xD5DB546FC843767A, 
-0xBB5D5CB6F297EDE, 0x8683C34F, 0xD51008F74037048C, 0x8C9DA54F68721E6, 
-0x6E6BBBA73729328E, 0x16A7B8815DA44FCF, 0xB9103FC3DFB5402A, 0x4344E673E040795C, 
-0xF6CBC30639B40D70, 0xB5B2A09F36AF62F4, 0x391A008C7948C385, 0x22259942F, 
-0x2E7021FB37C11B7E, 0x135FA1CCFD99A476, 0x6DFD54E21ACB8758, 0x48F64935DF5A5CA8, 
-0x1541ACB019E2466C, 0xA9EB8C72617BAA9F, 0x52EAFB8F96828E74, 0x12699D6A31D85792, 
-0x98E48A0A28C02C46, 0x177CA30BB, 0x8F692C912C63FA8C, 0x9DD48425F0A9B9EF, 
-0x5793C472BE67B781, 0xF1D532FA444D9A39, 0xB181C2847E631112, 0x6D791AE36802A83A, 
-0xFE5F4F1D7D5803B2, 0xD87D8AB8CFE2A161, 0x76D777B51A654279, 0x35C64E9D, 
-0x5527494F2E46C083, 0xB43900E98786EDCE, 0x60E4E9E9EC328495, 0xA48B3D4A7745C7F7, 
-0xCD9EE90CBBE6CABE, 0xEAA8C52F8FDDB50F, 0x4FAD073D21E314B3, 0xA6D657EC69C36C0, 
-0x67E409EAC1891280, 0xDBADCBFA, 0x6D33BE2991DEC70B, 0x512447B1C4BDC002, 
-0x1AED6BCADA4185C3, 0x3079F4483460C2AC, 0x6B116A3D4AA94F2F, 0xC07C8496E931546D, 
-0x1AE8CDFD601C143, 0xD92303156AA0F57A, 0x1DE0BA566C5629B5, 0x15B563596, 
-0xDA3DE36BE80D087, 0x22FC2AF2844A8C06, 0x646D8D7BD0712EF1, 0x5E4D6D5F34C4A489, 
-0x3BB015996D1117A7, 0xDC0EE37A9D34567B, 0x19404A3D28B8A0F2, 0xB1CE29B6375A6D5, 
-0x4989F4887D3277A9, 0x24C07B525, 0xF90274631CCC83A4, 0xAEBBC3B48C46ED79, 
-0x8C02C364901C02B1, 0xEA3FFF739ABCBDF, 0x48ACA55813A71C62, 0x791A160A5D4F457B, 
-0x862129402458149C, 0x146C4F8AF0DE533, 0xF72D8EBE27DCA178, 0x2A011EBB, 
-0xFB9191F0337FD0D7, 0xB9F089316C0ABEFD, 0x4EABAB267D5DDDB1, 0x1302D1CE0AFA532A, 
-0x29C636375CEFA2E7, 0x3A20872AFE799023, 0xCCE299E108929F5A, 0x33C9880A78D6CC28, 
-0x1766177816D08D0C, 0x232633AEC, 0x6ABB765D111280F4, 0xB3FA0F69FBE5FE6, 
-0x2CC308C221F6BC60, 0x7B531D96DF381494, 0x696941BC179450CC, 0x6E3062E981011710, 
-0x239F0EAB20A6D7BB, 0x9CF3E72C3E9D288C, 0x777732CE1EE9ED00, 0x18C81AD05, 
-0xC6CE6F6ADC742ED, 0xCA9CBDD1A11A4B7B, 0x6F16DBABF46B71FF, 0x5D2ADA1BA07CC48D, 
-0xF27FAB9317A14FE2, 0x7A611517B1354437, 0xF0987FB423B89B7C, 0xE7E8517B071DED71, 
-0xF9BD7DE55681399F, 0xE44B326B, 0xB58A4BFF6C53DBCC, 0xD20A86786F271AF5, 
-0x7E7DA8096082B9BB, 0xC41EA838A43686D4, 0x576A494AA092A6F0, 0xF5BB223A90449212, 
-0xE33217963719B01B, 0xA462F2E06692EEA4, 0x6C7BCE7457CB47D5, 0x20D043AE1, 
-0xF19295B7002E708E, 0x1C9F07ABCF85E8F6, 0x538ED666BC5B5344, 0x9A87782F5A21E198, 
-0xF1535C02026E7EEE, 0x2378F9CACDB8624A, 0x23FB1CA0A23C745, 0x6320ED558AF96900, 
-0x98E01C8B085BFEFE, 0x89BBAB50, 0x82639109694EF37D, 0x85D819A8049521DF, 
-0x41D7382F6B6039FD, 0x5EE8E300A016829C, 0xE2B0EBD1905973A4, 0x6F29250FE8CA0743, 
-0x743908F9249C72CC, 0x2C796E42E9C14823, 0xF71DD3553208E166, 0x1A179B8CE, 
-0x5251A2207F56B6EC, 0xE7AAD77257403ACB, 0xA590FE2E023109C3, 0x51D90FC3F7994D7D, 
-0xC3B4287E71061F84, 0x4E5BB56F86E02412, 0xBD03A79B805BEA3A, 0xB6C1E699384E27B0, 
-0x82675FEDEDFE37AD, 0x535228FA, 0xA8B0122BCD12DA71, 0x5B96E8122F53015E, 
-0xD0341687C5841242, 0x4FDB59FA5CC4B088, 0x5B898956A9B6EA4C, 0x95D069CC76067D92, 
-0xEA62207276E7DD7E, 0xAD64F2C7EF1E99ED, 0xF22EBD3F4175829B, 0x264E33ADF, 
-0xA034207978A4CB62, 0x16C5934BB4E742B6, 0x1552D5DCE5329C23, 0x2BFE231BB5FC4BFA, 
-0x9B33EFA49C6FC93D, 0x8131F22FF8F1DA49, 0x31F859AF529FB508, 0xBEC4134A398991EE, 
-0xB1EEE30DF6B43A6A, 0x2390BA54B, 0x3CA9CA5DBA1FF9A9, 0x1010A095753B125C, 
-0xABF4B85892DA7284, 0x1E4FDBFBCF5A1330, 0x12F9579375C70980, 0x5B73BD9B50C75C5C, 
-0xEABF95C6C28ECFB7, 0x11F0684A2E8AC911, 0xD164CD55548C29AA, 0x72232303, 
-0x30415AFF3D8A8F7C, 0xA28793A9FB3A6582, 0x6C5BB1132814CBB2, 0xF4BF41BC91ABB70A, 
-0x3EF7C68D4784215D, 0x4166557BD2BF1CB3, 0xF99E3258CE82EFA7, 0x22A97D44058A9C4D, 
-0x6607A0D24C84D55A, 0x10FD42BBE, 0xB8392C4B50FCAFA0, 0x7DEE2A7216988DE4, 
-0xD8A4C4B5134591D9, 0x695810DC6208E33E, 0xAEB0CD02F6A062FA, 0xE3A3953841019421, 
-0x9F0D7E1C0F2B7616, 0x526017584D0F8E91, 0xE61009308DDB9264, 0x120BBCEF8, 
-0x271036FC409F26DA, 0x4B45483E16C2A866, 0xFFF1B6D4064E5FA9, 0x5196EF9D9C6EDE49, 
-0x5968656E28567CE4, 0xB046EB1AA20ADB79, 0x2203C46D44DEC109, 0xDA113BD05A169F81, 
-0xFC3DC9EF9C33B338, 0x1BBAAD406, 0x348455E317F2F62A, 0x99841E1E570F974E, 
-0x2039233E5E759DB3, 0x52AF42439FAEF541, 0xC7095155A03A97E, 0xCC088FF1C16EAE, 
-0xC96538FA5714FA7C, 0x247E0FFBE3BDEBA0, 0xA082D3AFCA017888, 0x13E022416, 
-0x3757A1F38FDA8148, 0xC6E39D79A7307B54, 0x5EDDA6B34B2ECBED, 0xE9CD0D3FDDB9C161, 
-0x9F1315332C9C4D3D, 0x5EC0B116D4C11E0C, 0x854FE07BCE1F54A3, 0xDEEA38EED144A9FD, 
-0xBAE628C32EEBD6C0, 0x1EF0C85A6, 0x63DB32EEF55B6BC7, 0xEC1AA7CBD77F1BCE, 
-0xE2AB63DFAFF2DB0F, 0x1255C136869D147, 0x909C74B58E93A0C2, 0x784CC514B6E974E2, 
-0x1B1F044422A73CE3, 0xAEE1A7AA82E578ED, 0x1D739B1EC49CB056, 0xD717C3A9, 
-0x1945D3CB7820B1B9, 0xC1AA1250807A9C00, 0x110426E382E05551, 0x37C1D53EEA312387, 
-0xE55138931091C680, 0xEC690D33481A7D13, 0xDBB241DE3AA0014C, 0x294492664F9497E, 
-0xFDCE714F890B0987, 0x1611FDFCD, 0x26166AF39C54B96B, 0xD4378D7A30D512BE, 
-0x995EF437046087CA, 0xB3022E8E0D2AD110, 0xFEFA04528F215828, 0xDA0CBEACFA394840, 
-0xAFBF6E78BF3BA329, 0x63AF26D7AC5D4E03, 0xD7298715BAF87A3E, 0x121D661C0, 
-0x55F4483F7C607429, 0xD3A1734919977A1, 0x7737DDA1923C6D30, 0x68EC16AEEC101F5C, 
-0x78A8B15C5BF0EC4F, 0xEBF11DC80736298A, 0x1C451C1062D96BD3, 0x5A4555341350D4BD, 
-0xEB7B3143ACBD38C6, 0x1A6D6937C, 0xEBCDC091A2FE1BDF, 0x244BDB92550E80F1, 
-0x3373215FAC683F0F, 0x446F85184B189EEE, 0x6648A93EDC28D57C, 0xB37EEC3A05BA7BCF, 
-0xE35E59F3082F6ED9, 0x8B1377E5B924BC38, 0x79E90A939A78BDD6, 0x1D63039CA, 
-0x69FC17AD594DB90C, 0xF152D2A7CE9F531A, 0xA48FEA0C5005AE47, 0x8C70D3299C7D7FE7, 
-0xED2159A64BF2259B, 0x324FDAC9B868BD51, 0xE0A61355FB9C7C77, 0xCC477DCBCBFE96CF, 
-0xD382A74FF3879F6C, 0x5CEBF7D6, 0x4C63154C6EE8C2C7, 0xE222D294C1BF099, 
-0x37F50C48E86A16D3, 0xCDDC8D582A7803FE, 0xD43AC94C48A73170, 0x9D35220292DBA87D, 
-0x320BBDFB055803C6, 0x29C62338DC802A2A, 0x11C1CA14C0D4CD84, 0xDA86F3E, 
-0x7164A5F02225DC3, 0xD431345B26FE7922, 0x9C65E70C7BDD5072, 0xD1917DF6283AC0B8, 
-0xFD06BE81F4267DFD, 0xC0924553D943333, 0x47B3E41FBC8AAB90, 0x18A6B57B8EF90AFF, 
-0xC32CACCB78794345, 0x241D1492A, 0xAC587564C0F8EBC4, 0x8C571DD2AE6D1C67, 
-0x572007C2088CC58A, 0x2185FB9738369D3B, 0x3660FCC6C0146F13, 0xF6E42D0E29478260, 
-0xE230A2B1CC34A1A2, 0x8851938D5D610A9E, 0xF276E09FD902DB39, 0x1DF83A7DD, 
-0xEBF6D2507DA08937, 0x1742E76C5F81852E, 0xCF0ECD796B0D9FCB, 0x9D687E70F54907D0, 
-0x599537612883CD6B, 0x1C3E2FF596C0D129, 0x7339C833F1D025BB, 0xC6C77BF766AB18D0, 
-0x8A5025BE72249E0D, 0x2321B6C5A, 0x29F3E05ABB5192BA, 0xAC3214DEB794F2C3, 
-0x9CDD895EA9AB6A63, 0x69B7AB6DA55A6836, 0xBE88D2F20B92325C, 0x532C020898CEAEA2, 
-0x2495BCB424B13814, 0xBB3951FD6DDB5DA7, 0xD48D6CB1C2BE27B, 0x1A031B5D6, 
-0xEC16B8A86DDB49F1, 0x3AE4D1BDB1BB886F, 0x5D530DD998736474, 0x1A3F845BF0A4CD04, 
-0x6F8DF3F3C6FFCBF1, 0x16E7D6A0B6A7D62F, 0x108BEC71A19CADDB, 0xE7A3C2343BB05FAF, 
-0xA755C06965DC539, 0xDA54DAB4, 0xEE9A685E81816BB7, 0xA6FF256F6B267C9D, 
-0xFB601D1BB3248AC6, 0x79108723BB40B123, 0xCA44400B6F84F3C0, 0x2D76684D838574C0, 
-0xDB11F30D1083A151, 0x2E0076EADBA97F12, 0x52E36C6422503151, 0x61228400, 
-0x8E2F37DED71EB74D, 0xF6D22A75D6090E68, 0xD6F171CA0A8BC9C6, 0xC03800C657F1132F, 
-0xDFA0A46CCE9D18D3, 0x3BE102C976C12C40, 0x71EEDFB72472A3AE, 0x59CC6E3CAD4A55F, 
-0xD5AC5A39EA58083D, 0x5C79C748, 0xE949A1EC5732C470, 0x8472EAFA9A4BCC07, 
-0x8B2E28F1F0F9220D, 0x51EC25264B18B3BC, 0x47959658F96B085, 0xC1AEEA79B2D154DF, 
-0xF72D6FC77A6BBEE5, 0x8867814305FF9B2, 0xE0AA4C972ED071E5, 0x18AF7FBDC, 
-0x787370F982C30502, 0x7EAC30202B2D2D95, 0xE4C49E84314380D2, 0xD97CEB7A74D6C949, 
-0xDAEB4E354D68DF72, 0x92B5E8034F6BFB0C, 0xDA98A728E889EF00, 0x9E023CCA75BD7F0F, 
-0xAA407096AC9623C0, 0x7CDD7BCE, 0xFF2C83E6A622EAEB, 0xD8476AA06E47E5B5, 
-0x65B3BE16322C99DD, 0x1AA6AF3A7A87D438, 0xE9BDF33AF29CAFAF, 0x3B1FC66A0A479205, 
-0xF8C7224A6BBC1CC5, 0x5E8EAC926813DAC2, 0xDBC008DC8B95D010, 0x4AD55439, 
-0x3A821689AE3B02C2, 0x6A1C24BF0A3FF05D, 0xAA137D0958250B8B, 0x8F18E6313EEF1FBE, 
-0x187A601516164373, 0xCD831E04DB1EDB9E, 0x822FC8D62BC3CC73, 0x8323B3A3F2964CB5, 
-0xEEE09DAE09AFD70C, 0x25A8637B1, 0x270E3ECD1E5B6863, 0x4B56539FBDBEB0FF, 
-0x891ABDAB69A55A63, 0x19A54BC39D200A0F, 0x6E0C6A8AE78AFA5A, 0x594FE0D60FFC5D98, 
-0x4AB2FB7D44D529B3, 0xF9D445B7A32FF31B, 0x7FB2EC8EF4971C5A, 0x167660A9D, 
-0x35E7492074F91FF7, 0x10A0E2EEA8CDD97F, 0x20D95A2471A0D3B6, 0x6DAD51A5546E7859, 
-0x8FAC5C59E80FE03D, 0x4F3E4A58AEC5CEA1, 0x30CAA20B4AED7AD6, 0x3311FFD1990B2FB4, 
-0xCC9AD13091DC4EAB, 0x868CA09F, 0x458492DAEF78CD47, 0xBA6FB24BD276B27B, 
-0x27AA0A1215C7E75, 0xCE7B95CF0B921519, 0x50B5862F036EC0, 0x5C950A0680EE6B60, 
-0xDBA06656B465D79F, 0x22FFE6BA2F497EF9, 0xFD1D5DB641E3D9D9, 0x195C462A6, 
-0x4CAE3F74236F7388, 0xE70F98EC98DC2873, 0x8C67C42A9DAB695B, 0x66A49DB0D5D5758F, 
-0x75DBF123FAFCCB9B, 0xEBBF67D72B5D7E7, 0xF62D0A8CF2199686, 0x7D1EDA66B6C69AF9, 
-0x189B77692D07FFE5, 0x495BC6EB, 0xBE1F5CD639A14931, 0xD3E72354789FA0CD, 
-0xEF95D6A7569E5BDE, 0xD082D71542BE61B4, 0x439B61C7E38E8FD4, 0x2809B6128BDC0271, 
-0x1BE9AB19E70C846C, 0x53DE82BB2D4733EF, 0xB8A1A1AA36CD6A85, 0x3B893477, 
-0x738F94EFCE69D4AB, 0xF0528FEB0664F961, 0x5635EFDC176D10FC, 0x3A16AF05705BFE32, 
-0x16BE984ACF67A258, 0xADDB7BA938BC830E, 0x3E1507928F4C9CF9, 0x702E95DF73FC7404, 
-0xD6A20B1AF813A45D, 0x13F99BCB0, 0xAC74299573290C54, 0x8D585E90DA1DFB43, 
-0xD8AEC4836CA10302, 0x1F3CEDE77C407B9B, 0x240B0281A73CD5AF, 0xF3834835721900AF, 
-0x57F912F4F7381B74, 0xA282CB3A0E9DEFA2, 0xA7B96E48652E3B6A, 0xC582FF1F, 
-0xBF3156F0C5D3938D, 0x7ABAF2910E8C1E97, 0xF535CB8F78BE9235, 0x9142C25DA47C74C, 
-0xE824613BAB5E131C, 0x59813A4738EB4B85, 0xC1B2A05DF381888F, 0x833102A9AA31C5FF, 
-0xF80138D9C5EABD26, 0xA657BBB0, 0x42CB34231D0128C0, 0x479A30225D9B6ECB, 
-0x182CE707A2405418, 0x9C8F29EA47597449, 0x8D7ECDE3C25B690F, 0x755FE32A4BEB0F4E, 
-0xC3FDCEF3F17F86B4, 0x6D8CCFD383426948, 0x6FD4214DD3E8908F, 0x1A8F16C41, 
-0x9C3DA10F85B02A2D, 0x5109026DC50941D8, 0x4DD2589489A3C341, 0xB37846695A4E94AC, 
-0x5A2754970A5D16F, 0xECA9631B7CF480DB, 0x560987C241B88338, 0xBDE61EA935FD7A00, 
-0x3B0A356D664B55F0, 0x27CA99B, 0x9670346E3E9296C6, 0xF2820842D8403153, 
-0x633CD97FF3C4F2AD, 0x6E7E7BABE72A99BA, 0x99F73110A26861D7, 0xEE87DE3FD7AA75AA, 
-0x9D16B10B3836DBC3, 0xC1405FBD03816330, 0x97EDADE95F7BBB0B, 0xB2C1CA97, 
-0x4421EF3679CA138A, 0xA99E442419AA2462, 0xB47708B5EA5606DF, 0x63FC27553640AF25, 
-0x275035C93BECE1B0, 0xF9F691DCCE77E27, 0x207220E41A4C3051, 0x28C113459D7ACD94, 
-0x44500419D44D5213, 0x23D48BB97, 0x66251897A3B244DD, 0xAF9AC36710F04473, 
-0xE2305ED69576402C, 0x7BD19F5613F40D37, 0xD3664EC75ABC498C, 0xB2B3E6832A599334, 
-0x294F228FB5125E15, 0xFE5588BA76803C92, 0xA2D47E6CF05776F6, 0x25AAC6D54, 
-0xAC511348A572D6FC, 0xCEB62327517C9FA1, 0x6FBE8410AE9D774A, 0x66029A9B99B0D154, 
-0xA48A8878CB67BAF0, 0xE4AE540B10064456, 0xEA637103E8B29BD, 0xB55804841AE272F8, 
-0xEC5327AF19A29CB4, 0x8ED88601, 0xB1B72AEDD573DEA7, 0x69470D9DEEBE72B4, 
-0xFF7707A6C6084563, 0xAF35F4807376AB99, 0x812B0F718DC2C36F, 0x2C674EE824C199AB, 
-0x4E8A50BA09BDA56F, 0xEB832FAE28A0088D, 0x582DF346AD3204F1, 0x27084CB9E, 
-0x75B6301A5817C1CF, 0xC7B14446A4F49797, 0xAEEC5C720BF046AF, 0x95822B18647C64D9, 
-0x8EB7723D8D0FD310, 0x955236D3BEFABB6C, 0x9AAA01F7A2969E7, 0xFD92FE0D3036E819, 
-0x26C236B10C7F276A, 0x2407B9259, 0x6CB46F61E5467CF8, 0xFA3CA00529CCC85F, 
-0xA1978CC674988E07, 0x767C293A216F37B5, 0xC618EB9C536EEC52, 0xDFDE92204AA2C703, 
-0x633BFD7658F8CF4B, 0x1B0743DF1A2C5B89, 0x18114F3CE2F5041A, 0xF7FCB9F4, 
-0x3DBAD3492C091EA2, 0x4488B5F1C5FC3152, 0x6E973856FB4F0945, 0x4BF6F57E8E4D5709, 
-0xB312264D9148871B, 0xCD838D6375A0E52B, 0x1A66C3514602A2F3, 0xB24F1FA60F596425, 
-0x6BD10A77AC785EC7, 0x268AB804F, 0x283E8F58C40643EA, 0x448085D94991D27D, 
-0xB0890AA7A82CE3AD, 0x17B37AC7DB148730, 0x9FAB7D497E8E0B07, 0x2044135E45D82EF0, 
-0xB361023467022D56, 0x51FDD636186E0E08, 0xD47E000968987AE6, 0x2907EB82, 
-0x90EC594C73F89FBB, 0xEA8456D2ABD41EEA, 0x8099CA1B945B3B7C, 0xE474C49C47E34E65, 
-0x8A698605D028F71B, 0x40C338CE0482AD04, 0xC4F02379D8B6AB12, 0xB49A755033CE3D86, 
-0x5D375D8230747410, 0x25BE191BD, 0xC86E955F036755A0, 0x7896D17D7FE35A8, 
-0x61E197C059C5D51, 0x5F89538C88AA9226, 0x6CDF9044A6C68FE2, 0xEB34F4291D14212, 
-0xF4E40A4F2ACB224E, 0x8D53030AC462086, 0xB3BAF90E57039974, 0x627840F3, 
-0x7C9E5A5C1C4B5FC6, 0xF04879228C7E9058, 0x91973BBDC2CC5A39, 0xA1955EC8CA629D1C, 
-0x6D075C665E18D5AC, 0x6D373CEC535275B6, 0x54F2BF3B6B9AE790, 0xB8A147F04220C609, 
-0xA39AA46EB8227920, 0x16FB83936, 0xF24F3C4DD9B95786, 0xF8FB3B77572B42A8, 
-0x99EF190C04AD5917, 0x3A91875419C2EC47, 0xB1267570BCDA65F9, 0xA749907D452190EA, 
-0x5148D188E655BC89, 0x85A37817D272F825, 0x93F3D1CA0929D466, 0x1BF1043B0, 
-0xB69CCCDF69C8EFB4, 0x3B1A6D865074C537, 0x35BC24A2D15C67F8, 0x1C95A21CB171A24F, 
-0xC152B1487C93C3D4, 0xAA92C8628EDDBBED, 0x2CC42C87A2163B48, 0xD606C4B4F078EAA6, 
-0x9F3EE7887E3F8A09, 0x21D2D8EF7, 0xB6951F0AFF6E9C8A, 0xB6E3E7C396A7134E, 
-0x2AB7942FF251772B, 0xF5835E96B9872EF9, 0x1AD025DEB341813E, 0x8CEDFB89084EE22B, 
-0xFE81407D648C38FE, 0xB6B8D0AB90E2B13A, 0xB8949CDFC87C6897, 0xC89734BD, 
-0x5AE7946FBABA3544, 0xA11322876430879D, 0xB975E8D5CE24F019, 0x8748C493CE2389D2, 
-0xA12AC411CA829A6, 0xCD5BD531393C1704, 0xD9F76C6F6FE2E1A8, 0xE61013662639FC46, 
-0x8544D63010558F44, 0x5602E7AE, 0x1C5A7DC292421E25, 0x1FD9CA5638A8A137, 
-0xEC6CBF2E5AEA1041, 0xA50E3B509D8C99F9, 0xF8EF0A63E62058D3, 0x2320E562968F7DA6, 
-0x597FAA00B7A9F06D, 0x52703D06D0FB2F2A, 0x278430FDDF9E7818, 0x169942A9D, 
-0x7172392D1346C593, 0x14BA9DC124A6ACC9, 0xFAB7E7914C7C580B, 0xCF2FE819430D4D8D, 
-0xB8C786750496BF7E, 0x121113DFC9A9126B, 0x7AD4189F4278213F, 0x1D8B043EF222BCFE, 
-0x511A5C4BFC93D238, 0x27B077424, 0x15F0B99C978201C6, 0xC63AA0A216E3D102, 
-0x843E050E53ED872D, 0xEE6DD9F3F74BAD6F, 0xE5F0757A8F60E98C, 0xC30BFD2E414E50CA, 
-0x279EA8586246C44E, 0xB9F1A28E0B54CBAD, 0xB48A54494A06A8FD, 0xE1BBBAFF, 
-0xA28E7523865C5E3A, 0x657E94281D5518D8, 0x33E7E9C2D4FA542B, 0xB76EE1CA36269F68, 
-0xBA3D325188D0A07C, 0x8B1FC5D601CB5F94, 0xD34780A33D0CBB73, 0xD30E5A704141C020, 
-0x13AE0CA2B4CBCF18, 0x17FC6A2E5, 0xAD354A8F4D7FCF07, 0xDA0FBF1AFCE6F33, 
-0x57E65C83CADB9713, 0xBB435EBD38182AB2, 0x2E5E28F259D0A2BC, 0x1911A2DFB6703FC4, 
-0xA26D2B2258CC0EF2, 0x889F90DCE9975A80, 0xA03668D086D63C72, 0x14A34CAD2, 
-0x5BE38DAC6EC86AE6, 0x98A0DF1D74F9510F, 0xC3A27682710133F3, 0xEE03F24A974F9585, 
-0xD54F2F74FD922590, 0xA29326F7F9D36115, 0x6C372C2CE72F0751, 0xD04D4BD21C8F821A, 
-0xC61363DDE9B3A2AD, 0x2758818DD, 0xD1D024764CF6109E, 0x73633005A1FB2007, 
-0x2645547768762587, 0xD774F2204A4D16D1, 0xAAC82D31DB56A219, 0xA5FC50555C9CC7CE, 
-0xAA7E5F13FEB28690, 0x845F392BEF3C1E48, 0x4DF9C0711E496533, 0x823D2C91, 
-0xB105973D52B3BDB1, 0xC3D2DD622689FFC6, 0x2C2F9F01D3DE85CC, 0x84D04F2F53E24E46, 
-0xC461155B2BA95894, 0xF38268A17D1C66F0, 0x3763D7A5E5419D90, 0xF9BE2DF830D25DF8, 
-0x564524149C23C8E3, 0x16CA4FC50, 0x7AEB1CFFFF7382E6, 0xF9971EAC9F586EEC, 
-0xF65B798952212CAA, 0xED905C89EFF1B7CA, 0x4873CAC8F140A757, 0x9E3DA2655E865B61, 
-0x5BC949A4F3C6D319, 0xF2797097054D7138, 0xA7A66632E58293F7, 0x1CA83EFA9, 
-0x4EFC63F1AC19F2F9, 0x15BAA7EE92CDEA4, 0xFB7E1C082742F142, 0xD359E921A4044E91, 
-0x854B58E7C326612E, 0x2C01BE6F0BACA9B6, 0xDBB484C13BADE694, 0xBAB204B665B2DAC5, 
-0x4ADDE78D5B43A566, 0x2468C4CF2, 0x475D9E951CFD3430, 0xFB0C6E4B05DF8C73, 
-0x7FCBC485E09B0857, 0x769EAFBD79488D5A, 0xE077BE20D19FC6A, 0xC52E335F1F94DDFA, 
-0xEBF190B6B4D31285, 0xF6FEF00A22904F24, 0xD1057DB2CEA856FC, 0x21002E4D9, 
-0x55A3C0E8B9D1BD98, 0x27E1F91E50AA0E0A, 0x21C3BB9A3A296FF3, 0x62BC56B1127EA5F3, 
-0x7BC4AA0B6AEC3EBA, 0xF5508D2B221ED76E, 0x8D47E0C700446143, 0xF135D93089FC6FF6, 
-0x53A1F29DAB0567FB, 0x1A6FC64B3, 0x3A16476F3DAF4046, 0x549011D02B5D3AB9, 
-0xFEA151707DB592F9, 0x64CAAF4D4F51CEB7, 0xEB6E51DE03F5D04C, 0xCA6BE9A69276B941, 
-0x57146A0D8006090C, 0xA130130D5D1DC30A, 0xA4E8D3EFD4FEE2AA, 0x25A8988DD, 
-0x5F1906FE4BDDB02D, 0xD90675C849BD5A91, 0x2654548EC481CDC2, 0xFA2D57062FB2F91F, 
-0x49AD6CB8236A68FC, 0xF51AEC61BB313F36, 0xEDE423196D3B8739, 0x95EC805ADA0B8D51, 
-0xA23F5F5B2F850651, 0xDD7D01E, 0xC29614312151A454, 0x6B0F5A60EDAC0223, 
-0xC1E5192A76F92DC7, 0x4E7CDD29204E0AA, 0x672A69E04D5254A0, 0x790FD7B39CB9D836, 
-0x5A15FB6DCEB1763C, 0xB86927457FFFF94C, 0x7158D9EF87CF3084, 0x214E30F27, 
-0xF0E1761ABDA9FC37, 0xD8A8D3B55B34C2A9, 0xA67C30587FC23962, 0x6C97CB2A5C4A75A2, 
-0x273EDBB357AFE65A, 0xBED7DC26EEC561DC, 0x36615F228F8DE428, 0x74D063AC70C4F45D, 
-0x4EF0BEEAFCF6F620, 0x1A5E2A092, 0xAB9DECA0DFE8BBB9, 0x4E1669425A1AB9BE, 
-0x6D680D8EEA752188, 0xFFA18DC6C13DDB59, 0xA8222266A9447227, 0xF6570A2CD1A0DA99, 
-0xFFF7C77730C642C9, 0xB07AD6D65C99F687, 0x69D8A802E7191BB9, 0x23AF09CF0, 
-0x2CFD94775388FC35, 0x3389D16E9ADF97AE, 0xC2A33CD9DCA67C35, 0x3B045E19AD6D77BB, 
-0x4539353DA40C77F8, 0x5562748615FB9715, 0x5CD2D2C197F0C80A, 0xAF9BC9DBCF4400A5, 
-0x41DEC2F8C81F99AE, 0x1DABB9143, 0x46E2FF28DF2CFC2C, 0x9F63E6DCA4734573, 
-0x6B34712C2202FD04, 0xB61D68E7E5D8BA80, 0xC6C563226D8D780D, 0xA5977193E19BC3B2, 
-0xD236CF938577178F, 0x613AA5607E636FB9, 0x6D8DEFDD107F3218, 0x188473C61, 
-0xA76AA4CC4DB88B12, 0x30D0DCD12CC09053, 0x368FDFA03D875936, 0x877740F303EE34F4, 
-0x53198EB858A242CE, 0x90FADCE4D9CD247E, 0x28B4D6C7B07F9F9, 0x7FF9EB6DB14454DF, 
-0xE0035F08C648F3E8, 0x1A0DB43B1, 0xBEE7190ABB2622D5, 0xCD8B61A72EE3D825, 
-0xC04211B8B5F97A81, 0x68BC56C47DBB4BA2, 0x9B4F1638635DC8A9, 0xB9505FD4F2BADD76, 
-0x4FADCF5F2958931B, 0x9E5ACC89EFF1B6AA, 0x8A494B8A70D30215, 0x22AECF49B, 
-0xD55CAFECCF173717, 0x840BAF5B6B69A2F8, 0x2B855EA5F8DBABCD, 0x2C5D1461AC46CE0B, 
-0x53052B8739ABCEB5, 0xE609DA45CCC4EB96, 0x919167625EF3E479, 0x6984260E648478FE, 
-0xFD562BEF75C27F2B, 0xF2987133, 0xF950D33C4ABF14AA, 0xF128C533084BB53B, 
-0xBF961AFE72D09EB0, 0xA6A3694EED40A3B9, 0xC8A5C9A0D61C5ACB, 0x309380561971BFB3, 
-0x691113B10EAE2523, 0x4AC17D602C77B3E9, 0x6CD039AB54A735D4, 0x9272BBB6, 
-0xAE3D3FC7893C9352, 0x8AD49C5CADD06DDB, 0x29DD94174A777CF9, 0x27821F04CB09D8CE, 
-0x6DB8B2365D8A0356, 0xE27BE3DC47E4511F, 0x16F447278F78C765, 0xEC5D59DAE319774E, 
-0x497FD153526126E2, 0x109CF9DB9, 0x8FEF2397D3F5A0CB, 0xE6D0D10D70BE90DE, 
-0x74E9B34E69F84940, 0x4F6A4AA687EAAE8, 0x4ABDD951A6F5FCD0, 0xC50EEF53B3B4249F, 
-0x112289C8F4CCE50D, 0x518146E1A5166D71, 0xBB9FE3AE5E1C7C93, 0x1DFF0A938, 
-0x1D9058378D8E0540, 0x71093D33A4C0E521, 0x8F5A813EDA7FACB5, 0x85FC691CA5969126, 
-0x7A2E8FCA192BB768, 0xADE3FD273218FF5C, 0x5BEA690ED9DEE099, 0x3B053D58FEF41852, 
-0x51D8E316E2D1B1B5, 0x169E7223D, 0x13D6A7F09FC93A4A, 0x847096199C19E860, 
-0xBB1A4021BAC71A9D, 0xC7C2B17FEBED444B, 0x46D1804C3D99A0AB, 0xBF65D68E6FB4EC76, 
-0x4B3FCB769A9C4094, 0xDA35F0A9BED01184, 0x7E84D17B69A7FC82, 0xC0846776, 
-0x3418DA1076D51E6D, 0x54891C9856037B91, 0x3B4B7EDF701846F7, 0xC3C9F50F3BEA2374, 
-0x8230EAD9A085430F, 0xF56B79B210B8AAF7, 0x8C608A8E5102F6F8, 0xE0BDC14CAEE44427, 
-0x2504454D6DC89E17, 0x21A71B12D, 0x44536397204353FB, 0xE524B1C93CDEFF74, 
-0x917FA5DAFC5CAF9A, 0x328926C56D5B6156, 0xBBBCFDF366FC549, 0x505D8E836AF1CD51, 
-0xDA5515DC5EED67AF, 0x9435F07665775E5C, 0x636C9F199D012F3C, 0x4C08B1AE, 
-0x8C4CFD3D7E47F85, 0xD04CC5F051014A02, 0xC3538FD61A9DE601, 0xB713F695D861D7FB, 
-0x372286EC34B8CD89, 0xEE47511D7D24B93F, 0x26AB258CC404A2B7, 0x17A065807121D07A, 
-0x722518089415031E, 0x147257506, 0x29113C0075327BC7, 0xE9480DF66386BB46, 
-0x236A95943455A7EF, 0xE16D8F8508C9FD39, 0xF4C490D75BD8AC7F, 0xE9566FDD20406356, 
-0x8C008201439E2DC0, 0x4E15889914234E59, 0x8CC209EF1587ED57, 0x1CF9C6C0A, 
-0xA7E499E469D60717, 0xBEEC9EC46D837B27, 0x3DC66A4B8151D7CB, 0x8ADE2BB0E56F70D, 
-0xB2252A65C22B36C7, 0xE5D71DD78B21B361, 0xD7C4F358104A3C54, 0x7D56137BBEFCF57, 
-0xE78792011F223EFD, 0x8C37B5A1, 0x6054600304EB0FCC, 0x6C7D149E05BB3DA1, 
-0x4BB5A493CD531C92, 0x2959D69308986EA3, 0x1B8C121751BC63BF, 0xAC5B488EB0768A87, 
-0xC5EE5CDE90CA3753, 0xDDDFEEAA098E6A05, 0x702E1B73CB8160CE, 0x5EBF153D, 
-0xAC305B508176A913, 0xE12E73DA5ABA14F6, 0x4EDCF4D6F62E7C8C, 0x12297DFD8DA7D6CA, 
-0x5D046071055C04A3, 0xF304DADE82AB0AB6, 0x8C4718F23620357B, 0x4B3D15FC30ECC4A, 
-0x9DB59A7C2AD687E1, 0xE6E8F897, 0x2F63089D05E2B441, 0x79B9C711AEA8CA03, 
-0x18CA60630800AF79, 0x78DBF426BC9C84AE, 0xE6E3D210A7355B2D, 0x60A39B3C93C88DAA, 
-0xCEB63B882A38BF16, 0x21FF097BE86A37C, 0x615D52FC96DF6033, 0x1BFE22FE0, 
-0xEDA8BE69AF59F295, 0x494506CCDD60A65C, 0x605A71BDA98BE8BB, 0x1FB99F72F538F9D0, 
-0x4804292AF97BB64F, 0x1A35CF91C14E1093, 0x6B2AE607B9E29BE7, 0x5CC28435EAD3BC3F, 
-0xCC2B4C91C67B6BAF, 0x1BC3D2BE4, 0x1DF0AD756C11E8ED, 0xD92E40D03F130C44, 
-0xCDA850E131C965C8, 0x2C73D73E0E5476, 0x950BB2CF94BE1E00, 0x17FF20AA787037CF, 
-0x1796F9F27284F4D, 0xE1694A3DA3867E7, 0xA5FCF2582C5C395E, 0x21695305F, 
-0xDE8FC99603E23F75, 0xCE598BF3387D2B26, 0x5930E04F966433BF, 0xC0CE8CFB6161A98B, 
-0x30310A327EF7DB48, 0xE90EF53BFF532B4A, 0x2C4351D6063BCE6A, 0x482556D7A9D3EE1, 
-0xC524CE7F39E3155B, 0x1AF09AE91, 0xEC3F4C9FD67FC41E, 0x1D8BD322CD1DD92F, 
-0x86B5EA2B57A8F1D1, 0xF5831C28B79F9061, 0x776350F00E32631B, 0xC1F5213228199305, 
-0x8D08F033A2CA0F8D, 0x1142E55919165F83, 0x35A56397B1D9D9F3, 0x1842FC196, 
-0x563A8101347B6436, 0xADC9EC22785F41B3, 0xEBA9B76C2B2A43CE, 0xAF11215CF6BD6185, 
-0x1CCADE8242AD0E79, 0xB1B2918E604947EC, 0xED47AC8E7ADF4FD, 0xB4ED69B0D4E26BA7, 
-0x674608263E9C6EF1, 0x2679876EA, 0x83A369FFFCF76C3A, 0xAE3EC3AD0D26CEDE, 
-0x439261E85407E7E8, 0x72FDBF2C3AD15BCB, 0x4418A9FE1B1F1DE6, 0xDE15B6350AA519AA, 
-0xA82BC060CA9023AD, 0x2E07189C0952CA05, 0x6872C2BE7A023201, 0x3D5F4CC5, 
-0xF563EE0711487404, 0x438A5ED0A43F9352, 0x79B25EDE72955585, 0x80935F658281970B, 
-0x9D86812E9E9B5783, 0x8EE2F66BCDAE32C7, 0x281079E977C87790, 0x605B7ABCB88FA932, 
-0x1BBCFA22879AA38B, 0x2616DFAD, 0x25DD3D1863519D6C, 0x87F9200B1BA7F477, 
-0x9AF585F3A3BB9AC9, 0xAB845F15F9FDC41, 0xA92B4F334B2960C6, 0xC26CD8ADD34829FC, 
-0xEC7DFEE16A854BF2, 0x4024CD8472E5AC09, 0x8C332FC7CC944363, 0x47627CD5, 
-0xE8A154744871D0F7, 0x10D91906C55BDB7, 0xE70C3046AE8E019D, 0xA74820BF00D70BB3, 
-0xB1466999183659B6, 0xA768739BBFBABE86, 0x4132AAA7BF924A3D, 0x5D9D8C13F1CF2209, 
-0x167C0D376178588A, 0x140248498, 0x1C7CADA40C16CA2A, 0x83BF4A1E284E16ED, 
-0xA22CAB0F106390EE, 0x141A21338CBF8C88, 0x80E18604D67CC684, 0x52FD5A3FE2F8EC3, 
-0xDF844E4654A23113, 0xB0D29DC4259DCEA, 0x10B3ED68DD723B7F, 0x12A10CE50, 
-0xC5429E85CB798A02, 0x81334ABDFB22AD64, 0xE7671EEF91AE62A7, 0x23681684C65E9ED6, 
-0x730BF6F34E9011AE, 0x2E7BF95789026952, 0x41F202D469673FD4, 0x6A91F6353C135FCC, 
-0x3A9E7AB8276840DB, 0x123CA6E18, 0x33A772554D3C416C, 0xD2D14190F2522E8E, 
-0x739131E07DB4D9F9, 0x4D1FB412EF591D23, 0x68B16A89C38CFBBF, 0x101D572358A49D60, 
-0xCC0C4B4352E17DAE, 0x7CD3E070E270A5AD, 0x98B92EDB07A987A0, 0x268F9BEB5, 
-0x79C215EABC7F1D43, 0xF0C5285AF86870AE, 0xEF50993C43AF005B, 0xA2159C7DB9742FA9, 
-0x808558CDE8725A62, 0xBC256292C16D2DC4, 0x33487F8A56B86DD9, 0xD70EAA278B069528, 
-0x69285CCE26D9DFB0, 0x138ACA774, 0xC612255B2CC131B9, 0x529906C22ACD41CC, 
-0x9393104F9B119BA3, 0xF9A14EDFF330BA38, 0x68E75800E91234EA, 0xCE1342F0DE14210E, 
-0xBC2A3D3995AE5961, 0xC77CC1EEF45FDC1E, 0x31E28F16C2DE54EF, 0x19C45B093, 
-0xC77C6F015E555736, 0xCF8FEE31BA74CD05, 0x5BDD117BC31C37AF, 0xB54845DF47FE341E, 
-0x91141AB80176F6E3, 0xEDC9CA76D0EB0DF3, 0xD05886F7E2377891, 0xC07F54323B0CC9FC, 
-0xFEE7239719137A26, 0x221DB4B6F, 0x40917DF9A4D74B93, 0xAD5643961BA4A615, 
-0x2C4637BD2768BDD4, 0x2C0C5881D0D9942, 0x2EB39D5F2ECE2A73, 0xF9379DB6DE0D55F7, 
-0xE53CF951BA95CBFF, 0xAFC95CD8E752B9BC, 0x48155A7DFFE81EEF, 0x120CF2F10, 
-0x9A690CD29AA0326B, 0x556BAD26AABCA886, 0x74E8D9AC84701E9B, 0x926EAC39FBD8F6D7, 
-0x1821B2A27655C8EB, 0x7F2E9EAB11C5A553, 0xE38F932EA8A14A1B, 0x19CEF9CA9B0C6270, 
-0x26478C21648C5385, 0x24D054F27, 0xC5EC3D418AA8929A, 0x9EC1FC14FDAE248, 
-0x4AB7178950646397, 0xB99A6035D6DFF938, 0xB712D94587D7C107, 0x4A555F1217144198, 
-0x8689BAC05737BCDF, 0x614642C57274B070, 0x2F7D4F0DCFB71980, 0x1BB1013CF, 
-0x94BB65AD1DB51755, 0x7C3028717EEFE58F, 0x8B8857A874D5FC32, 0x326831E01E40C5B0, 
-0xF39FD09EAF76D75, 0xBAC188E7D3059B2D, 0x93C0DF168DEE9D28, 0xA3FAC48FBA2587F3, 
-0xAFCF2463A6097666, 0xA8620A02, 0x8A5C1D69DF6256C7, 0xEB058E56E40035A, 
-0xCFBD62E5A46A52FE, 0x7B3D28D364498D2F, 0xB3B92035F91787B, 0xFC8D38B469553B84, 
-0x8135EFDAD112A4CD, 0xDA1A7C6D6E6C063, 0x8EEB2EBC300C3912, 0x578F2B1C, 
-0x55A0E2DA4BF16C30, 0xA8F25ABDAFF619CF, 0x188EF0F1DF098C37, 0xB64621A3CC53C82D, 
-0xFCBACF8D7ED51D03, 0xC76EB5B518469C8D, 0xE1108E622CB76914, 0x2D1A20B5AF5CE7E1, 
-0xFB8251F7A7548640, 0x22C69997F, 0xDB581A3A2A87EE74, 0x2CCAF4EC6551EEA0, 
-0xCAA6BF8029E09C81, 0x5238CAC433EF1FCF, 0x4F4A4A4A462A09F0, 0x5161691559AC83AA, 
-0x99B1AB005ED19AE8, 0x6036DD84D5DC9108, 0x46CA63893AEC9277, 0x26653444B, 
-0xFA90B898386F410D, 0x80B4103712C505FA, 0x4895A592805C9A56, 0xEF0D6AA391028551, 
-0x83B01ECE97B629CE, 0xCF1469561FF8B27A, 0xBB3ED1A2BE69E6E9, 0xADA4C55F72B5418C, 
-0xC229704B55CF3330, 0x1DDB43A34, 0xF19DA3FFBD32B246, 0xB0DA142457EE3CC4, 
-0xA7F59FAFD35C2115, 0xA14B459FE152B32, 0x323A9D0A15C10196, 0xCE75E21A5AC2F655, 
-0x8EB294CEA60D9E43, 0xFEB0A3FC6F95D036, 0xA9BC70985AE34783, 0x37FFD12E, 
-0xCB95E6AF4F306C6E, 0xDFA3C434B639D79C, 0x29F1FB53E85DEE47, 0xAA6986262430C115, 
-0xD1C12EB79FDAF466, 0x56BC7C217F9927AF, 0xD0979BDF8CF72EE1, 0x9C7067A06E807C39, 
-0xEE82933635012622, 0x26D63591E, 0x3B279E9C48B7DB69, 0x905B5D1215A92805, 
-0x33252923127C686B, 0x2ED55E92A6AA2866, 0xC07C523D7450C11F, 0x18CDBDD68242630E, 
-0x3EF22BC254EAF22A, 0x881DBDD43AFB98E3, 0x824762194C30786A, 0xC7ABB85B, 
-0x268C109FFEFF4AEC, 0xC2163C626F140424, 0xD80B36519B44F2A2, 0x1E182796D97B06F0, 
-0xFE069954FD8F2990, 0x44EF7B5E3AF66CDD, 0xD94F0268C4355B38, 0xA8668A3AC44C6D18, 
-0x383042C39AB138A1, 0x10237C1D8, 0x418A3C3E721C6653, 0xD485B8AF16F2A7D8, 
-0x1578D9C6863BAF65, 0x4AAB5BEE8EBCCEDE, 0xD6F0037983B7252D, 0x134DE302D3C70C81, 
-0xAA615CB5411F838D, 0x53C4C8E9B4D3F810, 0xD1388CF30B799618, 0x11734E756, 
-0xC70C919093107CC6, 0x845B682C90923F91, 0xED0EBDAF29FF3623, 0x160D7FCB2F98C63, 
-0x42F2477C37B4E4F3, 0x68B2A755E865033, 0x36D6B07E976F2F3C, 0x78566416D77635A9, 
-0xE3BFA9CA39051DF4, 0x1D6AE0964, 0xAE3BC337B7700074, 0xE2BAEB979A20BE2E, 
-0xDF6B744C9921C96, 0x62177BA97CE0F2DB, 0x9399041A7D167AD8, 0x36B8E3F883442CBB, 
-0xBA4FC598019BA4A3, 0xB8C1638B5F35404F, 0xDE7B496C8DEEC5B0, 0x6C6189DA, 
-0x270A420BBFF343F0, 0xF7AC357CE2F26E15, 0x3ABE6551C50E0FE3, 0x41C33F8D146250CE, 
-0xBFD2A149842E865D, 0x4A3A552296C98D33, 0xA0B5EC255E0439D4, 0xB9EAEFAD3AC27E4B, 
-0x283F88D73C9FC2B2, 0x1F5803204, 0x46F0E800BB80FD32, 0xF497F4E56D4938B7, 
-0x9DBA9AB94DD56037, 0x179DE2825A07A627, 0x16D83B8B94BDAE7C, 0x46C82F6833EE72CB, 
-0x910ACE8C00F53FD7, 0xADC2CF93CAF30D44, 0x87832578FD5A2212, 0x1EFBF19CA, 
-0xBD983A811910073, 0x50651F3DAF78CF43, 0x66CE1DC4FA5A0596, 0x5F9AEDF3A6CFA1F, 
-0xD3D454C209C45AE3, 0x11D36EA92187CCC1, 0xB147608C221674CA, 0x9FE5DF9D817D3CDE, 
-0x5E121C6ED88E8F33, 0xB86E673F, 0x77B0AC2F033BA151, 0xD8F13B51A316D431, 
-0x6C843252A178D43C, 0x4C92F4153F1073FE, 0x3DDD2A6CB5422D2D, 0x637424B7D63C4800, 
-0x542E69B352B89127, 0x884EA4FA455CAEC7, 0xBC872BF04FC218CC, 0x138BC003C, 
-0x4CDA897BD257A697, 0xF8327DAFAD437F32, 0xBD0FC317053277A, 0x53B052193180B3F7, 
-0x4E1B14101A099BAE, 0xB149CBA7724AB6EC, 0xB7F55B71F49DF0B2, 0x6EB5869CE2CA05C1, 
-0xD4E334B2D0A11B25, 0x26560C426, 0x8BC5F6C1521B86AC, 0x7D209D4196F419E0, 
-0xCFC52CC91CBAD276, 0xA2FF7836BA0FCF3D, 0xA7CB181E7E961CD2, 0x914F406241C63D24, 
-0xDD6CA6D41BBA44A7, 0x5C16F540EB213E21, 0xC06ABDAB14429CA2, 0x257028AFC, 
-0xEEF4436443EA3DBD, 0xA0BE66B18FAB246C, 0xEC415E8BE7FEB54D, 0xC27C7D3C7CBCAE76, 
-0x4F5D34346539A3AE, 0x58AE67FCAA2C3EA1, 0x4673916BA56F6E2F, 0x1BF1896BA65BF1E7, 
-0xBF256A848CC86C07, 0x22BD068B, 0x8E61A70C6BF814D0, 0xF1A643E8299280AB, 
-0x9E445258622FF2F8, 0x3CC12E411F73D9C4, 0x2EC7D16097B8FAE9, 0x6E92634074440E5C, 
-0xD727E57A1F819F06, 0x42B4A6F742E8C1D7, 0x36050FF9F4F1FCB8, 0xA40F8ECA, 
-0x756FD40768C6484C, 0x178FD721051C5B9C, 0xFBE10BFDA0970E9A, 0xDCCDE995C540AA9, 
-0x98E2C2B407F29C72, 0xD8E3EF6DB8EDD708, 0x1EDDAA9F653D6FBB, 0x8A7FEC8D463050A4, 
-0xA8492DD1743179C, 0xF4C42C37, 0xA66355D7FA89DDD0, 0x640D88686A2DE13, 
-0xEA7F9BED71063108, 0x579AE69C7DB314A6, 0xB77A6AB4BA185CFA, 0xA5CA3A9D84CCFDF6, 
-0x1AA45BCECA50731E, 0xC388010C5B517F83, 0x83DC44250402693D, 0x6265BF65, 
-0x1EADFE8DFE777948, 0x3E449AE9005B8107, 0x1F6AB66731373822, 0xE4F421EA32868423, 
-0x6794A47BAA3B8928, 0xE7303CB93A544C5E, 0xB8116052313B9722, 0x983E65069A572055, 
-0x46E7F85BE683BB7E, 0x107F85CC1, 0x8254AC1996B93F63, 0x93FF7ECEABA1E4E1, 
-0x877DA3E884DDAB64, 0x7367485533E4B51E, 0xF02B28DAF317A609, 0xCE78A2B74E2CCF0B, 
-0x374AF6CDBFB322CC, 0x805FFCE525A67802, 0x495409014AF35BDE, 0x15255E9B1, 
-0xA8BC2F9EB280BBC8, 0xC7784D85534A5649, 0xF8A686E6F9E75A36, 0xF5A69EF455D5858C, 
-0x892057AB28831AEC, 0xF375B2E0A33A81D8, 0xDEB03FBB03A19A66, 0xC318F4FD7E553F49, 
-0x1285A241C1BE4CA5, 0x37DE43F5, 0x8C847D46EAC792CF, 0xA43682C53056339, 
-0x959C17EBBFB2B864, 0x16B9BC1EECD7B8BB, 0x9F249A1A5102FC5C, 0x9C6FDACAE5C5B8C1, 
-0x8ED910345CB8A6C8, 0x290CB048F6AE97C3, 0xF9BD66CF104A4AB2, 0x623FCEBA, 
-0x48124D6C3C1E1458, 0x1AEB00460AAFA7B8, 0x3A0328596BB905AB, 0xDD46A60A15A09E00, 
-0x2BF3F74E2B69C089, 0x183B7A02446960B6, 0x41204215683FA015, 0x33D00479CEB1CF7D, 
-0xEC08E9404D42EB10, 0x1603448F1, 0x50C189EDA1DB1A45, 0xB538146A01CC60F2, 
-0xA76D7B09801BAB7A, 0x890FE1A1CBEAFA7, 0x90522A16BA57AF90, 0x3DA30E8E9D33A875, 
-0xFE7B0160B1B9F2A8, 0xCDD0C8385CC1BD48, 0xC2999FBAFEB9F339, 0x1BA3C0490, 
-0x2B51081D9F11796D, 0xF3C9750AC9B8F3E9, 0xC9605E29237D85C5, 0xF2F939A2D5B40791, 
-0xDCC9B2D1887FBF23, 0x4403796E77B6FE23, 0xF5EDB96A3C0E28FA, 0xD6635438671AC999, 
-0xEAF7B590111118C4, 0x2202DE044, 0xD6542AD3F493485F, 0x96CE8CD820DA742E, 
-0x5E33CACBFF3570EF, 0xA18B345D87DCF65C, 0x4D1BFF427C95E782, 0xA884DEA7BE9B7946, 
-0xA20F00A7C9CC7B7E, 0x12DE5392333604AD, 0x388D8B96E98D105, 0x26C4CBBBE, 
-0xA5A38F638B3D7B99, 0x42D21874D678E95F, 0x36CD9213599C8F26, 0xF99BC3CD385EB5E1, 
-0xC67609626D35E921, 0xB6CFA438A3B7AAC7, 0xDDF073B9488B6565, 0x426B898AF6A5E66, 
-0xF0ED564D82EB300, 0x18CF1F49F, 0x6B6C33391E117925, 0xB16DF292044D4E95, 
-0xCA86DCF7FF8C94F7, 0x4C89E074EE29D01B, 0xFBDCFD75F675A09D, 0xDB63B9595EA692D6, 
-0xFF230A8DBC5FF60F, 0xCE407EEB99DFD127, 0xA3F0249FFA6184D7, 0x273A8512E, 
-0x3DE71B114E86BD66, 0xD0409D8A4D6D2F8D, 0x85BD6F86D71D7D2D, 0xD0B4C93B50374F3F, 
-0xB762BA9375F99958, 0x9BA9DDE0832FB78C, 0xE62F689523953793, 0xEBBE7365997E8933, 
-0xCB3E7988A91DD06B, 0x13394A8D5, 0x1A9D2CB110277BAD, 0x2E6ED53EBF999E1F, 
-0xC96B68BEA0D5A888, 0xE72182CDD9049658, 0x6D8A86FFE406F763, 0x64DD80457F4DA85E, 
-0x1C4963BB9BA21610, 0x4ADAE87AF38A7A7D, 0x574367778D5778E0, 0x4391711C, 
-0x55EEB9742238D6C5, 0xB2F648D106DB59A9, 0x95A3200A3C2CDB10, 0xA36F4BD1027294ED, 
-0x81C4F1BB5ED8E3B1, 0x24EFFB6A14BE58F8, 0x5B1C559EAFC36FDC, 0xE0FAA0585D4F511F, 
-0xE42D85FCA32D28AE, 0xE0E1C2E4, 0x3CC3090CA1B5912A, 0xA123956BB186E0DD, 
-0x360FFD43920588DD, 0xD020618A4FDAAF17, 0xADB011B49D026F03, 0x2CA60CC90010D160, 
-0x30BC855429C8E70D, 0x49AA2FFAB370D5D1, 0x919D96FE339B93A2, 0x22CCCFBC3, 
-0xA824ECB9216D4941, 0x3988F50726FD5A50, 0xCF96B24D4E34E67E, 0x918B1EDAB2B4EDD8, 
-0x8D8BBEFAFEB2BB1B, 0xE208935826E8F920, 0xF6CB438D2073F58F, 0xA96680D60C5AABE6, 
-0x331BB5745E5EB343, 0x179484AD8, 0x9BF8B6BA4D7BFFA7, 0x2BC98AA05B03EF8B, 
-0x7A3EA9C2719EDAFE, 0x4E3B9823B2EB7830, 0xDADD3413F6294728, 0xCAFCAC73B6F9C839, 
-0xC6302A9D5E1214F3, 0x4919FC18CA0795E7, 0xE95C3633807F0E34, 0x8D7A21DE, 
-0x7B91E9DEB75217D0, 0xFC3C0BB405C9D7C0, 0xC91DF6A4F342B90F, 0xFEA250197CD2C666, 
-0x59F33C6ADE34C1F4, 0x8D83D6017B52620B, 0x10DD1CD014744FD7, 0x1A403C6BBB332368, 
-0x7E687591AC02C175, 0x25EF936BF, 0xD3B90F52D2FF5CAF, 0xF38CE57B062BC618, 
-0x685448899BEBDFF3, 0xE65A53CFD39E05E8, 0x7DCDFB731D06A0B3, 0xDBF934D6D4ED4C7B, 
-0x3CB5B91F693F753E, 0x9F34179B5294E62D, 0xCB798668B1188811, 0x8CD73FA5, 
-0xC3156A6D96BF0E3B, 0x8AF329C47044360A, 0x73C993F55A56ABD3, 0xE8CCD4B56751D293, 
-0xA59697ACC8FCB5F, 0x54E17F89C1942EDC, 0xA73D0EEEB4A2E216, 0xCF32D3A7B0B9699, 
-0x9E65CA3530F641CC, 0xDE786848, 0xDF562EF882B87802, 0x7F82520D1B42C5C5, 
-0x25F2DBAC10F9D6F1, 0x12013F4255180242, 0xBFF13F6EC34EA997, 0xBA41FB7544727F13, 
-0xA80E96FA875C8A76, 0xAD21C040F432B6F5, 0x2EC13E99E4FB32A5, 0x1D8FFDB10, 
-0x5C27C1204B7E48D4, 0x5015FC6393046638, 0xE389675BBF43B883, 0x18B742A026292704, 
-0xF208DEE8BD0D68DD, 0x2393BC18653DEAFB, 0x228E65EE800AE9B0, 0x4A0CC03AB44173A9, 
-0x853C563E7A0464D, 0x2CD65499, 0x63AC065D1787C2CD, 0x8A3BCC717BABCEFF, 
-0x795DE65654E9909F, 0xCCE0FD5645A7CD56, 0xCAD021722C057FB0, 0xD2176B2DC558321E, 
-0x83A7BF7808E590B9, 0x69E444B310516787, 0x4B39CE75EEBB828D, 0x65A9B1CA, 
-0x9D68ED73C97D328F, 0x2B6FD75ABD77C960, 0x7BB0494989F680CB, 0x3E8852528A8990A9, 
-0x7FCBCE20047055C3, 0x62E6E2C1AD3C93BC, 0xF7D5B232F0C949B7, 0xBDC170B3ACBE3864, 
-0x141E6ED8012AF651, 0x25A14868A, 0xBDC658F45AA4CA9F, 0x8C76294AAF41E730, 
-0x3EB59AE038323FA2, 0xEFFC1D33D9DF289C, 0x8EF48BEFAD1B73B0, 0x9C17489B98890A20, 
-0x38B7F7DE4E8F90EE, 0x5F9445658173DCE2, 0xD5DC756FE0E0D8D7, 0xA8C35DE8, 
-0x6E10A5E0AEED6D3A, 0xB89BA5C00B5DF1C8, 0x6AE02335034DA55A, 0x3D004CDD19F38300, 
-0x62F686DD053CD605, 0xD81BB5E27DB285DD, 0xD0BB415097B28871, 0xB9E69A337BB028E8, 
-0x837F46CECF75934D, 0x5331A74A, 0xCCEF8346F9E3EC81, 0xFF6107070EEE0CBC, 
-0x49DF707F5827A837, 0xD72850936437CCB5, 0x29F3D5C47372C7D6, 0x96A4F0D9E8440A3, 
-0x56EF58C057F88695, 0x1C62946CDB555170, 0xAA4C4527EA36CBEB, 0x6FE3166B, 
-0x7EAFB0E0DC162B, 0x607F355F84EF98C1, 0x86F069346E4D5B79, 0x3E091DF2D2A41C80, 
-0x3F624584AE1AA74B, 0x485AF14ED7B3607B, 0x9108FEACC451B054, 0xFDEDFC247E3D55F6, 
-0xC66B8C77B9FBAB24, 0xBA3C3B87, 0x711C7689EEB09EFB, 0x5BF6B9E517833C2F, 
-0x3215AEF1054BD737, 0xB3D941D285715673, 0x62CD8841E1FAC073, 0x20B462EF264A0BAB, 
-0x9FF05834FB18A14D, 0x9D44CA4A0C795537, 0xA0804C0CF0F59D4C, 0xAA496CB8, 
-0x2B8FF4FF89F7193B, 0x59F9643A5EE58D19, 0xFA6F2290A24890F3, 0x11155C5219842F4F, 
-0x2B9F1DB32F74465B, 0xD01B546022CD9BCA, 0x84A149766EBAF56, 0x49EF5BCAFCD2A45, 
-0xC745F59FB96A4898, 0x17FA1F7E0, 0x23FDBFE7ABE5471E, 0xAA045AE8BCFCDD62, 
-0xC6FC5FC9F90F7DFA, 0x4A33EE115BA04B5, 0x4E4E5A39F17449E7, 0x4DAB45BE12A37986, 
-0xD95CF1116D1FE3B, 0xF378F1CEB875D546, 0x727FC4633945294F, 0x1E92AA7F3, 
-0x10528BDA9972C897, 0x6B6C55660D0A2BE3, 0x2ECB24EE9F6C7EF9, 0xE52C362522DB8E9F, 
-0x36B8922AB941EED4, 0xB2ED710461583754, 0x48FBCBFD9B707114, 0xBF214D4A18EDBDE4, 
-0x457D79B64D2634D0, 0x561A9542, 0x83B4B377854C20E2, 0x26E1D0052BD71244, 
-0x833A89993642AC1A, 0x5A719DBC4478D3EF, 0x22ED31CB9E9DBA7A, 0x84D5953F378C8AFC, 
-0x5392A1369577A369, 0x14B71F7BDBD5F96, 0x59489C5A869B9183, 0xB396E6E, 
-0x818EE25A6742DB0, 0xD990F03149B0B02B, 0xA8952B1D459ACC7E, 0x81254A26AB588890, 
-0x1F6E4DD61150AD08, 0x56D4215E6FFD930B, 0x677A73DE7198634F, 0x9902914C44937896, 
-0x97132FDEB744B8EF, 0x13801A610, 0xD9FD89297D2CAC44, 0xD49B69762A97E88A, 
-0x14C8811B0568BEEA, 0xD533D806603AB3D8, 0x5666A2273CAF3A8, 0xDD2EA058A404303D, 
-0xDB7EE5727F77DEA2, 0xCE2EF00CC8BE0C29, 0xA5AFD22363B08211, 0x16A7809FD, 
-0x172C8CC034570270, 0x6BDF1C5417F0FE04, 0xD3E10AF409A1E40F, 0xCEFFCEA50F4EBF1B, 
-0xAC0C4931EAC39EDD, 0x589AB5C4D8F39E4D, 0xDE581833571780C1, 0xBA45734DF62D8BEA, 
-0x9A046624CB85F698, 0x1317751BC, 0x26FE43F1D204D89B, 0xFC8F0770774583E, 
-0xB276E127FA05B54E, 0xC067B0D6F137AE54, 0x52E2D6F843A76BF5, 0x3969BB82970BA995, 
-0xC05CF8A728C53A1, 0xA6128EBB5D092EF8, 0x190FB7D022CBF010, 0x17A731199, 
-0x7AF60D1AF8971554, 0x455E26B4C0D3D9C2, 0x4ECEB517E9DF4EF0, 0x2413031307476BC5, 
-0xD0F173E5677A1F98, 0x801614B5699AB298, 0x28D4659A6A4D4819, 0x9C9F956F8279D530, 
-0x985B6ECE3F180714, 0x1F7CDEFD7, 0xC17028B0FA91A90C, 0xF573A6E8C8FCB41, 
-0x2C1DEB43DE702FF3, 0xEA8E6DC6E380BB6F, 0x137240DA705DD905, 0x3C91ADD4D279B200, 
-0x4D40CF513D5291EA, 0x39684A0D8DED7DCF, 0x5A3423C53AF5F395, 0x3E4BA6A2, 
-0xACC488A8D18346C9, 0x576B7FD9A22B18CD, 0x8482F58E4BF6ED48, 0x2A80B5D96FD74813, 
-0xD4DD23D174535B03, 0x4DEDCE831EA1C477, 0x76A98770DF75EEC4, 0x87A988DBEEA5ADE8, 
-0x920E4A817B93D5B9, 0x133989E45, 0x8E335DF1BECC1415, 0xC686ADB45A79B99E, 
-0xB8BFC198AB936EDA, 0x4479860CD49131E, 0x316A255A385CE00C, 0x7B5A9C9060761C90, 
-0x4DC75DE750511E76, 0xF093C0AD4B88A353, 0xBC4E5F2C64056E32, 0x98B10B7, 
-0xB69FB952934E5E7C, 0xE2699A695789A3BD, 0x9131121537851C40, 0x4CB14D5BABD12693, 
-0x3CC9813DC82CB7C2, 0xBDE8BCF2416ED055, 0xFE67EC26B199631A, 0x47FD55BE0A746E2, 
-0x9351378D6EE7B076, 0x18D129A59, 0xBF8228B3814F9F01, 0xCC946884DADF8BD, 
-0x90F1E88BE2C0F891, 0x334DDB2BD010E4C3, 0x1E1AD4AC5D3562E, 0x38E1E21BC49E306A, 
-0xEA32BC401D2B0FB1, 0xE96EC8B1AAFE4914, 0xBDFD0C92AB5CD8B4, 0x19616F2EF, 
-0xE2CBFAA4C50998A6, 0x6EC71EB53A7E306A, 0x46F349F107244EFC, 0x42ED6B4B940F7552, 
-0x723C0E464C8DCB30, 0xD29AD88902BC7899, 0x4D219CA2C585E704, 0x45942D5194CE21A2, 
-0x7B6F1074DADAEBDB, 0x4EB351E7, 0x470A166CB9592235, 0xBE1A010126496B25, 
-0x58EFF3221389623B, 0x50A4635B6A1743E4, 0x2881A4106E644611, 0xD5ED51AF46103562, 
-0x3C42877EC6B6AF4C, 0x9217D2E6CF538842, 0xD922E94E11643328, 0x261FDD744, 
-0x14E4295DBEFA8B5C, 0x24DD93AF3218ACB0, 0x60DD02BCB0D1A940, 0x32686F5EC89F15E6, 
-0xF3F0927028582AB5, 0x22BA0D7124AA0DA, 0x96CD00BA66CE5677, 0x8CE4688449FC9935, 
-0xE3937D957F80A765, 0x278FC0F3F, 0x92AD78AF298EC803, 0xAD9AA706C0043934, 
-0xB1FFD460450BBAA9, 0xD6C29CBBA2658722, 0x6229A4123F2E7A7F, 0x1BAE830884D549C, 
-0x8B55C000A77B2DCE, 0x6324C9048AE9CE85, 0xA0255F19AFF3D781, 0x123E32096, 
-0x18B46F8132A755A3, 0xB46B06F3D9C28361, 0xFC8E7A971C5D1D61, 0x2963B3F86DEE1A4F, 
-0x848C2684874014C9, 0xCFAE8B90730AE082, 0x409DAFAAF9FC202, 0x14979D85CED449E, 
-0xC7C1020B3569AB60, 0x17B5BD073, 0xC6467ACB64EB6F4, 0x5FCFC04EB8D8F0AB, 
-0xA2C5EE49C858E91E, 0xCEDEFF280791300, 0xBD2021D2EBF46845, 0xE2FC00919E36B8E5, 
-0xD0855B0C04B0DEEC, 0xB6A4F9F8C66711DA, 0xC3881920F9B7EA63, 0x2259AAB18, 
-0x6BA2A865D9D4F63E, 0xF5291A92E7D78C31, 0x9714D0453FC3CC4E, 0x2788AFC2AC2372CD, 
-0x2F996C93B87E61CB, 0xDA631209374951EA, 0x79E4EE9D32B078C5, 0xA5CF7E829B90F932, 
-0x30644A922427B8F2, 0x5B029D90, 0xB2D5A734DAB45EB7, 0xFA8EF321255654C6, 
-0x866B5303DE720A21, 0xA752D9008855D2C, 0x1E55358F86D6A275, 0x47CF5A854DF89A1, 
-0x988EE227F1EDADDB, 0x848CD5E710F1A2BF, 0x91DE3B9EEE890BE9, 0x1D6CE0FEE, 
-0x2DDEE3B5845654C8, 0xC4F4CB216CB3AA33, 0x46DF70D62FEF103A, 0x35070466EA42D0D7, 
-0x6289BFAFB1C27707, 0xC3CBF6298E163F54, 0x5FDCA295D5F3036D, 0x91CC77C8F4076EC, 
-0x187C35D8B6AF43B7, 0x22E7A1425, 0x8FA9D35D63C453B8, 0x9FB4CD365C6D386C, 
-0xA51FB2702FE2BB59, 0xD01273434141967F, 0x80D94C95F54227DE, 0x9E822347ABE5AB32, 
-0x806B97BDC5E83D01, 0xEE24CA67D032C049, 0xC0CA929386B03649, 0x14317B408, 
-0xA8D88DE286C2D705, 0x33F369F093481EAA, 0x20D45FCEA213623B, 0x4BBAA5BD5FB8F9C9, 
-0xC84DEF499B63F96A, 0xF80CF1E6E9B63182, 0x90836D07200AE488, 0x8481EE010ABC2441, 
-0x9A12B308B07746AE, 0x22E8AE55C, 0x76ADAE38FD2CCA8, 0xD11E64BD60FF476A, 
-0x8B29D4E48871469, 0x3545ECA2B38CF642, 0xE89B0714F22E23DE, 0x2BE5AA71A724AFE, 
-0xD4957DE88BD5399C, 0x1B58B1DAA165D1A5, 0xFFD29812F28441FD, 0x23800A30E, 
-0xBF143B91B17C6251, 0x2FE6BE9956DFF297, 0x7099B6EABEEA0588, 0xD5B15FC350482F8, 
-0x37CF6DE135B7D274, 0x9EF3415BCBDAFF6D, 0xBC93C26362D7080, 0xEF5869BB79E48C8D, 
-0xB343DCB895A1B747, 0x9B4864DE, 0xB9D7C019BB7D5645, 0xB3DC06CB575C66CA, 
-0x7FB5C00172121DF8, 0xD74E3DCE73F1A1B1, 0x761FE4B65F2AEF5E, 0xDBD29C337EF8763E, 
-0x3F71C54EC444F898, 0xDBEADCB9737409F3, 0xA3147B48E2F9D97E, 0x2656824A9, 
-0xF7EBA8DAAA842697, 0x7360CC957E833407, 0x2D625ACC1531D65E, 0xFBB93263BB9B0011, 
-0xBEEF792A463EEF0A, 0x7E8748247739B267, 0xD5F2A193F84DD447, 0x1D5F4E50C1E775E9, 
-0xCB72232F44D45602, 0xC52C1883, 0xDA2ABA9E5090849C, 0x36B3E58B9EB24D24, 
-0x2F635D5FCC4FB947, 0xF94F2AB8681784CE, 0x14CAD941AE6BCB65, 0xB15B487B845D278F, 
-0x73991FA072B0A49, 0xC3EE66872EA774A5, 0x9D8752F4404E30A7, 0x108F9EDE6, 
-0x15C9178C80C3C4C4, 0x1F6F13CAAE3560C9, 0xA8BF0949191F28FD, 0x2475993C266665FD, 
-0x9DC5891C7F4383F5, 0x61289DF555AA7F9C, 0x28714504C243B33, 0x1E1B40686E5C0DE6, 
-0xE2EA3DC49369D4FA, 0x84F5AA56, 0x9340367CAEE140A3, 0xA86D80F7475FA011, 
-0x499C30C6A4AE9016, 0xC4E4C0FEA9BFB2CE, 0x39B3F2DBC70DB7E9, 0x967D9E53DFE06E90, 
-0xE1B0789550D34B47, 0xF6E6A55A81F7116F, 0xCA45342172E4CE8B, 0x200B9832C, 
-0x9122376871DE8802, 0xE5EBAA71AF977CD2, 0xD4FE479EC3A10402, 0xDFBF8FC92A186710, 
-0xE156634B05AFF959, 0xBB880A7AA06547D9, 0x83232A2CE400395B, 0x4FA2F7EB2E621EBB, 
-0x22B20A6A985263C0, 0x16C7FDE4B, 0xDCC1B9701B59AC86, 0xAC8F56FCB4483044, 
-0xE1923D77375A641B, 0x46EDF30EC651CEF7, 0xB8ADB5D9AD3A5249, 0x2C337706D2DBBFDD, 
-0xE1499BBF987FF2E0, 0xBA3DBE6DD40679D8, 0xD1C39BB2C672E643, 0xEE5F4DD9, 
-0xA3EAE6465BCFFB11, 0x696B01F2AC58EA6E, 0xBBC66A8766E7F22F, 0x524FFF18FB28F324, 
-0x311FEDF05D618C6A, 0xE4716D25E98A0CA5, 0xBDCD0D0EF1BF779B, 0x6EB076B6BBA97FD2, 
-0x562A704255F391BD, 0xEDC8EF1F, 0x4596F8BFEB651681, 0x4E1683ABC9D52E02, 
-0xC0C903AEB8D2E40F, 0x471DAED6BFCB005D, 0x866DF2374E422237, 0x4A80C9E789D7D1CC, 
-0x9602CE239A9968BE, 0x64F0864A452D3980, 0x835D22A74D376969, 0x793A47F6, 
-0x545D763CC37345F1, 0x6057F1BE66C7A84D, 0x28DAB384443128FA, 0xD9AC8157FF583184, 
-0x35B8F2A34E352CA, 0x8E07B2C7CAF82083, 0x5EA20D5679F4C87A, 0x109AB6A0A70A6AFF, 
-0x137585600EA2D87E, 0x812214B7, 0x85FCF568ABF1DC71, 0x26930D43CD40FD3F, 
-0x100E25D75C3FF986, 0xA5BDD1879560ED94, 0x43DA73FF251BE6F4, 0xC121E0BF77FBCA7A, 
-0xF702314613A2B58E, 0xABD8DE024421E543, 0x3E3105D0EA10156D, 0x24DF41077, 
-0x80883F547B74117, 0xE1529ECB3DEE5A9F, 0x5390DB29C6FD9E61, 0x4BBE62C23933C736, 
-0xD4C487D7C440801, 0x2A4270F211F544CE, 0x31587700FC41A0F1, 0xEA5F82476A1F67FD, 
-0xFF9EE6A6121302A5, 0x14DC30A15, 0x1B8D6709E6936E32, 0xF053AAEA7E822261, 
-0xB791642365B977B8, 0x1A0802619CD42084, 0x228977427120664D, 0x13353CD824183E75, 
-0x94C663653B5F943D, 0x6E24C4B09BF28EE0, 0xDADA1F71CABF683F, 0x12A8A7528, 
-0x1CE9DE640BDDD218, 0xBC5B6ABEC5AB3678, 0x465B63507BC6B65E, 0x768DF0AB398382DE, 
-0x7BFC20DD5D4E78A7, 0x4169B6ED58DF7608, 0xE4A812B399983BAE, 0x32FE09F2346992FE, 
-0xC3010C89E8656378, 0x20DFE21A3, 0x22F978EB50E231A2, 0x787C0C2611FC5824, 
-0x191568A715ACCCE8, 0x1DF2F3C26F69DD8C, 0xCD38A6F2084145E0, 0xF4F91454E869A01E, 
-0xA0B3FAB14E36A33D, 0x45B6019BEF7E8BCA, 0xA4524E94E5E8C0E, 0x8361A0CA, 
-0xB709295F0CCD3DA7, 0xEF13BDC85DE289B6, 0x7C5117BF16D0D3B0, 0x14A33B58B9CA73A7, 
-0x53F78890C11ACA1A, 0x35C953E37F508FD3, 0x5A92B3CE1F7CA6B1, 0xD7012FDC66492728, 
-0x1E5487FA54AFC7EF, 0x22EA50C43, 0x1373CD3B0534293D, 0x3E1D635A6D482305, 
-0xDA7EC92C675E3F79, 0xAFACD631EDA7CE57, 0xCCE3AE319DDF6C0A, 0xA6868DB3CEF543EF, 
-0x95903B1495818468, 0x90E28EA86610A5BE, 0x985E2B98B21CA282, 0x2360D9EF5, 
-0x387D50C868A5DEA3, 0xA5C4705F76E473F5, 0x5C2CE5AC05DDA731, 0x401475CF61AD77AF, 
-0xAAB0FA23A8E07FA2, 0xC943B631F6EF0A72, 0xD500CE97C3523A62, 0xC988E98510C40D19, 
-0xD94B755A405ECB5F, 0x113C6A4AB, 0x56432EA0A1EA11C2, 0x7DB9144FC78FB1E7, 
-0x6B50EDBA1A903CDC, 0xD91B819C97CC8F3E, 0x5F539F6AC8AAFFB7, 0x95324A30E94EA466, 
-0x10AF5BDC3F942ABA, 0xAEFCA745C47ECD2C, 0x7DA86900CD212741, 0xCF455157, 
-0x21C60629FE9C5019, 0x9C8A9C2018613484, 0x505A734BA8978ACB, 0xD7FAE766779089B1, 
-0xC9279F120688386D, 0x4491CBED4DD2D9A0, 0x2A876DA65F5B5B3B, 0x693E126D6457B421, 
-0x9D557793E1C07577, 0x2387D32C0, 0xB9948952CA7018B7, 0x53266D3B77507CB0, 
-0x5E91438A51E539FC, 0x8EE51357A9F68C31, 0xDDC2AA2FC19AB3E8, 0x5DEFF672684C1107, 
-0xF0C37231ACF8AC1C, 0x536FF9FA6E126E4E, 0x23CCED3846D9FAAE, 0x151B2659, 
-0x17A053A7F925C40, 0x6DF319FBDA0C6F67, 0x50D62429073BD6B0, 0x97632FC0A0DEB56D, 
-0xA4B94E585DEEE63, 0xA61E72F1B7FBDF7D, 0xF2AB6CED169580F, 0xC7664C0E7B711341, 
-0xE8B5AD32E63F09C0, 0xA978AD31, 0xE32D83BE47D4BDA0, 0xD67B8CBCCACB8F34, 
-0xDD49B437A9B9098E, 0x332EC4B8065C46BC, 0x6B8F15E922E72E70, 0xF30F000D936ADED8, 
-0x21519C595406679A, 0x547B959D87ED6F73, 0xA631E523B6C5A413, 0x1A2035D3B, 
-0xF2026FB11DD345AC, 0xAFB305E5485DBC0E, 0xDDB6996F08123D7D, 0x341A79C4999CB7E, 
-0xF9A799F1CC8F49F8, 0xAAA743798D68AA30, 0x1F3F87B27831542A, 0xB4848F06A3BE0B4B, 
-0x172C6D0EFE8BD932, 0xC65AC6F0, 0x90D4399B1300B5EA, 0xAB8949AB529E1A77, 
-0x59CF9EF7FC7624E4, 0x4821C80C597106BB, 0x1227A1CED0DE710E, 0xF0B7E117966B32BD, 
-0xDC20BCABE59CFD87, 0x6E1058F59321AC38, 0x2246E8BD32D9113D, 0x20A2D16DB, 
-0xDAD4CBC0E524096C, 0xC3D8D54EB15CF5E3, 0x37EFCBC05267286A, 0x57681189B02C935B, 
-0xDE4FFFC57CE1718F, 0x2EE8B2190F931BF4, 0x30347556F1FB5793, 0x2ADDD2571FB23898, 
-0x8D1B1F6FE8D24FD3, 0x14C93313E, 0x5E62E243C09608BC, 0xBBDB708271E78E76, 
-0x2F20B873C6F85F0C, 0x72E4AF09E431CCF8, 0x3260A98DA0D3BD45, 0xBC44B5D33682110C, 
-0x5C611E59B0F05717, 0x8970B0F9D29AA865, 0xB669753798A8F3B5, 0x11310ABF4, 
-0x2D07735DB2062ECE, 0xF88038196D8D4413, 0xCA35A5002E4DE925, 0x11A7864D2548CE91, 
-0x1A1F482FDA1EE7C3, 0xE18AC631C87227CD, 0xF3C1B5A241931137, 0x74F6FA1CE92389B9, 
-0x429E4AFE0D789E7, 0x11137D3B2, 0xD6FACBAC7F75CDA6, 0x8D4CF6631551A9B3, 
-0x67817FEF8D5E879F, 0x4EEB4E16F2B78DC1, 0xE7456FD7F1DFF9B6, 0xBA49E41C5F1765F2, 
-0x5280EAF2C5BE04B8, 0x5CC2029CDF79B4E3, 0x412825050201C8EE, 0x1936056A1, 
-0x4F9AD31787325437, 0xD64EC5C700417F45, 0x8D777672F1A43D07, 0x9FF22D203D94AAF0, 
-0x92A9682ABF181FFF, 0xF4576FA54A6B4639, 0xAFF6AB0EFB66F1B8, 0x86F3D57473595C4A, 
-0xDBE198A63EE2A654, 0x5323CD97, 0xE139390A49E80CDA, 0xF9F48D45612E8AD5, 
-0x9183D487EA956371, 0x1B77587793811409, 0xE7873AA2FAC3D98D, 0x5B4EFEF267EF6E73, 
-0x8011192CFE5A61BB, 0x64E315347B7243C4, 0xF30B5A455EF0927, 0x14354B0AC, 
-0x1CB4389AD2D7BF96, 0xF09A0202AD991C1F, 0x965E258218430344, 0x3B75EBF4C871761F, 
-0x8A0C124863221248, 0x93C1AFD7DC788DEF, 0xA43C3385D633136F, 0x83EA07811686267B, 
-0x56695F1E480AD981, 0xA7A32ACB, 0x4CFCD73F21082B0E, 0x2E66AB1F566F47, 
-0x55FE02C00F1C8185, 0x480BEC9730AEDD73, 0xD2DF8A8DE1EC2EE6, 0x19D3FF04AF22A1C1, 
-0x8BFDA332B35CDD06, 0x755153E90D3D1E10, 0x1388EB444DCB13A6, 0x1E1BC6D98, 
-0x9F74B79D3037C838, 0x10B9C12400314ED5, 0xDAD930CB975699FA, 0x3425AE3CA1FFCB57, 
-0xC4A5A8396D3DF8A5, 0x2FCBE72F845940AF, 0x428D04005BB6F624, 0xCBAEE509263090B2, 
-0x5DC8D4D863537829, 0x475D9D60, 0xE89DD91BB89EE00A, 0xFC382B6C9054C15A, 
-0x6BEEAA9B7FF7488F, 0xBD2ED60391BD3933, 0x1360B4D78BF746A2, 0x2040B32BF082671B, 
-0x1C536821ACF14A62, 0x430F66F74C5FE0A9, 0xD2D6C4885F1749C5, 0x21DFF0A2D, 
-0x4773402CDD365BB6, 0xBEFABD5F6E16A12D, 0x77FF51184F7F034D, 0x4AF37CEF6FB4129E, 
-0x1F63047408AEE589, 0x63AD1156D48D1F23, 0x71D7B31C41C9B4F1, 0x8DFD546F58DEB36, 
-0x730832AB67834306, 0xEE8C8141, 0x548282B806AA2010, 0x64883EAEF824CBF, 
-0x5170CAAA696A71DF, 0x6C1633096EE628B5, 0xE7147EA7F835E3CC, 0x99264F828B5185F2, 
-0x723A334E94E6BC87, 0x876A245F17F011E0, 0x1B2B39E250F83421, 0x99304DA6, 
-0x2D3E7319F39BA098, 0x4D5EB4C97335FF45, 0x60FAAD7CEA745852, 0x2F09B938E3D1019B, 
-0x73362B16CD861B66, 0x72BC4CE4FB3A5ED3, 0xAF8DC8A42B8FAD7C, 0x9DC6C109133C4302, 
-0xB90A8584BF01FD61, 0x186DEB384, 0x1689F65F209D9EBB, 0x36CD7A15C8BA3566, 
-0xC708520AC8A5E208, 0x4B02EB88C24D929A, 0x51719D0A3F46C86A, 0x4724C0C9053CD1D5, 
-0xCACD3CA997456ED2, 0xDDF32E57E6420E83, 0xD50000A2D6D3ACA2, 0x7283BD8B, 
-0x815D64799B6D4EFF, 0xE3B115FA5C4862BF, 0xC8F0BB8974D3E72B, 0x8754DB5A1F1DFBD3, 
-0xEED0819AB80F591B, 0x2FC2290E02B046E8, 0x68DBDEF3894B17AB, 0x7F632802FD404893, 
-0xA42743A8F10D7665, 0x87435920, 0x79BEEF19A705A1EA, 0x49FD185C639F61E6, 
-0x7E456EFB282BC44E, 0x57BF8987A45FA7CF, 0x32CB80D10A23E894, 0x12B37C7CCA6DC252, 
-0x8C6A35B7D476DBA2, 0x2ED580203A2D6C6A, 0xBEAA0863BB375C7, 0x10F2A196C, 
-0xD2F963AD81E7BCB6, 0x6034AF137A7A4952, 0xB5549EC9F3887CD3, 0xA6957D8A71002D6E, 
-0x50264DC8F50AF381, 0x5A7C757679A09F7E, 0xC08BD4FE3A40F754, 0xF6BAD5FA68D5BECD, 
-0x582B628D8EBA6825, 0x1C18B8A3D, 0x38DE8041D870436F, 0x743B8344721BDBF3, 
-0x4E2912A6E9D3DCBA, 0x3D25A2CE940D24E, 0xE2A5F0D2946747CD, 0x5F77DC7628A21071, 
-0xFE7796A91536B7FB, 0x8B6C3315E7F2317D, 0x1B3CFEAF6343A85F, 0x1CA77040C, 
-0x4C8BF26714A94E72, 0x4A5B340A2E5946DE, 0xAB55C2985C85BB74, 0xC9EA850BE7A24652, 
-0xD499CC20C4CB3FFF, 0x2ADD592375FA0635, 0xDCC7C69D1B9D8E55, 0x857ED7AC6A774058, 
-0x4DAC4B0E7BB5BAD1, 0x135CFD105, 0xC86C543E7E47FB35, 0xB3AB273A3362BB30, 
-0xC86BB6B0CA3A1C9C, 0x2FFF53E38CC6A88D, 0xFCCC0F95538A51A2, 0x45E498C367946ACF, 
-0xCBD368CA8FEE4558, 0x796717CC975D9408, 0xD099400B1772DC7A, 0x237E079D7, 
-0x5F666470AAFA8F8D, 0xA737F743972547AB, 0xE221407C2F298F79, 0xF307FF3D393C35F1, 
-0x316590B7D80330FD, 0x1B53D551E3646D2F, 0x77F0731FF63A7204, 0x59678BA45E9E5347, 
-0xA0B872D6354FF729, 0x106C67AB, 0xD6514BF1A662BF5C, 0x9B9F5EC01B414CD7, 
-0xD4715334648AE28A, 0xE5FE735C8188FB8C, 0xBF1D698A793885BE, 0x8638DC3521DCBE8B, 
-0x9ABC818370A0AE1A, 0xDB3FE14B73A38271, 0x7CF14762C985D9BC, 0x272D501FE, 
-0x7247B6D9572C4D23, 0x3EA5B86E4B9F25D6, 0xC8322ED2295D3304, 0x746F8ACDDA4747F7, 
-0x8FA42B0EC0A1B354, 0xCB55345DA2254F45, 0x215A1EE02E2FB467, 0x6251DD4498CBB316, 
-0x1A8645D250C8365E, 0x255E7A964, 0x7CF05D5FF0FAF7A7, 0x84DF79992C0E4A71, 
-0xC4125C2F29DF1B7E, 0x42B0B8FE3D989C79, 0xBC1D609804CD48D0, 0x907D4CEBE30728FC, 
-0xB6DBFAB68ED4F424, 0x79C320746A82D220, 0x48AA2BFABD00DC0, 0x72698A6B, 
-0xE416354ABD3A0048, 0xEA5AC73C372E5D66, 0x2B7A10BB70A9B78F, 0x1D937EB544C6D948, 
-0x6A92512C96ED90E0, 0x7C1C6D428A23D404, 0xA994129F6EF1AD96, 0x9A2ED07C26D47CA5, 
-0x8FB6084B62BE430, 0x232B5E222, 0x71C0C301E382B74E, 0x178E3A9FB50B33BA, 
-0xCC3CF6164F864C73, 0x7791B9A784732E00, 0x1980294434A268CD, 0xEE8596DF67F0F50F, 
-0x5FCDE130D803D51F, 0xC5B78D8BD2F7034B, 0x776D6465AB6181D1, 0x8EFCD6B1, 
-0xF87054EB6EC08B10, 0xCB3AE2273C6104EB, 0xACF85BB7CC3E6A34, 0xCF1E923784A911A2, 
-0x59C8C33559329F69, 0xF9E1FA3BEA83F16E, 0x6FAEB9735F7D768A, 0x594C1D87F9D32022, 
-0xC658305E1B2603D6, 0x105A25214, 0x9FA377DA2AADB260, 0xD37AD0D943168058, 
-0x409A43C33CF15271, 0xEFE95EE1277C2A1, 0xD7F082D1F55DA352, 0xA544A9D459A28E86, 
-0x8F7C24CAE0F972DE, 0x26EAFD69C1533B7A, 0x33A6733E490D2550, 0x7F65125C, 
-0x5DC72B8C17901D9B, 0x34103B422F75C24, 0xACCE8788137B479C, 0xEFBEFFFC7B5F6D78, 
-0x3ACA677160D988B3, 0xEF53F9319B671EF0, 0xCBB32805131C637E, 0x3F19073BA5BFA0D0, 
-0x38C0A7FB2DB2D69A, 0x163CE4465, 0x37052C310DC5A1CC, 0xF69966F5AE3BF24A, 
-0x8F338219097980D8, 0x179032A03BEB5C12, 0xD252DDE1EE4DEBE5, 0x4A05F7746D948C33, 
-0x2089072F85AFDEDF, 0xA98525CF59871AEC, 0x2069BAED2158C796, 0x1BA6AB496, 
-0xEAA46FD8C6F1949C, 0xEC9730B2B3107489, 0x854028AD6CFA97F0, 0xE311F6AEA2D0125F, 
-0xDB7C47263EB181A9, 0x30A39BCAE9F4CF60, 0xC3409803ECA4D3A7, 0x1BB34294C26A0FA5, 
-0x4B8EB735714B644C, 0xB814AFD8, 0x3F7DD412B0564971, 0x63D160FF09DC74FB, 
-0xB82E56306C7A6914, 0x24F0D2A0113A1C96, 0xD975FC9D82D54952, 0x774CE8EB6A680237, 
-0xDB42C7FDF13DFD19, 0xBB5558C4174CEEB5, 0xCACA7C9EBD8C3867, 0xCADE95F, 
-0x353D5AC513114887, 0x141B80DBD6523466, 0xA0AD15BCA9E19382, 0x5556F42FF2528CE2, 
-0xDAF0C2D52C26C56C, 0x7D2F5F19697A2C6E, 0xBDCD16C8E95AB737, 0xD2FCF4062C1A26B5, 
-0xDB387E324E240684, 0x75891F8, 0x9E220144F01E8B93, 0xFC5CEB601ADDFEA5, 
-0xACEB2EF678F35D81, 0x4E80D16C89D4A4C7, 0xA81E83BECE14D340, 0x608B8BF9A688D5DE, 
-0xAF0539A8CF761298, 0xE16C30752B49A4D9, 0x8905A04FDEEB0394, 0x13D34CB25, 
-0x2776880D408237F2, 0x54AA300E3FEB0F27, 0x202436C219D7FE1A, 0x1FD569777FBB121F, 
-0x2C0A9FA89379B427, 0xA87642CC33CD05E7, 0x3F433D702356DA90, 0x619EDD23B846EDB4, 
-0x28D55D60645ED77C, 0x243831C0, 0x594AEAE36665D935, 0x8C33E711B212BFA3, 
-0xFE1531DD743A2327, 0x2A735BAC42AF21FD, 0x321575BAD48EC499, 0xBF201D7E80F0674E, 
-0xB3645EE6AD7EFBE7, 0x497E7396AF27E4A9, 0x96B38896B37094BC, 0x7053E5B, 
-0x6823268B710AFC89, 0xF2DD7D11C4685056, 0xB8CA8D795F158422, 0x3F0F309C228EEB89, 
-0xA835BCCB8310404C, 0xD28C03C7209E4D9A, 0x3D77692B12B4131C, 0xE39302EBBD6EBF5E, 
-0x85058244FB032DCF, 0x270834830, 0xEF1D68A4473C714C, 0x4F677F1BEA81D761, 
-0x7DB953B21CB04462, 0xB9D56B2308E83B06, 0xD2FEE9EEBC242A7C, 0x50494F1D713FFFCE, 
-0x695EAF43FE4BF875, 0x7301A22957432D52, 0x5E2DEC56950AA246, 0x1EE229701, 
-0xB58964A85E4634F9, 0x1B7BA82980B4E352, 0x5FC9324DA134EAB, 0xCE01F098B5349C7D, 
-0x745830A35216F8CF, 0x4FA806A89FB5B0E2, 0xF89C46477D92DCA, 0x6DCBD4BD3A33687C, 
-0x1B6F996C0D88A528, 0x19CDFDBFF, 0x4A3FD5603DACC5BA, 0xEF69AD0E4FB0385C, 
-0x25174676F2FB8D3D, 0x3E6387FCBC8C9065, 0x9BB47E0EF40323D3, 0x3732F4DDDBF70A5D, 
-0x9598CF2722D77B49, 0x3A828E642706161D, 0x164F796BE506809F, 0x146853819, 
-0x3212116359F649D, 0xD1B9679D2B43D916, 0x290EA44A5336AB5B, 0x89F67453A7DA7F01, 
-0xCD4E6C155BA78BCD, 0x8457EDCE5A458914, 0x4B478E2902F5BB07, 0x5061B07726ED10B5, 
-0x7AD266906A50E326, 0x25271F8EB, 0x295F3FD004580207, 0x8D95C2B2282D9A8F, 
-0xD64E3C6DB206C8F, 0x8EDEB41F0EA082F3, 0x7F7FB0C0B97E339B, 0x6C94BF3F67A34AAF, 
-0x74EB411C30ECF6C7, 0xE5EA2B39CAE8E293, 0xCB10321A8A6FE2D3, 0x675350FB, 
-0x92437C1B0D9F03B6, 0x9AD42D4418042B4F, 0xDA703F8C2441CA4F, 0x945E7D9682910D8C, 
-0x6B67FE1F057BC4E1, 0xC64F9B91714DA0BD, 0xAB7EFC6F6B0A655F, 0x77CA0C6E30203406, 
-0x4ADFA7ECCE35BD5A, 0x2389FBAE9, 0xD30299AC6306A791, 0x8A7A8DA1FD754456, 
-0x80AE767A44D74C52, 0x1DD208CC9D952B9A, 0x90A2E881374FA256, 0xCEFAB1E113AECCA6, 
-0xDFA10F9A35DDF8E5, 0xF8519619A3788324, 0x726EC617DE7B9FF6, 0x13C5BD78D, 
-0x26D688AEFC6C3C7A, 0x17700D5B2F8C337B, 0x95B0AAFBB13E76B5, 0xE1AA59878128A189, 
-0xC99373209873BE0A, 0xCED8CE2A64A00CBE, 0x5D421E59B0EB1DC, 0xA29609A0D2203471, 
-0xA4CD8ABAE5A78C66, 0x27EBF707, 0x31A9A695E40688B4, 0x8F39EAA85AA0410, 
-0x28DECC8BFFD05230, 0xA6080CD1B92DE88, 0x8BCE2C702828371D, 0xF6B3BAB1161B9313, 
-0xC1A266527D9B9383, 0x8ABF96B3504CBA76, 0xBE8310F034A20EFB, 0xA94FAB52, 
-0x4B65127A696CA7AC, 0xC452FAEC6FDFCF6B, 0x59FC450E1013DC48, 0x5F725356B2A96AF8, 
-0x86A2266D2E3D5D07, 0xC8C799F9FFD2F4BC, 0x7BA483B4037CF4FB, 0x9673E57253878CA0, 
-0x31F47932566D3148, 0x1BD733995, 0x2CF58F272227C2EA, 0x69E000F9BC8581E, 
-0x523BDF5A99837F6C, 0xFC1357E8906A27F7, 0x116FBAB72DA21981, 0x74B79B869F521CF0, 
-0x9B1C26AF243FC55B, 0xDB638FD53CE66283, 0x10CD8CDE8DC0F4E8, 0x103204DB2, 
-0x766C1E4A2FA0279E, 0x7290C930FE1BF6A2, 0xDB507B069CEEA7BA, 0xB8290E7B86471542, 
-0x60D94AF11E4414CC, 0x5ABE4E29068121EF, 0xA57559A6F00D9E32, 0x4A6CE4F4811E150A, 
-0xDFC1A7B24B30729A, 0x220810EC, 0x6A4C4EE2EAB254A4, 0x55D2F6B4CB4D18A4, 
-0x440491476B5127C9, 0x76F0FBD408B2371, 0x1F31680A04C7255F, 0xDA39C1900E6BF568, 
-0xB2EA09EA88B95F8D, 0x99CC62A7A47B38C5, 0x6C7BA9E9A03023A7, 0xF4EC8D8A, 
-0x24860584B8E8DA54, 0x4E6106DEE32A3674, 0x6301B0EFE7D3C412, 0x81E585F107B3FC19, 
-0xB08DC98045F8BDAE, 0xA7195DF661EC4281, 0x2BB88F843850DC16, 0xB97C43C3BD072DC4, 
-0xE8FFF6FF376BB884, 0x24BD7D41B, 0xEF716C79EAD3D2F, 0x659B5D2162F85525, 
-0xA4AEF2517F419557, 0xF069DD728B868ED5, 0x9D7856716F1ECDBF, 0xF13CA45B5D4D3E6A, 
-0x8816FEAD9E685504, 0xC6BACEB4B0D19759, 0xB9BF9F897166D7DA, 0xF43B6D6B, 
-0x69DD45708D0097ED, 0x1F3C739FAF0EE3D7, 0x144757D0CA186F01, 0x4CE0600C61A8D554, 
-0x21CC447F4BB94A5B, 0xC2D147DEC6FAB783, 0x9D51A4A832F57BF3, 0x2C519310D4FAC358, 
-0xF2540EDB36F01DE1, 0x18D6C89A5, 0x2FBC387675EF7D8C, 0x68815DFC2FE535DC, 
-0x3BD750E5606CD53A, 0x1CFD359EA8A5580C, 0xCEA53ABB179BC1F, 0x451CF003B07E7114, 
-0xDCEC9E58615B735F, 0xDCF6F8AD4F276968, 0x55F692963BDF887F, 0xD79CF706, 
-0x2C074CC57D5391DC, 0xD1682B1B7A92CD31, 0xF18DBAEE22D49FDF, 0xC242D20C460A9FB5, 
-0xA17E548103ED688A, 0xB98825A86A14458B, 0xEEC0956F363831B3, 0xC5345E68DE35AB3D, 
-0xA1C5A60FEADD06B0, 0x1325C05DD, 0x867B150B97806F21, 0x5C59618018D093C9, 
-0xA067F488F88597A6, 0x7D9182BF145F1545, 0x598B8BAF60EB922B, 0x6330CB904EC2DC44, 
-0xE87D4907A2742CB4, 0x2A6969F092DD0EB5, 0xECDD660CC2943D82, 0x244E723C8, 
-0x832BF249E07E3A0B, 0xFF98C2AD1255A25A, 0xFBF87E47E5131F4F, 0x5BFC1C1AE9CA70DB, 
-0xD457DB2CD79C0CD7, 0x2D41BB357186BE46, 0x6B5B6ED0085B86D2, 0x7D737FAA919F9F6B, 
-0xA0909D74ACB50650, 0xC8648281, 0xD933583E98D81656, 0xB28B4B53536F9E58, 
-0xFAD4E2A213FE5B90, 0xA43E6142D56CC263, 0xA4B2941B13908293, 0xE7F599A165398750, 
-0x38290579AE529D5, 0xCFA4AD5940B18067, 0x26D1B69A337D52E3, 0x5EB3B567, 
-0x687A86A5EF84484C, 0xD63BD15339D9E7F0, 0xFD6CCF65FA03E9E9, 0xC7D766690CAB2577, 
-0xC648C149532FCFAF, 0xB1AF5650E6CA29D3, 0xFC0730379A781655, 0xAFE6C7362D900310, 
-0xCE78ABE29D659E7B, 0xCA5F6129, 0xD2C0E3A3D879847F, 0x4646311E1A026783, 
-0x5EE6871803923A96, 0x8560F688928E8E99, 0x82D4C880845B1C91, 0x81E2B24FB94F9E8A, 
-0xC594011B734045A2, 0x1B7245E3A15D2FF8, 0x804C59021169107E, 0x13C834306, 
-0xB132834071E734FE, 0x42EE345F70710982, 0x2C0DC5B10DC8F5E4, 0x29A395107D58AEC9, 
-0x764B4DAB24225E1E, 0x7CA2D5A1DF167C49, 0x388AA46855A7C1B, 0x27ADF37BE739C31D, 
-0xCD55816346A56A19, 0x2482C7834, 0x999E86B6A1436F1D, 0x2A6590603209E1F8, 
-0xA3AC028940121D7F, 0xE658ACCB378DD104, 0x67002263098AA77C, 0xAA2C985C31644841, 
-0xC65F9370F3D394D, 0x5A082EE62A172639, 0x889E9E7B68640F16, 0x126E780E9, 
-0x97E578838085D5C4, 0xE899FD3C261AC48B, 0xA1F785441B69205E, 0xDB829321FFB2F2B6, 
-0xA00D76737FB82AB8, 0x7EEE5120E6362F9D, 0x689C44889A9A1722, 0xDDACD7BA67B267D8, 
-0x2FBAB6513436FBE7, 0x17760E977, 0x768ADA845F1ED709, 0x71228274A4652CFF, 
-0xCF3E3A8646A9A282, 0x510CEF69C3B9C48, 0x6FC270A2B40F5DBA, 0x93565765588E2BAB, 
-0x5B910550E41F63B4, 0x40E548FBFE2A9200, 0x68FF14B9EA3E8FA6, 0x89E35C0D, 
-0xC6327265E62C5ED1, 0x1EF2088CD1C15784, 0x5472815782C14A98, 0xFD4CD905FC08D6EB, 
-0xA74E2497B8497CCB, 0x7D72B5EF794A049A, 0xC0D951D1840853E4, 0xD9AEA0A288FA4EA7, 
-0xD0A5C5B52344BFF8, 0x16F6091B8, 0xFC662F615490ED71, 0x8E60FEC750B7B00D, 
-0xAC8F7C468DB7AEAC, 0x87A7E4943A8E0FD7, 0x1EEA45805D79D64E, 0xDCFAF1A241BFFA5F, 
-0x683C34FF6D158F5, 0x4BAD9FC7208839CF, 0xDA1AE4366FB8FF88, 0x23CF0EE13, 
-0xAE2D4C65962D8794, 0xAA925D777CB58AE, 0xDD1699479292BFDE, 0x84FD709E287EC8B4, 
-0xDE3FDFE3081937E4, 0x38492AE423FFD063, 0x90EAA193A400511E, 0xDFA2BDA36FE07C93, 
-0x28D5FCDF64DFEA58, 0x1C4EC7234, 0xFFE5489BC3149B27, 0x2943DE28CBCA6FCE, 
-0x36B7A12B137C834, 0xF353996A0A467DE7, 0x53FB18429E762CBE, 0x8133870637FFC571, 
-0x3F6C9C187C58C8CA, 0xE2E3B73292990FF1, 0x4A24CE568E0243F9, 0x6CC1AF59, 
-0x23B2BFDB14DEB7, 0x91F758D723D705A0, 0x6C077BD055FD8ECF, 0xA2098D7017E02084, 
-0x91A77939C98DCB9B, 0x21B1435C89BC0849, 0xC0E9FEB68A104F6C, 0xCF86FA339A8F1DC, 
-0x12859B8FC33CAB3E, 0x369E1385, 0xA5F38B49C385EE0, 0xD0500F3DD77A41F3, 
-0x82F74BA6FA30141A, 0xD68A7CCCAE8A0239, 0x3C1F19FD0C09F154, 0x1D8E8C36BFDFAA6E, 
-0x42B15682297938E, 0x134DF38A58070520, 0xAF5EFA46EC0FBD77, 0xA479C4F, 
-0xCAA2C1B707CCD116, 0x1FD586755655131E, 0xCB14512CF8BE12F, 0xC51D6ECAA08A76A1, 
-0x2582A08EC02DB360, 0x7D44A89680467717, 0x92C08D84BC98A935, 0x1FA41DA3A49D29B6, 
-0xAF3EC3D83A2E9C19, 0x1CD41822, 0x665EE0A0A1204B9D, 0x80C7530EC74B340, 
-0x917D8251B3523303, 0x48E06DA732BF3E4, 0x514D6B9FDD21DE3C, 0xD213C9FEA18CC7BA, 
-0x8A4D6F78EFCEF401, 0x23D956C74271FBF8, 0x1F968D3F907807D9, 0x1EFCCD766, 
-0xB3E4C5E86652406B, 0x6AE3D4AB79B049D5, 0x6DB67E1FED1E8645, 0x7A8FF66F4C6691E0, 
-0xE9D5CD3F7EFA5019, 0x6B5EAD5DCAC92EF0, 0x60BBB1117269CB00, 0xCA455F6760DD58E0, 
-0xC423381C10F6CB5A, 0xEF41A684, 0xC2B955FC8550545, 0x2B2C1AF78CD55379, 
-0xC24D5A4BF8664047, 0xC102AA4F875CBB3, 0xAA588ACC3D9034F9, 0x400EE5953377112, 
-0xE6576D9BC0BB7657, 0xBF52F936984BD838, 0xD2A5114479A287B7, 0x721268B5, 
-0x9FD3F50ED7BF812E, 0x1C35B752768D8C42, 0x408B0036C5B5E432, 0x71D50B2FEB82D758, 
-0x33B517601D8D8548, 0x27BF35F77DDA78D8, 0x78B6D4026FA4E948, 0x803E39374F92CD12, 
-0x40EC34BBA3B8E103, 0xFBB31D60, 0x5A67C2F9650860E5, 0xE2FF234CC18C44DD, 
-0x9AB68DB634971D39, 0x9AF04BD71A21DC53, 0x8E69130D1AAEA46C, 0x3094C9C04B7F0638, 
-0xBA248D844FA41D30, 0x2128A71B001F85A1, 0x1C24A2E602C17B79, 0x5EE7507B, 
-0x9F2AD1A0F238BEB8, 0x61DF461E3D57FB81, 0x6856A20D6B543EAB, 0xC819226A53270FF3, 
-0xE2A29D1691463238, 0xE644BD3E04A87BC5, 0x3B1A442BDCEFFD99, 0xC8B5564ACDFA0CD8, 
-0x37CC20DCCEB572BE, 0x2630AEABE, 0x4DAAC1FCE0A189, 0x28C96B459FFE577F, 
-0x44AA3CF1D1612864, 0xF3A8B539BDC26DF7, 0xD482BB1708CD3B84, 0xE2E9B46DAE46F6F4, 
-0xB365C73BE4F4F9C3, 0x6387D17EA281BF98, 0x29BD4FB60C94FDB, 0x1A9BEC8A2, 
-0x462C7BB016C5EB97, 0x5153D0BFB2204C9E, 0x3CF42E90074DF180, 0xBE322C4E3E2C5E3A, 
-0x4D8C3FA91CB052B1, 0x63FF378C39D5A80E, 0x179112A465872E7F, 0xEFDD30212107D5AA, 
-0x29017F6B4D94B70C, 0x10A993387, 0x25D99C928576EBFE, 0x55A23210CB03ACCE, 
-0xB237F50408040E70, 0x678219B6512E6DE2, 0x68185F29AD3FE40D, 0xA22A4F8F2249C384, 
-0x1F07675C7D072F57, 0xDC3D2799E5560300, 0x35D1FADACA2EC37C, 0x18359CAD8, 
-0xFB8840FEA9DC46A6, 0xDCD40FEB10234FF2, 0x12D853776F824028, 0x3909FA7A714D7944, 
-0xA5D754246A8218DA, 0x92041A4AB84163B1, 0x309B5CB0738913EF, 0xFF977EB04D035EE4, 
-0xA51D024217C5E814, 0xDD038766, 0x50874248B228B06F, 0xDBDE9965D6BDDCEE, 
-0x20D58AB8273E4CE8, 0x5EAA170E30B397E1, 0x55B18998B913C098, 0x52B742C8F2723E6B, 
-0xA32F2FCBA149EB87, 0xE96BEE25D864FB12, 0xAC5924409022DA38, 0x16EFABA97, 
-0x6FA6D505013090DF, 0x99C453F05724AC47, 0x6848E3A4D72E5225, 0xDFB5AC9CC021D997, 
-0xE36DE9244129281A, 0xC1E44757E721AA13, 0xDF7AD9626DBA8A00, 0xABBC55470962A35B, 
-0x1AC2DDD33AE25702, 0x1213B502F, 0xA5DFF60368D3CA02, 0xE64F9FF4A4D2CC9B, 
-0x5940327470FF9188, 0x93DDB784FE180DEE, 0x1381D89F9F47CD69, 0x846FF440CAA2E5DA, 
-0x95057F23AD4337A3, 0x85D6950B3D9B3A2A, 0xC394051B1B76E50F, 0x195246C53, 
-0xDAAF325A8630A262, 0x7F3B23034968BA5C, 0xF92D0B51975C56FC, 0x30CF7B470C38260C, 
-0x5CB623A0B931FD9A, 0x7823E57F0144158C, 0x23C4185FEAD7C6EF, 0xE2C62CCB3562BC15, 
-0x2FF7F33FF13F3232, 0xE4CFB724, 0xF2D0A2576D7AFA72, 0x6E4046ED2890D4F7, 
-0x1105304F6139A5BE, 0xC9174E0AE3654A12, 0x21743818551DAE77, 0x15E185DAC49E077A, 
-0x1B64F4CFBBC75304, 0x44C918BD8CD57D67, 0x768012B19A2286DD, 0x1AF51A747, 
-0x4086F80D4B19B332, 0x4B9158938BE578E1, 0x7D0E7EFC85D266B5, 0x8CEE13198F6FF5F1, 
-0x1158569058E6C80D, 0x5594D8910899BC51, 0xDFE242445EE2181F, 0x72FEA677ABBB2091, 
-0x4F28C589418642FD, 0xC1E71059, 0x5E81197B090D9493, 0x2FABBBDE85858B7D, 
-0xC7D01BEFFCF5871E, 0xE31B80CCFDA9091F, 0xC0523D8F900E6515, 0xA381E79EDB8B9424, 
-0xA565266D4E205394, 0xA13A60D0A7BC6C14, 0xA3D7CF146A60CB44, 0x86928382, 
-0x2E059B0C11C362E3, 0xDDD1C13AEC4FB29C, 0xE69F712E5132CED6, 0x79F2732DBF3741F2, 
-0xDBD513C42CF60333, 0x31DAA9B61C457E78, 0xFAB0F84861B808CB, 0xFDF617766062DE98, 
-0x6A7B01BB0C4F0EDB, 0x243FBB677, 0x1913C7F4F5BA00E8, 0xECF267D57316E42A, 
-0x39B66CC75BF374AB, 0x9763FE9BF0B244DC, 0x6B98CD4EA5ADB4B8, 0xB9E53CAE9FB2C7BF, 
-0x14DFE4045F4F8CDE, 0x6C773664909FE7F2, 0xFE5F2CED7FEDF01A, 0x6A515027, 
-0x6C74875B7B8A980, 0xAC69083616767D31, 0x76DFF3498413C848, 0x6041917AB850313C, 
-0x6B5EDFD968B0B656, 0x19513942E253D61D, 0x3CE403A174D8D8C7, 0xD4644E0D97EB85B0, 
-0xD59FC0A567392D1E, 0x81369E2, 0xFF72CD22BED032DF, 0xDD345491E89F8AB5, 
-0x35597F8C624D9879, 0x4E158A183150D14E, 0xAFDC4EA513505916, 0x6B02ED05ADC3AB4A, 
-0x46BDA59FC4EDEE6F, 0x2CE47A06AB7D9805, 0xDCF7EE360806808C, 0xE22F0D1D, 
-0xF7E1BEB8C1E1B29F, 0x1A1A173F4C18664, 0xBB5E325327FE3D4B, 0xA36DDE85217E1749, 
-0x16E3DF839DF4F2D3, 0x8A3EDACBEE59EF67, 0x695791A9B561077A, 0xFF7B954880E7CF98, 
-0x333D8CBCBA247D39, 0x10BFEC78E, 0x46A30BF6509163DC, 0x8BECF2EBA4B05E54, 
-0xCF7C406A14C138C, 0xA99FCEF62E8DE2F7, 0x1E588851259CC2EF, 0x2CDE9AC11E874EC6, 
-0x3DD13C4E69FAFAEC, 0x85A8E9CDFF2D9FE4, 0x39717D8DC3A70FA0, 0x14C558BCD, 
-0x7122A7E81C1F7D16, 0xB2F981B01A3E274D, 0x4D5D222C80F0BBB8, 0x4827014A9DF94DDA, 
-0x5A46D6F02E681164, 0x9D68694D61E41E81, 0x2B4494D40133D50, 0x2F5513DE71B68AAA, 
-0xD2112B4EF7F5F706, 0x16AC75C7B, 0x20B2767F0EDA93AE, 0xA34936C91CA728DD, 
-0xFB2C560CA4268CBD, 0x534A33AE3359C7CD, 0x3A242F7B1B1F6AAB, 0xC83871C1C32EAA4D, 
-0xA8987C8B40B3475C, 0x72CC2360E114302A, 0x5C700131E58AC696, 0x199ACE8D, 
-0x868398297233C66E, 0x43AC36D535F8478, 0x76AB48254053B0E5, 0x1B6C84E6A49EBB67, 
-0x102FF3097112C696, 0xF5B2AD5AA71A9049, 0xBED2D53414B31C80, 0xB870322A43399C46, 
-0xBD05CE3AA8F9D474, 0x272A5A2F0, 0xFF373EE441863949, 0xC5F981F6EF23B14A, 
-0x6F6EF23C9DBFFB5F, 0xCE938AB5E67E494E, 0x8BBE18F4357A97A7, 0xF5BA373552EBE043, 
-0x1CDDB17FF2F25A01, 0x3E6ABD04474C28AD, 0xE60212965779A122, 0xB9BCAF89, 
-0x3DAC29C30445B405, 0xEFE8A3C61C70AD88, 0xF8F0605324E7C0D2, 0x5A4C4758F78D1BA7, 
-0xB2A4CD872855916E, 0x36F67D41D585188A, 0x5B7C5F79DAD3398F, 0xE87142ABE3569E8C, 
-0xC50CA394611701D7, 0x6B386046, 0xFE1F500ECC75EB19, 0x950417495D87B449, 
-0x3DFF57FB18E6CF9F, 0xECC15C46BACDF990, 0xBBA2BECAF8DB66F, 0x15367E104398C3E2, 
-0x4E9D413B796BBDEA, 0xD7E2A76DD372315D, 0x2DC3CEAEA62182E0, 0x191C595EF, 
-0xA55588775254C2C4, 0xB3511FCDD7D10FCE, 0x6FBF6A43C31D8554, 0xB4ED3EF9629E174E, 
-0xB4123F33A17AEC20, 0x1B5A0D7299644E29, 0x3780633D9A44E315, 0x96D666974AA3EA66, 
-0x1FF2508460ECE3C2, 0x63D934B9, 0xE1D83572232B6213, 0xCED0C64DA5BB640D, 
-0x6406F172EFD74224, 0x6EA15331FA64E613, 0x2107397398AD995E, 0x7C701B1C5CEE29A5, 
-0xEAA4E0F2CF23F7AF, 0x8A1795030FE57C8E, 0x7FCCC2CA20647585, 0x1DDADD0EA, 
-0x6E3A7DD6D3A47C72, 0x18DF23260AD5CF5D, 0x3E1F3435D97E04CA, 0x2D200E6EB8A160C2, 
-0x754C5005B3FAAFCD, 0xDA72BF334C160E4C, 0x42F93BAE1A624182, 0x469658BAF58A9EC4, 
-0x89DB6947F92963EF, 0xC580B2CF, 0xFBEBB76A5C60DD87, 0x2028EA83D36F9D76, 
-0x835265943ECD337C, 0x266EF1C2E80B162A, 0xD7C0160A31051698, 0x11E5B348AB57CB0D, 
-0xFC9E5CBABC50E10F, 0xEBEC321A4BC7F585, 0x8CC0DDB475FA2059, 0x16B483871, 
-0x1B613D70E7F90DF7, 0x311FDB5E3FF94E85, 0x87BB4AE90CBB92A1, 0xA1CBC3935FB2A342, 
-0xBBAA9385BC1E91EE, 0xEBDA477A3A335A5F, 0x7516B7A319248964, 0xA74D20D289FBCE73, 
-0xEF0B77EB42C314C7, 0x100FF9245, 0x6E7EEA80C9078588, 0x4D53102A2ADC444B, 
-0x6E6BD12C090107AB, 0xDFFDE7DC4A0A5844, 0xB0474A1DFC6236B4, 0x4CFF42198D5A3EF9, 
-0xABF1589E8863C8, 0x22FA69EFD60CA1B4, 0xD3C5C46735D52974, 0xE0D2ECF8, 
-0x813DA74399192D50, 0xADAE323E691B775F, 0x698795BF0A12FAEB, 0x916822BCD1832E87, 
-0x60043965A4EC0270, 0xCF1D8A7514D5A1A1, 0x7C45364B0BDCB172, 0x1141BC69244A4B26, 
-0x80E77FAAC8E4B953, 0x2D115C2D, 0x31E515ABB2E43E02, 0x3E5ECEF9826E5B70, 
-0xD337E9DAB1B3B03A, 0x23B04F173BC4D44, 0xDDA94D7FF337D69E, 0x306AF14959929A76, 
-0x6707030DA616F721, 0xCC23E1EB43672110, 0xEDE44081B95E3B0D, 0xC71A8D15, 
-0xB3D067266C233263, 0xA750F38A6586AC3F, 0x2ACD5B49BB4777FB, 0xA750DE400F7335C6, 
-0x648C799D37BAF4EE, 0xA9B575C8293E574E, 0xC70EC2970A62A1AE, 0x6F9020DE63B478C3, 
-0x307DBBD9EBAA8D45, 0x15D47FF74, 0x95596EF267D760B2, 0xF20F81364D3F1105, 
-0x2708E6EF21173E77, 0x1FBFAAD4D6419867, 0xF6A53655DD05E8F4, 0x45F7922229F62C0A, 
-0xD01241B619A7102A, 0xCE9DF5772D75CFB9, 0x87AC7BB1E146406B, 0x16CF6D6C9, 
-0xFD8E36985F76CBDA, 0x679D2620455292DC, 0x1EF27005F5DD8918, 0xEDC6593A008676CC, 
-0x76F534D2AF6F20C8, 0x57FEC513B5A27258, 0x246A0E509B882931, 0x2B589A666EF84F31, 
-0x64545506A1FF315C, 0xF3FA4058, 0xEF3AFB99CC9B7124, 0x1D9AA86BEFCC9195, 
-0x78011EF5637A6E6B, 0xADD5458846DDED72, 0x241893CF250EA02A, 0x8886B38C0B535092, 
-0x7639499C14AAD30A, 0xA6D0E6A483B8DB67, 0x4C0B13C89B5ADBB8, 0x5845CDE4, 
-0xFCBF014444FD3250, 0x3FCEEA7850B0345, 0x30327CA7BD39E5C8, 0x7354F4E93C3C4B1E, 
-0x4AF2435866BA8D4B, 0x1B32BA61DACE3CFC, 0x89E981125B30BA02, 0xBE6EB588C884295A, 
-0x5FF53AE15F89C4CE, 0x43403341, 0xBDC8956AC417F294, 0x52C341AFAFF1B1CD, 
-0x89F46AAFD06644BB, 0x20DCA68D7AF846D7, 0x1FE87D8337A9D22A, 0xCE9E784CB5FF78E2, 
-0xC08994E47B98FD47, 0x44958EA7080CF3B6, 0xC02DFEDE3F4DAFDB, 0x21ED14F79, 
-0x68D097583F1C80C5, 0x9A1E5CDED6F9902B, 0x4363ABCE320E2C43, 0xF045A763BF9DB6DB, 
-0x57C82A3B553F6644, 0x95021CF4F7665B22, 0x80D88EDC09008E8E, 0x23FE439ED18B7B31, 
-0x9DEBE7B89D458BB7, 0x27892E7EE, 0x1C8B0C4E2B66114D, 0xB9F6D728D171760D, 
-0xFF11A3C5F00A116D, 0x81AEB2BAD5B1469F, 0xB442A199AB455247, 0xDBA79902E73F682F, 
-0xE018FDBC063A3553, 0xF9BEA9F6BAB37523, 0xC24611A87AD0395D, 0x100FCBE9F, 
-0x44F4DA13A1DD2823, 0x9B90E251596937A6, 0xFBB1B5FD80CF1B79, 0x6C05A59DEE02C109, 
-0x99CA60699A602B8F, 0x39CAEDA56C3BDBC6, 0xADB08C7417491B6C, 0xD409BB4D2AEAC730, 
-0x164A01ABA079754D, 0x13E31F532, 0xD6596070DE5CC6D4, 0xB846F5F108AA7311, 
-0x544656558D177B81, 0xF603690C24C9069F, 0x8034718381B5FA8, 0xC771F02571833AAA, 
-0x3C5AA6C59A2ED87D, 0x943F9FDC487FBA54, 0x9F9E1784FA4C77D8, 0x15BDE174F, 
-0xE944F52278122144, 0xFD73861C991580C7, 0xA2F01C46BEDBF40D, 0xC797E42CBDF48E20, 
-0xFF2973F68EB4A666, 0x1BA102A35B7D9463, 0xCF7093EDAA38B8B8, 0xB9157658B5015B31, 
-0x20069DECD07E3367, 0x205C438DA, 0x2CDE57A923882400, 0xD82E88ED90348F60, 
-0xC5AB4FFD1A1E158B, 0x5B56A52257CC5C02, 0x1F462ABCE301D996, 0x6F0C25DD89D09A71, 
-0x9A1933562404EC, 0xF5B939169BC7F1F1, 0x481DD2DE6CE5ABAC, 0xCD80CDE3, 
-0x442F84A688BC1A21, 0x516CA1301873B5FB, 0x8BC05826F621A660, 0x6D7A9AA3551CE47E, 
-0x837133B3E8A4B788, 0xAFF4F56210B45246, 0x8D40786B8E485B5C, 0x8F2ED05729FFC47C, 
-0x4A55A15261EA2160, 0xB991BBD5, 0xEBF08C2F62AE7F82, 0x6F85DB81D7FE0483, 
-0xCDE135BAA9E83655, 0x9D9740C49E7AA887, 0xCD647927A68029A5, 0x74B2DB33CC8F05E2, 
-0x60FBDFC0E843D532, 0x2BEE35AFD23D04CF, 0x14E6855E4FE80B59, 0x15195F3C1, 
-0x43B36545F01DCFB5, 0x626B4083B2DC784E, 0x95750D740B68486D, 0xDBF9B2094DF2470E, 
-0x8C5AAD86372DC890, 0x1DF26FEFC9FE4E55, 0xDF40F3FAECE45F2A, 0x1E5691DAE326FA27, 
-0x6AECA105197EE3CF, 0xDB0CB4AC, 0xC2DB3DCE573BD1D, 0xBB8739762F2F0F22, 
-0x193BD25A1A53EE09, 0x83F3D63B1193FE9C, 0x4C75FEE2217B2C60, 0x2ED4E0EC7817A4D7, 
-0x21C63562B7508AC6, 0xFF33FC32B423F07F, 0xAB1F9C1C238A1BF0, 0x2601B0E9C, 
-0x23831128CC37C8C2, 0x62D6A4FD53AF446E, 0x4848DA3F0F09E451, 0xC0D3063D5E7AB700, 
-0x9062AB281F76C692, 0x562CCEE3F0DBDAA7, 0x1A6FE5DF6810B280, 0x72F3EAFC83932998, 
-0x1E3B381161A7EFFC, 0x246FD061A, 0xC2186FC9F56E80BC, 0x94DBFD661BA935E8, 
-0x91569BEDCC82F65B, 0xBC41B1EE60B6AC58, 0xFDF935E8513A2459, 0xC25CCDCEF5A4902, 
-0xDF9127EDDD9909E8, 0xF34C4DD7505B516F, 0x599D04AE88A370AD, 0x2398A8083, 
-0x344F1A3567F81C82, 0xD5A0DED69E989BC2, 0x832C74C54FA630FB, 0xA752E271325DE174, 
-0xA5F188613141B4F9, 0x301D7491B6F828F1, 0xDD24E8AA7DFE0238, 0xB549A58E8BFB9619, 
-0x4C62894FA5EE2FC9, 0x217B62C32, 0xD936D02C364CB209, 0x769F84DEBAB2F219, 
-0x4C47F5E39B5AD867, 0xBCD959F05389E331, 0xF484BAA5F1F5A547, 0xD1398D7E848E8057, 
-0xAC5FF79DAFCFD043, 0x9CCC4317D481C562, 0x23D0E3FCCB02A7AE, 0x277284676, 
-0xCAF5064A7C7EF30E, 0x9308605FD31B8CBC, 0x8FEB57444B6BEBB1, 0x234AB57004610EE7, 
-0x9C079D68DBBA687E, 0x3D407EAA70C929BE, 0x9D91BC2EF8E2F3CE, 0x5C03CD8DC1148C5, 
-0xEBBA36B8AB215C82, 0x72C9EEB, 0xB4C9F8EEE1FF8793, 0xD24CC6DEB49ED859, 
-0x100C344D30C86C1B, 0x71FF65082B917150, 0xD8CEFD442F43D211, 0xD459421BB63C6EEA, 
-0x502D0CBCDF92D68, 0x5EAD1786E9D1D172, 0x2689A63F446F263, 0x1659138C5, 
-0x220ADF481561E608, 0x523BFAE923B997F9, 0x44A7E9AE911F498C, 0x5B73789CCCE09132, 
-0x5CF94B8BA8B7561F, 0x995789E170873A8D, 0x47D7611C1C9AA51C, 0xEB41B44D88D927A8, 
-0xDB970E522228467B, 0x27811A822, 0xE965B46374BD70DB, 0x98EEEAAC847C877B, 
-0x4B031D434F3DBED2, 0x63CAEA664C805AD6, 0xF324F1D0057EA257, 0xE16BBE362E85917D, 
-0x64C23D3EF7811546, 0xC2ED8B5672504B9C, 0xC824CEF07BF21EAB, 0x19E69A1D7, 
-0xF2FBE8BEA518E030, 0xE31D8330A927B189, 0x71EE7546792D877, 0xC76B5122869A9DB9, 
-0xBA620A748C8B45C1, 0x7A73A270331F2646, 0xC92D023BC27EF5C, 0x61DB114293E9F901, 
-0xC1E581AC6FC5023A, 0x875F3E6B, 0xCBAD8DCFFA56C117, 0xD119F1110F5EBFA, 
-0x8D16DC36B8DA2468, 0xE1C0D5E72C6CEEF3, 0xBD206B3DA0547232, 0x6CE8F17DB3F806E6, 
-0x664331C59DD132A4, 0x20CB3204531A2522, 0x6EF9EA8379A6653, 0x1BB43B3AF, 
-0x1553DC6257AC49DA, 0x18267BA72720B8C, 0x316AC340A8CB511D, 0x35FD74138BD3FD75, 
-0xE9CB68FCFAF57373, 0x200829228A959CF7, 0x945A5887A75A0D23, 0xCE269EFA439941D, 
-0xC248A45DBC8F47F2, 0xEB3BE487, 0x4CD5188F5A1628D4, 0xC42434F6311ED859, 
-0x5B2E7B02D4C7B69F, 0x51BD842A3D6427F6, 0x1E4C0F4E2B9D1443, 0xCB60EF5C03E38952, 
-0x2ECB8C27F86078EC, 0xCCCC89AF42E64BE3, 0xA939279632189D1A, 0x15B41001A, 
-0x9FB1CAC55D464243, 0xFDF13E2D07A27451, 0xECDF37D6A5FFD658, 0x3FFACBBB8FD8B6BA, 
-0x8AAD43E2ECAF3F37, 0x261033949825C9B3, 0x83387F742E699558, 0xCCA7D12E77B43D96, 
-0x387DDC5FEF52516B, 0x63A6ACC6, 0x11402F41A161A276, 0xB64604D550589BAA, 
-0x14DCD47E56F022DA, 0x8B29AA3056317D5C, 0xDFF4810799537640, 0xD10A9935A560EC90, 
-0x953AFD109E78E32A, 0x38304DF763EA8C46, 0x788216AA2CBEF6AE, 0x1DC69CA70, 
-0x194B6646F268F736, 0xCEA5D8726E21079D, 0x637944831363C669, 0x3681E20220827657, 
-0x15E4794DC12809C6, 0x4D9BF0789F95EC9A, 0x56698830C8E0E9D5, 0xDB1CFCB8FF69CF2C, 
-0xCFEF1B82326FD423, 0x2710E28FD, 0x745001BECE4B765B, 0xACBB6FF24A0DBEE6, 
-0xB57D3EC9DF4455BC, 0x10204F4DFE1B2FBB, 0x1A4FBFF185448A24, 0x3B9572FEFC5617A3, 
-0xD95E3AF3FFBAB074, 0xB6260BF5D98AE3B8, 0x17DF08C5BEBA2614, 0x1D9BC1888, 
-0xC77A285BADF320D1, 0x3966018DAC94913D, 0xD75D3ADA4D28D3EB, 0x2A1E7BA9445E7B98, 
-0x124845DA1156C4AA, 0xE0A1D8F617D480FA, 0x460A82F5D3706BE5, 0xC5D27D23FCBAAA8C, 
-0x5247EE5B7BBAFCA4, 0x43C3D3F9, 0x8D9F3D3247F11989, 0x245EEAC8845EF854, 
-0xEB421D728A220B76, 0x189B9A5204D72EBE, 0x2D4A77B1A958132D, 0x4C1D3B3C4E366A4D, 
-0xA1CD3353F53F4FB0, 0x375F4C0DEF433CF7, 0xDA31B954A0B91426, 0x8B5BA1DE, 
-0x6DD7FC988475CB4E, 0x7F13BA6A3B4C10CF, 0x376B84D673C6A50C, 0x182B4C590B5FC771, 
-0xE8C44CAAE06C5351, 0x9FC6A4413A506F85, 0x954033928585B190, 0x4004DB3BF3CA8C0, 
-0xE8ACC52C6756E6F5, 0x21925CF14, 0xE824229026A00BAF, 0x74B4491D2977E340, 
-0xFA26CE22BE8EF19B, 0x79908DC4A3E7A532, 0xA20263C91F159D05, 0xF2CFE431F9071246, 
-0xD87F4906FDD0A797, 0x372EC3A022E6A5C7, 0xEFA0A637FF4BE148, 0x1416A00BD, 
-0x68DB7DBA027751CD, 0x3F786A9D3021A4B9, 0x4EC5F1DC00C0F8C6, 0x61FD5D4529615BEB, 
-0x81C8F7557371B72C, 0xEA081B0DAB878904, 0x39C2AC4250BF3586, 0xEF0F03A8AFCCFF99, 
-0x9B949CD8B5507E6D, 0x2305191BA, 0xE442917532E5B009, 0x5ED05E484675AD41, 
-0x16344122E528044, 0x666594B2E4A76451, 0xA6FFB9C578CF29E3, 0x49174F7D9B71EFEF, 
-0x4B286C637B3ACA18, 0x6F9D9254141E712, 0x3780056798771EFB, 0x18E833227, 
-0xDD9E4CBF40F7EF41, 0x1BB25517F1947C5E, 0x1E62CF7145E926B9, 0x44DF7B31A96794B9, 
-0x4E80DC6E93ABAA1E, 0xB2C70F18EDCB27F7, 0x6E49573040AC6FEB, 0xE60FDD58B7EACFAB, 
-0x196BBDDE518E4DC, 0x6CBED0A0, 0x29EA28C02AB518BA, 0xB18D2CF19C159B60, 
-0xC7E196F4DADD57BF, 0xCEE4CC67B4D7E8D4, 0x5074AAFE7C5687F7, 0xE48037151F214DF4, 
-0xAA08023E65B8B72A, 0xFD49B5146876263, 0x192870EC54BE94C0, 0x1F01D1233, 
-0x2E5F87A641ED0D7C, 0xABEFEA912D5DC4DF, 0x939FD4F16522B159, 0x8F197A6E70008844, 
-0xBBF511B8C2115505, 0xFEE788D091C3B129, 0xBC4D6DF6E1705507, 0x7A434DAFFBD90247, 
-0x6532483C62FC3306, 0x14FC0C97E, 0xB96231152A3E72E6, 0x7C3B76530A7E3183, 
-0xC241243E76579229, 0xAC737408E99F354E, 0xEC661A9AE1BCA173, 0x2F37D91E4B3A8188, 
-0xF6DF11FD26CF8783, 0x88F2C205A9494194, 0xF383B3E52F6EF014, 0xC2F1A366, 
-0xE176CE469E9F2FFD, 0x27F821F03DEE7853, 0x9CEAD822C787B973, 0xEB932CDD55BB3075, 
-0x3A8CBEAB8EF5CCEC, 0x93103364E89E1838, 0xFA5703218799D74E, 0xA35C07A00D3FFE4C, 
-0x9BF1BDB4C25E2D6D, 0x221BAFA50, 0xDE7F7001B6E1177B, 0x6AE6ECF96EC38988, 
-0x21A5F355C4793B47, 0x64154166E7E63891, 0x6CCB1F8701B2815, 0x5F3E256A0DA4C34C, 
-0xE07980165DABB1E0, 0x7A81A062731FA0D4, 0x6A2189614E0B5E44, 0x7FDF33AE, 
-0xE875AF9E0B9911CE, 0x2B4A3A613FA3B36F, 0x8004083966351A3B, 0x686E9D19FA193669, 
-0x199EF3C2D2B1D469, 0xFF0466ADC1F05AE9, 0x5FFC9683E54FC0A3, 0x16BFAD61D9DC1617, 
-0x9830E2B822904767, 0x23A0BF007, 0xED69C2C543A01228, 0x862A46945D904F93, 
-0x40EF50B924F8E627, 0x45A030B0F4E8F22A, 0x60892CE4F48D67A8, 0x7AE50FD3AE74BCBE, 
-0xE153B99DFF9638AC, 0x5CFFD13A6774B611, 0xCA64E78A0D3C8602, 0x141700F03, 
-0x9C437E89322087B5, 0xB56D213F19393662, 0xCF90FC3A873A365C, 0xA4418083B2CBFB27, 
-0xE656C9049EE229F7, 0x94AD43B3CE9BF5CD, 0xF9569DBEE9AEF81A, 0xB5752C9D442F8D6F, 
-0xF4D9562F76040B8A, 0x234206FC1, 0xB5D56958EDD32B12, 0x6C16F3BD7D855393, 
-0x63EDD08078EB1EA, 0x6AE4E47480449888, 0x3E72426D5E518378, 0x4B5D597A40C2B4CB, 
-0x706C043AF8D96FEC, 0x11BB4825730C264B, 0x2F135B941899EF5, 0x17146C8AA, 
-0xD6D1A1D018F7F74D, 0xD4A4C385BC2C560F, 0xF33DB730C84524E8, 0x605E004FF5CEC53E, 
-0x2034155D5B1D5134, 0x355CE4157E7ABC16, 0xAFAF8E332C6C246E, 0x70CDE1C31A209B8F, 
-0x8FC2BB3BBA475A20, 0xFA02CC49, 0xADB184776ECCE360, 0xDDBABAA3AB7EFEF3, 
-0xB886C5146E35AB7, 0xFFCE28A50002148F, 0xF0A9825AB496BD0B, 0x96028078FD49DDB4, 
-0x16FF7FBA94C87540, 0x9EAFE3237AA228F7, 0x9EBC47615CC1C49D, 0x1DEBB2528, 
-0x4E552A9984E6094A, 0x4CF5446B21E9AB0F, 0x50D30A73AEDA9029, 0xAB7CFD146314D6BC, 
-0xC2B958CDF9D6BED6, 0xC0D477A0A8AF4B28, 0xB5249CD527106E45, 0x149995D1B1D779FF, 
-0x3BAC6759A20DFBE5, 0x5E33B595, 0x4FA0F1C067065BB1, 0x5B0318FDBA599FBE, 
-0x1D5411AF77504C2C, 0xE9B4BA96FDF55018, 0x3A5FD8F6368ABC89, 0xC1658E764187A29E, 
-0xD08FE2099DC585F6, 0x94935F56A7CE6534, 0x84F35A5343C4A7E0, 0x1EDDF002C, 
-0x76188E970A2FE56B, 0xD6A6C9A2912C40F4, 0x291CE68901124FB0, 0x96FF944EF1C73B5C, 
-0x2E1AE2F58B8392ED, 0x8CA2EB8EAEE0746E, 0xB765F488BAA8BF62, 0x9C544ADACBDCC835, 
-0xFB20E2C5F1C50AF2, 0x1536D95F5, 0x89504CB5E831046D, 0xB97F404A0659EA91, 
-0x6D040ED0F3F1C882, 0x18C6D46EAF8A9401, 0x4E28A337C0EB78B8, 0x9B32913557AEC1F7, 
-0xD87F43977C6462DE, 0x6588C75C9C1B6DA3, 0x6DE56034D5346538, 0xBB3CA7B3, 
-0x23BEDD34C8FEA789, 0x4DC1EE2C817C7625, 0xA3074196BAE78ED5, 0xF5E9A4DCFA8A7058, 
-0x172866FE606B28B5, 0xFDD3C96A70C76FC9, 0x38C0BE6FD9FE1E81, 0x6C2084ABF9DED229, 
-0x501AFEF60259E374, 0x24CA4E910, 0x920FBE32065E8D40, 0xCEE6BD86D00168D6, 
-0x940DAAB6DFABE051, 0x7D6D824CF39C2CBD, 0x8D81356C81D7E7AC, 0x1E05EAAED737C9E0, 
-0x84A0CB27DAD449E6, 0xAC2FAAA7ABFF7355, 0x6DDA2FE0FE9C4D54, 0x2D299C6C, 
-0xAB82D6298781020B, 0x4BE6C1BD3B64E293, 0x6E9BE90328CE679F, 0xEF500E99295F6C11, 
-0x56024C47312548B, 0xFB986322F3C6B34F, 0x971C11BD0AAFCD48, 0x5D58EE5AAF98D845, 
-0xE39B31AD32446A9A, 0x61791980, 0xACDCA00FC2E38252, 0xBB15AD4FEA231FAD, 
-0x69AE0D26BEC478A7, 0xCB48D79B53619F5E, 0x1E9C416A8B171119, 0x958F8BC58C05B298, 
-0xDA6B62799A150EBD, 0x1036C4AF1DA0F243, 0xDC65F4399098DAAB, 0x51C56A2B, 
-0xEB5183D67B3BF326, 0xF49B027239869D41, 0x57DD2B12EF1376D1, 0x4401C196E7BD99F4, 
-0x64B0D99B5FBCFEBE, 0x6E15D0A10072EEC, 0xF41EBE54D192A622, 0xCF4D83EF799D1DC4, 
-0x914A0EAB5BECCFAD, 0x23BB86A30, 0x3D9EE5FB6C515FA8, 0xB798995B23E58002, 
-0x6C383305D5B3547, 0x35F043D56B7DC5A3, 0xE5CB68B9E89AB123, 0xEB03B63ACE72D5BC, 
-0x29D4B3B6706BB1A8, 0x572B5416A9C65473, 0xB28284E614E9C3EE, 0x8DD70E34, 
-0xEF57C4D28D1ABEB1, 0xBF1547A9DAD7A67E, 0xA4596B8E44E4B44F, 0xC9E07613CD18D1C, 
-0x2406EBE8F08C9864, 0xC4DBC559B9464684, 0xE8CD062625C4CC20, 0xD312068D85C39C58, 
-0x988E169C1B1279BE, 0x1E35FEAA7, 0x9B4003D17B3809B1, 0x91E89CA2645864B7, 
-0x5CF604B533BE4FC4, 0xC773C11199F29A65, 0xA1AAB99BD63EDC76, 0xEA257619D1967E96, 
-0x9F893B98B7B662AE, 0x3F94D643D2AE1B82, 0xC4E1891FB3059F3C, 0x19B64EC54, 
-0x15A01A98DF34CAE7, 0xECA38F8CAF62521E, 0xC08995187D1798BB, 0x4C1E3C5A0D08F6EE, 
-0xE3200228CB9B7F6D, 0xEE85A135B4451912, 0x21907A7AB4305721, 0xF7364FDE9C72D1D1, 
-0xFA8C8CFF0EA79926, 0x21A7FAD06, 0xDFC9372FDA47CAAC, 0xCC7FF71BE59B18CA, 
-0xA4EDBB06BD7D2E5C, 0xCF858D9CAB8494D, 0x32AF29A4433511F7, 0x12BB463425077D5E, 
-0x648A8FBAD7F6CAE6, 0xEAE5A8B602533AAD, 0x31B2267D4C019C17, 0x24CF462E1, 
-0xCB2DAF9BD69F9956, 0xA93CA34909A762E2, 0x74F63A79993F8FAC, 0x30A16A885ED0A518, 
-0x10DBD64D9F8E9F82, 0xE2E999921E995062, 0x505B042997F00394, 0x417D59A1F8F3740E, 
-0x537FEB33B69287BB, 0x16E1591B3, 0x857D1F27DE9F0EC4, 0xF9CD18596B708959, 
-0x3FDED786DE34E281, 0xB3B2638DF8C24B2C, 0xFF2178AF38F5EEF8, 0x62DE4CB1B1894B11, 
-0x7AB8AF6F2C13F8EE, 0x23F522A37778A78D, 0xC82F3E37D4C32F7E, 0x137A2AA2E, 
-0x781B282B0223B8C9, 0xF9A649E907939901, 0x9FBE810F70A767FE, 0xFAAEFB192DC4870F, 
-0x7FCDFF7B14A2BFE3, 0x43E78B86D65B940B, 0x8D2864955E432406, 0x6C764159402317AA, 
-0x10754D108232DB0A, 0x1AD067921, 0xF0315FF3A89EAE28, 0x4AE38DC9B1E53BCF, 
-0xD1910E84FFC15CC5, 0x6B23F22B7BCC102C, 0xAFC7EA7C8C15543B, 0x545BD77D2D853A96, 
-0x5A5A2484BDB196AE, 0x9C9779DC9B65512F, 0x7B8EA8F0974942C2, 0x318163C2, 
-0xB8B0907278046F81, 0xBECB9CB2B4CDAD4C, 0x6156B2A94942ABB6, 0xC083989990324CD3, 
-0x58FF83DEE895775A, 0x5F74CBFE587353D8, 0xA74F4D46B24A02D8, 0xB3CCF85E8F5DD079, 
-0x641A1C681FACA4EF, 0x197D327E7, 0x9E0A7555AF7BDBB8, 0xFB8C755B3912CE8E, 
-0x19010324DED045E, 0x286F23EBDB12C529, 0xB2D1BBFF2E9E5A49, 0xEBA4AAD84F6B70F, 
-0x20BFE5C6F079C415, 0xEA41C64025CC8658, 0x575CA39770302328, 0x1CAAFAC1C, 
-0xA9C83309D1C34ADB, 0x6AE3735EA32A2130, 0x3469EC2AFA7E4982, 0xA8F2A743091C270C, 
-0xE68EA6EAA7ECFF18, 0xCA70CBEDA55307F, 0x680AF27575056061, 0x16223F5AA6D41D44, 
-0xDFD85084008635DC, 0x25F2721FE, 0x6FD7C1D9629FA029, 0x3FA51A99305DB201, 
-0x8C4956254A7887BD, 0xC683F95DA3F4F47D, 0x53A396904388AFEC, 0x997DEA864B23061, 
-0xACBDAF41E02CF541, 0x11F9EACEB056C41B, 0xEB017932B8DF8F58, 0x16F317A56, 
-0x14C239A19CE1172E, 0x408FF6B7040A6058, 0x48EC989D95C64BA, 0x9FE1171BE9B0ED76, 
-0x1698BCB332BF5874, 0x2AAC0E0D3FA01C9A, 0xE06AF58C026A2663, 0x9581E5FCF8325CAA, 
-0x3D70358F9A36F23A, 0x1E0BC30F9, 0xE354538BD211DC02, 0x6A80FEDF41EC1AE3, 
-0xFAA5B38611A65C5D, 0x8F73C4B4E9C502, 0x8D6D8FB10E746830, 0x97F01A4DC276F7D6, 
-0x66B397BB03D6800B, 0x590338D94DC04A1C, 0xF1B391A4F911A6BC, 0x17A9E0338, 
-0xDFF572C33910063E, 0xE0BFEB6FE7A85EC6, 0x19A9DC629945A813, 0xEB51E7523B3726E8, 
-0xD4F149EB3C922F7C, 0x628FB683EA8C8958, 0x9670EF857D24A4C9, 0x5471BBF65360FDF7, 
-0x343C90C0F48984C2, 0x233EA9128, 0x6E8A039D21E0B3B8, 0x5D625BE6E52A69E, 
-0x489568BBB6056894, 0xA7FB93F96F58E849, 0x60A7931D9611F66, 0x26DA32B6919405E0, 
-0x7D2ED26ADF4D92CD, 0x81F1EEBD27896912, 0x6D45B054598B26F3, 0x1D0B5F82A, 
-0x11748DC5296BD163, 0x96517782FA90E35F, 0x9C71E125BA19591C, 0x79B08DFFA27A5FD9, 
-0x7B07728BD65D967D, 0xD73D57F2C2C0ABD8, 0x879B7077414F5DE6, 0x119D9CB1DB220457, 
-0xF4DB07EB8CD9E563, 0x11A9B336E, 0x6C2572B494DADD99, 0xC38EE55A790F9DB0, 
-0xE533B855C09272FC, 0x80CF5D3BED8B13D4, 0x100DBC39F458CE16, 0x789E54BDA30E1884, 
-0x4A71FD0CF94329ED, 0x783BA576EC4176D3, 0xF23BCBC7E30A010D, 0x1D764BBA5, 
-0x6DE6FE104BE4582F, 0x1BEFCD22BF29D74, 0xE55A1E00967F12D6, 0x37AEE30C2D05190F, 
-0x8417D1DE284F00DC, 0x83C0FB3A578D0044, 0xFBFFB0C11EC87A96, 0x728A24EB639F3197, 
-0x6B223A0D03842234, 0x176F47EDE, 0x5469B1732D0BA298, 0x8CA4C7D5640ECD20, 
-0xAE57E31EB6448EE5, 0x6789C8473A39F3EE, 0x427A69626643D4E1, 0x12633030BAAB13C5, 
-0x4CD030C5F4F5F50B, 0xBBF79C60EB311115, 0x8BDE8974BC00D8B, 0x224241E65, 
-0xBD5B0F0046AE6DF8, 0xE54AA5D0BF95C9B2, 0x8F1E6217D4A182A0, 0x9B9303CC42BC8B8E, 
-0x5E3554730F04FF74, 0x75FD913A94DCF4E0, 0xFD679C99E57E2C38, 0x9CA3718418EADD6D, 
-0x54B563256B2B83E9, 0x23BEAEBFF, 0x320098EB1BF19045, 0xBDA8AAC734C0E392, 
-0xDD8AAAD93432AD59, 0xFF1D887738AA4B02, 0x7CCF83B762E7FA9D, 0x451605A66FF42B25, 
-0xF813C8D42B49A95F, 0x3713F244B1E3FD4, 0xCE6DF595A1A65C18, 0x1BCF7AA87, 
-0x67FC559E500A70F4, 0x993075A44CD405B1, 0x4F3B3B1573838C9F, 0x9629B9F12DC48E47, 
-0xA707F329D1690EE7, 0xD1E0B09A16036EA8, 0xFB0A053910F944FF, 0xE5AEF72137B317E7, 
-0xB30AC357FE44BA64, 0x729628BE, 0xC31A981BDBC816DC, 0x3094605B5D045E26, 
-0xEAE717DE9805E011, 0x28EFA9154DCB955F, 0x9B7394C425BC7D05, 0xF8F9C66DEF48CF05, 
-0xC2AAC728207102B9, 0xEF5C0D430B7FB329, 0x5ABC2F5A04BA84A6, 0xB75BC8B9, 
-0x27B83E9D1C9D51AD, 0x89ACD7B076F3A676, 0x33DB2DD25142B314, 0x42E30CF592FA2DFF, 
-0x8C5FDD6AAF781484, 0x9826E3E53A8A5D0D, 0x6EA9DE5D1B647A65, 0xF781E1FCFFDE80A7, 
-0x2FCE0FBF53F2896F, 0x174DE5D9D, 0x8297594972F9A028, 0xA8D96A59E91B8643, 
-0x424F76AB9949AFFC, 0x1811A4FE3F6C299E, 0xB6A14702D60EA272, 0xD5BFB714FAACFDFC, 
-0x6FDC4B412473AAD8, 0xC27FAE014B464D7D, 0xB36684F044CE78CF, 0x13FBA2F73, 
-0xC8D8E7DD09CFFA1D, 0x3F7C72FFDC4DCCF3, 0x8A5E52B82A4663C8, 0x80C3EE40B8F8C3FC, 
-0xC4F384D160C1456C, 0x599B56B4C8936677, 0xD27927D26A74316E, 0x8297D84F6A08F43A, 
-0x3546B0EE3535BC1F, 0x6F750A96, 0xD6FDA1E45E0750D3, 0x47094FD382D0DD74, 
-0xAF8B316831AFC9F3, 0xB0221B7072A421B2, 0x1221A2AC9DA81E94, 0x7A0A544F85165028, 
-0x62BA0EB50AD4A939, 0x92341880FFD262ED, 0xA9FC08B78D2C22D6, 0xE574BE12, 
-0x202B334789BFC8ED, 0xEED2419784174782, 0x5E7B511F23A9441B, 0xE0E1801663FC656B, 
-0xC19CF0DC679A7BF6, 0xD8F508806B18A31B, 0xF5160DA30DBDA2DF, 0x7144A91DF3B51293, 
-0x5729910F36A1E553, 0x2469979B0, 0x58AE51CDC0A294C5, 0x91196235CB03BF3D, 
-0x96B3D6A76EDEEDE, 0x19F184499331F83F, 0x9C4D687E6778F46A, 0xE6BAB2C7EB473ECA, 
-0x443256E2E90321A1, 0x792824388CDD60E4, 0xFE459D3A9DD773FD, 0x1F7568F26, 
-0x301B6D5C99974F20, 0x111A1CFF366715C, 0x89D0D211D070D2C9, 0xC806D3100C8C4CCE, 
-0xA57CA5E8C1FE3CDB, 0xAC62CF7E0F997004, 0xD37F051B7113523D, 0x631478709E60A906, 
-0xD3DB854FF058678F, 0x19DAE18B4, 0x31E8DCFEEB8835FD, 0xFAC00B99E0B82F58, 
-0x9984203ADD43EA94, 0x9F3468E92165A598, 0x7146835EA19B6DD1, 0xBB1AC4EE191F4827, 
-0x2A2422BC299C5A2B, 0x91391771BC74E204, 0x947184F9DC3A1D1, 0x18A870B29, 
-0xC288C0E4A0864B70, 0x8F5E5681F46A9538, 0x1D9BCEED9BD62415, 0x92ACBA7D87F2855A, 
-0x75018468402A7901, 0x846EE2BFEDE45198, 0x626DF13CA95A15D8, 0xC4FF4B58CD20F946, 
-0x356253009302958A, 0xD858E76B, 0x4DF9C7070144B3AF, 0xC1BA69472BD12949, 
-0x1CC12B7DCF1C0AF7, 0x3551D992D87BBC0D, 0xFB0D922A4027B50A, 0x8C92097833C2874C, 
-0x6E9A2B3AA7EC35A4, 0xA6CA662F8D5DD71A, 0x57FCB0762B6A81F6, 0x20F6EF7EE, 
-0x3C48437D4AC79BC3, 0x5F54AAA51D6A7EF6, 0x43AF1132EA20F59C, 0x36A0BE3D7DCD65B9, 
-0x99288A0093AC3EE, 0x79193DF5ABF99D9B, 0x9A1D62C90EAB909F, 0x7DEE65EE189A5E73, 
-0xCED40DC2AAFCDD74, 0x30C5B354, 0xFB7A3AC294CEC31B, 0xB6D8F5D8A86EA6CB, 
-0x1CCCDB83E4954413, 0xA34A6A5B8E3667A7, 0x37ADCAB5E250B8C6, 0x676FF06AA268DB27, 
-0xA0C2114CE8E6D9F6, 0x9FC4822B87A4987E, 0x87DFD12712A7AF95, 0xEDFF2D32, 
-0x2A0701048B5F68A4, 0x8072FE83E521A20C, 0x3ACDA302AC64A660, 0xDB69BD2B03ACB938, 
-0x50AEBE3916D8D571, 0x70A5176F6DD64C4E, 0xBA5088921DBC18EC, 0x9D673AD249CD01F8, 
-0x47D90246869EFD7, 0xB7036A4, 0x4E2DF8E0EE92EF19, 0xD618D8EB360B7218, 
-0x4B246CE8A79C262, 0x39C8EDE26CC4FA6A, 0x61294F6BF2FE4380, 0x64633951E23B485, 
-0x19D172C3C3E34D05, 0xA6DD38F92FDB219, 0xF05B1FBA341D1583, 0x11C711EA3, 
-0xA6D410650299077B, 0x6216CEA48C4B02DF, 0x6AB1EDC0C1B13D57, 0xA82BD9C0B4EF5B76, 
-0x152CB2A360008A5C, 0xFF39A47A9051F2E8, 0x25DD5ED2D60FA235, 0xB274764634D6B4FC, 
-0xF8FF27FF02812381, 0x90434D4D, 0x1D1BACF77D6EF876, 0xCFE4A57749C2E2D2, 
-0x6B972F0D5DF60119, 0x6CEFABD663DB498B, 0xD41E6507171C840B, 0xFA08FF8BFC05765F, 
-0x730CFC97ED73BFFD, 0x6C8B3168D4CE8CE9, 0x5EF200E9EB1C16D7, 0xCEED4D26, 
-0xCA83FBFF43D9A671, 0x25C5F78B615DC0CA, 0x5DD9C1F10C12AD3B, 0xF0BF0CB4E5923B2B, 
-0xEE5D4074C3AB4CE, 0xF87EAA6B37D990D6, 0xBB639B8E34D5A8BD, 0x3033815B610CBA84, 
-0xAA29A909A5BF1CD5, 0x3BDE0F99, 0xC4FE336001CE3BBC, 0x9B334C7C5BC7EA0B, 
-0x151F07E8350B9914, 0x167D2E61C3E0D713, 0x90F2116B90A49417, 0x758B80EDB441D053, 
-0xEB227E8A2ADE1E8A, 0x8FE1ECDD8791D1FD, 0xFBE7496D8B1CA54, 0x26EF58782, 
-0x218147A36F783C94, 0x6DAB42224F8747B6, 0x560CC3A897577B5, 0x4AC1E6F8198EB265, 
-0xBDED859E5967B32F, 0x3828215D31E12FCD, 0x91263FE0AA8E8504, 0x6F8ABFF28FF97378, 
-0x61B45AC59EB15831, 0x12A50E775, 0x5C57E6046B28094A, 0xF5F70FE8A53E2ECE, 
-0x3FDA6D2FCB722601, 0x2026F5570274A78F, 0x1181569F4C1984C3, 0x723857764440973F, 
-0x1F024EC28FCF3FA4, 0xAA60B9C80F5CD6FB, 0xB7A6F2B65910D77E, 0x175E6B188, 
-0xC5252B05C13802BD, 0xE0A0433FA5D80F8F, 0x2F64EC12DBE896E3, 0x63925DE7DD00255C, 
-0x4057A27A42462D41, 0x4639C306DFBC7B0F, 0x21B9EFB211F2374C, 0xB419EFFC2D62F984, 
-0xE9401A3BCE0C9FBA, 0xF28B3024, 0x7421E6B8006CBB4B, 0x7ECDAE82CD54EAEF, 
-0x630B562C9B352212, 0x4DCC143E5F8C595F, 0x88DE28211E6D37DE, 0x8E8B26B8FB8DF428, 
-0xA17402847F73D907, 0x921D359EC26F5BA2, 0x164D0EB083D5FA38, 0x240AF355D, 
-0x12AC71F1A9F0343C, 0xC6963E7AC33BCDA3, 0x773B8FFAFB1CAFA4, 0xA72ADEFACBA9CB52, 
-0xCF151B64B8E17A87, 0x6A1E8CF554A4BEF7, 0x9DD86DFE47B44419, 0xCCD6C689FBFDD8B4, 
-0x4A16809BB45F188D, 0x11A88F995, 0x69DDDA9F8BFA5A11, 0x451ADB53840F4624, 
-0xB5750242A7292FA5, 0x44199C356A603123, 0x74E69920197F2D87, 0x86D3DA84D4A79AE, 
-0x1C08B40A24EE3E4B, 0xB2C19822F45ED2AE, 0x204C85BAAD52B1DC, 0x247D4E2E3, 
-0x2A3989643BC08278, 0xC7E8DE7B8CE8640B, 0x9967DE613771DF9B, 0xF16809E27956A9B3, 
-0xCB5813649ADFD4C0, 0xFF35B7D9C28802BE, 0x7665F035981D47FB, 0x4F4692835540AB1E, 
-0x1DB40BBEF7F0E41D, 0x1B5EE27A7, 0x8795EA865F348911, 0xEAB4E029B53A5C4E, 
-0x985742420DBE144F, 0x959F9A8EB3D5DB31, 0x8716D7CC6C051641, 0xD2DE01BA188B1F37, 
-0x94EA2A8250EDD5A2, 0xDE376752D8C3487B, 0x1C817961FFADC597, 0x1D508B858, 
-0x98407EDB6854D0CB, 0x57D261823685BEE, 0x2E6335EFAF1483DF, 0x63D79ABD60FF932B, 
-0x4FFB35A495A944E0, 0xE66F3642957A73F, 0xE317A02F0244A327, 0xC5534193FDFCA0E4, 
-0x986DBE254A450B21, 0x20612BBF5, 0x4836B8891FBEF640, 0x4FD0AD95F5842F40, 
-0x831A934E93FA17CE, 0x670059AC69D8BEB0, 0xA37498D30ABB5285, 0x5583C574F9F6B70A, 
-0x9D66A4CB27FA5349, 0x408180DAAABFCCEC, 0x21A0B9525E40B08A, 0x45EC3A3D, 
-0x8B85E1AC8E0338EF, 0x64DF519DED575D44, 0x3E287D498522BFF4, 0xCE6CBC6A3975EDD, 
-0x8E486D6CC6DA216, 0xBCB5D8D9D77B4193, 0x5DC9C74E69DB119D, 0x71716840727972E2, 
-0xA20F0ADEC6479EDB, 0xCFAF0714, 0x745BE2E54AFBAB82, 0x53ECE6A5E99763D0, 
-0x2CDEA7FA0E0B519D, 0x82E4C36E94402538, 0x9617F237439D02A9, 0x95B435E7F63F4B4C, 
-0x66B573F88FDFCE8B, 0x9381087DBA20C0CC, 0x45FCF291433BA8C6, 0x1438E3008, 
-0xF66E9CC90104DC75, 0x356ACD2730C1B10E, 0xD64AAA5BDFE3DDF9, 0x77B8BF172DC3B8F9, 
-0xF40FE89FF571D75D, 0x7BE8459E2ABBD7F3, 0x986637C5D6CF2EA6, 0xB4209411C22F9F74, 
-0xC947B3FBE205D164, 0x23A59B373, 0xEA5346293B7B194D, 0x9BC400627AB70956, 
-0x4620CE231A5B8648, 0x70782AF0D9B9959C, 0x8057E5763F3B55DA, 0x2D7190EDF283C804, 
-0x8DC5A9E53AFCDC0B, 0x2B4B722EBEDCA2C, 0xC6BA4CAC55359EA5, 0x2370C517C, 
-0xD52C588D50B28025, 0xB132D22A0BB0DDC9, 0x3DF5549F3C90DD41, 0x7458BD8F654F1C07, 
-0x5745C41EC43B74CF, 0xEFD3C18DFBBF3CBA, 0x4C958C2FD1FD32A0, 0xCBD08ACAE9919CE5, 
-0x3F24BEACCEE51103, 0x9BA51569, 0xD5666B28351C5329, 0x3896C7CD08D6B4C0, 
-0x24538E6AD7CC1098, 0xD7550221F2910F69, 0xC857DFA7D61ECB27, 0xE5FFDE29B9A50A42, 
-0x37618AA36C278FC9, 0x2FF577F71BE05B8C, 0xF5353E5CAA0E4D33, 0x51B7C470, 
-0x791C0024945E2B7A, 0x6F674C53EC61259B, 0x988CF5832E6F2346, 0x3CD82E81662B5B03, 
-0x557F8CB1B47AC1EA, 0xE266DDF72AC0F8D0, 0xB18471D41A53FDB2, 0xA13E3B18626DB20C, 
-0x8E26E8115AF52765, 0x2421E71E8, 0x9268E604AEA9485B, 0x25A9368A1F8916BC, 
-0xAB981FE38E0577C1, 0x51F715D6C5FF090E, 0x305DCAEE3EB174C2, 0x57628DF73C056AD8, 
-0xC27D1312FC1E3438, 0x55D7E11E1ECDB988, 0x23FB720E50E66622, 0x1D89D369C, 
-0x41E4EB3F43293E61, 0xB4271ED75ED52918, 0x42DB6A8FE525D56, 0xABE9B9EB290F09A0, 
-0x8DE8A49138E3C919, 0x7300035A5BB7ED63, 0x279BB94BFFA1682C, 0x9F644B8B9440C38F, 
-0x9CDF007832260B25, 0x79A9BCB2, 0x119C2041AC909E62, 0x4BF060C3938E889F, 
-0x514CB1DA55B75032, 0xC27DC3F424BBEADE, 0x6B1B5934FF89E8BA, 0x2D41BCC9D9D3189F, 
-0x326E40E7AE75F3D5, 0xA3233B97BEF40E2E, 0x90CD2757C61B8DFA, 0x1D6E32BBE, 
-0x266ECAD084C8EC12, 0xFCCE737C3293F67A, 0xFF9224C9021155B9, 0x11A7651ED002AEE9, 
-0x729287E3EA70FFEE, 0xC37B20E304CCF80F, 0x70E99ED1EAE6FA5E, 0xF1363438AF993F60, 
-0x430B70F2380D99B0, 0x85E30197, 0xF73E643696437E42, 0x9A1B82D137F4AB5D, 
-0x51968EC667FA5C04, 0x49D6266D25FF9327, 0xF89524D7C63EF03C, 0x593F3DF557CFBAE9, 
-0xF43E3A2F0F2B5A67, 0x66B91D7D839DB1D5, 0x6C433CA9896F8BC9, 0x111E8E6D6, 
-0x1D44BE5872165B34, 0xC9194E7CD84893F7, 0x4F9EF034D937A84C, 0xAE1558C89986ACFB, 
-0x5BF9EAF6DE88C10D, 0xC38FE710F3CA0805, 0xEC198A67B32EA10E, 0x4B0E791A6058835D, 
-0x1714F7C0BAFCFC82, 0x97A2C2A4, 0xFF7AF71C6586EFB6, 0xD5D22013A9289D54, 
-0x22F0909A5384358F, 0xA6FF0FC370A3C097, 0x88DA095CAEE5396F, 0xAD95A39B8BE08A93, 
-0xC178DCD29671A96C, 0xC71CC5EF0418BAEE, 0x22885A3F1875F52D, 0x13FAF06B9, 
-0x43251586C5F689CE, 0x7A28E0098D46BF77, 0x3E02BEECB2077B8, 0xE77C00982E7368FB, 
-0x4B24377C4D72BFDB, 0x4887D5BB49B5B950, 0x5E184E454161923F, 0x4FCFB8B0B6AFDC77, 
-0x1CE5CBFE1BDAFD12, 0x9EB2AE8, 0x56249D119CF6B3C3, 0x9861FF7FC870C6D1, 
-0xA1E26B29710E29FF, 0x37875569CD465AF0, 0x3CA0DE9ED4E2B633, 0x3287B0D05AC2E7A0, 
-0xA953BC8F64A9E2B8, 0x367AEC3E25EABE07, 0xAEAC72B52AAED0AD, 0x25A302ED5, 
-0x2AECE8F919A1317B, 0xC0753EC598D5DD9F, 0xF3D64849C70C2756, 0x5AA6181172A63EF9, 
-0xB41D418377A1B63E, 0xA009007CA89F5C06, 0xE22BCC300E4EE732, 0xA00BB35F94AAD948, 
-0x28196A8571539FD2, 0xB9E0F88C, 0xFF4482CD322E4822, 0x1212E5A50B99CE81, 
-0xE4C0DACAA3941C15, 0x7F27B7AF7CD4A7B, 0x5841831CC5A062D5, 0x8AE2C3E899EDAE0A, 
-0x89A493137A5FD632, 0x5C5C3AF74044D070, 0x62DCB52612267D22, 0x1D595BD1, 
-0xA587D9F99230CBD2, 0x2229699F1560EAA6, 0xB2F8D519380E19F4, 0x2EB4A7383CCEF39, 
-0xAB6456626CACAB80, 0x9EEFFA90FED800CB, 0xF1DD64BC86EA6E6D, 0x19C49EF63DD03A19, 
-0xFE002D972C91D5F8, 0x23CF59964, 0x4A6229E6252B7F62, 0xB596CCD696BF462, 
-0x824DACA5C3455AD4, 0x88EBFBA1E9FC48EC, 0xDECE0FA4F24B1EE9, 0xC2AA6130FAEAA310, 
-0x791853FC8B0D64C6, 0x9D076939F8846016, 0x4804F51CB6E0D9D3, 0xBF237C32, 
-0xA34DF522AF1F31DA, 0x3503AE8E79040FCD, 0x6D3B7BD6A9DF59B3, 0x705DC18CF2A0812A, 
-0x87C49BE9933169FF, 0x20184419A7F8DFBD, 0xC8D0FCB55920880A, 0xF261DDF9CC89CFF8, 
-0x7F660CC16177D288, 0x234BDCF1C, 0x664C872243F1792E, 0xF2A606360F560095, 
-0xEFFF6D79B203C922, 0x574F8799D7AF7F79, 0x5CC9B517EA3FC415, 0x1D5E0DC796B0AA2F, 
-0x2BD5F918979E31F7, 0xC6EA05445678458A, 0x9C524D1BB437C66F, 0x61AD7CF6, 
-0xE7C7EB3815539D8E, 0xDF508AAC563F5362, 0x207B69F6D11F80CF, 0xD0C241D3AD93E32D, 
-0xF8B1CDC326F08290, 0xCB397ABAC1D0A028, 0x75F41D14B6995C3E, 0xC0A79DB287FCA16C, 
-0x66236EFA486366F, 0x211BBFC95, 0x2FDE86D0957EA341, 0xE89E0F950A61E48C, 
-0x5AD034CBB60B27A2, 0xB8639078B5BFCAC3, 0x268C0CC5B644261C, 0x680EC37BF282E922, 
-0x5DEDB8D4A3D57C8A, 0x57B4607F110EFBB7, 0xE4A9FDE001BE7C16, 0x2250FFF2C, 
-0x7AA9C526C7AC005, 0x5D12A64C7E184C57, 0xB9C122C9FF26B316, 0x364BFA563817FA72, 
-0xA6789E6746ABBF5C, 0xA387D17207562778, 0xCAA7A0EE52992F11, 0xAA6A949C5E172D77, 
-0xE39BB30C6E5FF779, 0x1429AE5E, 0x8CCA8D7EB5B85C3, 0x245948045A2ED3D0, 
-0x83F2C95F96BBCA7A, 0x56631CAFB9FA15BE, 0x5A5450225CE4A19F, 0x670938ECA7A27D92, 
-0xA3FE0CC39C041375, 0xE0A30971C511A60D, 0x88BAE15BF83EBBED, 0x573BFCC3, 
-0x3E606A206C5E771C, 0xDF43A11DEAAE4D96, 0x23A2F1F828C081A0, 0xCD9C414E39F0C445, 
-0x4717339DB2146238, 0x6F3298E5D6B6FC46, 0x852086DAD113908A, 0x3E75CFC7EEA2B43B, 
-0x7156250362538E62, 0x10B33C925, 0xD105EBA4C0CF4851, 0xE30FC85E2076F3B3, 
-0x428C9FB16E61121E, 0xB4781B32D958B70, 0x829C20377FBDFE7F, 0x73F533CD5D098F4E, 
-0x8CE11A9C9438D765, 0x34DDE99EE14CB8A, 0x8FBA553B78B8FB63, 0xBCD130F0, 
-0x83927C279C76A975, 0xFB3BFE472F863217, 0x280DF2CE2E523AE8, 0x8DF6E9A5225ADD89, 
-0x680937A628EBA759, 0xCBDD0E7ADFD447A, 0xEC173A3C2A18F445, 0x8655297E8555CCC, 
-0x3F9BA40E2A869708, 0xEA4CDD9D, 0x32AFF6AB34A264A7, 0x24E64A6C6E1DD456, 
-0x293E95A1379A5615, 0xE9BE736660AFFB48, 0xB1D0212DFE4CE20C, 0xC1205296D0E93277, 
-0x6466CB1CDDA7624F, 0x7FBAA9FBDDB33B9, 0x7299CD7ED5555F5E, 0x16B76AC52, 
-0x13FF2110EC65A70B, 0x85F684B56CDAAA95, 0xE8B85DC5A264BF62, 0xDE52D547EE14DB54, 
-0x8C2554694FA8B351, 0xC9A11867BF724EE6, 0xE58133F42487E782, 0x1F8B0476DE398D2A, 
-0x278BDDD5F05111E4, 0x12B0D3DBF, 0xA64CE8CA1506B898, 0xFB955AEB6757BEB2, 
-0x9C271022CE8860B1, 0x35E08AE36C5F8C72, 0x4F59DD0454D6B2B4, 0xE32833C9AF1AD9C7, 
-0x5532F8D6B9707713, 0xC7F4DAC8862F3B05, 0xA09D5D33759B181A, 0x1E7F2112B, 
-0x39FF49FBE109E2F, 0xEAE4591962272C5E, 0x7821E98D7C02540C, 0xC84EEF2B410C325C, 
-0x8524A7B8463ED792, 0xE5F9067D993A910, 0x1742EBDC72C1BF43, 0x69079CBC2D1187A4, 
-0x8060BE1387914F7C, 0x2202AB04E, 0x178ED5B8C712C7B8, 0xD51E12DD2314E820, 
-0x78FEC1F8E809AFC4, 0xE18A12B92074D731, 0x4D361A835DDCEC70, 0xD3F45B32C343CE5D, 
-0xD3CD4C71F5C12AC1, 0x92C904655CEA2B1F, 0x6BF64C09658D10B4, 0x27A99B4AB, 
-0xFDCCBA4FD28A26E2, 0xEA2471BA83BAAE96, 0xA9316D8F5F2C8276, 0xE188A8F3A3FC2A1A, 
-0x6C742F2B34BF2847, 0x8B1EB22BB41D2D94, 0x7CD4703FF5549B9E, 0x1B199205FE159096, 
-0xD30A2D7E9778D66F, 0x1D5537AA7, 0x1C3A0173EA32DF7E, 0xF99E61C97FCE825E, 
-0x3D5F40854720D022, 0x683535BF7EDC529B, 0xCC5EC2F5E910E942, 0x33612E2C99D2A84D, 
-0x5EF7611639A6ED40, 0x252246568C8DF4A3, 0x4429CACB825A3086, 0xAFF093A1, 
-0xC6CF36128C79C748, 0x429B6AF068A2CF1D, 0xFFF381A3BB8577D8, 0x7589BE1EEA442E99, 
-0x5E75EF2428218602, 0x9F28C64984A756F8, 0xA4482923E606F872, 0xB9F130309EEC3FE, 
-0xDABA9F9BF101A07A, 0xFEB3E44D, 0xA0D1BDE3ACE1D78E, 0xFC01F585E539C7C1, 
-0x5D5E991C426B553F, 0xDB062B1747E047B8, 0x9CCFF6CC1499947C, 0xD7A249071DFB0AF2, 
-0xF83B3D4AA5C991C0, 0x76B1B3110354D62B, 0x3D087CF8286FD69B, 0xE15E9424, 
-0xA3AB7114A31766CF, 0x250B3093220A190F, 0x54CFE35ECD40113E, 0x6F2B24E40E416D7D, 
-0xA32FD3DB641D2EA0, 0x4EFB76D380EFA6C5, 0xDD0C335266246DCC, 0x2A4A79FA96674618, 
-0xD62E8C5851E5C43E, 0x125438C53, 0x4B4F46DD9F1E6FD4, 0x2929D2ABDD42B8C1, 
-0xDBF3B851CD7B362B, 0xF15177B822E64D8F, 0x2645814FDB2EF785, 0xCF7B1CB534B58105, 
-0x8731A376CC6CB84, 0x45D8D248572C043, 0xCE2841E83AAF3D93, 0xE296CE6E, 
-0x9DE7A1307DD7D792, 0xE498570B8230B5A4, 0x55C2623A30DF5B99, 0x727BF75586ED994B, 
-0xA3A993AFB291941F, 0x562F2CD8BB13B1E2, 0x6A843D46B29CBE26, 0x25EAEA84953B53A6, 
-0x16DCB295691C5E83, 0x60A4C84A, 0xAEF84AB02B4425C5, 0x817460C91A807379, 
-0x10372F60A8719F9B, 0x2204E7EA299F07CF, 0x1049160FEDF1C12F, 0xB807E91A7D3363E2, 
-0x65458F7A69EECD2D, 0x65A6016AFEF20014, 0x9C34FD3FE60D9518, 0x7D6653B9, 
-0x814376136C0837C8, 0x74B7059DACC571FB, 0x5A1922CD88B1F7E4, 0x6F110F0E14C81893, 
-0xB07F2DCFF64D79C3, 0xEA1D7480409EA60B, 0x386FDFB3F0264663, 0xC529CC1180E174FF, 
-0xC55A81FEBC9916DF, 0xFEC5BD49, 0xD7F7DE5DCB0EE710, 0xD6B4A4FBF0C9530B, 
-0xB652AAA8D57897BB, 0x56390D282AC7D621, 0x3A794A569E859F27, 0xE1EFFFBF2CC6A097, 
-0xE41288280076D97C, 0xE5F50B1619BC3B4A, 0xECE4F386CD423D84, 0x1AD0B6F13, 
-0x73E566007C659926, 0xB21CA60BC081F23A, 0x4422B3B01AF3882E, 0x90C44FBD73EB6133, 
-0xA3452F307B6645F9, 0xDD68B1F8B2CE4571, 0xC58A49062CD87E95, 0xBD5FBCF05D7D0BE, 
-0xDAB0079D1213AAE0, 0x1A3FA0BE6, 0x4FF87F89A923E46C, 0xB7E4D9A84A418E5B, 
-0x550A6173CE8AEB93, 0x1B1A519EE8BDEB93, 0x8EBBD816B23FE058, 0x43C5CD725E5C333E, 
-0x8A9EB9E271695386, 0x1CAF445BFC26DF73, 0x1FEF4194A363448A, 0x19468AC99, 
-0x8B48B592DA35D86, 0xD71EDEE07144A97C, 0x81C5849613DDBEE5, 0x60D9E0CB3166B468, 
-0x71A4251729198B60, 0x36C528220831B43A, 0x4D4B7C731B645E09, 0x2280B1B32EDEBF0, 
-0xE7033529CA29AFCE, 0x1B6ED41C4, 0xA6719A8408352647, 0x149436BB27476490, 
-0xEB8B144CFFE35AB3, 0x21C820FA277F01BB, 0x51F6FA001C75C043, 0x1242F013380042B9, 
-0x60DD912B0F788D6E, 0x4AC16DADD6270BF3, 0xEB2927B7EF6794BC, 0x15740E1E0, 
-0xBA4904AE796A896C, 0x61A6A1AB93EAD6AE, 0xB718FF1E615990AF, 0x9FEFDCF466D77BCE, 
-0xFB7E93496649F0F4, 0x54E9B42B1977326A, 0xB300A123866DAB2, 0xFC1B86CDC86AF8CF, 
-0x9251D916AD952A79, 0x30C58AA9, 0xB4264B873EF8138C, 0x74F34255739AF6D3, 
-0x83D5A6A495A89CD8, 0x8BB043569160F1F8, 0x49B1E818EA26FCE4, 0x1EC029DAC8E93DA4, 
-0xC4DA3605D98E5355, 0xE5668BA509398E56, 0x2499CF040CC97EF1, 0x1DC3A0323, 
-0x6990FF58CABD646F, 0xB0F77AD8AFD40B1A, 0xEBBCEFC363022F40, 0x82362FD7CE13154E, 
-0xB19B2D980EF91F40, 0x53614B2B8024AD56, 0xEC4E0135AFC1FFB1, 0xE3264FB0402A4388, 
-0x6E9B1B26063BCA8C, 0x659B45B, 0x21CCFA438DA4CC6D, 0x77B28CC6BA631859, 
-0xFE3A6DBC69D25E05, 0x4F8A692ED2BE744, 0x45CCBB6A818E8C46, 0x60DFC4483A0AC756, 
-0xF434AC8884AB12C1, 0x581D8FFC83D3DA55, 0xBDC5113FA1672AB3, 0x260DEFEE5, 
-0x715559DE2E08173B, 0x5E099A0863D339EA, 0x2FA991E4E089C331, 0x26D47450D901BFCB, 
-0x8DA8DB440C4D60D0, 0x9E0C10C86B8E9B7C, 0x33203BC5AFB52BF8, 0xF2D971A9B3429946, 
-0x61D767F7F3E02645, 0xA9C3F321, 0xF306C3A9C5870042, 0x9DA737CC178F3A42, 
-0xA6B60EF856B59EB8, 0xB6A15B44B70B011, 0x4E88A57B6DB99A68, 0x2CF8773D4137709C, 
-0x9767CD7F84694923, 0x460632043592937B, 0x4A08A2550F378A7F, 0x15CCFD078, 
-0x56171BD7A25396CE, 0xEF00BF38A69D6174, 0xA3C2C9A6600250E5, 0xE6390F75B6277160, 
-0x7634BC3FAF8D552B, 0x9F14A67FAE4DB61E, 0x85FE0755AF4C04B3, 0x9D633A12C07512E5, 
-0x7E0CB746EF6F12E4, 0x104B2CBF3, 0xF0CBF54ABFC805DC, 0xE8B1F9045CFC8DBA, 
-0xD8ED19DDCF414222, 0xF17FDF67E15C6192, 0xC2ADDE8B760C1088, 0x37A7F2343080F1D3, 
-0x63E7D28D2C6E6E45, 0x297401A92A7ABF8F, 0xDD6D417BCF8487B8, 0x6C3FB22A, 
-0x3023C2054D3D181A, 0x1CBB195A277B6325, 0x5703B848D4FE18D7, 0x5724E4BB580591E3, 
-0xDDEA9851CFCCAC94, 0xBD24A7AD9331F717, 0x9A834713BBDAD4E7, 0x9E7002EB4FD053EC, 
-0x9B5FA983296B37EC, 0x77361B, 0xA84699A2BA886BE8, 0x1D2FA7D7330A5EA4, 
-0xC55A5F418BC198C4, 0xB0E7B4B22347B88C, 0xB8DF0D87180FAD1B, 0x75DBA336DBBA1DAA, 
-0x70A5927807849250, 0xE9462109A72F52AA, 0x5A3BF3849DC148AC, 0x168053514, 
-0x401A39B4C14E88BF, 0x6850750D9DA43CA7, 0x8BEEADDB09554CA7, 0x995877B1D59D2452, 
-0xB7E63ECFAAB576A0, 0xA57637F8063FE876, 0x60CC5974D9B52CA6, 0xE61D977649777947, 
-0xC7A8E6E914D3E10A, 0x1A4169489, 0x39B8F88B818309E8, 0xAFD2079174AD0029, 
-0xBB3E55CD4BBAD22B, 0x22C6D3FE7E93BE3C, 0xD6687077FF01AAE8, 0x1716F9B457CB86D, 
-0xD9D1FA6C61B7B85C, 0xA092F6027E6A01FB, 0x7E101AD235A7452A, 0x263CC47D2, 
-0x1097B869E9188105, 0x3E95744B1AB3F5FA, 0x91927F0FD7907344, 0x4EF6DFA1B874F25D, 
-0x94A428CF99A378DF, 0xFAD7806AC86E646F, 0x92921A0C1FE883B3, 0xCD4A6E5CCEB4F878, 
-0x77A1998D5AB0E51E, 0x100E0B7D, 0x46AB024B8E3CCD4B, 0xD6F915DD7B62096A, 
-0x5EC64292EADE2725, 0x19139AE45E4F113F, 0xED4C177ED1954B57, 0x480CB96313C19DC7, 
-0x98BDF8D2D631160D, 0x60AB5B56F0059AC2, 0xFAD0863014163C21, 0x125425E26, 
-0x58B1D00444398E16, 0xED4B7E9F00A37F5A, 0x8B95A3FDBDE46A52, 0x16CA7D05E777374, 
-0x245816304CFECC08, 0x3154C1DD8F303088, 0x604886F40955B8C2, 0x18A8D0B633EE94CA, 
-0x4CBC30BABD4934F6, 0x1D603920, 0xCC00FBC1C64B1036, 0xED5CFC7D758EC0FD, 
-0x230250ECC74F23DF, 0xE57104213724B69D, 0x2E90427F3C0B8895, 0xF294FFF9B9169BDB, 
-0x317F1605A8B67FFA, 0xB8D4D3D8DCB4CE2F, 0x440E1077912BCE48, 0x1877AF22A, 
-0xB2B7946016E487A5, 0x9658C93139AE789E, 0xD3CC207845544C95, 0x1109FC82C61BAA24, 
-0x66ECC15C5135DCD5, 0xAEBE7C331C948E10, 0x353E7F7B033C7FF0, 0xE6063F101F948E35, 
-0x5E86ABD5F27BBAEE, 0x9AB05D69, 0xD26E2D0BA8B0DECE, 0x91330877F4FD1B05, 
-0xB11B92FFAD2C61ED, 0xB33EDF7429D9501, 0x7F0A4211D648F16E, 0xA4AF3B6C7BD9867, 
-0x82CEE0164838465E, 0xF5B8D5514ADD6BDA, 0x3E0079C69773A6CB, 0x125EC04EB, 
-0xA5B2DD564CDCAAB0, 0xC14A3E7877D2C208, 0x22AD6C96889BA343, 0x604BD65CF12F0FE4, 
-0x6F86737ACF597582, 0xB4A46370DC608D39, 0x29A68654327AF63D, 0xE6DEEE352396C6FC, 
-0xCAD38B4AAA3DF2E4, 0x1FC49B89D, 0xD6DF7E0C629A25BB, 0xB8A91CA74E5D1EA1, 
-0xE8B3ADB8B7EEAE73, 0x594F519B11CF38C9, 0x27DFFC660C2BF091, 0x424A9E11AFA9DCA6, 
-0xCF9CD43FB4B15B10, 0xB45FDD84D105C7E6, 0xA8B82094293617A3, 0x940DC3E9, 
-0xC8D4435FB77C5B3D, 0x97DE04B589D2A2FF, 0x32C093340BF06DA9, 0x43EB5D3E1FA88CF3, 
-0x2B2D2539D660BE81, 0x12E39DF2BBC9A83F, 0x66B040CB076C5CCF, 0x976A153455DB268F, 
-0x8C1AF74E7D96C770, 0xC3C130DA, 0x171E6ABF415FD0CC, 0xEB02E44E847C6197, 
-0x49DED6B18DCF6E23, 0xC10A276F9C931B64, 0x14901FC624CBE764, 0xE71ABC65D0F0ED94, 
-0xC94EDDCD2C737168, 0xEB8D04680B9B431A, 0x5F604DC4BF88D358, 0x234E49B3B, 
-0xAADA4114DD22EBAD, 0x629F7E2347542AEB, 0xCA3C5FAA07118103, 0x7C582CF7767DA47C, 
-0xD5CFF3A036F95C0D, 0xB52C6B9845E4B848, 0x882F256FF50FA445, 0xFA89569B142B739E, 
-0x4318328991542445, 0x258E7C468, 0x4D5FF38F36D35237, 0x5030F0459A845183, 
-0xEDAE0D79A4864190, 0xBCEF6C1C507600C0, 0x4FACAA09ED15F465, 0x6F245B084143EC35, 
-0x3180682C833A6D6B, 0x8B209E3AD36F0C18, 0x434D7A8EEF037FAA, 0x26A3E15AF, 
-0x765729448D7AFECF, 0x27753925B25753AE, 0xC7ACF723025BAA08, 0xE38389B4D3483D7E, 
-0x4475FFBCDFF245D6, 0x8BE17A7FD5A72EF4, 0x2D8DBAFC05AC6BFA, 0xD1079BA79E67FC09, 
-0x96CD73DE99B52134, 0x126118E9D, 0x3D3B908C81CF93A8, 0x42503A3FDAFC31DE, 
-0xBB7EB1AE108CF1CB, 0x355641A8B3CF55E5, 0x400C08B58881F8, 0x87757045537153F5, 
-0x2C728E14E6737C7F, 0x30A4CCFC49530B1A, 0xF2C97D2A3618F5A0, 0xA6B12F97, 
-0x2CF7E4F4089C059C, 0x3340E4E02D466C7E, 0xAE8B97882530DE45, 0xF5D1C3590506699E, 
-0x2EDBDC67C6310F4, 0x6F89C37C6AA5D38F, 0x9F83426BABFA7452, 0xAEC84F0DB0757104, 
-0x5D63DA4F776575C5, 0x1CB6D080C, 0x5E2F80505BE788E6, 0xD179F95A3A923514, 
-0x52A6031D2B424EBB, 0xAEE95476E04B1D51, 0x778D7D48F1F5316A, 0xED76F14E4D7DE228, 
-0xF4276F982E2175B4, 0xD2C3A8EA0B8D07A8, 0xA79240924743BDEF, 0x21A8B85EE, 
-0xB4A7CBC36FD22B36, 0x9A8DCC0522ED2BAF, 0x5B2A358F53CEBDB4, 0xC677C2B085279677, 
-0xC274A28F805E81C0, 0x68F3982EB1EC2B23, 0x296A67DE4BA957FC, 0xD2EA5D85C65A77E8, 
-0x54A4041B682A7E03, 0x243367B49, 0x2E0B26C99F211040, 0xC3C73D084B4D6446, 
-0xB993A5252BC53548, 0x17247B08E3B835E0, 0x536AF21E7F00AA3D, 0x33AECAA64FD6F6ED, 
-0xD280F9AD2A7920, 0x53A7784FDB35FE46, 0xF75494A552764513, 0x11A89A011, 
-0x83D652F44D03D48D, 0x5C5302A478A00AC, 0x983D7BFEB891469D, 0x937B141F6C85F098, 
-0x738356E41EE1BE4B, 0x56E2447BB3DFC37E, 0x271FC1D05BDFED2, 0x5108DC02CEBA3267, 
-0xB62483404D5F532D, 0x16F357564, 0xCB49548E0E41D04C, 0x2051AB25DD2377C4, 
-0xA635D7A82E761946, 0xB6E2D6546003CC92, 0xC0C1D2EDA8DF6767, 0xA2DB90B8EC515DE4, 
-0x3571C474BEB8F155, 0x73F305A589569088, 0x56523C378A9D2DC7, 0x1182A229F, 
-0xE28A24BB509A02C4, 0x7AD6C0C258B0E52A, 0xD688F791654BD70C, 0xD118FB78FDDB650B, 
-0x9C8D94C96EDA51A6, 0xDF96A2B7F6794912, 0x63621773A3B23268, 0x81EFE272EDE09C8A, 
-0xBA6D74DA47BACBD, 0x2539FEAF4, 0xBAEDC8496FB4C784, 0x99E788BF6A28B4B2, 
-0x7BF2C1D05358F6DF, 0xD988BCBD33BE02B4, 0xF42CB7BF95730325, 0x3CDA288F673FF1F3, 
-0x3856941B64301C95, 0x7C0426C4272E1A8B, 0x1CAF776BD11D7AE6, 0x19160FFEE, 
-0xF85F402238840836, 0xA5E17D31D4573DDF, 0xC7679725162478E5, 0xAD785ED195E8F9CF, 
-0x5C415A8373CB99FC, 0x4E27CA1B9444C545, 0xF82E8EF82EBCF915, 0xA36AED956F5B1B4B, 
-0x97951A26B9D887EA, 0xE5A6DB1F, 0x424C57AE7B532ACA, 0x646ACB35001CBA7E, 
-0xCBAD7BAC69925AF0, 0x79D7D27B6E9B64EF, 0x4DD66FF8F294956D, 0x422CC45BF16D7041, 
-0xE301D10974DF0478, 0x81FBFEE0A32E42D4, 0x23D52DD10D041B3F, 0x1BFD2777A, 
-0x5657D5DA70E78B4C, 0xB2BBE0099D6E1FF0, 0x920A66E3C729497F, 0x20B9E7C878E631E1, 
-0xB50BD4E3EE39DC7E, 0xA2E0A26530694765, 0x7E8FD9F97812748C, 0x190F749B8A208862, 
-0xB73A00D0AA330A46, 0xA3190F59, 0x11D8BD1D2A9D02EF, 0xED8719B6526C1A16, 
-0x57E8EA82E0B06EC4, 0x52D15EDDA9D6383C, 0x92D5E49F379AC278, 0x2C1BE62CC74983BC, 
-0xF48D943FA02C2F25, 0x513756149183F11, 0xCBFF9302AF1BEF00, 0x24C130C85, 
-0x239C24B5BBB7935D, 0xEF0C2BF551381E04, 0x27818A4A5BAE6C43, 0x93BF95F324DF610D, 
-0xE152F34A6E9A9648, 0xCA0317AE64214D8, 0x9AF21A23298C046E, 0x14C1FC8DE6906AA0, 
-0xCD9FB199E80B401D, 0x959AD26E, 0x52DE990B0CC572D, 0xAA9752F70C79E80B, 
-0xBA9D7AFDCF1D8996, 0xE98DE08217BCFE9E, 0x64547204E07E1854, 0x264F4E4E53AB7282, 
-0x43053FF9CE468052, 0xF10312787E45730F, 0x3127E9A1629D55BB, 0x1FD4CFF99, 
-0xDF8BC21F67E0E0D, 0xBCC35B8AD44C9828, 0xFE0A5EDD891BC57B, 0xC32ED04303FC4A04, 
-0xA82D7FB9CFDD3DDC, 0x23197D1B0E3F0947, 0xF504C3938D32F095, 0x1B75A115C8BCBCEB, 
-0x91E7EF18798FB256, 0x101258C74, 0xFBB79AA008E21FE4, 0xF1A1624B07D0E596, 
-0xE5DAB5F7E148736, 0x6C46CE88C8E86A5A, 0xF341EE0B5E1D54D6, 0x859DE903661B0C48, 
-0x1EBC41F1CF150DEA, 0xCC33EFA4F6986BEB, 0x148668E1A86E5262, 0x26FE5AA25, 
-0xC5E5B8FD5E5AC972, 0x662BA4E8C1652E62, 0x6C00300550579687, 0xA52EAA9DECCA2E03, 
-0xDB847DB9934C5B80, 0xA285E37C6D16BC8E, 0x3133521BFB165CDB, 0xF01B0A45A794DFA7, 
-0xB0FE778194E03100, 0x6968332F, 0xBBD887E372B99AD2, 0x388E9BD2496FE354, 
-0x20C710EADD416C3C, 0xAD7309F35BC6E7A2, 0x4A713270C2EF0C98, 0x23527ECCA8461C19, 
-0x26B96CC682A16A46, 0x1698EFF7C5286F84, 0xEAE563ED0A80070C, 0x193C6DC81, 
-0x955F447F8585F4C1, 0xD4AA50808A4A97DC, 0x33769C8FA64EDA80, 0xECF20B9255351D9E, 
-0x16EED1E2C0DBCC49, 0x9E3C7D7853CD00CC, 0xF51A5786F593C133, 0xC9E6F5312CEC7E46, 
-0xB9EE7773D8D568E6, 0x25071CAD5, 0x4F76DB3402BF5C0A, 0x82E48DBD9FB99F2D, 
-0xB55AE8B16E8F2637, 0x3643C528D3954349, 0x39A3E033979DB54F, 0x712ED67359762CF1, 
-0xE7FFBE62D5916174, 0x8C7CF371292B15CC, 0x2A5E10B834B9E49B, 0x23B3130D6, 
-0xE1E316C0DB6C0B39, 0xEEC1DCC6342FBEE2, 0xDA0A8ED54F648198, 0x33DC8941D04D5EA4, 
-0xFC842DBD8B437819, 0xE7DDF460E2BB27D1, 0xF53B48EB0EB18D31, 0x2314CF6E6C78E128, 
-0x7B1D62B7DB211B78, 0x3A3501E2, 0x14CD783EB3347721, 0xF77CC8CF14255007, 
-0x17DB35B6FCF4334C, 0x8484AC13743E15BA, 0xC0D0ECA77E06C065, 0xDDCCAE5B8D1AEF90, 
-0xD32998C83DFAA59F, 0xA55B849F0F9DC192, 0x7D397B3DE689D5D8, 0x152BF751B, 
-0x5163FFFAC09A3825, 0xD3B94C8CC3341355, 0xDC86AC6EA1B79691, 0x1C1CDA614C74DE93, 
-0xDA2E1BAAA939FD6B, 0xB4E8BFDA38C3CC9D, 0xD1D66EED0BB145B3, 0x55E6825F411E5CE0, 
-0xA89D655A7E6CC30C, 0x23353C67B, 0xEAC9A16F2FA52EA8, 0xEDCA033304376B7A, 
-0x4FF7D0287E7CC3B6, 0xE9B720375BD78D13, 0xE0D483036017A0BE, 0xB49D73F4A9B15A1, 
-0xA4876B74C419B889, 0x128CE5F464F5AEE4, 0xEEAD47D1ACB74C88, 0x170FAC04E, 
-0x784CC53FE1AB7EF, 0xADC61098C15D772D, 0xBAD4104CD38DECF1, 0x2AE867F67E74686D, 
-0x6FAF963814723ECC, 0x8B00CCF93DEC9C57, 0x70F918D2FE99B2E7, 0x682412B193D1712C, 
-0xCB8440C4B0EDA6E3, 0x1EE505312, 0x8842209157FC67AD, 0xFD86B12410C2482A, 
-0x44C7A70B79398ABB, 0x9E18AB3FE596DC12, 0x29A0A57A9EE405A4, 0xF0B017DBF5A269B4, 
-0x503725AEA082350B, 0xC46FE095F2B424DB, 0x2E27F7366883F37B, 0x61719150, 
-0xBB8FFC194435D5C1, 0xC028580DF7D237BB, 0x6ED2330FF58B0B74, 0xF0CF8DD63A0BB281, 
-0x9DB01994590F0122, 0x90429186F45B1EB1, 0xDF099461AD05E734, 0xAD45AFB5CE2A1D1F, 
-0x1CA699C7202EFE68, 0x95CF338A, 0x7D35A00ADA89E0F8, 0x2B3A15602176B852, 
-0x465B84AF3E94E4EB, 0x6159C91F44AD7929, 0xDAAA5B9EC0863BF8, 0xCD4D9C47DA6EAB8A, 
-0x7DC178DE811C37EA, 0xC28220569F6F59EA, 0xA330197346CD5F44, 0x10E98F0CB, 
-0x10597FC281285997, 0xEBA0F14D8AA7425E, 0x756DEDAD50258BA3, 0x9DBE71A23876D177, 
-0x7905787A4A30A344, 0x3EBD390E8685B07D, 0x21891099E180856D, 0x63F034A7AB8AE870, 
-0xA0179C56B8FC9B9E, 0x23BBB0D0B, 0x79573342BB8F661C, 0xEC7AE430DB00D583, 
-0xE65164CBCF9AB779, 0x771AD647A7B22554, 0x678D5E9D067E4868, 0x887DAD620E1F9758, 
-0x51FDECF9B4F83079, 0x63D2229938F3A39E, 0xFB193A24809E3EA3, 0x5CBB4245, 
-0x4855992D860F12FE, 0xD80FB9663282F34B, 0x6908D625DBE15D09, 0x6CA096080F99A56E, 
-0xA8F2586B786ACFC7, 0xE7228C27D5AF1EEB, 0x175424A697B82424, 0xEAAC7060B0F18B61, 
-0xE647BCC4E6841AA4, 0x1557E0DB8, 0xBE27200363431C6F, 0xA7B98065EF95ADE4, 
-0x1A35F729DBB866B1, 0x6E278FFBD2177CD, 0x9E7977FDDC082DE8, 0x78DFCB3C02FEB06D, 
-0x9A194D63BE0BDBF7, 0x556205BEC439F100, 0x1E48ADAC4904BBA2, 0xC4891B, 
-0xAC8B0EFAC6EA966F, 0x1AFEDEEC38BED955, 0x705A4375EE984FED, 0x209C71B20168D1F1, 
-0xE2CBE02F5A9FDA63, 0x2AEFDAC8DC6CC3EC, 0x251C8408423CF193, 0xEA23FB47AF67505F, 
-0xAD8C288CF514F6AA, 0xDAD6975D, 0xB8330A92DB3649DD, 0xC7D245D9C2B97848, 
-0x5CE20F7D2A14E239, 0xD35D2BB818EEB548, 0x1C56C295489F828E, 0xB0B6EE426AF4A3B0, 
-0xEAD34F711B9B8755, 0x1DDB5B654CDBBAC6, 0xDC3BA309AF03D278, 0x80A1CCA5, 
-0x8451E9CAE99DAED1, 0x9E2C8AAD8229B42D, 0xCEDCCFAB0F337C2A, 0x74F152A047E30D75, 
-0x1876743054118DE9, 0x85047430A8D82974, 0x76D616D9B02BFB53, 0xE86233CEEE4CA45C, 
-0x8E2B6F4238B96B17, 0x168120706, 0x7E6501656BFB5220, 0x65469070E49E12E5, 
-0x6EA2F0B5BFDE5BFE, 0xBA006CBBCB9BBF62, 0xD076C0EA11BAE854, 0xB58D61959C6D40B4, 
-0x260C05B71677EA84, 0x2B5F2A2283E65B8C, 0xE8EF6040009ACDEE, 0x20E88D89C, 
-0xC7A4EA6B9060E10D, 0x6328926E6D9C945A, 0x6C05742354A98670, 0x47B550582308B425, 
-0x76055BFAEEDA5505, 0x7BADCD6E9C618F9, 0x8D4F56AB3ED224C6, 0xFA69F60BB08BF22B, 
-0xA00F528AB86CA4D4, 0x82EA644C, 0xECD076EEB71E176B, 0xB7520C8874D2D3C0, 
-0x57BD701B5DD19C92, 0xAE866A40C2D9FAE3, 0xE40589D6757890C3, 0x16CB3BD0E58BB9C7, 
-0x49F8F4D3A5EA6440, 0x492994E042D73D24, 0xE4FEEC9F4B0453C3, 0x1CD0F89DE, 
-0xB7498576F20ECCF5, 0x1697FFB15291E421, 0x92B3B056E08BDC4B, 0x3C583C1D3867EDC1, 
-0xED1BCA61B4F86958, 0x4DF704D3BECADD88, 0xC9C94D024121CE92, 0x7D0D6A6E8C11CBA0, 
-0xA950F242D86F7699, 0x4C2290D7, 0xC08A37284F9E3559, 0x617A7F8F85C5302E, 
-0xAD06843B137A64F9, 0xD697EB7CDC5C59A1, 0x263B19FA3FC011B4, 0x358E431D16A272A5, 
-0x7CF43684408F8572, 0x80E7CEF247E28A7E, 0x4E2118603EBA82BD, 0x18F83B5F4, 
-0xA415BEF537C4480B, 0xC459F57F7ADF5233, 0xC8243792CA69D53, 0x3EB69544B5022A66, 
-0x79D6C07F5477E8A, 0xB8A3004F758E6F13, 0xB307BB5EAD60467D, 0x946B0F88EE02B984, 
-0xC8AA76518296DE9D, 0x21A4DE23E, 0x829C5175FC3B5E9A, 0x60F8ECD36FE2B215, 
-0x8D6F9FC1469D0FC6, 0x36092E98BE75A88E, 0x6B0EC1EA4FC0E1C5, 0x45FC6FD239DB11F8, 
-0xBE0091B790B0F426, 0x27C8E50856F648E5, 0x498655ED8C74ED3F, 0x20CC7D4C2, 
-0xEEE4E8481CEF788E, 0x491E5BC82571F4FA, 0x79DC8C85C14DB583, 0x573A394050C289A4, 
-0x9E5373745CCD79DF, 0x2D583418DEF8B6DB, 0x489124481F186516, 0x5316D108DC89C9F0, 
-0x100990D2C8CCEC69, 0xDD15AB26, 0xF791798C09951E7E, 0x4AB3AEEAC9E735AD, 
-0xEC1FAC5DB463A60A, 0x7CD752F1FFE9FC9A, 0xB89205CC7384D3B0, 0x167C525D8647D3DA, 
-0x2180B968A3F15D, 0xC8C4D73224390BBD, 0xF7135F4097D7D3AE, 0x102FC90C1, 
-0x7D96553D6DAA44A1, 0x29B7DF6C8DCB13B1, 0xEB7247A021132FF2, 0xC4312EA214D437F7, 
-0xC81753FE943E2FFC, 0xC9684BABCEA954CF, 0x269873B01EC6CB9F, 0x63FE102110D7CA50, 
-0x93FDA17F80022240, 0x9D184B4C, 0x7FBDAD5DC368E553, 0xC4DCE19B9A379E3D, 
-0xA0FFEA5877DFFD0D, 0x881A2BC760E77DD8, 0x96ACF1DC812B2CB, 0xA535C4939DA63D24, 
-0xCB5882905A9EFA05, 0xCD20655097B43DE0, 0xE2FA0967F6824750, 0xF39DCC76, 
-0x32E962E9B9F76EFD, 0x8AD1A1642CED62BE, 0xE2FD44167E076EC4, 0xD365862F8370CF0C, 
-0x37E2CF007FD8714F, 0x7E26CE55CCA9BBD4, 0x8B82DA9724E8218, 0x21F7623CFE4231C6, 
-0xA1C58166AD0F3A97, 0x185A1DCB9, 0xD2CBE31FF8F55C8, 0x884F4C651062ED8A, 
-0x70D9358C1D73AD3F, 0xC055974A015BAE6B, 0xD2DE6B6A0CA37EE2, 0xDA9BDF1451BE3B96, 
-0xF636BCCCE7C1F9E2, 0xC4FDCCC149E7531, 0xC418988A0C229A94, 0x1ADD523CF, 
-0xB03FBDBC3C297216, 0x519E2E2484C8FFD5, 0x5A7CAF9EE940ACC2, 0xE23E9C9A77848669, 
-0xFCA4BB410190AE21, 0xB332CEF660F5C94C, 0x310D94A90921CFF3, 0xD5733863AB4E4156, 
-0xB0992C51D7E9D05D, 0x90B751F6, 0xD47DD867F35329C3, 0xA38B48C156D73460, 
-0x3A18217F72CBB6DB, 0x1E761B5EB945798A, 0x6A60E94925312BB3, 0xDA034847769F3AD2, 
-0xE19BD485F3293387, 0x5F0E2858B83BFC7A, 0x9AB06ACAC1C219A5, 0xE6B8A7A, 
-0x688337291304A250, 0x70FF0ADB5B381, 0x9DEA9A4F4F60904D, 0x31DB6C35243BAABF, 
-0x9F5B1A11964B1C88, 0x23260AFF1B422B2F, 0x960BDCDE57CFF36A, 0x18CACF08766EBD8F, 
-0x4023673CF2F20BE4, 0x2557086A6, 0x7CCEB034E5E66F32, 0x18D5E48711A00BB, 
-0x38B2F16FAF757D2A, 0x2040391EBB4DC1A5, 0x3A768211A8C2B069, 0x3D4C04DBD61623C4, 
-0x290D3654AB7F9331, 0x3DCF046534B7F396, 0x9B78AAB5357282BE, 0x1AA7132B9, 
-0xCBAE791C47627050, 0xB42A5E345B9F12B3, 0x3B589509BDEE6164, 0xE94EFF7DB1E00CC0, 
-0x4148F155402CC6D1, 0xD445B94F90DBFB21, 0xC8C92516CD97913D, 0xB96ED1B28F98932B, 
-0x499621C61A305010, 0x21729629C, 0x43683FCE3C2C03B0, 0xE7DB63CD9CECC6C1, 
-0x719A77D6C327B85D, 0xB405B25A0EF80A83, 0xF6D4903ED894C557, 0x92BC54046BA32ABC, 
-0xB741D75903F68F1A, 0x246772CDBAF3DD4F, 0x118988E2B5BD4AA, 0x221913092, 
-0x770B34739EDCC80B, 0xD7E39361AC1EF9C6, 0x6B163D3852A7E1EB, 0x8CBB61359124DA5, 
-0xB4B00A318FA664F2, 0x1C433B0CFD6B5B18, 0x44E98BC25518FD0B, 0x91687322C9CBB7BD, 
-0x283124DB834F7759, 0xD86838B2, 0x12348F28585D2D10, 0x9573CE4FF6DEEACA, 
-0x9BEC04808FDBFCD6, 0xED51B13F9732F90C, 0x36F93EE6D0C19707, 0x707B429DC1A0D2F7, 
-0x6C974D9D81853F2E, 0x475C1D2C6C572F79, 0x1258BA04C68DF94F, 0x26FDBAFF8, 
-0xBC38BB0B4DCE6276, 0x608567A6BFA138EB, 0x5AAF726ADCA7CD20, 0xA48EA9228F9B2EEC, 
-0x551CAE8E360DD750, 0x8F9046011FB53F12, 0x2082808B2094FFEC, 0xBDFB9F32E025EBC1, 
-0xFEFBAFDBFA4572DB, 0x1B9554DFC, 0xBAA1916F919F17ED, 0x2D455A1FAC8D8BC6, 
-0xB7A741221422C5E4, 0xF9D376AD772AC3CD, 0x420FCB270F9D326C, 0x5B5D2FB59AE721BC, 
-0xF84A1CA45CB7485A, 0x71D9F1736AAF4494, 0x8DEE7967CE5DD002, 0x1E2AE2FE7, 
-0x1F97FB973E2A0C10, 0xD3EECC67A9110E3B, 0x6C6A3BC6A75955B7, 0x168ED1849F7C661E, 
-0x928993D6064BA442, 0x2BDAB731E36E300F, 0xBA4A7F9BF9BE76B1, 0x1EEC949E2F4E3A8B, 
-0x9A823F7B087DE129, 0x2048BC15D, 0x8B8F32609239ECAD, 0xADD3B152AFD362E4, 
-0xD4143C131914F1E4, 0xC6484749623E73B1, 0xE1ECB9357A52D35E, 0x3A021415CAD2AA1D, 
-0xEA55D14319B41DE8, 0x8ADF38DD162D3D65, 0x6D519A3E7E659DEE, 0x1C62F2CA6, 
-0xE3B27B43A5F18211, 0xE1EF3A74BF7D45C4, 0x81E7DF044A1E0830, 0xCE790B4FAA4CD600, 
-0xA2BDA6ABA3E2B77B, 0x363EFEEA8E5D00E3, 0x6F12737913B55E88, 0xB8A1D5BA92EDBBFD, 
-0x9ED3AE45946B19CE, 0x1DB131EEA, 0xB29191161B867FD6, 0x11D90B0C6C28FD3D, 
-0xCDB804E700A274AC, 0xBFF2BE5200097283, 0x7BF6992FF4C69F06, 0xEE1167DAD18233CF, 
-0x5F4B6C1B56E089B8, 0x8B385141546BE89D, 0xEBA938FDAA00BD34, 0x16C40312A, 
-0xB73B004CE28DFF63, 0xDDEEE063377716B7, 0xB25C5B4C5A4C66E8, 0xED6C3521E945F387, 
-0x6857DCC8D5735D0B, 0xC8232362837D786, 0xCDAB48E6B0EDFDD5, 0x122C5CE896E38157, 
-0xB76CAE7428766ED5, 0x243C3CA75, 0x83673DF6D1F3FF48, 0xCD12C48150D460ED, 
-0xDF9A85F46B1790A6, 0x77D0405C2674F5F2, 0xD4F0C10CF2C66649, 0xCC771BA9BF99BCF6, 
-0x845CF34C4858349A, 0x4485C0641A5A6863, 0x91CB51993C2A64DD, 0x5BADE32C, 
-0x3E37975A910BE4AD, 0xAAD8E0DB1BC95BD7, 0x5616BA87939FDA85, 0x168A55787DCCDA69, 
-0x8C3919D8D58D31CD, 0x7F344006E5980917, 0x2C1E48582F4700C4, 0xCBDC9FA96AB87410, 
-0xAD13E9287B83379C, 0x19508C5A2, 0xEEE521FF61332BF3, 0x923265BBB64B7124, 
-0xCD8D170EF69EB4C3, 0xED0B0826772D5, 0xC5A505856FCAB5D4, 0x3E78FB5BC9D27E6D, 
-0x5B825FF98D12E76, 0x559C07FF27CA818C, 0x78D075F67303F057, 0x7C160614, 
-0x136F6F33E25B63EF, 0x3D4AE8EF0216E30B, 0xAC9BEC50F608D721, 0x111EBBB8F9B30D22, 
-0xFB1A5B7AAA56EB8B, 0xEAD0AADBDDAE74B7, 0xC758BAA0059B82CB, 0xB4805B7C1A13A0E8, 
-0xB6A7F5F7481F7439, 0xFE3D6A80, 0x7741DE5BEFA07A7B, 0xF7D0296AB80F48C8, 
-0xC6561228EB712E16, 0x4BFE7E60931D619A, 0x819B802275EC9C73, 0xD48FA43D99169931, 
-0x327CAE68A3220CD5, 0x6AD81919F92BEB2D, 0x3969DDBF471D09B, 0xAD74E004, 
-0xE0544599D5BADEEA, 0x69AD3414FE20CB0D, 0xE9C19CAF71108583, 0x1A2BE224DBC25A3F, 
-0xC8FF6A0CEC9D22C4, 0xA84DB0EDF0AD125B, 0x9ECAEBC494889FC2, 0x6A5E8AEE7A70C561, 
-0x940DA6C5B6A249B6, 0x20FE41004, 0x730878E8BB76A449, 0xE98B4EAED1E45A27, 
-0xBE9DF49872ED2FCD, 0xE0107E538323F9E3, 0x3F649FF6BF9C14DE, 0x52EEED8114BAEC9F, 
-0x42B10076D56482A3, 0x53FADBD57AEDA20E, 0x2E8189CF208F3A2A, 0xF1EE1F25, 
-0xB5EE8F8E08F2FD3A, 0xCD0C42789E58301D, 0xF969B296D11F7430, 0x6AFEF986FECAD265, 
-0x4A7C08FCF9536EA6, 0x344282356F65F85B, 0xF397360D2E28634, 0xCEA1F0284F39D2C6, 
-0x60EB9912A89DE2C1, 0x31B9D572, 0x51215DB2601A21C4, 0xC04087998CF60874, 
-0xFA20991DB0BFB09A, 0xE59C5EBE9E558EBB, 0x2C204AFDD6877F2F, 0x117DF9FEEFC90C70, 
-0x4ED3AE5E032B4869, 0x34CB8673F0DDF03E, 0x4C26FD8D7C7CDAEC, 0x6254915B, 
-0xD47C2FE5A0C7EE8F, 0x11ABD79DD11F8F9, 0xFC6095834D656BDF, 0x5C9339F803C22924, 
-0x205337F87F2F79AC, 0x72B22115FA1870B8, 0x78AE2621AAE8382E, 0x1F4B116D73FE534C, 
-0xE1B2D27BF90E02DC, 0x216C54C0C, 0xD892A7F36318A8B4, 0xC692B08C93A7AFC8, 
-0xF3D3B3CA44DC5E3E, 0xC28EA801BC773125, 0x3600A049633AA0EE, 0x3C9FEEAC8E64D36A, 
-0x16D929BBA2179E3C, 0xCE6FF1C37FA704D3, 0x70D2D8316A7912C6, 0x1F40025A6, 
-0x3ED63FD0A790422B, 0x3AFF3700D6EE817A, 0x7ED0A810031CD873, 0xB2B188439AF3D755, 
-0xE58AEE49E521DAA5, 0xDEC002CE746339D6, 0xA50813D9FDD10110, 0x899A2B20EAC066B8, 
-0xECA80C79D2DB5676, 0x222BB6218, 0x955FEF780DF4F572, 0x2FB5FF100417B397, 
-0xBBD27A9A7938E121, 0xCE24438D7355FE6C, 0xBC78A66CB37F5920, 0x8A72337D0EBCEDB, 
-0x54DA2FB7D717E165, 0x52A315F6B6DAA793, 0x900CD3B4F9FC7A3D, 0x247EF79A, 
-0x7D20BCA50C9297A6, 0xF89438B340AF2AFA, 0x971F45416CBD358A, 0x1BC7CB10A2B168C3, 
-0xA3958C5F603D8E07, 0xAB75CC655699D8AB, 0x7D1A5035BD718180, 0xB82B5377BE917940, 
-0xD1A04388914F0244, 0x27B866B30, 0x7893E35A4D2D8D79, 0x34E2834409E18DD2, 
-0xEA1807E61B44FCF8, 0x82D979960B0849C5, 0xBFCA2E024C34FB20, 0x748C50F5B4FF5990, 
-0x541F0042E787D036, 0xC54BA8D11FB60EC9, 0x5E6880319B3A4A32, 0x83DFEED8, 
-0xB0F60FB0CB426AC2, 0x6156A8AB915265B3, 0xB8863E9EF4516ACD, 0x4800D3AE16C8064D, 
-0x71756B5BCFF35041, 0xB642E79308F825F3, 0x99841FBE77861E90, 0xCC8C952056BE7107, 
-0x6B54AADA9E2A32AB, 0x1FC3BABD9, 0x58E8DF4DA9A53CBC, 0x74DB28536701B77A, 
-0xB18AEF79975D3289, 0xB08C78B5A1DE18A5, 0x987F2BA2CDDC265C, 0x8E91962EE6689A01, 
-0xFAE2F8A622FD6BE5, 0x34E1CFEED2490D13, 0xD3554B93064EF068, 0x44FE1EF8, 
-0x20961CA2FAC70104, 0x3E2CC3A4029163AA, 0x272F5138E6670FD6, 0x1F2CC4C07C07ADE3, 
-0x85DE4F74F378C8D3, 0x89D3815E1C46D00D, 0x9674AAC7FBBA968, 0xF65AEB8F2E1CB0BB, 
-0x3EE95CD02E10A7DF, 0x1B0FD6030, 0x41A1473AF34D0E5, 0x2EBD3F51D93CFD22, 
-0xDDE2EEB69CE6DC7E, 0x8BC7B429BC308B1C, 0x6A9389EA57EFFDE5, 0x9BCED573EE6CEA3, 
-0x6296664C24EDB97E, 0x6466DC4C2FB1A9B4, 0x552A4CF9B8EFD5C0, 0x6D2A808F, 
-0x63CDD8A2EAE871AC, 0x587880F9499DDF9E, 0x54B20CA6282EE1B6, 0xB5B785EF6077C161, 
-0xA41EB258655EFE0C, 0x40AF84765AE48F12, 0xC16CE55909B7C8F8, 0x4E05EB50CABA958F, 
-0x195BC0B280C33271, 0x12DC01E3E, 0x4BD1FFFCD1EA1C2C, 0x793C9B123BB3D2D0, 
-0xC54745E1A831B60F, 0x82613D9CAB1E14B4, 0x94AE01B635AAD42F, 0xDDFF5442424504BE, 
-0xFA74E83BDD620B0E, 0x7270B01CAA5A826C, 0x172CCC2FB9FC42DB, 0x204C7FD6B, 
-0xA232A27DDBA3965A, 0x3CC7CF9474E7990B, 0xAE315A8768ABBE9A, 0x441CB15DCFE00207, 
-0x458204BC966F060B, 0x27D05C658229A5D5, 0x970A58762B4A615E, 0x2D49500883D0357E, 
-0x262A5FE7823E2F77, 0xC828A3B2, 0x934C206316D2BF1E, 0x80045A6128FB4689, 
-0xA5747E22E6241C2F, 0xFAE32B1A0A5B9F2E, 0x7303D6F245F6F459, 0x9F81127B44EA286A, 
-0xE5847311D96E1E57, 0xD9187D1F7EEADF21, 0x809480D0A4F7239, 0x1E86B2F06, 
-0x6DCADD8DBD018B0C, 0x5E744C7D14C12A73, 0xBED36A14F5E51302, 0x3776E7445F5F1839, 
-0x5116CE3814B6F0BB, 0x19573E35756F5373, 0x759BB9CF7D82893, 0x979C25DB74031C61, 
-0x5F6FBDECFA15DD69, 0x876406AD, 0xB62CEB4BEF4AC6C4, 0x6CD1D5AA71B72E12, 
-0xF6D8517BA4A4B8CE, 0x68A631080D84FBDA, 0xE526C5512651E5B9, 0x4EADD387DE91CB86, 
-0xC555EEA006602AD9, 0x4F4CD6A9D7C1B1B6, 0x8EB72281DE79E2D7, 0x26EB1AD7E, 
-0x5B7CBEEAA34B4CF9, 0x44DE35DC222A2DB0, 0xBF6F0B2572389120, 0x2E1FD127DF1B9BDC, 
-0x46B1ABE45334C252, 0xD92D759353105F74, 0xE018335E2F352AE9, 0x6DE2C77FA2D9B053, 
-0x42B2F58B62A317D2, 0x785B1AA1, 0xF1CC30631FED2C04, 0x51E875F4BF276784, 
-0x8A093C1B97BCC78D, 0x1E765D046D2B8D96, 0x758C37DC5317C369, 0x7FFBF1DC0F458888, 
-0x9BD21EFE2147665, 0x213DB7D2A7EA503D, 0x8827B8231148B758, 0x239038F1F, 
-0x2D8D3EC22CE5103D, 0x1E237D05D8C02ED2, 0x3440DA8BADC75D57, 0xCC995442D11CCA82, 
-0x7C9297A567D8685E, 0xAED4B0BE5AE78C20, 0x5E690CD3574F3EE4, 0xD9FBFEE7A2D1B79, 
-0x67304DB64E35D32D, 0x6EFCED8F, 0xA1D9981ED0AB6CBF, 0x4013BF29EF6F512F, 
-0xCAC333B69E285DA4, 0xA7AF21F5F99C384A, 0x7851F6F1253D2F82, 0x953FFDFDA3E23A4A, 
-0x8F486E143892A07D, 0x865AE6980E4C07C4, 0x21B7A671C8D49AEB, 0x1C35418DA, 
-0x435CACF32BFE42B8, 0x2D29848216773A06, 0x9F9E512A3C65EA2B, 0x3A02F6698DE0C6B8, 
-0x70740A9C80B87B88, 0x592D69BA0A7CFF5A, 0xB28623191CECB564, 0x7CD3269F6190C949, 
-0xF03DD5E25AD45AA0, 0x85320FB8, 0xD3E0B476074082B5, 0xB91D5739EE0AC901, 
-0x58F7369BBAD2EB1E, 0x16EC321BF59F5FEE, 0x275AE24DCC1DE5A, 0xFD8AAE97559C8D85, 
-0x4AEFDE8B5E813972, 0x987D6ACBB1057521, 0xB07D725AD73A7849, 0x201D9687F, 
-0xE8FFEB8D5D2DC713, 0x7A8E159859A9BFB7, 0x4C93F68A8ACA7FC9, 0x6935F4A48C7EF0DC, 
-0x4B8263A54889E97, 0x47BA02642B384E76, 0x9B4035908441397B, 0x2F70A4BAC6BC87B7, 
-0x3637A0A0D4791669, 0xA74B0DA1, 0xEDA130A1AE2A0115, 0xCA6D54A1CAAF1352, 
-0xABAED1B0DCFDC723, 0xE4C0A5A4FE463F0E, 0xA20C39F759E66A9, 0x63DC96DF0DF3CEA4, 
-0x1AE119C3A9E16958, 0x1C58236D52B405D8, 0xF5F0E56565F343F5, 0x25FFB92B3, 
-0xFACAE3BCFE2B8325, 0x53FDDAF1824C7E43, 0x402AC14E1AAC2B68, 0x5FD8A4AED821748A, 
-0x34A05BF7A2B7BA0D, 0x2609B26C49817BCB, 0x9BBF0BD07AA3DA56, 0x27673490C519D1E8, 
-0xA5B89A211CA4DEA9, 0x15B88F72B, 0x5EC81D3E4AE95393, 0x16540793685FC78B, 
-0x3714622C880CD5DA, 0x245BA73294D5CAF2, 0x6CB3C5130F2E1820, 0xA5FFEA94BDA370CE, 
-0xBCB4A606182E467B, 0x282ACD48F8C0B6BA, 0xB39C4818F94DE58D, 0x2D0A9912, 
-0x452B14EC0FD82E1E, 0xDC9ABBB31E59B37D, 0xFC6F5B4289655B8E, 0xECA225C467B15121, 
-0x81E81C068BE48BF0, 0x1CF47D178E6CCB22, 0xC284CAD69B00B80F, 0x1F141CFDCB8ADF42, 
-0x89AFBB3961B703C8, 0x1DC5FB713, 0x587CB61D51CA6FF3, 0x144936A107356024, 
-0x481411B9E1844616, 0x55CC0E72FA20973A, 0x11E4101DD481F5C4, 0x7961B31527266F5B, 
-0x484BDD498F5C67B9, 0x4B3FE6C63DF78B26, 0x31AA722AD09FB2E0, 0x193DBF29A, 
-0x7E5F58A2022A1F9C, 0x372A109B42D86164, 0x78AD1C03527ACF0, 0x13460C8EC69860A6, 
-0xB6B4324A707042FA, 0xE80C72BBC35FD4BD, 0x8618485A23A56798, 0x14080A5D528BAADD, 
-0x2DA223349A22FEE9, 0x1837CCF53, 0xF0C3A0FAA34EC770, 0xC207AFFC51ED4FA7, 
-0xA520A62B16CB5BC5, 0xA935C7FC2BA26816, 0x7A7035AF903544AE, 0xDAEA9DB7D23DA4E2, 
-0x8DCB84581B52528E, 0xCA33835ADE07433C, 0xFDB7C5141DA93C52, 0x197C255E2, 
-0x6A5294A286FC6FBC, 0x3A504AF0F7BC9064, 0xBE9BAD19181AF32E, 0x5FDBC170FDDC8A15, 
-0x58A54FB9FEA05E21, 0x5E20C1AF6757FBD0, 0x3C58DC5D4A698F71, 0x8603794BE71E2C6, 
-0x64438D7525BBCDB1, 0x1B08005E8, 0xB8093E9D2C9C89B7, 0xE87C84C7FC61FFB, 
-0x8B12BB4D376144F6, 0x397C294DF6EA0AFC, 0xD4018FFC41B75D8, 0x7CA450BDD6AFE404, 
-0x6A5899FB123EC416, 0xABB62133535285, 0x9A4ECB64BDFB15ED, 0x3629E34D, 
-0xF000C6A4E77C4CFA, 0x4AC9C0EE33AA7691, 0xE7DA730A59BA5A22, 0xDA5AC0A40A12CF3A, 
-0xB1EFD6318BB3361B, 0x4073C67A1FB0D0A, 0x4E8BA699EDA01F7C, 0x63D92B6B7CD40D95, 
-0xDE5D316F5344C7ED, 0x2609C93A5, 0x2B59B4EA891C2787, 0x3F4B5A80F9D1B45A, 
-0xA0FBD62CE881B046, 0xD3AA524A273DB6EB, 0x3C876A70F31D648C, 0x96600C56147D7F28, 
-0x35E93FEFDD529EAA, 0xBD96CA0771A2936D, 0xA002CA3C8F9DDCC, 0x178C026B6, 
-0xEA20B56E7FAA059E, 0x4F805ABDAD8D1012, 0xD3FC7E567A799FE1, 0x591F982454050C7C, 
-0xF4519A26C702A6D2, 0x400ECA26B326A6F8, 0xF7A33E578284D60, 0x4A85F02D52175A6B, 
-0xC85D499322D15AC2, 0x133A6E890, 0xC8A231F29A9D9D36, 0xF4F4C63D9D531F05, 
-0xF9C739A1E8E0842F, 0xF5B4CEC71504296A, 0x8CA77EAAE2B46A99, 0x614A4D49E1A45457, 
-0x7706E1CC3D84C306, 0xD591765E4786D5B1, 0xC983DF3C22FFA5B, 0x76950299, 
-0x6E147CE48844B7F1, 0x3687C67CB9BED958, 0x470A165860D5C360, 0x230A8AA83DA56C6A, 
-0xF1F2CFD42A22098C, 0xF9064AA520B561B2, 0xA0315BEFAD9E8028, 0x9B3D2A9F3A01312C, 
-0xBC38739E9E71C8F5, 0x630B6FFA, 0x890AF5ABDCDD6974, 0xE8207B8CA8AB912F, 
-0x94FEFE15F1F599A4, 0xA51E6C48AD9CAE9E, 0x277C5DAF30B6EF23, 0xE2C1D35C21E65C77, 
-0x5A634D351BFA9CB8, 0xC02B5611E1B22B6B, 0x193298A5DE87B639, 0x213DEA794, 
-0xB9EE5EC84C210B36, 0x4CE7E11A2FF4E6F9, 0xBCFDD673610DD425, 0x5DBE5334961B5A29, 
-0x82D3D00A14BF9C72, 0xB7A81AC3FEE49EC0, 0xB9ACBB6FCDD00F4, 0xB34CEA7C666BDA23, 
-0x2D30F3031A596EC1, 0x21CA6C271, 0x5615F90E6008FDE2, 0x3195B04F36D2A8FF, 
-0x71EFB8C16871F759, 0x21A3FB66049C510B, 0xAAEFD5D09CA24AF6, 0x70E4AD2761F7C2D1, 
-0x3F7C7506562B8F21, 0x1DD6EA1138261F37, 0xF28AF1DB4BC39649, 0x5833DB84, 
-0x7897D3D272E0B203, 0x4210E44BE59C0088, 0xA63120AD90FFF8B, 0x61B667EE63FC9EFE, 
-0x555405740994370F, 0xAA148B527052A11D, 0x7D54539DBCCE75A3, 0x32FCD664B4159165, 
-0x9A7A50C64AF57A09, 0x11D7A5C5A, 0xE06B5CC101C3AD67, 0x95999DD0ADA25B9A, 
-0x4FF2C33EDB614192, 0xC170B0050FE3D713, 0xC3586FFE425FF94F, 0x72837393DCD29EBA, 
-0xB5B8775DBB15E144, 0xB5E6BFD91E52C8AB, 0xDE3A2E9ED329C010, 0x1E7BBF433, 
-0x5C4BF45F2EFCD500, 0xF6AE660C6711208A, 0x4D31BAD36B6F0FB4, 0x3ED4D8E17146237A, 
-0x312DD3BA2B00CA1E, 0x6BA0E5E906965F36, 0xAA5C5F7F9FDB1CA5, 0xC908716B9EA646F, 
-0x7A0F1403E41DDB30, 0x21BCCC705, 0xE49119ED04B228E7, 0xF90F9049421B7F87, 
-0x3805F3CB37A6BB83, 0xD2E2338204AAD581, 0x2A761CDAACD5241D, 0x2CB6FBAC48CE890D, 
-0x94FF4CF5FE2060B9, 0xFEC895C518E504E6, 0xC4D67A04F172CFB1, 0x9D64B1B5, 
-0xC61668B659E46A05, 0x7B6EA27ED32C8D48, 0x228C49A58D7F663A, 0xD2E604AEA5898963, 
-0x188C1AFE054F030C, 0xA32AD59D2F163133, 0xB33A77CA25555614, 0xD85AAF70F7BFA18C, 
-0xB589A36CAE976150, 0x92F0ED2C, 0x3DCF5BF866BCBC7B, 0x7929D299F3D26B9, 
-0x70BD61843E989B6, 0x2C8842AC1B5FA82A, 0x8108B458AAEDF25B, 0x64483208B530F0A2, 
-0x7547A2DDE700F5ED, 0x18F5DB63D4526B47, 0x249F227E5FC1853, 0x1F160D0D0, 
-0x2AD32E350F927EC4, 0x5794ED1257D8F8F7, 0x11BB7DDA750562E8, 0x631FE76F6BCD46BC, 
-0x9B7F0A8A94D13AF0, 0x9366A48E7F9DFBC9, 0x7E0A693664BE8AF9, 0x8E169124F812D2C1, 
-0xC75A027A0361916E, 0x181DC0607, 0xAB3C9955D0589B56, 0x4FF5B0CA3C7C3EE3, 
-0xDE621BE9479EBC16, 0x5158EDE10E994EA, 0x6D18DB6B155F8C30, 0x4053099A8DA22FC3, 
-0x75FBC055392F2E5F, 0x7015CDE61F44E9B3, 0x6B5C95A3552036D9, 0x15ACD36D3, 
-0x18CCA6BE6A017BC3, 0x97BC50C9362B0175, 0x642FD825C9D53A37, 0x98E0DC43E13BBF6A, 
-0xA93438E2769C68D5, 0xC99372DA6622104, 0x3947707B6E3B9D12, 0xAE0C7D30ECCA8A74, 
-0xCB47618D1C09B199, 0x896E5D8D, 0x24C59FEC1C28A3D9, 0xB2D0E6C87AF82CE4, 
-0x92916727065B8A62, 0xA233A233E0625290, 0xFB61E1CDE9FCBC8B, 0x6CFE016AD880559D, 
-0xCCF7B0510195EC6C, 0xB4B9E9D94FF0097C, 0x5A900524CCC57723, 0x198C28812, 
-0x206FE2589B244DF2, 0x9D0408CD9EED0656, 0x66CB41B723234038, 0xD2EB64AA2876139C, 
-0x1A2733E66B4042FF, 0xAF052E2B58D03FA7, 0x554F1947B0C86591, 0x9ABB4639EE73B13C, 
-0x364122A47C5D7662, 0xC1CA5F61, 0xC0F523D504414A99, 0xB4E14BA5E1FF7C97, 
-0xDD33466E9255E6E9, 0xFC0F93696D5EE5D1, 0x66ECF3822EAEE9BD, 0x5C6218833A80D7C8, 
-0xC06A917B59D43AEA, 0x4289E257FC25461B, 0x2B9DC9A95398BE19, 0x270481B2B, 
-0x6B097B4D4D0B293C, 0xD885165F9351DA69, 0x7400DA7638A8C37F, 0x2E7771F6AFA2131C, 
-0xA23493CCAE34B0FB, 0x5473CDA7EF7953F, 0xBA45B3CC996C3EA, 0xD322E2394F1BB7C0, 
-0x687827A87EECF3EE, 0x1B4131640, 0xA64DACEE822FF769, 0xD7ED7E2EE38177C5, 
-0x3AFAC04A29E22E19, 0x951E6E365F031F25, 0xCE634C1656644FB5, 0x5B7D8CF22AB69088, 
-0xBA651422C36166EA, 0xE3E9A7FFF8E515C9, 0xF6041426514553B1, 0x1D6434184, 
-0x41F82107559074CC, 0x7EEBCFE0AB8C33D9, 0x8CFBCB37C4476262, 0xEBCD5B67B140712A, 
-0xD4DA2861A043D9AD, 0x68EEFD9AEBF4F181, 0x61D2FC61932E76D3, 0x3E8BC9DCDEA46F29, 
-0x8477237773BFD85C, 0x11D98050, 0x609481B702A4DB18, 0x3A49FCD89A349CF5, 
-0xCE25131E81848625, 0x4CA6B449624EAB20, 0x8B9FBD201D43A3DB, 0xDACF0C3E8F95EEDD, 
-0x6E21B4A9D59CD388, 0x8D8C4C84E1400972, 0xBD205A29937B2292, 0x23479E502, 
-0xD8F711002E39D768, 0x967D49F7F8D8A45D, 0x536AFE68A31D0B3B, 0x66ECDAC4CFD3DA97, 
-0xA1BCA640DFEEA236, 0x739A97BC7072BEF6, 0x40019AF0750A9DF5, 0x8C149F9F03567490, 
-0xED8F9531B30A8C6B, 0x1139D78FE, 0xF04B1FF8CE339AD6, 0x3573BDFFF4D34CFC, 
-0x100D79A0B248D7B8, 0x9AFA970CDE15D143, 0xD0D47974F166301E, 0xD2A9610E7E5B8C44, 
-0xCAACED48B9C210C0, 0xEEEBE66AA7A38736, 0x13819C7B58C59ECA, 0x7BD22C66, 
-0x239C8375886756BC, 0x20C734C6310A4B3E, 0xCDD3BD5D6F9F7685, 0x80321C1B26B5BAA6, 
-0x241699EF0B22B4EB, 0x6CC6BEDBF78565F7, 0xBCF2B6A17A4B093D, 0x19BA0335D7942FCB, 
-0x4F56004092CD24F0, 0x1FBC86978, 0xADBA8F475D55469A, 0xD3ECA9C51FF016A4, 
-0xC3EC22DD545F53B2, 0x50C60628623E6EA9, 0x58CB16F52C190C34, 0xDCC529BA1B441067, 
-0x1FB7353B1A857A61, 0x48359768670B0F15, 0x8BD8011A6A3C7D29, 0x22BA3B608, 
-0xE6F15D64ACBAFBB5, 0xC70D3A0EB300A4AB, 0x6F38E8F0B0F23558, 0xE32293EECD0F7EE5, 
-0xC788D8E1010865E2, 0xCAB12D1D53E96E89, 0x21E4A1C870E27B47, 0xF130FB3E48D5BAAC, 
-0xA8D43283D640B702, 0x12DC82CDF, 0x4E40E80A9389E098, 0x8D566A5359DE3BFB, 
-0x54FA9AAFA0A4E140, 0xE5F80BD65F67054, 0x733212699B58CA0D, 0xCFE781A63F7711DD, 
-0xDE74D19599878991, 0x14A5174B1CC1A02, 0x4971C4EE15990364, 0x110546D87, 
-0xBF444479451DF407, 0xA605E6B84FEFFB5, 0x37D14F63AFA3CC25, 0x1CD1C36A465C7822, 
-0xC6A2B0BCFF36AE70, 0x5542A070CB8ED99A, 0xF57D566A3EDB0F82, 0x7F2054ABB9A1B043, 
-0x9E579120E3398727, 0x2183490FC, 0x859B2C4A2BC182AD, 0x1338D4B718921F14, 
-0xFB8E5C225FAFBF2A, 0x6D6210CFC3471A02, 0x2DC4E597A6E7C2D0, 0xDF43D2556C8A582D, 
-0xDDBADECAA9F83E63, 0x3AFCD0191A011BD1, 0x4A1CF66729903F4, 0xCC128BAF, 
-0x1590FC93C2BA5D4B, 0x4D731BD3C29B69F6, 0x92E6FBC9FC1F42FF, 0xBDF64491D185BBAE, 
-0x66F9B4D8BE5E240C, 0xA15B67D44E6E923B, 0xD21C8B167A953FB2, 0xD62FF3A29212F072, 
-0x557D03969B3BAFBC, 0x1E019C06A, 0x8C1E4A9DC2C03D95, 0x9B5361CD96E3585F, 
-0xAC8D22537E462B11, 0x6C509BCBE91B7123, 0x2DF98D4E2316D8AF, 0x4F8DB536F56C52A4, 
-0xBD9F411ECDEC2A25, 0x355FA2A01E76DDD0, 0xB048806E94F536A6, 0x2432CAE89, 
-0xD093F8B9F9EA8CA7, 0xBC5E08FB997420BA, 0xED35351E872548D4, 0x4A357D7BB3B5277, 
-0x14388A7EA6E52161, 0x691569611DE8A92D, 0x52AE9E25553CA618, 0xD52B2CDBDF5F7AC1, 
-0x79060A07B7B5721E, 0x26754D431, 0xE80F8C779BC35ECE, 0x3CF1E636DE627978, 
-0x43D276AD0841F499, 0x38D89460FE1B8CB4, 0xD5717F4389D93D95, 0x83B79F60FDBCAB0, 
-0xA09CD9AB23DB42E5, 0x5A682FA4CECBF73C, 0x9CD5FA9C7E8EB69B, 0x21C5CBDC7, 
-0x41CD4CCBF3D56749, 0xD0A19958B1007A40, 0x9306530C26021E7F, 0x454C54F82E8E5AFE, 
-0x97293B81B50CF730, 0x110C1880C4BCD6A0, 0x7AFCDEF736866FA3, 0x9FBD1E4962160CFC, 
-0x264D55521E343B58, 0x118B33CCC, 0xFC7F7FD13E1C15C9, 0x9F350E47C63E8F13, 
-0x1383B5870232FB26, 0xB8B384D2DEA4688E, 0xEE7E5E198BEF9B86, 0xEE2EBFF4259D8F89, 
-0x7EA4137B30DF87AC, 0x1D97891E49C33400, 0x14192FE70FFB7E5E, 0x242FAEC35, 
-0x209A0ECBB2B30BE0, 0x366A020154894AE, 0x28BE283FDE7A51E6, 0xA91F715541341427, 
-0x8E3C2E37044C34A7, 0xC261E32CA22BBD7D, 0x7EBD9F708FD05A0D, 0xBF0EB996B870E8F9, 
-0x709AB2596ADA7BF1, 0x3F7C692D, 0xAC69A0EA7D1FD1E6, 0x8204A12F8F80BDC5, 
-0x7385C9AC53BD8D8F, 0xD3493D14ED576841, 0xA7978AF682F21882, 0x6E07BE6271F16906, 
-0xF6B2C32245417085, 0xAF013A4BD2AB5A49, 0xCF796D1AAD6FD8BE, 0xC9CE4C75, 
-0xB97E9323573185E7, 0xFF7DF971A0F623DF, 0xF00D25DDBE2FD251, 0x5EF7DFE2798E8B40, 
-0x1D125AC246A51D06, 0x923CE7E9BAC190C3, 0x88267F9A6957400B, 0x97042AF052163FA, 
-0x9A1DC90BA7C1ECCA, 0x1A64152C3, 0xA7D8D6A821A02B2B, 0xF5753A59C329832, 
-0x8B025AD0B1F420D2, 0xC78A585D73E02B13, 0x9569BF397781DE02, 0x2AEE677B0521FAA2, 
-0xDB9568305205A50D, 0x91C18B56972FB39B, 0x2ACADCA9946F20A6, 0x1E62E105E, 
-0x3D0145AB0E69EC96, 0x66EE7404B5D9DE52, 0x29FB1E02052A5F3B, 0xB477F81732AF140B, 
-0x6C1A392777B61A4D, 0x5B3F12E8EDD0B0D7, 0x6E454432CD3422CA, 0x3674978041222052, 
-0xE2AA8D73AF81470C, 0xCA85E742, 0xB897BE92B4B7DB34, 0x69555623C896C16F, 
-0x1EEB34DB61F78C5, 0xF0BE57BC39C54453, 0xEEFAB3FF77B1B0A5, 0xD4549E665F67E2B8, 
-0x908F9F5D1AF3B323, 0xD936F6556D26C639, 0xB3C3FC0D651A8F80, 0x78387BAF, 
-0xC060D0DAAFADD213, 0x58DEDC9572350E39, 0xE041C2B0B303B422, 0x681F79D10021241B, 
-0xB53D6D9AB83C1FBF, 0x4550EB21D8D3DA51, 0x64C1892EC6269D2A, 0xE308195085380DC9, 
-0xEDE4B0FF67BD2E81, 0xE7566B38, 0xE28AA266F196880E, 0x62A72224C5A89306, 
-0xBA387728512A1353, 0xED982B0884759026, 0xE003E551BF04504B, 0x5EA1AF0883D07F6F, 
-0x5693DBA7FB0E19FD, 0x7ECDCE9ACACFAD72, 0x812411D89372FED, 0x28017792, 
-0xB426DD473E1082E2, 0xAAEC5926A31919AF, 0x7BFCA5CEEE21FDC0, 0xB05BE653BDD379E3, 
-0xC82B699C079EABD2, 0x4A1AF96307A86484, 0x13D116D3120AE6B8, 0x2AC3ABFCBEBDC9D1, 
-0xA0B4339EC8EB5F1B, 0x1A82EAF8, 0x8B125C8E592A9BA9, 0x7F449CE55E68CE7D, 
-0x88F2477A6586C3D6, 0x6A9C9714800420A4, 0xBDC4D6B90B9EE048, 0xAA172C6A135250E, 
-0x3E526FB00FBBC0BD, 0x5652CE30903C9EF2, 0x62E275750941CBC1, 0x1237EFE7F, 
-0xD8CDD38C22B846BD, 0x3732D41FA2E5297F, 0x6586ED601DA77F7, 0x56BB4DF3F3F3949C, 
-0x7AA739A6B3B05C25, 0x7090029F1330F6F7, 0x8343687C35C9EE06, 0xCBE4FAF806B643E8, 
-0xC700FDC25B9746D5, 0x9A00B91B, 0xC01AB9AADFDF0F92, 0xC8D883D456218B1F, 
-0xB06E8410F4E223C, 0xBA971C9A6AFD2750, 0x1AF7640BB06D371, 0x69796D9C3D0542F1, 
-0xD9D2D571CC9579FD, 0x3142A429DC088DDB, 0xE4BC4C85470133F6, 0x1949AA2A3, 
-0xCAC4695FE15E6076, 0x564ABAC9191F3173, 0x88FBC62DF830B506, 0x6CD29A972D1DC01B, 
-0xF3A49056CC2B00B0, 0xB823487984B44744, 0xED9C3B072D3265A9, 0x660A997042A614FB, 
-0x88A9F0DF997C5331, 0x23E4FA4ED, 0x2E923D5B0BA6C44D, 0xF55E0AA1DD1A7928, 
-0xA83745D0E58A3E60, 0xBD2AF03651E35E53, 0x9793AED45A770D19, 0x1DF2E8DB23DEF588, 
-0xF7DC758FC13D7929, 0x82E3EC9621EF0F5, 0x53A9A8061162504F, 0x1FB72DAD4, 
-0x835B4FDB2FA56FB3, 0x795EC5D1ED33F790, 0x6D081184FB7F9C00, 0x61500E3FE1128754, 
-0xCA0D2D999EDE4FB7, 0x9BB2A14A996A6CAF, 0x84263AA98F4F22C3, 0xBF48AEDE76D43006, 
-0xA23A877630C102E6, 0x14D076729, 0x1D601905DB874BBE, 0x840893AD9EFA504F, 
-0x583FA6F98760D341, 0xBB700F696922F514, 0x3EEA17C2CB919BEB, 0x60F021AD3C8D0A13, 
-0xA2E09BA646FD1971, 0x65106B30E8120467, 0x9AB044D6E798F4C3, 0x12CB4D06D, 
-0x7B2C6240C4D1A78, 0x54C585BAF70379EF, 0x3900D56DEA58857B, 0xA48F9BA0683C0D9A, 
-0x7812ED5E476C50E, 0x9ECBF69BEDB672B5, 0xAEEB962D1B8F1160, 0xD59DA79BE0EB920D, 
-0xC5C95320F6226557, 0x24FB5419B, 0xC35C61B5E12838DE, 0xC73B8FB351CB1081, 
-0x6E80D39053C6624F, 0x99E63508DD7BE59C, 0x9D8EA18243C47F4F, 0x98C61A3F3DE52B97, 
-0xC11439F5C7210C65, 0x4A0C95DC184ED771, 0xE56C48F1640562B9, 0x213BD728D, 
-0x55546EB4E1F9F810, 0xB332B877E685856E, 0xA694DAC906DEA5EA, 0xC6ADC05B40E05FE2, 
-0xA0B6B236929E9E60, 0xB4B96F6439B8ED52, 0xCBF8B16542B83F38, 0xBF684F387F3CA8FD, 
-0x603D83A7C4C46496, 0x1996ED2B2, 0x2FD83564B2138B16, 0x1507589D705D5CCA, 
-0xAA407442B24442C, 0x565B7080FF543D3B, 0x9FEA7EBEB4F0FD32, 0x6BD26968FACA6265, 
-0x13E7E6BB3E91821B, 0xF500EE3BA984C989, 0x1AFB39C1F42ADE31, 0xA12BF8AE, 
-0x546AAA462C71BD64, 0xBEAAEE68BE7053EC, 0x1B7E20E0C10B13C3, 0xE6AF97D9B630B486, 
-0x6B94A088DE5E30E2, 0xABBE72B67621D479, 0xF031FEE54564E3C6, 0x32C16FCA3DF7C09D, 
-0x76A43FD2CC2AFE03, 0x70AEA1E2, 0x7EA05FB2A380B9E0, 0xBEA16D55E5F4C69C, 
-0xD5D5C8EC86CCB63C, 0x52CFBE78E3CE80E5, 0x44721D73E99CA7F1, 0xD1B7F540647B78CE, 
-0xAEFFBAE35AB952E0, 0x2446C0D013E36334, 0xD5D1E1CC65A311A8, 0x3A8CCDAF, 
-0x8DF1C5D6BF46D8AD, 0xACFC9EFC568A1B29, 0xFA3263D840DA6095, 0x9F0B88C65B876DA3, 
-0xB0134F10ECC6BF48, 0x977E1BEBDAFD18B2, 0xC10FFD415BFA5861, 0x8389DC34D0715269, 
-0x221C7796E244F9FE, 0x898E891B, 0x75F00F779865FE6, 0x82FC4CB8ED9F2ABE, 
-0xAF5D300C9814E4C1, 0x7CC5AD2295EECA37, 0x44275725347D53DA, 0xCBCA27957EACF87, 
-0x185F840DA7F627A7, 0x3B29780D1F15A0A4, 0x8214964A402D92B4, 0x1266FA6B6, 
-0xD2ABA4879E57648A, 0x3E153044A3F7E341, 0xBD4CF4DBBAB87CCA, 0xC16886335E79CF75, 
-0x7BA8C62663FD2B9C, 0x83D2CF90994F25D8, 0xDED5D363EDD66DB7, 0x2578EE07C980CB64, 
-0x15CEF86967B6DF99, 0x1F5228332, 0x70B033FA02F558BB, 0xFB89190A29809963, 
-0x827CFED7CEBFD7AB, 0xEB080523D881865C, 0xC2677C9C7760D561, 0xDF1B064CFE81D7F0, 
-0x99E056F891E6ED36, 0x6EB2C5E638EAD9D7, 0xCC82AE39E4E26BEC, 0xDCEE6013, 
-0xBD62BA50C7EF1EC1, 0xD2C2B98D53DF5BB0, 0x2A020F33D84E1045, 0x40D957C16FFD264, 
-0x1E698F7CA16B01A4, 0x59F980A708543CD4, 0x5E6C9F2B4FEFEFB9, 0x6A4B8668C08579BB, 
-0x1E4B6186851DD3AE, 0x1D3D9C61E, 0xE1E35887CFF56ED9, 0x7052DFF946CABEAD, 
-0x7B3B04316285A61C, 0xFCD8E385935C1D95, 0x8B2C15CB72500802, 0x1FF53982D71B4BBC, 
-0xB824FCDC6121FCC6, 0xD7770CF5D800B8DF, 0xDAF7CF3CF31302B7, 0xC643CEC0, 
-0xBB7DE1716E58028E, 0x93C2056DC38518A4, 0xAB2D85B7DACAD157, 0xEDE39C7DD0763C6A, 
-0xD115B46359EE5D8, 0xA7FE723298823F28, 0xFF6024D6C0CAC792, 0xD9EB9A7F6053BE7B, 
-0x2B8B17B7D4EA6009, 0x1D8BB2619, 0xA37AA871DDBE50F1, 0xFC7200DDE9941389, 
-0xF379E94F1E7922BC, 0x4D527E87A004E3CE, 0x17AD05710E109C3, 0x55C02D3C2795E60B, 
-0x3833A91D81FBCDAD, 0x37AA0E6F23375EC2, 0xBC761D71102DE24B, 0x19204C515, 
-0xF58A0AF610D76EC7, 0xE29A346291A88276, 0x577A54DEB830C1ED, 0x98CEC39DCC70B0C4, 
-0x4CC591E272219FC0, 0xD1F29A642B6485D4, 0x3E6E2CA77972EF23, 0xB61093BB3CBE030C, 
-0x45DA0B44242AA924, 0x1EB9B6262, 0x785F558BD7FD993, 0xDEF567F9ACF4C47D, 
-0xBEB5D0A2A37C5C07, 0x9495708C24BCCFF6, 0x2B802DBC6C0C8C0, 0x3F85D2A1F14B5217, 
-0x1F2D4FFF2F804922, 0x8CA6948CD5098C6E, 0xF72C9F8D25E51C16, 0x27B93920E, 
-0x3D3495BA10914D25, 0x37AE8F8679CB24A0, 0xAB6E9B74D76EE652, 0xD9EACCA6043C36D9, 
-0x7836D0744E5A26CB, 0xC024D8C73E1CE94F, 0xD015F5D8E80B5262, 0xFD279C9BCC1ACEC0, 
-0x3C84DBF90DE9389, 0x4E6B53B, 0x220BC0EB87316292, 0x4B64CB1451D5C488, 
-0x7048DDE5AF5F64D6, 0xB39DAC2A8727AD86, 0xABE36BAB08876718, 0x7D60538095B49AFD, 
-0x9116724E2981C168, 0x15C50005E4CA89B7, 0x8965A44E69BF6406, 0x209557842, 
-0x8B8C3690BBFA0B31, 0x91C244B0EF54EEB0, 0xB6B515167F172AFB, 0xEB3304E6F34CE170, 
-0xACC0F195833FCD6E, 0xE2E31D6FCB52A50, 0x8EECAB5A3614151B, 0x2695B1522EBAD978, 
-0xF535A019A64A9AE4, 0x136EEC32E, 0x4E895CCED4F5E7E2, 0x6418DA670BF789F2, 
-0x946E297E2A18A2B2, 0x338EE832CA5947DC, 0xBE6828035CFBEB20, 0x9D00425DEB190647, 
-0x1048EC4E41C37E7E, 0x3D00D2D60029EBE0, 0xF3C91829E4DCF821, 0x1EC558C2D, 
-0x5D9525F93C9D2874, 0x83CC932970140DB1, 0xD1A78E73246739DA, 0x9334C0EF13CFF159, 
-0xBA0FFA8B9C3C561, 0x473719255F992979, 0xFB6F55573DDF9DFD, 0x17E9B8F7FA45C4D9, 
-0xBD5674869A5DEE1E, 0x12865C91F, 0x4FBD2DB5B4FFC27E, 0xD13CCDD19BA527FD, 
-0x2ABB0181BC1680F8, 0xB811EA194854024C, 0x1DD4AAB825509876, 0x97861E0BE8E0ED2F, 
-0x4868F7B8D1AF4CC1, 0x7119F0421D2047EF, 0x45ADD852B7F2E398, 0x7764F2AD, 
-0x56A4B0084DF3A2B8, 0xC4D42337B70D70B, 0xB9923E797729F713, 0x626BDF6CF7BF7C00, 
-0x64CAB8A977FB9397, 0xC56635000EC8652E, 0x971A11A8182C725C, 0x25C8BF80B24F4CA3, 
-0xF68E42D1B975256D, 0x26B9142D7, 0x64427AFF3A014728, 0xF0F801E55083D496, 
-0x23EB2D5486D52D6B, 0x6817AC715D5538E6, 0x4E5FEFA8396CE709, 0x69C926D30687517B, 
-0x659A36BD55D9EC5B, 0x71F206060955E8E8, 0x7C682E16055767F8, 0x1C1F5D260, 
-0x814326DC40825F08, 0x1A6BEE89BA05EBB9, 0x48F89603B410C92D, 0xCF558B348D26D2D9, 
-0xD69B64C7DFDF74B2, 0x26B74BC1118FC5E6, 0x8A5E862EE58CFDD6, 0xB98A46FEA0814AFF, 
-0x3252B38E16CE2850, 0x223A6A4A2, 0x4F7BF1C2B2B819F5, 0x53850C4E3CA82C23, 
-0x86EFC6FE181E84CE, 0xD49A9DBF301DFD7A, 0xB722CD5ECFFD0FFE, 0x9687AA95F69D86AA, 
-0x6CEB9665D660203D, 0x8B92A882D1979E7C, 0xC60F5A7775CFA55F, 0x15947C996, 
-0xE455376B9646C727, 0xB5E741332D540C90, 0x6DA0474DC57C1A39, 0x35E33CEC6164B007, 
-0x24AC72837314956A, 0x4D62C127AE79067, 0xC3D3EB9033FCB07C, 0x5B4E97D4DA165B9E, 
-0xFB5BC7D4577F0CE1, 0x91C5DC89, 0x20FEC8033EE7E617, 0x1D1541947726DD67, 
-0x2D159C2A71457D7A, 0x4692B27814A7F72E, 0xC8017686D60EA6A, 0x4C8952D1DA2E26E, 
-0x65F710060721F8AE, 0x4872C8241AADB803, 0x96FF1818F380D504, 0x1B188CCCA, 
-0xAB6D56EEC1E5EFD8, 0xD4E49556DBDD7580, 0x9FF7BD5DA3F9F81E, 0x56B13BAC07461012, 
-0x3A0D8204ECB331AB, 0x43C7FCE19153507A, 0x67BD8986D7065C83, 0x55BFDA092C9F2878, 
-0xB3333DFCAAFFB01F, 0x3F137110, 0x864892C2062FF5E0, 0xB1C940F3D1600863, 
-0xD5E3A67A35DB64D6, 0x85498C879EE7FD5B, 0x4C25B210DFA73A7, 0x3FED1A76DFEA15B0, 
-0xF2FC1EE766D1CF54, 0xF75E41A18F6AAE50, 0xA7B86CFF9BCFDD7C, 0x38FB186A, 
-0x45600C1EB6CB0219, 0x31DA36DD86047A29, 0xBBB7F24CA96F4A08, 0xA47E54BEFAC2DD66, 
-0xFA126FAF626C9C3C, 0x1229002FECD119D5, 0x1F94547FB36572A7, 0xF16127F5842E9F3E, 
-0x1EBB882BF0C52BD1, 0x1B106E8B3, 0x1E2E5C5ED52DFCDE, 0xED2E19A2DF06730F, 
-0x29A06E61AC0A2AB1, 0xAB368B1BDD09EFDE, 0x185C5E8ABF936431, 0xBDFA82B4E0A55004, 
-0xC9B75423065327C4, 0x146A1A9246E27600, 0x6E251AAA2336A7B2, 0x17ABB3371, 
-0x17AC38D50CE96AAD, 0xDD0B1D3EE0DF475E, 0x2D54CC6778407304, 0xD7C71C5ED9AB8E04, 
-0x21394B05EAF04A7E, 0xFE9468315DAEB3AE, 0x4A6AC86424B78A5C, 0x574755DE7010E895, 
-0x6A497C60EBD2B469, 0x1F33C1EE4, 0xA4317DCD0A5568A4, 0x51EC5319D9B17941, 
-0x5C683DBCAB978FB3, 0x3F24AC22860EAB99, 0xC38AA47A95269E7, 0x7F43B7CB64315F8D, 
-0x19A27F1ABDC78EC1, 0xCCB09A22600C946C, 0xAF255BDB7177085D, 0x139223A06, 
-0xAC43A5E4BE5DDEE7, 0x48258406C627E7A1, 0xC8201370F1C3BE5F, 0xBE436C64ABC3DB3F, 
-0x483889D82728692, 0x1D8C1DE4D8E78A28, 0xC1BF58E690023F81, 0xBC4C101C2E442850, 
-0xED9214CC5C9B8B2, 0x261421560, 0xC907FD73ED4F89FE, 0x2089FD36E6E9B619, 
-0xFB50474C5AC5EF84, 0x78EDE417AF8C6E3F, 0x9E4A2518AB750A16, 0x67ACCAE95DD06138, 
-0x3920B618FC21988C, 0xC2AFA0C435D91FF2, 0x9A52BB177F457CBE, 0x174C40021, 
-0x38A07F6F2AAEDC5, 0x4CD740C36E61BD99, 0x1D828252CF2A6075, 0x34D007222B748E71, 
-0x12E6D5A3CEC7E01F, 0xD0FF585C76192E0, 0x5F69EFD10383488B, 0x7C2F9D3EABBD2929, 
-0xDF93141CA62131F, 0xBE57140B, 0x3AC0372B621E3443, 0xCA55AB691FCF52C1, 
-0xD62E7DF3EB7CE3DF, 0x26EDB6A47D1DF413, 0xA2C292CF6B179C81, 0xAFB18ECDFF78FAE9, 
-0x830AC4F928CAE037, 0xFF6795D6DA4F1350, 0xC901FC2857B95A5C, 0x2119CBBC4, 
-0x9BCFE75FF2476582, 0xB135E976E7F0E34D, 0x6A704467C05FD844, 0x4BFD5542DCABB30C, 
-0xD2DDE0E41021235B, 0x78E538371E1D1F6D, 0x8C0532442A8F5C5B, 0x5A30687BD161BB7F, 
-0x3B0AFBC7C603A28, 0x55E0D604, 0xFADD1BAFBE6F9799, 0x31816522D888E2B4, 
-0x93928DD49A73C788, 0x9518AC3D94DCB6B4, 0xD26BE08D3E6F6C81, 0x9A2B39EC34F3FA09, 
-0x994D2D5CE9E836EE, 0x830B84CE354BFC2D, 0xFA2C57DE77D639B, 0xF0B79703, 
-0x7C063936E18BF887, 0xF1A96C206C9EC568, 0xC8C0089868CF6E32, 0x7DFB3AA4954E7DA2, 
-0x7C702563491E1FB2, 0x39393075BDF3A603, 0x76C24E57D78DF441, 0x1010CFF268D9D9A8, 
-0xE01EA57F223BCFC2, 0x152F02DF, 0x88C9F237317C8503, 0x312BAC6AE387A378, 
-0x6A2501311B61D97B, 0xB75B5758D2193E0D, 0x2195202F344360C9, 0xD16A3100F0417B90, 
-0x66E71DF2D4AC42CE, 0xBF2E18F01B0AA418, 0xE6CB9EB5490431AF, 0xF773B165, 
-0xDBA714D489DD70A3, 0x14F32F1053DE64F9, 0x2C8E8DDF76B7026E, 0xBF0ADE80C203163E, 
-0x9F016BEA314D57E7, 0x44BFA45547E62DD6, 0x9CABFA71C838CFED, 0x8DB0A0A3D4E5C164, 
-0x3493B09AC2EEEB6A, 0x262E9D0B0, 0x9DD6990EED62E6F6, 0x816387332F3112E5, 
-0xD028BA543C46DDB9, 0x75EE2F51B9B5E43, 0x93A1765898BBB70, 0xF5E1EC744D172662, 
-0xD3BDBB0FB59DA6BB, 0x87D43239BBC3D752, 0xC3DBBC6C6075034, 0x24B5B1C4C, 
-0xA288060E9A8E04DF, 0x352B4AD82BE9CAFF, 0x872CF564BA60BBCD, 0xDBE5A8773C40D5E6, 
-0x1CFF42486CB74E70, 0x29451739FD977B88, 0x96AB31ED8F92799, 0xDDAD46BAF71544B5, 
-0x293EDEBB45963A0A, 0x1A6563E3A, 0x2E684154CC6C492A, 0x10C847F50E65E4EA, 
-0xCEC666A28506077B, 0x847807E3E32ED46F, 0xD950E37AD2816582, 0xC6CB0E63535E61CD, 
-0x28C2752DF3DB8B60, 0x2EFDE34ECFE90234, 0x20FC0849345B6758, 0x133C5309, 
-0x8A76E8D04CBD03D8, 0xBB2BC96AED0F718E, 0xB5A5BAE12E7DABC5, 0xE3928361258712EB, 
-0x23390C1EB5AA00EB, 0x140F1F6D6341C271, 0x94D3A1E15B5D233F, 0xF15F1195C21735E8, 
-0x13293B115D5EF57B, 0x8D64F212, 0xDF19193C687C939D, 0xFFB849C1F603E028, 
-0xA0EAF2AB5E1C2F5E, 0x26A5D2141A0C9D9B, 0x9C8A1708BC466BB, 0xA03F06F698F1E57, 
-0xD4B89711E84EB1D8, 0xB84B7E93C3D9C296, 0x919AE730A89A2708, 0xFF09B49B, 
-0x22E6400989C89E96, 0xCCCE317312D2A92, 0x4224A37546436354, 0x3F77FD88FA965E94, 
-0xD203E5163A7A7D76, 0x2931D5FDD7EE4005, 0x7A26F5DE9FB30DFD, 0x155F2C11C5BAE6E5, 
-0xD165FC137F41AE4E, 0x1391B36FD, 0x6E477AC0704A39A4, 0x7714DF9A8F190B01, 
-0xB3C34C9A60DD4E, 0x85814F2B9F97BF0C, 0xB1F0DAAB07157920, 0xDFC3B725EFCBB96, 
-0xCAB5E02C581DB653, 0xBDC338508A47187C, 0x4E6894964EA8EEDA, 0xB6CECBE9, 
-0xCD80739EE56EE3E9, 0xA3FC91A7036423F8, 0x476B4B8265FEC102, 0x456BDA1AECDFD037, 
-0xFECF6827FCA2CFDE, 0xA684D8C232D05EBC, 0x29EDE1EC1E193111, 0x560EE1D798F949C7, 
-0x5620033205904937, 0x549E9901, 0xBD3409D75BD5A07E, 0x31E8CA9F69BADFF9, 
-0x17DB3DEF93D91597, 0x8B7753AD2B08ADB7, 0xB9AD079D0AE58E35, 0xB426FCEBA3FA0B32, 
-0xDA66E04F906F7B81, 0x3610418067867A9F, 0xC164139383F777E1, 0x11BCBF57E, 
-0xAFFF66806E9A8F8A, 0x21B7956A28048CAA, 0xEAB6FB928B9D0D1F, 0x68159F71A7CA2E13, 
-0x5C9307F6901E65CE, 0x892BEDE49941A186, 0xD6517A38FC9BDAD, 0x443327A194A07FE7, 
-0x62AB58FF3ED5FC83, 0x183CC23D7, 0xC2819A8A6B6CE662, 0xB2D031AD05E6784B, 
-0x247672C95D88F7F5, 0xB8883F43A12D3CE3, 0xB50F1632F9C655C5, 0x900E6D885459CC06, 
-0x9C228B05BAE9FE7C, 0xD20E91D0F692F10C, 0x752BB595D922E006, 0x5784E35B, 
-0x38450C84FE448926, 0x4533C425BA5F05F4, 0xE643B6ACF66E7537, 0x4A022B08613D0AA5, 
-0xE90E062A7DA516A2, 0xC92D82CF1BE7D9F7, 0x548853456C6CE4B7, 0x7A1B54F251FECC70, 
-0x9D43DC02B65C2F47, 0x13908DE56, 0xACA0A9EB7AAB3EA7, 0x6FB10EEE294E9345, 
-0x802F4732AB717AD4, 0x9582028E4BF0D56D, 0x92B9097B6807FAC2, 0xCD252EF86E8C76CC, 
-0xB1033121579B66FB, 0x7DF0E9C92308A63B, 0xB58E0A57298E5365, 0x226686878, 
-0xE9E3E0776FE1E8A9, 0x1C3A903B91B075FB, 0x25FA5583EB485955, 0x6FAA7D069C7D1D65, 
-0x2C87D0C6C8BC115C, 0xD3F4C3F83C45BE0B, 0xF4B907926419E279, 0xFC48FB97C7544A59, 
-0x1D93E90494CCE75B, 0x1B279B2B6, 0x89428856879F2382, 0xFED2BE6DBFA67FDE, 
-0x62A0573CD2CF8591, 0xF308E570C9BD6BC7, 0xA28FD520273C2B0C, 0xEE536FCFA91C1A09, 
-0x32BF4943FDCB0A6D, 0xF96BAD2FD70E11BF, 0xB7C4C86151719D02, 0x7EBB1234, 
-0xA082E513E1AE5E79, 0x3EB18A3EF2C66023, 0x172A7A0A64C59F1D, 0x33EF92A6EBB05691, 
-0x98998A77925FFB0A, 0x4BC91651DC514F1E, 0x56AF5ED6E74B586A, 0x28517A050277FB92, 
-0xF611B291849B8E1B, 0x3F3635DA, 0x9EF1478B5F8E6E55, 0x1D5DAC002CD0248B, 
-0x2E806D9D83DB1223, 0x3BADCA54AD9DB610, 0x2EDC44B8E21347E9, 0x16174219B437F2C4, 
-0x4605F7FC2160555A, 0x840380E6951198B0, 0xE92F9F17FBB5D62E, 0x28B7C6DF, 
-0x32378FA2EBED4715, 0xE8B444FDEF4A9D90, 0xBC587CD22EADC0DD, 0x639679E941BECED7, 
-0x84666B256A8D3210, 0xF7A1D73AC1E157C2, 0x35E9DCDF87C9B7F5, 0x61C7A91EE3847E36, 
-0xF54A40C330C040F6, 0x132B10673, 0x3245C9A9A8893463, 0x10F1685C01B2F90B, 
-0xB3FCBDA0BEE1903B, 0x6B3E7BDF3CC13CA6, 0xCF98EC7738A92A5A, 0x6D121B2FFD7D090D, 
-0x7AA413117FE766BE, 0x9D8F1EA42924D854, 0xECE240F737F516E1, 0x24E7FBC22, 
-0xDF42F8666CAFF1F0, 0x584B9FE7896E85ED, 0xB3890ED61A71BB22, 0xD7A86523D5A50D0, 
-0xDFBFF2D0998B57E3, 0x2510F7E3BDEB7B12, 0xCE1FFF5796AC3656, 0x79F75F2912690752, 
-0xFBE31EE8FD8696DB, 0x14DB971CE, 0x64A348E3C5300F22, 0xF65B73D0423F594B, 
-0xFAC2F3B2EFA21529, 0xEBA7D8C86B29055E, 0x2B38E2E5AF85C39D, 0x35210D92E759E3BC, 
-0x3FF47BCF089D5A6D, 0x7FA0C82A12517D34, 0xCC641C64FD12B1A3, 0x14C265857, 
-0x299DB9A0B24AD931, 0x69CDA4FF16D68B92, 0xAB67304F94F09667, 0xAEF5EE0FE7047626, 
-0x6CD12F1B03EC9071, 0xCE1FF703C7E0F56C, 0x2DE00C49BB21BA0F, 0x9901B1B2434664F8, 
-0x4A265FF7EDBE4F82, 0x135D95390, 0x8E9C9EF735095782, 0x10FAB588A9EF6CB0, 
-0x9D71DEBED4A2E128, 0x890EB0F7A7E05B43, 0xD590A77E64CF5ABF, 0xF8FD49FE7ABDEA1C, 
-0xB503EAA9036DDC73, 0x8704E2A0E93B249B, 0x6BE99D1767AAA1E8, 0x505D30, 
-0x57A36DC8776EB996, 0x9C6928684DA6C64A, 0xA9FC9CBE19B57649, 0x276355AEDA29B267, 
-0x3BF8555BBE292D02, 0x11B51C1E90C0C421, 0xF5DA76CC8BF0D40A, 0xBB7F5FFA84B3EB09, 
-0xBB433F1522B2A93A, 0x968F0B9F, 0x3EBBCECFFA5EEFA2, 0xEE3E6941AAFB5F56, 
-0xC6CCC1072DE2BE06, 0xB6514C4A3BF6A498, 0x1982534DAE0881D4, 0x6FCD156B0F2AABAD, 
-0x4A9BC67065851694, 0x24870886ADDB2649, 0xB931AB9C3E8DA4BE, 0x45D2691E, 
-0x674C7D6F2C63BD40, 0x3D51C51495C9DA6A, 0x7A72E7DEB4C0E489, 0x995392A2BCD0B937, 
-0x2E9508AB143DD066, 0xCDC0850114EC6BA0, 0x4559F53131DD7F7D, 0x61CDB501403C73DB, 
-0xDDC46180FA7C17CA, 0x1CCF57C0B, 0x18290C8827E676B1, 0x8AFD47A3CEE0BE7E, 
-0x917875D07665AD89, 0xF89C3262F0A395EC, 0xFF35C80D4AC2EFC3, 0x41992DEEA2A957BF, 
-0xD3490B914E890305, 0x9C3EA931F19BFA04, 0x4D1569A3998EF9A6, 0x417C68F3, 
-0x64CCA1350CCC0CDE, 0x24E14F45A75C976, 0xDC8F08B3CD3D78BD, 0x3C0E9D21197DDE9F, 
-0x26DC68DB8223BDF2, 0x48EDF6DE8265BF01, 0x22352EF5E364F835, 0x1C795ACB239923B0, 
-0xC2F67D4FF8662F1E, 0x146011E5, 0xBAC7EAF7E522FF35, 0x441464B3D16F7153, 
-0xDDC68DA5DA441380, 0x2736BAB1179B0CC4, 0x68011048CA2EFCAF, 0x95E6FE0E840446AC, 
-0x50D322FEADA94639, 0x39820B6CB3F0AFAE, 0xCE329C103A54DBE, 0x2785AD777, 
-0x6F3A86B45218608E, 0x43536822765C9FE3, 0x499059FD63EFCF77, 0x7C2E6D346F2C37AC, 
-0x3FADA111CD7FC3, 0x1DAF3F6B37331576, 0xB993DC93C43FBB4F, 0x303A5BB1735519F6, 
-0x26173F67AE8AD7EB, 0x138CAC575, 0x2CC66680B491C793, 0xEB88B9A67CF7E8A0, 
-0xF948E3639917A7D3, 0x751F416772A91C6B, 0x536E15A31DE9E0E1, 0x40DC176417E23404, 
-0x1DA097F7A892306A, 0x825C94B623611E5D, 0xDCDB197FFF2225C4, 0x16D6FEBA4, 
-0xAD1DEE02F9BD6531, 0xBC60D1D2205CADAB, 0x2E75551288DC8BCC, 0xD3F23117710846EF, 
-0x7959EE3B905B4E4D, 0x27B374FAC7CA9B82, 0x8B893E32461714EB, 0x4388574645396277, 
-0xFA07D1CD83538F58, 0x21D662D40, 0x1C508DEEA2AB06D2, 0xF698B6FCB519F6FC, 
-0xE0AF547AE6DF9EB1, 0x2F2B706595C236BE, 0x6E2F529A4E1C4ECE, 0x2BFA7B001679F090, 
-0x3204BFF4BC00CFB3, 0xE597E961B99E75EF, 0x4C0A3D09B64F09D0, 0x2AD9E3BE, 
-0x1F9C66BD8DB5AA86, 0xDA52497760AEF3D8, 0xAF5BFA36381075DA, 0xB61F99B7F8F2EBE8, 
-0xFF0E970C48042CA, 0x921F166776A82AB7, 0x9397F5C9069197F0, 0x9B28F25D8752024D, 
-0xF3845F297C416523, 0x471F8384, 0x2CD96F1EAC6CE8F6, 0x65E86D116E74A4D1, 
-0x8EF2DB763C4016C9, 0xB25AC5AC2E607996, 0xCF786441BB19C7A, 0xE59F738058C3ED8B, 
-0x622C357A4915CCD, 0x60F01254B9881D63, 0xCFDF5A0E2D53DF81, 0x19BDF690E, 
-0x3A18EF2FD448BD7D, 0x29C2F2419B022BD5, 0xBEC0E907F0367EAA, 0xDF8E05E5F6CA105C, 
-0x42D854DFED8E78FB, 0xC0FDD494F1FC325F, 0xF63A7EA9012D97CF, 0x33DFD5924AE811A, 
-0xFE6C0E29AA8AFF01, 0x1EE67C9D9, 0xA14D00C7F4A288E8, 0x1BE9B37B3991D91D, 
-0x215B6090175AD48C, 0xFBF93B1B67AB497C, 0x3E8D5E3033AE6F00, 0x1832F6C4920E6022, 
-0xD5C2D75713BEA6D6, 0xEA267D8FF547AFEA, 0x80B80C5E7F5407C0, 0x169FBC642, 
-0x2790995CE6BD3ACA, 0x90922FCF2D3E8C71, 0x6F12163EEAFFEFD8, 0xB0E006354A09011B, 
-0x600F9E2E1E22210D, 0xD18AA4D8140D1923, 0x5CC4BE5038F8F36, 0x474DDE942A15FA72, 
-0x5BAA422844111DC, 0x1D53340F1, 0x44E1E24CF16C1624, 0xF14ADF339A956E77, 
-0xCAD1C67CC850B408, 0xFDF7A4E47DB9238E, 0x8C6E57D1D94EBAA0, 0x69505943AE0E4061, 
-0xA206AE762EDD3900, 0xD23EC8BB8627D7AC, 0xA1D015A1B8594D63, 0x183CFD7DB, 
-0x87BAD2E6F3D35FCF, 0xBF8B8367E7474322, 0xB2F103CAD1669A50, 0x1652E113DC3D3A33, 
-0x1ADFF9794953B9A9, 0xDD78AD3F01228A34, 0xC4A5578BA33EFBCF, 0x45F37C1F32496A5D, 
-0xE49855BC3D617982, 0x103AF04ED, 0x7E269DB363EE7507, 0x371FBF9CFA021F30, 
-0x91A1BCE3D37E9B89, 0x9621DB5C3A31D601, 0x22814DD5B0C27FE6, 0xCD027A8CAA22D7EA, 
-0xDCFE6174F0E88BC0, 0xC8C30CEBABECCCED, 0xD348603AB5ECB4B6, 0x2109983E1, 
-0x12CF5B474A0A01A1, 0x9963913DC8BE90A8, 0xAF43E60B44ED715D, 0xB7D20D8D334304E9, 
-0xD18929FA5DCB908D, 0x518B990B6F8E96D2, 0x35FE5787FF38BD1A, 0x981F9CDDDACA5462, 
-0x9582414EFE6681BE, 0x206C805D6, 0xF900F53A173996C5, 0x3EC4BA9FD5F6E1AF, 
-0xAC40A0239B3346F5, 0x463A4F4DBDCA583C, 0xFDC3340739D45DC6, 0xD002FA638D7F42AC, 
-0x7133B01BBB1CF3B5, 0x7A604B57F178A9F9, 0xA8C7E73BF4A24BF6, 0x204306F37, 
-0x665104E87CAED457, 0x1B724865A342646F, 0x4E4CCBE0049BD8BB, 0x635C549B83CDBFD2, 
-0xCD51CEB79CFC4754, 0x7046C711D33F04B1, 0xBF59D27D82592565, 0xB1AFFFE35CE9AC53, 
-0xE05F336E9B7057DB, 0x24D396244, 0xFF96B6D319A496A7, 0xBF0881046791CE2E, 
-0x51D9C6D953819417, 0x7193C234A5AAB704, 0x6F95420609E667A8, 0xDF9E64911EFDD525, 
-0xB013BA8F3C18BEFA, 0xDEB48DF03B1AE23A, 0xF7DC077905DEFA38, 0x177E07C26, 
-0x9DD5903DA8B1E3E9, 0xF606C3190E4CCC2E, 0xD5F04B8EC4E13B15, 0xD8265B5C86D53233, 
-0x1EFCB4E7511B51F8, 0x38DE78EE4E2794D0, 0x18436342CA972DF6, 0x4B83AE68F5CF3F47, 
-0x69C22939C915BEBE, 0xA7C12E52, 0xFF28C301DC6CB1B8, 0xD13D91EE2FFA32C5, 
-0x2CA89483AF949752, 0x216AC4D7497779CA, 0xF844A683E8098E87, 0xDCB6A20905710F07, 
-0xAB1CC0805630A84E, 0xCAB8CCA3C705999D, 0xF3465BBB982DB0DE, 0x45F556C7, 
-0xEC65F30E1DCFEF6, 0xACDC60AAC10FFB5A, 0x2410E71A894252F, 0x769CBEF5765183B2, 
-0xBF087D3DA60B4217, 0x491D0A7708C5D6D8, 0x4569256B4F97916E, 0x5B272788969E6404, 
-0xCC37246C367A6C57, 0x7F19C0D4, 0xC2839895D5AF464, 0x5C55F16B8437D696, 
-0x4C3ADEC64664B881, 0xA8206794E0A4AA92, 0xEA8B8E477A188BFA, 0x577E635417CBD8B0, 
-0xA41761A82F8E92DB, 0x5C53F8100ECA69FE, 0x24FCEF5D1AFB847D, 0xAC68268A, 
-0x1EDFEC88F45A615C, 0x8302AFA34C22BEB6, 0xD4DFC15DBDA2BB4E, 0xE6A3E1873A9A419D, 
-0x3D24989104C6143A, 0xD8B35E786B7B88F2, 0x3A4C97C87A2F3A4A, 0x746C7EA2F7BD4A9D, 
-0xD9EF277E4155F6B4, 0xB0EAECE, 0x2D3CE8A90E8E36E9, 0x6A4DA1CD50603D73, 
-0x9EC376B60FD10C32, 0xEDBDA31A23742E6D, 0x882EFEDB1ABDA000, 0x909AFCE9C73F86D1, 
-0xDC45ED43B7092B6E, 0x5986D4630A145D79, 0xAB80BA5929A4213B, 0x860407B5, 
-0x7C49E0825CB58515, 0x759F36A4658CB570, 0x20296E8631AED44E, 0x75BB8A051007EA6C, 
-0xC9EB7F3034537F83, 0x5A85EB88EDE3A298, 0x5030CEE0C03E2F87, 0x28CF0277BAA0156, 
-0xB23B5A9E2E8B8FD7, 0x1FD026C9B, 0xA480DDD55551C8A8, 0xA26F7A474F0A68A2, 
-0xF2996AC37E8DB51A, 0x2B46DD03594519E3, 0xDDD99C29537137BE, 0x513ECD751F9D88D2, 
-0x99ED414DF4E208F0, 0x65C7E9536FC219D5, 0x93071F4E6CC113FE, 0x65CDBE2A, 
-0x2184CE8C4468714B, 0xB49737070E65985D, 0xBDDF47C78B486D97, 0xE5CB1D1073CBB4BD, 
-0xC7F42FDE8A093AC6, 0x26F30B50F1A8451D, 0xB144A6658BCE234D, 0xB6E3F1E91EFA8B99, 
-0xFCFE5F756B61FC1A, 0x11F448B9E, 0x63C53D2AD62D6FE1, 0xD3B701CB4B65447D, 
-0x91270961FFAB3A14, 0xEA9B26D2FD491F42, 0x3ED5625AD51BC341, 0xB26EC32493FDB627, 
-0x4A9922F8C991C6CD, 0x120EE6E1C6D1AB46, 0xC349B6DFBC4F060A, 0xF74FB691, 
-0x1E55EF174D558578, 0xD92DA8DA9D8E8141, 0xFB8C5DB33AC2BDE0, 0x360A6E7306282D77, 
-0x7827DA26C3EBC7B9, 0x826AA864976EA94B, 0xA691FA3CC58BF368, 0xD1EFC709F0F2BF50, 
-0x1008C516EFD60D24, 0x13A085C35, 0x90FEF735734D713B, 0x1BD9CF9C99F1F68D, 
-0xDC9910C59BFDD7BD, 0xA7A13A565F494610, 0x2904CD8A597B59FD, 0xE6C1FE47422B77B0, 
-0x2BDC9A53BF03DF5, 0xDB6F379FD25188B5, 0x2BAF593E00B881E1, 0x734BDF83, 
-0xAB64E30BA9F498E, 0x966A7E2F99D9B123, 0xBEDE9B416E7F4ECD, 0x7F51ED912FD76FFF, 
-0xC45F1BA21B29146, 0x96FE51757AB0C255, 0x6E7AE0944986D574, 0xF956266EA5A62C67, 
-0xA7C9A707D3EB6A9F, 0xE92A21C0, 0xBDC723BFE719C017, 0xEC00881D5A16DBCB, 
-0xEDF969342A4A38EB, 0x77657CB38BA03B5F, 0x5302B5EC77097DEF, 0x4D0FD568D28F9FFE, 
-0xFC2E3275E80FFB4C, 0x779FC35323C38434, 0x47FB893D7E475279, 0x89ABAD8, 
-0x1AAE5CCAD43B0BC5, 0x5D6D7E2DBBABFE20, 0x31C11238FF1DB6DA, 0x3B01CBA30B87566F, 
-0xA77278F94C129030, 0x9849C78D21591E3E, 0x506F7FF31BC9F569, 0xB38BE7FFAFC9E5FB, 
-0xC53E4F70B562868E, 0x9BEC318B, 0x1E12545FA1AE47CD, 0x3F448B2278B1874C, 
-0x71D4F6E80CD1D0B5, 0x52ABE343FFB01ABA, 0x2E9AB3372F2C10E1, 0x34DAA88D5BCCA763, 
-0xF6CFABE74243667C, 0xF122DC81DFFA9897, 0xA9DDBABC05701280, 0xFA7E1E10, 
-0xA129E05271590822, 0x4229B8F9A5F9DD02, 0x3026D2A9A264C266, 0x42C8C5CA8107D11A, 
-0x43047B6BED1B271C, 0x72066BAFE2902D59, 0x4305F2BF68566E65, 0xE70A2290CFDDFDCF, 
-0xD66C6D8FBD653CE2, 0x7C91E8D7, 0xDF73458E0E182B2C, 0x8B3832C8C0CCE693, 
-0xBE406A78BDDFD4F0, 0x65D2881E6BFE97A5, 0x946528871BF3D17D, 0x5CC79D1FE7A7DEA0, 
-0x514ED0C2E12E63B8, 0x1F7AA27C456B20CC, 0xDB589E0733E5AE0C, 0x1E7083012, 
-0x47102C9BCD9B3E8D, 0x6B7EA8D869F843E3, 0x54A50F6E448D23F7, 0xFFEDC47A6428372F, 
-0x1AB355733ACFEC6F, 0xF6AFCC91EF616DDE, 0x613BF6EDB128DFDA, 0x431A22C71D195C03, 
-0xC3810B50E0F7D68F, 0xF79DD4A9, 0x1A8511652309F607, 0x168ECA656072818A, 
-0xA12C39185460B2AC, 0x1E561D5CBF82D15E, 0x315C17E90BA34075, 0xFB27FF960C362AAE, 
-0xDEE05C1D2A5B2C1A, 0xE6CC8FB010BB3B40, 0x47FA1C3670F7C43, 0x48FC944B, 
-0xB7BA6EA850860960, 0xDDCE129C36070264, 0xCD967750119F8C25, 0xDD95B3DA85F96A8B, 
-0xF96586C75C0D3DFC, 0x68C554ECF16BE8D3, 0xE27A72F386E734DE, 0xB112B3BF3CE34DC7, 
-0xD2AF0175394D0CD6, 0x196D1586A, 0x4288BC885734E14D, 0xCB3FFC350460C01B, 
-0x68F914055DE798C2, 0x3E2ACEB6F8840A9E, 0x5E0289AD2425B10C, 0x4629FAF0A5D64BF6, 
-0xDD875EB854182373, 0x33B6B9D0F2D89EB3, 0xC343EECCAA472B9C, 0x24C725107, 
-0x1F6FCD66688BFB32, 0xD68A8A4DE7A788A9, 0x2B198661DC39DBB2, 0xE29FE49C70552592, 
-0xAE6CB47244A18073, 0xEA271CCEC64A2FED, 0xC34DEDBA70C98A4D, 0xA2352738B4BC8E20, 
-0xE1FB892639D7D721, 0x1C7ED3683, 0xD7169C9E10B5C8DC, 0x8D0AAC84AA81B157, 
-0x43ED3091295399ED, 0x9925E1A029581925, 0xF58A0B4125B801B2, 0x7C6E7558AA21869C, 
-0xF446610C66FA3F8C, 0xB52ABEF44BAA02B, 0x532481AC885893FD, 0x2755155E4, 
-0x4A936A5C2839ED62, 0xF2C1CE12BCC2012D, 0x47620FEF0CD4A9FA, 0x476F1E3FF8D8EC8F, 
-0x71D3836CB82D7E98, 0xAB59129D208FBAC, 0x3CBF98F752D02565, 0x4E0BDBDBA214F2A8, 
-0x18D4FF630EEDDEF, 0x12D31EAC6, 0x559C19CF8BFFF79C, 0x56F9D4FA457F492, 
-0x1176A672594BC1EC, 0x93E315B650925694, 0x489862EC1AEABD7, 0xDB34259EE23323CF, 
-0x42C42794CC3B6F41, 0x2A80B250C2DFDA93, 0xE0760D916C63583, 0x2785FADD, 
-0xF8E68D642AD79094, 0xBCE97174B7BE5113, 0x708A6602DC5AEBEE, 0x9C6DDE2618E61A4B, 
-0x56529436B07CBFFB, 0x5E05CCD319CE0EA0, 0xB116485C6C8CA635, 0xEC834732A602D481, 
-0x6AA81BB69ECACB47, 0x192753BBF, 0x72D71332D7C6C658, 0xD5F8626C96ABA02, 
-0xB740FBFE1FE7EA6C, 0x316B097DBF4DEDD9, 0x7BD1CDE049B4A829, 0xE1C21AA1E43167CE, 
-0xAE10076899C41417, 0x3EBA6E34642CCA13, 0x874C0C4CEDDAB90D, 0x15D46437B, 
-0x7B818B599BBA4C86, 0x71DD0431348E2E5F, 0xC7712C3179001504, 0x9ABDD55B8F279CCC, 
-0x6135D5465C13A653, 0x174862C3C837916, 0x8E567AC021A570B4, 0x348B2E2399BD86BA, 
-0x35CF3F7B65DE88D2, 0x1AEFFB441, 0xA52AE90AF40BCA7E, 0x72B46A13BE3DFF78, 
-0xFFCC8D7C0149032E, 0x59CBDE91A7320687, 0x4C3C6D94C53D9AF1, 0x9EFB26D04425B264, 
-0xF28824FD2567D163, 0x2CB2E767ABAE7ED7, 0x305AB84B2615C379, 0x3AE9A4D6, 
-0x70546D268E151C9D, 0x94D422842EC57182, 0x8C74D924FE9E5140, 0x2BC6B3D6C9A4D16E, 
-0x36048AD61ABBE928, 0x13E3FF08B18A7AE2, 0xC11AF19AC1425327, 0x6B95458F0169A83A, 
-0x2FBA145ED6C3A5C6, 0x4218996C, 0x229A2A7AFD5056AD, 0xDF6F4F236DDDBA85, 
-0x3210C3ECE32B5DDB, 0x93739A88842C4029, 0x6E731940492C16F9, 0xF8748EF02D63850D, 
-0xF4054A3391F61197, 0x4A459ABACB9E98C2, 0xC77C654E722E1F95, 0x23732CB53, 
-0xCB9BAEB264C7401E, 0x919C320E62EDC09B, 0x488BD3EBA66D365E, 0x4FE2D9ABF24E1D8A, 
-0x31D935A493B8401F, 0x2CB76A31A5926A54, 0x9C2E91BC29B72B24, 0x846276C516BC768B, 
-0xCBD9D0EAAFEF6D41, 0x76060B8B, 0x70494F5E7FB02AB6, 0x729F3ABAF981F56B, 
-0x726A9B8EDDAF431, 0xAE1B6741F658E427, 0xC37E270B39627F3D, 0x625A784ABE53B2A1, 
-0x6569C2962762ED61, 0x54CA9F65B258E219, 0xCC409C1EC35B2CB4, 0x58C4E053, 
-0x16F5C4B3EC51F74C, 0x5F517E46B6268816, 0x346E52570E47022D, 0xC15D01D83C297F81, 
-0xAE3342833A1F2D5D, 0x9937CEF72535A786, 0xBDE4F54C82E4F942, 0x27ECF7AE8AC5A89B, 
-0x52122697CF793F50, 0x14C1FFC97, 0x6B0CEEFFDEAED071, 0x12A2041481BC0695, 
-0xB59DF70D433ED486, 0xD4EE56BC1FDFFCD2, 0xC9F348F8E8639C00, 0x3AC9C3B0B59595A6, 
-0xECEA1455C097E136, 0xE3EB5F42E5973109, 0x8CDC76360D3902EC, 0x1A6DC3EC1, 
-0xB1399CF28A701075, 0xA0F538F511BE7BCB, 0x68B0D70D9FEE5289, 0x4FBFC010AB3BC90E, 
-0xE32B3305E752C0F3, 0xAB6C523B5413272D, 0x425525E0DAD7360, 0xDF09AD34E1ECBEF, 
-0x20C526C5964FF5AA, 0x213A6D65B, 0x4052F67E7A3A4056, 0xA92A7AABE7C06B1, 
-0x2AE0661EB8C5F160, 0x9836EC2087095CD2, 0x26C1BC61A86205D1, 0x7BE3B1FC3BC27104, 
-0x94F49D301BCEB630, 0xD5C1B690EA4DBAD, 0xFD193DD0506006F0, 0x277A08A36, 
-0x2B1D6241328EA686, 0xB6BFA7CEC6AE21E9, 0x1FF2B4B0172F4F2A, 0x6C00729156A03859, 
-0x7FD6651A6808826C, 0x3C60B9B4C48C4762, 0xEA5027A51F94A8CA, 0xA6A238F59406B693, 
-0x95D0C415537FEC6B, 0xE88CEE10, 0x662939D5C87AA86C, 0xEF4B7A5CA9F03E35, 
-0x4CCEFB06E28E4370, 0xAF56BEE3738322C1, 0x665B86816BF2776A, 0xC99CC3797ABBE03A, 
-0x4470A2C002D69F92, 0x30FA883C91C6793B, 0xDA5AADE80F5BA04, 0x180C0C0, 
-0x1F2AA18099591009, 0x806C7D993B02ACAF, 0xD37EBD92BD6085E6, 0x16DD7888FA91CDED, 
-0x19F3BE98BB441E10, 0x9AC7AD9DE76A7AB0, 0xCFB666AD6031FECA, 0xAB1E4DC342D97D14, 
-0xEE905D56AC82F96F, 0x25E480FCB, 0xDB88CE5DB479BFE7, 0x7B3E43987174FF78, 
-0x4F1B1BDF8A5AEB19, 0x59574EAA69F4D40, 0x22A845264BFC2BD, 0x374B35DDC261459A, 
-0xCB86DC3E4AB161D, 0xF0447E05D824F1E0, 0x5E0488B5214C7B48, 0x18CA67852, 
-0xBAC263162DCC1CAD, 0x1E403818D991DC63, 0xCE1FC63D509B73A0, 0xEE7B09F364E89FD, 
-0xFAEF34114323C946, 0xDAC8D0C5C0293AA1, 0xED7AC1EFFA4C67C9, 0x7659DB2BBC649ED9, 
-0x5CB5C4F88AE74349, 0x2F1280F, 0x33C59F7126AC75E, 0x1EC9B2B10299650C, 
-0x8B2C8BFBBCD40E, 0xD3F2F15B138FDF80, 0x16188247D298B7D2, 0xF8119826B5BF4056, 
-0x3893124BC358FE19, 0x82340E5DE944A228, 0xD3EBDFC84A7847D, 0x75F9F108, 
-0x9562DAFFFDE19F23, 0xEFE6D7ECB53E3F8F, 0xCF94DB09FDF320AD, 0xB6B609864AB062A3, 
-0x4B0B4AD1E98A691B, 0xFB5AAE8827E8E281, 0xF46A170EC7164997, 0x517E077A63829CC4, 
-0x3E65B80E9F2C5C2E, 0x132C64466, 0x646E956973D84F02, 0xBBDD8E56A83F158, 
-0x61BC22467E0BB225, 0xE28A9FA96BED2452, 0xD5B1602F02D2953C, 0xA9089B73EC2BA3F0, 
-0x9652D1821CECCA81, 0x551BCFF735603F02, 0x1F178072564D085, 0x16D6B9EC7, 
-0x49B36BBC20C11BFE, 0xFAC086160881233E, 0x4A7CFDA9F9C9949C, 0xD4C3151148096761, 
-0x9CC765FE908BEAE4, 0xF27B7D8D3F4BF6FB, 0x6A9B15DE6424C336, 0x489F6CA5F898A15, 
-0xE1DDCFE11E3E9097, 0x1F5609ED4, 0xFC61E04EB7DF45E6, 0xED7FC353A3722033, 
-0xA8AD56CF81682824, 0xAE12E77FF486FA48, 0xC50337A8C6E87BB6, 0x1EFEC7181C02B25C, 
-0x489E9CBB4AFEA09, 0xF9A73EBBFC6745E6, 0x59B89F64AE872BAB, 0x8A3C5EB8, 
-0xD5925B46CEAE6EAE, 0x87489FFA9C4681E, 0x38DE35091A05779C, 0x363FC842073F988C, 
-0x1404260007E51749, 0x82AC07B861FBF3AD, 0x4976B781E3A7D751, 0xE350692411F8575F, 
-0xB16D3B515E6FEC37, 0x1D6FEF224, 0x3AC008BFE2E848A0, 0xCFBA2CF7AF295525, 
-0xFA3D091D5C2CAE48, 0x5041EF955AB96175, 0x8BC670EA7336B36A, 0x1FF81EED836EEC7E, 
-0x59EDE8C4A8B30D15, 0xCE9DB3AE0B6FD530, 0x77381649C14C8BB7, 0x133C56590, 
-0x6E08B3CDC6115F35, 0xDF4E5AAB3BE46703, 0xB055C2E393A07A9F, 0xBDE05BB20E1102C8, 
-0x23D7762B7389CAF1, 0xB41268EBE9BAFF67, 0x3763D3E4922D9EAC, 0x1A2F69C32D30154C, 
-0xB2B8F0E03CDF9610, 0x1AA64690A, 0x22A31590E142DBF8, 0xBB3A8FBDCB096FC8, 
-0x3DB192414E262DA5, 0x64E7DB1FAE8A7B38, 0x19B983BA8528350D, 0xB3B1CD692722FB96, 
-0x3F43546821753844, 0x71EA5FC472CC4B44, 0xBC2F7BFF74CA85B3, 0x1DD3AF0DA, 
-0x8D433E4CF27467A4, 0x8039D5AD6D60529, 0xC368D83AB5086365, 0xD309308609EF090C, 
-0x593CB466800AB588, 0xD9EE51C958F77CC4, 0x14C8589B435AC99A, 0x5B2AB2E6592048BC, 
-0xFD59A42DA1FB2102, 0x1B8515313, 0xF0EF8A6B855419CC, 0xD95FC47F98FEEFEE, 
-0x6BC13B42A53614A3, 0xF039B9D819705EA5, 0x575F431E4A5274CE, 0x7F35B72EB2E7C131, 
-0xACDBB51A918CF8D9, 0x32E87B68DAA75643, 0xEFDF1E10C30F5165, 0x26F0643EE, 
-0x2A803041852D6637, 0x79FE50D71C71FD15, 0xC4DFB3176124F25B, 0xB035565CB3736E17, 
-0xAA0953D53C41FB73, 0x312D77D27B5C65F0, 0x33D3BB8E06454D9E, 0xCE37D4AD00CC6B51, 
-0x456066B85F9C0C3E, 0x224FAD31B, 0x76D89D7EAA9F9227, 0xFBAC25461ED53844, 
-0xD158F427F65A5294, 0x634D286B15E294EB, 0x89ABC911CD627C70, 0x1BDD59828BE1C125, 
-0xA34D84FF5A656120, 0xFD1EE0DE8A019812, 0xA781562F9511496B, 0x17C653DA9, 
-0x22DBF22B252C8059, 0x9CD5786824FACA2E, 0x9AC7D21F12C9CA, 0x749DAB216FC9A9B3, 
-0x6EB67EAECD27A28A, 0x9CEC5AF61BA6E318, 0x6DAA374CED185755, 0xBB07E4B9D9B6C1B0, 
-0xDE745BBC36F30334, 0x280E141F, 0x929260E9262BF3AD, 0x54AD4F96448CA2D2, 
-0x7888BFAF272B41B4, 0xAADA56CF22827C03, 0x8FFCD8B4341C0CE9, 0xA9C7BFB1ED3E825F, 
-0xC6486C59472E25DC, 0xE44F1A9572016BCC, 0x7AB58E679349D07, 0x172FF5022, 
-0x663A0CFB5EFCF160, 0xD3E332AFDEA48A34, 0xDFD25F9790F8D043, 0x84D138F90DBE2048, 
-0x31DB6CB26CAA57CA, 0x3962913CCEA0C310, 0x70CD2ED95E2AB233, 0xA801D435F078C48B, 
-0x6E2DA8F1A2E6C160, 0x68A86559, 0x8722275F80D78DB9, 0xFBC60958AE183297, 
-0x8151C112B39A905A, 0x7B318B7BF3CC7ACA, 0xEAF78992F205619B, 0x3C4F34576E3B0A6, 
-0x37C787EE627F031, 0x4454720F9FDB96F7, 0x45CBA8256E3F7BE9, 0x1A431E66B, 
-0x8C765D208F64F6DD, 0xF181AC09F4A38F40, 0x5EDC7A2053764374, 0xA76353B4EBEAAEA2, 
-0x3D3439A1AE071348, 0x1FD01895B4C3BC17, 0x5BBF508470EA7EEA, 0x7BF983DCF044FABC, 
-0xFCD8D916051382B5, 0x19F8D4DD8, 0x17949D904796D2EA, 0xECAB4BEB751911C8, 
-0x4F6B6BBE0BAD03A3, 0xF40E9BB9FC17C876, 0x53194E20E74CEB61, 0xF12336816DA976A2, 
-0x35B63EFEC98E1757, 0xAF65069ABD8ACEB4, 0xD9A772EC6593BB2D, 0x2381F96DD, 
-0x99E96BC9243E8285, 0xD5EF86E3AC447C1E, 0xCEF6AE926FA566E7, 0xFD12DE81EDF722FE, 
-0xA676C533D23AC1F8, 0xE8C5F94D3768DEC5, 0x3C1B0EB432C486D6, 0x54B232FE05D5697D, 
-0xAA1CE8D9CE1C79C3, 0x22CD813D7, 0xA25287F60E6C4F73, 0xDA0AD137ADB965E4, 
-0xE9FB3A4088A24C88, 0xE17B742698E47B49, 0xE284356D7ABF25DB, 0x209A416EA6FA9C14, 
-0x5AF28E14F933760A, 0x27035BF054149145, 0x37AB23F7EB3236E4, 0xCA68EA93, 
-0x34A421DA9BD343C5, 0xCA087A29EF025BBF, 0x63D160BC75D2EA7E, 0x8767793098B7EBDE, 
-0x5AEEBB0DE8B76B18, 0x5960631150E64031, 0x626591C6BB4A3A73, 0x99C417C7C21C883D, 
-0x12297CE4A49EAB00, 0x11274DCDB, 0xB441D202D13AC957, 0x1AC9C9D1F95C720F, 
-0x1FA9F0FA26DFB22E, 0x352A8CA3A854D21F, 0xDBB429FE1BA1193F, 0x49A76E320C7F0A12, 
-0x2F2D5DA5E9BAC8AB, 0xCE0C0BE94D036FBD, 0xF92B30600729D516, 0x162F33C41, 
-0x31847E4637A3EB31, 0x413C113B9AB2A763, 0x3B537DF612375388, 0x453E25386650B08D, 
-0x53248B634365525, 0x1C4C7C757B41803A, 0x1316244962A1A971, 0x58EF9174C95A5AAC, 
-0x17804233FBFB1CA7, 0x6BF60FCA, 0xCB5DE9B76AADB0D3, 0xCFAEC37AD02991C7, 
-0x304FCE5E371F5BAC, 0xE6737B3642459339, 0xDC4A5B93E4D1CE35, 0xF8AED15961B4B052, 
-0xED98FA4EC828C531, 0xA711E1C47627432A, 0x69939CE55E1720AA, 0x3445BE51, 
-0xD527B512E5325793, 0xF72BA593BF91F634, 0x783EF6966A36B970, 0xAE0DEB77CC138D2C, 
-0xB66F10C63E2E0E2A, 0x8544CD348413D6B7, 0xAFB70A3BECD6A6EE, 0xE8E91A57B3F4A25E, 
-0xFBC81F47393F8F60, 0x2A24485E, 0x72DA6D96F4BE397A, 0x7BE40D131BD049A1, 
-0xE86E3921C412777D, 0x5F59D5EA69291005, 0xCB8F695566D2D800, 0x8AA32932317142A4, 
-0x60C659615451DABA, 0xF4673D628F6CA9B3, 0x3867D11F05269A0C, 0x6809120D, 
-0xA06A255BF22D8A13, 0xE5A86F9B400DD239, 0x204E8C6226902504, 0xC67D4F1C45944204, 
-0x293E8EB8DB073E38, 0x193BFCBC3D8B7C3A, 0x3E70437F4A33DE45, 0xAA2D3AB9BA4534C4, 
-0xC18643D831E6769C, 0x64AC79D9, 0x95F6939EE96C20D1, 0xC771AFE08939753A, 
-0xFEB2B576F9CFBF76, 0x6BED3516A759F7C8, 0xB1D3D970FD41384B, 0xA5A823863EFDC372, 
-0x257BF3D8FF9AD442, 0xFC3401805B9A7AC8, 0x1EB94CC4CCECC9BB, 0x12A9B5B35, 
-0x40F54610C7398418, 0xCA2ED0C0BECD008E, 0xAFA33433A2E5422, 0x8213A5F674F52D2E, 
-0x31DD26BEE48F2894, 0xB461770DE1C8D062, 0x3A85007AA1F52010, 0x9E97A5559D82BBD9, 
-0xFD5CDB1DB096717E, 0x78EC307E, 0xDA44A0ED664CAE8C, 0xFFA38DD667F202C, 
-0xA13A09776019932, 0xBDB34DE5BF93EBC1, 0xBF104B48AD3655AF, 0xD2A908EF776DD111, 
-0xA05A85E690D11EC7, 0xE1A1AFD93CBEF40D, 0x12F6B51D8D766D4B, 0x10F75C3B4, 
-0x68E173D814469D42, 0xD6EB52F467F00031, 0x922EE5B92E0090AE, 0xE9AB001D9E607EF2, 
-0xA2E910F438063FB0, 0x63D2D637C7A2AE50, 0x3CE16FFC6465709C, 0xAFD9B14984F941B, 
-0xD9AB811DBAF6E55E, 0x13997BDE8, 0x124FD3092AA8D9EE, 0xAA54DFC78A294E3E, 
-0x7D98EDDF2513BD05, 0x16ECF793DED73C62, 0x92227C793649D13A, 0xBE5085F970FD1E12, 
-0x640124CD726B2701, 0x9312165857958C3A, 0xB5150CEB63055414, 0xF63FB67D, 
-0x67691BF468561FAD, 0x994FAD57CB7E5CF2, 0xE7A5646BB1CC09D9, 0x7F3DE20722E6BEDA, 
-0x9214817BD92C3643, 0xD0911BA2E5A0C4C8, 0x16E455B34C92DE53, 0xC6125461BB8A9AB1, 
-0xC87E5BC9C35D7F10, 0x56C6F718, 0xABC2ABC31C567896, 0xAD43336A6E06710B, 
-0x455D715B621414BA, 0xDFAA5D2FCEC9A72D, 0xE7DBB6FC2CB154C7, 0xB5436594BDA68F80, 
-0xA946C3D723F143B8, 0x9729C25EEFE24AC9, 0xB06439F839A65506, 0x12F7CEE4, 
-0xFC43EA9C2CED4423, 0x1E5593EF29D3222E, 0x7085AD5571752CE1, 0xF8BAF9325AFCD86E, 
-0x68DB8AECBF61F13F, 0xEF7C65E267F9BD7C, 0x2A5E811E4E6F35B9, 0xB6EE9C7545973D57, 
-0x29588136B89F2102, 0x13A1D7E8C, 0x80DDD5E9D69293D5, 0xCC47819A47EDBC2A, 
-0xCA6F2FFE54112E93, 0x6A4CFC62074F7D12, 0xEC230CD54A1A33F9, 0x969048092BE2645D, 
-0xC1FD5F4468250B6C, 0xDC7DC08676609FB1, 0x2585AAB16C8BE10E, 0x397EDBF0, 
-0xE41A3B33BACF699, 0xABF6E8F387DCF09D, 0x21F6B884D7C6221E, 0x886E78937B1006CA, 
-0xF6F632D668F07659, 0x4B0F82484CE7E89B, 0xCF021EC76EC405E3, 0x5FCBAC6556ED1015, 
-0x9B476BD552B78765, 0x25B30C2E5, 0xAA4A000C544DF7DE, 0x1445A2036F8818E0, 
-0x2F88B94238499F78, 0xE7CC72BC5F8747D, 0x3F69CC1A9416776F, 0x75B920F6AC701E03, 
-0xC87AF4748AFF849E, 0x5FD25094D8256B93, 0xDEA1A67590F1A124, 0xFAA05C60, 
-0xAB240A692B986E29, 0xD9F5E19F97EEE3C, 0x8BA56154A1641316, 0x3F8F9D9A44AB23CB, 
-0xED0EE4F6112C3BAF, 0xE47A8FED4101AD29, 0x2396C6C03FC6BAA5, 0xD11E63A1181F4585, 
-0x43C7BDC6339596DB, 0x237E9E076, 0xAD359C6ECB220CF8, 0x698241E500C17ADE, 
-0xC468EC54B0376B06, 0xECD60CA2F06A4C6E, 0xBD5E61F01048DAE, 0xCF8C16E95161B095, 
-0x51C88625E799838, 0xA6C4A5E821ADBD90, 0x39AE89B8991BBC90, 0xB80672A2, 
-0x23D793F92B6AF9D9, 0xFBC0CFDEF924D921, 0x71D5FB7963EAE708, 0xEBFBFFA9304ACE95, 
-0x5BB754F6E828A604, 0x4382808224EBF0AC, 0x7575D51F9E4BF530, 0x49554FE4EC239FA9, 
-0x78BEB2D10F233414, 0x159065A08, 0xC2EA7E7DCE82CC1E, 0x1C0FB6C634958DE1, 
-0xFCA63146FA476C73, 0x554D12A240C760E6, 0x515199C04A5C1546, 0x415C7A253EA101DB, 
-0x1C5F8CF6DC07A320, 0xFF5C4ABA4BB1772A, 0xDF73ED572745B95D, 0x1A1DD19E3, 
-0xB7C4A23B4D4A3A5, 0xC99E4F635B90B5EA, 0xF053BE8C808E360B, 0x19394BA7A02E98D3, 
-0xB0D9C50BF3F49BCB, 0x738D69C7AF1BC8C0, 0xBF4D0162A584FCB4, 0x99840E3A156B36A3, 
-0xE5B4479D0143BD0D, 0x24F9B45AD, 0xF69660A034260C20, 0x8AC8C3533465A59D, 
-0x16113E56BAF5DFC9, 0xF70DFD3B2298F5E3, 0x6D38DD7A10EB7C4, 0xDA45EDACC530784F, 
-0x697572F2F04DB034, 0x7995BEA6D5C035BD, 0x19A2893C3AD85AC8, 0xD1C1E818, 
-0x1978DB161283364D, 0x1046B4FF431A88A0, 0x808E6133ED2F86CD, 0x94916D4C4AA0BD0F, 
-0xA2A0E9044D8E196F, 0x545D7D0BBBCD4A69, 0xF249A33A882CC8FC, 0x2276F405CB478D17, 
-0x96396D59A58BCB15, 0x27256DDB0, 0x4536A6C2C5172C76, 0x514A3CD04A5EB77D, 
-0xD36E1AABFFAA1CBD, 0x3C9307E64762C3D3, 0xD95D14E198FB71FD, 0x294A69F0EAD142C2, 
-0xE06396AFFD247317, 0x41D94A6A875892DC, 0xF73AA62C7DD45FA2, 0x1937C9209, 
-0xCB24F1DAA6BEB991, 0x434872FC39EA9992, 0xFAE9CBB1334AD8E, 0x8E74E4EB82DE63AA, 
-0x6212D6791985C6BB, 0x10341F4FDE974687, 0xB89AED77B04E24D0, 0xA7969915D29EE850, 
-0xE060EC8D9D6ACEB3, 0x21C50D60F, 0x7C35FC2BCD6FD3C7, 0x4C3A608D8784F9B0, 
-0xA3DEE3B28BB395A7, 0xB93A3936DB30E7E0, 0xF56D4310E5AC9094, 0x2EF7FC2DAE1943F2, 
-0x1264A1CCB2D5FEFC, 0x18B26ECB12665E66, 0xB1F5DDE35D99D2DB, 0xA8812A46, 
-0x544901229FE9161F, 0xF0805F40DE06A52A, 0xC4765F9BD9901670, 0x2CB95128B92BE2A7, 
-0xF3AD29095A50D24B, 0xE6EDA7D25EF1D253, 0xC375849644A271A8, 0xF1D9148C6428CD90, 
-0xEE5CEFE53406036, 0x160B8420E, 0x8A4CA1A5850827B, 0x7DE4F1566B556FA0, 
-0x212693CB884208CA, 0x6C793BE8D078F782, 0xF0355F6BA9D872B2, 0x9CD550094B09F486, 
-0x1D67ABFF79BBDD74, 0x1DEEC896C2FED7A2, 0x934A35D3096B10BB, 0x274A48596, 
-0x3BC71EE63ECF0945, 0x271131E5850A3C7F, 0x131CC0F9CA92B0B2, 0x79420ED2CEFD5BCF, 
-0x97DE607DFF39C895, 0xD849F34B8F0F8ADF, 0xF2F2FC8F68BC13E0, 0x9978659755EFF7F6, 
-0xFAC0E6F712B9B904, 0x1DDF9F30A, 0x4F3421A062E9BFFE, 0x7FFA17EE2D6F5476, 
-0xBE6B267F4EFF9BA3, 0x7FBB22DC9C5E4590, 0xAB433291B364DDA, 0x6073092791E0CE7C, 
-0xE288FA507C68EA60, 0xBC255B920961BD69, 0x9F11AD0E2800486A, 0xF8FF32F3, 
-0x5A84EC87642A15E6, 0x1C49051B32E665F, 0x8FC7C347AC62DFFA, 0xEA8EBF5EF8749A97, 
-0xC2C9E4E10E48231A, 0xAB540B6717CEFCA6, 0x4B50E94F5581515D, 0x6DCD23F28029EC50, 
-0xDF2693BF5D1D1C06, 0x23C3A5B21, 0x9CF7E265CFB1D6E2, 0xE71B8C622B704ABA, 
-0x250FB0FD32B791B8, 0xFA05CB6C1EAEB6CF, 0x6E37D0BCBB149A7C, 0x94FDCFE855291908, 
-0x1D5C2190B45DE7FB, 0xE97513925BF97AA9, 0xF316A9C51F1741BE, 0xDAF266A4, 
-0xD65E3798BDABD464, 0x658E034FA5F8C426, 0x8ADC285B42E6B3D0, 0x3251CDA5430556BF, 
-0xCE949C942BB43456, 0xD30758EF561AC825, 0x9D1CDDCFC9EAD298, 0x32EC47AD542389BA, 
-0xA661A6B992642E24, 0x10DF86F4C, 0xA9E51032AF751D1, 0xED7DD8036D43D4D, 
-0x87D28EAD3EEE37E0, 0x9543BC9EFEB2389D, 0x5EF4B4EAFDAD401D, 0xCE1767465E551081, 
-0xADEB4C22AE0F2A5E, 0x100C3B540C932F1A, 0x4510EA23E9246166, 0x106FB6ED9, 
-0xB6DBCE6EF13E8F62, 0x9E186F41A2BA6BB2, 0x420D16EA1901DAD1, 0x49A83D2894B5E33C, 
-0x928323511B82616C, 0xA9178332106A7A58, 0xC5C91A4D44F581FE, 0x26CA2FEB191BA57A, 
-0xD7BF2A61AEDC768C, 0x6A4DB2EB, 0xD7246F0FBDE5E91C, 0x25135D20FA60E06F, 
-0x901D663C907080C2, 0x6C5F455A3EF41190, 0x5C038C54B5EADF0F, 0xD7C9412FEEDEE88D, 
-0xEDE402F569F3942F, 0xAF9DDC96FDDBCC27, 0x5F50B609C5624A8C, 0x4F8B80C9, 
-0x34BC9E94334BCFBC, 0x3DABBCE4038B50C5, 0x927907B6FA8DA7E2, 0x3D9382702EE5B96, 
-0xACDE22BD84BC70D3, 0x64C2C250A6C9415C, 0xBE3D75F5B784EA1E, 0x41BEC1BAF6AB7B39, 
-0x84A740F29312F66B, 0x24CE10CF3, 0x7E87FA87756AC1E2, 0x7884536648194A2C, 
-0xC81E01E1F41D9539, 0x94792697C9FE36CD, 0x5493DFCDE7E8FDF3, 0xD8AD2C49F931DB11, 
-0x6229A9835437CD72, 0x43D378B674EC9DD6, 0x59020DE5971E0F10, 0x15F04AD71, 
-0x86D5BB532A131B32, 0xE31C1647045E2C10, 0x704D55079CBD31CA, 0xE05E1E1A0904544E, 
-0x1B72CE04CFF18E0C, 0xF9EFC6FE84D61D2, 0x691E9E59F2F450EB, 0x9B44E4AEB59A5C5B, 
-0x2F5D1FBAD28DB210, 0x6CD87B6C, 0x9F962A3386154F12, 0x1344631F7E45A975, 
-0x13524E713F4CDC5E, 0xF4079D6EA4A6E4BE, 0xB1E24B25AD2D3E3, 0xD9A094FBD7CE48E0, 
-0xF4507427BEAF63A1, 0xC18EAD4B3E4CE947, 0xCA630EF08269FFD1, 0xC3FF40CF, 
-0x59C22105D42BFA2F, 0x669EA5998D350CCC, 0xB7F2E99E7B8B1E42, 0xBF27A4AF3C6E0C57, 
-0xF101D6FC6450617F, 0x898A05A8B2506910, 0xD53F18F59BD99537, 0xDD7C22B0E4917AD2, 
-0xCB2639455F4C637C, 0x26A2FFCB9, 0x7FC18DB6D39DAC85, 0x7B4714BEB59C6322, 
-0xA09254BB8B1390D2, 0xB681C652452E78AB, 0x3B976C33E72B630, 0x8166E8732A718D6F, 
-0x2267C5B0CBA9276, 0x570D9447B0F4A1E4, 0xA3C4FD2873372704, 0x158008D70, 
-0x30E27090A2308C20, 0x376CE45DDD606F09, 0xB7AE473D88E0B7C8, 0xD005658634455E1C, 
-0x4A7FEF4FF284C09C, 0xACD6B7F562B7650C, 0x57498295FDF39A83, 0xDB1ECC081090D90B, 
-0xEDEE107F73D5728A, 0x23B856DBB, 0x84523BD8AC2C66A5, 0xE3E177DA83F022B8, 
-0x5D01C01024987397, 0x97482FF3BC853481, 0xD615A0B7D2C385DC, 0x9A820EB08A5FD961, 
-0x2C908CA978A4E3DE, 0x4D2E693CF2BFB33E, 0x8BE84359145D2DB9, 0x190306760, 
-0x93AAABEED8754D89, 0xAA7F979CB968E7F6, 0x1D464F7EAACCD0B6, 0x4533C3B2FC46581A, 
-0x72460742811D2389, 0xE33133E4E83C0EB6, 0xF179ACE593A8B4EF, 0x2DA31E83375136D1, 
-0xED53A01D3E585DA9, 0x10D4F93D0, 0x28F9F1E4E340944D, 0xF1B584C30670D230, 
-0x177830783636C5C4, 0x8A78BF657A1A4531, 0xE072648DB2DE7C39, 0x44EB4422A92E3EA5, 
-0x2070BA7C63B4D2B2, 0x734BF7EE6A4EBE9E, 0x15D94C3388E66CEB, 0xF402D480, 
-0xD92441F269A90A5F, 0x95A773C4458C978A, 0x4DD625EFC354214B, 0x253190397F9E353, 
-0x728285FC0511B868, 0x14C736BF2B00B7A9, 0x82BB9B4F300D6D6, 0xE615D9C2498B51C3, 
-0xB94E3BF07DDA6235, 0x1D4FAE3C5, 0x53068B76A9477476, 0x6B4FEE4158054052, 
-0x9BA7B740F31775BD, 0xE9650946B239294A, 0xD03F374157E64E6E, 0x7205002F0753179D, 
-0xB8454CE931CDE513, 0x7ACB0C6E4570055D, 0xA33F115ED20390F5, 0x53604346, 
-0x8959B02047585FD3, 0xAAC3C222012794C1, 0x62B72F2BB4C0B859, 0x47348B56C64795AC, 
-0x2F4A97E27E63BF00, 0x1DDA3296B8833D1A, 0x749011B3CE121EA8, 0x46293E7FEC3DD734, 
-0xB1D1E1C15FD43D97, 0xD9B6E326, 0xD23A52D88E438DE0, 0x166942414666AB0B, 
-0x1ADD8AD467A1EFB, 0x3E6BBC93BC357A1C, 0x90F734F499906425, 0xF199799B75EA606D, 
-0x297873D69D5AD6EC, 0x24BA3FC01A8319C3, 0x183FAEC5A039CC8D, 0x1CA6168D3, 
-0xFC7E1AFD0E9BF737, 0xE441EF9248A153A6, 0x771249D07B3D7A40, 0xFF871F0BC997BD34, 
-0x34CD9445E3D9D257, 0x60E303C021A9B0BE, 0x4FAB589EEE3383E0, 0x3B27AEF6CF52263E, 
-0x8CADC59A8200CC5C, 0x144AE8CFA, 0xBA92DF180FA202BF, 0xE142A9D2F83B09CB, 
-0x5FADD20156184E4D, 0xA8F9831B86B40875, 0x1CE9EBAAE2DC1D19, 0xCA8DE87CB86E2EA, 
-0xEA83DBCB77103520, 0x5EB9D24BE47BD0D3, 0x8F4D13828E6B188B, 0x69FA75A6, 
-0x3D2CE05B7FD2A32, 0x6FB9E7EA6432DB59, 0xB1FFFE8A54BB5A48, 0x669701AE2E9694A7, 
-0xC20F5C28D1E12CA3, 0x3606947FCF818687, 0x671E118F2B318F4A, 0x114AB4A12BC1ECEB, 
-0xE7C372653D30A149, 0xBD91B660, 0x1F6A08C20C5F0185, 0x562E91C2F4BFBFC5, 
-0x4A55561C20ECD7A1, 0x86244B307615AC11, 0xCC38A78FF575E8B9, 0xBC1C9ECC949EE60F, 
-0x9A4E953E0A913820, 0x37494172B3184BC2, 0xCE34BEFCBB2E875A, 0x1774DDA2F, 
-0xF8B41BB7EB798BB8, 0xD712DBCB3586CB23, 0x68BF6EF6E65CF9AA, 0xB0747DB461385BBD, 
-0x8E87255A167B184A, 0x9880C5917D9CF1DE, 0x80E11B2DBF33B2C5, 0xE3113CEDAFFA9994, 
-0x442D3CE19C9B624A, 0xB7D10875, 0xBCD101164CD6226C, 0xA47103FFA5329A9C, 
-0x4823EB0E4A8A643C, 0xA0CF0603DADA8D72, 0x55F75F72BF56E15C, 0x63F9895AB42C78E9, 
-0xCFD1F00B7428C0D2, 0x3E2207CB81371453, 0x3705957DA464A0BA, 0x1736881BF, 
-0x82AF9F61A2FE6614, 0xE3B9F6EE6659500F, 0x1DD0025F2F9C50E7, 0x66FAFD01B7A7B3F9, 
-0x67F057207184F54B, 0x6FCE0BC2D036C6A3, 0x45C63F508181B4C7, 0x1E3B749599AFC57, 
-0xE2B6AC5083122D61, 0xCBBB744, 0x6307E7D0E796F769, 0x5038FDFA0E31A032, 
-0xFB6D44EA445A4003, 0x51DB780B192252FB, 0xD8389F04FF188E40, 0x63C5CC6287F310F9, 
-0x4CD3DB79F4A887E1, 0x37D0F7D660E3520A, 0xF75057FE6E3C0DDF, 0x131FAB8C4, 
-0x50EC3F606C70C6B9, 0x3FDA45832E6F25B8, 0xA412944C999AA85B, 0x32892ABA72053FE2, 
-0x16DC6E00AD55B9E7, 0xA3FED22D97A2EC22, 0x70351EAFC5CAE69B, 0x200F7C77A4A4207C, 
-0xE0C9675BB7B4B7FE, 0x16EA5D138, 0xF09105DAF0741294, 0xD51D274D85FF45A6, 
-0x8EC6051482CF5599, 0xEF9114754D1AD2DC, 0x6E2A1100F0FB38B2, 0x3FC42FAFC0F4E109, 
-0xC09D41500C1B79FB, 0xEA129A01B00688EA, 0x3C537ECA8D997815, 0x184976881, 
-0x43F368F78D15FA27, 0x5E63AEACCE376E71, 0xB1B768C58FDD73CD, 0xB15B3523E93445BD, 
-0x3BDF5F5B830AB9E2, 0xE3A2EC0CE69B9749, 0x77CA5DAF779B46F7, 0x9E60E34643283067, 
-0x7169596598F7259F, 0xC14851BD, 0x42CDB44860F6D7D1, 0x43777FFD4653099, 
-0xC3ED068422034A53, 0xF94C0B532C02EBAE, 0x183AC8D214B6BDA2, 0x99AC60B3CA289D63, 
-0xCD3919E6D9702E13, 0xFF58671F2179D281, 0xEFCA8EE8FE31795A, 0x1E51BC196, 
-0x909173CD60FA6D35, 0x4B07284AE7B2A956, 0xCE326133B6E75CAD, 0xE790525A09A7DB12, 
-0xC78DE5E2D6DBF57B, 0xE295E282E5BF82B7, 0xDD44F6829E7DEC04, 0x36F2BE9D65A77686, 
-0xFD9DABCE0C9D5362, 0x215351C46, 0xAC6481D2AFA8A922, 0xF51C94082C1B8A00, 
-0x46ADC3AD14E286A8, 0xA39561C46E5C5641, 0x26863A6198A0DF43, 0xFD2D49C2F3CF9770, 
-0xD64E5A914D794BFC, 0x21D178E1E0BF3775, 0xFFE6348E8E21323, 0x1ABECC030, 
-0x50A8B51E876464DC, 0xCF3A718EECC216C6, 0x61395ED9B7489AEC, 0x3E23759D96A7DE65, 
-0x2E1BB6F47B0C4FA6, 0x79E92B446E8D8C31, 0xB10AFC66BECD214B, 0x46657E21B8A4EE16, 
-0x2D1942D078B9FE1F, 0x8DBBDF78, 0xEEB29C9042CA8D4, 0x8C20C9B9DEA240AA, 
-0x4ADF5673C06561BB, 0x373DAD2AEB8491F7, 0xC30DE76AFAFBFF48, 0x462B9785289DD410, 
-0x6D7B85611C0A093, 0xEF2BA077DF2AFEDA, 0x33562DABA5A9E93, 0x23EF1D0AB, 
-0x4268529C0D242801, 0x256511F16097A1E5, 0xE00A30317C9FEBCE, 0xADCD5759F88F72F8, 
-0xED56AF590C689B98, 0x3CEEDDD9D41A9765, 0x5D1F528E12759A6D, 0x2FD7BE541E06093B, 
-0x16C61528B234B531, 0x148430F18, 0xD05FFE9F0C182DBE, 0x8B6A064ADCD99574, 
-0x481AF741DFD2F9F6, 0x4038E560000CC4F5, 0x45CBC355E90E75F2, 0x42F6B06DED012A4E, 
-0x3C78AF6B58E4ADBB, 0x3803619CF9ED5145, 0x8BA88D1FF83592E8, 0x9337E4C, 
-0x37824EF55ED6FBB7, 0xCD9890FD578FC872, 0xB218859BF0F30197, 0x9113E18064FC494A, 
-0x8C2D462B9D910FEC, 0xAC89C7A15CC2F789, 0x2AC44D32D08BE367, 0x1D948B4A6BBE9FA7, 
-0x60DAA3DC05672C33, 0xB93F784A, 0xD4B3282C0EFAF522, 0x39069D0B9768D56D, 
-0x25CF3CD0CE57A807, 0x598442EE88F63D10, 0x95BF9437E3C7B391, 0x90919F615EDAEADA, 
-0x5C4C96642A77D102, 0x30A3D1D983EF659D, 0x9865EDE7074E776C, 0xFFA01406, 
-0x140C1A3DCA05D682, 0x4AD498A17AA24B1, 0x2201B8E7C61140EF, 0x4525E203C8E9031A, 
-0x49FC213890390E7A, 0x71AA01C7AC92C45E, 0xF211216134553A36, 0x6DBDD3426494ADB7, 
-0x7ACCAF0FD86CC29E, 0x945FAA9D, 0x9309AF06F8103302, 0x90A6B9207E90E46A, 
-0xD5D177ACED561DB5, 0x295D6469A5B3AFAD, 0x2BEF6DCF2CF8603E, 0x4258185E23D866B4, 
-0x4B0D083EAFB06043, 0xCBF2C02D7C25F30C, 0x1653E1BB1D58B43B, 0x25629683E, 
-0xBBA1FCE82915666, 0x5DA2E8AE7581B451, 0xCDD9159A7DD7D76D, 0xB920A589AE67EFA2, 
-0x61EE2D7DE8147EEF, 0xA0BFCEEB9BA76E43, 0xF4F24D633FC8C60D, 0x3C345FC57295C737, 
-0xC8F1DDCAA93A8808, 0x19E14303C, 0xEE195B4883FE875F, 0xEC0430B5B303C9, 
-0xCD8C1BCA0DF1DEF9, 0x86B55B0EADCD8C4D, 0xC930E739E25F27, 0x9E8061FA4BB0048C, 
-0x74FC0EC3ADA3C1BE, 0xCE1F4728DEA7DDEC, 0x52CB3B1966E6B667, 0x88CB2FE7, 
-0x879198AF8E93DC1B, 0x54ECC79094AFF84B, 0xC83A1DCAC1A3EC7D, 0xD11BFDAF908564DF, 
-0x6F27069606B4D21D, 0x237968881D7C47EF, 0x69AB1B6ED6F92EE9, 0xE1F793E47F57D372, 
-0xD04B57F6A6B5F66D, 0x1F5FE9407, 0x3747A49CB528EE49, 0xB9B151A24B5A75C0, 
-0x54CB2AFD0530037D, 0xA890B2283F465175, 0x451C5B2D84384FF5, 0x8839AD15EE639931, 
-0xF965E1CB2B12D2E7, 0x134316EDB96CD7F8, 0x69E3487441CAAF3C, 0x1399B5047, 
-0x59B363ED7AEB2650, 0x71A6AF6B3AD28143, 0x92058D6B95879658, 0xD3B4B4FBA0AE78CA, 
-0x196DAF356C002C66, 0x6E75CD88B8D81D40, 0x2700BD310554DBBE, 0xDA535AB23B6C0ADC, 
-0xA4E7980919CA95AF, 0x1DBC0B5B8, 0x3DD669012D639276, 0xF2E083F1C69322F5, 
-0xE91DF50EF0931B15, 0xD1E89702D91B824B, 0xF90940CC4BE0B98C, 0xB2B313F26DF19008, 
-0x497E3142D4270999, 0xE629FD5FC812A188, 0x31DF294651544FB0, 0xD8011C24, 
-0x2906E3D8833F695E, 0x775F373A51C90E18, 0xD47A2798B64C9222, 0x22FA3A2B94DF0BEB, 
-0x8FA66950EF9F9122, 0x5E476D4B3C9972FF, 0xCA5EE43DF9D8C48C, 0xD36B63672F8AE9B4, 
-0x77C2647DBB340690, 0x73C46163, 0x89AD19EB543DD8FB, 0x727D6A6B9D4ED50D, 
-0xF3C8CAEFABB3F2AF, 0xC7519830363D854, 0x3B07E92F238BFBB7, 0xA16BB1F7EC111FC4, 
-0x257C6588B6F61506, 0xBA2988BA8050D906, 0x61B4EE45D0032979, 0x287E94C3, 
-0xB6A8361605CEDA40, 0xF77CD9DA61B94AD0, 0xA2974EF304F6D7A7, 0x8958C127F3A033C, 
-0x729C6C0381F883B2, 0x19FB8F863A136210, 0xE102E4F19ED2CE81, 0x19E35DA3ADBC20F0, 
-0xE7C1D269466A4D75, 0x8533CBC7, 0xA892E43A70661417, 0xAAFA266BBBAE33A7, 
-0xB51EEE06FC23AC7D, 0x7C5765084730559A, 0xA7ABD9E9332DB969, 0x69C370E3F4588C80, 
-0xCBB726B017195159, 0x26CC1250542E20AB, 0xC7DB20632AB09C97, 0x12B2DF4D0, 
-0x27986E22DFE467E1, 0xDAAD92ECE6D439FF, 0x30D800FA01CBCD40, 0x1006138291DD5CC, 
-0xDB13790617187843, 0x951B6BEF4F6FA24C, 0xA593276FC9B169E7, 0x245E71C162FECA76, 
-0x80AC2CBD328E5AB3, 0x8AED32C6, 0x8E734918000C7969, 0x8E4057E2F13FAF0D, 
-0x3926A8C7D4D40F3, 0x3D86206D7C3A8D7B, 0x609B1413D445B654, 0xA18D2C0FBF7CDCD8, 
-0x5533514B46852F36, 0xA091E075047A503E, 0xDA9DA3181A07C97C, 0x25860797E, 
-0xECAFF0B5E01D2469, 0x32CCC6E9F7BCE649, 0xCE100C0E9B3CDFEB, 0x1E8375DC645F0E5D, 
-0x90D2438168D2DC1C, 0xFD0093833415FAFB, 0xAE12E3529FBF7855, 0xB139FC4C1B9EA8B4, 
-0x1CBDAC544803A1CB, 0x64F28A56, 0x2620FDFF0CCEC444, 0x96164392D2E8DA78, 
-0xC2C3BC0E57421B17, 0x3656D5B6B59AB886, 0xB7F6748C23AF0EBC, 0xF4655B5891F28127, 
-0x402C3AD82F648261, 0xE6704BA02EDDEC54, 0x776E67753DC50D5C, 0x118C40921, 
-0xAE21B280F909E2FA, 0xB22C8799F5CA6E51, 0x73F8B02126408300, 0x5246FF9AF4F452BC, 
-0xC1A8160891AC2927, 0xE2FBD4998DF3092F, 0x774070371A384BF5, 0xDA27E907437DF733, 
-0x54231895E778BA3C, 0xF2829322, 0xEE03736CA9DDE4A9, 0x285B7DC21A64AB3A, 
-0x33049A60734AB4BF, 0x8DCA64042ACEBC0A, 0x10838E2984D9219D, 0x549AADDFF7464B82, 
-0x36D4BB7D20D5427D, 0xA28C76837D85F61E, 0x49BED9DD7B98BE3A, 0x1977C5CAD, 
-0x81F7B1750FE78DEC, 0x6EAAC78FD45ADA81, 0xF7F674BA8BF33080, 0xB8854EA4763C6C4A, 
-0xC3F958211427D553, 0x4BCFD657DDD9AD1F, 0x8C86284D3972493, 0x44933A40D0B908FD, 
-0x1A68142EE398FCCD, 0x25494D05D, 0x9992698D2BB5765D, 0x67C3AD1FFDF857D6, 
-0xF9C6EBE0E8FEC5AE, 0x2A554D5284F17C1B, 0x928177B00B1E3869, 0x17BBB4762F6132E6, 
-0x90341B02782B937E, 0xFC7D41352C3730F, 0x32F73306F97B6AE7, 0xEA17B587, 
-0x1A71E33264548D1D, 0x897880C826F968BC, 0xAB6BDC7FC0FAC8EB, 0xD3DDDD707924BECC, 
-0x7883BE8E21F4E59B, 0xDF6C86A5E8A02AF6, 0x5E00B7FEE89B3F54, 0x10CC6460066B39D2, 
-0xBF4859CD8067B8E0, 0x347C5C54, 0xE16C064C62218246, 0xBC70AE3941C2393A, 
-0xEB3D1BB2CA802287, 0xC4EB15A5374C70C8, 0x263C46477D9F8C06, 0xD6A3DECF0A950127, 
-0xAC46705430305F62, 0x4A30F74F493036D2, 0x8CBC3729541C8C88, 0x77A042AE, 
-0x340483B66020AC02, 0x998DE368694CBBEB, 0xC2C59FA4D9F0538D, 0x4A240E23E2993377, 
-0xC6191EDC93547AB8, 0xBBC6DAE5966CA91E, 0xA61515B7C81A87B7, 0xE057F11CB617AD08, 
-0x17A65E380916A1E4, 0x1652B3850, 0xC9A21DD8B5500E57, 0xBBBD0DDCEA508191, 
-0x385C009007FB4173, 0x1D8082EA162A27CA, 0xEBBF017CD8BC0DF6, 0xC1BF127E48D74029, 
-0xC6BD6E2C1DD5F7F2, 0x1D9DD65A14A8A19F, 0x6B8DBAB014193FD6, 0x1BED3DCED, 
-0xA6148FFDB3E2D5E7, 0xF42D33E81EB99BA1, 0x665E997A672DD01C, 0xF5D879CB5A98DE5D, 
-0x3D8BACA99A664C0C, 0xD11929CA375D1B70, 0x66C9DA7E857BB785, 0xD5BF1E4D34224245, 
-0x59A3DBB622B1CA0E, 0x1AE72807F, 0xC32259DA8545D4DA, 0x14DF783A05DABFE0, 
-0x436ED7B3094C2995, 0xA9758E310022B993, 0xDA45ADACE094AF55, 0x2998AFEE04677924, 
-0x3667F314E8C4B8E8, 0x93305AE3AD9016EA, 0xB1E3F964657F41C1, 0x10F051095, 
-0x2CF25A1FB27252E7, 0xFA3106A4DC711CF0, 0x1FD3E9FD66645CF5, 0x6FDF2D7FDEFC17B4, 
-0x2BFB16273CDE666A, 0x1D6D4C62497364C3, 0x452DBCF768121E08, 0x8B4411D387183196, 
-0x4F1239CBD5567FB0, 0x1C96619C5, 0x33C6B9853222C189, 0x7ABBE242D65A31EF, 
-0x13DEAD13D232F68, 0x46749CA33728452E, 0xC805E4BEED3E5BBB, 0x75603329C5F45A3D, 
-0xBA71C5A31E3482A1, 0x95838E928BF4FBE3, 0x67F9A578A2CC7338, 0x1113797D5, 
-0x7A042A82D04DEBD0, 0x491CE081B68D238A, 0xA54C7863CE9E31A6, 0xAB17898865A991DD, 
-0xBA59F18DBE14274E, 0x419F1231A0C8C4D3, 0x71B4CBA80DA7AD2D, 0x9619042BE50E225D, 
-0x15F37ADBA6D9ED70, 0x1B65706DC, 0x2D43C5ECEA1644DD, 0xD72D78F65A7A4812, 
-0x455F8DC901CD34C3, 0xBA873D7850E4832A, 0xD80581D51D654F92, 0x545D636AB882D140, 
-0x34086E2CF0F7C60D, 0x7B374C07CCDECABC, 0x2777CC53663D88C5, 0x20565ACB3, 
-0x1BB4E63242423663, 0x52EC37A1C65543BB, 0x94E3D3299003CF9D, 0xE414DDB3709C3BD2, 
-0x79D146FABC04BDAA, 0xF7B0BF663E5C6A09, 0x8A489EBD72C4D4E1, 0xCCAFF529231C3504, 
-0xFEAAE7C53C4DC89F, 0x9DCF7212, 0xD85CAC1C4D1770EE, 0x1A2FCF99BBF87505, 
-0xBE6C6688807378CE, 0x489ABC3587037187, 0x65092F76466829AD, 0xCFAA77C7CDC4EEAF, 
-0x1147A6696AEC98F1, 0x28F15EF561D127DD, 0xDDE4B44124F1F54A, 0x2788D2DFB, 
-0x9C67B17881695057, 0x129B911B4770A189, 0x653C53F8041ACEA1, 0xB74D6466FD398E56, 
-0x48179FCA2A4FB2DE, 0xF077F1D80E5DDE22, 0xDA21C5E4C34B279E, 0xF8C39C86C12B16C7, 
-0x8B4C371A0B738680, 0x1C31A94AC, 0xB229ACE324825A39, 0x8CE060A184238EE2, 
-0xF8207A809754A409, 0x8CEFB7715C5CFF2C, 0xC6D48380F9AF378B, 0x77ED9FB783ACFF7E, 
-0xA08A6C4DD932AC00, 0xA444E16643EC5B3F, 0xAF9D94E9C7C2728E, 0x1396AC386, 
-0x30DD47FAF13C7B52, 0x74256174FDE85324, 0x63A81D40E5694706, 0x8CDE17666589CA76, 
-0xE9AD6F723218E558, 0xF4909CA83F13C7D2, 0xBE160DB1A3A0286A, 0x1ACCBECC4A9D6F85, 
-0x91BD2D8705535166, 0x13AB79976, 0xAEDE0F3354D39A2E, 0xC2F3755D2D961E91, 
-0x120C1597A21E9FD2, 0xBEE9D915D11493D4, 0x72B193CCC0DC3604, 0xC7DE6A74068E0D96, 
-0x435D9F8016ECE21C, 0xEF1E2FA18C6159EC, 0xC3712CC3A8F788D, 0x53E621EA, 
-0x2CEB4E91DD1568DC, 0xDF12D0117D199445, 0x12204F2F325268D5, 0xE51AC729354F70D4, 
-0x1799C89583A5C0D9, 0xC1B3A83CF7048755, 0xFB2B5CC41F13C723, 0x63073EDCD9A1A9F8, 
-0xA27FE3BD8E7FEE19, 0x246644ADB, 0x209C90194E31D5A0, 0x1293659913839642, 
-0x4A24F387650B72DD, 0x603244129EB72CC7, 0x6E23DA7972ABA55E, 0xC5B1203191AA850F, 
-0x3D27D733F862D563, 0xE3DC2FC594718982, 0x9219497E25DA29FC, 0xB6D66391, 
-0x34A5C486D6CF066D, 0x4AFFBAD4E982B0E, 0xCB2BEAA804260287, 0xED7BFE05C418C362, 
-0xADB98EDAE8E8FF4C, 0x7D2C4174FE83C83, 0xF7F525E7D8628F1F, 0xA6E335E28AF75297, 
-0x758F6BF501909180, 0x118715A04, 0x5CDE0C597FAEF9E4, 0xAD2E737D9E4898F, 
-0xF67377BC6173D4C2, 0xC8957EB2393D0596, 0x806F5EB9C5606C45, 0x12B94FCA7C12535A, 
-0x32EF1164574205FA, 0xFEDF58443B5BD77D, 0xF8FBEAA86E678895, 0x275DCA4F0, 
-0x84617EC689E08899, 0xF892F88C89BCB715, 0xE191B7DC3E96E8D8, 0x4A8B0BECDC36817C, 
-0xCCA38826EDF5F672, 0x7B72A85AD54C70B2, 0x50C77C7B55D551C, 0x460BEFA337306678, 
-0x4FC44244BAE4E72D, 0x1CF7A9443, 0xEF506D4107B4E5DC, 0x61455B6A181ABD17, 
-0x9E1B9536F3075991, 0xB4C8504739DEDDAC, 0xA37E5C6652FF31B6, 0xAC1B83013CE51980, 
-0x472F8E0B608C6EF8, 0x4C111ED7DAFF24D7, 0x350D21597B02C40C, 0x6D81D3D7, 
-0xF7115BFE80A02F29, 0x1B938115E7CDC5F1, 0x7B817B028C23F4D2, 0x1F4F4E583F7C605D, 
-0x67E61389CD5E13B4, 0xF93CC1D05BD1A2DE, 0xF6EBB6DDAE21363B, 0x91152D7200D2C561, 
-0xCD191796A040E93F, 0x1B280D27D, 0xA7E29E2BB7624BF7, 0x6EE44B6B5BE80B00, 
-0x2345B7E2D5759831, 0xA9550FA4C7F045A9, 0xB7C9B262DE343101, 0xBA646A4A4EB41261, 
-0x373C37AA5DD415FF, 0xBD64F3B002A1CA3E, 0xEF762C383B95F290, 0x1D80DDE2B, 
-0x984414E0FDD62666, 0xBAE97975D1092432, 0x30D809C8164F601E, 0x66A305CAF53559C4, 
-0xDD0570165496B761, 0xCFCED119192167E8, 0xC7ABAE981D5DF0B5, 0x2ED64581171BCE3D, 
-0x1CBB54E68EF4FD0A, 0x1C1431A08, 0x8CB048E6A47456D8, 0xF600BE49ED92D4D7, 
-0x1FC39796769C0A6, 0x6E94307452A9F8BB, 0x740C5C50B9AAE224, 0xBAC8B3C135A2E2F4, 
-0xE49A28A8135E56F3, 0xF856C805436895E3, 0xF1CEE08B3504CC83, 0xBCF36352, 
-0x22690A6382DC3BFF, 0x445816DBB2429306, 0xA06A5424CF0CC87C, 0xECF05BC968148850, 
-0x38CEC3B2B98FC2E1, 0x968146E8B7BC1385, 0xFA0437F5332F0928, 0x2A9A1E16C2A312BE, 
-0x2DA68877564A2537, 0x23789298E, 0x842877FD1D5E558F, 0x3AF6CBC788B180AB, 
-0x556CEFEFA2F445C5, 0xECC2190258204C28, 0xAC244D088A8E5395, 0xF0B2169815B5EB93, 
-0x31F59377960B541B, 0x8C83D5E2C1AA5437, 0x902527B8DB28DFDF, 0xE5F5EF33, 
-0x1163FC91A12EC215, 0x98176AFBC2A94563, 0x6C90B8BED481636F, 0xCF4CB67B0FBD26AF, 
-0x9542F8116F519F85, 0xDF5F3B7DA1B9EA8, 0xBDD5D475CB4E7508, 0x126214EA0DD00B02, 
-0x7E9A61060BABDF14, 0xF9D59132, 0xF697AB5F3A1AFC36, 0xBA01D25DF0895130, 
-0x9E4577DBFD120BFC, 0x24B330632E198D31, 0xE006F9037E5076FC, 0xF7DCE42954239C0C, 
-0xBF257C341B3F6C0C, 0xE0758BC7F0928DEE, 0x65D24B925FC9E42, 0x23EB434CA, 
-0x612F6A15452B5865, 0x3E2DD7BE238CF9EF, 0x561A3128E5684096, 0x9E924A910CAF364, 
-0xC5D6F6B235C499BB, 0x24304EFF080F237B, 0xFD9704C46B5EE1D5, 0x7984F214E801D964, 
-0x8E4FF89DFB3F6D7F, 0x107613980, 0xBC48B10FEE3880D4, 0x21C40850E54A8E94, 
-0xD46A22DFA5FBCA92, 0xDB75D02EB1089D12, 0x3A9EFAB11D6A422F, 0xDF10592F19BD5D2B, 
-0xAE2242D9D8D7C255, 0x7ABCD16CA0FDEBAE, 0x4C103A12EF1CA9F0, 0x10F789EF4, 
-0x5F4C1B9A00FA4D6F, 0x86FADA4A6C609178, 0x293DA33CCF44E948, 0xE3495689E5797C14, 
-0xDD1AA0D9BB186CB1, 0x62CF4CDFB05C8125, 0xA686F2269559741E, 0x4FD73D57B677295B, 
-0x6ED2BCC888A1E516, 0x251700F64, 0x3109D49625ADED0E, 0x9166834317501E55, 
-0xFB63E9E4523ECF87, 0x7DCDAD3F69D9AD47, 0xF98140470DF2AA9D, 0xB9CC7825113CF619, 
-0x447386D68A691CC4, 0xE65262466F669284, 0x4E3C30A1B408EA44, 0x265CE9A41, 
-0x9A6FBD4A0F897F85, 0x9A36956FA968A4E8, 0xC7F118F406D1E569, 0x81DA29446B93C943, 
-0xFB109F2A9388BC27, 0xC3607AEEC059CB85, 0x3B0687C0FC754171, 0xBC31BE3B418EF175, 
-0x1E33CB246AEE1A2B, 0xEF8CB32B, 0xC597D678DCC9F5F0, 0xC076EDBACC713655, 
-0x28080A8CC9DA5092, 0x89FB0CE392805BC8, 0xFDC33AB0768CC1DD, 0xD5CBFF2C540C9ED7, 
-0x2B135870102A63BE, 0x7A8B8D2F897490C6, 0xAB3723ADA3C7224C, 0xC8FDB9A2, 
-0x382BC7DE2594C10C, 0x80DFA5E0F9624256, 0x369E2A1E4FCD8D88, 0x4AE4BFA572727E34, 
-0x3A51581D249C8CE6, 0xB3FB586FC7C2A97D, 0xBDEF6F1AFE355EC8, 0xDEEC780F30E5FDFB, 
-0x4810C7DC575A5BE5, 0x1332B6685, 0x5A94C35C1126ACEA, 0x55D4754656F53A34, 
-0x9023C82267CDA27E, 0xDBF981A1DF7F878B, 0x45FA3CA7EF136455, 0x77AE2424151AFE01, 
-0xAEF2140F713156DF, 0x400CCF897F3055C9, 0x974069C62224BF39, 0x1A7C05975, 
-0xE0161B464CEE604C, 0x142986598AD5EA3E, 0xF1ED822B0D27F30F, 0x2E397DC99F2A8E87, 
-0x1D2306050F616981, 0x150431E170CC4162, 0x762B72C29A2C3053, 0xA8E3C77E0AAF93C4, 
-0xC8354980A4D61542, 0x235B5D356, 0x10D456DEBC7E1CC6, 0xAAC202A1D5780273, 
-0xA58C1366B8F8391A, 0x60D0548ACF70445F, 0x95CDC77330D68DF, 0xA579CB19D301D5DC, 
-0x240AD4F373368D63, 0x3C8CEEADEADE5097, 0x7A6C87D1B417EAD1, 0x23D82AE3D, 
-0x144D5891742DBCB0, 0xB8F9D9816A8A7F5D, 0x26F7A599D445826B, 0x9E2163D037752635, 
-0x3863728C2CE4A3BE, 0xF3E1EDF562394E4C, 0x5DEFD017C4CD8493, 0xF17218BE90752561, 
-0xABB6C5D92D9CE1ED, 0x1160B0B5D, 0xAD3DB07DAA5F6CCF, 0x9CB3ADBEA66F9AD1, 
-0xD63B738B58240A0A, 0x287AC2012DB45CC7, 0x3289771C64B159C6, 0xBB44D28CDEEDCE3C, 
-0x5306EEEBF98952F4, 0xF356AD10FAADE198, 0xC9B47ED81D9DCDD0, 0xF48A6A0, 
-0xC192560DBD9F6025, 0x417721C97681D04, 0xCF861AEC992E6394, 0xB4A6C0E57F289B7E, 
-0xEDAF15D2F57619E4, 0xB0DCEF59E1648CCE, 0x22317A41C7F97565, 0xCBBBB6BCB5E5DA6C, 
-0x96E8EBC183D61EA8, 0x1B7739A94, 0x7EC49418B2B810D0, 0xE4D079402DB9C188, 
-0x8E53C68DB8334241, 0x55756932306062B8, 0x1BCCE7AF5A94E4DB, 0xCFF4DA3DE8B96DA1, 
-0x2082217EF8033AA1, 0xD0B4E6787E422C72, 0x4CA784F5990EA996, 0x9F41429A, 
-0x6B4FAFCB42C88980, 0x8D11340C4A667ADB, 0xD9D5A354085B876A, 0xA5660CB078BED32F, 
-0xCAB24070AE97D7A2, 0x9CCA9CBFC163E080, 0xB850452F83EF3105, 0x53F16D8846C746DA, 
-0x9ECE100E678FCE17, 0x2EF8A938, 0xB5674E5D4E6FCB8D, 0x501D5247B2016E87, 
-0x80E344C0EB79A679, 0x38FD3F3F4C3165FE, 0xCF0A1E46DF3A0A84, 0x9705F9B6728434A, 
-0x929BAA58BA9B496E, 0xAE64FFCA11497D81, 0x9C5718C214C7E0A3, 0x1933F406E, 
-0xA497FBA372B94C9C, 0xD84FFA0EE19EF506, 0xB7CEA62C743A1A64, 0x2DDBB641DD4EBAF4, 
-0x2EDB1B581CE376F8, 0x802332DF67DEBC77, 0x5F3CE33E92F89A5A, 0xC6AE56DBE327BC90, 
-0xEAB857579A8AFAD5, 0x45668F8D, 0x98CAC8EBEBD183E2, 0xEB52B70C7F5B0D0, 
-0x5D30A82F658E3952, 0xAB74E682ABA27196, 0xE764FFC3AF467284, 0xE0998E193AA3AF57, 
-0x564ACBC831F9FB9F, 0x5CFA11865E72FB0C, 0x1E08D757A71B1180, 0xE51B27B6, 
-0x24403C7EFE866A0E, 0xA9FEF031BC9521C0, 0x74AC1B5B77B6589A, 0x21BA19AF9430BBFB, 
-0x4826558631727C82, 0x32D60F58A81F2C66, 0xE569D1CA21B6AB03, 0x8CBAF3775432D759, 
-0x29C201C1F19CE90, 0x27B579BC8, 0xF5833C52D9C3D07B, 0xEAEA72B38994B37C, 
-0x227D247FAD5CB923, 0x4B2ACB220BDE1CEA, 0x538084A34BA8C115, 0x78B8A6159F8B234C, 
-0x77D8116B8E03E119, 0xB9867671B0AB574D, 0xE4F10801B7079A28, 0x108A0785C, 
-0xE8241F65CBB0B62F, 0x6C0C08F1C8DC5ECF, 0xF381BE10610B1E5A, 0x492485569A5F9CC0, 
-0xD310AAA98EE3E6CB, 0x4FF9A0FFB2D3543B, 0xCF5FF7D678585582, 0xB9ABDCFB32F4C19B, 
-0x5CE845D73012A5B5, 0x1B61BABD0, 0xCDA0138E70037BE7, 0xFA3A34DFC249E0, 
-0x6DEC14F793F58A69, 0x2EA72A1F4A40A166, 0x2BC5681095E6B3EC, 0x708992A79596958B, 
-0x46A3B957E1776843, 0xAC3D109F4ADE763D, 0xFB548C3B316B2E4, 0x1E9C3BDE6, 
-0xB82AC992A7842EE, 0x2A77FB861461B629, 0x82F9093832DB64C3, 0x7D7971A6CE9E6F2C, 
-0x75DFCA8B75083F55, 0xF5FF3578C604905E, 0x6F9531596884F24E, 0xBCDE4DB313954080, 
-0xC64F648A4E561D3A, 0x9D333B0D, 0x3495706C3279980, 0xB07BCE27D6C4539A, 
-0x452A7B8CFF0A41B5, 0xAB13B9885845CCC5, 0xF41449361CE2412D, 0x9A3A892FF6F0F32D, 
-0xBBE10431A46F054C, 0x54D0EFCFC159A211, 0x5C6AFE1B3D48A5DF, 0x107BF6CC4, 
-0x635C4D20BBD61B97, 0xBD39816D3985A0F6, 0xF06A85B0425E006C, 0x2D3A9A5828951E4, 
-0x178E7EBE009D7DBC, 0xB75679B9A6A753C7, 0x308C3CEE647023C4, 0xC025F2046602926F, 
-0x909A87A7F31188A4, 0xCA0A5913, 0xDDA189A8B28FE40D, 0x305F1EFF2AA3A01C, 
-0x3FBEBC396130B2EE, 0xF4C5FCE21AD6AC9C, 0x2FD81CF649AF8736, 0x960228D6238FB84D, 
-0x30F2D964F619EBEB, 0xC32376C61A427371, 0x9E5B2E3666DD218D, 0x567E220, 
-0xA529C004C94FCB6F, 0x28A34B3085886C22, 0x48026BC33E03318, 0x7B983BC658799EA4, 
-0x8702236DE3FF8A7B, 0xB736B7E9D93F8EE9, 0xF1EE80D5B9BA52E5, 0x3EEA115D0547186D, 
-0xE1CB91F2FC7314F1, 0x26458098A, 0x8CC18B4AA1F0E11E, 0xA7756977C05766AE, 
-0x8982F63889713C0, 0x684B64F7179B10FF, 0x2EAE6ECC80289FFE, 0xCEA0E8E9A11440E9, 
-0x1C354DAF2F11ABB, 0xCA10A7E6C14E3011, 0xA2B168AA12DF804D, 0x14902BDC0, 
-0xD6EED48C0E8CBD74, 0x6C57A6F534D56498, 0x9D57422869E8B7D5, 0x1FE6E83F2E8AC0FA, 
-0x9F157187217DE1C3, 0x9B366BD921651C25, 0x7378058E94BB27AF, 0x629A7C4111A004D4, 
-0xEFAE8C87B446D9, 0x105650F0E, 0xB4CBEE80D41C4A94, 0x64C3B66C5FDDD6E8, 
-0x732349C73567D592, 0x22A1A87A98486520, 0xCA500C4C7CE3AA75, 0x6589F1E8D903A167, 
-0x74DD9197BB6E2E68, 0xCB8DBB291CCB5F91, 0x2CC43C747A33A05, 0x1AB29C3B0, 
-0x5C1700B42EB5E766, 0xD64CBB98826C38C5, 0x93DC3E1120ECF852, 0xFA010A77DE56454D, 
-0xFED9CB95E27F6FE6, 0xCEA43AD737992391, 0x7A75C13EED8F44D4, 0x687AF2B2282E681E, 
-0xCE95D0CE26068B84, 0x15ED182A8, 0x911EBC86EFA4B182, 0x13EB8BC18D63B79A, 
-0xF5D62C5818B03102, 0x93F58521785312B2, 0x1134151363F4E71E, 0xB59DA9B80A580F92, 
-0x839543B0BC3F846A, 0x301C7A750941CD20, 0x93AA1E439D385935, 0xA26A81CB, 
-0xF6F6F79E5C4D6F23, 0xC71BB808A839AB8B, 0xA68C166D7F0FF58B, 0x74544DBDAAB637EF, 
-0x9D1C17CD70C55979, 0x52D39DBD1F9017DE, 0xE819965097A56CF6, 0x904C814F5720FC1A, 
-0x4CF550FCA750D703, 0x63386A4D, 0xE0D291865FD46DAE, 0x84AF7A4B08E66397, 
-0xB3AEEB3E3E174333, 0x2A50B7BFC269D55D, 0x4C27F0E5A5B187A4, 0xA1A301CD84987BC4, 
-0x8D02D38424F68A6A, 0x6087B6E8F402C002, 0x61C98682E00114F8, 0x9853C2E1, 
-0x6F5A7643A4D20617, 0x701E0179AE07AA8, 0x25AA049CD13DC9B, 0x34862B5A04D0B8A0, 
-0x43F17B8C49684883, 0x38680EC075C8E9D6, 0xE37BDC37AAD0610F, 0x4C66A7DCB2E7D694, 
-0xF4F735775463A518, 0x8B47D8D, 0x82CC2E677FC943C3, 0x73D36B7AADF63555, 
-0x78E35A53895FC845, 0xCFCA26A239DC0927, 0x1AF6401B5A7AB2A6, 0x1CB605ECE4384446, 
-0x23F9C669B954131, 0x3B8D6322ECBE7D5C, 0x46466593FDAEA970, 0x1A965CA5D, 
-0x994D71359B9E38BC, 0xF24971584BD95089, 0x122A4320DF9C2FDB, 0xEBDAA2303C9F9D1, 
-0xFB843542823E1E34, 0x7B89EE1EA0F7E783, 0x5C6EA18A8672543E, 0x9D45C402DDF4D512, 
-0xA799B75DE37245A, 0x1DB77D0E2, 0x5432583E2928F3DB, 0xB9CFE6980E35FD20, 
-0x7D97ABE3178D62E6, 0x1E8FA3937BB7F9FF, 0x4B78507E96834DE8, 0x69A5792882694BC5, 
-0xD11B8404576CDBE1, 0x26486968BE0E04EE, 0x6702A2190FCE4A9C, 0x1971BBDFC, 
-0x7A367F60C99DCCFD, 0x86ABDF8BAABCBD1A, 0x5B74B008A09F9B1B, 0x7D6C57E03827ED82, 
-0xA5741D878713A5E0, 0xBE259F2357EC01F9, 0x8BC473F86D686744, 0xBA02FF0C20CC457E, 
-0x31065AE04311D65, 0x9C1E3E2F, 0xC6585A9618D4F1D5, 0x1591E533D1898F38, 
-0xC6834101E5804D14, 0xDD4F25D1663E4240, 0xF6F9AF98FDA16223, 0xD849B99E42681F99, 
-0xCE8DB48FB182839E, 0xC63F85FC7E1275EE, 0x1FDBA284BB0239F5, 0x19C0AFD12, 
-0x3A87A293D0488221, 0x5406DC4D4795A48C, 0xD8D50999AAB4191D, 0x7A4E9A9290C8786A, 
-0x667D01ABFD55E76D, 0x7C5512F921895FE8, 0xFA28690772412ECE, 0xD4C4E73C6F0E502A, 
-0x69A6AA352F0284F7, 0xBFB176DA, 0x4E56176ED50627E2, 0xD5B4B5E6AA5CE88A, 
-0x9CB6487CB388AA7, 0xF9CD455FED5B4853, 0x7FA6AA9EED5DD2D0, 0x61E6E7ABDAC02F01, 
-0xC3F1B00A7B1A315C, 0xA59688949AE707CB, 0x4C850303F964F051, 0xBDC8CAA4, 
-0x8F5A4AF3EB392709, 0x72131342BB605964, 0xE1653D159FCC01A3, 0xFF4A3B0D9AE26C31, 
-0x72FD55D5C4E8C034, 0x98335EE20BA1BB81, 0x4ACFD8D497908256, 0xB38979B504915215, 
-0x6F8154BDE27D7259, 0xE85ABDDC, 0x3F37513ED3B51346, 0x4D811B35261503E0, 
-0xBFC7ACD3D05A9670, 0xD66268823110B8D0, 0x1313204D2F68DC2D, 0xC3452F661B92FC8D, 
-0xC845ACE5EF2B6B5A, 0xD411F672C1FC2F22, 0x45CA70525C06AE5E, 0x51160B22, 
-0x9FD197B9F0486AF5, 0x54CF63E39966CFEE, 0x8A4038AE94C5538D, 0x2758280B32656AF3, 
-0xF1D8A2FAD6E82A1B, 0x12C67E50B380F69E, 0xA38B7340029957A6, 0xF3330394EE13C318, 
-0x8BC69D33B9400563, 0x31C9471F, 0xA3324B621CF6F61, 0x48C8992898581CD8, 
-0xA6DF40514698743D, 0xF9E8CB974BED106C, 0xEC04C25A7C8C873F, 0x7E14A5B441540487, 
-0xBC9FCBA6ABA4FD42, 0x25A72ED592660D4A, 0x74733285F0F6C367, 0xB2281CA3, 
-0x197EA1DE87909231, 0x93C40C24832C23E2, 0xDAD6CBE3E01A26B8, 0x8200D69C03322908, 
-0xCEF3679077808155, 0xCCA88E754FC65606, 0x2BC7A719EC9D5293, 0x99D4DB748EC044AA, 
-0x984E0D6FB11FC930, 0x1854451F, 0x672031BF27D84760, 0xDC9CC4D514ED582B, 
-0x87F6EE5C530B41DE, 0x87D6799FA63315C0, 0xAEF22A4062434E1B, 0xACD4C251E3FF8771, 
-0x5D3A1318A60E0699, 0x16C3446FE928DE75, 0x35841623F8BB5895, 0x2592AAE66, 
-0x5027042328F18C9A, 0xEDEA5EB8C7D3915A, 0x7E459D006968EFCE, 0x7B6CD5E8A1154212, 
-0xC8BBF0E12753FEF6, 0x670B09C3518A6A8F, 0xD2ECA2AF0E96AE62, 0x5C5020E31B9993A1, 
-0x190166DC15AC7213, 0x1D39070AE, 0xD1FA3AC9A2FD056F, 0x25C0E7E5A95F6460, 
-0x5EE1E39F858C52F8, 0xD5B347176F965AEA, 0x7A92E6DB9E422DD6, 0xF23249A24ABE7C41, 
-0x3D042EDF8B6EB375, 0x98CB039AC7844DC6, 0xE4CCBAC9AED646B6, 0x219EA7D77, 
-0xC1FDCB3BEF1B5F34, 0x4C4ACBAAB810498C, 0x1EAF4EB012972590, 0x763B078F4A0D964B, 
-0x59937FFECA8E05F1, 0x86D16BC880D88091, 0x7003B234248E6127, 0x8DFF4DDB2A12C038, 
-0xC1AC98DB7415EDD, 0x37096C55, 0x673DDA9856B11D71, 0xDD19C50A5FC2F109, 
-0x4BC9CD6CEA97108F, 0x3BA37F5A238DB89D, 0xC341DC27C525B7A1, 0xECC8B6023F72D4A2, 
-0xA835DDE777468F08, 0x234E9AEEF991BF15, 0xFDE2EB1658DCC1BB, 0x3F5FC81B, 
-0x983160518C2F38EC, 0x9B3A38025D69B9E7, 0xCCF5346691486F6F, 0xC2A5FD3796DBC456, 
-0x364E2305D53C7774, 0x92D32762099725D3, 0xFF9E66E7F1187AD, 0xE22946BFC1FFD111, 
-0x64896BF6B4A37BFA, 0x19238CD2E, 0xE3334F5298CB16B6, 0xB5239B232083B0C4, 
-0xE4E676EAF17B4191, 0x92EBD566959E6705, 0xC4ED238A2F345C17, 0x6B43AF026B4829E, 
-0xDE2BF14D6B4E91E, 0xA79899BF9FF92105, 0xA66093DE798706D2, 0x1A0A9B6E1, 
-0x6510E4F9377AE0FF, 0x6025621D98BAB957, 0x7F8F7B275D88EB74, 0xFBD0A2253A499847, 
-0x217A65BAD1FCC9C9, 0x5F1612C5199AB61C, 0x3A5F66B58E99B2EF, 0xBC1E4D38960297AD, 
-0xF5EA9157F7D8FDB1, 0x19C7B7409, 0x3CDA1E2735599401, 0x4A51861FF08EB6A4, 
-0x3664A29B99080515, 0xD4D9A7EABA8BE029, 0x7BD86CBF133286FE, 0x1294C7EF2DFBC49, 
-0xAEF69057CE967554, 0xC5E282AD7381381D, 0x689621DF937E1860, 0x66FE4BA0, 
-0xB778A9E6F78CCE7F, 0x70C9DFF081925487, 0x13C040D19118D14C, 0x5E88BC2646D5A3CF, 
-0xABE49B40ECC4F74B, 0x5418A52C4B6E8039, 0xA1873C468233FA59, 0x9C9081005195091F, 
-0xB3FF57EE539C1D6D, 0xFB413366, 0x5788188059A21FBB, 0x6FA83F9DB74E6302, 
-0xC441C2ED6CB26CB4, 0xCACECD5A624AD79F, 0xF823CE395CBB9666, 0xA0946C1EC2389729, 
-0x17E148A6920938D4, 0x6FB342035A2E68DB, 0x11CDFBA68FD2A205, 0x1DEFA4686, 
-0xDCE6F2093CD7ED56, 0x3A79465A52A528F1, 0x3F9EB4CE8D47CF40, 0xD76304234459048, 
-0x42E471B7FD5D22FC, 0xB2A526AD743D2B26, 0x60965602A12447CB, 0x46AF2652D1A2A071, 
-0x899DA72317AE71E5, 0x210792D36, 0xB9565081D17A7493, 0x34775E1DFB47CCF9, 
-0xC8760AC80C1494B6, 0x84635C72C172EAC, 0x205DB97EE42D0761, 0x365AE8E17A87FBA1, 
-0xF18FD262EE4948D, 0x65C6545322CBF6A7, 0x3842E2AA29C7C0DE, 0xFA72D7AE, 
-0x7E1C4A1CA3334C09, 0x984DBA2E0D08979C, 0xBE2B9E54DDC9907E, 0xDD5B8DCF6DD2E304, 
-0x1A8215F9D14AD85A, 0x8E14A565EC88B0B0, 0xB3A6E6FEB4BDDDDE, 0xA31EBBFD000BDE4A, 
-0xDD4D917F6CE9ADA5, 0xFBE61EC5, 0x1DB3EFA204393271, 0x608C45CEE593E1B, 
-0xF98B1D1DE2635256, 0xFD1C5CF638D73F2D, 0x16CE0838D939AA35, 0x9EE033BB7FFB80FE, 
-0x43EAD66F69EA29CE, 0x73401A95D23FEA9C, 0x2C8242EA0363AAC2, 0xEEF98B9F, 
-0x5FDA0C68896A06A7, 0x10DE1C58B8EBBDFD, 0x1A409BF44EDE5018, 0xFD26C0FCAD9FE774, 
-0x2CC59774C8EC1F9F, 0x54E037828A6B8757, 0xC956E594F1B3CBD, 0x7EFB35005C7F66B, 
-0xFECF300E3B0BE851, 0x26AC112EB, 0x7994DCF6336427A9, 0x54A84021169E09DF, 
-0xAE16DB038F80B6CC, 0x28CDF1C7D6AE594A, 0xC1F2CE166BC886D4, 0x45D5656DA9613564, 
-0x123F32BF29638C6F, 0xDF3EEAA8B1054BFF, 0x7029BA48744B3C6C, 0x265011531, 
-0xEC136F6EFFA50089, 0xDC93D8F44BB96E35, 0x524A77CF90F1FCDA, 0x6590A8B4C1703CB2, 
-0xCD62A4FB6AF3C971, 0x4B924F028684C473, 0x1551BF69549E31F, 0xE39E8053D71672D7, 
-0x2A7FA7CB6B6698EC, 0xE1E67724, 0x5B5BB0C515401487, 0x48C875E4F93678E4, 
-0x24EDB1140DB96149, 0x21E76318709F4D85, 0x73C2FC47FD245E1F, 0x59DDD1DCEBE287A4, 
-0x8EB113025C52A660, 0xFCE0EACD4B0EC9E3, 0x487F0892E86223FC, 0x1F1FA79A4, 
-0x5334C08475B65EC5, 0xFEFC9A141E5DA102, 0x1E3341E394844D42, 0xD2EF74DF8205FDEA, 
-0xBC9CEF16B6AC744, 0xAF51E52D1A458822, 0xF0ECE2438C571CD1, 0xBC5BF1DB16A1D42D, 
-0x2895B174BC69B33A, 0x13F78FD02, 0x3800767094420742, 0x29D808584C750CE1, 
-0x4267F41AC0117628, 0xE85733A479770AD5, 0xBCFB7F1500DF402F, 0x3E572DFB136F94A8, 
-0x364ED6D57C6AF969, 0x1071B1E4C84394BE, 0x2841C98FE7DBA3C7, 0x27A75A1E4, 
-0x9DA12A519240B6FA, 0xB930AF9F0F43F80C, 0x5A057E6DC76C8FAE, 0x22A88D4900102056, 
-0x416B8A178D82833E, 0xE1D7F5B91B1B506F, 0x7459DEA001BF9C2A, 0xCC214D80CD59838A, 
-0x9D59BE09E7FF960D, 0x243034EA3, 0x67CA2CB0C39FAD6C, 0xC741CCABC5D3584, 
-0x4C0763814C06E972, 0xB291AF2701E9623B, 0x2A3F04AF27A21CEC, 0x9E934BCEE355ED6C, 
-0x1E51282405F39518, 0x6B020D4B6C2D0023, 0x2D706C1A162BAF87, 0xEAC3B054, 
-0x48E712646A96CCED, 0xA7FD0D0B83CD06DF, 0x6431E73B98086163, 0x7B641832E5FFF0ED, 
-0x7A570E5DB1EA7A04, 0xA8FAB7DDD60D93A0, 0x86F960CC53F0D1B0, 0x3848BF39555CA131, 
-0xE56A6381C50ACBFF, 0x34E3A469, 0xE6F270B79BD4EAD0, 0x149D631EE5078441, 
-0xFBE5A40A01FFD11F, 0x287599D6850E6286, 0xF5A215676EB9A082, 0x19A56B48A127DF7A, 
-0x15D73E56F4648B33, 0x3BD5F6BC5F4D1364, 0xC4797CFBFCDA4CD4, 0xACF85B00, 
-0xBD164513F6F3E526, 0x361356A1C3F3849D, 0xF0BFD4FAA48D5BE0, 0xB654F39892A4B93B, 
-0x4A441252137DAE3, 0xC56D2E923E3D954D, 0x41DBA1F75EBDF244, 0xF577C54670454590, 
-0x7BCC94FD6011171, 0x1C722DE23, 0x293B095C551C98AE, 0x1405F1D085333A74, 
-0x7A569525DA299037, 0xB0B6B1EE95987E7C, 0xBED2C85F2830F45B, 0xB2BF9E763054979D, 
-0x3186716330BF1358, 0xD97405C6A6923A5A, 0xEC03FC6450B840D5, 0x222837BF8, 
-0xA1F0EBE58E7E9518, 0x5EF03FD2DC02BAA, 0x34FCEBD030A743F7, 0xC7D6AAEDE87B3333, 
-0xA95FD6E1B68E3D05, 0x6505789DFF2A1EAF, 0xF99CB3DD8AB4A94F, 0xE0F43078DF657247, 
-0x8EF22098E7E7002D, 0x1DDC66895, 0x49684843D3E08623, 0x10AB84EE829B4A26, 
-0xC7B0F2B5961001F6, 0x8485F4B426C45683, 0x2F83C650A36F537F, 0xF4287516DF54D8E9, 
-0xDE87E91C7B61076D, 0xD4F1E2396D066BA5, 0x5A3FD1D192598147, 0x3EB1429D, 
-0x2F6CD4A5563929FF, 0x2AA137818C41492C, 0xFBF30118293DFFB9, 0x847B7646CC39BECD, 
-0x4E29D651D215CEE7, 0x7B260D510545ABE, 0x55E39F375C127C6F, 0x795928097C52D5BC, 
-0xC5658554B320A8D8, 0x744D912B, 0x1BEE50D6E69C641A, 0xA3D1420D1A53E9CA, 
-0x7AA5FA3B3495C7FD, 0xD329D830276AE3C9, 0xDE744145AC5C8D37, 0x8759AE43DAA8F2F2, 
-0xBC501F4E59E42B2, 0xBAFF428EF27351CF, 0xD4ADE990CD8F6386, 0x26D286CC8, 
-0x4C063A527E18C110, 0x288790219C6A16C7, 0xDF097BB8B1A7FC27, 0x2B1CBC0A844FC07C, 
-0xA0DFEC22AAA7A96D, 0x8E22B02FCC2685C2, 0x24C536BAAC0698EC, 0x22181F6D352DAA79, 
-0xECB02EF4FB4E96C9, 0x1EA49846A, 0xDCCE867A8FD39E9C, 0xE4F43522CAFFCBFF, 
-0x2CFAF018D82DAA73, 0x9CD813F6C6ADBDAF, 0x130D0DACE39DF12B, 0xE2809CBF83357B7C, 
-0x901DFCBC1BC34A08, 0x420F6F7A8A4E3EE8, 0xEB31894E2BD7D328, 0x55C97A10, 
-0xA7C0164EF2CD7414, 0xB6E93374D93B9A93, 0x34CC41FC8E418FFF, 0xF0B8113C0CE7B60E, 
-0x2C3815426FCBCF4C, 0xE6CF67AF514380D6, 0x83FEB541B6018199, 0xE16FA33D5927DC0F, 
-0xB930227C625E62EE, 0x26EA8CF08, 0x99DCB902CCC8BB83, 0x8C9BDBAEB939F407, 
-0x6B07538E5B86DB7E, 0x4FC906577053247D, 0x7D037820C722FA6, 0x467670C095C7B9E, 
-0xEE3158E78C0F62A2, 0xE217ECB5BBD0DE2D, 0x364959BB1777C3F4, 0x1FAA6EE85, 
-0x66845833698B4AFA, 0xE26D3FDC34955AC9, 0xF0F917F516970F02, 0x74A91587BFBBFCCF, 
-0xFAAA84466981E912, 0xDB23954862394EE7, 0xACBC2BE7E8743FD8, 0xE2E98B3E5A1CA563, 
-0xD53992291C190026, 0xB9FA4556, 0xE95603C8DA05D82, 0xB82DE8AE727CC789, 
-0xCAB6E9FAAEE68C0C, 0x1AC9C2DFCE9E8171, 0x818C36F7BCEDB457, 0xF288A68E21184537, 
-0x843FD8BF549B06AA, 0xC88A0B4E806190B, 0x8D68D4E652A23365, 0xAE1A95C3, 
-0x77F9813222A1DDA4, 0x6889249584688844, 0x10CF5F7EE2F64BF6, 0x773B6C1BFEB0D868, 
-0xEB3FFA00D4DDB728, 0x302D6E8830594BF, 0xC59D494DECB34493, 0x9673819E23926A2, 
-0xD659CF871F5B0B86, 0x1DC883264, 0xA57A73C6BFEA99AF, 0x37AE5D082D133D56, 
-0x562607BCC648AD4A, 0xB8678BBB250AA94B, 0xA34F4D137BFE86E8, 0xD2EB7E928EA38BEE, 
-0xF2F4456E936FF781, 0x8FAC966ED600D8AA, 0x8471D339CCEF5FF8, 0x17265A74, 
-0x27C6F7F3C07CB5FE, 0xC6130A8855A6F273, 0xD01186B7978665D4, 0x4F4EDE5F3E1BA1A2, 
-0x5D017BE6B3A40B94, 0x90DB43FFACDBC472, 0x8EAD548A729BE9AE, 0x855F4C43E7245BB2, 
-0x59931E2BD7B4A6B4, 0x26AD6A34B, 0x5E6F88E023E7EFAB, 0xB91BDA2B53FC7472, 
-0xB45A1C8E325623BB, 0x4B0061E900343112, 0x3C3BBAB089E1F857, 0x79A86363668CE79C, 
-0x7DCE2A6D60015B7, 0x2A60D2B152586292, 0xD2C7C55AB48E378, 0x8D2863CD, 
-0x24C688C37CF81C4A, 0x6EDF75DF8EDB8ABE, 0xD2605BF4BD560BC6, 0x680EE0D525282FFE, 
-0x46565A406E7992AB, 0x59B79028DBA8C6DD, 0x84F533AFD103A11, 0x3125120C5FD7380C, 
-0xEA4285539A3C9529, 0x207EDF2E3, 0x83D6B02E9BF65B5F, 0x191F590F002636C, 
-0x9384A66AAE03D3ED, 0xF9354D93E1230094, 0x64C3AC789318F697, 0xEB1CFE8615B287D7, 
-0x3ABBB7322535E9F2, 0x8092C3D6D45BED11, 0x681DA1985A58D11D, 0x1855F313E, 
-0x58ED36F55E0875A1, 0x74BEBD574D1BF50C, 0xED493092D86A3C54, 0xC343C62161575872, 
-0x8F16A41896D46894, 0xB2C0D2653E0E8F67, 0xA17F8031EB8C7BB7, 0xDA02DDEAE3346B50, 
-0x3CDCD09009259F13, 0x76EB1C2F, 0xAFAEDCCB33CA316E, 0xB660DC85853C78BE, 
-0xD114FD0EF01BDBFD, 0x1527442E68D4691, 0xD33BDB110DF845E, 0x52E98467BFDBF3D9, 
-0x1A6721BD2831045A, 0x1348CA423A51A6D0, 0x9C70EE4161FA0AA6, 0x1A8917F72, 
-0x5901C327999067D3, 0x7CAAA4271A80A269, 0x5E1180F71DABF7FF, 0xE2B83633C1137B51, 
-0x73EBB158AB262323, 0x29F84E6C864CC601, 0x208AC8D325F5B100, 0xD806711DE896DE7F, 
-0xDD3EB53878667D74, 0x214C83075, 0x8105635BBA6678A0, 0x2690DC6B57E0B583, 
-0xC16AD71E74DB822, 0xCDB56B90B9038AB5, 0xC497CB1D4678DBB8, 0xC0E50EC62D7827A1, 
-0xD2BD11AF85FFF8E5, 0x6DE075AEC1703768, 0x62ABFF15DF1625F4, 0x107B11FB5, 
-0x49C9F2418BB85056, 0xE9379A2F32A7C426, 0x73469301CF68CF1C, 0x62FEE79A59440ADA, 
-0xA1B8F399847B6A18, 0x25061E2797A680E7, 0x97C94ED183259FD9, 0xCFA25D2E1BA1D464, 
-0xC75840E3C15333D, 0x213989154, 0xD28DE72EFA853B3F, 0x836000A08F3E8EE6, 
-0x35FD20DF59654F0B, 0x470FF922DFBA8D5C, 0xE0EE54C41B9978AC, 0x195894FA5916BAF8, 
-0x8EDB242978335ACE, 0xA47D06BD2B99B2D8, 0xEDCA0BC5A1DF90BB, 0x1E46B4F5D, 
-0x8D1C77FA44D26419, 0xE6C42C3A3106A595, 0xF359E1FF008B2897, 0x7C08067429278137, 
-0x24DC227F943C36FE, 0xBA9C012D56C074C, 0xA7B210E4D8561F1F, 0x40FE795B84FBD8B0, 
-0x60FF76C1FCAA0449, 0xDED6AACC, 0x11690A4947625978, 0x72E692897854EEA2, 
-0x5962A349969D3061, 0x6E57F24819ED5F17, 0xEE6E6284F981DACD, 0xDDEC644B34F7EE96, 
-0x1D6487F651965A5C, 0x159D87A64E9E4C33, 0xB6E19298E0AD9A0F, 0x11762AD0E, 
-0xFACBE3B33239C3B3, 0x5BDE3751A46CE166, 0x4F0B695777471BB7, 0xDC95A2C106F58AD7, 
-0xD90EE6B1CF035576, 0x650992858E628C23, 0x490C910A8BBA99E9, 0xEEA3669FEEEE32A2, 
-0xD1AA1346CBB3FE37, 0x253D75EB5, 0xD9C1A74A6BF697F7, 0xBD360B330477B485, 
-0x2E1D6B57A7730816, 0xA42AA8BCA82F4283, 0x5D937DC363747A0D, 0xA0525F7DFD439840, 
-0x8E517B37E4B13376, 0x23EA30C7BB284879, 0xBB8A431C70FB6A88, 0x233CFF688, 
-0xC969035837E25941, 0x4B0E74B165DF4062, 0xDBFF6FC80F111B3A, 0x8ECF724C4B1229B0, 
-0xAC2F2595D2942A21, 0xD656E0CC2ED3D5F3, 0xDC4A71773BE0E007, 0x9A3F36B4C443BE54, 
-0x7EFA35586D5E5CDA, 0x1F3700ED, 0x2403E412668D0C6E, 0xEB3085238E9D7BD5, 
-0x5DA95CBC2411B6F8, 0x9EA6178ACC9971DE, 0xECA9FD6176FE0888, 0x2B5D4A7FF53C48E0, 
-0x940D2E5AE20A5E16, 0xB3DA3043DE7941A9, 0xD6BC139C60D9D3E9, 0x151BF414D, 
-0x62F3AF848C7D9DFE, 0xC0E9A14ACD374969, 0xB39D0AEFE54F7DAA, 0x82CCB9442FDB612C, 
-0xAFFDE8C98BF2BCFC, 0x513B18C4A355DF50, 0x2D9AFBAF2FE5E486, 0xC862A17AAFEFDA49, 
-0x6E0F58FAE56F38FB, 0x223817FCC, 0x92FD2644206A1D22, 0x7F51390BB88AA340, 
-0xE53A04CA79CED159, 0x3CCC15E9D2B21D78, 0xB6A2BF561BFC3706, 0x8BFD4C7956C79D6C, 
-0x49F40C14C0269C6C, 0xED0FAB87C6AAAA77, 0xCF3BBFCAE09FB841, 0x24AA046B2, 
-0xDBDB1D4ECD7814C3, 0x8FFBFD7419F19986, 0x5773615126C05AA, 0xCFD3258DB3F593A, 
-0x46394B5F1D63D283, 0x1ADA6179704EA5F4, 0x66C1B85641C7CED1, 0xE0DE57973EACABB8, 
-0x4E49C0224D63A6A2, 0x10913FDBC, 0xEA46CC3BDC6084FA, 0x85A956D385D9D9C8, 
-0xD951E6E1554680F5, 0x742D310A8B3D885E, 0xAF7A71A2CC8CE1D7, 0x220E4C2D5BB4A71B, 
-0x973F67D0702E75D2, 0x5D03F54035DE449E, 0xFE43C574BD2980CC, 0xFF3E3491, 
-0x845C996DB2DE83BF, 0x3016408A0728535A, 0x7A85919B23147948, 0xFF08BF3B690FB035, 
-0xDA4335B684EF1B39, 0xA7FD4FC66BB90E58, 0xAE9E3BCF0C9FC445, 0x5C4D677615B7333F, 
-0x75F70B76695F73CA, 0x74CE3725, 0x1D0ED3E967D5C715, 0xBE15D8F93255D723, 
-0xF9ACF401FE514EB8, 0xF5A77159A40C65E, 0x8FCE7D7102B3C728, 0xCBF461BE1B5D5F75, 
-0x903FB6B2B04DE60, 0x1A3D3FD53B346EB9, 0x7773F21D290A185E, 0x4AB2D00D, 
-0x6FE46A53A2F0C8A4, 0x72A328491CA8B8B1, 0x124F154E8FE4B851, 0x8239EE87DD5065AE, 
-0xA300912C14BDB63F, 0xEE8743EDC2C64771, 0x6C73E922E10C1DB6, 0xCD539A3D3B5CEA47, 
-0xF7E905A72E8C4B23, 0x225E8041, 0x6CD493F24CC25E90, 0x9C925CD08826967B, 
-0xEA58307E0B32A8B8, 0xD0A3DFD1B52C5AC4, 0xC877421B6DA5E4A4, 0xC3FBD2464E1AFFC7, 
-0x9FD5D9F967BF68A0, 0x4D45F321E0804F98, 0x4A3DA8A5D2253A01, 0x23CC5893, 
-0x27AEBDE5C37049E1, 0xAEFED3A0425F60D7, 0x18DF09C68FEC5C4E, 0x97709A2E1051CE3C, 
-0x3C0CEEE3976A0B88, 0xD7EF9A8A46E3B4F8, 0xFC6B9C4AD3E05E0E, 0xD41BCA44887ADD47, 
-0x712D90F91DB1BB27, 0xBD02E56, 0x1A611A702B8BDFA2, 0xADAA783E66C47DAF, 
-0x67D32B76B3EF6303, 0x50FB738D2DF4E822, 0x625E6CA17832DEF, 0xD8617F81DCDB505, 
-0x925B4C08DB4EB168, 0xC3195ADCA5295CFA, 0xB4A87693179BC87B, 0x1B785D87A, 
-0x9FC279D1784B4100, 0x609D26140078D5DA, 0x9C5002D103D523C8, 0xDB03000907CE9040, 
-0x46D40822D9109FD2, 0x39803B76A7E27606, 0x6B5C9B2789EAB713, 0x95FB59373BC85736, 
-0x2C1E7CFE8FC0099, 0x24DDEE132, 0x4AC8FB28407F8417, 0x9E68B39934A756D7, 
-0x91B31952B1691B43, 0x5C909CA460CC7B0, 0x8187B5DC608DF68D, 0xFBB9B38D44EF758E, 
-0x7D2C84C7047508E, 0x72B42AD61954B22B, 0xB34C62B8DFA5ECA1, 0x169C985B8, 
-0x2B8F046C0F6A2A50, 0x50D9D8C9269C8F8F, 0x4B68AFA59A926A8D, 0xAA108DC910313A1E, 
-0x2074E1E2CAD2A6CB, 0xCA8E6C5A87248290, 0xD9CDDEFAF22EA17E, 0x772D7A5FB0A664A6, 
-0x9903D0E89B4820B9, 0x191E2C812, 0x4EDAC09D2FD066FE, 0xB1B91BFF20EC4491, 
-0x1278C8DE12C5269C, 0x12691FC44B452DA7, 0xD594CA71FE00689C, 0x76CCC777AE4958D3, 
-0xD83924CBBBC8AF14, 0xDBF327A027C9384D, 0x96E32158C32AC4A1, 0x601A0BB8, 
-0x216B4D216BD38C5A, 0xA433A799EEF0062A, 0x62FA3D8E7E6AFEC9, 0xA45B1DBD099E90DF, 
-0xA58ACE6EE086904E, 0xC33D9C025C4D33D3, 0xB38FC7A3AC050BDC, 0x73214B6CF9D2BA40, 
-0xF173E4171B6F815A, 0x1EF51D918, 0x13505C55E158118E, 0x4A509FD0CD1E03F6, 
-0xE59D62BED8FABB92, 0xCB0B0B134CB387D4, 0x217BCB63569B673E, 0x4F97CEFC6F764FA2, 
-0xA846E2D159DF036D, 0x9E15C141EBA96229, 0x9A1AB152C1530527, 0xA2174C8F, 
-0x7DFC84863AEE8425, 0xE7B8DD8353D6767F, 0xAA74AD4C86F6888B, 0x59948B3E954D860E, 
-0x90D97B67DF3D57EF, 0xE65BDF87A1D576D5, 0x51A09CDAD6D15089, 0x87EA9A08E7AE534, 
-0x4D68490CDA590262, 0x20532CF1C, 0x9C6234C82EB41DAD, 0x173A7941DECFE212, 
-0xD69B41CC7272CEC7, 0xFF966A7DA21C302, 0xD8C416C457806E84, 0x8DB778184A804D7A, 
-0x8F55A58298E5DAF1, 0xAE0D5DDA6AF2BC94, 0x6E6CA4723352BF98, 0x355A1174, 
-0x667B3151B01E6925, 0xEE6DDAC4494366FB, 0x4CF2C5A774015058, 0x47A581A21E327082, 
-0x807477AF050AA0DF, 0x1F4A11B226017603, 0x312B15C2BF07FA49, 0x29B4D89060210391, 
-0x59C98BDE5977EC87, 0x1AAA7E0CE, 0x22E58FFC5D38917B, 0xC5ED1CCC9F193DA7, 
-0x6EA83203CCC8EB7B, 0xED83D18C9B068A16, 0xA1E5E86C2D8AF3B, 0x83764D1581A0AB9C, 
-0x5F7529C21B150D06, 0x2BE812D296BD30D4, 0x64A2F2268CE26A3F, 0x2485A1697, 
-0xB7E797C605447C1, 0xF56694516AD73D78, 0x32FAB484894A2578, 0x3FC14FE2EC46C144, 
-0xFDD513B6943D834, 0xF0EFBB7E7B66E819, 0x1150FF41A6EC2B3E, 0x89B81C89D8B38435, 
-0xA0855471167EA19E, 0x1C2A9754F, 0x30D6FA7CFA1C7855, 0x40D930734DB6C3E6, 
-0xB453DD303017B5AA, 0x1E470ADBC5225314, 0x1957E0D46A37D5A8, 0x18FB0B9D8C807239, 
-0xA5CFBBBFBE92D285, 0xEB83542AA36F7B9, 0xF8054E76C2BE2A, 0x84DDC469, 
-0x355D201BFBE52B5D, 0xE7580CF448528808, 0x5E16889469BCEA50, 0x1F274AEBC211189B, 
-0x17E4AB57739BA60C, 0x394C158FD51C6609, 0x626584CE9261020A, 0x5BBFB01CB0599B9A, 
-0x5D35F71F2AE97E59, 0x2518DF8D8, 0xFE660312A5CED2EB, 0x3F8ACEDCBA0ED333, 
-0x5FCE057D9E5B8049, 0x2C454313567FA53, 0x625AADD4F70776D8, 0x2526F8A2F24DD442, 
-0x37CADA47FE51728A, 0x368825A25254868E, 0xCFAF09A5D89D91F0, 0x1BA923325, 
-0xA69C9C3EB0C37CC6, 0x931FA8D2C95F80FF, 0x7BBF8123F2BAEB7E, 0xF4A1C885ED83554E, 
-0x912AC9934D9E2E2A, 0xBDF6FEF21F21FFAB, 0x9ED6BE673C6DCFA0, 0x86944BC5FF9D1415, 
-0x9A3E1EA834CD7C8B, 0x17952E1AC, 0x26CBB9A107AB34E, 0x50503306329F024C, 
-0x292CF2A7AE8C574A, 0x1986CB566D157D10, 0xEE3B41587041CA0, 0x78F273637CF88FA4, 
-0x6A0E1F8AEC849A28, 0x3876E23F732D160B, 0xB880CDA0270A20ED, 0x10BEA1739, 
-0x6E1D7A5EDD2947B5, 0x47DE3F879045835D, 0x9104310DF84458E9, 0xED37D9FD1DB8A2F3, 
-0x1F09EC110406416C, 0x436AAD6F7CDD6BDC, 0x3D5927218507DD69, 0x6AC9831BA539BC40, 
-0xF0BEA2B1855526C2, 0x1EBEB5AF8, 0x870DC1E27F690960, 0x5656B0F309DC6300, 
-0xEF6BD08F0AA9D282, 0xB805DEFD86FF4363, 0x9AD84346D1F30ED2, 0x52F604E9D8D3A48B, 
-0x909A02D7D8C9BF19, 0x6816D7D27236FF31, 0x92A3CB2D7B1CBEDB, 0x483F884D, 
-0x66EFC82D4E1898E8, 0x678B124426DB8E27, 0xB1CA109DC9C9C2B1, 0xE73BC2F830B1B8A8, 
-0x69740BFE4D50112F, 0x399704C7605420AC, 0x40E20318D3058C9A, 0xECDD4DBFE5B9BC8F, 
-0x2C4B922E6E222D08, 0x101D7029, 0xA18B9570D090CC5B, 0x77174100AEF56BBB, 
-0x789D2B4CC62C3FE9, 0xA0C61340237C537E, 0x167CFEB979194F97, 0xF02207803B030E34, 
-0x7994EFA10C63D8B1, 0xA86E755E9660654F, 0x3204189DC428AF05, 0x1F5E467D1, 
-0xA4648DBEE711F2A6, 0xD616416AE58E86B6, 0x71C3DDEDF3765045, 0xDA01D214B3ACC919, 
-0x81B6CC2D7D742BA2, 0x282B01EE0490AF25, 0x55D92DB1355CC19F, 0x8525D40D0D66510B, 
-0xC622F6A443D2938D, 0xBCFA8C4D, 0xB25E9D0FA1A3F037, 0x6B9B06DF161CD23F, 
-0x1028C4A9E159D2F9, 0x9716FF366558271F, 0xF091526033C45331, 0xF44747AE79EAE65F, 
-0x8F5E6E392C8E3BF6, 0xF56140AAA46CCEFB, 0x19262ACDCA157EE, 0x26015E869, 
-0xE5C7AB4705BE9E2A, 0xCB718CA84C8CE59F, 0x9D0A60DA68591C1A, 0x8FC1F56DD95EB701, 
-0x41A44B3014A7CCF9, 0x9293425E2EA2DEE7, 0xD19BD053CB64D00E, 0xB9F07620FB0AB23B, 
-0x5AD4EB837224F695, 0x18D87D167, 0xB88BA6F975AC4F41, 0x23A7622AB46A7509, 
-0xA9E3B7DD31ED6045, 0xBDD118B7EAD97663, 0xC1394083A2292B25, 0xAADD9A8DB2326B22, 
-0xC11C3A7C6792B0D5, 0x9B68EEDE2F4375AE, 0xFA60F88A5B736840, 0x23CB7516A, 
-0xB1EA4D87CD853F68, 0x6849D64A7C41D032, 0x7B6749398D57C9E3, 0x51B283B6910428BF, 
-0x593AB444A15C4AE1, 0x49AA8C2CF803F200, 0xA6D460CD94906901, 0x21928F8E6C8FEE77, 
-0xC1CBC0AC220D3CAC, 0x250C81891, 0xACFA58ADF9CEC175, 0x617B90B090151F2B, 
-0x15A96A47D42EC71, 0x7EBDA1247FFEBBB8, 0x66B670FD6243F, 0x984D81D7D22B8050, 
-0xB8E31162D4B67E8A, 0x48362449545678FF, 0x761BB636A724D0AE, 0x1F47BC85E, 
-0x10C751A35F97A224, 0x11CB8CE2B7F7530A, 0x602DCFC018480074, 0xBC098D96FE375BB8, 
-0x87F47FD29A4C080F, 0xF1BFE5D9FDC6C884, 0x40DD02402746ECAB, 0x12173F9AC94013E1, 
-0xB9E2A6B071F02855, 0x26C53809A, 0xBDDE441BFBB7761E, 0x20B12F2C8D85ED3F, 
-0x777F791E3AE5A919, 0x5510DBBEB0C7D88D, 0x3D4ADCF5F32CAF4B, 0xB7D303BE18DBD2A5, 
-0x6AD27E95A613F9C3, 0xE87AF328E26C4575, 0xF7769EC62F4945A1, 0x22E357919, 
-0x95D45F97C347A00, 0x91939707FB3F69E1, 0xDA0E3C9857667B9E, 0xBA314AC18B3C5140, 
-0xDD672882BFA4E975, 0x3B461E92C9E9936C, 0x3BE2AEECF9DDB34D, 0xF655FD945C430961, 
-0xD07F130102FF4888, 0x1B8D7581E, 0x14165A9852F71A9D, 0x1348D5D355E405D3, 
-0xA938418CECFB4FFF, 0x17826E2BBC9DBE9, 0x9C035D4560C6CF34, 0x442282D5DC44977A, 
-0x5F7F5383365EF0E6, 0x5B5F70FE9489DA85, 0x7985E1CBDD594705, 0x1B32A2C2F, 
-0xF5C1E96ED05CA863, 0x1BB076837E07029, 0xF253BC713BC80F5D, 0x7ADD73006B576E4E, 
-0x34416A5D8C02E3A9, 0xF0582ADE65C85E74, 0x65A2AD59327AE592, 0x134C2EA3466F03DB, 
-0x71E7E16332E57F50, 0x15A47AEDE, 0xB7D9272E57B4C6A3, 0x25151F3CD2DB3836, 
-0x1C11CE55AD96950, 0x5ACDF39EA6A63785, 0xB495FED547CC1BCA, 0xF1B8E43478E08363, 
-0x30CA71060B685881, 0xE0404A7A6E46F4C3, 0x631A5EB51C77C5C0, 0xD6842FD0, 
-0x28657F3FDE12DB62, 0x3143A2813D02BAD4, 0xDBA6C071FFD9DE01, 0xB0AA40AB6ECC5F88, 
-0x269F1C50F08F2B8C, 0x94C597FD663DC8E1, 0xF5EF231E5957248, 0x3EEC82AC87FA7772, 
-0xEC42EC092FABFC7F, 0x1B2CA09D3, 0x23312BAC54DC851E, 0x901B846E0A0FB736, 
-0x99C2EB2A885FDFFE, 0xA57AD10E9825038E, 0x63063243520B1787, 0x47F6D18CA69F2F79, 
-0xE0C950B94587948E, 0xFC126354C151FA, 0x320E6B315855AC92, 0x18A0E877B, 
-0x2684BD33ECAAB8F4, 0x9E2B3C4C6C6E1700, 0x9713772AE0B6ACA6, 0x43823E38AFCCCD30, 
-0x571FF2EC4CFD9F2C, 0x97F808AE8D5CC812, 0x8A9F9AF0D17B08EB, 0x8139EDA6717D6DB7, 
-0xAD1F3180FA885854, 0x183A50524, 0x73D2D56DCBC2F685, 0xB9482DD633B194A8, 
-0xA5A3078B26DB0B9B, 0xED6B3131FC52008D, 0xB023CCCD086E6D58, 0xA5B3EE46E8CA5B2C, 
-0x3DD1D7551C590EE6, 0x4B25710BADB11B1D, 0x4BF3028C9E1278EA, 0x264035321, 
-0x8A5A897EFC094522, 0xC88B2DA896112E2C, 0xCD7896FBA4D66608, 0xC3446ADBE37CA4A0, 
-0x6B68C4CF9FDE9C65, 0x2D41C40C40C82853, 0x503CA6B1DC761D61, 0xFEC88280B4FAAD85, 
-0x84C9C5EAB98D7BE5, 0x4B636E6A, 0x1403368BF50EB880, 0x7B04B4B81385A04, 
-0x25CD3CF2651CAE24, 0x9E25228962830460, 0x6FFDBEC87DBC2942, 0x40A6F473861CD15, 
-0x302A037BBF026953, 0x484B3495EC36A1ED, 0xD277CCFF61B5EE63, 0x6A52705B, 
-0xDF437F775FCD8430, 0xF575C5F148C75C28, 0xC697C015A8B5D795, 0x3FC0FE312E5932BC, 
-0x2C61B0A50D34330D, 0x137A9F889790046A, 0x6DC4421E7BF92B29, 0x73A84523226F45AD, 
-0x255D6F43CF7881BC, 0x1FE1FB88D, 0xD434D2D72DCB3A63, 0x741BF6ADB024BD2C, 
-0x250D5D8F859BC5CC, 0x33FC958E1D1A6F2D, 0xC02F1971E4F7BDD8, 0xA7EBB91E112554BE, 
-0xAB9C7C202ECCDBF2, 0x42603879F69B11F4, 0x2B43679F8E435E31, 0x2754C54AA, 
-0x1153CDDFB3AF1EA, 0xFEFACECCD638476C, 0x12AD09D106D6D127, 0xA29559668E511453, 
-0x44F2691308CC7846, 0xE3E66A8B45E2E699, 0xC1786DE586B5D1C7, 0x8CC2325E6A4FA55B, 
-0x208E49EB91F33500, 0xE3E9D47D, 0xFC946C044ACB13BB, 0x261492C46BE27802, 
-0xC66435DABDDAE08E, 0xE3D549177C3EB66A, 0xF223354B7FC82786, 0x7EAAB248BE83DDD3, 
-0xDF5CD48720A644AD, 0xAE0CB2E6402269B7, 0x99A71ADEB4B4C582, 0x125D59A4B, 
-0xC673115C7473B062, 0xDCBA8987035C555D, 0xCEBA69633F352708, 0x53DE7A466F8C151F, 
-0xA4801F488D0796E4, 0xB33E3BC0C4F0CAAF, 0xE938BEB35CD1DB2C, 0x3BB4D0B4CDD1D206, 
-0x44B971A9C797D8F6, 0xAEAD918F, 0xB9CF4433BE7BB423, 0x5DB27B16069F5FF9, 
-0x2A0151272F623265, 0xBAC78C1D000ABE02, 0x2C898F32158F01A0, 0x2104AD308D4C4F02, 
-0x64F5ACC360FE7EE1, 0x498B51E8ADB6AB0F, 0xD8AA02A63856C6B8, 0x12B6D25A2, 
-0xB17217611518CE28, 0xBB21881BEDD31E73, 0x26D85E0CA5DE63B2, 0xB56AA7C49348C716, 
-0x365BEB6CB80CEE64, 0x83F5FB8AC6658083, 0x825ACD0B3422FF0A, 0xF33FC1B5B284D628, 
-0x1399DC99297744A6, 0x228E8D787, 0xEA299C167C62B7D8, 0x822013CAF6300E94, 
-0xA9CFB96599816614, 0x53901FC9499A77DD, 0xE5EBFBA5CC28EA63, 0xF894A0DBC8050E5A, 
-0xE9DBC48F0F104F26, 0x2BD761D9DCA76612, 0x38C5EDB455C46977, 0xC58A54B8, 
-0xB6DF6DC458DB4798, 0x77BE57AED5B27E60, 0x695DA95E41CE0CF6, 0x8BF806BC9BC0FD0D, 
-0x860B955CCA7E840F, 0x76812BF5DAAC45BD, 0x7BEBC7956254A28D, 0x522443A9CFEB5DDA, 
-0x6A655AE4E40D1E30, 0x25EA2B4AF, 0x3E65CAF2FACA8E0, 0x5621C31AEB62A646, 
-0x3242D0355F559298, 0x1E0FBDFAC11C6898, 0x97A2E55C22E03C0D, 0x6B11A7989D5B5C17, 
-0xB519786C1F67E037, 0x43BDBE3E6409B027, 0xADA04DCDA34DDB8E, 0xE38AC52C, 
-0x1F3363372B51B7A2, 0xC56A420F0E1DC82A, 0xCEB5EBCA66F9D691, 0xF84DAB3992A7224B, 
-0x72282B790213FE60, 0x1C6F9BF023D6773, 0xCBDC2F2DB7CA48CF, 0x7A352D1E921F7EC9, 
-0x2C5005D3C3487270, 0x175F97ABF, 0xBEA8FA93C4A3C008, 0xFA35B7A3279187B4, 
-0x742082AF56FDC1CA, 0xDDADF8BA265C369, 0x2321F86EB9ED3C4E, 0xDD23C38179E3890C, 
-0x44E5A00DB5983ED, 0xF43E8B8440565C53, 0x31A0C4E292E31AB4, 0x32D26C1C, 
-0xB96B8C5392E5AA0, 0xF967FB8B8D6E34F0, 0xA3BF2F32A369C666, 0x996C4E909D281F5E, 
-0x60D0E61A9CA166F1, 0xB9935BC2CBBD3D13, 0x31A86B64FF9D9CEA, 0x27FB952B295519D2, 
-0x537D058E9D30342F, 0x26C570B77, 0xC9B847CE20AF14EB, 0x3CD3EB2C824907D1, 
-0xC1869613A91C23E9, 0x5F5065285475D222, 0xAE2915B1BB4C8D0C, 0x1FF87A3AAFA9A42B, 
-0xF1715D2ADAA3273D, 0x79DF6EFF31223978, 0xD2A3343FA221976A, 0x276C9B736, 
-0xB11C31188F9EE8BD, 0xC7B3A9E83A3F0D13, 0x911027A87D0DDDF, 0xA011E8E720CDDC94, 
-0x3F6AADC21315ADA6, 0x432F992EE4005F5F, 0x50534AEF2E12EF3E, 0xA8D1A8D695C1848E, 
-0xFB23DE1AF93FB8E, 0xD6C6B598, 0x7FAE77069DCD10AC, 0xF330810781B86261, 
-0x8676A5ECBE5F30A, 0x962585B761506EC9, 0x3CB5552C42640F8C, 0x53993AD46349281E, 
-0x589ECAD26BD88607, 0xEF2ED48276829741, 0xA44C5E0DBB2A3DA3, 0xE729912D, 
-0x652FAA8D9C8EE49C, 0x76277B8BD4F8E8EC, 0x3E73CDEDA50FDED0, 0x52F5BE08B36976AD, 
-0x9655B91E529AF3BC, 0x6F4F62A5ADE930FD, 0x6B54C9B5E5FC9DDD, 0x9B217A35944D3A96, 
-0x2FCF4885B377CDF9, 0x131D0B21, 0xB3588A899AA64454, 0x360251C9ECDCCEB6, 
-0x9C4F17F5AA2CCFE5, 0x3C5B9E7E2EEA7733, 0x3ED9CCF62E6C0474, 0x2F2E51E279E91416, 
-0xCA167D0BC0B39357, 0xDE4FED73880CBBAF, 0x2A79FC106B6EEA1D, 0x1C6115E5E, 
-0x5E477A133D1BC5E, 0x1A6BD3769D1753FF, 0x3EA5F23540906E6C, 0x6E1D507BA807E790, 
-0x4FCD13BE5F30C9CD, 0x913E0DE2CA50720F, 0x618EB988FEB9DE31, 0xFF775C6567E85C0D, 
-0x7E220A328768B4DB, 0x6B5C1B20, 0xBCEC6132F4B04948, 0xF3CF0894AC5B78F8, 
-0x58A039B8693AC11E, 0xB9C7750E4D81B29D, 0x6008C34F30E6ACC0, 0x19FEC7DB20AA08FF, 
-0x9B18914D49A768AC, 0xF886AFA5188CB24, 0x5D763558277A50E2, 0x1AA22F20A, 
-0xECDA82321C951342, 0xAF18015F66941375, 0x9DC06959929EDE9F, 0x5D5A2EE63482F61, 
-0xF353949B7EFF1415, 0xC6CD25DCEE5C539F, 0x16586B729B0701F2, 0xA36DF34150805756, 
-0xEAC22A8FCE2745AE, 0x266D5301, 0x1AA946A6B75F38A5, 0x56FF97AE920B6D4, 
-0x1E12F03835620A6D, 0x9025CAD02470C51D, 0x66F57B402A19F933, 0xC566178C429CC655, 
-0x360BCF95A2773488, 0x81A3AED155D32FFF, 0x8DF2B55FF3AC39BA, 0x6FE41826, 
-0xF70CF2E3A1A79CDA, 0x5680099CE736242E, 0xA5CE4E09D964CA16, 0xB26357464FF5C8A, 
-0x41446193D97A601F, 0xA37AF984163A77C9, 0xBE635BDBC46162FB, 0x6F0421F4A8B70427, 
-0x3375F93D2E289DDE, 0x48BC58D3, 0x463125ABBC7F03F8, 0x41088ED90397DC72, 
-0x87FBB9852F92CDF9, 0x5F6448AFDADDA359, 0xFDCD309E1C6754F9, 0x6051AD4CE665CB6F, 
-0xA2305997B126EF5C, 0x5BA7E7FE4C817A12, 0xDEEE75BD7C0C115A, 0x1191DC0AE, 
-0xEF950C7F013E2223, 0x39203D9D630A2ABD, 0xACD3C238CDEF43DB, 0xEFF4103631A62EB7, 
-0xB6ADEE709D268EF3, 0xAE9BCE4CA9162D8F, 0x9F24A42B34F1E8ED, 0x2EBD57218FFCB1AB, 
-0x716216E508D89B33, 0x9B689A9D, 0x78E244CA0219E48E, 0x7A2D307D0A737223, 
-0xF670FA144D8BC456, 0x9A74DB7B055F4ED1, 0x8627041BB2D88339, 0x86D7062F334E50DC, 
-0x4F484EE6EE9E26B3, 0x848AD550BC46AB7D, 0x46E6E7A4C069540A, 0x2EA20458, 
-0x582BB2ED9A4E0918, 0x8675C45CAC0B6D14, 0x4C126A61FA214A23, 0xF1CDF08EC408291, 
-0xE1ED57E0CD6A1919, 0xFD1F302223501434, 0xE892EFD3F9333F45, 0x32022F2513894023, 
-0x60340741C3AE49A2, 0xB74B383C, 0xBB6D441E03B8AAA6, 0x3128465494250FF2, 
-0x6F68711AA8C780F8, 0xD3330794A3C08CEB, 0xD12012CCCD1AFD08, 0x88027F17655F1BDB, 
-0xB7C7623413D53B19, 0xCE033ED211D2A153, 0x71CF2B4FC05AC24F, 0x222BCC4B0, 
-0x36AE29E4956BD8EC, 0x1C5DF86D7416A61B, 0xFDF709A41AEBAC0E, 0x4A37541E71A07DF8, 
-0xD996EAC9517D6074, 0x6E0C897BB5169719, 0xEC05969BE842FBB9, 0x61C551EAE91D23D0, 
-0xA0E99F35288D53B4, 0xF8F4C59E, 0x4C8B7851698B461C, 0xD19202585AF17B0C, 
-0x76B1FF9E843B2EC5, 0x2F6527BFC6CE4033, 0x1689054FC2E1B617, 0xA088575F2185F60F, 
-0x6A8400E80C500E87, 0x5020F2F620E2C2A5, 0xE901B0125A296F14, 0xDA17FCB4, 
-0xAAD3B148F575CD34, 0x8EDB88C64B59D124, 0xB5DA9C5BE69A712B, 0xC6443B686E73D77C, 
-0x79C32A6C6CCD24E3, 0xD809A0A9FA18773A, 0xF62FDAFB3247BBE4, 0x18790C2A3B5C1CE6, 
-0x29A44BA35A185DBE, 0x200E8B0E1, 0xDD6137A9651C4DFD, 0x5347F33689B5F49C, 
-0x92BAF0557A191850, 0xBDF69256B0A08F0E, 0x9A646DCAA103EADA, 0x92167949A4218486, 
-0x140DE6B7B7A91D2D, 0xBAEC00E8F0749E64, 0xA9EF5509DEA4FF8A, 0x6C31F5C2, 
-0x8AEFE447FBA8C4DD, 0xA87A62BC9582F00C, 0xDD2E40ECD736A7FF, 0xE512F4058850BD44, 
-0x979854A1C0983D4C, 0x63336CE80569B317, 0x1DFFD6349D8F43B5, 0xE93D441C92AE245B, 
-0x649ACC4EA6327794, 0x1D34BA0A9, 0x76BFD0E3F30D12D3, 0x358E6CB6149FB7, 
-0xD6A74899568C067F, 0x850A916890FC0908, 0x82983AE7DEF4AD8D, 0xD836CCD300B8E4ED, 
-0xE4A9F4E76E8BAEB0, 0xE78205FF031C4A0C, 0x1ACB19D2AEFA3139, 0x1243F0F5D, 
-0x22110174DA40044E, 0x5958DBE87C362954, 0x514AF2BB004E2324, 0xA7B88D048C4C2DE0, 
-0x7FFEAE45A926CE7D, 0xB62AD2ED1D15D14D, 0x29E23771B32606D7, 0x97BF87A0E8E8A4CD, 
-0xC9075E9E70D8B915, 0x2739419C9, 0x7222823C717159DD, 0xA8C765C9C884FEAC, 
-0x17F365B3DE206905, 0x8EB32C6B963BD378, 0xD6E5AA5BB91174DC, 0xAAED6ED507FA7C36, 
-0xD005C00223DD614A, 0x2E588A31229BBD18, 0x93AAE1109A6AEA88, 0x1127F527D, 
-0xEFF581A20BAF5954, 0xD4B42FB4290B152, 0x2841C54885F20DAB, 0xD4E0B3813184F3DC, 
-0x3BA483D11DBA6126, 0x3EEA29DA0B5F21F3, 0x57253FC50CF68877, 0xC17EC43D9E0D44D8, 
-0x67C9B867DAC47FB8, 0xDB9D13D8, 0x72DD7C8676A64099, 0xF8E278EB669274AE, 
-0xC9A905024896F728, 0x3CEDBDB82F72E065, 0x3AB694BE481B520E, 0x78DCDCEFDC683AC0, 
-0x2778DC6C510708EE, 0x424083014F9FB042, 0x27A5D839F47E4F81, 0x14AAB2028, 
-0x5082858B0A0B8428, 0x78A4FA5C7713C78D, 0x44706D95C45C97E5, 0xAB766E9168FE1B39, 
-0xD5EBAE33F6FEA2C4, 0xB26999E52727A3B2, 0x55AB58EFBDE0E8BA, 0x2B02C319D2F50BC9, 
-0x5164D6C3F3787AF2, 0x22C8DE677, 0x20F6593713F8D435, 0x7103886461790D6C, 
-0xFD66809D30CD836A, 0xD01CF3A6AA702A7F, 0x9406E9DC0BE4A91E, 0xEB17E8B213E4257F, 
-0xCEBD98CB15066FA5, 0x89AD5E3E1D795BBA, 0xA8E3F1879B3CFE9, 0x2845AA8C, 
-0x18B4498B24BDC3F4, 0xB637DE7A64682E96, 0xB712FAF1ED95B31A, 0x4B57DCFE61FB196C, 
-0xEAEE824924DC7FF, 0xED55063690D924E2, 0xA34D23A45780D8C, 0xF6D38C51AE094C7C, 
-0xA4066D9D5400AE6, 0x113DB1AEB, 0x975BFFE38A592117, 0x434D8982391CFD9F, 
-0x79E9161681ACCC1C, 0x742D032771422EF9, 0x4DE65B59F83AB4F8, 0x1CBA7EDEDBB8BF71, 
-0x242BFF6B07827888, 0xB148F6A3D2C2330B, 0x1FEE2C095FA526C7, 0x15C3A9111, 
-0x66912F32CF70939, 0x7A5179496BF4AC16, 0x342E657D1EF9661F, 0x33024408228D2BC1, 
-0x23F90BD93F1D426D, 0x2775B3F30CE8ACE5, 0x20EF451E5341EC88, 0xF37B4D9DCA345C2C, 
-0xCC08E207E1C25FAB, 0x1BB69BE10, 0xDE37935D39574114, 0x80BDB6A011201144, 
-0x52B5DD2E3987743, 0x1083FE03781A1EEA, 0x1DD99D5C8D12EF64, 0xBF878DACA3694BB9, 
-0x4903BB6BCC836B1B, 0x388BE9E6DFB97258, 0xF667665C70C1A0CA, 0x97B676C2, 
-0xA69BB712736F8E6E, 0xEE83EC6359D1D7A3, 0x4034587C2086EDB3, 0x545DB8C8CD973BB3, 
-0x645FED637BF9324, 0xA3F6E562D12ED17F, 0xEACE0609E2187FBA, 0x51F650C93B7A32, 
-0xA0DE576ABF66F09E, 0x211E784C6, 0x6F9A09D7C468CF55, 0x319A0C17F03806C2, 
-0x43D341E7E3A3590, 0x9C32F137E7D4C255, 0x4B8FB5F860601A13, 0xF1CD6AEC71BED0F4, 
-0xCE88D8EB924AA31D, 0x5F852A8EE925DBA6, 0x8B97F59A8F3E858E, 0x232B5CD8C, 
-0x6B3FDD15E24ACA60, 0xFBE291EB3850743D, 0x16C0C4E51196A33E, 0xE3FD7643B041F847, 
-0x5188EBD9C79D61B7, 0xB306AF9D6478800C, 0x34C4F93353DA8802, 0x3274B2EDACB5B9D1, 
-0x7D4D747F08C62529, 0x1EF6CA7B3, 0xADCBDFCE73D505A, 0x72B3E2B46529F9D2, 
-0x625FA10CC94120CB, 0x29337BD25133CB9B, 0x19D482B3B3E262B9, 0x3EB45862500EF7E, 
-0x4D5A959ECC1F5909, 0x7D16E246FE9D87CE, 0x10A4157365E4A491, 0x1DFB74E20, 
-0x1930B476A230B7BE, 0x3A42EE16DC949E2, 0x838416CC861CB74D, 0xE43303F18BFF483E, 
-0x30C6C49AC1829C11, 0x40DD7E521AF62273, 0x33AA27D882B23CB2, 0xA970F369B7A93C6, 
-0xDBAC55CF2FEFF179, 0x1967E10A3, 0x4709DA258D7CF239, 0x68142BD88204D1EA, 
-0xAE14B528AE909088, 0x8D813E124214BFD6, 0x8E6949403E0D509B, 0xF795CE2041AC8CA6, 
-0x20F1E1F2A851B359, 0x89B489710FA8BD76, 0x1608B910A609EED8, 0x1F957263F, 
-0x73CFFC32E9B7CA37, 0xF67644739E040DB6, 0x820A54C0C46F61B, 0x95137B08505FA716, 
-0x981FE9E46DCC3ECA, 0x81B2061969F6DDEC, 0x2588EE0651AD8E2E, 0x9BEC9F1B09B345EA, 
-0x67E641D1CC333321, 0x1A98DA956, 0x1930B476A230B7BE, 0x3A42EE16DC949E2, 
-0x838416CC861CB74D, 0xE43303F18BFF483E, 0x30C6C49AC1829C11, 0x40DD7E521AF62273, 
-0x33AA27D882B23CB2, 0xA970F369B7A93C6, 0xDBAC55CF2FEFF179, 0x1967E10A3
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
-0x5BE1ED524F33C52B, 0xE82A6C9C95E44A2, 0x35AC19AA3D2D0C8F, 0xC48D5A6EF316DCEF, 
-0xA75B1FAE1C70541F, 0xBF4709C0460AB142, 0x6B989E232D21267C, 0x1C8F0D2F1F827A73, 
-0x7A1EF44C4B138F94, 0x76F38CA3, 0x1E89B04824B7F00F, 0xB0CECBD277603CC8, 
-0xA7D3D9FCEF3F333A, 0x96A48E39362C5CDF, 0x562632BF879C83F5, 0x36E6479094FC0145, 
-0xA58ECF8D41DDE052, 0xDC3DA3C376FAA4AC, 0x6658A30D41B00A4A, 0x1AC7A7CC0, 
-0x4505A22B44048A6, 0x19F3A6862BD40254, 0x7C43EF221BCF02B5, 0x6B2DFEA48B5098B6, 
-0x6E06586FDB2FB0AF, 0x1097E2BCBF9ADEDA, 0xB4EC7813CE4DA07F, 0xD12393C9E4990B29, 
-0x3FEE313BA5FD37A2, 0x1A17AA2A, 0xF167C294F154F59C, 0x8A597350936E94C2, 
-0x9FA898086E4BAAB3, 0xE81E3DDE95E49C58, 0x3FCCFAEB8E00D887, 0x731B0E03E4A278D4, 
-0x4A66222E70B0D80B, 0xA63038C5CF23DEB0, 0xFA9EA4C23B762257, 0x35EB2E52
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1). 
-
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0xE76420CC37DD8308, 0xA92FF26EE4745DAB, 0x377A25B425FFB178, 0x2AF8E297BFCE0D1F, 
-0x2589D47C051EF1EE, 0xDB00E9682F7F9205, 0xE9967060F9E3EC7, 0x154FE450E6CE6B92, 
-0xDA2544169F466B8B, 0x21CDD1EC, 0x79CD0FC4738F4FC5, 0xCEC3E5C7DBCAD38B, 
-0xA94B3CFA13400C01, 0x10E6396CABA4A834, 0x72E8F09F76B2EDA3, 0x669163F4DC456D51, 
-0xBDA1AACA2C93BB37, 0xD239CAE9D0D64DBF, 0xF72FC60D1961F96A, 0x1A017D00, 
-0xB2215859497ACD04, 0xA752EE064241DAD5, 0xA76D04E5DE9CF1CF, 0x823007A316BF06D, 
-0x30A19BF25506241F, 0x8757C8F92E225574, 0x74F318F5980DBEE0, 0x4F61DA2CF0B3BD1C, 
-0xD12DEF2F28060036, 0xB854AB5F, 
-0x611A44C308A6CF4, 0x921C2D38B4AEA068, 0xF71BAE5E2F48A77D, 0x47F3F57089A01C34, 
-0x27177E7F6FDDA550, 0x4B470FC33533A72B, 0x400774262E5F56F5, 0x9B8C3B105B3C883A, 
-0x5BA5C8655ADD44DD, 0xB4BA6DC5, 0x474076BF2DFCD8B5, 0xA8EC91566930A7E5, 
-0x4DF93554A0B82B92, 0x2BD5736F76063698, 0x61EFCA5F3FBB56E6, 0x176E73E317EB5415, 
-0xFC9C5732C9773153, 0x9BBA66FB3D0E0D3C, 0x2BBA98162A1E811A, 0x191E8A2F9, 
-0x5CCBF592A41F9C47, 0x477BC6E5F680BFAD, 0xA3BDC29575D57A6B, 0x2A6767D8EE5A4FF7, 
-0x3275482178B202, 0x48FD1178BCD644B8, 0x1449677E9BB6D2CD, 0x841E2100C7643702, 
-0xE56970CF517A5A45, 0x4988AD97, 
-0xDCAE6F11D7427B31, 0x48806E91A39CFE89, 0xA4849BCEA8102C03, 0x8E560FF5C279EEF6, 
-0xD3BE8E4604A31BEB, 0x5812DE6ECE9D598E, 0xCD5F2849753C339E, 0xD67B5B8417E81027, 
-0x94CC38B6A28B2B8D, 0xF2EA33DE, 0xCD71A58E3A9F4EBF, 0x95D0C9FE2DD1E9BE, 
-0xD636165223448FD3, 0x6ABB6BC4DFA92689, 0xED46D50784214072, 0xCBD1ACE6988F45C9, 
-0x36E5F1FBE59DD554, 0xDE08F9F492F0C1D, 0x30E441A59E5F4778, 0x27B9F69FE, 
-0xAFA56A94C9CF483D, 0x2192A57F6B1EEE3A, 0x6F936772964C8407, 0x84941A3BC590A2CA, 
-0x15F3BD3F6B677BD1, 0x9D7D7560E771A039, 0x4E381B7E59A38FB0, 0x5B6A32FE1C82DF2D, 
-0xB97614E6ED143343, 0x52D26742, 
-0xF810F7E3F4935152, 0x6FD1CED8B51B14D9, 0xD7684DAD708166CA, 0x770BE11C32D8A0AC, 
-0x2F4F7AA5390A0DFE, 0xE64CF61B5E914CCC, 0x8EF26F27A5898206, 0x7938B247C3675069, 
-0x3882B198890C175A, 0x16D795D57, 0xB5BECEAE19C633DA, 0x6FE9C2EE9D63CE60, 
-0x7AD23A78A93A5F7A, 0x8D93B66E673424AC, 0x2144807DD60D5324, 0x9F20C0BCFA9259, 
-0x93B4379BF699746B, 0xB6CFBCD8DF2AA34B, 0xCE1E247732921F0, 0x26D3A1A70, 
-0x72307622E528A148, 0xDED7BE01E4138773, 0xE386945F26C2F9EE, 0xF1D3B7F082E3DCB2, 
-0xD9A4D835F6BD545D, 0x8B3E666CE7062319, 0x224F19D6903000DA, 0xCFFF4EC9583E5055, 
-0xBE625F853687F2E3, 0x1F47531E9, 
-0x60AEB69F0F12FF49, 0x920740A6171F31A2, 0x264301AFC2E17945, 0x1CF025E2B63DBB10, 
-0xDF9AC49BD709F687, 0x1258DDE964761EE1, 0x43F01D4A52B7EDC3, 0x915AA0928721B0C6, 
-0xEE8CF27857A3EEA1, 0x20CC71243, 0x7B3E0F8C1E67B876, 0x7849E97064612AA0, 
-0x55D9C72DA054EF1F, 0xB587DF4503C95FD5, 0x41211FD23DEA9BFB, 0xFADC50A252B22A1A, 
-0x62250BB1EE9AE790, 0x687DB2EB4C1EDC59, 0xAE555824C68D3085, 0x268C77918, 
-0xE64028043D9145AA, 0x51A41D2047159B5, 0x9AFA848999D9EBDB, 0x757283C61A603CFB, 
-0x9627FD75F5CAA530, 0x7BA6322369D5CA66, 0xD55E3D1B51685784, 0x5362FAA489789D67, 
-0xF39972999BF3B6A2, 0x279BB97A, 
-0xAED1216787341C3E, 0x908C6A7BA6B01037, 0x9BE89656D0A36351, 0xC8ECC4A1C7C34628, 
-0xE826D224B22FE427, 0x28087201B385B63C, 0x995D7CA3814C7CD0, 0x861C6BAF8C50B65E, 
-0xAF2C1646F2F8C01A, 0x14FC86E03, 0x15829DDC1C8BED71, 0x4EE455BEAF68966B, 
-0xADCF0B3CE10416BD, 0x205A26EAFAD24065, 0xF9B1423C42BDFE7C, 0x275664B9C7E4A57D, 
-0x60328D087BB6B69A, 0xDDED5244047A515D, 0xBC7C716EB05A45AD, 0x7C2BD20D, 
-0x2251B27901ADC2BA, 0x220C9711C773827C, 0xA20B17312E44F884, 0xC88AADC105C5F445, 
-0xDE09F493916EBD95, 0xD0B10F356B40F22A, 0x93AB334CBC5796E8, 0x592B6F2CED55E2C9, 
-0xE758384132E52C0, 0x1F65576A7, 
-0x405961B9774C8761, 0xE67D960CD77FCB54, 0x7D6D34BA3898949A, 0x2BA7BB1D9668BD8, 
-0xAA1E7935632DF103, 0x2F90954953A09BD7, 0x9F98D7CE473C0EC3, 0x8DB0A93865E6223A, 
-0x3CA39555922E04F2, 0x3E57684F, 0x896080ED05DF7596, 0xBD5C1C6F7EA8812D, 
-0xAFAD6A5F800B2232, 0xCBF98BEA3CE9573B, 0xCBC1F2F3CAFE767F, 0x4057675C8D4BB81D, 
-0x46A123D9FC0A4ACE, 0x2B490E814AF89C16, 0xDB090953996C364B, 0x1F40C886F, 
-0x89359E4181E5D9F3, 0x289DD05377DB78E6, 0xB3B0C07ABCFC4A04, 0xBD9EFC5F8B614723, 
-0x4EB2CDD0E5A5B679, 0x3643AD7B6003F281, 0xBB07F8621EB37434, 0xD32525E1627940B5, 
-0xAFEC13AED2DC5FFC, 0x1F2BC16C7, 
-0x4F25ED51F2DA86EA, 0xA5BBEA03A85E0E41, 0xC6ED4765BFEFCA1C, 0xCE64415005DFA33D, 
-0xF5E879A55E55E458, 0x83DF89E567D053A1, 0xB394FE355FC88700, 0xBD45B34EBA3AEF57, 
-0x634DB44F8252C18E, 0x20C521A1B, 0x5D414B47ED6DB7B6, 0x2BBDD0E469704FCC, 
-0xD1DFEF455A164A5E, 0x446561D0FBBAA3A9, 0xC63ECEDDD494A83E, 0xC8B89E35D49D21AE, 
-0x83C69A46B3163CA9, 0x96649CB8B176E336, 0xB585F986D6152C3B, 0x27832BD3A, 
-0xAB284D12BF6EF07, 0x724015760DF5BECA, 0x3ABEE6F09B1F3D87, 0xFA2FF92B57F927DF, 
-0xF31033DCC310F9E7, 0xEBE0F34846D0CDB4, 0xEBE9AF6B6C2837C7, 0x9BAC7EF70985D8B5, 
-0xDA4729D6ADD221EF, 0x1F03B652C, 
-0x6E506EBAFF26728D, 0x7FBADEB1174BBCCE, 0x2510BFF6FDFB8243, 0xCD05098C173FD8AD, 
-0xAF4E01D40BC210E2, 0xF9D81C76768C197D, 0xA3CAC6108C447368, 0xA530B13CD0530348, 
-0x49FAB031A6F487E2, 0x11F4F7A6F, 0xE3147613CB95CE, 0x17FD57ECD5A6298C, 
-0x649AEC524CB72202, 0x626005084F0EE06E, 0x3F6A9C7186D64CED, 0x4445B842868A7C72, 
-0xD492216BC9D38B43, 0xB90D2D9A90124185, 0xED282ED0FEBF8921, 0x177D113A1, 
-0xE0FB4E10339F6732, 0x32F1F5FFEDFB7FFF, 0x49E129B87D8D095C, 0x16B2B8E489B9F77, 
-0xF68CC1FC6766A782, 0xD8BA1B1398F7A9CC, 0xC3DB37DA9680463E, 0x800986502D924078, 
-0xD3D39E201323B77B, 0x9A39C58D, 
-0x219D3FA18644ADB0, 0x7987936057F48063, 0x778328676CA162A1, 0x4571CE486E4F4C91, 
-0x4B249772A513320B, 0x78E49BEBEB112997, 0xDADB1B2F08F4B59C, 0x213CE1247E80CB01, 
-0xE7C599AF93153182, 0xB5C8029D, 0xCD9C7A4CAC8A0140, 0x5C7436524631F66D, 
-0x363CD9D6BCCEC2EA, 0xD9BB67FBBD221151, 0xF87FCAB6EC617EC1, 0x61496D9B4BA33C9B, 
-0x86D21FADD8F971B1, 0x846B5D081BD0BBAA, 0x4246650BDAEB66E4, 0xBB8839A2, 
-0xA4168E3E2662097B, 0x7CCE694E6257FAA6, 0x4090C55FAF7D4F5A, 0xAD41323B1BFDEF80, 
-0x17C9A0E3301B3FBC, 0xC0A32CF7B884B6F0, 0x62B12714EDCE57B5, 0x250A56A91AACEB3D, 
-0x326B8110C4E42D44, 0x1A1127288, 
-0x99B76D5A92478668, 0xF98E82F10BA11E0E, 0xF8965B56F42029BA, 0x806AC1EA3CADA7C8, 
-0x64B4C1A762C532F6, 0x28A2CE7ECBB49755, 0x70649676389AA360, 0xFEC48A106BF3BCFD, 
-0x4386A55762AED59B, 0x14D8BA5CE, 0xE06F2D9A0ADD20E8, 0xAB8E156F5DA77B84, 
-0x99251B821C70B313, 0x75209D3079535D4D, 0x88A2F8278C5DDE28, 0x95EB3486D88D8ABA, 
-0x2DA8571D8C35FA75, 0x707960B2E840578, 0xE83477D02EE09AE1, 0x233E750DA, 
-0xB20C4F9259ABAA68, 0xA88712F5410FE02, 0xE7D1DF0C078D5F8D, 0x10D2ACE2B8FEE6CF, 
-0x4874DD476E33AE6F, 0x8A9DC49D76C575E4, 0x8A6C4EE082BD0F1B, 0x2EE343D3EDBAAB7F, 
-0x782DF49B60DFAAE0, 0x1D3CF6EC, 
-0xDA039DBF649B76F0, 0x4F1EE60413E08EC9, 0x31B41CD288FFE9E8, 0xBFE3D7FEB5B179F5, 
-0x1813268CDD6035AE, 0x9DCF1980BF4D20F4, 0x726851313FA7A58F, 0x9672EA2698C2934, 
-0xC953FE0A1984339E, 0x1E8555CF, 0x97DE6B2CE588D2E6, 0xEAD1E7B8D3742315, 
-0x4281015C056B41DA, 0x7BA13EB939F0389, 0x979D086D3702E0CA, 0x6C2EBF075712C2EA, 
-0x265F91A8551F6A90, 0x6C872CEF618BB4E9, 0x10F4E82C6ECB568E, 0x105E731C5, 
-0xE77A66D1083FEFC4, 0xAB3CA15697810493, 0xB3A732490707FD39, 0x549C851E6187EA7F, 
-0xB2E0605747D7CC12, 0x4FE14F316D2C2B1, 0xCC48408467541C24, 0x2293EEDD324DB79E, 
-0x33EA5662EC9A13B5, 0xF7C878DA, 
-0xC55FB0D9995CE980, 0x84128E82587D21A6, 0xFA293DE0BF54F650, 0xC1CC805EEF4F2565, 
-0x361596C7BFF7E59E, 0x13A8AB93A61BF17F, 0xA7CE7D5703AF21C9, 0x6C75640667FA542F, 
-0x21646AEDE30AD0D2, 0xA1E5ADC5, 0xE8C14E9954441911, 0xBB751C7E4503B610, 
-0x9DC233824EF39E8C, 0x9C6CC2F0F5E66BA3, 0x2328850A7E2E91FD, 0x9DC18006E2959348, 
-0xD178627DB883A560, 0x6401F5E27FB2F056, 0xAF7A85C313E7C233, 0x21BF516F3, 
-0xBF82CF53F7BB41C0, 0xB62D0AFEDFBC99DF, 0x91E3CB099986CFD, 0xFAEB3EB957D8C9BF, 
-0x95C44321ADB4D834, 0x219F7193E2E596DD, 0x84BD45B8B6BCF5E2, 0x7A141A32855421A8, 
-0x65ECF440C0857BF, 0x556255E, 
-0xD33D853CFB04C515, 0x79550AAAFFEB01B1, 0x8E243EADBB6701C7, 0xA116C9BA0FC18E03, 
-0xC6EE1B25B4D2B756, 0x9474A3188E820134, 0xF638987EF8C41994, 0x86FD25D79F9512D0, 
-0xFC74AF1E53A4AFA1, 0x237E38215, 0x7F8FCA49FE36C3A4, 0x56C33104C810A9AA, 
-0xD24199045963A9F0, 0x68AD10AB825A87C7, 0xE8809F85847F7F72, 0x73AFE69BC5749447, 
-0x384BFC3193963EF2, 0xBEADF96AC12E785B, 0xC31321638225671E, 0x1840E6952, 
-0xE1AE87AE6F1FBD09, 0xE5F5534F2CD246B7, 0xA8CD425A587A69B2, 0xDAD1D1BAFA862E0B, 
-0x66B9A0E0C25E59B, 0x86F0932B0711BA79, 0xD54A0E09798495D7, 0xCA41F3A266933888, 
-0xE2AE43391A457A06, 0x126C301CB, 
-0x327AE126A780E487, 0x126578E66CC2060F, 0x407302340EB486BD, 0x5D78B6589E80A85F, 
-0x685A55148C78D9F8, 0x76F981512E1C079B, 0xB22F7153D28792D1, 0x5114F84B078A0F9D, 
-0xD21F2AE78FFD92A6, 0x1E362D487, 0x75B91155065EBA55, 0x1BB54FE61C418ABD, 
-0xDFA14C363BC8922, 0x54AD04CDCFA99C14, 0xB143BFA276F78402, 0xFFDF77719435D80, 
-0x25352491BFA22FA2, 0x3768F23AAE737551, 0x5149B6A1F9DD163F, 0x26E742D61, 
-0xB7261FED5A8BB54C, 0x4982AC0BBA3B6334, 0x2D1B6D690D240106, 0x2CB4835781266769, 
-0x43BFB8F39302EFF4, 0x1249BB84469C6712, 0xAD35848C228FC0C3, 0xD63BD8F29D0206BF, 
-0x7CAC51F4B5148AAD, 0x22DCE8E9, 
-0xC041C66B0F965498, 0xC32E7DF9533D6AC2, 0x6B3E4BEDEA58BEBC, 0x46561824233D17F2, 
-0x7D5CBA047053D414, 0x76F08C81430162E9, 0xA7558F5D33B073B5, 0x7FE4428E89BCE0EE, 
-0x61C036FB9B8E32B8, 0x98CB91A3, 0x6EA3BCD8B427A820, 0x266052A007EECD7C, 
-0x3143FEB93AFF16B, 0x1661FC4EA8F1AC6C, 0xFC9A4756EADCFE76, 0x6CD18660F9BC8509, 
-0x6E37828C7C65A540, 0xC4ABB702472A16A8, 0xBAFE492A10506BB2, 0x1FDA5BB3, 
-0x904784AD9D2D0A0, 0xE783ABDD0E5F6787, 0x3EEF666AF19E1113, 0x10E110927F450B5A, 
-0xCAE5CA094A867893, 0x85A5B2DF61792F56, 0x825E87204DF3D7F7, 0x694E5AC79561CC9C, 
-0xBA616986BF3F777, 0x9D65C76A, 
-0xF0DEB8036304394E, 0xA5F2C85C0389DA69, 0x63509B9D20613BF2, 0x1E065DEC39C2FFBF, 
-0x16A130524928F702, 0x33F5A5E2947DFEB8, 0x80442AB6BF9EA028, 0x8FB9A1E6671F74B9, 
-0x2D7ED8EA3C2B98CE, 0x178AB574C, 0x8BC7A54ED1858082, 0x3098FB596582E588, 
-0x7077860BD9DCEB32, 0x9907E975CA098453, 0x2AFC926C7A68CBF4, 0xABE613BD90B6AAB8, 
-0x49C6B51D3863DC42, 0x2CCEAFA5C77AC4F1, 0xFBBFAEDEA2414688, 0x190557DA4, 
-0x39EDC186BDCA4191, 0xFA65D343E4FD3C6E, 0x297CD79F6964841A, 0x1A52A580F51C01D3, 
-0xE1DC2E6006A2A18D, 0x4DBF1AB06EFE61E0, 0x75EBFFF04D86E21D, 0x3781B3D99AA6DEAB, 
-0xD07B4CFABAA092D6, 0x1FF634B84, 
-0xA920327E0583F3D1, 0x1800978CAA6C0C6A, 0x6BEB8954E7B870D2, 0x4962B0D7F3AB3255, 
-0xB4B9D14EE4C675DE, 0xFF4A0F6B413DAE40, 0xB03093813E2DC7D, 0x95EA8B632C2BACE7, 
-0x6A5859D4AE5C3559, 0x3A215BC1, 0xE4FAA5A71C338D45, 0xBF24D6C14AF81A98, 
-0x734AF19D0707731B, 0xD08A3148C104F39, 0x2A6F9A04F6969959, 0xAD8646F1580CFB7F, 
-0xAA95D33BA454C634, 0x740EAECFBE4D0C68, 0xB719B3888F1A285D, 0x8E01CE3A, 
-0xC106E85177C5D526, 0x184FE1BE167A535F, 0xCC9A7B6A7B653849, 0x8295EEEADA2062AC, 
-0xAAC600553043CC4C, 0x57E4BDD4D79ABABE, 0xE054AEC1A2A226B1, 0x976FA519607B111A, 
-0xCB0803D52E8E00E6, 0x1F051965B, 
-0x7497A1845E1635CF, 0xB59C119ACEA2C9F3, 0xDEE7387C3A6BE5CA, 0x68771557B1FFB3F, 
-0xDC0C04780CA7662B, 0xC30BB02ECD8B5B4F, 0x866CD81710709863, 0xE63037AE241F118C, 
-0x93CB696582291963, 0x1EC911179, 0x50379D761B4E23FF, 0x9B9ABAFA95DDBF09, 
-0x956455A347EFEC70, 0xB83A771B71727CEA, 0x96365721C0096432, 0xBB8DB479F3512AD2, 
-0x12426567B6A6CF2A, 0xD808FA559C2B4B51, 0x256D264DBC593B1, 0x26E16A47, 
-0xFE640047D2C7EECC, 0x7082134A09477858, 0xB49ADB1193AB1C8D, 0xAC4B045EECC9DC2A, 
-0xD0C071CD86AC09EC, 0x22875AE2A9E8233F, 0xD00C1145F7377AB3, 0xCF68B6F7A37FE1BC, 
-0xD8328BD6A245B592, 0x17C62FDFD, 
-0xA0279F7D488438A, 0x8E54CAA7D31EF7E9, 0x317E238A4D5A4660, 0x98699BD9E542DE60, 
-0x5987B470BC5BDA77, 0xD7A46A46E06E7526, 0x4EB2D3911F0C6FE6, 0x5E878A1443B494EF, 
-0xC6A8CFF9A4AF13CF, 0x193EF77D1, 0x6E78C3DDF388866D, 0xECFF3F2009735779, 
-0x8AE1BCFFF0FA486A, 0x468DDBC2E679EAB0, 0x3F009A2FF05868D6, 0xEE62C36010986466, 
-0x1B47A01D66196BCF, 0xF7C95BD1F857550, 0x6AC44008FE7F8287, 0x14539AB01, 
-0x1070E13D1BCC53E7, 0x6488D783C9D8456D, 0x467B214034BDC4DF, 0x32AA34155F9C80BC, 
-0xCA62EDAA49493859, 0xB79ABDED05EFD0C9, 0xCF070568F90C1D75, 0xE6D92DB2E94FCD27, 
-0x36BB51D18DBD626, 0x118BD3D83, 
-0xF9D1D95C29804E0B, 0xE9F12C1B18AC444F, 0xD9FB5281880251D, 0x1C7E8B0B361205A0, 
-0x1617AB6D27D39257, 0x282B9DF3F4E597, 0xC88694EFB973C55E, 0xA7F0D13BD8A42C74, 
-0x233B66285F5353B6, 0x482DBC63, 0xCD2B6877F14107AE, 0x4E061AC0FC7671F4, 
-0x5CF45014700616E3, 0x9A10FE737230DB61, 0x71AB8E4AAC44D2D8, 0x24F90CB35D6DE518, 
-0x2A301D7E91070402, 0x2D4A652312589761, 0x6B12E7EA9C1E2257, 0x20491C74A, 
-0x52C06AE6E14E6C39, 0xAC46C8397D4BE928, 0x2E8038BBD5E407A5, 0xB0336AF6D3F749C5, 
-0x968AF38E05A03425, 0x84FFC4AB9B32008B, 0xB97584920C6C0872, 0xEAC0AC82A13D3C7C, 
-0x794DADE11357BACA, 0x234384673, 
-0xC788F3E6FDFB908E, 0x77C5443754E48F90, 0x352A714AE258EAC2, 0xD004276FF87992D1, 
-0xBC4647C00FC78AB4, 0x986CF329AA822FDB, 0xAAFF4BF276433AC8, 0xC469C0892661C1F3, 
-0x81ACBFD38778963B, 0xB6B8EA97, 0xD24635ED7C5378C8, 0x635E741118869C06, 
-0x9E52DCF2DE7743CD, 0xAC7758E11429C987, 0x714F8CD5B3F72A82, 0x3470C8443AEB6670, 
-0x633063BCAC8D92F3, 0x4AB705C21F71C67E, 0x1E9DB727CDD82D8A, 0x1C88817E4, 
-0xE16C9459F8705F6A, 0x42DD8683855C9965, 0xE3FCB08717953F05, 0xD7287F108AD807F, 
-0x1E890CFB21AD5775, 0xE3E6A4A5E1903EDF, 0xFC5D63679B8D3EA3, 0x692EC22C554027EA, 
-0x2C08A81A6F8576C8, 0x806BFDEF, 
-0xDF17E789492BCB28, 0x68BAEDDB602B6877, 0x509FEF9339868109, 0xA02BDA966F33911C, 
-0x8C50D0AA89705A82, 0x72EEF72D9B66BDCA, 0x9D508DA096CA3347, 0x6E9900A4005E98C0, 
-0xF6C43AA53B036BD, 0x17B6FEE43, 0xA8E195A5E2BEB51A, 0x1C4BC9D144EB46A3, 
-0xE5E482F9295EBCDE, 0x18ED5FD6EE087A03, 0xBABF0F8D916ED616, 0xEF336362F5FFE824, 
-0xC21089040E1E04D3, 0x928CCAFF03CEFAB8, 0xCD8D8CB3B5A6429D, 0x1F0136FE4, 
-0x33F3C62573FA28B, 0x2C0788E6614E8C55, 0x4F4945240EFC44D1, 0xEAA2DDC8A7E75DF9, 
-0xAA2F6B6937577705, 0x5E34C82595F0113C, 0xD2DC5E8BD521B126, 0x59E808B03DE5E0BA, 
-0x7896C71BF1CD2282, 0x237148D38, 
-0x947D7D382C1609F0, 0xCB741C311A126BFE, 0xED41B84116A9D504, 0x4AC65566097E7444, 
-0x31160BF3EC282438, 0xCCE5D3006FC0BDDC, 0x9BF511905735A72, 0xA2FFA734E2A724DC, 
-0x711E52FBF184D5F7, 0xE8C3E393, 0x983006A5FB88F719, 0x9DAE4ECC5476BABB, 
-0xBCCD7C22639B4704, 0x9AF49636AB37643B, 0x32BF0EAEF85B1326, 0x8DE73144F26A3741, 
-0x7B677A3CDBC7C35D, 0x47BAC732A4DB6507, 0x21D8A6D49849DFAB, 0x222CC459, 
-0xB830D660DA31A720, 0xDCA345715EDD772E, 0xE73C8E45591AEA95, 0x848D35956AAC5672, 
-0xA4AAF3F477A4C384, 0x68625EFE45D8C7D3, 0xFFCBF38BDA3FE6B8, 0x3F3A617445760F23, 
-0xCAD1731DC4E0F498, 0xB4BF4487, 
-0x5352F02F0D0949C7, 0x8CFC3DDBDC7B13BC, 0x44E29A847FF0F957, 0x5FB8E9382B063B80, 
-0x267543B251C56295, 0xF921206989330EEE, 0x9FEA8CFF7C56D4A9, 0xC0EF14B76905BFE9, 
-0xA3640C1F1D4FD39E, 0xE6719938, 0xDB5BA13C74A62DDB, 0x22E4658B5B652CC6, 
-0x9F167C815A16C460, 0x27CD9A0230E3C9AB, 0x3FC5D88055A2F125, 0x7FC77D69D821315C, 
-0x540D19C29692FB8E, 0xF42847988201AE05, 0xAE459C0A2E93C21C, 0x13711701, 
-0xE7842DEF3173CB95, 0x6651651C275BCEC, 0x7CA877351BE0AE4E, 0x9C226FEA65A789EC, 
-0xE52AAF82474DD1E, 0x335EACC58B7082BB, 0xBD8CE047BFA1CD6, 0x43334EEFF153EF1C, 
-0x4CC6FD5205BAFA0E, 0x1C58BEDAA, 
-0x8340CD49569FB33C, 0xD48A01993EF4ECE2, 0xAAE5B8A34093271, 0x98B3B7C7B03746FA, 
-0x23F5E9C6D943FC7D, 0x7CB86EE8D3466066, 0x10D1A0CF6723C79, 0xD47F66460F63941D, 
-0x4B0264E98DD494C8, 0x181C4BD0, 0x5710016B1CEB8BF2, 0xB1D319EA4394BC09, 
-0xC50C8A3A03EB0BCE, 0x6BE0A9B553938C8F, 0xC74ED1994C06F736, 0x93CE7AAAF3D5642B, 
-0x7F48691780610F41, 0x8289B9668C67979A, 0x68F559CAC9DE324D, 0x1E28B5326, 
-0xA552B1CE3DB98948, 0x8D64904C0F82C2FA, 0x4F44776A9D25ACF3, 0x1402AD85C47ED6D1, 
-0x137FEF025FEF536, 0x441F3E4E02E7FD82, 0x9369DEF92E24E87C, 0x871B5411F8B5CCCE, 
-0x457F705D610E6F34, 0x7755357C, 
-0x41EE4D9B6B0CE5FB, 0xD1BFB6887C6B946E, 0xC51643E0353577C, 0x395F9B5DF8F0EE00, 
-0x15DDD1C220F07210, 0xEF169B081881FA30, 0x66527990B37E1805, 0xED9C220B45546409, 
-0xF06CD44D0DC895B9, 0x2671A0DFB, 0xF3319C2237045F7F, 0x5196A6DB093F74E6, 
-0x2976731EFB9F95AA, 0x17567B9BA57ACEE1, 0xA4661DD0CAD4C25E, 0xD763BBE4F839D916, 
-0xD40B4A8994CBAEC4, 0xB35846AD18CB2B06, 0x97CF5A7FF04F2249, 0x2114DFFEB, 
-0x52792A910782E731, 0xA404E798186200D0, 0x611E174C2ECA15E7, 0xC7289CEDA85C11C8, 
-0xE656623EFEF6E753, 0x90CA45E4C7DB415A, 0xC258071A4AC4CC25, 0xCC67E213E2437D08, 
-0xF6983A05D12297BF, 0x1BBC7F3BE, 
-0x2544AFF725F80EC9, 0x32295884B963CC6E, 0x8DA3D7AD35F6FE09, 0x725BA2A23F9E5E5A, 
-0xC0F722C050E12454, 0x67E2BE7FAC69AC00, 0xB911CB830598347C, 0xA0C44BA2EDF2203C, 
-0x7CB3AEE49F21919E, 0x871CAD6F, 0xD93D23DAE2109898, 0x10254AE504910375, 
-0x685859CEBB9FE213, 0xB7D354ECF678105E, 0x602971529054593, 0xC34BBED54E354076, 
-0x16B2600F0DC14806, 0xD32A330460CE9C9C, 0xEA2695AA4E2EEB47, 0x9CE02DB4, 
-0x1AE4B6B60AF18E1E, 0xB3242DEA514BAF4F, 0x9EB0FF67226A34B, 0xB2BA162D3D033AB3, 
-0xF561E106F365CD0B, 0x3169024FC4220B5F, 0xD6B5B348A2BC9940, 0xC08B3B6C27EDA5BF, 
-0x1D4D719BEC5285A8, 0x240200888, 
-0xF685596D2D38D3C9, 0x431F7340AEA02BE2, 0x7526F86BF78A20CA, 0x26D5D1ED0E6DF6C9, 
-0xA634F6AF835A8A96, 0x3B41215BB4C803CC, 0x98CCA992AA073D63, 0x339B3EDECA149F38, 
-0x218DD09FC2F54639, 0x680E6EC1, 0xF41A05CD0EFDB28D, 0x5502D27E8E23B460, 
-0x537518C938E8B0BC, 0x9F5414EE6547ED29, 0x11DB0F855EEFE621, 0x5744FF1743F864D9, 
-0xCF495439E76F80BE, 0x144E54D0433BA92D, 0x9403A0AFF7C429A, 0xC17B97EF, 
-0x3C4E56A2F44BA2D9, 0x75A8CC3F9D7F3E53, 0x87331982B391852C, 0xD807BBE3EDE105E5, 
-0x5149398905045233, 0x8467F0639EAD990A, 0xB2B59384ADE7DA54, 0x51939003E745AC94, 
-0x93A2C6964F995063, 0x16ADEA5A, 
-0x6E63D2D749F62D8F, 0xDDA011E6CA109D43, 0xB26F7452B4CC482C, 0xFD674FD2E55A92FB, 
-0x56EF72FF17986DA5, 0xF7D756028040C3D1, 0xE6829CA1DFC633EE, 0x3607580BBD486345, 
-0x6D0CA44D5367A413, 0x25D03B989, 0xEE93E8AABE02DAD7, 0x1B92AF96F45B03C8, 
-0x8324197344415E2F, 0x362E2691FF53DC9A, 0x9041FA99E2EA9CF4, 0x9990567826567B0B, 
-0x81BE3537C69E1EDE, 0x167659EFFDECA9E7, 0xBA7A05B74747F7F1, 0x9931A425, 
-0xD705BFC3579B77B7, 0xD7168BBFF879D2A4, 0x6DDE8E7B6FF45A96, 0xD9BC64029F12B66F, 
-0x11C2DB72A6D71E0, 0xC263C9985C9CCC43, 0xAE6986BDDD03EC59, 0x72B837D3764AEABB, 
-0xDBB0AC16F360D940, 0x24644E447, 
-0xF6F9ADC9A3A69F4F, 0x9894034283218412, 0x97F1D029962C6674, 0xD7EA1A6AD4E7BDA2, 
-0x829E25015DBA1E60, 0x932435299E00A40A, 0x4288063FA041F093, 0x88BB5A88FCC55C58, 
-0x67497BE7D7F3B7BE, 0x1BD8733AA, 0xF2F81BF6AD1E2AFE, 0x66CAC80466AF00B1, 
-0x227D94A5A03E8553, 0xA223ECE11A95331, 0x4899353A4C332B0E, 0xE7DE6D05B81EE084, 
-0x8AA3F861D72686A2, 0x58863AD4525CFC53, 0x52F696D7DB643B2C, 0x19C89361E, 
-0x39C8A797D7A0B659, 0x3E46479B27B7E2AA, 0x28BC37C739EDE86, 0xF703C4EE9E9E88A4, 
-0x8DF882D61BF92C11, 0x7C67803D7D192104, 0x4313751A6E40644B, 0x275B1C3912C9E5F3, 
-0x3C4EDD93A499F4A9, 0x16FD720FA, 
-0xFA7AE6CD7B9A6122, 0x4488C28B41604004, 0xC0E6ACD0AEE30317, 0x25418CFC469E04B5, 
-0x44D0AD96C45924C3, 0x66F096AE8F6C03D4, 0x203C81CD65C46174, 0x22C961DFBF8F1F19, 
-0xC88798BE43383172, 0x22A9CFC38, 0x66DD0FE5D56E2688, 0x6A1566B6BB069484, 
-0x13D2DD7EC0DE2534, 0x6D81E208B1A2EEA8, 0x8B1B1039ADD35796, 0x3E81156BF3117477, 
-0x6D9BAD8C4D0D300F, 0x7AC8306447E9367E, 0xA80679540671BF43, 0x83D374BC, 
-0xE41232D734B000D2, 0x1E516CF0F887496F, 0xB89B6AB09C1D0738, 0x25868AE81DCC3CF8, 
-0x78A3B06A6C938820, 0x6A447C4DDB279C56, 0x60C46038E271C4A3, 0x6F21ECF669559BC7, 
-0x4A70D32083F65124, 0xBD8A281, 
-0x54882B1762ECC36, 0x7BDD8E61FEEBD4ED, 0x72DF06E6B5E8F0F8, 0x1F89D723E85E719A, 
-0x6E870B84838382D, 0x2139E61B384C31B3, 0xC7E636AA1378CD6B, 0x165C9BFCF3EDE60A, 
-0xD41F2C185CF4777D, 0x16DD8B8B0, 0x93E6840C003C6487, 0xE45E7C7587AC6D5F, 
-0x9C0989A937D33167, 0x45A5535A7B5E9CE5, 0x6FCBD21492BEBBC8, 0x7E4FE309C3985CE1, 
-0x6EACA073C30E32C9, 0xAEEC5B1462EB1384, 0xDC4050CE0BC76C13, 0xFDF06B56, 
-0x8E935B864E0D11E8, 0xE81AB704921BE624, 0x9EFE4ACDEDBA0991, 0x4BF0EDCFEAC5C270, 
-0xD4CF5AF46E7FB0B3, 0xE35F056897793D6F, 0x29C0B3EBC9C6D407, 0x4B59B07653594C8C, 
-0x35FF7D13E29056D2, 0x26CF88696, 
-0x4659227F00230652, 0xC1DBA73807FAA412, 0xF21206333B01A08F, 0xDDA8305FCA2595A4, 
-0x531FDF95228E5142, 0xD348B56DBCAD8EE5, 0xBB7BE5C924E10E72, 0x6317757B96AA8A3C, 
-0xC79E9428BA805803, 0x547551C4, 0xE793EF318486A69A, 0xC34D3DA87B2B63D4, 
-0x10BC44AA520ACAD5, 0x6549BA60B80F7CDD, 0xABA0B64296EC5DC6, 0xEB5043160089C02, 
-0xCCC6F41CCC0F54E, 0xCECA571BACE7E846, 0xD7D58C0783D7F361, 0x1A1195361, 
-0x9BDF10BBF3656FF4, 0x805991B1922D1DFA, 0x98E54C6DE480EC95, 0x8D27F0E7E40D94F, 
-0x58296885E9F1E2AA, 0x95DC69C6982A6D55, 0x4B057D711BDA0AE, 0x545D9210DBC6539, 
-0xCF21ED60A1B99232, 0x1C6251918, 
-0x239B152E2D558E64, 0xA898D779E5F3CCA1, 0x17E2C3D1868406B7, 0xE135B52E2F6DDE55, 
-0xE68EFF2E49FD0D81, 0xA3D2821E570D9A04, 0xA0E299E022DC9B7B, 0x8B4A5420E4EB0AB0, 
-0xDCBA05D1D24FD230, 0x2472897A7, 0x586662FF53BACE, 0x30F2646AFA8420CD, 
-0x8AD15D2F02793738, 0x9EF32EC2062D6F66, 0x297C3FFE4B440551, 0x73B5EE0CD0311845, 
-0x315F8D14B9D22EE6, 0x14C5658FE9A8ED3A, 0xCBBEA460221393AA, 0xDE3706F3, 
-0x52A66B669E282192, 0x4668E4EACFEC370B, 0x46F7463C7D052FF4, 0xB028DCECD92B3195, 
-0x5062D0EC1360F3F8, 0x682983C821E2350C, 0xE75716428A79B34D, 0xC5988A49ADA57756, 
-0x17EC26DBCDFC535A, 0x1F2D3CF58, 
-0x43B6E78847E2BDF4, 0x445933F36ECCB1D3, 0xBA888C5BDB9F3C86, 0x11C16C8A2CAB5951, 
-0x10F3B767CA89CAAD, 0x3ED79895DC63779C, 0xBF5C51EB1BC3A78, 0x371997C68398E6B7, 
-0x568DDBC3BF714B93, 0x1AEF56A34, 0xC7FABA1F486AC68B, 0xB05B18E82C317642, 
-0xEE405FB81BA29951, 0x8019EEA216B5DDC0, 0xE1EB77DC1FAED455, 0x4A0D2D941BC1A348, 
-0xE54A21190E5A069D, 0x84A91F134205D5DB, 0x9C00B2F853140B67, 0xC3515640, 
-0x8B8A7D10525C1B24, 0x46B587ABCB1C1B79, 0xA71C95D68070903F, 0x5354C881E5EF7105, 
-0x546231EBF6C06340, 0x4F317DA7FE877D08, 0xB42A2001DE4C1F36, 0xAB44E3F3654F5458, 
-0xEBAC6C61BDD50153, 0x12F7AD072, 
-0x7B1EE7E9E7DCC20, 0x3CF5C356C5EC9AD6, 0xC97C7B5A096BCCF9, 0x2075928CF70F6BE8, 
-0x21BFBCFA174D978C, 0xCBF2890CACD07331, 0xB461A347ABE171F3, 0x299AE34E75541796, 
-0x6D3BEA306B2D8F5D, 0x1B061C9ED, 0xA6DD9ADD70B920A3, 0x9C3C0EB9C8E4DEB2, 
-0x7CE28FD2257AE0C7, 0xE8DEDFD737CB2459, 0x937D0180B970E4B3, 0xBAF4DC333F43B8D9, 
-0x3E3FEAD26C29AD3B, 0x8610062780438D31, 0x6B88631FA95DCA7E, 0xABD00816, 
-0x96142C29557917EE, 0x3A67F707EE8D6B0C, 0xC287069CE1BDE0E4, 0xA387ABE745780641, 
-0x3211E162955ECFC7, 0x7F6765B3C30B14DA, 0xC5EAFCBFDBED667D, 0x23F7641BD3FE9FB5, 
-0x8CE94C04BD2D1A18, 0x10AF5FE75, 
-0x745600F6E5D852CE, 0x5D49948C24709B30, 0xC5BD78134B4F90DD, 0xB4947914886EC769, 
-0xA0EDC9892BF4A862, 0x343AD14AA76AEF8D, 0x8AB6E63EB7E72551, 0xF31D428AD6DCAAE7, 
-0xD759F16C57B88A3A, 0xE2352337, 0x81E1415547E94D2E, 0xEF6A808B3BF12645, 
-0x1FCF50D0B5C1970, 0xE466EF1091AD1EF1, 0x44BE3D312E104F4A, 0x1691E1C85E18967B, 
-0x53A9D744E58BA29, 0x705C3EAD656476FB, 0x6277615AF73BC21A, 0x188BD0BF8, 
-0x269656F54329E0BC, 0x311692FE11597F45, 0x4E9B05DA5A9B9939, 0x6D96DEF7B73E879D, 
-0x639AA90BB22FA4B2, 0x6F8409C3C3DE09FC, 0x3C3C150EB5718447, 0x601BD807E8EEBA57, 
-0xB97AB8E024B9CF36, 0x170C47E13, 
-0x69F0E0D7586024A7, 0x2C2D570E32C07EA2, 0xE202BE8DB9D05A76, 0x5C169ECA6E58262D, 
-0x2B87481D672FE3BD, 0x769A2B340B83217D, 0x7014FBF7AE4CAC57, 0x88234338CCFF377F, 
-0x73D72E9AF5E44C6B, 0x1AAE23E2, 0xD3050BED48CF2BBC, 0xEB5A0B8B3D079DEF, 
-0xE93E02DADEE441BF, 0x6872CDE89D72EA0B, 0xD6E80305F772DDC, 0x97C9EB4FD013D6DF, 
-0xF42CBDD31E89E520, 0x54F71BAF3A2C136F, 0xE9FEC3D563620CE3, 0x26A3DB70C, 
-0xD23DBE32B2C0AC63, 0x653E81119FE79F27, 0x956C7F9DC9B49E76, 0x557C7778BD25473F, 
-0x485F729405172919, 0x3284224A2CA51107, 0x9E7A133DD991E56E, 0x7FF57BBCC7E99B63, 
-0x78F0693381852C6E, 0x10BCF1C62, 
-0xB1F918C6980C9E17, 0x5D6B5D49AEFB2458, 0x41274BFE5CB2C5EE, 0x9BF5213F6152367E, 
-0xE91D42F010C76CBF, 0x836EDA14994E6FFE, 0x71A16B314EF9D450, 0xBB56716F17C6A2B1, 
-0xF4E0DC5E7E46F9E3, 0xC45A06CC, 0xA1FFE38B78EE11D1, 0xDDB60DF75C0BA660, 
-0xD799A2B2C4B5F7D2, 0xA324151C1FBD38B9, 0x5CAC50961EEA6245, 0x3994548585A83840, 
-0x904660F1C84127D2, 0x3D7F6D3BBD6DD055, 0x58F2C451A77B307B, 0x1470C3B5B, 
-0x512838C07EEA7978, 0x4CFD709B20D7A424, 0xF516C5BD7F6F971B, 0x4CC37CEF79EBE0E5, 
-0x5749674EFAD3C5D9, 0xF3500B95A771E2B2, 0x55D75EE8DA1A5EC0, 0x68FAA3A9D958AA55, 
-0x730BDDF88417D4E0, 0x1303A3C80, 
-0x257881B1EC19FA1D, 0x5E1CCB9E44ACBB1C, 0xCEF29FED45C6EB26, 0x8E8EDFD9E46CAF56, 
-0x188F77211F520E28, 0x7818EA44E62B5B55, 0x95F1DE8FF80E370A, 0x54607F3DB6D7F565, 
-0xA1B876C796FEF979, 0x1BCC60726, 0x21AC8FD31E882581, 0x5F39CE6F2828F083, 
-0xBD817B7A2D5E856, 0x38C0604F0EF85F0, 0x1864E7E840DD5253, 0xC23CE580370A17CE, 
-0xF72D8DEB04F94F41, 0xAB60795AEE15E40, 0xF0B57234FC009168, 0x25E45959, 
-0x288706F4EC67229F, 0xC263CC8C97E54316, 0x330A953E252E67D5, 0x9DDA5F002E1A91E9, 
-0x8E4E6FEB02AE1FBF, 0xB3BD9223E152D2FB, 0x441D22C35418DA9, 0x402A8F2800EDA8EB, 
-0xDA02414ABEC445EC, 0xD7A3B238, 
-0x6B24650E6EB8486D, 0xC56E88A7DD742A6, 0x5ABC0ED82977F0BD, 0x7249F164DB16976C, 
-0x79E5832E99CF6B25, 0x9115B1D40E5AC53, 0x5B76086064F15A88, 0xD1F5A2B61543F955, 
-0x213B834674D79593, 0x27AF18D58, 0x716207E918138D9, 0xD039B194DFD0C6C3, 
-0xA6BD1489AF130B9C, 0x70EC0D2F62A8BA9A, 0x8F393790FFC3C07E, 0x487F08148AFDCEA7, 
-0xC432A3B3CD1ACF47, 0xF0D553796AF63D90, 0x8F68F417C095BD71, 0x20CC22ED4, 
-0x1070B1C8479341C5, 0x48563D27595421B8, 0x25E9C03267332325, 0x46FC05D1DCEB0E9D, 
-0x32A04070031A56E7, 0x32DEAEF4B30223B4, 0xCFA96BB4F3560026, 0x79CF3D0AF4F9E033, 
-0xBE232301904CEB35, 0x21C3AB054, 
-0xBB0F02F00401B8E0, 0x65D306D6882A711E, 0x5E637104585C0175, 0x989F9332F7E276DB, 
-0x77D00AF671D9B2AB, 0x23E2143941C14C95, 0x46019E84708E1A77, 0xE8B90E79EA21C757, 
-0x69F844A3A2F124DA, 0x1178E9366, 0x78AD964ADD4CCB0B, 0x7A501A5F64C52FEC, 
-0x84D88E49A68F4BC3, 0xFC6FBC3D07224695, 0x8F2171B4BC9A284E, 0x1A41257B79D074E8, 
-0x126703B5C74B23A9, 0xB61192D2A8C45191, 0xA090542A417F1D1E, 0x17E46ADD4, 
-0xC057A1FA94C76240, 0x219E64F335724259, 0xB6D9C2EE8135267F, 0xD2D6C61931111F90, 
-0x4CCC7DEE6120B40B, 0x523C6648306406AB, 0x9B70BFAD695F66A0, 0x50C7836C74B77AD7, 
-0xDFD7222E2696597A, 0x167343944, 
-0x148170A0825E932D, 0xB11812B638FFEF91, 0xE4344AC212CD5A75, 0x7653EDA9C1876889, 
-0x90645CAC59A44EE1, 0x49B9BEF51C19D1CF, 0xD61324D2C3FEC121, 0xB7F1EB844A77ADC6, 
-0x691EDA9479A83122, 0x51217CF0, 0xE3FBC84BD746BCB0, 0xA5B496BE922AA18D, 
-0xFA792778C7E23309, 0x472B48D0C6D6694A, 0x3D21D73D3019F5FA, 0x171275F00D32C756, 
-0xAC9EAE429430B3FC, 0xD12E6E0E27B13738, 0x9BA6723984FC78A7, 0x919454ED, 
-0xB946982D264A6778, 0xDF907F66284D6E23, 0xAC604EE17E6E6D17, 0x208877618F1802F7, 
-0xD848B1B58F69DBFC, 0xD15A173608ACE0DA, 0x92B6B0AF9F6DE19, 0xF4445039E1A5E1BB, 
-0xE18897D77C732533, 0x1D0E135F6, 
-0xB5F83DB68A580E90, 0x314980253A769232, 0x449D1ED5F4B8B5C, 0xD2A19F9432F339CC, 
-0x2A47E40D5970D6C, 0x5CA62C423CE24EEC, 0xAC17CC6AD42BBD43, 0xFEE2190285F4BFD5, 
-0xA4AB7EFA38D05456, 0x15A06DACD, 0xB72D3C162F2B5EC7, 0xDCCAD6AC4DA7C22C, 
-0x714F895540BF540F, 0xE6681C8862827EC2, 0x7C2385323550C49E, 0x2204FE587DD635BF, 
-0xE1A6C6A8DB257897, 0xF2AB379FA3CB4E7B, 0x8745350AC8E81E2D, 0x1722DA9BE, 
-0xFA62F300BF65EA7B, 0x210876FE36C4DF8C, 0xC1E380AE847F769E, 0xCE5171073ED0AF83, 
-0x9D7F0690506AA6EA, 0x79DB0BBFB7DDED4, 0x800AF71AE9B90545, 0x4D8B4B5F182BDC5F, 
-0x17B7ADB02EF5F3DC, 0x395BD61A, 
-0x742B4F9D6BAD1169, 0x1786B3BA0B4273F3, 0x13F94CC6D8A568A4, 0xA02668A58C9B7D5A, 
-0x19A9E6564677FB24, 0x993411A3D956B5FE, 0x635AE25CCA82C6AC, 0x94F95E65D6EB3285, 
-0xBB81492BAA0C162B, 0x1852A79F8, 0x17FB0CD68E5E4B25, 0x6C1E1EB75D84A36D, 
-0x589B2DDC6462F15C, 0xCDFBB4FBFAC10D8D, 0x718AD2A02930266A, 0x6B3DA414C1A979C9, 
-0x589D2E04450628B3, 0x3613301DFAB2B1B0, 0x5336CAAB257D50C6, 0xBD5A91D5, 
-0x67D765AD1AB61E58, 0x585551AAE2141443, 0xB522F6DA80DD1B9, 0xE67A4BEBA229C3D8, 
-0xCFB3809BE56CBFA9, 0x17678B12D2DBC6A4, 0x2BA355C3BEDD9683, 0x4B062AC95C1195D8, 
-0x812BB8861F138A8D, 0x9FDFFDFB, 
-0x7BD79D447C189C91, 0x9AA8D6FC651A684E, 0x9BF4CB276417AED4, 0xA480C420ADE0C1B1, 
-0xD433D4B2AD1869C2, 0xA3F71EE34A1B0DC1, 0xBD23E280C78D9134, 0x55950DE3935E4D00, 
-0x26E55E898E3724AA, 0xDBC5CEA, 0xB84B2573212BAA5C, 0x67D7824566A63B1A, 
-0x389947CC212593C8, 0x87A5F033544E188D, 0xC67E423E9598230F, 0x458894561E5E37BE, 
-0x3CA92CA94877C6B2, 0xAEB49FB3FA789824, 0xF18BA860E8111BAA, 0xD47A0E27, 
-0x471B6F40C61D9B72, 0x1A5A9D460A819023, 0x49A1F336059511E3, 0xF4E432E383DF7345, 
-0xA164B925A6F1670C, 0xE8B0F1F94D9B686D, 0xDAAC373B0F81975D, 0x645ACE7EF4BBEE6B, 
-0x4F23A4C8E90A4A71, 0x729D7A3F, 
-0x1AE1C4D20AFA7EFD, 0x140B956AD703B3F4, 0xA33EDD7EA026BB90, 0xD20B65D62D7B8520, 
-0x5E987BE4BBC2BF98, 0x1A67A3E951DAEAAC, 0xA73AB02CD7EC4200, 0xFCF3070C4517DE20, 
-0x36DCFAF231EAE4B4, 0x1F2BA551D, 0xC14E51F37952C124, 0xF82E24FA99D933F8, 
-0x54BD16DC29520FA, 0xB9A840B00839E64, 0x88D628C3DEF9D3E1, 0x7675AB3E2BF9279C, 
-0x4B8CBE1B00F9DE9, 0xAF9390ABDC16C232, 0x86C3D1DD5FE0F65, 0x35F9BFE9, 
-0x51860E11179138AD, 0xBAB073EAF2F839B7, 0x9E22E144AE6BCD5B, 0x7DA19D9BFDF4CC71, 
-0x5B03BAF28F7730AD, 0xEF7CC9157D95AEDE, 0xEF863C0DFA37DC0, 0x5F9F03C141B1E2BB, 
-0xE21710776FDEFD4B, 0x2449F342, 
-0x3D9E1F5A3244E742, 0xA0A8F76A2D1C38F3, 0xE7440B4D4F888BD2, 0x439A8764CC8955A4, 
-0x8F9C9FA23862BF70, 0xB85A58EB52BBB781, 0xDC1BCF4EB20B191C, 0x8B1959A50EE4281, 
-0x8AC8D83C5F9B9E3D, 0x227DF9F47, 0x4D6906B671C5B0EF, 0xE710ABC3CB36E1A, 
-0x60C2F4AC58BB56B7, 0xD5C12C994CB0AF27, 0x5CBE2D0DB5AF4E92, 0x9CC1E1EEDBAF1E2F, 
-0x18994AA4197B5CB4, 0x7650DFA017E70C7B, 0xE5F11BA1FA9FCA3B, 0x224310A6B, 
-0x50B358B27C7CAE73, 0x2AA8E3CDAD7B09A5, 0x497591A46FF9882F, 0x6DC79A59F9D05D10, 
-0x99A04340E724D8FA, 0x8F9B328F40DA9E62, 0xA554FCAC85F54AA4, 0xEBC2F1E428165EB7, 
-0x7B00AAE3B658AE5F, 0xDB5677EC, 
-0xB78C6440C5E3EEC6, 0xDCDA187EF1E34C85, 0xD6FDACC686345A55, 0xD8F153F0C181399D, 
-0x9D49C42D0918CFE6, 0x8E312B4DA9341878, 0x97ABA0DB022264F4, 0x5EDF7F7ED5908C36, 
-0x2697E4D4BF8B2CF4, 0x2740B2255, 0x1112CCF10F9AAC6E, 0x806BDE764143EF27, 
-0xA79F2D1276B641EB, 0xEFA5ED7C5529F75D, 0x9C4F87784388A52D, 0xFF3B140A1F307255, 
-0x697F943C57FAA194, 0xF79148412FD675C9, 0x8D6D44529D5354E9, 0x1F9CC77FB, 
-0xDE759FEFB49C086, 0x3C73A28C867C2648, 0xD7BE5B8924F51B6A, 0x2E6A99AB53772ECE, 
-0x8EBE0603DB724A17, 0x7DBDF03832546F48, 0xA7D612209AAEAF8A, 0x29E824F677934B9B, 
-0x3542E226B0145408, 0x908B6DDD, 
-0x5585071F3A9A03EE, 0xEEF125806A3E8B7D, 0x6896967586D57BFC, 0xFCCC3E1F26E95520, 
-0x18A5171E46F7AA6D, 0xB38CD2DC6DFD7377, 0x24766181A2754381, 0x6264B5FBFA4453FA, 
-0xBAA288D78F6FD5EA, 0x17E49B0F8, 0x55E602A3A8878CBE, 0xC3D869EAF498C26A, 
-0xAF34A98513F29BF0, 0x511B2E77C1D922C7, 0x8306D73CBBF36C34, 0x987D465F7A9672D6, 
-0x34BF91B07152EE5E, 0x8E62703907FE6D77, 0x25630C6480B7348B, 0x26339A4D9, 
-0xB696688FE4D19AFB, 0x36F8F02FAD3DF062, 0xD047AF3B72EAF4BB, 0xCE61268F9CEEEB74, 
-0xE6E809DECF601F44, 0xC9E9972099114FBD, 0xC4A39E31CFF77FD9, 0x8A86C3FB8C0127F5, 
-0xEC04580431411C20, 0x39BE154F, 
-0xF655C2E23A72EA8C, 0xC26DC386CF1641D0, 0xB092B12E301EC7CD, 0x205A3FD80C9E74B5, 
-0x6942950AB2E36229, 0x9C7124EED03A60CA, 0x5C815564D64FAA97, 0x7ADACDCB6FDC86C, 
-0x5ABBDCB9D9BC98F6, 0x12FED6EDB, 0x8B5D9E0FD7015193, 0x89BE16B688BBCE07, 
-0x849A1B14FD1F0C74, 0x8D067619F8317974, 0x84A6811DD67CDACB, 0xC5C96CBC22387ED0, 
-0x579233BAE836AE0C, 0xDE73931FD3AA373E, 0x9F4604518C160FC0, 0x50330D64, 
-0xD3EF1DC3B7094CB1, 0x28681982648F8390, 0x4E42BC7D8134E44A, 0xA1A3FD01F9BFC721, 
-0x21BE719F374B28FF, 0x1838D35F7E61A391, 0x6AEF78D5C379080E, 0x6D875B6E5B0AA2F1, 
-0x3CF85CAC6F3400DF, 0x18413C27F, 
-0xB2C277AEE3EA8B6F, 0x2EF02131B4D9A5CC, 0x9E3F78C229BC609E, 0x157DCE66B8F0E5AF, 
-0xF06BFB5CB2819BBF, 0x8D021809D1E59CF5, 0x913F85FBF11267C8, 0x8546B25DBF0DE6EB, 
-0x8EC3F9573A5FB990, 0x19E988CB5, 0xBC0F93E7A01839A6, 0xE1CCBCE7A0D1A095, 
-0xA78F5D51A88C3E34, 0xB8182ABEAABC182C, 0x8B1465DC58A1146C, 0x27DB7C66064558ED, 
-0x2A7C9445E4F32313, 0xB314CB8D2AF8CE73, 0x3ABD3C04F3D15BAB, 0xB3D4CB4B, 
-0xAEC586AD2DB82739, 0x87173C2519814096, 0x50589CC0BCE996CB, 0xDB4D08A2716F0FED, 
-0x41F48303C36D5F14, 0x4243FB9A87451680, 0xFEA4AC8074F92A56, 0xD8DAEE21801D8BD5, 
-0x612A638B71645389, 0x1FA2E20EE, 
-0xDB9F05ED0E7DC885, 0xB8BFC2F81EE5B6A7, 0x39844A8DCFAA3E91, 0xD9AB049850CD6DAC, 
-0x64231A0C7544F729, 0xB3C4DC8B733AF9A5, 0xE6D25D2F232047A7, 0x1397A18383DA1336, 
-0x10C1EB5C459B0023, 0x193D7DEE, 0xB1726716BB25B69B, 0x22006FEB3E74504A, 
-0x9C59E19748AD0635, 0x52F83D0119E7D9A8, 0x2F066E4377979B, 0x30A2E5D68E9B0FC8, 
-0xCB7E581A64C48933, 0x54BA65EC076FA8BF, 0xD23442873BFF66CA, 0x1BB4FEE08, 
-0xF97D0D6C513B6BE1, 0xD05E27799E481B30, 0x61765AD7D0D748B1, 0xB1FED3E68F1468FD, 
-0x28C6292DD1559D70, 0x7B4370FF66013490, 0x68761A0A4863FE22, 0xB7C030714449FA78, 
-0x2B7D35C89D35AE12, 0x18D8C4A3B, 
-0xA89D5809CA318AD0, 0xD86DB68AE1035E5C, 0xCF707C51EF005205, 0x7F8900FB7A842C12, 
-0x6C4F81A58BA51279, 0x4C39AA89239A441C, 0x8019E85E157319E7, 0x8D007CF31DD795B4, 
-0xF136FC65F83FF4D3, 0x112A20050, 0xB616773ADD23D8AD, 0xC52BC6601A0E1944, 
-0x88BE34804EC1DEA3, 0x7F6011A0D4AA3F88, 0xD9CAF3F43AE4BA05, 0x4554491575D3A7CF, 
-0xA0584A088C02F819, 0x651077CEE57C072D, 0x1B5D799482FDC50D, 0x17C914538, 
-0xB8ADC5DFCA4E735F, 0xFEB0970983EBF88D, 0xC6A27DADFA596DBF, 0x5F82A0A1CE753494, 
-0xD7884A9BD7293F35, 0x537E512F6B7AB88F, 0x95AA38E055A770A1, 0x1225CC31006B791D, 
-0x1CB4FB4C3B5D0222, 0xA024A51E, 
-0xAB5B9B3D7856C519, 0x1E59267611DD46D2, 0xC39C7C7566422EB3, 0x8005F5060A59C1FA, 
-0x9840AD9751CAB080, 0x3D485EB8FCD885DC, 0x955FBC12E6196257, 0xB446F46645434D00, 
-0x15B716342A3EBA07, 0x1742F072B, 0x17788D5FB14D092F, 0x53FBDA5D9E5AF4E0, 
-0xAAE45DEE84DDC466, 0x69D3151BA1651B22, 0x44E7D6452DBB2600, 0x5FE86D58C8FED5E6, 
-0xA6470E5F6035C95B, 0x1BE5BAC4004B2271, 0xE8098A55855A5DFC, 0x2196C10AF, 
-0xDB831285255E66F1, 0xB240D3B5DB8A77A1, 0x625BB1162D29893B, 0xC8A014A8B93B1153, 
-0x130AF484EEA977DE, 0xD5680F1F532A5B50, 0xC7AA22EC6DED84A6, 0x1EA7A46E8BF3CE5E, 
-0xF0FC92E1A8CB3FDF, 0x90393547, 
-0x4109EE27EF1118E4, 0x8763AAF4FC062292, 0xA837BA60F0D45DB8, 0x98FCAC5630F66AAC, 
-0xA54970A98CABEC5E, 0xBA2EEFD02840D812, 0x81133B835B81CDE8, 0x707BE804A51012EE, 
-0x6BC1C332FB15F9B8, 0x2624CBFA9, 0x55F76DCE96FB5B7B, 0x3C212472D700DE72, 
-0x7300F9E8873989DA, 0x7C65882EE85E8712, 0x463085EF56BC1786, 0x469D4C029C14C936, 
-0x87534E6EE3F33BA1, 0x1B888C7B13B6C275, 0x80B3155ACC6AFB3B, 0x1266056A4, 
-0xAE4780F6580312E9, 0x4E5CB70BC0EFD222, 0x6D4B58A75A89F602, 0xB3EEB7DB8C7B0D7D, 
-0x2939A77FFD8215A3, 0x5B508E4F360AEAC1, 0x98C7D5CD059934B4, 0x45A432EB07AEEA4B, 
-0xC652D34767CCE6D1, 0x367A84EA, 
-0x99151F2685F4E282, 0xD34081C596E0553C, 0x9FDF2D9FC5AA5FC6, 0x5F3D12BFC1D5610C, 
-0x4DB297B6689ED4E7, 0xAD2D60A2F58C1B02, 0x3E5D1C830BA7E5DC, 0x9EE7BE99E45BA0F0, 
-0xD2D73023C49B5A5D, 0x1F0A246A2, 0x87EBC2DDA4180143, 0xAD25BAAC72735AFD, 
-0xC3B4FC27E0BE004D, 0xD12947AA3FA74DD5, 0x8B825325100E410E, 0xAE982EE66C8A702A, 
-0x5717A390D70A698D, 0xCB2B0B98D523EC23, 0x10F4E916C2187260, 0x14399B4, 
-0x17F0488E429D25BB, 0x732B4DC78E6F8289, 0x90D6A234776780A3, 0x5786E3CEBC65A5D8, 
-0x828DC94126B56D6E, 0x7B7E6BE7FB4A7C7D, 0x47E4714A790EE4F5, 0x70D998F1C4D6261A, 
-0x68F75F3EA21BEEE7, 0x17BCA3AD8, 
-0xB850A5447549603E, 0xFB215E9627229305, 0xE3EB0633683141C9, 0xF56FA3F9EA8D498E, 
-0xC7A589543D89B3F0, 0x7F4D7D2AED59AE9C, 0xAB66829E8DF59873, 0xB2828577767214EE, 
-0x3C2DF31B7582F7C2, 0x19A4F4B1B, 0xA6ECE4C272735FF, 0x6983EC627BA1BC33, 
-0x4E710DC645C0BBAC, 0x5680019C8EFB430, 0x9F3508EC793E9C97, 0x8F35F81B13FAB71B, 
-0x6213FD7079ED1AC4, 0xA0D28DB5085F335C, 0x22B235922773F21E, 0x144974A7E, 
-0xF0F32B5B7390B43, 0x99548C0BF603C22E, 0xF5464AEE2DEE5CB5, 0xBC53210B4D2C9605, 
-0xAF406F80EECE89F1, 0x484A27C082FA5C0C, 0x8FB7C7F774369CA8, 0xE48D52678EFA5364, 
-0x2C11BF71810A0DEA, 0x1E6506C88, 
-0x21FED8B2F6BF0DF, 0x1E0AA570D6D954E9, 0xF50B405FC10DCA27, 0xEC2A9C039648D322, 
-0xF63A6AD8957685DE, 0xE8D8E5425E4E9DA3, 0x3611AEC3AD74194E, 0xC4ABBFE5A802B85A, 
-0x7047A685E1C672EC, 0x21FF5089C, 0xE373973B83C9EEF2, 0x9AAF5B4C6B008D00, 
-0xEB6F3B12965F89CB, 0x641CD2176ACFF942, 0xEF12AFE829211B57, 0x8330162A88932907, 
-0xFEE98CD35259FA7B, 0xC0641DF9E951F9AE, 0xD14CD0E67E76AE52, 0x23AD38F4E, 
-0xB6C7CCBD3D478A32, 0xDB54DF48FD9B5C5B, 0xFC00B7CC79AFF5FD, 0x9F371FBFBCF4E771, 
-0x5F21F666123395D6, 0x5A5B3653F3B36F4C, 0xBA1955AE7616C87E, 0x7C7E1906BC45DBA2, 
-0xC396A12B67DA7381, 0xF27C52DF, 
-0x670C28859B238185, 0xFC53EA62B90C0FEF, 0xF997EBDB8DBB82DD, 0x2D8F9DF19D7E822F, 
-0x4CA0C0E981E7B9C1, 0x7752E308099A3C68, 0xD727DC950B6D254E, 0x77D177CA4540AC92, 
-0xFF5B45286807988D, 0x9581AF81, 0xAFF6A79799B4760E, 0x30E16BC07C7D9009, 
-0x55A276AB588ADE4C, 0xD3DB991FC802B6A2, 0x1E0D83D723F6ACA4, 0x6200F446803226CE, 
-0x984DBF2B5D05771C, 0x8D260FAF4744F91, 0x457F4A423EEC0A42, 0x15DC506D5, 
-0x87741F2B324B8D1F, 0x1CEA26EC42DED407, 0x5E9A99F109D81E67, 0xCF9454982665CFA4, 
-0xB09843AEBD078853, 0x71F4030ABB6D2CBD, 0xD695A4C211591181, 0x2C75BF7F11733D14, 
-0x393C6DAF63215D5A, 0x1CCE256FD, 
-0x1F77B2F895A4CB3C, 0x6BE11A9394116CED, 0x1843A1828C86EAD8, 0xD87DC93CB6209E9A, 
-0x7B7A1B7C26D860FD, 0xDCAE39480B866DDF, 0xFF920FED6D25A38F, 0xB1770DF5BC9EEAA1, 
-0x372F9CF9E2FFE12F, 0xDB8180A4, 0x5E90E12AC5C718AB, 0x1C2F34478380C873, 
-0x1858EC614159B297, 0x63611E495BD2740C, 0xAE2C511B16EF2B90, 0xA6B2D1BE2E3FA769, 
-0xC696D88E55B1A6A4, 0x575EE7ABD78266A5, 0x8017CCD072556D9A, 0x258EFCDD6, 
-0x28EC66CD451106BC, 0xC85B323A7A647CBB, 0xFD43E424160F21D8, 0xE3B4D9D093F515A4, 
-0xCBF2E462C421F204, 0x62D70BBE7C8FA206, 0x5331DA5A14B4D51B, 0x3D38BACBB532D3B2, 
-0xD0433C66CECE6E89, 0x2518E8B4B, 
-0x264D44BA3055B82F, 0xE39618558E4F1AE2, 0xC1908ADA72AD52FD, 0xEFACB76CF8AA87B0, 
-0x3D9F95CFEAB049AC, 0xBADE3EBF8C38B24B, 0x4042845856352CC0, 0x7EE6C35A9711029, 
-0x75A40DDF3BA89359, 0x106C415E9, 0x71CAB998CFE56780, 0x18024000C0806163, 
-0x977CE6D5F692E523, 0x23D03D3462062177, 0xA9CB214AA9222361, 0xA006FFB0238BBCEB, 
-0x4940BAD990926716, 0xAB0799316958502, 0xC4C24E7E2B99C7E3, 0x1CC4AA387, 
-0x8B665B9EFAF4CE7A, 0x5E5F55826CC0C02E, 0x44E388323CC4F12, 0x4080628C825AA4C5, 
-0xA2DF67DC681B9253, 0x2B39A4D145230F40, 0x9029AA3507DF34F5, 0x9C1FE1100750F8B6, 
-0x7CB7A237E6F4C49C, 0x1DA707F8D, 
-0xE2C942E9A6A95111, 0x63B3419D05F51C1E, 0x2FA569D73E2D3DE6, 0x7107406BC2715FD5, 
-0x1F58B55A9B2920D8, 0xE5C4F7FD4BB972AA, 0xEAA6322E5CA65C4E, 0x150FF31055D784F8, 
-0x79727B9A333112DE, 0x9F91209D, 0x847CEF44BA6B2383, 0xA470CBBD7F95DC9B, 
-0xE8CA92BC72E1E5D5, 0x5C729E49EF0768DC, 0x49E628654779CD60, 0x65569C2C570A8CBA, 
-0xAF2459C95C894CFE, 0xA96AC4D6343E3723, 0xE6D36DB9005B16EC, 0x25BE5048E, 
-0x18D79E84558AA723, 0xFB0A6A6DFBE2D146, 0x240C9A12C224C771, 0x6B0BE2C20E1BB6DE, 
-0x55E5D3119B17DEBC, 0x3742394D24C61659, 0xADAFB41C9CB49C20, 0xEDFFCFB0DB595AFF, 
-0x9B7AAC31628FE13B, 0x43CA8E81, 
-0x4532D359AFA4BBD9, 0xB1E2588F45CF2DDD, 0x17AFA553F15F651A, 0x80694DDC3C15DDD2, 
-0xF9EF4D072C3E1480, 0xD12DECF5974BCDA4, 0xE4CC7D1F13AA9D04, 0x66CB5B883A543D8, 
-0x604FE08168B9B727, 0x1C462D98A, 0x189089F20E8165FD, 0xB6D3327309201889, 
-0x603CD9136B6F2AB6, 0xD527968AF059186A, 0x378366AC7845A329, 0xAB979F4A5818FFE8, 
-0xDBE60499B54A0484, 0x9664B1EA715FBDBE, 0x31B168817B6ED5D0, 0x4AA82BD5, 
-0xE74A4D9DB911BB4B, 0x8D0AAD4E505192D3, 0xC1B1982426A372BC, 0x5B7DCA51A630BC9E, 
-0x77F3B4B8E26DFA15, 0x249F3735F227622C, 0xB6634EC70EF6FC8F, 0xC97C34CD07F13DF8, 
-0x5C6FB1513BA7F7A7, 0x1F40B34A, 
-0x850C1FF0DB1FACB4, 0xCDEAB62263023401, 0x888805708FDC0F4B, 0x5E3DC860B33636FE, 
-0x8A15016C14C19A26, 0xD9ECA421E8ACA694, 0x9B561233F946EDAE, 0xFEB5FEC7A9C23AC7, 
-0xA6460B1321159F85, 0x11B7E017, 0x6F37016398E6C5B1, 0x987E817E8FEFC5C0, 
-0x62B55694AC40B3EF, 0x715B53560A71F42D, 0x3E5C6D2BD62A90C8, 0x302156FF34AD8C22, 
-0x3B08FC83102B5595, 0xFE2D1EA90B0AE648, 0x6A85D7B46BAFCC69, 0x1CCCA7C5F, 
-0x54878D156BD59061, 0xC339AADC7E3059D2, 0xACAC5EC880394F87, 0x632029B6F33C8643, 
-0xEA974D3F0099EB00, 0x86E64A85C7143CB5, 0x63AC026349601695, 0x2C9EB0811D69D3F4, 
-0x1FF57FCCDE200D2, 0x396C79C9, 
-0x38F3341C73CB3645, 0xEBB0EFFC42F702F2, 0x15D1F16EEA8775FA, 0xE4BDE30F1ECF1B6D, 
-0xA49FD87F08C116FD, 0xAE2CFB71F1195AA2, 0x33E4488B0BC219E1, 0xC508EA55003C57FA, 
-0xC8E8EE3314F600FB, 0x207D434D, 0x7F8E80157305389, 0xC1145AAE9E0F02AF, 
-0x9DC62B5D9EB94F7E, 0xA5CB206B92CB5910, 0xFD14E9E5BC35D24A, 0xF4D447BC8536F2E5, 
-0xCA459B39BAD7AB2B, 0x71B78AC27C201A17, 0x101B6DC5D33AF5B8, 0x198C04848, 
-0x38FDB129E961568A, 0x91347D81C8B555, 0x7276206B82E24AA1, 0xA335E24EDB37DF66, 
-0xAE1C32385968E9DC, 0x942FF74550B5C5CE, 0x5421B9BBDCCEFA1F, 0x8ED81E5725FA350C, 
-0x9B16CD4C40AD030D, 0xBB940E0A, 
-0x85984B6505EF0924, 0x5269CDA80049C4DD, 0xA07435B0CE6F02E5, 0xD84ADB43C01EFCDC, 
-0x8C983C4934E241B5, 0xA3C4F68CDBD20C86, 0x8A9AD9420E6044EF, 0x9E23E8C8B322BAB, 
-0x5F5DB7E4B5A10D84, 0x17F3C9FEC, 0xBB5B99E9AD511281, 0x6BE339763DA8D453, 
-0xD9D573052564DFFC, 0x4C9018E45A539B64, 0x4AD1573A9E558438, 0xDB95BB8A3627EC58, 
-0x5F3E134A47EA18AB, 0x8388C1D7D33F348F, 0x268DA2F679516EA8, 0x166F94804, 
-0x30CCD04A3500E6CE, 0x6AB6E5A7D6C96300, 0x17859630008A9D3C, 0x246F76FC100F388B, 
-0x4773DA6EF0C185D8, 0x263AF4B8278B43C4, 0x4757FD0C693D09C7, 0x3C6884CFD0747F2C, 
-0xA34636B8D7CE8970, 0x261FF4BC, 
-0xE8DD25E6C3AA9689, 0xC4155CD8E0766BBA, 0xCE392C3E563BE329, 0x5D26F482F95F5CB0, 
-0x8474B8E66A7E5792, 0xE249F5DBAB019092, 0x9BF94A356A0DBE34, 0x4207B3FBEE8A059B, 
-0x63629617AF5F3620, 0x121ED1500, 0x6F7FB1AFF6F3A595, 0xF02ECE677B405F, 
-0xB85CB5C6776C0B1D, 0x6420ADCD1B865EDF, 0x3BFBFF72E448B757, 0x6DBCFC9F0F54F629, 
-0x8E752647D601B8BB, 0x41BC6D37A3EB0529, 0xBFB3E7545D49B714, 0xC6D6FDCB, 
-0x7EB5CA86C0B8C53C, 0x7AD4363C7C068D59, 0x5098E6A5A6C2FEEC, 0x2A9957EA02E73CD2, 
-0x41C99E13A2211575, 0x3EB2CCFB8AC55C95, 0x5AD6DFC4DB18874, 0x8BB2C2492A4708BC, 
-0x8BAA4F25D5376144, 0x2705F7E81, 
-0x7624D635206C26B9, 0xB261D9454E1BB395, 0xC8C98F2B4B89A1B3, 0xA717703CCE306B31, 
-0x88138748216BE6A5, 0xCD0DD54F823B0D55, 0xB56BFBAF22863403, 0xE9DAAE89AA219DAD, 
-0xC451AFF5158E313E, 0x1019FFECD, 0x7848742881C6B734, 0x72B90A6670FC88B2, 
-0xCDB2B4192F03D94B, 0x951589C2DD05E17, 0x57D99A525CE82566, 0x542714354E24C5BF, 
-0x44053FFE2776C146, 0x94D16AE3FE767D81, 0x6FEC8BC494CE0241, 0x13C6E8696, 
-0xCD318B84293261A3, 0x7982E165010A1786, 0xE2B6804FEF5E40D0, 0x7047CB3A07BDF87, 
-0x80FDA2E07451AEC7, 0x4797F22FD4947677, 0x9FC80476DD9CDB13, 0x9929CA7838F18A11, 
-0x1728E259A27CC505, 0x1B158E83, 
-0xDAB6925D4FC44BB5, 0xCBE2CB7E67882E17, 0x37C9BFA7915BF35A, 0x106721C2F6FDCFCB, 
-0x2738A863588EC239, 0x5A0151B27C9C8D6E, 0x751705604A1EB8B7, 0x857AA8F70C167900, 
-0xD74B517DC0A92280, 0x10D6852B6, 0x7FFD7D08718BC84F, 0x3F9FD8AE8C5B766E, 
-0x41FF9983C9C4B624, 0x5A5CF5B76F6A3751, 0x39FC60FE5069FA4E, 0xC0FC820B62AE98F3, 
-0x859A8D82BFD47CE, 0x787E96168F196CA8, 0x1CBE89BBC873BD2B, 0x24C90A38D, 
-0x3B8E6FD248587472, 0xBDB0E9088FD28439, 0xFE1582641D8A2A26, 0x47EEBE6A81FCDB8C, 
-0xD84C4B48DEE55E07, 0xD070A703A318C52C, 0x11BCBE6B853EB6C2, 0x1303C753DA6F2A33, 
-0x3E8FAD6F8D336BB6, 0x1E6191602, 
-0x6BD421FF5300F8D2, 0xEA1D2416A3C5E242, 0x82C7DAEC18B1D8AD, 0x404E105D47B61993, 
-0xA2613775556EA2A9, 0xBBC920EA3DA770BC, 0x664C4AE5EBF30DDF, 0x292DE0F9FA6D03F3, 
-0x70ED890748B0CCD, 0x7742217C, 0xC03D0DCB3585AB1F, 0xE0A61E26431AF59A, 
-0xFF816E0077F748C, 0x281AE2BF0007D3DE, 0xF1511A65BDEA15A3, 0xB248E4C8F643F287, 
-0xFE761DFE1E348133, 0x71AA998DAEB0A121, 0x3D36F82A779742CF, 0x24DEB9987, 
-0xC184F92152EC1B6F, 0x6371740E3CC847B9, 0xFF2828B1244805A3, 0x3EC5B9973D8EC772, 
-0x6F3D6CB1A30FBD4C, 0x663D3830B1308F0, 0x420519F7E274B2BB, 0x5861581B54712D0C, 
-0x3E41EE40654CA078, 0xA4C07BD6, 
-0xFCE63009B0BD8579, 0x73BFAFC143785900, 0x7E6D19117B7CC54A, 0x492827DCA21F494C, 
-0x8FD0F369346BA9A6, 0x75F2DB5C07E79C26, 0x95FBA7749669E6B1, 0xB514A96DF8C8853C, 
-0x93FD216C99013635, 0x2011BF5C7, 0x52268C2D51D09005, 0xED00E141F0649852, 
-0x6ADEBB9F6763C0B1, 0xE4DEE17C75DA072F, 0x9CF73A1D782FB01F, 0xD0B57F0B138515D2, 
-0xE4DAE96146E3ECB2, 0x9DA6C4CE89DDC3EC, 0x50AABA44D025294, 0x160057826, 
-0xFCC5129E67ED711, 0x7FA647A5B3B7C0A0, 0x1D5B738197D3F0AC, 0x808836CEAD0DD942, 
-0xC665852DF33679C0, 0xB2A6A59B7D8FE9FE, 0x3369A358071F0E5A, 0x34965B61CF1A7D4F, 
-0x92C4F5629949C0A9, 0x1120F8359, 
-0x17C0882C9740EADC, 0x559249983B0F38D0, 0xC0E168D6D780F9C6, 0xC89AF5920CF04081, 
-0x149E442BE53B4781, 0x26D975F40432F0C7, 0x72C588AAB9C5818, 0xF0DAA6F24AEB2BC6, 
-0x28BCFBF01FE8AE2E, 0x16881D41E, 0xAC7C6922A79C8502, 0xA98E94E621297BF4, 
-0xFBE89C1E3782A96B, 0x92B1B794A7F9697B, 0xAD8846B23AB52AF2, 0x9939A50A28E7DB9B, 
-0x85C944B9E7766900, 0xFA7EFA430C6F3A34, 0x63DD2D8F01AD3910, 0xE5A13D11, 
-0x607F4FD8F5EC51C7, 0x1F45EB06E05053F1, 0x6F6CC33E5A41CCB2, 0x5EBEEE702FF03CA0, 
-0x13CBD00B7B87F425, 0xAF10D3EDDAAB6221, 0x69E443E16251C2C6, 0xE91AB8F974EF7648, 
-0x913516C69A52A093, 0x146AF6F0E, 
-0x31BA897CACBEC6CF, 0x11A42BFDD9A71559, 0xC57C9C7D4F0844C1, 0x3E03EDBA7406FFFC, 
-0xC0DC1165FC87493B, 0xA436A2ADDA13A502, 0x851EC87BCFBCAFD5, 0x99BDCC41DBCD2947, 
-0xBA263CD5BF498126, 0x13ACA1C0, 0x7AA1280EE91FF822, 0xFB573D3850F5A3EC, 
-0xEAE186F73C054015, 0x2450E7C2FF605CEF, 0x3A6CBF4E05FFF843, 0x4E809AD730FD616D, 
-0x7D1992E8CA2B4449, 0x83584AE6511D1752, 0x616A5F896B152ED9, 0xDE73A451, 
-0x4FBE91F8308D0C30, 0xB832D9A44A0139BF, 0x7316DA7D9D455366, 0xF077961FD076B0FF, 
-0xFEB1EBB970549E96, 0x6A7E8BB7E9043E38, 0xB0C49D5763B79ADE, 0x219A8C65A439D0A9, 
-0x552145F2FC77433E, 0xDBADEB06, 
-0xE15A65A7EC98D8A2, 0x4C1F017629BB675C, 0x94824BFC377413AE, 0x5E3ADEF8B646547A, 
-0x496B88966E2BDA45, 0x2ACB6884C0A2889E, 0xAB1B09D40B6777C7, 0xADC70511816013ED, 
-0x6177F07FA9788DB2, 0x1C3F917AE, 0x21A351C4216EDE01, 0xA33BE527D71D0FE, 
-0xF154FC42460C9643, 0xCCF63D8984B7E22E, 0xC7FBC476765807B2, 0x8E59DEA882A9F74, 
-0x10B01CE45ECE251A, 0xEAE4307833AE323C, 0x5F499512A0FEFBAF, 0x1B342DEC4, 
-0xA5320E41C5935926, 0x434473BDCBF25625, 0x3AE8D6B919927C40, 0x25B857E2F51C840B, 
-0x40BE79F17BA20A41, 0x41CA80F6AC5C2981, 0xA841891D5977AF02, 0x3E239A639A92D088, 
-0x8ED0E0C3E2FE8AA9, 0x2AB49187, 
-0x127CDAE083DAA6C5, 0x2F24790B0479D7A4, 0xEDC4F60DAF6D5CD8, 0x6F98538793C6E46B, 
-0x37260FF0C214BF58, 0xCF0DBDF6B56ECCF1, 0xC3C6871BBE9DC614, 0x6B61FAC13565F512, 
-0x95A22944DC70E2D6, 0x17BA39EB6, 0xABB4D2B0E1158F87, 0x8ECCD34F89A1DE58, 
-0x2FF24526770CB2A5, 0xA52E7C2E649764BD, 0xFA453AD79D514691, 0x2ABD1DBF68E3B2DF, 
-0xD671C2EBAA443411, 0x50AE8ABF4FB0F3B9, 0x928A425C2249C8FF, 0x142CEDE8A, 
-0xD1AE557A7BA07AB9, 0xA9B170ACE7B69AE1, 0xB3B254AA4FF6B85E, 0x173F3CF3B95CEE75, 
-0x262416D0525EDE7F, 0xB9EC2AC55AEF1F2, 0x9E3D336D159361CB, 0xE593D8DCCDB9CD70, 
-0x14CCBC8C13CE2C66, 0x95B6DB7B, 
-0x5BA8797ABD48CFD8, 0xD1AB2E9C2F280230, 0xADC76C19896B958A, 0x720C507483EFF595, 
-0x8E70A95DF0F25395, 0x96C7B685A72E1F34, 0x262A279F74D1C85D, 0xDAD9EDF0C0D6F746, 
-0xB55AF426226A17A3, 0xA812F862, 0xE95BEAA8D9BEF6D0, 0x3C3FB3B925ADC33, 
-0x240E397B6870C0CE, 0x98844C716D168AFB, 0x7EA9B1FFCA457895, 0xDAF3622A4964A1F0, 
-0x6088AFB727EB4C8F, 0x3A401736756A707C, 0x55F51D53D20607A1, 0x7DBA19E4, 
-0xD4E9EFB64E15A04C, 0x717E669867ED3D26, 0x129556186D063700, 0x15085EA0A87B6B1B, 
-0xF0E1DD4FE66FB431, 0x4F9BD4F5CA108828, 0xAAD7CD423B41443F, 0x60CB36722243CAC8, 
-0xED56D404E5A4B1B9, 0x22C3A461, 
-0x19E833307B2C069A, 0xDE1F1E0AAB2676C8, 0x41A7E4C20DAA90B6, 0x90FE4F60D12FB563, 
-0x8FA1BEB900BDD244, 0x6E25C08AB67C2844, 0x5305D475A643D8B1, 0x984C7BD255405533, 
-0xF4928D32A798E24B, 0x57B6767A, 0xFB40BB46A00D81A, 0x7429499566EF94, 
-0x68DBEECB02D4F2C0, 0xAC70C8ACC01A26DF, 0x5E758FEA7708AFD, 0xF7553F730C0DBC08, 
-0xD67230F8607AA830, 0x597CBF961887D81D, 0xB0BD085D898FA725, 0x1A75F7BE8, 
-0xFA0587089F5F7200, 0xF0A28E2D61AA43B4, 0x1CD0D2BCE2F57DF0, 0x32224659A18D6672, 
-0x5299201E7445B146, 0x6827E3D18A904D99, 0xD9302F4E6D84A997, 0x405A9D05B808B0DF, 
-0x62452A4617DCAA66, 0x26F42FD70, 
-0x203C6626CD8AB3F1, 0xD5DF2FE7D5D8A5D3, 0xB2936D45D9628674, 0x848ED11A23991F5C, 
-0x30492170C05911E3, 0x91F7A3C34ED28E8C, 0x91FEFACC039499B4, 0xDC9073CC0E3BE82E, 
-0x95FA57BE9C717756, 0x2776604A7, 0x26F24F4B2951D2C6, 0x754E1DEE8490002A, 
-0x2C360137B717E040, 0xF49F963854145620, 0x1FEA6C941792BFB5, 0x2F08DE37A6E0A6ED, 
-0xE0389D97A84B5699, 0x76216D56166FE13A, 0x79F38ED7A5266E64, 0x1C136A138, 
-0xCB762E80C4A4190E, 0xEAECBF4617290159, 0x93F7D94318B63553, 0x1FFD247F638ED7FA, 
-0x943197968D1BC5DE, 0x8C62CD6711091BCE, 0x46F1D537507FEEFB, 0x72C9E8779F64C796, 
-0xE321F80EC97B922A, 0x1CB111D40, 
-0xFE367AA4989EE1E3, 0x69BA6172D5979766, 0x5E6C4A1C29C8467E, 0x29A5C798F24024B9, 
-0x371C4C8E47665534, 0x85E7C1EB42A59583, 0xE0EE3544CB04ADE5, 0x5935A168644F3D29, 
-0xBBDEEAF8BA5CD505, 0x207EEF12B, 0x343465DBC48D1AE8, 0x5D5FFAE5C95F4B20, 
-0xE6A4D4B21F0F9131, 0x3137C3C7C3D7C90B, 0xA19A9F57714CE0EA, 0xA5960E575BCB30D6, 
-0x241F33F266DABCD9, 0x72303E9DE4D5D821, 0x3EA131D378D73D00, 0x1033FBE40, 
-0xBD3014C4EF9720B5, 0x1D3243924C7ABC97, 0x8499D5100684CFF1, 0x7F4FD9C80394EFFE, 
-0xE5A6BD533D9F883C, 0xE721005680B6A28D, 0x5ADA93D1C53DC998, 0x6980D1072B1AFEF0, 
-0x16E732266616825, 0x1F5FE87F2, 
-0x3B31923279E8365B, 0xB7683632CFEDF4C3, 0x62E4CB5E866506D3, 0x941506D8FD23A96B, 
-0x8D24625970EDE7D1, 0x906159B2AE0D64A6, 0x26E10C36CD63720E, 0xC3995C531D8F12D, 
-0xAB351EA95675FC1E, 0x16C325FE7, 0x23BD72C8F7BC9DAF, 0xD06FF70D2A0110AC, 
-0xD768451CBADB46A0, 0x3967F31D04AE571E, 0xF5B08DCFE08AF02D, 0x18850D49650DB201, 
-0xEC4BDAA25EE39184, 0x222EB744F0FFE36E, 0xCEE26AD984B9AEC0, 0x1D3274E07, 
-0x6FB7BFF70921B62E, 0xAB006ECD808C31A8, 0x7EB9143E8CE3307B, 0x7BB6F6FCA8CF0411, 
-0xC1BCFD01B7754C7D, 0x9595A5D5619A03C0, 0x72ADB676A0FEA9D, 0xECE916E42CA6EEEB, 
-0xBA091D64A9694FF2, 0x6F3E7A6B, 
-0xCC1E6AE8B0F0325B, 0x3567718FF6256A92, 0x8BB83A3D8BD3D37A, 0x9E0A9D680FBF7435, 
-0xB0DF8EC2412F312B, 0x45763AAC0D432E2D, 0x5FAB61107E4A372B, 0x549C8BCB5577762C, 
-0x73F59AD6F15640B3, 0x1F6708315, 0xBF671959D0467DB3, 0x9E38397887EF01C8, 
-0xBD4BE0C8A36E6DE, 0xC2CAB9806AEECD59, 0xC42AA58EBA394F07, 0xEE8BD45940ACFFA2, 
-0x57516EFD989B2F8A, 0x92184D07ABFC22C2, 0x1F6E2B207BB8B4C8, 0xDF8081F9, 
-0xC4DBA0C37F7958F9, 0x5B94B442A0CE026, 0xC650871829D2D859, 0x4ADD2BB1B72A0CBA, 
-0xF254ED7BCFE8ACAF, 0x9A2B7ED7282F0376, 0x3032B45D3958C03A, 0x675D5EC95F9CAA9A, 
-0x9A6BD89DCE9465DE, 0x1EC632D71, 
-0xAE391C7A372CC9EE, 0x2A8BE98C8B925D3E, 0x3C865B863899E2B2, 0x85888E7332C64477, 
-0xFC6CBC0E536925EA, 0x82EBCCE5644A52F0, 0x28E80D4702C6BF9F, 0xFD7D536761CDC495, 
-0xC7DFCF8C3E7D171D, 0x2187C3B02, 0xD04228D8D12968ED, 0x9FC564B9E7D4FC09, 
-0xB1BBE60581428906, 0x3CAE1F92E378BAB8, 0xB11C10F348461E1B, 0x149CE461CE3BF3A4, 
-0xBC1FD743EAC1A927, 0x13E879C6FBE5EB69, 0x93C62420A3FF0422, 0x2DBE93AE, 
-0xA21F844F4E4C0E68, 0x6402ECCDAEE93BD2, 0x9FC7C9AAE1CCD5FB, 0xA4F20FA12FB44ACD, 
-0xF83B7CE30CCA6163, 0x23452BE2353B7F68, 0x576EA3BBF5CAF52F, 0xF33C1319391B5FF9, 
-0x179A6A8DABE353D0, 0x24B6A5326, 
-0x2DD651FE2228A521, 0x3B21FAE62D66551D, 0xF0B1BA01E2239844, 0xF09368366D2F9569, 
-0xF8EAF9098D514607, 0xB51FD61E4DE5B7F4, 0x29109E4CE3CF80CF, 0x81FD243259143CAB, 
-0x5E8EF4C9F363D1EB, 0x2342E5564, 0xAD3E20B6C083C56C, 0x6628A1920437AD0A, 
-0x4EC1CBB363F73EEF, 0xF1A4E5F4225BDE4C, 0xD5CF4AADC64327C1, 0xCD607B28D130A080, 
-0x1F8E528EB7651263, 0x8DC6BAEA387A48E, 0x9384170CCE792CB7, 0x13DE37E84, 
-0x74000E5F6E0936C5, 0x55BCA60EEBA35664, 0x35450828DE0330EA, 0xA3F569F01F6BD7FB, 
-0xB54446F00359CA9D, 0xA96DA5948F251F2F, 0x84FA0944B809FD47, 0xC4C174AC33BECE25, 
-0x20A879932D478CD9, 0x14434CD16, 
-0xD6D784431B4C484E, 0x865614A824E1ACB5, 0xF5064E457FCC741F, 0xF330A9F1BE9432C9, 
-0x9DF68F06706CF511, 0x9476BCC1696F9DD2, 0x245B5E1C8724F5A3, 0x9D32381A13C2F9AD, 
-0xEB062FCC909E8713, 0x266071DAD, 0xFE54BF4C51F704B8, 0xF4E6FD0DA5EE2948, 
-0xBE5D73C441589E3A, 0x20EAD3CE89BA5C1D, 0xBB6857769ED7B44A, 0xAA04A879F7CECFEC, 
-0x4D391EDA9ED06EEF, 0xA132F7372F88B762, 0xEEACCF52C1FDB7C, 0x250674753, 
-0x517B8D773550A050, 0xE03E340695A145E9, 0xF426A927436F97AE, 0xB094687EB85CF5D0, 
-0x1BA8D030922EAE1A, 0x313B597C8EFBE4B6, 0x1EDF6CECF3EE956C, 0x1A9678FDC83AC349, 
-0x967F6AA6DFD8A6F2, 0x187D1D81B, 
-0x681E8DECB6D386C4, 0x3540F8D586DEBA5A, 0xF23A0A91B640106F, 0xEAF832D0034B5120, 
-0x28CF64E1FB87563E, 0x58065C86CEDBB5F, 0x23F9FF7023810BDC, 0x61795E872C179C50, 
-0x990D596F8F9BAC56, 0xC5929FBC, 0x375879319A0CE1B5, 0xED4D1F7AD79A3A04, 
-0x185FEA8A13E1A13F, 0xFD47F83C4E03B5F8, 0xE57C8CA5147DB098, 0x56DA2BDD3361C522, 
-0x64F68E89442071B2, 0x5C21A044D74F936E, 0xD067B3109F974FDB, 0x114C3F88E, 
-0xEE428C7EB791B84B, 0x1E7C138D704BE693, 0xE060DC42607DA956, 0x405D0809F2874404, 
-0x74A233BFA86FAB29, 0xDA1998C863C238B0, 0xE4FBB0B037ADF2C4, 0x3458CD5339D5CD8A, 
-0x9AFDD81E415726D6, 0x56E2C1CB, 
-0x793F0BC6A40C99F4, 0x5A4A3F63EF80466C, 0x2C148C8A1200F981, 0x7AB7FCA547751E66, 
-0xB469439C7DACC7F9, 0x255FB4AEB5076A17, 0xE73362DD0D639588, 0x922A73A1072AE796, 
-0x1B71F48100542A1F, 0x23E74A637, 0xCFB866F9FA769AF1, 0xD744CEB34776750D, 
-0xDDC8E80B5C8A5173, 0x5CDA74E78B82EB4A, 0xE854D518087458EB, 0x4D3A5BA11FCE5525, 
-0x9F4392230A9E3FBE, 0xFDF21B447D0EE723, 0xF1CA1D5CBE6AD53B, 0x14B84171A, 
-0xDA489A1476A62C39, 0x8034DCE500620AA0, 0x8006C2825F803D0A, 0xD564F25D5246A4D8, 
-0x1C512FA41D64B41F, 0x3283615BDDB126FA, 0xA056122FD667DF5A, 0x1338B65BD813DD0B, 
-0x278776D775BEFD7B, 0x1A93A01FF, 
-0x12803C156E332592, 0x5872D3FF6D4807E, 0x25FC92BA4D15D20D, 0x52C9277C94875159, 
-0x794AB1385DA1B50A, 0xFB287B1B19124271, 0xA0863E4257E0105A, 0xEED99785526A94FC, 
-0xCE382227F88A8BDF, 0x25E490ED2, 0x1DCE9EEBABAACBC9, 0x5E3B9125FB1AC971, 
-0xAE9F53713815C5E8, 0x4660C47A5B613A95, 0xC2DAC56C30ADA575, 0x229EB9BC4B715B30, 
-0xD45AE2B96E4144D4, 0x4FFEDE92416C0ED0, 0xA95DF99238FA6B23, 0x806A8A90, 
-0xCD6A400C255605EE, 0xBE17FC5EA8DEBF65, 0x833D01186A4C54B4, 0x4D1C8695AF7459FF, 
-0x4506BB09C13724A2, 0x915BC3BDE2044BAF, 0xF6F7D11B3B497E16, 0xA1FF728814F51401, 
-0x1A2DFA61AA3E6286, 0x39FC9441, 
-0x43A16221E47C4788, 0xF993CFAAAF22DA2, 0xFAD2CF71C454E1B4, 0xBA3F0628E85E44B2, 
-0x44C23D73AA2EFDDC, 0x67460603A5E81E71, 0x3B25B61085A5E6AD, 0xAF0F663F5B0A2888, 
-0x6B89967E812A6C42, 0x744EBAA2, 0x2CA9E78371EEF413, 0x346EEE50DCF229C5, 
-0x524207FA8FF213, 0x2E098E7BE733B76D, 0xFED4386746A7C85A, 0x94DA4EDEDC494760, 
-0x681FE897C121C92D, 0xC7EDA3857AF2863, 0xE900F50824AA0A73, 0x1579F0D74, 
-0xF4C60F74B54A97EE, 0x8AA4F8D2EAD1FCD9, 0x96A961C487E085A, 0x43D80373E986838F, 
-0x32C075F1D76C32A5, 0xC70C7F19CB6FC5D5, 0x61DDFB2DE150A819, 0x9ECFD08CB209B9A6, 
-0x52768A7D46E8092C, 0xA15D9645, 
-0x619AA23DABD4D008, 0xDB8C6B3DD2143AB0, 0x2C0062970A4B0C62, 0x884C21C5A76D0AF6, 
-0xBAC057399025EE4A, 0xE7844078C3D2E9AF, 0x18969972E3F22D5B, 0x4B23A4BB6881C618, 
-0xC21257B6D092678, 0xC9093AD4, 0x5AC282A7F58D8A56, 0x7514736FF8FAB302, 
-0xC15B081C6CDFE9C7, 0x3F45CF6C1C7A1B23, 0xA7D3D4A4496DA5F9, 0xE8B22D9EE06938D1, 
-0x12A3A3B89EF7D74E, 0x6985DFE42E242FFE, 0x587E4A0067F94243, 0x24A6CEF0D, 
-0x1A76B6474A3A7004, 0xBAF8F5F99746732E, 0x143101051818A10F, 0x8215A51A25D0270C, 
-0x6C4E667F76CE9149, 0x58DC45D142E5A8BE, 0xF3B32AC6182C7F02, 0x78A7D0156C331DDC, 
-0x6E78E62860205705, 0x26A94576A, 
-0x7AB0431787B20AA6, 0x3C0B7879F0BAD34E, 0x23500BDE42F85A58, 0xDEC9BB467642AA86, 
-0xBFFE971CCA7B7208, 0x9EA1064D70F86DBC, 0xE4F2472826A0EF89, 0x561C1C74DEF2F8EA, 
-0x6A983E23C0743A0A, 0x24430AC56, 0x2734ECE23A263569, 0x33B4EE4630823E30, 
-0xD98B30BC7F7B00A2, 0x1E094A3AE06F41FD, 0x9A96E982740C07B3, 0x8CE43868EC77A0EE, 
-0x5142CB91F7EFF019, 0x7EB02078DADC4462, 0xC6B8B68478DF3113, 0x399AF83E, 
-0xBC69238330546F90, 0x82D7149E74FED49E, 0x2E55A1304ABC75E0, 0xAEB1B9A6D1F65D44, 
-0xE8BF6045A6691761, 0xF74C181F41143C41, 0xE48F8C714964473A, 0x594F570FA0DAF6AA, 
-0xD4A62CD0E9335A34, 0x11EC2BB65, 
-0xB2C70E254C9BA140, 0xE675580679F5681F, 0x25AB884E5C79792B, 0x6CEAECE845A1142C, 
-0xE9BFD0E0AD8CEA88, 0x360A5C697C62A1E1, 0x41B6C769E5FAB41C, 0xA5BFF9317005C485, 
-0x22E119C7C9608A1, 0x24CB9EABD, 0xE9D80CABD4656173, 0x41EF93D3F48C0E5, 
-0x73AEFE597CC96FCF, 0x17676824E00AB7D0, 0x690588CE29948570, 0x14634C500167333F, 
-0xD11AC814448D537F, 0x5A4B587323913647, 0x6A3279396367450D, 0x2045FA9F7, 
-0x1BCABEECDEF18BEC, 0x2AF3C9686657BE87, 0xF1D57F587991273D, 0x2FCF7C9A4620E653, 
-0x51AB4B63CF39F177, 0x4DE131EBDC113245, 0x79EFA2E0DC051B40, 0xF9E045BE79DFC9D0, 
-0x1B3C2CFF8549F7D8, 0xDE820B0, 
-0x8CFD6A3AF61564DC, 0xB2388CC9BB0558F3, 0x89A09A14D1143D95, 0x9B2995F342A9A35F, 
-0x86BC27A25B304FC3, 0xB52AC8E72F875304, 0x5E5CB7F218BE2915, 0xAEE8F48BA792DA58, 
-0x39D25C90E8C7228, 0x1EB738448, 0xD5D54ABB4AD135B, 0xA4C0D3F40C9D5477, 
-0x3E3140E252CA89B1, 0x87483AD7EA24E88F, 0xA745EA25916218E2, 0x1DEC3EE785772D5D, 
-0x3B452863AB51987D, 0xB6FBA293D910ECE6, 0x1450F8CCE2300375, 0x21599DCDD, 
-0xFDDED3C2EDD0222C, 0x1E568D4F4B3CB5A9, 0x825683B9A352C4C3, 0xD397121D84C0BC7C, 
-0xC8494C920CE2B1C0, 0x637BCCC7B73D473, 0x23CC3F65B49A2271, 0xF63CCBF0F80CFE39, 
-0x25973FFC06194473, 0x1FB674B39, 
-0x2F067C1947636FD1, 0x6C1E91736C5F5693, 0xAE0577D36F32F7A4, 0xFE104B2B0AF1E815, 
-0x70800620581CE20E, 0x3CA37EB2BBB90934, 0xCEB09722104C5368, 0xA39E1D21CA0123DA, 
-0xB80EF069E61B4FCF, 0x199A2A08C, 0x1207C921250D037B, 0x90E99E4B88FB7039, 
-0x96601A818078C4E3, 0x22024FAC657666F6, 0xAAD429A231DB4B82, 0x79D4FBA41EF37664, 
-0xB2053EE498DD557A, 0x487F44F1DFAFA8A0, 0xDE2EA9A6C32BEC19, 0xCDF4DA04, 
-0x548D49BB382EB61, 0x943A2C15147CF4D3, 0xD61E61C484E39B23, 0x7F23F06FDF9DB320, 
-0xD6BB06A95F5E04A, 0x91F2AEE50C2C7D26, 0x5B31971E00AEB732, 0x940A64A11ADF8EFD, 
-0x28619984805A30FB, 0x39270DAB, 
-0xED3BDCCE781FA458, 0x526BDD5F14A3748, 0xD9701C0F36D4CA58, 0xF9E4501A0C47897E, 
-0x67B28C70A0E7479B, 0x4F156F952765E834, 0x95B02EC1088070B1, 0x973130782231247, 
-0x4600F4E944D6CE8E, 0x6CBB0B9C, 0xE095E822C617FC89, 0x690F52FC40B50B76, 
-0xDD12E70575E74982, 0xA609D00F758B95B5, 0x4C0FD0475B42B495, 0x674578DBC6ED85E9, 
-0xE752FBACC68D4CC9, 0xA86E7F63F830A729, 0xF39E49399C88A123, 0x8439436F, 
-0x4E51F83EEE9F4E1B, 0x2F078C734E89E93A, 0x37865320D605135A, 0xD9918438C9CC74D4, 
-0xBBBC4B3795092D5E, 0xA570A3C05B3B34EE, 0x86E3061DF4458DB5, 0xD8CDB7C1742BCE64, 
-0x5782281C0C668FDC, 0x1D84394B7, 
-0xF7752119D3EA7625, 0x4E28A908387B2AA7, 0xBD84D9DAA3C8C795, 0xBABCF86FBF4E1EAB, 
-0x3AA9D681963DBBCB, 0x3643CDB477D13237, 0xB9959FDA99787E6C, 0xAE98A5A2A4AF361E, 
-0x773B623D0EDA5E3F, 0xC42C82E9, 0x699687409F42D00, 0xED0C40ADCA60D1F7, 
-0x76D2CF657720F58, 0x5B89ED917E9B3301, 0xB6D5E20F06E3CC1, 0xCFF83745B6CDEFCA, 
-0x4B26EE5C4CAA5AE9, 0x4CA4AE6FC4B71647, 0xC26D5BBF9F40C67A, 0x1BF200E74, 
-0x65F3432208261543, 0xBF5E0DAED457F20F, 0x9A28BF93A913F152, 0x807959463723D230, 
-0xEFD80DFC7504CD38, 0x65A7DFBD51C9E195, 0x889B500B4CB63A60, 0xD17ED7D360E8A989, 
-0xA5F7588CF33C5EE2, 0x270782A63, 
-0xE30DFC966EC9D86C, 0x8F6375C4721BD981, 0x8F92B0BA25F59466, 0xB20BE2E4694EC34, 
-0x3EEA2F4E790AD193, 0xD23D56B870EBCDB1, 0x1DE68B24D4663324, 0x47EA0697D4017E11, 
-0x76307DFD51A879A5, 0x2B736090, 0x1C6B279A1D988371, 0xF103A40FFBF4B3BA, 
-0x59DDCD9F95ED6BB0, 0x8533343AAB2F1CC2, 0xCDA65BB1C1D7E1A7, 0x937040D58296E0FF, 
-0x8A3BC0CA61D44ED4, 0xE609FD30668D13C, 0x163AA2C504AE7BB6, 0x209AC723, 
-0xB4F2E916CA93B82A, 0x18B91D2148040726, 0x4AA8431D8DE0153D, 0xB29C9E37D79FF435, 
-0xC26B557BC90BD111, 0xCD2BCC464EC45D28, 0x9D2BED1D24D3C3B9, 0x96977A591CDEE7A3, 
-0xBDE38C490358C848, 0x9B0A568B, 
-0xAF44DBA1647C590F, 0x8F13D390A3462794, 0xF1A791A7DADE2894, 0xA9214904E22CCA52, 
-0x1F94AEB56A01ED81, 0xF16BCBFAAAA150F1, 0xDB3A0304DF233286, 0xB9E6E40511DD8474, 
-0xC746B64830E9822A, 0x452DB595, 0xAC1CD618A0741386, 0xF09F9533F1E31D93, 
-0xAFBDA1853DE170F2, 0xE5C273E283B431D3, 0x635050E270740104, 0xEFE182C5C67C98DD, 
-0xFAEB4EFC07B198BB, 0xEE261F609AF0FA9E, 0x569043C24CF7A88B, 0xB2A5B36B, 
-0xE9BAFFBF8E7B563, 0xAC38B476E1899C83, 0xDF70758C44F7CCB8, 0x9FFA94B7933F96F1, 
-0xCE13D299096AD4E5, 0x676304A6F07851FB, 0x47C60879B5D46C15, 0x758FFD518209A160, 
-0x415BD02D739AC78B, 0x58B008DF, 
-0x808B9E965F7CFD1E, 0xDB098FE04C384DE6, 0x9608986C45F184B1, 0x6F68BE54CA190B03, 
-0x185707A6A06D46FF, 0x111204E23BE2E4BA, 0x704A5473E88469EA, 0x492B8CA7D9742282, 
-0x3E86E3E8747D16C0, 0x223C8F12, 0x3DDB79AD71D7B85, 0x19E8EC6E8D8D714E, 
-0xF94D3DB2596B6FC, 0x27057B31EDFB8203, 0x7B5C4710BEFF7A32, 0x891143192652E8B0, 
-0xFECA93F0417E25E0, 0xA8A471CA2CF4199A, 0x836F0A11AF008DAE, 0x8E819956, 
-0xA3A9224CAF59F519, 0x55A474C602AC3F24, 0x1BA5C6743BEBF350, 0x3C75CB03A0EFAA, 
-0x3EC99CBA46882162, 0x3BFD6EC416936ACC, 0xE746D49EB1674C3D, 0x6E033EAAC121237E, 
-0xBBAFA4031EB113DB, 0x1F2E379B4, 
-0x84D85DF11B9D53CD, 0x59F5B233AB832F40, 0x71CF9F736054B781, 0xF44ABCB0C2CD4844, 
-0x295FA9C74D0C5200, 0x3FC2DF2BDC464ED1, 0x466A4CB62E941B2E, 0xA87772A1CF06B0D9, 
-0xA191732AF393B1C, 0x17E4660A7, 0x9EAB2CF99AB32F88, 0xA9071FF76AC3D3A7, 
-0xBCD9A573028905EC, 0xFD3146BF02758D68, 0x9BB584CA9384A444, 0x8A3FB38C927383D9, 
-0xE2E9B8984A1D9B30, 0x166DB67734FDB582, 0x3610CEA50968F1A, 0x1848B380F, 
-0x656D309BA3E22D0D, 0xBFA1EA087C80985D, 0x8DAAB81F42369885, 0xAD4E62CB4AF70345, 
-0x110C75EAF56517D7, 0x7CCB77724A959B71, 0x33F6F9A29D6DF60C, 0x39F8B1269A04B881, 
-0xBC8BB692EAAEBE6B, 0x2323827F1, 
-0x249E159373627D3D, 0x2F4E0FEE2FDE1541, 0x5D1A6D6C3D2F5B31, 0xB1D90520547CDBB7, 
-0x18F7397D61DA7168, 0xC3B0E24A07CFCE61, 0xB08B3587D1A4BB66, 0xF05E1ABE887039FB, 
-0x288EE2BC2B1CAC73, 0x15F1E0152, 0xF884DEE1DF7EB869, 0x9EF03C54F5D0BAAB, 
-0xF128505FEAB6A926, 0xD4AA379EB972945E, 0xA69E2A87FD20AA63, 0x92851116BFC2900F, 
-0xB18902357507926C, 0x9DA240A9D839E869, 0x73493D27892F3935, 0xD34F7D4E, 
-0x9ED3E6BF99428038, 0x6289248B93D4BC14, 0xCE2991AC0CEE483E, 0xEC49FAA3CA6E429D, 
-0x3B3E11A50A9BACAE, 0x15362252A97243, 0xE37B226355DD292D, 0x884C3F0E3A31B05C, 
-0x60592CEAFAF66578, 0x59EAE56B, 
-0x61D5BBF671F9B7B6, 0x29125E88625773EE, 0x13E6433B68F93F44, 0x3DD08AF7D59FA91, 
-0x8321542BF5C15EA7, 0x784BB6313BBBB4DB, 0xE91E495688E9FAF5, 0x133A7238D7E8309E, 
-0x3CA1CB86D2B0DBC5, 0x115A19683, 0xE5510A9A7EBF68C4, 0x90EF03A0141532A3, 
-0x7275C6269EF505D, 0x3605F7E10CEEE332, 0xB1F0D5DFBAD295E2, 0x8AD7085F2BA01DC0, 
-0xD86066B8394A8345, 0x508070A7C2EC77D2, 0x48B7D4D650CC331D, 0x20F19606D, 
-0x729B03BF25FCD71D, 0xE006C1B91D7E0F46, 0xAB2EB948CE663DB6, 0x5CF4EC1AD3C81956, 
-0x2F0DADACFA1F0B8F, 0xEDA875B86FDAB1E2, 0xB4E42B93D1E7DDE9, 0x84A696AB1BE42FD7, 
-0x13487F2C62DC52BC, 0x76B0ACEF, 
-0x965573E85BF21BE7, 0xAF86D782446ECB63, 0x148BC38EA244FB5C, 0x1EDAE5824F694E6D, 
-0xCB83E5348A1F5920, 0xDC44D55B98EB760E, 0xA9325570C953EB53, 0x87067F1B3669916A, 
-0xBC4A3BB8FEF5F479, 0x1C63EB8A4, 0xAF0E420D9697512C, 0xBA07565EEB7C55F3, 
-0x5CADA4E716C48E52, 0x7F487B6531F77BC5, 0xDE470FA830FD0EA6, 0x68379F87908277F2, 
-0x245CB8F7B416FB29, 0xFF7868CD8447BE36, 0xF38413F57FB7C22A, 0xFDA86208, 
-0xCCC4C00E8AE05431, 0xF7414F8CF1EDE7BA, 0x59A37961AF3924B8, 0x6BCFDB7CAFF69821, 
-0xCFC27900F258D215, 0xD835F427308A6F76, 0x9E50C0F4002CC2F1, 0x1C13EBB385626551, 
-0x19ECDF4D4E1DF9F3, 0x69B9DA74, 
-0xD398FA516305EAD8, 0x1E0F4BAED19E22D6, 0xF73DD870083687A9, 0x2656CA134D973FA6, 
-0x231D34FF359C3F1C, 0xEDE4B086B29CA3FB, 0x72A47B2F0F87825, 0x8026071D786ECCDA, 
-0xC6CA39440A2C71D, 0x37910B91, 0xC359024D810D239A, 0x7064F802BAFA11D9, 
-0x55A847D653E3943B, 0xE1C12D9EC37C013D, 0xE446ABD68CAFC5AF, 0xFBAE669C5EEA1A79, 
-0x80E5C02D5E6CCB8E, 0xF5D03D98563CA271, 0x50CD7BEDE939D927, 0x2867D61, 
-0x763959B7A22C81AF, 0x4252E80163373683, 0x760E74AFC219B1A0, 0x6D9ED5986B85DE69, 
-0xECC0A943380395F1, 0x523F4998EC37BA1E, 0xE24FFA14C988CDCD, 0xA166209912D67040, 
-0x3DC5D1E367A42D05, 0x79688C23, 
-0x4A90486D76BFE15A, 0x1B7FC4D44445A702, 0xDCB455A1E3A05ACA, 0x3C1BC827FA0514FE, 
-0x3DF2433B10AE7E65, 0x1D99F16AC04584DB, 0x61F42009F9F36EC, 0xB7A6B74C0FAD61D9, 
-0xAF55AA494356772B, 0x807AFF87, 0xED110A6F1D7AB7EA, 0xF7CFC12003D8F189, 
-0x5D0F9DDC8EBFE45A, 0x8609CCE973A51495, 0xC6D526EEB5833AFE, 0x75A05A6658168687, 
-0x8061069792565EE6, 0xC48EC64ACC369EB8, 0xEAAD88AABE07414, 0x15BC97E0F, 
-0x1A85953E4236A111, 0x2484C75C82493A4, 0x3B2517AA86326A3A, 0xF66234609B78B11, 
-0xCFE0D272366387A, 0xB6C87DBE9FEF898E, 0x1804E4F764A63E7B, 0x668F54EB4B598ACF, 
-0x8C7AF46768821210, 0x142B70AE, 
-0x3932B1709E4C9A22, 0xFD727D6B551F7F61, 0x5615B42A2E467555, 0x2C990DD71F4DEDA6, 
-0x4A968E287FD43884, 0x5299022B4F7F4F70, 0xE024C6ED28852929, 0xD45FBC5E212D330, 
-0x449A0238EBB25A5B, 0x1F8776191, 0x34E54EF7A98DB969, 0xB23AE8F9C5B88687, 
-0x6DB7ED61E176B5A2, 0xB8400E8B27E17B6B, 0xAF2A37B4E51FFA35, 0xE89B613A80473E38, 
-0x18EEA543FDA939DA, 0xEF21ACF100794FAD, 0x62FFCB66C52430E3, 0x453FE557, 
-0x4DA5B0AB6EE84D2, 0x3D00F8A281D099A, 0xF11EB6767C4AFA81, 0x547AD0C0684C1280, 
-0x79CA80FD78FDBFCD, 0xE254E43700C191BF, 0x5F274F0B8A42207, 0x6CAD9A295442AA37, 
-0x523F09612F71E303, 0x14C759FD9, 
-0xBA0442BF8ACE02C4, 0x9221B86ED37D62B8, 0xBDE96E75DAFC9833, 0x3D3BE99AE192A286, 
-0xC57105E367C5D62F, 0xA6664A10C911B18D, 0xEA0824C4283608C9, 0x66810BC8481B5097, 
-0x6E34AF9AFD94F734, 0x171C55350, 0x1A99E350C6A982A6, 0xD6A83E67EAC17115, 
-0xAFF8299FA875948F, 0xE97C08BDCB986601, 0x1DB4AAE3AF037240, 0x1C31892C5373E851, 
-0x25FF85D04BC33BE1, 0x13063591A05A0A00, 0xA86B950A0D42EB77, 0x2070DB71E, 
-0x1B647A578F9DDD0A, 0x5E101094A4FC3BEA, 0xCB75DCBF1DF134CA, 0xB028C7E236108DF, 
-0x3C575B83BEA64F8F, 0x32E1AC4B2A2A440E, 0xC109A7B4BE29BA4D, 0x5DE06F42F4F65C21, 
-0xA6A8E05B2B8BA57, 0x17F3FC9C3, 
-0x9B80EA539448DBFD, 0x2FE69E11E6032D6F, 0x34202EC6D8C99142, 0xC65A761F5D47C25, 
-0x15B004572223EC40, 0x55EC4317D0F4E685, 0x205FA8D735C4A8BD, 0x5ACB07CC71280784, 
-0xB8E93DE65801DDC9, 0x284DECB9, 0x8FF09E467D056D5F, 0x6FD391E6D6D83F92, 
-0xF44CB45BC761523E, 0xC1A2C96484523138, 0xB0346BE37166606C, 0x1846842A6D242ADB, 
-0x4A3E68C2217D0831, 0xB3D344837F0CBF5A, 0x32B02F9B822AA60, 0x1A5AED04, 
-0xFB5EF70EB3CE5208, 0x28D1C0C4DE16D61F, 0x4EBEB38A4035A84C, 0xE4F1F20008555C63, 
-0x74C9F99B0997F51A, 0x1563AAA660006DC7, 0xDE9D41A11EEE958C, 0x1CDFC445C33AA3F7, 
-0x86286758A01FBF7D, 0x7D4929B1, 
-0xDFACBCCF8FEAFCD0, 0x5B52B45EABD5F61F, 0x41085B9AF728C533, 0x7057A7676F537ACE, 
-0x21FDE02700F71E54, 0xB1ED98F8771069EB, 0xF696FCB27B04ACBB, 0x8E115CB34065A5E2, 
-0x8A72D3C9FDB6E138, 0xDEF9BA57, 0xC834788AFBC1DB1F, 0x728028AB514E9C6F, 
-0xC9775CC251D26BFA, 0x4BB14366E366FC1C, 0x3E81B64A49F5829B, 0xB73FC6BD2A9EA2F9, 
-0x7404B59DD32EE757, 0x6DD2F05D81E4793A, 0xEFD8CB0557D30FAB, 0x5E70B7CC, 
-0x71B17578A073D328, 0x8EB5551BE42F99C6, 0x326C377A3951DFF0, 0xB27142C58B18EA9, 
-0x9B2A3972BCAF3A0D, 0xA05736ABBF50A28E, 0xE23CD9108B3E3AEC, 0x194D9D99F4BC95E1, 
-0x39079F60B04900AD, 0x117398BC1, 
-0xF34A6574F2E49F49, 0xBD6413DF1752CB47, 0x3B03C6EE4573285A, 0x3244BF0934A7131D, 
-0x4B54A79C4B9DEE41, 0x9E881EEFE5AD7337, 0x68CE72F619A293F4, 0x3FD43EA34441A5C6, 
-0x96130CDCC4E71D14, 0xE45A5063, 0x4604850758441E9D, 0x54441ABBF26AFF58, 
-0xDEE14A122AAD99E2, 0xE197F2D09BA064F8, 0xE7F8BC33122CC91B, 0x86E6A6F21542D2ED, 
-0xAD666B85232A2D09, 0x57D28A33EAD23368, 0xDE7613DDF8324B83, 0x99E4D2F6, 
-0x2DAE52FC2207C8B6, 0x5DD5880CADDE32EE, 0xA419F8E235325CB9, 0x769228988DF838C9, 
-0x4896B5008D422A2D, 0xB5EEFCBE62F631A1, 0x68EAA42A4D55411, 0x6C8EE64D93CEB18B, 
-0x90A20F9D9957D718, 0x1D5B540DA, 
-0x178692B23B4557A8, 0x9CC5801C7C55DBB7, 0xDD397209EA250208, 0x46943D5119D68B0F, 
-0xCD2703121F7D26F0, 0xF34FDE2DB0F9FF54, 0x3E9BD0228D9207F3, 0x3395FC384393EB75, 
-0x4FA502D0D0BAC2CF, 0x11BAF42BC, 0xB8A062F24491E5D5, 0xE2F0F39F6A19A11D, 
-0x372F42067AD27994, 0xE9E43ACD795C7286, 0xACEFF2CCF695FCEB, 0x3B1068EA5A3C3524, 
-0x24C091F5FD3F1598, 0x5DC281306A458DB7, 0x1A18BE7D68B78938, 0xB56E407E, 
-0x8AE56588C00BF537, 0xBCF4DD47BEAB25FE, 0x991B1E0EF91E2160, 0xBCFF91D33C70D7C, 
-0x5F65D467FBBB728B, 0x2857938CBFDE6AD8, 0xD838DCBE0CE8ED50, 0x3338DF60CE1DB1FE, 
-0xA521BF00AABE49B7, 0x5346BA7E, 
-0xAE8191FA42D1ED30, 0xCD01F1A38AE9E5EA, 0xFB0FDA2F4F55B153, 0xA2BEC50B1E181B9, 
-0xB6428CB12248654B, 0x620D1A8C17CDA834, 0xCC6A9C85691ADAB3, 0x8C57B275E9977836, 
-0x333621397B04107C, 0x39FF93F2, 0x88640B4E20D5FEA3, 0x328CAF8795C0E10D, 
-0x7F1199D857BA76D2, 0xEFE880206A069B4C, 0xDA18739D5E60D9FE, 0x64F7DE365A2F0472, 
-0xE4C9476F13570C81, 0xA46E27FD2D4AA91, 0x9D6BEC1A009134BB, 0x661E69A8, 
-0x525622908A059010, 0xB02CA2F419DAC721, 0xFDA1819122A7AB2E, 0xCA95B9F895A1D182, 
-0x9B8A1B861479A4C1, 0x587AA5706CEEA13D, 0x8B979807AC08057E, 0x3BFF4CC1107E5C70, 
-0xDD2D9C56B4A4B289, 0x49E565DF, 
-0xA45FF97A132265E3, 0xC0228E174FF465F4, 0xCFA5CB54FFC72039, 0x7DFE7BAD25A8ED71, 
-0xFB59B968CC182F18, 0x7FDEE31052AA0077, 0xD03AE5890965FDC9, 0x780F4E7BEE276503, 
-0x11116558625F2A76, 0x1349F4FD6, 0xFD7290F756A20A48, 0xDBB4BABAF1B0354B, 
-0x277E7B9F729FAA44, 0x91DDC0F82AA90EBA, 0x6A5FE0A7138A1918, 0x13161F9EB75E9FE2, 
-0x7BF7FA0A239A3908, 0xEA1CC0BA334A9AD2, 0xBE0DF8016F88F956, 0x5EAA4EB2, 
-0x97F37CC3C3DFCC84, 0x31E35FB0D7B34231, 0xFB3DCC5957612CFF, 0xAB097FAD8DFF7C43, 
-0xC133F637824B4149, 0x585FE4EF87D73AA7, 0x89C9056A8263B384, 0x781588F04D20AAE2, 
-0x42B82A1039AB4891, 0xF3295A8C, 
-0x78535CA24201ED30, 0x4B0ABBF8F4AC185, 0x2F8240EC6B0CB9E2, 0x67584AF5ECEBBED8, 
-0x66E6D60E3C1E2F16, 0x1C1F933F2F0AE937, 0xE31493FABD84EBFC, 0xE9AFC1A19DB9CCAB, 
-0x29DBDC37B6B029FF, 0x21ECACFEF, 0x8CF88061571A933D, 0x60DAB12482154C5C, 
-0x490CBB91AE4F9BC3, 0x93B091371B4E5CCD, 0x17C380F15EE31D30, 0x6A8F75BB52E221BD, 
-0xF92BA50496EEE32D, 0x862788FEBE8E2E62, 0xF98EAE6224A6FBA3, 0x2CC77CCC, 
-0x9B46284DC4607CB3, 0xA5E4591FA1D72373, 0x870930F289E6021F, 0x4F84CD95E9135FB, 
-0x97A7F6EA4224783C, 0x8ECBCC3480AC9E04, 0xDD378672834BA4C9, 0xDD9E7C96DF217B34, 
-0x995594FFFC0A8B55, 0x479EB38C, 
-0x802CFFF90DEE48E5, 0x26D0C69B66C9C27, 0x6F763FA0CA163053, 0x276C0CFEE1EE69FD, 
-0xDF13A9993C3315E8, 0x616660759412BDF9, 0x2B9BC940103F716E, 0x20ABD907C4200DB1, 
-0x7787237C2B7D5928, 0x1CD0BD016, 0x40A6861018F1474D, 0xA50F7F2A824C9C23, 
-0x5EBBCEA855050894, 0xC40B592743BAE7F5, 0x8357B62E72459C38, 0x22DE00C986DE3C3E, 
-0xA799B1A2991159AF, 0xBA04639FB40354A7, 0x71F0C130AA0A9AB7, 0x20E6A80FA, 
-0xB88698709A2B66C5, 0x7C5CECCF7FD7C917, 0xF410CFD421073450, 0xF3BAF6CC9FA2D960, 
-0x2A58F082BE9BAF03, 0x2518AF63E11108B8, 0xB98A7BF5E211A8E7, 0xBA02F0B4FA607A1B, 
-0x7ADE02C5364B6D66, 0xCCDD8247, 
-0xAEE6799893B27EF4, 0x5E843846E384F615, 0xFC3B902CF6FE6095, 0x8FEE49E3F8DA0B85, 
-0xEAB83E05B5B2E4E0, 0x97CFCDAB413BA8F2, 0x8AB9A0A915F11F42, 0xBFE4814FB2C4B78D, 
-0xFC3B485587EC9FF9, 0x24460978D, 0x9B65923ECBBFC508, 0x797F773520E71C07, 
-0x8944CEB2923FF6F7, 0xACF924705B94CD68, 0x11EB0DE49698719, 0x942640D92F0996F1, 
-0xFC8236A4A81749A6, 0x4EC1E0B02FCD81C5, 0xD16978D25A172663, 0xE2791207, 
-0x956BC04434D963D8, 0x4CA981C663143B40, 0x6E2D135ED51B7277, 0x498BEEF725E72BDE, 
-0x72A6F9EB038155E3, 0x2E9B7E2073C67AF1, 0xEFC77FD77F903664, 0x1B3E9A0A0695394B, 
-0xE0F833500AFD6C72, 0x146A98684, 
-0x5FFE427502EBE7C3, 0xB822934EAECE3726, 0xFC4FBD17BDB2EBB3, 0x287C883E1A447587, 
-0x641F454A477ED5D0, 0x5946497C71B85617, 0x6D4C5A4826C024AC, 0xDDF7AC7E3BBF1E8D, 
-0x1E555D1D41C77B0C, 0x3E1DFCD2, 0x818AA63FC32EF5C5, 0x19268A6F0CE26743, 
-0xEBAD1F785BFADFD8, 0xCC029DDD6D836C0, 0x8EDC0E8A26B2CC0B, 0x9A53084636DA42E4, 
-0x1A45CA2113B81A53, 0xDDB8B680163373FF, 0x6C1A9BDA871D2A30, 0x23D9F389E, 
-0x1B1072DE6C00F52F, 0x4A84D0B7ADA1D0E5, 0x422BBDCF58CF07F3, 0x827503C43B74EA2F, 
-0xDF01BC3028A1C9D0, 0xE2A612E816E9BC9A, 0x610CB6CF39123079, 0x2750421414DD0689, 
-0xA9952D94CEDEEF48, 0xAC513097, 
-0xFD0F5AC0EEA4465, 0x17796B4F593189B6, 0xA57B501AA5C61B72, 0xF92CA1D859F8A9E8, 
-0x195429A7847693B6, 0x710AF40A8CFD877C, 0x96D1D8EFC8B2A1B8, 0xF596B635F156AD4F, 
-0x8F0F0152AD6177FC, 0xEB21BB15, 0x31F613744DC9D25B, 0x30C3D5DF8978D989, 
-0x6087CB74CAFE61C8, 0x6ABCF2AB305BF631, 0x84457423106B292F, 0x60CAA53BB7C3F279, 
-0xAE669FE8A89E21C9, 0x75637E00E5DEFA6E, 0xC94E191133354100, 0x22B973F7, 
-0x9405C78CAE8A343, 0xC7997DD581A56C74, 0x1FFF8F25EFFF44E3, 0x74E08B0D24DDCB5A, 
-0xB6C978891AF4379B, 0x110176CBD02D3407, 0x733F43496D8886F9, 0xCB17162E25659489, 
-0x6DBD11DE21E67572, 0x40688326, 
-0x4246F38345A3FADD, 0xBDAD804AA0BA2C91, 0x4B87757F49446C4A, 0x1F7BFF8AC7100FBD, 
-0xDF8FAFDBF7E56FF9, 0x5822C4D36C6259AB, 0xBA0247A33F0BEB0C, 0x1D6190D5D8A6182C, 
-0x31BD6F24152E37D, 0x11C34A519, 0x78FE91AB60CAF476, 0x4DDA0A62FF6F223D, 
-0x34B5300E2EAE2936, 0xC0751F66D6C93696, 0xAE042D7D9C5192F1, 0x183DD527F54F30A5, 
-0x71EF4FB9840F921F, 0x74CCAF93E0191A48, 0x976312E51C41AB93, 0x247A98A1C, 
-0x39B7993893D7A01D, 0x950F27318AF480F3, 0xAD92C6F2035A43D4, 0x1B0351284590D96C, 
-0x261D089A7CD86EEF, 0x54E8C679B2FDE4EA, 0x547AF7AD39F50C31, 0x7F9EFB0BC4D08E6, 
-0x42B33C77F158C31E, 0x1950C30E0, 
-0xD121626BC79EAFAB, 0x7F99AC7E82DEBDF1, 0x849ACB6D45AF332B, 0xC713FE5CD540E21A, 
-0xB755F74771D42DB4, 0xE3074C27D956B032, 0xA9BC37EF3E360DD9, 0xB901CF25C0E94797, 
-0x34E497BE0E719604, 0x34241BC7, 0x77B7830E72C14098, 0x42B3DB2DC753CC8, 
-0x8AA5469D9A4A5E6D, 0x8C5E29EB5B8C2455, 0xBC4460608B5F75DE, 0x22C3247AFEDB60D2, 
-0xEDDC8B0EC60FA0D8, 0x6ED66DF6214A5AA5, 0x7E20B63B58D657AB, 0x16E37C7FC, 
-0xFD60BCFF5BDC6E42, 0xD34E7F4BE4D082ED, 0x552AF7B81452357, 0x1D9EB7830D955BA0, 
-0x350D80A757EE882C, 0x365FB070F9FC0DF4, 0xE724825625E7CD1A, 0xD3B25EB3242257B9, 
-0x627E271BA07E04EB, 0x573257B6, 
-0xE1A4F0E0FD549749, 0x2D3C36E905F2E2AA, 0xEA4FDF6E5716016B, 0xD8714BA63BEBE5CE, 
-0x571AC1590F58B094, 0x14DCAEB3E1FEB294, 0x58002980337C5094, 0xEA140F1614DCBF64, 
-0xB340919DAA7BD377, 0x25F974DAD, 0xF1C9C130AEA693BB, 0x76A887F85FEC3D05, 
-0xF9E2C2B312034092, 0xE53CFF1E78A25AA0, 0x2A8EA2013A47E248, 0x9202E3E11DBA5E4D, 
-0xF7072D1A4A042BB3, 0xF716F43C6C0311B2, 0x8453FCD9E05CBD68, 0x1A9F4FC9C, 
-0xDCBAB4353AF5A161, 0xBDC2BE1998CC8D62, 0x7CFF61468532271, 0x7794B818CDAEB8CA, 
-0xDE28F533798BA147, 0xB6795C6E5EC86BC4, 0x2BAE9E59211C076F, 0xD04C167799A9739A, 
-0x12DF41EDFEB6422E, 0x48C1D82, 
-0x3AF7FE54717D60F3, 0x2214BE92A75E4195, 0xAB1BA3C89686EA8A, 0xA06648CBBA9FED8A, 
-0x11B63CC0FF3C73DA, 0x39D0A5F6C88688FE, 0xC56D727AC00AF349, 0xE3C8BC5DDD1ABAE3, 
-0x3AB583A12350AAE1, 0x16EAE3438, 0xF7188734E38E987F, 0xA79F178765C40BBE, 
-0x77B2C2542D1FF151, 0x76D2D294B1C7BBFC, 0x2E324680203AB076, 0xCCE5CFC913A7A588, 
-0x581C6B7165631E0E, 0xA75D9BF8F9C5F4C9, 0x6428BB5A7728EC9D, 0x15EC6778E, 
-0xC4AE1F610C973791, 0xB259963B4B14B441, 0x11C568D73B15714A, 0x305B3D17280DCA3E, 
-0xC235904595908D9C, 0xFFB94AE681907EC2, 0x38EC0EE5055BB45D, 0x7DE4AEF712613065, 
-0x7DC85D9A843C0C41, 0x1BE67102E, 
-0x63B3B8A50D296157, 0xECE70E64C31C1EE6, 0x174A3F6B39CE7FBF, 0x64703621E6EEEA60, 
-0x9CD59A6AE9508EC8, 0x2C93560FD0EDA550, 0xCA8CA747FCC2A32, 0xDDAD6CCE9ED66741, 
-0xDB48896CA60B5F9A, 0x162F330AD, 0x640A7A609566281E, 0x8E7F7487BEF3BA58, 
-0x82D4D5E85F30653A, 0x797EFCECBDCB9730, 0x20304508E170EFE9, 0x5EF125DBC2CC6C1, 
-0x3958F2C967D5EB8E, 0x851A19E8D7178249, 0xE0166F34678F658F, 0x913A2623, 
-0x372CE6C2D6D95FBD, 0x236BD694B8B64C17, 0x726D8E2926D7BE88, 0x856C1B8E1E15EBC2, 
-0x8E68E68224C194B5, 0xF543EC1A600CD00A, 0xB0F41DDB15E8B265, 0xAD45ED401F0B66F, 
-0xF927D5AB0E4245C7, 0x26924858B, 
-0xFD7EB0125FE2F1AA, 0x7B2314CC41A18221, 0x25D78F03CAA5A8B3, 0xC6643693D8A75783, 
-0x5EC022289F11E018, 0xB133FD85E600F32B, 0x583103298C14E2D, 0xAD8F332A7EFF1E1D, 
-0x94922091B31A36CD, 0xC4329D25, 0x7C42DAE5F80CAB4F, 0x9C2A4715E73D94D7, 
-0x6E018B9A66107C63, 0x9E1D92925C30536E, 0xC6E9ACA8A1C2C34C, 0xAE58DE5269361613, 
-0x4529C5F61C4ADAB9, 0xA51A371B8E63D108, 0x9EE9EBC9ADC344B, 0x1AEB85D83, 
-0x9F57BC3CAB6592A4, 0xE87CCCF7D4B574E7, 0xDE75398B57A3724A, 0x2F3FCD7E0387924, 
-0xE09ABF220933A527, 0xDD380A50B06E1A02, 0x7162727828D6E828, 0x914D55F31C1EA62A, 
-0x285665991C75E8B4, 0x5E4E9B0D, 
-0x3A5F5A6A7733654E, 0xA08845BF36DA978A, 0x90E8EE45071B6AA9, 0x340164065E589E98, 
-0x2466D580D31F4085, 0x928F6259E9177644, 0x1AECB5DE7BEF0442, 0x96BBB00BC706695C, 
-0x95D0850D797E7055, 0x1475DA11B, 0xB2D76D21B81983A8, 0x4559C330CAFC40AB, 
-0x855F029ED94EF1F5, 0x18C4A40BC0B48A37, 0x3299DECA7112C3A0, 0x6DBE602DE144F510, 
-0xBABD8A5CDB8E71A8, 0x70CF927BE38A9DDE, 0xA980662930D4135E, 0x5E866006, 
-0x427956D4ABB19873, 0x47C4D15E1441F3A5, 0xF56282928CD58B99, 0x9473D06C1ED67158, 
-0xF42CDB9E29786F0F, 0x71F064C1C7217363, 0xF329CC46081B7F7E, 0xD89633EAA0186BAB, 
-0xA58889B0533B05CA, 0x1636D7E5E, 
-0x24B233EBDBC0B54E, 0x20BBC894702B0037, 0x55475A523380819, 0x5C09E41D6146CB62, 
-0x2C1EA76D464232B5, 0x47660F9AE73A0F91, 0xB75DEE739A97A8BB, 0xBF9C7B46A863EE20, 
-0xE6F849D72ED6919A, 0x1866C915E, 0xAD197FE7315524D8, 0xB9C7AB92BB86D17B, 
-0xABC18F04381E9C86, 0xE52D0A570090FF15, 0xAEA1003EE6E493E, 0x3B2C6D5090FE7174, 
-0xD34825CF44649996, 0xEFC8E0EA31132D13, 0xD10C6ABC8C10F643, 0x1A049E93A, 
-0x3BCBEDE817C26A11, 0xC484E55030D531B, 0xF3AF6E4DB8AAD1F1, 0x21B50A17D64DF, 
-0xC1B7F56A4CEBE48, 0x552155451DD13819, 0x89421C19ECAB45B7, 0x31E00B4B6030FD04, 
-0xB34D7E64210F9761, 0x1AF547F0C, 
-0x5FE7B213341AF79B, 0x4F0153F41C9AC450, 0xC51756D569EE5CC5, 0xCE6584653CF8B9FD, 
-0x83C38E77FDF8E53C, 0x4E2429E53CE39F6B, 0xF2C311879C1F4626, 0x934D7996D943D108, 
-0x3DC92B46ECF273C, 0x160894D35, 0xC7496A34C54A69C1, 0xE687C147769EE6CC, 
-0x6233E333807F2CCF, 0x4503A1375B6F9FD2, 0x3C36CE61A518BBED, 0x20832B7B03237A8E, 
-0x24903CA274D0F9FB, 0xCE81A761E7654968, 0xAE95F23619BE14D, 0x272274F4B, 
-0xAEFFF4AE687EB346, 0xF55849D9893F1FB1, 0x5EC072E6294CEC0E, 0xCCE919DB1119695E, 
-0xB3FA393B9F646F51, 0x6DE6A4A2D57DA824, 0x7B1B9EA7A40C1920, 0x8799ACE77AB18A54, 
-0x3F365313EB0A7BF0, 0x51BE0BEA, 
-0xD4150DF1C55BCCF2, 0x631D325F125530AD, 0xD86548A2C81232AC, 0xBE4AEFEE8E3D323D, 
-0xC864D8483BD17F6C, 0xEC3B8687E059CBEC, 0x6C8850121E92F92F, 0x545A14E45861AAD6, 
-0xE51F9A191920E0A1, 0x1188B86ED, 0x56474F4E30EB1051, 0x54C4F5392F0A70DA, 
-0x9346161D043D5393, 0x3726021241909CF3, 0xAD72551C1A164035, 0xEFF9D0BB3C1441D2, 
-0xF94D41E52A4A5A26, 0xA545952B704B99A5, 0xB4FC0CB8E240924A, 0x17E34A204, 
-0x5E9526CD23C888A5, 0xF50C95FF6D95E4C6, 0xAE84916960908E6, 0xC94E7E059E4BCB12, 
-0x61FCA81E093B64DD, 0x1529C19F20E58F7A, 0x93D7BF98A96C56A9, 0x95EFBE9195F45F3B, 
-0xBA00FA3B1F788F73, 0xFAB3E5F2, 
-0xBC442DEBB32C8AE6, 0x8BF2C4762CCC2BCF, 0x496F60865C5418DB, 0xEFE1BA45AA35F196, 
-0x6EEFB0BAA525C68C, 0xF3BAE53E0DA5BF38, 0x765587C5B6693ECF, 0x32D37A2722E4568B, 
-0x2397635A063B27F5, 0xB4C032DA, 0x3A9BDD4FE5989846, 0x3080A9E2F8801710, 
-0x9F42B567E019AAC9, 0x205B834F28E9CC2, 0xF9062EEF8C6A1F5B, 0xBDEE5A00102209BB, 
-0xE085402B69E250CA, 0xE622644CAF428AEB, 0xC5057816357D16C8, 0x1A5765E01, 
-0xE26078C2ED155EA4, 0xDF2859CA98C3AD89, 0x4254220854B18114, 0xE3372C6AE091BE63, 
-0xE4360B29D0B69A95, 0xAD76226935E055EB, 0xD252E3F2E77C853A, 0xCD66EC840639254F, 
-0x516F8B3988B6BDD9, 0xAAA9671E, 
-0x4366CE3B42FA2EB7, 0x336712D6F6F59BD5, 0x8419EC6DBBE91D0A, 0x7AFDA416D0BCFD0, 
-0xA52FDCE86278EB37, 0xC4235F50EE6EED25, 0xD9D42238B4C5C60B, 0x1A6A48836660694, 
-0xD7385605BC32A6B2, 0x19008A29B, 0x4DF7267B7C0785A8, 0xB9FBDA2625E22DE0, 
-0xE01662ECE63F1CA1, 0xA5DCB291A3B1A633, 0x2340A712CA01F6D1, 0x6FA1CAC562F795B9, 
-0xA85E1E918A918F0C, 0x2757182DA994A9D6, 0xE2C1A4505535521F, 0x5371FA6D, 
-0x5E7752CE1DB4B066, 0x2A9F9BAEB3CD3085, 0xA391379DCDB125C9, 0xE9EED19F1B3BDB98, 
-0xC5625CB45A19C304, 0x963816A040055324, 0x442D23E00E570DC2, 0xD48E13AD2301AF37, 
-0x43BD073330E396D5, 0x25635485E, 
-0x863E88C2D5BF343E, 0x172C4D2B3EFA49BE, 0x251B263CED192E36, 0x30B02EAF757BC83D, 
-0x80D33013CE2845A8, 0x54CB1E91635C633E, 0x8FB8C0538B25A0F6, 0x2A32D47928349720, 
-0x3C9D49E97120BC02, 0x20D6C2C31, 0x15D6BFFCF5D25BD5, 0x442F7203ECD95FEE, 
-0x71C1029F0B0F63EA, 0x9BED40E0DA1EDA2F, 0x45328FC33FDCF661, 0xA1E5FD135ABA7B1A, 
-0x99E3B0624ABF52CD, 0xD5120A772D03DD6E, 0x8055F6C1A801357F, 0xCEBBAD39, 
-0x152F85A6C899F4EF, 0xEF1ED0F996E25C15, 0xEBA2E6CDBF977FF, 0xAC354EC3162409AA, 
-0xEDA47A39C1A8DBDF, 0x2682AAD7B2207815, 0x896E8756B93E6289, 0xB83C69449CD6F7A6, 
-0x4CDC0CBF209D9BC8, 0x11EBC7927, 
-0x7D01B073C0584D75, 0x44E73F75D4CF0375, 0x95E6744ED42C0BD1, 0x9178D1B4BB159A98, 
-0xC035C8837A7EF5D1, 0xA9BFABBB2357A6EA, 0xDF7A35835F4CD796, 0xBA89DDE6A8E7DDAD, 
-0x1B944BC5C6CDF3A, 0xC3203EAB, 0x7E9ABD0BA1DF246F, 0x865F8575B71EE978, 
-0xCF0C3237152F74C5, 0x26D369BC71A1AB8, 0x2918870347DD04FB, 0x3592A50B937A2654, 
-0xBED8F5FF267ED270, 0xDCBD099DB1A22FFD, 0xCAF84DC95B92C7EF, 0x11E865FF6, 
-0xA651A1C9CA6F7D78, 0x8C736B3234B0A5DF, 0xE54DCDD2B55D3FC1, 0x36F80B677FB9BD3A, 
-0x608B13FB9937DD75, 0x2EB707FAF49AF005, 0xF61BB79E1F80CC6A, 0xD838C155BBBEDA9F, 
-0x786FEED53CA0238D, 0xA9BCFC08, 
-0xFBA2A48AE6168DA3, 0x6A1BA6F25A058DB, 0x31E40F37C229B28, 0xA280995517C343BB, 
-0x42A968FE2BA9701, 0x57CD53947532CE3, 0x6514BFCB49A30482, 0x99BACCEE97C93545, 
-0xD06C95CD982310DE, 0x2006B0A56, 0xBAF4B55D31FC6F33, 0xC607154F0BA7A265, 
-0xC7426718B4ECD088, 0xBF35EF92A14796E6, 0x9D36CA1ACE87388D, 0xC218D62C82A83F55, 
-0x1D85E0A398499366, 0x6B9F65B8F406742D, 0x20A88A0A3781B23C, 0x16565C017, 
-0xE80924F974E7822D, 0xAD403100D8CA44B5, 0xC46BCA8136568060, 0xA352A69812843D4, 
-0x3CFA0FFE323CE7EB, 0xF6038C7406BB0AC, 0x6E26827F47FF9410, 0x6AE30394893EA16F, 
-0xC7EFCADF0F3F1BCE, 0x2290FA6EB, 
-0xBF62BA2C18BE78C9, 0x9E14A8554041CD44, 0xC850860D9750E5C3, 0x8279472D09B512F, 
-0xAA10817E85B4F67B, 0x50E8A7E67FDBD4BA, 0x9C04DD40159EF768, 0x5E8D63692C7E6C84, 
-0x628D58D20DE47767, 0x52034050, 0x279B9852E9BBD93B, 0x61DE68535DAC4B66, 
-0xFE5EAB5D16C1733D, 0xF862257EB45EB8C, 0x688A1B699D0FB1B9, 0xB0F654AD86CA60E7, 
-0x72714B2730F1B11F, 0xE16A98C34D843095, 0xEE9BCD7ABC9C953A, 0x109FA5985, 
-0xE25B812CDBD92E80, 0xFBAD5318C0881434, 0x4CAD8B6A718E7AF7, 0x2C9DCED4AC3255EC, 
-0x1706E4D4AC18C87F, 0x393AD0121B330D01, 0x20A933A6887A6F87, 0xAFE37E41AA48163C, 
-0xC99D481B2381B362, 0x1EFDEDF2C, 
-0x17E7F3B4B8BEDE18, 0x58D67D1B1385C00, 0x6663DC6AFCC228B8, 0xDFDC21E1954A7311, 
-0x86B4D1C5960F5309, 0xA140E60A0AAF962A, 0xF0CA0342BD55A4C2, 0x255FC7713E83528E, 
-0x9DDDEF0058F69C4A, 0x12ECA2CE6, 0x96E74276EA1237ED, 0x8B5CA0DACDB9DF7, 
-0x9647F6ADD783892E, 0xCC144A3585638E76, 0xF211790643F0902C, 0x20D73B9BC202EDA1, 
-0xD6043F5FEC122FBE, 0x39CAC058039D5F9B, 0xE39FC27BFD654FC7, 0x133C1AB44, 
-0xD916033A6D3163A4, 0xD0AA7D7807A3C7E0, 0xA9F5B90C43FBEBEA, 0x553C82DF15E645D8, 
-0x4F6DE395C568B7F3, 0x5396C293FD78150E, 0x19F36DCE6F18B285, 0x57349DD99BD7A32F, 
-0x133D31A708FFA348, 0x19118227D, 
-0xB85DC818F0129B66, 0x6B610AB7E44ACE62, 0x77B4FF83FE0A2D0, 0x3C4AF8AC567C85C6, 
-0xE8061E1380BAF7F1, 0xC6E96F180B321B4E, 0x4C202D74B0C27E97, 0x8679D62C53C3B7A5, 
-0xED9C52D5C37BE791, 0xD5CDFE67, 0x10073F783575CB32, 0x6D4F74B1AF89FF43, 
-0xBFA430797D414161, 0xB1127B6944A4280B, 0xAE3C8502743AF788, 0xDE9D333EBA6B3C3F, 
-0x9DFA3BF43D77EEED, 0x29406607D9D90930, 0xF1407DEBA7A2A2, 0x2CAA7309, 
-0xF9ABF7614AD90FFA, 0xA3411EDCE7550977, 0xAD5FB7FB8816536, 0x31C82446AE55FE7C, 
-0xE1283CABB6B99152, 0x553565BEDA54BF6F, 0x3DA93158030483D4, 0xA146CB75B96E16EA, 
-0x1CFC62AA1D834285, 0x1E69E2691, 
-0x748F60535F403FF5, 0x94347B0698AFAD63, 0xE39A0473A7397265, 0xB26BF77DD8C032FA, 
-0x625F244D701EC78, 0x25C9FFE4C8BD15E9, 0x8C6B5F178BCEBE0C, 0xD1D2CD4856133A5B, 
-0xC7490F8DAB28DE92, 0x14F46BC91, 0xEB8EBAD2E1684783, 0xF142938C165A3B20, 
-0xA9F16C57AA851C97, 0xE48491FF7F55A8FA, 0x1F558FB7EE1438BA, 0x90F29422FE332605, 
-0xF900C4BAABEF8FFC, 0x8C3DA20845D61A70, 0x78CEF4C7F6B4046D, 0xE7491B2C, 
-0x8ED25B4213D04A58, 0x7A3E0DC032D8F7FD, 0x53E1E3CB4C985AF9, 0x77B95F096EBDF4D1, 
-0x97361390DDFDD030, 0xE91BFFF9B96883A2, 0x7B6B038BE64A08D6, 0x3BB100493A8BB068, 
-0x9190525C8B80DC95, 0x1E8540D26, 
-0xC79AC9BEF33C807, 0x4B5A28C9704D0C4E, 0xADE397E248E5542E, 0xED9C48BD7649A8F0, 
-0x7DDE31BE168E023A, 0x8389D0B04519F922, 0x14D4027C1F9AAB7D, 0x95CF646B940E2C2A, 
-0x54A488C99BC10908, 0x1F27CB5B1, 0x6064ECBCF47C9E1D, 0x50C67A346D47EDA7, 
-0x80D93C51027193C7, 0xC1FBA63D5F5EE8EE, 0x2D9A648262017D4B, 0x7AB29C4EAB9CE0E4, 
-0x42AE27A506058CB0, 0x54082DC43022F547, 0xB8ADB8418825B8C1, 0x21CC3D136, 
-0x479A8AE6655CCFA2, 0xFDEB15B8F97B18EF, 0x19C8A6EFC23CDF52, 0x112B2ABABF277992, 
-0xE89F7DAA1760A002, 0x26661C4192305AF4, 0x94A7E246CA1659BE, 0x59B41E00088CF192, 
-0x72C55397708C4DC6, 0x1ECE08850, 
-0xFC0ADCD2CF41E73, 0xB1D4EE8610444EEC, 0x50F71A717EC5AE86, 0x4E574B4A06C26872, 
-0xA8AF4CE5D25BB92B, 0x69A451856DE88D71, 0xC3F6C1B8FF00EC6F, 0x1F5050A6332E1154, 
-0xCC3C19CE5AEF936E, 0x1D0AD35E3, 0x80F95C4C5CC2ED6A, 0x55669C61257180CC, 
-0x4E2F9F5BE2640E89, 0xEB190BC136371433, 0xBF8C2261B1A6EF0D, 0x6A878A43D80225A, 
-0xD0CC17DB89591BA, 0x61C8F1F3212514E5, 0x4E5F6A395F405A0E, 0x19818DCE8, 
-0x51C5453A41DF4A49, 0xF8884029750BC9B9, 0x1C311F83BC7AAA97, 0x205A51032097B453, 
-0xB36D1DED1A4B290A, 0x4F0CAE27775FBB80, 0xF5FF1ACE062EC87D, 0x4AE5BD531FFB0EA9, 
-0xD2D27CD015D0A77A, 0x2758731AE, 
-0x24AC8DA2726ECDC8, 0x6CF412699688DC46, 0xE828BBA256AF6974, 0x96E51EC0D5021919, 
-0xB172E34A3A86609E, 0xDE23EBC2114E9171, 0x38FE0930A1D01537, 0x7C23C9A029F8C29F, 
-0x2D1CB4D76590B658, 0x9686BD3F, 0xAF5FCB350AAA23FD, 0xD8FA9ABF12E501CE, 
-0x6B33F27286D8F7E7, 0x807E4D064553010E, 0x2F816A0A25C603FD, 0xAA557BA0BD34B23E, 
-0x8F98BB5DA58533E6, 0x76F222802633C16D, 0xBD39CDE7D8056B6E, 0x30F20B39, 
-0x6213571D121AAA3A, 0x8E3EC344FFD9B279, 0x64A54FF866DD44AD, 0xFBCA3604FA3F40BF, 
-0xD03C8F6739CDE7D0, 0xA4151D95809C5F9B, 0x57B2942FFFC21AF6, 0x58CCB1C275CF6491, 
-0x92A4D8E74F5FAE5B, 0x1C02B24AB, 
-0x651D672B51EF06F2, 0x62D6919571D3FABC, 0x565ACAB3E2F320FC, 0x4206313D5183868, 
-0x37399CF1DD81AAB1, 0x9FD17EE44BF99021, 0xFEBED91555FEDDAC, 0xE8C41D6B4C6A6B1F, 
-0xAED4E95BEB5BB87B, 0xCE98A4E, 0x3CBBD41EA34D9A19, 0xA06DE2909F7FD973, 
-0x42EE5B6B331DAEC5, 0xC8ED79A1D061607B, 0x998AFDB82CDDC73A, 0xEA8E8FAA4749E49F, 
-0x47DF73418F22AAC7, 0x4FC3F7AFAC9FEB99, 0xA0DC480058C6827A, 0x6EBDD05A, 
-0xD62B40C6824CFD4D, 0x1051EB18202E7B67, 0xE867FAEB2739EFD5, 0x7C0CEFC46B344164, 
-0xCAB61A02ADCA9C19, 0x93F86DDD22F09AD0, 0x7CC08E51FA237F03, 0x79A049DAAB20CA7C, 
-0x172346517B115439, 0x19DE6B7F4, 
-0x9134B0FBB8B51E08, 0x8C9C0D85091CC496, 0x811D6B8699238F80, 0x9AC1BA644139C123, 
-0xC99F7DC4275BBC59, 0xD5A132FBA86124AB, 0xF8B4AEFA8D14688, 0xDF091AE23B40105D, 
-0xD61AA197D1F789E0, 0xF23AE761, 0x4B879A61DFE2551D, 0xDBBF7A016A6C3D38, 
-0xF2DC96196677DB04, 0xBA60F72816AF8C6C, 0x1B04C7116397AC71, 0x978527FA2981C878, 
-0x51990179D749A5C4, 0x7282A2F652778C48, 0xB9F869F5FD2C7035, 0x19CF27EC1, 
-0x50F556763F280194, 0x599948EB510621A, 0x956E88EE6C6A0EB, 0x9B1819292784EE8B, 
-0xF823215EEB675B5B, 0x664F28FBE2590B2D, 0x3407E075180C872D, 0xE767F04EBB85D75E, 
-0x2EF20AD130018C31, 0x1609C93AA, 
-0x529EAE00117A8790, 0x2D53D58CAFFBB664, 0xD4648A39CE9F0B1, 0xFD1768827EA85BAC, 
-0x31C19A87DA27FBEC, 0xABC84CC4E638E768, 0x10409ED481C44AF3, 0x617992F5DA1A9989, 
-0x74659198BA103D44, 0x2E5DBE41, 0x9B496524E60C320F, 0x242522E52F6C45EC, 
-0xC88A335EC5F5E5E6, 0x30D08C495E0E22C3, 0x38DF8379EB5FF5EF, 0x200E17B913C58385, 
-0x75B0A171256620B2, 0x747B8D7C6B9F2355, 0x6E3DEAF6D7E653FE, 0x17E894227, 
-0xFE7E69F3E31CFEC5, 0x2D7F86F6D536D650, 0x691E0995A0E21D18, 0xD9F682BE800050B2, 
-0xD04E6C60D04F10E1, 0xB5230F6C892E5C52, 0x20791118DF9C01DB, 0x8BFE5DC1AC94750A, 
-0x59B1BA43D2828D72, 0x22C45C1EE, 
-0x2E3CBCE0BC4F3E1E, 0x408F734585F0E866, 0x6FF2C9A26F2CDEAC, 0xD5D05A16782D2AE7, 
-0x2B693CEE43CE83F2, 0x704B3A3CB84DAE77, 0x83BE7A828FCBD146, 0x63FB1F75C08B14F3, 
-0xB915851495E0B993, 0x893A40CE, 0xE050E59C63DB4969, 0xC06B27E362DE2903, 
-0x9D8E4B9A5D1DD5E4, 0x184708AB02ACDC47, 0x12DDEB8EABA1E615, 0x56683AA8398708CE, 
-0x6F7903E43BB42460, 0xABC8C9064151040C, 0x8E2AF28C388EFB82, 0x112E4DBA1, 
-0x53E4A5D3CF5D7066, 0x90F766F4ECCFADA1, 0xE91CB83942A2A142, 0x33714AFF6E84AD44, 
-0xE9DBF158FAE19D5B, 0xCB58D27F20A9DBA, 0x73FB31B1D7E1BFD6, 0x7BC0F7BF92C91FC1, 
-0x5E6FDFA15A336AE4, 0x8863273A, 
-0x5641C6F7D6CE8B28, 0x5A0C83EFE38734A5, 0xBBA5C4D2DB6BAE55, 0x12723AF4E6D3BE49, 
-0x585BE75E40AD7FEC, 0xCA917B4BA95E1E5B, 0xEB4DFBCA9A55B3AD, 0xAE582BEC2ADB318A, 
-0xC4EA99D0F85E848D, 0xAF0CC109, 0xABDD938D5EF9CCA, 0x913357492CF7308A, 
-0x7BB0B98CAD7A1695, 0x2AA95026460DC227, 0xD9A34EFAD0DEC2C7, 0xEDA8F5DB1D4B4D0B, 
-0xBF9040BCB89EC2EA, 0x504187E7FC809ED6, 0xD7D432679D606F44, 0xC3B70388, 
-0xFC87317610BCE606, 0x7AE44C57EC6C3BAC, 0x148CE02841F874E9, 0xFD67D194583A51EC, 
-0xB08F35CB7EBE00A8, 0x5F562D5B224AEA77, 0x4A7A9D5B27EF1A28, 0xA20DBB7A0203296, 
-0x930EE688094168A, 0x1C9ABF6A8, 
-0x7012C8A7CCF2679D, 0x76FE38675C40CD1D, 0x5221A4E37548EDCE, 0xBA7482D1567D3641, 
-0xF509C8FE8E99610D, 0x90A29632A1A8CE0A, 0xD634818D6C45D25E, 0x8A4CA2F0486F804D, 
-0xDA0D08E529633DE0, 0xDBAC2573, 0x35E644918AC4733D, 0xAD12666F2F13E7D6, 
-0x1F620C8FFDF46E90, 0xD1CDA633122E44DF, 0xE322ACCFD2AA96A3, 0x712A77977F3243DD, 
-0x152196819DB40EAF, 0x36E803E23DA3ED02, 0x887571C96B5E9958, 0x212832427, 
-0xD5B32FA60EADB644, 0x358DE1D8EC2BBBF3, 0x534945C674D7B36B, 0xBC8DC1E5EB3033C6, 
-0xA26D5DB45CE8AF1B, 0xFFC8E34B8F80E19D, 0x7A5309BB24757D84, 0xE9E30C3B6CD0B187, 
-0xAB6F9CCAA2323C8F, 0x3D19520, 
-0xB62B4BD9C6322929, 0x53CF77A23EF34FB3, 0x9E0147DE5EEC1C8B, 0x4D4DCD975D3DF301, 
-0x5F746680E84CA2A0, 0x251BF8833BB9AE02, 0xBF1762E27F81A265, 0x69524423916D463A, 
-0x86A9E510A9E61735, 0x6FF37D16, 0x8AE361F8EA80316C, 0x95E3360DEF412F18, 
-0x3FB96C289E6B008C, 0x2B98F53D77C45502, 0xD005C80EEC613F84, 0xB4E7BC006B9EA3F9, 
-0x4B4A0F406F0A3A51, 0xBA1EC59C5DDBEC7E, 0x2E4CB1D6A42C1490, 0x4D850D12, 
-0x56AD5565D875ED0B, 0x619E1297385A3647, 0x74B1E2A32F15D73F, 0x120CD99071332974, 
-0x6190EC26947C629B, 0x6B9C9D423E02E924, 0xD762AA3AB078E15C, 0xED6B6B039E964AB7, 
-0x2126EC8AE734ACD7, 0x1AC1E6CE8, 
-0x237F999C0C4F7FE8, 0xD780D9B64C427AE4, 0x4ACAEC69B86A906A, 0x44767689BF1FDA32, 
-0x79A2438ADECEEB9E, 0x88841EA95F2D974F, 0xC86E0CC3EFE40820, 0x87D3515C9480BA9D, 
-0x43F8D74B95EB734B, 0xD9055EE0, 0x7AABD88B63C6FA3B, 0x89F8B188B0AB7963, 
-0xB4FCAF191582B566, 0xAF89A8519C47E629, 0x3BE7BB6C3AF059CC, 0x96B7EC8A27193A89, 
-0x2B66FC64B54F3EC2, 0x3881DD888D547DEE, 0x9A32EFEE7FCAC53D, 0x11EBDCCBB, 
-0x5A977A8A7E794E5C, 0x390A554AE58810A4, 0x79021C8103056C44, 0x750A8B8A7EB58941, 
-0xD37F2D35BDCBC541, 0x64A24E44ABD4B2EF, 0xD9D3312B989E89D2, 0x269763AD1AD0F7E3, 
-0x4311C85AF7C21948, 0x246E08842, 
-0xA729AF33FCDADEDB, 0x4EE7BD147AB8D912, 0x794DA1649FBF0176, 0x12B84C1077DC133C, 
-0x141608E9B8FAA47D, 0xB71FD3276B9614B2, 0x9F13B6D4E48B4AAB, 0xD423B90A43883382, 
-0xE66766C675F3FEB5, 0x11662BC20, 0xE84D20A845B11C08, 0xF71FDBE1E5D19962, 
-0x90757401BFD130FA, 0xD6003BB643C15C48, 0xF190DBC875FE85E6, 0xC201A31871C7C588, 
-0x806A45CC28A8D3F8, 0x8FA1209A564BEA58, 0xD7CB71234FA786D9, 0x738446FD, 
-0x99E4024CF9EB2DBE, 0xCBBA14998E75DE78, 0x377C24D53DBF8056, 0xFFEAA75DCC9BFDD3, 
-0x537B008E1B7FE6E4, 0x47F1EB54C26B3AF7, 0x66224FF1997DD4B5, 0xFDACE9E923145010, 
-0xB62CFB6B8CD95D75, 0x154406ADE, 
-0x90663EDA95E62E42, 0x4AF5F03E8D57C349, 0x8419C661620B2B, 0x5921D65A2CA8E658, 
-0xB418731F901B2D40, 0x245A4678A1866406, 0x927E1D76E0CAAA09, 0x50DCC6794305E297, 
-0xAFCE165A98F0E279, 0xDFD6BDCA, 0x71C5E88387948BF3, 0x8FEAFFD1DE08A6D, 
-0x8741DF9275281522, 0xFE6C067F5A001E7, 0x85B909C9601AC84C, 0xA3AD2CBBC23A48A8, 
-0xB2EEA69C66B4AF93, 0xFEC1756CCC9BDFA7, 0xCB990CEFF9C801BA, 0x14C58A4C4, 
-0xA1D854132949F22E, 0x647F1299B142D930, 0x7F00B5160820F28B, 0x313F3A120628E85B, 
-0x52875F305710C189, 0xF43538F5837ED403, 0x920C3C2C449E4AF, 0xF53F284C578BBF4, 
-0x379180AB89B6AE4B, 0x153C026BF, 
-0xD007719EE7E3ECC3, 0xD7E89C1827E76B5C, 0xC1A6557442E9870D, 0x506A574D3A86FB32, 
-0xFCA552BC48502FF0, 0x334A29DC4934D40E, 0x32DCCB13A112A2E3, 0xDCFE86B684ABC2F2, 
-0x467F6D747A73FB2, 0x6CD206A8, 0xE3D97EAFFB665480, 0x4BC0D72F8FD2DA2, 
-0xCA43F6120FD578F9, 0x2D95DFEFD4381B53, 0x3E7323E06C9DCE95, 0x322D85DF6B26FB11, 
-0x9919136624172588, 0x8CAADEC802FE99DB, 0x455B9112D668F2FA, 0x1BA64DCD3, 
-0xB48A1CD59A477E21, 0xE207D84621ADD56, 0xE03F4954B044169A, 0x7EF31082D88C7496, 
-0x8E50A72505127E68, 0xCB69DCC67C41578E, 0x342DDF7DDE268A40, 0x672F196CEFFAA2B8, 
-0x19891A5EB0F23B53, 0x255EA1CE0, 
-0x21C8E116B9E46E90, 0x525B35302EFA2E6B, 0xC11191C7F877DE8C, 0xA891316C341BBC9F, 
-0xF634034E38C1B962, 0x58305F57055AA1C, 0xEF57CD45912C36D, 0x6D95ADA642D8F57D, 
-0x8992D6791DCD83A, 0x19BDBAF16, 0x3349009A9E07DA70, 0x389BE2F2BCE58684, 
-0xBF4E4AF546DDC5B3, 0x83E80A16A55EEBE5, 0xE1EFE1A0323A7B89, 0xB65DBFB88B86D5C5, 
-0x75762918587092D2, 0x2AB5B8B3ACBD29C8, 0x6EB19F0809F1877D, 0x6A8428CD, 
-0x15EE6683571A240C, 0x512378DFCCE7D554, 0xD64E27B3DBB7034B, 0xFC22F031A447B88B, 
-0xA7D691B447670328, 0x6D109BC236E595A1, 0x618F80D49C98A674, 0x8BD900E44B76E8C2, 
-0x107EBC254A7D6D3D, 0x1B10AB10E, 
-0xA99D346638862BBC, 0x7871CE18ADA0ACE4, 0x8F50624CF526FEA8, 0x70D279AF727160EA, 
-0x7D8B251446E79FB, 0xE7BFF565967DBDD5, 0xFCF94FC7900BB93E, 0xCDCD3C6B090D16FF, 
-0x8B775921BA11A181, 0x1E282A82, 0xA9835AED73773E53, 0x591E90BD95CB09EA, 
-0x8DEB0D504374FCA1, 0x69FE0C86C56B48CC, 0xBF5880F4D05E3542, 0xE92F7ED6D6BDA48F, 
-0x5E880655FC0A3554, 0xF6C27C8FEE2E7F1C, 0x7A5A1D9ABEA0B4AE, 0x1A1052DD7, 
-0x55479A6090168293, 0x601071AE0EA2CED1, 0x64767638052F100B, 0x474F84A5287B4F43, 
-0x4EDE313451E66632, 0xF113D38643AAB59, 0x7F37ACAAC9EA2965, 0x323AE7D3A9B40876, 
-0xEE6A5B591683E6B7, 0x952FB7AD, 
-0xA3EE39090F950CD2, 0x6DFD1290E77EC884, 0xD05B2C7851276F7D, 0x30C17C4CA505E0BE, 
-0x369AB41BF70872FD, 0x45D44C40BD4D2A0A, 0xAD8E4DABA938B10C, 0x7BFE0CFF9661CC6A, 
-0x510801F0AD3404BA, 0xFD133936, 0x9E12268E1E720A1F, 0x434ADFD28008B0E7, 
-0x86697D7FB887B715, 0x86B6761D883572EF, 0x7668379F10964B55, 0x8E6A1983DE0F5E08, 
-0xC3E64C7520DEA89C, 0x86A6854F318D50A3, 0xFCA1AB7C2DBE4C58, 0x1A0B13891, 
-0x1F3F4472FF076E67, 0x5A38D26B8085EE3F, 0x19B221875AF7E889, 0xA61044ADE5C655E6, 
-0x12265291594E6122, 0x650229A92FF072D4, 0x6D0DA4B310726245, 0x71C72D5F00A8EE8D, 
-0x261942662791C556, 0x187CE8104, 
-0x25AE87FDFF29E9A2, 0xC34DE7B2B7758EB3, 0x59838186FD31963D, 0x1681ECF8A2E8D1F1, 
-0xF78F7939B07714C5, 0xF9E64444341C5B59, 0xC31E8CEEAA8A27B0, 0xA624933DDC518514, 
-0x38EF90E228AC89C2, 0x7D3F0849, 0x564B722B321B18CD, 0x852E5D36DADED34F, 
-0x31B66DE94E464284, 0x213BA7C2C9113C10, 0xF59708B7D5F959F4, 0x1FAF1C3C66365D4F, 
-0xD102E3A3EBDB6D2A, 0xBD91CC421E8304CA, 0x5DCC53C4166CFFEA, 0x21689E259, 
-0xF02A4955E21CDA34, 0x256BF52392E40BB6, 0xC642E9FD5D5E98A6, 0x4530D85D8B14E6DD, 
-0x64F4887E8D3BE7B, 0x397C2CCB8D9579E3, 0xB8C01042F6BEA89E, 0x50BB0B276CBBCF33, 
-0x78EE9F1497E8D793, 0x1EFACB660, 
-0x8BA42D997B6221E2, 0xFE4BDA4703F7B71F, 0xC477C5FCF4E4D959, 0x4DF660409022473E, 
-0x748994FEDB69C2D6, 0xB71CE0B445B3099A, 0xED0801FD61F25783, 0x1B1CC0FDE0638174, 
-0x6309E78EB6A37C75, 0xC2847FE5, 0x40D9FA8EC0DF5F82, 0x7B64D7045BE7D224, 
-0x8C80DCAB39910FAE, 0x43075F89C220926C, 0x9289FF549A147D07, 0x92D68C65E1C17CB3, 
-0xAD8CAC731C75419C, 0x53FCD1DA5C5D9D00, 0xB3467905A227D7E3, 0x54DD387, 
-0xA66F97053E5B3944, 0xB43E9B620AB6944E, 0x49E98B434DF7C13C, 0x73136BC3F65B6C6, 
-0x49C50078669655B6, 0x80B5C22126D16179, 0xD87EEB065319B335, 0x7427F75075C6D724, 
-0x1BAE752C034BAAF4, 0x6A80296E, 
-0x13EB960CFD87971, 0x3AA38066E35147EF, 0x6F4CB4F36473B10, 0x3109BCC98CA49DDF, 
-0x48C47244CA01E6F, 0x133DB712BBA971EF, 0xB7484967428F505C, 0x67310FDF173C8DE2, 
-0x10E32D749F98FB97, 0x20813910F, 0x6426F485A4F713E6, 0x431C202F3ACEFF62, 
-0x5150676E30A03C7C, 0x4E00E7E77B909C90, 0x81B66E2F1B61AFD8, 0x95288474033EC5D1, 
-0xC2C633B342D6DED5, 0x7ED7386990A3469D, 0x70E8848D4C6184C9, 0x17EBF30E0, 
-0xC37330C94FCAE687, 0x7E22C702DCD710BC, 0x48F1CEB4F8EE1D93, 0xB2FBC97FC3C15612, 
-0x28994EF33E23D58B, 0xBE568E33E50FE154, 0xE09EC3A82099B1AE, 0xF83B10BFC3CC8B2A, 
-0x16705EFF489FEDF8, 0x271842F08, 
-0x414EEF6AF655DC81, 0xB9D302DA9AAADB56, 0xDCC24E265AC69DF, 0xB4F7EC8D1285572B, 
-0xE506392E009C8C62, 0xAF49E8DA1CFAA7C4, 0xF70EEA7DF2211F50, 0xF01FB6AEE768AD34, 
-0x3529EC05B0519F1, 0x5C6CCBB9, 0x3CAF15C4F6BD1433, 0xBCFCADDC5A9384B, 
-0xEBC5427EF90710F9, 0x7A379CD22FEAC64F, 0x9B6CCF9A9523721B, 0xF3489E4E94059FA6, 
-0x90BF1E11DAE2493B, 0xBBF1F59BDFA0288D, 0x24CC81069A0AFAC, 0x24FD84861, 
-0xEDB57DC6612892B0, 0x811962C0BF107C3E, 0x45A04D53F981E4EF, 0x15E0F0914B240924, 
-0x423ECB467038F10C, 0x507C59CA0D8DEC56, 0x765FB695DDB3300D, 0x49913384A6A15182, 
-0xECC91D7B5EA7E885, 0x1B491EC0D, 
-0xC61D5E23EBC70CB5, 0xB36A7CDEE9C54616, 0x9E91734048F5B498, 0xD767775323D53E63, 
-0x8D92C05895C04A5E, 0xB1448085090EB15B, 0xAB30BCF60084472D, 0xEB523463A9631D84, 
-0x1ACD375AD5DD8A47, 0xAA74E356, 0x71646D9077FFD7A7, 0x2F34BD5A77EC058F, 
-0x4578892E02BE313F, 0xA287524BB3BCDD23, 0x76CE85C6B8CC931A, 0xB3A9F6EF131862BB, 
-0x7C8B9945D5CBD73E, 0xAFECFE0B0CCEFBB7, 0x3B48045FBF169DEF, 0xC0908446, 
-0xAB1489616562055A, 0x85496DF23D501AF4, 0xAEE2CDF3A4ED7B2, 0x53F6FC1F002D6586, 
-0xCBA7743A0F1001DC, 0x1DA298D8EAA67015, 0x98799CEF8EF1EF0A, 0xBC4EA07BF9C2BBBB, 
-0xA1899FAB3F02DD95, 0x225487FEC, 
-0xAE6D486EABC3C68D, 0x60856596D6435F02, 0x482C3309FFC8A27F, 0x6103F6B018A909F9, 
-0x34B712203E281183, 0xFDD23251267E61E9, 0x55434CF3DF8BE543, 0x571ABDFEF35E1598, 
-0x6A6EC5C66EC12489, 0x1C3D97DFE, 0x4F98B6D32A7D0218, 0x7766461064A62425, 
-0xF1032B731D98530E, 0x13302CE5ED16756C, 0x4ADD31BD0918C16B, 0x23EB8023A922D0DB, 
-0xB0AFCCCF9ACF73E6, 0xC0E8F327024F6347, 0x2AA469E83AA1350D, 0x673EA99E, 
-0x7A4E985A777C1CE6, 0x5F9859077A9A56B0, 0xF18F275D4383B53A, 0xDE88CD6FA5106D98, 
-0xB43DFDF444D3B26E, 0x7F7413CE6A2D987A, 0x73820EC1297E84C2, 0x5CAA1BE785A88FC8, 
-0x9D31DC7546382E83, 0xE2958F41, 
-0x45E04D202DEE49E5, 0x295E2F19096D06FD, 0x5D86CD55AA1B59CE, 0xD202CC7F968D268D, 
-0x5FD2CEDBB49C1B52, 0xFA09A62B61FE49D9, 0x8F5079340229F8A9, 0xCE0FAD24FEA1978E, 
-0xB2DAC736BE99A058, 0x182C21758, 0x7F9C43877EB97CAA, 0x503A37E5D1BE8526, 
-0x5301D863D128C4E3, 0xE20C27CDC5AB17C2, 0x587FC5A5960C3F41, 0xF0E513928099253F, 
-0x424BC9EA45B8426, 0xFF7C17A683937C26, 0xECD8B72FFC0B612A, 0x1C4D51068, 
-0xAF0978F6DDBD81A4, 0x675BE0C5057CD426, 0xA8D695B78785C31E, 0x1B1058E7CDCD2CA4, 
-0x45C6A746E1760D0C, 0x558D64613AD4EDC3, 0xD233CF747F1DC463, 0x2F353C252ACC4488, 
-0x8E711E73D8E9A137, 0x10150F3C0, 
-0x681FC0B6D26ACE97, 0xF87F0DD6061B19B7, 0x1A7D7208DCE1076D, 0x30FA51FA243A9B95, 
-0xC70A3C4D042D0289, 0x6AF9B81F9AA13D51, 0xCA4D160C637E4F43, 0x59D01B0E9A05A95D, 
-0x33A3930CEBE5D42D, 0x16490A471, 0x5BAE40CF6377159E, 0x903E17F8389BE028, 
-0xEABEAC5D5FD132AD, 0xF80EA7970FBC7F0C, 0x93608A0BCC38203E, 0xC82972BD443C43BE, 
-0x81808AA0CB77C465, 0xE841E3EA4A5763FE, 0xA760567BF03B2CAE, 0x12C31FA74, 
-0x584D107BA49D1CEC, 0x529308926C02BAF, 0xB446D0E1E640B618, 0x3D8E929C6865563A, 
-0x4605DA48624F60CE, 0x5FDDB94D4F3CD8A7, 0xEBCC3E8921E4D9B7, 0xEE769640C076CD1E, 
-0x6E95E7453A209F91, 0x1ED1AA321, 
-0x5964219DCBCFECA0, 0xD85CC14B30AF5740, 0x811E1C4EB8F9838F, 0x8107DA262FAD3895, 
-0x2E5B9E8C16EEDE93, 0xA8950CE8D957E8EE, 0xE84195463E7AB606, 0x85EF8E3F0E4854AE, 
-0x54C45A3F0091DCB5, 0x1E50D951C, 0xDEFCEB9B2C88A58D, 0xE620DC28174E743A, 
-0xB15B69C676CD1BFE, 0x37D31E5F636FD9A0, 0xEBE0DFB2078DD07F, 0xFCB9F6D548946B73, 
-0x13EFB61C3C454D68, 0x56A059A107FE63F2, 0x2C348C4006A4EB2C, 0x55FF74F8, 
-0x182FDFDAC78ED776, 0xACC752BCDE9805F1, 0x91B6843F844BF01B, 0xDB7CE3D4A5B6163, 
-0x520BCA5AD2A369CA, 0xAADD129E6000BD49, 0x3D9553D96CA55E41, 0xB117764720443F9E, 
-0x5108FD6AA6AAA23A, 0x12D8AFCE8, 
-0xFA171C74D1F97022, 0xF60D78D9744FD8E4, 0x521FBEC9DD688902, 0xF8FA656CD8ABAB2, 
-0x76AA2CAF7C842165, 0x8AF1B049A1A8823D, 0xBB885CEB5F3C0E3, 0x212D04254E113C3A, 
-0xBC4025A07AA769C5, 0xE60C278A, 0x3274F3F6BF2E577C, 0x9DA0860030CFD812, 
-0x4F68D6E42C8DD36, 0x9F21B0225289A2EE, 0xDA34E7517BA532CF, 0xF779D36CC90DA8E8, 
-0x250840C1D3A503A, 0x91FB017061F47381, 0x19CBA81C94EE7072, 0x27043B5F4, 
-0x5124E93F6AE28B4F, 0x1220A0500A459148, 0x35528B0A0DFFBD65, 0x20A38F258CC8C90F, 
-0x97306B3D6B8497CC, 0x12480EE44450ED8E, 0x91DD222E2A7525E1, 0xE75FA795A11A24A0, 
-0x78CA301FEA58D952, 0x2348755DE, 
-0xA800118FDAB9C32E, 0x6ED5CDA9571C66D8, 0xF58950E064F43092, 0x1777F5A3FA33CD98, 
-0x4AE3FB12A90AD87E, 0xF4C97D470410C3B7, 0x8A64655D9F7E7A16, 0x2CC3D66C743F7D0A, 
-0x6A39552E83728E24, 0xF4809B43, 0xAC2169C9FAEAA7D2, 0xEF71B62A76802F60, 
-0x6A9DC4C374472CB9, 0xB9ACACC344A1DADC, 0xF12BD2E2DC150E8F, 0x45DAA911F3C243E6, 
-0xCD3125B03E48A08E, 0x592FD981509A186C, 0xFD31573457154E8F, 0x54B2B3C8, 
-0x1F178C58FE4C9FE, 0xAD309D1645297BDB, 0xA3227438360AFC47, 0xBBD76FE3B6AA8D2A, 
-0x41721A36F6D84583, 0x67787B769B9C86BC, 0x2A2C852AA88FBF7B, 0x624740AEA14B807E, 
-0xF9E51212D012E791, 0x14DDF8E5F, 
-0x510CE41EE489C43, 0x6FEF8CEAEB60DB74, 0xB62EAEF78687FB66, 0xAC53C31E820D8A60, 
-0x37DB7372B194A03B, 0x898AB599A0F89213, 0x1D88A1906470142, 0xD56A135BDF12F378, 
-0xDF3585A47A811890, 0x142E7DAEB, 0xAB83D45F6C0D5141, 0xFB351C8CDA93D1EA, 
-0x27B1CDF5EF8C3CAB, 0x20925680958C41C5, 0x1C2AB2F00C68076C, 0xB86BFE984AA18C84, 
-0x692CC4FB503D1DD1, 0x6A583A0329F10316, 0x71A4CB5C0E056906, 0x8E541B25, 
-0x9F09634FBCBFCCC6, 0x5BFA76A084815106, 0x7FFACEF3F9484EC7, 0x475797B6D4EF12C7, 
-0x3CE8392CF9DFB4BF, 0x39ACB63F5747645A, 0x504B3C0B3EC65BBE, 0x23BFDCF0C8C6CD66, 
-0x8573C37E3679580, 0x2460B4AD8, 
-0x93F92C5758C451D6, 0xDADC0188DF7EDAD5, 0xBFCE1B30D27481BD, 0x73AEFC68323BE03D, 
-0xC48609E821EE5265, 0x9D0B755ACB2D17D0, 0xE9ED3F01FEB5C04C, 0x701AD86FDB0A67E0, 
-0xF6CBAFDCE34FE2F1, 0x1940F3CF2, 0x55D03F8FCF4E11E2, 0xEBBA5D22ACE43FA1, 
-0xAAD15F9BD7A7F7C4, 0x6AC935E44D4021DD, 0x277801A013C2DA5A, 0xACB0D5CCA48CCF0, 
-0x2C260E85F7551BDF, 0x18D5D1BC1B08D349, 0x8A8A40F4DB9B75F1, 0x15886E272, 
-0xCFADC9194F51882, 0x88B5301CA8DEF1B9, 0x23ADCEA9F61493F, 0x27D32237137A9CC6, 
-0x3A1D64B088D6FF04, 0x511F51E342514758, 0xA6820D460BDA1B96, 0x7A2B824222C8D0A6, 
-0x341831F5A049BBBB, 0x194661C39, 
-0xAEAABC3751F4E078, 0x6ADCC84E334A518B, 0xCD2976FBBE48AF9F, 0xCCB6F312EB58B8D5, 
-0x6E58738C6F3EE2AE, 0x2037100E0A2A3EE4, 0xA27C3D933177FE0C, 0x10285CF92E5E1FE4, 
-0x40CA39F4618ABF93, 0x121238D55, 0x30BC85D893F7E701, 0xAC1FED7ADFC142DB, 
-0x72BB5E15F02BAE30, 0x5D9FB9CFA70400D9, 0xA16DE09700C10D95, 0x238D2FF8DFD5C3E6, 
-0x55272C592514ADFA, 0x9D10F2EF56450318, 0x3EE1A3ECBC26F2A, 0x1B7CF655E, 
-0x7B35455F72A69588, 0x591B39E80991C2E, 0xFB22040329E1DC16, 0x8E67CE6B45E23392, 
-0x3D80C610FF04ECE7, 0x5FCFF9914F8B48BF, 0x768577F4756BAF10, 0xA7F3CBACC8F7B7E7, 
-0x4259611019CFC03B, 0x18F8C65DB, 
-0x35ECA2B352729688, 0xBF2C988C531637C7, 0x2E007FA1DC2B730E, 0x6F467F8BC4320B47, 
-0x5B6985F2EBD535ED, 0xF88EA25D134DE470, 0x7E9E5E09496D4553, 0xA467919E7794F7A3, 
-0xA1C8499C85D6732C, 0x23C7ABCE5, 0xB30A92D64577BC69, 0xE128A48131F43018, 
-0x6E7BE1FC0BE8B079, 0x48A9C7EEE7EC2438, 0x7DABCD03A1A5EEEC, 0x9DBF352B59F8EC40, 
-0x709E1490DC2C25D0, 0x7BCD932070F0DA59, 0x501C3E4449EA26A3, 0xB8EAAC8F, 
-0xEA042289CE4BDEBB, 0x93D74CAA3FF06CCB, 0x85B31C3DAB13B085, 0x49EA7C4BB3714B86, 
-0x530D6118F9BA1E34, 0x4DC83F1E7A5AEA5D, 0x5ECCE408A340398A, 0xC6429268C3C9C7F7, 
-0x5A78C1C5E342DB6A, 0x1E06A11E7, 
-0x362E20599DB3EE7, 0x3DB694981BECC19, 0x3B6B1B9AF740F2B0, 0x58F90B497DB68586, 
-0xF91D5619AA7B3802, 0x56D3EBD5B6BCD830, 0x9665B4B711614F61, 0xBFF88C97489DE03E, 
-0xA666870F7A256E69, 0x23D20C97C, 0xB0097B8B78E8F5C3, 0x63797AA9A70F4521, 
-0x935154064A1BB65B, 0x5B7676072DAAD173, 0xCFE859FB5DB42D81, 0x6C0A918ECBD8B040, 
-0xE5540EC4513F083D, 0xE46F80CDEB9FC780, 0x7144BAA149D955FC, 0x2328F7FC2, 
-0x70AEA222D96715D5, 0x4EDD420FB887C8EC, 0xC374A73643AB6140, 0x6BACA93696E6FF6E, 
-0x306CBAB5B13919D1, 0xF61B66456F42ED27, 0xDF166C1BF006E9E6, 0xA29359F054FABEC7, 
-0xE8E06843F4E878C6, 0x233C8A121, 
-0xF69C249F63F60B53, 0x54C199C486D19E42, 0x8126498EB57492F, 0xEFE7DFF0D1742CDA, 
-0x5D433E1F3FF3159, 0x7ADDB12A1D96F279, 0xAD667089D1471A5D, 0x4CEDC92DB04DBADA, 
-0x6F0A1206476D36BB, 0xB55F17D9, 0xADDF2489955E7506, 0xA39B4D160FD96835, 
-0x8B64FCE9DD695C7D, 0x621E29D296E6213D, 0x854CB8F3A30FE479, 0xEBE9D7298B1D7E74, 
-0xD5315EF42D9E1D5B, 0xF55CEAED5F3B88C, 0x57C3DB8F6B4849A2, 0x1C91351CD, 
-0xFE3BBA0542AABECF, 0x792DAACB936A9E59, 0x7F31A12E93FEA311, 0x63617C6C6C387915, 
-0x7F28C2D083389ED3, 0xF4A6C07BFA2A5F09, 0xBA31DA69FA9883E5, 0xC5B3D1B49E05047, 
-0x50F54B20388A1752, 0x14A163058, 
-0x4FF1BC3FCD4DF6C, 0x216C15B17990BC06, 0xC87616A15FD98EA3, 0xEF1CB059F3290746, 
-0x134622B2A54B547, 0xEC9C32D7903A3D26, 0x2E815AE5C60F4A11, 0x664758AC06FE9DA5, 
-0x396F87947242D9D1, 0x8DF3701C, 0xCB388A636EA04ABE, 0x5D87DA54EEF98A5B, 
-0xE645B24C0D936152, 0xB44C45BAB32EF9D9, 0xF40222B528D247B5, 0xDF3DB2D4487CBE30, 
-0xCDE0615CBAAE205D, 0x1302FCA25FF615D2, 0xB130E9DDF04A3D28, 0x2C7D1056, 
-0x3B1FBED57DCBCC04, 0x760CD766CE07BEB0, 0x26E247F40CD3DE35, 0x9476CA7CB0784583, 
-0x78FBFA2F175B4C55, 0x3F45503203B92C7, 0x3C023E5A7F7996D7, 0x9B0AE52A7C6B269A, 
-0xCEAA81D18C5402F3, 0x1E184612A, 
-0x76F327041341150, 0x5C5133014CA0F292, 0xFE00BC7103D02FEE, 0x10578ABC8DED99FC, 
-0x1763EC958668EBBA, 0xFDBF5918A071B91C, 0x22C6BB9095A6634, 0xFBE90B1AF3C3009, 
-0xF977FE181D0CEA85, 0xD6A26636, 0xF60806382F7846EE, 0x74CD9345AFB42351, 
-0x59A9A5D7E8F9244C, 0xDB5C7945991CFC71, 0x781B3D168F382C7, 0xFD52F71D1FFA77FF, 
-0x18B495C834C7A612, 0xA15BA36B2BE7C95, 0x88E366204E9B1A86, 0x14BFD6841, 
-0xE3EC3FBAFD816F70, 0x37C148AC93853262, 0x3530C4A823A4B36F, 0xE79D8B986B2D3A5B, 
-0xE05116800BE1065E, 0xC30BE093C1D3EA72, 0x9D8484633DF4FB51, 0xEB92878D1D48D2E9, 
-0x6E538B89DAB7C574, 0x1F666D04, 
-0x91C0EEDA31CC9B04, 0x67B7EBBE6C8B612, 0xC8DE4C564F443B1D, 0x7E8C06E958EF6B38, 
-0x51868B1BFC9BB040, 0x73C8949E9033BC61, 0x54DB0023AE30A027, 0x1190EA7995D7B826, 
-0x8BEF734A1F6F8222, 0x18FC53FC6, 0xF63F320C8F72B653, 0xEC4DD1583FE9C73, 
-0x4C838F980B27CDDA, 0xECD28B5F99DE37A9, 0x69DA971041B80777, 0x8EF631908813A7EA, 
-0xE5115215C1D93FCB, 0x1CCBF2BE552A9975, 0x13105F7D017F60DC, 0xCFE3B850, 
-0xAEAE142A59304F8E, 0xE058725DCBCF5E9D, 0x8D4B086766C00CCE, 0xAD8F86773C04FF85, 
-0x5FAB26C698C0FC75, 0xF590B0C665A6D03B, 0xE9FB9471E9CD33E8, 0x7FC85EF3DE8B28A5, 
-0x9362FD271AB5B7D3, 0xFDFCC31A, 
-0x69EDED9F6D1E5F71, 0x548F7EBF4FBCDAB2, 0x689BE56D1F54BD87, 0x7047EB8A9963998A, 
-0xA961CD54FB81D1E1, 0x34DC050F2BEA3613, 0xDA86C9FBAA75E25C, 0xA2548B0049075B6F, 
-0x56D9E99D122EFBE6, 0x474C5C4E, 0x2BAFBA63AE92194F, 0xCB0D3FD5AF1D9D29, 
-0x76373AE0CADD40F8, 0xC6EE31B39283D169, 0x6F7201DC0C676D6D, 0x2870181002DB97B9, 
-0x8D4350D1959C486D, 0x15F38157A5D594B8, 0x24B2B33D44A348C3, 0x1196A20E0, 
-0xC24178089DFDD9C, 0xEE0C4F3701D8D069, 0x4D8A1A44CA40BF0B, 0x55ECEA09E631B505, 
-0x74408EC219A77B99, 0x9BC3893B6320D44B, 0xFBBE3B614EDCA773, 0x59AFAF80505F6A25, 
-0x931DFEAF8D4B2F3E, 0x127DA6E09, 
-0x960537E9DC0BCDCE, 0x9A9B62A757E212C1, 0x6B2F3BD789781B94, 0x171B80DB3F57F133, 
-0x51C366DE399BD92, 0x494ED25E0CF41F19, 0x13A630855EAF5E9F, 0x3C0A6CBAA79E9FA4, 
-0x6A9436128E1E2F45, 0x2304BD1A1, 0xE68589360072ED7A, 0x8351AE21DF29574, 
-0x73024314F4C56A5F, 0x825BBCFD15DE9DD9, 0x6C08E6B90156547D, 0x7EF8FCCD01981B7, 
-0xE23E7B6399E4779C, 0xD49D397166D92C9D, 0x66B2231CD133C892, 0x994D3747, 
-0xF4EC63EC4ED57DE4, 0x3F6369B34D8C2298, 0x2D898258CE9D7B74, 0x3041C04AE93A2011, 
-0xC81300673651DBBF, 0xADC3E224C1996D64, 0x7C8909EF15ADDEB9, 0x3D957F89708F30A7, 
-0x31C52F7297890BB5, 0x225B195B5, 
-0xB2DED81A71C05797, 0xC87A21DAC3F6DEDB, 0x9A8EC561AD0EC55C, 0x7ECE6383D373B2A2, 
-0xBB4F60A8C36DC326, 0x3D1D03153E48C2EB, 0xB5423EB218640B44, 0x1D9BA757AA513303, 
-0x9756A4082E6407B5, 0x136B816D4, 0xCF0FBF4F93132A6A, 0x3C9D6770C6F00BDA, 
-0x986A9876E62BAAD5, 0x98C5C57C5BA2C373, 0xCE728BEE0B711392, 0x9563FE5A858DFA76, 
-0x711810C59E52E330, 0xC6128D9569757A44, 0x69CD2C856B7670BC, 0xC4DB2E7C, 
-0x1B49A4CF07A211DA, 0xEF5D3A579F332E37, 0xE86361D7A2280FAF, 0xF52787015C659A99, 
-0xE7365EC493EC4834, 0xCC728E408C4545FF, 0x15E8C0635CD8644F, 0x7C7753AB6F68B62F, 
-0xEB6902ECADAE14D3, 0x109D58720, 
-0x564F6138CBD62644, 0xDD84196AF197027E, 0x35D8A5DFBE5E1742, 0x7B94E974D5BDF48F, 
-0xFE4C282E009D4108, 0x289103918CEE0551, 0x66D2670129D78B56, 0x3F454BCCAD5981A1, 
-0x998529EA4EC10D24, 0x253E83C65, 0x811E957AB4259A56, 0xDBA3DE57FAF875F2, 
-0x48BD1DC776DFADBA, 0x6EFC41BF5019288C, 0x96071741373D581D, 0x1EA5411E280B1446, 
-0xC2E35FAF644093E0, 0xB4F944DC96D32286, 0x2D9362638C3C5158, 0x1B9B38B5F, 
-0x2769009C4EE99D2A, 0xF6D8753ABA760FC7, 0x75853653CCC29BD6, 0xE02CBE7B24024CE4, 
-0x346034969B2AE18, 0xEAC6EB3AEF41B7A6, 0x2E3FE2635F6A76, 0x6CB6572DE1BB7007, 
-0x57815850E32846C8, 0x65219984, 
-0x488EDE9DA4A5B294, 0xF8B2B9873C45405D, 0xB40B8E2DEBF13B90, 0x1ECF02D6EA82DE6, 
-0x15DA4576BCD8138, 0x103A45B458BEC3BE, 0x352D2F6B54D4C1F2, 0x687683A13A5D126C, 
-0x266BFBEDF79A7668, 0x113A9EBFA, 0x4BBB86EF986ED00B, 0xC5FA7F49401D1596, 
-0x508123A0D47CCC6A, 0xB6047CBDC6CE54FF, 0xA096080D697BEFF6, 0x398FA61488A6DEA1, 
-0x931B8F4383234871, 0xCB1C64BE6EA4FE14, 0x1BF1D49A44818856, 0x253D6B84D, 
-0xDE4ACB8A74F96470, 0x2DBCCACE5DD330AA, 0xED4BCE17C9754B10, 0x5FFB74A93B5F4776, 
-0x4BB12DE454BB12A7, 0x5F353E011A71D2C7, 0x63997934CA702CB, 0x3678EE6A0662E385, 
-0x2C5D8EB6CB5940D3, 0x18073472D, 
-0x3C12164D6FAF256A, 0x5E8E90CB72EB72EA, 0xFBE2EC45B17C0C72, 0x4F6C79C539873327, 
-0x979828E0BC6D81A, 0x8A56278FB6232842, 0x928EECBF5D82B425, 0xA2BF0DF44CEB64C2, 
-0x57DC257B6BD6E889, 0x14DF6A25, 0x6D88FB5EE546D032, 0x4DF395CAACDC9A4A, 
-0xD2773597D451B3E8, 0x1FB76CF09064ECCA, 0x3C50CBDA40C39FD6, 0xDC9EDE3A9D59686E, 
-0x476756CA3600BC8C, 0xAF8891830511025D, 0x624C8B21EE81C391, 0x1B40EA5E8, 
-0xCA3769941EDBC962, 0xB8764842BEF2D546, 0x14FE99782CB1EEB5, 0x2F8BDD5595C65E0E, 
-0x241C15E459C1BCB5, 0xBE082575B2ED585C, 0x695FDBA70BBBDE87, 0xD2E33F9316F68A22, 
-0x25F5271E143AB7BC, 0x868E1361, 
-0xC77DE22D9938C343, 0xB7545111458D7AAC, 0x9E0CFB3EFAB5DF92, 0xFAAC9C8E3472F460, 
-0x507404BA472B4BD0, 0x6941F6E60DF3BF6C, 0xF791E92AF595236A, 0xAC49C6B014E60442, 
-0x6ABE4685BD394278, 0x3D836906, 0xC7793169D41A319D, 0xEDB2AC03283AA194, 
-0xDF3609455B82612E, 0xEEEE0708A3EF6AAC, 0x1271877B2958B1AC, 0x335B2D2F8EDA7686, 
-0x1F9F863A78EAA7FA, 0xC7ECA3B32D21B5E6, 0x66D1498B210EEE56, 0x31DD0AD0, 
-0xEF8F39A43812C342, 0xAC18F63DEDFE5CFC, 0xE93193F79D04FA10, 0x94508D47311ABA38, 
-0xEA48474A0042359C, 0xBD5BCC7D7D57F644, 0xD2B9A668CE03837F, 0x5FB43189FFB9144C, 
-0x2AE68FCEE61C4551, 0xC1D90760, 
-0xE79B533DD210CD0A, 0xB35819A44F1C7BB8, 0x4063264A97DD29E7, 0x7AC95C04EE257D57, 
-0x479E6F2DD30DDE, 0x727CD0AE2310A55D, 0x65F9183C42998391, 0xF87FF5EB52C77DE4, 
-0xE10DE8664461AFD3, 0xB47EE925, 0xB086128C5E2E1CAA, 0x4681BAF26AF0B8E4, 
-0xAE3CA046D2DCC9FA, 0x9BDDA281B27C76F4, 0x6D2224CDE3A37FF9, 0x6B52FAAFC6DCEADB, 
-0x788E6D23E2FDB4FE, 0xBAACEAEF47BB0341, 0xD51B59A92F1559C3, 0xDBD09DB5, 
-0xD0C0A5777E311FAB, 0xC74A3F32EC0687F0, 0x4E64EBFA85FB560D, 0x23091F73EA9B5587, 
-0xCB734988A0097F75, 0xD2C73B678E3B1416, 0x43366C37BF9664D7, 0xCBDCF7784F8B08E, 
-0x89205243860F340, 0x1232BA67D, 
-0x9943A0A7F12EBFEF, 0x307E3A8D05640858, 0x124D9E4FBE35C4DE, 0xDCB1B7381D3E0E5C, 
-0x4EAC275E7F2185C1, 0xD2774754BA84B0EF, 0x799FA24D537B384D, 0x81C5A25FD89BC8E0, 
-0xD3F32BD250234D00, 0x1EA38AD93, 0x4C0BE21FDC268E31, 0xDD904B565602C8D2, 
-0x950991C491FD00F9, 0x1171D3262942E467, 0x2AA3B0A846972591, 0x737BE5704F4DA322, 
-0x912DA7B5BB8C032D, 0xBBD6A6BE5C69EF19, 0x2ECB5DC6E8B58D4C, 0xA0794056, 
-0xE6DF359CB792584E, 0xE1D4CA3D19C88222, 0xF7876C6A1F1C721A, 0x2EBCEE41AEA949F6, 
-0xFAFFF0BD8A9F8AF9, 0x89EB92480BA5D93A, 0xD4CA7BBDCC48EB85, 0x891B52BEE62F119F, 
-0x524C56BB25E45E66, 0x1CB0486D6, 
-0xB657CE8F61934FA8, 0x56009A7165C49D42, 0x53718D69A7E95D1C, 0x17475D1CAE3F2813, 
-0x194D6EB0EEEA5483, 0x713F761153A06422, 0x604687E7AD294869, 0x55282FC4AC8DC14E, 
-0xB2F331F09C16E0FD, 0xE0B1F2EC, 0xD0B23D0E153DD699, 0x96DF9901C841D5C4, 
-0x2975FA38EA5C9927, 0x8A2E59BCCF2F985F, 0x91C95AFC055D0825, 0x9C95554615AF499E, 
-0xF6A7DE65A33AF8EA, 0x4FB4F5C86D03628A, 0xD483A38D78930249, 0x1A5C459C9, 
-0xBE96686A8B9F4925, 0x3FA6B2718BFA905D, 0x23461425164EB436, 0xED4A5C5141D21C14, 
-0x1E43D7AA48EBF6C3, 0x9DAFC54920252817, 0x7B36D39F9524F3B7, 0xDD2011E8B67CD55, 
-0xC5713259EE63EB1E, 0x1FF74BDA7, 
-0x297AE89F2D9A3535, 0x888E5D13D7D61131, 0x121C8F46D25B3263, 0xAAF33BEE7B7A5C97, 
-0xB20EBAA009E3EE98, 0xE993BD62D59E13DB, 0xD3DFB4E947E3CE2B, 0x4E327D79C4D4A1AB, 
-0x6E336AE0E25D0EC, 0x11CEDB8, 0xAADA0A16ED22DFD1, 0xCA72730A4E0ED7C2, 
-0x9A6CDEF04BF38C97, 0x84E6E85639D8FC11, 0x2A972EFFF263E161, 0xEBA2988988595D57, 
-0x6A9A03DDA47436D6, 0x4DEFB968F8666F4F, 0x4AA5F82B94BF06C5, 0x1F6D10A1, 
-0xFFCA84807B8EEA16, 0x37BA6A478028CBDE, 0x275349F21B0B3E6E, 0xE72D21BCA44FC3E7, 
-0x84164D7E82DBDF14, 0x945843C5F9D4B328, 0xC7185C524DA8FE65, 0x2447E358A69590BC, 
-0x37D14F6DA6534F9A, 0x27BF41659, 
-0xAD53E8ABFBB6DFA7, 0x2A35251AC4F5FF5B, 0xADCC0A9A4326235A, 0xC2F9451A17923C1F, 
-0xF6519EBD3C61CD0C, 0x319442CE1F74F0B0, 0x13B022C2EF3BCD97, 0x183679AC7BF63FF5, 
-0x2C4C8293C79564A7, 0x5716FAED, 0xBA1B1EA2A32B3C02, 0xE2370D293B0A6C45, 
-0xD0FEBAA18AB88D00, 0xC9F124022C9BB501, 0xBD4BB47ABC1E33D9, 0xDFFF1A5A2F36C679, 
-0xE7F28E2B95E211F8, 0x72B21DDAFB229103, 0x3362E8A9E8912608, 0x11A170585, 
-0x92859D43DE5F792B, 0x58E9AB8F05A8B83F, 0x2B7E93F872CE8CD7, 0xA54B2E98AB5B4CC3, 
-0xDDA93F6CAE7C14CC, 0x46252EBB4556CF1, 0xCA2980E4B0692603, 0x24134D3CA0755514, 
-0xCAD10FD95CBD075E, 0x12BF6B520, 
-0x921B9F8745F1475D, 0x4774B791A3C4AE78, 0xD2CD8846D2C95A94, 0x67DB07D6E07FCAC4, 
-0x33ADEDE703E253DD, 0x9FE87EC9BC947DD3, 0x192F6AC7D4033CD9, 0x2ABEDEC98E89FCA3, 
-0xEE466447D64CD6F7, 0x190454DA5, 0x288ADB2CE87C0B9D, 0x6AEA333CF21CDFA7, 
-0xFB780DD87F876123, 0xBE99C5792BAAF014, 0xC3E815C66C158834, 0x4B21BC2CE24F376B, 
-0xBFB79FE7C71C0EA4, 0xDFC0BDC1BBE0F233, 0x996470157B657BC9, 0x268C92880, 
-0x5813537565003CAA, 0xC8F7D471E7591F6C, 0x300DFD27D85EB6A5, 0x8D2B123E2E9E5115, 
-0x5AC840E45B6986C8, 0xD0A03102F8738046, 0x6E021CC48DADC477, 0x413F2AC0EC4A189C, 
-0x3065443BC0DE85B9, 0x22E6694A2, 
-0x7E45EA9246CDAD54, 0x2F506DEF6CF232CC, 0xDC1BCB39386A9617, 0xF6550F5F56AD8E4, 
-0x3C9C5A274392ADA2, 0xB0C36F35490732DE, 0xC0D276A10AA570CB, 0x513A9B2BED45FD22, 
-0xBC85392D250A943, 0x26B22E557, 0x5BE83D085398D2BB, 0x4E2247EFB00EB248, 
-0xC631345111DC0D24, 0xFC0E35CC121688E7, 0x70257DD93BEEBEC4, 0x6DB24F03293B7E2D, 
-0x36E917A5E8A1B767, 0x8853464C821C9FE8, 0x83EB4A968E40C74E, 0xFE7BB4F0, 
-0x60F08FF8F0E340E8, 0xE525C640D1D1CEE8, 0x4FBC6AE96FA77A54, 0x944BE877E8AD0525, 
-0xC25B7BF3A0FFEE99, 0xDD8A5AD88795B3F7, 0x3F930BFE1359AB98, 0x29B8E1F442825D49, 
-0x44AE94CB0FA5D13E, 0x109308FD6, 
-0xAEFCC245DA10C2AE, 0xE52369AC4087D2DF, 0x80C0076EED595D5C, 0xFEA3F9DE14EBFD7, 
-0xBEA6DEA1CDD2CBE9, 0x9920ECF3A674AEFF, 0x40F6A1D5F4D160F9, 0x3B66954C1F3CC9E, 
-0x1C0191CC40D87413, 0x1123E3593, 0x45C09E972A2693DF, 0x5E1AC1D99208DD5C, 
-0x737D1B8F2680A42A, 0x7A369E86677E826, 0x42981B42EDD72503, 0xEF4EB668CB67AB1C, 
-0x86ED579E591C6332, 0x8D44BB6BD684AA59, 0x7C739C0A6180B338, 0x1C91D4406, 
-0xBC92460991C7A1CD, 0xB8FEC8E4A3F13771, 0xCD439BB38ECD3C00, 0x6A19FBFC5212F11F, 
-0xDD2B17B4BE43787D, 0x93C0EB15E02F4B46, 0xF7D1E1CBF162BEA0, 0xA2A75A7E3916152B, 
-0x51C22C304BFDD006, 0x1DB03797, 
-0x958D497CA1D33DBF, 0x363C93124A60B66, 0x877BCBFFB76771EB, 0x474BDF3B609AB13B, 
-0x459868F7B66C888D, 0xA0489C1B4FC0BC2D, 0x18BE97BBEE36B22B, 0x9B2C638AE80CB292, 
-0xF43A9AC4ED9A62AD, 0x223F2A9A6, 0x154755BEAEF55075, 0xC19B1FEEB8833C2C, 
-0x84688B40DCE69BEC, 0x231A7D95DEC02520, 0x72890235E3021F15, 0x931CDF88C696C8F4, 
-0x3124054B8A1556F0, 0x67E6E3165AB94E99, 0x4BCE99EFF1170FFB, 0x18F12AD, 
-0xD4317DFE091A95C0, 0x262205810A61538, 0x326E5FFB31002A71, 0x5846B1ED97CD1A34, 
-0xBCE5E532D8E9A1E8, 0x8D3A18EDA8F48EAF, 0x9C8001C0C0E57F02, 0x6DCF1579A5F9F2F, 
-0xDDC27E06ECD6FB71, 0x1481D0C96, 
-0x601EA1475AFF7B9E, 0xE9BE56DE3FA1B42B, 0xCBD413C235AEC0B3, 0x33700117F710DEA3, 
-0x81E12AFCFCBC623B, 0x7DFA47EF7E694AF6, 0xB6208720AAD7C2BF, 0x19EB69BB0A8F965, 
-0x6BA43CCD4AB18D9E, 0x23E8A09E7, 0x3AA0AE6B3CB24364, 0x68983DC177AFAF33, 
-0xE631F9165C0F3CB3, 0x7D1D7A3C67D4E58D, 0x176D43C328DAF5AA, 0xDD60960F0663CDA9, 
-0x847D207A4B99DB6E, 0xA4FA53B5EBB89531, 0xE092B9F047B3728B, 0x1D9D4C7D2, 
-0xEFDA3810FEDBA852, 0xCF786D0EF76C43CD, 0x9F1C2F9F3205870B, 0xB3A84CFEEB69391C, 
-0xBCDA60B15DD20636, 0xD282457ABBC2D31F, 0x3A52065DF8827C3B, 0x9509E4C09A9B165D, 
-0xCB6009207181531D, 0x1CA8E18EA, 
-0x955B2A0C56434466, 0xE6EF02BE92720C5F, 0x9A33118F2E6AAA12, 0x74E13BB50D6994AA, 
-0xB67E6E2E53C3589D, 0xAA3C2ED7FD0A9B5A, 0x43CD09FB5BB8A11C, 0xAF3CCEEA37E397F2, 
-0xD2163BD702508CFC, 0x219CEBD82, 0x5B1C071F795C6AB9, 0x2540133980D85338, 
-0x92984A74F04D7892, 0x5898271BB65AE3AC, 0xD4105C1090D13A58, 0xE368A2FC4C0530BD, 
-0x8E1E3188F97AE8D7, 0xE7FAD581B1FB7509, 0x8ACB07A5AFBFC3C7, 0xFDB8BFD8, 
-0x9130644D2F0F1F02, 0x2977F7A558403492, 0x137302694BD29775, 0xDB8ED8C198492CD, 
-0x9956DD321ABC9E18, 0x24B3B0D3641A359, 0xC7262E56CF7213D, 0xD7F418F945F78513, 
-0x31C637FC823AE7F6, 0xCDDCDAA2, 
-0xB5E1CDB3E33DD424, 0xAECD4B4415CB29EC, 0xF773AE5BF30E4BAD, 0x8CAB4C33AC75A0A5, 
-0x1D7EE9319D1B0D58, 0x6381B9A6AF5ED1EC, 0x75CB2C09B3EC789D, 0x3D48E3353B641746, 
-0x86E10709FB1CC2F7, 0x16194C6A7, 0x73B4F211A7A81E85, 0x4C5EDF0E05D717F2, 
-0x73B7E332B2829696, 0xE7D99BCC48EB571, 0x301BF965216186D, 0x3CBBE7BD353DABC6, 
-0xA158C59871A83253, 0x13A731093E83D8E4, 0x351E67D0A751B51, 0x1ED182ECA, 
-0xB0724790068B381C, 0xEAEB78ACC8D44B24, 0xEA87065389473536, 0x490ABC5C16531830, 
-0x7D617D8F7F2B978, 0x932492553051047C, 0x8E9EB77B0F5A2236, 0x93997B5EE1FE08A5, 
-0x3A8FC63B62F078B9, 0x19451E07, 
-0xAD03EA4BB6B86634, 0xB133DCFAA65E0415, 0x48DFD8840D3E44B1, 0xA1D2B33E9505BB66, 
-0xF74889F2F89A44EA, 0x981FB38BBD66CAB2, 0x247E5EE0EC114AAF, 0x91984D43C8D9D573, 
-0x6FEF7B61B9B0CA43, 0x1F570C152, 0xA27B484BA6B7F105, 0x386B50FA4628C066, 
-0xC3743F435EFFFE30, 0xC11E816EB2CE4525, 0xDB124BCD60CF4383, 0x34F11680EFF131F8, 
-0x10EE2062306B45A7, 0xBCA5C5408D1BFE5C, 0x8406DBBE28F6F5BF, 0x1F00B3C8C, 
-0x8F4DA845DDC60B05, 0xAF7DF0742620040, 0x93EA7C8675781EA5, 0xC835E602D67050D2, 
-0x492886D51075C09F, 0x83A6D2D21B3C2391, 0x7208949E8E44E27, 0xEA1D9D57D92B6328, 
-0x28C8A06F0EB49B7A, 0x10CBAD422, 
-0xA0B43F9443812A14, 0x8B513298055A6683, 0x2D30357BDD3CB650, 0xB6DAEE0C42579884, 
-0x3381FA03B708D663, 0xFDF60E6F90DD798B, 0x24CE43E03A0A2DE1, 0xBB667B2BF6ED672F, 
-0xEED24232F85C1139, 0x1F6D0AF89, 0xE753573492A887A9, 0x6A47D8F7A32B9657, 
-0x53324B978959162A, 0xC209501297077E40, 0xBF7964C89F7378E1, 0x4EED7CA2F88E6CB8, 
-0x956DC0B753FA439, 0xAAFD62AEEAB5CFA, 0xC5FFC58AE7309A1C, 0x18C76C195, 
-0x55BB02C3926A7179, 0xD3EFA127D98D2285, 0xE31B29A591D84A06, 0xAB6B656F145DC1C3, 
-0xBEAF6F15C47158A0, 0x13F864DAA04E53C3, 0x9CC68D5A6285A8B8, 0xE814B27110CB7356, 
-0x857CB261AFF51502, 0x11CA20D93, 
-0xA601E664B5DB5029, 0x697132ECE9235E05, 0x24B375FC8286C32, 0xB3F98CC72659D932, 
-0xFAF51DC655FC8A6E, 0x52BBB082EEC6793, 0x9C25DF2FC1747803, 0xBF4A569F9C5F16AB, 
-0x7B542822294FE8E0, 0x4C50247B, 0xB16E30C50542A6AA, 0xC9C0AEEE0CD9DADF, 
-0x1994A9BEB20ED56F, 0x5153EDE471FCD0C2, 0xCDF5E4EDFF9DDFD8, 0xDF5EE981C6BD8E86, 
-0xBA685050A1A759CC, 0x28F5572F4280BC99, 0xD9BAC2B0D9250452, 0xB1109E5C, 
-0xC31BA7B2ABEE6C47, 0x2FA870B0DA75DD9E, 0xFB3EEB22518B439B, 0x9DCBD7E59F6581EA, 
-0x93CE09397C812456, 0xB7862B466860BE8F, 0xF20EACA222B2EDB8, 0xB97F7492135B9495, 
-0x51B6CAA93834B5C2, 0x250793CC5, 
-0x33C6FD5A6464B339, 0x72B3E75EDD68227E, 0x9B66B5E1BB0080F6, 0x395C2A9A614AFD18, 
-0xB5CE27D4A65EC651, 0x93E248D06E8D4316, 0x5EB9BF50936D4EDF, 0x1241D5CA31B85B02, 
-0xF5AB34823B9EA2C8, 0x1FB0CE7BD, 0x1E9E5C5E49434B6C, 0x610DC64282B5456E, 
-0xE94C96C7ECBBB2B7, 0xF06B6375AF7B2171, 0xA2CF87B92CC1B0AB, 0x185496B148531141, 
-0x30CDAF734920BF87, 0xC237173B29166F98, 0x10074646FE3BF092, 0x1A2D28B15, 
-0x76AF7EA6962952BA, 0xBAE1C9F76BA013B, 0xC485FD353958FF8E, 0x9676809C697FFD71, 
-0xF565A0EBB79F1F26, 0x46D5BB0D0F2F9041, 0x4410EBAF2F23BB95, 0xEAD0F2C419A53407, 
-0xE9748666C679CB0D, 0x220D2C62B, 
-0x907DED361C91CED6, 0x563F7A167A11ED6B, 0x5C2889F8518BC395, 0xB08521A966D22CF5, 
-0x8ED2358E93BFAD3F, 0xFA5D8B45671E6FB4, 0x806B86D9AF6D92AB, 0x3CE0176AD06E9BB1, 
-0x8D67C450AC006478, 0x3F68BC38, 0x17844F552B6C6F71, 0x6C311E743835CFB6, 
-0x6615373BB3E6A310, 0x9F1784EF7E65A098, 0x5CFEC147DD2B9FD8, 0x7A2B4F361DA30743, 
-0x43A8E645DF1A9520, 0xFA5E0DA872ED7427, 0xABE81683FBCD1BD, 0xABF169BD, 
-0x5B7A2A7659323147, 0xA9815C77B1F1B0FB, 0xA6BE008AE7B1DC4, 0x9A25E0CD5880DE7A, 
-0xC15E1A72F9CC3B56, 0x350BDF2ADEF9DF7F, 0xA5C3331AE076AEC6, 0x685C3156B6D67AAC, 
-0x7F325303A5356F9C, 0x273618A53, 
-0x79A956A635612437, 0x9703BB0483168DFE, 0x3EA79BC2760FE8A6, 0xDF7FDCD5C2AB19AE, 
-0x75F69B8D21B74E58, 0xF6FA3086C0C6B6F8, 0x659E8318EB184E97, 0x32EDCCA299043D75, 
-0xA5B5B0845EAB3652, 0x1F590A703, 0x5BB80EE02D2C7ED0, 0xF0F0DD1C3CCAAC64, 
-0x6506E26EA63549E9, 0xCA366F644E32BEFB, 0x1805ACCEAF21207C, 0x36D15BEDCBF4D5C6, 
-0x92344338D70C81C6, 0xB809D29600821A01, 0xFE733FF4B456570B, 0x15045387A, 
-0x8E75E912AF04BB32, 0x2D34529E71A2F25D, 0xD33558985BBFD0CD, 0x75AE57CB9E52FBA0, 
-0x59010ED170C3068D, 0xD2453115059D4643, 0x7C63BE63510600B4, 0x2E0A8559812895BC, 
-0x990958DD4C9B09D0, 0x11E5F2650, 
-0xD2DD824D3DF24B08, 0x84A31288DCC19926, 0x83304830DCCF6F01, 0x9118B1C2CD802CEB, 
-0xA568F2B0C0757183, 0x6D4A0FDCB786656A, 0xB485338F2351AEAA, 0x7C82DF01FA10957E, 
-0xE50FEF1BFA1036DF, 0x16CF5F46D, 0x21E2172BFAF6BE2B, 0xB9030934A91AB484, 
-0xC0574CCF635D2166, 0xDC42450BD6DDD750, 0xE1947CDD7DDF6F3F, 0x176BB773BF8F625D, 
-0xAA9430F015B6B3F, 0xE24EFFB41C589770, 0x694FD0AC35445EF2, 0x110A2984F, 
-0x940CC764E9E30395, 0x82B05BFE45EBB78E, 0xBD2146E53A77187B, 0xE0DE84A413AE6368, 
-0xA442B54F50E6B57F, 0xF97C52BF16B9B734, 0xEEB2C6A28F2B3C11, 0xE0BF878356E71F38, 
-0xF764476F25100F7E, 0x11E712C2F, 
-0xF0354F57DFD30D5E, 0xE79AEA645C603BD1, 0xA4B17C7E9CECBFC, 0x126450401D255883, 
-0x1E3AFDDB260352E2, 0x7D91CB60CFC4CFB9, 0xC81087486EF799B8, 0x7D9B0040AF7BA698, 
-0xF6879269EF30EDCE, 0x1D1DFEF2B, 0xB2C912E3B5C1C5B3, 0xAF1BE0278F9BD8D7, 
-0xD60A9EAA529A31D, 0xDC4F19B4FF54E29F, 0xA9744FA05DC0701D, 0x3578C5CC225FC891, 
-0xC4AE8C67F69060E, 0xD5840B2B6576E721, 0x73FD8FFB874D44C9, 0x104FDD5A8, 
-0xC72B47717AC37D5C, 0xAA43274E28766EE0, 0x9753DE0F89A2A26C, 0x1475166A094BF3C9, 
-0x4DC5857A41740A9C, 0xA82F6AC928BDF36D, 0x77489EC4862C5215, 0x8BFB5398F945FAEF, 
-0x6DCA64A68414F74, 0xC8B69BEF, 
-0x6E95F32E009D104, 0x879A7CA0B213F07, 0x207DD750C55475B1, 0xDC5D8B57B7A42708, 
-0xD55D6C1AF9A18FCD, 0xE502B2DB06782AA3, 0x98DAD5ADF0C5ACD0, 0x8BB3DBA5917AFE10, 
-0x872217BDA3DCE61F, 0xC2F3321F, 0x8EFB0FB4ADF74ABC, 0xC16E115D1B58EC74, 
-0x68A81E4A8E9ACA99, 0xF1E8773BDC3E97D6, 0xC249152D61D3FACE, 0xA74DF2CF116D9747, 
-0xC71A17BA3981E34A, 0xDD5AAE7DB00A05A8, 0x27CC581E40D971EC, 0x9AD51F50, 
-0x10F1EB7EC85BB70F, 0x48FF92CA83D43141, 0xC863301463D2772C, 0x46BEF0166A625654, 
-0xB5C60AB6681649B9, 0x3E8B377BF70264D1, 0xC4FE385F212375ED, 0x21C8B33479F9D6C1, 
-0x500135EC062E4419, 0x22195F49F, 
-0x6C671936744E5A94, 0x2797CF267458EEDF, 0x9C37F17CEF09F386, 0xF40BD79728201E3E, 
-0xA32CC73777A7AD1D, 0x972DF2EE444019C, 0x2005C103CD8829AD, 0xA11E3CD90FF4B56, 
-0x80EE63F11C5FD847, 0x270A751C3, 0x6DF39CA95803FA56, 0x27CAC3C2BB41BD51, 
-0xCCF25B7B7029ABDC, 0x9C2364E4C5C2C646, 0x6BFF13301B488AB4, 0x1AAD63DD2AA2C90B, 
-0x9093038C13E801F1, 0x78337944721D3507, 0x8B97B0C0F6D5DC83, 0x17D550F95, 
-0x90AF3849034640D4, 0x20C87C8F309F8317, 0x7C4828AA169C9E5F, 0xE7361ECCEF1477AA, 
-0x624C2EC85100C5C7, 0xC77F3C8F44F60F94, 0xE95C099F63502C2A, 0xCE6FE4C3F39DFFD6, 
-0x57A1EB522A66E8F, 0x16C70DD80, 
-0x907AC0A272B62736, 0x20B9ABCD4BC240A7, 0xF5482CBE9DCC680F, 0xFC728958CB435FCD, 
-0x982D51B8819D4165, 0xD14F08DCD447B8B8, 0x42B62AA9A8FD12F4, 0x7FCB1488946FAAC3, 
-0x6C4238541327E7FA, 0x23D88EF7E, 0x67E9C4771DF7E4B7, 0x7C3389EC75EECB26, 
-0xFD5912790A3E1969, 0xEF05E085E9A33A38, 0xF061FD6B22E8D79C, 0x353D803197FD7F0F, 
-0x7B90C14E412C1A5D, 0x3BDCCC78D30AD272, 0x403828272E1E4CF0, 0xEA663CB, 
-0xD977BF5F1358F043, 0x66B1A4E5E6A53CED, 0x9FDA06A86A5532B8, 0xA890FEABF879E605, 
-0x429CBEDAB59137F4, 0xCA4BE0D7585B0640, 0xFCF25162301C8A05, 0x8507E731D60A5E3B, 
-0xD8DFF18E33291522, 0x26AF2B3C2, 
-0xDC5340211767022D, 0xCBC3F2FB373979F9, 0x5EB1B42643AE3FDE, 0x96AA20EBD96AFE8F, 
-0x13C9808B20047611, 0x9BD5F4AE9B2A2821, 0x2D4443E2713D6DF9, 0xA7A7F030B2BC02B5, 
-0x4B11CE4807E2B13B, 0x1E649D937, 0x2DB76B983E94DC1E, 0x9160104A36F69225, 
-0x674762A5FB44CDAD, 0xCF954DE1143E7470, 0x3820B2F84A3E628B, 0x9EBB4AF2860F954C, 
-0xF56E77D39BD4B704, 0xED0793A3C3C4553C, 0x99E3802468436278, 0x1D360B833, 
-0x45815330170CEF90, 0xD6D478CF2C260D4, 0x804A175AFB88961A, 0xB857AA1C10A3ED58, 
-0xDBE1ADE5BFA58A1F, 0x851147CD4B94FFF3, 0x816611B291074AA, 0xF89327E12095076C, 
-0x7C1BF243F2AE169C, 0x1C9610254, 
-0x135B366FF727F629, 0x255DB6FFFE0493D8, 0xFA1356DA8E3C53B0, 0x6AD01EBD2F1B19A6, 
-0x2508C9C5FC40180F, 0xC9F064E2FD34FE52, 0x160EFA5454503C45, 0xF3CD354B4FE47861, 
-0x66303516A8EEEC03, 0xBC99236E, 0xE9D6D31CBEC8CF07, 0x632ED575F75124D6, 
-0x3240BC24FEDC3CAE, 0x274A77B948498177, 0x976BB492C942A075, 0x4FF5D7D95DCF1990, 
-0xF01E87B64B16866D, 0xB010C1D7635609F0, 0x6870D71BA3C8C69C, 0xE4124219, 
-0x5389477BC1FBFD46, 0x436B240E0C5235CE, 0xA6D2E353858D6AAF, 0xDEA93598559DAD33, 
-0xD262F1B48CBCA598, 0x3E0D43A8E51FFAF8, 0xAFAEDEBCEFE417C7, 0x15C14B55B4027588, 
-0x4C654608098FCFB0, 0x21385A1EB, 
-0x3EF3B3E093BA9318, 0xEA7BFB1CD0E7F6A1, 0x7A6173782910C53D, 0x94AF2D9F5F0181BB, 
-0x610A0A14B38F1F65, 0x41CCE368B656B48F, 0xBA17B0506D2D577A, 0x6B05446832231A75, 
-0x9E1B5FDB0A3AD39E, 0x2527C7D7A, 0x9463E787E3FFA209, 0x17C85BC8CD6A691A, 
-0xDF5909329DCED4CA, 0x7DE73E7188EC93C, 0x910B8D524A00C5D, 0x2F89ED5BCA678871, 
-0xF5270A68FB46DA4A, 0x1C9C4F539A434487, 0x66873FEC785355F5, 0x27FE0FDA, 
-0x8B11B30273856BAC, 0x5CF74C80C478F9EF, 0xE1DBC079315681C5, 0x3C69551E5AF6866F, 
-0x37C1C79D8A87210D, 0x8E21A7837ED9BE4A, 0x962C34F9A695A204, 0x3C11638A24A3C089, 
-0xC6B0C9FD921E7820, 0x3850FFA3, 
-0xB3566B25C146AB5B, 0xCAA0F0D211F5EE68, 0x9448F0AA7C0C3AE, 0x46F49DA6B02A1E61, 
-0x7476CE561457E01C, 0xC8CCB6AFD813A3CC, 0x883A97E8170E0E66, 0x4E974732C6ED9B5, 
-0x27BCBFD59F8594EB, 0x16DBB02B4, 0x95D7A49576FE8024, 0xCCFDD4C43E74A541, 
-0xEE59E1B00D9F6C99, 0x7B3BB5D6558FAB1D, 0x41A7B7C1DC0E25B, 0x5A8343B5E01F44E9, 
-0x94F3CDD6BD232C2B, 0x734B0283F25B0BB5, 0x1983149D6A52F1E2, 0x1E9A23350, 
-0x4A872F20E5383666, 0xD106E42925C954C4, 0x79101412AE1C2896, 0x70CF1EE24DDAEAB1, 
-0xFC1206AE3E57C212, 0xF5A6BE205B2FC5EE, 0xA63D987C2B777AA6, 0x7CC0B725741A36FD, 
-0x9E4F63C10F560824, 0x1859ED8FD, 
-0x23623634E5FCD034, 0xA93B9EF4778F2883, 0xC20A0A32B06DB7F6, 0x1114268002561CCE, 
-0x5C66C73D9A63BCA4, 0x1E539E816842554E, 0x6F36753C4712F289, 0x7246DBE0C6C63BC9, 
-0xF45CBA5E3A37D9F2, 0x5161575, 0x6A6D47F78EF749D4, 0xE7F4709C0F67B730, 
-0x7C462EFCBD06BE06, 0x8C1809CF7DACF1CA, 0x36C776CFBAF8FF36, 0x66B69CB1A2521BA4, 
-0x8794B7FFFAE593E9, 0xAA03595787C7AD30, 0x9A2D79245E974613, 0xDF3965FB, 
-0xB3671A1A74D97D56, 0xFC9693282593D00C, 0x6DAFE3C9304D5F23, 0x41143D5AE73F4BD4, 
-0xB9A6C67F8CB6831F, 0x4C161618CC5B42BC, 0x97B5C605D335760E, 0xC750761B53D34F80, 
-0x63EC511D5170590, 0x1ECE1BBF3, 
-0xCFE664B9F440F860, 0x61D92A8977699F86, 0xC652CD37D088D675, 0x7A3F37DAC9E71D20, 
-0x38A27DE9AB9CB2E4, 0x656F1FC482B30E83, 0xB97EFED7D0F7025A, 0x6B750D74959C6094, 
-0x6161C217DF7ADCD8, 0x20DE32E7B, 0x74BA3B2392439335, 0xA2EDB5E1953C735F, 
-0xA8B1D7516ABF3ABF, 0xAADB2DC6FB85A36D, 0x2D06B48AA8A7087F, 0xFB0AC99749803717, 
-0x4E5F282E4FA5C54D, 0x55F81D5E16C8450C, 0xDD6A33E3A11605ED, 0x38CC319A, 
-0x74852A8BDFC476ED, 0x7385E4E5B8B3C05D, 0xAA63296100684848, 0xF963C5808E92A3D3, 
-0xAFCBA6002AB9BC82, 0x17772E8AB40FAA56, 0xFED28D0534C0CDCA, 0xF7A654A14A204B18, 
-0xF36C38B41606BF5E, 0x1D8B7A19D, 
-0xDDD2C01F8E4D997B, 0x52EB6C6F98E78D5E, 0xA5DDE7B0B65BFD8D, 0x5EF4FE8B6118F5AC, 
-0x591102CEB16BC5F4, 0xA20E64309D7449FF, 0x77DF6DD428C5A43A, 0xFE2A586F3B6CAD08, 
-0x6559883A83BCF5D2, 0x104ACA4C0, 0xB226D236C9B4746D, 0x433E5FFD5CD22459, 
-0xA47BA6015EB3E4C0, 0x4E79CF5E48CA10F1, 0x719AB3685DA973A1, 0x7FFBB1C3AFCCC690, 
-0xD032DE3A56DFE0F2, 0xD7A4F629071FEEE2, 0x6E9DD0F4ACA22685, 0x1B8F3CB16, 
-0x87CE9EBF5DA83A4E, 0x3EFAC6866D6111B2, 0x6472EC56A4C0171C, 0xF755CF9137BDA17B, 
-0xF17B24425D0D58C6, 0x54668AB3EDE86BAA, 0x90FAC588645B8C97, 0x5C6AB3082C543362, 
-0xE81F606CE4080214, 0x13EA746E0, 
-0xB84AA4F819FCA6F7, 0xB13CD6E6CA756859, 0x2CB3A946CB4CF57A, 0x5F7CF43695866004, 
-0x1037B6DFE8C590D7, 0xE45C0B89DD5F97F1, 0xA4856B70C40F9CDC, 0xDB297BA598EFF55, 
-0x23E01C4678E8245F, 0x67B92F3F, 0x45A28AA04E44A09D, 0x195F5E918F27B78D, 
-0x134958BE081DB607, 0x75C54F26770DC997, 0xC0F6313A87AB8B61, 0xD66A2A72563384C6, 
-0xF0FBDAC572DD4338, 0xB0EEF38994186479, 0x8B207AD89518CCDC, 0x24644E8B3, 
-0xE0B4F837016C7B83, 0x128A21AEBF772475, 0x162EAC9147B9175, 0x4788D6369F25BF74, 
-0x1F99BB9BCA443168, 0x3346BF98524E4EAA, 0x3548278401E43651, 0x70C28767F1B23AF2, 
-0xE8FB6C787EA407F3, 0x1FCFB934B, 
-0xA762457BA3E21582, 0xE3C97471A84A7555, 0xB128C59F1848AEA7, 0x864336DF1CDC45A0, 
-0xDCF41BEFD39E4C6F, 0x3BB443AAEEE7F014, 0xB34B228C7E148422, 0x44784075DE3759DD, 
-0x701EA96CFC32519D, 0xD678D433, 0x5EE897DA90202AB1, 0x112078930FF031E1, 
-0x910E9B932E1C1C6C, 0xBFC11894A8401A12, 0x10C9E329958FF224, 0x91561D0E85E3C92E, 
-0x934A28DBF89276B4, 0x36F3DC70086AB150, 0x14E98F7EA271545F, 0xEAC3A744, 
-0x8C1AE4307C87FCD3, 0x8237B7BE541C331F, 0x4B1AEB306A92FD33, 0xE3C13677BBE0F2C4, 
-0x78B9213B680F5A18, 0x9BD9BFC3A7ECDE00, 0x5AB90611F7BA0F0E, 0x613E1FC770101866, 
-0x8604C899E3C35C9D, 0x1C55170D0, 
-0xCD3AB27993D8656E, 0xEA9138ED2A9D021E, 0x24155E805EF14B41, 0x2B68F63089EDFC8A, 
-0xED82EE478BFDDE44, 0xE60D50DE3868333C, 0xA9B06E63B0D83B19, 0x1BC5F3C8E85E6B57, 
-0xEFFFE64133BE7496, 0x23A6DBCC0, 0x496D0B0A58D64729, 0x163D5A86DD894052, 
-0xB6159CCC8E4C38D, 0xE29175E31AD2291D, 0x6F8E25E50A1CBA11, 0x40ED2DBD777DC9F9, 
-0xCD39DA5747D38B15, 0xE34406A70DEE688A, 0xE78592161F968B45, 0x15C7E2D4C, 
-0xFE8719F24DBC8902, 0xF04900FA9C37E064, 0xBC54A320C59D7627, 0x818E9EF561AD0573, 
-0x40776A1B3E4BF36C, 0xA7EC45D03EC848A1, 0x732A2BA50630158D, 0x48689D2DA6C04ADF, 
-0x976D81ECD8460556, 0x1F0B89CFE, 
-0x4AA84CAA189ACCE1, 0x90C96E32B743A329, 0xA3087900F88DEC18, 0x35E07EAF33196DBD, 
-0xBD7B714639CBD1EA, 0x6963E26684192ED5, 0x546B952D481FFF26, 0xE8C9721D3493AA0D, 
-0x832575BCE0AC966D, 0x26C5E14E5, 0x8CE284804D4B8C64, 0x2CBA89475315F044, 
-0xBAE45A74430AC1EF, 0x6A1FAA95121742D1, 0x81F9CBD0D004F0AA, 0xC1189F2963C627E9, 
-0x49F113D750D7A357, 0xC6EDD008C79CF2E5, 0xA527AD0385912F4A, 0x523C26CD, 
-0x8A28FBC691D53142, 0xECD4C105640DDEF2, 0x712A44572A8D0ACD, 0x39AF0B901B94D268, 
-0x6D5F58F0985EDEBC, 0x5700003C710EB2D0, 0x16EBB774B2092899, 0xA9D0E3915DF69329, 
-0x44B5F7C54A941DDE, 0x20F65381F, 
-0x927CF8A1114C65CE, 0xA57E25AE54880D54, 0x77EEFBA6DB48789C, 0xE9FBBDCF4739AF66, 
-0x14F6609F0DDDF6C, 0x96BEB3CDE1E326E7, 0xD4A29900A9CE757B, 0x19FB01EB3411C9B6, 
-0x268ACAF242BE94C3, 0x48591BFA, 0x876427084013093A, 0x5A5681BD9112E77A, 
-0x5DFA5DEBB79DC06F, 0xA23A3D82C75B63B4, 0xFCD9FF06CAF28CC3, 0xF2BCD4144A057BF3, 
-0x5BE016030FC2957A, 0x6217B83BE37B5F0F, 0x2A6BA5583B84DD73, 0x54CE9C24, 
-0x3444347FDDFD1DB6, 0x515F46C08287623E, 0x81168ACE56D4391A, 0x6ADD22D00DBCBC6F, 
-0x259B0FE55C631FBA, 0x515454C1B4F1DE7, 0x9A342F422CD48C14, 0xAACDBC77DD9E0C1E, 
-0xA6D7FED2A0C4A35E, 0x1AA07CE6D, 
-0x3D716D1168B7EC58, 0xE78C669B0D7CB819, 0x14F6C3F882593E60, 0x84E09F56BEBE149F, 
-0xB71FE0500B919D85, 0x6B0FECE5559ACEEB, 0xAB8094ACA9D65819, 0xD97D8C87ED53DBB7, 
-0xD39822C53B10071C, 0x103600C15, 0x32E090057F40EA3E, 0x240C73094925AAE6, 
-0x9ACB761EF500ECEA, 0x45507E24DF603DB5, 0x3A2C6EDFC12B5E8B, 0xD6B9B0E2E644CBE7, 
-0xED4C3C756BBA4924, 0x5692F118D1FED278, 0x815CF4809E6B0928, 0x19C1A6D38, 
-0x8CE2FE9C50B02A9C, 0x51A6B0FF201E1CFA, 0x718D9CA444BA7851, 0x8D13C0CE96444758, 
-0xF7A0F2067D36142A, 0x25F5E51D48C429DD, 0xDA29E8736191EAB0, 0xEB7BA0A8ADB8D273, 
-0x191DB24629D10535, 0x20D4ABB0A, 
-0x6D356CF37603BEC0, 0xA3E89A4715704B1B, 0x968130D8A22A8AC7, 0xCEEE661B372B6650, 
-0xA9D7F13056323BF0, 0x2BF415F4373E7226, 0x7D691B4A83233AFC, 0xC21DD60D2C9BA4CB, 
-0x96E879556D1D329C, 0x6A5F6010, 0x3D979C1211A86156, 0x5C7F10E40E14A40E, 
-0x339366597321C923, 0x12F2C78AB4C4A590, 0x4965B2821EE2DDD6, 0x4C5CE6964F4887AC, 
-0x3214C387E84DBF64, 0xB5842AB6004BD931, 0x5AE8D389393CA525, 0x1AD661E4A, 
-0xB7CE097C505508D4, 0xBF848CAE6E54870D, 0x5644736419E35401, 0x53CE2DFC81096D9E, 
-0x89E8D3FE804A15B2, 0x36760A54B2966DBC, 0xF509F2088A7B68F1, 0xBC1C6CC75DDE48DB, 
-0x5B168D53391C582, 0xE5F5B759, 
-0xCBC3A27AB1EE96DC, 0x43657EAF0E8BFF, 0x1716374AA4994400, 0x60D4441F0D3E1264, 
-0xA7BD0E9FA0942A87, 0x69E2689FC8498134, 0x52E5EFC0E9145F1D, 0x2B71871D78A7FAC6, 
-0x88C6FECF8E655D2D, 0x1E34D26A3, 0x62D28C6222C2DFD0, 0xF66C7E18A2AB200E, 
-0xBF810245FA1AD8CE, 0xD559E159884A6D10, 0x6BAC295EB947450C, 0x3170B2331A484C0C, 
-0x6842F7255F2B61B0, 0xBBCD5A638DE89C11, 0xF34131A0DD12E201, 0xBB8D405B, 
-0x7E88DE5C11F46BB, 0x82A5D4CC7010E0C7, 0x8970E2A175CD4651, 0xCDFE4BA14BBB8D41, 
-0x724070731A74022B, 0x2AB96D5C83684FCF, 0x64F9BB576AE61D08, 0x1EB90047CB896180, 
-0xF63E77E80BD9BA60, 0x1ECFB0FD3, 
-0x697F700A8872258F, 0xFF9F75F6BA72B47B, 0x93C4A25BB45F0357, 0x5C95D2037A871D9C, 
-0xBEA5361A1EF27FCF, 0x24F5FB0ED27ADDAF, 0xEEED7923A4162F8, 0x7DF399C426A952CF, 
-0x7478461A7312CFB9, 0x166517D36, 0x60F39CC928FB6D49, 0x6377E0397D2FD8BC, 
-0x667637109F5A9103, 0xAF529BE03C999AC6, 0x9310A8D3B200D671, 0xBA6D910C4AD013B4, 
-0xCE8C5DC29436D63F, 0x8EBFF26A9E28CDD2, 0xB5BDCD526268FF75, 0xBDF74F2B, 
-0x414F3CA62B297063, 0x32B99A5013F59D9F, 0x706B5D138609353D, 0x16273F161019D037, 
-0xAD983C8B12BDE084, 0xE7F07F1485168C96, 0x9D89963AF12EAF6D, 0x6CFB8AB3738DE008, 
-0x5FE375E41D25CE8B, 0x255971D8, 
-0x17B50D7E9C2ED567, 0x33A966DA7A4A6349, 0xD096BA2D6BB29235, 0xCBE537B5A3299998, 
-0x2E6CCDF6EBCCC7E7, 0xFACCB5038C064D05, 0xCF8310D293DF7B34, 0x5F2E9A71CDCF9E6D, 
-0x2C497F2DD38821E2, 0x6CAE81C5, 0xEC19C31E503D808E, 0xE2A1BA3DA45B45D3, 
-0xA4362F976278E818, 0xD07834B873819E0F, 0xD7B5C09B2FDD580D, 0xCD78F4875BEE24E5, 
-0xFCA38F169A2292C9, 0xDE10B688A3657FE5, 0xA8A23C108234A8C4, 0x2642A71EC, 
-0xF5FC10A61DF3190E, 0xD55FC545E5AD0220, 0xD3193B42E3B26DE9, 0x60ED089CD2D8EB67, 
-0x18656EF562D8D411, 0xDA0CF30790AC1C6A, 0x50CB9DA05F9B76CE, 0x99CF958C7CE4292B, 
-0xF19D162A43B876A3, 0x17631D17C, 
-0x296DEF5602F0F8DC, 0xF17EFBC48BDB52AC, 0x63F30EB18AF1811C, 0x30903E8984A9E0A0, 
-0x5E4D487306DBA8B5, 0xDF6AA884D9D6C5CC, 0xBE604E2BED5E1479, 0x2EC2C7D12A38EBCA, 
-0xF4A315C8E32B1DB, 0xCCC2C748, 0x7E4576C4B6C799B2, 0xCAE5EADA6FAD590C, 
-0xBB3AA4D0D5E8B0F8, 0x30F118CD43C4C681, 0xB778E3A8DD5C1262, 0xFFCBDF770B7F187B, 
-0x7234CF6B643FF3E2, 0xE4F6CD90635AA91A, 0xD1F83754F5B5571F, 0x2262E1962, 
-0x78B1D92E7B0B70A, 0x2F97D3846FE116D2, 0x36EEEFB24BD31634, 0xA2137504BCE504FA, 
-0xE6E161356608653F, 0x14128489AD4AD8E0, 0xC2DF1408EE01ADA3, 0xC79390CC9220A814, 
-0xFB4B2BD4D54AF58F, 0x47A6AA75, 
-0x54A91F7419E94127, 0x6DA62E2F53132B97, 0xF64BF181BF88536F, 0x20AE733067875804, 
-0xF07ADAA32779CA3D, 0x5F8850CCA664A5A4, 0x49AD82921086DC13, 0xF8F8732C67E5E590, 
-0xD2CAE4C9B746065F, 0x7BE90D92, 0x18748FFDD5BC6886, 0x3043FE01C4597785, 
-0x6E89A8DB7A79B350, 0x7F6AF6C4C8B34905, 0x46438197E299D3B7, 0xCFD4CCEC056399BD, 
-0xE740325618478A73, 0xD03BA6C957999B79, 0x6C98D4E6A339DBFC, 0xBBD53816, 
-0x1395B06EC4F0A34E, 0xB00C51DD7E54867B, 0x9FB1ADB0231773EF, 0x3A4DFAC08F04DA10, 
-0x43566D0EB9BD213F, 0x3979D18D01B6DBD, 0xDA2686E9312AD645, 0x6C4394858C87B74D, 
-0x71B0D3B95690814E, 0x25491AEEC, 
-0xF7283DB75E8AC67A, 0x72A6F497D30281C2, 0xF74B56CE4CFA2E76, 0xF54450184F4ED6D, 
-0x7E1703FE863C9005, 0x7F9CF01162AD98DE, 0x917D54BF5EC38E0F, 0xB74318D794676C3B, 
-0x4334486E03796FC0, 0x1C5A257C1, 0x360209F374CE2B07, 0x2F51CF05D14BD874, 
-0x2CED2368FBECD851, 0x688E6C2AEEB767FB, 0x1F997119C27208CB, 0xB41FFBAD48E736DB, 
-0xBD696D17C753CA85, 0xD49BCBCBF29C9C29, 0xCC3962808CDE66A9, 0x912AA469, 
-0xA47410C92A5A42F1, 0x374A36D14BCBD036, 0x6FCCB4841CCE826A, 0xFAC60F7049C7C5BE, 
-0xD1D327272254D751, 0xAFB8B064932B68EC, 0xAB27C0F4C059EF37, 0x3094840D23C29B17, 
-0x62B24D50C93491E1, 0xD4D675C8, 
-0xDB5B2544806AFFDC, 0x6BF60D194C2F298E, 0x57C75CEAB922026F, 0xDAC8282C318F08FD, 
-0x4077CB8F648E4CB2, 0xFA348AC6DC7F5550, 0x2B87041EA809A877, 0xEA77F682F43D3365, 
-0x32CDA470C3F6B8E6, 0x26FE4FF48, 0x5FBF060EB29AB794, 0xA0B900B7FE220FA9, 
-0x7623132077F1C307, 0x4E2549C7D0CC66AD, 0x8EA7E7FD563687A9, 0xE80EB3A3E910562E, 
-0x7A467A680CAFC26E, 0xB2502FA3809C7F37, 0xC76E7A7798509E1E, 0x155052EDF, 
-0x4C99382C64F69BC, 0xE0DD89C353820FE9, 0x8556DF94BBB09DC6, 0x2C2271AFBB6B8023, 
-0x8BBE4240CF2EA84, 0x32AF978D071FC129, 0x72227587238DC2EF, 0x81172AD96F40EA21, 
-0x1C9A0DEF41DE62EA, 0x1AB028F49, 
-0x9668E25EF577C488, 0x4301502DD24FDE7E, 0x9B5256D6878C7CEF, 0x7C4A361B77BCB0ED, 
-0x8344D763F2BDFA24, 0xB3A5D7E50E0347D0, 0x6393D2C601BDE3DF, 0x5981B6BA3E299361, 
-0xDBBF387A87492EB1, 0x160F36631, 0xCB21CCC6DA46E65A, 0xF554ED7B4F08331, 
-0xD308C7B6F8061D1C, 0xBF1DD4A8B0E7FA9D, 0x2DC9CCC34D90FD58, 0xE8AE8940ECA4E6B, 
-0xDA001C5B3F0E0763, 0xB32CDF5809316893, 0x5B5374DF8AE52C79, 0x14BF6F0BA, 
-0xD6313BFAD7524469, 0xAFDFA4BD09015AA9, 0x81B06BF2FE366A7F, 0xE051A4F6AEE33795, 
-0xE28D197D5C37FF24, 0xD436B0B5F666A66D, 0xEFE3A40C15B87C90, 0x3FDC7E87AEB98FCD, 
-0xCB0914D166F41817, 0x1A0A7E854, 
-0x8BA351F8E86C22CC, 0x117B0E80697E0785, 0x9D780A83833C03A4, 0x928B81B3D110ACD3, 
-0x45A40BE7D1059F04, 0x2FC52203FE918B04, 0x559F56CBAF995E9B, 0x9C9E91C85AEDF44A, 
-0xCB0375646057C91C, 0xB78D07F5, 0xB893A50408E6E3A3, 0xE174427FE61AED6E, 
-0x89E4C5C6ED163CBD, 0xB0486E96D008A64A, 0xC37117D7F62377F5, 0x3E5ED5CB90814300, 
-0x36FF684DA3B6AF18, 0xE8FB83808F3BCA93, 0x1BE01A930DC7A622, 0x187545FD1, 
-0x8BCD8E92CBDD6B68, 0x1DCAB34BCCF2CD10, 0x65F34FB90614D860, 0x876A480451F2BA0A, 
-0x23A2AD18E99B45A9, 0x2F7BE95A41F30907, 0x6253B445BF212A4, 0x93FB78F261800AF5, 
-0xDB48C91006275FD6, 0xD22600A6, 
-0x30B9953AC8EAFCF8, 0x43F6AE017F6C9FFA, 0x5DDEEE09A1D9CADA, 0x5DE4B6C4864FA5C1, 
-0x4096585296B8B524, 0x30216321D184B805, 0x2C2301ED3B541A9C, 0x8B657C9033420853, 
-0x4FADE8C4DE4F51BD, 0x3BE23741, 0x3C18D11D4C4A4FBD, 0xAA6A765A470B87ED, 
-0xDEDA69F26398F4A3, 0xD46BF827356ACC34, 0x2EDEA234283443BC, 0xAF42DDD322157243, 
-0x92B7A38C6AF90393, 0x4E6E9B71A9B407D8, 0x9145E67D25780023, 0xC1E2EBC7, 
-0x94615754805F5A9, 0xDAD50FFA8B8E7C5, 0xC6AF6D94CCD21B1F, 0x60866D16FE364243, 
-0x462DF0C749B26336, 0xF6D236243639E302, 0xB2A6E826624015FC, 0x7E1783A61CC19B4F, 
-0x51B91DD2599A87FC, 0xD6486B16, 
-0x83E0C04A0C4D3E10, 0x182213CA56B9D25C, 0xB7B54A1B25F7C059, 0x39D38F9099AF5362, 
-0x7319DC1459F42615, 0xA97B71CBEEFD6CE4, 0x65C598B47D6BCF5C, 0x56330E1990F6C2B4, 
-0xC0457A5CADBB4785, 0x21D00285A, 0x3B567470FC23A56E, 0xEED4DBDFDB2EA396, 
-0x92D53A5EDD8AEE63, 0x33E6120DBB3B4460, 0x32C85AE9490FCB39, 0x3FCFA6E1F1512891, 
-0xBC4B1E05B21CDC93, 0xF4FBA5A9788228D3, 0xEA6CA436218EEB1D, 0xECBE2AF0, 
-0x93B8F1A87A74FAD5, 0x484CEF16A37CF65C, 0x4228C7E27442EDE, 0x1386C7F06D95EFA8, 
-0x13981112306DABE9, 0x849C7D20A8DFD346, 0x7830E8D137A891A5, 0x4C7E0B049A65EC32, 
-0x2A04249BBB7B314D, 0x11FE0E0D8, 
-0xF090172C44337633, 0xD6037BD08AB07C4C, 0xF619485236BA9AF4, 0xD2E48DA6E512277C, 
-0x78206D366520804D, 0xDE5FE0547BF9E27A, 0x96E3D5D006DE2656, 0x6CB779E76291B1C4, 
-0x2B99DF84AA4F5B8A, 0x1D4F693B1, 0x916ED37D7484FE2A, 0xBD3782667ACA30F3, 
-0xB7F01FABCEE9D5D, 0xC74C7CD108F3BC5A, 0xA1810F9A17DBB943, 0x34C5EA7DA681B5CB, 
-0x8D04DF9245D4C7AD, 0x85F95C5EF69CFA2, 0x7A85F381CED62B0E, 0xBDE8AE4D, 
-0x644B62B14F67D9A0, 0x4F3C1430E7379F6D, 0x9025A07DDD41C57, 0x421D680FB5C520DA, 
-0x1EFDA8A1CD4F1733, 0x83BF1FDA976E7346, 0xCBC5DB35B8C22D47, 0x31006944E5DC6EA9, 
-0x8BD82B74F37EBECD, 0x25FD35EA2, 
-0x453EC94BB558ED8D, 0xB7C234708A78F8FF, 0x893225780A4BE704, 0x99D0DA0688524BE9, 
-0xEEB720FF1FCE42D3, 0xA592DE465725D077, 0x484A702D65ADF4AE, 0x4CAFB46FEC206CEE, 
-0xF2419C7DC023FD77, 0x226CA065F, 0x305F976EFB6001E3, 0x45F05C8FF1744C57, 
-0x537E4F34AE5DA4BF, 0x3349F9F52BB02CAE, 0x6861F3A60712BF9B, 0x19FC680A1E62853C, 
-0xC03E38E7EA797B4D, 0xCA6E5B4E1AC17395, 0xB13381B952EB3842, 0x68B9A2C0, 
-0xA631FBE6C2954058, 0x64F810D098219A8D, 0x85A24AEEE243C948, 0x3B8E65BDD1A6F2F2, 
-0x8ABF2C8072F698C1, 0x38E3E1AFC10C40C1, 0x9FC01DE179EBB2E6, 0x9B6A0A739CE1FE8F, 
-0x728EBE94AB463788, 0x73C43FA9, 
-0xAEE20A7F23115DFC, 0xC1B4AE10B597C0CC, 0xE846443E4E9B2372, 0x62A2170AB9209F19, 
-0xA03CCBC5E9A7E8D0, 0xF72D99F8F9C44FA4, 0x2E4A0077514CB591, 0xA5ADAD5C481148DD, 
-0xCF6DF63A007A59B2, 0x224C169DC, 0x48B0566C3F2781BC, 0xA2297424AF3F2DA5, 
-0x3661220660FCDF2B, 0x482606C38FDCAC6, 0x9B70C76BE53A29E0, 0xB459B9557B3F6F34, 
-0xB836E3DB4AE2976A, 0xA5E3AD4C27CF46BD, 0x28A6006039F81CEC, 0x670A70F8, 
-0x9E0D4371F5871326, 0x32F0CE4C88FF2D0B, 0x861E194E3DFE4A78, 0x3CACD61AEB36A4AD, 
-0x955527734C839228, 0xD152F916FF00CE3C, 0xE346AC73A60AEA2F, 0xBC0F4F8F11C84FC6, 
-0x5D0FB49873ABF75E, 0x269380447, 
-0xAA8C80921446F66E, 0x672B1E0D3404D7D8, 0x9DE62DE8C798679D, 0x1A842488B3304389, 
-0x624E76BDD4EA83E3, 0x92E9170EF0B9F87C, 0x69337630960979D4, 0x49B7FAD68DF450F2, 
-0xD670CB98993EF60A, 0x13F1AE618, 0x562A9AC4A5134A4B, 0x4947F4516036DD8E, 
-0xFB4C5FBC2F97A07C, 0xED83DA9F4B7B0A8F, 0x73B3BCA63A32A656, 0x492A14C7FD1432AA, 
-0xB64EADF10F853C20, 0x30B8ACA72EDA0D20, 0xB95C0CE64742EE1A, 0x4E16AEEF, 
-0x5BADDEE53C42C93, 0x957A2EE16260CA31, 0x37FC52E1C9702C8D, 0xEABE5AEF35BCFB21, 
-0x63DB141E6E0BBF2, 0xD1AB383B3C454FEC, 0x711FFE472F8E873C, 0x6F3119BF266D3437, 
-0xB5E4BE943C9EBBAB, 0x404ED8C5, 
-0x1ED090FC184E9ACC, 0x607EFD6655C3CD45, 0x937888DA393FD3B, 0x2CD59DF6F4314B37, 
-0x6D9387F9A3F0E44, 0xDF8248BF778C5590, 0xA49EB82A663FD7A8, 0xA138B7D0B4222996, 
-0xE3820043E8500E0, 0x22578ED4E, 0x62543D88983BE752, 0xE6235ACF5A8E1186, 
-0x87EE063586C01BE3, 0x98A7A11137B891AD, 0x497F3A92F8789546, 0x24E6AA94F15D3588, 
-0x318A8F67F8FAE6BF, 0x64D3B8F05ACD81C3, 0x9507340AEDA0BA74, 0x259478671, 
-0xC717A6A3120365BD, 0xBD0D40589319F46E, 0xA1BA3DC7CAFCB5DA, 0xA7E01F157C3D5A34, 
-0xFCD020E4DB70AF40, 0x662BBA621D526D39, 0x76C54090E51ABC7E, 0x1696313B82D8755C, 
-0x6001973E0F067ED3, 0xE4DEA98C, 
-0x8017A261367A4635, 0x38D1A56BB529F405, 0xC953652655C88ADE, 0x3588044A20D4793F, 
-0x63A4F52E67E7FE0D, 0xB4B70ADBBF7B52CA, 0x13AA13B1F79D37E5, 0x77879D2D6A8B560B, 
-0x27A4B43A20F1E84E, 0xCBC88D87, 0xC1C7233AB6E732FC, 0x6E45B5643FF917D9, 
-0x99DF918002FC81F7, 0x8A5F25A4A58BECD7, 0x3F5670B3E3067854, 0x675EC1EDED79C5DC, 
-0xD556F76D216A8A28, 0xC6BDB52DADED48FD, 0x394EC150667836C1, 0x18C3C23CC, 
-0xB008CC4E3BAFBAD, 0x3BE437293B2C8EF, 0xA66577F3FBF344D2, 0x1758FBE7D9EB2D31, 
-0x1B930B2DDAB21034, 0x51F369D6B811F570, 0x9FC6711D55E19AE, 0x2B6430046C080EAF, 
-0x5CB3ABABBC4D7929, 0x368690A5, 
-0xE252ED770F37A335, 0xB495BFA23B4B5487, 0x19CF726906A47632, 0x6714963AE777FBEF, 
-0x7866C8C1C71CC3C0, 0x80988770F6197E6E, 0xF4F11567C4887CA4, 0x8DAB4795120FA596, 
-0x7F08F2D1A2F354D2, 0x74F9D30D, 0x2F5723EC5ABAD4B2, 0x5EADEE9C7301A1A9, 
-0x98C906D480A7C6CB, 0xA1BF125076FABFBA, 0xAA0A5CFF5A1D4319, 0xCFE345F422199C85, 
-0x932909F200F89D95, 0xCB4B8D6ED7FA1E56, 0x1487E5524196C4A7, 0x20CA7FB72, 
-0x3200FCC37990A768, 0x357BDD163E1AF1A1, 0x2F4D64380FAFAF02, 0x840E80FB37FFFBC7, 
-0x3332957F0F8CE21F, 0x34D206D2D95FC726, 0xD0E79CAE6DF9C7F0, 0x1261C42FB49B3F39, 
-0x11812AE25C1C033B, 0x1BD18AAE1, 
-0x6444880254613DAA, 0x886C6C9BD7F87122, 0xA89853AF0C52B098, 0x5DD783F68C9411B0, 
-0x958C9586BF423131, 0x6DB0291B18555CF7, 0x67EB5A0E74510859, 0x49839CB2C4F0D222, 
-0x99DB7FBF134EF20, 0x23C35904, 0x155EF5CAA79FFF8B, 0xE136F9903252DEAB, 
-0x8090B09B672C38CE, 0xC156906A59E1F45, 0xDEC11941A36A14B, 0xD1B672C659B21839, 
-0x170B59C451DBBD5F, 0x284F3694B242E1B6, 0xD64E3C0814A1854F, 0x105F760F8, 
-0x4F79B6E9F76CEE0D, 0x5FDD44681AEB256C, 0x4C79FFDCB83A10D7, 0xAC9BF9E6E1C6BF2D, 
-0xDD3DF85702954B17, 0x667BCD49C735EB54, 0xA3136B341BFAF648, 0xFC338B01061DAFA0, 
-0xAC8DB50D58E43B51, 0x21200DDDB, 
-0xE08DE70A77900B29, 0xDB6FC8816081328B, 0xF8E6D2502F61DF88, 0xB3130922DBB92C3D, 
-0x5CE1B90012D7B58E, 0xCBE86565EEF8432E, 0xC7EAA1FDF60974D3, 0x1F0744D302B59195, 
-0xBB324ED4ADAF996B, 0x260653FA6, 0xB232044E2288208D, 0xB827F59D98F6BAC4, 
-0x6AC079659902BD18, 0x58623C5F36FF9D7B, 0xE46A24262AF8D7A2, 0xFD7FE60F201CCFEB, 
-0x2760BCA4C8615958, 0xADA9680E07A1378, 0x6A98E5B9CFAB8229, 0x2393A6D2, 
-0xB4C3BA5981451E6F, 0x4E02AC28D625956, 0xE34FEAF590D32D86, 0xAF7E2B47D9D6625F, 
-0xDC0D47C599530DDB, 0xB372261FCE42BB0, 0x9ABEC82860394390, 0x919F948084BBBED8, 
-0xE2EA20B59F6E0AA9, 0x21A9FA4DA, 
-0xA55871A23725CBDE, 0x4D29DFA671986192, 0xEFDC54DE890509D6, 0x7BB1E45ED55E7193, 
-0x5B37075DCF045CE8, 0xC771D599A98EA826, 0xEDE090A2403FC75C, 0xC049CE071F32FAB, 
-0xAE7DF5D885803247, 0x4A5F6F6A, 0xEEDCDE287140DE76, 0xEEAD5E5E945C4F51, 
-0xDACBDA030EDA12C6, 0x2AE5E8D945F099FF, 0x54665FFD31AA5044, 0xEFD90420A397438C, 
-0x49F176FD6DE54348, 0x7C94050D6387C06E, 0x2950E61E9B970DEB, 0xC5033A07, 
-0x425A74A081BDE65D, 0x7E49A5C4F10EF6E, 0x61B4949014BA369F, 0x2E9FBFD4D43D483B, 
-0x62548C08F547DF7E, 0x12E771B67FC9D232, 0xA57C2519437313CC, 0xE8FD5E13A8FA6600, 
-0x58053C6521E4E05, 0x231483D51, 
-0xC34A1FB5060922FE, 0x27650BCBCF505A21, 0xF638D834DF03A49C, 0x9C09B699AA808E17, 
-0x326AF58E27741256, 0x28DCE24B231CC56A, 0x36D16A9F15EAB5A, 0x3ED10AEEFB9C59F2, 
-0xF898FD31B3066ECC, 0x17321E117, 0x6F4CE5705E183509, 0xB8DD81F1CA2FD3BE, 
-0xE01E7A7AD505BF8, 0xC2F3982D0B43A34D, 0xB1E44FDB8638E7C7, 0xFE4EFD2F6F92BBF4, 
-0x735AC9FA4DA1AD55, 0x1684A97C8DACD160, 0x2FAE811525FEB969, 0x1373AED48, 
-0xE3EABBCFE8A2EF30, 0x1BB8BD2764E49F24, 0x3C309C8B38F439D6, 0x1639EFBB2AC44B5A, 
-0xCBF55CDDE556F0F2, 0xA4A464BFC60C9E13, 0xAE3C3FBC18CDE561, 0xFCB2B8E645514FD4, 
-0xBFA6FCD29B15D0F4, 0x96A9102, 
-0xE9C06DB0BB475D0B, 0xC9FE63FD8A6B1F76, 0xF6FC04EEEC5D3AFB, 0xCF39D2815FF448E1, 
-0x81FB9A5044F9E2CC, 0x264A2EEBCEE49CC2, 0x9E1AD1BF2260F4BC, 0x8CA6E5AAB9B502C, 
-0xF8C289A61E900D5C, 0x1D7D4E9BA, 0x276D46BA493D6030, 0xDB97A3808C9E551, 
-0xA98773C9B6CEA1C3, 0xB8587FA52A07AE7E, 0x2BA36DC7C973201C, 0x8DE305F726059473, 
-0xB142EC42924A5E81, 0x36451445EB9386A0, 0xD3AB2A6B625D2187, 0x233B42F0C, 
-0x18A5904824F4F85C, 0xF9635808F427E1CE, 0x4A67826709A89EDA, 0x3F71B408668D2809, 
-0xD03A1360F84051A1, 0xD04F04044A7ACDE3, 0x1B819B1DFA41129A, 0x994118037743F8DF, 
-0x123542E2EFD1B273, 0x384F03DD, 
-0x3CEFD51B523108CB, 0xA67410ADB49F6C6E, 0xBDB3CF1D678EAD53, 0x1C497C49B37C05BB, 
-0xD14163421A054B22, 0x6C33B89F791A35B5, 0x83546636C36426D1, 0x7F1E0FC2544B4EF4, 
-0xCFD9D8F83E87713F, 0x22E42890A, 0xE33B3B75EE5A71E, 0xD300A61E2F65E7BF, 
-0xD3A30EAABF524AF1, 0xA37B3421B9ADB03B, 0x402066464AC3DC9F, 0x34C0DB51A34E173E, 
-0x4CF64C76E7919D79, 0xF535767D85A95CF8, 0x5623957B1123DF9C, 0x122D22EAD, 
-0x29993E4CD66E02B7, 0x231FE179D7A787A6, 0x8CF02BB15E58442A, 0x62A2BE6056101A43, 
-0x72CEA113BAC527EE, 0x99D08C75AE2B78FD, 0x6BCB3C46E5C1F376, 0x1206E952EA2D6E24, 
-0x69F3F388C1ED9E26, 0x71E17411, 
-0xB980BE5806595C07, 0x4F384FB3F2053B89, 0x8D1B6C20155554FA, 0xF313D7A86A701779, 
-0x21080E41C1C3A2EE, 0xB7DF5D1242F08B7B, 0xF87F04A4CCB1E35E, 0xF32175F6D821ED2F, 
-0x4533B1B95B0B9B5B, 0xE620EEA7, 0xD2BFD4DF4F4EFDD, 0x7F2699EA4ECFCC6D, 
-0xDA4A562F41838873, 0x8053FDB1A233F42F, 0x6302839E1ACAC01E, 0x74086D0AB38B546B, 
-0xB59618EA73DE28B0, 0x406E76D58291266F, 0x1B342EB3A9D6F641, 0x2731C463A, 
-0xF8B9EF061F48414A, 0xDBC78DA806634FF3, 0x744D0CE50905649A, 0x77EBFD9F4407FAEE, 
-0xB24F352CF1AC2C19, 0x9AF44FFC31BC9E7, 0xE646F3A182DA097A, 0xF2DDF0E1B2AC4D5E, 
-0xB7EF96F10C19D6EA, 0x26068FE04, 
-0x790E64CE1DBEBB05, 0xB496D5EE34BC3F1D, 0x5D44A21F6CA6C1AA, 0x12F8962E61635BBD, 
-0x57B3C2AC6C0D8C4E, 0x4FFF54549549D096, 0x574095A99F8415A5, 0x41A6ECF4DBC48005, 
-0x1A3395E340D079DA, 0xFE703F98, 0x5DFDCBA5334C4BD2, 0x9ADF6112611BD474, 
-0x886CBEFB27567572, 0x151363F494F89250, 0xEAD6F353817C006B, 0x3D99ED786CFDA919, 
-0xCE4FCC4632840A98, 0xC285C9C75F355640, 0x9EED96561B345C9E, 0x1B9035D0F, 
-0x730254098B3ACD5, 0x8703B827D5A0DB00, 0xE3C97AE529D91AF8, 0x685EBEF8B9D34305, 
-0xABEFDA366373E2BF, 0x1B2C887C2B1E1A83, 0xEF4AE42F3E34DC90, 0xC91448B2E31BB8BF, 
-0x86D431BDDDB7512B, 0x2400BF63E, 
-0x7C51D100B28B847B, 0xEEA7FEB4246064, 0xFF581C7EF52EB112, 0xF01F05B62D25D5E, 
-0x5D2943050941D109, 0x8F4185467B44F666, 0x618F3B3DA8B077C1, 0xF914EDB790A7E235, 
-0x3D227FB753D8C0C3, 0x24E8BB919, 0x8F8D3CE0A0D4D76F, 0x104B64A1132ED0A3, 
-0x1BD448C845E3A6C8, 0x9C7124D207CE8E24, 0xD24C7D960EFFF11, 0x1B84E9131F645FB6, 
-0x6873AA02C53ABF60, 0x283E7B8A8FEABBA1, 0xEC831AA6263B2B5D, 0xE4868115, 
-0x5A5EEEE288312169, 0xFE034A1544AC9CEE, 0xE68822459A5E7A2C, 0xFC70216F1C37D9CD, 
-0xE36616DA31932E6F, 0xE97B1E3E56D7F764, 0x71B43F1C91EE78C6, 0x4B6F897A2C3001C4, 
-0x104406C111B38698, 0x16C78852E, 
-0x2886ABB0C6A48E6D, 0x3CF6043D96443A14, 0x83EF417A73FD9BD0, 0x1F67F1B956281E96, 
-0xFAFD0DB564684D29, 0x891E6DBDA705C27, 0x9B615AAA125F1D65, 0x46DCD2B7B7723ABD, 
-0x160BE8C915572CE6, 0xFB542CEC, 0x763E187DB27F59CA, 0xC7C9F7697DA2B9EF, 
-0xFB04204BA175AAE9, 0x8B7586ECEF8E1102, 0xB97C6B7140F6B97D, 0x75A3C9359B365307, 
-0x5957256C487E372C, 0xE5F4661A6CA655AD, 0x94233A2B7A758060, 0xCD86011, 
-0xF2B3C48BED753899, 0xFD0652FFCB587E26, 0x24BDBBAE19EBA6DE, 0x2E41AF455FBA1E4C, 
-0xA5E0E859470DCCC8, 0x7F3817869FAC48E4, 0x717F280CA5CB5FA5, 0x372E7E7B637339A8, 
-0xA6371F5BAE532A33, 0x2146B11BB, 
-0x1AEC3C8F660AEE96, 0x17D7786ED788BF59, 0x45579B5DB55BADE, 0x33949EBDD249A575, 
-0xFE7427EEF6278328, 0xD5F651BB1A9E9D8D, 0xEC43D59699759E67, 0x9736A788E8154D1, 
-0xD95E4181C4331CB5, 0x1B0FE511A, 0xABC15E4D510CF288, 0xCFFBDB0D8B7FD3B, 
-0xA20E4DCEBEFDB115, 0x8EDA5CE0EFB324E5, 0x306C767EDAACFA65, 0x8389E6E8E198BFD3, 
-0x66676CAD1CBF0944, 0x30F3E511A100E0A4, 0x7D3260928332F6C9, 0x5B07B9ED, 
-0xFFD6A21662E95F65, 0xF6B2584A78CE8120, 0x37C8735134B5340A, 0xC1AB64638A3D08BA, 
-0x91312C36DD710BC3, 0xA7889701FE6581B8, 0xCF759C4C09670BA1, 0x41504350BDA2D662, 
-0x1C81D1F89E4C9E65, 0x9577DFED, 
-0x8B8B5F3ED78901A8, 0x3536587886877D4C, 0x912336131EF692C1, 0xD600D13141418249, 
-0xA1E6415B191C0A99, 0x54403D980D94346C, 0x1151BCDA3EE92F81, 0xAFBAC6D528E63CDF, 
-0x4D57669BED34B65E, 0x2090C966B, 0xE99115C4E05AED3C, 0x224AF9572596C2D1, 
-0x6D5F7EB4321E2933, 0x309AE521E5697720, 0xFB6707149648B45D, 0xFE0AC7115739EE55, 
-0xA3EEEEC37337F34C, 0x69000E10373A6712, 0xBB709256F996B8EE, 0x99CED199, 
-0x490CCAD64701B2A0, 0x8DCDD1C4CA7784A0, 0xADC9BB7B8E22CAB2, 0x81A7999D14648EAE, 
-0xA7DF6C97496F4A2A, 0x138008C7D0273AD, 0xD585693954792476, 0x4C5FDF63531F2E95, 
-0x4D34CB30C2C20C0E, 0x270BBBDD1, 
-0x9F21BCF440E8A06F, 0x60391507C6DE389F, 0x9AE412ABD38F7B7F, 0xDE40B7F24192072, 
-0x902283A9AFEC4AEA, 0x4D7A03CD4EBED3B, 0xE1FA6E3D5DA046BA, 0x7D1DD04FB13CC143, 
-0x1FF3E8580368EEBA, 0x142CCA8BF, 0xD013FDC6075F483A, 0x2BACDF7EFCE8C2B4, 
-0x3E8D9C7D5C099F5E, 0xC79D1CAAFDF02A8D, 0xF09498B03F3A75B5, 0x745F61C74045992C, 
-0x85A408D186F612DA, 0x94CE108D9D50262A, 0x898405DC73F1FA21, 0x42C748BF, 
-0x77283B475CDA09FC, 0x531833038CA5F09A, 0x6DB3022F743C2E6F, 0x9B9549C2605E659, 
-0xB8447F1C3716656E, 0x349F8B58D29D4617, 0x521C2BDA30FEF470, 0xC24B86AA9BA1BA91, 
-0x84A6F2FD5F187FDA, 0x106E2507F, 
-0xC682C4844E95E5F0, 0x442BD6950B0732AA, 0x60CD545B72147A73, 0xC20727D97FB39A8, 
-0x8DBABAAABA203961, 0x23327C944D7FD458, 0x57CBA91B160583F6, 0x94DA52C064FDAA7C, 
-0xFD62A4DEBC391C1D, 0x1F052AA88, 0x257D13E0F011AEAB, 0xEFADB3F3257BB2B4, 
-0x44D7A573460B3990, 0x2C3797B6E6AF718B, 0xA17C2977A6D52A12, 0x95D30ACE2FBD092D, 
-0xF1228020A879E3F5, 0x8CD8204261D6B0A, 0x4A0FF8410A5EC063, 0x14E6F6088, 
-0xDAD94294CF40B5DA, 0x522669F156152E0A, 0x63CB632A2994ED19, 0xEB7CA3AE7C9A2E7F, 
-0xD4415D6341A936C3, 0x796D10CD84024098, 0xD96136DFBB2290AE, 0xCBC58357526C890E, 
-0x3D62BB625B723CCD, 0x1D375DE7C, 
-0x91EC31B74F8B1B0B, 0xA69949626DC86E16, 0x38CA4EE6CA27228F, 0x32F7E38762C6A93D, 
-0xCB433E696DA28CC4, 0xA3959F5E06A25B05, 0xC0A6AB4C259B48F6, 0xB889051023F86BF0, 
-0xBB2624E54B8156AA, 0x193D59F0C, 0x40800C73E1E322A3, 0x3B81BBA91A572A85, 
-0xC1DF92EB9C269A83, 0xF4448C5452FC026C, 0x449A6E22C6E58C7D, 0x89F23B5233344176, 
-0x3217C218850F1251, 0x21E6D803D67722D3, 0xE441EEB2F9FD5EE8, 0x33FDE48C, 
-0xAB1927B7E4E3117B, 0xF5EBF26FBF9E3AA6, 0x793C8C0A38593107, 0x3D0C33391C236CC0, 
-0x20D2DEC9E41D7231, 0xE68DFDDA6BAE8DB8, 0x8C0F79A484FEF4F7, 0x497D23F846E846B9, 
-0xDDC6AF88E626FF0A, 0x43E726C0, 
-0x357F4B0D81D4CE90, 0x50E99A4A9D003983, 0xDC48D5F884FB989A, 0x4E406CCB18F7BD06, 
-0x4915FA722CE27C4, 0x6DF58625890726F1, 0x7D7A9785219221F6, 0x57083745494115CE, 
-0xBB94CF36E6CC6BA4, 0x221491C97, 0x39E214EF379069E1, 0x659B92A674C7DFA6, 
-0x209A9F4947AA6020, 0xB97634504D166618, 0xDB524916297AE0DF, 0xCC3A9D7CE7804C7C, 
-0xFFFC7370AB05FCC2, 0xF8AE4FB3FC557502, 0xAAC6D388F4E80EC8, 0xCB36D506, 
-0xF0FB122BE19F6BDD, 0xCA442CC987F76EBB, 0x169F51670FD0BFEE, 0x269B0830E2D53AF4, 
-0x126BEB6FBFAA6DEE, 0x14C4F8B430135FD1, 0x548F083B1625E315, 0xDE1C4A877D86B6AA, 
-0x292A3ED1BBE95591, 0x275B0D117, 
-0x9EEA6E407B90E477, 0x3AC5FA322D420AE5, 0x57EAACEF47545559, 0x3909933666D1B1E7, 
-0x4CCD021C6B5B0C64, 0x633FA7D0C16C5437, 0xB79E0525B1ACDD89, 0xDCB2F3CF3284426B, 
-0xA492BA36F8118AD6, 0x22ED314C4, 0xD75FD20DE631C22F, 0x94010366320AC15F, 
-0x6C1EACDB9380173D, 0x1FD073CDF6C00439, 0xF20C6F3E65DD7A50, 0x33C0F3390479F9A5, 
-0x89D23E050155D058, 0xC2ADDC2CE40DB0A9, 0x9B6B4BBDC478C015, 0x195E71C1D, 
-0xE0D344011F1EB120, 0xC9A60604BE121AE1, 0xE39E0BF7E92C0B2F, 0x30B35BD7BDB67ED6, 
-0xAA395074FB670093, 0x2739B41CB043D180, 0xFAD598DB17B4A943, 0x23C304602BB5907F, 
-0x5BB24DE6AA04AADD, 0x137C6D9F7, 
-0x1FCC9267BEA55ADB, 0x816EDB30AD6DE9E4, 0x9C4AD30D88DC3C29, 0xB0D48055A7395E4E, 
-0xE34792F5BC756258, 0x351E32D59D852CE2, 0xD8B1557E178E53, 0x528A18742958C824, 
-0x9E4DE852CE611707, 0x2404BF52E, 0x8FA3882E43B0033D, 0x95D35B95ABB72A7, 
-0xA89BFE337C66CD61, 0xA6D36E0BB07B9574, 0x3B9A51CD4CFE9AD4, 0xBF778D3023EA6BCF, 
-0xC203EF53A9908969, 0xEE5E66081FF93558, 0x17B297F9F3D82F3C, 0x25C6E14C8, 
-0x3C75F07C4CA14DF8, 0xFB20E4B03D7320D7, 0x20A23F54ABD48DD4, 0x65ED89525B31943, 
-0x2BB8A0B83359F69C, 0x9B77FEBD2813D9AB, 0x73C605782EC1EC72, 0x3E9C3A1418820463, 
-0x5B3B6BABBE9CE64C, 0x71F47FB, 
-0x3E1151F0E62BF60F, 0xA5DC21649B20188F, 0x529F084E2CB4A79B, 0xBE0C0A889C97E538, 
-0x6902C924DBDF774C, 0x12E759631A9C1942, 0xB19D7262C84CF5A1, 0x38CAABB36F028FBE, 
-0x8510AD4355385457, 0x1E1EF0748, 0x2B96833FFF4F29B3, 0x1CF9A308FE4904DC, 
-0x32473C4B0BA74ADA, 0x9FCF97F069F43132, 0x3B952EC5DEC42A9, 0x922F857E49297BA2, 
-0x5042CFB76415D955, 0x39C245B5A649C2CC, 0xED694CB4F4F04D24, 0x1C5D41905, 
-0xEB1DF4F6981FA39A, 0x670C9A48AC5E713B, 0x26E3789046A3F485, 0x27B100BEB0DE9321, 
-0x4A305206E910076C, 0xAB9C7419CF6238F5, 0x559B86AB6AB08FBE, 0x2378A3EFFA5488B0, 
-0x20504B7015D59D4B, 0x6DBB9BA3, 
-0x11C4778AF03B9478, 0x397BD392FB714C25, 0xA7179A8FD69C35AF, 0xA46AC895FE0C5024, 
-0xC8166C71FE200B70, 0xC55FBFCEE0816CD5, 0x796334148C77B20A, 0x117D1D98F5A99B5D, 
-0xAAFC43CEF155ABB2, 0x1780F2EA7, 0xC0813AC061BEF779, 0xD5891491A27542FC, 
-0x2C8224CE19BEF903, 0xE00A5352F4F4DDC7, 0x976CF9AECA446CC8, 0x59F9A4ECD8F2E932, 
-0xD3CC9B189FD9F26A, 0x6FDF294631146DD7, 0x508C4475EA1B5453, 0x14F7E76D7, 
-0xCEE0FF8C5FD6DEFB, 0x44B0F8BBA5770FA7, 0x5DB16B2BD870342A, 0xD53CA9860452438, 
-0xE063BC85D15E669B, 0x88FB65754CC4F28B, 0xA4262C825EECACA5, 0xF3AF671BCC981BA5, 
-0x92E34DA245BE29C4, 0x249702878, 
-0x40E8C9376109F600, 0xA3E87F53B91A3396, 0x8511184B1B6C6DC9, 0xF5719E43D3F7057B, 
-0x3FAC69F3D2EAE706, 0x5CCA4263F3C36B71, 0x1E6B4A455656BCDB, 0xFFBA134995339D7F, 
-0x6BBBACDE9E6A89F9, 0x4AAC6702, 0x392520653D09FA49, 0x8E585FA681930B9E, 
-0xA71EEB4489A7213F, 0xB2BD2492F6FC369C, 0x13C075CF5ED2F3AB, 0x496C4BF54C325CE9, 
-0x6C41320E98B8710A, 0xC38F5DE12D676CB5, 0x9B473228B22BE13C, 0x1BFDD776B, 
-0x86643CD262337AB4, 0xF1252C279476EE17, 0x8391655F5D0967D9, 0xB31B0146DDFF7122, 
-0xBE17FDDD487BAE5D, 0xB26D51198A0FB0A6, 0x44959BF0D9597CA9, 0x20BBE25FD0319A33, 
-0xE751B4857CD179FD, 0xE71684E8, 
-0xAE86014D3CE4E433, 0x8DB4EB4194A0B4AA, 0xD75B08F61DEE2974, 0x3FFA8FDB08EA19B5, 
-0x36DEAA08A8BCFF73, 0xE137B9C9CA7D6800, 0xABF4B4635715B4ED, 0xC59D56CA2E512EF, 
-0xA00B5505AC362FD3, 0x194DB01A1, 0x7A1B3E9719A971AA, 0xCE598E2855840DBB, 
-0x5CC0B8AA71E92B1C, 0x70C21FA7343E181F, 0xF735473AB417A360, 0x1830373E65F23E67, 
-0xB6991D55292649FB, 0xE836A1F0C508830D, 0x9FFE8DC6C149ED81, 0x23D9ACB63, 
-0x15CE2DEBAB34E8C0, 0xF1E7EDBBFE222930, 0xD1A92C4F9241286, 0x128562245E7CDF57, 
-0xCD382492246354CF, 0xF9BBA05B2AAAFED7, 0x37567C0950319D30, 0x73680AE8294BF9F6, 
-0xDEED629782B68684, 0x1D234EC1B, 
-0xBC4ED93287F144B0, 0x50D394596663029C, 0x821963564F3F5E9, 0x9D832AF3F0146122, 
-0x82A870D5049207C2, 0x68D75AABC497C4FA, 0xA00EBB09AC55575, 0xB468ECAA33BEE297, 
-0xA9CC4BD631082A13, 0x182FE0926, 0x78569A3CAD17BC0C, 0x904F4C311E66FAA2, 
-0x5D2884507856247A, 0x576B2771E6E6E7E9, 0x6425535D8AFF44CE, 0xC906B4B9931154EA, 
-0x6E2FF69AB7BBE9EC, 0x9E0308ACB8383A0E, 0x1B8202BE8448ED0D, 0x15A1003EA, 
-0xAD504F063756B4B9, 0x48F66D8503815EF, 0xDB2A035A65D61462, 0x1E173B38062E89DC, 
-0x78FBBDFF21EDE1B1, 0x4B48B9C7C07F80DA, 0x6E0F0D05CE993377, 0x438D332B04575C90, 
-0xF4131BD0661EA0E5, 0x1813D078D, 
-0x8D9E6EDBB02EA5D8, 0x7D9DC34EBB588A44, 0xB513677741C0BD29, 0xC6969DEA28E4FD5F, 
-0x8CDDFD21BAE2DEE6, 0xA858C8A0B7C5A0FA, 0x640E8F6405A30871, 0xD369FE2DF581F302, 
-0xD201833F57C7BF41, 0xB2BE5F15, 0xDE6F8ED0C5235E70, 0x24958C016B9C2565, 
-0x3098CAE3D0D4F9EE, 0x7254923DD494953E, 0xB86A7D0110413E4E, 0xEC52D7C5A7E9AE2A, 
-0x7BB0D2BFB38F0498, 0x4C452C028AB7026E, 0xBB73BD7B857D38BB, 0x10DC28BD1, 
-0xA61D6359B6BB234D, 0x15FB85648B3EB70B, 0xF164E874D38DFFB0, 0x32A6584613C958B5, 
-0x75B7C0D033A0AA82, 0xD381F62BB4A52DE9, 0x58F98B6E4B4E704C, 0xED483222602CA4AF, 
-0xFE9CE7B2909982A0, 0x1AED7EEC9, 
-0x6973F0827B922BAB, 0xC64E5E31DEFA1A3F, 0x4E9D9CFD928882D1, 0x3D626F1CE3451F70, 
-0x2F08728FFDF2F57E, 0x17549ECEAB376D31, 0x5D3C9AAD10079E32, 0xC269B95650379B1D, 
-0xB0541E248678F2C7, 0x262E2D06F, 0x54DCE9C7E947B45E, 0xEEFC8D2FE12BF75A, 
-0x2C55ECCF4A8B5F37, 0x7D343B1753F5469, 0x5C5499D868C10D92, 0x57125C5C76D73FE2, 
-0x572A6CB45DCE038E, 0x2B49C12DA51DAC3, 0xFAEF22C54109DFFF, 0xCF76A28F, 
-0x97D5F47446DC54BE, 0xD80FCAD2CFF0F5, 0x8936B56D4AF1A1AF, 0xD292FCC72D5AC5A8, 
-0xAA105BA17BB748A0, 0x1E8C7E1F038A74D0, 0x7EEA31369CBCA61E, 0x53A8F49941EEB4ED, 
-0x4B7B0C0FB3946628, 0x18071EDD8, 
-0x4D792A755F66B64F, 0xAF636CFA7D564AF3, 0xA6C65F66257D8E59, 0xBEA5CE30636D56A1, 
-0xCDE46D984D714666, 0x19BA5714DB0D6DC, 0x3BD93312562D4B52, 0x25E4F0B687753538, 
-0xE90A5A4085DE0319, 0x1E62A2008, 0xF3A761433376F5C8, 0xA36668A30804F154, 
-0x9D1B4BA0FBF76F7C, 0xFDFDE3B4C0D18FBA, 0xBFB66A53CFA85A0C, 0xD0E50EF6EEE59150, 
-0xB0F0C1C728CCBDB4, 0xF6A709690A0AB641, 0x7A4541849822539A, 0x85AEAD98, 
-0x73B6AC1678A965CA, 0x11799CD12FD7CABA, 0x8669F0F93261C5F0, 0x6B50ECB55AD91492, 
-0xC9A63CE91E399056, 0x65D1C8D65EB18F19, 0xBB0B8BD2768C0C5, 0xEC8953D56D6071E4, 
-0x272F17D153B1B0EC, 0x1F071A858, 
-0xF9EEDB909EDCBF57, 0x72F7AEB3A3CE4CA2, 0x572654F1EE8C6828, 0xADBCC42A2316F29B, 
-0x11C584EBA53F65F6, 0x977746645EE526FA, 0xDC3E0D25188D0B, 0x1EF6C5D4861ABAEF, 
-0xAE5F1DDD7D0E928D, 0x16CE0C66, 0xC1BF76011D2B1208, 0xB60AAE7771AA2619, 
-0x12BCB54DBF065865, 0xF8413DD1F69E9E4C, 0xB7BE7E423410D251, 0xC5182FDACD3DC4FA, 
-0x58C51FD7A212390F, 0x12A2BF84793F3173, 0xE317E40C8D749E06, 0x381B844F, 
-0x8476D4EE897F58A0, 0x8626163B5E40BC65, 0x77F3A60CEB54B84B, 0xCE41C17F309FA685, 
-0x697A9ED594AFB9E7, 0xA877178520CE86FA, 0x644FBED2185FBE5F, 0x70C6215B6B0C4C68, 
-0xCF0FCC45A24FAC0A, 0x1BE5045BE, 
-0xE6D7E38574FC5974, 0x1F2611137358D52F, 0xA79B59637464D668, 0x93E9EB15A9C7550D, 
-0x6BA75D27688DCA61, 0xF71317B822425F44, 0x91B9891032176090, 0x807C1D71F6E0D342, 
-0xC3FB23AF9552392C, 0x238167E97, 0x31EBC04FDE81B207, 0x9962BBAD54A4D058, 
-0x5BEAB74A61A9BE76, 0x1EF17965B31751AB, 0x4DC6819F8E7D44A9, 0xD2C185075696443B, 
-0x1E221A3DFC0959B1, 0xAD017D11CB47C30E, 0xF2867E6744D09B41, 0x42941BCE, 
-0xEF15AC21D2B4DDE6, 0x7BAC9C1F4A9B126E, 0xF218299E143BB8D0, 0xB60ABE58161D4C79, 
-0x7058531590CAFBE9, 0x8CEDFA0D7B92CBCA, 0x7DAD8B6878675EE3, 0xA769B7A777BD2D7, 
-0x73A5A81B52E84875, 0x206813E6, 
-0xB13D75724D7F9E6, 0x28604CC883E6FE5F, 0x6F5B4EB0D088FA8E, 0x30BF655F40A6BEA6, 
-0x4103177F0AE0EC46, 0x83769A47ADA81680, 0x852E7AF5381A22D1, 0x8342DFCBB1F40CFF, 
-0xBB1F987E27D2636A, 0x3BA301D8, 0x924AA74FFD9C7370, 0x944FEE5951AEF780, 
-0xF8A90B8A1230C870, 0xD203DC9DC332A6C2, 0xD194D3BCCD854FFC, 0x915342BAD2BDF748, 
-0x9CADC7A1D932117A, 0x8EA4F1D4B1A53652, 0xB69BA068C1C04104, 0x2085CCFF8, 
-0x9B9FA95D00A5CF57, 0x16FD381C38AC7F3C, 0x2765309A60CF920D, 0xD058D6F503CC24B7, 
-0x39474958A92302D, 0xD734EA73DF170F7C, 0x3432A0745E435530, 0x81D2D7ED81703B39, 
-0xB4CDE0432278E823, 0x21BF611D2, 
-0x86D48B1584AA7D2A, 0x78F92961889D5E7, 0xBB6359D9CCA7C64D, 0xCE811A71D7091EC0, 
-0x9227D8B7EF2B3BED, 0xE8AE4CA511B87276, 0x73143A2BF492DBC, 0xEABFF03701299741, 
-0xCF6F46D6B553D3B0, 0x126980A58, 0x6FB88EF64318D9B4, 0x2F4F658B15934377, 
-0xE77C345A4B634B18, 0xED248ED7A273B6F1, 0xAA5FB77D100B4E00, 0x92087E4DFFA1653A, 
-0x38B603C6F267EA6, 0x589978A5C808D304, 0xD606007D8E95FA9D, 0x103528FF7, 
-0xBF4B75F41FD5E7D8, 0x784A10359E2709B0, 0xE1B14B0D6E61DD94, 0xBDE154B9D3BE95A1, 
-0xF31EF21CD2CD54D5, 0xEB3FD8BC867746BF, 0xA5A6788466D83D10, 0x1340C7BBC0E73427, 
-0x3BD9EE808BA33CB, 0xFD32D3C3, 
-0xE58BADF9FFB4928B, 0x64D69AEFE80F556D, 0xEFEF2C38CA4EDE67, 0x9D085D3BC683C194, 
-0xC4A14EE015106818, 0x55BC7CB840D3A5EF, 0x8F1FC395693F363C, 0x9096C7AB16639C59, 
-0xF5195825F85D9A71, 0x1B463D689, 0x80E7B81BF25B5F9B, 0x70F8E6E3998DB270, 
-0xA9FE99A70D535ACE, 0xB1D6A85A5920FE22, 0x988DA91929EB828A, 0x8C5FEC36C4A87173, 
-0xE3BDD1CB008E4CBC, 0xD6AA665C27407F58, 0xF3958F09769BBDE9, 0x243B4DA8E, 
-0xC24D7E5CF04EB3D3, 0x5873C27F0B805976, 0xCCE3B6C926E63643, 0x652E012156A7F795, 
-0x77C612327E407EA0, 0xF70BA39EE923634, 0xF0D0B0BC061735FB, 0x37D048ED59F74AB, 
-0xC31565B66CA35F46, 0x23F6FD477, 
-0x6151458B06FDC44E, 0x2AB4030C4B015BE3, 0x18A537174C9F649E, 0xE44144C87ED08A58, 
-0xBA8D2EBB25418C7C, 0xB32E5A6DF849A65F, 0x33D6FA391A8B6A02, 0x1D0650B453D54783, 
-0xDBFBCA50FB7CC8F, 0x25AD86303, 0x6DF56D4BB12033D0, 0xA4B49DADBFB4691D, 
-0xF8DC9A3D8BAE7FEE, 0x3EFE040FE4713884, 0xAF937CF8ED0E9745, 0x9A88B7A97B485E85, 
-0x4D843A61487CA30D, 0x596F094C89B2A44F, 0xC106FA313770D3D0, 0x254D66020, 
-0xF29EBF2B8B05C837, 0xB071341ECE8FC608, 0x4A8ABDBA05263B5E, 0xADB88924457D9A59, 
-0x8EF1B8C7E4E6EC24, 0x5360D84A1B5C3E1D, 0x2D8938452B74FE1, 0x8BAB36B65956FC74, 
-0x7C0B76B8FBF1FBDA, 0x1D9474F4D, 
-0xF41EFBD5AE1A2694, 0x1D52F637F63D0CC9, 0xE4E4F95683BECA9E, 0xDB3F52A0178F32FC, 
-0x1870490D8BF9F53D, 0x1B112D227FD4F533, 0xAA0F7BA0A7B9AE95, 0x76216E3C312153D6, 
-0x42D9B0B757A14596, 0x2698788F2, 0xAD5305C1E7689024, 0xEF09C3F7AD2C1FA5, 
-0xF753DCCD10B712AF, 0x1E815DE07CE8158A, 0xB4E139E530BF0FB0, 0x2EF3C5B5525247BE, 
-0xB7E844887027DFE5, 0xB38AC464206C5976, 0x422B791CF347D3D9, 0x1A1F111AE, 
-0x8FA27CCC474F619F, 0xD7C773B68359F24A, 0x3ECF56E0CEC1DE60, 0xB2432AC70C69C1D6, 
-0x62FAB4363BE4481E, 0x7360C4D6433A4C85, 0xDB71B5BCAFFF1C92, 0x8B316B82DF7E6E97, 
-0xD91AC45650BBDC41, 0x5625890C, 
-0x5FD60D3F7CC13900, 0x6D39AA5039076AE8, 0xAD50A473D4F53B63, 0x17833C36FE05B6A4, 
-0x5634A11AF1E67609, 0x3A7A3C2AC0E039A2, 0x9F6E3EFC790DBDE8, 0xF85D47CBD6D3617F, 
-0x207E43B9FFA54B25, 0x4FA56E0, 0xCE86384A87BE31A, 0x7AC8E9EC32901281, 
-0x3CE4FFFE51BDC455, 0x92B94D6FEADB2076, 0x7AE2015FD3A8B6A8, 0xF3433AD88E440799, 
-0x32BFD6371F2BF08, 0x23563E86315903A6, 0x59DCC7E8414AA53C, 0x1C20867C0, 
-0x2D2260C646867203, 0x4B87F7AF13DAAC9E, 0x3F618D9DAE767FF1, 0xCD9C82A2CCEC5654, 
-0x2199B882C4C216CE, 0x77954B22F29194C3, 0x402C5A041E59B8D6, 0x36F10A5082ECAE3B, 
-0x4FEB3331C1CD497D, 0x20F0F815C, 
-0x8A1741B5AB76F81F, 0xF75914341448E165, 0xFF28E30CEB6F5839, 0x4B23F63F6CCEE73A, 
-0x427E95653E7EA82C, 0x5BADDA12F4B8FD5C, 0x9F012BAF90A8E8C3, 0x9A976D2FCDF5CFB6, 
-0xA1071D84CDCED202, 0x217BAA979, 0x729D5E79585AE78B, 0x8E84AB7F3B4059E6, 
-0x8231C32F98A8196B, 0xDF6D812404CC52D9, 0x9E76EE01FE337C1, 0x2B32880CABC27890, 
-0x4457A2341B86F99A, 0xCF46895BEF43D0CC, 0xA8030CF1FD01A2D0, 0x8EF837E8, 
-0xF3F1955389E4B376, 0xB2EE6877D9F5C038, 0xCE56503F87C3BE20, 0x64275D48E9A36815, 
-0x592F4D3DBAE23212, 0x1433E61582E880D1, 0xB9B824D538AE7D34, 0x37BE7A6320AE2DE3, 
-0xAB0A75899663323, 0x18147BDA2, 
-0x203A070A37EB25C3, 0x1D30786826695931, 0xF2C56EAC5D52A8B2, 0x3178AB369875AE05, 
-0xDD5987251D50C075, 0x8C08F386326C1B6B, 0x232E5A55E653EC6B, 0x8E7C373086B2FFA8, 
-0xE853F111CF92E1E4, 0xFC76F37, 0x56C20F8DF5E7FE96, 0x6CCB7867ED6E8EC, 
-0x3D40B95EAA5C81EC, 0xB5D857A16F3A1ADB, 0x82019AF209EE97E1, 0xC0B673C24F368EFC, 
-0x91230F735FA0A551, 0x7D794A9E7E90C50D, 0xD48558BEB6211DFF, 0x49360F84, 
-0x1470A79A8C9E3EDD, 0x4B85C24F10FF65A3, 0x16514E107BBBA907, 0xB8AC4AF9461F6D44, 
-0x279D33098E55BD84, 0xD7E4A4E2377327CA, 0x6D3D0C9D27AEE98D, 0x2959C1116A85914D, 
-0xECBE5764F7348BD7, 0x23749EFE3, 
-0x1F48382C971DA604, 0xA22431E28ACBE82B, 0x4A4EA6BEB0C4232F, 0xE395639820265AA0, 
-0x3B16480C6B4C2F46, 0x2846DD310D0A07E4, 0x3FB997F7386D9E6F, 0x251E6BD249137777, 
-0x68850F9EA93B6CEA, 0x1D35CE5B5, 0x8CC9ABF9927AEC7C, 0xED706DF8AF0E2B34, 
-0x9AD8D3C1A9F1CB92, 0x5697FC1E60226215, 0xF92562DFDD5A191D, 0x8D4A9AB87E8B6610, 
-0x6B9EC25A07FBDD44, 0x72CA4404C16B1186, 0xB6DF89EE26586C4F, 0x13D362D2A, 
-0xDCC2F817154DFA41, 0x362D172927A15FBF, 0x23EC973897E1A167, 0x3E2215947B26E2E0, 
-0xC0D1789C104984C2, 0x8355D26B7EC52E72, 0x1202C2F7EE74AB57, 0xD08E11903F5A1C08, 
-0xA2D4C142CA378880, 0x1F076A841, 
-0x731538D31540214A, 0xE04674CE488935BB, 0x4A7410C2EACA8726, 0xB30FFB798B06BC63, 
-0x6AC32C88D5F5FD51, 0x552C4E132CFE5D07, 0x742C8EF9042B36F, 0xC41CDAF4753F480A, 
-0xEB407E3CF7F43E03, 0x1D1C425F4, 0xAF1C669402EE6E87, 0xE356940052D20944, 
-0x22D433C65D888C0A, 0xC40C5F3657B685B1, 0x4D82CBF249C6C2C8, 0xDD09304EDC8C3D0C, 
-0xB31905F6CC663DA1, 0x5D106F60BB12E2B6, 0xEBF34289B299FE96, 0xDAD65BFF, 
-0xBD89825E773C651F, 0x2726B2BB95C244AB, 0x3DA0DD9191D7144F, 0xB04D4ADAB43EC65D, 
-0x980FA9C0F363BF29, 0x58ABDE5EC0934053, 0x2DD8B460E50A21B7, 0xAE6CCEFA207299D2, 
-0xE89AB8F2CB04D1AA, 0xE445334F, 
-0x888254B7528846CB, 0x7991DCE63472F5C5, 0x470F41BB83CE9DBF, 0xFFD7D9E8D0168210, 
-0x66CA88E8DA560D0B, 0xE73D4ABEC7AF9874, 0xC2333B0A02CD19A2, 0x16B48FDA9FA116CA, 
-0x58A9BFFFB22CC033, 0x25D7E78C4, 0x99C912884D9701CF, 0x15ADE3A7E754CFFD, 
-0x9AC24BB57783D94D, 0x53B2134BE921BE00, 0x3577A928607E7CBB, 0x7434D6084B31D081, 
-0x8B6CC3A9959B2AC0, 0x1BA657D89DF9D869, 0x842962FE62E9E5C4, 0x65B3E63D, 
-0x1530FA31070D4578, 0x995C74A675D3C732, 0xB67569F7C5ACBFD3, 0x8C7D65AC4770AA3A, 
-0x1A30238184805E64, 0x470885F23BF09418, 0x1FC1A7C8A8267E61, 0x2E3F5E2E208D0CDC, 
-0x5DD305910D6AEE71, 0x1D42C9D, 
-0x63C970AE1DA4DCBD, 0xAF04A01C9AFE664A, 0x5B10B15C0D866626, 0xF0D4B205A1BC95E8, 
-0x53A9878ED5060F2C, 0xFE8B01FD194E1775, 0x18E623BBFCE434E8, 0x6DCDFEBC8A46443A, 
-0x8A322350C29B423A, 0xC58A62E8, 0x41FAD6C0943A3AD9, 0xA50B334166C698DB, 
-0x61A68274441AADD9, 0xFE1FEBE30657CC54, 0x3A9225BB342AD6BC, 0xCE2C09AF2E1257DD, 
-0x27513488EA3CB529, 0x5C3F679500CC2469, 0xE5D6A62805217183, 0x18B342909, 
-0x38BCD48EEB8A7B74, 0x2DEBA7C1D1DCDF2, 0xB8C92AD39FC872D0, 0xB090B111C7912F42, 
-0x74824A75991DBDE7, 0x9AD4E40A9B55E4B6, 0xA36F155103FFB040, 0x451E0857CAAD3B15, 
-0x42343B2850C38DC9, 0x102D0009A, 
-0x12665C556FA9A7FD, 0xC0075EAA53697C8, 0xCCE63480031C42CC, 0xED4386278CA9B8E0, 
-0xEF00E1C5FF52EFEF, 0x65F9237E39BCC623, 0x445E0EE72892A148, 0xB229630D27884700, 
-0x14E1159D554C24F, 0xE564849E, 0x1AD7B7CEBF9B95E8, 0xBBBCBCC60AF9F736, 
-0xEE14E3659F671F72, 0x8F479CD817B28B0, 0xEFA5E525099BDB7, 0xA6E989FD0ACF8C24, 
-0xA7160C1D838D6A0, 0x8C0AF5930A4AC8E, 0xC201F86E5F71E387, 0x5085F707, 
-0xB21363D2C443C673, 0x70E9475CF35BAC18, 0xC4E19D8295F2DAED, 0x71F8FEEDFBA736B8, 
-0xD8557BA1190BE07D, 0xC524E062DE64913E, 0xD1D688E0498E9EA1, 0x335C9D14EDAEFC33, 
-0x8F9F6D4E0F37DFC6, 0x1E661B51E, 
-0x763DCC0C7D3E51C9, 0xA03F32F96CBDB994, 0xC69E9C46C053C45C, 0xF450F6A386095C7A, 
-0xE7A5FA2C82FEC10C, 0xC4481CEBD9E9A355, 0x8942B6496A989838, 0xA5E1F3387832DF2F, 
-0xF9FDA1ACEEFDB704, 0x120166E6A, 0x418133E6758EB3C6, 0x8703A49DBD289C9B, 
-0xF477EC2CE088E97D, 0xCBBD1F9B0A019D86, 0x98AC1442EC8E1BCD, 0x9391283EC97F85C7, 
-0xE35CCCE4F95AFDC0, 0xDA3792D300451E14, 0x22BF54A9706A2067, 0x69FAA47D, 
-0xECAFC046E22C0E53, 0x84CE440CC84A927D, 0x7E9EC18D2496344E, 0xB11E06BCECF07C7E, 
-0x6958EFD509255E88, 0x3B9A14637BEB1FD5, 0xFC5A98CB7AD2222, 0x1E5C8AA831A24FF0, 
-0xA05F3DA3B5A6E925, 0x125E4A675, 
-0x91B5BFA843BCEEFB, 0x67524DAB5FF61489, 0xD89FC475F227C9CA, 0x2F7850D9F803885B, 
-0x1F69BDCD3D0F57CC, 0x29DB926D0D860DF4, 0xF5D0573970826CD0, 0xD7DF6CD95CA3D041, 
-0x690CD80E263DBE04, 0x22D99065D, 0xC4E725BB2EC6039B, 0xB66574EF6F51C7F7, 
-0x687782B5863A4563, 0xE79F85BE983DC0A8, 0xBB0199C8D9F3CFA9, 0x6634B3BCE10B1092, 
-0x7AE383AD07AC27E2, 0xA36E9ADAAC6E9B53, 0x8E309EBAAA6F0BE5, 0x1732D8EB, 
-0x27B660F7BE72B921, 0x685E0A69CAF1C505, 0x2B948DF62AF194E4, 0x6D5464A007A9FFDF, 
-0xD93766F089A16221, 0x6F786EDA79392BA5, 0x2F7D6BA50DFB33EE, 0x5D24EFA5A05265BF, 
-0xBB40C0EF366488D3, 0x92B9BB2F, 
-0x754A10AD4AA8523E, 0x4C6BB5B9CC50F4F3, 0x4CD425967F6C5173, 0xA3B58A9E00CAC6, 
-0xE7C2625C1BF8B25C, 0x2BFB9755DE3255FE, 0x76273C1AED19F919, 0x4E69FF5DEEC59E15, 
-0xE36F31D0EB58CD2, 0xB3A23FC9, 0xBEF9D414DFAEAE54, 0x4785FD7CD064C062, 
-0xA163A0FD820A0556, 0xAB0BC6D310BF73BF, 0xEF9ECF3428E48114, 0x3828B12ADBD8656E, 
-0xBF8D361C46B891B4, 0xA75A0005A0B4711D, 0x974D37F839FB3310, 0xC79CA993, 
-0x9F111F8FE6539490, 0xF180ED0212C32F09, 0x358B3580C44BF165, 0x6E2FBE69E997ED31, 
-0x173608772C744DFC, 0xD71DE25D13931739, 0xA838FE621E366743, 0xF115F98278EF877, 
-0x2C499A683A8E5519, 0x2623745BF, 
-0x2FFC58C21D105611, 0x8D855164D400DC7, 0x252110BFC6987718, 0x7EF72C5115C667C7, 
-0xE7C66F20C8D8816, 0x178CBE145930D255, 0xE7B3609496646FF6, 0xC480FAE16BF0DDCA, 
-0x9A923C21052F111D, 0x8653F655, 0xE8A62263C3D5CE4C, 0x12486549943931B9, 
-0xA07810604BFEFC33, 0xAE62E9AE60D782B9, 0x5C55097EAC2A4B93, 0x728624E4403665C9, 
-0xD19C09A926009F1C, 0x3BE21EDFB6CF4C4E, 0xF2441B32BF7B1CC5, 0xF5B0A770, 
-0xCD0F893D9149B8E2, 0xEAA6E2B322E5FF72, 0xC2AA7A8664A9B1E, 0x2A01DCAA0422EC66, 
-0xC91B4BED44222EB4, 0x28798B9A6C8B12C, 0x888D73302AFA7547, 0xD94511C7BC42CD1B, 
-0xFB48E7B5D8283BDA, 0xFFF4FFB8, 
-0x4E4BE86D5342B6A, 0xC03D7FDF294365F6, 0xA1284E7E0F351389, 0x8721D9C90898D94E, 
-0xA17FD27B35C26F34, 0x690FC3EAB115DB98, 0x6DADD2C48D9B828F, 0x1DC6372B2C55B194, 
-0x4437934C6D2B8CC5, 0x141C81DAB, 0x8B29BECC55BCAAC7, 0xCCC3E37A2A2A7A3F, 
-0xF82092B5510CFA1B, 0x519184E954F674DD, 0xA1D68DFA0FB63A49, 0x5B8CBAD915288BA2, 
-0x219606F3E8F983E, 0x9B2C29F037B8C6F6, 0x7A62842845FE6395, 0x61B2264, 
-0xACCD4D8DB86595B0, 0x9AF952679D35CCBB, 0x1A0C8466CF22B3EC, 0x18054DE3E3F65558, 
-0x64BE38A61E1D3ECC, 0xB4C2345E08F11BC1, 0xC7A3F1606F5D1A4D, 0x4FFC3689A21E45C5, 
-0x5E774112B0CE7FB6, 0x1B33658D0, 
-0xBB949BD530847B8D, 0x653418529B07C2F3, 0x2A3DA4EB575C7EBB, 0x3D501E434EB091C9, 
-0xDBD10F4A4E5A1C2, 0xE5E4D0B48897F43F, 0x10D692974299B752, 0x3E25792EB75492DA, 
-0x4DAA653C0E94CFBC, 0x1E63965B4, 0x5F0AC11765A7BF8D, 0x3EB0F98BA0F45551, 
-0x1FEF512B7CCE1C06, 0x91452BB5250BCEA0, 0x915D24ED41EAC64, 0x3797A980F1E40534, 
-0x38E66FE141838E33, 0xFFA64A06153377D7, 0xB7140A22DBE4D7F9, 0x118738B89, 
-0xC6E20063619CA4AB, 0x8154BA1D587AD754, 0xC75836CF52507A0, 0xBEA1C76EFFECD01, 
-0xF212DD40B2F43535, 0xFA6714A2651BB889, 0xC039E26580C5CF0, 0xCC2301C5B80BBC13, 
-0xAFD9E21753B75CEE, 0x1C4CE4AE7, 
-0x3C999D352D4AF534, 0x852BE948BA18CA38, 0x213D7540C8F4650, 0x71131EDD24C2E40A, 
-0x5B7459A239D8E3C9, 0x53D920311E2081CA, 0xEA7CB71003B2714A, 0x260B02D01770AC06, 
-0xA52757FA8E9B5C4F, 0x1F5A4669A, 0xFA38137E5398A6C9, 0x637C35C2B9B11A95, 
-0xB09E2DB2817EA4AB, 0x9A1B771B2492ED91, 0xF534B0B8C3BAEB23, 0x4F5359700345A245, 
-0xA40CFF7994A0214E, 0x1D87D114B15466DE, 0x20832F852A5A7D21, 0x7A196B08, 
-0xC68DA807686D6113, 0x9F674CAAB628447C, 0xDFDD758762A6DB41, 0xC84170F4411691EF, 
-0x28198E792AC1A906, 0x1F313F56BBB22916, 0x236642A60FB8A6CC, 0xA5C40928B6B04D0B, 
-0x1B1A01F06BA691B2, 0x20A9ED8DA, 
-0xDF96A91CDE7BC2F6, 0xE5F25D819C645623, 0xAD1C296AC50EAD25, 0xC7E75989B42084CA, 
-0xBDD5C2ED91EE50CB, 0xED84D7F507C70715, 0x923CDDACD3C3332F, 0xC82E83D7917196C0, 
-0xD12BD660ADFE3B6C, 0xD9C00DA, 0xA9AA53E96561B8A5, 0x3366B7A7008BA3D0, 
-0x3C4ED1F50D2D380D, 0xA43C04639AFCE5C, 0x21A85A1C13CB1C35, 0x9F7527FDCE55EF72, 
-0x68C0F595754A10AA, 0x3B12C2617E6215BE, 0x50A6F1C836733AA6, 0xF5A9CDFC, 
-0x6E6C286C63C1F49D, 0x2A29CEF533BF1D5B, 0x7CB4FD095266B318, 0x174DEFE4EAFF97A9, 
-0xC5E937D5C0D3C0CC, 0x285627F5D6F88C50, 0x9633A7BBA3CFA42C, 0x7B6CBA2EF693D64B, 
-0xAA4163C81CA7C3BB, 0x19F9C6180, 
-0x756DE07AB5F44609, 0x19D99BAE271C5CB2, 0x83596C48276F5B06, 0xE2790539CEFE8FF, 
-0xF62E4CBFF2DDAAC, 0xDA9CBA124FF7B26D, 0xE36813D1A91330DE, 0x8938FEE974C311B3, 
-0xEB3528BE1815545D, 0x71E0E156, 0xB1D785F8801A73DC, 0x8600BE8C55E33C0C, 
-0x187E10C72C3A529E, 0x5A6E729356933195, 0xB5284E57D23C1DC0, 0xBEC38BB7EC6FA884, 
-0x55B0127CFDCE3E3B, 0xE2EDD5C08062DEA, 0x2F566EBC88574BFA, 0x241C12B29, 
-0x140B9213941512A7, 0x7AAE03972F9BB3D0, 0xF73D17EB4F4F332D, 0xC817916CB646A93E, 
-0x2E9D6FCAF6E26DB2, 0x695EC870F3D8EE34, 0x22C22A8168A96533, 0x1F33634282FA4507, 
-0x21C83663A9BE228D, 0xD829A905, 
-0xCEF93BFC3EA622BF, 0xE072A8C8D6378BB1, 0x28A14AB0713BC3F5, 0xA4084642B2F95A4B, 
-0x6664A1A6DE6E3546, 0x8E98387759198B80, 0xFEA8E94E8F288491, 0xCA1E46E11F0B0F4, 
-0x5182C5E104A7A675, 0xD52CF859, 0x850E39D83F4907B8, 0x68AD051575B947E3, 
-0x410395D4D44816EA, 0xABDF7EE08CCF4426, 0xFD2F5F4866D367C2, 0xFAE85342B487D2B5, 
-0x477EF49BEB4F3041, 0xCC316F91658F417F, 0xE5C25914CB36E58B, 0x225E929FF, 
-0x65C375609ADF8A3D, 0xE0694FDA1B294B16, 0xEAAACC265FB6423D, 0x4BD60737602C67D4, 
-0xA46A030B21649187, 0x1A605C1ED049639C, 0x1FB7CCF6F0C82B3D, 0x7C4FBE6F964F84F3, 
-0x15E78576537BB06, 0xC4AE367A, 
-0x89C11AAA61CAF695, 0x76E33B0A66C9DCAE, 0x3DE356C58FF56874, 0x3AA6EF6DFDB6E0CE, 
-0xF79E2E6F021C71CE, 0x5E1E842D132A92FE, 0x2B52F0DB3714AB27, 0xAB0E4D275EF5EF26, 
-0xBB050FA9CF64FBC4, 0x15F910992, 0xD3DF6AD4ECAF18C7, 0x6A0E978BAC06E90B, 
-0xE6488498E076743, 0x858DB9F07FA52D8E, 0x135857E76A7D7172, 0x467A8F5E36FC8804, 
-0x2DC82085FC82BCA4, 0xEB136AC7F8EB20BC, 0xBF506FB1CE704D87, 0x133617811, 
-0xA5449548D7754F9B, 0x1DA3720D8FFF5681, 0x3C09B2E112076383, 0xABAA8E7FD7ACE1D9, 
-0x5FC71444D2611992, 0xD1C7A173A802B83F, 0xB7EE3028B71062B0, 0x473A7FC33D8E1289, 
-0xCE03BC683339C669, 0x2345AAB4D, 
-0xA4AE8821BFF63F5F, 0x1AF0018526BB10D4, 0x2E6AD8BC3C1B1B46, 0x6C062F6970930866, 
-0xD035BB446A5CABEE, 0xBA9CB66439132ED8, 0xFF99839B9C12C3B3, 0x68A6D925B9966110, 
-0xA671B5C4953A9F6E, 0x2C99FFC4, 0x8C081E2E424E27FD, 0x7AB8769F1F5729B2, 
-0x39A28F443B9A06E4, 0xD43B1E3187C02043, 0x5452C2FC04E9C6E, 0x1192D0B877B0C7BE, 
-0x477A32A9829ECF0, 0xD8DEBB29A29326AB, 0xDD2852AA42362606, 0x18917924C, 
-0xD816DE34622BBC54, 0xEF56D2993D83789C, 0xF064B5153B3ECA24, 0x34F16E299DB1B3CB, 
-0xB3A69B58620EC092, 0xEE4A8B3E9192446D, 0xD354180277B2CF7A, 0x23B73E125C2185B0, 
-0xAB8CDFDD31BDF0D6, 0xB2E1021C, 
-0x1EBBCC8567C392B8, 0x45A4D6C7A43EAE58, 0xD2655F25307DD679, 0x262B3369C00C9215, 
-0xDCD91DA835FEFFC, 0xE634D37237E4B9C5, 0xBD7468A11010D9FB, 0x33364B56974C061E, 
-0x11A04E52C9E5F1D7, 0xA5589C08, 0x4CF8AB5E4DE0E4F9, 0x3750809C7B60D368, 
-0x7BA7D4CDC3EA6191, 0xD056BE205538C5CD, 0x6450E19E6DA10290, 0x6AA842183D5913DA, 
-0x967A68C5933F9E8, 0x2B9A24F73C225FB1, 0x7E8428E55E7DB958, 0x2729A7AD1, 
-0xF91E48849C962FF2, 0xE5C7488818DE6C4, 0x2C6111811070FD4F, 0xAFF891EC66F1EDB0, 
-0xCF7ED22142322A3C, 0x1235AD106F8B0106, 0x7F4A4B073FAB7581, 0x905E32270AB1B002, 
-0xD5D67C7A5A20138E, 0x9E540DAF, 
-0x3E13196EBF9DC095, 0xA2A42B888455A773, 0x558E46B450BA1558, 0xFBC62A6861C0CD5E, 
-0x6F7CE81DDE8F4023, 0x9EEC254636E0F319, 0xC22C337F5BDA7677, 0xDA9830F1E8B1FFE3, 
-0x2DC4B7E70DAF3781, 0x201F93974, 0x69C7FC3367AD16ED, 0x7457A140AFD54B38, 
-0xAF7D02793271D96B, 0xD881EF6593716C43, 0x2425F6A12C64C45D, 0x318A2D7703F5AB1E, 
-0x579919F2DC862FCF, 0x47AD8B3743F9A5F5, 0x970A88FE96FA8B21, 0xC85F550D, 
-0xF186EDA5495FDB48, 0xEE120B859DB55A68, 0xAF14DDF9F20A0B9D, 0xA6E1A83F0AC80D78, 
-0xD8D3B0097865E071, 0x2670A77C35FA9C6C, 0xA4EE8C164F2DF90C, 0x256FADA08BCDBD14, 
-0x382DABC63D77149F, 0xFD38C940, 
-0xFD76FA53ABA996E8, 0x498B96EC73E3F9EF, 0x6717EEC29E68E758, 0x65AA9E664C5F439A, 
-0xB4019D87BB18EC36, 0x2EA3DC5CE74898CB, 0x684B0BDD8DBB2088, 0xB2E1AD4A50EDC3F1, 
-0x7EF7A263BFBC0526, 0x23875A19A, 0x4ACA209030AEEBCD, 0x486878D8D9833A2, 
-0xC11066E3596C45D, 0x223AC0F5D6738E12, 0xDD1D165862648D96, 0x4864F1610C1F200B, 
-0x997DA376D8EFAECC, 0x98D48CA3FDF8AA0D, 0x4F2259B29C57B1DB, 0x3CBFA567, 
-0xF6972B4C696B4959, 0xEAE41ED219B82510, 0xE81BDC9862219998, 0xAF0302433D6FF329, 
-0xE1E4FE35C830F23E, 0x2194D5D8D0C254F3, 0x7C6962CF4CDB005B, 0x7C523DE3C19E6B29, 
-0x9FDA4431C9D63B2C, 0xBC1EF428, 
-0x3ABEAFF39166DE60, 0xB1457C6D0704B87, 0x6786D8B641DAAE2C, 0xB2647BD423BF5BE9, 
-0x1419C7C15A8CC388, 0x8F02F20F3518E15F, 0xDFF2C9A11BB7FA07, 0xAD2AA843A505C72B, 
-0xFE4B0BF56D6E97EE, 0x2E7D20BD, 0xD3BE5FD9FA6AC95E, 0x90E0E13DDDE2E0BF, 
-0x227A7CCD74DDC04C, 0xE5B0097526EB02F9, 0x573BD5584A8E3E84, 0x3CF8CAFE5600E3A6, 
-0x8D7BC7C1A195E974, 0x3C7C651EAE33C50D, 0x9E04F49D0BC1B253, 0x25E4ACA71, 
-0x352246AB3F6E64B5, 0x45CA7B4AB0CF1D9C, 0x5AED22E075337169, 0x93348F17C5028A3B, 
-0xC0E5D42637ABE2DD, 0x13209290D9B115CA, 0xEF3332F33FC130E6, 0xA04FAEAD6DDD5F62, 
-0xED4AA026B365A2CD, 0x1027E8301, 
-0xB8D371D1A4535B9B, 0x59D8A02A90F5DA19, 0x1C3B23412198B9BD, 0x4A4542C256928731, 
-0xC1630900837869BF, 0x3A73388ACBBDAC8, 0xCE965F4E5412ED75, 0xBEF0AF451BF2BDA5, 
-0xBA478679D37103D7, 0x11E0F3F01, 0x6BB2877E0AEB57DD, 0xF3DC7E6D52626B37, 
-0x5151018772163C71, 0xF3D8ED6659CE726D, 0x57AD24C8953EC45C, 0x983499F90C4DB3AA, 
-0xD104663D31FE5CCB, 0x4AE2CE8134B73B4F, 0x10A571A16670D9C0, 0x30790CD7, 
-0x3DED0D19173914D3, 0x86151A214D1D7AFB, 0x59483D66F4A207F4, 0x1A2B86AFF634FCD6, 
-0x77BA4A5102DAE3EB, 0xCFF0DC5F221A5B92, 0x8178D10D92C724B8, 0x5A4AB5095B82C5A1, 
-0xB11559C36784046B, 0x245D93820, 
-0x5FDBFD64BAD1CF6A, 0x7E8DE5BE0F9702D9, 0xDB4FC8664FEC408F, 0x776F7C993505D0C2, 
-0x3BB363C15A036C22, 0xD43D2B8B14E65DCF, 0x91C862EF8E5880E3, 0xA9C78B7FB4063A88, 
-0xEA0CABC25C3286C3, 0x62C30F36, 0x5C9CC4CB803A182, 0x4FF7B5FC04C7A8F7, 
-0x60F6587962FC256B, 0xF5A361D59823C27, 0x80CE1B22C2BB9562, 0xB1A44EA5E6C2A491, 
-0xB3DB5DCF94904A16, 0x63B802C7A2E32910, 0x3148C244F15003B2, 0x20C7438EF, 
-0xB1BEEDE607683829, 0x43B31D7F8CF6F63A, 0x6EB311EA4938AB79, 0x8396270E10B589EA, 
-0x9123B111C3D9AB74, 0x35D268F9150261BA, 0x42675809C0ECD498, 0xD642B4487BF39FB, 
-0xCF0FEE6D975C0BF0, 0xC6529582, 
-0x5DA52DE2E62B02F0, 0x8AD499E1D30B71B5, 0xD150DB9FDB01AF9F, 0x22849B2AFF2FEEE3, 
-0x2A9BB481B64461AA, 0xBDE0D7867F35DD76, 0x106B2FC48688AE0, 0x4E296EF9F5658A9A, 
-0x74BD0DC8A72456FE, 0x10A432664, 0xBDC781D6EAB85413, 0x1F6B72302B6F7437, 
-0x83609B5F775E5DD3, 0xBD284763B66056D3, 0x4187EF60E9115701, 0x45FC3392FF997702, 
-0xC816564334EDA76A, 0x2E069C976C6EB91D, 0xEE640D22DFD304F7, 0x13DB1DCAF, 
-0xC652E92E49B7F7CD, 0x8A36721FC2159DFD, 0xEE0C2DB716CE6358, 0x358BAD009C67E421, 
-0xCC23F014446D8AB0, 0x674F5B0C1D9E3D4E, 0xB64E9575A013FEAE, 0xC41B28D1370EE4C4, 
-0xC805538035FF1607, 0x93C1EB96, 
-0xE691943DD99B64C3, 0x69E342214B22EB44, 0xE64C8FA68312CAA2, 0x8527AC642DECA70A, 
-0xEF3B7DDAAB73DDA, 0xA730C91204F5DA78, 0x1079839ED0960C60, 0x8EF09BC8D9F97BDE, 
-0xB20ED42772429620, 0x26824A853, 0x571E9C8D909F906C, 0x1C2F274697A0DE4B, 
-0x2ED47380C6AAD9DD, 0x2748EA50CD296289, 0x444669CF3B7478F9, 0x1235EBCF7ECC29F5, 
-0x7D91D7E64D9941D, 0xAA186C7AD5103363, 0x48579431F80CBBE5, 0x8EF4B421, 
-0x3B32FBBE2DB2BC9F, 0x24DFE9DD88711824, 0x73B1989BC29D8584, 0xB8EFAF902A50BDB9, 
-0xAE70FCACEAA8BD93, 0xC84BBD15BBA034A8, 0x4235C4E1BE2ABE76, 0x2CB69E58FF330EAD, 
-0x4F2C8C52A2769A9, 0x275AEC34D, 
-0x66E4B3BC6D503D2A, 0x967DDC2786DA3FDC, 0x75DE885CF7077A28, 0xD0288C02809C42E9, 
-0xDF4C0C8F0E59D67E, 0xCC7043DD7D4B15A2, 0x9FE1D369BDB20957, 0xC4B4B251DD69F196, 
-0xAA90E17EFAB7CC6, 0xFD8C050D, 0xC9C28A5F1D4A607D, 0xCB1FB025E68AF2CF, 
-0x1936CBB5A252574E, 0x301C1488C512D81B, 0x74A84B4D26E3DB9B, 0x8826758EB226CA7B, 
-0xCC3F25C91DC5190A, 0xA30A13ADB1404396, 0x4638B7DEF1FF8366, 0x126C77397, 
-0xBBC24311B22BEE1, 0xAA26492DF7FEE2AC, 0x37613616E23B9490, 0x3D288FC114138A32, 
-0xA04622912DE0AEF2, 0xE516AA8786FB3B64, 0xC681F1173291948E, 0x810BE75C3C995C9E, 
-0x48D6E4625744072, 0x2693FA1BD, 
-0x7C4495E28C08FB40, 0x6CC20EC7C5501A6D, 0xE1A423281D5727D8, 0x3CDA803A747AE42B, 
-0xF293BDFE899FE942, 0x6A63727D6EB6A7B9, 0x4F577551A8B93A75, 0x9D4FE5F3F2A6C738, 
-0x2A52219A2AB66B2C, 0xEE73A837, 0x76DF701AFE0A7892, 0x9C01ED466F2C4FDA, 
-0x1EB87874BF72C942, 0xC22A46E7CA64CEB0, 0x40282D499F872916, 0xE6CC47E467A1C936, 
-0xE4720EDF18686A2D, 0xDE157AD320F659A5, 0x28512D44AB3D19AE, 0xD92FF5E1, 
-0xB80A80FD2F99F5E5, 0xB0C648671D058E3F, 0x34933005264DB7D7, 0xAD514A0980ACBE52, 
-0x64B81574A82EFA99, 0xAFB2AF6776022E88, 0x808C34FA35FD53A9, 0xC25994A4D9B06CF9, 
-0x10D46CE00D4E1F41, 0x192860BD3, 
-0xE3CEB0FAB5C3B9EF, 0x3AF90E09AEBFF02, 0x7227045F656C3C36, 0x221CD85B3F2E9139, 
-0x82986E2D3BB7C0A4, 0xBF844AB18BF02E11, 0xDF10E1B7AB5B277D, 0xA370AC999D3513C2, 
-0x1A1EF9E71E4B2688, 0x17919AE71, 0xA389C48D3968F3D7, 0x6DFBE9608EE8DCD7, 
-0x14B8BA30674040CB, 0x1A41A5E3B1A737CA, 0x9C88FF1429C60C17, 0x55882E4B4E4B409E, 
-0x2560C7465957AFC9, 0x26822C716C02F0DA, 0xC8B691285F10AE6A, 0x278EF07ED, 
-0x7D398EEE46D9347E, 0xC098092213D67999, 0x33FD761B970885D0, 0xE2B97C428DEF6DBF, 
-0x75F6AD9BDEF9CDCE, 0x7D40893748FD8573, 0x7FC848842D59C12F, 0xA34C8FC72205F1F4, 
-0x766B8C0058E83EB, 0x1324FD0E1, 
-0xAF0D1780F3C98E2B, 0x9205F12E21EF47F8, 0x191809A403552F0D, 0xFB6EFBF4B2C4C9D7, 
-0x3DBA39AA7A88748F, 0xFC49A0B4DF1E28, 0x81D083F6D2B4B31, 0x9DD30B48CA4DEA40, 
-0x86E0951C7372FB69, 0x22E552E72, 0x38C19A28E142FE07, 0xEF2AF32D5F2ECF78, 
-0x9AC7734A0910907E, 0x4A7E68756F234589, 0xB3D9DB49F6A8CCE8, 0xC42A1CED1C9EFE07, 
-0x1C3984B9FEE33B29, 0x2B0ED24F3A456F5C, 0xDAB17C348E29BB01, 0x1741C17AE, 
-0x209F42F8455894F8, 0x6FA8A3A1B7BD3BE1, 0x9F32DC8B3C0FA504, 0xBAB1B4758D6078DC, 
-0xD52D3CC33689B40A, 0x9B3E0ADED2218157, 0xE5CB64BA7A79EBC3, 0x98F145A388451DE0, 
-0x5EAA8449598957D8, 0x25AC64FBA, 
-0x67205E15175078E, 0x894BB12AFE2FBCAD, 0xE7C2B8FF7C89A4A4, 0x3CCB5C538771A30E, 
-0x1AFC884966422A98, 0x3226153F17164CED, 0x2880A9F90F294C6A, 0x30EE7C6EBF29F024, 
-0x3C6FDBFCD1B524A5, 0x254215F1E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x13A2C637E95545A4, 0xCE90FCF423F58113, 0x59162A1251761C47, 
-0x22F6B23510F407B0, 0x3FB40A7A3898A0BC, 0xB3BA446746BCA3B2, 0x7A837A4454F01666, 
-0x79A9A22B85C4EE99, 0xE1093BD17C27343A, 0x1737968C6
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
-0x2C9E53071352D43, 0xEF4088AD3E54C6DD, 0xC18E7055D2CFF348, 0x24B3268C87D5F690, 
-0xA3E6D94ADE7B0A93, 0x489BAD43902F0B0E, 0xA1A300A465CBB34A, 0x1E3D0279D17C14C0, 
-0xCC6901CA8B4EB6EE, 0x6DEB13A0, 0xB84B1E242A63879E, 0xD3A74C3D2770FA06, 
-0x49DF32C277DE73A3, 0xCA452CB04EBA1741, 0xE36EC74B21763CF, 0xEE808C414124F7B3, 
-0xCDBC7C4C7FA2F565, 0x6EC6A04436A3B6DD, 0x655153FCAC56E490, 0x1C8AE36CC, 
-0x49FBC511D3BA2DF8, 0xDAB619C2019157EC, 0xDA5C5F3D92BBAE54, 0x49DFA8B23EA68649, 
-0x4B0ACA57CA833E4A, 0x5897077C5879B49B, 0x2292FCCA2466BE33, 0x67ED07E1BDBC7A44, 
-0x524DABA6A86CF688, 0x1A291037F, 0x66B1FBDA9D4C0E29, 0xF387AF93CD5EDB70, 
-0xD7046A31DFDDCF13, 0xBF285B931FFC64B3, 0x200D028613109DA4, 0xA8503FE4DEED0131, 
-0xBC04855F33EE906, 0x287557FA56072977, 0xDE18AF410CCD4F3A, 0xF7B7EBD
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
-
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0xD8A293B6CF2BB40, 0xE1B641C07DDEAD64, 0x752811982A639080, 0x5EF082EEF14391C0, 
-0x4E69530B77F63838, 0xE5342EEF727F6792, 0xF833326993E90187, 0xACCA058E8710D072, 
-0x55F4B4F98DF5D0C5, 0x24DBF832, 0xAD40559D73A22753, 0x4FEA70030F3D7C30, 
-0x9D351D611C377861, 0xBEDDEEC5B19EF48D, 0xEB85498B19F2BB0B, 0x81699D09B184FE3B, 
-0x5192C626B954608F, 0xBE03D730E9EAFD39, 0xB1CB16413A4315A2, 0x16254F779, 
-0xC8864C028ED7D0CD, 0x5915417919728699, 0xFD11B78802FA9E8, 0x69FBB78B682C26B2, 
-0x65F142FD521EF5F0, 0xE5F9EB77B3BE7118, 0xFE0A2027A9ED7638, 0xD7BA06F4CB96D138, 
-0x80F1310134488F3C, 0x45BF80D6, 
-0x535C6E813E9D518A, 0xAD64453323044A7, 0xB68696F72CAFB024, 0x67ACF707BBC8B400, 
-0x4DEB973E18A70792, 0x64C75184C18B7735, 0xC143A2C5B37680B4, 0x37002C2DB2585AE6, 
-0x7137052C44ED8446, 0x50623905, 0x25AF94FA7F46084B, 0xFA16E40C4015BEB4, 
-0x30B5F128BD2D717D, 0x3001A48F6C04ABA9, 0x1EBAC5083C31DC97, 0x3E2216F817DFD05B, 
-0x34D63D8988B80FAC, 0x53D6DBBF58318C8C, 0xEE135C318B0B4FBD, 0x61BE9479, 
-0xDCC602C47929F513, 0xCBB3BA8A118AB151, 0x3561D931143F076B, 0x7A5650B3B71E4440, 
-0x81852B1B6CB1C60A, 0x19A793E2D2032748, 0x209ED381A703C869, 0x90DB88EBE4C731E4, 
-0x7AA62EF4EC9D7127, 0x1615D6152, 
-0xB7306FE6C6C844AD, 0xCADFDF1D57932310, 0x4FB22989A00760AD, 0x4DE5D4CCE59DBC2F, 
-0x9AA0897142B34383, 0x7DD86FC4567E949D, 0x9260F5E77BF68C2B, 0x7A3E0578161B1F91, 
-0xDD7175E107F0E9DE, 0x2313D9822, 0xB209045D4051D0EC, 0x27A160D0E5FC64BF, 
-0xCD99808EB0E7CD46, 0xF89ECDA143F74D6C, 0x416622BF3824146F, 0xFA7FB456AE512FB6, 
-0xB0E4F93CC69D314B, 0x97729DC4A7F13D8B, 0x5C2D47D495FEB5EF, 0x1079A6B9A, 
-0x9AE4D9DD682A3F7C, 0x7DB6EBEA0F950DAA, 0x7E32B56F928BFBF2, 0x89BF1FE99DC0BDB5, 
-0x87612D25779867BB, 0xDAB5C143F03C478, 0xCADFA7901D346B96, 0x6A760FD92C65CE15, 
-0xACF2085B33A86416, 0x198758E70, 
-0xE3EB3AB8143F2340, 0xDAE56670F6991736, 0xA79D1B2DE9F5E2B4, 0x490044836A4C4FCD, 
-0xA6E9EEE8B7FF06AB, 0xA7D5C63BB0227849, 0x25D81CBF5F39EF75, 0x949DCC7DA7D8BE9A, 
-0x4A7DE4544BFED9CF, 0x179E0634D, 0x7503D6D3CFA98967, 0x7A3DBF374FD281B5, 
-0x8503065669A8E21C, 0x8550407D68B26BF2, 0xB177C65F71B8DB7A, 0x5A0D45B0B9A837CA, 
-0xDC8077F4A3FB45C4, 0x153F3C5CB9E7C411, 0x17D2017D1D0E9A84, 0x2E11E8F, 
-0xB706C3A63A31B996, 0xCED12C91DEFD3A2F, 0xD463340FCCF53A95, 0x551D854425B67A71, 
-0x28DE78F7E4FB7D17, 0x6E194BB2BB980245, 0xF5B88FB1AEE07F32, 0x85F35A860C5069CE, 
-0x5F90EA8F44B15C19, 0x1AB064103, 
-0x5F22068AE94C4166, 0xC7432715BDAC1304, 0xAB480DDE9A1BC065, 0xD162573FDEC6853B, 
-0x35DA082590792F4C, 0x2DEB1D9A1F6B404E, 0x604CE900AD128374, 0x8F33FA9A1D79371F, 
-0x3D7A20EDA39EBA74, 0x11D8D4C4F, 0x4495FF76C0BEE7A0, 0x3AD1B456FDD7F86B, 
-0x12AB903D9992AA49, 0x8E3BE3D4211FA9E7, 0x6A9534CE89C10EF4, 0xECBBA15E69F5C65A, 
-0xFDDCE4D0CE5CBCD8, 0x481729622964F7A8, 0x36377FB17C18D508, 0xFBE3B978, 
-0xA3C3156AD16D1967, 0xB588C8A52CE721EC, 0xF6E7479F9D828F3E, 0x40FF05D220618A1B, 
-0x74EDB36E785AA55B, 0x2BCF392004736123, 0x9E86DE8F1E9DCAB1, 0xCDBD9B5424A7145B, 
-0x592DC689502FED68, 0x11366FFE6, 
-0x13BBB9C1B414E1C, 0xD9AAE4D9D8B2AF0C, 0x6D732141024FD8B, 0x437658E4F1FC83E2, 
-0x6AF94F0A48D4088C, 0x3526A5FFED777880, 0xC0AEAF3F9C1BD66E, 0x5ADD0233869DAA1C, 
-0x660415191C524BA2, 0x1B1C818C, 0xA0B9F640337949B4, 0x743D4EDE527AD851, 
-0x2B0805A428E85026, 0x4B8021D7FCA4208B, 0xDC579898CFD992AA, 0x9DD7BD0AE4FB28A5, 
-0xA2CBE0BF4FE509DE, 0x34697254C6428572, 0x327B9DCFD35FBD38, 0xCC1395C9, 
-0xF1361CB3925213A1, 0xDC63BF3604B80029, 0x5E5D30D348944CB0, 0x8BACC140FBB0CA2A, 
-0x3B4B28636898829F, 0x67C2F0F0545F5FF6, 0x921EF314EB6E797C, 0x103F92B66822A959, 
-0x673BDF2F3FA93052, 0xF60342C0, 
-0x8F9948543B99ACA6, 0x36F97D42A2D36739, 0x7DBAB23D616B79C8, 0xAD727678D082265F, 
-0x9AA4ED08A53063F6, 0x62A93AADCA656130, 0xEE4EB68243F93FB1, 0x919EF72927726452, 
-0x43387AE2E23418A, 0x1A8D88C04, 0x114A5F37C004E7CB, 0xF214DAC001515C4F, 
-0x341693E0B4C0FDB3, 0x84D8576224802B1A, 0xE0ED480067011D08, 0x1A2BCC2E5532D8BC, 
-0xA040F74C0C3D2A48, 0x9C77DA5CBBFC1E72, 0x440E480406862351, 0x16FAEF420, 
-0x32FC47412AA23764, 0xAEB94B77E74747F6, 0x4A5DB04DCAC62563, 0xA966ABA8C195D200, 
-0x6D573C118E654059, 0x2FA9AB15674CC9CE, 0x161EDBB4AD079952, 0xCD9A458D8C76B2CC, 
-0x7F007FB0DC570B73, 0x263A27A36, 
-0x2BED0C1FE378F2A8, 0xDA2A696BC0B3494F, 0x50C4F1CF4E48D8AB, 0xDFCD6052BA3FAC7A, 
-0x8335F1E373F5AE6F, 0x85C65A19416959AB, 0xFCE4314639429572, 0xFF7FDF47AD3E1FAB, 
-0xFDB0F6514C9A30C2, 0x78783D53, 0x230D045A79B18DB2, 0x1E68580164026785, 
-0xD671CE8CAB69255D, 0x1134FD7E383D9F01, 0x29034B57E92E00D6, 0x781A01B4CB80F823, 
-0xD5B0BEE3168BF4E8, 0xC84C3CA6DAA23D1D, 0x278D4719D946E4B2, 0x1E90610D0, 
-0x7048353A8BDC45EE, 0xC5EA8E4DF6503627, 0x75D7FD7A14AC3D5E, 0xAF2A17C0FBABF167, 
-0xB2F06FDBE7168BA2, 0x61CECB7C4F8FA68C, 0x11A1A27F43B0705E, 0xFEAA2B8F812D86C7, 
-0xE469C3E3B3559E03, 0x18240EC9F, 
-0xA92675E44A8C4C37, 0x658E0A94E9D4D9A5, 0x6BC9B662F494C1B, 0xDAFE8559BA3E1DF8, 
-0xDE44293B06D5A0CA, 0x1A7F9CCBF38731D4, 0xFCCB6B8068CB4CCC, 0x59AECCD0BC88B911, 
-0x7EB6963EAC6DA86B, 0x187BA26B2, 0xBAB5987121504DDB, 0x366C3B3DF4114A58, 
-0x2EEC6F679CA0C63C, 0x6C070FA1C6EDEA55, 0xCD878F98CF05090E, 0x6F5A044649225DFC, 
-0x7081A7B7459EF13, 0x1F31F9530B2DB722, 0x412FABDF800B31EB, 0x148B46D40, 
-0x495AF93A016E5F58, 0x46F75E958C209690, 0xA400E4CCA631A6A8, 0xA82752772D4A4496, 
-0x89BCEFC688FA5429, 0xC5A5483286443D0F, 0xBFBEFC4D167ACCF3, 0xA45795FF298A98DC, 
-0x6CB2FAED780DF603, 0x5A4E860, 
-0x74F374F3AFDDD98B, 0x44C89434120D6D2E, 0xF401B2042193889A, 0xB93371C269702247, 
-0xD01997514733E4D3, 0x48580EB8358BCC72, 0xF040C70DDE52DAE2, 0xB89401A0BB11FA5D, 
-0x9CBED1BF6FBAEB3, 0x13CDF2630, 0xD66A304FD62CB10A, 0x5B5F6AC0883DC531, 
-0x41C3E11A22F343C3, 0x499823BA6C3922A6, 0xCC2F58B528A4EC64, 0xF91BCE15545EFA56, 
-0x9B00731D9A250208, 0x5142E922E648D89A, 0xC1B3F3739F808B89, 0x14D663531, 
-0x59AAED308D3B1704, 0x5CF6CDF81E0B0FDB, 0xCDFCC18AA85D884E, 0x83AAD261D1D6216C, 
-0xEF9D9332F29B9805, 0x3AF7649EE92D4F8E, 0x2BA88ED38A6C41A1, 0xCBA08376808CEAAF, 
-0x66E9914C13EB39B8, 0x1FCA1944, 
-0xD3D42403679AD82, 0x62DBC05C75294BCA, 0xE621CB241200ECB6, 0x6360EBAC16390DA6, 
-0x336FBC81DF7482B9, 0x3EEB6169B100559A, 0x784432B3F3631AF1, 0xEBE5214715ACA3F, 
-0x61F930A38AC1C914, 0x1C3F2DCB5, 0x4B7933C7EA55A06, 0x38807524175D9E98, 
-0xF6B8841D7F83A4A4, 0x69DE1EEEA7509380, 0xE98831716E539DB4, 0x920B78B60CD4E9E6, 
-0x669165E748E8CA78, 0x296083B2D2C98BE4, 0x55197B31435F32E1, 0x17436B5F7, 
-0x56B471BC3178BEDE, 0x5E024E620DFF6883, 0x8E9D78FB5ABA96D4, 0x7569549D47F84F24, 
-0x7D0A66C2029075A5, 0x16478E4B61EE69BB, 0xBD72EB2EB1A90D44, 0x80AC7479F21D9E24, 
-0x8B212D95644AD21F, 0x143A4984F, 
-0x28B5AF5D56CDBFFC, 0x528CB9D9B21CC751, 0x72D66CC56F07FA93, 0xC1210F83201EE242, 
-0x6916FF2CD2A8CD73, 0x186C8E31B277DE6A, 0x646D3D76ACBD4965, 0x43A2A3081CD0C090, 
-0x16059CDC55D8DDBF, 0xBA5900E, 0x192FC0A416495766, 0xD9AB13F2A667A98F, 
-0x891AB6E2EF60C157, 0xD218A531C411B34A, 0xD2E05758A116E190, 0x7A5163330070EA6C, 
-0x482EDB3DACF094BF, 0xAF9383D30193419A, 0x8B268C74BC4E749B, 0x8184D5F0, 
-0xA172DBFC9CADCE6B, 0x2754699F27C56FEE, 0xB8F2EE436D9DB687, 0x4B12A71BB0758D50, 
-0x156E8F7635D205AD, 0xA58EE00AC06C3BA6, 0x1DA197092F116EF0, 0x20F9A93530ACE49E, 
-0x9935E367B10DF943, 0x1A2165C35, 
-0xD60B3DE7D04B4D80, 0x8815DBC4E44E3949, 0xC120B9BC6535BE7A, 0x4334403ED19F8D29, 
-0xE3269DEFFE38083B, 0xB066EB77DA9B1CA5, 0x85D7EDB2C71559F3, 0xE69AEC407C4FD60D, 
-0x65751C3A74E029CB, 0x1330C7AAE, 0x2681CDE9AFB1EFD2, 0xE6B61A7C87E4849D, 
-0x55495CDE8A96479A, 0x229446DBB1932328, 0x70EDF88FA8EE5F0D, 0x4B2511B06B9DDD93, 
-0x703FFA7685AB4275, 0x3D1163B24F38E828, 0x3A1B34198EBFDFBA, 0x16C893BF8, 
-0x8A08D4ED3362009B, 0xCEEACB8BB44BE9DE, 0x8961D64EB8CA89A0, 0xF8381AAAFD9F5D11, 
-0x22C56EB5C7DA1592, 0x770A0671AF79C0D3, 0x86B99FD0A62CDFF2, 0xF2B41EC94289C975, 
-0xDF3CC4DD537DE087, 0x2201BCEF3, 
-0x2AA8CD224B2F7D6D, 0xA6734DABF1B6BFED, 0x8010A84842280324, 0x104C2556EAF398E5, 
-0xB188B68834B313CC, 0xA0EAFD30AFC12DE8, 0xCEF3BAC1BA435682, 0xDD7293935A5E5D37, 
-0x75A4C9ADB6BDBBAD, 0xCDDFC49F, 0x63EA2C96339E24B2, 0x4C3F97341C55C784, 
-0xA3974C7A01DC0F91, 0x72616595A7342D84, 0xB7958C056A4A1F02, 0xFFA025C32A63C8B, 
-0xA9FB257805E123DD, 0xAED191BDA4085C54, 0x12D2F4D76B5CE484, 0x1AFF682C1, 
-0x87C03132A936A5B3, 0xB553676B57FCBC5D, 0x39067649CAAF734A, 0x69F0C81D2BE357C9, 
-0x69B41B8C5756D129, 0x47F50EB03D7EF088, 0xFB2A61CF14F43BEB, 0xC65A6B0A530672E9, 
-0xBB159DC1AC175C6B, 0x210CCA106, 
-0x1640B0318C462826, 0x6AEC0D11CF5F1EA3, 0x9B3A4CA591917194, 0xCDAB2BE379984218, 
-0x2763FB622D58A965, 0x66E25E7CFB808E9C, 0x2DEB005666D03312, 0x59922AB6C7454D82, 
-0xE3A1BE83680C0D75, 0x20CA9844F, 0x8C6B9C391A4D94D8, 0x12F89D9CF053BF6D, 
-0xE9026ADE0C74B24, 0x4A06C288C4C46E42, 0x479B6699573D91D0, 0x14630ED1B17B6165, 
-0xE1036C2B198DEA43, 0x463D14DADFA2D7C1, 0x32BCB895A5597179, 0x12544B648, 
-0x63472E2CD585A951, 0xF610C3BA6E356666, 0x289AAD47B7E3C0EE, 0xA7E1D26EF70E4868, 
-0x312EB338F08A9961, 0x1253FC5BBA3515E8, 0x49F306062D992603, 0x6C083754F9F8B791, 
-0x53F299CB9249149A, 0x1F7AE9E8A, 
-0xFAFA7038F98ACA3, 0x3587A7ADDD62850F, 0xBFC0D0555338C346, 0x49F0225252A047F3, 
-0x83DCBD167BFA5429, 0x4175569B93323F5C, 0xCB61DF6362EF1491, 0x5205BE9E01A38294, 
-0xCF84BFF4EEDF165E, 0x23D3431E5, 0x9BF2CD69EF0EAA0A, 0xAB6336EC548E87AB, 
-0xDD8B11B294063FA3, 0xE01F6F890639B576, 0x7416F6C266ACC44C, 0x239BFF3120466A1E, 
-0x6CEDBCC733143B00, 0x8A36D478DCF9FEE8, 0x7224E36B685F2B57, 0x599F8DF4, 
-0x789C284669952B5, 0x1D8162DD3D730A08, 0xEB136E49C82EF7E5, 0x75224A5398187B85, 
-0x47DC4FECD3A32FB9, 0xC4FA0F31758940C5, 0x8303B8F766ED82BC, 0x3B9957A4F623A483, 
-0xDFCF87DCFE83BADB, 0x241E755CA, 
-0xC1EF4933FCEE677E, 0xAEF34A2D8CDA036D, 0x49D8A63D61663C0D, 0x43B856CC72ED457A, 
-0x897A9DD7571C3983, 0x95554C1070A3188C, 0xB10BC5D8F6A0D62F, 0xA6B9633BDCFDDA97, 
-0xB067E99984D1F23B, 0x12DA40E31, 0x6288F3663EF7B740, 0xC930178F7535C7A8, 
-0xB07C04D81B422E94, 0x60CD417134853362, 0x643A14DB580B196, 0x24CC07A55ACB952B, 
-0x16493E1849FB2B87, 0x2A252D48539D6975, 0x4A5237B3BC682CC9, 0x15028C557, 
-0x987A15C4130C74CA, 0x6C095214377DDD5E, 0xF316E6FD9F15953E, 0x820B30BEE5D2165, 
-0xA4DE814F427D3A41, 0xCAD3D6ECF45B9F1E, 0xC137DA104C7ED63B, 0x62D7F7A52A46D5D8, 
-0x90E738C4EE435020, 0xF87B0CA2, 
-0xB3C6DAC8DF38226F, 0x5DCF7654EFF59EFF, 0x738D97792CC55170, 0x37AABEC24B49DCC6, 
-0xEB13354793EC4681, 0x44A578A47FB958A5, 0x70AE96107CD4D7FF, 0xA27FFB8E70B5EF8B, 
-0x7E0C181CC1244B0A, 0x1803147F8, 0xE3981C1B3D6FFB3B, 0x33596926B5AC0DD0, 
-0xD087876F64358F0E, 0xE3AA8C4F665C7900, 0x17C71B2D2F59D589, 0xC40CD420083D498, 
-0x8DDB6D014FE616EE, 0x9420E07FDA295641, 0x4EAA592CC5A119F9, 0x19B35B42D, 
-0xFC4500E4C26949B0, 0x982B546CF31AEAB4, 0x2AF4DEC11BED37F1, 0x7655399D07634B79, 
-0xBC85835D0DAC01AA, 0x29E6C408370F2FA1, 0x2F9425082637E63E, 0xC7084A427445D001, 
-0x30CDA7A4C730C08, 0x1F7A786CD, 
-0x8D1C8FE5C4A00803, 0xFA789D51B48F1BF6, 0xC08928E058969E6F, 0xCBC918BDA08EDB63, 
-0xFD02878DD8541000, 0x5070E83BB4E23F43, 0xB1C84B2944CA5781, 0xF8F2658F434D00A7, 
-0xA6DC44AA3D4C7609, 0x24CA26CD5, 0x663FB44962F9CB65, 0xAFF90654B288A114, 
-0xED3F802806278D33, 0xE2FE782498ABC9FC, 0xB53DACF36F4C54DF, 0xB4CA7FE0B27F059E, 
-0x319F6CD7DC53ACB9, 0x357943144D3A6D81, 0x636CDE5A52714B87, 0x10AA67425, 
-0x61AF98AF02C824CA, 0x4E0FF5D5B759065, 0xFA528E52FBC4052E, 0x346AC7BAA42A32E1, 
-0xA465A42367548D93, 0xED6D5FB47AE9917B, 0xA2C6F46A6D5ACF1, 0x1D29D510859B47AA, 
-0xA86DAFB670C79D61, 0x1881BC315, 
-0x7EB25AB2A364993B, 0x8B910F9B746725CC, 0xE71BB1C25FA868A0, 0x80189A7087F2DB1F, 
-0x83789A429A6ABF06, 0x2BA4F4B1C62167BC, 0xAFCD849827D6BD49, 0x8A5E5496AE4BE71E, 
-0x83A8D751BA71C30A, 0x23FE1C14D, 0x57132F11E208A443, 0xF5156E2240348DE5, 
-0x950561759897B22C, 0x9F06039D1A5482A3, 0xEC4FCAC98AB7BE08, 0xADF03FA4A23F7741, 
-0xB373A34A11C45908, 0x493E052653698F3E, 0xCB9397591ADED3BB, 0x83FBCA3E, 
-0xCB7A0CA10079325, 0x564E707CB9FC2B02, 0x13FA1051A22345C5, 0x5FE29BFF0427BD95, 
-0x5A46D53D7D95268B, 0xAB842510995F9FFB, 0x9125C1681E78AE50, 0x89AD57D3C52E3564, 
-0x802E1B23027B8D79, 0x26D0BB4AF, 
-0xB774D4813EAC11C1, 0x4AE43F37B5812D1A, 0xD08C33FBB8CE45F1, 0x830B77E63FD61E57, 
-0xB26C2992ACE8447B, 0x6F0AC440ADAB63D6, 0x4CA1B43F6A5D77D4, 0xE1A4C6D9797268E9, 
-0x60F6D7C7219B190D, 0x19D03420C, 0xC401F3BAEA2667CA, 0xB3774F1C8E2F219C, 
-0xA4190419A25CD5B5, 0x69ED88E124FFB00C, 0x1C1E5EC98660A645, 0xC134D7E9CF2AC0F9, 
-0xF1B8DCD6FECDD4C0, 0x7DA172324199D67B, 0xB2E6ADDE2A4FE872, 0x1A97A1FEB, 
-0x521A25EE041D477B, 0xB9D76C6350085B8F, 0x4607E17146DA2C46, 0xE64CB2CC41DCA660, 
-0x12D44999E012E118, 0xB27C33A5B745F755, 0x51FD062F3EB47143, 0x767D84EBD3661646, 
-0x7ABAF0B7170B871B, 0x140102334, 
-0xD80E7FAD10CA2F6A, 0x2C7D6538223E1E4A, 0x751708CD3068606C, 0xDA3BAFF229939A7A, 
-0x6D6540039104F608, 0xE403EB54CE9956C7, 0x73EA5DBD291EF88D, 0xF8D19A9F0850969E, 
-0x9FE5A3890FC87325, 0x1F9571FBA, 0xB659676C1A573C4, 0xBEB887BCCD59A54, 
-0xF0A78B8794E73A4, 0xE1FD48896FF9B4E3, 0x1BF78DDFF3B8BE7B, 0x3DA0237E3A9FD395, 
-0x8DF6CBA794389F2E, 0x8DC9F9DF84515118, 0x301B26D1A448056E, 0x7A2858E8, 
-0xFF66AA7966D0E2B8, 0x904F31DA567F90E6, 0x5D9B325E919638AB, 0xDC9DBF31B8437AB3, 
-0xC3225D90F537EFC3, 0x736FC9BBA4301EDE, 0x89100B1AF6D9394B, 0x5FD8D8EA4C8AB3B8, 
-0x56BBE83E6794DA12, 0xBA61245B, 
-0x1931C8CE6E69B253, 0x71AC68AAE6AFD897, 0x3A4819E223911668, 0xE9C7A3BFE34A8289, 
-0xE7FCBE26145CBCF5, 0xA0F719CB2060D0DE, 0xB83737D62581AA50, 0xC50A1A37E17299D1, 
-0xFD90CE76C33FEDD9, 0x1DFA97B16, 0xD490C88035357A89, 0x1F1D1A6E4FA78E4, 
-0x22B0BB17853C431D, 0x6D8526ACB9FFFF07, 0x8963A8F3197FFD3E, 0x6C15D87070E8F748, 
-0x4D3CFECCD3150822, 0xB5D75FD49EB3B8F8, 0x20ED55AF8681C46, 0x6823EE78, 
-0x6632BA7D9AEC1BDE, 0xEC006DE1C2DC4C9F, 0x8F54A41F3E770698, 0x871C8568D70DE7BD, 
-0x86BCCB1768778586, 0x87A737A00AF76BCB, 0x5E8ADCE6FCA27021, 0xF7DF3BE7BA518F25, 
-0x22B1C7ACFAE5B37B, 0x4ACB8FFB, 
-0x1BDE1FC69CBDF3AC, 0x38AA9222836CDC10, 0x39B4B45BFD01CF89, 0x5C0BCF66F690606A, 
-0x6335D1A344E1702F, 0x84F27DB595CAC6A4, 0x9731DF321DDE5E9C, 0xD46908D65EA24EF9, 
-0x3427C54A2F31710D, 0x1EBF7EB3C, 0xE09F51F291EDBD2F, 0xE5FF403324189A5, 
-0x1E44CB7E59CC4F6E, 0x16FEF66969BE26ED, 0x97239A32B49DC773, 0x69CA086E5E2BD3E0, 
-0x94EA261B68D432E4, 0x2766AC70E35E0C2F, 0xBCA156136567685C, 0x1042D64F, 
-0xF6C75549E78C1D0E, 0x726E8E5F21C4C0FD, 0xFBD23A6DBD52E4ED, 0x7E2B658B9D8F5AC6, 
-0x97427A32CD644D1A, 0x4A77C6CB286203A, 0xD0DA43098CE189C4, 0xA73CA159BD9A892D, 
-0x239D3918FD6FAAEA, 0x262E066C0, 
-0x65F7CF1BB1E94D7C, 0xEA22CDAB452542B0, 0xEB88F3BC9623E803, 0x9DE16B6ABCF79031, 
-0x5C16DAC9C43708A2, 0x8608B48DA164A88F, 0x2A9165993CB421B0, 0x4F617D7B628BC371, 
-0xA85D0A3BC36A296B, 0x2293B23F5, 0x123A876DC19ED2C9, 0xEB606E3D8197998A, 
-0xE265F33ED01116BA, 0x46A6E263D364D763, 0x79EC81557C979D0C, 0xC9EB5079FB916174, 
-0x81787E0C2B4E6716, 0x9B87756B36141650, 0x77D6951B940B0A26, 0x1E88F2A5B, 
-0x528FC2D85165A774, 0x2A2128C7F1AB692B, 0x68D687A74874AF58, 0x1B465CC24CC8C9D6, 
-0x66A2EA4B25A93DDA, 0xE7868D97237A32C, 0x8E7300A767B5D5FD, 0x250C73FBDE5B1630, 
-0x38BE020BF2047F5A, 0x1B5EA1332, 
-0x3E0C904CFC9F27B4, 0x68EC6A05B4B84BF0, 0x15F86EAC4634F525, 0x6B829AD93C500767, 
-0x5CD1AD50CB72D2F3, 0x685E45BD0B8E03CD, 0x8FEB6ED575CF6FCE, 0xE80E66DFEEC428F4, 
-0xF253B1841DF666D9, 0x11515F561, 0x3AEC92D0C61E2F01, 0x2621B24DD76A83A3, 
-0x7AFE9014028F6503, 0x27D9A7636CB7E44A, 0x387FB88D3AB30119, 0x9C68F48E40F52082, 
-0x8A03C572259C2374, 0x7185E7267915B83C, 0xC8690C4432A8C51E, 0x1EDFE6D77, 
-0xF5702FDDADCDDC83, 0x3725FC88E88C6986, 0x243FEEE1F9EF8B0, 0x95345FB94D68E240, 
-0xFAAB91472FA8C62F, 0xA3E8731D6375F7B0, 0x3E2912F253271FDE, 0xC704183642F09A63, 
-0x70D0FA923BEBAB56, 0x9F097DF4, 
-0x34C134EDA2037B18, 0x78EF16CB2A1B8BA4, 0x9DA4FEF217A734CC, 0x23CA49CBEB5AC385, 
-0x5A488B5F9F1F5FE4, 0x7C3B969B2BF12D3D, 0xEF602FABF17E0411, 0xCC2E718DE0BBE4, 
-0x197283CB900EDE98, 0x1ADE8821, 0x1D5904D4CC55D5CC, 0x7491913304D1E514, 
-0x12DD4E2039BAF1AD, 0x65EAE25CB530E9B1, 0x75D7D77ED5040DC2, 0x9BBAD04ECA329143, 
-0xD8584171416B52B5, 0x44861AA72393F59E, 0xD228529B0022CE22, 0x444983C3, 
-0xEAA679178FE71663, 0x4B0EDE38AEE76FA, 0xD74FB79C831F371E, 0xC75F52FE3652C22B, 
-0xE75B6436796C48A4, 0xB8BF47F90448F373, 0x8B4503D502553D05, 0xC54A5F55BFAA1AF6, 
-0xCD2B4FE0C68B48A3, 0x184D8BEA6, 
-0x3C402D71A39A3EBC, 0x72360211C3F6ECA3, 0x5B7711DC0DEE04E8, 0x26117E7625B1690F, 
-0x5C99DA0E07C1FB84, 0xE231162E9B89D69B, 0x725B41B111AA6EF4, 0x79D9482AA5489A34, 
-0xA5C2ABA14252FE7E, 0x172BD5EF3, 0x6A91593BCBBF4BA9, 0x9E1DF6C4B8B5083C, 
-0x3D3477A51EABDCAC, 0xE19CCAAE11781EF0, 0xA3989B17A1A387D9, 0x4DEB4501171C52A2, 
-0x677E3E0ABF786418, 0x17B5D4287D2AC1BE, 0xD42C37783E0EB3B6, 0x9B4A65C2, 
-0xC533F3F2AC990D8C, 0x44B4A6835E03411C, 0x3405F6EC5FA23AD6, 0xC6DEE0FB07731E37, 
-0x535001390B00347B, 0xB8F2AB09DFB964D4, 0xED40B9A8BBEB4F47, 0x935EADB7829C11D6, 
-0x61B50E4FC81B1DC5, 0xA23157EB, 
-0x31CE1197540D4775, 0x321C3A0B7B16006C, 0x2B7E52783BCF2B21, 0x4456D981B006BD5A, 
-0x98DFE42FE49B53D5, 0xAB2A66D0AE7970D1, 0xD5206AA1A4CD7695, 0x6157FFF4F98E7F15, 
-0xDB5C07F2AAC95C40, 0x1A854A007, 0xA02ABAA33955576C, 0x10C66DC4031841D8, 
-0xB8961FEC4D21092B, 0xA81E49F5EE5C04EB, 0xE196A99F8A9FF7ED, 0x32CF0C078539C972, 
-0xB6286D6F3FD3BC37, 0xDFB7D276D4657E1B, 0xD1BB77B904E9764A, 0x251143CF4, 
-0x6971A69258451F98, 0x61408F0EAACA9F8F, 0x3EFB44CADEEFAD0D, 0xFFA6C4CADA5391EE, 
-0xB549783E07E1B124, 0x313BDB0A25F95049, 0x26BD7D319D0F1943, 0xEE771B3105F86EFF, 
-0xF408F893E9A9CC8F, 0x1A7222002, 
-0xCCD6B75D199F4A5B, 0x2F3B24325145C2D2, 0x2301EAACC422FFE6, 0xDB21C4A45CE6401F, 
-0xA3D3A5EF8A14B18, 0xCA7B58167E6E2D48, 0xFE3DD28FCE22B710, 0xBC9B40B5C8D03265, 
-0xB26ED15901AFF025, 0x7AD83554, 0xDE65211A95293D0, 0xEB037104DCED04F3, 
-0xE7A019EB8AC72CB8, 0x5B7E199FDB804A29, 0xD480D87A0A99AD8D, 0xEAA71A6BCA46E4C3, 
-0x31407F756A5C31D7, 0xEF83BEB7360AEACA, 0x3A189807B256266, 0x185995EDC, 
-0x423A8DEFEF246DC2, 0x40E9135EB4F149E0, 0xB14ADB534F784581, 0x7C7EF59D54AD9072, 
-0x3273398BF187C33F, 0x6DACF48C8BD8511B, 0x13EAC0441F9B2EFD, 0xAE677D3AB0B59452, 
-0x65DA249C6F1F6ACC, 0x1E5A1DDE, 
-0x3996C32E66BA105C, 0xF13C733AA24C1977, 0xA63EC47AD146EDD5, 0x7A3290DB5499C339, 
-0x227DB17019123440, 0x4B862A048C40D26F, 0xC375A7CEDA886FEE, 0x744B73E50855D97A, 
-0x521B9726D044F488, 0x2465DAEFB, 0x6CFC818255940BD9, 0xD750A450EA5EA832, 
-0xE3562BC4619F4B41, 0xACD5AFFAC7C95AB8, 0xAAF8503D0BB7E3DA, 0x293F4014FD4616D5, 
-0x72896F681605DB07, 0xE3D7220EE83261DF, 0x913C214476F9018B, 0x163DEACA7, 
-0x7731619411B62571, 0x3E1747BBCB66804E, 0x2342FFBFA7DD39BE, 0x88730FFF008C6FBE, 
-0xEB9CCFDE46834399, 0xD0484F85C2D616AF, 0x875DFB28AC13EFDC, 0x66FC795309823BB0, 
-0x8016AC75EDA434D1, 0x1455DFC5B, 
-0xC8EAC3C6239886E7, 0x5C7FE864A19A2716, 0x698047415788CF6A, 0x92CB19554D0DB7E, 
-0x2E601E6D591A558A, 0xF2B25DF232A005AD, 0x54F9731094B4BFF8, 0xEC6CD52AC62FF139, 
-0x40E5E728A0A06708, 0x21A77A821, 0x3F8E881C47A1F208, 0xCB9293D0A1649A52, 
-0xBC4AA74A19C6D3D, 0xA219C20AC7377FD5, 0xB1A0D4248D2C8C7E, 0xE71CEAC53FC127DB, 
-0x4F3D8E699B468334, 0x5AAE420CB95C2126, 0xE78E1DE7225E805E, 0x21959F564, 
-0xA26F52DAAD9DE889, 0x9E627691B6A4AEBF, 0xDB4E5FB26F54257F, 0xE89C69E3AD4D75, 
-0x28EF8183645C9E97, 0xF953A91BE4E8D416, 0x437FAA2CA6C2F752, 0xC611893DD22A6CA2, 
-0x40519AC45F6A38F3, 0x114F43C92, 
-0xC5FA9363CCB75B9B, 0xB1A77D21FBFFA00B, 0xFFE4536BD2FC0753, 0x665077786FAAC5E, 
-0x8259FF865486801B, 0x2E2D2393662F3853, 0xEFDF4B047F5B6272, 0x22E346EDFFCBC6B8, 
-0x1A282CBBE4235F21, 0x100B2E2E8, 0x3A362EFF62719CC0, 0xB7A1F13F13074C4B, 
-0x1E5441F1663D92CF, 0xBD0E208E32B4DBEE, 0xA4CBE7E030FC528A, 0x7362700F593C3EA0, 
-0x9ACE449109346D6C, 0x4412439CCD833A4B, 0x642714732CC44DC7, 0x22E0D0DEF, 
-0x7D0D7400EABE632B, 0xB6209D309E86B7B9, 0x22C664FEEC5323F4, 0x11BF0DB7FB2790DE, 
-0xCE7234A4814DAB9B, 0x993E00CB3764AD60, 0x426AD1F6DD1DE9B2, 0x4F4979311FEAE04F, 
-0x6AEA4A7512EE27BB, 0x158985CDF, 
-0x3AC0819F164E37C, 0x1C93CF27FFF4E0DD, 0xB28897142E35BA04, 0x5912DBF0A8379841, 
-0x33A2ED6EDC4B51F, 0xD124A8BF13E0E69, 0x7FD4BB21492E2819, 0x2CE1E0EE05C90B54, 
-0x3893128A6A171DBC, 0x13A1E025F, 0x4B8A185BB27A9DB6, 0x306C877512860BEC, 
-0x9F3E50660F0BC38A, 0x597C8DAB0D3EBD92, 0x528A533FBC5DE8E1, 0xE77C938CA2C12DD1, 
-0xDB980AEB910767B4, 0x882D9A051865194B, 0x93DB29EF85E1FC6B, 0x6BC27E98, 
-0xE218F6C383D2D9FD, 0x56D553C963C77C0B, 0xF5EC08C455EE9115, 0xFC717AC3DFF6D7B2, 
-0xB84F1351FF12B413, 0x76FB094E6558A6DC, 0x8463E62222E1F70D, 0x45E90CC12683F6C1, 
-0x732CB1B2F47895BD, 0x251A184CA, 
-0xAFE15B13D8C35EEF, 0xD3BDAFD5CAFB0F1A, 0xD776856893AE8D7A, 0x33561CB3A8E0A58D, 
-0xE7D6D011BB8B3F8D, 0x9D49E6A3C512490A, 0xBF18E231877C3AC0, 0x3B6D30A360F1F1EE, 
-0x702A67E337AFD84B, 0x160AC1FB1, 0xD53ABABAD1551C7F, 0xFFF2DB98B585571F, 
-0xA292A8107A31F3D1, 0xA12668F6F9631E86, 0xF0A838BFE90924B2, 0x2390CF12B4FFDFF7, 
-0x4A51EC363EB2E51B, 0x427E17F146E4E86C, 0x538B7E4C6DD95D72, 0xF6FAF54, 
-0x5B8165FF21361464, 0xB3E15FE4D3AFDC28, 0xFFD115A8314219C9, 0x9596220AD39C6AB0, 
-0x2A08726B5AFD00A2, 0xD23021B084FB4048, 0x94BB350E7075CF54, 0x8B34D6AC53E298C, 
-0xEC891B8105E583DF, 0x1EBC2CE4E, 
-0x123BBD2186F857E3, 0xBAFE58D06F738E99, 0xB8F26E9CCF02D9F2, 0x5C0D032ABE80C623, 
-0x6293D8B17599717, 0x7C27E19F4E3F47E1, 0xB50B22316C6C641A, 0xAA536BE3B1D1EC25, 
-0x5B62865F3CBDA369, 0x1E8C6CE12, 0x7B55B35C5775DA28, 0x350041B21016DA26, 
-0xEB9DCDC919489115, 0x8A409C14CD2071F6, 0xF5640D22FE2EE431, 0xA3D1C33CF70F5C2C, 
-0x487902D08ED8496C, 0x80C33B0DDE5944F5, 0x109AFF59555766, 0x1AB05C4CF, 
-0x4263890582C1C573, 0x2ABA9812BF0D9FA6, 0x320726CD77D620DC, 0xE0B107EE69120770, 
-0x73FD2CE1EE661FCB, 0xF4068CC2C018731F, 0xA08268DA5E5824BE, 0xCFFA9DCABDE3C48A, 
-0x388607041325A4E6, 0xBA4D9D4F, 
-0xA985EC150E478AFD, 0x187D082BB1F2485F, 0x22CF807FB92106A4, 0x4AEB2B4476D02D3, 
-0x84A14EEC0B1E8D47, 0xEB45142150E35D5F, 0xC9664376355127BD, 0x7C58F2C70C722874, 
-0x8EF97AA1549D14E4, 0x50B0F562, 0x9BD5A452CAAE467C, 0xDCF80CEEB8399DEC, 
-0xAC89E467964C9274, 0xF25BB6C226DD573A, 0x1CC1A779BA6452CF, 0x5F57E95446FA8BF0, 
-0xCEF407C975872D8C, 0x726FBF98DBB5F479, 0x1DECAD8D9C2BC6B5, 0x1BC0309, 
-0x467D82B4FA7D5F8E, 0x994EB14CBF4FDD5A, 0x4C54ACF280CDF336, 0x80F49532862C40A7, 
-0xEE4AD2CEA5B73F4F, 0xD413E50B6BC47C7B, 0x5357572FAB8F59A6, 0x85A3BB3D582CEC15, 
-0xB1B884587ECDCCA1, 0x1750133B5, 
-0x7BA3EF76D73964D0, 0xBAFC44C8346E7F35, 0xE234EC0291E3C3F3, 0xAED545D2DF38FD35, 
-0x38FF53A2BCFDBDB7, 0x7E1A9292F3F75FD2, 0x97BAA7C7D12815E7, 0x2E645D01E15FB338, 
-0x862DBEC5BBF51C1C, 0xAEC2BD7E, 0xC05A525455E867E8, 0xAF1D17FD297F85E0, 
-0xA26681C4297A1A96, 0xD423703745AED2B6, 0x6AB8D9E537D13C64, 0x8D5589E765F9B286, 
-0xEE01FBFA91684AF0, 0xEDC8CE440776A508, 0xFA8FDD9B5176A383, 0x254F48B3F, 
-0xEBDC37EECBDAECFD, 0x9CA891A08888D106, 0x2986941956A41ADD, 0xF06312281DDF8CD4, 
-0x756A499D13E996FE, 0x99A8D602509E46D6, 0xF8A72809833969FF, 0x39CE2B20CD8BD5E7, 
-0xF62BEF7CBE107C14, 0x5E85BBB8, 
-0x5423917CAB352AFC, 0x1494ED40D6A56B97, 0x3D43B1829425E704, 0xC6E51D9E00C2ECBE, 
-0xAD6A1E4DA2279A99, 0x92EBB6F3CC03C3D4, 0xE304A6E1B27A20CC, 0x4851683FA2C9EE52, 
-0x9F8E35B2EFAE9F73, 0x1F2664056, 0x880EF8DDAEA1C816, 0x9A624683C4302FA5, 
-0x40A266FFC6D86D81, 0xFC8A92F03981A7C6, 0x9D7B6D5D2733D5C0, 0x4652CCABA5DCAB42, 
-0x51B3C954FEEAD531, 0x7FC1495D356119D1, 0x55CF96C01CE6AFDB, 0x12D965CA9, 
-0x7DE2EAEC8D66028E, 0x26E06EF036C095D8, 0x49AA87015CE4F70C, 0x93076ABED854757A, 
-0x961FC074B509AF76, 0x9EDA96B2C76FF1AD, 0x46C8FD594D12E0B3, 0x92243DCF854C32F4, 
-0xD889A124B3026FFB, 0x12E68B4BD, 
-0x72F8A8E695451AFE, 0x99F74E651DE3E9E4, 0x48608E5F64C5CCE3, 0xE02CD4FF460462DE, 
-0xFBD79A4C3254BC76, 0x4D8350F3BCE0FA57, 0x8965D1D809D2BEC9, 0x69C599A9F01EB2F0, 
-0x897A4D80EB89CA92, 0x20E91BD5B, 0xECBACD331C1DD066, 0xED560E78DD931BC6, 
-0xA9A1C45255B3F11, 0xCB6E58DE2D599922, 0xA73E8F1C024E684C, 0xE8F2C0D196B01B6D, 
-0xE767020905868B26, 0x98BABD35A5A2DD5C, 0xD859124AD9A2B335, 0x11FC49E06, 
-0x58EAD497710F6FD3, 0x95C3A880866D9C68, 0x6D088A7A29E39D52, 0x7EA669F1124C1F73, 
-0xB5B59009CF7174A4, 0x2D6251033AC47305, 0x70FD0234680DC947, 0x235B782E257A47E1, 
-0x73BC9314C0A4BE87, 0xCF780FCA, 
-0x1D9606D4454F1F86, 0x8A5D03D931E8F18B, 0x55D752238A4044F3, 0x93B7CFF69A8CA10D, 
-0xE3CEA34ED2E888F5, 0xC2CAEE7677B841CE, 0xD33560A9F0F7F4D0, 0xADBE38C1CFC1B64, 
-0x24CADD7AAD90AD13, 0x13D21F7B9, 0x74CBD092F9F4B614, 0x361EDE8529E4FEA1, 
-0x6565B722CF1BE245, 0x6F14602CD34139D2, 0xCCF97D31F79F0077, 0xA8250C1EBD0738DD, 
-0x61EDCEE5F99172F1, 0x5466F8CC45702705, 0x4912C7929834635A, 0x471BDAF5, 
-0xDE54E65387C10243, 0x770516D52B7519CF, 0xF735BD394366AC3F, 0x9EA856007189DFA6, 
-0xF7A1D80992E4D3AE, 0x576ECD83BB9C822F, 0xCF05F66DE28017BC, 0xD252B58D60E4FA05, 
-0xAE9288EC99A28FB3, 0x1217A85, 
-0x25B65502B13ED275, 0xA41D0D07DC4E2151, 0x246618E06FF2688A, 0x293B769EF63DDB51, 
-0xA8B7D221EEF2E287, 0x89647E3CBE340AAA, 0x73F70C58C2DC88FE, 0x2B5357F0795C6A5E, 
-0x7B70A5C385DCC95A, 0x4538F6B0, 0x545739C38654E57, 0x78285993BAA8EFE4, 
-0xBF430871BD809F2C, 0x57D4A0F7E2E0CA51, 0x1279BA761F871D15, 0xB1675624F172CC32, 
-0x1B2CC8DCAAC284BB, 0xAFFCF5FEB1D847B1, 0xC23F2CDAC9D2C871, 0x247C9481D, 
-0x459065C771D82B66, 0x6293C14CB8A4757D, 0x787EEB6D06499F55, 0x9F8CB79CD4E6B05A, 
-0x1ACEA1784BBDD436, 0x5862D36639E0A9BC, 0x792C225039D48EC8, 0x47A11AE202FFA2BA, 
-0x2136E27609555927, 0x262C60123, 
-0x786541588FC11E68, 0x25DE13F0078B9DC1, 0x4DED147ADF0FB4F4, 0x4555E0B6990FE31B, 
-0x3434FF8A7DACB6E4, 0x787455B5C3A1040B, 0x8288EC928A49FAC3, 0x9F482A4330C97B5F, 
-0x82811E8126784F86, 0x1EB2E6FFD, 0x28972A9AAE63A8DC, 0xC5CD6EDAC081F437, 
-0xE8F03122BAFC1212, 0xB1766936B26D4B02, 0xF1367ABD7C0315CD, 0x377C858B1CA642AD, 
-0x8B9528ABFA23E024, 0x45047EC19E436C15, 0x6044E7842EFAC486, 0x214B73603, 
-0x12C12F35F44490A4, 0x743A00300A77D8B, 0x398EDD2F74878B5, 0x4578A53D1D95CC2B, 
-0x3603C00515497986, 0x297337698ED8DF31, 0xCE8A8318CDEC35D9, 0x70C759334A6C0244, 
-0x24C043416B4FC349, 0x6482A1E, 
-0x6279C55CA2B860BB, 0xDCC5044E36D6F6FC, 0x4F49C6D356FA6EFD, 0xAB2B333BC5EE85D9, 
-0x2D222815D1E39FEA, 0x152675C456FF7CAD, 0xB3E3A7AC9DB13051, 0xA965DF4D5EAFEC12, 
-0xF9643DF56D0994CB, 0x15BF305D5, 0x6903B486F7C8CE4, 0x5FAB6DEA35BB31D4, 
-0x9BB92B375134C736, 0xADBFF645AC985D0A, 0x8818DD8BB9D30D61, 0x5F3E3AB8108EA80B, 
-0xD984113D138C255C, 0x5717D36CEF3434C9, 0xFFA6B795DACC4AC6, 0x13A80C0BC, 
-0xDACF76523085EA79, 0x74A02D5C903DD7BB, 0x78BC0360422867E0, 0x29BF458EED62AF45, 
-0x2E810967B81369A1, 0x9203B781D72173D9, 0xFFC06B5AF242EA1, 0x94F4D58254FD9D5C, 
-0xDE2DF1FDB677548B, 0x24C36C173, 
-0x875C859E2CB913D8, 0x2FDA04A1A00DB3E2, 0xAE9402F6549F65D, 0x54B989000834AAA8, 
-0x3AAA490CF76D958C, 0x8B6EE1451582E7B4, 0x618A28449278918A, 0xBB1C9AD1A2FD1428, 
-0x1A1FA03D43A21A39, 0x1F55EB62D, 0xAE91013802B984EA, 0xAC0DABAD37452125, 
-0x86C0FB09721898CA, 0xEA1B790E8A1782E9, 0xFC1B26FD3863A20E, 0xFE4D35FB5A837EDD, 
-0x57CCE275E383741E, 0xC209DED0DC353D81, 0x67F25E45CDFCB48F, 0x18404691D, 
-0x8EE1C4F94CE918B5, 0x3FF5DEFB6B6E67C6, 0xBF7B775FADE81384, 0x832F58EF0DC8DE57, 
-0xC96A1FDFC6ED5159, 0xEB948756410BF716, 0xAF5A8049E0242372, 0x55BA15C130150AD6, 
-0x23D9463B040AD0E1, 0x58AB25FE, 
-0x14AFA46C2F300DC2, 0x20556E164FC8C4E8, 0x2D741BFC84566FA1, 0x66F957EFBEC86FB1, 
-0x75A0A56F202B9D65, 0x92CB64E4E3EE61E6, 0x7B9CD84DC779D930, 0xFF8AECA77DB3F5F5, 
-0x1BAD8ACF9E60E131, 0x11FC8628C, 0x9A5A73B4C370C595, 0x9DEE93EFA2D17C1B, 
-0x70312C1B0F0DD983, 0xD83AD8390968FF4, 0x7B349BB4BE8CB2F4, 0x6A0935CA61DA8B15, 
-0xDB8D46BF1870547E, 0x1E833A3C884511AD, 0xD59060895324A8ED, 0x6EB9146B, 
-0xD420749D106E105B, 0x3A4FF9F823AA3825, 0x2CD0ADDEECD6A070, 0xEDA6C5289E8169F5, 
-0x8C3A173C3232237A, 0xE3FEAB78AEFC7DFD, 0xCCB44E45C8D2A096, 0x74718B27C85194CE, 
-0x87B9CB4EF242CDD, 0x17C203EF8, 
-0xDB39A5240C0CAD13, 0x2D7D525C9E20A13, 0x97FFC42291578A4B, 0xC5D3180C6BA04A64, 
-0x192AC972D4498BC1, 0xA2FAB095D3EBDF43, 0xD4AC461981D8CE7C, 0x3B60B2ED754E83A8, 
-0xD64CB754F87A8BC3, 0x5AAF9401, 0x39AFDD0FF4BCA5CE, 0x14A58685BC950CE0, 
-0x6D15BC82A380A7D2, 0xB784930028D56BBB, 0x98BA84259493F500, 0xE91A51B45F13FD41, 
-0xABA882714D594BF8, 0x1671AD7871B908C2, 0xD99E98BFD4BE7BDA, 0x1493DB3C, 
-0x21490CFC39855001, 0x2DEFFAD25A9C574, 0x561259FAF916ED05, 0xA6D8B9477DD0FBC7, 
-0xE23523989602F36, 0x22231451AEBE34E8, 0x114310DCD8E2FFE4, 0x5D2EA138E50EFAF5, 
-0xDA8C06110F77762, 0xED31BA40, 
-0x20A91CC119E09088, 0xA83D03DA90DF5D1B, 0xE21B16C062E7BA4C, 0x98217903A047182D, 
-0x1D17CDE09EA2F383, 0x7B38388ECBBFA369, 0x9CE0FDD6299105D4, 0x7348DBDB6CBC864C, 
-0x9B6C01CF6D1C43FF, 0x14A723A5E, 0xF0DEF0BDD1C12838, 0xE4C37BB35D1DFCCB, 
-0xF2464C587D56B4CB, 0xCF7A9E657B19339, 0xF0DB26438AFD1C7, 0x120A7074BCE7393, 
-0x4E813BD370ED79C4, 0xBD646440E43CA1D0, 0xBA26975F376B9BF2, 0x1343EBAEE, 
-0x3F160E3B8F99CEE2, 0xB9F7B2A27DC39367, 0xCC9B2669F2740E73, 0xFEFC7D1C9A81420F, 
-0xF25C545E2E1E8C5E, 0x8701CAFD6713E71D, 0xA1D528097DEDC596, 0xF656906FED480F10, 
-0x4725D64916DD22FE, 0x1C370BE1C, 
-0xA57DE610346303FC, 0x11952DDADB859D2C, 0xB09945766408565B, 0x10788158DBE62774, 
-0xE961E67B99E053FD, 0xD00FA858B400C1D2, 0xC626E74F44F11B04, 0xFE5E06E24354B4ED, 
-0xEB70594EDBBDD051, 0x13C492FC3, 0x1C0494E90B0C0861, 0x9F23F7FDAF6D546A, 
-0xA1936CE57A5F4C10, 0x967DA4DEECFA5B6F, 0x2EE9CCEA59A82671, 0xCD319C71E3E84610, 
-0x76E727E148E5A0BB, 0x9A15B6B23F72C0EA, 0x77247F6095AC3402, 0x247A20548, 
-0xBC7312007A9113A6, 0xDEF18705947BE6F4, 0x8043296EBA390386, 0x31E9026E0A4AAC12, 
-0xD5AE21F056FD00A1, 0x3D3842E7412CE374, 0x5BD002ADDD6D4A8A, 0x5CD7509721DE8C2E, 
-0x2BEF46721527BA4F, 0x1B5F31874, 
-0x3EF26DF54994196A, 0xC321E585CAAE26BC, 0x3786ECCAD2C711EE, 0xFED8C6645B725172, 
-0x9250D4E7FB5683E7, 0x8AEB608C268782D5, 0xAA30EDD91190D256, 0x8B77253988B89045, 
-0xF6EB09352C385062, 0xF5466AB9, 0x67FABA3D13BC68AC, 0x5C1C999148EBF5ED, 
-0xC856663C8401A4C9, 0x50FB4908C24FE44E, 0xF45C87AD7EC92225, 0x8F943B20E70AF40B, 
-0x88FD323004C73C6, 0x1158A7636EC55584, 0x2EC6768B16A870C4, 0x666FD424, 
-0xE499D5B5617755E, 0xA3E227F2FFBE355C, 0x30B7E83876DAEE70, 0x61E33B055E69EDC8, 
-0x89A46A35705263CD, 0x129CD44EB8AF599B, 0x50A7511DB0B115EC, 0xD616CD0E745A0907, 
-0x5AA723A68CBAF929, 0xD3C8DC1F, 
-0x52B2177F236F8CF6, 0xC0801028E43FB04E, 0x3946420FFA08AC75, 0x448AE22AE309E067, 
-0x40CAF48BA134FE69, 0xDDD8EC488AA7FCF, 0x8B9F03B58F8BBFEB, 0xA917185954EDA8A2, 
-0xE1D54C6AEEF5590A, 0xEA77116F, 0x54638B2C985B767F, 0x3E70421F91F0ECF8, 
-0x923134C31F79CC34, 0x25BC7E6DC0A9D374, 0x8BC9A7CFFEB79B98, 0xD6BD05F3C8B947F6, 
-0xD1D87991A68C90E9, 0x5C278504DAE51A25, 0x8C6581FFFC6FDEFF, 0x25488943C, 
-0x3BE4B2CEB9639765, 0x5AD9A2F640DEE1E7, 0x2B6C3DA3E05E9DEB, 0x757165A7264D8DDE, 
-0x26B1A69F315ACF79, 0xE034FF4EE6E1DC7, 0xCB8F80FCE42EA7AF, 0x3BB3B928B02F50EC, 
-0x545A168FFEE11BE0, 0x3E8AFA78, 
-0x55DE7BF1A9CC537D, 0xB35B6C4F805F3FF2, 0xFB8349006A77FF0B, 0xACA807409AC43AFC, 
-0x242504A48E5E75A1, 0xE0842FB6D5C4D38C, 0xBA9AED0E505172D5, 0xC231F1D68CEF1CAC, 
-0x23D147C0A18CD245, 0xF4FBDCAC, 0x554A7853273E0845, 0x68753C62F95A326C, 
-0xE50F36F13005A8E7, 0xAE0E55F9057969E2, 0xE2E78080DFBA44CC, 0xBEA3B22466D7F799, 
-0xFE408CDF6DC55BDE, 0x7AAEE969F339A857, 0xCCCB82050936D1F3, 0x1662DC8B9, 
-0x602FAE1733F620C6, 0xF16B11C285D47321, 0x9CF03771CFD27426, 0x5B3F04D26C799EC, 
-0xFC92A54A24BFD079, 0xFE480B41A6901D81, 0x8F8B145F96FB8652, 0xD42B2D66D0106639, 
-0x9EB86916B769EA8, 0x1C1CCD37B, 
-0xDEE0E6CDD3AAB5A3, 0x9F304598AF70390C, 0x9B35C6A74B9F3821, 0x656C47703F739B34, 
-0xA7BCDA700DC32449, 0x709A1F3B53DE037F, 0xA4D634633BFBB9B1, 0xE436B0A09089B2F8, 
-0x4C9FD46948CA83B3, 0x154FE1C7D, 0xD6E1DD0282D4ACD3, 0xC7D9C74D6D76AF6E, 
-0x2A167E84602C027B, 0xBC61DE68A4DED2AB, 0xBD80C3A8837A9D42, 0x3176735A9B188774, 
-0x83821F833ECD403D, 0xA08E2868065406A5, 0x9AEE05C00E92DA89, 0x503C871B, 
-0xC625072B89ECC95D, 0x9EE6A2F319882939, 0xA88362E896CF8AF8, 0xF3259E6762EA8854, 
-0xA52FFA1E903F5444, 0x3CC889239757DF1B, 0x162E4A20354CB7DD, 0x4D56D597960381BD, 
-0xA7E00A95B46E571, 0x7E3E6D19, 
-0x795EFDECAE1974D2, 0xAA3F2E7DF653C1EB, 0xD26142842D4157A5, 0x35F1594D0F1DCCF7, 
-0x1552C5863C11923A, 0xBDDDB6F9D85288A5, 0xB3BEABDE2EB71174, 0x6410C4FC3D3861A8, 
-0xA1FB67B2B6136BDD, 0x23FE00D70, 0x17304202F5733466, 0x90DD1BCDFAFEDAE1, 
-0x9AD8EE73C599E68D, 0xC2FB68CD2BFF9DC8, 0x417AAC93FA48A42, 0x5299D1FE353335B9, 
-0x75C0269D62F73D25, 0x868B46A97B4790A7, 0xD5414D81676AF255, 0xDB3D870, 
-0x49BD265928EF9D73, 0x1B89EE0C0F194567, 0x6FBD9AEDEDC21552, 0xB815D8C58CD6D291, 
-0x5E42EFFE72007988, 0xAF64FA0580BD1FA8, 0x7677D4FBC137ECA1, 0x4E8979CE299A099F, 
-0x3576C95A0553959F, 0x100FF56D5, 
-0x8D44057FC6CC0985, 0x3EE1A31B1F075852, 0x2534D7B6D135988B, 0x7D1BE429B6E1ABEC, 
-0x8411EE86ACE393A0, 0x8839DCCC6E7822A2, 0x9871475FA06E9F80, 0x289E522371C0F109, 
-0x29BC54C8FA73B221, 0x2120D487E, 0xBFC52771BDA9AC1B, 0x34BC698717390ECC, 
-0xD39C490055BEDFBF, 0x2EA5B63898CDE661, 0x376C351450922CAA, 0x1FAD0009EAFC7601, 
-0x9B299A109B4A25DC, 0xF3C5C650F1EEE031, 0xDB785959C9AAF93C, 0xCDB411E1, 
-0xA25329D3D7D583D2, 0xB80879C3AC8E000E, 0xD4745C8D9F86E2B6, 0x95F72F79389B21DC, 
-0x2A69BA65768A1147, 0x24A6384EF9DD7167, 0xB37667AC4942C4D4, 0x92A1FEA8B72AB15A, 
-0xAFEEA8D6AF9BED1D, 0x3D5812BA, 
-0x3128E0DDADD18A23, 0x3B952E7CB7A6C065, 0xE107D54D686E9005, 0x153447E218F61198, 
-0x3FD7810EB91FD2DA, 0xEA6B3A5A17E97FDD, 0x9649B55E124F2B03, 0xF61403C63796FEA0, 
-0x7DBE9200B5AF20E, 0x17865CF96, 0x630E500707EB82B3, 0xAF328783F3E1EA9A, 
-0x111F17D8896F83DE, 0xDDC6899C81E9184C, 0x4FF3AEDBD2C43545, 0xB431B92740E22DA, 
-0x7EBA14EB5F0097B, 0x1C26120F815F65DF, 0x4BB33A0EDC26F788, 0x8BFDDCDF, 
-0x7E5302A471E5071C, 0x6650AE2BDEACEE6C, 0x30ADC136E1C8BF78, 0xB462C4003BDCB9EA, 
-0x4CB3F01EE24640FC, 0x296BFF96B773FEFC, 0x4C799854DB788F8B, 0xD7108AECFD11DAAE, 
-0x7737D210381DAA08, 0x12DF76332, 
-0x17D496B13865B89B, 0xDFBF9AEB09D81868, 0x372E450F50CF2B4E, 0x406B3C6C5E233626, 
-0x33FEC964D67ED9C8, 0xC2B0B5FFA7A7788D, 0x1D999934603BAB8A, 0x67CEA06F666C1665, 
-0xC6A5216971003750, 0x1ABFBF76F, 0x27DF189C36241ED6, 0x920247225E7624CE, 
-0xAC29F84E5D9C2860, 0xE0B2EF56EBFB9260, 0x2B238E401E0E3288, 0x9C25FE80F75D78E2, 
-0x6972846009AE96B9, 0x8D9F308782DAE300, 0x962F5B934600A47A, 0x24CFE8DB8, 
-0x688E5958A57C2BE5, 0xF1BE363E37509266, 0x15583CB530F38BDB, 0x16F48300BA4DF05, 
-0xB7FE0A1234AF9E9A, 0x3C441DE497D75262, 0xD531B3B323A291AD, 0xE2104B09DDA29EBC, 
-0x97AC69BD6DD24727, 0xA1B907CD, 
-0x47115F6A0A87026E, 0x9EE95514ADFE3357, 0xC9936202FACF7E32, 0x8BB92E6888918D2A, 
-0xF79CD05B6F3EC36F, 0x8B171DC00DF64616, 0x3F457716552B1169, 0xCDB05CDAF6AC72FE, 
-0x47997D1108A5E074, 0xDEB19A94, 0x3978AE812674D9AC, 0x659505A27AB04D1B, 
-0xB6BAC0D0DB9E6A30, 0xFB280F7F4A05E31F, 0x73839B7AFD0E6665, 0x271A1D0D182C5E74, 
-0x3A85F041ABFAC045, 0xD4FEB73B8B8C506B, 0xF1872674AD6CA305, 0x57A2D65B, 
-0xC6CBB315EF221A1C, 0x5A1339FBCF832EC0, 0xBF656581E391678B, 0x4C7B474365CDD14A, 
-0x4F7E44A9721AEF21, 0x623BDF81227E36C, 0x22FA40FC1B00A82C, 0xB25391F81872693B, 
-0x5DED8AFFCCBA689B, 0x23A882328, 
-0x2C6D037CEB09100F, 0x512020479BE8DA3B, 0x7DCA979E9CBAA567, 0xB3538903961D0C5, 
-0x97D160C04D963ABD, 0x31F0D42F4D64B381, 0x11A0DA9969DDDD86, 0x9B916731C18C8771, 
-0x6E785C9EF0009E63, 0x1F6B9364, 0x50DDFAA4EBF816E1, 0x87D435E636C1A01C, 
-0x385D26B2B2BDC6FC, 0xF2BF4B9657079D1A, 0xE5C7DACB664A2E5D, 0x159A37717511D589, 
-0xDEEAFB2DD45F272B, 0x699B066DF1A32D46, 0xA8F96E97028085D8, 0x1C972BD75, 
-0x67B01397EF81E957, 0xD28BE7AEEDAD835E, 0xB2883E28315176BC, 0xB696FECBDFC3FCC5, 
-0xE2ADD187211341AE, 0x11DB1F22EF29C761, 0xF80B26B490100CE0, 0x1CE4784489EBA44F, 
-0x41DE779EA6B6E022, 0x4D2F5F54, 
-0xABCB72568D5A933B, 0xDB8D8C883DE6F012, 0x8811A56695F7ED50, 0x391852548972689C, 
-0x5079BF4DF223D642, 0x63764599C888B553, 0x229E50E07CFFAF6F, 0x92A8307069307DFA, 
-0x92A2FC3FC6D46046, 0x100FE24A5, 0x7CE87A4C343A2BBA, 0x8A150BDF56048AC3, 
-0x262EEB1D11D2174E, 0x74EE6231EBC03F47, 0x3EAB2BCF445817CE, 0x5A0EAA74C99E5EF9, 
-0x551428762A41D3CA, 0x116E03DC044CD27C, 0x50BA3CAA3DF0D0EC, 0x277466E78, 
-0x10B9D97FF15D08BC, 0x856E0C7579F7378F, 0xAC640E374AE57381, 0x31F48B93A5E95869, 
-0xC670C9C75CAE131E, 0xE810C4D964B59F31, 0x315742F00398591A, 0x977A681602543E49, 
-0xAE8D36D8034A003D, 0xDE93C160, 
-0xDE8CADA0AC54040E, 0x7CFA25282F927F3E, 0x4230583057264FA6, 0xF7C4C55BE4E225F9, 
-0x5787B7E34A951223, 0x79AA9B565D3A5C19, 0x9491D1A714CBF4F8, 0x7D41F12DA62B2927, 
-0xE7F8DDEE3135558E, 0x2025C7BFC, 0x688832A0F2866022, 0xB5D187601611753B, 
-0xEC3DAB186369AEFC, 0xFD3E79BBAF1037A7, 0x8B2E7C1BF20BA2F8, 0x6F74DFF4E2150178, 
-0x885D9FFDDB0B4F8B, 0xA831097DC81BCFB9, 0xD04A7C292F11CC84, 0x176267BB7, 
-0xEE3C3B31A1966BA3, 0x7FB0C445A868E97B, 0x12F7F7BF76C5F3DF, 0x5D669DC6FBAEBD3A, 
-0xBDB877E72868F984, 0x6F4D4E902F1B5B4, 0xCBAE305C27CA68D1, 0x56AA7F0ABEDDBDB2, 
-0x15DD516244FA1F8E, 0xFFE9DD7F, 
-0xD30089F3F14BD475, 0x1FDBACA3D14AF12C, 0x87E49D9BE8FE3DA4, 0xF2D18D2BE8ACAE5D, 
-0xCEE2F892F0F39C35, 0x660B62F277199DA2, 0xAE81200159676C32, 0xE5A92FE000040612, 
-0x1CB4291C5B724C93, 0xB2674427, 0xC337D4D2CC2C27F3, 0x78BFFE56FAE214F7, 
-0x620B592C3AE1F495, 0x4BE6E715B9DCD103, 0xED55DBF9CE399B22, 0x789721382093B12F, 
-0x20D69EAC3518D7EB, 0x6B7B160D06230CB0, 0x8054853AE1125193, 0x247A48C1F, 
-0x2DE19F954DE0A042, 0x9CC3D6605A3DEA27, 0xBC58918B1E066D6B, 0xBCC64E608A2538E9, 
-0x536B0C9A7968EDA4, 0x30D508E7753971A1, 0xE083FE3F12B04392, 0xEFF900FC85C97C9E, 
-0xB0E424D534AA8442, 0x14816A9B, 
-0x5BE15CB938EA9CF7, 0xA2F29EF7C77169E9, 0x82176C8707B639FB, 0x482E398ED9FC3760, 
-0x16BAA51C94310ECB, 0xCF751C3CF4CE4113, 0x399F76048C6022C9, 0x7F850BE9CAA0A94C, 
-0x7100D4ECB6BF901F, 0x1ED4B624A, 0x3A49D27C96812F48, 0xC144C195FF18E70E, 
-0xEECDF349E40A7288, 0xFAE48A39FB94ACE4, 0x7293388104584BCE, 0x84FADD0BA70B2516, 
-0x881DF9DC7024C3A0, 0x478ABDE0458B72C, 0x81041C483332F322, 0x219FE091B, 
-0x36E26EE23759D76D, 0xB706F7EE46A88796, 0xE23D2132BBE5399, 0x286BB19E6A502A42, 
-0xA1C08AF7677E8096, 0xB59F507E3AFEA932, 0x8BEAF1103EAB281D, 0xA3E14A533C1EC23A, 
-0xC68410F6FA7712BF, 0x15FF091CC, 
-0xF55820A14555F60C, 0x78FA1A781B82DE35, 0xD41C8860AE33C74E, 0xF8F253F2256B47C8, 
-0x6E278BE437DE0DFA, 0xAB96C9C697986BAA, 0x155BC6A24542F2FA, 0x53EAEB57DDB34BCD, 
-0x77C7A31C1386DACB, 0xB8C11FD0, 0x8CD1C441B80F0BD4, 0x8345840B813DA230, 
-0x1DF3205FB189F358, 0x6A5743999D20C343, 0xE63D4364FDB5A66, 0xC0E4D302E3A6570C, 
-0x63413C50694FEC5C, 0xFFAA5F89ECCCA3E, 0xEE75D08BEA5A52EB, 0xED9EB010, 
-0xB99692AB862875EE, 0xC08D16C9B621B6DF, 0xAD05A35C66CD908E, 0xD573A7FE6C4752BC, 
-0x135DBF960F8A02F2, 0x77CDFA13239F4D1F, 0xCD8611177AB34631, 0x939EDED930E898CC, 
-0xA03AA524606D749C, 0xD9D79098, 
-0x86D711FC4D812D4A, 0xD220C3E2412A2C7, 0x8FCECDFA6C225A66, 0xEFCCD43D4520EAAD, 
-0x6998DADE33F53A9D, 0xD92D4D77C6AEEC0E, 0xCC10FBA4803F6D00, 0xE267E137D74BF021, 
-0xC7F05DB5B4627E25, 0x171FF9D28, 0x111E7DADFA0A377E, 0x103D32C1A76C5F25, 
-0x52EDFC4311870FD3, 0x983732298646AF8C, 0x92169DFE77A608B9, 0xEC76C0E7242104B6, 
-0xB77EEBB45D7B12AE, 0x28FDA5DC619917B7, 0x953AE4DD03681671, 0x212287019, 
-0xDD8D8A73FA4EBF90, 0xCC80E1CA9FA41FCE, 0x9EBAF6C2042CCCD6, 0x79CFD263C7FB9720, 
-0xF42288D991BF15CC, 0xE015E641FF717A32, 0x3377FDD4BA94372F, 0x2983F9416D0661BA, 
-0x19285ADE8FAC4902, 0x24B3ABAF1, 
-0xD2788FA09AF76395, 0xD811A7E9AD74A3C5, 0xCC5F18B2E7848EA7, 0x7C9B9F55EC16D776, 
-0xD4683C38C8F150B4, 0x43399CE47F06A77E, 0x2845263704BEF5AA, 0x2D225265193ADBE, 
-0xABF5370094EB9F19, 0xF936806E, 0xD1EA659235DAE5E0, 0x69617ABD93B66DF5, 
-0x66005757CD5B59, 0x1E608A6E02C2ADF, 0x9B6962701994A014, 0x8B96E50AC8246F73, 
-0x5C1D20BF0707957B, 0x5805E97B94369169, 0xF7B4353491D2A034, 0xCD3F8BB0, 
-0x45428FB71CB075CB, 0xCEF5A82D8F5D18A5, 0xA04B9B4FCD27EAA1, 0x13FC19E49CDEFD3C, 
-0x20B5575A0E19D89C, 0xEDB3FCEACCE08AAB, 0x3B266F7F2E3D05EA, 0xBBD309CB5BDFB8AA, 
-0xE4515E263D12DCAE, 0x2181B6BF4, 
-0xBE3326EC8C352F0D, 0xD4652D9C0386ADDA, 0x58A6BFE7328C431F, 0x937E457DD870253D, 
-0xDD05F7835F935CAA, 0xBCE7BA83CB32B9F8, 0x4CCFB1061D1739D3, 0x95451C86B229C885, 
-0x75EBBD8292EC5067, 0x27B7246A0, 0xAFAAEFD923FD9498, 0x56F910C0CC4E7B98, 
-0xE4D2CC0A7E9FD3B5, 0xE7387620259F5D05, 0x4689B2DA51D36F67, 0x66AD6B465EE7DA5B, 
-0xA24E62928B36A1ED, 0xC22843FCC2A0BC07, 0xE6D9A026D0118629, 0x25C4AAF3E, 
-0x2435997583CDFE5C, 0x2E0643E90E5BEEA0, 0xBEC315662DF83821, 0x8C76B33AFCD147CC, 
-0xBF67CC9CFBBFA850, 0xEB82FDF53AB8A576, 0xE8576C5E6388A2C7, 0x474E4307FB8BB1A, 
-0xB8EB37C18AE02DF1, 0x15FAED4F4, 
-0xE4E6FF208C67DDD5, 0xE7148F4B17A63CD3, 0x2C32356F6180234F, 0xD46B47D2F9A15FCC, 
-0x99AC348D59FC558C, 0xF57274E35DB5F7A6, 0x98D552089AAEFADF, 0x65B4996ABCD417AB, 
-0xADA2416E7D69B850, 0x1AAC177B8, 0x7E8B43D0F454AF50, 0x8A4C0DBDAD28B383, 
-0xBF586BAE003F3347, 0xD234C7F542DD82E7, 0xEB6890662A05F0DD, 0xFF453668190F9B6B, 
-0x8CBD0D60C5B5B38, 0x543DF06F9C1C7B48, 0x985C32FA6DD1103C, 0xD6B2F984, 
-0x25C88A60FA8409C5, 0xAA80585E36272CED, 0xE4D88C04FBB5D0BD, 0x44B629331B24BCA9, 
-0xB1281DBFC411A83E, 0xE3C0AD02D3D0939E, 0x30C11C6466AA18F2, 0xF01C65A73E2F2F06, 
-0xE7CF9D1A52D3035D, 0x247624AB9, 
-0x72A939A0876A517B, 0xE9B217364F79C375, 0x9946C83A06DD9AF5, 0xC249A71F1547AF03, 
-0x70DBA36189695E21, 0xFA1932B344A630CB, 0x9987A305117FA84D, 0xA8B84F34478F32F7, 
-0xB3ED98360E90881D, 0x98948AEC, 0x41234AFD2FD1D139, 0x70488C56D308B309, 
-0x4782329F96C1FA7C, 0x16B6EA6AB74D6FBC, 0xBDC77A453685EE55, 0x8A3109A8B1B9F21B, 
-0x617553FB7B4BBDC0, 0x79BE438E737925D6, 0x33C049AB6C1AD38B, 0x23F9BDEC3, 
-0xD69AE08E9DDFE79F, 0xC60BE8FD199A6BE0, 0x19F7A8FA3050DB2E, 0x7EFBEEB14BE68537, 
-0x3D3895A4F91D7A51, 0xC84BC34A473745D2, 0x2E627D3D5971714D, 0x8EA6F573BD0D3BEB, 
-0x9FC9936A9101995C, 0x20372FD3C, 
-0x8B6A632B5BB46B1, 0x357CD28B85377F01, 0x79A95F425806B3E3, 0x9331A0E19D4D90C6, 
-0x1D74E23359DCD3DD, 0xF9D9A739B7458586, 0x2A2E1A16282664D7, 0x7B73D8CF7A7415E7, 
-0x5EF6A0A71B75B65E, 0x22DC3224A, 0xA09F8DEF836E649B, 0x7DD595726D9511CF, 
-0xCEC1C118CE215D63, 0x912A7C76B8F9F750, 0xAEFCD2E487F268A5, 0xB29135A3A5E111CC, 
-0xCEC0D27230C2A529, 0xA280364B3D150D, 0x7DF31924C97F784F, 0x12B8E910E, 
-0x3B5113214A438CE6, 0xD7AA90B5EE78F97, 0xADDE5D474D2F9C3A, 0xFE573FC45D5CA19C, 
-0x92845A3A5EA1ED12, 0x901B1DEAA4708371, 0xCAA8C807559556E, 0x3C05A0FE5A43D957, 
-0xB0A60D27A74F5F80, 0xC947DFA5, 
-0x13330EE77FE477D8, 0x23312FEB0E35FA83, 0xC9A9DC3428299E9D, 0x1C9029A95E3388A5, 
-0x859A0D2D10B15559, 0x827CD23E3A2BB02F, 0xFDF5DDBFDCADA869, 0x33A5A3A9E35F3B50, 
-0xE5509BFC80CB921, 0x20403AD3F, 0xD22A82D248E18C3B, 0x833E276DD82F5D82, 
-0x37FDD0E671D2A641, 0x65D36817DE1F300E, 0xD26A64D569AC9B1A, 0x765DCCB171E216BD, 
-0x24F36E87043F3543, 0x6A1FD1AE583566E1, 0xC980A503CD65F581, 0xBDB94D62, 
-0xE17A7491D602E404, 0x26B0A5772E0E3465, 0x5CBF46837A1811C5, 0x465BB1D8D6069EEF, 
-0x20AC94C727F060F3, 0x379B59B82141C521, 0x4541AFCB7087550, 0xA562B30C2D7D5116, 
-0x105E356CA2B19F8C, 0x18F55141F, 
-0x571E72FBAA49B4F7, 0x8CF92F641BADC1BE, 0xC9B7FB8855504A9A, 0x5126D271A9D422BA, 
-0x5246BB866AE6F44C, 0x20B07F7E1D680F25, 0x6988F498C4AE0361, 0x87243DFE7A660E74, 
-0x9CA0A572BE729EDA, 0x119E6CED1, 0x2C487F593C2925C4, 0x81274385D98018BE, 
-0x2E0A291B3CD09CC5, 0xA0893E3548413D0E, 0x8C10F7D9A87F6C3F, 0x5F8BF91A76A8F06B, 
-0x800D91FA5D77A4A9, 0x6EF6386FC144E3CB, 0xA07D6700679F775A, 0x3D61BBEF, 
-0xA78215DE4B86232D, 0x1CA22C285B0FF97D, 0x2E617509EA9C9C74, 0x10D08D28E95A36D5, 
-0xDF7506A7DB937059, 0x8F1593EDA86AD6E1, 0x5E1D6B800E3ABBE3, 0x2538A703A5BB412, 
-0x3D169B025C8F148B, 0x2722AAC65, 
-0x3E062BB82C185485, 0x3C953EEB777F5487, 0x9F39E4537D700B16, 0x88FD94C11E3ED09C, 
-0x9AA6A6E1CBFE7910, 0xF3CDD7B8B3DB6B59, 0x39052477DD3187D7, 0x2F14803857140BB7, 
-0x6432E7CBFE5F8A62, 0x1FDE1AC7A, 0x35D64E97359C2A79, 0x4E4067520F13F773, 
-0xF0504718DB8C3ECD, 0x63665FC9AE31DE70, 0x412F3B935B9E8314, 0x8FA97127394CF2E2, 
-0x2A3758390885A13F, 0x76716A28DFCBC4FB, 0xC25B25FE6C1F01AA, 0x1A9AD0702, 
-0x9B6FAEFB5227CD3D, 0x5CC6417289755FF7, 0x1D8A1D9DAC942554, 0x75B815B72993B2E2, 
-0x57F96EC2B3F571B4, 0xA770C891145C2F54, 0x4110A875B6D390EE, 0xE7D779ACDEDA69DD, 
-0xCE016A3AFACE016A, 0x12623FF7F, 
-0x69012CFC163DC291, 0xBA5A834251764177, 0x47C1E1C2FED158A2, 0x375BEE75113BD313, 
-0x2797737663665E, 0xBE2E7C1176C06195, 0x35E2475900B9340B, 0x141A66B9A61D8ED5, 
-0xE1F3486088244699, 0xDA541D29, 0x8B6DD5BB1F25405C, 0x9FF459395648A5CE, 
-0xFB1DA4FC84800D00, 0x17E895FD08A9C7BC, 0xB5B85929A068D10B, 0xDDFBADDFBED0C142, 
-0xFA1913799B703799, 0x681E4BB9F298633F, 0x1D21D61B64460047, 0x13FB98A5C, 
-0x33B6EF8FF8AB899B, 0xE7F77D48669FFBBB, 0xF939EAF6AF65CBA1, 0x8B04B7AF59A6466B, 
-0xB920B7DF129392E3, 0xFB4CFB9FE4C4E4CF, 0xE7759139151C0503, 0xF234B5711673C700, 
-0x6743909AEAD2D0FB, 0xC47CD208, 
-0x7F3150FC5CA0D970, 0xB3C74F9F08BDAF8F, 0xFCC8DE48EA374EF0, 0x8ABFF6DFE0CDDDEF, 
-0x2EAF31046D4810B1, 0xDAA01805A46226B4, 0xE7DC492AAA2B09EB, 0xDC7834EFD7DD59E5, 
-0xD52621CAEF8C4B46, 0x1E65593E4, 0x3996237933C4C849, 0xF781C8EA430EAED2, 
-0x31BD49602BFE7852, 0xBFB70A5A1F41A7EF, 0xC6330E17B17B6269, 0x5FA6DD62283D2AC5, 
-0xB8BABDDD5803FD13, 0xAB2E45485261D4A, 0xCBC2739AEB985B76, 0x1A50E6DC2, 
-0xBD36A85E83B25495, 0xD45D1ADC47BD230B, 0xD1E8C54BA09A3E1F, 0xAFF6DC3C39EB2E79, 
-0xE041F71C45EE0A96, 0xBBEFFE1292C34BEC, 0x58AC2C75B74D9839, 0x559D28B0C1A01CBF, 
-0xAA71B709C5A8E7B, 0xEC8CD963, 
-0x89E039843A02396D, 0x60D92CB40A900D, 0xE6777AD6ED89AE1D, 0xCBAD0DE579C8F193, 
-0x822CD572A6D8C0C0, 0x5CE571EF30A385BD, 0xE442D1067CF09EF, 0x89148C826528399B, 
-0xDFDF3D470AA98E74, 0x17477FFB5, 0x7239B13B051D43C3, 0x1F8FDB3F2EBD05E8, 
-0xE1C77C5401220C93, 0x97B535F2CFFA370A, 0x2DF5553625074166, 0x11789DCFBDB19730, 
-0xFADAA088BF176D3D, 0x3F92723B92EDF7A6, 0x49FD8A0D30FA38F, 0x23D9F061D, 
-0x320DE3AA291D038, 0x91EA086C93BEE06B, 0x4A2A4DF91644739E, 0x60D7C3DC99EABCF1, 
-0xCB25E83DF9981A56, 0x49D2076A66E751ED, 0x2F99C4F1F4E9DA8B, 0x1696327C3AD0CAB, 
-0xCCF8F76B8AD26FAD, 0x278638638, 
-0x706BACBF9FD5E243, 0x616DF50D7BE75036, 0x1DB78BECA98E845C, 0xCC7FD98DA3EB5242, 
-0x6A8FDBCCD5CDCC59, 0x510121C7C34B0136, 0x231ADE05ECBFCF71, 0xC05EDF7372B50A2D, 
-0x118FBFF9379771E5, 0x90CDDB12, 0x85D9C2450E235B45, 0x1FDE6275C1D0134, 
-0xF1037D9B2951A02E, 0xAF6A82A381E4C2ED, 0xB024C2C554D9BEA2, 0x33DB202FCB151774, 
-0x199FF00383BD7659, 0x4AC5C2AF8DC258E9, 0x1D0DEFC2065BF91F, 0x24288A78E, 
-0x20A2240E99EA8B1E, 0xD6FC9F4028AC1721, 0xA296C8C5F093F947, 0x498B66444BBB6614, 
-0x2194686FE6C7F08, 0x776CB956BAD249B5, 0xB7C6C4D9D91C10B1, 0x8F461863ECAA6B5E, 
-0x6A5DF8A1FAFAA16E, 0x3971D43C, 
-0x414E6FF1F3DFB666, 0xF195736DBCCE3E3A, 0xE514B685498A3D34, 0x9A1E31EAD7CD8FA4, 
-0xB5956B4B4D704803, 0xB79F6A5286C486D2, 0x9D9FC10464D54547, 0xBE13F2BBEE9F7771, 
-0x48AC9FEE1B435102, 0x49749454, 0xDFA685C7967B3DED, 0x7F8EAB9DD155641D, 
-0x116A803F80DE3A55, 0xC2DFEACB36033D62, 0x6C4A74DB3C38B098, 0x3F7CB8B9A467DB6C, 
-0x52998151E7D85FDF, 0xFA8334AD5C1BE151, 0xFE8AE24B10DC242A, 0x9EA6895B, 
-0x9612771488C7CA49, 0x6883476C83DC41B4, 0x931233DB6B1C90E, 0x72DC6745F3B1DB89, 
-0x5C0FEF720B4F7813, 0x5AAA61380E329918, 0xC53546F50FE71387, 0xFA1C2AD057E83EC8, 
-0x99DC8DD15A7EF06F, 0x7EB84481, 
-0x3A78B663E0009860, 0x13175AC6038F056E, 0x1D3B858B01DE41D0, 0xD229F3D7F4A6D4C0, 
-0xD07CC5FBC1535F3E, 0x39802ECA9D158329, 0xA7834F0F237D22D2, 0x686FB6CB8FA183D3, 
-0x71711F80E0288188, 0x1831D9408, 0xFB0A39DBE77C92D2, 0x2F008883F7D3A6BA, 
-0x74462C1EC9F67426, 0x1B416B4F9631A8C4, 0xC4C2FC77103B5F9B, 0x9389E6D894F5FAFD, 
-0x2042614D172552F1, 0xB0127B54969B376C, 0x175128885A7EBD16, 0x6829A71B, 
-0x1D1DF51E86C24DDD, 0x8EF3D56655B897AA, 0x265E742C3A77AAD, 0xD8585B8FB9260B0A, 
-0x22017B20B5B14E20, 0x3BC5AA5C909C3BD3, 0x93243BF7943626E3, 0xDEE92AD1DC395462, 
-0x42BC2C2A88F3F91A, 0x25BD7E1B3, 
-0xE59ADA5255917589, 0x87A186192F7A76ED, 0x3108869A9DBF094E, 0x8CA19ACA2A68104D, 
-0x5B4B1AB311BF7F1F, 0xA0CB4C9D4E85FC, 0x62246B112211CDF4, 0xBBA0588BDB5739AD, 
-0x563E75C1B6C363CF, 0x569779A2, 0x35FCE08D625630D1, 0x507B77EBB381A730, 
-0x7590AA5B02571B5C, 0x4A8AF82C1F72B5B3, 0xC571E72B9AE5562C, 0xA9681783B70084B1, 
-0xB15B6E30D6581477, 0x679F4DA68B6CC4A8, 0x2F46F97B1B667D30, 0x1E9C4AF4D, 
-0x1F055A4B3503AF9, 0xBA68EBB78737B0F2, 0xE3580A89B3EA82EB, 0x2E6AF49E30458FB4, 
-0xE25C806F28410118, 0x54B4AE7E9021D255, 0x16546D1B124A5ED, 0x2A5DDB02B7CD2278, 
-0xD514B25D2192557E, 0x2750F5968, 
-0x3D7B7844DE2E7D02, 0xD377FEEDF3218FBB, 0x2AFE0EB076CA57B7, 0x94BD10A996F141C, 
-0xFD9B5559907B9D99, 0x352F3C3088E3A902, 0xBC65D069E4AC1F2E, 0x1CEF4A0D56FDF949, 
-0xB6302BA5ABA5E876, 0xCDE87676, 0x8C044F8E5498CD32, 0xBBB20B7AC418861E, 
-0x74FAC9EE5394469A, 0xB4F67C4BB448742A, 0x9C71179809BF1179, 0x36D581EA526DD2AD, 
-0xD2AC36369485F062, 0x6BE69B5D012671D8, 0xF601B9B1D2657875, 0x11B8D565F, 
-0x6829FCFA064BB04C, 0xCAFD7476E1474CD5, 0xA8A9B3B2A25F9127, 0x2E0CE50544B02365, 
-0x7F5D56EC32C03ACD, 0x2BC494B9A2EAF447, 0x3248F2967BE06452, 0xEB9532ED5EB5BFB3, 
-0x639682CAE8F85217, 0xE0742006, 
-0xF379E5DDB0006F3F, 0xEFBECCD271BE7013, 0xBBB2115DFFC96258, 0xDB16622FF585B1B8, 
-0x7B99307542134F25, 0x18A4A69AA2451671, 0xD2489DA75B50C14C, 0x9E9D2960FEE67925, 
-0x9E0EF012A6205A1C, 0xC41C8EAB, 0xD09D60C418ABB5B4, 0x67589B3CF7A4E492, 
-0x568335A0D5EB2047, 0x42D6EBEAD4E2AF14, 0x55FDEEE21BAAAB0E, 0xA5C659A24566385, 
-0x60E2A67E577C3E7C, 0xB0F6C5824A9B5195, 0xFF4F66DEE7E41A34, 0xB7890FCE, 
-0xDA5D54F15AADFC68, 0x407508944F42AED6, 0xC5F36C4F41019F27, 0x80599BFB00281E18, 
-0xE960883A5CC5AE6C, 0x5E3CE281C8E918C9, 0xA8B55DC885D245B6, 0x5202D0F7738C815B, 
-0x43ED206FA6FE105, 0x2410145E1, 
-0xCB88706F094C8B75, 0x8D8B3FA22723CA05, 0x6CF5C2E9FFD547D6, 0x754D16C0EE1C84C2, 
-0xDB9BD65062FBC871, 0x8CA3524DE2A73E74, 0xB6F71B33E1126E3E, 0x17F56AA9606713F9, 
-0x7EC3F905B8C40223, 0xFFC426F4, 0xA768B440084813E6, 0xCC19E02932C77F30, 
-0xD3A4B71833965E69, 0xFED37EBC5ADBE70C, 0xA9A52C79ED860D73, 0x6B6267D1951F9626, 
-0x7B7C7B3472DE7969, 0x86D75E69C15B9BF0, 0x5B3E9C5786D66E79, 0x16519E54D, 
-0x478D0E04F522E5A8, 0xF5CB7B81127B58EB, 0xA9F238332A570D92, 0x40A30B424703F1C4, 
-0xCF3412B4DD4B4C4, 0xDF5B962274C75CFA, 0xA7607D0D2DFD59BB, 0x1711FB67226385F3, 
-0xF25A91D723E635F8, 0x1EC67E746, 
-0xDE83304987BEEB89, 0x27943E30152B0011, 0xF972D6240EB52365, 0x4F217346E20FE326, 
-0x73E50E839458B98A, 0x95B88B284C7EA614, 0x7BB8C5D60152E232, 0x6A905D9981B4D0B, 
-0xE6B9DC0501F9A9FA, 0x2148192BB, 0x2841A46FAC0A793A, 0x8DF927C239CB0262, 
-0x20D12655CF3A1E52, 0xA2F148FF2955037, 0xF1F822AFF5437A27, 0x7363A490F4B23C42, 
-0xF09CE426FE9D5987, 0x4051BA6FB38F1A9A, 0xDFB33AF32A615EE8, 0x74EC051B, 
-0xE24F598217F7B4A7, 0x964C0D16B043F037, 0x9BEE8F45FC333445, 0x3C560E66D4F71DD2, 
-0x50BED5D84056575B, 0x1ABC72BAD8214407, 0x71B2AC353B401F65, 0x6058151B56FA9A67, 
-0x5F207F98FBABD855, 0xD86A3DB5, 
-0x89B734F9D2B6FD8A, 0xE8E31EE932B32529, 0x5422C77DE3F7F78C, 0x5E17B43E2AA02C1A, 
-0x79B5EEEDD2D28447, 0x964B33E1B87130C1, 0x78845494F7177E07, 0xCF96F232A056C608, 
-0xF6CBCB9ACF939DCD, 0x13B5C489C, 0xD1E684471164A76C, 0xB2B546EE82C34B2D, 
-0x1BEA38AFB06A9528, 0xB52535D8888BB6F0, 0xE2DD7C9041E24801, 0xB87E6D4BD587EE73, 
-0xA294D19871D8E81A, 0x10D79B62A004876E, 0x276D21E30514305D, 0x1D56C3B8, 
-0x9CA84EA17FC55AF8, 0x9C5769F140C00A11, 0x6B63D9D3736AC230, 0xCCBFE8819AE9FCE9, 
-0x3F43301798252675, 0x4617125787B7B612, 0xF65D93D85D6D92B3, 0x79A6D7B0EC2A134A, 
-0x30A925F7BA4EB518, 0x20F9B6514, 
-0xBB8BC0EABD826DB1, 0x506CEEC404096D94, 0x89E788E2CFD039A6, 0xFE77571F963ED7DD, 
-0xFC8C108CE2D64E36, 0xB95A4229B95A5493, 0x5559C9C4CFC9EFDB, 0x512CC7F1275BEC85, 
-0x5295A1231FB3C720, 0x2418A89B, 0x74186F9528AD8945, 0x5EAA814D0AC68D1A, 
-0x367F550B80531800, 0x4A9A27AB2661B882, 0xAF5DF149FB550E3F, 0xBAF886B111065326, 
-0x15A3EAC357366F03, 0xF5FC3D4803728812, 0xD471A234DD3BA160, 0x21CEEB13E, 
-0x54155DD3AB81A1AC, 0x18A00FA37D0D4227, 0x13E0AC6D080DEC7E, 0xB963889A58CD347F, 
-0x4ED6A06FE3CFD16C, 0x3940988E077DD68A, 0x68CFCFA0B29A7DA8, 0x16B65071444A77D0, 
-0x6D5A84B08DAFD20A, 0x5ABDCB89, 
-0x8AA8258FB2FD30AF, 0xF7B01C7707A793D8, 0x30718F58E7BEC70E, 0xDAC3AFF97471636B, 
-0x9B7C0D5CA181696D, 0x6DE41967EE12AB7E, 0xBC17FCDC2FD6EBC7, 0x52EB1E11F3225CD7, 
-0x7AFFAD306D08077B, 0x24DCD39A2, 0xFB301BF55F6D3187, 0xDE54F3E61C603879, 
-0xC0FA8E1AEF114958, 0x7B446CD7FA8ED7A7, 0xBD5080F97C5C3F40, 0x5F6AC17791E54111, 
-0x3BC742BB92D9AD3, 0xC983DE6FBA5A905B, 0x900E1031E41F62C5, 0x39EAC35C, 
-0x98BFE5367510BD2A, 0xFC4773C19C8D1941, 0x641C548084E5E38B, 0x53EDFDF73049D64E, 
-0x198C35363C6C094B, 0x204376C12BB5AE47, 0x87561A804164542, 0x4E71B3603D6C9052, 
-0x97CE91957D079828, 0x1710F6CAF, 
-0x6A0D51A508C1B22F, 0xA3033C53F9C34247, 0xF3CDFF9C8C0A8BCB, 0x6FF0F154016AC85E, 
-0x5B201BF126B833FD, 0x84E5A29E046BFA6B, 0x6DCE6EC1CD92EDEC, 0xE3DC93567B4FA6F, 
-0xBD48C7E6E618F61C, 0x159B0C693, 0x67CDC9966C9A67D4, 0xA718EEA2E6D61E13, 
-0xF6EBFF945BF99772, 0x3EBF9B6EFBA348C6, 0xD2DCDDC337728333, 0x202D6B5F04CCBA83, 
-0x870E32B57F4AB789, 0x9BAAB06FB43EAC57, 0x6FB5E41A391B1AE6, 0x1D4220407, 
-0x21E1E6405C9FDD09, 0x6E41C39528177F3E, 0xA43DD6BDCE3F6668, 0xF3EFE229AAC63269, 
-0x852AB70D60D859CC, 0x64D7EB832928D06E, 0x4E5F3C95D487E2C4, 0x22CB3AB56C394E97, 
-0x37039C4F3FBAD6A4, 0x25F9AE735, 
-0x4CF6B8CDE5F163BC, 0xAB5F8C0F6E58318B, 0x19E9CF821B0F80FC, 0xC204FE5D68F679D8, 
-0xAD1459D892DA27B3, 0x402EABB07F300679, 0xE872F3907B569A4B, 0x83745556FA6752B5, 
-0x46B1581B2AEB9E9C, 0xA61252F5, 0x64E14A4B16608742, 0x61F9E63634FE1AEE, 
-0xC0B4312DC95B0125, 0x9A08580EF85DBF2D, 0xBF5FC6CE0C6EA279, 0x5618008C82A307D9, 
-0xB414C91D3027F836, 0x53FA3B38B4819DCB, 0xD062FCBABAD2B6B8, 0x277AE7DAB, 
-0x9B1D7F4A8B1405AC, 0x7BC3A350E41B18B6, 0xBEC1E89C1B924870, 0x7FCF37F9F997E42C, 
-0x8A7CF02584B3F3C8, 0x141B5D124B86941C, 0x991B487F787B551A, 0x67AC81EFD1B91CBB, 
-0xB88B5CE7A39E4532, 0x266AA0D6D, 
-0x79A4E5EDC28DE415, 0xE09BD9A5EFD7597F, 0x6C573CFC224FEC42, 0xBA95D61A6374CD63, 
-0xEC5763811F6A2DA7, 0x364B724081115D13, 0x28AD23943D7BC9A, 0x5D631BB3E831230E, 
-0x4E85DA7DE89BD78C, 0x189A6356B, 0x4DD18AC44B6F923D, 0x2359574B09A837B6, 
-0x5FC3788A34849F93, 0xCA1301661707F4A2, 0xD5D656623573A6BB, 0x2D43982DAFFCF5EA, 
-0xE7E31125D6C07D62, 0xC1D93A4780483059, 0x4D984EC67EFBCAA7, 0x10599CECC, 
-0xFF1FE1919460F56C, 0xFC93079198D26313, 0x93730B81288C1A6B, 0x228C7D05F44478CB, 
-0xC69333056E334374, 0x3E1BEDB22029D8DF, 0x60FFBE80B48897C1, 0x37C2394482761D22, 
-0x2270956A0AE6DCDB, 0x23B84332E, 
-0x6D8E7A99DADF29E, 0x1DCE9B4E1F0A8EF7, 0x59D6713F2AD78128, 0x707775708B686C55, 
-0x1ACDADCE493BCC71, 0x1661DD9B9B95738A, 0xDAD8C24AD4EF4BF2, 0xEEF066955AD96F03, 
-0x28A9AF8B47DA48C4, 0xAB862F3C, 0xF296B705FF4195D, 0x8950A30A35BA8C69, 
-0x93DD5AC9975E5E02, 0x7EB9EAF62F4D0100, 0xF08FD6FCA32F0575, 0x1846E18E4A444598, 
-0x7ED62EFC0EE94BB3, 0xFFFE99166B6FA8BB, 0x8971CC52ED494BA1, 0x1FC723629, 
-0x339F5F7E661F13CD, 0x3B52A8E9E2DB7723, 0x2C9DEF1FB93BA0D4, 0x78EFB87EF5B5714D, 
-0x30321B50A7C2728C, 0x88176C6E3EA51452, 0xD58D273FB3481102, 0x75912AD403316873, 
-0xA87872069209F4ED, 0x278F62732, 
-0xAA83B42ACC9529CD, 0xA553DC6653629FD, 0xBA5F224E60350C72, 0x22ABA80448F2D19, 
-0x66A4723E5E23139D, 0xD199CA269DE44159, 0xA3E9A8C09CFDB9A6, 0x320542AF98DCB58, 
-0x1F6056C0DDD6A24C, 0x40FBB08F, 0x7B879B0F859277CD, 0x790901A2E049C471, 
-0x3117D60BBC3DBEBC, 0x2157656BA8290CFC, 0x4F5D4FD648A9C5BF, 0x73936F9EA93C3638, 
-0xA9265EBCB70F97FB, 0xEBD7E582FE9062E5, 0x8FBEFC34C17AFE8E, 0x160E2FC72, 
-0xAB45B00B43C107FE, 0xF8994075D30BF166, 0x3B522DE404678802, 0x9A26F53E087EC1B1, 
-0xAE85C361EDD02D1A, 0x43E360D191778A3A, 0xA08469CE8E5C590A, 0x28C1E343725415E9, 
-0x94D8EC6DBF53BEFA, 0x22753AC28, 
-0xCF11B811546D2A9, 0x263D709983818B76, 0x40ABCA0D0DA71BE0, 0x9CA882D7EA9591E7, 
-0xF1FAAE5A2B4C93E6, 0x17C4836C150B98A6, 0x74B8159243116532, 0xF7F0F8221D68A52C, 
-0xC54E4F62EA7AF839, 0x1BE63D589, 0x9BAA4ADB92560567, 0x55030392041CE737, 
-0x347F87F5CD75F9C4, 0x582C1192E4F22F21, 0x4888A0CA4DB2B9A2, 0x94CC10719AF8E273, 
-0xC039AE7E5D1B65BB, 0x1B6EFE7A8B28D49C, 0x4BBBD18E80E2E396, 0x27317DFF5, 
-0xA2646C79021ECF49, 0x3BE3268C89367CC9, 0xA00DC0A87BCB1C1F, 0xADEA271C50CEE6CC, 
-0xAFED7E600AA438F, 0xCA51A7AA8430F6AA, 0x4A136AF405BE7928, 0x3F4F40056B4AE07D, 
-0x201D891DE5BFFD09, 0x279310EE3, 
-0x6DF05BDB4CA2E424, 0xBD1BAA40A85A1C59, 0xCFD30C0D11B7B8B8, 0x5DA76089638B1C8E, 
-0x4908BA3F2191F4CE, 0xB5DDD249E91C73B2, 0xF095800B9986E21B, 0xDE8B239F653E497, 
-0x5776F5213FCE557E, 0x1633CBF65, 0x67F4CFDEF9E1D23B, 0xF47FF07189133F9F, 
-0x21E58B542797B343, 0xD257E87FD8255A44, 0xC89FA330A18F5081, 0xC55C12F5E5F8E4B4, 
-0x6E368346C857836A, 0x97E10A9821567E04, 0x622B66DB3BFEDF20, 0x1014525ED, 
-0xAEEA2BA6C42EA7DB, 0x1C3D2C8B2183F525, 0x8C8D44CA673F56AB, 0xA685D585A8D3570A, 
-0xD7257C9C277FFC04, 0x4F1E8506F097D93C, 0xEA2A0A8BCA3A924, 0x3E51197980BE9270, 
-0x6DCE1B494849594, 0x15FDC51F2, 
-0xE7503FED10DA98C, 0x60C613A626A0C6DD, 0x25336CDAB28A0C6D, 0x902D0C8CC3A5C9EB, 
-0x4E0F97652DB6E07B, 0x45E6024EDB509595, 0xA2880DE157119029, 0xC866BB826365BD00, 
-0xEC48217D6AFC7ACC, 0x2173C7C93, 0x2C937B70FCCE331D, 0xA8C0A45382981509, 
-0x39650CE75EB6A297, 0xB81C766580F73748, 0x74C2F8C6805573FF, 0xC469151FE887C1A7, 
-0x56F26BE116C00A99, 0x710CD1AA007D59B6, 0x8894667C90705B5F, 0x423E5FBF, 
-0xB8941FD575A5C73, 0xB8D3A9BA8C87B5CE, 0x5693FE2735EE3BD6, 0xE067130B36F0EF6E, 
-0xBB7172D3A8A6FE3F, 0xDFA99F77AB48EE2C, 0x16A4BC4469E1F78, 0xF68293CE6277736, 
-0xB5DD12F2620724C1, 0x1326C9DEF, 
-0x3532F9A8208FBC14, 0x4025DE5BE3F54D06, 0xA68323416F1FD188, 0x65E57B8B843E0D7F, 
-0xD4E3DF27FB5ECA08, 0x886321225D4034CB, 0x9B23C70E58E4FCC0, 0xF5CE0E71CF3F0009, 
-0x51FC36F81B313E25, 0xE2EF4BA8, 0x385AD3104CB5065, 0x44178781D50B19D9, 
-0xC24BF447BDCF3B5, 0x2F88CA0DD6FA6D46, 0x6E07486163E36AA7, 0x9050A008C5DC83DA, 
-0xFFB0FBDD697EEFDE, 0xF8BBAB02BCB75655, 0xDFFFAD2C3BDD7449, 0x2183CD65F, 
-0x24DAF65D85668096, 0x645E05E714CA7B1E, 0x1915A87BF8306DF4, 0x7C946D01A3D6A4DF, 
-0x32126B8C4C222C82, 0xF50CDB783F8F2C67, 0x27F5AD681CA766AF, 0x8440CEA438966188, 
-0xED5586AD747A73E, 0x20B4C9680, 
-0xC61624952207B6BC, 0x13ADB7D4D04DBBE8, 0x8669AA2C0BC60747, 0x16339A068DEBD3F6, 
-0xDC2FFCFED98396B0, 0x6DAADA1B0539FAE9, 0x1BE3287ACE75A6FA, 0xDE5D8B14411DA911, 
-0x3DFDB35098CAF6D8, 0x220AC4E01, 0x2E4B496ED7839C44, 0x4520463E9AA45744, 
-0x982AD67FD0D3DC14, 0xF8D23331895F61D0, 0x493FD561264735CA, 0xE9A2B873A82EA110, 
-0xDBA2ADF70E04655C, 0xD7A78FD28B38E4F0, 0x33F19A8670E59737, 0x7107CA87, 
-0x5587BF7B8ACC5193, 0x2D6C1A4E3B4567A3, 0x392CE9A7C4B480A0, 0xF4529857BDDFA196, 
-0xBAF4187FF0C497A5, 0x1E6AB4489CF71E89, 0xF10D4AF0BF354EFD, 0x7083936955BB54C8, 
-0x2391BFF2585ED1CB, 0xD9A919CF, 
-0x562E08BD3D85480F, 0x246EF47E35EC08F5, 0xC3F734040224CF07, 0x7579C3045D9726A9, 
-0x3665D0EE471F5068, 0x1DEF43EDB6CDDBEF, 0x466926331D8E1214, 0x86162065B69FB7EC, 
-0xAE2894F1412E050A, 0x139A3099A, 0x714FF97458F33A4, 0xFA3152D925D214D2, 
-0xDF21D44EA6A73A62, 0x38E70783720DA85D, 0x993A4A0D42782553, 0x5938360D4FF2BE9, 
-0x530023D3D9978725, 0xC31E07A67CA1C069, 0xEAC7FC8E927E056B, 0x14CEE1D23, 
-0xC6F61A53B79D787C, 0xD1A5C16653DD45B0, 0xF98B24C1954F3028, 0xF016A6036BF0439E, 
-0x90FE7BD1AEFDE425, 0xD7A17F7FF7DDF7B4, 0xC4428D4355ECD85D, 0xFE9722E1B0D1446D, 
-0xBFFB5058CBE95C5E, 0x2396F82F7, 
-0x7C67AB30685620A7, 0x84E0518E1166E716, 0xDA6575F426C61387, 0x4F1EC01EB32512AA, 
-0x18464F3C3C840A06, 0xF07F244A802E944B, 0x452D77248D7B9C54, 0x53657E590BAC879C, 
-0x2EBF3A8CAD43F6DA, 0x88D58215, 0x2847F6F937CC6B88, 0x69AEC135FE98C610, 
-0xAC282D41908A43DE, 0xB1803169D377F194, 0x6FA9DDBD2C6FA55C, 0x6E8FD535E3D010F9, 
-0xEBD339E64A103774, 0xAB1F47D3F66C6D8B, 0x2932B292681C0795, 0x99C12204, 
-0x9D138DA29876C415, 0x785971EA37B3F9E7, 0x99CF94E1021E0D31, 0x814DCDD601B864E2, 
-0xCE1CE800EC583CFF, 0xE3E8123295B58D37, 0xD4EB51D44079CC1C, 0x71C19D2CF76C2E78, 
-0x869A48ABF3A859FC, 0x240A0F8F8, 
-0xA14E319EEBEF1686, 0x1B384E3E43A0CC02, 0x680A3558C1C9D78C, 0xDEEAFFA05BD50A5E, 
-0x451472879A532D4E, 0xF618A8D3EBE2BE60, 0x82C5E675D2B15D4C, 0x47F5092E9286A838, 
-0x19C016FC96E2EC40, 0x1F50AB826, 0x700125DCC2C1975, 0x3AB1B7430E892816, 
-0x435B704099C8A6E1, 0x299A3B07283553E2, 0x1553895565879C6, 0xBDE4430B9052C445, 
-0x8BBCBA22C93DD5F4, 0x83B4AA41C520EE26, 0x7E5169C8B0B9BC8F, 0x81CCD0C6, 
-0x4E3E5E6963A1C07B, 0x22FD00D67A37EEC, 0x12C2EE83B6F6406B, 0x5EEA502A73340B71, 
-0x4FB723D5F98849F4, 0x3814DBAB464CD9C9, 0x2BA21909B6B7FAE8, 0x73268EC3F03657F1, 
-0x4DDE8074DAE85BFF, 0x1CB8A648A, 
-0xA0B974259BD9D478, 0x45651D9BE007EE25, 0x3BBD0CA3B76CD696, 0x78A8174B3E98450B, 
-0xD6EC39336A3EC5CE, 0x8FACBF653AC3F760, 0x30FB49D2B48F15EC, 0x67B89D6E8FAED6E3, 
-0x1D561431F0543B05, 0xE567EBCF, 0x644CDB2D2AA424EB, 0x8130F4510A9CBA13, 
-0x128DCB969E835455, 0x8454F6B495DA5442, 0xE55B22D8CA203FAB, 0x231BB1BACC446F7B, 
-0x614636A0499D2195, 0xE9056C9A18C13BD9, 0xDD8A2F666053F1F7, 0x215291DE6, 
-0xAFFAAA029AA74A95, 0x13D4D2683217C1F0, 0x8C2373FF0BA9008E, 0xD652ED68CC72960E, 
-0x1E9D2BF6C4A56F89, 0x3B5D658C2EA89E1A, 0xDF813BBCEE045897, 0xE9AE912F486BDB85, 
-0xB5052DADB5C27A0E, 0x13B0E639E, 
-0x944B06E34AFA642F, 0x2B4F394112B92B0D, 0x29561FDE1E54A260, 0xE649969751416E43, 
-0xC92CBD60ED457D7F, 0x59515EB98C34A22B, 0x180925B6970BEB98, 0x29D763EF242799B, 
-0x4852A597231331FB, 0x20ACC5303, 0x49A2C9E557F28DE9, 0x86C8BA8588136EC8, 
-0xFAF3733EAE0E5E2F, 0x780188A36D48100E, 0x9036220079A8AF6B, 0xBF9BFE90768B90EA, 
-0x80B36139CB586C18, 0x1EF0ABA11ABD3E8C, 0x7D4D3D18796565AB, 0xF130070C, 
-0xD153E860A0803AD1, 0xAFAAA048A123B5A4, 0xFE05F619581147C8, 0x167860D7507A1E77, 
-0x7EF65761351B488A, 0x1E837F0C8CAD98A8, 0xF793EC26DB66B5C3, 0xF055556BE0930F68, 
-0x1947D64CA0F184CF, 0x1B75EB44C, 
-0x2EDE93253E166EDE, 0xB58333CC0EF6D542, 0x197BBF397795BB8A, 0x53AD320DB6913FBF, 
-0x44E2E26A0E328CBC, 0x2D6E6BD5408F2928, 0x6A52B8AFA8D11FB4, 0x791BD41D63573DFC, 
-0x3F293D0FA8B2EF2A, 0xAE305729, 0x84DC639C87D16C9E, 0xE6638D0D3750267B, 
-0xA5C6D3D6E96F1094, 0x7FC2E424A34C8BA8, 0x5711455B9E2EEF86, 0x318D63F86807D313, 
-0x9D684ED0018A11A2, 0xF77FDEA80636B084, 0xEA4B2AB240306ABF, 0x1D4F7F8F5, 
-0xF837DF6E62FC2F06, 0x59CD6A170C3E208F, 0x26409C8D6DD308DF, 0x1A7EA49587E7D9F8, 
-0xA5B8B28A4FC8B92F, 0xFDB8294423FDE288, 0x7127968A42F6E36, 0x63A00A0A187D07FD, 
-0x1AF2E55279E7BA02, 0x276C10A51, 
-0x4852C6E78A4071DC, 0x207C9EC61F834001, 0xB4448E36141D7899, 0x81BBBE94FDF57481, 
-0x2FDE06E1F31DA7DD, 0xE8D773E455E3904A, 0xBCEBC929F93C8884, 0xFAB27FCF07DA88FE, 
-0x78574BB9E4618CAA, 0x1E231F565, 0xA8AABC79A95BC8A4, 0x5A5B2B1D7C9A581D, 
-0xE3E42E6BFCBC1C6D, 0x5C94D2B06833C2AC, 0x9734D1D8DC788046, 0x75E8DC2A77E627C8, 
-0xD382F48EBCBD5AD5, 0x356461FF2B6EDF8B, 0x35B34A20D0CA13CD, 0xA30EEA6E, 
-0xFA0C6CADFFAB8F58, 0x615916BA3A2EDDAF, 0x33F3DE27DA2B2D28, 0xB94BC7412A4B0AD9, 
-0x1CCEA315BEF2FFCB, 0x5CEE8A6FBEA89B17, 0x6771FC77186073CA, 0xFF2FE63DAC7E848, 
-0x71EAEA9103F1CE7B, 0x1E0B8196, 
-0x999DFA38360D70F6, 0x122C9FD7B6307802, 0x674F67142CD76EC8, 0xC28396E1FF45E9FA, 
-0xBE62B50DDDE69AA8, 0xE3CFC68F69196240, 0x4B828A1DAFAD83F0, 0xC42EC0A8D19F5CBA, 
-0xFFEFC1707E62A7F, 0x15BDE5BB8, 0xB0969953CCDEE419, 0xFDAF7A0A43558BFF, 
-0xABB516D4368AA6F5, 0x8C3CE4CEA2980381, 0xB9126D5A7A99EC7C, 0xAA9AB73EAB4F2A12, 
-0x1DFD60222508A300, 0x954269F30E6553E3, 0x25411E6CE9F50273, 0x260C6A63C, 
-0xBA3EEE629812387B, 0xD066388B87F32CE1, 0xEBA9E00397CFC7A1, 0x7843D57B0517198D, 
-0x3E774AA3D21F86F4, 0xDF5DC3B98A37FA2B, 0xCD0C6E45FE0E0B68, 0xD3223C1C3617C270, 
-0x10D368BD2D567D60, 0xA71696AD, 
-0xD6A2D0625D25463E, 0x4BA4F812AA22D923, 0x23F45A04D0D97276, 0xC24CC05A9552423C, 
-0x21FBC5F7862CC7B5, 0x7DA9BA8181F89963, 0x5D0EBB52B12E3559, 0x9F065FE54B5FC41B, 
-0x54699C221CE56606, 0x1A5EF46DE, 0x2F66777B5FAD5A5B, 0x7CB4D256A7CD3CB9, 
-0x8779EE0A6986B732, 0x40AB55F0C1DF32AA, 0xCAD03EB2A8D964C3, 0xD419D0FCD8BF4382, 
-0x1590FF1F2498EBAF, 0xEEC05008D6A0AD3B, 0x8252F6AA87DB1A1B, 0x1FF3A175D, 
-0xFC2E7B52650B30BF, 0x75D54483CA19FC82, 0xC9FA65588676AC81, 0xE5815431E64524A2, 
-0xD62697F8AE7F46DA, 0xD1C593D6B8E87AE6, 0xCB76CEAC40A2CA94, 0x9E289C25209B1EF6, 
-0xEE0CC0D2545D510E, 0x12A832A3C, 
-0x2E2732711E297C84, 0x71078530FA84DB5D, 0x91D89E3CA53C711E, 0xA8221757BDD71444, 
-0x6D7D15EB77684AA6, 0x4DE168CFDCBDF7D9, 0x8576E3CA08C5C683, 0x186822C26F6D6372, 
-0xF2FD5FE934D37E0, 0x1827A3589, 0x3A8C106FD0B008C, 0xC0B5434C4E1FAA20, 
-0x361D3BF01F749784, 0xD2892DDF6A640EE, 0xDBE3760CE00413CB, 0xF3A6226693A88D69, 
-0x611C12E3A0186F74, 0xC302264701D67A6A, 0x30D8C132DBCE6231, 0x33F28DF2, 
-0x2C37379FE194D03B, 0x78C62CC4A01E9891, 0x70CF099D49E3A0D1, 0x728A359D0A100611, 
-0x25915740CB8304F6, 0x1FEDE6D4F072209C, 0x1B5E9FE2A56E791C, 0xE13A5C6018FC9C2, 
-0xAD6197CE86D2B87F, 0x107EB1FF8, 
-0xEACEDCC4C0709C0D, 0x472F91762C0F6194, 0xB5C7847B1C8CF5FC, 0x130A1A9417248EF0, 
-0x83737293A24DF19, 0x5DA4048B45705BB6, 0x90CF854279EF3ABF, 0x59438359AAA080FB, 
-0x9C11CE850D82031D, 0x1C1481404, 0xD883065A4001D355, 0xEA6AD6E5128682DA, 
-0x1988DFB2920768E1, 0xC627EF3855FE2730, 0x7D4A0F185A46FA52, 0xA2BC3FD7CB9826C3, 
-0xE84CD86CD90B3F04, 0x937890AEB25E4745, 0x5325D2D22A6F4619, 0x48284FFA, 
-0x1F65453412194E7D, 0xCDEC22A4980D841F, 0x44F870D2B06AD24E, 0xC48181930C6245CC, 
-0x1E106869334B859E, 0xE27909BEBBC23A30, 0xE8F8F66922B1E53, 0x7C04B817203532D5, 
-0x5C2A81EBF73F84B8, 0x10B5357B8, 
-0x79998CB60F7D9CBC, 0xE03798C28FED25F, 0xA024CA543A83F5DE, 0x5D87E9B76D9DA6BB, 
-0x254CCC8E8A27366A, 0x15A0026C9E135998, 0x53EA3932476249C7, 0x155B0E7C99480A6A, 
-0x7BE9822D177D6879, 0xD40F36E7, 0x63EE30B03BF49B56, 0xA6B4F66D5BF4BE7, 
-0xBDEDA56227A96477, 0x7BEAF48726A67D6A, 0xD0B489C0C0EA88B5, 0xEDEC950B4370DC6, 
-0x7643DF0EECD83843, 0xCDFD6E7FCA2A7231, 0x3662D090B0AE4EED, 0x8F4A83E8, 
-0xD7077B605E661EBC, 0xD8702A4C10C03E10, 0x2B4DCC48A7532F48, 0x1EFF55A8E37D5446, 
-0xC81E7F265F1B7A07, 0xA40F43CF8B844EFD, 0x768242FE237085DD, 0x6D3EEB7E7C0DAB14, 
-0x9620A913D5F2C112, 0x1AA348DA1, 
-0x88FB4567636D33FF, 0x50A74A8DF50ABEBA, 0xFC74DD75EE2235C1, 0x167261E85DA665BB, 
-0x9E2E63664640C0E5, 0x83D0C6B3430FBC1D, 0xFB22CE542BA13C2F, 0x3B8700CE4DBDC1F9, 
-0xDC022F8C433A2A01, 0x2765B36E2, 0xE436BB8F54586643, 0x71D4316394CBBF19, 
-0x21DA87AB12D7BBCB, 0x1ED0901FDB0AEDFE, 0x9DDF5108D0C16C86, 0x459005E0BB0C65FE, 
-0x32F0372573DDB90F, 0x33C01CD2229A70C2, 0x32B11DB1C58F9C58, 0x16CC1E00D, 
-0x95552D739D6EE898, 0x3341453486781CFD, 0xDABA9A661FA4B359, 0x1BF1D8BF511D1106, 
-0xC14D749C4D9EAF7C, 0xA1FD22EE5887AEBD, 0x54D4FBD38C11E38C, 0x1679CCEC61DD0B1A, 
-0x2C8B24F684644223, 0x1D261F702, 
-0x1CA848A31E6F0EBB, 0x49A992356F7EA735, 0xAD48E5B1426CCDEF, 0xAF15217D67522922, 
-0xA5F5CEE0FAF81BE8, 0xF44E8330BA834E19, 0x1456A648B7FF0F39, 0xDAF96BBE0C933C45, 
-0x9A2EE25FAA435D88, 0x18E73CF2F, 0xAA9F9AB0BB06A9B, 0x7B86A2BBD0F3F105, 
-0x85BCD8BD27D82462, 0xC917C82A01A236ED, 0x8960B2D679B8451B, 0xE4ED80909F9917B2, 
-0xAAAC05D97AC10709, 0x3B89A68F36EDB4FE, 0x18A87007C52EE227, 0xC7DA6A72, 
-0xCBF154FCF9707BE0, 0xEABA7E377497B983, 0xE78088E5D4190671, 0x677D5D101AAC6733, 
-0xC10130DA323EE831, 0xAEB6157E0BC717FB, 0x5DCBBFA52E6FCA17, 0x7402F52871143DD6, 
-0x23A6DDDA9EEF907B, 0x1EEE7A925, 
-0x2220EE6A04695363, 0x377E43D3BBF5871F, 0xCF22350DB92127CC, 0xEB5394F74622ED4B, 
-0x203D09EA5401FBBA, 0xFC94C5C24F39791E, 0x6143D9E59445F7EE, 0x6E98CE6014F2AF60, 
-0x2CA4258E15666533, 0x11BADAB5, 0x173469C748761712, 0xD6A2AD0E70C5E0AF, 
-0x1E64E7455B4FD7CA, 0x837D098B1273A30A, 0xBB2D71BE73DB923B, 0x73933449E4FD93F6, 
-0xEF412293E1E4DD95, 0xEA00B8F72A832913, 0x9A060825988D7081, 0x86613BBD, 
-0x7DB281330DD05759, 0xF60188F7974366CE, 0xB0017BD52D263884, 0x9B039E44859210F7, 
-0x81560BC9DF2F962E, 0x32E1F2CD85982D1F, 0x7D4CADB38B98E0AE, 0xB568482D05C5FF96, 
-0x35FCB69892EA17, 0xA9C8E58C, 
-0xF7A5CA1B14385F15, 0x6CE81BC4B0A56E39, 0x75746F35FB6F514E, 0x31E9027740D745A6, 
-0xA8FF6D28BE46D103, 0x9656FDBACFA72751, 0x1882CE033AFDC317, 0x808FCAE4F385051, 
-0xB19E4D315A931361, 0x21ABD81D9, 0x59903C87F06BF5B9, 0x8FB311384074DF2E, 
-0x8C98F2EB5BF7E86, 0x7B3D15D73A5D2968, 0x4C8C5894DAC4DE0D, 0x939629E01C9514D6, 
-0x711CAF61BD7F6D06, 0x7A5D814A7DB0E395, 0xE37CD73D7C904F3A, 0x1DE0A6CB8, 
-0xF0DC2E0FB97664AD, 0x7D567C5AA8D6FC85, 0x32A4F4487615EA3C, 0xA84E8EBE099D9CC7, 
-0x3F9C4346996869AA, 0x850A14CAA3E1FE61, 0x71C84C80EF3E989F, 0x2206570E43ECECB4, 
-0x96B2CEBC4369C9B8, 0x84AEF592, 
-0x1E815EF4EB42F182, 0xDE29CD8679E9BD8C, 0x10E5884733255A48, 0x5B1A23DEF002085, 
-0xBF18A5466C9F44A2, 0x7A4E3CA2632DE86B, 0x8325BD06D593C593, 0x497C0D9E31E0D758, 
-0xA7AA0BDCECFDD662, 0x1C9537819, 0x46DC6FC89CA7AF3C, 0x5C388A4E8B827614, 
-0x7B0D3BF033177D2A, 0xB6519CA2521D723B, 0xF7BD13DDB290F57A, 0x8366082FF5629A72, 
-0x8598B9079B9BB54A, 0x6C5D67D4746CD62E, 0x7315A934038DC317, 0x12279A3EB, 
-0x76EBD14375FF7772, 0x5271CEA07C5D134B, 0xD414054D3AF5DA67, 0xFC75C29CA1EE4C62, 
-0x68D06254AE0994DD, 0x9FC521CD34FEBE25, 0x33B983A7B3450E0A, 0x75E8C01E8A3EB46C, 
-0xB267060E2F5D523C, 0x7B632F3F, 
-0x33F0DBED5D64104A, 0xA0DF11032E7931E2, 0xFBA8C030758C60A9, 0xA43683B91D675432, 
-0x8CFEF037C4844039, 0x3DA3990DD27A23BA, 0xFD3A604498D992AC, 0x6404C97831748670, 
-0xA875ACCC9E406A42, 0x1B71A38C2, 0x4214DBDB648F269E, 0x207AEBEBD4EA3B4A, 
-0xAC01C5A4BC8DC2DE, 0x715EA80D3E6EE044, 0xC11B0B0182A0144C, 0xE1F297D7669FBEB, 
-0x407EBF10CF5434AF, 0x6BE19040AE46AB4A, 0x80408595BE998D7F, 0x213B9E3A, 
-0x53967C3542488D34, 0x8AC3598139D4A48, 0xCF22A4BED7631A5E, 0x2488F84DA27151EE, 
-0xE6B801C26ECFC3FB, 0xA00BFF54993F70AF, 0xC6345F1A03336BBA, 0xC705F8E1B5AEF5A3, 
-0x38D4F90D31415512, 0x1F6C20499, 
-0x993C570E4BA8875C, 0x94AEEDFD640DCB84, 0x9E1FCB8F9B66EFA6, 0xF53C89EEFD140DD1, 
-0x21022A301C8C8E82, 0x5F5E56EFFD16300C, 0xDBDBB64C95FF658C, 0x16DF4AAEC5170AA2, 
-0x33C2E5F79555F3EA, 0xE981C836, 0x3265A75C8EC9DB44, 0x9573B607BF5E0C3C, 
-0xB92AF1BEC3DF2C08, 0x9E6F4A8FECEC84EB, 0xC32672732011F96C, 0x2A823E20A4A1D9F9, 
-0x5F73F02C5EE012E5, 0x1559D1A15DD7032D, 0xBCC1F927B0409B92, 0x201D9795D, 
-0xA913C848453D995, 0xA1A648217FAF2AD4, 0xA048E8A0AEF8C400, 0x31B1814D6B245251, 
-0x362ECF08EC16FA6A, 0x3E00A052F643A72F, 0x5E8C850489324E16, 0x9EC8F813B2B4F019, 
-0xC4456445BF2FF7ED, 0x1803C584C, 
-0x5FDE736AF4F0ABA, 0x5D5DDD6EF5AD3C5A, 0xF99BC4D6D6730284, 0xB78FD27FFF8A71DB, 
-0x39F9042AF31FFC1, 0xA8DA8AC0A24C56E2, 0xD442E510D238FBE4, 0x4E977F40CE5A7A3B, 
-0x3EB3977E7CBB876C, 0x1E54993D0, 0x4DB2C85C38FEF929, 0xCBF4B560DA24F51F, 
-0x8EB0BB9F4C0669F7, 0x5C091ABF62173288, 0x6579B51CB3358301, 0x7E5B71C02C40124E, 
-0xCAAEB2A36B4D4861, 0xA16F0F94030DAFF3, 0xC656ACCB1F2BBC24, 0x16435D7BC, 
-0x2AECFFEA541EDA4B, 0xE3AE19D067D32C4E, 0x77A307919B8279D9, 0xA3D5FF2CFB9E411A, 
-0x5D05C9C30670908E, 0x37C0F8973A287EFC, 0x8B01D47F35971C84, 0x12E152D526E1BB9E, 
-0x623CDF0A3291E493, 0x12E46AEE9, 
-0xE36BCE1C1CF135BA, 0x7367FFBBE6CE09C7, 0x38CBA30A8BC9274F, 0xA954484B7BFF64EB, 
-0x7E5D0F4B37195E12, 0x308559B37379527C, 0x2226FC595F9F2EEC, 0x2DE53E533659DC11, 
-0x22D05A6089E30FD5, 0xBB66E678, 0xE61BD0EB3A478887, 0x46730AFA0C7FA9CE, 
-0xC685A67051FB3767, 0xED8DC5005CA1E995, 0xAC61D99D9639F581, 0x971B78D295D4866B, 
-0x4B6CFD56EB5D40F2, 0xEA2DC2B14A84C6BA, 0x617314BD147A7FAC, 0x173CD2AD7, 
-0xFE62543F037AE670, 0x9BFD3E7BBE275B2, 0x2FC5C2ACB6BCFFFF, 0x24366E1212FDF17E, 
-0x8A058D1988FFDC27, 0x1464559FA1346EB3, 0xEC90213F749214B8, 0x277D2443EF491794, 
-0x967AB3725DA184EF, 0x20590BEEF, 
-0x2D8673F8D0C6BC3C, 0xDCFF04624B5DFCA8, 0x151956BDD592343A, 0x2A05447B2B8F20EF, 
-0x3615AB7893F13CB2, 0xF7E12D00DC3F12EE, 0xEEFDD7CA832D5AA4, 0x8F21959D58F52F17, 
-0xA69D43D6E25CDECA, 0xB4ED7AFA, 0x67787D5ABE17B8C6, 0x4739527BE49CBDB9, 
-0x5C7D8EE3F0D85691, 0x934E2360C5C07AF8, 0xDE80A018FBA13351, 0x54C1A2FE57836A98, 
-0x4FFDDCA860842E5A, 0xC46F331D3836F545, 0x6DF70160D56E7496, 0x4C80E455, 
-0xC74E58DFBE617127, 0xC4C1B3BC85EA359, 0xC37FA21AA5B5481, 0xB123B0CF06B554E8, 
-0xB407AF020BC27B24, 0x7E0A7562C37214C4, 0x92350F1A98E0873, 0xAAC8AD9CE9255EEA, 
-0x1C2BF77F795006F0, 0x111A5ACB4, 
-0xA62E8214F721D627, 0x55E2C3BD55F7FCB7, 0x3FB3F11985154206, 0x79887851C465C79A, 
-0x9477D5F24188158, 0x574DC837C7F6E470, 0x8C2CD309BC271C21, 0x642B5FA5751DE0A6, 
-0x54FD432428AEB057, 0xECCD1708, 0xBCC9F90272BE43F6, 0x453801B50414FF9D, 
-0xE3DD539C72252392, 0x22AF6443A40D5610, 0xD3846450BAA2CD04, 0x6F99371C331D67BC, 
-0x976044A3408D03D3, 0x88DB5411A8462D50, 0xD79B98D645EB808D, 0x156BC4566, 
-0xA14A68351B339645, 0x417780E6665AD437, 0x2F0691672BAB80F5, 0xBB72093401AB61CA, 
-0xBBD1F188C6E50408, 0xAD77987CA3BF5778, 0x66021C72689142D8, 0x81EE6C9CC61814C1, 
-0x2EE1CEEE15ABACE2, 0x23CEA2F04, 
-0x72694408844C5CF9, 0x8104F157EB9EC165, 0x41075E84432DAD3B, 0x8DB04845C4E2C490, 
-0x7D381857D5F98F65, 0x89F42714800CDE42, 0xA2863B04F7EF1323, 0x161B940E177171D4, 
-0x408ACDE5EA924BD4, 0x11A8B0B1D, 0xC1BA9A5FABC4EF56, 0x6E0A1AED37080A75, 
-0xBA76A3B011CE0506, 0xA5A6D57C89907DB5, 0x5FB4BB4870AC0A91, 0xBAF69C00BE0EF6DD, 
-0x9476916CA92F0A3B, 0x5146DA1964D6095D, 0x46D80679B62AFD7A, 0x6082D8D3, 
-0xDE3770D9479BA67C, 0x840692E8A9B8DA6C, 0xB3FDB18AC6047D1F, 0x8278517ED04FAFD3, 
-0xF3ED01E70B64A863, 0x39921D64B8E65225, 0x609649B1118F7E7E, 0x4E6E8681EAD47F01, 
-0xACD3D7AD9BB5D049, 0x2144FD541, 
-0x81DE135193712C5F, 0x8885FB82B2A15B19, 0x53202B71EDF43A04, 0xC76873DDE578BC61, 
-0x69EBCE10A71EBE6, 0x78E663C37C8F9285, 0xDF5EE0B38CF8661F, 0xF45DA14F3185C044, 
-0xF9BA066C11F0E1FD, 0x10436C682, 0xAC6129E6F5E45A10, 0x9E60376728EEB69C, 
-0xAD9F19184366F8C9, 0xF504B213C1EE3B39, 0xB8EB219A7936AE67, 0xCED99E65E2AD56A0, 
-0xBBB1D6B3D5B02737, 0x22FA14D327851DD8, 0xB8DA550ECB56057E, 0x14B9F0100, 
-0x1E8C30D3A6238D2C, 0xF10A4E0F8DDB64FF, 0xC07B86A7361430C6, 0xBC9104CD80DA71DB, 
-0x6B0D23B79B54B36C, 0xDFA03A30CB8BBF37, 0x54085C79BB5025AD, 0xFDA6091E383822B1, 
-0xFA2E874B32AAB321, 0xFB934E7C, 
-0x1237C96E8948B28F, 0xB9F0FABC33875C12, 0xCA592C0A7B08FF4F, 0x6CF10EDFA4523AC4, 
-0xA6C172E4EC8EC377, 0x86DBE43FFFE96CC3, 0x37E78A3C23A6B906, 0x5181D96C80D82BB, 
-0xBA1FA96AC2D84200, 0x11ADC056D, 0x2070270A005B4036, 0xA3BB799C09B9509B, 
-0x84F37ADCC7754AC3, 0x456E7585011C4E66, 0x9226A3632B896B97, 0xD94A1BA2B0BBFED8, 
-0x3C995E3406B62067, 0xF35C8AEA41A465, 0xDBA511446F866B8C, 0x20D625B26, 
-0x948B311ED1EAABCE, 0x33674502B9E00CE1, 0x842FC2F885F870DF, 0x50548FD9043F623A, 
-0xB17562053843AE87, 0xECA2AD318AA075B9, 0x30D7D3CB10C0740A, 0xFFE9FED80820046D, 
-0xE6B4BFCE0A9D3B28, 0x20FAADB46, 
-0x98C638E3D59A60FE, 0xFE0C64662B1F2B32, 0x246A8978E60466AF, 0x3BEE193887456F94, 
-0x88BA8BEC3BA9D703, 0x57236A2FD2A5FE6D, 0x238F72940D505482, 0x4AB1BEA4B33A4CB0, 
-0xE61DCBB9F47B04D2, 0x34A92D49, 0x7A6AE6346CA47D99, 0x996C37CDCD6DBD2B, 
-0xAD592085906223CB, 0xA185547F221F1E68, 0x31C88A1F79099BD4, 0xF60A1B405019F295, 
-0x6E0C6AEBA051DD59, 0x7842C534720845AE, 0x6226ECE4026AD286, 0x2457FAA7A, 
-0xB7906DDE2F04BEB8, 0xF45FBAD5AF20976B, 0x2BF7402823120598, 0x54B09BF71B9233BD, 
-0x86F1112194F140AB, 0xEF36CCF2E85BB2D8, 0x76F6C6425EADC1AD, 0x4A80DFB669DCAFC3, 
-0xA52227E1B6BABAF4, 0x84D672D8, 
-0x3B3B3544B740952, 0xB3A07C01D3D564AF, 0xD9E279A6D982D45C, 0x59BA9FB2C62D9BB8, 
-0xA791ED50D743CCD0, 0x969F92454BD70A21, 0xE2F62B1BE43E9047, 0xB42F5BF6A1F1FB83, 
-0x3E8E6152EDBC7128, 0x192FFED65, 0x9DFD4F444F292919, 0x3997A0B5617F18FA, 
-0xC1D2855554CFD78B, 0xB0EFE92DF4CAB159, 0x46A83E7D5B71ACCF, 0x20AD5896EB545753, 
-0x149C07D12652BE05, 0xCE36E8A1AFD5501A, 0x177BC35F7B128E33, 0x1CE85BC6F, 
-0x84DA992879B86382, 0x2B2DCE6BA6BF5D8D, 0xF0A5ADEBFC337AF2, 0xAFB5495AEDD72951, 
-0x72BE11E19C1D5242, 0x53BD4669C8942CB9, 0xD6182D5343A2ACAC, 0x4F8C0BE3E0314839, 
-0xB2C50F1FBD1BBDD8, 0x8DB20438, 
-0xD5B406082ADDAB32, 0x6F53EB1BB4164EB6, 0x28183192ED062F8B, 0x967ED1BC677EAAFE, 
-0x2C3F0E47F0E24FDA, 0x6041A07C6957FA7A, 0x82A05A897254657A, 0xDAD374117D7C3EF7, 
-0x61EEDB3F0769200B, 0x1348AFFAD, 0x843FE5BB973CC181, 0x6A8EB706FEBD93B1, 
-0x893900D7B34A48AA, 0xC75476691E91E89F, 0xB4E7D29A8DEE534A, 0x605134ABACB46CB2, 
-0xB8D853B23348F6B2, 0xAE4575DE85E8AC8, 0x7313A78C6246AE93, 0x2535AE067, 
-0x1E022B008E25801A, 0x6748567CC8ADD95E, 0xF5404D40C0DC186F, 0xDE80D8EBF330EF30, 
-0x17781A7B036F6367, 0x72119308D5769F7D, 0xA7998BA4AF206BD2, 0x7BAABC1966D162EF, 
-0x3E7F177944C1C741, 0x1B4BDA4C4, 
-0x2A0EDFEE6BC7FEDE, 0x54523077A091EBCA, 0x79A95A0A6FE9FDEF, 0x44780E24067F402B, 
-0x73792C8FEE90EEEF, 0xF53CF2D8ED3D38F1, 0xC0607D7D0A6A34, 0x3B6B2170C6FFA664, 
-0xEBD2C43F763C9D88, 0x20035D740, 0xF10F56EDEFAC4A50, 0x3F932373B0DAF0DB, 
-0xBA57C7EE4293AE3, 0x1499C81372E88B9B, 0x4201AC76A140E435, 0xF39DB91F59A1F6E2, 
-0xE96DA6E6EDC3DD2C, 0xC10C3B0EAF1DDDDD, 0x2AEDFA1BFBFB36A0, 0x248FEA378, 
-0xF1C545D37470701, 0xD642E80EBB339A5B, 0x4C2CF68B55CAFC41, 0x147E17D1AEE43DF8, 
-0xC84CBE30C120BF84, 0x923D13CA680E68C4, 0xE8A09A37698D7F9A, 0x580984225969622D, 
-0x266360F8EABC0CCF, 0x192888083, 
-0xA42A8492F9EBF9E4, 0xFA0F9D21141017D3, 0x44384D4B18B300B4, 0x1DB6C0CADA990BB7, 
-0x64F7E42CD962DDFB, 0x3B4DEF2B1F2CCE3, 0x5738329B5D5010EA, 0xD185679A935E05C2, 
-0x4C73FEA3F9425FC9, 0x16EA0FD82, 0x51B6500FDF222895, 0xF466C8EABD2B7D43, 
-0x4D363CAEC9E60640, 0x3EC15050429624E9, 0x62A3B403CB57487D, 0x755F3DB1B5291BA1, 
-0x24D977EAA457B96C, 0x3E96953A2D2D59F, 0xAE17B744F2400EC5, 0x25152BE8D, 
-0x874E34D71E0C5DCE, 0x34D86A3F98F77364, 0x1355B2DB17613E7, 0xC948069C0628CB5A, 
-0x5592BB0BB14A8D89, 0x43B68ABC56E3971E, 0x1CC9C670102EB341, 0xCE37ABDAE0952AB7, 
-0x5D2CD06806E6C3C6, 0xFAE27F69, 
-0xB74D42960F5B2178, 0xD8F1DFF378718C83, 0x61400EB0A491380, 0xE43CD7E8EC9E379D, 
-0xE82BEEE3A7986B71, 0x7CADADB2D0095774, 0x626EDB817373443A, 0xC58EF9A1F409AD6C, 
-0x125C254DD07E3A35, 0xFA4133FA, 0x9BB52CD08A709522, 0x6FB5C218F0284A69, 
-0xEF91C475BDED185E, 0x4D7E27BE80CC4E3, 0x98AFF4401DF7B6A9, 0xB9A3190EF6726A, 
-0xADB59C63618F4420, 0x3AF65CADE3A46A54, 0x73D0185D33861AB2, 0x1A984CB75, 
-0xE8D988D735E65846, 0x9EAD781CCC16356D, 0x3516476322C9AAD4, 0x4E20AA8ECB73C3B3, 
-0x85A36B726F35CF4F, 0xA144907D334BBF93, 0x4AA7E15B39C8FC26, 0xF45D872D2C9D9DA8, 
-0x85E528097F58AC4B, 0x1195319BC, 
-0x9B9E677190630661, 0x4F060A0741984461, 0x92C97C45C430DEA6, 0x6AB182408B2D3D8F, 
-0xBD344D89C1CDA90F, 0xAB46E2175C81F4E7, 0xC00A77CCC62CB9E5, 0x2F6AAADCA2F2606E, 
-0xD0420C41F5CA2BD, 0x1883300C5, 0x3754E2CEFD189830, 0x6B4B137DB2A7ABBF, 
-0x5C0E38A284DDE1D8, 0xD1A0CA8F4D9B59E, 0x4B3F658D7EDE4B75, 0xEF92B2E77D4CD6E1, 
-0x36AA76CFC52FD6C8, 0x34C85669E2E93C50, 0x6FE6C359D5127792, 0xBA974C77, 
-0x6DA4D199F4830E2, 0x4E87BAE279FBAD5C, 0x2D2FAB235F9DB67, 0x9D21B17AB69C1C9B, 
-0x9D8C067ABF94D61B, 0xBC24C50DB352E5A7, 0x9107A5CD0C47838B, 0xFCCCFC50D403E19C, 
-0xBFD194EB2842C468, 0x24321FC62, 
-0x8D120F8695C2C314, 0xF8824E4706B1EF96, 0x7FF20E0D3151B561, 0x338EA73BF880D284, 
-0xAEC7B70605AF750D, 0xE9B59396EDBCD9AC, 0xA28AD4E46AF9C07A, 0x8ADA7DAD7E4251A4, 
-0x863C1C9E5BDAAA03, 0x19640A865, 0xC767D406008529A9, 0xA7E0503349E80F4D, 
-0xF87E52E1C6715287, 0x734343550B4CD719, 0x97803661014A83D8, 0x461E29C2987C0CAE, 
-0x374E9DBCDB761819, 0x62BD13FF875C6E6C, 0x707256EE5DE4CAD8, 0x1A0955DC3, 
-0xF97126DEF06D8996, 0x7ED48CAF8F210D1F, 0x9E84D5FCFDFD371, 0xF0A57E93A7A7E5D3, 
-0xDC5B17A85F92AFEF, 0xB5B0893BF373E6, 0x75516BDB7DB6BE1A, 0x476519A4072D6919, 
-0x311623F75883C0E0, 0x1A43FBC0D, 
-0x2C1AD035BEA194CE, 0xA5ADD7E255DC8BE, 0x565383448D1A8D68, 0x540D24F72D128744, 
-0x86B2B5150090C884, 0xAFE5A4E5324EFBA1, 0x275B05945812083D, 0x997138A59FDB3FAF, 
-0xE12928024AB47343, 0x15A887289, 0xB6B516345CBE3D24, 0xF0F195ED69A46601, 
-0xF888DEDEDA98F413, 0xAA53D7FE0AEC59EB, 0xEAE5B95C6AAC3AB2, 0x9369BBA475BEAA99, 
-0xD1D17B5849C7C7CD, 0x27C6F67E8FBEEF7, 0x85D29EA9478B353F, 0x15D72D995, 
-0x19FCEFB70DAB32BD, 0x80FE12DE22367F8, 0xDEFB89A10FD537E9, 0x97E19185992440B, 
-0x70824E802A4CF30E, 0xE66A6B8D516B3922, 0xFE51E5B97066E31D, 0xC5DD1D8481946C8D, 
-0x2A895107CA7F7AD0, 0x230305167, 
-0x5AE6C220B38FFC6D, 0xFD7173ED72CC5233, 0x18EEB5B73CEB7AEF, 0xE5308A45417D21D8, 
-0xE2F7F8DDE05BBFF7, 0xEA006B310793C693, 0x21D9605070AB24F0, 0xEFA582A6B2A4BCE, 
-0x9D05A9575DE49F51, 0x14E6C4D5C, 0x12BE2D98FD956EA8, 0xEFA2FC0AF2C5195, 
-0x5E0423F4EB162FFB, 0x4B568CC936A6B0E1, 0xA8B7AB1A3392744E, 0x935FC67CFFAC7D1B, 
-0xCD23B78DD68FFA51, 0xD997E29FB3848A29, 0xEBC0AE8654D43652, 0x814AD58, 
-0xF5B8B4A138D518E3, 0xB3B4876172DFB037, 0xC436B9B59128BCAA, 0x99DF38AE14407CA8, 
-0xAD9744247A73F8ED, 0x713ED9A5854EE34B, 0x8D2C2A5530EB694A, 0x1B5B5893BC29D31C, 
-0xCEB3B05DE517EF85, 0x4F0C62C5, 
-0xDA828F83FCB5FC57, 0x9CDAA47E030B13A, 0xC39CE6784177DC4E, 0x624326774C7E0633, 
-0x837252590F2D7DA, 0xA42210B7D594D566, 0x7DAC55F76B243F8F, 0x14B09CD43C5B8636, 
-0x12A2E79345931307, 0x1B6D14799, 0xAD21240624DE60BC, 0xA649C06819D1FD77, 
-0x4B570B23425199EF, 0x210E50A24BAA615B, 0x1CD2556D2596FC05, 0xA63B8734BB9489AF, 
-0xAAD758AC0D649352, 0xA293062C6C021A54, 0xA610A3012CB7B1B4, 0x1A2D3EFF7, 
-0x7B17AFEC6E0B9BE2, 0xEBEB5FF47A259140, 0xF6CA0A62913171A, 0xDF826693B25CD22A, 
-0x197C6C9C0E4622E, 0x19BA205878A5ED0A, 0xBEF9782181CD14A2, 0xA6E6117C15195A1B, 
-0x80A64DC5210E712D, 0x237731B3F, 
-0x56263D4D9EA27CD8, 0x9F2911F5CAFCB525, 0x40E2FD434E764B25, 0x3FC97722C8467737, 
-0x9CD5B1F5F5A99881, 0x6434FBD096F4C1B7, 0xF3362B20E3D626E4, 0x19BF1301ED987434, 
-0xF58FDF88F473F617, 0x122C82A37, 0x90E1E9968C09F774, 0xB2203E4525A06166, 
-0xB19459D78C87E009, 0x9775028E422DBBD3, 0x18C496EE0B41BF3E, 0x881D01B199AD320D, 
-0xB3412A007B19C27D, 0x7B64D43269811CB9, 0x2964E9FA7723159D, 0x111FEE716, 
-0x813F0105FE2E0EA3, 0xFB0F08187F269CD3, 0x24CA098440F6EA0F, 0x73C90DD20D1C90A3, 
-0x977E25A76739BBB0, 0x5D24D1FEEBA138FA, 0xB16CB730FF1CAD30, 0x1616F5DDFB35FD1E, 
-0xFBC41AE50D3B7B87, 0x8138C203, 
-0x6D2F0FA4EEC9EC2, 0x8EBD9B780E724DA0, 0x462CD82CD5A57B54, 0xF4680306C82C4EB8, 
-0x99B289587DE4C135, 0xDF0A01C1398C7752, 0xA88ADD072877B906, 0x9D592156A6BD86D1, 
-0xA3722E36A7994C93, 0xA44B0381, 0xA6C63ED688559496, 0xC457AA2661D1B9A, 
-0x1D460BEAE7E2EC8E, 0xD51ABF66DB9784D, 0xC1CBE6F4149AED7, 0x305A58C67597DBF9, 
-0xBF13C769C529D9FF, 0x554F796CC530B0F7, 0xF4A51C0E02918EBB, 0x2CF805DD, 
-0xFCB395D429EF286C, 0xB03670B08D0B8100, 0xD8C700DDB3AD7949, 0x622FB1EA9C2930C9, 
-0xA1E317868E7489E0, 0xDE9B605CEEDE62F8, 0x879A3D4FF814DCEB, 0xFA6BABCDE71912E5, 
-0x957DC644EACEE6CD, 0x1E1ACD24A, 
-0x428B990B1C26CBA, 0xDD890059B124CF5D, 0x806B9DF3509051DC, 0x93BA96242AE50C10, 
-0x1E6B6FF43A310F15, 0x31C236B0A29BA2A9, 0xD4CCEF9483EDCB5D, 0x8EA34C3342679DDA, 
-0x4D5333CFAF6DD467, 0x2431C2F80, 0x66AC3A00B8F9C2F8, 0xC96F966D54FAD297, 
-0x43AD55B69DBBD1D6, 0x29EB39A1485E04E7, 0xAAC20FC78736ED5, 0xEF7703FCFC1D69FC, 
-0x1A3DDBEF3DF03ACE, 0xA99AD9382675A040, 0xEAD9D11320F60D9F, 0x1E77A7F94, 
-0x11F7A69FBEF665F8, 0x2347F9A133E2A7E8, 0xFA58A2EFE121786B, 0x22D32325BED9DA37, 
-0xA820A059D2214B7F, 0x9644D08F60C1AD6E, 0xD06E2F3491D125A6, 0xA95B237AF7E5F4DF, 
-0x782DED93AE90A1C5, 0x20149F8AA, 
-0x9574C7D6CF3C2F31, 0x6BE3A6E1B05391AE, 0x81A39CBA78B57282, 0x25B56A46778E9FBC, 
-0x89547427BAD953BD, 0xA222D6068A26E103, 0x979991A17F1C96A4, 0xB8DA57540AD6776A, 
-0x5C962AA86A11B35, 0x5B5CC8A4, 0x935C80E47260BEAD, 0x3C92468E7B1530B4, 
-0xD73C23E70BA1CD4C, 0xA0EA889485368DB6, 0x56324A0F207B3530, 0x9A6201FCE668A7CB, 
-0x43D374AA93A174DC, 0x800E3B224BAF98D0, 0xE4A87F3592CAE1DE, 0x6E17E0F3, 
-0x9C00F3D3E8FFF737, 0x1910AF366373BFC1, 0xF3E1BBF767BD4F82, 0x99B9860207ED3ED9, 
-0xD18EF026A0C0BC78, 0xFE963B8EDA5E7E66, 0xF6C423D3A521438A, 0x9EE3E37FCEF9FAB2, 
-0x2DB80366E193179A, 0x101659A12, 
-0x3CCD22FFC186C2A7, 0x486679E055A35F03, 0x2DA75B896E5ACD00, 0x570AB320E567A8EF, 
-0xD422062DD81CF261, 0x79F3F317BF2C9665, 0x2E9785796C0B02EF, 0xC55EB42A96DB79DA, 
-0xF5E0236645B0A9A8, 0x258DB5785, 0xA5D851A3BA05914F, 0x5982B3E7DB53ED84, 
-0xEBC3DBE4EDBF48A2, 0xBB9C9962684C24B2, 0x2986A27B70CF14C6, 0xF05D7A8A79AD1836, 
-0xA1FB9992C85163DE, 0x9B98B2D44444F825, 0x29EB4D976ED63D4D, 0xAB4E5A1B, 
-0x743D625F8763AE78, 0x2A8F4A1ADF268209, 0x1C8FF1EBA3AC0000, 0x26E25D9FEEC2E378, 
-0x897B0F8CC71F5FA4, 0x9B48CE1E4FC86886, 0x34D503501B9E9B85, 0xA0AF2F454E765365, 
-0xB4708BBDDF4FA0AB, 0x5919B356, 
-0x63E00E6D9CF55FF7, 0xB5AB8940D649508C, 0xD09317FE70D090D4, 0x81F03A5B14AE84F9, 
-0xD3DC658C247E3AD6, 0x71C8292AF434BF3, 0xEA3A782D4A8D3AEE, 0x1E0746E0E39B478E, 
-0x5E429C281F2CE798, 0x43E4998A, 0xAB9102BA4AA3645A, 0xAD73385B3DA1AD8D, 
-0x3605E6E7FF22C42A, 0xD2A052FD4D5AC913, 0xF6DBE43891B4F053, 0x9523D357F57050E9, 
-0xCD73E3527770AA47, 0xA190DE947E49AC60, 0x9B05736BA4CF756A, 0x1C8F93613, 
-0x6FB98954011C0F7D, 0x8EEC404715E7D96A, 0xFCDD5D4FF4DEB1A0, 0x95968977BCFE476C, 
-0x244A43709D4944F6, 0x24AF5539DE3FB2BA, 0xBB149E33C26974AB, 0xAA2B9A17CD69B982, 
-0xCB8A61A4D1117277, 0x8A5BE581, 
-0x983EB8BF9935506C, 0x8380EE4F0362AE47, 0xA46C97D002C15D4F, 0x631B3B385DE6540D, 
-0x546B11CCB5E9F6D, 0x5295EC011974C417, 0x4C460395C2DC72D4, 0xE480F0713ADD8501, 
-0x43E7D77A2B0490A6, 0x225443713, 0xC4A82E47DC436477, 0x30C3392FD2C49ADF, 
-0x36DF29C53AE16A9, 0xB627F70041727D70, 0x15E41ECB873898F6, 0xB419107ABF7CF3BC, 
-0xDBC488043E02144, 0x71546852800FF3E1, 0x4B8E7AF09E975135, 0x15477C826, 
-0xACB0792A48CB8F06, 0xFA139264FD137FD, 0x6CD866B53CAC54E, 0xCBCA76CD3D0778EF, 
-0x6186E4B058CACA0C, 0xDC3F816E468080E3, 0x72914A7BE026C9BF, 0x7326581CC65684D9, 
-0xA086E28EE69B3049, 0x6E5F25A2, 
-0x314BB8C3E9AB0C1D, 0x9076587DE5DA08FF, 0xBAEBF74905BB1497, 0x130D73F271DC2727, 
-0x8D921F9BEE61B333, 0x360F974DD8AFA97D, 0x5E56760EBC80AA84, 0x2E110E08FCDB078D, 
-0x15FA1AEB80BE0255, 0x182FA0BE4, 0xD0E175CC1C68E683, 0x2BA0B1A9F2B4A00A, 
-0x6FBA4F53ECB03CE9, 0xD35FDE99F082A883, 0x979413D90632D941, 0x671D74EB8062DAE1, 
-0x53CBF600036838A9, 0xC3326B0DFE908478, 0x150E84567805EB27, 0x2771275BB, 
-0xC14DAB8EF92EF76D, 0xB33BBA4790FAF961, 0x3C3F96AAE466ED3C, 0x204578A5A67ABC55, 
-0xC34471682CEE7019, 0xF4F97989E929ED6, 0x7F8C7D9984751EAE, 0x8EF42CFFAF8C64F, 
-0x856697D40C49DEB3, 0x103B49B60, 
-0xCF87EF03DB440633, 0x66FCDEEE07671C2, 0x645154C84FDED670, 0x99E93F876AA89ADB, 
-0xC0555D0AB08BE3D, 0xDAB82E8B9F39E954, 0xFAE6765C649459C, 0xFC30CD370EC82A36, 
-0xBCC1C0C02CA1DC2A, 0x2070C214, 0x7F0F60F6F4B1EABA, 0xEA330F7A8883BFA4, 
-0xAB30F2B207221EEF, 0xBCF4FA7835F02E10, 0x5D3DC4EF17EC6C9C, 0x14C7320A69D1FDE7, 
-0x5555CF5243618659, 0x5684BB05303D2591, 0x125F95FD6E107BE5, 0xEA2B38C5, 
-0x1765D27D0C3FD7AE, 0x600CB926D5E419B2, 0x49A2818E948705B, 0x1920D8F12C8456C3, 
-0x7D89871CB626BB86, 0xC5D11C72B967B12F, 0x3682AD18EECA6C98, 0x23277B8030F380AD, 
-0xC61233F4AD4065B5, 0xD2125668, 
-0x8720B8E2CBC5286E, 0x4E093F9E8C99C35B, 0x109C988A45D7D7D7, 0x89C12F99FCF5B167, 
-0x1FA7AC56E29500FE, 0xB60FA1B74655EE9D, 0x288422485EF3280B, 0xEA9753D445D8E172, 
-0xA07A8297DBEA21DD, 0x9DCC4506, 0x5CB040381A294083, 0xE3AB858C736CF6B7, 
-0xA1FD34601BC9F977, 0xF552C5D3ECB7C441, 0xEC3D7AA3686139FA, 0x6D71089B7332076B, 
-0x9987D3DF1CAA999C, 0x8B636635E5F7DD2E, 0xA2D2BD81F0E5F6ED, 0x4C5AA3FB, 
-0xF6D348179CCE187B, 0x7413C6C35879E989, 0xD9936B74B3E070BC, 0x2D7BF0CC0286176D, 
-0xC26694124ADF899, 0xA4F197E6E8A595F5, 0x43FF2C4A3FF91065, 0xCE732F50975C56E5, 
-0x1AFF812512939B72, 0xA70E54BE, 
-0xE79DEA7A3F35A38B, 0x880DC2A7B9F66DAC, 0x7CE62758C5256EB8, 0xBFD0A245137E3FFC, 
-0x8BA8543C72FB2468, 0x88EB230ED75026B5, 0x8AF8AADB61AF896C, 0x9FD4FFC22DE2038D, 
-0xB1FAEFED3ECD118D, 0x4508C6C2, 0xD244BA97EF9021BB, 0xF926F0A27950B409, 
-0xAB35DE640E0D1793, 0x577F144FF963BFCD, 0x617CD2C9843BD02B, 0xF73CC2859303A956, 
-0x45CA313AB3EDE1B, 0xB232CCCF49D1EA38, 0xD865A8CB154A4B39, 0x49379A17, 
-0x8A0CB871E7FDAD86, 0x6A0FEFF4229E76DE, 0xB9CB43DC7B3CA9CB, 0x2A3F67608E950ADA, 
-0x50F5CC2DCBC9484D, 0x8D38C4B54A89FE31, 0xC3AB8904B2C59992, 0x3A9EFBF10BA057CB, 
-0x6067507D2207C5B5, 0x1C6A7D5ED, 
-0x8A0A58CBA55AA054, 0x29069A518D58D16D, 0x7D45F08F7FCEAB3B, 0xB5CB16311C128A48, 
-0x8A13FBCCDE03ED19, 0x3468C6C7F747534D, 0x12F8CB8853D0697A, 0xEA1413FBF977DCB8, 
-0xD650B34E7761956B, 0x27B585617, 0x23DF2CA58990C003, 0x4C54C30A9903A8FB, 
-0x344DEC72DE4C6BF7, 0xD9C574BA1999511A, 0x1DBE27170355C98E, 0x3A36549337D0483F, 
-0x94C2686E5E0FD34B, 0x2796AC1C2375B855, 0xEF9BB1C4D06EAC01, 0x6700008E, 
-0xB8976EA8755CC232, 0xAA35EA1874421D96, 0x3EF04C2827511402, 0xB3FCBE8619D19170, 
-0xC0EE636724D86B8D, 0x2B1395E4B6172619, 0x7C9E28D3F63EE5AB, 0xD78D2FEE4FFE4356, 
-0x7692ED2F4BE75CCC, 0x16311A2D8, 
-0xFE5CF172AB3622FF, 0x227DA7ACFC0E7E, 0x9399B48F4EC8ECE2, 0x72864078040FB04E, 
-0x1DEACC8CCD62EF79, 0x92DABD0071285CF7, 0xC7697A6DF0D2D43F, 0x83E3EFBAAFC06047, 
-0x609D073F66167A1F, 0x184CC473, 0x2CC80589DE34B1D9, 0x922C90F51E88C2A5, 
-0x7EBA9EEDAC9A7098, 0xA6A0DEAAE5B5EEA3, 0x9477DCC317520B34, 0xA7A4BE5C657F6F17, 
-0x1F30DE12363B61E, 0x93121230E4036D99, 0x603859A1A675E2CD, 0x20418F78D, 
-0x3E108F46B65F5083, 0x4FC52564C377B85F, 0x34C996D6AAD0E6F7, 0xCD47084200E3A193, 
-0xB52356040A0ACC63, 0x22C8D07507965B0E, 0x8A8EA807DEAC38F0, 0x3096B08A5FCBE2BC, 
-0xC21CB49700D370A5, 0x24037F62D, 
-0xB8560C7ECA570F12, 0x7EF5F7ECE14108AA, 0xBBAE98E1679FA778, 0xEF42E23097779D43, 
-0x919F2AF151AF659B, 0xF7CD034229385ABB, 0x47D377160274B85B, 0xA5089564B98038A5, 
-0x629872142397E3B9, 0x16612F169, 0x1F1E2284E36ADC53, 0xFCD1EC5CBBF1826, 
-0x15D411CAB2B26814, 0xBDF064746C81A30E, 0x290638265E2D8496, 0x958D37B989EDAE82, 
-0x8FF1F02E67899C39, 0x1833C1A469FEE7FB, 0xCB21D3763F4F81A0, 0x1657593D, 
-0x522037E02C7643F8, 0x83805E74FAE73B3E, 0xDA37F72B6AE02257, 0xCA676D871D0838CC, 
-0xE1E4CBA147BE0AF2, 0x5077D903048A57E6, 0xEFB2F2248CA62580, 0x5B6BF4625CE3729E, 
-0x2EADD62AE8F446CE, 0x250DA8DB3, 
-0xE2B51D43C894A805, 0x83C2C7AD271AA35C, 0xB2A0F17C6BEC1128, 0x9574AABDBF691F4C, 
-0xE9F66528548C6F9A, 0xA55744029C5E5DA1, 0x8006F6B16A1AD068, 0x95947EBBAE875A77, 
-0x42EC3BC644E54771, 0x57F30C1D, 0x93A21131E8D43FC4, 0x82EB3C0A7A26F203, 
-0xACE7601056FA883D, 0xC935190D1F06A52C, 0xA671DBE3D71EC8EC, 0x2824E29526B9A612, 
-0xFA3EB5DEBC4E487, 0xBC6228BF7B63DB9D, 0xAFC94310781406D6, 0x26A1510EB, 
-0x769D3EFC67399170, 0x6696068938C1B468, 0xB12B1A98F4DDE1E4, 0xA235127ED95A476C, 
-0x2E845E2E6C730A2A, 0x17F27CD44AFE1109, 0x1593AD422CE4FEE9, 0x83720F5F6783E35E, 
-0x3474C33FD5C91B58, 0x18EE3C46, 
-0x93ED0E055DF70197, 0x8833A2D7E7A4A063, 0xD4F909643B247C3C, 0x44D1EE62D085E8D6, 
-0xC4DFC80EBD286C9, 0x28B72F13F2F69141, 0x84B5A9A0E23C9D58, 0x8C8F3DD06851BC7C, 
-0x6BEB3DF62921047D, 0xD048EECA, 0xA990B0F97CCB35F5, 0x4EED77B74933E127, 
-0xD40E960A44CCA313, 0x1402FB750F0E4995, 0xAFC5208F168D3BF6, 0x952DB9B9FCD85CF5, 
-0x646BC524FB87418C, 0x9694047FD93380BB, 0x7853674BB86C5426, 0xC8B0828B, 
-0x1988C0B185978E34, 0x665F8FB4FBEAB4B, 0x7D112C90ADAEDBB5, 0xF6229E5E57139331, 
-0xC929CF1FF6012CF2, 0xE7E75D4D26AB7CC3, 0xFC2A506DB8D40345, 0x7CEB4ACD7769998D, 
-0x18CA3116D4D71F5D, 0xA19346C5, 
-0x7A7FCDCE6ED9D63B, 0x1FFDB61C78BFBF8C, 0x7F9ECAF8CF60E0BC, 0xFA943434F5E1CC57, 
-0x11219BC796A2E336, 0x61D0B03EBF5118B8, 0x9083E608ACF3A434, 0x4835BD5B0B37C364, 
-0xE76354D6226C455, 0x1A278690C, 0x835C6130B7AB7088, 0x22FF6DA8AF79FC89, 
-0x581D34EC53BF3B56, 0xE69708A8CFD9B10C, 0x5231E3F5273BD0BF, 0x2A045A66B7B213C4, 
-0xB1348C87A9F867B0, 0x19BC711C46242D4A, 0x89FCEACDE4AA38B, 0x8C19B23C, 
-0x178437D8085D7047, 0x3F7A167C28ADE4A3, 0xBB483B16DE36E283, 0x1D564789BC7ABF93, 
-0xC52E2B07AD2EA780, 0x925C95EC8768090, 0xF8A6043D2D5A0CE2, 0xFFDFFBD6FDA27491, 
-0xFCFBFC376A46353B, 0x263765ECB, 
-0x2B9E3C2C8A84E802, 0x6A87BB492BD41648, 0xEF940E097B9D7EE6, 0xEB942C6A3B2E3400, 
-0xFAC43CAA96F2178A, 0xA7A00220D709AE3, 0x2B7ADB6D26AA8A5C, 0x3A3C5CDF1CF984C1, 
-0xE1C365C7A951306F, 0xA5B3C2A4, 0x893473D00975392E, 0xEDB551803A8C7455, 
-0xD2DBF9F1B202AB84, 0x191A02D53A262822, 0xB5FE93EFB94605A7, 0x2C9B939D97CC6ECC, 
-0x36EE266A13F02697, 0xB8B0539A8F17AE5E, 0xED006A047D5021DF, 0x11D946D51, 
-0xD43CCEB68A0B0740, 0x4A1287D1FBD8E2F3, 0x3CA1BC44697AEBF, 0x6E43F889F923B44E, 
-0xEF9096CBB919927, 0xE60A3F1031CE9D63, 0x109228DF7590DF7E, 0xD31979C5B17FF9F1, 
-0x889FB03DA7BD07A, 0x157C24538, 
-0xBFC6DEF28413E86A, 0xC4B21BD5FC11EFE1, 0x301CF4A219B14341, 0x96982E21EB16DC7D, 
-0xAC7F94EB2768B101, 0xA40C7B4996AD32FB, 0x6102F61B06349609, 0x413F9169BFA39D69, 
-0x564BB40326A76909, 0xEA83255B, 0x838DD0955FC869C5, 0xBD507C89574C0FB9, 
-0x2F699F0153DFB16D, 0x98783FDE542DD8C6, 0x4A2EA727AF765D93, 0x34456A80779B7D0D, 
-0xC5B8E40D2F1F1D2C, 0xFC696DAC7B2EF2A, 0xCA9347E7CA0CC12B, 0x14DEC4EE8, 
-0x8CC5E19C9C82F65F, 0xC1AA411FF2FAD627, 0x597B3CD5F80F2CC0, 0x8F6E6404D3136EF3, 
-0x4D2858430D8FD132, 0x6BE6DDAD9C9B2238, 0xB35AD1C519BA97F1, 0x1510A7FE7A39D318, 
-0xA44ED5817380F1, 0x649A1CD0, 
-0xE13538ADB0176FA, 0x325B160A9E508009, 0xADF4E43EB8089B93, 0xA29D0EC59E19120F, 
-0x5D77F717E3888B2D, 0x492B801575EE0F6, 0x8788B56C8253D6F7, 0xABB75648DB05309D, 
-0x7ACDD0E55CA9313C, 0x150192C3A, 0xB09ABE0005C3E639, 0xA6AEC8EAAE5D4565, 
-0x850C77946978F1A1, 0xE728387CCEB10A45, 0xFEC9810DB2B19947, 0x14DD0512390C54F5, 
-0x1B832984D6B82117, 0x863D426AC200E26D, 0xD849C54791961409, 0x3B7B7DBB, 
-0x38A23DBEDB54C162, 0xA6F7F03B988C5376, 0xD78F086DDEADF45A, 0xB2633D105F44DED3, 
-0xD9DFB3C29B89C6FD, 0xA4FF7A117B042629, 0xC949B447C9BFD962, 0x1879AAFCB24D040B, 
-0xE6F5BB58B9240140, 0x23802FF9C, 
-0x97899749A0F4DFCC, 0x4BDB79A099351068, 0xE9B6400CAAF70AA2, 0xE0281E8D809A67E7, 
-0x51AAD5A4C3D1E8A7, 0x2E1EBA28FE488652, 0x32890871B2AFE9AE, 0xF9980B9E1816DEBC, 
-0x4263C5FCF71AFF0C, 0x680CC7B3, 0xC8FB6CF38BD890F, 0x9C2F68736CC03CA0, 
-0x72F6D762AAB35430, 0x6F680C0EBF66FC94, 0x6482C8A7FB1E9433, 0x5E06921D713BAFF9, 
-0xBDA9480CEA4D6547, 0x792572F5B323AF05, 0xA296CBF2E4C318F9, 0x1DCC930AD, 
-0x9E1E9E0D713666E, 0xB4E7075A5302516B, 0xE94E93DD07EF758A, 0x3B7B71E0E176A31, 
-0x335D36D7BD6A0600, 0x9DF6D9FBFDF045F5, 0xBE33CE3FB9D23EC1, 0xFD2760EED0E0622B, 
-0x1B97FB3D08BB131D, 0x6D2A623, 
-0x52A6AC2151E0D4DE, 0x6BFF0F7F5CFB5B31, 0x721780973E163253, 0xE8A8ACA5FB15E3C9, 
-0xFB1B557E574AE911, 0x7CA01344A183E515, 0x80D9508C139CF57F, 0xBDB7E7E068C81F3A, 
-0xB18D94CDB5E6AFF0, 0x1A5968121, 0xC0AC89B5EF2D87E9, 0xF110B014448E5623, 
-0xBCD8816826A364D4, 0xDCFCB469E09E9866, 0x2FFC38A00A4BDA8B, 0xCD040A692BD03148, 
-0xF8AF1102C0435FB4, 0x78E60CFECF94EB9E, 0x6E9B9059092655A5, 0x1E04C354C, 
-0x9A77A7EA6324CF91, 0x40E0B14379E5D463, 0xC17734E3C5DF02D6, 0xA6FF8E7AE535AC79, 
-0x362D0842EF42FC9C, 0xAD34BD3B9F569BC7, 0xC950B8A16444FCE0, 0x9A2CCF3E7C0FA985, 
-0xD3DEFBE0CEFA1FFD, 0x1CCCB67B4, 
-0x33396ABFD1C67165, 0x7B1B0AAC74D953E4, 0x9B045E25BB0D5AE6, 0xADCA9A3C026B1350, 
-0x8D6B47EEC883DB73, 0x74E79A6709DA7B33, 0x8B60E9AB139C25CA, 0xEF8F47BA381C860B, 
-0x79AB8A201BB85008, 0x5BCBA066, 0xAC5D099E81A9FE23, 0x618053C7DB7B9CE9, 
-0xFEBC546231C69F54, 0x3BA5FA24E2CD4D9D, 0x61133D3E099121FF, 0xAD8BAF7A4B31DF42, 
-0x2B0AD66D79FDAA9F, 0x7B581E67E4BF179F, 0xDB187D4B27890B38, 0xDEF0A129, 
-0x1F0BAA62B5BA0E56, 0xB383F4C13A97F206, 0x7B4774126B67374C, 0xA7622B0849CF0B8E, 
-0x6D203A640576F4C4, 0xFF3AD9BAA32FD6EB, 0x7D66B8ED7B8C56F3, 0x7204BBA553E02881, 
-0x2DF997DC63BFC29B, 0x13A61CFB6, 
-0xE2EFD1B388F132F8, 0x4487A63EB7000A21, 0xB11EB8DBD99535AE, 0x99A82A5D678CD882, 
-0xD8D397D1F815387A, 0x26DCE639D76A5B2, 0xE5BCA6D325126EF7, 0xDD34474294B47645, 
-0xC527CB0601E45F39, 0x209F457DA, 0x4A9BFE0CE60D4537, 0x81D407A6EEAC2330, 
-0x55138888B6A089FB, 0xC2F6F878F448A3D4, 0xDF3CB23DE1F63E90, 0xAEA95C1F21383FA, 
-0x84DD0567C9D11366, 0x4AE33E0BC3C4844, 0x4836454508ED0383, 0x1C31F591, 
-0x51BC436B0524C08D, 0x267C481A806D26B9, 0x51529EEA68CDB2BC, 0xCD73D2AFB5E10160, 
-0x5DAAF6E62981D365, 0x3AAD43B7A07BC959, 0x57A06B58E147694A, 0xCFAA171D03651603, 
-0x674302F5CC710B13, 0xBBE847D8, 
-0x15750477272531FC, 0x4D193FEF1AEF3CB6, 0x28BED5C0F0CF29A7, 0x9CA6205363C22BF8, 
-0xE16997AE1CF6805F, 0x483D2EFBFA60CDDE, 0x863E4E6083453395, 0x97841BA6A9C5D337, 
-0x18A4437692AEA84D, 0x24E788CD6, 0xCD4DDEC0021F8655, 0x241DC66482A5B93, 
-0xAE6835B804EF75E4, 0x3B598690A08B90A8, 0x5C572B5A3C3FE73A, 0x4281A4753787D5C1, 
-0x28D163ADA9EA91BA, 0x8B90EC00B9FE7C82, 0x3BA9E527C792E261, 0x237EF3DE7, 
-0x738204E35DA2652F, 0x99AA6BC83577F3BA, 0x7875E3FE142EB722, 0xC467F2548ACA099C, 
-0xF35804934B23885A, 0xE9FDE8E33C716849, 0x171845413FC67D71, 0xC15BA8ADEE4907AD, 
-0x86411EF960049E07, 0x161C96050, 
-0x91EAF89C7C8A86C0, 0xEC35E0742DE3227E, 0x6388FE613697C4C1, 0x862B66263466B314, 
-0xBE7DAF296214FB61, 0xAE007B3FFAEA15F0, 0x5FB5D861D9B211CA, 0x1AC35477786E5D19, 
-0xE43B1B29151F8BFA, 0x12A4E11BF, 0x56A1D7295AEFC08A, 0xFC76E221D69F385B, 
-0x631CAE958C65DED3, 0x635275564AED1317, 0xDC63713FBE95890D, 0xC5FA1D0943F39884, 
-0xB19D119A1B8FF62C, 0xC0A75BFA738E262E, 0xF51C03ADB1373ADE, 0x31E44123, 
-0x6EDB714CBCF389A6, 0xC3CC0C8003C40C6D, 0x2A2F38051B7F6EB7, 0x95B3855116B4E0AF, 
-0x82A778F1737A311F, 0xCC57DEC6F484E825, 0xFF22D4947883FD70, 0xA558B19DE84C8793, 
-0x988AF49A94AA3560, 0x18589814A, 
-0x790E8BE226F35487, 0xE09AE53668B1821E, 0x3CDEB43A14C39EF, 0xCBF2E20561B74D95, 
-0xF88177882386D84E, 0xAC6D28DDFA91381C, 0x60A05683BCABAA11, 0x611CDED57C3943A5, 
-0x8B4E4AB107C8FD32, 0x62159002, 0x9DABC66B03C44B17, 0xFD3EAF24DCDCE78F, 
-0xCA54F5547284E14D, 0x20B3989A7C30CE4F, 0x4919D472C3B6F396, 0x5BC8522E94D76942, 
-0x766817078E0F6EC3, 0xA85A502B810B658D, 0x7646BAA6371E73D, 0x230FECB77, 
-0x972B6F0EACA23396, 0xD65F486E435D3DB, 0x89E5B046BBE042EC, 0x826D6D803CC8C5FB, 
-0xD17F0CDA2358F23F, 0x19DAC86A829F2F6A, 0xD6ACC3C45BF20DCB, 0xDE09C3FB57E111F9, 
-0xE457DBAD02F76095, 0x824F528E, 
-0xD1F02386CA7E58F9, 0x9E7A144FFE08C7DA, 0x92366FE7D7A9BC73, 0x67663249CACBB91C, 
-0x115594152C6C0170, 0xE9B84C85637AB155, 0x455AB17EDAF3366B, 0x3F94AD1691D6A19B, 
-0xC7158CFA2582D514, 0x195763312, 0xA06135C1986E8269, 0xB60944997B8CADF6, 
-0x71FADC7EE9E612E4, 0x380CAD021B9B5297, 0x2F4D89E386EF5B68, 0xB4E911FFD409324C, 
-0xA1CAFB1B6DA04C94, 0xE1DAFD375FDD793, 0x69619A2350D63993, 0xD1F568FC, 
-0x26FAFAC457E68D97, 0x93F7DE04E94279BD, 0x1D7F8170BC610263, 0x13ECBC7B86C3C4DD, 
-0x61E7E559284E725B, 0xED2BA50DCD20FCD9, 0xDCA352B521E1427C, 0xD52F111CE6D09216, 
-0x1B2ED182875A132D, 0x21D7DB32C, 
-0xF9550CD0FA0FE3BF, 0x19FCFB5AC4023B07, 0x49824A8F3B70CA2A, 0xE4CF5BAB9F0DE70E, 
-0x78E4237E3880A461, 0x82B129471DD35EFE, 0x8B16D8FC9A7546D0, 0x2CB5AFE18F40F9D3, 
-0xBA2466C610245427, 0x157DD56D8, 0xB76F115C5D5BD376, 0xA39027173AA35587, 
-0xD737EA8575B88D07, 0xA17316B0B9AF123E, 0x809864D9AABF8E87, 0x6B2A6D9C454619D1, 
-0x6ABF6CFAAD31D001, 0xCC3AF19B4700AE5A, 0xF1C692DDA89CDE3F, 0x1DBBD3EEF, 
-0xC87B30AE9F05CB4E, 0xECBD14DB92ED1493, 0xC07EC2DC89CD47C2, 0xACCDFC831AA14E73, 
-0xD9433D47376368FC, 0x4AB7ED1252A74518, 0x1D87B47B019B97B8, 0xBC83B853DC1C2A5D, 
-0x5B22D892097DE6B8, 0xFBACD320, 
-0xF51250C7DD19364C, 0x55CE7B230F6DEB13, 0x24D68F8A802F43C2, 0x61A44874D6F13171, 
-0xE5A36A7E54C9B3F6, 0xA7DBAF518CE86D97, 0xAFFF607932D2A550, 0x352E39419DDDC849, 
-0xEEED62AD797F53F4, 0x17DF73834, 0x2997087B8ACFF31F, 0x30B0730BF40ED99E, 
-0xF04AE71B1513A437, 0xB378E8648BE614E, 0x4DABEB3DFD98FD56, 0x3FA30D8C51E20E3C, 
-0xC706EE5196A0D4FC, 0x3A7FA68AB111C906, 0x97C105B5150582CD, 0xF843797, 
-0x6F9372072A694285, 0xB7E2B6F970A537C2, 0x2B1FDEAEBD206A86, 0x4BE83E552CEB7D23, 
-0x769E2545EED948C9, 0x40DF6BEDFC06F7CC, 0x493CD99AEE509932, 0xAF47DB0D78AEEE45, 
-0xAE323310C4BE341D, 0x19046A7CE, 
-0x96002C80332C9ECE, 0x1BA13A1FC6E18B34, 0x8BFA4C3CB41B9E8B, 0x1B4EF546C4238D88, 
-0x9402D123E08E36BB, 0xBF642A45B6E0EFB0, 0x70BFD84ACB9F48D, 0x7749E62D024DBF61, 
-0xB006BE74649FFD9B, 0x193DE5370, 0xA65689C2F8062907, 0x222C997BC2BA6F20, 
-0xDD2A663AB78147E3, 0xE96A6F1ABD205672, 0xDB5A1832B8FF69F5, 0x110A8A030DF56325, 
-0xF188E611B4B67062, 0xBA96D5470181D162, 0x542D27A986013918, 0x4793912E, 
-0xD8839CA3F78FBC5C, 0x2247241C395841E0, 0xDA39371C2E89D13E, 0x9BED8DAC093C152A, 
-0xC7B48C8BCF7BD851, 0x2AA0C5087EB4545A, 0x1369CCD5751A649C, 0x29724110FA8B59BA, 
-0x502ED0692A5FFB76, 0x26198E6B8, 
-0xB96ED6875F99E7BC, 0x83FF4C878E74AC24, 0x7532D455E653620, 0xDF4D45AFFE29F83E, 
-0xF2B7258CC296361D, 0xCF8327E0CDEB04F4, 0x92A69DD3769F988, 0xCC5E61F642F0FA7B, 
-0x40C08D2296CEA0B7, 0x72D5BCFC, 0x88E22C1F262FFF7D, 0x4DB3115BFD4F5859, 
-0xBB93E8CB742C8A70, 0x1B010A2E7B5893F0, 0xB113714365FE0483, 0xCF875ACEA67847C6, 
-0x62ADACF7D834DC39, 0x6AFB1364EFE12D2A, 0x6415837CC39DEFF4, 0x279EAC22C, 
-0x4C0DFCD473F0CE35, 0xCA4D0E2AD172D4E6, 0x55D2630E00CCB644, 0x643755B341EAC29C, 
-0x149368B9E6D5B536, 0x27F6E1049EFC3653, 0x74CA99987FC0E463, 0x16AB76AEF946898F, 
-0x89C7D5D0F4BFCEB8, 0x22FB931C0, 
-0x5256BCCADF82EA34, 0x41B8D45F402D5059, 0x5372754EE49AAFB7, 0x4F19A3CD8E264AA8, 
-0x6A67688BB60AC2DD, 0xB7B13574D5AD47F1, 0x2110315AE74E3019, 0x8BCED3460939F2B6, 
-0x1D473FF259B8B802, 0x23FC3E373, 0x5329C6C7DCB6DAF1, 0x71067C896F9C815A, 
-0xBF4E847F037F6D4, 0x6F5D1CF638459101, 0x1702C93BDE96AA79, 0x7B36EC7D4F24204D, 
-0x1AB0A240DD9F73D, 0x96D72B44D2238AB8, 0xCDFABC9558BC8B39, 0x12464C3BF, 
-0xD622C5C4FA55D98C, 0xADC96B3176B80EE8, 0xC45086C3C4ADB0F7, 0xDCCF917E4471C863, 
-0xE2A2304FECC46D9A, 0x536F92A6EE9C9EEB, 0x6085EACEA2BA4C01, 0xF2ECB320D7D183CC, 
-0x769812A22771996A, 0x1CEAEE6E7, 
-0xE36735EC9FFD4CDF, 0xA6318340C137F7C, 0x32DDD0A7FEFA0EFA, 0x8FFF02C03F11DAE9, 
-0x1FA6EEC013AB7DB7, 0xA42F002CDDDD5F91, 0x8B105763550593AA, 0xF2EF0471CB2AA23B, 
-0x1CDCB832F3CA1B8E, 0x12BDE63B3, 0x8B7DEE7126130871, 0x8B88482EAE8EE926, 
-0x53F04590C5425FFF, 0xF8936177235D649F, 0xC08B5ECCAC0CDF6C, 0xDA6BDC80D146A478, 
-0x6D1AB540258119BC, 0x61EC389E33586561, 0xBB8AC998C8196EE5, 0x1357C16F2, 
-0xC100AC64C0D1F4C7, 0xF7EBCD5A8C1FF86B, 0x66B73FA1389DD557, 0x3C7C3EB9AF4C14E3, 
-0xFEBA4DACF8197433, 0x9CDD62D0F81A0FAD, 0x49D157FC392DBA0B, 0xCE0BC5103E5B8C2, 
-0xDFD276CBED233960, 0x9465B6B9, 
-0xE185126503479DD5, 0x865FAF7770A3C3AC, 0x44335900B29935E3, 0xDFAC7B703C87E00E, 
-0x89379969255CCA3C, 0x7BB78CE7721EC6AE, 0x5057FD4BB534D581, 0x52673729FFA9E8FB, 
-0x2CE3C05EF9B67CDA, 0x23E06D9EF, 0x9C8148FA67A2F6EE, 0xD08C2FC7AF76C666, 
-0x7F4B8DA8C2620EBB, 0xD2F46399E223F08F, 0x697C4AE1B07A1326, 0x444B229FEE7A9172, 
-0x428160BEBA4C5EB7, 0x1F3E726E594945CB, 0xF47EA30283612E86, 0x11A3AB956, 
-0xC2C16CBAA34AB090, 0xFCC352A16B82C9CD, 0x8B4DDD40392E4641, 0x11DC4AB260C36AC6, 
-0x8F57737556E59D2A, 0x501E97F2C08D445A, 0xB4A4DEEC6BB36824, 0x496C8814C9B2C638, 
-0x466B2528861294FC, 0xCD9587D1, 
-0x29FADF174C944585, 0x66C5A64D201341DC, 0x7DDDE25A606A4F43, 0x75D76737D7153B9, 
-0x136F3B5329B9311C, 0x6642FC280013C610, 0xF104006CC8A62998, 0x315671A9DF05A0CD, 
-0x13E2ACD3D37D958A, 0xCE8F5843, 0x4460AE2846EB7F5B, 0xCC83F525CA107555, 
-0x75B4BE86586DB68A, 0x7EF736D70E3E7B80, 0x82E1AE8C0E4C57B4, 0x589B1C9DA28168CD, 
-0x96EB49BAD7E11761, 0x1E13E9D47B6AD6EF, 0xF7546374D5B312D6, 0x23994B83F, 
-0x1BDD0C3EDB4F8C6B, 0x6090F422C5F518CF, 0x759A88EEC4DB5E49, 0xBDB6265A73E790D4, 
-0x7C2DC6F1898FF0DD, 0x9389B611376CD7B9, 0x86490C58720FABC9, 0x7C6F76D4F0004964, 
-0xE16553B44B844B5B, 0x22E0965E3, 
-0xA8D8E0F3E097F444, 0x52CFC561AD0CC649, 0x25F90F7DD92D6358, 0x38D540E1850A9CB4, 
-0xF15031D08919900C, 0x7F65843F23F5CE13, 0xD4E1F39712612E06, 0xB636310E2231C4A8, 
-0xE3784F837C0D8524, 0x1469ED469, 0xAB39BA4AABE82C69, 0xAB712BA3A33B0BC5, 
-0x8909DAA0F66EA5CC, 0xC362A9B12EEDF92, 0x486052EB44777DE0, 0x917B7A58CDC65C94, 
-0x367345AE23AF9538, 0xEEA07AAA500BD330, 0x5A8C5F155C1B073A, 0x1715B596B, 
-0x9DB7D19420CD0570, 0xE224FF0FBE270293, 0x6ED93F43B2E232F7, 0xFB23CD3B82913196, 
-0xED4C14A46435A20, 0xFB58AA86936EBE67, 0xB3EB5CC352B69407, 0x9100E2856F015C0F, 
-0xF648EA43570B9486, 0x20310E6C3, 
-0xEEFA1E66404A0BE3, 0x4374C345FFDA8C8B, 0x62FA3B244DE1ECE1, 0x9A01F5604153E2C6, 
-0xF5B9ED911FF8D7D0, 0xF965D66AA58C0ED8, 0x2A61C611BAA5CFED, 0x6DBA67E08F7E4104, 
-0xE4756F3C83E7B06B, 0x4AF79C6, 0xA9EF563B9EAA4954, 0x26F31294DFEAD430, 
-0x7BEB225208DF4D71, 0xD1CA1CAC39393B8F, 0x3E8FE7DD00E06A60, 0x3FAEB637369A6B5D, 
-0x4F8E3C9F4B1945C9, 0x80B12C82D10FD6C0, 0xFA06F2E6792ED574, 0x208C59A6D, 
-0x306E30A791613F49, 0x3E869A399173E223, 0x2FB6354BF2718495, 0x131740C8195898C6, 
-0x104C178FD1BD13D7, 0xDFD07F5E4EE3D17F, 0xBADA4A01D90A3558, 0x346465575CE9FD3A, 
-0x3CB1EF3FD7A24E5C, 0x35EC460C, 
-0xC840316DDF2F1AA5, 0xE8C7688A5E064538, 0x49FA91233CB949F4, 0x892C8544A917226E, 
-0xD7AE5521D7C71EBA, 0xEB90F6E398F3EC50, 0xA1B9DD237C05B968, 0xD45415D2D28081EF, 
-0xD7130BEC1B89D72E, 0x1A59A3B1A, 0xFF5381177339AEB1, 0xD94A1DF8D79D9E, 
-0x78F00085F995E492, 0xA2FA05D933D23BEA, 0x3FE46F29B04452EC, 0xCB138E646DB79F9D, 
-0x3A8E56ECC12B4CED, 0xD3AB10937D3C4F7D, 0x8A875B8CC479922D, 0x20B04BD5B, 
-0xBE99512CF5EA36CF, 0xCEA41CBB15E30BBB, 0xCF8CD8CCAFE207E6, 0xE47104E6ED2AD9A, 
-0xCEFAFE7DDDCBA3ED, 0x19B1B6D47A45D055, 0x31EC6B1E2DB8C29C, 0x2E62C4C21C39F656, 
-0xAD00A00D957FE1EC, 0xF7C23FF4, 
-0x6FE851DF8EB17E6A, 0x13B4E1B9EB7F858B, 0x1F9376EC6284D7A0, 0x5C6583261B794D07, 
-0xA0790170F6BED14, 0xAFA1ACF049B38FF3, 0xA06B3C9E55509718, 0xDE6BC7ED72B0AF3B, 
-0x5315E03B00E95B27, 0x100EE57E7, 0x3BDEC94815F26F23, 0x299B0F70E5406EE4, 
-0xB5A2F100567E49A1, 0xB3F5A06AEF2DAD, 0x77EF63FD801A046D, 0xDF5542E72038BFD0, 
-0xECD943FD579EB11D, 0xF0174B9FEE12F6C5, 0x7DF17DE1E43F26BF, 0x16AE7F90B, 
-0xC2821D196B7623A0, 0x39E21512A84EC01, 0x5129944CA0F1F3BD, 0x98979488A018475D, 
-0x6A19A1D65FB98BA9, 0xD046B53A76AAB27E, 0x4A28785F55AD94C6, 0xD02B0CB1D38C1EDE, 
-0x54098AE3592C98E8, 0x192180B6C, 
-0xF109FA8BD1FAF6C7, 0xB5122E99F751A36D, 0x50CB64709A59C710, 0x9853E24772980799, 
-0x31A509B2E2849F21, 0x7408ED7998125284, 0x6E73B08D1AF32D33, 0xC3E214ADC4B01B8D, 
-0x542B5183A183775E, 0xDF710240, 0x7780CD909A542CF5, 0xB500F0F0012AC04B, 
-0x96D0B40652DB1EC3, 0xE72C4550678D598E, 0x91140617DC79D921, 0x70A6CD63E0F671BB, 
-0x2E3819529C69CCBD, 0x7EA4B526CF6690A5, 0xA599DC16000B6DBF, 0x1597A4DA9, 
-0xB923D62FA81E2FA5, 0xA789B93E05670EA, 0x62536463D1B2B142, 0x32039AD58AAC6AC2, 
-0xD36D402BBED167C9, 0x7CC8E9DA84AE8ABA, 0xDD22DF909685C503, 0xD4B0B1F679F5CF8E, 
-0xDCA26B6AFC323987, 0x102AA364B, 
-0x7AECC882ECF0E5D0, 0xD1CEC6621F240688, 0xF455848D4E13EA26, 0xB56A52479998E2AD, 
-0xF5AA7D005678D89C, 0x17C85D3D0EB0F9C4, 0xE2232690698BA9C3, 0x61266200F8A4DFED, 
-0xAF0E337C28A60617, 0x77A99767, 0xD85FC7932900B6D, 0xE1EDD21F2ABC0214, 
-0xACA3A473973E257F, 0xBDDEEF54C4E30ECE, 0xBD619E93B866AD5D, 0x6F9282A187A1DF9E, 
-0x50FC3C1B66A71A28, 0x4EC9B1AA0C03BE03, 0x7383398CFDE08E3F, 0x1C971189E, 
-0xD97126E8BACADA8E, 0xB4A656CA7A90E9AF, 0x76F0A46814BB7A7D, 0xECD609E1A9A4C0EF, 
-0xA33ADF4CDC85271C, 0xD565E22C8A65B176, 0x729A148E01D58F44, 0xF11AD300808B0942, 
-0x12D3573AC086F8CF, 0x185FCAC28, 
-0xF7B04EFB9937C026, 0xD1128E5F3FED0AF7, 0x5E0CE2BA26F871F0, 0xD139E37A7CE785F5, 
-0xC9BEA6599774C2CA, 0x78291F7034D70BCA, 0x846B04B690E34540, 0xDE99A2FA0A747486, 
-0x6F93E503C7678285, 0xB30642C7, 0x4FAF6528C193D152, 0xAF6C5FC6566A5080, 
-0xF98736ED970440BC, 0x8FB4F795597C7441, 0x4233E099087217ED, 0x534B7C4DC1997E51, 
-0x8F022CA0A1E64EC5, 0x7750B852E42E8417, 0xA6FE586218C92091, 0x1840C0732, 
-0xFBCB387BEE2777C6, 0x72F151B77D2D1854, 0xF17E1716A4660D77, 0xC6037CB423A4EB2, 
-0x8DED0400183FCB9F, 0xE15C733380212139, 0x86ECC8328BC1ABD6, 0x8C2F6F3BC86CF28B, 
-0x6014EF339F389E37, 0x1DDF8686F, 
-0xA95370260C390020, 0xA6FD29D04CEC6D87, 0x240AED21F0EBF971, 0xBF311B1F10AD195, 
-0x42F356B9ED6DAC1E, 0x854357F82061B602, 0x10C4A12547F9D236, 0x98513D90C64347CE, 
-0x3D66A5C94E6940D7, 0x2709070A8, 0x8BF98960823758EE, 0xA4734E06C3302367, 
-0xB418A1180AEFA0DB, 0x60B93945FAA6E7C6, 0x8B969AA934DEF48, 0xE28FD066D277D2D8, 
-0xACD6173E430A5172, 0x79FDDD26E4C7B2C4, 0xED68D96324A9ED01, 0x2F7FBE7, 
-0x5FCEE40E9ECD5FA8, 0x9B2F415A6DA02869, 0x590A6465A974F1D3, 0xE40F2131DC0D433B, 
-0xA0ED50BEF72961D, 0xAAD565A413F7257E, 0x53B4F36BD334BF31, 0xD579548A9707FF61, 
-0x7D295156F9FB8ED2, 0x1DE2541C9, 
-0x9B603E9407FBC98, 0xA8F25C14035D4A16, 0x48D1F546ED03006F, 0x55E082D87632104B, 
-0xE6BBBBC8EF5B20FF, 0x559443C566599CE6, 0xD880602D788364D6, 0xCAFB1FED0519507E, 
-0x7271325AB1C48304, 0x139354DD8, 0xB422EE4B4CA2172B, 0xFF4BBD5C3C469505, 
-0x3B5BE668B3513A66, 0x2FBC1A96DCED964E, 0x2FA69AB457C68377, 0x51464E93DF50BD73, 
-0xDF0A5407B147F7BE, 0xC8FDA1BAB93D0794, 0xB30F2941402E05A0, 0x2182B6130, 
-0x6969310788F6EB90, 0x6CF2E673DED5601C, 0x5FE46B9C6BDCF025, 0x73B3CEA3914151B8, 
-0x229AB91F83A52A4F, 0x6A10A5CC9EA4599, 0xF11052D58C791795, 0x15049F721FC0D33B, 
-0xF45040C00F289EB3, 0x1FDBFD71D, 
-0x481FF49D41A434CD, 0xC2C56B6CBB1F043C, 0xA2F1B7FFE4F36C2A, 0x54EF722AB4CDFE5C, 
-0xF08792224F41B208, 0xB2AAA25FB49FC28F, 0x71F245699A28D14, 0xD6DC61CEB7873328, 
-0x8CCB98E94B889A62, 0x1C90A596A, 0x67A903400BDFF235, 0x1FBC62423E0E9FC0, 
-0x1C31B470ADEC5F5D, 0x6DF9515D1271BD8C, 0x96C7259D7D9CB91A, 0xCDE9622F40618784, 
-0x8E285F18163B0BFD, 0xE70A226B965D3960, 0x9C4A1AE8802EA12E, 0x19EA549F5, 
-0xD491E4FE35A0EAE8, 0x4103769B94F39BB1, 0xEDB9ED64F133F454, 0xFC8F64B461991B55, 
-0x6D81F1DBCDDF24AC, 0x38050EC765FF94F0, 0xBD5A10B444B5C359, 0xDAFFD75CD3BC9810, 
-0xA6ACFF71A5BEE48, 0x1744DB276, 
-0xD4388E7D7E7E0150, 0x918685DCB2CCB470, 0xADAF3946DE3AB538, 0xACFFC5398781D01, 
-0x7E166E10B3B26EA4, 0x3F9A77BD15DEAE57, 0xC988FD340556C9A5, 0xC1CB5DF1EBDE584E, 
-0x37E28D81FFE8218, 0x1363CD323, 0xA768B2F8ED8EDDA6, 0x84E292174F4F6D6C, 
-0xE266678FF1AFD4AD, 0xD2A33128646D28E9, 0xCA83608113EFC522, 0x94CB044C01921367, 
-0xA69723BD750E8001, 0xBD68323D76AE81AF, 0x99BC735FFC75214B, 0x25A084AC6, 
-0xC314E6AADB64A8BF, 0xE5971010DF7F88FC, 0x7668C336C3EE985E, 0x780B4F28F2D9F22C, 
-0x19B0A61B321A51CB, 0xC302E601D5C7C21B, 0xD856A1AE12CE01A5, 0xA123002E7B9E59A2, 
-0x3B02CEFD8459D21B, 0x234820E42, 
-0x6657ACB159DC4336, 0xB635E277C5774E5B, 0x9B22957E63915584, 0x4AD059229349B122, 
-0x16D4D0790B435B5D, 0xB8B27B648D2C0D9C, 0x7C00C79D524343D5, 0x8B05DBE070EAE46A, 
-0x220537D485C42BA7, 0xDD939157, 0xEAD784DFEFD94CE, 0x1BA3F79B854CA45B, 
-0x3E3A4AA2E1169464, 0xFDF594645DDD46D0, 0xCB4529D51AC85ED1, 0x1FDD9C852355B900, 
-0x2D9CEE2F0672CB89, 0xE5BDF9C1376802B9, 0x335BAA6422A0CA1, 0x70E65014, 
-0xAB930CDB5AB319FB, 0x42CE9883F08BE34B, 0x9AA8FED1FA108FA2, 0x5C750D054ED8FABD, 
-0xBB1B07DC57DF96C2, 0xC8745EBA504BEBC4, 0xA1652B093063D672, 0x6018ED7E55BAFAA2, 
-0x352F0CCEAFFEF882, 0xF8CE858B, 
-0xB984296EF2490651, 0x471F27E57A3544EA, 0x406B0198CD47EEDD, 0x124B64A213CF1B78, 
-0x1A731BC5360E7741, 0xB510D5A86E3269E2, 0x8CA98D70C6B1FDFA, 0xAAEE55EC6A475195, 
-0x207037F4E3F7B2A7, 0x7D899447, 0x54217DFEC7372498, 0x91ABE69D7C548A3E, 
-0x193DD07C975F3044, 0xF0C843EA68EA004D, 0x201929EABC591D78, 0x482249799DD5FEC7, 
-0xC4895D970616FA32, 0x82A4582DD087AEFB, 0x29117F6531A5D9DA, 0x20ACBB493, 
-0xB7BAA57BBB5DA085, 0xB95CC4CE38D8D52E, 0x7356DD56AB2CFFCA, 0x9AB7995B8FACF1F9, 
-0xD69D59DFF6CB3CAF, 0x3C0D7276C62119F9, 0xD15214F2948A2863, 0x52A233D9CB7005AF, 
-0x3AC05D35E1BD05A2, 0x1A737CED7, 
-0x344F509A008A821, 0x4DB2466355612E71, 0xA3887B5EFE979F03, 0xC621FA4A5C846E4, 
-0x1C04AEB698946646, 0xB50C3D53FA05831, 0x96215F9EB575DF3, 0xA33ED90249E6A4A9, 
-0x2CC9C6E4056D420F, 0x181663FC0, 0x91ADD4784B3D4FFB, 0xD6B459B42ED072DB, 
-0xDDF89D13BCEBC7D, 0x3DCA16F84490FFCB, 0x258F23C994076A90, 0x88E8F18F082D5526, 
-0xB413DA6759F9041D, 0x2695E2CAB6DFEF00, 0x4FF709C496C95EE2, 0x2D0BF4DC, 
-0xAD9AD648BF45642F, 0x90E65CB4E0C77678, 0x275DCFD8B3F7429, 0x91A43C0B79F550CD, 
-0xE454CD8F75283BC6, 0xAF87833E670DC6AA, 0x57FE1211B64715CD, 0xA84F3A62CBB30F47, 
-0x33CB3B9A26131CD0, 0x21E0AEBD3, 
-0x5EA05C20A492C691, 0x38F8F6CCC6F8B541, 0x2FE56B5931A0C6F1, 0x96128A966BAD3CAA, 
-0x21FE0398A0297279, 0x815AA270023E0C25, 0x7E0D6703F2F958B8, 0xBD84E3ACBE653F82, 
-0x79B66B9210F9ED15, 0x16BECBDD8, 0xADE94821B7F09F56, 0x6FDC91D5921E818C, 
-0x73DCE9C643364089, 0x217ED8C120C8ACDA, 0xC0F64E29286BC380, 0x2741DE1FEE05363A, 
-0xE5C4A4E3F286D9E2, 0x8CA3D9240EEC1205, 0x295DC1838C4A8B45, 0x270C61A84, 
-0xC2E38BBE7A8869D4, 0x4E7C3B13BFC4F850, 0x9DAD54B9C65CC4A7, 0x1F3402CB955DCB95, 
-0xE604651F23DD5F68, 0xE80F8070FC4AEA98, 0x735F2C5C11008DC7, 0x2626AF349DCE5B80, 
-0x5314CB1690FA7293, 0x12DE06CAC, 
-0x27E9CDF72C507E15, 0x3EBF6EA50D1A9F4B, 0xE7DCF27C3DFED1DC, 0x5D6574C21A108C7F, 
-0x394F5D55BEFABCCB, 0xA230E4EB2FE79385, 0x8D344F24E585109C, 0x54FA1CECBBEDE429, 
-0x90B810DDCDC82BEA, 0xCC1C5226, 0x645BA26959D94567, 0x41A07151F49335ED, 
-0x2039169B31991935, 0xDB7EDC51268A82CE, 0xF7793FB16F9012F8, 0x89F1771068419E36, 
-0x272EDDDC09D011F3, 0x33A29F0BA86C1688, 0x1048F9DF263AEB84, 0x103B4FF24, 
-0xAF70A88788937726, 0xBFC68E618B2E0AD4, 0xB3152B2EE5D7B5D2, 0x70273059BB3F4597, 
-0xB81702842D4EB8AE, 0xDA5E8E5CFA152E63, 0x29108DFF7F03DB01, 0xB10DD63F9631BEE4, 
-0xD0B980E87E095ABF, 0xC6D9E1A, 
-0x5C39DB577CD8E25A, 0xB053D601E92C7816, 0xD0C90B16E3F57AD6, 0x6043C33FDC100699, 
-0xCB3419F6FFA2F89E, 0xB0D048CD52696A1D, 0x9C38777691B42D62, 0x9A6F7D14E3F4B0C3, 
-0x9C970976ACA9DE31, 0x13F4E61B7, 0x1A43C2339D92677A, 0xD229B59DCF03A062, 
-0xC799383CFA62152B, 0x561AD6F326EA4528, 0x7F792303A3FD1BE1, 0x5B7DE432C7F902FE, 
-0xADD84DA223EDDE96, 0xB59D31A1C26558B9, 0x3865824325C7412E, 0x1BE14C227, 
-0xCDA664197B41B01, 0xEDBB199E9398C305, 0x109E1935A3383CA6, 0x3E07B1F420E10A44, 
-0x341CC828FB7061D8, 0x70431D613624A852, 0x4E33CD6F195A5D81, 0xE7C14D8BF9DB482D, 
-0x17E53D9A30956C2, 0x13C07A315, 
-0x325585EBB06CE50F, 0xB33C756B795730AF, 0xB444E3A447416A16, 0xD6271B9A11AF3264, 
-0xD8E83A3FCDD3214A, 0xF37CF90C5653E72E, 0xA05DE5455E625AAE, 0x7915F2F21979ABDF, 
-0x2CBC50A1CF3881E2, 0x10C5D6A07, 0xFEA464A4716E6703, 0x1DBAABBCCC43CCF7, 
-0xC8DA0D9C0A945101, 0xA31ABA4143FB5AB0, 0xB3584F874AA01993, 0x737FCD2389EE58AA, 
-0x487FDA299789D165, 0x98C0F4DF5F293289, 0x47ACD571A92B1345, 0x1D25CC71A, 
-0xFCC5300DB55595D0, 0x32E63EEB4006A44, 0x78C0F983919C5026, 0xCFFBB2E9940D813, 
-0xF1147B481B95BA21, 0x4CD2B2F251660905, 0x3D1850249A03C966, 0x6AD54C14ECC3BDF2, 
-0xDF7EAA7FDD98F106, 0x1053AD3D6, 
-0x572BBB58875453A0, 0x2646FEE34CF69B91, 0x2080B00CBF542787, 0xB6062F612DB22589, 
-0x275BE404C6354655, 0x6CA77397EF3D14E1, 0xB77E472041DBED8, 0x6B23EAD82F53E5D7, 
-0xE1574106D326FD01, 0x26EADA064, 0xAF273391FE5B93C3, 0x8975B431655F5A8F, 
-0xCAC7E8217790CAFF, 0x6DEC9D4033B71A61, 0x65EE1DFA0E0ED2E4, 0x6E0D799E0DE4A15E, 
-0x3555E01585D52F19, 0x3A08F01B4361491E, 0xE6504A5F43310942, 0x27A21976D, 
-0x97C79E339ECD91B, 0x2F0AFE6B3A9856B8, 0x23E92B9418DBCC73, 0x5FBFF4D4485EF600, 
-0xE1C3A99B1D0E9207, 0xAC3DC580DDB55604, 0xF9160608E5C18E1C, 0x4063BA68F41F2D5F, 
-0xD81BC4F1F296364E, 0x142F1A009, 
-0xE4B0039CB8480392, 0xB0BFBC0EEFEAC205, 0x71E3E3D8F81BC335, 0xDDC78CE5513925A6, 
-0x88780589FEB5BB30, 0x297D91009B9C0BD9, 0xF28A0CE312791A99, 0x7180A7FA0DBE5FBA, 
-0xC0CAE4D5CF25C7A8, 0x14BC1D6D9, 0x95251DD4D6D6D81E, 0xABCBD08328581768, 
-0xA8D6217075110F32, 0x3F3089B88B89AA9D, 0x15904F0D36E5701C, 0xFCFA2974EA2CD2CA, 
-0x6BD1BB2C3A334022, 0xDF5DB0EE8B9284B7, 0x35E78452D203393E, 0x80432852, 
-0x7CF7B47541A34EB0, 0x7AB60119D283412A, 0x711CE5C2271BF98C, 0xF2B954C2BA7A425A, 
-0x2C7C14552DE25BD4, 0xC89613379358A32, 0xCC227AD4A516FD77, 0xA4FD5A2C76C415D8, 
-0xC7AF77834D6D7F5B, 0x11D1C1DA4, 
-0x3AB14D2CF4B310F4, 0xAE2DC828B3568515, 0x420AB7350BDB15DD, 0xBB128AE35AA69EB2, 
-0xC16312A7085219A1, 0xF3ED697E10CE8841, 0xC18837CAC9108208, 0x749C59D72357BB1D, 
-0x16BE27752AFC1B14, 0x26613BD76, 0x3FE5CBFD22396395, 0x39906F9244BDEB27, 
-0xB892D5406459EB76, 0x3995D4E861D3C0A2, 0x2AF7A5A6E93DE61C, 0xBA5C3777516D3E9B, 
-0xFA51824AE357B624, 0x60C102B4D29D3653, 0x9120A3F74C45ED1B, 0x1AC92310C, 
-0xA54ECBBE37F7AFE7, 0xD0E968A6978315FF, 0x1ED2DF526EF32A8F, 0x34E7D74AF7508FFC, 
-0x442F8CC3DB0D3413, 0x440553EFC01E0DB7, 0x65B5D8EB5908C71A, 0x48668C24A947C8C1, 
-0x711E9638EFE40EBC, 0x223E4006E, 
-0x2ABFEC6CDBADFB08, 0xABD9EB6F1CE1619B, 0xF2959E2F7D7D456F, 0xA5D11F4B26B4366A, 
-0xFE3D9B6B4F68A7D5, 0xEC051BCA85A97E24, 0x2AC3ECB797301692, 0xB826050F16BAB94F, 
-0x6489CC1F0224D7BC, 0x4F5044CF, 0x7DC98C9E49537C, 0x3449871E3AC72D70, 
-0x9916F282969B45A2, 0x999314C5A3E3BF3B, 0x1B83A42A3155E148, 0xF8F5DCB2032525A4, 
-0xC1F32ED8CC48E343, 0x55E9DB7849C00867, 0xC3B07D9402CB638, 0xFE8A1118, 
-0xB90AB43DA43BCB18, 0x8EF3280BF7C2C700, 0xB1E8144F25B1610B, 0x594CFDAE31A8E6E8, 
-0x8602B8333504A63A, 0x792CC5F0BD46E8DA, 0xA84718145AD30A28, 0x6160A5B432878B9E, 
-0x5BB32B0F2B52C494, 0x1FA186DD2, 
-0x2BE326272B782997, 0x638712B7BF460538, 0x3A6ED25A9B380901, 0x2D22F1F97A195A9A, 
-0xF215C31C36455792, 0x8F95DA1F2909991D, 0x4364E0E8AF9B5EA5, 0x65C593981E2F6F1C, 
-0x63F634F2F406277C, 0x2368D7CFB, 0xD417DB4C3011A1F3, 0xFA63AD4A307A41A4, 
-0x14BD2A7717396767, 0xB3ED973660A10947, 0x7F5BC5BD4B93974B, 0x16F4BABF8708FDE5, 
-0x96C484DF3A225DF1, 0xF6727BD7EEAA242B, 0xADB4B9D92E77C97C, 0x18E5C4C5C, 
-0xE048AB36BDA4A72A, 0x4CC98CE4FEA5A195, 0x25E18E72416A97FC, 0x82F7BD43CCF48278, 
-0x7DB9AB3EF153507D, 0xCCA06DC0909A1049, 0x18D3B51180ABB3E4, 0xE97E6B7E10EAB8FD, 
-0x51E731201BD36203, 0x17742AA5E, 
-0xE74D78159501A97D, 0x3B4ABE10A98723F9, 0xE4E5D5973DB1593C, 0x69A7064BED6436C3, 
-0x64A4DC44A9260E7B, 0x8A3CBA5F5697E8CE, 0xB0C4FC6A02A2E48C, 0xEF6C2603FC19B582, 
-0xD8E7C600F6ABEF6, 0x4B100F6D, 0x264A5FF9539B7B9B, 0x8E75D0907186314E, 
-0xA1FC150548490FE0, 0xC9E32CF4E422EFBB, 0xF9AF4B4E45EABAB8, 0x5D44FE4DFC069B31, 
-0x36EED61BB905F044, 0xBC56A486D1E5D941, 0xCDEEF305FB62F03C, 0x1113D713, 
-0x242D348DFC95DF41, 0x5736B9DCBB1A05B1, 0xDBC28227745CCE4F, 0xC67CB217052CC2A4, 
-0x72A497A3C74700BC, 0xD5B0D7EEE964C4D7, 0xD15A7D95EFB6DCB6, 0xE7AD3860F2B3B11C, 
-0xD138059AB71329, 0x12EA30A05, 
-0xB9AAA28FB97E8E8D, 0x6FB9C0ACDB608989, 0xBC73BC420D696C3A, 0xCB5B634E7B72AF02, 
-0x3D76D41E337B5BD1, 0xD61A6134273978C2, 0x546A385512A75B09, 0x26B87F363C92F2A1, 
-0xB31883862F9D020B, 0x1DFF69289, 0xE69A1EFFB1C40407, 0xA01951D316B3E6C6, 
-0xE4AE0AB8709E9C49, 0xC0575619E6A523D7, 0xD329748051DF2297, 0x2458AB08A42EE438, 
-0x5698872A50447186, 0x60647520CCF83E0E, 0x837A036B43E96922, 0x225C57139, 
-0x1A4E605A933D5059, 0x4E28EBF221DA2A89, 0xDD8C25DE47B8B59C, 0x7BD99F6BE812D567, 
-0x85E3F4660CF2E7B7, 0xE232615A14B34E4D, 0x6B88E649B171A7E6, 0x4BACC3DCC3B7FA02, 
-0x4277FF784E307D81, 0x1B484D3D7, 
-0xFCE99EE0C6F3BC0E, 0xD46D3F4913578ACD, 0xCE1207FA123EDEE1, 0x40A611F448BAFB1C, 
-0x9A3FC84439368ADF, 0x22B0DB85F64AB1F7, 0x423F6C7A6E0AF148, 0x6EDB40C2E977DE64, 
-0xBBE0D428AD8942CA, 0x2783408E8, 0x3E9DD55BEB43B90C, 0x59DEC7F062DCE6A3, 
-0x5B5BA596174AD2E3, 0xB81ACEC413677294, 0x175FE23AE2F49242, 0x6D6773E63BB8AB69, 
-0x2D1AB336CE0D08E6, 0x79474803B4D468A1, 0x10ABEA4534B818E2, 0xF2664FC4, 
-0xA45FEDDA23227835, 0x48CDD22293C70A6A, 0x976C92A9AA674071, 0xEE7AC22E3F6C4FC2, 
-0xF1680C9AB06A7A5F, 0x31D40DE3DE3A0B61, 0xC7DEA352C4CB5D33, 0x635959B95E78D190, 
-0x39DF17F414889354, 0xAC54579E, 
-0xB90F214D4D631150, 0x71C53F816C16845, 0x804DC156220335AF, 0xE4EA54AE47A953C2, 
-0x4ECD3F86ED9FFF84, 0xFAC8C3FEC746B547, 0x20E71C30615A3044, 0xBB41C9BDFA3EA9F, 
-0xACBD0B1CC9263EF7, 0x278C94F19, 0x92A2E01F4F6A70E, 0xD6632372E627A8A0, 
-0xCAA37A9E5A822D5F, 0x43526199EF0C335E, 0xEB5BBB0E38BC44C8, 0x485CCC5A45681E72, 
-0x20895A83EDBA073D, 0x4FBD984D1B95D0C0, 0x3C77DF176165E06A, 0x136D3460F, 
-0x77B4FCE812497542, 0x65155A026E0E6B07, 0x184D1F93803A994F, 0x852B6AFE8C04F621, 
-0x461CB9447441A1B4, 0xC66631E4D57E53C9, 0xE155D8F52204A91, 0xCAB956AA03F6183A, 
-0xE78FE90BE4B132F7, 0x68BA5367, 
-0x2978EFFDB77AD745, 0x3CB8D8F77D0B5D53, 0x8BD1B6AEB7E09518, 0xAA6E36643B11658E, 
-0x77D0FF4BE65AA94, 0x729B8B045A604CA9, 0xD8129A566A2C3241, 0x94564FF0880D7E51, 
-0xA908AB103EB174AF, 0x1B9708D6A, 0x9AD86F4987681581, 0xAB093514C0545AD6, 
-0xAC95B3240A45AFA7, 0xDE3BC36C1885A5C4, 0xC71EAA81FF8AD301, 0xDF112FA9E9E0661, 
-0xE4EE0879C39081AE, 0xD59F7137B69B1B16, 0x5B2A30C8D471B44, 0x1AA658C9C, 
-0x478BDFBC261F4707, 0x1D32107F5B5D377, 0xB766ECDD6ED3EF29, 0x7C2AB4A66FDB84C, 
-0x76BEA4D4297993F4, 0x63FFF53964F8BC97, 0x991EF2F83B122233, 0x27FCE952D4E35673, 
-0x89B20EFC6B8B3E5B, 0x2DACB100, 
-0x7BDCA97B1819F4DD, 0x8176F1CB56FC5EF8, 0xABC521A8B24FAE8, 0x2767E7C180FD9146, 
-0xE24E5CE37A86A319, 0xD4ABC0A64825610A, 0xFFC68A68072FB6A8, 0xE2543A35CA77EAD6, 
-0xD0DB7AFC6C01009B, 0x177C91F01, 0xFAF7F11B20E79A5D, 0xC23647D971161432, 
-0x97BD5BC7FE43F79B, 0x6988DEEF1083E0A2, 0xE791F6565542414C, 0x921A3FB65E3CAFE5, 
-0x462866BDED4184B2, 0x25B221AA4B016AED, 0x6EDF49138702B4A7, 0x90921131, 
-0xDE88875E2B614491, 0x42B0E8C044668244, 0xE40ED430B8E10244, 0x55C6F75C1352543B, 
-0xD302E8BAB70FD137, 0x712E688178E83F7E, 0x63BF20D81FFFA2DF, 0x74C86989DEB26382, 
-0x1FDFE6A156B9AE89, 0x1907CF163, 
-0x673446D737077924, 0x9E7CABE786B70B5B, 0x2C7A72758F92B5FC, 0x44DB91C6CEE4414D, 
-0xFC0D96896F4854D6, 0xA3405CCBE453AC77, 0xC47ABC28D09EFDD3, 0x6B8D6A0558903498, 
-0x738F0D467219555A, 0x2762A443C, 0xEE4EC1CE43152D5A, 0xCCFEBFBDFC480CF7, 
-0xF3EBDC1FDE20A3CF, 0x920A57C9CDBEC751, 0xA69FF647CFCA7679, 0x6EFD66557F75405C, 
-0xFA965CD23FDF8E61, 0x69059D54855527D3, 0xFAAB524610E01E2F, 0xB3A27C84, 
-0xE3C0AD3CCD0A7411, 0xEC3902220B895A5F, 0x916663400FF30140, 0x933EE248E8B7B557, 
-0xAE78E2139265001C, 0x7E9F973B7BB0E408, 0x89BA8F3B12DD6A0D, 0xA12E3C8A750CA323, 
-0x2D5F6179540D8BCC, 0x1DD2F7CEB, 
-0x4450E34F06CBA34B, 0xC38806FB7B9A9D4E, 0xACF870ECCF075A50, 0xCCCFE2A7440FBB40, 
-0x97852CC2C700AF19, 0x869A6BC54E1D1A9C, 0x46ED9E056110F0E6, 0x9E08D0CAC13A4CE1, 
-0xCCD65045F26B0EC6, 0x15562829F, 0x2FF010C963F57B25, 0xB8759B75CADE20DB, 
-0xFF773CBAD44B77A, 0x356200AD46666D9, 0xAF155688B2CEC82D, 0x1CEFDEDA19764CFC, 
-0xD73CC5FC1E69A64D, 0x3817E76D30CD6814, 0xE5DE8FA47A0A508F, 0x19B3048F5, 
-0xDD66A20614F7DF9E, 0xC0268F9C85CB41A5, 0x80D5CDF380DA898D, 0x1A8A2E3DE3CC873F, 
-0xDC083B3738EC8BBC, 0x1973E2472438E94A, 0xFF7E63440E47902E, 0xEFDEA39E179581F9, 
-0x9697258273CEC893, 0x1C2379B8F, 
-0xC1E432814A80B33B, 0xC4755529CB7A1C6C, 0xADBE4E39779270E3, 0xDA918604C3680067, 
-0x810CD3C95FF9DE19, 0xAC6B55F525AF6E10, 0x4A44716288ABACD5, 0x12F774E364A39681, 
-0x225BCA5C748A4CA, 0xF4B2A771, 0x1ABEE94E2E67CBC0, 0x3D5465C57450D44A, 
-0xEDFA46429DD84A33, 0xD67886289E83C453, 0x8781EA85BC711A54, 0xDCCC030AC7921934, 
-0x8B329FE4DBF08C7C, 0x19AC58B76FE7E16F, 0x22E3941032DCB790, 0x2783818EB, 
-0x1121748C14E81506, 0x3BD79E31CCD0ECE5, 0x353CE22BE0EC3E2D, 0x2C2118CB4E71A4DB, 
-0x638A21B7E520A419, 0x5FAF7154D45093C2, 0x4826A2AB02A2DFA6, 0x29190AA5EC315D55, 
-0x38824BCB88200471, 0x90E93516, 
-0x743E26648FF63FBD, 0xD09EABE6BAF23844, 0x2469248A7A4ECF30, 0x496678212F89D042, 
-0x3A1B09AFAABBE5F, 0xB98A0894A8939A9A, 0xEEDC86BDC09645EE, 0xE640F72E9030BAFE, 
-0xBAFD098B1FFD0222, 0x7DF9CCF4, 0xE4E88C93B491BC24, 0xA36D0360DCF8AD93, 
-0x4FBA995558BDB48B, 0xFCEAC4F51CD71D2E, 0xE2FBC26C2213A352, 0x4BD7328EC5FE89B7, 
-0x8F62813441874B06, 0xB6EF6D4B0A5A2F0E, 0xC27D7FFAD4BC5C8A, 0x25F59CB77, 
-0x544580F8406D98E1, 0x22E2DF0809FBE2E3, 0x5243BC57C98D48B2, 0x83B6C24795B47967, 
-0xCF803390F06A3876, 0x99858E908FBF79, 0x1FD47EA8FC6F94CC, 0x1C42CCE700515F35, 
-0xCD04D378218CB13D, 0x199623C9, 
-0x64723D4B4CD55046, 0x7FB9878F9D828FB1, 0x1224C91D9687DB05, 0xE9A7D53B5897C8B5, 
-0x857D64874ED8C689, 0xD9E1A6D051AA334C, 0xBAF50A3CA2C07245, 0x62203948EE9EF8A9, 
-0x40CF4D6CA2FE341D, 0x133D83F72, 0x61831C5347386148, 0xA6FC78B710E04CDA, 
-0x613530BCCFEEA4BC, 0x33D7B783B611D9F6, 0xA1A26C09D6860C4C, 0x4A82DF1D1CCEBC51, 
-0xA28F0DC42BC89B3E, 0xBEAD6C545769351D, 0xF573946F6478C66C, 0xC9E9841C, 
-0x6DF28ED7E5264504, 0x1C8A601538C33B94, 0xE1AA664EF65E5F2E, 0xCE285AC935F88E77, 
-0xBC0EAB45852AC024, 0xF8B26427CA5EB6A, 0xB43643F3F778A659, 0xF9E12A8A99DF0, 
-0xBBC2E9222A961504, 0x61A20D6A, 
-0xB3FE84A5FB13F42F, 0x29D17F19B606B4C4, 0xCE33E10B3C44467E, 0x79F67B8E7D58CD9A, 
-0xC2F0E14D64C27034, 0xEF9A2171325534E0, 0x5D2B880272606552, 0x50C990F820D7F3F6, 
-0xB86446C67C9F539E, 0xF2202EAD, 0xBD78F5F61C574E45, 0xCB0C51D021044E66, 
-0xA8927C5AA4F46CA7, 0x34D50ABFEC2FAC6C, 0x233B8DD93E2967D6, 0x9BB6E7249B549526, 
-0xE9B1562A67855D7C, 0x1238F63AAFC51DB0, 0x76AFDA7015C439D1, 0x19C4E2E2, 
-0xAC3A70AF106171F0, 0xF41C36764024DE0, 0x2B778FF07EE3F476, 0xDEE1B11915A0A795, 
-0x7E81285FD2BD17C0, 0x2B9A56D7B2DF3E8F, 0xC1B9EB3661B87296, 0xE9A0142106C93D5D, 
-0x6D1DBDD04D77ABDA, 0x2170B15D2, 
-0x229D51264F404458, 0xA30A5367A18C614C, 0x99C827565210E7C0, 0xDF5CF896D99E1DA2, 
-0xB153AAF6EE3C4761, 0x4C1E1DD0B66FFE2C, 0x246CF74255E8D19C, 0xA9ACA644BDB832BE, 
-0x6700217B72B3EA2C, 0xBEB4E7D0, 0x2AA54DEB72B5B463, 0x4E3960E61BB7EBDC, 
-0xF8AD1FDDCB603FB9, 0x59EB3D54A4675A86, 0x6CA5F0D14799AF86, 0x8E9FFD57720C32D2, 
-0x6FD1595F822B9F93, 0xCFECE10AAC68FDA6, 0x25896263B0068DDE, 0x2635C9E2A, 
-0xF05A712D8836BB64, 0xA0A7FD962E4C96E3, 0x50DE2BF56C971DF0, 0x405892644D4D7973, 
-0xECEDBECAD4DE2E11, 0x3DF0DCFCF06C7DD3, 0x9587C05712B64112, 0x1615652333805DA6, 
-0x962B89FA37F905B4, 0x236AD9B5C, 
-0x43B0E674BD5CCF4D, 0x270F51AD589477A3, 0x6B627AEE106C22A2, 0xB498F15FD7E2BF86, 
-0x4391FECD9512945D, 0x6F0DE5B434B45A5F, 0xD91B359A122A1CAD, 0x472DACB9AAEF7161, 
-0xDB855A8A9367DF16, 0x115AC0EDF, 0x17EA99D9E544D133, 0xD9B64792C5801897, 
-0x8F63EB0CE279B6F9, 0x93D4856E18712375, 0xCF73F6F77C5F8A34, 0x689AC81FFE2374A9, 
-0x7A55A5CFB1FA8FDB, 0xE5B64A7C570CDF3D, 0x3264BEC5FCF81A82, 0x283634BE, 
-0x6493F86573EF581B, 0x2DEAA46689FC406E, 0x1FFC92E4850CC7C1, 0xF1B4353362A10423, 
-0xDCF81962E9C38D26, 0xEC7E81394D30E381, 0x684D610F6C96B391, 0xC8EDB34154D60A9E, 
-0xF5DB0C967E3A7D1D, 0x18D452E62, 
-0x3B50080B71F7E978, 0x77C4ADE26DD5D929, 0x2186149241A1900F, 0x1B4294200D2E4D45, 
-0x8E4D50F115B201EA, 0x1EC82966E9A1126B, 0x13268E3E267C9E21, 0x2DE68E571E9A2218, 
-0x90D194F3975ED961, 0x1068CCA1, 0x9F0374571024BBC1, 0xE06C569D8E207036, 
-0x427720E06141D60B, 0xA471E3E45707CB94, 0x99900D47330F38CB, 0xCFC49E55972EDBA2, 
-0xDEB04C52C5FE6A2C, 0xF575243918250888, 0xCEF89A59E35F69FD, 0x18519C18E, 
-0x1863BDDD6EC8AABA, 0xEF429E427913C239, 0x8A72152E75D60A94, 0x6489E0007C2D07B2, 
-0xA268C3F788E649C4, 0x8F68A7C19F3F76D7, 0xA368556B15D4A7E1, 0xECFD5AEDE8035426, 
-0x453D971CC66F7568, 0xFDD3B1F, 
-0x599AA8CC02E5D5E8, 0x604FF7E3AE5F347E, 0xCA4E2CEF15CC5713, 0x6C43CFE9E19B7368, 
-0xB3CED8453BC850A9, 0x5E49FC2AA6F3F1AB, 0x15650661D61976FD, 0x1F84283090762401, 
-0x47027EE3A9925EE4, 0xA6B173D7, 0xB9C1D8B3A198776, 0x1DC15A25A75B62CE, 
-0xFDCCF667FDDFB86A, 0x69B812C7BCE912A5, 0x27FA126E143AB71A, 0x962A4294128B9891, 
-0x6D82BF9819219085, 0x5E646BC650687F9, 0x2A6CE9FF2E329B2B, 0x389CDBC3, 
-0x759880F26310D71C, 0x8C0E701582528099, 0x194051880D146A0A, 0xC9CDAAB16FFA6F9B, 
-0xE3D6FE13004990C6, 0x3E850A77ECC1DD59, 0xE7C95C63A49F4426, 0x4267B1D300EDB2C1, 
-0x9764370261935BA0, 0x1030FF826, 
-0xE594B777BEA6654F, 0x4EBA4F19A5256607, 0xAA3F70EE7240C560, 0xA281318C9779054F, 
-0xF991D755CEA8FCB8, 0x4317424F27CB8CAE, 0x669EDE30CB54CEAC, 0xBB70A598C0185633, 
-0xFC1B0FDC27A138B2, 0x968C0DA6, 0x7AAB04B1A92A500B, 0x58CF990253789C88, 
-0x150DAE37430E1957, 0xB4D8C9850D29736D, 0x1FB504F5D5FCCB5D, 0x2037E0F5A6E40F2D, 
-0xC9F1AE12C406565, 0x144699754D792660, 0xAB9C71B56A2BE4C2, 0xB7A26FE5, 
-0x8D9FE129FC746955, 0xAF41F1314482CA93, 0x3203C6A4295CCFAB, 0x3C8995DDBFE3DA61, 
-0x63A956B35DC3B14A, 0x6AB4A83BCDF51AD0, 0x1CA10FFBE86F08E0, 0xCC0D3B1E42AB5016, 
-0xF94D2E9EAD297F46, 0x22C008DA0, 
-0xFD2E3DE39D2ADE4B, 0xDA7617B06F209515, 0x35B0BD46E342D3C0, 0xEA90E9C1D0AA5AF, 
-0xA841B9935C254AB8, 0xB82E106B399DCB16, 0xCA62C4C521A00FA5, 0x1CB769D5D8395E84, 
-0x661FAA84BAAB6730, 0x1844BD753, 0x19564650234693C6, 0x7F21D3485F7BC969, 
-0x32BB0878DFB32305, 0xC321CAB5F85C6631, 0x47F0303EBC2FFE09, 0xE41A56825B01DB00, 
-0x91DA9F3B87CF6CF, 0x924861CDE2D976BB, 0x4A3424295BD3037, 0x166162869, 
-0x1CE30E35122A8038, 0xD15213F976360E73, 0x6C15320C8B102666, 0x37D7746E258471D2, 
-0xC8F31DCBF0CE54BC, 0xDB0356F699DF3A07, 0x149FAAA6EDF06BA6, 0xA06C7832F6CB06FB, 
-0x2D6EFE30B1339287, 0x1DF57798F, 
-0x82300D19A0D1CFC0, 0xB01F8173D79897C4, 0x7B3FDB54CB7AF611, 0xA85ECEA13F7AE1D0, 
-0x4309552B1AB04225, 0x7995C5317D67CBDC, 0xB9D601885A4A1C79, 0xA30DD3A2F1A227B8, 
-0xADD709A290EA3211, 0x226A30C37, 0x9F305DF38D4E6527, 0xE44883A89BAD4526, 
-0xB2FDB1211EBA2223, 0xD59FF5ADB3063403, 0xC29145F3B518A585, 0xF5700CCB1DE31FFE, 
-0x7AAD0D1466A62B6C, 0xD18FB540CB001BC6, 0xB0C2BA83D34A2461, 0x22DCB175E, 
-0x623B0E261DB94A79, 0xCE2B10CAC65515D4, 0x4BA7217A909B6DCD, 0x9D46C14E15A6BF6B, 
-0x47BAB4F68B05A51A, 0xB0812858C162175C, 0x34F299A3FB50E6D8, 0x996A8D28EF5A4BF2, 
-0x72BE66F96E9E0090, 0x16A9F9D9B, 
-0xC88688A2A7D6B657, 0x5A07C2F8943D3BDD, 0x586A6E68CFCCBA25, 0x3A0DE7E4CADAFCC6, 
-0x16FAB3A55B2F23B6, 0x6B46294A3F25897B, 0xB9D8E63A12AEAA74, 0x5C098C229316C763, 
-0xB90830A6B7FCBBA, 0x97CFC1DF, 0x252B777B2A0FA63A, 0xC19341F0889E29E5, 
-0xFBC28FFEC43CC3C1, 0x7B4964FBA7075F87, 0xAFBB93AD315D5B58, 0x415CB6BE8A066E17, 
-0x6F94856F2EC4DE4B, 0xFB0DE4311CB92B6E, 0x4DD55E8699FB5389, 0x120C94708, 
-0x3D3E9101432580FA, 0x805C59F32363F768, 0x3112C6FBF1553D3, 0x9B50F12AE501D330, 
-0x9EB215A9B6BF02A3, 0x507A63CBD2CCE394, 0x3D176A50132EFBA0, 0x9C53EC750CDD0ABA, 
-0x140F1CEB3B23E8D4, 0xE7220D32, 
-0x27AAF5BDB67609FA, 0x6E2C7C71B9928F0E, 0x854EAFE823CD0BD8, 0x7671D1DF369290F9, 
-0x8BFEBEB09C459C52, 0x1F930DC0659F184C, 0x66A1817FE5175501, 0x2A12C9EDD3AFB927, 
-0x25CF888DB32ED821, 0x1F9FA97CB, 0x82C4049DB85C7643, 0x457ACA61944939DE, 
-0x4141CE6A1F2D036F, 0x63D6D15994352E3A, 0x35F693AD240319D1, 0xE40BB4A55DD69F6C, 
-0x49C2790C5E2A9875, 0x12AEF4C327474F4D, 0xFFD45184C2D4326, 0x163900647, 
-0x8B8FA008EF14B6EF, 0x51429DDE82E3E27D, 0x12A6D6D6941F003B, 0x1C15CAB863B4679, 
-0xBEA6DFAB530E949C, 0xEFE103829D8F185E, 0x258D0B8CB203189C, 0x908B471F854A86B0, 
-0x1954141160CE63B0, 0x16BF04470, 
-0xB432DE4F0C4F5DBA, 0xDD882A4A2AB66B3, 0x43D7E9169C12ECC3, 0x7B4C02A95367F585, 
-0x4CFD3095F5CFD8D5, 0x6C924F8050A99B96, 0x4D0C34B9302D2296, 0x19AB983A55F4F3EE, 
-0xC437805BA976D4A1, 0x1D3DA0DE4, 0xF791CAA769136362, 0xFBE951D54B55110F, 
-0x506FB3187369DCB3, 0x2D89AA8454E0C150, 0xAD4789D5242A225D, 0xE1DC2F867B41CD99, 
-0xB8F31CB67A87C024, 0xED12D1ED8441DFDA, 0xAA849A73B2A73907, 0x12FBBEE1B, 
-0xE237D9D0899E35A2, 0x96F4DE7BBE31B6E3, 0x2283358338BA039C, 0x67ECAD64DA193CA0, 
-0xDEF7B77B80B24C52, 0x642802D32CB48914, 0xF476FE62095E40D8, 0x83814E243D9EFB3F, 
-0x710FEC5F7F79A65D, 0x20F02E7F2, 
-0x3C51130373D74A48, 0x78205C019D7ED6CC, 0xABEF676045D5844D, 0x6ECA0067888DE4FA, 
-0x6628ACC77AF07EA5, 0x770A1E639EE4762A, 0xB81DF3DA926E4530, 0x882659A22931347A, 
-0x85461510E75D9FF0, 0xC5EBE86B, 0xA56A9EED3392B26B, 0x9B7A7DE6428BEADA, 
-0x8787DB9B9DE2B8B1, 0x6FF6A1BA9AF1C604, 0xFAAB038A07775689, 0xE9C2F82BC47521DD, 
-0xA70619225A10490A, 0x52C0F824570EA676, 0x8CAA95010B119A96, 0xC4B31C36, 
-0xFE2463D686E3429F, 0x2F3F6E9DB3BE4AF0, 0x9944B5E4375928BD, 0x9458BECA7D736F83, 
-0x7E11C20F405EDB8A, 0xA5E92D8EB60F7C11, 0x330F39AE362DE2A5, 0xAFC44C33E3C70F27, 
-0xB43207365B98007E, 0xAE2281F3, 
-0x2308CF4A83A8596F, 0x52DC0E473374600D, 0x946FF6BCF102D373, 0x189106EF713026F3, 
-0x3633294EA222AF70, 0xABFF1FFA2C0EF93E, 0xECBE21AFFF505DF6, 0xA8E4F37B2B4CCFC6, 
-0x18933A3CBE16D5D0, 0x1E0CE57E9, 0x545A2E21209FBF4B, 0x89181268D9FA762E, 
-0x38CC8F2FD20676E2, 0x5EDCB0E5C3EB9E18, 0x92996A923F9A2C3, 0xDE463C5940DA671B, 
-0x9774CDF3D0B40440, 0x618951B262A6CE44, 0xA3270738FBBD2BAE, 0x914CE71B, 
-0x79E500D0EF7BB5F7, 0xB136161251C82B27, 0x3CECF427474136AF, 0x4CB525683D9C873, 
-0xFDCBA468B8563214, 0x4415CB37DAF2187C, 0x8152528B90727B5, 0xBA27D924B08D719B, 
-0xE405CCC558FD4B40, 0x1D2F63462, 
-0x6641C80F3C39D820, 0x68F81F5D19C78822, 0x23F61F1164815F91, 0x6952F434998A64C5, 
-0x877853F9290D2FA8, 0x5B5AB28C28BCE6CC, 0xD3B901FD9D60E21, 0x850053694BAF30FF, 
-0xB05391FED4661110, 0xA2DDF805, 0x72195F0AF6F68CE9, 0xD2E129C84ADF0FF6, 
-0xBCA17815BE5BADCA, 0x7330E20E22907C43, 0xB99FF234C073606E, 0x55DB9D7DABACC4E5, 
-0xBEACBBB8EDD331D8, 0xA424459967EBA69E, 0xED5C696537E57C91, 0x17ED0BED, 
-0xC991E22593CC979A, 0xF3B1FF9530EA1A91, 0x87163E93C46C6D1E, 0x9023352C7191692D, 
-0xA18BDE906B55FDD3, 0xFC8FF87D59375819, 0xD73611AC00933CE8, 0xEC9FC5A35B908186, 
-0x2172806017CCA10B, 0x264C86290, 
-0x438C46AA028B6E22, 0x76144E705C51DFF7, 0x58BBAE66BFC74BBB, 0xEC83087D5958AE36, 
-0x672D69CE57086A8A, 0xF905262075C621F7, 0x26ADE29282D6D011, 0xE577D93DB0661FF6, 
-0x865A045FD30715CF, 0x181F3DF87, 0xD00DF487F148D9F7, 0xB44AB019FE7EB214, 
-0x2F3C69E65F728513, 0x7F3CD11D8ACB5D9B, 0x236A6695310E1DD7, 0x965E0F66BEC15C23, 
-0xFF7AEE5DB4A42709, 0xFE2972C69F79B42A, 0xBBBBD9C012123851, 0x1B545D7A, 
-0xD78EF261B0266B09, 0x8102DA4007E983B5, 0x7F660E31BCE2C95A, 0x5B0730C4900548B7, 
-0x258C85795FC4E58D, 0x742F1125F6BEB012, 0x23DA0CD77B520FF5, 0x2B82C00521610A08, 
-0x3EC70F15AB21E98D, 0x1EEFDAB8D, 
-0x672DC786B2A7EE02, 0xB83FEF28723422E2, 0xD2FD51A96163F2DA, 0x2AF6C72492C36DC1, 
-0x320DCA42FD152064, 0x385BD2A6BAFF9F8B, 0xFD7E07FCCC17D616, 0xD291D341BFF9E4E, 
-0x588DF9F9B6E61AA7, 0x252C9FFE6, 0xDB1CC408FCF2BDA1, 0xDF2223D043DFE78, 
-0xB948BD235FEDA1BC, 0x6ADC6DA366F62124, 0xFD6DC845DB64BC9, 0xD64C644DF0CA42CD, 
-0xCA43033DD2C98F20, 0x675FEB0B011B2D09, 0x8D85CEC7AD814D48, 0x40F971C2, 
-0xB9D0859AD5FAD250, 0x14E4CBAFBABFBAF0, 0xF9DB8B42474EAA4E, 0x6370F2A8BAF6525E, 
-0x9800980D40DE2164, 0xCFE45A26AFCF8DFF, 0xE3F8F35C13D07F87, 0xB782562CD8F55698, 
-0x5F6F62973DBA3FAA, 0x14F46BAFD, 
-0x99C01C4CF0BF831A, 0xF19BB16D70D2E40B, 0x9F2D0F6120228C9E, 0xABEDF0619C9AEBFA, 
-0x5FC508DF57B521F3, 0xA40FDBFE3377F805, 0xB1A7A536F5C20456, 0xA1AF191F24E1D3A9, 
-0xCADDA7D12D0A529A, 0x34E8ABAC, 0x41FB8BE4C60AACF0, 0xCA646A1BDF53365D, 
-0x5CD337864ACA570, 0x86FEF6025070C3CC, 0x423AA07FFE0EBF9B, 0xCDAED26AB8AA5B01, 
-0xF1B694ED01E163C, 0x474E0019901AB1E5, 0x81CC1CF3FAB9AB2A, 0x9DF54316, 
-0x9EEA22162B764B4D, 0xFEE98A692149029B, 0x7198B10ECA283718, 0xABFCDB0E0ECA2BAE, 
-0x1BD25DD5CA3CD088, 0x54DB5BC027F9393B, 0xAE7D0B058BD049F5, 0x5FD119174DA6CEC1, 
-0xA1B7BA84C0956D1A, 0x2633E3685, 
-0xE47B86341D216057, 0xE6AFE1B648607F93, 0x19577C7086EEB557, 0x373EE9E701C98719, 
-0x7B0E97D71AAA1E29, 0x6B333633B6B7F539, 0xE3CD03C6E35C9C31, 0xB8FD6FC3B4209B0A, 
-0xE57CCD1F3082892F, 0x274A8A25, 0xC7B5521B0062D4EA, 0xE4C3727AB0C1F1CF, 
-0xF909FD4ABBC35BEA, 0x9399B3F92030B31E, 0x3AF74EEA1FDD5E84, 0xA954E2E3DD857CD8, 
-0xCD49D44E883D5CFF, 0x78BA6F8B57F8DC4D, 0x849B9A91D2A95DDB, 0x1E2A1946E, 
-0x155FB56DCC956601, 0x598979C36957401F, 0xFC3DDDF80C6BE9F9, 0xE8DD6BA442EA7704, 
-0xD85227F7567C030E, 0x5AD6D6EF6FB39F34, 0x31B110524C09F75E, 0x2D5876B80CCC79B0, 
-0x8C050343BE9CF43, 0x3FB32471, 
-0x3327D4CE454EBE1A, 0xB0D9FF9C3B3E16BD, 0xEEE20C6823124793, 0xE159E239CE69325D, 
-0x41335CEC677734D9, 0xE00A331A0D537B6E, 0x988B9140A9C3F6E0, 0xA1B9D23780AA419, 
-0xCC0C55832D1F0457, 0x6C58B72A, 0x115EEC99F9291B2F, 0x45E0D18D3D9C87AB, 
-0xD63660721D897B2B, 0x8798D55379EDA9D1, 0x76720B9FAD4BCC71, 0x79603C6C39231DC2, 
-0xE5239ED740E02F54, 0x11D0BB711CC84AE8, 0x3BCF11A9A234F5BA, 0x1E5286105, 
-0xE4324652BFB13294, 0x970C4B6708DF5B56, 0xC93739B42741C97, 0x901AAA78E78D889E, 
-0x25F2E690460EA28A, 0xB204E7A15D2C8568, 0x60100E140479F30A, 0xDDC78C8C27EB32FA, 
-0x46993F1A1086DB3D, 0x1914436B6, 
-0x872C96C6D30AB971, 0x3580B4FB097D2AF, 0x214E095E35E4E9B9, 0xC9F56EEF9AE34AAE, 
-0x8A67420097220A54, 0xC2A3D9DAA47C0465, 0xA03B2C276043419F, 0xC94EE1369DFBE9E3, 
-0x8BEB931822399BAF, 0x6C22104E, 0x23977D4650363D12, 0xD3E5A9B05099DDC9, 
-0xEA534083FAF04E16, 0xA384B5F7BBA0A810, 0xF2C6529B9371BDD4, 0x7D46B9DFF5D93757, 
-0x96717ACFCFB5B060, 0xAEE46F52E3C2FCD2, 0x7EA7FEF79E7466B8, 0x1D44F2507, 
-0xD87CC9C303862398, 0xD4F59D7A16AA8BC7, 0xE0A3DF36D23181CD, 0xB1C3C606B495FAD3, 
-0xB5B25B73B5CA9809, 0x96D345E483140ECC, 0x35BEEF65F549D257, 0xD9311616F8584718, 
-0xEF7B69CE1BC51CEB, 0xF2015D56, 
-0x85A97C2002087CCA, 0x8622139810893688, 0x161322C7455C94BD, 0xD8CD7CC534DA9A85, 
-0x9D074401BBE28C21, 0xE5736AA103C96F6A, 0xD33803DAAB4AC6C7, 0x7C582C9072D22623, 
-0xB1BFA4EDB97D4D6D, 0x1F5E74DD9, 0xC583AF900F8C67FE, 0x797EEF9E566ACF65, 
-0x19F0DD401F988767, 0x7625E34E15FC70E1, 0x5E3265876AEED8B0, 0x907120F1D234C229, 
-0x238079DFBD2ECD0D, 0x36CB031CF020759E, 0x1F4FADEF098CEF20, 0x144D4256A, 
-0xA4EE9C6684C9C39A, 0xE8BA592FA73EBC00, 0x49624EC88B7D1070, 0x6766AF4A3473532, 
-0x76EECAE61D93C5A6, 0xDDF08C0E504E7E03, 0x7CCB2EFA26E8B40A, 0xD5A2AEC3CEEA8277, 
-0xFCD9B2EB3BA68E64, 0x1E23FDB94, 
-0xA574BD355744790F, 0x8F2AC1B23ED9D40C, 0x6DCF5DC28A9854CC, 0x4E8D7D729B9DA84C, 
-0x2886A79F7344C9CF, 0x7779C91FCC95ACA2, 0x818D81F909414F1B, 0xA98082E7F47DE3C9, 
-0x81C6DEC676E65E9C, 0x207A70463, 0x757A568ED352E313, 0x62E9AB846592718C, 
-0xCC811E922888EDC8, 0x2A665DCA51743D23, 0x281945B273A98BFC, 0x4D19824B3249C116, 
-0x8E8F7DA73E902569, 0x7AC91D187A693B28, 0x94B75580A4C8AC00, 0x23BB5F3E6, 
-0x743DF8B0B8FD0BAA, 0xB5109C4991AA89B7, 0xBE922E60B2567B1E, 0x9D97BB39F2B4AAEC, 
-0xF0AA1DC5AD0ADF1A, 0x6229F0FFBD5C5B4C, 0xD9746FF701614FA3, 0x895AE766DA17EF1F, 
-0xB2B52DADB145FFA1, 0x25133D0BE, 
-0xC0FB96CBAC7430E4, 0xD2FA4D8E691CA620, 0x93D77E96617A43D4, 0xDAD1D7714DEEBDA4, 
-0x7186ADA1E0D6798B, 0x59A3695E461D68B9, 0xB63CB7132910AFC0, 0x15704C7E198DA260, 
-0x473098857349356F, 0xDCC77F87, 0x3ED2C596671B6D38, 0x76D9B348EF9A7738, 
-0x18F6483892F71575, 0x7CF0F76887383255, 0x7941A6EF2C24CC1D, 0xE53D313BBEB0E206, 
-0x8E0BE022A0664AA3, 0x302B9391EA9D21CA, 0x511F24FFC6C69719, 0x21F5DABAC, 
-0x2B10768DAE727762, 0x3213307879D2946D, 0x64BB47F57D3172E8, 0x9C67D41A86754157, 
-0x6B8A5DB3ACF43855, 0x901C3CE9D76000F1, 0x9BDEB3D64B45374D, 0x10DD0B8ADDE0BF16, 
-0x6628600A96B8CDB7, 0x23728CA58, 
-0xB701ABC5FA25DC43, 0xB7C5916144B1C8E8, 0x19B0AEED1FB065DD, 0x9374B33E83F78C50, 
-0xD458226240178E22, 0x26CDE8F74854ECE, 0x4FFF2703D161FC24, 0x92DB0F21A1A4AA7, 
-0x748839CBAC1A082D, 0x4B1DFEF4, 0xA2DBDF7D121D523B, 0xF9D55C15DE4B1AF, 
-0x7FDA5A88EEEB5F10, 0x7BDC60899F28CD2D, 0xD82A2112B03BF3DF, 0xB7C188BC34323A8D, 
-0xBFC2F03A91D189E0, 0x7684A77661AFBA3D, 0xBAD0DDBB12AE9A0F, 0x128F39DC1, 
-0x2567703497C1DCFF, 0xFA94272E7E2751E9, 0x188A0B88F319A61F, 0xD142412962A75886, 
-0xACE70FA1EFCF56FF, 0xB7BF08CC81C7BDE6, 0xA781189DF6EFA0C0, 0x41231D267AB514AD, 
-0x3375C81968088930, 0x22A565F67, 
-0x2E02E5B88A185305, 0x2C79AE4AFC9E28BE, 0xE366267BCAE8ABCE, 0x5FC56A3E1F53364C, 
-0x4C4287012D558503, 0x511293761B4135FD, 0x5A3E645F3FA37AAA, 0x8149B6C77DB33E12, 
-0x59189770B032D951, 0x737502D8, 0xD8B5D60AE8976901, 0xAC1F2A1AB0277220, 
-0x1B28DAFA53A62C4C, 0x84A6DB508F500AE7, 0x10DCD6BB8BA40323, 0xF83CEC9D8FD42F9D, 
-0xEE30D81A9927A380, 0x47622B4F5BDFF67F, 0x2665C34BED79D024, 0x13E8D99C4, 
-0xD0C07F41B2AD481, 0xA7B876E48A3910A9, 0xF4199DFC3B26E1A1, 0x15984C18ACF60FD7, 
-0x5F88F2C379EB7650, 0xE2FAFC8450129914, 0xE79B9FE188853603, 0xE2D1E8BB0A2BE338, 
-0x836D139671F79723, 0x251FC3DC0, 
-0x2EA54B88D85296D, 0x35EBF5286709C6EB, 0x966A918CBEE3C903, 0x3DF2EC8B7385B71C, 
-0xA557062F3FE43966, 0x1EC8902FD25E3969, 0xD24FD90DE6F15944, 0xAB75CD6C7860BA, 
-0x88DDCEDE4CC1DDC9, 0x13CE5B342, 0x204DB34C203DD176, 0xDF6BF3572FC7064A, 
-0x5DF436CFA68840EE, 0xD6F69860E2B3A0D2, 0x1FA0ECAADE549A25, 0x756036F6E5FB8B24, 
-0xF05409E3E2CD4D7E, 0xB816E4E58F0E2553, 0xDC2C9D0564B06D5A, 0x1868A75B5, 
-0x33C910012D6E7FC7, 0x1639A87DD37B7F01, 0xA33AE07057A90821, 0xC26600DE98C09C38, 
-0xE3854F4642DD1525, 0x43FB10036CBC3691, 0xBCA1F338E18B1462, 0xC067BC297CA8B029, 
-0x250AF4E36F71972B, 0x1F00A4A42, 
-0x90F167C1A5FA581C, 0x2530D54C24689F60, 0x982C874DC9256480, 0x246F884DBC88561E, 
-0xA12F808C74AF4F71, 0xE590156D8C6E37F1, 0x1E4FE107A0740C46, 0x3B74F658B6C5A915, 
-0x4520D8E2ED977320, 0xAD79BF5A, 0x35F2676C7F1217B4, 0x57362958644DA2E1, 
-0x13AE3C0D9DAE563D, 0xDF310BF4A35E0FF0, 0xAE23FBC17120DA35, 0xED6E94482F4F92A7, 
-0xC25FF2674130F4A8, 0xCC2588680F4F9674, 0x52BEF0D810B47032, 0xD6D41E2C, 
-0x8C7207BB3CE2BF93, 0x22A08542E1A2C67C, 0xF0B8422BBC7B3BF2, 0x906CE36B51523FC1, 
-0xBF84A87AC9770B04, 0x1331E06C5A0A35F4, 0xF8EEBF4EC0B02676, 0x3F7524B558F2FAA5, 
-0xEA6D001C3DFE3D4C, 0x1FA455C8F, 
-0xFD4FBB828093D8BD, 0xBEDF6C45BBE4BA60, 0x119707CA51D076FC, 0xF868C278515679E1, 
-0x2A22B7224FE75055, 0xF03F44A2625B6B4F, 0x8B2771205CE5490F, 0xF238B547817046EF, 
-0x3A5975ADD4BAED5C, 0x7A490709, 0xA31C6BD53093D9DE, 0x338FDE615C6D3AFF, 
-0xD2933658B72922E8, 0x5F2C27E404BA1807, 0x9E6E18A042B595D9, 0xF5B24BC70D4379F9, 
-0x787E88E766381514, 0xDEED2028F0BB1874, 0x1D61AB111F592C7E, 0x1071F8E3, 
-0xC5C5D8D4C5FF400E, 0xB5E16A24B27C4978, 0xC786A54D51E7D65F, 0xD4A57E39093016CB, 
-0xE683A1CABC7A9C96, 0xE622421AF2EE4437, 0x817E1D30B49A6DF6, 0x46B4898DC6F818D5, 
-0x2422F9E529CAFFD, 0x216E14660, 
-0x3BE5032E566C72B7, 0xFB4B334E9D3D2858, 0x1ECAADD03CAB4150, 0xB0AB4D0574015493, 
-0x8A65480B67460689, 0x717DBDFE6A78C61A, 0x7B688AA1A781DF12, 0x7CF5E20938EEDDD2, 
-0xE68529486F05C8B7, 0x181D5D0A6, 0x783558FAFF349411, 0xBAFD1D1628C67B67, 
-0xF9F9A48719525554, 0xE98A88F3EDCE485E, 0x6DC0CB6649033189, 0xF1AD590D5CB1AC1D, 
-0xFB1A6ED3E976615B, 0x166F7524F0B45A8, 0x975807307EC3D63F, 0xFFEF96B1, 
-0xF634BFB26D2CAC72, 0x66F93915E378BF76, 0x68AB29E29A0EA186, 0x6303232385B1464, 
-0x5574BB125E6D3ECB, 0x454CC6927425DE65, 0xB0F023694C4565EE, 0xE195B874D6F5CF20, 
-0xC6A9304A7C4A0EFD, 0x11FDA5D47, 
-0xA0B65DBB8E1A356C, 0x8D3ED7484C77F4AC, 0xFA1B5C5E74B0B74, 0xDBA1F309B4371351, 
-0x3B28348DD7AE81CC, 0x823FCBADF11E9259, 0x3B7F9E4C8189ADBA, 0xB320C606FD9219D2, 
-0x9400CBD7AB83E1DF, 0x85B97F84, 0x5E9E2A5FC890B5BF, 0x4B2159D014A567D1, 
-0xA16B3E4EC6187481, 0x9C0B56B2799D8F1A, 0x896A09FC9E5D031, 0xD974794FB8B887EC, 
-0xD56E286C9563C8AD, 0x8411F8B0B7AF4D3D, 0xF3975B47FA519BBA, 0xBAB6299F, 
-0xC70092FBF3FE65DB, 0x5FDF9916283CDFE9, 0x2B33D0E261D51270, 0x82DB51FE195F7AB3, 
-0x87D2528F9BB2FDB5, 0x61A98458B23A83AF, 0xAD432D3417D1743B, 0x923DDCA0E6511A6D, 
-0x2D0311EC4061CD64, 0x24390B94F, 
-0x96A9CC6B2F56123B, 0x3C0E95960ACEA034, 0x53A5FD617B3DAF7F, 0xD7A6715633248B26, 
-0x560D4A09A38C5070, 0xCFE72F39CC68428A, 0xC5B1A5A79F286F76, 0x2D8A4BAA74AA2030, 
-0x66000EEAEF27DEDC, 0x5E68C220, 0xE10CBB5590D1EF02, 0xC048482B28F36912, 
-0xAE45BD61C24F53FF, 0x8F8EF19B1F668CC5, 0x10DF6F67F787A554, 0x727CBEA3CD7A6C7A, 
-0x21A94AB24E3795C6, 0xE321D7EFADE0EAA8, 0xCB0023C71CE255A6, 0xD0D657C0, 
-0xCEEFDDB3ADBC36BC, 0x9ADDDEC2FDC1CB0, 0xC28BB3A130B81225, 0x34D8F14733D8A9FA, 
-0x4799612B1044305B, 0x87C88A525309C765, 0xC5C5D64D91E7599F, 0xB0FBE20434D73941, 
-0x86D80D0B849A5B9B, 0x574FB5DA, 
-0x796CDC97A323D218, 0x24EF4DBEBDE3E90E, 0xF8FE93B7D2917FD7, 0xAC4A6AB4E0B53D3, 
-0x10240AD1E209DC40, 0xE087DDFA3720DCFF, 0xA6BAD6167683F950, 0xE65C1FF5DE0D599C, 
-0xC64F4DDCEA279EAE, 0x50510F23, 0x7FE6AB9E37C03222, 0xFC922050789E3F97, 
-0x8EB1C0764863B651, 0xCCE9AEF1FAD5F411, 0xBE70AADEB18A737D, 0x6D83399CD76806EE, 
-0xDC102A8574F79036, 0xAF9871CBD37693D1, 0x7DBC1AB0C9FF5956, 0x1D0BF96A0, 
-0x6A461245ABFA9812, 0x1F24B9BF0C293C9, 0xB49822904FDDD637, 0x26EFD058F0ED3943, 
-0x7DA9233CDE2E95FE, 0xA0349294315327BB, 0x164C4F9A7F13DDC6, 0x429044E160BAB805, 
-0x4CBE06FBBF0D273D, 0x2516E3055, 
-0x3029E45C6F526900, 0x2C51392FD11B727D, 0x2C29BA7157C4F82B, 0xD8D2A96696CB7431, 
-0x7F52C5D6DD3751C8, 0xE5AE119A7AC0FB11, 0x7A3B72891CAE1417, 0x570E59E96FEA50D4, 
-0xF998A8FB8EDAB176, 0xA0877FF8, 0x1F8055C0D3670EEC, 0x3A9FBCBE10737C53, 
-0x13C52DE4DEE2BDDB, 0x1C669FEF12381A25, 0x628C8446249C81C, 0x38E7C691DBDB3EDA, 
-0xE2824ADBB411ADD4, 0x80A9CED33CEE08C8, 0xEAD57CE490A61DED, 0x1504D4403, 
-0xF2C0EF4503A9FEA3, 0x4A654C9EB06D84D0, 0x9CC4C9D2209F1A62, 0x690C34ECACB1F464, 
-0x1649C7EFF79F4DD9, 0x15EE49A9E45A9807, 0xC34AB7B769545102, 0x67E2A7F3E48D9AF, 
-0x30762FD43AC565CB, 0x57DE5E70, 
-0xC340664AD66F2760, 0x58B58940D4B22D92, 0x8199D64536ECFDBC, 0x47E06313A1ADC904, 
-0xAB58C4CA03D10913, 0x43871C41AC4F4472, 0x83E1038D6F05749A, 0x9AD135B8F4F12307, 
-0xFED8D684F2206511, 0xA8355FB9, 0x215F98B662F085DC, 0x978507A78F49BD5B, 
-0x8AE115548CC27A02, 0xE8ACE77893F38F7D, 0x7A1E7FAAE9F5E180, 0x24DD729D785ACF4, 
-0x3E1308853CCCD30F, 0x7B2B2F42DB1E965C, 0x7FF1E9DFC5EA082E, 0x16E9D3F54, 
-0x40437E395EC73F1C, 0xFB2F799EDE71C704, 0x25F0A1262DB84169, 0xA03F977834301869, 
-0x6607387AFD9467A1, 0xA10DAB1695E682DD, 0xABBC6CA99C8BBAC0, 0x4528CAC83530660C, 
-0x151EE4EF0CDB30E4, 0x20BD7D088, 
-0x1CF79A5A1333196B, 0xF48DC70113A5B728, 0xD127385D444F272F, 0xE0547603D4181AAE, 
-0x5884A40B9AF89DAD, 0x80F6CF96E561E3A1, 0xACC01A6E3F603829, 0xB6BEE3D9D7BCE674, 
-0x9022B8A777052FFF, 0x1C7B350D8, 0x613A151A4099A8EE, 0x9F1C78CC2486942C, 
-0x5133AFD28088AB2, 0x322E50906B63C186, 0xD747F153488FBB5A, 0xB8A2A74358A1B9E6, 
-0x4637EE307574E574, 0x919CFF9146D5B31F, 0x41696D3F9C023230, 0x26864C5DF, 
-0xEFD7241DDBC92301, 0xF4DA25180DACA9AF, 0xB91FB24C749B4206, 0xF61F5E8702484F44, 
-0x71421B977FEF3121, 0x90C619838D27CFD8, 0x10AAA556249F90AE, 0xDBB6D316C3561960, 
-0x7D04E1B0D4F96003, 0x8476443A, 
-0xB8E33F7341B9110C, 0xF573C3615F6563E1, 0x703F202E9C81AFC2, 0x4DCDDE216A9BB612, 
-0x6F5AD9FF69DC89F4, 0xB1215E7DD8CD6A5E, 0x5E48483139B6E4A7, 0xB8113F07921AA93C, 
-0x1820A8185A444F6E, 0xCA2757FE, 0x2F242A2F907278AB, 0x3B71825E9085ABFC, 
-0x8ACC4EE8FD3280, 0x2B4D4EF79B346B82, 0x8B569BEB89F9BB2E, 0xBB7F460C1845E9D, 
-0x2019A73140BAAB1B, 0x59A01E2FE2735AF9, 0x9D8B762617FE48CD, 0x16D21E00F, 
-0xB3AB11523FC62A9B, 0xAA05A7990FCEAEEE, 0x97A79B14E25B0EFB, 0xC3791239BF2CC234, 
-0x93BAAB96443A5CCC, 0xCA388ACD5A83233C, 0x36F837842B1DF724, 0xACD983A0A9DBFC7E, 
-0x588BE974B0FD3819, 0x13A9343C6, 
-0xC4357401BA1BADB8, 0xF5CA42BBECF7ACF9, 0x10A55819B169358A, 0x51E9E5ECF996370C, 
-0x2F08442770CEADEB, 0xE96CC9D2580C4AB7, 0x9CE98FF8C67A543C, 0xB51DDA4151E23A1A, 
-0x4F9E89B7DFFBC90E, 0x22579DB3A, 0x8FC871BB9F2E6ADB, 0x6FBE45594EC33C75, 
-0x5885AEC94261F1C3, 0x67AB7CC2108DF49F, 0xF4889858236D654C, 0xE5E74B63A6B29A53, 
-0x7AC08EB8BC99B638, 0x40DC7E2F23B3149F, 0xB0001C595A2916D7, 0x78A4D9A9, 
-0xB241DFE2FAFAECBE, 0xBA7A6C59687686D7, 0x262D3B0D459703C4, 0x557DDDF54C198E97, 
-0x6202F924F22A2BE6, 0xC8ECB51F4F56B301, 0x48A0EC38F6038E62, 0xD5C49ED437FAF39C, 
-0x8E5DE9256404005F, 0xC4B404EB, 
-0xB50463B57E9D470F, 0x90D2754D6772D708, 0xEC5ECC0EA23BB60A, 0xABA78A7CFA527343, 
-0x47BB4D7D4664105B, 0xE9A421F040BBF1A8, 0x59776937F01528F0, 0x507E32998B16E54C, 
-0xB5172435B85AC7C1, 0x213A06C19, 0x8DF9625BE193F829, 0x72EB9469BAA6186E, 
-0x530BEA72AEDD0327, 0xCB3F4BCAE4A756EE, 0x50E3CBDCD8D7FDEA, 0x32C4CE81FDDAB949, 
-0xA6A678446DEF5E78, 0x7CDF73E06ADCB6F2, 0xEE477D4278BD0875, 0x101A3CEBF, 
-0x534B52D3688395A5, 0xA0F7CAF6CF1AA186, 0xFA72205C45006383, 0x4F0830ABFC23E9F7, 
-0x4BF966F69C62C3FE, 0xB8A1A4553520EDA, 0xB04509B483B503FD, 0x52841A7FF19B2EFB, 
-0x3DE68F437017470, 0x46693E32, 
-0x87E1C9ACB914B0E7, 0x14383543F11EF74B, 0x94C3ADD28E305019, 0xD675CE8191B1DC71, 
-0x4C2A96238AE1D13A, 0x21AE767B72D73D09, 0xA6A64B9353C3E4E8, 0xC572507CA62FBCE9, 
-0x30DA796B245A72D1, 0x2A48B29F, 0xCEA4853A0CA9002A, 0x79D219707FCE6DD7, 
-0xA089A62E7DA6826F, 0xEF8EBAFDAA175880, 0xE4BF1A4D9CD3818, 0x8D2D0904DE26E016, 
-0xE015E54F2CC655C7, 0x837C564B69FED5A2, 0xB9027568C9945C99, 0x102B94143, 
-0xA679B452BCFF1354, 0xE2F8EC9FF963BF70, 0x9FF3C3E3C6B7309F, 0x91FB1EB0CB6162F1, 
-0x2A84E3EF51B29847, 0xF45B3E43BE27634F, 0x753359545CEB5792, 0xA94814781BB9BA58, 
-0x57B9A1636208A3FA, 0xBF495CB1, 
-0x5F3A4D040D9EFCC, 0xD282BFE201375D53, 0x15DA58BBCB167CA8, 0x12591A734664B527, 
-0x89414CC8DEC5E7C6, 0xA87BE6989EB01B77, 0x42616BCC6CC23ADB, 0x41201EBB3511E9A4, 
-0x65A06FC69685B70A, 0x2EE4EFE2, 0x6480FF1B4C577EEF, 0xE3C690ECB4AB18BF, 
-0x406C0361DC7385CE, 0x98AC2FE8A7345673, 0x53E112F0295CF4F8, 0x9F81293B28F53E0B, 
-0x5F70A365C09266DD, 0x79C298E2D81C0347, 0xAFE7F65526124F7E, 0x25191766A, 
-0x1A35A74BC2EF5A9F, 0x232BCBBB59CD179C, 0xA6D5A872CC1D6973, 0x513FF007ABDEA84, 
-0xA5BDA0AEA28F57E7, 0xD25899A328FA4619, 0x772CFBD92684D285, 0x73F42E304A37DFEC, 
-0x70FB632097CDE07, 0x12395D551, 
-0xE93900FBA4109AEF, 0x700D3DF99A6CED17, 0xD920EA596C71AE51, 0x735B4D3570AB1C22, 
-0x55F78E2BEB4E19B4, 0x26B9479D56835A6, 0x7A25960A9DC467C7, 0xB54747FB222DE4A7, 
-0xB982FCD382C5D0A5, 0x25F533EBA, 0x3E98A136EBB195AE, 0xA9ACE3614C69191F, 
-0x9397FE43C4CE0D2B, 0xCFF578ACD9B2F67D, 0x6E664D3EB28B91AA, 0xA59A5C4875DA417, 
-0x4A652D1B31153A, 0xE806FC67905685CE, 0xEEA70B612154A7F3, 0x21FBCD47B, 
-0xA1EFEA09E2EE9B4C, 0x2E9FBEFD86D8AF1C, 0x1ED8C41B2F42D46B, 0x57E2A6321F2D82C6, 
-0x4DBFF3CB8731AA19, 0x45349EB47AA04F9D, 0x38043A38DFA882C2, 0x837C7459645CD503, 
-0x5451C111564550BF, 0x15B4AA129, 
-0xCC1140CB0AC0133C, 0x14C541EF93F79AF7, 0x653F7242CA644E4F, 0x33BE0FAA19546A8F, 
-0xD9D2984BB7ADB01F, 0x6A4A996B2F94CBE6, 0xB37C04ABB619B90C, 0x274F34514EAC4C85, 
-0x2B4F46E57DF26E89, 0x258958334, 0x5469F1713F8E2916, 0xABC5713D3DE4F937, 
-0x2360B7919D6C6873, 0xD0ECA61A38089E5F, 0xD5C78EF3B7CA41F2, 0x9EE268703CFCA591, 
-0xBDCB44ACF714223A, 0x70862598AC8A6D16, 0xB7079F0BDA398B84, 0x1E0B7D55A, 
-0x9B5FE2D89DCC309F, 0xD15661B2EEC1EE4B, 0xDC1D5AACDA9A5E3C, 0xD557922FC4D3977, 
-0xF30C29C4A821103F, 0xE5D2EBD537E813B0, 0x1FC5DAEAE911AE4A, 0xC41902D48F50B6D5, 
-0x87782E2EFB2C274B, 0x42D9868, 
-0x1B00C26966FCC4CE, 0xA4747599D3034E95, 0xFA6BF0F00B3EC69E, 0x6B4C9F6C44A97978, 
-0x50ABD55A66E99591, 0xD1E3252AD6A01F87, 0x3064146C0E0F49AC, 0x2E8F6FB8447B5596, 
-0x5C4AC7CCA4E5E3BD, 0xAD4C549A, 0x7C95D4A56F66EEF5, 0xE1B2F7CBD2457EFB, 
-0x32B2E09D069B55D7, 0x3EED370F84517DB0, 0x1312F407752275EC, 0xD94E9DB35C764A41, 
-0x70E09C3383E64B42, 0xF39DCC5E05F6D93D, 0x3809ADBDE542F9CA, 0x1C9D85A03, 
-0xC0F243835AA6B461, 0x17C60B796CF95092, 0xB5CB6581AD29DD26, 0xAF780C7DF0BA0, 
-0x587219C81E7E440B, 0x9C14B36396B2DF9B, 0xEFC7DACEC1062DDA, 0xBD837E1E142BC559, 
-0x99E4C1F56D43C56E, 0x84FD0D8A, 
-0x6FD62341BA5C3F28, 0x21F2DFC06DA5DF52, 0xE779E0B19F7C0F4C, 0x4EE7CCE903B78097, 
-0x26545603D9DA6D35, 0x79552C9B97318425, 0x54D93943C80DCDFF, 0x51B114DF4ED28343, 
-0xFCE9D465F1470D10, 0x93F5B46C, 0x1C7525DF40BBD468, 0xCB8675C1E9EA77A7, 
-0x7C89BD2651FEFF7F, 0xE2E22E33DA17239A, 0xCA6104B701C60C21, 0x8F09E392BF9D74BA, 
-0x264517459F8E6FBE, 0x40FB8FD3948986B6, 0x9AD48CE21FFB9D09, 0xD275351C, 
-0x9937A9B6499FFF6, 0x9A3F97174A57954E, 0x1C132C4C6C8B1DF2, 0xF218F494E906E36B, 
-0x62979CC83CC23648, 0xB86BEC75BABFF50F, 0x2EBFF4828EDEB39F, 0x5F72B82E45D84AAA, 
-0xBA1C3F67A36254D, 0x740375, 
-0x3B0465C7E162C684, 0x48E2A19137E14259, 0x8DB213F10B45054A, 0x77D53CE1070620F5, 
-0xF7C83FF6A8C258E3, 0xE558C3F900C6B89F, 0x56D6990A832C2E88, 0x13D0CFC7B8B690DC, 
-0xAAA09D10E3608ABA, 0x21F1F7D80, 0x8533C36699C2F707, 0x89ABD244A1CEEB44, 
-0xCED5EE29617FD639, 0xEA272B9D3E81ECDE, 0x820582E94503F278, 0xE7B3B75DAC86D249, 
-0xC85383F6B35A68A4, 0x90E64BD011AC9FF5, 0x7B5FE6B287283EA4, 0x1BB61856A, 
-0xD09A6AB8986EB8E3, 0x8972A47C63818894, 0x5FB03AA18D713B74, 0x663F2204D648AF3C, 
-0x3774FFBD7DEBBC85, 0xA30CB8968A830228, 0x8B58C23DC9DDD56A, 0x33EFF51F0F013396, 
-0xCF37D4D7FDE97D25, 0x6E6FFF33, 
-0xFC079267ED7452EA, 0x6F0FC37402859939, 0x57A7B24B429EAD1C, 0x35FB0213C31A7113, 
-0xA10E8D7AF945F7C8, 0xA7AD3116DA9D75F5, 0x38B6D54653B45EEE, 0x5A6811E8F948F5EC, 
-0x7F85DE570B2C04D7, 0x24A52836C, 0x94364E8C913B445D, 0x663E2A14D3A04138, 
-0x6F1AB19EE62EC5B1, 0xF874E91DB1A2E389, 0xB86C56895C5A20D0, 0xCEF49F715909B2F0, 
-0x44970BD39782309F, 0xEEEDCF09F379339E, 0xEEE7C11AE292F189, 0x21445D0E9, 
-0x1F9602DBB23C3466, 0x26F4DE6DE7EF8B98, 0xC0B90524AA8C693D, 0xA0700964A20CBF4C, 
-0x85D051FFB4BB18C1, 0x188F7C23E5C09BF0, 0x8754FB2196C300BA, 0x27054149F185EAEE, 
-0x72EAAE2B97E874D6, 0x159E688DE, 
-0x23CC087629E36B0E, 0x4FDB55C5D903E410, 0xCFF2E4BC2FA0CFD0, 0xB59A13B4D773CAB6, 
-0xA51DB3D023FE0AF8, 0xB11F7226580C3811, 0x632E46B831B42D5C, 0x98BDE3F6A39D4977, 
-0x4B3B3A5F1C3218C0, 0x14ECB410, 0x8B060E77F084D8EA, 0x971B93DD503C17D5, 
-0x4002B8DE021272A6, 0x4EB3D7C19A592477, 0x87B9BC0B264CC382, 0xDCD93E7295F69ADF, 
-0xF4CF84A31C4CF501, 0x5B67E8A4B6B8C70E, 0x8B96C7943A19CBA4, 0x28B06F9A, 
-0x63D12EA714749DE8, 0xA17FD13572445CE7, 0x3352362391C0CAD9, 0x9E81192B0CFAFEC7, 
-0xBAFBB8C2BB7FC75D, 0x26AA2D7FC35713C4, 0x81CE15EF7BC3E3EE, 0x92AECA779AF1872F, 
-0x357F9486E42BE8B1, 0x1F1216B75, 
-0x87AAED33D5D83AAE, 0x7B334172117FA45A, 0x91BA797A4E70C46B, 0xE6A5E50567FFA709, 
-0xDDAD276042511F9B, 0xFFB3CFB809FF5AC2, 0x43666D0F8DBA2B81, 0x1EFB93CC7120AC, 
-0xBE490911312D5ED, 0x221BD625B, 0xACFF5245E7BA5286, 0xE0126495EAA012C6, 
-0x15DA2F05EE0ADB7, 0xAB7F1730BF31602B, 0xD424FE2931C328A0, 0x1D48D35F762E20F3, 
-0x21D6EFCDA2791DF1, 0xBD7F40B4129D10A2, 0xDD0AF3C42E187F97, 0x59DC7352, 
-0xCCD0837FEDF61F17, 0x48149311F12E3152, 0x3B564078021D5C35, 0x773E828B62A75F05, 
-0xC0C7D391695C2426, 0x48F96E03490E0D35, 0x6A77347455F9F41E, 0x305DB16D73072EBE, 
-0x5682F46F090D0948, 0x1F86B93E1, 
-0xF98C3B62A14C4E0C, 0x8F9EC444A18AF324, 0x2BC634BD97FF4727, 0xB4421357A13B7D9C, 
-0xB58EDCF621CA1133, 0xBF26FC9D857BEE32, 0x57C241197E9082BF, 0x9DF6E7B98BF3A253, 
-0xA734908FF658D9E6, 0x11195EC46, 0xFF00221AD011656E, 0x653633FBF51B8D02, 
-0x648FF69ED5ED3F44, 0x845A13AF06B1B440, 0x24003BAEE6598810, 0x488177FFAAD7E129, 
-0x398B5F894A6EE330, 0x8189623E2A5CBEA0, 0xFA64176C916DDC4C, 0x20F4DE01E, 
-0x36A64946F6EC0690, 0xC47C3B36E4DBA434, 0xB2D0B35356F0B0A2, 0x587C0A684D47D8AD, 
-0xCE1B9E9176858EA0, 0xE5E82BBE689978F2, 0x3C03D0C2348C916F, 0xD6F886294BABECBD, 
-0xCAEAAACC99AC922A, 0x7CBBEA04, 
-0x280CF92B02706457, 0xF0640FA1A71F876E, 0xE4CE0E18CF4AFC66, 0x17EC6D3257A064D3, 
-0x21623BBCD0E10B9B, 0x815C40ADFCCAD5DF, 0xF9D24F0FE9CC4A81, 0xBD0A93E19F922317, 
-0xBB01F954FDDCC917, 0xF0AF4C30, 0xB328AA64DBDCA21A, 0x8F7448960F6DC4DC, 
-0x24B0D9AB785445D9, 0xC3A1A9F91CCCFF93, 0xF52EF6DF422C5D11, 0x4AD247B2ADEE4A26, 
-0x1DBF68230FA40961, 0x6BC6BF96E8666079, 0x91CD9B300C0BFFD7, 0x1DA64743C, 
-0x5BC35F024A253A8A, 0xC9663EB6B6D2416, 0x5DAC7C35C3FF8E33, 0x86149B67A04E6D1D, 
-0x11CF013EC430DAD5, 0xFCBE5C884D9E08E0, 0x4DB83614D04EDFD1, 0x2588AC27DEDCBC3, 
-0x9B4863BB858FB3A8, 0x1EBFA81A4, 
-0x472911141F05C338, 0x6886A64F4113DE0A, 0x7B8EC9252749FE44, 0x144D81EA7E95E9B2, 
-0x68B615B8B56DDA31, 0x1C818E0AA7E4C08A, 0x2A25CDF82BA6B5E0, 0xC9BDFBBF5C8794A9, 
-0xB6899996510583D, 0xA8374740, 0x497B7F2F6A561723, 0x3F57001CE417ABCB, 
-0xAA89A93BEF3CC795, 0x1E6650906806C853, 0x898E1DAC2F4A0D6E, 0x89AF51CB27A3C5DE, 
-0x19B26D309BA14C63, 0x2F647CC62A70244D, 0x576475657AB3A35A, 0x1A7C9D896, 
-0x7ECDDF7CF0614A57, 0x22FF4864B25F4155, 0x98AE21B402359F39, 0x106DE93860408779, 
-0x56750B1B0357F376, 0x33ED67F163C9B6E, 0x3B10AD3E18649BF8, 0x54FFDABBED7D41A9, 
-0x53851C898AFC94F6, 0x1653718DA, 
-0x9E5FFF7F6B723F6D, 0x6C692C61555EAC63, 0x4123DA568E67E342, 0x586E04DA3639546E, 
-0x1B598EF19B5CB1FD, 0xDC97D91CFE2F4877, 0x6564E77AF74F82CA, 0x3E333896A87D503E, 
-0x50570FD3E42592AC, 0x1F1DF01FD, 0x470C3A26601E7C58, 0xC0C47EA9D123CA34, 
-0xF0748C608BBBCF94, 0xDE03BA2190F59450, 0xC2BCCDD43FD10249, 0xB6B4BE3DBBC40AB0, 
-0xD7EB17D177F18E1D, 0x277E478F9613FA18, 0xE41AED09464C5AE6, 0x2208A3A38, 
-0xD5E208421A0A5FB, 0x2549474A6049B14E, 0x3051EEDE6525F790, 0x6AF005837A141A45, 
-0xA66304B18E62C252, 0xFFCA0BCF7924E62F, 0x7B3FB6C813428B46, 0xD1979C3E3DF032F9, 
-0xC0F32E90A15C7D84, 0xB035CCFA, 
-0x61AA1E9406F99D61, 0xDEF66061105B886E, 0xA8D663021AAB19D6, 0x1EFE6FE574664C5B, 
-0x48364940CEBBF816, 0x3B9AC88CD2C5D0BC, 0xC82515150E88E3E0, 0x311AD47F7996E7C, 
-0x758D8131F44DEE83, 0x1E504FC78, 0x5A4453104876C2B6, 0xBDEEB4DA685B4003, 
-0x1A32D2EA0E16C455, 0xB89C093917BC981F, 0x379F60DB6BE0F914, 0x12D7C86904A9DD66, 
-0xC0F39C420B0BBDA3, 0xE35DBF76F0EFE3CD, 0x14BE8BD045CF3028, 0x2577261EC, 
-0x82F60F2C202A9F58, 0x970A648938FEEB5, 0x901EB76C2E515C1C, 0x8CB2F59BCEF99267, 
-0x77F7CEDF43463C2, 0x41BD97A6B6ABFD36, 0xA2877A5C86F40BA, 0x9D1D6EC889FAA956, 
-0x5A50B7627C46A2DD, 0x14BAFFB9A, 
-0xD7861FB9ACC72E98, 0x1FFE0365E77421B3, 0x20025E30AF7F8684, 0x665AC570336AA030, 
-0x81C857F22A9E701D, 0x30FEE34700088444, 0xC23F243616200084, 0xFD5DB335F7073F54, 
-0xCEF63B062AAA02F5, 0x572DF6F2, 0x6D4DA7D0BFC4137F, 0xDCA2361B5F3C30C9, 
-0x6EF11A916507C979, 0xA77417B885EFEAD2, 0x91C8293D98FBB85E, 0x99F0EE2FC871A5F1, 
-0x501C746B0E47F589, 0xD537FF10B60EE199, 0xA56BA9DD7FC5A83E, 0x7733D4A9, 
-0xD3DE9F1705567236, 0x70B3A65316FD3D9D, 0x58D1076975B0A9FA, 0x98E14E51AE732409, 
-0x662BD67C3392A214, 0x8A7C776A2EF44804, 0xEA2AC4BEB1E9A5CE, 0x911FD6CD6A74214D, 
-0x7A8EC891D48DFB50, 0xDB7F651C, 
-0x9DC6DE50FDE6CBF0, 0x720E27A35441A6CA, 0x48E2CEF841FAE4D1, 0x7C04A8166977455E, 
-0x60A118DFF1CFFCA6, 0xF3A2471FF7DD0E04, 0x299B0A2ABA22A536, 0xED74F684E5DA8F1F, 
-0xF9CD07652E70A81E, 0x2E5D8C5B, 0xFBDE83423D0EFB35, 0xD6B8D96513355EE9, 
-0x8FE80E027B523B8E, 0x42040875878667F6, 0x73382355197D574C, 0xA0C7624B26F2C69D, 
-0x5F07955857E46A5D, 0x5C8477D4901D911D, 0x8E0E15F3CA287F7, 0xACAEEB2E, 
-0xA2F5F3A15E1A4BBA, 0x7D16DD0B3218A2D3, 0xFAB1E5F41BCDEC28, 0xD14818D7E93F5AC8, 
-0xE7747B9B7CEA73B6, 0x5ADEA05C050E9057, 0xA191C88EB1D27963, 0x47820954A7813F69, 
-0xD81BF59F2971672, 0x3A02C2D8, 
-0xC08DB7B40343F6B0, 0x6A2EC4677239C591, 0x9CF58F1EDB6CC898, 0x65F4C2303B0A5F51, 
-0xA46440500F8E7A19, 0x2E86CA06ED013357, 0xC07214BE23A498B9, 0x8B5A1820D234ADDF, 
-0xBD17593B440F8644, 0x2458BC06F, 0x53E68B1381EF5830, 0x7030B6930BE00DE4, 
-0x8C98E8F32BFEACC7, 0x7820D653760B83A8, 0x73EF4CC7B854369, 0xB096690BB9C20A8, 
-0xF41ECD97A4861306, 0x3FE5597D8B85C8DA, 0xF6CAEAEFA529605E, 0x7D1C5A95, 
-0x5EA236742682E91A, 0xA72E377B69270151, 0x92EC9879AF53210F, 0x2541F6AFDA70062D, 
-0x2B0860121CAB3DF3, 0x52303DDDFA5A3916, 0xCA282291FD2C3495, 0x9832812F5818F7A6, 
-0x61038FA94AF6D80C, 0x141BFAEA4, 
-0x912FC331D2549D90, 0x3CC05240FC5F6FED, 0x922341008665BF31, 0x2DBFB2099A12855C, 
-0xEA568F0B66CB5274, 0x1B616E5D5C7AFB11, 0x6BD56E15A4002449, 0xC2C04C9070D03E9D, 
-0x77C060261172D571, 0x1270257B8, 0x9B8A8C92EAC2CFF5, 0x6668CA19D5DAB6DC, 
-0xE39EB25E03240F7B, 0x92D0D0C300AC76AD, 0x9083C3D305547BA0, 0x2E8652C70CAF5E5, 
-0x4F94EBBC53A7FF88, 0x14C8A3C9BA4BA0FD, 0x6EA5FCAA5CD78596, 0x1FD38B86F, 
-0x56472FF0A676C62B, 0x3E3F569797A0A266, 0x7A2F26A8BF1F01B0, 0xE6B4F2E6288624C5, 
-0xC12DC2BD0CE04022, 0xD5C742D502B136BB, 0x77B2CC62C5EF20E8, 0x37FF61AD7D80DB48, 
-0xD9B3162F48CF615C, 0xCD5E76ED, 
-0x6913B96DB74E7188, 0x225612FDAC660A4C, 0x4F6AAD7DC7A8BB8D, 0x8000861E54546F0D, 
-0xF300F74543FCAB04, 0x876A12CDC1FEA4E9, 0xC42BCB329EC2867B, 0xF1F4AE46736624F, 
-0x7260E1199A785CA9, 0x4B8F1E6D, 0x8A128E393B069278, 0x8E9D8A6706A0858C, 
-0xA55A19CE5FBD3ABB, 0xBC94994744D45C60, 0xD6010D5124C9EE2, 0x8AA258AB5FE83EE4, 
-0x42AF06A6977B8C49, 0x480B7AD011D6442, 0x621878A487E3975B, 0x1B6D635F8, 
-0x50CA978BE5B27B4C, 0xEA8CB71D657E6486, 0x788F57A3E24EDB4, 0xB63E494AAA87FFEC, 
-0xACF852945261319A, 0xE9419EA4B3A677F8, 0xD7509E5DB6BCFECB, 0x23093FC25A157FBA, 
-0x90EEFF40939A3001, 0x3379A84E, 
-0x5E19EA2BF8704350, 0x7AF73D53CB4B371A, 0x89F37C136C28427A, 0xBEBD0EB88B2D611F, 
-0x21B4C39CBFD5FC09, 0xD90CE48B82487BF9, 0xAD71BEBDF65D9E37, 0x6697471C99B7F823, 
-0x5F053F4248761783, 0x109112827, 0x1473F280245A0F40, 0x834230C5699D700C, 
-0xD6E43232D458D343, 0x3D284044E32EC317, 0x78C4346714ECE44F, 0xAF65ACD85EE2EC16, 
-0xFEBB7A12B2D0266D, 0xF86E30ADE2FF1518, 0xEC13BC5BC2FFF97E, 0xA9B8F771, 
-0x83FA55FA277F3130, 0x7DEDD4ADC6D70FC5, 0xA58E83F9E7762321, 0x6DC0BD4FCD6D2273, 
-0x1BEC4E370DF9FBE0, 0x9A6DBE0F3F92FB82, 0x70BE19C9A4993E50, 0xC1DE785587E4BECF, 
-0xC2CFAF68C501C6A5, 0xE96BC3BC, 
-0xD6DE260749128BE2, 0xEF54F07534BE04F5, 0xE3F65FC9B864D5C1, 0xAD1409541018964C, 
-0xEBAC9279E295362E, 0x6EA42D98F4F885DA, 0xF079D2A906FA9690, 0x25D7C3D291676846, 
-0x27D106430D6890C7, 0x1941A80BA, 0x46A18C0024A82FD0, 0xD25E0214D54B6EDE, 
-0xBE90CAC2882AE1C5, 0x717B5D95E91F8AC, 0xF9152BDBF724A193, 0xDAB7566105EB7C1A, 
-0x4B10C202608F58EC, 0xEF9F0F0D6711CDF6, 0x3F8997B2B36385F, 0x130B0C8F0, 
-0xEFC5106381260802, 0x6B6D01043C3EFA33, 0xBA662BF37CF61169, 0x529CBCB0186B33B5, 
-0xCEC5378F28FC5CB7, 0x607739769431665, 0x1B3FF4DFB05E9434, 0xFBF1BDBD45559FB, 
-0xB58932E5489F2D64, 0x1847B5CA1, 
-0x3BCA48D9A7FD248, 0xFE99D92CD6A7E87B, 0xEAB61166AABEC612, 0x3901DE1DB32778C6, 
-0x2D61D8FDA86116B2, 0xB62710CA0C3D60C3, 0x39B68862F05EF8D, 0x7E678448DAC79D6D, 
-0x56517B2CBA17827, 0xCE71A741, 0xA895FE550F882736, 0x922F2E1B43893341, 
-0x2B605EDFE9419C99, 0x1A03EB420C6A7065, 0x382C0816BEE1324B, 0xB131D67C013A1314, 
-0x36A7DE07297CF895, 0x84C99402D8E4D799, 0xE0B5AE5750293B18, 0x138C09D88, 
-0xFD73A0EA2C229271, 0x8204078D941DAA0C, 0xFB19AFF9ADD39063, 0xFD2C9894B0276E1B, 
-0x73E26ED7EF4F2F14, 0x44510D98DBD0969B, 0x46973A8E80124497, 0x19CAA697FD529D9B, 
-0x9DED96AFB0D7D138, 0x250653680, 
-0x14078F8CEAAC1D74, 0x57FB45616DF0EACB, 0x6EB091955270B202, 0x6C8439DB177FAD12, 
-0x8C490BC74499AD60, 0x19FCC4475E350E75, 0xB848C9643DCB2E98, 0xF11BEA65DD57599F, 
-0xB1337E2473934CE9, 0x22EA554E1, 0x8BA89E312DA3D14C, 0xDE3343494FF9F94A, 
-0x4762EE354A884BFF, 0xA3FCA5DA187CFE52, 0x7CB04720F428D5A6, 0xB80D421DF99A1BA, 
-0x1CF43FE15AF64422, 0xA95C7A7DF0BB209, 0x29E6B7B9B8CEDC24, 0x20BD34A02, 
-0xAD1303E6CF080ED0, 0xFCC224CE1459C58, 0xC5A87DA1B02DCB57, 0xDB7F292E0928E93B, 
-0x94315E9CE6A29277, 0x9E1DAC6ADECBB8C, 0x93D44E6F94D52172, 0x43FAD7AC3CFA5024, 
-0x211B61A18E950792, 0xAEC2428, 
-0x41A1C98F4BFF6B40, 0xA64AD9D27A5E4F1B, 0x9832B6690E789AC, 0x59423AA014174546, 
-0x2D58BF28A6ED248, 0x72281082B75BE5AE, 0x806767262713D0E3, 0x701C281A1BECFC7A, 
-0x836E98E24128744C, 0x116B2D1AF, 0xAF214B65DAC67E85, 0x1A8B751214824E76, 
-0x5DDA1965AF4826A, 0x2B580863DB5F2CB3, 0x74F001FEFC07F1A7, 0xF2293CC975F99AAA, 
-0x6F3A105FC633ACBC, 0x5A8CB2A3206285E8, 0xB2D38CBD1198433A, 0x6F50757A, 
-0x67B250079CE999D4, 0x63206F2D7013CA06, 0x3CA1DB9F0B3AB0B5, 0x128956E6F5DFD28C, 
-0xF307EAA1EAAF817D, 0x534A1FEB0AB9E57C, 0x5EB3AA97F616BB20, 0xDA3487FA3073940A, 
-0x23F237A4CEAF3DC6, 0x4271ED9F, 
-0x4F7283699AFA8E1D, 0xBC0E73FFF43AF9BA, 0xC187EFF70B49DB4E, 0xE2821990BF585F19, 
-0xF05AD9CF27A567DF, 0x6F0008E2FF5073C2, 0xA1327BB089EC8C90, 0xAC0E18787512B78C, 
-0x34C1F08778D5210, 0x169CB4B15, 0x9C8583935725F515, 0x8AC9D856356FED0E, 
-0x4496767E7B1AADAB, 0x268A34D346CA334F, 0x427C2903B8E6BB80, 0x80371734724E6487, 
-0x205EBAA0BEFBBB37, 0x5C897204003560BF, 0x968925177759E971, 0xC056C385, 
-0xED096FCCA88DF15E, 0x633176A3210D4350, 0xD0AED01A04316B52, 0x2D5EA684A119A304, 
-0xC0A70EF6FC8AF38D, 0x7618C1092EB8D696, 0x97429EDBD9961870, 0x7EE3202A2A9D3F2F, 
-0xFF928610E756F4C8, 0x2383C3DF5, 
-0xC1AE3D5838DA0105, 0x2BFD42685AAAB514, 0x981347626C7B3763, 0x4A288DEC22865D04, 
-0x510306D8EC93FDD0, 0x21CAD0B97659BDC5, 0x50AB531CA0A6422, 0x592BD1CCA786A1CC, 
-0xAB537571BE32578B, 0x20EDC616F, 0x74959BAE46EABF28, 0x6DE438B9550546E6, 
-0xC6454E1542B5C532, 0x6A8B183C14A2BFB8, 0x14D55D0CBD386FEE, 0x355C1B943B956E82, 
-0xBBA9BAB48A6B21A1, 0x6D6523C94263C452, 0x83697CB3311A7A78, 0x18839A93, 
-0xD1F8982C25019173, 0xD1D0D0D4B9C797CC, 0x3DB8F68081ADE8B4, 0x1F62B50D35217BA4, 
-0x5CFC2CD9EE4C8BEF, 0x87CD08CB1D49FA23, 0x91C95B6C39BCF45D, 0x9749FB45F86572DF, 
-0x4C30B2E874AD8477, 0x3CCE134D, 
-0x37AFD6B5C3A00249, 0x28529D0672C63D20, 0x2A8C9A9EA095EF5A, 0xD44990EC63E0B959, 
-0xB3506541019ED404, 0x5234F1C9FAEF1EE2, 0xCFDC9A3D8329ED21, 0x5772C643744D5688, 
-0x1BB33649A2E6323E, 0x1902C459F, 0xFF2B40023FB4D73B, 0x5EA261EE1F702E37, 
-0xC6F7AC2B7B649931, 0x85FEC6F7DFAC4349, 0xD8B854C93E5EB31F, 0x325B1B055D4F1C95, 
-0xEC2032FC2A975897, 0x5B4D194ABC73D165, 0x242E726F8B06E80C, 0x1288EC7F8, 
-0x1F79197069F9D6E6, 0x23BEC01F30E4D3A8, 0x5A5B0EBB7CB63767, 0x44AC044CF1F3BE91, 
-0xB13F030A1B0BD036, 0xB4485E564BEC830F, 0xBE307335E5DABC12, 0xB0547B387589268D, 
-0x5B32AF0D3AE266CE, 0x4B4A4A9, 
-0x690E420478064B77, 0x97ECC4B3EAB9BBBB, 0x84ED223DA69C3CBC, 0xF8AD4F600957D332, 
-0x756873B097E340C6, 0xBD785A9A8943906B, 0x241401321172E122, 0x8233DC6338AB0F5F, 
-0xBD23E85AF82F6B82, 0x1417B8885, 0xBF528B6556ACC9C2, 0x11D82B32C4F1E1CE, 
-0x8EDDCE54B875EB85, 0xCD5AC5549DE6774F, 0x8012376D661C0233, 0xB2A6807879282BC2, 
-0x35C584701AB0D0C3, 0x9A72DAEB04522A08, 0x6C382138740ACC74, 0x1F30CFA10, 
-0x33720AE822AA3437, 0x18F19798EBAEF856, 0x3587434050400465, 0x7D4358C4E960ABFB, 
-0x5A23B6F8486E0C76, 0xCFEC8E26BDFDDA49, 0x2EC9A911BB036C9B, 0xAE1DB182AAF02B66, 
-0x58960FC7E6B5BF55, 0x1B5C21B93, 
-0xBAA762886E542212, 0x9A67C43297759E9D, 0x54B238520E0B8E5B, 0x4779A2BAB6F36D74, 
-0x36D6B7E1EB6CDC27, 0x4B73F1E438A77BD5, 0x4B38B95992CF35C8, 0x54E65B22597294F, 
-0xBAF35FC0F940BA54, 0x23322A630, 0x25AE53FF2FC895C9, 0x394CD24BC011D04C, 
-0x68C7923333618D32, 0x4C39AE8B1A415E6C, 0x2949C2A1622B00FD, 0x6C940C06193A41C3, 
-0x7E76920FB278EFD3, 0x3D476C8E6B5E1F68, 0x9357BE8F5424AC64, 0xA7906061, 
-0x7FCBD8A3F5C53FEB, 0x5D1CCE65736F7930, 0xF2DB73FE9F8A6D90, 0x77AFB6BA905403A6, 
-0x3A39F5066E2AFDA0, 0x7B1F9468FB94C0F, 0x44091BC816EF9659, 0xE56C2948B6AC2BAF, 
-0x759EC6BBA01C2357, 0x521F8BBF, 
-0x3BC54C4AB52C2EEE, 0xBBE77D66D4AF6463, 0x4AC7FEBBF7F13865, 0x84848C5C0BD7A841, 
-0xF7C90D9F4145B93A, 0x38E5EDF08134B5AE, 0x2FC07B763B9E8D47, 0x9A87BCA09B210A22, 
-0x474C59A0BD25EEA5, 0x23A05E991, 0xE2D7606E56DFB649, 0xF6550ADCA118E735, 
-0x1556D04BA961AD87, 0x8CD3585E85DE678, 0xD3275B8773DBDBB7, 0x19910AD6FD7C1236, 
-0x5F4C631F5B7EB661, 0xCA9A92F74548EDCB, 0xBE8A46672F049E8B, 0x198990CBF, 
-0x94CC6E6E06C3D2A2, 0x33016E1FF4FB3483, 0x4E3AD39E0959501, 0x45AFA87B26FDB108, 
-0x5E0BC60503904AFD, 0x3D0DE8E83F1B22F7, 0x6527587332098DA7, 0x227F1568E943271B, 
-0x1FEF1E2F8F895DF, 0xBF40E10, 
-0x99EDF393E4C71817, 0xE530D1FFCEE4C474, 0xCC798DA5ECA35A1, 0x9862D3493E4263AA, 
-0xE88975BB889B3094, 0x467106576BC96B88, 0xD879AC8D36EFC6AD, 0x4D08F50B06B08938, 
-0x80D70B21921847, 0x2FBEAF54, 0x1E33FA11B86F7E4F, 0x39F77BDF4D09A43F, 
-0xCB2CEC66F228F804, 0xEAA073586598E94, 0x7BB3534C044FB347, 0x85D56B2ED809B3F9, 
-0x5D3C325F624EBCED, 0xD66F988E6A2011A6, 0x739F737CCD3E8251, 0x1F7BC1303, 
-0xE9474F0D094E338B, 0x7ECBC0772EA5C4E8, 0xC7FCF57112BD5564, 0x7A16739DF431E525, 
-0x39CC576578B8F8CC, 0x71C868E03AE02329, 0xAE80182583E2069E, 0x6F350E0500205DD9, 
-0xC07BA8F56412212A, 0x718AD93E, 
-0x95310638D630FCAC, 0xBAE868443542E59A, 0x3DA32D2DD3A12B83, 0x4C000DC24DD610DA, 
-0x6A9AF3FD34D28A2B, 0xA5CD4F8671BC63E4, 0x12F1644B15CCF928, 0x2FFA273A29C6AFB5, 
-0x9752C26F0502AE17, 0x2C551E89, 0xE2D1D857874BD9F7, 0x25DE821E70B830F5, 
-0xA51510C7A47A771F, 0x843D33560052CC83, 0xF4A6BB84BC885AB7, 0x961523351317E70E, 
-0x4B4A9F6A8A55668B, 0xA52727186A75090E, 0x63F889906B91EFCD, 0x13A9A3A6E, 
-0xF5D0B5B7668AF60D, 0xDFE89219EB178345, 0x8C5B1E93BD7D7242, 0x23F49FBABAD3366B, 
-0x72CDA863D8114BC, 0xE763F588FB3A03ED, 0xE83C114BB337D628, 0xD60511DA41D4C118, 
-0xC8DBFEDCA080B914, 0xD589485F, 
-0x41E0D021F85633A5, 0xBFF9CB171EDBCEEB, 0x4A1D1B441E1D7A88, 0x7110D599FA345D08, 
-0x585F03C8808771DF, 0x7970C68CB1A92EBA, 0x53CAFB76B3194801, 0xBD8E120B96BBA008, 
-0x80A87B1AE06DAE6, 0x1FA99B4EF, 0xC099AC9E877CB81B, 0x1CE5BD3934AD8E48, 
-0xAFB433C946B4623B, 0x9BD6A6E89723149D, 0xF0853C7D444F76E0, 0x399FB6293EEAFF4A, 
-0x1BAD89450DEC50AF, 0xBB63E5C9947717CA, 0xA285E8C5DA31C8AE, 0x1575DBFB9, 
-0x5A068DC63864C21B, 0x2498EF93964EFBFE, 0x2EB76AD8C613ACC0, 0x2921D9234F483550, 
-0xBEA63C33F2959029, 0xA6E1D838A78EBB6, 0x8A9172A73D477B3B, 0xDC678291B44D4E1D, 
-0xAB4F2F43B472C0DE, 0x37B6CDB3, 
-0xE2E79E636D2E41E0, 0xBAAA6BB6FCA3AA14, 0x5D93AC86807EC92D, 0xE41738B0D6559E1B, 
-0xE36B3D978AF7D756, 0x98242CCDF076A130, 0x91218D701BBD1498, 0x94D7F76805F960C5, 
-0xD0DEB417BE4C840B, 0xB66DA491, 0x8885B5759541FBAA, 0xB9DB2828EC528353, 
-0xE23BF41BD520732F, 0x4AB4B8E55D208D29, 0xD2FA2C40D5173F8B, 0x8709DB383DFCD2C3, 
-0x7B3A8B2486152EB3, 0xA78E9D73033174DE, 0xE7E630D915CDA0D7, 0x2424A3788, 
-0xAD8B89D5CD9755BF, 0x8599B046DB6F6ED2, 0xF7F8E75DDB032173, 0x2CFF3384496FF37B, 
-0x8AAB6640FBDF3DBB, 0x4AF07F58B0EFD18C, 0x5036EF90E0D95E82, 0x1577C28EA2178078, 
-0x9D15004D682EDC18, 0x1C6942ED2, 
-0x685F60038073712C, 0x30DECA815D696128, 0x809FB05720540728, 0xC0EE283E878F607, 
-0x45AB9DED76CF14C3, 0xFD45239699D241C4, 0xBF90E5BF576A169D, 0x8527AB18F383576A, 
-0x7D3165DB3AAF9B06, 0x118FB0737, 0x238A4C695CE3CCE1, 0xE5BED5243F74D30C, 
-0x3FBA5878AE3706BB, 0xE92D585BE7B7F338, 0x3193E901D297DB5B, 0x5C3380F0781F6FCB, 
-0xF7798C9EC22B2A96, 0xC3321E10161CE095, 0xE8CE38DB818BE8D6, 0x1D6D87130, 
-0x678779B9ED62DBD6, 0x6C494D14D5CD9EC, 0xAEFFBA87C7C6B37, 0x629BAF9ADFD2A6F9, 
-0x8FFEFA7CA6FC265C, 0xA80CBE8B3B74DBD3, 0xA136C5A42DB8C558, 0x90E82BF9461BD82C, 
-0xC8D7738C5B37F96D, 0x54688761, 
-0x848FD81FBC66F687, 0x45AEE6307528427F, 0xC6E337E6F65E9D02, 0xEC76329EC4140362, 
-0xCA2BBB4DFAF9F56D, 0x14A13482D2EB843F, 0xC306F41B6D275246, 0x54D45CFC2C383023, 
-0xE6C7AD5525267BA5, 0x19B20939E, 0x2E3907C85E97CD77, 0x1F1AEB936D1BE009, 
-0x3A31FB4F526AB500, 0xE8C9F881C7225CC8, 0xB5A4F166D6BE1333, 0x954C74E9887C2F3B, 
-0xE8B9F16EE4ED8A00, 0x35CCCFA2D0115819, 0xDBC4A1A17C9412B, 0x14C57327A, 
-0x74468A3869B2C6CC, 0x465FDBEBD10E8F4B, 0xEED50288A0254AD5, 0x252DBD61E6EBFA7C, 
-0x80A837538167EE72, 0x39D156861C429774, 0x214AAEF8B9933E41, 0xEE1B4C39530DDC5F, 
-0x354FB962C2B2D9B1, 0x17BD8794, 
-0x8C78CC9E7B775226, 0x82CA3253BCF347A, 0x8B396D7676A56C95, 0x944442601B7FF309, 
-0xF9604BDFA91C78FE, 0x4D86F519B9F7177B, 0x83A573B72D12995E, 0xA529D788AC1BC96D, 
-0x7FC3E9B28A5EB473, 0x184198A07, 0xF24B0ADBE96B8353, 0x572196F09D42F6A8, 
-0x508F26150BFFB60, 0x3C514EF20C94F864, 0x5E1316F91527505F, 0x803912E28C6622CD, 
-0xFEE71C547F709FEF, 0x7B912F9E3AEB2B38, 0xF49350D5F936F02, 0x4E10BFD2, 
-0x979FED35DAEBF12D, 0x4A9D862498359A15, 0xCA8703843A87DA82, 0x8B92AABEC7FC6FD1, 
-0xD1F5106A59AB7C66, 0xFEF72A2758F3736F, 0x107BFDD168860552, 0x4A20EDA59E464628, 
-0x4551E0E3545E9FFD, 0x22E3A88BE, 
-0x147C0926B7F92045, 0xF1145B4BF244B4D3, 0x8F285BD34409E26C, 0x5C174813FEB92AFD, 
-0x873B57262527209D, 0x951B5EA5DB359A25, 0x5A4BE2D2D1CD6A7A, 0x1232A4E35493B98F, 
-0x1F7E4199FCE3E490, 0x254D9D0AE, 0xF0F6DFCAF14F5F41, 0x930A9903E6844050, 
-0xB0B4117F4616D3AA, 0xEDB0EEDC81FDB8C, 0xC35666A3935575B0, 0xB79876A79636A0F4, 
-0x2D3ED0632053DEDF, 0xC0F241F436DDE009, 0x46EDFB26DF5E3C11, 0x718D83BF, 
-0x6924BE882548B6D7, 0x71F78EEA22AE04A1, 0x6AEC2E2E8D96A340, 0x37CF80BF95E5EF55, 
-0xC1395647075108A, 0x10DCD163E639A0D8, 0x15528A9D56133029, 0xF5BDDB38897A73A6, 
-0xA609B98D72625328, 0xEA8BB793, 
-0x89C0B4B8F0A01554, 0x1F9EA9B69F9E63D4, 0x8D932A4C860DD86F, 0x5968A5A951B983C3, 
-0x2D2DD9F07FC910C5, 0x8BBA74DD91E75104, 0x7472CA8CBB5DB2CE, 0x22B326D8586908B6, 
-0xB81BF8E3B25B65AE, 0x176E961ED, 0x333A34E1301B40B5, 0x1BB2513845CA4F0C, 
-0xF635E4F591DFDD56, 0x84CC7336034AF933, 0xD38EE04BD058ECE, 0xEBAA09180D07A2AE, 
-0x8DE71D9200476884, 0x5CCC8F7293906EC9, 0x3085E63E2DD772E5, 0x1B1E33F84, 
-0x7EBB1EC7415F617D, 0xDD73DD3D0A4FBE49, 0xE2BC0CC1525A86AE, 0x55AC7973C7863903, 
-0xF5A6E09E75C60001, 0x6543556D1E9E2A1F, 0xCD6EBD58C5E21576, 0x688BD93F12F0FDB0, 
-0xB89E2BB8FC114267, 0x1632A7C6E, 
-0x8539CA00CC2DC8CA, 0xB6982BF1E2D7D332, 0x62BCBE33FB37E340, 0xABB01AA6E5D6F583, 
-0x3DF4208B38532FD5, 0x9D3426D32EA22C99, 0x59C3AF86EA5F61DA, 0x8FB844DE4F964BE9, 
-0xCD940D0F4F29EACD, 0x21C17BA56, 0x265663A3F08672B5, 0x5892C03E5CD632E5, 
-0xC376318402058EFD, 0xB9C235341D911395, 0x30F650C9E6D536CD, 0x5BABB4427F5681E7, 
-0x96BFADCE12657CED, 0x6767889270A6EB2A, 0xAD97AA23FEEB7487, 0x27BD23E49, 
-0x5C88B14AD355FDF9, 0x102B4A6DA8BBF20E, 0x629CCB6546BC1BDA, 0xEB9682B9C403F730, 
-0x539A7B26DBC7192C, 0x437BF91E4EFA145A, 0x98D1DA3D1EE47E30, 0xE72603EA7C759BFF, 
-0x324CE288510BF488, 0xB8F055B8, 
-0x368D48E2A6488CD1, 0xC75A35EB1A53ECF8, 0x6F2AC698072F414E, 0xF825967E5DAEFABF, 
-0x9CD75FB0856CE904, 0x5BFD0087A93B9AE7, 0xCFC2A56C73805F0E, 0x1D5CF98C0BCC76C0, 
-0x281114D7E4310D94, 0x1E29DD909, 0x409FCEBD06828DF8, 0x4F9DEC394E4D79CF, 
-0x15D1E906A94404D4, 0x9B4B5806A5D0BBC1, 0xFF3CFB3CD4AB0BFD, 0x697DE0B6271E92D2, 
-0x2CFA42880054E908, 0xBF82951E5E6A409A, 0xD5E14FC14677DACD, 0xE2A30CE2, 
-0xF7058A61AA76B014, 0xB0B0542ED47F821C, 0x8FF8DC08740BC45D, 0xF899FD840F941C54, 
-0x8E9B50C05B2C5E5E, 0x2EB12424A79BE3E0, 0x63B22EB14BB2EA30, 0x4BDE7951E4552104, 
-0x8C56D5DDC51F8F36, 0xDC82A900, 
-0x5D00E8299FD42B11, 0x95872533E484FB92, 0x9EA31EA314B34ADB, 0x3CEC9BB6C1EB06D, 
-0x3963181410E93957, 0xC0BC826212BDE6AB, 0x3BD1602322527B88, 0x746A993E26E421EC, 
-0x62DEDA47A3B76867, 0xBD3E7BDB, 0x139C38065C9A4485, 0xDF637AF2397CB70A, 
-0x504067477577C777, 0x9BC29E9C4364BFA1, 0x62804166CB6B622B, 0xD683D263A7C8CBEA, 
-0x1F38C3241525EB7C, 0x153817B051F88DFA, 0x721BE8216FBF1A4E, 0x132644D3B, 
-0x9381E383C203E5DA, 0xEB15B3A7C707A9EE, 0x31D2337AF7DB510D, 0xE4FC64520B6C49EB, 
-0xF4E14CDEDAE4EA87, 0x6F7DC209E243E7D3, 0xFC5D3E706F193D3, 0x19D3C02647A98C2E, 
-0x74DB49B73CF3DE0C, 0x1B50C95C0, 
-0xFE80C3DD8C3B3F2F, 0x276B9A1BEECD4997, 0x7F1759E98A5161F8, 0xD9C920AFD6D776AE, 
-0x75D43C97E3FC0BFA, 0xD647FFC56F3D16D4, 0xD66CD23919E64D41, 0xF9252E299BF5251, 
-0x80147DDB39F2C2F9, 0x56B01EE5, 0xC9DB9F366BA56917, 0x6972E77AF302C871, 
-0x112B76C670CB63F8, 0xDA63973885581425, 0x11A116A64B8CEA6C, 0xFE73886F51D39DBF, 
-0x2B8EC42B2B18E246, 0x45C2B3264387DD4F, 0x3736F7E250F5992D, 0x1F7C38A2B, 
-0xAB72F6C16BCE9F4A, 0xF00B64EA8A20A890, 0xC0869FB8570C759F, 0x9CEFCB7B8747D6CC, 
-0xD49456CB73309B67, 0xE8943F9A6C3A469F, 0x52384739DF9D0D8F, 0x1E6A758666F266E1, 
-0x26CD80E765C44522, 0x17930E828, 
-0xE24AC6894A3DF65, 0x847CA39ABDE25B64, 0xAE12ADBF5AE1C557, 0x568C5F1B34D44333, 
-0xFF69DD3D947D212B, 0xCC1B65C9E0DE79FE, 0xC6D2CBE56120285B, 0x91E34E1A4BE1B2FA, 
-0x43C0D0E9D2DF34FD, 0x330D4801, 0x68A36A59C170649, 0xE1F67981D83370ED, 
-0xF05111437CE7932E, 0x6374CBF66A05210F, 0x2DDD9EF76315CEF3, 0x4DBFC7B75F7064C3, 
-0xE18C0876DB3F2B07, 0x522047D95863E146, 0x722B019338B6C563, 0x147E94CF8, 
-0x96D296B2EE58DAEE, 0x543E53697867F047, 0xD41FFA3C5AB47782, 0xEA60EB9C60B3D847, 
-0xB5AD9222B63CF9F4, 0x15AE3F0BF852A292, 0xA1114DF164CFE245, 0x4AA7C5DCD7A29673, 
-0x33A0D8861106174B, 0x179DDB064, 
-0xC45D47A02B496C12, 0xD81F798B123FF502, 0xA517AD9A5E88B983, 0x64E120C7D2901F63, 
-0x7B3C24B920A51CDC, 0xD69E68F37CAAF20F, 0xFE7F92C81083953B, 0xDC3D264D0F322C1E, 
-0xDB44819FF1B3FA57, 0x1642F1652, 0x65F6171EBA0117CC, 0x56F932B537F2C36E, 
-0xA958FA0019A62247, 0x891AC372ECD943EC, 0x118CD633368415DB, 0x777247783F4CAFBB, 
-0xA4E28C72B75E1F1A, 0xB16F742C0D404A55, 0x657B1E87104A2601, 0x36DB712C, 
-0xE57866ECCB49C901, 0x7D0A6388C9784105, 0x82708F37EB1A297B, 0x837CA2EADA77D88A, 
-0xB60D853553FD3120, 0xC40DB523846C41D5, 0xF9E3E000AF3630FA, 0xB12015333D5FFB82, 
-0x39BF8CDEC44506F2, 0x8431869A, 
-0x2740EBA93E573F1D, 0xB8F549736C4D338E, 0x33E3C42795245E80, 0xC8A1047F84153AAA, 
-0xD20F6935DCBE9A9A, 0x33D9C90E542A3263, 0x3BD3D945C3E3E565, 0xA4F2451B504330F2, 
-0x1A73B8288973988, 0x23F48D00F, 0xEBA678A66B79D3AE, 0xFF711BD219109A3A, 
-0x6C0DFC67DFEC9EA0, 0xCB473FC42CFC8908, 0x110EB131DD4E0B53, 0x3957976C8925F477, 
-0x10B2FAA5157A109D, 0x8A9EC0DFDCD4026F, 0xBB1FA126F974D44, 0x1B8D4771, 
-0xED714FF38807F970, 0x35EC87B09C6142F5, 0xB27B54A69B16858, 0x98FC07C417C08457, 
-0xABB74EA096F92B71, 0x53D923D35371D6E8, 0xEC3900D2125F8264, 0x94481E2744B347E3, 
-0xCD9A1DF1B92E311F, 0x5DE809D9, 
-0xCD714811000DF7E9, 0xDDD2FEFBC0080819, 0x1D0E74018E58C0FA, 0xCC7687CC82E3764C, 
-0x49117C02FE715AD6, 0x2732F76E930CAA3C, 0x186C9AFBC2007CE4, 0xE0F47397E266B193, 
-0x79B2BF4AB078E042, 0x16E51D28B, 0x82F5B3D76A3434F1, 0xF59FCCBD7CB3A7EA, 
-0xAF48707549ADBEB9, 0xB82BE4D5431D372E, 0x9E6AE3C67D7D2DC4, 0x3B34FDFDBA5066F5, 
-0xAD0D794D3F5739BC, 0x9E552049F6B46C4F, 0x7E46C9368E87617, 0x18A8EF4B3, 
-0xE4AC79AD8C5856E8, 0x799CACC10C825B37, 0x9BDC30BE6CBE7082, 0x938D133D912A9853, 
-0xF71F12018182679, 0x2B6B95A070BCD81A, 0xA88036F16052F007, 0x58A66FA9F37E3F8C, 
-0x81A4E976C39DF4D9, 0x2DC9B88B, 
-0xA7109DE1C927BB2A, 0x308C5D190C04D526, 0x7EAE9FA6EB3862E7, 0xC3D7703EF66D4CD9, 
-0x9F99EAC99AC0D1A8, 0xAE498FE8A947619B, 0x2242F65B7BA11E6C, 0x44173A1739CA9073, 
-0x87A0599D516331D6, 0x138FBA5D3, 0x514117A88645E1C9, 0x68E440F56E55D434, 
-0x544CA6B41284EFB7, 0x4C119C554461BB9E, 0xF7A4FAF5465820E, 0xBD3158420C37D8B, 
-0xEB1EE6F7F4F2A631, 0x9AA9A881499840A8, 0x767A7E7C79D01A35, 0x1CA2DD385, 
-0xFC154253C5983415, 0x2743FD4FA2E16E5E, 0xBDE019ECC3AB369E, 0xE1B2085724A7AB44, 
-0xFADE1523A3583C10, 0xEE60FCAF940D49F3, 0x9D0EE4CA9D6946A7, 0xD6D12483326E4CDD, 
-0x7D33064C845B7ADE, 0x18930172D, 
-0x8A12754F5400999A, 0x19381C3B6FB8AFE1, 0x72C233072FBA3FC3, 0xCA865119FA53B7BD, 
-0x902978FD63A082B8, 0x3EEF694F2CB0E406, 0x316418FF4985400B, 0xFE3DC3B0CE152A3, 
-0xACE29E0348AB60C8, 0x21D47404F, 0xC089FA673CEBE8F, 0xDF102A088FB35950, 
-0x5438F85336618479, 0xB3423CC5C365F0FF, 0x964CC56558E2CC13, 0xBEC4B2A21CD9B3AE, 
-0x2131465766CB90D5, 0xF31E1078D646033E, 0x68CDD7B311908459, 0x21EDDF01, 
-0xED0AA2AFB8296C88, 0xD28E3DC27978117, 0xBEA6BFF1731DCE21, 0xC623FF82E130902D, 
-0xDF781EE441557E76, 0x4215F3048935BF4F, 0x1C2B3A08B0493504, 0x43DB746BE1022755, 
-0x63154CC8675F9AB4, 0x1201DDA9E, 
-0x397E71C549732F8D, 0x432AB7EF0D3F7058, 0x99CFE128A7B8077C, 0x53E9711BFF869847, 
-0x5CA75EC2D788F24B, 0xCAD7D2DE1380ECB8, 0xF60BEC594135855, 0x9A4853845BE3BA44, 
-0x70596A1FE238F0FE, 0x163DAF1F3, 0xF91682FD0AE57151, 0x71864A40941F0147, 
-0x4DC2D02D12014C82, 0x1F0C6C808DC47DF5, 0x4A243817000D63F9, 0xF194A1098F3272A4, 
-0xD6AFF11A5A628000, 0xB020C4A292B847AF, 0x4D685BB2BF1A1C82, 0x1B88AED8F, 
-0x2E60535F8A5B7E, 0x2600CF27A5610303, 0xC4D9850FB3CDFF62, 0x6C8539F3CF78D692, 
-0x8AAE044E0F39ACEF, 0x265E2F013C92CF68, 0x316CB1D49EEE36BD, 0x28C1D65058E94AD9, 
-0x9FE3969F80BCE9F7, 0x196053617, 
-0x435A4013E5CB2F20, 0xCCAFD73B5446292D, 0x74F742C0E2AFD734, 0x3A8EC0D583E53691, 
-0x97DC6E0E49216648, 0x7A8D4CB96E825B10, 0x487B7423B1EA38D6, 0xF31D84362D38D56E, 
-0x2D7077D2C0FEAC45, 0x235E50B94, 0xC3DE16CE72BFAAB1, 0xAA5C18169FBEC749, 
-0x22BDED92130EEA43, 0x9F1B8BEC77C70A4E, 0x377C0D42884CE2E3, 0x953DF8E72801C902, 
-0x41C0CFABCCBECCBA, 0x14847CE6AC5CD6DB, 0x63B3CCB896EB566D, 0x19DDC4646, 
-0x65893D0DEAAC5ADC, 0x31D5F1D6241AED98, 0xA76632A23402E29F, 0xAC9840DE40FBF3D0, 
-0xDAE6CC2A432D272E, 0x1C9457DEF6CBF304, 0x968BA09B666E5F9F, 0xF2B12EBAA8A17F7C, 
-0x9D5B1174B7ECDEB4, 0xD3BC3E37, 
-0xEC29A109DB15D3EA, 0x5F774EFCE982C2F3, 0x5F74E78E44B69AF, 0x120AFF25CC30DC39, 
-0xF71EE68F95F24CC5, 0x5579A3008FF44A2B, 0xDFDCC986EA4835AF, 0xC4755B7973B615EE, 
-0xD33F8E58C0E9DF80, 0x14199E4D, 0x4F00D2CC87C14F3E, 0xF4F8AB117823EA29, 
-0x622F0579400CFA7, 0xAF3DF19C6DD63E80, 0x83766903001E88FE, 0xEF42D6AFA2FDC67C, 
-0x4CFCD51EB134EB18, 0x760F71AF87AA908, 0x366F1045F162D131, 0x367AEF1D, 
-0xD16EB72180312CAC, 0x2252E11AE7460535, 0xE4EFEA0C922884DC, 0x8A6CC793EEC2EABC, 
-0x334DB3A40D63960B, 0x67F2EE5A9B7F7390, 0x4AB4AE8D2F5E1BEC, 0x79CEA82DA3C95932, 
-0xD06E05E29E0A5193, 0x1D5E13755, 
-0xDB22E7BAB36D65E8, 0xD5ADE73DF81EC28E, 0x7E8456E23AFF6B57, 0x87039DEC9700FBC0, 
-0xD727A7CF153F5BD9, 0xDAC9D28142709220, 0x555F2524643F9436, 0xFDF70592C3786A82, 
-0xC699791F21858C77, 0x7EEFD92, 0xAF2D3F1D38E1808B, 0xAB3F885D7EAC7F85, 
-0xF19265B7051D08E3, 0x97939D3E435A0F2C, 0x355E5409F340FB7E, 0xE11A830068D225A, 
-0x36BED4869D545BF7, 0x4B404B2257F118CE, 0x29193119E20A7797, 0x1AA067B9E, 
-0x7159368FCE435A63, 0x6FFEC6BF9BDA2368, 0x92254F42DFCAE57F, 0x163CE418E38E010C, 
-0x1E9969AFC3622FE9, 0xDADFEC9F08BA1D64, 0x25674CDB31355E3, 0x95D009BE0FAC417C, 
-0x85CD7D9FCAEE2F58, 0x10E5BA14D, 
-0x346C217C9CD60CD6, 0xCD0A4DB898461F8A, 0x3CAF1893582D1452, 0xC075F8E13E1C0CFB, 
-0xD3CBB8B006725B61, 0xBDBE17769177CA69, 0x36FD2081A9F890C5, 0x8CC9A9337F76CBF1, 
-0xBCFD4BBFFC7010B0, 0x1AF7FEC68, 0xB51D21A91292CDBA, 0x5A555FD766E4E4D8, 
-0xD073E7173901A297, 0x5D983AF03F4E3BA8, 0x8D2FA9E21491C71A, 0x6D5BFD445C746393, 
-0xBE299B1842C32898, 0xB7AEB7F1624CFB4, 0x18AF8D3BAFFF114, 0x14B58DF3E, 
-0x6C815F35B76FAFFF, 0x3FDFE1EEB5ECD35D, 0x9EA7B38236A05832, 0xFC3F27B815209582, 
-0xC36FCB720A6CCE7E, 0x48DBC68F9DB9B3D9, 0x1F8BB18893E673E4, 0xCC168CAF349F6EDC, 
-0xBDC16DBDA0E8DC2, 0x15BE82603, 
-0x3E7D0E31F54C3F3E, 0xC48A8FB59B9DDC39, 0xB9E84DB3D80F8953, 0x6B51302E99F1F671, 
-0xF400D562824DAA52, 0x7FECB24E0BAECE7, 0xF4854A22E9AC3280, 0x61CFFA674730826C, 
-0xA2572E0492406265, 0x125904822, 0x8298517958F7FF6A, 0x3BABACACE64F52D6, 
-0x972AAAF9CDF60C7E, 0xF7B319002A629698, 0xF1722C0BCE4599FA, 0x571388E70E98D9C2, 
-0xAE998EEE5F038A40, 0xCA3DCC0420F9A776, 0xC25878C6D94B56F1, 0x62908803, 
-0x1B1C43947C0D17E2, 0x3D44D4102C255E6D, 0x338FAD79A03AD351, 0x6469718AF7978FAB, 
-0x27446F867C62DD31, 0x79FB8E5F3790FAB, 0xE0CA7C68BBE677A2, 0xF40BF98377D60B41, 
-0xB6CC0D62B1A18207, 0xC5CE2A3D, 
-0x486DB287C2F370C5, 0x1C2AE6A84E04475A, 0xEC4E2893ABABAF1E, 0xF9BB7FEA0043D08F, 
-0x2D8E75A853E0C0D6, 0x3592999166259FDC, 0xCA252D865D128B25, 0xFE08F58A6E46CD04, 
-0x4F57C6C4C02B78CB, 0x1B5BCF85, 0x7665C2CC49DD73A2, 0x79B317BFFFD9DC99, 
-0x6378466A4AD19478, 0x378AA5D21A69910, 0x12F9733C6A382B66, 0x22DA5048F012598A, 
-0xD3D462C668FF936C, 0x131E0B76E60C0D64, 0xACE81437F98D20C, 0x1D8F79E0A, 
-0x7D9C4A63143D6EB3, 0x5FF5B5E4125A5CBD, 0x30E26C0212353A3E, 0x48E2E20A7134749C, 
-0xF25CC02C2EC854B3, 0xA6C249E0E2404213, 0x4956B072A5D6C1B2, 0x529B212947D3BCD0, 
-0xE5421CD7FDE252C0, 0x1667FC8CE, 
-0xAF4153F6AEB6BC09, 0xC781C8DF4C260895, 0x1430B38E81A6D386, 0x178FB186EFB1A72, 
-0x7E3DEA164E9EC0E2, 0xF647FF1E7DD2273B, 0xB7B0A9F6C909CBC1, 0xFCCEE194AAFB7A09, 
-0x90E0F43281114383, 0x9325776F, 0x9AB054BC84A483BE, 0x2085EC547152A253, 
-0x6394952D6A784686, 0x1118D146DAA43EF7, 0xC8EF6A8FC65A7767, 0xACB115F5A8B68C27, 
-0x4D3EA047479F810A, 0xD64AE74ECA5167EA, 0xE7AA45BD3F864452, 0x258B4BA6D, 
-0x48A933F87C4FC4E6, 0xA695E5B0A58DA22C, 0x3C02770D65785BAD, 0x935035D748936F53, 
-0xE7E6066665363FDC, 0x4AA6A2565A2AA2B6, 0xAA0519430B39017B, 0xEDDA470F93340CB2, 
-0x4A663DC53EBFA7C3, 0x30EB2C22, 
-0x2DAA234D150B5F25, 0x6A0BF7BCE763950B, 0x39DDC826FBBC3C15, 0xC0B037E5BCBC4A39, 
-0xD0DCF7741936C443, 0x358EE5075685B230, 0xE9B419009F8C7E86, 0x1A86CE44EF95EDBC, 
-0xFEC5A8A3F2F03322, 0x17005902B, 0x7854473CB7189F8D, 0xBF417B7F84CDE35E, 
-0xE29B9BEE1CC87691, 0x7A0CC6AA5E4A3B6C, 0xCAC569F3D7BF90CF, 0x8BFED5D908BABD39, 
-0xB1AEE458F77B3B6E, 0x75488443441A675F, 0x42558989DE40DF68, 0x234A4A392, 
-0x3BA49548331AD539, 0xD176FC2DEB3637E2, 0xDD11E0D59ABFC30F, 0xCEB09AFBED0D4F41, 
-0x9C561B3A64BCA0B6, 0xE2B8A4F28FE9FA2C, 0xCD0E79D5C9BB6510, 0x45FB81F5C643F66A, 
-0xB84C52C98B281460, 0x45EEC506, 
-0x135265AB3, 0x0, 0x0, 0x0, 0x609A000000000000, 0x3754FA4ECEF9BE90, 
-0x83F68967E4DB82A9, 0xC5CCB347607C507B, 0xB8AAF689409E352C, 0x9DC814C3, 
-0x67205E1B881D075, 0x894BB12AFE2FBCAD, 0xE7C2B8FF7C89A4A4, 0x3CCB5C538771A30E, 
-0x472E884966422A98, 0xCE478A13952D16FE, 0x97E302EDADBD26DA, 0x514EEB8A7ED09CDB, 
-0xCE48CDA905F9FB56, 0xE0BFA119, 0xCBE3D6D2008C6231, 0xCA857181A6CAE47, 
-0xDE5F7ED987BA1F46, 0x2846BC6BBD212B7, 0x8A5E804280871124, 0x48D564480F8ADB7E, 
-0x2DE4D3C9FD8DFC83, 0xEBEC3D5643333E56, 0xDB539F526557088F, 0x23C5B48EA, 
-0xCE1991CC, 0x0, 0x0, 0x0, 0x3468000000000000, 0x9B33857A50E2F47F, 
-0x149430734647A838, 0xA56C442BA0D5A3C4, 0x26D204DD0C595E7B, 0x21129D2C8, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67205E1B881D075, 
-0x894BB12AFE2FBCAD, 0xE7C2B8FF7C89A4A4, 0x3CCB5C538771A30E, 0x472E884966422A98, 
-0xCE478A13952D16FE, 0x97E302EDADBD26DA, 0x514EEB8A7ED09CDB, 0xCE48CDA905F9FB56, 
-0xE0BFA119
-};
-
@@ -1,11018 +0,0 @@
-/**************************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: precomputed tables for pairing computation on E0: y^2 = x^3 + x when using compression
-***************************************************************************************************/  
-
-
-// T_tate3 contains 6*(eB-1)+4 elements from Fp. There are (eB-1) 6-tuples (l1,l2,n1,n2,x23,x2p3), each corresponding to a single step in the Miller loop. 
-// The values l1 and l2 are the slopes of the doubling and point addition to compute the tripling, n1 and n2 are coefficients of the corresponding lines and 
-// x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
-// precomputed values.
-
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
-0x27DD15B8A940103C, 0x698445579C6FC8AF, 0xEF0662EE3F8DA506, 0x93D4F81B06781F60, 
-0xC74371742E7C108A, 0x3101E9FA3DF1F2D, 0xF5326D30834BAB52, 0xCC65719BBE7A0F07, 
-0xDDE26695C63C52A9, 0x5EF3096F1CC1375B, 0xC294077DF435C984, 0x82F3986076B, 
-0x3473C9FA7E5404DB, 0x4F95A1FB1D629EA5, 0x712BEDC72A682C10, 0x1DD108940590DB2D, 
-0x88BFC71946DE8BEF, 0xE41ADDF572557D71, 0x7552B158479D3FFF, 0x99E1BB53518B911B, 
-0xAA15601D2EA66BDF, 0x3BB21CBAC6C72B06, 0x5AFDB90E6F37C129, 0xAD8B9D22E50, 
-0x1D03B8B14750F050, 0x1545B963A3FBD292, 0xABF9110C1B06DEDE, 0x3FDFF9C8BD2736B6, 
-0x98C7049844B874A5, 0xAE5AB4D180ACDFF2, 0xB2B03879747E80D1, 0x466061A914E71020, 
-0xEF39255AB2765772, 0xF44DAF12BF260DAA, 0x63A33411506608DD, 0x35F8D0942C29, 
-0x4C41EF1D22E3730F, 0x68090B20EA18192E, 0x935C391908CFEB88, 0x907417F890C3D4A7, 
-0x62730A7D330A3A4, 0xA7E28590A7B8CC24, 0xF119C30CAEEE2222, 0x9F57B7D3E735D202, 
-0xE96A09A47460C945, 0xCDE908B9508F202F, 0x2A5610F61338D28C, 0x62D46F8CD535, 
-0xF506C72790301F65, 0x81BDE514D427C37D, 0x73EB4DE892519A96, 0x36AFF40874618466, 
-0x5D53626AF47DD1DF, 0x8C694A59134848A6, 0x87DECA426BB0D72, 0x5B9B923DE58AC167, 
-0x6B73AE4AAF31F30, 0x2202F66A5F525580, 0xCD5448A1EA96723B, 0x6EB824809EF0, 
-0xC195DE8689A2FD6C, 0xA109A88AE0397829, 0x9A0215273010AC45, 0xAEE291C7219346BA, 
-0xBA84BFF92BA1FA28, 0x8E97DEA0B08DBD63, 0x582399FC4165E40E, 0xB33116A920516714, 
-0x18BBC373DBA7F1D8, 0xCDB31D989C06D0C, 0xF9C8FBCC8D34E576, 0x6C6114FAA9A4, 
-0x48C137EE4E478CAB, 0x44E62599FAAF4E06, 0xF05611486EBB7304, 0x501FF325BA0B6ED, 
-0x611F4852609A1831, 0x6C6AF3F43FBAAC0E, 0xCDD201ADF7CCF097, 0xA7407BF8B95DCBC3, 
-0x1D2C7DCDECF6EF56, 0x189A58984ABD279A, 0xCF741A50B523FF00, 0x470A2BBBBEB6, 
-0x1CDAE85F214D6C32, 0x749F9F77D1BF2C46, 0xD9945F9BAD81FC58, 0xAAD1FD641B6DF6B, 
-0xBF3AECABB7688DF7, 0xC7F088F8A1AE546E, 0x7ECC318544EEAE08, 0x1EC797D23BC3BDF3, 
-0xB78BA5063DADD7E, 0x472A6CB0E73F8649, 0xF1EFDE3F8C775A21, 0x3D3C79A41BA3, 
-0x654890F70F254EE2, 0x46FCF3F802DC1863, 0xBC2ACA8732057A49, 0x4793578578918662, 
-0x13F9D2A8055FC5B6, 0x95134A341F47A377, 0xB02678E2FFC3F9A7, 0xB15EEDA559408FD3, 
-0xDF5928147B9874AD, 0x5AF25AFCA56C562, 0x5AAF5F2A26F70AD2, 0x2999090B0934, 
-0x24AFE67E904D1E7B, 0x70A4296D4480E374, 0x7D47CEBFCE196041, 0xDBC6EB8FD8C2AD30, 
-0xA2715D74F3DE2FEF, 0x65E9AE1945DA8895, 0xA304C3917064E243, 0x68EDE55B09294838, 
-0xEC2B4DEC447F24FD, 0x7B8D6910FF878D1C, 0x7ED7122B09453E64, 0x4C1E3D9693BB, 
-0xB6F7D6D95CBB4A5, 0xF77208B181FAA21B, 0x837E9B2C63489521, 0x5C3B23B45DDC65A2, 
-0x40E8385F8AA6531D, 0xD4979ED3226C8D19, 0x5CE67536708B4C93, 0x7FD383B8B5A7AD28, 
-0x7CA14C29E46E05CC, 0x47C5AA8788B93085, 0x5E1AD8ACE0854B42, 0x4D9D3D953582, 
-0xB7B6435234F3E181, 0xE0D2D28F51DB59A9, 0x1247DCA8EC56E66, 0x35DED45949912A31, 
-0xC1864744A027371B, 0x5808F8ADB370D498, 0x5F67E3655A0AC3D2, 0xCB39B4CFD962C12F, 
-0x9BEC506F8F1D0B12, 0xE7175121352F092A, 0x5490EF8254BD37C6, 0x4B8A61AF6106, 
-0xAC349D1FF4D13AF1, 0x106F79E101351FF3, 0x877CAA38D78128A6, 0x6B9A534E6A0F9DFE, 
-0xC2A783F3AE8594C9, 0xBD4CC798AE2F6E58, 0x2EE9F13CAA22059C, 0xA457F0F9FBAB66C8, 
-0x79657BEC936CA9E6, 0x8D5BA16E8C374059, 0xAFAC28183088CA3A, 0x69A201357D0D, 
-0xED04AC1653CA8AF8, 0xA80878C3C3A2EC1D, 0xD1EA429583D566AF, 0x9271AE45BAF46187, 
-0x1DE359199DA053A2, 0x8D86898DC3A9978, 0x1CFF69D03680A86C, 0xA2C1C9F40713AD4E, 
-0x63FF6C657242F3C5, 0x40D3A82B83777930, 0x6A516DC1B80F7710, 0x378A446595C2, 
-0xC8C8AE7E5672FAEF, 0x80A2BA4299C33A15, 0x853896A3C8583D3B, 0x6EC191226EA30988, 
-0x47E271D3D9C1170F, 0x9511548DA4C7B80C, 0x84B50C649C598D1D, 0xA2369DE7C229779D, 
-0x856EB3DB68C61F41, 0x4A6C91708809DA6F, 0x970E45E9AFAE435, 0x208F25F4E4CB, 
-0x47DB16A45D143655, 0x9EAFFAC87CCC30A6, 0xA161771EC1CB1744, 0x5F37A551302E97AF, 
-0xB339508C6DA1022D, 0xCA7D139BDEB79F5D, 0x11030EFD06466CDB, 0x948B13D5806C8D94, 
-0xD95D27B24AF17C40, 0x83FDF65F891DC33A, 0xE441CA7ACBD588D7, 0x269BC8FC9DD2, 
-0xFE228564FDF4EF1C, 0x8C949CFEA47F9942, 0x77A75FE6BE359434, 0xFA22B6F8523DE1F1, 
-0x420B7C9B2B0A0DDE, 0xB9D6D9C4E1D20A20, 0xC3C341C47A8635D2, 0xF9A76E97B05E321B, 
-0x54FB524CCA4FDE38, 0x3BE8E5DB94358FB, 0x20ED2FDFC8CBAF60, 0xDABCE633FB4, 
-0xEA9C32970A9B8B5, 0x35681AFA2347A2E2, 0x9C4FC5C401B191DC, 0x828FA2ADED7A2ED2, 
-0xA6103BCA059925B4, 0x64945E98A706218E, 0x72DD13BF9BB6EE98, 0x81DDED0E81E39B57, 
-0x7B407F083BA79458, 0x8AE8B5D83EE8C976, 0x260887045E98D20B, 0x67878FC0F05E, 
-0xE25C55A99945618F, 0x6A2AD616786FC92B, 0x2A73072F3B4A43A9, 0xF1C4FFCFA82A00E2, 
-0x576E1E868C3889EB, 0xE655C9AEAE0D7A3A, 0x55CFF76DB1B5DBA8, 0x3E7F1679B83FBC2C, 
-0x152AE6198CA610DC, 0xC14EF0497313D1D2, 0xAE9BA246913C7355, 0xE7DFAFFD70, 
-0x9674F55496D1DFB3, 0x7004C6D79B3A8497, 0xFEB3FC07FAAAA026, 0xB34968F053876B2B, 
-0x62DE0C3FFFF1BC77, 0x8629B80CFB5D3143, 0x1498A8BAC617E694, 0x6B543C3E2C98415D, 
-0xCA9E36A9BF66112D, 0x2D0D7C15DC485C7A, 0x1A3112A026AAD4E, 0x398BFE09B, 
-0xDBB77D7DA7DF767A, 0xD594D4FD412F95B0, 0xA9F5D84FF021EBE8, 0x3D78BE5CA9727EFC, 
-0x85076F15E9824C73, 0xA05598C1A3E8D5F, 0xB66FF100E28DE4C2, 0xE27187F3CE2AF4EA, 
-0x556EB1F8DF44EE32, 0x3A21C08AAD6169FC, 0xE6F76B7A13B795DD, 0x1BBB94C87EE3, 
-0xECDAB5BA1B165D15, 0xCAB602B7DDE22388, 0xB41892CF77242694, 0xBB672311D503EF7B, 
-0x128037FD702B97D4, 0xDAB844A0A56E9E52, 0x67ABDC0A3DB2FBC2, 0x4732C6D17373D3E3, 
-0x5D6EA883C4DA2E1E, 0xAD180ED09AD8FB52, 0xB8C5079048AA54, 0xE7E87AB8651, 
-0xE781228F72419840, 0xC51481F3C47F0B6A, 0x4CDFDF0B613C4430, 0x13EA7A47D47FD86F, 
-0xA024404100BFFD8, 0xE9B9499124064C9E, 0xAB2C978DB8186B0D, 0x6B6AD7225ED4C3F3, 
-0x154ECC643AC67650, 0x9E05A829E4BF69E1, 0x26082BB007CF1FB1, 0x6828C0A86A4C, 
-0xA6FED9510B44DBE9, 0x9D79F771023F2DC6, 0xAE4F73C196CDFFBB, 0x379046A26A342B1D, 
-0x44F023F3E05C312B, 0xA5DE3DB75A486BC1, 0x86371784CC327395, 0xF0CAF621E8628D7B, 
-0x368586F1A0000799, 0xDE3A07F4189C0502, 0x61B02BA6D5BF3122, 0x10BFF23BDEB8, 
-0x108F3B472021BE40, 0x1E49DE9A1F923FA2, 0x4D96A0CA68577C45, 0xCD21F175B51728A7, 
-0xFD4A6C7ABE6C7CF5, 0x3ED910342333DA1D, 0xFA3F9F2BA6FA9961, 0xF04D53C757A812D8, 
-0x882259D99EEA6A2C, 0x1AD6DA224488D129, 0x97EF740F2F363E84, 0x5B1966DD6A7D, 
-0x51E705069745FC39, 0xB429CBBC240A5E0, 0x7679D8A54342E4DE, 0xCCD9735E7D1EBC40, 
-0xF5752B7EE77A0B96, 0x34200925F94B08AA, 0xC04179248D460521, 0xB177558B4DE874BC, 
-0xE2BDF0C8CDA3F8C4, 0xE1AE298BDE14FD29, 0x26A5CA92D54F6CA4, 0x465E248B55F8, 
-0x31B080E7EB34890B, 0x31CCA1CE1739D121, 0x5661164553059B9, 0x4B24F8A4513FD5C0, 
-0x9CEDB115184851B, 0xFB9057FD023780AC, 0x53659C87BCFC792E, 0xF1735FA5D84107EA, 
-0xEDD0939D039B895B, 0xBCD986B10959C24B, 0x65B8A6216D766B6, 0x59D271F1F3E0, 
-0x44F0EC3E7638DE1A, 0x2229F924A225D87, 0xE1C4D666AB03B3C1, 0xF3536E905225E713, 
-0xAB1E518C76F83EE5, 0x42CC4EDFEE87836E, 0xC93D564BA08A0AF, 0x3F4CF5FAB51402E0, 
-0x32E1E1C9CAA401B6, 0x676BAC25532E52FE, 0xB5CF21461D8D9606, 0x45E91FAF0A47, 
-0x9A3AC9AD9F7C1CC5, 0x712A4C4972B7C390, 0x97C03710D699B327, 0xB3511859B86792F2, 
-0x30E57ED4D56DB9A3, 0x7409C2FAD6C6BADB, 0xA68815034078CBD3, 0x8A720CF2CD76E299, 
-0x2E767FDF19304119, 0x5288A132F92B58A4, 0x6868C450FC4E617, 0x1C1F50B6626A, 
-0x61D7E096FAF42D0C, 0x7173C4705C2C8F70, 0x46445ECAF92FFE9E, 0x46A59FB28C73F425, 
-0xA8A256F277A34A10, 0x3D8902E9926ED1B8, 0xB8483F00FF66F692, 0x62ACF1C702E2EC48, 
-0x3E866FF1DDEA00B0, 0x2D5BA09717C16760, 0x481330C9EB1DC919, 0x64A96DD23D19, 
-0xE20D12337BD6262F, 0xA86D7867739EDCCE, 0x88738AB044672A48, 0x6B650370409A7BEF, 
-0x923BAD3C19E6C486, 0x99049310961B7320, 0x7FA5B1713A2BCDB1, 0x71BDA2BCC16F4A6E, 
-0x3B52F1BB148C7D51, 0x8BCA5A27C4EB9332, 0xB3437D42D8E0DB8A, 0x2CC770FDC06F, 
-0xF5C02D73A67DCE0E, 0x9754CA34616F3CA0, 0x82CC50A4AE5BAB3F, 0x28CA8D6FCC2E1B63, 
-0x49F2FEF4C84FE094, 0xFB59B1765C516261, 0x18C0D3F7A843DA5, 0x3DC3BCD58C772AEF, 
-0xCF5787992D5066FE, 0x3903C8E0E7B17517, 0x4F389F3DD4657AC5, 0x3CBDBEBE273C, 
-0xD6452B47780A8B61, 0xF0842387FCE72006, 0x96F46DB5B0F205C4, 0xC6EB91D4EDD382D8, 
-0x9D955A856D74968D, 0x75BC012434A2AF22, 0x736554B9938E69F2, 0xDE87BC5966C70658, 
-0x6E6365C422B08B98, 0xDDD7C6B4A51B9E7E, 0x8D6F049C92900789, 0x6AF1F5D9ED01, 
-0xA9F7E52C8F97F54A, 0x7BE47A364797D000, 0xCEE7C89A8E56581D, 0x21BEBAA683A87574, 
-0xEA4AEC27E7CB8A1A, 0x5ECAB1C77B73E3C8, 0x45AC83BFE0BE8892, 0x9368445533E80174, 
-0xEF8B5CF5D6E6AB06, 0x368063EF435E822B, 0x307C2A29D93B5434, 0x6E0A36F1D8C4, 
-0xB0C1EA4226F7AFF1, 0xB36A5957917C147A, 0xBB36381F915588BC, 0xC7A6555A00606F1C, 
-0xB9F48320E52D8C24, 0xA904DA5EC1FF1C49, 0x2D1ADE347E7D0D4F, 0x5BF07317AFDE89E4, 
-0xD52E41CF72535C7C, 0x969DAACC82071782, 0xDA18749AD453D78C, 0x3C40F4434B63, 
-0x5A87373022C07C76, 0xD70EBA4C7F0CE835, 0x6421DB008363309B, 0xEAA9179B8E5E347E, 
-0x49DAC65EC07BA4C0, 0x457C69E4FA7759CE, 0xC811E475BD58F179, 0x1B5C29FBEBCCB089, 
-0x35C302AD4C73E855, 0xF8AC078C560B0E33, 0xE2F4FA21C9D89D39, 0x20EA31CD9CA, 
-0x536A8C53756D2181, 0x78F714DC5AA82067, 0xB36F33A5D560E9C6, 0xDF22DC02943B376, 
-0x95D515D8573C34F4, 0xD32D6801FA7465C2, 0x7C463CB5F639D4CB, 0x403AC004BEA1A6EA, 
-0x80318F2379611FF3, 0xB53376398ACEAA4D, 0xD1F7CFED792973F6, 0x401CD1D9281, 
-0xCC82C08D4C969935, 0x7713803E4A9AD336, 0x4BED71141D4CB57E, 0x1EF2F63610CA5127, 
-0xD56575EB942AA077, 0x6B587B499F25461, 0x904CD556189DADF6, 0xE77856361977B4DD, 
-0x32D7A8B71F1FA582, 0x6A3B5AF9F5177726, 0xF42D02E5BCA04B1A, 0x1DD1755EDEC9, 
-0x4AE42FCC0D68E95F, 0x6967E8A36119C2B2, 0xB167694F2EC6E540, 0xFF34AB65504960D2, 
-0x5F32C95ABF60EE30, 0x9BAB8B55A146F593, 0x7E89F7AC99E85A86, 0x632BFE6685DFC78, 
-0x12BCA4D5FD01430C, 0xA8670558DDA1F3EC, 0x84898979DF7DA337, 0x1978CFAC115F, 
-0xFA3B8499FBDCDB2C, 0xD092614F6CF328E, 0xC89416BA1DE0EB96, 0x7D779CAFB478CD3E, 
-0x7763C8AAEE7C110E, 0x5E746F12A28AC6A2, 0x3B73264F4AA46FEF, 0x655F5FB8FDA5BE1B, 
-0xBF0395F31719D0D, 0x534BA7933F7FC96, 0x15C92EB7701F2C30, 0x19F9839086EE, 
-0x20A9CCDC45459BB4, 0xACCF927B42469831, 0xFF5106F2A51BFC77, 0xF52580EE497821FE, 
-0x35C6EDAEEF8DC248, 0x88DB23B289FEC6B1, 0xFB4B433CC3FCEA5A, 0x34EC62369F558039, 
-0xF47C44684BA6722A, 0x1B39FEB1A35B91F4, 0xCEF76C0FD7866CA2, 0x22D23C42AAED, 
-0x9BB8C7D5B528384B, 0x890615FCA69DDD65, 0x637149FDE7CCB759, 0x72626427D04D1911, 
-0x88803DA75D138B73, 0xBCBBB899C7CDED80, 0x9B5DC28D8942225B, 0x4D4145495D5B8E2B, 
-0xCE61BEE1CF9BF2AC, 0x75F13C3B271E3B7B, 0xFF126C76C54EA7E4, 0x439462E68BB9, 
-0xE3FFA526D8CF269C, 0x4AC44219FDBCD6E7, 0x70B49A34533407B8, 0x8BC9F7112429D6A7, 
-0x29C7BE01670C0F81, 0x98376FB19CBB244E, 0x7DF4A8AB6912A718, 0x2BFD48B586DEE586, 
-0xDEEB3AF99429B6, 0x80E980A4812140D5, 0x6897660BBB700731, 0x650510B9E688, 
-0xC80660EF52CAE02E, 0xD86A90151105A2C6, 0x4EBDC721417E5357, 0x5CA6E635F007DC1, 
-0xAF9569221733B81D, 0x5C7D98AE90C6229, 0xECBEA83CC3422E7D, 0x53385D011FB238F8, 
-0x999560236E869E4D, 0x1034660F55CE3BC8, 0xA4DF123929121661, 0x6D2F1FF67619, 
-0x664340DA7249BEBD, 0x6B92432B6C0E45B, 0x7EC6114B45414118, 0x574CCD91DAC3CEF9, 
-0x786A0B1FF4BED68A, 0xF1217992827810C5, 0x46AA89E5F5A0B9D1, 0x6003ED6D1689AF8A, 
-0x51EC3769987FEA0A, 0x56122DEBB3DA3DE0, 0xA4F36119E0D0DCC7, 0x73987285FDC, 
-0x74B8B69CE9FA8B46, 0xEA68CF44E062E4DD, 0x947BE05F04EBEE61, 0x92D96B303A90E39, 
-0x211760C1D663F618, 0x2BAC9AE4E33FCEDD, 0x49987787D28A8DC5, 0x4B882D585EF03EE3, 
-0x7189DB701C262DED, 0xB8CE7BCEF712F654, 0xC3D292942C141082, 0x21AEC7830FB, 
-0xBE95E3BF25F5D9EC, 0xD238E17876A66384, 0xDDED6BD6DC72576F, 0xB92EE5AF2842B9D8, 
-0x62C070852A8321B4, 0x6AF21B3830529268, 0x3E01A0C9288D9199, 0x5F2DC63865072D3D, 
-0x93716301E7DB2324, 0xCA6EBE14F552C910, 0x1EB312AC3AE59327, 0x4DFD743D12A, 
-0x183DFE83D3151A82, 0x9718436DD690E93A, 0x88FF70F8CDCA68DC, 0x869F1D95E348733B, 
-0xBDEB4DA8A69DDB15, 0x2F48A377662FDA44, 0x96E896E5C43B4C8B, 0x36B3BC71DF184454, 
-0xACF1749CA738C77C, 0xA3107C8C661B9F30, 0x6580C3986F3ABF2C, 0x33BEC3A78D7D, 
-0xA3F70C9EA38215A4, 0xF423E142B5D131E3, 0x1C3AC5C2D8128270, 0x10E961D8457AF65F, 
-0x713D79A91036765A, 0xBFF97E7BA0DC589F, 0x2220759FD2A5C41, 0xD7628E9B80F96453, 
-0x76BB761D30D30120, 0xDE3E794454EB3AAA, 0xBFCB128BED25D312, 0x607F097B4848, 
-0x42118779C4080AF3, 0xA14C210C7D3550AA, 0xEF66F11195B2804D, 0xA93BA2B29617367B, 
-0x2B4D65B49486E7BA, 0x7195E01FBD42734F, 0x2993DE67CDB24B21, 0x74D99633C1FEED41, 
-0xDE3CAFD36BAE1111, 0x9D342F6455A328C7, 0xE282C00708557A97, 0x2970677FD37B, 
-0xD5CD1FBB97196E62, 0xB94185B9A483C347, 0xDDB24972FB0F93E7, 0xF1965316D85003D1, 
-0x83F71CBD7D7EDEE2, 0x5FED73FCA694189E, 0xB550992BB72EB766, 0xF09B2BA32F4975E6, 
-0x627F9C939E9A4A33, 0x1C9652AB50A29438, 0x8D89E65B19617819, 0x51901CFD11E2, 
-0x570FE8E806C5D75F, 0xC56C3ACCDA1735A4, 0xD1BDD589DBB9BB6B, 0x68098AAD5BF1E3EE, 
-0x2BC345C878F746D2, 0x66E8DD8982220FFD, 0x23C28884381BC103, 0x2D37ABCB376CCB7, 
-0x65AECE3461979155, 0x190CFF92062B3B1D, 0x5F4B13319EAAAE60, 0x195AF1CCAD69, 
-0xE0DA66F763D07A4E, 0x96D7373287625255, 0x1CF17EA2785978CB, 0xE5F532774108EB5C, 
-0x2F8B9DB04327347E, 0x9F0B02E351BBE5C5, 0xC2C2304C1EE109B6, 0x9FD32662641CEBF7, 
-0x63E6A540C74DB02D, 0xB83B20625CDC3B90, 0x40C4C66EDDFF17FE, 0x414451EB48FC, 
-0xBDEF7F980612238B, 0xC9C4FB84EED9313E, 0x359891B334E3B308, 0x9572D41BF3351251, 
-0xC8BC3B5D9723E4A, 0x71954027CAF7CBBF, 0xF3B6807162BD9BD2, 0xFC925D0DB8A1C980, 
-0x550A47D8FDD4D8FA, 0x1FFBE442D308C965, 0xECB59FDCF7418CAD, 0x3941F53BDB40, 
-0xA5E40DD01BFE0DC3, 0x3A76E5E07788D24, 0xCBF23E2D9B6E01DB, 0xBAAB14446121591F, 
-0xD56C0268588D69CC, 0x6BC01239593FD93B, 0x99FE1218DECCC29E, 0xE153988EF185214D, 
-0x322AAF9F7653491C, 0x95C6FC7B8B55828D, 0x791690C9C33C9C58, 0x3EB45FB2FD12, 
-0xDE9537621B0EEDB3, 0x6CB912188CE09B8F, 0x81915BEFF81299BC, 0x425A2A237639D6C9, 
-0xA76C16B9F27DDBD5, 0x62DE972ABDFC8713, 0xFF437699D04BFD61, 0x97431818231EA85E, 
-0x13E7228B44B44288, 0x1775E7A12BFFB1F9, 0x7C0ACB02F0048792, 0x47BC0AE17683, 
-0x3A31CB3BA8C45CC0, 0x5E10F017550B9132, 0xAB5602135DDDA6FB, 0x7F7E45CDBF4C8841, 
-0xD299072BA36838CE, 0xABC7B380E0BDFF4B, 0x3DDEF95FE7BF59CC, 0x6E4F213EE8BD1D5A, 
-0xB3DAAB3F1B4ECDDA, 0xFDB9126BAFA50AC0, 0xCE448D82E9BB5336, 0x3ECE6D3446, 
-0x88D74ECEA659DE2E, 0xF8D08D34393D6E34, 0xEC6716138E42062E, 0xBC41D0E65431A58F, 
-0x531E6D101B1BB261, 0x4035AE0D861F51E0, 0x7C16F16B7656AFB, 0x93D04A8C78F20502, 
-0xB2E57A0EDB5C24F3, 0xF278978D87C44691, 0x1AAD400817445770, 0x18A265174621, 
-0xA3254734B3DB2A8E, 0x6F453F00AA4FDFC1, 0x518610626EC1C311, 0xE46069C020AC089B, 
-0x138A58E55280F554, 0x10AB9E13EFD78F3E, 0x966DFD0A458AC197, 0xDDDC748F338BF023, 
-0x26475CE604EEAB85, 0xB28E68C2F5B98AE5, 0x4B42B42B97017545, 0x2F2CA02175F5, 
-0x3B0A439E7FB60491, 0x3E4361D7C508A2F4, 0xA33132EEE9DFC3DC, 0xF774FF837E182C23, 
-0x351DC2F2CE373D5B, 0x3E560156A343E379, 0x5F03D4D327179103, 0x5CED4D25134F47C, 
-0x47C333C63F32C9B8, 0xDE6C1DF13869FCCB, 0xFE4A4AF75B2DC57A, 0x532134F80632, 
-0xFB5784890A597D36, 0xCE35577ECCE95F7A, 0x33CB5BC7160E6E03, 0xB0FD41A49AE3E69A, 
-0x370D28E89D09FB14, 0x35FE747AFD13E15F, 0x4CF1D4EE4C1621AC, 0x68D48672709EAAC1, 
-0x8B9A34E32306D04B, 0x337064414AC813D7, 0xD3FC1445DC6A2B48, 0x45EE94E82D6B, 
-0x2703BD82433C1FED, 0xB54AB56713A228DB, 0xA0F56244A9CF230F, 0xA5C1E1D5F30091B5, 
-0x904C95210C309F50, 0x1A22F46F4E7A224A, 0x26832F2C69A588EC, 0xB44ECFA45E66F2DB, 
-0xBFE8D971D5D99CF9, 0x88C3A6FF8345F545, 0xB1D67AA4C13FE32A, 0x34B4EE06418C, 
-0xAE679E7199F2D329, 0x6ABB142CE2BEB55D, 0xE815B159C068D787, 0x303B0D969F5787CE, 
-0xBF1A7FD02440E491, 0x9B6A71D233155B8C, 0x14E16432BCEF35E8, 0x570EE385340A2A7, 
-0x843371EBA1BBEF6, 0xE6B521DD9BBCC54, 0xA014F279E33D18BA, 0x293D768ACDE4, 
-0x25F090E346B40721, 0x9201EE5128A42061, 0x8985C3F1BD37DD32, 0xF23DA8E7961FE168, 
-0x7ED32BBCE3126998, 0xC77788A81BF36450, 0xEF9646DF1863B75E, 0x1EA0733655F346F7, 
-0xF58AEB119FFC94B, 0xCB6AD64B537C2376, 0x5133800A96EDD656, 0x970AA5B1E42, 
-0x783D687487F0874B, 0x32F705D5903B02AE, 0xA75D4DB36E14EDE2, 0x3DD7DBD871965FD4, 
-0xBCE2E3C22E5F7288, 0x9039A7A295E37244, 0xD82CA4BCA83AAF94, 0xA41EAE830248F980, 
-0x38A879A04E090B3C, 0x8612B8C668F767D5, 0xB0F7F563E8A700DC, 0x1C3ABD62C7AF, 
-0x75306274827EEB0D, 0x8BA9A5C1320CA218, 0xE69B22ADE837AD85, 0x7472C1004539B96A, 
-0x95D56FB636F43D70, 0xD6FFC29B5A7CD8A9, 0x527909F3AFA67D69, 0xDFDD1B7B550A063D, 
-0x64941D6092267B0A, 0x6D643435C2E6049F, 0xA5E650E70454C87A, 0x409BFE9BB591, 
-0xE3C55405C0AFC72F, 0x81E8E52612F04B0E, 0xE409F33A01CACEF2, 0x5191BAC71E832D0D, 
-0xDD1A56B8C25303AC, 0xF1EA09E6CCC9E4EA, 0xB981D3C8F29EE220, 0xFD4B858B44585F79, 
-0x28AE86E225C6AB3A, 0x9DCAF23A9371CDD4, 0xF2F2F507AA0E1040, 0x991969A6F50, 
-0xC4846E4740C9708A, 0x82494E891C759FA6, 0xE1E03BCA222C9CA5, 0xB9E40BBD128C151E, 
-0x3C2D2322FF1AD530, 0x54393F1E4E8DC98B, 0x94B86381CDBC1743, 0xDD85AB4E890E9F3C, 
-0x46C3C6E56DA1CFD8, 0xD8F91CF3A31BCEC, 0xDBCC02BCAED6D9C7, 0x111238590510, 
-0x9329C6938CDCB4E0, 0xE0C06E6FB3769DC3, 0xCC179B477B46962A, 0x1489E3312F84211F, 
-0x5572DE377A014EC7, 0x1E0AED2711A84226, 0x8564A2D5E242F131, 0x161B71700DA0CD6F, 
-0xEF46BB0789FA224D, 0xBEF13F766BE0F7D6, 0x512A175C0D0D2545, 0x4176B399E536, 
-0xC052CDE540BCB4E, 0xB59E4E25423A9B84, 0xECB1C4DA94A04BA5, 0x621F391F3190115, 
-0x840ADF88444CD2A3, 0xB7B7C57D18936436, 0x614436F4036B1841, 0xA8C8575D083224C0, 
-0x6CBAE1703D8CA89D, 0xC6079C47CE720A9, 0x7E93A50B9280A5D2, 0x32F9A2DCF976, 
-0xB633BBF555A633FF, 0xB858799E40AF2E0A, 0xE4114D286E488D0F, 0x91C8C248A90EF6B3, 
-0x236A6017FEEC23B4, 0x789954D3610DBE2E, 0xFDC9AB0B33E3EC4D, 0x6F2F939D5BD44AD2, 
-0xFC39303F9F4A489F, 0x14B50ABEA66964EE, 0x569FDC7AA47E9E1F, 0x3EE48CC51DF1, 
-0x2D6C02D8BC68C767, 0x4A7D2101A13E002C, 0x10D4F79F88FFF249, 0x19D25ABC7E750514, 
-0x6618F4077B966B67, 0xAB32E07A38B86BF, 0xC0477EA8781AC19F, 0xB9F9F9E414D4FFB3, 
-0xF7A8CB739C6B5943, 0xF50FFC58E7EA2C58, 0x47C94C6F50CBF743, 0x6AF57A517295, 
-0xA0F1F20FFB996799, 0xBD5764A9A2A2FC02, 0x4E59B976DF07B2FD, 0x26D61E1258B5593F, 
-0xAB5E28D62C727408, 0xF447EEF7139A67CD, 0x5572223886945809, 0x192AE45863841D4A, 
-0x331C3D1E3234486, 0x70D913527211B46A, 0x322E6E50040B8651, 0x35A3F62DD66B, 
-0xCA4725CB7C151D90, 0x5DBDF6F8CEC475EF, 0xE0C3482AB7D8207, 0x94C833C562450194, 
-0x3E6133692AACB5E3, 0xFABE8F3EA83E07CF, 0x1F03A975627CAEC3, 0xFD3508E14DF68C21, 
-0x6FDC072B69B77653, 0x227B6B7C40C89238, 0xC7C4C1A12505FE35, 0x3487713B550, 
-0x51AA5C853AC36102, 0x827DC9F6F78E8D96, 0x2E49831EC295FDEB, 0xFF768BD703E4104C, 
-0x5026AEFD12C3F064, 0x8D262D25D4B8314, 0x890CB613760C9C07, 0xC4ECB5EE5CC95302, 
-0x6CE1D4B8433AF8C, 0xE0D713FC1AF58C6F, 0xCE10D7E7E0B4E9DD, 0x399C184F8A44, 
-0x57A2FE34CA3A0BAF, 0xD33EAE20B1CF9FB1, 0x5E0E9EEC4FF7C042, 0xF505FEBCB1F7B7C7, 
-0x39CD1A53C12FF8AD, 0x2C2B76B2DAB50515, 0xBF9A4840E0FA356B, 0xA56875C70C3682C1, 
-0xA6D5B53B1625D64D, 0xAE87ADAA800AEF0C, 0xD980B3F3FC0F427A, 0x22853CDB365D, 
-0xD7CA92D5D963C14B, 0xA9E014A5EDFA243C, 0x18764B08EB94A0C9, 0x8DBD4DDFFCC7AD, 
-0xB7048C28576A89D6, 0xEE4AF5E4D12BD7E7, 0x434AE852ED649E54, 0x8A88FA5E7B6694E4, 
-0xF1EB472A9270EB63, 0xBCE5ADE2C9B8643D, 0x347FCC438ACCFD4F, 0x5850C9463439, 
-0x6AA55D1BEA907CD1, 0x47D414AF9661CDC0, 0xBEBD6685C143D326, 0x2E14D47D59D06658, 
-0x9C127655EC0CA5FF, 0x515AB266E93EA66A, 0x21075B9F491A28B1, 0x61E52566BF4BC904, 
-0xCA7DFC20CAE06EB0, 0x6CF6327791E266CF, 0xC5BFBA0C0AB826AD, 0x236514363B20, 
-0x3ECA8107A4C43AF3, 0x50E358975D8E099C, 0x7EC015F6EBA069D8, 0xC329FFE09B61D20E, 
-0xCB428E552DA93B4, 0xCCDFC8BE9D81121F, 0x10AAED01CC44EE6F, 0x734EAF09913884B6, 
-0x2F5F84328C17F074, 0xA4BA48DDF8E98488, 0x31DBF78FEB2EF726, 0x6D6EE496C778, 
-0x17397CB0BAC7A52C, 0xF289CD9D8A53BBC3, 0xDC4A061BDE7CBDEC, 0xFCE3E3E222A6D994, 
-0x8A01D48D30F96987, 0xE707EEA92DFEBE14, 0xDAA19AD9D79BA17E, 0x3742C38AC25242DC, 
-0x8ED711DCD3A6467B, 0x90C0F7E3E0477081, 0xE4E8DC95DBEBEA47, 0x4A3E6236F408, 
-0x838982293FCF93B9, 0x811215D1986F9DFF, 0x7BD3C49C2B1BC3CC, 0x27D95E7794F84A3C, 
-0xFFCCBFC17930A88D, 0xE006C9484B29B493, 0x5B41410BE3B58F0E, 0x95B405771B843C94, 
-0xD13D12EBBC1DF120, 0x6B07883B6053A8E0, 0x42E9AA7311177B49, 0x54CF70F6DAB9, 
-0xB388C790035B06B6, 0x30D3F7C2C89F45B1, 0xC5DF29F5FC21954D, 0xC03C48D0B6C009F9, 
-0xABF13086D179B74D, 0x6427D335B9F5AD04, 0xD243C77A4507F1B5, 0x6AE7FE58E8043923, 
-0xA2CEA794CB74A27E, 0xC549CB58BD40430E, 0xB82141947A5AFB40, 0x2399268DC609, 
-0x8E8EE96A8CC16158, 0xC444A18202E4B4EA, 0x6D50B1E4CE3C5C06, 0x10C4A7D5E8C49CD5, 
-0x9CE20AF500A52FE, 0x440E5BF4CBCD57DE, 0x9F7D3FCDA6870332, 0xD6D386EE0D0E06E5, 
-0xF27AC63342E57B, 0x38A2188B4BEE8C78, 0x27C0A2A2ADB0200A, 0x1DD3522E84BE, 
-0xF8FBB4E348C09CC4, 0x6A87A2EB79F575C5, 0xECAE6A0180A78768, 0xF5B13E158BA09982, 
-0xE51005ADBA0465D9, 0xCF9140ED5ED70201, 0x9F521987DB0CCC6D, 0xD98F11FE47739033, 
-0xA4042BA3F0DCC769, 0x3AA0130169642A5F, 0x42E590297A2BF3BF, 0x377223FAA640, 
-0xE7CD6A7AD62F109A, 0x1ED4080EA0638B61, 0xBACC3A51258FEC3, 0x5E4D648795E8EDE7, 
-0x91E51635DA54FCDB, 0x395FC3B6C99EE7CB, 0x105510D3CB79E7A5, 0x961548328AA7F208, 
-0x66319E778CFC6877, 0x77223986DB0C16B, 0x5BC47120824187F0, 0x270A12FC9549, 
-0xED65418A6CE77289, 0x9EFA71D8B3E2D27F, 0xF4F3B14AAA9E1F4D, 0x408D06F899B203E, 
-0x254CB3B656353304, 0x5ED3994CFBC7ED97, 0x93E6594A80023D50, 0x127B453B64C0C38E, 
-0xC3A48B83BCE8B81D, 0x9C75E543E0B1D46A, 0x834277C021A6653D, 0xDC2F49B49D3, 
-0xFA514CB3CA805748, 0x89210D3DDBA2325E, 0x3641C9A4199FA0E6, 0x2A754674C9EF5236, 
-0xB024495903B9B511, 0x9CA36C5222EE9B5D, 0xE62797B277B899E4, 0xAA82873247F2CA3B, 
-0xA4A4CD1D98530621, 0xC50470C961EFAC74, 0xA010EF63AC1057E4, 0x3EAAA16A9646, 
-0x334C5E9441195128, 0x67E3C7D0286906E4, 0x40E2C6688AA3028, 0x1C68A7E7491E6702, 
-0x3FDCE49E529F99D2, 0x73E793BCFC2C9FE6, 0xE13D275052752B31, 0xF9CC6CFC9E8C6283, 
-0xB43568C44C9B7C4C, 0x22FE92EB99B2A69B, 0x149CEDB4F97FA329, 0x2D3ADC7918EB, 
-0x7FCE3F10FB4E2C81, 0x8B09DAF61C7369CD, 0x51C4B75203F51A01, 0xDFA3A529E5F3AFB0, 
-0xB915274DB1960F8D, 0x99F601961216ECB, 0x2D710BB181C534E2, 0x5D8A024371BCE1E3, 
-0x42E0F76C1A5930FE, 0xC9ABB506DE7EBB2F, 0x7DE960EDD0F36314, 0x2778DBB00656, 
-0xF8E8007A8226FECE, 0x18CEF99466357C44, 0x4183FC1C72031ED1, 0x401E46EF63D2563, 
-0x90B2C69D1ECF8219, 0x1E51B3BC706BAFF5, 0xA6BD6BE73DCFCBD0, 0x15C025C42716F6D4, 
-0x94235EA8C9A6AFCB, 0x59DFF341125B1162, 0x75FC91D8405C6F7F, 0x18F718EDA089, 
-0x361B79504155E080, 0x68776E17FEF8C44C, 0xCD41DD6587FF2C20, 0xD2B8652F5343446C, 
-0x526F93E5A039831D, 0xF8821B94D8F573FF, 0xB7704C919B0FE32, 0xEFD6CEC4E6966760, 
-0xC1A5A733E8481120, 0xA620849A8E622B6D, 0x3E262CE6527930FF, 0x2A8626BBA28F, 
-0x37A85DEC98AC8B24, 0x88045316EF33AD0, 0xEAFA1975415D54C9, 0x6C37B4189B3C0F00, 
-0x8E4FBD2DD1DDD56A, 0xB531735C5E4A26BD, 0xCE9D4649DE2E8DAF, 0x5EA3C16E12900A4C, 
-0x2522603B8E560A75, 0x4828D935DC551977, 0xD8939C19819C0739, 0x3548E957B41B, 
-0x4355D442A39D3C86, 0x46C15F37CA2A4F66, 0x7EB445B090E3DBB, 0xDEFCC75E0F007583, 
-0x7D39382B7DCD8E7E, 0x427307570EB67297, 0x7AA95D6E987316AE, 0xE09F3ED1DB5DE146, 
-0xFBC23AF76476810C, 0xE09911BA70F6FC14, 0xFBEF0232E29BE7C2, 0x58E83F2F57F3, 
-0x1E940137B7917B55, 0x605BA68F35D5F46C, 0xF822EFB991C62D04, 0xC39240607636EA89, 
-0x2F1202EAB790A48, 0xFF7D9C72566F6E79, 0x136E0FC773869BEF, 0x45EA0646DE3CBC0A, 
-0xC498778EE46E9340, 0x5F71C21FA3F85575, 0x7C1B3FE4AE2F2FE7, 0x4492419501F1, 
-0xB9E1090E110E46F8, 0x1F00EE9FBED47CE9, 0x17B6440BBA617238, 0xFBA2BF9AF63B132E, 
-0x84374042E8A23A27, 0xFE998B15D445A2D7, 0xDA13D8DA2CD1853C, 0xB4E927FCEFEDBC8C, 
-0xEAF5DCD6F1867B7C, 0x5DCCDA1992FF39F5, 0x8D4600103E873931, 0x24C7FA78336D, 
-0x3214DB2E2F17C6E9, 0xA04B097C6587DC9, 0xDC4F9586E39AF767, 0x668A1088EF0DC1E1, 
-0xC2B7D73D892CD071, 0x575E700304494494, 0x65FB8D51EE01614E, 0xBEE2E2154C16A290, 
-0x408A3E4996A9BCD4, 0x39FDB8240A9EEBE7, 0x8E23FC91A4F0DF93, 0x8A2D0764270, 
-0x716A815E45245770, 0x73F2BCB614B2C4C2, 0x6C11C87617083A58, 0x6E3E355746B61C75, 
-0x6790FA59F7655EDF, 0x4E82355EE268DCDE, 0xA9089CF9ED76B98D, 0x196BD75F53D6641D, 
-0xE40406261BB8728F, 0x50DBA3DD881F3945, 0x549428C2A81F773F, 0x513E971FE715, 
-0x1718BD171254B7C1, 0x28621DF56FD09E25, 0x8027417515435044, 0x49E1FC8F67257EBA, 
-0xEA096FEC642D9B1B, 0xB56292AA523C5FFB, 0x16610585F1263D77, 0x7DE1ACCD2CC1CCF2, 
-0x6742D0D3475550A4, 0xA234B7CA80EEAFF4, 0x9EC8EA1327B99CC6, 0x232D1DE53281, 
-0xC93637D2E9CF9235, 0x3C8A841E88B9BA92, 0x4151C93FC4F35467, 0x98C92BCC76D08754, 
-0xC6D9C0294EB47D4B, 0x11B2B5C84C4AB38C, 0x94E3FA317FEB9C4, 0x37110EE3A8DAE1A9, 
-0x623D1B5D682637BA, 0xFAF965F34782A601, 0xD4EE6D9F3030DBEE, 0x394AC1A52282, 
-0x334F76362086F167, 0x1A5BEA3703513718, 0x1419911723698675, 0x9735A68C1540C3CA, 
-0xE1A541AAA2379673, 0x71856D05A6F6B972, 0x7B7406DCC27CB844, 0xA85A06297DEA7B9B, 
-0xF1CDDA75505D5AF2, 0x820DC4F7E6E9B180, 0x3C17F73D864DE32B, 0x309634BDCACC, 
-0xACE13898F4FC7ECD, 0x18694C5AC523EF89, 0xF9B865A76B274DF9, 0x225D380E2883ABEB, 
-0xDB547536F0ECB580, 0xD806EEB13D9B3CD3, 0x903B70B1635BF48D, 0x7EA5E4F7A81681E9, 
-0xE13AAF96595C4A0E, 0x4F301635F323FB4A, 0x84F0858E8BB3A638, 0x545CD920E3, 
-0x608A1C1AFB0057C0, 0x454736FB5AF10B3F, 0x41A240F9FDBE2BE4, 0x71FA89EB0A098CFE, 
-0x37C2878559074844, 0x1A40DDDF451C2799, 0x1D39CF05F69FC5E9, 0x4633672C15F8CEFA, 
-0x92B4A20CF2B0B322, 0x2DB1D9B46AFA37B5, 0xAA25DE997EBF3322, 0x5C292DCF70AE, 
-0xBAEC55812F38D41C, 0xFDD7468BF885BE17, 0xB356ED774E7C4248, 0xC23B5090C185C6D0, 
-0x50169F90BEA29BE9, 0x891F30143DDC8E19, 0x1C544B6710E1D25E, 0x69E77168620489A3, 
-0xA68ADE5F5F3FB0E5, 0xC6CEBE9EBCC0FE36, 0x65452F45F353DA9D, 0xD4FA6A2EC8F, 
-0x1E2AA2B7CD506ABC, 0x2E0063A5091842BB, 0xE1BF55764AD35FE4, 0x929DDFC3188EB7D0, 
-0xD60D0290930B0B50, 0xB641B23A4D146EC7, 0x78AEB544DC0826FB, 0x5B69F518A0A74763, 
-0x8613C9A9C2E194C9, 0x9A28C14B5A10E928, 0x48B2C2C8ACDAEAFB, 0x31593A66755, 
-0x1092B4D8AF170B02, 0x45F8016E31D57FA2, 0x36B5EC302802DD56, 0x37F9C7BD4E172F4D, 
-0x5A7E63959FAF04BA, 0x456D03540C899C4D, 0x317A09482841C26F, 0xCC0047DA68CF307A, 
-0xED3A923F6A0AF89, 0xD61DC576B8CFF4B7, 0xFE099A08B5F58BEC, 0x3FC4287D0674, 
-0x7EC0C9BE8B942905, 0x2612D7DC98A8A310, 0x7C283D98C0E99ADD, 0x6B1E4BBED7B344DE, 
-0xCEE33DC296490AE6, 0x1BECF6A1B49BE42C, 0xB61E22949C809F58, 0x20C0C1CCD1402742, 
-0x3F4BA426975DA66E, 0xFEE7F313FE90A270, 0x56BEA9D99AA688AF, 0x2B84C851158A, 
-0xA07F8C086647D3A, 0x510A4FAEE74F55E3, 0x97E3D1061216FCDE, 0x807C19501471F18C, 
-0x4200A2AE18554C09, 0x87E9131049CDE349, 0x3818000573B65D94, 0xDEB20373DCF397DD, 
-0xD28A82D994F31608, 0xAD9D851C180FF321, 0x6145A315DF4E103F, 0x29762CD23A60, 
-0x7FA67726054BFEF2, 0x330B50CE19C908C, 0x7B4C6D674283EA11, 0x470967943480BF67, 
-0xF71C88C628FE133E, 0x4FCA51C09FC0DC95, 0xDC67C7343B3C422F, 0xF82F67EA3A24A565, 
-0xB13E770BF8861200, 0x3D2483F28665D4DD, 0xFE58167552530EB6, 0xA5D1D1B518C, 
-0xD19F18F7E20B80A3, 0x9D0F260C79043C17, 0x41C3361351681610, 0x4FE277DB3EC8584C, 
-0x67F6C6B4DE95EF1B, 0xDA968FB9F59AEAE8, 0xC9E253538E687579, 0x6BFF125A1FBF4A04, 
-0xEBF35E332C9834E6, 0xE50D1F0C4DD229CF, 0x1FFFFF036807C62F, 0x11F1F5810FC, 
-0x38E400A0CBF0BE72, 0xF568FF84285AC267, 0x13F298CEC32E0E1B, 0xEAB3BEB5CCEFA8D0, 
-0x5E643BD612CCE6B6, 0xFA3FD6BE1307874A, 0x37BA6239445CB6C2, 0x12365E663F202929, 
-0xB2020BB7D1977B88, 0x73B936101483CE7C, 0xE7F3E41B96D98216, 0x325C5EF0BA81, 
-0x1F70A51921AB5FA6, 0x66FD4149B7E9C1FB, 0x5830E80BA84E6DF8, 0x2206A8EDD1BFFDC8, 
-0x2B31A6CF03B61ECA, 0x22FF837C9A0AB90D, 0x64F2D82E1AEED9E7, 0x8B89F1CE2ABD43CD, 
-0x141383428843DDD7, 0xDD356FACFF4B4485, 0x611232BBD958E061, 0xEF9DFB8EF25, 
-0xF282AD0F30E04680, 0x852D5468278DA344, 0x1D1725EDF560DC7B, 0x4BF6CB7D970E49C, 
-0xE7BC9B93654420F1, 0xB74D3F09A4A3CD57, 0xFBB7B36446A6B188, 0xFC1E33BB7B87930F, 
-0xD18ACA032DB7D075, 0x8551A1DBF2D081EA, 0xAA2FE1C16255F93E, 0x130403389BCA, 
-0xD243B6FE0B070D86, 0xA4A4B68A4C585C60, 0xE40364B56005D6BA, 0x8CF30E1584B8D13A, 
-0xA3D183B3CD461BF4, 0xC60DA7B2477664B8, 0x9B2EFCBF63D61E15, 0xD0D0F0F2A1B34C53, 
-0x77F851C53D9A1602, 0xD378AF41AA7AE8FF, 0xE70EA5F75D3515A5, 0x499BE42D1F68, 
-0x1B6BB5C873FA0251, 0xCDDD511B5F6A709E, 0x9199C7C86D380353, 0x1B51F7EFEAA8624B, 
-0x3A53A3D09B69ED9E, 0xAA05B3D097015229, 0x43F70DA7F9ED3DF8, 0xA6C66AD580CC012, 
-0x16E2BD07EA86D99A, 0xA66367A7213869F6, 0xF9716A392E3DF8FF, 0x13997619DE82, 
-0xD5C845B6971ECCED, 0xA9BF55019F1DB288, 0x65CBB3E30135C1BE, 0x291282195A6E01FB, 
-0xFD7B63148BCB6C86, 0x7697152DB4CED2B3, 0xECB518BB34F9594A, 0x61FC22681E935435, 
-0x95D15822A7B8AF94, 0x36DB05A7CED21CBE, 0x2D46F6BAFB82234B, 0x7CF07EF43E0, 
-0xA68C4221717012DA, 0xF29B60FC810A316, 0x83D218678D681DC7, 0xF23BD97E0677C384, 
-0x56889524891B0222, 0xADCB552D42FCF8AD, 0x9700A4D39507CB6D, 0x63B575FEF33FCA55, 
-0xE7857B36631B2C75, 0xE6B85EF15BCB1671, 0x362167E9565E127, 0x6F84A2FFE28A, 
-0xA160849E02E814B3, 0xE73121A347AA414A, 0xC89EE523B9E99C91, 0xDBF77CD0F92181F, 
-0x5824AC529D0CFF81, 0x9D391BAEE5DD21A2, 0x7A97650A4F01D74C, 0x4D19918161AEBE31, 
-0xABBD3993587FA6C5, 0x5DA24A021B0A174B, 0x7CBB81F8096AF0A6, 0x629ECAC05128, 
-0x58F94DCC7B95E6DF, 0x5CDA907B757FD6E9, 0x9456E39798B9C5B9, 0xF084BF1971EDFBF1, 
-0x41774379436B24B7, 0x868391791D37B54C, 0xBD3A207F173912E3, 0xFC9F318B52C15CDD, 
-0xF772C9A97CFED43B, 0x37F12D7FD0E2B466, 0x614FC751F186A22A, 0x619BB175D13F, 
-0xC3BCBE23C6116163, 0xE8AF774AD3E45464, 0x5555A0616165A509, 0xB380D4993315FBBB, 
-0x297367962E01645F, 0xFE6531BC9E98D0AD, 0x8180C7EFF89C30CF, 0xED6E04411A06783B, 
-0x306711E98C1EBB96, 0xEAC7A207835D5C59, 0x28BC4DB5BE7E29D8, 0x57F09EDBAB55, 
-0x29089D981623EE69, 0x48412AB132BF410F, 0x8D9EC7D5D4DFE622, 0xD4060F43225E2D7D, 
-0x127067B45D675EA6, 0xC76A7670A9E751A1, 0x150855DCF5B6CA50, 0x3261846AB99E0C42, 
-0xE3D170AC0C7AC829, 0x6937DFEDC83D1C40, 0x18CB38FAA11A1FC7, 0xC701D3602B, 
-0xA8AF8AFDCF6CDBCE, 0x399561509315C92D, 0x1E283AF936799876, 0x8DBC2B7AB04CB094, 
-0x6AC932D32EABE0F5, 0x55A27725787B3861, 0x25161B867D4BC6DC, 0x44EDACD1A8AC6CFB, 
-0xC30CD93E8FB3CCDD, 0x3679D34166AE85F8, 0xE62B1A5EE057D60A, 0x26FB6F8D2359, 
-0x3FA2CB5D77A0E72C, 0x445815594385B12D, 0x5DAD93387C0864E, 0xC5D41640616E89D8, 
-0xE911824FDB8322BA, 0x9DDB662CC1D3360B, 0xD84C8CFBFCEC959A, 0xF8580B19AC59F1AF, 
-0x14C42C665CBEE133, 0x949B8F9C4EA22429, 0x71F2FFC9DBB772D2, 0x5764D4AFB1B6, 
-0x33A9DB039313C015, 0xA76380F179BB2AB, 0x226C39526E0CF185, 0x987BDF8F0DB8EBF0, 
-0x78D1C286117C5A34, 0x7544682EF593D663, 0x835DF4866BFE56BF, 0x813E409D450E3E23, 
-0xF0FF0EBB590370A7, 0xFEBAF3E94123B74B, 0x6CB3FFEA4FC991B3, 0x2C4AD2324AC8, 
-0x5175F41502ED2A46, 0xED277EA61E3621CF, 0xCCEF635A7D359CC8, 0xF2F5EF49D750FC55, 
-0xA5423CBF71AD0798, 0x82E26D38656CB096, 0x2B6881279C7C4A23, 0xF0E98903A5BEE3DA, 
-0x26E9FCBA942C5E20, 0xCEE1CC9C9BEF1E93, 0x1FBF5ACADB07B82B, 0x122E64AB6BA, 
-0x8A00557B0B50B7C2, 0xD159D2460C7C25F3, 0x81C2A7D109DF984, 0x445CA1769D27351A, 
-0x754205CE55AAE4AD, 0x2012C451ADC5C156, 0x9BE27D723B9893AD, 0x5CA0B6C2643FF3EE, 
-0x5B2B6C43747D0597, 0xDD5D1B0A8F87744C, 0x35630159893B121D, 0xAB07B5A05D2, 
-0xC0021276017FFFC1, 0x9B79581BC8059E8E, 0x218497F02DD6A168, 0x2E99628FBFC284D8, 
-0x214D7BD10A13ABBE, 0xCFABF90A40B8F2C7, 0x98EA97DEA3295D11, 0x78FFCF816EF501D1, 
-0xE78D786658546463, 0xE16B9496E31FEAC8, 0x12A9365BB9797D01, 0x45CBAD7FEDD8, 
-0xEFEF914F68CE1DFE, 0x5A762AEADE79C0AD, 0x36A548FD6B3B1836, 0x5CFFD018AE014F2, 
-0xB850A5771D91ECD1, 0xE1A6EA2CF6DF2D06, 0x76F4620619D66116, 0x796BF514436CC770, 
-0x4F6C2ECF34511441, 0x837A45D3D3CE40D3, 0xED78C0CEFA272DA4, 0x19972B4E4E00, 
-0x536ABFAE9C242D0B, 0x7946C95C42EDC3FE, 0x7C8BBF6D9DDB6CD2, 0xB96E750BF78625DC, 
-0x76B291C71D7883E8, 0xF7B549D52C065627, 0x6313D3A72E4112BB, 0xF5C60449F8D5C81C, 
-0xB38C4DE58C57B6D7, 0x9770FA282635CB6C, 0xF02F415E23CFBC38, 0x35AAD07CEF28, 
-0xBB2D632A098314B2, 0x1C6C01F846D61702, 0x619DED8B4CC1943E, 0x60B90ADFBB513AB9, 
-0xFAA134DA03624144, 0xF6803623AB339F44, 0xC76788D74CE0B317, 0x31D99BDBC1E401FE, 
-0x24423AC78233A431, 0xE2A43AF5DB223550, 0xC29084B4574A1283, 0x4C27AF8792DC, 
-0xCABE72B23AD60B8A, 0xB4044B32B2DA3092, 0x94D58DAE363C3FB3, 0x3594D7121FEFB40A, 
-0x138E838E95248074, 0x323C02E615F62BD4, 0x4455CA840E038185, 0x2A73A7725C5BF461, 
-0xD0AF40AAE37A9E15, 0xDF9974DF49C0FEE7, 0x4BC01B1EB217C5B8, 0x303CCB0279F9, 
-0x84DEFCE7B846582, 0x3ABDF4A8C7308F78, 0x8CA1D34BA7403EB, 0x4F0D864B6339574F, 
-0x23C785E16432935, 0xF191060476177C78, 0x5C74354F65F97D57, 0xCF5A02BEAA24B2C7, 
-0x86948A68C45C069, 0x9D4069B95304FB32, 0xA22A0B62E45513DF, 0x35E5318FBEA9, 
-0xBD88240B8213A918, 0x5F5B626DEADE463, 0x34B4B2A50C5FB790, 0x3E3103A9AFC069FF, 
-0x1EC25D59E53A8BD4, 0x55FB7D1323A862B8, 0xFE796D83F1348DB0, 0xA669526DAF3B2AA8, 
-0xA822079826C0696D, 0xFBA17877FE33CE35, 0x43FD70B4CEAF42F1, 0x2C3043C03A6E, 
-0xB2814C92F543792C, 0x4B9798D79A0FF218, 0x61D7A263264AB84B, 0x3E5D20758E67F166, 
-0x5945E17B55D447C6, 0xBEE14CF9D3D34C51, 0xF70693E679AD0209, 0x489A38125C51B233, 
-0x5FBAEE2B56809EF5, 0x5079B872DF154426, 0x2BA61220130CB28C, 0x172E41614960, 
-0xB38D9C5CD23D6ECC, 0x1BBC4C7D84406806, 0x62500B829028E1D8, 0x9DACD0E9FF4D3F8A, 
-0xCCA71183F6E31E43, 0xE27EF7BD3095285B, 0x73AB122DC86797B9, 0x5E642EEEEA501B1, 
-0x97BEA6F8945202B1, 0xC0BE0701107543B0, 0x5DA3FA667C70F129, 0x6DA4107D050, 
-0x7F87D8E00181849F, 0x87B7AB02F5D4A154, 0x5289B82DF9E418A7, 0xEE89214A30AA5C0C, 
-0xC17DEF1234E768DA, 0x4790CDFD006CF38F, 0x6A67E5910DAE943E, 0x641FB492B351D6BF, 
-0x43896EB222382FB4, 0x388BC0403D9995CA, 0xF93F4C8E4D95BC25, 0x6CDD2126DE6C, 
-0xC9E5E1FE2126B864, 0x10934604A681B551, 0x927ABA1C2CF0CD53, 0xEEC5E497AF40D5F4, 
-0x6BDF15ED0B7A02A6, 0x9641E635AC4B4A34, 0x257911D0748879BA, 0x9A02A250155AA5A0, 
-0x5D5549528A932DD4, 0x62AB16E4C4C3C33B, 0xB5B21E3B1F408125, 0x9149E93DC4E, 
-0x495309E7CF753BC0, 0x5AF220832B8737BE, 0x5501EAF481A679A7, 0x493420A427712D83, 
-0x6345FFE2D6FD8A66, 0x2732B8851CED580, 0xC94E0D05C5393CE, 0x4D9443925AA4E2F4, 
-0xC36442201CB29F3, 0xC794E51D058699F1, 0xAE3A4210A95FED7A, 0x2EE4223C4800, 
-0xE19CEE0C46EAA76E, 0x535774E02FFC7AF2, 0xDF85A826E93CFA6C, 0x481FAB447C751C64, 
-0x5AEFB1D0467120AA, 0xA81EEA25B6DE116F, 0xD1BC6E2A022AC2F9, 0x8B42ED5C78F18ECD, 
-0x73BF3CE619390C44, 0xEDBF1E09DA23FD00, 0x49868FCB741E8FB3, 0x26A23CE591FA, 
-0x7E5B7D10AC0710AC, 0xA47FCF347D99078F, 0x434724D991694986, 0xD8F2F51B2C2BD4A1, 
-0xF763B3E2D72A3EDD, 0xC747831D177DB7BD, 0x16A042CAF3CB8BCE, 0x1948B5522F3E6AA6, 
-0xD4876DC2CD9BE043, 0xBE3BD8AB31F3B253, 0xDE486BFB1DBD403C, 0x4B221214EA0E, 
-0x7C4C8AF466F59788, 0x9B8A338F71A0E13F, 0xFDA78204DE985885, 0x65621F77DFCB92B9, 
-0x4A846961BF1BE8A8, 0x52045169CCAC9FFA, 0x874149B7F006A456, 0x1B396A581CC5DD5A, 
-0xBC980DCA9F8F95CE, 0x7286AAF568244496, 0x86E0F318BFA01C26, 0x17FC7741A235, 
-0x543DC4FD04A22444, 0x3EB0435921E8CC2F, 0x48E9BA2AEBF5BEE5, 0x84655C321CF2E215, 
-0xC87C39E5F5B8578D, 0x57638A9306CEA1AE, 0x7A0578963EB60FF7, 0x826F53FE44C46FB4, 
-0x7D78E1BE88D19D7A, 0x4D22DC6D22C1AC28, 0x78A11E9DE35925A1, 0x3E566BCBD9CC, 
-0x9E56E0B0C003DA67, 0x7E572A99445D130B, 0x9B8B39B6EF231768, 0x79EE4BD212BE8ACF, 
-0x73684D75561F8D2D, 0x166838E09D91F01D, 0xBC3D895D5C04D556, 0x880917EF6274EEE3, 
-0xDED47F011A62E8C1, 0x5FE8F24CC61D87FF, 0x8F25492A41F219D2, 0x19EC483F0B11, 
-0x10E3B15C373F7799, 0x56756E21930CBCC9, 0x7E83B2A98DFFEE2C, 0xEA0336C8F16CE3D2, 
-0xD3E5DBE68BD602D6, 0xD3A9F845C66A3C32, 0x5B54DE8501259D4, 0x238EDDBF19D8730B, 
-0x104374873120BE34, 0x513E0D142E3B155C, 0x961287F93FF32756, 0x427AAC761411, 
-0x853B2D802925E10C, 0x591961C63E998B8, 0xB46DCBA3B3051D82, 0x87A6E4175EFA5472, 
-0xA876EE8F3102198, 0x4EF3433365159454, 0xA6FDFA09FC077D6E, 0x6B68B47182CAE86A, 
-0xD7C3CA1CF395102D, 0xF1031510F817BC09, 0x3D25160B69C9644B, 0xFB76582EF61, 
-0x4EAD37DBECF9555D, 0x41069D68E06998AE, 0xCBEF521EF9B5EA3F, 0x5731F0D042C34C89, 
-0x2BF308588C7ADEA3, 0x1517A5C6264CAF12, 0xC0C068A694E64B0B, 0x6BD3F411512E7F5, 
-0xAD5659D4045EA2E6, 0x42BF13CA6CA4929E, 0xA9E38D9CFB26DBCF, 0x1943A57CFE70, 
-0xDEF0D0DDCB028400, 0x7019B7FA0DBC938A, 0x211F16174AE84BC4, 0x3190F7B9D1AA10BD, 
-0xCBE32B146B9E0B18, 0x9123D72DAEA46E56, 0xDCC1EE656905F1FB, 0x6F994A1268336C6E, 
-0x611AB3EA6543BF0A, 0xCD206411F4B59620, 0x30CACDF539D50EDF, 0xB9547705525, 
-0xA1A7FAE15D682B4C, 0xE08CF90664C9DDD9, 0x918D1B85912E361E, 0xB42538D5CD21E4E8, 
-0x31105EFAA0701EEB, 0xC966137F50CBD4B2, 0x97797D22B8886E08, 0xCF30FDFD08C4DC4B, 
-0x5778935DCFC6B378, 0x563B3B1031DB0E99, 0xB8DD33F4CF80071F, 0xD934FA068A8, 
-0xA4CD0048D7D812A6, 0xCF076D3732D2E4B3, 0x2EEABB63116C6475, 0xCB1006A9ACE5F339, 
-0xF1E492B8FA26EBF1, 0x8DA2C2A9AB003540, 0xA0D6780EBAB15F3, 0x14AA315D5145ECBA, 
-0xB9FED5487A67663, 0x644C39430A41F5FD, 0xD4F01989FAAD7D1C, 0x417DE65BD72F, 
-0x24D2ED1FA02B8897, 0xB318B64CA36A3C87, 0x41BF967CA8A8714C, 0x7FEE5F7DC22B266B, 
-0x363A8902AF9BBA7C, 0xBE66D622609E12DF, 0x75FCB024F43F06A1, 0xDE612077C86F8F86, 
-0xF8406DABB7BBFD7, 0xA11C657790C5FE7B, 0xAD9CA5AE7D852B35, 0x615F00FA35D7, 
-0x5FE346656DB4D5D7, 0xE17F938B939B787C, 0x4FCBB6BA9A370A3A, 0xC1E4A47F44BF1E6A, 
-0xEF8B56915B55D906, 0xA536674E44883E0C, 0xC1D5CD73BEFD146A, 0xE43DDFCC744A3E29, 
-0x65B1296E4AE2B7B9, 0x8588582801EE51DE, 0x352D438D0BAE4B42, 0x1324CB496885, 
-0x94BC3877DDF328A8, 0xF5688AA0480F6AEC, 0x2632A62FF1998E21, 0xF20E18EA54FED0AC, 
-0x223A02BE9C655A8C, 0xD48CDB0742C864A4, 0xC6AD4C81877A889F, 0x6E818F6919F66BBF, 
-0x131F9D0AA87D801B, 0x363AD581341F49F9, 0xF1F12F4F907D6D8F, 0x4D60FCC7257A, 
-0x9C26A67EA722F099, 0x2263A0B414EEDF0D, 0xE1E08BDC05E5F5DB, 0x79DCADB0D5B93839, 
-0xCFA4041A2BC19FF2, 0x656DD0EC6246755D, 0x266BE20E15AD9A58, 0x623D28758F8935F9, 
-0x84D83AD00675FD90, 0x5D0C3ECA11B14E00, 0xED0AE112AEC9DE65, 0x6570756D658C, 
-0x5E7B9E7BDBD07598, 0xF83E31EA6BB97A9A, 0x52B1EF1B29C84D5A, 0x723100F0AF822533, 
-0xFB2F1F84C32C076C, 0xDF6C290181567316, 0x38031F748529FE68, 0xDEF2DCBC5871DB29, 
-0x457BBA58D4E8B5DC, 0x479388A619FD98F4, 0xFB331B13F54C2F17, 0x593AC5A392F3, 
-0x8FFB06E6F72AC1D, 0x860D3242EBE7028F, 0x4803AA7C78E7EC9D, 0x6560182EFD5D3A3F, 
-0xE1824E414E190B48, 0xC1A304D0E6031B77, 0x514EFF50B06930A6, 0x5A763D1D17C86243, 
-0x7A703F1DFB3152B8, 0x9DF2A55DA15CDE99, 0x81020459989FA81A, 0x4F9ADB430D27, 
-0x50DD9F5BE0D73B06, 0x7BEB2EEA1B57E9F, 0xCFF7FDD15CFCE374, 0xF7A8B3513A64188A, 
-0xDD9C25C5363CC1AD, 0x639A54264EF27B9C, 0xC36C9201685D0ECE, 0xDD4D9F0814BE89B9, 
-0x651E2DD3AC6CA510, 0x96F541FFF3711F7D, 0xB52D69986FE190C6, 0xAD4536D675A, 
-0xDCE32F684CC54814, 0xD8FE05C3C17B2A1C, 0x60EED972D9C65D21, 0xE9F493C1F853C561, 
-0xCC4345231C903B9D, 0xD28A0555F764F032, 0x15F76D0752F89FFF, 0xA2CDAF1290D00EB5, 
-0x370EE5181F7F568C, 0x5BA99D1D33DF8AE2, 0x9312F557003F851C, 0x6B9DC9CD4A47, 
-0xB25B3F04EA2F7478, 0x8E49ED1D1C602339, 0x451647E11505E6B4, 0x4BC8743FDD45E87B, 
-0xA7D9F98202D50751, 0x6834622EB4486E13, 0xEC91C61A24BDF8CB, 0x6FB3C7D5946EBE14, 
-0xE8BDD9E63EF998C9, 0x3F33379AD515FFCE, 0x685F5B213DFF584F, 0x377C24E6E232, 
-0xFA082E618378739B, 0xF3F8D7ACE708838A, 0x479534B8FAEA11A8, 0x9090F1713B91D0AE, 
-0x249CD2EDB47C051, 0x2D48D8A809FCDD04, 0xF0FA9E05BFE1368A, 0xD36692BFE85A748C, 
-0x76737E4345B17655, 0x36852CDDA81E6233, 0x4DF46E5A86031CE7, 0x45EE2BC6C0A0, 
-0xF0DC2BB514AAF55, 0x8FEA4543514D4EFE, 0x7F91860B51D8323A, 0xDC8F84218BC6538C, 
-0x2E17E57FF5583D97, 0x7674337E5ED07334, 0xBB94FC6EB833F7CF, 0x22368A4CEA518B67, 
-0xE8BCF1A998220DCA, 0x8F8A0E944D16E6B3, 0xF0D3AB087E63164A, 0x5B308FB6710F, 
-0xDDCB525A662994FE, 0x33D8BE26F8D58D, 0xE5737729FE8D5651, 0xB1F1100BAA51B15C, 
-0x3E085763095A9979, 0xD82A893BEB6AE30B, 0x92033D3E88B15F55, 0x589AE105A4BBB515, 
-0x485E35B997BFC6F7, 0xEC28DFC645EF9C35, 0xEA9E9895545CBCE5, 0x10C20620DBD5, 
-0x4670C1E392B669DB, 0x6CCA88DD5943839B, 0xA902A341552E457B, 0xD0E13A87BB8E96BD, 
-0x79AA37D373ED317A, 0x5135D6655FA2812E, 0xE2085EB76A60542B, 0x711966944B5776B0, 
-0xFF9F9168C91842D4, 0x9C011C8922DD3388, 0x482B42AB2BDADF9A, 0xC6692F61A62, 
-0x71CB7D795A17E3E8, 0x2F63823391D34123, 0xF593D2EFB2097B30, 0x4048A4C31124DAC3, 
-0x8EDDBD58E1767B40, 0x7CC6EA4F61675E4B, 0xA503B3C64F58D0C4, 0x93926CA92E3F8A30, 
-0xF6550F77BABC147D, 0x699B19E4C444721D, 0xBF43F37A015A3B19, 0x329407F15954, 
-0x430B6E4D2C9785EF, 0xD769602EBE46FD99, 0x1B3313E5968918CA, 0xFBCEA00EBC3F3851, 
-0x3300A669D3C758CB, 0x6D75858D5304A5F2, 0xC363B4D5C6AC547D, 0xC08FDCF38440594D, 
-0xA27FB8D632A8928A, 0x8EDDCDB0978D515E, 0xB9151CC21DBE7200, 0x418D91DFE0F4, 
-0x7F432008EF27E2E8, 0xD62FF7B761E10E3, 0x6B4619154DF440CC, 0x99E975AF82BF19C6, 
-0xF980278DCC669F0A, 0x7B635A38A3DCC455, 0xEA69B5B25AF785DF, 0x1214F555CF96CD80, 
-0x74396F6624341E80, 0x5C89223DA4F9C641, 0x6A6186FF11787995, 0x5A18604C394D, 
-0x229036918A63D781, 0xC10AA8E90BC38B37, 0xBF48468505A2C244, 0x590331E5641E8277, 
-0x48910F2963EF4D97, 0x6CE843659D456625, 0x137F641FF88F2AEB, 0x3487B5F6B6A1E9F7, 
-0x11B5C1D6BC9554AE, 0xD17CD2AACFD826A5, 0x6D00D6D1C6EB12A9, 0x23FBFA567D2F, 
-0x4C0D4653402DA1D2, 0xD4D884F843A63715, 0xA580B1E0270EC47D, 0x28D0E02C50E69264, 
-0x51CC186012107925, 0x78A2C8F67F28F260, 0x74A662A50DA30, 0xAC3BF8E9894E0409, 
-0xC80B837A19CB4C5D, 0x577D2AECDE8FC683, 0xE5681F01CB739B3E, 0x67C60525399, 
-0x255263FFA5D0B91E, 0xA0E83B50D9A45B21, 0x965F7BAA1449B97F, 0x195670C7AB811BF0, 
-0x6FBC34C3669F99DF, 0x894AA3D0C683A94B, 0x14C44B9A009BA969, 0xFE94AAD98AFABA6E, 
-0x22D3722035CB3DA9, 0xF038C24FE9F4413A, 0xF236ABF14A962E88, 0xB33279D7FA, 
-0x243740419B9F7B20, 0x84C10264A9525CA1, 0x346B10AA1A90152B, 0x4C6E7A748D02EF2E, 
-0xCCECCFF36BD1EBA2, 0x6F3C98C5A8071E9B, 0xF481DABC22F486C3, 0x70024732179F5A7, 
-0x5BFFFA1D67A78A9B, 0xF62CC8881F421088, 0x77F9013D47011A4A, 0x65D571B9524, 
-0x89AA22DD3C7E16E5, 0x888C6F2186E9530A, 0x27E875F48D83752F, 0xBF814E832C2D8658, 
-0xA5084A439F741E89, 0x5F7A015AE7858A36, 0x5E50DECFA4897A3B, 0xD6AD43626D3D185F, 
-0x90056405B0C511F7, 0x139F9E3F69D56781, 0x738C7FD835CF06BE, 0x44C46B4456F2, 
-0x4A05451C92AA7B, 0x3EAF88CFB14AAC09, 0xD2FC1114543698E3, 0xAA6610B4A85758DC, 
-0xB3407FA364E119A4, 0x5A4871300DA27BBE, 0xEAC49676F0F7CA7B, 0x67AD211D348BCFB4, 
-0x297F278FA8AF1152, 0xB4C658DDC574EE7E, 0xC4AA0A08514F04ED, 0x1841B259ECF, 
-0x5599362C22B721D0, 0xC765ED0BAE83F151, 0x277F0D8110D9D9EF, 0xEB8726B5D94751D7, 
-0x7C644CF7D4C89535, 0x898CBB2BB185A299, 0x67ADC85303F8F24, 0xD44C2C9802BB7135, 
-0xA0095DDEF749FCC6, 0x51A7E1F60B80F635, 0xFF0A8DF788B236D1, 0x4694B40CF036, 
-0xF1D855F008BFEB0F, 0x8659DAD97FF9E238, 0xDEBE6176A0C78C2D, 0x9CB6C6892996294B, 
-0x633F6CB6940A0B7B, 0xFBCFD92403299FB4, 0x3830A4689AFE2ED1, 0xB8D4DC29E62CA30E, 
-0x84EBBE6FEAE987B3, 0x6925653D4D7C603D, 0x23498F872A733736, 0x3398A73532B4, 
-0x193E555FE8BA564C, 0x6C1BEE6C512E0473, 0x2156FBE10070C2A8, 0x6887389764F90642, 
-0x34D4ABB9C4971E5C, 0xCF929C0B00457614, 0xCE3A1CFDC0D2E5E0, 0xBF2F32C9DB49993C, 
-0xD3837D24D6282451, 0xF405EA712B1E832C, 0xAAE6EA1C619FA5EF, 0x29D89EB0F7DB, 
-0xE94372EB2F7B59C2, 0x41D3FB6CCDC1F1C5, 0xCF9AE938AEB4BC15, 0xEA115E61AE35426E, 
-0x6BE0F104338D3A31, 0x105F7A6FC2053D74, 0xE6D25D1F2A8B4877, 0x9413DAF3A3BFDBCF, 
-0xEA41217030497C2B, 0xE4C26DC0A8E4733D, 0xA07966955392E1D2, 0x14B36F910633, 
-0x8538DA1D6673344C, 0xC7D5D2493247C480, 0x50B3E7D3E349F017, 0x3480664A55860FFD, 
-0xC84F47969A05C938, 0xF5CE56BD8B77B5EF, 0xA6BB4B5EA16640A9, 0x7F885B701FA478A4, 
-0x9CDED673A3DB14C2, 0x6192B0A7080F772E, 0x39BB14556A4CBB34, 0x4D0B454729CD, 
-0x28F637BD784D7654, 0xBD1471761FA688EB, 0xC525C3A7F7BB0ED, 0x42A2FB44101608BA, 
-0x2092F32EA2EB03ED, 0x6A9236A5F1F6C6C6, 0x18FF53B6E48646C6, 0xF67D178E0D46B83, 
-0x20D1CB91E383DF43, 0xF0694D6BD539F8D, 0xE82A3674211D2ED, 0x1D53E3ED46A, 
-0xA48252C53D40178D, 0xEBAB5E0E3509462, 0xD1E92D9493D41214, 0x3D2D740D9F0C8283, 
-0x56E2B38475079E67, 0xCED868C98CF4DA55, 0xEBAE02B9F0C06BBC, 0x59BB828F8BC1361A, 
-0x455735B8984E876, 0x92A547E38F07C35E, 0x7B8FEC0F334DBB83, 0x268F30CEF211, 
-0x4B24AF4BD8F11A09, 0xC570C350A1F73CE3, 0xA95937B39E1F3A91, 0x7EA10D605A48DB10, 
-0xD39B9E5721750E70, 0x56381A6BB2A505B9, 0x348894F5164AFD16, 0x41574E2EB9787B5C, 
-0x755CDEB182A6761B, 0x93C84807192579D7, 0xBEA3E91B1A39F5FC, 0x58B91E783FE7, 
-0xDFC2BA79CC66E65B, 0xEADB6E0A8F163BFF, 0x73FEB3EE239433D4, 0x51B84BECDB43773E, 
-0xDAB678E2C1EEC61C, 0x2D04476BF0B72098, 0x7E40F227F47F3DE3, 0x1DCE95C29E3BD721, 
-0xD74AEC24A75B89DC, 0x819A39CA67A0A0DD, 0x8F83B1ECFA19418A, 0x45BF34695376, 
-0xDC43DD21D3000950, 0x2A35DE0FDD339B, 0x2677A66EA313975C, 0x20F80DDD62CB08B, 
-0xBD2C248539820DA9, 0x158BC0B4EFBD5965, 0xE81BFBE9CFB8218A, 0x1B1C108F627A76FF, 
-0x8892643B79E28386, 0x4A416F181436EAB2, 0x2F4CF85B88A816C0, 0x69FF8F465447, 
-0xABB4094152C83DDB, 0xD7477054DD47CD7F, 0xF41DADAE75312DAC, 0x995EB87121F48897, 
-0xB547ADE45BA816AC, 0x8D64B626D00C556B, 0x8D214DC0B2E248D, 0x436A5A801C827FA8, 
-0x1E033134F3A84B5F, 0xEB353D11FAA78D0B, 0xCE0494556A777699, 0x358056EF8487, 
-0x2D410E3F2F5E95B6, 0xF1067F1FB7C34438, 0xA9F60F271339D098, 0x4FD1B716FA9859C9, 
-0xF10C74BBB7A1AB36, 0xCECB65A1AEC53324, 0x176B9C2E268D4AD7, 0xF5D03B334A52C372, 
-0xFCDB01789C378A69, 0x89EA1B1B330CC31F, 0x39644A4C4D47D55E, 0x23C0D03F582F, 
-0x805571A9D78D1779, 0x7206B243BF7AEBAB, 0xA9B33C3472915C50, 0xAECCF989609B99CC, 
-0x724925487D8CF33B, 0x548FD7E44CC7E0A0, 0x2E2A292478DBFE86, 0x215F0F81CCB3C45F, 
-0x4C893162D5987F17, 0x4A3EF9F06753CD79, 0xD1AA688780D9A306, 0x2EDB88B2F282, 
-0xE38EAEB50770BBCD, 0xBE4FB43FDFA00A9C, 0xECC2A7AC51E80B7C, 0xA94FD8635E84388C, 
-0x8AEAB14755FF2178, 0x77BC99E1CD482103, 0xDC96D9AA0032BA3F, 0x24B253A847BAF7BF, 
-0xC3BF02830990CF48, 0x8D6B14AC2C1EB91F, 0x78BCA2A01CB093BE, 0x3E60B5A2A04D, 
-0xA56B552E1DECEC1E, 0xB6E86E38E4010945, 0x303C17D4C61BA33C, 0x29933C4092114A97, 
-0x5814B6DCEBD00AB9, 0xE3115AB39DA7F29E, 0x5A994A644A97EA6B, 0x810A5F57DEA818FD, 
-0xD0511B74AD265C50, 0xD4EF5BEB2F8808EB, 0xFB332BB13A2AEF5A, 0x2516C3592C80, 
-0x2651E583381524B4, 0xA8446D9838E32718, 0xD791759BC53D2A76, 0xB957E722F8F866C4, 
-0xD2A7EB534DCFD771, 0x504FE46A4C1A2938, 0x1BEB5F162A980550, 0xA677DFD8BF051A5C, 
-0x1700F95B09034E55, 0xAE5FD7E967E55C00, 0xA6CAF088F1EE3671, 0x4482B090DD4D, 
-0x4BAEF8B6E40971E1, 0x9C824B5F2E456CD9, 0xF197892FDE1D7879, 0x21726F3512377FF4, 
-0x4DB1A77FBB63ADB2, 0x6E8D3F8A06867991, 0x29AEDD78B7A52F03, 0x1A380EE384A03777, 
-0xC6C99FE32C19F395, 0x55E42D1F07949BDC, 0xE872B80117833595, 0x2AD50619C773, 
-0xD33DD724D505F3B0, 0x9FF4291297446679, 0xF0D83CFB5333BB4E, 0x28DC2F56AE33E3C8, 
-0x8255CA770885477B, 0x4D8518853180F30, 0xEB31B5D529E83D70, 0x8779C9788DB83213, 
-0xC5499187FAC978B9, 0x3AE8F7CD67121437, 0x506C2446D37793F4, 0x35D15260FED9, 
-0x3897C42428D4E025, 0x94A30AE91587885A, 0xC07D3B03AB7D2C6, 0x850C7B8326943861, 
-0x40D1E4B97FF8C17B, 0x5B7069176C5EEFD0, 0x3B4E14F41D4B1597, 0xBDFE3608EFE017E, 
-0xEB11AECD00821C3, 0xBF99B1ADD96F8ADF, 0x67C84C1B33FA4900, 0x65871959A96B, 
-0x6EED057A13BA2589, 0x8820A0A3AC21E6F7, 0x17498B679D42C768, 0x647B6B4B6B76C06, 
-0x977EB9E49B27B0D6, 0xC06FB0959BD8E273, 0x58D0EA84C6FCAAD0, 0x269AEB5145D30FB0, 
-0x38B5587790AA05C5, 0x7236BF473431B12C, 0x94D003777C88BE95, 0x328D6E816B0D, 
-0x632B45FD673538B8, 0x3F365E9C08DF72A7, 0x71DD4E57312028C7, 0xA87C76910E69F0FB, 
-0xC5C843BA53955FC2, 0x7E6F41241C748902, 0xB70804F33CCB189A, 0x2C5E1B1C77ACD93E, 
-0xE1627F384C16FE55, 0x11D576993592A1F4, 0x17D32F63E1424F10, 0x6D4EA76FBB0B, 
-0x8EAD9F981450CEBB, 0x51F2D425F691A46F, 0x215B641B0C0793A6, 0xCDF0C9C431AB78D4, 
-0x1DC803EFB0BB9099, 0xF965AB15FEEC1D55, 0x62FB4A365FEB7FFD, 0x955EF910E238678D, 
-0x1623173704E61D58, 0x5AF11AA478D6A4AD, 0xEF9DAF24586F1EF1, 0x6BD0CE39DAD1, 
-0x7ABB977244FFBFE5, 0xA3279FC043027601, 0x3A16E4FF4EBE6BED, 0xB011FF4429A14F42, 
-0x1267A6F12360145D, 0xB30A7786FDD38AB2, 0xC0DF035BCB7DFAFD, 0x2EBC02FE4C61D9F7, 
-0x53323E0D76A5228, 0x894CB7EAFB8A288D, 0xF0FA578D4CE77506, 0x3E3D9FDF6113, 
-0xB15923D1B595C83E, 0x9DFFA03C1EC6B0F7, 0xF4C5AE58E979A5CF, 0xE2382A0BFA00FD1B, 
-0xE077C23C215B3F67, 0x4AEFB30B4DBDCB05, 0xA6B56A9073A45005, 0x438470CBC431ADFA, 
-0xA4000645D67485AF, 0xB0C358B17AB64DE3, 0xC34451546EEB3E2A, 0x64023787A179, 
-0xE07628B2B143BC9F, 0x2604686186D8644B, 0x58E1F52697707C65, 0x925A430E7A9CE177, 
-0xB0B09B1A75F2F00D, 0x973C87A99E29FEC9, 0x445B5C4EE84BE744, 0x55BAB88F11F6AA80, 
-0xD6E4D768CEA544BD, 0x842DE3C06C7883B9, 0x2D5F8B6868CDA6B6, 0x1C1D5BA2177C, 
-0xC72564782AFDFAA9, 0x11B949E4E323CE2F, 0x424CDA6989B4CFDD, 0xF63E4967CF7A1CD5, 
-0xC39148D217E7B1E5, 0xA4821C6253EF032F, 0xCB7170483B0F2F18, 0x339E124787AA3A11, 
-0x63402EA49788C7F5, 0xEB70E0731F581516, 0x63EE79A2FCA402A, 0x34277633FAC6, 
-0xC74C334AF46E38BD, 0xED7971B9E9EECC07, 0x7D3CD784C62666D0, 0x5EA222F0C33CF88E, 
-0xBDAE1A3DD2CCD8F9, 0x3DD46C8A5B6A2783, 0x8E868BFD3953AC8E, 0x59EE455B056529F9, 
-0xBB6135AEB18D8AAE, 0x706AFF64EABA592B, 0x7BC51DF103A03E3D, 0x18AC9181057A, 
-0xD8074B0475405D8F, 0xB0E36EF8CFBCF78D, 0x73A3636231E05526, 0x39AAAA15E04D46B, 
-0xA00EF3404BF2E6FE, 0x34697D38049E0AE, 0xEFFB23E918BF18E5, 0xC422FF0ACD04A2EA, 
-0x3F2FA105D517E147, 0x89594323C2EBA5D1, 0xB5C96B582E3F4B0A, 0x5945808D71FD, 
-0x189A8D08CFD54819, 0x349C2D6E0C8A8418, 0x2E40380B61BFFA6D, 0xB59E292499C60461, 
-0x25ED57C8E9A81A6E, 0xD7CED7A1F093023, 0x79EF096C9BD2060D, 0x498A2159C9BEA19E, 
-0x8FACB89C2500A3BB, 0x8F34BF57FAB7EA1E, 0xC049749A2D7B641D, 0x4AF6BDDBCA12, 
-0xDE35BCBDBE5337AC, 0xB965FED582767C76, 0xD87A8517BA2569F5, 0x404F7DAEF02E5543, 
-0xF4C24769C0C0E68D, 0xEDFA2ADB304BEE11, 0xD1825AE0E4A0C33, 0xA8857CBA3159BD6A, 
-0x61A0057A28BDDBE7, 0xF04A7C5200876A0C, 0x9C559EFB628016C4, 0x2C18E72BD976, 
-0xFE83096F69ABE87E, 0xADC956F9654AA1BD, 0xFAA07902DA1E9020, 0x7D73BC6DF66537E6, 
-0x6144AC9570487129, 0xFB6629E7D3EA9733, 0x57CFB8E8A75F4DFE, 0xA808EBB5EBCE8429, 
-0xF0391AB222AA4A2F, 0xD718C7D2E1EEAAFE, 0x1C597FA9CDE3518E, 0x2C850369EA00, 
-0x465AA3B0FC83F11E, 0x94B914E4DA292B8, 0x104D8D5F13CCE11, 0xD44C634AA27DE875, 
-0xB00994D3B72741B2, 0xCC22303976065906, 0xA0B1CB1EBEAB74D7, 0x79AAA6FDC6DD9910, 
-0x760F59C30CA77C24, 0xD1ED1DE4B435AB26, 0xA51BD5D0881FB678, 0x4D0324BA4BF7, 
-0x8AD6BE6B12FC45F2, 0xF8574F5ED97654F9, 0x1CEE64FCB8CA1CC4, 0x8EAE5F232F0B9595, 
-0x1141F536230CFE79, 0x8EE6E7307A4D74F8, 0x54474735ABA9E1EC, 0xB3AB9FF706386588, 
-0x2EEAB65415ACBEC5, 0xBA726C2D07787A5B, 0x799935F370F2C4A4, 0x121D78672C6E, 
-0x1824543FE0EFA328, 0x77620DAE87BD3172, 0xE95A4D36ECCC4A1E, 0xD7F429E2F9A9F510, 
-0xF7AB47E9D2EF8503, 0x8FEE87DFC87D22B8, 0x185228F0C3899358, 0x74FD0D92BF15095A, 
-0x9E778DB7EEF260FB, 0xBDF9C2FD37B48335, 0xBD4A9A7DE46A6269, 0x2D306917BFA0, 
-0xED83E0AF300A5B7F, 0x5FA3D9EE26AFE86E, 0x694F28535A7EA543, 0x765EFAEC647DB37C, 
-0x8C78120FFFB5FD3A, 0xFCD19ECC39D32745, 0x82D49839777F3D2A, 0x12FCC096402E6CE5, 
-0xFDDD747643FA9645, 0x264F751AF19CFA3C, 0x4393F41EBC6D2BCD, 0x649B9752CB53, 
-0x825794D60EADDC87, 0x57D928FFCAD20A89, 0xFC69A3BB227453E8, 0x658C3108DF578E57, 
-0xEC6A6DF95D68464E, 0x3E76976C9C602FF, 0x26FB8B73544FC3AB, 0xF8B3167B6645FA65, 
-0xE6EFDA3FD9BA02F5, 0xFCAB83790D39374C, 0x311596B1F7D5B065, 0x24CF43879803, 
-0x95EE9EEECC9182C1, 0xD30885D1653DB0B, 0x68A8EA7385FB3F63, 0xBF05AF802176929E, 
-0xE0AF59B2E4FB0811, 0xD46C1B8AA9DAC906, 0x797608D2C17CC6B0, 0xCAC29CD05B498468, 
-0xD8172A7DC4B5244, 0xB959AD8C98C478EE, 0xBC0C8581BD20A218, 0x62EC67C69677, 
-0x92CA8E9382C791EF, 0xE1A76612BB4C55DC, 0x9E9285CF1CAC1719, 0xA5B5D2DA351BB409, 
-0xE0EF490CFBD59E5B, 0x8E9416C70C0C868E, 0x6E92C606B84F4960, 0x94A00ABD9197C4FE, 
-0x2333EADDADC9EBBE, 0xF775C3459121E4CD, 0xE602FB88AA5A8E3, 0x34B3F6D52B32, 
-0x26299E0541252438, 0x5BD84B266C5C63A3, 0x7B740BDF9A3F2290, 0xEF8BAF7ECF0C6808, 
-0x99E7C2274BC81DF7, 0x30C07004ED189906, 0xA666057C4B543978, 0xE3B65EAACEB8C350, 
-0x71BAC3550F02E3E9, 0x8C0412E00AC3B785, 0xC62FA64676234F07, 0x665613E1C6CA, 
-0x8F21579F79D9E312, 0xB0560BB7EB004A57, 0x99A77643DC172A8A, 0xB371406F598A7F3F, 
-0x62042D38DFA9F1DD, 0x2B1732E2AE44ED4, 0x5399E1CDC7DFFDE, 0x8CE884878A743A2D, 
-0xF553CFF972DF8692, 0xCF27F6E2F649658C, 0x14724AB1C60322EE, 0x334CF191E6FA, 
-0xD2898454B904ABD1, 0xE129FEC9998D3A8C, 0x14F472EF48DE1EA, 0x74D683B4CC89A196, 
-0xF15CCFA55A6156BB, 0xD0092FA171918966, 0x253BB23629EBC5D4, 0x8F157FAFCDE75D0B, 
-0x5062312081AB0858, 0xF0C0D6B25E4105B6, 0xD34CCB1790800014, 0x5913E2917A59, 
-0x36F69DB994288722, 0x4AA87CAEF510E70B, 0x5E9CA92EB5E8CAFE, 0x39D0B2547590CB47, 
-0xD52DFE3F250170A1, 0xB2855E26385105E8, 0xD2A93B80C3E5F16B, 0x3B909D4DAE51C6A4, 
-0x13072303657C43A2, 0x2E5E811B9F96A64F, 0xD3BC4F9105D08E5A, 0x222199F49F81, 
-0x172866293DFAED81, 0x38FB02BF9FF55576, 0xFBB077480BD110F6, 0x36AB74420D60056C, 
-0xE7B0F2BECCFA7823, 0x19C74DF6DEE372A3, 0xDC5D7E4AEB366940, 0xF774FDEF1B9342BA, 
-0x619C3C662C2F546F, 0x2EB3087771D22B82, 0xE9D78B9824228B2B, 0x35A8B9762766, 
-0x37993F99C3F03AE3, 0xE377ED828EA1E447, 0x55DABFD5C7BC79D1, 0x50D33DD83F1B0D66, 
-0x9E5D6CC8E1EC9BEA, 0xBFD06B10C30C6B1E, 0xD7967A1006E9E0EA, 0xF4EDB40EADEE93B5, 
-0x7666ADBFA5CB924D, 0x4D6FF54A0DE67C0A, 0x61589D7666454F3C, 0x5B83BC893E5F, 
-0x62563A922C09DC4B, 0x7765E66DE8656FC6, 0x6ABA9318F0430A4B, 0xE382837B80EA4863, 
-0x31C90D158BAC991A, 0xB4ACC87DDBDECBBD, 0x454B2E97038905B, 0x7C9707B1122A5294, 
-0xC74B65469058850F, 0x323A16FCC7C283, 0xC94E52444A7708F8, 0x3751C65F2E2C, 
-0x5538A26462513BB7, 0x56E1B94BD33D3315, 0x25F84942331C041A, 0xF55C9C62BE2802B9, 
-0xD226E4D2E084D367, 0x7A17D3F840201A61, 0x257FFBCC45009D84, 0x299662C8C1840235, 
-0x89530D8C44D44694, 0x80D0BC2105EC398E, 0x6B77D99655CAD705, 0x6D0410A20E6, 
-0xBF0D528D82DC90B, 0xE9AC2A4DAA045C80, 0x6A2678BE7B28AE41, 0x90B5E6C5DDCE0318, 
-0x4EF21FA3231AD9D4, 0x96C46057F61B6DF8, 0x9975393ECB0D19DA, 0xC10FEB6B22DA7EE4, 
-0x866CFAF509B8ECB0, 0x85A283C6AFA70A6C, 0xF8BC582723B958AF, 0x45F5B45EAFEE, 
-0x69E3ABCE403828F2, 0x4287B619B91661BD, 0xFD39ED47E32CB5D0, 0xE53B6C47D773F6F1, 
-0xB2FCCF14D5935EC3, 0x2B4CE00A910F0794, 0x5D89C50872C7B766, 0x61E6675DCAF2A978, 
-0xD8A32B13FF1DDE89, 0xA17EF235CF72BF8C, 0xB82081839FDC4426, 0x2BA7F5910611, 
-0xFF96B97F255219A0, 0x7C8E70AD6A49EC0E, 0xD3A53B61B375DA95, 0x9EEE8F8247011606, 
-0x9E0BF7EB19E80FD5, 0x7656E51C675E6BE0, 0xA54362F2C191D3E0, 0xCE89823C82396367, 
-0x39BBEF2599DAE188, 0xFE77E5F075F796BB, 0xA5FA2C5F79E6A84E, 0x48051A20DB62, 
-0x2C15A89FC5F8D436, 0x46E60912A6EF80F6, 0x6635AA99890379A0, 0x3758E458E450B8DF, 
-0xB3F01760105B091F, 0x77623ECC08B6673B, 0x4D2CA9F7019B392F, 0x4EBDECD91A81E006, 
-0x69AB1A68D3A8450C, 0xF97C2EEC61596112, 0xD30FA8A86B89A5F8, 0x2F15C75101B2, 
-0x7AD50230B181D886, 0xFAB5BBF915847676, 0x4014ABF115146BA9, 0xF8D99DA5DE2DC1D7, 
-0xDA2FCF22EFB8455D, 0xD3EA1FB2284432A9, 0x50FD225B46748888, 0xD0ACC67982AD460B, 
-0x1AD1F959F6800A2B, 0xA1490081B7798A3B, 0xB1E7A49900F37FBA, 0x164733F0C299, 
-0xF25A004B4F8C58D0, 0x84DBB94F28EB143E, 0xA808676FED208DB0, 0x4D43947DB9EA512B, 
-0x8BE7F79B5C76BE, 0xFBB2990256D5FD83, 0xF9EC37DE6448DE70, 0x712E322365AD3635, 
-0x98074A8B31443EBE, 0xAA79AC17A403AAF1, 0xE4971EBDA1B7FC2, 0x16240D0D8112, 
-0xF8F62FE146E46DF9, 0xA17255A3D50821E0, 0x66A9DE103E5F284B, 0xA0A66CA97AFA27B3, 
-0x98B4EEFE9B593275, 0xF5DF6D7273EFF565, 0x525FDF027658BF14, 0xC9C29E5CAE756B67, 
-0xDCE4976768B97A90, 0x4245BF9CFDA67981, 0x1E760D631E20B572, 0x5FDAA83D862B, 
-0xEB00EC7C52FB6AB8, 0x2D4997B6BB5961C8, 0x41D51409390C598E, 0xBB6498999045C8F2, 
-0x211175FFDB1ED179, 0x810993C35C573405, 0x63D828F49F24E228, 0xA2A4A469D3224ABB, 
-0x8C12E437ADF8E633, 0x944B72843D3B3A81, 0x9C3C1AF122B51A5A, 0x2A8F9DEFA8B2, 
-0x8EFA9D8ADA1FF757, 0xD44742151FBFD26, 0xFF2CD4445491C5BB, 0xA7C6BE731C53AED3, 
-0x4C9FF8942E9243A0, 0xCF0AECC4B5627ED7, 0x24FC1DA5FD8F7993, 0x4DD81029CECF3845, 
-0x3BE57978684947DF, 0xE9E604E8CFE41B96, 0xA454254FFFB7B829, 0x67EB45262FCA, 
-0xCD3EE2C24C910C62, 0xA780A3485CCCDD88, 0x4D0B0E16650BCC08, 0xB52B9A70AB4B2C3B, 
-0xDBB50AD28FE8D676, 0x1215CF3E467B3864, 0xF15783B1B9832616, 0xA9B8AB5E7866494, 
-0xB9F25FF7332F6893, 0x56D75F1C229E52D9, 0x5D24149D80FF04F3, 0xCF1954895D4, 
-0x4E2813586F8271F4, 0x62E00CC11139D6DA, 0xF4450F00468598E5, 0x126425AF71814514, 
-0xCEE67C3D4101CBEC, 0x51519525BD9766D3, 0xBA56C996D48C522C, 0xF941DD289E57FBC6, 
-0x32207F7356BD7D3F, 0x59A3A22613EF7C48, 0x64DC68CDD9FC7C61, 0xA33148CD74B, 
-0xD4A4520D024AC049, 0x7A23F745064CA1D7, 0x1B3A5F6EBFB3FCDB, 0xF8C792374F130EBA, 
-0xAA2AC4563A498612, 0x82E360F54A3529A2, 0xB9234CE376ED443B, 0x8220CBE364AF3D95, 
-0xAC73F2EEE61BE4F, 0x4AB23DE82F81814B, 0x7A00D2EF56D92EF4, 0x5197F67016A6, 
-0x27072CD0E7C9B3D4, 0xC1D588FD50ACEB93, 0x9FBDACDAC9EE69C1, 0x8BD362B9656D565D, 
-0x5CEF0FFE1C9F2471, 0xC3694C851695BE3E, 0x556A6B7A5A4162E, 0xAD43ADFF82431CAD, 
-0x8C00F0364E05A9A2, 0x98F21EE46EFA741E, 0xEF0670CFC538FBA4, 0x2565135B34F8, 
-0x972C43B3754773E2, 0xD199E332CB471A0, 0xF816AA80DB8081D2, 0xC443FC21BB05FCDC, 
-0x5FAE6103B239C346, 0xBBE693A4BD3A2AB3, 0x438F9C06F3D17763, 0xC799385669E02146, 
-0x4CC47837A8D239C3, 0x7CA4165939DA17B8, 0x3BDDC69EE6F6B2D5, 0x39BD1D8D95E7, 
-0x2E8304423808802E, 0x7A5153B7DD99F81D, 0x3EDA47F7D0A78081, 0x508FB18383A86E02, 
-0xADB07CD91F5501C4, 0xE88D39D2571C89B1, 0xECEBA1AEBA110998, 0xD6504B7EFEAB7624, 
-0x4989C98E5BF8734D, 0x445EA69373BAF3E0, 0x11EBB94C3503FE2, 0x34AF452ECCBB, 
-0x30810C4C4D5092, 0x5ED5271A085F486C, 0x2CA9A3C6B99669E5, 0x7685D0172069FDE1, 
-0x8C0741FB74ABF05B, 0xC442E31D2CB4D838, 0xE9A77C35E596BAFC, 0x7920109BC1940AC, 
-0xACC5A384923F6F18, 0x83B6F466331C1FBE, 0xECFB36F6ABB4D7F2, 0x62ADD12F02E6, 
-0x856091211428BA59, 0xC95611FB1DB3D7DA, 0xB2E8CA1F5F3E8AE7, 0x6A8C707B12D744C8, 
-0x1036A97113B78F6E, 0xDDBF004A2EBD28CC, 0x45C40B6E0BA9D8C9, 0x34383C5BF62E11F1, 
-0x63E514395A124373, 0xC9B1898C7A8130E3, 0x265C5FACC6D2BB7A, 0x34247FEC0EED, 
-0x13AD2292A38CD7C1, 0x4B5C87213CFFA770, 0xE08D577A869C514C, 0xB39BD06C1A57277F, 
-0x471A976B153B9129, 0xC1289BA1D6226E47, 0xDA388F1700C52F79, 0x7F4CD8E62002E152, 
-0x94F003BE0E9B58A1, 0xC3DE09DF4B1FAD5D, 0x5576840B66B926F, 0x5BB78406B4F5, 
-0x5FF5EEF8D64DDB96, 0xF588F6F602543A0E, 0x3E392A4B4CAACBCA, 0xD71D909C3E98B65, 
-0xFC3D42F1254814C8, 0xC6A08D76FD8A0F3D, 0xFEB270E3F24EC8ED, 0x250C6ACEE22F689A, 
-0xA592E0792361F60B, 0xDBC992E72363DCB0, 0x211A43D16BD67571, 0x18033E9277DE, 
-0x131720EEABBAABB6, 0xFB4F9059CC228C1B, 0xD52422922CCB207F, 0x56503E268525995B, 
-0x6BE2ACC8FC515B3E, 0xB46316FA6AC5B5A, 0x16ACCB598CCDE064, 0x681B71AA20C855A4, 
-0xA1B8DA3372F43D21, 0xE946FA1A203A98D3, 0x495374176C77988C, 0x33CF2A467805, 
-0x27961B7CDDBF31AE, 0x4943115936794192, 0x3F8324FBBDAF84A0, 0x9618C4EF13E9A6D6, 
-0xFC9549A5CE25EDD, 0xD854043A989813C1, 0xE847698126F6BE06, 0x5E9A6DF91FC9D232, 
-0x3275A3FE1995ACEE, 0x626CBBCE3EBB99AD, 0x7850876BD3062EA4, 0x5EB3B3A9B5F6, 
-0xF8BEDBD94131C3D7, 0xF5A6EB4114AA850E, 0x1C0C205FF3A79B10, 0x130BDA6882CFA7, 
-0xD1E82E6EFB0318E8, 0xC1532899C69D787C, 0xE87AFF8398519C40, 0x77D9B034E213BA35, 
-0x5601B8FF4518E4A8, 0xDB31BC289D40BEBC, 0xCCD5929D42374E93, 0x420D76ADB609, 
-0x4B6A3E2ED555532B, 0x1EEAAA1D2FBB8B9A, 0x3F4E2ABB87512FA1, 0xB4BF918F3922C87E, 
-0xC19242BC87717CC2, 0x57EDD8851827695D, 0xE1DFC953B39591EE, 0xB62AD213EB061954, 
-0x132B359CA9DFB117, 0x7493490B87731C37, 0x6391AEBFD2BFB72D, 0x435CB9374A8B, 
-0xDF09F03548B44B40, 0xB324A34DB2AD0308, 0xAFE9DFB5059BEE46, 0xDF3EFC510B831CBF, 
-0xD54574A167B98E07, 0x1AD484807B33D36D, 0x5590EACA886F82C9, 0x1BA44EB95480C8E3, 
-0x7DA517079000122C, 0x9BE9111DE1DD83DC, 0xE9B3D60B83DA0F6F, 0x5B2C648AA137, 
-0xDEA914E51B2D0932, 0xEA432E0E7D184E7B, 0x462338D3E139B294, 0x9F0976E292D88830, 
-0x558D839AF509618A, 0x7CA10F3C49C678E3, 0x3A58606FE3E52FA7, 0x15216053191EE121, 
-0xDBA70433B189867B, 0x2EF412F454E3188A, 0x3EA066EC9858482, 0x52FFB1C68AB3, 
-0x1DA37D6122CFCE08, 0x76D86E99CDE2AD1A, 0x7ECF76BA7E5FA3FF, 0xD51338AAC6083ADF, 
-0xCEECCD5B503BFEC3, 0x9FA7CA7312EB3E28, 0xFED48703B8D678F1, 0x32A5F4B40CE0E2C6, 
-0x48589F1111EA5E2, 0xF7715BCD7BAB8E1A, 0xAA9A383740548549, 0x36F5B845A102, 
-0xB9E5F511F5CEBE8E, 0x197877F5B3E0B1C, 0x1B97BFB558BDF155, 0x7B000434B529C862, 
-0x93FDDFFEA9C4BD7C, 0x987380DFEE02465E, 0x901C68840FF8ABA, 0xEEB3E1F996B3A638, 
-0xFA86472608951F3B, 0xC3A55A51E1058FFC, 0xAAB3839E91171DBD, 0x6DCC659A6A24, 
-0xA50FECAFEC629C4E, 0xF31DCC3E50840F35, 0x93C02CA7967476F8, 0x3D433D6106A67D27, 
-0xAE4B48E4689FCB20, 0xE9025B3C29A8CCE3, 0x8B3D96B4F3B7DBD, 0x17E5E7E27E517166, 
-0x881603C1DCD246C4, 0xEEFDE8705E4EB0E8, 0x2F61127267753D4B, 0x1976CFEA7A49, 
-0x1265BFA37FE2CDAF, 0x5208586A0515ADD8, 0x71680B7AA86940B4, 0x1B7508A83F38E4B4, 
-0x5B56263350942CA3, 0x534BEAE7E3F49242, 0x8FF0F02C33611FFE, 0x2CD605437F1A82CB, 
-0x56E4C1DE1283BA01, 0x9186088CCEEF430C, 0x1E4D194E5C6F4050, 0x42C5C843917D, 
-0xAC43355D0D388C95, 0xC8290CBC2DB21849, 0x5942DC8D3D3D78EC, 0xED7EAA5B374664B, 
-0x1955ED6199A78A02, 0xCAA3535AC8B10890, 0x9320C5B858C8DCF, 0x7D1F70FE81E5140A, 
-0x4EBD126E80F447A5, 0xD33B1357DFDCBFCE, 0xC3215020A70C3263, 0x54A38A39209B, 
-0xFE1C3D21244BE405, 0xC0D943DB7BEDD962, 0x1537DA4B2A354D1C, 0xEC83E3D51BD99F6D, 
-0xB459796C874EBCD6, 0x5111883D25B7FA1E, 0x6B10FCAE6242DE4B, 0x74E56F342F32C1EB, 
-0xE17DDC59E982192D, 0x62D707DDD3250EB9, 0x693A1F21E6030D49, 0x3BB5A3295780, 
-0x7F3FC5961CB1BF49, 0x760137E8347FB28A, 0x6AAC7605E3EE97AE, 0x5A46C9D6A69748BA, 
-0x648CD340914E54D5, 0x23CF8286739B4748, 0xB1BC19E9BD95FA9A, 0xF4F65B4A7277B3E4, 
-0xE19124FD12B76466, 0xDC9A1F8F3B042F70, 0x94A6C21F6DF04B80, 0x5EEC4592BC07, 
-0xF1AC1C9BEC099335, 0xA4C9BD5545959CFD, 0x425DEA7360651109, 0xD4C880EF63822A9E, 
-0x9E0B12201DAB1E0, 0x6342EBD4BF1CDCCD, 0x4915FD210873EB, 0xD1EA239B8E32384C, 
-0xCF2719D545A79C94, 0xE312B107407DE0, 0x4670973EC0B179B3, 0x1E7C1C80266E, 
-0x3D99E1294D801C08, 0xB7A2484681731D64, 0x4A3854620F75AC09, 0x3B52343CE71BE121, 
-0xF58D4E19C8218B88, 0xC45F3D9814F0EFF4, 0x5DD6A437CDBE446E, 0xF213A5F9156EBA7E, 
-0x7A669884972BBAE2, 0x7FFD1672A8095007, 0x6AEAE8310E6A3347, 0x6CB80F28EAD3, 
-0x1D52AD19E7E549F6, 0xF4E0A47A06CDE70F, 0xA7DF2639BD92AF69, 0xFEE0EEF3763EC7C6, 
-0x3875D69ECF49A8B7, 0xAA9DF211862BF51D, 0x4BAE6F73E8D8EF72, 0xEC7860D135B5B55F, 
-0x500DC9E552E7BEE6, 0xF24E084BFE39DE16, 0x36B9E9EEDE05967F, 0x2F891B152CDF, 
-0xC2B5DF6F29E2ECEE, 0x64DA642DD54F2A7E, 0xC7C47000691BA89D, 0xE43DE88CDF09959D, 
-0xB6E86B37ED352EDD, 0x465400BAC74516C4, 0x80F2A9B7B3D649EE, 0x762368784CFC5B2E, 
-0xD3817EAE39AF189B, 0x2FFC611535285D22, 0x7138E114F2926FD1, 0x3DF4D97FFC24, 
-0x3820F506F6E59E04, 0x81459AA1CB5620F6, 0xF262E356C35E7211, 0x3346C25AA418AE62, 
-0x6F522E5BBF58F477, 0x831EA33F66760119, 0x194FE07A20B0C55A, 0xB3F563813AB6B5B7, 
-0x5A1E257C9F6E3C9E, 0x80FE3B59CAD6BDB9, 0xF7070A982987C723, 0x3B9FF010727D, 
-0x9E7B379486C5F5BD, 0xDF095E4AAD39721D, 0xCFAEDF4252C68C9E, 0xDCD5461548C325C5, 
-0xB02EF9FE7B963A17, 0x50D2D39CD89B7CB7, 0xB75E54CA3C26BED7, 0xF7740F5D043AB2ED, 
-0x9D672B6704A1A66F, 0x53BE3AF54AF74329, 0xEEEBD9255EBE1BEC, 0x1BC0C609EF13, 
-0x3FF7EDBBD0810FF4, 0x35F3E0E30427766A, 0x456F181E6C806EFB, 0xCCCA4B3F514C2DC7, 
-0x432B09AB9FB7C63F, 0x8362EF0450058042, 0xE46E9B8A071C5A4E, 0x208A1CF9737E7AE0, 
-0xD1128FAEBD213428, 0x988229EB666AC332, 0x5C860454A83336A4, 0x41F83B6BEC14, 
-0xC9AF4A71C452E888, 0x8A2DFE2BEA315F17, 0x42E381E729D4B78D, 0x28E7047C1E796770, 
-0xD61092BA028BBE26, 0x1E4DAA170FAC2B9F, 0x274882F95597EACA, 0xF67B1E723068BA0F, 
-0x88964B2652E53BFB, 0x387C07C4BD0F37B6, 0x49835678CB41D1F3, 0x6C6868232752, 
-0x25BB9FFD28CBEB41, 0x8735C15C1BBE3C61, 0x2FD690AAF70439AD, 0x841867A0F0AB85A7, 
-0x154973AA1393EF0B, 0x1ACFB9D6A95A23A4, 0x39363A8E3E2D08BE, 0xAEF1E0FBE1ECD5F2, 
-0x8E5DB8BEF6E4BB2C, 0xE2EC4D0D16D143F6, 0x5DE1231EB0F517A7, 0x21E52B41AE65, 
-0x7A530F6893599917, 0x758C3DB6594CDDEF, 0x2261B929F603F39D, 0xD434C92E92E8FEEE, 
-0x78724542936A4F41, 0x80C94ED551268F14, 0xFD769E120CDAFD82, 0x13F2CF0143411F13, 
-0x1471AE21D00D1F98, 0x6420CD42C7B5842B, 0xAD26FAF424C65E5, 0x1D4C932CCB22, 
-0x66DB058F5B591EF6, 0xAF83392BAEC3AD69, 0x74AD9A23C4E64648, 0x45949249773CC24E, 
-0x91582E1397C2C705, 0x9923E8325581C305, 0x1AE39E58DFC91953, 0x4A6333045F8C2174, 
-0x87ECD374E83068CA, 0x835D39717B36C90D, 0xD1F61844400CA4C1, 0x45E5E3EB5707, 
-0xBA11AF23E76F9C8E, 0x8849EF88B72306A1, 0x8D296E37D5D52DF0, 0x1880473267C7B8E4, 
-0xDA4C90079DF2968, 0x83471263A49BA618, 0x31B3642E1F7959FF, 0xC02EC04FEB0A9C4E, 
-0x763CCBEE72B40E94, 0x41E90172C8903AA2, 0xCE643AE525998842, 0x565E3A401C31, 
-0xCD254870721D339C, 0xAA7CAA0F15283CC6, 0x60E93CCD91B86712, 0xFF169C373ACB311A, 
-0x9243DE6A4579E974, 0x41EB95B498781796, 0xEF996BCF6EF677B7, 0xE653B9147BB7EBB6, 
-0xA094F7A022731399, 0xAA67755F46BF4D5D, 0x7F2D78311CF6F955, 0x358B6D8A4450, 
-0x9DE61A90ED45F72B, 0xB30100F1678671A6, 0xD8ECB370D8D50BFD, 0xF03386A414D9AC71, 
-0x4ADCD96812BBAB9A, 0xC1667A8FCC6DB5B9, 0x172068D02DB0C9E1, 0x233D6043EE9055F4, 
-0x36FE78FED336AB0E, 0x7DA25261B835EB75, 0xD9A66A9EC23C2073, 0x2A3A31A9782E, 
-0xA511398EBBDD9BD1, 0xECFC7DE32621B8E2, 0xC7A7629E4DF8BD16, 0xE5E88029302AE41C, 
-0xE580D2A603DCE2E5, 0xBD84D66A50FC1888, 0x5A532E40826B520D, 0x2AB86EEFD8980C99, 
-0x5556B42AD90F2437, 0x3C7E0673D9F9FEAE, 0xD8477B56CA2F28FD, 0x505A5D8D90C6, 
-0x4BE2FC9D275D7453, 0xC0ECF7EA1151254, 0xBFF73798E60052, 0x6AF745523485F294, 
-0x7FBC96ECFE5BC8CB, 0xB8CD1C2DB06838FD, 0x48819B2D1538701E, 0x4425AE0DA2323A5D, 
-0xC91F9CEC9DF9376, 0x6D811A9F682854C5, 0x7C80A72861ADA99B, 0x10C23F50161, 
-0xB77BD538160B02CF, 0xF015530EE8BE172B, 0x1E35EDC73AB08F49, 0xC2CFCE906E28CCDA, 
-0xB7C3952B4EE5F34F, 0x49A386F71D75FE66, 0x929EC90AFACF59C1, 0xC46DFFA7288D283F, 
-0x5575949A8F3E2CCD, 0x70B67EDD1B123943, 0x11A48128773B7C2F, 0x4B220F91B77B, 
-0x7D594E6CB08BDBFA, 0x654FE5C7E7554E36, 0x75D6CDDE0BB2E0A1, 0x3A78D08E838F01C1, 
-0x60507ECFF3212358, 0x3BE650D862B5ABFD, 0x70FCC84B95C93707, 0x2003AE42DAFEC977, 
-0x281DDC44A33ACB7B, 0xC430579AFD29DD4F, 0x618D534FB0457245, 0x8F2327D7C99, 
-0x17B9351238CDA554, 0x77FA8672D3BD0791, 0x1CED32DFF3992E73, 0x4CE3CB5573337BC6, 
-0xE30831FD268C4C8E, 0x88FF0256CA45E6A4, 0xED70A3041962756E, 0x1C35F5D0D9A1C194, 
-0x597B31314D1D82EA, 0x8C6234AF30A0CDCE, 0x1E1FF8FB2CC41999, 0x2FD29581BFD9, 
-0x121AFD232CA097F5, 0xFE800C1741D67DDA, 0xBB6C49003B75ADA1, 0xAD3C54B49DDDF46E, 
-0x24D891A7DED20BF0, 0xDCF736C453F114F4, 0xD43E1FA2164E676, 0xB7FEE777E0A26A05, 
-0xE5C7A6B0D81E7D24, 0xE77C329FB72C3389, 0x90DACCE1B57EFE9F, 0x51D1DC43B786, 
-0x3E05BE4CA90AB188, 0x2F325B9BF1CAEB44, 0x7AD3CF4F0EC6289A, 0xB02D31FCF507B065, 
-0x4F26CF0EF7C1FB78, 0x43CB3CE26A07DFD0, 0x74E5A0154E74008C, 0xD6FFD26290A44795, 
-0x5CA81059C297AE62, 0x7B3EADF4477587BC, 0x9A17C894C5D5E342, 0x4105C67401ED, 
-0xFB562464B0D42464, 0xFE754DA1BBD8C53A, 0x9F19453763123DB, 0xAD3010AF00E0F03E, 
-0xE35106D4C67D5FD5, 0x5FF468C5FCE981A7, 0x12F6EE72789F5BC3, 0xC105E164535299E2, 
-0xDFFAD89DC2939485, 0x772DEB28A3A811C1, 0x7AC5579A4D41721B, 0x8C3BC3214D0, 
-0x9842AFC867CBE3AE, 0xB494A7ECD0C20997, 0xC31C5274DB450B68, 0x85EE60CACDA155CD, 
-0xECFA4B66990BDC1E, 0x309BFD0B6055A6BC, 0x83C37AD592BD51D5, 0xCF6475EE76821D4A, 
-0xD109C14BB14100EF, 0x1098DCD59CBD0D0E, 0x10576CEC5D678439, 0x106587E74133, 
-0xBF87D3F11597BF97, 0x51E5BA0EE09358C5, 0xE496C7B1DD330115, 0x9C792D374E4DD8BF, 
-0x1CE59564F8E4CA46, 0x225474A33D3AE358, 0x51BB67550ECF284A, 0x913C05370BDB414C, 
-0xC8350FE6B5E1706B, 0x44F606E05CAD766D, 0xBB47ABBF2C2020AD, 0x527BF85CDD13, 
-0x5243352CABADDD96, 0x7C143914362E88A7, 0x1329F0A364EF3CCF, 0xC60BD07823046ADD, 
-0x4D0B57D268BE3CD, 0x20EF290F2EE3DA97, 0x6F3F30763B1E1CF, 0xA52AFB3DDB24B3AE, 
-0xBBCD291E1E789EE0, 0x8BEFE2C6B3814FA3, 0x671A3E93F2683DA8, 0x30EBD35E72FA, 
-0x2CB91646F8D4654D, 0x9738084CB1E30D4C, 0x72AD5C3512D07523, 0x23E54587CD14E401, 
-0x9DAF82E6BBE39471, 0x3FE3B005D4C84BF9, 0x47B2F14D61852471, 0x7AA5071A1D640E6C, 
-0x9B01AE4A6F231F65, 0x7D444D2E548AAA5D, 0x4131195EBF025DD1, 0x38B9F980F09F, 
-0x2A461C4975744122, 0x2B851C8EF946C6C7, 0x217C6A3ADC5DEE57, 0xDF362638A83DEA09, 
-0x6B97014BCAD7051E, 0x677DFC53738ABBBB, 0x99A7FD221D03D666, 0xEAF219B1CDE90494, 
-0xDDE05D1317770C53, 0x26354F05E4C965C5, 0xE7BE89C393B31B09, 0x53E5A8465D84, 
-0xF51BDB98F0D15822, 0x4443EBFF6AAE3A96, 0x76E6CB9F25C4F767, 0xE92639ACED7C9DBD, 
-0x7E7AA8C265EE4745, 0x159771107CBF50B9, 0x792D4F8C1DAA0C76, 0x7E7367E45B9593CB, 
-0xA8D05713F5CE702A, 0x73C2F92B4B5BC027, 0x193421D25DA712BD, 0x2B52D04AA278, 
-0xF1BC0FFA8EAAA512, 0xE9796114D7ECE644, 0x4173F1592AC6F5C, 0xD5CA83CD1FAC896A, 
-0x3553AA2AB6409812, 0x47DC1645F8BC6E33, 0x7B172B49168C66C4, 0xC4A360FE203E1E81, 
-0xA7F973F47C2E1E47, 0x8D4538D01D385B0F, 0x2B17E867761D6CAE, 0x45D59C5BA75C, 
-0xC63B03F49054FD12, 0x1DDA0AD6D20D8C19, 0x993B10ED75EE32A4, 0xF02FE2F12123DB8F, 
-0x18FD3CF5545D2E79, 0xDAC6123F383834B, 0xB28C944B0234BEAF, 0x38A96A771A8EBEF9, 
-0x5C0D6ED0D643576, 0x2D5E57067F0686F7, 0xAD13B974FB8865D6, 0x1DC4386D4040, 
-0x4B1D2B753147120D, 0x4C4148B8FF791C37, 0x390F0A3DBA774100, 0x65B8768E8042C4E8, 
-0x533F8B028C3020F4, 0x12791ED6C9EC812E, 0x19111EF96D4392E2, 0x4ACB838BC4439CB0, 
-0xAEF3E368191AB187, 0x9AB89AAAB2ADEBD3, 0xBF1304E7D087D8DA, 0x2D5D1EF4B893, 
-0x882789D2A35A7A9E, 0x4422C5FEF2EBA4E3, 0x5C63A17EBE3431C3, 0x4F585B247122A096, 
-0xAF9928351D1A9C34, 0x6A6A24ECB379F348, 0xC6138F7B6CBA211E, 0x7B493427634FE7CF, 
-0xA46B986FE333AF90, 0xAF1A7C165A9E71EE, 0x148A528F492AF37E, 0x67E4C54A296A, 
-0x2E2A7A2684B0D921, 0xF4E6FEA1C4B9194F, 0x7CB604CED984460F, 0x5AAF31C9D3A02E24, 
-0xF1CBDFB4EC785FCF, 0x6FB22DF14E21CD25, 0xD8E5A533A81EB87F, 0x6904D59D25B70A8D, 
-0xBEC63CAB00212C07, 0x38D96D250ADAFF5D, 0x4C48E296DEE21F6B, 0x18406C57BBE8, 
-0x2929F0D329C0FFA0, 0x1548E63EB77F50DD, 0xE8F70601C64A8001, 0x4021F22E48769625, 
-0xE21D1F22A1DB7D5F, 0xA8D578D03FCD85F7, 0xCBC86FD4E24942B8, 0x6BC7548F8C527F47, 
-0x953B867C53146261, 0x88FF7C5A62BDCC65, 0x232DC854E6D2DFD7, 0x139EA8B2DF76, 
-0x70B033E62B877354, 0x374A05EB5EE763E0, 0x4E3F31C2C7CEDF56, 0xB672BBC8ACFF3323, 
-0xD5A443E0E52C81B6, 0x25D9B4E73D4EAF3E, 0x5FD9087FF6E17EA5, 0x7081E2403447D3E8, 
-0xAD26B9EF1E645943, 0x347FBEE19CDCF8CB, 0xD0E6104F851DCFD0, 0x516B2DB8B994, 
-0x7E0E415F44310475, 0xD9253C0FF63F00EC, 0x95C62D8F82C514A0, 0xE26C8DBE6017FF0E, 
-0x89BA42918BFB1A92, 0x78E381D442F2C501, 0x76E85B2D8BC33545, 0x73EF150BA30F2169, 
-0xA2656B7044F0782E, 0x3BA50470DF0D030D, 0xEAE731FA27A92F92, 0x58F56E60C952, 
-0xFB67D8B56D6B2FD2, 0x9D12468FA1472E8C, 0xA398925B39B88425, 0x45F16D43B153F2D, 
-0xEB2A3A8A141D0EA1, 0x50A0C8240D2D79A1, 0xCBAEE67908F422C9, 0x1B65BC0F3CF2F7F0, 
-0xCCC7F8CA79DD48FB, 0x81A1D8C188EB5BA6, 0x485BFBDC8ECDC59C, 0xB954F57F95D, 
-0x1CF98EB1986EC771, 0x2E4EBED80C85CB3D, 0x893031903E71372A, 0x80B658B4CF0E337, 
-0xB597218B3E8EE2C, 0xB657301BA6EA4072, 0x1C00EC2E158A175A, 0xD4284C845C653464, 
-0x86307AA4A9F9AB92, 0x3BCAF0CBD4A2AAA6, 0x158D9B15645B22D9, 0x662D89DBD82D, 
-0xD4001AAB4E69DF17, 0x15E99D34DFF1A68B, 0x6B3A19883E896454, 0x16261A86F9D75BF2, 
-0x1270F4368A118BB2, 0x663DBD301E974642, 0x67DBEDB610864589, 0xAD087A32F32E602E, 
-0x9A366119BE72D124, 0x7956BCC6FCC75D1E, 0xCD18DDE14A424590, 0x309343F2C8D8, 
-0x92D97BB6FD96E574, 0xDE0AF973BDEFCAD1, 0x5AA8E9BB4CE94C41, 0x8A39F44BB6A99533, 
-0x64DAA154613F1E2C, 0x7DBD58FEBF2181D2, 0x307AC4885544373A, 0x54DA06C410BA164, 
-0x98E35434E8C42541, 0xCE7D4A39FBC0D5D, 0x4D3E901BCB40F844, 0x39C829B7F75C, 
-0xD28750C7D080EDA0, 0xBDD8A8F09E854830, 0x7741FA85BDF78F67, 0x57B2EC7EC4BEED99, 
-0xCDDEA2D7AEC435C, 0x26FE43F61CD715FF, 0xD8F94669B4F4A587, 0x18BACAC37AF9D3A9, 
-0xAF9DF13713C08E20, 0xD6B3563F35FE6F4F, 0x801B4CFB47BF2CA4, 0x14DC6C08F018, 
-0x891B9940A59CB5D0, 0x96063D4F1BE40A12, 0x8F179B48B3266E75, 0x9CF3A9EE8C11B2C4, 
-0xAA2BFF7CA08D929, 0xC08A4F297ABFB392, 0x5A2CF2E0A6CD76E6, 0x1D2519A064E70876, 
-0xE48B18DE15DDCCA3, 0x6D86392C05DC7804, 0xCB49854CD37AEE5E, 0xBC2D24DB421, 
-0xB56E8E02C7B39B74, 0x1D5B4D66999F481D, 0x3F79A2E5CACCBE5C, 0xAA52306DD36FF76F, 
-0xCBDC3E9D2E99DDF0, 0x93D4307FBBF1503A, 0x2E4AD75C6B89B48B, 0x225C95B5A66DCD30, 
-0x6246A4E1C7BEFFA5, 0x2EB915C319F89BF7, 0xDD429C5E6FDE0E06, 0x43FCAB438773, 
-0x5FFDDFD096A2AD24, 0x9F438412D289FEE4, 0x394F7D7AEBA6B0F6, 0x60AFB6EDCBC0DC5E, 
-0x9B9960DCD38CD4D5, 0x86616332989956FE, 0x9E91BF9B9F13FAB6, 0xFE05A847A71D63FB, 
-0x24804EAC58AC0268, 0xF9C221988890789A, 0x6AD152A2B0BD3789, 0x3B47BC446429, 
-0x1F86341B315F9B4D, 0x6B806FE32D75B0C4, 0xF2B05109E00D71B6, 0x9F6921F962D2D53D, 
-0x331328A6A95FFDBB, 0x9846ECF9BE9F382C, 0xFC82AD83E1573C3B, 0xF3A420A58912628D, 
-0x8672EEFDC48D56CE, 0x5D40E3900A7E2BC2, 0xEB735994D8BEEF18, 0x4A31F48FC5A7, 
-0x68A5069D497F1157, 0xC379ADFDD2C1A3E6, 0xA00B16BE32E5B37E, 0x7F38738F7E5F2D08, 
-0xF1D678907B45457E, 0x8AA532F86816D247, 0xD63BBEA1CD68818F, 0x2EDCDF6CFC2A0AE7, 
-0x697F05A99B2F92FB, 0xC1D6AFA61C09B578, 0xB4606904BB91BE13, 0x502F0649DFD2, 
-0xB6F44D597B225A46, 0xCC20094E2CC6B023, 0x7ABB07B0765EBAB0, 0x82A691F226E40AB7, 
-0x3781969628F7D9A7, 0xF1B95CD02A87C21D, 0xFBF05D2B4E4B649D, 0x82702BDA06E40473, 
-0x82A0AEDAB778FCC4, 0x12426ACDCCCA4E54, 0xD4D53307589F4D7A, 0x4F6B0BF91AE1, 
-0x43A75A8736FDC0BB, 0xBDF8AA6A1769E5D5, 0x603939A3D59FF932, 0xB72858162504A34B, 
-0x19B11E096729D28A, 0x8AEA27441265FBA2, 0x7932F1539920949B, 0xE3982E2D0974AB89, 
-0x62F497B0BEC9426A, 0x214A38ACC8B2B30, 0x96F1EA9A604E12A4, 0x5C4D8441248E, 
-0xAB89CC508E99E515, 0xB131A5D4D0A80DA9, 0x9FD68CA31524E1D7, 0x5A19CC4946DBFF41, 
-0x34B44B6E6E0B959A, 0x6543DA1C39612FF7, 0x21D96D33A52C8B9B, 0xB529A12D037B21CE, 
-0x4B52B7B1390DE207, 0xB49EFF14C679CF05, 0x6C921ADCD53F3451, 0x1B690046BDC4, 
-0x3A01B86DD712BB06, 0xD7C8AE59E32C631E, 0xF3FC845700AD7A61, 0x530ECA869997CE4C, 
-0x7B55B5E31546617, 0xF555F6397110910E, 0xAF2569CCE56657D8, 0xC13A4FC0DBE014DC, 
-0x5C0CD77041F997A, 0x498FD66AC3BC4D82, 0x20EAF4445639EA9F, 0x535CE7655ABC, 
-0xA5F34EC00D0CBA89, 0x6A21680E52F9015D, 0x9581513E259B799B, 0x7C8C1226F11F7A46, 
-0x2D96A28C1A5D121, 0x6896BBAD9BF7DADE, 0xF6383282B8B61CAE, 0x7B885E586AF9AF37, 
-0xA4D9E6F6461F2965, 0x753F795BE1574ED6, 0x27852032D7A8DB86, 0x32A8F596E031, 
-0x991AB789B14FA6A4, 0xCE8885B15E267FCE, 0x80BE3242BD9490CB, 0xDECB5067BABB214B, 
-0x99DAA3050D400387, 0xC6601855815172C1, 0x28EF4EC63ECF8CE3, 0xC3C9299E708B6CD2, 
-0xC6EC9B623F706DFD, 0xC0442D6C01C640D4, 0x749E3D6170EE70DC, 0x39D90EF82B11, 
-0xB378F6F7581ABAFD, 0x57F3113C24B15111, 0xCB7269C0E3E2E08, 0x92F6BD2B0B4DEF7E, 
-0x9448999F71CA412C, 0x3E9BCCB8C20390A4, 0x1CB501050734F3E1, 0xF7D733CC7C27529E, 
-0x1F0D0D1DA76E3372, 0x77337D57F2036727, 0x300231F4FDD5A6F3, 0x2F08FA686926, 
-0x9A24793EC752386, 0x7114483E913F54CA, 0xA6E555357F06F603, 0xD78351054708528F, 
-0x3EB51E212EB04FDE, 0xC37F6B68B20FF9A2, 0xFF91147667578525, 0xD19E6CF1AB12CB64, 
-0x690BC515347B5206, 0xAABCB14DE7FCF37A, 0xE67DE17DB3ABDA2, 0x7FEFADA2F64, 
-0x5FFDB9F60FB46458, 0xD50AE62924EBDEA8, 0x445C608FC5604BDA, 0x366099B7F5A911D4, 
-0x521AB77E5ACF85FF, 0x6A22F50FBE4AFAB0, 0x24AB423214B12239, 0xFACF8E9488210D1B, 
-0xEE93EA61FE38C788, 0x80DB4C1E6FB0130D, 0xA6B6813A635C2B9D, 0x4C2166717210, 
-0xC81D488953C0C86, 0x8727A26D07867C53, 0x796358C5FF9294FD, 0x980ACCFC243E4173, 
-0xC0B2B5CE7679C0EB, 0xF518B6920E1B6071, 0x8D9FE6D22CAE1A8C, 0x650738675AC96B7, 
-0xB255E71DAF0D7A1E, 0xB1317E851AB382D7, 0x92059BDD0595B9C6, 0x25D49FA94F03, 
-0xF87B0990A5239363, 0x928675FAE8ECAE0A, 0x8DA35F1C01C54B3C, 0x466A0A429B198A77, 
-0xCD205F64F613E615, 0xC94D440C8AEAAA8F, 0xD0E33BE296552139, 0xEFAADA9B6D0DE49, 
-0x72BDD509FD4222D2, 0xB2461F57D0F28F81, 0x81617C9237B61DFD, 0x32B0C30449AE, 
-0x5AF7E78BD9507A4, 0x46F8DC9B003D9FDB, 0x8D4DC125F3E4FA56, 0x883B885CD238C219, 
-0x60F43D402ABFDDC9, 0x16881224520B1198, 0xCFE97CE3F64B375C, 0x982A68AC7FB6A0D5, 
-0x7C43AB38B5481128, 0xE98CEF32AD86D0F, 0x798C3596BE0B118, 0x40CD3A53CF65, 
-0xF9B3051C78CBECBE, 0xF274360E4A484AC4, 0x6B296C117EBD4B25, 0x96011C0E5D54BF81, 
-0xF24C1BB10AFB45CA, 0x7587795B9DFCB240, 0xE7D7B0091E062621, 0x7919B95D4643686, 
-0xB332A6A9B83B16DA, 0x33DA2991F0562508, 0x2290D71F5FE4F54B, 0x4033F83A6DBD, 
-0x3EF57AA71F843049, 0x7C44A37B4713A86D, 0xAE064F0ABE315316, 0x83489236CFD8643B, 
-0xD7444A9F4A7A9C0D, 0x4F4A8A0B127B4B32, 0x446646444BA4D73D, 0x9790DBCE400E8903, 
-0x2C191E7D2C09D17D, 0xF54F038705F6999B, 0x604C81427369C48C, 0x49D64663A875, 
-0x6631E932B719F887, 0x2D7E6896413FF8FA, 0x1789FBBB8D4FCFB6, 0x8A34FD706B03E1F9, 
-0xFDA4563E7045BB4A, 0x48E5F52547965960, 0x1FD7BBA1E9491980, 0xBC14C37DBD2FBAFF, 
-0xFC7A3B29AA0D0A2A, 0x9499381C2EE8B51D, 0x44F1380ABAC7FDE7, 0x1E884F5EC897, 
-0x58D21596AA231BD3, 0x15F0E61DF58950B0, 0xF2068001D47DA33A, 0xDBA639A7C4027A16, 
-0xB8EA828D89EE3851, 0x8BA99F8CF7C42E5B, 0xA34EADD2C230695F, 0xB3ED9B42BF259EBE, 
-0xF9F4E58468EF1771, 0x6F8A8B67EF6B4CF2, 0x7943CEE760EA48A3, 0x4B8FD14B6709, 
-0x19B9DC37DCB17701, 0xD2200F9BBB89370F, 0xAC5522F8297A3AC8, 0xD354302475914BCC, 
-0xB5639913BADE308C, 0x9857E1C4C1882955, 0x47708DE10FB4AB2A, 0x14B9412320CAD103, 
-0x7097186DEAD87751, 0xC31C1D017B05EF58, 0x6AE6136AEB393476, 0x1371CD26BBC, 
-0xF6736D0B346CE5B7, 0x59BE0696F6FC8351, 0x916820112D6BB7A1, 0x511AEDC44E93BE8C, 
-0xE32478751179BAD0, 0x85328DEC5781CB85, 0xD39956D26324ED2B, 0x9FFD0B1467622574, 
-0xB2CD6607D5547ECC, 0xECBCF0EE715C8B82, 0x6F7A8BF9CB8F89DD, 0x2902A35944A0, 
-0x26DBBC623D2C03FE, 0xB590CE4905638145, 0xC65F821DBF04BBBC, 0xEEC62DE07ACE51B4, 
-0x7A17D5839F85C872, 0x19448B86CC3405BB, 0xE43E1313981E6D75, 0x515C995AEA8CCBEF, 
-0xEEF8911CD80D6195, 0x54FAF63518766D9D, 0x91BE7B114F3B2C2F, 0x2D3DF4691568, 
-0x3957591303C7E0B6, 0x3BB5B867283EC82F, 0x47FB301535704B03, 0x5F51551B398F57A0, 
-0xD665AE9C43020C1B, 0x5C4AEFB4836B6ED4, 0x9A053C44A37D9320, 0x87E08E86D150AAE5, 
-0xB40D4DCB2B30A7BB, 0x4C1FD8854C0C09C9, 0x63BA5454F25327A0, 0x2B126DD96D46, 
-0xEE628C664DFA739D, 0x610DE8C75F65AB18, 0xCCABC610424EFF08, 0x8A22FC54CAFC98EF, 
-0x90C32AA2020A240, 0xB2A112AD8D573637, 0xD4ACBE1F999B9A29, 0xEC257EE28245DD55, 
-0x403E707EA34608CE, 0x77927003A59C798A, 0x734C2FF6D85226DD, 0x147321A3F20, 
-0x10FCE284B735312F, 0xC9F43EB277264424, 0xB0E6DA96B027428F, 0x25CF8805208E5CA0, 
-0xE6012F1F7F7FE11A, 0xE32A347812AE5EA6, 0x7FF93709451A3C50, 0xD76DA1A49B98D975, 
-0x162D7738C17A97E4, 0x7FA9D6C3910CC000, 0x574C6095B785842B, 0xB4838C36B57, 
-0xADD78275EA67722D, 0xC56DCCB7F00AEA75, 0x8D4A83821B618FBB, 0x3EEB178F2B67538F, 
-0x10C957EC1825EEE7, 0x13F772FD6070DB2A, 0xCB7B77A53886C5DD, 0xB0C836298232E47E, 
-0x2E28E4C8FFCD1D96, 0x1B9D2C9EC998B49, 0x7E6E10E8374B169D, 0x21FFC517D0FB, 
-0x2B0A5ADE4AA73596, 0x6A0AB9EAC647B652, 0xECD55BC5F7EC1F19, 0x6CBB0800A6FBAA5, 
-0xF125CD9F7421006, 0x2BC061583427DA50, 0x54514507D045D8DE, 0x55A528FC5698B041, 
-0xEE82C6B3C0A51657, 0x8702A5604B844D8, 0x387E44FEB03BEDEA, 0x495F5D6E08F3, 
-0xF51AC87A0DBAD055, 0xF48A14A8B39C8ED6, 0x8502658FF353A7C1, 0x6D94D025813024BF, 
-0x2BB9C29CAD049E8F, 0x649E0201BDC5FC7A, 0xA95E0464B22478B2, 0xEEC76880F8D17FB, 
-0xC0302AAA89F08F8C, 0xD8789649ABBAA590, 0x6793BA04A0B9EDBE, 0x1C0A7732985E, 
-0xB378073A17673D13, 0xCED75D64BADCDD26, 0xDC6D06CB1E4B8473, 0x79E5E61BF590368B, 
-0x59C8D7038FC1C335, 0x2066E9F118716617, 0x900332E4E0536243, 0x941487ED510B87D7, 
-0x94AA88F4C3B6C696, 0x44243F5D1ED2A058, 0xAB83098FC9F0EC6F, 0x23F307FA3BC6, 
-0xF7A3FCBB74944D0F, 0xF00140EF2FD39B7D, 0x4E21DE00A3B93E60, 0xDB6462166C3F662A, 
-0xB0B714B228FD690F, 0xEE9A4DC97F10362, 0x59590513592822DD, 0x29C52ABA6F43C2A2, 
-0xAE887F9896E3D16D, 0xBCE30B5DEFB75F16, 0x4E0501E027502A06, 0x4312AE339CA1, 
-0x527519EFA36517E3, 0x91407BE3BEA255AB, 0x2E5A07D310D2F59D, 0xB8EDDF0A9A61B92D, 
-0x498BC9610D20B511, 0xF6D55D9D41BED830, 0x6BA1975CC4D1908B, 0x54E3E0521AFA41BD, 
-0x4DD0575D23D6EAAD, 0xB5C2F074CE0F7848, 0x5A7271C6748D00DC, 0xCE23A40B074, 
-0x8B84D69E4280DD3F, 0xB59ED02F76C7B5B3, 0xB2AAF6BCD0050DE6, 0xA7E320893BC4081E, 
-0x5FA87FCC4C7388D4, 0x5E84B14098E7BABF, 0x3011168553B06453, 0x20050B1569F5E6C, 
-0x6AEBEF8431FF6DE4, 0x3104D25F24358643, 0x16B610FFB1D83A8F, 0x3C558B5EEEB, 
-0x26D44D832C11B410, 0x785C7E90C3290D8B, 0xBE54A021131E3A43, 0xA8284C91AC1FBD70, 
-0xEFB20DB3B1644163, 0x272664D90F66C3A6, 0x896427D066AA1392, 0x6FF64FA15091BFFF, 
-0x5CC0D24C64BB1BBC, 0xD18DAB503F233963, 0xAEF25EFC7C0298F7, 0x625837DF9F62, 
-0xD10AA07675B5772D, 0x6B460719B0489409, 0x9278A46D9E402D58, 0xFECCF7A79E75FBE1, 
-0xFA0A5D7F9FDE7A8A, 0xBFD0D51F85E2ECB8, 0xB5A2A95167F23A0A, 0xAB2690AB0523BEA1, 
-0xBAA408971CAF7CA6, 0x2B20B4CB2625E356, 0x1CC463952811892D, 0x2A0AB3CBAB1, 
-0x71E712CB27A08194, 0x3FFF4A43CDC50638, 0x90F82F9B44B6211D, 0x5FE19A15734EF5F6, 
-0x657C12713D5CA79E, 0xEDBA87DEA36A35FF, 0x4547595B7EE4C244, 0x4DDC42EF6CE3F7F8, 
-0x4FC9CA1FC81F27D, 0x98458AAC9175D35B, 0x775D835062A994BA, 0x2581A638C3D9, 
-0x9206237FF172F6E7, 0x8AEE0212BE6E20BD, 0xCC0E32BBAE1801A6, 0x327DAB6485BB2060, 
-0x915E4AFFBEA47B0E, 0x40F2F02A3EAFCD9, 0x43D88669F02AFFE1, 0xBFEAF0DF2CF41576, 
-0xC48DA89BBBB27DC1, 0x7D2945CDC9DCE719, 0x6735926E05FF87EE, 0x3534C4540D9E, 
-0xFA7023460B1B22D6, 0x1DD96A50E6A34647, 0x41DC3BFD4B5A23A1, 0x74D6CBA12858D069, 
-0x41805050724AC8A8, 0x53EB63321EE78052, 0x39CB915C7EAD9F39, 0x9F2F1B7993E666CE, 
-0xC81A5E32D4DB3BD8, 0x30C93E9A1A2F3994, 0x9865C9AD11C7C73D, 0x4A799F4E98A, 
-0xCC9A6C6639124496, 0x61C535047CE2D272, 0x33500E3FE928963, 0x7231219CA8E2F4FF, 
-0x4927F30EA350EED4, 0xD62843CCDBEB9875, 0x70B6D895EBE1EB5, 0x16AED77EDC414A6F, 
-0x910A66ADEB6B61C, 0xC683CE0BB328036E, 0x11CA547311B272A4, 0x2429504F0EDD, 
-0x616F60D7C28A1EDE, 0xD6C71F6C1F7049B5, 0xEF9D9A32B682C959, 0xFF22CD4E39EFFB19, 
-0x220931286A87096E, 0x6479E62C0E77D0D, 0xA4FF39011EE2A03C, 0x9F4C60BFB02869C2, 
-0x48D66379905DA1F9, 0xF33BC0BBBF67F901, 0x408A3E1EE11249FC, 0x12231FB40398, 
-0x74583276CDB13A77, 0xA0719395D0DD135C, 0xF1B3CF5FD915413C, 0x56F33021191E3752, 
-0x61F37F37151631A0, 0xFDDD276C36940030, 0x7621998FF400B43B, 0x292FD475B9FECD0A, 
-0x95C3A905E7D1FF81, 0xAE6952F862D7000F, 0xCA8A2100E567A995, 0x18220E82D273, 
-0x6791160C96FB091, 0xEC08715869681666, 0x77081894B8EA27D4, 0xBCD50471E7128B35, 
-0xBC0C7597900E2266, 0x796A1C4CCC83A7CD, 0xADC7C7C268CCFF0A, 0x8B02464E9B5502DF, 
-0xE6BD41D341D9FE9C, 0x76344F888538A096, 0x49E3E2CAC4C091A4, 0x1C4E36C6964A, 
-0xA13BE371D9557F0C, 0xBE0DDA9DCF53F80F, 0xCB2615289794880D, 0x45D3A0D625BC5F18, 
-0x516187DC5EA80F8, 0xB68C54FFD287035B, 0xDB1DEBD8DC7FBC8F, 0x69239CB9F76687E1, 
-0xA0F5FC51C2EFF995, 0x217AF56E3EDEC3F0, 0xEC4D30693E128D94, 0x4216340ABA19, 
-0x43DF3E14171B7AE6, 0xA37BB85FA7A4B886, 0x90CFCED82CB1A1A2, 0x8045FD0B3B047C20, 
-0x64AAF3F035328F55, 0xC6F4F1F601B4400B, 0xCBF788C2757A3F77, 0x57E425C2C624FCED, 
-0x31112D2784208927, 0x294093F5F588B756, 0xF7DDC951D9FEB0D0, 0x4874670F2F74, 
-0x1C365ADF22A15CF3, 0xBA3AC3A9D7ED0D2C, 0x991397FD0B726F2C, 0xA566DCE7B4A575D8, 
-0x96413584DA242686, 0xB7CACCF06CDC5DF1, 0x27F7941F119A5283, 0x87872C0334F7B954, 
-0x24321AEC20AD6710, 0x40EB4BA999DAB8BB, 0x18D6D065568263FB, 0x2B7AC56D871D, 
-0x1B8E882DBA63EF27, 0x707A4D0F7B7D53FE, 0x36E6680E7E0FC189, 0x826970D4B28F8B70, 
-0x14DAA9B97F348EA9, 0xC8903092958B36C8, 0xE599C19F84736693, 0x66903E91820AC687, 
-0x9F01E68370FE4F6E, 0x25C6D2B98FA5F36E, 0x8E62531D8A3900F2, 0x2AC7483B24F2, 
-0x91465ED9E3CBDCA6, 0x59D0F629A8C5650F, 0xCBB3C465F3D1875B, 0xE995054A38604D99, 
-0xD952C1ACF0781C29, 0x1776A4B71856DBC7, 0x879BC08660D2B4B4, 0xE2A0F7EA977DBA51, 
-0x6B7F028145989F2B, 0x34B72F50C7E8D6D, 0x426564A064859654, 0x3C33B437BD29, 
-0xD344EE8DBD2B4CC9, 0xF1ACBFF718E8357B, 0xB04988033F77360F, 0xCF5315D779381F80, 
-0xA5D380BF925F9A4F, 0xC8E992D2F2F3292D, 0x11802A99102A4440, 0xCF5E9118F71BED71, 
-0x4473714C1A1F8B9F, 0xC1EDB45D92D22DDE, 0x98029F4FA2A61D6D, 0x1072B127275, 
-0xC9B7DABC86EADF10, 0x2E785DB31A68531E, 0x8D28CAF5105AA4A3, 0xB7E39BC7BDCE3C02, 
-0xD78753FF84E4A6EE, 0x40A4C638EDD3C658, 0xFA16CEE2F46B6D2, 0xFD1AB124986A99AE, 
-0xA9F23A721BE10D0E, 0x2BA6B67DAEE9ED7F, 0xD66A8CDE42484E8A, 0x2F589BCFCD98, 
-0x3DB0B2036BBD2223, 0xBCE5E0F07E3FE58C, 0x2EB2DA5769073B7, 0x9F681C9A990593E8, 
-0x326259D269132E46, 0x962077CE66E88233, 0xCC132E8F4799C321, 0x3EA75EDD9B95DA5B, 
-0x30781B7DC9D44C40, 0x6EC69E95D983E93A, 0xB40ABCED0A0D0F4D, 0x5BA5BB6E0A06, 
-0xC709E15857E7130B, 0xA8FCA1F784ADFB7B, 0x498DB15FC93010CE, 0xCFDC46081B144084, 
-0xBB98834EB98DA279, 0x3D24FB891EECA63D, 0x8B3FA9731CCE2FA6, 0x9FF9B0670C4ECFFB, 
-0xC66591B0C19B9BE5, 0x601391AE75F98CD8, 0x52F9576945BB271C, 0x146B9184194, 
-0x7CEA328C187A86A4, 0xFCCF4135E00B6D4D, 0x7EE72723A2AA8AE9, 0xAD84145A5D0B45D7, 
-0xFCED1CC4AB3916FD, 0x3DC5F751AC49E640, 0x75EB2EEA1BBF2763, 0xC7622ED7EB0F0B92, 
-0xB39EC6650CF1A631, 0x4F088D6152C983B7, 0x9736BFE4F96901B4, 0x5A2AB8247766, 
-0x31E29864FEF6AE09, 0xB33738C658256092, 0xCD1FB04539240AEF, 0x9E9FC7DEC40B7E7A, 
-0x513D29870F078555, 0x29B9BF0D314B5FEE, 0x63A0CA26B35CB589, 0xFF8E21FAC551F04C, 
-0xAD253E3011119006, 0x3253BB86B2760041, 0x6636318C761DE6F9, 0x80D36168AB8, 
-0xB7DF6665FB756762, 0x14791E5A9FC029D4, 0xB9AD2FCDDE8CB979, 0x5BDF720A58414FAE, 
-0x9E840FCF3E98A673, 0x5C37F31659707117, 0xEE8F2772D331DDB3, 0xB0D49F6DE304CFD8, 
-0xE57D3BC2EA5C256A, 0x6D8EB0DE1C9DEF90, 0x4E52B3256EE0231C, 0x5315B639B44B, 
-0x8AF8087B7B9BBF9F, 0xE80F40FF91900E84, 0x2713C5EE44D69E91, 0xF0342D4D935A7E6E, 
-0x935B9F39DDA73400, 0xB183D3E404D1F498, 0xC4D2DF75E55047F5, 0x511E40C34657085F, 
-0x23E2905DE6F080B3, 0x9908A36FC658202A, 0xB0A662490E5DD5BC, 0x22DF7805F61C, 
-0x50FCDBB41D61CAFD, 0x21960538F2E28330, 0x2E0A31B78D64E0A5, 0x52D5517BCC5D991D, 
-0x46B95442D31679CA, 0x928908D166DF33DF, 0xC58BE85C7292D668, 0x7550EB80B1839B51, 
-0x62B6794C8E6ABD11, 0xE10447882EB22D93, 0xA5C3E71801F2EF31, 0x59EBAFEBCBF4, 
-0x45B83BDB8549C57A, 0xE8220A2C36676225, 0x70F2F1BB4F166EC5, 0xADD482ABC17A9626, 
-0x92931CAC859AE10B, 0x977046635E58AEA5, 0x40825AED6C6E1AE, 0x634EE0204D59BC4A, 
-0x16D8EDEF20E64867, 0x6CBF85F10C902B57, 0x2F3120DC166278, 0x1107729893AD, 
-0xE0E32781C6C51BE3, 0x64BF173BA96F3895, 0x668754E495A38C8E, 0xAFE0F6C78671C381, 
-0x42453CC084A23EC0, 0x9BC48570B291004A, 0xF4039C988B666644, 0x6F78555BE29C4A24, 
-0x25093E7CB5C0F012, 0xDBB87450172DE182, 0x5A2BFB9763E423A8, 0x478ABE8264F3, 
-0x1D17824107473956, 0x7B405DB346E6DB6, 0x92465043490A6AE1, 0x63BFF0A5C2AF9248, 
-0x5E35016E5EC1DCF5, 0x11489BD829A5EE87, 0x2EC3E1D84FA4EBBC, 0x9D9F39FC274EDEF0, 
-0xD950C56EC87C8199, 0x4F72C20F4827273B, 0xE140D9EFCD0B9BCE, 0x6B6B14C427B6, 
-0x15A8A6C348B882EC, 0xE33C5C7F895196DE, 0xE3BC9E74B934BD3E, 0x7111400D25A0F603, 
-0x854F5ABE66678B67, 0x2D86F0E3499AAB72, 0x5264EF5DADAF275F, 0x66999D371C3356A8, 
-0x9A31DF2BED8E0630, 0x64E8D738C4F8EF55, 0xFC318375AC2E4A0B, 0x9E1EBE936F8, 
-0x39CBD74059B4D8, 0x310C545AC8011776, 0xBE975F6AFD4A28B9, 0xB8B827A64DC724F6, 
-0x3742B1D8E112AC0E, 0x1423BF3169A07E8B, 0x7C90E50B7274F81B, 0xBDE4CF8576CF5EA1, 
-0xC626CFEED5519D9B, 0xA0E5C19826A7388F, 0xD411BD5507FDB531, 0xACF1C341FCA, 
-0x94A55888DF13017B, 0x721F150EC5751AC5, 0x473763DEEF48A305, 0x4152B9F51079D6CE, 
-0xDA6C20EC50C8C085, 0xB5317A12C63F099E, 0x45AE4BDB4D8EF7E6, 0x5FB64C76BC63DD40, 
-0xEBB48DC8C71AD393, 0x4248A9CCEEC4A864, 0x15BD4FEB21DB9E54, 0x36F63F49B7EA, 
-0xB1F6207E971C47AD, 0x5F81D28F21EF3158, 0xE6A4375E011B775, 0x6DF7FD6E5C4218C9, 
-0x8FE192FE7396C480, 0x9D6936641B1291B5, 0xFBE2B22CB1B310C7, 0x9645E14114E93C26, 
-0x66E31851F0DBBC1, 0x554D97BBDAB48C23, 0xD1151B20701CF2B, 0x355284C4C516, 
-0xC705C77CAB1FC7E7, 0x57D3BB65F5A14BB2, 0x267BD2EEAB7BDE6A, 0xFF69272926E5C1B7, 
-0x8B5BDFDE5F7C8E04, 0x82B3A0C1EFE0EF05, 0x2A75E89E323B5BEF, 0x43CA2530AD13E2BE, 
-0xCBB70932B40F6A38, 0xB366A3D384B12B03, 0x1D27C12772161450, 0x43FDEF19BC99, 
-0x652BA45825923A36, 0x1D7F6DBAE53C2A5E, 0x39C78D91548F098C, 0x3239E4BEC89DBAF3, 
-0xC2C08F2E78430805, 0xAD69B7E586C73343, 0xBF8441F56E11E91E, 0xB9F78EC11E373EE9, 
-0xA6B7F819D647063F, 0xC40B7D88A48F7AF4, 0xA6FCE170FA534ABD, 0x463B7BC5DF08, 
-0xDE39595D2EE84930, 0x60972952B011D825, 0x19BDA50801514D18, 0x725B11DC8B60F643, 
-0x37E91D3C89CD27D8, 0xFDDCAC990556921, 0x496AC27933517C71, 0x81B5CEDB9EABE349, 
-0xD6BBC91196E628B9, 0xA67211B597D8B27F, 0x17FC7CFBB8459F2, 0x51AC687ACC99, 
-0x58A38B922E60BEF2, 0x51878C142CA7A3B9, 0x1BFB203477A6CBA5, 0x8A2D2B7F6C531000, 
-0xA14EF7F7F80A4517, 0xB6B1030434419310, 0x89A4E97A44A9F4FE, 0x730CF87AF8F2535D, 
-0x7F49638CECDA792C, 0x7449F5817E31BB85, 0x7031E0B3C65ED3E0, 0x3D4CD2180B6, 
-0x9BCAF764BCC29D1D, 0x82A447BE60BD0FE4, 0x867C63C058BA0D1, 0x8D03EF3F3829D7F, 
-0x625DC4A38C85366C, 0x4B308C53227D56AA, 0xE248BDE4CB898055, 0xB81FE0D969F9E7AD, 
-0xE1247F52B14BEE8, 0xC574DD1A81E78642, 0x3D2F42ABC9C0C8F6, 0x616FB69C4ABA, 
-0x96BCD3F6EFF06C25, 0xC689C79C41562BAA, 0x5638474E888221C4, 0x3293F4D8670F69A1, 
-0x483429ED84D76FBC, 0xEB457A592BB72348, 0x4A9CA959F9B02D5F, 0x587E0CF53A191975, 
-0x687CCB717ACB451F, 0x40C2C2282489B145, 0x517A2A9A6B8A9B3C, 0x606F24B962DD, 
-0xD3DD2705EE6A03EC, 0x755CB73A50E924FD, 0x7FA162E23145D7EE, 0xE1DEC53F23798ECF, 
-0xEF075AB86ED250CD, 0x15AC6F75788C7EC6, 0x991D95CE62C570CF, 0x9B2D24F24D1F07A2, 
-0x9FC8A27CCD61F716, 0xB46D9969D89D4AAF, 0x2C3EA2804E29AE0D, 0x3ACB7F87B708, 
-0xBE6E5AC2BD51D7C5, 0xE03D79C517BD8424, 0xA4F005BB871C4B4C, 0xE096771860938E7F, 
-0x958825F247661F14, 0x101F232F47F4D82D, 0x7C3B5BE17128E05B, 0x70F15EF5EBC53CDB, 
-0xE6918A03236AED8F, 0x4946DEFE263D5AC, 0x295D86619FC104B6, 0x45A2CA84537B, 
-0xA533B7BE5D964C74, 0x577C511B4E36EC15, 0x4F647CEAD3128B26, 0x796018BFD842A17, 
-0x94EC1F08094FA71F, 0xD86057AAA197DA9D, 0xD121565EB7B57F02, 0x7B4F6AE72B1AB1B9, 
-0x4F5831F2C1C7798, 0xB56B24993E3936B0, 0x70F0C239B5AA6271, 0x277076765306, 
-0x76F1ECE8AD140F73, 0xD5EFA3CF66178923, 0xF7D453981B4D9F96, 0xD910D3C214C6814D, 
-0x8BF9C355FD30C85E, 0xEA111CCC96A0F27A, 0xE54266318D2CC38E, 0xC54E6C34E0FDAC02, 
-0xEF2AEC763640E647, 0x8D847177FAC3CE47, 0xEBCB9FBE761DFC18, 0x7E2F8963694, 
-0x8B6261BD0B1A9C40, 0xD3289138F5043A0A, 0x715D1E2BD589A262, 0xAB19DB68F992093E, 
-0xAB28B537CE035EC5, 0x42FEAC904765619, 0x32F97AA3ACA1AE36, 0xEF50C1BAC09880A3, 
-0x174410DE55EE3055, 0x1BB96F5BDF8B3310, 0xD52CACB85042CB36, 0x11ACA19869D3, 
-0xF858CBE1E42D63CE, 0x93B45A7A2B472B55, 0xE34EACD1871BF5A7, 0x5FFDCF2F2997122D, 
-0x2E1AE3EF3C13767D, 0x3027DC6ABCDFF7C1, 0xE20BA6855D5778EF, 0x3912F7167DB718FD, 
-0xF747830A4DEA8D25, 0xD3F1F9A61039DE80, 0x7A1C25C4606C2EA6, 0x4AABA2815C5, 
-0x6728DF7C40584615, 0x7A732BA27C7B14B, 0xA5ABB6CCF4FCF15B, 0xA266ED35298F9708, 
-0xF35B81B6D843AC6D, 0x281425993D7A490, 0xA3D43F69A1223A8C, 0xE1DB4BA473E14153, 
-0xA2773175E8B196E2, 0x2A13C30FFD284EBA, 0x97CA4AA8F639DC76, 0x635F4BC80502, 
-0xF8BF32505DC93EE6, 0x4E611494262053D4, 0xD811A88997B1B7D7, 0x51D84483DC4363B4, 
-0xA878CE943174713C, 0xC7D8F1FD0E0E43F8, 0xB23AD6F8D900464F, 0x155617322D6D9626, 
-0xE446C8B49D24F388, 0xEC349923299131FB, 0x23528A8C08C039DE, 0xC14EE712151, 
-0x9610A785BA208052, 0x9105B4BA58C33CE3, 0xD9D0CD11C31922C9, 0x2783292FCCFF8BBE, 
-0x6E2342F781223FAD, 0xDDD5E013B6AD7F25, 0xE09F6B6D52DDBE27, 0xCADE4827FAE9BCF7, 
-0xC230BB237C7A247D, 0x7D8A9FEF20ECDAB1, 0x75297D1E480AFE6A, 0x337666FC7CD3, 
-0x47828996EB6B71E2, 0x7E8603C8894FAABD, 0x25F5D0062993FC25, 0x14B4BA53196B0698, 
-0x990DCE11DCCC9BF5, 0x67355487AFC0D2EE, 0x9A3FA0F2E148139, 0x13C1A2A6AF134D5D, 
-0x307C7DEDF60B4977, 0x7AC1CAACD6602D61, 0xC816D3AE3D1CEAD, 0x56BA55BD9066, 
-0x5AF06EDD41D8A041, 0x1B7211CDC31C9DAF, 0x461463FF719086F9, 0x84797BADF5E9EA4A, 
-0x745694398FA1BD39, 0x317F811CCAF0F299, 0xFB8F9D3B21A4FCF8, 0x52696CC965C690E, 
-0x1CE6006D6C4E4C9E, 0x8CCBC0A0F6135299, 0xF314F8F7E0D15C47, 0x3309DAF22D78, 
-0x5F8AC58FA4C95B15, 0x9B6D1A3D3FC8C526, 0xA29A77629B3E648D, 0xFC403DDE12C51180, 
-0xD97A694F3FB126A4, 0xD91B2450CC6474FC, 0x194F2BB46EEB2B06, 0x1C8CCE5AC8BB9FFD, 
-0xCC4AA17E9A1974C8, 0xBF92332FFBF817E6, 0xB1C4CCB0F20982E, 0x23DB6F4D952B, 
-0x9AB19D1BD9C4192A, 0x45B67B45E5B905A7, 0x2EFFD59C48FC28DA, 0xC9F2A864D1F2AAC6, 
-0x32EE09157BA66269, 0x9D7F85D90960D6F6, 0xB7B53BED0D41522B, 0x57CBDEC741B6D878, 
-0xE91D8F866937A2DF, 0x5A42550468123E14, 0xA46612B1AEB8EB1B, 0x15F61B0ADB5, 
-0xE9179380D5B3B07F, 0x9B12F076A76629FB, 0xF59A254621A9DD1A, 0x7BA327BDA3707DB7, 
-0x6C3FDB3AF114E442, 0xB749AC4D79B9CD67, 0xD83A11C169AE71BB, 0x93742888F587D915, 
-0xB07A67C1ECA8F66A, 0x9E3FD62E466406C8, 0xE83D576012180D99, 0x5063AE0351D8, 
-0xAFD499C52B38FFF7, 0xC5C9F8D457DB93F3, 0x7EEDFE61E974B186, 0xF0ADE8727FB0FE33, 
-0x8A41003365A56575, 0xF722E300EBC38DC8, 0x449281230E4C1959, 0x1E2F38E0C13D7560, 
-0x8A8FB08DD12FF70D, 0x3AF90221BD7F7C3E, 0x83E9227E39703134, 0x2EC1BE91EB0D, 
-0xC28B3846C7D3229F, 0xAA6DBF17C2B9C230, 0xECB6EE7557055400, 0x7B8E4AAE71B422EA, 
-0x18B4CB793A660C7D, 0xB7EECAE4579D16B2, 0xFC14E2305CAB311A, 0x57DFFFC24566257A, 
-0x1C7BE92F6DED4159, 0x51A0DB4CE358BE57, 0x57CA62D07A2DE3CE, 0xC22D454DCB2, 
-0x5FB3DA0B5DD7AD68, 0xE8AF2CFA9D5A701A, 0x612F80433A4D2D2C, 0x9E7A48E14B9198AA, 
-0xE2F636BE898548DE, 0x942E2E451833468, 0xDDE9B2A82A540207, 0x4EC86DB6D31EB905, 
-0x576A085C3DB95F2D, 0x3BB564E926C4F52D, 0x5CAAE87A3BE47B4, 0x66C0CC9E7984, 
-0x6E7F4B70D430D7AD, 0xF8D1D45E9F4A47E9, 0xE9B5926F15AEA322, 0xE33E9798FC8E83CC, 
-0x8FEA8155B162A9A1, 0x6D83D71A6CEE53D, 0x878D740F35052F65, 0xE1B7B6B60F4F966, 
-0xDAD403361EBF1315, 0xE75A136A3452E3C9, 0xC67F5B803133F23A, 0x4D0EDA95F36F, 
-0x755B75008156B11B, 0x2DEAB14C28BD4FF8, 0x5259F174C173747A, 0xC24559B0C4A06F97, 
-0xA758101D84ACA, 0x595E9062BCEF64DC, 0x669BB10C1BBBD03A, 0xC167906A72C82D85, 
-0xDACA7E21C5889955, 0xA6A382D75D535DF6, 0x6801224E5F5D7366, 0x2D1F991E7BFF, 
-0x9655D5BE2820AE9A, 0xB50845E488B99C12, 0x1015F19C2B667F24, 0x71609E35882758C4, 
-0xBD0AA3B799C28826, 0x5315C6D2CE855E3F, 0xF9BE5D1C1A582596, 0xEDFA7AA3E85E4F79, 
-0xEC9C8E81FADBA87A, 0xD32467C260DA9227, 0x900FC38799ED3932, 0x66745268000B, 
-0x703A21005CD4CE97, 0x195BC8A607626CCF, 0xA44274E4AC0A0245, 0x39EDDA9A244CC486, 
-0xC4DE05540F7A136E, 0x9972D19AB7398A45, 0x4806A6C1BDF02688, 0xDA1E1441EEE63994, 
-0xE3B1267D7AB69D71, 0x3E8416BBA2866D41, 0x8A1A999C910B1A0D, 0x2028FC9E060F, 
-0x5B71F384E16FE31E, 0x59E8F4D0CC1783E3, 0x8B7D39565C7747F6, 0x92B562E4F4EF77A4, 
-0xCF690958B87C5B5C, 0x9A9D856DAC9E2ADE, 0x4014BFF7B6C1C4D6, 0x1F30964C60BA5725, 
-0x6A4F90002744383B, 0x84E8BD81DB29CB6A, 0xE8F62923DF97E1EF, 0x185C8C823B9A, 
-0x3BC8918118BDAE20, 0xEEC347655F026A04, 0x12F5BB753EB9E14E, 0x57B4B7040DB193B, 
-0xA4AC26CDDBA4774A, 0x944A81B16646D17A, 0xB96F7FD4E2E957EC, 0xB9DC1A3B3BD7B925, 
-0x9FDB2D86DDD009F8, 0xC5EB71E61274BB09, 0xC29AD1DED21F4C60, 0x95B2C224968, 
-0xF06408944C1FF30C, 0xA6E4E10680C6164D, 0x14BEBF3539F465D3, 0x79EAC780912A3033, 
-0xDDCB3AF08798FC4D, 0x5F2EB3650F1064AD, 0x1B4A118D1961F590, 0xD4359573C94BF249, 
-0xBF4A86AC6FC61C5A, 0x12BD546A7D7AF03E, 0x85C3350D975D2941, 0x30D3122CAEEB, 
-0x134B70319F764AEC, 0x924D7D7052B4497E, 0x5D3087E82A3DC9E9, 0xFB4384B3E9AC07A3, 
-0x9B5C65539C9579A, 0xEA6B75BDE8AEF925, 0xAE604F58495DFD61, 0x3417852AFE4976A2, 
-0x99E58BAF5970DDCC, 0x592FD4E8A9158F8E, 0xF2BAB0CB54AF14A8, 0x61B9C9D79539, 
-0x2780A9893A28EBA6, 0xFE5EF57B75D6C5CF, 0xDBA3CAA5E10318DD, 0x79F6DACE1EEF98C8, 
-0xB505D4BB4AA12021, 0xB5383BA8A650C6EA, 0x82BC1A6B6958A375, 0x5074C5143B726373, 
-0xB82B6E79D3701537, 0xFFF8396AE783A933, 0x669D4B0D4EC9086, 0x11B8C0AD8492, 
-0x85F066F5A1BFA063, 0x340141D546F386A8, 0x394A498732552E91, 0xCB3845E768180736, 
-0xDD21A008BBAFFCB4, 0x453D530215A956FB, 0xEFF8E1F773274291, 0xCC90D94A0C2BFF05, 
-0x39A96E41E24481DD, 0x9C27248D3FBD9773, 0x5EECAE3EAF5947DD, 0x15CD67C90DB5, 
-0xB8F2D4FB8F5BAD56, 0x42F88A7F1F8BCF37, 0x251D5CBE3394030D, 0x98DE7F2AC2F1ED87, 
-0x40A3BB29DFBFA3CA, 0x51AB302F93FDA9B1, 0x2620785BA3696F43, 0xFEB02D652DDA05B, 
-0xB9004BD0FFFB8B5D, 0xF4716B9D62B0C8D, 0xA8CAD58536A9806F, 0x5BE65C93C96C, 
-0x4882695F0EB97778, 0x8414D89F329344A3, 0xCE69DEED92B604D4, 0x631889525D345344, 
-0xB4BA77C30B285E0C, 0x4C7A13F079C6A1FC, 0x78F47BBB70DE8AF3, 0xCF93D55FDA5BCE4, 
-0x542B07CCE15C0A8, 0xD7E0A409786E0883, 0xCBD88F0B61BB7235, 0x6881D8A9F8E, 
-0xD14E3A73A98060AD, 0x648BE9F1047C5BF0, 0xEBDBA379B8DB9412, 0x4DA05E8F654E36C, 
-0x4E83814E5DA0F4C7, 0x7C7312B7CBBF526B, 0xDFD06238B5C59824, 0x2D747B0EBD74990F, 
-0x11022A06539C2061, 0xD1F90BEFECCEF068, 0x9D8A8AD0C7D55DDC, 0x666545983E74, 
-0x742CA1A62481853B, 0xFFC45D05D302E51B, 0xAF51650CC6FBE20F, 0x7BD22E002674F7D8, 
-0xAC9A0F4782EF1632, 0x984E1260FD529130, 0x5C0808F5813FB16B, 0x95DC0B40E40FD972, 
-0x85C8F52914854501, 0x89EB64270962ADF3, 0xDA71BAD07272AADC, 0x10496BBB005E, 
-0xF7A7438978CE0666, 0x9501FD401795E265, 0x8613F31511D49750, 0xC7D4E450A3783842, 
-0x4A8043D61CF9D8A6, 0x7061AAAFE015F2C5, 0x4800C46813BFFE71, 0xC0F3B7DA96B45B46, 
-0x9E71D7E4597F386F, 0xB4F95B4F4696CDD7, 0xB76A3DBCF6891DC9, 0x3E8183CAB011, 
-0xD92D9A3D4CF5B4C6, 0xBE6002DCA097B746, 0x40F6E608F712EDB0, 0x8A72014C18B516B5, 
-0xDEEC1FAD7879FA2E, 0xF71FFD6F698BA88F, 0x31A0FC88FF5D540F, 0x81DA5EE92A29E452, 
-0x4513651AF65F9E7F, 0x814405BD047163CB, 0x5CA14BEBFB5A6D6D, 0x6C4DF29892FD, 
-0x72580B7C5AD7B08C, 0xED4BBB7B6017AD70, 0x49D654604594227F, 0x584F8ECB6ED41092, 
-0xDD7C3C1CD254F265, 0x5D781375BBFD783D, 0xCB3BDB746653F25A, 0xD46C76AFA1A81770, 
-0x6FF0D79245EDFAEE, 0x6A26FBAAFA3108E1, 0x5DCB45658DFFC262, 0x5901FBC4A8EA, 
-0x4ACB4420D1331E42, 0xAB7914EBB374CFEF, 0x22ED09398D0855CB, 0xF0F1BD136691F83B, 
-0x23D7B595B9B7B8DC, 0xA0D133C7ED6BBFB3, 0xB335EE2C683D6D05, 0xED2326C1F84BEFE, 
-0xC7F55789CDEC880B, 0x2759B2EAE71DAF84, 0xC97160EA31F76F97, 0x6B48F0917190, 
-0xEB44C89BD1615D3C, 0x81BE7F8BDC5EAD3F, 0x95BCA60F56BC26A4, 0xBC769EA70079C718, 
-0xB62F4A6F433090C5, 0xCB07FCCBC52ADEC6, 0xC8C3176AE27EE995, 0xCF61F3AF334F3EC8, 
-0xC2971069D467A02F, 0x1B06155170AE45F1, 0x4BC9CC04AB2B31A9, 0x2695DFC939AD, 
-0xF0D877046AF6AB56, 0x59B67BDD02D0EAC9, 0xB3A90877F4A9E505, 0x3474E6A63518A6AC, 
-0x12396FAC379B9A2E, 0xDD325E9DBA528A55, 0xF8057B113EAF9FFF, 0x831B469DC363F90A, 
-0x80B9C3F645F02CC8, 0xC8A56DB3958BB2BB, 0x73BA87F0D72C56C2, 0x6E394EA73A82, 
-0x3EECE01216AE8715, 0xC6A94F1784FA73C4, 0x77BFF9426BAC64C4, 0x9AE7BED25CE14A2D, 
-0xF98D72DE7E2A066, 0x9DDA842B983AB8D9, 0xD88BB34949FA5A0C, 0x835DE2CAF7D11236, 
-0xE88AE11C9E0EF6E7, 0xC49BB4C9FB566953, 0xFCB1019C4B7AFB25, 0x41C6B7259B4C, 
-0x94BB965D4A1A4761, 0x568521B0F8718113, 0xCF06EBDAB7460B0D, 0xF6556DC9E7EC637D, 
-0x310DBF67DCB9FEE, 0x55B4CCC819F47186, 0xAE207283C8311543, 0xBCAD302D40D382EC, 
-0x75A449C5AF222914, 0x301BFDB6A4D29CDD, 0xAA9562B1BD56ADBB, 0x5E88DD0439A0, 
-0x9774BA5E69E28F0A, 0x8A0BF8EC5B3EC662, 0x984FA717E17E3247, 0xF6C76CCF305BEC95, 
-0x250EBBFDE610E08A, 0x427193F63B23BE26, 0xB0DE90F3D3639FE3, 0x8B4EAB709611EC9E, 
-0xBCE4781FA7C2F9F, 0x87BCFF45886DD912, 0xCF7549B1A5EBBFB7, 0x3FA00D254E28, 
-0x39B520CD13457CEE, 0x785C10AD15D4072B, 0x1FB96DB90B32EDB3, 0x3E3AE16FD6B26BE4, 
-0x995045F84D6380D9, 0x8A925FB3C68B81DE, 0x7836AE8E8862F9F5, 0x1B30705CC20AA6B, 
-0x55E690E38A097BE, 0x8BE225C1F1C03459, 0xFC550843C0A36CDF, 0x26897B6B14D, 
-0x1715AE36A631CFB8, 0xA06BA303AC46BCFD, 0x3D607B80D412B768, 0xEBD28100DBC20C79, 
-0x7E2B382938935D8F, 0x6125832311D5864, 0x8ED6959BE618FC61, 0x434121C8D093EF2E, 
-0x3018B8C5D8708268, 0xE5D9DA772EDFA5FC, 0x49780F58D7F7901A, 0x42008FECE4D3, 
-0x9326345C4D1247CD, 0xCB8A041F78E2BB06, 0x406FAD67223D1795, 0xB13FBE0D44146A90, 
-0x7F64D8794119D028, 0x5DAECF426844325B, 0xE66E82D2617C3F1E, 0x91C6C9DE6886AD5F, 
-0x4257AF4ACB9C99E4, 0xC47BAAF5A64F78A1, 0xB2AF0E0842F0586B, 0x18CEEEF8E995, 
-0xFF28C28902BD6BEE, 0xF40C9D0A4069D364, 0xE6B0FC57E51CC354, 0x9812EB69D19F352E, 
-0x4BC28FB08BE603CF, 0xAB35618FF2FBC728, 0x48C53E646E04F795, 0x2BBB2575953FB011, 
-0xBCE192EF372FC328, 0xBD8281F26FF25BB4, 0x579F040829ED66BD, 0x17D94B945BF7, 
-0xE7E8315FE15862E, 0xE916E4A92E6A4555, 0x60E7DDFBD589DB45, 0x514F4744A3865CC8, 
-0x31E68138EB0BFF7E, 0x9A714A82A2E4C53C, 0x287A3488AB51CABE, 0xF97A3A9C4B506567, 
-0xC6FB82C59C3A6ACA, 0x2270CAAF676192EF, 0xDF84DE6ED58A85CE, 0x2C450E395CD, 
-0x9ECAC8A4020A01B0, 0x2A0139036B1A4D1F, 0x2A9CD2A5A2E1DA4, 0xBFC59E060B128733, 
-0x143158C6804BCE1B, 0x336A676FA7FB9AF6, 0x4AB23A87F90FB213, 0xF8F572076E43BD74, 
-0x86CB4CFDB811761, 0xB63A944B2C28E1E8, 0xE9629495B17608DB, 0x1C8C0D86BC54, 
-0xE85279E7E7C4D4B3, 0x8A13AFC76678299D, 0xF326067DA50C8C10, 0x137DE709BE4850A7, 
-0xC53A0704609D98D9, 0xED685054437CADB5, 0x7C3C0EC128C95D4, 0x31A22DA2EC38F533, 
-0xD7130F3A898AFDCD, 0x250BFAD52FFD7DA3, 0xE1301CE52AA243A6, 0x69D563484482, 
-0x8059D7330777B68F, 0x475F17AA58D71F09, 0x6275D25B764BCE0C, 0xB2FB9C04280A4C43, 
-0x53D10CB52E6A2E0A, 0x5A2346076A141CBD, 0x93DF8DCDF61DE0D3, 0x8532F52669ECFAC4, 
-0x7A0336486D17117C, 0x66BE900C6278FB4E, 0xAFCCBEFC7C284EF, 0xAAB5D7E0FCD, 
-0x2F16F8622D16672E, 0xEEE5BBD331C51245, 0x751A226FABDCF80A, 0x107770F3AA882ABD, 
-0xEB73B12223708B5B, 0xED3D4AC318FD1D33, 0x9FCEEBA10684338, 0xE6B74BD95DDEF2DF, 
-0x1CE60C2A38890E, 0x8FC43BAA1D94772, 0x3BF03C696EE9BC33, 0x54E6F1B460C7, 
-0x6322B5246669910F, 0x57BDDB076458A555, 0x551D9839D88A774B, 0xC58B958BF23ADF10, 
-0x97C9EC990864C435, 0xBD5F139EFFE60E19, 0x1F16A7D777612EA8, 0xEE4A60BC626FE0E3, 
-0x9CFEAF6D0A96AF5A, 0xDA3D298CB6A3856E, 0xDF3E41B45BFA1FB9, 0x4704F2F14B95, 
-0xE8B53897B8D90C8C, 0x701D79F480115D99, 0x6D94DE80D174A5A9, 0x1788C5CB0BDB265B, 
-0xBE1D5BC875A32B15, 0x73E495AF421DA74C, 0x207CAA26AF4CA7EA, 0xC420C73F7B8E1734, 
-0x27894EC93B9019F9, 0x9481FBBB10DA3EAC, 0x51DFC35D3A3D56E8, 0x2C6359794927, 
-0xCDA1970F7C93B5C8, 0xB45AA8C1E60F6850, 0x3255B91FE430F098, 0xF7B826D3F04C914A, 
-0xE43221712E73A70, 0xB1B6B5D02F6B73C2, 0xA01C05E4434F0ADF, 0x66B7896EEC01895A, 
-0xD0FC48DD01E2C14A, 0xF86E2727151B56A7, 0x20D20C413C452DEC, 0x43892273DDB3, 
-0x7D1C93121DB82F7A, 0x239B20AEC6ABDCA9, 0xED4FBB7CCB603570, 0x73B5892F3A6B24F4, 
-0xD390BF0C519F44B6, 0x74A91882CA3501F0, 0x242AD307CF2440F0, 0x5C83CE4A8370069A, 
-0x316EEA9DAA33381E, 0xAEEE5636F2C3136F, 0x48EDE10ED9400F9E, 0x1CE988406C56, 
-0xC3244204E76DC457, 0xF4AD2B38CCA0B456, 0xD91FC69D8C79C64, 0xC07814E8DAE420E, 
-0x2736C30D9F0AEE99, 0x954BA55CA86CBDA5, 0xA7FAE91FD19D90C8, 0xF808A9F234E7A7A1, 
-0x15EE00274D2E5E29, 0xC5FDA94D6A8413A1, 0x6C0A9706FD8DF6DA, 0x31029CF4CBFE, 
-0x258276E992281E18, 0x488FF92CD77C543A, 0xCBC30BEDFCD405B6, 0x58ECCF6A94635C53, 
-0x80D842A436DC1412, 0x9CDC2C37F70118D1, 0xE92469F449C5D049, 0x96BA570FF6040558, 
-0xE693CAEFD54BD6EA, 0x9E3607C6D81708A3, 0xD5C38178BFD7EAB4, 0x52C97E6D027A, 
-0x9B58553B8E259E4A, 0x5EEB7658D1D406FC, 0x1DCF9F45C9CEE7B1, 0xCC35346009789921, 
-0x8D0A130EF48F0B18, 0xA28ABFA70A24A2F9, 0xD906404D72E01F94, 0x9F2D3EFD18D9FEF, 
-0x1B2B1341DEE25B34, 0x6BB5A33162EC20ED, 0xC0F8CBBF275456C6, 0x6E027459A60A, 
-0x9C8E0F208F1382CD, 0x21F404A76639ADE3, 0x50429A5C75F2D424, 0x55CD618F2BA96424, 
-0xA514614F67679248, 0xC35BB0F46B83634E, 0xFCE199DED61CAA7F, 0xE5A95D952D37DE42, 
-0x5273C4471CA7DD97, 0x4191DDE3B4C2DA89, 0xD89DD1948A3A702F, 0x3B148A13399F, 
-0xC4265FDEC7EA7295, 0xDDEF32F75DFF12C2, 0xAA70AD288DD7E304, 0x9FBA8AAF0F07A77B, 
-0x3CBA412A2B0D3769, 0xD3153117BDB3E8BC, 0x2DC9006564DA1F1, 0x666E399982067DDA, 
-0xF0C1E7A804A2EE63, 0x7B4CA158E416657F, 0xA7FC49B473912C3C, 0x48862B2E6EE5, 
-0xCBBB3790A6B98393, 0x18784DBD70A032C2, 0xD5D7F3D682AAB4B7, 0x1AF00BDC0A9E803F, 
-0x8047A9C7CD82FA97, 0xCC89242A6E2C1F6F, 0xF64C1ACF260F2AA9, 0xBECD5B0AD0803707, 
-0x2AB9C68A88704468, 0x56C92D3EDCC8A2ED, 0x246BA18968EEEA4D, 0x4BF0CB19D87C, 
-0x36ED57E9F141FB0B, 0x1FB286EE5293ACC0, 0xFA887C19620845FC, 0xFE94E4437499307B, 
-0x9402DCBA23C9A816, 0x6BB4DF7398205A3F, 0xA7EB505089E21B45, 0xB75A28B4BF069AA4, 
-0x4AC56B55EF9B5DAC, 0xC58F343D5202D876, 0x626F8475CC02904, 0x3F0575C47254, 
-0xB51205418765C853, 0xE653BAF7D1E9E374, 0x62233F3F8238853A, 0xBCC3A0DE18914766, 
-0xB0838D6CD637B52E, 0x3C9517B6063A13C2, 0xB3008E4C7C023208, 0xFC8FE22C4CED981C, 
-0x2AA1E3E380EF692F, 0x2CA1909D19DAA407, 0xAE6D6C547BF30B45, 0x24C53B1C7B46, 
-0xCC92DFD30310FC5C, 0x1E59452CD0FD7967, 0x8615BC042AD19574, 0x3E4AA2B1F3CD2E61, 
-0x5E7F478990071430, 0x8B5AC09BED81A6DE, 0x53EE034304385C35, 0xA221EEB56C00B32B, 
-0x17E1465E5524CB54, 0xB0C54EAC0C3D918B, 0xBAFA4A4CB24CA93, 0x43E99D554C44, 
-0xE3DA774EED994B17, 0xBA5AAB35B13065FB, 0x3F557E5820D4CCE6, 0x8CDFC36D504F874, 
-0x42599A3DBFA369CF, 0xC851F50650891DBA, 0x888B8ADDCC99B281, 0xC0C4C91F3B2711D8, 
-0x47C42B22AD319CA5, 0xCD46F46F8AB40163, 0x69B730E40AFA04A6, 0x32781F90C521, 
-0x269839DC7D93339C, 0xFA1C91AE87C2435C, 0x4C862967F7D03502, 0x56B1B06DE05DB173, 
-0x81A6730FF9523F38, 0xF68613712AAC3A7E, 0x9DA2445F5DC75F83, 0x305B776454CED789, 
-0xC9A59E62729B28C, 0xA1DC08D46FE825A7, 0xFC3B141BC08F3EEF, 0x459322CACD08, 
-0x9A80FBDEE1EDAC24, 0xB45AA93E2A043EF3, 0x6E30F7F0B725F8CA, 0x44EDD7DBF72E0EE6, 
-0x8161FFE513294B74, 0xD5A947990CA55A9A, 0xA65A766F80E7B4D7, 0xBD68031C3A31B8D9, 
-0xF024D7A91B2C7DBA, 0xE4AF88B3EECCE137, 0x384F66EECD7C24D9, 0x1347B2F2EEFA, 
-0xFF5A5D8EFB466972, 0xFCD94A2A8484DAF2, 0x75F81C3D5484D73B, 0x2871C716D4FAF1, 
-0x76E3FD0F6569BF71, 0xDC4B5408676B0033, 0x4E6D66DB7705BECA, 0x5654202244F0B233, 
-0xE4FDD7F0888A9418, 0x4BA265D5ACE68994, 0xFCB2C85EC38ED3ED, 0x598BA80FF7C5, 
-0xB9BF5184EF1B9F94, 0x22EBFBD8FDF1A9F2, 0xE7934E02ECFBA458, 0x2A03F61D66E91A8C, 
-0x6BB87DC78759C52D, 0x836D0167E1DBF9F9, 0x6E7269124DD47E31, 0x5DF65A7B164919F, 
-0xC1513501485FE095, 0x365E7E4927F242B0, 0xFB0D7F05EC923D43, 0xE68D78A5D84, 
-0x4E48FA67BAD6797E, 0x4F2511F99D192D00, 0xC33C4C674347D903, 0x773AC52C6E9B9945, 
-0xB6CF76A4D654D419, 0x3FB2468282EEC017, 0xE26EA5A52967A6B3, 0x5C7035783632CFFD, 
-0xB819D06E082B21A9, 0x31EA081C9E7BE7DD, 0x8865831EBE09EE2, 0x315C91281D3, 
-0xD3CD9B8C58F4774C, 0xDEE408FD5A80733E, 0x11D973487C56C4DB, 0x8504F2E4D4516F32, 
-0xDC785066DECD7F89, 0xCB020FF7DFC9499F, 0xD7BB540363647364, 0xC603DF335219EC8A, 
-0xF11AA731BEFCEA6E, 0x17F149E4019400F8, 0xE9C6D62556449B4, 0x4D204BA3DF7E, 
-0xD472769014091830, 0xD41AC2061655B4F, 0x7E45CB998F4B73B7, 0x170F9CF640250522, 
-0xF5CDF79F2860E092, 0xE83FC6069802D8B7, 0xE17ADC493227123C, 0x2DCE5E41F36D94CC, 
-0x768E72D79C95AEA6, 0xBF811A1741E360B8, 0x263B4D6BD9526471, 0x22479AE9D0E1, 
-0x773E4AE01A3D6079, 0xD24C1EE2AB0C3EC5, 0xCE1EDD6DAB1716CB, 0xFF65A0BA987F0C08, 
-0xC893E261E14274B6, 0xEEF9AA4B3AAA6801, 0x9CC81BE4E25C63A9, 0xE8067A16709237F8, 
-0xFC7F2BF552D48039, 0x389F26AFAC96A823, 0x301C461895ACA579, 0x1606FB8855AD, 
-0xC365BC156BBBEF88, 0x531E9A84D0D19741, 0x1EE4FEFAA37A6C7B, 0x6886248488EE8CC9, 
-0x23EC7C42CF2522AC, 0x943CC3FE2ECB7ED1, 0xB4D2C3D6719D923B, 0x536CB7DF51117F8, 
-0x9375457064FB00C6, 0x590C9D0F196E207, 0x8D989808C50A680E, 0x5047595073A8, 
-0x677CBEC5FF2E56A1, 0xA47189147221959A, 0xC9B361AED8C7191B, 0x298A0B2FFE2B02D1, 
-0xDF3E7E1184CE0EBD, 0x613E736A900EB26A, 0xC6325014BA9678A0, 0x54D4ABC2860BFC, 
-0x78F8C0160881AD3F, 0xA0237E6AE9119549, 0x35E4D8EB393174F4, 0x2BD941FBCD23, 
-0xAB0F6AF5E3072B27, 0x6C4D341B3AD9F059, 0x3B8964BCF7031996, 0x1FCAE0ED2F55AB64, 
-0x2EC0AA15F8957DE0, 0xD27FC87BD878CEF6, 0x19BE6F649BD7FC23, 0xBBAAB49AB84FF412, 
-0x4822E515B6A0DAB8, 0x3177010AAE4467C8, 0x7243076180471CBE, 0x19931D5E1A97, 
-0x98E44ACA398D8AC8, 0x2BA03736CC15D2AE, 0x6BCEBCD61F9031F0, 0x2502CB8D47C751C7, 
-0xBD7424E197C54E55, 0xA58521527001B36C, 0x74D928818FDA6A13, 0x36E5041EE1D4CA56, 
-0x6029040493AE6153, 0x40CF2D999D431DF8, 0xB15EA92CF81D584F, 0x53B0B79FA57F, 
-0x5690A408C9903390, 0x4029935BE6AEA3A3, 0xCC9A4DBCF9025BB, 0x8EAA5784EE65F438, 
-0xD7D351CB3303645D, 0x99D159A27654A560, 0x9A53A86A9A6981A, 0x53B2A90975CF80E0, 
-0xD665B18FCCC0E62D, 0xB47B432DAB99B6BB, 0xA075DA867EB386FD, 0x4DEE71AE2875, 
-0x7E11272AC5A05E95, 0x5AE2F1EBEA3F2E65, 0x7977BDDAB0BE4A2B, 0x42BBF6D55C9368C6, 
-0x5D1CD1B14846FD64, 0x69C325C23562DA0C, 0x3DF2979B23301114, 0xEEED6B8F1836242C, 
-0x3F18FE7315264456, 0x61A8F1ED2E72A366, 0xECC9086101FB6727, 0x67CCD65D0034, 
-0x3870C380676913A5, 0xD404C3C66E0FE68C, 0x9F6EE6756582409C, 0x7FB54C25857A6D8C, 
-0x865094E476BA4E1F, 0xAC4813B343D98483, 0xBA969E28AF64A46E, 0xFFA8DAAEBDC420DB, 
-0x966E00E6D48F337C, 0x391AE78393C21ECD, 0x3A6AFF3EDEB1B541, 0x4D62D056AF64, 
-0xD562BDDB554F4CE9, 0xB5981AE615B2950C, 0x58FE16C54F2BD10D, 0x6F45BB7E84050734, 
-0x5AAC33B9EB303876, 0x5534F07AC8B46974, 0x8C96DA0BBBE66E0, 0xC026B11F0BB523D5, 
-0x1FBAE0DCBA14D01D, 0x3DCEBEA033BF8544, 0x56EF0CC2C40ADF6A, 0x12D141D7655B, 
-0x13A4D89DB1086EB7, 0x466F5D597A1F3374, 0x5CA6C4B39F108272, 0xF2CE11C0369F6FE, 
-0x16463F4807B2CCDA, 0xF0B31AAB7C983D9A, 0x1E66B98FA5D0EF23, 0xB7B287FD808D5DA2, 
-0xB14DB0427A0CD2BC, 0x678B48A9721D6182, 0x260BB94302CF6A70, 0x277F48FFBA2, 
-0x7A22DE40481BB4C, 0x8F0447288780D514, 0xD6E57754C068E65C, 0xC423E33AF744A63D, 
-0xC7DFEB025AB5D58D, 0xF96A370CA6D28938, 0x3DB82C5AFA6D416D, 0x26518C2FB41CCB4E, 
-0x2380501D858DCE73, 0xF5B6C06DBCB998C5, 0xF1334D5CB9083D9B, 0x12A019D0274A, 
-0x13F44C9ED8E1192, 0x6998943067435A27, 0xCED813C5675AA503, 0x4B5F1D4837A01E51, 
-0x4D3CB92C9EBF47BB, 0x449BF355EF1AFC1, 0xD2150CC0F4DD964A, 0xE60D1E4A62B6CAC4, 
-0xDA5AED64602656CD, 0xBFF66B6943A49D8D, 0x511B038F7C6F435D, 0x4C75EA760D6C, 
-0xD9E3349A2F8F41BD, 0x9F3B8FC47F111169, 0x2088E6FAD9962C70, 0xDFEBF4D08BE94921, 
-0xAA58D08D032EBBB9, 0xBEC7CFFAF18907E2, 0x1F4F2FB860B38B25, 0x6FB8D04A267B5C97, 
-0x9CCDF4077724E3D7, 0xEB7DD4F44E68D538, 0xE48C2051F27AFDE0, 0x4E10DD7C878D, 
-0xB004E0FC1624A6A0, 0x38D72F64C2DC3D11, 0xFCEDD06914B733E2, 0x1C9E25A5F5A9AC24, 
-0x9F61E7CE10329D82, 0x5716ECB1AB1FFCD9, 0x746A8F3415CF3F14, 0x465749EF2A383FF2, 
-0x4769251EFD6E0269, 0x46A6DE19D4A3444D, 0x56D225FFFCABC14C, 0x61C80B9A4AD5, 
-0xE66C0E6B7B89F281, 0x19A0AE81000CB776, 0xDA97BC66E53B47F, 0x197D5BEB55BDE555, 
-0xD39F45F6DFFD314E, 0x908C9E47612CDB9D, 0x241CC868793391DE, 0xD50DA995C66B610D, 
-0xEBE0C885C8907BC6, 0x28151CEB94F14477, 0xCB496B25228C6917, 0x177CCC66E33B, 
-0x143F194FA9699D0A, 0xDEF11F9016A32572, 0xE6F5A096617C2B49, 0x1EF4C6F72A5DC419, 
-0xFFD505B781A16373, 0x97301086FA270021, 0xAE10714D0F7E63C9, 0xC56EC54611756C80, 
-0x933099264A5CBC1C, 0xE30E23C90BC2709C, 0x4A7B9D3D6D052F22, 0x2443ED6B6D2F, 
-0x833B1B3291D23899, 0xA2FE8A3C2D68674C, 0xFCF0CD7A147C40C5, 0x74715A76E47AEFE, 
-0xB67220B1F760A1A6, 0x64547F4BF8B63556, 0xE42BA88867EFBC, 0xEDC0254D9DA0B807, 
-0x45D35D9BA9F1EA7B, 0x2CD976C4DAF784AC, 0x50422715D9144C34, 0x28F063CE061F, 
-0xD6A4CE80F5A850DE, 0x5A6A0C6045F0BBE7, 0x36B98A220D8C91FD, 0x4D86F7E3B167192F, 
-0x2F849E91EDB7F95C, 0x215655F1A8EEF1D9, 0x369FC8D289DEDB75, 0xC52327D6EB3E0DE2, 
-0xC8CB8753E531656A, 0xDDF67B0BDC9BDF99, 0xE38DB166EEC7C3A7, 0x40D4F7615399, 
-0x81F51BD453C85FBE, 0x33613AA35DD80BEA, 0xD1D8185CBD598010, 0x8E77BEA3824FBD9F, 
-0xD0A8560CA42AB35D, 0xE109B24E684DD7AB, 0x23D2089C11138BE2, 0xE48A54D6AF682C63, 
-0x23C63F704E484DE5, 0xA0ED3B865A029BE7, 0x499D8A9C41F5D335, 0xDBDD22E5D0A, 
-0x84D554C89AEA7CC, 0x34E1121DFB5DE760, 0xDDED97E23CF5F930, 0x2D4E78986820728, 
-0x45297D089FAFB41C, 0x84766D900B49D574, 0xAE10AE45B882BDE9, 0xF2A8B789810DB817, 
-0x81D6758231628299, 0x99EB761EE746AE7D, 0xF7EE63B092E31239, 0x512F485645B2, 
-0xE4A31A33370E6A76, 0xE118F02356C6C4B7, 0xF56189EDFD865680, 0xDF8EB7C4281C3D04, 
-0x93A31048AC4D51BC, 0x9A6923E98A2076CF, 0xDF0D8A31811A5F95, 0x6855B8245330BE07, 
-0x6C9C54E22FE207D1, 0xF21B1BECCB8CC775, 0x629E8436CBF360B2, 0x145373896829, 
-0x5610CCD632CFF129, 0xC6D8BD1F7BAB6A, 0x6B1B1C837C8AE5C1, 0xE046450A5EAA94CC, 
-0x68CABCEB445D5B3D, 0xAE31BE0D43783C6C, 0xC0B4C3DB2DBC2BF9, 0x87FA693FF745EB0B, 
-0xEE7EFAB062BD8DC5, 0x648C2C29C91EBD3E, 0x48EEFD1ADCAB23DC, 0x11BB72BD9CAF, 
-0xADB280319F85DAEE, 0x741C6FF724DC98B5, 0xB73064117F5296C8, 0x9D763CEE379327AA, 
-0x26996C7D678A389E, 0x5743665A3382BFD0, 0x9269B2549C4067CF, 0xB915095B1CC30D46, 
-0x1F1049E374D0E2C1, 0xDDFEC955D043FC5A, 0x14BBC6A4F59A350D, 0x1EE2AF9AC72C, 
-0xAA3E580DAF3A5F53, 0xA7B80D9551389387, 0xE65EB938E7C2DE41, 0x9C7DCF67417F70FE, 
-0x8BB254A31A8749BA, 0x1EE04DB97A036A16, 0xC6E60FF6E34416C6, 0xE509EA6E662DAC62, 
-0xAC33B8DDC0221973, 0x2872D2CD69CBB99, 0x546321AF7CDD20E7, 0x329E660443D5, 
-0x7E975610B7402868, 0xB8F1906A1890003B, 0x87E563B471731691, 0x20FC77DD0E43A9D7, 
-0xD776FC48A0C9792E, 0x351C9C5441838B8, 0xD163C62E188AFCCD, 0xA7A8E4897740528D, 
-0xE61D17D364C104D1, 0x2774128158B3E669, 0x91D9759057C4E0EA, 0x2AB33A7CAF75, 
-0x83DAECF3A1A02BB, 0x1DFA78E277B7249C, 0x31EC7912AEEDA49C, 0xC52A1CEC0FE51354, 
-0xBBB26B6B49B6CE55, 0xCD98A643E3311C22, 0xDB4F10C37D564B5, 0xF1B65296337558BC, 
-0x11D510A5BA347408, 0x955924365C4FAC81, 0x79002D5A68A8927A, 0x10820C5922, 
-0x9D73623B7765856A, 0x688718C428973541, 0xE5142F70349888C9, 0xAF8C5EBE3BD96285, 
-0xE1C67A6C2716CB80, 0x2BEC639259622C4F, 0xEAB415EE260F6E31, 0xD8AA3B46C5C39E6, 
-0x884DB089B8D7355C, 0x256828668C97CBC1, 0x60466DA0092C995, 0x2FCD835A8ED8, 
-0x25E8629FC44645A1, 0x29347D0514386506, 0xC5BC58161596AD1A, 0x94215F9FE02D6B7D, 
-0x732D6961B9EF3BCC, 0x80FED19FE3AC53A1, 0xFC2C1D1D0D97AA0D, 0x3B87B78E7A695D6B, 
-0xC3D8020584CB23B5, 0x919D4A17D11B05BA, 0x4D7CBBEEC500FC30, 0x5DFCB6B63AFD, 
-0x513ECE5459E4C2B4, 0x611DF54F8515B69F, 0x814AA9970EDA7B9E, 0x90F3C9FB46CF6A4C, 
-0x6EE6172E625AF935, 0xBA36109C78BE3191, 0xF1CC508A61B18E21, 0x84BB4C70D570D0D3, 
-0xE3459F0A0E9CBD5B, 0x950F695B56B0D49E, 0x46F56931F4143053, 0xC223A76F99C, 
-0x112487C0D235EF1D, 0x238AEEFE08455564, 0x93E69ABF14DF349E, 0x90DE98DAB7BB77D5, 
-0xCC986377F66DDA45, 0x649EC65324CDD0DA, 0x4B1A7F874C6F189F, 0xD77031978C7A8DC0, 
-0x5CF057E6E5E4DFED, 0xE0EB4000B35329E7, 0x3970EEF8B94E063B, 0x11738CD90125, 
-0xA448CBF7E255F6B6, 0xE29FC7AC90A7B5BB, 0x17A30103B8C26A88, 0x872A52CBAB946FBE, 
-0xBD7DD4C3DCB140B6, 0x67482432E84AFFB6, 0x1F5AD8576E9DF49B, 0x6FCA807B05E7153, 
-0xB2B1F655A3A450F4, 0x5AF1F735AFDE3059, 0xEBB053B3679739AF, 0x4DC465DE6792, 
-0x9D8E87D0EF2588F9, 0xA2D0D50AA6C4DB1A, 0x9533E770B5704B55, 0x545D8722BE8B473C, 
-0x652350AB8B5C8465, 0x99FE7F0D420694CC, 0xCD1A532CD0523779, 0xF663E3602F40DAE1, 
-0xD3B650EAD0B88161, 0x44A93B1BC9FFF73, 0x67504C066A73F822, 0x224D58711791, 
-0x7FD64035DE36B2AA, 0x393646CC65FC1E45, 0xA74468EC1FABF8CA, 0x16D05FD424BD73C4, 
-0x7BFBB3729EF3D6F2, 0x8E13B579206B2293, 0x7D14EF99C01146B4, 0x969805B8BC7BA6B4, 
-0x5FE314421C3D8069, 0xD063F03D32321A4A, 0x28E1A2AB1D636FEC, 0x576D8D669932, 
-0x84F1CA74E730A08B, 0x11CE2352CDB3A3A, 0x208A1B6CCA597077, 0x6D2C0E38F1423EF8, 
-0xD9354BABB73892C7, 0x1B3E1523E9A0E39F, 0xFD52D40269A063E6, 0xAB86E2B510442C5A, 
-0xE1F75F78F09EB244, 0x6295BCBC56C1EEC4, 0x7B71E0C0EE987CA0, 0x30854E74A37D, 
-0x22AAB0C35608EE34, 0x7EE7F740FAFD0ACB, 0xA89C917F39528284, 0xBF89076994C4FB46, 
-0xF614A946C3DCD1E7, 0xB993D0F2CAA8B17C, 0xDFF9CD9B15DF5C09, 0x8ABE54750CBA0F71, 
-0x8928988CC9207AED, 0x2F529450322BC94, 0x402060EEBC1212B7, 0x88689EF4C93, 
-0xB40C843244F35885, 0x541B40A7542062D3, 0xC78F6CD8408DEAE9, 0xFAA8A2833BA29B36, 
-0x55EEFDBB5AFCA21B, 0x66798FEC1B485157, 0x18302B4E18EAA9E, 0x3331D1BBAAAE32C1, 
-0xC433574AD41AFFA3, 0xDD4969D768C77830, 0xD95B1C59898DF4CF, 0x9E5B2BCA110, 
-0xB839E875F671133C, 0xD6635663254421A4, 0x12171BD4D8F80ED6, 0x6B88F1056D7BE3AF, 
-0xC7531CC8B5C3E82D, 0xDA38C4E103D9DE98, 0xEB8205FDF66F9499, 0x8DCCA6F1203BAF4A, 
-0x9866F55CA08B610A, 0x87F1B54C2B3468A2, 0x178A32B3A77DC27, 0x60B9379CF849, 
-0x372FD1CC333596C9, 0x701AB79F6F5A8743, 0x8A2F1DB035E2D6FD, 0x15508BC6E9703534, 
-0x3F2DAE7AFFAF5898, 0x200FB7123BF36732, 0x8924DED99CAD543F, 0xCD428381A4102462, 
-0x88B8DD9A5613DEC, 0x32BF08AEA2E7CF92, 0x1B5D3D0312C210B6, 0x59A0B3A46E9, 
-0x8F5F4E6DD25DFE8D, 0x750366EF1A3C3335, 0x67A176B3E0FD3FDE, 0x67BB8DB6A49A38DA, 
-0xCF740FBABB9C3257, 0x70DC85CFF4C22E0C, 0xE9CBDF7D297F20A1, 0x65D6ED9B50C60E9C, 
-0x6DE55BDF6A24F8DE, 0x5F3017BFDF0ACB19, 0xAFB2B82700E58D2A, 0x5099D98E3417, 
-0x4CB86D520F369A5F, 0x28EFE7D6E4E90DD5, 0xE500065F44822F1C, 0x522A5C133079ED58, 
-0x898813A894DD682A, 0xD32EC17871E8D0EC, 0x85DC9E8FE499AB2A, 0x5F012654F35DF1F2, 
-0xF6DAB64221C227DC, 0xB9F0B7DAA46FBD57, 0xAFB3A32F0200DAC8, 0x4ED4A8818F74, 
-0xE66CD8FD0FC88BC7, 0xFAA13BDDE6357FF2, 0x27F8DC8EE5801105, 0x7EAF2688D7F939CA, 
-0xBB69EA13BE3CFA93, 0xDEC9069A22431DD9, 0x17EE5BCC3EFBB6BF, 0xB52E37A87BAF1EB, 
-0x896F1AFDDC17C49A, 0x633AC3D43F9C55A9, 0xB9467EA29F7CFAD8, 0x11446349954B, 
-0x24780C278F1F9C38, 0x4E1C92D16AEF6A27, 0x625E6381114169, 0xA4021A78B24FE863, 
-0x72147C78AD0C8E0, 0xAE7A8A160892618D, 0x159BC4D341AA3CC, 0x8F3F48957C301E90, 
-0x1773DC6CA3DBD273, 0x4C0F58CF4125F082, 0xD67A091D15B4E85D, 0x1F22AFF973DE, 
-0x6D59483AE520DF02, 0xD2178B1F2D25145D, 0x4AAE39B4E2E40CAE, 0xEE04EAC125FB2F71, 
-0xE5546BE8974650B0, 0xA635C4B7F898D90C, 0x5C367E0E425F0CF0, 0x55428C31A90C9C25, 
-0x5FEBD1A383343130, 0x3A27CD2F568013D5, 0x93FE208DD2B268F5, 0x3753D2A11A6E, 
-0xAAB6E74C445DF02E, 0x5954CCAE40F69A9D, 0xE3BE90C1522F47BA, 0xD8E298BE7D78F4FC, 
-0x545794C87F9AE258, 0x27A2155962C14A17, 0x992FB081D9B625CD, 0x2826704CD71A9240, 
-0x6F102E26473CBADB, 0x2B308DD6BEB12BB8, 0xCC507E301C0F2E5D, 0x23AD661B4B07, 
-0x72AB257D9268F87F, 0x7F8C79967E243E2B, 0xA7285AF5898008DB, 0xACDF7A5EC7E12705, 
-0x329C47A0B7EA6D94, 0xD69A228741A27B7B, 0xB964A81FB03530A9, 0x343338130F7FBA46, 
-0x3C068CD16F7A2966, 0xE1E0D0C2043A49C9, 0xCDF8AA068F8E9640, 0x6FADEF4EADA3, 
-0xB18CBBC3F539040D, 0x6D199A1196A420D2, 0xDDF46087BA6CF214, 0x13DB7A990595608F, 
-0xE51F437D71CF4AD4, 0xAC7C861A3279D0F7, 0x273A02AB610118F2, 0x869E8648244BC8FC, 
-0xD9156DBBF56D3A50, 0x4374709692253A7, 0xFF257092741BD036, 0x5E417B3542F0, 
-0xE7681D9D9F4D4686, 0xC96F3E692E3C1C07, 0xBE69C6641638580E, 0x2E641301DA617728, 
-0xA3AA48BC2BB3C570, 0x765A71A709CFD86A, 0x22313A6DBA9E18CB, 0xEA9E9CF57F6D8B9A, 
-0xD37BBD61E9D30E3E, 0x24E5FDDC2C5EFF72, 0x4FBCB633AE3675D1, 0x3BE8C45CBE23, 
-0x41F4B4474365B778, 0x74E99893EF8D1AFC, 0xFEC122AB170420DA, 0x6710C3FFAF73C50A, 
-0x81E866484FA11B36, 0xEE3E2B34D54A9377, 0xDDB53756A3DF8636, 0x847E993F75216488, 
-0x6761CC80C4225CA9, 0x7704662331100528, 0xB8A8B73D03663B64, 0x369CF9ABDA91, 
-0x2B7E41CB14A07387, 0xAABA08F99D0A5445, 0x6681002E6F613ABD, 0x83EC55374707264, 
-0xDA72D6CC985F7683, 0xE1952C2FEF094B32, 0xA1ED43CCDD00CFDC, 0x318DE46F6090EA6D, 
-0x909F3DC4B704FA92, 0x9A63D715A3F5365D, 0xACD5029AA2CEC09B, 0x1425F1DE536B, 
-0xCE12A42F50921810, 0xE987A76C37006FD1, 0x2282B388895DCFF9, 0xF26D12CA7E51BBF4, 
-0x215CBE1D706D47BE, 0xEBCC69C2C7AB565B, 0xCEEEF3FBCB8CC4EF, 0x70E00CC0739E2C1B, 
-0xE7418425230874B8, 0xB5E83CBC93ADB926, 0xDE72C5810C71568, 0x6BF72E316A3D, 
-0x426775E9B6C8177C, 0x750D2B8825FDC483, 0x658155D19E7F42B2, 0xAC807067D94EA0A6, 
-0x932507AEAAD4728C, 0xB481341955F70F3, 0xDB6C83D93A95B850, 0xF2197E9A028C19EB, 
-0x9C59992109B5E3C4, 0x50FBE08285FB453F, 0xAD46A1AA340747F3, 0x8371459D6E1, 
-0x89600C52C0F2DC5C, 0x1874270C9FE3FD12, 0x464CAE23311DB974, 0x332D91802E2D670B, 
-0x78C875D486F24E05, 0x2368D657A5D4CC91, 0x7797BDB2CC19F8CD, 0x7590E4964E946323, 
-0x96C61E5CBB9A9049, 0x5E7E944F7869659F, 0x8D5F2D006B08C813, 0x4B4ED03C79BE, 
-0x8884281FE01A31E, 0x16B6788F31E16480, 0x3AE2374DFF89F546, 0x55757D71841B6947, 
-0x7A577CD097D25B3A, 0x7F3DDDD9BB04E601, 0x4D28A620CE4F7151, 0xC599BAA4B96FEA9, 
-0x9A5363AC32E8B051, 0xC48C8CA36394F0A3, 0x3355240EC5B0ECB1, 0x433582C5A563, 
-0xEB139D9F29169057, 0x446EF2165E079BAC, 0xA59145FB78B0011F, 0x1B7EFA3E1B4D76A, 
-0x944053D3C41FEA1E, 0x46BFA00CC2AEE417, 0xA6E06138774206D6, 0x8022956C212BC2E9, 
-0xB73E9116ED84AE70, 0xCAC0C7CCA4B2AEA, 0x1ED39EC7AC069ECE, 0x1C1C50B5A65B, 
-0xDFEEF105E35F72C3, 0xA8CABDC7B8C24D41, 0x175659FD7812D118, 0x786B1179690B980, 
-0xAD7133475E14A1F5, 0x3F3D917684207593, 0xCB08EE72D9C5F8AB, 0xBDD0AD1E7872CC43, 
-0x26336F46C0E20521, 0xE81848CF83EB36AE, 0xFEC1FE298A544807, 0x50FF7D8082B7, 
-0xBBF68EE7A499B266, 0x70F1C604CC691031, 0x70D28033AF93624F, 0x17E8F6C8B514E620, 
-0x2D8D12ABD5A097F1, 0xAB01F9F9AD1BB5, 0xDB642884DE0283FE, 0x854346EF1635E2ED, 
-0x23242E3AF8D3A4FC, 0x6C511F9CF4A73E28, 0x250CEA992B6F34DD, 0x3A1D9B93F7FC, 
-0x5B084CEC5962394C, 0xB5B8877BE2F67767, 0x6E92358C85DB9B47, 0xF8DAB16B6E433198, 
-0x1904DEEEE18B572D, 0x502D129EF3BEFF7, 0x78F3DA1EA535CB99, 0xED0A0EF21545AB93, 
-0x481AF8A89E012188, 0x23E15454A294C70E, 0x81983DC40C0686AB, 0x6250761D4744, 
-0xC29E7C3D661D92E0, 0x96FE7F52B43E862C, 0xE81E5EE2999D1D7D, 0xBF953E62F20583D7, 
-0x9AEDAA420D3C2B58, 0x8788FBD03943B3E2, 0xE323E3F6F9FBAF8F, 0xB796E3A14BBA54FD, 
-0x4C7D8BDF50638EB5, 0x9A01D593BEADB278, 0x584637B5558446CF, 0x210669DEFD4F, 
-0xB589907676994247, 0x6183F76044952383, 0x51729AEBAC528899, 0x944AF7CF68AF8D7, 
-0xFFBA183FE2A518FD, 0xA4629444969D7143, 0x752111A116DEDEB3, 0x74F10CEB0ACA8CD2, 
-0x7E134FB045A604E1, 0x30B85CF993C5BEA8, 0x80ECB898B33D2083, 0x50ADEC28A056, 
-0xBCE39CEF8894C649, 0x4AD3CB5264F4B9DB, 0x6694D18E4835EC23, 0x77B0E5FF94FAA0F4, 
-0x9D2472F4634581C6, 0x9091A21F6194E8FF, 0x36F9AF912A688AFF, 0x54F7095E912DC214, 
-0x6A9E6F34A27A19F1, 0xD040DC2B0FB4F5FF, 0xA594B166D1E5735D, 0x54EF5B626C01, 
-0x59BF716E7203184, 0xBFA2F1407C684731, 0xC511410FD47EB374, 0xEC4580288BF8CD65, 
-0x6A52AA3F2C249A7A, 0x6567A602B394B8DD, 0xAEDE880D0D6BB005, 0x75DAC82F6F23ADAA, 
-0x5B93B62707EAB9C5, 0xCDFBA7AF4493BF71, 0x4C4E090E180AB533, 0x6124B0F1AB65, 
-0xFD41830E7420CF75, 0x6D9CCDE27B66B990, 0x81BA7CA1B3D7B765, 0x977C56F2BABB4962, 
-0x55E0BFD04612531B, 0xB5EE75CDD0F9BA6, 0x24B9F98EB783AF80, 0x18EE6FAA3F283B93, 
-0x7E014C378F12200D, 0xFE83228A11F788C4, 0xBB7BB00BF56C59C1, 0x12C616C4BB6E, 
-0xC97003FD9A4B230E, 0x50470B64FC8882E9, 0x859451657C1A1B3B, 0x34EB72E9C48216F9, 
-0xF1B7E95915A12CFF, 0xBBB1FAFDAC310547, 0x35DC1D9EC8647746, 0x119B76981A099E95, 
-0xF4D436CF93D1220A, 0xD47A44C9BCA2E43B, 0xE8D448B045151C80, 0x59DD1809F0F0, 
-0xC65907AE4C8A369B, 0x28B7FA352BE4417E, 0x8CCBC4A59A3FFBF7, 0x25E259250ED51857, 
-0x30BCB63BD9E3E7BC, 0x82E908E29F2644B6, 0x35FD842D8791400A, 0x9F6C166056C1772E, 
-0xD1FF0CBC2F0C2F62, 0xA1A90A3488EBD59B, 0xC9AC7D69FE1E24FA, 0x180787A34AEF, 
-0x873CB2905BBB316B, 0xB3CC1F9E0969659, 0x510880F70316E0BF, 0x6A38FF7A06A880A6, 
-0xFCCDEE32DBE98CF9, 0xE9266714A47C6D4F, 0xCBDE82D77B5DFD2D, 0x62E7852CE8D82B26, 
-0x22DAE6C2B2C433F5, 0x3ED978676D87BC8C, 0x562254043574B3BC, 0x1C6F7B63D6A1, 
-0x47953D3041650241, 0xE5C40D80C829C76D, 0x2CA328F19573D10F, 0x94D1D942DB6255B7, 
-0x244F30C926915BB5, 0x1A3D50DD633EB64D, 0xB5F92B85BAACCB1D, 0xAEE10A5BB2A70F93, 
-0x5030214C60F21CBE, 0xA1D85F5CA3EF6BE6, 0xC9F4CC0113AC1D5D, 0xB7A499F3C1D, 
-0xB2E7176C022FA08E, 0x8A0B2564800A176C, 0xBD1F46BF7F4FB104, 0xBC53CFF8DBF19875, 
-0x7E112735A11D885B, 0x277FF3A8268FABD4, 0xD93CC2BCCFB0060C, 0x5570AE12559E9B96, 
-0xEE2E9DB96901439D, 0x1B811D9CB821BFC3, 0x68516FF05A925D7D, 0x892DB52E3E7, 
-0x2B483E20E0D8D4BC, 0x36591B9296408D8E, 0xEAFC438436B1CEA9, 0xDAA8928E2C285024, 
-0x397F2580F3D0C377, 0xA7F55DDDC6BCC8E1, 0x337E8EB8FB1152EF, 0x7C7A04F41A16CD76, 
-0xF30BE8F6DF8818EA, 0x9BCD2038AC456545, 0x9044D1B71463F76B, 0x3FB901E81FF4, 
-0xA34C489107939972, 0x93872F1C94B7A5CE, 0x4FEFF424BB0EDAB3, 0xCA6362E274152C7D, 
-0xB563A3F7EFB44A66, 0xF268B8C03BB15EDD, 0xA6451BBD93FC4E31, 0xF0AC305E4F12693B, 
-0x57BD7A83686DDE, 0xB72E7D495789FCAE, 0x2933388CCECD7659, 0x2279740BE432, 
-0x303E33E76C8F536F, 0xC9CA480FD972B562, 0xEEE44AA5715E7C38, 0x4E63A2F77D55406F, 
-0x70A6D72024F9EAF5, 0xD95AEE1AC1E990A9, 0xA0533E56CA68DA59, 0x758DB62701C4C9C, 
-0x2033FE6D811A3F9A, 0x39DC585F2E5745A5, 0xE91694C4611C32F3, 0x374E24E0B5C8, 
-0x20572D6D7E94FCA1, 0xFDE51F0E73FD17C6, 0x3248CE69DC29224, 0x278B7A51CEB70700, 
-0xC4CF85E7DFA28A54, 0xA34F181C9ECBEB90, 0xE4075960168F8050, 0x863C9D5239198921, 
-0x461292220A7398E3, 0x3670CAE350C071ED, 0x8793FAA033A17715, 0x187BBCC0E266, 
-0xAE879A094EDDB919, 0xA79E0AC1646924DC, 0xAF49BC9BDEF05D7C, 0xC71036A7ED9F7A17, 
-0x1203ABE70CB912BC, 0x6B07477EDD66EDF7, 0x3174A6CE307E278C, 0xB5C0A1C621C46CC4, 
-0x61580AFA24F9617D, 0xF2926789B2A34898, 0xE45DF6ACD43E7413, 0x64C8B3781194, 
-0x2B37E86E5855984D, 0x9693CD1BA8B2CEA6, 0x1A481AFBF41598D6, 0x574166AB2D070CA5, 
-0x7AD487BA831B8BD1, 0x58180AFF7903C11F, 0xCB20E46128FA939A, 0xF500EDEFC6646922, 
-0x25C7C110A7F29A96, 0xF178F4DBD41EE803, 0x159EFA7EA8700CC, 0x4542C9D630AE, 
-0xC8AED865505AD549, 0xF0B0A799A375BF88, 0x804E71DC8F4C6D72, 0xAE0385A35506F07B, 
-0xF3841621178F2380, 0x67695C1DB0428D9C, 0xE93FA1CAA015EF08, 0x52F489F36CAE51A7, 
-0x6643E907CA452D52, 0x89EE8BEEB480B1F9, 0xCE2D7FC4242B46DD, 0x528AAB0060D9, 
-0xCC605D6F8E7B5185, 0xC0310722AE822844, 0x2D9A7F5BBE62AF5D, 0xE224573493D70B0B, 
-0xAE988ED7A9B79E53, 0xB2DF406DC4430E0D, 0x955887D49F2FD9E1, 0x931EF81790637527, 
-0x174CC87269E44164, 0x8B8CF3AEB7E0A58F, 0x26310124B07B36B9, 0x34A22A1E9BA7, 
-0x11266667981B0AD9, 0xCFFEDDB5C3E7CEA2, 0x6847E0E6A25E0C1A, 0xCB7794EDFB071E7, 
-0x8F9F303249C10D3B, 0x9E9F6DC89AF0C715, 0x2AAAB3A5D6CFF0E4, 0x6948A3F5EADB67B3, 
-0x5ACFD9CD7CC7E187, 0x1E08A3BE18132A51, 0x9DC2000A052B2702, 0x4F73C3DC504, 
-0x9F6093605151D66C, 0xC8B566BBAD286AED, 0xB6A2212162DDEF90, 0xC9F2A62A9DE797B0, 
-0x70F5D94D137310EB, 0x111E0F61FE5CA5A8, 0xA2B8C93CD24EE669, 0x4CB4CE7416F2152D, 
-0xFE8EC34E2EF067A4, 0x18B06333D35653B9, 0x5F1B2DC89B5C92, 0x42C09D8E3065, 
-0x13BEA01635FB6DC1, 0x86EA3F0DAE41BFFF, 0x9043EFF0551F4195, 0x79F8246CA36FDD4D, 
-0x5006CB938629979D, 0x155C43F98870ECB8, 0x3B1C318CF0E1DB23, 0x1C8BDEEB76FD5FAE, 
-0x32283EE7B6397E05, 0x85079A10B8F9B1B9, 0xCB4990EAE128BF2B, 0x1F47AEF677BC, 
-0xA026F0F8DD0869A, 0xA6D994CE5D11014B, 0x2C36FD2C146D52BE, 0x62B2608039C1037, 
-0x4AF0C2CB4E30C422, 0xB9E13D02AA899873, 0x12AE6159BBEF621A, 0xE41A42D5B5F476F5, 
-0xF96577C1428CB1D1, 0xEE61C2821727C8FC, 0x825024D349C626AC, 0x48D78B0780C5, 
-0x282989D0CFF892B6, 0xFC6A60D3849F341E, 0x60E7124AFCDEB85B, 0x25F1F16262488D25, 
-0x146DB29D3368E749, 0x685D4A4094CA38CD, 0x1C158052B7BA9D0E, 0x8F5282E856FA04CE, 
-0x2BD4C755FD32D1D7, 0x823CB694F7905C73, 0x7D3A49C0964EFA7A, 0x4B090623F16A, 
-0xD199EE947977285D, 0x1AD7AB3D5C89EAC0, 0x7AF3F3B9BE19A56E, 0xDEAEE5BC4F81F644, 
-0x244D1A5D3B3A34DE, 0x364BC714BB7E38AE, 0x69115AD1CED1D5D, 0xA816B9CB555AC789, 
-0xD09282D7A5379FFB, 0xA4064B8285309B3F, 0x6B5BC81ACCDACB73, 0xFBD79386916, 
-0xD5B69FA9A95AB355, 0xF949CF9FA89D1562, 0x1589D6A578B7DF3A, 0x459DA6D456036699, 
-0xC54B9BB753FCA4B2, 0x42673A7FC1C12FC, 0xA1E9FE67B900C61, 0xB027F066BD830DAE, 
-0x5F7DEFB6702BFCBC, 0x6ED5169C8AB9273A, 0xE0CFC3DBBF8A941B, 0x49A46316DB1B, 
-0x7E4E5D4309AA6AA1, 0x5258CCBFB70C330C, 0x5536521827A2205, 0x8D080D5F4D4E28B9, 
-0x5028CAD37433DF54, 0x91DF079DC2B3E163, 0x6C77CA77ABC0E608, 0xD6A59278824813AB, 
-0x32D379BAED981E66, 0x4D9696EE03E228B2, 0xBAC647767ECE43FD, 0x34FF4477BB71, 
-0x7575807E97153F8D, 0xCFE64AF03B532375, 0x469F6E7D0C90F15C, 0x57329722AFEA3E9D, 
-0x2A787E2B9B9A617F, 0xD556BAE63461A0AB, 0xB180ABF1F30656DB, 0xBD01EF02D8A3128C, 
-0xDD50C10834A86A6D, 0xE405C7DF8DC6AF5A, 0xFBD743243326544D, 0x65D8EA969DA2, 
-0x9174B39D3732DDD7, 0xBF2AF13AF6D1F76B, 0x252624A03EB9B06F, 0x3B5B426880B735AB, 
-0xD7EB70EDA7044446, 0xB60828323AAD4C71, 0xBEAFE823FBB291EF, 0x3BD957192A80AE5D, 
-0xF9FCD005D74CDF1C, 0x88668BB548E5B28D, 0x937D094A4E0F4B70, 0x1739D7C63084, 
-0x8F98B32FDDAFC045, 0x59F27A8236DED19, 0xAB33122E8DF61D5A, 0x445BC05CC2487BD7, 
-0x8ED2C90C7CEA9DFE, 0xA3B4B8C58CD02043, 0x507F7EBE1CBD400D, 0x6E12A6FB33E0195C, 
-0xF4ACE17D71E26053, 0x559A5923F77E4CE1, 0x7B2106CB9FDB3032, 0x337527C4084E, 
-0x6F3C870A2BA24B73, 0x20796616F8AA191C, 0xBEE8F32D7BB86896, 0xBA0AF4CEE782B258, 
-0x523832FCE291CDE7, 0xA65BC078331AB311, 0xBA7E22787B379C9B, 0xF289457F424D566C, 
-0xC18A3C10985DBF20, 0x2CE59673E5F46570, 0xE3FAEDEFEF30089F, 0x162893945BD6, 
-0x4C137C5B44D1E0CF, 0x846ACA786F5C8BB4, 0x28DF691FAEC69A7E, 0xF9F482ADC27ABBCE, 
-0x801BBAECE4E1BF19, 0x3B5F8D005F45FF7D, 0x5A35707E5C5CAA67, 0x9D30CD8683C08D13, 
-0xD7999DAE3D35ACD6, 0xBCB869816622D89B, 0x46933F44F3978629, 0x4212186DFB34, 
-0xFA6A886B21F2A64C, 0x4EF2D0ED06E6F6BE, 0x93196AF3DB0EA6C, 0xEAE3D7E40360704C, 
-0xE49CC92BAD5358A3, 0x5109D2D1BC770B36, 0xCE68D991B3244295, 0xD738C4F914263656, 
-0xDDE2249FD085CA8F, 0xFD4AA6049703CC12, 0x3BC74BCB2D33438A, 0x48D8196162B6, 
-0xE3BC2B6A4A3BE612, 0x4A5CB7542FFE7BCC, 0x3C4CADE1D8B876C2, 0xAEAA2069BAB8337D, 
-0x57B8E52846D86523, 0xB286817E54CF1553, 0x24D9B92BD2DE5251, 0x7173D49D5FB063EC, 
-0x5D349DC4EED0B496, 0xD528E3DC7B905916, 0x9632586DABCA3BED, 0x476CFFF4F32D, 
-0x6472169A3F53C4EE, 0x30B5AA1ADC709546, 0x1A81F105986649F5, 0x391ED91E7730C0D5, 
-0x66DB1D8789B9D690, 0xB78C24582119731B, 0xB999EF8736BA6526, 0x6192092AAC6E9546, 
-0x8CF48CB407BD5CB6, 0x26597311AE81231D, 0x5BCC024E44DE68A6, 0x17444B9FE556, 
-0xB35F2DB5EF795D38, 0x95D07BDEDDC81E99, 0x5184D72FDED5ED25, 0xB42E6DED2DA6C322, 
-0x292D197AA71A88C5, 0x721A055928D834A1, 0x9098814D275F3365, 0x8E77CAE6B0B32F98, 
-0xB0A0E8260CB8FEB7, 0x6E6A7387D8B9FFD4, 0xBF427EDB4B21C836, 0x21103A0E327F, 
-0x50CD225CF9795BA5, 0xD61203EC54267B28, 0xEBAD1DCDF58BDFC3, 0x856FB55B8595D8C0, 
-0x5EC85F873EF6C05D, 0x393D7F96A418F5B2, 0x7027F5A792802E24, 0x2E8FDF704595E1F0, 
-0xDFBA9BB93B2A3AC2, 0x96BF8129521FB3F2, 0xC97D90706C440A67, 0x3A0DB6C3373, 
-0x48551938C77F767B, 0x955D0AD4E05403, 0x86F4FA96BEB5F110, 0xC8899215CEB03376, 
-0x5916E11CB072ED34, 0x872D0413123A54EF, 0x3F42327595896BFA, 0xD052FF7914A75E9E, 
-0xCF0D305E0611BFBF, 0x6940F0590B88B937, 0x81936AE5BA159903, 0x1A317ABDA7A4, 
-0xF7D9BED550428DB3, 0x7D41D5ED63762579, 0xF66759CA59BCD6A, 0x79F4888575C75780, 
-0x329A5A42A3D55FB4, 0x3CCB1737EB1DD9FB, 0x62B05E828F6DA7F4, 0xF32AB294F54E829E, 
-0xC1C5C325AC5D14C9, 0xD90FC9CC7C4D1094, 0xBE79097186007C0A, 0x5497B0FEF930, 
-0xA960623B2DB9D04D, 0xC522B17050C07C7B, 0xDC8B798F2A3B2929, 0x42F1059CB4D486DD, 
-0x862933A809CA018B, 0x5633D434864CD89A, 0xDF96A7EF7C711349, 0x7F779AE43C8AAC90, 
-0xFC22BD25463D3793, 0xB05143E829F268F6, 0x98AAC69D3FC89319, 0x23C0BA91A073, 
-0xB5580FB0216D807C, 0x6842E20F7B5C8B8, 0x83562FE0C87402D, 0x5A231AD44159ACF4, 
-0xB4C72217E7E4737F, 0x9B788B439BEB5CE7, 0xD274CBFBAB400232, 0x751F2E316F83B8A, 
-0x939EBDF70D3279B1, 0x5E0A139289C9E6EA, 0xA9FBFF6548B98D39, 0x42D89A8E570C, 
-0xFB6C4F190B9ADFBE, 0x11630DFF1FFFB069, 0x35909D8751E3A405, 0x4AFB291BF79B611E, 
-0x3C967D71CAC96467, 0x18A5663A2C11C0B3, 0x1F330EED43548B81, 0x67F02B435EC523A9, 
-0x9C39E1C103CC5C65, 0xDD10D5C43724D3E4, 0x7FC0C45DD1EA46A4, 0x8D02CC324D7, 
-0x6D8F91DA1596BB0D, 0xC2A9F287D7E5A62F, 0x2AB717C39716C91C, 0x77EEF832188873EF, 
-0x66D956E5DEC3323C, 0x87A8AC03E82AE05A, 0x76F78866F1C2D8BE, 0x3063994F5E89A7BA, 
-0xCA1F82EA2B459F01, 0x4CB32B846B6A77EC, 0xA49E528479355175, 0x28E2C4767CB7, 
-0x1C34371AD0CDFDF8, 0xB21F09D2236F93C0, 0x1D830A51F1B0599E, 0x69B7C2043D22BCD6, 
-0xC4E846F9DA3718CB, 0x87AA77DC3B1026FB, 0x81726F581B47112B, 0xEEDA74B30325CE10, 
-0x6F3155E8B5C29F20, 0xA0ECFA70B74EE02D, 0x10B842F59FB79CC8, 0x15EFD42F389E, 
-0x96A3DB1883F0E74E, 0xF9A4157BBEB115A, 0xC868A01BF3E7FCDD, 0xAC6B6D14C5702D9D, 
-0xAD125F301FBBE687, 0x16D6FE2A44D1048F, 0xF1D6325F94D271FD, 0x75A6DFC15125CED1, 
-0x631738BCDCAEA5F7, 0x2D73B288304D2363, 0x2D280AD0DD6F9F67, 0x4E8C51B1FC7A, 
-0xB80F5A812F6724D8, 0xB377F9A0C549F425, 0x57681D8A595E4452, 0x3EBA2CD2D8BA3343, 
-0xE339268F44113A24, 0x4F6562548175A766, 0x31D5B945873A38F, 0x8ACEE13D21F77C15, 
-0x1EFFE7B92D066D4F, 0x101ABA3E9DA1C4F3, 0x657C8113D100C8B7, 0x1EF133D1DC4A, 
-0x89FCC2FDB8734DD2, 0x8DB86BA44AB6903B, 0x62098F4ADE648E76, 0xAFDB235F1DE11493, 
-0x834CB271D8B22F94, 0x315B921744F1B142, 0x9B5610288524DB83, 0x7917CB45CD79D475, 
-0x7C14FAE8E8FEBFA, 0x26F9F04C9F58F7B9, 0xCD244608FCBA64E6, 0xEC19D9AA001, 
-0xF7C0806FF7144DC8, 0x8F94B7BE2EFD984, 0xCE458F04975225DD, 0x99DFB34FEAC2F807, 
-0x227DD314AA459F88, 0xC2D0765C49CA476, 0xE9EC27F4EEE96248, 0x20B7FA9544B5DB12, 
-0xD60F3A33B46B5F43, 0x67A7B7EB51E8DACA, 0xD4C456388E9D985F, 0x6538E4847E31, 
-0xD66CBCFFC2298382, 0x83B4E11D41A0467, 0xFF7AE7A8A80F3136, 0x9A4D9E188137664C, 
-0x5987210638D45065, 0x2B431ECAD634CF8E, 0x65EE774FAD719E3A, 0x8A88E45AC466CD8C, 
-0xCD45F4E3CA89F8ED, 0x120956D243EBAAE3, 0xC24AD72713E36024, 0x2285254B9181, 
-0x89720899AAB66AB2, 0x8CE55A465234F1A4, 0xF0CC9FD903C34809, 0x24AA098E800C8670, 
-0xFB0CE1C5A423E404, 0xC279E9667ADA0CE6, 0xF33ECFD7122C0642, 0x59ED9E6F0F73E733, 
-0x62D89B3992BBA273, 0xF185AAE69AECF9E5, 0xEEA3CFC7C64100D7, 0x24997D49E334, 
-0x25BDDCBD4B3C8D4, 0x4467D39E2F76B26E, 0x5E60C8A5178B6915, 0xC6958263924ABB2F, 
-0x89A3D82D235C31DA, 0xECA19F747F8E7930, 0xC335EFA14BFA3321, 0x601AF45AA280FB6A, 
-0xEF8BBAE640CB4C5C, 0xA958EC33CC6DF0B2, 0x9E1B3ABED346CE7F, 0x6F1CDBC0A7C8, 
-0x1489B2F1138E9E51, 0x3651AFEB7441CF5B, 0x7171A486A7E455D9, 0x929D5925DC2EC62B, 
-0x64B44545F2987EC9, 0xA4CAA3F69183C6D6, 0xF3D73409361990B4, 0x418840BA7E3C9E6E, 
-0xC5D92D4CF702EC45, 0xA6558618770E1020, 0x28FADCC503FA2771, 0x137D362DB47, 
-0x2B343D6D3A8A432B, 0x26D4E87AE988B0BE, 0xB320B0C7F476F84E, 0x682739F3E1A39CB6, 
-0x13CFB99535A39259, 0x7C16E480F8E06C9B, 0x391A0D26AC29AB8D, 0x4EC807DDF27D88DF, 
-0x15A6C53F1C8857FF, 0x79E8197023FD350, 0x9F583B155D6911B0, 0x1E61D4899E5A, 
-0x72CF3D06113676EB, 0x94D9FA43A5C93FDF, 0x7FFDD38F61602FEE, 0x878BDCD3BF0E53D0, 
-0x920971020E0419AB, 0xD79AE906EBDF89, 0x78F62879078D7568, 0x28A96EE9021C459D, 
-0x53E7AAAD7D42A281, 0x320374FB35ED109A, 0x65EA96094AA27837, 0xB08532CE4D8, 
-0x82896EB36A62264D, 0x4F6184E61EEA1928, 0x59B80E6C0CE43177, 0x137AB2A1C17A3E98, 
-0x75EE360FDBC08D13, 0x56943C6B6F2B75F1, 0x81089028AC067E30, 0xB35DCA5B210022D4, 
-0x446D0C01C79AE210, 0x9CA8848577A30C48, 0x86CA4864E7C7413B, 0x1D235771E63E, 
-0x3367982ECAE1D7B0, 0x6415BC206AA3409C, 0x28A91A9221616A6F, 0x31A610FE43E125B9, 
-0x75947E2EBA8BC323, 0xC3F48F7C99379B24, 0xA24D7001642DCA12, 0x18FB5536BFFE23EF, 
-0x164589F5E14B3137, 0x9C4D0E15F88FB18B, 0xE934A7DACE85F944, 0x371A90B424CE, 
-0xA2C7103C83591BDF, 0xC25965474A547B73, 0x6ECA778E6760B18, 0xC08D4A6A449CFF1C, 
-0xC4BE6FB5BB7B786F, 0xC89090E425F9D6C0, 0xDEFF390E60AE8B88, 0xA272354F2C454725, 
-0xF98F63027E3A757, 0xF2AFF77793530DC8, 0x11407F262C3EAF4F, 0x20F63F65917E, 
-0x59A8238D7F8B6AFC, 0xB43121BC8BEAEBA6, 0xFE30965E27BC2356, 0xBDC24AC277554217, 
-0xDDB70D3213CC12FC, 0x7032C936F0501E7B, 0x1AE7C34F2877BCA5, 0xE8BCFF1E9B1D46D9, 
-0x8AE009FB9E307179, 0xB4E0EE1B8B53A09B, 0xADE47160B404FF66, 0x117276ECD87, 
-0xBC2600D9A3D2674C, 0xFB21F317DAD674A5, 0xCDC9A7AC770019FC, 0x69B004B42A591F09, 
-0xAA363FD199065C57, 0x5B4EE78E872FD1E7, 0x7D2BEB4151C66EB2, 0x56AF8AF728334BB1, 
-0xAD94180C2C13B4B6, 0x82A65282C4A2408E, 0x6A57849DD846E461, 0x62845C57F2D7, 
-0xD1AFEFE8C4B86C76, 0x3DBA4ECE7E79921C, 0x607653A69A61B230, 0x704976DFC7014B5E, 
-0xBD3FACE46B175C8, 0x8CD32276F5EA832D, 0xC5666B64259D0473, 0xABB260328A74CAF1, 
-0x781F1379698F5623, 0x1E4C1A5A4067AC70, 0x6F4BAA47B1FE8BCF, 0x611F67CF9939, 
-0x288C0FACC453EAE2, 0x2042F8F21008C41C, 0xF529213558C022E8, 0x440AB278B1BECBDC, 
-0xF560D258C2F6F30C, 0x879974148D692593, 0x50DFE55BEB2B626, 0x4D637D0BF58BFF8A, 
-0xA8C635D0DDB19E23, 0xAD09C460BD3C0E89, 0x404A3D83BD7D7352, 0x641005C2957C, 
-0x83564BE569A69576, 0x9BCC9F9FB1D590FB, 0x92DCBF8CA9DB0C45, 0x2A43E9F2C1BFC58F, 
-0x300E624936F31A90, 0xD7ED9D77BAD6BD5C, 0x206515A33257B6A6, 0x356A76320C7DBA4, 
-0xF04735614286B1A9, 0xE93F5762361B8A42, 0xB19C4D94851F8ACB, 0x8A404961FF3, 
-0x6F783235BB59E7D0, 0xAF32C426B7324ABF, 0x789EAD0C42892714, 0x3A68254B5470F3B7, 
-0xD1C20A939D6A5E18, 0x729BC4C3C71D4CC5, 0x2D09A50E4EFC222A, 0x18A835CBA71D2B13, 
-0x20418D49D63CD75C, 0x3281F0B201811AC3, 0x1566D21640FE350E, 0x4F87A5169464, 
-0x11CD9A645CC26C50, 0x7C03295C9BC6C939, 0x3A52BCCF097045BB, 0xB2537D7CBA0A07A2, 
-0x64C3121A06EFB42B, 0x790C7F2A06F84B63, 0x5DD956195D155875, 0x9E412CBE5089F6B3, 
-0x30A4954984BC1ED5, 0xB77D033F40AE3381, 0xC30AEB60571DAE9E, 0x6942D0A9903F, 
-0x635BE8B639B84CFF, 0x2F4F7AD90784786C, 0x6F48576F99382A2C, 0x744659F160B6CA43, 
-0x260DF40F9361376E, 0x1ED0E2BEC3E2F18, 0x7E30B87B9034A61C, 0x48DDD30AB0AB9279, 
-0x66036BCA628110C7, 0xE3D68EE4D7AAE6E4, 0x779CACD2F15AC478, 0x5A0FE57E8359, 
-0xCDCD5B59AC4EDD03, 0x5526EF6C91CB2D16, 0x44953F971642DF65, 0x9DC8548AA7C051CA, 
-0x73D2933B0F77138E, 0xFD2F3B6C3783D194, 0xF7405C2E85DA1A3A, 0x32F04DF6F000250D, 
-0x8E919D0A560DD1A2, 0xBB7718A5A72BBD94, 0xBC723EA04560FA2B, 0x4F2327828A9B, 
-0xD722FBC9D64EA79D, 0xAB3A0A08D2F12487, 0x231439347D50F72E, 0xD66C2B982FE02406, 
-0x7B0F654DD0B032FB, 0xB344879BBFFD72FA, 0x9489BD36786E599B, 0x6D2546372970A68F, 
-0x551CAFB1411A6BD3, 0x4D9C60B2E76D9BAE, 0x558BFF7B200E1FBC, 0x439F35451941, 
-0xC866EDF411C9F64C, 0x14D649DEE17256ED, 0x992FC85EA278EFA6, 0xFA7B82ED8264A74B, 
-0x413079D13017E1E0, 0xAD376F01B83CC8AE, 0x4F98D014C2EEAC7D, 0x76384E6C6E1A7F24, 
-0x239FA7613CC9D63E, 0x340A629DAD3D5B42, 0xCA67AE0FA23C15AD, 0x531DDB83138A, 
-0x112D979ED19529E3, 0x26578045DA562F85, 0xC8AD1849C3A0ED93, 0xD756651E7A955979, 
-0x3FBEF976F125ABD3, 0xAE0E1EA45E9AEAB8, 0xE02BF5260B6F7844, 0x20FD6826B4D4895B, 
-0x2CEC17041BCE93FD, 0x54B594D13F24CB04, 0xC134F993025A4E07, 0x4E657F16F53F, 
-0x166A411DF847AB70, 0xB6FE9B00C134D950, 0xA571CA5417BC070B, 0x921DA09261035923, 
-0x476C499CDF7504B4, 0x53F2DF363821D02A, 0xD0533E94D89E55EC, 0xE4BE3CDE345B4BD9, 
-0x4A55BE4C9903E365, 0xC8DF59B4E860131E, 0x76CCC24A822AD019, 0x1F4DE7241493, 
-0x8830E05D74B787B7, 0x289387BA1B7AEDB7, 0x55FB9FFEF44099E9, 0x5B05997A9F08CDA1, 
-0x54A8BDC0D641071C, 0x37C15C3C0D0144D8, 0x8EFAF8C54AF2348D, 0x940C054BA4B986BE, 
-0x557D6B999C638249, 0xB11823818002B40B, 0x4011168DA2E135B1, 0x55ED8C560F59, 
-0xCECD505889638AF6, 0xB29326B82B9ACEE9, 0x1B83EF1A71A16706, 0xAC85E916FA43DD80, 
-0xB845B61AF56E19D3, 0x685E56312DE02F9E, 0xCF931C26B6F12F1E, 0xEDDE86684580EAAE, 
-0x5100DEDAAC65F18A, 0x8AD163C53543207E, 0x10B3DB8D6BD6CBA8, 0x3495222D3C45, 
-0x3B4212CC73C5A551, 0xA224C9DA59B5F4CA, 0x6FCBB08106234F30, 0x1E074E5EE0F9F263, 
-0xF704A7ACA04CEA98, 0xDF6C1A105444BAB8, 0xFBB44DA7F8B7984, 0xC0D3046AB90DF99A, 
-0xBE780BC2212E9710, 0xBE8305E6471327ED, 0x26E0E9EE7DE2BA9B, 0x6AFC455A1D7D, 
-0x57377B80B12DE156, 0x6F80EFA29F79FD9C, 0xD81CAF215E723E74, 0x773A19C80C3D55FF, 
-0x2DE51ED9F5D8D5CD, 0x63A713680B191FB6, 0xD39008BBF0DBED7A, 0x4FCACA9E941EF199, 
-0x267A24E9897B9201, 0x7AE908492EE65918, 0x9602000BE442FC83, 0x25C075EE978, 
-0x13D5737792FA9194, 0x418E7DE7F6F21298, 0xAE87F8409D915E80, 0xF4F10C43F87E915C, 
-0xB12B5D269C0226F, 0xA7826785839BA598, 0x7BC1B43521159E3F, 0x807F47BE37BF103D, 
-0x383C4862B4340D5F, 0x3715181C4C97DC7E, 0xC32711C82CDA13E4, 0x2A332D49ADC8, 
-0xB432185F22E96DCB, 0x452A4A1C49989152, 0xE1A3BC72832A3BF7, 0xBAC5CE1B645AD60F, 
-0xC39DE1505D070550, 0xB63DC04D97AAC3BE, 0xDA49C2C61C606471, 0x2AC615612622B417, 
-0xF55E002C659C8D63, 0x5672B762746E461B, 0xA2E2CD64A17C07A1, 0x3DC88260E47, 
-0x7EDB6B67B2509B7A, 0xAF2A26BC4C0C080A, 0x1C877FA9EC9998B8, 0xE8AEECA1F3CC9DC3, 
-0x257B7E39C46DE8E9, 0xB2C80332C88D7399, 0xEABCF8ABE4ED7BB4, 0x2BBDE4762E1521D0, 
-0x5CA8AB6892C59929, 0x4E402903E01E32FF, 0xFAEEBDB3C3B2869A, 0x35121E06C42D, 
-0x517002BBFCA0FEA8, 0xCC76D61F017A7F14, 0xE92CE01C3E4BB76, 0xDDCDB8BF482E2BF4, 
-0x8BD52EF09EA5569C, 0x1E8A6204037C908E, 0x1D1FE540AD604A5A, 0x8EDFF8445C93703E, 
-0xAE92CDB95644D45B, 0x4BF5DDA0DAE005D4, 0x6B2C9BAD1E751336, 0x2F56C8FE4402, 
-0xE773325DFE509B21, 0xB48A33DAE87FB077, 0x5A553D6A4A281906, 0x81CC050978EDC6FB, 
-0xDBD5A0980BF78FDB, 0x84EA1A5AB0F1A0E2, 0xF5368FEBEA01C44, 0xCDB2069A235A945A, 
-0x2F2DB9BCFFE10510, 0xC5D8CC10392C6740, 0xF8FF3DC3F00BC880, 0x41853FC17FD5, 
-0x9673FCD2DAE28410, 0x1B3AE266B3FD773D, 0xC7A7B5209109B01A, 0x453B3E5AE8F7536B, 
-0xF2C9A5898A65ACFD, 0x5712C93A7E536F18, 0x7A448402D480033E, 0xF89F0628E11501E2, 
-0x61B53958D6E1094F, 0xAA59107733FF6F5A, 0x792BE1B2F6836C94, 0x37657030AA50, 
-0xE9FB96DAAB396664, 0xF3D4885D57B03419, 0x3B223B74851C6CD9, 0x9AFD2F2270F9EE87, 
-0xD4DD40D7582B1A07, 0xA2FB02DE5731A682, 0xF97617DF1A97361A, 0xEC317C8BB70440F3, 
-0x7314EFC56C5319A8, 0xCBB05F406481A214, 0x65ABA228BB93D06C, 0x2BA770FDED25, 
-0x162A80E4EB92576E, 0x3E93A5D0633722B5, 0xD6C566EA78D6ED08, 0xEC45386F617B2D77, 
-0xEDCE5920A4B7FC97, 0x32BEF58C93ACEDF6, 0x23F4CE2568E095C0, 0xED71070B661C6C88, 
-0xBCBBE3093AB13429, 0x2DCEF7D64388137A, 0xDD9C920F6A0D56C2, 0x513C82E7276F, 
-0x6DFEFF7ABACF15B2, 0x4629C12B24B76993, 0xE750DD25BCD5AD3E, 0xA67730D0FC323157, 
-0xFE1E8FFAB9E2BCA4, 0x79CDD8DB56FD51C3, 0xAA5AB8DF134E212D, 0xFACDFB0B21723D78, 
-0xF2746B6680D7217E, 0x885B36D34FD43637, 0x5EE1365CD3BC4104, 0xF9DAC75A13D, 
-0x3F6BBF5FF7186BFF, 0xA4762C9921DFDD76, 0x20314BDC83BFF6FC, 0x9EE1E24EE034C5DB, 
-0xD423393DE12C913F, 0x271DCCDA30E4CFF9, 0xA457C92B0BD3E66A, 0x92828E21AF233C80, 
-0xD918EDC8A5A821DE, 0x7355E4D93C0A2D73, 0x4D38FF54AC08D0F8, 0x2657A3E4C1E7, 
-0xFC48381D0A28B303, 0x1DF67129F51E9F7F, 0x516051F109503C1C, 0x233D8D0D6FB36B66, 
-0xDF9A59EF5E3A13D5, 0x1B5027E67729E499, 0xE9419B9D2B039978, 0xE2836FF8F4FC7E13, 
-0xE78CE87118D14F54, 0xD611A3B35DB27720, 0x45015281059A2427, 0x203C1BBB8D47, 
-0x577AA2914B1A459F, 0xED92FCBC92B9FD90, 0x2E5CA2A04C5670E1, 0x22BE179B9A9A8060, 
-0x139AD4CCE8770A86, 0xEB10BE9FBE16C007, 0x26EB554FEACC7B71, 0x15BCAD52DD35067, 
-0xB93D87803423F2C, 0x4949B6BEA6A336C1, 0x789B9397C6A6A300, 0x347153B33947, 
-0x83AAA3033191CDD8, 0xEA126447B845DD96, 0x453CB72F94E9465C, 0x2BF559FAF2D6ED13, 
-0x14FF5680AE2F4CB5, 0x8FE18A8F43CFE178, 0x5EAEC5F3B66EE3F1, 0xE75FCDAC2AC46B5F, 
-0x7E3A87FCCFC6A58E, 0xAC4B7FA88271B97F, 0x7D250751DA723A5B, 0x656BB503355, 
-0x4448B2CBCB33EC57, 0xE205FD125CB83754, 0x4A7E8056149A9D45, 0x3F327F4E6A063D5A, 
-0xE12516BCEC103F7A, 0xA9BB0E68E15B4EAE, 0x95EC76432103A155, 0x52BDADC99139628B, 
-0x3F283BC214ABFACD, 0x72CEE720AAD68D8C, 0xA9B23E5B899F341F, 0x6A5DA4537B0D, 
-0xDDC3564C89AA8641, 0x4604AC3797650DC3, 0x5AA0D8D63420AEAE, 0xDAB690303374E185, 
-0xA8855819E0A252F8, 0xFA3E872758231319, 0x6905F7425E159A41, 0xB339C561AAE807AF, 
-0x97239B39EC481851, 0x52894F129C6C7D16, 0x51D8662E326E94D1, 0x2CC88EC459C2, 
-0x66AE1A9E85E22738, 0xA62C91D5016288C5, 0xA4C11D5E24A0BB75, 0x2AA797858EADC14A, 
-0xAE454DC189DBDA73, 0x87A55B47BCCA2380, 0x53C56B4794934E47, 0xD7A0285B1D1F35F3, 
-0x4EF1B42ACF7EFB42, 0x12C74C1BB074D52E, 0x63ABBAE80D22D3C5, 0x137E435873D0, 
-0x88BD2F921821EC35, 0x4208049555322195, 0xF4BFF7CCA3827D83, 0x2EBC8AEDDB64CC96, 
-0x6AE1FCCC1D279C51, 0xD24E60D8EF018840, 0x4D81A3E0818B9A06, 0xDDD6352DC25BAE25, 
-0x8A5669B4CA5C93D7, 0x1B018BAFD1F76465, 0xE70100717D4B9CB9, 0x1683B1628B93, 
-0x4A6CD0F95C5A2EC1, 0xCCB958CCE4534521, 0x12B592ACE9D18F8C, 0x914351F0E4C398C, 
-0xD7314994F11F0662, 0x697DA0C963061FE1, 0x6AE9CFB2D7817DD2, 0xF3B0BE4358947EEC, 
-0xDAA43ADFD88CD6AA, 0x5EB935D30776487A, 0x922C210D86168BDB, 0x59A020B96923, 
-0x8FCC38119B73F420, 0xFF40AEB0DD53FE80, 0xA89A3BAE31A73349, 0xC8FE6B5E9C8BFD4C, 
-0x2A71F69DAE30AF8C, 0xB9306D33958FE3D0, 0x39628C0CBB1E2E10, 0x115F6B8507AF9A5C, 
-0x20BCE837D898869A, 0x96433DCBE3CC10D0, 0x6ECDD0E2A209EAA9, 0x1F40F1165702, 
-0x4594341EA494B64E, 0x8F49BAC44DC55CFF, 0x2A71C4BC6E66218D, 0xA17E3E7D54A3754B, 
-0x22B6AC56B91C8388, 0xB5155BF016EF724, 0xA69AA7EB3F8A49CF, 0x875072B663E26F0F, 
-0x3FB4FEFF8D39B7B, 0x259E996A7F7A1622, 0x9FAD5A2B6E714F5A, 0x565A62C5757C, 
-0x54A82015AA19AA1F, 0xB75659B6186F52AD, 0xFE2FFDB04F4731E5, 0xF8D5CAD70185B227, 
-0xB675675203AF866E, 0x82C17F5BA573B283, 0x51D2645B84FE2748, 0xB8CEAE7184F247DC, 
-0xFFF81BCA237647B1, 0x66575C09A76F13F2, 0xC91DA0F4145809D, 0x2B9334B34077, 
-0x13262511E0B9ACFD, 0xF56A04FF0E7E503B, 0x396D99A112DE1DE3, 0x9FDF1EA8C4545BC7, 
-0x27BB17DD890D2704, 0x9DEE42BFB5CBE6F3, 0x21ED0E1A4A5C7427, 0x97F07B47704E9CF8, 
-0xDCCD9A157FCC51A7, 0xC5347ED33228DCD3, 0x9918CD862B0AEF96, 0x4CCD8A12957, 
-0x9B51255DCE63FCBF, 0x58E524F031B679A9, 0xE1F6C40C171EB5D2, 0x93010774B7C04F5, 
-0xACC058442BBDFCC1, 0x1587491DE225A2BF, 0x4BA0F00458822A2C, 0x4A0E39194456D6D2, 
-0x9E8933A6F7202ADA, 0x2F89CE29C0FA4BED, 0x6A0B0B9E921B989B, 0x234C6458067E, 
-0x6C83323799E3C979, 0x710F1CD7469931D1, 0xC77690B65E6B8DE8, 0xE20ECDE76D01EB80, 
-0xCDA8BA7F3ECDD1CD, 0x92155A11B138D670, 0x147E48D936C55E7E, 0x96C785C4F6FA2BD5, 
-0x407A5D6557976A30, 0xE82CC70F810200A0, 0x944CE0A254B340A3, 0x38B3F02EBF4, 
-0xED8213DB43A3764C, 0x6A42A6601FD9B02C, 0x2D8DCCA9283010F8, 0x56EFC9AF137D1AB0, 
-0x54DA3B1AE8FCB2B1, 0x4197ED4A35A99082, 0xF42BC5AC8CD27B02, 0x2339716350D241E8, 
-0xFBCEDE7F57074E41, 0x2662D505C55616D9, 0x22AF8E07849B0F60, 0x2A13C46A3000, 
-0x52AB8FAD2F8F5EC1, 0x89F75C715BB30F68, 0xF6042E548C12B896, 0x29428281BA2E13EE, 
-0x5EBDB1A7012BC7D6, 0x2B619133F59A18A, 0xB70F8580E50C40E2, 0xD23F4C1F8BDD0BC1, 
-0xC999C4D17D06DA78, 0x32BF2C074366E95, 0x842916594D2D263E, 0x6B2C874770E1, 
-0xDCD7C56D0E7910C0, 0x5F8C36F1155501C6, 0x2F064EEDA9C801C6, 0xA1C0EA11FF0ACC87, 
-0xCAA99B29A4C2859B, 0x317D0D7049A16164, 0x627FB2CB8A097698, 0xE4A2B1D32264EE1B, 
-0xF4482ECBAEBC0768, 0xDC385B1B7CA7872A, 0x2436CDDBCCA1CB4, 0x575187F545DF, 
-0x3FFC77C89733687B, 0xB4EC910FD2772572, 0xC3D0C7D444DFC72D, 0xFB441259FB1EFE7B, 
-0xADEFBE1E402924C8, 0xEACEBE67E96173AC, 0x4B038C3DD4F3C7B9, 0xD4FB2D11774F4FE9, 
-0x76A336AF9A8A1608, 0x78BE3F6FFDD0E07E, 0x4C54EFB61B5CE267, 0x2FDC8665BC10, 
-0xF733D2F98A6AD1F3, 0x6E9EFC96D77B6CED, 0x6640100C3842841A, 0x725F924FF510541E, 
-0xA3DE6C3DDC997923, 0x2072F2E0685BB7, 0xEB9FAFA803C24A6B, 0x4EF4138C0C5DF501, 
-0x18D7B6C28C9FF436, 0x2BC3A1A750629120, 0x87875097D01B521E, 0x571FB0E04D93, 
-0xBD031E562365282C, 0x5A3E2A7D0740C7CD, 0x73EBA38C08C00163, 0xA72307A6CEF357AC, 
-0x4664D33B8475A5D6, 0xC991BAC7E8512AD6, 0x9BF0D5ED34548D64, 0xE4FF04D855597718, 
-0xA8E7AD839424B5FD, 0xB787BF08B0E61695, 0x77279A29292618CD, 0x6486F397457B, 
-0x19078C61C5E936B3, 0x518C2E047F1A6BD, 0x970103AAC010EE98, 0xFD6717B873D87492, 
-0xF2BAE4B756CB86AF, 0x30B51D4DED4B0CBB, 0x6B7FD7145027828C, 0x85F1496F7C4CB33C, 
-0x54E613150AE4F799, 0x902CD15E46C43B2F, 0x99D4854B4C0428AF, 0x656C4F479C1A, 
-0x14C9781127602448, 0x6DBA83C7F4AB5AAE, 0x52690A47E94D9BCA, 0x7441445380C1ED72, 
-0xF165E531006164A3, 0x8737009F45180A20, 0x1543980A85FBB4C8, 0xB652037AE6760438, 
-0xF1B59BDA875DBCDE, 0xEA0D99DD50BF173F, 0xF7F438DB6E64811F, 0x5BDC2CEAA7C2, 
-0x69B13F7B4CBED691, 0x8697D6B61F7B6CE5, 0x1EA240F09F112963, 0xDF1281853D1236FE, 
-0x180647865B984B2A, 0xDCC26F660B96823, 0xF2141A911FCA052, 0x7EF607CD846AC2C2, 
-0xC251791A5F020848, 0xC1BCDD8614FD13F2, 0xE0807B6C396C5A0F, 0x635157CE6298, 
-0xF352EE3B7D03A7D9, 0x17D507B0DCCF9635, 0xA3FAB2B3DDA5C46F, 0x79344532D290DAC8, 
-0xCA70A4B3E75BACD, 0xE86A62018AF01A71, 0x19ED751B00E588B5, 0x43D6CCB2E3982885, 
-0x9D1D300223EC50FC, 0x22F9EA8450D7C110, 0x13E544C8D17667B, 0x64A6043470F6, 
-0x7E5E9EB93507AAE1, 0xA2C1E0F17A66A1A6, 0x8FEC61ECE7CB34CD, 0xE7B5F2BCB01B6BA7, 
-0xD62965565D61CED5, 0x85627F8E26E59216, 0x8AE802DC511F4252, 0xFA493E17C3F27067, 
-0xE4B9104443E3BDF2, 0xA286BEE570469069, 0xEDA5A6478F0F714D, 0x14D680BD6A77, 
-0xFFF5AEC30BC3E317, 0xC48D2E38E8CDBA9E, 0x58A651BC4BAE3C7, 0x9403F56A4756A906, 
-0x3EF020A5DB9238ED, 0xEB8EA46F7E18619B, 0x75ED82C4C1F88D18, 0x9A5252D66874495F, 
-0x35F6A941B534D2E6, 0x53A471E20FF8EAA5, 0x8545FA1117DB9D1D, 0x24D3F5463296, 
-0x583FA9908683184, 0x9230425E3D95DA95, 0x17C7BF94955EFD3A, 0xD9609A654060E765, 
-0xFD0D4DE08F1E30A1, 0x5092B50623929B33, 0x2D9532F95D4E21DF, 0x4A14E427D4032FD3, 
-0x9189BB2706066208, 0x5358148C39666FAF, 0xD3A25FA920C66993, 0x6DCFA163EA9B, 
-0x8F41CB6CC299FCA8, 0xEAD9FD377356477D, 0xDDEBC155BE1F35AF, 0x6ABCD1A49C1BA3B6, 
-0x2FD59C97C685F23F, 0x64C87AD54917CE1A, 0xB2A1F3382B9E165F, 0x242F7E8798AFA2D5, 
-0xB03DF51EDF9A43E1, 0x1986DE1EFE7B99AB, 0x97DE40C419EE7CE9, 0x3940800F54B3, 
-0x9DA26775A74A3A21, 0x675E97B60E5178BA, 0xB383373302F6D47C, 0x4CF79B17F55F6460, 
-0x6C11360E257D9221, 0x36FBDEB1139899A2, 0x7C2F844052EA694C, 0x5D6D4D4E4F27980C, 
-0xAED8489CCEC132F1, 0xB25C2BF8BA006517, 0x97CF16FDBF893447, 0x178716A6EB1C, 
-0x17342CB374974A8C, 0xB9B1820AE4C095EE, 0xBF50122A3760B268, 0x512AE4DAE55036ED, 
-0xE91C06D94E6F88B4, 0xC6DF07544B629E2D, 0xAC2E8CBFA21E4849, 0x27FE375B6FA1F280, 
-0xAAF6F74A0BDE6CBB, 0x3E1BE97585E5FB28, 0x81DD28175D951FB0, 0x67C3B1943E98, 
-0x9B0FCD44BBA58FF9, 0xA8EDCFD02655AEC7, 0xE4B387AF90D6C95F, 0xABDEE1EF169E61AE, 
-0xB457858FDC8FB220, 0x76EE6B1B8D3BADC8, 0xF0D5042DF1AB48E7, 0x38FDF7143B39FF1, 
-0x438A9C1894197262, 0xD4B1CD2A97F703A1, 0xCC01A628E72477BC, 0x53644A64CE7, 
-0x6D8774F1198DDE1D, 0x31D8BA515544583, 0x70DDCB6AB7CC2FE4, 0x6BB93C4EAF8F8F2F, 
-0x4DB7F95301ED309C, 0x2BD85D9D6E4B097A, 0x49AA28C1AE100042, 0xDC0BE27EA15F5257, 
-0xF6A959DE2FBD5801, 0xBCF248354A277CDD, 0xEBA490FDAD1CFA15, 0x207F4F51D06F, 
-0xEB70859C3CE12386, 0x1C9E856116E0BD7D, 0xC0CC45EE80EB9919, 0xF69EF65B00720DFF, 
-0x992F40E3BD95D8D2, 0x67A7B8BBE082EBBF, 0x467C945FC3CA18AA, 0x90C93D9CE2FF300E, 
-0x8B59CA2234A940E3, 0x51E1315574B9BA10, 0x65A684ED78661066, 0x2399FE7B6F73, 
-0x726BE78ABFAF9F71, 0xBC0BF22C02E50DB9, 0x85F593A84CB696DE, 0x9819A4DC85A71435, 
-0x37ACEEE3BDFC35FB, 0x49D1AC978348C13E, 0x37789F2EBFC1513C, 0x3033D2F87285D35A, 
-0x8F50115CAAA1E38A, 0x1F6751E0FE9C71E, 0x9AECF7A178C0D93E, 0x139683D78680, 
-0xBFC26F745CC61ECC, 0xA4C15DD36ABFEBB6, 0x2E8DAC79F28CED98, 0x6633C884CA2B99B8, 
-0x69E7A6FCCECB132B, 0xDC1EE00233C29A46, 0xBBCB9B54B21BD2DF, 0xF51108B46DD23CCC, 
-0x86E8C6758F2C030F, 0xD7DD4AA3109DA788, 0xB53653843536730E, 0x5F13C840E182, 
-0x7AD3B1332838187B, 0x7DF8D5513AB36765, 0xCC6D67A751CD33E7, 0x9CAF37EC0D5DB9E6, 
-0xED6E21165EB8FD23, 0xCB3CFD34C9797DE5, 0xDE6D6F1DE382E484, 0xA5225FD5B6862EE3, 
-0xAF0FD46E7E369541, 0xDCE3C83A366CEDD6, 0x5E6D7138DDFBBD1B, 0xA52C1DE7A14, 
-0xC550D96687FC8D2, 0x37057C906A085388, 0xCB6C4CAF7E062E31, 0xA221889AED82B8D4, 
-0xEE48883F0B7BC99A, 0xC5C98C88E8D90F11, 0xAB3BE0382AD55D3E, 0xD5199C7A361E2754, 
-0x508881C12F3426C, 0x56D2583E8C9307CC, 0xDF270C34CDA22DCC, 0x44C5435C1D84, 
-0x98C04B5B9859856E, 0xAA3AB625387A53F0, 0x4FD5420605D9C32D, 0xC7BBD0EB6DC38EB1, 
-0x8873A5957BA2D413, 0xF7E16BB00369F565, 0xFCA9BAAD31C9068D, 0xC188331FB9035A3A, 
-0xDE1DFF8E34B2F606, 0xE4B9046506B1F8DF, 0x209D6D1D7EB140A2, 0x2B13736615BC, 
-0x5FDA6119848C2CCC, 0xCB1B2DED3E73A05E, 0xA9BE44F5C024B6E9, 0x39957C5CFDDEB605, 
-0x9A4F14454EAF0C37, 0x736778B914790BCC, 0x625ECC58B7BE41C6, 0x7EDFF3C800D824A4, 
-0xB61A574E27C7672D, 0xEE77A24E1B9A311D, 0x461BF5FB08CE1CC, 0x3356F8A98D1D, 
-0x177CA692C4782FBA, 0x8516237040A2DE83, 0xD3EF1903E3A1407A, 0x7A69373E27DAA1E4, 
-0xCB0D83066642E422, 0x4A8C3BB9CB7606AD, 0xC9FEE0CC34BB71A9, 0xED7B70D526F7A121, 
-0xD0BF1EEA84DC09A8, 0x7CA06D622F964EED, 0x6005AF17AB883743, 0x1020F479E91D, 
-0x1AE157E250C57249, 0xB7D47ECEB2647C1A, 0x560AD735A48C9F28, 0x1B6CABF53512A3FA, 
-0x9635A1B6CE63B24A, 0x109C0C48D8DF8ABA, 0xA3D0463B096016F7, 0xE15F11D9C4649E69, 
-0x52C07218193FF37C, 0xC65256C684713246, 0x56996C455F19B93B, 0x2F5446DE547C, 
-0xC37A7B59F73E60C9, 0x8450B6661381943, 0x5C7E90C8647D10D8, 0x564CE184439F8A42, 
-0xD66730DB0784F8EB, 0x28D2AA56AFE574CE, 0x12A7E4A12940CF5D, 0xAE49CC1EE79A0DB2, 
-0x541D61D79AD7D2EA, 0xE8F70F34C4144B80, 0xA38E7924496E3C1E, 0x6D9DE8B53DC8, 
-0xD29672E9A45817F8, 0xFF7BE2C6874399B2, 0xF45C49DE65B24238, 0x5B983DE5DCE8F5A5, 
-0x17786D0ADF74FD18, 0x93745328AAA2AF70, 0x17880311E78E2721, 0x2DFAEA9ADE584B09, 
-0x5D6D1C00AB036B7E, 0xCD5175F0969CFFF4, 0x70CFC8A2D3121843, 0x1630D09F5880, 
-0x37EB68164A9809C4, 0x7C3703A46D8D5F5C, 0x910D071976EC1031, 0x4C3ED1491BFA2EF4, 
-0xBFA4FE9F669574E4, 0xF475AD5435340B0E, 0xD9D7AFCB8728C858, 0x4A97C934246AD5F1, 
-0x608973BBC0A7BA14, 0xEED0B29FEA5F4168, 0x610D05B1F1DF0194, 0x3E1F7630B960, 
-0x733A2C29D2FB7D54, 0x2F87284B9726A00A, 0x41A7D44ECE78CD1E, 0xD18110F8F5EBF286, 
-0xDB3E770719761B93, 0x9F1FDC0C8B6F0471, 0x4C4773FFB22A51CA, 0xE3B4DBB5CD3F090A, 
-0xE1D5B7AC74E9E51F, 0xE435FC0B67C7DEF6, 0x8823FFBE1CAAF276, 0x3986A10B419C, 
-0x6B3A9FC32F379F7C, 0x7FD89A0B2AA0DA58, 0xD27D02306BA89530, 0xD00760D5053F32AB, 
-0x5FE07D45C4F26561, 0x44F360803E6A2B18, 0x3FF74B91DB7027AB, 0x7A15E245BAB0C050, 
-0x5EBC80CE9C200E7E, 0xE644C677B592C5DC, 0xD85B5F86DA0CC2E8, 0x2BDB4B0A559C, 
-0xD561DF1F147D97C3, 0xF231D5A01660D850, 0x21714C05BA0EF738, 0x95A3352DFE89D33C, 
-0xDBBB8B7331FEE2B1, 0x3E3DF42903740993, 0x2FD5A2CA97731AD6, 0x887109A37F9035D1, 
-0x2533264E3E6C4B1C, 0xAA95CA4488C55498, 0xD441ABF05BC6B3AF, 0x32B078A2BA67, 
-0x184E14342B327405, 0xA695B4AA2420179F, 0x92641EC305C51A4D, 0xA05702DBB61750F, 
-0x2C7586D97C4ECEB1, 0xC5FFA2C3634D398F, 0xE5194A44FA57AE29, 0x977FFFF4E8A3E086, 
-0x86FFA08CBEB806CB, 0xDD4821CF3F086C76, 0xAED2A92218039F8D, 0x1546A3C559EA, 
-0xE0EA9189DFF510B5, 0x5C2A133E54DCDAF5, 0x545290AF5BDFEE52, 0x6DF1787CF4CA2156, 
-0x16BF65E13C769E3C, 0xDFF4C89517D131EA, 0xAFFFB6431A0AA6EA, 0x82E26E7426A5CB75, 
-0xDDEA4C3FF1650250, 0x147C91B584115C01, 0xF27320ADBC8FF48, 0x3D7D0F550A63, 
-0x6A249500B7AA7E45, 0x1ECC5951C043196, 0xCAE6B524C27D7519, 0x50FE480161156C67, 
-0x54D055C7BF222767, 0x343EFCBDAD7F4DD0, 0xE61AFFA31F560C67, 0x40B5E460A17D099E, 
-0x1CB97990516A4A82, 0x86D367ACFDFB4642, 0xA6233198019911D6, 0x1DFD44F8AE12, 
-0xA7BC8C68F08A5915, 0xD9309BC6977E2B56, 0x995D42263AAF4137, 0x5D680257CAA9AA00, 
-0x806ECE60DAD60CDD, 0x5625650ACEE753A6, 0x846EBC268498E398, 0x3559677ADE114837, 
-0xD8878191913A61FA, 0x6348CDB79D8F4344, 0xD2E43D1B854D3D9B, 0x57D4FF1EA915, 
-0xEF905CC6D44DEBF4, 0x250B5820FF16B29A, 0xEAA79F8B8A65AEC8, 0x37F76E8C09BF20EC, 
-0x22346ADD72DADE1D, 0x914438411D7BF892, 0x87F6F7396F12702E, 0x2A6A2FFA426C0FB2, 
-0xF687CA2F706DB37E, 0xE079CD5EF34521C3, 0x2CEECEB5FE396985, 0x4614088407FD, 
-0xEE2C06FD47BFD1D3, 0x64D2BEB67A90BA20, 0xBCFC76C86E4B77D1, 0x3899A6DC503A2CC, 
-0x770C325B26F4B9A8, 0xEBAA37CF96C38CA, 0x2C5F87DDD08DBCE7, 0xE7D981699641C8E6, 
-0x472CD9FAE5EDE147, 0xAACC847B1657B0B6, 0xFB388CD4505835E1, 0xEBDDBE49DD4, 
-0xFCC3D5823E86CDBA, 0xD18134A3ADAD3288, 0x429D897A2F08EFAD, 0x1ECC903A142A6241, 
-0x59C33F09D93C5A30, 0xD94D8658175936A1, 0x5187796316BCB731, 0x5FBA81B9745C0ED4, 
-0x163D2109A6564C33, 0xAEEB5764A764647C, 0xD8A4BE3082AB538C, 0x485D9241FEC3, 
-0x27F412412F0AEF4F, 0x6B4316A0EFD61A36, 0x6E9B583F79917775, 0xF18E7F8A3A6619CF, 
-0x754EE52164A5076F, 0xB05FCA1AFCCB62A2, 0x462F37D0B93B308E, 0x33A9743BC6B05641, 
-0x3CAA025E54F13661, 0x934D3B3D78BCD221, 0xEDF07ED001A19828, 0x1CA32891F33, 
-0xFDB242E2FC0793A4, 0x631FB2C99E62B6AA, 0xEEF65C9E3DA37D26, 0x2F60D813FCEBB03D, 
-0x2D8F5754321A0B6F, 0x6A2174C9BF13843D, 0xB5366E950CD1B8D8, 0xA95B4399F77A95BB, 
-0x55D47E593790F52D, 0xB576BCEE668D2F63, 0xCF193E66DB4F58CC, 0xC6C4851449E, 
-0xA9EC2F3CC22E1DEF, 0x6BE227406BA7968C, 0x33E0888B3FE82C2C, 0xBAC28F574F72C446, 
-0x6FDB8409EEC1B4AB, 0xFB7D2677D7523BE4, 0xC80633C3AEF48D1C, 0x724710C496EE9AC0, 
-0x61FEA3E168202870, 0xB98C77E2D77DA528, 0x1D7B9A114C1FA032, 0x1DDC69717848, 
-0xA034823746B415BD, 0xF8BB498DF6BE4EFB, 0x5BB8B7ED2F91C8EE, 0xE5D9950CCC7571BA, 
-0x1A13D2A1C6D1E025, 0xEE215B07E6729EBB, 0xFB537A30BE1812FB, 0x173D500F206ACDD0, 
-0x8F28DB887AA0274C, 0x83ED28267A813980, 0x66F0D4705EB9907, 0x4B73BB75F9CB, 
-0x4B7DCE69951B6755, 0x55DC0F98931EC72B, 0x947BCF60D2909B84, 0x7EC80A8ED67D439D, 
-0xD814156F4CC51049, 0x7DB7CF879571C7E8, 0x69F1DEBF91D21A01, 0x9E49003CF65DC08D, 
-0x4640CFD8489F44B5, 0xB1633F4E479FB3E3, 0xFF31FC571D3A4583, 0x571A140CEF19, 
-0x58E918BE3D9720, 0xC81972000D9D5838, 0x334CCC750C2AE3C6, 0xC249F7D3A386EBEC, 
-0x6910F4D6892C6CFF, 0xD52B447B6BF3B0A8, 0x8716F7A22B0D4DF0, 0xDF100CC3DF16DED0, 
-0xF77D7EB817A6EF01, 0x7F6A80F63CABFBDE, 0xC3BA1BCFA95AD893, 0x5959B7718293, 
-0xE5D73DED326DBC3D, 0xFA9160C737E99833, 0x232F1BF31F22EED3, 0x8592E458073948A4, 
-0x63625092D09626C5, 0x5BC02D2820517508, 0xED016AAB169D248, 0xA35716AE51AD19DA, 
-0x7BE8D50B3C936E11, 0x800E70E2848AAA74, 0x7C244A7E21FE6DFB, 0x6F9340839927, 
-0x9E70BA27EF248D56, 0xE261CECCEA2CC2C7, 0xDC6162EF0A6D33DF, 0x90B5A433029343F, 
-0x5C0B7334C9941D90, 0x7B6A4225FBC0F484, 0x51367EBF17322634, 0x72491047D7C634A9, 
-0x9FE90D752BAD9881, 0x1C8FA46EB0F26EDF, 0xB161CAADBFFE0E47, 0x681019F50C8, 
-0x56F845F56CB201D8, 0xB41B25CFD17CD67D, 0xCF9ED47858ECAB87, 0x9667C5E27FFA53C6, 
-0xB54D4F00549B9C55, 0x1173B042BDA6AF83, 0xC8808414C7046603, 0x2A743E23E5DD644, 
-0x92C847AA20309CFD, 0x11E2D2427EAAA2BF, 0x2779EA95E3EA8CAC, 0x641C32AC1D4F, 
-0xF9593D9C4F61624B, 0x8A1BD9C39C627BC8, 0xAD8304CF99C56D0D, 0x30D7FCD97DBA017A, 
-0xBED8EE8C4022DDEC, 0x47D38D7193A39C58, 0x839F27AFCCD60057, 0x7ECB2F9235748797, 
-0x95C725C89EDCD3A6, 0x34837D78A9D1996B, 0x7365C9A39CBF1F13, 0x1DAAEB425C90, 
-0x7CBCA21C95B87B9A, 0x2B4AFBA271A52A7A, 0x1E74077DED5EF958, 0xB0ECF25F4A59D55F, 
-0x18C9709285FEBB1, 0xD9CDB239B8A1C376, 0xA4534B2F83875A73, 0xB41997BD0B4E199E, 
-0x6F834319E6773EA3, 0xF1FA7EF8DF50FFF3, 0x9AA65E2CC3E46AFD, 0x1E7FA62F7D56, 
-0xBD9A3AEE7F431290, 0x4507BC93AF4104D8, 0x4B4075D9CA614C59, 0xD807DAA746EFFEFA, 
-0x8FC5403EA003D91F, 0xDBBAA3DB30877B2A, 0x7926831046F35D89, 0x8B10171E4A9F8AF5, 
-0x911FD04C8A8DE1EA, 0x1F66F3BCF7D4E971, 0xB5FABF1FE08402F5, 0x200CA20B708C, 
-0x36D8B83B8336433F, 0x2FBCCD40D5E9A845, 0x32456B8962D6858C, 0xAA37DACB346E5F38, 
-0x5EBC213C6CBF0A5F, 0xE5BD7B7488863982, 0x6C68D0FF36065F34, 0x8ED2D32B527ECF92, 
-0x98BD2513A5485747, 0x3B1A68B6CE879755, 0x322AF432472BDBE7, 0x3CCD6B66B12C, 
-0x2753B1D1F2F829A8, 0x19775D6935E470F8, 0x4736F472B24D1693, 0x6B9CBFAA9944B135, 
-0x29AE80211EAE7027, 0x72ED7B33436B8D4A, 0xE46B02DD3B3268F2, 0xB77E3E71DF567C5D, 
-0x251E9102A0562651, 0x8D00C0247E936B69, 0xC4C4A7FF444B4E9F, 0x49664A1473DC, 
-0x952DF2D6E192D4C9, 0xD159CCD95AD814A0, 0x3F4D6E38A8E92AED, 0x595F6FD5AA3367DD, 
-0xAD29CC70A4C8C095, 0x2EF2F94EDDA88F74, 0x579FB0DD1CE004C, 0x57B06271273EC846, 
-0xFDF3127C764FEC8, 0x5EE50071319FF979, 0x1161805748174C51, 0x289CB25A1A27, 
-0x6386E6290149C908, 0xCD9E30319EDAD9, 0x477064B5E1880923, 0x970D82AD9D017165, 
-0x143D667B2896FE9D, 0xB632FD9E829EEB0D, 0xDC4AECC03DFAD3CD, 0x37533CD319EAEE0E, 
-0x5AB873ECFA8D8882, 0x613FE35746B9681E, 0x3E0DAD0B6FADCE9B, 0x223A04EE55CF, 
-0xAAB5F821F7FFEAB, 0x8C74FC4113C29F2F, 0x2AEEA3EABA777CA5, 0x9DEC36CA01F7F221, 
-0x117DD0B06871CAB7, 0x3A38F849D8589B0B, 0xC5BE8F4795587600, 0x22858065CAE5969F, 
-0x634BDC4FDAEC2535, 0xD5E3D9E5FE5CCE3B, 0x833EAAA9E37ABAE3, 0x672DD67856B4, 
-0x4CA52C77E4375AA3, 0x5D07D10AE7641824, 0xEC3A1FE26FEC4FEA, 0x9C7FE6C376391594, 
-0xCE0A5BC32A167AFE, 0x9E64EA3914BB8779, 0x3AC4C0486297BD3C, 0xF21D992A9D61D60C, 
-0xB8694E0D5BB1A73D, 0xF34AA8E4B169AB75, 0xF971F21281E12E84, 0x320740ED6F2E, 
-0x4908048FC68DF7DA, 0x448FD8B8F87AEE41, 0x4CA685DDF00F3598, 0xD458CF1177EFA0C6, 
-0xE92E5A0BF7B2B4C1, 0x98D43BA0F1FA078C, 0xA87546B2D1870C77, 0x45C3FC99B083E500, 
-0x6CA4A4F554681E10, 0xDB4F3A85F826C3B3, 0x264BD740391AD6EF, 0x1984A934CFF6, 
-0xC98190A528F7362F, 0xACA447D7FBAC2ED3, 0x8AF0D3DC6A563BF8, 0xA768D40F197CA93B, 
-0x6C067FB248633A74, 0x918E68867EA23344, 0xE45CD10C67A7B9FF, 0x220EFF8BF8A7B22E, 
-0x45A28F0D839AC016, 0x9CED5D157809CBD4, 0xE671DBD2A39CB803, 0x5ADE3E00CD23, 
-0x5C7BCA15DB557B1A, 0x441E3C8ABEB5AF2F, 0x962F4A593EB9A334, 0x637E62EF819EE905, 
-0xC208B023587085E4, 0xD48990CCA21B4F59, 0xE323E638BD7F9F66, 0x49FBA3A4FD4F6275, 
-0x76BCEEB7ADC00803, 0xBA5C1490CCA7D1F7, 0x240F4E803F8101F6, 0x6597D8B3FFE5, 
-0x32C7396C993F38F8, 0x1BDE0A9297C57981, 0x9CAC400F443209D2, 0xEA0EA08B5534005C, 
-0xF6D13AA65AAC2429, 0x44A1D29826ADB6FC, 0x36547038D109B221, 0xC857CF2B8170866F, 
-0x678DF2E4D01ED831, 0x3DDC4988A7D864AB, 0x2175A7F2D16B03B5, 0x6CD9A19EED06, 
-0xC8CF795C611592B, 0xBA50B395D435DC22, 0x220C733B7303D6E4, 0x276EDB1E5FE79A8D, 
-0x445CDBFF8AB1B3F8, 0x6503240272537950, 0xCE2E028A58EA46BE, 0xD297220D278998C0, 
-0x47CF32CF98E95FC4, 0x3A5FAC73809BEDBA, 0xE04207288E6E3CF5, 0xCAA532A17DA, 
-0xFFA910BF9E642BA1, 0x52A81FF02731A6EF, 0x54EB343523E9E0CD, 0xEB48E623F3D9AC15, 
-0xF835545ACA882911, 0xDCC3F57C3F66CCF0, 0x82780CF81B4E2BA, 0x9C6A44533AA82D11, 
-0xCA6E92923D09CFA0, 0xD0765AEF95568141, 0x7D6086C40F680EBB, 0x2FABB40B5655, 
-0xC96C3080E1F5496B, 0x9B6D7D15500B42A7, 0x2D153D92C692398C, 0x2545EA0FADE95D4F, 
-0x55519BAB40A212BF, 0x9290507BF10CFB53, 0x4F51A1451D78FDDF, 0x2D386316FE311E69, 
-0x869A434352160A49, 0x33971813CBEEF697, 0xD2960093D2E661D9, 0x3177B2E9141D, 
-0xDA1B375273BD1077, 0xCE297B5C52BEC64A, 0xB2DC8A51EFCAAF41, 0xEC6903F53C5C6E60, 
-0x5F351914BF35DA4A, 0xBBA7E01BDE0B803C, 0x3F5D285D8F710736, 0x55E3C9E414110E8B, 
-0x749232906A8430F0, 0x4B15E0107BD08390, 0x64A1BF772A5C077F, 0x3F8B9F9B816A, 
-0x4A60A5EA5BC929CB, 0x664A7002B5F0C3BE, 0xB4DEB90AD320F9E2, 0x436F7B930F46AEDC, 
-0x5B43F8909F838B86, 0xBBB9228A4DDEE492, 0x31D25BF1CDB249E5, 0xFB362AB9F725DE48, 
-0xD65C2E15F071CAA5, 0x68E842594BCFF5DF, 0x10FABF94956D8A65, 0x4DB75AF5FF6E, 
-0x90F81FB0B32E3207, 0xFF4EABF397669F0, 0x65F5873008A12EED, 0xFD5830D3D406830C, 
-0xAF30E24A785A4147, 0x55BB386E37FCE523, 0x5F5A5B6A2442D38F, 0x14BAD3FDB67FFA90, 
-0xEA57DE8F12EE8DF7, 0x6705347032F4A825, 0x3912220BD6D9F97E, 0x55B3F5CC3123, 
-0x60BC5CF1CD180F38, 0x72053441296CD08D, 0x24302FCBFAFF8FA5, 0xEE59362D47587EF8, 
-0x5912F32870753E76, 0xF08310EEFC868609, 0xDC2BD4BA433D7DD9, 0x24D032D0C571456A, 
-0xB42F1F0DBC0C5B1D, 0xC8CFFE4C6FE5202E, 0x5D4643696575A1DF, 0x389B0F74513C, 
-0x6CA3CE0BC2341819, 0x59EAE5A26BFE53AC, 0xD497F70601C0E927, 0xBBC39ACC288A29EE, 
-0x7BD0251E16201DB6, 0xE5A46FA12F55BCBA, 0x68E9641D58D85D49, 0x492345C597C65DDD, 
-0xA131A94AE3D7A054, 0x1FCF2EDCE8B6F4A9, 0x5C18AF77B8FDEB3A, 0xF9B22A7E909, 
-0x8CA8E948F2A7F471, 0xBA49CA162412578A, 0x390B88D8BCD006F3, 0xF2CFA8F82B6F4011, 
-0xCD3336AE5BE36B40, 0x50863328FB47601F, 0x63AD619C878ABC3D, 0x2786D1E8871DF8E0, 
-0xE9C1FF7D01FDB1B0, 0x726B47227E2BE4EE, 0xE9C4763F16D4E5, 0x29B12A73D3AD, 
-0x9898C8AFC8126DF4, 0x3C56444A67D24544, 0x483E85392F2799B8, 0x6A18DD6FD7BBF2C6, 
-0xBE74930E1241FEDE, 0xD1028EAACAD1405B, 0xF59CA8BAC740D582, 0x1CB9658BBE3AE92A, 
-0x881CDA4D1F6A558B, 0x8D4F85CA5B9A857, 0x426536A8F29E2D8E, 0x436891C0E405, 
-0xA7E06DAD08D30D31, 0x8EB779E5627B1A05, 0xD6EC74E0ADA32D7C, 0xAA14BFCEEEA278F, 
-0xA30BC39F2D3E728E, 0x843F5BFB9A9F2F3B, 0xC9E3BD2CA14D5CE6, 0x499710D38D0F10C4, 
-0x6F7BEAFBBDD1A50A, 0x2A3EDFFD35C421E5, 0x1F66D74B8681ED91, 0x8FEA7296BF, 
-0x99DC5E4681F7957F, 0xF212592AB3FEE67, 0x1F0D7B632E40064D, 0xBD218146878BFE78, 
-0xFA1D700D8319BEFD, 0x38EC18C3D013EB78, 0x4378081203B1C328, 0xA59AB085F11FCE88, 
-0x71459A11AABC41DF, 0xB1689CE177997AD, 0xB483A01628BA3D49, 0x1DA9B0BFE62A, 
-0xAAA62EC3130A0103, 0x6D81A3132767FD2A, 0xBB39B1ABCD1B4CB, 0x830235876B3E422D, 
-0x822669158C593E48, 0x31F76415CAF47E4A, 0x655F147341943F41, 0xBD1E5316CB51A68C, 
-0x7EB08829AEBDC8EE, 0xE9C000109813E5FA, 0xDBFD9C9BBD705F4E, 0x1CDD4D1163B9, 
-0x8C27C479749C1102, 0xC4F7A51ED2828854, 0x93D925BFDAB796AA, 0x2030D09DDC5E9D84, 
-0x12F3BE8BB827BD77, 0xCAE9190A178AD20F, 0xC7277CA64E11E56A, 0xEA88ED67E06A662D, 
-0x433EE757947045B1, 0xC4A9B4A48884F6B, 0x4AA285046E3091A4, 0x578FFF560473, 
-0x18FA03E8B5A40A65, 0x1EF3DBE341FE2B11, 0x1F0A3A1C92CF457F, 0xD3291511823FAA3F, 
-0x969367C262AA8197, 0x380F1A316AD45506, 0x121C03E713C4B2E0, 0xE7B92DABD4A594FC, 
-0x5C67F8BAE9E3FD89, 0x47C8CC5662D51753, 0x7267A7C1225B55D2, 0x516544D43D83, 
-0x38C426B7CB1BD840, 0xBC503AFFA1FA8774, 0x9C3670B097F53137, 0x866F528771EB0C65, 
-0xA352AC05B8D25F08, 0x3A7D787556814E16, 0x4ADD3494B55F795F, 0x44C32C5EC1ECD2C1, 
-0x218F8B48D759DE02, 0xA3F6D6B6140EAF5C, 0x671BEA6A67F238E2, 0x4EECB46B8A82, 
-0x2FE02F65F962E662, 0x79B9EB2F0056F206, 0xFDF21502CED8E937, 0x22188CC2EB6A767F, 
-0x901485187AFC22DE, 0x42AACB7230A8EF68, 0xAED205D762555DFB, 0x820C464E313A5FEA, 
-0xBF92D7D1F198C9EB, 0x3000D40104B004EA, 0x35DCE9E6D88FB7C3, 0x230F7B999AD1, 
-0x31C158A379C0C553, 0xA9B02875EDA964D8, 0x2A0E8463BF0CB7F0, 0x6B388571E8C930AB, 
-0x3AC97BAC426FB0B7, 0x76B692137D5D77B3, 0xC7524020B277740E, 0x9C426025424CD6FD, 
-0x8FBD9CDE2643BEFA, 0xC73EB2240C1C3521, 0xFC0BC51AE8DE6801, 0x389B3264C706, 
-0xF0B0FEBA5F4CF45C, 0x16A7DAFCF49C5042, 0x8669392FD2884E5D, 0xBB126EA9BDA02898, 
-0x8682D78BCC2C4346, 0xF8BE74692DA0CD00, 0xCD0BC9E3CF3EBFD4, 0x88180525A3EDC229, 
-0xC660D863C29578D8, 0x6640049CA76B2BDD, 0xED8E7C79FA60D96E, 0xD69E5221078, 
-0x8C4D356DA5BBA434, 0x9D11BFA6E3685B0F, 0x240EDEA26B0DABEB, 0x88B34CDF89637CF1, 
-0xB6AD44C833D80C7D, 0x2A7894034621E73, 0xB344992CEE262158, 0x12E0ECC85F4E685E, 
-0x849CD3F81186CE02, 0x79BF15432438B62E, 0x1CF3AB41587E1E4A, 0x5982603622BC, 
-0xD504ADFDA8F62A5D, 0x52DF8725AA896310, 0xE7DF461DB377814E, 0xC568E7A91B763CCC, 
-0x952D88FC8DD983A2, 0x5ABAC6EFBA641317, 0x9DE7EE95503DBC9E, 0x3AAA73DD9B13132D, 
-0xD6B251DCA85E6A44, 0x8F49ED4F301E3173, 0xD4FB050CC0797384, 0x21E8342AB632, 
-0xCFE696A21A54D142, 0x4208C52A4A8DE0DE, 0x72BE35BB831C5BE4, 0xCD99347C8D4855EC, 
-0xE879095A5235FA2, 0xC01796F9088D3751, 0x282C4CE990890277, 0xE6233E3D9E3EDE88, 
-0xADA01B1751F30659, 0x92663FC1A1B0ABA9, 0xB6D35794DC7E267C, 0x43A4960B7B69, 
-0x2A8DBC0B0DB135B1, 0xCEEC34085324BD5E, 0x3F274639D4743FBF, 0x9C81E852C47856, 
-0xF9BB8DEE73C7E21F, 0x7959AE8CFBA3B092, 0x38C091C3475887D4, 0x463439B2BCDE0A69, 
-0x59C0664780E636E6, 0x48B35C3B1E16FE83, 0x47FBF7EF2F883175, 0x13D4278DE94A, 
-0x9D8C442FC5483808, 0x4DFA4294F39A1D21, 0x63264085E90917B5, 0x66DC856AFEA429BE, 
-0x2F3C50D68A19FF1C, 0xF6D8C91E241F7A08, 0xAEC152E1EC83CEC, 0x25D725D706682DEE, 
-0x7CED9597C8014777, 0xB9D5FED872C017AC, 0x1DD6DF33728046AA, 0x2A9494395DA3, 
-0xA4A3F7BF4687B30D, 0x136DD3E95423EE8D, 0xC9B9FB4567C0EE1E, 0x7EE80445A01493B2, 
-0x1865A7E0D5F8859, 0xB6787EBFD039BBEF, 0x11E7847F14694AF4, 0x520FC51F7DABB1CF, 
-0xDEC7DDEBFF667A6A, 0xE15F6B9229CFA986, 0xB8DDC3FC0549E6F3, 0x119C6BB8AA52, 
-0xD97E2AE820B24F74, 0xCE4893EED3A2A960, 0x8BC1F86C1F514501, 0xF9C55280235B8A73, 
-0x8EA9B2831F67CCC7, 0x7696EDAFAC0B9BEF, 0xD7FA72E069D6E39A, 0xAB40FA0ED4288531, 
-0xD53C30460DDF9E8C, 0xE20B4F5E5EB43D28, 0x61267E3B916E3D1C, 0x4FB9DBB072A0, 
-0xBA98274BDD98F045, 0x57C0830F4B4A4770, 0x1CDE403011F0F514, 0xC57522E24690905E, 
-0xAB26DF767D114BD, 0x9E8C8F20058A369, 0x4117131CABE64C7F, 0x8E04C71E16E43308, 
-0x4C43D9737488913A, 0xB93C43A8F99C248F, 0xCAB9BA29823DF990, 0x22DE74FF6324, 
-0x9CDB1D4E374E3D23, 0x76990B305DAA49E6, 0xD58FE32042048768, 0x68BF0657C6A46CF6, 
-0x9F5D162A5D9E9D70, 0xBF39DDC528B94BF7, 0xBB086A0C3F91F247, 0xFBA07D1D20EFB1DD, 
-0x8E9CD8B6DEB776B6, 0x9A560FE510AB8173, 0xE22F94E9F7F21D9D, 0x59E87FF50D0A, 
-0x312A98A25B604D2C, 0xED1A36B0DD8D087B, 0xC9E7D579E8983E76, 0x4F38756BF2F38D0B, 
-0xF5720F0C4A5A98D8, 0xC1098C2C53FD208, 0x7E005F90E20A8786, 0x92E27396DECD2BE4, 
-0x4B63E2E21247055B, 0x81CF5952D9C5DD62, 0x703DADF7E3A69957, 0x80AD4F07A15, 
-0x63F119CD0BDC1AA3, 0xF51C11D9D575B8C, 0x221231A913ED3A93, 0xF905F4944FD43591, 
-0x9EEEC39DAF098A1B, 0xAD155D1AF5A29B59, 0x3AC04E31237D3F89, 0x4E05B9CAA28C6A47, 
-0xF3975D26E26B7040, 0x5D7CDE764DBB862, 0x1F037321A2E2CA23, 0x16F21082FD7F, 
-0x8568CE2BD20AE9F6, 0xA03F1CC7B729205B, 0xE63E5FDB886F9B23, 0x1EB9DEDA15E4A6FF, 
-0x321CBEA1D5ECAB35, 0x96147EF973AA366, 0x89E0A5AF3BB936C1, 0x12A49BE296FBCE8F, 
-0x80776BF3E4973C66, 0xDCB11C478738DC43, 0xAB00B8BACB1CCE2A, 0x1EE37807EA48, 
-0x15F3FD0DC1601DCD, 0x90D9DB6B6A924706, 0xB36E628A3877C453, 0x63FD18CFC0570BF7, 
-0x4BDDC0BDBE44C0ED, 0xB2EEA5D4B8D1A5EE, 0x1E1EC8A5F1988D8F, 0xE60EC877B78E6A8D, 
-0x50C83EC7B5CDC621, 0x74C80C05F3CBC37B, 0xCD9B42F58174246F, 0x569BCACD5E64, 
-0x5360A2EE800FFC42, 0x4D3CB9443A05CC96, 0xF800AD939061DB62, 0xCC90B4B1C71AF5DB, 
-0x9889688E34C7D419, 0x20DA0B58A31FDCAF, 0x231841A32E092101, 0x97E71311E4E18183, 
-0x531B397E8629000B, 0x20C393BC552D7057, 0xD73D175A72F0FD2D, 0x58981AC52289, 
-0xBE54F6D4A61133E8, 0xE2F2F7785CC85A94, 0xD8DF0F2F87ED6B84, 0x39937799E2843957, 
-0xA25672697890089D, 0xF5502B7A5A639A45, 0x6FE84892FA3953F, 0x6D423C2A3B615D20, 
-0xC93D19546BEC7CEE, 0xE5C1DCE285CA952B, 0x246D156C4853F87A, 0xD43DB4A151B, 
-0x5AA7FDA742A89DE3, 0xA303F92FC5ED1C95, 0x90A25214D9B52D95, 0x54A8B0A3584EA112, 
-0x78212855B3B2DB5A, 0x77517CB8618E39DA, 0x8DA93D0A919F7056, 0xD16A04C90C2F39E3, 
-0xEF6DDAB58260E824, 0x42A15223B1399E5C, 0x737FA46AEB27EDE3, 0x1E0462BB866, 
-0xBDF77CBDB99B07DC, 0xE2CDC9A28740E0E6, 0x66F624CA56844B65, 0x4C86908D5FBE0950, 
-0x444C56898BE0232, 0xC64A314F7F135104, 0xD117D19DD757669F, 0x298CAC777212B5C7, 
-0xACD3EA212142FEB7, 0x793F2D4C04695475, 0xB78C71542ECBA1A3, 0x4F6A030E59CF, 
-0xFA472831A51E55BE, 0x7188E5EFC43DCA5C, 0x447699091301290D, 0xC8EE6D148E74CE97, 
-0x51F9CFE0A4BDE0BB, 0x1B459062B32B9D49, 0x318BF760B80FA334, 0xB04DF3D27E0803F2, 
-0x85FDC1B3AA94080C, 0x30240471A21C5286, 0x90BAF0E1C2F42220, 0xADF26F26930, 
-0xB554CDF022C28D5D, 0xEC8262417A3EB0F9, 0x932993D93C7F70CE, 0x37D27F0873003401, 
-0x922C2296163AB94D, 0xE7020801CA18B093, 0xD54632B8BDFEFB12, 0x9230466E3DF6FD6E, 
-0x235A6C5193BD8D37, 0x193AD8BE9186AE3A, 0x13C37364D98CB50F, 0x357F74303036, 
-0x215EE5ECD6B4AAB, 0xD50B6CA940601848, 0xF15D040200FDFE2D, 0x325A9EB003C20CC0, 
-0x1FB5B74997F3CED4, 0x3D0B04ABA89ED4C3, 0x2014B4476D15DD82, 0x4E66BEE98919F30F, 
-0x6C4BAEBA8597F867, 0xA24B49517666ADC7, 0xAE9A716BB1FD5B70, 0x22090215DF20, 
-0xA8FBDB092F1E5F7B, 0x7FCD31083FF980AC, 0x5F267C801050B022, 0xC3D07102C20196F5, 
-0xBF47831E74EC5443, 0x401C661DD04DAAC1, 0x10F998214B3A816F, 0x639CB28246188D01, 
-0x6BF87D578C18A0F2, 0xFA3061EA4D436617, 0x2D82FBE3732C34E9, 0x1AF40FD31B7A, 
-0x645AFA7C5DEFCE7F, 0x1CAE408BDDD856E2, 0x486C1AA2F9245E5F, 0xDFAB65C951D1DF6B, 
-0x79882396242051C6, 0x923FA5E3391EEF8D, 0xDA21461EFDD69DBB, 0x1CCA92F4ACEA2A01, 
-0x6629EE926E30FA80, 0xEF263F6DAE114F5D, 0x1E681BE5E2C27E54, 0x6820E2A7C0E3, 
-0xFCFCDCC1FD230C44, 0x9568E3064824DF0, 0x516E64D7A738E4B0, 0x2905DEAF17094A5C, 
-0x123382CAB2288457, 0xDA30D0EFE4BB97C5, 0xD9F9142CE0EFE2AB, 0x5E3693F0647151AD, 
-0xA2C12D7B2BC3946E, 0x1A1E36F955FA3C62, 0x2DB1727B188CBAD0, 0x3C77296628B6, 
-0x7650A03643F931CC, 0x7A297B3ED433F51, 0xE07538ED0099F3D4, 0xE639FB488E4A8AA, 
-0x8BC2E04677CC73CC, 0xF8CB181127366E99, 0x8F0FAC8F712BCB51, 0x95065120E0FE53C3, 
-0xE95B0EBF129CA796, 0x48C26154BE09633C, 0x38C98EEC22DAC3B9, 0x22BB7DCA5AA7, 
-0x89D191F7A6E1561C, 0x78AB0D357626700C, 0xC446415BD0DC26D9, 0x54AA2358310A7134, 
-0x33220E78506955BE, 0x8DFCD16B34265983, 0x5BBF885B1C1941AA, 0x9AE5A85CDA13EE84, 
-0x271F504FD8BE6690, 0x37373F519B0A7AA4, 0x73D299CDA4737CB1, 0x3369454B76E6, 
-0xAB977046E1D25A86, 0xA4B2F44EDD934AC4, 0xC1D92EEAB9A2CDEF, 0x897BB9E475458BA5, 
-0xE18494168E340631, 0xA7ABDE8307A45699, 0xB9D8B3029CD16806, 0x7E0ECAD968225E29, 
-0x2DE7D326E470C490, 0x9F8DC9D7E055020E, 0x6D1B409E8ACF0B08, 0x5EBCDD515212, 
-0x78D59030865C59FD, 0x58911FAA01C42AFE, 0xFFCDC43B1273A40, 0xA4AE78906F403C44, 
-0xEA3C1227C1CE7309, 0x2DB73AF20CE4D741, 0xE5B5BD56ACA12C76, 0xE251B8FBE19719B4, 
-0x7FAB7A99E0A3F7FF, 0xC8CEAF3E0314C4F0, 0xF52C274466292351, 0x373D475D7B4F, 
-0xA494B973AFBCA3BE, 0xD607F07157B3F887, 0x4DF152655762E7DC, 0xDA8152A305F7CF31, 
-0xC66EA0E3F2762E13, 0x103747C0F774F522, 0x53A238344F356E12, 0x43CFF744571B5C13, 
-0xAD7787C92D803135, 0xDE53A537426CEA27, 0x756F25AE5CC3C52A, 0x2CCE4019F15F, 
-0xDE74F67166092D0B, 0x628CD4B230854BCA, 0xADBC5E1201434F23, 0x5023B0BC3D08946A, 
-0xCED649A516CA28CC, 0x335B9CBCF90FB358, 0x24A61D301B0B9385, 0x149E35D1CF049BB1, 
-0x3FC0BBA10A300E18, 0x2F525190265C3B7D, 0xEBD21B00333AFCB9, 0xD004FB935F6, 
-0x57792CD8B8B006E9, 0x1589777B45A4FBDF, 0x1F5367A2C547C3, 0xC1F539CA824F8EE6, 
-0xF6029E1664DB17BB, 0x578A2ED08C1958BF, 0xFB4B72045D77A543, 0x50D6EA8FD8C4238A, 
-0xA09FC64E13230CD7, 0x3A1354BA13476E4B, 0x35D7700FC35C6992, 0x49940D590AFE, 
-0x3A5E362D922E9D1, 0x24D5C49FC498536D, 0xFE2771EE99F74C06, 0x299F0479C9E931, 
-0x4778164500790E3A, 0x5625FD97F0AF8993, 0x55F6CBFDBBFF1464, 0x93B8F1FFD7EC6C99, 
-0xA8825A43538685C9, 0x9F35E3EE67C1B836, 0x313F0643E0DB9432, 0x2D363FE2DFC9, 
-0x6D510899E6F493E6, 0xDB27470D8E2A6808, 0xBE6FB79A0250A90B, 0xB8E53ABD752FBBC9, 
-0x115BC7694CC4FF61, 0x3D4C109D56A0D077, 0x914F9A287C958F14, 0x5C281A2273E2B5DA, 
-0x28F390D78F2A918A, 0x44C9560346CD0D26, 0x95DFCB46DC4EAE09, 0x486377F90E3B, 
-0x8D127D30A9215515, 0x69A3F2514B3EEFC7, 0x3A465B443EFA3913, 0xABF17F186D8BEA1C, 
-0xC2BD976AC413FC2D, 0x75CF1D90C8A27B7A, 0x58C5CBD465242B94, 0x5AC3CEF0A873BA8A, 
-0x5736FE7BADEC475D, 0x8C02FAC7ADC47F4B, 0x4B4202754AC04A90, 0x185506632615, 
-0x676E83AE2EF94022, 0x6897FA0A12DEB498, 0x6574E6BC06B80E0F, 0xE72512001E5A3A81, 
-0x7E73B071A14F21AE, 0xA6087A058C42FAF4, 0x2060D5DF3BCD612E, 0x68AF45AF8698F4EA, 
-0x36FBFE011C5A7077, 0xAC835232B37B0B98, 0x68E38A3C51D83C29, 0x6F786702671C, 
-0x8BDB40885A6ED006, 0x938AACC3CEC39FA1, 0xA5553B53F8DACFC8, 0xB0292EC0A3A514A, 
-0xFA6D7C09FEFF4E9D, 0xF3345F7BB64FB333, 0xC09725712E204408, 0x860B879681DE66A, 
-0xE938C39E18E8EB77, 0x93F1EB4B0DD51839, 0x767032332E80D3F0, 0x59C0FB7738AC, 
-0x2DF525FF8124403D, 0x3EB5A0FC513C8032, 0x6E8D92EAF8ACCFDA, 0x55215CACD9B144A5, 
-0x292144B757F6F20, 0x185302184DA26ECD, 0xD16E7A0D8C58D34C, 0xCA262D0D8069BE24, 
-0x1FFE09B63351EA6D, 0xFA2E2F6BCA97492B, 0xE10133E35C8DD061, 0x5A72691FE3D6, 
-0x1C367ED83805470D, 0xAE2E636F73C44FC7, 0x63D98D3F02EE748E, 0xE7575E6419357E5E, 
-0xB435E395EEF1A53C, 0x5488F475D2906142, 0x96445FF97E37B1AD, 0x41AF44BF6EC48E8A, 
-0x7815F245E9066B49, 0x3BF9D080C0E164BD, 0xC3B129594E9054FF, 0x1259B1EB6DD4, 
-0xE309A43678DF5BF0, 0x7F5E0F098ACA2DC4, 0xCF12AC9FF1BF8BF8, 0xDCE8B1438F4C5D75, 
-0x596C4430E30404B9, 0xDEA9EB9E697C1F93, 0x3F60CCCFA7796E72, 0xFB1A5A32AEAB3036, 
-0x6CF0914E377DFFC5, 0x9BA589FC4FAB601B, 0xB941B4F819D47936, 0x9DF6341CA81, 
-0xDD04C087A7ED5FA, 0x58BE0A497572BB22, 0x2DADD5A264C78652, 0xE9EA2034B120BB03, 
-0xA88995B1E59B80A8, 0x94E663F23C265E8C, 0x653282E11DC327A7, 0x4D9AB755B018B17E, 
-0xFFB29CF9C5F98D4D, 0x13F6511750D23CC1, 0xA6CA4333712951C, 0x5BA7FF1F04DE, 
-0xF07ED98C9ADF2C43, 0x52A4A93854080E30, 0xF015DD29C956C40F, 0x7F2A949DA2AE1BAC, 
-0x78621FC09972CA83, 0x418DAA6305A5B9E3, 0x414CA013BBF91437, 0xA80DF33183E5AEB5, 
-0x75545EB017ECF653, 0x9106DB99A21E1979, 0x1C0934FB7535DEC2, 0x3C11513D471F, 
-0x7050C920E8CCB472, 0x65369249EBB97C53, 0xC1256347F853A7AF, 0xA6356F4FC1E18C01, 
-0xD480EB9C3A63597F, 0x64516279FAA7513C, 0xB08176C4973A58E6, 0x97C77C3FC6D40C2, 
-0xB7C6A0D352CCF1C5, 0xBD6B3CA9761CA602, 0xF963D0E62BEB5499, 0x4E072F423714, 
-0xAFC114EDF8E9CA6B, 0x154981287426B844, 0xEEDEA99983FDEBF7, 0x94B4652B5206C6BD, 
-0xDA7F96C5BDFE29C8, 0xAF8B174A7E92176A, 0x4118B5787C53432D, 0xF15572805EDB420A, 
-0xFF72951901AE98DF, 0x9E658844B28D1335, 0xA306E4EE4EC4DCFC, 0x4FACD89D0874, 
-0xC4889738DA91C9C3, 0xCA57FDDC14793CA0, 0x6A13AA1475C574F2, 0xD9D7A19FE8D1B069, 
-0x8D0B833E0FDA98, 0x818733F779391D94, 0x229263AC69894F26, 0xD49FF212BCCCA8B0, 
-0x862B0DE269C46CA1, 0x6C3F51DB74ED8A5C, 0x3D36E67927AC552F, 0x51C880B8BA10, 
-0x650F43C0E20B6AE7, 0xB1800ECF697A7FDB, 0x5AA83B28C51FD9EB, 0x49067A7147FBEA55, 
-0xBE9FD6885AAEEBB4, 0xC1513A867A1AB34B, 0xA80F117408C770C9, 0x63AB7C8B3E8DF96B, 
-0x93749CE815FF4EC9, 0xA95B7AB8B5B794D2, 0x165527B42C9D1399, 0x4577AEECB587, 
-0x6DEF7BC0098D3A13, 0xED55F5A3FE0F30D5, 0x26C6B1E5AEE585F9, 0x8F01E938CF226BA2, 
-0xAFCEF47DED8D307, 0x1E91918F20ACECAE, 0xBBE5F6A41928CAF0, 0xE12FAB3EE64E9696, 
-0x5970F0C3E4E5B3DE, 0xD498D676750D5E1F, 0x99DCC3F4DD62A805, 0x4F0E8FE0039E, 
-0xB9D3F94DB4E3F3CE, 0x7C0FF9CD9B705D1C, 0x5F8C53AB84079B0C, 0x3F7BF948C055421B, 
-0x3DA4399CE6F7EE80, 0xAAC1260FF3E9ABC, 0xB6F1EA40A7EE94C4, 0x849D7296C76CEFC1, 
-0x61294CCA224627AB, 0x78B6C9BF9E17C5E3, 0x7A738FD9B83AD80D, 0x44FBDF8BEB65, 
-0xE5966F8873C83A4D, 0xB826C1B5505E7B70, 0xE7ECB34A78BA73C7, 0xAD6926102D40EB31, 
-0xDC3019F947BC9F05, 0xA536C83AE4B064A0, 0x44979B8A7E6EDFCC, 0xC09AF8951490DB1C, 
-0x51E5ADDE23F381CA, 0x402D8CD57A4C6D8E, 0x64030B91ED9BAFB3, 0x57FC6F7A1A77, 
-0x6670B01247B55263, 0x1E11408CBF41694A, 0x1DD63F7A33E61975, 0xFAF13ED731646AF9, 
-0x84D4E234A26093E, 0xD57964ABB5B91145, 0x3EAC7DFD5F3A785, 0x6C29D28230C6111F, 
-0x3D79187DC3623D25, 0xBB6E4F8772CE2B71, 0xC36662C3F2EFC98C, 0x1625044648A2, 
-0x7734AE684AAF5F90, 0xB93284EA95030A6B, 0xDBBA36805FF53BBD, 0x8241540E98242B0A, 
-0xBEE55CC929AA9CFE, 0x84BB3119A85D2346, 0xF662DCDF4664AB16, 0xFF686EAE39ACFD5A, 
-0x3C307DDFDCA0597B, 0x2D59B12BC34F252A, 0xE4E453B25656754E, 0x3C908CDC34D, 
-0xBD80F1B37375F5FF, 0xC27C5092039E4CA6, 0xC0F971796FC8B339, 0x212CA6E18814B5A0, 
-0x1D561823496CAFA3, 0x9834E81D053D67A2, 0xEBCB04B9162E15A1, 0xF32AD51A843D2C7A, 
-0x8333883EB005C55B, 0x7488F1E4187083FC, 0x98C76ECA44FA2F8C, 0x2CDC5369148C, 
-0xD3C828192A8AA47, 0xC208A4DBE890CC07, 0xB79E89F2C48D69B4, 0xE828BD332CAB908, 
-0xF83F93FF9690CA1A, 0x37C3AE10D8B69184, 0x25DD711B5CC882BB, 0x603050321BFA7F62, 
-0xCBAB607743EBDCCB, 0x97E602B59CDCC929, 0x7F8D256A3893FC41, 0x5DD8350846BB, 
-0xC760356D4CDFC549, 0x7561C3A656590894, 0x84B156F8992F7D61, 0xBB6BBD4EEFCB139C, 
-0x6D9E9DA387719162, 0x8226F7D1878EE2A9, 0xD73D0CBA0124003C, 0x691DA45BA7D4FF6D, 
-0x9A51E408652A5FCD, 0xBB0041618C7CA10, 0xBFAA10805A954778, 0x71626E8CF55, 
-0x21682DF5390B83EE, 0xD8134EBDAD2658B4, 0xD7CBCC09EA974568, 0xF4C512366C28F000, 
-0x6BDABC22F3417C3F, 0xC02B611B869FF292, 0xF7E084DD516BF9B5, 0xF7B8878D135C5178, 
-0xBB8C9DD23EF1D80B, 0xEC1ADC7932ED8A33, 0x192037B9C842AB33, 0x1ED703E0727C, 
-0x820077BDF9DB07C4, 0x9512405FC804D5C7, 0xD197B6DD333BFADC, 0x86F53C9C1C9569E2, 
-0x61084A3B032C5084, 0x24A4E4760F20FB09, 0x4B8EC6F78B722366, 0x3FE6BC6C7DEF04E2, 
-0x78B8237700B4D9DF, 0x1F643D193155D05, 0xF18C5D8D49049D8A, 0x4B4A96FC757, 
-0xEEC961318EE59463, 0x9975C24466C246BC, 0xE4FEACDBD7836CB1, 0xACA57543C07CD6AA, 
-0xF0582B6FCC8886A8, 0xF582FAB913529176, 0x4B5FD74F97291BB7, 0x6B5664421A834DEE, 
-0x6BA0DDADADA4BC34, 0xB0C3E67573723BD2, 0x34C99AA28CCD7731, 0xCEB507C0DF4, 
-0xEF95406C044F0EE5, 0x5B1C7F3CE60BEB19, 0x1127C1BA8D8AA94F, 0x2DA78E62D4B6FE49, 
-0x579312E53337AA38, 0xC394B92950C45B4D, 0x956E7F78AC5376D6, 0xBA24424156158ECC, 
-0x95790F8FBF6B8072, 0xAB73931E88CF8DF9, 0xB50C41456C52AB5B, 0x6327C32414B5, 
-0x2A343AEE0513F46, 0x67CBC708268E733F, 0x69DF8E614D0D4236, 0xAE7477FC14608211, 
-0x143817981A05938F, 0xDDF3AF658B6819E4, 0x5C38EC0678C89499, 0xCC706B36021023DB, 
-0xD5B092A1D275059B, 0x7CBDAFF723D7E413, 0x877FD36C028B95C5, 0x17D2E612E40D, 
-0x7533B257A03823C5, 0xD0E9862473BCF552, 0x289B6087BDA8DFA4, 0x7DC948D3D7B57281, 
-0xB255962FDB1E99E0, 0x19F65D730B1B086D, 0x31E3A728972C72C0, 0xDE88DEEF4451A0FF, 
-0x2FD2DFDBCB6A1CD1, 0x2C0CF3A1A628EDF, 0x42AA5445BE533F2E, 0x1C6D4562A49D, 
-0x7DC82C224E68B866, 0xB00DD4006B456417, 0x53352F8561ED2DE4, 0x20F1555F08B503AA, 
-0xDB196872C520A99E, 0x8223CFFA8BFB587B, 0xD910831DAC9FB2E7, 0xC52A035240042F81, 
-0xDD3298307FB2B993, 0xF31E8BBF3C732176, 0x8B2447BCF2B8BB55, 0x525FDC003D97, 
-0x507870E564571B5D, 0xFAABF0C3E96AC4F5, 0x61150E1EE2055B1F, 0x706C9E59B2F67CC0, 
-0x41DC47C873059EE6, 0xDC661486787AB64, 0x7BA3154AC6CD96FB, 0x1A2E29343E062641, 
-0x8A3733B58C54B9CB, 0x7A8F83E664B100A1, 0x60952A4A01EB1BF5, 0x6AD7AB7A98B9, 
-0xD2867D46505B89F9, 0x8C984840E27E2653, 0x24BD268E74E0898, 0x22CC0EE69898CDCD, 
-0x3FB7FB4ECDAD46E5, 0xAED893B37D7B345C, 0xA86E20DCB2ACF10, 0x7A171E75C36022E8, 
-0x32D25DA3431618BD, 0xADDE40078B51AD73, 0x9AD7CAC52B0D8493, 0x6C15B1D01073, 
-0x7B68738FBC5DCC60, 0x86A53E2A1A282508, 0x279BFEFF5C6751C4, 0xE57AF5FF372F39EE, 
-0x97B053B235B85F93, 0xE735134B3E70BB6B, 0xB684F75AC54EE8E8, 0x3FB4D5570D3D4861, 
-0x5BBDB8AA21A4FCAB, 0xA7A0FA911DBA922A, 0xAC84161B7B336951, 0x1243EBEF7CC3, 
-0x10C1A88DB3F5D8E9, 0xE7FFA20300C8772C, 0xAF3A98E35E72BDF9, 0xA7A8CBFFFFF4AE49, 
-0x1FFE499BEF3D8086, 0x5AD36E9EADFB0329, 0xE6005FE2B0FDEE7A, 0xA0CA4F8B42281E0A, 
-0x169844E48A91D500, 0x24757986312130AF, 0x3FD6A0C6AC890791, 0x16118D6D796A, 
-0xD9693E04864DA5D6, 0xFCEDEBB387B6EA2C, 0x9D717420093756A3, 0x906C22DB344E840B, 
-0x61DEE2B44EE90874, 0xB56A075A81912391, 0xCAE1D8CA4376B162, 0x1BCAB31A69AED456, 
-0x1C94B9142BA20BC1, 0x6455CEAE1B6C762B, 0xABC80CCBCC2BDA17, 0x39D3683D25E4, 
-0xABFEF556769412CD, 0xC766FF03091BE118, 0xF8C311E36A619660, 0xD9572B23E8741F32, 
-0xBE9ACE9F2F758EF9, 0x10FC16DB06018EC3, 0x1A2B9E00C86A38BC, 0x7D70FC2F07ADE78C, 
-0xEDC01BD81C24F135, 0x11CEE7913DA7E5E5, 0xF2509E7A910B084D, 0x42D3DEB03A8D, 
-0x46A6315B12731019, 0xEF86FAE44097B617, 0x66F2F3E13B0009CE, 0x63281B3E39AE6990, 
-0x9801A795FCCCBFEF, 0xD878AB1BD68EF0B0, 0x6351DA3B691292A3, 0x15C9A76343234EE8, 
-0xCFE44D4743F2D238, 0xFBDC5B70A0DF4B7E, 0x81C273F44E292EF7, 0x15BCAC5B5B32, 
-0xF7AC713D79FB84C, 0xCE4FA7E56EAC3017, 0x33D79BE8551305A4, 0x8874F89504E3FDA6, 
-0x61F66CECF90B244C, 0xB6071CF29A17272D, 0xD72070167485782D, 0x99C439DF82A16C31, 
-0xE0B2204E8CC46783, 0x6906DD0777BE5E20, 0xF078AC51360A9992, 0x3A5E3462F047, 
-0x7DEA37219DABF4A3, 0xB53872BC9C2F005A, 0xA600A1494C3C1D69, 0x5639563158F563BF, 
-0x683DFCFA64037A6B, 0xBEFF4677155ED1BF, 0x75F4E78C97B03E4A, 0x1D2803823296ED1D, 
-0xFE0C07E6F6A0A73D, 0xCB5C916448FFD921, 0xC2A0CCF3CB7B0B95, 0x259636D477DF, 
-0xE0287695E868C61D, 0xDEDD1819D5150798, 0x60E9CDAE35678359, 0xC53663C6A4F67C25, 
-0x34EAB02F94464953, 0xABCE0BF1A20EE43, 0xF5773F9095DC1B9B, 0x647747E413D3398, 
-0x3F05DDCFCD7B013D, 0xBDEBA0638BCB1216, 0xA0C9806822711FAC, 0x3A8B74DBD2B3, 
-0xE2076E303FBD0651, 0x4A7802C140513EC3, 0xC9D832A066D582A9, 0x4700E843A6D9C66B, 
-0x605E798D65F0CA56, 0xC95A6194FE0BFAD1, 0xA4DCA1D21300E34E, 0x6C5286F7A9CD1D2B, 
-0x6CBFABE0639CDD65, 0x16538AA197497FD1, 0x35B5E04352DC98BE, 0x185B83AE0C79, 
-0x2CD1E2335C15121B, 0xD52B031D536161C8, 0xEF1CC8D79081CC71, 0x56CF08F34C4AC040, 
-0xE9419B42302EBF1B, 0x2A97E5979DAF2868, 0x1CD7DE7231CD56B1, 0x7E8B8D8F2A3E39A3, 
-0xAE55B062587CCDF, 0xC5957D2F6226E885, 0xA25CC5E52D6E1B13, 0x3D16A28A15AD, 
-0xB05A83C3647EF466, 0x5C4638B6ABFA6F5E, 0xE7FBB2C4125A2DE1, 0x3C9FA705F8253A1A, 
-0x316CB66528444E26, 0x24759B21858E240C, 0x4502518B2EA9ED3, 0xE4BD5FCD4F2E495A, 
-0x349E9A65D52EA524, 0x136829C5C87A7ED6, 0x74B7D661D82CAA6B, 0x66B0E4C8F396, 
-0x34FBCA072588EFC5, 0x1FE0AA181037403C, 0x4BB5BCC3EC772409, 0xF26D1CDB8631E290, 
-0x7C5AB644C54549FA, 0x5AB6FC3A28EDC846, 0x5D4ED6A2F57922CF, 0x8AA5E845D0EF3EEC, 
-0x3C1B79601154EED3, 0x9D12C0BAAE18E527, 0x9D38A92E710385AB, 0x5866646928EF, 
-0x4DFFC758FC2F8F3D, 0xD1AEA642E01259EB, 0x2A5761B4C86C498C, 0xC1455D72464B33AB, 
-0xABE604E355A76B32, 0x55F73D51D5490195, 0x78C7776A2EAB4343, 0x2D15773869A22640, 
-0xEB3D62D9CF625A57, 0x9107439ECFBCA7E1, 0x5C11A0CDAE29BE47, 0x5905446D7921, 
-0xA49222F9BC798F6, 0x920096F71C8B626F, 0xE0474F6DCB60766B, 0x6A6C9855E7AE71B2, 
-0x6E268D0C7B647C3B, 0xCE83C6354F680E3D, 0xF7D33A1C56DC1426, 0x8BD0D6AE9D40692, 
-0xC0EDE66258A8D772, 0xDAF8D3794E257D07, 0x3C098EDCBE928856, 0x639C579CC35D, 
-0xFE9BD223B05F7013, 0xFB38C1E32EF3144C, 0xCB92F282A8D086BD, 0xC807618B456920D9, 
-0x66BC2000CC6FF438, 0x8D20194D7E9178E1, 0x57207D8E1B51D213, 0xD09D6AD1C5897220, 
-0x408DEE7647D7516D, 0x55DAD2E6ACBEB766, 0x189434D109F9DD26, 0x659FB445F1A1, 
-0x8F6DFFF14F59CF75, 0x3B60C0AC1C4A71FE, 0xCEA1B38F7A6A3D36, 0xEBCC0A84FBBBD3EF, 
-0x67E1297C060EBC82, 0x733AC4E0BD9E9FF4, 0x2DDCAE460804A45F, 0x5E20562C836C8269, 
-0xF99DCFCAD3BC4FB6, 0x9FB5B5CE5305E849, 0x102D5C5A856CC507, 0x3A3F45997F7B, 
-0x260E6D7705A7D13B, 0xC57617CCD560D7A4, 0x9B0A8EE5B0006D75, 0x8D9514A47FE275D, 
-0x8A90ED2DB9F47D40, 0x1E8D9EAF7FC61153, 0xC6F81A0AA845C5EC, 0xC1BA6A9C1E4BB79D, 
-0x2B20765AC03FF28, 0x83E23C3DACAEFE07, 0x9B3B2377192C9411, 0x8A11D10FB96, 
-0xB150DDAD7995F802, 0xA7CE55BC74E138A2, 0xE86C252667E8964C, 0xF97E909F6E4EA62A, 
-0x40FDAB5A660B02CD, 0xAA3D14DB55EA53B8, 0xB7411FEB89F15B23, 0x53FB81EDC05A0D6A, 
-0x6D1E999C6CDCF589, 0xB099AFD4EC481CD4, 0xD421559706FC458B, 0x1BAA81996926, 
-0x87323E3090CECB94, 0x9BDEEA0DF79C3297, 0x4CF7BA9C5B947E42, 0xB91FADB7679E9654, 
-0x2385AFD067F3909C, 0xE897E66D6D5AE4B8, 0xEA1465293E1F70A3, 0x20B4AE7632E200F, 
-0x77AC365A864DCC4B, 0xFCFC0AF4A6D4A5C4, 0x89667AA894E942B9, 0x4882631B8BB2, 
-0xE1DC9DADFE34FC, 0x5CB50DB0E5FD67A3, 0x2F2B80D82795FA24, 0x48AE1077E0C70F9F, 
-0x8983681282D47D5C, 0x1C232AFAB9EB8F0F, 0xEF39D1DC73AF932D, 0x165AA037818517E4, 
-0xFAF681683231DFF1, 0x35A1947AB140C48C, 0x8108C4EB661648FE, 0x6C9B4B717E8, 
-0xDAC1BA4821802F1A, 0x522C88D47FD48F35, 0x3EBDA1FC771A8DA0, 0x853DE29BF44C0B38, 
-0x845C292C8C0EA729, 0x78E240EDB5C44261, 0xCDF50F6E06E0F192, 0x9A20625186E42194, 
-0x616555D22CBB9F7A, 0xB7D682EAE77B0E4B, 0xBDB6C6CD388FCD5E, 0x26D6437F6B3D, 
-0x279FA8F8E8165BDD, 0x25EA870C2C30D037, 0x15B8128F59FDB25A, 0x18BB0053F8937698, 
-0x82E0A50C5AE1B47D, 0xDAF9D533F0CD4C1E, 0x631A9E0DADEAA7E9, 0xF76613EB9FE5EC78, 
-0x25DD3086930BACF7, 0x200947491BBC9E3B, 0xAD3226ECDB705D55, 0x17DC0499AEE4, 
-0x387F4BE6C7C56D1B, 0x3251F99B5BF3D327, 0x8EACABA6E87C613D, 0x5F28FB76EAD45F56, 
-0xC606826FC530537C, 0xA035BE94CCA617F5, 0x12FDFD20B68B3B85, 0xE6645B79D9AD8162, 
-0x39F6690E9B93207E, 0x81797F7D07276AAE, 0x90CFBDAC4E6A754F, 0x47307484DEF4, 
-0xFCC22C490FB4EA48, 0x2C9BEABD88D64449, 0xE98F3ED29BCDEF76, 0x7F819AA787CE732B, 
-0x13BCAAA56D6FF3DB, 0x53BC74B7476F0320, 0xBD76E39398030134, 0x336EC2985DF7220E, 
-0xD8438533B29F911F, 0xC3727227D36BA4C3, 0x811041068A604B02, 0x1FFE787B6226, 
-0xBDDD5CFC400912BB, 0xC56A155460CBCC3B, 0x4359C07BFF38A840, 0xF075DF4082359D7B, 
-0x5B65091242B47A43, 0xB6DAE6AFEA18F879, 0x4B86934E821F790A, 0x9655C02C017F021C, 
-0xFD542DFDE10BA867, 0x12EBD1C865C59B06, 0x2F3E352DF43BED87, 0x6BF24AC6E96E, 
-0xF4639B2605FAA3E6, 0x2C270DC9A01B0367, 0x39FE00658B71DC06, 0x88305B3522952817, 
-0x3CF4833EA81AD1D8, 0x4B9CDE78E93659BE, 0x698ABA432498EF77, 0xDC457AF4534A370F, 
-0xB9C300966E01E5CB, 0x898CE8690CBD8909, 0x50BCC634E4AD8625, 0x3F1755C47BF8, 
-0x4B82E8AD89E6641A, 0x21BD8AB4895521E7, 0xB9C4D32DA7FD9075, 0x70691D1211EA1580, 
-0xE4D600EF88326D8F, 0xCD98BD1ABAB1895F, 0xCDD47DFDA8727815, 0x513F4A18B035EC71, 
-0xB925C39AED99747, 0xA3441E7317D6DBA3, 0x6C254A62A920D0D1, 0xC71E9BDB2D1, 
-0x9BF5B0FB5EC42224, 0xA3686D019A02A32C, 0xFEF3888FCCCD96B, 0x2633DACF0B36D824, 
-0xE7D047AE7FFE57F1, 0x4B21C4E3258BDCA1, 0x187E599176EFA63E, 0x110A810FCE4293E3, 
-0x9EB639AA6DEE06D4, 0xBC434E85EBB602E5, 0x8B09A4303E280EB7, 0x408B5A55CA7D, 
-0x1078FF2319F250CC, 0x86124135E4875983, 0x4774C81B6F607699, 0xC0E00AC1919F0A59, 
-0x1C9D65155BFEAB2, 0x8D0390F569A5655E, 0xB1C9D10547CE2766, 0x9A9B12001933AF1E, 
-0x40D7640FC9C78714, 0xAA82D808975745A9, 0x2B8AA2E4C8426952, 0x4C45E00B39E3, 
-0x622689ADD070A957, 0xE1DB7F5A57E312C0, 0x24BE8F34C82B0677, 0xADEDED3AA76E1872, 
-0x930B0048DCF42818, 0x97C99E1716CCD330, 0x6B7E106D4E089E8A, 0x57D0EDDE5E9451C7, 
-0x5D9454D116D3957B, 0xA8089B45372DD862, 0x1F06210AC1949D11, 0x4FD52FF77067, 
-0xCA1C29A873BFBE0C, 0xA0156B38E052C74B, 0x592DD3FBCC0E21, 0x94FDEFCF520A8D0F, 
-0xAB1509DE8F443E3, 0x9E9D0B49540696B3, 0x38855C271E8F49EE, 0x167C357E75A0756E, 
-0xA5C0EBA67DC859B2, 0x1FFAEC10B06F7237, 0x8FEC37CC5234ACD5, 0x291D8BF7E3AC, 
-0xD33C39A21D5241C4, 0x8205A09F2A302A39, 0xB4C62845BC56A798, 0x45E9CC0BC957FFC8, 
-0xF8059494176FFAF3, 0xF0BD4AE334C6F027, 0x2F29F277BEBB1740, 0x3E1A18E089184C09, 
-0xADE4E068448D3AA0, 0x46FFCD9BFB81EE5E, 0xF7A777DFF7B50D4A, 0x143271B13D09, 
-0xC7D9F96F46B15CEE, 0x99B06B41C5FE0345, 0x140A89319CCF34D8, 0x7F167C499399C311, 
-0x3F4EC0E245B1E2D8, 0xC84948DE57C44886, 0x8A0F1CA65EEEAF5D, 0x9C87FDBB649E0D4D, 
-0x340A360AA50FB11, 0x343794B0618DF4D3, 0x479177F8BBC8B6D0, 0x68959D01B344, 
-0x800BE1C461AEFCEB, 0xFE65F6256365A5A3, 0xF5D3B2D7AEC4DA56, 0x28E557DDED5137E3, 
-0x9322FDBD639AB6, 0x8DA8B1DF84051A5D, 0x74F8C361D79CC80D, 0x79D993E2D937B27F, 
-0x5E76B99E06FA6D8A, 0xE7BF995E1A7E2297, 0xB170AAC0D5A663F6, 0x21BC10F3E236, 
-0x14FF02E218667CD0, 0x46779A5C945561C1, 0x33CD4D922E4DB2EB, 0x88E8AEB383002FF5, 
-0xD9B5E370E4D2E06B, 0x5486328BF13D4275, 0x3D68970D6B737E79, 0xD4F38A225B6A50D6, 
-0x781B16E75403DFF6, 0xD52236408655AF21, 0x63F2233DB731742B, 0x4742B82BDD3B, 
-0x2FC6EADFDE33485A, 0xC55A566A3112524A, 0x22539019B56A106, 0xF6CA0E3A2E9A0F13, 
-0xC1067C8092D8E2B6, 0x63B30F4268FD3A7A, 0x7576C1DF9A82CE50, 0xE33AC068F9CB33B7, 
-0xDED1990BF0082287, 0xDCC0863AEFA52672, 0x733EA7B429D3CE7C, 0x41F41DB79D7E, 
-0xC8D5D588F1BA77D0, 0x60ACB4720BBA42BF, 0xC88C415D6E38523C, 0x9939A005C6F5F71C, 
-0xE18FEADBABD9763B, 0xAD0BA66AA9FD2BB5, 0x5B5D7C992DA3949D, 0xAC7C52E3C841D845, 
-0x5178D3EEADE6DBFD, 0xA87020755A5762E4, 0x4A7E851F9A7C2B2C, 0x33FF8180E771, 
-0x81D9AC043FE15A6A, 0x22D5CDFEE0FBDE4, 0x93166F5F1335BAE6, 0x5CC5258B613351A7, 
-0x4B59D0D3F6E96C4A, 0x43741C611449F739, 0x3CCC98A5CAA789A0, 0x7DB96DB78E8E6A78, 
-0x383EC501B66BA903, 0xCEB5F0438A4647F9, 0xD673215CD29E657D, 0x1D944BDCEAC3, 
-0x8EB1FEEF97736818, 0x68473F0252D88A4F, 0xACEE6698934D8C02, 0x22F15BB910A11A52, 
-0xB0C7573F9A6EBC5C, 0x617EC764A46337AD, 0xA57AB4C2DB7460F, 0xFC336D7E04E0CC4E, 
-0x29EBE472BD03045, 0xE7CDEC1786829C48, 0xD4B10CA536F1626A, 0x6AA94E4A8504, 
-0xDC1801D58BA9063D, 0x83E5BE256A9F3582, 0x23C9759BDE636412, 0xFBD9D3DA6BD25A25, 
-0xC68F76FFE7117111, 0x190BB80F58134D6B, 0x7B0D4265083E4373, 0x288A9BB15C87D94D, 
-0xDB17FF6A629396FC, 0x86C715D67AD79E93, 0x42A4533B92758047, 0x4F44FC9D06F7, 
-0xE2C290FFD189753F, 0x246036CB696709A8, 0x97BAFA65A0FD3DE7, 0x5787979A1E5F2090, 
-0xA95BC67C690692D8, 0x884C0AE4F0E2FF7C, 0x94E36FE59BB5DBA9, 0x3743AE861151F3A4, 
-0x70D061F5FFAE2B00, 0xF52246AD3A35BF11, 0xBF7886E124E56BF5, 0x433625F2DFD4, 
-0x117E35D438A9E619, 0x76192291C5FE1F4A, 0xA0670A6BE783612B, 0x98639B2ACABD8638, 
-0x33F3B79588FAB2E9, 0xF9BB9DE24DA0EE2C, 0x6D60BBC7446E7808, 0x5A871E0FACC73BB, 
-0x8EACB5DD2228C83A, 0x76DDFEAF29553C3, 0x12664F612820A396, 0x56320C9C42AD, 
-0x16FE6EC1A3F33F32, 0x38595A909872DA7B, 0xAD5DFFB2EA78C8A7, 0xFF2904A8240AD5AB, 
-0xCC8F20EE9865388B, 0x458DA7881011E2FB, 0x3B95AEFD871C19C0, 0xCA261AE75D98FF86, 
-0x84B9F6D489FB4202, 0x766F722FA27BAAB8, 0x7CBB0F410F463980, 0x6F01A07905AE, 
-0x3B8D9444C0AD38CE, 0xF70879D4521AEF98, 0x77661CF08C972447, 0xFF866C0870E77C3F, 
-0x2F2B9B95EA9FBEEE, 0x2B7414E3FEAE7BD7, 0x58B68D4CF01DF7D6, 0x7EA61D227EA99F, 
-0x3034469CF7165636, 0x1D87A09CE9D0A70B, 0x854D1A246FF49ECD, 0x108171CF71C6, 
-0x90B081B280BCED81, 0x3463B263E83A593D, 0xFFA7D333BA192BA5, 0xFF2D0C2A1DDD6BAE, 
-0xBF018EF2230C8E33, 0x5D3085D9BBD26B8D, 0x34908699DEA742B, 0x307D6D8B5FBA9F, 
-0xB58BFB984F88CEE6, 0x59E77582F5D42111, 0xDBB473BD579373F6, 0x698F1A559F6E, 
-0xF024C0DBBCF04401, 0xB5A7FCF4DE9946A1, 0x1023486099578DC5, 0xF94CCF63E8A616F9, 
-0x18953EDD88382292, 0xB4C843F6AF0309B9, 0xE62A7C0192DD7DEB, 0xA39E004988F785DF, 
-0xAC56F0C7AE84B672, 0xFB4A2C0A8CFE2BDE, 0x85257029ED723CBE, 0x3A1647787506, 
-0x75C2CA63DA336C26, 0x83261CDA36E87E09, 0x1CAAA8AA4AA7402, 0xDEB3B1A273BC1F20, 
-0xAB805EA4DA475111, 0x890E5817947091A0, 0xCCFB00BFBF7FC424, 0x68F0DE89E8050C29, 
-0x3F05244594F48713, 0x65194A41D681DE6A, 0x9102D0C198CD0704, 0x5F3DE29FAFA5, 
-0x8AA28BCA279E2F49, 0xAE0775200E22B9B6, 0xC7869F857529B0E7, 0x97B9917579F2D804, 
-0x954588797205CC0A, 0xD09E227BFCF4D778, 0x30C1487E54DFEA48, 0x32EC339FB2BE948E, 
-0x1E887DD5585D4102, 0xC0424E9720CF0D9F, 0xB899E8DB5A86346D, 0x14FEEC892F44, 
-0x15ADCCDD60ED0DF9, 0x1AA0200BF213CC01, 0x991747B8CC196453, 0x3BA6F8F97F2EA434, 
-0x7C84BA5D2DD9DB94, 0xB9E31A408A318569, 0x8680E8A22DB56F83, 0x32111D639E8A2049, 
-0x55BAD0164A2DDCE7, 0x485DD21B0A920D39, 0x87979758FBB75869, 0xD7FF5B554FE, 
-0x65F6281ABDBB387A, 0x9C07BE245A26D240, 0x2A830DB500B44FB4, 0xD91CA04B55847EB5, 
-0xFF95A9F7076036D3, 0xD74F9ED7B4694B9D, 0xE210EB25F5D9EFFD, 0xB088E1FDF5590349, 
-0xBCDFF1583AC86635, 0xC3A2A1A588CAD8D3, 0x3EE4E6F6437944B7, 0xAE6F96E03F1, 
-0xD1712A4A424D7E4, 0xD85014378B326347, 0x363A6AD3C58A148E, 0x3DC34A8647F98755, 
-0x341BF53D1A674037, 0x959C11ECC91227D3, 0x82674F0E0CCE31A6, 0x5594C88CAA899BA0, 
-0x79ABCE17220B51C3, 0xDB5CC8FFF1D4F640, 0x47DB108050154120, 0xC744A91A5B4, 
-0xF009A63513BD3A77, 0x767ABB252913B019, 0xDF7459F312A5B781, 0xF4EF828AFC4F84B, 
-0x54226B12EFB4EED3, 0x54F011F8E4B1ADA1, 0xA387552217A55052, 0xBA99F6308C65EA91, 
-0x93160CB66C6BF04A, 0xAE585A7FA9C12138, 0x5ED60259A9D3F7F9, 0x4394E323E8E, 
-0xAB3FADF36E369793, 0xB4A4E25C1E955B5A, 0x5FB2B0D08A3120BE, 0x411736FFD26DD12E, 
-0x2B60E93B1CCDB251, 0x25B48C3F211DB1EA, 0xD025E3DE9705D983, 0x3EEE5E8E34B3AE1, 
-0x1FA3D4EF5490B961, 0x7AB303C84B7978A7, 0xE1482EF832B22AE2, 0x5ED2D2ED4B7A, 
-0x4802A83930AC75C8, 0xAC4583C418F7754C, 0x9F636682D372458C, 0x35822CB335B8EEC, 
-0x2F82D34A05559331, 0x8D7A6E84A589C7DF, 0xBDA24727B6CEF0B3, 0xA12306085B2AAC73, 
-0x60E2BA20E9FD54DF, 0x4020A230ACD02571, 0x5719461ED74948EA, 0x2E56170D2C5B, 
-0xFABC303955A65C1C, 0x961D77ADBF9E5309, 0x4043066F3B7A8035, 0x4BF765E2C5C6053C, 
-0x3285FEA9EC7C3554, 0x88F1AED9560095DB, 0x572487360FD12F58, 0xC88641FAAC8AADBF, 
-0x99A8AA7CC8DF5C08, 0x926F2C17559FADEA, 0x454AFD8BA413C546, 0x6C4489E53A50, 
-0x23E3D933F8F6C5D6, 0x6B7DED0A8F724556, 0xE33E86079E8C25E3, 0x1B9A3B1DFE495F18, 
-0xEC2265D498998DA3, 0xAB2DD535E22B4BA4, 0x8C1FCD070ED016D1, 0xAA4097AE4CEC7E44, 
-0xF8428F44EF6CD268, 0x944BE6B8EDE373F1, 0xA4BB58C555A8F887, 0x4B8E6BCF28E8, 
-0x8C1A13DE989379FD, 0x9CB2A3408586F8D7, 0xA2E3AF5135C9A149, 0x3FA44407F074DD89, 
-0x37DE80682B2FCA57, 0x764D6C34971650AC, 0x8AE0A97A99D02E7A, 0xF08CBF80BE01C0F1, 
-0x314F0C427EF6D02C, 0xD6431E54C0318A87, 0xA1F7BDF4B822E0D, 0xF590CFA284D, 
-0x8E60D592327E1B57, 0x3150B4EB50B80D35, 0xE830426527BE0C04, 0xDB563411690EC292, 
-0x2405D558E19F9046, 0x217A4D3D4247F17C, 0x85E6F3787701E8A9, 0x1994EFB7F1761291, 
-0x272693BE5B058EFC, 0xFCD5B910ED76D3A8, 0xFE0DCEE18D823215, 0x10B2B38EDF26, 
-0x8B3EB8151A212EE, 0xF84D60644109388F, 0x7BB858D19B1CAB0, 0x10E3B92BEEE4E641, 
-0x12B51187FDCA047F, 0x6BFA046A77A36E85, 0xFBE3BCE15F5C0727, 0x450C3F0D9CF06CFF, 
-0x7EEF0EC728557AB1, 0x6819DEF1A0F21921, 0x56D02569D4B8ADE4, 0x4011E5183009, 
-0x34E07A2EA5F5CF9A, 0x6A7A60E933AA7B38, 0x9B615CA018E5B2DA, 0xEB257660C94FC6A0, 
-0x508BD9E266902458, 0xC4C5CD7CB4F400E, 0x3F7F14ACDBDC22FE, 0x6B406C6A11280A60, 
-0x4AF4F1CC8C72C41C, 0xAD36524628575E39, 0xD23BC7B4ADD3DD04, 0x158AC55F4D93, 
-0x56290EAFE6EA3C0C, 0x9B8BD1F264AEA9CE, 0xC831BF432F36FACA, 0xC9A8A02B8A141633, 
-0xB9AF9784CBAE4846, 0x60752C2ED15AC229, 0x75530A4EE671A66C, 0xA004B1BF848B591, 
-0x85F9B4BF401A0862, 0x59CFA583B3DA48F1, 0x4C6351AF8F42B91, 0x22D6FD3E65A1, 
-0x7481461D2CCDE3E2, 0x1C8FDDD9801F7F4E, 0x1175B407963E4782, 0x769733C1B49C44BF, 
-0x6D194441ABD180B3, 0xCC299D15701D6217, 0x11DC5E2433A0747C, 0x187DEDE0B0E28629, 
-0xCC2244FDAD8A0C69, 0x362FBCBBA3BE2B1C, 0x84FBA4B8455A81D2, 0x565370A17C6E, 
-0xDE36549FBC03D166, 0x7DD452F61D1DA730, 0xF5FD86CC229563E3, 0x76DA57C8421E69B2, 
-0x6E2353C96905A636, 0xDD22D0F5E15B9DBB, 0xE4D995FED7EEB0CF, 0x359F09360C8E6965, 
-0xEDF5FB1CCF584A83, 0x76FB1847256B7C9A, 0xE03524EFB05528EB, 0x65AD93DBD067, 
-0xBFCDEDA85DE774DB, 0x17879B5255F33F92, 0x3A41D0EC83461F97, 0x605BA76D1690CD54, 
-0x1202B1D3BE3B1E01, 0xDE86DC8C357D88AC, 0x26448480FF5A03F9, 0xE9BF31A17787E9D6, 
-0x489F8E12EC0206D6, 0x8BDEFCDD950DEE8B, 0xDB3569E3BB2F2AE, 0x5C8D98E1EE5F, 
-0x4DEA9AECA4187361, 0xC2B8EB2D92D48B00, 0xF20054AB2AACDA7F, 0xB1D261AA9ACC5E22, 
-0x190D1D4FA8A6C6B6, 0x663CCCD7C0360376, 0x13C9D9FE05D5A4E3, 0xAB0AAEEF21555070, 
-0x49BCE15F81C9CBDB, 0xBA4D4D8E6930F75D, 0x30BDBCEA82341CE8, 0x2F0DBCDE5E3E, 
-0xC534CBAC095AC42F, 0x935D0E643B017D80, 0xBD669F1647F5DED9, 0xE321B4441F90A4C2, 
-0xC8EEAC9EDBF8B128, 0xD859EB276D55884E, 0xE938A6FD227ED52B, 0x5CDC0B22B2F6CAF2, 
-0x10C74B408B1ECC6C, 0x872403540A9EBF06, 0xEB7E7D6A80547A60, 0x328F49FC172B, 
-0xD8967BD69958B3DA, 0xBC420E18FB471DC9, 0x75D575A6A48A233, 0x4E2E503364C134C5, 
-0x4BC39097EB85D8E, 0x17342ABC907DCC07, 0x6D6D61A4F90BA105, 0xBF3024603D8F62DA, 
-0x17CE1B7AF22061C9, 0x11495868FF9F6D52, 0x2989FE947879B2D, 0x455E1E62D6B4, 
-0x95A42057B5FAC073, 0x93774BB36042229F, 0x72A5F525FA16F90C, 0x4E2120BBFDF6C9FA, 
-0xA5417FA36BC11329, 0x139973CFBB62F9CB, 0x17AC0CB83605041F, 0xA169752AD9916414, 
-0xC297286F265A99BD, 0xC6BA70AF4E838FD9, 0x5660535AAF87C3E0, 0x6F6056E6ADA6, 
-0xA635B92FD1A8D759, 0xC92F3B6F67F10EC0, 0x74C4464569151905, 0x315589131FD0E895, 
-0x418F0DAF0B6AA8C2, 0x9FB989FEFE468B12, 0x58E80406D10EB0BE, 0xEE95808BE7CFED1E, 
-0x83C5DA30306C0C86, 0xE957C5F639F6DC72, 0x296E5FE4512E17A9, 0x3E368462E4F4, 
-0xD8A161FF6F34FD1D, 0x2ED17579FC994862, 0xF8FDF396F34484A6, 0x7411A92BC6D1CB63, 
-0x5C6F1C0109280DDE, 0xF1EBC9F6051F74B8, 0x6BC2C5FC833BC5F5, 0x7B9C31C9348338AB, 
-0x796EC1FE904294F4, 0x3F7FD306101D3AAB, 0x962AF0452580E6BD, 0x2099559130BC, 
-0x3AE6CAA07EF66CAC, 0x4FD0C2F6107802D0, 0xB64E30E5C0D1E97C, 0xAF85AF0F813203C2, 
-0x8C7D47BFA7786BC9, 0x2487377C554A1A05, 0xE2E96762EE69C3DA, 0xF6221499D47EC4FF, 
-0x637E198D62736E5A, 0x1F98CDE964141D24, 0x2C01CEC06B7C98DC, 0x2DEA184C7DFB, 
-0x5DF125D8C48D94B, 0x8676122E7945258A, 0x71D3A31DBEFD3580, 0x5D8051E0556A3228, 
-0x24F3F0E22D681E1A, 0xAA884569EF458E2, 0x7A8C27E6A63B4B63, 0x3A9FCC4BEE1522D, 
-0x91CF05983EF1C617, 0x75673103A44B2AD7, 0x86879675C254BA38, 0x13802B76DBF4, 
-0x36D6B6825CCF8B54, 0x52E9CF27AAF00FBD, 0x84A262C2F00AFB6B, 0x55FBDFA5B5C19CF3, 
-0x69B3505AFAC14E2A, 0xC8A566136AC9529, 0xD940C85D3786B3AF, 0x8CDF3DE06AC33DD6, 
-0x1B1A2037B0D3A35, 0xFCC825419E850358, 0x3EAB9ADDA8A42437, 0x530D2BA2C1CE, 
-0x75AF2EC3A8129B3D, 0xE57F602AD0EE0DD3, 0x3FA25442F571094A, 0x2B6A9E580269729F, 
-0xA003C689DAD95390, 0x60A150452A9BC7ED, 0x459F5C61E1355E0D, 0x260C4C234CD1A34C, 
-0x180B8C158A866F63, 0x78EDFD491E65C13A, 0x2AC740134A3A4CF0, 0x4495C974389C, 
-0xF9D1373BBA1BD2EA, 0x133C7D44336F0BE9, 0x7E3E4005F4203855, 0x150880648172DFB2, 
-0x1C4F5CFCED9313EF, 0x2E36884A324C6D10, 0xFB89ADDD6622D8BC, 0xBC5E897F3C7AB19A, 
-0x9635998336FAEA5C, 0x81949EAEFF090D99, 0xC1380B95E1E5CB42, 0x3E0B620DA000, 
-0x2F514794408291B1, 0x509D5D7F4A3CDFA, 0xD040FF9B1A9151D4, 0xD94F7C21624FBAC3, 
-0xE78C6B6F4F29EC5, 0x673C5AA165602E4C, 0x169D91FE6D898916, 0x4D6643C7853B36DA, 
-0x829C5552780AADD0, 0x67B460D298A33344, 0xF04668AD3EEB5C91, 0x5F70EFD0360A, 
-0x39A7C5F753DA96E2, 0x21348CB65549DF45, 0x1FBBA154F4FD7D02, 0xDC7EEC7E3D8F8770, 
-0x27D65C09398AB54, 0x3F354FFC0D57D06B, 0xB82ADBDFE8C23A6C, 0x5036BAEEEEB3662E, 
-0xA10741B0F813F6CF, 0xC5E22DF2622F004C, 0x335CD0A3CD748FDC, 0x672285AA5FA8, 
-0x6380FDB145C6C33D, 0xA9BE38FC187221CC, 0xE8E237F4D7F6F1FB, 0x77AAB4F81B6D0988, 
-0x51A120497B7F3517, 0xEC1280D373120BE2, 0xC83D1BE84E8AFD80, 0xEAA7F5F8A18BAAE9, 
-0x35C7A7AFBD65BAFC, 0xA01070E1D0F39915, 0x1F6842AE9977DDCA, 0x6E068568A9D1, 
-0x41469FD5A53834B9, 0xB36797E5840C3E8B, 0xA767BAE67F7780E6, 0xA5FBDE2EAA0B2919, 
-0x4177D2077B17020A, 0x1ABAFED52A884CFC, 0xC7632E22FD7C101D, 0x36D363BBCB7BCC57, 
-0x4D5339F35B6FBF0F, 0x56E2F1C6F6AA920C, 0xA37AE4D0C49A6691, 0x47370635D83C, 
-0x6F88B3A93ADF7F13, 0x72B83E51DED1E130, 0xC1E9AB4BA256B916, 0x4D06C5BD574E1AF, 
-0x3F7176DD0C9FB9E0, 0x67E6A22AB800FA58, 0x75B9AC8F06AE704, 0xEE182328B080A4C8, 
-0x458B8D15CDC5E3E, 0x96B2C03117F70A50, 0xB91BEDD7B1DE3602, 0x3D6923CAE91D, 
-0x873193304D79906D, 0xCE8283AAE0B6B503, 0x447F257BB39C9CF7, 0xD1590E88A83C1627, 
-0xCCFFC2EC6AE09279, 0xB40966167C4C6283, 0x1925D2BA3CF01912, 0xD2DF8A8E64050C82, 
-0x99F7ED64816CC163, 0x5DDD0DD67CD40D65, 0xAF708E104F50C68F, 0xD6930827FDA, 
-0xF673504D5401D735, 0x17B0E966AF388DF0, 0xFC5F361C54484FA9, 0xB76DF5377E794088, 
-0x7BFC24C7931B521D, 0x18A3C96A4B272898, 0x7B07C200A4AF5ADE, 0x6D1396B667697F07, 
-0x500269A1CF513641, 0xC1632F51F9F0453E, 0x3FA393D886FF68F6, 0xF7F00E6DB8, 
-0x427B42D2C4C180C5, 0xCEE3A7E0A36BE21, 0xEEEA74679A3C369D, 0x8AE71BAD197F89BC, 
-0xDC7931D29A21D0B1, 0xD83D7B0832A0C445, 0xD72BE5EC306042B7, 0x52B4D2B98249E916, 
-0xECE90A7D703E0CF0, 0x2FD4FF04969A4961, 0xC0D0234013C06552, 0x3C123EED76B8, 
-0x909197AD386D34F6, 0x241A21E083D7D28, 0x4129FE18E4AB5F91, 0xFD6D0D29E6EB975, 
-0x6EC0E797CA7E6578, 0x9D1EBE21D1F898FB, 0x8DC5C0A364DDC10, 0x4B41E95C707DC8F3, 
-0xB289F41AF4F3CFD2, 0x1E66DF73CADED6C9, 0x54CBF3AD8347063B, 0x60DB0E5B769F, 
-0x612D58CCC74EF61F, 0x5D829C38C471152F, 0x11E706FB30D7972B, 0x433D728358595740, 
-0x4E2F52090E071B80, 0xDEBC05576EDC84E6, 0xCB18217CD17B3146, 0x9E3835DFE7CF3FA2, 
-0x5E585F101DA0932B, 0xE2E49D12E330EFE2, 0x4FD8B3ADB394183F, 0x2E28085BD67A, 
-0x126037B7DC82BE8F, 0xE73AEBA6D05C2DAE, 0xCCC5A2DD4D9488BD, 0xE5731E5B2F0D3413, 
-0x1283FC3EEF6B2B94, 0xFB2836B1B5E50AC8, 0x127E432C9DE0727, 0x5CD8C10C76325FF, 
-0x9C5F543D0C7595E9, 0xB02E2EE7073710, 0xF390E434F6B17E83, 0x573C02E9DEF6, 
-0xF8154D656402D3D8, 0xC71631B6A746181C, 0xE2BB5C757478892D, 0x93630DA7487CD7C, 
-0xB27CD1AFC507C3CA, 0x57A2B6A919605E45, 0x21531C348523CBB6, 0xBFFC2E97FB05EDA4, 
-0x31459F30639C46F5, 0x3356F55CE6CC3574, 0xB797DA9F1BDB58E8, 0x13689D6DC4C0, 
-0x4B0A429B1C1A568A, 0x60AC16CF68895B0, 0x5C7543649C45021B, 0xF3DD7EE100C363F, 
-0xC28E230FAF4B0127, 0x38912A5FDE8A61A6, 0xB45963950C59ECFF, 0x9977CFE5B9AB3A78, 
-0x83BB94E201A5CD55, 0xE8D383987FF61126, 0x566FEF7709646A59, 0x1243B48CD565, 
-0x21BD976FBBD60BA3, 0x7AC51DF2170786A1, 0x1AB35477AD3E58B4, 0xC659266419AAC985, 
-0x7D2DC17C6C301931, 0x9F633990C4428E35, 0x42D97EA7E499420E, 0xDE2BB6CF2422C7A8, 
-0xB6F27A2E9C7FC81D, 0xF3CFA882E19C1B4C, 0x91D251984ECFC76, 0x34B9FE41ACE4, 
-0xE578433BB6902F66, 0xC84983D0F08BA6BF, 0x39CBCE584645D26B, 0xE9E4FD8FC7F047C1, 
-0x4436ADA5EE5FD4CA, 0x9F2C5BAE71B9C128, 0xF083516928DD9360, 0x7DBFA48C7ACC50CA, 
-0x42341490DDF1AE18, 0xB2CDDF3C7F1AAEB5, 0x84DFB6A7414AFE64, 0x6207A3916C38, 
-0xB51ADB4D014A9469, 0xE36BBB9EEF075C09, 0xF944AACDF9D9B622, 0x40B7E3D65B235EFD, 
-0x8E3E1F2773D44B9A, 0x27D58227DEF4FC31, 0x461012C50829E78C, 0xD35036A90EB6C40C, 
-0x9C538CE1BA5ED460, 0xC40C258B0D4FAF3C, 0x49AB8F63248B7196, 0x2A5A37197D21, 
-0x6267BC92E7FCD5A5, 0x81B3D36FDDEB79C1, 0xFC0DAF662B1487CA, 0x7395E814C81DF4E5, 
-0xD58C9E38554CE2C, 0xA546752332D72EF0, 0xC2EF25F13D7E20EE, 0x798EB10D1071FDF6, 
-0x5C2A854EBE255D9C, 0xAEA526E916B366CF, 0x500B45106E619815, 0x4A3DF5956154, 
-0xFC09099ED6E8D7EE, 0xB355142F68FFDE4C, 0x5C91970742FB1C7E, 0xB92A339F3EA745F5, 
-0x61303AD494B62D32, 0x29F53F470498734F, 0x56226183518B65E3, 0x60898E7A66816893, 
-0x43E7EFE68E856B0C, 0xD9AB377037BA251C, 0xD10E1B901828C7B8, 0x35910A94BC95, 
-0xCAF3843B9987F88D, 0xAEB88532B22A5, 0xE3BA8976818606A, 0x371D727808990735, 
-0xF747178AC57BC8FC, 0xF061AB89A6CC8BD2, 0xDC963BDF3AD83360, 0xAB42C51F3BFEF26B, 
-0xC1820D9CE8B0284A, 0x713944357511ADCF, 0xB1AF1C21D7725125, 0x337406DAB8E9, 
-0x22FDB7950EC8747A, 0xFFC2D818ACC3B21E, 0x56C5B40BE0A5C407, 0xCC214822CF982D14, 
-0xE2EC88F92505B7C7, 0x3243C28D30DA8E9, 0x8ADE7F20EEB4A19D, 0xF0CBB8FAAD0D222F, 
-0x43F6C8ACFB3F6C04, 0xA03D9DA23E6119AF, 0x90F5D174D1621C0, 0x518854DC79FA, 
-0x308AE429A6C06E14, 0x92387178C33AB945, 0x88DF08591D2D51FC, 0xFAFC2E213BBA7078, 
-0x70C9251E67AC1CEC, 0xA0D9BDE03BBC2FB9, 0xAA2EAF074256758D, 0xEADB73BD9D1F6405, 
-0x533A7FA297F36CDC, 0x2575B77CD3E7A7E9, 0xDC09273F778C4FFB, 0x6270AF45EA33, 
-0x9120582CD414ADDC, 0x478E357CC794F645, 0x7F2AE55A4507915F, 0xF9E9C2ADAE94FC90, 
-0x2EE9F8902F830D17, 0x6520FE2C9F2F042C, 0xB9B113956EB48146, 0x85A7F6D592DD53CC, 
-0x23B1F26878344E90, 0xB019EC8EB74AED11, 0x2DBFB10ADFC5684D, 0xE54D427CD2B, 
-0xDF6EFA85414E1838, 0xD54135C9C617B672, 0x193E08B49C52C04D, 0x823C8A533FAB8D28, 
-0xA2143988D62C459, 0x6A1D9A084246530, 0x61F3387CBD91B1D1, 0xF56012E6C47D2513, 
-0x7954567F37A73265, 0x5FF5672F9FD97C61, 0x33E8E77F669742DA, 0x409403E13816, 
-0xFCA3FB4D3AC03080, 0xC4B7DAD73D481EF4, 0x324EC7D97AB8B010, 0xE488AECDE96F7884, 
-0x9324FCE0F39DF11F, 0x61E0F1CB70F536E8, 0xD74EB77E7F438B5D, 0x1AFA03743899D1C, 
-0xAFB94F1EC5587C72, 0xB8C5F9EC7E10E9BF, 0xE0E8B531981FF93D, 0x3C19F7FEA52F, 
-0x1AE7A656F531768E, 0xC2F16F844136B0AB, 0xFD45DB52E98BE056, 0xB7640D1A6A923F09, 
-0x96124873CE617DE4, 0xCC8999CC30479C5, 0xDCEB69508450B666, 0x4A2938C37060932C, 
-0x6E4E8E1CAEA4BF02, 0x4EF9180C9C1310A6, 0xED1D4A7F8BDDEB13, 0x2026174437DB, 
-0xEE37DD300FC2522F, 0xD98071DF317FAC14, 0x733E6B902B82824B, 0x80B2CDF7A4316CED, 
-0xC8A2CE8C100D4C0B, 0x936039FD36EA4300, 0xA62BB8F39A3A36F9, 0xB650C320AB8B0488, 
-0x3D8D5640A3F672CA, 0x36686ED85DFAB4F, 0x784C5E5773166718, 0x143C67EB64E0, 
-0x681985EE578B17F2, 0xF0E3618F4DA1E586, 0x1F0001D78E6B2B2C, 0xD3484B039A81451D, 
-0xBDA357C764E4CD7B, 0x3C8863F578FB6043, 0x1231FD118789158E, 0x51AA3BFAC201252A, 
-0xC0A976B869A810C0, 0x65C8D259BC0D68A1, 0x6D9568ED37010776, 0x72ED0ED5904, 
-0x72B28B6F7E1BF9CC, 0xCB55F76821A29C5A, 0x420663C36D2A4183, 0x87F65E0FCB0FB277, 
-0xE0A46B77C92CC322, 0x20D710DC48FE226, 0xDB8DFB5EB550FC0A, 0xC75AE39381CEDD79, 
-0x773CFCAE9E08996, 0xEBFDA8876AC21445, 0xFDE60CF4EDB47B83, 0x4E4DB3E799D3, 
-0x4E81F891FD63D911, 0xA741137221E50933, 0xA722487253D288FF, 0x54ACB1F0842E6768, 
-0xBF2ADBEBB2F8AF42, 0x90149E59B076AACF, 0xCCC630AA26502591, 0x6A41917F7C2342B5, 
-0xF33BB7BDF72FF0AD, 0x18D448811594A90F, 0x3BF8427C2319E2C3, 0x21C1E6B20C7C, 
-0x2A73B08D5F2E610B, 0x4C9BEEB4DC7BE9DF, 0x554178A87027EFA5, 0x561B70F9B5C96348, 
-0xA19F39AA70166894, 0x3E80CDDA2D77AB2C, 0xB2FA4A238846C3C1, 0x6F7D2F4096D7E544, 
-0x124C3F1FAEA802A6, 0xD6894FC8597C95A6, 0x6BF2CE04B31950AF, 0x276E067CD7BB, 
-0x76001E8DFF24E46B, 0xFE22F9C7EB5104B8, 0xAEC4664C5EEABD1D, 0x74172D25FF93A576, 
-0x9F5C781CE2150732, 0xF2409258E7AFE9A, 0xD032364E8B5B49CF, 0x2E4D11C903C0C631, 
-0xBD61E89BD7E07630, 0xCB7CAED727ACBD0C, 0xDBD4746D238B7BC7, 0x6DB9ADBB5BA1, 
-0x8560B657E2986A8B, 0x6C962A4C03D297F4, 0xC9B23CD27CE43BAA, 0xDA37BE1F694D694D, 
-0x38CAF2D89329C183, 0xB0C9703657BA8601, 0x3B2A39C62ECE28EA, 0x4BD6325EC4240C0F, 
-0xE7A01481D1A1E7E4, 0x4F72E2338CB95F74, 0x8326416EF48FD45A, 0x6790C8B676F2, 
-0xA66A3D5E57A6AC7D, 0xE6E83277ECCA6DB0, 0xE697155F8C4F5304, 0xD387B798E84BEDAB, 
-0xB91171E830F3FACB, 0xA89B397471D31393, 0x3C4B4F0A763F911D, 0xBBF2FC77F28BDE35, 
-0x81BE3F4C9EACB4D8, 0x8D6073580CA5135D, 0xC90FADE6D128FB9D, 0x5C000A38C272, 
-0x4CA7FFF260FE205E, 0xC50AF479A3A099E9, 0x8207B2E0266C32BC, 0x45D4C61C95AAFBE0, 
-0x19D15394C13E1FCB, 0xE50A60B303B0A983, 0x10A7127FAE04CCDC, 0x1C40402B39E0E0DD, 
-0xEB0549688BBDD3AE, 0x99E8E8FDC9F6B0F8, 0x35367C284E2577B2, 0x41A90ACC0F4B, 
-0xB07CD877943AAF48, 0xAFC184E76A1E2006, 0xB8FD4C987CF96C64, 0xF7C71F4B4008C49E, 
-0x9261931BFEF57FC9, 0x496A0C13BE528690, 0x60EBEC34BE5BB11E, 0x9A6663300E92C1C3, 
-0x70B902CA85B228B2, 0x83BB42ED07BD3815, 0x29497DB7566F983A, 0x7DB50B3B71B, 
-0xB6BE5DD7CDA70A69, 0x5D4EB5F2B50CC12B, 0xBDC3528931DA50D8, 0x5F3A56F1708C5E6, 
-0x2A2D6E3ADA5DBB6F, 0x7F61DA4999B94611, 0x41E6C5DFC9481FE, 0xCB929DB1E0BE0951, 
-0x5140E09213D96954, 0xE831A0CD959065AC, 0x5E907211733F48A4, 0x5925B28C95BC, 
-0x816D46F0B1B3ED9A, 0x6C204B7924BCD4DC, 0xC00990E8C968BB89, 0x1B7B77AAC2506EF1, 
-0xEF2ACDDB3350B8FA, 0x92388F8110098EBE, 0x2A7348C224A4393A, 0x2A1FFB53A6079AA5, 
-0x37C2C090E36AEF96, 0xBA82DDFF5D789BD8, 0x61A97BBC187C8A1D, 0x398217BFC501, 
-0x8B3F4D693ABF96F2, 0x6D1C76D00D4A4652, 0x91D9C86E1F21650B, 0x1D92901DF064C416, 
-0x862244CE926DA464, 0x3A02E9215D854159, 0xB0FB48E8A3510446, 0x60B7EA6AFFCDF85F, 
-0x564A14F309CD30B4, 0xE08BDA8CE7B8FB9E, 0x95BECED29282B5D6, 0x2D804BC3B29F, 
-0x5D2D8F35999A5FF9, 0xABEDD4AE6CF958F5, 0xA6AB3A758480D00F, 0x540B7C85A7E2ABC, 
-0xF7B99C045B8B8DAB, 0xFF9FD874BC68263B, 0xC83920ACC3D4201B, 0xF2095CB648DA8D9, 
-0x379F653765B9E593, 0x7EB4D52B956F4795, 0x3CF88CFE73855C90, 0x10C035B09789, 
-0x13F830620D0836CD, 0xF087CD72CBAEE365, 0x167F8F3F1268955F, 0x53523247401D36D8, 
-0x4B193A512926A9C5, 0xB6BD0BFA49964EE5, 0x2B7CE66F7294A5AB, 0x1F3B08EB054E1C64, 
-0x16460D1BE0FDA33D, 0x45C514073BCBDFC9, 0x635C53E788BB23AB, 0x2A2BABC619FA, 
-0x978971D016BF81A7, 0x497D5D23158E566, 0x99E0C697933B76B5, 0xE594475422DE7437, 
-0x5A7CC5B30766AC3, 0xF703D3EAB5440E80, 0xB06DFB180F46C12D, 0x16F2C2CD96146067, 
-0x38001E3EA83C6077, 0xF67EFEA84F005F4C, 0x917A3AD9EA14CB74, 0x66D2197BE1A9, 
-0xB6A37CD271C02679, 0xB7BFAAE497BC6850, 0xE01D31F616331310, 0x31F06940130C1052, 
-0x3BAABCB79FD30FF5, 0x8678C8C578C04CD3, 0x536D9C4CEB4B80A6, 0x15617ABDA8F183D8, 
-0x4920F8483670459F, 0xE7317D4A3E041D82, 0x4CE77E0A2B20105C, 0x49F93270D3B1, 
-0xD28F0A5902CA05A1, 0x191105B288BB4F8, 0xF2B93AE6FA04809B, 0x609AD6399BA42E74, 
-0x6BE0D0497E4E39ED, 0xF247692D49C7A982, 0x68161CBB6E2452A8, 0x12209355CE37657B, 
-0x7A5585D3FD88ABB3, 0xAA1BE16D2943702F, 0x69957E2AD87F4819, 0x27FC1F0E2191, 
-0x491D236A8F5BB37D, 0x506CB049DA1697D2, 0x464175A6BDEF259F, 0xF7CB4A777CF7863, 
-0x7B0F39E42902F94C, 0x1FD4A7947C0DE4BC, 0xB95A0CB1178B9145, 0xA35A0AF03A7933E6, 
-0x15D678017FDF488, 0xAC11AD98CCE8BF41, 0x389D04566394F8A6, 0x3471395687FA, 
-0x8E8DD9B5C4DB3FD6, 0xC25062BA8D4884D9, 0x57071324FE91AA35, 0x8268357BC07DC570, 
-0x748BB1DCB57B59C4, 0xA96E5E52BC86FE69, 0x10EA00FEC6FF3BD9, 0xA9FE09D74017ACDA, 
-0x99AFC920F5A8F587, 0xA8332AB08742F760, 0xA0A9168F618AD348, 0x44F44AACEF83, 
-0x85384927283DC843, 0x81875C6939164773, 0x1F3F1C7884F4C559, 0x801C964702D8A001, 
-0x542170DE44F2A3DE, 0xA9BBF129B9E0554F, 0xDBDB1916ABD22BF5, 0xCE5189D9685A1C95, 
-0xD07754954FAD3AA, 0x37AE4A3EC96532E8, 0x7C5AB51F7F772F4E, 0x267F26FDCC78, 
-0xBE11333043247B4F, 0xDBBF099D0961DCDA, 0xF94BA2DD39EC1DC6, 0x40960D66AD14EEB4, 
-0x4D5B3AE46976F699, 0x4A0D6762F670B2E3, 0x92D7A0F76573FE20, 0xFB1091701B815269, 
-0x73BFDB786ED9E64E, 0x40639E1A124BEA5A, 0xC262F6A4D9E9F5E4, 0x573D871ECEAD, 
-0x7899DB38CE366B87, 0xE6AE9C2E2F67AFFB, 0x8690EF6E4262401A, 0x617EFD24FF616930, 
-0xCCA272A0C5033E3, 0x3D2FA38EEA5A15CD, 0x7DFC22D7AA3FD782, 0xB6AF328458F74ABB, 
-0x114678ED8DA30DF, 0x501492E42CEA3EDA, 0xDB039D1B7F6B3499, 0x4AFEF935807B, 
-0x2695707C44405820, 0xFCC9E56F7264A955, 0xC30AEBEEB270FB58, 0xAFC6C355B9167BAA, 
-0x44EF259B8C52168F, 0x1EC05FD5F59F2799, 0x80B75CF897F5700B, 0x556E4C6F33FA1D06, 
-0xC3C25939790D3966, 0xD8F75157FBF8CFC, 0xA65E4B3796649B65, 0x65C9BD61AFBF, 
-0x5D9D808E5AD9FB58, 0x43DA83E4C09D6BCF, 0x21B321A210EB78AE, 0xD0C60748CC4F03CF, 
-0x884874B2458EDB36, 0x10B2333C34E65B, 0x39F1CA38E430BD9, 0x3A320258B368EEA0, 
-0x4400142C3F6843CE, 0x3085115CE72F700A, 0x56AB6B0F57209A40, 0x3ACDB7B21B42, 
-0x3FB693A8D2EBC354, 0x389EA9FE4DCEBE51, 0x41D81D4E544AED29, 0xAC5892285C989321, 
-0xC9E5A8B40B696A6A, 0x295C575F49C63A55, 0x7FC5544C130A6190, 0x4D98199A9837944C, 
-0xDCC01A62F4A947D1, 0xAB1F9B42C2E2BD42, 0x4486D8F036235E54, 0x6EC579A06D6B, 
-0x7E751DB16E472A5A, 0x50FE31F9720804CA, 0xA9E89B72372BD886, 0xD30AC56AF74C2E58, 
-0xD291A09F3A99FE12, 0xEE8EA6930E681AAD, 0x801EA6F1417C22F6, 0x2B1FC0BBC3B08715, 
-0x66030C0E85194A6, 0x613D3C1663709283, 0x5576BB5515AFA4AE, 0x585F2F17FA02, 
-0xE288511C93FA0028, 0x1B0B601E0DE00997, 0xAAB612ACD0EAE0A6, 0x3F2803E6BFD86943, 
-0x6CE11281D052D07C, 0x9133CFDE6F3743A2, 0x3012769897E2D6BB, 0x5E727614E5E5202, 
-0x48CE3FCB210899C5, 0x34E84D9240CA2386, 0x2E2FDD3FEB48E80D, 0x366D3B394A68, 
-0x4DE7E498F1880EF, 0x36384191819F9190, 0x2121B3F2956734D, 0xBE67B4A81CAB8B02, 
-0xC965C5D7911ADEC6, 0x561FDFCDDA640D7B, 0xA49AD4DBAEEAFFBB, 0xB7672747C0B503BD, 
-0x3C2CF502AF2A2A89, 0xE3651DCB472E2DD7, 0x7D1FD03B3FB0E6B3, 0x3BD51392E49A, 
-0x3735B35C3F8CD852, 0xEE30EAF45CCBFA22, 0xDEAAB55E92F43669, 0x96E5F9145DF0DE6E, 
-0x498864E94ACDAC04, 0xA7C07BB46418387B, 0x6490203C795DB8C2, 0xDB527561C5840456, 
-0x5EAF17169C984067, 0xEB1984A93D96C64D, 0x312CDBDB8D14A4E4, 0x4AC0DA1C4DBF, 
-0x38AFE675B2F305B7, 0x1D99AEB7C46575FA, 0x5868876339C3D8D9, 0x3AE36739E95DBC, 
-0xF504B3A023D4DE40, 0xEB8C73ECC037C1D6, 0xD9679F92C617303F, 0xF6189F36D8F2FAA5, 
-0x347B4E256B79D25D, 0x8A806C9E8E800BC8, 0x4DCD2DFA02B81D62, 0x36139336EF88, 
-0x673A51DCB4D8208E, 0x83023F11D3F12482, 0xDE002C16FE2FB70, 0x8B63F14AC6190309, 
-0xD9A4C4474D62ED84, 0x9F3FA6AEA83A38D5, 0x133B9B30F2C48172, 0xDB3E72FCBB2791AF, 
-0xF352FBABA7BCDB15, 0xDBF190923AD66D7C, 0x4433186D924067B8, 0x6731D2490E78, 
-0xBB32A7861833741, 0xD2D3277755B8921B, 0xDDF20AF6FACEEDF5, 0x3B841C0E7012456C, 
-0x9A3FD824FFD95518, 0x1701D0FAC96B0CA2, 0x1EAB56DB4135E099, 0xAEA4BB0A57DD5292, 
-0xBB9DB170AC28FE6C, 0x4AFFF07297E7CAFC, 0xC33CE73481261BBB, 0x3142AFC99413, 
-0x57822E3EAAAA8928, 0xD36AA4166F6CE1B8, 0x316114BCAF856B0D, 0xEBAE88B4F4451605, 
-0x13D277789FE8996F, 0xC01523583CD6C0F8, 0x351F90FB7F7E10B1, 0xCDC9791029C7AB8, 
-0x17FCB1F00FAF4D11, 0xFF3F120B175F0E85, 0x1D1A6A4C5C63D5A1, 0x2AE926674A15, 
-0x515584D2342DFBEB, 0x5C1C017316C4AF74, 0xCB30B3BD0A0C8665, 0x9AA81BE2E0E4E429, 
-0x7AAAFDB990309782, 0x9696122A4AD0CA53, 0xE5A0A3C8CF2C1FF7, 0x661B8EE683A75CDF, 
-0x82D4C448B121FA86, 0xB2272DF310DF561F, 0xB6283456D177EBB6, 0x4C98246B705D, 
-0x9971B15BD13EB2D5, 0x62CC94BE79F6E9FE, 0x2AE5F6353A14F4F2, 0x5EE12BC7E9C236B, 
-0xBBD565B1BE683D9, 0x74E94257CE0105C3, 0x9E7ACF8F621B626A, 0xA5AE8467CA308835, 
-0xA0AE7006B513DC5D, 0x208A5F2C71D7B575, 0x1EF0BAEB19138C66, 0x415485D2E3B2, 
-0xD15EDFE877C08005, 0xA27F90C0BEA209A1, 0xFF58846647265EAF, 0x392795CDCC055348, 
-0xFF78DDD86B5DC541, 0x619626466E6C0478, 0x959BE17671123EDA, 0xC9C63667BB2FE7E2, 
-0x968EB8FA3C2D31A0, 0x16C65E055BFABDA4, 0x79E9CED3DFD688B8, 0x3DADBF3355B, 
-0x2D70F2D2A1976939, 0x7786858A86852A32, 0x2C1B9A38D72F1E20, 0x6C7D79D261F3A485, 
-0x576CE52B74BEBACA, 0xA2855263F127DE84, 0xCFDA8D73700A19A, 0xC5704F8AB30BFD7F, 
-0xDD76DC624260E02C, 0xF7A1629617C13CDF, 0x494715C54A1525B0, 0x22E8F507EDFB, 
-0x98D695213298E09B, 0x5D7324CE8554C1B6, 0x19D4E65DFC50931B, 0x5ACBD11B54688E8B, 
-0x6BC7327B922BCC2E, 0x4DF40D5BDCEA1954, 0xF1DF7323CB3EF0EB, 0xF78FE01800D75FE7, 
-0x9BE654F079C65E91, 0x4D8E47E188F678D4, 0xC303A8909CF71CD9, 0x3EA07BCC8CD4, 
-0xAE9265DAAC2A543E, 0xC2C7C98BCA34A30, 0xEAB73DC6A562A817, 0xEF75ED6361BD10BF, 
-0x40F997A06C66142D, 0xA7E614EAF73C447A, 0x7EB598FA672B46D, 0x8AC444135B21908C, 
-0xFB4DD5F1D77A5844, 0xA726414080E9380B, 0x6EEB93BB0524082D, 0x14C79DE4B02C, 
-0x27528DD804B81BA2, 0xC9408B862EB2BB89, 0x73A4E2E1695CE5DF, 0x6C270DFD693DDAE7, 
-0x80A8EDC52B14F092, 0x77A84918A7E2DCB, 0x76A6995FD4370B6C, 0x96455CE708E57359, 
-0x36B4BEF9A22B292C, 0xBFC096A07566CA82, 0x2F51A73F8C049617, 0x14E082EA228E, 
-0x4B41BAFE45CA7FF6, 0xE185949653C82374, 0xE2999DAB23BCB2A4, 0xD30705D6840924E9, 
-0x20520F653AA783D5, 0x5BBF9784F3CB3141, 0xB99C4D95DABDD366, 0x4C4183235567591, 
-0xE9B60DA36113B8FC, 0x14561C0C78D3A6D, 0xD633E16FA3823A28, 0x34BD06F103BF, 
-0x4450F8E1EB223487, 0x124F58AA9FED6C2B, 0xAC72B8A74C9DC4B3, 0x1589086DC3F7249C, 
-0x371CD014F7D56F1D, 0xBE4A80E81F620AC6, 0xA03ADCA410225212, 0x53E32DE30C5472F8, 
-0x70E55E059F802497, 0xA398E50413AF33D8, 0x66109FD247AB3443, 0x507F33ACAC5D, 
-0x3C089121530FF09C, 0xB1EE103783FDFB9C, 0x34178787989964F9, 0xEB9FB448EA26F50A, 
-0xBF26A6BE41BEDFFA, 0x84DBC37E3FA5326, 0x782434B21A0B68D9, 0x67A473A5D1AF822E, 
-0x9B487E8FB29C903, 0x49ED5A9E0AEC3F0F, 0xBFCA4CEEA73F64D9, 0x186A64D5B909, 
-0xB6D6D5A589319878, 0x62C8BE8EC8234329, 0x4634C8B5AE4C419F, 0x4F6FA991042D0F70, 
-0x4E5603AE1EFBC96F, 0xCC092C7D5CF5593, 0xD9B596C8C220C3D2, 0x6D17D3338BB41916, 
-0x3BC6ED232FF62DE7, 0xE9AE9EBCBCD5F3B3, 0xF91413EA25ECC19D, 0x362BF8452966, 
-0x76ED037E189816A2, 0x85CFE5B44EE2271, 0xD5AC4BAA91A58455, 0x5412FEA8E12CD960, 
-0xE44B15E3D5D1A690, 0xC17CC778DD0F6C32, 0x32579696551C6B94, 0x5C9264CD81D431B8, 
-0x6FA341F911DFF66B, 0xD6F8CC0330465926, 0xC404DE78FFE8DA22, 0x247CD0D49185, 
-0xB290A30EC5815CD2, 0x6882DC04C46DE18F, 0xF86B512B7BDD45EA, 0x162EE5EF42312733, 
-0xB18AADD23DD1A492, 0x3E57A7C1C77AA605, 0x7541504E92F55EC9, 0xD3A95828A726A2C6, 
-0x5F6191DA6EAC46FC, 0xE4B012586200018F, 0x4428831A9872BC97, 0x5FFB907C508E, 
-0x22D57267513D985C, 0x8D7F7057719760D7, 0xD1B0B414DC150D5C, 0xED57147B9E02C584, 
-0x4F07E42A99DDE56, 0xCC3283D2739857BC, 0x19035E9168C86F51, 0x7AF6673B8597EF9E, 
-0x8CDDDE6EB36C9B29, 0x4387A0567A347E54, 0x35BFE51D2AA894C9, 0x58F2C626A972, 
-0xAABB3AD1B54DED6E, 0x90FDBF97FAA5EFF5, 0xB1665FA7DC260907, 0x1CFC149E56BB6FA1, 
-0x1317D361E3B82110, 0xC92F94E82A6E799E, 0x290E2CFC151589B2, 0xCD468158134EE82A, 
-0x9557133D564B84E5, 0x390648F5E837BB7C, 0x57B480A75D2F8A19, 0x115D0FA7FB15, 
-0x5054CA9C93E84F24, 0x9A96F3DDC8C3779F, 0xB85804A095B4E4BC, 0x91B3897091A7827D, 
-0x28A84B3666336D24, 0xBF11A21CBB26294E, 0xABB36329E21FB758, 0xB94BA7317661E90A, 
-0xF502758FC9566725, 0x4D79BBD68112137, 0xD39469F859AAD7C, 0x6D99B74F70A2, 
-0xD29C31343A523690, 0x6208C18376CD57D5, 0xD88C3249BCC33099, 0xB448C364DC649C6, 
-0x92EFF83E268E252F, 0x785E3D7C9C62D482, 0xA0CB3F2A10BF48F5, 0x6614D43F3812CFE5, 
-0xF3D5609B5B80B775, 0x30BC07FE31215B3D, 0xEA71E4A8D799F091, 0x62FD7CB51CF5, 
-0xADB77FE82A3F3720, 0x96AB7CBECD552954, 0x767D6A01E17D457E, 0x40AD418EF40C9E84, 
-0xB651129C86F2BBA2, 0xC29CD9E60412C1D4, 0x3A7241B3AB4DA244, 0xA606BAFE0DA9CF6F, 
-0x85C8FAA580BB0619, 0x6461324A4AFC0B5B, 0xC0D499434B4766AA, 0x6FC99F89F7CC, 
-0xAD3994142ECE27E2, 0x1C51852A13E0F8BF, 0x9954A1FF3FCD40B6, 0x880C9CCA670E70C0, 
-0x2B1173FA69171427, 0x7021D33C11BC7D5C, 0x3FAE4B6391D778FC, 0x6A6684EC327C3825, 
-0x2726D9A870BD81E4, 0xEB5A6FC1233F8676, 0xEC4BA10FCE42F4A8, 0x1A4946CFA44A, 
-0x3DFF95BCE7AADD3, 0x3D0AA39F8D8130D1, 0x3C8933AD4803FC25, 0x6B001DFCD939A14E, 
-0x1E868B4DD80BEFF8, 0x66ACD62A212AA1FD, 0xC0DC0D32F44CAAE7, 0xEF027E22FD176898, 
-0x2536765F9CDF5475, 0xCB8958B4A840DAC3, 0x1898FF45F10B765C, 0xAA2908B8D0A, 
-0x7BC4546FD4423429, 0xE48ACBCBB220C6A1, 0x4AD83E5D9FDE8BA0, 0x51E035C6E3FA7ECB, 
-0xA902F880ADEEAAB0, 0x4DB00F06CDDE01DC, 0xE33E3E9B69496CF6, 0x6E90481F3DA521EB, 
-0xCC06C36FBBEA8367, 0xD2DC0FB8022D290A, 0xE73B7E57E2EBD5B9, 0x4E79407DCA2B, 
-0x1173DE8E65D5D8E6, 0xE21C945BC2140488, 0xCD780583E5A32E96, 0xC257BAD47657E851, 
-0xFC6178C6D6F7F811, 0xEFF29D71DF3B76FF, 0x511291F6543CBA6E, 0xC8F14CE3172D4513, 
-0xEE7DEB3BDF4179C4, 0x35645858787FA13B, 0xF8D6F96C5C7CE050, 0x5F7CE8038D18, 
-0xD43C9C1DB0BBBAAF, 0x4F2882CC8DB6ACAC, 0x2BCD859E418AD517, 0x2E09C15F40834D0, 
-0xD9B0A12328747FC1, 0xE13A520D247F89E4, 0x8BE71ACDD471D4B7, 0xFA72F79900D5979F, 
-0x30FA2CB71BF7297E, 0x28AC973B77598104, 0x246054F6961726B9, 0x4A6E87FFA004, 
-0x6CA5C0EE7023008C, 0x21F82B9F3990B243, 0x18DB73A77C214D99, 0x8795B162C6E4760E, 
-0x653F04DC012081E1, 0x48A69BF1EA984CCB, 0x620C8BAC8BE04AF1, 0xA496040B5CFF1882, 
-0xC026003E1EECBD31, 0x5A2498371EB1DA0F, 0xCCE89A69F650C659, 0x571E250FC1AD, 
-0xD7BB697271AB50D7, 0x7C961F4D7465DCC, 0x5C9444F1C84EE403, 0x8A922A0D25114586, 
-0x499C7AB62EE013F6, 0x6FB80A9F3904D2B5, 0x94BBC4618CCDF150, 0xFF70766507E83630, 
-0xE664D461E333BC33, 0xE0BE911F5E0C90EF, 0xFC90915C36A80E0, 0x38ECFBBC46EC, 
-0x49812D38006D0F06, 0x9D65E48761A7B5FF, 0xA98D40ABE7A6FDDC, 0xCFD1C44A60D0ABCE, 
-0xB6885186D1F17BD6, 0xBC9D6B2A0C8260AB, 0xEAB476CEAE2DD82, 0x673E00C70E04E26C, 
-0xE0EFC56F12D70554, 0xBA2FC3B910A031D5, 0x9E0C9E9FD2C5019C, 0x6A27E62F68FC, 
-0x4D3C8A9C168ABDA1, 0x3F3DED9EB7687E03, 0x384A3683B93E80A, 0x6EA039B42AD18D1D, 
-0x53EB4AF44B9FEB41, 0x8E5EFA3B3A611D45, 0xC2CCC21AEB22DA61, 0x939C7AB524C2B37, 
-0xB982A5DA707D3CC4, 0xB6F7D6305A346987, 0xE766B2D3B0DDBB28, 0xEBE40377879, 
-0x76308560F226A5E7, 0xCF90341B5E0E12B7, 0xBC231FE73E0610A7, 0xF301D1BEC99100C8, 
-0x3332E990F65ACD10, 0xE9D3577A0C43E942, 0xD16F553864824A04, 0xBB45BA7BBA2E4984, 
-0xAB76889BA7222BD4, 0xF5A790822D77A812, 0x591BEB5353CA4851, 0x38EECC6BD868, 
-0xB9E6055204B0CF53, 0xE64DA173B94250B4, 0x9074614282EF1E38, 0x845029FC0FE8EE88, 
-0x9C057FFAC1CBBD4E, 0x9A04C71E979B059A, 0x683A960624078209, 0x357817E8FE9E204C, 
-0x589429481FFFD151, 0xCB078E7022D86C29, 0xD673377FE0FE52B1, 0x51CFDC702DB6, 
-0x6724EC3835D69F3, 0xD9FB74A8A9BD05CE, 0x8DE87E5BFF7BA2CA, 0xA1B1298B69F17170, 
-0xEAF561EAF7D0A59, 0x753A0EDA97EBDC7C, 0xCD3E0385473F5891, 0xB1319A897D20B2F2, 
-0x3E4D957BDED7DF65, 0x200252BC34E0C428, 0xE3A740E45B7EDEEA, 0x1328D91FDF23, 
-0x4A00896205E42A78, 0x2E7AB069FA3E5528, 0xDF192F18F462EB92, 0x989D9ACEF268CA82, 
-0x17CB812BCBB6944B, 0x49C96DFA655491A1, 0x7AF0BE3A74C71ED8, 0x6953C688359A389C, 
-0x4FF14E318E1F427E, 0xC8A5123644AC095D, 0xF9F0B2C8A1EDAD07, 0x1EDB5A9BC325, 
-0x245AA7D8F7CB58A1, 0xC20B6D1A5D2A6B88, 0x27ACE48106911AC1, 0x9EE4101E0A5EFBB8, 
-0xBA55E40AEECD543D, 0x3668149F25DD6158, 0xB84EE938ACC3FD6, 0x56D5C40903C35D90, 
-0xC1740A5D8E7F9637, 0xF2C61A86CF31BB6A, 0xD7AB9B9ADC8B5562, 0x46FC2C4F4040, 
-0xC84B233DAADFD510, 0x1007E3CF0486859D, 0x9D8633A4DC15A239, 0xE86B16B27A980A74, 
-0xBD5F0F793542E0FC, 0x910ADF4A239DFD24, 0xE8BA880308EB97F7, 0x9AEF2CB42EA251C1, 
-0xA63881F704D7B23C, 0xFA7B98CC15ED57FB, 0x6EB3FA054D0D2731, 0x5617F8578017, 
-0xA04E2E1061CDFB5F, 0x4F947CC1DA146CD8, 0x36790FDBA33F4020, 0xFCEE3A2732B92927, 
-0x70A2BE840CA75BBE, 0x8446E8D33F23FB1D, 0x281A2FE12AAC62B5, 0x75EE7F2E45A79022, 
-0x55BE7BC56F02C659, 0x3949FA6E8605EE54, 0xFA49F348E45DCCC4, 0x38EA4ADAF6A8, 
-0x2DD0BB5440167787, 0xCDEB2F75EC6056B5, 0x7E900BC3843191E3, 0xAEA9718F71352C02, 
-0x508A62BA304663FC, 0x2E0A783826AFEDB1, 0x3158C32EA8DDE50F, 0xDC5E48AC42EF8CAD, 
-0x51094EE4B3728FE7, 0x6AD5EE92EB5F523A, 0x59B21A5206671804, 0x3425E5BEF1B, 
-0x51C0731F6F4A2417, 0x70DD9548FAC9A3E0, 0xE307568154573BFA, 0x1D58F46C4342B574, 
-0x5E190B296C2CF3D6, 0x1128EA396401624E, 0x4032E3F5D358149A, 0x4116FCBEDA7646B1, 
-0x17A545115DE24A87, 0xAC838F01FA198507, 0xBBEB23A3F186AEEE, 0x30650ED5EFB0, 
-0xDF9F25995FC05266, 0x5E73DB8E870EE67A, 0x95B603ACD9B7F0E1, 0xAF3051A003501422, 
-0xCC2B8F5F8367B383, 0x9A7235E9BBB74998, 0x79391BE145DE249A, 0xB3597B593D3D37F8, 
-0x414CA6CCD4551F1A, 0xD291168D13E7CA0F, 0xB4785D166F1B15A9, 0x645ADC590D65, 
-0x1FD263B450FD45CE, 0xF29464636A1B98E8, 0xC5BAA32E90A111AD, 0x660563E2EEB0BBB, 
-0xB6F3C068E659ECCD, 0x24A1A319B1CD8B24, 0x4A70FECC767A6E90, 0x59D65C69B98FAACD, 
-0xE14438A77CD407A7, 0xCF591B4CCFE05710, 0xEAD303089B3C5CD4, 0x14B2366677EC, 
-0x83D3AB6CB419DCD4, 0xD0B2C9392418C805, 0x5A71D431AF3A8312, 0x4118E9E5093EEEC3, 
-0x35E84F9BBC5C66CC, 0x56DF69F7EE6BE715, 0xBF48CE3D13C4C81, 0x8B402CFB7C211D3F, 
-0x39D7DBDCF28E3025, 0xEEA194E4C3AB60EA, 0x4214BE195EF08E87, 0x5F26EE93982F, 
-0x6889D1993E9203C0, 0xF3745F3F3C196469, 0x465080CD3D5A8A5F, 0xACB9E6E48C709106, 
-0x2814CEB61961FE68, 0x49EE0FE4901B1B69, 0x86CAB4FDC28261E9, 0x69750FD18D3A32A, 
-0x6DC55030D800BDAC, 0xF591E62DD2AC28BA, 0x9FB33324446DCE29, 0x57172C31A969, 
-0x923C7CC190F1F81F, 0x6B4E5F8099B3603C, 0x4D70F1739556E1D9, 0x5DD37662FFB77514, 
-0x2CD03F99F54998A, 0x639983B35A73E4F1, 0x55CCB6D6CAAB7BB4, 0xA1DA7841CCD38093, 
-0x393D26D4D1DB6614, 0xAC7129B826C32BC3, 0x34561590A841E519, 0x5451308B65C, 
-0xD8C3F993FC8E5F8A, 0x377816C607AF1FB0, 0xDB5AAA017F4D69A2, 0x2A147AAE0E9996D5, 
-0xF215CBE1DD23650, 0x74FEEBC67A271B6B, 0x6D52E94BDAB3877A, 0xA6D6A9E4AF984A48, 
-0xF2FA486CADDFC1C6, 0x54A64C91E5BFBA6C, 0x92A6796922F88D07, 0x36B2281D4FD4, 
-0xD32D80EB97603917, 0x11B2B7E842E2BD9D, 0x5E3FA38663B79F88, 0xDFA96D009D17741E, 
-0x61BA116DE6822F31, 0xA51B79E3234D889B, 0x34EF4C615C36BF4B, 0xB77CDA1030F441B4, 
-0x6F0F8098F26DA0A9, 0x13A6E5EF73CD7C70, 0x7C6BD4DDB47E0851, 0x340F390BCC32, 
-0x95848B5433325941, 0x9B74F16FA02F8C2F, 0xDD598C9686B1AC72, 0x54E7820977FD2474, 
-0x38D6D778453C7B70, 0x503183787D18E6E3, 0xD838A32F51F12723, 0xC558B9713C5AB368, 
-0xA4945E120C027B8C, 0x177648FA94C739EB, 0x871166E80192CABD, 0xD79DF5150C7, 
-0xA7BAFBFB3008779C, 0xCD61DC0C71FE58D4, 0xC213CE8A8AD634A0, 0x8E043AECD36D0B2F, 
-0xBD741400F8CC3BF3, 0x72CF186B72B29BD1, 0x797EAD9116254E6A, 0xBD9F00B34750FC2F, 
-0xCCECB9D691026588, 0x3D236B8313FC4D40, 0x15DB1D10862EB9A, 0x5721E90F3731, 
-0xDE727DED3231BBDD, 0x2939BFAE03974171, 0xC68F3BC62E59557A, 0x1D8CB21B610406A2, 
-0x482B149D5B2CCB6E, 0x519438A007A2AE2C, 0x14C78AD31D47CF43, 0xA99CCDD87B96C362, 
-0x7A2A698448B74AC5, 0xA261B84B9E47797F, 0x3C56BFE7ED6C4676, 0xBD4E362D2B7, 
-0x44E951F91D6F4063, 0x7BDDC8E9D663C6AC, 0x91EA65F85F599336, 0xB61CCE2E5827C681, 
-0xBBCBBD9560D59429, 0x276DAE8F73C4B3E0, 0xB3D322512E1E61BC, 0x11B6299802279A71, 
-0x96FF8EF969961151, 0x3C83769C7D7ADA7F, 0xF4485B621104FAC3, 0x6FB217A7D9D4, 
-0x95B2942E42FA0360, 0x636262FB56E79993, 0x4CE7DA8A9CCF30D6, 0xAFB5CB1C05E4FA59, 
-0x73D382443FDCE427, 0xE331ED08AD5B59A, 0x97DC8115739FA18B, 0x2E5F6CFD4AF75EDC, 
-0x15F993605E78252A, 0xF17008F4EB3DF480, 0x11975C682CEFE1BA, 0x65CF1F4B789E, 
-0xD7F0CC5DE7A8D383, 0xA3FAF9EA800E0CD6, 0xABEE2810573E5FA9, 0x77EEB5508BBD559B, 
-0xDC794F3E2F80936D, 0x28A7802EBD84EEBF, 0x53D091CEB215C8A, 0x66E9313CFC3689DC, 
-0x3E9A85047329D4BE, 0xB48ADACB298F2BB2, 0x624B67907623BC22, 0x6EAC1DB65908, 
-0x13C73C03C2FA537E, 0x9AE9A114814BE3A6, 0xEC2243DB6D18BEF6, 0xEA37E79AF2879E94, 
-0x569021C9529B2D1F, 0xB1369EBEA2E223FC, 0x101F1730C1E80823, 0x321F07B65B959583, 
-0x8401398784B20650, 0x1797CF197C504A63, 0xA121B626B5D16597, 0x3FDFAD8A47F5, 
-0xC80BC6378451631E, 0x68CE6E66BA5BE122, 0x82B78C59749B7E00, 0xD3166167E4B8C3CB, 
-0x1E0A1A7CAE64D6A8, 0x3BF99A8EFCAA0F55, 0xE5F4EAE0AD99E62A, 0x6080E799036FB286, 
-0x157A4E2979B5030E, 0x16C4B2F2EE5FD826, 0x642C0AD1A970272, 0x435A4AEB8C4A, 
-0x5058F7FF47B9CEC2, 0x6D936B05629AE35A, 0x91BB934C330E6634, 0xE1F17C33C53834CB, 
-0x8CBBA08333B2037E, 0x70E06F295F1413CD, 0x1AC93F21330373EC, 0xABEA991D1B16775D, 
-0x5A41AF626335D553, 0x792ED086E660D95E, 0xD76D98629E783E90, 0x37C3EBF9D121, 
-0xEA654BBBCEA5A62A, 0xEDC0B30940DBF8D4, 0x50BA0D5862D43971, 0x8D15B6A47603ACFA, 
-0xF090FC3A06FB5FB2, 0x95FDC44FB08FCBF2, 0xB2A04C0F88EBC637, 0x90FE828834652611, 
-0xBB14826D5E390A66, 0xCA78041A15F41E33, 0x3E58B81EA179DAD9, 0x748FA9ABE92, 
-0x15A0692B88E8AEDF, 0x91E8FDB40136D18B, 0x2DA082DA2712D2A8, 0x569A56C7451AB41, 
-0x557438A00306834C, 0x5965CA8BED8277D, 0x66DFB71E20309A57, 0xF7EB167DD68AD6BB, 
-0xDBD700EA24AE754B, 0x893D5747B9EF7E08, 0x61A2B23E6EBDECB9, 0x3C36292F5950, 
-0xBB6AAB5A13ED6A7E, 0xE9DD3AF025992F61, 0x1542A8F3595A14D0, 0xDF42DA99A529F18, 
-0x153A676DDFC206EE, 0x749DBCC6BC5F72A0, 0xC4DAEF6E93AD8481, 0xA7C8EABB5A14F1D, 
-0xD2C4C0C0FA5EA077, 0x7F5AAED1EDB611BA, 0x586482317465813D, 0xC6B29972FC5, 
-0x4A8DA226757A512F, 0x33F01D246FD62610, 0x874B717CB3EADF85, 0x58063E6AD1686DC2, 
-0xF248FD4362F0384A, 0xF743A0C42CB7E57D, 0x8B184A6E4D56D1F1, 0x12973218516B3CAC, 
-0x5673CC224873E693, 0x7B6F481BC2775344, 0xF27B37BEBA515B52, 0x478858FA6DCE, 
-0x35D98A0459BA75B4, 0xD44417FFA7A501A2, 0xE01C599C9D16B8, 0x4B6A64F153F9335B, 
-0x560D58233D5F0375, 0xA7B964FD8AB6D9BD, 0xBEBA94405F3B5048, 0xA39C3F37D69C3513, 
-0x634973226F1C6F64, 0x82F5C977F4318C13, 0xF6D4BB7417CEC4CD, 0x51F5BC27A1FB, 
-0xCF60C27DC4943A3E, 0x9FFEECF755111E7B, 0xE251EF4665DC2DA, 0x33A502B8A56B2194, 
-0x48BD51D434391F20, 0xCA44FE30C3B92260, 0xFC6674DE7254A515, 0x54F10B9307029F3E, 
-0x77998925011B380A, 0x2A6C2C5E6BD4F39F, 0x68BEC9572BE1671, 0x1491FDBC4AAA, 
-0x591BB1F1B0D68A3, 0x94205E4C540BA40F, 0x48FF974FF74D8BF8, 0xBBF6ECEFBA80444A, 
-0x6213A79D3C17B003, 0x56ED19C0DA3E4A31, 0x29AB5CD9E3AE9382, 0xC7B70417B03CD37B, 
-0x456A61985079180C, 0x517E4A6422FA3148, 0x400D3563B6570573, 0x5AF61FCA814C, 
-0x275E5ACC05D5BCB7, 0xB44A490E08E5EF80, 0xB886C1C0C8A5B24E, 0x1D4F265DB1E0C32B, 
-0xB86C6C26E29EB427, 0xBEA4C45B585CBBC0, 0x84B37D21DA52EF, 0x5158417BEE691673, 
-0xE9F0B57FB561342E, 0x5D6C714A1F84BBF5, 0xF839EF607FBE4EB0, 0x4436FAD0E72B, 
-0x1AFE3AF740F45E0B, 0x1EABFFD21FD2E388, 0xEA83BF5CD6AE13E0, 0xA32416DDF4A3127A, 
-0xE0B483F8F2A43AA4, 0xEE6759E58B8649AA, 0x316E18AB95EEF59C, 0xC0C4704DAF5722EB, 
-0x21D4CA528BE8707D, 0x1656E312D390B556, 0xDECB8648DF13D77A, 0x4B0657A459F, 
-0x933ADF34D19308FC, 0xA26CAE8FEAB9653C, 0x521F1D0D78AB0262, 0x6B7F261E33B2715B, 
-0x498ABCAE0A7D9DAD, 0x9C68EDEFF550EBF1, 0x4B1C29B0F7A41EB6, 0xF6794153986839C3, 
-0xA807690E952B8951, 0x720B111AC66B5DD3, 0x575948ACBA8EDBB0, 0x26A1BC076364, 
-0xD17053A22EC79232, 0xAED2A84BE9F2890F, 0x5EDF478C599C7D8C, 0xB457C58FF83565B5, 
-0x6A888B5B5903E142, 0x4F15CAAD5F5F3D07, 0x628111F2753C7E7A, 0xAA9B0F8BB079E046, 
-0x9EDE8A46961D3666, 0x8A91CBDF4E51D706, 0x1ACD2363503140B3, 0x15A43FC1DE39, 
-0x746F6B773EB0F483, 0xF1549402BAFB0FF2, 0x97FC77EEEFB89E5D, 0x5EA15F0318B0C2CE, 
-0x491943E740ED1FCF, 0x513F7EFB716F291D, 0xBB355B47ACB171DA, 0x65E055934CDBBFD6, 
-0xADDDDADEAED677C2, 0xD4E8575607439B79, 0xF6EA598367AC629D, 0x3D2C6835ADDE, 
-0x941E11BC5117A7D, 0xD6EFA72095FA7399, 0x9ABAD75850692BAB, 0xE7B174B66007C5CE, 
-0x1C6F110E8A7D8756, 0x8B0F889C5508A406, 0xA2C11F24C58A6BD5, 0x9636C7779BA17C3A, 
-0x6F4B9DA516B46A14, 0x48D4AE842081B09D, 0x64DBDA4D39D00EE9, 0x54036A75F7FD, 
-0x925381B7AF65BC29, 0x78BCCA1AAB7FC852, 0x9E51FFFF08CD2BFE, 0x2F5FC1C0016B8AA1, 
-0x6464A4745A4E846B, 0x8F24F7B9522D5A77, 0x67764401996B8446, 0x3F6374AA75F035D0, 
-0x2916066ABCD73F8F, 0xF2ACB413986D5A6C, 0xD53CF89028F77AE9, 0xDB90008E7E1, 
-0xDD3D062B3EF53FA, 0xEA72CABF9F4D34C9, 0xCCC57019261A561B, 0x121FA89735111F76, 
-0x2F501944CF43F72D, 0x2D20F0C05636696, 0xCEA95250D61FAF3A, 0x2F1A2467DCF6A34C, 
-0x986FFBA7AB1B4DE7, 0xB71D37610AA18B3D, 0xCDBC6290030124CD, 0x3F38D9D4C92C, 
-0xB65D92D95272819B, 0x667CCDB8CBEF56ED, 0x69974E5E2CCF19C5, 0x5E07DAB339D89AA8, 
-0x888C6458D7CD2604, 0x5E5407094A284F15, 0xD3C1E47A3D1DC8F0, 0xF8B3C3D5D8227787, 
-0x8F6CA3E065E8C53E, 0xFC2875D4B237C483, 0x85073284AB954C81, 0x28626E50EF6D, 
-0x15D70DC7ED00E2A0, 0xA765F9C6A2F4508D, 0xF659AB099E65279B, 0xC95A76F04B4F9FB7, 
-0xF04FD9DDDB737D05, 0x335F750B6671724C, 0xAF633BED04052248, 0x8FCDB005D10C2508, 
-0x6ECEE743E19FCE99, 0x9C7B08C3C64BC6E9, 0x992B3456F71BF53D, 0x1704966B160A, 
-0xEA38BFE67DF16981, 0x79AF43B1E3571375, 0xF469C21C91D0A371, 0x3C99C6B233FEFDBD, 
-0xF71B1B8F4B8049FD, 0x90E029CE98A9D41C, 0x488C4BAEDD49159A, 0x534BCBCCBDE093F0, 
-0x88E1472EB4F16FD9, 0x39097E84037FDD40, 0x52B8179F4CBB1D70, 0xBA6824A560D, 
-0x2DE078819638954, 0x860AEDD08EAD1A1E, 0xD8F52D3BE4DFB69F, 0x11F18B5E6095083B, 
-0x70CE5ACF77313FA2, 0x53FC9FDABBA3A182, 0xF9AD362E7A49F70F, 0xE99EE94689F869EC, 
-0xA406B1DF540F2455, 0xC1BB963606DDFA7, 0xD3D46A4ADCE23C23, 0x51305BE60175, 
-0xE7CB962AE4F2AE7, 0xCAB3CF59793BD9A3, 0xB6D9BACDA651B97, 0xFC06EB0B0CC6286D, 
-0xAA9651503E062589, 0xA46D74484808F97C, 0x83DFE5439F43A881, 0xA97DB8BD3BBD90FC, 
-0x1BEDA0B8F9CCFB28, 0xC4D28836AF24C16F, 0xDCB9EED154C64134, 0x41A18D3522D7, 
-0x13F533A0F9B17057, 0x1C9A3428A961E0F5, 0x6EE7BE14C5083DCD, 0x8A02B03CD6F8A5F4, 
-0xF20034DE8EB1AA0B, 0xAE0173C9F46E12D0, 0x649A2E11E9754666, 0x12CE6A1AC9809BF4, 
-0x6B8CEF7DBE70D2D3, 0xFF6B1A4ABF90CC11, 0x34D17058126EE1FC, 0x9976B16BE54, 
-0x75BD079F0AE8C7E1, 0x755E9451393DFC2E, 0x6D09F4A27F135C8E, 0xAFE138DA71570A0B, 
-0x3021481007538487, 0x1BE7602FDB11C6C, 0xFC9657E2C11A1EB6, 0x853DFD55EFB78FD8, 
-0x7AE7F8BD15F6A41B, 0xB8195770DEF7C99C, 0x5F2385C50E370799, 0x638C6B5CB5D3, 
-0x6EAF879555109434, 0x26E346DD6BC2AAEB, 0x20ED5AC65CF39A7C, 0xBC1B07B28EF854F1, 
-0xD77773C01E6815CA, 0xA2D05CA3E5C2E5B0, 0x4283279C90332682, 0x8AD5B644FE10C0AC, 
-0xCF57590FA629EDE6, 0xDF565729E5247663, 0x54EC2582D05279BB, 0x582B2622ECAF, 
-0x8BD90CB35A2C9778, 0x83E37C7442D9A28A, 0x7A7F057FF3C11495, 0xBD8C0BBCADBEBB69, 
-0x90D809C1A944E0D3, 0x7A9EC0B373FDB122, 0x25CFABE9F14C2F95, 0xFDAE477B7BA50840, 
-0x5C91047034A0D73F, 0x561B4A87C73DBB1F, 0x5A81AC351966967B, 0x1D1627F72404, 
-0xF28B6264A9C46378, 0xD83A88EEBC72800E, 0x4EB5175ADFD4A5CB, 0xACFA7E95E7D05920, 
-0xBD8DBD5322EF7794, 0x23D67FF4A2C6A915, 0xCF726E70ED8A27E9, 0x1BB44DFF3547AD7F, 
-0xEDF33A3A510672C0, 0xCE0C8355762FCD33, 0x11CEB6A9688897AF, 0x1D9C3CE670A4, 
-0x7ED58208DDBCC5A6, 0x7C948B7170A2E062, 0xE63A831E39120D5D, 0x7972D9ECAB1374FD, 
-0x9420A239371640C2, 0x95927709C1E85649, 0x3BCDBE7E94F6897B, 0x60F0C3FA53E7976A, 
-0xE569DB1D7E003FF6, 0x51F3191D24878064, 0xE2723182465C2442, 0x4B133A69BFCE, 
-0xD6E25F9C2AFD7DFD, 0x578370A26CD9368C, 0xE2DA8A5F9583FD10, 0xE8C23F93C55FEB19, 
-0x506D9723AED3EC68, 0x9200C3AF6DE23A3B, 0x4E61F27CC884B63E, 0x6CFE19C872B6F3B7, 
-0x68AF9AC832531A4B, 0x95D2C8F391EC6A25, 0xC0D56B2423CF2222, 0x207E57A2B9D2, 
-0x86B9164E013D9805, 0xABD9AC71B065E630, 0x5B365362A36632DB, 0x86B7880DABD1B9A4, 
-0x77313590DA287491, 0xC1B991E4857810DB, 0xEB9010787B9CC7E6, 0xFF0FCED1CB9A5F28, 
-0x33FE94B6962C118E, 0xD5214D12C8C98732, 0x9CC67BAC9D02BF3F, 0x53E5707C2838, 
-0x12FC1B8C1BD29CE9, 0x815F99E5BFB9FDC, 0x176A34CC09254200, 0x720BCB7322A8F531, 
-0x47458C81EA4BE6B4, 0x79C421104CC3A77B, 0x89C708F2EF3B73A5, 0x6D306AB48DDB7A17, 
-0xD78C854F998D622A, 0x576777C84DCD93D0, 0x86D9BC168DEE1552, 0x2857EAAD0154, 
-0x771A7F4F8609DAF4, 0x96A6B01EDB55EFC9, 0x33554D5C3993F042, 0xB6CB8F3CCEE45FA7, 
-0xC56218463DAA8724, 0x9490A6204A5B5DF7, 0x7468583144DFC126, 0x6173692CC89324EF, 
-0xDDEE0435C80BF997, 0xADDE0700C94BEAC8, 0x3379D0D94B4C2C70, 0x3B4FA27FF434, 
-0xC09F5013398247F4, 0x4287CDAE63E0CCBE, 0x382DC175D22A7DF1, 0x16E32395A924DD2E, 
-0x773054CC4C0B1357, 0xE19B6C4DE020E738, 0x5F68D21D55E39DC8, 0x9DCEDF151E0D1BA4, 
-0x3BB8ECB1EE1A3F7A, 0x5B3C5AFB22E63807, 0xE464011A26A91116, 0x209DF2CCB06, 
-0xA89D363AEEBC9011, 0xE41DA2333496C31, 0x4BE9058735C07F29, 0x3EC4BB4F7FEEE378, 
-0xA6A29DB36A84FE2C, 0x97331A188EBAA487, 0x1EDA43EC6E46FB41, 0x4407E67071529611, 
-0x2422FD346628D8B4, 0x30EC190E01689251, 0x14D03B2805210BB6, 0x6A822AEA38E7, 
-0xBF8A60305E36C5D9, 0x73E602C31F173AEB, 0x960A4F9F7566E5F1, 0xB4D56A51AF5AE369, 
-0x41653C45547EBF12, 0x23C361EC3461A4A8, 0x758DACE85804A238, 0x56B4C57BACC350D3, 
-0x77CD7263D9C72227, 0x69CC249F99AC6E8F, 0x22AD2E2A0A282D3B, 0x66F796A8A5B, 
-0xAE7928690CB820DE, 0xEBED1F0B2BBEDA1D, 0xC964198451E6BBB3, 0xB478155B498BB4C1, 
-0xFB09300766DD45A4, 0x694D1D1577B263C7, 0x97F12D41EEADEE7B, 0x6C8E273ED194C840, 
-0x6929F102130F78AC, 0xD143AEE33F013CEB, 0x128FAD30D4E8EECE, 0x1E423A48F820, 
-0x79573D73D2039556, 0xF0FA245DE3E871F7, 0xC30885AA89CD64AC, 0x7BFFCFE93B393AFF, 
-0x5625506F3DC33F5F, 0x7470CF79CFABBAFE, 0x2C7D772407640284, 0x78C378182976A06B, 
-0x9ED2CE70299E6BC2, 0xEED26CFF21581D83, 0xAC6A280BDF236068, 0x3B549FF8F03, 
-0x1BFCA69EFE08083A, 0xD6DECC6AFE00C6D5, 0x5EE55A653E2266DF, 0xDB8E0E48A406F422, 
-0xF95C84F792899874, 0x6B2BDEEBEF924AF9, 0x42DF83B02D09969F, 0xB1B16D90D009AC67, 
-0xEEA20BA7974DD242, 0x3784DC9F62213B30, 0x1801B21FA049DC59, 0x1258CB69C81F, 
-0x2A00C7A8867F1E90, 0x3563898522295578, 0xDF973C7AA761FF00, 0xC19E36745CECB295, 
-0xD17E2F1B8DEE4729, 0x3254296624C1B2B2, 0x5B679DD9D3235718, 0xDCBB8D72D9DF2B5, 
-0x384CC15723077F83, 0xC1B7748A6FF4160E, 0x6C75894F3FAA8FE, 0x149A61BCBE50, 
-0x92F4EDC768C48A4, 0x2448401DE16EEE04, 0x36ACDAFA8920CD48, 0xEE669C610777311, 
-0x858A2F34F3298DAE, 0x1E24536D69992380, 0x196A4EFE017862DE, 0xD3EC6435AEC1A8CB, 
-0x573E5B1DDAF80D07, 0x3DEB22DEDFB1DA97, 0x2FBA1936833021C0, 0x812821002C, 
-0x4F870891F8F3CD5A, 0x870F7D5EBFCB6217, 0x148D3BC5ECB22161, 0xAD6687F2DADEC598, 
-0x2E8236E29769EDD1, 0x4936BBAAB7FFD963, 0xE0F48C5BDBCDC61A, 0x7E73B16CC940A94, 
-0x2D1C1FFCD4C712F5, 0x11982889BDFD915C, 0x795175172AC4568E, 0x6E4687F2377C, 
-0x75D166B4A06E8DCA, 0x3887C951626CD958, 0x83AE2A69BC4BE3BA, 0x89EB924DB7F61D0, 
-0x4036BF1ADEB3976C, 0x505E114109A68AC2, 0x33FAA9B87EAC1CFB, 0x92B254465D239536, 
-0x7E844190B82E0B75, 0x3BCA3B25B7E79F30, 0x8D4E66DC157CCEBF, 0x1A9A2AD76BC7, 
-0xACAD75AFDD66346E, 0x1F2A9D922D979D00, 0xAFC359E532D41EA6, 0x37D4DFAC0BAFB75A, 
-0x590119B7439395BD, 0x7C48FD33F5D7C30A, 0xE4118AC9A2663224, 0x4B5137A42305114D, 
-0x45D1AE51B7E4AB4C, 0xB4E63EB8126AAA23, 0xE31AB56CB91D75BB, 0x67DD4C916B21, 
-0x23BD7901EABB5FF1, 0xF62626235D152AFB, 0xD74B411DC2925A3E, 0x4A03F11EB7089B21, 
-0xE41F765114E966E6, 0x155C48E5EA84CB5E, 0xE566E224A9134122, 0xB56B10C6E4083053, 
-0x33A50D16B6765D49, 0x8E7388DB0CE3ABBB, 0xECFDCBAD26E61C83, 0x23025FB55035, 
-0x2D89D87E4540129B, 0xEEB4C802C1330A8, 0x7CB04985BE993540, 0x1AE4C6DD853B64EB, 
-0x41BFB8D8151630C, 0x76F13E4349703E59, 0xA3268F7E2752227F, 0xE78F2F24DD0A0C56, 
-0x59D63E31639B6131, 0x6A1FE95A39530925, 0x77A7CA46568C067C, 0xF967F574F8, 
-0x20187DA308EBEB1B, 0x19DA789B5DAB5002, 0x5E214526602F757A, 0x8E42F1A83FD0CDB3, 
-0xFD1F9FBFDD21BAEC, 0x5855B49AAB6DAD01, 0x29DBFBFF451F054A, 0x8550F812FE7E5B55, 
-0xBC5A7E452D7804FF, 0x9FEC45986E5F4330, 0x30AF2D8131170D1E, 0x687D236F286F, 
-0x6D4A330E4CC914E2, 0xA563751A986766E3, 0xD5A4151DAFB3902E, 0xABE06A560A588EC5, 
-0x2AE36B2307E475E, 0x95494D0F108F4426, 0x71B5DD6AD885CECB, 0xE06EC934FF3BE188, 
-0x7296924F64274E8A, 0x94C64F9E8793BCA2, 0x90FE4474DBC17E4A, 0x2761C76CF064, 
-0x477EA90AEEF7A718, 0xFF4ABE38B222B265, 0x93599006A53BD85D, 0x52087DFF4B6B0A1B, 
-0xAB95FF4CA2804219, 0x1C3A867DAD506870, 0x4C5EBDA868524F67, 0xDD4C090005C77146, 
-0xA860C720E19BAB78, 0x96817D67960D7DD4, 0x10A234FFB2F4855D, 0x28624ECC795A, 
-0xFE5D0D5D3053D764, 0x53511AF4ABD76E2D, 0x94F9F4ABF557A855, 0xEA4FA0191F9CE06, 
-0xEA6465282E5E4D7, 0xAA594F6BED38EE4F, 0x82124F6334182EB7, 0x1CFC9DDE4A0A8DA6, 
-0x9EC849FD51883B08, 0x9E110E0304B11743, 0x8EAB654E0E268081, 0x356FD11E4F4A, 
-0xEB42F9270709251A, 0xB82A6C1343865861, 0x4AAAB65AD0D7C6AE, 0x1269F4E621131096, 
-0xDE73E21669FAB401, 0xB44786A1BC00802, 0xAB98C6D812528C76, 0x6FC16F662B6482D2, 
-0x9C0F053493C196D9, 0x42D094EA15C3A9, 0x40332F951D574A93, 0x5933F4668DF0, 
-0xC08F44DD611E860E, 0xD658580ADDB92165, 0x86557BD45B7AADE7, 0xE6EEFE15F6048262, 
-0x16F24FDE27B3CD65, 0xFA12F363643D7AA0, 0x37469D2E4950DBA, 0x57A04D2256BCDA6D, 
-0x133187669F5E9976, 0xC1CA07A854403878, 0x6FBD50A2CA5F0408, 0x3FD66E09E8C1, 
-0xF27E48DF7204FC9F, 0x2A9587CF1F887D7D, 0x4F7CD0D2D16246C0, 0xBF6B04C6D918FCDC, 
-0xB1FB8D003186B896, 0x3C150CA180F9B593, 0x215AC0DBC770652A, 0x5BC8A2FEB61B8683, 
-0x9841A953C7681514, 0xF6A37BA57394BF23, 0xC63665CE851DBBA4, 0x2F5ABBC12743, 
-0x6110D45A537B408F, 0x855D46129F42327E, 0xB6A2EF5E437634C9, 0x5DD16CB2D836250D, 
-0x7E501091712B19F9, 0xFC9453C6E2E79AEC, 0x74D2CB3CFC11776A, 0x106BD78D95AB5BA3, 
-0x78A08915848CEB67, 0x69DF324A4A1837C0, 0xE18EE432A20CD990, 0x22C75898084A, 
-0xB6D17E620249390B, 0x1F1123D39C8CB9A9, 0x3F026F8A0098362E, 0x4979A95E63BC0B2F, 
-0x3ED7A91A54C58368, 0xD1CF683986FA4BF3, 0xC3A9C6D981FC712E, 0xD9D8555C03DBB175, 
-0x4F4A51B6E44F8543, 0x7C4A98B979DC4E70, 0xA2804BE2A954525, 0x5DD3CBBD32D9, 
-0x916B86984B70205, 0x90006C85986DE12B, 0xAD4A45DB82FDD7DD, 0xF2DDFE6E288B8F6C, 
-0x20A987699260FFCB, 0x37056DF17C9A803C, 0x1436926ED92CA556, 0xBA1CB41C6C29023A, 
-0xB7000110D49046E2, 0x3AAA7E7256B2AE91, 0xABB8449EF1164DF0, 0x212CFAC5E216, 
-0xEFCAB0648AA08FCC, 0x8382597C28CCFBC8, 0xFA1612E6E1F8217D, 0x73952CA062C196BD, 
-0xD505D7AEB2751516, 0x21385C7A5C6799F0, 0xDCABB7673374A227, 0x6D96CCB3AFEA931A, 
-0x157A5725CAC5E61D, 0x42F0981CDB11B87C, 0x33956ED5E368C5B8, 0x141C74B531B1, 
-0x2BCB5C138B194A8E, 0xA108F33F9B531481, 0x4103CB4F952ED8EE, 0x8A6D404FB1B9B173, 
-0xF7F26503A947E205, 0xA5F615909BDA2725, 0x73A73A0506B24F93, 0xC1511E9A41C2D924, 
-0x9FDBACA354612940, 0x1BF14F98390A258F, 0x5961E338CD9DFE5A, 0x34442479E269, 
-0xBDF7317B244556AB, 0x3C46879D93258145, 0x12B497831FC41B6B, 0xF40BC4122501E447, 
-0xFD44A6884F7BA599, 0x7A1BEA34369688A0, 0x99F33172D38AA045, 0x11FE5AE29DFC9DD, 
-0x3A257A0E9C547E36, 0x5D0D31A45FEF97FE, 0xE69BABFFD2BBF95F, 0x146D299F99B3, 
-0xE773C82AF3481781, 0xA0821BE4CC7E2E45, 0xB32D690B88029E6D, 0xACE5BF21818BA699, 
-0x21FABB4688A2DA6F, 0x9BFC91AA85859289, 0x9DAF3EE4DD65D7BB, 0xC72C82735F284980, 
-0xF34C26931608490B, 0x64C3CB77249F20B5, 0x8B2CED2A93D99E83, 0x620B0315A052, 
-0xBB901E598B587AC9, 0x683A511B800AD580, 0xD3A24CC24C0EBB5B, 0xE4F9C7944A9025C4, 
-0x74356C5AE2BE3538, 0xCD8E8254A7CD4D96, 0xDEC44165E0AB2D0F, 0xB833586625F3611, 
-0xA2A7805B4E98566A, 0xA3579D146CFF44F8, 0xE14F91EC38758AA7, 0x438EE8EAB2B, 
-0xE2DD48CEE30F8D6D, 0x2BEA07C7E6794A94, 0x863EFB62118B3788, 0xB909CD1157B025D2, 
-0x5C09505070A46E11, 0x5370B644A0D68FD6, 0xF4AD8F6A45411C17, 0xE8DC44354E5FCF7, 
-0xDA793A9905A68EB9, 0xBE8B085DF5486F24, 0x3C441FE519B8825, 0x5E07E33F292C, 
-0x309C88592E4DE00A, 0x3AE822064ABF9547, 0x74EEBCBF0CCC56AB, 0x847A27C3E8BB7C1B, 
-0x82855F3ABFCE86C5, 0x999B92225A2A93E5, 0x9FCF335609C42C6D, 0xAA4CE6AFC1E21182, 
-0x76B7F417F5A1C45, 0x1E2B52B4E5EA7E5F, 0x28B6F23214EEE7CB, 0x214855BFC6AF, 
-0x2AEED9417066D5A5, 0x9116E407D82DCB47, 0x36C3D00BAC203328, 0x308D0C267CB24540, 
-0x4145CB17F7918B2F, 0x5AAB4DC2ECB756F7, 0x409F86358671A7AC, 0xEF770B52809EA961, 
-0x36FD0CEBD644ACFD, 0x9A5B835E7CAD668D, 0x452F26E53EA122CE, 0x3A173BEC954E, 
-0x1241AC4A94F43FA, 0xCAE6CC2920198022, 0xB341E2E31D160DAD, 0x189723EBE912903A, 
-0xB0662E1AF46DE857, 0x35D57E61B78CFBA5, 0x86AE6C2E079D8756, 0x41D6B6E219BC18C0, 
-0xE79388BB78847DB0, 0x33557F6BF13D2C69, 0x27D7EC8DCE2D3748, 0x3ED9AFED6AA7, 
-0x4FAE323B3CED6B88, 0xEAA5A6F0C6FD63A3, 0x45C3A3F9B3A99886, 0x7834504CA4D5F67E, 
-0x15FAC8DF4E28EF25, 0xC120B8DCBB3AB56F, 0x7E7EE6D9EA961806, 0x3E53C66C64761F3A, 
-0xFF7BA373BCA11BFE, 0xED641CD1A5F391DC, 0x4FCD5CF716C094FF, 0x5F051761C40, 
-0xFF1C5A37285912F2, 0xDED750D2D2A4D43F, 0x9AB7868A4556278B, 0xAF4AE1FE4DB8F8D4, 
-0x31F42CD28C686DAB, 0x4A41E83A2E0999B3, 0x5283389FB099C2E1, 0xAFE72410D9279CD8, 
-0x8951C60895F1CB6B, 0x2D060D3F3FFFBBCF, 0xBA299E4A7C52D999, 0x4F45EAF704E6, 
-0xF8DBA68108861934, 0x16CAEAA683FC021C, 0xC8123461C59BCBA1, 0x6B025DB8FBBDCB27, 
-0xE4F5674314FE0F5E, 0x3D0BE851C3126E23, 0xA78337641C095AD0, 0xB54FFCB5A7D21A1D, 
-0x3E3734C8387DC8F6, 0x376942EAED34DC92, 0xF9A980DDFCCF7810, 0x12F604989E58, 
-0xB07F1C329569F588, 0x19AF2D321F37E78A, 0x8B8C7215B55E8F45, 0x604F1B0E92B6D97E, 
-0xF3F36BC44ECA71A6, 0x97E61A39F95E8C1C, 0x9EF51A32D488B48A, 0xC0FADA493A31235E, 
-0xAE4CCA1DC253A34, 0x4E4D17A48D037BCA, 0x189F213B2432EC28, 0x6BBD815A4C30, 
-0x32B6D8822CBD2589, 0x89875A9835CF8D63, 0x8AA0DA94577C03BA, 0xE0E10E2A6D5E6776, 
-0xA5519A249FB2211, 0x98F3EC9E034D015C, 0x877265A066F28642, 0x9A52B7869EC7887, 
-0x8642DD6BA4BAABD, 0x331E50E8838EF615, 0x904CFD7E32430A66, 0x362FAD0E351F, 
-0xDA50FCF4E5F9EECF, 0xDB6109D60D7B8DA4, 0x5AF6427ECD7538AA, 0xCC90FEF5812E51CB, 
-0x5E491B1745A3EC9F, 0x2E69D61729FF7442, 0x5C4A7DB306F83B38, 0x3F4E8D82AF5A5C31, 
-0x7FBCEF9380A1035E, 0xAB6B29A448A5CD36, 0x7A070582A686A9A4, 0xB091914D7F8, 
-0xE3A512FCF86BC5D1, 0x29CF37D2C34884F8, 0xD2E5D87BC1220C63, 0x175B470245E301CC, 
-0xC658722E926D364C, 0x8166278E2144D4EC, 0x8AC17C50C1B1B2CD, 0x89AF8E7ED0CF36BB, 
-0x21FAA92139346E42, 0x7A11D2AE1902C12B, 0x56F51FEB839A9F4F, 0x3EBE4F94E157, 
-0xD031BA53EAF6E629, 0xA2EF167083398119, 0xF41CA1A8C57E93B3, 0xE0A84686F9B8E933, 
-0x40E17640AD5492C2, 0xE1069F2D7E3BB3E0, 0x8EDA42B1B9CE9156, 0xB76AE6D0533000B4, 
-0x475D0B3CDA6B6F19, 0xA0F479318392608F, 0x740D97A0DF3F8311, 0x44B3E69747D0, 
-0x6FB46D834CD5CA4E, 0xA6D80007B33711EB, 0x826E674CFB0C3FA9, 0x2B8842EC24FDC809, 
-0x6B2CE5514E42692E, 0x37FA298274D2FD5B, 0xDC640290D8A42305, 0x5D6D05828CC12FC4, 
-0xEB9FD423D752FBCD, 0xACD5698BE4A7B579, 0x2D1F9C06AC6AF74C, 0x2E1BFC662B5D, 
-0x3DCF3242B1A38C1, 0x8272FAC7A8773BFB, 0xA3074840B1EE9EB, 0xD4F684883737FE54, 
-0x7C0576D9A69391F5, 0xBC5A36A436FC6F23, 0xA86E4009AD53A000, 0x98B52BD673471AE8, 
-0x79C5E797C8C7BF40, 0x1541F4088B68DA9C, 0xC88CB7DB1FB7C628, 0x3E26032453A5, 
-0x65B4FA2AA8BC65B1, 0x32740032B815675C, 0xE5E0DD4CC8EF6902, 0xEEF0B70D2ED024CF, 
-0xE084877E358CFCD3, 0x3880243D3CEFF8B9, 0xF586ED2CB8B3B285, 0xD7F7160C0A0CD5A7, 
-0x9BFF0DB0E16B38CE, 0x557C1916E412D9F3, 0x7429BB96C603E691, 0x10DF883CDABF, 
-0x43A5A02E6CCE47B9, 0x3A6EBFA09D208694, 0xFF7F9FC61807341B, 0x992286C984F9304A, 
-0x61D6C9C5BA2A8B63, 0xBE560112791A5398, 0xA9B1B0E157DCEC0D, 0x1A422E73AD010FA2, 
-0xBEC9EAD2B8EA4EF2, 0xC0D926286841AFBA, 0xF770126EFBE7E01E, 0x39B702E36238, 
-0xDB5F9CF12CD9CCDE, 0xEB816761935A6C88, 0x7A6EC25D89F554EA, 0xD07A8AABDB6B7FD9, 
-0xD1DD0B40DC3BA750, 0x89CB37BE69A70BCD, 0xF0190C28E2B6AFCD, 0xA4C3656F461FB71C, 
-0xF07579C921388B8, 0x838DA950187A838B, 0x9A20CAF4A1ADFC69, 0x5F9C9E744835, 
-0x6A3223DAFEA14762, 0xBC6BE40814C21FE9, 0x820907034D4D1902, 0xC1395FFDE3C409EF, 
-0x8501557696B40E76, 0x46BDE9BAA08B0A8A, 0xA430C1563ED52A8D, 0xE6FC2DE025466286, 
-0xBA3AF5116B261D52, 0x72D9C33F869D355E, 0x740E26EEA6E1F3E5, 0x1222DF6B715D, 
-0xF645C79609A10D45, 0x17184C0BE15717CF, 0x7183417494D6564A, 0xAAECB7FEDB8CC46D, 
-0x91864C141D18B285, 0xD5DB393ADE0AD9AE, 0x6AC74664F2E1FD2, 0x80161178F9120614, 
-0x8862239D1EB3CC17, 0x358A8F9F29A9073C, 0xD5B496282A936751, 0x73F8848B74, 
-0xD738A7E910F0167E, 0x3054E0AE8D77F9AD, 0xB25FD5324CDA4F74, 0x1840AAC08ADBC24, 
-0xCE09D2010568B003, 0x16B134B6AC11B8B9, 0xFB124CE1D93065AE, 0xCA5909BDE3774061, 
-0xA5840FC5CB0BE030, 0xC0B89BA9AA930968, 0x3B4D5999F81D86F, 0x4CD013AF43EF, 
-0x82FE6CDC98C85461, 0x8CD2258A2DE46C0, 0x7A35CA1830252E0C, 0x7DAA6A29DF3CFEBB, 
-0x1504B3DCCA30C3A0, 0xD4EF30A3F8F3631, 0x449C3B72E2C81F7A, 0x10AB2932B676980, 
-0xA834F051888B02EB, 0x28E3ABAB5A0846F1, 0x226691DA38EC97AC, 0x302DEF3F6217, 
-0xC88161715E6B2613, 0xE5F0CE919496928B, 0x4CDFF30F87FDDFDD, 0x5E1319FF27848719, 
-0x9FCA95106AFFAAB9, 0x691BA99D2AC2F707, 0x6C61ABA4F9A2E282, 0xBF3EF35A445153FA, 
-0xAFB3DADC0AE1ABF6, 0xDD0B6BBE562219ED, 0x40AA2E0107715236, 0x8D8E5D50D84, 
-0xD7D0B557CE4AF0C4, 0x81E6460BF794E850, 0x4886DD1ECA6EECE0, 0xB2AEAEBD107D545, 
-0x9907A9E13CC6FFD6, 0x5CD443D3263BF307, 0x72075C2140A32305, 0x4BC1A2CD03668CCD, 
-0xB020ED84FC8E10AE, 0xB0671976A65AB8C9, 0x7198DDA1C7DE272E, 0xACFE49AA183, 
-0x2407C495974E7B9C, 0x3C92E43313586B50, 0xDF750D4BAE6858D4, 0x6C192F99EFA54DAF, 
-0xC211A3C7317678BF, 0x86AAE43F19A76856, 0xC678F22ED22D6FCD, 0x29D52F640F9549D1, 
-0x863762BC7E35D463, 0x8970BDE0F6010D91, 0x8EABADB3E02EE878, 0x3AA35D7C2E9C, 
-0x14D6F3967383946E, 0x4EACD19D3C39CC08, 0xA76693746E81E1B6, 0xEF2081535211853D, 
-0x87B3C874A811F1AB, 0x8570C72045B4858B, 0x82925E4A400AAF14, 0xE0B0B77CDB207DAD, 
-0xBFE1367D6E9E01C9, 0x413B3885C85E61E8, 0x1A61D4B85488EA80, 0x6A31D9016D5E, 
-0x29F3DC48C407BF23, 0x2A8DD1494028D84, 0xAAE33FA60BD71D8A, 0x3C14DE0140845E2E, 
-0x88B97AD803F417CF, 0x2C5A4FDA0B2221B, 0x23C23E77225543D1, 0xCB28286AB96AC986, 
-0xD11D6E54DEB312D8, 0x5A7121ADBE672018, 0x9E129F98ED1392DA, 0x69320DD87984, 
-0xBEA56C301316A7DA, 0xC478C436EE09CDAF, 0x2E470E08CC2C8A11, 0xBEC8DCE4833FB2FC, 
-0xCF65940433AB5453, 0xC95158B1DB39F790, 0x63DEF3E2B4B25762, 0xCCE1BF3BC7336CCF, 
-0xCCFAF3C303F533CC, 0x7505040404192EE5, 0xD907271E97E40C30, 0x4E4C51BED65A, 
-0x6358A94082C9473, 0x46A4D6A0DFCE60E1, 0x9738261A082891BB, 0xE85F50C2054751DA, 
-0x30308479D102F57E, 0xEEC16EA65969A1D0, 0x74F5BFFD6B6C136C, 0x75DCC0DE21E4F58B, 
-0x496DFF2C9376C120, 0x2CE656A9C8C6D6BB, 0x4133A3010B929031, 0xCE036944016, 
-0x2725DE30080E8679, 0x62C6A584037BAB07, 0x385E49DAAC0997EF, 0xE0E8B0E6D36413E3, 
-0x352C6390D84823BF, 0xC77E056C414A18D9, 0xC5CF6BA147842B9F, 0xDC2D019FFA233C23, 
-0xC709DAAB7071411, 0xC8FF5239486A4E4C, 0xE7D6E4554315A671, 0x5E9F952F844C, 
-0x5976E13413105BDA, 0xA8F267A1D315CA6, 0x968D07030968E659, 0xE74C1F9478758768, 
-0xAECE6F2F2A739F89, 0x8631A1CEB9D3DE2, 0x5D9E4927CF9F77F7, 0x10D538879368BC92, 
-0x99DD8BD9824F497D, 0xF805F4AB5988618E, 0x3CCF0A922E9CEF0D, 0x499F65CE74DE, 
-0xDF721AAD426675D0, 0xAB6FDDAA6DA2E7C4, 0xD0F09F024843C8F2, 0x7A718E59ECD305F5, 
-0xE0236F8A21D20FA9, 0x78FD2BB48D904889, 0xBC96CEB39C572CE1, 0xC7739F800A377748, 
-0x32DE1AEF783F3DF6, 0x93326383333433DE, 0x88586905BECC4E26, 0x69789CAC639A, 
-0x88A39BBB66EED3B, 0x6D9FC277A02E179E, 0x9958C33768F596CC, 0xD6CB670D964F8727, 
-0xCA939136914927A2, 0xEC079C99F81F79BF, 0xB228ECAF6C92B634, 0xE7A63D3D408B8270, 
-0x4126A7AFED1E6F5D, 0x65FDC71AE4075085, 0xCEFCA9D8719A42F6, 0x637C9CD52489, 
-0x9845576DD48DD2CB, 0xED48590BB8F57E4C, 0x4B9F6BA135B0AD48, 0xA641F6C55E073006, 
-0x40CBE9FAF11D94FD, 0xB15280635E448F66, 0x4F39AB5EB336ED2F, 0xC1E06B649F0B78CD, 
-0xEB4DADF0D4189E53, 0x83A9DBD9651A19CC, 0xE53403BB67E41269, 0x3AA6A7551FFB, 
-0xC1171959816347DB, 0xAAC1345EABB1BE32, 0x4D708230D4788CCF, 0xD6B494B551C07BBC, 
-0x3375B782C13FBF77, 0xA9F2A2F82C0E526C, 0x4E404FCAB13FC8D, 0x4AC49237592C2E88, 
-0x4034DEBF124181CA, 0xA588721FC543D124, 0x5D7CD3C16A6EFF30, 0x3C9FF1EB65, 
-0x8FFFB26FD66DB3BC, 0xE76E96A35A4FDDC, 0xB7317CC91766F150, 0xDB687790FFD07423, 
-0xA7359DCB9B77FCD9, 0xCDAD1FC5567FFBF5, 0xFE419CBF00025506, 0x36D41154AF597317, 
-0x70729BEF46C08706, 0xE422D9E7C66F05A1, 0xC69A4AE39BDAC7EA, 0x49108E477230, 
-0xD0CC451640C36407, 0x3D5225101E8FBE6F, 0x456C886C9E52C0DD, 0xD1C9C053A4A9C10A, 
-0x5E670409311D101, 0xF3A42BCE6D7DC06B, 0x83CDCBB3E6DD1822, 0x19216F126E9F1FF1, 
-0xB9A461FCD8EA4CEF, 0x69E5DB7308FC7D0B, 0x46BD1F9330E911D4, 0x146BCCC290, 
-0xF2F915EFF43A914E, 0x5E4530B8AD5AF76D, 0xDB625237FEDD787F, 0x6767883051EEFC67, 
-0x1E23D3C350B65614, 0xF35BEBF9527969D9, 0x5AC5944DF63D84, 0x529BA22E4D4A7192, 
-0x7013137290D225A5, 0x1ADA027CF7AF4373, 0x5EA65145FC558DC6, 0x4A4B175A118, 
-0x3A8BA5357F9F1911, 0x54A9E575A813EF3A, 0xFC3AC3433D36F3CC, 0xA25D5443BF844759, 
-0x1F8B6167145F06B, 0xAEB20DC3195D35C1, 0x8116D7C0D28751F8, 0xBFA03DB45130916, 
-0xCF3AAA2A099F5755, 0x5AD012B73431F6FD, 0x866B210D9C8C8455, 0x5A36E6895ADF, 
-0xF7F11F7BF32561A1, 0x871761014ECD9B89, 0x96A4A07EBB7AD1C4, 0xEE342034A79691EA, 
-0xEFE6BEB9281CA918, 0x25F9914F77082EFA, 0x23F57B39B54397F6, 0x268A0B031E0AF9F0, 
-0x8C4009485D5FDCD3, 0xB9357D8D38DB2C0C, 0x7F2B4A7C57AB074F, 0x1DC1BFE5F4A1, 
-0x713F6AEB298770D4, 0x89E6024A97B54BF1, 0xDCF719DC3021413B, 0xDBCDDDFA995B20E7, 
-0x8CB842A63B583B66, 0xBDF509822B73A751, 0xA5D607E256955578, 0xE876977604E7E30A, 
-0x77EF735F6B9E139, 0xF8BF348A9570DAC8, 0x1EB0F85A3A79727B, 0x53493CD4FB06, 
-0x21C7BB77A0724353, 0xAAE6E0FE61F30027, 0x91E0CD16243AAF76, 0x76D79EE89C587023, 
-0x84982CEC4DA45910, 0xA39BB240D59A722E, 0xE2C11A6A49D3A0E, 0x9C3BF63E9C3288B7, 
-0xFA07114A74E4BA10, 0x99A8718409C5695, 0x231FE0E0CEEA9D5E, 0x4DA5F1F1338E, 
-0xC837D87A48068D0E, 0x4AC61A6E660D1C86, 0xF8FE25831EC15A3E, 0x62400C7C3A5C0C7C, 
-0x5621DA5CD36077A6, 0x50E4D3370192BEC4, 0x503ABF67D71B3BB, 0xC18B9C85B5BF7EED, 
-0x55270AA62E6ACBCB, 0xFC415E2CFB31234, 0x125D71965099B5DB, 0x32B069A010FA, 
-0xC184F8CAED1F0C63, 0x8C7FBA74CDA0BE45, 0x12FF8C8331BD305C, 0x493D75903BB014DB, 
-0x6B24FF5741C27D26, 0x6F4C2E29A137A278, 0xD0FB0141BB432C39, 0x2726C9A51ABBCD70, 
-0xC6B66467F6479766, 0x9821BD12DECA723A, 0xC91B1430294EBF34, 0x5C23C01919F, 
-0x2FE0AC37B1E23926, 0xDED94496A687ADB6, 0xB0CC5DE98A76860C, 0x2DAC6362D458CFF7, 
-0xEC68BF4A6DC08A75, 0xD7682B5BA07A44A, 0x4A571B494DB576BE, 0xA06B219ACD680C34, 
-0xF8EBA4BFD74C0ECA, 0x5B43F1B32114E1E3, 0x2A6003520D30C005, 0xD3725493DC0, 
-0xD0F6418E63F8374C, 0x1811A7F82F15AF87, 0x955A48835878489E, 0x64CEB678433CD05C, 
-0x8AACA78A39FDD91B, 0x75FDFA0C269B6C12, 0xD7690C1E018BCBB8, 0x6B91EAC2AE448A, 
-0xF970EA4EEE25177, 0x85AD280CB4A7270B, 0xBB5B7D14E7135FE, 0x240EB1F758C8, 
-0x174DFF28395CDD2B, 0xB8B28705B42EA62A, 0xCFF1D69A7D266EA5, 0x4F52F095341E017, 
-0x95F6CBB62C0F9C6C, 0x52137470653B5898, 0x4965BD9D5E4B9CA6, 0x68D3646E4D50AF17, 
-0xB949FB6F872E5D5B, 0xF83CAD0F559DD92D, 0x8E1EFCD8469E9716, 0x38A339415F6D, 
-0x2D37074EEF60F38D, 0xFDBAC6E28FEF74A5, 0x12F665546C4C125F, 0x53868FF4BF377BA0, 
-0x6B814849DB69FF7, 0x9CE0B95C721AE36A, 0xA651129EE70EC040, 0xA6410F861D97F7D2, 
-0xE91847AA0ADE5324, 0x8E4B8921B2A024E7, 0x52BD59BA57BCF7D5, 0x2C0B5B324D57, 
-0x45AE048B5086ED81, 0x7C1A1A60F19B6E28, 0x9E476A7E85645D47, 0x63C58B999AE75A33, 
-0x53085205D8011B42, 0xE5EA1C5E3DC95CA6, 0x31F16D5976B11187, 0x5D02194566B8BE6C, 
-0x3E968F684D0387BF, 0x37A2F17FFA28255A, 0xC2E468C0BA8054A, 0x306DE5823468, 
-0xA34F57E181DE8458, 0xB5471A52C8AD724C, 0x73FBF09360450998, 0xCB9F3DA70343CB8E, 
-0x49389B1FB8765153, 0xB48BEC3E02C2E2CD, 0xD5EB49F0B3105D1F, 0x47A6B585649F0DD3, 
-0x225333572D79D73B, 0xA492F71D84FDCD1A, 0xF33600769EFF247, 0x2FF247865D6D, 
-0x61142128FA02B438, 0x50E215C13C7C933C, 0x8D3DBC4C3E96F215, 0x298AEB63D24FAF2D, 
-0xA4DA9E9D5AFC5BEA, 0xDC34724422CA8140, 0xA23FFE23251C0A40, 0x5D70A2C2660F6B50, 
-0xD2B47611DC094AE1, 0xCED19B0E34B141E, 0x24A716C7AC23ABE, 0x5AAC9AEE07EC, 
-0x6A8CCBE26D903A1C, 0x6C28E989FE5D7F54, 0x71A32E5013AC51CA, 0x5F8297FDA0423CFC, 
-0x74834C19C0F74BC9, 0x31FEBCA0F392DEE1, 0x5A0371032B8738BA, 0x99017FA5997AAD2D, 
-0xDDD64B7132865493, 0x1979BB86CE830562, 0x7FDAF156944B895E, 0x87B44B24B94, 
-0x8A9E590C28398AE, 0xDC6599B9EE626947, 0x9EC9E8CD62E07BB8, 0xDD2A94E0053E2FE2, 
-0x63A2757CC75F556A, 0xD90AE0D161141C6F, 0x494D38C062F7F429, 0xB311F4354072B187, 
-0x873DFB21121FFF25, 0x970012949F560992, 0x6294095B8CCEFB8A, 0x1357B7C8999D, 
-0x357F0D685F67B85, 0x957D275A72B0D4B6, 0x232711E3B5082D61, 0x673925CE31217890, 
-0xC5D335FCDA2BE031, 0x96DA3F2934F0306F, 0xFFDE4C0AD51D08E3, 0x2B0EB57A2D3411A7, 
-0x29043AF9929E3398, 0xC2AFA900F045B161, 0xD6C842B865AC722C, 0x51D138CFEA42, 
-0xB7B80971CA597766, 0x602DBCC3E37E7945, 0x8A04220B37227E74, 0x11338FE0C0081048, 
-0x77F5118F45DA1C14, 0x6E9EF5551347B0EE, 0x2AC4DB9E11E754EA, 0x5FE90019D5821B7F, 
-0xBE52259712667CC0, 0x475308CCA9A9916A, 0xAD808479957A6D51, 0x2FFEF3A44B45, 
-0x515E9F5A27BA4177, 0x3854E49AE32AF377, 0x1997CFBD2DC61304, 0x1B925A38000BCEAA, 
-0xBB09E534E91FBB40, 0x21615CDB0CAE2DC7, 0xB0C9D7EE7562E59C, 0x9DDB1240B473D31D, 
-0x69AA8F012DB7C456, 0x6BA5E3692BBA71B, 0x2CDA3EB5D8155BD4, 0x3E4436B2147C, 
-0x97E11E5F308B60C5, 0x84647117B61FF85B, 0x81361753BECAE807, 0x8B8EF29F9E5100BE, 
-0x7B00E19507297926, 0x41F713E0385D507A, 0x17367DD74583CD8B, 0xDB9647F6C86B89B4, 
-0x9C7039CB655242C, 0x4C52AD6E6DA32D8, 0x5F18ACFB93A3AD01, 0x44D38531EA75, 
-0xFE5ACECCD78DA10A, 0x911D427C3151C8F8, 0x5EFD74071970257B, 0xF5E7EA590563704A, 
-0x5213AC77D4A4B4B, 0x14761F207533008E, 0xE84EACA7BEF109F0, 0xFDA7157A8B9045CB, 
-0x2F0E2D338312F6C, 0x57B4AADA02A2C9A6, 0x4850623FAA243D96, 0x6C8472DA469E, 
-0x2ED8BF40603F3922, 0x8CD5C33588BE9ED, 0xF737A93B4F252597, 0x129E8039DE7B7CDB, 
-0xD21412B571438B37, 0xE8ED3767DDADC85B, 0xF117E3BB6E9A0650, 0xA2EB2AFC414E369B, 
-0x96EF33A909C96542, 0x7DD83F44A6266BE6, 0xDBDF4E41442CB5D8, 0x12E8C32D85B4, 
-0xEA7794D2F677118, 0x23EC18B957F66ECD, 0xF9259AFF607755C5, 0x26E1B484CFA5F7A8, 
-0x1087910614FDF3AB, 0x5F8AAE54F22A619F, 0x4901524EC86CD1FF, 0xF320A696877A25AD, 
-0xDC1BC5403C1F56BA, 0x598BA555FE16FCC3, 0xA1F92B241CDF2136, 0x11C9017DA516, 
-0xDCD83C53C69DA8B, 0x70FED3418A6658F5, 0x1B7DE5D9DCB2F876, 0xE6F90CDBEFAE7505, 
-0xAB19B6F0637AA65E, 0x2D0310D99845CEFE, 0x2C38FFDB1D4DCE9, 0xCA26CB69210DC72B, 
-0xA7A9C8CFBA96247, 0x5347F224F362BE5B, 0x6649C3F445F0AA2A, 0x5E94C2C2C978, 
-0xC5A98875A7D22939, 0xEB204CDA3E6DF322, 0x3224BD52AC68284, 0xC814AECBE4EF3E1C, 
-0xC073ACD60F94BC7, 0x6E6112DE4187FBDA, 0x201A0624E6277CF9, 0xD073CB298F49C8B4, 
-0x762C3D17C686A422, 0x9FD8788BC19511EC, 0x3A3CB927135D85F5, 0x3836BFD899B4, 
-0x7B35D9A5706CC112, 0x81FDC37E1EEE62D2, 0x7F72DD6DF3A94BC7, 0x62207F86C23E8A4, 
-0xE1D952EE07635683, 0x4D7B4DC7E1C424A9, 0x593940E91DB6A2FB, 0xEEA708B65FCCD688, 
-0x89B5F343B0D529C, 0x78B147170CB43167, 0x1EAD713DA7826B0E, 0x5CFF0D8C1B5F, 
-0x8E2DE359F9BC387E, 0xA9384401CB5DC0E8, 0xEF7F334BFDF68C18, 0xEFD552075AD227A5, 
-0x68DEC089C9E6769B, 0xD971C2F4057ADCCD, 0xAADD08B2418DBD33, 0x56A0307705550306, 
-0xC7E3EF355E3AAB72, 0xD7D70E9F36FEC21B, 0xB6C44BC475206501, 0x2F49ED84E8D5, 
-0x2A41B37B57A199F8, 0x386E9191193E9E77, 0x2676CD9FB4092FEC, 0x4925BC0E7D2C26BB, 
-0xEB16E7515724CF8, 0xA40A16036584E146, 0x9CF67EA4A4C2B5B7, 0x9D27678A003A696A, 
-0x253864D3427AE75E, 0x388A719F066296F, 0xE682F6DD247EE74B, 0x548730554736, 
-0x76451FAA41BCE5DF, 0x47C31A40CF77D6BF, 0x1DF6554E4F9D6C1F, 0x5CE67E83DF6302FA, 
-0x8935730D8D2B27ED, 0x1DE1190FC4C40E23, 0x6B82023655BBE3B2, 0xC79696B0BE10B13B, 
-0xF51A6A0A888DE3DE, 0xEEE8A601867C40E5, 0xE67C83FD1C797027, 0x31FF9FAEC071, 
-0x7A62B1D876892EF5, 0x36E37CA1AB104577, 0xC8BAC25E48170949, 0xB6EFEF34775B29D9, 
-0x39FF01B467B354B4, 0xB960F20A7761503E, 0x803F7AA19154A721, 0xDEA53ED759951A0C, 
-0x3C9DEDBA75857120, 0x58402101C77AD35F, 0x7855D299DF242F9D, 0x43F182FD92E5, 
-0x293426F68199F0D2, 0x20D5406D3E29C697, 0x3A88465C8ADCF8D3, 0x800322EC22755308, 
-0x4D82ACFC7F037373, 0xE895FEDBDBF1436B, 0x4E416F682402E415, 0x6C05AB251A91B71D, 
-0x507ECCAFE95EB084, 0x7D653F854566EE03, 0x9BB953AA4461EB94, 0x5CFE6A11E53B, 
-0xC7F3ADB05947311, 0x6E55831FC4557637, 0x8699FDC4457D3A03, 0xB03840AB2B7AE6C0, 
-0x8A2CC60F45705816, 0x139A538D822F6314, 0xC16B50214088791E, 0x37C8086D55447ABD, 
-0xB91CF3BBFE235D43, 0x8E4360BDCB927B5C, 0x20F4F13F10B00158, 0x6DC615923742, 
-0x539FB1A27A421DCA, 0x910E8854862EB22D, 0xDD6B29FA618D589D, 0xEF3F2EB2A4E5CB5A, 
-0xB30B67705A5E4CAB, 0xE6E4C909F3A24E12, 0x5F208C628C6D1F08, 0xC37C4D4D87A857B2, 
-0xC920CC4F44BE9A4B, 0x338FA9D446D322F2, 0xAD053D8149C28505, 0x546669ED1AFC, 
-0x8EEAFF2A4A576ACF, 0x83D0B0174F10181D, 0x1915E21C0BB91522, 0x853B46C9F7769305, 
-0x13AD6F77C0BB7CE8, 0x383757F8CF0DAC2, 0x4C419E62BF2E9054, 0x95A3B2BCEA0D063C, 
-0xDA3833115236A944, 0x9AFDA9C881C8C68F, 0xB6D374F3ED6510E4, 0x24F7851909F7, 
-0x278DA917045CBE5A, 0x9520ACC4297372AC, 0xA14A89DA1150F6CB, 0xEF52162CFF489110, 
-0x29412C4CA270DA6B, 0xB34FF4719CEE4EEB, 0x4DE1A71BFE1484A3, 0xFDC861E8241DF41F, 
-0xA2C82547861868AB, 0x95275DEFC8169D25, 0x76EF0403E532EAB9, 0x23A5FB187B0F, 
-0x7D93B7185E218619, 0x877373E5527AE8F4, 0x3BC11F3BEF3DC197, 0x23C86C1435B2F915, 
-0x5D5D6AA2878D8EE6, 0x5C6D93861DA9CE2B, 0xF06E2C3A63F9D54B, 0x51DD9A70AA2D697A, 
-0xF06AA9900700E49D, 0xC552428FC3B43199, 0xAD39990EBCA98F00, 0x41399551E0CB, 
-0xB26E4A8B1C649BB8, 0x91CACDCB96A60FA0, 0xF557BB9BB9BE03E7, 0x58FE6FC947EB325D, 
-0x70865DE56597D756, 0x89E1916F4D1CD000, 0x808A94B4FCE35ECE, 0xD9E17D9FE4887A4C, 
-0x8A4203D1B6F2E2BF, 0x69828B37F5F935AE, 0x3345BBD92BB1752D, 0x39986F17A3B0, 
-0x591DF756BFDEB3C, 0xCD73B2317A61DBC, 0xC52175DB7AB1211B, 0xDA2A9002E3CD9CA7, 
-0x3F4C197A520EFC30, 0x98E1CF93C0048D93, 0x73A336427D52BAA, 0x87C2A6C0E177C9D8, 
-0x3B8EFD19EE3F34E5, 0x76F44C73C0E2904C, 0x23DDE0AE6DC2F0DC, 0x139FA9EA12DF, 
-0x709608DCDFD23628, 0x88722D8488C19149, 0xBF62A02EF0EB447D, 0x6B4F072484B6F1D1, 
-0x6A582CD3CDC57296, 0x29B7DAA7E2732ABA, 0x10299E4DEFC68B85, 0xDAF405BF6817EAF6, 
-0x779F7914F41BD634, 0x4B562E4927C87108, 0xC5FC164CDD2118D8, 0x5EB72D325CF8, 
-0xB8BBB7577620B323, 0x8E64132348DE1F4E, 0xB1B717A0835B01F3, 0xCEFA7427C6426A8A, 
-0xB8389A8F705B2E28, 0xCA2D72F8B6042563, 0xCAC9C3F727BDA03B, 0x9D86E86A95838E6C, 
-0x856439772A5F5D6A, 0xF532B493CB603E57, 0x8D1A9424188383F0, 0x35FB99CF94E5, 
-0x6163E0C6D39AB564, 0x13873B15B9388188, 0x26D8C631FFE0B7BB, 0x26AD81B0FA9802F, 
-0xD7C9632C60008A8C, 0xC0309AE0E2429813, 0x30A5D5BD89432A95, 0x514A8314E9ABBEE3, 
-0x488FF37C6BD34A49, 0xB43A9876696139C5, 0xD34660DBE9B28FA9, 0x6233DA108E83, 
-0xDE1745B7451E9998, 0xCB2B5D9857FF3B23, 0xACB19CA35E48468A, 0xF7669C0872309537, 
-0xD5A26573F59B1435, 0x954B176C6773B58E, 0xF01E49C18517D16B, 0xF9EEA12C270F5FFE, 
-0x8ADA0034FBCE5A3B, 0x9190FD64F77E4560, 0x5A265FAE441EBC27, 0x145D562501C, 
-0x6CF3C24F7BFE30B2, 0x1F8C66ACE29E5DC0, 0x6954D0213E663B4, 0x1CB09626B85CCB76, 
-0x40EE13A2CE0421EE, 0x551AFA6694AAE73E, 0x73327664AD79CBE4, 0x89B601152D1C0EA7, 
-0xCF6D92BE293C1BD9, 0xA47BF421C62E49AF, 0x4075C1FA4360861B, 0x2215261ACDB4, 
-0xDAF39BDDB0C066E9, 0xF03DC850DFB4147A, 0x877BA3B34EBBE168, 0x142AF5DC2270EF0C, 
-0xF78054797282CBCF, 0x9F23A142C7B93F46, 0x7F52B2407C5D2C80, 0xD61473C79A43F1CE, 
-0x267726EC3A3F30DC, 0xD06EFC22C768237B, 0x7D8CF53446ABE78E, 0x5B629FAC51FD, 
-0xA1452A4EF7FC31F4, 0x1A6C26EA5885FFB4, 0x48850F7A3B043D52, 0x16EC39A983C96748, 
-0x6B1D7BD2A3B4CB2A, 0x98CE0F0437B14232, 0xDB15C9393F7F1276, 0x2032DF59F5AC0095, 
-0x9C267A4A93F20B07, 0x91B08E5BF49F3781, 0x3F4E3747981BDE2A, 0x207267A162BF, 
-0x4E2B102F9D7B616C, 0x7C2E4F397096D5EA, 0x3F79938E212A2C02, 0x717D8B41AAA13F98, 
-0x767F977781FBA5C8, 0x611DE6C438AAF3A8, 0xD566B042122905, 0x4D96AE0BA70E5F20, 
-0x2BD24FE4E387DF6F, 0xBF7E74F4C52BE11A, 0xD8E9B06C771CF13B, 0x3E9BCC372917, 
-0x8376EABC4A000ED6, 0xC94A69A6EB3CCAC, 0xC0305B7018195E55, 0x10C3DC04565D780C, 
-0xE11000DE2F21C056, 0x53FB26198AB0EAEB, 0x2F79050135E67544, 0xC2163727DEC06472, 
-0xAA532EB67350C2AC, 0x8D9805DDA0C04B82, 0xD43546531F97FD66, 0x56528F236D35, 
-0x9D8B7422B7BF5156, 0xC32EEA62CCD91210, 0x80EDAD8B2BC125FD, 0x75C2D16EB59DFB67, 
-0x81F3421BBD22E660, 0x62E16C44B43ADA69, 0x4BA4231E59D854A3, 0xEC36C2482C85A6C9, 
-0x3136D72D79BF4C94, 0xEAEE16EA79675E68, 0x31B791FDD87EBBC0, 0x3FA344D0B077, 
-0x7C4A57F6FA1971B0, 0xF5CCFC1E0A7005, 0x277A2E4E5DA3C54D, 0xB9E51B2AF0028B78, 
-0xBC2835DE0EC2CA55, 0xB06767C8E2E022FC, 0x9143F2EC30564710, 0x4B98F4EA17D28D9F, 
-0xD62DC36751C0BB46, 0x5CE7F1B322DA2F1A, 0xBC205CFB1F8EC09A, 0x208920AA630B, 
-0xC00BFA1471701ED7, 0x7AA6C17076EDDCBF, 0xA93E67FE975408B4, 0x2DEA2A8AE55D23A2, 
-0xD8E5B02DF2AE085F, 0x24E6A465593EC6C9, 0xAD30F5230B268346, 0x6E1E46E221115D8, 
-0x6D449BCA3EF9403D, 0x9E97940353C64118, 0xC9B913B11BCC0A3F, 0x4D6E31791982, 
-0x17AFC6B34798DCBF, 0xDDEA57798CF05C17, 0x5301BB3BF08B0549, 0xFE7A0C6FD7C246F5, 
-0x2F2CB59CE85F452A, 0xA04C52884BE856BE, 0x46BEE58AA7105649, 0xC6244B8A211DD115, 
-0x322DB634B3F7E8F7, 0xD9F8245EED46FA71, 0x9CDCF6677372A72B, 0x18A662C13644, 
-0x1AB84BF7C492C676, 0x349823F69F4B28EF, 0x33B8F0D59B738B2, 0x61586F55C6C451BA, 
-0xA0BFBB67B2DA6FDA, 0x4A4DE4BDAF560968, 0xCA14F5CB8F9496B, 0x480B1D32D94C5EF9, 
-0xC8ED35B1B2F009CD, 0x881516E922604810, 0xF6CE11F8C674719, 0x4219554A9D10, 
-0x84A3484336D74738, 0xA493A7A18F377406, 0x41EBDA6E6F71E7F4, 0x44DBB1F0EDA964B9, 
-0x6B0F7139F68E1C6E, 0x8F267AB4011DE72C, 0xDF2316DF53524E2, 0x7466C93801DAC736, 
-0x9D285D41F9471E2, 0xA7EAE3F5EDFC5841, 0x46666AE1F3746011, 0x6992338F54E6, 
-0x8CFD6813B236E4AB, 0x72816355FCC52B, 0xE1CAD8360550925E, 0xB28D6A0A589BFB6D, 
-0xAEEADC390DFB7A47, 0x373D2CF77BC6DB55, 0x560897D9E0FFB9DF, 0xC5F0FC75009056AB, 
-0xF579C2011D194517, 0xE253277E56973B7F, 0xF2C2EC652BD5BC15, 0x690BF812B5D6, 
-0x4DEB2D25A98B2F9C, 0xC9B081FBF2D6BB64, 0x532AE5637DC379C3, 0x6C7779BE0C45A1CB, 
-0xEC54237DCF5EE728, 0xF883360DB0E83280, 0x4C122EADAF59418B, 0x556528A5B254B0E7, 
-0x79F89365F529EDE7, 0x3BBC5914F3CAD861, 0x38F3651A1CBD5F2D, 0x1A86D3CEE9DA, 
-0x89C81A3A302695B9, 0xB64C5A2C76E99D32, 0x37951AD96EB3AD1A, 0x6915C0740C8DF1CA, 
-0x11537C3108112D7C, 0x74B1BA91CDD1A61B, 0x779043BBBEC204E4, 0xE20CEEAFDA345557, 
-0x369FC8354D40F741, 0x9AE3814154B2111D, 0x445BC0EFBD895C26, 0x378B5A7CC1BC, 
-0x9A4E05E74EC87AF, 0xD2E23FB72FCEBD9E, 0xCE4DCA7412422236, 0xCA94708EDC329219, 
-0xCB38680685F4FB4A, 0xDCBBABA0726A3B9B, 0xAD9FAD66756CF321, 0xA1D6F990A1AABEAE, 
-0xE6D5CC726CD534E9, 0xB8F8F294102FD69A, 0x388C835FCF7C426F, 0x46C7E5427622, 
-0xBEDEECDA55EF4B1C, 0xFEEC2F0EE67905ED, 0xE4B288C6A075AE47, 0x5862AF91F22E50F, 
-0xA07817BE181C733F, 0xF2788A6E568FCA9B, 0x52A1A26B14EA0741, 0xB524DF84B8EDBEA0, 
-0xBA6DEB7F16BC17E4, 0xFF5DF0885356C5D3, 0x4A80F3E319049046, 0x610A656E5E29, 
-0xD58B2A9630A33410, 0x48932DC0C8186EEF, 0x44BE848C569E8F1A, 0xD343920D328A5717, 
-0x4C832C7A3EFC7C5B, 0xCE73F864F94483AB, 0xD5048CC356224F9B, 0x2BF75CEEE25A310C, 
-0x52E0728C0BA9004E, 0xD60A72DCABE7AB82, 0x619F89F176E8A703, 0x6EC1A73D2F3C, 
-0xE1E3276678DED4A3, 0x4E5FF1BFA8D7B3CC, 0x7225684665428FFC, 0xBFBB82E47CC2EADF, 
-0x2FE0AD026DD0258F, 0x9B3F283B544084EB, 0xE48399A26BBC421B, 0x2566BC40EB879434, 
-0x117040D686A1F9, 0xA70ABA927D5E69FB, 0x6026C842775848D7, 0x435E41EF79F3, 
-0xD73E87348FB2AF93, 0x4CF9B68AB9E8DC3E, 0xD1C2FCDFD5D73533, 0x3FDDB3397F516745, 
-0x29A0802970F9626D, 0xD21AA482E99BC881, 0x14E66507B3C1672E, 0x6B3A1858F12D1B72, 
-0x4CC5D170B2629CC5, 0xD77F418A1AD76BC2, 0xD69C5752CBB02D3A, 0x1B63D370AF5E, 
-0x9A06CBDEAEC2680F, 0xA4A83AB5AAD205EA, 0x316E10E8F76ECF19, 0x9CDB73169C7659E3, 
-0xE1C5FD6B414CDAA8, 0xC07048FFA385F604, 0x13C8F8A5D4B3F0EC, 0xA6D01016B48526AD, 
-0x12DA4472E79CB65B, 0x31C87E646D997B7B, 0x499DB74ED31FE585, 0x173DC8B2E309, 
-0x872A20CFA87FF572, 0xA12E4A783187F1F0, 0x6E44B5B4B6446A1C, 0xBFC648DC30D997DC, 
-0x98BFACFAFBDB7B1D, 0xE77785F76BD79955, 0xA86A990E690CCB84, 0x96EF505189EF1743, 
-0x991E4E934C5FEE06, 0xBCAE24A533E9AAA3, 0x8A4D3287F2B77776, 0x1C0E96EED203, 
-0xFB55A2E109695269, 0x68FFDF765409E6C6, 0xAC0EC3EAB8BECB37, 0x652B974D73C8AB8E, 
-0xFF8E03DFD4F1450C, 0x4314C367314DEAE9, 0x8BAAEBF6ACAE2E01, 0xD8B0D9EDC2790769, 
-0x319588D793D28D2B, 0xF3B6DDDD2909A939, 0x5D79C91DE00D412F, 0x1C777CA4B943, 
-0x146EE289C820179B, 0x5653F62DC3600F84, 0x4A77BD92FFE292B2, 0x2488C6257CADB8AD, 
-0x874DF11200B0091A, 0xCCF060088C82D2AD, 0x4D7E2D09F414E151, 0x34C524581247BD89, 
-0x948BD094284BA84C, 0x4E4B74B4030040C8, 0x72E0ED1B9CDCEAFC, 0x4F5937FB2FBA, 
-0x1896AC6DB1BEF20, 0x6EA10B0013502096, 0x6D62CCF645DA8CCD, 0x740BDB2CDCE2DFEB, 
-0x5D6A38BE7226A400, 0xDBD308C72A7880DE, 0xDBA59E9F64352DA8, 0x575754883EA78FCB, 
-0xF82563FAE75B8ED3, 0x606A85ECB13C8478, 0xA5F50401D4AFE42, 0x68AC5EEEA091, 
-0xC9155D299D5A1E0F, 0x55B35FE319227490, 0xCDC6C84C6701C782, 0xFC09F8C9045B6DA4, 
-0x2CC9304EB655C5FB, 0xBC8B2B1C609AB70E, 0x2F47741C8F095A8E, 0x7C96047F0D5B787B, 
-0xB336A9BE1487B469, 0xE959AEE280C39FB4, 0x4BA3A8E88D17C163, 0x3674B8F85443, 
-0x171999689F4D5B47, 0x59B4976AC12A5FD1, 0xFDDBB7E32561C05, 0x5D35FF11583DC939, 
-0x8C1A4E744F9053E8, 0x476984F406D60415, 0xB3CFFB93CEBF3F21, 0x43EC019C6D45963A, 
-0xDCF365730EC46CEF, 0x28750A8366039AFE, 0xC3D12B1E2980DA0F, 0x1FFD1D1CB861, 
-0x58B73A40F7486C6C, 0x90D87C89DC7013B3, 0xC0A2BD3584A1495E, 0x1AE5C7F744C714FF, 
-0x52D3C53DC3854420, 0x7A7E850DB8AA094F, 0x2EC935B835231744, 0x2B68234753947AE4, 
-0xC1EB044B8DE9C90A, 0x6CDC44FB7F02E30D, 0xD3BACC7A69A5BBC8, 0x12E7205339AF, 
-0x2DFF1E14B91A224E, 0x5939C161B1ADFC21, 0x30DDA640190B35DE, 0xF29FE1987CC58A03, 
-0x4CCB1EDA7141DFEC, 0xEB3DAF238F96A98E, 0xACC132CF56410C97, 0x68B9B83EC659798D, 
-0xB02654DABBC2D314, 0xAAAD5DEBDAEF7A34, 0x6A79D0B3FFBBDC9F, 0x369750E2C12C, 
-0xB84E1DA14DE3AB39, 0xD2A6E8B10C5F7384, 0x6EA6681AA3044D, 0xC4C5DA544683D63F, 
-0xF7DF9D28B0953529, 0xDA0EC714E21E63E4, 0xB3703BB6AB67F797, 0x4754A872642C07AD, 
-0x728B2051F65A4A5D, 0xF33711D6EFD78874, 0xE58F16028A7C7FF2, 0x1FE0195094DE, 
-0x947CF13B18D91AA9, 0xB7D852A5F306C8A4, 0xE5727510CB76A20D, 0x8A59FEF2DA5079D0, 
-0x6FB2D69EC71CD0D6, 0x482D551662FC8507, 0x836324667320164E, 0x33F9D15102E30264, 
-0x5036AB0322AED704, 0xED891A7057D93ED, 0xF4E4BD934D3C553B, 0x6CF00CE873F3, 
-0xBCD7FD42EBB28432, 0xE950A75B100C6CBE, 0xE3165347C1768E2F, 0x1E3C6937CCAD1874, 
-0xB45C5AF2D88AA2C6, 0x3311AF1EE5A89DA9, 0x392273C8DF1464A, 0x409AE323411DB458, 
-0x54B4C0E2A00821EE, 0x60F7310CAF626D16, 0x74E26A69E5C5794C, 0x15A6FB1F8FFF, 
-0xD5FB4B81892E5B25, 0xD7E52C8A2AEC7A6D, 0xC203F6EC187DCBC2, 0x5A929E976906CD98, 
-0xD8EA8A2097DE3577, 0x79787771687A313C, 0x1C5E922B61DCFC6E, 0x873C601386588330, 
-0xCBD02737D6706B27, 0x7E457CFFE07EE9EC, 0xAF6B26833068A093, 0x329E99EDB740, 
-0xAB8E18D010B94A67, 0x2BC1F2F4EE69D922, 0x5564F54C3423761B, 0xC9F7F93F5FCF8240, 
-0x3E3D15F22EE34C6D, 0x39BAF3B8EE036402, 0x909135F965413C1B, 0xF8F330EF62E1B3A, 
-0xE0301B730E577523, 0x9C06A4DDC87C6400, 0xA61FDFFBF88D98D5, 0x272A479C495, 
-0xA6EC7C2A13E4459A, 0x805630C5906DB1E4, 0x2F183F6A1D849FC1, 0x65A9677D316FA8E, 
-0xD51EE1222FEE6A07, 0xD955B8B66046A156, 0x6A42B66ED644D998, 0xDA2B226A93C0D248, 
-0x2CC2853E3E27B5E8, 0x5530622ADCC1CC7A, 0x52386477778E7221, 0x45907AE82CA6, 
-0x8FA66FE88AAEC818, 0xA7E17B393B78A594, 0x50C146EC3D2CC682, 0xBB8DC8EDD047E8FA, 
-0xB995592DC28B697F, 0x5FBFD37518EA7EA8, 0x6FF0C7FD0BA8C9C3, 0x1DA889F968EB5474, 
-0x23F4C5FDA8EFD02, 0xB67DF477A5AD0732, 0xECE7CCA11AA03D93, 0x5846BDBC50AF, 
-0x40F5EE88F8B602B8, 0x8CC828806495FB0A, 0x2FB92952A319EA0A, 0x54C6D177233F3C87, 
-0xE33C7B1C5E65356B, 0x2CA82491A0C6EB34, 0xDCE71871560894C6, 0x8F8F5899DA9BBA90, 
-0x15D815BFFB4D01F6, 0x7C4213548BA992AF, 0xE8F0EF802401C26C, 0x1DF755FD2A3C, 
-0xA454ED2F20030610, 0xCF6635F8177E976B, 0x75FF37AB54ACA863, 0x31A5CD47DF7BC3FF, 
-0x7F1B491D5F2E28D4, 0xE7A1400A924B0420, 0xFBA30C9FF07D06A5, 0x96A29793C2B745B9, 
-0x9442AFA4173358BC, 0x9C064B2F115E71C4, 0x74CD38376E3A8584, 0x53BD862695D2, 
-0x525011FF7053D1BD, 0x2A4215E20D78ECE2, 0xD7E6A741F337FE1A, 0x38A73930F4A8C77D, 
-0x7BF75A38E09FBBEA, 0xBCDF84AF6DF68EAC, 0xCDA8C17A58F2B855, 0x5B5F29F0E54DD10A, 
-0x83AC0BFBADB02DBD, 0xA45631C701E90255, 0xBF836EA8D059C32F, 0xDEAFB8314F3, 
-0xDAA48F41E0DEFC28, 0x419D650C795B98C3, 0x1EF57541F4A1B879, 0x8843A20BA2EEB787, 
-0x1B68B615AC0890BF, 0xAF690739F536C001, 0x7482803A6607BEA6, 0xEE3E14D994DEC5FC, 
-0x1E9BECD7ECDF4B5F, 0xE855BF3DF9779665, 0x4A6EFBFAF61BAA9C, 0x40CFAB0B12D2, 
-0x5B1D29B0714A4E2D, 0xFD08FC47178C9763, 0x7FB7C5E99D8CECEA, 0xC7CBAAF6726CBEB, 
-0x8B46A262F821C290, 0x9B96A3F4373079FD, 0xC840EF9B6DFAABDB, 0xBD4C1890E2FE3643, 
-0xB3ACEAF0D63B34E8, 0x5ABEEC74A6B8AF3F, 0x3C546E599AA46F36, 0x55F99F2D997D, 
-0x49BD0358B747B8FF, 0xCB31212DDA4AEDD8, 0xA046295532FD4AA3, 0xFAB8AF7493F3F673, 
-0x186FB1ED05FA2660, 0x2F9D6E65331DE2CC, 0xEA14082B49CFC293, 0xACE2811D335ED0C6, 
-0x13E483E18CD0C324, 0x38303F928A4C02B4, 0x107ED447C0976D0A, 0x39B78671D331, 
-0x615433B06F8C2B2C, 0x7AA972EAF0D953FD, 0x45EEB32A37719A27, 0x680AE8CC059E4031, 
-0x789D1CF5BCF54670, 0xFBBABA41DFA5FD21, 0xD0B3E2B4A52699FF, 0xA7D36CC74B6CF069, 
-0x6279DA6908C332B, 0x1493BA827DC63B36, 0x1D28C8316E1CC305, 0x449DE4C707D2, 
-0x59419B51AA388B22, 0x14892D4512E5B7C4, 0xEA85F9A7B0814FC6, 0xC409E29D3C4732DA, 
-0xF5F4C8BD9BDEBE01, 0xFA7F3758365A27F9, 0x2262071E4CC23D82, 0x83BCA5E0A20D58C3, 
-0xB4D8CD0C6B5D09C3, 0xCE0EC1C45AF1DF7A, 0x3B2C4EB61A7E5C89, 0x6BA3BCDE8F71, 
-0x783F99067F5AD090, 0xDEB3320268FBA65D, 0xBAC8BCE03F6E10EB, 0x736D375F2CA8A454, 
-0x6CBE5C37DBF52AF3, 0xE1A0193755325B16, 0x77498C4BDC7FEE7E, 0xD80C4E7A3115D784, 
-0x13380B310D70BBD6, 0x85299FA27602DEEB, 0xEAAF8298CE21AF83, 0x5CDAE7DA9021, 
-0x3030E0C764107AAE, 0xFE5775948D686DEC, 0xC2E966422B1BE9F4, 0xC588917DB16BFD9C, 
-0xD259C056C7EBFB20, 0xF45CBAE18F6FCD1C, 0xFCDD262A7607FD47, 0xF157E555F01FF812, 
-0x74ADC08C5B8C928B, 0xEAF67DE364BA982C, 0xC8903D6689A95E9B, 0xDAC8604E51C, 
-0xE2F344376BED1025, 0x6DDFD6CDF9730324, 0xD91F400DDB5BDC84, 0x30D07AD0A726E624, 
-0xAF3FA69F3C4A07F6, 0xDF7F080552E4CA3A, 0xAEE540E977DD0EBE, 0xE1AE1B2A6DEF4C78, 
-0x3C8629B5609A9520, 0x13DED6F4F08E63FA, 0x7B3ECEB374445DA3, 0x7707798EC3B, 
-0x13B90123199052A5, 0xC228A3D33EBCD58C, 0x866156A250C82C09, 0x4D22E2B98D6B1077, 
-0x4A7CDE5FD9B09910, 0xE46DCD8D5C96AC29, 0x4C9678745A879976, 0xE7DD5CA2B57B17E7, 
-0xF1CFFF3369622F46, 0x39DDECB7B437A292, 0x921115A2FAA4D4CE, 0x6E996FABE222, 
-0x205B1A584EA05DD8, 0x9E79FF52C0F36D4F, 0x224112305642D4F7, 0xAD94AF18B3F2B5D7, 
-0x931C9BA436E2574E, 0xBDEF56CAD118BA43, 0x53CC8AD226FE43B6, 0x2C54639D76E71391, 
-0x148E6B994303D897, 0x47005F890EAD1D9E, 0xB7043F539301B20C, 0xA9709F7D7AD, 
-0x79912C8F49140A07, 0x7FACAB5EE6E7D348, 0xE97D2BFB35E54DCE, 0x3FAA49F458C58B47, 
-0x7237D405EC2A0849, 0xA5100ADDC7AA3FF5, 0x4E74EC4B560F7417, 0x6FBAC95E774CEF4F, 
-0x1126A123C5A2E9D7, 0xB761499ED46981E3, 0x8D189AEC01968F1, 0x60F0C8EEC576, 
-0x9437B2E80F93563A, 0xEAA10FAF5D9DD9C9, 0x586270C66CC35B72, 0xF599B0DA89911B58, 
-0x1B13551AC0B0D0AA, 0xF73527C2E21D00BF, 0x8428D10FD6FA962A, 0x39431D2CC5FA11D4, 
-0x3F83CB2E1323635E, 0xA3C18720DBB9A64, 0x29A197776E24FD3B, 0x33A49EA3F69C, 
-0x8F53CF66CD63BC01, 0xE6EC1E8A0C6AA347, 0xB5365EEF6DD7E57B, 0xF0461DA73CC494A2, 
-0x84DCE77A0A2C2A5, 0x8B3E0A0028671E3E, 0x1FCEEFB0BF726172, 0xC684236B66EB6A03, 
-0x435FB02249D07AB, 0xC8630974AD0A32EA, 0xB09AC90D1A15AA56, 0x528862025C64, 
-0x43BC26EF609539E, 0x7ED824456C2D99AF, 0x25777954F123722F, 0x55A74069AD373831, 
-0x5EFF1BC949FACD4D, 0x5962BF92EB06D77D, 0xDBD38AD77FE469C0, 0x41E1EF8837C8121F, 
-0x2B89BF8554260F3B, 0xAC9D71A365432AA0, 0x3790FB9364DFF961, 0x35281297B25B, 
-0x45142E3D11196AC, 0x4982060637152462, 0xF46B959334FAFA31, 0x350F5BA347D29F24, 
-0x35D846AC81F9A1CB, 0x37EE5DEB670B5808, 0xB6515F9A82904494, 0x2B24E88E6A660B9, 
-0xA76CE7CFCECBC8A5, 0xA4F632E998A55D0C, 0x5F49A6DFF6E807BA, 0x255B349EC329, 
-0x6AE388C72DA972A4, 0x592B26221F3811CB, 0xD29D43EA9AFB18B7, 0x3F9B88AB5E7E482D, 
-0x1E49BBCE46991A17, 0x5BF12E974FD986E, 0xC6DD9ABF59827DF, 0x45B4D863945C557A, 
-0xDB87AD29655D730D, 0x6B88B201A7FA26B6, 0x39F88408E9A1DB21, 0x4224954EBA90, 
-0xDBEB0483C826CCBB, 0x7D889CF9D87DA076, 0xC0F5672A656F98FB, 0x2834A9827D52282D, 
-0x77DE2CD364CB574C, 0x3344E5A9A8E3F409, 0xC7B83138A0D1123E, 0xE4D67A37C48AC8B3, 
-0x7247AA02CDD6EE75, 0xB2525822AC67AAB4, 0x18CB002A219BDD83, 0x2686904AE507, 
-0x46579F86BD59B113, 0x1D4F0472E5096744, 0x8D489484C95B000C, 0x8788B238B114EFD, 
-0x9695AA39CC58DC2B, 0xDCA16233D7BCDCFA, 0x693102322F64852A, 0x19F841E39380A3F5, 
-0xECDAAB820A163E58, 0xF26151B73FFEF485, 0x276DEDC2D829F3F5, 0x1C53FFFEF817, 
-0x330CC3CBE12B79AC, 0x2C55BAC9D6D3403C, 0xBDF87169978EBC21, 0x856752D3559B41E7, 
-0xEFB2C425119FEB8B, 0xEAA09E173CAE094A, 0x664CC8031328F07E, 0x3B8A9CE5077E91BD, 
-0x7C6F70A6794EFF7F, 0x4A32E829EB42A9E7, 0xE7CC750BF7ED80E4, 0x2F63C0592769, 
-0x194B7CF48DAE2C03, 0x9FAE1B3741F06F14, 0xF406410B33682BE4, 0x4316D434028E26AF, 
-0xF0E21E6C918D2078, 0x933968EDA292CC50, 0x44986CE020A490FC, 0x2D071A4BA3B07AF6, 
-0xE2DDAD341520D245, 0x534E10167BA055B6, 0xC2F919723ED564BC, 0x5F1997CEE41E, 
-0xB1DE0E2AD126E6D4, 0x6F913380CEF98015, 0xD202C54D225119A9, 0xA4951C1CB3DFF2E2, 
-0x14EC8F0A44671648, 0x23DB7D9FE4BC0FE0, 0xF42E0F56912C4D1E, 0x3B53193942342B1, 
-0x95064843BCF54D8D, 0xA5E1D9A6751B89F9, 0x7AA3B49B80201934, 0x5C0C7FD80162, 
-0x9063DD7A7413399E, 0x26B85B7EEB6CD50, 0x2D9AA240DE84CFD0, 0x962BBC54A553A127, 
-0xC1C2AF9D82F9E322, 0x75086EEDE8C45FCE, 0xB6A40AF9FD8D7BC3, 0x66EC34796838056F, 
-0xBF92706F780AE414, 0xEBB9DD5EA2AEEA76, 0xED8F9311B530F13, 0x15C0EFD09FFC, 
-0x398F7A2F4D9929C8, 0x5C1A250DDEF4D2D4, 0xEC165B5D5EB4070B, 0xF3A225F8DFF2135E, 
-0x20F2C6631D19C52, 0xDACD1A7D00A3E2FA, 0x68376A47F492ED9F, 0x16628EBD3549DDE1, 
-0x533EDAA771D7CD5, 0x3B4307C0A050B576, 0x32599109E0FA7E43, 0x59C37F474201, 
-0xAC7E825EF5D4D86E, 0x17E351116108DA9B, 0x631424C0EBEB27A0, 0x82C8B2EAAA6131EF, 
-0xFE6B14927314ACA3, 0x9E97981239CCF8B9, 0x7AE7F89672CB7009, 0xE72C29FAF1730472, 
-0x90005F2308EE319C, 0xF25133EA4A802AD6, 0xECF3BC1C8BB7499A, 0x10E8E07D0333, 
-0xE7EB8CEB1CE4A564, 0x7B83F1BF0A157AD3, 0xDAAD784CBDA6BC57, 0xF917C90939F2F156, 
-0xDEED015C8053BC, 0xB06DF92A2338850D, 0x1BBBD69A513D06FA, 0x26B25406A5009F2B, 
-0xBC96A9D2E4F2EC30, 0x96175A394F52ACEB, 0x264134D1A5EF59FE, 0x30CF2BBDA116, 
-0x909A89BDC0F9DE35, 0xE49FEEC2BD254847, 0xA059744FBCBD0F96, 0x88A712A4619F36BF, 
-0x4FC7C3ED06281848, 0xBEFF00853CEFB68, 0x7B757160F903BD2, 0x4B2004090392FBF4, 
-0xE37CC43B4328CFE3, 0xC83A76F7683C9752, 0x37A97CC34CF0B5D8, 0x4C324FDC7B4E, 
-0x7D2E4A1FF98809B9, 0x95D34E5A6967327A, 0x8E58AEAB3BC49E5B, 0xB986C93BA68377A1, 
-0x2E1E550A2E269B3D, 0x74A73121937F7A0E, 0xF42E0A76FE766AB0, 0x7C4D98FA20C58113, 
-0x97C64CBA273005B, 0x6DBC3464592557FD, 0x51C9375650F3F91E, 0x1004A2FA9E2A, 
-0xDBFDD284BF173868, 0x5ABAA803CA4B508B, 0x8B4E01EC27601533, 0x22A7C0D867C188F8, 
-0x8B973BE5A9DA1EB7, 0x2B20E8B5805AB5AB, 0x202CF56609D16A6A, 0xBB6C94D2B89E3761, 
-0xBD0C2DCBC69C9A72, 0xE4852977F14E9EC4, 0x3DD3A663626C1F7A, 0x2624E762F5FA, 
-0x4877CDD3F1A73581, 0xA07846CEA60C0A31, 0x4411B13D7062FDBC, 0xF37F268B482E5364, 
-0x8D45ABC2BD815426, 0x342405BA716DB08A, 0x27CD92CF2BC3C784, 0xEE80F57AADC0DA04, 
-0x7E7AEED3F57E82B1, 0x5B6B5F324B049A9C, 0x8F6DE7E19A02B750, 0x55366B9FF145, 
-0x8799078876BDDD38, 0x72D09EA810271451, 0xBEEC6FEF1743709D, 0x69754BA66BF7EDDB, 
-0x61A0C32F687BFF55, 0xDC85AE3836457C10, 0x186DC209C7C21020, 0x46D2643FACA2F3D4, 
-0xF94D535004B184D7, 0x733DAA749A133812, 0x889E5710060F4FFF, 0x61E8C9E9B2F4, 
-0x8544D4ED01A64933, 0xAC5CF68F7C54B01E, 0x829D04718D781237, 0xD544B9741A57B97, 
-0xC06BEE422E1FF1D5, 0xF2BF0AC59707820, 0x118A193082348585, 0x9B8470F5AD1925C5, 
-0xE9AF87E9154A41A, 0x3255C0409ED3AE41, 0x9D9286C20C58B6E4, 0x1B36DA22D6B9, 
-0x99B1D880A4A03FFB, 0x3EF8B8BEEC445636, 0xEACA8C9C5356500A, 0x50778AA48DCC1116, 
-0x842764C82C59E675, 0xADABDF264CF341D0, 0x4BC27DA6822E0AD8, 0x7C740CF1B2084D95, 
-0x967BD67CF9BF4B4E, 0x3B0E9B2EA90146A4, 0x686152C5EA5DFEEC, 0x36001AAEF62F, 
-0x88E3AA69359B7F71, 0xF61E62067F2AE53E, 0x9431EF010C7D704B, 0x390EA2EA8CC9EBCB, 
-0xA7041BB36E99E179, 0x4E18ADAC14962817, 0x7098029E6D37CC9D, 0xADF01E765214AC67, 
-0xD62514D6600A9DFC, 0x2C2C4A40C496F6D1, 0x69ECCD2D8B512500, 0x1D013192EE1C, 
-0x2F116B1888597EA3, 0x4D86D34F481A4C4B, 0xA83E96FC475C5EC7, 0xB8918FB72CA16A7F, 
-0xC23F6F9D07EC4C50, 0xAC70E8B865EB7672, 0x15072C8B66FC743F, 0xFA1C4FE8C72F3512, 
-0x5A2F51D64FDE0CEA, 0xA30BC773F0E344BC, 0x423282FAEA512479, 0x6FA0544889AD, 
-0xA386A6A7529E6B59, 0xFEB61AE9A4832624, 0x3193F67ABE7FEA92, 0x8724458D4463333E, 
-0x768A65514D55674, 0x1A55D01107D69AD4, 0x5E6A2BA5A19AF132, 0x8561D40D4BAB0C17, 
-0xC4CCBC97E7AA395E, 0x6B81CBE45CD23DFB, 0xEACF1E1B247669A6, 0xA6D040B6179, 
-0xB0423EBE6461C452, 0xEBFF40C81256C2F3, 0x806696A0994DFC7C, 0x46E215C8D8A20F54, 
-0xA033998913755E32, 0x3C8472D6BC655862, 0x1293F75A5A38F3C0, 0xF2FEFE8AC39F8D21, 
-0x947F028DD1D7A6B4, 0x24E18E2FBEFC0CC8, 0x711B507322C923EA, 0x44DBDA6ECA21, 
-0x71A133AB29498F2E, 0xE1111329BF8402AA, 0x2FFBD7D7DA6F881, 0x2CED2B2E220D58E6, 
-0xD1DF8B6FCADC8067, 0xCF95B555667C6EA4, 0x3B01DC62CBA30F7A, 0x35C7F7E9829F9EA5, 
-0x56F1752546F3542F, 0xC1AA9314CEA1C15E, 0x60D01C65E3CCE1D0, 0x58CB6EFCC3E5, 
-0xE70AC8DE3E006BD3, 0xED5D4B9AE9BA127, 0x7EC6F6CB64EA672, 0xCCA35ACC257B7, 
-0x40C9A07A26B3D63D, 0xA61C5D43A840B379, 0x49DA33FFA12F569C, 0x2C1BD0A972BE7F74, 
-0x8FA408466152B6F1, 0x90AB9C37F7D31982, 0x8728D479BD5AB1A1, 0x494AB9597122, 
-0xF688490DDB38F44, 0x8D5EDE25353D99CA, 0x5659ACA8CE30EE94, 0xDEC8A99DDD15C7CE, 
-0x24857840853EBB71, 0x77A9AE6BD2171E24, 0x393C21DBE9E50DB2, 0x9C131854B2FC96FA, 
-0x66413322341EB284, 0x2EC02FE5350CF32D, 0x611BDCDA70EFDE7D, 0x3E67A1DE37E5, 
-0xEE91C4ED6EC16ECB, 0xDEE398E8FE99B491, 0xA8AC6D40C14C4AB1, 0x89AD1B136ABB523E, 
-0xDC30B0402C4B7A87, 0x7606A3E2DBF81044, 0xBF4B5A3042A1842D, 0xE98E10793D514F41, 
-0x87ACB412DE58E2C5, 0xBC73516ED421DC21, 0x178C7725BA1B118B, 0x23B7920689FE, 
-0x39E148F6A78F41B9, 0x5AFC840FC854AC8D, 0x1DB0C87BCF8BC71D, 0x620452678F952B6B, 
-0xF456E78F0C0710BD, 0x2F61F3C688FC3ABD, 0x306B4436A7EC95E, 0x70998F21A2E06266, 
-0xAD881FFD12743344, 0x49922E20C936AD53, 0x5EB7C1238C033B83, 0x2E0E42EBAD37, 
-0x78FCCA452F4BFE6A, 0x90BECCB7154C112C, 0x5D4960B4980C4BBA, 0x55F840150B9EBBE1, 
-0xAD2DA4FC3DB2919C, 0xDFDB9A399091D39D, 0xEA2261F2B1EA44EC, 0x8406BB819070D924, 
-0x54028C0850F49D9C, 0x51DC04DD5A9E2E6E, 0x139E8E5992F900F8, 0x2DE8CD9B5CF6, 
-0xB5398C46BA0D16A2, 0x1645A85C72834695, 0x6766EB375BD21A0, 0x97F3CD2A868851D4, 
-0x5D6A7EF9DD62008B, 0x17A2F749630B147C, 0xAEF1E8FAB9B52DB6, 0xA181B895D8FF8F76, 
-0x465ADEE4312B3D7E, 0x8C88E362D3C6B515, 0x35C46436ED0AAB83, 0x119D8F0CEC8F, 
-0xC8458E4BDB6DBBD6, 0x625FF3EAF0D75492, 0x43F9671EA832CA6A, 0x9D91FAE79C855E5A, 
-0xA98018A8989A546B, 0x84B389FBC8B0EA5C, 0x77911CA0BBF54C26, 0x4E38A2339CFCC947, 
-0x71945E0D297D169F, 0x56900323CEBCD41F, 0x8230C3F476702CFD, 0x27CADD77D17C, 
-0x4D86F93A1AB3D712, 0x76912A405D3EAA88, 0xBA6E2901C3E3A5C9, 0x3B5A27140DFF7C5B, 
-0x5384FCA427D476BC, 0x42FCAC42302B3858, 0x35774698D64E521, 0xD5BD777573B77CC0, 
-0x153F1DD3C2E5E036, 0x99FDF10E4024DDE3, 0xC4B25459255D2F83, 0x297108C0F6A9, 
-0x17E7B11BBCB1F0D0, 0x9EF066B5F8F2CFEE, 0x9303E20695D60D61, 0xDDF4F805DA2C473C, 
-0x4E805DDA588C36A6, 0xC836D3DA00E551AB, 0x8804143880DDEC19, 0x742E440D9279FA0, 
-0x50A73882FCFF64B1, 0x94F171328BEF7C27, 0xD9B5BC3D79024362, 0x49D9BCA7BA9, 
-0xF57BD020A88F907B, 0xA3868975AACC53D0, 0x6DC78F1DBF0686C7, 0x2EB647687A3B24EE, 
-0xBCEFB1AC0B79E69D, 0x66542958641F26E6, 0xDEC15CC6F215DE53, 0x64E7653CF38FA7BC, 
-0xA81B126D593BF573, 0x670D7EC3DDEC01E5, 0x97FFB81801219156, 0x5B3A798B7372, 
-0x47E5D7D389CF0A56, 0x90662BBF4D846DD1, 0x4081AD00FB8475A1, 0x81C662D7175553F7, 
-0xF3DE703FA2DABB0, 0x59731FF96D76216C, 0xFE7338FD879403C8, 0x199AB5FFB3BD1333, 
-0x73ECF3871DB718C6, 0x58923DFA9375E81A, 0xD34FA5B495C28509, 0x4974FD6A495A, 
-0xC11DFEB87EC0B61B, 0x453AD6373196B5B3, 0xEF24B4B2DB48DD7F, 0x84DEFB1F1B424239, 
-0xDECA14804D494456, 0x896498CC80264AE0, 0xC8DFF98717B9AF5F, 0xFC6A847DD0DEA108, 
-0x8D00E48542CA62FB, 0x3FCDE340C3A2F362, 0x8731950A49A8508E, 0x633BDAC96549, 
-0xABE5DAA3680A68B1, 0x107DD4A06BC6DC93, 0xA8B052B8CE5C1B3C, 0x6E5C4E6FC8A6494A, 
-0xFC226E6305A64A75, 0x44DC457292708D, 0x5D4F3C4DD90A6647, 0x75D4E8F0B2A637A6, 
-0x9BF5B3A632D70247, 0xF7340769B5D7E0DA, 0x2EC074F8A94D9133, 0x15ED39F0A7A0, 
-0x5D4F1284DA767FD2, 0xF1FED25E94BF7B24, 0x2C4E64FB16102CC2, 0xA981B9E918975124, 
-0x9950DAE15934184F, 0x3E6CF2BE56B3F93C, 0xF6349E4D746141BB, 0xF78B8A50B39C07BA, 
-0xE429780D9CAFB893, 0x69C4A22E72906762, 0x63F385D5AB037F57, 0x89DB9DDEB6F, 
-0x858F7929C78508DC, 0x34A0951D465C4201, 0x27AFEC29A6B2AFC4, 0xD0BB41AB9B690F27, 
-0x9DA0DFB2D10A581F, 0xD17D042AF97C951D, 0x3C7E6EEB1050A489, 0xC9C2EE4EDEAC8063, 
-0xEC6862EF032F3BEA, 0x40199BEFA59050C0, 0x1C23D8ED195FB3CB, 0x289752200927, 
-0x6F3F9D4606C1A777, 0x9D44EE286957891D, 0x10C44F48D45F9DEE, 0xF83D0A23BF3F71E, 
-0x780D51ED855F7411, 0x9937F2381B9BEBC0, 0x4E5FB2425D51F04C, 0x68F8B78CB0C992FE, 
-0x917F66454935DDEF, 0x61F8CA99D461960E, 0x1E06D1D9A4FAB8D, 0x30302EF449CB, 
-0x2C1A280A25480017, 0x18F84D217A4DBFA5, 0x10675F3710453705, 0xD5F572752280F039, 
-0xB8F5C52B42A665A9, 0xD5D4A849F4F79F68, 0x432D691DDCFF8507, 0x5D38FA47649A6601, 
-0xF3616C0276349207, 0x426AE99BBA1BACE, 0x39BBFF81EFBA7778, 0x152D09F3D8DD, 
-0xDB77E992789DABD, 0x2DD16D781A5B0D30, 0x69B5CB99E605E351, 0x554ABAA7C93640BE, 
-0x61A2B090C74DA52C, 0xD7A339D34B5B80E8, 0xC4D20A97FDDE1EC0, 0x6BAF4BB3EB6AA5FA, 
-0x4B7047BCCB60A91D, 0x18C5B3A9EE7E616, 0x64038465C49C433F, 0x2A103215843F, 
-0x866416024688BD90, 0x103C6318D08A0, 0x7C85B44FE5F96261, 0xC3C6E2FE36491636, 
-0xABB2484337290482, 0x4367AC4D4480D73F, 0x86D945EEAFA1C857, 0xEDDF44A7CEC7890E, 
-0xC5FE9EFF45AEC3F, 0xBBC6526311550146, 0x6A6EE3A82C3F56B6, 0x6137C0B544FC, 
-0x15B28382D817996F, 0x72FE3648F1847233, 0x94A9E08DCB3C3189, 0x5480C84A12A171F7, 
-0xF9A2478CD70C190E, 0x22B9D054875F766F, 0x690D237261E6CFB5, 0xE287E322B4F22B4B, 
-0x7614283EEEE0B7DE, 0x3187543D6C7D69DD, 0xAF8D16B8D76DBA16, 0x6E487CDB5280, 
-0x3BB563186603F51D, 0x996355949700FCC, 0x43AF37CC1B2199AA, 0x740C4000C1C99E87, 
-0x32F866C78253E101, 0x4E104CAEF6F2F57, 0xC1E87D425A04D276, 0x5C655DF6B429FBEE, 
-0xE9C9972451AA4B1B, 0x20AC0FBB77FB83CA, 0x3ABB3708DC40911E, 0x37B05A734213, 
-0xDB3E783D030CBBA0, 0x28F9D4C9A16A805F, 0x4E113BDBFA2F64FE, 0xB27C1E0BEB4D8618, 
-0x72838094A9C9787E, 0x367AA1769E656AF4, 0x8F528A306C614F99, 0x3B266F6A977DB1CD, 
-0xE3998A43AC96E045, 0x54BE7B51CBED73C6, 0xA82DD87F58BBB97D, 0x34F62CCBB982, 
-0x5CB58E9E589E59D1, 0x4BFC9AAAC190287C, 0x238B193443E1A49F, 0xE00108887FC7F160, 
-0x4B837F8DEBD77298, 0x4DA133155D0A20FE, 0x760F383A5744EDCC, 0xF309C8C71D041918, 
-0xF6FC6F81EA41036C, 0x41A5F2C6B67500B3, 0x64ACC08472ABCD82, 0x6CAF6F119152, 
-0x5EFBEE4DCD0D8CE4, 0x34379673B7AEDC17, 0xE6F1F7696C2DC946, 0xE3F7FDEB1B2D63C1, 
-0x4EB92AA5DCA5D6AA, 0xBE0FC5D15849A72B, 0xD8D96F51025CF6C4, 0xF7206CAF194F1D28, 
-0xA7F0B3127514B678, 0x157038EF8A0BD505, 0x74CB32FF17C87ADE, 0x27B6A98AB43D, 
-0xB7D197B390635C0B, 0x5C5395FC640FA1E3, 0x1F3510250FE26AF9, 0xA7A9BC6951D1AB92, 
-0x934F304469CB4695, 0x7126250DBC092DBB, 0x82AD338D93067460, 0xF3D4CCBCD9A0D637, 
-0x83A01C8079322DE5, 0x82F8DDB542DCEAE7, 0xE80B620D953290B5, 0x60D232F31AA2, 
-0xE861A6CEC0872F50, 0x78D1B878AE3E0BE5, 0x3C9F2E21DF72C3D2, 0xCFC1F154FC69B073, 
-0x18490AE8A7481627, 0xEDE3FED7331C471B, 0xC3B3F0B3BB9284E6, 0x65C5CAB466D5389F, 
-0xA22B959DECA06767, 0xE9A1FBE8D0C1BAA5, 0xA8DEBEB862DFC6B, 0x6673590614D8, 
-0xDC96C88E6F4F9A3C, 0x8D390081A06C3103, 0x77C2FAEA96CF1EE5, 0x246E8FCDD91B576C, 
-0x588AA778430E3C4, 0x41BFE4D5847C59CB, 0xEC016380838B547E, 0xBA6118FE8BE297C9, 
-0xBAD0B6EEC4878DE4, 0x6C5530983D83D820, 0x6306F37DF101D014, 0x1D71A4390EBD, 
-0xED50BA7967522BC0, 0x4A32FB9D3F3960EA, 0x93B20316BE10E5A5, 0xEF78539D6EB5CA97, 
-0xB816B1C1B3CD49D9, 0x3A2AD245FAEB827F, 0x7969B72314DB779, 0xD4218D46EC5A5834, 
-0x8DB055059B15ED28, 0xB827B672C9320CAD, 0xEA0DBE482C10A7F3, 0x12CE1314FCB5, 
-0xA2FB5AD833AE92D5, 0xCB453F05C511DEF3, 0x5C530ECEDD1160F1, 0x24AF7223F08B22AD, 
-0x63922D8CC06ECDA1, 0xB83E435709A2E67A, 0xD7C630E7C584E19C, 0xBC32508E6DB9F348, 
-0x5774DD27658755DE, 0xCCE216491460CC68, 0xD1AC03F231D1BF98, 0x2C1AF6A3DF55, 
-0x78BE7D93837C325C, 0xAD96467243FBF53, 0xF69595B28E5AF159, 0xBFED561E3D486C86, 
-0x607B7034F94A01D9, 0xF0C4DFF0E469F839, 0xB7AE6E1AF2B9BB5A, 0x61ACA0F5A6B6E4C7, 
-0xE16855799F8E9F87, 0x1C09354556149305, 0xCF34F9C0B0E1334C, 0x56E100DD967F, 
-0x3BF8722310B0AC58, 0x77A4409D2DF9C43E, 0x7AB02191C916EAD1, 0x8762B2A643CEF460, 
-0xC1AE80F2B1890E93, 0xDAC73CFEF8F67742, 0x7EEB20FB39C313FE, 0xECF7BD8ADD22A9DD, 
-0x49005C0B3CBE9B62, 0xF79FE71FDFCBF096, 0x79016D603B2CF338, 0x695D519449A8, 
-0xC5FFF77892DF291C, 0x40F847DA54594D4F, 0x57BC52EAEEE7D9AD, 0x7882FFA139788D53, 
-0x83746B829E704309, 0xC74AC7D6E997ECB3, 0x3B50982B69C673F5, 0x1E50A9B6095B691D, 
-0x1C7549B0A95A52FA, 0xFB6E6567385ECFB6, 0xC7E884B1732B0F4A, 0x382EE04A75C3, 
-0x631683DEB4A71D79, 0x21E071EE3EEB8E6C, 0x655FBC1628C1D61F, 0x6790696A0598C58B, 
-0xCC4F469E6D7FEF7F, 0x2970E52CF24F4220, 0xBDD9184971C9E910, 0xFF552ACF0DDA75C6, 
-0x2593CE5D37A37463, 0xF473D9A079B86501, 0xC27EF6EF2F671E07, 0xD5A08D1FCA4, 
-0x8BD24FD7729EE79B, 0xF1E45346DC0437F, 0x15352A36AC88BDFE, 0x4CF288650FCB98FD, 
-0x988C93096F1E665E, 0xED93702F56163F9C, 0x58988F076D7A1FB8, 0xF8A23175B05B219E, 
-0xE6AF86D5855EA4BA, 0xB2F4AE2ACBFAEB6C, 0xE9DDA77CDA48F313, 0x1A060955678D, 
-0x96D898DA7E275460, 0xB2A4474540A7A950, 0x18ADAC67C3E649B7, 0xEF53D47865AB19B4, 
-0xDE1496D3EBFFE7B7, 0xE7E6815F72DF9186, 0x4A6588FB9A4B2092, 0xE481C87E05BE0AEC, 
-0xC87E0AE0F6676F8A, 0x8D4F660CA92AF2B9, 0x2E16C11BD00AC446, 0x95E860E08DA, 
-0xA7894A0F97D338AA, 0xA91AAE963C0D34D5, 0xE38CD97B29B48394, 0x8818C0998B702145, 
-0xD9109235EF5774D9, 0x44125DA8EF20ACA, 0x9921944AA1B23EC0, 0x79720125068E7C22, 
-0x8946453641CBCDA7, 0xA19BB2E4AF10E534, 0x95E5FF5267480709, 0x415384EAFDE9, 
-0xB0D5A79D7DDE954B, 0xCC5834FD470148FA, 0xAE247762A3E18F03, 0xC12B3340D49C6570, 
-0xC976CD39BA478ED4, 0x88F45995970B2742, 0x1C79D3E405BB8E9C, 0xCCE7657239CCA6A8, 
-0x97D5C5451A5F7E20, 0x75DED29CE1B55CA2, 0x2DBE02DC27D38100, 0x69211C9B5A71, 
-0xBB710C29AFA269BE, 0xD223A2E5CB0B129E, 0x1735A7EC19B9E1F2, 0xD03B158E6E2B0E74, 
-0x10B22EA002D01EE3, 0xB4981C7ED8558B1, 0x77F5071D24184523, 0x9793148436A68CA2, 
-0xB5CB038153AB1BF, 0x123AD7AD1B8DE6F3, 0xF2BACEA25C6A8D8E, 0x4A1D6FB2CF42, 
-0x97AFDC5BB84BE699, 0x19611FF19E4D9483, 0xF44199ADB757FDE, 0x5FEEEF09C032F18E, 
-0x971C4CAD5AE26DF9, 0x5CB6D385369A64D9, 0x7567661451557F6C, 0xF475183F3E4C7E10, 
-0xCA4758AADE427C25, 0x859DE34C4A7D1684, 0xA02442598BCDCB16, 0x9DC7205A7CA, 
-0x50F664B929ED15A0, 0xA3812D7F219E6534, 0x46BEF1E10E96BEE9, 0x17F6CC0F52E1D328, 
-0x1D9C619D6C259BC, 0xE83F5F0078805CF4, 0x2635FD0E24A5FBC6, 0x16A6AA8DF381E317, 
-0x64C11D67133C4DD4, 0xAA33FD044B09FE1F, 0x497AE9A4B973C840, 0x4FBEFAF37874, 
-0xE234850574D76256, 0x15B7FE1D497C1BEA, 0x4F19E92184E955F3, 0x22C02A315AAAB365, 
-0x91F21BDFD445B5AC, 0x31E3DFA5CDC2BD0E, 0xE975BA2AD80AD98A, 0xBD460ADC421CA68B, 
-0x397E5E6A3DB738F8, 0xB8DC4435DD24CC14, 0xD05AFE53AA080765, 0x62FC9E9AAD77, 
-0xAAB69C569C84A632, 0x1A59B916C7346673, 0x3D70DBB3B1FCB25, 0x9D737DA4935D5EF9, 
-0x1B3A6367F1E4214B, 0xEF5DDC26D2406B06, 0x6560A052B60B9B8B, 0xF7E6478B377D8C24, 
-0xA77698C344508D17, 0xBEC15394A925BEFF, 0xD1F5A55088FD0DE, 0x4A9D5130D4A8, 
-0x80C23F89FAC242A7, 0x8D9A3AA9F2D8EC57, 0x78812A3BD8411391, 0xF1940B114E4BEC7, 
-0x3E17EC36438A3AE4, 0x78D84F88C9513358, 0xE48581DB31C927C1, 0x2376EEE7E3F10AC1, 
-0x6453D743F8DD3F9F, 0x6B57E085E690D301, 0xBE8B527488417BCB, 0x1E94C16E75B8, 
-0xA3D5785EA64530E7, 0x281D231C5C7D9737, 0x493108D91825C481, 0x51A56A366DB066A9, 
-0xD87BB574B5623B29, 0xAE5068E9E997B08B, 0x41F80F38935F93A0, 0x7E655E808BA10290, 
-0xFF96F17D91A5892D, 0x36F44C1A90F699F8, 0x78B35EE0F24DA540, 0x29B668B01E5A, 
-0xD14CCBA32C5B5A0F, 0xA718DBCEE0A1E8C3, 0x647C5528304C2D9A, 0x894DF2E9DECE902B, 
-0x49FCD1EDB27B499E, 0x73D3B69F8EF5716F, 0xF1DB36C881CAE287, 0x44534E8736DD5D, 
-0xF62E260C84B9EF51, 0x9A31528E80C6CEC0, 0x156BA2E3700CDC26, 0x32E2C6BC86E8, 
-0x422037422A84830, 0x221684887AD6628, 0x228B5277F54FF1CA, 0xD8B2DB39C684D36C, 
-0x5D47117A1F0DE036, 0x4914D9F2D7FCB030, 0xA810EB2C0AF82B15, 0x5588E815C71ACD75, 
-0x692E8114474A25E9, 0xD8FC909F939ABD42, 0x3AD35EBA9B45108E, 0x2BCA80A1DFA1, 
-0x63E4BC5327FE2DC5, 0xDD41B4F2E3F26535, 0x811CA4D4DE2E25E8, 0x28C4C1C05BC8FC1F, 
-0x9E23B2CD46D42E37, 0x9DA3DCA6E80B21A, 0x33F099D311FE1F61, 0x5CD2FFACA8AF7F3B, 
-0xE2C75CAC815792F7, 0x660F94B8C24E8954, 0x338A7712AEF88083, 0x3C3057001515, 
-0x3C59B5F160471FE2, 0xBEF1838FA51D9FE8, 0x40B0B4768F301269, 0x6F3CC8F5873BC2EC, 
-0x5BA4BF4F34BF7E45, 0x1192BFDC48A76E6, 0xC5152D36B0549781, 0x80A1DC0D19A90915, 
-0xD0EDC366BBEE74B1, 0x50204AF3C847D95F, 0xA34F3AD0492DAC64, 0x90B57C76303, 
-0xAB80B01240621164, 0xA8C95168E4D1A357, 0x1138B21E293CBD6D, 0x72233703685A8D59, 
-0xBC05C4663BE96D28, 0x7B3346995292A13, 0xAF61767C1F3C59BA, 0xF7C04C6CFB108A03, 
-0x5B21F45F63181D38, 0xBB91F6F89A7678F0, 0x1A958D1734BFBA3E, 0x644AD8818CD9, 
-0x4537545B1EA1E920, 0x2D22BE28EBAC3218, 0x9B60537E74E94734, 0x1A646B4B3F97330, 
-0x3548DB6937D18E05, 0xE2D29F28FDAA3A36, 0xEE47B255397932D, 0x66C0917A69AC35EB, 
-0xFF784989890A38A7, 0x9FFB72F77125AD4E, 0xB0D7F6DA839FF617, 0x2DF9D220A8DD, 
-0xC210C4F633CE9022, 0xB4963F069BF55373, 0x3CBD5B0C6BD0E097, 0xACD776A6B61F117D, 
-0x3AB62DCCACF23AFF, 0x925E65B51EC7CBD2, 0xD40A33C172E02786, 0x538EB559EAFB2983, 
-0x91D91593F5440E10, 0xAD348897ABBDC054, 0xD983CF6DE96EA45D, 0x1F98AC0E83B5, 
-0xFDEBE95D0C77C139, 0xAE6B9F07C11864B0, 0xA6DC52F2E46F3284, 0x999CD3CE41547919, 
-0xB73D963F3846542D, 0x58F8D9454211FEDA, 0x768F87E955B87F41, 0xF519850333F1AE06, 
-0x2392995A57976BC3, 0xE47083131D5A8C49, 0xA81D53BB9D41AA1D, 0x6B7CF363E9E7, 
-0xEEE0A3DB7F8C6793, 0x251F6B85A43C584D, 0x3957E8637DC5192E, 0x7789C5272E1E0410, 
-0x1F3E46A90DE30F62, 0xE0CB19592CC9534A, 0x7CB2CC9E433EFC68, 0xC69092A45898E073, 
-0xDBCE9A1A9729B9E6, 0xB65DD0B2C76D26AF, 0x866581FC364A5440, 0x4181229275F5, 
-0xD7C1B484D7ECE069, 0xF2392FC08F095805, 0x21D3D25B755922AF, 0x3F45D3EA4FB9DC12, 
-0x7DD49C243C08711D, 0x5583BE6E8AD21A02, 0x2620FC00C073F540, 0xAC4836692012F5D1, 
-0x5D57D65542BAC56E, 0x2DF88723A6EDF586, 0x44171938F1D0BB72, 0x679838A5C179, 
-0xCAC90B35FBD0202B, 0x8D59A50D43A24671, 0xD73DB609DC48BB12, 0xCE9940BF205A74D5, 
-0x933025C3810067FB, 0xEC041C57AA7E3F27, 0xB1569E70E795CD62, 0xD672A322B32EAB39, 
-0x6ED9F379C660855D, 0x84B58C2BAD79984F, 0x510EEC7CC35B11C9, 0x62DEE8DF06E7, 
-0xE7E2E3C95F333D31, 0x9C7E312C0F75A49A, 0x913E51787509BD05, 0x2893266D82C06EE8, 
-0xEC5831E5EE81FB42, 0x4467807CC2876258, 0xCB76E6968DB74E50, 0xCC985FEF97F395D2, 
-0x643A74BD387A5EBE, 0x679EF7DCD2E0DF76, 0xB43952BD82D8A14B, 0x6C77B9D70B3E, 
-0x106F1AF263D07153, 0x6CFCE9D9B5462D8E, 0x28AC7DBBA8E7EF44, 0x4BCE2B3070C3EEA8, 
-0x4B3A9FF40AAC73DB, 0xF6129EC7952481D0, 0x1545984912517503, 0x6F85710B317F4FB3, 
-0xA23D9DC9932D706D, 0xCC493F7B3A96696C, 0x364A54B998824541, 0x409E99691AC5, 
-0xFE5382AC588722EB, 0x5FB62ABD80D45AB0, 0xD238F77C259FB641, 0x5437BDF23A0C530E, 
-0xF9B3D86E6D733B2C, 0x56C3F5FF657972B7, 0xFA76393CDBC70516, 0x3628832B2A372F84, 
-0xD27DBA5727F2DD96, 0x1E48F2DD59E9A25D, 0xFDD2BF87E059CB99, 0x380A33D68F0F, 
-0xABCAC8EAAD330003, 0x6C3F9FD15974853E, 0x8190D9C71F5EBE8B, 0xD92EFBBB6B95B6C2, 
-0x3E355D17F8FDF4F, 0xF36B387C348EC3FE, 0x14CAD5CD139A1641, 0xAA2675BD5EE14A9B, 
-0x7B39E1866A265BC0, 0xD75F8EA17E92C2C3, 0x74CCB9A45279F21C, 0xD9E88D06D91, 
-0x8995771DA8F293E2, 0x5A630DE3E0FFE3FB, 0xF6C523CED66DC85F, 0xF3DEBD4037A19D8A, 
-0xEDFB04D313BEF58, 0xDD34D6D2299AE4B2, 0xD79E5907DEC9876D, 0x5F67BE4FE69CD731, 
-0xDDADBA814C7A0CE3, 0x1BDC0B8998A4D4D0, 0xEA83945C1722D3DB, 0x395EC5E9205B, 
-0xA238B3DF05E08AEE, 0x3E8827D6C5D2ED4B, 0x97B589954CFC2321, 0xEDD6316FF52CB789, 
-0x9F0BC2651DA12263, 0x52EFEE606C335744, 0x9F1A0CFB5775CF0E, 0xE0A213349AED2833, 
-0xCDA4B715FBD2AD28, 0xCF674F55077DA828, 0xB78CC25B568FB001, 0x46357A6538B8, 
-0x83C0F49BB73E5985, 0x68E10EAFC6AD5167, 0x7C37296F8ED190AD, 0xCEFDD817280822B, 
-0xFEB9038DE9283394, 0x8F316BA2A22A0AEB, 0xA11C52843044ECD3, 0x640D18EE3127524E, 
-0xB208E55A0B9540F8, 0x218E57A2CB225DC7, 0x2A043934074D169F, 0x695740768810, 
-0x5E9C02FCC197AA08, 0x6AF03D8DD41E072B, 0x5320953463AA9D06, 0x2AA5F6F8823A04E5, 
-0xFBB06D0C3D3DDCC1, 0xD36F11321A7E2831, 0xFDA087D02016C1B1, 0xB84E97BF466EDF1E, 
-0x662BCA04B3CD3D19, 0x4D9D03927D63D61C, 0x891734F4074A02D5, 0x630CA1E58E4, 
-0xC2212A9147068BD6, 0x31274E725C6C4D36, 0x7DC4D46136B9C22B, 0x4C2D3F6B27DC8429, 
-0x4475FFB37FF30DE9, 0xB3C5DAF71923E6A2, 0x5C3D0AD63F67A90F, 0x32197989EED3B794, 
-0x1D059934DE3A15FA, 0xFB85F5137E42137B, 0x19D15173FE67B233, 0x3518588D67B4, 
-0x865C9333749A8996, 0xFD9DD64567440EAC, 0x9C7716591FE4F733, 0xBB48E650D56140A8, 
-0x4786564028A592EB, 0xC4ED4B902649A7EC, 0x8FFD84476209983E, 0x56A61C03FBA202B0, 
-0xF78552085BB423FE, 0xA2E84AB8F307F96F, 0xCA5A29CAE9C77AF4, 0x1FC8E72E1C7F, 
-0x4ECE1ADDECD5A404, 0x5487356DEBCF792B, 0x26FE83F9961C9678, 0x1DA15AF19EF0ECAD, 
-0xBA58C889D7A00F4D, 0x761F86A0E240D8A8, 0x444BBF131BCD658, 0x951DED9063120F6B, 
-0x1B17B3AE6EA80E33, 0x97129AB8ABC97664, 0x93560D1F9D26F297, 0x5164A74703DA, 
-0x956F289ABEEB35B9, 0xBDEDC942DD992F02, 0x44F4C781E3F6D67F, 0x3BC5B357FB3D5BC7, 
-0x9187F549BD2D10E3, 0x1924E6E0F3338216, 0x39C72BE1A4C33F3A, 0x1949268A7BEA87C6, 
-0x366F161EC02F9CF5, 0x57586AD307106D3F, 0xD058FD5D71858672, 0x1D0CF1BAA483, 
-0x5806F1B20303E7B0, 0xBCA80A2649EB8D62, 0x3126EE268DE48B47, 0x6F06F9540DF13C71, 
-0x358E15F4AEF906A3, 0xA41D1461F097A25, 0x24A94AD9A81D2CBB, 0xB911FDC0011016DD, 
-0x806C5FB47CDE5C8E, 0xAB7523AAC3B1FA4D, 0x9A84D65E60D964BA, 0x538C879B68BD, 
-0xB4B9A32F6A5B3F36, 0xF22904715EB2FFDB, 0xEFFD08D97CFAD4E3, 0x260FF243AE19F504, 
-0x7E13D35C9CECE4C8, 0xACEF09288AA031FE, 0x8F4A1EC67EFEEDD4, 0xBD24AE3D6F3EE3DF, 
-0xF427D76A5C19BE06, 0xA3C4E8B5E00806BF, 0x5EFC307BB284C875, 0x633E5C0BB0D7, 
-0x9D891E2B3EDA7354, 0x4F005C943A5001D2, 0xAFFBD1D8C4B439E1, 0xCB6E679ECCC8DCB9, 
-0x750F5B7542CCDD97, 0x9C0AD25DFD193C92, 0x2CE89DE0F10F0406, 0xBBC7543EB6216EE9, 
-0xCD7E5CE8B5A9693E, 0x248D56063DD3163C, 0x5A5CA5BE8BB52E74, 0x5A3EA18F76CB, 
-0x12D0CED912A87731, 0xD839B0A192D3D253, 0x1260F9F97A535503, 0x3D3D2025278ACA93, 
-0x7A3917DB93479CAF, 0x853A44CE847598B8, 0xB66D6A63AF928507, 0x29E82B00AF1D381, 
-0x54AAEC3D5FEBB793, 0x641D13F08B5CEECD, 0x1783FA11F872A7A4, 0x64C0B280E800, 
-0x3BF727975499AC1B, 0xDB5FBCF4683CA126, 0x893706B6D7FFEB81, 0x2902667940712D49, 
-0xCDBFA36B70C706F6, 0x749CA3E1BCB10F45, 0xAA112045695A6605, 0x1389B3F53F05B14D, 
-0x48BCD14EE697977C, 0x8734FD1A1DC58FD4, 0x117D4A9BC6859CDE, 0x6E965C92917A, 
-0x86A0ECF97347A16B, 0xFD418C40A62B152D, 0x6FFB6246E1787EA1, 0xE3E6BFAD7EF9B6A1, 
-0x9F9E7DA871824896, 0x16A2118AB41540BC, 0x7D3950EC27DF6F34, 0xD995606ADD142F2C, 
-0x53DEB87D62D86A86, 0x8CF72C0C994C0543, 0xE4CD1DA15F208C81, 0x332856CE962D, 
-0x3C8E5E0059156616, 0xDEE76E3BC8049625, 0x344279A3F665033A, 0x4C8B249E796ABF3A, 
-0x818AB158757BDEEF, 0x1812BC9867603FFF, 0x1E27419A3E6CE6E8, 0xD2C9E22EFB94DCB5, 
-0xE5D7671C26568BE7, 0x92EC2B889FA4CBC6, 0x168233C046617AB6, 0x25FB2CB03F30, 
-0xDCC21991BBF2D4B8, 0xF7759FF583E3A12A, 0x80F28A45AC84B695, 0x283E47CF8937313A, 
-0xAEF01BF7C2BFBA49, 0xA7B4E220CE1C5462, 0xF4AAF4357D79757D, 0x64B97261C0C33101, 
-0x58462D02EE663B1F, 0xD0E43AE658876762, 0xB491178979F515DC, 0x4CDF6E2A8936, 
-0xDA7E7332B63BACA4, 0xC08C7754E6654FE3, 0xF99BAEAAA1757703, 0x7056B7D43B5E5790, 
-0xBF26E3FD2B7BB525, 0x4E99997A1EE9BD80, 0xEC166DDBF106831A, 0x601F23FEB488634B, 
-0x610D7F7A11D095E2, 0xB5D061AE26794BDB, 0xC98B836EF20F1223, 0x54E6D6B9AA14, 
-0x744EDEF4799CCC68, 0x2C64BDF6D06DD1D0, 0x2F0B93C8CB3AC02F, 0x41BD1AD38ED5C360, 
-0xEF80F47EEDADB639, 0x980BA33634134CE0, 0x624B66332712CE29, 0xA8F51A74FCEC984F, 
-0x21C9EF7992462D2E, 0xB7CBD40C9C0D862A, 0x80AF89F50751F7D2, 0x7D06E2B79BF, 
-0xA76F0D5705D3017A, 0xC9DF532C8794E73C, 0xBF61F713717062A5, 0x6431788444817EEC, 
-0xB0F21CCA89C1629, 0x71FEB227AFF04376, 0x23672EAA70AF0806, 0x776C63A05A6B16F7, 
-0x75901272DCF5D2F7, 0xC7F188CCF5E2A593, 0xC1E7E2A65AB18888, 0x2D108ADC5971, 
-0x817139172FD14647, 0x3B4FB9A19D3C23B7, 0x9AE85FA009034F5D, 0xF3F673302B240439, 
-0xC086EEF617167707, 0xA8F5ABED8944E89D, 0x429A0780180C9663, 0x4E8A01C7B825D22C, 
-0x43D9E591DA50C114, 0x581E861A9309E03E, 0x49B99AE78560EB20, 0xD25F3EBDAAE, 
-0xAB738747ABBA2649, 0x91D0B012C9651982, 0xAE41D380A1EE7101, 0x1B5F438101C1AB46, 
-0xF4478D194B25F3A9, 0x3ECB76CC40CE4AA6, 0xF4C7075F56B0299C, 0x778C91BB91B25EEB, 
-0x41CF1E8537EF4F4F, 0x9FA23F4842A5927, 0x652227B2306FC403, 0xF924D15D099, 
-0xB641288F3A36928C, 0x2DBA6001985DA1B9, 0x3BDBED29128AB928, 0x3A5065FA7DC3DF82, 
-0xC5166B2C2DC52292, 0xEC8B1223FF87B01, 0x150E6D6D43B412A1, 0x963FA684DC932FCE, 
-0x2A4EFB840F02A62C, 0x3784E65BF7F834DB, 0x11510180D99A0BD8, 0xCBC6CAAE744, 
-0x3F286F390FEC2247, 0xB70002A38D292A59, 0x1745D3534D4B972A, 0x7EF8A711CCE09EAC, 
-0x9C883B6B2D184E65, 0xE102B87C2163F701, 0xE9455D9DB1F88324, 0x1BD8FF8D90B5F61A, 
-0x217EA78E4FF2E9B1, 0x507B11C4D8806425, 0xDD5C3F209BA883A7, 0x6B5A4A9D5157, 
-0x93B2BD50ADC61198, 0xA0109262F6C893CB, 0xC2D62B161538C9BB, 0x5332BBF0A5442EE6, 
-0x3C7A520D9DDC3072, 0x5BCC4CD53FB8D2C, 0x8CF95B30258B29C4, 0xBDCD8BE2BFD0412, 
-0x5278F2FC11F866C4, 0xE60705F9D9F6DBF2, 0x16604E1829DDCFBA, 0x43A74CC7DB63, 
-0x164FEC4BFFE48EA1, 0xD320C657ACCF1432, 0xDC4821C282F0B82E, 0x3D7E115A7F7E9D37, 
-0xFFBD4EAE08585B56, 0x7DCFFEB3D2E4CD0E, 0x84D5E0FE8204745B, 0xA58C62A22C40EB2C, 
-0xD74FE2F1199873A6, 0x519C7B3CBFBC7D13, 0x528A5DF6E0510DAA, 0x313B372DFDB5, 
-0x9FE40AE1EB1625BA, 0xE0EFDCAF27FDD907, 0x8794D0D3FC1F69CE, 0x9CCD76EA5326CF4E, 
-0x9D3D803E855F059D, 0x5AE6C3CE928FBF58, 0x6504A50F2514F445, 0x216C8AD64C2A693F, 
-0xFC8BC39C0B796F9, 0xC11FEB434CEFA8D7, 0x8C5091C93A34FC8A, 0x15E8BF39C1B6, 
-0xD0014A0E3103BEDF, 0xD0336243B1ED513, 0xC72EF7DB35B4B0F, 0x339320353900484B, 
-0x1C2428A657E5943B, 0x1CD87814932A563C, 0x5165B78431CB171B, 0xD1202BC2786E3262, 
-0x5456FA6C6F19C939, 0xA465BFEFBCA8A312, 0xAF52E2E3E2FFEF1E, 0x413BE61DE2BD, 
-0x34B98E0601D22D67, 0xCE037432C47BC924, 0x2FA39252E007E8AB, 0x15A0A672BE7CAC00, 
-0x307A69D8F46CF505, 0xB526DDD658F743DD, 0x4E81474132E2C525, 0xB5925C4686E0E287, 
-0x49B65F78432E41E7, 0xAEEC63C1A63E1E53, 0xF0D5F12EEDEBE5F, 0x76DEA4AE2CE, 
-0x57653920F039212F, 0x35DF60417C1C17EA, 0xE30DFE952537DF99, 0x1E809EF3B6E064DF, 
-0x314AA7315C153783, 0x964B05FAD7057BD7, 0xB02E94FA225205F2, 0x5193BA7E869A03CD, 
-0x32280E2030F8F9E2, 0xC607DB633EF980DD, 0x365582F7596496BD, 0x2518A03F24AA, 
-0x3D1C747759FED074, 0xEDC68F5F9C239869, 0xB345ED837072FEC5, 0x5C819D5159F7FB9B, 
-0xE85D277532CECABA, 0x2B6A56A2602EDD0E, 0x4993D59283F808E4, 0xD28D2219115D90FC, 
-0x3E9DD0B1772B317B, 0x3C9B38774F9C87E9, 0xD44535A954FB3F2E, 0x3B666353F6AA, 
-0xC5F9B9325ED8C334, 0x9BBC7490A0E008D6, 0xBF2023A4615892FF, 0x8C5B00DD95DC6BA0, 
-0x396D953EDD7B04D9, 0xAC419E43844363A3, 0xCFC95BA4738D904C, 0x5800AE1B5DB80B2F, 
-0x9124C47986E3337D, 0x5E7B7889D282B0AC, 0xF137535DAA8B6654, 0x27BF626D94FC, 
-0x421E76AB5041C4C0, 0xFD586565885C7D68, 0x1FD6BCB10C253646, 0x5911EC9B681B0501, 
-0x51EB595310DE84CF, 0xA66D1236D781952C, 0x8219268FDE5E9F2D, 0x4D995ED7F0D1C77A, 
-0xBB9C75D684E2056A, 0x7DE9E3A4198CEFB2, 0x14B303DDCB682CB5, 0x3C385B0E8DE2, 
-0xEB89969A9E88198D, 0x1C327BFEE31C966, 0x44FDBAED5677E92, 0xDE2CC39413C60A11, 
-0x3036C18CE6BED468, 0x636BC88BD69F068F, 0xAA29BEB7ED1D8B93, 0x862D6D106924C52A, 
-0x4FE95BDF4A5F75C7, 0x8009221D4BA1E9B, 0x14ED5B955D6C9178, 0x514405FBAFAF, 
-0xBC94E55B71B8DFA5, 0x4E2F64E6DB89CEFC, 0x616F9E8FDA89BB33, 0x6F4B7810367E452E, 
-0x1AF14B9283E1FB37, 0xCECEBD80258FBDE4, 0xB67CAE70DDDE392A, 0x26175E47426CD6C7, 
-0xF8C863E73F3428F3, 0x8E527B0998AB284B, 0x166A3A7B8C1725C7, 0x4D6633E09CD5, 
-0xC569B101544DC5C1, 0x1A2EFD3EF67712CA, 0x8305F861FF5A8EFC, 0x8B61F34E227E81, 
-0x581F1327239DF301, 0x9AF154898F0AAEA5, 0xEC2963961C27E387, 0xF66F10A72F718208, 
-0x97418F2E7D83F8EC, 0x84CB2FCD15BDBCB3, 0x8A5F0BA32B2B38AB, 0x430EB6330EC9, 
-0xA06C3E08391BE9A4, 0xC618A8647FCFA887, 0xCBF3BA8B7BEF1574, 0x2EB270FE59390054, 
-0xFDBBF28BB0CA9688, 0x478D676C98DFBB2B, 0xCF37556512E17EF8, 0xCE017E332AC60A95, 
-0x2AC1F60F2F2E940A, 0xF5FABBFD04FF7E69, 0x6661E2A5E0D0E0E2, 0x41D34996C2B8, 
-0x78366466EDBAB0BD, 0xCFC0FEEA4FA38566, 0xF45E8E34DCE76959, 0x42435B5EE622E00C, 
-0xE55F3765830CC272, 0x578E0F5B55BEB7E8, 0x6693E67AE0ED1D40, 0x9C13B8DA735AA49A, 
-0x977A370F7A8AC9A1, 0x62804BD116345086, 0x928CE2B5777D317C, 0x4711B1897D69, 
-0xE515E903CE9A82A3, 0xDFC62862FEE9868F, 0x5C60120234B58F3A, 0x96269373BA4FEE14, 
-0xC20CBC65CAAC7150, 0x608238B3EB3D85C8, 0x18BEC50B4202404, 0x9F76BFCD3F9D0D87, 
-0xDFCE3455E6CAF54F, 0x34B50C1B3164DEF6, 0x712184161713B66E, 0x648D6C08EB83, 
-0x7390BE7F6728EA64, 0x50C65FE5F8A71967, 0xEC7395374D878DE5, 0x92ACABC018A439B, 
-0xC389370A5569D5D3, 0x93370D3B1CA92C2F, 0x295049534D2391E7, 0xD4CAEE0C469E047D, 
-0xEEDB2F741FFBCFA4, 0x78BD99944B3DA916, 0x79228A19148BDA6A, 0x3501C962DF52, 
-0xD35CABF1023C7A8B, 0x1600CEB9281B9A91, 0xF7E8E02385C49660, 0x45DB58C507A8B034, 
-0xE16A6DB9CDED602C, 0x8713AB116F8D306, 0x3343E70E4E03A4EB, 0x86BF281BE6983FBF, 
-0xDBC9F7B9B2F46666, 0x565AF31B36A598F7, 0xED9FA12863EC16D4, 0x4310A580A8DE, 
-0x8D56BEE72B7F03FC, 0x70C4742DF11D568, 0xFBBE50255EE6DEE4, 0x2A33C5F5B5AF9C67, 
-0x90E2C88CBCBE581C, 0x8E9BD5269CA4A889, 0x9F7D5C134A10E3DF, 0xD1A3598A6893FA0F, 
-0xC26E8299EC204E64, 0x7B928DD8F697965E, 0x5DC851F8C9AE2F08, 0x5C6B829F4424, 
-0x26FABB9A81F9F1B3, 0x6B546E711EBBADB6, 0xBAA1F135A1CDF98, 0x944FA17E8446C16C, 
-0x831093A3C3FFD01F, 0x87893970A75CE305, 0x1196A1700F28E777, 0x37A772CD70E589BA, 
-0x912F526B92134150, 0x1C829BE5A138861F, 0x27C7DC7E0EB1A2FF, 0x247ADA8B1DEA, 
-0x9936400C50282F10, 0x7E6B6995EF744117, 0x69B7B102DE4DB2BF, 0xD61FE17DF9CFF8BD, 
-0x7955AF77B3115BF2, 0xF9BF2D80A44150E6, 0xEC6E943E4C4EBE05, 0xFA8E8FC9B803133, 
-0x9F79BDAE2ADECED8, 0x845791C61DE898D8, 0xE5C72F9AC2DB2D40, 0x22941A915D73, 
-0xD4A8042B9FB414EE, 0x1B3D394BFA2A8850, 0xF1F69F7DD214432A, 0xCB2DC73A1689BDA7, 
-0xFB579544C81DB3B9, 0x51457D8235B8CB56, 0x33B6E6B8DE5E319, 0x2FFB97AD7929A0DB, 
-0xF82A9022F8C09273, 0x452635715FA4AE55, 0xF4601477F3C9E473, 0x1F8561E8092D, 
-0x88F42676DFB6550C, 0xCF78ED441C28523, 0xED948FB828605972, 0xF73277638F23503D, 
-0x7AD67E8CE061C0D1, 0x1F42EC42A66AD7C2, 0x79BA9706CCA3A347, 0xC6642639DF62F600, 
-0x21691CF589032784, 0xD72471794ED9C72A, 0x5AC7CF3DAA21813D, 0x3618B5621C4D, 
-0xC903364DA988FC49, 0xADFE708168634F80, 0xEB4F70614DD725ED, 0x117A2B527CC7484D, 
-0x4F4C58892A5442F6, 0x9533AE0BE2F1AA96, 0x1852BA46ACD3CF2C, 0x587D80DAE208B942, 
-0x9E189B55CCC29CF7, 0xDFEE89148C93712, 0x8081A60BFE8A7371, 0x6C8DA5F5B4B9, 
-0x51053B235A6A36E6, 0xA09589E461444DEC, 0x817DE5A509A59CE3, 0x13D8E181860A26A3, 
-0x497BE3B26462EE2F, 0xF9AFACAE7A64AA7F, 0x1456FF09CC244F2D, 0xA4EC00A63BC7059E, 
-0x753A520064C43D5B, 0x4010E9A16ED3B8CB, 0x6B5912FB10D33BEE, 0x15210BCC9142, 
-0x1CDD39534C6CB8D1, 0xC29B7012E00B69A8, 0xE0789A62A51960DC, 0x46429CD37D9BA430, 
-0x4CF03DF15FF1FE19, 0xE3C72E2221A1FBCA, 0x2B585554D434C830, 0x189FFE5465F16CD8, 
-0x28055D42EB635722, 0x32C685B7D5A74318, 0xF8DE553661861784, 0x6D37C324F300, 
-0x1B47986AD255125E, 0xFBE88BE7849E13C, 0xB3A8E7940060757E, 0xCE30F33E57897D5D, 
-0x9737AAB47141A007, 0x369127702E436BEE, 0x152E7730BD2CAF19, 0x70F803A73D5EECFF, 
-0xFC269C3E93B2BE75, 0xDAD1B9F511B87AD, 0x2D315F22900F7F63, 0x4F7271CAA307, 
-0xD65E15FE0F85DD19, 0x217403B22A9EBE4B, 0x55993D828B39FE17, 0xDD362CB1F5FACFEA, 
-0xB2AA26D7CCCF6317, 0xDD7E8E8789361156, 0x66B10A2B0E2753A1, 0xC07451D80C06265A, 
-0x1C4FEB6A80D2B2E9, 0xBAB0645ACF7E8052, 0x1403A6FF704BA6D2, 0x357BAC013E4F, 
-0x88A1B2539CF701D8, 0x8E39DDB54AA5B0B2, 0x23634940B5662BFA, 0x2E9D8E7BE95C3BCD, 
-0xCCCC0F620A9A3715, 0xB4B9D807FBEE96AE, 0x91A7B1CF9AC6F9FA, 0x7CC4E419E6305DAA, 
-0xADAAA0A4D160686C, 0xA79A2BC0D45F66FC, 0x415E20CC713C3BF4, 0x279D146BF8B1, 
-0x770BB4CC1F3FE8D2, 0x77681F58EEA22327, 0x6500E90CE158C1, 0xD2A39EDF11A430AA, 
-0x9816D31CE489DD1D, 0x38D4CEFA04C8FB80, 0xDF2C10C83BEAC013, 0x6DB18C6DF24784E4, 
-0x75E4828C3DE77783, 0x6C7DB9D520CED4FA, 0x7F1700F475D7D0B4, 0x2EEE9DBF4D7A, 
-0x53A8C43ACC45D00E, 0x1AD5410354491865, 0xD44B1A536C151BB, 0x8DA8A553C45F8E0B, 
-0x2D8B91CCD3701E5C, 0x9EDB4916FF693041, 0x469137934E76D1B4, 0x2635C98A29F97377, 
-0x873C986E9574115B, 0x4647F0CC93B97C24, 0xE68CEBBFC9F5DCC8, 0x2A965A216F98, 
-0xE8E98DD03B958E71, 0x585B7CC087DB70F8, 0x84C99C07BF6BCAF3, 0x878028FFB3983536, 
-0x30D2ED43894DB393, 0x23D3C011ABAE1431, 0xE0CF67F66AE71BE9, 0x2CFD35FBD7A778F2, 
-0x66876E87430A08E2, 0x7D29607D052E8107, 0x791060450FD2DF38, 0x3FEECBF01887, 
-0xE1D9AB5A130D95E6, 0xFC5DF949DA1311DD, 0xF3FB6385B221C002, 0x63B93E14E8789AF6, 
-0x91FA50CA2CDC9C33, 0x30330252E4BEB81, 0x6603EB9B7B2FA7EC, 0xBD1A3160B9F038B9, 
-0x1C552513507EC872, 0xEB055617C4C1F1F2, 0x4EA5526E84AC75F, 0x202AA2ABAB5C, 
-0xA807BD18B98F1691, 0xE2D310E56B56A0BF, 0xB4927E7F99905835, 0xDB5EA3A959885336, 
-0xD3D5BF0B9E893E17, 0x665103E47252E9C2, 0x91EE0021000A598, 0x621E3273943927D8, 
-0x7DC9EC5B47134421, 0xBCCC77B670725AA, 0xD82ED9ADF56C1209, 0x62BDAEA0950C, 
-0x3EBA9B3A7B4D92A7, 0x46DBED5D934545CC, 0xAAB77867B2CF2AD1, 0x9EE06D5C44F9A914, 
-0x4ABCFEDF4892A02F, 0x3A89799F7194A166, 0x80D040EB6D380CA1, 0x172FB9F01B7A2FFA, 
-0x44E0F659220591E5, 0xA790B331423CA320, 0xE10B1F005B4B0763, 0x465B91A6DD98, 
-0x15EEFD3793F0591C, 0xE4233D0126073A46, 0x1F39ECEBB38F622A, 0x19428C195CD1F1F5, 
-0xFD28439EC1DA3419, 0x7F8453F06DFCA89B, 0x4446E995BC3FE1FD, 0xAC01E3916455A4B7, 
-0x79D5D2A38DBC0250, 0x580412B6FEC06610, 0x100EF528C6CE749E, 0x2342B338256, 
-0xFC9BBD268F949F2A, 0xC4DA7FD77A19A37, 0xF71C453A2AC3B083, 0x276551356B5B4F48, 
-0xB18C8D78C5BAA02E, 0x219C14285B234B5C, 0x32ADD459F1AD17FC, 0x9BA14FBB66964E4E, 
-0xD5C7FB7F32CF60C0, 0x8305B47ECAB12033, 0x9F43CCCB3CB12EE2, 0x1553F417BC26, 
-0x2BBFD36CD055A592, 0xCB7B838EFD150B56, 0x38D2B3E11CF7BF58, 0x7ADDDBCB435CBC05, 
-0xFEB338CD330DDDC1, 0x298212451A2181E5, 0x655DE387D49C781E, 0x1D7F92FB82BD2516, 
-0x5CAD334E0F77389, 0xD36BD66547E6CFD9, 0xD919EE04E190C0A7, 0x59C8FFDC677C, 
-0x6BE13A07EF83E161, 0x3D27C9C1B0D2F37F, 0x3537C02076DCB24D, 0x68A8E1C6ADE33212, 
-0x1E87796454D0DEC9, 0x7E028164556AD79B, 0xC2CCBE9CA8EB24AC, 0x8B3E2CCEEE9BAB9C, 
-0x15413BB0E53FC85D, 0x173AA88FEC506F1C, 0x4ABFE7E981DA5F93, 0x3A19E0F07DC3, 
-0x52AA84A74E5E0AB9, 0x5828B2DC2F7374AF, 0x8991EE4338CC3A96, 0xFC5F886C1017F58, 
-0xB351B058054AED7D, 0x1B68E2AD1154F00F, 0xA5B84C870FA8C1E0, 0x36C856DCBD5DF3A8, 
-0x12CA4C2BD4C73AFD, 0x469099D47B6178F6, 0xC987B4FAB2ECA787, 0x9DA2233A8C0, 
-0x1DAA5604E393155D, 0xD1BA58B76C233ADA, 0xB76C4BE3DD45335A, 0x219DDCC5842653E4, 
-0xB510A0710B481A63, 0xC481113B5BBB56BD, 0x35D397389369FF, 0x7A6E44ACA99DCD44, 
-0xBF7492DB9E23906F, 0xCF3259D844637EF8, 0x55B0FAA9C6E970B3, 0x35C0A9A5FBAF, 
-0xE8B4F5C2D56D319E, 0xA94F0D4CC1896DD0, 0x38C14846C1221CD, 0x4FEA1682D8EFEA78, 
-0xFCDDE0ED2F1E9B30, 0x1093C6504334D070, 0xC6E95A89EF859B61, 0x1EE1C445AC0FB653, 
-0xABD662D3D3412AC1, 0xF0FB188CE590D863, 0xC0A1F626D31E6A29, 0x1E5B7CE2D3E6, 
-0xCF967C5A6950BFE2, 0xDB60BA65F01FD736, 0x2291C4A6A7C0FAAD, 0x621289977977E6E6, 
-0xC5E5D9784677735F, 0xB235146EF93B5FD2, 0xA3822F78375A50D8, 0xE323BDC75F658B2D, 
-0xF65EB7A58D55D71D, 0xBE0F6EDA1D1984BA, 0x21D8AAD7C42F1BCB, 0x5E86FBE623ED, 
-0xC081558A37AB770B, 0x784EDFF5FA80F78F, 0x11698A865940A5D6, 0x9A778A58A6E1A1BB, 
-0xFEDBE48F873CD1A7, 0x4595D7E7C95D4B4, 0x9B6ECE41CB15C235, 0xE3417B82579A9A2, 
-0x404070071FCEA11A, 0x6DC7B49E9430E628, 0xE9974AC706590BAF, 0xE582AA8EC83, 
-0x47F0F60D6E0F69C3, 0x140E01639A22EFB9, 0xBDAD89AC23DFD040, 0x88ADB7823F0AC538, 
-0x7D3337443D0539AB, 0xBDBB56E5D4E8C73B, 0x11BFC27BE9CA401F, 0xBC916B4D4F2EF634, 
-0x2186B7702B87AB7B, 0xE7B4802CE72D4406, 0x2CDB8A61624532B4, 0x29D6CA19E8B0, 
-0x5CB0F3AC83B2CA56, 0x8DEE060623DF1829, 0x41EDD3D9AECD593B, 0x1800C0FD125AE514, 
-0xC9F5AB52FD53F52, 0x185A1CDA4CE82F26, 0x6C252DA3CA4EF626, 0x9D146200B81CB076, 
-0x5C47206DCAED9003, 0x579B75DFD9F0870, 0x6A5F63F545E7F2B7, 0x39EE7FD6892, 
-0x2E90E00B983B70C, 0xF7B91B0AE239CCC5, 0xE98E29FD5AB9EDA1, 0xECBC8FD7EE42D011, 
-0x7A9AD0DD306A7959, 0x109D24E64586D589, 0x48EF251316F8AD01, 0x74989D8D8B942AF6, 
-0x710F3EC3D455413B, 0xF938098EB403803D, 0x920A4F23F16C430F, 0x3CD0DAF3F16A, 
-0x29A4DB6E85ED48E3, 0x5562D0F11760E870, 0xD0CD88FD9BDC1143, 0x343114F27391F85E, 
-0x7F74606BFCCC8E3D, 0x15652F204E0C94EB, 0x69208BEEB4759671, 0xA99E881710D6462C, 
-0x6B3B02B1596FD6D8, 0xE1A65C0D7396CE57, 0xA9ABDBC141DE47BF, 0x4D983FC733EF, 
-0xBDB3E82D4487BE6B, 0xCB06A55CD0F4D222, 0x526978080FF852FF, 0x85DB71FECE6CC953, 
-0x9FDC85FC5D05AD13, 0x73845140E4D7DE8A, 0x8668B8560C9C041A, 0xA6E368161D694DAD, 
-0x9FB71D75F407070F, 0x49860001230461F7, 0xB292C2C63C30A276, 0x53A0B0FFFC19, 
-0x309145C3271DA55D, 0x720D17F3446E041C, 0x4744E96B0C8C96B6, 0x358D03E4216793F8, 
-0x1335F5A9C1D925D, 0x38BC14AE0412675F, 0xC915FF82758C150E, 0xF3DA2BE68C6ADD55, 
-0xA782F061291A74E2, 0x695C1E95D318DEF4, 0xE57E119090CE48E0, 0x5D386E3CBA83, 
-0x5E8D534A293921FD, 0xDD6B3724FAB8A6CE, 0xF495CADD991D2FDD, 0xE6C020792660695E, 
-0xB7B833BCE7B13B47, 0xB30386634C4A0081, 0xAF4B4CE42F933C2A, 0xEC629F29984903BA, 
-0x20F92370BDC5E29E, 0x32F0E5B4A4A1E10A, 0xC472E23987651E0B, 0x3D5C9AAD33D6, 
-0x3B175FC290A4D2D7, 0x6520A3700E6EB651, 0xA1AE25BAE5CB7159, 0xE918F4026C5B5BDA, 
-0x4233579D4A21C8CC, 0x648CE9C2DA4536D4, 0x6355DB0280FC6207, 0xD04DA3E058FD5BFF, 
-0xB264B786D639228C, 0x1863CBDFDDF65A2E, 0xE2C26AE296802A33, 0x21F0154A772B, 
-0xBD56B0AF9223EF0D, 0xBCECBFBBFBAE5CFC, 0xC40E2B580759E90A, 0x6D22E8DC5F68DF34, 
-0xD43F7EBA5DE01DC2, 0xDFB2D8A2517CD8BA, 0xC90FD9890CDB5A5F, 0x994A54BFF7C5FD2E, 
-0xD6CB5C32427B6AC, 0x722A8E8766E75C38, 0x99FD530DBDB77A48, 0x16906D4A6E5, 
-0x41C725D84487E43D, 0xB982D66EE1C2CD78, 0x219189D2402A1881, 0x6CC1F54EF1EBFE2B, 
-0x16D49FC32E5E4B45, 0x43498A73D1993656, 0x1D091D7B2634585E, 0x702EECFA009C1FD0, 
-0xA6AFFC1B1A51A88F, 0x1968154452E406, 0xCEA2A721CE820B1A, 0x473D5CD8771C, 
-0xC6E4E588A0CA83AF, 0x6BCA2736A2AFB895, 0x24428FCD6CD43A7F, 0x5D9C67FF06F11617, 
-0xF10F35E7C727AD5D, 0x9022022298F44FE2, 0xE9A3B55AD81D8116, 0x2CCC7FCA77F89714, 
-0xEFBFFCB715101638, 0x916C2C22857276ED, 0x5A5097BE49031A5, 0x25E28115B134, 
-0xA861EB395D466898, 0x225FC027F3D3A5F4, 0x83BD880002F7A28A, 0x55DFEA53E3F7E521, 
-0xEB84620F1C9F1F81, 0xE697CDB051D04EF5, 0x80122B9D0DE1F97E, 0x9C40F2B4F2B8DE18, 
-0xF095B127DA960C14, 0x6C92476D13F59D87, 0x5007975FDF1CBE08, 0x3476406B48F6, 
-0xCF14C6AE50F5F69B, 0x4B415114D28111B0, 0x3039FE9223F5D1F8, 0x585B2C0C34CD2075, 
-0xE819055B03EDE175, 0x10FF601DDF53716, 0x28936B6482AC739F, 0xD17EE4F9EE33915B, 
-0x7DAE0B1B83A4447E, 0xDFA8C00C40764A26, 0xC947421EE748CB4F, 0x66C88EFB2706, 
-0x172A761A1CF6404F, 0xEFD01445B0B61B06, 0xA048E5EA203A6284, 0x98BF89C5190BC146, 
-0x15BA8458E62D7E6D, 0x7D3910D0586C764D, 0x8EF3E9E3D16E530C, 0xA4495C582F563CE1, 
-0x454805EFF139F1D7, 0x81150DCCCB4A6E5E, 0x9E8F7FFF3A81BC, 0x29F596BA0A2, 
-0xA94D746097258FE, 0xE1FE5E1224148633, 0x75BA07E5C7B2A4B4, 0x85D60C8D2BB36E00, 
-0x29C086505686930, 0x2F111A0F51FB5EE2, 0xCF90CA4440F61EC5, 0x337986788A76753, 
-0x299097F5E6C9B0FB, 0xECCED075B737B217, 0xC8F284612D62AB11, 0x5738175CFAED, 
-0x54F26490ACC903F4, 0x6D2EEA6138E900B6, 0x48A82396BCAB755A, 0x8528F8B55476BE56, 
-0x1CCFC1F0E4F18D80, 0x36FC35CB16BBC412, 0x139CBE9408774E6, 0x221DE45938DDF032, 
-0xB01147ED5843F23C, 0xD4381A242242EE0E, 0xE90322D506F7BE3, 0x378EF2E5D568, 
-0xFE58197C5E36AF6C, 0x5E54E2D4DA1BAC52, 0x8C9BAB717CABAB54, 0x29C0F935E05A173C, 
-0xBDA14ED3416D9AE3, 0x1646CF933905D058, 0xA4FC90E1B15DFA57, 0x8D595EAA6914F193, 
-0x73C5A658FC786E61, 0xCD8A78D64C220E2, 0x14FDCB1A66135964, 0x58B57844EA9C, 
-0x7880AFAD358B0916, 0xB15BCC3731D06427, 0x8638223501E6490B, 0x10481A413D8F8AA5, 
-0x52F6645D35059390, 0xEDDB3FA673C83AFC, 0x276656C7340EE1C8, 0x84D93D98DE5ECF9B, 
-0x4793C1288225DF3B, 0x13B1B23291984142, 0xB1DDEB657C907B43, 0x3DAF4BD6FA08, 
-0xB74B2B9BCF87B066, 0x57891D3B92CFB64C, 0x87BA48BAF7594A8D, 0xDB65DE7B1B7A9559, 
-0x6217819F58C0CAE0, 0x5E4CF5F113EA04DF, 0xAB7144FF07B866CE, 0x30F7FA6C70369705, 
-0x1EE4C6AEFE3B104F, 0x33ECF86E870B803D, 0x76FA360C01B989B8, 0x638996E18FE3, 
-0x19DFCF92EE15A302, 0xF2884BF15389A4E5, 0x15A1C1C813A6498D, 0xF68357D37F0CE50B, 
-0x408210DF9DC8BEA2, 0xFAEE933F25EB319B, 0xD3B6CEE972A94479, 0x4D39C4A68FE974B7, 
-0x5D2DA110CDCDA9B5, 0xD1B8F2C4A1F2CF10, 0xD560144D2B14E085, 0x6B96C945074B, 
-0x4182E92CC450A546, 0xAFFA8E4529F706EF, 0xC0EB84E55603EC87, 0x7AA8C11821A0EE5, 
-0x279B75E22D2013DD, 0xA0DB6DD6B40E6C78, 0x8BA2B2202F8B9D19, 0xD7F4FE88AF9C7A6A, 
-0x42B846E37A224A8A, 0x92C1BAFD75B84262, 0xED5E2987D287D77E, 0x297F28C8091E, 
-0xCCC239C6DE4584E4, 0xE5D4FC9EB8189116, 0x7E45C09DEA51804B, 0x12DC1AF1F7D04014, 
-0x6C45A7F6B2882234, 0xF2AE9DE8EDB53B, 0xD6BC2416343F0F6C, 0x6705DAFE0D9E621F, 
-0x7DB1299D07700A8A, 0xC47C2200F6ED21CA, 0x23C930076D65BB50, 0x6E9BD5A463C, 
-0xFA0301E70D28289D, 0x3A41F07C59E7A44A, 0x46FDF4A9154DDF9F, 0x6763F85360EDAF62, 
-0xEBB64CC03015E184, 0xAFEAE2070DBF4CB1, 0x445808068E2A6EB0, 0xCEA30C64B0899A7E, 
-0xBC61BA150537DE89, 0x4687BB4FCDF9533, 0xEFC14AC057F936FC, 0x3A97CC00A3AB, 
-0x311D6E54BC7E5431, 0xD894209D019A2368, 0x8F3AC76D696C9B3A, 0xEC7DA310BCEEA60F, 
-0xE90F0C81AAEDCEDC, 0xFF7FE09C1CC90E13, 0xACF6BDCA83AC3ABB, 0x777592370FA24696, 
-0x27CDBF6256BC6B6C, 0x48F78A208DC01100, 0x9B186FF917809096, 0x5C012BEB1265, 
-0xE4A0323037D6ECAB, 0x4B84B64473CA039E, 0x7674A961F04DBE1F, 0x2F6DD480DD02D4D, 
-0xF1710CBEDA6EF3B0, 0x36047CED4B4179B9, 0xC40A89E3E509A4DE, 0xD886BDAD4F3A6B8C, 
-0xF3459BD939CEE116, 0x7BB9D973954F2E08, 0xF2B4A81FE5678039, 0x6ACE30E112F9, 
-0xBE230120FA0CA1FA, 0x34DCBE8A61BD2877, 0x303CB3C7B59B5935, 0x82507CE77DC8D156, 
-0x49988FAED9767351, 0xBBD4EB3E09C2B4EA, 0x28928489ED42F9BF, 0x7EDAEE6B29AECD08, 
-0x3AF1DCD83FF9C5D1, 0x502F67B382243874, 0x8D2E46F7EABCD875, 0x307750AFAACC, 
-0xE02E77FAF15C1109, 0x4EABE56E59675AAA, 0xC08BB9CE2D4FE214, 0x5B70CC829B55B10E, 
-0x3B43F000BC4DF446, 0xEBFACE539D2E7894, 0x662EE7444D8A5CD0, 0x1BFC5DAEC4F4700, 
-0x554DF092BD694A2A, 0x157C255920A464EC, 0x62307699B08B46A7, 0x548B61EF4D75, 
-0x397C63675F8A418, 0x3188E6FD69353AFA, 0x9F095813F31560AC, 0x9B042D1FB81AB10B, 
-0xDDBFFCB2FD94E28C, 0x62AF2C9BA7FA4110, 0xD407053C8129207C, 0x5B178201B58B9958, 
-0x26DD8350424A1EEA, 0xCCC9F46406FD153A, 0xEFFCA1413E83E9E4, 0x27B238BC445, 
-0xB787FA42ACB41A26, 0x62FD067D03159949, 0xD5DE3ADE2868BA16, 0x62A02EE050D80BD2, 
-0xCA649D33754513F2, 0xF980E6321B0B0B13, 0xE27AA18CBEDAE76D, 0xB9307750A1DBC11F, 
-0x762601676588BACD, 0xE7003A285ACC086B, 0x3EC30BF46A53519, 0x2532A94B22B4, 
-0x31EF712775A1B7A8, 0xFCEA0A29747AAE54, 0xF415F4242ACE51C5, 0x58C4F7ADB4056C8, 
-0x45AC4AEAB4422D70, 0xE54C2BEC4E8A723F, 0x8B5936C0A4F2062F, 0x617FAA12BBD5A570, 
-0x5BFE0D881FFA177A, 0xEA9C2675E24E91B1, 0x6FF261D47633F6A5, 0x28902F4081CE, 
-0x876F3C0C8E522B5B, 0xC40CFD0D65D8A593, 0x4A8DA461A4E78ADF, 0xFA0EFDA8A2F75B8C, 
-0x7CFFB28900D8074C, 0xDB263154E85C1E12, 0x5C3B6EA30F3DFC10, 0xE79E3155C6DF3453, 
-0xE033A3E9EB785CB6, 0x5FC7773E1C3A51C5, 0x7E9D7CC7A5B16A3A, 0xE54C1EE8193, 
-0x958E8292E22377F0, 0x896CED15A2AA76B2, 0x371FF85703C9F356, 0xFD08FF88086C0915, 
-0xEC39F9B794BB0AF4, 0xE576FF362565AC7F, 0x55C818D92888FE51, 0xEF1ADC5CF5936602, 
-0x9915C6E3040D490B, 0x4E97A00273A16AA6, 0xAEDB73FF6D4FA962, 0x22430AFEA823, 
-0xFC39AB5813F3DEAC, 0xE8393A38404375B3, 0x241FA0839E79C8B2, 0x9F6A65D1D0F575F4, 
-0xF9C0DDAE3EEEE3AA, 0x2BCE7BE0FC2D5F35, 0xFCDC959D6687DC28, 0x25B386A647841831, 
-0xB263DFD70A0C0A23, 0xB2AB397CBED69AAC, 0x9A4BDE1F24A4E403, 0xB8160DDD15C, 
-0x7891E93BA158DA5D, 0x195B172485040991, 0x76D9B53D761E0883, 0xC9D86D2CC56F206C, 
-0xF6C3BB82C44B60DC, 0x2DA0821C7B7AC4A8, 0x811C8E93E6CC39D1, 0x25B94C3F253F51FA, 
-0x3BBF64638839ECA8, 0x68C05F52E130732B, 0x4FAE3F9955AB718B, 0x628FF85701C2, 
-0xE4E2B2409BEB21E9, 0xB74C89523B112A07, 0x4C66931F946F5990, 0xBD4DF3F72DD64BBF, 
-0x58925E3159702327, 0xBF2AB2DA26C534BF, 0xC5EE2C1FD79EADB, 0xA2B594CAA8DD45C6, 
-0xD32121B268C8951, 0xD5283E161E6B3701, 0x599C97D85B4FA21E, 0x3770CE713E24, 
-0x291FCFBD83B76CC6, 0xBC2B50E27D9B6ED3, 0x97B5AE2E5870E778, 0xF4BB091C753E2F54, 
-0x874C97E488A3BFD, 0xE4246CE503088106, 0xE21D1E72A7883E80, 0x34A05AE97F204D7D, 
-0x3D0F7F98486B6741, 0x317655D2744B2390, 0x13AFD6ACF0B62F5D, 0x170CBDC51D90, 
-0x9D2F39D502BA220E, 0x806C6AEAEA53E0B0, 0x9537D85AEC1558DD, 0xAF40F9F9E2421D8A, 
-0x68F33EB258C6F46D, 0x7E237679EC2F10D2, 0x9F3A704353EB6F1B, 0xD795F19C031329F8, 
-0x860289B46146784E, 0x63D65CF58C68EF71, 0x6A479B46583B1825, 0x6B8E55BE0410, 
-0x5584B2126BE8BC44, 0xACC7855977BD1873, 0x30447659F0820A78, 0xA110E72E7DD82C6D, 
-0xE8D4F01F41FF8F94, 0xE86D0976B1B13720, 0xF5DE0F7C9E11EE88, 0x79B06253F24AC4EE, 
-0xBA74FFBDCAAB3FC5, 0x308BD3F338030057, 0x1C6A7CA43131765C, 0x133747EF55FC, 
-0x4FB5B82067726A75, 0x4002D2C289481B79, 0xA98B8287A1335873, 0xEE74F0DD76F0D207, 
-0xF4BC45587F2C86F1, 0x5E9000B9638543F4, 0xE4991637E3994E28, 0x73DB0929A727CEF8, 
-0x5AA177C602FEE762, 0xF83C1765F4A0D92C, 0x41F50B7F7F761369, 0x399700D36C5C, 
-0xDCF0FB33312B2497, 0xB329C75245A24707, 0x3C35E0846606BF59, 0xAAA26FBBC85E1A40, 
-0xCF1EBBE340E60C33, 0x8F397F34B71CDA92, 0xD6A0FAB957C650C, 0x813DEF21F18F3091, 
-0x41EB0F4ADF900249, 0x282DC84BDB93D87D, 0xECA230364A142441, 0x6BAF5B69A15, 
-0xC37A116CE0E7F4BB, 0x10E60E80A6190AF7, 0x334E4068613C457B, 0xB012825B444EDA9, 
-0xA0DCCB3B755F2DF, 0x9ED3191915F1A6F1, 0xEAFED5FD5FB4C95D, 0x1C96984E4A59A0A2, 
-0xB78E12D17667CBF, 0xDCE85CDF90F9C483, 0x8CA2DF5989866FCB, 0x375E87229B42, 
-0x2055F74C4141F3EB, 0xB2176ABC78AA204, 0x98E797073B2B9E24, 0x3D27274FCE297C4D, 
-0x2725BA6869A15707, 0x48BE22A641ED6DBD, 0x1CC4ECB9375C251B, 0x208E2F4A962ACAD4, 
-0xD2D73EC638D7831F, 0x34F493A43B0291BF, 0xF89B59BB079B2197, 0x9B8DBE83980, 
-0xB4E80F6780424CB6, 0x59057513704FB973, 0xF91A539876D21E8E, 0x5A98610D0EE67673, 
-0xB8CBAB22B3504F8C, 0x214F40205EB592B7, 0xD48702244E316941, 0x626AD791C23B0D2C, 
-0x8EA57C6F5B3485B4, 0x4A434D3715CA2FD2, 0x87DAFAFB59A0184E, 0x4D3358C2D91E, 
-0x291D5E28599D5C78, 0xAB5326AEFAD82528, 0xA895827F339D0D7E, 0x881ED3BD5E275483, 
-0x887D35B8F7FA1F06, 0xAD35CDE713BF659, 0x77261CC789FB152D, 0xC8058FFFD6D72C00, 
-0x1976885A45D77A1C, 0x28B0192092D51171, 0xD78B973DF7E9EABD, 0x296FA18EA0D1, 
-0x3C8462A2463EAD2E, 0x1490AED33EEC150D, 0xAF85200D1DC2FE6F, 0x4E811EB5ADB699D9, 
-0xDE7FC1D474E6C32F, 0x33211E4ACE3B80D0, 0x1A2C54ADC877F92B, 0x35BE67C46086DC79, 
-0xCCBC003792A4523A, 0xAE9013BA7197E325, 0x125D625D39B5F716, 0x395F7AD6A029, 
-0x407343B8758ACC6C, 0xB2E9032D51007C1A, 0xA2482C1724DDAC78, 0x384CB115AFC12734, 
-0x4AA6857011AAD0C0, 0xA1BADE5F71274028, 0x2561E9D14C5BF644, 0xD3D5FCC572AC9797, 
-0x6C1E0F96197C13DA, 0xD1A125ECE698B15C, 0x94AB389DC3D7BAA8, 0x54E305375446, 
-0xC684CD1F41064DA5, 0x7FE9A3CB6A868D35, 0x40BE5F6A75866C77, 0x9A97D9EB95D3404F, 
-0xE01569332C6BCB28, 0x8A609C616134BE0E, 0x518615A31D250360, 0x19F3A774F9BF3653, 
-0x96466A450B1792BC, 0xD82F102153CC1730, 0x9A37CB8CA97A6B35, 0x324E87D7D635, 
-0x22D8E43A026393E2, 0xA9E87C453ACD696B, 0xFC436618ECCD448, 0x41673DD4E81E48BE, 
-0xDA349C43B4120E3A, 0x33DDF90CB1F14659, 0xC4B4ACC45784B9BA, 0x8885B6B63CC37BC7, 
-0x1FF53ADB0F2E0C3, 0x9326CD2EF1788FD1, 0x8FA99CE860CDCEAA, 0x4C9A3415D37D, 
-0xA1C7876297EAA2A5, 0xD99B2C7B6882E383, 0x27E286CB0F59BD66, 0x3931C2157C7C4DA, 
-0x27C28D149EFFAC2D, 0x457C15A20FAEF56D, 0x8E838445A989979F, 0xD692CE35AAE92F8B, 
-0x246BB5A388B75AAA, 0xCF7E057D5D18FD9B, 0x598BB76E15C39B35, 0x15F64AA22B88, 
-0xC57CAA9B647E85D3, 0x288E84BE885C7494, 0xE35375F7B05212A2, 0x44FF6F9F1EB671FF, 
-0x5806024BB8CF88A2, 0xA1C78BA6157F30E8, 0x90A4B9E9A045C5ED, 0xCBBCA18859FF23F6, 
-0x7D551382EB23A869, 0x7B8B924EAE3FF5A2, 0xAFCBE7FAEBDA10BB, 0x6AF1F6796C2B, 
-0xDAF31BE469424B4E, 0xF49F6CF36335FB71, 0x4D8C6970CCE71AF7, 0xC67E405E62F95E6F, 
-0xC8FCCBFFC90B4357, 0x8E994C6C0D64F8EF, 0xCAD29FC88B22BB21, 0x915C5159C2F00DC5, 
-0x24708CD30B6756C9, 0x3CE2C1221F0FBB15, 0x784AF295DE96007B, 0x1A10059FACA, 
-0x96E4CE76FE8D1082, 0xE4CEA7272B328DD2, 0x3760094FC7260D75, 0x82581A72F69CE324, 
-0x80DD30CF17D422A8, 0x94A08DC3A134A82B, 0xEC6370C69221BB38, 0xC7024671B11BFA7F, 
-0x2490667DF357EEDA, 0x5D454042A8E0FAAA, 0x6E2DAF79E56603D2, 0x1DB0DB371F20, 
-0xF3775B5D6A36CBB1, 0xBC801B308A0F819E, 0xC85C0C68B9EBF48B, 0xB4DFB64B05E82F7B, 
-0x8275586C61B923C, 0x919E677C3679F9CD, 0x8671B59D9826ED5B, 0x952F2ADA56A1B91F, 
-0xFD5B092A30F95449, 0xA3F9DB2A089BEA34, 0xAD2E1E05EC21188C, 0x8A877CAE972, 
-0x44D62582BA124216, 0xB8A98FFD9F315B4D, 0x3CAF04FCA39A025C, 0x470F0F1EDB495973, 
-0x8028289FE1985555, 0x913EEA8633F5F61B, 0xC445488A3F2FA3E3, 0x63341DB97325D86D, 
-0xDFCCFC8C3CED2215, 0x3EF543F8798046ED, 0x8A0004933C3E93E3, 0x2E601DA79929, 
-0x26F5AAC6FF686F89, 0x26E363821B6051D2, 0x8A6E9D636735D472, 0x39EEA9C74F2DBDA9, 
-0xF5757A4FF395C6D7, 0xC2589F74CBF79F81, 0xA8DB1F3CFFA6DC75, 0xAC19AA253B196E05, 
-0x67B571C35C24B0E0, 0x7F4E9794EEF51BB2, 0xC61506241E88B25F, 0x26286756122A, 
-0x37729EA889745A54, 0x65E097EBDFA2E99A, 0x656A57A647FBAB9C, 0xD2A093FDEDEDB592, 
-0x654D682696F7209C, 0xF17A884453D0740C, 0xF6BC468A91DB0F25, 0x8FF03383CED4EA35, 
-0xB57E1FF7C5E0CF83, 0xA0687DCC46EB62EF, 0x30CC42596C29250F, 0x61E344A28975, 
-0x27109FE3E31AFD5C, 0xDB754729C5D1F283, 0xB3EA85CD217349A2, 0x49595E4AB4B88F37, 
-0xC4BAAFCB45D91635, 0xE2F77C847A03F1E9, 0x78C0653C24148C8D, 0x3A8F0C341CC95C80, 
-0x1E8FE0149A2BB44C, 0xB94DC2005E169C9D, 0x4BFC833124419F53, 0x2CF0C1627EB8, 
-0x2BC7A05C0FA7B793, 0xB2A7966364A899C4, 0xEF52CDADFA0B959, 0xD3F15752824D38D6, 
-0x5E37591336CFE679, 0xCDBCDF46A7080AC5, 0xADA063128907E707, 0xE4984381A6B68964, 
-0x210B17A32C1E1FE2, 0xC88328A6334DE06C, 0xC1E9AEC61D1A7714, 0x6DB73311DB29, 
-0x5E98C9C9DEEEEB12, 0xB0904BB81390063E, 0x296789070B9B3AD9, 0xD80C1D92E7645EE, 
-0x54B405C1B4DCAD36, 0x4FD895140A41B3B, 0xF1953DED1F62920A, 0x876FF8797791E1A6, 
-0x58B553835D2A6BB8, 0xB170268D3C05A900, 0x8744E9C63B2EA59C, 0x22BA83791EDF, 
-0xD3F5A548C4C196EF, 0x807640966A31FF25, 0xD921584206CE10A, 0x7ACEA30B5CEC62D3, 
-0x6274D33D879E44CF, 0x2A1F06B3056CA271, 0x477E6E8556E1E420, 0xAE964B17F34C9CF5, 
-0x21179CA1CEC502FF, 0xBC403EED5CEDED2, 0x972E25CA6EEFAFCA, 0x2CD4DFE2D96B, 
-0xF15CFED4764E1826, 0x46D527A4A2F5C9BA, 0xD9B6ABEC2FD1E38C, 0x987E32A2F5835DD0, 
-0x80E4D712CD12CD21, 0xD4DD4EB82A532891, 0x64C9806E06D3FF7C, 0x6089E84833669AAE, 
-0xB83A444C5E94926, 0x9C67FC7B08E09B7A, 0x31BAFC405565F5F9, 0x2EC6E3E40722, 
-0x82226CE3038248DC, 0x37786E7EB198F1F3, 0x3577CBF8779E5F55, 0xC490E9ECCB243F86, 
-0xA90A4EEA9EC3171, 0xAED5A1861274745, 0x637BFBD69F3B1400, 0x32502FD635E06B2E, 
-0x1086F18D6AA5EBE4, 0xDFC4ABBE1002A9D8, 0x447EBD7A958D8202, 0x2B819DDEC198, 
-0xF9065C38C89CCDB4, 0x2AA7B0E883EF2BA1, 0x1E3F37EACF8FC429, 0x685BD6B3355EE1E8, 
-0xCE73F1852F15C6C, 0xC30C7E53396EB2A5, 0xA7CC73CAE6C9F590, 0x50F36BF535D66DD, 
-0xEA44192B877B9656, 0x62B744A23301598F, 0x5A2F66D062D717EC, 0x4E14339616F4, 
-0x55ACB6331AB0D632, 0x1752FAA7EF75753, 0xF8FED41822B0AAAF, 0x6F6A45FD86064B50, 
-0x892865C98E8359AC, 0x5D0CA69279EBAD5, 0x8D171C0FE1C15761, 0x35C93C84517AD164, 
-0xAEF645B52321EF96, 0xD032957A0BFC5416, 0x54CF3BBF286C0D82, 0x473A68C6F0C0, 
-0x616604C165F5C0C3, 0xCEC2842FBBE13342, 0x5A04260D5895267E, 0x49976BECEB95794D, 
-0xEA635FD82F241AFC, 0x201A84E9A27D2FFE, 0xF6236560A255BBFB, 0x68A08E785524DAFB, 
-0x5BF60D6944BE38C8, 0xF0DCC49AA8165D21, 0x65BE5855E5CC148, 0x3C16096447BC, 
-0xE65C87CD943068BB, 0x2EE0E28531D621B7, 0x6524CB0A4E830219, 0xF3F35D026F932681, 
-0x126A80A7C8DC30C, 0xE569E5D58F2B0B0C, 0x108F47B9B8F9952F, 0x7E25C1005E3B16A9, 
-0x985F000E8F7D1360, 0x68119D6AE9894AF4, 0xD000FC166E4EEA31, 0x331D81E8F591, 
-0xA4E33C64CDF9951C, 0xB2181551FB507648, 0x1D5FB9138A691849, 0x77234061816335CE, 
-0x871CD8F4D9B2F5D9, 0xE452DB1D4A35BD01, 0x47FF179422F2DF7B, 0x872CAFE1D127F40B, 
-0xA17CFA8E88323298, 0xE484E141226718F9, 0xBA2E24B94650E42F, 0x3EE395963864, 
-0x62945BFDA48CEAF5, 0x3982854A2A491D58, 0x4614A0C3DABF9F3, 0xFC09B10DACFF5C99, 
-0xBE5515F461512BF1, 0x986C552EE3B1D8DF, 0x5FF406306736829A, 0xC82ED9443215F8DC, 
-0x46CF27E7E539A312, 0x4E4767C56C175113, 0x61FC19A2849D95D1, 0xAA672FF5FD8, 
-0xD705F95F1FA65102, 0xEDAB6C811A268DAC, 0xC137B022630F315A, 0x23311050F7BC17AA, 
-0x86B8DDAD2A8DDCA5, 0xCD8A7B7D8C81E0D3, 0x55ADF22362F76AD3, 0x15FF08D8FE808090, 
-0xC9D3094A0CDBB380, 0xAF6A01E702AD83F7, 0xB0E8F8B77323D98A, 0x492B508B0DCF, 
-0xFCDCEECEFE600650, 0xA3FBF574ED66AE01, 0x3D20562243ECBD4C, 0xE3E0600E0977C94A, 
-0x249E98E64BF3856C, 0x387ED6C21A926A38, 0x9F77694A0FA34AA3, 0x2E8FB6E8CE801561, 
-0x6DE92C3A0F6C275E, 0x6D74F4AF3798EFEA, 0x80669A6AA14E2FFC, 0xACF6E4A83A, 
-0x1F8C5952A33CE3C4, 0xA55CC4218E9E598C, 0x5141E01DAC6B3F6C, 0x63850AAF817A4B6B, 
-0xDFDEBDD9FB799461, 0x2A276F6576B5D258, 0x8750700F274A33D6, 0x3942838C4C48F4DC, 
-0x569692752152C09B, 0xA618271A9AE11B30, 0x3691102277975649, 0xF60293E851C, 
-0x4F8261CF4F932189, 0x2F51F06B8EEFE929, 0x9EA19A176C468069, 0x38DE79CB7B2D2E2F, 
-0x2D5ABA06E232A273, 0x40470D932268BB4B, 0xB450C40D344B9D2E, 0x71B3967F058BEAA4, 
-0xD6149B09C31426E5, 0xC190453CE03B9EAE, 0xA785666E87DA0836, 0x4ACA287523A6, 
-0xF077A840EEEE06D9, 0xC316C9F35CE13A4C, 0x79CA688DC22DBE69, 0x98F644118F7AB548, 
-0xE31B9CEA76632CD5, 0x21AC77C740B2FCD8, 0xA76A33BBB723D86E, 0x761F56B07FFE102A, 
-0x32E1A967A748D192, 0x546110E83F38F560, 0xDBED14A1AE666344, 0x2DBAF9245B4A, 
-0xF0FED0648E50D6A2, 0x110061B0B1A87C73, 0xD5444DE646B70DE8, 0xD3E54C5A2C3D23D9, 
-0x4ED146FF73370B51, 0x993AF2B5AC5D114, 0xF8E6750BA913485E, 0xA4F9E52ED1F379CA, 
-0xDFF69D163087F033, 0x19298D0301030AFC, 0x4D467A171090E36D, 0x5AEA0EA22145, 
-0xFC3F4AC63B631C88, 0x355E56884ADBE2B2, 0x7F71507DEC273D3A, 0x925B9B764DDC831A, 
-0xAE1E589A91E3C9B3, 0x4FE1627CD2C553C0, 0x8E0306A554532740, 0x83C0ACAE8BC82A9, 
-0x1D75089605CE5ACE, 0x29327B1E6ACEE33, 0xD7BADF5FCC3A5D72, 0x571259A3618C, 
-0xFF9CF76C38272B60, 0xD9B5C12E9B2218A3, 0x1501708B229AE248, 0xF9B3D6EB5698107, 
-0xD02D29F11BD495AC, 0x6C01C29FA6474F75, 0x27068AD0CCA913B0, 0xE65A33ADE259EC6, 
-0xFC51538A12FF7BA4, 0xCF5AD11135E37183, 0xFA84470609E84B96, 0x2642AAC7B8AF, 
-0x6DD526EE39DAFD5A, 0xB12F6BE32B439DCE, 0x8BA47DF0AE821848, 0x6C35CED381C6D42C, 
-0x31BAC0DEFDE5705D, 0xDFF98BD3C7C7ED3C, 0xB631CE6279D0A018, 0xF3741CB21D0368D9, 
-0xFE4079541BF59EDC, 0xD7AFF75128080579, 0xFE6F23100BBBFBC1, 0x2FC95B9F9D38, 
-0xB47EADFAA20A029D, 0x1FAAF9A10DCE438F, 0x21011097DAB7BEF9, 0xACBCA9D32105D175, 
-0xFA61843DDACC97C4, 0xCA131D9CB4076300, 0xC6527F97778FE364, 0x758A3D43FC2218A7, 
-0x3887BFA5A77F0132, 0x2CB6DBFCCA8CD407, 0x2D25BC49356A6B01, 0x2F3B7EE74BB5, 
-0x4B2EE3E0837CC622, 0x2C13A713682B5459, 0xD7F35736FCC78D24, 0x230DAEC8EEC03892, 
-0x82F7F8FFFFEC5E2, 0xB158057D207F386, 0x7F1584B9063597A5, 0xFC330B68C2BFC937, 
-0xC18A6E881700F2FF, 0xA75C0DE5F66EF9C1, 0xF9C1633B1114D5A0, 0x2C523C63D4AA, 
-0x763D5EBCA751082, 0x8B0DA1232BB01EB0, 0x90BA53DFCFC83A1, 0xAD34533A9421C3B, 
-0x41026138C64409AC, 0xC32DD4717B3B69D9, 0x7EA69A08D1287C95, 0x7A41B093628CD330, 
-0x49B01299469D7458, 0x30247D382FCBE2C, 0x8C1B3264754FBBC4, 0x28BD9C7A0FD0, 
-0x7E11EAEB1EEFA353, 0x1B890FE9671D9064, 0x847AA322A2F010EB, 0xF4522FCAF1828564, 
-0x2F46E83D7EC3810D, 0xFDA762EC14D7D8B5, 0x24A29B9629A941B1, 0x9AAAC4EF9D789B56, 
-0x1D8010DCA1999EAE, 0xA0EF205E53226284, 0x6FFF53DBA9504816, 0x3132816F8833, 
-0x23ECBA2EACE543E, 0x196881394D851CCF, 0xEDFFD312B72E0C69, 0x4C2C2751CCA6A72, 
-0x9E79260BE5DE2A2, 0x7256CE214E54A9D1, 0x2B1203D01322AEC8, 0xA227D54241B6F6EC, 
-0xBBCEC10FF4AFF226, 0xA069783B4D7FE7BF, 0xEA6D80B515DFF321, 0x10282CBE15DB, 
-0x749A8551804BE07F, 0x851C708AA21B1412, 0x28BF0CB0FE03D651, 0x15BD092F278B82B, 
-0xCFE5FC2BAA48D1FC, 0xFA4CEE60B289AE9D, 0xD204D125F23FAAD2, 0x66B247608D7B1E3F, 
-0x58A1BE842A9636EC, 0x528793501A6C08AB, 0xDC81EEEE409132C6, 0x610B890C3448, 
-0x356F409158754EB7, 0xAD909A4A679DFF01, 0xBBD144F0BA2FF33, 0x39D75265C2549D06, 
-0xC93C709B70A13E5D, 0x45506E1C1FC7D5E9, 0xE1D6DDF9CE391036, 0xAE79A331E52A2F71, 
-0xD48AEE4246617370, 0x3BBBB56E881DE42C, 0x41B29D17AE17EA21, 0x42EB98C60752, 
-0x93C92FE24FC5A89E, 0xC250597304A567DC, 0xAD6C60F00DB0951, 0xCDF80811EA8CF0BF, 
-0xB93FF8F7E6261AC, 0x599AD8BD40CEDC22, 0x8C4768E40913B88D, 0x46D59D90187B08CC, 
-0xBD99B021098D909B, 0x3E69530D2CC75FAC, 0x66DB8E0EEAD8FAD6, 0x3F0770BAD482, 
-0x9C0454EF9C26B147, 0x9ED791419CDE3841, 0x9805D6B3A52F7842, 0x4556FD5984B85036, 
-0xA993C0F96C83D15, 0x8A17ABE914791EDB, 0xA1EE217115396FD4, 0x125EF6C811CEF652, 
-0xBF834B4BA9852D25, 0x8C5471A358DF4F05, 0x5FD16BF370D5BCFB, 0x609972C6651A, 
-0x76756CECB9460C9A, 0x885F91E5E61E0F4C, 0xA0522FB7A4C7E94F, 0x479D60F2DF2083C1, 
-0xEB1C21E8B12ECC2A, 0x60ED9764E1724172, 0xE9DB64013302DD8, 0x571159A667D3985C, 
-0xFB60BC3923F0300B, 0x7BE0BC692D1A56F0, 0x65D9535C561449A8, 0x2986E74955BA, 
-0x93BE5B4242B84AA3, 0x6A226BBCBD8C623E, 0x6A96B751044AB6CE, 0xB139B44D566E74C4, 
-0x91E2A2CC946D1343, 0x21CE430B6896B135, 0x9499D60AFA2821AA, 0xDE7FD408FAE0841E, 
-0xE70433BB8C5F180E, 0x7CC7BED9B730AFE4, 0x8DE1FF1DD8136839, 0x458691F707B1, 
-0xC8F47AAFB65F62CA, 0xBF57DE99E7AB7AD7, 0x918CBD9CD2692C49, 0x1D9CFFBB0492F16D, 
-0xD89B563918383160, 0xF53980FE21DDA22E, 0xEB305F4320D16103, 0x86113DCA995E46F0, 
-0x8B745374F1663929, 0xB57038AC1A11DE13, 0xBE0F4352FEF1D2F2, 0x3E646B2C949E, 
-0x86F4284EDF4A64CA, 0x5A909DD4E9702A5F, 0x92E950DEBF5B0DC7, 0x9CA4D941CD497C2A, 
-0x9B8C08096EB453CD, 0x89AEC7CF983CB266, 0x5CCC71C1402C6373, 0xB6E5599B0C8C8CC6, 
-0x2306659A5BAFB942, 0xC057DA9C1C6C755A, 0xF857B1DAE5AD1B93, 0x6BEC169CC538, 
-0xF32F4C847B1CCE18, 0xA7890BA45854AD9B, 0x1F96656DFA6633D7, 0x8B3907A6E18EAA3D, 
-0x47EFAB45D523D8F, 0x3FEDB5C9A2750C26, 0x44DE24417574D540, 0x83C79ED7E8033C7B, 
-0x4BAB2400DB6FC746, 0x288549BC8F606CDC, 0x1DF09043A9DFF116, 0x4C0ECF4604E3, 
-0x58C3BE6C20EFE60C, 0x2090DB5426D1FCBB, 0x23ECB4C9C5E5DBCF, 0xF32D1D186957B2C0, 
-0xAAB2095FC726F254, 0xDEE3CE8368B9366B, 0x4E5FCAC0813601FE, 0xDA1736B26B3AC321, 
-0xE811FBC1DC61A998, 0x9B170A7658C624E6, 0xB9EC5DD46FCCC180, 0x4CD1969DB2E3, 
-0x5FD562F9F6B1D9FC, 0x2BF0308113674766, 0x466139CE2528EC96, 0xCEB73BFED5F7219F, 
-0x388F1BC02A768E0E, 0x7CEFA5F79F0FD64B, 0x27917B25D1A96B71, 0x88CD1D33D2AB8E, 
-0x13A4E7FDBCA4FA09, 0x6B2DBDE7652C9F87, 0xD40DAFCE4EC2A4A2, 0x2AA4DCDF9850, 
-0x5ECB49B9A95F810E, 0xB839A84BDCF60FE9, 0x7DF56CF6CF26E48C, 0x53459F517F99C598, 
-0x8EBF002501215BE4, 0xB09FC80853F7248E, 0x60A829B161F41BB5, 0x28571273D6DB9DB2, 
-0x37DA384A02654450, 0xE821D3A486D47E16, 0x4EB8C77E23D62FE, 0x649843813B2A, 
-0x3CA53B149E04CB14, 0x9A9BFA1B026AE402, 0xF80F4D73A762DAEB, 0xDC00FA06949A8FF, 
-0xE2A71BA23CACA37A, 0x516879F5A1897DEC, 0xF1740759090CB314, 0xC909FDB23B15A7AA, 
-0x154D8ACE0411A08D, 0xA96797576CCD4373, 0x2C3F2D3655EA81F3, 0x6B5A9E6663A7, 
-0x89F9CBE66707C624, 0xCA57FA7DCFB3B035, 0x2237BDC198689B95, 0x987BBB66F29BF5E1, 
-0x984AD06D16D10738, 0xB232E1DCA664ABD, 0xA38EFF021E441350, 0x8CB53820E6D6A72A, 
-0x96208D4B7FD0150C, 0x4D3D4978B37A2D40, 0x23F17991C1B68A67, 0x502DD9FCC671, 
-0x8BC7C9FDB7BEBB7F, 0xFF9D95B8AA25D2C0, 0x15763ABAF81F5CDF, 0x23904C838CC99D4B, 
-0x2CF3FEC2F736BAB4, 0x6340A102BAFBCD7C, 0x1C7FB782599ADC7E, 0x4FA1018C4EF4F8CF, 
-0xFAB38A160576B819, 0xFDC0EA95EC137F97, 0x5854752D3A204DE8, 0x55D6D1896432, 
-0xB8D588B6C27D4117, 0x861AB7A4092A55A1, 0xC91E2742A0042F00, 0xEC8270CF7A6D0880, 
-0xB7FF0DE3820CF965, 0x19C4EF819FCA7DBB, 0x5B923C4C25A250EE, 0x3D99C4F242FFB2DC, 
-0xB3B55F875D732A7B, 0x9F84B32EF49F760A, 0xB8E181FDA32A2908, 0x25BB64833307, 
-0x47BC1CB17A7E1286, 0x74FBD33505E42365, 0xA39D9C2F7487E837, 0x7556481E5DDCF980, 
-0x3A4BF584062BD4C0, 0x2F6301C6733771EE, 0x61E925FBECBA2A78, 0xFE966DDA1CA049CE, 
-0xB1622CE60780D83D, 0xB02F59841B8D082D, 0x7B39442623DAED96, 0x5C126026B032, 
-0x11FE85506D177538, 0x85503ABC349B7BC6, 0xE504C7E450E0CF9A, 0x13C4A5BA29AEFDC, 
-0xCA3B7C0FF6D9D68, 0x766964B2975B8070, 0xF48675F1DA3B5E34, 0x54FEB4F4C5240F0B, 
-0xD7584E8AB12EDDB1, 0x3FF8EDF8F77696C, 0xFEECC7FD5957E927, 0x1357BF3224BC, 
-0xD979F2541F5E8077, 0x7BD799B8BC0D354F, 0xC14464D5B431D912, 0x27AA02C4833C0476, 
-0xF57DAD262C3F6627, 0xEF9C156EF0F2537D, 0x2214C4F664275D51, 0xD63012DAAA0BA107, 
-0xC8D9616476CF9BDE, 0xA33CED58934AD3D9, 0xDD5396EF74B67EE2, 0x49DB875DE0D0, 
-0xB9A90B41AF668B56, 0x2B1F170C81A3C27E, 0xD7B0E0601DFB0F41, 0x366CA5A6055E155A, 
-0xE2FFF54343CC92A1, 0xA105DBDA56331CC6, 0x6B089DE63B6C4591, 0x89BA2BC0FAB1D110, 
-0xA7782F39C24DC6DE, 0xDEAF2E71945DA8EC, 0x73D09FAFD018C2B0, 0x6CBD4C86B631, 
-0xD58CD980AA00A26B, 0xE1414AB6F953821C, 0x61510AF10C3EDC05, 0xBCB42443EAF34C48, 
-0x30014D06C9355408, 0x391E47ABAEED5389, 0x2B235637BFF6F1F9, 0xDADE47FBB41861F1, 
-0xE626BDB79C2E2210, 0xA8C94937BB335285, 0xD98351DC76E94521, 0x2D2E9099BF6D, 
-0x8643407249B65670, 0x898F6AAB67F70247, 0xBA5A7F3B1154A5AD, 0x4D438A7ADEECEE85, 
-0x10D27DDBA60FC99C, 0x968B6BCF0586F795, 0x17DCFA6D12FA3333, 0x1A35A538D24AD8EA, 
-0x326014D6174386E0, 0x8BD10FBF36D1FC9E, 0x70849F79ECE8B0B, 0x521A7012E017, 
-0x6308EC5FDA53377E, 0xB5325059A4B35061, 0x9B8868A84388CA47, 0x559761D1E38B1850, 
-0x86FF3328C75CE984, 0xD7B3F686078A6922, 0x16D674578889A2FF, 0x78AB02F47C7A2373, 
-0xEEF0CAFC6100B1CA, 0x5B7341FBF3D3ED25, 0x5308DC8F0EA2F70A, 0x12560F3A785F, 
-0xC28419F05A90829, 0x1FD6EDE2EED0206C, 0x7065596419480087, 0x8CA6654151157099, 
-0x753ADD8BB536DB98, 0x804EC277BEDD897C, 0x284E014556B328E1, 0x251F261FBCA917F4, 
-0x532DB1265D53C08F, 0x162F8C19CEF43CF9, 0xF30E8543D20E5517, 0x136E1F50957B, 
-0xCEEAFC40A1CC067B, 0xE5B0776F5E1B2DCF, 0x3D9EBC530472AD0C, 0xB4BB6AA28A9B5FB, 
-0xA4EAB85332A8D434, 0x91C2FF72FE2BDF06, 0xF9659888B00E7278, 0x18E1DB2C574B9FD3, 
-0xEF1B9E85024C3D61, 0x680749BF8BCD286B, 0xC53F3963F7189D2F, 0x36551FEF0733, 
-0xD45D96A06AAD3DC, 0xC466473A6A2FE813, 0xCCE2B6847176D4E9, 0xFFDC27EB9F963324, 
-0x974DAFEBF27BAB65, 0xD46FA308926FE3A5, 0x56C3C7DB9113CACC, 0xAD0868E34DDA101F, 
-0xDDB353D6E710A8FD, 0x7AF9095466FD60C7, 0x61DC363543C49A7E, 0xF272DEBDEB, 
-0x45725C034567F920, 0x826A9BA2049E03BE, 0xFF3D36FC4268308A, 0xD33121BB5263C916, 
-0x577A9E2E02FAB661, 0xEAF0D96A9C524623, 0xB48677FC3826BEA0, 0x6E1410A6A3C25A8D, 
-0x3ACF57EF694F8832, 0x29B329CFB07E98EF, 0x68E189B34C572CC3, 0x5C21CEF2C25A, 
-0xE0CEDF6FEBA18B24, 0xD52BB2E82296C374, 0xB76EF8D1CB247469, 0x5A276D47B8EF1260, 
-0xAFAAC113AEF39768, 0x611E71C0E075DAED, 0x76B1AB88937AF7D2, 0xEB7AD41910F54061, 
-0x553B26B121FED0AC, 0xCEF8B4B94CE33046, 0x11BDF023DFB87DE4, 0x1E70DAD998B, 
-0xA8928504B86957DB, 0x15C32737306CCC3, 0xF618511B7DEBB6B0, 0x57008B7852ABEC22, 
-0x1B4A26BA44978A9B, 0x3A88122CC11F1C97, 0x23F7448185944821, 0x36DF4AE39687EB20, 
-0x449CE89F487C1D16, 0x59C5ED81EFAB94BF, 0x888BBDB6D7955789, 0x1CF36905750B, 
-0x5A446633334D2B9F, 0x87245277C095FABD, 0xEC96E0C2350696D4, 0x93D755A33E2F8CB3, 
-0xFE11EC6671E80641, 0x435A950E9427EEDC, 0xBA1DB12D1A1D0834, 0x213240879321B2A, 
-0xF9689108B8BE8942, 0x3483DC8972EC3072, 0x6AB6FB7CE889DFFA, 0x29FB13B6C706, 
-0xCA9925FE34CC8177, 0x5313B81E196AC3A8, 0xEE10C087908D10D1, 0x1857F81E0C17341F, 
-0x7E4BDC7840C59035, 0x73EAEBB8B474BDE2, 0xEFC930C2C513D1A2, 0x36DE04D7A618FC93, 
-0x2759F4200DE9D61A, 0x967DB7C6F59EA031, 0x2996DC2F05186A1, 0x6B8F9B481A5, 
-0x173626E8E016B451, 0x195A9A1FF5458F5E, 0xD79861561419BEB8, 0xA1807B10EFA1E76A, 
-0x1FA8FE3FF4099FDB, 0x864AD0EB1F4E5969, 0x2F42EDDA3AE88659, 0x2920A49DAC7137EB, 
-0x8DF64920993DA0EC, 0x977C04B2FB1A4B74, 0x4B46DAEEC939D6FC, 0x6F3DC20A495D, 
-0x8AE5F1B909C53EF0, 0xA694D0805C58CA5E, 0x2E0B599E4AAAAE13, 0x119C2FE5F8BE1DA3, 
-0x7B7839552CCA35B2, 0xD8ECD6D3A28E6106, 0x4F2A2EBB6D2C1AA9, 0xBAA117C26C2A46FA, 
-0xC7D80523B831BE2E, 0x44090F48235A177B, 0x4660F8547DA6D136, 0x564DA1E86C02, 
-0x711A2121534B45D2, 0xA9B3798B0FEA9DAE, 0xE24832C1E967FFF0, 0x8025BD1EC62944B0, 
-0x577C9D3241DAB723, 0xB4C9D456D4600DDA, 0xA27326933645826A, 0xC2281BA36F0CA197, 
-0x2B02F64658CA5ABE, 0x6A9B84E1CFF8C728, 0xB9AEB42A1467B3CB, 0x286ECB3CB23D, 
-0xC9184CD579BEC11D, 0x6412C8198B4933E4, 0x4C5E1CED535494D8, 0xC65421C183719DF0, 
-0xA392158B6DCE6A60, 0xE45E0458BB6B8B9D, 0x2F418BE54850E307, 0x7D5FD837D48D644A, 
-0x779447BBC9F8164F, 0xDF16268F8E607392, 0x92E2D7919E7F3E5B, 0x6E7B11998403, 
-0x2BABF0F98781938, 0x704B428CED44D74B, 0x8FD6878E2A6BC8BF, 0xA10053079A97EEA6, 
-0x46E3D30EAC8C2C96, 0xC038D0F199ABB4A4, 0x85E22FA3DFA0C1F4, 0xD50929F62D4467BE, 
-0xCDA63AEBC5B83C61, 0x34F21A71F0EB3DA, 0x13742292BF734761, 0x4113DC47CE47, 
-0x4A19A4220E929E38, 0xE083B2DE897F7607, 0x9831A3801543B7C8, 0x23F9769A98225E83, 
-0xFCD72245A7AD2A28, 0x6F2C3EB409B53558, 0x4E7E06A216D074FD, 0xEB35D471FEDB575A, 
-0xF82CA5CE22A8CFF, 0x92B348C0B6BA6EE, 0x1A7E4E1B28F10CA6, 0x660EA07407EC, 
-0x555034F329BB5492, 0x93FE5BD1BF1FA6E6, 0xC94EBB520BC62BA0, 0x70BFE2F3679668CF, 
-0x9BD7C75D6AD49225, 0x813DEC8E1100D5AB, 0xA7DA6DB2FA472A86, 0xA4DDA0677634D77C, 
-0xC2AF2673C7C07B3, 0xCCB8368E4F65C934, 0x803A511A39F843C1, 0x7884079823B, 
-0x87CF5A69DC51D2B5, 0xB90FFF1ACFEBA2DA, 0x78712F709A03513D, 0x4B796476E1B5B63F, 
-0x4C588BE9FBE9DB1F, 0xF587D451B1091E49, 0x6DF50C2C6998FAB, 0xD41A03FB74CC234C, 
-0x7A031DBC17AA5AFC, 0x19A659D1411A48B5, 0x2975702E73B80D1, 0x1321D2D76167, 
-0xC78CD309B55F9B28, 0x78ADB98AAE9EAB20, 0x5ECEAB85D1253596, 0x48BBBBF6B4AB3EE6, 
-0x31573226CECC0D75, 0xD191F8216C3C585B, 0x1AD767DB4AA86A52, 0x7FB30E61853E7AF2, 
-0xB93E435E561B5908, 0x9FFD7DF8746868C3, 0xEC7C8D15B3EDC55F, 0x50AC4FCC2DB7, 
-0xDE24B02C01C2DF3A, 0x66C836827C57FCAB, 0xA718A24636E16D4D, 0x3F1FF5C6F3193704, 
-0x5B9B362439EE6B02, 0x5ACAF750CE7D85DE, 0x8D27C775725D254C, 0x3A55942B93DACF8C, 
-0x1E08E8D1B2A3ADFA, 0xAF4792D648FAEE0C, 0x42E453EB880FBDAE, 0x131036884459, 
-0x852C56DE08AFAD7B, 0x9FA1478E10721A66, 0xD172E928A3D11201, 0xD0B13D083F28A3E3, 
-0x434D1755E5E68337, 0xB4B7CA36D7C7DAAD, 0xF2F90CF930920F8C, 0x8EB41037A6DE67B4, 
-0xAAC41C3ACDD018C1, 0x6EC26A5EFE73C8B3, 0x905F5DC4FE2D3159, 0x2A18E9D926B, 
-0x56AC9D2AB8AB820, 0x30C3364614C34A6F, 0x5735FB19AE7AA7AE, 0xEA47043B2CD72EAF, 
-0x8FC59A6828805C60, 0x657CC3FCCA0B64BD, 0x7CF1947D46C27062, 0xBC07DDD43ED219CD, 
-0x320B097604588F12, 0x84D40AA5BE4A9AA6, 0x14BF1403726D1477, 0x3D31F1414E57, 
-0x970EDFEF2C43E696, 0xB1A88DDEBD0C85D0, 0x1179EBA5DBD84592, 0x615F240906355480, 
-0x862D948BE81A9007, 0xA59D0E33101D6919, 0x1B97AF38D44F2D56, 0x6939E4EDC54A7F2, 
-0x6C1A3713D5A2D86B, 0xA5DD24CFE65215E, 0xC6A169585AB3F3B4, 0x5D4CF9768E1B, 
-0x54B5A6210665218C, 0x422CC7C64F6E37AA, 0x8CCA251782790218, 0x1CB2CD7123B23AA7, 
-0x24D35E1C628DC1AF, 0x807139266AB6A562, 0xDEBD3F2BB8948348, 0x9A17B8B3EA0B97F8, 
-0x51C3C9A3C7925DDB, 0x301AB472FEE8E755, 0x7E831AB8DC9E1FA3, 0x22191EE3FE31, 
-0x7FF5E5F3507A7964, 0x3FE05C1E0A61041B, 0x1F8A13717F16C7E5, 0x4EEBB44F5296F8AF, 
-0xBA7BE5FEDC7BC460, 0x83C1F01C984FE101, 0xD705174ACB0D618E, 0xCAFD23CD94AF32B6, 
-0xDA267E913FEF75A6, 0x2C7C71FF27EFC59B, 0xB8E61A1649E8EDBD, 0x5A95E092DCFD, 
-0xFC9D324253AF5A5D, 0xE932F0F96805DAAB, 0xC6267BCE3B4AEEFF, 0xF5916E2D356D09FF, 
-0xD41D02D4A1ADAAEB, 0xCBA624D686D797A0, 0x6060B7BD98D92F08, 0x82779348891B1733, 
-0x6D38AF82255E663E, 0x3F3BF2E6E26AF87F, 0x62A6EDF5B043B52A, 0x2B3A0B5882C8, 
-0x49361D2F40992F78, 0xC30D5D03552AAB0E, 0xCF5FF8638872829D, 0xF27E72D50812A588, 
-0x37A6A5057788C552, 0xC5AE25EF06486BF7, 0x94FC608E188A6291, 0x76E8F33BC34F932F, 
-0xA56DD94B496C820B, 0x42D1814180B9B038, 0x2DC2C74B489330DD, 0x6AEB9B3C5400, 
-0x25DA1023F2C48104, 0x265872B6DCFE2A6, 0x6074805B8CD53258, 0x9A4744CB22B8636E, 
-0x721FA933A2063B28, 0xF25A813F783FB17, 0x6B5703E42294F036, 0x2A8007AE37D79417, 
-0x99F3CE0E49475907, 0x1808403944739FA, 0xBCF4AB9C8C928D84, 0x62C60544EDD5, 
-0x5602647255BFDE10, 0xA0D65E6DD214C65D, 0x5CCE14294A8B7B3B, 0x6D3CE114E07A764E, 
-0x6D80168A21EEA03C, 0xFFE0F5254384669B, 0x36032E375A233B28, 0x21AEFBB79F8CB0FB, 
-0xD8CCBBA26852E830, 0x503ED3923675CA9E, 0xCA9963F417E66FB2, 0x25461C97A584, 
-0x55C4C63614FD2ADB, 0xE3FF25EA39C572FB, 0xC6A7A424E33214DC, 0x7B71CC613E7750D3, 
-0x93988262C7F65500, 0x3252744E413E358, 0xA127C391EC5C8B8D, 0xBB0642A02CE58F72, 
-0x1F30F19B5FDF97F7, 0x4B6FFD16307EE871, 0x9D12C20D3037DE5, 0x1D5BCA8D984, 
-0x84D7876884EF7014, 0xD474BC2FDDF65144, 0xC010F0E5893034B7, 0x512DB1534EAA06E7, 
-0xABF4B636FCCAAE7B, 0x8EBB9A41C1309375, 0x324C22D8300E6F92, 0x773428422C386E1D, 
-0x6E9D4DF82C65CBBE, 0x9F3F319607B85C58, 0xDE938B340E8CEF0C, 0x46596FE20972, 
-0x77B32C2DF7C3C1B, 0x6FDEB5FF721C5AA7, 0x559F70A1D4B422D7, 0xBBB54DD829BF4A02, 
-0x8816E8BE6955795C, 0x26815DF5330D9453, 0x3124055783261791, 0x30B781341C854F91, 
-0x5FAA9C3671957A3A, 0x84361638C712A943, 0x8A5B59501A126B, 0x40CC4D56413, 
-0xD5AF37E8A39EE3FD, 0x1624A57A4F23ABB0, 0x7B60C953601A0E36, 0x53CE6131FF541EC9, 
-0xC1A508F1880C1CC4, 0x658BE650612736D, 0xE3BD3093079274C9, 0x446E598A0139D3A9, 
-0x2976D28830CCBE37, 0x4F161317DD454336, 0xEFEFEC8731075E27, 0x141FDD3230C2, 
-0xF8764C53D3421705, 0x6C7C011658EF7D16, 0x82F95CE90D44A070, 0xC18281804B5D576E, 
-0x620C10D0733838C5, 0xDBA9B925CCD9AB75, 0xAC07704C8746C57A, 0xE458C93288F378E2, 
-0xCC1FC2C2DE90613C, 0x567F0A8AF39A6B6A, 0x3F0DEE9E3254F372, 0x4DBA5BDE7200, 
-0xB5F754FA4CAA3D05, 0x8EEB4795DA94E7F1, 0xD8C8347052D74E97, 0x8820AFB6AFC3ED6, 
-0x30B2C87388C75A04, 0xC53C2E7365B2E92, 0xE1E6DA425C27426, 0x1BDA11409052EADB, 
-0xEE793C81C41EC6A5, 0x766F3B56B6497A45, 0x8C4AC0AE5AFC0F81, 0x411639BA7196, 
-0x14D710986CADB4FE, 0x7A1687C0A52BEFE0, 0xCAE73D113CEB4594, 0xC3259210EE500CD0, 
-0xCFBC3E0D064B5AB4, 0xEE8BBCAA93F8A378, 0xEF2FFC680D23C97D, 0xC67D5CDE14067974, 
-0xB9D9F6103677B8DD, 0x586605196E44FFD9, 0xFFD9E5C51A903B6D, 0x77B4E83DBE2, 
-0xFFC57EDC24F0B010, 0x9AC69F5D24EBDC79, 0xE4DDF993CB8255B4, 0x3C411B83E8359F70, 
-0x115E141E486DF430, 0xE1A04BC006DFBA54, 0xA418F19FC71A77A1, 0xBFD2FC5B5A855A59, 
-0x463D6CD264A8F8D9, 0x940E77A319F8B834, 0x6F6C9F7619218B72, 0x60D4B36BB157, 
-0x9D12D5EFA493794B, 0xD19BCA87CB5598AB, 0xC7093ECE3801A3E1, 0x5BFB5A4088DAB581, 
-0x7E800195CBE8456, 0x14905DC6BDEFD2F9, 0xE55AD8F7EED2B20A, 0x555D7D6B597FDE7, 
-0xE84F61B683EC4330, 0x8AA07ACA6505F0E, 0x4E08F3349B7CBABA, 0x60534156428C, 
-0x3D09CCE635DCE9B6, 0x49DC03217E042D48, 0x24440782FAB86E46, 0x555CEB99EDFC661C, 
-0xA6E75D4291E49E84, 0x6773A4B14890D683, 0x398A520DB6DFF7EB, 0x437233D3B41F5656, 
-0xFBC666F50936FA67, 0x4FDF44FCEBBDDADB, 0xF507E3A23BFCDB5E, 0x2FDC06EE43CF, 
-0x55D7E2D6FC9FD544, 0xFD7061EC28F48CCA, 0xD9A2ED395134083D, 0x3544887BFCB99001, 
-0x637F05654FC3A7A3, 0xFF748791F1B2D13C, 0xE8ADC7F5CB65E788, 0x6ABC6B828F43B94E, 
-0x526801445ECB0989, 0x4B536A24636FA215, 0xE1C5782F224C9D19, 0x6A0C9CA28ECD, 
-0xC310BE4B648E6007, 0xEC0A45034F4EBB08, 0x1FC4AC4A4CC8F4A, 0xC21981E11270DD59, 
-0x2F38DC8F747FCB64, 0x519682B115151307, 0x3BFCEAE3339573E1, 0xE220EC93E6654647, 
-0x6096EE8132DB0652, 0x9F2D6F791AEC69B5, 0xE3C246E429F6E7C5, 0x440195946F2D, 
-0x39C710CEC6A9A697, 0xAE2A8248E6A96603, 0x89DC8751BB87AD59, 0x69594717F588D730, 
-0xB1676A4FE6359901, 0x5B458B60706C4F8E, 0xE30F6D6AC1430FAF, 0x716CD773F0E3BE0, 
-0x4D5504838FD61D05, 0x2F17D6546EBB81E1, 0x4EEBD1D6645F6F6C, 0x1A98BB8810D8, 
-0xFAF84DD265BFCF47, 0x2994E377DAD4E8ED, 0x3A002F0D0A1866A0, 0x2995F03FCAF9DBF0, 
-0x41A38DE91D61F658, 0xDCC6D75D6B55BEE0, 0x86C9405F1A96EFB2, 0x3034B72904386C0B, 
-0xB0A6B51563ABAC62, 0x990C6E7FB69880FA, 0xBD760D13300FF5E3, 0x122CC60DDC9A, 
-0x56E8A60558E199B6, 0x274948419BBBF650, 0x8C1F74719A898ED4, 0x607978458D264C38, 
-0xC947FE83D89557C5, 0x39152089B89B40EC, 0xB20E8171081D128A, 0x51FEFEEF8000BC08, 
-0xE8CD09BA9B329784, 0x7885B3E983D9EDDC, 0xFA5CED75B525F0BC, 0x20C90E71CC8D, 
-0xBF1DBEFACE905B5C, 0xAAF8E22B65B3C1AF, 0x5ABE5066A7A0080, 0x4918B53D45C71A12, 
-0x2A0B82E18F9FA131, 0xDBEB35BE2BE653D5, 0x501811FF6C6CE486, 0xAB038B187A1BF7CB, 
-0x85ADD4B0FB003B9C, 0x26610FF3EDA2FD, 0xADC131B9B96CB638, 0x5FF7CBCD82F6, 
-0xA872907E10C48950, 0xFD3CD1E53B8BEE4D, 0xB9782EFE81B7D169, 0x106C8B08F55CD6B, 
-0xAC8AFD00A4BF95F2, 0xBAA05D060A5446, 0xC30829C3B40B8F7D, 0x970104C092394F62, 
-0x59EDC1BE4011336D, 0x84A1A72482A2D3A2, 0x5B49C9C509C083DD, 0x207FEFB3893A, 
-0x473A2E91E160E3A7, 0x569E9C68D53A22C0, 0x58699AE6E8AEEA5E, 0x49195CBD673B727D, 
-0x46B994FB372EA416, 0x2D6B25B8D039E01D, 0x675B03BEE62E325B, 0xAA74C1B5DDF48A61, 
-0x562621BEDE69A3E, 0xE0330EC256D773F5, 0x417F4C28FBA46F57, 0x4099C579D87, 
-0xB32E0041134A34F0, 0x3370A43D85D059C1, 0x52EF725DE7A5E9D2, 0x5BE40C0E283F8515, 
-0xE2AA999A0AEE122F, 0x1F08BCB36AD80CB6, 0x1268729561AB734D, 0x9FA6D96317077000, 
-0x9F50AD897B9E0920, 0x849CF72ABCC93B5E, 0x2D2AB79102F8DA25, 0x3BB804BA4E11, 
-0xEBD8AF2ABDF0B2CB, 0x28B9EEC89B69215E, 0x813647CE1D8D931E, 0xD6B11907CD6C37E5, 
-0x7DA2297D2D4B528B, 0x2B9C3CFA6B638921, 0xA21CD5B24A6DDA41, 0xAC5DC5661635DA5B, 
-0x33360CB7820837CB, 0x92F86D1AABDC5CB4, 0x4B1C48B68D2E90AD, 0x297BDE937B92, 
-0x5592B04EA0F4DCD1, 0xCAE00288CC5C79AF, 0xEF28822A7FE1300E, 0x49804F824D14B71A, 
-0x2E477E78C3D6910B, 0xA22BCE94F6551602, 0x60A9820856FBF693, 0x7E42733A6F6618A9, 
-0x29406576E06A6DF9, 0x2CBF4465F9439B6C, 0xE37B541FAB689300, 0x5D616B5F1649, 
-0x82AFD7F2ACEF3318, 0xECA7A6EF2B1F55A6, 0x3E7571E9CDDF810C, 0x27BF287819E444C2, 
-0x3E9B3848807FC0BC, 0xE8CFD9EBD6009415, 0x159667488F81E676, 0x5041FE39046FC7B3, 
-0x82DC2577E5C91F4C, 0x4198FA83F6796F58, 0x2AC5A4F96E5FCE24, 0x3CE66C899C43, 
-0x1C9F6A5718262FF0, 0x75E02A7A0A7E8B33, 0x9BB4233B518F13BE, 0x99CFB686A44F94EC, 
-0x8AA07F104A7AFBFC, 0x1E13D49D1B0DDC7E, 0xEA371165C5328D48, 0xEC5C0CB7FD9A3579, 
-0x21D9030F216BF8AA, 0xBC9BD83626BF8EBB, 0x644C9F03387ED80D, 0x3D5B98F6B919, 
-0xAD873DD76971F844, 0x148EFE7DA6353006, 0x565798EC192823E0, 0x9D669126755B4F09, 
-0x8446536EDF0EAED6, 0x2A9BD249A44097BE, 0xB1C62F93F3A314E1, 0xC893597285E6FDD7, 
-0x24065586B095F5C9, 0x1BD57515721D32E4, 0x59CD981D14024E73, 0x5AC153EB18A2, 
-0xEF4807553309D43E, 0x97442BCFA652CA0B, 0x591E9AFB714626F, 0xF0F3529150D265A, 
-0xE1193266710B8FD8, 0xD68DCC81638F18AF, 0x137D13D195E681A5, 0xF28D9270C9810A7B, 
-0x7EAD684D345A7B02, 0x4001EDD6F14A4924, 0xE2E53FC05F7A9C29, 0x16567231518E, 
-0x4A9E9037F98AF45E, 0xA65FFA9888CE9458, 0x6F4162FA5A1B8306, 0xE150308D8C319661, 
-0x2921D73E3A8C2002, 0xC40A192BD44C7618, 0xCD4F2E2DDAA764F7, 0xCFC68584BBB3F358, 
-0x4DB2A104FD8839E7, 0xC2F226ECBBC1FD40, 0x5243EAD493E93AE0, 0x3B777BBE4D73, 
-0xDD27B65148F58B21, 0x99CE55CFAE7BD55, 0x41C27D52B8DD1B04, 0xD605F6A781D905A7, 
-0xFC8427F430961DC0, 0xF28A560DBCA10016, 0x8BE20C0F0AB9A17, 0x91C6975B9C8E13FE, 
-0xEEEB1BE1CE213D7D, 0x81682DE0B068DE83, 0x74F8772F011ADF8C, 0x3C832A035C75, 
-0x5C46243F2505F67C, 0xBE8E2558543ACDD9, 0x1819A7C1A984144, 0xA7AF17A10D68C153, 
-0xAFD8E0168E603A4A, 0x67EE073C47F3E727, 0xBCAC6F31E6A18C5F, 0xE6A3D1EADDCF785B, 
-0x9384CF80965085F5, 0xF0B5DA198A9022F3, 0x2EDCACA691C05E6E, 0x2CA9FE826708, 
-0xB87C1B0CAD255101, 0xE403B3BD778C2AE8, 0x8202C15FF7121651, 0x9DFEFAE27853AEE7, 
-0x808E1B258BC1BB28, 0x4574F026DA7C21CD, 0x637491F38E090941, 0x71519947250FA1D, 
-0xE7ABC8AB4229EB1E, 0x861D099B45513766, 0xE6C7852EA7745969, 0x2C67D7E28815, 
-0xE594A044472E24D6, 0x8EA82E65887346C2, 0x6580EE2CD94C2759, 0xD51ACA3DD30329D2, 
-0xCC2F8A6377BBA702, 0xA135FC550A145E20, 0xD9FCFB2FD152D5DC, 0xBAFD5EC5D2E68C48, 
-0x8294929F99552F90, 0xF62D08DD945A7C0F, 0x8DB4C7CDCD164F35, 0x271550F58E9B, 
-0x72DE58B51ED072AC, 0x916444EDA54D70D8, 0x337CABB249A2D78, 0x3EF5C8E3A95898AD, 
-0xBB86C8FFBB410F1B, 0xE35066B5FD75AF82, 0xEDE93498E0AEA548, 0x649AD826C683EDAF, 
-0x8B863FBB760DD697, 0x9E9BF2112C93F1, 0xC1F9A5D9A3C6A744, 0x49072A18B861, 
-0x21D4645EC2479699, 0x98E50C29BA3BFF08, 0xFEDCFD89C45CB3D0, 0x72622C801771915C, 
-0x12F906626AC5F963, 0xCB0523C3EA33B6AF, 0x88861D2DC63B38BC, 0xBD8C32B332CEE45E, 
-0xC778D05DC9BE3502, 0x17507D845ED2A340, 0xDE16DC52FBB15FC4, 0x41155D6C7FE0, 
-0xC48514EDC6A1DB39, 0x75FDA2BC43BA3AF1, 0xB69DFCD14002FB88, 0xBF06B1DE5B9B5BA4, 
-0xFEA60A69D7EFC099, 0xAF900413A8196390, 0xBCE92944AB61FD9B, 0x2A7AE6FAA73A0401, 
-0x3C55C81A8E9B3DDB, 0x36B6DB77F7FC0B53, 0x38BA8EDC06925BB2, 0x8FF1A28B409, 
-0xE7B6EAD96D22C10D, 0xC023ED73C9F17531, 0x882CDAF7006E2CF2, 0xAAC7917E8C0BEFCC, 
-0x1B58887427AEC615, 0x2C5688CC702ABF38, 0x558FF8322E7C4FC3, 0xC1B78E732B8CFCA8, 
-0xB980C6939B6A645A, 0x291F2D3214D6B5E6, 0xF3433BCE1682F401, 0x5167C5D46E82, 
-0x538D960CF5692731, 0x7D429FFA46F16921, 0x4B6BDEFE408ABF4F, 0x8A40B431585CBB16, 
-0x5D5E212DA0D27521, 0x9E20450523E93FF0, 0xFD2853410F769E14, 0x3465805DD153DF6A, 
-0x86B63EC6DF75B976, 0x9CD9D6BC2B705E6E, 0xDA9AF6207873B0B2, 0x2CDDF260F89, 
-0xA6D91EED026C59AD, 0xC991BBC99292FF6, 0x30602CA7CFA46BFD, 0xBD1D5D8D8DEAB6D4, 
-0x37FFF673774F5043, 0x5530C32732D10C72, 0x2BA4CC06F348C855, 0x4E37F63D39A347ED, 
-0x35CE6FE190234E18, 0x5F67EE7929273252, 0x43901A1F9205540D, 0xFCC4249E0F2, 
-0xAD8C2816A5543E4A, 0xF866DFF2B44C08AF, 0x6CBCED1351585705, 0x9FF95050A6F9767F, 
-0x482A222772C3614E, 0x9A0B41583E16DBBF, 0x41ABC0FB4F7F7656, 0xF037BCD40D1DE9FE, 
-0x8C7D24E106EC5482, 0x6EA87BF9D6CBEA03, 0xC0686582F37F606B, 0x3C77AD8A76CB, 
-0xFD243F6D77815D12, 0xBAC5D551A15B3BBE, 0x33D1313AD315B317, 0xF2AB507E47305EA3, 
-0xE75F065D5A6EDC6, 0x243554E664E66330, 0x85D19215A81972B3, 0xF5D41CAE76255AD1, 
-0xD5DB6C54CCC93376, 0x4D0EBF032182CDE0, 0x870E0A5857B790E8, 0x296654761D15, 
-0xAC803BCC634B0BF3, 0x900831CCCBD9988D, 0x33FF3001884BDCE2, 0xA8B96C556F2CABCE, 
-0x80C4CA0A3A8AF393, 0x3D921F229120EB0A, 0x52C1A3C49A8957A1, 0x7F3B5DFF658BACE7, 
-0x451BC28C6E0C867C, 0x3DBA60A7FD58A5A1, 0xE756D3273E07FD02, 0x69F9567C54D7, 
-0xD495D8FC5839BF37, 0x9A785D9FC13B8EAE, 0x1DA50AC60F0D1254, 0xB1CB49C1D73A6A51, 
-0x4F2B7809A6C4A1E5, 0x659D48652B33FADC, 0x80CD6D2820478944, 0xFD926CBFE82B90FF, 
-0x95A1D0A77CD72C5E, 0xC7D3667659B83E41, 0xD343852972887C37, 0x6C5B9322CA29, 
-0x3C06B9FD1EB59EB0, 0x8C564E07BFA9DDD0, 0xBEB9EFA42F10B0DC, 0x1AEA14E3E2E72309, 
-0x72523D009332E87D, 0x42951E0B2F9BDDFC, 0x112BF989D65F8A51, 0x2421443DF7B4D8AB, 
-0x9EBCA97A8F2A9791, 0xA3DEBD29B9329962, 0x7046B0DF5D35650C, 0x6EB5DAA5B102, 
-0xF6C5C005BEA71D9D, 0xDE5D1178508F89CA, 0x28287223D20DEBD4, 0x7FD4A49738B33552, 
-0x5E736A0F4C79F74F, 0x9D13FDBDF827B939, 0x1A58CB00918525EF, 0xB91963EE3EC1E364, 
-0x3A85101A1E624E3A, 0x97268A9459FF7105, 0x3450C9EB02B50ECE, 0x4EC30888784D, 
-0x4D592F8247769FA7, 0xD17CBA765F287921, 0x9446269E8D71CAD2, 0x2E4677954CF006C7, 
-0x7C4FB4BA5FEC0F87, 0xBC35924F67C4959E, 0x933BB6614A569C91, 0x27D696D000EE646F, 
-0x28E458D5821312CB, 0x6EB36AF7A660C39F, 0xB2278225246637DF, 0x3E1CBB0D6DA4, 
-0xC879BFB23DE4EFE, 0xCB595BE837459E02, 0x7A4BE19C0640FBB5, 0xA31B2D25D1887EC4, 
-0xBF43B4F8E2C560FA, 0x3410900F232FAEB1, 0x5424E0472FC29A9D, 0xD8086249385C355B, 
-0x7BE33589DC03FD95, 0x7A2E2BC6453DF00F, 0x20A139DFBD02D0D9, 0x3FFBF7D81C34, 
-0x3671CF959D17BDD2, 0x617495F4A2827043, 0xAE6FBE6125C74794, 0x18285ABDC0AC2FE7, 
-0x90F8E6CAC9196102, 0x4AA0F8EB6B643842, 0x41B40701F42189D6, 0x40C469044E0A6A32, 
-0x7867859157B3C889, 0x641694A79C2AED15, 0xB1EC1A94DD1559B, 0x5383AF7F3A84, 
-0xC8D14F7DE9415F67, 0xC4A1F316F3D2CFCB, 0x839C06181F43748B, 0x49B7B5997E0EAE31, 
-0x542F103F7220FFE5, 0x30288AEA1E3BB12C, 0x9D600C7DC228CD58, 0x626C146D30C32715, 
-0xBE92D57BCFEEB7CC, 0xD67CEF2432C59411, 0xED1998F0C906BBD9, 0x38B52C02F086, 
-0x87C903A66963CE20, 0xC2A87DD243FC033B, 0x52AC0C317BB34595, 0x75C0FD2B9B02B533, 
-0x8D4264F2C28DD80C, 0x14980EFDFA973051, 0xB0F522402E01CC80, 0x733211B7A1C8CD56, 
-0xFDF83A9C38AFD944, 0xA22ACB4AEABE37C5, 0x347CFE3DDC849B1C, 0x9D6299327E7, 
-0xFE0EAEE30D1AC6C3, 0x8DA0C89E619C0B24, 0x955933012F1D54AF, 0x1CF562B46275815A, 
-0xAB998BA36B829A66, 0x81A93C1F2263A5FB, 0x888320AA5244EA57, 0x5616B1B352CD8D74, 
-0x6F4B9D7CE3286A42, 0x5AA8A439C008D381, 0x92E92F9035C2A33A, 0x5E63ADA7A3, 
-0xBB02362E62A4EBB, 0xCEA27DC681271FDA, 0xB5D778DE27497277, 0xA0122BA7A1D2226, 
-0xB56F84EACA6C3CC9, 0xC4D7EE543A4DDB09, 0x66968323B3AD791, 0xE2ACECAB4626FFE1, 
-0x962AE4D6DDDC18D8, 0x54E1999E854791B5, 0x630BAB553B46BF2A, 0x271EE333D10, 
-0x7BB7A4A07B0788DC, 0xDC36A3F6607B21B0, 0x4750E18EE74CF2F0, 0x464E319D0B7AB806, 
-0xC25AA44C04F758FF, 0x392E8521A46E0A68, 0xFC4E76B63EFF37DF, 0x1F3566D892E67DD8, 
-0xF8D2EB0F73295E65, 0x457B13EBC470BCCB, 0xFDA1CC9EFEF5BE33, 0x5DBF3D92CC02, 
-0xE7E952E9A260914, 0x92C98EDCD6E01424, 0x8F2B207221D33C50, 0xAEF2728CA22F318E, 
-0x5FD0E29877DC3D43, 0x1BDC7B7367E4E124, 0xFF5BC4186BDDCAE7, 0xD20A34710EE8B44B, 
-0x2E0866A5B9467EBD, 0x876EFC05B732A6AD, 0x9D39159E24822ABB, 0x658F31DC0D6E, 
-0x73E75CE4A532CE4E, 0x8A9CFA6FD7C7D8D7, 0x5C32241579AB4D31, 0xC3B150BD8F701620, 
-0x3490B85EA3AECEC0, 0x95A369A8DFFA3A5D, 0x4FD3E2058B184D09, 0xEA9B75C9C036EB14, 
-0x4E0764498F8C479C, 0xB292905A05D75662, 0x31CAFF3E38483EA8, 0x5D55ADDEE14F, 
-0x7BB7A4A07B0788DC, 0xDC36A3F6607B21B0, 0x4750E18EE74CF2F0, 0x464E319D0B7AB806, 
-0xC25AA44C04F758FF, 0x392E8521A46E0A68, 0xFC4E76B63EFF37DF, 0x1F3566D892E67DD8, 
-0xF8D2EB0F73295E65, 0x457B13EBC470BCCB, 0xFDA1CC9EFEF5BE33, 0x5DBF3D92CC02
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
-0xD25C46609D011910, 0x135AF5A98C28ADCB, 0x1FBBAA32F245FF2F, 0xAFD791F380D906A5, 
-0xA7A53C388793D95A, 0xFBD17414C81EC903, 0xEB07E1336AF105F8, 0xAC3EA4E2E4FE53F6, 
-0xB6256871166682DF, 0x53E7689F74C06845, 0x23F839F6531DDBCC, 0x6BC870E1A52, 
-0xBD5F83502C76EB7, 0x4EC78E2DD52CAB67, 0xF9BDA9CCE6539EBA, 0xB97FD14D7E4109C1, 
-0xF486C305000BC492, 0x138E2273FD8FA40B, 0x22A1D7254ABCCD27, 0x9040445BBBAC4D22, 
-0xC5F6A6E6E30F03DC, 0xDCD17AA07985BD11, 0x4DA3C9A422AC99FC, 0x3BB8A508D510, 
-0xD40A45531EB0EDC2, 0xC2299904BAE9675D, 0x1FC9934035AE1105, 0xA657E853BA42593, 
-0x9AEA7A9998765F91, 0xC971E696D54D7F4D, 0xF0BBEFBC42CA0BFC, 0xA1B703139AFBBA4, 
-0x1449BEEDD33383E2, 0xD56E2ADA01E1CE44, 0x123F51487ABD92C1, 0x2AEC11AF4E3, 
-0xA705DECD67BB154E, 0x3671355CABABE5F6, 0x92D2CA2173DF3764, 0x9287F2C3C3ACC70D, 
-0x22553D769BF6FA4C, 0x1A02C98F8E9FF24C, 0xA1F4FF3CB5A2879A, 0x786B1F479BB26317, 
-0x6C788B0D7262433E, 0x5C08F513D0B359E6, 0xDF77EE49CF2DDDB, 0x2BE7A0285CE3
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
-
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0x5CBA3D258C4DB901, 0xC93BEDE745B295DE, 0xBACDF727F64CA987, 0x83ECDF3588EB0EEF, 
-0xCD2BAC5AB77E0E4, 0x1D56430F8D7803B2, 0xEA6FD88513503E97, 0x92589961E52EBA47, 
-0x915B0E001AEFB2F2, 0x85FE3AD27CF8A2C7, 0xA2A5879C170ABF08, 0x6756AABEF4A2, 
-0x6958EE2BDB497F9B, 0xDB206E7ACB9FCE8, 0x67969F38A0162224, 0x22C73FE0E1C96671, 
-0x2A145539A0E9EDFC, 0xDDDE81220226093F, 0x5AEF2EF0589015C, 0xB2D79977770478D4, 
-0x92E804AE163BC6A2, 0x607A5C228D62FBAA, 0x9EA104FCAA562E01, 0xAC521235AF0, 
-0x1DFA0D28D1939568, 0xBF57BE62BC3BDA6, 0xA044A0DB9CB3D35A, 0x1A05ADF0635ED21B, 
-0xD194D18A476E296, 0x1FC7E5835179FF39, 0xE69F2A9DE5CE4A0, 0x1361BEA4591991EF, 
-0x8CE96F83FC3CEC3, 0x22381B2E2D28978D, 0xD709B6C6CD68C642, 0x6518ECE8D749, 
-0x8E8E1E64DDFDF364, 0x7A7D339CB2539473, 0x601E8F3CE5CA7C4E, 0xD94528B30DC5C326, 
-0x8A428DB8B5F6A148, 0xAE14E31B05C912CF, 0xEA3E94DE2C6163FA, 0xAACB9CCC709F9492, 
-0x2F6F88D6C13D722B, 0x1F0517DCCFB44B27, 0xE000AA61246E6DBD, 0x3D98D655AEBC, 
-0x511E94EB02FEFED3, 0xE7D839A4F7ABD9EC, 0xE505B5461C5D8D99, 0x83540DFA28217FFC, 
-0xE647DC67A73BED9B, 0xCC433B88615C8DF1, 0xB0F928600AD8DAD9, 0x7062211A58F6C440, 
-0x6D55864BD21E37BB, 0x97F47967D7A0A780, 0xF83294597DDAF9F0, 0x60C4D23B7EAD, 
-0x80059A4DD85AA23B, 0x7C5B5A29CC77FA47, 0xDAA8AF0AF6697D0B, 0xFFF54D8372626502, 
-0xC745F543DC3C19AC, 0xF76B389DF4A1DB76, 0xA8CE3A39463C476, 0x28A8939ECA08C223, 
-0xF51F040970CBEA9C, 0xFE97C69A195B7F09, 0x1E1D163A38DBEA2E, 0x56DD83D2C142, 
-0x21BC23E97B1C7B97, 0xA0997FD85A8F9B45, 0x6A727E0402B0DDC4, 0xE874CC2199F9882E, 
-0xC78E3C135436E8A5, 0xAA7D317588E787E6, 0x9A42E70C91B21B1C, 0xE9FC183C27F7E021, 
-0x31D3AF2F13D804D9, 0x8C05C0395551A380, 0x74B3B5BBB15EF970, 0x4779B71B0005, 
-0x157F0DA1088D3B9E, 0x9DB2C0ADF97DC9F5, 0x6A98D257AFB571EF, 0x32E96D0346445618, 
-0x6CB8469D7B62E2EF, 0xCC0491868B121142, 0x67F88CB845DC74AB, 0xB8778DE9D7C7432A, 
-0x148171F3A97AD64E, 0x917718DCBB09E79E, 0x96E83D4A274E6FB0, 0x20182B229ADE, 
-0x5FA5C292FC75CCB9, 0x37DA3EE82B12DEA0, 0xF6C8A8FE3DCE6BA1, 0xCBD544A976C5741F, 
-0x14EBC6847C58126, 0xBCBCAD6E1B25AEDF, 0x80CB31C6F315851C, 0x4D92B6C1C9E51A19, 
-0x7341B0B9927CFD37, 0xF858A9A191EEA266, 0xA8A6A4F2ADEE9940, 0x59D251005B93, 
-0x97F8276F285F23D0, 0x74BFEBA2BFF06B30, 0xECB37C5724D93B7, 0xB428830038FA655F, 
-0x621BDC14CF2EBCA7, 0x2AC5988F5C03570B, 0xEC63CE172DE253DC, 0xAB853C36B89FB08B, 
-0x6AE0B9362B60555D, 0x821B834612261F22, 0xFFD9892A3BB0D1DE, 0x20FF757CDD24, 
-0xB3CC96053606DB8E, 0xBB6F66FD1811D1B9, 0x3DDCFF4CBA448531, 0x15F921BEF2FE0EE0, 
-0xEBE20A463D1B918C, 0x81898EFFD5E2CBA7, 0x6365264C10FE4400, 0xCFF74664FA761D97, 
-0xB601B512F2DC0DA4, 0x965C72D8A1EBF74E, 0xB4A225CD1421351A, 0x4D0C08F4CFB2, 
-0x3D6820D24ADF83AB, 0x7E22241B437094E4, 0x2835524C8809AD2F, 0x5CB80B3D13478B06, 
-0x5E9C772CEB8FDB75, 0xFBBE0407E9C7BCF, 0x9FB164E6E97798CF, 0xEF2BDA583BDD09EA, 
-0x945822D3F7FA6B6B, 0x22C72B0E217BACD2, 0xB19C22156612DDBF, 0x4646BA37E3D9, 
-0x1528926005935DF8, 0x47177C66840F357E, 0x360EF7FC3B79C99B, 0x558F3B2C453BE8C3, 
-0x7893E58AA524D581, 0x40759484EC40CBE5, 0x8C077635B826CE30, 0x8CD6B8338E439E3E, 
-0xE54AFE880266770D, 0xF14FBE1CAF5E102B, 0x2E633C12D04E905C, 0x5C31AE074815, 
-0x18E7E91AF372066C, 0x2FC235FF6A7B0D9F, 0xA588D6FC403871FC, 0x44F9248FA75082A9, 
-0xD6012014658D0AEA, 0x559D683C9C5369C8, 0x62761914883D677C, 0x89DA613889806CC2, 
-0x203455F3EB39BD1C, 0x7523EA22C34CCA50, 0x100211A596651283, 0x227DA670A0EE, 
-0xAA211663BF26A0DA, 0xD68340FA36F1782F, 0x1F8096ABFA533427, 0xE422F82A58B813EF, 
-0x7349F71DEC318042, 0xB88A9B54193F5162, 0x652EF038E4A7753F, 0x25899E70AEAD37A4, 
-0x1AFFA684C58BBD42, 0x96C251CBF0FF147D, 0xCE368E97691D3B2F, 0x68575308EA86, 
-0x2E889154842FBBD7, 0xC3D444D331CC5830, 0x7A11F55998B74F6B, 0x923AB01B0A568215, 
-0x465F390DC2EAB449, 0x1B16D976D7C3F527, 0xF8635AC7BA92EA77, 0x76C2994383401758, 
-0x48E84B960E5C431E, 0x915627D09C705E21, 0x7DA30EDCF64C0526, 0x4ACF5D342AF2, 
-0xE2CE2864B31F854, 0xB334DFB6EFDEA11A, 0x8E8D235C6F622A0B, 0x696C058ADBE58A51, 
-0xDFF7A7F1C8042792, 0xDE0158CBC432F386, 0x694E5764877BF8AE, 0xB8C0AF407FAD626F, 
-0xE0174B31F9DBDC2F, 0x37604D38476031C6, 0x13638B9011F63BA8, 0x2789E3D82D8A, 
-0xE847C382CAE8E73A, 0x3F71405F0C894063, 0xD48AA86DD161AB69, 0xD866A387D95E2402, 
-0x5F65D9E290549A0E, 0xDFEEAD352A939C9B, 0x2FEB2E81E748FADC, 0x27E10E8AB865B35B, 
-0xD72F7F009385ED20, 0xD203BF970FD947FF, 0x6047B015BAD7BC20, 0x4F739EA1278A, 
-0xFDD2EE96DE27FBD9, 0xB55C39FAC37DD274, 0xD6C6AFA29ACCB9BD, 0x207B9B4CD82C8300, 
-0xF6A8C029CFFD5BE3, 0x3926C29655BD2E5E, 0x9FB1884F9FCE6721, 0xA504F780822946AC, 
-0x4DF965791CA48528, 0x64F66606FAEB46AA, 0x72B0E9549D782D46, 0x4E241838E0D4, 
-0xE5AFFD63A5A01D7A, 0xDFACB8D01FAE4C86, 0x86F5FC9C11AF1E34, 0x83DFF2415FFA6638, 
-0x3D30E56FBDF2409, 0xAAF6B44C8ADA2FA2, 0x1D2D9917EA040D74, 0x3EDA7ECC9152F949, 
-0x1594F595C725C60, 0x32F77925526F70BF, 0xA6D31E12DF98F937, 0xFD6568BB39E, 
-0xE7E10782E0939000, 0x51CC1CEC8B970616, 0x5E4DAFFE99AAABAD, 0x28B8274220EB051, 
-0x4EC720E0B1157EF6, 0x2EC0FA75F0E9B7E0, 0x15F2AC3FBDC86011, 0xFA0473CF7E13401C, 
-0x4FA72110D8E7C0B, 0x95E24A3613327DF0, 0xE5E621B5A6A3C58F, 0x2DF1B098DBDC, 
-0xA3895071D8A40F47, 0x223A862093A028B0, 0x6706AF2B0277DBEA, 0x2785CFE85513F89B, 
-0x2F2A1DF3FEA5A0E9, 0xED7019D13CA2FEB7, 0x9AAED87445D0EE0F, 0x1C08981A646AB5D1, 
-0xE5BF74DFCE52CB8A, 0x6DC18BA62068335C, 0x5C6C2774F382BD6B, 0x60C113164B4F, 
-0xE8A3BDCFC1B1211B, 0x1EF2D18FE3EF92C2, 0xF4B209A1B55B997C, 0xE61F94D43AA5B5A1, 
-0xF5792FA187BEA099, 0xBE5779F1878B6D86, 0xB9B53B36F23F8519, 0x536239ADD745A207, 
-0x46BFFD688C7785FD, 0x10DDC2DE07F59822, 0xA933C8145C093A47, 0x3BBA4D8DA213, 
-0x7D9AE9767A12C6D1, 0xD0C72701AFDFD84C, 0x82FD4C3AC7A57466, 0xD5E90F19BFBB48B0, 
-0x5C9D0A35AE541D9A, 0x38860009532762E5, 0x7809641F3A07C1BF, 0x189D2BD8D3AAA854, 
-0x306E41668A35AD75, 0x61FFC0F572231E49, 0x4E4055AAD90A1B6A, 0x3432BCE941BC, 
-0x4CF2FAFE5435C1E1, 0xA1C6B2319150C0FC, 0x1B156DA8A019B27D, 0x9CF84674521A0605, 
-0xF1AB517F13BCA3BB, 0x10F1D76570F449A, 0xCA9CDBEF134CC872, 0x4B1D481D7F9E4BAA, 
-0xE6CCD3380ECA732F, 0xFA5D0CF663BBB182, 0x51A4556EB5356C77, 0x1BBEFB926A0F, 
-0x2D60A1FF932D563, 0xE30A677AF09DA717, 0xCE46A75A0C997B55, 0xE32E77BDC80520C4, 
-0x33D446BA879DA878, 0xD1EBEFD3868D23DA, 0x2C5325C8B57E4A74, 0x762651C02C4804B9, 
-0xD107802DA5F9C096, 0xD7D7D855202ABF06, 0xE0DB99C066F47426, 0x65CDEBD7B009, 
-0x832AC3AD8DC6CD68, 0xBA29CBBD0464CA09, 0x468A993209994C0D, 0xD4F5E0C12A47B9E7, 
-0xD94F9FFC9B7D72A9, 0x2E4E3370D80CE2E8, 0xB78E9F94771787D3, 0xCE1D7D416A8B02E7, 
-0xCE1E8E808501E697, 0x7F6976CF60C41BF1, 0xA6D13EE55001B1DD, 0xFF3D189024E, 
-0x2A038EFB6524390, 0xA91B92F129350589, 0x6D9652A0FD20EE32, 0x2FDD5B9CB673F28, 
-0xBED536807A7BB51C, 0x7F3CA6737577A4AD, 0xF9A4834D559973B6, 0xEE1E54D8DE63CD6C, 
-0x228AB67D384A117E, 0x303E38F3678579CA, 0xA35FC4539C009EA4, 0x4DC489310E29, 
-0xF54B16115A969658, 0xB5EED2582C55B776, 0x292E95F3FE25D951, 0xF3EE707A7DE0FD70, 
-0xA4C7C57F13D6F285, 0x2F35D8E73C42A63, 0xD7ED3A9C4B6F6A0, 0x4391CE88B005976D, 
-0x5470E01FE61AD8C7, 0x3F6B312FDBC6A2BD, 0xB614ECB48784A9FC, 0x219F0C24C58, 
-0x80F7A8BC66EA5ED, 0x99A4996F19CF23F, 0x634E892A0FBCA564, 0x70E0F734BB9DC55A, 
-0xE540BDC568041922, 0x52CA58080DF9FE46, 0x6A4FDC548C380C67, 0xA0B7F54A08612419, 
-0x42CA4E5B04627BA4, 0x95E82F45A4B3A07C, 0xCB69A1B827441646, 0x62E9A37AE93, 
-0x8BF3F8CE2159D735, 0x2A2F10F5FE0764E4, 0x74E33C9EAE8164BC, 0xE9964C5C578CF675, 
-0x739648B3BF9A5516, 0x2EB28FE4C5A8A9B7, 0xC544882008B0954D, 0x2B645703CFB3F4A4, 
-0x8B7D7CC7A96BED8F, 0xA836D7F8519FF12B, 0xDCD83DF734BB00E5, 0x3522B042BFB2, 
-0x1AEB3929627FB774, 0x2C943ADA0996AFB, 0x60AFF98AE7CD526C, 0x6226BF64CA64F717, 
-0x8AA151F57582F546, 0x6A26D73BE76E48F0, 0x411F85A23C13051C, 0x9938464F96262C80, 
-0xB203B869951070D, 0xBB7E94B8B4CDB5BF, 0x21AA8C2CF15C4BC5, 0x166C41FD4896, 
-0xBE6119B114DF7800, 0xB89918A851AF141D, 0x2908FC0ECF1C68DD, 0x44D0649947CBEB2C, 
-0xF6A8D53D74C7E8E, 0x583CD18B906AF16E, 0x4739A05CD0877213, 0x3BEFC67DF16EEA55, 
-0x14B47F2E28079D5A, 0xE86CAFC132EAEE1D, 0x7AD2DCC5893DBCF, 0xEB054F6E35F, 
-0x14C4D81E47993159, 0x6EF5A4D78FCF6718, 0xCE27020FF4FD513E, 0x60440CB6A5120988, 
-0x4E7728C4DA1603D6, 0x88EE6B817800F286, 0x45903C2945EC4C86, 0xA8EA0F5F9321F4E9, 
-0x4C0043CA8F016E17, 0xA28F83135B194482, 0xEE8C871CB3364291, 0x2B180ECB1584, 
-0x2053F02CEA651A06, 0xC7BECF674E947C66, 0xFFD638A35D757DA7, 0xE6271C319C1371AE, 
-0x38FDFE0A8C6E921D, 0x65DAE7059782ED5B, 0x85E86618764F68B7, 0xF4C4D2294CCC2D3E, 
-0x5104B360F302C231, 0x557CDC90E7A17C75, 0xBBDC3B0AFD71F151, 0x2B9652E409A, 
-0xDD429BA06F75A5B7, 0x722BC7DA609AEC4B, 0x27AE1B6692CB08DE, 0x460B1EBF4FF76939, 
-0xFA570BFFF9A27895, 0xAD12503F7568D9A6, 0x46969ABF8AC3A78D, 0x1FED6E47BB4E3A1B, 
-0x403E32854BA1FA7B, 0xD4A6A0AB0B0A181A, 0x7806AA7123F43CA, 0x597F5D7BC9B8, 
-0x4C554FD58C1C2C7F, 0x8DF98378847C13DE, 0x3A8B3D223CC796B0, 0x2DEF2DEF83AD72A9, 
-0x83C7AC1C78DC243B, 0x6904B9772743A207, 0xE2F7AC6DD8063326, 0x7AA6BEB0E91BFF00, 
-0xFFF091EA0436F977, 0x781DF8B85120E82E, 0xFC718537BDC20CF1, 0x3C8EB54237EB, 
-0xDBD71C3E67BBABE0, 0xBB5903AF46B32F4, 0x9BE06881516F89EF, 0x5C8255DB2E0365AC, 
-0x14DE328DEE5F97C6, 0xF09603305C2A6783, 0xE79DE224A3F146EF, 0xF9B59C03D602807, 
-0x5D1416D1F9903DE9, 0xADF43164B0DD9154, 0x37EDAB1B2E891C44, 0x575E8EFB048C, 
-0xEE96379456F70059, 0xCEAD852D514DE605, 0x23873D325FFBF560, 0xA27269AA9A632F2, 
-0x7964617F2D20553, 0xA650EEADAA36DBA8, 0xB618643A1F9C3C30, 0xA28135B0D959AFFD, 
-0x2EDC009B285C04D7, 0xB12FC164914EAA11, 0xA5D24149D8EF2B0F, 0x1996AB074829, 
-0x3161C08619A1577A, 0x1A3A2A0C20EE5558, 0xE5F8D470F7D49297, 0xD7264D5F0759B673, 
-0x4464C94A8669F7EB, 0xFAE0B47BD57D82E3, 0x535D3BF088FEA065, 0xAEFF59A13D661C7B, 
-0x2F8895EEBEDA87EE, 0x910DEA5541A5B152, 0x529599AF81FCDD2A, 0x32211BBE628, 
-0xAF6D30F4DB5094A4, 0x8626E137EE6C882D, 0xA37EC05261134713, 0x3505DA260DC131F7, 
-0xB18797933B4A9CDB, 0xC7C873283272C79C, 0x4201F1C0C59385F8, 0xA4C506851428A303, 
-0x33C895DAA0D15199, 0x4A019275D4D25407, 0x6490AA86B10F90D5, 0x6A9FD7784C2D, 
-0x4B970829EBDBF90F, 0x356CE91A9AFF2AC3, 0x7BD3E7A2DBCDE8F9, 0x6B44EDCFCF3496D, 
-0xFEEB0153AFDEB9E4, 0x6D815EA3C6946A25, 0xF0764CDFD8F4D7A8, 0x14F0276BC00E0FC6, 
-0x7F1E5B532E052D9E, 0x5F82B5FA519CB6CA, 0x1DCAA5778BD700DB, 0x20E74562B070, 
-0x805D085F8DD17589, 0x41521E7BF0402693, 0x7DE22A7BB742F164, 0xE014CDDAAF1485EC, 
-0x1D5BDF63FA3A05D5, 0xEFFEEA8F264627C9, 0x71C8039F63853F9D, 0x54687EF1E181CFA9, 
-0x43F7CA34A9410C35, 0x2D90FCEDA7CB008, 0x3DB8011F867BF9D5, 0xC8E5970F973, 
-0xA43DFE268EC39C2F, 0xBC4C68C5D71C0ABA, 0x57996CC12FAF4885, 0xE663E934FE8C5D74, 
-0x826C19AD8F9A782A, 0x96E4CD46F53A0054, 0xFD6E4E666C461A75, 0x6E2648018C565DE9, 
-0x70316109001B72B1, 0xCC49465368017E96, 0x3B784DA737CA5F4D, 0xCC43E195D53, 
-0xF09C5063CB39F5C5, 0xC56B2A961D80A1AC, 0x84296F771D943F6A, 0xC5BB2F48A3A08CD3, 
-0x99234C5EBC9D4FD3, 0x353D329C0042046, 0x96B41E761083CF88, 0xCB2266C6FB2ED33F, 
-0x3542606F50DB97E8, 0x1DB5C70BBEEA857A, 0xC434E0DD85B12378, 0x2041ADCAEC0E, 
-0x77A20CA7CDACE952, 0x2689BF152AA3C9CF, 0x511A725F558D7AEB, 0xAA1B91A6B9B73675, 
-0xA672FAAB26196AD0, 0x3B87B140A328FE0C, 0x7D7DAD8FC421D633, 0x9FDBB11245C8393D, 
-0xD892C5C25F6FE345, 0x86F87F2614EDCED9, 0x866B2797E9FF9771, 0x200E97CC845C, 
-0xEC0905D774D7E474, 0x3A90720A3213BB58, 0x296DA9172578E6C1, 0xC91EFFEBBD4EBC19, 
-0x3778C00343A0669C, 0x6183393EC9449AD4, 0x6C3D452533F8BB68, 0x4B91DC4F1D058E2A, 
-0x574455763C564D5, 0xBE6B90727F6E755E, 0x7EC6F46186477449, 0x50BCFDDE53E3, 
-0x1C2C983901A79B74, 0x2B34B840C773726A, 0xE7520C1AE22CCEFF, 0x6B401F073D32552C, 
-0x1668C28E7D4F8F97, 0x2BA08BEE9ABC3263, 0x27305B33B4B82D11, 0xE5770A0A38D358F0, 
-0xBE4D3BFF20B71861, 0xC920FEA9840717B, 0xB501BFBFBEB5EDCA, 0x41593359C7E, 
-0xEB6EDA47BB73A070, 0xAB0F7288C418E4A9, 0x3180BEE4C7A6F652, 0xB739C5404824085D, 
-0xE0513F9150785AE8, 0x1D6B2758706A2324, 0x5D635E0525A0EE67, 0x1C534B78268B0543, 
-0x37DB26138EE41C26, 0xA16C15634DC4A3DC, 0xE93D220650F558BF, 0xC2E409ABABB, 
-0xBD8C2027C5898F26, 0x7D5ABEAED7F2680, 0xE2A1B6DD8E1525E4, 0x3ADF479944814082, 
-0xAB0566BDF2E4A7E3, 0x63D46185174CD3B3, 0xB76C168B50B78B5A, 0x60DCAE98041519D0, 
-0xB8480BDDD34EB0FC, 0x98C9CB5832CD4556, 0xC25263539DB04611, 0x368256534C61, 
-0x930F75A9B94BBD10, 0x934BC5A8224BF39, 0x61585E6B71C8EAEC, 0x59092053415BB4BA, 
-0x2BCA857630ADC08C, 0xA5947C6A450743E5, 0x101E776B3AAAF9CA, 0x3A2FFC94B9AE6486, 
-0x7598C6A595B6CD6E, 0xC72BE1871860C56C, 0xF9AA3523874BD27, 0x406F93FC5D68, 
-0x886F6375DCAC6E78, 0xF54C331C88E5F44A, 0xA33708BBD2CA43C2, 0x3F5ACF6CB0E5D2A, 
-0x125036CCD6D4F331, 0x73953DE205142686, 0x56AB904F4EE880CB, 0xC8B76BF57BC8633D, 
-0x3159FAAF78EA527E, 0x14845744A9EDB397, 0x94DEA8325BA4365, 0x283344BF9B4A, 
-0xE9328ED251D588E2, 0x825D5677FFA9F3EA, 0xD55A3D5C98778D7D, 0xC6EA99B96EB39568, 
-0x96893CE8E4A6F92A, 0xDE84208F79C2FEC, 0x80B2E92814A5939A, 0xD39C0186726127F, 
-0xB2AEFFA4982B6EA8, 0x29EAB1BE2D80B363, 0x6C1412374B391DC9, 0x286E7839A4CD, 
-0xADCCE2017D720796, 0x3CF37BE76221E2E9, 0x80F87D4A9BEF4067, 0x5A058367E7BD91ED, 
-0x936D61CAC2E5B2D4, 0x3A9DCEC29A5FFDD7, 0xA9F32A8BA3722180, 0x95C4E1EC3A198B9B, 
-0xF105B9E9DFF17FED, 0x4780EACD543A689D, 0xAD078F5E20A4771, 0x45A1A209B09B, 
-0xEA465AC848046C57, 0xE82D863B6685C930, 0x66819E1722817E1D, 0x5996538AC3585182, 
-0x947EABBD92383007, 0x4AC6AABACC88ED9A, 0xDD1AFE66E409E04C, 0x8AE5F008BD7D6E40, 
-0x7B3B2190807DBB5F, 0xF040F5FC8E7898, 0x67F1ADA5EEFB3A87, 0x630F0B0E4C0F, 
-0x7CE6455E97471D8B, 0xDCA36E5BC85F9198, 0x63ECF6C582A23173, 0xF313939E9C5464FC, 
-0x32CF090C3A1F7347, 0x658A2CAEEC8F4786, 0xE3BF1B69704A0A7E, 0x95F02DE4C987E2C2, 
-0xE935751B838B885C, 0xBDDCCD5D0F2804C4, 0x1AA2D7FA15DFC1D7, 0x5458C3949345, 
-0x7668017E4D6FB4F5, 0xD9B331B6C48B7C09, 0x5442351AC2F4C3B2, 0x3E6CDF879BABC260, 
-0xD46B3534A3D1CA0D, 0x5AF2E99AD05094E3, 0xFDC9D95552195146, 0xFBC344D6939EF44F, 
-0x1371A9A0505BCE0A, 0x9EEF6BFD92D3E0C8, 0xD4D54EA496E665A7, 0x6B9490CE1A90, 
-0x4F905260A741BA6F, 0x9AC93C3D4678B1D4, 0xBB8855CC9E6F4347, 0x5CAD8B47DBDA0E90, 
-0x53FC3648398DC1E3, 0xFB0F5C87FC83DAB2, 0x5D021A32E9C389EA, 0x39C903EF7B4962B1, 
-0x79CB848B33634DF5, 0xD19D8F267627D337, 0x587757D0CC0701F0, 0x34FA45148BD8, 
-0x96B3BE6AC25F3AC1, 0x4A2F43CDA7E59B42, 0xF5D492D082AEB6AE, 0x628F0E13ECBFB10, 
-0xE063690550C98C83, 0xC61A82B471EA4449, 0x88AF7315C201705D, 0x6A4D2FF7EE764C99, 
-0x2CD8128A82F57D78, 0x4BA4DC86EFD9D3E9, 0xC9BDF40619CCBA93, 0x365D850572F8, 
-0x8F9920A2DCDE53EF, 0x8CD8E9E67E6A4475, 0x8EF6E3228258199E, 0xBEA42B76C6586902, 
-0x7B9AB9EB0EDA3449, 0x6E0B28F89964DC76, 0xA36242EE24B172EE, 0xF62783DBC7FAC34E, 
-0x23D8E7E7F919F34D, 0x3A4D1221E72E403, 0xB577934837E2B9AA, 0x37EF891C55D3, 
-0xBD7A6A2E3045D4A3, 0xCAB0B437FCE6BB9D, 0x61593202E9BC968E, 0x6989A822D9131DA5, 
-0xF4E77C8D5057126E, 0xE5A10AA1F8179CA6, 0x1A3ABACE5FB89562, 0xB062435BA114B812, 
-0x1AC6A38FAFBBEFB8, 0xA1F63C538ED17030, 0xB3793074CA60CA11, 0x27BDD1CEC86A, 
-0x6C42153B112E18F6, 0x98423880D5908E5A, 0x76B044C6246DDCD4, 0x591D4D0F85DD0EBC, 
-0xFDB45EA8CFE19C36, 0x518F28D7C9C315DF, 0x418EB1A467EF4009, 0xA0B739ECB5AA5346, 
-0xA8FFD5C836707319, 0x123F03F579F67578, 0x2D3A070FBCF2460B, 0x5D8F69CF174E, 
-0x529BEF42410219B8, 0x9C8A6125235AAF33, 0x33A961E3851434, 0xE744168A8F394B30, 
-0x65E7ACEE4E07F3AD, 0x890D5CB5C975C0F3, 0x74AAEE25BEB49A8A, 0x351F366EB7F6B48A, 
-0xACD5A69BF88083BB, 0xE9447E86EC71D3C2, 0xD0CC6314933B3CAC, 0xFAC778B957B, 
-0x53205AE23678B875, 0xF9AE05DC7FDA3718, 0x7640056F0EB91C72, 0x75045CA349B2C91E, 
-0x9E55D1D3654E8CAF, 0xCEC6B7BEF71BDAAF, 0x58415465C1CF5333, 0xCFE3460BA9B1B35, 
-0x8C6614E0B8D9B9A9, 0x5C79A4AD1955E90F, 0xA9D59AD3736FF199, 0x1B9C1E56CAF8, 
-0xA38ADABC93E3C796, 0xA700037F9F828634, 0x205AE675D30950E6, 0xA83AB9EAC4C9641, 
-0x877706DBB805A290, 0xCA36DD24C12CE93A, 0xAA0ACA37C493EFB8, 0x7ED6A2138EC1D093, 
-0x2EA9F2560A227ABF, 0x6AA1D7251B15C966, 0xBDD980B80C9FB1A0, 0x19989EF740F1, 
-0xA33E013FC257961E, 0x963A6DC3FEFE3DEF, 0xA99C862DF4C89EBA, 0x6ED179C5FBD63FC, 
-0x5A42E89DD972CEC0, 0x2A62DD3BF291BCE0, 0xB14F11A3716B466E, 0x56C7DB1F96ED6953, 
-0xF2859B577ECC7B32, 0x6DD5FD275D5CE140, 0xC213B863396F8DA3, 0x4B887983949F, 
-0x4220FBFC21617350, 0x52DEDEA2514052A1, 0x61DB2385A250190B, 0x168CF0BC44160702, 
-0x3421E370CCD1A997, 0x7DB25937FBB26AE6, 0xDDFAFFCFCC939C7D, 0x6E2A44CC9FFA1C6B, 
-0xF5E8D006F150728C, 0x2489DA100AABF767, 0x4F7DBA9D75BB2053, 0x9F97C0D3904, 
-0x424097E246E67352, 0x1BB12A4E6862533, 0xFAE8A0770BA659D3, 0x523FE5A8D376CA95, 
-0x1697E8885347A78D, 0x8C798CCB7B350621, 0xF406020637C11EBF, 0x6AD83F55F776AE60, 
-0xF96806DD282D8A9E, 0x926ADA1BAE6BF6A3, 0x8604793896D92172, 0x396C5B03A57F, 
-0xAC97C4B97F7A20D7, 0x2B4BA3DE0332F057, 0xDE29AEB200C5002D, 0xC032DB4396088C68, 
-0xC136025FE94DE863, 0x5455999FA02D032B, 0xDC479FD377CDE714, 0x6627BFA2089BF1A, 
-0x1E495F3AAB5D855A, 0x1DA6BA68EF86E00F, 0x5ADB6C4F15E033D8, 0x35E621A9D5CF, 
-0xCB007785A9DDA68E, 0x65620FA72D99486A, 0xCFF0A50EF03EB87D, 0x5302D34D70DE0116, 
-0xE52F109344B61138, 0xDA64CB86480B9CE, 0x33A72B3F319691AB, 0xA6C93687C8CDE3AE, 
-0x8AF9FF57EC1C078, 0x179DBC8CCE9DEA5C, 0xC0FD023C31D5F5B4, 0x6C1371EF6F24, 
-0xF6B71BDF24A18147, 0xE6E48B0CDADAD3F2, 0x896DC21A2FF48526, 0x190C4FA334475582, 
-0x798973452B54AFE, 0xD8427A4F33962C6B, 0xDA0AD844B4F8C0EC, 0xED2A69BE432C67B1, 
-0x9A023024C0D0F03C, 0x6A8AB53B882D4E2D, 0x75578A63C2F012CE, 0x5C22C5D6DD36, 
-0x8E0156EB8B319C, 0x1E9270960505C4A0, 0xF1D2A77460A21333, 0x7EB4CA80A56DD431, 
-0xCA7C30B9539D13C1, 0xBB3F76C81A8B3474, 0xDFDC218D225C8696, 0xAFE60B422F9DFCC, 
-0xFBC60ED064FC3FDD, 0x34CE177EDB3A1C3F, 0x326B05A44979B46B, 0x47478A74E209, 
-0xE1D556AF8D591809, 0x348A226860A85202, 0xA62BABD3363ACF93, 0x3CAB3B5428F48314, 
-0xAC396D7A26C72B60, 0x7516C66FF2F6CB13, 0xC759AE830900B4B4, 0x3B051FCCE8A45EC9, 
-0x2CE62B3B47D25063, 0xD55CA270DECD18E8, 0x42C29B7FCB23EE4A, 0x10352FC4AE37, 
-0x280002DE40DFF70A, 0x734A5EDA67293219, 0x82784507DAB3EB17, 0x3C098B309B2D9AC7, 
-0xDA945EDD8840902D, 0xEFC197D6ADD40B91, 0x1D4C9F0246352476, 0xA6ECBF6E0569F229, 
-0xC479E210C07E77C9, 0x20A9A5C2BAD6CA98, 0x63C8D81DA132671, 0xC185859EE2A, 
-0x3B3E9189A5F265B9, 0x3481FD815DA44FD6, 0x94EB4DF085E1B3AE, 0xAC04299E7EF1E6F8, 
-0x24E77ACCE6751CFF, 0xAA278E08EBBB6541, 0x3DD9BCAA3C9C33E6, 0xFAC22B23435DD337, 
-0xF570CFB50D5A1F47, 0x385404F3A8C9BA51, 0xA94FDDB18AFF2D9F, 0x12A81AA82CC5, 
-0xE480DEDEB2547FFA, 0xD39C6B84DB08980A, 0xF115C7ED2077D571, 0x45D8D05698943D2F, 
-0xF3338988A9EA30B7, 0x7704311A82584B1, 0x5309C2DCE4C543F8, 0x2037EB7DD3DD7F7A, 
-0xD9767D68E8B7EC75, 0x1A8A8C36AE561EFD, 0xF4F03EF6B741C942, 0x5878F9DB185B, 
-0xDE76CEEDACA86D55, 0x46B8EFC944A3D0D7, 0x7B8A37A59E29836, 0x37F8EB7B2FE20B5A, 
-0x5797AA06A2F00015, 0x644957FF5C8523AA, 0x230EAF1B3BC1E1E2, 0x35A7A1442E8A1A07, 
-0x93CA2EF626691921, 0xD1820F40B90BACAC, 0xAC54A3D28C5D4E6E, 0x1D5FA816DAA6, 
-0xFCB318A8F46F31C, 0x774A928216140A05, 0x501EF8A38A330C20, 0x57CF5D8F50D03602, 
-0x61DDA199DB7D9825, 0x7A4516163C7C5106, 0x99B04C3DA1D198EE, 0x2ABE499FE834E418, 
-0x8781B12CB4975B8E, 0x52683E5887C4CE45, 0x86516E4F42939466, 0x517E32E2B762, 
-0x76086B2F73F975B4, 0x5FEF3048FEABA106, 0xACB512CCAC1B5EFA, 0x240E4A3402878C72, 
-0x3DA950549D20ABCB, 0xACFBD804C4DDD796, 0x6FAC411709FA6672, 0x307C5DD098F897A1, 
-0xC4C40A887A603AE1, 0xBD7A66FE7A07FE1, 0xAD04A975F05FB7E0, 0x262359A6AB8C, 
-0x8BF4AF5FE600FCFD, 0x5D3B6EBA0E0B1C2, 0x6D4A8E907A63471A, 0x8415FB1F75E485A7, 
-0x6F78FB977D0966E0, 0x285DF289B02259D5, 0x56941716BF255EC4, 0x1143097C0E3A3C48, 
-0x5A5F46342C3264E4, 0x1AADE617A632DF2D, 0x6EAE295CE51CA85E, 0x2DC767C7D8EF, 
-0x3825B380B2515A12, 0x3EA1D28153098F9F, 0xF9D417F6A3EC985F, 0xDFB327EEBFE29730, 
-0x36652B712937F42E, 0xC0F97A1D5B1B5390, 0x3685AA590319305F, 0xA92FC0503DB169A2, 
-0xD3F51C3839C7BAE0, 0x15CD05F0C65B2164, 0x46C1385752430267, 0x38A4FB9D77FF, 
-0x43A92D412E11A43, 0x8A2A13F5EA19C06C, 0xC11F71CE3984FD64, 0x357E2658DC9E4BBB, 
-0xB4480B92CF0573FC, 0x9DD7F6727FD9106, 0xB121B325B3AF0550, 0x7633054FB50E03FD, 
-0x86AEA26136000CEC, 0x8323091939181B03, 0x34D4F211C4145E80, 0x66C461B55309, 
-0x57828D71127D0D23, 0x807680D3B0505DB8, 0x38374C5A09905AC4, 0xFA3536E2ABD74FA, 
-0x2189C8EE935A9A28, 0x82B9C7A2AB5CD761, 0x6C8F2EB08105EA8C, 0x7B98CCD31371AA, 
-0xAAF229D787513927, 0x250BF78790C9D7CE, 0x579A7101FC758D2B, 0x2B6D0C90D18B, 
-0xD3AF3F6617547B6C, 0x9B7202C8B384D964, 0x5B2A96687E935838, 0xBC908FD8CF1C60A2, 
-0xFD34DE962F89A54B, 0xEE95827DAD033A11, 0x6D6A90127A3344D6, 0x76D11498DA880725, 
-0x8EA76AFD842B8BFB, 0xFB7C77E1F6326C6A, 0x8067F2BC04B1704F, 0x5B6E40CA1D, 
-0x2DAF18CB610CC92F, 0x4F2680FE8DB2CC34, 0xDA0FF7171D838A23, 0x3641D11B6FAEC879, 
-0xF24F57F521647C2A, 0x4422BD9BDAB6C50E, 0xC067337E33CD3669, 0x9339E1F02D84734F, 
-0x4080555A8D896D20, 0x536DA9A3B01A828C, 0x551B78A9BD32B6A4, 0x5008F04B898F, 
-0x514569D428D53146, 0x4F7BC8BD8ECEC3EC, 0x592FE71FC33838D3, 0x6FABC42C4D347154, 
-0x5B178750772573AE, 0x1054274E6090252B, 0x13E50D412552AE06, 0xC6B9F879B08AAF7A, 
-0x553549B49335EBFF, 0x5E3401C37585ED62, 0xC4C74CB6BA594574, 0x69353DBE6E91, 
-0x42A940DAE16E48DE, 0x1CB00B614D66C312, 0x38B37FAA40C6EB20, 0x4B28CA3DE137E88A, 
-0x6B273020304E9620, 0x6E97470E09E81C5, 0xAFFB94A4F0CFDF02, 0xCA1EFFF42D586F26, 
-0xAA585C737CD5403B, 0xA3A526C411FFF3A3, 0xC85E567169EC89BA, 0x54DFBAB8DFEA, 
-0xE099DEB7BA12219E, 0x5F8C1D04082784E6, 0xCE482EAA52DEAA75, 0x98719BB142FE811E, 
-0x153EEF5FE22F8F20, 0x38D51FD849D3B74E, 0x5C86B6278A640EA2, 0xC69CB97BCC886A75, 
-0x5D0521D92A68B24F, 0xD56A1724BBA1E55F, 0x7ADFC3D86BE6BD8D, 0x13CBED09263E, 
-0x662874B8D567050B, 0xD6C72FC6BFC88FE6, 0xB6796B2556E3C09A, 0x9E62F957D2A94442, 
-0xA5B18146725B4DA9, 0x7550892077A73C8A, 0x9CE4BEB642A151A1, 0x7ADF2B216A074931, 
-0x8E571EB025EAC614, 0xA833A64D7A82281C, 0xA84CA7AE7C03B699, 0x4463BECDC557, 
-0xD001AC5AA055505B, 0xD9884DB394070371, 0x965F97C62F9AE48D, 0x3E9A78447425AE5A, 
-0xEBDBC7DB7981B58B, 0x74AA226F7CA7D687, 0xD2B42A91A06DB253, 0xB1EB825A12F2423B, 
-0x1901B982F67FD6E9, 0xEE472C5F0564939B, 0xCE75EBBF993C3C34, 0x37C18E9EA72C, 
-0x7F9F705CF86854A0, 0x4E4ECFBD5C74C153, 0x57855EF61E2C30C1, 0x5BBCD9AC285E6D21, 
-0x61B47A4253B87135, 0xE932F09DB46E29AF, 0x2A4C6F4AE221ADE1, 0xA641418801C63BC6, 
-0xAA577C370D0D5C00, 0x71309470736B2F32, 0x420AF455EFC83A1C, 0x26555DC09CCF, 
-0xE21D173073FA79BD, 0x6328EF1ECB9B681C, 0x140DEE2193621172, 0x3BADC223F747B4A, 
-0x59202AFD8D87CC8A, 0xC26165ADC83A327F, 0x18C6A1B3AF41B2B, 0xF36D02A5C4E6A491, 
-0xDFFC61700F590882, 0x4A4B7D86A3896677, 0xD05011695525AB3, 0x329F01C2F596, 
-0x2C3814E4D8906B9C, 0xD113138240855395, 0xCC4FEB87BE21AD31, 0x1E8BF4FD9312A452, 
-0x4A5A6CABA9FAE3AB, 0xEE38F52365FB09FF, 0xC7AB38188642FFC7, 0xD8463D3A9C6AF751, 
-0xC4508FDED5BA4C58, 0xAEFC2C0C1E9757B5, 0x2F22D5BCE3D2895B, 0x17E2F84E6853, 
-0xFF04A21E1E9291AE, 0xEB63A3B5BE28856, 0x1844DB3829507D96, 0x2422C50872F71BB6, 
-0x26DA6A73D1F66EF, 0x3A0EC4EEFEB63FAF, 0xECAF0B472E18F13C, 0x364EA8C151D685E9, 
-0x8838FE273290CA38, 0xADE5D6455F7BD338, 0x62F2FEE6C0F7F83C, 0x439C728F79FF, 
-0x6FDFBAA3591872AF, 0xDD860E1FED953C9B, 0x4D8527948E81B3C0, 0x30A79B3C072AEB46, 
-0x776B5A8707CC1E37, 0x6DFD2BE374C61EE4, 0x2717DF3E28DBC162, 0x6FC3C5B9E07442E0, 
-0x683085F0BBD8FB21, 0x27471185731E4E22, 0x1824C6DFE3ECEE10, 0x2C4478CBB5D, 
-0x5BA394F5A58F0755, 0xFAE1D3A3A9A56A79, 0xC7F9DCFBA5708D56, 0x8DFC508A5F9F97E7, 
-0x60B399CFAA4E844E, 0x57FCDD45FE3BBAA2, 0x57B34838EBA8DA5C, 0x5B6B1A98E31F0D3D, 
-0x1EB1C74C64E96D11, 0x93BDF1450F6E42E9, 0x27B5786355987EE3, 0x2E570ED66BEB, 
-0xEC82FBD8F8FB9D93, 0x358E85C15294D6A4, 0x91619294AFD542BD, 0x2BCAC3EFC2F83C81, 
-0x45D909610F0868D6, 0x422C9E8579B5D1FE, 0x48DB8BF745D723EC, 0xC833B0C8264069A, 
-0x688BFD9B4DDCFEB5, 0x687F4675A2285119, 0x26F5CAB865F1FD1, 0x5B3C4EAAFD98, 
-0x488F06B9B9975C8, 0xA18EABD96504F50, 0x9D7DD9799C1AAC39, 0x3299BB495A59218, 
-0x750873D842E1A7D6, 0xECD72469B8E1A640, 0xB491119286F46FE1, 0x29C95289699A61C2, 
-0xCE54CBBEFC93D598, 0x8AC997C2677F069E, 0xCB7D7D4F3256BDED, 0xC0C3B47390D, 
-0x7F55C9D9695695B6, 0x991962683ECED16A, 0x36018C3122073A0B, 0xE0996D71917A358A, 
-0xCDA418F4A0D8D501, 0x634A19ED93C21EFB, 0x9BF92DD2CADA0BDC, 0xB4B761F01C508D0F, 
-0xB63445A47178E23B, 0x488ECB392F29E5, 0x141AFF39C44C17E3, 0x682BAA616571, 
-0x66FB6D66CAC1ED26, 0xFA28930283884D1E, 0x8630DAD963F75919, 0xFC6B067ADB5EF2B7, 
-0x3F568134FC37D795, 0xC8F12BF9892BEF6B, 0x60A51F044C696F47, 0x2F6D84F702F8E910, 
-0xE5AC758503265B5F, 0x962711D981E6615B, 0x491BE7013CE4DEF0, 0x5DBD8CA78C5, 
-0xA99D8F4551608300, 0x62C72F96E1AA03D9, 0xA3F7AF730E3BB36A, 0x78F723621BE3C1A8, 
-0x525520E748B3879B, 0x4C9715CFFB9CDCE, 0xA6CBBEB13997289C, 0x96A961FE1DEC6E13, 
-0xF9D0BBDF779041F2, 0x182FB10BE5201BD, 0x6592E96486D74664, 0x3AB9E1F1891E, 
-0x39111DE917CACA0D, 0xB2F2610204057996, 0x27B449EF40098E1D, 0x357528DF749D44A, 
-0x61F7C0BEC6108C77, 0x786E8879B72713CD, 0x71AF2C367E4A48A, 0x80D5E02C28234889, 
-0xCD49C0AB30FAAC33, 0x267ADEE2E12E3FBD, 0xA6D159E3F78392B6, 0x2D4177E8D093, 
-0x5CE2933C52EE6855, 0xBF0C74D95329949C, 0x3F4DDCC1441FEB6B, 0xA8FB3EADDDDAD2B, 
-0xBE26F7EEBAEEACF9, 0x2C88BA59C4D27102, 0x8F6F47591CBD5C61, 0x470019BA1BEFF3C5, 
-0x2AAE055B9CFB80B8, 0x60B90A20F7952DBF, 0x8A2093FFA01ABC83, 0x1A11F8B0DD7D, 
-0xE904DA2989EF0DE4, 0x6C9DBC5E4918B872, 0xEC4FB5E1D3145A4D, 0x6280732D0F0377ED, 
-0x3C8FB322727903B5, 0x2FA109FDD42CCC9B, 0xDB6294E07CE2C967, 0x61F905D53A6348E4, 
-0x55E34862E546DE6E, 0x401E04283867BA04, 0xBF1E881B916DA152, 0x4F3C9DA4AF56, 
-0x8F2BFFF5685EB04A, 0x8F7CA1E529A0C93F, 0x4DB7EEC54DBD252, 0x18683CA6FA931E82, 
-0xF0F9C9F21B79523B, 0x1F0FE7A03F9113D0, 0x947B09E7798CE0E5, 0xD4C20E4718B7BB6, 
-0x841D5D6E52D8C416, 0x231625975A6F5BB, 0x1EF7F7059F87FC21, 0x13BC50E29C9F, 
-0x322C188C053BD436, 0x85C2A437C3B2C56B, 0x8B34C21EE1DC798F, 0x53FAFE39E7EF8C50, 
-0x4E29513A5F5DF387, 0x4E77A0E4430C76B, 0x5169CDFBB0B8EC5E, 0x622DD52CB3E6DB4F, 
-0xB98CA1BF9AB6284F, 0x8476D477A5D651B5, 0x41389CB73FC8BCF2, 0x1EDC9C5BEEEC, 
-0x680C64CB5B3747DC, 0xC825D8AA7E711984, 0x4CF8E7E4B282D0DF, 0xDA9347F6FF86DB19, 
-0x6E3087545F63D686, 0xACA364A1692C62F8, 0x3DBD443A2954E667, 0x4E5D21EAC3A05CCC, 
-0x5EBFAED5B222A341, 0xE83A0DFFCD15D44D, 0x6E3AD1A6D47C5BC9, 0xABA9EDD7637, 
-0xC8E6378958272AC7, 0xF4C4903D8A4DA29C, 0x15EC96DA6423E82B, 0x4E727CF9ECC8FE42, 
-0x42438A4E3280E8BB, 0xED12CA5D1E1F8428, 0x6DD6DBB91B7D5770, 0x992028798B76C6A8, 
-0xBD894D6611403323, 0xD96EE41C99F61897, 0x176E172B50E7D081, 0x6875D3391F20, 
-0xB71565E8EACA2DC2, 0x649F0D02E614DB5A, 0x91C37CA67428B028, 0x53BBB8FDC29B3ED8, 
-0x578CC46D60C076E7, 0xCCFB6ECEBB875A7F, 0x15C9C4BB2564A40, 0xA3C4BAC208D327F8, 
-0x77AB61DEDE78662F, 0x5823082C3FA0BA61, 0x5172B55EE5395668, 0x167443497745, 
-0x1330463E3D8BC9CC, 0x4E2F2F5DEF75939, 0x962721A26E197FC4, 0x87363047F6A6E8FE, 
-0x37F9DB0F440D033F, 0xE08298F429AAF47, 0xB35C490A105EF8F6, 0x4C0651B1085B4541, 
-0x8C44497C556D8B39, 0x37F2179E690D2EA7, 0x16CBA8B48A133583, 0x64E2E3C4E5A2, 
-0x5B51446058FD336B, 0x855CE28E3CBF6CCA, 0xBE92894782E61A3C, 0x515D2661D5B95227, 
-0xED2C66A6E2873BCF, 0xBA3ACDC90741625, 0x59F54EB73D48CD44, 0x4B85B8F55919B3D7, 
-0xE12CF378110164B6, 0xB3CFA67FFECCE03A, 0xC95458D6019F03BA, 0x22A2CA123CC6, 
-0x38E4CE7198406A9, 0xC76810C0196D481B, 0xBFD57EF3FBC19FC2, 0xB9559876CA85005, 
-0x7D9AA99C2A5C3B96, 0xC6F76412185A077A, 0x870FA5EC14B7DEC3, 0x26C11C1EDF60A780, 
-0x6822384FA8DE2BC4, 0xA48527D175542BE3, 0x1A2C5C014D4EE45E, 0x6E895DAB2EEA, 
-0xC7B538FA931A02B1, 0xDE133AB98B9C45C7, 0x673DA138FAB47560, 0x8995222F6FDF6FE7, 
-0x48B7E0B8671FBA63, 0xE5F27ED597A39558, 0x7335E4FA8460F570, 0xACD1ECFCA40108F5, 
-0x5F8EEDEAF702A865, 0x615582756C2EB566, 0x6CF576A8972740D7, 0x55DC39328668, 
-0xC3EE45FFDDA0A37A, 0x5364EBC61A4D758F, 0x91306A1177BFDB4, 0xD973DDCAC24C51B1, 
-0x8A3AC96AEF228C99, 0x69E83BC8ED6EA814, 0xE1D86033A7C6026B, 0x20FA1AE5601ED339, 
-0xE1023E55D43EBCE2, 0x7882114A1DA7C12E, 0x4010677A16656472, 0x10DA53BF663, 
-0xD5094A4042B4C582, 0xE1F3CBABE0D7F193, 0x2A2F840CC1E4DF6C, 0x4EBFDFEAA63A52DD, 
-0xDD23485CA2C773B0, 0xACEC760CCEB0A2C3, 0x32C04120074934BF, 0x859E31BB817A3AB6, 
-0xB294213C4367687F, 0x347F5B8086EEF4D3, 0x821AF04F53D5A159, 0x32B1F1B506BE, 
-0xC2CB6BE808FD773F, 0x1FDA058905597FEC, 0x7256B920FC3A7433, 0x9F8D475D8145589C, 
-0xF29BDAF3FFC37B8D, 0x7E6F850C1AD486A, 0x788A00446FFD6E9A, 0x9DAAFD78484479C9, 
-0xA1698F2A422B3144, 0xFE3766F025F3492F, 0x90FB42F49777087C, 0x68FD37799253, 
-0x41D78B9BDDC66003, 0x48C155A5560B2705, 0x3B2EF4624A9B92B1, 0xE590343933DA7D30, 
-0xFA239740EA004C3D, 0x56B5AB2FF58A3C5F, 0xCA43DB047C02B491, 0x3D3D725350F864E, 
-0x13DF1A79E0D41911, 0xCE51FBB7CDF0E093, 0xACA4DFEF0211038A, 0x6F21172E293A, 
-0xEC81E4D71BF70040, 0x6255A1120E4A80A1, 0xC0DBF84EEE3F5984, 0xC5BA6D3CA8AF0C98, 
-0x406DE0DDA47E6729, 0xFBA342FA96E292CB, 0xB2A06B39D0B55FC0, 0xABA19E1BCCA085D, 
-0xAFB5F3C735C5BEAE, 0x12F38828357BF2D4, 0xD71E7F1F8C77BA9E, 0x694072AC3D35, 
-0xE541C2032F1ED1EA, 0x239CD206B7FA0C26, 0x161102BE1096C88A, 0x2512C5636A7BB3C7, 
-0xA92B1E77FCEDD2D3, 0x6DBB4DC72BEBCCAD, 0x1525D18B80F19D28, 0x83353A3D6F6FC02E, 
-0x949D056EFF868B99, 0xC3C3E3CFC51EB882, 0xF14619EE5CF7A1F2, 0x61E78FAC5740, 
-0xEDFD678028561963, 0x96C9F6DD6CD5AAC6, 0x9056124E26FC992F, 0x9E3DB61F6C9589A9, 
-0xCA519CC418ADCE14, 0x3CFB56A49FF2C23D, 0x4FD7EC6269D3C157, 0xBB9F26CA8872C029, 
-0x46DC319F1DAD383, 0x1DA104CED84D360C, 0x774E3960ED94F00, 0x6293FD69F0BF, 
-0x481394D2498E8FCB, 0x57BD93D3119EDEB2, 0x275B851F5061E47, 0x5674F96F96D5C544, 
-0xD50BE9C9E93E0B18, 0xE3F7CCFAEA640544, 0x55335C4FB0578521, 0xA824843C82E88AC3, 
-0xADAA41408053CC86, 0x534C4C11B2CE3A10, 0x763D43DF05F3D73A, 0xF9A47BA975A, 
-0x955B08AFE4F5E53E, 0x55B7AAE4B300B01A, 0x5433B71AAE3A56E3, 0x4D9D5C22207435AE, 
-0x4521356AF68A58C5, 0x231A6B74FE606CE8, 0xE9C17998C87983B8, 0x8F91668A4824142E, 
-0x1DCDA2D08355211D, 0x831498B534BD8D80, 0x57D162952A2F5E61, 0x3DDF55113F3F, 
-0xEE235673AA174856, 0x8740DE0BA9B184D4, 0xED73CC229B44FAAB, 0x97F0A255535865D8, 
-0x2BA72F15B08E9DB8, 0x3E2B240823177D52, 0x192C8F2C02EA4F0A, 0x11238CB0CD6E7CDF, 
-0xA721B3DBF7ADCB4D, 0x7C367507003BDB05, 0x80A9BABEAC289D2, 0x29976C90B96, 
-0x98828112E6A71EC4, 0x7C0B0E79FFCF0739, 0x98FA466D84F5DA00, 0xF1B8AD3D7C90931E, 
-0xFC3F8054096720A8, 0xA6AA6B507F11C89C, 0x133519C3C9BB79F7, 0x128721CED851A3E8, 
-0x29F4198CC3C0F0EE, 0x91913583640C8752, 0x5D3EFE90AD90F376, 0x55BDB3A40B91, 
-0x97940DE735650222, 0x19643932C46708E, 0xCBC4B60A830495AC, 0xE2539815171ECEC3, 
-0xC1A4596C41061DE4, 0x3745708DB9A863F8, 0xDD7D5386043EF389, 0xF6C47F9670C40535, 
-0x330D4FF12DBAC83E, 0xB181B29F0D5AF9FA, 0x2EE2F1150F0A1002, 0x4CCC051CDD, 
-0x287FFFB813FB2928, 0x4382A57CBAA10FF9, 0x3DB4E6FBDDF4F27, 0x4D545C9777B396B, 
-0xB76552DC44A6AF67, 0x955ABF0E1DADC6B8, 0xD2FB52281073CEF2, 0x1DFA667A3DD3EA5F, 
-0xC9AE662CF894F7CB, 0x92927C543736B5F9, 0xB59C50890F698E1C, 0x433B7BC082F0, 
-0xC0F876C13A177FF8, 0xCE047DB9AC5612D7, 0x2DC89C387F297ED9, 0x5737DBBFA3AF103F, 
-0xCE05CF98B4C22A54, 0x97664FC56C980FD6, 0x76603C7E8CCACFFA, 0xEDA6BCBFCAF1CDD, 
-0xC0DA2DC2B2A0DE8D, 0x23B2952A0C6FE4AD, 0xDA5BAA348D79F6F3, 0x65B5D5EAF03B, 
-0x1D3ED498EE57593C, 0x9B354AD32E78F858, 0x386A7DD0AF185EA7, 0x5956674FE04081AD, 
-0x82CECF06550D5C72, 0x1FC91805CDDC3EF8, 0x4DE36BBCD1776D7B, 0xE503C05FA4C08A00, 
-0xC855F1122C3E6148, 0x941014CBB0A3093B, 0xB038071A675A076C, 0x413E80A299B0, 
-0xA762785F71C9EAE2, 0x5D0A3696374AE20E, 0x3496C4AA7730D9DB, 0xE8B33E0DB040CF96, 
-0xA45139917E8C6018, 0xA680B9067B32EF21, 0xFABC65B2425C7786, 0x4300C1D154C3239F, 
-0xABBF264E3EFBBEFA, 0x326D6007EEB0764D, 0xBBB490E1A75A6FF4, 0xC99CAE0AFA8, 
-0xDFAC94DA33E0B15B, 0xDAD5347F39655610, 0x3CFD462FE8E3AC0C, 0xCCE270E8E7FFFDD7, 
-0xBC404584A2CC134, 0x1462B8171F5FE1DA, 0xDC3A34558B71A748, 0xD35E8B187FA76392, 
-0x4F44C13A9CE087EC, 0xC156EFFF60588245, 0x58D0633BAC895F9, 0x5A30B14CAA93, 
-0x42EFD6CAB80F9FCF, 0x60D73F77CCD37F3B, 0x65B8768342F7C568, 0x217F54D3CB39E81B, 
-0x601694FE457C9EC0, 0xC6E0B023D7DAEF51, 0xF9D6E00DD6089ADE, 0x9B861D4C0FDF99ED, 
-0x5B630C6F2681B305, 0xBBB367C3D11F6A65, 0x606C6161D9C67E61, 0x6B75515E1DBB, 
-0xE05153C1E128E4, 0xB0AD90F1A098A3D6, 0xB963390C79BAA20D, 0x46055703D4FD250A, 
-0xE4EBF890DB5562ED, 0xB1AF43960D68108F, 0xF2EEC087D8EF91CC, 0xBB17C5BF219CE210, 
-0x6D174F8C27AB6261, 0x28D91F66D1E3F064, 0x1F8C583D5B4E7AB1, 0x68CDD7716725, 
-0x5CF97F80AEBD68C8, 0xAFAA4C053A8A9FA5, 0x20326DB0D0B966C8, 0x771F6BF924524E3A, 
-0x7AC501587EA82834, 0xA36B2FCA18633077, 0x9477063FF0B57F1B, 0x5D5029845DE859DC, 
-0xADBF596FE9659535, 0xC36D784338A4422E, 0x3FB541797FA7D0C2, 0x17E2FA0A530C, 
-0xBD34674CAB472766, 0x3A5E1EB7924D70CB, 0xDB20A0C406BA6357, 0xF8036C46A5EF7119, 
-0x8E9D61A4C90104EE, 0x9F1D56B554E5006A, 0x63A76908517D78C4, 0x881725B0C7B2E2E0, 
-0xD3B50BB87AA84BF9, 0x9DB198F0CA7B73E5, 0x28000D4FED3D1DD3, 0x2E300AF8102C, 
-0x871A22A9DBAA9086, 0x9959011D381E2BA3, 0x19ACB3489CFA4895, 0xB4C0FDA296542B22, 
-0xBBDCDAD66D4EACE, 0x6E7642F8ADE5AAB0, 0x806255F47B450B45, 0xE3E5D6B91F19E4D6, 
-0xE521E50F34CCC2C0, 0xCD2A732EC1F61540, 0xD8C0DEF182D73775, 0x1D4A1D8E1A6A, 
-0xC02BF82948DB0AA, 0xA71C10A15B04D5CD, 0x2096926DA0681B67, 0x50264AFB2553BCC1, 
-0x5D8929537580BEEF, 0x8AD7A8912E9A2764, 0xC7864D4102093754, 0x8540CA1D9840B032, 
-0x5D2131D9FFA9247E, 0xAA07A3B457FDE990, 0x1974AAE10F959324, 0x5A10F69BF61F, 
-0x50895C6C04760EC1, 0x7BBFC9C43B315AE2, 0xAA15B31B142F9B2C, 0x19DC67B7B72B7471, 
-0x6C2398091D2C8C28, 0x9927044D29512C22, 0xCC9CED654967ED12, 0x90BE3930FFCD7C95, 
-0xBD0ACD016E638093, 0xF55AFB34E0DAE9BF, 0xEAD663F422C2D190, 0x1EB113F244AD, 
-0xE53F84793E89E3F4, 0x71AE0449FD5FAF46, 0x523FF73B17F68E8B, 0xFAEAC48271ED41F1, 
-0x9F6973A1589B25D3, 0xBADF9432C27C4D0B, 0xE037DC67AC90481, 0x66CC5D56E4F07205, 
-0x66FD564ADC387CD1, 0xD00EF2CB62DF2652, 0x6EC5C2AF76A44015, 0xFD7F017A40F, 
-0x35997323020C3F91, 0x5A074C9C39DF943E, 0xAF906C9F9EB9B27A, 0x762E914CD6EEB576, 
-0x54B87FEA39E595F3, 0xDFEBF3688ECF2AF4, 0xD54DBCD9DA696B96, 0xDB33D2F5608C72D5, 
-0x25C4CE9988FB568C, 0x99FC9B1249B3C9B0, 0x7B4B1A6F20F061C, 0x3C17EE05D2EB, 
-0x22494185F28409F7, 0x4A5E7763E946391C, 0x7DE3C552BCDDA24, 0x99E732F469A23049, 
-0x7E05C29985042243, 0x1FF4494CECB070DD, 0xDAECE808D9A45CDE, 0x9D860413AB983893, 
-0x826B747F5F4357E5, 0xCCBD462570D0F1BC, 0xA5BC59F08928621E, 0x2B258AB5C9F7, 
-0x8C571B0BE3F1FB52, 0xF256B555DD6DC680, 0x24855FFF169BA305, 0xE34355876F593AF8, 
-0x44DAC999DD712B10, 0x16A6BBB5023289DF, 0x1B430642550A89BF, 0xD6EF91B6F3EBC24F, 
-0xEA2E811D9E789B97, 0x59B3F7C69B7F2AC, 0x766F2D7B47A93EEB, 0x6F072D95F112, 
-0x73F1DD3EF80984FB, 0xB27384A35DB728B3, 0xA971CF8616BE188F, 0x45A65A8C83D7CDF0, 
-0x78745C1B9B2FF453, 0x371D7DE18A6A5A06, 0x98393DEDA31BBA3C, 0x42F6762E9C74F4B5, 
-0xD3B7AD5FE27BE49D, 0xB51DA06B82DE900C, 0x764D9E2BA473294C, 0x32829F97A844, 
-0x4A405EBE710B370F, 0x7977954631B6AA79, 0x300FE8B4F98667BE, 0x3E1038987941E1E5, 
-0x841D1F51B35911A, 0xBCC285E4311B138, 0x8F273CB62B7467D7, 0xE9CE520311531C67, 
-0x2BD44BE6551E99DA, 0x44FC827A4EA4FD9C, 0x9F3B3F5DB08C034E, 0x65BE72E59521, 
-0xFC7E9205807F0C36, 0x2F544B97DA921A93, 0x841093A462214ECB, 0x43195F795D9779FA, 
-0x502C62A36282BC4A, 0xAFDFF522547011B8, 0x75519D9C45D724F6, 0xB17419FFABD417BC, 
-0xD271002005B4295C, 0x50A92D4FA34B7BE9, 0xCF22366B583BC5D0, 0x548ECEE2B9B6, 
-0xF8F4F7BCC1B237B5, 0x832460CA9B157361, 0xD769998D60CF37EF, 0x995782001CC6AA, 
-0x236568D8E693D9B8, 0x167A2D6F168CA092, 0xA8A488ED7A54F8C7, 0x9393D744933F534D, 
-0x24C9D9F788AB27AA, 0xD2E9225A1D011861, 0x3FC6445BF2134E79, 0x349002F96AC, 
-0x1F3F6E8632A2142D, 0xC9B28EC68E54F7FC, 0x3E408073F2111450, 0x84500D3E47844078, 
-0x9C58D47F7A132DF9, 0x8586E10C24924721, 0xC9A5628AEEAE2419, 0x1D11F1B15F3DCADB, 
-0xA0D0D31E0F8B1C6, 0xB5BA4A36391B3885, 0x25C9D39C26932088, 0x12B06A84EBD5, 
-0x83EEB68D1395CA47, 0xDDD6B2D8415021A8, 0x910DB9F122EE1BC6, 0x988725B44C0E60FF, 
-0x1F9389C78406E6AE, 0x1CB2B8AD97DB840B, 0x97F53D31473A5638, 0xD67C764FE9F0BA37, 
-0x8364CCCF9CEB890D, 0x3A5A719C98798EE, 0xC22E95D3F59EAC48, 0x35764882CEFF, 
-0xA8E2DF7FF3D21FFB, 0x7B6A5B913D4696CF, 0x2B7274FF3D156AA5, 0xDAB9679EB0663B9A, 
-0x5AEF9CB3EF87FB7C, 0xB7E0CFB6E2377223, 0x91652FBDB05955FA, 0x258BB312EC4135EB, 
-0xB36ED2369F5CEB14, 0xCB4D962AE697D4AD, 0xC167FD9228C1FCC2, 0x6E0C2697FDEB, 
-0xE6E4A34CFE4407E8, 0x250DB1883B629672, 0xE9CA0508CD7F854A, 0x2B66FEAA70C5D17E, 
-0xA72BC1217B981E54, 0x214C03838A7632C7, 0xEC5B33333CE6B20E, 0xB3B3276EA1C24D55, 
-0x618007117BAAE4AB, 0xE73E754E07ED31BB, 0xCD72421877F23793, 0x1019D234B571, 
-0xFC1FDCBBE2540FE8, 0xDCE0EDBBB88161B3, 0x337606B29456E45F, 0xBC66186590B205BE, 
-0xC152A6EED5C70293, 0xABEF840A7C61D36D, 0x18C2DABDB0D3B72A, 0x74B29D32D44E9CD4, 
-0xC644AB2F788D08AE, 0xAA957B9C93DFA126, 0x1EAE8EB6FE34CBF2, 0x5DAFF81A057F, 
-0x7A019C4AA2AB6513, 0x35F04390ADA40EF9, 0x31F4EF9CAF8D06FE, 0x8583A21313F47E1C, 
-0x7A1ED4182502FC9A, 0xBC7C7699C8318F6D, 0xEC6C1DC555324062, 0x3A4F4378E04D7770, 
-0xA5FBBED484355F86, 0x3334E50C3281092, 0x33F804DB98FA5530, 0x68E83184C727, 
-0x7F5F112280B4FB43, 0x69480B83583C10B8, 0x84100A326888BBFE, 0x70D4D41CD3C9DF55, 
-0x92618DAA84670BEA, 0xEB2B0BC439D80136, 0x88B60FE77D7CC732, 0x490304BE2A264A8D, 
-0x2B7506A83684F6E2, 0x170193CF16EFA27A, 0xE815896A38383C60, 0x230F99A69D7B, 
-0x6D239CB581925CBD, 0x9481F2A4C4610338, 0x621D6F384466625C, 0x23C5D3C731A433A2, 
-0xA2DB5E8B7B245197, 0x947932B532227945, 0xC93EF9377AB3AFC, 0xF28F2F5771DA8FD3, 
-0x54C34E301A3B976, 0xF098E7E0B3574F1E, 0xB4563EEEEAFB8BA6, 0x5C5B0DAF64DF, 
-0xE22CE6865C53471, 0xE197CC8442B8F050, 0x8EE908EAC9E84561, 0x1A3795A4C39E0068, 
-0xCB19ECAFC91F10CB, 0xDA32A800BB5149F8, 0x1EBC243CC076E375, 0xAA53DF65BB909DC4, 
-0x9C8AE38063EF4C7B, 0xAFEE2A2F5DDA01D5, 0x88E75D146BC294EC, 0x5C7D604B4AFA, 
-0xC4E27431F7178772, 0xD7749B5BA06AAC58, 0x60C22E465BCABABA, 0x313A5073787DCCAB, 
-0x99885090D71BEA7C, 0xE35CB174790E5710, 0x55846F78F9E7C80C, 0x13EE6D4764051FC4, 
-0x1420F70A105A1F10, 0x42F8628B83D8F74D, 0x5B0F2A992BBE6073, 0x40407A1A426D, 
-0xA1676F063131A7CF, 0x84FDB7E67D63996F, 0xEDD0EE1CC07251B0, 0xB9A919F323E74662, 
-0x373029332F9E098F, 0x815A90FA60D256FA, 0xCCF6D72DB7616B6E, 0x2321732BED56CB69, 
-0xD384D9D99599A326, 0xF25508EF3A77BE4C, 0x71AF004B7682EEF6, 0x4C015480D966, 
-0x99EE107E149FF75D, 0xD402DCF374D3C73B, 0xD447D6F98BB26F4D, 0x1C455F35712A653B, 
-0xE4ADB22741E51D6D, 0x6719721F698F652E, 0xB9814CD4F8308BEF, 0x2E4A5EBFD3EEE4EC, 
-0x88FC586FD32DD5E2, 0x59770CC5C9237EEE, 0xAFD3D990B2CE1D3B, 0x1EF4C86B99EF, 
-0x44F3710888523C64, 0x8876CA0B61D5078A, 0x2E49BA8869DC1D4, 0xE4CF966CDF605937, 
-0x3EDC04765F819FCD, 0xC67EC9D1D7D5DB76, 0xFBA75DAD11F432B, 0x131F211243548118, 
-0xDE5C6BFC934C172B, 0xD5432F75626E255B, 0x58B4516043F6ABD1, 0x666506F2CAAC, 
-0x4137610085FAA455, 0x8B9DB74254EF5016, 0xA4DEB4613254C78D, 0x5D32DF4A28E95F4C, 
-0x78107EED502687C3, 0x904FF129F76A0C42, 0xDDB8C414FFDD7AB0, 0xC07C4B8EC618528C, 
-0x976F20134585E0B6, 0xD3D84C86A5C58C73, 0x500BD8A16D7B45E2, 0x7BF6838477A, 
-0x20D3D8B689F849A0, 0xCDB3E3D537E55282, 0x35BB62A14D1C1AC7, 0x8646E8AD2FC18E7, 
-0x772A531C973CE32A, 0x46C143DBDFA78907, 0x5EE8A14F3D570925, 0xFC8DFF8DAB212AF1, 
-0x98A349C13EF3003, 0x4AC5C4F05607A080, 0xD31615EDFA804E62, 0x5B044E2DA871, 
-0x6F5A556AE3E4FC, 0x7971FCB6E91B544, 0x3E5AC9E29BFA882C, 0x449BF9B907B70504, 
-0x3113899BDB864E80, 0xB4D8E527DD32FC8A, 0x639DFEEEB12F8EC0, 0x86D210EA9DB4759D, 
-0x7E55305C3A8797DE, 0xF5F520AD215C4716, 0x67816EB63F2944C8, 0x520D89C0CBA, 
-0xDE2E895A865A36D4, 0xF784CC9C96125D59, 0xCB40994C64E264DF, 0x69A58760E7F81DFC, 
-0xFC43A4DF1103BCA3, 0xADFE6D1C12227E65, 0xA7D881A6E8D25D35, 0x3062D6DD8806B657, 
-0x82E2802744D47DA8, 0x7F37A5F09971A740, 0x9E8EB138E6134962, 0x4E7F9CC10918, 
-0x87055A1C8132DD44, 0x366B2694A71D592D, 0xEE98874FB065FEB8, 0xAB0F16E6B52352E7, 
-0xA876B3EDBF4A510E, 0xFD7D43B3729087A1, 0x15815C9F92165BB9, 0xE9506F78842D5F8F, 
-0x9991484D9334AEE1, 0x82DFDF8C9535DA40, 0xC5701F725A8FC01F, 0x297DB9CE7904, 
-0xE648A858D8337814, 0x37F3E5501D62A853, 0xC0D2D11B766B8CC, 0x2B6CB6458A15DA5, 
-0xDB4F0BA38FC0C65E, 0x8E55AE9992A52A74, 0x1671EC65238B27B3, 0x35F9FB85FE3A2288, 
-0xB359F307AF13FA57, 0xA8E3DCAA3AF77074, 0x460E39B250A71AF9, 0x1B555BF8AA0F, 
-0x870B7E221EDF1572, 0x3D5317124E248EF2, 0x4A6FE00BEB4DDA39, 0xB985A13C665F25D6, 
-0x6E7A76459F2ECF76, 0xCE1B9E3CF4015C1F, 0x70D4D996398523B1, 0xFB8A8FF3D1D95CC1, 
-0xFAD6D12FBBDFC562, 0x76816A07B3B5651C, 0x55DB399A4539049A, 0x6C7FEF5D4FD, 
-0x653E74A6D05F089F, 0xD46D5C9CA353C74E, 0x5037538E7258D685, 0xB2D64E1C42FA6BC3, 
-0xF9D1CE14B7E56D93, 0x79AEAB2D81668E84, 0x6B7290BCCB056BB, 0x7279FD6A373856C1, 
-0x9993BF499E8B98C6, 0xEA99205C245FB437, 0x2995AA12F1EE0607, 0x612928BFC0DA, 
-0x4FD9CEB4B56E29D1, 0xA51574E1945FF101, 0x5D93786DE4D0E7D8, 0x61565C68B249CEAF, 
-0x1F8142AF5073F87E, 0x76A12B7401F233EF, 0x39C6B061499411E1, 0x8E36F48D97263E04, 
-0x1E5CD4A9F6975EA5, 0xC1E3504CCBC6F533, 0x4E844D82AD89908D, 0x1CC800AADADE, 
-0x722D2BFE3340C483, 0x6B732EA53B59C3FB, 0x7346A10232C9FA76, 0xAF32D55ECA3394FF, 
-0xEB845D7F8CAB4DF2, 0x97D4BC879F8FE695, 0xDE6BBC654936FBB9, 0x997760DA149D63A0, 
-0x7049C5D814CB54B9, 0xF0005D10F5B6C0D, 0x1749548D29F86957, 0x5702CC54D3F4, 
-0xB8686836AF364E19, 0xD73B036C0F0989CD, 0x889E13F7ECD6FDDE, 0x5F993C16B118CEAA, 
-0x32649DAA60285899, 0x56D83C718F05A060, 0x90F1839D8199D54D, 0x60CB0351D3911375, 
-0x135AB31D505268CD, 0x6B53FAA6D6FC9934, 0x904384B58E3FD241, 0x344E705A29EE, 
-0x2FDDECAE8308C506, 0x14E6AB3D6C6FEE39, 0xD232C592ED0DE918, 0xAB57B202846A0E77, 
-0xC17D131999370791, 0x76A6EB078650A73E, 0x30E7E65ED8361E61, 0x1F277439A68B83C8, 
-0x328565CAF70046B7, 0xC8AC6BB2ACBCAD2E, 0x8F44B295B9D68AE1, 0x4E859E097B8D, 
-0xCE6C44462456369C, 0x35B10015AB73BA2, 0x36B0586EF970E066, 0xE147685CB2DB5BC3, 
-0x359E56A605D29E4C, 0x9371476AE445F1E5, 0x611F2EFB526D33E1, 0x9005B05BD632DACB, 
-0xDA862E612B11CAD1, 0x47BF5ECF7BEB2271, 0x2C828427998538C4, 0x529D058B5881, 
-0xFA7350D2004B4E9F, 0xA1B5E70B5B2DA027, 0xDC3387D7D3A64744, 0x2A0BF2CA8FFC7F35, 
-0x441715BB2C158ABF, 0x3AE80C7960630C89, 0xA7B7CC689B1ED965, 0x45D43D7D36B16AEF, 
-0x7577F5C54135AE08, 0x837C962A02E1A236, 0x90D977D9B17AD65B, 0x11F0D6486C2E, 
-0xD1147B125D3CD108, 0xED2C70AB81BEAA2B, 0x3393CB31810F3964, 0xC91C9C3AA01D609, 
-0x2EDED050ED1E81A8, 0x67C4BDD7640E2A2E, 0x6633CC83A93EC4D4, 0xFE3E623D302E5071, 
-0x316E3A945313F0C7, 0xA7B9D567921C8F9B, 0x39A77011BB4D3F28, 0x6BC7052D65BB, 
-0x86976F2E2FEB4FE7, 0x4ECC5A39118B1203, 0x66E9B6AA252F0F33, 0xB67D8BAC66C2A8EC, 
-0x570E79F1DCCE84DB, 0x1B4B742FE96725D4, 0x306438939FE38CC4, 0x22E29B1D876E9CDD, 
-0x1351BFA57242790, 0xA50621640C925923, 0x28D46FAF63294A36, 0x4CAD3E322933, 
-0xC187F65B7477F64F, 0x4049D707F402A2CE, 0x2F6EA8398D4E657D, 0xEDA3F1FFCF281E2A, 
-0xCB48958CEA8B5A7A, 0x3199E902C0C53B07, 0x312ED4771A4A1A51, 0x28C0D2AC9BC23085, 
-0x6B3D7BC5BD55EF46, 0x84A3294B75EE4B57, 0xF62E754CE6684A92, 0x1E25663885CD, 
-0x627A8E6ADD4D3F80, 0x929664AE617ACC27, 0x6B56547B0FE8A11F, 0xD30DCCE9D578E671, 
-0x9D129FB9D64850ED, 0x2995B6D75BA611AB, 0x19743712EFDBC907, 0xC786223FADF2C77B, 
-0x8AE90A74620E84C1, 0x6F76D5588FC7A52E, 0x20A03675C1426EC1, 0x4FC659236CCD, 
-0x1F88B2DEF253904B, 0xA6C31FCDB80A8CE2, 0x521693E8629C27BF, 0xD640986CA1684E0, 
-0x3250AFA4971BB2EA, 0x549433C4D8C4FC58, 0x6B1B7BDE050E77E4, 0x18A8A73D97C7B9B1, 
-0xCAA66A5CDA8A2304, 0x3FE9F534376A6A8E, 0x166403DB1C227070, 0x551A0EA5856E, 
-0x10E966844D0393A6, 0x96D1082667670C36, 0xCEB7CF91ADF49B9F, 0x474B9BC9AD11AF50, 
-0xF12FACD95E2C53CC, 0x8098FC4F95BCF115, 0x9E4ADB726E19DA42, 0x5357349E4B57EDBC, 
-0x952A214997A4C3C6, 0xD1B8510BF47AF6A4, 0x75F9018D2C482C4, 0x9940E0778E8, 
-0xB9849637EF066580, 0xC79A3FB17E9F2133, 0x64C004F51E9C2FE4, 0xCA44F08FA9DB4EE7, 
-0xFAF0B4EB78D1D16F, 0xD7CBE341F00854AB, 0xF17D9233C7ABC3F, 0xBCC9F1B469AFBE47, 
-0x523A9AE90E60F182, 0xE407E7201879159E, 0xC147177E7ED72019, 0x675298054CCF, 
-0xBFA2006BCB3F45EC, 0xF4C9BE22696B36C2, 0xD894B060029D862E, 0x1C76149DC2063B9C, 
-0x9DC75809F11E8278, 0xB9DC772D2166FA61, 0xDDE3B595D6BF6943, 0x1A5464F31763FDDC, 
-0x9F9440FECAC992F6, 0xD5BB9ADD9F9711D, 0xDDA117D6E40BF0A2, 0x5217D685F0A5, 
-0x367EF8082180B4E6, 0xC9047F8928728042, 0x3FA1B4CDAE0ABE44, 0xC235F0875A45D8B0, 
-0x21359226E8AD8872, 0x1739E5AF7339DD0A, 0xFDC2B88E18757CB1, 0xCE9C13FF6DDED1BE, 
-0x319F77884B0641A9, 0xE682F90CB560CC7F, 0xC20CDED246E9F630, 0x4589A35BA472, 
-0x618EB7B67FDE6F51, 0x33028CA49B50F58D, 0xE858ED5510A5B5C1, 0x5C1A2D9D79620CC2, 
-0x80917999452824A1, 0xBFCFD0C0D46A3743, 0x2018363457FBA8EE, 0x51C58F335062E8EF, 
-0x12C68C1C36D8A7CC, 0x2080DBB278D33819, 0x6D9018222B69DCFE, 0x5BF7327FAB0C, 
-0x183D507883C26C9D, 0x22B2CF27F807DFEA, 0xCAD22D24D0CA9723, 0x4D6A18C36A205C9, 
-0x87EA2207382766EF, 0xE119FCC4FEE89F7B, 0xFA0FE46F5C88CA1, 0x1EB786CBED330A54, 
-0xB9570AB3847DC729, 0xD46D1A190D68077D, 0x3E4246CBCA1C5A50, 0x6097E6D8C3CF, 
-0x16DBC7D20F59C791, 0xD41632D3BE759D97, 0x37D60A0F4150C149, 0xD5CEA8DAA7D96DC6, 
-0xBD9AF786164CDD82, 0x1439DBB1167B5095, 0xC40F23C3887710E, 0x1EE2F72BB26E3314, 
-0xB172BC480FF07294, 0xDBE3E3071FDEDCED, 0x1F4E2293E71E5567, 0x601DCB28C076, 
-0xA1AA8CBAA6BB5B9B, 0xDE67E1C34B24ADAF, 0x4004EAD3D7D40669, 0xB2AB48719B9D3996, 
-0xEE478C3D74E74DB2, 0x81E1ABE45D24422A, 0x57A8018396CCA6F5, 0x4AB920885AF048C7, 
-0x708A1A7A6EF0B729, 0x36E8EFC3E1F8BCB5, 0xEF4BE895A61E97BA, 0x587752DF88A3, 
-0x889A7F95AE27F6D9, 0xB44554037D885BE9, 0x1506B1FBCFCF8A64, 0x4FC5D8210291525B, 
-0x64670F4D851F83AF, 0x729612E3A5370273, 0x55521BEC3CE5BBAD, 0x798C3CF566BB68AD, 
-0x38C94F355EA1DDF, 0x14D01C58EA3F724B, 0x564F6BCE9B13F96C, 0x1F60BC3D7A3B, 
-0x9B71432F4919681E, 0x72DA7088CCA736E9, 0xCAE3A3CB8582A016, 0x6AD51CC948630F93, 
-0x9175B733516108FA, 0xB9CF502E35FC45E, 0x16FE547B5D287ED0, 0xCA1CB302596FECDA, 
-0xAA22E77007E12097, 0x841180199D6ABEDE, 0xAFA33ACB7B949E28, 0x21E9545DC5BE, 
-0xE485ABA6049689F3, 0xF6C323D4A8C9FFE6, 0x7654433D6FA84261, 0x4C6E5A45C4A6A043, 
-0x816498A8AFE1F192, 0x64FF1C8E24B07E04, 0x42D9C27CCF0840E, 0x5EA9980E1DC8366D, 
-0xA4D1C344C2A8111C, 0x2694F0074D6BB35, 0x499A6129BFE549A2, 0x3B18E67F3B61, 
-0xE45C88A438795083, 0xF4B48355DA654A3E, 0xCCF4667BE98E7EB7, 0xB0AA6079885ACFD4, 
-0x36D85BE04DDEB451, 0xD1B9AA2DA148D7E0, 0x992F46174CF33B1A, 0x36D126335A029493, 
-0xE613A361461CEC5F, 0x1219B2A4194D6478, 0xF71A9E4B1929B20F, 0x437F8F97F07E, 
-0x826D7903D12678EC, 0x9392E29878746204, 0xD0B94885DAB04244, 0x5A7689812EEB2DCE, 
-0x2D2797E1E75A1E92, 0x2300154435CBEA31, 0xDA362ACC2E35CE30, 0xF1B1D08ABB84CE9D, 
-0x8B76A04D7962F93D, 0x4B3E141C619ACF03, 0xF83B7846839D99BA, 0x30A758A69025, 
-0xC6FBC4636E579369, 0xC0D12DF3A2BB59AC, 0x6436DA1A3BD68B84, 0x2182D355A8F0185D, 
-0x2474FF95276206EB, 0xB1E1CDB960724D9, 0xBFEF5937DF551119, 0x29A1BF06956386A9, 
-0x2BD3409D4A3AA5A5, 0x4779BFF73CF2AC28, 0xDFE118F73C0D0596, 0x476E4B957A9D, 
-0xF565970759DC0E70, 0x466D40FCA4427052, 0xA5EE0E71D0EA0524, 0x9F477D349F630D8A, 
-0x75CBC3A7EAE07755, 0xE87BAD07CAD85307, 0x284B951AE2B77094, 0xDD1ADD90C023F6F6, 
-0x219B385E4A6B7047, 0xE71DBE0BB3DF7216, 0x482F84ABD0AB3034, 0x44D8F7554D92, 
-0x6E4844B179378119, 0xA3A9D9834B2D6F4F, 0x9E21043BF99F492E, 0xFF7EBA32D48EA22A, 
-0xEC1366AD44D3076A, 0x91AF396A8A6691F8, 0xF4C126C9E9593A01, 0xE90487A7B4429B5D, 
-0x1D821F6EBD8DB16B, 0x2D0B0BB7218BE336, 0x985E9CFFA0E2E31, 0x67D57D782963, 
-0x62AD5C2BFB60F8C8, 0x1D9953129F14125E, 0xA3C2712CCC8B8166, 0x80C5AA44DD304037, 
-0x30412192B87A6616, 0xB8BDD7C64A98D376, 0x58EBB549735BFFDF, 0xBA160F47B7588A3E, 
-0x40765E303CF18536, 0xFA651B09F9EFE51E, 0x154ABB83B563F0D, 0x3148321F0ED7, 
-0xE9A31B1838D4549A, 0xC60A792BB422DFA7, 0xEADF7E59324F24F9, 0xF5EF1A39F12F22A7, 
-0x135467FCA584959B, 0xE6235B8FAA7BBAB, 0x5ECDE2050D8080BE, 0xE127E470F9C37E6B, 
-0xF2ADC88FF4E1B5EC, 0xC5CB551670E175E9, 0x13E205B801C1AE20, 0x48ACE411AFE0, 
-0xE1FDDA666A1AD566, 0x94EB2ADD5135D1A, 0x37D7A0DEC4955BC8, 0x15326BD8D94B8E0, 
-0xEE545D3CBB4FEB33, 0x996DE2CB1F0DDA93, 0xCD75AAE58D6C4B0A, 0x3E811D2228503A59, 
-0x5030BCB530FFF482, 0x5455DE3811C8F9C3, 0x2A39313835187919, 0x2FA4C782C411, 
-0xC76A9863F38BB4F5, 0xE7287575AD6283BB, 0x8B6CA3A1E82F2EFC, 0x1DFB9D65720B6CDD, 
-0x986AC04972BE4CCA, 0x74C369A1A8CF095C, 0x3FB10EE29FC8EDB2, 0x7591918DB6EAA7B1, 
-0x4F9BD7CF71B80CF3, 0xF7FC35BE377B76B0, 0xF3C4AEB5D4EAAA6C, 0x49453F3E1EF5, 
-0x388D8738850208E2, 0xE9D245C96D57B65E, 0xE53231A5A0557DD9, 0x72780B7EDD1BA95F, 
-0x1B64ADD717B53975, 0x257F97C883DBA5FE, 0xCF506F5D3B2469F1, 0x7ADBEA416A82CF1, 
-0x3F59B81DB8259A43, 0x3CE108AB063BD530, 0x577E60E96524D221, 0x69CAF3E115FB, 
-0x80024843786BC45C, 0x24914B732F0AA94E, 0x24CB9652014DC6D7, 0xFEBE0A18A98E3FAE, 
-0xB097D8D2DE7E3A7E, 0x155883E6F900681B, 0x95B53681F0E1AB0, 0xBE2173804DC5F290, 
-0x1BE70DFBD4AAEF4D, 0x9E1210A45293AD68, 0xC417CBE9EA6BA0B1, 0x5E8F2B834E9D, 
-0xFC6705E5A7DD41D3, 0x977C5CBA53285195, 0xACDEB86620E41CF3, 0x701520FFF42E7321, 
-0xACE96BAC8C70D61A, 0x4292F2E4571B53D5, 0x4D6A67C313E2F7E9, 0xCD27A573799E3C98, 
-0x19ABDF5A79323B48, 0xA448A097BCE77C2E, 0x3897E3966F350B9C, 0x48E74DE5CD74, 
-0x5CCF93D1644DC7CB, 0x1AC378D2054DAF18, 0xE132D22959638C0D, 0x40BAC30FFD520309, 
-0x54D8C1B4958ECB31, 0x3CC6CEADBF2D150F, 0x8E498515605F47D0, 0xA309E2EAA6CA2D5E, 
-0x25E0F0403AD9EBFD, 0x6B244EABEF6997A6, 0x59C096611B669ABC, 0xCE54C56F345, 
-0x57335B8BAECD6682, 0x7EF769D25D05CEAA, 0x98A96135DE579E96, 0x571A91B9C207D645, 
-0x2CAB163C5004C6E, 0x2DC6FBFD3D46B9B8, 0x4A2CD4C4B40B880D, 0x6D2E56277BA4A478, 
-0xD173AA3D7E76E332, 0xDE30F97AA1FD8581, 0xA045260AF2518B4C, 0x36654311DFF5, 
-0xF7A56F6E6C84DBE9, 0x5381B059D6798409, 0xE1B55918A7CCD242, 0x862A0658309C0A6A, 
-0xFD8E4A47EEE8C621, 0x6F89FB83A25E7647, 0xB98DCDA08ECE3100, 0x1A17D5973D208825, 
-0xE65CED7322BD1D72, 0xE8F29CE0AEAFD9AE, 0x891838BCDF64839E, 0x2D24C4944D46, 
-0xA0618AEE7EE17CAB, 0x3F91E301C524F9D3, 0x8C34F885B11D1A81, 0xC2FCC7F714694ADA, 
-0x70474BF7E36647C8, 0x2B4D833F8715E7D0, 0x12720B131AA80D3, 0x889849DF3A337F72, 
-0xFD50B313921DA52E, 0xC4033AF162308BFB, 0x999140ADEDD09AB, 0x4236BC1CE727, 
-0xF469D31B0E2C4BC7, 0xA5911488545945DF, 0xA52C30A3E556FEFF, 0x2F968A838C735383, 
-0x973D27D9E9B8D7AB, 0x3C810A46CC6A4DEE, 0x39508EF6E5CCFC33, 0x93D3DD2D2EA8A5CD, 
-0x8771F7C4D31F2C51, 0x36502FD21C7BF35B, 0xB48B1A8BDD6BD694, 0x6E1507802565, 
-0xF03843FAF3607DDD, 0x85C4F8FE3CFE0E54, 0xDF0052B75CD73A00, 0x833C7B4DD707464A, 
-0x7E5E0DED5CBD2BD4, 0xAA10A29985AABF7D, 0x24B2F6A38B84FCC5, 0x24DADCE6BA545B0, 
-0xB7A82F8D60C739CD, 0x7BEF0AD85C3C10B0, 0x40182192E5039C65, 0x14EA2E11A0A6, 
-0x8E6450E0C6866A28, 0x8B015F791E7DDF61, 0x8E7AA0BF850C05F0, 0x11CE2090B3D5445F, 
-0xED5CD9E99B470EA6, 0x6FDCAAA3CC31413E, 0xF559A66E6CF9E81F, 0x198BA92FA2BB393E, 
-0xA229C28B720C39D3, 0xCF874871C031E44E, 0xDAAF30062A2B16C8, 0x4788CF58BD70, 
-0xE32685E7A2244A0C, 0xE1683A209A64BFE1, 0x6C28461AA5F9DC56, 0xCFD9EB0684F15F8A, 
-0xFE2FC61A365A0E4D, 0x76E53F99AE6F40CC, 0xFE79B2BFB3A0D68F, 0xCB7B4C12A4FF26A0, 
-0xB15C80E4499985B2, 0x7CB8DA96F13D0CD5, 0xBD9EEA5B633590DC, 0x449B29040B5E, 
-0x4D94C327BB492327, 0x5BE9E5DDD62318B7, 0x7AF58811897B2600, 0xD64E76D15823CEC8, 
-0xB73CFFDF2D95A814, 0xCF760E38DFFB9E20, 0x44AC37EBF33BD2B0, 0xF83E6521ADC5F085, 
-0x6935FF1B13F31D4B, 0x578B7E92D9011E37, 0xEA0DE1E37B42A4C3, 0x1D99C576909C, 
-0x99723D096FCF05D7, 0xDE7CFE5BC89209C1, 0xF9E7ACFE3F81FF9F, 0xC1F4687F59D5567, 
-0x1FA50E4730B7B8A3, 0xE192246165222C6C, 0x1A812AA38D451395, 0x257E39D0850856F3, 
-0x993253FC497499F1, 0x62B9363AEEBB60EF, 0xEFD4147BE3E97B55, 0x6F058E13F6D6, 
-0xC72FAA54C89C4551, 0xDF1D4935E9B66504, 0x189041DE9E1FAF32, 0x3AAB6958566F582, 
-0x1658478B7C6E4B73, 0x9548305B085C9990, 0xFB55ED9171998CB, 0x14FB76FFACD529BF, 
-0xB75389E1272BA8E1, 0x753D95A913CE3C87, 0xB6B5661A59B860EC, 0x625D2AC6ABDD, 
-0xB46F121F6E04DF7C, 0x2D5ED7D036244DEF, 0x7B9896A9E3533C52, 0x808792529B819B5C, 
-0x37D896D16FE8598D, 0xEDB2E299EFA35AB7, 0x1DF83C16BB3EC0C0, 0xC71FC61B6756383F, 
-0x791A23359A83BDB2, 0xE9053BE763913E9B, 0xD08B7DA6EE2FC73A, 0x5BA99B347A0D, 
-0x3147E933DC5FA4C2, 0xA23949D9253B6B23, 0x5E9C8FA19625A8EF, 0x63C7237761771039, 
-0x6D1B9DB9DF029E2A, 0xA4C1739E37EFFDB9, 0xD31E77ACE25FF618, 0x446881AF5AFC9854, 
-0x57EEAC3E8C17D5AA, 0xC8FA13AC4D9CC24C, 0x76B876E22D10EE10, 0x22CA45835656, 
-0xA0C06EC31D5432E4, 0x7401964CA3CE851F, 0xC99374AF47C9B3B7, 0xEB9112E614544C8B, 
-0xF0D01CA22B985F8B, 0x786DF47971C71686, 0xD5B347AA3C0BFA0A, 0x9AB9D34675B7F1A6, 
-0x431175188D906C8D, 0x70B35CD3E462F29C, 0x10096E42DB81F972, 0x79944D8F9AF, 
-0x16605595A1011F85, 0xA2507FB59A766C3B, 0x7DDE7423747271BC, 0x186319FD2C90E013, 
-0xC05F0A0CEABA3742, 0xFA183410A6894181, 0xDA486977921C0C12, 0xDAC5A759446AFBD3, 
-0xDCA232A74F479A1A, 0x8CEEB6784D1258B3, 0x2950893294682F43, 0x5EE84018DC4A, 
-0x2D10555735206449, 0x1E66C55358E3ADC3, 0x67528F82B03E2BA9, 0x84FE2C464368788E, 
-0xDF27E8A20263AD77, 0x41BD9082A42974CE, 0xCDC2D10ED107637D, 0xA57E5154A3CA08CE, 
-0xE88101EB015D469A, 0xFAEE61472EF0B9B1, 0x7593D6FB56CD56D8, 0xD3FE67DFDBE, 
-0x94AD828A6E9A016F, 0xF6B91A5108412AD8, 0xA8A88C7B5916A75F, 0xB6E182F9ADE203FE, 
-0x37DE2409DFDA74C6, 0xC036FA78BF2AD40F, 0x81C87A0D20C334A0, 0x528A19D8A604AA3E, 
-0x9CA476B8963A812C, 0x18F59DF594CE9001, 0x8EC4E72A1663144, 0x6D5EDEDA6FAE, 
-0x46F200E0246F3FD0, 0xDEB9A4ACB8AB7F13, 0x4A377C5DAB9DCD5, 0x377722C84B5EF269, 
-0xE10E27182C1099C7, 0xAC318DC37596B3E8, 0x785F9E4A092CE7CE, 0x99584781C46F6529, 
-0x6D6C3AF53EEA29C3, 0x1FE2169F4A7EBCD3, 0x9749ACC0782C9F52, 0x6BCE55E477B9, 
-0x12553BE5375D5DB9, 0x688BCEE81EDA1C6F, 0xDCB099FD5DF47B55, 0xA073F341874EFEEC, 
-0x8CA3EB93132DD05, 0xE61D69889057F83C, 0x996C57E1FDD86671, 0x9FA0EFBCD1CF541, 
-0x103431A9EC17D096, 0xE1D1279992FA444, 0x275D05AEE2E0B5C6, 0x4D96DCF9D71E, 
-0x528FA3F68D1D608, 0xF670EE609772A7E, 0x167AA21106E75583, 0x25AD3FBB8FE0B8F6, 
-0xE20961E17ECF7AC, 0xC4D12A29D3D18F34, 0x674AA31E084A60B9, 0x30A3F84F8F6D49FB, 
-0x6925565B1CC29CB3, 0xE192421109086AB2, 0xCB800731C42E2572, 0x4E33BAE6BBE7, 
-0x5BF3E9D567C74EBB, 0xAA81D0032983EE62, 0xEBF73BAEC2C8E94C, 0xBA32F73697B90C78, 
-0xE9502FCF3592EA1E, 0xB94E6DD8223DAB52, 0x458C6EC7D50A3EA9, 0x1AF54D7D4C8E7C25, 
-0x349B4D3FF2B414D8, 0xCEFA603F5EA69D6A, 0xAAD52ABAD48946C9, 0x2190C210F91D, 
-0xA5691750BF239027, 0x1A37B192FD45ED3E, 0x94BC7EEB5DAD9C74, 0xDF9DF488227F63BA, 
-0xEDEE50841613E638, 0xA75084915942A8E4, 0x305434805ADCE5E6, 0x342691B14E992488, 
-0xF763070A5A43C387, 0x1BDE96E50DD1908F, 0x1CE80B63232525BD, 0x4B69FEDE7A5B, 
-0x109CFB8A345F51BF, 0x7AEF2567593637F9, 0x8814BF64C37146, 0x5CD8BFE4D9DD9E5D, 
-0x40624402F9E3F845, 0xE7F77EA7F0BC7678, 0xC7B39B3B166C5435, 0xD0ED56A5D6C7D720, 
-0xB0D98A0EAC72E9DE, 0xCFB890CACFD0F3F5, 0xE8363EBD50687EEF, 0x2C7DB134DF27, 
-0xFC23A65960CE1542, 0xF3A2B11F452D4B4E, 0x2E1E8B71CDF054FC, 0x99445C307DEE8F38, 
-0xD8D63C016402490C, 0xC34909310A123510, 0xB4E241ECAB20569C, 0x7E33F9C0ED332D1E, 
-0xD1DE5AE4EBCB8D31, 0x5FDB43391734F936, 0x915BF194FC12C04A, 0x3F5D56F77B88, 
-0xE5BB4E08B91800AE, 0xC043C6AF53D0B478, 0x1110CA9FB5CED449, 0xF6992061AD5F5993, 
-0x93011DDC81C86B4A, 0x1E417209705B7B4F, 0xA5D4A5833CAF1AE2, 0x4C7FC8403E13FC2C, 
-0xA900BD3BBF6C81C5, 0xAABE830A037E3841, 0x8DBAFCA0F48BECAD, 0x6E8BDDD541B0, 
-0x20AE865DA336A99F, 0x87071656ECD684F2, 0x96DD4A4FFC3556E1, 0x571E2360B90C89D8, 
-0x394B8B2D7D0A3526, 0x22069651C7CB4F01, 0x13F0051567B5C89C, 0x7F193043BDC34DAF, 
-0x18440DEA31172EC8, 0x4DD945BFF679AE29, 0x217524D864A216C3, 0xBB95260EF08, 
-0xA4CE65742B325304, 0x16095DA491A3533D, 0xF8287781DDEB212, 0xA9E8C22534CE82C3, 
-0x46B81A3500E7523A, 0xD36DD3086EA30D86, 0xE084EFA27A9FF872, 0x4828A080B98FD4B1, 
-0xE5D706F3D44D15BB, 0x8B10D08CE3F102C, 0xB3EC23FAAD62171D, 0x46939E2D9C9C, 
-0x681A61C513BEFF9F, 0xBD7C022B128EBBB4, 0xAF6A6B99A442022, 0x680FBFE8A9166420, 
-0xE498AEECAD87C5F, 0x32B78B40F93817F1, 0xEEABFDFBEC67DA8D, 0x285740440B17E037, 
-0x7BBEE212D7375E30, 0x6E790CE25744449F, 0x1956432ACB685A8F, 0x528780530AA6, 
-0x9B7FE2B557A17EB4, 0x6E1E2E8A2C63B712, 0xB73F25E43D852D22, 0x30BDFAB411114593, 
-0x22B05D2DE9629E65, 0x7169BCD378C60FB, 0x7FDF33893F0E9202, 0x73C68839254987F1, 
-0xD66D9409DECAC78F, 0x49DBBF9A1FA7D8C6, 0x6B664CB8F31F41BD, 0x28C082800BC9, 
-0x3F4E18FCE5D43D92, 0xD87DF45521BCB036, 0x2E36AC05D57E8414, 0xB0DE0118B51ED28F, 
-0x69569D2DAA87AC7B, 0xE822AD2D96817C8C, 0x7E846A4E60B9C8B5, 0x890B906C43B26D5, 
-0xEFFFDFC38CE7BCED, 0x9E2B13FB46722E09, 0x2779709F09082B41, 0x1D1848C0DAA9, 
-0xF6A3629EB5BE238A, 0x89F2AEEEEB56B0F7, 0xD135C7ACE458E9FB, 0x607703C4E1FCC1AA, 
-0x322E4EF5FF726F1F, 0x64571111D23A88DF, 0x391FC4A448B02B35, 0x218A77DC850DEAC6, 
-0x24C821855B5F2AA1, 0xCCE158334E8B5C16, 0xF56A12038F7586D8, 0x6F734202800B, 
-0x13454C7F22FC7F48, 0x8A4645549FB38B26, 0x1FAEAB25C55A5707, 0xDE97240EE52B45D6, 
-0xCA8E015A1CE99E08, 0x14CA1E3F942C41E, 0x20BB689BD2C2734E, 0xEE2B4E097662D5B1, 
-0x7F2E3838593F7785, 0x432AC5B16494E42A, 0xBA84983045379ED8, 0x2CB22AD18FAD, 
-0x5135278DB9684382, 0xB1802980968AB42, 0x9B2E0CF205D233D3, 0xD350E1C00A4F0255, 
-0xCD0C2706BCC651A7, 0xAF43103C7EA6482E, 0xED79F0D98CFB1D42, 0xCABB8E9E4B57F2D5, 
-0xD5688BE3CD27DD2F, 0x78C6FEC48031E449, 0x3667158C5A1F8A25, 0x499E92951984, 
-0x5635CC0F335F1825, 0xE5AD34252E886CE4, 0x7F49B7DEDDF36B96, 0x30808BE25E9A0034, 
-0xD92855A1339862E1, 0x9EEA63395066EF68, 0x953CD51EC2CF85A5, 0xE4D532B94C1A5F0C, 
-0xC22E20B6D3DB81D5, 0xBD14AF77BDEA8DB1, 0xD880ED26EA3AC2D6, 0x49939DA51604, 
-0x93514E77EC8EACC6, 0xB13415F8C6ACA8F9, 0x31B4849529BC8168, 0x71FABB85D0501031, 
-0x11E07060F9C4C8, 0x77E29C12DA9F5768, 0xD64813789B4B5DC3, 0x41A3125F4F7A2353, 
-0x6F0174A67B1B1140, 0xBF3442EBADC59318, 0x2639612DEE0B5C98, 0x4E51A4DD169A, 
-0x4B6206BDF9938F02, 0x95939C66BB4AA091, 0xD9E1DBE1D2263C35, 0x835CC136A1982D49, 
-0x3A37DDD4449DCA81, 0xC5204F7819AF3F65, 0x28AF9516FB96EA7E, 0x45DB72D48E4B2AE8, 
-0x5D7E73398862E7B1, 0x3CBFC34CAEEE0657, 0xA6B3279F642D3CF3, 0x3586BB8F4051, 
-0x7C7BC7CFE65830E4, 0xA7C23A57F4339F57, 0xE09C94364053FB86, 0x5F24CECDDFEEEB5, 
-0xBE482DA45FC867B6, 0x89920D01564E77D7, 0x1EEE87514C00BDA7, 0x2631B113BF9F09F8, 
-0xB3F0B5BDF8E96FB6, 0xF998AA628C0C2F1E, 0xB593DF5BB76C0354, 0x65E168215E9B, 
-0x22526054AAA9FBE1, 0x2E91FEBDEBBD90C1, 0x4307BDB3173F2F10, 0x7712E7CF4836F81B, 
-0x7611FED82DB3724, 0xEE0CA0C77272ED5D, 0xCC359B0EBE95B7A5, 0x148635DE83B73BE3, 
-0x34F689D40AE69AD7, 0xA626B58E531776F2, 0x66C9D2FE65B6F10F, 0x1C028CEEBBBA, 
-0x9F15D9F0D7D5DCF2, 0xF0559BD2143E3D56, 0xF1E6DA2D81C123E5, 0x8972E0D21830A70A, 
-0xBFE9B55BD54D1E37, 0x558E1F6C13E84109, 0x7268C6E6340B6908, 0x5C98A6A28B56C2FC, 
-0xDB0EC95892D1FCCD, 0x1A1ACF8C186F8078, 0x8E07963C3CF5DF4D, 0x6BAC287DBB3B, 
-0x4CB8336A1C3656D5, 0x5DE82FA5FCCB83F5, 0x286C8B1461FF3862, 0x1810F177EE0EE007, 
-0xF6110125B8CFEE0D, 0xE8D8734ECC60B146, 0x4167E9FA928A1D3A, 0xB971BE78149F1BF3, 
-0xD94CC5977EE713D9, 0xD8FEF1AC21444693, 0x7BC2319FD5AAF0B, 0x85068E86F22, 
-0x1683EB7947B71244, 0xAB09981CC0FEB0EE, 0xD03CFE1F8275A71C, 0x7095A6B29A63A83, 
-0xD6C79AB939D3D199, 0xB133515BA0BBEBAE, 0xA9B6FC986FAF4202, 0x361D18D6940A6727, 
-0x658617376FFC73EC, 0x2CCD41CC81710EDD, 0x96D9E5398118D954, 0x56CBB326ABF5, 
-0x8F62336ED4CCF82D, 0x93F194237FF75BFD, 0x139C9BEDAB7866AF, 0xF31EA626D65077F9, 
-0x6DD7700E495B19D4, 0x83D89A63768B151, 0xF900C46A88750838, 0x364ED2EB1F146821, 
-0x74D4669031265AB9, 0x1F8A7E2F6F7BD694, 0xF90A1C4353228353, 0x65A643380A7, 
-0xDE303F1122C3E060, 0xB26BA6DF641A6248, 0x706FD6DAD8C8CE15, 0x40DB1646EF58FC17, 
-0xF8BA447E475A826, 0x98EAEE998DA1530C, 0x45231B60EE3E3934, 0xACDA35538D11A74D, 
-0xC66ACBE3A8A44B2F, 0x54E29FC9853649B1, 0xBF7E596B0D5055BB, 0x1EA2C7027553, 
-0x9D8170D9B123A2AE, 0x2F83761B86F0D30E, 0xBCA49AEB11C1999C, 0xB16F6889B785843F, 
-0x53EA498392129F3D, 0xB824147AD31DA8A9, 0xC979B107ECCD463F, 0x2A649D0B726CDDCB, 
-0xE748CA28EA560FC8, 0x177DFB9E34872776, 0x34B89B7F7AAFF577, 0x47ECCE9A8D95, 
-0x41F7A30ABD8CDD1B, 0x49AAF75B0AE9B382, 0xEDE691C5C9B16E24, 0x6AE10094C78EECBA, 
-0x4E6D11D15741D4A1, 0xCFEA8C80777787F2, 0xE98A9541E9744CAE, 0x17742D7DA29ADFAE, 
-0xE88A9F131548B6E5, 0xFF2B1E1EBAD2D1FC, 0xFE936FCFEC3B21B2, 0x23E626197028, 
-0xB951BABD628387B7, 0x5A0EA41C07626379, 0x91DE98C87E39637A, 0x8EAE13C8099782F3, 
-0x46A1678B7613794C, 0x510BE4AE32644CDF, 0x3C70F532418256EC, 0xF2DAE45000DAE1BD, 
-0xD651CDC96EBA6985, 0x998451A7C9746979, 0xDC1F29DBF220A15A, 0x6D3C1E6BD63F, 
-0x6F9E90882DA57A3C, 0xCBAF3C94DA3B7511, 0xB2A9CB9E5E3F8EA, 0xA54D0ADD5E9659D2, 
-0x96C28D167CCEB121, 0x408459F11B7234ED, 0xFAB2B47BC4DE2FAB, 0xBD1B1093AE1BD1D1, 
-0x8AA8FE7395652421, 0xE285DB03FF1E96AB, 0x39A8DD350A1913F8, 0x660E1A4CAF3D, 
-0xC667DF54A043F566, 0x817E88E3FBCF391D, 0x10C407EA6ACD4AB6, 0x3804B3944718C90D, 
-0xF3DB1C501D531D35, 0xFA562BD126A70EE5, 0x59C26414A7D2D878, 0xEBD6649A5B563F23, 
-0x73970EFDA9C1F221, 0x88806634093B0078, 0x1B884FD7DDA6B21A, 0x6C0A6065518A, 
-0x2468DE1C96BADC49, 0x9A9CB3752F2DA675, 0x2199517AE17EDFA4, 0xE89B750B41637C1F, 
-0x4820BD686E3597F9, 0x72C10C28C2A0C509, 0xA7A7EF29B78759DE, 0x407573E091310234, 
-0x9A757658323F5AEA, 0x7AFA6CF8A7206E89, 0x7A9E6771418791C, 0x30C478B148E1, 
-0xFBF8667C2E0DAC87, 0xCC981EACB39D1175, 0x94120C02CEF4877, 0x765AF62488FDAF3B, 
-0xF27C29343B643B3C, 0x8AD13FF0D3357830, 0xCB430D6974EBA289, 0xB17A59A250BB6222, 
-0xB1E6130882DB9506, 0xD1E5D30A183110DB, 0x70A6D005E3A94F1C, 0x79F95E655E6, 
-0x225F3CF43A23EF8, 0x9658A94F7B1F3F7C, 0x8F08AD6AE9087A64, 0x306CDAE39D997CF7, 
-0x83CB39154F8DA8F2, 0x845322BA7B1E09A9, 0xBF3FC9853D6D1DE0, 0xEA845B92B99265EF, 
-0xA67CA582A0330ECF, 0x721F6818EDE9C175, 0x953E90A283C00F93, 0x61CBBDC62E5C, 
-0xD2EA396B5F70D3C3, 0xA45852B1EA0606BE, 0xF4C2459F09C847AD, 0xC7FC2D905B2A9A4, 
-0xF60591A21D377B70, 0xF7EB075D80B4248F, 0x9C1B0C17E5278BD4, 0x17DFE85F52ADCCB9, 
-0x3DDF4296DFF78D94, 0xC0B74BAD8480A148, 0x138005788815C57E, 0x23D1BB4BC2E5, 
-0xD0B5213B1B76583B, 0x3152877D0CB20E10, 0x962187D20156D077, 0x8CE663589F8DC814, 
-0xDB84C9AA6FCDDEB2, 0x66680F65095F010F, 0xF4405D640F11B478, 0x3AC36E39A91A4048, 
-0xD937B87608A4849F, 0x5AC28EA20D39C4, 0xD4CB9C6E010A81C, 0x53449FBC3AFC, 
-0x28D24E019D25B94A, 0x53A2EE1EFC8E74F1, 0xADFE7E10BAE99EDA, 0xA47AF24A70770295, 
-0x63B01C832F7B74D4, 0x55ED6CE98F1B742E, 0x306F9F342460B598, 0x5FD6FB1AFE5AC124, 
-0xB3EE5D8CE2EF2044, 0xF7832141B15CCB7F, 0xD46D2FF765BA7C7A, 0x6AF71ACB9DE0, 
-0xDC661A229BBFE7F4, 0x87B28C09A0A9C544, 0x1FD12659ED51176D, 0x610B1C7A16F2C424, 
-0xD9644C7B89D51230, 0x4F0FE3C183A6142A, 0xC8DAF4E8CEB5EE80, 0xECACFF2C4945997E, 
-0x775147B9D9689316, 0x7F8B7F8FAE57AC5E, 0x1A924DEC83828804, 0x4D7AD0E0FB67, 
-0x9A6F6DFE40FF2A85, 0x11FFEC0CD78A8EB7, 0x774EC8297BAAA5DD, 0xEE6C5FCD1AD293DA, 
-0x464F0CE7CADBEF51, 0xF66CB4000956506B, 0x7F5C21613857E85D, 0x786D84E72AB2A8A1, 
-0x95DB81365784FF54, 0xBABA4D0D2AE40C66, 0xA905039DF9934C39, 0x1E7728243045, 
-0x75CB3E2D6E2C4B62, 0xD2A6BD230D795337, 0x2C6184A4373D24D2, 0x26A5EA3C37FF127, 
-0x3DC4C237E6D64B48, 0x6F9841E76DC499EA, 0x5314156F6BFAA571, 0x50A0EE7B0B352AD8, 
-0x9418E56408444A9E, 0x532BC2A5796B78EC, 0x6DC3D7548463E4AE, 0x55A06CE4BE76, 
-0x507740DD92938588, 0x6CF6C6D1B63D3599, 0xED71478BC5E03F7A, 0x9D8E6A10585DCFE4, 
-0xB187EEE3118EDFA4, 0x897D50A22B7A4F39, 0x7E5C1BFCA764AD7B, 0x2CA2C2DA62FEF264, 
-0x6FEC3F7453A8BBCE, 0x43C6B2717A2EF06F, 0x1F2FFD7CAB46C26D, 0x4C3E3AF20E32, 
-0xE9657DA68D389B58, 0x9F90054069AFF626, 0x2EE844698FEECD2C, 0xF3BA8888F213F9BA, 
-0xFDC48F8FE530C0BE, 0xE5B11F834959309A, 0x8578B27F741B57EE, 0xD65853C510E03668, 
-0x32D06B6016A962D2, 0xA77A59578E0C2DCA, 0x8942F650A5FFC1F3, 0x462F829CFB0E, 
-0x80A3506A7DBBA343, 0x3960E98E63528CC8, 0xCF21AEAFE6883CF0, 0x981BA72BAE4556D, 
-0x137A2BE009884A87, 0x411330CB53B73DFE, 0xB4F094924322E571, 0xAE31CBE7858B9632, 
-0x521DFC0066AC4303, 0x1E34BE2438417DB2, 0xC5ABEE937A09B28B, 0x49325647F425, 
-0x9A6117CB32F4F843, 0xC2860879CEEE07B8, 0xF65C3431A60A05B5, 0x53484135CEA2CC6, 
-0x5CA69929F8F997B0, 0xCD4513F60838F220, 0x7FD710D5021ADEA2, 0xAF9E079EF21274BF, 
-0x4E33449DA013491E, 0xB9D734D7164FC6A4, 0x5BE3AAC558893BE9, 0x1A378BFF8F48, 
-0x4B94085C331CC289, 0xBFD31190444C29F5, 0xF025FAA0C33A22B, 0x7492268E2A6ED602, 
-0xDB19ABD98560D1C3, 0x5B1ED52E54898935, 0x355591C570CBC2BC, 0x236E5071FEE0FB72, 
-0x9A3AF2CD642F8B5F, 0x906EA5FD484563AC, 0xF0C657EAD7E8467D, 0x36BD1B6BD768, 
-0x620451E69452E32E, 0xE60CC2F0BB97B63, 0xC9693F14515D56FE, 0x38C5BADA61B0C709, 
-0xCA81238F2790E38A, 0x1853979833F380A0, 0x26CB86A8DB1CECB6, 0xE0077522A93A93, 
-0x88D7C1D044913CA7, 0xEB58B9919FBB663E, 0x8DEA81AF81240EC7, 0x4D3289CCFB9D, 
-0x5E839FA031D7FB0C, 0x14778C77BC4E8A2C, 0x8D57E24CE2B08998, 0x759CEF8E8EA7FE24, 
-0xF4308DBCCCA6E35C, 0xE012FBA28B862D5C, 0x5C515BF8D4833588, 0x67D18D3FD2A3F688, 
-0xD1D10B589E5221F9, 0x8A93B9307ACF0CD1, 0x277AF332962C8357, 0x45D5D5C30EEA, 
-0xD21B06D90B2E0D24, 0x9C397A8D035A777A, 0x8D70D998EEC5CCC9, 0xFBA5B0FF4FCF5EF1, 
-0x889B82E33A1C3E92, 0x21EE9B1BB78DC566, 0xF832A08E9FC91679, 0x17D32485C1458099, 
-0x6CF04FBBB13CC041, 0x5604C945377B015A, 0x4817B91BB11917B2, 0x3497A996C717, 
-0x2921085135205F19, 0x12C2059AC3EEE87A, 0xA96A82B24BB94C89, 0xB42E2C392213FF7, 
-0xAB09FF260F6B897B, 0x47E7693853628F3D, 0x378BF8B8897215EF, 0x483F8B8461FB0ACF, 
-0xB1A400D3729DD7CA, 0x75EEF48DF78766AD, 0xB0A09FE6800B20D, 0x1E6224C3F6E0, 
-0x22A2CC145BE824E8, 0x7C4633BD970ED99D, 0x1150EE18DE12127E, 0x6BEAA8C2DAC97DA0, 
-0x695C8A94A792BFF1, 0xE47E288C915B713C, 0xEBC5E720AA5AB674, 0xFC416521359F3B0F, 
-0xACC504ECBAFF9C3E, 0xF78ADF08E623CC2E, 0xD4EF93F5455F5486, 0x65EB9CBEF7C8, 
-0x9B98728CE5F2BE8E, 0xCA0A29F17BE305F2, 0xBFB86AE91B81A3E0, 0x2A22BDBF4CB9C5A7, 
-0x2C917B1D9497BBEE, 0x508353BD754AA252, 0x84FFC69DB3929CD9, 0x7DFDCC9710D69B0, 
-0xFE7FA64B175B1FFD, 0x5890307EE25C879, 0xC1025495FA898690, 0x3A8AB013D88F, 
-0x13AE39305A06A4A, 0xF56A377DB6E58226, 0xCB631E636831736, 0xB39FCC7FB7818D74, 
-0x73E5566BBDB88630, 0xA117AC4E057A969C, 0x2D1B9240D69FB7B3, 0xB4B3369D57AEB6FD, 
-0xC2D9F075D4A0E325, 0xEB1994394FBFDAF1, 0xEF344249D097E7E, 0x20D33ADB083E, 
-0x8F5772D93F4E550E, 0x1190522BFD8BE1D4, 0xA628406D898F4F13, 0xCC02153B386E2C17, 
-0xA54C121F9909A6AF, 0x9744CC14057C55E9, 0xA5C2E330BFFF65BF, 0x7059318DB17DB8D2, 
-0xA5A9F7C454DAD357, 0x692E1D2ED2807FF5, 0xCB2B80A8EFF897CC, 0x6D5D941BB528, 
-0x60160EC114EAEEA, 0x5534870570D98088, 0xCBE4CF772EC02675, 0xF0000A69E0357F0E, 
-0x55314BFA4E330C5B, 0x1BC8BE3013E125E8, 0x6E67805FB310D460, 0x972BA3171D35A153, 
-0xA7A414CB9905EA48, 0x568BA1BE977F68A7, 0x3459FC4AD4D9975, 0x53DA8AD445E1, 
-0x8D093CBAFA0651C, 0xA88F51AAA2E71643, 0x80DE4AC3EA4328F5, 0x61D876F7E0EFF48B, 
-0xC9BC87D5DCFD7B4A, 0x666D254F57BC1EC, 0xD2020FFD4442741E, 0xD8ED37A713F930EE, 
-0x105B4E16B08A8592, 0xFA3D3DBB98230925, 0x23BE51E89726ECED, 0x22C918C67B01, 
-0xA48A6AC341B381C, 0xC96E366BC890D51C, 0x8BD403EAE568EA4C, 0x5D4AE185C33D5A2E, 
-0xCE30589F3871872B, 0xFCB0FC48C7F52E0E, 0x6FD45C1B22D8260, 0xC541DC18C35AE378, 
-0x633110EB29EA216F, 0x14C05851A423B849, 0xB8B3685D75E6CD18, 0x37EA7661D871, 
-0x966A34FB45867960, 0xFF39043E0417B89C, 0x7B1782A94C4AE8AF, 0x30A55A9F85DE4F21, 
-0x8E419E07D75952F5, 0x5108F9E0905F9A2A, 0x7E6C41BE2F286264, 0x200405D894523922, 
-0xE268DF9BF00F643, 0x99C20E72C3724B8B, 0xF6D4094756EB896, 0xDA216C74FF3, 
-0xFF85533DF5B18804, 0x5372B3AD18C107EE, 0x25E40C2BA2A6CB6, 0x1845E1677F1760A3, 
-0xA08A8F8CA602CF1A, 0x1B0199DD016DA36, 0xD29B8950F08B3399, 0x49FF2DEB94309008, 
-0xE84EC3178A005DBD, 0x12CE02D2F12B82D5, 0x19BD26774426DABE, 0x561C80346435, 
-0x4E422FE03B4B715E, 0x11A8AECD5DA2C129, 0x5AF291F4EC7F4CFF, 0x17D7305B30860E6, 
-0x1C8A70DA0306F6C4, 0x6101AA8407D48770, 0x68D94B497B13CCC5, 0x9B0C4544AD2D84EE, 
-0x16C591AE6C80F0B4, 0x70A56C18AE03B0B9, 0xEAFE88F5CC169A5F, 0x1A6B1AEE77E0, 
-0xCC1A4BA6F24234BF, 0xAF5EC59BBDAFBD45, 0x47B3AE83F98F022D, 0x9C1790F24047534A, 
-0x95942CBEEAF358EE, 0xF0598456FD6EB0B4, 0xA6AB08819C1EA32C, 0x378585D61B3F8CC0, 
-0x4B10F43115CBD9F9, 0x8FF167438E3E5783, 0x5FD6E2E7102CFFDC, 0x4A4C44971B0E, 
-0x9E37B1B9C308F65C, 0xF2E10D89BDE15D54, 0xB22F6AD556005A32, 0x793E7CB49DD2186B, 
-0x8A6773A9C1BEEF2F, 0xA01A1D03D610C410, 0x260EC9199081D14D, 0xEE35F8546673AC13, 
-0x6E7321F24C594C92, 0xA3E5C56AFC13083A, 0x6DA9FC1BE0FF395A, 0x2D7E301EA922, 
-0xAF862E67B9373B81, 0x49B5A5C90968FF04, 0xC7852FF0289FC375, 0x1443562B148392B2, 
-0x4F0A28E336FECE33, 0xFECA33DBA486B4DC, 0x4BE1844DFF0920AC, 0x799190FEE959726, 
-0x65416F534132F3D3, 0xB6DF101C3ED8411C, 0xCBAF6149B5DC9BF2, 0xFF23F15F7C, 
-0x6C29E16C7969E08D, 0x1CBB0200832C4D9E, 0xE1AD51C2B36233F9, 0x403949AE35920EF2, 
-0x242503792CEDD343, 0xF9402FA0D7F28D88, 0x73B98E23B7977B1F, 0xE11159DB3D0F0983, 
-0xE74094883E00C0AD, 0x6BC6C07F2381508E, 0x19122ED24434468E, 0x5A6DBA591188, 
-0xD6ABA74C0F3672E5, 0xC0BCC84016602921, 0x2630B8C17E776EE5, 0x8C56F30D06D09DA0, 
-0xDE71ADE0C1A80AA7, 0xEBE6ED0C590F58F4, 0x633911EEF712A20B, 0x641B06BC83BCAAFC, 
-0x161E16686A2DABAA, 0x28561C33ED72B93B, 0xB53067AA83C8DA92, 0x6E789899A979, 
-0xC617254C5937FCB, 0xD15475AB86FA8202, 0xB85557025F734016, 0xD209712DC51980E6, 
-0x3B1CE6319F863657, 0x9EA3B37F9F8DB63C, 0xCEF58A37E2B71F67, 0x53B1FE848F737B9C, 
-0xFDC491D6B4F1A142, 0x6D8B3EFF8AB72A8B, 0x3A1EC11EFE0BF1F6, 0x159E7CB4676C, 
-0xCF972F2F7F35B153, 0x861BC41BB5C0CCE4, 0x471A7EC00C175249, 0x230D3D08CDC293B, 
-0xF6072B239D4752EF, 0x21323E3D0F18A3A9, 0xC90765324089556F, 0xE34022B8676185EF, 
-0x3B7CD564B39232A, 0x323B4D59BC579CD7, 0x8132E2769D50FE10, 0x1678603A978B, 
-0xBE811C6E0DA09967, 0x13ABD8F227DA4E11, 0x5063E95B9826955F, 0x5A6CB117BAA15E2F, 
-0x52FC0A9ABB208483, 0xF89D0AFE7D6E9288, 0x774720E6EDC63E28, 0xDEEBD7B6C892F8CF, 
-0x4E3C5EC279454ED, 0xFB17B683A2A65141, 0xFDD31EE266FB10FD, 0x2160EA24A151, 
-0xBCE5EDD2870B624C, 0x34469AC02F1620F5, 0xEB88E228D488F387, 0xC575C1BA868F10E, 
-0xDB7F41EFFC04A172, 0x2C8D3E301733036, 0x38E040602CF704B0, 0x9CB34F1F10BCDCC5, 
-0xC9EC766DCDEC82A9, 0xC454D5EE3B8409CC, 0xEA69C43B61162038, 0x26D78E11177D, 
-0xA1534BACE373A74F, 0x63FD6E475790E194, 0x8E08CC6ABE692DAB, 0x304E335CC397E6D8, 
-0x77D717EFAF5F71C3, 0x1B800385EF02B968, 0x140626462D78E56D, 0xDD22B026F9151049, 
-0x519909C4F501D806, 0x52067E1A2093BD4, 0xE73FFBA2E51C96E0, 0x48E7ABE91812, 
-0x198AB77832644476, 0x473A693D6F4ADEAC, 0x772CA0336371F1EA, 0x326A9F3CD573E6B1, 
-0xBDDCD844095149AF, 0xFE504D606B708F7E, 0x85A77BF3F0DD47A7, 0xC0405916F1C43092, 
-0x168AE5204EDF95FC, 0xBA0E604A8D99F0B8, 0x7503F04D65D0F3F3, 0x4FA9E7D72B4D, 
-0x806A0891EAF4A208, 0xA33A7328A6DBA9C1, 0xED64FAC375CAA3E, 0x8C23C6C78AAA95BD, 
-0xD8C45C636168B223, 0x4BBF89173A70406C, 0xD500F049470D3869, 0x82349261334618E0, 
-0x73206A68F63BD59E, 0x8664E0A42E199319, 0x7A6ED7963ABA0EC4, 0x6670879CFDEC, 
-0x29A88CD4FBF152C, 0x45E71B7D4ACE6F0, 0xA2F15283B55F58E3, 0xA739FEECE34A6E33, 
-0x89602FE2604ECB56, 0x797C1B9028E4013C, 0xA40B3ADA649D34ED, 0x8A6C51A3C19784A7, 
-0xF66F758AF77B8A1B, 0x7F5EB20C6C6D3460, 0xF21849F67EBB0CA7, 0x69B7E78734B2, 
-0xA25A62D6F5E51580, 0x7F9ED68483AEEB5C, 0x2AE141D19CD43653, 0x3B092FE4957CD445, 
-0xFFBF0B3CF2317A5A, 0xF238A16FCEE24E97, 0x1EE88CBE98F30666, 0xBA53C1F7D0427E6, 
-0xAD2E7E5255C06B8A, 0x69C979894E257EE3, 0xCE409D267A4EDD50, 0x2A9D9131C747, 
-0x51B5C313AF869B2, 0xA36660C989F6F6B6, 0xCB8328FC99633D51, 0x7FC61A8624A77D09, 
-0x64209CC0CCB6E16B, 0x37B1B477A6998BD8, 0x73399E5682349E1B, 0x1CF6A7FD80EB7117, 
-0x3BD9E81E368E7AF1, 0xACCDE2984001AF13, 0xFB5A7EE6178C409F, 0x4C5EC3714EAC, 
-0x32AD7003349F9764, 0xEEF3774C81BC3327, 0x99C944BC6A186473, 0x7F75CA2771394483, 
-0xE198ED5BA38FE62A, 0xACC201EC695D74CF, 0x2FE6C501E58D1E4A, 0xE918DD309132AD02, 
-0x664D68FC3347045C, 0xCFE41ADE725907D3, 0xEAB73A1D8EAB9435, 0x63896B2C698, 
-0x560A137A148DAC18, 0x180681B2212F9FA2, 0x4C680B32ED82C4C7, 0xED8A0A1ABEE3C4F0, 
-0x2B6214DEA7D9AD34, 0xDBD90EC418AC3A21, 0x23AB5F507BD5AC97, 0x13AF55F72253AB7, 
-0x4850B74F5338459A, 0x3D5258A34586D21B, 0x427FE07D04E3C951, 0x4E19270AD6B3, 
-0x422AAA181324C0B9, 0xD71C0BD3518647C5, 0xFA716E818F2CA599, 0x29D8373346318FD3, 
-0xB50DBDD449E20D00, 0xE62061BA5C51BC3E, 0x2F0FD22B119AAB3, 0xCA2A622612C3DAEB, 
-0x969C58FBD18D681B, 0xAA25F05026F8D2A1, 0x88565F4659612AC4, 0x3DEEF7BDB359, 
-0x7A2D050882DC3C26, 0xAE82FA22D7FAFACB, 0xB1F80F4B24DD0101, 0xB1D1D35931328A5A, 
-0xD62BC31697B8BBD1, 0xE0A4D93FE7021160, 0xB7896CC0F864040E, 0x375CAA7EEEC0423E, 
-0x910E6982B39D658F, 0xEB85774712AFA6E9, 0x1C5F8C4F4EA69FE8, 0x5AF298386624, 
-0x736C97D8F09ED40F, 0xC91FB81F10D6311F, 0x77BCF2B240269CA6, 0xE82341EBA2AFEE7D, 
-0x4A90A197CAC48912, 0x8464DD0AF554B996, 0x7EE423C75F3EB5B7, 0x1B9052E7A072FB5C, 
-0x52853530E1B44CAE, 0x81E0584418E56D22, 0x15946FF5F172AA05, 0x591C26C96C02, 
-0xA0E2B8325AC7F7D8, 0x19A354A7D628F1B4, 0x4077CFB80CD43C61, 0xD2AF57F74DEE6DF0, 
-0x83B8E01E7830E4E4, 0xD6E727BE3C65AEF0, 0x1392FF7792417D3B, 0x64B321929EFCDF42, 
-0x412EB9C304F37BA4, 0xAE7E96BED1118DB8, 0xF8A5E7124429ABB4, 0x3DE424F6D7C1, 
-0x273D0FC00E2D68A9, 0xEAA14122595CF0F, 0x121963B787A181A8, 0xBF4CEE9FC3341F8E, 
-0xCA185B05E7E4F0A4, 0x36A28B54645DD896, 0x2551DDBDE9808B93, 0x65C975A7C58E41A3, 
-0x701CA63D62A44256, 0x3492ED23139E1432, 0x99D18EF98858C1FF, 0x6F55DFEA4DC4, 
-0x365AB956A0840FA7, 0xBA27AE4209D2759F, 0xE644B3C124076FED, 0x2543DCA1FBEE10AF, 
-0xD5CC3BFB27E03EF2, 0xC02A6AF4AC4AC340, 0x21A2E5049D8D5921, 0x422D1333B26B976D, 
-0x1E8E68269B495475, 0xCB471810A57E8D0F, 0x193AF7E4FCD521E8, 0x39BF4504E293, 
-0xCD9C7C41C9340FA1, 0xC831B091B9478FE5, 0x5E56F6D398B7A6A3, 0x8B644D3BE39A9F54, 
-0x68CE663880B416E7, 0x6933C3752AF47B1B, 0x5CF1CAA43B79FEB5, 0xD2A5B484A7DCB256, 
-0x2B86EC0357EC5F59, 0xD156286C247527F2, 0x57A998C58B8BBCA9, 0x3C31040DE1E2, 
-0x3D0D174BECAAE5B2, 0x31209AEB988E9346, 0xD40DF9C485BFCCAF, 0x4F596CAF31D474DD, 
-0x40C8C1B1AEBEB69C, 0xF642F4E724C9827C, 0xFFE713D48ADA12BA, 0x6835F15AFE1DE7DC, 
-0x6743A59086AAB58, 0xF9037B9274478339, 0xD842000D6BFBBEC1, 0x1E8EA824D4D7, 
-0xDFBD772FD75EEA78, 0x159375595AB32C66, 0x3538F310183695AD, 0xD290534A4D433B6A, 
-0x7F6395A9E440A76, 0xE3D0E259D9448861, 0xFC5579A1E55AA901, 0xB89538AAC920DAC, 
-0x3A80BAF34841B7FD, 0x64F17B4AD5CA913, 0x1001A3A3116F9D97, 0x6031E32D1502, 
-0x3C44EEE4579A01C8, 0x25266A5C9334DF1F, 0xB3D91DC39029C97D, 0xF58C433374F32689, 
-0x71B4BBABA5BC149E, 0x2859372961AAF52E, 0xC9B4DD4E9B3D463E, 0x9CF70450C07FF3F7, 
-0x387A6863DE0924CC, 0xB852BDDE246904DA, 0x5A21E744A0C7BE1B, 0x4B0C8037E1A3, 
-0x3533FD222A51D2FD, 0x485BB96FEC892EFF, 0xDD8A65A7C063381D, 0xB52B74244659D6CC, 
-0x57BC772782B49277, 0x53507365A62142D1, 0x5F888C7EF70FAAD7, 0x4EED65F6CED381FA, 
-0x9F43B275448022AF, 0xC8D2A7D640091018, 0xFCCD05E116F0A6AA, 0x1EC0E2D162B7, 
-0x3328380869DE7A34, 0x5544324ACB8B75ED, 0x58A1ADFFCCCC8A13, 0x7B4599530625A7CD, 
-0xE8471A707F3113E0, 0x33C853E8D1500A33, 0xD9FC418EE2CF4001, 0x84AECF4AE2964E9E, 
-0x27E8733222B62018, 0x64C41392AAAD467, 0x408E66BD255BBC85, 0x330806F52DF, 
-0x394921654CDE3D65, 0xA3F51B196372584D, 0x7D46E8A47288B0C6, 0x5314694D2C7244F5, 
-0x537491C632B282D0, 0x99BDA6899A8C3724, 0x256B0E3F9C0EF2C4, 0x3048DA38B5A4AC12, 
-0x8636D9EC2C0EF2FA, 0xC0624DAECE31ED8E, 0x2905F5075EF4DD40, 0x3A0694557848, 
-0x5DE15EE2305D2E0C, 0x386CD7642D1E47D7, 0xF6647C058949083C, 0x86F197B578B0B07B, 
-0xF3A79F4B04975D58, 0x1984ED6932A54C9F, 0xB9CB41609740D6C1, 0xC605D7B30101BFE4, 
-0x7531F76B68D909E7, 0xD46F8514682C31E5, 0x9378021DD4EF1845, 0x59AA96F1488E, 
-0x7EFDF97DD620F16B, 0x3B5F9224A1E6FF1A, 0x2246B56AE3DFABA1, 0xE1DAB704DA7F1D09, 
-0x3F4F68208250FD00, 0x4A5B185252D08D71, 0xE20D7D70C7C4694D, 0xF299A9712FC24678, 
-0xDA71DBFFBDDC810E, 0x4E209C92A6B48E69, 0x99E55598B409AE65, 0x680951AECF35, 
-0x8B5410526443FFB5, 0x9FCD16448FFDEE4, 0x8ED3BDD6215B4A29, 0xB86AABD3B4718591, 
-0x1488809B15DD6A15, 0x208F71933131B63C, 0xE493E0E39E7DAC53, 0x42AE1B183AACD5EB, 
-0x33BCD3646BE27C69, 0xA539425CDF5E4BF3, 0x56FE556DB9F3D062, 0x1493ABAFDBA2, 
-0xDE19AADC53B196CD, 0x560A0D3441C26292, 0x6D25750DDAA216D0, 0xFACFEA5D883E0080, 
-0x1A48646B114072F4, 0xECBB1F2F1F5CE03B, 0xDD33D5E0727C38DA, 0x36975A32A3392523, 
-0xF5F7A209EB3239A1, 0xF66178FC41D778C4, 0xBA66570916CEF7C5, 0x29DC1BAAC201, 
-0x5C9FD74FF24C258E, 0x91D3E7639A797A24, 0xACAF76944E739F0E, 0x4F30033C349378AF, 
-0xC5DC4D2421AB0F05, 0x9208C6449F36E702, 0xF264D793091F568F, 0x5E602C7A02E0CBAC, 
-0x9046AD2D23DB2B53, 0xF8B6650E147A197B, 0x8C9472A367956C3F, 0x34F8D1A683C2, 
-0xE04CBF2D5D108D90, 0xBD15CE422507E212, 0x3086440EBA90489A, 0x715D052C028F1AFA, 
-0xD086572FA06EEFBC, 0x8078DDDE7547DAE3, 0xCF9E1BE0B080F0FF, 0x28004084F6D8245E, 
-0xED2B477D884E7A9F, 0x5439A69EA5B6A824, 0x1522884B6B6EAF6B, 0xAB9BF95C562, 
-0x5A1EAEB006ED98A5, 0xB300DE2BF29E661C, 0x7F0DA53BC8AD86FE, 0xCCB985805C608DDC, 
-0x1B00D3A773BD19B9, 0x13A4EA392028C7E, 0x7EF84C682B4AD5A8, 0x88E9C7EABDE296BB, 
-0xBCB743676C56282C, 0x1CC8FC1166730E0B, 0xC7CF4CB499046FC3, 0xFA5795D1B67, 
-0xC9C7C7B9AB9D1AC0, 0xA3529494F18A83B7, 0xEAEE374F2E0BACCA, 0xF3913637992EA9E0, 
-0x282178E7E32BA8F7, 0xDE0837D82BE8638C, 0x2ACD29296C1C7262, 0x797230A473DC04A6, 
-0x6616ED6869F6D6EA, 0x84B4868F28A5D85D, 0xD1879CD7AE5998B4, 0x5725D2C62617, 
-0xD98BF78584FD5C08, 0xA13AB6ABB0EB976D, 0x2138D848F505325E, 0xE5F8C68B334DD7A9, 
-0xB453285A8A10DBE0, 0xB42E37B9671A5BAD, 0x2F612846399D51E4, 0x53521C41282C09F1, 
-0x7787C8722D48E9F8, 0xD153470F0520FFC5, 0x39EAA52DB9E45B4E, 0x17E20434011, 
-0xDC2299DB7FBEF76F, 0x1A74927281B3F6D2, 0x92A1091AD77B38E, 0x96E305223A43BB75, 
-0xA5A36F9743F523DC, 0x2D18E5ED49423B95, 0x7B3B0753C9021565, 0x416FFFBBFB057F0D, 
-0x60E7A52501E7FE44, 0xE7B1AA14ED60E711, 0x456670038546F660, 0x1D624272610A, 
-0x351E24F6EF958901, 0x30C58D48611D5103, 0xF4FDAD76E439F77F, 0x4323BA08C9C0551, 
-0x476DC2423DF79354, 0x7BDA32AC826C95C, 0x8CEAA4763D8C8CE2, 0xDE1FA3CCA94D0356, 
-0x1D1537329F9324D, 0x6E06E780C4488BF8, 0xD698846973B5D29C, 0x29B95C0F9C3D, 
-0x9C5E984B695AF63, 0x9A1DB0B35376F924, 0x31EC783D2A15659E, 0x258B39B99DD02159, 
-0x7B28387E424548CF, 0x8D7C046DFECE182D, 0x323A44E96FD85A9A, 0x604A54A0C1E1FFA7, 
-0x6253E7EC959FA343, 0x13AB3FCF6FECEC7E, 0x6B1C0656B3801E0, 0x1B1760F1253C, 
-0xA3A7DA63C350FE96, 0xA5E9B8AD5448B44D, 0xE80AC063B4655E5C, 0xD56627264C636D68, 
-0xBB64C148BAB3FFF2, 0x1ACF075F32EAA2D5, 0x51C07443D9631B93, 0xB1D67C17DC12B7DB, 
-0xE8B90BDA2097F4DC, 0x7F2A715241917389, 0xE883467C17976570, 0x8ABB551B005, 
-0xD1A064EC317D5CBA, 0x3726FD2105065CDC, 0x1117996C1A6F0A08, 0xEB3AEC89B8064B3A, 
-0xBED1A3DCC0A2624E, 0x314E66A36A2E1F11, 0xE9F1A23175783F9D, 0xED793D905B74B5E8, 
-0x61D76834BADF86C6, 0xB4D8EECC6AECAB7C, 0xAB7C3665DE835185, 0x2961003C34FF, 
-0x96AD8D2FB26CF864, 0x79C3C1E6E7CA73FE, 0x73C6984F462F392F, 0x6B63CC4A8C927316, 
-0xEFB350C4E626E01E, 0x6537FA702196D37C, 0xDCE21536916C24D7, 0x3F5D360F5F260868, 
-0x9C75112F87AC9368, 0x9E68C44D2868CE32, 0xF0DAF7B9B556CF6B, 0x27AF2BCD5E85, 
-0xFBA92D94108B08ED, 0xD1815D4D633FD9F9, 0xCB8167B71BCC70BF, 0x73D12B27223417D3, 
-0x7B86325812AA3B63, 0x36A10B3498AE89B6, 0xA040F2612BBD5056, 0x32B6DA163BB62275, 
-0xF5CCD2FDB9A9CA36, 0xB9E6FE31D963AC25, 0x43450A21102F046, 0x5D16363C93E1, 
-0x86961C6A80E6468F, 0xA3C0DCC5A1FC9326, 0xA74544C1C6250200, 0x495DD1568E85FB18, 
-0x5338743B2044345F, 0x700638CD918263C3, 0xB6A410D4111BC0B8, 0xF6A1F4F48678F11F, 
-0x4E41F13327666551, 0x6EAEB3E7AFE50636, 0xAF90462AB5644C8D, 0x2843140A3DD2, 
-0x1AC8AEF5E3024674, 0x53E48D4CD5F66DCE, 0x69CC3A2AEE28B990, 0xE78C815ABE1A8360, 
-0x4052223B5D363C3F, 0x254D915BEBF9C3EA, 0x409F5113755EF688, 0x967247F890164F07, 
-0xE5CDD929E717307F, 0xE8C321FE9F9D40DD, 0xEAFADEB91FAF684D, 0x55B0AF2F1AF4, 
-0x6D8CC6B5178FF7E2, 0xC519DFD1188856C9, 0x9447CB327E93CCF1, 0xD2B8305B4896E1DD, 
-0x8AEB227DBCB757E, 0x52CAF90A7D80E29E, 0xBC783DB92BF436DD, 0xD3263F9B87E33D66, 
-0x6071A8914A02D0CF, 0xCD38EE2E5A8384D9, 0x76B2B1F1A419FE58, 0x4C5440C5458E, 
-0x2DB0A132CF409B9D, 0x5D86E2F6E8D529F8, 0x8296D99254EB3BF, 0x8550B39FE8F03CB6, 
-0x8B23BB2B821E3350, 0xFA0D23DB6EAF63B3, 0xAD711BD20AC39DCA, 0xE421C55982DE2FE6, 
-0xA137517836BB5D4C, 0xA3B0A136267E16EF, 0x80587FB769DAAFB0, 0x5C5E4B8FEFE2, 
-0x4CB5F6A1A16C8CE2, 0xA42568802086CA3, 0x93B9E0AAD70E23D1, 0x4ED6D4AB5DDBDA82, 
-0x4E28109781A32741, 0x9136DB201B713A6, 0xDDD012267D0BC7D4, 0x53DEB41006B5BD25, 
-0xA5FB20E69AAA5AB7, 0xC769B56C79B032D9, 0x1020E08B5F277E2, 0x447775D75E8C, 
-0x56916944682AB051, 0x2D8E731A27480575, 0xED41B6530CA25987, 0x486B25FB59B0F966, 
-0x5C95390222C49E2B, 0x3F73B994E2E24716, 0x8FF25CD5324CAD3F, 0x879A45168E7762D, 
-0x5575FB3FF3903D2B, 0xBD7F7CB02F1AACDF, 0x371F75181B45A9D2, 0x4984D2C48BB3, 
-0x78A7222045300180, 0x157C3CAB10AC3297, 0xA61B5AB513811C23, 0x171D67001F79A374, 
-0xEE860A88CD33CEEF, 0xA830BEC9564EA045, 0x20C12BCBC898E60F, 0x8B4DB2C4EB757DB, 
-0x2129CB2CDAE06DC1, 0x3D1FEB8B187F1423, 0x7E43F3F7CF9170F0, 0x4928F05371E3, 
-0x61F0D33A28DD9407, 0x824D06A32F77E51, 0x1CBE619BBE439000, 0x4DC775F5715F646B, 
-0xCC1B811AA3B83BB1, 0xA734068E2CA97D48, 0x2AF974B6B69E5C3D, 0x3A2A7A8CDC1B44C2, 
-0x8FEF1129F824404B, 0x2AA1EB44367525BA, 0x43CDC3D773FD8013, 0x2823BD2E977F, 
-0x38CAB29DDB4C8B82, 0xD1ABADB8383461B5, 0x13FDF16B4AAF52CF, 0x6302CF84F81481FB, 
-0x8A6CD7E007AA5252, 0x8EB94330CC5D8186, 0xC95BA29D87ADFB63, 0xF8708A7E7F80E86F, 
-0xAF8A4C59CE0A1153, 0x82002A5937D3D47B, 0xE89EAA49FA03AED4, 0x67917CE8EEE0, 
-0x21EC4266AA544BEB, 0x2E626C10A659F83B, 0x314C50220BB0AB30, 0x3D7AF4921CCDAB86, 
-0xD112FF30192048FC, 0xED01C152F03D48DB, 0xDE020DCF8A5C00B1, 0xF072B1D729889CD9, 
-0x8A54280F6018BA1E, 0x61D132F68891709, 0x6D8F4F1C2B21F287, 0x66AB89B3135D, 
-0x3EADF2E475F2F006, 0x9794D57561286B68, 0x14C6CD1A464ED1FB, 0x31A873EF7E3F371, 
-0x3F1893275949F69C, 0x3C48943C180A07B9, 0x43E0B9A6A41F3375, 0xC0D4DA51C47DE770, 
-0x94511F2DD81157C6, 0x5A3DD0BAE783A42A, 0x630461F96BC0DAAF, 0x567DFC3AC40D, 
-0xB8153283B7ADA009, 0x8AC778FA1F34197F, 0xB323A42E3D7D1037, 0x1387A4E95A3773, 
-0x92D49A4BF9F267CD, 0x619BF9F3B853D429, 0xB5F9678593F7F236, 0xFA08698F79D31CAC, 
-0x9BA3BC08D78A497C, 0x347EFEA91C28ABA, 0xCF74B19542E5586C, 0x35A5316E229D, 
-0x8E2EBC0F931C1B87, 0x68FD84D10214BB8A, 0xC48800779263C735, 0x1BA3E1DB147D0904, 
-0x6B1B186A597825E9, 0xA6A89296577E09F1, 0x675C600C56135759, 0xA935B9C885219B47, 
-0xB4C30FBCEC5D1341, 0x67499ED2A4652DD5, 0x650604361664D6AA, 0x593B9B8D7D70, 
-0xD159CC8BB14B733A, 0x23E8E336AF7B15E5, 0xDAF269F09C662C26, 0xDCCDEDDF37A16B03, 
-0x8A07D2FAB7744C90, 0x6B38773102465F5, 0x6EB8E13CF136F903, 0x4E42AE3CD0E07F07, 
-0xD642151E2FEE2DEF, 0xCE6D3153717D1F9E, 0x28B76C13584D26D3, 0x496C5B61C8F3, 
-0x6E1BFF587FF212E8, 0xF08527469748C13B, 0x6927120B722CF7E7, 0x4AC152994116B5F3, 
-0xFABB0E84CFE7BFA6, 0x81B4192BAC189FA1, 0xD24E6589F6D75BC6, 0xD933391FA615D852, 
-0xD97EFB8B53109B64, 0xE1E25B372489ADB4, 0x54075EE37E365128, 0xE8C65E0AD53, 
-0x3807A1D4E377853A, 0x4C898D3368D7AA76, 0x9CB187FAEF4C61D7, 0x86460DCB07358B6E, 
-0xB68EA3E155677DF3, 0x7EA4F49FE236662E, 0x30234A4CF5408CBB, 0x2B29FAE8E2175E16, 
-0x6DF2AF9AADA5886F, 0x8D9C32B972A6D5FF, 0xD161DB2242F1AEE1, 0x3B79231D46BE, 
-0x714BE85456ED6EEB, 0x737821E23A5ED5E6, 0xB9DE14E5FDC901DE, 0xEFE26D1DDB471BC2, 
-0x17D4B8D2D6CB90F5, 0x4235C0D59CC51F04, 0x8ED39A300FA340B1, 0xDE8DF24E7AA79E2C, 
-0xBEDD827DB86A219, 0x5CD5E74D81547AA7, 0x39B7A7D868A746EB, 0x12E0F9970DF6, 
-0x42C5511A52A4A0D9, 0x31794CAC3697BF15, 0x874777AE0C677202, 0x26000ADF13CD28A3, 
-0xFF5C0AD6E4D60DEC, 0x6CF6A3C5DE63BB32, 0x81505DD6E47AA53E, 0xABC5895C91A93AD, 
-0x28069764EF4E7EB1, 0x22777FE23B85B4A3, 0x33917141CE7A6125, 0x16A25A7CDA9A, 
-0xBA07E0630B6E8876, 0x2691031A01226F26, 0xE13670DBB76FB65D, 0x3ED5BEA68E68F77B, 
-0x20674D030A214799, 0x2DEB7DE449C2F298, 0x2CFF1A7816C89263, 0xC76197CB80B5F4BA, 
-0x2952B1B213364A51, 0xB6369C9B13D2B2FB, 0xDCA60A9A46D49842, 0x4A3E679CD2E3, 
-0x614DF06B1DA388F, 0x8C6BD98B1A3AEA0C, 0xFEB4FC62CD3ED8F9, 0x87D19157335E9FA8, 
-0xAD9B910A14F9FAC8, 0xA4B3115ED826DCBD, 0x83A11681C7A6C9B2, 0xF5B340D57A42E9A8, 
-0x12275DE10C930CCE, 0x35CC3B755CCD31A5, 0x5B2080674254DBA5, 0x2A81EAF9D7D7, 
-0x7705F93E1804A6EE, 0xE799EFC8BC857D1, 0x315AE910DA3A0A7F, 0x286DDE0A9F5D8FD3, 
-0x3888C57F23FD134, 0x60AAE6914036D725, 0x5CAAE2E57C6FC11F, 0xF85FD6B7CEA2BB88, 
-0x52107FE199B76842, 0xCCAF582F130AC0B2, 0x3857D6BF5820D261, 0x4D97F34633F, 
-0x5439E91C58445B50, 0x6C536D309584A201, 0x8D36BA2A0C20711F, 0xB944179903DEAACC, 
-0xC72290EE1AF118CE, 0x685301A465BA7BEB, 0xE5716432DDE417DD, 0x5F8605348440D4F0, 
-0x4C6B4DAD292AFE84, 0x1B4F78A3F21BED27, 0x8AD1EB43F8EA16B, 0x47995D1F84C5, 
-0x861F35457D86354C, 0x53940E53ED1C368A, 0x52FC6D5B00E96D4A, 0xABB5EB36AAD62CD8, 
-0xDD850160AA0F9BC8, 0x93623E2201C0D1DF, 0x47FFF6CEE6671E0, 0x646A1A06C42F3DC3, 
-0x6DDDC11AF936D7A2, 0xC2F1B61F2696740A, 0xF4F68C9C981A7F39, 0x3A73D3155122, 
-0xC50EB3969C9B3F1, 0xEBF8934541F14A4B, 0x1A01A8ED12ED2452, 0x1195941C8E66EB6F, 
-0xCDBFCDC3D94522F0, 0x1F950DB9EB01DC02, 0x22DCABEF440E5296, 0xDF3E36A4ECE93997, 
-0xF44AB9F29ED45693, 0xDA14EF7D718E4B4B, 0x323B0F660EADD5E4, 0x369B96F856BE, 
-0x2C2E6F69AB3E674B, 0x55A9A2C975093AC3, 0xAFB765B68D7B0F5C, 0xB37BDC38D58E7278, 
-0xA16021446820612, 0x8A876485C87CEDA7, 0xBD5D04F259A391CC, 0x1A59AC99A477FB50, 
-0x77CC760EE0A5CE98, 0x9888407D9BF61087, 0xC372B3CDFA3BB42, 0x15D1D5E510E1, 
-0x4C55B69C3B79898, 0xB0EF6CB57C1FD017, 0x693449C8D2A4E87D, 0x9BE92363F6BE95E6, 
-0x66D59E4D4A2C2723, 0x1DB236C127A35923, 0x8A889F8C27ECDA59, 0x256FCDCAF82C81FA, 
-0x330B13C393D85F1B, 0xDA9848F17A71CB80, 0x84119CCEDFD95C77, 0x7CFA74FA9B, 
-0xAA04EA99BD879E4, 0x73B7E2700C3C8855, 0x19E2F4791C837465, 0x52998D1F42DD7FBD, 
-0x4578FA80D800D16, 0xE8E69F0F7ABC8FE0, 0x2F2F435A0BCC94D7, 0xC588B79DED0A71A1, 
-0x19F031D79575FF9E, 0x85D0E1E977E18EBF, 0xE17C556B649C1F4D, 0x450B05201E50, 
-0xC1DD896376B809D0, 0x12FC8BCCF814A213, 0xC6AC14556D7854C9, 0xD79C20F453E75C80, 
-0x464CF55FB81187FF, 0xAD36D8BEAA97675D, 0x6844046EB4B4D5A4, 0xFDD803DE32571511, 
-0x58F341A9E738BC7B, 0x3D9DB74B4194148, 0xD4C335213C17544D, 0x61C6DB72797F, 
-0x7CDC7CA678A8FCA5, 0x3788A198B8B0A951, 0xF396BD58138FA6AA, 0xA7F192F9E704B33D, 
-0xD70AF5C489BFE4F4, 0x12E7D2A712D639C4, 0x829F3DE8B834A601, 0x49BBD92CD9EF57D4, 
-0xBFB494EAD82B28A, 0x6AAE6311BC3D351D, 0xF1ED56467ECC2D0E, 0x12F3ADDE01D4, 
-0x846E6974ACBA1697, 0xB3B6A8369D17D1F7, 0x11DAE1E9417B1E6A, 0xF4721F27AC001885, 
-0xF437EC8676DB489B, 0x36FB8F9A0EEF2682, 0x326F4CB31E90E0AC, 0xDDBAA699243C060C, 
-0x59A5D858B1473443, 0xA972A978B8614B32, 0x38DC73D849231939, 0x6E77149E15AD, 
-0x3F89A9B1F695C83, 0xB4E7458B41A0A971, 0x60717922CCC9EA51, 0xFF2D091049711B9B, 
-0x69F8892CE2CC7758, 0x8CA49B08D972032B, 0x516C04E9B774DDE9, 0x66B67448F8DFF20, 
-0xA418B649CB1C96DA, 0x64BD6880A8BFD163, 0xFA648B0262C4E3D1, 0x6531C826897D, 
-0x57FE494E5C9DE819, 0x6E2F19A048780D6E, 0x7D12C80238ED95E0, 0x8652D55C8B03B81, 
-0x3EB3C15C7F29D1A5, 0x80D9D2CA50A75DAD, 0x2AA4BC497744C255, 0x3903E8365981106C, 
-0xCA379AF8AA3F2202, 0x2D68E27DD247A357, 0x3EFE52A9DE046AD9, 0x40585EC74B58, 
-0xF9682666C3A9051E, 0xABCE182B3B9799CD, 0xA62CC17CAA7DEC3F, 0x4A6ACC7CA4C8ED7B, 
-0x875FFE8DF5888247, 0x1BDFDDD1B945DDAA, 0xD23A7C76EB4C2615, 0xFB1BBF928DD359D9, 
-0x185D437FF11DA857, 0x80372F3DFF21BA18, 0x5BF903AE1E0E9837, 0x1EF57BFB99E9, 
-0x130C4F11AD26574D, 0xAC752627738917E, 0xA3EB405B6F973689, 0x3615C4CCA742992C, 
-0x4C90571B49E8E692, 0xCDB71D4E6BF7D0E3, 0xD3B1EBFF6821AED7, 0x5AD504A78BCDF959, 
-0xE642AB8876C00C73, 0x42062CD2CE696A1F, 0x94CADD24D349CA2F, 0x31DF046ACEDA, 
-0x366ECB6C9F54229B, 0x44DFAC74F133A222, 0xE8C9F61CDD7896DB, 0x905F4296F177FFEC, 
-0x52E5BE09336F0BE0, 0x1883ED5A4FBB89C4, 0x777E7D0F66048E2F, 0x61E28C40677907C1, 
-0x548216738B9E0CA0, 0x8E19E89226CF3E6, 0x9838D64F2F668BFD, 0x62CBDAEEBCED, 
-0x1BC641A976F7F4F1, 0x257538206DF77727, 0xDE623BA8825EB50F, 0x668DAB79392A0583, 
-0xCF2B70D09B9A0547, 0xAEAE5B12D23EFCCF, 0x5868CC35B9FF7496, 0x5395B8F90BC64863, 
-0x19A3DDFFFC7AB749, 0x3CC36AB13686D5CD, 0x6AF215FFC27396FD, 0x6A551BD1EB50, 
-0x32886F7AEAB8D5BB, 0xE1E0B64F7C7E6736, 0xDD39552045E07230, 0xBC5ED19D6BCC014A, 
-0x41C9D135A38C4F54, 0x21909C64A6927E6, 0x15BBEDCB8E6CB4BA, 0x81BB3FCDB67ED160, 
-0x352B708B892AEAB3, 0x9C2B62C8BCC37810, 0x99E15DA949971BDC, 0x41526B9057DA, 
-0x2E596E1526C3CE25, 0x4CF966FF7F96E036, 0x776680409A5ACCD2, 0x2DFADF45A6094A46, 
-0xCFF63EC5E64ADACE, 0xD8EA65E3EAE75D67, 0xD4B2B11E71A02AF8, 0x5CC7C6ACF76A0760, 
-0xE56C76B65CC7300C, 0xD9415D3855F200A, 0x58B36C9A262E3ABB, 0x1B30B51B2587, 
-0x2BEB1C0B01590E12, 0x592B8D4FC94F9EDD, 0xCFE96260B7D3B265, 0xF01799427B5F2A5D, 
-0x69B129A3C70EF3D3, 0x9741F2D8DE77A86B, 0x77E908DEBAB7A5BF, 0xB9C23602A717C3B7, 
-0x61B61439B3FC4506, 0x111BDD95084C154E, 0x5CC18EF353CBC0E7, 0x6E468192F7B8, 
-0x9096C874240B2E89, 0xFE1C02FBB4BED67A, 0x16494CDFEF57A2D0, 0x4B0B1A19B460A5C9, 
-0x19D59EC4159F8569, 0xA2E4A3A042B9B893, 0x1D4EDE4C2D60415E, 0x81DBADFA32980EC2, 
-0x2F0CE121017BFFDD, 0xA144665FDEA9B433, 0x9AF2DF93F0B415C, 0x17F4FC42C301, 
-0x51A5C9CBC5C123AB, 0xA69CC2C6BE929BDD, 0xDCB24C15A2EA5760, 0x4A5E4E1A0C5E5B87, 
-0xD0B872AE41919AE1, 0xA8CBED749582885A, 0x2A958F21ABB7A00, 0xC732497BC91CB6F6, 
-0x2FBA0AD4653BB900, 0x4D7D9F6250028160, 0x8B83F97E0993A7FE, 0x4F0518C804F9, 
-0xC10A79954C125D28, 0x8AD0914808D08FF8, 0xEE1D6D45DBB7937, 0xF8B6037EA29D98D7, 
-0x2AF3F7C83CD4880A, 0x895A5FD4F4D8BEC1, 0x168330D8CA133777, 0x5CC30327B4609085, 
-0x5E029FDE889EFE0B, 0xD4EC96F268F52D27, 0xEE052AF9E37B42B6, 0x3DD450235438, 
-0xE61FFBF7231CAE8A, 0x327E7C3D9497283C, 0x8E7E300FD95A3764, 0x4348415F25AB7F62, 
-0x926654192DC1FF24, 0xA636547DED8FD062, 0x30A129FA7C6317C3, 0xA0FF18026F268AEF, 
-0x587BB9F7FD5576C5, 0x6B9F07C30BAFD7CD, 0x888BF810B2DED141, 0x4A2705E4A41B, 
-0x1E9B51CACAC1B83A, 0xC3E84FF3F3957D18, 0x85881060CC1F286, 0xEEB60BBF6B02E173, 
-0x5A758C59B67611D2, 0x31465AB312E47575, 0x630A2BAF75BD89E1, 0x7F70D74CA38003B6, 
-0x31DB8CB665B30923, 0xD4B402644806DD84, 0x220253BC753A8015, 0x5C32128E899B, 
-0x29E848FDF208C8A, 0x80E216ECAA7FFA74, 0x7EA109BFD79CBE58, 0xD438DD60DC55B194, 
-0x76DCE40364F46E90, 0x65EDEB4FF3EA7E85, 0x495577D6DAD0C569, 0x286FA78AA414483C, 
-0xD6FF94651DF5E895, 0x59066D283E750CBA, 0xCE6706548277C9A7, 0x2065ED227416, 
-0xBAC121983BC35787, 0xBEF480C73E707C9, 0xD089B9B4BC43BC7D, 0x78B6BF6BBF95E9A4, 
-0x68817F4EDE1A2285, 0x3D44962DA209577E, 0x1C034489DADD34FA, 0xF9EAE2CFB20B9BC8, 
-0x90D58EDCCA6207DF, 0xA610FECB2BE0B970, 0x3F44B8E39FEA61F, 0x257AD22D2DE6, 
-0xE3302E162BD72093, 0x2BFD8D17A5A56A98, 0xF57B1CB66EFBA096, 0xD95CF9BAF15DAE64, 
-0xA52C2E77A7B96258, 0x1C93F3FA31157707, 0xEB7C8C839B0BC072, 0xF3AD0F2E01253F33, 
-0x61FD43D17C496C61, 0x242DAB8452FA9B5F, 0xC9982D91AC8129F2, 0x83D49FCBAF6, 
-0xEC0BFAE572294D5D, 0x96E6EF52F41B2728, 0x282476401A1E36F9, 0xF299B425378E4368, 
-0x2CD3519BE7F99F5B, 0x792DF02222CF1DD9, 0xCD5F754E05C5A4CD, 0xCBF5FEF3B0C5EF0D, 
-0xD73F60C8AB3E32FB, 0xD59A671E50424C7D, 0xFFD42B38A2A68856, 0x2B2C08C75A31, 
-0x1403F84C2DF27338, 0xA8AAAC3129336C3E, 0xF25996BF38F40545, 0x9937AA0A677AC8EF, 
-0x90DD3BC28003AC9C, 0x7D105749C115BFF7, 0x94BE1B61D6BCF55E, 0xD876F1AF3671293F, 
-0xE5986D329BF4ED7B, 0xBAA4A2F6B35E6BE7, 0xE81FD8AF7AC77169, 0x5FC51F288A04, 
-0xD4DA6F3ADD9A0FB7, 0x7EAF2B4C64F913A3, 0xDAE7E0D9296599F3, 0x51A6F41BA6CE88A1, 
-0x50B9797BE467491D, 0x8E853DFFDC11B6AA, 0x2370F076A2C3F2FE, 0x38E6C86EB7D6808, 
-0xFEBB03A02B934769, 0x8D4987C7E46CCDC9, 0xE1D48C29580F14A8, 0x116BB977CD47, 
-0x3F882D5867815D54, 0x7B84265D83A71F6, 0xC30A380B490F8358, 0xB50F9B0C7F9CF94, 
-0x984A2C1DA9F89D8E, 0x1BDD569EC0EFF04A, 0x53FF4641201FFC16, 0x698E13A43B5D12E, 
-0x610084E533FC586C, 0xD747FB7CD0E93242, 0xB06EC5C54FB5669, 0x53E51358209B, 
-0xCE31F4D980F72153, 0x3AC7D08640346833, 0x64FA8D77C4AC0F29, 0x66B3A46373BAFEA4, 
-0xC062EF29F0B4DBBC, 0x7587A09D5DFE01A1, 0x9935ECA9FCF404A4, 0x24BC1320913DB1E3, 
-0xB0D642525EF004E3, 0x67D68C81889820F5, 0xCDC506D0654D9585, 0x161C0136A65F, 
-0xD1A876157AB21FBF, 0x3B2515366F8655EE, 0xEEE067C87DE0CAFF, 0x7572082B03953BB8, 
-0x12B7FC00B0693D35, 0x36D4862D3E94CEBE, 0x3BDDF065DCFD72E9, 0x71A2D19718FC4C43, 
-0x64050F155B7B92D2, 0xBCF411DCA6F84EB, 0xB5204EB3DCD114B0, 0x53F7432B343E, 
-0x84F044EE01141490, 0xB80E0DFE05A893D6, 0xBA32C8D0B8C62E72, 0x564E2AFB786FD0A5, 
-0x16A900E167B366E1, 0x730C8E2FA02D08C0, 0x7C2D63EBEE245BA2, 0x6EB1F01397CD9F78, 
-0xF67A503DC26FEDD6, 0x598690366A758AE1, 0x7FDBDE4A7CB1B1DE, 0x2507B4531E7B, 
-0x9A342FBB452940, 0xDF998FB5D6E691E2, 0x5BC3D875120E8695, 0xA6BFB6EACEB535A2, 
-0x18F365A817D8901E, 0x7F64FFE42AAE8C5E, 0xCAD7E55955689848, 0x3E8BCF9A4788E77F, 
-0x3D7A37BDE8553A72, 0x53CCD801CE1BAD37, 0xF4532D43157D6EA4, 0x533678B814D0, 
-0x6638745F7704B375, 0x5EA5C3AD70D165C4, 0xA8596B9B828D4BA3, 0x402E0AA96599CE7F, 
-0xC32430E83127571F, 0x747D1230B021E83F, 0xDC778DBB6B37686, 0xC5FCAF87922408F2, 
-0xDE091DF469E036A, 0xA37513B63717B3D0, 0xC48C2F02D573D96C, 0x6FD90D8FA708, 
-0x512090151AD4D649, 0x4702BB2CDC716418, 0x8151D0F12AE637E7, 0xBD2F04777F24A352, 
-0x38D4092FA454D78B, 0xD37C426EB0CBD697, 0x9EA93DA58677E687, 0xAE50FCFEB838F45F, 
-0xB50E64E91D7143E4, 0x497C3C9BF598E756, 0x7A9AE50905A10198, 0x4D2D26E91ACD, 
-0x886334CDBCC37F1E, 0x1481437A06802F52, 0x76FC30E63DF25E4E, 0x2BB18F8FE4FEAF71, 
-0x430DDEAA53F5BA97, 0x8C61732CD0B448FA, 0x5E729F7E15815E2C, 0x2C78A6D346D467B, 
-0x481A7F9884E38159, 0xC7C4ED8DB64FB0A5, 0xD3CAAFA905CC3A51, 0x53EC6B54B5C2, 
-0x1AEF2FE0ACF98250, 0xC34C627E7C473C03, 0x470F3CE5904DBDE1, 0x111CE595E77066D8, 
-0xC13418109B06777, 0xE10733403649648, 0xB7C804C514DCD3C, 0x6A57E5033C85BAAD, 
-0xFFED05EBACD590FE, 0xC8E66DB202027D20, 0xC891449AEDBB3E54, 0x1E4DFFFAAA5F, 
-0x72BC086A8E54F3EC, 0xD2E6C209F07C81EF, 0x58E7BED14E4B0E99, 0x38F9613DD18E7C5B, 
-0x2269431227839EFE, 0x2088D3032FE9F97F, 0x12AE3ED260FF58DA, 0x6E07CCD09A3C4379, 
-0x35DC7326F9745BA2, 0xBF0AE91013FC2C50, 0x1DC7DC84FAF4F6FF, 0x3368F4CBD9EC, 
-0xD5F74E412ACAC5B9, 0x2665D07CA56E548B, 0x87A51F73D6364375, 0x8BC01F5A0D879482, 
-0xEE8E4584562FD974, 0x53EE787FF257A00F, 0xC7EDAB583203034D, 0x4444614BA6336D74, 
-0x9900D16F0356063, 0xE576AFB38842B195, 0x91A39D9AFAD144EA, 0x4E3D0D68BD21, 
-0xAE0C03503CC8AB27, 0x8E9B1A9F63DF783A, 0xF5EDD8F01AD692BC, 0xD582C29219EADEE5, 
-0x76D69951BF755AAD, 0x656988B926C10916, 0x63E5ED11C3A22A71, 0x3A6207D61D27541C, 
-0xCDCFD1CCC5A74F5F, 0xCAEE7524E65EF550, 0x45966948598465AA, 0x329960D9C47D, 
-0x6C9056E2F89B2273, 0x600EC4D4BCE7B0DD, 0x93E3189A733A2F26, 0x9D28D2D55C85364D, 
-0xC44C08C5721C8666, 0xDD00F7F5CD422F73, 0xB5BB92A6A4D26655, 0x8150364075960EA1, 
-0x98D0BC6778A48813, 0xCCC89F05A04EF933, 0x3EF430CAA484B895, 0x5AEFC6F16499, 
-0xFEE5042DE3D08449, 0x329E670262DC1BC, 0x53F3148A7EE89ADF, 0x58272EC80041CBAC, 
-0x9EC63C064D652D55, 0x823C5E5850968AF8, 0xE259E1109683EC55, 0x99F258A13C74081A, 
-0xF9DF38830E3F5224, 0x72B0C3B8DB3CE79C, 0xF4B632848776E433, 0x40ADB43945DA, 
-0x953C21D4DF725806, 0x8CFE9F1BBC9A3CF5, 0xF0BF187218D89019, 0xACFDF073EDB04DBE, 
-0x64827A4DC0634CC, 0xB99103680576056A, 0x2F832C3E3F468CD8, 0xB16A7F83AF9C2D8A, 
-0x5337FB5A62A3B56E, 0x53E16B8A0A3DCE96, 0xEF8A7EB4D6385870, 0x3AA8F9982F6C, 
-0xBEE19EF509B18C7C, 0x594A328C18E4D11, 0xCB6B162020024614, 0xD54FC6A577416F69, 
-0x3B0ECA8693B64799, 0x929B0B379BD42470, 0x9C8646385C0571CC, 0xFC9427CE1C9FF2A0, 
-0xCC9DAA040F6FFFA1, 0x9B7DC21DCD6F6499, 0x542878345D43A41D, 0x432DD823A2AB, 
-0xF1AAA93E4E798284, 0x37F9EB49C6CCB491, 0x6F797A2DF8C07ADB, 0x9E96353D56FD3AE6, 
-0xFC81201CEA3531C6, 0x490EA96435B8C8BA, 0x1ECB326A6B351402, 0xFDA750A7148E87A, 
-0x6D6E0E7B95405CAC, 0x2C64ECA6069F4324, 0x2F477A3248716394, 0x77B58DCBA6A, 
-0x14225D3B8D3A336A, 0xB0C9C3AD2B1F8C68, 0x32B1567ACD3766CE, 0xF0C90CCEE87607, 
-0xA723997D6C766BF2, 0x4410A0031BD20752, 0xA836F9547C8C77D2, 0x3C83E4C60A30F9FE, 
-0xD41E9929746EB5BF, 0xA6E76811C3BA9BD6, 0xA5DCB98BC9EF848B, 0x1EB4AF36450A, 
-0x3407C881898392A8, 0xAEBC0646ED30AB64, 0x38A2EB961CDB84CB, 0x5011A529B3422798, 
-0xF782BBF5347E4042, 0xEE8A7D00F19EA0C5, 0x667D0AD89422C278, 0x793DCEDE8400FD71, 
-0xDE89012EA3E2EE9, 0xFD85551AA5CEC663, 0x6855949BECCBB335, 0x33B80347FACC, 
-0xAACB9B5739007F82, 0xAE472EB7CA8352DF, 0x81635E939C2BA160, 0xE31F84C87C21CE38, 
-0x5DB9C8C25A6E4AA3, 0x1F3D67CD89937218, 0x99F4876E16DAEC40, 0xF522DA326C68B630, 
-0x9F9EEB89A9D54E97, 0x8818A187FA8E1EC7, 0x4E2A87EA4A9A8BFD, 0x53755250368B, 
-0x784A14B9BE9370EC, 0x64982A6983158E32, 0x8C022560DC03A0BA, 0xBFF70FDE9CA8A27E, 
-0xB554B883E7E81E02, 0xB4DCEADE622A2BBF, 0xD80A69BA11B9E16C, 0x9981088AFB410E5B, 
-0xC4EABCB3D3106212, 0x226AEBF6A0164F49, 0x8F7E7A501CB328B1, 0x58716D5F9141, 
-0x90D61371EC2DB328, 0xB30BF78AE117B1B7, 0x5E47609E068772D5, 0xECEDC1759056891D, 
-0x61331DF28B300B12, 0x22D5A4352E00F780, 0x38D360A46358CDE8, 0xADF04DDC0887F4C4, 
-0x544A126C392692A4, 0xFE063D63190D4B9C, 0x8850A2B502272A6D, 0x101C9012A012, 
-0x767035A297995BD, 0x735296767B3F6839, 0x531428D84AD1B8CF, 0x15DE068049EC138A, 
-0xE252EC6A59B5360A, 0xF39FD3977F828D30, 0x57C09DCA80549853, 0xB21AD4E1F64C764E, 
-0xAD50C22C94D01D4B, 0x6A08B7DE6441B29E, 0xDEF52E773D8B2C7, 0x67B28CE45112, 
-0xCDF70E01C82614AD, 0x1ED57ECCBAB21F4B, 0x93F80DC4F6DE658F, 0xCA53D9D87D311976, 
-0x7E79E2687B48AE2F, 0x4146586FE9ED56D4, 0x48F1838FBD539E09, 0xF5B0E311AEA1C734, 
-0xBCD9A0179550147D, 0xFC8D88229735F4BF, 0x123124278CD9C599, 0xF19A05AD5A1, 
-0xC8D200C5F0263729, 0xC3821AC67426A524, 0xEC69BA4B6185E78B, 0x27529720743A82CE, 
-0x766AC89960F91755, 0xE72676AC9C695634, 0x64AD37F5455075FA, 0x552FD467B605C0C2, 
-0x2E45C78644EF4057, 0xD37301508CADF7F2, 0x3C918AFCCD5DA039, 0x6D624C0B3151, 
-0xC181FDADB9D9C06D, 0xBE310E1764677E8E, 0xE26479E7DDA4565D, 0xAD9F81BAFBFA8B0C, 
-0x28D9B12D152807B8, 0xDB91C8AC3BC1F99E, 0xE6CA4805B54FE893, 0x2B950E0ACDBC1320, 
-0xC8AC9237324E07CD, 0x97CBFF472737DC7B, 0x4B924F1123F41DD6, 0x4B959ACAD164, 
-0x6B684FDA4E66234E, 0x8106C14B0AE083DD, 0x266ED6D93C59888A, 0x8284C681706DFE2, 
-0xAFCF08248B2AE372, 0xF56248B0BFB60C93, 0x29505B85146B2F24, 0xA142BD8ABECFBFCC, 
-0x1C4146D12854941, 0xA3D3F8AF561A4B90, 0x7E606F8B96D783DC, 0x629FF295F22E, 
-0xF6EF6BAC96E51AA9, 0xE5F95FF5EAD51038, 0xDAFCAC069F9C227E, 0x6860B606EC6A325, 
-0xE05CE0B1AE4F38B4, 0x1200DD8E6AF7B72D, 0x17BEA9218DF6CB88, 0xF8B8DF401EDAB13F, 
-0xFAA48B8041F6659F, 0xF4481895E055F801, 0x3F14FE83872F4868, 0x6A4DA724BDB5, 
-0x78FBE5AD167F327F, 0x5CEC514D73F7C0FF, 0xC6D24D68476EE0, 0xD4679ACC7E34319F, 
-0x9CB73623C0F38047, 0x6F88E122D9F6E87, 0xA68F38F19B465CBB, 0x540B0D426E2222DE, 
-0xA1EC44A074939FCB, 0xFC151336019742E8, 0x9019A2EE5BAC24ED, 0x29277E689F28, 
-0x416D81376B6E6669, 0x9EC69175C0EDE297, 0x53588B90A3E1934B, 0x71706419E761FD44, 
-0x450119CB3FF8A228, 0xDF1F794DC865E030, 0x36D1126F25BA59B7, 0x211CE3CE542BCC7A, 
-0xDF6980D7D8CC0A8, 0x74BB85EC68BA04D1, 0x9A76536D89CD3B7E, 0x4962A26BA4E5, 
-0x5F795A5BBF2A1D7A, 0x9164CFBC3886125C, 0x792A720DF9C398A6, 0x623E077C21AB3A14, 
-0x53A69DA164739DC8, 0x4BBA18471159B84F, 0xBD50EC5DC45A2F4B, 0xF8CB46494854E3D3, 
-0x685E74D3348F9408, 0xBF6BC4AFBCF2D028, 0x2FE164A53F8FD38F, 0x17290FFB0EF1, 
-0x87E7220F865C24F3, 0x65A73E0A1289F7B1, 0xED97BD829A6209A6, 0xF302B1336826BB64, 
-0x3323C2805C916840, 0xAD17E5569D8C9C55, 0x41F4FE2D92D3D122, 0xF8E94B64175F8774, 
-0xC15EBB88628B7029, 0x37786449F5DA9F, 0xD8740085BC14A21B, 0x3A9EFE6F2D3, 
-0x52426ECC9BCBB84C, 0x4C7FB833DEA6783D, 0xCF52EACDBECC2BD9, 0xC0DBFC589FC6DF8E, 
-0x38339E250B6D988, 0x7F0681D55D6B6815, 0xA8BEFD457984E325, 0xA837494E2DF3402B, 
-0xD38A97C294CF398D, 0xFB4B5EEEC75BF9DD, 0xC7A0E9DC6023879C, 0x4AD3303B1F0F, 
-0x82B78BEE7B062DAD, 0x31B0A31169C72478, 0xEBE448FE69E733A4, 0x90CB41D96E310F4B, 
-0x8DC6E2D061C2C90C, 0x51E4845996EC4BB3, 0x48FB17DBC0C22F3, 0x194293EE74C384B, 
-0xC578CA29F3E982D0, 0x76283ECCD3C72BAC, 0xFAE6409B5828E37, 0x66EF5579E592, 
-0x318952611DBF59C8, 0x17D613092FFA8A53, 0x6A34653306F13B8E, 0xB7F3EDB895ADCB1, 
-0x167310040A3A4A87, 0xB631537D3B49B346, 0xF96E90661668630A, 0xEC191EB0B84485E8, 
-0xE91F3EFC0AEC0C12, 0x5113526F7429C388, 0x3FBBAB5901CEE04B, 0x2A90A847C042, 
-0x13D4F1A740D0A3C6, 0x2DB2C8CA276C109E, 0x2DE9186F1A0A5C37, 0x55E9BE3F898099AA, 
-0x1221A56970B4943F, 0x72A26A0C19979189, 0xF8EDBE1E07565E30, 0x26F014FE0EFBE702, 
-0x838FA5973D01EBD9, 0x54C1FC46116814CA, 0x45822A667B6D9E13, 0x2503F8E8A429, 
-0x8F962057B131B49F, 0x57AB2B88ADCF92D1, 0x6A11325415483551, 0x70AE5231F9C572BF, 
-0x27A733DA818965FE, 0x9DA2D4A7D0290D77, 0x3FD3BA8071B01A1D, 0x4F05EA1D24578EB2, 
-0xBB75DC0B41D96F35, 0xF00E970B6F20C6F1, 0x4436600ACABE2A60, 0x1F0C32256D17, 
-0x8C93D5CD72E8319E, 0x2707E8BD1C37D741, 0xF1B581C8B38D4B31, 0xE8252F8E09643D75, 
-0xD413DBFF3A2F7F55, 0xB39F332B98ADC979, 0xFC64E8F3EEB0094, 0xA6B62E8A2C5B09A, 
-0x859906A387BB6A6E, 0x3DFF29F438C4BB0E, 0x2C0C6D78B9A8DC44, 0x45EB7E587F1, 
-0xA00C51CCD076F1C9, 0x97252E28C9849440, 0x576DAEEB7E06B1D9, 0x2AEAFEF3BDB30D35, 
-0x760AFC756757A043, 0xEC740C324E4E809E, 0xFD7E662C553819EC, 0xC321EB91CC7FEE1E, 
-0xA1F2C76B6C264CCB, 0x267107A7F00DE332, 0xF75B9699E4E1C524, 0x11DFD4066104, 
-0xD9F40FC7E4C88775, 0x6851CF67CD56A9F7, 0x4B253221CF3F20DE, 0x8D9F2B7B4E02A0D6, 
-0x28E56D6787FCDFEF, 0xD8934ACBF18759A5, 0x5FFA6112963CB265, 0xA6271CBE0CEFC7AC, 
-0xC1D9A67091D2BEAE, 0xFB9263487B50C730, 0xEE6C072D8B5B7106, 0x3E81DDC287F6, 
-0x9494047CB535598, 0xD57B843C251F29B6, 0x2C06796ED36690EF, 0xFFB6343266613D56, 
-0x50FD749EE0BDB846, 0xBC96734F0913D145, 0x99D6246DEB3EE96F, 0xB7B8A294B429D429, 
-0x4141859C881B62D4, 0x6590964890C10B29, 0xC846E118FCC94EC, 0x2763D5927E8B, 
-0xCD6FA386BF99463E, 0xB023FFE62290DE64, 0xAD72078D8E29A1A5, 0xA39FADA243DD5A2B, 
-0x2814D37B987270F1, 0xBC1167FB2679248E, 0x65D95A9BFDE3F51B, 0xFE15E801667BFCB2, 
-0x35E7DD2F346855D7, 0x39E83070D9599E9E, 0x39F1EB73F27E6F24, 0x3BE5471D595, 
-0xE5AC041B14B4E091, 0xF1AA7EB6B57743E, 0xB07C8676FA9ABEE2, 0x43E01E5F54DFC675, 
-0x3703371073CDA6D3, 0xB8A57F70AA72D54E, 0xB0E4383E6A0A41A2, 0xD06C91BF4FA7AE67, 
-0x34CDE2E95D22F028, 0x270A005699BBDE78, 0x6DE003F7D1CC92E9, 0x37DA75FC444A, 
-0x4656465EC4DC4A1C, 0xB3FCD1FFE5A9CFFC, 0xDD70DF14E7F602D4, 0x5B9C12E79B07000F, 
-0xC477CB5E1F4A2893, 0xAC8BCA5E1A7CC066, 0x9683967097283165, 0x485435A980B5C391, 
-0xC747BAD867D37B0, 0x553F424207F84A68, 0x81A028796E021134, 0x38CAB09AEE3F, 
-0x1BDF006EDE79C508, 0xF8FA6A27373DF22E, 0xCAC62CF2AF294149, 0x84FFDA82910C1A31, 
-0xEA704E3D918BEF63, 0x8C6A1CFCF5F4DCD9, 0x15C865FE897B368D, 0xB0422ABE61D6F0D9, 
-0x5662DC0411DEC78, 0x393D587CF214DCB5, 0x810E66C33FBAC034, 0xC156CBCC1A9, 
-0x6DE13653096F69B0, 0xD1BF5B3880CD02B3, 0xFD63CE00D1E3E911, 0x14E742D32240D631, 
-0xEF2A6628A20D2897, 0x12566C51CC30BABB, 0x9D4799206BB1D0F2, 0x4E7CFD0223EBF8F0, 
-0xD3F8CDA3FBB0F666, 0x6EDB2D8F8C4E9BD3, 0x698221D4EFF2A153, 0x6BE516B818EF, 
-0x2C5CC49271B7CE65, 0x1062E842F8530F2C, 0x64A0C1048BDED0CB, 0x9D27C2F3BE9E86EC, 
-0xC00FBD2E3A6119D7, 0xA1E0E81D901F9E88, 0xE761E31680FAAD2F, 0x5E6B2F79194628C4, 
-0x66AE7C6D349C3276, 0x77971E08F1AA6A02, 0x28CEE1B78B00F4C9, 0x2A81788F7D60, 
-0x5E2AB9AB2493CB0, 0xFB0A52FADE15FFAB, 0x3FB5F1B276E22213, 0xC42A35259B6D3B1, 
-0xFA592590DEB4911F, 0x3EFE19A91F3F4543, 0x8F5658020EA8F279, 0xF74C0C13A954E208, 
-0x85E8C07E53A3B897, 0xAA6E9F1B30D36B74, 0x432166B2BC09D2C4, 0x5F555B6D5654, 
-0xDB7E4B38D6D49843, 0x65A456344722A149, 0x30A015AE353825A8, 0xD30DD9EF3FCC56E2, 
-0x83CC0107519ED766, 0x6665A0163AF35DE7, 0xE7A498D8C84B93EA, 0x54271EE4C5BD344F, 
-0xE34B8322D634F605, 0xB9EBF902C717BBE2, 0xCBF2EDEF68CF25BD, 0x4654B15400E8, 
-0xB8C88D93199D5486, 0xFF85679D1FB94490, 0xDB7590315C9362C4, 0xB5D986807B1B47DC, 
-0x74D2303D876B7426, 0xDC3956B8521DD193, 0xFE044EEFE0A5B30C, 0x1DCDBF9C06662C05, 
-0xD6FF864002B80EB, 0x73ED059DBCD06061, 0xC58BE983A4360A4E, 0x5CBEFCFF5CD2, 
-0xFEFE432149714281, 0x6C3EF20757889965, 0xFD210BDD14A43B5, 0xBD964E46CDB03224, 
-0xB2A88187C7EDAF, 0xF4615296792769F4, 0x438CDF88A28CD67F, 0xB73C9F42C9BC7C11, 
-0xC9B20E87AB2C6445, 0xD690EDA8B7325274, 0xD8CD0329801D998C, 0x974ACDBC20E, 
-0x656DD8AFFEE6E295, 0x68DF10C0BBC86B91, 0xBF9F8CEC621B1046, 0x29FBDEF778E7FBCA, 
-0x5F744B207A2F3058, 0xBD4C04C462284A07, 0x81EC8E0C8B1438ED, 0x2E3BCA99EAAF51D4, 
-0xCF4DA7DBD16F6D2A, 0x906F7D35027EF81C, 0xBDD54B23481626F1, 0x5CB505C31187, 
-0x1DF3F033355FC38B, 0xF75A7F4EAD436133, 0xAB27D343573BD07B, 0xB0BEF81E1BC7BDE7, 
-0xC099BB131CEAD1F0, 0xE3654D6AEDF6B047, 0xAF272C578B670413, 0xA42C72209FD82E69, 
-0xAAD12D0B3C7B112C, 0x3B3F83A6250992D5, 0x86E35B613E4641EA, 0x458D941027D, 
-0x1B931F7B59260F04, 0x1CFEC5F46DFCFD2D, 0xA5AA9B7D5064EACC, 0x8B4CF44607101724, 
-0xA005F54DA4BFFF8A, 0xC062BDB94EF69999, 0x99990F87A8F8EA54, 0xE3D90169368A89EA, 
-0xDEFA93ECDC2AD3D7, 0x991C86335601E83E, 0x7C63CC28EBB92BA8, 0x29CFEFB67D71, 
-0x7E69E08E24D24DA6, 0xF29237DD9C349BBB, 0xF141889746460661, 0x762A6FF0B9D0848F, 
-0x4E24947C83F398, 0x3A2667F34CDABE43, 0xADD77EE1DAEEB802, 0x9485B5558327A935, 
-0x64D1817FE71F758D, 0x2B8F7BE0E5BD18BB, 0x4DCDB99E7C36EBFB, 0x449340B52E27, 
-0x9B41F811262F1E97, 0xC9809B4AC5409EEF, 0x73AC02A856E89DF1, 0xE6601F8422DD110C, 
-0xD4327130C95188AC, 0x5715EBAC93F0E623, 0x2325900D4AB3202F, 0xE0B706482B933759, 
-0x9F6325B0A4AD573E, 0x400843097CF9F0DA, 0xB62C044453874238, 0x31475CAA5C6, 
-0xA49BAD815F3CF8CA, 0x6C1ABDFC287947BC, 0x25F1C841410F720, 0xAF8E2396CC176E77, 
-0x56B242CFC3FAB14A, 0x6497A86464E73CA4, 0x1742E7AD686EFAAF, 0x7FC9AED27ECCCF63, 
-0xBD58E198B410CAAC, 0x33E8FD9F87434723, 0xD3CC19D4A01EF4A1, 0x5A9FA948A545, 
-0xB32B1E622AA553BE, 0x9CE2554ECC53A620, 0xAE5176400A47EB2A, 0x1C323EB7095CE8B1, 
-0xBD64493714CBDA4F, 0x876888ABBEBE49DF, 0x5BED01FE6BEED0A2, 0x4943CE4C0A58ECBE, 
-0x427226E9FC85A5E4, 0xCD9F4D8826591AF8, 0x856FDB44D8794AC2, 0x2F3856D349C0, 
-0xFE587246369B309E, 0x924FD59BAB28B298, 0x811B8587DBBF7850, 0x3A4EB4B912BF4E02, 
-0xC29040DE185197BC, 0x65C6C3D339D35BF8, 0x8FD8DE2F174D65B2, 0x41C65BA5EC1BDB4A, 
-0x4F6A4D5D9EB89639, 0x315E3A0C6022D652, 0x90740CE63BCD7655, 0x3BCC043F7FC8, 
-0x38CB7BCE9A9BEC84, 0x6EE025F99E8DDBDD, 0x41E38FF2C7AC88C8, 0xC388945CF18000B1, 
-0x48D2BE6A1B5884C9, 0x4D8C9413B49C4627, 0xC4249F1F45D94129, 0x5528B28B00460D3F, 
-0x473FE9EA2F969C62, 0x6F2074A51CF55489, 0xA32CE038864273A8, 0x25384ABEC592, 
-0xDCAB19F8B1647986, 0x862C64F1A5555624, 0xE625F68596D88B02, 0x7519FF7F11CC5F2F, 
-0x2253F133079716D, 0x6AF24CD9F057D207, 0x8C6687F18A2F26F4, 0x91BB159853AA4136, 
-0x6C69EF4DFAA7CAD1, 0xF9AE3B0321FBCA52, 0x14AB8D876909D23C, 0x57D1863E3960, 
-0xDA7FD04CCD5BA82B, 0xA7A5B9E0DBD8F0B8, 0x99A70B685040B84C, 0x8FEB05E6508316FF, 
-0xFE9CB2A7813CF93A, 0xB99548638D49994D, 0x5DDC4B69C829CF04, 0x21B6454083219A91, 
-0x8C4B410B1B59E8E8, 0x51F7ADC1F9549CBD, 0xD5E4E8D30301A0C6, 0x24B62640A04F, 
-0x667B5F3A1E6A4D82, 0xB5D833C182079CBF, 0xBFC0567C4E88C406, 0x8965390A13BBAF9B, 
-0x9982A58812C41CDC, 0xF3E20057114B6748, 0x1D02A558B8D6FB9A, 0xB4103584AD326801, 
-0x46F7EA4CC1908CC5, 0x29A4503E5394D91E, 0x8A5EACE001B8A2D, 0x281E121C5A76, 
-0x6BA7A62AD17441D5, 0xB14999C68DD0E54D, 0x17404F4EF7BD4D80, 0x1F8C0CE9154B3F42, 
-0xD126EDF3AA677B4D, 0xED9E867BFD4816D5, 0x773D1ACAE1CBD3CD, 0x67F70C5E0327CF6D, 
-0x7D3CF31BD01E6091, 0x5EF21CBD55E2F443, 0x22A8EB9DDC4962A6, 0x4663F40097C2, 
-0x2A4CD0A24CDABB28, 0x24F56436ACE1F1CF, 0xAB991AA808AA0DB7, 0xD148B0EE4559FAC2, 
-0xF6AF44D97B8FA72A, 0x48985A6A4D65662F, 0x4862A7FBD6D4A35B, 0xC133BB2C2967DE56, 
-0xDA51421DC603B389, 0xA5715DD1CCC247C6, 0xF237EF36E648BB05, 0x6C6FA3ABCB06, 
-0x5221B477E1E1941C, 0xC8E3E5E8F880E6D2, 0x3E144B8524354C51, 0x172C1D045D3F94CA, 
-0x41F86ACF5FEA302F, 0xE3A93F05E936A49C, 0xF376A5528A0EEF07, 0xC0C097FDD10F05DB, 
-0xE66AD277F774D399, 0xD6D2566D96ABEF7B, 0x4D53B510E973D25E, 0x362D9BB034E3, 
-0x7B313288FED89BE7, 0x9533DF0615CB1BC2, 0xBFEEA11166F20378, 0x513675E284B4CC05, 
-0x16289BCE228CE5E9, 0x7DA3055A848A61D6, 0xDD61EA9E9FB14402, 0x9238A6A2C345757C, 
-0x86D6515E04E79EA9, 0xECD5D0EB10E077F, 0x4A5085814F72657D, 0x6A5F29E99E22, 
-0xB598E4FCBC89F689, 0x26F741262ECE3CB7, 0x2AFFB38F80200B3F, 0x8D39E71BFEC95E79, 
-0xDD093120F114A420, 0xAA4F62FF47C08D0C, 0x946A871D4BE84849, 0x6137CEE88583506A, 
-0x7EF0C1D77F4247C1, 0xC8A09E3A2E2F4482, 0x11C7FC1B24653A0, 0x5276EF49534A, 
-0xC0C67E77D66F67B5, 0x401A5EE8490C4D5B, 0x7AD6B3D63F5FBC39, 0xF5FB60D35D5045EF, 
-0x6AA9E11B7BBD5316, 0xCBEE1C462C1D8431, 0x71C497A2F11C63A3, 0x7098B1749340CAD, 
-0x976C9BA76CE76C3F, 0xBD1148244055D9E4, 0x8955C0DC28D80B06, 0x29C41C6D835A, 
-0x245B51089DDFAFB4, 0x94B20E533005AC6, 0x267E9CB924CD5E26, 0xE061E0A262A367CA, 
-0xB87C5C6F531BFF28, 0x928ACFE2DA7EF02C, 0x36B37EB96F5A9710, 0x114945BDB4E3D650, 
-0x1D9E6BB8C42E00B1, 0x96B63F610B92C28A, 0x18D99CB06D169DDB, 0x6A487D47C2D4, 
-0xD84E28C8E6E77188, 0xCAC714AAC04A38EC, 0x4CD6E6D2FC47F96, 0x1EC65E84813FA5FB, 
-0x4085FB47BAB3D0AF, 0xD4B061C9F8051301, 0x73FA26D34E89E251, 0x5D452715B5C38560, 
-0x2B66343D56B21ED3, 0x188CE5DBDECE1339, 0xA8C15C0966F776C1, 0x430AC3084ACE, 
-0xFF63D7C4349D28AB, 0x63A513ECD82BDB70, 0xFD4531981DD978D4, 0xBD88219209D2E220, 
-0xDC44DE964E811271, 0x490E17AB28FB0603, 0x90260A7731C0937E, 0x6E9E178FFBADCA3B, 
-0x83C64009E2442A29, 0x1C1305BE770A6622, 0xB4F314707B43B8C6, 0x441529374704, 
-0x525EF8844FEAFDCE, 0xB3553CD59405AE15, 0xA2D9FE94FFC1CD13, 0x3A843ED5596ADDDD, 
-0x6C5CCA4757863AD9, 0xED1BCC4261A113E1, 0xC224286F9034BD93, 0x1B78A863B16AD29C, 
-0xAE57DDC312C836F6, 0x9987F485941D3D33, 0x19A3EF66DE63E3DB, 0x2BF8C49B9047, 
-0xC1CD77B99367590A, 0xB74FA4A06147B712, 0xADB1B49E3DD7058A, 0xE6345A4228261C2F, 
-0x962D019FB569AE3A, 0xA4B774106EE44643, 0xF1AD6034F2490BE3, 0x16333FCAE9A2B32C, 
-0xD37ED8B707CBF33C, 0xE6B9BB090F2A990A, 0xCBBE2474C781CBD8, 0x105167BF209, 
-0xCE0895245AF8D350, 0x8BE08F33E735614F, 0xA99587B8C28E0619, 0xF53D7926B999E598, 
-0xF9B38D3D2151137B, 0xF005AFE4734AECA7, 0xA18DABF39A28C3A0, 0xAC6E087C5D28655E, 
-0x7C39E184BC1B07B7, 0xA78C1AF63F3091D6, 0x883D4247964C7C14, 0x52F8B000E8F1, 
-0x77BBC1D31DE55EA6, 0x6679B0E4CF88D811, 0x7431C16877EC9B49, 0xD3C3B58BDA5DA2D5, 
-0xC6672232BC66044B, 0x4238DC93F60C75E3, 0x610E0AFC629B981B, 0x4A6C201B3469E859, 
-0xA9CF65BC861C582C, 0xF8F16F96BFC3E33E, 0xE0CE3DDBE37618F3, 0xB7E7B7B7EA9, 
-0x84B0EED307382148, 0x9412A938A2C0F8DB, 0xBA84A524521449D3, 0x3DEFF1B45CCFC5A5, 
-0x52C2F7EF2036137D, 0x5C074AD9AF76482C, 0x1F59A6BE39909431, 0xF6F266459CE95E18, 
-0xD72B7165D29F4295, 0x7712EF2A9C14ADDE, 0x3EBEBA34C064EC59, 0x239CAAB0B6C1, 
-0xF5FE0395D8EE01B4, 0xC4F3D4BA943F46D9, 0x88FDFF4BC44C93BA, 0x51378150E8A07F5, 
-0x2214403ACC2B0A0C, 0xEBBA9880F1E58625, 0xECE0AC8C0F26F0FA, 0xCA29E2FAEFBE61D2, 
-0xF042002985066D0C, 0xB5F87DC5346BA5F6, 0xAE6FABCE41F94901, 0x7B684330D98, 
-0x4488EB17F741369D, 0xFD9B16E8FC4C5654, 0x9B1D7BBB73189B3E, 0xAD0831BBBF15DA8D, 
-0x8921BB278F152EB4, 0x46E56FCA3765857F, 0xA785718B712385E8, 0xAE6E3405B1873688, 
-0xABB1348B0F6F8765, 0x8AD13141BF73CEFE, 0xBEA0EB4F1F295A71, 0x54D3E2169F1D, 
-0xCD669A406FCCCACE, 0x19AF05B8207727FC, 0xDE197DE483CD9935, 0x874381D10A6FC528, 
-0x22A921B4DA92D353, 0xD00B6B6C38E1FCF7, 0x149F8FBF3DF9932, 0x2BCCE573426F6F2A, 
-0x80F976691C102799, 0x12391E83D27F0514, 0x73185F10708493C3, 0x52ED36B79DB4, 
-0xC0D6B548AB1FBBE2, 0x3E70BA8C514FE8D6, 0xE90B42BC255C080F, 0xFF7B0870B914AFBB, 
-0x90DF6B2765E435AC, 0x3B7CFB7160885B08, 0x3DEA997E15A015FF, 0xC5B1498CC8FC293B, 
-0x25EBC3E3262D7C1D, 0x26324D1BF08CD863, 0x6AF629C8C2426F0, 0x4A1FE14645E5, 
-0x927159B327DBEDAB, 0x62C5C477769F930C, 0x47A07673BAD148E2, 0x3EB09FF7A885B768, 
-0x2A017AE11313314B, 0xF312750E1CE0DA5C, 0x2145AF0BEBD3FA22, 0x981EA0C3E78B6180, 
-0x7D82699874E07F64, 0x63C2DB1AF5465E60, 0xD62AA3C72CA61A82, 0x171FE47A27D1, 
-0x6D4E6461E13ACE69, 0x7C82B930DDDC7DD9, 0x78F7F19C02426180, 0xF9363620A7B97A7E, 
-0x53A1926D0DC5481D, 0x59AEFBD5971E661A, 0xEBBE24A239987402, 0x3F98E910D6FCD324, 
-0xDB0CD92709F3B4D, 0x3975BB55ACB516CD, 0x75F693C70C7DF9B6, 0x627AA24A639F, 
-0x6B5C014B4CD6C599, 0xF1FFBB2CFE12F01D, 0xCA88E81C8AFACAAC, 0xB52DC729AABA8862, 
-0x57EB99590DB85949, 0xA1585E0ADD5E1197, 0x9F927A6BBEBD8EBA, 0xD06EE87661A2E6B1, 
-0x7CFF8B09D8E1859F, 0xE66A83DF909D5157, 0x46ADBF056944A76F, 0x108EA887330A, 
-0xB607AA653621A5C4, 0x44524D1773AB4C72, 0x355BF47A00011D4B, 0x4691796E344AF387, 
-0xE8E6953F5C06F636, 0x90513D7FB15B9F3B, 0xE638592CA33CE5FC, 0xEAE254194F2C37C7, 
-0x52F866798D5CBBBD, 0x858E95DC7F6C4042, 0x7EB069059D03BFC2, 0x22CA25A99F32, 
-0x24E9A72003ACDCB0, 0xDE9830D19727CE83, 0xF20F09F3FC3A9F51, 0xA33E9586E68EA2BE, 
-0x57431F53744227BE, 0x7E6B938760875650, 0xFB437A22219A9DC7, 0xE34AFE0CA1FE362A, 
-0x970B412014909791, 0x77F73E873EA32B96, 0x9229AF601C804498, 0x20A1B44E3729, 
-0x8315532D752B8F80, 0x8A34AD1EF7107731, 0x2182932A35B1DAD8, 0x4B04A645802B5AA, 
-0xA38BC558283EB2FC, 0xB51877C4CCB34242, 0x7F5FFB577B7B2BF1, 0x49D674EF7F25216B, 
-0x1C57FB24B7B88892, 0xCEFF50C39981ECCC, 0xB9AD63CEEA5F2FEB, 0x50E9A1401E58, 
-0xF0E0A95C3B1B3C30, 0x2DC925F94253A131, 0x22C6B9AE13B1571A, 0xCC4895AAB62E40EC, 
-0x4B4584C3270BE17B, 0x6E86A216A2409164, 0x1513EA96DF01F20, 0x9D3A2C0E5561492A, 
-0x65FD2C75E6E76BDD, 0x936833030110190B, 0xB62247A7857748CB, 0x28E13F95EC4, 
-0xE6D5CE340BC24117, 0xD212370AD5F8AFB9, 0x877EC5D8A4B8FF25, 0xE5A222665CCC62FA, 
-0x990A6B5F981AFD82, 0x396E1BAE74556A90, 0xD91A42C1A23D8254, 0xDE0048813EB44773, 
-0xF9AA5D90ADF954C2, 0x7DF49C6533A68545, 0x803948BD8096BE76, 0x19B81D268D7C, 
-0x40C0D6BB002669FB, 0xCE501E08BC7439DE, 0x9B457918A9E4E219, 0x6807070997712D09, 
-0x89B1A080C0BA288B, 0xF8566B2B620C1A44, 0x83A3ECF7EC401DE9, 0xC6E14DF91432CF12, 
-0x6C3E556156785F80, 0x3F37EDBD0A3BDA5F, 0xB500F10B6A5BEBA0, 0x3F16497CCAD7, 
-0x91D69CB200CEBB91, 0x98DBC23ECBCAC13D, 0x14EF205F9D9E791B, 0x60C3121007D77076, 
-0x686D057D0B1EAAA0, 0x2C0A6AF8F4104DD6, 0x75A0D01ACDEA089E, 0x23967142C86DCD41, 
-0x43E6156242300202, 0xE5EF9D2DE245BA60, 0xD135E723F1FA8929, 0x489ED2B57CE6, 
-0x4BF26EC8890980EE, 0xC00C93B8F776D0C1, 0x8ED3B89DD040F379, 0x46BF2CE8876BE037, 
-0x4950B66967C44B28, 0xD20110FCEE3D5E30, 0x924BAACE6B1E8D43, 0x30164333EFBBE4DB, 
-0xA877480CD976DFB1, 0x7DCAE11913420787, 0x317362054E861F42, 0x32D8F85349B2, 
-0x5EABAB8D818A18F0, 0x9F840B651EE7A91E, 0xA3B96E8F75302FA, 0x28C89556CBB98458, 
-0xE15461DD52A76358, 0xA442231D000CF374, 0x90758F3A7AF12D10, 0xCEA991894B186A15, 
-0xD2631D671BA5649A, 0x5E4DD6D56CFA8DB7, 0x568DB9BA6175FFE2, 0x6EBC53944E31, 
-0xD08600FC2867997A, 0x946AF6BC34683D3B, 0xE41044E4CD33A884, 0x723B7EC762E08AEE, 
-0x356D8847646CCAF0, 0xB3E5039E17AC2588, 0x6174510EC7CFD92A, 0xAACA7F6E7DFDB69E, 
-0xE1ECF3DCC093FF20, 0xC4A54BF02EE67C8C, 0x1235B92C6985065E, 0x3D2FD4DD2A82, 
-0x678EA22B3B924199, 0x7AEB0A5684192A1B, 0x99DDED4AD933EBF9, 0xC585A9CE660033D3, 
-0x51DCC6EDFC3B3475, 0x2C6164EE6D208E4B, 0xBAD29DF3442E5D8F, 0x71C31C21B4FD15B9, 
-0x28449F72F12C4C58, 0x5A7A4E8911212F9D, 0x1EE53B06E3736D16, 0xD30F47C0FBB, 
-0xA241E2E999882476, 0x395C0BF0A38F189D, 0x95B9A52892C69FE7, 0xB063A68ADA05A1FB, 
-0xED18295BD5588AA3, 0x2651E07B9B5A490A, 0xFE76ABBB90F564BD, 0xDD4CEA99EC5A7C45, 
-0x8B92800AEB02B0A, 0x8C71BA4574C4A534, 0xBDED467142957A10, 0x6EC8EECFA2AA, 
-0x46C3E89210104E66, 0x1886ABA2C9CA64BC, 0x2EA2849EDEA3D205, 0x4302B266839F438C, 
-0x8A12D7F8BD0807A4, 0xC34094485AB98CAA, 0x8F3ECBBA8985A974, 0x8C1AABE1CD076770, 
-0xCB05257E531F83CE, 0xD69D7D662F53307C, 0x39FCE58EBE499AEB, 0x6B8CC0C0BD4, 
-0xB22432611648BE56, 0xA020AF81786B4E0A, 0x906DF62098471477, 0x4295975E76A2C465, 
-0x6EAFC3701CF4AD34, 0x2020D83D76CDCB45, 0xD7D99363E787E108, 0x46EFB6F3E0F2E411, 
-0x8AA2B4F655B77CE1, 0x11751E4A59047A42, 0xB936861DDEF25C76, 0x3D404D93A8AE, 
-0xECC4691A0AE34AE2, 0x11C32E47EF27D3B4, 0x45A38CB902791ED6, 0x536BC60F45F8C600, 
-0xCA5F571E0BA5A60, 0x41F3FE3AE0039685, 0xC4523471C99830F8, 0x85C6A3A7517C0895, 
-0xAE529019D8C45B69, 0x87BFE4A67E61FBFA, 0x48B97970E1448598, 0x172AE952AC0B, 
-0xA0C077A954A64483, 0x3AA810876B8CC582, 0x979C93349A1550F7, 0xD843EA991A19A88C, 
-0x14C8C9ABFE2ACCA0, 0x97D817B347C396A, 0xD247CE67B54A119D, 0xD3C194DE396BD208, 
-0x9AC4DD3B7BBD66DB, 0xBC4AE61B1D4FBBF5, 0xAFC2E83B75BFD54D, 0x672CC7C35E4A, 
-0x33E0AC7A39500DED, 0x93CAB51793C88775, 0xE62526C6D3093075, 0x299F016E613E0CFB, 
-0x3E7D0F9150FD1BA8, 0x6A7D93E6A37DA3DB, 0xB0BD2C318F4A73C0, 0xDC25853A9EF92268, 
-0x40ACB52FDC3BADDD, 0x650D1B34A01F3087, 0xD01D3EA7E46A9147, 0x4B92D9FB082F, 
-0x23E0E24BE5939909, 0x6396375D5E610780, 0xA57EC98F24167959, 0xAD7ECFC0F941A0D2, 
-0xA5D7D1A3B815D61D, 0xDFD0DC01A972F70A, 0x15FE42303BD101CF, 0xDC863CCFB28E312C, 
-0x2C9B97DFA1C9E952, 0x43E22868D4B27F62, 0xC17A8527EF8703E8, 0x66B5AFF5E753, 
-0xC5C3B2236241FAB2, 0x26B42F962BE63084, 0xCEA4D3B92DF508E2, 0x7B8E8FEFF40582CD, 
-0x9CA5241D7DE02240, 0x1DB2F24EAB5D719B, 0x1F231D6E66A570E7, 0x2CCA882EB2ACD0C7, 
-0x84114F30F9063A63, 0xF78E351DF28B6E83, 0x8BA55D789C53B041, 0x6BABE34D5CC6, 
-0x14F1451597937F25, 0xBC0CFDE05991E777, 0xC41546D7E26F6148, 0x529F40D71BD163CD, 
-0x99349E6CAB1B033A, 0xF8662E80F11517CD, 0xBB7A3A9FE5E90494, 0x1306B7175A829E09, 
-0x4FC1379DED9E6FE3, 0x65685A622AD45F9C, 0x38FE389E2095FE17, 0x2D6E115C46A0, 
-0xE16B109810287F66, 0x96815A27A0487EF3, 0x56F4B860650DC64E, 0xE6F0690FDB1CAE64, 
-0xC65B9350FF3D0292, 0xEA527982DEED141B, 0x33B92621C8ED41F2, 0x56710A08BE8CD72A, 
-0x7C01BD9715C8D17C, 0x3C85C7E1D5C4A91A, 0xBF070E1CAC453352, 0x1CC6AFDBA574, 
-0x59D5362DAABB2711, 0x6316ACAA30527A6D, 0xF00EA507AF397172, 0x2F526BC0A7EE2074, 
-0xFCDC3E5FD4E4EB5A, 0xE644B20F1F796D36, 0x86C347E333CCFE9D, 0xEB54B53F32969592, 
-0xC311ACA2FFAC7EF5, 0x77F86D3C9F52F292, 0xAD52D66CF612F25E, 0x162BBC063C89, 
-0x52251A2D74E7FE85, 0x58B71AB598F10589, 0x318A04FA8C8505AB, 0xD7F92C81660D2B6F, 
-0xDD3E349B32CF2C94, 0xBC4F373450FB4A53, 0xDBFFDC7C9ABE998C, 0xB08B2B135D3B10C5, 
-0xF7603F3E01B93238, 0x7A2329114ABC8F0F, 0xD26C4B7828D11263, 0x6E4038CA8B23, 
-0x748D93B5269FB0DD, 0x840E05687B61A9E7, 0x201F578406A1095E, 0x14E6C6944BBCF238, 
-0xB6057DF4B6C656C2, 0xCB45AAA6D72DA710, 0x32DEE68D972F81A6, 0xA1B98905736437E7, 
-0x38AF248A5529AD1, 0x3259B5E36E0EC97, 0xE122FD2B9A04D630, 0x197F37593EAD, 
-0x4CE1832BAC2D64C, 0xD7F09FA00E149F3F, 0x82A85E0007ADE4C0, 0xEF44AC38284B72C6, 
-0xA6DC6BE3515C75E9, 0xEF10AD7E60AE0A40, 0xA10EB56CC01CFE69, 0xA48D48667403A14E, 
-0xEE6D876262C11D1, 0xD327606943BD612B, 0x3FE33B973125D813, 0x1B8C05C7E89C, 
-0xF2FB734ABEE8E86C, 0xC27CC6756D5C0C4A, 0xE271D69A43F6D5C0, 0xB2A6F227C50C98C1, 
-0x797852F196B1E8F7, 0xDC418D4692D46F6, 0xF13E92978B5FC44B, 0x531B403CECF7C717, 
-0xCFC09DA93F2C32F8, 0xEA36699B477CDDB4, 0x3E077B768F72E51, 0x3007D7A74623, 
-0x644F377930727884, 0xA590A2D007D1486F, 0x45938222F133551E, 0xE7B8A03ED47A28C5, 
-0xD4C3CB4DE564835C, 0x20BE8E85D3F80EEE, 0x9F131555BD967697, 0x9C3EAFBEED4676E2, 
-0x2AD579FD50E9B1FA, 0x44FD13A02D8D9441, 0xE5CDED662420E09B, 0x7D9BA1C1663, 
-0xEB15EEAE32D815, 0x85E84965DB93181, 0x4B4C5788B1674A99, 0xD73672B8EF6DD0C7, 
-0xFA10D30F63778583, 0xE06DEB351148B2AB, 0x774A7841D373E8E5, 0xA47815397953D993, 
-0xBAB718EEE2D1D537, 0xC5D10360A9F827DE, 0xDD2C5F12EBD0668, 0xBE682FB865F, 
-0xDE12E9E94617DB2A, 0x816C3E5124471CB3, 0xCE1CD1C0F01EC62D, 0xDBDC3B4A25EE9A39, 
-0x3958511F510F781C, 0x4B78A72EB3541378, 0xAFF207F198F7D492, 0x7F7BE9CFFAE8E3CF, 
-0x4E6B3DD8BBF20DD2, 0x63A8B7D8F05AAADD, 0x53734097B77D1604, 0x15CF1EA9E8CF, 
-0x2BD372A4841861CB, 0xD0F404A3F0FEDC23, 0x318505E0180B4430, 0x57AABFEA219F760, 
-0xD23199B501DE28CE, 0x9769D412F60BE24B, 0x62891F0658B109B7, 0xD4A21620F2351B33, 
-0x10D2E50F09F187EF, 0x9CB9D09B4F3E3179, 0x7F54DC1DEC456B4D, 0x5D7FFCC7A0C1, 
-0x50515D4DC074771C, 0x7FDBBFCF76E8A94, 0x36E9121103E571D1, 0x4D8BF742EF50303E, 
-0x2A4F186F5B9AB58B, 0x99FAB9B5A0D3D552, 0xD57CC1DA6F4DA1F1, 0x8C065B1C59E014BF, 
-0x5434ED33F2B46B42, 0x17E5063D2DE3C014, 0xA9ABF45C3D7C6FAB, 0x57B4A8EC691F, 
-0x9C0694EA3EECB0D2, 0x1B9A2DF30AF89F89, 0x27B34019EA576432, 0x8C50662FF337EEE9, 
-0xCDF6FB6D1B06F6D8, 0x581FD97CDF8C018D, 0x4CE448631D617506, 0x3A9272EEFAB145F0, 
-0x5E22C206B9F60914, 0x590813B0AE627004, 0x93C2A83EFE391E2D, 0x6EEFD66E8673, 
-0xCFCC1AA3BE42FCDB, 0x4026448B88A61492, 0x9564F1DB6EF74D73, 0x4722647EDF13824, 
-0x9D54A3A20F1E4C11, 0x298EF72F5668B149, 0xEACB76EDE96A9097, 0x948307D89463C82E, 
-0x1B64A2770D4EF2DA, 0x9B8C6ED87C17182F, 0x843E6B78C200B111, 0x2C6AC78340B6, 
-0xD8078B7C9475D113, 0xC1ACF17F7F5C567A, 0xD3C71E9AA94C8ADA, 0x60DA9D0AC89259DA, 
-0x3C4BEF50BFD0905, 0xC9BB9268ED3E0F64, 0x37D7E4B14FBD48B0, 0xB3C96C996E728478, 
-0xC6E02C0BBC5A0DD5, 0x2C6FD29187FB4B65, 0x271AED8AD2B4B773, 0x164B5B99C1A8, 
-0x4B6CAF441F2CD56F, 0xEF9221D3815F4288, 0xA2F09BCC119BF249, 0x756D73E20919AF95, 
-0x1A30513365969258, 0xC707FB7AD93F7327, 0x3250C670EC69F3C3, 0x79BF1E7E1B4358BA, 
-0xC33D20BFBD6883A3, 0x4575111382228D8B, 0xEA4BD3B29549A73E, 0x368DB3773156, 
-0xB198E0A15068941F, 0x5FCB4DD26F7D0E20, 0xA4D15223F9A46E51, 0xDD7AA553F6244604, 
-0x1E64F445ED7382E0, 0x7225F9C56B02AE2A, 0xF9EB3011A7D7103A, 0x4B0198F6971993C4, 
-0x128AF0AA4D0087DA, 0xEA3B1014853476D, 0x141BC2D6835C2440, 0x47BC304B1119, 
-0x77149D26F0EFC38, 0x2C047AF3209D9820, 0x3E940D185AEC1A96, 0xE5B16052A0DBEBFB, 
-0xCD87E89D0F7C5EDC, 0xADBDF618FEF4F4CA, 0xD2E4A3EF1B2C616C, 0xEEC02C4AA147AAE8, 
-0x72D153D42B757AC6, 0x518AB03A35CF1153, 0xCB03AAD2A954BF40, 0x1ED4E0B000B8, 
-0x581EF110686C1B72, 0xEC2404F508352414, 0xD10CF38E501098CD, 0xF7C70174971940BE, 
-0x9D5A9669A2E27F6, 0xD899AFFF7423ED68, 0x1C7B82B7980B71AD, 0xA7095E6AC290CAEB, 
-0xFCFF8F29F394712F, 0x16401329DDC3AA51, 0x1116FBE80E57E5A0, 0x6CF10744BE6B, 
-0xFDFE7E6D875EAB9, 0x8617FA63D3D62B1, 0xAB7EB3DEB2030A60, 0x2DBB65417BC8A604, 
-0x8668DA25499FF4D3, 0x37EBA0D05095A2F2, 0x3A588ABF0615C230, 0x3734386FD97093CC, 
-0xD41217035391D67F, 0x646EE3C2BB610036, 0x6497485A74B0E913, 0x4980D8E60FDF, 
-0x45CB3AAD80F37B4B, 0x1F6C0697AC0232A0, 0x7709463AA9789DFE, 0xBEBDCEAC22AF0641, 
-0xAA966E45EDD567CA, 0xE46E566279EECB5F, 0xE085577EDDD6F9C, 0xE02AEE73C99E9CCC, 
-0x3E6703F1A095345D, 0xF42A2C03AA57D4E6, 0x79AF6ACEE0296692, 0x46C66915398D, 
-0xA2EE0B500D293133, 0x7B349D68F1B23551, 0x22D5A9F784E5F4EF, 0x4F2B88A3DC566717, 
-0xAEDB116C9BB6EA08, 0xFF046D4BF07C3DFD, 0x45064348209EB8AA, 0xDD89F7E3A28DCD10, 
-0x90B3070B2C885E1E, 0x9F817CAA12ACAD0E, 0xC1ADD868AD2206FE, 0x4C3D18414B1B, 
-0x7FBF11339C610FF1, 0x9C8E7AAB513D4434, 0x71DC655558688BDE, 0x41BFDEF624889393, 
-0x8B0C8587CAD759DE, 0x2DC4A6874B5BF96B, 0xF2DBA1D7788D277C, 0x34CBF630F9C99987, 
-0x20ACBFCBCBF84835, 0xAD9196E284DB9836, 0x3B2A3E45A7A374A1, 0x6AFA0347B3DB, 
-0xAFDB6CF6770D535E, 0xCACB7E07D4D89B1E, 0x3289C5546E30BA00, 0xB6BD6A14EA6695FA, 
-0x7FDCB00DD3404699, 0x6581DB5BF5E8DAE1, 0xEB8434A73BDCAB92, 0x1DCAE6FCAB7D1310, 
-0xF416FA7EB1EE7285, 0x60656DB51CE55F8A, 0x71F382F8F0043604, 0x6F106DA72D44, 
-0x9A71B670D65DFCB1, 0x10958F42B106FFF0, 0x4B6542397E19C58B, 0xDB1BB0F586819DF8, 
-0x4DAE8D8DED112A3B, 0x5421899C475957F1, 0x30FDA6A0BE8A0288, 0x45EBF798AF002AEB, 
-0x91FA1C6422FC1847, 0x4801332658E69D0A, 0xD88EEFC74FFCD8EE, 0x59C2CD2E9944, 
-0x395263570DBD5627, 0xEF53A9757703DF4C, 0xFB6006920C04156C, 0x9B791DC0463D7133, 
-0x209C0401592B8BB2, 0x472A2BEF2C3F00E9, 0xA83C184A2E4B5405, 0x5B53D6A28D3C430E, 
-0x2717A2B8455D767, 0x49C45913A5EE4A1, 0x49FBE73F72DEEEF4, 0x22F1FC5AC06F, 
-0xFEE4E375194556B0, 0x8C0029CCB6FE7779, 0xFFDB61A20F236A1D, 0x661C1103B1092331, 
-0x70798D404546EB, 0x2AFBDC1E170AE851, 0x4A8A307E9DC9AEB2, 0x5795DE1F281A9C34, 
-0x805B852CADA17372, 0x1B41671363F98DE4, 0xFB74D9CC6A5F38, 0x3731332CDFCD, 
-0x938CBFDCBA327464, 0x4F17B29A37543F28, 0xD3B0F93E6AF36859, 0xCCAEB8793EFBD04A, 
-0x6C81AFABBCE950A7, 0x680009DF56E8ECE1, 0x3A534A264860742F, 0x5E89ED27FED48E04, 
-0xAF3EA57D1CE9C09, 0x379CD7850053FE1A, 0xADF828177EC47013, 0x69359C48FFA7, 
-0xA9C3A0E9AB9FD900, 0xAAACD7935979626C, 0x85EBBD9A886CDB7F, 0x5BD0C0ABD0A88EB4, 
-0x3FFBBF96EF941809, 0x504FEE135CC9B98C, 0xFB759E7C71153E45, 0x7F96DC581E966831, 
-0x755AB8231673ACE5, 0x9A60146052AC77EC, 0x28951C008F6A05A6, 0x3FB9BFC6348, 
-0xB24C617CE7FFD23B, 0xD656C66D0FA8BE88, 0x959B5F8B9D57EDE9, 0xD1AB1DB9CD667C11, 
-0x94F7FBC75E2EA1DB, 0x6040442C09F1A086, 0x3E0F5CB8C0E74CDA, 0x205B10331DB04D75, 
-0x69E309938B820B49, 0x5F4D38A8FA897E1F, 0x38203DD813EF7666, 0x3F25FB756117, 
-0xCD3FFC0412454005, 0x464AAFFDB68A0723, 0x210B437B2B9CD68F, 0xFC7217096E03646F, 
-0x7E8D08A5BE60D9BA, 0x1F10BD57C15A4294, 0x4D9684E31921FB57, 0x5B2BEE4D8361171A, 
-0xEA007A4E35CE0223, 0xA656233E93A426C6, 0xE0254C1C02DBD656, 0x46E4124303C5, 
-0x83D2FE8A052EA090, 0x67F8A2A645ABDBD, 0xAE6114185C1DA29C, 0x98E62B23E2E9B312, 
-0x6FAAFAD1506EBE3C, 0x557DA85CF10F1394, 0xC0B3CC6F924463F7, 0xD2FC36BC15DD8539, 
-0x7957E830C9B883D4, 0xD1F150B6E163EA10, 0xA4C70D4A79A66651, 0x18B708FAF8DE, 
-0x3CB4FA4FA4366D3A, 0x230DC0C78073AE15, 0x35906BB42F21058D, 0x827530C985F42FD, 
-0x70A7A8D24A68964, 0xFF8D88D0B7288F02, 0xFA4B22F9EE1E3639, 0xA0CA07B0F0407A8B, 
-0xA47E5D94727FF6A2, 0x2C661C3657AB8FA6, 0xB027B023DCBCB0F8, 0x625F60022E0C, 
-0x980FFF865C2CB629, 0xD29263BF54C770DF, 0xC4C5E468EC240644, 0xE38E2666C26A2123, 
-0x98119195934FE155, 0x378A856B0DF0A76C, 0xAC2AA7042AD62FF, 0x614399A51ACC42F2, 
-0xA1B0F1734B7BF947, 0x8D693D638CC37C5A, 0xDD5B030AA92E7FC2, 0x45E1D516CCC0, 
-0xB3E8E78D48178503, 0x779EE6336645F217, 0xE8F99B19CA8FA4AE, 0xAA24C5B95EEB86D7, 
-0xA06454BC663EAD33, 0x1EBFA3ED92B54E92, 0x89CC20FE3A8B8089, 0x7747005EB626B9BF, 
-0x7B42150761FCF99C, 0x4FA71C44DD3AAA93, 0xB87922D1649FD3D2, 0x53AE65CF0693, 
-0x50D2FCCD66415CD7, 0xE14CE9A8CF620524, 0xC190491640DE1977, 0x4E52CA10FB0D818C, 
-0x2F4AB7098CE097C0, 0x29C23B9112E890CD, 0xDEDD4739F5A2FBF9, 0xE35AF5D5BF025B41, 
-0xAECEBCC3748C3E1F, 0x446B45D47771A574, 0x3E776FF6742F8DE6, 0x10BF646A594B, 
-0x65BE283BF0DFA9EF, 0xC3AA41475BFB127D, 0xAAC4C12790DEE76C, 0x6372EC25B52A5CCF, 
-0x37A3DF86ED0745C0, 0x1DC4E4740BE6DADF, 0x788BA4D76D3ECB72, 0xB58E38FD4C339BF5, 
-0x1897CD4D23C93E62, 0x819D0791C2BA9FD7, 0x15FD5F22E54300E9, 0x64B30AD6F440, 
-0xCFEE6A65B6466E77, 0xA302CF81E5020E5C, 0xF9C78E04A724A77E, 0x87361FE025EDB86D, 
-0x5AA921B6CFFB7AFB, 0x360BCC98FA585F47, 0x96D14C8C2CBB2EA4, 0x48D0816EAEEC32E4, 
-0x7F6E4DEE387CD03A, 0xC1F24784DFA6FD38, 0x8ABC413BACB5CE4, 0x9C3D77D9336, 
-0x89BEFC2D06363C40, 0xD6541972C5145E88, 0x54C03E7CE4E362A2, 0x1D51D68805B46D26, 
-0xF1A49901A5744170, 0x5AA0F0DD369F2C0F, 0xA1547827BE903F39, 0xA557949E2C12E851, 
-0x739DA66FF49135B7, 0x40A6B07FE9F52EB1, 0x6F4EFCAA3F45A38D, 0x292D96633AFC, 
-0xD135CA90540099B0, 0x78AF6A022ACD48A0, 0x34C076EBBD0F305E, 0xBE9FD3C2F2A27147, 
-0xE9F1F186DEC9D54C, 0x7A12A97C7390FB48, 0x352BB58F7BBF2C03, 0x4B5FB1C708680DB6, 
-0x925D8276037466C0, 0x2AE6F7D15B464295, 0xBC6C6B1F0CFA2555, 0x1751CFE5A5F2, 
-0x12B6052CD5F08282, 0x2BA72693FF4D6176, 0x1E8229E0D8D0C030, 0x641FFFCC05B429E0, 
-0xF4FF83DA680A21FD, 0x1D27D4863061FC11, 0x91EAA59D43B1E657, 0x12160B5146C230C, 
-0x7DA92B2797BE361, 0xC00698B1CA46CA04, 0xE97D2C1CCAA9C90C, 0x4F8372827ED4, 
-0x8CC4C664F491CE86, 0x2D3BFE74571E788C, 0x85A2F05ADDAB1EA9, 0xC17EAD72747BD4FB, 
-0x6183F9A529D20382, 0xEC2C988244991136, 0xD532C939A1CC430, 0xBF6206611B03C244, 
-0x6D0DAF987C3963E1, 0xA17631E9585B9920, 0x94491F176857C7DB, 0x1B9478AF1F64, 
-0x6F05FDFD3D1623E1, 0xC80CDB811B379378, 0xAE8A5F407658B796, 0x30B9C0A2A527F752, 
-0x2D18A8B9ECF77CCA, 0xEA11D01E6C6E5AF6, 0x4951C9E4D3813806, 0x9CF7DC95FCE447E2, 
-0xBB82AD2FAEF0404B, 0x69DC05214A3B4239, 0x8A92F0CBABD57149, 0x1CBD7077D8DB, 
-0xB5C1928CBCB7C805, 0x1EF6A0B12BF5258, 0xCC531D36CD306232, 0x59532A6946C5D6D4, 
-0xAFAA47DD9605CFCB, 0xE36A7244A4EC7D97, 0xF5B54ED19B2BBE98, 0x58177DD05E0C8A63, 
-0x4295C7F08CA10D67, 0x23F5EE968C585B7B, 0xE3E9C5DF2E928F71, 0x647EFFE0659F, 
-0xD8794C51FDCB54A1, 0x11CD818EF02CDBC2, 0x35D385B2984C91F9, 0x6721D95C7A808EE7, 
-0xF454C19883607F06, 0xBCCF9496A700276F, 0xB14779C1B81CE1F8, 0x9D64243102552EFE, 
-0x49ED4809B3CE9D33, 0x5525D6070DBFEF49, 0xE6CEBDAEA20B9DD0, 0x3F8AECB4D905, 
-0x394DBABFE2C0B692, 0xD61D4839F58BAC71, 0xB60831E9558A34B2, 0x226C08368F62D925, 
-0x6313BF844D6FA6EC, 0x6D471AF38EB30F5E, 0xDBA7FA2D0C2D0143, 0x6FDE2AF139717777, 
-0xC9E218D28828E5AD, 0x92338D33025C09AD, 0xE6F117215647F12B, 0x2B7FCF4D6732, 
-0xA55EDC9440732E9A, 0xE7E309B34AF0FB50, 0x876ECC47D912642C, 0x9D123B81DD3C33C3, 
-0xE02E1999CE822031, 0xF938E291000C27B, 0xC6E42816B7171033, 0x5A14CC946909E520, 
-0x14EB3D5B1BB33F53, 0x1F61E396D8517C28, 0x13DE166C43563665, 0x15E51040CDB2, 
-0x41B525E741B6E965, 0x96EAC79ED515A25E, 0x36294C28BCA1203C, 0xA598741532DE8F23, 
-0x7B6829B103024CA2, 0x581C01C7318579F7, 0x5880AAE6E3D4318, 0x2BF27C6D4CA44C19, 
-0x77D3A52A289D76F3, 0x5DE21D582D664BF8, 0x9440ECC2D8DD4703, 0x36AA7AB7B73B, 
-0xDCC077B7B34D31C8, 0x576446E156ECF07F, 0xB12BCD6C757F0F53, 0xD09A69F7C347ED1E, 
-0xD1432A5694F098AE, 0xB79BFB2A5380CE87, 0xCB50936DA2F829B3, 0x50D1EE2A3AD7A2CF, 
-0xF306F7D20CCDEF60, 0x735D315C7DB0032D, 0x86F9479A6EC71F48, 0xC407BCE7D0, 
-0x22AD52A481B9B223, 0x9C24AAF2A40147A3, 0xFB26E401C8434FC2, 0xB07FC5048790D2EC, 
-0x25B8442785A9BEAE, 0xE600A85A1478A231, 0xCF1210FCD5F550DA, 0x98F269FFE8C5C355, 
-0x3A9604A83875CF0D, 0x504C881EFF956278, 0x346B1D0CC2F36CFE, 0x6F3A2BB05CD8, 
-0x40BD271AE720CF66, 0xB9EB4181FF187BC9, 0xD36FC9D776E17DCC, 0x8DCCA7E787C67A95, 
-0x73899BD263B3070E, 0x8E12FB79F9665841, 0xB0E50001230AE690, 0x537C99E90978E398, 
-0x2C6F6F395A541051, 0x926DE0838E0BF69D, 0x745B672548960896, 0x1C11A67A821E, 
-0xA134407C76809FA2, 0x44FD78845EAF71E8, 0xC785634016CA3623, 0x691D5DBD74A9A363, 
-0x30646566970870A3, 0xC7F7C8171ACC87EB, 0x8ED8486A2C890A80, 0x12A37A458D9626F0, 
-0xDB0AB6414965D724, 0xE53C035A68BE7DD0, 0x6FFCC2C9A0919414, 0x3B889FDECE4D, 
-0xD545F8177848BEC1, 0x6132F553B62BE692, 0x2BBC52F2AED086C5, 0x16D21BD5570DFBD5, 
-0x7E92684D93380A93, 0x1F8038D0A7E013D3, 0x84CEE312A8652830, 0xD4E2700D2A85D680, 
-0xB10297C33F9B86B5, 0x960A1324850FA234, 0x61B2A8CE3CA3382F, 0x36A181956E67, 
-0xD9244D8BB80F883E, 0xB51EB0000ABDF5D6, 0x4F9813E4DB310665, 0xF616F3E49B3EB45D, 
-0x7D20E9E0753CAD84, 0xB0544B66C05F5C7D, 0xCEDFDC4F97829EB2, 0xE03CEB33046CF5CF, 
-0xBB320AE5909BACDF, 0x874DC7AACEDF9E8, 0x7655074227E64EA9, 0x6CF8AE8928B1, 
-0x7AA9BBDE588817BD, 0x63696990AC65FA33, 0x184D08ECAFBA1B08, 0x9B96A5C5B6E40CC5, 
-0x25EAF3BB32F0AC89, 0xCD548D279944BB0A, 0xCE3D95541AC19091, 0xBEEF3A18E8407ED7, 
-0x52B8ED0A99BB5CB1, 0xAC3DEF44AB6F1055, 0x689BE5D9CF2B6A22, 0x50D5B78E5B8A, 
-0xECC333FCF8AE5188, 0x23C26D1B01E292C7, 0x36E71218CF0164CA, 0xEFE503024FE58395, 
-0x7EBF65016CCD1E72, 0x85AED883C53D016F, 0xFE7061806CAFBAF1, 0x405DEE439B09B08C, 
-0x6D7560F82B66E22F, 0xB2804634C58F646C, 0xCD18BEAF9DF8B3E9, 0x6D0EC61DC3F9, 
-0x4163C5944F0F9A7E, 0x3A0055DE44A8460A, 0x966F108751639ECE, 0xDF4D00E490F7D54C, 
-0xA8F21076B200ACCA, 0x6DA8F232AAF21623, 0x27D1A1A352A91E3D, 0xE7D6D56C6FCCA194, 
-0xA36393A9B318DD6E, 0x4EDAC9A0860C80EC, 0x26BEFA9AAD53665D, 0x65E1B507A5E7, 
-0xC78B190BF30B5AD0, 0x6A641ED702C6F3F3, 0x6D11A68D5E3B1A08, 0x41727DCE94618959, 
-0x6433F0F2FC055C58, 0xA770EB44C44B9DC7, 0x91BF6232DA4F7AE, 0xE8892012D31F35C5, 
-0x56D03C99A99DB182, 0x36FB3A49DB87732, 0x4D08A374F20F333D, 0x66384B489071, 
-0x1CFDB8E0E8FDADD1, 0x89B2CD455065017D, 0x8F73632E68F02E92, 0x4E080E0DF0C3BA19, 
-0x6FBBF9932DC8109C, 0x2142DFBF31760DD2, 0x12EEE0D984A14590, 0x61DD54AEEDA9FBD, 
-0x6D4D3DEC7C2111A5, 0x48DF3E193E357C1E, 0xBEACBA8DCBF127C9, 0x66E77F7D108, 
-0xB4614AAF0E76AE66, 0x84CF52BDB4AB9807, 0x3C7278E62537DA4B, 0xD5C2AF5BB6CC4E55, 
-0x8E12D8185D12339E, 0x716FF6CD7754D2FA, 0xE5C67418ED5E465E, 0x71485978C22F5C8F, 
-0xED65E94734417266, 0xF87EB744AF5B355, 0x165441A9558F6507, 0x41F1C8EF9BA6, 
-0xA30DA88E2F05F8A9, 0x29F9C1AFD3A6E260, 0x3DB8FBA2CE40E2B9, 0x1F9AB6C4F8C3EFDA, 
-0xADAFCECD84EE2BF, 0x25FF952291E31709, 0x6CD3AD7CBE652243, 0x8CE0E0EF62BADDB8, 
-0xA3550132AB76A2E6, 0xEB13E2D9A2FDA673, 0x5B297351130F325D, 0x48B30F10FDAB, 
-0x9DE6744DF744A8F1, 0xA66E626FDBEA8921, 0xD79C07359E31D85D, 0x4A9E5139B2CEADE5, 
-0x9860F39027D57686, 0xF9A87B0F3C8571E2, 0x275E8A9F2B84809A, 0x2A14C30B3E6920F4, 
-0xBB08A188F9973C60, 0x75B57251695BF64E, 0xA02D85579032BA1F, 0x51A2BE1BCD87, 
-0x989A954A33383B2A, 0xD76203DFAD94B654, 0x3FA33F9A9269AB57, 0x837A1441B9A4D228, 
-0xBDCB671EBDB4D71E, 0x9F6F719CB39E77EE, 0x921F31E3CEEF7C29, 0x8907F8AC8277BD0C, 
-0x2805E57BF005B237, 0x1E802061E91FA275, 0x2617C71F2883A3F6, 0x51401BB4413A, 
-0xF34544CC336FE41F, 0xFCE2D19D3427DADA, 0xCD0A776CE8A3B15E, 0xDD98CEAB285120DD, 
-0xD9C65F3976A8C0FF, 0xD9D1E9F2DE3EC1C7, 0x1A1A2135687FE6B9, 0xBDACBF26FCDF178, 
-0x6EEE5BC78CDCE93C, 0xEF42912567DAD0BA, 0xF07F4ADF49055B7F, 0x51477D5F99FF, 
-0x44E8AC1E5A62C61F, 0x5DC3C6E137449EC1, 0x6062D69CFBA9F017, 0x8BE3DA76F0EAA000, 
-0x256B1ABA5B33FE60, 0x2C99E5D594C53F23, 0x7A644E0062822606, 0x578C016ABFC97514, 
-0x5CB72F69FF3B3BA8, 0x1E8F73732E202B98, 0x9B615A56BBAA7608, 0x22FCFF8458C3, 
-0x587161CDBAD0243E, 0x64A89B27B5A9A3D4, 0xE0A5296DC4FF5AE0, 0xEC4C77E85013C8C0, 
-0xD6812652F676C157, 0x13D195357A11C5EF, 0x7A43FF9B7FD1ACE8, 0xEAAD25706A673623, 
-0x5545B07B38522E0F, 0x32DC17FFF552DC0A, 0x316AF1882D002527, 0x55B294578CBE, 
-0xCB263223B5AA849D, 0xD4B625F7DF68676E, 0x87BCCA0CDE4841BA, 0xB3E763DF0C908D77, 
-0xA69BE5803DBFD592, 0xD3F535BF5CAC24EC, 0xBA34A50F2EF5E858, 0x2D468524F8E4A357, 
-0x735CD7D60C21681D, 0x848810B8C92E2C49, 0x6EA17A308837FB7C, 0x68E37BC6F250, 
-0xD17DFDD063AC17D1, 0x756CB25AE0F2E8F4, 0x6C3140A159C21A4B, 0xA5BCDA3201E8679C, 
-0xF05C7481680DF28, 0xD5C3C81631181F05, 0xD7319B5E6C18E2C, 0x54C877D70064E18, 
-0x31A069F06FF86286, 0x259E898CC2500F0A, 0x77C01A7AC21B6087, 0x9432B01F6A0, 
-0x4FE01531684B20C9, 0x1E1D7075711F1D1C, 0x9AEBD9623218FBF3, 0xDEC2AF0EC75E8CC4, 
-0x92B12E3DE4BFC2D9, 0x103B11922B15FCAF, 0x9F2C3D28A458FA23, 0x8D5568D062F38CE9, 
-0xE185DFB63621F0EB, 0x5477B6877C3939F, 0x7945CEB76F27701E, 0x6D4F1097029E, 
-0xA7C581E520875DD1, 0x723AEB1419F1FA3C, 0xA91E801365C64C0E, 0x137638B2058899D2, 
-0x119347FFE9A48498, 0x21C10A4E63B2932D, 0x83298BC04D2495E3, 0xB8B75F997BD26DC1, 
-0x2396E98784BC7CC8, 0x4CE01E846A0CD02B, 0xACB458CA563B24A3, 0x1AD28D151488, 
-0x38C14DB9811ED202, 0xA22997B372AE8A87, 0xBCFBEA362628B63, 0xE80EABBA9E1B4784, 
-0xD67D750EA4DCD5C3, 0x92DFB05D6A5687D3, 0xB5CDA057E660E2C, 0xE63EB27E765E6587, 
-0x2B0D951ABFE34E41, 0x178A7186936C32F9, 0x8A0418A8D0CEE8C7, 0xA0ABAEA2821, 
-0xC060D795E56B149B, 0xE55301C8F4BFAC69, 0xDCC00955B9392628, 0xD72B3D1EE40A9800, 
-0xBADAB13AD5AA6EB7, 0xBBD81F7CE8546EA, 0xF1B104441741E9AA, 0x95E2036B345B4EB, 
-0xDCB7283BC729A465, 0xB6547959168D7B31, 0xBF4F185FC1D7F678, 0x62137E8ABD05, 
-0x5E400E0DA7D00D9F, 0x2B4D0F1F07DACBC3, 0x1F64D1613954878D, 0x5768A7BD62B6B50E, 
-0xE1A1E96FAB7B340F, 0xB0D82144614BDDD3, 0x5DE20FB2C3EB28BE, 0x3A0C0D439A5C5EDF, 
-0x2A609837E343E0C4, 0x5B107D1FC7C1B62, 0xC76ABC7B9C70D2EF, 0x5D6E97B12685, 
-0xF49F88CBF04E3936, 0xC5B0C055F9EADBF0, 0xE84D35B3EC6A621A, 0xC0DDDFD4680CC8CE, 
-0x879CAF8126CF77E9, 0x4A7730CF7EDE331C, 0xA3975AC8526DB2, 0x2C2A40A92CAEEB48, 
-0x8D367298AF4AFC0D, 0xCEF912750E747A94, 0x7898708D25580D71, 0xC25D4BE5F19, 
-0x946D85740AD81AF9, 0xCA84C99BE641C68, 0xB944CC17AEE75BC, 0x704EEE5C46B99BC4, 
-0x748CB5BC4A8ABC16, 0x6ADC465030362561, 0x512864A2879AD5A8, 0x2A802EF51402FFC6, 
-0x82A7F234948D52CA, 0xC519D359983CF2E2, 0xFDC79E0DE5ABA97F, 0xCE1584A24D5, 
-0xCB235CE26CBF989F, 0x135D026ACBAA147D, 0xC3D4BDC9C8D14D33, 0xB3A16D740D0BE90E, 
-0xD3C4ACA29E1063F3, 0xF666DA4B80576031, 0x9A30D53AAD9008FF, 0x63DD7960B7385383, 
-0x9A4EBAA6C74BFBEC, 0x197947C1B917706, 0xBA25234174A49855, 0x3303660D3D6B, 
-0xAD2E81A2AB9A459, 0xD939FA85EE610577, 0x8EED4B707FAA9C27, 0x835230D08ED10041, 
-0xECF2D00E10732B96, 0x3BEC722C9CA04DC6, 0x819B396789CDC818, 0xC8736114C0995418, 
-0x899F901E4A2EB1A0, 0xDDBAA4BF9A49D312, 0x2B89E331A612AC79, 0x189541AAC10D, 
-0x49BE7904FDB87BBD, 0x3EFAD81248342F3C, 0xF1692B10AF78AC2, 0xF1A974ACA660F10B, 
-0x31BAE356CDA960F4, 0x2A5DC2A528FDB980, 0xA4638A7EA0E69E8A, 0x6EABE9B7D612AF37, 
-0x813806A64D0864A5, 0xB06DE30928AA2B71, 0x60EEB00F16423DBE, 0x4B38CD9A8A09, 
-0xFF9C667DA4B69AC8, 0xCB982838AEF957D1, 0xADA03450CB86C2F5, 0x8803852E0EDF961F, 
-0xEBD2669C8084AFCD, 0xC0AA595054887F04, 0x8F6C731E79F96131, 0x6E5E652FC600EBB5, 
-0xB564198819931FE9, 0xA5EF0CBDFD1E3A6, 0x4F2B81FB865F0CF8, 0x38ADE118993B, 
-0xCA48D097303DA415, 0x35AB0A1569B7D3E0, 0x8A7B42E1D21BEB55, 0x986623E3D1FF8D7C, 
-0x7F24E87273747262, 0xF62E2B72DA5323EF, 0xDF1F991B03B0492C, 0x736786A989CD2609, 
-0x26604C2450F71B14, 0xD47DFBCDA4812F27, 0x6D166ABDBE92D7E3, 0x5AB1264AA0E1, 
-0xBC08A0B54C053A0E, 0x983D1F9072590213, 0x6321C5895A640E28, 0xBBD85DEA43353F6B, 
-0xC44399E4C477F43E, 0x3B898D04F741C0ED, 0x4B85FAED7689603, 0xFA74BF42D855F844, 
-0xF74842EED0334811, 0x883F660688AE2F04, 0xD73FCAF66F9B33E5, 0x5390F2732E2C, 
-0xA34B3EA9BD65AF8D, 0x770C5046A92642BB, 0x5D966974E4163814, 0xD43F0EB37D5DB3F7, 
-0x626420255E1D0D76, 0xDAF3B05BA752D7CF, 0x9971FB4DB0B0DFF5, 0x2749AD9A868112F1, 
-0xDC7523A746BE8F35, 0x7C344E2322BC01A4, 0x5C2AE321E4517CB4, 0x527042308CF8, 
-0x56519A57AD1EF6F5, 0x81179EACCB129849, 0x61177406176EE774, 0xFB0D4252E2219769, 
-0xD2C996111DF462A5, 0x90F8C296B4FF50AF, 0x8F59F38765EBA376, 0xF00C3F71B0145BD8, 
-0xDCD73733FEB82DC2, 0xFBD2CD4CA441E8D2, 0xCBFE6643E80D89CF, 0x4E520F8AE3C9, 
-0x16DDB45D479EF3A8, 0x85D8F65EEDB170B1, 0x1C307EC48362CD02, 0x7AF6FAD0901D98B8, 
-0x5E44671FBE36893C, 0x570FEBB881869D82, 0xDE8C8BBC82DADD13, 0xE46DBBAD4237DA76, 
-0x5B765F2EEFBEE4A, 0x4A34A188D657FFEA, 0xA5FEBD94B4BABAA7, 0x411D79878E1, 
-0x7F8E8CC7123F14C4, 0xFA13937DA0A0C0FC, 0x77AE4FBC3F4D69FD, 0xEC324CB150832E1F, 
-0x37272E52141EE1E8, 0x132317F2908E35C1, 0xF92EE1FAFCAF2F78, 0x4907BE175F3609B5, 
-0x3822A84E59436275, 0xDAF31FD4287293EF, 0x58AB50195AA13A2E, 0x3C9CEFE428F9, 
-0x7BE2A366DDA5FFCD, 0x6EFFEFA82CDE5346, 0x4DDDF2A83D8C3A30, 0xA9F944D8FB237DF7, 
-0x575BFE5952A6141E, 0x12C8CCDA127BB37A, 0x8A922BFADED21782, 0x5ABE61A997886FF7, 
-0x9492570C63C062C7, 0xDCFADBAC6A617CF, 0xDE1B539CC6CE2103, 0x6434D67D3E81, 
-0xE324D3A9441E94EF, 0x96AC80E6D24524C0, 0x1D8CFEC98A9F4401, 0x48FC83179B6BD9B7, 
-0xB516B440EDA9F99E, 0xF9AA414FF7D0EDC6, 0x69CADC69D5F6E4DD, 0x9EA8508345CD802C, 
-0xDADF3F8E79521D31, 0x255E013F968F694D, 0x546AEFA5A426FAFF, 0x41049C29ED7C, 
-0x48A6E0026590F243, 0x30180FA7F02E9B91, 0x922D6282ED5A65E2, 0x549D36EBCF3F7BE1, 
-0xC423F2E9BF8DD75D, 0x78CA2AF75F9B3F42, 0x9E617BC80596EDBF, 0x7879CB0AD8DD2B57, 
-0x2CB89729E58EF883, 0xBC8146F69048F5A1, 0x8F5D9FFD9539B990, 0x5C981A3CA095, 
-0x45C5824983E97F9F, 0xD1E85CAF1B31A89E, 0xC2F733D162C2C7AB, 0x3ED58EF8082E2323, 
-0x1A3A3FDDB54EDA50, 0xA46245C25F04A96E, 0x6A2E98525A073742, 0x2175CE03896077D3, 
-0x7A71C5B64CD0FA93, 0x6B803ADCC65D048A, 0xE57ED71A6401247F, 0x68A2FE3FCEF9, 
-0xEA96F540293E3342, 0xC06EFB884AC4508D, 0x886D31A3AF81E305, 0xB8252B03A72405B0, 
-0x8B026E400084B098, 0x49132463808C2C31, 0xDC89DAC6FD5C8D2F, 0x9762752F3ACD1D15, 
-0x3A8D2809F791D214, 0x8EBFA158734A49FD, 0x42C437F92F5CCD76, 0x6EE3942FD25B, 
-0xB388F37109A11382, 0x2E2D4AB6D7334CA7, 0xABC4A481125927A3, 0x411C4F69214CA1A9, 
-0xD92FB354357F317C, 0x55939EA767E19DFA, 0x2475A62D4ED2A519, 0xDBDE01A713380480, 
-0x5F1014E075294BF4, 0xED25241887102853, 0x899B5F2CC9DAFBEB, 0x4F52BF41E544, 
-0x8E69BAE6575DF2B8, 0x9F762A6FC1BD0E20, 0xDD7682E0BD272A5D, 0x2F242F8CAB4E6B99, 
-0x8046348FB236EAA6, 0x963249CD23AD54A5, 0xBEBAAED3A3353A93, 0x3907CFDF455EB3EE, 
-0xA942D82E35CE189D, 0x7E136C025A3C8165, 0x84A2305B88E8668E, 0x3CBDEE33D5D0, 
-0xF853127C3B2024BF, 0xA3C4A22DA77A459A, 0x8C357DD5D88DC91C, 0x8656BAE5B2E5B03F, 
-0xA2009764B7803893, 0xCBFBA456AD5F1FB0, 0x7E4C7A77CE93F589, 0x724797BA163E186C, 
-0xE5A7E8261C955680, 0xDCC97A4F21D61EC9, 0x26DB4B12D407B295, 0x33888677C03, 
-0x4D11369057D77963, 0x84B20270FD8D1049, 0xEB49C327C00A9DFF, 0x3381F0FBBCE64546, 
-0xC98F2D51D551384F, 0xEEEC3C43078CB7F5, 0x96506423AA4C0366, 0x112DA2C0E896AD5E, 
-0xF39DCFB81906187D, 0x5A8D7C0857CA80E9, 0x34E81E79DAD17D48, 0x5A7AD78E44A9, 
-0x4C86BB6420C53A93, 0x108D35C1A499D79B, 0xC11508592C07B2B8, 0x7265B91FA69F9514, 
-0x3F56A73493E35CFC, 0xD9B8A8112F2FA639, 0x423255178DA1795D, 0xECC113A12E64800D, 
-0x69D40CE244C627F5, 0x8ACF9B8A1F21737F, 0x73603AAEA7BB919, 0xAE78CC0A8CD, 
-0x3814086A2826555F, 0xF1484F5517F1CADD, 0x6380B8E0FD64886B, 0x477CDF6E8215FE11, 
-0xB19FF4D48475FD77, 0x5B0403A43696A182, 0x9BD6AC038B5DF9E5, 0xBBF4F2C45ECB1835, 
-0x6DEC6638D35AA62A, 0xF4A10DB71FCB2C9A, 0xB55825F813B7F416, 0x3C61F0E43468, 
-0x7F07885EED96129A, 0x655A5562816A3BC3, 0xE39908B0ECF97245, 0xA06BFA049383DAEF, 
-0xBC69EA0475E25A50, 0x2FC24E242C6BAC74, 0x98B2B0C6BE478375, 0x8022A81D5A67D7E8, 
-0x9D235E6ACB417DE1, 0x29448FFB3FE013BA, 0x8D56F98A18803881, 0x3F351712FBFE, 
-0x8524BD2618D3736C, 0xE4464D7F911788DA, 0x13222F8791CE95D8, 0x4FD4ED33D1083F27, 
-0xB1C36B5C7FDD5A45, 0xFDE5CB6903120510, 0xDA82E59199077F3B, 0xC183F1C570CBF911, 
-0x4763321B4A2C7797, 0xE11320ABE17C315, 0x10003CFF50A67523, 0xA3247B2BED0, 
-0xA2971DB3E502FD96, 0xACC857C548103C5A, 0x127B6B26EB4F832F, 0x8C25120F74392113, 
-0xAFDB2A2888D7B20A, 0x59BEA4291AE321FC, 0x1B266C1AF43E134A, 0xA1A915668E724C33, 
-0xB15D867BC7D61E7C, 0xD8AC3FDC94047582, 0x5C03C6BE90D8B998, 0x21B1DB79D68D, 
-0xF27694B696669DDF, 0xCEF32C60A6CD90A5, 0x397D9102E95FF77E, 0x5DFBEB9D0A6B0B5, 
-0x6EDACA1E00EFB60C, 0x2E6FAAAC35DF5BFE, 0xA09EC1A9FBF9D289, 0x8D1770F863D99882, 
-0x1443CE271F35FE5E, 0x7A58AD3C6928B9F4, 0xC4E046AF1F475EDC, 0x4480BB1D04AE, 
-0x1B91EB8353A122D5, 0x50C6A6BA42DF8B08, 0xF3B8C97D0F8E4A84, 0x2140A7C7D5E71D35, 
-0xE405FE1F6A184D2F, 0x11FA65F1BA7A40D2, 0x285A36FEFA54B7E7, 0xFA1795691BEE13FB, 
-0x649E1864ED3C8771, 0x31F20B01A543C586, 0x6BDC2719FB198317, 0x6EC0CF7209A7, 
-0x88A2AA8C78333152, 0xB949F42D0ED124E9, 0x3F85A65563D670AE, 0x7180A98883BA43AC, 
-0x4F4708A58869433, 0x93BF4CCE3C0F14E8, 0x190947A5173C7ADD, 0xB052A57D247789E1, 
-0x1F825DA4C85E4A66, 0x40CF0F4035BEFE8A, 0xA2693E95C598F4F4, 0x207BDC96BF70, 
-0x93A2BCB7E4A14F2A, 0xFFE1A12D75D8A78F, 0x5EFA6F0346B0AEB4, 0xA4CE99902804EA04, 
-0xF57FE1CC3817A1B7, 0x2127AA91406B60E7, 0x82F5EA7146EE42B7, 0x5DEF1BA9BFD1CDC1, 
-0x1C2BE79C170CB43B, 0xDB550F9205444C3A, 0xE0E8F361503ED233, 0x1613CE5F0D4D, 
-0xABDE61734BBAE93B, 0xAA681F12FF0B724E, 0x952FDC005653A1DE, 0x92912BD8D9961AE7, 
-0xD90D67A1759AB24D, 0xBDB0B181B4F8E7A2, 0xEE6654002C89CFF7, 0xF56F46813291785A, 
-0x52EF987D4F1C3F3D, 0x58E570932CF55CFA, 0xC3CB2FE6ED7F48D0, 0x634C11B870DF, 
-0xE162E3906FD8D602, 0x9257A34BD8DE9B6A, 0x76A87F204118013C, 0x9B9DD56838F1A340, 
-0x3C04454A2D960BC0, 0xBD33A9246E168C71, 0x29336C7FE93775EB, 0xA427EF0F110DDE74, 
-0x85FFDEF87C0EEC6D, 0x92EA743BA7148CCE, 0x851E411FF4DE799B, 0x10420C193BBB, 
-0x9A753B91CCD9AFA8, 0xDC2939D506DBAD65, 0x9646B1DE25253DE7, 0xFD25DB384E2434D2, 
-0x484C43B13C1FF9F8, 0x751DE2916D5449A4, 0xCEE78C237F8DF836, 0x37A62EEF2D823AB, 
-0xCB9C106ABF9DA47C, 0x325E4E2D3734E3F8, 0x6598032DA73FA7D6, 0x22BC0FAC7092, 
-0x7D3F4413F59FE889, 0x9649FB66F267EA0A, 0xBD3CDDC8B1E7F750, 0xB055E859F7B13FF, 
-0xFD25024DFB24B307, 0xE12218C377DDDC90, 0xCA26433A4728DACD, 0x562368B9C34EC345, 
-0xD7B4B7C5FB76E9B9, 0x8ABF19FD990236E9, 0xA73E24347D819FFB, 0x12B3A0393B7E, 
-0x5BCBFCED55CE9969, 0xDBC22322BE2C481D, 0x20C7A1FEAD767559, 0xBBE1E7379EB9DB71, 
-0x9AC095EC74F192DC, 0x6E4CDFBFA9226478, 0x5838F7CD67DDAA7F, 0xFB54F6DBCFD6187B, 
-0x1F5EC0EDD741C63D, 0xA055D46B85B096CC, 0x79B7D635E11340F1, 0x38A215EF48C4, 
-0x871511D7701CCD5B, 0x71F0F38AF44511A1, 0x5F6859D6173563BA, 0xF26D4B728114E321, 
-0x3140F5A99835A3F3, 0x786AE04C732D1506, 0x12557BF1201F9AD2, 0xA837306CBF582B31, 
-0x6160A9F7EA15365E, 0xFED1673BB4F17E11, 0xD8F92FCD3C39E569, 0x65E88949CC13, 
-0xB547CB8B42B010C7, 0xC9FC450196491E38, 0x76876778BD9AA8D2, 0x72E3AA57E5CEB3D0, 
-0xDB285B5A44704A2E, 0x4C09D10BE665A4D5, 0xB93A77D4138A6F0E, 0xF984B957355B8A62, 
-0xDAA66DEE383F5BF, 0xBBBCD0391B7B805F, 0x19DD6C033FA3A675, 0x4D5BB772138, 
-0xDE67E06126A12721, 0x83E6ACE2BB77D5F, 0xFED353FC53BD3965, 0x46ABD85F77C3A8D2, 
-0x49F7EAA029FC1C30, 0xFF36532F6FFB3F5C, 0xE834314AF7AB6479, 0x2E0AF1488B5F28, 
-0xFB7634D1E76AF4, 0x8255EB91C4350998, 0x9967E2ED480DF68F, 0x4218EAF2C818, 
-0x8962AA27E68B7F0E, 0x602894D83ED5E432, 0xCC2F636DA1841339, 0x910E1A0E7D8CDC71, 
-0xACBDC02F76CFE3BB, 0xCE149FCCD0F33DC3, 0x1F079B5D87DBBE04, 0x59948951947E592A, 
-0x4C63BBD78892237C, 0x3D6584D1FEAE8795, 0x96FC3BA0447A171D, 0x379E20A8887A, 
-0x66F706ED04F229CE, 0x436046BFF9FE6CE8, 0xC8E162ED73C2ECD2, 0xC0983C1249B85FEA, 
-0x583A7F5BE977A36, 0xF3D18A463A8FFDC1, 0x1414E93A74904C93, 0xF1E59BE8364F1877, 
-0x9C45D362D974E6C8, 0x7AD33DE71491EE13, 0x34012423D34445B2, 0x26AB054D354B, 
-0xBAAC0D62A987D957, 0x4691856C87FBE54E, 0x7C4604265DF0B902, 0x8C5B234711568AB7, 
-0x631FCC48D25FCBCD, 0x503770EA795C6459, 0xA058AD10D3DF016F, 0x72F972E8EF524471, 
-0x3C4E879198B5C4B3, 0xE78B328FD7146A73, 0xC7324803DD403270, 0x51DFB015FA9C, 
-0x57550EFF6D5C749C, 0x3487E30522D20E40, 0x841C4078ECA95D8E, 0x5431076FD65DAF3, 
-0x1FDF8343CBDBABAC, 0x5682ED1DF1BC054, 0xA22DF6765A5FB904, 0x4EA36023FCC50F59, 
-0x5F283F7F0EF2B621, 0xB8A7F41B296FAC68, 0xF4A2E6F61D1527B1, 0x2134181CA436, 
-0x8744DE128B1C0918, 0x668057A305773FF4, 0xAB158AF75A6A067A, 0xE26E58385E0A9F04, 
-0xC366809A41D4144F, 0x962DF8EB270DB01D, 0x1CF77013F1369C7, 0x46A08970EF6BAD39, 
-0x5065B2C0FB94ACB4, 0xE44C4FBB473B7394, 0xC5DC64DF873C3C18, 0x12334EF0A96D, 
-0xC453E384354B4F59, 0xA67790C233F6666C, 0x9D0D302CFC96C9D, 0x1405C52E10B019B2, 
-0xF6F7608CEF67C3F3, 0xC7AD9472E4E373F5, 0x96792B239AFBC127, 0xD003A412A23B06E4, 
-0x131603E1D09CB3A0, 0x9A2B1CD681851AA2, 0x286EBAFB7D95E14C, 0x4E9C1DD9AD3A, 
-0x7F6203A089A01BA7, 0x6917EE5355A63B4D, 0xF4A772EBE77A0CC0, 0xA7DE26D8A42A8CB6, 
-0xFB69F77FE51B73F8, 0x77BB6B5BAEAD121A, 0xAE29892489E2D9A6, 0x7C7B1C2B6E9DBEB, 
-0x676013F9CCE587AC, 0xEC8AE3D4FD73B987, 0x99E50C24C5142CEA, 0x3F38CFC4505C, 
-0xB41DA8244D8872A4, 0x36B1DB661CB4D2C9, 0x92FF02B3E5D0ED2C, 0x1AD7221C0F6AEC54, 
-0x8909B22655434B78, 0x366BAC4E3421FED4, 0xC084F55D0F165B2C, 0x9177B07B58DE68B6, 
-0x4826B1A29D3FA16F, 0x7D3D083543E0F337, 0xE5B44B3A7C6BD606, 0x121218996F5A, 
-0x8E353279F7E9A608, 0x1A3A4A657382C5D0, 0xAED17277CDF714F7, 0xB15037ACF43809B1, 
-0x14863ED9CE9D7377, 0x5811C8242EC77A06, 0x49E1C584D8112DD9, 0xF496BF719D3A58E2, 
-0xDD5FFB604F1D8EED, 0x2EB66A4453C3E874, 0xE9692CAF562797F6, 0x2FCC26AA0000, 
-0x9BFAECC28935ECF0, 0x61BCB062373F34A7, 0x4605BC2B41A00BBC, 0xC4C7ED19E19FD897, 
-0xA41C54405AD41B7E, 0xD403EF1B90128D1E, 0xFD2B3A61FEDD3AB5, 0x6345BAE9E2A0F810, 
-0xFCB152B0A72AEA3A, 0x73D5437B03254643, 0xCDB8DD6A909BD82C, 0x6CB9C7084278, 
-0x951A0992ED790DE5, 0x86496544E9B19C67, 0x5BBABA38D55B45A0, 0x82D0CF5D750F37F8, 
-0x74303D8034F6AFD8, 0xF9DFC2472B4F475, 0xC15498B855AFD61A, 0xC2733324A0370285, 
-0x899C8DBF314F9D06, 0xFC2D6B9EA6B56A99, 0x306CC433C16ED0A2, 0x6ACB456DFAC, 
-0x99C42901800259A0, 0x28CE47A0206461C5, 0xED444B78DDCA539E, 0xE9235053B84AE6B, 
-0xCF9593669C435390, 0xD9EB4ACF3D7D6A36, 0x21D817B99C55BE61, 0x69E03F95423F3BD8, 
-0xDF0C7A968944E2A5, 0xF36903C1CBAA7FA3, 0x59BB88D7FDA8EFC0, 0x467D1C6D2A2E, 
-0x78BB64A6E332148, 0x49702ECB49D9A636, 0xFBDA17EEC2AC7C37, 0xC0B8C4D8712AA86F, 
-0xC98C1E46E2E152D0, 0x6C8273E986752EE5, 0x25BED35E41F31AF0, 0xCE5027D315026F39, 
-0xB5F7AA59F2B7677B, 0x72CBF42D3E8F4747, 0x2B2F13FDE8506A90, 0x5144A03236B9, 
-0x91D2A7B98AA794EC, 0xB790F3F097844270, 0x3BA758748D7021E4, 0xE0503980A608D191, 
-0x7E35A17D8B9662B1, 0x8026F715D4C1077C, 0x3C8508966EF66D56, 0x6C76A48642A32435, 
-0xC1C9ADF557A4D73E, 0x36E7CA134204168D, 0x483433D8D1B05D3E, 0x48DC57BD7042, 
-0x5F524480B267897A, 0x1EFE35D5B39EA7A6, 0x302DF596E7020706, 0xC50B7956B06623B8, 
-0x5142AEB952233EFA, 0x9C59399279A2F83C, 0xCBF519A74E59E0BA, 0x6D2219EEDE4B6859, 
-0xEDB28953D3889AF4, 0x20A771D349C8B981, 0x2DE9B0425DD5D72E, 0x1DFC8023D0B6, 
-0x9EC8015354F14157, 0x724CDB9266C9B7FE, 0xEFAD6B113EC64681, 0x6D894CE3CE87DA9C, 
-0x7E0B3ADE4DE98CF0, 0xC68B6DC056DF4CC1, 0xFDC02B4E58D9EB28, 0xF46C19CBE0FD7C98, 
-0xAB5F62CEAB37374A, 0x65152B1113071C88, 0xAA36C70EF1C5E28C, 0x5D51146B4F2D, 
-0x7B5990D9F6E5717F, 0x650E64ACEDF20A7, 0x280920F16558BF88, 0x1968174642F33542, 
-0xC71BF8EAC426E3E3, 0x863C0E520FF918FD, 0xDFF0410A98E3FA5D, 0x1621ADF164531B14, 
-0xBA5D14411282B228, 0xC1BC6C0A6F124F8, 0x57FF99D57827540B, 0x34BF3AA4F222, 
-0xF4B3C06629A69C63, 0x33B0C1313331F0B6, 0x543C8332973B5DB1, 0xD619E382D397B88F, 
-0x5226D8255E3B65D5, 0x9156D06C754C077D, 0xB10B047B78EFF057, 0xB81DE7ED43EACD72, 
-0x4C3B4A2E97B3031B, 0x1B6498035411C8E2, 0x1CD349F7A869307D, 0x3029E1BEB027, 
-0x3A5FF8B1435E7CE8, 0x4BC27290EBDAA3F1, 0x905896348E5864FF, 0xD6967080C6DC8862, 
-0x2F757D46AF51272E, 0x69E35C31BE018E42, 0xD444D9AC6DEF662E, 0x14978DEDB109A50D, 
-0xD8C67ED8B51B8BDB, 0xE166D268D874C31B, 0x6882E87C1B56E570, 0x368D47B815C7, 
-0x3E0D67A46B06AE57, 0x44BD15F32690CF58, 0x630EC548830083DB, 0xDAB1324999BC2BE8, 
-0x130D5F2862B0A5B5, 0x98D136E63FDF95E8, 0x5D529B71EBC136FE, 0x3F2F08E2D3CED33D, 
-0x6437170438152EFF, 0xB92FF98AE0699773, 0xA09F59EE3E1F48CF, 0x3770801476B6, 
-0x8BEB371C60B366D9, 0x8932088F26C58475, 0xF1354ED9D864A77E, 0x4521A8189CC8ED5C, 
-0x9EB93F42C93348F8, 0x5395D1FEDDF4142D, 0xF95F296A3C646FC9, 0xEAB4DF6C2B65740A, 
-0x32CD8807ED4B652C, 0xD4EC0FB2A12952DD, 0xB270A56C0830DF70, 0x1CC13C012CC2, 
-0x51EA496CBA7CB94B, 0xA555751131BC10EF, 0xB4C1C30127BB28E3, 0x85421D1D145DAD2A, 
-0xD77ADBFB0675D1F3, 0x1A7BF3DC29F3CF70, 0x6273E443FD9B3D10, 0x3CADEC40B3F531F0, 
-0x32F9E70DBD182869, 0x53690A35C177BF4E, 0x98CA2B9B3C64ADAB, 0x3FF69BD64CC3, 
-0x690E9021142155AE, 0x6F299B74FC2D6FE5, 0xD010E9C8F2F9C1AE, 0x416EE258EB161A4D, 
-0xD8F94313348BB7CC, 0x36B0CE9C5D15170D, 0xAF154F3B51B13366, 0x27687394228542DE, 
-0x676694E7150B3F33, 0xCEEB0FEE7909A9AF, 0xF38BA90C13D7CE9E, 0x2F0B78FA7B92, 
-0x146368A9244352D6, 0xD225B4ABE2E181E1, 0x16FAC8D71813BA3E, 0x3617664B74FEC49E, 
-0x71A824F0E9C4B97C, 0xFCF9A93A85040E38, 0x1A7B3A6BB71BB04A, 0x500352F6E79143F2, 
-0x4543B4ACF1458F9C, 0x12EF4238E863D50E, 0x61A595A9528F0D04, 0x5AD21B2EDC0E, 
-0x4F6BE4B1449C7779, 0xAA75A579A6814BB8, 0xB037F2A854FACD9D, 0xE7813DEE6BBCBE64, 
-0xEDF502E228A4D4A6, 0x16D0DA0C01DCECBC, 0x62B14595BE851DDE, 0xC8D9708690FF3A9C, 
-0x28ACFA7A73CBB35D, 0xDF27D486469EECBD, 0xCFF5200C20B07B58, 0x61667302CFA9, 
-0xBD9A615B3BF3E4F2, 0x39A0F95E2B458E84, 0xFD8249140FA49B70, 0x9E192B4A5A239506, 
-0x3C460EBAE59E5A07, 0x646FAA52CF8E0CAE, 0x2DE1E08AF76DF649, 0x79E3C0442EE80429, 
-0xF47992E0814B0A47, 0xF60C52017FE6AC51, 0xD298532B07C8AB9A, 0x47015DE647DA, 
-0x9ADBACB76D87E418, 0xB8DC7A0B175CA89B, 0xC9264C03BC5CD9AB, 0x84367FF518EB9CC5, 
-0x3FF8139E8495AC51, 0xB4FA1E17F45068F8, 0x74EB7180E61FC2F3, 0xEDB88DFD65CA4B5D, 
-0x618A5AA3669260CA, 0xA61ABE98A08C0376, 0x6B81605BE839E52E, 0x5A69125EC5FF, 
-0x9F5BC85FA0001E0D, 0x2607F9EDF4C7F0F3, 0xF24BD5C49ABF6A, 0xB7053097129B3DF2, 
-0x3BAC8671622F17F2, 0x5F46C2BAF1258C84, 0x30F905A0E466A8CD, 0x3ECFCD843A30EFB2, 
-0xAB024E3C6ACCF521, 0x307610D12753DA7D, 0x5A3DCF35E384ABB0, 0x1BF37AD71F90, 
-0xAEE79DC410DA6D7D, 0x4ACCEB8D519A2373, 0x9CE213DAA8DBF370, 0x6EB97E5015406C00, 
-0x65A5B199C2DD5DB3, 0xCE40492015D0BF78, 0x6841EF24B108D0FD, 0x31D0479A393B69BD, 
-0xD4F8CCA8B5130CAE, 0x319F6A8B3FFFCF17, 0xEF87180C4CBDE3EA, 0x4284B8AAA95, 
-0xCCCC8AE70F611706, 0xB7318A2D408571B1, 0x4720BB64D0851D8C, 0xEDB7EC00402EC203, 
-0x7997B469F184F7EE, 0x536899F1B0E062AE, 0x60C7D702BCBFB7, 0x7ED69416031F6B06, 
-0xA27A97C5CA268983, 0xF92C1F86363D3F81, 0x7E38D42C64C30D24, 0x292A43C0F87E, 
-0x25FE60756CBB165C, 0xEA670446592C4052, 0xACA89B99ACAA3B68, 0xF7F648AE0EF3FF70, 
-0x34F4A2A0458431E, 0x59D8E7738D1A0221, 0xDD856EF01194E2E4, 0xA76B975EADBE445C, 
-0xC472A9EB545446AF, 0x21ADD6A841265D11, 0x7EB050FBB04E005D, 0x201DCA9D5E6A, 
-0xB9BD0605F0A1B66A, 0x9821461695FE9CF0, 0x8EC09F6A29C22736, 0xCA89A1EFFB6929F6, 
-0xBB7856A019C2445B, 0xCA5BA1815D3FDC98, 0xF928841FCB579AD, 0x288A09E9ABE91C9D, 
-0x1B742BC8AA803897, 0xA313E3CA795A4F5B, 0x7CD6C559A9EB9D4, 0x646D0735996C, 
-0xFE9DE6DC7F0F8F45, 0x4D2D6148A7A4D19, 0xDCAD33FD6603ABF4, 0x4360A281D95CFED2, 
-0xBE9B7A1E5E5DAC38, 0x3F1F253FD4556050, 0x426D6807EFD9732C, 0xF979841BDD866BDC, 
-0x159552B8D747BF72, 0x8F8B26612C22BD4B, 0xB741A120A1AA0142, 0xA00DE41D1DC, 
-0xC212793385CD2D44, 0x85676306414BD602, 0xAA7870D625F8FF18, 0xFA74DFA7EED25A6D, 
-0x7251A13961395E85, 0xC736181104B362B5, 0x3BDD977497D6311A, 0xEDA6912C9C3DA210, 
-0xDD1FD471371438B5, 0x81C023A248809CA, 0x8D5B7E23E0943137, 0x55A998350A03, 
-0x51FF7166C83E6D3, 0x1C8DFBA897A6C167, 0x3209DF69475B54D0, 0x81ED9BD2945DD346, 
-0x51715DE6A1A0FAFD, 0xECEC047C817F1AD8, 0xD64D9FEDEE21E1CA, 0x916DA6EDCAE136F4, 
-0x54D63109BB85769F, 0x691D2D6D2116B362, 0xE5368A127E62C318, 0x12A64FC0C678, 
-0xE996DFF08CF4812A, 0x39D121871CA603F2, 0x12CA60B3FBF3DB64, 0xCCA127A5FE15EF21, 
-0x9346692364877D93, 0x8AFB21AD69836112, 0x748E4D4C5B7C5629, 0x341F4B8B144F7D58, 
-0xCF8E9E345F1AAA5A, 0x3A615582CE7CC9F1, 0xB15BC5AB4A65AF48, 0x94E1D154D44, 
-0x53DB0C9C1623B0E6, 0x5DFC5DD74EF2ADC4, 0xF77C109830FEE57E, 0x1EF58EEB1ABD41E0, 
-0x26FC6AD855CC76D3, 0xDD9941205CDDEA68, 0x3536C18089041610, 0x841C2B5DB24592A7, 
-0x592079B390DFC620, 0x6FD0EB47688572AF, 0x50914D4B499E191D, 0x11321DE183DF, 
-0x6C425A4B9ACCB62A, 0xE06DC05616B0D501, 0xCFC7A9849A4F1E2, 0x70BCA71F62D4B59E, 
-0xEE3684B1F1E1A8C4, 0xD4B1AE24194FF93B, 0xB0C80D4565FD96, 0x72EC7D89C09421DD, 
-0xA01189F26A8398E8, 0xA4BE1720FEE10D67, 0xA6E6713B70E6D929, 0x58D3D52932E3, 
-0x4A1F278C357CA84A, 0x12D1D6996FD75B0D, 0xD18E820B4F61027C, 0xDB773E17BC27B7E3, 
-0x596D6F361BB14E16, 0xC4BF83D9C35FFFE, 0x296E76257E6B7720, 0xF5DEF243B5797178, 
-0x33FB97D695715E3E, 0x50ADD4DEEB4E36F2, 0x2430B95E4203E497, 0x62FC2CB45500, 
-0x1A7B58AF53054E4A, 0x93413CE96AF4E5B7, 0x8BBBBDBCE802689, 0x2176389BD0467720, 
-0x844F72C3EA055EE6, 0x5F2A1B6540AED18E, 0x844FD2753FFCEC0D, 0x872775A123F6C7C1, 
-0xEE2A493F6CFCBF6A, 0x4C3396531E0F6913, 0x87C091F435C68C88, 0x3CE8A252FE4C, 
-0xD050E977685D30B0, 0x4D5ACA294914EA65, 0x2EC8917591E1F542, 0xCB41FE34AC1F4459, 
-0xA51A3ED00CA9D20F, 0x7BD7223218C21011, 0xDD7A3C5648F73C88, 0x3B9E685AA0ACF533, 
-0x38C325C4AA7BCD67, 0x22BDED7792AC9D3A, 0x84BD0740151FD574, 0x507172F70979, 
-0xE747E516F193B476, 0x1924A67A956A5C66, 0x6139CEA9B24C57A9, 0xC592A2D6CC73EA1B, 
-0xF4EC330EE4920DAA, 0x248780453DF8C467, 0xD8F9CABE8A318FEF, 0xDFA4B110708E6903, 
-0x6774B861A33FDF14, 0x154E9559C3AF21F9, 0x47B1CA4EC5AB9836, 0x62929B1AD32A, 
-0xC471253EA1B43552, 0x68901E5F1FC5250A, 0xA597C9D685952BA7, 0x100A5B9435695A37, 
-0x69FE85FD56918623, 0xDA5CEA046B66E2EA, 0xA35C61CBB8E67065, 0xB4D044C20C436F50, 
-0x3180EECACB633852, 0x7184A1F6C25E33B7, 0xC66E87D57DFF1381, 0x44D833CC7158, 
-0x6183E6A531863F80, 0x75845548098462DA, 0x1E15CFAF9FFA99C4, 0x5F64CBE400FEC61B, 
-0xBB8D90641DA56F9B, 0xCB536B64C97920E1, 0x86A2630C0BEFD87, 0x13FF99C9EBCF637C, 
-0xFFF6B6757CD6AEA8, 0x5CF2AE501AE47597, 0x12C532252A9BB3ED, 0x188729FC98BE, 
-0xDA1C76293CF43FE5, 0x6C899BC605253170, 0xDA1955468EBA7BD7, 0x88E6DC3DB23BCACD, 
-0xBE7C6EA12B2BA73F, 0x163978B1E0636675, 0xB9D2340FDE343BC4, 0xE9CF4F78DA367F35, 
-0x8E9F2B622D3C907A, 0x3AF12C2884E66AEE, 0x66807BC88BEED5BA, 0x355E7590A442, 
-0xFA78D087876E9906, 0x9729C9CC875BE0A4, 0xED08F9B5C40B36B8, 0xC7E4BF7D7853F18C, 
-0xFCF073828588E2F0, 0x916D71F857ED1EC, 0x34ABFEF58D5AC316, 0xD5A4458C10C29DD8, 
-0x50D31699AA71B500, 0xEFA13DC51814EF4B, 0xC155F1B8C3E9E920, 0x4E54E3823A78, 
-0xA67C9ED66538E357, 0xC193186345AFE9FD, 0x746DDE81F61CF9B3, 0xD6EE3561AC221F5E, 
-0x8E7C8598CBCF4D45, 0x4AFA074DBD377A7C, 0x6974B4861E3A3F57, 0x182E9AE860280444, 
-0xC919F383CB47BF5D, 0x78AA975862B83EB4, 0xDB59923F37CE6341, 0x1935A51CD5C7, 
-0xD094871CC582964A, 0xEDC443AE19484745, 0x9F46DF1A2DF52F78, 0xD0372E7D503C3117, 
-0xA581C78A9EC80EC3, 0x811C99EE15A9DDB5, 0x5A2E50E45440B544, 0x78A04504977B5B67, 
-0x9E1DFBC2172179D5, 0xC6172CA4A9A287B8, 0xD9659825744573C6, 0x52364B8EDBD5, 
-0xBFC31321168A796A, 0x30402AE6387BDA4E, 0x5BA5840CBAF79A45, 0xDB109AC51732C04A, 
-0x1A94330B03BA86D9, 0x69DCC720FF2993D4, 0xA6F92E71CCF79C35, 0xDF75647778CCA35, 
-0xE1E54D586C645308, 0x9319096B2888CCB6, 0xFAE24879F9B14565, 0x5C06B75C0FB1, 
-0x64756E05158B99B4, 0xA69942B06329747F, 0xFDF367481AAFC43, 0xEE39E6849B415C4A, 
-0xCE90B329508C6D73, 0xF6DBE78A970A5E63, 0x40F188B2F6FD3B1E, 0x6BBE0344BE8376D5, 
-0x671001CA5975B67A, 0x8C55398DE38E6142, 0x3FAAE8537D0B801E, 0x648506CEDC13, 
-0x539DE3B4300271E9, 0x71F691AB12CBC15F, 0x356ED53E2BC16519, 0x948E8DB0AC1B276, 
-0x4D5129D3EEE40D7C, 0xDF38FC40579E79BE, 0xBBD4365C7023483B, 0xA8F3414523A10BBB, 
-0xC98F7DAFB7F22CA2, 0xAD52B62FCC7C2878, 0xA0FB66CDD70E2DF4, 0x5F3130D96AA5, 
-0xAB34CA52BD8B52AC, 0xD1C259BB767E75AE, 0x803C89C538029B98, 0x1B4EF3B6ADC7A2C8, 
-0xE85775C1C535F567, 0x7CFFE6D721F148D1, 0xBD6CF7B72F171231, 0xEA01D061C6091F96, 
-0x7EA2B38608BA0CB3, 0xEA1EB3D817A5A14F, 0x93D352A091736BA4, 0xF3D860B9306, 
-0x8983676CC20DEFB9, 0x481941BB7EECA2D5, 0xF5344CA9488ECAD5, 0xB76F3CD2DF641D81, 
-0x44BE1DA6B03C6091, 0xB7D0254926706BDC, 0xBB9D5741FFDC0B58, 0x7BB96C7867C05691, 
-0x9E0E9095CE13B470, 0xE936419ED724D0A1, 0x4C83EE46FBC294D8, 0x463171297AF5, 
-0x258C5DEB2239118D, 0x32036933F921456E, 0xAE67630E939BFCCA, 0xA78012094E0617EA, 
-0x76A5A48D9B79BE82, 0xCE61FE56C8A9A582, 0xB7C30E9AC45A00B9, 0x390D5ADB54E68504, 
-0xFCCECFC3E3471FD5, 0xF1080FD73F65BC58, 0xC735BC01AAEC991C, 0x57FCA4A231B2, 
-0x834F4ADF6D2F137F, 0x48A7AA0ED27393B8, 0x371839F87EB45474, 0xB126E140A831E63C, 
-0x5117445648B4C936, 0x5CC775F8326AC6DD, 0xBA3B0B516A71A811, 0xD7A7801AD70AD84E, 
-0x6BCB9A9AD631CA8F, 0x2D81E7F0BDC4ADFE, 0x54E1F23C243084E3, 0x2F94F7BB7BF9, 
-0x3895EF14D531A6A2, 0xF925DF80ED9CAE05, 0xFEB7DF012F44BB4C, 0xFA157616490E3657, 
-0x555D0DE9506AB7C0, 0x5FDFE8E799A0D228, 0x62F7DE6B7E244EBE, 0xDA0FE59570378AE8, 
-0x3AE465D45BA7E079, 0xEA3B16B5064628FF, 0xB8A9AADEB710DA15, 0x6C13E81720CE, 
-0x937925E357C50FA7, 0xBD48E358929326C6, 0x89054167B3C4D717, 0x72FA54B5F06E628E, 
-0xD61CB8DCDF95E5C2, 0xC715825F2B904F39, 0xEB096BD3376372A, 0x7E84FE9489CD8F26, 
-0x19539AB7CFDC2836, 0x4FCBDD7F4AC2866, 0x70FA2740EA5F4FF7, 0x32E7CD437AE0, 
-0x1CCDE73F09EC3D87, 0xBA6E1C48CB73D34C, 0x4A98A9A6999119C3, 0xBB3B8E69023CB1A8, 
-0x898BF53B59F9C2F5, 0x3F5360A246B49215, 0xEA8D2328EA843240, 0x85A95A3DC6A3DA32, 
-0x9FB55CBF2FA06123, 0x3A737B1D19520B73, 0xDE7B6C48463AEED7, 0x4915B716AE36, 
-0xAA52995362475218, 0x2761071DD8425489, 0xD39F0824E4386931, 0xDCB5723E73D51B59, 
-0xC2B7DC76A2A8CE3, 0x5E5087E3D56E7C7C, 0xA2FDE8D63EA69456, 0x6D2F2DDEB710A45B, 
-0xFE915E2603356015, 0x1DE2BC16A28780BB, 0x37D8D8BD40874914, 0x381D0FC312AB, 
-0xA4811E321C6FF98E, 0x528A570A1A8697A2, 0x898F749B3CA70861, 0x9FFDCFA3A70711EE, 
-0xC6FCE484EDB303B4, 0x127AECBB968EA840, 0x2283A32C607F2AFA, 0x9F80A9A41A91F06, 
-0xE144E1E14FF6A0DE, 0x143FCC3318455E0F, 0xDE12BE4EC2BC6A53, 0x42E9E671E1E2, 
-0xE64C690B4BD10226, 0x51778261F75C64A7, 0x8239940B869E9522, 0x8F19200BCF1908A7, 
-0x35535259D35F0583, 0x71FA56BA2DD919A, 0x62AB9B0BBE3111E6, 0xED12FDB4D626D2E8, 
-0x390E260D16CD340E, 0x18BDE79190F6E19C, 0xB9709824672B3683, 0x63C5956B6089, 
-0x13456E17EA115CF4, 0x587A3A68A9F12B87, 0x25D42D340203C115, 0xA8875807615DF057, 
-0xF13DF1854DDD4268, 0xC5790EAEEAED3EE3, 0xE1E0E3A9E20B4ADF, 0x80C0F1A98727F2F0, 
-0x81D0CB0A6C64DDD5, 0x49CAD4413B044204, 0xD5EB6C3A3E3BEC2E, 0x16C667327126, 
-0x968A5E60917D5801, 0xDD647ECD9A199160, 0x1F490FDED57E4882, 0xEEC35D7117889037, 
-0xDBD17B95D711AEDA, 0xF38C2742A70C4A, 0xD213FB99A789D21B, 0x4CC9860074E217A8, 
-0x9E0C07A36359F019, 0x6ED358A5FB596349, 0xB66F6239055960FA, 0x2B76BFF46C11, 
-0x27D1996B1A5F4C67, 0xC8B29C52D16608AD, 0x46015D9AC8E5723A, 0xB033EB9EF52DC6EB, 
-0x61F1A868D8DC5981, 0xE021A00594AF733E, 0x689FCDD5AE2AE362, 0x5946C1C5E08F0C87, 
-0xEE057DB10D996AEE, 0xF05E388B29459699, 0xD51617E0286CD296, 0x5C7AEC665A14, 
-0x4899C76645F9EE27, 0x21AA7E89FFFAD872, 0xDF9DDBF6106AFD9F, 0x473A6278AC430B28, 
-0x8B83F4809C52194A, 0xFE701C9A60D59B29, 0x4955C3EAF9434EBA, 0xF095D51C1E99889B, 
-0x87A86B7D7447AA6C, 0xE6F38F25F63030F8, 0xBA12A9DD36BDEE53, 0x520EFCC3D607, 
-0xB675D1A5F1D9C08, 0x84CECCA413251513, 0x94F626BA16BC1F4E, 0xE826CFFE49E20988, 
-0x60F44EE99DC83224, 0x36501AABFF58CFF4, 0xD61C63AE4871CF72, 0xB58476733C741889, 
-0xB03386CD31B220A0, 0x598BEFBCBA93E6D9, 0x389062473300F45, 0x45CDC778D12C, 
-0xE2EA52CD793508B1, 0xDBB6EBE7CA92DDCC, 0xA0FAC1BE4CCCA9D4, 0x1D54D917EDB37C68, 
-0x4C948613BDBC280, 0x56C406D2B6851937, 0x20F03A2CB54266EE, 0x8A752BECA6F49E8, 
-0xDB4BCC5D5C54A650, 0x2845FF82A0594D07, 0xC958D4CCA9245A0E, 0x1DF045B35C88, 
-0xE6ED56423C841270, 0xDA1C3562C0FEB21D, 0x46CFF07E4A8E02C, 0xD2620F84CBD07527, 
-0x71FB52D2297B63EB, 0x7C266C26D5D35901, 0x279FC366794C8B62, 0xAA849B5B35D2481C, 
-0x90EA55E5771DF1D5, 0x35D4225B49EC3737, 0x501AB5DF8BCBB8A, 0x4835BE3E7AC3, 
-0xFA7EB1128094852, 0x1122EF22812F6C4E, 0x1750BDB3BCFBCD12, 0x82B876042755E3B9, 
-0xC90FE9C79C1E8E48, 0xADFC82B1C329CDE5, 0x8BC63D7B8B7089EA, 0xA8658D0C13E3770, 
-0xFC67350F3D18C924, 0x17CA8D389F5434C2, 0xE8DD8BAA4CBC4C0F, 0x54DF2DC1C970, 
-0xBC68131F061AA50C, 0x629880D5B68DD0B1, 0xFA148FBC4DF86821, 0x5444F4BD60E63807, 
-0xF8C3DDD8CBDFBBF5, 0x5861DDFC94CB77C2, 0xCF64D14AB871E504, 0x98767556F978BACF, 
-0x17503C5E0ADFFEAF, 0x7644545E9642FA3C, 0xE8FCA06477B2C711, 0x522310254AE6, 
-0xCA682216FD9C8B86, 0x16FD3B82388D30C3, 0x742BDEF89CD5B189, 0x4D189AEFC25C2DD, 
-0x987782566F2A9CD4, 0xC48152C70DA3A636, 0x2DA0555A0CBBF294, 0x35B18E6389194DB0, 
-0x93E6CD63CC83F695, 0xCADD01DF64F63EC0, 0x446BA7B2272E27CC, 0x6BC32DE4A6EC, 
-0xA7DC722E0CBC148D, 0x31AB44EE484E6475, 0x53ED418B5BDB024B, 0x98048B28E101CC65, 
-0x997C189523FDEC41, 0x595CF83D7EFD645C, 0x3B72D29323AB81A0, 0x172BAEC6DA0EDEE1, 
-0xD40E3B8E3B8CAAE5, 0x162E4482E1C335FD, 0x52061708EDB8DE4C, 0x1F4CD2876077, 
-0xD90FC63827236CAB, 0x2C67393D1A230D97, 0x9060F6B1D947A6A5, 0xB33FC881AED7C375, 
-0x1235118091A6C1C2, 0xC76BBE761B0B031D, 0xA484F26106F047B5, 0x561DAE794F31DD18, 
-0x55F7387F7E2FC72A, 0x2C5647C1BC11C936, 0x7E69246DBD527AC0, 0x23CFA525DF70, 
-0x9B320E107133A436, 0x76CDA4B7EC53C96F, 0x7D336DD3513363F5, 0x3695B349ABE1B66A, 
-0x20E14449D6B9FFFE, 0xA358C85C9D0BAF5D, 0x3D1A8BCA26EB9D62, 0xB63F27445014D8FD, 
-0xEA11A1723296D5BE, 0xB17FC31A1D7D2599, 0x51F1DAD19FC73EEA, 0x5EFFA0697380, 
-0x31117386DF88341A, 0x91040B71C01BB84C, 0x696DDC546BF29543, 0x37DA6B13B39EE31B, 
-0x2A5F99D57CDA47B, 0x46E98A76217D18CA, 0x224651059F927CFB, 0x2D36E8FB4EB283FD, 
-0x2329DA34C67D19F0, 0x1453B21373C549E, 0xF7D539B54B32768E, 0x369641CBE8A6, 
-0xA4BBA7F2C6A8FB4E, 0x18CD4E2E38B20889, 0x9C9A562F8343E50, 0x377396E19DFACD81, 
-0x6739C8C54A6ACB4A, 0xB99082858FFCF4EC, 0xB308FF328421A872, 0x4D39FDDE1421F5E1, 
-0xE00896DA1837CE60, 0x4614BB3C8F7215FF, 0xFF640CC3738F1E61, 0x12917C0CC506, 
-0xB61F01368A2AFE15, 0xE61135900A280BFD, 0xF68308F679348788, 0x974E44D47FFCB0C6, 
-0x4BE4B968974ADBD8, 0xF47560051A1B4A94, 0x49B7463BB9BADCB4, 0x3BACE9EFFFF8A3B1, 
-0x995070C3D201DBD1, 0x4D7408548407759, 0x8F4BE95CE7D5AF79, 0x2973182A0A58, 
-0x997A7E63F22EE657, 0x5E768900307EAC9A, 0x7F03A5511706C7A7, 0xBECCF6484505834E, 
-0x8F3B746C57A29A4D, 0xF1BFC4699AB7C931, 0x3AA0F54B62C252B2, 0x9432B653B4AF0C4D, 
-0x2607701D505BB12D, 0x5BB62102C3BB197D, 0x96CDF35B583E240, 0x6423E3C940E8, 
-0xDE854C0DEA4D3F36, 0xB68B02FA73BDDB83, 0x17FB1DD778137369, 0x6A8BAFD00EEEF8E7, 
-0x2C53AF3F70BA1492, 0xA7AC0AA91364953E, 0x45E08CD93AC84077, 0xB29DC3388D07EC9D, 
-0xD53C60EADD657BF5, 0x8CCFD028B54A8102, 0x8FC39970317533B4, 0x51965531DB0E, 
-0x70AF8D006877D928, 0xEC22F6E35DF72ACE, 0x697DD8E424266303, 0x7D9AC85F8F1A36BC, 
-0x1ECC00032ED2C74D, 0x3E93E9C5DA186933, 0xFEE4A168D7750431, 0x4CB8E26089DA8621, 
-0xAC4773ED15B50449, 0x437FC8DD6A65AE67, 0xF0617A982B0A7433, 0x26E421EC2563, 
-0x5E48EA0E9288C227, 0xC594293723C10F2B, 0x92066D68A862C5AC, 0xF93E2894FA620AC8, 
-0xA5201904F94F1BEF, 0xE55741D7DE5A9B76, 0xD278C4091DD71390, 0x82125D7E6BA7210A, 
-0xA5FAA5D1FD51793, 0x9B9338F09EDAD37D, 0xF04529217829A6AE, 0x277678ABBA29, 
-0xEDA1D73E810EF1A9, 0x651F78004DB7AC16, 0x96CBB75E30E91AED, 0xEABA6F84A5DE1E0E, 
-0x6799A8777938106E, 0xCB2FFC41F3839CA2, 0x9F96D61123B11EB4, 0x930EFEE12AAC91B9, 
-0xFB0ABE9448E3C817, 0x30400030DAA86886, 0xE7C3BCB7B3B5BF3C, 0x2E88937670, 
-0x76ACF1DADF3133B, 0xE195A1252FED6CE6, 0x8668971F0D45E484, 0xA2B6D25999136FAB, 
-0x86AA60BBD30704, 0xFFA8A0E8C2EC6732, 0xE53A0BA0C27573EE, 0x6FF27F9F70352B47, 
-0x312644E9FBE39DC2, 0x8209A141FF2FD746, 0xC1CB8FBAA8F056CD, 0x562BBEB356B6, 
-0x523CC36FAA1D4770, 0xECA092625B301142, 0x9663E4063F174E07, 0x17A28FD4533E5DFA, 
-0xC7862113EDE800FD, 0x2BCC90971021CEF2, 0xABBED3266F9C60BD, 0x6DC82DAB8C2DA78C, 
-0xDCE95D586D23A85F, 0xCC3B3BE8596107BC, 0xAB1ACAC5B31221A9, 0x24DD85565F7C, 
-0xE69E4BC7A3107677, 0x2BBE932A38AA6251, 0xD06888BA99343DE8, 0x999BA558C97C838B, 
-0xC3C045D4C6C14568, 0xF51C43BE72B88F59, 0xA0647CD7BFC0A8B2, 0x2D43D67D0AF03997, 
-0xD8A0950FDD8350A8, 0xA08DF9866C37BD37, 0xCD94AD675F443E1A, 0x108554CE67CA, 
-0xF68BC234D4A63D75, 0x421F32472154CD1B, 0xB37BB99CBF736015, 0x86FD94DE54B4E06, 
-0x7CBE586C63329CDE, 0x891D56E955CD763F, 0x75AC0B9732EB5F33, 0x29339952F5955DE9, 
-0xB848AC2B4F04481B, 0xD4CBA721527E0100, 0xD9960B852A547720, 0x24524164D100, 
-0x84F00D9B33A04925, 0x5AE381C1327AA70A, 0x4A042F8E25C6FD0A, 0xA76D7B7A87481938, 
-0xB48B86F968430960, 0xF72C1A44C95415F, 0xAD50EBF554528545, 0xED3C8A14104CEC2B, 
-0xEB2CBE25CFA61584, 0xCC36A20F0C24C426, 0x68A474F662106460, 0x34C67B719358, 
-0x5B561A5C1EAEF66A, 0x6E53324AB5942456, 0x7330B38D4D192602, 0x9126484989D8AD24, 
-0x5E2AA0929B1432BD, 0xF07EC0B96633708, 0x2B5067BCA10E0CB3, 0x203781B81C9FF98A, 
-0xEEAC1F129824662A, 0xB04BB95489B4B365, 0x8AAF00C836B949AC, 0x85FDAAC7E0B, 
-0x585D41CEFE7FF62, 0xE450988F7BDF3D, 0x65FEA8C7EB53C52C, 0x9EB9CB2B47AD38CF, 
-0xBC639B047A4226F4, 0xAA414C5C71B16EAC, 0x410788C31120B920, 0xA7DDA3807689F389, 
-0x527A6E6E0DBF50DA, 0x55AE962FA9B161FE, 0x7649761157A38301, 0x19F985D6BAEC, 
-0xD7A2229521D82DB1, 0xA0673DB47E348310, 0x5062F4047A2FE7A4, 0xB89E77F447D93712, 
-0xD995E59ED3ECFFD3, 0x4449CC054086B044, 0xDC178ABEF10E9CA7, 0xDD5E7CB4894170C5, 
-0x55A6042D1DAD3E39, 0x9E9BCCF51022F6E9, 0xA8A7E6B832E831F, 0x55D53543BD12, 
-0x968A274A8582EFFC, 0xFA1BED014CF381D5, 0xAC7176E7DD1E7007, 0x4A612B0C02CFBEC5, 
-0xAAB2DEB33446AF08, 0xCBBA1E0ABB7DD446, 0x790D519535141773, 0x2926BC2ED207EF4C, 
-0x441159F4E1FCEBBD, 0x94EAE47A90AE519E, 0xE1DEEBA9B5F8DDAD, 0x6ABABB37F9EE, 
-0xBBD845382EDC9B48, 0x1F96FE38E50C513, 0x6E63F1CCC64CB5A2, 0xFEE0B9E64B771EC8, 
-0xB525286BF8D55B69, 0xFEF5336010A11DDF, 0x8982DB5F1383C859, 0x4EE42B8911B9E3CF, 
-0xD9C538E98D3CD054, 0x2057CE3A8F1CA047, 0x306D800D1EA62620, 0xC0FEC3122C1, 
-0x612E130A0C551F68, 0x2E81A18F1F222C78, 0x69694E220E9274BD, 0x57138992BF719FB1, 
-0x68B91A34C1B56E2D, 0x748595044EDE9C4A, 0x67B789EA59EE82FB, 0xAC1CE5C3F17660DC, 
-0xE029508BC35C23C8, 0xD79D54D52C44A11C, 0x1885FAF0B08A8CCB, 0x52ABC24F9B86, 
-0xC279C1E52D0B250F, 0x2496480C0527AAEA, 0x23C17B90DC29741, 0xFF3B3984FC13B2D, 
-0x53CC929AC78E5EEA, 0x91E2D1EF8D183540, 0x5875671C9A5099A4, 0x982C99FACBE9E825, 
-0xF9A0698A789D095C, 0x9CFB921A033A5F15, 0xCB1E51EC844FA863, 0x4A8B96BA7D2, 
-0xC50C1446F028D829, 0xB2C6817FD520DA79, 0x5FC8F9994D0853A5, 0x352A938FF930DFB3, 
-0x88972C47DC9FCCC2, 0x2898A7BC7E0C5216, 0xAA07D36B6E163EA, 0x8595DAB174B78CA0, 
-0xDF472C842FB5EBFD, 0xA07A678A0C200F1C, 0xBA5AABBE37219FCB, 0x6878F1A1CAD4, 
-0x70DAF8BB736FB8EC, 0x2305DCA4B0936AEC, 0x9293307E4871113C, 0x283087981398FA21, 
-0xBF9F9CE335D4F3EB, 0xA5B2399712D46B64, 0xC067FB556CB03CEF, 0x3E3DF1793CE6816C, 
-0x28F1550C533B32BA, 0xFF447E248F18F833, 0x36C0121DF6F69484, 0x1618D2956211, 
-0xA2A8D8D968F05D10, 0xB3D17CE8757E4AA9, 0x26947521972CB681, 0xAF1473359104A2F0, 
-0xC088257F0771F477, 0xB67D935BA9F91665, 0x261A8A155A15F39E, 0x809AE0944C793E28, 
-0xD6F48C90C923602E, 0xE8C49DD860AD6B6F, 0xDB0D76DE07B41F3F, 0x6630A552D94C, 
-0xDDB0A000974EBAD4, 0x645CB1E9AC1C858F, 0x2B92C3C6D5917D85, 0x260B8C063E03A1AB, 
-0x27073439DE26E902, 0x12879CDC976DD748, 0x13F91356B163085F, 0x98E15B4FABBFA6F, 
-0x899E0BABDBDB00FA, 0x5DC51B07DEE7185D, 0x2C13BA9B51169AE8, 0x4224C912CFEF, 
-0xB18C0093175D69EA, 0xDBA144B6C659192B, 0x914118254D2177AC, 0x4D15C9FCB79D0E23, 
-0x42E47D7C011D87B6, 0x43E3B0C66755F505, 0xA112791B5B829BC9, 0x20FC08569EE93DC2, 
-0xBFA73B465C288E1, 0x891F3E118D5B71B9, 0xCF64B6723222532F, 0x48EF8A8CB11, 
-0x5896A30F9755B4DE, 0xC24BB10D28506EB4, 0x1B49DE0076FA977C, 0xC4425F76B342C93C, 
-0x6BD7FAA31A70B263, 0x4F4988D10C2F7C3C, 0x52147C0D3B87D59B, 0x621CD29B671040CE, 
-0x7D2054627382D8B, 0x167186B709B98276, 0xD4C56A9CD7D2191E, 0x408D5BEF6016, 
-0x94ECCF8640A42883, 0xD5EC08C1DC2DAD21, 0xC1734C35B562C638, 0xB8E7BC255D6460EB, 
-0x9D6A02978AC5BBE6, 0xECC03AF72A87ED42, 0xD96A8991BF1CCF8C, 0xA71480DFFE206CDA, 
-0x8AED42C32055857A, 0x5435E4969C14CD82, 0x5D816F43D9BDFE0B, 0x68E4F5773B00, 
-0x2BEC3D01F2C06296, 0x61A92C3CFE342CFC, 0x50926C7027FD1B88, 0xADF58EA6BD270BDE, 
-0x1EA51BEF99E8F7C4, 0x7692E515614A3CBD, 0xF208E423F2DBAFB4, 0xF315971407784E7F, 
-0xFAD132DEFDCC8C22, 0x83EB85E79B6BD91C, 0x75D03E58821E02B8, 0x4884704BCFF, 
-0xC1F646664D9F221F, 0x20B76659A04AD8D6, 0xC13D4496C8D78859, 0xDABA5DEC8D14566B, 
-0x5C764109CAC1A90E, 0x318FC71A9BEB4CF2, 0x945806037969195D, 0x318DE2CBB26B9D69, 
-0xF5DC31B580262450, 0x3B7D8019A2B58328, 0x3D7573A547D8DFF6, 0x4ADDB4E55CB3, 
-0xDAEC97D6E95EBFEB, 0xFFB28863BAB085F9, 0xE50C01E51AF796FB, 0x8786B161322287AA, 
-0x3B10D8F603844DF1, 0xE873C8DB1D70F99, 0x2CDD60FF5D6A87D, 0x424EB16560185216, 
-0xEAD5214C95415796, 0xB56C9FEB72A21DBF, 0x32E0B347EA19E052, 0x534C6350A1E6, 
-0x43353CCF6EA07EA3, 0xCF5D27504F13C038, 0x95AEA22E3AA373CE, 0xB50C921DD1A53114, 
-0xAFF9277B9EC30D44, 0xE1566B9D6DFC4CAB, 0x586737BFC143E507, 0xF6930BB38FAB0C08, 
-0x5797D4F58A6F0D0C, 0xCDA93B733285ACAF, 0x72873D474194AF61, 0x46BEB20E6F75, 
-0x5E87435071CE9830, 0x460D5CD7AE415319, 0x523B1343C244A438, 0x1D4D6EF00D7277A3, 
-0xB751B3F46CE20E98, 0x3C648C0978735F43, 0xFB2371C695D6C9D, 0x7C52282B25836DFD, 
-0x4363A639A885F0C2, 0xF89EB5EF9B014A85, 0x4C4B2610C1FA57C, 0x3BF5EEDEA0B9, 
-0x2FDE892475C3A5FB, 0x3E51DBEA1EAE5415, 0x95BBC2398EDED751, 0xED7A0282B6857978, 
-0xB60EA9E21630C4A7, 0xA3437D3205B1F5B0, 0xAB0402CA3776E58C, 0x79720B031663EC40, 
-0x209D8D3CFF6857A7, 0x4A367DDC563B9D7F, 0x7099B0230F4D1E10, 0x9C66F32096E, 
-0x8732FF9AE66BAC68, 0x7EF2265CBEDE0966, 0x7E721AA659413FD0, 0x41DF8F9C2A9C275, 
-0xE83F21ECE77DD480, 0x7D53A1D0B513C043, 0xA417D6CCC8CFD469, 0x6635B812A1D41DFF, 
-0x1307E3FB5315788, 0x3A3F8D8765AF721D, 0xABDC5BDBA0E7A5C9, 0x5A6B16157F6F, 
-0xBAC33DBEE58C1AB0, 0x488AC8BD807C102A, 0x9E9D42DE3189E10C, 0x14DAB7414BA6EA50, 
-0xAFFA2C80E451984F, 0x907A3B3C69A4D9EF, 0x884AA273193E57E3, 0x5A837D2F6055745A, 
-0x12ABFCD6A0E64126, 0x25B90502D8F37286, 0xBEB58FDF3EEA8BA1, 0x52A4F25DA3CB, 
-0x886B513CFBFF7248, 0x54033D0AC3AE733B, 0x7F072331BE57F0EC, 0x97B591DEF9AA469B, 
-0xC9C1A698FA93D888, 0xE5E40D8CCDD487F8, 0x808FA9FABA36D223, 0x5630283D708881FB, 
-0xF2DA52C59663CA74, 0x625FEA14A9B69157, 0x7E5CD0B910C038C7, 0x321D1D570349, 
-0x5CCB247105D88DDC, 0x451532371BFB4E9F, 0xD4E9963190B5EB19, 0xC10314056211BB9A, 
-0x37E29EE276B45ADF, 0xC28BD66296E0AF83, 0x388F8F97E86AD659, 0xE4AF0BE891206F42, 
-0xB30BC055612A4312, 0xAB1626099E99172F, 0x3BDF1009DADF6C88, 0x93ECD357141, 
-0x15DC5AEC752E109C, 0x28130DBE97161C41, 0xCFFAAED47EB1B9C4, 0xC19AB1E28E868102, 
-0xD414A389814C269A, 0x6C705C7F4803B90, 0x5D4BE94CBEEB2688, 0x5F42A6EB76031A46, 
-0xDB2E5FD3A4C3D25B, 0xA844C979ADA3C955, 0x29E2E0ACAACCF2DD, 0x4BE1DAEAA61C, 
-0xF89D3B5E26144C9D, 0xD9F075F8B539E7BB, 0x3FDDC9C28DCDDF39, 0xF1539E7512A3BBA6, 
-0xAEA7694733B31D34, 0xCB43A2C0DBDE5D75, 0x1B320CA4F8069B39, 0x7EAEEF4A75608F9D, 
-0xBD69D8D72D26E738, 0x49F642F175598D99, 0x2C3C7FC6D30BDC4A, 0x27292974D190, 
-0xF92E3909A7F5E4E8, 0xE1D1590D9E02FBF8, 0x3C49BF19568595FB, 0x1A7582EB3F8F6869, 
-0x399E3E2FE1A2CE1, 0x3329662F7DCE463, 0x998A9996DA3D9363, 0x73ED9577A3E4E704, 
-0xAB03B0A8C6BD497C, 0x87B9D6C94F11F3B8, 0x22749ED966589BF1, 0x51798C61EAC, 
-0x354D63DFB228EE19, 0x87157A3AA52C6768, 0xEF35AD67019ACB6A, 0xCA39DBD4CE37B53A, 
-0x656A2D3DC9C98370, 0x4B18D6E27B1202F9, 0x1DAADC9455168947, 0x5986653A6D6EE2B, 
-0xAAC0D47D41567AA5, 0x90EFFEB15A95C23, 0x1EB366AF9ACFCEA9, 0x368AC2F0CE61, 
-0x10A22EBC405C7D71, 0xAEF280D51549F855, 0x24D755A3A6590CEA, 0x128538D3D66B3496, 
-0x3258DD00D922864A, 0x886DD7B004D12E8A, 0x5D892173B4E79494, 0x82F57F61CB38B6E6, 
-0x763D6BF73222C8E7, 0x1828995B4F5DC022, 0x53B895ABEEE37935, 0x4CDC97A053B3, 
-0xCE06C488CD1A2955, 0x7E595FD86D8863C7, 0x6396146025593D3D, 0xBC4796B645DECA04, 
-0xCD0B7FAD2B181A92, 0x88D67B2D2F4A432A, 0xBE943E45FAA500D7, 0x554F3FBEDC943624, 
-0x992952060EC194B4, 0x111B70B7C206ADA1, 0x5C6DC6C33BCC929, 0x6E342B1F4BDA, 
-0x3B6032D9B0F4EB, 0xA0E2F7A86F018522, 0x8A6F4CF2586C514B, 0x3F6E35597763955F, 
-0xDDA5376927342751, 0x482926D8AE39D89B, 0x607B8EBE8FC441D1, 0x79F95F4FB19EBE26, 
-0x6E938E9EA21E4B12, 0x15A527780486CA3B, 0x688527B0DE702B51, 0x64A96E83AD36, 
-0x628FEF9E3B889824, 0x35D02F776498C341, 0x7A61802F306D0574, 0xA667F85923769E6E, 
-0x313DF60970D4535D, 0xA1341BB9FD935841, 0xD5F8524424C80877, 0xBDF89FE4DADE4CD0, 
-0x64631E6CA92411C6, 0xB3CB323DB7BFC608, 0x2C856D0014DD3F63, 0x571C0605F8CC, 
-0x680848B1F55E28A4, 0xBDD937746541FEA5, 0xC478CD60C01384E0, 0xD080B2B496962DB6, 
-0x5EF3282219235002, 0x668A472CCD724319, 0xEE003D447200611, 0xE00E9E41789E75F3, 
-0x4C2EF5E823D61F29, 0x456082AA3A76C458, 0x194C2F098D3FCD89, 0x53B89B40C07B, 
-0xDC434CF247428A40, 0x47F5534C7C443C04, 0x75160B90E84EFCEF, 0xAF5572FBE5882CE4, 
-0x42593DCFBF9BE991, 0x7F65869D7ACBD212, 0xC64619F1B82600C2, 0x48D2CC1D90F6C981, 
-0xB02641DBCB0E389F, 0xEA421D7B10D818D6, 0xC3C8961C08A91505, 0x3F263FA49ECD, 
-0x2B1477D6F244A84D, 0x5D71C99F6557425F, 0xF1951F838964193, 0x9EEC3C9A220F9843, 
-0x9EF172505C62146B, 0x4CD3AC8C3ADC226F, 0x5CF276CFA18BCFFB, 0xFE2763019C3A1228, 
-0x945051428D6FAD40, 0xA3C688033668DB59, 0xAAF64AA2C1E3B2FD, 0x5BE50E926DEB, 
-0x32FDE817964C9B49, 0xA41CC1E373FF2AE0, 0xD3B3CB0A67D8D414, 0x52F537A52F311683, 
-0x956028D82D4B1787, 0x5E44A00B309DA3A0, 0xE7E35BFA654A0F2A, 0x395ABB9609B2D29A, 
-0x5A3D99A9646F4448, 0xAC95D11AB747CD12, 0x76A4D809EDD81F19, 0x39CBECBA5C0F, 
-0x83269BA4CB8140DC, 0x8B29A9B2C4B1EC5B, 0xCDA027E4AFAF1726, 0x2A06D7FF734F4973, 
-0x6229D198736C2691, 0x8387E702BBA3AA8B, 0xC87CD4B3775DAD09, 0x8587A76EB56E0E6D, 
-0x333C03A5482DC1D7, 0x1423CDFD8699C984, 0xCAB37C1CE2A28C5D, 0x6B85B00D272B, 
-0xB704B5B0B4432870, 0xF6E150F2306E782A, 0x64646F0761206536, 0xBF83CF6051CF9AAB, 
-0x72FAAE25C1CF393B, 0x45D2419C7C8DCEEB, 0x77141B87A6CC34F9, 0xCEDE2E2CED09DD80, 
-0xC84275C205C72904, 0xC6A8738268037CB5, 0x42870B9A7F4A5F6D, 0x15207628F75C, 
-0x23F07E8C0A89979E, 0xFA78A2E44629B36F, 0x139730DBB58E7F25, 0xEB34469870AF9253, 
-0xF95A18769C0A19D, 0x4F501EB4E10451D9, 0x1316914616408742, 0xDBF86B49650D9AA9, 
-0xC8D6DC3D51446869, 0x4B39A83293DEC85, 0xD1971DFA49201143, 0x7EA1024DD96, 
-0x8D936A77C469ECEF, 0x5F16FEE56911DEF0, 0xB56848949E135EEC, 0x5B0E5BBACD13987C, 
-0x2DA899449ADCB598, 0x7C0990C1373425FC, 0x79EF38D85E8327B9, 0x162071B7E2D4A60B, 
-0x1ABD6B8D7464BAA0, 0xF848C6574C9E721, 0xB050C3EDF4249B6, 0x26DC42320497, 
-0x21F84D3E472C2241, 0xD5D02FEB1AD8023E, 0x3E8A08F0EAD6A8D6, 0xA7D228AF011D80AC, 
-0xD41CFD0FA6A8CDA2, 0x354ED0A0845AACDC, 0xBB8336405ABE235A, 0xBC29B1EA8714E14F, 
-0x9651E95270C5AE25, 0x4B6C8F69FCF01458, 0xC667F94A78F3105C, 0x3F6A4F0F260E, 
-0x8CD79E02603333E2, 0x7981CA8B24A87A65, 0x1D64180C31598C0, 0xCD4ED79221934F34, 
-0x20BE60279E427830, 0xB671F5FC77FAD3B5, 0x2A30822EDDE484CB, 0xE20656D91571FF7, 
-0xA05DB0AE7B9AAA1A, 0xA4F461267AE258DC, 0xADB7F8E67282DB7A, 0x1FE912C7B0F3, 
-0x9AF27EE7C76AF4D8, 0xBF8DFFF385B64CD8, 0xEF6304BDB26233AE, 0x1A3B1BE8A20F619D, 
-0xD8FD6286C608BAE9, 0xD4EE20D5A825DDC6, 0x95AB7DBE2512631C, 0xD4856149A0AB27AB, 
-0x9A8E30552045D151, 0x49F6BC4EF884E1B2, 0x430EF2D712DC342C, 0x2311147E2D1E, 
-0x4157C3BEB2F2582D, 0x909985044F470A4B, 0x465E29EA605B2100, 0x468578593383F87C, 
-0x75F5302F3285A431, 0x7F9249B3A8FB4905, 0xA8811B231A8786DF, 0xA3B7A14E1CFCDCE9, 
-0xB11E8AC82608B610, 0xBEBB6E92BB3D10FA, 0x22A9D2C8D734639, 0x1125175C926B, 
-0x83D8B7B7893DAD08, 0xB89A0ED758890753, 0x6C1FCD0F30EB24F0, 0xF1E4F1BFADAE942D, 
-0x7734DE0BFF588473, 0xFA3CF0386C21AF01, 0xE04822960E0474BC, 0xFB6F67A404709884, 
-0x2F0FC4CE98F6114F, 0xD4D230ABDA64B18D, 0x93A9CC156B02E953, 0x2801C3964C24, 
-0x325631B542304E15, 0x550569E9F641FB76, 0xD8724945FC4E9990, 0x1571E9AE81E65B16, 
-0x124F119D96047BA4, 0xAFA975110DBF738B, 0x92682A7F183CF4BD, 0xB7ACB69F21273C6B, 
-0xDE9D1A96362A641A, 0x751E25EEBFAB1B2F, 0x94708C65FCDF2001, 0x5DE7DF3BCDCB, 
-0x2237FCC463644F2B, 0x6423DD01D0C6B5F9, 0x9FC72DD02A84C64B, 0xC7046D203D4055E3, 
-0x915EDDA75590FDAB, 0xCD8B4A3A90F49A7D, 0xF0AABE014E0D1A8B, 0xB4D776F57254840C, 
-0xDE665754D23F324A, 0x6116CFA830A205C8, 0x468305EC3022AD08, 0x651DBC64E0E0, 
-0x338310EE3F5E979, 0x4F4622CEA3084C37, 0xBBE8488659674518, 0xD1B4E5C869D5C4B3, 
-0x6425241ECFA2B256, 0xDEC7EF109FE77689, 0xADC75A38964B926B, 0xB14FA08756BA079D, 
-0x9E3A304AFFD61635, 0xC693E3C57FBA46E2, 0x96A12E3009EE4BEB, 0x41830F5A1942, 
-0x15D38FB116F493B3, 0x4116CA12018429B0, 0xA0FA5D2C8EB30B23, 0x6F2C8AA3C84F2F81, 
-0x520039A23F9C935, 0x2D1AAD479DB4B691, 0xC2A45C48E9283DED, 0x75B7101361D6A690, 
-0x1B77A6BCDADF4EBC, 0x1F1497B7A3397EA0, 0xCFBDBAF619A461EB, 0x1F3918DC9E7C, 
-0xC47FE549AE82D12E, 0xFD8C5048FD12F065, 0x6505DA00248A2BF0, 0x5A7EC0CD0D0C1422, 
-0xCF7402CD592AD52C, 0xFA197C5B99A304F6, 0xA792324E2E520E10, 0xF9E9FDD8B84DCAAE, 
-0x7F5F4BCF427E7F9B, 0xDF34D6AE56E8136B, 0xA33D3E9A2808371C, 0x517E33EB08E6, 
-0x55C78C234D730364, 0xE28B20E399343006, 0xDF26092897992D9D, 0x7BE132EBBC00051, 
-0xF5486FE18681D699, 0x7AE94220BA301E9A, 0x2A0BE865B58AA098, 0x1BEC61C1D321AA1F, 
-0x4581C3D234501, 0x7EDCFE2176486381, 0xCEED7D4CE37B68A1, 0x6F3DF85977F, 
-0x754CF07AE978568A, 0xF30CE39DD5FFA63F, 0x798D253E7D925038, 0x38B89FFEBD61795, 
-0xEA3598F2357AE9D0, 0xDBC2BB483796E852, 0x6720FE7B522DBB46, 0x1A67F4BFE917FC0C, 
-0xD3142913043E0, 0xF1D8C46244052515, 0x7F3EA5DCA047DCF, 0x42D1D8A3405E, 
-0xF3BFD1D3981370C, 0xA0498042F6738352, 0x6AA49D2D7BED33B0, 0x62B9CBFE6493BA90, 
-0x857A3FFFC5B8BED7, 0x5AE3B3AF1C313145, 0xAEF98024B6D55FC9, 0x4D10578747D35D98, 
-0x1B4FC53A8F95B43B, 0x5139E21D1969C110, 0xF6A26124FD8EFFDA, 0x37296646C291, 
-0xEFD44B7DB882B09D, 0x5AB884F4EF5CE96F, 0x358C59AF9B672E43, 0x842F08740CE9C0E6, 
-0xAF9442C82E0133FA, 0xE0AF7DC790DEE656, 0x72F5F7C86A9F1AEC, 0x66ACDDD246BED8B0, 
-0x39AFFDCE17CC2A27, 0x5CF406AC9D48C3BD, 0x38370AD95BF93F8E, 0x31302D41ED86, 
-0x266B6FC531DEB7B4, 0x26B998DD9C74033D, 0xAC03298331A51DCD, 0x6CD92E6D5B943C77, 
-0x41F6C1AEDC4D08AE, 0xB28A9691252B7E28, 0xF7CCED1723434668, 0x4DE1DAB706D39776, 
-0x3A9FFAE99E7AEF4C, 0x3C5E5D705E0736B7, 0x44825696576B97ED, 0x6C5C151F79FB, 
-0x5F4083CEA82DBF76, 0x11AB509D3E2DE337, 0xD126672643818E17, 0x6B3B1FC933B1DE74, 
-0x7FA750C813990525, 0xC2316B7978972CBC, 0x42B7ED603AC00E4, 0xAD28FD14791E9B46, 
-0x5B6BC087A2457C8E, 0xBDFFE7640B5B5C46, 0x6DC171C6E0DAAF4, 0x1BEE98AD42C, 
-0x68A5AD9D763F6BEF, 0x3E2F9A33F181FA9B, 0x8DADD0A74681D576, 0xAC38CFEB075AE153, 
-0x2B4CEA89DDF93BC7, 0xFEABF3DA1D171961, 0xCE2A54DDCE2F79AF, 0x3A5642C7FB275527, 
-0x8709EE801FCEED0D, 0xCAD64974779A2075, 0x56A9628BF80C9E5D, 0x52890A732FD0, 
-0x5C551D72BAD1B54, 0x56BF3CB84960204B, 0x9BE665CD296B4ADE, 0x764B2CC61C55096D, 
-0xB23887EBF0F622D8, 0x5DE7852544A0E260, 0x18F05C0DC4277236, 0x720647A7B310DF32, 
-0x6F3B3598634DF8D, 0x5836DB4D4D18D4D0, 0x9E95762C61A66B57, 0x29E3C3DE20F9, 
-0x4491B5FFAFCB5598, 0x15A756612BF41F6E, 0x96F512AB97D1FE2F, 0xCABB1DD56EE3B0F7, 
-0xB28BE7AD059411F1, 0xED265592BFFA862F, 0x719E4E6DF184FCF2, 0xC55AB086761F7C0A, 
-0x29F1B2826084B56D, 0x76EF5098D6A03FC7, 0xA1F42CB0062DB521, 0x5AD0E0DCD85D, 
-0x20612078900E07C, 0xDB6DEA6E91FB54BA, 0xFC9E8A88DB383838, 0x33FE5720041AC8BE, 
-0x693815AAD578D378, 0x5EC06BF1DBB20CE6, 0x87B853C999A4C070, 0x73DAFF063D1B771C, 
-0xCE244C725150DBD9, 0x7559C0CF369886FF, 0xC5BBC7EDC829366D, 0x2D2BCED87A10, 
-0xD6E83D68DE36A938, 0x7651F324C8C836D9, 0x13BD8DCAEA2D0854, 0xCBEA8B8C6E0BB9EF, 
-0xFA9D9F81AB1C8A4C, 0x59F62D5F8FA7C4BB, 0x58C8FDB01CB65624, 0xABDFEDFEAFF0A0E8, 
-0x31D64C69123A8F9F, 0xAC438284102397D7, 0xC9DE3676A706C0A8, 0x6F77CD2697D2, 
-0x94F34B3FEF253505, 0xE74C1CC7F5A5BC7F, 0xCA94A16297BD9B53, 0x29DB8CAABC3DF69F, 
-0xB7CA0D6314720784, 0x5E95B2507B0C34E6, 0x22ADAEC65DB1DB5B, 0xCB87BBB5F92F2105, 
-0xE13A822F4CAF075D, 0x76562852CD4B5445, 0x97D64CBECE3AE0E0, 0x436E6B9AC89, 
-0x5443C4E0E90F6101, 0x9B30689E75BAF468, 0x35D35BC5D1D356C3, 0x399A1EA53B722666, 
-0xB916C5B7F8CBCF82, 0x3E2F7EBE8D83767, 0xB19B304864F81F4A, 0xE8CAA9CA693CC9B1, 
-0x2367F564CF2BC42F, 0x92E415195420415, 0x5D8109611F67B3AD, 0x1FED827902F5, 
-0x968F085CEB866A4A, 0xB3C33257660C75E6, 0x898699D9B6F4365B, 0xAAB3D7E9AE5550D2, 
-0x211DDDFEA51768CD, 0x5F2448CC71A16E2, 0x1D825D003B37D346, 0x733A57C2E7D4B20D, 
-0x2FFD8BB71C6AC096, 0x8949999D5E90EEBB, 0xAC64CD4167D2FF72, 0x1A081068C8EE, 
-0x43AA31D25F0BBA15, 0x4865EFEECD2FCDF4, 0xB847ADC0D4EA89D1, 0xE27A40F51403A7AC, 
-0xBB0E640FE67CD410, 0xC1939F89297614F6, 0x709FB7FE3BBC1D52, 0x55BF84E32CA93D82, 
-0x22C0B1A67C311006, 0x204C7B90E8C3B6A9, 0x5659C7CAA504CEEE, 0x68310425B9BA, 
-0x3F1533BE95726B2, 0x21B63FADAC027DC9, 0x5580853382416A21, 0x769230B78654B193, 
-0x56EE18BD9BBF09B5, 0x5359B2117B833BF6, 0xE1169AC9E630523, 0xF71034B604AD97F8, 
-0xF14359117602884, 0x17796DE79193C64, 0x7F8D9724FAB81E7C, 0x6DEE664AB5D9, 
-0x625D99CFCF554E57, 0x9D3DE1BC0B53EF12, 0xCC02CAA6EF52FB25, 0x8765F37F8C5BCED1, 
-0x807748DA1F26EF78, 0x18C6BDC3EB33B919, 0x91456574B3B72095, 0x73B58CB050AF5E12, 
-0xCA3D05E5C625C659, 0xCA808E8CC66C600D, 0x800ECD10818BFE3A, 0x2F136586DEBA, 
-0x67788AE3CD26177E, 0x6964B7BA70C1344C, 0x20001E445E61598D, 0xCEB8542F321007B0, 
-0xF7F2C21D5A6AC6A8, 0xF4A544E1789F2610, 0x71C00EBC5133858F, 0xEBFB7CFECFE6DDF5, 
-0x41E97DC2103B7242, 0xE749C2AB4D227D0F, 0x66E61B648511610, 0x334322D42A4B, 
-0xEA917838BD09DF08, 0x8A7650CAFCC94383, 0xF219CBB9D23348A, 0x716E4180EA365757, 
-0xA808456D9DFE0115, 0xEC704A8E668652AF, 0x8606D4E6DD9CC840, 0xD57E39638335133E, 
-0xD4662E10FB2BD887, 0x7659F3E9C14744B4, 0x7DD3BD735B7A4F0, 0x1333F708E939, 
-0x1A1A8D7AB7DB388C, 0x3B6C171AE3BD415D, 0x1973AFAACAD8D22, 0xA0B51EDC659A08BE, 
-0x8BC4EA9BA4A1FAC2, 0x5B9CDF254AE552E1, 0x4ED56C4A847D4B6, 0xC06DD7B45C285615, 
-0xA80436DF561CAC60, 0x7A95DB248C5EBE2, 0x1F2C073D379D0A92, 0xD423E85110F, 
-0xD587BEE80354721, 0x3CBCBDFBBA6A6622, 0xACAD430A0D70D016, 0x6339118DBD0D3760, 
-0xE0CDB4A97F4CEC82, 0x8AB5D26B58850134, 0xA726F2749C3E53D2, 0xFD34185367310EC6, 
-0xE9519222BB002612, 0x1791458C1A58F805, 0xDD1B27FB93470917, 0x5107031E3612, 
-0x55C6395DDC52DB7D, 0xB2B436A0E6D86F60, 0x70B9C5539E756CDF, 0xD86FD0C8B3E2FFEA, 
-0x2039E7EF92FBFB54, 0x3C3B322DDB0FCE46, 0x85C7DC88C9105B4C, 0x52999884E2A1B8F4, 
-0x3D425C75CED1C92D, 0x720CAE3015089EEB, 0x9EE05809BC3597BE, 0x8BAD857978F, 
-0x59807810338A29F7, 0xFFF5D8115E2339F8, 0x10B2ED15E38E3370, 0x2DD62FD1CBB65749, 
-0x1C731A5C8C8EFD1C, 0x9B4DC66CE3B347A2, 0x9B8781F48516B2D1, 0xE61A9EA4DC5D6FA7, 
-0x1D66097E49374F7E, 0x63CE18D68666D2D3, 0x14B02E6242E6AFCC, 0x6D746629656B, 
-0x7BFED6129C9332C8, 0xA525F5F39B955747, 0x34687FB98622E58A, 0xCFAE53F146D95F58, 
-0x26895BAABB23B089, 0xA1D043EEFC1698DE, 0x94570270869DE165, 0x42EA2B4A6040D8B9, 
-0xA053CD25E59715E6, 0x93EF545991EA06FD, 0x458EF509D8CEF2AE, 0x526F347654E0, 
-0x540E13C1C7EB1A58, 0x7600AB21AC7828BD, 0xD7BA92457FE6DE26, 0x5AEC8B096D526D84, 
-0xE6737C2A121870B4, 0x61565F2A8424B9D5, 0xE2095BEA9881ACC, 0xEEDB55AFBBEBBA11, 
-0x487D727F4FC6BA9A, 0x8BD7E62F6A6FD625, 0x43C8F883F3A07771, 0x2AD771F80A7D, 
-0x34F2F679329F685B, 0x2AEF75A66BC44466, 0xF1CCCA8542EBA38A, 0xD8FF85F66886828E, 
-0x1E59DAD9039D163A, 0xDC73038BB5DE124, 0xD18B45E263742FA9, 0xE865D85992098529, 
-0xB437C8233AB1547A, 0xAE5D36307768E43, 0x5449AA2FD313C1E3, 0x266D30281360, 
-0xCFF6A88BD591376D, 0x9503348D2FAF14A8, 0x5A0AEFC1A9982A3E, 0x25C2774473FDEE8C, 
-0xE9CCC3810B5B3E7A, 0xBAA8E8AC578243E5, 0xDFF791E8FBF5B16F, 0x4AB4C59E7ADE8DA, 
-0x6BE9C4D3F6862114, 0x8567435336F7F128, 0x10662880FC30845C, 0x33E9DCB68E3E, 
-0xC1179A07111F0A6C, 0xA9062C438CEFBBB5, 0x2E3AE689C8A57DD9, 0x8406A4ED07915D66, 
-0xC721023C2153797F, 0x162AF6743370C3DE, 0xE5F2CC9524C44978, 0xBDC3CE4DF3E0A4AE, 
-0x8FECBA46B53CE727, 0x8FBC815F9545CF3D, 0xEB5BDE410532BF12, 0x15B74728724, 
-0xD5293CB83C16434D, 0x9FC944B53446E733, 0xA6184FB33C96AE19, 0xA255CDEBD428E907, 
-0x22C41DF50994559D, 0x299B037860B60CE5, 0x613D59EBE2BA5B2D, 0xE3B34AA610D26183, 
-0x352610A847E5676B, 0x70B32CCBECD19848, 0x6553ED24F917CD8A, 0x13B0C8C3C4ED, 
-0x7098F44B27479382, 0x9135E4EAB152AC5, 0xE396285D99E641A4, 0xF068AB16987DD523, 
-0x47B96E5F9C4637CD, 0xF0AF3A1E1F9AEBBE, 0x2230775B9A77A23F, 0x5D1802892322A784, 
-0xD897FFF0CC40B9CB, 0xE8BA1A6E47E99FA4, 0x3F3DCEAE1C337504, 0x58AFA85AC14F, 
-0x30E10489F144E9F, 0x7CA62C02B057A4ED, 0x1C001E58967A3CE2, 0xADD5389A1A99AA35, 
-0x3566D0F99E66AA64, 0x113AA3F2C2DBDFF5, 0xFC821BB99D04669B, 0x989DBC467C7AFB51, 
-0xE3122F6CCA056ADC, 0x9455CCEC658EA4F1, 0xFFD30E2D26A3E357, 0x2D0B0119A5B3, 
-0xE0BD037815BF2A98, 0xB53B0DA2C7B00B88, 0xAE66B3E6BD6AF05F, 0x1E88A4AE2AC1B1C1, 
-0xB7AF1E1CA9A31F2F, 0x596AD5E99ADEE09F, 0x1788F6E6BCADC104, 0x9BF36567855A77F4, 
-0x9635CB6FB42CB52B, 0xEACEB52E9ED6F6ED, 0x4CCC491D85CDAA60, 0x3AC1D7FAF847, 
-0x2BA334B7540ACB9A, 0x7FE8E23556082B2C, 0x9626A5115AADB8C, 0x98769615AF5E730F, 
-0xAC8FF4A98AA2D018, 0x3BF48552B6F91AB4, 0x537DF036F15DD8C, 0x7A3F5101CFC8A776, 
-0xFC74DD1B1BAE546B, 0xD4E3C9BEEA432FB8, 0xE2D4080E7596027C, 0x303903CE92F1, 
-0xF9860D80529E141, 0x822A389F15145BEE, 0x40F79976745DF288, 0x9E1675F783CE849B, 
-0xFE02B1CCC97A1D6B, 0x7CDD02B756DA611C, 0xBB857C87D1491B9D, 0xEB34A8DAAACC52DD, 
-0x77DEA3755CCDF373, 0x43D4F2FCF1A24454, 0x6B0A37FCA26AFA62, 0x4E8FC4DF484C, 
-0xFECF7031EB86EF91, 0xA3497B864531E2BE, 0x8DCC81B731092F7D, 0x87AA694E68E6E9E0, 
-0xC1A1976ADD70D2B4, 0x2DF9C2D74186CF69, 0xD04E26112B7E8430, 0x8081927711F2B81D, 
-0x2E4757C7423F15AB, 0xAC5FF3C40EC824C1, 0x612F770F1D993779, 0x4BE640AE3F7F, 
-0x4FAEC079FEA2FD40, 0x5CB8C5C43A1E624D, 0x521B571FFF1C09EA, 0x7CF857918CD0CFCA, 
-0xB308B0F466B49A2F, 0x4B6F567B3D562B38, 0x1DE5D7C1D98A27F7, 0xC07F078EEE1B2B80, 
-0xC14CC93CF873A62E, 0xC1DB87C44DF45F4C, 0xCED7B17049895556, 0x60140BB4982B, 
-0xC839D2F26857E4C4, 0x772E6B8C5E120E28, 0x92B65A5F13A56B51, 0xF8988394E53AD564, 
-0xA9534485CA9FAF7B, 0xA2F8D93222D7F00, 0xC0AAFB8F0581E30A, 0x858DD116900F00BB, 
-0x2C2167429D8C6B5A, 0xF7BF071082254958, 0x90C5E0810252BFFB, 0x27CC30EBB38, 
-0x9A90D2F681EDBF04, 0xADE8CB95C15EAA8B, 0x8B3AFEE238A890AF, 0x53663DACBE6A3502, 
-0x541E994D52722F3E, 0x24BAF5B4F71C68CF, 0xFF70BB31C60FD4EB, 0x5D68197A619B974B, 
-0x17A99C39D632D529, 0x33AD79F2393D10AE, 0xE367A24D617312E9, 0x3E5E423558D0, 
-0x5F37E1350E306034, 0x50A72B21A2DAA541, 0x67A4E1D2D9A7239D, 0x767E8F8BC4613828, 
-0x22F4C7263AD6432D, 0xF9E643BA440D0606, 0xC8352F5A1D7ADA39, 0xE20D24EE0E347CD6, 
-0x10235B9CBC6D048B, 0xDC2DFE575EF7EEB0, 0xBD2CF0D065059810, 0x3C97573E6FBD, 
-0xF493C70F8FCBFBFB, 0xFE231E90672ADA6B, 0xB3684F8073BDE026, 0xC8A5845799F52531, 
-0xDF4A3136946253A4, 0xD87208B6C69F7D2B, 0x5911F08962D8F963, 0xB8C8554B07633C0B, 
-0x2D34B5431DF8A021, 0x22BD7777FF27E3CB, 0x4F9C6046F4346B9, 0x41E943B6B2D1, 
-0x28AB1701DD09968B, 0x4D324373B7434B34, 0x6F829BB2AD4FD42B, 0x86B16CC5F4E33B8D, 
-0xE31423C2E2704BE2, 0x71765C102E3BA87B, 0xD8091D44F3BB8A9C, 0x8124789BAB30941F, 
-0x3C131D4845D6487E, 0xBE08372633F28BF5, 0xE3D8E816377D9B8A, 0x22A5523B5D5F, 
-0xFE84A365265033B5, 0x487D085CEA777B10, 0x3912FC450E94B4B8, 0x99B0DDAB31920247, 
-0x1F8D41237F85E074, 0xFEFF9B57D7DD1493, 0xB0066FDC62286092, 0x10C5DB37CB16C69, 
-0xBC1A1C8FAABF0E05, 0x120FC38595BF9247, 0x3FF812A735B86F67, 0x370A68EDB824, 
-0x28EB6C0E9B0F60E0, 0x95AF5BEA2274EE, 0x88971ED63DB67E8B, 0x76D5851ECFE64FD5, 
-0xCFE1CE7E0B0830FA, 0xCAB228DC00C99513, 0x46537C38815E921C, 0xBEED00F575987AB9, 
-0x687DBB949BC8744, 0xE57ED5FE9559972, 0xED3B6C874B7B261E, 0x104148392A9B, 
-0x3393D16F9F115CDC, 0xA7964DEECDE22BB7, 0x7BC86D9BA1B39E54, 0x16270D224A58928E, 
-0x5ABE11596F19946D, 0x94BDC3EE20F00543, 0x1D6D0CA55BE38655, 0xE42FBECFDB5487B5, 
-0xC55665C6C44AFC8C, 0x3340822E25E0CC65, 0x576EE275417B896D, 0x4DF4C9F40513, 
-0x4613A6EFB8D4B982, 0x74755DE37CA95800, 0x6DFC28D8478FCDA5, 0x895DE28942D3B45B, 
-0x6D612F0C0DD3407, 0x81BA16A5DFFDD3F, 0x97FA30BFF1B326B2, 0x9A13A8CDA9047B3C, 
-0xCC19CEC0EF33012F, 0x65C0023AE1FC41C5, 0x268C6631AE718C55, 0x276A82DAE3CD, 
-0x971F7490DE261239, 0xAE6F36D407853574, 0x5A971E8701532228, 0xD3351DE3AEDEE201, 
-0xAA7495A9072DF6EA, 0xD29DC59D284AF55, 0xDEF4396AD639E0D5, 0x5E44583EA15A477E, 
-0xB5D381840B1154A9, 0x6307FDF7734BBC1A, 0x9BA5F7AB7966B8F1, 0x4122783F7CF, 
-0x4BA2F89FEB20DC3B, 0xC065E01E1763C324, 0x4FE0493E4DE10356, 0x85F61CEFD00A7619, 
-0x893FD811ADE09C58, 0xCBBBF5B4C17F4403, 0xBC82A51C0501E69F, 0x1B0DA742274A0447, 
-0x67116401D8FD940A, 0x9B49032B7F77D32D, 0xBD6F4A85131722D9, 0x6983FC770E8, 
-0x95B4DF6F97812873, 0x6EF6885CDFD5624D, 0x12F30234957E742C, 0x5A1EB474AC6FB72B, 
-0xC7A5B217C5829096, 0x49085C68B76E5623, 0x729078D04158189E, 0xFEACFFEB01EB754C, 
-0x469655460D4FDD3E, 0xD0662D975E478105, 0xB2C00732AFE0B16F, 0x2BC42AF0E6BA, 
-0x60B23BF88923D453, 0x757AB59034131B, 0x5B3B39C54D346683, 0x10F5DC56DBEE790D, 
-0xAEB4A4295BCCF8CB, 0x7173E36032F3F1D8, 0xE3F8D1B64237ACD2, 0x7F3BE6AA95C5E248, 
-0xF9FDC870B7D2D2EA, 0x409FBBC589F0D9E3, 0x1E263C980889ABDC, 0x690D5DE46E4, 
-0x672E5647DEE25DB5, 0x77AB7972C024DF26, 0x3A2413145A3B9DB0, 0x5FF9A4F99E9D9EE0, 
-0x6267057DE902503E, 0x2919891BFB5FB0A7, 0xE82F83485529878F, 0x2FFE6E99594FF589, 
-0xABB1C78228CC889F, 0xC6B371A1782EF5E0, 0xAF9F2D6EFE820880, 0x43F5091C3AF7, 
-0xB800732A2060A10B, 0x4A346A5EFB4650E6, 0x7A4C334F8F9412C, 0x383DFF25F77BB044, 
-0x6BA060D8E4CC0998, 0xADC3BE3BEE889851, 0xA020CDED05E592DC, 0x2E93C0A109D6DDB2, 
-0x7B51FA62EDD294BB, 0x17B963E0C36B554F, 0xB86122D4D3734257, 0x363B2F1D75AA, 
-0xCA63B4E69549C286, 0xBF8BD055BDF9CD38, 0x92C2CB7956DB152D, 0xA9D850F98E6A1788, 
-0x9DE82909C10BED36, 0x4D155DCCD3DF4122, 0x8ABC61728507337, 0x5C406B0907E13489, 
-0x97F6BFAF760C7643, 0x72A6B8514612165E, 0xB41AB8258A8813C7, 0x25731B91F488, 
-0x5E33EB98F03BB5D9, 0xB8C2494724F5C0A2, 0x54D9EFFD8D415004, 0x2A4E71C9532C654B, 
-0xA1334E553754F9C9, 0x34B4B2ECB3F52D56, 0xCBCDC9B2C0BA7665, 0x8E429A1A44EFDC25, 
-0xFD71C7B695944B28, 0x51E6AB2915E9E401, 0x430EE0B36DEA9EEA, 0x3FD881146AF4, 
-0xE3AEE210A6324986, 0x744D38A58295C71F, 0xC973C00392816890, 0xB5FE22BB7EAD240F, 
-0x690CD92264971774, 0xA2D10CC482EA994E, 0x270AC9D53151EFEE, 0xEBB37AD83417C6EC, 
-0x7FDE340722E4C38B, 0xF8CB16D218071279, 0x74992757DAE928F4, 0x1AB77B0E258, 
-0xC8BBFF0C6B8E30FA, 0xCB112DD151491F84, 0x75C4FA1CD02B1C98, 0x4057CA06D9072534, 
-0xCE3CB0C0C3943CF8, 0x6287D3AB58D11D0D, 0xAD3F9CD72FA40973, 0x47B11FE141B96089, 
-0x78397D3E767D9A2E, 0x901F9A9DC48DBD2E, 0xA3CDCA671F8E5872, 0x432B9FF16ED2, 
-0x4206946924861B72, 0x35C3C6F30FD297F4, 0xB477A3661F13E0F5, 0x427A07EAD820109C, 
-0xD8880447180B4E52, 0x60DB0F6BD15564A2, 0x48B41DB46A0C4325, 0x6A46F2B11F5771ED, 
-0xEEAA3C9D11E98D8F, 0x7411C2B2269AAEBB, 0x8CE591A8DB23A6B2, 0x411CC2F1BD5, 
-0xF7425117C09AD79C, 0x2CE080F1B43D8002, 0xE5F90C1CECA03391, 0x688DA37AA82951A, 
-0xE67ACEF13DDF5A2E, 0x8BE5DBCAC15F3B8A, 0x71508E106F3A4C23, 0xBA6C16AD6FAA044C, 
-0x59FE78FAEB277E2C, 0xCC7B69B3FE266DEE, 0x94C93F34716B265, 0x28E965180696, 
-0x81AA131371A094FF, 0x71A19BB361714E40, 0x48B866FD144D3EF6, 0xDD56B38BE3246FC0, 
-0xA065F029F2A03373, 0x13C227D28BA72C67, 0x4E15AAF7553D965, 0x9E0FB3E14A0F78A0, 
-0xDB735E41FBD97A13, 0xC4D634F28A810057, 0x2AE14A692E6A516A, 0xCC6696011FA, 
-0xAD7C7215BE088C93, 0x118A131BB5BB5973, 0x6C2ED32BBECE220E, 0xDF40035E465A00D3, 
-0xD034114DF4EAEF69, 0x77C287CC7B6B9B37, 0x56B3F797F88A464A, 0xA02B524FD9523745, 
-0x72410DCF7ACD335C, 0x2B945F6C6D480C15, 0xD2F19DCB39F8F16D, 0x642F8C692C2E, 
-0x504C6580F5B5FBEC, 0xE4DC3BF0C2E5A670, 0xDA2A05DB6185AE4F, 0xC8A48D48B16E3C4D, 
-0xFD50D2E7C3D7A9CE, 0xB43C59EBA2BDA02F, 0xABE29A75992856DE, 0xBCB3E0E5E6326074, 
-0x166EC493EC3DBD26, 0xF6CE10D0A60FBCFE, 0xAC068780D0D8427B, 0xB37A1E81181, 
-0x91432334CAB194D6, 0x13F3001B11C9EE9A, 0xDB1ABB3D9E648608, 0x1B250F5DDF45289D, 
-0x4A7E4314DE6D664F, 0x10D193E8087E0797, 0x89E042B2B0CC9A77, 0x82C76C76B2180C68, 
-0x4C1622A8DE769048, 0x6ACD30A18795DDC8, 0xDB079E5043D6E2FF, 0x1C5F8ECAD812, 
-0x95F6C7A740BB8FD6, 0xFA878EC9E89BF6E2, 0x23250647A4B92F37, 0xEDD7BB78DF0A06E8, 
-0xBC2A1E0FE876FD9C, 0x88C9F98CABCB9EDC, 0xADE97FF79BC7893F, 0x3DDBFBAF0F1D5F7A, 
-0xD1F91488BF04F562, 0x804471182D69F91E, 0xB124D51F96E7E50D, 0x51B98E29295C, 
-0x441D3024596225F2, 0x12393D3F2542A25, 0x9006B0CE99F0D7DF, 0xC654D159ED7F0DFF, 
-0x6A7B028E5AEF671B, 0x46E334CFAE337ADA, 0x45B5EC9D988B5BAE, 0x468846FC3AEB2811, 
-0xA9D7D6EC91979BF, 0x8BE516C634E0BD5E, 0x6864A8B26FE34CCF, 0x619886ABA633, 
-0xEFD5D8AB4978882E, 0x103F5E5BD366E172, 0xC3F143D23CDD71B2, 0x751DB92524191287, 
-0xD93FB160D5F7C9B4, 0xCD30569AA3F26A82, 0x3D554EFE48B77915, 0x6E526856B3CE1D9A, 
-0x87F636C813D38B8E, 0xE5D3335BDA12E634, 0xBA3376C2A2F9D473, 0x4D193B5D5C3F, 
-0x2BE7B51A12324E6D, 0xF9B2AC770A0099BD, 0xE55B6FB01876BA55, 0xAD7CB955BC719FAA, 
-0x9A19ADBFF2863B15, 0x2D8D67092EA6C064, 0x37A36F39A33ACB7D, 0xC762EE40E996C3DC, 
-0xD314489FC398FB3C, 0xA587D091C8B2F568, 0x8E9568E3B849C60A, 0x3F2AD912D57F, 
-0x9671BA66B98BC7FE, 0x3767C07C41387556, 0xE09337F85494F1B0, 0xB587B736C0D0C813, 
-0xEB22DE74D40E39AA, 0xC6327BCC3357E6A6, 0x81AFEB29A3BD7BAC, 0x307A96A2E3B6EE3B, 
-0xC949927AB4925ABB, 0x46731041CAE29B4, 0x392FD468170F8D80, 0x192EC847FB0A, 
-0x7272AA5BFDD53C47, 0xDE3CE2DB3BA38710, 0x97F1B83E5D2E1564, 0x68EF778991E3611A, 
-0xA22A5B673F7FFB7D, 0xC3E7AFB9531CEE4C, 0x69478BD94C619920, 0xF5FCEDF86242FB36, 
-0x5A50E731F4267F03, 0xFE5CD18D6AFFAF1A, 0xC7FC0753E477568C, 0x643C190D7BCC, 
-0xC619F2A81E05957, 0xAAD0CB13DADB00F, 0xDECC6C4657AB1781, 0x92DDA1191455EA46, 
-0x72106556D4631508, 0x4C97529A654911F3, 0xC6DFC1BF0166648A, 0xADE6CB6354559A31, 
-0xF725C47E9D6F4152, 0x515938E6EAA6C0A0, 0x8A3EBC644D82D04B, 0x24730C1E331C, 
-0x7E3178D9BF257319, 0xC806DDACB2D7512C, 0xA283A41264985A89, 0xFB129B395CFEBB39, 
-0x96D2AEEF4A2EAAA2, 0xF8232E1D26B5C1D7, 0xD4E0EE6985DF1307, 0xEEADFE181A2090C3, 
-0x14A99B60A7DACF0A, 0x5251D437FA67A5FA, 0xCE3F995B278EC2DF, 0x2B6CD52F9123, 
-0xF42F8A254890F970, 0xE61D86B87AE0FEA5, 0x7A052FC6E8AEA502, 0x376E4136E1E04FEB, 
-0xB424A265AC24CE46, 0x415E3C11FFFF82E1, 0x3691F69720D1222A, 0xCE910286A88225B4, 
-0x9A53CBD5CA620B5E, 0x37C167203BDA3939, 0x476280015CAFBCCB, 0x22DCCE5AC5D5, 
-0xB88EFA92663C7B51, 0xCA234E89A461FF02, 0xA4F10AE6DB2C96AE, 0x785F202AC49A9C0E, 
-0x184E011306719B41, 0xD2ED20681563AD70, 0xA0DEA78F7C3BBDC1, 0xF3CACEB3B21B3F27, 
-0x8A9DDD81599567EA, 0x4BEEF906358284E9, 0x750734AA4CBB57DF, 0x5582DD093BFD, 
-0x9593761019C4E974, 0xE55CC91625A6B05C, 0xF4A401022C66AF4C, 0x3FE868BD246F4221, 
-0xA4BD8EFEFEE51CA2, 0x32DADF636BD9A5D, 0x8B3C7A684FE96CFD, 0x4D2B48A06A56A316, 
-0xBE3AF5270C415AB, 0x2807568048CFC7FD, 0x4F37787CBECADF04, 0x6DB0AFBF4A3, 
-0xF47561ACD297F426, 0xCB8C8E2E11E0632B, 0x48A2ACDBF2B64F75, 0x5800DB972589C018, 
-0x96E23BB21A91AB3F, 0x9BA0049939D54AC5, 0xB346B13957ADF0FC, 0xBE302EDBE83D8226, 
-0x5E2F7FDDB50AC0D3, 0x7985CE5F300C978A, 0x430E088FE3F76F78, 0x6945C314E69, 
-0xB23C3E1AB89A15FC, 0x73DEB4947C10E1B2, 0xA86D118A757988A4, 0x7621042D7C79EDDC, 
-0xCA84B789EA8D3FD5, 0x14A46EE795D15A8B, 0x2A2DB128AE128A33, 0x6B3B75FDF3691179, 
-0xB78C766132C26FA9, 0xA922729282138A47, 0x7754A9523F1B3A6D, 0x4F69BCF1ABB5, 
-0x8DE62D5689F64D8, 0xD6DF0D927FE5E11, 0xC6EB3169B9F4AE18, 0x87EE8D4C0DE1772E, 
-0xAFA6E024062434E8, 0xE8CC5258DF2F222F, 0xC11A1F392CFB5DC3, 0x40E18EFDEF8111A6, 
-0x28C07D414653EFFA, 0x1029F037C5C64857, 0x6B5E22D5D733431F, 0x9B06D05599C, 
-0x786FF5A1C7D768A, 0xE47921F0B7BAC0FA, 0xAFABEC0F10E94166, 0xFC703E0B1B47B43A, 
-0xF76BCC539DB7D332, 0xA8CC04CBE877D3C3, 0x5E75FC8DEA35BA49, 0xC0603ECCCD98950A, 
-0x3FFD29761F47C366, 0xA14AE81331CA8574, 0x2AC4B8D7192F207A, 0x35B6CFD850A2, 
-0x420F58C9BDB3BFB8, 0x63B39FE94E5D93F0, 0x7DA29A5EC712C600, 0xDDC270F6DE9123D8, 
-0xFB235A164195F759, 0x9B3746C4CE5BF387, 0x16872EEB75AFC719, 0xD7DDE1444F731862, 
-0x9C2E67793206BABE, 0x5ABB1B5F071607F2, 0x3911B30DA2CA109F, 0x6911133502E8, 
-0xA441EC17B1DB7D07, 0x120C6EBD7AE1F046, 0xFC6B5F4B4A0D6EC1, 0x8A70400A2C599370, 
-0xF699D880670E436E, 0x17F403F2AAB87AEF, 0xB8FE26D0B8319DD8, 0xEB0FEBF75AD2B08F, 
-0xBDA6EF0CEB1A0DA6, 0x8C4BBC0C5647849B, 0x5A207CE53D09BE37, 0x4F35ACF2D51B, 
-0xF98426F775818AFA, 0xB7E2FB75726E57E7, 0xA316AA703763773B, 0xC890D76B9F39D11D, 
-0x592AB844A6B06685, 0x496FDC535042553B, 0xA249D5B563A4E160, 0xDA554E12EC461799, 
-0xF806F958795EC6D9, 0x3C39C6193C69178D, 0xD04CBE26797AA8DB, 0x526958F7BB0B, 
-0x162EE51D33319497, 0xEB6B07CC2BFAEE6E, 0x93E84D9C949B4FD5, 0x4FEF956041AE215F, 
-0x165219ED08F5E7A6, 0x9CECF6D2E521DA8D, 0xDD2440AB4CE3B6EE, 0x4632C69CB54968FB, 
-0x62F63213AB7B6803, 0x6CA19D84B4EAC7C9, 0xE5C5292CDB789155, 0xF35E40F8A41, 
-0xAAFF25DDE2752A7D, 0xC3FD09740863971D, 0x8256044E3542BB3C, 0x6D850731D269DB76, 
-0xD3FC002D550C786A, 0x8F1F544547500F59, 0xF25C5BC21F49A5FB, 0xC5089F1476ACBAD3, 
-0xCBD8912D68DC21D9, 0x3E4C8F72BCCF1861, 0x281CB3970AEF176A, 0x98392F5F25B, 
-0x2B032003E12CFED9, 0x9DF75F60FD67AE9C, 0x43474EA69C615F23, 0x8FB27F0660DC90FA, 
-0xE113757D645BEAB0, 0xAB6BE13F43653E7D, 0x58EAB5D5A7406518, 0xD123CC7884DFC03F, 
-0xF3A349C5D9DAA7A6, 0xA99FB244E2985466, 0xBF0A7BCD1751B0D5, 0x430D43A7AE3B, 
-0xAB3D37FAFDD04A23, 0xE3D31BF9475316D3, 0xF937ABD11E6DFFAA, 0x9D78BAE82DC69B16, 
-0x4DB9A98E5A3C29EF, 0x3BF0CA835F386EDF, 0xE8A6FC9471C2F815, 0xA0807E8A35BBDAC, 
-0x7DBBE2B8AFB0B1AA, 0xA0720332A296FB9C, 0x24BBDB9B7C7881DC, 0x339716872051, 
-0x42A00377C5DFB0D8, 0x4E4627EEBF500307, 0x548E6DD3D2D350FD, 0x6835BB9C5321CFF7, 
-0x29A253DAAFD45BA7, 0x758121A31AE82746, 0xC572D23514443664, 0xCFCFEF50C3548C53, 
-0xFAC535472CFDA72E, 0xA9A4021DBB9FB0DC, 0xDFFF674C2B7E1952, 0x164BEC23A976, 
-0x5E916E65516CF3D7, 0xD3D3E076D93E31A0, 0xC0FB2E09ACEFC1CB, 0x29670618CFFA5E60, 
-0x30C3BE65ADA927BD, 0x79D51B6E35975B72, 0x862918C63C343109, 0xDE6878B4B92417C4, 
-0x7C6B7DAD5B0EFF10, 0xE6075B7E38991154, 0xB12E3CC3DB14EEFB, 0x38D57A597570, 
-0x8E01C3FFB0BF3029, 0x5A02B88E7C8C3D1A, 0x96EEBBE3945F434E, 0x7F4BB68515C839AF, 
-0xB58D0DDF9C33D21B, 0xE5DFAE7ABCA8A25, 0x3ACB3F4120DDB6F6, 0x93E1D4FC50C237A0, 
-0x7CA0D3304AF882D4, 0x4C5DAFE8F1C1843D, 0x4961DA5E733F5B7, 0xA6ED7D11EE4, 
-0x2DCC9B692E0F8BB4, 0xF852FE78B8DB0EC8, 0xF21F6093254CA0CF, 0x184CBC26C632CC6C, 
-0x7608C72296756257, 0x2D46515A8AA439F3, 0xF476CD4CEDCD7573, 0xBB162A4B41D83BB4, 
-0x44AB8622760E25B4, 0xCD0452B2D27BF86C, 0x3508FF72A62147D7, 0x388785FE99CF, 
-0x48BEE9CE80E5E445, 0x6E65F46A13C42DF6, 0xBCA31E631D6BFFB0, 0x14147B232C19B01A, 
-0x14ADA3E6F43982A5, 0xB9DAAD489DE31BC5, 0x78C415B045D86A2B, 0x9B3629ED0F1A6183, 
-0x4420919999086B4, 0x949AA07B0FBA4F4B, 0xB9BB79C7E0B568D4, 0x177EAA06451D, 
-0x74BE4D72B0A5085E, 0xB1CADB8AACC6D2A6, 0x36E1C0D12CB91F93, 0x580B47DD67F37C43, 
-0xC97CD3B1215A6A13, 0x2CE3B9BEEE01D702, 0xAA4D8D29A2192361, 0xE5FB2097FA91C494, 
-0x37771DA82958193A, 0xA7BEBD5E69CA581E, 0x65589A3199231114, 0x4DB2F7997F8, 
-0x6C20AAFB1CF29A16, 0x110A692345C286B0, 0xCA59124E45ECEB0, 0x99EA5FB1D6AC45CE, 
-0x61AC19F25E6C05CF, 0x525B7689A2466860, 0x812E45237BA687C0, 0xD1A20198D3EA4A71, 
-0xB04978656E2A6FD8, 0xF69487463A69551D, 0xF4CFE1E37FD9A095, 0xBFA1346512F, 
-0xA0416950EF0513F7, 0x942954F8CE785DDA, 0x6CA1F15B12172F78, 0x9EE14E61B0D52DA, 
-0x5346D5655167B136, 0x20AF2A0CC4CA2324, 0x9D51EA8ACCBAD693, 0x86C5ECCD57FA4453, 
-0x1F59DF8C94731AE5, 0xFCC71E6D750DE886, 0x1068FA2CA8C6F91F, 0x2B5A5EE85C68, 
-0xB2A076A932AF2783, 0xB5A7E78B04425D65, 0xDE51072AE6115EA9, 0xB35D777AB363B870, 
-0xFEB1AD18D3F1EF7E, 0x423DAD72E71FED57, 0x7C8580BC754E2D35, 0xBF66910CBC6095F4, 
-0x97BC225F1B00DCE2, 0xE6B5C0BBCE7BF9F1, 0x3F7EA9BA6C73324B, 0x6D43CD207809, 
-0x7946EB9F4062F9AB, 0xE9C15559C8D7BEBD, 0x793A468AB80211B5, 0x55F05AF8222D907D, 
-0x268B6E7D76387662, 0x33BC7ED013A36939, 0x473EF964B81B2548, 0x76D7FD5202CDF634, 
-0xFB8EC19E942D4AAD, 0x813DE4431DE15A72, 0x75B371AE2D0700BE, 0x2ECACF5E5F82, 
-0x36D4BA09AAA391B, 0xDE848C711D9326C8, 0x246693DE8BA774A7, 0xBD96B0220F96139D, 
-0xF6CABD12FBDEAE81, 0xF44435B627330DB2, 0xB7F12553BF24C51E, 0xFE34821D834E6C64, 
-0x177BD6FA61052E84, 0xC256767A0C415515, 0x3E25C4493678B162, 0x69C1565EB931, 
-0x8A18EDC29CFD9BD4, 0x982106908C5E9ED0, 0x5C7377F301B107F9, 0x4F0300050661FFF, 
-0x3A68AE405766D1A0, 0xBCA6557EF998F3A0, 0x3F251F23B9B6BCED, 0xFB50A336C4018AD8, 
-0x675B3AC8ADF50A1E, 0xD6FCF9DA14725005, 0xD59C9FF32C3DD77E, 0x2C3FAA960E47, 
-0xFC2BA56DCC75E73B, 0x13B422F2C898344A, 0xFA5E1EC24E3BA640, 0x6E18A29905253583, 
-0x14D1AB254FCDF92C, 0x5FEE7981BFCCFA8, 0x3D559F7AA6B03D8D, 0xDF040540E5A8D7F0, 
-0xB17C8A0AE6BD246D, 0x3C548E2EFD3FBD9C, 0x83011A7FB906506E, 0x2659FFEDBA30, 
-0x8E144114093E41D7, 0x8C26FF9D35D172F2, 0x5E77D7E77AF70A40, 0x262D3915668C224C, 
-0xF7764758830AD25A, 0x3F04CF5052BEBA5, 0x134CEA07C2BFBF36, 0x71B8B6DD3AF177F1, 
-0xC8237EF536ECCBE, 0x634C4799281958B6, 0x909191CA8BA7D5FF, 0x1D2160063247, 
-0xF289139D97F2CA55, 0xC468723D047DE380, 0xC5F553AFBF098D41, 0x40AE045FFD53EF6C, 
-0xB97C9AF89ED3BADB, 0x43E94D723E5D6CF0, 0x42F6F2570B169BBC, 0xFC60F1EB320F95A7, 
-0x8C05E595D032362D, 0xEB1A5693BFDE82B, 0xF27C790F57F0EE52, 0x31AA5C7206AF, 
-0x3C552497B10E0234, 0x5F197DE104AC1F0D, 0x7B49E43C591B9A38, 0x18595DCF723445A3, 
-0xAFBB416389C36758, 0x2790FBCCC6670D9C, 0x2E44243FF101BD48, 0x2BA4C542556A7F75, 
-0x323889686358EBC, 0xD81EFD01D941D5C1, 0x2C98FAB0E7ABDE24, 0x349C7DF25D32, 
-0x761A19D94E8F5324, 0x202E3A0C0C8BA9BB, 0x99A49B9EA564BD32, 0x89A7A28E6CF10309, 
-0xC5BA93FA2C0219C8, 0xF8B84C7E71DA31C0, 0xF4809D3222230AC4, 0x150D7D48B7191C2A, 
-0x71F69B81A8BFF0BE, 0xE9D18AB32744E22E, 0x2137AA40E5E80621, 0x215C2D17973C, 
-0x417B9112972BE095, 0x41C64C40FBADE58, 0xA834D152BA35E547, 0x845E1121C3073D48, 
-0x183DBCCC4B0BAD44, 0xDC6DFCF28A7FC784, 0x3E0A7966061F645E, 0x670FE11F49E477CC, 
-0xFD6CD04AEB02FA64, 0x96207938B86BC59, 0x641A9D81DE6CE858, 0x2ED32476943E, 
-0xB8B0AB2B2F56BE7F, 0x49BEF5FBC2932BC2, 0x6F23ABFA841E7CD6, 0x2F91A5C73B11916C, 
-0x198D8F1D48B9D132, 0x19E693A57B491B6A, 0x2B491197283CC4FD, 0xD9E5737F4869536D, 
-0xC5979D17C3FCF8D4, 0x82F438C3F376B05B, 0xE10D0BAFE7CE1219, 0x2FB2E1D39E92, 
-0x1165B07C6321C403, 0x23157EFC1C2D6B4E, 0x55C4AAD84A2B61F9, 0xD22B0F3F97757B21, 
-0x279E844ED1A98A42, 0x9B517921046E7076, 0xAC700B00FC098126, 0x727351759624A1A5, 
-0x51088F2FA0799FBB, 0xAF430207A167194A, 0x105949B44609D9A6, 0x50AB2310B20E, 
-0x89A1F6BA3BBBADD8, 0x58F89782B19466CE, 0xDD04DB92B65E9F62, 0x8DE28C712ECF20C8, 
-0x242D5AEBDB8458D0, 0x4CD5400E4A31B439, 0xD12B0B241230DDF2, 0xBC0209F225D10EA1, 
-0xA9D78B304D0DDFFA, 0xB87CB44AAB2456D5, 0x409B3943584EED60, 0x6E15698DAFC8, 
-0x79D02D3DF77145C1, 0x85CCC781C1FD54B1, 0x4B49BF5BC97BD7F0, 0x8291D0D88815EEB3, 
-0x8C14C12E83602E2F, 0x7E4197CCFE79C339, 0xF3181CD21F4C4AC3, 0x941348AD2DA641F0, 
-0xE72B77C7D169F473, 0x1E57DC046F9123ED, 0x70F0075DF04279B8, 0x6B81D99C4099, 
-0xB28AD173465EAB84, 0x4E40EE5D3C550D0A, 0x64F67954651EAFB6, 0xE0859EA4D5275F13, 
-0x5478347622F80FB, 0x3D264C71BE80DA59, 0x983C73D9603723B5, 0x1CA95D69B5E7D9D7, 
-0xFC160D9901EC099D, 0x14E28621EA1DC508, 0xBAF3BDD2D565BB0E, 0x13047C35F5CA, 
-0x88E4119D72D68434, 0x34B708BF9538138B, 0xA657AD07FA99058E, 0x71334F6D891F94B9, 
-0xFFFD472F8B61B3A2, 0x51D33AD04C8B488C, 0x4F40117A33415D70, 0x89D5CE458F72A399, 
-0xA6B89083A97714CF, 0x98F96F88157CDED2, 0x6AEBBB7D961E7F48, 0xEF8584A1C54, 
-0x695CE348F3064F0A, 0xDE25879CB5A3D32B, 0x6186944B8D7B526A, 0x1EEA22D3DBD8D99A, 
-0xEAE4F44C7206E13D, 0xF7A60B8C2B9661D6, 0xF5FC5CC113EF318D, 0xB26A630490403761, 
-0x96E8DE4258F3B38F, 0x10CC74FA0D7BC0A7, 0x7EA5BDA9E9789162, 0x4AEE588B6A70, 
-0xB42DFBF9D1F05202, 0x55F74AB75B98AEE3, 0xE1B88C784DB2F47, 0x762E4591BAD12D54, 
-0xDB2CF5EBDAE94921, 0x1B813D00751A38C1, 0x951D9D583ECD9166, 0xF847D85BF0E67B5E, 
-0x900E05281BECA9FA, 0xF7E3F0AFDF908359, 0xDD3FF1E203A8CA01, 0x37CEEDF087EE, 
-0xDBA042D08E188FEB, 0x8C6D033CC5F048E3, 0xF3DE811CE9DF7468, 0x1BEEA53C865BAE9F, 
-0x75E072DC4060EEBB, 0x2A7E378C249A42FD, 0xCBE7BAD20F924DDC, 0xF6C8A935A3B3DE2A, 
-0x1A893AA820CC07D2, 0x23AB207D3929262C, 0x6A3B23E41E16D493, 0x438626BED98E, 
-0xA1FBED14AEEE319, 0x5FEDA50EB1DD3238, 0x508435B45CFF9FDD, 0x6A5A932A93E3BFE3, 
-0x6FADDB37CE2204E4, 0xADB72B746DD484A7, 0xDBFBC461C020F240, 0x9B27976682E9646F, 
-0xEE4A920F9ACB8653, 0xDA7BD6E98A754EF5, 0x656612859FD621C4, 0x45CFF091E62B, 
-0xA017FB55E56F91BE, 0xE8267E9DE7194BE6, 0x9A8D6B7B3662A1C8, 0x5CE1799813361E24, 
-0xF8DEE1B59A1E5D67, 0x3DE0182633D64699, 0x3063BB03FBBC4E44, 0xED85DC72C5D3ADEF, 
-0x607C1C4B3649C46C, 0xFDC18076E59C4684, 0x8CEE3C7F68426ED0, 0x3834AF75B69F, 
-0xBEF95FFC9EC57FA0, 0x64D0B44A7B6526F, 0xFC2F34DD9003347F, 0xB2F2F9D3EFF06484, 
-0x48F6B71629FAC8E7, 0xAADE1917AA960028, 0x18826BFE8306F5FA, 0x33511A75738FD882, 
-0xCB55971207B9ECD4, 0xCDC67893100CE78B, 0x9F0CB5B102FB7762, 0xE97B29A2780, 
-0x83E999A57C952BA2, 0x2F371F2FB9E29E27, 0x170618FB142E6D3B, 0xCACEFFA7F0CF81B3, 
-0xE7F9AFC364C9EA59, 0x37CA687583DD133, 0xF3991C279E058CEA, 0x7F160F97C6B9A3C6, 
-0x5598C00E2E1C9E2C, 0x321C940BC26BC44C, 0x21F2072C5154A68A, 0x17189FDEEB59, 
-0xAD26805F6F03869A, 0xD5A159B09D63F651, 0x3558C4B950DDA7E2, 0x9D8C4BB260B10779, 
-0x82624BD4C2FB10A8, 0xA3FB4D1EBE50E75A, 0x9C64DAEC0450C6E8, 0x7BF0CD71546A3058, 
-0x802F19319FC54E9F, 0x49C4E2FF06991646, 0xF71B3961F5F42678, 0x62898B9CDC, 
-0xEC22B07E84CDA07, 0xD72B2998D0EDC70D, 0xC0041F456118884E, 0xEC913D95D404CD77, 
-0x1AA91410FCA3C62D, 0xF7FE07233D216100, 0xC9F2D4057B5F4B30, 0xFE6A07ACC15D591C, 
-0x3C83E0CF38E8BC37, 0x36203050F08CC806, 0xA4ED2DAC6DD21680, 0x4323A87306DE, 
-0x26486B003EC6F2C6, 0x31572065665A6F6C, 0xC2EC3B7725E510E6, 0xE39FC683726775FB, 
-0x3DA09B379E75372A, 0x7148E0C98DC4E1EC, 0x5C7DE83D54E61E62, 0x4171AB77F4E3597A, 
-0x6F8A06A37BF1ED31, 0x7B762F95604DDD0E, 0x702EB43B21E74C05, 0x2C9CC7E1D9BF, 
-0x85583E6E44915298, 0x478E1F58E876C4E7, 0x5BC955A9C8C4589A, 0xCE592B1822BEBDB, 
-0xEDF4B9F340525929, 0x6298D7725BD2F9BF, 0x1C0C5104A2FB1617, 0x1404A70A05D0F268, 
-0xE8EDF40E3958C62C, 0xE2240857FFCB2872, 0x795BCEDE66E09A1E, 0xD9E126F408, 
-0x2965AD433733F79, 0x7A8BE3A5C719D954, 0xD5F27C4D541C72E1, 0xCD32CB35B68FEEE3, 
-0x9856DF5BC56F2E1B, 0xA1082D185E6890C1, 0xC8C2D004ADE5CC4B, 0x6017C58732450603, 
-0x53EAD4F591147D98, 0x5D5638F257B9A54A, 0x8EA1D9189A62CB1A, 0x42144003AADA, 
-0x884B4D0CC1FE1546, 0xA41C94036E366F91, 0x87506C2F28CE4C0F, 0x2449A910B4E08B7F, 
-0xD9815D2A8FBD205E, 0x2F8D5DDF7FA4E380, 0x8B92697998E8B88B, 0xB3B68723F3AC27A3, 
-0x780EA7D3C53CAB07, 0x18F79CB28D20A3B8, 0xBF4AC50E5B7DA37, 0xBB4F101D9EC, 
-0x97B89C7A1664CA1B, 0x797475AC23DC2CAC, 0x8D7DB92486E3593A, 0x68B69CE9184119EC, 
-0x6B9DCC3C64EB60F, 0x7AD0EA052A896432, 0xA357B7287EFEF91, 0x84D87593C4F4BA33, 
-0xDA8AF81ECDC0F22C, 0x1015B282142AB09A, 0x2D583AFDF1E46EE0, 0x545BD283E91B, 
-0x595042F6F4918DD1, 0x782D01225B37E935, 0x19294086878F7E0D, 0xCAD752EB467CB1BC, 
-0x2A0A89D2264D736C, 0x9360D0323439C273, 0x97CF1120E411516F, 0x63024B9D4E0F41A0, 
-0x50BFEB3BF2819AC4, 0xBC327CE998CE38D0, 0x96F2E6F098616CA5, 0x3C48973BCD0C, 
-0x2EE09118541926C3, 0x92302979E8C640DC, 0xBA072E0208EF76D3, 0xF1AC1A1857CEDDEB, 
-0x26E9DECC83D06D91, 0x989384E5F3D43913, 0x7A6B70BEFEAE5618, 0xC41EA0E05183E974, 
-0xD59B010714806AEE, 0xFD8AC101237542E5, 0xF4E26D6233A19CBE, 0x4F4676D1C8D2, 
-0x90928ACA8DA5E1F6, 0xEBB2FE46EF47D8F1, 0x67A4F0B863F658E6, 0xDC61F7299753A76B, 
-0x3997318114D1DCF, 0x5BD7E9357E8E7078, 0xDFA519016356D038, 0xDA88048A35AE8AA9, 
-0x8BA782C5EB9DEC5A, 0x24E843911146C3F0, 0x3624FECDCC0328E2, 0x65536693781B, 
-0x90D8AA82B46CDF65, 0x3DCAE555897F07A3, 0x7BF1F1DFFAF7888C, 0xED23F3A55E5B2C21, 
-0x36F592C1CCD5A4FD, 0x2B45F0C99828D56E, 0x73F4B01762854ABB, 0xF9351640ADEB6553, 
-0x484F96583385A577, 0x8B374F6C8898CB5F, 0x743C9CEF1C2529A9, 0x6C13503B4D39, 
-0xA0BD17954B9696FD, 0xAB6DB962F945B6D9, 0x198F93FBCC9A9ACE, 0x8D07D69D36F3940A, 
-0xC559ADD77C85AB30, 0xEDA84231E77E40C9, 0xF3F2FA75C2B24F90, 0xDD940DA882BE5631, 
-0xBC1E1C80D0A013B7, 0x40E8D80CBB4C036B, 0x778725E7B1789192, 0x48626F70BE26, 
-0xF9600F3B4709B3BC, 0x71D40E13B4AD492B, 0x5F63164FADD4231E, 0xB51CD98DB97E2EA9, 
-0x1E74335275F38AAC, 0xA1FD70A41CDBFF11, 0x862F90067441B72F, 0xE7194105445C6C30, 
-0x8F9EB0223009601F, 0x4ADAA1FFC19BA4A0, 0xDEB478CAD2379217, 0x344EB51F23F1, 
-0x9375C1B8D75E6E59, 0xCCCF9A86F6DDAC1C, 0x4E1078366B578BBD, 0x7EC686697CF94FCF, 
-0x1E8A4591A8CC8BF5, 0x2A7ABFE318BD1DF9, 0x1F0817D4322CD1F6, 0xC13ADB888A52359C, 
-0xA1A85933D2A8A2BD, 0xC6AB19AD927E4F69, 0x5A8AFDD68C31694F, 0x6554E6B0E5FA, 
-0xD7620A2C0B5C3F52, 0x4D3525CD94AFEEDB, 0xFB1D74D974BB1959, 0x82ADBA480D531CDB, 
-0x2E261AB777DE5FB0, 0x52BBB7B7E8807941, 0xC473E594F37A8774, 0xE40E0EC1BBF62708, 
-0xCAB0F23D85462E95, 0x112DA0012E1C6455, 0x1715E114029B0D89, 0x3D63FD2FF73E, 
-0x15030BF661B46BD4, 0xD6E9373BD1599438, 0x3B436C43B1B8D737, 0x7039ED8AE5FA0526, 
-0xABF23D841C058B6F, 0xF1DF959F3FC569AF, 0x3934F0182ABC2CF2, 0x8B58E17F457848E, 
-0x57FB755F4F30D457, 0x82E71D57918C5407, 0xFA9FB9A1AC19FCC6, 0x329476970944, 
-0xA8D67A895E2A3867, 0xAF96215FEF245E28, 0x900DC275D92C71E2, 0xFA4AF750B683AEFC, 
-0x215976442078B98, 0xA8A38FD72CC20E7C, 0x2DEDCA1F672A57A8, 0x152A8F65B6AEAD6, 
-0x714096149B836D03, 0x95BBA18D1C4A8224, 0xCED85F16631CA836, 0x9F3417381DA, 
-0x7C12369A60229C02, 0xF2F7E5ABDC98D538, 0x1487357AF922A860, 0xB8AE0D3E4FE1AEA3, 
-0x1652765FA1FB91C2, 0x773A60A276E4C6C4, 0x3620293C7320BB9A, 0x2D848C00CA7C6806, 
-0x76B0B00D07448E5, 0x1124B10FF11DC9B2, 0x9C5F6FB13674408E, 0x6E43152A9D53, 
-0x1FEBB25EC6ED09BA, 0x8DBCD5B15077DBC9, 0x281FBA843FC163DC, 0xEC2223AC39EF584D, 
-0x5F4DA36E8A2A5F33, 0x959826F9BFB6AE0F, 0x647449DB19DE830F, 0x5E6A04CFB10BD9E2, 
-0x6435A0A1DA0B47CB, 0xA00163245CD3CE00, 0x1433C3DF30A15BFC, 0x10C786030046, 
-0xD82CBE736C3AF040, 0x36BD2D01C4FCB25A, 0x77D5CB0DDA3785CC, 0xE8537164D91CB862, 
-0x14040C7728881516, 0x7A89186FBA6E58B4, 0x9B02471FBDA78B7F, 0x6ABC997111930D93, 
-0x2B6710158CC3D592, 0xD85332C202B6AB44, 0x5ED7B7E7914A0D7D, 0x6C9DA4454AE2, 
-0xCE48984A6EFDF2D, 0x669D6AA31DFF660, 0x1CC874F071DDCB6E, 0x2A307EA9327C6C2, 
-0xA889FFAEA1DDE97C, 0x3134A93713DA8328, 0x8F0577B707E4F6B2, 0xCBA06A01A5019AA7, 
-0x8BC669A7323C32A3, 0xEE77A5ADC1960680, 0x7828D3129B7E4FD9, 0xBED3FBA4341, 
-0x57B80D541F950B34, 0x5201BF0B3122FDE9, 0xAB29B0BE9BA94A28, 0xCEB8F7D80B25F4, 
-0xDF5E935D24309937, 0xBF1E02FA033143E, 0x1DF5D4583FC7AA85, 0xBBBB06CEA8755B99, 
-0x8C76585653BB3A05, 0x35FF6E5100D0AE3, 0x184479C91B4A165D, 0x2C2382CD05BB, 
-0x113926816BB0B18E, 0xCA9DD781E513D90A, 0xE3A919B926182F5D, 0xF381CE2A9F37A770, 
-0xEEEEEBDDDDA39C1B, 0xA0CD8F07371DB5DE, 0x13CAFB146B424FAE, 0x3306402C5EDBFF02, 
-0xCC2F0323EC66D82F, 0x6335DE0BFE0A3499, 0x7189BE5887B66AAF, 0x12C9D0A188E3, 
-0xA04DC45992C1FA02, 0xF8B3B69A10BFBF0B, 0x73E8184D8B692496, 0xEA9C4A52CD1F9E65, 
-0x521D40663DE66DC7, 0x17062BA3DD065750, 0x6CE63D0A0CBE2199, 0x20F7D7B7C994B92, 
-0x6E5D61549388707, 0xF413D646B32FCAA1, 0x1739A95C8CB94CE3, 0x2550C24A9877, 
-0x6ECD022DAD80ED7, 0x56DEE74DA8094D27, 0xE5431AB604269B5, 0xBFEA3106593C8E93, 
-0x9F1D7C63FEAD5189, 0x888D0CF6E498B005, 0x8CFEC646688D120A, 0xEAD61AC11DC839E4, 
-0xB49799A87F4F24C9, 0x6E38B9F8995D9F01, 0xCE69D3B5F33CD93F, 0x15228E4C44FC, 
-0x8AF768E3705ED153, 0x5FE551771AC9AF22, 0xEC094047272AA3B1, 0x39CB04E928E5A05D, 
-0xEACC752247D12B87, 0xFA58BDE05F1F79D, 0xFD00BE734001DD46, 0x3F1AD76447BEC9B8, 
-0x67623AD6093FB7AD, 0x8AD62F50570A9EBC, 0xEC18890DD49F72F5, 0x3014A87C9BC8, 
-0xAED4DDF3ACCC0009, 0xE3D159E5C5BD3E4, 0xB96883BFF4F4CE10, 0x175E848198B62F, 
-0x16EE702BB20BA25A, 0x14D8A0D203CAFD5, 0x7ADFF68CC75312FB, 0x7C84AEE1C5EA3C50, 
-0x2A2994DFBEB6B2FC, 0xB94ECC763FC86CD2, 0x82D4D4B545BF86C2, 0x6963C8E005AC, 
-0x215D7003730BAED7, 0x7E1CC1D11484F76, 0xD020D04F6D24366D, 0x5F98A983073B31E, 
-0xB547879336BC128D, 0xFEAFE4277C91E48, 0xAF44B085B394B2A6, 0xD4D260F345227540, 
-0xE373A2EA145783FA, 0xFBFA1BCAB42EAC9B, 0x985ACD99C7009B17, 0x1948FD704856, 
-0xBB16F3347C05D462, 0xC5C8940E0345F921, 0xF41E0DA149E85F8D, 0x69AF0FE3E7286D47, 
-0x592D98E39D8897E3, 0xBFEB1F214E48A553, 0x94D2D6B29CC6E3B6, 0x8C42BDF964FC3411, 
-0xBA82C05BAFFC65F9, 0x23B7F68069D48476, 0xA3548B7E94C52117, 0x13E2E4C6FDBE, 
-0x6EEA6FD0E0B728DD, 0x214BC71601C4A976, 0x1F085168B30FA7C6, 0x7FB39CB1B00822FA, 
-0xF64D00BD7E2A4196, 0xF7C92869BEBD72EF, 0x6AE1F40BE98B3621, 0x2CC4345C010E1D2B, 
-0x849D0B6403B4C363, 0x88C8C0F666C3CA58, 0x537218B7101D3FE0, 0x4F224567381, 
-0xBB8462F7DC9C5F6A, 0x633190B87F1C1ACE, 0x408E519A0D6BF6A7, 0x9F6CB426038BD3F3, 
-0x2BA38A9A05F7101C, 0xD1550BB9A8B39669, 0x8A55EBB2ACF7DC6A, 0xB963F2DA583AB0B5, 
-0x5735D16A2D8D2A16, 0x50C81543A29F343F, 0x1142414B39CE5AEB, 0xDB4455186E0, 
-0xC1149EC096E8EEF1, 0x3D6A8140674AA197, 0x6CD79098C4631510, 0x899131FA619E04DF, 
-0x38BA8F257E490E00, 0x645ADB6AF2AC98A5, 0xFF4F8A57FD4440F3, 0x4C46DC6CE7C158AE, 
-0x3CD051DE362599B7, 0xFEBE06707E64B6E0, 0xE8EE52F3FB8B483B, 0x6A4851BB9BC4, 
-0xE67D682FDE4F207B, 0x53C1D1C4AB201845, 0xEA052F1E3C878DDB, 0x1ED9CDB29105AF46, 
-0x48D2E289850BAD02, 0xA944F775D196606C, 0xA74CABF381F8EC30, 0x2918E46ED5A1DD4E, 
-0x1C23967C25A4121A, 0xA476160F382F286C, 0xAFD25332118C2B9A, 0x4C0458B3D9A4, 
-0xFB6D9CB99F4204C9, 0x854948B6D26EEACA, 0x7694C188346CCB70, 0x26EE9C1EDFE401BC, 
-0x4A10B0A1D9705645, 0x1EDCA8E43E696349, 0x34992E9507B931EE, 0x88B7D24AD7B38132, 
-0xB5CD38FB74C55BC7, 0xE607A9F40719DE96, 0x33A73278FFE67291, 0x44C6714E58A3, 
-0xA46BA9AE635EDF24, 0x634367B24627721B, 0xF82580AB6DAAA462, 0xFEB4B29168E73919, 
-0x87FF34B6612A018F, 0x193AC69CF3CFC352, 0x6D643A07F2F07933, 0xC68EC66FF33F3C5B, 
-0xCADBA33C22A6B1D5, 0xB488EA40C8168D91, 0x8514A6A3ACF0BA88, 0x4BC7608E1CB0, 
-0x7869C26F8AFB6B7B, 0x6FD23F5A494CB61D, 0xC49E7D0F5E0B6361, 0xEB19AF32D9028AAE, 
-0xDAC9C0E399C59F41, 0x3D6FF6FE5D96E84A, 0x66B983232553CBED, 0x7389084D7040F9E7, 
-0x29B88B92270D9217, 0x3C32EB2707F5FAEE, 0x69FA88E593A7BF26, 0x355993F41736, 
-0x1C6BEA92B033F0DD, 0x1119250F3AB35AAE, 0x194BAC3BCF00E7EC, 0x4479C4114CED7881, 
-0xF1B3594ACD0BF39A, 0x57F408B805F9BD1B, 0x37980EECB1BE4C0D, 0x300AC9DA098496C, 
-0x939586DEE189BD54, 0xF093EB014D089AE2, 0xFF8755711D71CD62, 0x5D883D25B0BA, 
-0x5875E7E0C97CD0BE, 0xB49D46D3AE21D3AC, 0x622FAA5CDF004FFF, 0x841FEFA9BDF40D95, 
-0xAF46A864E700C8FA, 0x4451B465FAB79D63, 0x231D89B2B8E77C6D, 0xD98E196EAF99093C, 
-0x1B966D602327E42E, 0x6F5CBCB52A3B87BF, 0x902D1F3A39DBA9E8, 0x4B5B0990FAFE, 
-0x77DC56DEF5EEAF2F, 0x1CE66B351F5A1CAF, 0xEEEC0B128AFB929B, 0x99BCC74B8A6B2A9C, 
-0x111FD07CE3138D48, 0xC3F44BE09D9E20A5, 0x9F6622D36C9232F4, 0xE34304ED4FD551EC, 
-0xFD2F5180D6A7E096, 0xCC9075EF463AE012, 0x8BF8CEA60B35696, 0x4A3880D43852, 
-0x92E8859F80BBD589, 0x7CEB237A6004F40D, 0xEE1CCD2EAF45E9C6, 0xC88F06FB06236DFF, 
-0x482196894D0A9207, 0x1A547CD1FB47FE65, 0xF163A16F8A250707, 0x56321BE7366404FD, 
-0x2E6470C7C7D96DCD, 0xD8BD01F6A884E4AC, 0xEAEAC941603A6FE2, 0x17B4F1EADE71, 
-0x28EF15895E321833, 0xA17F23AA21521419, 0x295402049DCF8B68, 0x9769EC1D0AFFECB1, 
-0xCBB9F920C37036B4, 0x1994932DD3C3010E, 0xE123B7F587991B30, 0xA636AF74AB2735AD, 
-0x44B6AB18C65FDA7D, 0xAF218A1B80172CCC, 0x6739BB06BF6ECA59, 0x1AA133B5C6AE, 
-0xB54CF2E1D0FDF11B, 0xA9B1F66031DC93AB, 0x5BFE8007E6B2A12, 0x7736325FE89608AB, 
-0xA5BD3E55ABCF5A47, 0xAF403771E570077F, 0x3C58366F697C9084, 0xDEE4E14B7ABEE704, 
-0xFA2BB6A790BF5B8A, 0x101927914086F405, 0x212C5492744FB46E, 0x1CCF4CF50E3F, 
-0x799916E44EEB9222, 0xAF2D9577C91D2DFE, 0xDEF5D2EC04FC0E52, 0xD3ABE20F97551D47, 
-0x501DAEEA69A3FFD, 0x734327A95CC621A4, 0x3F240925C7AC27A1, 0x471CEC1925CECFAB, 
-0xA43E8FCFC202ECF2, 0xAFC39C215A7B6CF9, 0x9C07F64E247D30CA, 0x9A222770231, 
-0xC6D5BBEF7AEC0FB0, 0xCB4E41075F1F1195, 0xEB3D523A42035495, 0xB73ADB9D5F45BAC3, 
-0xF879DB6181D623F8, 0x606FB143E6E09267, 0xDEC12E49DB1DB90E, 0x4B78708A87A931B, 
-0x283FACC32A2124B7, 0x8989CD064ABF2CE4, 0x27FD692DAB974AD0, 0x225214167CBB, 
-0x5414908558AFD1B0, 0x2672A225C81CA1CE, 0xC976136DD48FABDF, 0x47213C8F0EAB953E, 
-0x5B06B61E288D6306, 0x5CC4386C636CA679, 0x51C085605530FFB3, 0x6903BA3587CDD969, 
-0x96F10BFE5061A8AC, 0xE39AFBA8BD7664D8, 0x306116615BB59096, 0x67EEAEB4505B, 
-0xA3DB7D96BC090DF4, 0x4945B63DC6072FED, 0xBB05FDFF788B28AD, 0xD3944646463E00C6, 
-0x8470DB66F901A180, 0x477AFE10F8DFB3B0, 0x19D24B8BE3673AEA, 0x14AD0322F8F133F4, 
-0x929C9F14ABB6DA37, 0x2C83453CB7D02080, 0x2D7ABDC84E456F2E, 0x281E3E437A5B, 
-0x3A12FFFB2834636B, 0xE10D0030E4732B9F, 0x325D9D17DF7F7C85, 0x5874E34B5F50B34A, 
-0x68D68FBAB85492AA, 0x9FAD69EF6DAB0620, 0x79A4A7A90F5E68C2, 0x5732DBAE0EDBC3E4, 
-0xE8B94EBDE3E7AB5F, 0x749F4772C7702122, 0x3B0CF1174C97D4F6, 0x360B432786A8, 
-0x2E3218A16F5804F7, 0xD8B7EF0364F616DB, 0x8973B47B5FCB0391, 0xF0F12C75B9A4969A, 
-0x2A1A345BCBAEB3BF, 0xE38E381813DB34A9, 0x841E8F2C2D0C1836, 0xA114D0FB0984D80D, 
-0xF2F974F1E42F5BE6, 0x2A47697A14B36F57, 0xD140DF98D80A0A8E, 0x3A6D4F576221, 
-0x6A487645FFE3EAFD, 0xBF7B615E6C3E5371, 0xA9DBDAE65E2EE3AE, 0xFC50CAC65CBE8932, 
-0x3498E746E562F652, 0xD52EDFE9E2CEB026, 0xEA1436DA273D3A9E, 0x6656544AA30D0D7E, 
-0x88E3AA729C85721D, 0x3684AEA259C84F7F, 0x13EC925FD6D57019, 0x4E203C735339, 
-0x57B3FD110FF973B1, 0x46C4BA0D785AA0B5, 0xD4D7D7476707E9F8, 0xDCEBE2010C500199, 
-0xE0F28450FCF11278, 0x3A3D313CC39BA367, 0x8FAF80A933091989, 0xB274F4A7638221E6, 
-0xE97FB0B2C38D2984, 0x5E282F472F6F2344, 0x94D38B66571ECBA1, 0x1AF57E52A3C1, 
-0x1BF1E164FFA757AF, 0xF43D3D161FB67AED, 0x48B13F3A33BC7FFE, 0x70B88C424FFD941C, 
-0x721D5BDA566DD2C0, 0x4B8E4DEB5C70FEAD, 0x49909E9C1DC4FB0E, 0x5498AC90323A7E04, 
-0xED703458B41FB376, 0xD31F79FE165CFF20, 0xBE366954CD30E5AE, 0x67782A1E3356, 
-0x807C553899216CF0, 0x13896675C6D72EC6, 0xCDA5F7AF7164F516, 0xD87ED3DE8D5C63B0, 
-0x2CD8FFC8F2558EEA, 0xEC751546A83E3005, 0x10824DEBA04E911E, 0xCD9FCB86A85EF8C9, 
-0x8AA32C28E16A58AE, 0x206DCC6157DC1A77, 0xFC8AB7AA474F85C2, 0x6CE89C83C893, 
-0x1B4C655CABC58A55, 0x2CE601ED70B64B05, 0x312F060B919E3336, 0x83A7011CD8FB8EA6, 
-0x4CC6F8B637552B52, 0xE71F25164C7AEC5A, 0xB660A533B7F53CA1, 0xEC20512D602FB17E, 
-0x5B88C232CEADCD11, 0x611CDD5924D9031E, 0xC3E5AEE4B968439C, 0x2C9926E02C11, 
-0xB40C38073F6B828, 0xD5F29CC62D4F513F, 0xC9753DAF536AC7B1, 0x883389481B21102A, 
-0xD037C118D1BD4468, 0x9713410029CADC4F, 0x28894F69FB945421, 0xF0F4FB88FFA6D9FD, 
-0xEF50C038B6258DCD, 0x11E21A89E0259C72, 0x41E56DF7AF47845D, 0x4499F085DEF3, 
-0x715469AD33BD2297, 0x4FFDEF9AB9942817, 0x2AB61A8B9943D2D9, 0xA350DA6F390621D4, 
-0x4A8ACA45D8C4D64F, 0x6F88263A0C68499A, 0x135BECAC8B53868D, 0x14E587AB6CBE24E2, 
-0x9A220F7706F7F68A, 0x64B2B05716739083, 0xBAB95009C2BC73E8, 0x35B0BDAC90E8, 
-0xEC090C5A6D50D0DC, 0x1EF9154647EA53CD, 0x9F0D1DA5025FD4F2, 0x20BC59CCD1837B3C, 
-0x2A1E1BBEEB6727C, 0xEA59AF39C4ED4407, 0xED398800D51C270E, 0x4C1D12C7DA850780, 
-0xFAD329F77CAF58ED, 0x7CA71F5E95941AAF, 0xD89E16A33C063D92, 0x526A878BBE12, 
-0xCCD457C2E694FBB6, 0x85DE58B1BEB0C130, 0xBDCF27A91BF89043, 0xFE15C1604B9F68FC, 
-0xB6383283B338FACF, 0x9FCC9422A574BF5F, 0x335AFB74148C561D, 0x22A12E85D3689C9E, 
-0x4663A89402A7500F, 0x51099C5DBA8C9590, 0xAFD958CF789D23B5, 0x1BE554BF6385, 
-0x142E6A8A4BEB7AD2, 0x3A9018C94D4CA18F, 0x27635EA79C87C367, 0xE2DB0D649C21D83A, 
-0x3258E4B014472484, 0xC0C5BE00007F1475, 0xECA9A08614C6C59, 0xCA8FC5E23D422E93, 
-0x69C40142CDC46595, 0x6D64F24E19D6908F, 0x988CC92B380932C8, 0x7067BFD2BDA, 
-0x727CE6F0C0D02433, 0x7E637B78A21BE4EE, 0x51040B6B73FCBD7A, 0xE53582B02A4B88D3, 
-0xF825DF582774DDC3, 0x1063AE7755D68B0A, 0x649CC227CCB00A80, 0x6A79581DF0A12943, 
-0x3D28E9E8F1CAEDE9, 0xB878F5A25C03C105, 0x1E232525FDAC03E9, 0x10DC24535F8E, 
-0xD325FB60450781A9, 0x9C29B1869C0DA15E, 0x23FAB09C7238FD5B, 0x62EB2C0DF8C3E549, 
-0x8B74A28717247D1C, 0x6B5FCAF0F1D3B26F, 0x43AABEE3DB675F7F, 0x7074BC2B01F70718, 
-0x579DF420AE2130A9, 0x31878DB9C58B1862, 0xB9C2FE787CB039B9, 0x6551822ECD7C, 
-0xEF8219DEAFC41298, 0x23C96C3A41CD40D1, 0x37AF532A4A4BBA1A, 0x15F0E7BC90F63E9D, 
-0x7EED2D6957A9FE70, 0xD71A115F675689FE, 0x256C5AC6D076A858, 0x62608CF344FA3CF4, 
-0xFAE55F1922891C4D, 0x64C0A8CA1F6C941F, 0xA62DF6AF027F6842, 0x2203E202E4BC, 
-0x60365178B344563E, 0xFFDD7A93665F2B0E, 0x934178FE71B98374, 0xCB776626D4029192, 
-0xFD79681F65A2794A, 0x53751EDD21C0937B, 0x3AFB812552AC0632, 0x732925CBFFA7C48, 
-0x9D4DD2D888E1AF6F, 0xE1326EC8B3423AAD, 0x38C328E5A12D114E, 0x16C330E31A08, 
-0x2D73D9C84595E761, 0x57B1D77FC7AFAB86, 0x259F3F91C2F5FA27, 0x90D590FD7AD35DF, 
-0xBB362B1B226677EF, 0xA4228EC31EE5DFDB, 0x43D99268009BDB04, 0x425CED503236141D, 
-0xB4B40C57EDEB58CF, 0xA9739905472EC009, 0x175C22B8BA7EE40C, 0x55584FA78DE7, 
-0x49CAFFB30468DE0B, 0xCDB026653D66998E, 0x2FADBD800C9E5283, 0xA2C772D72B52E836, 
-0xB867EF9F2DB9FE0, 0x4AEF7AE7856EDA0D, 0x17CBB572A46A0A9F, 0xDC99FDD99085736E, 
-0x790DC9CEB4E7905A, 0x5CF7B9AC5E771E5E, 0xC64997550E0A586F, 0x139F1D6A50AB, 
-0xE3C40F0C92E2249C, 0x20AEEB14ED019F79, 0xF0FD6F26C76ECB8C, 0x5F10DC9183700EAD, 
-0xF8353E61E3BB7FED, 0x1CAB08B16F77CFEE, 0x40C09EFDC28DD136, 0x53D0D638E869CD77, 
-0xB551C314CA701A4A, 0x31945035EC8599C2, 0x38E87062AA7B44B8, 0x50A8092060C3, 
-0x72429ED87BC2BE5C, 0x4ACEE768F1A96141, 0x1B987F59B06EDE6F, 0x4678D43B081D0AE0, 
-0x44F7CA49F1D12742, 0x2A41E778428FE0AC, 0x746827ED8719634A, 0x834E9B3F918DCF4B, 
-0x2D369ED813240B82, 0x26DBB90543E7D766, 0xD6D4296E9F1804BE, 0x3F46CA97669E, 
-0x4ECF3D5F8C718589, 0x3336FE7628337E50, 0x56B1F0AE027A40AF, 0xF0274895C36B9CC6, 
-0x56399A69EAF2B4C6, 0xED06B94742F1DEE1, 0x941853C0ACD7E968, 0x9BDEEBF6DB9B622D, 
-0x3EAAFDB02D52F510, 0x7717308E20814375, 0x39C30A5ABFF8541B, 0x17A9E1766AA7, 
-0xFD44E5048789EFC6, 0xC28BBD1CAD8DCE07, 0xC771186247CE9ACD, 0x135C73E7B687A12D, 
-0x350C0246FD59E33C, 0xA53A9691D9A7EA0F, 0x6B5194FF0E043E92, 0x7346EDC591EED598, 
-0x7F86A7CAF30778D4, 0xF1C1F028D1615C44, 0xBAD55AE187E5EB0A, 0x27B280AA3CBB, 
-0x4F3C85B2088674, 0x1DFD4E920BFBD104, 0x6ECA8D3B042B7D10, 0x12B4A09B67E782C2, 
-0xCCB75DA96DBB4CC9, 0x61899AE99D0932A4, 0x652BFAA14F4E4E59, 0x2A23EC4279A7C2E5, 
-0x73159AEFF5A75CF1, 0xAD0618FCB32B18D0, 0x4DDF44986CA21B4, 0x147A279DDE3F, 
-0x91A264B3E529B1EC, 0x969F69E1A1985ACA, 0xD925160601B10B61, 0x7D56E6EF4B7EA3F6, 
-0x2C81732B0C4F73B6, 0x7AE531EF3218F893, 0x737D1C7298EB1FA6, 0xF950B6BC1C9B6764, 
-0x610775015FF27D5F, 0xBD4653B67A94A94, 0x3219A34DC7D003DD, 0x425ECCA79708, 
-0xD94A4B06FFE695A4, 0x63780B7EFECD1146, 0x988DE248F5265277, 0xB54C13765C002151, 
-0xE02FB845D657C279, 0x291EE7E1CF029750, 0xF08FC46D4EB80D93, 0xEF0BA7B907516521, 
-0x7C6CEB541AEB4E10, 0x2EEED2AE152952C3, 0xDE8D6C976FE81841, 0x37F519519464, 
-0x15D75C20B6C35F9C, 0xBC2EF8DCE6FA46A5, 0x25FC1F0434A4099A, 0x1DE4331B3A8E38DF, 
-0x638E57ABB08D425E, 0x60FADC95DFEA8711, 0x342E9592B15D119E, 0x1CF6EB8E542B9812, 
-0xBA1BF19E73895F0B, 0x5353430744AF8614, 0xDD52DF99882EB95C, 0x5490BB38718E, 
-0xEE93B3A70CD3A298, 0xDEAFBCB80E448098, 0x799655F72D1D565C, 0x260CA71FD7FFAFC1, 
-0xA8485DE5CE2C0E44, 0x90485D14B38FE72B, 0x78EF5A2A8C7A9D30, 0xFEDE0E0E6CCC4746, 
-0xECCE81383F0C9EC2, 0xFBF75C24FF3D814E, 0xB97A62B56ED6F440, 0x422FCB4F1133, 
-0x94BBB8B7B200D99E, 0xB59B32A1761A950B, 0x35E7E8410C8A7EDB, 0xD6F1B0BF160767D5, 
-0x9B1CB74F777C1F91, 0x4CD0F8861FA5E484, 0x2AFD2C5621A4E55A, 0x83CCA4098D4D8E04, 
-0x5F06207D0519D047, 0x1A1185CAB1979D1B, 0x30F3BB2D71551447, 0x5750FD6246E6, 
-0x2445F435600EAD05, 0x6CF55EB288B56C4F, 0xFDB8A596481A9E2C, 0xA586DDC9441EE14C, 
-0x5D142BDC85A4D0D7, 0x9AC61911E408D62E, 0x9652F7BDA5538B82, 0xC33D7067AF299316, 
-0xC477D2314AA80A8D, 0x710F5954B96FCD1F, 0x41F10B09054EE9A8, 0x1DC7CBD3753C, 
-0xC315CEC6905E31F6, 0xB7DF04721D359F23, 0x522E10FEAF682D24, 0x6933A1D7D61EF7D5, 
-0xBE4B46EE28B0C66B, 0xFB2612087B750E9D, 0xCD0CB4A60379DED7, 0x724F07150C7588D8, 
-0x9D2469B82688FE58, 0xF69E5D40FFB4E2E, 0x78B6100F002F3D02, 0x1583B7D49AC9, 
-0xA5ED5D0DB0400057, 0xBCAC2A5BC9C255FC, 0xC8F835F07F2DD248, 0xA67C54CA3F784C94, 
-0x60745F2C2392EDDA, 0x872415B6B77DA9D7, 0x4FC8555EAE0C956E, 0xA0E68DEAC483A74D, 
-0x48A5225E0079A345, 0x790A8E18DD0E6320, 0x9681E02A62DD5A4B, 0x19AD8B366954, 
-0x87F020207938577E, 0x4397453EE6E4A658, 0xB18149A74DA07700, 0xAFACFCA7EF5B4180, 
-0x6FF5B3D3F0E8B746, 0x796BA35F42F4A44E, 0x187E7FF6D4AA4A6A, 0x861500058E6FD543, 
-0xAF9D6EA9507B8DC2, 0xDDFF6B817FED32F2, 0x7DB59B1DEFF1A5B0, 0x125679CDD063, 
-0x7739843EEB09E3DF, 0x4E0152D32A90A30B, 0x6E6FE6CC9E9455F3, 0xC22D9D37A03150FD, 
-0x9783282474CECC4, 0xFBA8DB94E7A1D54C, 0x8C55FE4DB469D1A7, 0xF1934AA5D9C223B7, 
-0x39252A96C1DCF3BB, 0xD06698A2BCB1563B, 0xDFF051D88479DCD, 0x599D58EA618, 
-0x51E25BFBA5316E67, 0xC450A72181AF0263, 0x4BF2E3B71B09E34E, 0xC14BEFB3E043FABB, 
-0x4FF6DEA8A77014DB, 0x28314B33A20C8CC3, 0x894E75565E265F15, 0x3B6A548DA831E749, 
-0xE8812849752380C8, 0xC77FDA9AC312DB35, 0x1BA9A85D7CD30C8A, 0x5EDC39C8818B, 
-0xB0756E5B34F34434, 0x47B5A94590E340FE, 0x73E10B9145BB6548, 0x31BC7ACF42652E69, 
-0xCBB889EAB4631AAA, 0x62DCF3F43F36F316, 0x837AE2FEC6F4C11E, 0xBCB7143504471E57, 
-0x4B4AA9C35F2F1A05, 0x3505B5BB990D7553, 0x3A4EE2C750EF2DF1, 0x62F11CF5626A, 
-0xBA526502ADF91062, 0x81F4D9B7618F5112, 0x226319CB4FE82AE3, 0xC8A6DEF79EF90B9, 
-0x4B2A9AE204EF7D24, 0xE69C6CC618EF79D5, 0x654CF31ADE7D6FEA, 0x41480037CD8FC8A2, 
-0x8D61296132BA9393, 0x386CF92F059EA51A, 0xFE0EACA1E6175D98, 0x627FD7875650, 
-0x3A89BEA1EFDDEBEF, 0xDA52A11635510BAA, 0x6E29B0EDDF4A991D, 0x9BAD2A0B522AC012, 
-0x77161F56A8FD99ED, 0x4F408D4E00E754DD, 0xA6CEB4FA3253E25, 0x5B16D6A7CA06387C, 
-0xA49F510955F97CBE, 0x1D040A2D5FC24557, 0x758B8ECB46CEC482, 0x8F6F27B238C, 
-0x4AED021893859617, 0x64DC29A2DECE7B3A, 0xD1C4A17E3791712E, 0x463A08428FC47171, 
-0x2234B1299720A6DA, 0xCF5217993D67BEF6, 0x4F27A9FD553953BD, 0x3582861D527BE94D, 
-0xC19F8AD13AC49707, 0x10639A5CFB8901F4, 0xA0C3BB950C26BFAF, 0x30973A9EC9D7, 
-0xC2B01294187B98F, 0xFFBB0F28B14C7724, 0xC8AF3007615B4706, 0x2E7FD4797FD2839B, 
-0x8DE8DC0EC186686F, 0xEB5446BE44B3F5B7, 0xE0CC2E1AC2BF329A, 0xD835F98A9A5BE690, 
-0x1AF707A78992B45E, 0x66F088E8B466A008, 0x8E274456E52C90E1, 0x3E7F24C38D5C, 
-0x53CA6D7DAE6D1B24, 0xCF67DBB35F8DBFC9, 0x4418729531BF90B, 0x99D39203C90E5D1, 
-0xF79F91C2D07B788F, 0x572CC54AB3F977E2, 0x12A34B6EF68F4193, 0xD0E63E5B32060E55, 
-0xE1FD8399484D320, 0xC034FE269FC529DA, 0x784FAFB3BBAD1330, 0x4555ABC36069, 
-0x59BB01A74AC3B8A2, 0xD4D1D3B76A0F7589, 0xF5E80A8D9DC83AAB, 0xB99687AE73AF412F, 
-0xDCD3BCEB077BDDE2, 0xBD2790CB0BC1AD7, 0x502DEBB7C7E9AFFE, 0xDC40680D99A3BDA2, 
-0x3A344330E84510D4, 0xBB64CB5210B1D9A4, 0x46E8B2B1D044095A, 0x6797C7765A16, 
-0xA86731C2A170F753, 0xB3751A20A2F63CCB, 0x84626FC9C2D33F0B, 0x3C6CDF198A81BBB3, 
-0xBA1660BAB9516209, 0x52C830C31CCA1E70, 0xA24DCD78B404212C, 0x6F1A8E5FD0B60DB4, 
-0x7C1C7430EE123660, 0x343675FC3FE7C9B8, 0x83BECB8A40C5E76F, 0x6909FC41FDC1, 
-0xC6DF8953985CF176, 0xDE69D1917F9C9B2D, 0xE9D22DD431C3972, 0x8255EB4C71E1EAC7, 
-0x85B5DBDC7993B7E2, 0x69F5E79E1BBDA7A1, 0x349AF367003E3BFE, 0x4F78092DF06AF1D3, 
-0xD82C19953662E60F, 0xAF911C99CD10EBA, 0xCFE6992E5B2D3505, 0x42225D3E6F38, 
-0x1B76A347472B5611, 0x1E4D7E054BD62910, 0x8BDFF7341441FBB0, 0x47FBC7B429661F43, 
-0x769D2FAC1D26CBD2, 0xFB367E07E2DA9E9F, 0xF39537B62F434252, 0x1DCD24E1D8C824F8, 
-0x8816E27F19A85BC8, 0xBE981C4614EEEC25, 0x31A718456201C038, 0x5B4BB7F623D7, 
-0x481AC29D0D09B718, 0xCA2A172B842EBB6D, 0x5728D59FABE8DB5F, 0xA847392F3777DC45, 
-0x55534D63D7B31A91, 0xAC89591B733F7F89, 0x6BE3FE686FC7D46E, 0x4C2C7D048FA73ED4, 
-0x1F8B2F44FC481901, 0x6E834A7B50DC395F, 0xC7A1A352718D94D6, 0x516F95EEE89F, 
-0x9126C8CAEEB04845, 0xFBB8F7B3C18B27FC, 0x1F2783016C6B03BC, 0xCEFDA0000FB4B62D, 
-0x633C2AA8A287B8DC, 0x533F7E8BBE33E96A, 0x575BA412B9C8414, 0x88BEB31AB52405A9, 
-0x598B008B20313BA2, 0x48112655D01B225B, 0x80DC06FDC17CF336, 0x1D665735BAB7, 
-0xAB2B02F209C84908, 0x8E14825E966262A8, 0x673B869FD5732057, 0x7A38D058A045A6EA, 
-0x1A9016CEF25DDDA, 0xA364661D90E028EF, 0x833BA44CE53738C1, 0xF5EFB6087E87E8AB, 
-0xA2D69C78220023D1, 0xCED68908C28BCF19, 0x3430BE14E4BE7221, 0x36E9747FA991, 
-0xB964BA40D7D157D0, 0xF16582DE45AAB3BA, 0x366A583996E5CC48, 0x3CBFE9E5E4919F50, 
-0xFA2DC5E404327C36, 0x83641033BE243EE, 0x48809E3C7AD36703, 0xD4E066FAC7046832, 
-0x3CCF1B27156D8345, 0xBCF17274BC3E3510, 0xE35D53C0A20B5FB4, 0x57BA62503766, 
-0xA5471DA6C990D692, 0x6954343B668D0737, 0x2F2B632D5ABC7D4, 0x7DA3158439A68DF6, 
-0x70BBE9C91172BA1, 0x4BD36541FDF2A4C, 0x6A38857692539BD1, 0x16783957C10318D7, 
-0x56AA27EFF111F9FC, 0x7286E601555CF001, 0x8597243BD50541FA, 0x2E526BB84F0F, 
-0xBC195B2DFA696E3D, 0xDF4C392D3222DA6C, 0x666C527419A85BC, 0xF5B18F7E4536BBCE, 
-0x5F6D6D8D3060785B, 0x279B8FF7B02ACE0D, 0x1F90C800F3A0F178, 0xE925D4807B21FEA9, 
-0xBE536A4EB3E45D4E, 0x17516C7E5095155B, 0x2A3703A810861606, 0x45835EDE23FA, 
-0xB4BDFE3A45593871, 0x4E1949B462A14815, 0xB473CAABD4E35AD1, 0xB90AA3C1A6105402, 
-0x4423705369D98232, 0x45D73EFADA1D8882, 0xFE25AA923DDD11B3, 0xCA48F216AC5D8573, 
-0x71C0D8F8D73BC162, 0xE63FFC83B93892D8, 0x86E3777504947215, 0x1B4DB4846771, 
-0x8E1C687861A9C748, 0x28B44C4E876DAD38, 0x400AE6BF9A4840E3, 0xF9DE77A98E63449C, 
-0xAEBC7B3E5C129004, 0xF855323CFD18122E, 0xFD1FFEF9157A53ED, 0x8B7D58437DA42F89, 
-0x497083245E48FBE5, 0x92256A9DEC41ADD6, 0xDE3270C7CAE538B1, 0x1DB0176A742, 
-0x364B4910B992166, 0xA247666C898D9366, 0x4EEBA2170F0D0099, 0x5BA6369D2581A1C6, 
-0x61E81B91C4021E58, 0xA053B6246C50497E, 0xDBD9692C9E74FB6, 0xBFD5A55990E9D51C, 
-0x37388D4CE494BBBB, 0xAD7580ACC503AB51, 0xF103F427B133F108, 0x8F0A805A25A, 
-0x515A5DFED288C32A, 0x8D061EEE8635224A, 0x4B9F5283D985F51B, 0xF530C1852807380A, 
-0xD431CAAF84AA41F0, 0x4F4AA6D5139270F8, 0x19749273206E0962, 0x17E4DF007DF55C86, 
-0x823F2395B47A652E, 0x52CCCEEE0698E251, 0x5240A14C5C523827, 0x373FC5447F46, 
-0xADBDDCCC1884F0, 0xD4E029EA61085890, 0xE3AD3E07542D9FAE, 0x3B2D2DB263C3D92, 
-0x7583478A8E0BD839, 0xC0AFD32556BC69EC, 0x90BD3635995B1097, 0xDF9A61DCD281B410, 
-0x443EC41476539410, 0x8B75292732067CCF, 0xA4A313077FAD29B9, 0x2B4208E4BE32, 
-0x7633D03EE55CB3C0, 0x79C86A1403DB4727, 0x1CA520D9D2A48B3A, 0xD1F45C7483152A75, 
-0x20A5749FE161E20A, 0xE5D7D59E61FAB35C, 0xEA3D7C4BA7D5CE47, 0x5501955C3C7EC7DA, 
-0x930E767F3D5FBBB0, 0x1E41AC7C1D98E2FA, 0x6EA971046C4C7297, 0x6FDAE7C0D9F3, 
-0x5F187BAF56BF0C20, 0xE7D02D2B7AD0BB7, 0xA4CA2CBC907231E7, 0x3DC6140B3280CFB3, 
-0x9AD3968A7AC647D6, 0x1F80745DB1BF6409, 0xEA10B85C2CAE17C0, 0xF11F648DB36D86BB, 
-0xD00FA9DFD70AD6F9, 0xBC9AC22F1F461783, 0xCBE61F2DF4CE89A, 0x2D3052846BC0, 
-0xD9F4F9F69676E83C, 0xE193BE72DBB74F41, 0xD97889310A3110A6, 0xD0F100528DD50BDB, 
-0xBCDA7C19CC5E5992, 0x76E136A6670F4585, 0x375A5D4059176DDF, 0x42227A63267E6C34, 
-0x97BC9FD69CE4C134, 0xCE9212A3988EA601, 0x1B00C443DAB936A3, 0x6825BAAD060D, 
-0xDBAFE761892E2D9B, 0xAA50A21F76791B12, 0x21DB4D983CA31A89, 0x51665248E150A2AE, 
-0x93AEF35CA901F699, 0x51824A9120479FC0, 0xC405321AE30194A6, 0xED0C51881EFEFF17, 
-0x556BB3BEF71C0803, 0x46A9602D58DDE0AE, 0xA38A8E4793C94E72, 0xB0984375394, 
-0x56AC6EC3D8B8E9C8, 0x19A39B426FB11BB5, 0xE066F40564CCE3BC, 0xEDF623124E43AE68, 
-0xC263B30CC46D30CA, 0xDB5D8E6BD42CA5DE, 0x64C138F87CBB329F, 0x199C3EE86B1275E1, 
-0xCF4E950901A01A1, 0x5590D155315FD9D2, 0x139B25CA54EFAECC, 0x14495BB65A89, 
-0x95A856F03C4B1B47, 0x366A7BAB255FBE0B, 0x101823967A35824B, 0x28D2AEC8D033C3D, 
-0xDE9A227A16908BDB, 0xDD2088512F16EBF6, 0x5E5257772E3DAAA0, 0xAFF5D6EEBCA23CF3, 
-0xA06B171CC5797BF, 0x2E601E532D8A8417, 0xA963026A7B3813D0, 0x3EB02FF69580, 
-0xA797EBA1584DF804, 0xAA48C6FCA67609E3, 0xB4A2DD4C24BC2BC3, 0x300C267ACD365409, 
-0x71E68AB5064B122A, 0xCF22FDB99DD41E51, 0x83AEC3789908D511, 0x2961C0E4873EB473, 
-0xC4FF0B2EAA943BED, 0xF35ED414FE40A142, 0xA12C958AF3901F66, 0x6773164931EE, 
-0x40B78BCC758266AE, 0x6B3C60C59AE33846, 0x62B37D3AAD3CD1E, 0xBD6E95559D1E6F49, 
-0x15D68443B5F1B29E, 0xDCE8D48DAFC1B467, 0xF8E4584C2C38A041, 0xF15D0DCD3DA04D86, 
-0x6CAEF2F8E51B876D, 0x85E3F6574AABC0FE, 0x2ECBFBC1086CFB, 0x4E7D5BDBCE7, 
-0xF7F2D5D37CB6BCD, 0xFF8DD7D9DDF6E13C, 0x4586D41DDFFA921F, 0x408856E59A48FCFE, 
-0xE5BBAB4D4CB680A8, 0xA83221B3BE42C6CD, 0xD3124511934C0FC5, 0x2C71C2B179BF32A1, 
-0x1FF45CB9AB6BA5CC, 0x254241A2066810B6, 0x2E40DE02FC0CDEAA, 0x29989BB4320A, 
-0xBFA282A5E69A4234, 0x8DEC8285B8A7A606, 0x7F920B30811C9733, 0xB9B46CA34DECC76A, 
-0xD1C7C96665979A3, 0x20F04C85DD6781FE, 0x550F327E9D137DA7, 0x6166BC5EEC5C0DD5, 
-0x1053A0C234E4B66, 0x5999E6E8C59E2A07, 0xAD0DF9FEBC170453, 0x4342648EBC65, 
-0xA17A01E0763B7D05, 0x1C03AB1A07B06A94, 0xF18A5EA515AE19B2, 0x42C2C98A4AC14DFD, 
-0xE5481694417BBFE3, 0x9FD2BF9FBC188F8E, 0xD47ECEAFED371989, 0x5177E408167814A, 
-0x20951EBD60C83CDD, 0x996D9057EEBACF67, 0xA905A5E6B2FC10B7, 0x7BF232A7B5B, 
-0xAD3D3DF8637F9723, 0xB6A035C1C427B187, 0x4DFB281B611C52A9, 0x2160F04247AAC55D, 
-0x145BB0E8018894C7, 0x289A8105C246CF69, 0x240DF176C9D6202E, 0x177687981F2ED7D5, 
-0xAF4EDA419CB1DC1C, 0x98F8CC6F6E46F5E3, 0x4CB4365AE35C98E5, 0x359158F060CE, 
-0xED3355D9CA5F0EA4, 0xECE2A0601D239AE0, 0x870765C86BD656E8, 0xFD568736E707A764, 
-0xC71F5EAC848435C5, 0xBAA102A09FD8290A, 0xDD676E8F93ACECC7, 0xDB52084DBD59A40C, 
-0x6793CE06CC5F55A6, 0x239902BEBDCF5758, 0x2A220C163D82CF91, 0x56FB0CFC47, 
-0x3A9EA4915C2909FB, 0xFE02D9082675F1A, 0x537D29775A3CBAE7, 0xD083ED6364E96758, 
-0xD4492E2D41FDB2AC, 0xA4FEEA4BFC6280AD, 0xE3136EA94A0BBDDE, 0xC299B1BB251ED19A, 
-0xEFA29D41E53F9F31, 0x902BB97502B14E42, 0x61D7625E40296C05, 0x19638FFAE02E, 
-0xD954BA12184FC71, 0x9FF855FE4DC00D39, 0x18F32DBAB86EB9B0, 0x1C4C8FF0F4359FE6, 
-0xDCF41D6B4B5F7FA, 0x735015063307FCBF, 0xB8EC34FE3DE0FB4C, 0x20C308387553DC49, 
-0x5FCDD7FD73C45A58, 0x4671C385A45A76CB, 0x874EC359CBED78CD, 0xFB54CB2619, 
-0x4659CC08B86882DB, 0x7ACBDFBEFCE083F7, 0x93F0F2A383F41D18, 0xE16727213DF42F91, 
-0xBA40E172CD499A19, 0x100D38F503B10D8F, 0xCB0FEC7BDED74606, 0xDBA01EE2CF200210, 
-0x3236DBB2D94E8EA1, 0x4910379991B6A48A, 0x18C46CE8BA8DDA53, 0x6F488AEE4E77, 
-0x9001C2A9864F441A, 0x34693B33CA036070, 0xA454B94B2F90CCB1, 0xEFB5268B6B4B7A5, 
-0xCA1277D96E0F9D5B, 0xF960BC63C4D19B0B, 0x835A403D57532317, 0x5C732A9212F38E3B, 
-0x9BFA68C0E4452793, 0x138B84E24A7EF983, 0x9150D9F84BC31B8F, 0x4090E87813A6, 
-0x16C7588F867A6E8, 0x16460D20DC898EB, 0xA2D98213ECAC2E45, 0x573D8043443CE1E2, 
-0xB0A2B8680B7B49AF, 0x691A24B1060CF01E, 0x2E5BFEC77143B9BD, 0xBEBF8811A70D8A5, 
-0x317A6792AA5B2CD8, 0x78AF54520D749045, 0x76547F001E35CA99, 0x2EB7E3FA024E, 
-0xCAFC3E9CF3AE9356, 0xCED11BDE0F8CA398, 0xE6D5EF71D705BED, 0x347FE0689A104CDC, 
-0xF6EFE2D9BBD35A09, 0xD3A9CFD840A95E77, 0x3DF00133587866F8, 0x6B99E89E1157F1, 
-0xFD762B372962A726, 0x2B422E99C79AEF42, 0x114C539C5212441C, 0x310BA9FB885B, 
-0xE2A7BC0FA62A58D7, 0xF1A2F6EDE3CC4ACA, 0x116CCCFD2B5954C0, 0x37D37CFBF28DBCA1, 
-0xF2573DFD38B45EB7, 0x77C4BBBD274D9E5A, 0x35A7F21AC1064E59, 0x3C809D6AE1BEAA1B, 
-0xFBB163D604614359, 0x51447E7845BCC460, 0xCFF6F5DF2541F678, 0x421D9D53B653, 
-0x123FD2160C21A2F1, 0x2950B1CE234E5F2C, 0x316BCD54A2560AB8, 0xB65B0C0EA3AD549E, 
-0x7D3085EC755A945F, 0xACF4ED56405D1F6, 0x42F98F74F9208FD, 0x68DB0424C83D53C5, 
-0x96B3FFF49ED44585, 0x775DEF186D99C7AC, 0x25C7DE72FD7E9250, 0x3F75F2B3119, 
-0xCEB6D53625A1D92F, 0xDDF08D247FA4756C, 0x59EEA90E6D3CD2B8, 0x4F2C0A7E5625DE3C, 
-0xBBB24396633328C7, 0xEE98E36BD6CA2C68, 0x7950C15E349B7A02, 0xD18FF9417EA02439, 
-0x2B1EC4822D755DA8, 0x500FC38F1740C649, 0xFA7A096B34DA5DBF, 0x287C24F5CC6D, 
-0xB24C3D1F08FF24A2, 0x93CE12A7F7D7C38, 0xD9CD4321F7BB7828, 0x6072CD00640D615A, 
-0xE1B70EF46B5DB2FA, 0xE80172EDF4C28A77, 0xB2F6B9CA8D549CB6, 0xE2D49A4BAE1039EC, 
-0x9EFF94B2795D6612, 0xDC0B065688A64543, 0xCC8C34A14ACA2072, 0x5215430286A, 
-0x6020983DDABE43F7, 0xA5E486EB33650F0B, 0x38A2739A759C5001, 0x41150ED591E05A5A, 
-0x856E71426BC14756, 0x4635BB0EA0FF9641, 0xCAFA824B0483D009, 0xDD876EB084AD517E, 
-0x7A1CDD3491A58F22, 0x5304967AA12C9A44, 0xA4479DAFE3D551DC, 0x555E31ADD319, 
-0x8B1E2299106FE12A, 0xB45076E3394E7649, 0x92266DDABB08CDD1, 0x768E0FED2B12FD56, 
-0x8C5EEF5D0A927B4D, 0xFE045FB84C8CD327, 0x2E98A42D9B89D9CF, 0xF38C6E0E7E500429, 
-0x4177B556F36692C3, 0x59D4FBA659A5C7D6, 0x2309EC0B708FD2E2, 0x1A5864FDE105, 
-0xE1E9B312464D39B0, 0x59B64FD1CD2C05E3, 0xF1087BF8C1DD071C, 0x5564EFD79D124BA4, 
-0x6BA9980205202904, 0x764BE16294D25C62, 0xA872F55E121DBB11, 0x460DF9C96570BFE9, 
-0x635BA86CE62E9C11, 0xC164CDB65F3455BF, 0x671901684954225B, 0x1D16180FE698, 
-0xDD3DE7A8FFE409D1, 0xFF34A1A8BE967D2B, 0x15F7198028F00E81, 0x5B0CFDD32D433D32, 
-0xFB856AE6D08BEB6, 0x2C196A49462AF167, 0x12F4B41A4AAA1224, 0x707DF889BC5DCE34, 
-0x8F4A442945FC26CA, 0x2AE84F329E696B53, 0xF6830ACBCF2CC085, 0x33A1DB7DF8FC, 
-0x6B220BB7769DECCC, 0x305543A4E76CC1E9, 0xB98B097D3335739F, 0xA26A19153017089, 
-0x9C350286E774319A, 0xF087F08B12653722, 0x8DAE70A3E2D229D1, 0xA6FE6A1BD3A10132, 
-0x178B727C559FA5E4, 0xC83213F428940428, 0xC84E39E194043273, 0x452C12EA3136, 
-0x6418957DBD7636CB, 0x111C874C8CEE2538, 0x65101AB159157154, 0xD8AE2CA86313F352, 
-0xC2958FF66BE6A402, 0xA0AAD504E33EDCF3, 0x57EB502D4C628502, 0xD7A221896FC25124, 
-0x3C6F026E3EAC140E, 0xB061E10A1F768FA, 0xEB548ED184113B7D, 0x5617C2458056, 
-0xE341744F732D15E4, 0xC5AD9AF5500247A6, 0xDCB02FC0CA3433C, 0x8F06A7EF19BC3E2F, 
-0x8DFCB7441FEE64CE, 0xA27C5A064947A4EE, 0xAD7048718A86EC1C, 0xDC9F699A867F2BD1, 
-0x27ABA3DEED089859, 0x4E9C7DBABB305F0E, 0x16BC934758371A43, 0x4FAC2A6FD2EB, 
-0x84D46910B67B95C0, 0xB6BE7049BD9B9433, 0x25F488710C22363D, 0xB54B4FECBF30CD37, 
-0xCF52CB40639A660E, 0x7FB19A9EFDDF4E44, 0x4CF104CA2BC1A0F2, 0xBB18AFCD858D251A, 
-0xE6FD703519123C6A, 0x5B11EA16496CD95A, 0x1F1FA54B3F07E615, 0x376433CEEE06, 
-0xA14F413E8C0A4DEE, 0x3AC364E600ADE23A, 0xE3AE6CA2FD11803D, 0xE6FB1912ACF9D942, 
-0xC32769AAB498F6CF, 0xFE2B829D95E6515B, 0x76EDF6246F4BB94C, 0xB25F5C239F3EC767, 
-0xC7FEC45735460F98, 0xA11FD003B6AD6C56, 0x670922D79FB9B3BE, 0x45B2471B6733, 
-0x8D634D00AE828A27, 0xF2A187DDE67D1E5E, 0xD78B872851FA2B43, 0x6B1789A31294B251, 
-0xC99AB04463276186, 0x5BBEAB78E8B8070, 0x164BFC0FBF4FDFCA, 0x2ECA40F81BF13F67, 
-0x3C26FB62952840CB, 0x80060BC4FB6C0F5F, 0x568D7AB4BBA7B29D, 0x40FB13F251CB, 
-0x397CDEFEED2E0382, 0xF20F480DABA0EB08, 0x5D97CE6AF52B2BAA, 0xEFD0F033782F1C8E, 
-0x5AFB61C6DB59DFE3, 0x3C5F217C90CC3BA2, 0x2B28F3D7D6A32794, 0xCE8B67CFD8BDFFEC, 
-0x45EC6E0BCF1AEB84, 0x9AC48E65FCDBCEB1, 0x86F7B308BA51BC09, 0x5D84FF6E5654, 
-0xDD72B006D9D453B6, 0x8DDAA4C61455AEEA, 0xAD8CE48809026D77, 0x325254D810F6C133, 
-0x2F1AB385CC4A8BE8, 0xF2A94F5D6C5CB13B, 0x9B64F91B1557C6CE, 0x7318BB100777EBB1, 
-0x5DC96C209BEE3153, 0x4D541D7CB48E6618, 0x6D0A10A3DC130BDC, 0x5AC7923F1E17, 
-0x5504675730EDF1BA, 0xBE3D1D998F3DE93E, 0xFE5BD953D2CC3093, 0x5A6A65B4EF895F4C, 
-0x4AA1B39AD1259E29, 0x26F240492B77DC9C, 0xED1E54EABBF5872F, 0x8D340B54AA4F3CDB, 
-0xBC044290B60D4321, 0x5099CF1385EA34B, 0xC2EACDCB286C0237, 0xB001A177453, 
-0x1DCB6288F21F65F3, 0xB5291FA6C93BF6C5, 0x7FD5B5FD77B1244, 0x358C596E828F9DC1, 
-0x1B38172264668C6E, 0x74E1AA88064291B7, 0xD59DE106C2474530, 0x58AEC386C936AC71, 
-0x2F1A81937823D243, 0x59EBF87868361764, 0xDD9EF5F204B2CE0D, 0x247AFADB4088, 
-0xF302B3FE43586ECD, 0x9DA97FDFDC8453F3, 0x4215C2408E03F93B, 0x3C3D719342167017, 
-0xBBC9A07D766120B6, 0xA95193AA8FF2C30A, 0x4B6B7F6CB32FC029, 0xB83C7061C227A556, 
-0x26353381DEAC4368, 0x71CB82EBDE4C3852, 0xB6CF82D50D545C72, 0x433BEBFDE1F7, 
-0xE97D98EE71D27E28, 0xC9D86E1369D14F55, 0x139D81C5E0D299E, 0x3356D1B1C23765D8, 
-0x661ED722DF4801DA, 0x3C6D7E574E26A811, 0xE884E03877CE6338, 0x5E59E6E2CC491EB0, 
-0x68F2A86E45605BD3, 0x9698DA62850F8484, 0x447716FD136B7ED3, 0x4077F851E7, 
-0x2686AA0BDFDB2DF7, 0x9CECEB942B90D122, 0xE8B24EC03A2621A2, 0xD2EBF4DC303F11A2, 
-0xA2B47402C8B566AA, 0xF1D042A66B720F4B, 0x971DF1D64B4B1D83, 0x1563BEEBB7B8A89F, 
-0x4451E9AB19C277E9, 0x90060DB8E141A75A, 0xF211C09C6E34B83F, 0x16C02AFAFB2A, 
-0xB6C237F7A996EFE0, 0x337898FA152CE0AA, 0x1461B95E042A5F94, 0x9DEAB912ADED3C89, 
-0xD09749697CDC3FFA, 0x36936082D4E5BCB6, 0x991B32BFE4CAE4A7, 0x88394DA1B2E3F12C, 
-0x1B47CF45ACDAC6B, 0xF846F65EC82DC77F, 0xB7C2B82DA13BD048, 0x6FC7AE35E302, 
-0x2BAF04BB938F8638, 0xE2B4010219590435, 0x26C738A60F0E3A1, 0xE47AC1608C137C29, 
-0x1265F7381973CB3A, 0xC39C4F22D784FCED, 0xC67EC3BBA2CC1D29, 0xC071486FF79176BD, 
-0x6B6990649FCD4140, 0x7B9D377213EE34CF, 0xF06C35FCC9A0D3BD, 0x5F7FBD2FFB95, 
-0x6C3B8504CEF2BEFF, 0x19DB986F12F798F2, 0x9F8CE53613C1209, 0xA6DDEFBD79F5E04C, 
-0x28DEAAF317E6A68D, 0xAF7A34731D81EA03, 0xB328B9494E6AAAE8, 0x5E6B8525CBB8CF14, 
-0x264632FBBB9D618D, 0xC564EC7F458F1CF4, 0x960A73BB220502A8, 0x32913DB9D127, 
-0x26E4B36673919DA5, 0x91E5EF31DF6FAEE4, 0xA14B9128D2CC4AD3, 0x8C88F003D291F308, 
-0x215B1DB158D75A89, 0x7899BD2525BBC61C, 0xA6B796F32327937B, 0x5A6A41D4628619EE, 
-0x2C0A7FCD708A7B, 0xE07FB3C1B12865E5, 0x77D467F11AA1DE68, 0x56D7D61A165A, 
-0x9DD522E1675701E7, 0xFE08721BA5CCE8C5, 0x5899093FD0FF2CD9, 0xB7519812B6C0720C, 
-0xAD69758D585212D0, 0x99BD98F83EFE8ABB, 0xABF2B6A9CCC1D875, 0x6F8E7162022EF1EB, 
-0xC2E6EEFBA39CB60D, 0x8D8CC7806A374F66, 0xB7D7D4DCE0A9DF09, 0x6BB0C64BB8C9, 
-0x1D23109298CFCCCD, 0x8B390BB759A0A595, 0xCB0714297452888B, 0xDB50D44EC5D93E86, 
-0xF110B6B697D7AFED, 0xFC591692292F892A, 0xAB1AB71B33254191, 0xDAE8909DB849DC09, 
-0xC0AFECF175371132, 0xC57C61CE11C7DA75, 0x312D24C0F7C4AE64, 0x1208A7154D95, 
-0xA3A6EE90196C8A91, 0x53F12E393B597E38, 0x39A235FCFE9A4BCB, 0xB0AAF420226F3C0C, 
-0xB77AA9C98E3C713C, 0xB7A50916C3806DE3, 0xF9E7D08CC57C67F8, 0xFD32562D5048D991, 
-0xDA6EF19F8016BA95, 0x5ABF6872FC845B0D, 0xD7B95DA1FEDD6B2, 0x4017C9E5F58E, 
-0x997D7D674A6D4D93, 0x6275B0262E1B4F10, 0x1EC0EA40296D2606, 0xCBCAE11EF00BD3EB, 
-0xB18A200BC054F69D, 0xB11EE1955C894B52, 0xB7EC1F63EF03447B, 0x43BB66C4F8C530E2, 
-0x7E9471B5E8C9BE4C, 0xDFAFBBCE98640B79, 0x45CDD09A1A2DABE6, 0x3C240C0D7E72, 
-0x913B2843CF62755B, 0x662C53F04939816D, 0xF7A0BD670FA92AE9, 0x910231AAFDB28B43, 
-0xE39E25618152F8A2, 0xB0E3A70A0E7E1F55, 0x743E34F64F73A3DA, 0x64DCF1356D26EB7C, 
-0xF4352C7E9B6182F8, 0x95C3B178C9936F5E, 0xB796D1D504C8ED14, 0x613683C0EF4D, 
-0x2D93B0A3E7E23EBF, 0x6FF943DDFD4F94C2, 0xCD665EA17A56DCD, 0x72033891EA0E9771, 
-0x9C5D63CC1834A5DA, 0xCB6CB66EABC6B0DC, 0xA48A2C6588BE0D00, 0x77ACD1D216B08F55, 
-0xB1389306FD3E4708, 0x9083B6EB78D23C9E, 0xF4EC6BFD2DA817A7, 0x7F9438DDB07, 
-0xA75B2F4A9A32F0EF, 0x3DFD7B68C2D0C444, 0x9E1780CB35EFF5FB, 0x7E4360166001D85C, 
-0xEB708046DF6B9356, 0x4F561D6CE5B9417C, 0x6755DDA073930B32, 0x627CF60AE5D05EC2, 
-0x2AF231E9F567D562, 0x6E976A89D4E73F5C, 0x8C30A3B1230C0021, 0x5A70B5B35A16, 
-0x13942187A12B11C7, 0xC1AEC8670C8A5015, 0xABA35AD059C75767, 0x53D2F83620EDBBD, 
-0x8100D77F57F5E6AD, 0x299E31D883499683, 0x4D1A265F7CD4C300, 0x39B36D19F99A5AFC, 
-0xED43011EA1C6E8CE, 0xD6E1582472795B12, 0xFD6569541C5E6659, 0x10A1769DA60A, 
-0xBD9F08FBD7D9A299, 0xBCCF6079D9CC18FF, 0xB50F07A391B23642, 0x97BAE95280C855AC, 
-0xFDD8D3416E64E0FE, 0x15E9EA90C2178C27, 0xE44948A6A406069C, 0x754982CEA788B1BC, 
-0xCBCD5074B61193B3, 0xFF48C98A06FBEB13, 0xF60B932F5A63489, 0x39A3CBC07359, 
-0x1E6879B3435AFAAC, 0x19412324F2A558F3, 0x167BDE27A295844D, 0x28C4193EF2D1639D, 
-0xDF8462C7249E8660, 0x25CB4076B2DFA482, 0x20194CF1456D02EC, 0xB36C55DE43DC9206, 
-0x25BF56FB5FDEC9, 0xA84C0F9938622D7B, 0xE2B4FCA926B5C3E7, 0x4D66F69D5B23, 
-0xC2AB0CE26F91E6A2, 0x770C67EA77543251, 0x465EC0BCF8260AB7, 0xAC23F41A5CBC515B, 
-0x2FAA8CA78EF2E28F, 0xE1F333AAC970EF1E, 0x33EBE9ECF8960EE1, 0xD402108609E498FB, 
-0x370C2C34AFFBFF32, 0x2343CEBA7E51FEA9, 0x54A4CAA737AB1041, 0x38AC546C9BFE, 
-0xF7E91D9D0172ECA1, 0x66B0A2F6B7B50ADD, 0xE3879B454844F5CA, 0x48968894E4D78AB9, 
-0x75C6BBF955280FAC, 0xED534251753C524A, 0xCB493E8E2AFB1846, 0x277F21551D88DC47, 
-0x1133F4A9458931AD, 0x326F87361CDA2B5A, 0x3A72D7648997BA0D, 0x4B0A0B1F9BCD, 
-0x2E489D1F58C060B7, 0x8AB40A75A66FE6F9, 0x7C1301B6BF5BEC5F, 0x722BB397969657F9, 
-0xEDA3A74D4798719E, 0xD30DF6A272D62953, 0x75226BCAF4BFFB09, 0xB863035C55691B2C, 
-0x38812E449FA9C07A, 0xA98BC052004D0541, 0x1AFBD7015658BA2F, 0x664EDCBC8921, 
-0x1A4542251FC41337, 0xECFC860C542F5E16, 0x821206D454AF6260, 0x2DCD8274952A44FA, 
-0xC99AFBDB2C45ACC0, 0x33CCA934946A615F, 0x40708C4201D19DC5, 0xF646B2CE5BC7C0EE, 
-0xD25A28172550F914, 0x605857E9BC62AB83, 0xB8DBB2AA562F662E, 0x526EAACFED95, 
-0x9F84B51EB02C664B, 0xCB22535249CF295B, 0x772F3F44BE61D0, 0xDFA29ECC73EE7202, 
-0xDB439E1BE3564774, 0x3866CF238A23FC98, 0x3B64539521B5A83C, 0xF1052C45569CF3AE, 
-0x1BF86B9A81946525, 0x50DF1B7B9963CC3E, 0x534250C18AFD73E7, 0x4A6AA1EA5FA6, 
-0xAF463FF35D06AF2D, 0x8FA9D469D80F7890, 0x57EE667FD8AFBD73, 0xD813EEEC00251133, 
-0x60116053A412F53B, 0xA6C60DAB6B369300, 0x12C83EB79266CB1F, 0x1B55A857BCCE716D, 
-0x9BC48A3625144FFE, 0x94905874FDBE2CFC, 0x6D0B2F2194A00994, 0x29194460BFBA, 
-0x7F537D4B3C05E1B8, 0xDE7B039637D4CB30, 0x89E218C6018A2D7C, 0xA98197216F2B96F2, 
-0xFF10D38CEA2FE38, 0x954C55EC80293AC3, 0xF90B5D87B182EF6C, 0xABC0DD34459FA117, 
-0x174C1269EF2240D1, 0x2BE2DD5158EDBAA3, 0x32FB23B9711919FC, 0x4DEEDD66DED8, 
-0x2382EBD5351BC2F5, 0x846605DD289AA61B, 0x90C31B2A15A3C4C8, 0xA6E0E7169C00704B, 
-0x4A66BA6FECFEB654, 0x9D6E436945BF2BB4, 0x9047D06248E1AC7E, 0x7FAA2F730C5DC677, 
-0xE3363F527A328BF2, 0x44E17935D696575C, 0x1FE7B13D73FEE04B, 0x6B0D582C83E7, 
-0x969F0D69E1431340, 0x9CACAFB18FBA6B6E, 0xA74D02490E5C632A, 0x2B2353555C4D3846, 
-0x89F63433D9CFF739, 0x7CB4F475566B59E7, 0x4C03366AD048D090, 0x7C3DBC8D302C113, 
-0xDEDB92E314B3BD5, 0x4BB8FD021DFAC937, 0xDE88D0ECB2C4DAA6, 0x1F1BBB495856, 
-0xA756234052631B2, 0xB5892F5B78721A26, 0x15A9ECD050575A15, 0x985CA58823AD1112, 
-0x30DFEB7F30831B6A, 0xCCDB5183DE0AA70C, 0xC8E5F5FA45EB9BF7, 0xE2F690FD5323DC38, 
-0xC74B5804A98F4DF3, 0xC5E5468F09027854, 0xAC3BE081818EE2E8, 0x2B7AB6AB8452, 
-0x4D188012FBE60126, 0xB6AAAE53FB705E52, 0x7DD02A6420D8D0EB, 0x7C141F7C1838C359, 
-0x4DF342428A3DCA4A, 0x5728186734B90D1A, 0x82C5969639598EEA, 0xACBF7377023508F2, 
-0x6E99D578EBD13CEA, 0xB0A5501F614ECC19, 0xE6F40919B8B9E965, 0xFE1DF191B73, 
-0x65F94E5236DD4B3F, 0xF314B4EB8FD34A08, 0x1E6ABF6B83072C7D, 0x2BF9BB9581231F73, 
-0xF28F19219F7D626C, 0xB0862595670B4BDE, 0x20EFFDA20FB03875, 0x71A634E70267B897, 
-0xC7B71246131EECD2, 0x37C5767F08E497A0, 0x8FFCEC921D8ACF3, 0x2D8BB48A7438, 
-0x4F71B47E1012999C, 0xEEAB1F02EF3C6ACD, 0x4BBA20872DA6ECC9, 0x4C996FCBE28C6386, 
-0x1AE71EA7935F6385, 0xDCD2DA22486DFFC2, 0x4FAE739BCDB1EC98, 0x869E48AD40B37B90, 
-0x3C5E46CE7598E179, 0x59F0314626AA788D, 0x3633CDE837EABB4F, 0x4798F031EAF5, 
-0x99E042ABF534A034, 0xCE82D857222736D1, 0x21B647825E620165, 0xDA6923877AB21730, 
-0xA090DB84752BD51E, 0x158E79561E38104, 0xEAC44B93ADB16DA6, 0xF17F1F768C5CB395, 
-0xE0D7D7D45F29399E, 0x7C4AE7EA4303507, 0xB46268CDCCF37CF5, 0x135EDC624438, 
-0x9806BD6117ABF3EF, 0x342E932A0AEEBD4D, 0x2B188A2B2A12BC, 0x5E760FECC1AE7E1C, 
-0x1F27B2D8ACF04200, 0x879BAD7A2E884F72, 0x6E5B9098F8144796, 0xEFE4862272B76885, 
-0xFB355F9B626A383A, 0x993B5B18A6EE8334, 0x71012176C0A78E2E, 0x1BCFBEF81D02, 
-0x2C48770945B4408E, 0x3FBD3B5BDA36CCDC, 0x87351377FD412410, 0xE1CBCB50F12FADD3, 
-0x1838947144317569, 0xA5610B34EC3C55DF, 0x71BFC222C5FCE948, 0x975C713F6533AD35, 
-0x472BFCC8D66C554C, 0x1F26C26B914835B8, 0x5437E82650B2C851, 0x5A00EE83D1B4, 
-0x3CFB88ACDEFD14E1, 0x21D006F89C5A2D25, 0xF2D496BBB5FDB3AD, 0x84E71D344036BF8B, 
-0x313E579BDDA168E7, 0xBD866B470C53E0C8, 0xF2306C7AA463BBF6, 0x51A15752DB33948C, 
-0x17ABAC9DAB115EC5, 0x28CDC84A6710EFFD, 0x7B0B4CF41CECE4DA, 0x8541A181C18, 
-0xAD68CDA7AA4C51DC, 0x45523C9B6E9C0B1E, 0xBF017A32E1AD1795, 0x13ECEA7B184EF4E8, 
-0xBA2F196400131A11, 0xB53AD15D7805B3F1, 0xCE1DABD54A6B348B, 0xA7AC263C4DE4F92B, 
-0x28B620C3AF7477EC, 0x8B0D0C82E9ACFFA0, 0x5B7E2A1E80DDC6FA, 0x17A1A8F892DD, 
-0x85D22DEDD41A9C8, 0x66FC44FA60106224, 0x7749CD75C478B4D0, 0xCA4CB19A0283E34C, 
-0x4D8498ED004ABB89, 0xA67B3B992009106C, 0x946AC337AA25820E, 0xCB3FD79E3C78A2C4, 
-0x9EBB59E34AB0CB7D, 0xA9C94EB1A87A8B35, 0x94D6C49930065A5A, 0x58BDC9B838F8, 
-0x6A1CA8EED5C96EDF, 0xD9DBC7AD6CCE58D8, 0x59768BE17B054DF9, 0x20647B36D6EEA36B, 
-0x74B1D8227E81A1AC, 0xC198475FAEFC9C71, 0x9F0D6984674DBAC7, 0x5E19783E5448F260, 
-0x221D354CAD423F68, 0x2357B73BD39DFF77, 0x9306514D3EEBFC36, 0x47B7A4E81103, 
-0x1C3491CC85106E1B, 0x3A3779565FB24137, 0xFFB129A7629FB72A, 0x908E335B31D9E86F, 
-0x446E53E5ED391F0A, 0xE9A2B105199BC053, 0x4D2C6FF45B3CCBF7, 0x726DC535F44967E4, 
-0x26DEF20DD5CD330D, 0x9155FFF3EF87064F, 0x6FE6FB5E8218139F, 0x299936007865, 
-0x1AF30FE9DD80779D, 0x8A1D45D83436FAB7, 0xCF55966B571F28D9, 0x4795F3EA283B44D6, 
-0x4864995CECA85E55, 0x53762FE77FF967DB, 0x30DB7AD97A831999, 0xC4673966FC664537, 
-0xBB75570C63223675, 0x28EA11B6231FBF92, 0x4788F89ED0DB6A2B, 0x549A4B71A1E9, 
-0xF8C5D1DF9716B000, 0x593D6545037152F7, 0xBFF58CD47159E93D, 0xAE743AAC7E8A0110, 
-0x8336140418682B42, 0xD5302749E08A52A2, 0xFC9D6B4BE2975F22, 0x87F6B4A262DB49A9, 
-0xBE08A4C3418DCE20, 0x5EB83418BD48DF07, 0xFBD29C000F8A7A6B, 0x686EDB63CE3D, 
-0x382C5974552E8182, 0x714C5BC45FBE902C, 0x6ACD15D271C4603A, 0x6D65A564573AC422, 
-0xA421748D06C88BE0, 0x5FA74A395E55B63C, 0x6764D513AD61ACE1, 0xB2FD71425B3A37DC, 
-0x777FEF44C086866, 0xA7BE0711A3B988B1, 0x66EF699CFE80B870, 0x328B15FA0BC7, 
-0x7D0FBE2AF06CC890, 0x9AB370CA89D409BD, 0x9CF1AF34388C683B, 0x36FEA84203A4BB7B, 
-0xEBF0D3EB85AA8110, 0x92327D1D79658B05, 0xDA3A0469EF10F511, 0xFB0EA3478A0DE328, 
-0x35853603104CDF22, 0x4BB180440B4FCF8B, 0xBAAA40F9DCA973F8, 0x493F26423948, 
-0x5EFD7B6D1CD4CE41, 0x9572661C5A796265, 0xBC3747FB28AB4367, 0x65EDAA95AE27239D, 
-0x1B6310D6E53AC109, 0x3F5BCE3FF91F709D, 0xCC6D1163D562B2DC, 0xE28977D6FDB3B51D, 
-0xC6DF57130CE11F5F, 0xA4730639BE8A166D, 0x13A576D63B06A8EF, 0x4062804327A1, 
-0xAD6FF42A660744EC, 0xD0B3EF7EEE4A0507, 0x8DD4EB5548562D37, 0x4EFD9A251431F4A6, 
-0x131B59FBD9830D74, 0xB59B8919C751D459, 0x5A696F7283E18A04, 0xC593A0CDF310DDE7, 
-0x9BDABF5A9AFFB6D1, 0x36FB75B1AC2B4633, 0x8FD7FF8998144713, 0x9ECB5E6A615, 
-0xA580A9749F99EA4B, 0x365F9DAE2E7D08E0, 0xDD814C5C723CA61C, 0xA760B51AEA4035A1, 
-0x941B8A954371C106, 0xAEE9B1178A0638FA, 0x475CA3DBA96F6E9D, 0x5D2DF088E194C80C, 
-0x38113CDB816376B2, 0x59694C869567763D, 0x372E129933330E75, 0x205EE3B563EB, 
-0x69DDDED55E4569EE, 0xF8E5716DD8B4A2C3, 0x4694FCE32C916C6B, 0x8659CEABA9EE9D41, 
-0xD3B3E1E5F89F36F7, 0xC3595C87E4A91568, 0xCEDFB6E0A771D7D7, 0x8318759D5EC38071, 
-0x9F77C2F747256944, 0xD6B2D60538307182, 0x1B442650083A46CD, 0x481C25034DDA, 
-0x9F1652E6E75C96E, 0x2DD6197DF696AC52, 0xAFF3308B21A574AC, 0xF57DFAAA123DE915, 
-0xFAE11979C0D8AC7F, 0xA05C0C7ED94847C, 0x543990457C0F31E3, 0xB2A621744D7B94CF, 
-0x8DBD9FF4142F97AB, 0x65FFF93BAF2FE3D8, 0x30BC9B6DFD10D1D6, 0x542FEB3391FD, 
-0xFD5E3225CED58D80, 0xF87A459EDE18C126, 0xF9F87BF38FD9CD9B, 0xA669B245415F7FF0, 
-0xE2196D8314DE4F68, 0xC55FCE3C6AEF8E19, 0xB844A43977734ABA, 0xC7202F627031AD3D, 
-0x2B651A1E4118F9B5, 0x3ABEABD13D273D6F, 0x5108D15BC9C0A82F, 0x525BA3C44326, 
-0x3290ACC74A3D3C26, 0xCD0B3EB60F9EC4C4, 0xD8F3F5D375012AE, 0x5440A4DC3F1A6C03, 
-0x8DE2A8B91C505FA6, 0x5DBDDB2A9265C952, 0x9FE00F2D8E49C91B, 0x957EBC7ED55A52F3, 
-0xFCD14788E06A2933, 0xADA687499447C841, 0x327095C6CEE6E4A9, 0x32EE3FC209BE, 
-0x7CC2E359870DC203, 0xA08D7FB158C32946, 0xA3FB809E28B24091, 0x3F0670EFF1BCFAC, 
-0x9960FFF20CD09BC3, 0xE10CDE688F008714, 0x9743CFE932D63D1E, 0x13F307D6D33950F4, 
-0x409C8E272428C050, 0xAAA6CA0DAA1A370C, 0x7142BBFED155569B, 0x6360402DF372, 
-0xE6E7C548377F30A8, 0x5A424A60C141FEC3, 0xC5E3B85E3840AB7, 0xA2AA8FE6D64AB53B, 
-0x62D7544A4692E08C, 0xA44E24F79880A51F, 0x4558B8071ADEB6CA, 0x761EC160CC232453, 
-0x72BF64F24181F196, 0x91CBF29E54EC1AFF, 0xC1AE82DA1AC3C841, 0x195ACEC5808F, 
-0x1AEBCB3AEF7F5573, 0x3599F9212D2262C5, 0x2D440A4628957102, 0x9DB1C9BEFF976F5F, 
-0xD4195C7FB12659FF, 0xBE084EA21E325495, 0xD2143BB7AE4D1338, 0x5F42A9FE2DB8E1D1, 
-0xE9D27575F0C0FE29, 0xBEFE0E8DD81CF11A, 0x7BC5803F94ABD7A2, 0x384EDE4975D4, 
-0xCFD2993D6FC29E3B, 0x1734BC9625AE5B5B, 0x4ED5B19F2B59535A, 0x16AD9D5D77A7DF9D, 
-0x5D5F22C63BB9940A, 0x5446D1FAE082FF15, 0xD824AE4B3EAD8D6E, 0xA1E4FA9A10BA30F, 
-0x8D8DA47DBF5BA542, 0x14656128594D7BDA, 0xFF25C8EAECF08FC8, 0xF9A16C36540, 
-0xDF689E6A4F3080EB, 0x2AF316E58A19DB80, 0x492CAD73039EF525, 0x53B9CE5265998EF, 
-0x13CBFA3D52C00E27, 0x697FD813EBC135D2, 0x9F36663DECF784FB, 0x427F46FB200B0463, 
-0xF9143487B7FFA2FC, 0x46A7E9C9CE3B5F55, 0x3D614758677104BC, 0x5BA281961436, 
-0xC4515D47F2585589, 0x2CF47A605C53019A, 0x1E0D83689B4FB8DB, 0x44C12D031C673F74, 
-0xB5D6FDDB1FD329B2, 0x8431DE405E244825, 0x963FF4090A7B4E1A, 0xB7F11DFF1BCD9E75, 
-0x36598081E3DE8769, 0x9099978C4C492B6E, 0x128F82D7B1DB63A9, 0xD84CCB7DEE4, 
-0x8CCA413187E4A6BD, 0x305657F040D5F441, 0x73283EBB660C8C8D, 0x5B910C1D0D199F94, 
-0x42347C6AC09C7A4A, 0x6D5A4AC8767DAA34, 0x691FE3835D24FDE7, 0xCAD6C3CE4A18FF1C, 
-0x1B6441B29DEBB31E, 0x4450CFF1800FB2A5, 0x251524BF61EC173C, 0x53DC26CF541E, 
-0x3D98466F28C849DE, 0x47FB3FE2B7F6858B, 0xDFC59503FA8F0C2F, 0x9BF7D53A0ED7A148, 
-0xFCFED17BBB309DEE, 0x251161E965C8F373, 0x1B4172A4E4E4645C, 0x49ABE8210C0EBBFC, 
-0x59E22299150D8817, 0x3098E78EA04D58FC, 0x3010258C38D55965, 0x311DBF2EBE8E, 
-0x60FCEB4448FC7BDB, 0xEAB0B58B192CA83F, 0xA77FD6A141A356C8, 0xB171754904E44F37, 
-0xED2A1394E30948B7, 0xA4067D126AD6BF8D, 0x5A124C35B07025CE, 0xB2DEB8453F3BBF64, 
-0xDF05B392418C4905, 0xD82BA0F2D0A4F60B, 0xC1AA9D2D0B50A8A2, 0x66D989F5C981, 
-0xD60DC0EC9F628808, 0x9B5F5A848110FC11, 0x2A3ED67713001799, 0x4347DB4256F73A0C, 
-0x630DC4E1B485C7B1, 0x6106F7D7F9DCAD87, 0xDB5BB846EB8973CE, 0x4A471074391585DF, 
-0x50D94570B6A62B97, 0x1683BFDBD7DF19B9, 0xA854196C92456CE6, 0x3A5E09D1910C, 
-0x4A34428CCD2FAD2B, 0x450C267DE2BC3EDA, 0xCB284F16FA8C101E, 0x78FD0588CA47987A, 
-0x55F54AD1482B5E95, 0x9203002029C2AB04, 0x188357B64CBBB764, 0xFCE912B6720792CF, 
-0x4F486CF27B6F12C4, 0x8409632212FB7BCC, 0x4B00F96091D9EB57, 0x4B099789FB41, 
-0xEDB4D6707EBD2685, 0xBCDDFC47E6C6F60C, 0xC73D5EE5F23B6DE9, 0xDD698A9B2A4EDCE5, 
-0xED14FD8AC63823D4, 0xF4F02CDD7DDFE6F2, 0x96F79DC8EA865D92, 0xA04C12A44DD2754, 
-0x5C64D2C0B96E990A, 0xAD3CB76ACD236D3F, 0x29D6C0A1052001CA, 0x57FB2EBB51D0, 
-0x643565DC81025F8D, 0xCEF703953DDED780, 0x7E4AD99DFF830B0D, 0x24758EEB3600B45C, 
-0xFBC5E4D48B8021BE, 0x100D5C1B634D37BA, 0xFCC1BACE904939B3, 0x4F4801AC99FE5A20, 
-0xC4CE7AFE5DA9C3BD, 0xFAA09EBCB6D698, 0xC6C87847A9F70A2F, 0x4675850FDD9E, 
-0x40E02F222B3511B, 0xE23F45CA415514D2, 0x33689BA4E0115EF6, 0xEEDBE012DDA0795D, 
-0x656D174ED052CB63, 0x8980BB7BE202AA06, 0x7CC94C02C656E816, 0xB2CA1D8169BD3E96, 
-0xBB447AE598736F78, 0x11B2590B1054DF07, 0x8451C34BDAC5FBBF, 0x39D4225EB957, 
-0xE5A8EBBD48B1FC50, 0xF0EA74BCD950E4F0, 0xBAA1F7759C89058F, 0x145B08591660743C, 
-0x118A11764AF55FE2, 0xB2997558825DB9F7, 0xFCD3BAD3C2056C4D, 0xCE2CEF88FCFABEA1, 
-0x7C25F2E925070D33, 0x764A2B21F55E51EF, 0xFD640713163DFAC3, 0x5752144DAC99, 
-0x7AE384453AFBC321, 0xD109998D28068943, 0x49111E501B70119F, 0xD185648467763907, 
-0x1AED656299EE79C2, 0x8430312D5839745, 0x9D4836F614D37F8A, 0xC9AA9DE683A41DF7, 
-0x78CB34DF5F5DE93, 0x2490BB54E9F1A6C4, 0x4797572048D58EA9, 0x9A469555A7D, 
-0x14B0065D709B206C, 0xF73CD255CE7BFD66, 0x314A96BD6D0A831F, 0x179B1454EA929A01, 
-0x401DAB63027EDB5D, 0x3D80F422A891B519, 0x1F3E47454A6995A0, 0x98C1FAB64906613D, 
-0x499C739F1AA48742, 0x8747C8507A685373, 0xB0258578F5EB8EAE, 0x19539AE06DCD, 
-0x8F12C3F4C49CFB0B, 0x7E0E47E3C68A63C4, 0xA92CF6F664DF850C, 0x3153ADBA530F7617, 
-0xFC4640634FA98E35, 0xE5EA740F21F419A, 0x6037C99EF5D44238, 0xC620D08B1C7C64D6, 
-0x97535917CEDD9605, 0x30222304748611AF, 0xD7E28D792F1E8F4, 0xC40973F92F9, 
-0xE7D6882C4CC40628, 0xFF9AA0D75507FC68, 0x24CB46E3EDB2624A, 0x526B7F3E264079FF, 
-0x1B538B11CB60541C, 0x4057EC220B00CB7E, 0xF55D37F16288D209, 0x50089867C853D704, 
-0xFE311ABF987B9A9B, 0x694DB6853226F9E4, 0x705CEC4ED9F490F6, 0x74E85DAF686, 
-0xB8B78FC2F2747CAF, 0x133BB4FEC0FE1C8E, 0xFC8E658081F4BA7F, 0x700A63A7A9F0D320, 
-0x764947CFB2678E43, 0x397B37A46923315, 0xD2DA1C1557FE7F5F, 0x8D41D88BD4902CA, 
-0x8BD5E3A001608B21, 0xCB1982442B2A74B6, 0xB8197A746BBECE81, 0xBA019D744C6, 
-0xA9E18D29DF69F956, 0xEFA5E73A879998DE, 0x3CBCEB050231C256, 0x7C1053FFA8F754FB, 
-0x308BAE6C910207EC, 0x29C9CD634FC157D7, 0x990A7CBA5C811990, 0x3EF08B7D9266DBAD, 
-0x4B59F5FC1DFD8807, 0xA8268F8F9C8B2244, 0x2FF7F5A3AAB3EF8D, 0xAF584FC7155, 
-0xE9C3EE0AFE72C3C0, 0x609DC8254A04A0EA, 0xE615E00D978E185A, 0x1EDDB3B1EC22EBE3, 
-0xEE51BF14168C8066, 0x14BED2F50FAD96FD, 0xE92D261D8528686A, 0xB9B88229D5083F9B, 
-0x11F8491737A5B1B6, 0xBD4D2284D8F2DDD6, 0x76E7076D6CB317B6, 0x10D2FB4E97AC, 
-0xA97F2DD05D824CAD, 0x795C429A4AC723DE, 0xC4E2153BCCE8F075, 0x67656E7519C70949, 
-0x340CF98F6428AD6F, 0xF05ED662CD81F73, 0x6B7B0690666B7433, 0x28314EC999930C39, 
-0x603D8BF33168B87B, 0x3AB878C3FB6ADD90, 0x91A6F29F1186930D, 0x297A4305FBEF, 
-0xE5402F61EE56C20D, 0xCB55EE5128DB8948, 0xF5CF353441F75FE7, 0x8966BC8BBD6E6766, 
-0xD75339572742A157, 0x89A0234A4DE6C735, 0x5165A679C4E7E88A, 0x4F869C234BFD1CB1, 
-0x8E632CF31AB2B675, 0x579B3BBDC8010A9A, 0x6666AD72D53450BC, 0x2275186ACA63, 
-0x51F4F45DA91702E9, 0x1B314EE578CAF5E, 0xBAF1E4CEA325A7BF, 0xBDCB84DBE0E6A2F, 
-0x93A8BB1F01A68888, 0xE0D8EEBDBC5CDB2C, 0x7725032F2E74017A, 0x20E1A25D752BDE66, 
-0x5C7016763E3AD6F6, 0xA5C26DBFDF668AC6, 0x597BEB255F4C8F0A, 0x58736984C26, 
-0x17D6E4D7739FCF17, 0xF49A689D247317CD, 0x4FD8598007481A72, 0xE66F7FE81E633246, 
-0x124A4FD639C45EB6, 0x406B6621FFBA5A18, 0xF36DB8E6B8251315, 0xCBD4AD4EEDE32B98, 
-0x1C120FE21C3EDAF3, 0xC94C0367EB4CE770, 0xCE002D8550E0CB58, 0x3E536939A8F3, 
-0xD3E3BF5E0EBABF9E, 0x665A737214D1220E, 0x4F613B78D783864D, 0xACDED7E51016454F, 
-0x82FA9FFE4C055CF9, 0xDA1F123A45487A20, 0x9D0ABFC800C13D3C, 0xAD090F650EDD363E, 
-0xBE1AD1A15C0E485E, 0x75E864391E158302, 0xD8B2B87D57B26502, 0x21D8CE733832, 
-0xCCE9B67C6CE35D3D, 0x552524ED2FCF927D, 0x61206E1F7E8A8912, 0xA1DC078F607C3D88, 
-0xEEEDD007219672F5, 0x566F962A1E3DAC7D, 0x87C9423B3806E5B0, 0xF57C23D6394D1283, 
-0x9E05A941CA7168E, 0x91CB27CCFCEFAEC4, 0xF6048D58BA7F17DD, 0x6904A4481C7E, 
-0x6563E5B6A79DE4CB, 0xF4004B8A5737317, 0xDB417C14EB7D470E, 0xA08F89A039FF54C6, 
-0x3B897E4842C699BF, 0x95880749A787D1FC, 0x1BEDE0F4C64E876, 0x3C0F5D0F01E55B7F, 
-0x2021967C06BA1A48, 0xA09D5E15903FD31D, 0x271B0DA6D5323376, 0x4744F0D8F836, 
-0xF59F3CF8E3CF0905, 0x33E3CD86965AFAF7, 0x6863FC4021A5CDFE, 0xBD7A89ABD09E53DE, 
-0xD560B086CE03AEB1, 0x805F90CC1C3D77B9, 0x9F8D7BDDB80FFC3E, 0x3A2798ABDE979135, 
-0xEBD9C0F735F07EEA, 0x90FB558B35C5F482, 0x7D8FD3BAC6E97FCA, 0x36BA668454E0, 
-0x13DA8622A90CCEB3, 0xBFD941DB9F812A40, 0x537810CA50C3D5A8, 0x9B8E6F83804C505, 
-0x1D841CF2FD7347, 0xFC3FA238C5FB321A, 0xBE9505C154838103, 0x57AE7EDAB80EC89F, 
-0x1DF90488C52B032D, 0x5014A77076C1FB48, 0xA170B14F9AC1BB4, 0x5229E6D30B7E, 
-0x4D32BFC0FB419A34, 0x6B436254596131A4, 0x31C8F2FA79E61A7D, 0x9522C1BDFA31E3C, 
-0xD184D94B031DA0EA, 0xDCB7E48AA9518652, 0x9F4FBFE1C61A81F6, 0x562BE40B267AC4DC, 
-0x8EADEB472BAF0B58, 0x8FB183DA4EAD1249, 0x238D8989499782B, 0x1EC1931EF083, 
-0x89D6D0468342D232, 0x944C20D3B4E56999, 0x9C0F0133823E70CA, 0xCB33545F4C75640F, 
-0x47E0EAF49DEF4C39, 0xCF96A06B75A5CC69, 0xBFB6FD5299EE7A10, 0xA50380067A449D0, 
-0xAF4AD0887CD06F64, 0x5834126BF0F26F61, 0xB5C3451727362269, 0x3332DB9BCC97, 
-0x563CCE101804170B, 0x59D935E595BDEE33, 0x54C9A0DB805D7B61, 0xE83CD41DDFEBE1EF, 
-0xAC2E94ECEFD84D04, 0x42DFE80B79FCD560, 0x18AA509F57226D1E, 0x9A2D07167AF4FD1A, 
-0x33EAA4965BDDF9D9, 0x21AAA829DB398F96, 0xE137F5C0F0F43179, 0x22DF4A7767FA, 
-0xB5E75F8C20A2592C, 0x2834989C3BE837E5, 0x4F28C134C988C83F, 0xD5ACEE663E3CDB5C, 
-0x61291BE21B5E29FD, 0xAF63DB965C0282BC, 0x237221EDC68BF954, 0xC7B4A3AEA0A2120F, 
-0xEE8DCC0482CB45EA, 0xD6807B6BAFFBEA10, 0xCBA5FA7DA28A67C6, 0x217EA611AB1, 
-0x3902FDE65619B8D7, 0x6DC8F4C0504AD64E, 0xF9BFF576114D6C5C, 0x3C49A35E13C36B39, 
-0xBAA51D60E7B67734, 0xA21ED388B55AC1B3, 0x9CEDAE4111D59E69, 0x2A801BD105C9F7B8, 
-0xE2504E7E6F019183, 0xF64DDD420DEFDE01, 0x8CC3C2C756662A97, 0x5F41C5C05349, 
-0x8D5B4BABF771EF36, 0xCE4B23C8695A3ADA, 0xBDB13363FEB528C7, 0x353361C709E4D874, 
-0x8E51144D402AD769, 0xF6496C9A4BDA8E53, 0x3D323EC2F0C0DD36, 0x895F1DDC3591DEC7, 
-0x8CA191204B8F2A99, 0x30826E8E4A11EFDB, 0x81E66C92FB1C08F, 0x13CC6D45CCD4, 
-0x77E7D08195FFE91, 0xAF99B28B39F19603, 0xFBC097040059ADC0, 0xD89721773DF92772, 
-0xB97E2B7F4AD239F0, 0x4C414D7C5CF8AF0A, 0x19E736551839407, 0x2645D547140E8E1C, 
-0x612041BE644B3205, 0xFA737F66A7F07B77, 0xD5B11E5A4EB18342, 0x16BED2449CEE, 
-0xBC0C79DC630B6C59, 0xDAFE922E88D1FA03, 0x2E880295183F6256, 0x765B9CC6378CBECF, 
-0xE25832BBE5BCF5F1, 0x5BB5370FE6006FF1, 0x590389DA90A5E112, 0xA2057ACEFEEF68BE, 
-0xF7E0B620A0CA2117, 0x4D8A66432C848FC8, 0xB99AE34D5405281C, 0x45EB42DB87D7, 
-0x48F771CF0FC515E8, 0xBBFDD5C5245680BD, 0xD2E251496EC65152, 0xF58244E625BC8C64, 
-0x7F301254E02DBE65, 0xAC3EF428C666743E, 0x28B3A0ED2BBF82CE, 0x500B4313FADCCCC7, 
-0x5BBD3A234C6A9B17, 0x73E8E2A27984FCBA, 0x48F5CFD26C394EA4, 0x1A0C9A8457F8, 
-0x33348353F4A2BD24, 0xEC5EFC25B54B326, 0x7FC668D9F0B852C9, 0x81D39FE1DB2257D9, 
-0x8E62ACD6420A5C2B, 0xB8A752C0C4C02A4E, 0x3D5E6531ED443FAC, 0xD145276C817DF6A3, 
-0x639FE44E0D136E63, 0xEAF1F3EBA4F770A6, 0x443A6EAFC41A76CA, 0x52FA30E5C6B2, 
-0x7DB5A3E6A3692CB, 0xA5544AAF90611E1C, 0x49CD04A086567A2, 0xA9460985B3E4EE0F, 
-0x173807480EF9539C, 0x490BFB6250C15569, 0xFA04928179B47DEC, 0xE7539ED3E90F158D, 
-0x1FFF9BF0E7A196FE, 0xC7A484B1A71BCB3F, 0xBD9FC93FEA0B2706, 0x36310D7139DF, 
-0xC3CA204A4B94DBDF, 0x247BE92FBDEA311, 0xDC0F0E058A7DF232, 0xA53FF227CB669A58, 
-0xD461ED920FD0F6CF, 0xEA8EF1B6C4C60944, 0xC2FAA503DE6DE379, 0xBD3D85414FAFCA2C, 
-0x547D88301AB2A6F4, 0x4897DEEBAC29A8EE, 0xC60CC189E53C8CC0, 0x6E2860B7707E, 
-0x654E9846AFC25E9A, 0x4A6C432422955BFF, 0xD479E57E806F9B0F, 0x1EACD5D1A40DC6F0, 
-0x70FD51940A72BB3D, 0x2B499D5DA9816A74, 0x63ED68212A582278, 0x9D4B642D67609ECF, 
-0xABF524D84CE99BC8, 0x63AE535EB130B68E, 0x65E0253DC3A85458, 0x6D47B642A56E, 
-0xC148AA51E055872D, 0x8E324779D168CB32, 0x891E7AAFBD89EB9, 0xC3E1643D34637450, 
-0x5B5273147B55B0A9, 0x62634F4A463054BF, 0xB69903B5848C2A2B, 0x9F6835277A93746F, 
-0xD4A57101565060CC, 0x5094121E7DA475F0, 0xA2B17E38720483E9, 0x6633D1D9E422, 
-0x2C3AFD6A626BFF3B, 0xEBB37E2E90DCC6E3, 0x290A635C48DFC0, 0xDF782D3BE2215C59, 
-0xD9A7581D83897148, 0x5CD75ECFAC32FD4B, 0xFC0FF366696F1A4C, 0xA338F112E6DB6B0A, 
-0x41C619904A1E03D8, 0xD11741151EC068FF, 0x203F87AF5A6D83F5, 0x54D4D78EF693, 
-0xDAA80E5946D290FB, 0xDE9C468FBFE9C640, 0x4F559021BD23FB51, 0x24D5600AD58D0C25, 
-0x1DF90AE480489E42, 0xFF6251166692978C, 0xE0EA3360C57F5709, 0xDE8B69EDB05B1B93, 
-0xFC70ECF9E211EE21, 0xEE02D7938525232F, 0xE622144C11C3D092, 0x3B0932F76379, 
-0x9BDF866D1147823B, 0x104D74DA09064739, 0x5B94D16FD75726B9, 0x6C343944F80E8E19, 
-0x758E60EDCF612E30, 0x837DE24F34AB3C31, 0x680BF134F7C6164E, 0x89BC2F951349F1B2, 
-0xCC438F34E9B0C6F0, 0x236730025E17A5E8, 0x669FA5603276CA90, 0x14B3BFD5492A, 
-0xF87760364D3E22B6, 0xCF83C285E6752BB4, 0xDC87C4B39FBBE9B1, 0x2ED1CED5E33E0243, 
-0x434C81D3A3D8A287, 0xB98369664933A519, 0x77E6490F5A9E83DE, 0xB37D59DED37F4567, 
-0xE0089A234E212CED, 0xD6F66911726BFA14, 0xF3521D0AACE36C1C, 0x5E11BCA91494, 
-0xB5A5B96B4D50BEAF, 0x30F8583B1D425025, 0x69E0DFE39938F0BC, 0xCCA27FBCECF0CED3, 
-0xC1AD89123AFCFCE6, 0x9C78C6AC544F0BC1, 0x5E24F1B8AC9ECFAF, 0xA6105380F684EA70, 
-0x6AEF590A84354364, 0x777EA6DDD519D373, 0x80A976D133253645, 0xA980C30AC03, 
-0xE713DA860A6C9175, 0x1CA7DAC141BD05A9, 0x91FAA9E95898D639, 0x856B4E2957E91474, 
-0x31A857939E84D300, 0xC95ABB1C66751A15, 0xEC6433F7D3077F2A, 0xB80846FD1E347D0D, 
-0x452A57EEA40938F9, 0x80F5200815EBC71B, 0xB7352EA0187C2767, 0x5B2179724725, 
-0xA42B14F2CCFD7353, 0x938429792DAEEB1F, 0x18A1E4FE05346B24, 0x2949888B18A67FC4, 
-0x129F39451EAD6158, 0xF1FB8B67684516A4, 0xF46838270512AB54, 0x29A1238626856648, 
-0xF52E093367AD6A9, 0x9145DCC843E9805F, 0x502F51925D667B5A, 0x16027E348AC3, 
-0x56029B7F24B6F996, 0xDCA93CF3C9A7E23B, 0x4E795C2EACC539E6, 0x2E91272018C5A9A0, 
-0x479DCCECA9CE310C, 0x27FFCEB3D6416015, 0x37F093951665FB7, 0x78099BCB0491C2EE, 
-0x7084E73DAD3355A0, 0x1FEE7C5F8D8FA80A, 0x86B5AAB7985B1FD7, 0xBCEBBC9887F, 
-0xDD11D8BA0FAB4584, 0xA3DA540DB2F5FB2F, 0x5D4988539F0364A7, 0x528549CA1DE048EF, 
-0x3D648E69CFF07D2A, 0x8487D6E1488ADD58, 0xB54169B637A312B3, 0x94225BB6AEEBCF7D, 
-0x4C961390BCD60B1D, 0xC2DC536C217687C4, 0x71AA70BEB74D187D, 0x1F2ADCB69D0A, 
-0x9C60DF292D2E5157, 0xECBEBCB3739F9DD2, 0x59CA5D70108E0AA, 0xC0AE2AF3789C9F62, 
-0x2CBE6751F8D1C691, 0x110EEDFD39BD6251, 0x2C423AA000993DF0, 0x3E8D828BC06F7E6F, 
-0xE777C5E5E6E43B4B, 0x481DC24EAE2A9EE7, 0x3BEE29138D9D73B6, 0x596C658E18BD, 
-0x316BE2C2CE7E5524, 0xF58F3C67FD0C1659, 0xF464D82AB7CA2932, 0x8DAA582BD122075E, 
-0xCB32C9DC801CD1BB, 0xCF27C633BD6FE0DC, 0x6645AC35A0DB1E3A, 0x8E138D15B7ACB273, 
-0x568590D47F583116, 0x6856DA094446B253, 0x785456311CD10602, 0x383A7B486122, 
-0x2563EB719E1FADD4, 0x8C93D422C4046EB3, 0x8AD7C054874A9810, 0xD839B76D51609649, 
-0xD51D6BC971D47E51, 0x38D1A1E875EF67C6, 0x103D21F8275E1146, 0xD819B41373F9D3A5, 
-0xBC77BFDEBD61CFE9, 0x274E8926C5501C4E, 0x7A733C0C4C54B41A, 0x3F4F73084CFA, 
-0xABAE8ED5F82B0680, 0xA8B95E8FFC14C455, 0xE8DF83AF192B0E60, 0x443E3E9D6EFF0AC7, 
-0xC2968B0B05185376, 0xA0318260D0FFB041, 0xB301D40052AF3974, 0xCBFC8C9902395B70, 
-0xCB73A3F056D236F2, 0x8A9B5A07952AEBCD, 0x2E69A9F30C7BF42F, 0x1C5605D5F420, 
-0x4C878FFAAA9ECCE6, 0x1B2C694DE4260D9E, 0x5A0A4CB41EB8EEC, 0x3ACF6C2F63464FF6, 
-0x42567F0B56F4028D, 0xDE50491DC2F9AB7E, 0xF9E51488C2415BF7, 0x3BE1E4A6A29B1604, 
-0xFB89A33E46458437, 0x5E1AD924C5C5C591, 0x52F7C4ED87467A0E, 0x241D0FA8D867, 
-0xA318D35E61FF1D2A, 0xA86374B5DB18E65B, 0x24665617C93A0302, 0xF352BFDAC6E91976, 
-0x2CE390C4CE72C94D, 0xC15F676EC7A4833B, 0xE0F48CB3A408C094, 0xF687729CFFEDFAD7, 
-0xD41EFB97AC9AEF62, 0xF335022BBDC16504, 0xB256E9C6792619E6, 0x3D4FE8E415E3, 
-0xE1A5835DDF9BD2B5, 0x83820FF55CD6CC91, 0x2E277EF4CEBE3F0A, 0x606AF9094C7573E, 
-0xFDA337D6F286F9E2, 0xA09B73C3F6C801E8, 0x4ED6373886C9C69C, 0x3D2267728F1DFDFD, 
-0x814B1AFC84F2DED9, 0x523221864838CEB8, 0x6F6A67284AA5690B, 0x203678E31369, 
-0xCD990FD29CBBA6A, 0x10DD70E58E4FC1D8, 0x5A0A484E2ED4A97A, 0xEB065FA9EFAEC597, 
-0x7C4F975D6DF62DF1, 0x9C3D997DEEFC8F09, 0x452F29259FADD5D, 0x5AB97EF4DE91ABFD, 
-0xAB0417105EB48F1B, 0x52032E8055EB77E, 0xCB3F9A8EE503D31B, 0x500B9DF19724, 
-0xFB4DA608FA4DE382, 0x879387A075F9D038, 0x9B150061FD42877D, 0xA08509EFCFE0DACE, 
-0x3C33F9569CB4F440, 0xB1BA9DC0B468EE8A, 0x9BF6D57D6532E38F, 0x59DF991D3DE05E54, 
-0x790CAFA3A42A78A4, 0x74E04FFF8C3252C2, 0xCE62447A8CE813AB, 0x6A572522F7D8, 
-0x6F57D302B4F0A306, 0x11D83460D4B6AE1F, 0x5D5B2546A4811604, 0xC0A3BC5D1DD684CF, 
-0xC2A4853DA4E968A8, 0x635972C32C5EB4C0, 0xABE746E322DB98FF, 0xB01C003EAF944159, 
-0xA62BB9039E2E2453, 0x8F28ACFAC37B1519, 0x43CA6505F0B6B680, 0x6A5B2FB8BEE, 
-0xCF98FC8D4DB72D6D, 0xFA299B2F12FE18AE, 0xD8F9DAEF5DF603A4, 0x196C1C9C9A42C16C, 
-0xD9D68A67337AD105, 0x9F379FB4FFA867B8, 0x25F2C87A7DC7683F, 0x8D38E25CFCD9AFF9, 
-0xCA6BA1D4CC87BCD5, 0x20EA88AA2927E1F5, 0x3192D1AC8823BBB1, 0x335934C06E7, 
-0x1E4E694750482E74, 0x27C44FBE959777A5, 0x8A69286337CFB532, 0x27238BD5D5A13CFC, 
-0x602CC397F8A8251D, 0x11A53FEEAB36DF92, 0xEE86995C513FF3EB, 0x657145D5EE3E3DE3, 
-0xF33D20F962FF22C0, 0xFBBA16ECF96E7D41, 0x16078163ABFBDF5E, 0x5526B87B3C75, 
-0xFCFC86F34C10EA8, 0x7ADC161B7D5659AD, 0xAA54DD47DCEC68BC, 0x2C49A54AD9B73D2D, 
-0xE2E8D7EB9F2B403B, 0xD0011EE5601CD1A1, 0x32DB9B2D6DB5229B, 0x7900FAC1002F6DAC, 
-0x96501A73567958F3, 0x58467DFFAF695E49, 0x8811FBBA0981F699, 0xC1814051FD1, 
-0x4682E304660321B6, 0x8BC18F35407668E1, 0xEC7B89D2AD766860, 0xDE8E78EAAD8F0CD3, 
-0xAA2DDF58A68525B8, 0xD7876BE71D4953E3, 0xFF0C9CF0FD1784D9, 0xC054DD85CC3046F9, 
-0xA0BC58FF88C362B, 0x9C2635FD37EF9DD1, 0xD377F026FDBD298F, 0x34E60BCA8254, 
-0xD729F0553670CC26, 0xEE22A18F707CDF19, 0x2AA8AF841FFE1718, 0x759CA8CE49B347B4, 
-0x300D603C33A03DD7, 0xD00AB13C8EEF33D1, 0x2D3A4F5A38A9A997, 0xD07FF6342CC4563F, 
-0xCF6CF28222E1DD4F, 0x44C70D3FEE8A7DCB, 0xD6E124C173310D67, 0x544493FB8B7, 
-0x40A7D1856D22BAE5, 0x53341FDF697712, 0x9E1128EB9EA7B8B1, 0x13004D0E16A3A565, 
-0x1499C27283C54280, 0x5DF74E52AC1DB078, 0x554D75601666CFBD, 0x698DA097DE804F8F, 
-0x9784260784D05F8C, 0xEFE442475ADEF241, 0xD94EF62C70168327, 0x58C7D121B012, 
-0x1A4E0B9F6922EFE8, 0xE54AC9015212B9E6, 0x7C97681644C79CC5, 0x21300E9B8F3B4ACC, 
-0xB1EEE821CCA17C39, 0xE9F099FC2AB08647, 0xB04A4AFA72BC2C, 0xFC48417CFC744D26, 
-0xEF926794B84487DB, 0x81D73CF0C3484945, 0xA5E493E5107203F2, 0x5F92ED8F1572, 
-0x1CF833FB81C0FC38, 0xAC122EBFA52C4E53, 0x1E0E736DF937C190, 0x699828C377295402, 
-0xE71AECEB3186B26A, 0x329FDE3DAF6FD136, 0x1563F5261CBD7D09, 0x94FDFD0CF55A46DE, 
-0xE4ED5DE048F893B0, 0x58783687578ADCB4, 0x952CB79A971023F, 0x5B5EA7F7EC29, 
-0xCFE36EB77874D6DD, 0xDFE43FC1B9D4BA9, 0xB1EE80E707C5D4EA, 0x56165D8241BBB013, 
-0x4B860EFC4F18E7AD, 0x4096EFDD36F94068, 0x9C23E696579C1F90, 0xD683932679F8E4E8, 
-0x79C46F4AE2E2D0BE, 0xE58BDAF4120C6177, 0xB9F500CA9112B9B, 0x614694BECDC, 
-0xDC994CF4EFDEEE59, 0x334DFCC3C1CC2D1C, 0xE1340F14E89870FC, 0xA0E70242C96BCE66, 
-0x4CF45D6C903CE261, 0xADE78B9DC499EC01, 0xB3863176DBF79FD8, 0x7FDA014645EFDE2D, 
-0xAD923CB6697676F, 0x7AB36F49A4258290, 0x640FC6876A6DD6A2, 0x242A7A5219A1, 
-0xB4C76DFCB65CB814, 0xB1266C9E547E737E, 0x3B2D99CEE4586821, 0xE45A28BC0EBB7F1C, 
-0x67FFC7FB4E7CE8A8, 0x5FB0BCEBD1B893C1, 0xA35754C6924F30FF, 0xAADB6EE4DE6752EA, 
-0xFBC046FB01C8C624, 0xA473CE053FEAF8A7, 0xE01AF15964BAD891, 0x5AC94533E01, 
-0xE89956A2B0687473, 0x109943DAF24F463E, 0x41BCF3D13CC8F751, 0x123C0F6988CC8C8A, 
-0xF30DDE340AD57366, 0x694FBF7ADB6A5D13, 0xBED99691C28D64F5, 0xB046B0D2B23BA509, 
-0xB4B723608EFA8228, 0x854CF7198876EADC, 0x6F58DF21B276D1E3, 0x19944039B184, 
-0x5DFDC8B7D9F81AA, 0xBDD48CB4EA61721E, 0x5606459606ED1A6, 0x2359DDF6DF32D627, 
-0x3D7F20E561CD1969, 0x56C78828E1311797, 0xFBDEE1F03527A740, 0x132DCBB1DD39604E, 
-0x40FF93F18AF74653, 0x823539DBEFF623F6, 0x4F7CBF2E3B9E8975, 0x2B81B37B4A8C, 
-0x15AF84BABBF928BC, 0x5E37FF797E9203F8, 0x5E3E7E57993F6830, 0x6582EEB3BC579A5E, 
-0x72CE778A049C485D, 0x86E48F405E8A5BF5, 0xDD13B0CE992E7D76, 0x9E215E87CB442693, 
-0x9FEFA65326C2E387, 0xF5B7396C04134EBB, 0x4510C822D1A09F33, 0x6E15D9E3A500, 
-0xA01ADC1C0EC799C0, 0xB45A5334E7FFD166, 0x86E9E4A86E04F95E, 0xA1C792C9707E830D, 
-0x4CA3DBA6E41A6361, 0xF03E01E8AD5EDC18, 0xAE700AB654CDE377, 0xBB59E289496B277C, 
-0xC819ADA4D08393C1, 0x575384FC5579A298, 0x27E4FE587CDDC0AF, 0x4EF63D2A12CB, 
-0x9B65683423EC1582, 0xC79906D016DD5316, 0x5FCE805ACC216D3F, 0x36995684490D2DDA, 
-0xA972DB53D88BEBAF, 0xF6552140F29EDE4D, 0xD1417284701A24EF, 0x257DED2988B56A3B, 
-0x413826B173DFA38C, 0x422473C6F652151A, 0x8108904E9AAE89EE, 0x2DBDFB3858B8, 
-0x36F5DC3F953669EE, 0x8B64F0AEEF395B96, 0x6E503110176BFF74, 0x775CE16CFB177855, 
-0xEBA50FB703A8A3E4, 0x271EA63B2192F558, 0xB29F156B65C0584A, 0xFF2AD136205FFD0B, 
-0xF966C93FEEA58DE2, 0x839850AFC45BDAF, 0x8987EA1044736087, 0x628C4B13D9B8, 
-0x2A57B49142F35374, 0xFB276F837F997D93, 0x17F2D22DE2B7D391, 0x43B9BA09DE22286F, 
-0x434D35F807E8345D, 0x31E6667C401C250, 0xB5D5C6069DE43F8C, 0xD660251FADFC0196, 
-0x31CF9A7EC8E4266F, 0xA249ACD67DF6BA1E, 0x4EB8AEE9D87AD511, 0xFE63AB18ACD, 
-0x12D14205D2F9D943, 0x44CD80A0C20B4B5, 0xEF605D4B365F5F6, 0x3F2D12CE69365073, 
-0xFA3D3A9A8BBDFC91, 0x825551B27ED6071C, 0x83FE0947718D85A0, 0x1854946BAA2BDBFE, 
-0x9407222329D73623, 0x51D7392B9AD0E843, 0xED4646AEF1940EE8, 0x1A44A00C61AD, 
-0x2AFD75A913EAAF32, 0x2918FBA06F88C9AB, 0xA4AC4DC7CB526F05, 0x2D19E9391A607300, 
-0x7A79E2B34091B54, 0x1D4809DCB42F1792, 0x63AF4826F85D0739, 0x4FB1AF7134E78875, 
-0xDBDA90D7F4168B95, 0x2A4AA9AC804021F1, 0x10BE206D2B037075, 0x99FF25CA24B, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51EAB6E6A2886C69, 
-0x78EA0BF5D8EB2B3C, 0x8DA896F199890C2B, 0x6B8CEBCC75237144, 0x6FD6E59F9A9B7A3E, 
-0x9D051EDFDAF36367, 0x64D34667DA122A73, 0x56AA4F7AD9E72FF8, 0x782B768DAE2A0A38, 
-0x9D47C529A5AE770, 0x1A5048049D1FA98E, 0x111FFD261D4F
-};
-
-
-// Precomputed values for the first Miller iteration of the Tate pairing on the 
-// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
-// coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
-
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
-0xAC2B2D74F888733E, 0xDA9B5D82CAA27D78, 0xF8656EBC40D57F4C, 0x5E1CD5BDBF041897, 
-0x1A30C6A718D110C8, 0x42ADEF0DC70D6806, 0x3BFA8FF5013BB159, 0x5E5A1D50DBB0E0C1, 
-0x3BCE4C7EDB3B6E6A, 0xA2C0219900C16A99, 0x18C7D034FA944E4C, 0x6715FAF4D0DA, 
-0xD5592BABBCC2584E, 0xE0547C84CD5E0C1, 0xFBE528CB2D17B51B, 0x2168CC83A03036BC, 
-0x46149EA13591E9E3, 0xFF230F71ABE6A6E0, 0xD4A9A33BEEBB78FA, 0x63627D7CDDA2D559, 
-0x601FCFC408949785, 0xCDE4532F5618BCF6, 0xBC83162A741E1D9B, 0x6F443172FD95, 
-0xF15CCA64ECAF5A88, 0x952ED60EBC735272, 0x2C5E9BA5561DAE61, 0x948952AD32E5CA87, 
-0x31D2F32D2C887D6C, 0x580EF5FDC2D40B61, 0xDB49D392D81A2D21, 0x8B011B5F9336CBDE, 
-0x3B4C85B0A54AB1E1, 0x71544DD7454B3E41, 0xC6D6334162EDD2AC, 0x224A7B1CCFCB, 
-0x38E59BA0C402905B, 0x662836C27434DBA5, 0xCF76292E8B52FE60, 0xC8DB8AAFAFB4CE6D, 
-0x2FEA96B083869ADA, 0x60347DA847067588, 0xBC88696946B32293, 0x17B2DF2CBFD97F3C, 
-0x9B56940153EFAA92, 0xB10099C181CFD23D, 0xD3DD0D847F870C47, 0x21D326FF0152
-};
-
-
-// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
-
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
-0x41FEAA3F231C32B5, 0x97F8BC8686891429, 0x56686BC64B25B1FF, 0x2CC4DECC8CA1D20E, 
-0x6AD16AF6F21BD80F, 0x38CBFDB8AC2567EE, 0x59A5A6E1701EE606, 0x7A6492F0D852FE48, 
-0x26EE6C4CC625968F, 0x76632520C7F63518, 0x7855AF0F7D287025, 0x245A1BD67EFB, 
-0x35C31F2D08EF9B83, 0xB0D74D62EDBBA7F7, 0x3C45BCC1AA3C6485, 0xCA936D3A1B4CAA12, 
-0xCF0DD083AA764971, 0x798D508D343AC629, 0x5FDBC47651C5B462, 0x73D37E0F79F94264, 
-0x8C40D219DA4C1F87, 0x8E9AAC7FE49A4C49, 0xC63AB2AE378C3902, 0x359FE5848718, 
-0x228B45E4774FB918, 0x50E5D9D6958BC5B9, 0xF8FB73BC851DB391, 0x3E55CF2C83D672E6, 
-0xB08ABFD29A6D6581, 0xE35C7DA6A08D1581, 0xF31632D4022C4140, 0xB1AD8EA4ACA36529, 
-0xF8D4B59A749825C, 0x534D0CE6433A7537, 0x6A2A7D60DCF9A2E8, 0x5FE0AEEE043, 
-0x1896832C8E469E4D, 0x201684DF9A73CD95, 0x5B8BD5CCFA47E7DB, 0xB9C637B9DDB78EA9, 
-0xB6FA06910C4576EA, 0xDD0FBB74B0F51F6C, 0x2B6D944304F25530, 0x22DBF0CDC51CEBD2, 
-0x2673ABADD331CB06, 0xAE697CEA61882AE3, 0xC08F5C7C8AA9090B, 0x34C2708E230D, 
-0x1F25DF4484B6AFA3, 0x20C3A3554A4F1176, 0x99046B5E2CAAA455, 0xEF6AC79E0DEA76D4, 
-0x2CC0030FCFF889F9, 0x610CEE38BB3C5C39, 0x58B64535FEF64886, 0xFB9373E0AEDF3891, 
-0xAD3671028CF3C62F, 0x89400131E9B5D09, 0xE1F72DFB029507BE, 0x154A16B9337B, 
-0x1C58A2F1CAD3D47A, 0xED548D4CAC22437A, 0xD150700AE4CCC30A, 0xF56FFFBD67CA41CC, 
-0x7D70EAE58BCDB818, 0x898FD54A626B32C2, 0xA18C38AD14E0CE6B, 0xDBFEF4576BC271AB, 
-0x106F1C06124BD417, 0x18B8621A7EFB024D, 0xE82DFBF24FD09313, 0x6081C5A62381, 
-0x2497081E98D74D97, 0x984E40412694B161, 0x93BB72B5CCB1484D, 0xC195C4D32240423A, 
-0x382B0072EE919E37, 0x7C0D8D479807ED4C, 0x1CA0EF95CF5F73F2, 0xC043B16F43924A1C, 
-0x5396BE7C87D6D702, 0x33A11E4D031187E6, 0x8EF0EA15468B2701, 0x47A070A25281, 
-0x2F32839488886B3F, 0x1E9BA6C63C254349, 0x29CCE943F08B0D8C, 0x24DC7F4B41545FFC, 
-0xC4C473382393C68F, 0x81D55D0FE82C03A5, 0xBFE4997900BDC79C, 0x4D034AFB23682136, 
-0x75165D4B11A833A, 0x861F70D5074E9D3A, 0xF86DE258AAE06315, 0x5311F6256DC6, 
-0x4322ED2B2AFC377B, 0xD974042DDE883E8B, 0x84C4ADE79F910F21, 0xD549934B815C93C2, 
-0xB839AA00ABA5945A, 0xDB2D3FF6A7ECFA41, 0xBCD67E395C628955, 0xDD98F7CB5D609AB7, 
-0xB1F16EAA780195BA, 0x3DE4B0DAEF9F92C, 0xA132760C88C7BE41, 0x28C895111871, 
-0x7DE89EB39CC23B63, 0x106C387265B69E3A, 0x8CF3A280D95F3FEC, 0xA76317D104A9C84D, 
-0x7BFDD754FE07719C, 0x3CCC0F6D3528D7A0, 0x727ED0306A5F5A99, 0x4E5CFC0EF64086A, 
-0xC8451E351AC0055B, 0xD0D6C802E9F24B7B, 0xC9D65D953611F4BC, 0x48A2C9D6A652, 
-0x85B3C8A3C07680C6, 0x2FEEBEDFDA6DC4FB, 0xC7DD0B54000B53BD, 0x286BD398D8CD97DA, 
-0xDD7EF32341078D3D, 0xFACA5DB4EAC9710C, 0x4642104FC79F8508, 0x7FEE5C63D6E8CBC6, 
-0x139B51F90DF11EE8, 0x2D83CEF979808974, 0x5AE055D8AE5CCF9, 0x750D6D9B980, 
-0xF05FB27861EA2DC3, 0x6F9A9263C676A000, 0x85586BF4B1C51750, 0xEA114FE37A3622FF, 
-0xF29F02D34A019A69, 0x6531978C8492037B, 0x838572E6E1E84CF6, 0x392E2C5CC41FADF5, 
-0xCDCA4395E2BD4B78, 0x6F21CC1CCC3325C2, 0xC87AB58B148F8A7E, 0x32999B8FC8AF, 
-0x18C5CB26C85C36AA, 0xCEBE765747D8ABA0, 0xDE857021D0BC3BC0, 0xFAEFC794723E74A4, 
-0x9FAE9057F8A57AB4, 0x7C23DBB3F9216329, 0x2A7A9C1C428D7B5D, 0x15DE406E0B2B09B9, 
-0xBE2BB184084C491E, 0xEAC5809D3E474A72, 0xBC6D37913710131, 0x4AF8CB65AA4D, 
-0xEB257B1EBDAC13F8, 0x8FF771C60F3D1473, 0x27B57486C49D823E, 0xE9D9CDB05EF83ED7, 
-0xE79FFA6C4484A7E, 0xD06FDC98B0AEF475, 0xD89C600530F0111D, 0xFFD5E4982A100391, 
-0xBB8AFCB5B3E7A1, 0x24D2B05FFA34F225, 0x6BFC87BC84941B00, 0x62DE743A18BD, 
-0x3D40CBD27640A6F7, 0xA542619129C8921C, 0xDA9CEB9BF4AF292D, 0xF46A0865877321B5, 
-0x78FB29FD75A4A866, 0x5A56206E332EE69C, 0xE3BFF679508EBFCB, 0x8BE80DA15C5A18BA, 
-0xFA3A21459D776E46, 0xF8373D1FAE8D7BF6, 0x2742C2D81C344BE9, 0x12733B2921D6, 
-0xF7BBF940DB253223, 0xF508512B81BAA047, 0x3604A37B3C0F7250, 0x1A5AAC257B46434, 
-0xE9A7DCD97783105D, 0x5F3CAB56484A3AE9, 0xC055AEC63AA95FF0, 0xEC3FBA19501A99B7, 
-0x9E7AF8E1B398D603, 0xED1DC8A4EE361FF3, 0x40EB0D43C0A44B13, 0x36CDFCF866A9, 
-0x4D8FFA39D021E487, 0x5D887C92C3C8F31, 0x9F4CF9D71F276CB2, 0xD5873F38ACD5AE9A, 
-0xB62F548F2AC02EC, 0x7670AAAADF81358E, 0x32BC40445BD82BB1, 0xC52BCCB897E5763B, 
-0xDC03C8C56CCBE91F, 0xB25F75795534CCB, 0x1FC17783F20DF749, 0x370729149250, 
-0x8E3307D0FF3B094D, 0xBEC6858D31CB842C, 0x18A8720CF8A3E3C2, 0x8FE64B235E6004D9, 
-0x8202926B7E4117B3, 0x328207E18BD03EF6, 0x3DACEBBB2A6E30A1, 0xCB7DE4EAC4425ACA, 
-0x4D51959B5449E6EA, 0xDB3ED00AE5E84D0D, 0x7D7313A2D1497577, 0x29CF10A332B6, 
-0xF69CB74F4B2312A7, 0xFE2141EC83DB9093, 0xC737A8013581358C, 0xEA1B48DD7839A2B9, 
-0xE6C3BA0539731E55, 0x4FE8934AFCB2DBA2, 0xD43C9C3F683EB974, 0xDC4B387E3B881758, 
-0xACDE8CF447B4667A, 0xE3C6D891BE3F6F8A, 0x2F4F1B2FED420A5, 0x4AF4A04F7EDA, 
-0x4CDDB1050FF54A9D, 0xF52C072234A751BC, 0x7EF2C3B0D4F0FB9C, 0x26E3E48F3F75B53F, 
-0xFC93F7EFD3101B26, 0x3F777590510AED37, 0x37EE1A1732F029A3, 0xAC2703036C959234, 
-0xB1613D5B238EEFC0, 0x14BEF779A3272D96, 0xFFA5D9936C6F57AF, 0x48145DDE5D84, 
-0x7930B4D3AFF7623C, 0xF579D82ACA0EB325, 0x7CAE78FCEF56CD16, 0xD54874E796A5AF24, 
-0xFF0928F57C5BD203, 0x1ADCC7CFA1C533A3, 0xBA14EA874674D3D4, 0x65CD865C41EC0246, 
-0xD564F88596889248, 0x7B65445DF0291D00, 0x4FFDE34C11FBD732, 0x202E78EB43E1, 
-0xE55BE122B67AFE2D, 0xE45AE41FD3CC1390, 0xBC667DFA66539555, 0xD85470081E324755, 
-0x678E52FB7559B94D, 0x4B83A7C24B6A3824, 0x3DF099DF7025B8D, 0x85043A9B1F72F6DE, 
-0xF9AD22B317560A91, 0x691AD1A859A290EC, 0x6EC3B345674A072E, 0x6DB6E9866087, 
-0x3B6774ED233ED497, 0x7DFDBFF0B8C33FBD, 0x1A6FF897BD3AF7F, 0xF6C8663010B605BB, 
-0xAF82A409B891C427, 0x93647FA1C36D6BCC, 0x297153BFDE90B93A, 0xA008B10A0D0502C1, 
-0xA317DAEEFB021D41, 0x7B3467F72423A93F, 0x4724FAE9816E19E0, 0xE4B0D1E692D, 
-0x3F3AD94B8CFC8908, 0xAE39264BADAC6B3E, 0x34DDF5849F69666, 0x15B26B312BF7D825, 
-0xA98481F96E75CF29, 0x63A564E31003DB6C, 0x169D2009CE8F6D2F, 0x6A1DFABF806A9D0B, 
-0xEF529AD1F1B16F94, 0xCFA27EB2F415DF7C, 0x12A28DCAD099F7EB, 0x3F1D04D6B540, 
-0xD5EF67D17501920E, 0xEC581EE34206DE9D, 0xC0A40DF96BAE4C15, 0xAB5797EC29219B32, 
-0xE37FF347DC996140, 0x7845D81C58B1F068, 0x32CBCCB7D206AB07, 0x47AE6786EACDF058, 
-0xE307D29DCE92BA2A, 0x14E895B8F9F6AD8E, 0xBCA43646758320B0, 0x1524A09074BF, 
-0x777774041B0CE1F8, 0xEE4E9A95DF96B2FA, 0xAB79D65A4251114C, 0x9B8D054F5487E829, 
-0x746354637DF490E7, 0x74623B2D676D29BE, 0xC56CB27124264B7A, 0xAB78F4A7BBE5D610, 
-0xC97AA31A9488372C, 0xD1065224267A0F6A, 0x5AF06E5CF449B916, 0xF50AE676A6E, 
-0x50E62E54B2E87301, 0xBF0A643FA8B4DDDE, 0x7CFCF55BE5416988, 0x3F52CD98FD999820, 
-0x8A521DA6C3E6E21C, 0x54FFDD969802C059, 0x5780676B3BEDCB0F, 0x4D0E5EB6CD677A43, 
-0x9D9A3AF09C5E8DB4, 0xC03376BE331D0876, 0xCBDCF7C3C349A0D8, 0x49A3DC9874AD, 
-0xA05EAAB8C9BDE361, 0xBBACD4C2509610B8, 0x1BD0354BA8EE1C41, 0xB63DE836D1CF448D, 
-0x2C3D81D0D6001430, 0x8EE5F1599B51142, 0x3AFC5F93A2094C5A, 0xAD9F00F33C7BCC36, 
-0xCC53DECF2C70C0E1, 0x75A6BE224961CB24, 0xA5FFD47CE0201406, 0x260334B0E8AC, 
-0x947BE05B275FF3BC, 0xBEF35F81BDE60736, 0x6BB16108963EB92B, 0x260CDC5CFE9FCA2D, 
-0xB64D81EE29F0422E, 0xE9A96B78E03D317E, 0xDBBFF8525B0B9D08, 0x489961EDE56D5F05, 
-0x8486CFB4FAD913E5, 0x201AB18D2E9C35F1, 0xAB4C544E4189EBFC, 0x52F60D390FF5, 
-0xCF7F647818703378, 0xCA8D6E5CC199509C, 0x6508F68F7BDCBE0, 0xC868FFF8C3FBB311, 
-0x61DFCBAA7C9965AF, 0x4763D41CBF6A65D6, 0xFF9EA78F40574CFF, 0x1B0981E2E182B85D, 
-0x8F39686AB54CAD5F, 0x8F79D205DCA1C13D, 0xF491AC44B180924B, 0x68215502D936, 
-0xAD41F9E45A7AE4C2, 0x52FB46556B4C4239, 0x5B393866A3DC800, 0xF6FB9729D903C714, 
-0x525846399056D232, 0x7C04FFB8CEEA4336, 0x8A7AE6EDACC8D150, 0x567436CAE3D48C37, 
-0x2019114B0928DA77, 0xD8087C1798C68A66, 0xAED0EEE7E4A67A6, 0xA8BA7BFFAB2, 
-0x12E49DFD3495F0DF, 0x97C7690271F02A94, 0x89BEE6C3145D0CE9, 0x3DA863DC8C497AED, 
-0xA09902C19E2D5EC8, 0xD5877B4B793BE359, 0x682CF667DEAEB22C, 0x7C71EF563762AB50, 
-0xF25C27EA0A72AD0B, 0x166B2BB7ABAABE90, 0x1E6F57A164F6485D, 0x376F983A1111, 
-0x4D713026D898E1FE, 0xA80B1B9E52AD4565, 0xD08097D212BD8533, 0x5C4CC160EF4A1EE5, 
-0x1B3FB4D6C031BD9B, 0xE727AB389C0BE2A4, 0x52E057D21775A2BA, 0x408A5A31061074CA, 
-0x256192F282DC2F64, 0x29AA8B5DE742221C, 0x1785490F4F4A27EA, 0x4DFD6EBFF14B, 
-0xC1FF64E6AD802C0B, 0x68CF36453DAAE4DF, 0x387ADFB2F5305825, 0x80731715ED3D5891, 
-0x22AD8F352BB7391F, 0x75505D7556AF5DAF, 0xB3809032AFAE94E9, 0x2920EB485F566FC9, 
-0xF3533032C7109CE1, 0xA42C31AD0C38DEE7, 0xA7D0B1B4011BB483, 0x56597954D087, 
-0x37DF8020E63601A9, 0x61FF8EFD4CCB7FCC, 0xE05E27C19AE72C7A, 0xA0AFC6B2C7788BFB, 
-0xD44F084AA4DC1F2C, 0xB0013C8613446BA6, 0xBC57E796306F0791, 0x1FBB4FB326418CCF, 
-0x4C31005C8AD3016A, 0x6433506F86D56B8E, 0x7661AA230C749889, 0x3A9AD6628533, 
-0x7D5F07406B78DC66, 0xD0C1A2C72EBA5032, 0xF991E71EB5C9313C, 0xF9236EA7575E0B42, 
-0x88B52B8041839A28, 0x36FC6A483E43B526, 0xF4E7AC46096E0C1E, 0xD7FAC39B0B63695E, 
-0x810F75D31A3616A0, 0xC1EE6CFED4A37636, 0x2EFEE4561AE7A50F, 0x6750799873B7, 
-0x609599110A5F3D67, 0x3BD789C721897187, 0x50D3EF6A13105673, 0x9E5E02B09FEECC22, 
-0x2704C3833EF70F47, 0x9C99277154B8E684, 0xE0FF03EB99F94612, 0x77F9FE62CC9613E5, 
-0xB12C320176A87E77, 0x5E191289C4ABFC53, 0xB060F409121F1699, 0x62D6408A987, 
-0x39BB70FF237110F5, 0xE90E3B03EF738F74, 0x8907FEB153DFD12C, 0x988CAF0B4DD52F6, 
-0x9C1D16A181A4A4D8, 0xFD4B966FBA7520CA, 0x4C77C87DFD898E7F, 0xAD25306D911111D8, 
-0x79A07CB257064DBB, 0x751322A905EA0DF9, 0xB81071DB113BF999, 0x16B29A8AC59A, 
-0x2FCBDC23682572D1, 0x59894B9332AF87E3, 0xA7F8A5D3C6B1538D, 0xEC4BF918405E20CE, 
-0xB34D6419CF8DFDE2, 0x803DEB7DFC02DC32, 0xBA3C7D057AF27DA0, 0x2BEB5CAF9C9747E7, 
-0x319F85023D7B10B8, 0x9648E2061A2108DC, 0xF6276BE3FA8BC7DC, 0x473C8BA0459B, 
-0x99C76C144C052E8D, 0x334DC40BBB3996AD, 0xBEAFD2D89C78248A, 0xFE7EB7CD75CEFA17, 
-0xA0D2442A24979501, 0x93A8E9DA87B24482, 0x4CFC19DF3EC6B24C, 0xBBD8494110F430, 
-0xA6065FBC65A2A388, 0x2583F9E9F247E9E8, 0x1A2128710E3E9B16, 0x60D254FFB63D, 
-0x730F66F21A098041, 0x7F4F2CC18EFF73F8, 0x2A2D35794612F0D6, 0x724694BC44ED8711, 
-0xDB530CF8665161CB, 0xF3A006C94F83E678, 0xAD90914CAEBF9796, 0xB15A239C918AFFB8, 
-0x49427633FBBCBF63, 0x711B5F96040BD253, 0x37A1C953F9D7137F, 0x2188556CDE16, 
-0x8FCDE842080679D, 0xD3877D6C2685608D, 0x6BE61D03B3F48CA6, 0x1F37793795C4E650, 
-0x15124FC270F4AF96, 0x41B633C95079BC76, 0xD5CA2B016409CC30, 0x73FD19233C73317B, 
-0xE4411E1ED45A149B, 0xD7749C5A8EE2FD9F, 0x314C9ACAD5320B61, 0x2AB2E2215470, 
-0xF36EBB47B7861A88, 0xBB3313F7A7FE6FEB, 0x2F27EC12360FA186, 0xF7D1291D514D318A, 
-0xDFBBFAC6A8FD3E73, 0x65EEE25B8427BB93, 0x2FD17C0B15225C01, 0xB6EC8DAED74E16E0, 
-0x6ED66093DD30CAC, 0x5BAB3C3A4DF800EC, 0xBC5A03BFAB4649BE, 0x58D00EBBADFC, 
-0xE5A25CC7AFFAB1D4, 0x82C816E66D240844, 0x4567BD238DDE75EB, 0xA370C3B0B55F0C71, 
-0x41E95B23C2939B2A, 0xE8129C1114E34E1D, 0x82383A73268BE039, 0x7D96962B268E6941, 
-0x25136EF0A10510EB, 0x115B3D33A314C469, 0x659AD741379808F3, 0x13023B64B685, 
-0x71A4FE30390BAFAD, 0xF469ADA3E7FB60B5, 0x7A5BADE079EFDBB3, 0x40ADE33A227F5E2F, 
-0xB4466F80B57158C3, 0xEF5B2F405B813C71, 0x86229D930CAD17AB, 0xCADEE515B3545220, 
-0x5473534FA8333158, 0x24AECD08B2AACF8, 0xBB2D876EFF3EEF64, 0x490F98FBDA7, 
-0x65D540EDC018A1D3, 0x52BBF1B531AD2B9B, 0x2EBCBE11E5744F3A, 0x37D9B7E64E682E38, 
-0x9E92A2C536AC0EBF, 0xA5A6DF5D1FF8334, 0xD21DD495B3FC989, 0x97823A0012ED51FD, 
-0x94F534D36C7BA7BB, 0x81BC5974B4BD0930, 0x420522485E5E8D6E, 0x6D10E9DA9096, 
-0x4DD9885989E3555, 0x4520647EC130F7F8, 0x5C790D8E55CA670E, 0x424C692F290B0883, 
-0x74708AFB4C5EDDDD, 0xB371EE0711014861, 0xA8080B3E3366E7C, 0x27BBEF2118984377, 
-0x7C4D53B1CAD15045, 0x6974D828C537E5BE, 0x9FF4841E9291B468, 0x4C0B62648602, 
-0x94344AF9DE5A9A33, 0xA0C1830664E18467, 0x7B7095510207CC2E, 0x714237A33E4A6DB, 
-0xC53EB5FF437CC2A6, 0x37D44775096BB135, 0x4228F8E93CE53608, 0x844F999A9D0E5C, 
-0x4185F3551E05B310, 0xC0F02D9C8EFEB93F, 0x6776D836E1FD4EDD, 0x5CD8BD9864AD, 
-0x683E09E6EB3514C1, 0x802C1C9A976F5102, 0x8B97D106DB5A63D9, 0x69C944E2207D9447, 
-0xCABD0048D82F911C, 0x31CFB7383E246D8A, 0xAFB12122568DCB32, 0x60F1BE72C3432808, 
-0xF6AA5565FB7EE41E, 0x723AE274D0783C5A, 0x20C3264ECA7F7A8F, 0xFDA6E250483, 
-0x7926BC7359E2D53C, 0x2C91832128532A50, 0x5F8C4BE7E69BE72, 0xA775F68B82CAFB4B, 
-0xABCAB4709BB9BF5B, 0x335BA6B59DB1A49D, 0x14999292D3FDFE38, 0xB3FDA1ECE53F8617, 
-0x7251C7A6A0597FCC, 0x6FD72530BEEB6F57, 0x460E64333E6E573, 0x13992ECB4A5D, 
-0xF5926A00810B9785, 0x791CA612B5B72186, 0x53BD438829A731C1, 0xB5D59EBC6568DD6, 
-0xFA9A560430677154, 0x6A7C601BD6AE2853, 0x8A077566DD3410D, 0xC1B10FFD7823E162, 
-0x47B63B0C292AFA0E, 0xC8E3DEBB5750ECAB, 0x78EFDCD13F880CAC, 0x11DD1C2B474D, 
-0x454B7D0480004219, 0x5A3EF9383FA81AAD, 0xD72564A33F1684E5, 0xE8B48A5A8711C893, 
-0xDE2829583D87485A, 0xF5B7090B68C8AC28, 0xF20AC28287E650B3, 0x775686F80945E7BC, 
-0x58DE3C5048174E9E, 0x9D8A16CD9FEE2472, 0x44E393A332146A28, 0x3664D9A8B3A6, 
-0x464D6A9D3F65DE4, 0xC1E2B1F8138C9F66, 0xA2CC5A559AC0E4AC, 0xC4AB2D8A2E967C1B, 
-0xF0B2773E0CD12213, 0xB439CE81F6F64A3, 0x18B866A38D2ADBBB, 0x3F512AF67CA9ACF5, 
-0xBCA79E2332FDC56B, 0xAA982CE4F1BE8D09, 0xF3FDCA875648377A, 0xE48F759B405, 
-0x8C2132DF998BA133, 0x72AFBAD0F3F3F6D5, 0xA71A676940B315AA, 0x565D1E6EEB4D8D0C, 
-0x5AE48639CEA8195E, 0xE202511F025D6A16, 0x9CF8575E2311B5C0, 0xBE736B10E9225E1F, 
-0x1DCEC0B46A6EC45E, 0x887A3AA32BEA8071, 0xD022953E61EA4ACF, 0x3AC3CC9355E6, 
-0xE4B4FA1499425B74, 0x927A5100C8F0E638, 0xB830FFB7DB41E9B9, 0x380F40E0E413D841, 
-0x9EE079D9150DC8DB, 0xC926B2B9224C3045, 0x5B0E6B61A883DB07, 0x58DE413B7FF18EAC, 
-0x9EB44040EC6A221C, 0xE33A6AC444568463, 0x3F3D872EB80C9E54, 0x4C7FEA0C3C5C, 
-0xA66B12DBE3DD4668, 0x80E9F718074C658B, 0x7370282B19577868, 0xFC978D3E77860E7D, 
-0xD73F70168724425B, 0xCA3099A7BCD5629B, 0x5126C674D29E6399, 0xD5DF2D459096AEF3, 
-0x17690CCD8EEE1A78, 0x32927158E7BC29C7, 0x421BD620743A606C, 0x5D1846A70F0F, 
-0x33F99145EBA98085, 0xD87B0305F35763FC, 0xC4F4D08762FFB962, 0x8021B224A284D22F, 
-0xFD4C2AC0071A95ED, 0xA05072CF30397DF, 0x3FB7716417F6A489, 0xBF06DA5FD309160, 
-0xD971AFC8C41956D, 0xD39ABD13B08C86B2, 0xFA53A3456433CC2D, 0xD74FAD0F977, 
-0x81C492FEF224CDEB, 0x487972102B68900E, 0xA6960606722DF71D, 0xD7479A64EDF4B88C, 
-0xCCCF6112C1690AC, 0x17CE2655AF226A1E, 0x935737FC11446DFB, 0xFFDA1779B973A749, 
-0x7DAF5D74E96AEB73, 0x4F339D70AC5E732, 0x5D15E8DC666D2D91, 0x68E7E87B66DD, 
-0x14B207C4CE90A4E2, 0x513229F3B8DB34C0, 0xB130D1225F888AC1, 0xBE6FA0C8563C7031, 
-0xE683858E64FBAB29, 0xA1BE06BB3ABB9AEF, 0x3957E9C368B65094, 0x4656EBFA164B69, 
-0x516CDB0CA13A1CE9, 0x44E614B90E36EC50, 0xFA756DAF8EEFF656, 0x105A9572556, 
-0x8A7FA41A894CF6DD, 0xE099F32D308D8F38, 0x3966C9A55DA7167C, 0xB70A1A439058E1E2, 
-0xEDD476F6023C07F8, 0x1C011D796FBDB01, 0x93A559D85C849136, 0x132EE336EE08EE7F, 
-0xDB301C9D5717067D, 0x6BC39A5DC5D236F9, 0xF0068EA38B550F58, 0x6EF86DECB5C3, 
-0x664E06C79367A8E6, 0xE79D2DB253CFDB2B, 0xE3C5FA1FD411FD73, 0x105EB6D5FB0F4F86, 
-0x115FED122871934F, 0x1FFDF6EB5A6663D6, 0x1CC5704056C3B488, 0x81CB597D8B9AD7D4, 
-0xC09C59EE4B39607F, 0xBEFA878887A270EC, 0x5DF846EA5BC4B6C4, 0x3B684C6D5D7, 
-0x5F961AE3EC9A8542, 0xF0EF5DBE5255997, 0xF2AE8A14BF6CF4BE, 0xC0937FDA37EE2665, 
-0x4486CCB02A0500D8, 0xD4F78112BDC9F7A6, 0x2A5BC12F0EB49DB5, 0xB860125F2BAD2665, 
-0x6944E63EAC357D21, 0x3D29665A28F0FC61, 0x609CA34E3FA99E68, 0x39958816228C, 
-0x291A9FD19D704C93, 0xB32D74E6740ADA5F, 0xEEF54DFCA60DF6B8, 0xF365E8B57121F484, 
-0x5745F594DFD1A3E5, 0x3B8F66B29A157F99, 0x70DDB5EDF1E1F386, 0x4C45F54EF254F1B9, 
-0x8A95553B0D018A20, 0xE8C693AFA4D9BAE, 0x17E6A88C21A294BF, 0x4BD0AEADA6DC, 
-0xC5CA22063BBDF98E, 0xADF526D169E1212, 0x75462201B9F592B1, 0xF42C6A51ACF650A7, 
-0x38305A0D37698AA5, 0x9B366261A6833DEE, 0x309747513B705CA8, 0x3C077BB585EDE947, 
-0x84A69FEE3309DB3F, 0x6AD3C5A97E239911, 0x3CFFC658F5698988, 0x35D7CA9C1270, 
-0x2F050E4E14520D88, 0x13DF82C85C97B72A, 0xC3B9CDFCEB667006, 0x1F31DAFEFF3A4CAE, 
-0xA2B36CF62E5A3182, 0x9C3447A98C435D49, 0x404044D506EE4AF5, 0x9A48515DC7A1AA6D, 
-0x61FCD11ADF5BF5B7, 0x959A5BC0A935BD28, 0x4434EF78CA4554D9, 0x43DF0755672F, 
-0xED0D36D7A88B67B5, 0x5C41CF2E64B4DF43, 0xB2FD080239AC250, 0x713F93CA9BB21748, 
-0x44B8F79D92914B04, 0xAF6252A67C1841C2, 0x66472E532FCC079, 0x33656514F7F141E4, 
-0xF9367EC0CA53A7EA, 0xC79B3511B18F2C8A, 0xA3712CD7F964B04, 0xDE0BE9E2014, 
-0x1EE5F3851ADD4BFB, 0xAB016A4C2E4CC7CB, 0x7279A26C789D3D02, 0x4931277F21C77C5B, 
-0xF7B0D25915BFE3F6, 0x9E1A4F5920085F2E, 0x90394ABD909ED5CC, 0x6077CC61BA71F2F8, 
-0x5D93664FA74643D0, 0xDBF9CEB5BFFA845, 0x1DA1F969FE020955, 0x6B1F6A573EF8, 
-0x5AF28F2CE2E027E8, 0x7D088C3DC07A8434, 0x65E17CBC8A97C104, 0x79F20183D0C1126B, 
-0x1D2C305C2659F31C, 0xEF44AC0553C48094, 0x76DA2D8FE972D0EA, 0xA2BBF41CCBE25FEB, 
-0x7391A8D3D674670A, 0x2FA5B2EC79B5D77F, 0x8E5CCD1E08C15688, 0x3FB1BB5C18F8, 
-0x49F6991F5B2A180A, 0x64D884D94816FFD6, 0x57F8FFFE392EB79A, 0xECFE294B2582985B, 
-0x3E85442081E1C6BD, 0xE7D67A7AA9E8CC41, 0xBC1F4F05F4DF4AA3, 0xABD7B8628D05E06A, 
-0x1EEB1F37D611229F, 0x39BE7A84DEDCEEAE, 0xDFCE580F2E25C3B8, 0x3602D1320639, 
-0x651B31593DB510F9, 0x55E0ED4E37A0B6CB, 0x9CAE3BF52D139480, 0x1D534D5CD1A32673, 
-0x91E33F64C6ED9C03, 0x8C65D34D304A4D6, 0x6A84D421D1200C23, 0x75E27A39BE9ED5C0, 
-0x11C56C0EC6CF36A2, 0x13F4C2202518C606, 0x4F051213F9702722, 0x12591ABA3844, 
-0x1974C1CFFD5336E4, 0x4AE94E322A36C4C2, 0x1A9A7D061C779A51, 0xB87C391AC9A2015E, 
-0xC40A263B2595A98D, 0x75B7525DEF4D9B87, 0x1AD040CC6FF8674A, 0x1AD3BE2D86D49B6E, 
-0xC534E9CBEA886496, 0x3CDEC14902495AEF, 0x9B87CDF7AA774798, 0x4143DA0A331E, 
-0x4189E1DA755B8933, 0x2FFA33E07C566AAB, 0x481F12B6D8479996, 0x85D6FB680145DEEF, 
-0x81DD45DC14BCD5AF, 0xA50BF76285D05934, 0xCC62A3022A2D5ADA, 0x513D4245E170C8B2, 
-0xF6A895B145BF7056, 0x403EEA7BE6BBAA37, 0x49301CDC1BA30D7B, 0x633889984053, 
-0x2AEEE0069FE4570, 0xFDF13FB76C0A815F, 0xA50A0470D1F6C56B, 0x30CC06CBEF9AA555, 
-0x4656CCCC9E12E84, 0x96F2C7F619A20F3A, 0x135D9F181C2A9087, 0xEB91979402EB3117, 
-0x9EFF9CC51D1C89EB, 0x2EF638C100E4B084, 0x480B7F4DAD524854, 0xFE67BBFA7ED, 
-0xA83D1E5D71A47320, 0xA44F514559E60C9B, 0xABD2D4784A9793D3, 0x86A563EE3635E7F0, 
-0x8AE0B7478CA3D925, 0x81F82267AB353DE2, 0xD16E5F6E5AD11987, 0xB45047EECF39339F, 
-0x17B30898E712E3C6, 0x410C971EAA224BAC, 0xFD9A440CFC99606B, 0x5B0CE8EA9851, 
-0x78D16427E0779459, 0xD7A4C4F092115B56, 0xC1B469F373DDE97A, 0x4C6D8D96FC1C214B, 
-0xFAE77B8D9ADF9E51, 0x99F20D3CB589E00B, 0x234C86BB31A9AB9A, 0x18EE13CFECC205FD, 
-0x5F34D314A3B056B3, 0x4BF311CFE4FE778, 0x498FE04064490997, 0x5EF3B3F8D9A0, 
-0xB1C5C8DFDFD14D06, 0xBA019F769D4C916, 0x25D8192A7959A3EE, 0xC8A40E3E303C0C3, 
-0x74068F581FADE821, 0xA31807F63DCE343, 0x4C26FBA48AFED91A, 0xFA2F90F89AB5D739, 
-0x590EE17EA5AA1924, 0xE2CCCBB58EDA8D23, 0x4DF4512050505C87, 0x482F8CDAFDAF, 
-0xFD5C068F8D08841D, 0xD40C2C944F381D13, 0xBB9E18758E539ED8, 0x5F216B3308080496, 
-0x3ECACA4103B14A95, 0x2796FD17DBA23380, 0x2CFE1A7CC905131C, 0x566D463708F18982, 
-0xA9113E75E004D4E8, 0xE982E688AC33AA43, 0x654CD1A6E611A56E, 0x30334D32143B, 
-0x63DE844F970B65E, 0x2E265565881159E1, 0x511CEF8B0524BB49, 0xBF9B402B07B29454, 
-0x30843E2C498CC634, 0x782040D376750AEC, 0x19E99C6DB820ACE0, 0x4A826AAC705CE3CA, 
-0x58E16EA71117E4C3, 0x43ECFE85BC83978A, 0x64DE5F55C6FC0994, 0x3B31C9DB4EAC, 
-0xE5D2302CF479EC31, 0x4806747FAF5DCAE1, 0xA99CF095ADFA9E0C, 0xF0DC92A8BF044293, 
-0x655947A0DBF317DF, 0x5E80E5191E379855, 0xDE7DF05CA8359FE5, 0xE20D0AB7EC510BE1, 
-0x3B01D2CD66DC3A7D, 0x50F183B1A05B53AC, 0xE8EF33C0278746E3, 0x133E665F06FD, 
-0xD613DED5022E4C1D, 0x6B2D3E5C36737EB, 0x354EADBC07EC60C7, 0x5720B2AA1FCB579C, 
-0x45B7CD9DFA950F49, 0x71952076C285941B, 0x1C1932E75D3EF756, 0x88665573D43940CF, 
-0xEE16B13B70EA84AE, 0x4206D313D4A1241, 0xBB6FB37A1F967C4C, 0x65F21DD417EA, 
-0xB93E0B9EA1A64ECF, 0xC909E3B5197E7AA4, 0x78DB53780B6F322A, 0xE81C7108807B5343, 
-0x8912C464B124904A, 0xDFA3502DF58057E9, 0xF010592714EFD571, 0xBB89C3B27DF8FD4C, 
-0x59377E7742EE6FA, 0x1F852CEB8C493D00, 0xE8F4CA6E3272D6E9, 0x3E461F6CBF0C, 
-0xC69587B26C278E7E, 0x1AF7CB8C459E0F80, 0x3F521FE012BEBF8D, 0xC0CC4E0B5870A33, 
-0xFEC49CEDBB053935, 0xA4ACB85E71160E19, 0xC662D531B69C9BE5, 0xB595F7D84F939BD0, 
-0xE14F5C21AD0EC8E2, 0x5EB270A171F38DA2, 0x4FCF641B620D75F0, 0x625631EC0A34, 
-0x67A27B65340916BF, 0x2D35A04255B7AB9F, 0xA1AB6C8B2084BB1, 0x2932C0E9EFC3640E, 
-0xB74E37CCF0155FE2, 0x47E6877546E4A10C, 0x43B2367FE26D8141, 0xF8B2A7DDB45DDF69, 
-0xF586788C1C162C3F, 0x3BBC70D9DBCA3FB5, 0x5E26CA956AEA06B1, 0x6DC9AE954C9E, 
-0xF386FDA87A061A15, 0xD06B5EB1F2B2A80D, 0x2F4BBC103577FD9D, 0xF72F54E8EC9A80D0, 
-0x213AAA6FCA4EC688, 0xBA6995C5D8C6E97E, 0x42759FC8CBD61775, 0xDAA6878103B51AA3, 
-0xF410DCFA738BA24D, 0xFC0DE1B8E88C4AF5, 0x6338479D1D1D5F97, 0x31BE4B90918A, 
-0x2DF09C4A5D419EAC, 0x61B9A332C3BA401, 0x971E95552D7B1954, 0x7A96E5EEF93B398A, 
-0x15695E1392784958, 0x3659D655475CAC09, 0x645ED03E0EDB53C7, 0x4B0BE3884DB3FED4, 
-0x3B80A0FECFAAA1A5, 0x51AF27B2E2B51653, 0x3ED898B04C8AECA3, 0xEF13CEF1BFB, 
-0xBA303AE12B9F04A6, 0x7A6122ECE572C929, 0x835DF9658F9636B2, 0xBA068DA6135B7B4F, 
-0xCF19A8591027D4EB, 0x5A3D384B4F6053B8, 0x5291D06AC9DD34FA, 0x975613C231113660, 
-0x901093738F7A1D0B, 0x24441C262293DA0, 0x98206885230D4917, 0x1223A78B6765, 
-0x479125AA594B3AAC, 0xCC3905923D8A113A, 0xE48C74537E165F12, 0xCCEB076A3FC6D06D, 
-0xCB7CAC41578D30B7, 0xB7A934453A3EDA4, 0x7F707303FB9175C4, 0xB2905F5BD7EE06E3, 
-0x3A3DF5EC8FA4D69B, 0x38B602B9C626435A, 0x7E73F26DA3D304AF, 0x3D94CF5CD697, 
-0x5687620B6676C160, 0x2DE8E4F270898DE3, 0x7ACAFF0EFD554C0F, 0x73ED8FB50364107C, 
-0x929188B715DB705E, 0x6BA85429ACCFD4B5, 0x308C33E5E70392B3, 0x7E6E6DF21FA6D2B0, 
-0x679C522BE906F746, 0x28327B191DDEF33B, 0xC8299810A6281C4D, 0xB4DF4E6130F, 
-0xF6717E8E356E2A06, 0xB3C35F052EBC94CA, 0xEADFF3FD06816DBF, 0xA9A221B81C4CF445, 
-0xBA016C0D085ABA8B, 0x4E0FF5142F1D9ACA, 0x1433431BBF5A76A0, 0xAE95CCB9FA809B07, 
-0x4E3543D4D04F3E89, 0x57D53A4389579672, 0xAA557A3F6F38B6AF, 0x43A2C601C09B, 
-0x7A1B8DD9FDC5147A, 0x887ACBE78C2FF62F, 0xD5C17D9623ED8650, 0x8166A2F626A03864, 
-0x68CE162ADF410E1F, 0x4316F2B37D8AD2B0, 0x1CA513DD6E29337D, 0x571A48076D38DBA4, 
-0xD2D6FF5726D9CEF6, 0x559EAA41A391AE5B, 0xD544C3E123EB6DAB, 0x4F752A366272, 
-0xF7FA1610D9A24FDE, 0x53D6099A888B5118, 0xC5E2B2C51DF1B07D, 0x56ABF6C122A645A2, 
-0x241E92B82A7DC020, 0x4BC8A23E81D3C331, 0x54418BE3B5D27038, 0x41777D03363A87CD, 
-0x5AF3DA087443C71C, 0x2CCE7446AEB230C5, 0x4E7CE76796FF9453, 0x633F6E3A821, 
-0xBF7B870B666DC04E, 0x9546A0C5D4CB6CCD, 0x2468F342EB4C4B68, 0x569E7A0FC5FE0975, 
-0xA73205266DDD3511, 0x52E9B28A0BA97A23, 0xCE0BE7D4EAAB030D, 0x1941D920A35AED0A, 
-0xAFA551A3E98D8301, 0xC4D81AD03149523B, 0xD03DE713E82EEABF, 0x5510D528FE3C, 
-0xA614C69D8C8CF053, 0xDD5F0891A2116748, 0xC411E629C4337CD0, 0xD943EC6310C585A2, 
-0xE4775630372CAD6D, 0x22FD721C6046245E, 0x9A56D151ED4BD93F, 0xAA4FFF400EDF5025, 
-0x762374693274733B, 0x41B0EA3F62BD81EE, 0xDF53F185EF6A00C8, 0x44B022398740, 
-0x7D82181A28F66378, 0x3761143898D00F24, 0x34FFE8CD5550AAB1, 0xCC450906D4EEF821, 
-0xB06A3475DC44017, 0x8AFCB5AD606926C1, 0x6266CE80383771E9, 0xFE7841D333CA28B6, 
-0x90CC7B82258F2B25, 0x5848697266EF3360, 0xC8F6F9153F2589BC, 0x672A30FF2845, 
-0x3934212879D79B3B, 0x70E2A7EC6627F7B0, 0xB94CFBC3F410FBDA, 0xFC1BCE0DDBA735EF, 
-0x933E35C47A35F914, 0x61CEF481957045C2, 0x90A2D86B4FA402F8, 0x6C2E0B85E2B9EFD6, 
-0x8E3C4BA505779B5B, 0x4B256534B00F75B9, 0x31399A39F52CAB6A, 0x4E66CB29F130, 
-0x9CF78E0D4F90A954, 0xC5DF084A8B26D071, 0x70B956E60F7DB558, 0xC59F0986ADF26447, 
-0x10629BBE71BEC13, 0x2AFFD141DBBB24C7, 0xA3F2709BE2BD7669, 0xE786653FB197B313, 
-0x703ADF1BFA33E53C, 0x89E9718B882D1C65, 0xC19DC20E95CA24E5, 0x19BF668ACEF5, 
-0x597C3A8BECFDE94C, 0xABAAE22AB7A0EC58, 0x2A049C653DA2211D, 0xACA2D1AF447FBC4C, 
-0xA50A55B0789EEC3D, 0xD39A9D9A1F9EDECB, 0x586763B58FF142E0, 0x6DF04BB8E40B4C87, 
-0x6A1F942FB7E22D33, 0xD53DD76D6A1CED84, 0x78873E8E0DEE9426, 0x48203E131608, 
-0x755FF0DAF60AA68B, 0x4D4BD31AEAD5CBBA, 0x8AA4EEAC314366CD, 0x5F793E18234BCB2, 
-0x75FB508B558F5A38, 0x442CD32C732BA4C, 0x33000FAF3DD066E1, 0x37DC36BDF71EFDB7, 
-0x1091B8C86362A601, 0xFB6A48AD538B0EBE, 0x8801D9E476098443, 0x11DC7747C1DC, 
-0x4FCD4B8B4DED5EA1, 0xC9C03AA54A58DABC, 0xD723D00A37C9AED7, 0x65F27212A0298315, 
-0xB91400ED42DCACF8, 0xA834DDEFE7400E34, 0x775DEBAD82373409, 0x341821C5E9DEDC7C, 
-0xA4C0B593F37BFED2, 0x3B1BF739F6ABA54C, 0x9376B78A17A27C48, 0x666FD1F83CB2, 
-0xF49B2B576F5D63F0, 0x186F468FB8151454, 0x64A9079E6EAF076D, 0x77EC18A7B87EA755, 
-0xE5B9F5BF0F2D3F57, 0xC538E469304AD593, 0x76B93DFFDC600D9B, 0xBAAA59378B7E8AB9, 
-0x4C7F47AF1F8C7A55, 0x3B4C15A4AC05AF7D, 0x326E18A11908451A, 0x31880F10F58F, 
-0xF8091B48F100D35A, 0x164B646D1430C289, 0x6F1DAAFD517905AE, 0xE0B5CF65391426DA, 
-0x20382906C5427915, 0x7A31386D6D247E79, 0x40A546BA669791DB, 0x4BD5E36E905EA5B2, 
-0x314863E127427701, 0xEAC62DA742F4F743, 0x519D86BC7B9F987B, 0x3287E594557C, 
-0x35853432B698C65B, 0x6DF23240AD5B4E68, 0xB1F301401FED0EEB, 0xA0C0E749A87E6046, 
-0xEBD0F79A58F39D68, 0x20D2863B5F3E5423, 0x1E1A720A51CCC981, 0x4D5AC6F2F607DE5C, 
-0x67E9256C86566701, 0x35B40D6ACBF38688, 0xB719E8E8764B2724, 0x3F86D62346E0, 
-0x34AAF502D1A9E77C, 0x445B83A1BBC8BEA8, 0x2AD0171E35B1ECA4, 0xC259A19AFE15043C, 
-0x6B631CF467A00498, 0xB2B03BA3DFC3E2BC, 0xFABED3373775EC99, 0xEE2419E998342B77, 
-0x217A4A59C439AC03, 0xB3B05ACE646D6221, 0xB6E2AD4902A88173, 0x7A3931FEBC6, 
-0x622104D2C3E59FD4, 0xCC61BEAE4F9C9A75, 0xF184214BB771013E, 0xE87F4D02D7371C54, 
-0xAD583E5E9BE1A36E, 0x6D507870602B8B6, 0x46ADA4E7B0EF1AA6, 0x4EB85169C7390108, 
-0x2D22BC14E1E6E997, 0xC8B87807DEC4F67E, 0x453741EFBD107F68, 0x60DAE2316517, 
-0x22B7B5606ACE9D3C, 0xCCB68257AF32408F, 0x522F4E8FC8ECBFF3, 0xFE3BA3EA07710C7E, 
-0x2C39AAD2B7C1ACE8, 0x4373A44605676763, 0x179D32AA64E786B4, 0xD2BD4D92955D9E66, 
-0xE4B75FA2F481B023, 0x5EC4CE116776C081, 0x1FCA0F9A9AAA6375, 0x195D04376AD6, 
-0x5D2E3F10E75B1324, 0xFB937675D2A21C6C, 0x4142274776509836, 0xCE5273859476DDDD, 
-0x83647388C07A74DA, 0x692C4FED2F6D97AD, 0xF9F05E96630CCA05, 0x76D476C4E7F43C0A, 
-0xA0FF2584FABEB614, 0x5CCE75FC94699927, 0xE7FDD6B8813F65CB, 0x15F008195B18, 
-0x1DBCC45AD343F6A2, 0xC002FECFA18A4B71, 0x1CA33EEAB0A1E074, 0x9A3409E9FB6DDAB7, 
-0x17E0D615418A67F, 0x56072C19895413CB, 0x509AF683AB730741, 0x898FE1B6D25FF491, 
-0xC1874388FD2BD136, 0x2DF5AF037ED64E33, 0x67BB6BEA61252860, 0xFFFEA3E5FA5, 
-0xB7F1407C45EA8569, 0x976328C44629F65F, 0x1F14878FE6BDCD9B, 0xA5F5CDBBC5819B54, 
-0x6949C6C036213486, 0x7CB58662E3E3AA6E, 0x26E8E32510762995, 0x6F21BBA2AABD9F06, 
-0xC6F0BEF18D9FC828, 0xC77CD0E90EDC1307, 0xB167C17A638E794, 0x33578E1D2B64, 
-0xF438EBE1965284E, 0x8637338619EC997D, 0xB07E01AF5F939214, 0xF21D2A1B8133F21C, 
-0x803010C2485ED4, 0xAE28EAE4ED42B8ED, 0xC4B6246642F7F556, 0xF85919F21B650DB2, 
-0x495D64C3C08C17FE, 0x5D292B5615699428, 0xFE143932C7DEEDB0, 0x1A64F4778CC1, 
-0xD6693DABCCE15D6D, 0x94A59897E30EFBAB, 0x89CED6B4CDCFEF9F, 0x5182D05EFE488D25, 
-0xF2D14C75618059F0, 0x3AD162225A75830C, 0x9F49D185FD144239, 0x8221D10E33B4A9AF, 
-0x6C4926DC3EAA4D80, 0x4B9E4160FB4F6B21, 0xA170A48DE30A9368, 0x2052731725A2, 
-0xEEBAA47747E2DC52, 0xB39CCF2BAE8450F5, 0xB5098553F7F06EFD, 0x3BB5463E310F2100, 
-0x8E077797C3582B75, 0x1839C2C412361167, 0x406A2772A5866EE3, 0x8CCA2C6A0E5D23C4, 
-0x4B65057D9C10EB5A, 0xC1D5644772B32731, 0x6D25C760555B2E6C, 0xF8F579BDFB7, 
-0x1B3703174E36A394, 0x4A99AC81271D784E, 0xB6C6AC73191B5A7B, 0x67F2E53F7C094E9B, 
-0xFD603CB64C10D475, 0xE8CD9B171110B528, 0x5E97D99E3F21D97C, 0xDA7C7D011A1B14B0, 
-0x80AFC9ABFE430B1F, 0xA62F38875AACD550, 0x5C6D4BADAF7A064E, 0xA4C635EB4CB, 
-0x2DCA7BEA3843CA58, 0x1AE2144016704CD, 0x308B923E19DDB52B, 0xAA6587EB5ABC571B, 
-0x48ADA308130DAAB6, 0xD891F7024EA5B7D8, 0xFD80F9FC676D0AED, 0x8A5E9A9B44184117, 
-0xD95E9E537C25E90F, 0x262B59A133C2C1A4, 0x127CEF335B20B13A, 0x4B4250013F6F, 
-0xABC8E9B838F6E569, 0xB27028BEA0F69239, 0xFE640E8AEED81C7A, 0x17DEAFCE79A65C0, 
-0xB0DFC0F7D722B10A, 0xD0AFFD90F0C17347, 0x45CD13321AC095CE, 0x5E3CF861C6BB4580, 
-0x717BC6831E334E1F, 0x677FE1A7C346F20D, 0x476DFFA433E17CC4, 0x6FE037E7462, 
-0x666B79F32BD9321E, 0x2A69E5E8A12EF67, 0xFCFB61D335FFD378, 0x3355B9EB9AE86B6, 
-0x5286E07E1B607206, 0xCA6F7A09B0F20260, 0x5FA128B6DBFB6142, 0x7D0345E3BDB55808, 
-0x9D4FE6700B7DB9B3, 0xACC8B6864C7D0A34, 0xBF9A3C57345F983B, 0xF2EF9C02983, 
-0xB4E6B2394B3877A8, 0x990D11F26AD34CF0, 0xE1E80BA1437C8CAC, 0x442C8EC830217772, 
-0xD87494EEC95B6042, 0xA4C552E03950D8CA, 0xADB38E60A5BAB872, 0x8666F2FCAAADBD2, 
-0x780DF340B784EBB9, 0xED16F1371557D799, 0x44F53EA2DCFC91AF, 0x3089E06F3B9, 
-0xDF7BF36ADD94A762, 0xE135218299C6A19A, 0xBCC34E942102F235, 0xAA67373CDDC8CD35, 
-0x1BB3D68AB38AFD6A, 0x5D7A84B9D17C066C, 0x62154D61C7D12665, 0xB7380ED7A6C14254, 
-0xECA8A2804348160A, 0x340C66E4C52549F0, 0x18D23AE206F70B67, 0x3D382FF98676, 
-0xA13BD3E18B1F2327, 0xE69D441EB9CB6561, 0x6266491E09271566, 0xA8E2CA3CFF37FF85, 
-0xB2F0983DBEDD2167, 0xADCF6DB131ED4605, 0xCD3B9B04F49A1984, 0x9D66DF6103C2BF10, 
-0x5FAD438D23E01ED2, 0xAA4F76B98D112700, 0x4289A069B828C47A, 0x3BF5DA0A8C9B, 
-0xAE7DF24286C42D, 0xC1845C1CEF9F340D, 0xDBC1032D0C353026, 0x5A55FE2132E2D6ED, 
-0xF9E5DF3C1C028580, 0x22A68CB2FEC282AA, 0x5BC4CCF3BC4A6B53, 0x9CDEBFA3477F1843, 
-0xF279D3D028FD855F, 0xF74494565B6BF86D, 0xAD5F4E97D1EFEEB5, 0x37CAD5823A49, 
-0x9E845EAC1B5C5358, 0x5CEC16229C41A5FF, 0xAA031AEB23CE9ED8, 0x92F91C260C2FC85F, 
-0x65C078AD5F5E6B0C, 0xE330F53A2EB28A67, 0x53F066B871A20D47, 0xCABE0C1DF886E5CF, 
-0xADE7B2FB21067E2E, 0xB60BB689296426A2, 0xBFB2BAB8645FA091, 0x19021C793823, 
-0xA15419F0D36BC853, 0x8941F251A760DBB2, 0x2C9A65F91A3268F8, 0x3571A4992D55A7FF, 
-0xF763B542177F1884, 0x8DA9068FB5B554F2, 0x626AF61BAE14697, 0x99639E214E6F8E7A, 
-0xAC5E6EC1DBB38E4E, 0x7F35BF5732435633, 0x79E550FE333D130, 0x5272E78152F, 
-0x9D14F96580F707C, 0xC5A2019E56D87FF1, 0xE768A8DCDFFEEA3C, 0x2A7A64ACE49B57E1, 
-0x4373438B76C8BCC4, 0x87C4A30D34A2BB7B, 0x558AAA7843B435A8, 0xA6AD200CDA1C1DAE, 
-0xABD3F0F13061E27, 0xFA25DEF80ACA3588, 0x62A40B012BA13776, 0x3BBCAF733E65, 
-0x675DB693D684B1AF, 0xEAF252E185316A12, 0x7910DF94909E5B13, 0x429803A8DED46FFE, 
-0x454D597ADF62F4D9, 0x6C26B44FCD9F17F6, 0xE021F228EAF95C57, 0x4881B535FB59940A, 
-0x254307BE9F2AA176, 0x69B85E32F0F24121, 0xA5E2CED81632E63F, 0x3F99139A1EC5, 
-0x3444D1A6B4099CB6, 0x3D5F404B487996BA, 0x6023D7D2958CD968, 0xC3EDA0C8B609DD08, 
-0x5F66725C52DCEC0, 0x3A91926881956964, 0x1B091FB70E529BD3, 0x1524E82C76CC3CE4, 
-0xE4D1534CB2B831F1, 0x2D11EBEE30D9AF83, 0xB827973E68E3C187, 0x454FC92A04C9, 
-0xED5711DEAA044EAC, 0xB97911A4649D088A, 0x851B17123FC11CA2, 0x262DB71807B80131, 
-0x3312DF97464BCA23, 0x4A8473A0B4D858E6, 0xC21073E95AA29535, 0x9455EE4D2E7CF1FC, 
-0x457FB0359E0E6522, 0xD5D10E17D51D61ED, 0xCCE5591809EB3515, 0x3DC806C3DF56, 
-0xB9CFBFCED8E60A77, 0x7B9A5DC805AB0248, 0xF4CCF9E41F5F4461, 0x55E76F4882BEF149, 
-0xF1EC1A602B2FB6A9, 0xB814A1D8B85257A2, 0x9C5D9085BB9EF681, 0x54F8C2855EDFFAE3, 
-0xA91F5C317AED4DB2, 0x1E723D5972F8F6B5, 0x8AE25CC8086D6520, 0x4C8DF112D5E6, 
-0xC6CAA597D25B315B, 0x23AB1D6CB132C96A, 0x5AC33A36A13ADA41, 0x7337F24A4870230E, 
-0x5897F52FD63E967C, 0xBD55DEB0C4AF9F17, 0xD3A247AE99E78FDA, 0x11B991265F753D92, 
-0xDF31B3003E59BF20, 0x42FFD84E49F2F58D, 0x6FD2FC0B20B7FE0, 0x285C6FA6693F, 
-0xE629D4ADB4945C77, 0xEAEC0D3FC9C1BD84, 0xCE5718727AE44E9D, 0xE8D2D82591B3AADA, 
-0xA669B81D6179CA23, 0x97F91AECD984E70E, 0xDF42A60F3BCDC867, 0x5EB02CC0797F2B8, 
-0x6F4142DEF1B760F0, 0x70A272E386A2F26A, 0xA7E886709BA38498, 0x306DC04FCAFE, 
-0xF1D5AC6F09C8EA4E, 0xC0B1C7F251AFDD7C, 0x93761CE1745DBA5C, 0xAA27EF4C7A6CBEFD, 
-0x61F94850C2C490AD, 0x32D55908673D061B, 0x532CAEDA152F60EE, 0x2F70EEAECF3CFB46, 
-0x66300A4951986F59, 0x906732FFE2B89D87, 0xD20E2EEB20C42AC, 0xB033C43326A, 
-0x623FC7C40F5D35B4, 0x2D6B1E55EB2316F3, 0x7AD3A88F414A4091, 0xA61CC91772636369, 
-0xB518BE3270A84D38, 0x9A5A0CFE2015C683, 0x3A2AE7E719E9A4BA, 0x42764CDDE5178957, 
-0xAFE5473A83D48990, 0x894F0D8BD9E6D8DA, 0xC3FC061C8DBDCA17, 0x4543D8AE6698, 
-0x25DB3B14E629844F, 0x9FB78943D4CC740, 0x45FE51BBFFDAA88F, 0x7348160B51B2D390, 
-0xAC54DC866DC9C268, 0x7B88B0960BA79BB7, 0x73606D6D1EEE6907, 0xD0C286E9B58B8CAC, 
-0xF6B386CB3D35D668, 0x9F382E1DC3D8B43A, 0x1FB9E33A3E5F9B2A, 0x5796E6932A13, 
-0x3B7EBFF316F547CF, 0x4ABF6D41605D7FFB, 0x2687B188845CC6A3, 0x90FA1CEEB33DA532, 
-0x885E2E4D34B4577B, 0x65EBB835CA02233D, 0x2C0CE9CB5EA947A5, 0x38C8FB3374C9AD9A, 
-0x1882F7347952469, 0xFCEAFFA74B59D253, 0x71E1CF4FA4A6EEC8, 0x188802814F25, 
-0xA0C2C814ADE4D91E, 0xA7A5DBB027B96B31, 0x214A4B9E823746C3, 0x8888BCB73B2527DC, 
-0xA2F2B092F8CB11B0, 0x89F0A7653E5ACEBF, 0x8BC11D1801E981BA, 0x22CC4EF5A3D50ACC, 
-0x294B27DCFA91CCC1, 0x33D3793E7ABC05C0, 0xF6E6CD6DBA1FAF07, 0x4B98357AA8F4, 
-0x251DBB30CE806B1E, 0x913BAD004058074F, 0x34402F8807E58E7E, 0x5FC79786318CDC77, 
-0x61A3070B831D7811, 0x482CDBF3D1AB2629, 0xB811A33A9CCF7228, 0x6F5B118090B259DE, 
-0x2558B3297E007384, 0xBA53BACAFCD6031A, 0x2D2E11DA11843849, 0x5671832C38B6, 
-0x526AA7EA73D9701F, 0xEAA459D850C96788, 0xEA5BF35FDADB84A0, 0xFB499531687A23A2, 
-0xCF1DAC9B72EC7F18, 0x89743E9D05E485B1, 0x3B3A5495E28FDA6F, 0xD8F2B63074410F7A, 
-0x2E371418BD32E8AC, 0xC57C661BA1D4967C, 0x77F5FCD457B53A89, 0x52D8A1DF53E, 
-0xAD74F3545870F615, 0x85BFFA53FEDC63A7, 0x68C21E3D7F7AFCFB, 0x4E4396E2EB99CA54, 
-0x614F48E64DD5AB46, 0x6F87469CB04A164F, 0xAEB3C7868A7021E8, 0xF386AE18795E7CA6, 
-0x61C6AE0F1A02A3EA, 0x8648AC56DBB0DF16, 0x48A51A644A32E738, 0x5B3326B3BA15, 
-0xDFA6679BD7FC4EDF, 0xA72561101D14A7D9, 0x3AB57C28377D673E, 0x3707F43766E584DB, 
-0x93B17CB6310E5DDE, 0xBCD2AA95365FBE8B, 0x679B7D0C02A1BB9F, 0x572D9A17483D9D1E, 
-0xCBD6CFA5C4CDD1AC, 0xDDB23D63812F60ED, 0x8CC10A1DC56EB62A, 0x2C340A45BD35, 
-0x4D3A80E24E89B6B1, 0xCF19A4E19383F0F2, 0x40188B13B36197DF, 0xA87CDE9D083E326D, 
-0x25C412E32866262F, 0xF2D5AEBBE0E99F57, 0xAC459256F367B6F8, 0xAC12441211A2638A, 
-0x976C380F271F9722, 0x499EB580602DE2E, 0x841FFA48296E16C6, 0xFADC2701C09, 
-0x35A120BE13BB4C11, 0xF3D6C1F924010A58, 0x772155E01CA67183, 0x14B637B57CCBC012, 
-0x3E408A44A643A2B4, 0x3FEB159D52127588, 0xF9AC9189E16A4742, 0xC4C75C314C0B530B, 
-0x3FE04DAD3D58BDF3, 0x3CF7C6DE108BE574, 0xD28C6C2B3A203622, 0x5044FCC0539A, 
-0xC5EA59100DD5EC4E, 0xE709E79393E6F349, 0x6D95A950549CA063, 0x8C822BE1220E7A44, 
-0xB1F4B4CF36E0E910, 0x9F677F46FB750C2D, 0x7EC9C22280385064, 0xA192397DD29730F8, 
-0xB9DB2B6EE170C571, 0xDD47C21BF4C7904A, 0x22FCD27063F5EF8C, 0x2D624B2002C0, 
-0x90F1466717F4D222, 0x9B6E77B32CB84B3A, 0x2584F91008BE265C, 0xA6A184C47BAA27ED, 
-0xE972FA11517A77B6, 0x56638B6E2CC9BEC9, 0x76BE98C7D0395E46, 0x2FADC463402F0FA7, 
-0xF121CF28296EF9B6, 0xE93009B480EFB1E, 0xFDF4AF5FDE7346F3, 0x4AEEB285B8FF, 
-0x7ED54E50F258DA81, 0x3BAA66A1E177E704, 0xF8F42D125389D478, 0x14C40E3565C380ED, 
-0x72560A4E6EA5FC18, 0x3DD5A3F8ED6F42A8, 0x28B0BFB268C991CA, 0xBCA719F004014527, 
-0x98BAF5C27D9CE09F, 0x1548CA3D83806D84, 0x9F43E1876FB03400, 0xFA9B5BC35E3, 
-0x49EC1B3DEAFBABF, 0x9D773A9E7DAA3E6C, 0x7F687F3C2E277E0B, 0x5DFB7CFDBEF9508D, 
-0x25E7CAAAC4C4FC4F, 0x7D4DBEBC055D1A6E, 0x7ABC74FB6D618A79, 0x1BA8E871972CE279, 
-0x7D08404E76F005BE, 0x2A799CD37D0D7497, 0x4A5EF33C6C77E59D, 0x38DE8D8D813C, 
-0x49166DA9CD8B71C0, 0xC79C96F35B1582A5, 0xFF202DE4F14C7BEF, 0xFCBD2FEBDFE8334C, 
-0xB409822307906AA7, 0xA39F871F18090881, 0xF1DB3F586EEE076D, 0x4CD5F0DB78C05D15, 
-0x61FAD7CB84B54F83, 0xAF8EAD2FCC3A356E, 0x9016E7E362DCA734, 0x51D2567D0CDC, 
-0xB7F50E5A5E0B406C, 0x6FB22BE8CA68E941, 0x2FE78899EC68153A, 0xC2952CA8BF7BDE8C, 
-0x9AB36AECD51211E8, 0x4AC09EAD1B1361B4, 0xA07008BBEA0DBCAB, 0x49756BFDE439414D, 
-0x604D4B75EBF3D3FF, 0xDA94C3CB8EC3E9EB, 0xE51623EDC6904A71, 0x693D25931553, 
-0xACB29B4BBC96D7AB, 0xC01DFF617A56A9C, 0xB300A0DA3D623235, 0xAF0866AB9129D93F, 
-0xA389941C649A54F4, 0x69E153BA301C3910, 0xF1D4DB31E902283D, 0x1A0373796175DA4F, 
-0x3AC0575800B661C5, 0x40AD099A5F4BF208, 0x9D997A3CE34395B5, 0x4B68FB961CD4, 
-0x84D04303C97403D2, 0xB0EA5C8DEF55FC68, 0xD237F434C37C2F7A, 0x4063F6B43DE7A05C, 
-0x2F1E4FF15E945B5C, 0x6F57E11DCDD809B7, 0x5E4EE22C616DFE97, 0x80ED6F4A993E31E, 
-0xA72C046B6F530DF6, 0xD3AB08F8A58567E9, 0xD61D8B51B5A0BB69, 0x251CC43D8DDE, 
-0xADA5D1B22D6E58C5, 0x7A373E94D0855B75, 0xBDAC2FAE54B27E57, 0x593555028749E0D3, 
-0xAC1EF8B5CB03ECC3, 0xDBBF6B0DE9BA20DF, 0x9EB14961EA468539, 0x3D0333657CD8ACFC, 
-0x40412B2A4B5D142C, 0xA5F3FD68910B709, 0xBA4ED620C5EF32D2, 0x53826520D7BF, 
-0x1941C7E3EA2299E2, 0x36F3B3BBD92708ED, 0xF2BA350DF40D57F1, 0xA4A40A4521A69EF6, 
-0x1675D750CAD23197, 0xE6D4AA94402C77CE, 0x7C919D103613470A, 0x4051B52B8580B95C, 
-0x4F4F7669057202E9, 0x9CFE1D0B3BA7AF58, 0xE9B8CAAD2CF4A35B, 0x3CCEDC8CA4E7, 
-0x4BF08DCD0E07B000, 0xC31119FEE083FF6F, 0xF6E5069C2535EBF3, 0x6E99E25F72FCE97C, 
-0xEF47E7CEA942D648, 0x10E449B0D9E3B126, 0x4A5ECC88FDA2EC23, 0x9DADB7ACE6BCE4B9, 
-0x72CF1574CEAAA6CE, 0xC757706B320E04FE, 0xD3E2532684DB673B, 0x456CEC02E913, 
-0x9DA9EF9A08A9F45C, 0x9DD2F75105150BF, 0x14574CBA104B4AD8, 0xBA16B8116E9EF3EF, 
-0x5344EBCB004C928B, 0x6E661018B8073DF8, 0x534FE7DE8E373028, 0xA655D7CE7A06F256, 
-0xCC1FD68250D5FB63, 0xAD1653D431C812B0, 0xF7256469823AF8E6, 0x1BB14A6EC0EF, 
-0xDA2C8BBB5EA3363B, 0xC3489D08D0F83A41, 0xD0DED0725843CD7D, 0x24354B56D6C88832, 
-0xE7DF49FC43BC19EE, 0x8DAE32B129ADC02B, 0x2E8637129F704C7B, 0x6DEF6DF8649D644E, 
-0x2840195151E639FA, 0xD7C8EFCE06865016, 0x63401D67869B2096, 0x587E8739471D, 
-0xFDE548982E3F48DB, 0x7D384A642FBF7D47, 0xE10272EE50B19A81, 0x97C0BE0D095618C8, 
-0xB0C81013E8A7DEC1, 0xB4E46C628533586D, 0x646D0820D3C836BC, 0xF0D0B03C35F61B02, 
-0xCEEC9DA4577EC628, 0xE3CCFD9FA9D969F5, 0x5C1EE02698A9B8DE, 0x6AF903B74AD6, 
-0x9C145DF53885B683, 0x76419C2C31488AB7, 0x7A71297E24CA807E, 0x6C842B7C3B79C8CF, 
-0xCA3BE614CAFEB8B0, 0xBA80989AAE3291EA, 0x585B64F197B8A44D, 0xBA8B02C52576683E, 
-0x8D6CCEA5606173A, 0x7A9993506965B485, 0x216484290EB092FE, 0x338729A7B2B3, 
-0xE40C6D452A9AB1BF, 0x531787A812182AF7, 0x211FF437412610C4, 0xE8FF132EA009490D, 
-0x870A5D38A72BF944, 0xE2DF1BE41D0EE36C, 0xD654AEA025305A61, 0xAF936F8142766BE4, 
-0xF10CAC7AB6326E03, 0xF6EE1F19C58BD5F, 0x7C83C942C8911B0A, 0x598B3D2CB42A, 
-0xE6F107877648AE3F, 0xB9ADDF6DB48E898E, 0x50AE3C7ECA187F98, 0xA206900F908E475B, 
-0x20973BBC8423091D, 0xD9C0CCDBF536C379, 0x6807F43E58230B39, 0x1B8DA5B8F9B7783, 
-0x8EF388E102345C2F, 0x2200AF61EAD9EA45, 0x79BBA0D29188AB47, 0x406A4E001A97, 
-0xE2C7F5DF19F2A00D, 0xC6F96078EAD43607, 0x8782923662CDF6E4, 0x63C29AA976C39E6B, 
-0xE974565276D59E47, 0xB5ED716ABDD9EE17, 0xB6A84CC045907AA4, 0xCBC06C8826FA346E, 
-0xD3285224E3621A51, 0x717203649C0E962F, 0x945F50429363303E, 0x604651F4FE7F, 
-0x2B301135A0B5FD64, 0x2EAB21E72FD247D3, 0x6B569BD7C04D67E9, 0xE43872EC33AE3C4F, 
-0x78CF283C3CD1798B, 0xE0C77ABB9BA99C8, 0x75D62C11036A1264, 0xBDF9A5C99BA53B1E, 
-0xD034FCEF3DA4210A, 0x400A16708A23120E, 0xC3D4136D3D70F0C, 0x22048278AAE7, 
-0x49AE0A28EC988CB4, 0x6211FFB91F4E92F9, 0x1F764E0FB68BE22F, 0x30B5AF1105BC0EC6, 
-0xD338BC2C87CE3666, 0x7D69408478514E87, 0xC2E7760AC0F8CB38, 0xD79A5559D8392AA7, 
-0x796CD181CAFAEF23, 0x9BE045F2B6860CD4, 0xCC3E0E34AFB96B04, 0x42AB6B68DFAA, 
-0x64FDEEAB0045ADD2, 0x8A9623FF15706840, 0x955F59610A3DA2D1, 0xEA806BF416FFDB87, 
-0x8C9C3F9032B022D9, 0x8D7EFB88C5707507, 0x92E2ACFE972D6078, 0xCF5E585D4C0A2050, 
-0xA87B0DDDAAD1AC30, 0x7B5924E5F8EFA3BD, 0xEDD77EDB45937E24, 0x160081F9153E, 
-0xF9A3D8E541DF78C7, 0xEC70E66ACB771496, 0x70FBB86E994F3EAD, 0x8993DE93CE00C7A2, 
-0xBF5F39D6A304B5CF, 0x941102EBEF77514E, 0xF85C81EF32E8493F, 0xA0B0D2A7361AC885, 
-0x94A7CD0F19AE81BE, 0x5C9CE6C907D1E85B, 0x261A9887BA73314, 0x2C6AB694AD84, 
-0xCC55AE3917BE7A73, 0xF76D79A587740223, 0x651A5149FB47372, 0xCB128801599E0332, 
-0xF3317333A2ADA67D, 0x3A08E18EE4B5265D, 0xB3F1005E190974B1, 0xCBA709EB54BCBC5E, 
-0x3405D81ADCD22EA6, 0xDAE1AFA60EF66188, 0xDF8E63134511C836, 0x5F81F483879B, 
-0xC56E5633CACF12C2, 0xEA69E34F8058B253, 0x55333AB738523D4F, 0x44A28321D859CCA4, 
-0xC4741E48BB59FF39, 0x3327CD9FFB261ED8, 0xD2B95751F81D9D8B, 0xF4DD16458EED3693, 
-0xA63CF733D5B7B389, 0xEDFCF4130D5D1506, 0x471BF4E5FC9F1295, 0x5843E8930C68, 
-0xF44BF19873F90A0B, 0xC71B7F6C6DF12E94, 0x1379B61B36FB2810, 0x444DEF8F04FCB979, 
-0xE45E9A433E8B521C, 0x6255F9E0D7B0D77B, 0x82445A6AAF7BE7E2, 0xCAB5DC2866EF3EAE, 
-0x562336E117F2527A, 0x56CE4D9C49C71C44, 0x2EF0BA18BC5B293D, 0x4A141CF17A3E, 
-0x945A64A963A76EA9, 0xA90DA9422E78E140, 0x9A7E9DD4B5B09EB5, 0xE27178DDD4347D0E, 
-0xA9339BD6311802E7, 0x3D28947F12B3AE02, 0x4476D8D452EF27DC, 0x3274978B5A12768A, 
-0xE6F2B009145BB869, 0x203993F1549C13A, 0xE6C4C8E16D5F2886, 0xEDCEE49F658, 
-0x9B66044FE02FC64F, 0xF6B61734BF44BFEF, 0x9A76936ADAF5A86C, 0x52C9707CE8F3F0B2, 
-0x228A4631C3FEFB84, 0xF4A4A34CE6C5014, 0x7304A17BD9AF08C1, 0x84BC84D6742475CA, 
-0xBD3338776D372A3C, 0x543E8CAE36242340, 0xBA189CF1A368C08F, 0x59C178AD4422, 
-0x2992C73FB7455EF2, 0x8708D88228883E82, 0x96B86E2F6CC618DA, 0x76061C5BCAA42928, 
-0x6AEB35D677E0CA37, 0x3F922EB6CAFE9108, 0x7FFF9991040E4E35, 0xB0415FC059399B39, 
-0x6BA793E4FF1EA16C, 0xF09B6E2FA9FB18BE, 0x4857BE39690CC559, 0x52C6AED21C91, 
-0x5954076288FCF52B, 0x4A16E463126FF1FB, 0x9669044B95567C86, 0x320D144DC703AF3C, 
-0x546B7F1DE099E2C2, 0x3A9CDAA9D165ECD3, 0xD073E6431957972D, 0x2A353BB41BA6C32B, 
-0xE8D206C44CF1CDBB, 0x6DD6528975E1427F, 0xFF2097CEE14C7DBC, 0x5CD777F09D09, 
-0xB5334245F8D630D0, 0x14443280A700CB82, 0x669C23E505DA076F, 0x63492A318B49DCD9, 
-0xF83496241E141A20, 0x199119ED1BE0EE5B, 0xA215F61B29FA09C2, 0x6D0B74D4718763FC, 
-0xF1606A2818F195A4, 0x4394575FD1B2060A, 0xA41EFD448A00F19F, 0x7171F28458F, 
-0xA48B35DC967CCE0B, 0xEC721A8E0434ED3A, 0xC394ABB4407417BC, 0x1B77CABED655F35A, 
-0x47DB04B1659C23E8, 0x53C0D0F448E4093B, 0x6ECE70F42DFBA570, 0x4F0F65D0198A778D, 
-0x23BBE640B24D30F1, 0xEB1977CE11BDA0CE, 0xF0237E34BBA98D24, 0x6F128A89E156, 
-0x8693ED2358492C9E, 0x86E7ADA7CD6C747, 0x9A7F6AFC197DF52F, 0x764FB8308CF590AD, 
-0x654A5ACEC3B8E497, 0x2B24CF58B6ACFFD0, 0xC19F8625EFBCDF7E, 0x5268754B1BEF3348, 
-0x23B5D9C5E88C40A, 0x4B40836BADEE8E3E, 0xDBC92ABA14EEB5A6, 0x3F3657BCA9CB, 
-0x51D55BE908C0FC20, 0x68EB810C0FEC769A, 0x822669571F93C810, 0xB0DD1795BF9DE8C1, 
-0xBE531844CBA15E7F, 0x3507606E71A0B964, 0xD7BCC0C1AE64B4DA, 0x937DC9923F961DF0, 
-0xADC746319109F998, 0x355FCF917B41D5D7, 0x70858BA6DEB65D4, 0x3777CF71C5F8, 
-0x51EC928D8495330F, 0xC8AFD96F1B90F9A6, 0x896682D27D7F0603, 0x6158C76108F328B3, 
-0xF4BB77FEC2A2A4CD, 0xFE369AD7CCA49019, 0xADCB8D295A6295EB, 0x7ECE67FBD1727DCB, 
-0x19D85A6F7C406F1D, 0x400C52156780BCC1, 0xDC2BBD45C788E7CF, 0x115D0108FE3D, 
-0x2977244E97B23350, 0xE09392BAFD2A78A9, 0x2349FF5FEC0E4A44, 0x1B809B7F18E40D78, 
-0x7FA3F90DF9A8A08B, 0x7BC7DED045A50511, 0xF1714B294A1AC8B5, 0x6C7002D6F0E2D2D3, 
-0xEE2A3F6D2493F3DE, 0x15C320CEF4EE4811, 0xD88A9C6053B68983, 0x16F0A7B0CBE, 
-0xA72A42FB464ACE2, 0x72F3C5B2C2C3E985, 0x3BF96FCDEF5BAC5C, 0xA28A32775791104E, 
-0x56E398FED35F667E, 0xB2B1C78D20512197, 0xAD7D22373BE35B7F, 0x3E86A50099A8F2ED, 
-0xE88448169CD28D39, 0xA86C50419050A442, 0xD182297A2379E313, 0x1449E3711059, 
-0x287D1EB32E024275, 0xFC589F64282EE229, 0xCED5D1F4C5962776, 0xC6EF3235644624BE, 
-0xA8DD51FAC3E0AF4D, 0x8F1DAB3E110258BE, 0x8DA83242EA24D6A2, 0xC0A33FD53930C5B, 
-0xF2661D2BEF46EEC4, 0xDCD6CB8E49BE81DC, 0x960237E89350E97B, 0x36C43574DDB1, 
-0xD8C2E75C1FAC671E, 0x9C14EA8EBE1FD33D, 0x64E4A852C12061CF, 0x7F04D0CF532DE1D7, 
-0x2F3EB43B4B6BEC42, 0xF72C1BD0F3620E23, 0xB3264D35654604E6, 0x3C6FC0665705059F, 
-0x13D9233F4304CB98, 0xC2C42F54CBCB0880, 0xB44A36E578E884AF, 0x25DB35DDD8B7, 
-0x9DC1C12BC2038AE9, 0xDAE7B42E6C3F9BD2, 0x997ADB902C54695B, 0x86A6BD45A5B24127, 
-0xF10790CB73A9BFFE, 0x77EE51848F497A1A, 0xBA1BEC63BA993E6, 0x4A91CD84A9055D1D, 
-0x92035729B1B8B35, 0x1F29F5DBC1DA191C, 0x3BF483DCD9D6108A, 0x3A305F2F670D, 
-0xE8B53D22015E8888, 0x488824594D4FA28D, 0xB8D2477CA5E9870B, 0xA37115A5D5784ADB, 
-0x9FAA23E2EC729290, 0xCAA2CC374C950792, 0x52788296FF00EBE9, 0xD44E0CCF2EEE4286, 
-0x36A454BA9D036AFA, 0x84C250A7A6A9A8F5, 0xD1CCA96A4E3CFA63, 0x3170E01EE824, 
-0xA8F1C80150D8C08, 0x203A408AC4887CA7, 0xF0A4CEA91081DC5E, 0x13A6E1FCE7B83E69, 
-0xD1197DE1338E3DD7, 0x89120245C010410D, 0xD4FA4E77C1ACD244, 0x2EF39DAE70F803E3, 
-0xFD3134D0B71192D, 0xCA7CCD09CB5782F7, 0x2F8ACD7CB4C3E930, 0x59C4714B36EC, 
-0xA1322EF0ADEFFB1D, 0x58B475B17EC4BC7D, 0xE13016825C6A5A0, 0x3289A6773796D3E1, 
-0x917189B6113F1501, 0xBE62FF0D941D89BD, 0xAA298EE582685D58, 0x3B7A063F6B30CC77, 
-0x82F73A6D9A2955B5, 0x73181387737387FD, 0xC16E37BAE068273C, 0x142D0B911D3E, 
-0x510187E0379CB417, 0x758708A247A1FCEA, 0xA64C6E25B28040F6, 0x44CA2C38324F6311, 
-0x51236C8DDD93A24, 0x3B8C97ED6CF9E968, 0x3D5BEAF516EF27DD, 0x9610734BE81B3266, 
-0x8345A10C337C93E9, 0xE12B595307C2C421, 0x2192C35B2A0B23C6, 0x456E59571C96, 
-0x46333F3E14445B66, 0xA3B0AA56C937EC76, 0x9039EB70CDC454A8, 0x2A64675F41CBCADE, 
-0xF17FC8B6F394E1C3, 0xED65ACA756BA3E2D, 0x69CD15E5D0A7ADA9, 0xA349E384BEBE0B37, 
-0x75ABBDFA05DD233F, 0x1226DF0C3A58F1F4, 0xB91A8281C8EA2C60, 0x33B9583CEE88, 
-0x513C831571004D32, 0xB67CB682E0BB4D54, 0xBBE6BCF22788C1E5, 0xA0C0D54151C6A503, 
-0xDBD0373F91729A36, 0x351355ADEB7EF85D, 0xF149AF93BDEDE26, 0xD3B5917ABD7E73E5, 
-0x9AC9BA65101BB0E3, 0xA11CEAC811E10733, 0xD3319B3CC09FA1B7, 0x27B041C0549, 
-0x6DF4636CED40BF75, 0xE8ED0002EC4179B3, 0x885F20C98B64D813, 0xBCE600F598372330, 
-0xC98744C4552540FB, 0xD03307B73F583A74, 0xFDB1626B795AA6AB, 0xFD86E80C3052AA4C, 
-0x1EB3249A282B7548, 0x3BC44E7C1703E7CF, 0xE16659D43C6C3F21, 0x5247079B5A83, 
-0xC7E08D1AAE1FE2A4, 0x9A1F2E2A9F48EC86, 0xD4FDFD77DBBDF6E3, 0xE64DA65F10E95336, 
-0xC7EB127CEF0E5B2E, 0x3F78A9F569C33DBB, 0xAC44F53029A025F7, 0x1A7EF3B1DBDD092B, 
-0x56E0A1FDA733B0A7, 0xF4D434E8629FAFFC, 0x9BFBBE621A594C9E, 0xA187B50C2FB, 
-0xC15E477263D841D0, 0xC1C9148C6F1589EB, 0xC08EB7AB0F550685, 0xFC58166722BBCE74, 
-0x5D78846BE399B2CB, 0x1905F6C94685992C, 0x7517B8C917A93BF, 0xD97459CE44B53A59, 
-0xC734367E17A7FEAC, 0x54966CC5C9C32724, 0x8A90D464EA0FE698, 0x59FF88A3A3E0, 
-0x9F773D2E7591FA76, 0x53B11ACEEB5491B5, 0xC567E40F5B4DD637, 0x9B92D9B914727834, 
-0x72623F8A496E179B, 0x2056C056C5BC284, 0x1EF1704447F8614B, 0x93E941BD3690670F, 
-0xE8A92D6BBFC88C36, 0x43E761C93D74B128, 0x58B1A85DFBCA698C, 0x2D9E230A1CB9, 
-0x7922506667EAA201, 0xE8B85C7AE7B23B6E, 0x60B00B0D4BD674D8, 0xA0D7FB2B0EC23627, 
-0x1E3075B4A070A992, 0x67F0E853AA27321, 0x47DFC0D14ACE6A7F, 0xC638A1C6F6368030, 
-0x84D7AE1473FCBD9D, 0x60031981C97DA150, 0xC40E901473C37D60, 0x4960128EFE97, 
-0x422D030F3E9C3A79, 0x4FE0CECED8598531, 0x9EB6044477426191, 0xA8AB70AABA11E567, 
-0x4410A85AD2B20C1F, 0xB2BB4AF2E1BDDDDC, 0x95E0D6D7B891D366, 0xF9248AE5D7CCC7CC, 
-0x71025FDE4FE563A1, 0xB6C8EC194DA129A2, 0x7CDC049752ACB74D, 0x302E09660579, 
-0xEED5B5388174BA7E, 0xDCCCB9330342767A, 0xC4C7BAE09F3717EB, 0x29A3640B957D668C, 
-0x7F874C803A00623F, 0x86AFE148820F80D2, 0xFDE14E05571CF987, 0x1608142CD713331B, 
-0x6E87FEF49EB8AF82, 0xD5A9ED897B74C2F, 0xF8BB71FEE061228F, 0x5F13E1CD120C, 
-0x35772C4A3AC3CD0F, 0x337A2BFC0DB6E403, 0xAC8F8DF1FAE0AA33, 0xD1B9F9677AD43E7A, 
-0x1526A6B6892A8A73, 0xE4755D74234FDA77, 0x158B04DADC5361A1, 0xEADA81D31644F9B7, 
-0xF5AE1EA680A923FD, 0xB166D8FB8AD15265, 0xEC8BF906A857565, 0x6CF3D067F5E0, 
-0xB3B3B2DBFF154B95, 0x513EDB8C10D8BB82, 0x1C87612ABF17C0AE, 0xCD8DB5F4D0399371, 
-0xDD6BB11183F0CA90, 0x1D970E3106BCEDF9, 0xFC1118D4CECF39A, 0x16B980DB0260766E, 
-0x281D8D6608BD2720, 0xF1DCE44E6B64FADE, 0xCEE38FCE4203080F, 0x651EE494296A, 
-0xB7F29A9D1108356F, 0xBF85C6FC9CCEDE4D, 0x160369B1C9B8AE05, 0x31AD14E432AA6599, 
-0x495FDE14463B846A, 0xDA89D2D25F32A8BC, 0x86EBB91EED16690C, 0x31C1E4345D5F80AF, 
-0x873ADDE7045526FB, 0x8991AF4BF02CB59A, 0x688E73F5BE856F4A, 0x3C750E5D717E, 
-0x13499614B83610BE, 0x6A4D90BA40FC9E30, 0x5A3F14A563790D78, 0xD8D2CBC2B03FA24F, 
-0x64B7C23A2D2C7E5F, 0xE259ED380579295, 0x59BE927D7F9A653D, 0x943DE49F397155BC, 
-0x3BF0375F1F670EF7, 0xE749AC5897298E23, 0x369CDCECC6816FAB, 0x10113B2EA50B, 
-0xFF2C7EB36488DB1C, 0x401E26CD8A892FB9, 0x569CAB5F815B8F0E, 0xE444A7489E0EF73F, 
-0x1E97A53C67FC24C1, 0x9A0FDB096F021F0E, 0xF97EDEFAF6A548F8, 0x3620A7439808BBB0, 
-0xA0A820FA0DF11F24, 0x55928E241B1E2C38, 0x9030A0361913A83B, 0x5068D72330F7, 
-0x3054F1A9CB2FE6B1, 0x7C1353B82D1BA55, 0xF4C49CB2E86B618E, 0xC797627F0DC1A277, 
-0xAE45720FC198C045, 0x622E043659A278D7, 0xEA5D23A15AFD0EB9, 0xF8B3F8F59C9FB5F4, 
-0x8FDC7ACD5B85391D, 0xF01275EC378E3CD6, 0x9388E86A75DC3E51, 0x52AE519D054F, 
-0x79FF9B8FD5AE9E8A, 0x828497B5B4224D2F, 0x7D57A4726072F9CC, 0xD1860EB854A7E70A, 
-0xBFC6C39AE3EFD9DF, 0x332EE98FEE3632FC, 0x310E3BFDEA09A847, 0x606BE16900C32AD0, 
-0xD8A93E62CB2CF510, 0x20F12F6405EE78EC, 0x457C804F6F1116DB, 0x53426306A7C, 
-0x8A7278F3CF538AE1, 0xCE9B1FEC967C616, 0x3375E38DBC1B04D0, 0x49DADFA9AF5BD413, 
-0x51F909F676EEE6F2, 0xFBA28126BE8B3ED7, 0x5D4A0173A79A732B, 0x79FCB4582F3E69C8, 
-0xE22E5B103BD0FD54, 0xBE5A3DC1B40D5CCE, 0xC02F741E758BFE09, 0x6EDCDA7D4F9B, 
-0x1C32D07D38926669, 0x6593FAF7FF70CB9D, 0x4BD53C3689A635BA, 0xD198C05F4F035C99, 
-0x6FA06D6DD8F11647, 0x5F40161C1FF5F5EE, 0x13D99506567A64CB, 0x149195BCC00110B1, 
-0xC83258479DB9B230, 0x50B2EC6C7B1899D4, 0xD5670C264AACD3C5, 0x24DB43778FD3, 
-0x1A947F88921D83D2, 0x4718C3BD88CDBA06, 0x890EBD7BD40E05D9, 0x400E986A646908B0, 
-0xC816117B66E670B4, 0x6FEDDB4C683EBA73, 0x2E89C27C741C95B8, 0x4D7B6EE0DC394C37, 
-0x10570DFD4A04C281, 0xC55F4A809794B1C8, 0x43A289EA03D68ED0, 0x1F28BC27F548, 
-0x4EC5CADDEC270D87, 0x4516172305A7E495, 0xF29C5EC3739827A4, 0xB07298D013D60893, 
-0x24A69A390445CE5C, 0xB6E78B16EB29F7EC, 0xB28A0921960CE289, 0xDCE38ECE2A31C03E, 
-0x50BAF5B312F1B21F, 0x873855F5FA111D78, 0x58714EBA73FC153D, 0x371424B272C3, 
-0xE60E4CF81D4B55D3, 0x9515CAA5C52102AA, 0x14D9DE73FF19E47, 0x4490D9DF4CE4E3E0, 
-0x4DE2B962F0A4EA43, 0x98A0B2BEFFC541DD, 0xA26F15E62D969841, 0x65B9140255EF03EC, 
-0xA3857596EBE142D9, 0xE3BA6C02A86FBD2, 0x388209FA99C66D1E, 0x1E9818AB6468, 
-0x76756E8197198AAB, 0xD3E48B4197FBCADD, 0xE3D49603C2C465BC, 0xA9BE4792E4A69328, 
-0xD1FD8434E8881A6A, 0xE9414EEFD0544423, 0x7C0E5694E22F19EE, 0x18DF616C7720A6E, 
-0x96134E078816AAD1, 0xCA5F057F42A517B4, 0xE054CDA6B4C324F5, 0x5610E46DDE74, 
-0x77A9D6EF98979E9B, 0xCF569D5B06B3A86F, 0x3CEA37858D78F782, 0xA5ECD931FA9F33E6, 
-0xBAA80D16BCD77CAF, 0x1F3AA6A00DA992C9, 0x64CFB60547A6440E, 0xE8FD8D606AFE9D51, 
-0xBC5782DFF75DFEF8, 0x42E405393A81BF2B, 0x3540C454BD677CB0, 0x282CE72C0289, 
-0x204938EBEEA4AAB0, 0x8D0AA9FB63A1D015, 0xD58D389D56176286, 0x18FC3AA85ED3DB1F, 
-0xB4D7441818AF5D3F, 0xC134CD8B8BA76AB9, 0x4D049E5D56DEE72F, 0x9059613C21DA2443, 
-0x25184C03406ECF5E, 0xAA63E7E60FE961E6, 0x2E5CEE3F4DBF18B2, 0x5FC63B9DD2C1, 
-0xBAF99D551B383D16, 0xC489B6713E5080A3, 0xC00148D8C925356, 0x2C7DE9B8BA38A835, 
-0xE922E18AF039F5C1, 0xD716042B3EAB52ED, 0x8680A4AADD955DAE, 0x35AF8F3228517684, 
-0x35BFFC3B48CEF2A4, 0x5FDB93367243D525, 0xB7DBB353D35B45D9, 0x190B5387E87C, 
-0xD77E7DE3FD1BDEE6, 0xD49A1AA7952346B, 0x5DD9944BA28B73E2, 0x633A59276617D792, 
-0xF7F74270739678B6, 0x9FEA1EE72864B13F, 0x197491793B604C9B, 0xC9CBEA428067E0F7, 
-0xF5870E1F82C43FE3, 0x8D9C7AA567395624, 0xB28AAFC2BEA904DF, 0xEFA15EB378, 
-0x7C7BA6A97B41C9DA, 0x2B70D7443E3ED637, 0x91DC966369673712, 0xF3D17CD5CED0003F, 
-0x2739AF8F4CD43440, 0x83F1FA92DFB15EC7, 0x97860D375F0190B, 0xE0D431EBDD5779A1, 
-0x787DFEEECD18F0A0, 0x4B08F0A67F7FACF8, 0x117B92E67A2A9093, 0x2C1408C35F2D, 
-0xADFCBDA06BB3F68F, 0xD91718E836AC5AAB, 0x16F9A8AACF7E4DDD, 0x4C64E573A9EE7164, 
-0x1165C4A6CFDA970C, 0x4A3BFA847080E4A5, 0xEF63D9B964E9DEC6, 0xA34B396A8546FB84, 
-0x22789ECFA21A015D, 0x784EC8BEBAD090CB, 0xDDB5AF57D224CA5, 0x516A780D15F0, 
-0x539DCF8BBA10B08F, 0x26C94FD37B2F2ED5, 0x1C4E2FE77D341B8C, 0x3C85C35211D63215, 
-0x81FD4A55CBE2B25F, 0x93D878AEBE56382F, 0xC1021B4E6F801467, 0x36C28EE33CA56048, 
-0x91FF4115F0B84395, 0xEBA8BBF69CC39A23, 0xC1E4642ECF9DF50A, 0x5397349C784C, 
-0xD473F657076B7834, 0x3A6C12417A4AF0F, 0x5998B4395E113562, 0xCE997A2EE47F2BFB, 
-0x7B2BD7FFD57B32CC, 0x730ECEE07C4E9F47, 0xAAD87515767F50E6, 0x3F13EB9C5E9E6DC5, 
-0x4C75DDAF26810BEC, 0x21091B2D89B257CE, 0xAE9DF5B1CEB4A71A, 0x375057DF769A, 
-0x3F16CFAA856399CE, 0xB08F50EE559753CC, 0xFDE6B38857884C15, 0x1BDF66E2567431D1, 
-0xB94A643D75B22928, 0xB752F2F28642D0CC, 0x2DD07C5A980F8C1, 0xF89A1FBC89968992, 
-0xB951C81393418E6A, 0x51E7CB4E69B16930, 0xFDD6B47BBB1F253B, 0x533E8215B2C, 
-0x18FA5BDBCC708B65, 0x16BF975547511F7A, 0xBD33255C7AD8196, 0x547C876E661EC911, 
-0x8F09732893C83D1B, 0x70F8BEC5126CFE9E, 0xF37BF521F95A2380, 0x3E1CFFE7DD9ADF0E, 
-0xACE013923F0CFC9, 0x675E792FF0C58366, 0x819660F57CB8489, 0x5EB5D33C92F, 
-0x7CC0EF3AE3B056E0, 0x27AE42CC05F0AF77, 0x333309E007079765, 0x2153F1885850C159, 
-0xFAE853968E86CD9D, 0x1C7E2A2B6A1C2B95, 0x8782CE515DC334B0, 0x91E2E341A95FDDA2, 
-0x1579AB8B878B7B19, 0xA7A8D065FF9DD9C4, 0xAEDF6CE9612D9B0E, 0x5AF1279E5B9F, 
-0xD580E9B6B1B9EBCA, 0x247C103F24EE480A, 0x39BF9EDDF7FBBDE7, 0xB6472E0C1822264C, 
-0x71679684987277CD, 0xD9AD205B93638D80, 0xAA13CE6D9738793F, 0x6CAA9D19E4C25F5F, 
-0x165450E8F58336DE, 0x489F19F9558CD395, 0xE69FB9CAEB437B5B, 0x125AD8ED223D, 
-0x705C584BFEBE38E, 0x33B613499DCCF62A, 0x14551971EB75162E, 0x7298F2774483E468, 
-0x1F135CF1A321F70F, 0x41494A0F64553E82, 0x3A4CE6CADEB508FB, 0x35A9319C99F3559D, 
-0x4BBAECBA5DB0C9D3, 0xD36E394595B6DE3C, 0xEFFBCDD6F29C226E, 0x59F4B3631E89, 
-0xC3FF6E1A32078929, 0x32E63E949C2B7842, 0xBF9352B5040ED9E6, 0xFA08301FA6EB8326, 
-0xD6821FB1D5C90897, 0xB81D323B64100879, 0x102B0BDA96C10505, 0x448602F78B57F5C3, 
-0x12D8FBBB37056E23, 0x61FC07D95F18FB9A, 0xC84BAF6EF84FAB5D, 0x4160C9D40EE3, 
-0x90A8D68532271FB6, 0xC0F1353C19B7AF31, 0x9F2890999479029A, 0xE888DD1E07BD8DD7, 
-0xA120A23171EF9C14, 0x392B606E557D6855, 0x1D3BD72074E39658, 0xABBA30C0F8EF982D, 
-0xCDBFD3CA062B4CC9, 0xE28B1274E63E4B2F, 0xC43FA21820760AB, 0x50A328604418, 
-0xE589B1E686FE6CF0, 0x7DDC50D8CBD5280, 0x66205AFC545F095E, 0xBDE3943117471E2F, 
-0x5DAB1C935AF7741E, 0x502B53E871D9105A, 0x676C73C05EB509D, 0x189D104CD06A3FDE, 
-0xB76F7505671095C4, 0xB0106F9B0C28FD14, 0xD21D5D460CF02A99, 0x4F7DD876A71D, 
-0xAC7D129832C6D249, 0x4D5B62E453625BDB, 0xF9EBE8F1BC0E33B2, 0xDF801EC48AA44A89, 
-0xA9EE6BAA572A949C, 0x6D49B3CEAF0445D4, 0xC65801D3DFB17EB8, 0xB22BB2C871E5B70A, 
-0x1AB7EE6DB4CFF83C, 0xAB74A70698162CB9, 0x4581B3908604D9C8, 0xD95822BFE95, 
-0xBDA3C71BE7E88C57, 0xA7D218800262FF3, 0x39CB2C95D27D8D0F, 0x95A5BCDB863DC062, 
-0xEF8503DAB5535BC2, 0x21FFE60054013DBB, 0x57F0FFE9F4BF60CA, 0x3974CA866251B4E1, 
-0x59A02F8879DA47E0, 0x38C732B349B19569, 0x7D8AF95B174BC969, 0x4522D9E7F431, 
-0x17163F0B0A25DF8B, 0xF47F9A4FA104695A, 0x3CB8EF090B1F395F, 0x189034D5AB8F4A72, 
-0xA16B51CB640B1A99, 0x8BFA5EE5F19C7142, 0x15810222E143BE0E, 0x39CE28B1A0144AA5, 
-0xF8DE550998BC5738, 0xD5EE477B005B6A3F, 0xAFBD3BF0FCC046FD, 0x68E9FAE4CE4C, 
-0x70D6067CD402CEC3, 0xBC8895C155038839, 0x7E41223712E4B0, 0x653CE3712A3E8163, 
-0x408F21FDDA559482, 0x4C13C20895B4C14E, 0xDBC1D6D66F35D05, 0x3CD02738CD66064F, 
-0x8B91A6A711BA8F1D, 0xA1399564CDA15902, 0x277F0ACD1D89D8F8, 0x22AC8F26E363, 
-0x71440A9129786802, 0x15FD32D6A9228A17, 0x15328E6A8B629B76, 0x4ABFDB9321161C9A, 
-0x7C65349F810494B4, 0xA797F7313A360E4D, 0x95B6F8A338FB9D56, 0x921CDCF4F96B1653, 
-0xAE20AA82E7301643, 0xA44A2079DC29E660, 0xE627116D742409C, 0x5C6D995712BA, 
-0x2FF7FF8F507E7CAB, 0xA5C836D56C910249, 0x992B680E262EA14C, 0xE3DCCC9C769E943F, 
-0x4E90624A443C0570, 0xE06C83D9FB8526C7, 0x595A15EB06764193, 0x2FC1E6E688DDC609, 
-0x4697DAD06D9E71E9, 0xB9F32B38D4CF293C, 0x459948D7F6ECC4BD, 0x6A62A3B434F, 
-0x3B44257A164C049C, 0x14CC2DFE0061D3DE, 0x9B6C1B182FE63125, 0x161C5F51CC4E5765, 
-0xF888E0747904C404, 0x1307B160355D8570, 0x35A5A9ADE1029552, 0x6640F4279B5D594F, 
-0xCA0F27ED2DBCC2F0, 0x87D85310F4DBB702, 0x3C488D5CD56515C6, 0x5D2A357C1EB1, 
-0x101F25D1B49A4948, 0xCB80F9A30D53D781, 0xF19AA2D8E4FF0B00, 0xE3525901B0D770E, 
-0xCB5E6B20B1D5085D, 0xF2ADD9A76C64B72B, 0x9F286B59A78E9805, 0x587025422C6A3E0B, 
-0xC04662C8ADA3FB8E, 0xF718E5277834DC87, 0x14110330A1B49A8B, 0x2A286B6BFDB0, 
-0x78000967BD877AAB, 0xC3A64E6F2533A0B3, 0x3C1F3E26E9315EF0, 0x930A417A2D48C43C, 
-0xF8F817C1AE8C3BA2, 0xDFF76DFF781A0F2, 0xBB641D8A1423EB7A, 0xC79D5ECB183CC7FA, 
-0xEE0FA18B2A4486CE, 0x11DAD369D6E097DB, 0xB9B9A4FBD6EF95CA, 0x6B3B54526D9D, 
-0x84B8B3BE9E051F13, 0x690927FAB4D49B47, 0xED70970E4CD138B1, 0xB1C0AD8CE566BD91, 
-0x2324DEA47F9099D4, 0xEF013EBFE2EE3D2F, 0x8E88F944575AE6D0, 0x1ACB614341524E42, 
-0xD7B5848320A2524B, 0x6C8FF5FD78FFF6B8, 0x705ADCC2A23A2307, 0x69F0BE8F05EA, 
-0x8BF5CB31C61E73FF, 0x2CA53155A286455C, 0x14213F23F9FEDCEF, 0x22FE9F569AEE4C2A, 
-0x25013F7D0E7AC42B, 0x9B8DB2AEB2AE7413, 0x676419D8CEFDE3F3, 0x29628923210D1E3A, 
-0x7FBD7365FF858156, 0x11004E18AC50F9EE, 0x2038AFE39660A30B, 0x36CA647F6D93, 
-0x5DF67AF1B5950277, 0xB251D9F4ADFFF57E, 0x2ADEB89331AF7B2E, 0xAB3238B084C5024F, 
-0xE072AC018EFA1679, 0xA1EA3BE9FEE81688, 0xD2EA567A8A1A878B, 0x68ABEB68481FC65B, 
-0x62E789A4655C4150, 0x68F06876EA4F109B, 0x27E44BC33213E741, 0x4A146A3D006, 
-0xBEB195C383B293A, 0x7D0D55C835E3E9E4, 0xED303E977FAF0D38, 0x1FB53EBA6D989D1, 
-0x915C92F447377E23, 0x635BE328324B7952, 0x7EE2D3CD730655D2, 0x6159393AC12A2191, 
-0xA336D3E35B06BE7F, 0x5D2F9223816E60AF, 0x95E8AFA7A3402074, 0x396AA30FE321, 
-0x7489B9DB672160AE, 0xF24A22BD4B66AF39, 0x1C3B208E57833133, 0xE9D35800716B0681, 
-0xA707E1221B833948, 0x3EB2178BE3771AA2, 0xF7559583FB1672DD, 0x13B6B598C423DBD7, 
-0xDD96D45AEC18706C, 0x969BCAE2D53BEA82, 0xFAD36A5E3EB94B51, 0x14C35DEC2A17, 
-0xB1E75172666B6C7, 0x84948DA6EAB10569, 0xB5984920E874A98F, 0x49D45C95A842C8CE, 
-0x4957318264B6D1DC, 0x761C59170BEDFE44, 0xC1497CF361E6A91F, 0x8C38C3B21DC279E1, 
-0xE76435A3D28A08A8, 0xED3FD2D9AFE63D03, 0x6D693DAC1259FE0E, 0x499A583FC2A1, 
-0x806520680F1605A, 0x4D16AD3D96392DEC, 0x3B5B00798A07B1C7, 0xEF54521056F58B99, 
-0x2C695B9DB0B84CBF, 0x71012A307454074D, 0x74FE5B92E22773D6, 0x5CD4C25963B959C5, 
-0xF2DCE86C88CA3143, 0x8796C8E5ABDD0E01, 0x7841A10FA0F312FE, 0xE4B29E52FB7, 
-0x41AF79272EEC7219, 0xA270D802BEA60788, 0xCBC7D577484913B2, 0x667EC86F3C92E987, 
-0x63378379A616C864, 0x6D72B46DE60C4517, 0xA454CB1E16EF4354, 0x4AFC455092CCC4FD, 
-0x4FC635E05F621CB7, 0x235B0E1B0C99132, 0xDE2DDA5BCCF31772, 0x591CA4832336, 
-0x5D811B866997591A, 0x2FBAC389038878F4, 0xBC0072A531FE6D0D, 0x44F6AD37F0A8BC9A, 
-0x35342E009EFF5AAD, 0x936296F6A8F1114E, 0xE6641FD3E681F304, 0x1EEF1777CFFEE8F0, 
-0xFBC66C49841E7E51, 0xB564B959580FFA22, 0xF83AE2453F62209B, 0x22882A3F12B8, 
-0xB3F44617F35A1407, 0x4E20D37E285E6188, 0x89A7C6DC3CF7A2CD, 0x1A938685EDB54587, 
-0x9BBDFB8A5140C46E, 0x6B3C1D092605BB62, 0x29FD35AC2D9040E4, 0xBA4CBDCF3452E944, 
-0x1712D026439193C2, 0xBEE4369DFD18306A, 0x160ED5D328EF9458, 0x1BD65F872B82, 
-0x3FC76DCC39E59377, 0xB454070E5FFDC8AB, 0xB7ACBE5EF495CA60, 0xAB1CD88F0B8377AA, 
-0x4E3AE2D92DD2B791, 0xE795770F8AE35F89, 0x270BC590DA0044DB, 0xF86F036AA0980E8C, 
-0x684673EEBCADAC0, 0x5C2B70A1F237B464, 0xB27FDA1BBE0405B2, 0x25A7663B34AA, 
-0xFA79FB14CD8E4320, 0x8FBFF950EBB11BBE, 0xAEED2CCF4816F674, 0xB71171C4B05E2B51, 
-0x28F1322E357B64AA, 0x77527FE998D0BBBD, 0xB8674ABAB42F064B, 0x27F7446C5B63783E, 
-0xF3147A95EE5AD5ED, 0x7EE0B87CB351DDAB, 0xE5426E99C51A0A60, 0x67D0FD08E0B6, 
-0xFC57CD68265C00EA, 0x75A3D0555EE1A603, 0x9C62A695B965F1B9, 0xE812AEDE48F1E38, 
-0xA1B7FF7A933ED41E, 0x29AAB36B4422F272, 0x8288A6E67B2F8A67, 0x10FFDAFEF0B6555F, 
-0xFE7CFD84D58C2FF1, 0x77AD85D356A05B55, 0x5EB902AA072BAD32, 0x638A873ACC63, 
-0x7858866A35BD3251, 0xD96592AC40C9B86C, 0xE00AFE45AE6DC173, 0xA1E221854C90DC5C, 
-0x813F33835000F24B, 0xFA6D732EADB19F3B, 0x1AD76C736D261DCE, 0x14450A57D7975139, 
-0x4DA2ADB7ECC63370, 0x55E063100103F1B2, 0x8CA8A379A2E51D8E, 0x32997EE85BA4, 
-0xF869BD6FB9F763E9, 0xA515FCD269B95887, 0x5A76A29FB3FDCABF, 0xDAB7E4841A4B16F2, 
-0xBA5A77FEC6BCA314, 0xCD5B7ADDAFBC4C1E, 0x73C728075C63B755, 0x3C72C9EBDDD8E57B, 
-0x8C6596BDCB648985, 0x91A0B6409192042B, 0xC5996637A3631FC1, 0x68F4A48905FC, 
-0x53ABE69D36298075, 0xEFF4708A860C499F, 0x3A4750BB396710F0, 0x8A341B1F83D5092F, 
-0xA16D6DB42B23CAD, 0x8F88BD3EE5B85CAB, 0x21CB85E6A9C77E40, 0xBE836BFEA75AA7CF, 
-0x392EA7F56405BD3D, 0xE9553FA1A583EB36, 0x9E5A3614537A3CC5, 0x449E7E8B7353, 
-0x16ACB32200609AA1, 0x2C02F91E732C1A69, 0x9D1FB3C8375E3198, 0x2AEB0337CE3C9861, 
-0x2E7D1ECED328D7B6, 0xF9F1C18E68657F64, 0x32B3B4B3777EE23, 0x135FAC38A9C05701, 
-0x6525618A42FE8C29, 0x71442C01E672B65, 0x2AB5ACD6ABD4EFFF, 0x129E3D1DDD2A, 
-0xC292EFCD18068064, 0x6B866ABBC3711192, 0x2C10A714CA1D8A3, 0x7467002B18C22BFA, 
-0xF8C22873AE3589D3, 0x9A651DCAB7D5685E, 0x9D53E5F3CAB34082, 0x98DC6BCC67D943DE, 
-0x7956ACC3B1F2C6AB, 0x660DBDA2FB78D88F, 0x23B501F69D4771F6, 0x9E2FEE62D8D, 
-0x631CF0EF056B7342, 0x5A21366BE274F8D8, 0x7D8B832F0A80AFB, 0x1AA32558506380EB, 
-0xC49E94A2A0E46FF8, 0x60F406E36F7F86DB, 0xEA9A0CCA74FDA8E5, 0x9F5381C67B5AB844, 
-0xB296A82789B71710, 0x72893FF78D5C5A99, 0x746EB187D671CE57, 0x6F699A9DC4DD, 
-0x9EDF984E6CDB7AF7, 0xA5B70DBB06F0A3A7, 0x95FDE30449033F88, 0xF5BE13CBE3304C75, 
-0xF5F6CD7AB035302E, 0x1E8BCD4AEF34F2C8, 0x5A2A0DE80054E96E, 0xEE516F0A799A07E2, 
-0x64AA0A7D544899E1, 0x603ED303BEBCBD0, 0xDB60B08E44331F2C, 0x44471051B3CC, 
-0xFE6E081103852068, 0x49B28CE4AB068106, 0xBE9F673A3BCF9E53, 0xBD55E83EEFB03B77, 
-0xF5FE52B9341CE77B, 0xB9A0133ECDD6B524, 0x2C7674673DF710DF, 0x1EAD136528FCD86, 
-0x7AC72F022A479E48, 0x278C9FA4E8DB105D, 0xD1E5F0E4E560BEEC, 0x61698E42627F, 
-0xE14292471DEB3E48, 0xBBF401CF86E8D11B, 0x1175F3387EF73517, 0x91A645F6B01E467, 
-0x1F5CC464DF85C4D3, 0x9C60E63F1F7A4945, 0x19B23654D34231FC, 0xE58769B56A09110D, 
-0xADF2F6B0B8AE040E, 0x50E74522DE8ED940, 0xEB5039C0E4BA6C4D, 0x2A6B7129F61, 
-0xD9318AE388B2C332, 0x9B72BCCF4D36EA45, 0x71B6E7ED25B5B0C2, 0x80DCDB26FFDA03D5, 
-0x90AA5CE8ACEA26A3, 0xE11D4BAF162D39A7, 0x4D0C5E1F796EE967, 0xCD69C1C9AF8374D1, 
-0x9D993D4B87519EAF, 0xA3C50F5B3D31E1C6, 0x5E276533A1B18D22, 0x6265F1B21179, 
-0x9D18B0814F475707, 0x1B3E14F241532A2, 0x906C443CDAC95CBE, 0xD120E8DD41E43944, 
-0xB28F4A119574AFFD, 0xA312B7BBD91F73ED, 0xF3C581D8F4F3F862, 0xFC2C19C66D9B2E71, 
-0x80F66F4DEA7DEDBF, 0x3F2B9A24BBDD2B2, 0x8D71DCA51392F845, 0x1B8222A4030E, 
-0x58D548144ECAB776, 0x59184779D731F4B1, 0x9D5A3FC1E0B31F9A, 0x4946D8C43524CF2C, 
-0x50930FC6EBE8254D, 0xD61FE3DDCA6B3DFC, 0x4484A3E143AAC690, 0xD2BB998D14CBF2BC, 
-0xFCE2450B95FC9082, 0xE47C5CD793343DB9, 0x9E1EEF30DD0A5BE8, 0x1883A3B6EAB5, 
-0xE683CD4DC18A8532, 0x38E233BAF6BA0AB9, 0xEE1D471224768840, 0x30B150EA7E9F07E2, 
-0xD6E7520687D71B04, 0xBA7EDD4E3A25586A, 0xD8C5D71048DE6780, 0x46971DB20061B382, 
-0xC6CB662EB143B8B5, 0xA9DFFDDEE3D332F7, 0x909865868DC5D762, 0x51234FAD4B2B, 
-0xE3143F81154EE4C9, 0x488E5B2284F159F5, 0x33CA2DEA64579DED, 0x11D1B155C04FB7CD, 
-0xF562D028B979E01D, 0xF3F87ECE884DA0F9, 0x7EF39C74C7237E26, 0xED6FDAB198A5E532, 
-0x49B7E311A73F28C3, 0xDA9283AA6A837ECC, 0x52E6C4FD0F0C8E4A, 0x425FF76EAE7A, 
-0x375D5EC36EBF1E90, 0xF393AF815CBF8DBF, 0x96C80335AB610C14, 0x153618D785CDCCFC, 
-0xEF0D39FD7B68BB66, 0xF0A0603C5C93C81D, 0xE453FE4D20C5541B, 0x42771E2EF8DC025, 
-0x8AA424A06C5DF8C1, 0xF71B27B4754A2371, 0xD3965C75C868DF0A, 0x495B6EC4A981, 
-0x947DAB556E2E7EA9, 0x53F824AE389F23A6, 0x606F784498C84DB, 0xD10B4B00AC1A80CE, 
-0xD39351C80AD33236, 0x7D1B41511184B768, 0x4C872835B7DDA2F, 0x3168205897A2B738, 
-0x302DB972DAA96CB4, 0xF0A9C9B189A57093, 0xEEF8BD505376550E, 0x56756811B75C, 
-0x982566D5D3C18B07, 0x961DADB4EE39A29, 0xD38E173A25D466B9, 0x78EF41CB0EB09C44, 
-0x96AA4D3A2D989F4D, 0xD3590DDCF0228EE6, 0x8C3C615C773F2DCC, 0x3EB46412063A547E, 
-0xAC8E54D217BF38C0, 0xB7EE759353EB3802, 0x6E3A0ECC98F01B1D, 0x612B81C2E6AD, 
-0xEB7A48FF7B30691C, 0x7410B3092F0DD175, 0x4FF37999E821883F, 0x8B5914AFBAC994DD, 
-0x3DDD04B1667DB5FD, 0x2E845E2897DCAED7, 0x95B411E63404DE87, 0xDC6C36CF4CCBB8FF, 
-0x218C80A90881621, 0x64CED07BD30E7E5F, 0x52AD7F00CE00D9AC, 0x385594742458, 
-0x9D3B531BB05C78C7, 0x5350C60C8FDEF0DC, 0xA4FB7AE7A17A4DD8, 0x9BC845B16A4C00F9, 
-0x65B36E10426E04CD, 0x110B3D769E0F4155, 0x331A9FC780C9F467, 0xEA7B136C536CB529, 
-0x6C93629FBA58ADB2, 0xA8C0139EC0D48C35, 0x45D75241499C8F25, 0x6E1030214568, 
-0xE59F81AE98D4A2EB, 0xA9B5F93612E008F4, 0x5DA3BC06491BD121, 0x7815D7DF0EA4E7A9, 
-0x6DC8A4F8FCEFB8AB, 0xEDA5E434644BA153, 0xE8C0B2D0125E451D, 0x5E7E33D2534817FA, 
-0x5DD9D2F49A7E902E, 0x45DEDFA6D7642760, 0x52E12C69CBEB930F, 0x48E93608203D, 
-0x7EDAF0A04899A155, 0xEA4351D1E9D84284, 0xF51965A24EFAEDB6, 0x792935F9B7C5D4E9, 
-0x8071A44FF46F9C4C, 0x20B44AF6EC38331E, 0xE020675BBA39FABE, 0x266C8CEFB407519A, 
-0x5B0F1941137F53AF, 0x6EA4CE61592C2EFE, 0x1350E6516661DCA2, 0x2EE9C2E53A94, 
-0xDB2F33F44D44BF18, 0xAF77A4BF8392F28F, 0xB393F9D626106FE, 0xB3048E1BA7EDC3, 
-0xD172C8F938EB6ED1, 0xF71D1AF30AFCB90D, 0x23C88108E19D58D7, 0xA872252A5E204359, 
-0xE48B7B34C3EB5976, 0x925D656B3D687F7F, 0xB04486D1125C84BE, 0x105214396599, 
-0xD3D71FB974269A8F, 0x7B72D515CF159163, 0xF2106AA700549551, 0x448DAF2D04CAAF7C, 
-0xDBFE25AE181E0AB2, 0x41FFE93AFA7810C0, 0x580139CC3DFCD227, 0xFB921F9EB0330884, 
-0xCBB36C3A41A03A6E, 0x505B781921B396D2, 0xE4AEE0166CC0C993, 0x420E652D6C4D, 
-0xEBCF505A8D9EAA07, 0xF91D8E748A02FE04, 0xCAB15FA791604AA7, 0xF6D1DDD614E35A3E, 
-0xF2C812C94D1778A8, 0x824165A0F5943CA2, 0xC215AED3D2CF5E9, 0xBDAD80B07793A666, 
-0x623E7321312DD4D7, 0x23826E3A88E077BE, 0x36D1B8AE0F79AC14, 0x1068F666D2DD, 
-0xA17094F0B6AB4A45, 0x94B90564C817E48F, 0x5AC02DF97CBD0DBC, 0x3B7DF92E43CF2EAA, 
-0xA5399D1B840594F0, 0xCD53BC41BC479513, 0xC062C3134CA93A1F, 0x153E1B1789C59938, 
-0x5969C30470DFE733, 0x627D6D8F71321046, 0x21C15AC40793C679, 0x35301B852E23, 
-0xE3D7EACF3ED3BF0D, 0xBFAD322F47CB82BA, 0xDC0F69E18D473D7C, 0x65B036A6E0D5D411, 
-0xAD1243631A242E09, 0x15C1976602D6BAD3, 0xA4407044B6D13DED, 0x9098D13D167CC524, 
-0x60A53C97D277E411, 0x531AE5599554D7B9, 0x613791A20158AD3, 0xB782AC3768A, 
-0x8FBA46FE6A24E95D, 0xD7CA81419ABB310, 0x6ED4D58ED5653E36, 0xD5ABF1D96D3BD323, 
-0x6E9A2223E862A51D, 0x2D4B778AB9056B90, 0xAA3733150D8AC4D6, 0x67CE23ACD5AAA5ED, 
-0x1C0949DAE3FA297A, 0xB2E95504A7AEBCF3, 0x1159FA1F40A1F041, 0x1C7D4188AC0F, 
-0xE22FEFBC8EEEECA, 0x48B2B8FB01EC8CBF, 0x235BF6B8C170C360, 0x63BF7A734E84209B, 
-0x55276EDAD7511730, 0xA13B67F461CEBEEF, 0xAF9E84BD1BCE573F, 0x48FE119AD70F8C80, 
-0x67E3160804EADDE9, 0x1CE3A23071C3977C, 0x7B6156D93F2EA100, 0x6B0906F3DF1C, 
-0x70098279AFD64F9, 0x424C003BE4FA8ACF, 0xD924C4117F97036F, 0xFC72FFE6FB3F2393, 
-0x1A7169BA70BDC67A, 0x9D6800512BDD2EE7, 0x4B9D9A2E0E896940, 0x81611189CDA6127F, 
-0x148C157BBFB2DD70, 0x395EF18F37F8CB6A, 0xFBC502A2F4B3753E, 0x66BB3CFD4704, 
-0x89AA93680DF0C331, 0x304B741794476B88, 0xAA93B88B5D3ECDD1, 0x6279271D9528C082, 
-0xD14594AA054BA1B9, 0x2F8D81E521A79EE5, 0xD3A4718698EFD4AF, 0x7E5F13FF2ED85538, 
-0x360D5FDD020CFCA3, 0xD8D3A42C12E53ED1, 0x4F18923768338EE5, 0x25179BA9DA97, 
-0x2949197721BCF6F, 0x6632CB9DB6DBB1B0, 0x54CA6E62679B6E48, 0x7E57270E0DBC852E, 
-0xF649B15C13050ACF, 0x37A633CAC001BAF5, 0x984C31CE9A34FDE3, 0xDBDBE16540FD69B5, 
-0x1F5BB7CFEA0B6EB9, 0xF502AAF4AD3AD8AD, 0x55FC0357F1A37816, 0x22C0968FC89C, 
-0xBC783974730EF635, 0x2BB38A0A0EB497ED, 0xC2773F24D96B3177, 0x1795B6905D0D854B, 
-0xE5968714E1249AF1, 0xC8A148126EBA887C, 0xC806458F675FE934, 0xCC0FDEC5FAF990A4, 
-0x388CB7A14AAED8C3, 0xB12C5B8E5A63814E, 0x1A8B937A4223C6EC, 0x25C23FE97C52, 
-0x9CAE4EBBD6DEEDD1, 0xAEA557473A6839B4, 0x7433F217AC7EA6C, 0x920B03ACE7FEF391, 
-0xEADC7C2719B92648, 0xC6775E0AF5AC1A3E, 0x84824A9C40776433, 0x415894DF9ECBB879, 
-0xD77B3E485F8AFC36, 0x4A6345ED258953EA, 0x169D8EEC66325EEC, 0x5C3703455DA0, 
-0xA53F666C0A9E668F, 0x7BB31ED97F0CE55F, 0x369D2947B9C335EC, 0x9913DB980B7B85DC, 
-0x1A8785079FCAB17A, 0xF1FC0AAADE460E95, 0xA0EE1BBD933B68B, 0x7489D9EE06BE9A22, 
-0xDD94D40EEEC81266, 0xE4467917432EBD6E, 0x88B75E06CA2F145, 0x5F57B080D63F, 
-0x75770B5E319C0AEC, 0x266EF3297D92899A, 0xD436A40609185BF8, 0x240ECA01906BDC85, 
-0x47E39A3195EBCFEA, 0x42B68C5D01C0DB40, 0x68E2AD64D819F06B, 0x5344435399E8C048, 
-0xC396B8004D9FCDE, 0x1057164FAA913DEA, 0x9AE62B5F7FD70BED, 0xB7C179C7462, 
-0xBF9C91F68D2EA2D7, 0x3E5ABE6F3181F94B, 0xA4F9B573A8BD0C22, 0xCEDF1A60A753A09B, 
-0x9647240F42DD2671, 0xF28C432D87363E04, 0x292594C1D39A465D, 0x524CE6C5086EC652, 
-0x7030E21A1ABD0C2C, 0x9DB165B2A1BA95D5, 0x4A6BDADE39FAC53E, 0x4922B23A64CB, 
-0xCD0DAACAFC1BDAF, 0xCC8BAF7E77BDEC92, 0x3866292964670B4B, 0x9907B6A084907E7F, 
-0x2205F2A933AC7995, 0xB8C3AB9993D1EAED, 0x7A5951762EE6A14, 0xC14BEE0E0BCD0E78, 
-0xC7DB0CD2D20E809C, 0x6F19C8CA82673336, 0x816558AD116E62A5, 0x5BB34FD8B15B, 
-0xFB3E5091A94D75BB, 0x5615567DD1803179, 0x65431F8790BDCBFB, 0xD13B6F72BD2F9373, 
-0x9203E725BC80F58E, 0x9F90864729D851, 0xC09E9EE4A3E8DA88, 0xCE9BC094FF2EA1F5, 
-0xD4C54B8A5434B70C, 0x6D818FF2AF059473, 0x60576EB86382FB84, 0x135E207DE7F9, 
-0x2E1D24462A67619, 0xEE9D57E4CE5930FF, 0xB1BBA312A58254BB, 0xA3BA19ED6A2FBAC0, 
-0xD9B33B4BB8612CC4, 0xD00D35911A7658B6, 0xAE53BCA77485D0F3, 0x10BDD5C9E61183F2, 
-0xB66FF84AD72E794D, 0xCA2B80A834568402, 0x31E0C1E4751C27F7, 0x42540D9F06B8, 
-0xBD34717262B48F43, 0xCA0FD0D292F0FF4A, 0xA19B0D108A3B2FF2, 0x1678D4460D7114C1, 
-0x394C737AF04D215C, 0x5080A6EAB3D5548D, 0xA4328A6B91DEAFF6, 0x643E52A9AD8BE7ED, 
-0xDC6D1B725FEA108B, 0xB870D6162A13590A, 0xB6C39E5B3B665E47, 0x38464502326, 
-0x67F7E284C731B679, 0xDDF9DB270790C86E, 0x8F8C9844100F1E6E, 0xD71B424B2E1357CD, 
-0x54F06F9DAE962CDC, 0xEA0E82A69700D90D, 0x5CC2572E79F89E51, 0x6AF6F68B1C72695B, 
-0x3B9276758D664066, 0x3024EEE8E7AADFD8, 0x4B42C47CCD01B77D, 0x1CF9B5FF2F4F, 
-0x2AE329C2FF07AC36, 0xA87F301D24470302, 0xC2995B8E50B6DAD7, 0x730BE06B15A9F51E, 
-0x1F920481752D44A8, 0xE7F534F19F777C7, 0x53F4A847EC85D253, 0x621F4864C548BEA1, 
-0x56EFD35FC9034581, 0xC4B8D66C6E6D86A5, 0xDA74C075313ABB87, 0x67B6597212F5, 
-0x6C17FE33F004890A, 0xBEFC2E276E3AF6, 0x89CB248C5ADAF40, 0x5C94AB2BCAB47C92, 
-0x2EB7C59A14F4B180, 0x327C51709F1AAC0B, 0x6DDD2D6241E89D57, 0xE12FDE8F789AB2A4, 
-0x87B71C0DD475C022, 0xB90901B0FF7CC92B, 0x353823A321FA646D, 0x40195C18F331, 
-0xCFB69DFE712F96AC, 0x81D36E868F16039E, 0x8A8934A4F2401CD9, 0x9581F1176F0BE73A, 
-0xE90E7B5C52435F85, 0x23F01CD2EF98B3C1, 0xFDF10AA912455BEE, 0x4756DAA4E04F9730, 
-0x2132898002E82B50, 0xEC647A6D10943FC, 0x1BB7BAA5F457FC6E, 0x5F01A842F59C, 
-0x61A4D48C34D08C1C, 0xB8DBFEA9EFA70BBF, 0xDDD926A15ECFF57B, 0x498C29FB5EF74A79, 
-0x5017021FA1094C61, 0x3BB471F3097C1C51, 0x7FA5AA62C11EEF1, 0x5ED87AF67AF91262, 
-0x4EB0083CB072432B, 0x6E31E7B821D62751, 0x5980ABD4C7F52B92, 0x628D71172AC8, 
-0xF7A9CB07118249A7, 0xF3267CC7BEA96512, 0x57C4B796DDFE07E2, 0x998CD1364AFC88D1, 
-0xD24361FC9FFB0694, 0xD1D5A3D0486496E5, 0xE5E9F5104027B757, 0x60BDAF7F068D1A07, 
-0xEC559FDEA65C4ECD, 0x39D9E36B4FBFBA0F, 0x613C611FEA41CE02, 0x19F801F01B6E, 
-0x812E26F964221E83, 0x36ED2A968C3E835D, 0x7B4FD87C63BEC349, 0x74B78013C5CF26B, 
-0xF5AA61B23BEEA319, 0xA8295030FBE1ECB, 0x86A5D0E16D8B7C0A, 0xD5AC4BFB29398A18, 
-0xACB3D04382AC3387, 0x6A05B77CD0B17F26, 0x84D0C8BC28959BC3, 0x48DEB964C82A, 
-0x3BFFEAF4A4E90D59, 0x85A03E51C5CDA223, 0x102A836E7B6D9FCA, 0x220DA6AF0339678C, 
-0xFFC761DF97FDCCC6, 0x2FDBDCF176BB31C6, 0xFAAD7F81E431BCE8, 0x6D7F7D05FD4697EC, 
-0x34139C963FA7597C, 0xF85479AD0D173198, 0x57983B1F3B57DFD9, 0x68ADA77B086C, 
-0x289F2979840A678F, 0x90D641A02147994A, 0x7C7D5953B2D35C9E, 0xE29E1CA5AD4A86B4, 
-0x50B836DA235531C3, 0xB17408603AA10EDC, 0xBA68E2A9C5810DF5, 0xB93D25FFBCB8B02F, 
-0xF2CDBB84ABB078B7, 0x8108117EC80DAD72, 0xBF2C074D8E39B458, 0x21BF81578D79, 
-0xB70BE3E92E9851E3, 0x48D8C10280FA4F53, 0xED83AD6099534D6, 0x242E110BE20838CE, 
-0x6D15A1F7289D7230, 0xB11F89AAC4F30484, 0xE1ED8E6E85D09429, 0x904CABBCC307698D, 
-0xB36FCE7745AAA236, 0xF5B168614CDB1542, 0xD793F50DD525E87A, 0x803F281DE4C, 
-0x9CF2AE0D1CE42480, 0xAAE91BA7A6FC09E1, 0x95638038355B2D41, 0xA6783196A86E2A2E, 
-0x4708D38C62D47D2D, 0x50C0C603709A8011, 0xBB6B70BED45D4934, 0xDDF6EC296A7FA5FF, 
-0x89D3D8AD76632241, 0x5C762F6AD3EA8C11, 0x423FE1B2C88B9924, 0x670598F34986, 
-0xE41A648395810548, 0x238839E9148DB4E1, 0x6F210A714642D027, 0x738BA9869515EC12, 
-0xA7DA18D6CF2CB940, 0xEB3E4C358E6B4142, 0x9AFDE84CED1A4CA3, 0xBDAF2A56D15A48FC, 
-0xFD8C2DF2A816B591, 0xBDA4CD4AD018D92, 0x9656BA903D03431, 0x568F447BE855, 
-0xB20B41008A734906, 0xA9FDFAB2451A5BB0, 0x7CAF8E09ACB07E04, 0x7F84F8556C219317, 
-0x60BFEF8911D1CE5C, 0x7AA416F08A0B2276, 0xCFEB297EDEBA893, 0x60BA1920F5BE6C21, 
-0x588420A456BCB0D, 0xB70114002C40D298, 0x3098DE3FAA091C4, 0x5C24B8945E9A, 
-0x882DFFE0794D69C6, 0xC4537B4D7EB547EA, 0x2CF6233CE6458B28, 0x6AB3ACAA9DA4DF81, 
-0x6B13A56EC723A082, 0x71DA6B8E450931E1, 0xB0E961E6B31FFC7, 0xB897C39D6CFFB47D, 
-0x9C46EE6BE5F9ADD, 0x6B69696F9C963AAA, 0x976B12EA23964772, 0x17C0E221009C, 
-0x7739A7CE1FC6B7A0, 0x19B043601EACA884, 0x16406DEF72C96810, 0xB06396CC11E49CA7, 
-0x44B9CF60B39887B9, 0x8FD05565842CE39E, 0x349520267B3333A5, 0x7AE6B558B6B7D263, 
-0x79472162753153B1, 0xDDAE37AB787FA025, 0x27E4BFDE5C9CFBCC, 0x407326EA944A, 
-0x84FF1E0894CEF303, 0xD7AA7E47348E0A4C, 0x3BDB8F6C2D373A31, 0x1348A94BD7AD1BE7, 
-0x1105D99F78104EE7, 0x40F9D84C01130688, 0x500C49429A664DC5, 0x7603E6B335341103, 
-0xFE79BC0DED601BE, 0xBDF7568494F2421D, 0x8A393E058BCC1727, 0x382579FCEE70, 
-0x14EB68CE3C130309, 0x1174C34782DEB4C3, 0x9B72BCCF2CED6AEC, 0xACDDBB069D52B00B, 
-0x6DE2572F11470AAA, 0x40648DC01AFC976C, 0x49462D3AE4BE57CC, 0x10B8060823F6CA78, 
-0x4FC0D80612D97CA1, 0x186902F98B3DB6A9, 0x430711F04F3EBF2B, 0xA353BB09FC3, 
-0xB894D894B5AF85FD, 0x3FBBDB9C412B675F, 0xB42E2B86276099CE, 0x7B9DDDE2B89BEE8C, 
-0xF679EF2C1222ABB4, 0xFA602EE1A79599A5, 0xD8AD6B18BE17ACCF, 0xDD91B3B719514AFE, 
-0xE7FB2B70293B2143, 0x44685E473974533E, 0x8E1C3108CB2B6D80, 0x1796C33673F9, 
-0x10761B39B48FA892, 0xF9262EA62E1C43D9, 0xBB64493BCDA297D4, 0xB9EE037C0966CCBF, 
-0x59DBE3A4B55133DC, 0x28D21F1279E12FFF, 0x17930634A50C7EF0, 0xCCFBAE06B1B3EAF7, 
-0xF6A031F9193A1F44, 0x28AFF0A9EA6EAEB2, 0xB8D99A7E37E3A1AA, 0x2F42C7B55D68, 
-0xB5F95B22EC2F357A, 0x275C6A777008374C, 0x8EDE4773468873E1, 0xBB0225689442089F, 
-0xD42FC46D75EF7DC6, 0xF4EDB4D22653BC71, 0xAB488B9F92B60D80, 0x11501A4C5466F31C, 
-0xDDDB3B755A43B04B, 0xB488BBB798E928A, 0x814C94E22FE72544, 0x4E9189340E18, 
-0xB32354EED92EE5AE, 0xB3DEF97DE189021, 0xEBA8B5E68971607, 0xFB75AD35D4D9FD50, 
-0x90D17AF1CC3C537C, 0xE6B7418FE8B2E444, 0x7B27ACDC7C75CA1A, 0xC3155ABC4F40A33C, 
-0x4BDCD6B11AD6E6AA, 0xC14CC81242E2056, 0x4DB1463A38630683, 0x46B092DDD0FC, 
-0xE6299E94CFDF2CA0, 0x6D5405B71D5D5745, 0x961D1972BCE6E17C, 0xE437B05584B78CB1, 
-0x4D86B18BAC0DDAF4, 0x56E500CB560D423A, 0x30FAF5D7B90BE520, 0x514AC849E276256F, 
-0x75D973C1B028A786, 0xA7BA09EB95699A8, 0x6E12F80745DD2234, 0x458C1E000612, 
-0x27F1891BED668907, 0x20A14401B466539, 0x68D46B681053D33B, 0xB642DA947AEC35E4, 
-0xB931695D1D008EEF, 0x51138CD8EEDE13AA, 0x54C3280ECBD06A2E, 0xBA5E7FDE91EECCEF, 
-0x6CDF413BB09D3FFE, 0xAFC5B80F8A383FC3, 0xE42513058ADF97E4, 0x539B3B52414D, 
-0xBD424541179A7A43, 0x61D55D3218E45287, 0x637A08BC2DA093A3, 0x92ABA002C0ADD6A1, 
-0x864C807EA0EE09C9, 0x1B50C7C627D14CCB, 0x86F7F8F27C59601F, 0xE868F156C3B49C86, 
-0x8BB03DBF564696AC, 0x83F5E5F9C05F0371, 0x87590A5C01969EA3, 0x363257C838AF, 
-0x31E7D1E51B921441, 0xCEFEC2704B47DCAC, 0x2BD94B2AFD1F3F0C, 0xB92D71B48B014D5F, 
-0xC4604AB4367A05FD, 0x4FDE1BBFAA71BCA5, 0x73974E88F9662356, 0x34B26D0C2615116B, 
-0xE2EF600628DE0D05, 0xA601E1571DBD4756, 0xCE3D593A53E10FD9, 0x6A812592C53E, 
-0x8B95FBBDDEBB472A, 0xCC8BD5E7E26F5F85, 0xA81038BF4F429F2, 0x755037ADD4777704, 
-0x647E5CED51E5B5DE, 0x8724715C52B81B61, 0x61B7704368BC3C58, 0xA8E5B2A751BD2DAE, 
-0xF72C225F12D26B1C, 0xD05442663DFC2DF3, 0x43822D46B87DE597, 0x37D3D9F72D1A, 
-0xD88BBE8627758ADD, 0xF010D93BD6FF1B30, 0xF59D3F3549F780ED, 0xAAD74B6BE6F94CF0, 
-0x3BD08ECCA72F0D90, 0xF11C4011C1185C64, 0xD6A21A03CE6B06E1, 0xC0FCFDE4359B6766, 
-0xE6F26BC7D4C04578, 0xC9C1A06280AF1492, 0xDD69143F8865BA60, 0x6E84CE8CAFA5, 
-0xA6CAF83C7F7274D5, 0xB0DB4B9A0FB0BBAA, 0x61A6A285AEEBF972, 0x5CFCFE09863F3234, 
-0xBA9FC16EE4D1711C, 0x704E760FF48F5CEA, 0xA2DE5656455684D2, 0xC4B4EF40EF2879F5, 
-0x3CD955D7A4FBA8DB, 0x7AC9DDF8925B222E, 0xF46A6ABB3D003B70, 0x582ADE3209BA, 
-0x51EBA4898436FF1F, 0x43BF843B074D512B, 0xBA2E2FCA88FF7B1C, 0xC358E15948B42509, 
-0x3226CB9EA9E70, 0x21D140CF9ECFD7FC, 0x658F1B84AFDC4948, 0x28A76D249556F649, 
-0x4CC7DC3EF2FAA541, 0x8B985454E7519A60, 0x251304B00003298A, 0x639E0273F2FB, 
-0x6EF2509F651684C1, 0x65D3ADB80789F247, 0x9F4C2394E5B3AA06, 0x14D1D83B7D22B061, 
-0x1B311F70E755EFE7, 0xA38A198FC9B20135, 0x8171D23172F34000, 0xCD3EF5648D477C1, 
-0x4BE167511BC6C7FD, 0xE433C8BC06574600, 0x922CBFC09D402577, 0x365792EA09D, 
-0x3B20C62CAC8F6A69, 0x93B647895F5D153, 0xD9F3F7E9CFBDCD8, 0x60610040F80BA3C0, 
-0x772BE9B2374795C2, 0x8CFAE22FAA0E4507, 0x37E16BC62231A8FA, 0x35661B72AD00EC47, 
-0x7D9A8F87EDC58095, 0xAF677FA1E1262994, 0xD5BA2C456246D72C, 0x41F7CE129EB9, 
-0x2D6020D8401FCCA0, 0x4A47A4DF62077696, 0x4A53B205CAAB653C, 0x104F82D15FB7321F, 
-0xB81F2F59C4F1D5FA, 0x9538B51BC04741D2, 0x3968AA75247B906E, 0x3FDF7AE3ECF22536, 
-0xCEB6F59C2E3FC1A6, 0x6D4A681C4C50701C, 0x803AA76566F947A8, 0x49259DA8F3C9, 
-0xA881D3C202954A8F, 0x5363E9D2E35B44E, 0x816D20E55F8EF219, 0x2AC2F31405D170D, 
-0xC45275FA072257DC, 0x9DF90AF96CE30915, 0x3D73BFD73C656CA4, 0xF13D26E44DEC83C6, 
-0xED4D2D5E523376B0, 0xEBB200E0C815E244, 0x3EE2AD81FF253FF3, 0x2482BB57C48A, 
-0xE0DCB7622DC87606, 0x28DECDBE87A77C3F, 0x2F8AA9F03FD3C04A, 0xB0839A16C11E59BC, 
-0xBE278ECBE2AB7227, 0xACA537AEEE1B1D90, 0x3B00C6A55272FE01, 0x91C0B08E82286945, 
-0x5774E1944FA4942A, 0x51AF60807525B6B1, 0xF3560AA33C899C4F, 0x6574B9C5965A, 
-0xD95907CB57861C69, 0xA3B79321A89D0BED, 0xB7600C032CD5043B, 0xCB41D4FF0847843C, 
-0xB7CD518BA4A69DA9, 0x5BCB184E677902B2, 0xF48D5743FF765D21, 0xDB7980EB2356D907, 
-0x3B23EDC70845AA72, 0x602DD7E8CDAE9DD9, 0xAA1AC5E574AB925A, 0x6E30430C9D3F, 
-0x14ABCE70FFFBC334, 0x3E8E7B267252DFA9, 0xAD7254CF265C666A, 0xFB84345540C8B3BA, 
-0x627E58277B8579FD, 0xCEACF78F769EE8F2, 0xCE3C877DAA203E3F, 0xF9D8DFC5BF15B3C7, 
-0xEC3AD38CC2063483, 0x355F62F8BA120C5C, 0x917D0DF4F0FF3317, 0x817A4C24569, 
-0x83CB289FAD4B3855, 0x46EC1659AB2F2F65, 0x1741226B89D72185, 0xE772B88C7836441F, 
-0xC11A5D58B78718F8, 0xE7FC75B6462CB9CD, 0x8E0E450DA41F55F8, 0x5654DE4E0E04A4FC, 
-0x10E0837C83E80616, 0x2A0E8730C1DEC4D1, 0x2422CE0A7FAD5B06, 0x4FFA0266CA8B, 
-0xFAD2B48A201AAB0B, 0x945FDEBCB928D016, 0x37565F591B45710F, 0xF977D173ED282007, 
-0x137F6C2EACF2B478, 0x4A254EFC3875DB9A, 0x97838C3EDF82F570, 0xEDC03C1768B97147, 
-0x644635DDD4CCFC2E, 0x38B057E11D9635DC, 0xD8AD38B4EB807B64, 0x5274CCB735EA, 
-0xF926006BD6160256, 0x8EFFBC6F3A808BC9, 0xF7829E9181E5B377, 0xD12AE2D3492E341D, 
-0xE2194B7F33441CE2, 0x24AE58C0EFF30E49, 0xA0DEB829641DA937, 0xEE6610929F62F5BC, 
-0x21EB1310A783D6F8, 0x4C4F6C25D4847227, 0x1452347D7FC521BC, 0x36B495920A67, 
-0xB96486E895E47DC8, 0xB8F69056A0F9E024, 0x791D2F26A8C07E24, 0x338F3DA5DE31E458, 
-0xE6876CF298F043DA, 0xCC933EC9B7F253FB, 0xB73E23A9586F3C92, 0x7A77421AA7E81882, 
-0x893E167B971119C9, 0x63FA5A6CCE11B92F, 0x9839F4B5D65BB641, 0x282955D7C817, 
-0x99C610CD4DEDD455, 0x144BFE8FD2FB8654, 0x2D63AD1D7DEEABC7, 0x55D83BBAA19BDF31, 
-0xBD1B0C279455638B, 0x6D929F5A6100811E, 0x8969D7BCFE81B3B4, 0x62A342A779AD2C86, 
-0xB09958AB744D7C5B, 0x43FAE660CB43126F, 0xBC38FCF7E9C96B11, 0x42EE74FDCFD9, 
-0xEDB5F8A4551AC140, 0x3339D03ED2B4787E, 0xAFAE0BBF1D66902E, 0xE47626F485454813, 
-0x4B4B5507B6B86C40, 0x6CEE4728E28EE7A2, 0xA5F0231E14547AF9, 0x6794711357C3ED69, 
-0xB174945197834C9A, 0x76ED55C597A840A9, 0x3D44521C6E7AA54C, 0x4667C5C49D38, 
-0x32D16EC252CB80F4, 0xDD2BB936F1F0E4F3, 0xE745C7F8B3CA5F78, 0x1D6511ECEA67B446, 
-0x33D7D269A4D7ECE3, 0x5C946DAC959A6AB7, 0x8E9E49511AFF2A61, 0x74C5820B4814209B, 
-0xD54FBEC1021E91D9, 0xC031C47A9E2F4420, 0x13CA0B5E3DD179D0, 0x2AEA8CA92FA3, 
-0xD270699BBADD8B0D, 0x4ECA73B5CA57CB7D, 0xDBD3790023FD4E00, 0x371D2E0575D19FE5, 
-0x7C75F7135627650, 0x3612C6A51DA1A4F7, 0xDD24E177C8C1DC45, 0x33F4AE133BC53DFD, 
-0xA677551719414604, 0xF0092C6EE8326A6F, 0x53E57A1C82AC65EE, 0x8DEDE1C43F7, 
-0x7DE946D5F8CB71EA, 0x6A96473AAFED725, 0x2DF8D27911750A4E, 0xE7935D177AC41287, 
-0x53B819287D83BFC5, 0x3A0BB0790199095E, 0x73CEC133B5EA85BC, 0x2FB6FCA00377901A, 
-0x8A234D0D2A72AF95, 0x3B2EA66AB673ABC9, 0xE62BF23BB5B6978A, 0x180608B5CB41, 
-0xF802A2ADAEE8C387, 0x77CDD0170A070E51, 0xE048E9D6EEC0A004, 0xF0D0DA05FA6C6F25, 
-0xF96AF0F2968598F5, 0x4EE5DBBFCFE07229, 0xE378CFDC7103CACC, 0x8AF7456E68F95F7B, 
-0x9D007625468DF2E3, 0x8C36288134E64CBA, 0x8ABFB1DCDE134B90, 0x1E995E79BF6D, 
-0xC8B8D3BAFAB85010, 0xBB53DDD7BAE3AD2E, 0xD254EEBE9829663A, 0x2CC3BA479371477A, 
-0xA2CB63897BA6204B, 0x69E197E17440F530, 0x870442C2E82EC66, 0xE6AAA4339A03DEA7, 
-0x707A1827F542DF45, 0xB3B44F01570FB4C8, 0xC57C18AB3EE1A8CD, 0x537D4E043EA1, 
-0x33CD9238C3A0021E, 0xD66B4AD1F933E6CF, 0x4AB5D9515892D13C, 0x2C25CCEBE82B8AE7, 
-0xBF20CE7C29902B3F, 0x3787D99407588214, 0xA7A2B5DBA687D79C, 0x6BC8F6F561D0754D, 
-0x3D324593D82A23B4, 0xA9B0101132CE473A, 0x3639E5E252020B17, 0x5E2529C64174, 
-0x3F5819D15F233167, 0x572AA2C23D8FA829, 0xFCF7545104295238, 0x42E37E9CAC1C1B1, 
-0xCBDEB90B7AAC682B, 0xBCB3FBC7C2C02A36, 0x3383E1CEDE96C3D0, 0x464589BE3DAD88D3, 
-0xF4DEFA495C4EB676, 0x3B9D6F7B0FD1A02A, 0x2F42C21E5CC1604B, 0x6130AE9AA78D, 
-0xC95148D3A72D3950, 0xE05CBB0719DF5372, 0xCF99CFE813C08EFE, 0x58097A974B691C0A, 
-0x21D2EC4A5DA23887, 0xB20782DE616F00B3, 0xD6C2B88793AAC54B, 0xC84AC01F44415587, 
-0x3034F15A69591FB4, 0x6CF1967F4EE45AAA, 0x11AA4871EA42D02B, 0x6FBED4C457B0, 
-0xB35888898E996A4E, 0xE8DE779F411EF1D6, 0x1242F46CD3827754, 0xFF740E661D4BB742, 
-0xA639CE9644BEC3, 0x76A27FA458A5A89F, 0x268E621EE473F68E, 0xA03B9E3DECBDC828, 
-0x573D17D235C8A2F5, 0xCF657A1DDDAED03C, 0x58B2EE45F28EED1F, 0x4C78C3E3A57A, 
-0xFC5DEB134385262A, 0x137321A3AE8B8B79, 0x9BFAFAE14605B507, 0xE35090D1450D0AAB, 
-0x54CF2226A2C8BF51, 0x6EEB90F679705EFD, 0x531E950809B812B7, 0x2F2128D053CC4871, 
-0x8EB07A17AEF0EF42, 0x454DBA1A5DF7380A, 0x3F649A40D62BCAC7, 0x25BD7D034E8A, 
-0x571C4F646808EC22, 0xE58583CB930610F6, 0xB43EEC04C9B79FF2, 0xC32271EC0BA411A8, 
-0xA61AADE5632DEC99, 0xA2CC269310C9E1D9, 0xEBD5D02D76621487, 0xE2EC3D26C678EC3E, 
-0x7C7FC68B7A4A135B, 0xEC6472CD66C533C8, 0x2FB33F561A5CEB08, 0x3038BAE28DAE, 
-0x13B22FA5D925E132, 0x48001D2EC5F9AF25, 0x33025885AA1879B7, 0xA2FB62D474F5E4B8, 
-0xA92FF4FD12A7C149, 0x95958192AC617027, 0x7281762E21DDA971, 0x30018CEDB85FEF25, 
-0x84C59107CF6B5550, 0x611B87E5724FA75D, 0xC2232B8E8AF028FE, 0x6870F8E4B651, 
-0x156BF6899FC3D67, 0xDB58540D53FC70D4, 0xEF44A696E2CFC280, 0x757FD1A92AA49145, 
-0x63371818CA37A2DA, 0xACBA04C96E819EC5, 0x8C6E9D056339CF93, 0x6965DEB0E339C812, 
-0x84EA305AA37B49FB, 0x9F0A19B80810DF74, 0x361634FBEB02639, 0x23BD0607C756, 
-0xA54EA6C84C272351, 0x955ED56DE990B4F7, 0x333C40A1FEDDF906, 0xDE442A0832E1A904, 
-0xC3A86F2F3678D2B0, 0x7117DE86120B7627, 0x78FF93079299D007, 0x672035B2F368140E, 
-0x2BFED0871984D469, 0x3B73AAF8ED2949A0, 0x7F5902CA3C897907, 0x380754365AE4, 
-0xD5D9B0E3301529F9, 0xBFB24A3CF68968B0, 0xCE032F6457035118, 0xF81DAE5251A98F33, 
-0x427E6FB487AD263F, 0x2DB4B95CD3935600, 0xB7C8AC6FD6A99F1A, 0xB78D2205E7807E4F, 
-0xD0526C68A7818CC2, 0x593C15F6EFCB8AA4, 0xE60A039B492B0A3B, 0x19A7008D98B1, 
-0x1E0D9CE0EB35A148, 0x5D95460DEAE0D98C, 0x4CD665DA47C18590, 0xD6EAE59372E6ACE4, 
-0x4E2BD8662376B935, 0x1B74B8BC2EF992E2, 0x1B57677584E29AE, 0x900A06A655CBC598, 
-0xE708D9E29A544B63, 0x889C74ECBE7A3C95, 0xDC6FE413127C8BEF, 0x6EB24E0062F, 
-0xDA26B25A3826263, 0xF0306AFBBA6BB17A, 0x72DC3FA1B31F6E06, 0xF9C96E3EEE70EB53, 
-0xED9C435943706693, 0xEEF2D60D41AED1A9, 0xEE5CC6446C755C6F, 0x99106973AAC74BDE, 
-0xAC96EDA748EEF2F8, 0x8868F91756B02B3B, 0xFB1EA1349DD97102, 0x3A6F7271062A, 
-0x93A62DD53D19FBBE, 0xDE910A3F31F0288C, 0x41D76D49E59435E2, 0xA3FD74535B9BAC5A, 
-0x3D117B4961065FEF, 0x268D0C42BB6F3E15, 0x9B53B0809C968D8F, 0xB2080A2C8422E024, 
-0xC493E2A1ECF74617, 0xBD87B18CE0904CFC, 0x558AD31DD875CDEB, 0x107974261DD6, 
-0xFC22B3F8DCB99AD2, 0x6C07E95D898A34DF, 0xC4D054E0CBF1F7B8, 0x1C8C051F085B4F7, 
-0xD3D2B67EBF90DCAA, 0xBA26CFCD2E4CE4D0, 0xC5D37F2646854CB6, 0x2D63F34DEC2AF2CF, 
-0x50A232CD79734EC1, 0x1927E85A178FC0B6, 0xF98013D5E56BEC74, 0x4421FA3860A9, 
-0xE379E34F0F36034F, 0xF3C995A98F64FA92, 0xC4B56BD0C97FAEC4, 0xC178CF30CE5CB07E, 
-0x23B8A4D0752CF2E, 0x14BF2E23EBA979A9, 0x2FD37CF17E99F115, 0xF99B15019EF1D154, 
-0x61A1FED8344F3222, 0x87D442A6E25AF8C4, 0xACC809C518A49EE8, 0x69DBADE8DCE8, 
-0xAC7F0D2D46F4ACDB, 0x41A8BAB06D7A90B8, 0x3756354BEC30FB71, 0x4DFDE4166F204310, 
-0x6FC4F393551EA596, 0x13C86305671E3AB2, 0xCC64363F2053DF6, 0x755CC7D634EE8FD1, 
-0x38E1268BD7CB07AB, 0xBF3409F5DC27071C, 0x5FBBD3808950ACD0, 0x4C6D14558A52, 
-0xA915BF50759403C, 0xFD8967FEDB555410, 0xD211AE98F441ACFA, 0x6E982B7F038D1BB7, 
-0xA2A2D112912FDE09, 0x699AD521F8201B02, 0xE8AF26F832AE6A7E, 0x3129F11619963969, 
-0xEBC588C268A35BFE, 0x137895C079D51E45, 0x5C64B683CEEE5D27, 0x5417EFE08A12, 
-0xC885108EE36DA684, 0x63C9EEFE28D78741, 0x40E9EECC872DEEF4, 0xB9966F74B72D5E6E, 
-0x9FA9F78702A8C12D, 0xBA42FE786E730569, 0x34262A1C619DE9B4, 0x74170837E879730, 
-0xFCD05D6BDCE5100F, 0x99F2762A3911E63A, 0x7593F9D5F9DF611B, 0x69456EA10FD7, 
-0x65D8082BE8A6DDE0, 0x8D6FDA5FF215D66F, 0x8D879B24FC6EE762, 0x8C6D78787AD494E0, 
-0x16283798E33EC40B, 0x5408D4693F7584A, 0x763B54A4DEFB6D7D, 0xA7C5497EC8588A8B, 
-0x977EF403AAFE4A5F, 0xC98E3E1267DA9E38, 0x283A579E169E7EAE, 0x418994B44110, 
-0xA5A98C12E269390C, 0x35886E9A7267025E, 0xB2BE7FFE7A42501B, 0x6F733E92F6F2836D, 
-0x8D854ABB08C2FB94, 0x2F9142AEFE740586, 0xE3AFC1870382A508, 0x9140C262D0A3FC74, 
-0xE5135734CE9745BA, 0x1C0D52C52A5E4736, 0xC8784010094C4348, 0x18B62B10486C, 
-0xC34FFBF56FECEC96, 0x69714B21546EF360, 0x6B35CA92AD48E27, 0xE360E286092569, 
-0x7AE88B016A854FE2, 0x9306069BFDB82BC, 0x9F6E34A4B5E8B656, 0xF179BB29C0B4552B, 
-0xEBDC3ABA812570C7, 0xF35B7BAE0FD45503, 0x4264DAC440129B71, 0x412396FF5E78, 
-0x72C3BCC7FFAAABA5, 0xBF4B5067610BA54A, 0xE052CD610763097A, 0xA9E40238A97009, 
-0xF8CAD0FB262D63D3, 0xE8CB766B8457C361, 0x481802B2B0B4EE02, 0x122165AC5A076D1A, 
-0xAF0905782BE9899D, 0xCE07C954999C03D7, 0xD95DDB35D4B1E46B, 0x3369494C749E, 
-0xEC914749E0A69182, 0xD93947C5FDF07680, 0xE446AB46BCC5278A, 0x743D463C505D7B11, 
-0x9BBED06D538C0285, 0x86EAFEC81358CBDA, 0x55FC1C8FD8174BB8, 0x5E052C38007A86E5, 
-0x44758A8E0E59CE81, 0x5C06BD1E0D53D9D8, 0x1959DBBD80279839, 0x13F1EDDF540F, 
-0x134D7B4041475963, 0x961418CE77707BFA, 0xDE64CF449FF7F2EC, 0xE787399876BCFAE4, 
-0x5556F9F3E8CB7B92, 0x746231113F0F8EB3, 0xF73EAFB5D9898735, 0x4344F4207D042083, 
-0x8D0860922A701F0B, 0xA20A6F0A95D96967, 0x8F6B7F4415B02B7D, 0x1CFFBE2E59F1, 
-0x63B9B042DF8967AB, 0xD8374F10FE7874DA, 0x975C881231753D91, 0x43A6A4058B5D7817, 
-0x22611DA425F383B3, 0x5071491B4FD04D90, 0xABA0F6C1FB9DF0C8, 0x742D9E5842DFAE81, 
-0x94A6E8F9F35ECCE4, 0xEBC1A5C2D209BEFA, 0x1775763DEB21A594, 0x186FAE5EC4CA, 
-0xDA7E37D219B766F6, 0x2286B70FE596E57F, 0xBF9AC727AE9892FC, 0x1CF84663D4B1A2CB, 
-0x6171E93B4E234C33, 0x1CCFE49508C4FC04, 0x8D26EC830181E917, 0x2C0B42CD74FD9511, 
-0x20580032D5710F79, 0xCAC4A22070B12145, 0xDE0E05EB75F2736D, 0x51617E5262CB, 
-0x787DA59574F72EB9, 0xA2316D49CF70CBF9, 0x6BC3C8C389A8AC3B, 0x38BCE9756E6E46FE, 
-0x3421C609AD35AE67, 0xDEF3B58653CE516E, 0xD3FE64022DACD2A7, 0xE251D1A4E52DDBDF, 
-0x26D966F1A526269A, 0x84930EC56826CF74, 0xD3A34FDF70629F4A, 0x462A701C6F09, 
-0x82C52AF7F30787DD, 0x65A2FAF7D2E31C2C, 0xB3157D8FA7D66C1C, 0x6CEE3CE6DD59E341, 
-0x9289C1D9960169C2, 0x1BB9D5C4F5125FD9, 0xE0E2698AE112A9E8, 0xC53CF33C03A5914E, 
-0xD3A6121BEB8640C8, 0xE89987503537340, 0xA3D76F3E5156BBE9, 0x1C31A5FDD9D6, 
-0xBF87D71021756C6, 0x9095560328D965A5, 0xA207B4F08DD35D61, 0xADD275B6D36035A3, 
-0xE3F75707C1F489F4, 0x41D2E426419F7085, 0x3AF643EC4726BD2D, 0x16E55E5809CCD12A, 
-0xC2F72BFDABAD2797, 0x388FED4BB57BD28D, 0xC8F45459C42AC29E, 0x1A85CA7691F3, 
-0x49C102587BF9E105, 0xC7CD60A51029DB9F, 0x4BF5FBEFBB17E465, 0x3B63D832970F265F, 
-0x169D63362612BB09, 0xDEDD0536BAE36B69, 0x7CC662F197797624, 0x8BE00B677E3FEF46, 
-0xC114F748F6E4E4E2, 0xD47C5D9A52A53EC4, 0x3186D1787D9C76D9, 0x3E7ADFCC0C8C, 
-0xEFC2137B0B99BA1D, 0x11E82C9FA5C7F5A9, 0x7600D3924056DECB, 0x50FB442A5BFA7848, 
-0x59B170D24DCFCDA4, 0xAAA6F523EDC5EFDD, 0x52CD20CACE47C1E9, 0x2573BFA50BE1AC69, 
-0x30F0D64522F75F5C, 0x1EBAE38A9D112896, 0x191B642698774711, 0x2B473B3ED783, 
-0xA24BA842654D56FF, 0x2379678785AA1291, 0xC120742CF1AE9A58, 0x25339FDCA994C734, 
-0xA0046995816559F9, 0xE645E8CA47209500, 0xFD25405E47D07BD8, 0x7D6DA28E2DEB75F1, 
-0x2B4480EF2D486CC0, 0x2F8C98E77622A942, 0xE140933ED1594A5C, 0x20603A5BB484, 
-0x50D081101305492E, 0x2F043B127AFE178A, 0x42BFC92D955F9ECB, 0xDC21A7A0E23649AE, 
-0xABF7E92A830489E, 0xA361B97D76607818, 0xF91EF83AA1294E0A, 0xB8B8F5352E2D4BC5, 
-0xB7AD5A8B7F09D20F, 0xCE9B0F8BC584E5C0, 0xDA1263B7E4E6CC78, 0x63AF5B39BBE9, 
-0xC1A7BEB24E3E6D5A, 0xCBFC528790F46F49, 0xFDD318B4B6459CB4, 0xAD7A5B3E81091008, 
-0xFA24102D5653ADD3, 0xD020CA924FE80A26, 0x6554421C7C5A91E4, 0x947F0D01B08DBD6D, 
-0xDCFCF19D77C32255, 0x9B39C8676C88E7F, 0x1DFA7120DAF47EFB, 0x646DCE85EAD, 
-0xF29C58FF45922112, 0x7C0B050EB3813E2D, 0xDDA259387960AA6B, 0xDF257E8F5279419C, 
-0x7988BD53C4FBD0C9, 0x1D7DBA822E3DE6E4, 0xBB06252ABCA8E740, 0xB13B6F2A6539541E, 
-0x708389FAF27F4560, 0x1C631D0CE632A029, 0x123C7A57B07D0809, 0x21628FEF25E7, 
-0x92D4C488078CF21, 0x30F9CFE3D175C46B, 0x15358A0C76EE43B3, 0x1AB44E69A9039712, 
-0x67876149A0806045, 0xB0A2C566F678E06D, 0x986B07F5C0F0DF9D, 0xE23E7CDE916965CA, 
-0xC1D68EAF122FD51C, 0xCE8BC8F67E4E80E4, 0xE176B7365ED768F, 0x5A4694BFAC9F, 
-0x833DEF87D20F2EB1, 0x39BC8785C70DF66C, 0x222781417D728E31, 0x54B2CC71E9D42AE7, 
-0x628A51B368BB8E34, 0x55CAE9BA68377935, 0xFA8183510070D8F4, 0xACFCAD53E3A42941, 
-0xE1066CE1B6124101, 0xF9A8523E2B690DA8, 0x76C8F0D7595E6E90, 0x2E6E73457D41, 
-0x81EFF51E302CD81C, 0x67EB55D87F18E2AF, 0x3782444C2145B4C9, 0x4783D9B1CD6530CB, 
-0xD50EFF6F21231C80, 0xF4EF1AA61C3652FB, 0x415CDA015D0BE81, 0xB4A742CA67C5D28B, 
-0x9438ACCEC51C7097, 0xF25473DDBF53AD27, 0x8E2676AD0894B88D, 0x56FAA20783B3, 
-0x29DBA9471C84B54F, 0xDACD9974648C42E3, 0xEA8B451A15AE712E, 0xF01AFBFFBF9F7375, 
-0x40C961278C95C6D0, 0x733EAE8AD308D2C, 0x4F838DBDA28D11B6, 0xDA9324D30EC9E9D7, 
-0xE540DEADFFACEC98, 0x5448CB1549E8A3D, 0xBF6F1D34CAC113BF, 0x54C712EBC89E, 
-0x438884E618D70803, 0xF1566103F3B55FD6, 0x14852D790C2B6300, 0xB0991A1407DF23A3, 
-0x97C3020D9AEBE353, 0xB0B913AE38FC86CD, 0x27CB99C0FAD795CD, 0xAF11CD8B57340AC7, 
-0x4C6941ED4F90ABE0, 0x85EC0CFCFCA0A2CA, 0x9F625ECCEA10B762, 0x541536A11585, 
-0xBF3106CDAC5C9491, 0x4E17ABA0B4E16D80, 0x14E6B541E9BE799A, 0x1DB30B764F56A507, 
-0xBDE3A5B8BC20B284, 0xD0F52C065221C7B0, 0xD07D478DC1A7E496, 0xB8623E106BC5B28, 
-0x4663BB5E91AD0506, 0xFA878813641E7898, 0xB86D40C4976C103B, 0x4E30D9D0A8B4, 
-0xE162A28F1C29A574, 0x366ADF7110365570, 0x81241ED22CEEE215, 0x70713A644085B162, 
-0x822C53C6EDF0E91A, 0x7B886537E33F37E1, 0x3B2D1393D8BDAB06, 0xEDBDADE32E6D3F03, 
-0x1B3218F8BAF48547, 0xD515C9A835ADF827, 0x5825DC4945AFE78F, 0x4EB6A19B88D3, 
-0x7C61581BE4E250B4, 0xCB1E2BA3E18E6BFC, 0xD941A95EC969682A, 0x1EB6F8014FD56E96, 
-0x93F99F0A85F4335A, 0xFD687A3670A8EE0D, 0xD5D22AC6D61AB56D, 0x7460C77CE8ED8EE7, 
-0x7166CD94028F9073, 0x5712E1B602FCEB9A, 0x923ABF4D631E53FA, 0x4D04365AA5AA, 
-0xE2EE0A44079F3DB6, 0x54EA4CCB672517C, 0x4250C41795022095, 0x2ED5E54583F570CD, 
-0x9E907DF26D6C6C56, 0x60278DC458DF0235, 0x4FA6AD45C21149B5, 0xC73ADC83FE0ECDED, 
-0xAE2C7E9445CD656B, 0x3023C574B1C1CD18, 0xCA2DE0C91CDCA775, 0x1E8BE56E0A4F, 
-0x4FB94BE9D7B46AF9, 0xDF78F2A8988710F2, 0xCC4986F0675F4C51, 0x586B9F2E336C15DC, 
-0xA9A88C3441AE7990, 0xFC446D28A12C5256, 0x893790114E80CD, 0xA94699BECF02BCF4, 
-0x1B34BA2E2123D55A, 0x26E688A70A5E2F00, 0x2F587C7BCC3FB374, 0xF4C73233E24, 
-0x62C24448DCC71AF6, 0xCA5312D096D50E0C, 0x9EC18FD9A4162EAA, 0xD872FB7E51712854, 
-0xB374E8DD4D9E81A3, 0xFB1AD0BA47087686, 0x123A334DBF6AF49A, 0xBE244F1BD1F99E85, 
-0x1320AE11DD27D7EB, 0x6908F12F31BB4089, 0xFBC71A6E2E971CA2, 0x628A658DD501, 
-0xD24D2D101F8263C9, 0x8A7857A0286318C5, 0xAA6F56A3BFB41491, 0xBA17976C5DA47029, 
-0x6D008A849EF0D29A, 0xD26572F31AC2E918, 0x1A6BE25DAC89AAFF, 0x9E696AA5FF43884A, 
-0xBAADE86D76E4D139, 0xE529A373BBD2F1D1, 0x173DE56601D9D80D, 0x4720FD8E0683, 
-0x275FC2452FAD07D6, 0x36D2105BA2016DC7, 0xDDE4BF611A55EEF1, 0xEEDCE33C35CDC3F9, 
-0x22B87CBC89CFF999, 0x47587724491CD3ED, 0x685265705B2416F3, 0x7A04F922DA8E607C, 
-0xB43599950A8EC958, 0xD11EF637DA1ED5CF, 0x781D9D3E6E6CC838, 0x2B0ABD00FFB1, 
-0xF5B71B71F7B352C0, 0x76E1DEEC8476B0DA, 0x3BF9F92A1A14CA54, 0x1EA9688D50FE873D, 
-0xF444E9430CA46FFF, 0x77271FF7FB6778AF, 0xDAC2A4C0E5F5F4D7, 0x3F96FF69630F8377, 
-0xDAC1A49A368D2D11, 0xD7046C9B06B759D1, 0xBCF303677A804378, 0x606AF5BDC5A, 
-0x683399F50A201BC1, 0x829E4BCCBBD08660, 0x25C9A6B53124EAFE, 0xA366982923AB14C6, 
-0x3BB84D9B71ADC79C, 0x775045E7A6239F92, 0x2D65F68DC371AFB2, 0xA0DF339FE0750F1B, 
-0x647CE1A209C49159, 0xBFA80A26E017D2C1, 0xB39E60A375886DB3, 0x3236FF00BC94, 
-0x203784AAB72B4368, 0xA687CB31160FD76B, 0xC13F88DD31E97D5C, 0xB5A48B275E6BE65E, 
-0x96F99BB1660F2BB4, 0x38F3A061AA27D10D, 0x8834838F34C0AA71, 0xFF43B03DB71B9CCC, 
-0x7A0FB1DCBAFF291E, 0xE06BD802188F313, 0xECAFC2947C76D5B, 0x66C98DD30C08, 
-0xAFF476775CC467A2, 0x98CF8F8B9AEDA4A5, 0x83FE5D0448121CE8, 0xC433CD7BF9523C8C, 
-0xD2EBB2859BDF71BD, 0x76B3FEA6045EF275, 0x5258DC7FE2B7CA54, 0x5A7FD89D4E64AE0B, 
-0x2C3024F67996347E, 0xB97074B9379264A5, 0x6A36170FA5D32B8F, 0x2EEF9826176C, 
-0x70C3A08869158B20, 0x968D2730DC32585F, 0x4DC7748DDDB33185, 0x468FDB687E86C6DC, 
-0xE2ACD03427251E4F, 0x9200A5880A6D426D, 0x949451422DE62142, 0x4189D7D703C3E3E8, 
-0xCF8E1A91266CE1A4, 0x680A7DADC922A85E, 0x9014E5734BD288AC, 0x15F32AD90706, 
-0x3B00C5CF3C6FE956, 0x55E94DA0AFC01260, 0xE3B7F33511AA8AA, 0x55093544D9BE4673, 
-0xB4BEF7195C730DE2, 0x6AA919BC64053492, 0x8FF26667B78FD3CA, 0xEAA9EFA787F200CE, 
-0xAF3A0B60FCB6784E, 0x668A2F5DFB2EE22C, 0x97C9ECB28E7B8F22, 0x1C263F1C6F1D, 
-0x704F99FED6D529A8, 0xFA0046CE42FE1D40, 0xD8F73F5CF0A1119E, 0xFA3EB66A08E4CD7C, 
-0x6AB50B5D0FDD644A, 0xFF8FA9EAC506D196, 0x783E6D719E21C45A, 0xF294657F02B4E85E, 
-0x9D62F0059D867326, 0xF420879B39922B6E, 0x8F65C644AFD106AB, 0x481F4CEDDB20, 
-0x672D3F80863C01ED, 0x5E5D319B05DAD5C5, 0xB8A85D33B6B86AD3, 0x4EADB64C9B6E7A1A, 
-0x42B0E6C03171700C, 0xA6B01C7414C7D3C, 0x96BD9D0A9C09A64D, 0x31564F429C1CA96E, 
-0xFA2561E503A863D4, 0x3A40F91E829CE0D, 0xF9AD0FE35F7D85DB, 0x547F900FC0FE, 
-0x7236016F58972196, 0x5A0D9107A5ED8708, 0xB687834D90CBD220, 0xB8189ABE7779DB35, 
-0x1FFE46D5F27DEC47, 0xA5EE04C778C60BBF, 0xECA5A0A92974444B, 0x7829387DF1D76B2, 
-0x652C858F44E83E99, 0xFAFB9F993B1A84C8, 0xEB34C47924EF133C, 0x60CEF352961D, 
-0x4501AF389FC8DDC7, 0xD35AA7CB6CAEFD79, 0x74A184A6C3AC0611, 0x802BA3E8478B7D11, 
-0xB6865035C88246C9, 0x59EA3EBFCFE17964, 0x20B491457652EAD1, 0x41068C6DA10B0474, 
-0x4EE44073638A5774, 0xDBF0286ADAE74339, 0x1F0FE2523F7D66E0, 0x372088C67233, 
-0xDEE0FD37A48C887, 0x59F4253896107659, 0x38508609398B0B43, 0xE6D8A07EE2399752, 
-0x7DFF7C26DBA41D1D, 0x9B97B96C8BCD5062, 0x6ED1B07E3678A7A5, 0xA7FB97413CB09AAC, 
-0x30911644AFBE66B2, 0xEF922DD9EE2BF113, 0xF95FB2B8091F7F53, 0xA5017E85A9A, 
-0x93FE27BEEAB12506, 0xDABE4D0E9BEBAFC1, 0x28C30976D9D39B25, 0x276F263BEB8E0CF1, 
-0x730BF6AE4C9F5050, 0x8A8B15571FB9692E, 0x955214977993BF61, 0xF37A7339880AF55C, 
-0xA1555E6027E3B7A1, 0x763CFED3F4312DA7, 0xDCE8AB30661E70F1, 0x8DCD2F8C8CA, 
-0xAAF98A3D5850CBC4, 0xCE3C0D24C51CF07D, 0xC617A3AA82B4BB2D, 0xE19B79AE0036E960, 
-0x9797B16C61B9BA71, 0x241BFECFA6C70BED, 0x99E62378E09E83F3, 0xD3F09DE83529EAD0, 
-0x52AF31F7B986F5E7, 0x2BABC08A2BEE8EB7, 0x712558F75BD2CFCF, 0x4B6B6AAE615, 
-0x8FC352E897332EA0, 0x8339C1B9662A48CF, 0xFEDB1BA236804A2A, 0x6E284E978A4B3DAA, 
-0xF8BFCE1FC68715D1, 0x502B573A5AF25E4F, 0xCEF395AC2889CCE7, 0x7E5E5EF8B28C5C9D, 
-0xC76DDC9B89A3144, 0x5E9E829680CAADB2, 0x9997A36BE5F0819C, 0x5AC0523E6ACB, 
-0x436855D8B6D180D0, 0xAF8B3821727FC5D3, 0xD807122ADAD66237, 0x492B06F8165F3FFB, 
-0x7522540FC9DAC620, 0xFF96FD3EEEDB50B0, 0x3FDCE3A4D7B66880, 0x1710652BCCAEAEBD, 
-0xD203072265AFEA13, 0x3AC98D2EBF6C1410, 0xAC56B3DBBBD0D247, 0x2DFBDD8BAE64, 
-0x583FC2F2A7D124C2, 0xFCE257491485D382, 0xBDD3CEA84C8D3F2E, 0x64ACB4B59BFFCBCB, 
-0x2F86B6CC031400B7, 0xB5A901AD0C1D7DFA, 0x29D2B616F4D2583D, 0x951F1982C60AAB5C, 
-0x6EF2D8243961BCA7, 0xD43F6D8F8C020969, 0x70E07AECBE16EC9E, 0x1D01283E3C7E, 
-0x1E549139C9DB54E2, 0xD1424A096B74E26, 0x525E449AE284C901, 0x30CCC2BC2E50D71A, 
-0xAAB6B289E6B9DB17, 0xF3BA1C80DE40C043, 0x5B79264728829B2, 0xECB9ECF7D2098D3D, 
-0x8A0803CA72A9A619, 0x79D0AB6365DE01FB, 0xF52FEA66768138E4, 0x40A1F346DAD4, 
-0x713F1F8D5455CD5B, 0x36BBE02809A4E7E6, 0xC76E604251713FC5, 0xE6936145593921B9, 
-0xC6E1A8EFB6BFDA09, 0x52C4D3B7044793BF, 0x931EB521A9912056, 0xE9238A71E1DB45A5, 
-0x2D7139C6502C942D, 0x2E0D205664630468, 0x6720286566AE5F08, 0xDB4948D0158, 
-0xA32E21A43D2CBC, 0x627DEF9D9C203ACB, 0x98D3185090DF2183, 0xE04C362BA47B348E, 
-0xDDA5F5080B80255F, 0xDE736D79CF0F1843, 0x4E965A4248853055, 0x69FF9983CCA85275, 
-0xA061EFAD2B3446F, 0xB23C923D865224D8, 0x354CDF3A57AEDECE, 0x3C785847BC70, 
-0x90385416B01AEA48, 0xDFFE3D554DDEA4DA, 0xA780667E05486C90, 0xCB078589825246C9, 
-0x978CD9FD291F99B2, 0x2244D7A14756CE1E, 0x20D6F73BE501C9B3, 0x9D8E35ECCAD0D919, 
-0x72A47BDB73378B00, 0x466FCBD4C8564D5A, 0xA38910F5ECA3BAEE, 0x277EB9DC1C2D, 
-0x5E25E669FDA6B728, 0x7DBB7EB476A0F726, 0xE15962CF83DFB975, 0xFA58C375F75AC8F7, 
-0x63B8EFEA9AFE234A, 0xEAC49F98AE0D6C45, 0x1A65E301468BA378, 0x1EF398AF66E2B34B, 
-0x4927BA123A8E45D3, 0x5C7C8A1A7E25D002, 0xA59BB31EA09BE172, 0x18C2E3DBF8D7, 
-0x873837CBD6DCE0AC, 0x7B5811F14E81EFE3, 0x4B52A3F205DA400E, 0x20E5D293F88FD3A2, 
-0x169C604185735CA6, 0xCA820AF4DDEC0A6F, 0xD38879D69404E802, 0xE0BEE812BEC87FE1, 
-0x87565FE864608771, 0x26474EB058746B62, 0x309F3A24B124C9D, 0x150C74822011, 
-0x81B5DE654B2CF027, 0x7581537EB9B7F373, 0x7748E5AD76CCB131, 0x9793AAD2493EBE06, 
-0x681EEA79200F14F4, 0xB31A9657D981CC60, 0x6C3EFC847C6B1C84, 0x78E15C90B7500E78, 
-0x765A3EC6EA45F14E, 0xC6474059122BE4E4, 0xA86BCDB5A53C4411, 0x15CF77FB4FA5, 
-0x40F85AD5E3B76AF1, 0x7AB777F1BE1A9E80, 0x3DCC9DB7922301D, 0xA3777C740A6CA930, 
-0x2E05A596D494820C, 0x5AB442E10C23BE71, 0xC60786D22000AF9A, 0xA06FEAB09C8124E9, 
-0x3EF23C4ABC6F4AE8, 0xBDA5ED6D281828C, 0x8DD9EA9718223A4B, 0x18D1D9DAEAA2, 
-0x24CC1DE3BC5FA190, 0xFBBCBEA2A21701EB, 0xF981B7E5C9C41614, 0xCC6C87EE869CF81C, 
-0x19808F8940BE707E, 0x26E2DB2A0AF50D45, 0xB367E9BAA91B6F70, 0x6224069A958195CC, 
-0xF01772C7E68B5698, 0xFC181F19879362AA, 0xEBA39141D8BFE496, 0x5DC8721CA010, 
-0xB03CDDE4E92BA39, 0x2A5E085F823A492F, 0x115EB4A610225F2B, 0x6EDF1E786AF2DCF3, 
-0x22FBA2F8187DB0DA, 0x37A4A6AA1C7F6E3B, 0x529F854F7C0E33C7, 0xA091A58C8F54957E, 
-0x7FF0F2EEE318C31A, 0x59A9C6DB626F8458, 0xE83902BDC1841624, 0x1665EFA7E43C, 
-0xA79B51CC0FF8DC5B, 0x33BBC14A9D505315, 0x8705BD05BEF8F76F, 0x5A01E3701AA1AEF, 
-0x687216CE1B4D4F5E, 0xE6F56D2B7B5E1F94, 0x804B53B4EC77DE89, 0x2A2ADFFDAAEC82E1, 
-0x87366ED4F8F1B0FB, 0x822F3A1AA307EA95, 0x167B37B766B19841, 0x4EE6D77ED6F, 
-0xB4E79B2C7118E0B7, 0x92AF4E4A556EB62, 0x899F72D3AB84E2A6, 0xD027ABF5D91A7F0B, 
-0xFEBFFD4664436702, 0xB8AC11B6DC3860AD, 0xC374D9ACEB3FB2AA, 0xD60C87E2D6820484, 
-0xA735586B770205B0, 0x8970639AB5773880, 0x515CA28C7D74C119, 0x91BE9D9EF06, 
-0x2DD3EA6F71F662D0, 0x4E08197F14342A0F, 0xF61F7E0D22FB6805, 0xDA273CEB1CC03C7, 
-0xB803A52B569A08F0, 0xEB53EC4A44237D70, 0x5515E3BDBD5B1486, 0x61D12EA2ECE74072, 
-0x92D4FB34653492FE, 0x8A4EA9194FBC4B16, 0xCEBC9E26D7BEA693, 0x5B744983A2E9, 
-0xE0C7F89BAC9CCC54, 0x925F08B406C20C2E, 0x11264B100AFB9387, 0x95CA7146016E7413, 
-0x61AC9B06B3FEEED3, 0x3EB36EFD235623EF, 0xFB658D53B7A37EE7, 0xEC675BAEC68D1757, 
-0x4F7BAC4A91142118, 0x6F21E81D1C951544, 0x36B2F6589688CBF7, 0x3C09FFB2A1EF, 
-0x8E0CE13D65460960, 0x132DF80092209111, 0x7BA420AF4171D806, 0x5A99B01CAF6761FE, 
-0xD81A08BCC23FEDD, 0x38BEF4CF5CCC2A0, 0x7ADC6782B461CC8E, 0x6FA8B7067A9DA4E0, 
-0x10517CD5AF5F8DA4, 0x55E7DB2E608D697D, 0x72DF1EE52B833F18, 0x38856FA8607A, 
-0xF7B396E138B2BF8A, 0xA27D8CD57EBE7707, 0x47251527E0526802, 0xF428DF3C092F5924, 
-0x37F8AE4F4213B5B, 0xCCD2973FAA5FE96, 0xC2CDC57502C73C35, 0x33E497D6065B5FB, 
-0xF2A2B0EBF88D9A03, 0x2227D986EDDFFD2F, 0xDE83C9FFB0E94444, 0x5E1FB4D992D7, 
-0x178B1BDDDED9B017, 0xFC54783737780B6D, 0x5F2D243CAD7DDE5, 0xDEF8645D377C57F2, 
-0xE187689EDDD36F61, 0xA1EC2B20AA6872, 0x4FD8226F64A5242F, 0xE252E535EDE7C614, 
-0x290C106B09E61188, 0xA43C771827B7B6BF, 0x60A47ADB319EC5D0, 0x3046875DC4B8, 
-0x5483B5F8A29816A6, 0xE2D5E2001AE0348C, 0x710822BAA2E918AD, 0x1B594E850B8282BD, 
-0xA48DD30727D26E13, 0xF81C7061ED966A31, 0x83E0C92D108A375A, 0xC86941A2BB444002, 
-0x48A31D7A04A84D79, 0xAE49DAE0A64EE1DD, 0x4072750007DF17F6, 0x6020C67EABA4, 
-0x9485AB2F6AB1E611, 0xF28F12BD64DCE521, 0xFDCCCE9488CF5FA4, 0xB557BA8763D624D0, 
-0xBFC69F34FDDD2160, 0xBDCB69A51628B108, 0x6623A545D18F732D, 0x4CCFA5F43659E03, 
-0x6DCCB6E00E8A2902, 0x6009474BBF200CD8, 0x5A4EFB9C181F77A8, 0x46D9B927CC2, 
-0x9E1BA76756A12139, 0x3A2AF57626909400, 0x845F2D541745111F, 0xF7A972D4D4436C87, 
-0x115A8A70FE286E0B, 0xD959D6C3F43C68AC, 0xB7604D056B759A34, 0x647499B12E580FDC, 
-0xDC3EE51E75913F34, 0x7E0988D7CDE04E3A, 0xE47754B2696BE6B4, 0x4FD53401F0C5, 
-0xC9B5442107B4748E, 0xA5277D5761B76E81, 0xB72BB20DF0DB31BF, 0x7513A64001C4ED45, 
-0xD13331711E311DA4, 0xD39D4FFA27D50829, 0xBFC5B71DB13ACF4C, 0xFE7A6C08A3D15359, 
-0xFCE413D709D86A3A, 0xC806ABE00054AEC, 0x329ADB466E40F306, 0x5B44CA24AA83, 
-0x1E0B710450394AA7, 0x9814E3DFC92FB44C, 0x3C344932A1F1C1D4, 0xB7A3EBA25AC86BDA, 
-0x9E24E202A46EE4E3, 0xA7E16ADB8143F75A, 0x44E3E803C9E60745, 0x1AE90A28AAE38CC3, 
-0x3F0DBA14645B8C5B, 0xD2E7226EA9E26FC7, 0xD5AF9BD67FCBB208, 0x6EAE4E3B7FDB, 
-0xB686C6E47BC4355E, 0x78ACD56442ACBD3, 0x40EEAFAD743D260C, 0x2C7ACF1E7502C4A7, 
-0xFF2C91203746F225, 0xC364801E3F125878, 0x4737757D4CD3D64C, 0x64B34F9BE373EAFE, 
-0x2F7F536656414F5F, 0x201A750D191A3108, 0xE4B0D61A4BE49982, 0x4227A2B849EE, 
-0x1B51353A513A905D, 0x28B75332E7106C03, 0x5ED644CD081DD1F1, 0xB832A45F4FE116EF, 
-0x6CF21048524246B, 0xD298FA50192C2E05, 0x523E0A7251E9CEDC, 0x99DB15DDC8CB550, 
-0xCF98790FB0186486, 0xDBF307FC313FAF79, 0x1CCCA3FC17B8045C, 0x66924DEBE622, 
-0x80BC92E09AC85DBD, 0x716373C62020E672, 0x9FCB3524A45BECD4, 0x47B4BCC5805FB509, 
-0x64ED5B220B979C69, 0xD4B618519EF143B5, 0x4E63F9CF31819BBA, 0x5F49C23E2249E4DA, 
-0xF63671586CA257AB, 0x1D6A41064D2CD8DC, 0xBB91A4AED54A261C, 0x6E2A07A699C7, 
-0xB2F7DEBDC34C77C4, 0xADE69119F37155FD, 0x9A05DF91F1957868, 0x7B92B34085514C05, 
-0xC19F292398D8985, 0xCBD4F86A7A32F9A6, 0x4E9E9D41F35E5D0E, 0xA7B79466B481A0BE, 
-0x5C4FB47E2C082AFD, 0xEFE864F05AB00646, 0x633E63D4C9E60045, 0x3E819083675D, 
-0x39794FE2C58753F0, 0x1619A45E4B181BE4, 0xA4AD504CF0DA91F5, 0x8299E305B895CC36, 
-0xDBF6330C7C2006C5, 0x8263E047FD6BD470, 0xECFED56EA564C6CF, 0x5EB6312D71E90135, 
-0x8CEC8DAD4D020328, 0xB04C806C4B5F38D8, 0x658926BB0D31B336, 0x45314E16B022, 
-0x3C7ECD3EF1D91171, 0xB52B0625AFE8056F, 0x648F7B001408020B, 0x82FA1AAA3EE9506D, 
-0xE169E9FCB99E4031, 0x7216F70BB089CED6, 0x2347B2A4E66818D1, 0x45078C0726CCAC51, 
-0x85F1E69FA5F93B6A, 0x6F12F9A6FA683D5C, 0xE3D715A3B6E873FC, 0xC970BFF5934, 
-0xA37109899FC2A527, 0x765C2809ECFDA9E0, 0xBB946ECFDA1F78ED, 0x298695735FC3F045, 
-0x438416D4B69B7509, 0x1572AF2796EEAA17, 0x1100039850ADCAC7, 0xFDE9FE890D2C0A04, 
-0x2F4EC26EBAF92AE3, 0x2BA585AEA1367E25, 0x7DEA965C741C8570, 0x4F02C537C380, 
-0x8004342FBED3F4FC, 0x5577E9159C96FF07, 0xB9E2A34B7899B016, 0xF374B897A6A1CDC6, 
-0xABCDC8B687865246, 0xD3777F37D2D84747, 0xF1AC2868DB789324, 0xC221B41083F5EE23, 
-0xA23B0A170D7B3237, 0xAD7820349512E135, 0xF291AF3DE0B72A03, 0x60C1EF614070, 
-0x50FF13FB249322B, 0x42CC11F809D66966, 0x9429432B6F3259DF, 0x822AB5ADE581895, 
-0x8F6D8B6DDFDC91C2, 0xF8C868D8BA5D50A1, 0x7EB9823389628DFB, 0x8A2AAD5A73D46896, 
-0x80114FA80C003061, 0x6D986DFBDFB568B5, 0x8904912867F02943, 0x6F126D0C29D2, 
-0xBC8289ED2B72D2FD, 0xD8CF628CFB1B1BD0, 0x66E568C252929296, 0x42488E5036AF9CF9, 
-0x41EF4577C387F7C1, 0x2AD647BFB53BF403, 0x3178CA3AA4D7BDEA, 0x5B8644D1D19D74A9, 
-0x1C335F5377BC939F, 0x29D8457F88805E18, 0x7B03C2E4B4AA8BC4, 0x6C3F49809770, 
-0x5C71D282CADB92FA, 0x94C3184A09FF2A99, 0xF2833AD7B233BEB4, 0xD27C51E4D80764FF, 
-0x7454813FBCE5A23, 0xDFA52D8BCCABAFC9, 0x5DB613968D6FD9CE, 0xF84BAFC2A4138C39, 
-0x5AD5087A3AD5AB09, 0xE2980F11854618AB, 0xF55E531A666C3841, 0x2DB7F898EEAB, 
-0xCF19754DAD49C04D, 0x687E8D38C3A33A85, 0x16F9531C81E30CAA, 0xD79905DAE6E51A93, 
-0x47F27DB37384C160, 0x24B6015D2B044F08, 0xB2DDBA5894D6681, 0xCBD181A6C3A4E450, 
-0xA4FE0D54179E60BA, 0xECC3F8571E37BE6, 0xEDDA88E5C1E2C8D6, 0x7A881A16517, 
-0xF3E539E10716D608, 0x5E29AD2C2B42BFC6, 0xA9632B693423F50C, 0xB0618FEF0D6A92B0, 
-0x765693BF97AE3FEE, 0x173B9CA58A5E3D81, 0x5C19C97C923405A5, 0x12D62DFAA46706E2, 
-0xC7558D0B5DE08FDA, 0x46030362C8EF21E9, 0xE9809502B707C384, 0x65ABBBE31309, 
-0xA5CD63CEFD2E2069, 0xB3A0EE61971919BB, 0xE5548D9D56D7F318, 0x16EA8AE8A0DE35EA, 
-0xA92F988C4B5A2E40, 0x6A2CD9B11670E694, 0x680C81A1A874E7AA, 0x7AEC996069DD6821, 
-0x1D6AB84B453E2346, 0xCEE7B8A21086071C, 0xA23E59DF2152615D, 0x5315EC6DDEF8, 
-0xAD9D2E22908E4B4E, 0xB7C5F9B3C44C8BF0, 0x3D0FDFE0BD5CAEA2, 0xBAB715DDEFF428A7, 
-0xE7F68E17F937578A, 0x3E28EBFC407C72F3, 0xD8E097FDAF2B32DF, 0x94D11AF2CA54A2C4, 
-0x46F33CE0A1592F31, 0xC4F4F46995D011AB, 0xEF42684EC90D099, 0x53735B9BB7B6, 
-0x741900A3D739DB56, 0x57D130F58D443F1F, 0xD9585F329E6059B, 0xEA487B1B08EEE667, 
-0x1D4B5D15BBCEE5C3, 0xDB7AA5BBD51E4307, 0x7C3A2AC64618C914, 0x5AEBE219A4E936E5, 
-0xD854B8215AC62308, 0x19E911D6180E91DC, 0x1D4CD1EBF0720EB2, 0x55F6646B5BDD, 
-0x41A95853FB019BEC, 0x323D8E41F2AECED6, 0xDB6BC28A9138C656, 0xABF047D10BD6F31, 
-0xF9195E4833A05F0E, 0x1CC7ECB0C1209F9, 0x5B79658019D08D00, 0xCD25954A7571466F, 
-0xD7E1341FA527FE65, 0xF4CD95E4ABB8E797, 0x50555CE470F7556C, 0x13DA0F48DE9C, 
-0x9EE12F11DA9FDD52, 0x4E17708C910EFE1C, 0x7CA000CDCDCFF69B, 0x77FD9CB7862B6F8F, 
-0xD40E0472111E7876, 0xE2E1071EED30BE95, 0xAFE0265FC01CDC5C, 0x5A71DBC19AB8E33, 
-0x165A67C2C64EE684, 0x3FC0F6A321B88196, 0xE1C5F86AAE4CDB5E, 0x4092779529D9, 
-0xE5BEB72E3AFE412F, 0xE9C788623BDDC4A0, 0x6D4E578A4CFB2EC3, 0x36235FBB508400C4, 
-0xAE649EDADD9A374A, 0xAB8E840186D928C9, 0x90EB0CCE6435ECD8, 0x45A68F2FE5117B21, 
-0x3A7AEA7226EB2AF5, 0xF819929F379D274D, 0xF7FC3ED3DC532E17, 0x199E741B1552, 
-0x9E3F15CC397A82D3, 0x1C5E35BB51EE1DB3, 0x3497B4A193EEE405, 0x6B4A7906C7B6A28, 
-0x533E8B6CA4AD8AAB, 0x3E67164A19121092, 0x26BA6F4661AE3EE0, 0x64AAC3B6EDC5E2E3, 
-0xC1182DF372A29010, 0x65478CB6FC93A224, 0x710247C42C880CA, 0x67E13F550BD7, 
-0x3CEA2277962C931D, 0x7D06C145DFBBCB02, 0x1382326FE815B896, 0x7F7CC7D8D1D24DC, 
-0xC89B9BDC1E8B836A, 0x218FD35B7E293B3D, 0x35E46EAAD54D51B6, 0x9701331EE4C0FFB2, 
-0xDB40BEA01C8C2AE8, 0x29007E4DBE6380E, 0x4E71BBF1C24A8B8B, 0x14595F4922, 
-0x1E73D826DACBE061, 0xCFD965ADF8463C7B, 0xFCE9D8F7A7EE13E, 0xCFB5F54B74991A41, 
-0xB4A2AE141AF3C1CE, 0xEF8DF533D06DA69C, 0xA61927CDE98347A2, 0x27C60216BD7BE6BC, 
-0x8A896B02A1A8F117, 0x6AF30282E9CD2DD6, 0x3849C97200BDECBC, 0x4E7F32647DA1, 
-0xA4289BA013077054, 0xDA72E4561340C2AE, 0xBC434EF5E80E0024, 0xB892B8DC7355FE05, 
-0x896C8EE595790F50, 0xDB6A46126C1F2CCF, 0xDA30C1ABB39CFA38, 0x3577C8C4F9DE4FEE, 
-0x8DA507D0E77C44E1, 0x8ED26B463908567B, 0x2BD28157B3073DD8, 0x5E6AFC926A0, 
-0xFB7F2CA5DC9F77AD, 0xF2752FC70AC73FA7, 0xBCAEA18F9001CF9A, 0xC51006C571ECE797, 
-0x870A4CCCEFA5246B, 0xED728D1B4E28A51C, 0x1EB0184132562994, 0x3B5BDE9A8B4D998A, 
-0xABCCE1CB074593C3, 0xD2F7087CDA7EBC73, 0x273ACC7B4D9EDFE0, 0x38E04BD743F1, 
-0xB3F34235E86A4D73, 0x47CF55E20D74C5DF, 0xF1A1B68D66ADF6C8, 0x1D2458433E466F9B, 
-0x19EDBD2C8EA2D2E4, 0xAAA23EE195747D9A, 0xD40A47D5E85C037E, 0x10219E3FA176317E, 
-0x102FEAF39696009F, 0x60712B3D0A70CCCD, 0xE6FD354F496A6600, 0x35FFC6B7AEF9, 
-0xADD20203614EE989, 0xA76BA86481617742, 0xD300B9EB9586AEA8, 0x82151C4374333606, 
-0x4EB29B5F3A68BEF4, 0x37218E5950F865FA, 0x33894F369F9292DB, 0x11FC90EA829E51D2, 
-0xAA38F79368829311, 0xD5C31F5A927FE8F9, 0xE849E889927E15C, 0x6877223F8A30, 
-0xFBF1998BF687B12D, 0xF137A3D903C58EDB, 0xC76921598D32D225, 0xCB972EC194C0FF9, 
-0x1387D4350C1BF167, 0x81B0160AF7FCD221, 0x6FD927BD03A792E3, 0x80AC759816E029C3, 
-0xF58D119D8ACC57BC, 0xC0F4CA9728A9CB8B, 0x3A456938BE15B28E, 0x4FB9AA9F184, 
-0x50896DAB0B5D6A7E, 0xDE58FAC40955FBB2, 0xF6E3C4ECA3D14727, 0x7155568DDE1CBD23, 
-0xE54F4732EB4DAF3E, 0x98DEADFE38EF39A8, 0xD39150094C2B7660, 0xE0DA6E9264CBB45C, 
-0x997DB471D2DB40C, 0x2A303793F6C4D004, 0xCF5D654247931AEC, 0x2BB399C3288F, 
-0x6D5ABE9825B90803, 0xF7452BDF267B2646, 0x998C8DB3F18CA7F9, 0x280B17B8D8EF3773, 
-0x215DB7BE871C75B7, 0x51F2EE7C8BAC5729, 0xC1A983D9EC1C65BB, 0xD709F18301E30CC4, 
-0x7DE75758D6961713, 0xE1D6052BFB616D30, 0x6A028EFB9A3715A2, 0x5522DB0BE7E4, 
-0xA4A9D2A756FE97FE, 0x4667384CA4806BF6, 0xABC8B8420CA39B16, 0xC6B50941D2D9C6E1, 
-0x769928DC8160DF42, 0xFA48ABF97E905FAF, 0x363C3D1C95578319, 0x57AA896C040BFC21, 
-0x155DF5B3920E574B, 0x548130DC4E10EC77, 0xB5D81E7C4E0E3B38, 0x4AE116D2226D, 
-0xC5E0F292FE03A092, 0x594221B7B3EE14B1, 0xC85FE1D9E1148597, 0x697EB36A5A7702BC, 
-0xF5A0E493C2446E, 0x5E71A12CA3841735, 0x303B88313F3D7365, 0x1B4EB5880E3AE105, 
-0xD1E135E5AF3983E2, 0xAC18F99BE79C8C, 0xE0734B4E188E61F0, 0x14183738C337, 
-0x387C0945ECC98441, 0x279035A974B4CCA1, 0x227BAED2E38AF908, 0xDBB1DBE7FB51FA27, 
-0xFBA63BE051492049, 0x6B889C9F9B8DACD7, 0x521C852AE6DC1E18, 0x2FD861A958E074FD, 
-0xEB1F5EEADCD25C46, 0x7E1C44223579601D, 0x69C41A8060873BF9, 0x55490B9D7563, 
-0xE7DB0D6D929D455F, 0x341A8630393504AF, 0x487E28370830833A, 0xABEE61FC517C51DA, 
-0x8B56BA1C9358C531, 0x860D2DE657302393, 0x130F827750978C9A, 0x6E9A2E772481EBDD, 
-0x6506D04A8E543A0C, 0x66E080A42F5C255D, 0xA13D0450491CB7E6, 0x5267D1F36AEE, 
-0x4CD15B3470F5F4CE, 0x6C6ADBDC1D761BBC, 0x441332B563B79ACB, 0xD8338F883C0D9AB9, 
-0xE1AB08C67C1F1EF8, 0x434661E4F53694A1, 0x4A3C1761C3DB51A6, 0x5807CDE35AE60F8E, 
-0x517B8AAF32E696BA, 0xA78ABBDBA5E0B5F, 0xF4F826D5AB7136D8, 0x6E719E128210, 
-0x84AA4A81EC1A2448, 0x92E373000120C364, 0x32B0ACB7A0651D78, 0x342038E592446035, 
-0x31306EA29027CCE7, 0xE035D1FABB7C4816, 0xE91F44322D898A05, 0x42F33AAD6DD9CD6B, 
-0x36DABC0054F0F582, 0xD458B6757026F8B, 0x2384D516F2321951, 0x66CF98A4B19C, 
-0x411F3CF62E4A09, 0xE4CA8F4D6D2C5EDE, 0xCF4440BD5D313342, 0xA4E75FD4C3614AFF, 
-0xFA37EABC5D52235E, 0x933D3127957BA124, 0x6B599A3896EAA1B3, 0xFAE71183F02E54D3, 
-0x7E6902A3FB2F58C5, 0xD1C3A3A8012CA665, 0x40AEF22742AA63EF, 0x7C9967F4088, 
-0xC5850F335B617613, 0x9335914164315968, 0xDAB9BB0967989D7F, 0x8F8CDAC5D47E5F7B, 
-0x6407F9BE68D5CCE9, 0xFD72D9C16AFF31C2, 0xAA2ECCF24B63690A, 0x648F0F0ED432DE9, 
-0xEF08A921085059AA, 0x7CE574E5A52CE116, 0x873A4817BDED9D29, 0x514831DC9E37, 
-0xEECBFC9EB2B0A4D6, 0xC916292656CB0508, 0x2F9FBCDF4FB8DD67, 0x9321A5557D5E59D1, 
-0xA7C3BC488FAD31BB, 0xBB44FEDA6411F8EA, 0x7461D1DFC5545B19, 0x89E735F3F7534773, 
-0xC858E0221F81FAD5, 0x4CFD1B0091512A06, 0x9188E054C29F9FB6, 0x654E350801EF, 
-0xF35354D24E8D4D05, 0xDA9FCAD7D648C7E8, 0x570D7113E3B9246F, 0x7B2364EDCA78227, 
-0xFDD25B0EAC52149A, 0xE843AAFFD8D52E8E, 0x7161DA6513E6DFDC, 0x6F3D8C08418AC814, 
-0xA2731203E0D08870, 0x6B6C7D4BA0845D16, 0x2373831A13D5848D, 0x20A5197AD4AD, 
-0xBCF97BF526059E0, 0x603D3DA59F8CC1FD, 0xA2B6C3A8B31DE70C, 0xAAD653311E277F0E, 
-0x705E543E1A11E4FD, 0xB9678C8A461FA094, 0xFAB4576CB559925F, 0xC42FBB13729B13AB, 
-0x78EA4C68B4B9EC9B, 0x71CA8F1C2F348DA5, 0x6A28B10D096EC0B7, 0x2E5F9795F63E, 
-0x3463F2A559926B70, 0xDC0E3AC1560F4DB4, 0x2A65C2F4A6A086AA, 0xF68DF9DB38456990, 
-0xDA84ECF6DD39A4A2, 0x919A7C052B669513, 0x28185B9D602D2ECC, 0x593577A630EEC187, 
-0xAC7811B3CD237176, 0x460109F6DDDA751A, 0xC488FF0285B7FA2A, 0x48B7A892AE5C, 
-0xE6A4FFACBA59844A, 0xBBE3EE5A179F6037, 0xAE0334B0631F9BFB, 0x6BBE392A6117B84F, 
-0x4C45BA098A413951, 0x5CC0D3B5814CEA79, 0xE51B8D8BF5DC36AE, 0x70F9BC3BFF76C5C0, 
-0x9CCCED68F8B35755, 0xDC6B3ED8994F23AC, 0x2DFF41BB8861312C, 0x258650A95A03, 
-0xA670361BFC144830, 0xB315F7991AC84145, 0x313A2C8B265428F5, 0xDB4DE6999120FF08, 
-0x308CEC7C2C0FC69B, 0x45F5372FD162FEB, 0x87B529E531C00F0, 0x3C934B42FF30AB89, 
-0xDCF60991822C1758, 0xCC791154458F1282, 0x10EBABF56AD06CB3, 0x152BAA319C8E, 
-0xCFBEC572B63C4244, 0x9B0C2A696596A039, 0xDCB6FD1D4A56216E, 0xB50BE9DDF6289AE9, 
-0xE7C2B23705E4A5AC, 0xCFF8936164E74C52, 0x8EFBB2C3FBA76C9F, 0x9598B4D9402615A3, 
-0x18776C33F6B9B5E7, 0x5E7CC650322CDFC5, 0x335C321BA13FB474, 0x47A0475A4620, 
-0x289451C323490668, 0x4ED414EDD812F10C, 0xEB79E402D46332E9, 0xDC2204F4EA513F7, 
-0x9444AEC18B772CC9, 0x35EA884FE826E5BC, 0x7258D441DFEE8474, 0x35887D3BF55144E7, 
-0xCC892B2D217EFEFD, 0xB25B3950CDA16175, 0x524C13657FEFDB95, 0x74FE5AB487A, 
-0x8EE644109AA23143, 0x9CB46949B49742EA, 0xFB6787911EC3DD33, 0xCB0FF0F4C7522444, 
-0xB8F6F048B767E7D4, 0xAE03DB9360B8D616, 0x873F4134B8C09ACA, 0xEB25AFE893B9472C, 
-0x77E60DAADA48D0D5, 0xE071D71041995CD7, 0xFBC284A4D6488313, 0x38B839D5414D, 
-0xA6F9E9DCC6E3C171, 0xE3BB8DDE1E9C5692, 0x4208482254B92BFE, 0x45DD73F58B92767, 
-0xB6DCE836A174ACB0, 0x3C910A3BF65C1732, 0xCBEDC77308BFFD2A, 0xEA382FB291DB64A3, 
-0x77C5A66BF0EBBBEB, 0x510AC236E05E77B9, 0x4513CC74E04E0DE, 0x126538E0A1C0, 
-0xB44CC504510E87A9, 0x6CBCA50D1AC21829, 0x1E15497592C3B0BE, 0x4CB8E9725579CB59, 
-0x5D0359A90411FE31, 0x653AA2CEA7A8AA98, 0xDA7FB366C873BFA9, 0x1B95330563F427EF, 
-0xBDA0C8338CB56415, 0xFFD54091413EF4AB, 0x8B289DBD68DDE274, 0x295E6F35C66A, 
-0x3CAC57EF09D06E7E, 0xCC6DA4032192A8, 0x16E51DB01B5AAF01, 0x7D1BEB970AA917CA, 
-0x715055D3FBC812A8, 0x67BA70B600314E64, 0xC144AB30F0086818, 0xCDB32D9EA00F04DF, 
-0xDD7C537C3D7047AE, 0xCA4FEBBAF103CD4E, 0x62D7F2AACC4B8EF3, 0x5A96E58F0518, 
-0xEAF2F6B9F6D6AB2A, 0x8E54031983F630E0, 0xA432587231B1AFF1, 0x78F9BDC8B942223F, 
-0x7849F57AD69BBB09, 0x730A92CB86B2DF63, 0xFC76B3E5F8BCCBBC, 0xCE4EF5CD74C2C12E, 
-0xDDC087520933FC89, 0x4844CB545019E77F, 0x984693FD8CFBB698, 0x12E24D3BD8E7, 
-0xB84F20CE2A1A78E9, 0x7E9D0639C1ABBB5E, 0xCC6512CDFD1503A7, 0x799FF1E08B0D4474, 
-0x208F6C5007C3E5E9, 0xD2F74BA1425860E3, 0xC20B66FBADCF2A5A, 0xF76E8F44D6526851, 
-0xFE097DC8D090B689, 0xD5E8CAC3385A1CBB, 0xA8EF981BA2CBCB87, 0xF50D430F265, 
-0x197829E295ED6028, 0x96D9247BC4D8FA23, 0x5EDA2432782063E1, 0x50651BE325BD99AE, 
-0xF88960A6F623D7D1, 0x834C875D8E74C9D9, 0x33F0A5B85B342108, 0xF45C6824A3236742, 
-0xA5B1AC0FADEE9B26, 0xA7DD43E3A77DB9D0, 0xEBA2B07367BBD364, 0x4FA090E5CF7D, 
-0x8B23571E24E7861F, 0x8E5AEB6BBD904F37, 0x142077CBE0FD5A11, 0x73E007A3BE1E3F4, 
-0x34F8060376E07006, 0xA2168548965EA56A, 0x82722E5F5FDED51, 0xAF5C961F6E2F0CA9, 
-0x2B1F8C856313D18C, 0x795AF76F8EDFA900, 0x31B5F696F575A7FA, 0x5060DC39A8B, 
-0xABA28347EF92570B, 0xD996436EC6CFA5F1, 0xF2236AF0AD9603D, 0x39B3CBEEE0C4BDF1, 
-0xBFCEA91F6D38E79E, 0x156F101BDD73A101, 0xB8624DA11824F631, 0x6D9FDBCC7A04EE6F, 
-0x2DB9BE14BC5F7BAC, 0x6E09EA07BFFDFE6E, 0x67B25C376DA96A17, 0x3A9BA38CD13B, 
-0x4E8D1386F7BD6375, 0x7601D4ACD25AB318, 0x2E51FA1FA136F5F2, 0x458A9DC3762023CB, 
-0x5781E6A31A431C3, 0x906B78C00BEF8F1C, 0x35FDC567E65B9E42, 0x341051521CEEE6D5, 
-0xFA9693E69ADFC095, 0x9BB0E790FB2F42B2, 0x3E07C21AECBFBBE4, 0x2AE37CA5A0EC, 
-0x10BFDF6722208EA9, 0x7ED6C9B04B17F23F, 0xC0DA051E80720756, 0x2368C7A917D32FC1, 
-0xFE5DE903C48CA209, 0xA60219F303FF66E1, 0x6DBE5FFD95AF87C7, 0x4D6088243A97BA04, 
-0x313DA956E882C616, 0xED0434CC8F8B3A7E, 0x399F1273E03F3D39, 0x26DD7DD2D8AA, 
-0xD877EDCDE97BD49D, 0x44B0822FD8624C30, 0xF772354634395C44, 0xA100BABF72D7CE09, 
-0x315BC804AA67EFDE, 0x1090FE80A966F5F7, 0x54C288C3ED42CFE3, 0xE040E6D8597564F3, 
-0x589F7C92AA320844, 0xE762F8B9C44902AB, 0x67A52C78A8E46CBE, 0x1FCC7CEAA77, 
-0x3C42E1E730A702CB, 0xA86D871102ADC9A0, 0x8679F3C40005D00E, 0x99DE6470E088CF08, 
-0x50AD0BA9CDFC5D10, 0x955C4D2D5DF79D20, 0x7A2F5448467426FF, 0x7D82E0C46E924B6A, 
-0x18590C3DA1680FB0, 0xE97BD667BCE98ED1, 0xEC6B369DAE30EEB9, 0x2332AB2EB808, 
-0x472B2A151C9E7A77, 0xE2851A2543A30516, 0xF13F09772DDF4663, 0x605369A8C273E106, 
-0x995BC0721AD5E1F2, 0x898EC1D970865408, 0xCD9BCC56E138C6A5, 0x2B84E09610ABCB3, 
-0x84A8144F7D05F03E, 0xB0DBF2D281ACF3AD, 0xD7467C22F2DF6C14, 0x1F738D275067, 
-0xA702E9C735CF79D3, 0xE5C5E1574C7D8B6E, 0xF597A9698E1AB9E4, 0xA65C46FEB867FF76, 
-0x8DA695B76B1684BF, 0x2CFA7656DA390F34, 0xB08E1C189C24C546, 0x68361CD53469086D, 
-0xC460213EF1FD0446, 0x8395FE975ADA8364, 0x58483BF8219A37FC, 0x5B7E47CE3A, 
-0xFBB3606E861CA042, 0x7B1DBDEB6A760C53, 0xC9D57814B3CAE849, 0xF647C8213975B64B, 
-0x3E52F396DD0D1840, 0xE7034BD3876767F7, 0xEAB642DDF293E029, 0x991C5D2BAD8D5BD3, 
-0x4FDE39A2BF18AB11, 0xB91EEA8D71B60CED, 0xD4CBEC4F058C59B5, 0x27C8B1031F9F, 
-0x1642D62AA3B48FAF, 0xE19C374C7492C1B1, 0xC0419FB7259BC4D2, 0x1FD6CE74395C79A9, 
-0x1FB78A26F151CC86, 0x2F4D12D3E0B616D5, 0xA8EC6BFCD96BDB32, 0xBD4D60F077D5943C, 
-0xD0C95F628EA6A480, 0xB8F796EB1A989C7F, 0x5F73A1DDDE9C5249, 0x28B4645BE787, 
-0xBFEB6E5D7E33AD99, 0x6BDCA04172E26CF8, 0xA38E20EE24770E85, 0xDC5E6D6865638939, 
-0x2E9A09668D7A5388, 0x68D93D4F77D4613B, 0xD795CEF010EA5F1, 0x90B58889D4729CBC, 
-0x6E5ECADA43560C76, 0xB7DBB822DFA30244, 0xD29A692F71C0EF2F, 0x4B416785ADFF, 
-0x6032EA4124F5E272, 0xE898CED548123B62, 0x8B8B50B2EB16EAA1, 0xF7682A6288B8A5AF, 
-0x2C438EE33A127048, 0x250BC992B7BD792D, 0x119C63FE62DB6912, 0xF951DD40C446F3B4, 
-0x9A8CCDCD10D3762E, 0xA8A531C195F9F62A, 0xA6903454EF4143D0, 0x3E91C4A344C5, 
-0xF8CED853D540EE3C, 0x58280B3858D6CAC0, 0x34DD61CB4632F37C, 0x19BB2E4B10BF2EF8, 
-0x32B32092FE716F89, 0xF79F985288873F2E, 0xF37D66E0007CCA7C, 0x2C4602CE84F7C7B9, 
-0x13AB3A85B1B64F72, 0x301FF7088EAA0649, 0x4A4BFA94D2256717, 0x4A3B13D5E5BE, 
-0x8B70484C7E6F8600, 0x84C259D2C6725A57, 0xADC1473802CA922E, 0xE3BC74D40CEF851E, 
-0xFDADF1D158DAD6DA, 0xD3B11B2250A3695, 0x1F3B19882138CF6B, 0x4E4008E0E1CD5C13, 
-0x83470B00DDFA1907, 0x7B55221AB8EFA178, 0x8212CD8076B3E4D9, 0x1163B8FC2B98, 
-0x15EF61ABF4FC313D, 0x911BB91BA856E957, 0x25DCF3A2962472E7, 0x67824159CA1443B4, 
-0x68BE64BBE9C1B392, 0x6062F0BB5E38D8F6, 0x4594F5E9B72918CC, 0x194B68A25F97F4A7, 
-0xB7D9580017CB2922, 0xA0789A47E05AAA78, 0x18C4732D537EB6AA, 0x3B420B025654, 
-0x6678692FC5ED7079, 0x39F736C5107FE5B7, 0xB1E17412E299002C, 0x92E7E3B97BEE9462, 
-0x925A1436E28EF3D1, 0x98242E31F4F04F59, 0x6A07B8FF126E350A, 0xF7BB16F9F758E2B4, 
-0xA77FF1AECBF79789, 0x99831886E57ACDBA, 0x121CBEE74FD2051B, 0x3083AF26D360, 
-0x1586CF6F061F9A8E, 0x81BD939D65C9CFEC, 0x79F8B73F863E28BF, 0xBF089D494F2F5795, 
-0x2AF740986D1331B5, 0x27BF46D436E28FF2, 0x63F3D33D3282674D, 0x7E8CCB3DD0400C5F, 
-0x9D83564B8461894, 0x1C8728FA04B460DA, 0xEB2F34F2F7369E4D, 0xC017A11BC4D, 
-0x7E5DBDF634BDC275, 0xF6BB9CE32D763BD7, 0xCA1A15BBED528FBE, 0xCBB87D1ED0F5B8D, 
-0x4618A5E05CDB555F, 0xE1B14673104C52DE, 0x584533B11E131697, 0xE4CF16D127DEDD31, 
-0x20B8B3FF062D408F, 0x97ADB50A92563816, 0x73114D506752707C, 0x99EFC526592, 
-0x17A2AADF5AE5630A, 0xAB7A39F4BF36FA23, 0xF6DDC54743FB9C8A, 0x331208DB4106206C, 
-0xDE91779389D7AF8A, 0x5730B264030D210F, 0x58F0C3647940DEF9, 0x7F37DCA4C6DD369A, 
-0x558A3C89743E9FBD, 0x34B495DE8862BCFE, 0x64EA6D61F4A50693, 0x4497163406BD, 
-0x5E3E780329279555, 0xB357DF284464F257, 0xDB5DE62B6FFBBE56, 0x1E16D7E44F456D00, 
-0xC35EA7B312148343, 0xD1DB72A406F017CC, 0x293325824F3B680B, 0x84E4C5C3B6EB6563, 
-0xFC4E067E9BB22842, 0x6BFA718378CD4D40, 0xF86B13E70BEF82F3, 0x4ECDCB75E9A5, 
-0xFB706D0EDAB0D08B, 0xB16E1FFB4D8A7F74, 0xEE0FE9AD12DE9144, 0x833D484421C0C570, 
-0x3DE4B81C887B9818, 0x4F7FBC5C02AF25DE, 0x1AF13E31ADB47E8C, 0xE35B3C45E5A83E1C, 
-0xA21F11EF0843A1C5, 0x2F8612FD0D5D0AB6, 0x5BAD4AE55BD4AEE6, 0x400C16A2969E, 
-0xE24C4BCCA8398F71, 0x54B58109DD81B1FA, 0x56D225898689D009, 0xE1F7EF5721B697AA, 
-0x84D0C7BC707FE093, 0x537C2E520B7F333E, 0xA120E759DB4C4454, 0x1A2F5685798F8506, 
-0x9B4A525B24FD7EF1, 0x16A44EF623EA3468, 0x7DE826E48F4E6B43, 0x37E076AA118A, 
-0xF7EEA3F43ADEA0DE, 0xFFC1BAC859EBE937, 0x173A0289B948CB7D, 0xBF38FB0ADB8FE860, 
-0x9A71C4B7D7BB6C8D, 0x315501EA77F8AB6, 0x6EBE40DF0E01D78C, 0x898828F3BC4F2144, 
-0x20FAF12DB47FC921, 0x46563773BF8DB43B, 0x627CD4024F3AC448, 0x24F025AE2A26, 
-0x685CF20B401F7513, 0xAE14DBEF792D5155, 0x34DDFAA33E6224DC, 0xEAE7826FB05A9D00, 
-0xD67BBE575EAC0D7, 0xF0B7E75948FC567F, 0xF0FD58316B21BB8A, 0xC988136D191A6298, 
-0x1E745B0FE3031C02, 0x872BDD3F0F642746, 0xAA3EDE154441049B, 0x2C7E1C82C11B, 
-0x547DFD8DE983CA26, 0xBBEB8D07B3DFD2CD, 0xC1AB30F8BFA06353, 0x3EEC0A131622B075, 
-0xB47F4F049C1A1B74, 0x6C78FC9CF010E18C, 0x69E122800A00DBCC, 0xBE7AF4C199F46B0F, 
-0x227FCD7B91F33FA3, 0x8AA2EA0F552AEE0D, 0x99617FED3831A279, 0x45971202061C, 
-0x6086379375793760, 0x2D0AF24AE145DB6D, 0x6CC1273C4CD5961D, 0xAA0F4995C7BA549D, 
-0x95ABB0E80983952E, 0xE7F18E9D6BE76773, 0xB8C5AC9A54F29465, 0x7268D1FAC7FBEABA, 
-0x6A3D06701B2B37B, 0x2A381F189DA863C3, 0x3C134C77949630E4, 0x36775DFA5435, 
-0x72539E2E6A87F97B, 0x136535BC3B53A44C, 0xAC97BAF92495E438, 0xFB617A05A956E7F, 
-0x7421B2D17554A29D, 0x1882C65628A633A8, 0xD057C529671E3512, 0x40E45722592A1B83, 
-0xA46814B07FD831F0, 0x4E7BB3DAC6600F91, 0xB04BA183C3D2BC45, 0x263E16E23D00, 
-0xBF82B59E81550519, 0x3D70227B6D17A5AF, 0xE7E6BF61DB322FAC, 0x3CA1A1D5B430583F, 
-0x4F79CF4C97543B90, 0x733322B2D6E950C, 0x8AA88265EB3399E5, 0x6FD748DCC1274B4C, 
-0xE288E0F6302B23D7, 0x9D6E97515699A997, 0x894232EF5A3EBE5B, 0x3C2B725394, 
-0xA8479D7F33C2B499, 0x29790500F286B568, 0xB68041B7F9F9AB3C, 0x52104AE79117C01E, 
-0xAAD3425A308C394A, 0x2CC0181F9273133B, 0xA75268243AD8CA93, 0xF75026F284D86C29, 
-0x3B3D6652CC5BDF68, 0x7E1F4B44984E9A6A, 0x62C08F1ACCF2FFA5, 0x24EE07E51822, 
-0x29F0235BF25EB126, 0xFC395F8CD1E75D68, 0x4D90B0F0630D79B8, 0x57006E73A199187C, 
-0x6C92EA3B0DD6DA44, 0xF60EF5427B667BC5, 0x831308F6658917B2, 0x485080DB6D119D32, 
-0x72B5968247B7E50B, 0x490D70F1735942B3, 0xA11CD26356C03363, 0x30EF274A37DC, 
-0x7ED7FEEBAB76090E, 0xF5B198A2ADAB9A12, 0x50608CDE9417842C, 0x21811ABB32B6538C, 
-0x7B8876F39BA43B93, 0x7867B18DFCDABE42, 0xABA3FAA2C2F0DB9B, 0xD86D45EFC3E1CB66, 
-0x8E3696A8B7D952A7, 0xF01C6E57A5163C5B, 0xF930F410A02934DD, 0x6F30E61C2EF6, 
-0x8CC4332E3CFB33BE, 0x30160A6AC2C875C0, 0xD2F89DFBC0E93F4, 0x86A1B3368B088955, 
-0x4D9FAE99ABAB1DD4, 0x25349C6044C2E134, 0x453EC0D0DF93D72, 0xB9F2C9C1FF17F864, 
-0xCD286B71B88FF2D1, 0xBF0A917F32D41FF2, 0x59B4CAF00E165174, 0x28CDAB2A3F68, 
-0x6F11246422FDA854, 0xE6BFAB557CB22E41, 0xD01589A01E931685, 0x3431FEAD4B8C172C, 
-0xEC2DDC859253117A, 0x93EDCF822CC4271D, 0x4E768A226F63D1FE, 0x83CD71E7E9C20BE, 
-0xE320344295A873A2, 0x499D6635F60BDB12, 0xA0D68CEF7AEA8D8C, 0x4016D1CACDFD, 
-0x87738488EEF67918, 0x50D9B35B2A164D67, 0x815BBBA5CD94941A, 0x959E7C6BF9679A98, 
-0xDEF3317382F81366, 0x96AE205731B2C0A3, 0xB6985F77A65AC01C, 0x934D6D999470BDA4, 
-0x9B703343AD5EF747, 0xFECB2BF4C2B17BE1, 0x5C7BD3970ACF9B3E, 0xE1A7A1B4046, 
-0x4F5B0F79B17DFE4D, 0xB6444A3F1BAD6724, 0x7F3BDF69EFA3AC85, 0xA7583BE9D59F65B2, 
-0xC7194CC6DB3DC39D, 0x73DF5187D27A4854, 0x98184EC76231833C, 0x258BB22A834618D2, 
-0x5EE7347393604336, 0xF5CF60E3F0B19914, 0x6DB07F9C622DF8FC, 0x4E6D951C4140, 
-0xE3AD937626C5DF5E, 0xC6282E7AA793FB89, 0x87E9730FC7E78F41, 0xBC4D3DA96CB68ED3, 
-0xD2FE8E10582A0E43, 0xF6051BFB520AAA3C, 0xD9D2E43745C8C19, 0xA06D30BB646CCFB3, 
-0x88588C7E71CE2F6F, 0xB0FFCDB50F0D3DF0, 0xDC876A7E9C9C6AB5, 0x64C675CB9FF9, 
-0x2EFA414D25402A9C, 0xC8A04CD45E3EF1A1, 0x817B0BB9661C8E90, 0xFEB7DE0927E12117, 
-0x708A29932E23E5D9, 0xFC2E5BF83E8D3FFC, 0x904CEBEB70775D6B, 0xF97326B6A689B279, 
-0xECBD22712944D576, 0x387AB888B499D909, 0x54CADCD996010188, 0x4EC5000ADADE, 
-0x9E7C1763EDC06321, 0xC4CAD4C48609D0F2, 0x83C1ED03AFC38217, 0x90865CBED2EEB4E5, 
-0x599CDDC717DACBEF, 0x8B49D21AAD5173A6, 0xD3EB9E13F832D8DC, 0x8B6BB01AFB4ED64C, 
-0xF0BCFB482E58FA54, 0xAE8EC64323B9E5DE, 0xA879ECE0FC7C2ED1, 0x1EEAF84B2831, 
-0xCBB9CD5E5EF3F04D, 0x169243B89E64BE6B, 0x5D35FCDD2FF05C46, 0xA6BA810C6381B89D, 
-0xA0674BD3A6253F87, 0xE0B5B3B695EE0192, 0x61E7EA2DE014A143, 0x8CF325D5365C3379, 
-0x73F3DF5478BA58E2, 0xC92D616891A038A0, 0xCF4620B51DE7E05A, 0x37A2D49549E5, 
-0x4612418F9038A577, 0xAAC27C3CE18F0E7F, 0xC4F81A12568E52C1, 0xC9EF2BBEA55C3C0D, 
-0x9F4AF286B657A275, 0xBCDAAA2D36FE1E19, 0xB0DAF5491BC5ADC0, 0xD54E78AD7057E384, 
-0x5671EE766B5B8C2D, 0xE5AEF23C94BD31C4, 0xF4D571955C4D99FA, 0x131B575175D6, 
-0xD5EFFBE82B7D850F, 0x5960DCE6991133CC, 0x1445C790F9A66B20, 0x651BD319C40CEF59, 
-0x28441943A54A4789, 0x288C5C5753C641DE, 0xD7531AAE7E5135D0, 0x6A10862AA3617EB1, 
-0x82189260E0652E5B, 0x5CF91AEA513C6D8F, 0x28712D0C95E6CEA1, 0x24C7B7141D96, 
-0x30C5D2FF95175DF3, 0xC10905A22EC57052, 0x4C154B259A4D4BCE, 0xC92DEE9C7F217BA8, 
-0x46338678AF193817, 0x93CC090482E0F108, 0xB28C5E53EEA7FB02, 0xBFA802FCDB419F92, 
-0x31F3913A8F8D967E, 0x47D19BFFC8A3F361, 0xFD19EECF9BA735F9, 0x565D0D02D39F, 
-0xC01106BF6BE1FE69, 0x6C1760A06B4EBF1C, 0x89F35F78CD14722B, 0xF46DCD55F1F3A0B4, 
-0x132A1393120A2C9C, 0x1A9C78F348833DB6, 0x548CCF1337940413, 0x281D3808F6A47AAA, 
-0x36BADC2A76DA769A, 0x1CF70E140B3C44B6, 0x1354B49B1B2AE182, 0xD2615EE8D4D, 
-0xF18D4AF5733274FB, 0xD43E2C402DD8C40D, 0xAF40967E6A8F5851, 0x2643EB5D3655129A, 
-0x1547CA0865DC5D23, 0x954F5F03A37A9650, 0x5CF554FE06213EC8, 0x4AC549FDBAF05A1C, 
-0x81A51993885C383F, 0xED26C8440D7E84FA, 0xFA5E2BECCDEE2328, 0x4DDCFE6B0137, 
-0xD40B3FF4352E488, 0xEB11E94F493E5857, 0x84E2F49941F08F63, 0x8F6D70BD8F64DE7E, 
-0x8FBF6DC9B166E627, 0xED8FFAF14A76798, 0xB6B2A29557CD59BB, 0xA05245FE341DBD8B, 
-0xAA22749ECDC4545A, 0x444395FA1446D555, 0xF5290A1D1748EF08, 0x11DB63519A06, 
-0xEB7ECB570818A01D, 0xA344C34904791ECC, 0x3CAFCB2CD04199C3, 0x9C41F277BD4022BD, 
-0xA088AE3F30ECC5A2, 0x8FEF79C2E457AB3E, 0x9AF6085CC8D509D8, 0x67FE86B1737FB396, 
-0xE5878ED3735BA0E9, 0x2B0936AFE26DAF6F, 0x15931CF19C27E89D, 0x55A95ACC9221, 
-0xBD997C3942178C3B, 0xF562D350073A227F, 0x5EEA7862DFC69759, 0xA517A896A9B5ED6E, 
-0x8E61164D047F3E21, 0xC03E57ED11C5E707, 0x25A832B6E7857646, 0xFC0329DBEB3F4989, 
-0x59FC79BD8D8A260E, 0xB9B53E0AF6CAA0E, 0x8AF5179D2A703078, 0x3AE15B0B2DF8, 
-0x90D3BFDDD891D55B, 0xEF04BF2FCE063306, 0xF5E34AC8CD04F47, 0x255C08721E83DDBF, 
-0x9CC62ED85FF58B3C, 0xFC4BF35A334DFA02, 0x5D080A5497D3C8DD, 0xDFE7370EC9772157, 
-0xC8D912B6AC175107, 0xD12C2FCD48A4DAF, 0x475894E8D7E759C7, 0x6627EE36A2DE, 
-0x3A9A166E8C96C842, 0xD6D2614589ABD165, 0xF1509DADFE4764B5, 0x89B663E51A97C260, 
-0xFF9D2E3312D82CE3, 0x28530DFC848DB3F6, 0xBC578BE3596E2FBA, 0x8B19A2A4899D29F6, 
-0xFCCA9FA613656CBE, 0xE3AA4F548B4DAE63, 0xCA98860A4A84CCD0, 0x4419188C0C58, 
-0xA5E10CA37333554D, 0xFE9A8F5CD372D90C, 0x938E9A054A6AC042, 0x393D166B051D03BE, 
-0xA3BAE05BFDBD95AF, 0x8429383EC7EDD427, 0x372C394ED6017E74, 0x2FC8A235C5818224, 
-0xC2ACFFBB6EE9C346, 0xA64BC8413F8C5A52, 0xE44622577861CB55, 0x375BF3F1AD07, 
-0x19713F146A09990B, 0x96130FA73BB69B02, 0x384850D9674C7C36, 0xE770CAF2D3244C45, 
-0x2BA3EE1F70B26927, 0xA56B4E26C509E9A9, 0xBC8EC216C62A67B9, 0xBA67C59EB3642BBB, 
-0xABB43A99982AD390, 0x7C415AAF339D4461, 0x3A7585D6E615E5B3, 0x303B225D2508, 
-0xD5B0907C4B5F593E, 0x51F732B6D577D6C6, 0x951DCC41C1FC6C91, 0x235DABEC6782BEEC, 
-0xDE6D3585F971927C, 0xCB636DB38BEFD9A0, 0x1ECCAFD8D170A543, 0xDA5052E44822DA91, 
-0x5E22288B7CC02C68, 0x59D0EF1A0FEA5D9A, 0x6D277D1A5274D07B, 0x1F46B73FBB3F, 
-0x18049F252D9884A1, 0xDD8DCFBE7A866600, 0x7CD310581E502AD3, 0x19D93BF6C8AAA3D7, 
-0xE0F55F4EDBC05BED, 0x774D5340D3E09CE1, 0x10FF8ED0262A0DC2, 0x48408FB46C599FFB, 
-0x6C5DD2259E5A4230, 0x3420617F320C4F68, 0x74044F1DC8AA5A98, 0x46773C375AF7, 
-0x2535F6776EE036AC, 0xB0299D63C0243368, 0x56C7D0C2873A514A, 0xA5C4A32B9CB34243, 
-0x7DCBC121CA959C85, 0x3502B519EE32656E, 0x818274616FC355CC, 0xBD40C16B295070BF, 
-0x58C762986E34445, 0x9B2F56CF4632EDFB, 0x7A93201407C0261B, 0x21EE44EC115B, 
-0xE72399B0B4B95A6F, 0x2D53AD915202B59A, 0x7BFA12FA0BEFC017, 0xBA50C3100BE88851, 
-0x4326BE0B9B301250, 0xEA41382B2EDD3666, 0xE1F8ED58AC31DA91, 0xCE3E78979D296A73, 
-0x69ACC61A277D36A5, 0x97A10AE4BF12C8D4, 0x8006A9E95480FF87, 0x669C5AD61284, 
-0x5E79F600ACA4893F, 0x7D93914E957AD35E, 0xF5B27EE35A6508B8, 0x5AD83B307032B265, 
-0xA8CBAE460E686898, 0x72CC53319C1D823C, 0x923A2BED06824BD9, 0x3C447F28127C5748, 
-0x8FA97773013F261B, 0xACC42366553E134A, 0x7346AE812E05073A, 0x31D288131227, 
-0x19D0C4B297CE5F5B, 0xB8F70170BE168571, 0x770436761452419E, 0x6190CF462A07D4C5, 
-0x728776AC33ADD605, 0xBBBFE13E0257DA8F, 0x8D263602F4B5F0E7, 0xEB55A5EFF1B59C28, 
-0xC7036AEA90C224E6, 0x6B5DBE3CA5417ADC, 0x6B3C9A0A7CB01F1A, 0x16283E654F1F, 
-0xBD7C0B127E373852, 0xFDBA13E647C97F98, 0x77EAC3AF6BB5421, 0x44AD2B476408F732, 
-0xA1C875CE3270BD0D, 0xE8D40AAA3479146, 0x380CA40277B7109A, 0x13C3693CB12E9265, 
-0x839C35DC0C9D6D62, 0x668C25D12591B546, 0x55CF174E9D59951A, 0x6197357FEA85, 
-0x10822D5039569908, 0xE4349914C4FFC623, 0xCFCDDC9E343EFFC, 0xB9147471C0C86893, 
-0xEC202E784BD6B876, 0xF5F980C9D12022F1, 0xBC2593D44FB910A9, 0xFA4B226D74CF6BD9, 
-0x5280A5E7DD447CC1, 0xC5B1C731D5DB249D, 0x4E621C5F351C82B9, 0x19ACA706990C, 
-0xB0DE3E2A59C76DB4, 0x51CD494583D6E31E, 0xD977500D63C1D33A, 0x12ABE8E7F3AFAE96, 
-0x7F7AE5689EED9BF1, 0xA6F3664E346024D6, 0x9D16812169168AB5, 0xF1CF7D47AF2EB37C, 
-0xB431A9AF7961EC02, 0x70716DF1CB69A074, 0x91FDBA07C085ECDD, 0x2834C94AEB2E, 
-0x758519EFF46FAABA, 0xA7D7AA212D10B819, 0x48917BAAB8D9D974, 0x6E02B87F06BF790, 
-0x2F322D116B545C9F, 0x93936171037D77DB, 0x685298766A230901, 0x6907620CFBDE45D0, 
-0xB59BAF0454E09B0A, 0x3B7E549E5F1FF521, 0xAC408D7B8EEBAF02, 0x60C40870E69A, 
-0x629F886479C8211B, 0x852A260401E39192, 0x7473B26EC1BEBEC1, 0x1F3B3104DB02DF65, 
-0x78474C311C43BCD0, 0x3A2A4EC9DD25E366, 0x94CB3C5B372041A4, 0x216F925683AE74C7, 
-0xC24878DEA4AD0B62, 0xD1749F2E51EF704E, 0xD05C704BDBABE34C, 0x64538E610782, 
-0xC54CEEA4A4B1C845, 0x95F8FF70288F6626, 0x19E658BF7A4395A4, 0xB3C4C2EBB071A800, 
-0x83AAAA0C0A0E0E9E, 0x91D9AA3A8E626C2F, 0x50ED9E9D1B9A714F, 0xE4360E1531A2AE4E, 
-0xB5611987D8389188, 0xE7C707082D4EBDB5, 0xD8459DD69DDA91E1, 0x5BF0E63457E3, 
-0xA9A062E4BB5A4DA7, 0xB59E7D7F81CCEE5F, 0xC8C6704B2B68036A, 0x638D856F306B233D, 
-0x9B4797D30B2FB70C, 0xAE38726D7ACEDA8A, 0xF345F5BB4CC592D5, 0xAF9C3A63178AD86C, 
-0x2CCE2274B03B1C4, 0x9D3F4544C5503249, 0x6AF4A92BF49648BF, 0x17D5908145C0, 
-0xEAE09FD049C28AFB, 0x91E9B97E20539E80, 0xC3FE6C429A5D0972, 0x8EF86C37147EE41A, 
-0x402B3B4189523467, 0xC6CE4C62F4394E5B, 0x8FE08F75101931EA, 0x40A2C58282C68ECD, 
-0x2E2DD207B36E6390, 0x6F1FF3822387AC5B, 0x452238CC341FA2FC, 0x35B9A7C9D90D, 
-0xFB77A00F63811A72, 0x19574B6D057734DC, 0xC15E7D8D789DD59A, 0x2390DE001465B3D0, 
-0x9D00E6DC4AF09F7A, 0xDBBA8F06ADB64C42, 0x4904D18F72905D03, 0xA7F0C4DFD99CB4E4, 
-0x9743BA0B6898CDCA, 0x61A8E6CE1DF5A21E, 0x3D6922E7201AB2BE, 0x3ACDB6935C84, 
-0x9B136810F1F5A3F1, 0x6EFF90FF6916C9AE, 0xC9F4A4D8FBFC3066, 0x631D55C9D2FCB88E, 
-0x310D8A055EDC134A, 0x2D6E355035077315, 0xF00E32201661DE02, 0x2A7F031F4DE36356, 
-0xABFEAF5057EDC9AF, 0xF3BBE4C78D7FEEA5, 0xA0D7975820BDA07, 0x50F6A40C98E7, 
-0xE3FE3D1E8F4CAB39, 0x7189CD76E2429216, 0x3C9F04279AEAA03E, 0x8779D6D82273E4A6, 
-0x6FBE451FA69BCD65, 0xCA1271F48B55B4A1, 0x9DC6A788EF04D4AF, 0x686AB60C1863A443, 
-0x62B0ECBA75275D79, 0x6FC4F38E5C6F10EE, 0x2A8D8F316F484379, 0x2564739017D0, 
-0xC830739DB094F8CB, 0xE6A58A1EB7B02B2D, 0xDB2B6F215A4513D1, 0xBEBF0B31F4AB3682, 
-0x2967FD042B418F11, 0xB9B56FACCA110A6F, 0xC236BC13CB02D40, 0xC18D52A5EC5A6361, 
-0xEE43DB9356915594, 0xD6A1D7D2D2044652, 0xD592472926064AA3, 0x22210A3A2B19, 
-0x2393CE7CCB43BBDF, 0x47A1ACEEEF3173A, 0x77DBBE7CBB36DA11, 0xAAFA075481740EF8, 
-0x1E381447293F2DDC, 0xDE32B24D0B1BBA96, 0xB70C66CED7A6C3E, 0x2212B23A19142B06, 
-0x9C15743F7731F165, 0x8EE732BEC8E2C53E, 0x8967F162DB69A44, 0x1E3005721D44, 
-0x34AEF3BD75B9295F, 0xAAA6D79E3BE135C6, 0xAD371ABF8CF5A517, 0xD67974F47C328756, 
-0x6C36DE089B882CD3, 0x184928865515FFAB, 0xF9C77C528E32A16C, 0x541DBF1D98038413, 
-0x7C760987E81E5064, 0x66AA857DA44D7923, 0xA071A2B6AF6AD644, 0x3835590BBC42, 
-0x2A31C7021E25D296, 0x7BA11231CB947579, 0x1DBA0100646A2D88, 0xA3DDED837E9D180C, 
-0xD262B22F3A0FCC6A, 0x6239BEDAE14F2835, 0x414AFFDDCBE8A03F, 0xFA5DAF0AFA25B0CC, 
-0xB3A500D5129CAA83, 0x9C12E4A6BBB8E714, 0xBE192395584E3BC, 0x111287DFF286, 
-0xB48C8D696A64B5F5, 0x9A3840774D2AD9D, 0xC32B2FAB8625412A, 0xC5A1E13EFA4934A6, 
-0x5F0A96D55DC84DB9, 0x21BB5B38A440D29A, 0x98C9328CFB2BEF02, 0xA1D9CA3088DC4E75, 
-0x99DEDDED0D089BB8, 0x7FAA1650E773B868, 0x8F1A5486CB054BF9, 0x297E560EAEA1, 
-0x9BBE58254123D131, 0xACFC0A1179797326, 0x2067FF5BCC4ABFA2, 0xA2FA3389E7AB9DD7, 
-0xDCAFD0975EA3A800, 0x5BA94A8531887E11, 0x87FCB3739F8451A8, 0x6CDA4F79628663AD, 
-0x14C5A59BCCAB33DB, 0xB87BF992E1285392, 0xF0AE257D00134050, 0xDB374415234, 
-0x946BA3AB63458ADF, 0x470D5089BD8096A4, 0x8C6779E50A6C2D2D, 0x65D73CFEEDAF76A, 
-0x87104701CB63DAD7, 0xFF00C9EA313909FF, 0x7C389B40259D2D85, 0xE851BBCB18363471, 
-0xE7A74C5E69A5C708, 0x2E485BCAB3508CE0, 0x60862B02D81482C, 0x6DCED04012E, 
-0xF86F281379F9E0E1, 0x9E0C5ABAB994BF44, 0x3B6C62E5BA1C8CF7, 0xDE7EA6493B7A0089, 
-0xF39E14FFEF4512D6, 0x50B17AF485324376, 0x12325EB52114E9C4, 0xE60DCF58C9AA842A, 
-0x98B9F53B2283F97C, 0x34E8E06202F43C55, 0x315B799A3D3D7713, 0x2DD5246BCD25, 
-0x62D92B4D62975D27, 0xFC6CDF2C30480383, 0x7991512F438CA8A9, 0xF1D0C9D8EEB22B77, 
-0xE40E44DE4CA284C4, 0xE6CE1EC3A3BC9A7D, 0x24CC4A332E69C8C4, 0x7BDDA920321E7A03, 
-0x5DA9C36FFF285F20, 0x5A6402AAF9FADB32, 0x2B09CC640650FBE6, 0x1ECA55E30177, 
-0xF73B8E1862DB4D, 0x76B437C83E3C8125, 0x5D3312FFAE3200CD, 0x353BC3026AE08C09, 
-0xF10BB65553BA0710, 0x2C0A6AEEEA3AF564, 0xC09299570E695397, 0x9C51BFCA2FA75D82, 
-0x49848654622A85BF, 0x9C128614AE85288A, 0x97825A1D97845328, 0x6B7E572F9E5A, 
-0x2C7CDD39806A7198, 0xB94A90CF2AD66026, 0x3991F67D11444E18, 0x337EF1CB3D0893C5, 
-0x1BDDC5BD06FAF7FA, 0x11374A53F45FE034, 0xCC27AFE71E1A65E1, 0x96EF2E80904F85AB, 
-0x5555B6FA9875A508, 0x529EAC40981F46AD, 0x69494D06594AE6A0, 0xD20F373BA76, 
-0xBC2AC1A114D1886C, 0xECEDBA5FB92064DB, 0x9660C0B9467137BF, 0x55D16CCEB40E4471, 
-0x62D309C00B413E71, 0x60D25A5C665C9B21, 0x762C4C92FD62DA1C, 0xE950E8ED0B6BF805, 
-0x9B46F978EDDF4D16, 0x4794DEC50FB5912D, 0xC5A9879F2018D976, 0x1B47358A6A2, 
-0xED6CF023415D0D9D, 0x70943C666F9B6666, 0x4BBF8E45F959A93E, 0x2F783A1A362CAE48, 
-0xA704B8EFFC3F0F12, 0x881CA18CAE54A725, 0xFC4247466EEB6086, 0xB16853C454C9EF5A, 
-0xE9EF41C599D5D079, 0xC12B298859539F5A, 0x2CD00808FD247465, 0x12DE15D618AA, 
-0xE67603F1DCB613DB, 0xC539AC42ACA1DA3B, 0xFC2040B32B1B092E, 0xFDFEF2B76F3CE7B9, 
-0xFF07A1A42B36C3EA, 0x6760D7DFA790709D, 0xD884B0CDAD1FAFA8, 0x310F78BB14446F5E, 
-0xA093D7914422E69D, 0x7CD51B637C2E154A, 0xA798F7FD01706D87, 0x1EA9FFE785E9, 
-0x9261FCD1C2EB3FC1, 0xCABCA98ABBD0855C, 0x1163741DA01CCB28, 0x8EFC30DCE3873737, 
-0x1A44E0DC41A5DF9E, 0xF912462078F10291, 0x1A9AA6BA0FF33DA1, 0xF19A68767202509C, 
-0x3AEAA51D92BBE244, 0x2C774C095D3BD1BC, 0xC3CE7B91E497B8E7, 0x5D47832962B8, 
-0x3F1A31184D79C9E9, 0x804747D85D174C9B, 0x91FBCC2ABEE3E5D1, 0x61E10D0AF280C06B, 
-0x77BE9412053A8498, 0x3ACF57292E5FEE2D, 0x1B7BC85A07C5C3A9, 0x8491BA5239752809, 
-0xF1631DC113028825, 0x6B1C1E9365ADCCD1, 0x490F68EB5540ABB3, 0x4D870C52D0AF, 
-0x1AA1930D16B2983, 0x3E572DB692413611, 0xA7F4F63C9CC4934, 0xD524EFAFA9C5D394, 
-0x1FFA0A46005DF825, 0x62838260FAC44CBC, 0x33FD49C77842488D, 0xB22695A2CBAB83B9, 
-0xF57FCBE7E07DB22F, 0x34288B094F603510, 0x8AA18D3D0D18EC66, 0x6BB770FC49C2, 
-0xFD40AB54D4E5DFEE, 0xBA476C8FB4F9B37B, 0xD471FC6B1D04863, 0xA9A327595D4E5FBB, 
-0x3B1382E9472E7A8A, 0xDA7DAB2A2CFF09B5, 0x220F7CF9D6E71E07, 0x995B32E8DC0026BA, 
-0x8A4E7066F6D17A1B, 0xA2AFA7EB3C101A81, 0xF873BB6BF2F98E6C, 0x5AF69C349E9B, 
-0x1D930D4812227EF5, 0x8E9E8342632EEA3C, 0x53DD0B7FDB52EFDB, 0x2E42DCC218B14E89, 
-0x3D6388DAB4C3688B, 0xFF80F0AD3FD1A56D, 0x31A48B3CF5E28960, 0xD15917FAA30D1853, 
-0xD78F489F568159A9, 0x13B1384836CA0CFD, 0x2576BC43F9C2879D, 0x565930767CF0, 
-0x3E45C68B0E8FBAC0, 0xF9DB4E32012F5CB3, 0xCFA205721A25456C, 0x47A7770BF33E0028, 
-0xF24AAA87AFC3F03A, 0xE66CAA2FF41A1161, 0x6C19707869DBFC56, 0xAAF19858FF2BABB3, 
-0xC9282DCE2A78000D, 0xC5087DFC1CB5481A, 0xB678CE3A0A26E3AC, 0x6839847B1EF5, 
-0x814854579718B2B9, 0x565E8A0FC3A98F20, 0xB22102C0274FC7DE, 0xE08EA88D6FBC897A, 
-0x74F49ECFEC8A4F1B, 0x8597A465BEC47A15, 0x7A4D3489F9A1BD36, 0xD21F42F6CD4205BC, 
-0x7BD29CE5EE63C63, 0x27C2C471EB2DF23, 0x2AA08A495C69C6AE, 0x5C5793251F95, 
-0xF32FDEBED6942399, 0x8D7945872D3E3E2C, 0x7D00ADFB3AAE532B, 0x3C44EE6F8232C073, 
-0x81D7F1D96A91E88, 0xCA0166500A7363E8, 0x68479F4F5E2C3C2E, 0x2AC46CDB50C0A915, 
-0x55791F8998D3FAF8, 0x980838DA482889B9, 0x67AAE5A151922566, 0x1AB030F20918, 
-0xC0812EB31CCD7F76, 0xCACB044C271AD894, 0x6914B4AEE5D59B36, 0xB596D377FE737EC5, 
-0xA585DDCD8D474660, 0xB0DC225CC278DB19, 0x468806B4D74A7D1D, 0xD94932532DC2BDA8, 
-0xC1E72F4861360C71, 0xC3BA1D1B5BF129A2, 0x8446F9EC36AEF7F2, 0x621FCD8BD258, 
-0xE2FD9A4FF8499830, 0x8F7E29CAF3250E65, 0xD09EF7B73B48F307, 0x439927E8AE7970A, 
-0x83C7D78CD70E9166, 0xF8C54272787B066C, 0x9A8F449F161B680C, 0xF983C6F255FA3691, 
-0x752D31E95AF94ABF, 0x8C2AB5EC381345BA, 0xC24010E50C95C190, 0x1927C639F6D9, 
-0xDABFC0A295CED4B8, 0x28AF73DC2C6166C5, 0x843F602CB44CC986, 0x44342ACCA132FDF7, 
-0xBC91E37CC005F32A, 0xB872D8861F7F573C, 0x3BA84391DB24C039, 0x76F9A02439825989, 
-0xAE531A55CA0E2D63, 0xC0BA650803778662, 0xD735AEBAD65D15D7, 0x2830E30F1ED0, 
-0x84500DEE34D56A07, 0xDB1CDB1E0C2BB9BE, 0xE55D7F89F16028F6, 0x8E96492477B95C1F, 
-0x560AEBBF784C951E, 0xD7D7F7F7722046D9, 0xCE91A7BEFA78BEAC, 0x2D8997E0F2BA3136, 
-0x238C676E2961706E, 0xBFDBB0DF2FB8B7ED, 0x3FE5553BF9D275F8, 0x4C5073CEA3CE, 
-0x8A28C5047DACF6A4, 0x98588497CF3CC8EC, 0x66814759A43B0DC3, 0xAFA7482461B2895D, 
-0xFF94FE31B3F46E21, 0xB0A36EC3F908A4C2, 0x2AAA1772D38862E9, 0xFF8E671A4478D7E7, 
-0xF94090D61B297D82, 0xD7082D7E505835E1, 0x6E1CE25E88976E14, 0x67C6C7B0422B, 
-0x27C9E287C9A4AC13, 0xF27D5D87B77DFE23, 0xBB03D0474D0D36C3, 0x3799AF0E849B8479, 
-0x92E34E26B85688A3, 0x213AE029A080E48F, 0x4DC99946CEBBA1B6, 0x6014FA42B7701018, 
-0x40930A87E4481395, 0xB4F288B5E67648F8, 0xEF1943E9C271D599, 0x4DA2C3928F9A, 
-0x98D4751293FB6725, 0x8A8CCB5104F4CD63, 0xB6079A89BAD99992, 0x30F623F6CA6DF3B5, 
-0xAB6BDC8BB413D63A, 0x71B68068DD3CCD24, 0xA6161F84BB06CE5F, 0x479D8A69352964F4, 
-0x44980AD8FE225892, 0x4B3F59E409A53D27, 0xD863E3E40EE68DD1, 0x30B47968902A, 
-0x36B84A5B34B77E08, 0x42A760B370F0FDAA, 0xEAD35D8C2634FC1E, 0x69D2ED138BA02F2E, 
-0x691E3FC29AEE9B6, 0xA9DABD2CFE1817A7, 0x93B6C0AE5EF74883, 0xD5378FD7441E48B3, 
-0x949A3A5740110558, 0xBBB3758223D4FF4F, 0x97E4C0CB0E5363E4, 0x378F0BFDA2FB, 
-0x147A9438C04F6AC5, 0x2E11A76F6B6D142F, 0xDF6B6AB439681386, 0xCBC5BD9B840FB3EA, 
-0x99175F963F5AC8CD, 0xBBBA4744C38BE0BC, 0xFF731A51D86CB138, 0x8B1549C7DC7CF617, 
-0x2CFE8F43C9F26FCD, 0x59817856C680198B, 0x7FB408443EE917F3, 0x43CBC0C9F918, 
-0x3450D4DBE62513B, 0x706264EEBE21FB89, 0xF40D09B0750F03FC, 0x2D25BC0E174C3496, 
-0x52FD3B4C20754CD4, 0xBDCFBE6CCA3D76B4, 0xE678F5D1CFB82B31, 0x1DEF9729A90BE669, 
-0x408E7CA1BDFAE496, 0x7DB87FCDFE3F5E9A, 0x7AB4BD2100BC197C, 0x1DAF5D5BBC08, 
-0xCEA893B621A54362, 0x23DF233BB4AE56D0, 0xC659B3FB77C15963, 0xECF4B39836AD04DE, 
-0xF275D5E9C96D00C8, 0x9A603F725E814D83, 0xD3AF496E1480443F, 0xA31BFCD24B8D0453, 
-0xB7341BB8C6B7C635, 0x2F160D576223D033, 0x94B2FBEC6AF9830, 0x46F9EABECC92, 
-0x8BCD9F42506EF97B, 0xFE51DEE45EC63578, 0x26299C8CF84E03B4, 0xCC467E9B998E10F0, 
-0x85A220696CBF581D, 0x9B3DC631734F2C2, 0xDCE646609EB74D95, 0x2540059B5F7EC23F, 
-0x11E5B18C258E510D, 0x9C2F52C213D56283, 0xEE1012BF0205C604, 0x2C7D5E4EEA05, 
-0xA3D5BAE573C9921B, 0x6BB5EE43E64AEA09, 0x568C939E9F65DDF1, 0x65BEC64B1A3E34C6, 
-0x83D929F6E51B62FB, 0xA8ACBC1134671C58, 0xF658E4958FA2A057, 0xE52E0762897A8484, 
-0xB59B07744EE8639A, 0xDAF80F3572A422B6, 0x2A901F02F5F6DD12, 0x2A8D06299218, 
-0x3FA34F764E30A0F0, 0x26883CCA4A3C77DB, 0x1F73FFC0474640E6, 0xBE88F2A3244EB7B8, 
-0x5FF7E756B5812FB7, 0xE99BD29F3EC07776, 0x695494FABB5F90AF, 0x5B44E461365BF905, 
-0xA6FD942AC8F2B8A6, 0xB3CD44DD9CBB900A, 0x6E0BABEAA7C3EDFF, 0x45A36A5B51F6, 
-0x1236231DFE042839, 0x8110EAA6C077C032, 0x9AF612773D74780D, 0x5541AEABDD046BBB, 
-0x68F2E60F66D7FEEB, 0x3BD0667E51487DC3, 0xA1AB1F19BD9E1B02, 0x62A2407C506255C1, 
-0xE594B52909DA63F9, 0x93EF8D61ED001EB, 0x1F3CBA140FD4AC6C, 0x18442BB90FAF, 
-0x9D482EC9151B9346, 0x6085BF57FF20B77A, 0x810CD319B90279D1, 0x2399C854D62B3E08, 
-0x3360888943CA0101, 0x69FACC7E43213C81, 0xE2355ABEC7EE8BC6, 0xF4716C1B17EE5B07, 
-0xAD6A6AD20F8F46C4, 0x8B8F3E2E0C6723AB, 0x6352287DE489B98A, 0x64DA26CBE686, 
-0x926240DC99CB31F6, 0x8D84D1889CDAD19C, 0xF4BBBA0D6ACA3D35, 0x69A8B11D42E2990A, 
-0x7B0AFD362762EACD, 0xDE0A123DF7CE03E2, 0xFA3DEC1DAFB6B1CF, 0xFE4D3BD4D272B5DF, 
-0x264912A2B19071D5, 0x7FB3A89AC79F2834, 0xF6310E20F8FDC2DE, 0x464F6A714FED, 
-0x20BD93D2B230E4FD, 0xD15E73550BBA18CC, 0xFF78EF242D7B52AD, 0xF9B5751A1602FFC3, 
-0xA277155952230D0E, 0x6E6412960C395DBE, 0x4C590A08E3122B58, 0x77489318770C2517, 
-0xC8BCA8149FED0B6A, 0x19A211DB452A12A3, 0x75D8F5645EAAB398, 0xFC791F556B8, 
-0x81E08DDEE928725C, 0x41644B9280D18F4B, 0x40AAF68884EC6807, 0x3ED4744BAB832B37, 
-0x51CCA26AD022E51D, 0x1F74981CECDEC57E, 0x82418F9231940F38, 0x49D56674674E4CB5, 
-0x21FED5D3DC4F54F, 0x7F4B43D65DFCABE8, 0x2497CB640BBFC9A5, 0x393742549898, 
-0x32E3C284730296C2, 0x67BF4BBDBF8DD919, 0xF8AC1C1F323C48F7, 0xACDBAD07F1BEC3E4, 
-0x5A4223CFCFFD483B, 0x1DE193B45F7AF091, 0xE63BEA6D0CF6DC7E, 0x99A3CBC973ABC954, 
-0x1372DE745C19986E, 0x2EA5B6B84599506D, 0xA5788BA81BACA164, 0x586C1D38EEB1, 
-0x1ED3D85872040D25, 0xEFA021D990C9C903, 0x5E8869224047642D, 0x891402C179EB7D75, 
-0x7FC3FE8C537F3160, 0x76CF56536F97A899, 0x9E2759E5702DFBC7, 0xFB8E24E5A00CE24E, 
-0xFFCD36F5450509BB, 0x571F0F31D07D598E, 0xD542DACD51603745, 0x583F5580E9A1, 
-0xB5D513696DDECC34, 0xF7BFC2BF59BD6909, 0x8CA0EA3E865747DE, 0x264E1F74CD478D7B, 
-0xA755F2AF6D5477AE, 0xFC71975E4A03D73A, 0x3D6B45F104C6B41F, 0x943DAEF088F75F05, 
-0x714185D22FA17AFF, 0x228C1D931168BCF9, 0x61548A807F281F76, 0xCCC080C6A83, 
-0xB8715855E98AC21A, 0x6C4915CF89B3FAE2, 0x62BF625BD4A94E84, 0x80949E5F5EA7884E, 
-0xEFCC50C31A8AA60A, 0xAE01C9E2F280C436, 0x1BBC8BF7DB8A96EB, 0x5822CE5E054C01B1, 
-0xA0ECC81BDA282420, 0xA673B1184617BFC3, 0x913785D33D449348, 0x6F8749F727A4, 
-0xAB108DC4EA7FFD6C, 0xA014B4DCBB9CF4C5, 0xAF5177091C6C8435, 0xE3CFFE5DB4CC5814, 
-0xB506AD0852515181, 0x5E6143B9195B8904, 0x852636E9B0AF9000, 0xC9FFB48482DB194C, 
-0x4FFE200DE979D369, 0xAD8D513C94B990FD, 0x703CC79C9046761F, 0x19121AE9C053, 
-0x75A25D1AFD50231B, 0xB33652890E867194, 0xFFA5E08B4BAC90D9, 0x11A317984DC4B3DF, 
-0x9F6E2C9AEA238CFD, 0x6556F8CE3BDD943B, 0x2AF03E5CF12D7E47, 0x73BE02B783CAD90A, 
-0xB303F490C036D04F, 0xE18BE41E355782B2, 0xE7F845D7344B88EE, 0x6CB32451C5A7, 
-0xFB598F22BD077BFE, 0xD287B778F853123E, 0x17A82ED8EBF7B7A8, 0xA2B20F0E873F2114, 
-0x42E48BBD3E27648C, 0x6A0F1069D84A9753, 0xEED13F9675F12861, 0xB9559DB06D852261, 
-0x1944D5A6F40EDCB4, 0x2FA2879A648144C2, 0x406445EB61400284, 0x7E5D3191C14, 
-0xEFE08C04BAA444D0, 0x2AE2BBC09A91BFB9, 0x18ADCBA2814D7D8B, 0xC07B1DE2052F712D, 
-0x414E4B5FE61EB1F5, 0xA14B4D6C564E3CBF, 0xE3474ACFA5B897AE, 0xF33656BD18CF9C08, 
-0x29D1346BEAC06D7F, 0x35925EC2C041A014, 0xBD1D49349B575A40, 0x6AA5D26126C3, 
-0x8006FE4604ECAA38, 0x7CCFA16ABC844EB7, 0x99152B3B07002088, 0x2CCE8A98F92C4FF4, 
-0x6BEF2EDE79BD28BB, 0xF0CB58C22B434F7C, 0x1BC78683CD953220, 0xE958B9E42D0555DD, 
-0x84113C9C1178C6E1, 0x2446D0EE409F76BB, 0x11233A861F098707, 0x3CB916A6B5B0, 
-0xD0053CCE031D46DF, 0xA6C8F84B5ABA6CB0, 0x2B5998DF9EEEB751, 0xCDD879A6A333D65A, 
-0x2C67801BA138AEE8, 0x8676EDCF638B1B3B, 0xF2CD394B947D800F, 0x3AB45A3C43966770, 
-0x92F03746FD872432, 0xEE1A89BA923C4D13, 0x989A9C6F815C23D, 0x607ADF8A1361, 
-0x2FA72A323F3ADD2, 0xF073328CC33EAFA3, 0x701D784A3DC0BBFE, 0xB9AE26AAA4E8C3CF, 
-0xFA272A966FD440A6, 0xF5191B991D8AA971, 0x84730B09EA656CD0, 0x2D9E662BD698F146, 
-0x849E526B7831EE08, 0x318196F24058891D, 0x9A5F3FB70CB9139, 0x2BEBBF22B6, 
-0x63F0148228F4982, 0xC9882B835DAFEBC0, 0xC359ED6A2CE7CAF1, 0x1928FF8B52024629, 
-0x1B9EDA7CE5C7D89F, 0x839071607E80D580, 0xA6F047C3A64F5E1F, 0x75436784248DBFEF, 
-0x2A15BC3D11560689, 0x1BADF3D0DBEF6846, 0x21A6623498990BF6, 0x4031F80E2D7B, 
-0xB7EB9EE07A220F39, 0x5ABF44A330B475FE, 0x18CFB3DA83439218, 0xF94E8223A5735643, 
-0x811495492F51A6A1, 0xD83ADB4A30B7EE30, 0x34EA18ECE2A94F34, 0xED7265BB0FE1E439, 
-0x9FDB3183533CC0BB, 0xFA1C3785405F8441, 0xFA58CA1C600052E1, 0x310AE86C83D5, 
-0x5F8AB2AAC09679BA, 0x200FAE05C6AFFE24, 0xCC30CFBC36A96E39, 0x3B503EDB7F97E335, 
-0x5118E884D8B1EB57, 0xF3A9E969BD1A631F, 0xBE2F28C769140E6A, 0xA6A4AD357BC59D4A, 
-0xE791AF55FD758368, 0x524D245D02954EDC, 0xC4505CF281B26B77, 0x20CF0C42396C, 
-0xC7B7B1D44B07B312, 0xD3210079A89CB2F3, 0x9BAFBD6B37C45DBF, 0x64411EA1EEECD600, 
-0x7106FF4001DAD6E2, 0x5334D0CBB5253742, 0xA816BF2B31EFFAE6, 0x5AD390F9A9C8C9A7, 
-0x51E55F24C3F7BAC8, 0xA4E6AA369812AF19, 0x407B7739217C79F9, 0x33E221C523DB, 
-0xC8AF8D5FD38DFD2E, 0xD2B821381C459F8F, 0xF65A73B3D279721F, 0xD1E8E6DD2FF5AC38, 
-0x4EF0B459984E7E31, 0x772420600B8C3148, 0x252F075899E141E0, 0x2D69E63B614DEA77, 
-0xDF86CAC3DB16648B, 0x5D2ED8630A821CFF, 0x7F670792E16BBB0E, 0x5680581AFFEF, 
-0xFFB833C79F2A6BA2, 0xB15D08F293528405, 0x88D0CF009B6B4C49, 0x762772DF6D3B21BE, 
-0x24AD800D1AA005F9, 0xF841DCB784F32C2F, 0xDD3EB90E0087080B, 0xCE2D0CC48BB6B242, 
-0x8AEF45D1EB6A256, 0x70D1C9940E512FE1, 0x2D6CD8EE2FB6AC6A, 0x671BDA1103AB, 
-0x4A840876C5D91DC9, 0x82F558B2B4FB6431, 0x426DDCDDEC8316F3, 0xF3141626AAE0D4EE, 
-0xF34EB435E63623C1, 0x8D389E8D64BEDB21, 0x60D0123728450912, 0xA71653F6368BD372, 
-0xFC1311F675E9DD14, 0xD28A6D68A54F0768, 0x651090F761150A7C, 0xB5D7F5C3C87, 
-0xABEBA07B27A5B54F, 0xCBD05DEE459DF507, 0x5D46EA516CD60ED, 0x24E9F09BEEFB7400, 
-0x6B2A2BAB89E135E1, 0x6D2C23EBE86B5B06, 0xF8D942A8C8EE2C69, 0x11373FA599F1D87E, 
-0xD70A0E61BB94009C, 0x5C74475AA5AA33BA, 0x21AA9CD2EA85DCB0, 0x72DE6A1BD97, 
-0x90F35E47988316A7, 0xFB52131873105E1E, 0x7AD8BDF6FD2D898A, 0xEBED3A4B3022DE99, 
-0xA4183FE5339DA0, 0x4022A79FFF25CFD5, 0xB63F816FD72B2239, 0x8E1182D6EB26BAD2, 
-0x91B97AB3947DA01F, 0x44CB3DC862547318, 0xFA109B7DE8945475, 0x39D660C7F904, 
-0xC89F448C5F6A794B, 0xB9381E658B3F00E2, 0xE63EE217406C3E83, 0x320436469D1A7BEE, 
-0x6A5AD4EFC406087A, 0x1E645C50C5CCC4F8, 0x54B616A9718FEE58, 0xF22274C00501753C, 
-0xF7084021DD9B9E67, 0xDE04BEB1E6BBF932, 0x64C8FA023C6E7395, 0xF97CBD08A7F, 
-0xC4ADA4F0AFAD8BCB, 0xAC9843D6CF413426, 0xFDF4938DBF01D1AE, 0x7AB5E76C81FC33BE, 
-0xEF207428D99F5D69, 0x3FDDFF85DD408633, 0x3FF84A028452C30C, 0x812229502E176B71, 
-0x7C910497CD2355A8, 0xC988FA53AB051DC3, 0x225A80A372864929, 0x24818F31FAB9, 
-0x1EF50ED643C2E0E9, 0x73AC85C85AB3D559, 0xBB9036754C6F7756, 0x3B5A09EA17FD3738, 
-0x5EDA462FDBA92463, 0x5B447AC38F552D82, 0xA35465359C4D35EF, 0x2FB709E2EFC01E3E, 
-0x98D33A37DAE23B38, 0xE9C09A148A1A1038, 0x39E13A0ADF8F759F, 0x20BA7B5298F1, 
-0x1A3417DAC043EEA4, 0x508DD262554DD74C, 0xC747A1767A039C5A, 0x449410844D9F5B4C, 
-0xC9F2CF0CC975120, 0x3DEA630A94FC8A88, 0x2E3CD011A9135996, 0x9DB0173DD192C8C9, 
-0xC2F565669816CF12, 0xAD7EF87AE5272236, 0xE2E392C42F1026E9, 0x2BDCB59FCFC, 
-0xA4CADDFAB6EF5B2D, 0x1E77E9406F6171BA, 0x3328FF726B8F329B, 0x41908294B6C060B4, 
-0x9F1F6D6429F62862, 0x4B6CC45E88285C5E, 0x7C2E435FC634122B, 0x6F94850EC37FF482, 
-0x5AC8B82354F04CFA, 0x31DDBA589F8A4156, 0xCBAE03BDEAE3AFE9, 0x3D2501AD9F68, 
-0xB299EBA3F89BA8B, 0xDF59C15B6A41318C, 0x50D2E52C104A7794, 0x6A92BD268EDBE462, 
-0x4DDDC94C420BEC1E, 0xFE18AF6A53C0A68, 0x65D2FB2F9C03A128, 0xE6538F407ED2E13B, 
-0x3BF50A0C01B39D7, 0xA471E95266AF383D, 0xE13919D37F4F0318, 0x6391FBB159F8, 
-0xC4CB8561600714FD, 0x41D83A0DF53910D7, 0xBE274654FBDBEBB5, 0xE0A165302BBA66FA, 
-0x3706874EEFA41FEC, 0xA9A08B655F078A7D, 0x7BA2FBED9ADE956C, 0x25F8AAF2A5B9D3D0, 
-0xC68764609835AA16, 0x64D04CE89281F674, 0xE1E37AF14668413D, 0x527380B85BFF, 
-0xF49698C176F7E1B1, 0x50871F39AC31B290, 0xB54DA367A148BA8C, 0x53F3ACA25AE0D9CE, 
-0x6C0139694D2D5342, 0x8D03C193AE7A6376, 0xFA53A2892155C268, 0xD7DC46CA9945BF6D, 
-0x1B0AC74C8C49C46B, 0x4164C2E0DAA5BA4, 0x541D81BD28FF95FF, 0x42C08691DC57, 
-0x4FA519F1AF0629BF, 0xAD849ADD56780016, 0x5383762A410B3AF1, 0x1971A52D9FD6E4E1, 
-0x8BE5911E5B1E0590, 0x844FB15320A855CB, 0x8DB760DCC3B5B4CD, 0xB07A04B264046EB1, 
-0xC6FA51C6E621196A, 0x1CDC022897E7A, 0x590C5F0E8AC3E78D, 0xE416297CC18, 
-0xDB1C47C693C0D892, 0x8AD3DA75D4A1B596, 0xD724D17FD83C4150, 0x9DD91F1688D173E1, 
-0xDE310578842A4CC8, 0xBF359FDE21132DF4, 0xEB6296E84B67FEEC, 0x7DC60B498BDA0C51, 
-0xA1F044807C3D6394, 0x83BCB40C3832A0B7, 0x38033F1B22C9B046, 0x2F300C4FFFB6, 
-0x676F5E555D76EE57, 0x67115410E8A6EBB5, 0x76C71FB2CE3FD937, 0xE7612726F5BCE396, 
-0x1372F357B9B38892, 0x66187AAC611C559, 0xE656CC0BCF827064, 0x9D5CA6933A8DE42E, 
-0x483C166AE908984D, 0x4512CFC44036EF21, 0x6F74D062D9776771, 0x6C96AA336B6, 
-0x5448AADED18A5215, 0x30703AF89DB24F66, 0x91413A5A282DC140, 0x269E4831B7A54FFE, 
-0x7A046B0F9DFEE1C6, 0xFBF926E638913E9B, 0xD5E54C57650A5029, 0xB35CB49D41BC89D6, 
-0x95A84D6F4EB672D2, 0xD101A551F7DFF997, 0x566D7857CF0A1C81, 0x5A8A7712857D, 
-0xB1C02F8F9DCB2774, 0xD29692DE6EF26D86, 0x81BBEDBA98713B9B, 0xC643E04CA72710BB, 
-0xBB490565EDDD1BE0, 0x9D2759F474E14A65, 0xCD234D0D92ADD3AD, 0x9C19F6929264086B, 
-0x20BEF85D78B93AD0, 0xC611915F1362EB76, 0x1545436B94B3DDB, 0x3DCB48A49158, 
-0x538227285E6BED5A, 0xB022DA8FB5C2F020, 0xBFB0FD9C6A979916, 0x87585F034A09605B, 
-0x305A754E63A5BF63, 0x50D3F791A3204023, 0x7BC5BC57BD226AAA, 0xB9A9BF427C86C44A, 
-0x9DE94CB5EADF7CD0, 0x1CD4B28C897217BB, 0x9820CF18C4C98063, 0x57194F1D07B, 
-0xB560DF4DFFD333, 0x841A980AFB8476B, 0xCAF926AC52991A4B, 0xA88E9F83B1CDCC7B, 
-0xDC7B018F95532C66, 0x3879F05183C8CA14, 0x275E5BC366743362, 0xD8D4F370195FE2AB, 
-0xA2F1F8273A2E45B4, 0xE0A9B4CDAA114BDA, 0x54B892120B365036, 0x1373B56FEB07, 
-0x7442C91DBD97DB0C, 0x852B94D689BD8DEF, 0x106196734FD17E3A, 0x41632BDFD503FE76, 
-0xF0F34F4E8C32849, 0xBA6A7683B10C6266, 0xACB80BFD77F32214, 0xDC394E9FC42D6456, 
-0xCB677994CDAD2C32, 0xDE97A0BEC0B0DBD6, 0xE073D932D5BE18D, 0x5FC728F57832, 
-0x6A10B8B3A8DEEA9D, 0x748EE447C7B3D15, 0x12589F79CB3C2E2F, 0x8C92ED8F1A26B6BD, 
-0xDFEE1AD98D0776F5, 0xA2BC92D91F4935CB, 0x5060CDB2CE31EA3B, 0xB54176E374B4B427, 
-0xDACAA29ACCDE8C3, 0x9976408FE5BF67B3, 0xC39871B783834ABA, 0x57C7CBD079A9, 
-0x6E6CFCE411005922, 0x29C4716AED526304, 0x685338E54076A2C1, 0x738D9EE000782184, 
-0x7F6F889F918B6B8F, 0xD88FBE375998B650, 0xB36336C97E9989B6, 0x19C81200FEBE4CAE, 
-0xFFC6583ABA7B476A, 0x54531095A6E63877, 0xB41122201723FD0B, 0x477DFE20E6C5, 
-0x171184D5973D828F, 0x5560811AA215E52C, 0x22D877A9DF5AE00C, 0x22B76EF96309C967, 
-0x444BA8BFC96544BF, 0xA889C6DB1B03FB5, 0xC533B685C8AFA37E, 0x5D32D5C83A92715B, 
-0x7CB24C55BFB3895, 0x101E4A2AD292C09E, 0x3483EEF093F27354, 0x12FCC6CEFF23, 
-0xC670D5B6BFCD0D06, 0x96C8CCBFA9267481, 0x3A1926222F690B1, 0xCF081383F82D77E9, 
-0x27461B49D49354F7, 0x4C297CD9580E8AFA, 0xE5AD25CEEA7C33B6, 0xB183D691CEBF54CE, 
-0xC3BB94D7D231DD75, 0x9897E6F756A5BAA9, 0xF21B114EABE6FD83, 0x32C5098EB6A5, 
-0x1BA36E583CD343BF, 0x3359A2E1C9272155, 0x50854CBBB3D515E3, 0x4D95CCD1C79EB986, 
-0xD48E47EAE7A5801F, 0x76BB2901940B90B4, 0x814E35D85B546F21, 0x4A60B7DE3EE7F8CC, 
-0x8C7C582C8165CF57, 0x15B74C4F1DEAAA1A, 0x555B80656002997, 0x11B98723BE74, 
-0xE46ED8D7FA8679BC, 0x277678EAF6BA78AF, 0xAFDCBB6217F686B8, 0x9CA7ADA3BC5D6C12, 
-0xCA63AB18349878F6, 0xA39DD866F4CB15EA, 0x327B8F8E4B2895C1, 0xFFC53E50F6CA6D67, 
-0xBDC3865C939D3DB2, 0xD514643AA29827E8, 0x5C7F96C0AD6013F1, 0x48EE52E47CE8, 
-0xE21699E756671A5D, 0x4F57B62614EB53C4, 0x8C3D1E0667800637, 0x3B1EC43D843EBC3B, 
-0x5ABF6445486AE151, 0xEE91ABDC78F98430, 0x16A8A73598B7B67D, 0xDCD374BCF956C611, 
-0x5EC35A86327692A9, 0xA52E201B3FD9E228, 0x71E6B1E13B79699A, 0x64383AED02F2, 
-0x94522923C267DC1F, 0x411FCA0CE4094C8, 0x7876DE10E7073237, 0x939BCC6D89387BB4, 
-0xDD7FAC80C4069FFA, 0xAD7B978950D66053, 0x947FE8464286EB23, 0xA5FDF87650D3280E, 
-0xEB8184271FFC2D2B, 0xAD05EE84116629B9, 0xD60244211D1CEB24, 0x641E278ACCD9, 
-0x60955CF4EAD0D918, 0xF5D96B5A76A19EEF, 0x610314482541EEEB, 0x487A0CC7061A7A15, 
-0x6CF97FE75B8746F0, 0xD7A00BFBC4CBBA83, 0xA72E1D378C8DD7BB, 0x6D7A06CD73421952, 
-0x7BCCC1B2DBB61FCB, 0x5EDD047693CF38CD, 0xBE375DE21337D665, 0x5C48B3F2DC8D, 
-0x24B7767663B84553, 0x390F705DDBF163, 0x9C797D236BA6D335, 0xC9A23F20DB6B7C3, 
-0xB81FBB018CB16646, 0xC5B0CF49B53215D0, 0xE8F8D0643160B5B5, 0x6FE6261DF70CE9A1, 
-0x3EA7E685913413FF, 0x8A40AA856CE8BB96, 0xDB1EB9935E1AFFB3, 0x334B803B04E, 
-0xB3831916B43E2DA, 0xFAA17DEDD9D78FA8, 0xE6B4D6D99E11D975, 0x8E8AF4F21253A048, 
-0xB12B92FD7164CB68, 0x37439771C454320C, 0x89EFDF9B6FEBA5B3, 0x2A815A680F7F2914, 
-0xA4222ED67D796CE4, 0x75C3F325941E7462, 0x2CBA7E36F6BE0E45, 0x3E0435C4E1C7, 
-0x631C2A3E3A2FA102, 0x759DE4EC513C7AC4, 0x9125532FEBB8458F, 0x6DC4162795958A91, 
-0x4C6857DAC90A902B, 0x10E96AF35243BE42, 0x6B225F32FA0C479F, 0x9A18042A16CD02A0, 
-0x8280ACA73C5F26B9, 0x1F385B8169C981D7, 0x7CAA1573F97A451F, 0x18525C99FD0C, 
-0x7B8526FCBFB78D2B, 0xA4DC5695EA539DDE, 0xD651A944E5597FC7, 0xC9D5724404560C22, 
-0x2E064F0E10E86F7B, 0x90864D5C64A98A49, 0x6D41D60A5D10BA11, 0x2707527BC120F90B, 
-0x527F5482FFFF9F58, 0x284BA21C3CD76E1C, 0x2D23BCCF8B59A8E0, 0xB76BAC63540, 
-0x5B8D6C18BD550088, 0x783898905D13FE0, 0xAA8CECFB8A72F7C8, 0xAC455D7E0C45DFE2, 
-0x87902219281C7A0E, 0xD972A4C43016A36E, 0x7242448D75224165, 0x671846A3910A021F, 
-0xB527A4BFA8395B28, 0x57569AC44AC25DD, 0x74F8B9F2B0DA3485, 0x17E679B2D3F0, 
-0x24133035D2129630, 0x7A91AF0A6DA7F4C6, 0x506280E01B941CA4, 0x794A333B137609DD, 
-0xAB867DDB14D97EB, 0x88A0F9175B0BA353, 0xCDFDBC86DA289D26, 0x1AC394419877C961, 
-0xD2CEE48E454A0AB3, 0xE859BF45F5A77D55, 0x7378FC5CCFCA817A, 0x8ECDA2DB88A, 
-0x83315A3555D29294, 0x41B0EA3427E1A268, 0x77DEAD6A96CB9E2C, 0x61AE68B793349256, 
-0xD228595188DDB085, 0x2B1707D28F1FE4A2, 0x8844AE6173F74097, 0x179AC2154F97EE62, 
-0xFA054ABC414394BE, 0xEFC2647AB085F7D0, 0x33DFC288D69B584A, 0x6E6AFBCFCB3E, 
-0xA7AA2C650545A377, 0x779FA8A1F50103B1, 0x9CE1B8C86FC32B98, 0xF766A8C47327AC64, 
-0xE3211E8298C48E13, 0x21B5DEBDF32168F6, 0x7E86ED4361A62DB1, 0x26585D9493B1BBE5, 
-0xE21F7DFC9EF34F8E, 0xABE34676EEBB5DFC, 0x920E9C10AD3717B9, 0x329C64E1C6BC, 
-0x68E2A239528719BA, 0xB63EEA7E12E7B3A3, 0x129FAD624FF746D, 0x276845879B5686F, 
-0xED43F3992A616C3D, 0x3DFDEB890E19130E, 0x7F6082DF29FA5BE5, 0xEBC16E8F11E6ECA2, 
-0x3852C93C298C8BD4, 0x8454ACC890B130CC, 0xFBA0E11A85A026A6, 0x2631224CFBDA, 
-0x7B7D325C090D1AA3, 0x825BC42FBD0E6B07, 0xE479359B39725439, 0xEABD1441D5928B5C, 
-0xD9C8E726A00D8650, 0xC61CB94C7E90CA2F, 0x28EA02FBFCF552ED, 0x35B3E0BC66E17CC8, 
-0x953E822636095576, 0xFC2D9B6ADCCCE984, 0x14288CDAEECF5541, 0x1E2D75344583, 
-0x1F3831496A19D53E, 0xA524F3621A516184, 0x15B30A08B0CDB59D, 0xF076990976491201, 
-0x61F84DFD4C0C8367, 0xA1522ABDADD00900, 0x8EC673E9F436AD8D, 0xD91C16FC6C78CB6C, 
-0xBA75EC895A3EC513, 0x5C58E4E057B954C1, 0xCD78893E9FB06F17, 0x776D5FEB2A0, 
-0xF1561E0524DC5433, 0x1FBF9C28C8C470CC, 0x1655213D65692E9E, 0x1920A14CA5E6A6AA, 
-0xF15710E1309CC332, 0x38E8A354463897C6, 0xBC1055777C03A999, 0xC29237325D48EF76, 
-0xC1078AF8E897D4E0, 0x369C2D250FA2B18B, 0xE0C1AA21812A93D4, 0x6987A8899B4B, 
-0xBED846B6B8A7503D, 0xE17F2BC35659982, 0x4CEC0DF2E204334F, 0x9FAEBEB8F14C5E7F, 
-0xF14BCB3BAC49A3E, 0x4D7BB0CF9C676F36, 0x7E3AD2E35676B727, 0x7D4A1E323502CE76, 
-0x376EC610461C1BF3, 0x4319D0977FF8C057, 0x9C40F4536FDD2D50, 0x34CC38ABEF5, 
-0xC03A092B92D63EC0, 0x2D93F3BBA09F369C, 0xD8B42BB62F4F1A58, 0x8646A6199615DD9B, 
-0x7F3083DBFB0C0007, 0x4D343605CF4A6157, 0xBFE2A9B53CE9DFD0, 0xB006E3C435014338, 
-0xC1969B61ED06BE32, 0xB0C537FF48EAE3C3, 0x3B7E52FC808178B6, 0x345A0D7FADBD, 
-0x1121F2A33C0CCDDA, 0xC70A167D03DAC813, 0x8CAC79A83EC0AAB3, 0xCD04CEED66CB39F1, 
-0xE0848C099097384D, 0xA827398D31F47076, 0xDED39AEFE975ED25, 0x53A0DE5A49AEBE46, 
-0xBAC3B4CC10F02CEF, 0x2F5A1288E45216B6, 0xCF72D75E12717498, 0x1E010A82FE4, 
-0xF70F61FF46EA2A5D, 0x4BF04037BA8F85DE, 0x8EAAD05019AC1EF9, 0xB528475AA248A81, 
-0x2122720928CB2A94, 0x6E4D1676F93CC09F, 0xDFFCCA06DB420015, 0xA3B6CE439CFF3A79, 
-0x8404A7E7496AB59D, 0x779238BC3A1A8044, 0xFEE5A64F55EC7346, 0x446318955901, 
-0x7BA1C8B2E1537B54, 0x1328BDD6B6E1FC36, 0x8B5A0D2B46338C55, 0x728CD8FB281707C, 
-0x937B80F778C7839A, 0x93FB8BF8E544F8AE, 0x7A86655FDB156F08, 0xB4E95A61F7CDE429, 
-0xFFF80F60A731F977, 0x95F1781E98B085BB, 0xA4D62F1127574A38, 0x64C480422165, 
-0x28628CA7076E846B, 0x62216135B262FE19, 0xCDBB2C0EBEC69FBA, 0x80753AC9BD97753F, 
-0x5ED7C1C13A8A7147, 0x5DDBF5610C9C5DE1, 0x988E1DE3FEE7BACE, 0x160B628047453CC5, 
-0xCE2D3389161A5B8F, 0x53E11749AABF6121, 0xA782B228A6762B0, 0x66FCC5C60C21, 
-0x653383CA0BCFFF96, 0xF38D25AEE76FC6EB, 0xBE318036073F754D, 0xBB296E8AEEE865FF, 
-0x78BE77328F5DD616, 0xDCED9C8637FEF9B0, 0x9EDE5C9998747744, 0x60F40F02B145D73F, 
-0x716AC28C36C5F671, 0xDDB77A7D04C11D26, 0x992D4865BF651A44, 0x5A9749778743, 
-0xF8E1D5FE92B900B5, 0x7C1F5584DEF91D9D, 0x2798B2D528EA38CF, 0x7E513CE803E3642B, 
-0x9EBC0F59D8284EB7, 0x58F1995E3ADFB144, 0x6691DCA3662ED1ED, 0x9C934606D4D93AE5, 
-0xF334EE5CED5C2C30, 0x66CAA0518089F66B, 0x69213AC98D010F6E, 0x2CBA91F43EC4, 
-0xC505B520FB80740C, 0x917EBFAFC170475B, 0xF21FB1772A5BF6D9, 0x213D0560DBD49D16, 
-0x31B22599E2021D33, 0x7B0DEC2ADE00CD5F, 0x8FDFF6E517564B61, 0x656E860C3EBF0932, 
-0x75CEBCD029058464, 0x5A175B1B1DC3A28C, 0x45FCC3746F8C4BF7, 0x4B1A1626F830, 
-0x66E67ED6A3392996, 0x8B568E7E1A1A5B99, 0x75747900DCD22320, 0x397357128ABB727A, 
-0xEC2DBAD1D9D80CFB, 0xCFF1B5C788D09317, 0xB6EA03C9CDCF398C, 0x133249A98E51C05E, 
-0x412F69AE8CF7C20E, 0x590A6153BA9880C2, 0x24FF2C3BD9F23E19, 0x2D7BC20627A1, 
-0x4EB32700E4D849F7, 0x6DE336257C31DA90, 0xD1494216A6A4F408, 0x71AAB07269AAE7DC, 
-0x3684CD8174B07927, 0x662CDC9D0E0335CE, 0x3ED5D216D73D7B6C, 0xE33409A56ECDFA44, 
-0x906E32DFF56E9C46, 0x2B15DBF1CB3ACE3F, 0xA27E2D17394347AE, 0x250E374C7F89, 
-0x37F816ACAFA5017E, 0xD5B5FD6DFD9A8115, 0x3B3D48681211023D, 0x58767B3B96AD52B2, 
-0x81FB26F8EAF7158, 0xB3BE3AA5529EF908, 0x78D1CB44995ED89C, 0x4D17125A761FE6BA, 
-0x5C013ED433E9F018, 0xD9B2C8EEC7366E50, 0xFCCF53A187044F54, 0x5149DB6871D, 
-0x50E9F49C31162569, 0x907B8426E3FCD1E3, 0x4779063461846270, 0xE9637968740C01B1, 
-0x91369F000C5D8206, 0xC2721BEE704547B6, 0xDFFA90BA6C7D2A12, 0x3FB140CCECC4D739, 
-0x5D9048635E057B77, 0xE3EB39CD6EF9093B, 0x1E10B8F5BA4C9A69, 0x57ACE1093D75, 
-0x18478B7EF00C8B48, 0x27549BB4484CC03, 0xEC808B18C07A0B82, 0xE1589E2B4D9AB816, 
-0xAD0C1B5F7BB61635, 0x5AEAF68DCCBA27F7, 0xB86693DA0348656D, 0x1CFF1E4A15CF418F, 
-0xB824071F09D9B482, 0xB773788EA998E51E, 0x43C60B416A4ACEF2, 0x96DE0CCDD08, 
-0xFD9CDEF3F892C70C, 0x88D34759CCA569B, 0x9FF8F54BF49D153D, 0xB288BA0B9F016FE5, 
-0xC9976386994296C9, 0x29B2A4EE6AEF7AB0, 0x60BE4B99E0CC44B6, 0xD6484E6F93EB5EE8, 
-0x9E346673BD05C14D, 0xE8D0DF65CAE6B2BC, 0x62F6A8090C386B1D, 0x32DA8D3815C5, 
-0xED31F4EA6F6FE6B3, 0xC2C16D97F78C5151, 0x722E242662DEB595, 0xD634F093C9EB942F, 
-0x12D72E3FA095C445, 0x15D48EF9B2794069, 0x62AE36349FA6ACD3, 0x6501AB6F82F40DA9, 
-0xE050FC6427BF2D26, 0x284CD2259A2BBED4, 0xB8F7266F847BA8D4, 0x56C7AFBF9EDC, 
-0x89F47BBDE6F0A647, 0x33940F01B5D5919E, 0xD9C4C793B1957A9B, 0xDC31FFA79BA2A887, 
-0xF6B3BC8C3FC4E592, 0x75F91B6777ED82E9, 0x481EB6B1C5A772AA, 0x4A89D3F191840952, 
-0x8A8FAE5ECF3FD4EC, 0x65EC506630E727A8, 0xC686FE8202256A1C, 0x4575FB0AFB6C, 
-0xF3A0AFE2840D240F, 0x7250252240F48715, 0xD036A18F5C9C046B, 0x2804A893E1CCAD8, 
-0xD5530D8662179324, 0x5E28966EBE73E278, 0x491A3C774CF9A035, 0xAED0B46451F2FE8A, 
-0x66A20316691AC923, 0x11A95679AAD5B787, 0xB4F2E04A587994C4, 0x165D3B9A9A1A, 
-0x321DED95E5C6BF1A, 0x107C8741893F8E04, 0x5D8FC41A86027E5D, 0xB9CC54760A220962, 
-0x7FFF48CC5E387070, 0x80EAE7D11C262F37, 0xE9E46833702029B0, 0x1A3B7B97E29C12A2, 
-0xEC17BFD909070F6, 0x58E4A0900DB29157, 0x3C8B4CF26969F644, 0x68E2B361392, 
-0x4BBB478FF48D8954, 0x28C730B4B71A3B6, 0x66F760002391AA75, 0x3B1407974A8F734E, 
-0x6DC6C020434CA050, 0x29EAA28E805A1281, 0x71C32F38BC99CE9C, 0x587588D27955A79E, 
-0xB601E5B02146D471, 0xB448CBE135FB7466, 0xDE8CA303B40F7951, 0x6539518217D5, 
-0x184A2955D7E594B8, 0x14CF23566F85D92D, 0x499025B421EE01A0, 0x8D2B1A8C411E6CDE, 
-0xC76BEDD6693E5D69, 0xAB50CB259288579F, 0x491C170328BD174A, 0x655CCA47A75D09B8, 
-0x21EE49203D43B7C9, 0xC90702FA517E1C1B, 0x35BDCD8AF177D8EC, 0x47969D3861CB, 
-0x5AA1260B5D083375, 0x38B136D03B1D7DEF, 0xD4B75727965FABA0, 0xEDBF6FAA64DF1078, 
-0x74320B69FA9E3ABF, 0x5A77192FDDAC4CF2, 0xA802CCF01CEC3C39, 0x30D04D73792E1A28, 
-0xC5E9D108FD70BBD0, 0xB52660225E529230, 0x27B330D19CA70D9C, 0x6261EA69CDCB, 
-0xC6165AD146953474, 0x7E9FF0034496D243, 0x95C2252FD739B24, 0xA2A3565837665D5F, 
-0xF38264E79138C07B, 0x3645FD1B2720987A, 0xEAA2115520660731, 0xAF2F055E6708D0C2, 
-0x71413C5CBA2D8497, 0x77688EF56873D983, 0xDD1F4AAF7C824745, 0x323FF81DE167, 
-0x51C20EDFD7E692AD, 0xC4A09232E8FF776, 0x34D5000EF7670F9E, 0xA68D4A7A68F4A90A, 
-0xF3CB965C72417D88, 0xE5F61D2FD3E49722, 0xC5A33884EB76C01F, 0x47C368C1283D4596, 
-0x97B138F73D5F3A02, 0xC1F2A891E02BA3B2, 0x19D184ACFAB3302E, 0x552FF7916200, 
-0x2364D8B724B77E2, 0xA5B3B48CC97B98A9, 0x4BBBDD284F798A66, 0x4A752155A35B54E3, 
-0x4EA67C737B3F5C96, 0xDA23E5429C5227D2, 0x388FA3E7A77FB5C0, 0x367AA0CF19A8C415, 
-0xC58358C1590D50AC, 0x4FA09D6720DDC455, 0xB99EBF5824D5455B, 0xDA6B7A25660, 
-0xD3D0F6545EB923DB, 0xB98758C916961F50, 0x5E4DDA6185D56B43, 0xEB8689086115985C, 
-0xA5D0CC632DA144B2, 0xFBB26DD30F3E3DB7, 0xCA9F8075148C2ED7, 0xFDD7974BC57B551F, 
-0xC81C864221A9AF4E, 0xB53B8877BE32818A, 0x566744AAAB652919, 0x484993A5A758, 
-0x985A309EAFAF09A3, 0xB50B3F785F3E7653, 0xFEFE1C78BFB68C37, 0xDDB4C91C05ABB697, 
-0xD2DFF2DCFB700C14, 0x131E8F0ED2770866, 0xA457E155E8369950, 0x9E788BC416F72F21, 
-0x3E03EBB116E7BC6, 0x78F721808118932C, 0x2EA44BC60A06885E, 0xE366972E595, 
-0x80913A93EDE2D98C, 0xD9131258F5D985BF, 0x6D363C968E27DAD2, 0x31E0EA93FC739650, 
-0x260362C1DE0F7D22, 0xEB3834A52178BC5B, 0x39182DFA1BAEFB7F, 0xD3529A6D8906A6F1, 
-0x7A1FC4FC202D231, 0x4A66477EBA5E2103, 0x1E3641B0BA93D0E8, 0x1ABEBD068942, 
-0x2F18F535AAF36DD4, 0xAAF7B2E529B002F9, 0x58900F827F7C0F81, 0x6065BAB712965E43, 
-0x5CE161B1AFDAB44F, 0x7B2C1D052727F3AD, 0x1089194F067CEC5E, 0xEB7C061C20AE5288, 
-0x5145D1AD18D2BA84, 0xF5B0D3EE1AFD3D42, 0xAA710AA779BE81C6, 0x53BCF99B8183, 
-0x8AC3317928964840, 0x1DF39845F46958C2, 0xE7866D4D294810D6, 0xA3AB33736AD4B2E9, 
-0x74741C73F58B8DF2, 0x5B1722D0D746100E, 0x705B73C2F8375B90, 0x780E92901406608E, 
-0xD878C237028A2B1B, 0xDE0D96AE4F8354A3, 0xDFEDB56158B7CAC2, 0x42F5C7829464, 
-0xC655F9FEACCF6587, 0xB0178D0888759B5E, 0xF770FACA00471FF2, 0x7EA287A39FE8A0ED, 
-0x1334DBEBB131572D, 0x1AE41EA3CEBCBD5, 0x6BA272457E527138, 0x49F818A8313D2807, 
-0xA0421E97F883EF38, 0xAD3014876FEDD0EF, 0x898B8BB436E3E068, 0x16BCCE049493, 
-0x7CB47FAC0FF02982, 0x50727A9089A8CD3, 0x2EC920FC9851B28, 0x2F42D90E27DCFEEE, 
-0xC213A2C75B7970DD, 0xDE0057C38D30CF7E, 0xEB78C82BD3C7D2D4, 0x2B43CD5239747CA4, 
-0x9611F2DEA7873F48, 0x80513A12EFE6B3EF, 0xAF93FF704CA9F545, 0x5966BE3A8CA6, 
-0x128F9028CC01CF21, 0xAF9AF75B25985B49, 0xF31ADA39DAA0C42E, 0x927ED9A7663D9C7, 
-0x1D3BC60BD6E79D9C, 0x77F884A81A9E246F, 0xF3E1F67DE0191B0A, 0x3E0CCA58E454BD78, 
-0xF90103378D8667FA, 0xDA0FE01ECEEA6241, 0x291AD0CCC3E51B21, 0x65C5AE8C4FE7, 
-0x2EED6282034F8FDD, 0xDA3774AE1A817176, 0xF3369A6344F66575, 0xE43F8CB039D96B67, 
-0xB71C9CC02930F3BC, 0x58A45E7E217FA11, 0x8882D9FA4E1B75E2, 0x7EFF3DDCE777951E, 
-0x2435910FD92412FF, 0xD04270D7175863CA, 0x27873586822997B3, 0x65A7B1F5BA4E, 
-0xF92F57EEDBB60904, 0xE3810CFBFBADF108, 0x8D68210121FC78B1, 0x1B8689CDA6BF6AE1, 
-0x863C298A7FB21987, 0x93F8A055151E99E2, 0xBD8D33622D539F07, 0xCD08AC8BC1AD77D0, 
-0x686C816AA3BBD576, 0xAC434248F11B5448, 0x7E6A77D5904F1DE5, 0x12947DC916D4, 
-0x6568B47F1E13618, 0x25634570BD4838EE, 0x7EFDA63EED496452, 0xB9E53ACB5C7CF5CE, 
-0x12A0955C3359EFCB, 0xE24C410F62785EB5, 0x82D380EDAA289B81, 0x7470D5D2581A91B4, 
-0x3DCE6A4DC1804BF9, 0xD87FA33A5274E7B5, 0x3530C34267CB636, 0x16B9C379D684, 
-0xACC515B16671B11E, 0x1E0A310B1E93660D, 0xC4AB9A72B83D1C4A, 0x33B40C224DEF0F09, 
-0xC4AF32D5480308D6, 0x7EB89ACD561E79C3, 0x2E9C1FC2262D2D39, 0x7633D363A6281A95, 
-0x130D1DA7A34E9AB9, 0xE50432846E91EAF7, 0xD745356E2B9B26A3, 0x5E77617E10C4, 
-0x88ED6F4C45A5A1B0, 0x913CC35FF338157D, 0x3E683ADB7CB6CB30, 0x7BC171106992EAF7, 
-0x78C6D55FB278BE26, 0xAF227F0E9CDD0463, 0x557D9F4413959AE4, 0x35FF09CF5C967791, 
-0xEF819CBAA7848DBA, 0x156A1FFA11B04CA5, 0xFDDE589A4E37C95E, 0x235043491EF, 
-0xB732E01F83C58142, 0x5569B856A7326EE5, 0x530A673BE581CCEE, 0xFB2C0D28B3A30872, 
-0x634D930002EAF6E5, 0x550EBB6FB369D58D, 0xFF0240ABAD813B27, 0x1DBAB3F48AAFCF29, 
-0xEB1C50B916C504A4, 0xB35D1B848B9FDE36, 0xFC5DA3964F611833, 0x51A40A892F7A, 
-0x1145E0A75F0F141F, 0x506CDB0BB106F180, 0x3928D3F10D0A8051, 0x1B9868E14FB8406E, 
-0xB69559F37C2914FF, 0x3273D3A5585B4251, 0xA9A43F7579E51606, 0x7604A8FF1586D03D, 
-0x5E0F74FD3F5B1F8B, 0xDD485B6541F6E974, 0x6E825FA54767D14D, 0x2BFBC81D0C15, 
-0xCD3478391DB34201, 0x2194B29F38707258, 0xD5646E4AEC471A50, 0xF56DD85EE3A0DDFC, 
-0x5B42F8254E8693B9, 0xF8CB468369E56EE7, 0x19BA2BCE7949FBC5, 0x347A55A61BC8794F, 
-0xB4A0A0F5F413ED90, 0x7B0C88F76A582085, 0x7FC88F08F2E59F53, 0xFE089AA1FDF, 
-0x5C273DBC65C5D6B0, 0x8539058E52EE9FA6, 0xAD5969FA5C9EB48C, 0xDCB59AA84A6B713B, 
-0x1B27A68E66369014, 0x7E831ABCB87CB192, 0x6BB32D80322B79D1, 0x3F98727B29BD35E, 
-0x47ABE96E6F24E227, 0x4AC509ABC682CE48, 0x343977413AA69A94, 0x56249F817363, 
-0xBA5EF6C9DDE763D6, 0x61CD7183FB29E330, 0x61C5C8D9BF0774ED, 0x62332D6573ED95A6, 
-0x8AB7E2973B1BE7B4, 0xDC211C7674BE71F5, 0x8D5B211D83720EF2, 0xD40A47F299FCD83, 
-0xB19FB27E1626F687, 0xC0987632E4540B69, 0xE750F1C490697B58, 0x46D6283E95A2, 
-0xF2A4805A14D9E369, 0xAAAF35C172E0E56B, 0x5290499A9A3F1BCE, 0xAE2F56C228B524E1, 
-0xFBDCF6D3FB7EFE55, 0xA8F60AC4E1CBFF7F, 0x63470E180913EC48, 0x35527B7E7BA3B63B, 
-0xC40BBE904EB38558, 0xFEAD7E071F0CF436, 0x50293C30079BC2D6, 0x2BB4E36D722A, 
-0x87E9E1F6DF8032F3, 0xD5B60BD53644143C, 0x13A490405075D5C7, 0x49569EDE4ADA5E32, 
-0xB1BA1BBDD985AAC4, 0x15EEF13E426E42D4, 0xA98A67C490F53DE0, 0xDB4BFD8B6624B5B0, 
-0xD4A6556388BCFCE2, 0xDAEC23B042C713CF, 0x5045D2C2832A1C8F, 0x321F09D9E944, 
-0x73EA325BFA4D2F86, 0xBACEA8E47A8AF4E7, 0x61820596EFB046EC, 0x8C09DD278D0019D0, 
-0x2C766CEC90A12C99, 0x5619FD8AD81AAB45, 0x7527177180556342, 0x9099BE1D1B4B4B37, 
-0xAEF635CD4A838F64, 0x7487BA848B145697, 0xD7F1B886E8CCF179, 0x467E4E4D4B3D, 
-0x3197FAD53D8E7D5A, 0x4BEBC59E5C80ABC4, 0xC5BBC820E265A94B, 0x5C8BA474388C3ECA, 
-0x1B1BA8BD754C07B0, 0xF87165A17702C78C, 0xA18C31C48B068044, 0x9E4EA3D1670A0143, 
-0x37EAA29FDF2B4119, 0x576420980F98BB86, 0x8C3312204596E83B, 0x5E7A7EB471AA, 
-0xDF139395BA67D2E7, 0xDF3BA0B2A6290D4F, 0x46A2587171B9497D, 0xE80A053EE6087B21, 
-0xA4EBC9C6533807EF, 0x3FE1D88612DEB12A, 0x2FAF3DA2F64CF01B, 0x9493D78656834ECE, 
-0x45C9B3A6175609A9, 0x7690BB6CA79FA829, 0xAB22CBBC32F726DB, 0x27F7AE05A08, 
-0xBA8A0BFD5A8A215D, 0xEBB4EAE6313D833C, 0x12B3E37875738C99, 0xE2DDB4863C3389A5, 
-0xB54C805D665D29E, 0xA854749B2AA91452, 0xDD48D7BA93985DC1, 0x917DC1A1F9C9A0C1, 
-0x68706FC42D5BC8EC, 0x1F259E185CF796A, 0xB7726854BA459D6C, 0x5177CA8200A, 
-0xC0EB983C3E7DD206, 0x62D87163EC78EE2C, 0x22CF3BCC176D50AD, 0x6D984B3BF3DA1AB2, 
-0x1B788822BE972D24, 0xEC31C15786FA0070, 0x3A0D811A740637F7, 0x7681E670862A9B99, 
-0xC1A5E9691283E654, 0x3C57FC94B4C19AF4, 0x6BC274FA6608D086, 0x6709605DACA6, 
-0x74639B7C65DA8C5B, 0x39667F252B40D5D1, 0x1187C3D55581139B, 0x44693FB16A60868, 
-0x8912B4A1BE0E8B60, 0xC5EFA15335C8C214, 0xFDB49838411D2FAA, 0x60B46C3C29D28646, 
-0x7D4A589CA38AC046, 0xB3CD4F6AE09BD00, 0xE9311AD30192B448, 0x1CFAA0597AE5, 
-0x425E706426DA4854, 0xC2B062B2C72C3EB3, 0xB42A48F9F37822D6, 0xBFF3BC18EBD8C01B, 
-0xAB78477EBC34142, 0x9B65BC0E1506C793, 0x9D3F07CB1202C892, 0x3A2613B79AE43535, 
-0xC6D99EA9C38D8A20, 0xF1939566D67C3425, 0x758D7932CCF3852F, 0x29DB452CE2D6, 
-0xE5DF09DCC3520B55, 0x3D315B91AC83FD37, 0xD34FD9A57EF1CCE0, 0x15D6D8F347B49EF6, 
-0x993F4CE6E13EA383, 0x5E7937D52364934E, 0x6029960B4AE6C111, 0xA6B0D53A9BE0A2C7, 
-0xE44797D76FCA890, 0x21A17A266B5A082D, 0xDB295558899A553B, 0x63D68EB1E612, 
-0x8B8C0D9305302154, 0xA31BD6B08FBD2647, 0xA19F67D5A16B2996, 0x9DEAB1BD1125162B, 
-0xA6B4592C09CE3A3A, 0x988A09CCAADD6AB3, 0x562D05B5A294D6D2, 0xF5AB014676B7AADE, 
-0xBA0261A7D6311EA, 0xE4D97A5DA324CD92, 0xAF8920C8F155FCD8, 0x20B4B3501CED, 
-0x3AD93552E801D747, 0xB2DB6FCF895715A5, 0x45894C02BF2DF0DE, 0x5ED16AC3AFDEB6A, 
-0xA82B86CB32FB6C9C, 0xAEFC903551375F49, 0xA517505D0E79B74B, 0x3E0896CA75397D2C, 
-0xCBA02C92C05C2118, 0xA499DD3CAC18AD48, 0xD6186CD281AC5E86, 0x6F3627DC07D1, 
-0xD68494DCDE0B7990, 0xB08791C0A84ECF18, 0x3099183E4AA8D814, 0x355C6156ADF0F4E4, 
-0x8ACE11620940F565, 0x5F3627F2FEC76B7B, 0x3ED6262A6C9DA758, 0x27117AFFF050C5EA, 
-0xF54E88EA07F6C1CB, 0x26611887170C963F, 0xAC0977F6AC7A49CE, 0x18B9FB41433C, 
-0x56CB305BEBF61706, 0x5CE44726AC7FCCAF, 0xA8E7805128920985, 0x158F194D104594C0, 
-0x3770B66A34D63F9F, 0x6B288C370F6F7417, 0x808985927F009AA8, 0xBBC6E2B0C668199F, 
-0x76D0E1C5193C409F, 0xD90F6B3E746F8545, 0x5250F206A5EFD56B, 0x22F8B17239EC, 
-0xEBBBC2547990E241, 0x98C6D579E03F92E9, 0x7CB9D005AA0C3C03, 0x17C733EAFED162AD, 
-0x151FB4F1CC2289E0, 0x7733713BDFF9AB69, 0x339E508C8AAA6CF0, 0x47FDD4E68BAD03FF, 
-0xB113C0BF45F0F966, 0x3EFD67184C4EE401, 0x5C22D73E4E2333BD, 0x15CFC773C233, 
-0xE61DEF803AC1892, 0x792B276BA4357C5D, 0x35731B6E879ACDF5, 0xBD63A8034994C0A5, 
-0x896016B1126A5E9A, 0xD450A94B173CC0B5, 0x85741B0A06852D3D, 0x8255C9AAAEA6D4F5, 
-0x70604842134E8990, 0x23462B7ABDC718D5, 0x8593E0E32F3B2C6, 0x5A24F01BDB32, 
-0xB1F0A08E28A0420D, 0xF0544030237D5CC, 0xC92D682B48A1C842, 0xC026005BCB63AEFE, 
-0x7D0FD1852EAD418A, 0x7051025FE291FF25, 0x58265B96C12DE7A3, 0x57D4DD22F95FCDBF, 
-0xE59E75FA06EF481, 0x58774FF0EA859080, 0xA81762A7BBA8AB04, 0x28423BAD6D7B, 
-0x834456D95318B5CE, 0x2D742185EFFC203B, 0x44D8D6E826BC6470, 0x8E4CBDD8EDADBB76, 
-0x68EF2283F6CC32CB, 0xCA8556C3515047C9, 0xE795DA4009453513, 0x9A0D3224255D37A9, 
-0x2859DE28FC70FBFF, 0x17B1D3399D5E5E08, 0x80B118176C439786, 0x4754B14E272E, 
-0x456D7E3D48BF0C65, 0x69A114A74775527E, 0x6B83FB99276ECE40, 0x4AD86A5A579B25E4, 
-0xB0245730A4506ED4, 0xE4BCB03F55469928, 0x72980F6F4C2D4344, 0xE7BEED6ADAC301EC, 
-0xE0CDD9AA528879AF, 0xEF7549B3CB85D759, 0xABD2974956FE14F4, 0x2FFA270A914D, 
-0x1ADD9B53DBA34481, 0x7349BD2E1EBB21D8, 0x5E42F767FF989B19, 0xCAB5A8C6154F4308, 
-0x4797F287D4FC7F29, 0xCA8E56B927E20102, 0x6DE9CCD7E2EEF2BE, 0xB96FA645C1DA5F9D, 
-0x94C9724CEE1C0C8C, 0xF1FBA45AEF71981E, 0xC807EE2F5D70644, 0x467DCA41B94, 
-0x9984842E08F81B6A, 0xE91CB5AADD1BFBCA, 0x8BC5AA332B2151F3, 0x65F0A08377C36453, 
-0x6C0B7009CEBD802B, 0x54F4901DEA331679, 0x7BEC4D7880E807F5, 0x39A4673822752E6B, 
-0x1831EC2209624340, 0x9CD5057231790494, 0x6391E83C55C7BAE9, 0x2E0871B619AA, 
-0xF2ED50D9B7883F06, 0xFD3C266EB2699BE6, 0xB84C10FC9542F6BC, 0x78166A0C1793ABF7, 
-0x75A447A3A3F04ACF, 0x859551B5A174F405, 0x9BEA3D1EC7A46865, 0x5EB02C55D01E3CD4, 
-0xF2FBA153C47FD19, 0xF4142799F7F4914F, 0xAB0A7818891628C3, 0x2964DE3132D1, 
-0x8DDDA45D5928D080, 0xC6CFDBD2F5F3F051, 0xE4AAAC97B405B0D2, 0x20590C29CB8A8F7B, 
-0x62555AE88F97FE75, 0x33B60FDF25D3B69F, 0x557370D11F880F9E, 0xAF7DD93714D33BED, 
-0xCCB6DEAAB23F4DEC, 0x170BC77543507E0, 0xA3DB4DEA264EC5DF, 0xE86DB45C0D, 
-0xFC4C5961CF40A08D, 0x1FFF8FE2429A3360, 0x43C1C295E5711C8F, 0x3916AE7B7CDE031D, 
-0x62F4DFBC10378434, 0x758F36C27A85DF2E, 0xE4B875D21BDCC05, 0xBE52DA6A5907A2A6, 
-0x5660EB73DCA343C5, 0x7DBB8310CE0589BB, 0xB65AE630769C783C, 0x5A82C9EB7AB8, 
-0xE88F3E5B692C649C, 0x64BD79ACA1EA851E, 0x2BC3F10051E2A6D3, 0xCC7A34A38F8E1171, 
-0x9CEA22C01ADF2742, 0x5D8ABE570BF1D955, 0xB5982ABC60740CEC, 0xEC72DB4AAB56D86E, 
-0x40AAFC0718D5EDBD, 0xB0E14627CE48F1BC, 0x74FD2B93B305D5B0, 0x273FD6889FF9, 
-0x6922DA20C4A61882, 0x773412C164A4978, 0xB3E2BB3DB955B250, 0x80393DF470C6E8B3, 
-0x627B6C39F15E6F87, 0xF2221A8740B3184D, 0x9759499EB5C107D0, 0xBC188078D2F70142, 
-0xA068DD18B43EA902, 0xFEFA1A76B493A9A2, 0xD2C903DEBC0D14E4, 0x2FCC04B60CEE, 
-0x551283BD10EF9C10, 0x940D874FC08F881F, 0x831F4E9A0B3B0284, 0x2F3B6FA8B9EF33E7, 
-0xE49991C1640B6F89, 0x91908E23C93DA3C9, 0xBD4D85F63E7CEA12, 0x5C443642C22C8F36, 
-0xF0DB75688DC48A35, 0x853402072311AF23, 0x114D80F0752D7B5E, 0x33EC88B66D06, 
-0x975DB1ABD5EECDFC, 0x1CB4C4A8C6332C7C, 0xC510CE5E0D02D46, 0xEECD443634B1A4A6, 
-0xD6C10E927EC4F9D6, 0xD01ED2685D03CBD2, 0x6B8E009300C57167, 0xEA48B08F72BD34D, 
-0x4E5AA8CDB3A2F46F, 0xF9AB249B5DE69A09, 0xB3527B7E894778C6, 0x3BFDC3770D44, 
-0x9C2AD240D651B21E, 0x853F0B89000A7CEA, 0x323C574032569734, 0x3ABF5361F9C8D607, 
-0x6D3AB2C86A43B942, 0x9093CEB149DDA97A, 0x11CE20329A8A5D44, 0x45B9EE736F659846, 
-0x25BB858A8C316812, 0xCC9F5B731CC2091, 0xBCD59C29E16CCD35, 0x8D6D6E2C31F, 
-0xD2FCA6E5708170A0, 0xE8D0BB4AFBC7803D, 0x403B501A2466AB9E, 0x57A0FA604B555D11, 
-0x7AB2417991BA3FCA, 0x11008A35AF101BE9, 0x1CC2FEA361D9CBDC, 0x987845756DF14108, 
-0x4CE995FD00E35B31, 0x158887F6AFADD934, 0x3840B9E2B552FB51, 0x517624A45413, 
-0xC390F614264AC97, 0x3301C8C1AFCC9768, 0xE77EEF7B69475969, 0x785093CBF04E3523, 
-0xDCDEC68A1A776046, 0xD412EB796A7B659E, 0xB25A55CD409E5F5D, 0x6CCAED4EBCDD1035, 
-0x9C4E49EC35AA4F5B, 0xFB97B9820B49AF5C, 0x6236BF3F8D41A12C, 0x1943C717474E, 
-0xF968E6CD87D60362, 0x9F21BA7B2116C1EA, 0xD38316991AF43249, 0x16ABB0C25310EC4D, 
-0xFBB496C77B83D102, 0xDD63BC2B4976EA26, 0x1FE6FDAC4DA8839F, 0x6A85D3816A8A102C, 
-0x60A9351E6E0AEBF2, 0xA982E7813948CC63, 0x45D68880BEBBF35B, 0x5210A6069CD8, 
-0x4C76A3570779CC71, 0xDA11C84D83C71D82, 0xDB9F17EBBD2B7AAB, 0x378266E5144B9BA2, 
-0xFD38C50EC7BDDF85, 0xF4FEDE87A08D07D1, 0xA4EC49D49CFBF887, 0xFBBF032C14E7CE71, 
-0xC865CD8D0C825666, 0xE61D4F9E52550F19, 0x6FC4DD5B86500283, 0x6AE5537C3C90, 
-0x24F293F3EF94982, 0x3C6CF63ACF1947BF, 0x16A529B219AF602D, 0xD688C00D038C3FE2, 
-0xDFDB5C5979A5D3E6, 0x4ACA06F947B26162, 0xF2B00A039F6B1BAD, 0x1CD9F5DCA20A87E2, 
-0xD9020DCAE021B8D0, 0x390F001F510B80C1, 0xE85DE1BE487013A9, 0x2C8E80651CB7, 
-0xA383DECAB1D0AE53, 0x8D5AB7B4D7E7D1C9, 0xF5CE8D6BC9239BC, 0x3AF777BFD2D305BF, 
-0xB924B7E70A4E2087, 0xA8C28D06DC1D23C, 0x8324405C4BD391D2, 0x31291E7A98D6AE50, 
-0x155772163F0D71B5, 0x2970202D176A8BDC, 0x23E28C10179CC08C, 0x3365B0F3BF60, 
-0x13F3889059D45CB3, 0xE30D9CA1576C131B, 0x570D43AA7566955C, 0x60EF72BF7798A3E9, 
-0xFF5F14DF701FE889, 0x7F529A4A59727E04, 0x3669383318CFFA4E, 0xEAB717B175023565, 
-0xAD4FCC97C9601CDA, 0x51AE645FAE421359, 0xC9F4E3E3096E6026, 0x5CF360553114, 
-0x1B5199C74C597A50, 0x552B914DCA449D08, 0x678512ABBA23837, 0xA72366035211A928, 
-0x72F388F4F89FC225, 0x30325DB1570490D0, 0x56282812C2F6E7D8, 0xE6F22BA4A9B73CD, 
-0x86ED6D1722339973, 0x1B29269F65330990, 0xB14C2A26B7D2934B, 0x5CC88F69E06E, 
-0xAF39FAD89125946C, 0xC02AF2797BE52050, 0x1581FF58A9AA433F, 0xBA36F0C22157FB0E, 
-0xAD103DAA2B5996EC, 0xB821A6912CB9804D, 0xFEBA0ACF10320E22, 0x2209D702B0C30CE6, 
-0x42EDF0311A8D5083, 0xE88BDCC652E5C947, 0xE203F734ECE0C1BC, 0x6BAFE4D92403, 
-0x1229A2531F723F9F, 0x922A03FCE2A70C10, 0xF55063F015874852, 0x4B7EC51D4C56F452, 
-0xC2BE74A772794C1B, 0x6DB5E985E518DD85, 0xC1FBB5EE87F7B127, 0xF62581E6B84DF0CC, 
-0x91BCA618A30C7C9, 0x519C22F9B42939BA, 0xE9D2D22A23D53B56, 0x47028E56934D, 
-0x5A70592A4AFEAD41, 0x1578A71CDC842282, 0x654F677BB4D15040, 0x506377D771A98519, 
-0x699A32BC2A1FD6B7, 0x8503EBBAB3B43D50, 0x938241AD6525E68E, 0x7E0ED00FA82DBE1E, 
-0x9383E77729108C71, 0x47DFF1A7EA467124, 0x3F1B919F66439AAE, 0x678E896002A5, 
-0x951D6B3A52D88C72, 0x399334D5D61F512B, 0x4FA773B4357D2AC2, 0xD60AEEE030141078, 
-0xD62F56131869AC5, 0xFA78770128AE6C76, 0xBADA7F387F770986, 0xC68E23B54FE265, 
-0x8081D9B1FD32B589, 0xA19FF9C18517C440, 0xF1FC84C82310C1B7, 0x2A712E8C78C7, 
-0x973663E7444D2B8F, 0x97936D39882D32CD, 0x44F9552E3A656A95, 0x4E6C4191D7719469, 
-0x48939D0B989D95D, 0xCF27A18C5D385250, 0xC2A1C06F8FE65CF, 0x77EB1D4F0A10FEC3, 
-0x62C602864BEC44CD, 0x17F922BC9F152306, 0x5DC04D1964452253, 0x2F8254BD37AF, 
-0xEF38427363E699BD, 0x3C25086E80CB1E5E, 0x8E660EB3F99AFFD4, 0xA9BB84ABFE2C91C8, 
-0x2A05D5CF95463974, 0xCF19998D8F857FAD, 0x2940A52DBA4793A4, 0xE6E101B646D2EF33, 
-0xBEEDF4F05553CA30, 0xB5EB8D4A1E4A2F57, 0x7BA2AB20A8AE9B3B, 0x6EB4FFD4893E, 
-0x424A296E20870DF0, 0xE87080BD9997DE4C, 0xAAF766DCCFFAF7EF, 0x17FF85AE94520E01, 
-0xF9DAC31BD9B2DFCB, 0x284FC23A37A34158, 0xA0E921272A4CE29C, 0xFBE9EBD85672F4F8, 
-0x7C08489D9AB99F89, 0x534DDC03B433B154, 0x98A2D7DE7B906A13, 0x543B5975CA90, 
-0xEBE7646923FDD6F9, 0x297EF4BEEFFC006C, 0xCE2845C2678C5F90, 0x31F9EB7FE634E96C, 
-0x71A4ADB103E4A869, 0xF248FC05CC7B4B5, 0x8BBCE10D065912B3, 0x152DDC91E172C575, 
-0x34D20306FB4A80CB, 0x9C020DE3A41DA26E, 0xDBDB8D1707CA233C, 0x6679381E7697, 
-0xF553B4205FD725CA, 0x7799D5E76FE0B838, 0xCA2881FF30E8D8D4, 0x475D4C56F7644B59, 
-0xD4788228CC013EF1, 0x8B4BA43D8C436516, 0x489D43E54A4F58ED, 0xE907B6DFC045A260, 
-0x97F1AC5BB82286FE, 0x4099B3673B5D5DEF, 0x354B3DA62B5BE37C, 0x5B3C8E1EEFCE, 
-0x5626EE718771376E, 0xDB28C82F9CEB725B, 0x4BA3A66C37B03F3C, 0x254D6E2D3A727067, 
-0x8C45795763A76A96, 0x61352F872C5C0FA5, 0xB67F0F237DDA7D4A, 0xA595FE6AC94A77A, 
-0xA99211BC0B38566B, 0xD462B9066CBD0000, 0x1EEB1A4BDD47F592, 0xF098FE1F645, 
-0x7BEC425A7EE5C471, 0x1778F12C72C5A6D6, 0x8F8FC4F2719B5FF1, 0x56516AF593735EA1, 
-0x85BF496427DEE999, 0x6A17A5780F2F2660, 0xB4371D9FA722BE6C, 0x64AD78F9180D3F19, 
-0x7C82A79D37D7D3AA, 0x361CDB91197B953A, 0xD8B59649013DD404, 0x2885B19095FC, 
-0x693C331D5920E7DF, 0xA5BCA28F09DF0B3E, 0x7367B4C87492D247, 0xC48E581EAD7B08C8, 
-0x72FACCE29CD00494, 0x5035BDC1C1DD7E5B, 0xB7484CBEEBD6A8CA, 0x28286B7955151176, 
-0xF4790C2795A50C65, 0xB49C0D33FAF95621, 0xFC310504A7105AD0, 0x551D318510C, 
-0x8D5AEA1E9D2AB48F, 0x3ED2DD798D3F743E, 0x74009F461AB727C7, 0x915EF06AF0D7E9EC, 
-0x6B9B437761353AF0, 0x3016F00F20D0D1E6, 0x8AC638F37A29588D, 0x5FBA64CC48C9F37E, 
-0xF585366269844162, 0x3D940AF44DDA1E3C, 0xD3338CE6C3E921DD, 0x1925C6AB9CD1, 
-0xA0EAF98F414F1ACE, 0xAD9A739797777BC8, 0xD10E5970AF03D211, 0x4885CC6F4504A773, 
-0x73FF3D34EDCB1622, 0x509D454E17AABE90, 0xCA164988627AA07B, 0x8762EDE92B076908, 
-0xAF9D1383FC627E2A, 0x17E2DF66727C2FE3, 0xB6F80B09E993E41A, 0x5F7F9D8127AD, 
-0x65020BE03C53B4C8, 0x32E5A9E3F0CB67D7, 0x3F41A989EC669EC7, 0xD61DE0F9621F17FE, 
-0x1522940DCC5D3C13, 0xEF62E31354316F10, 0xD29ADE8FFB61B674, 0x4B78DB240898FC1E, 
-0x6DE5AE921D4204D9, 0x73744A032ED64EE9, 0x1D25B568F3ADD414, 0x316CF1BD9187, 
-0x95DA20728B10164F, 0xBB107062B4F96FD2, 0x845AC435C1EF2A3A, 0x8C259E61B89D874C, 
-0x8D95BFB846F1DED0, 0x5E1479D3653A3F75, 0x48B4FF7C99E17A83, 0x82219D0470247188, 
-0x6D3268AFFE3B2BE3, 0x88DDB4E184A64E9B, 0x2389D9E5A4370F58, 0x4D736EB8727D, 
-0xA1E6A67F0F7ADCAA, 0xC84A1F4382D4AABD, 0x90AEC2933F797082, 0xED55EEFD496B87BE, 
-0xD9A6F3ED1756929A, 0xA7584832FA53660D, 0xDDE9D0B9DB4CD6B8, 0xE9EB0D9021835114, 
-0xEF21B03BAE3F1664, 0x56CE3A6DAFAA54E9, 0x93764EBD80675846, 0x1AE882DEB101, 
-0xEBD078228CD5C059, 0x35DDB3164669CEFF, 0x507A3C15208DD47, 0xA234939086EFCBB0, 
-0x9F267817459A94BF, 0xC2498C234AAE7354, 0xE721B68A7F0E7F, 0x6679607389410E6D, 
-0x5A1A0E844E53B8B3, 0x7B69CB82795187A4, 0x5586F3115829BED3, 0x42AA7515A19F, 
-0xA18AC3CFB613EDA4, 0x92997262F7CDEAA2, 0x83570C79791F202A, 0x8FE8E20D3FAA347F, 
-0x1ABCB5393F58796A, 0x81DC4D2C430515C4, 0xC1FD4EAD8D724F32, 0x61743BF1F3DDC796, 
-0x6A1FBEE09161E605, 0x1CCE5EF57E006177, 0x6CA7B194F130636A, 0x52511CB295D3, 
-0xAF24FD9D267D5536, 0xDEDF01A8138EE2B4, 0x13CF027EAA49D09D, 0xB071EE5DF63D3FFB, 
-0xC66AB6AB71C44E91, 0xCD172F9947E4ED6E, 0x1A04F19B9BAC8D8A, 0x76384FDA7975313E, 
-0x8AE301CDC3987CCE, 0x2C192AC9D4DF0C61, 0x4F023B4CA5D8919B, 0xB99A33B75E3, 
-0x13A974EB87EF7814, 0xB59DA558F7A72137, 0xE3295B24C36A7B6, 0xB70C6655A6C24660, 
-0xEDE84C8C50A9B649, 0x4D24A6DCB58A2EB6, 0xAB9EC333156DED36, 0xF40ABA52873FEF6F, 
-0x2410F9B33D72CA25, 0x96CC10346325329, 0xD246A925E1C5381D, 0x38D0697B29FE, 
-0x842C74CF0A2FCB7A, 0xB72A29AA5062E4FF, 0x6A9C6873D2F60A2C, 0x70B2D68FEC03C892, 
-0x1AF9580022AD0203, 0x1A88CCDDD4729526, 0xA9740C47B647B4B5, 0xA52380588928490F, 
-0x85040D6985C11151, 0x503AFC1C3FA6742C, 0x33E809DA7BF9F45C, 0x3B66D31397AE, 
-0x89CA63231F90A7D5, 0xD87073DF1D4062C1, 0xCDDCC91A6D192E9B, 0xE005AEA12EE8C1A8, 
-0xC561BE5918C6C62A, 0xC21128BEC759CC4, 0xC7638A31F396BABF, 0x410E3A891757A6A4, 
-0x99F43CC55FA1B393, 0xEDBBFF71A6509212, 0x73A212887B861A59, 0x67A12358A5D4, 
-0xF95BB0DDC2D56C15, 0xE0F87D90B683ECE9, 0x950DCC476130C17E, 0x90B0A356D19F45C, 
-0x6A4ED0214C579E7E, 0x89011A5644255CA8, 0x56CA6A2720B9668A, 0xCA376D0054C4889F, 
-0x36DDEB6D6C7A76DF, 0x74E5C3B487106AD5, 0xF678E8E1CD4C163D, 0x206E98261502, 
-0xFE27B55849F01C25, 0x66D4CABC02D79D33, 0xBB521FB53EF18CE7, 0x825E27D0582C532D, 
-0x4DE41A2A252AD153, 0x52F7F2A0A5E7FE0D, 0xE37B003C01F6AA99, 0xBE61CD0BE81E259F, 
-0xB85AA17DF0F87D4C, 0xA9B534301B0B76AC, 0xCE2202A2B5ADE2C7, 0x10D20F0B48C9, 
-0x872BB253AAA11D39, 0xCFB6FA67E492FA00, 0x4B9C298DA5B0A4F5, 0x644D9194CFEAA695, 
-0x75C1A33B251EE034, 0x514A45B9905E3986, 0xF5C9FC23D7232481, 0x8A1D510FFC478CCB, 
-0xF33C57DCCDD097BB, 0x76B7DD290C714CEA, 0xE1C8994249C8163D, 0x87347313EB, 
-0x694190FE9689C6BE, 0x9E90DE41079AE100, 0x6426291FDDB89A24, 0xDDAEE27D7B2E4F09, 
-0xB16D7EB2C043A742, 0x429D79D9F6706389, 0x9864E492B6F72B1D, 0xE552ABE9D7138596, 
-0x65B6418DC701175A, 0x1683F2ADD235EA96, 0xF4BBF862D91CA84E, 0x57902D94E14F, 
-0x4A851FD6B808A525, 0xB19402358F1F7944, 0xC9A23A938C875A2, 0xBFB1EE8C2C0FF890, 
-0x307A0ADE0FB2C7F2, 0xFAF977A7E1B8D6AA, 0x71D0B0CF9C3AC714, 0x3952D4D57259AF48, 
-0x8F2A735949E4A6E0, 0xFA3EF863950C2F5A, 0x541F99F409690B98, 0x421AF82FB940, 
-0xFBDDEB10886E3C57, 0xCC9989109E220C44, 0x9617E71B08DFCA2E, 0x72963650DF5D5A43, 
-0x91BB559FE06DC23C, 0xDD78B51D20CD1B29, 0xF34DBB303B31BE76, 0xF75340C460E7D43A, 
-0xC43FE433185BFC5E, 0xC7B67DEFABB3F0A2, 0x1CA8858F478AA6CD, 0x65EDB92B20E2, 
-0x96E9C314BF7CCA10, 0xA53BD18B32A9D371, 0xD78FCC16549FA3F3, 0xD69F995303F27468, 
-0xA7E20ACDE711343E, 0x57DFC266B2AEC61E, 0xC724CC59EA17732C, 0x69CAE78532E949C9, 
-0xEFD9E6F5A808E64A, 0x51668F4DFFC55CBB, 0xFDA197F2725DCCEE, 0x37EE6DCAB77B, 
-0x10FF8559583D279D, 0x501A04FFCA39DB1E, 0x9665E3335F12B6F5, 0x71BD5FFE356AAC8E, 
-0x8CF68204BEA917DE, 0x7EFBBEBA2693B8D0, 0x2B3A9A83B63F80D9, 0x2753F61AE50911E7, 
-0xE299CC1B3D181ED2, 0x96842A0809945E1F, 0xA52F82AFFB4B8AD2, 0x1E74EC943FA1, 
-0x99F800429EC531C1, 0x24E34E3DF7392ACB, 0xD7548731940B4AA8, 0x593FEE9AA217A207, 
-0xF0BD3FBF175EDF33, 0x8FC6503869032A5D, 0x7BDFB7B23F7812D4, 0x4E84761B8BE46F8E, 
-0x88D848AD808ECB37, 0xA1CE8751448C2C2D, 0xC99730065159E890, 0xB73563FF81, 
-0xBB7C728BB8652F03, 0x32D44E6B29166332, 0xB928A15E0B9E8FF1, 0xC017407360DDE97, 
-0xB1335E6F7EEB8896, 0xB0B1A05F0DC7021F, 0x81FF28894FACF6FF, 0xCB60F8D2BF58AFFF, 
-0xEBAC0EC072553504, 0xF0ABF93DE6890E04, 0xC22FBD84E985EEB6, 0x4FC0ABDB7FCD, 
-0x96CE016FD3C6F845, 0xA358B61E94EB8C4F, 0x79A2A531BCFCDC69, 0x7357D721F7A67860, 
-0x6B27D3BA6A3FFFEE, 0xB7635F8BD6A0708E, 0xEAC0CEC6C47955A3, 0x8601C6570F8A713, 
-0x5ACC542E542F7A29, 0x9CFD6137745380F, 0xD6B33CDD13A3E585, 0x4E280054005D, 
-0x49485B8A5D5F1DFA, 0xF3034C438FD1FE65, 0x3BA8ADC7C6413C2E, 0xB9EF482BD8E150C4, 
-0xED51ED92895E5E35, 0x9DA021536CF0C1BA, 0x4B5B1174C2662D75, 0xAE09E8F93D25AF91, 
-0x7D65F5BD2670BF8C, 0x314A7B949E1546C2, 0xEC5F31E44C7D6505, 0x1A04E97B01B8, 
-0x2ABD0C908F4EF1C5, 0xB8EE9853E3E068C9, 0xC129902D5215D446, 0x6DCD21A113BDC2D6, 
-0x80FE4EB3809A7B11, 0x837A7554C8FD08B6, 0x80B2CA7C033D29AB, 0xBA2C8B25973502D2, 
-0x35796DF8E95F002B, 0x5D2B38DAB76832BD, 0x9273C62F4B77D4CD, 0x30206D24126F, 
-0x2F9675A39BB27266, 0x569F234793CB375E, 0x519EC40A7299AED3, 0x90C703650493B938, 
-0x7BB53F6DE292E8FF, 0x3CDF5D43CBFA74A, 0x485037B1DF898ED1, 0x12F93BFD119AD4F2, 
-0xBB880E10C3D942BF, 0xECEE706C6BBA1969, 0x992EFAA04FBB1F8D, 0x4A3F9788D686, 
-0x77FB2272BB125328, 0xCEDEF16D18EEE058, 0x985B7DA929F4B962, 0x87E9ABC8985AAD52, 
-0x9C24FDEEF052DB4B, 0x26D86E6DF4E9209C, 0x91162F4C4D6E4269, 0x99BAD746E4680638, 
-0x2F035E9ED01B08FF, 0x3A2B03AE73D3EE86, 0xA9F06B7E19A3ECA0, 0x54351802859E, 
-0xFF87862DABADF9BD, 0xD626069ECE79FD05, 0x6360F254551B6BFE, 0x7907F3938D67AAB1, 
-0x15FB34B4A90FA60A, 0x687BDA30AC18EB2A, 0x46BB54AE14088D6E, 0xC36BF6043656A12E, 
-0x7A283BA716D32C9E, 0xE33A5F2CC983632C, 0xB4B5D1D99ADB2603, 0x591804E09E4, 
-0x7284B679F965E3C3, 0x7C4E6E5030AE829B, 0x2D7E1CAD17C6D445, 0x1C8E40BB0FBC5DD6, 
-0x888D7B28FDFF71B7, 0xB3378D352097F3D6, 0xCAD476239E85AE1E, 0xE42E2C81599B8087, 
-0x57FF5EBDE5176290, 0xEE85BA200F2EDC9D, 0xBDCA17EB2C767302, 0x2F8F6FCD217, 
-0xB6252124D0738352, 0x8C5621845B361557, 0x634CEFDB3B84EAA3, 0xFFE741A4A82331C5, 
-0x386FD1D6DAD216C7, 0x971496E877FFBF4B, 0x2F0240B4095DFF42, 0xCE928793CFF3A735, 
-0x48A056F00C99D8F5, 0xC6AADD93A34682AB, 0xF5339AB69E4F774D, 0x328D387D11D8, 
-0x7A6F3153AA29BDCC, 0x1A81E716679FACB5, 0x11D14DCA1C3AEC89, 0x5A70A98FE5B63FAA, 
-0x92483BF80FC5F901, 0xAF8091C3206A45D3, 0xA2055CA473EB7452, 0x69C59B75B8E8AB2F, 
-0x3201628676AA4F86, 0x2C97D0FCFC13A8AB, 0xCAE34BFB0970C70E, 0x583DA3D5269, 
-0x2AA10BF62F90C5C0, 0x5CF31ECB80677BE0, 0x74D81F8E9EB2CF07, 0xA06FA5A535D1EF39, 
-0x231C4EEFD8B8174, 0xD551A2A2E17078D3, 0x85D95EC8F70237C9, 0x3D52870831BC88FC, 
-0x6517F7803A91216C, 0x70B61E8EF4A8DCF3, 0x4E572327FB577C30, 0x3141BF6CB059, 
-0xA81E7FE1D0885F53, 0x64798E91CC1CE881, 0xD58109075CCCE721, 0x659ED914B543D733, 
-0x313D63B039360E1C, 0x2457E318423F50D1, 0xD1EE5C8783EA4E7F, 0x285AAC5E9D1C3BDA, 
-0x3321A0297D9D31B5, 0xDCCAFF71310F60E5, 0xEE82C84CEF6988FC, 0x33F106D379AD, 
-0x260F250D66CC09EC, 0xBA5450BBAFA3507, 0x4753AAB79ED3491F, 0xA2AD762530D5F03, 
-0xF702C7688573EF71, 0x7852E7F8A3BB64DC, 0xFC2DDDD20017193A, 0x7AAF6D6A057C6220, 
-0xB62A378E483AEB48, 0x58647FE58D151E2C, 0x5D5D39F5C846EFB9, 0x1DB1A5CC4FAA, 
-0xBEBF164A9B02ED03, 0xB92518DEF03E3994, 0x33D22938027AEA02, 0x7D0E655E2365505F, 
-0x1ACC2BCF0E34B0F3, 0xAFDF231A046D947F, 0xCD3E4B3F5F29FA6D, 0x20615ACD51792434, 
-0xB5587F78E0EEDBC7, 0xC3A8182B56D93310, 0x1DD746C7F92C8157, 0x2CE5196E1D7D, 
-0x29698A42942953F2, 0x7382D852053DF010, 0x5BB05C63AF523861, 0x3245D1ED53A02A65, 
-0xC8B13EACA3950A59, 0x4D04962396E9CD02, 0xD8A0F4E423414CD2, 0xF71CF345E5511773, 
-0x2910C72965D3ADCA, 0x8762B3145E320357, 0xA34A46A58127C1B8, 0x123AF26A239C, 
-0x4E845FC2B3D1441B, 0x343D2CC3049ADDE0, 0x68F0328DE347A8A8, 0xDC8121BD82BF6C34, 
-0x6EA55B5BC7D1D4B6, 0x7970E086F974E5ED, 0x1AFFB861201AEE0E, 0xC04229E4AFEE2200, 
-0xB8AF15C2DE3A96C4, 0x87BADE2964E199C1, 0x13DD324500347802, 0x29F3FB019CA0, 
-0xE85EEE773B76A94D, 0x27773B9CBF06DE60, 0x6E3CA2D924F1E9B2, 0x3DB748A5C2B4137, 
-0x5B4CFBCF1664E07D, 0x32CD3877322A4CE2, 0x630B5474733593A0, 0xD0318008755ACB99, 
-0xF9929A3DB2E570F3, 0xC4169668A9D074C0, 0xC4489C136D2DF4DB, 0x62DDD028C2F3, 
-0x9FD1935EE6310607, 0x783C7D3AF99DF866, 0x91809EAA1E1EDF32, 0x453C49D732095A6B, 
-0x67DE1313C6C6CB91, 0xEE36B7BD787A03DD, 0xFD889DAE546E072F, 0x3555873D9071543C, 
-0x1E2CB8149B3F0197, 0x905A6E4D2D93386F, 0x2CDEE944ABD00B2F, 0x1CCCF96E16E, 
-0x153C340321D7B532, 0x2758CCACA4E957E4, 0x3FB6A4471947CF7E, 0xC88CE1497F4EA1E6, 
-0x1DD5636167635C75, 0x420A55FBD43ED1F9, 0x3731F892514739C4, 0x8DB647A33804508F, 
-0x6E441B68797D1320, 0xD010DE127897EBDD, 0x321570703D26B0AA, 0x59EE68E08F19, 
-0x460DDD79C140075B, 0xC1160892F665A0BC, 0xF2B7538BA7F5042D, 0xB364BD7DC217751E, 
-0x3CF5E92918B06CE8, 0xF82D5476D0086DFA, 0xD54CE8AC6C340956, 0x760CBBDC27BAE6BE, 
-0x66BA5F3BD758A4EE, 0x395E97994EF5DD28, 0x9866BF3735E090AC, 0x1D62AF7DA609, 
-0x45CF16651707DE87, 0xFB713C077EA37C59, 0xE531C051957A1738, 0x5793CC0BB896544B, 
-0x27B22C7968B507B4, 0x744F95DF17FE0384, 0xC1C56FF4267C5022, 0x7AFE6E6BC2A3978A, 
-0xCBF9FF0632B2CED8, 0xE716CD03C63F4D36, 0xB6A26ABCD054B51A, 0x23297C0518E9, 
-0x7889B0E28D950F39, 0xEE7B06A5D80E68F8, 0x91D9BBEEB09F2D1D, 0x7F84D090FB2BD3D9, 
-0x87522B89091365B9, 0x6483A352C77B92C2, 0xFB054786D926BCC3, 0x4C6CE3FCA3805470, 
-0xA6E48B2139685FFB, 0x5AD0801B5036C24D, 0x1F11291C1759E801, 0x24F9D574DFCA, 
-0x31219433F149B85, 0xC359FEB92E6EE091, 0x5DA24D38F382C4DB, 0x927019CEF5F7E265, 
-0x80134D0AFFDE9192, 0x8F5B9C0FD857E9A, 0x7665E530B68FE2D4, 0x57B0C403DD036D6B, 
-0x23D43E5FC52B07E9, 0x943EADCF7A2F6071, 0x4FF24311463FEFF9, 0x62E2659FBD08, 
-0xC308C0C6EA73DF2E, 0xB4549D3B9EEAA8CB, 0x7D364EA9350E400A, 0x85B3F2E01FFE60C3, 
-0x5DF8B45614A58FF4, 0x541F26C3D4E1480B, 0x29C76F8A8CFBD76E, 0xEAE5B6B9977704B1, 
-0x66220AE44D1B55A8, 0x34BBE64A46E740A1, 0x770C1BB80F599ACB, 0x6511C0912E6E, 
-0xD430C98218B9D19B, 0x666802C9B74C11E7, 0xB693FC81172F77E9, 0x1D59CDE17503F98E, 
-0xC8BE23492CD59F31, 0x9D4D49FCAD06F358, 0xEE93059FA8B9454E, 0x88A57192B5B58281, 
-0x194A60538118E00D, 0x596F814C132E6978, 0x59B1BC6C6A88FEDC, 0x279E79FA2992, 
-0x697A9B608BDB4E36, 0xCF5DA2F49092BAF3, 0x1934F8C7ED96BF44, 0xBD25A4BC71B40F88, 
-0xFDE717F2249B6319, 0xFCA0A725DB2A79F2, 0x33E6ABC6589A6D69, 0x22B3B0C53ACD78E7, 
-0xE2893637A4A42E98, 0xDB2880D8F64EEAFE, 0xC284C4CC7A5754F8, 0x6CAE5FFC184E, 
-0x3E70F47EA264563B, 0x18C29AE74E6C2154, 0x6B297390D83AD7A6, 0xF26B8004EE73DABD, 
-0xA2552226ECE2A647, 0x1CEB7916B485F3DA, 0xD202F1154AC62842, 0x5B990EA9F846B0C0, 
-0x9CBC9E868B988ED4, 0xC5E60889B025D0EF, 0xC2D07E03A03214E9, 0x19A5AEE9B593, 
-0x3DE42C52F6DC03E5, 0xC37B64F5473A0259, 0xD3D209F118183AE4, 0x38FB635621784975, 
-0x315C998CC64BB81D, 0xA601FF58A9E67AEF, 0x7D7027B7A2D286BE, 0xDC8F8081D64EAF42, 
-0x367A1FD0B629D779, 0x40BFF99CC2328269, 0x9F6CFEA2E85FA319, 0x2378F6DD31C9, 
-0x951A154BD308788B, 0x51776AD71A9C6607, 0x46755AA56EE54123, 0xC489C0C232C99CFA, 
-0x1200671E89586834, 0xFC053558DD51F5D1, 0xEB6CEDF32812DD65, 0x4132371EF6C9A280, 
-0x8612C1E2A74BA2FB, 0x6B062AC08A46E6E9, 0x76478B39DD1CC38C, 0x69ABF477C221, 
-0x16E299A4836C6559, 0x98A926D03E8CD51F, 0xEA690F659A81DDCF, 0x7B3AB2908791A190, 
-0xE203785F1C990385, 0xF3313D9832DC4178, 0x159F6F769419DAE6, 0x154A037584E0196, 
-0x787125181232BF75, 0xE33114D745589394, 0x5E6EAB47FD4922A8, 0x44C6F4B93C, 
-0xE4C3C904BFE8844A, 0x327760C9938E8579, 0x5AC603F899B29108, 0x4DA3E5F7E64E846D, 
-0x684AEBDC19B684FC, 0xD8A4A7C35388CA7D, 0xA6F5692045922E31, 0xC3A6D386C8180BC8, 
-0x99439B7338B9843E, 0xC12C318950DDC2A3, 0xAFAECEA2A4F958F3, 0x1A63F05B8FE2, 
-0xD99B6BC734654776, 0xE29CE5ABC3DB4979, 0x36ADBE9C2534A38, 0x831C6BF28B3800F1, 
-0x14E21B39553E55F4, 0xDF46570C440FE9CB, 0xA15A53BD8A6A6285, 0x3416F0A9EDBD9A50, 
-0xEDA855D89110362D, 0x245367BACCB29362, 0x3D952017DB837B04, 0x5F08301A5F31, 
-0xFEEDD8D9AAFD9892, 0xBC2FCB4A88E626B9, 0xFB14BB880BF194C5, 0x634782C75C94EDA8, 
-0x20CAC2B522E36A3, 0xC48B387D9339B4C8, 0x168351A6825B2FB9, 0xFA965F31857D6E18, 
-0x9111915256CB1DB3, 0x8B86886F0A50BD7, 0xB30BC872F79D5DA9, 0x3ECFCD98ABB5, 
-0x52BD605C093EA863, 0x4F0E5C79FBCA166E, 0x68511BE83629A42E, 0x9A40E675D69220ED, 
-0x7DE1D85313667056, 0x9ECC81B2FE5BF6F7, 0x2113CB3C2772963B, 0x7B5478F4A3512C60, 
-0x2D0A66F415843ECB, 0x2DABBEB61E019B27, 0x68B2E3098E915AC8, 0x345B7B503D72, 
-0xC5365B6F0A40CAF6, 0xFB6F6C05D64ABC01, 0x822C38E3181FED35, 0xB11790E5DB0C6D5C, 
-0x916D54E0FAC2A56B, 0x25CBEBA4F20D77A6, 0x5E12620D5067083F, 0xD22AB8F0B712415C, 
-0x15ACDF86801DF099, 0x4AF47C5B6B242911, 0x4DC6AC4E92CF2AD4, 0x261943B59D1, 
-0x941F4F7E850FAC2A, 0xDE619B0715C5B0F4, 0x334B133EA8F3C334, 0xC78410EC1C1EC994, 
-0x6184622473A79DF7, 0x3FED3DFE2506FF71, 0x411F06C8214F119E, 0x6E2B2E4AA1160341, 
-0xC8BB3843DCE765BD, 0xD18FECC1761CB594, 0xE246EC9FEF1DBD38, 0x246DDD9456E8, 
-0x20B05B4778F623C3, 0xFBB4E143BA84533A, 0xC76787508D9134DF, 0x4AAE8B65585EB603, 
-0x3C6BC7551909D9D8, 0xFE90502E63AE5C54, 0xE0C70373214D65BC, 0x9595AF54053BB15F, 
-0xFDA5297A7D03735C, 0x561CB7EC6AAA092D, 0x5B6ADAE992151790, 0x490805C5EE46, 
-0xC97DAC57A59DDCE8, 0xE2257C978A86307F, 0xC49F3B885964BBB4, 0xA48728635B7DFFFA, 
-0xF42EC76BBAEA5625, 0xD14C8864456D88EC, 0x898EBB34F2551B8B, 0xB0B9E95EAEEAB8C2, 
-0x62709F45A4EBD305, 0x9DC7201E704BE41F, 0x8CEB489153FE2FC6, 0x4F3383CACDA3, 
-0xB072B7EAF019AE11, 0x125D13A283135FC9, 0xFE4A1CE3B158F979, 0x7BE113A86803AD63, 
-0x832690D918DDAE74, 0x598D2FA15873513B, 0x530DAB6364CF062A, 0x551617AB4898C258, 
-0x6944D132377E2CFC, 0x2C1E4E2CAE9502C0, 0x3E4F8F158C222DF8, 0x258858D750E5, 
-0x3F811EA93FD4B838, 0x39619F3591AE9A6F, 0x4F9B3BEF8FBE49F8, 0xCF3C80AC779C4138, 
-0xC821F1FDAFDC7688, 0xF22E5CACCE2A0901, 0xDDF4116CF091FFA1, 0xE1B9394A0469A235, 
-0x7E82B4CAD3F93B50, 0x39692C33ACB8B840, 0xB00E522A2C101EDD, 0x552CA513955B, 
-0x50B8BF201FB197EB, 0x8288A498716562F9, 0x87ABA76EBD7BD505, 0xED94D560C83E40D6, 
-0xC52A47678991F04D, 0x683CE7E1BD138675, 0x34A3542C133FC445, 0xBEFFABAD3FB9635D, 
-0xBB29566A08AE06EC, 0x8430559FDE8CA979, 0x5E16C527D7B2A023, 0x183113984B5F, 
-0xBAF7917240A5E51A, 0x9BFAC28E2F2CF88A, 0x6077420E9AD3C3FF, 0xD0CA28B48FB545D0, 
-0xA856D152FEF4A227, 0xC6CD74F2B01707BF, 0xE7B82DDF97F5A7C0, 0x7D48C6FDB2FE52E9, 
-0xDFC59E9C9EDADD41, 0x10FB42B89203135A, 0x4E3179694F2A45CD, 0x38F6A8F8C7EF, 
-0xAEFF9D503DCF0C8D, 0xCAD19A9EBE6134A3, 0x598EE1AF8D7DE8C3, 0x39B49A5DD2BA8E4F, 
-0x7E3324E9EFC7116A, 0xF62535311E204981, 0x97F2BFD5D7950831, 0x6E588DAD5531F908, 
-0xE1F0211A53916A7E, 0x37BE5BA5DD4A4E35, 0xB3069056F3B33AB9, 0x1059384BBD27, 
-0x69F9A09B877FEF22, 0x3CA220AB96E51A47, 0xDF4A93A2BB81D638, 0x2F94345E4CF1B736, 
-0x81D6780CC18804A3, 0x4A06CEADDB7B184E, 0x7FAAAD424763FF84, 0x3233C1DB5AAEFAE0, 
-0xFC4A0143471E1BD, 0xBEA7A6937FC17AE3, 0x342E05BD30F61A53, 0x4C7DF9BBD1FE, 
-0xDDBBF48AEDF3FDF4, 0xB1C5564DF6C7B1AC, 0xA0D6C96E33506CA7, 0xD7F409AC39FA7FF6, 
-0x127DA7E1207B2634, 0xD2425B79ED28BE06, 0x9B50F64578EAA0A6, 0xC3855D1C684DA640, 
-0xF396A059B9D42F64, 0xB6EB72A2BA5F40B8, 0xE641FB4AD3ABFC34, 0x3CEFF511FC10, 
-0x43166096618E91B5, 0xA9D3117C74C5464A, 0x14B127882FC46ADB, 0xCC9F4AF5B1B3EBF7, 
-0xCF149550D4B01165, 0x40C2484D71C83106, 0x7A30B0D9F7807465, 0x489C0F624859D5F1, 
-0x7EB2078A76F13720, 0x43A2FE6740F155EC, 0x8793AB76BC15D1AA, 0x6A6A84E68AC2, 
-0x78DDE3AF62945E20, 0x7EA9D4AE176127D4, 0x7FBF5300A6A82E28, 0xA9F0786C738D56B8, 
-0x26B3367A44EF87B5, 0xB45AA7E10FF644B1, 0xF42E673F6F060D5D, 0xDD8888A212649485, 
-0x220BFC0235A7D8B9, 0x1E3D74CC850506F0, 0x497A59F0F2074DA0, 0x2A2BFA79E07F, 
-0xA40DE18563D273AB, 0xC51A752354905A08, 0x2788B8FB5B52F7C6, 0x4727776F51868E15, 
-0xE490469A647E188D, 0x483330D18D49355A, 0xB3ECDE810305E6E7, 0xA2662BAC979E8875, 
-0xCAFF0CAF47E98D4F, 0x50E093C46B9D331, 0x1FE91227CDCFFA7A, 0x3AD1E50B17AF, 
-0x8F69382370C0FA2C, 0x883FA05CDA032444, 0x2E5CE095C87629DA, 0x508CDFDA2021C84E, 
-0xFD22F881B258EC80, 0xDCB08DE0E709CBCC, 0xC80A0FB4A0FF30FF, 0xAE499CD5DE112AE3, 
-0xC792790331CD836C, 0x25C57DBBD88EB242, 0x54D8D7EBF639A8E, 0x2BD242F831, 
-0x71C62B41C30E26D2, 0x7B6A3C516F33B61D, 0x7D858707F68E5A27, 0xB1993CB61F3BDAD1, 
-0xA929E7BA55B212CB, 0x1D17FDAE06A3955F, 0x2C0AB0626ADAC38, 0xA37A68BF36624ABA, 
-0x1A8A21C18207762D, 0xA065EF3E5B20C577, 0x1D1C4EEBE8E8B4AF, 0x5BA147E11EFC, 
-0x6C01DE0DA65E0FAD, 0x9B0BC7A02E27D180, 0x8723A90862D6AD6, 0x538CFC77602658E, 
-0x9572FBA5C84A355, 0x8463E069DF572B41, 0xF944BB775CA6BF5C, 0xD6819B69F35C30B, 
-0x9D0212B8B3EE93E7, 0x4EC22ACFE49EC132, 0xBC549C59BEF645BF, 0x3164DFF283F6, 
-0x982F6E9BA2A0373C, 0x3D780DD79802C85B, 0x5F8EAFCC22455128, 0x28322CBB84A62319, 
-0xCA7DD7A5D4FC48F3, 0x298C03F48AFCBE19, 0xB5E2F62DB6FD7311, 0x48EA174B2844DEEF, 
-0x7F3E7A2F5CCA3DD3, 0xB8BC7BEE82552C00, 0x60840330E14FF9B4, 0x9E86B4E2E4B, 
-0x624794FF19BF165B, 0x8D5EF6889B85899B, 0xB92A2433599740C3, 0x386622BFBE6A1CD0, 
-0x372FAE893ADCACA4, 0xA96B51CC71221316, 0x737D062F86CA272D, 0x7C2E99F0B82FDC19, 
-0x7A44DB3CEF12D8B4, 0x44D79F19B1652EAB, 0xB3E1A37A4940FD4D, 0x5278E3008A8F, 
-0xE83E6DB641F03C0D, 0xBD60C92EFAC67AC6, 0x279D7B1E7B0AE3B9, 0xAB247397F9960EC7, 
-0xA36DDC25176FDBDD, 0xE4015A368E1F097F, 0x662F45D83DEB12BC, 0xE4B31BBC0383D4C6, 
-0x48DB7371381CD238, 0x2EBC1CD90BBF884, 0x230CD9337B2B466C, 0x1D8486E6F485, 
-0xC7E52F29B577C0AE, 0xD9B30888543A23E2, 0x21B7146CE7B397F7, 0x7623332153E51400, 
-0x6C5B4D7556030971, 0xA209D0FE60E6D76D, 0x4A343BA93D2CD660, 0x124515D82BB71C6A, 
-0xCB59ED269BB64AF, 0x98912BCF94B32DDB, 0xE1A3DCB17B7ADCAA, 0x56A08DCE392B, 
-0xE970B66168D9D800, 0x7E0A268235E7E93, 0xC03630BE0E9D064E, 0xF8FC6BB3BD8CE87F, 
-0x59A77D4938B407F4, 0xD5995E5F8A471C77, 0xD8F53474E35CB3DB, 0xDDA816875ECD58E3, 
-0x397FAA24EF46F3AC, 0xA4DD41A691125131, 0x1EDFF1A7BD89E960, 0xA9AC6A367A7, 
-0xBA2C203D30A764C1, 0x2015C47010FA49CE, 0x34D130F98C30AC96, 0x4AE3AC2D259BDF23, 
-0x4941F1142F0537BF, 0xD33820DC1ECE47FC, 0x829D2C39F26F6BE0, 0xCFD852F309E12C58, 
-0x311AF6FF21AD1EE6, 0x2154962D73D6D455, 0x49FB71C4EBC89889, 0x43EBF77DAFC0, 
-0x9568ABD0FF69FAC6, 0x929CC51B16C44BCF, 0x6B6ADDD5656CC429, 0xB9937D3A5FAAA0CF, 
-0x96BE3861B019D232, 0xFAEB8A17A156DE06, 0xF270816D451F0DD5, 0x51FD803F200A342A, 
-0x6818479C3E65B689, 0x7BF5280524EBBF5E, 0x5A1862490E0284DB, 0x2FC5BD3DE709, 
-0x3F66A29A3E685DF9, 0x537636658FBDBD87, 0x5846E2BC914AEC44, 0x51658A00D15D6CBF, 
-0x101CA38B960685FE, 0xD264B7226322D6F0, 0x9EDC129E4E966A71, 0x4C3D27A9E046CA5D, 
-0x72EB1AFC14103657, 0xE69414F061DE9DF2, 0x50BD593CDDCD4F88, 0xE996433F793, 
-0x44B963152A129200, 0xF40A3B7096AA8D05, 0xA0FDC42DDD3F940C, 0xA46CE5B1307AE3B3, 
-0xC338D1752BF51411, 0x9B2AB6739C707CCD, 0x31C2A4D7D7E01946, 0x14ACB58CAE027F15, 
-0x25DF1BF301AE243D, 0xF66CA7FD06E21F1B, 0xD49FE38A474420B3, 0x1AEC4FF5F39C, 
-0x8B08A38356337CCB, 0x900DCEB6EB9AF2A5, 0x34FC9E1CAF6E8019, 0xCEE5BF5B830CAEF3, 
-0xAA2F621F635851C7, 0x29473ADDA80E2130, 0xFB7B85B102A33723, 0xFB47B9A855CAE9EC, 
-0x4EBB4F08DF657AA3, 0x2578FCB51A035CAF, 0x51470BF101334FAD, 0x6E958F9E1CC, 
-0xE0BC5C5D81D1A211, 0x12CD290F748FC64C, 0x41EBA3091A038E58, 0x8D58C5A3AB80FCB9, 
-0x3660317C23367CF5, 0x3E7744B490EDC1B4, 0xAA4066C1359C5113, 0x458F9CE3E86F029E, 
-0x4C6B3D540090B7DD, 0x9094003BBC4A211C, 0xEEA4E9D19ADBF621, 0x30B0C930F5E, 
-0x7E9B5595E3195ECC, 0x96B2D755CB1D3406, 0x1EFB7261A68BB170, 0x82574F04DF24B1C, 
-0x2675B4C4C9C396F1, 0xEA60C9196092DE1C, 0x2B83772EC9401D76, 0xFB81FE58589FB5, 
-0x5D0884C95BE1F02D, 0x499E9BCB24714696, 0xB4A4ABAF396432D5, 0x2F1F50C7C82F, 
-0xC94B9DF4BAD740B2, 0x437FD0DE07050EB4, 0xA0A9C7F4948BD6FB, 0xB352B97EFCA100ED, 
-0x193BB3C58A85CAF9, 0xC169C36C7EEBADAF, 0xCBD091057805EA3F, 0xBB76E693D75B0CA7, 
-0xCF7A3CD80E818A2E, 0x45D1998B90F313D9, 0x1B218B4381ED1FF9, 0x3E475E26BB91, 
-0x84B609E6FF3B56E7, 0x41C38F1A4DAAF08F, 0xABF0044E531FA2A5, 0x8FE8D804B2419348, 
-0x9BAF550FB9AF647F, 0x41653EA736390E1C, 0xC09920D3A2A7842C, 0x8C9F43182D0931AB, 
-0xEF252C7B36BA0968, 0x136CA507023438D2, 0x753893E91A1809B6, 0x485434169661, 
-0x238553078DA1464, 0x147981BC4995B4AF, 0xCAF708B2A2F912B2, 0x9E76B9D36F4FC0BC, 
-0x82D35E23A4F44528, 0x598F186E8E612A22, 0xB081B9CFF922490B, 0xD8BF72A5C1E473F6, 
-0xCA73F24451EE6214, 0xD52E4B0B5D54E1CF, 0x66E5B24D4D6A06B7, 0x75F04C7DAA1, 
-0x7D1CB91C6D8D9C8B, 0x4688912AA62C354, 0xFA765F901A027B3C, 0x24BFB2797186586, 
-0xCF6C48FA40580329, 0x2A3D7B71A708B39E, 0x8555DB0A22F32FF2, 0x7D5AB7BBF6ECC8D9, 
-0x3C9443338478FFBB, 0xED6F1983A1E71A04, 0x4C9911742327E2DD, 0x5975DC140680, 
-0x848A50805E42250E, 0xE3515D367B49B5CA, 0x267E935EAFA7AFCB, 0x11356E8A7955F501, 
-0xCC3FB200B9D5126E, 0xD528D503001F40B0, 0x8B5CD6E2E94EB425, 0x482FF62EB474D461, 
-0x493E2425E524C0E7, 0x110DFDF693BFA420, 0x274C30F3C4F1824, 0x59E6D41856F3, 
-0x40FDF5DC6244CF8D, 0x7D12C9385728704A, 0xAFDBFA75709D19B6, 0xD961CFA9599CE4ED, 
-0x8E3EF9C0AEC6D89, 0x99E85FA190916550, 0xA4F1ADDB723F1E8C, 0xC9A6A5C9167C2136, 
-0x84A0CF08191932A8, 0x4130A34F4012280F, 0xBC08252C580C58CA, 0x5308528B47C6, 
-0xB631D087BE80694D, 0xB38197FC809CFAC3, 0x8D4DA78E89D047C1, 0x3793AF134F091419, 
-0xE1D1AB22E48E0177, 0xC8F61E25CE371BDF, 0x136F311ED2D70D27, 0x935064A784A71DEA, 
-0xAF5DF16251131451, 0xC8AE7C3F2A0DA8D4, 0xF5CECDA828320004, 0x2CBF8E22F077, 
-0xF986DA3AE50145B, 0x80C758E83912B46B, 0x65A7FB7BFA2D4E2F, 0xD3FD86CD3CDDF757, 
-0xAB5711C49BF1E95E, 0x8B0125351B8A57BF, 0xDEC4504992962C7D, 0x6B9FEE742C631725, 
-0x95944B211EBAB447, 0x34A62FA3C2A0309E, 0xADA1C2EDA80207A0, 0x6D24D715267D, 
-0xB2814421D1857D80, 0xD3A81447ED4E6A84, 0x12AC00F28406516E, 0xC4E99A0F96B6B924, 
-0x19F01F028715CFE0, 0x32BDC7D56E2D3CC9, 0xB1E6513391CEA5D4, 0x4B4369297A735E95, 
-0x38EEA5114567FA53, 0xBEE63F2DF03151E7, 0xCAEB360A605926BC, 0xE3714D309EF, 
-0x8ED7FA691EBC02A8, 0xA9DF0A7BA9213DF4, 0x92EC316ADB845B86, 0xA837F4175E020C8D, 
-0xE766AC23F7089B9D, 0x2F6066E8268053B5, 0x99333BD32E44796B, 0x64E9CDB8098E0471, 
-0x3E3A9A0A16299A95, 0xB9115E53D2923B93, 0x26B46B2AC6268567, 0xD7DF272409D, 
-0xF4F3BAD138C83201, 0x8972B9E31643CFCE, 0xECEA89426D4E3BE5, 0xEA1E28FC8C56397C, 
-0x5E7943E8F637BB07, 0xA3BB002627F948B3, 0x4DD1F1C66E37DE53, 0x835349098F9F8B02, 
-0xCB9CB0438D79B20F, 0x194A97CFFA230FC2, 0x542A505D194B72B, 0x5D3E15B9C7DC, 
-0xA80CF4F1D45E4DD, 0x780252AF9C0EE3D3, 0x53652571D1995EBE, 0x15FD90F000D599D3, 
-0x71409910973BC69E, 0xFE2D574EFCF44053, 0x744B69059D9DEE01, 0x2F1FB68F19381D18, 
-0xD96ADD7B56E3952F, 0x69CC861FA89E30DE, 0x3C635C7F51FCB8F3, 0x5E6AF837D73E, 
-0x4EA79CC8AB532376, 0xFDDC779FAD56F1CC, 0xFF521422A8033782, 0x71BFDF0C90FEE0C1, 
-0x7B74257B7D364EE7, 0xF5497FED8A3557D, 0x33B72CF288E64458, 0xC6B65C71EE3555E6, 
-0x706D1E238C2B01A4, 0x6ECA239DCF3B924, 0x2CEBEDCFBA76198C, 0x25AEA85FE4C9, 
-0x518DB4D776278DA9, 0xC2D35797EE04192, 0x688CEB1F5EBB263, 0x9D1128B1BC8E85A9, 
-0x7A099AD466330DB8, 0x89237993D3D3A25D, 0x36EBC62F29B897DD, 0xBE5D5308C917161C, 
-0x683A6457F6B8069D, 0xFA1052D94A3C660F, 0x8392E8E28BB47213, 0x6E8E4E3E3175, 
-0x1C5F58C33B67CB33, 0x3655DF929FD2BF94, 0xD649CF8604DD49B9, 0xDE45591B9A0DF1E1, 
-0xF733AEBE26470D25, 0xAAAD9518F3E05410, 0xA1BB6DBE84FAF021, 0x83785D8AC86879B3, 
-0x5D1390B1F3BD1B02, 0x5FF2C32D14EE126D, 0xBFC85DE8B6721D90, 0x5CC500282A91, 
-0xEC801A61F82F6261, 0xCC8AD18B242DBD3A, 0xF2E79D7C72AE4CAD, 0x4319779F180BE2B1, 
-0xE7EF0698F47C99EB, 0xF07B58D7EF041784, 0xA8A762DD77EFBBCB, 0x18D0B263548C1D23, 
-0x4AD407EFE8CFABF, 0x41169C22D14C765E, 0xA2191C9AF02B1FC, 0x349C5A87642, 
-0xD3C56351A81DA59E, 0x403E8F28A316830E, 0xB71BBDEF696AD9D0, 0x74E5F860881E3ACC, 
-0x1E0F8C60506BF39, 0x53B68437EB8B8EA9, 0xA62B427592459DAF, 0x28665406BB580704, 
-0x1487102F18BCCCB0, 0xBC2D30528A53B2BB, 0xED47D3AE5A8211D0, 0x615EA07F117C, 
-0xF59E406DC1BE9137, 0xE4EA0692E66AFE61, 0x2A205C3AF2BF919F, 0x54B83CE9AA8D32CF, 
-0xD3A111C0CD08D074, 0xA590AC0EFE899337, 0x7EDD17691DFE3FD2, 0x1C367FB6FDC90AC1, 
-0x368603A6926B8DDE, 0xCCC74ECB888DF354, 0xB75B3D05A5220E2C, 0x133786E353AA, 
-0xB1EB7D691596B3EC, 0x58A9DB360BBAAE86, 0xEAAD18525181C4CB, 0x8564BBDA546106CC, 
-0x263E50BE94AAD41A, 0x3609E91F7F729104, 0x50D64A414CF98F92, 0x64BAB092096ED3D1, 
-0xF754AF89B0845C18, 0x8A38AAB74EA53704, 0xE3E9F8C4F04DAB24, 0xB7E3CE65104, 
-0xADF88F28F569AC87, 0x3EFF4A80C22459D4, 0x7210B3E56EDFD084, 0x596EF19914E87FE6, 
-0x87CDF5DB417F7EF7, 0x5660F9DB0E5E1A6A, 0x38ADF7347944707B, 0x462CDFF064A6747, 
-0xED00699BC82BA45A, 0x53CADDAB4D94CA3E, 0xB2F2CF8313078814, 0x313BBC25BF7D, 
-0x1D7D31CC87BB3BB5, 0xA8A129AA13754DFA, 0xD76D46184EB25825, 0x7D71FBFDB88F792E, 
-0xAC02E525B18B0BC8, 0x7EA7364B84906C76, 0xCBB3E80F52F4C02, 0x76F7808460E606A9, 
-0xC576D4C7F6B72214, 0x43F7DDB76AEC0BDB, 0xF9B458F3577EACF5, 0x36EA38EC616, 
-0x1437610649D6BE10, 0x475DE4973ACFF466, 0x11437D61D330E7D0, 0x14109275D3236691, 
-0xDAFE049274995E3B, 0x2A6F1AFADE09D251, 0x11C4ED9F9540B5E, 0x69BF9F8A7DD9B76, 
-0x72E3B20E27623153, 0xC1AF17932FC41733, 0xCB4388CA7B25985B, 0x50D90F50163E, 
-0x2E294BC0838A0253, 0xDF7970C0126E84AC, 0x79C695794696487D, 0xAB19ABEC40A90823, 
-0x58E5E370EE518418, 0xA8847EBE748C514A, 0xECCC29216AA87CDC, 0xCD81CA29DEACC048, 
-0x2677DFF9A5FFC1A2, 0x49929BEC3BDF413E, 0xB5AC17E42780EDC9, 0x8A4D7C7C0D9, 
-0xAB680AADBB090966, 0x65A8CA9AF280DA91, 0x41FB0B411A341FD2, 0xE628A51DF05D8F5A, 
-0x1257E6F190F79A59, 0xA97915EF97902EBD, 0x9D242D072A3BD20D, 0x96E723133D9DE4BC, 
-0xE86DD870C1D38564, 0x3137709F5ED305DA, 0xD5E193E9B7B2777E, 0x342F72DC9FF3, 
-0x9BE20157A61C694, 0x95DBF8FBB612FC09, 0x9D4F00612A125662, 0xA120DD49FA4D44D9, 
-0x14C77899C37084E3, 0x6C48D2D460DCC201, 0x5CBB23534C7C313C, 0x5F7D6809DF83C6D9, 
-0x330826EB97953704, 0x70CABFE3D0B75B22, 0x369E39BCC18DD9CD, 0x4388757EFC46, 
-0x74E3D9FDC3199C68, 0xEA5E350D238EFEFD, 0x73C394488EB4C6D9, 0x70C63DECB5CD0D4, 
-0x85E75C270D87ECAE, 0x484DB25FAD4609AF, 0x1EC6614D58E23772, 0x8A41A0BF34A1FFD3, 
-0x4926E548C7A75BCE, 0x7970929FBAC36360, 0x62206DF0B148E8D6, 0x293F099FE943, 
-0x382A3B1EA2FC3EDC, 0x3CB3DC57D2CFF429, 0x7708090F494C234B, 0xEF4A5FC15FC7153, 
-0xD038A83176331D14, 0xE5A9D615ED59DACB, 0x4D32D71C37DD6810, 0x809378D393B8C75, 
-0x8DD983BF076005D9, 0x11618A244BD3D5F4, 0x38885901E4F0588E, 0x283B728FF7E7, 
-0x8C7B32925A2671BD, 0x4D12A3B20156914D, 0xFA40E061FB88E102, 0x1AF081FA637F26ED, 
-0x11BEEB6EC6486055, 0xFC1CC1882B0A0752, 0x2E00AE9F0ADB8B5E, 0xB11F6BC28915E822, 
-0x78004AC92E50B58F, 0x7D47931F8505C335, 0xDDF0BF01D1BE0920, 0x4DC1D3151692, 
-0xFF230124FCBA677A, 0xAA28EE1C363EBC3F, 0xF7F771A43296C913, 0x620F497194E79BC6, 
-0xD7F65DF5EBCD6D8D, 0xE3E342DF6362F121, 0x47BA6DAAF62101A2, 0xB614D9898868CF0A, 
-0x47D859DA1DF2FD8C, 0x21B88990B06526CF, 0x5A7C97C01F25CC4B, 0x21DB7C0E8986, 
-0x14A9C3D8D2D17AA9, 0x7B204AA382BAA346, 0x817AB948E42A38AA, 0xA6FABB20AFD23929, 
-0xA34E105057CCE154, 0xC9AAFFC316B7151F, 0x2DF299EFE77F25DA, 0xF2A2F03E4063DB09, 
-0xD31CA11B102F8E50, 0x50E9007AE1555A94, 0x57D25CCF104F1305, 0x37EF4A25BAE0, 
-0xD1ED305892D63EC3, 0x14FDC3D1D3C2ED34, 0xD7501128312CC46A, 0x34C780771BF4C289, 
-0x9AF6CB386BFB9FC8, 0x45A8D373B5AA63D7, 0xA9029EB9D26C37A4, 0xEF4BA33478B42BC8, 
-0x65B25C51F552271D, 0xA236203A552D69D3, 0xF050AEB5A8AB6BF6, 0x9A94C9B9B9A, 
-0xCD274B9A44C04536, 0xA99051DC994E409D, 0xEE1ACCB3058C8CD8, 0xCCB467365BC10A5D, 
-0x2989F2C10CD00B48, 0x9358B57C9D1E273D, 0x67E8D51B0A177550, 0x1D579B5003490FFA, 
-0x32842F7EE945925F, 0xAE42E6F1BDFC787E, 0x3CA2C3676F7C1942, 0x555B4A4CE470, 
-0x55F924F70A7DAE91, 0x3F747DAE6C40CEF8, 0x3D6FC9F1320F2513, 0xD1749F9ED74E8399, 
-0x1D6393A44BA2D6D0, 0xE7BC3A7DC6D821CE, 0x8E54216E2E7983F5, 0xA19D8DAED1558F1C, 
-0xFB6C3C9B74B7DFB, 0xBA970F28394FDB8D, 0x85E035E9D59C7E4D, 0x335AD3B7B7A4, 
-0xCC1EAA16AA8292E6, 0x52E76224314D3AD5, 0x5E8B4221EA60CB44, 0x13386CEDF9D9E268, 
-0xE43F3BFE40384523, 0x89F46DC738AB0AE1, 0x34D722699E756DF6, 0x6F243B9B4F5E5269, 
-0xAA192AB964958A74, 0xA690BC446A834C4, 0x268F094FF3B37533, 0x3F7AFB1F284F, 
-0x24DDC9B2BE824951, 0x368DEDB6FA017DD7, 0x6C6267E74E7DFC4E, 0xABAECB92633B9C65, 
-0x41FAD8D2A7E18878, 0x4DE2AF8524770005, 0xB9C39478953686D, 0x8ADC9867250DE872, 
-0x5EC4A711E06A508A, 0xE48B4EBBB8E26812, 0xC156E88036AA3AE, 0x4F2147AD5962, 
-0x1564E4B9FC3EF7AB, 0xFD7A2D0A43D7CE46, 0xAE0807D6C6083192, 0x9B1786697E9890EB, 
-0x533F1BD941F9587F, 0xED66D5830B72208, 0x250E316662766E80, 0xC2E6099FBF66C913, 
-0x6D32139ED49ADEC4, 0xF34F0BC9C75BBDA, 0x459B63C355DBD839, 0x5F2497D52E74, 
-0x662139ACB91DAC0C, 0xA44ED16A491783B, 0x8BFA668A08AB198A, 0x7FF2E948A184BD16, 
-0x7D37C94E4AD448C1, 0x3CDDC42DDF1CBEDB, 0x4ED04A58FFB66BD4, 0x1EE6DDA273F2FC83, 
-0x64B5D59BEBB80D39, 0x5DEB42DAFC8E305E, 0x16B7A7165D76126, 0x59356881CC94, 
-0x71BDECD30B7BD495, 0xE2233476CAC199D6, 0xC5D0C7269F78ECA8, 0x6E698E20ED4F3D79, 
-0x39F1C1C05DBE76D8, 0xB485990D1801D2B9, 0x59AD62EB329E3D6E, 0x6FD87EC9F887AAFE, 
-0xDB1F0D2DD27DE18A, 0xBE4D41837E47A171, 0x843B8FDB44EE836A, 0x35B73B576A8F, 
-0x10E9B67B701147C0, 0xA552DEB6FCB59588, 0xA478A52A21C83204, 0x15C4B1B0798768F, 
-0xEF8546AF7FDCD227, 0xC485A427E2564CEF, 0x9E33647D50E98B61, 0xD4E533B4D54502EA, 
-0xD2A45B5B213F68E8, 0x39EF98B45FA5170A, 0x5E6BB23C6E8EEF2D, 0x48E7C03AA050, 
-0x5FD7F6B19E51E193, 0x8764E230FB51EF40, 0xD3135B5525BFE4DC, 0x17992F7B4E64A9F1, 
-0xFA9EF96FBAEF49E, 0x18CDE5DFEC3DF0AC, 0xF3B7BCFD2D7576FB, 0x41455DD80D51513A, 
-0x40ADDB54B6F3356, 0xA351B3835AD339AF, 0xCBCCA3B61D1C2D40, 0x28ACED7D157D, 
-0x6AA388B286FB16DE, 0x758F5A9856E84BCB, 0x618C11368E4304D8, 0x72EF6F1D22B80D82, 
-0x9C78F6C9E187E72E, 0x786DD15DE65C2FCB, 0x3F61D871AC1F4C56, 0x893D61644C5C3770, 
-0x2F702A14218FD601, 0x4B6D8D3815E5C77, 0x20F062E619C0508, 0x33884B58711, 
-0xFF11E7CE04ED19B3, 0xB1F8878D561E5C32, 0xEF9DF6C720F64BE6, 0x59123A731DBCD140, 
-0xA95BE86451E150BD, 0xFF3EFBC5ED35816C, 0x12FD973742B4AF76, 0x95D1780643A78339, 
-0x4954548CB6386437, 0x40B891AA8526BDBF, 0xE42ABC4F6364378E, 0x604FCB69D942, 
-0x78A662A5870A9F99, 0xA672D6A631D8CF73, 0x7848EAC4A15DCF2B, 0x6C9A3991DA0D70C, 
-0x248CC8B6E84FCD8C, 0xFB8887ABC11F52FF, 0x955BDEB01020498, 0xEF5414CE375E34D2, 
-0x3AFE7D8FF9B23F46, 0xA4404C809172F662, 0x5B15702DB3804007, 0x68F86F70FC7C, 
-0x3DCAB7871F4F45BA, 0xA039AA6BCD8B62A1, 0xF72834E3D5FBC7C9, 0x7DFB1480C05BD112, 
-0xB1700E87E3C4B35E, 0xF09E879A31B896D9, 0x7D9F2A96CF6D036B, 0x1E6B72B7F682F36C, 
-0x882AE1976DD764A3, 0x129324B8C3E55A0D, 0xFF6BAB601CC3CF30, 0x6A2854005DBD, 
-0xBBAA64AFCC4B3072, 0x6F4DA61361CDC1D2, 0xCEF9B2A8C2247E19, 0x4AF0AFDCA1FC716D, 
-0x3E8D1AC27ED1FAB0, 0x555C67E01FF45D86, 0x67CE25AD762AA55A, 0xA06DC9056BB4C1F8, 
-0xCCA4877DA807963D, 0x89F1E0C32B3D27DB, 0x32EE1894B9DBA03B, 0x24935B314026, 
-0x7023694BB4F82886, 0x1BB5E891FC210632, 0xE9108F824EF69FB5, 0xF1265920F9E0C710, 
-0xDFA40110CA451838, 0x2F9F32B19058549A, 0xE1E2C155A340C188, 0xB4D4F3EB0BF0C9E, 
-0xA6D85F882ACA9674, 0x604B6E32EAB346C0, 0x2C57C35E74F32A59, 0x606459895C41, 
-0xDC1BEE297573D4EE, 0x178679E723CFFAEB, 0xF4AEDB96EAD30F0E, 0x554E431F4B69AAAD, 
-0x792C96F712ED8258, 0x291B8E2D27EB9667, 0xD533FC93D4726819, 0xCDAF826190FF8103, 
-0x7B1685C2E632BA87, 0x99F1CD4F145F4AE2, 0x955AA6931651A060, 0x3E4D01EBFA82, 
-0xE31C4623939DD533, 0x3E4D4E5B91F195AC, 0x9E751DD5FFD79B59, 0xF5A76C45B0BB2F3A, 
-0x78228F93B1E86406, 0xAD62D9451727C5D7, 0x2678F4AEECD2CC24, 0x610CFA6E9A4EAF36, 
-0xFB5CD93D8F1D977, 0xCF482BAF96B4B354, 0x4644BBD828796D4, 0x3AA684E501FA, 
-0x94D213A5E6E6B323, 0xD045636B75484556, 0xE2AD53905BBBC019, 0x8050AE1E7BD676A2, 
-0xC05D768C1F508166, 0x383FF7075E3B7467, 0x178F034DAC6E763A, 0x1A9AA12BDC7F5F3C, 
-0x234C01EB5E9853EA, 0xF2D7925B149B5B84, 0x348D4F1F180D28A1, 0x37C5AA646D55, 
-0x5D536A84E5FA9EB9, 0x5767286F0EFD0780, 0xBF1A0FE570B85513, 0x3FB6EE556863EF58, 
-0x99C1231A0F8304F9, 0x3DBCCFFBC1B6DC86, 0xDCD629518F57CA19, 0x783AC8AEEBF69EFC, 
-0x458B120F5B8031EC, 0x97D5F22E76641DC0, 0xAC2C01A5785F10D6, 0xC8E739EB8FB, 
-0x8FB02FAEEABDA421, 0x38B6A990F335832A, 0x7D7CC254CA66CD59, 0x256D56B23F6AC14B, 
-0x5E0B18F479A449E1, 0x2AF51BA12A9B7E59, 0x67C339FA9E4723E5, 0x42A8F7FB816E2E34, 
-0x6A301E9F80CA5EA5, 0x1B7DF2B5A7DE86DE, 0xE90E3784666B0F4E, 0x20203D8033B3, 
-0xA3B7A91117367D47, 0xA697D221C31C37F6, 0x6065D4D26B7C0EDD, 0xD8B593B0AAFE99F5, 
-0x5BE6C2C1E6CEE477, 0x5B385F62A7DD80DE, 0x35EB4386F5A9B181, 0xEF8E6C66A77FE998, 
-0xBB7D712762B883E8, 0x99F12917A6BF089C, 0xBE493FB913E76E5A, 0xEB070111331, 
-0x86B3FD8F2A3F556F, 0xE20A24AF9AF31288, 0x280F8CDC01065E35, 0xC414198025551EF8, 
-0x3A8BCE608309A03A, 0x54AB7F5EB02E4D9F, 0xCD69AD9CA4D41F2A, 0x7BCAF7F5C4A7E171, 
-0x44F50A67835EABEE, 0x399711A1EB4A815E, 0xDE09E1D2B965E78F, 0x40A5B303528C, 
-0x3051DC8E43317FB0, 0xC163449924E859C, 0x49BBD8A383ED3ED3, 0xE864876B612C40CC, 
-0x5894C874D2B9768A, 0xE43C8C8CE7D1231C, 0xB1FCB1C53E80D0E1, 0x78BF53D07254D7FA, 
-0x167CAC34BA35459, 0x929516C3FBA30DCD, 0x782F568A5614A48B, 0x34C9A472957F, 
-0x1473C9FDD7747F9D, 0x2A26D2F5EA36D5CE, 0x2CA7E8C949DF638C, 0xFB842138DCBA79B0, 
-0xD14E0A783F147AC5, 0x9F9335C29904819D, 0xC8B9D16C34D3EB28, 0x930CC0C0702EA8BF, 
-0x78E4DD909F0CD0ED, 0x25DB917CF9719F14, 0xBA188135FE6378B6, 0x5920C7127B86, 
-0xB12812F3F54D804, 0x42CDFC7AC4876EEC, 0x8C3EEE14F79613BE, 0x5BD9F3E4A61933DD, 
-0x20F53EFCEFA7ED5E, 0x38899E7B7C5519A6, 0x16BF95FCD1F57E96, 0xA1E5E09E2652C8F6, 
-0x7A208B7571F0F872, 0xFC8B338D52CD7F12, 0xAB08D52B46A03BCF, 0x40B2D8523BF7, 
-0x91217CC8AAB3E9C4, 0x3C35629902FDE13B, 0x133E3D9F7A96B07D, 0x4A318B90A4A29851, 
-0x7D3D7F1BD0EFE4C6, 0x364F8FFCE9282FAC, 0x2959724D33931064, 0xB80A9DB55873D864, 
-0x2746DADF327169D1, 0x8E56ADAD693726F3, 0xE828BA490C5D9945, 0x19DD8A30A653, 
-0x42D57F7ED738AA39, 0xFEAF9B2CD12D94B1, 0xDC106A0DEBE4AF04, 0xA8BB8F05AA22B75E, 
-0xE56747EC9ED6B344, 0x991E8BE44D2E0D59, 0x250389F8C27BEEC, 0x920664803D4C0EC7, 
-0x901711AA4C0750AA, 0x44DF24E5968257D2, 0xC40CD18C58C6702C, 0x51C9F05E913D, 
-0x701C88C5FBBAB83C, 0x3FB94CE92E0A753A, 0xDD315C5C8FE20816, 0x505D2C2604E4DBA2, 
-0x69E47B60C7E2637B, 0x11479C7A128EF74C, 0xB2B45AF09F2C0093, 0xA3ACA193D2F9AB60, 
-0x8472D9907276D2EC, 0xFDDB6AD1FDEE08F7, 0x158322C0A1CFFA1F, 0x3FBD799C59E6, 
-0x4CF683A741B5079A, 0x7BECDB6EDA0E14A5, 0x5B487F3585062A17, 0x9DE49CA0875EE6D0, 
-0xA925E4F46D599EB8, 0x202E971D3A0C5A7C, 0xCA6BC783D1A1481D, 0xA5833AC3A25FE401, 
-0x25FEED04F511E00F, 0x5AD198FF9A941F07, 0x2B1B0A50867D273C, 0x5F960EEF74BE, 
-0x3914367515D10FC7, 0x8CD9EB11E1C1F871, 0x316161EA85872A02, 0x9161B9F88562FA72, 
-0x26CB69668BAC21EC, 0x5DDDC4F88D4DEDA9, 0x3B10CF12EFC3BEAA, 0x407AA507D52697EE, 
-0xB95508DC271E94F8, 0xC97B95CCCA9FBC76, 0x5D597D72C3AE3A7, 0x675FFB4949F9, 
-0xC3099DC8A1DFB1FC, 0x28E8C8DFD744BD19, 0x7DE9B3411532912F, 0x2B1D1089FEF837A, 
-0xE8C7158E16A26312, 0x4D18EE876D0B9D56, 0x198FB7B663B9242, 0xAA27497E6629CF15, 
-0x4AFB3F18527C1109, 0x4D48E970B8E2CC77, 0x10FD49AE292133E6, 0x33A58EBE4D7F, 
-0x5F7A9247DB247D4B, 0x14DB02A9387A9D7, 0x4DFE1B2814246238, 0x77A5B111FD237C06, 
-0xFCD6224F7F30C315, 0xF43D1722C6562E69, 0x37E26C8C89686BF3, 0xF4302C1B7CD30AA1, 
-0xCD3A03136F8C4829, 0x3D076BFA30EEB01B, 0x1E92EF8D17977B5B, 0x45602EF16827, 
-0xDA325BFA7F89B7A9, 0x735043B3760A63C6, 0x3E9246220C4A6AE0, 0xF6A6DC90966C09C4, 
-0xE94E5BAD32554EF6, 0xB91A18DAC4314535, 0x5B6F1B19D2FCD324, 0x6A5BBC2283BF7EB5, 
-0x2AF3107EC07F4623, 0xBF5944A9D3C8D37B, 0xCF452A0EB438BB43, 0x57C81E925F05, 
-0x4EDE3C9D52E51D3A, 0x67FD0B6A449D631F, 0xE7D229B5DA6C7C83, 0x704F4A9C93C9DB24, 
-0x8CC6E2533C849BB9, 0xFB7E0A9C4523C4FA, 0x5545B0C7093072C9, 0xADB45C731EB05E77, 
-0x9CEE54B5CA465EC7, 0x6A532B5A5F612FAF, 0x8D11AB8D6FC7B143, 0x21CFBE8DF5F, 
-0x576BAB017D8864AD, 0xEE5B68C007729864, 0x464226976482AD0, 0x1B8F99DF4EB3F3D7, 
-0x606007774E5F1445, 0xCD331F2C37E3303F, 0x1C68A1C1AABF462A, 0x63A3E2E4449C9746, 
-0x704296252673DA3, 0x6B0504924B3ABEE3, 0xA3FC4C44C8931835, 0x471E06E42DB1, 
-0x2CE7A16C2A46A68A, 0xE56F387F6EBCE729, 0x506F663786AF53D3, 0xD0F59B7CDF3C89AC, 
-0x16512CF02662FEC9, 0x89524428AD7C7EDB, 0x8E8574236CC66957, 0xDE88F40410B94090, 
-0xC10AA4A6CA6E5C44, 0x13B78AAF366438AD, 0x820F3B77DF8F8E68, 0x23FAC561B78E, 
-0xBA69257F007C2E25, 0xCCC00EB17664C724, 0x6ECF7FC34678611A, 0xD005C98C82A87E49, 
-0xF22E9545617F350B, 0x2172AA3C3304F082, 0x7209DE48307FB80F, 0x1DA22CC15E5B9F8, 
-0x2535C30215808463, 0x6149E09AD9567F86, 0x24E9E9089E7ADF60, 0x6809AEEA0824, 
-0x51871E49861E61D2, 0xB80BFA75E8874229, 0xA7A071D197049C04, 0xEC1C4BED4D81C828, 
-0x5BB341867E5BCF9D, 0xD511EC1B6E80DFDE, 0x3957700E8527270A, 0x37623DBA2DA147D7, 
-0xAD24F946FCAB7CD9, 0x8FA81C242148D424, 0x6DE9E69058C878B5, 0x1783A07B03CD, 
-0xAD4D1C25CA0AAEF0, 0xDB4939C2F0926024, 0x4CC9FA66EC67D563, 0xA38E001E24588F9C, 
-0x3318EDCE6CCC8570, 0x13668BC69AE59304, 0x3956C667EECC6149, 0xBCE5D4FEF814F252, 
-0xD7320BAFCFAC7E5D, 0x3D37D28B40729B46, 0x72444B95A69F5E5, 0x1A510C641641, 
-0x3162DA5E03CFACFC, 0x65C1D64992780E38, 0x4E3A5A66203B3D3D, 0x4114613AB757841A, 
-0xBE1FB73CD9B78BC5, 0x7B8C8B6FA92D6B79, 0xEA83149BF95CAA89, 0xE46EE7EF16279013, 
-0xB0BEDEFC125C2D5E, 0x1165B9EB1C154475, 0xD3EDCA2C4D1D0877, 0x6A9101C7B9E2, 
-0x791930A1AF9D0B2, 0x7BBEDF6A2DF4DC8D, 0xF6559D65935EA7B2, 0x9223BA0CEFCC79A7, 
-0x40276EEEF9C56F21, 0x3150E44BB74DAE6A, 0x7495250A8FA49A2D, 0xA135126E67977EE4, 
-0x3C0DA2D6918A85A2, 0x2E13C0F25DC82819, 0x71EFB1E683AFBA50, 0x65E9BB6598CB, 
-0x7F49D7C6465908F1, 0xA9C7B595CCFE7AB9, 0x733D1083C28AE4E, 0x76081FC6A952F8D9, 
-0x1B98483D19FB3EFE, 0x6536D7EBC6F7AC17, 0xC1AADAC965D141CF, 0xA93AE9B0A8550C10, 
-0x8CEE01B7F8549A2F, 0x5D56B5BF852FC5EF, 0xF3E584FAB47529DE, 0xE8EF8B6200, 
-0x1A181651F3CD2D79, 0x467FB97485A7FA03, 0x9B9FDFF60B1E1BF9, 0x8024B245F150447E, 
-0x3A1C35C1F0B6378D, 0x47722A46574877A9, 0x64A5C0563D0C88D7, 0x3E33AC8679D31D05, 
-0xB09FEDF36F4F1CAC, 0x74784848D638C0D4, 0x5F264698330387C7, 0xA0D1B2361FB, 
-0x5893B290F4888693, 0x18958F455864A8F3, 0xE7093BF0DA579D0A, 0x581595B27FD8237B, 
-0xAFC0D103E65A5EF1, 0x43BF96A33C5E713C, 0x8C967D13B7370580, 0x853E23B14304A48, 
-0x8DB4D28F868175DC, 0x80EDB6FBF3C940F6, 0xA2BCE41D7BA231FD, 0x1BB3CBB18A20, 
-0x8AA6B40E945E1AD3, 0x333ABCC89787DD42, 0x86F8E2E1820E2A39, 0xF711FE818348BF9A, 
-0x181CD2E4DFCF2CFB, 0x8DB85939B0C37AAE, 0xF42E775B55F53697, 0xEE5E5FA9CDF741FF, 
-0x96AD526DE2A5D336, 0xE01FA65A4C038363, 0x9579C6FD7C93F54B, 0x4AF15D7B2D82, 
-0x94682569455201AB, 0x7CA141C29FACF975, 0x55EFB63584CB4E73, 0xD984B588A2CC48D8, 
-0xD39B351A6BD5EFAF, 0x1CA2932A17FD4E3E, 0xCB5888BE9ACDB7E8, 0x9E3DEDB803F10F11, 
-0x500FF03DF21B0C7B, 0x1AB7813B38E34942, 0x8B828D8583D16CBC, 0x4CF101092DC3, 
-0x8AB4C8FEF3B9A230, 0xDDED4721C1DFA7A1, 0x4BE5F2DD43211794, 0x203D892294B851D, 
-0x2F614B77C43DBBCA, 0xA24E2B180B367D1E, 0x484A9BA0595574CE, 0x77AF75D6163D3777, 
-0xC07EAA8C2C1726BC, 0xA9B2948CA57A44B7, 0x6C521288BEBF3C9B, 0x4B98512E4F71, 
-0x383B195FDF08A2CE, 0xA8A9067EDEE9C673, 0x6C990C86A2804353, 0x20D0F94E702B071D, 
-0x5F0899409B9E672F, 0x2FF35AB72424AEF5, 0x4B688011E357FFC8, 0xF1D02A26E0347155, 
-0x309574D96C9F8217, 0xF2E4C0D32904CB8A, 0x8A61449746549CB, 0x118AC6C52368, 
-0xCF60834DBBF1B184, 0x2DD36F96FD26B9DC, 0xFB90B4166DF986C4, 0x40269E17D1E51271, 
-0x7DE51005594C2495, 0x66C75929D7251197, 0xEF41F6B93222F01B, 0xBCA7D5F816ED8C28, 
-0x7EE70E3F03F60150, 0x6AEE683F0C673818, 0xBFD55741206FF5D0, 0x528E3008A2A7, 
-0x1B03D6D3E904479F, 0xA6538FA6E947E8E1, 0x1616E36F1AA27FC6, 0x8A82FDC4A5D5A40F, 
-0xA57E6B6A86CF503B, 0xC6242E286A3A8BF6, 0x73AE32D7B7FA3D30, 0x4A2BDA7B230E5D85, 
-0xC64B1EC2C46C7EE, 0xDE7AB49E15C7CDD, 0xE69F9DB09E89C937, 0x23F2E128184D, 
-0xECB01F0D67086EBD, 0xE59F685BF2F2A1D3, 0x2771CCB219DB415B, 0x8E9ED31F0340DF31, 
-0x7F9165A9E11412D5, 0x27E968C81C8E69B8, 0x16DC200400F08C00, 0xEF3DEF9AB06D2A26, 
-0x148A0FB8F42DABD9, 0xF116E2BAE96162E1, 0x501CEE10DFF62FCC, 0x3329090E0EFB, 
-0x439530C26E952F6B, 0xC753D914CEA93DE8, 0xA311E4E5836DECD3, 0x22116060123F404, 
-0x3B36323C3F2C13CF, 0x5858271754989174, 0x2ABDFC4E9C9EC60A, 0x4651DF37D024FD94, 
-0x7E8F5882363EDC7F, 0x1A6137D2D46EFC5, 0xF9678AE5710EA302, 0x45E2E03FD60, 
-0xDAF0D6F008C5D1E, 0xBCBA35E349ADB83, 0x6045FC9BF33AC253, 0x2A55028379869FBC, 
-0xEC228CB671B11123, 0x9F8D5C15A2D47445, 0x8CC045BD62975307, 0x60DA1647009FC8B9, 
-0x44969767260F39F7, 0x7771CC412459B45D, 0x5BA76C9CEBC2B849, 0x243D4E459591, 
-0x5E078CD9BD91CA6F, 0x6C980868D6D0F205, 0x169EBEC4280767BC, 0x1521AE11F466DEBD, 
-0xE5895DA94E69BA20, 0x8DB62AE329E63AB3, 0xA3FEE62FA6C32248, 0x4941724575FBF2BB, 
-0x82A4363A04D380F1, 0xA1A8DAF36AD922D3, 0x9187E793843850A6, 0x46CFE0C2178A, 
-0xB0E0AC3B8DD79C9D, 0xBC3CFC8D60C8E171, 0xA992BE105CC883C2, 0x805D8BC670AA372F, 
-0x98EE22B9C81020, 0x413E67A0C7E3ABAD, 0x612BF6721FB71C69, 0x8FB16D4EE1E17E0E, 
-0x565A8573BDE9E916, 0xFE5230171E0E7EA9, 0x1164365AD5FB2119, 0x269E61C35D03, 
-0xEAB320D45D37DB6B, 0x7B53399061318975, 0x25A1118C8D0B7D43, 0x88364839545F0870, 
-0x1B323B92C9A7EFF3, 0x83191383CB22793A, 0xD290124C15B34265, 0x9E43609074A7B3CD, 
-0x90A02AA3FAB7E2BE, 0x73A6C6D5D65591B9, 0x5FE1CCC23DB23AFD, 0x44D0965E5402, 
-0xD546374536E6389A, 0xDD2FD4C2EEE16C2F, 0x1BD069E6AEBD1816, 0xFD8E5B5B9DB261DF, 
-0x49A8587D5994792A, 0xA85B9FBEA0E652A2, 0x3FE675018ADC6A5A, 0x742D94E5D435935F, 
-0x7C8B41D67AB5F1BB, 0x4F22CDDAFC9D8745, 0x80545EDC8012707A, 0x54968AA29D0F, 
-0x389180898A7674EB, 0x6F1B9373158E872F, 0xCB65BAB2827EB710, 0x90EB8BFA4F3F0CC, 
-0xB65AC324506026F4, 0xF94198A91E8B2257, 0xF605F3E6CE4F5606, 0x19D12646F70C87AF, 
-0x7981BF2134DC0038, 0x25EE8F9FFAB7B847, 0x6B6527FAD4485EA8, 0x1CAA0F9E6A16, 
-0x3FFDC613C66F30E6, 0x716BF9861408062A, 0xA895B1CE8C147604, 0x9059983635956D75, 
-0x6102DC05367C89F, 0x34B0CDFA76B37BE4, 0x89C240321970E582, 0x4A80F3285E3356FB, 
-0xCC65D66D6A96973F, 0xEC0B60B7117758D2, 0xCADAF769492437FE, 0xA78E2010B8E, 
-0x51BF00AD1379E8D6, 0x937B3CB4E00B5912, 0x24904D68860747A7, 0x56B549D4C103C7DA, 
-0xBAC6A3F725698FCE, 0x968D04E42E6C1453, 0x6771575FB3CE7945, 0xCAB593B275BC7322, 
-0xEF9061428DFEF126, 0x5B7857831F8E2C3B, 0x7EA297E7D61D6D9E, 0xC0A10FF6E43, 
-0x63A900E04C8E1667, 0x8A9611C626A0752A, 0xFC2C52C91FAC0936, 0x9BD556FFFD2F4F21, 
-0xDDC88E9FCBB993B4, 0x2AB6B1CFF4FC72DD, 0xB8E38FBDECBF2C56, 0xBDF356EA701D70BD, 
-0xDB2C56D4CD8A32F8, 0x52B429A27222DB31, 0xAF9C9EFCD318F68C, 0x34E5EA39BA06, 
-0xA053CA6ECBA2E111, 0xFB84EC574467C030, 0x9CE56EFEFFBE9353, 0xF484DC55EF300A48, 
-0x1C9B89CC292C1D63, 0x1BE6E932B1EEBD76, 0xEF3F90B525DF215A, 0x89AB0FBE0551B4B2, 
-0x87408A0FE34F5D9F, 0x717C2E2403D7CB89, 0xFDDB7050B196D147, 0x17B90ED39D3A, 
-0x4C75BCA2A96D2822, 0xD9E7A9DFF4E8CD1, 0x295BC8E27DC9827, 0x7DE45043CD7BC51E, 
-0x7331E2EF73CF8689, 0xF97792D1BBCA144, 0x4BEF2C2E6D1C7050, 0xFF52C72DA70F177E, 
-0x46DD930B0012D5A2, 0x99DAD6BA242354F4, 0xBBB75D97082C2015, 0xF9BC251F5D3, 
-0xA8B4E04306D7252F, 0x890008088064561A, 0x8346BF250ED6D16C, 0xED42AB36F16DAA50, 
-0x9B426D7B13DAA26B, 0xAF2117E7828EBB7B, 0xF42A2A3A4D980BA6, 0x9300692B874A12E0, 
-0x7159638304C92702, 0xEA1FC760247718F8, 0x68928FBAE3E02A01, 0x3151C02C5D4B, 
-0xD8034E241E5D6EAA, 0x1D839215D7EC90E, 0x34A21D6B15DBD311, 0x5FEEC15989F6EE26, 
-0xAE8AF94E25FBF6C9, 0x94440878A4A1BC89, 0xA0FEF995405DD99F, 0x2A4000DFC8C94B0E, 
-0xF91D9BBF39A57C6A, 0x6C55836BFFFFCAD1, 0x23685F6D71B5003A, 0x30BCED3D5ADC, 
-0x1D652F62B049E1DF, 0xD15E0BCA7741D57, 0xB7D84D23D16010DB, 0x6581FE095109BD1F, 
-0x8D82AA2916DD384E, 0x87646B0CB04D74D9, 0xAACEE6C4FA3BE937, 0xA404D612C4AF7959, 
-0x65FCDFB6D7B80507, 0x97EF07D62FB09D75, 0x1EC84993E0DF3015, 0x17C3B0B9C4E3, 
-0xE4AE34F8BD7ABB37, 0x552B400692D45029, 0x37478108D6706E0C, 0xAD13C48DCA6B44AF, 
-0x17EECD4B323B3DDA, 0x5B5BA6E104877815, 0xA321831919FBC04, 0xB7F7434C1D2B333F, 
-0xC7960F6E10862E2E, 0xF138E4A40C12B437, 0x89002CC09CE2F808, 0x4D476EE7EA25, 
-0x1298C8FB732ACBB9, 0x7F5B47D978895A04, 0xE7F3932860800E0B, 0x4206AFAAAB37C4EC, 
-0x78398B5B4508B4FB, 0x7EB968694E4BFC77, 0xC7E527CB583FE080, 0x987165EB0FC0901B, 
-0xAA7A9F385EE44EC6, 0xBCD80B89794669A5, 0xEA7675CF128DAD8F, 0x5967FBA37882, 
-0x31280118E4D6FD20, 0x4C5E58D817E2BD67, 0x61AAB9F128A71A70, 0x828BAECEF1B43114, 
-0x7D6F2366A3A732E7, 0xDF1AD610CBE07669, 0x2E0A007E99ADCBFC, 0xCBFD0889DADF7231, 
-0x1C2DB3444043229D, 0x9B8BD3A70A3FDEA, 0x2E564C680961EC67, 0x364783CA1C0B, 
-0xCBAF425B78D2A075, 0x144B8D1E228D69E, 0xEB14A1EBACBB321F, 0x6DDB366067AC8FF7, 
-0x5034EDA9D0490016, 0x16F1BDE6D7F61A20, 0x213BEE515A5ECFC2, 0x146E6B5429BB104, 
-0x9F7EFF7B67BC47E2, 0x35DAD691B03A6A1E, 0x7843ECE9E0EC4924, 0x6544AA335C5A, 
-0xE69FAB6DB2E7CA16, 0x419877254242642D, 0x73072A299FD8F4B8, 0xD1F1BDEA37ABD611, 
-0x6D7C9BA725662CA7, 0x43C78A45703CC147, 0xA6FD674F7025D105, 0x50F1BB344807512E, 
-0x765025453F7B9DD2, 0x839798F3417645F7, 0xAC4F1F9B7CE25C6B, 0x57F0ADDB28FE, 
-0xD029BADE36B717BE, 0x59D7D38276484DF4, 0x284B285927FD3E31, 0x1FD4FD1DF7167453, 
-0xAF84C5BFD768E65A, 0x1918086C6D1672F, 0x8470AEFBBAF9AB45, 0xB4B0CAF857F99A4E, 
-0x59FB2151CF6EC351, 0x69FA3C7A07C100D3, 0x7EE74CD7B04C3F99, 0x308250BBD5E9, 
-0x2FC4B5D0AED849C, 0x6F314B43BA5301BB, 0x9F8590005151D2E4, 0xE7B77920671F39D6, 
-0x83DC2F1047068F8C, 0xE2AC5AF1CD54AA9A, 0x8E26B0F47B07C97, 0xDC40B4D0ADF27C1D, 
-0x1D7169F248A7515, 0x364833E2BE32BA45, 0x29CC295EC15B6774, 0x1079F831F381, 
-0x7CC741FC17FC5408, 0x528CB8B9C3D0C8AC, 0x1360E148485179F9, 0xA808CB539B7C430E, 
-0x140C52ACB8EC0F1B, 0x7A4170B7B303AFCD, 0xF93F482A0E0F1874, 0x2DE50BE9C8434580, 
-0xCBD35D02095751C6, 0x1EE9DEC726F889A2, 0x6D60E7E2A0C8F372, 0x420360DD9A4B, 
-0xEBF223A3B2C949C2, 0x395AA9A1E6D33F88, 0x2718CF689AAD1AD, 0xE543E3836800D930, 
-0x45F2E8D63CD8F1A, 0xA4D6554B96BCA438, 0xF525120C27876700, 0x87163D6959AF1A26, 
-0x660845CA1A6ED30, 0x8C7C81BADE7954E7, 0xFE2D1FCDEB1BCB8C, 0xA54B8C551C5, 
-0xFDE75DEA1C274793, 0x59D14E78EDDFB835, 0x6309842E76D249E3, 0xB7F6058C83D3E1C7, 
-0x83CA9BF56385E6CB, 0x6AACC200E791FB4C, 0x3969E01AF573A853, 0xE1C1336F41156E47, 
-0xACE897F9CCCFBE6C, 0x8CDE035B1E6AD4E1, 0x66F70DF27160B6CC, 0x3F40A3EC3072, 
-0xBE64B98C8578B709, 0x75DFBFADF367E67C, 0xCCED3A5C40EB427D, 0xB621652547904129, 
-0x40CFA76FA21E6357, 0x9F5782344EE8CE6F, 0x268123E83CA3FDC5, 0x886E18D6B7002CE1, 
-0xC7B21E3674F4B41D, 0x81C085E17D3F6AD6, 0xBA53292A7ED8A97A, 0x95DF2DBE19D, 
-0xF557097A8C812C25, 0x2C45A768BC66A936, 0x446C5C81D84AD7EE, 0xA33BB4C29657BB9, 
-0x28B1A2FEADF8323A, 0x200C6643B145E1A4, 0x60962635492E5E7D, 0x92BD3C49D841E365, 
-0x77DAB0CA193C2A6A, 0x2915D009CA130456, 0x6F57D4CE9BF10447, 0x303C47ADC7AE, 
-0xBFB8E866B2450285, 0xC1E245A2F3B2DA7A, 0x1D7042248B0C4B90, 0x7550CD98A5B01C7C, 
-0x74EE8E5567F56481, 0x17432E5554B16418, 0x8A293A403944C72C, 0x66A8B806596DD155, 
-0xE3D39A12F66C029F, 0x1DB16E1227118453, 0x7D570903DFC2F597, 0x8F30DCD8BA, 
-0x88AD03F3E5E0A2E8, 0x359BB9C87130DECC, 0x85C633331112BD5E, 0xFB3478699A6376E7, 
-0xF97BED5C0A131D2D, 0x8118B550E2E5E6D4, 0x24C0F9F1D0902E02, 0xF103DAF7AD45536B, 
-0xE63FEC887B8AF4EA, 0x2686C81BC68BCCBD, 0xBA3F8DC17BB40BF9, 0x2C452E75B6A0, 
-0x4AADED21B17B6296, 0x61B2B3E3897637FE, 0xEF661EFA5BCE6033, 0xB067C2A62E8A63D, 
-0xCB5A6CB84372CEB0, 0x161546CF9E4EB891, 0xBCDF448C9E9DB938, 0x40A455A63F384D85, 
-0x3E27CDE2573AEFC1, 0x14FFCE25E87B2731, 0x762876350B5400EB, 0x1EA261526CE, 
-0x29DA0472217C7015, 0x669BE627CA08C8DE, 0xE286A64FB7C98065, 0x4B621C6EFCC309CD, 
-0x77D931B84648791D, 0xAA4B0233E8B60142, 0x61B12ABAECB3F58B, 0xC82731651558A8EC, 
-0xD41172360976CAAA, 0xFD321752D25C8635, 0x5F1E5C578799F924, 0x5B760B68A0B8, 
-0x73E88B03635E42B, 0x3F155D09694BD02F, 0x7BB138BFC03918D2, 0x89CD9F8C9C19B8CB, 
-0xC8275EFF1075BD38, 0xB3D4412176014DB8, 0x5F2D453CF0BF3534, 0x6338F6CD9F043333, 
-0x217DB6AA1C8220E5, 0x228B3C3B4555C74C, 0xE4325A8A2F6C9720, 0x5A058EBA6D01, 
-0xB5F19C1BD047868, 0x9A3F61107C57575E, 0xF5DF702056BD8317, 0x433ED5DF70DA79B7, 
-0x1AEE7D6891A9DE62, 0x372DA045B94CE0F9, 0xC9F8EB66CDCAD30E, 0x5282D22EDB92399E, 
-0x2D9886AB2119E280, 0xC41C4D5EA346485E, 0xB03EE89A0613DB41, 0x12B0FD342C2, 
-0x3DC9AC556F57F2FE, 0xF9036EBE8C54EBD, 0x7C9A8052062F0BD7, 0x60810B8CCC642EDD, 
-0x4D01FD0AFF457E9E, 0x9A8234B7409D276B, 0xDBA671D6668D6BE7, 0x5CD71C5B57326622, 
-0xA6CFC6A69C84578C, 0x6691ABC231C40783, 0x8B5A8EE0B0B14373, 0x5B1BA463C09A, 
-0x60FD80F322126FB7, 0x8DEBF6C1E93D3C35, 0x2661673799A30FAC, 0xC85EE2ED62D8FC84, 
-0x90C4FD3A7B6E3C01, 0x20D14022E05E612, 0x65393EFC3AD6B6A9, 0xDB907219FF297838, 
-0xAB678A98BEC5F54A, 0x2D3E1C40E31C2F48, 0xEE6366CFA648BBE5, 0x4561F236A5D7, 
-0xFD048D127ED371C, 0x192527CB3418B94C, 0x1817B79AE546CBB5, 0x6A67D7132FC17C90, 
-0x6E9A4E73C03075D5, 0x35CBDAB850FC8B4C, 0xFC13EF726AC404EA, 0x4ADC6CE82A8B7AF9, 
-0x9DA664DEF6211489, 0x1C88E139A3EC5F93, 0x8EEB19C4544976E3, 0x5652AFD412E9, 
-0x91AAA603FEFAF564, 0x7F3E1C53DE268E52, 0x2A55DBC5B4702A5E, 0x68DE2BDDC1E3228D, 
-0xCA96E19213B28660, 0x83E31A21757AD0EB, 0x5EE587C67E359087, 0x1DD16CFDF57BF57, 
-0x1FB3665678A5CCFA, 0xBB62A1EB145D388F, 0x200A1CD55073D932, 0x1B1E20522B4, 
-0xCF00499286CDFF3A, 0x52CA3D5AD5CF1569, 0x514F85F2809EDC3C, 0x3C9630C8831AD299, 
-0x124D63E913867125, 0x527EAB729635C3F5, 0x91441E130C79FE46, 0x86EBBC4935231090, 
-0x54061DE4CB08A7B7, 0xF26291458600EE55, 0xE6745BA2D1C1E88, 0x3B7757371B1B, 
-0x8E8C1075D72986AE, 0xD1BC7D83B4471D4F, 0x922BC9FADFCEAA35, 0xF81FD071EAF1C156, 
-0x28FF8D272F1CE72A, 0x50BC235116760AEA, 0x143B00310174C3FF, 0x28BB3F7E02C2A06C, 
-0x49822244F820313E, 0xE70F24A7339636AD, 0xE7EF21CDC9D3E0B8, 0x1079180686CB, 
-0xE18867327A5E41D0, 0x86A6A31419F51563, 0x79FC10E3EE70491F, 0x6E6B04D662D38865, 
-0x259F4132877128B8, 0xA25D0FFDA5D7334B, 0xCB45704C0FFF2E38, 0xB3F136711F87388F, 
-0x5E60EC32CE547F4E, 0xCD34E1D3F953241F, 0x3AB0195B86FDEAA7, 0x23B09EB21B37, 
-0x209E7DB5DA7DB661, 0xE197D6B780F6234A, 0xF25DF3E8636EEAD9, 0xE0028E623A464AE0, 
-0xC6126F340B490762, 0xA7494165BD03D792, 0x6618F9BAC8D68AAC, 0x68D5281B59BEA487, 
-0x994D8DDFCFC9C4E5, 0x8BDCC2B17CCCC25A, 0xB10668999EB79999, 0x466CD21B0330, 
-0x964650AE304C3D39, 0xDE80D6A3BC33D1FD, 0x246FE6612379F3DD, 0xC2028B6CC592242, 
-0xD87194FC6AF431EA, 0x31163447004D5418, 0x56BD946A668E46A6, 0x3438EBF2B8DF177A, 
-0x474651B1399F63D8, 0x364350FC10726F74, 0xFCDF68DE2E2B2AC, 0x2DEFECAC70A2, 
-0x9E9B8C86A24C9FE8, 0xF2EF3C8F05115E98, 0x7E13015FA4CDF8A9, 0x57E1E6E818132EAC, 
-0xA31DF522A03CA055, 0x1DCDFD4B679DBF67, 0x7A3BF06DA5FCF761, 0x20E716090F07DDBC, 
-0xA0D4571A9B9F7B4C, 0x59F950790A2AD3B4, 0xE5603EE00EA6B15, 0x39693B982952, 
-0x4DC33790F422AFA0, 0xAF547C6D6E498F2F, 0x38163DCC7181D743, 0x9327086D773433CE, 
-0x545501357D6BB752, 0x163C06655240ABA2, 0xCAA315A7493B583A, 0x6840E067E9BE047B, 
-0x5EA7A02B5A9F3FAA, 0x9A49490D994E33CE, 0xD03CBD9667AAA38C, 0x5CA646729534, 
-0x41142928295CDC3B, 0xC8864AA643AFF43C, 0x4129193F2CF10FA3, 0xDE1F1BBE9ACD5CC0, 
-0x7D12B127DDA9920D, 0xCC189425CB1A027B, 0x68BE17F018520DCE, 0xA573E0A78303EBDE, 
-0xDFA921A41B4C1941, 0x7EC8CA45635C59D2, 0x1F0A36FABF193650, 0x26190F93B13F, 
-0x2B83E966977C6EB, 0xFFD44C3FE17D81DC, 0x9236A5B6F44B160B, 0xA991D74D1039B41C, 
-0xE6CCD07CE3D7ED1D, 0x862A2BEC135C0891, 0xB2FC60007CEA85A6, 0x2E34743AF81433A6, 
-0xB0FAF195B7663C08, 0x2421EC34F9CFBE02, 0xF3018E31B2FD4B65, 0x6ACECCE7D858, 
-0xFA7CD4ABCE02D373, 0x8FCD4E1519E6276F, 0x84C2FE07AFA1F1EF, 0x6D28A892A3778D2D, 
-0x890B26ED03AF60D6, 0xDE6A84D971A13602, 0xF4D65965CFE4218A, 0x7FDD96F0D3995E73, 
-0xD803B8455CF52CC5, 0xB9D1E655566275F2, 0xD35CEE2BAD9BE4F, 0x5AAF982B24F, 
-0x306E6ED5472419F1, 0xDD8859F5964A43EE, 0x28D6EA99F07FC9CF, 0xE51BFD1B9BAE9203, 
-0x88601696FBC6F234, 0xA19679E61162D963, 0x4408D2A9C22FD74B, 0x6095F765E1A74124, 
-0xDA4592832C62A71D, 0xA46825C040421E38, 0x81A6D52113F3F2FD, 0x34BBE2B6771C, 
-0x8A4E73D212E7A1DC, 0x848B67938B22540, 0x23D355DCFF3AE75A, 0x33CAB358E1A09BD4, 
-0x1F4B6987C2041EB4, 0xF4DE74CAD769933E, 0x49F28D8D81B58492, 0xA8C96BA0183BE262, 
-0xEAA23926B646D22A, 0x9D59AC21175D2C40, 0x29DD1077C8BB5E9E, 0x35981FA98640, 
-0x78E62FB5333321B8, 0x1F801796C26C806, 0x4810D4182DDA7EE, 0x89426979CF967514, 
-0x361297B7B97E4908, 0xE310E3F3AC968D9F, 0xBBAF6F6003983FB, 0x1D892CF447E05CDE, 
-0x98D981F4531680C7, 0x9FD5E10B341EE8A5, 0x13645705F9E6360B, 0x69E026B5D1A7, 
-0x2E52A314DFEEAD53, 0x34835EEBE657CB9A, 0x3042E1C5D0F7BA39, 0xD1AAD764C0980637, 
-0xCEC227FD0C6F5E3E, 0x2C16D1CA8EBB6DD7, 0x6CB0A646670D5572, 0x95B5853F0191AAE8, 
-0x8E5E5428A3A9586B, 0x564F63BBF775E1BA, 0xE3BD39EC850D5834, 0x69342FBEDDD4, 
-0xDD340A27B70C4B05, 0x9F14692E4E4A3136, 0x84BEF83D446DE5AE, 0x3094F012ACA26715, 
-0xB2D0D2F46FB3C45F, 0x3276807F844450AF, 0x50EA523BCEB76599, 0xABFFF522D153C063, 
-0x514416773565A84, 0xF6E422DA17F50B29, 0xBC817E3C3E3EC23C, 0x21F67734F8E7, 
-0xC0F6DCD0CF07278B, 0xC91032848A4786E0, 0xFC2C0E5E0C2A7185, 0x939A78A35D8CBDC2, 
-0xA74A1A1DBFAEE71A, 0x86C20FE7CE719B84, 0x503D7A48A0B86183, 0x4B103CA91FDC8B0F, 
-0xB5706471F79C9AA4, 0xF30C7875B6B4A7AA, 0x60B7423F5B2CF90A, 0x58C4CCBF61B8, 
-0x345687955B493E97, 0xEBD6D279EF66036A, 0x9A839E1D040984DE, 0xF9C030CA6BDA70F4, 
-0x7445E4BDFE174EF, 0x7DAD28A54231C407, 0x8AE1C121F34E963B, 0x949F42F0782B9699, 
-0x3793E302B8955EC9, 0x39CDB10ED4C2132F, 0xFCD06F6BF79B0272, 0x58320CBC96E1, 
-0x9BB3F8F52803DCD8, 0xECD5FC9125A5ECF3, 0x76D1724B7D57A9C0, 0xCA309AB42F9C2719, 
-0x43A796AA78ECC726, 0x5510B52EFBEE000C, 0x20DDF72B819B31AB, 0x83A604A3EE05628A, 
-0x29ADD3F7C5EB37D4, 0x2554435FA7254030, 0xF68EF3F7BCD26D19, 0x1F1C7339B59A, 
-0xE33CCF49A6870E7B, 0x666DBA8EF0AF89CA, 0x7220030D1BE353F2, 0xD523E68786B841E, 
-0x356A35C38802D9F9, 0x7838519BE273B350, 0xDD979C8D2D6B5641, 0xA7FF84451C868FA2, 
-0x9888C1D5024C29B4, 0xE21DCA270DABC400, 0x41643C77EE439649, 0x270ECB2F9C64, 
-0x8A4BED0E10373384, 0xC4003611296A9D24, 0xAE0781605C4710C4, 0x9B454C1E33B5FBDB, 
-0x802EC9FA051268E3, 0x7964EAAE4B5C2B9, 0xC3056E61FE37D7EC, 0xAB2467D071312FD0, 
-0x90761AB2D743CD1C, 0xBDC5E04465CAD9E2, 0x84B6915E1C2B2A3B, 0x1A04176CCC35, 
-0xB5D6C2840115C10, 0x9DEB89156954F456, 0x9675D6C52D46CB37, 0x376D411ECB2200FB, 
-0x4BD7EFC9533B84C3, 0x633FB616AC78BEA0, 0xE39AA0F85C7AEC33, 0x7B4CE839864AEEFA, 
-0x84C2CDA558E9A02B, 0xC248E550F4717A5F, 0x5AFBB5A11038C105, 0x561973138E86, 
-0xB697B668372643A7, 0xF95D38DC6A52FD2A, 0x9124F215D2C305BA, 0x2F565050648FF73B, 
-0x9A908C382D87DE95, 0x3C88A5AE05EEC962, 0x8AB893F91C361BD4, 0x4E67251C4DB56411, 
-0xBA3524F6C190CF97, 0x77D4D58E97E3BEB9, 0x6D1D8D505B6BA544, 0x5F9C286F829E, 
-0x167A57D866930829, 0x2AC531D2F131AA76, 0xFDFA74D468B0315F, 0xF856D6E089E66B91, 
-0x633BA4420259C18, 0xCA1658BFF041ED99, 0x6F939DD2858FB2BA, 0xBB7E329877E5B0AF, 
-0x14B7A28C91E7C426, 0xBAFCFD6C28F81A2D, 0x856B22985847A682, 0x6C6461312845, 
-0xFFC76015991FB6F6, 0xF8A452D688F95175, 0x93DC14430D628892, 0x93BEE6349FBF193A, 
-0x444198B24921963A, 0x7E1F69661D3C658, 0x474F888BD9EB035E, 0x233E5A9685796F86, 
-0xE0B7F3EA0ED8976D, 0xD0DCCF041FCAD644, 0xA62C631A986C44D0, 0x5ED82032CF36, 
-0xD7DE99B906E1F070, 0x37FCB6C3127FAB3F, 0xD71E4FD9800E66BA, 0xBFC788D858897AD0, 
-0x431969C3D9DF3216, 0x5141AC67C136BB8A, 0xF1F9B66442D72E12, 0x41D726F2EA6C0B63, 
-0x4FB75DAA0475F2F0, 0x36479DCBC1086140, 0x86A7C1CE20DBC628, 0x134D217B570E, 
-0xF33C1675E5D66C68, 0xF6A9211D1EAE7F73, 0x442F6CBB082A7546, 0x9663050863A20E35, 
-0xBA832464A4C94FC0, 0x4562AD94D828EA51, 0xF64DA4F4636A4BFC, 0xEE85BC28117F63E4, 
-0x62A8C948BBDFBC03, 0xB053F7B82D0282E9, 0xDDEECEE6F01E108D, 0x6E2605D983E2, 
-0x35D54942FF98362, 0x741FC6EE38058E07, 0x1ABE6B370082CD2F, 0xC9A7EB71069085CB, 
-0x4E785B609A82CDA2, 0x972FB523C73D5292, 0x278BED86A6EF55FA, 0xA4AB6F681290C653, 
-0x912D754D263E862D, 0xC7EC894306977212, 0x78BB5B6CF60CDB5A, 0x4BF9F7B9F49, 
-0x5D013F2D4132A32, 0x871C30ECE118E3B2, 0xC725459966BCE0A3, 0xBF6C6EB9E2B6172E, 
-0x6C102F5B52A09C9, 0x2139765C66211042, 0xB9309C61596D20F5, 0x4D9C8763A3F65595, 
-0x75291BD5C2C12A54, 0xDF7DDFBA548D281B, 0xC21E31F9AD7503B1, 0x456DEA72992F, 
-0x90FEE882DBB34FA7, 0x6CFA560895D74D96, 0x9C652047D837D8E8, 0x2C05643A0F292C08, 
-0x9F66A1F7BB0958DE, 0xF4CA90B8C87C5E3D, 0xEE9B2C634EA2077D, 0x4CA4F01931766621, 
-0x17E865A55C0EF58C, 0xCB1649E521650644, 0x1DE04FBE3A8E3047, 0x45D2F84AFCFC, 
-0x8BEB1A69D2B613, 0x7F436381F5B327F0, 0x8790D979D7890873, 0xF002026ACB7F5E9E, 
-0xB67355231E8C77E9, 0x5B359CA511B9576D, 0xDFED7407464B2334, 0x8003BFE0E7AB0673, 
-0x5E0BCBFAC357787C, 0x47908E38663EEA8C, 0x45D627BAE2D584F6, 0x36EC780F402C, 
-0x23AE05B815703408, 0xE0D018F2A318BF47, 0x7414D598EAAFB7AA, 0xD0389B46E13F721C, 
-0x7E886CE9FAB3709B, 0x18ED55AC1FCB1F2A, 0x4D34A16418201B21, 0x8AB47F444FCF9C56, 
-0xD04B3584D2E129B8, 0xFC837E89351C8D89, 0x53E4AE891018870C, 0x6A2891B57D2B, 
-0xCDBCBC8C19935B5A, 0xC163C4CA264A567E, 0x314C60EB5D408321, 0xE13E79CC43DA6855, 
-0xF5BF570C28EDA478, 0x2B6B43FFCBA847C, 0xC22E2799573241A9, 0xD3DBDD2B2A0844E8, 
-0x4F0F2EC2D664B2C3, 0xE6753C47A9C22A59, 0x5402856C8BA1C233, 0xAFC9E8351DC, 
-0xF9E7F0074D18DC4F, 0x87597B136DC89996, 0xAA97770948A0F3BB, 0xB8CD2279861BADFE, 
-0x51E2C590C2622E47, 0xDB27E7A8A1DE1C74, 0xD255BB5550CBFF42, 0x65F9F70C2E7D91CC, 
-0x2131CC2ACBB07595, 0x9ED244F053C423AE, 0xE59F20163CB2B772, 0xB1DEB2AEE96, 
-0x2D7A68BB176EC187, 0x518D4CC2AB819C23, 0x25D201220A210286, 0x519BD50AEA487A79, 
-0xCAA50794DCF09CF3, 0xB892A338C876B99B, 0x529A2BAAEBDC0274, 0x37DF4540C1A6A5D8, 
-0x85CA6857EC8B573C, 0xD0EF053B22EBD8DC, 0xC18FA596371C8B3D, 0x13825AA0382C, 
-0x28111AB3D3725ADB, 0x628F278ED6258BE6, 0xBDC05E534777984E, 0x7E768F44B9222211, 
-0x19AA80E796AFA4AE, 0x916CD81ACDFA5624, 0x15F45BEE8FBDFEA4, 0xA4E6FD89D61E8EEC, 
-0x7D6516EC99146810, 0xDF8512CF905957B0, 0xD85D94B158FFE97C, 0x46D23E263139, 
-0x82BF2C772FD1711, 0xF6E6BEA61D651A4E, 0xD0F36FDC17CEC863, 0x19E9D37D216BAC8B, 
-0xE18C2585E81355F5, 0x43812D0DC9F7D664, 0xE47800DED322CDD2, 0x5D70A433D29AF2A6, 
-0x56F6E4DE6BAAD4C8, 0xBA94019630F93A0F, 0x8BBA63A7EB6218C3, 0x1D4F0B5E9FE0, 
-0xF8E1BA352922D154, 0x8A9D11171CEFD81E, 0x5913CE50D8F03810, 0x9842C2B973C376C0, 
-0x93C7D2BBBC9498CF, 0x2D80A2D8D2F5EA15, 0x43A64CF4E007AEA6, 0x6EF44A61F1E6E8C5, 
-0x4A835E9F96407513, 0x435C53F5E3D17313, 0x1428BD39B04571E3, 0x4F2BF5D7E5B7, 
-0xBFBEB5174EEE202F, 0xAF4C3F7BD2733C96, 0xFA62C1FF70401306, 0x732741BF5110EE3D, 
-0x4A86EDA691C6BF84, 0x859256BB74DA4C6C, 0xDD34B520122FD906, 0x965D3D48569E7A9B, 
-0x6999F0FBB24C898F, 0x2B02F28886443222, 0x15B21BB73C573E0A, 0x3389E8531602, 
-0xE3D43A6E771EF0AE, 0x9ADA1010F9960F32, 0x7ABD7CF0E652DC67, 0x84FAE9712663D64C, 
-0x4190A52FD93388A6, 0xDF5CCB466D579803, 0x13FDDDFB80C160F6, 0x9AEFBD451F7F2480, 
-0xF4C67E2AF6C90E8F, 0xE4A6EAFA452F0087, 0x1D671F21045CED94, 0x2C2542A04468, 
-0xAF714655744E7C0, 0xBF09E4E192F46FFD, 0xBE4B439CFC1F5E0D, 0xDC7F3E25A530AF11, 
-0x65DA5DAF59062416, 0xFF7468C48FC35862, 0xCC9EB3AE68D4FE71, 0x82402984C6D2C47D, 
-0x3C6F2F6C1762B765, 0xA6567959C5530A43, 0xFB5844573A199514, 0x24D2AB3D4BC4, 
-0x386927B998182BE6, 0x9CCA0E2354E0C222, 0xB633710F131C4064, 0x68171AFB9EA02767, 
-0xBD1A85402E575808, 0xD684470BA061BE89, 0x80A9B1EDC6FAC35C, 0x7FEC47594D1C4456, 
-0xE331C42B319C0653, 0xD646FD665CEF0DAC, 0x35C6F7E4791467B7, 0x10B676AAB62, 
-0x68A3FD0C8379A2C6, 0x16155F04C0FB3900, 0xE2E9B0BFAA2CD444, 0xF03F8CF53D6FBD2, 
-0xD95C078C765FF4C2, 0x529BEE072845E6F4, 0x2BC5FE7677938232, 0x54D20A6C234FA6B8, 
-0x26FC3AC49B012FA3, 0x1E7E7708EA853417, 0x50D9E26647DDF9ED, 0x12E3E846796D, 
-0xFE15FD776E15DF21, 0xFA4054867E968EAE, 0x7F1D11E8E517B2B1, 0x8DCEFA40479DFF3D, 
-0x4B88602AC1EA9A2, 0xF24E72679B952449, 0x51485AA34ECC6A70, 0x4EAA6CB8D2130C9, 
-0xCEAF6FFA5493CED3, 0xBE0D8887380DACBD, 0x3F21992D1F89B84C, 0x1BC377B2427, 
-0xCDCC7BD1D4EDDE7D, 0x235660CCC99871F4, 0xF4543749F14788F8, 0x8CB83D97B69A74DC, 
-0xFAA1DAD807C88B16, 0x3D68EF59C6ACD329, 0x87855E7832E3DFAB, 0x184CF4B5C2228975, 
-0x160BF8989FB84FEE, 0x935E3397C669CAE3, 0xE9A7F2B4970683BA, 0x3174D2F7B511, 
-0x6A48DB4C4C8454DD, 0xE75A68AE8FB9948E, 0x48D0AE970F10D20D, 0xE1605B21C77AB71A, 
-0x22CFDCFFC02A95C8, 0x87120B9E7A82D8D4, 0x181A2E70E642CB9F, 0xF2BF400BED97EB33, 
-0xA5AD639BAB08B908, 0x1A88BA9055C463B1, 0x9FAC5D79CB04EAF7, 0x4F7DBAB2FD58, 
-0x81F92ED1B74CC4BF, 0xB4165F0891DC5FF1, 0x8AED1DFA3BFA7770, 0x72507611F9C3AB26, 
-0xB45C6C95E4A7A29D, 0xE7E301F2F69A4233, 0xB53EF31FEA305FF3, 0xF87E11D2B4E50A8C, 
-0xA48D0221F643015E, 0xA49D225E20DC379B, 0xEBBDE24EB341D41E, 0x261E18EE4572, 
-0xC3477D76AF61F08A, 0xEA85B5AD0DC92665, 0xAA2B09E43F499CDC, 0x9BC6D275C3BF9D9C, 
-0xC77474242BC18222, 0x5FA3225491E98C4F, 0xFB0DBEE3E7B23ADD, 0x343F5ACD746C61C0, 
-0x3B8FE8D5319199D7, 0xB5C7437A085F93C6, 0x9E1DB099C14ACADF, 0x6BC4F0CBA527, 
-0xFACAF9D76A664A22, 0xA97AFED0185820D4, 0x40F3A6D51809604D, 0x6849BDE75208442D, 
-0x4E9793313A13D9EE, 0x366E1604160C92E0, 0xA784E2CAADA41DA4, 0xBF83D98C596B17EA, 
-0xE2D744CCBF2C9E9D, 0xD484FE434B6D4DBE, 0x56D6D96529091604, 0x675A0F180C9, 
-0x8A433F5661F81F60, 0x4292F555F30E64D5, 0xB4C1D4D88A2FE25B, 0x30915FBF7C4C2E42, 
-0xCEB03271386832B5, 0x64FBB11A4546DA92, 0xBAF631B7BCFFC05D, 0x45687B2D0D3E5025, 
-0x2ECE04C16F203C82, 0x6245066291592A88, 0xD886C19A63853909, 0x46C8F896163C, 
-0x2BDAF48E891A4C91, 0x66A61562DC37025B, 0x837DAD4A7965084, 0x55565F32A85C369F, 
-0x39C246AE4F08567, 0x9830CE9C1D85DE12, 0xA604E17193004F09, 0x8948A2F8DE7E9D70, 
-0x99B2DB0495E43B1E, 0x797D8FAA1A3C2019, 0x519E61EB771500BD, 0x677E74FD47E5, 
-0xF67D6BC438011E80, 0xD68352F6B40E7A72, 0xF7BAAC487E41F828, 0xB6CA70E43A34C118, 
-0xDFE5EE2C16B63050, 0x993A0C211BD0C6B8, 0x4021BA56E3712AF0, 0xC3CAC1939DE1B813, 
-0xE57148D96024A040, 0xDED918E5872A36E4, 0x6E47DF720E579DED, 0x490950E5E453, 
-0x641C7876BFCAECC4, 0xBC017020AD278B6F, 0xF7F9503D1AE13181, 0xED584BD0EFEE6B9, 
-0xB2F4B7A2BD28D43B, 0xD958FB31FF9FB8A2, 0xC1A6A41CDDAE5579, 0xFDA63AB2D4A6067F, 
-0xA11A8A29B404EDB3, 0xE306AAD1DC85ED13, 0xD4101E417EBA534B, 0x626CB9F9FBE1, 
-0x44A5DBA5D80D7EF9, 0x862DC4141BC1BC4E, 0xC52C1559D7A17A51, 0x4E027CA54C1659E1, 
-0x1B161326F4A46194, 0xB30D2BEECA47797C, 0x5CA3C18EB41C5738, 0xA74DD5499C7757E2, 
-0xB3EE7AD876A23E21, 0xC8EF5456E29EF594, 0x69BF83854D6242E6, 0x4CDE35F5EDF5, 
-0xA83B69C70C6D2548, 0x5F810C176B04F0D8, 0x10973853307AA19E, 0x8C3A94ADD9DBF546, 
-0xD8F4227AC5286F45, 0x2C72E4CF9CCFA9DB, 0xB8AE4CD91EC8E88A, 0x2B6450AC52DB65B3, 
-0x58CDD9444999F1D, 0x5FB83C313589E3CA, 0xA0F34EA3442C150F, 0x1A66C244C950, 
-0xA88E7A482CF77158, 0x9A8752C3BBD7268D, 0x5DF2309237EE0820, 0xE3589F2EDFB0B5F0, 
-0x3AA5A6732C694375, 0xC82A8B77290D5859, 0x78FA82E453604E5C, 0xDEC5BEEC4D5D8BCC, 
-0xC35D084751F0FBD, 0x2549A2620A43A02F, 0xA1A55202D40133B4, 0x6941B7936A8D, 
-0x853AB53960659057, 0x5BBF380C70363DDB, 0xA7E3CD91CEE69518, 0x769DF6C6B910882F, 
-0xB4DF7574B0830E07, 0x13EB6CE81B405060, 0x3BF971776993BE8C, 0xEA0B89E22122BCB8, 
-0xD1562D5FB0102DEF, 0xBAFBF2C41841394, 0xD7E4813C03965CB6, 0x416646EF2B93, 
-0xC57F3B0116D2DA58, 0x5FCAE631B2144E53, 0x5C880B9270DA5AF6, 0xAFDD6AA88D0809BF, 
-0x69E462EBD6163822, 0xA5F80C90CDC903CB, 0xDCBF64FF64E914A1, 0x4446C98F9B28FD31, 
-0x43D34A4286EBEDF4, 0xBE6E0362CD55D94D, 0x7C1DCCE6314F593A, 0x6B36B61159F5, 
-0x1119772B853F19D, 0x31DA79F14D29FCB, 0xF9DA9E1760CCF15B, 0x230B1C6535A25330, 
-0xA2B34277EBA15D08, 0xEB5D5773690BC5F2, 0x9C5487F7B153D2FB, 0xE307FABB09F51CBF, 
-0x5EC7F1D1439A4325, 0x4BA39AC8E0536DDE, 0x56737D0B9D1B878F, 0x285510454848, 
-0xDB890B674BED1361, 0x104239F7D5E4FB62, 0x377EFED34237AEDD, 0xE00DBF726BC0D563, 
-0x15B8A15D45248521, 0x396ECB8C8754B3E2, 0x3370C3A72718D1CB, 0x5E28F33F8275C25A, 
-0xDD4775D5A1C58912, 0x3275A2DDAE16EDF1, 0xA4445F2E8F5AB1F0, 0x1FC35C57037E, 
-0xD3B8A9A33C76EA7F, 0xD4D0ED69ECD3C08F, 0x3E60F95CDFB1F739, 0xB9E7DF674D7628BD, 
-0xA32DE4ABB22FB64E, 0xD518E6F3FBFD572B, 0x72121C652E7CC05B, 0x413D123B14AC6420, 
-0x87F1E909BC1CD33, 0x44ED12FA68635392, 0x7DD4778600E36F17, 0x3B4E171EC415, 
-0x3DC2FB53C65E6A52, 0x2C6D032B6C9AF05C, 0xC258E33EACA06505, 0x7D9BA0DC22E531AF, 
-0x24B0B87D3D55645C, 0xE1DADA5F4865CFD5, 0x94ED6D0B5961B52D, 0xB3B61E7ADBD87573, 
-0x525210A5DFFF8492, 0x7E141C69A8EB4B3, 0x4C3FB0D37447A34B, 0x6D925F58F1D8, 
-0xA82E6C003F437038, 0xEAABA32EEBD8B892, 0x7C3F422EB5A29433, 0x2964C70F12942B7A, 
-0x63AB90A43D5B9383, 0x4389B95113C39A07, 0x44CB2F157D78A78E, 0xCE51925885B1B53A, 
-0xC829EF9DC8F9E166, 0xF615FE2A0198C7F1, 0xB1D1E1D7B40B2DA2, 0x5C6509E39F68, 
-0x44ADD1225CDECDE6, 0xDBC9141EAB330A48, 0xBBE0A5AA7418E99D, 0xA3EF6C97485CCA42, 
-0x53D33212D472B469, 0xCF636A2CBFF56CA, 0x45FAF365D5E597CB, 0x808EA484DBCA1F9C, 
-0x318FDF361E5DDA4F, 0x4486A1EEE6EFC844, 0x4264231D1230DE92, 0x5643E12F7BCB, 
-0x8F79C7949E6108AB, 0xF8361A1FB3436647, 0xECACD685FCFE6E38, 0xFD593B233DAED3CF, 
-0x307C7E65ED95FED4, 0xF48C48FC2BD39F15, 0x8952CD2CF8B8E212, 0xE5240090971762BE, 
-0x9DD68197C8F53CB6, 0xCD04184284E416B9, 0xB2A2D03E9A96AA7F, 0x3BF4140C68C1, 
-0x2D708EADAA774B72, 0x2E061246F4B50CA7, 0xDECCCB46C42B7CBB, 0xF7D61BC15CD030EB, 
-0xBDD222DC06F2BD3F, 0xE9E3ABB3823A66E0, 0x3DF8FB8E07B45A98, 0x2F7D0F8F24771268, 
-0x532D83AC18F65FFE, 0x7F4D94D0F69A55B9, 0x717A6407F7C274B6, 0x1452336B5D87, 
-0xBE954446226CE3D4, 0xB10C0AB0BF807CA3, 0xDFEF434F13EC4FE6, 0x8211D09A85F604BC, 
-0x823FB8010AAA5CC8, 0xB953A862C8DC36B7, 0xCBF7BE1C28803216, 0xB6737CD1C851F70A, 
-0xE04A3D805D4E862D, 0x77089D43668BDA27, 0x7FFEDC5ECDDB572F, 0x6EA4B0FE6CD5, 
-0xBB415AA7517396C6, 0xC0F55847D19031DB, 0x7995D5B555A5EF30, 0xA4C027ABD4F74807, 
-0x6DCC873939B48337, 0x1BFDA61751737D0E, 0x1BE12BACD6D4589C, 0xD33BDAA8378BBC46, 
-0xA16E310470E7A940, 0x67BC1AED8CF0160, 0xD4A102AE6C59F3CC, 0x658957EE0480, 
-0xEA11DE7CDAD5D770, 0x9B967321FA920BD3, 0x2B106C508EA7C109, 0x43D695651C193124, 
-0x9FCBC541D622209F, 0xBCC4C42F31B17F8D, 0x15AB7075C019F7D5, 0x530AAF428C9CF300, 
-0xB1DAFB74FFDE20A1, 0x48F15E63CD0345EB, 0xD5E680A761F5AFC2, 0x365FFE425CDF, 
-0x67E9CF36075AFE2B, 0x26CFF3DD1161607C, 0x9903FC3A82547CA8, 0x86580FD92816F2B8, 
-0xDFFA3307BAD9E1B2, 0x922A541D3587335D, 0xE3DDB2AFD8E50A0B, 0xB6A609B5D78854EC, 
-0xEA5B414B5EEDD613, 0xC9ED0149C4B6E2EC, 0x29BEE31FF8FE589B, 0x5469450DE18A, 
-0x108A179FDDC434DB, 0x148D72D4F6F60DCB, 0xF9D50C8880A3E30, 0xE98E3C15C3AF03DC, 
-0x69BCABA7257389D3, 0xA649967C8CFDDF6F, 0x8DD36D686BA71F9D, 0xBCE7A448AF3EC82E, 
-0xCE63E5C42C375413, 0x5863F6D9D0110E9E, 0x84D1B9F0A0CA3258, 0x46E7C10D1C98, 
-0xAC893128B0DDD240, 0x2F8F0F948F50587B, 0xE5FE0BEBC57B05F9, 0xA1A97CA847127080, 
-0xCA67FF91DA89F6AE, 0x8B1C179C9D307B7F, 0x484A1E65D25AAF81, 0xC6E0E8B7D396034D, 
-0xB624DB35E88C8BB5, 0xB82B18E76429D94D, 0x7C4814BDE080E6E, 0x462C478493CD, 
-0xFC24AFB0411D7C71, 0x13AC468878C6DC9A, 0xC39A13B11FED43A7, 0x2D0FB186E67F94D0, 
-0xC1F5DFC00CBC6AAF, 0x65685AC0F33B72A2, 0x4314BC745495D92A, 0xC3017F5A04CB0D0B, 
-0xCB9A3E8F5732C394, 0xD0DA699D22F2338F, 0x9083A1DFF5381B5B, 0x453D0DDB2F93, 
-0xE90A16D427C7F989, 0xC69B70BE90E196E3, 0x6BFEF10771445260, 0x3E3BCF9EE0E1883, 
-0x1505F173C0982B5, 0x38FC4D30781C8EB0, 0xEF8C53B25B913AF9, 0x45B196FCA0B465D5, 
-0x2ED56E66F19CE4F8, 0x603ABBE6D766EF52, 0x7F7CCAB444070BA3, 0x6E14812D70DD, 
-0x4A7832BD96A0D79C, 0x9FF2AA8FD9131DA, 0xD1EFF16359E3C057, 0x2AB1499B077D7F01, 
-0x411A5494C4CF5170, 0x34A230E0F1C78B6D, 0x6394E60FD5C10ECF, 0xC008AC5CFEBB69F5, 
-0xAF8180139A021B9C, 0x1A920B66F42053E4, 0x4A5C28EF48F6D4E5, 0x2B23FD419AC5, 
-0xDCBA97D54A32298, 0xFB4AF4A26A2DF2C7, 0xB2132FA139D70CCC, 0x4AB460DB7EE41314, 
-0x296C712AAC0D40AB, 0xCC5C409C26B901BA, 0x613C47CAB203C688, 0xBEC491E2B5CCC093, 
-0xD741683E3426CB3F, 0xABA3E027C84AFEC4, 0xA6E15511761A3F14, 0x51DC5A6EAD13, 
-0x547FACD5517A1C77, 0x7981D271E5E624C5, 0x86A3D777C1A113B4, 0xE33636E63DC51ADD, 
-0xEF67883B8178BBCF, 0xC4527D9E48D1ACF3, 0x9D040F5234849DFE, 0xF17053A33289CC50, 
-0xE5C27BA7D935E458, 0xF6FA64D8EFFB78C7, 0xCE3423FD2BA69512, 0x1408CE766B35, 
-0x3C463609BFC6E35F, 0xDC904DADF194F7F0, 0x5B846286300A8EF2, 0x6DA44322948B91C6, 
-0x48AEA631C187552C, 0x545B111775E7140, 0x5D4A1DA3B722A5F1, 0xF16CB87E143F1553, 
-0x91B8B56A4B96BA5A, 0xFC40575A78F4AEEE, 0x8A6F0227F7606F0F, 0x19DAD69C2904, 
-0xA54954664EF1BA09, 0xA2269F34BB95ED13, 0x402AB1145895A845, 0x9E0FF96C11107F52, 
-0xAE1AA00682B605CF, 0xC6904ED307B9E02D, 0x707F95B61A8CCC4B, 0x3D1F7E6B2178979F, 
-0xE8E3B10CEE8DDE53, 0x95ADF2C33C8D18D6, 0x1162B40149373B0F, 0x69D71F4593D0, 
-0x6B35ABFD9143FD7D, 0xC3F2E4C1FA1DE03F, 0x178F8531CB2FF7EF, 0xA0D5C3535DA56F7F, 
-0xBC66C615C67036FD, 0xBF29EF7F86B0C623, 0xC1F79D3693C45EAA, 0xC62388C0B58C2385, 
-0x572CC6D737172364, 0x8B980DD6B6E42570, 0xE632C3D644A3A335, 0x2076D312B966, 
-0x874CACE11A7A8A89, 0x1661A019077551A1, 0xB84C18DFEC452B87, 0xAB24FC4C783480EF, 
-0xF7D2B7589B4743DC, 0x171E1EEF9921C497, 0x449D60A8294D3979, 0xD70FD167621958A2, 
-0x5ABA1036ACA67385, 0x620260EB3ADACF94, 0xE1F356CDCCA95F0D, 0x11427FD523DD, 
-0x8EA0A180B98C102B, 0x3BCE63AB65CD76D8, 0x5BD0BA1D893BED2C, 0xD834F6C695CBDA1A, 
-0x55B207515851EF27, 0xF0713498BF90B6A5, 0x2206AEC4B94EE4E6, 0x9DB811C5C21055D9, 
-0x32B60F9F952E9A90, 0xCBBD801F6D66A0ED, 0x27C80B1A2EC06B88, 0x41C510A44DDE, 
-0x6671326CA0E33EB2, 0x6B6720ECBD496D24, 0x5BBD5C14B09A396A, 0x171DB2F438E04BE1, 
-0x80B7367F35E3898C, 0xF1FB266C7580CA8, 0xF5C82CE3C519476D, 0x19040FEE1F092833, 
-0xACD8211519181FA2, 0x357A08743FA8CA36, 0x506A8E01DEF060BD, 0x1D5AA0D44C61, 
-0xCB40DD0EA8566553, 0xC0DD2820D30B1DE, 0x52A32620EA482DB8, 0x80D7A49542DFF826, 
-0x665FA86BC08122E3, 0x6354E70EA934D30E, 0x8F3148678752A86A, 0xA756C5324834DD71, 
-0x85ED44A7B30805F8, 0x9343E28C97F987F4, 0x6D1D8B22D0DFB34A, 0x42121309AD31, 
-0x64919CD7A87BFA3B, 0x7246C170C77368BD, 0x6AB437F2AE046288, 0x7756003D27CAD7DC, 
-0x5A992CAD6688356B, 0xEDA3FBD63538A34C, 0x572103861CB28A2C, 0xA0EC34E3E6F59BB7, 
-0x6054B9A125A91E5A, 0x727204FC32C4A0F2, 0xAE852BDAB298BD07, 0x56C01770AED1, 
-0x423326F596EAC00, 0xB1991183191E5714, 0x9805EC5CDBAE56B6, 0x9B803C3F46642045, 
-0x86BAC0181FBA5C56, 0x62E3D0BF34DE4508, 0x7994E68642405960, 0x7CF706D9BA197FFF, 
-0xDEE727ADC73E3145, 0x5B2AA30B20F8034B, 0x47E440010BB8458C, 0x5610C9124053, 
-0xC955E63355567587, 0x5A72DFB87B48D3C, 0x4CB06B8B0198B171, 0xD56C25369124BA21, 
-0x8F1E38A06CC29FA8, 0xBD71B825D8BFAB02, 0x2D910C0043FE5C13, 0xF5964B9A64BC3B69, 
-0x569F9080C558AD7A, 0xD69519A0522DB50F, 0x43B5AA2F1213376F, 0x227560B7B114, 
-0x2457B4D7E1A63B6F, 0x2FA373FEB5B8F5C2, 0xE9532038C3FB706E, 0x55474D54795E70E2, 
-0xEEACE3D80D6AD8A3, 0xCF80966F843B1F6B, 0x5344D80DA35FCD04, 0x289127BE0179B8C, 
-0x147358C6CF0E3081, 0xA1E7FBA2F073BC1A, 0x32F33A035CC782C9, 0x492715D9F6F3, 
-0xF03C55B625C15675, 0xA8C54AE381EE2907, 0xFB54D6B848AB4580, 0x43D1480E6F6580A9, 
-0xBE9B2063E97C2D26, 0x946DA6958181BE76, 0x24B11AE785C81B9E, 0x479E0327B1D8A546, 
-0x99706C4A5F6BD7CA, 0x569A65D254119420, 0xD2185BF455108DEA, 0x3BDB0274601D, 
-0x83DB1EAF1CBF38A1, 0xD6533DDA465A0309, 0x586577410BE81A7A, 0xB3796B467BF06AAB, 
-0x10E38B7F2189AB30, 0x7826498B74F9D8CD, 0x2751C5C58350F034, 0x22FD1FA204A97FF4, 
-0xADEBD815EBCC507A, 0xF9E865FA6718054C, 0x7A2441869A60C2C6, 0x2C772C885575, 
-0xB57449B2362ED75D, 0x3F6A5D8C9033CA07, 0x529F86383C117ED3, 0xFEFFB96C1AFDC1AA, 
-0x6ACAD556DDB04295, 0x84A9091BB577C7B3, 0xDE473A71286BDF73, 0x4AB30EA7ED867E57, 
-0xC47E00BDF7B425A1, 0x295A3072E100703F, 0xFA78C4CFB12D401B, 0x3B17D78C0316, 
-0xDFC208AB8FC9407F, 0xB1F6A0F023B0EEAF, 0x531057C3B03E5701, 0x85AF605328AC615E, 
-0x9227316D888B4EA9, 0x7E0BB2B248BF72B9, 0x66823AD9A8DF758B, 0x21188340DBEDE95C, 
-0x7F146DB0D7AC12F8, 0x1066CD3875A90B42, 0xA60BFA5B283A34B3, 0x994F655D011, 
-0xB278AD742C164FC7, 0x112A62DCB2AB4259, 0x85C661C3317DFF3D, 0x93170A60E2850BA8, 
-0xD852027CC47FCA9A, 0x2BD4EAAF2DD0ED8, 0x73874FB07EB9AF83, 0x5865B7C8DE42BC38, 
-0xE33B8265281CDB3F, 0x25D80A4B2D660826, 0x5E17DBB5A9CBD8DA, 0x550A56CBF025, 
-0x46B0EB47B03DB46B, 0xB89B64BE4D09C877, 0xD0D87D937F6D6384, 0x4F72F3A3D77D7FE, 
-0x337DAC361C84FE89, 0xB5B88366B642DC5D, 0x2A674EDF610C555, 0xC7225A28381A37B0, 
-0x3135D15D669C517F, 0x5B57798510DB2F, 0x6F592BD8043C198E, 0x133DC729F261, 
-0x43F4FEC69348809B, 0x63C2E6DE5B0C82FD, 0x17B1EE6888AE6BDF, 0xF2E3196BF9F8FBFB, 
-0xB01CC90E63976886, 0xCEA0BD76E63B1B26, 0xC04C02222C8A7BC9, 0x5AC71DCC23886FC0, 
-0x6B92E21A8096D2B, 0x8553EF1EF36AEDF8, 0x2B4AEBBB4028F106, 0x17676BC98491, 
-0xBE3E66F88F42208, 0x48134B125558EB75, 0x75857663679DDC28, 0xA7976D7917967DBC, 
-0x664C102C136FBA1A, 0x9F9E905576F3F2A9, 0x4D39FC80606E9468, 0x601C00ED1E8F4FA5, 
-0xDD4A7ED12F45F520, 0xB8C2C17883A66AFA, 0x490BF4E9B8DC492C, 0x427CD201BCE1, 
-0x675E11CBF9F59263, 0x115FFF19000ACD7, 0x1BFCAE022BA542E0, 0xD178D61E306AB7D6, 
-0xFDBE6D2615833926, 0xFCA6D72D56EB0FA1, 0xC9311C496D3200B9, 0xDA4E5905C9C8F2D, 
-0x4E1C96BCF577F5B, 0xCFD481636F8B4CB1, 0x5FE535FA52EFB7CB, 0x38FEE5EEF0F0, 
-0x90D5A66C389F2EC, 0xA9F2F072D9C59432, 0x312A33D976EED97D, 0x627082DDEDBB3DBF, 
-0x5D0E9500CB1A052, 0x39F194D419BDF730, 0x2F8142A3712BE504, 0x47B20A58E32790E8, 
-0x77C58E36542DAE01, 0x1097E0B53E25BA44, 0x2495BE2856D51459, 0x6BB413B52CC2, 
-0x98AB8F957BA99D7E, 0x25441336C63BAFD7, 0xA101B01C1947EAD4, 0x3B82079797650BC5, 
-0xB32A381D969C0069, 0xA9965971C0C3CF1, 0x4B086CE1E541D8DF, 0xFB57EF729176767C, 
-0x8B2E1EB997AEBDF3, 0x7A11DD95831DEA5D, 0x7DF2A9FA1AD6FD20, 0x17B122BECD27, 
-0x9612D89D62FB0753, 0x99C99952B9939B26, 0x9FF847CFF4001A50, 0x9F6E76D4B52D1B48, 
-0xC2831E7A8616702A, 0xCD01BF6BD125C756, 0x14B681D9C8AE30DF, 0x3372753A194AD4E5, 
-0x91CCDBDE81CE663C, 0xEA5979325FED0CBA, 0x1DD7FE0EFE9F3E8E, 0xD831368FB4, 
-0x150B9035CEB1877D, 0x3487D24D636D97DE, 0x6AF0509B7E64E8E9, 0x53869E67F01D3EEC, 
-0x429722B73669D88A, 0xF0CD95E4EA6170D8, 0xA2CF8A0810A8A395, 0xF518BF8BC141A87, 
-0x8793B5A1D07970C4, 0x121C4A87C2457BE9, 0xAE5AE40989CF27D1, 0xB7D62523268, 
-0x194CF187EFDCDDF4, 0x4EB55A91873A06BB, 0xC6D3E0FFC86572E4, 0x384CD9EE866F2B8A, 
-0x600EED7122FF148, 0x835D8829E641A603, 0x8EABDC4B0D73EEA7, 0x8756ED7B28BB16D3, 
-0x8885D96D9D33B25C, 0xCCBE1DE1F95F86B6, 0x90B18AAA91913977, 0x4846DDDF192C, 
-0x865EB0044B3F8092, 0xDC5865C31ABBF32, 0x5AE9D9705269B7D9, 0x7649229CD1973C6C, 
-0xADFD7C8CE84D8460, 0xB2F66525E5EAB7B4, 0x2BB0BC5B01E22A45, 0x4EE72382449A6BD7, 
-0xEF39A4FF10AB5C1D, 0xF44237C897DFF7F, 0x2E47474E5BDA6370, 0x65575F64F480, 
-0x19ABDD54889995F7, 0x8C0BC21EB1403A59, 0x5AC857E8ADD10C7F, 0x7720F16DEC8B17A3, 
-0x26C921FDF779FEB9, 0xB1145D69CB1FFCD6, 0xD5401269BC67347A, 0x8F22583BDAA8E1D2, 
-0x33ABB3E532986B72, 0xB2E363C4143BAC7E, 0xCEF32C63971EFE2, 0x16E85096AE08, 
-0xCF29D4A416A193DC, 0x3F0E5140ED67BEC6, 0x854083465F20B9FF, 0x1CA4BA30449CAF4B, 
-0xEF29A34EB897FE4, 0x4696A564BB4D110A, 0xD272717C5D24B578, 0x378DABCCD6F82723, 
-0x94FCE8C921FEAA5F, 0x3B792D8DF03FE481, 0x319FEF46B24223FD, 0x67EB2F3F9B1E, 
-0x386AC646FEFA90F8, 0xD8330A7DA792595D, 0x7D2C2322C8EE0259, 0x78C4884820C68987, 
-0x72CC237FAC8AC9A2, 0xBC128532C6AE2674, 0xFC8B435D6C6670F, 0x6D7198483FD6BE62, 
-0xFB15A3B4D4F76FDF, 0xE343E0C3F4072920, 0xD45A3A65F942A66, 0x380EDC480FF1, 
-0xF6F816EDFABE320A, 0x4C010003C7888408, 0x448DB98D6FD15F35, 0x81B76D5FF5D7AD3A, 
-0xBBC36B50725DDD12, 0xD655A0EB0B3B4C13, 0x501C7B2302D5EC96, 0xE2381259F447F1B3, 
-0xA8F5E992451DE0D5, 0xAE6BB6D2770E3CDC, 0x6EB85796F39036C4, 0x5B3F274664A1, 
-0x7F6AA1191F8073E4, 0x6AD7137CC744531, 0xFA5301E34252D95D, 0x500C0707D0785E0A, 
-0x49ED413B68A88F43, 0x2E66503F57A96067, 0x5A783608DCABB489, 0x48BC4D60C8987195, 
-0x130D7B2D63495D62, 0x235F258284362727, 0x85F83F66600C553A, 0x1837C790855E, 
-0x50C0AA858AE9864C, 0x9D9CADC6B2CA9DD5, 0xFC9E51C3A599D3AF, 0xED69ED34EB51B952, 
-0xFD6ED6ADA4BBB501, 0x4C2348F5C985D957, 0xF87B72DB8283253A, 0x4C66F24371D44485, 
-0x854A2BB4ADC7192D, 0x6A715F4C3097FD1D, 0x1925A8992A25F7AD, 0x36014A66CE80, 
-0x60E4BACA7D5A2783, 0xF1D90F6BE4E54D3E, 0x7E0379EC3AB8ADF6, 0x2C57F68D2BA2F550, 
-0x414D06ADCAFB4A1, 0x82974751718A6047, 0xF51E8907E23FB04B, 0xD7A2D3E863606058, 
-0x4DCD03E6D7D9458, 0xC99CFDA1EBE2B0FE, 0x824A096A6A1AD960, 0x6D865925F5C7, 
-0xDF443A318948D99F, 0xDDC098B2F7A01EE1, 0x8E2893AB3AD08E18, 0x56BFE189582C647D, 
-0xD91C0AB112EBB58D, 0xED518C22822CCECE, 0xA34F03AC7028FC91, 0x9799B77ABF3DBC08, 
-0x5DCE2A5D930BD35F, 0x924008BC53FE02E7, 0x9AF43A110ED4A1FE, 0xAFC2B140B50, 
-0x1962291591C179AA, 0xB3D9D44639133CAE, 0xC8F7CED70145B21, 0xA09F465D2B5EC707, 
-0x84B6CAD1073BF730, 0xE534E0C11CCE1CAB, 0xDE2AA0C3BB0B469B, 0xA36C3EF0A1334932, 
-0x9F0F2A3CFCFEAE4A, 0x605B7DC065385EDE, 0x743109B2D49468E1, 0x4CEF47094858, 
-0x8D1E128C06D0BBD1, 0xCEBDB78993C0BB6F, 0xCC1B6EA3526F507A, 0x345AB81155BEEA14, 
-0xCE05772FF421D7FF, 0x1A1177D481AEE3EB, 0x68C7C4496741DDB6, 0xCD46D52E39E18AA9, 
-0xC9C9E342F178A83B, 0x3B7E68D2A6CDDC2C, 0xCA3E6BA55D23823C, 0x2080BECA58A9, 
-0x3615852A119C0C73, 0xF0FD3336227A5453, 0xE1E920BED9CAED5E, 0x2C2AEAD27C2C1662, 
-0x6EE2DA6E9353ADF5, 0x5BBEEF6A5270A252, 0xE7EF86DA8E7EF0DF, 0xF65F58D06E3BCFB, 
-0x9A358D277CAEE442, 0xA15020B48EAC1E79, 0x52DE425B44F88786, 0x1A078812A8A5, 
-0x61973DDC982CEEE5, 0x5D41DC9C98A3AB96, 0x6EF970A40725E1C0, 0x83EDB582D522FA62, 
-0x893368BB0710E7FF, 0xF4AC6D2D58E23B4F, 0x13D046F1EBF60A6A, 0x954ADB68A3C3BA09, 
-0x16A6B0B610D225D4, 0xB0D9A83261F8276, 0x49D304F76ED99056, 0x5620D0E48210, 
-0x166853650DC0FB5A, 0x370E900ADB4DB52C, 0x4BFDF8B830693277, 0xE7D14029D33EE9B9, 
-0xDB4ADB3EBF2A675E, 0x73FD2D4C740E063B, 0x5EA40ADB24308EA6, 0x853DA4D463C28A02, 
-0x8D9A8E02BAADC52A, 0xC27B7F0EF0829B82, 0x3682617C6C84D2C5, 0x1034545AE7D5, 
-0x874F595D433076B, 0xFE71A343DA71CCE0, 0xFD7C50FF35598651, 0xC9B8D7C1B8DFB3A4, 
-0xDDF5E4421FD28E76, 0xD94ECFA5496DA7BB, 0xBBC316207254CEF7, 0x96AA8E489268B564, 
-0xA36D552AAF8A735F, 0x244C421ECF357115, 0x9A18FD3D0E16B117, 0x3160965B15B7, 
-0x30CBD4F6CEB76BCE, 0xD59615C8FC87EEDE, 0xABBB157B6A45E243, 0x1D858426F07557C8, 
-0x6A7702529CDA6E4B, 0xE62FDDC9BE58530E, 0xCFA32F8A6DE365CF, 0xD7E4B5949F44D0B7, 
-0x5829379FD59A332D, 0xCB081E48035AD3C3, 0x9895CF7F99BDB096, 0x40ABD002006F, 
-0x416E1E61E575A1B5, 0x99FCA1169E81CB10, 0x3205E0EFF81D6683, 0x712F8764E398D3D6, 
-0x1AAFB45A7A66273E, 0x7A287EDF6D4A4CD8, 0xE935A98AF9D2EA6E, 0xA06C3E2EFCBD58C1, 
-0x6EC24D695508A19D, 0x364750726F5FA1EC, 0x26A7405E01BBC32D, 0x2FEDE7A823A3, 
-0x69334509DDD82A9D, 0x2893D0DD1764A85A, 0xE78B5327EB2EE12A, 0x2CEBBB943E9DFE5D, 
-0x2AFFB64670841D16, 0x37B4E52F0593FD27, 0x2AEBFC7EC919D64E, 0x9E6EE78262AA330, 
-0x5550071878F88B55, 0x16EDB0AAFDE01A9C, 0xED0E7825F6D0BB3C, 0x744005B5F6, 
-0x5F388AAD1635425E, 0xDA273833E430EB2, 0xF525F3B6D6745F52, 0x7204B10B2F8ABB89, 
-0x527A336C12081841, 0xD22A5B071F1D4159, 0xBB6D76D606384A26, 0x501599BDFF893146, 
-0xDCC3FEE6E23B9233, 0xF0CA5BBE031F2037, 0xA7CC86756F8A5691, 0x1DCFC1CC23E3, 
-0x46558949FBD0F08F, 0xE0089D45B7F2B83, 0xA928914E859F8F6E, 0xEF0081403B720556, 
-0x881255C4E804E6, 0x756C1A435E8F8C6C, 0xEF72D56519ACEB, 0x9D7FFE033972E0D0, 
-0xCA5889C16A5E1B81, 0x673846C39749AAB4, 0xF40DF11E0B1E21C4, 0x3FE41D035336, 
-0x6BBD46937947265C, 0x36860FD6C6E1EA35, 0xA46A1BAF853EDE42, 0xAEFEF387D1A77E3B, 
-0x6C1909FD2A2C309B, 0xFF40B2874D5A0A6, 0xCEAE79EE6EAE11CB, 0x9FDD3D07992F0D0B, 
-0x7FBACE2430E3465B, 0xF753EC153E086265, 0xB3D39006AF4A4C01, 0x5EEBE5C99523, 
-0xE0BD57C44699903F, 0x528F259B6E0EA2FB, 0x3C372EA18BABD161, 0xA153F261CD6C9285, 
-0x2132344E1910B4B5, 0xB336F721A2F031AE, 0xEF137C85A6D73A5C, 0xAB68B27EABC9BEED, 
-0x36799FEDFC70987C, 0x79313585031BAADD, 0xC9B75FF0EFFF5E50, 0x18783EE446CB, 
-0x4CEA379E3D6F3E47, 0xDC0252E6B041DB7E, 0xEB69B35AAA3BEDDB, 0x8799E5BBE58A80F6, 
-0x6C90A9C4D59A8038, 0x71D35DDF57B153C1, 0x991F1C41FBCA3375, 0x4C75DDF3107B4782, 
-0x2D715ACB1B85FBD6, 0xB7855C3359729C4B, 0xCC8B42779944A9B0, 0x362637F0C598, 
-0x59E1928258330845, 0x779F211604C5034A, 0x5171F28ED2C5420E, 0xE1618B0861AA7439, 
-0x278BD671D8DF7E74, 0x161814C5B82DEBE2, 0x2597409C3192D634, 0xDE76903FCF3AE77, 
-0x2662BE07D3FCFA0E, 0xBE38EC29AF769878, 0xC11FBA8C822A9DB3, 0x106D257A8870, 
-0xEF68592BC6C6A50D, 0xEBD56D7E8D34317D, 0x53A50903812EB9EF, 0x9A46B2D983ADE53E, 
-0xEA022C3C5F16D5BC, 0xCEB749ED2D3A308, 0x7808AA082A5F3BD4, 0x22341E034876CA41, 
-0xA1F8BF86A23AFF99, 0x3DF62E0E40F0E042, 0x726D9BCCCE330076, 0x4E05CDECB727, 
-0x9AB8AD6392D45C11, 0x7EE687C03DD469CB, 0x68C0DCAE0CBF7490, 0x5E364FE5AB82F3D1, 
-0xDD9BD1BEC68DF1A7, 0x74D0DEA078B2E74E, 0xB0BDA1CA6CD538FC, 0x2086AFFD9A13085E, 
-0x35B83F10AE587863, 0x8657617DDEC44DC3, 0x2D5E75F2F80EB66, 0x656D1D718C94, 
-0xE2B284584662150F, 0x43EDC0B4EBFD00A2, 0x632DCA55564C2F96, 0x1051AC3E5A3079D9, 
-0x253D4DDD39DD992A, 0x74108936F3B6872B, 0xA162B16E95D86566, 0xD124B0A16922FD25, 
-0xC6BC277609B4CD95, 0x2721B11785058F5C, 0x8CA07E190581AB1B, 0x5598271A010C, 
-0xB4D52F0B1A9A500C, 0x3CF0EBC55280AF, 0xF3DE1DF391DE60CD, 0x46F6240B7C0D2758, 
-0x92AB40370EBB46CA, 0x86DDF5942A1F91FE, 0x2287C2E5674D1C40, 0xDA7A4A9141F910A7, 
-0x36A674980166DCAA, 0x441C711A3C84744B, 0x344F6F1F8AC33B2D, 0x80750698E61, 
-0x1828440434FD6D34, 0xCDDE722E8CB56AD9, 0x3D05577990B65846, 0xB41B9BC68825DD54, 
-0xEF0687FBF5B91540, 0x7B0197BF458355C2, 0x79102BC7DDFABEE, 0x26BB4F18C1BA2B4, 
-0xCE0DBC1863F408DE, 0x6A62CD35B8A850FA, 0xA305AB0196C39650, 0x330CE29EDED, 
-0xBD55069F53AB9B2C, 0xCA7FAEE05BCB75E9, 0x59C80D22FEF9F5A5, 0xFAE5934E536A10F1, 
-0x4A63FEF218472DCF, 0x89128AF337860669, 0x544143C85E1CE826, 0x6B81C66189E646C3, 
-0xAB5DB25652A0612, 0xC28F6AD05175EFAC, 0x6386F56362D5529B, 0x5B90DBC0D35B, 
-0x6BC8B8503CB864AA, 0xD57A855220B77E41, 0xBCAEACE8698E24E0, 0xE81DB133355FE5CA, 
-0x2E482D9D6D1EB246, 0x581C2E676F85FF09, 0xE98FFF623A6507D8, 0x884BB38DC8D88FA2, 
-0x42FCAC223AADF707, 0x5003119F7F947073, 0xBBEAD06642583502, 0x6C8E7ACF50F0, 
-0x554531CC6F04BA3C, 0x49B8D24FBE20AF19, 0x1BDCA782B68D438E, 0x394D621E7314FE19, 
-0xC0D37CF80650E696, 0x6FB03042530FF5DD, 0x89716F65630280ED, 0x60D07B0779F0E305, 
-0xA1C538AD8DC24CA7, 0xEA39A1E3F48AE693, 0xE240F497231DDB63, 0x35969BD99E80, 
-0x138D3C0BA71599B, 0x67CBC4086B8FBE35, 0x917B838DF7D38CFB, 0xDFCB72700404AF98, 
-0x3472B8F5FFBCE7F0, 0xC208D858F7AEC690, 0x6595ED7193EFCAB3, 0x5E43A2A486231EB8, 
-0x897031F44B74E357, 0xD17C48AB9FBF99D5, 0x9DCD7EE0F3FCAE32, 0x68294376C3C1, 
-0xC58BF3295EAE9773, 0x2B2337523A61BA75, 0xB6B646C9C6C8DFF6, 0xEB3A7D1F55D92867, 
-0xF3A00DF5B661A5AC, 0x8092E8F188A0810, 0x5A6D0EB2928A4A45, 0x3365E355926AD108, 
-0x45E79D7843C41F76, 0xB89B79EF1F5B2B41, 0x1196429F6704EF2E, 0x2965F46FCE0B, 
-0x8AD1FE382C774B05, 0x7B52C33C86C3B24B, 0xBB70B5258F360162, 0xADA7C3FAFA975B55, 
-0x2D4761FEA142C32B, 0xE4A8EAD18302AAD9, 0x257B4FD277D454A0, 0x1CF6F1CE3A0D1FB2, 
-0xED9A6727FCB5777, 0xE68F4B9AFC5BF049, 0x9D4F3F206AB528CA, 0x1323D1EC995D, 
-0xE7DEEF313D2E44A, 0x2200E73652EAF2D9, 0x9717B60A4F63E509, 0xD3F750B7B9FF4A85, 
-0x34593794CB749936, 0xDEFE840825B80E53, 0x4AAF733A1850C6C9, 0xA574970B465C7DA, 
-0xCB8AD245402C92E, 0x5D8482B525121262, 0xD67E7D11D4C8955E, 0x323E4D7047A7, 
-0xBEFE9BAFB3996B20, 0xE9A5E6EA0D1E833A, 0x2714838A861EF7B5, 0xD8114D8940A871F9, 
-0xE0653C7A63971853, 0xB355A62FE56B8753, 0xA88C63D5B4BF2823, 0x82B99AC564A5F321, 
-0xE8D72A5314CC6967, 0x566DD9C8DFF20748, 0xAC318D0C492A40BE, 0x39BFA2D1D1C4, 
-0xBC424DB60F0FAEDA, 0x9DF3E7B4A7C0B61A, 0xE6E63F411DBF72D0, 0x99160BA8442A1A7B, 
-0xD0098494B9100D9E, 0x38AAB10910F2A9B7, 0xD9B1617A16DA53DB, 0xF484525EA448BA7A, 
-0xCD51022E7771BA19, 0xCE15D2EA02B80E7, 0x3FBB222144158998, 0x51E70A28CD9E, 
-0x69A76E7B42688963, 0xC584EA7C4E2EBB0D, 0xCEED86A0106D1D00, 0x17C0AF6653F02438, 
-0x841A62A6D28D50E8, 0xC80A6C2FB70778C7, 0x66FDDD651F679059, 0xB4CD1ADEFD25464F, 
-0x2F549A758C64E4D4, 0xFF959796F158E5DE, 0x5E5D23DF2A3B20D6, 0x30530AC15334, 
-0x7D9164ED3F513D5F, 0xD7E7370890A80C1F, 0x32345AA52CCD2BAD, 0xD237083AF464F428, 
-0xBC1C2D9476B07EC1, 0xDF335D4986270DA8, 0x9CC36315CEB4EB24, 0x94F04B88189C2E62, 
-0xEA173E9289BE5CC3, 0x8ABF429DD2CBCE73, 0x271F8587907751FA, 0x26BBEAD6D08F, 
-0xFD42D9F8DFAF2B54, 0x27E4B9E261EBD9BB, 0x12E53F1A1788902D, 0x614BF3AB893EF060, 
-0x9284168A1F4C33BA, 0x24B27D6CD1C82F80, 0xA3506BDD8B226323, 0x2C7D14731CC482AE, 
-0xE27C2ABD813ADFAB, 0xCDD799D88281A24F, 0x57B25E547F30C74E, 0x5BF31EE7CC40, 
-0xC72C063D2AAE5D93, 0xE9437F48D532F889, 0xB61CE08BC13CCF95, 0x68B3BCE23B0A4474, 
-0x9EFF4E662EDBC49A, 0x3C66BF33897184AC, 0x24E32F3C35C3AB9E, 0x2FD449E12CFE5AA5, 
-0xBC884D9DBF6CE7C7, 0xAAFE16ECCAF72E6E, 0x257E67D596CA8E85, 0x55F611CDC981, 
-0x7056887E5883EABA, 0xEA77C44A48F7D2AE, 0xBFC783D6BB39575E, 0x1C554FC0F325341E, 
-0xE23EEE560F1B5112, 0x5AC70D75BCC215C, 0x74151B32FFBDD90A, 0xB5372C5CA5CD10F3, 
-0xD91C766FC61C3289, 0xCD58BFB5D5CD11ED, 0xEC5E0A60B4E32998, 0x6EC753D510D3, 
-0x58B22947490B8887, 0x4B10647E1F376725, 0x471EDF1C9A4E284E, 0xA726244CC3876322, 
-0x72FD1A14B2CD6FD2, 0xF9EF896D3DEE2725, 0x9A28D904283ADE94, 0x1AFEBB9539505717, 
-0x1C0E04EA188A6589, 0x89B27E66D3CA8E14, 0x68B5408318DF6EAD, 0x15F1376D91B, 
-0x6B63F896DE29FC8B, 0xF53306D24B39A502, 0xD5687AEFD069C6DE, 0x4550D0DA397F756A, 
-0x82D063B3AE27AE45, 0x878EABA0F39CD296, 0x91461C5912F24CC9, 0xEDCE4E214AD17E97, 
-0xBE39C3E01CC36303, 0x7093ACBAF7D5A4BB, 0xF74FFD24B80E1716, 0x5F23A42DF1C9, 
-0xA2F509ACA849FA9B, 0xAE350A201C9CC29B, 0xC37C41E8CB32B00, 0x3DE946804C2F5BA2, 
-0x1E408D035D1F66DC, 0xE9B2D09E91A5EBC5, 0x30ED4AEB468E23, 0xE992D740E5A4DAD8, 
-0xA4DA8E6EACFC1DF9, 0x4717E55C565BD942, 0x7E008535D2D324FE, 0x53479F387512, 
-0x706324FC10980020, 0xB323960F621EEFDC, 0xA45A0C708DD07CE3, 0x2BE4297B3C3599BD, 
-0xB671A6B69F3AAF6E, 0xBEB5CF5180B1E19, 0x7CFFACA60915754B, 0x304BB79DD1E863AA, 
-0x5EF1F5B6A85C4C6A, 0x7FA5D5AD06AC0862, 0x76751FDCA472F889, 0x3DFDAA509735, 
-0x87D29CD1326B7E33, 0x750AEEAC58103933, 0x71DE8581358E63A5, 0xED90B578A58E60F7, 
-0x2E56F945FB6D3987, 0xFAAB25859CCEF21C, 0x25D6CD62C8B2FD49, 0x43F9B11C075BB3DB, 
-0xF8E8BFD74B64494, 0x81BA570CD6F32C8E, 0x9CA5E1062D425358, 0xCFBE588C01, 
-0x1B39C646FB91632D, 0xFDC30365B1C4CF12, 0x57BB56A60975D4B2, 0x9DC66467CB466B8C, 
-0xFEF903A3871C4EC, 0xE269852E52B546AA, 0x609779856A33FD32, 0x5C84AFFEAC71EE60, 
-0xB96B46A956FBA3BB, 0x60BCDBE69195EFC, 0x7C0EED6A797FE3D7, 0x5808F582BBEC, 
-0xC60103FF55334D85, 0x986966A33D6517FF, 0x84EAF8A60493A34C, 0xFA9E8D8E03B9A1D0, 
-0x654E25A495BEA1FC, 0x4BCD540BFD46B575, 0x5D2338DA4A2BBD5B, 0x7AF5AC8694381272, 
-0x3C8DDC5C7962CD35, 0x88F4301650D79C4E, 0xDA918DD29E46B90D, 0x3305DA26356D, 
-0xA197F1B9D7577089, 0x23389CABE1A02A64, 0xCE0C1505D8D3A36E, 0x3EF64D892396A6E2, 
-0x7F04CD4A24F1381F, 0x517D72779F1E975B, 0x592506E5AFD115EA, 0xCA60198D3538B967, 
-0xF306D5876B2EBE70, 0xD1E91248F4B0B2EA, 0x2CBD02D7E3AD393A, 0x5EA6A48D927B, 
-0x23349556C131FB73, 0x1AA7552B421FF020, 0xEE0EBB7C76DBE482, 0x6A5127F710DE980B, 
-0xB96FC57DDF912668, 0xD89D31D50A99797A, 0x484067673650D761, 0xDE33896724DEF1F1, 
-0xA5D31C6E0431D492, 0x4835A3305DDB74A4, 0xD0BB1E1070CB52D5, 0x21EAD8AE4F41, 
-0xE086C97DF529E919, 0x1C1C275E695F00ED, 0x456E26CF17BCDD9B, 0x204C75673CE8ABE8, 
-0x77FF4D6235CD70E4, 0x3F5230C0ED2FBC55, 0xFDBF5A76046356A7, 0xE8D3F42EC462B653, 
-0x65FC5B72A26BFE01, 0x58EE51C24D09340B, 0x51296B33808A3F31, 0x3AC386DAB60C, 
-0xAE43D55F7B0580BD, 0x6BA5EE2ECB7A2ECB, 0xAD8839E567BDC982, 0x2F0B8998E0405E9E, 
-0x75BF8BBAD2336080, 0x95B794166AEAB45F, 0x8D72D18874ACDB7C, 0x71BE5C46E5E9A0AD, 
-0x7441AFE4D0D5F48E, 0x922468E87BCFDE94, 0xD3FFB3C46172436, 0x5F92280E6A37, 
-0xF414D56B0EDC4747, 0x64916AC4660261FC, 0x9EBEB33906AD8953, 0xEDBE52E0DA53D198, 
-0xB62B69D7CBDE1144, 0x68BC69F9383ED43A, 0x72C618308BEB1FC1, 0x89FF71486F43C437, 
-0x7955B6B132A4DB30, 0xBC2CA9E22893BE1A, 0xCCF5F3154781007F, 0x4E046F5B8EEB, 
-0x4659FB28151C8DE4, 0x39A7FA767E6FA3C5, 0x1F333A51A592861C, 0xC24D9F7725CFBC89, 
-0x5EDD8B4B0BFE8E08, 0x1925C4979A2E9A19, 0x7704E8814E14747B, 0x1586A214C0E2520A, 
-0x55A3297B1B6C93AB, 0xCEDE2C89ED91492C, 0xB3700269D73171A5, 0x517B6BB3E04D, 
-0xC2048946D8DDF9FD, 0x136B7B77C757F782, 0xECC50261633088D9, 0xB680BA279C8F1B07, 
-0xB28548AB84F5D6F7, 0xB5E6690E0B0D2958, 0xE1C114A3020F3B42, 0x8ADF56025A3C83C6, 
-0xD9F2F147C6909FD5, 0x5EC60774F45705CA, 0x491F08403B362879, 0x4BCBF3C05E0E, 
-0x886265A7E4CEBBB6, 0xC2AE750591294A7A, 0x2DCA149D7CAFD814, 0x506102192C27BEEC, 
-0x7F35EDBCB3B01615, 0xE92AC980D416B428, 0xB7EF9622FC844ED1, 0x259581F38AC3769, 
-0xC108F44159EE5034, 0x9A71A67221103434, 0x8FE3849C196E878F, 0x75626D6A7DC, 
-0x1E0A16D78C626344, 0x226AB76C19AE111D, 0x21CBAD5C4FA21FBA, 0x1526DA66F753BEC2, 
-0x3E40CFBA1578A898, 0x9A682A0058EC6166, 0xE8A0433E1358EFA8, 0xF240856F0B497F7F, 
-0xCFAD5125225D3BFF, 0xC691B4FB463DE7E6, 0x90C2DEBF41DC6D5F, 0x11FCEAC513DE, 
-0xBA5C6C2911F980BC, 0x9C35A5DFD47773CD, 0xADB2548101BDF4E6, 0xE54D9F6E60667FC3, 
-0x435700CE7A378055, 0xB5C9EE54DA5FF464, 0x70A148C198BACDC0, 0x2BE4444A6AA87B57, 
-0x33B2EAFCD62AA4E2, 0x2BD60156072C9955, 0x4D909F98BA33B407, 0x40B14FFCB239, 
-0x66519FEE56007A3, 0xBF9E0087BBB7830E, 0xF7747552E4010EC9, 0x47AC410A15692AB5, 
-0x1DCA01780E007C33, 0x9C7C599F0E063BB6, 0xB41A3DCC200CF2F7, 0x888F63DC314609EC, 
-0xFF7718AA36AF9B93, 0x7DABBE90849B80B0, 0xBC6F5AD58FBE9F47, 0x3EA591DE227F, 
-0xF87B3774C50FDDE, 0xCC673CFE8F68D09E, 0x1C20CCB31926F562, 0xB5C1C7542B1A7ED4, 
-0x15B5CEC813F1C297, 0xC101D5B76AD0F30D, 0xDC5ACB9F20A914C9, 0x600E05863330862A, 
-0xA22340AC35E9B70A, 0xF8F425BCF901E6E2, 0x790452E8484D4376, 0x6D539A740DA5, 
-0x6237F4ED1ED274CC, 0x7B992E6D1876B6D7, 0x7912B44F1E12B6AA, 0x8400003624A71447, 
-0x1C1F41B6930631D, 0x404A73C2A7ED8AE0, 0x4A91BD587C4C2FC1, 0x19BF0A548B1B76CF, 
-0xC78006129BE1AAB2, 0xEBE771AD7D7B353C, 0xA9B37F23C5805620, 0x25214E5E7866, 
-0x457BF00CF9C66311, 0xE70F9C9D451F6CDE, 0x9073C55282756066, 0x8AC30E6D1956FE22, 
-0x60C68FB2AB2CD96B, 0xCB6F6B64BDEB70F2, 0x245ABF0C5B475FFC, 0x8DE20C6B0151F862, 
-0x35ED831720063B28, 0x70BC87CAAF983119, 0x68C8FC39D67A971E, 0x2BD694ABDD9, 
-0x5F36AF1C6F0E9A5B, 0xD9EB532CA7C44C4C, 0xBE00EF63820E3FE9, 0x3228406BD0EE879E, 
-0x65086D9937814A91, 0x6D50C2B2BB985EC8, 0x99121655EACC8D30, 0x682874872952D9DF, 
-0x9EF725300D0DD7C3, 0x43C05F5486B1D386, 0xA99DE4C6D79F3519, 0x63F8D92A7571, 
-0xCB95C30FC3174D35, 0xEB2D804ECC6FCD08, 0x6F64D7C1DC92882, 0x632F8C3CDA3D32E6, 
-0x4B810F8D093F0DA2, 0x73E4FE3AD967E64A, 0xBAA3DC15787BE9E6, 0xA3EE912C5EBBD4D7, 
-0xDB27AB863331109B, 0xFD2F7D2AF3DD92B8, 0x2C1B1850368F487D, 0x4A22D98E9F68, 
-0x24F87291E2A07F12, 0xDA6A9231AAF6BD64, 0x8CD2BCD6F3A7A617, 0x55DCC041BB1C18D1, 
-0x74E836F38891757D, 0x6EF32A847FF5488, 0xBCCC16A32572A83F, 0xFC131A8BE7D5591D, 
-0x5F01911C8F0BDC7D, 0xE357CC673FC652F3, 0xE5911670A82801BE, 0x46CE1687F71E, 
-0x1514525367BCD0E5, 0x2B22BAB04D11B869, 0xA68B5BA67A2C0227, 0x12928C65959A6E72, 
-0x6D75FF5512A6FDE5, 0x2A3F9D2021AEE65B, 0x8D5AEDC8F8125590, 0xC4D958DCDDF7DB06, 
-0xE39351EA9592245E, 0x1EE0ABCF0FD05085, 0x7579DE7B721F8D3F, 0x4E2801128E4, 
-0x17B0959467EC8E27, 0x295DBAC9D48B1B26, 0x114120B6CDEF3FE6, 0x4D5C26171008794A, 
-0x2353914B84B8B55D, 0xA30DC896A6DD004D, 0xF7606531B244E8B3, 0xB8075F8DD844102D, 
-0x8F0A1EBEC1E3801, 0x4340C408EAE9DF0A, 0xD73EBC3AE19A6404, 0x506C451132E1, 
-0x4055AC928B226585, 0x3E08FD03DA5062CF, 0x53D79EED1399D30E, 0xB3D37032CC4D489E, 
-0xB771F96700F79F9D, 0xA11CE98855CD5AEF, 0x5873EE54DEBD52E2, 0xC62EC293E8BFD596, 
-0xF71CD796793DEE39, 0xF8B0C45C51C78C91, 0x1CB88C7BD8767DA0, 0x578543F8D455, 
-0xC3E0C2B6BAB78CB7, 0xB903667D4558326B, 0x54E4AE2B85F23911, 0x5649D99D06BB61FF, 
-0xD09785C64F1B4029, 0x8BB26D1292D78CAB, 0xBCCA9514540915D7, 0x76BE7E9FF4C3DE3F, 
-0x72E4AD6F7BE0004B, 0xF2E439AE536E2E, 0xBFC66F367F87E558, 0x4894C93B1B03, 
-0x867BBFC0E08A6D07, 0x3B5E68AD7EFA1083, 0x17D461189A4B3FA9, 0xB833EA51082E6C15, 
-0x37A67B06B1465753, 0xD8EF3548E2D08CE8, 0xEBAE029CEEE344E3, 0x5BD9E8AB7E4D077B, 
-0x332CF5ACF9DD15C6, 0xC34BE7AFAAA087D7, 0x2D7698A34F912614, 0x34452A442EA5, 
-0x84BC9927764FF643, 0x2F3FF1E0A9458E3C, 0x3C56A96BCC54530B, 0xE052EEC6BEEB6EF4, 
-0x1C5A198D9FEB8C8C, 0x21EEFEC6B6392FC5, 0x744365BC036E4C06, 0xB1A87629DB585882, 
-0x67025185091206E0, 0xE2609BBF520CE6C0, 0x3B3C52B3C164DE7B, 0x5B7196743997, 
-0x9DD99D1609E1CEC3, 0xEB58F112EA33D47F, 0x57C51C69E8A419D2, 0x8169F935EDF95AD6, 
-0xB85B11F27B15D1D0, 0x82DC90C4DB2E1257, 0x9420312993366C99, 0x910F774C19AC3494, 
-0x53E0D099427A90EB, 0xBE1D153B78FC793C, 0xAD612FC1291631AA, 0x56DB79C9A67D, 
-0xC646415B40C651B4, 0x10C2384F19971F2F, 0x65DBF9F71C0B3F2E, 0xC7856509C94819D3, 
-0x54A80DC50F93355A, 0xABE5293E42DA5556, 0x2939A8601913CD3, 0xEAE995FA8DF4A95D, 
-0x97F2C96AD632F013, 0x587DCA665B14D3FC, 0x205BF123277E84AC, 0x5BAA0A8F34C0, 
-0xD4DF793521E66053, 0xDBFF6F5D95305442, 0x73C399CE95AF8A1C, 0x81FB12A972AC7321, 
-0x6DAA1AF4CA30A820, 0xA4E6931E8150498, 0x954969150AA962C4, 0x6C9AA122565C9A66, 
-0x7CB81205ADF37420, 0x5AAA4E6E2849B52B, 0x297B9337817F4C75, 0x5AE710F672FD, 
-0x6DD08, 0x0, 0x0, 0x0, 0x0, 0x9A80000000000000, 0x1B8A7F275C1CCC8A, 
-0x61D12C23A9F5A1FA, 0x518A8EB02E290214, 0x608B67A91963E4BC, 0x24D426A5C77D7B55, 
-0x182B98F4BA8A, 0x2AFD75A913ECF8DF, 0x2918FBA06F88C9AB, 0xA4AC4DC7CB526F05, 
-0x2D19E9391A607300, 0x7A79E2B34091B54, 0xA05809DCB42F1792, 0xB8D6FA0B2FB9739F, 
-0xB92947307436AD45, 0xA478488AA072D9C3, 0x76EF5DE652478B48, 0x21B5B2D9A016385E, 
-0x36FB1719882D, 0x3728ED40E235CBB7, 0xEB8E134CA64361D5, 0x38E95CE4C097727, 
-0x517C1D90F7A63229, 0x3FFD4FE250E112DB, 0xD19B655E70A2D616, 0x4144CF18F5C1713C, 
-0x634C0C1C04B3343D, 0xA130EEA94CB71A24, 0xE99FAA56357D2570, 0x60EAD2DDB8B4022F, 
-0x3CC58DD89435, 
-0x4935A, 0x0, 0x0, 0x0, 0x0, 0x620000000000000, 0xAA4F63C86EB8D8CD, 
-0xD2EF2F7E7E9E49A0, 0x913B6F6558B89C5C, 0x99496873A40ED2AD, 0x21EF24D8EA258FD2, 
-0x5AB64979CBC4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x2AFD75A913ECF8DF, 0x2918FBA06F88C9AB, 0xA4AC4DC7CB526F05, 0x2D19E9391A607300, 
-0x7A79E2B34091B54, 0xA05809DCB42F1792, 0xB8D6FA0B2FB9739F, 0xB92947307436AD45, 
-0xA478488AA072D9C3, 0x76EF5DE652478B48, 0x21B5B2D9A016385E, 0x36FB1719882D
-};
-
@@ -1,19 +0,0 @@
-/********************************************************************************************
-* SIDH: an efficient supersingular isogeny cryptography library
-*
-* Abstract: benchmarking/testing isogeny-based key encapsulation mechanism SIKEp751
-*********************************************************************************************/ 
-
-#include <stdio.h>
-#include <string.h>
-#include "test_extras.h"
-#include "../src/P751/P751_api.h"
-
-
-#define SCHEME_NAME    "SIKEp751"
-
-#define crypto_kem_keypair            crypto_kem_keypair_SIKEp751
-#define crypto_kem_enc                crypto_kem_enc_SIKEp751
-#define crypto_kem_dec                crypto_kem_dec_SIKEp751
-
-#include "test_sike.c"
\ No newline at end of file
@@ -50,6 +50,7 @@ const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x6E18D3A63313A738, 0x1DCC4
                                                      0x7335784B5ECF957F, 0x66AE2381533A7F09, 0x000232BFFE6FA42F, // XRA0
                                                      0x60ACBE5D899CFA6A, 0x82AC55A556E5A22F, 0x437D8C2AC83FDC6B, 0x620A8DA602543EDE,
                                                      0xD19ABA8092A1E8C2, 0xAFF1AA61981C95D3, 0x0001A7232B0C035E }; // XRA1
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD]={
 0x9c1297ed6574cdaa, 0xd87843c892ad5b08, 0xec683b76c34738ab, 0xe79cd40b90ef8a61, 0x35c3aae9582d2a3a, 0xd446c96709cf0a43, 0x1f96ed8c655e5,
 0xe65521b6c3a3e79c, 0x4294965637687bde, 0x5800317b129fb116, 0xa6c4104177a58bf1, 0xf93a33bca0908339, 0xbd3185e70d2ac98b, 0xe4d931d7e11f ,
@@ -266,6 +267,7 @@ const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD]={
 0xcd42a0635874976f, 0xdaf2e2d995e9fb27, 0x10297294bdf1684a, 0x25cf10b742594160, 0x8151f5097a36a1a1, 0x41b7858b9686d66, 0x196a26721bd09,
 0xece26bb415e5fa80, 0x61145578bb5bb301, 0x57c41cacb35e8069, 0x9054cc5490574c70, 0x907f2b16eb011811, 0x92e63c5727900c85, 0x2006860c0f229,
 0xaf1cd80ce61edaf9, 0x73c62447391bb872, 0xa8f7f698c7fbfbe, 0xc52fab5f3040d6b8, 0x7fb1f1ef2680885d, 0x713579ae46587f12, 0x10ee43f3a619d};
+#endif
 const uint64_t YQA4[NWORDS64_FIELD]              = { 0x898e8f7686f2f4e6, 0xe21377adf1509405, 0x2c278c05c90d38f8, 0x9e033cfccf292cb5,
                                                      0xeb1c3830c73809d3, 0x64de17327298ff7b, 0x1e05dc4b6d8cc};
 const uint64_t DBL_QA[2 * NWORDS64_FIELD]        = { 0x6448cb5bd976250e, 0x3092cf8c8803d8b4, 0x2542331c81c2c2f8, 0xc086e30db24aa32,
@@ -297,6 +299,7 @@ const uint64_t B_gen[6 * NWORDS64_FIELD]         = { 0xE172658571249BA8, 0x9D8F5
                                                      0x84AC5026408590E1, 0x5378004CB74DA4ED, 0x00008AA46B9E55B2, // XRB0
                                                      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }; // XRB1
 
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0x214C34BB192F67A0, 0xDD49D3D02115D30, 0x700652C1A7B66ED, 0x1F856B48F4FF0024,0xFBDE6F4E6A705221, 0xB951A3D6C93D87B8, 0xAE8ADB818ED6,
 0x51D889FE197209C1, 0x191BCD9DBE4FE0EF, 0x447818CF5E54DD8A, 0x3F42710E8562A583,0x647BDBB01C66DCB5, 0xF402D36C15EA12E1, 0xA1E1D287C14C,
@@ -522,6 +525,7 @@ const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0xd215d197e847af91, 0xfb83898ea11b4376, 0x288b8cd5fce32ba4, 0x71f861b8d5dc8eb, 0x660f4519057934a1, 0x9d76d38aec4c09eb, 0xc41760519c10,
 0x651717b22b087408, 0x731edb0e1e5a0e72, 0xe430616c43099e16, 0xd7c19049319b2e05, 0x1248603693226f6a, 0xa65b2af0eb232b15, 0x17c2779d1396c
 };
+#endif
 
 
 // Montgomery constant Montgomery_R2 = (2^448)^2 mod p434
@@ -532,6 +536,34 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x000000000000742C, 0x00000
                                                      0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA };
 
 
+#if defined(LANES_AVX512IFMA)
+// Constants of the lane-parallel arithmetic (fpx_x8.c) in limbs of 52 bits: p434, 2*p434, 4*p434, p434 + 1, and p434*2^51, which is
+// added from limb NWORDS52_FIELD-1 of the products to keep them positive
+const uint64_t p434_r52[NWORDS52_FIELD]            = { 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0x3FDC1767AE2FF, 0xC65C783158AEA, 0xFD681C520567B, 0x271773446CFC5,
+                                                       0x000000002341F };
+const uint64_t p434x2_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFE, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0x7FB82ECF5C5FF, 0x8CB8F062B15D4, 0xFAD038A40ACF7, 0x4E2EE688D9F8B,
+                                                       0x000000004683E };
+const uint64_t p434x4_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFC, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFF705D9EB8BFF, 0x1971E0C562BA8, 0xF5A07148159EF, 0x9C5DCD11B3F17,
+                                                       0x000000008D07C };
+const uint64_t p434p1_r52[NWORDS52_FIELD]          = { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x3FDC1767AE300, 0xC65C783158AEA, 0xFD681C520567B, 0x271773446CFC5,
+                                                       0x000000002341F };
+const uint64_t p434x2e51_r52[NWORDS52_FIELD+1]     = { 0x8000000000000, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0x1FEE0BB3D717F, 0xE32E3C18AC575, 0xFEB40E2902B3D,
+                                                       0x938BB9A2367E2, 0x0000000011A0F };
+// Montgomery constants of the lane-parallel arithmetic: Montgomery_R2_r52 = (2^468)^2 mod p434 and Montgomery_one_r52 = 2^468 mod p434
+const uint64_t Montgomery_R2_r52[NWORDS52_FIELD]   = { 0xB301116EF651D, 0x28E55B65DCD69, 0xC7367768798C2, 0x3F8311688DACE,
+                                                       0x71A9737307097, 0xE94F50CC12CDE, 0x09D7CEF386EA6, 0x784686EEF785E,
+                                                       0x000000000CE1E };
+const uint64_t Montgomery_one_r52[NWORDS52_FIELD]  = { 0x0000742C6B854, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x428CB3A858400, 0x5776FEC6D4724, 0xD2D0AD9D41CF5, 0x8B890471DE8D4,
+                                                       0x00000000012F4 };
+#endif
+
+
 // Fixed parameters for isogeny tree computation
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 
@@ -543,6 +575,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 32, 16, 8, 4, 3, 1, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 
 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
            
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(pre_for_Alice,        (OALICE_BITS - 1) * NWORDS64_FIELD)                 \
+    X(pre_for_Bob,          (OBOB_BITS + 5) * NWORDS64_FIELD)                   \
+    WINDOW_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy434
 #define fpzero                        fpzero434
@@ -567,24 +605,65 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2div2                       fp2div2_434
 #define fp2correction                 fp2correction434
 #define fp2mul_mont                   fp2mul434_mont
+#define fp2mul_add_mont               fp2mul_add434_mont
+#define fp2mulsub_mont                fp2mulsub434_mont
 #define fp2sqr_mont                   fp2sqr434_mont
 #define fp2inv_mont                   fp2inv434_mont
 #define fp2inv_mont_bingcd            fp2inv434_mont_bingcd
 #define fpequal_non_constant_time     fpequal434_non_constant_time
 #define mp_add_asm                    mp_add434_asm
+#define mp_addx2_asm                  mp_add434x2_asm
 #define mp_subaddx2_asm               mp_subadd434x2_asm
 #define mp_dblsubx2_asm               mp_dblsub434x2_asm
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp434
 #define crypto_kem_enc                crypto_kem_enc_SIKEp434
 #define crypto_kem_dec                crypto_kem_dec_SIKEp434
+#define crypto_kem_keypair_x8         crypto_kem_keypair_x8_SIKEp434
+#define crypto_kem_enc_x8             crypto_kem_enc_x8_SIKEp434
+#define crypto_kem_dec_x8             crypto_kem_dec_x8_SIKEp434
+#define crypto_kem_enc_concurrent     crypto_kem_enc_concurrent_SIKEp434
 #define random_mod_order_A            random_mod_order_A_SIDHp434
 #define random_mod_order_B            random_mod_order_B_SIDHp434
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp434
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp434
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp434
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp434
+#define tables_load                   tables_load_p434
+#define tables_unload                 tables_unload_p434
+#define sidh_set_ladder               sidh_set_ladder_p434
+#define sidh_get_ladder               sidh_get_ladder_p434
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp434
+#define EphemeralKeyGeneration_B_ladder EphemeralKeyGeneration_B_ladder_SIDHp434
+#define EphemeralKeyGenerationAgreement_A EphemeralKeyGenerationAgreement_A_SIDHp434
+#define crypto_kem_keypair_ladder     crypto_kem_keypair_ladder_SIKEp434
+#define crypto_kem_enc_ladder         crypto_kem_enc_ladder_SIKEp434
+#define crypto_kem_dec_ladder         crypto_kem_dec_ladder_SIKEp434
+#define sidh_opcount                  sidh_opcount_p434
+#define keypool_start                 keypool_start_p434
+#define keypool_stop                  keypool_stop_p434
+#define keypool_stats                 keypool_stats_p434
+#define sidh_workers_stop             sidh_workers_stop_p434
+#define crypto_kem_keypair_pooled     crypto_kem_keypair_pooled_SIKEp434
+#define EphemeralKeyPair_A_pooled     EphemeralKeyPair_A_pooled_SIDHp434
+#define EphemeralKeyPair_B_pooled     EphemeralKeyPair_B_pooled_SIDHp434
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#else
+    #include "P434_window_tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
+#include "../isogeny_mt.c"
 #include "../sidh.c"    
-#include "../sike.c"
\ No newline at end of file
+#if defined(LANES_AVX512IFMA)
+    #include "../fpx_x8.c"
+    #include "../ec_isogeny_x8.c"
+    #include "../sidh_x8.c"
+#endif
+#include "../fpx_x2.c"
+#include "../ec_isogeny_x2.c"
+#include "../sidh_x2.c"
+#include "../sike.c"
+#include "../keypool.c"
\ No newline at end of file
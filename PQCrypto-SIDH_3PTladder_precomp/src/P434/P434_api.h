@@ -36,6 +36,28 @@ int crypto_kem_enc_SIKEp434(unsigned char *ct, unsigned char *ss, const unsigned
 // Outputs: shared secret ss      (CRYPTO_BYTES = 16 bytes)
 int crypto_kem_dec_SIKEp434(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// Multi-buffer API: each call processes SIKE_LANES independent operations on consecutive keys, ciphertexts and shared secrets, in the
+// lanes of the AVX-512 IFMA arithmetic if the library is compiled for it (see LANES_AVX512IFMA in config.h), one after the other otherwise.
+// The functions return 0 if all the lanes succeed. Otherwise, bit i of the returned value is set if lane i failed: its random bytes could
+// not be obtained, or its public key encodes a coordinate that is not in [0, p-1]. The outputs of a failed lane are zeroed. As in
+// crypto_kem_dec_SIKEp434(), such a ciphertext is implicitly rejected by crypto_kem_dec_x8_SIKEp434(), which always returns 0.
+// With AVX-512 IFMA, the kernel points of the lanes are always computed with the 3-point ladder on the basis points: neither the engine
+// of sidh_set_ladder_p434() nor the precomputed tables (PRECOMP_WINDOW) are used, and there is no _ladder variant. Otherwise the
+// lanes use the engine of the process. The outputs do not depend on the engine.
+#define SIKE_LANES                  8
+
+int crypto_kem_keypair_x8_SIKEp434(unsigned char *pk, unsigned char *sk);
+int crypto_kem_enc_x8_SIKEp434(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int crypto_kem_dec_x8_SIKEp434(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+// Encapsulation with Alice's key generation and shared secret computation run on two threads, same outputs as crypto_kem_enc_SIKEp434()
+// With _PARALLEL_, the second thread is taken from the worker pool (see sidh_workers_stop_p434()) by at most SIKE_ENC_HELPERS encapsulations 
+// at a time. The encapsulation runs sequentially without _PARALLEL_, on a single processor or when SIKE_ENC_HELPERS encapsulations already 
+// use a worker.
+#define SIKE_ENC_HELPERS            2
+
+int crypto_kem_enc_concurrent_SIKEp434(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp434" (wire format):
 // ----------------------------------------------------------------------
@@ -66,7 +88,8 @@ void random_mod_order_A_SIDHp434(unsigned char* random_digits);
 
 // Generation of Bob's secret key 
 // Outputs random value in [0, 2^Floor(Log(2,3^137)) - 1] to be used as Bob's private key
-void random_mod_order_B_SIDHp434(unsigned char* random_digits);
+// Returns 0, or -1 if the random bytes could not be obtained
+int random_mod_order_B_SIDHp434(unsigned char* random_digits);
 
 // Alice's ephemeral public key generation
 // Input:  a private key PrivateKeyA in the range [0, 2^216 - 1], stored in 27 bytes. 
@@ -105,4 +128,129 @@ int EphemeralSecretAgreement_B_SIDHp434(const unsigned char* PrivateKeyB, const
 // Shared keys SharedSecretA and SharedSecretB consist of one element in GF(p434^2). In the SIDH API, they are encoded in 110 octets.
 
 
+// Key generation engine
+// The kernel point of the key generation of SIDHp434 and SIKEp434 is computed either with the 3-point ladder over the large 
+// precomputed tables (or the windowed comb with PRECOMP_WINDOW), or with the Montgomery ladder, which reads no table but does 
+// a doubling and an addition per bit instead of an addition. Both engines produce the same keys. 
+// The engine of the process is shared by all its threads and used by all the functions of this API but the *_ladder ones below. 
+// It is the 3-point ladder, or the engine named by the environment variable SIDH_LADDER ("3pt", "montgomery" or "auto") read on 
+// the first key generation, unless it is selected with sidh_set_ladder_p434(). The *_ladder functions take the engine of a 
+// single call instead, and leave the engine of the process unchanged.
+
+#define SIDH_LADDER_AUTO          0      // The faster engine on this host, timed when it is first used
+#define SIDH_LADDER_3PT           1      // 3-point ladder over the precomputed tables
+#define SIDH_LADDER_MONTGOMERY    2      // Montgomery ladder
+#define SIDH_LADDER_DEFAULT       3      // The engine of the process, only for the *_ladder functions
+
+// Selects the engine of the key generation for the whole process. With SIDH_LADDER_AUTO, this call times both engines
+// Returns 0 on success, or -1 if ladder is not one of the values above
+int sidh_set_ladder_p434(unsigned int ladder);
+
+// Returns the engine of the key generation, SIDH_LADDER_3PT or SIDH_LADDER_MONTGOMERY
+unsigned int sidh_get_ladder_p434(void);
+
+// Key generation, encapsulation and decapsulation with the kernel point computed by the engine ladder, one of the SIDH_LADDER_* values. 
+// Same inputs and outputs as the functions without the _ladder suffix. Return -1 if ladder is not a SIDH_LADDER_* value
+int EphemeralKeyGeneration_A_ladder_SIDHp434(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, unsigned int ladder);
+int EphemeralKeyGeneration_B_ladder_SIDHp434(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, unsigned int ladder);
+int crypto_kem_keypair_ladder_SIKEp434(unsigned char *pk, unsigned char *sk, unsigned int ladder);
+int crypto_kem_enc_ladder_SIKEp434(unsigned char *ct, unsigned char *ss, const unsigned char *pk, unsigned int ladder);
+int crypto_kem_dec_ladder_SIKEp434(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, unsigned int ladder);
+
+// Alice's ephemeral public key generation and shared secret computation with the same private key, as in the encapsulation: the 
+// two isogeny trees are traversed in lockstep. Same outputs as EphemeralKeyGeneration_A_ladder_SIDHp434() with the engine ladder and
+// EphemeralSecretAgreement_A_SIDHp434(). Returns -1 if ladder is not a SIDH_LADDER_* value
+int EphemeralKeyGenerationAgreement_A_SIDHp434(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* PublicKeyA, unsigned char* SharedSecretA, unsigned int ladder);
+
+
+#if defined(SIDH_OPCOUNT)
+// Operation counts
+// With SIDH_OPCOUNT, the field operations (multiplications, squarings, reductions, additions, subtractions, inversions), the 
+// point operations and the isogeny steps executed by the calling thread are counted, including those of the threads of the 
+// isogeny engine. The counts are kept for the last call of each function below on the calling thread. With SIDH_LADDER=auto in the 
+// environment, the engine should be selected with sidh_set_ladder_p434() first, otherwise the first key generation also times both engines.
+// EphemeralKeyGenerationAgreement_A_SIDHp434() stores its counts as those of SIDH_OP_KEYGEN_A and SIDH_OP_AGREEMENT_A, the steps run
+// as two lanes being split evenly between them.
+
+#define SIDH_OP_KEYGEN_A          0      // EphemeralKeyGeneration_A_SIDHp434()
+#define SIDH_OP_KEYGEN_B          1      // EphemeralKeyGeneration_B_SIDHp434()
+#define SIDH_OP_AGREEMENT_A       2      // EphemeralSecretAgreement_A_SIDHp434()
+#define SIDH_OP_AGREEMENT_B       3      // EphemeralSecretAgreement_B_SIDHp434()
+#define SIKE_OP_KEYPAIR           4      // crypto_kem_keypair_SIKEp434()
+#define SIKE_OP_ENC               5      // crypto_kem_enc_SIKEp434()
+#define SIKE_OP_DEC               6      // crypto_kem_dec_SIKEp434()
+
+typedef struct {
+    unsigned long long mul, sqr, rdc;    // Integer multiplications and squarings, and Montgomery reductions (a GF(p^2) multiplication is 3 mul and 2 rdc)
+    unsigned long long add, sub, inv;    // GF(p) additions, subtractions and inversions
+    unsigned long long xdbl, xtpl, xdbladd, xadd;
+    unsigned long long get_2_isog, eval_2_isog, get_3_isog, eval_3_isog, get_4_isog, eval_4_isog;
+} sidh_opcount_t;
+
+// Reads the operations of the last call of op on the calling thread into count
+// Returns 0 on success, or -1 if op is not one of the values above
+int sidh_opcount_p434(unsigned int op, sidh_opcount_t* count);
+#endif
+
+
+// Worker threads
+// With _PARALLEL_, the point evaluations of the tree traversals, crypto_kem_enc_concurrent_SIKEp434() and the key pair pools below 
+// run on a pool of threads that are started on first use and kept for the next operations.
+
+// Joins the threads of the pool, the next operation starts them again. Returns 0, or -1 without joining them if one of them is 
+// still running a job, e.g. for a key pair pool that was not stopped with keypool_stop_p434() or for an operation of another thread.
+int sidh_workers_stop_p434(void);
+
+
+// Key pair pools
+// With _PARALLEL_, keypool_start_p434() runs threads of the worker pool that generate the key pairs of a pool ahead of time, so the 
+// pooled key generations below only copy a ready pair. A pool is refilled up to high pairs once it is down to low pairs. 
+// If the pool is empty or not running (always without _PARALLEL_), the pooled key generations generate the pair inline.
+// SECURITY NOTE: the private keys of the ready pairs stay in memory until they are handed out or the pool is stopped.
+
+#define KEYPOOL_SIKE              0      // Key pairs of crypto_kem_keypair_SIKEp434()
+#define KEYPOOL_SIDH_A            1      // Alice's ephemeral key pairs
+#define KEYPOOL_SIDH_B            2      // Bob's ephemeral key pairs
+#define KEYPOOL_MAX_SIZE       1024      // Largest high watermark
+#define KEYPOOL_MAX_THREADS       8
+
+// Starts nthreads workers (1 to KEYPOOL_MAX_THREADS) that keep between low and high key pairs of pool ready, low < high <= KEYPOOL_MAX_SIZE
+// Returns 0 on success, or -1 if an argument is invalid, the pool is already starting, running or stopping, or fewer than nthreads
+// workers are available: the workers it could take are then handed back, and the pool stays stopped.
+// keypool_start_p434() and keypool_stop_p434() may race on the same pool: only one start or stop acts at a time.
+int keypool_start_p434(unsigned int pool, unsigned int low, unsigned int high, unsigned int nthreads);
+
+// Stops the workers of pool, waits for the pooled key generations of pool in flight and erases the key pairs left in it. The pooled 
+// key generations that start later generate inline.
+void keypool_stop_p434(unsigned int pool);
+
+// Number of pooled key generations of pool served from the pool (hits) and generated inline (misses), and number of key pairs ready
+// Returns 0 on success, or -1 if pool is not one of the values above
+int keypool_stats_p434(unsigned int pool, unsigned long long* hits, unsigned long long* misses, unsigned int* ready);
+
+// SIKE's key generation from KEYPOOL_SIKE, same outputs as crypto_kem_keypair_SIKEp434()
+int crypto_kem_keypair_pooled_SIKEp434(unsigned char *pk, unsigned char *sk);
+
+// Alice's and Bob's ephemeral key pairs from KEYPOOL_SIDH_A and KEYPOOL_SIDH_B: a private key as output by random_mod_order_A/B_SIDHp434() 
+// and its public key as output by EphemeralKeyGeneration_A/B_SIDHp434()
+int EphemeralKeyPair_A_pooled_SIDHp434(unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
+int EphemeralKeyPair_B_pooled_SIDHp434(unsigned char* PrivateKeyB, unsigned char* PublicKeyB);
+
+#if defined(TABLE_BUNDLE)
+// Table bundle
+// With TABLE_BUNDLE, the large precomputed tables are not compiled into the library but read from a bundle file generated by 
+// "tables_bundle-p434" (see tables.h). tables_load_p434() must succeed before any other function of the library is called.
+
+#define TABLES_HUGEPAGES          1      // Put the tables in huge pages
+#define TABLES_PREFAULT           2      // Map all the pages of the tables at load time
+
+// Maps the bundle file at path read-only and points the tables at it
+// Returns 0 on success, or -1 if the file cannot be mapped or was not generated for this library
+int tables_load_p434(const char* path, unsigned int flags);
+
+// Unmaps the bundle
+void tables_unload_p434(void);
+#endif
+
+
 #endif
\ No newline at end of file
@@ -628,27 +628,6 @@ const unsigned int strat_Alice[MAX_Alice-1] = {
 const unsigned int strat_Bob[MAX_Bob-1] = { 
     66, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 32, 16, 8, 4, 3, 1, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
 
-// Fixed traversal strategies for Pohlig-Hellman discrete logs
-const unsigned int ph2_path[PLEN_2] = {
-#ifdef COMPRESSED_TABLES
-    #ifdef ELL2_TORUS
-        #if (W_2 == 4)
-            0, 0, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 13, 13, 13, 14, 14, 15, 16, 17, 18, 19, 19, 19, 19, 20, 21, 22, 22, 23, 24, 25, 26, 27, 27, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 34, 34, 35
-        #endif
-    #endif        
-#endif
-};
-
-const unsigned int ph3_path[PLEN_3] = {
-#ifdef COMPRESSED_TABLES
-    #ifdef ELL3_FULL_SIGNED
-        #if (W_3 == 3)
-            0, 0, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 13, 13, 13, 13, 14, 15, 16, 17, 18, 19, 19, 19, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 28, 28, 28, 28, 28            
-        #endif
-    #endif   
-#endif
-};
-
 // Entangled bases related static tables and parameters
 
 // Constants u and u0 where u = u0^2 in F_{p^2} \ F_p used in entagled basis generation
@@ -798,6 +777,26 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 {0x3945471CC48EF6BB,0x7C3FB717D0165DC8,0x92F83793BFEBC75A,0xD5BF95D93BFE5316,0x209E198DB1F16A4,0xE2086C62914F403A,0x19D6352AA2CC,0xBFFF0BF092E15611,0xFA429EEA322007B3,0x99EFB4184EBBD84C,0xF6C5230835D383A8,0xF1CD8283C93674AF,0x41C64F9EA1AC8458,0x2CD68D0A2571},
 {0x570C567E928211B1,0x70459EE4560443C6,0x1FC204B885DBB2C0,0x7C99D3BCAF19BE0E,0x5BFFD67B5AA530E7,0xF8701F7AE35B9C57,0xF056DF1DFCBE,0x4183962A42D28AD1,0xFF8B6A5752A5FAEB,0xA4B714F92FE41B11,0x8CC5D5EEFFAFB58B,0xA53A15C837E4CFC9,0x1A79CF6122569F16,0x1FE4DB81AE342}};
 
+// The ell=3 Pohlig-Hellman tables depend on whether W_3 divides eB
+#if (OBOB_EXPON % W_3 == 0)
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T,                DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#else
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T1,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)        \
+    X(ph3_T2,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#endif
+
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(T_tate3,              (6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD)        \
+    X(T_tate2_firststep_P,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_P,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(T_tate2_firststep_Q,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_Q,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(ph2_CT,               DLEN_2 * (ELL2_W >> 1) * NWORDS64_FIELD)            \
+    PH3_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy434
 #define fpzero                        fpzero434
@@ -822,11 +821,14 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2div2                       fp2div2_434
 #define fp2correction                 fp2correction434
 #define fp2mul_mont                   fp2mul434_mont
+#define fp2mul_add_mont               fp2mul_add434_mont
+#define fp2mulsub_mont                fp2mulsub434_mont
 #define fp2sqr_mont                   fp2sqr434_mont
 #define fp2inv_mont                   fp2inv434_mont
 #define fp2inv_mont_bingcd            fp2inv434_mont_bingcd
 #define fpequal_non_constant_time     fpequal434_non_constant_time
 #define mp_add_asm                    mp_add434_asm
+#define mp_addx2_asm                  mp_add434x2_asm
 #define mp_subaddx2_asm               mp_subadd434x2_asm
 #define mp_dblsubx2_asm               mp_dblsub434x2_asm
 #define random_mod_order_A            random_mod_order_A_SIDHp434
@@ -838,12 +840,30 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp434_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp434_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp434_compressed
+#define tables_load                   tables_load_p434_compressed
+#define tables_unload                 tables_unload_p434_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp434_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp434_Compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp434_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp434_compressed
+#define sidh_workspace_size           sidh_workspace_size_p434_compressed
+#define sidh_set_checkpoint           sidh_set_checkpoint_p434_compressed
+#define sidh_get_checkpoint           sidh_get_checkpoint_p434_compressed
+#define sidh_set_dlog_threads         sidh_set_dlog_threads_p434_compressed
+#define sidh_get_dlog_threads         sidh_get_dlog_threads_p434_compressed
+#define sidh_workers_stop             sidh_workers_stop_p434_compressed
 
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
 #include "../compression/torsion_basis.c"
-#include "P434_compressed_pair_tables.c"
+#if !defined(TABLE_BUNDLE)
+    #include "P434_compressed_pair_tables.c"
+#endif
 #include "../compression/pairing.c"
 #include "P434_compressed_dlog_tables.c"
 #include "../compression/dlog.c"
@@ -0,0 +1,3292 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the windowed fixed-base key generation of SIDHp434
+*           Generated by precomp_gen -w 4, see tests/precomp_gen.c for their contents
+*********************************************************************************************/
+
+#if defined(PRECOMP_WINDOW)
+#if (PRECOMP_WINDOW == 4)
+
+const uint64_t window_for_Alice[(1 + WINDOW_LEN_ALICE * WINDOW_POINTS) * 2 * NWORDS64_FIELD] = {
+0x9c1297ed6575b603, 0xd87843c892ad5b08, 0xec683b76c34738ab, 0x5bfb459aa5ef8a61, 0x6a009867d213d540, 0x39af123946f86c06, 0x19f2d01294057,
+0x6d220de432e0d54f, 0xf3754057c62bc64d, 0x3a9e6c9052fa9b0d, 0x2faec4851df37617, 0x26a15b229a35d893, 0xf8ff0fb2aa576493, 0x11cd53fbc5a7f,
+0x6448cb5bd9770d67, 0x3092cf8c8803d8b4, 0x2542331c81c2c2f8, 0x8066dfbff024aa32, 0x5f4e163cd158e1a, 0x87c8b0ac7ff6b89f, 0x18466971777fb,
+0x414795f6a70d543e, 0xdc7d2e0b9229a814, 0x679cd711c5b2ac8e, 0xcc92a943030f0d18, 0xc2bb3cda074e0076, 0x19332e71dc423ba4, 0x1c95a2fc045dd,
+0x750fcd24d96f498d, 0xe74b7652658b6360, 0x54fb85d2945c71ad, 0xa530239b59d34b1a, 0x5e729db52488a584, 0x8ef15300fccb833, 0xcf9b1759a390,
+0xb751c3b1450c3cfb, 0xfcd2cdcdc975a71c, 0xb205ae03102da534, 0x2a92457afe850487, 0x11c5de0150bb9277, 0x92583fabf57b00b, 0x1db45e9f74ba0,
+0xf0454414bb64cab3, 0xbd12af2dc677fd69, 0xd5e9b649a53c04dd, 0xd59830134a6c770b, 0x84f8c2bc2bd0e377, 0xf630c75232d41200, 0x1fb17dc02e5a,
+0x698a75a7b155ea2b, 0xefda763ce7a97129, 0xea32cc147e781533, 0x3d655adb795f7466, 0x6ad731b4a054cc2a, 0x5a025496dbffaa71, 0x1db88c8497e56,
+0x78b9c0b9a3bd2967, 0x71cb2bc7320553c6, 0x316f5c32407bd0a7, 0xe55d1af3ce7a86a1, 0xada2be65bc44f08b, 0x6dfece85dfca3c66, 0x1fc0e23853261,
+0x2ddd455d97f32363, 0x46045c35f348d058, 0xebed02f21182f5e7, 0x945ce83599bb7c39, 0xbffc17b98d65562a, 0xf2939b5ba82e954, 0xa00560c80c10,
+0xe4235429a701044f, 0xb7abf16498e1c383, 0x649d81de550c763, 0x5b98e18d35b33513, 0x169c649857ac65b5, 0xa1aadb269a69a3af, 0xcd15e9029e31,
+0x3b1945593d183cf7, 0x6ac2163fbc6a75c6, 0x6fa605356496d9b5, 0xec596b526a397a3f, 0xe05a2d58b3d34811, 0xde43935075a62de3, 0xdf96d9e5d1ac,
+0x62e462dac2c22105, 0x5e0bef68824ece75, 0x92d5cd9add991fad, 0x56258b9f6e25f68b, 0x61bbc0f25a68fc33, 0x8bf7565bf7156824, 0x1640d31ac325c,
+0x9bf47978f366b266, 0x1328c5dd818d363a, 0x28a4e826ad763d4e, 0xef0dc71ddde02aa5, 0x326a3e5f2a4fe8ac, 0x6bb2d12096a3c440, 0x19868caf4c6b,
+0x940856bcff6b6a44, 0x4cee04d5fb88ee5b, 0xf6e9edc2af9a4099, 0x59708cf0d846414e, 0xd31c1e8645cd65cd, 0x83843205bf5e393a, 0x948d7dd4b0b1,
+0x3fad7947e86dc1a7, 0x3050da807ac381ab, 0x8d5b7774a4d8029d, 0x9de647da0ab5652f, 0x51313fa5da7b9248, 0x950c074170631b89, 0x1fa22ac5d922f,
+0x976ccc8431fb6c34, 0x8c8284af61466cbb, 0xb0af134d7b823472, 0x1a04747e8b17faf1, 0x5e2440d685e770e9, 0x3ddb066db9b420c9, 0x625f7441ac17,
+0x7cfa008777ad43f9, 0xa4b6c0632363d1ae, 0x9336e4719a6d77fc, 0x5eabf971d76f3f31, 0x626fab5a44137369, 0xf40400cbd713fccb, 0x14f6a0cdb44dc,
+0x7d4383656b51239e, 0x711698239bb2b06f, 0xb22fdf8d4437f87f, 0x4c2d63d67a6eff3a, 0x246a5cc93c31b6e7, 0xf548071fc6e9e6a6, 0x1d3aa259ed380,
+0xce05c9f3278a6329, 0xb526c34d1bdb8e3b, 0x1c150a42eba60d7f, 0xb5d274018eba363, 0x2a954d94decb5e2a, 0x3c8e113aadd28548, 0x2072408753098,
+0x16f0a8a3c5995361, 0xdfaa71bdfab28733, 0x81145e2d1bbb697d, 0xb9b9eb77e52d0440, 0xf84a6b4df896ee86, 0xfaef67d4f373829f, 0x5e66463f85b,
+0x5a7ee0564c466954, 0x83fa0a385b4634c6, 0x1ad767ed3f60b36, 0x6e85bc46cde67099, 0xc96c5206a99ca199, 0xf6a8cb760b2fd0c2, 0x127ed142d438a,
+0x54984681e6bf4c9a, 0xf6c0d212dc09b6f1, 0xc1b736a289b50f36, 0xc4d6cc40306f2740, 0x27bbda4f3035306a, 0xb1e2c0cf16c07cd2, 0x13f9bc8f168ce,
+0xd8bd6912345944ae, 0xc3f455115af0a901, 0xdad1797fc5ca2c44, 0x1d64f9d5193c44b6, 0xfd371cd488912489, 0x5fbaf54cad011b96, 0xd6de79353ceb,
+0x7eba8057e3ce2c0a, 0xf7495c2b2ed253ab, 0x5b761a3b4858758e, 0x37b3b08c27cd3145, 0x67abb204fcca1fb9, 0x721a196e3fafd388, 0x77f618d3a5c6,
+0x81960073b3be79c6, 0x98b6c9709fbdf683, 0x6aa7906eb3e1575e, 0xff956f474cd58378, 0x2a648ed6874d12ea, 0x13d9bddebffb84cd, 0x16566cbc7b86c,
+0x55d4039136a97840, 0x3af68fa6e6ddc1c5, 0x7ffbe726f81b4163, 0x62b3f2760cfc0017, 0x230ee41a9ba8f9d1, 0xc8493cfff85b480, 0x1fe7b04d0baaa,
+0xdca36b69d65a3b3f, 0xa35e7a6b704693d2, 0x9cd7ecf1dd6a490, 0x8845a426e44a51c3, 0x3dca29861606a720, 0xd82a32d75872e4e7, 0x1541485309b64,
+0x9f89e9e1ed27ae81, 0x8b1537127ad1f686, 0x4efaed6802022b09, 0xcf46cd96d7dd89a0, 0x12f1d808d65c0a2e, 0xe569a68a93fc0a25, 0x21c07fdf9aab6,
+0x740435503743a0cd, 0x3859707a05920495, 0x3c0834379266d48b, 0x46a434734a9e0ee2, 0x4740a6e73239248d, 0x3a4c199f5202f20f, 0xa30ba31c5415,
+0x8d77fa34cb896a63, 0x7e2fc0635acda0d0, 0x19efe0cccfc9a3cd, 0x47c1ec945ddbce00, 0xb3116fb84f82c190, 0xc57b52e265dd3bef, 0x13061d9694d7,
+0xd82d5ad334ad6969, 0xb04c424eede4a5fb, 0x77c7e67672c8e5a2, 0x3fa7b42f8f610511, 0xe122684064e9a601, 0x906566a8bd3e7ecc, 0x233755956a660,
+0xff1d65ca3cec7022, 0xb42f77a4ecd38fdd, 0x10d4a99ef3c7a955, 0x1b2303d6b0fd913e, 0xa572de48da807a48, 0x502f9a6e3e3a37e8, 0x37cc76c9cafa,
+0x2780b7621b977d32, 0x7c0def25cd7ea965, 0x4dd4316eeeb248a1, 0x305ac1cbf3aaae7d, 0x76ee1b4562b0b550, 0x448b64f5350db407, 0x5445283d28b8,
+0xebecb7300254b1e1, 0xd0ba966a73b96166, 0x6a80f889da560535, 0xba5f9ab3ff24bf95, 0x83ed7166fcd75963, 0xbdac93405d97a232, 0xd861c6b948f9,
+0xe3be6182e764f224, 0x207eec37228e7dde, 0xe63ced9839ea5fe0, 0x25c5dec25fdd4617, 0x1f8e938e85b1cdb7, 0x75274b7a209fc0e6, 0x1839f3198378e,
+0x5268f0a8a4481034, 0xa2b03cb91ce60e27, 0xf1ab5483f0a6ba72, 0x5a1c0086596e4a84, 0xcb552add24144b39, 0xe02f911fdd42dcdd, 0x122516fa86470,
+0x64eb36205f0277af, 0x74873f48268ca31d, 0xa3645d44d7feb8c0, 0xadef168f4b1677bd, 0x396dcb9f5723da8e, 0xef60aa35e607cc09, 0x7b83d32f2d1d,
+0x5bc1e231775db25d, 0xbd14aab4ef0f7d0e, 0xb16b666a646cdd6d, 0xa4b23b30157407a5, 0xcc196db00baeceb0, 0x823c20c85890ba32, 0x166d4ce5942eb,
+0x92e0cd7eac79931d, 0x98ac6027e2e6e739, 0x7c5b6749716ed8f0, 0x9587208313a6421a, 0x1a264889f1ab32c6, 0x986d989217672862, 0x6f058ad03407,
+0xc01ea34f26af66f6, 0x9565e711c5933711, 0x7b1ed6b038150698, 0x459be71ff95671a5, 0x2867098ddca18eba, 0x22374543d71cc8d4, 0x22c0165f614e2,
+0x6f7e12281fbb356b, 0xd3818bbab597e47f, 0xd03a08cc0a1fcd11, 0xc37df716d6f73275, 0x32d506a5a16221db, 0xfb21ec0487696805, 0xd9db12738ac6,
+0xf740ebe42f89b604, 0x9cd693bb6429935, 0x190cc216054bfb8, 0x789494067d0e8f86, 0x22cc1c7e9e2e7b06, 0xb82af83545a88172, 0x139a6e720727c,
+0x847599e9b3546644, 0xc7641ef93482cdf6, 0x8b69ee0b7f18ee8d, 0xeba26074e16632cc, 0x68e0e9c432d3cab0, 0x732a8c0a079e563c, 0xc230b14f21ad,
+0x60cf5ae941443ea2, 0xc6e42306ee49d934, 0xa49fe5c02676144b, 0xa575ef6eb8c9247a, 0xefd77e3d05496119, 0x53fff6623fa342ef, 0x41efe5f63eb1,
+0xf44c645598042ec, 0x342309f6689b6ead, 0x7b178cb11ef3b2e3, 0x55b0aeb8d41b5daf, 0x5b3640810e1c3654, 0xa4d94e731de7326d, 0x1b70e96d5c04b,
+0x3f0d55442df08455, 0xc6fcfd68c4543df4, 0xe8fdda0b8b397428, 0x553102bc463b8655, 0xe5fba8dfdbd0ee7b, 0x2259d7a195d96b6f, 0xae763e0e16f1,
+0x7c873a06f4e87392, 0x483291d3c46e6149, 0x630fcf37481539b1, 0x55749a6554255c40, 0xe93bd8e4541a00ba, 0xd6052323e9ab7dbc, 0x1d9e8e2b76ace,
+0xeab820ad34ddbc66, 0xaa4a36591abc3a, 0x827bd61dbb427d4b, 0xa727c276c9ca3706, 0xb952c713205bda74, 0xb4f3f5d3555776c3, 0x1089e84998e2c,
+0x666fa41e3b1d869, 0xd46366922d1c618f, 0xfa39d4fc16442687, 0x3652c8676d7b51ec, 0xf2840be091217a50, 0x5a105d6c13b78266, 0x98034b23e80d,
+0xdf2b4548743715bf, 0x9268b38dfd438939, 0x7dae35a982f81b15, 0x48e6e1bae47cb63, 0x876c47f9fe1327ca, 0xbcab655b30fec34b, 0x3b5304ceb7b1,
+0x80d790d6cd90051f, 0x5e53aa57aec02319, 0xd69308d57ae79478, 0x23fdf4f1af8a46e7, 0x2e89de2454c243a9, 0x6a94e92c3953de14, 0x3db325f1cbbb,
+0x4a53de0f953c2f8b, 0x5b5beec436694efa, 0xb923fad75e3978bd, 0xe571bf83326a56f1, 0xfa7c04487d824e44, 0x2dd981bf3e91b70e, 0x2a92530d165c,
+0x38ab2717db6b3f5f, 0x287889808b902826, 0xeb3054c06dc2bb62, 0x91e244b5d262e605, 0x727862938f34e83b, 0x9dfcf84bd049fdcd, 0x19cfa49e3a937,
+0xc4e6bc3a3d706460, 0x4d8dcb3f75de3b29, 0x91eca14416c9b68f, 0xa55c976b4fdcc131, 0xfe1be4256493bb82, 0x9b2e3be7e8ca8cf4, 0xc06bb5245f4a,
+0xfdfb22d1e0dd2a3f, 0xfcb01bda829f200e, 0x84b51e0cc1d2fb53, 0xf15c6958611bf817, 0x58744bef9689099a, 0x909916e54ffb584f, 0x2a27239ed39f,
+0xb35e093f4e6b7fff, 0x1352513f0cc80d40, 0xa28de5bedf1418a5, 0xe92ba2a8f5c28393, 0x4c3efb2fe644cdbd, 0x651dcc64ff4ad631, 0x6d1b149c7161,
+0x80eb0045a1893db, 0x2c1ed465bd7cb62d, 0x2d28279809c3ad81, 0x3c953771b9303d7e, 0x89b0ee7c4c5be4d8, 0x3d8473d5edc005f2, 0x1c0a4d0068ea3,
+0x28e95ff931e782ea, 0xce265895f7248b17, 0xebd5c269bb8aa02, 0x64f8ce0f3f15d915, 0x348e11bf18bce839, 0xcb5df4c4c67a7071, 0xb7fc7a510cd7,
+0x703e1d5610487793, 0x1cdd2d31e49c7850, 0xe711c65021dc25ad, 0x718c49134ab46828, 0x15666900d106643c, 0x1faee86c8dc64155, 0x986ac8e74782,
+0xc2cb76d133b1b527, 0xe14b857026217174, 0xb1d5b15d4fdbe3a1, 0xc6c739bfd52a667d, 0x96638cc558f1bee2, 0xddf4aeb764d78da8, 0xef14f982309c,
+0xb550c55f4d77289f, 0x90e46b74978dd3dc, 0x15b6cad13732d969, 0xda3249ee82ef6149, 0x727f531a152b45b1, 0x2d3a0c72e2d30a57, 0xe2096f122244,
+0x9bb49112e1992786, 0xff567e8a6a208cc3, 0xe82b79721517c379, 0x3d25b6e13998867b, 0x2b1759ec761146e5, 0x848b6c4c60858b, 0x1581e213be60b,
+0xfaa58ab579dc241d, 0xdb9ad8adf806e6c1, 0x8dd926e84e3c8530, 0x21a6ab3dc79e86b, 0x815e030f6666ef52, 0x83273e8f1fec66d7, 0x910f40660d28,
+0xd3696e6951eac453, 0x8d3a301b3d438d24, 0xc92ae0676c6f85f6, 0xf08d5878e41056cb, 0x5f01d4cc3f1c6991, 0x7a46cb006e86fcf9, 0x1acb66191b170,
+0x5dab8f66abc12f71, 0xd31adc09529629fd, 0xca5462533f93ebf4, 0x1fd9239820b35ef2, 0xc4006db9d099e737, 0xd33f192f3c60176f, 0x194c33cce9747,
+0xf2af68a9b8afa32f, 0x521ee1d1c0db311d, 0x9e2bdd4c087f4f3e, 0x832916836385230a, 0x26b0a9e9eae76c8, 0xe00c70883a0547e6, 0x12e79e77d9e22,
+0x70fda426ce6a0f68, 0x3d64884a5a3eaa6e, 0xc47ec211a41fb989, 0x294d92bf445d8069, 0xdfe4177fc02174a0, 0x67c613d78ff8bdd8, 0x1fde4b165372d,
+0xd6d341aa9c65fa0a, 0x269ce4da19787a0f, 0x5c40364fbedb730d, 0x1e5bddf054c72eda, 0xdae41efa9fd3de60, 0xb9e24619e36b6bba, 0x15662a66f5914,
+0x5cd18c2f5d6c35c4, 0x9bed59102c378ccb, 0x2d42af0d2a5d691f, 0xdacee58a11f684a1, 0x197c8d9ea914e123, 0xfe0106c5a328b9dc, 0xf9958e1dd8eb,
+0x692d8d622cbcfd69, 0xd0296419e1792c8b, 0xff3ee3225596aaba, 0x5cd2d8aeae9b7c7f, 0x6fb8e1e6d9838e4f, 0x6cf583b832a84a61, 0x212c980146806,
+0xf7d747321ff89197, 0x547f1cfec73ad72f, 0x266cc1e1d5b4eda3, 0xd54d00be8113c933, 0x5a52b51652dc372e, 0x79274573187af316, 0x1513a947bd731,
+0xa6a9c4c28c9ba0f7, 0x5537ae9933281180, 0xe69eca28c12dd17d, 0x1b58298a558b34c, 0x24d547dc79cac398, 0x943d7bb9d3ba086c, 0x39f54164a34d,
+0x3bca928509bf8d09, 0x1eec4b75b254bee8, 0x67a8077c511cdf52, 0x85710ba1754d85e5, 0x202c0536f7f68bf3, 0x8bd300779d2a8a79, 0x19187dd2cca19,
+0x70693cc42e9c22cb, 0x444de366f153a62b, 0x2c65a65119916e4b, 0x61272e48ea2b545, 0x3fa21ea083102343, 0x158d8f5c2cf93c62, 0x208894f37dac3,
+0x17172eb175fa034c, 0x509f5353bb1639d9, 0xe6ddedc78e48e36f, 0xe97f71fc8773b632, 0xcbb6b3d460cb586b, 0x1ca06ef5b9d8cd27, 0x4f72917ee10a,
+0x99766c73104fdd34, 0xa0ec15986b4e96bf, 0x56fd2630b8fe894d, 0x37f6e0a38f687de4, 0x7155f8f92bd9cf3a, 0x10bad4a97a19c91d, 0x2d12f4f62d7c,
+0xbeec749eb21ad7b3, 0x7e4a5802af46e40e, 0xcbbdb4823045a57, 0x16c2aaf84ac0a36d, 0x73fcb5d8c923a60c, 0xc81696869435882c, 0xe7fbac22a3a8,
+0xe020bb20402ae1b7, 0xbb60433902ec922c, 0x41e01bfa6055e61c, 0xd791af46ef9ca63a, 0x61cfc03e8695a24b, 0xe2524d8c41448b3, 0x127a2dfe86d0f,
+0x785878abff5b10cd, 0x241c31cd969c1e40, 0x67d826bd13bd9609, 0xe6c6f00b44998e06, 0x7b36e4db28b7999f, 0xfe7db62ac4012854, 0x579d0eeb6d56,
+0x41a4ed30ec2fd6d2, 0x6f4f33f1dfa7bf02, 0xa16566c4777235d6, 0xfd44080ea8c722af, 0xd963eab2130773c1, 0x6f033ceacd092ae4, 0xc1a12d2a919f,
+0xc14be4b32cd27431, 0xa5ae85cc86fff948, 0xdec4676fca686878, 0xeeb5432619a53d3a, 0xab8cc2cab6f98851, 0x32371831875b86a, 0x2052233782a4b,
+0xf69dd609b8973e0e, 0xef7b96e35ce7479f, 0x7d7076d076d6a680, 0x7c69f503c588ca14, 0xa360b5a36206f4f7, 0xb615beabdb8504d5, 0x1c2deabc77a3a,
+0xba79b17d00e1b82e, 0x88d72da553d26b23, 0x11c0ec01718ce182, 0xe9c66b27ed368ece, 0xc0222a9fa1a02e9a, 0xcdb527195fc79c64, 0x9ff031331dab,
+0xc037d6a33ef2720d, 0x6f20caf2f602b7ca, 0x9911fc875a9e74af, 0x5d065ca257c9f9e3, 0xbb0379632128d77, 0xbf23b008e28f4c8b, 0x1b71e04a2a09e,
+0x9288c05fe2d5512d, 0xc3053017bad64546, 0x93cede50a6760ac5, 0xad11eda93a35be8e, 0x853d04d1aaf06ecb, 0x539f112fb703947a, 0x1b3c4242e3878,
+0x57313be0b46dfc2d, 0x343a57f9c7b6b1c2, 0xf2a45ac2892c03e4, 0x23909fbf7223eba5, 0xc10908607976a522, 0xc49ba52b02c6fcfa, 0x114da5fcc2d90,
+0x22446b8b29742d01, 0x3a5996204b99ba28, 0x761d3dcea38f5bf8, 0xe130eccc6047ec05, 0x9e5f5ba6426a30c4, 0x2eed2fa4c9b94249, 0xe50fa560de07,
+0x7f8582b40c06e6f0, 0x93ddbbca56f6253c, 0x21e36c546318267b, 0x2947f29d0cd45b28, 0x8ab2174c37cb3a58, 0xdb7d8e7df8b2f07b, 0x2113a4594938a,
+0x43b51bfed866e122, 0x3443c49e25c3e0d2, 0xe761e6eb1c0e0b0b, 0x765ea01558ad6aa8, 0x79c80fb327ff700e, 0xe62947a8d917071b, 0x3156e538ad6d,
+0x412b18ec6f79aee1, 0xc453696b942d9b2a, 0x328cae3edc713421, 0xe3c678dddf3b62a3, 0xd431189eb47ec53, 0x8788ba0bc3aa96c, 0x7efd85b9dc21,
+0xc1b9ec0d2b53d5, 0x18388b16a49a5c91, 0xc8ca529c1fdcd39a, 0x5dcf4bd159366ae7, 0xe25842501a007335, 0x42336169f63ffd92, 0x2033b3e9b2ca1,
+0x982b36bb77c84893, 0x21351ab71bb1755b, 0xd170325d69937e8e, 0xc9ffc37128f13c3c, 0x2bb1ea58b3e3b52b, 0x497fc1c7db647619, 0x1bff4f5970419,
+0xa849c7da82eafd6a, 0x432f43e215122330, 0xe0697ee4307e6357, 0x8afa2c96d5906b08, 0x62910bcc532aba04, 0x8365333f5666343f, 0x17ab82a1c17db,
+0x9e8b6d6ed4f2013b, 0x26b43c36da612dd9, 0x15b847b36354d5d3, 0xa973422cc6c26bbc, 0x9090c35e8c528be1, 0xac6900114d2426ef, 0x222e4eb1a855d,
+0x368debfe21c9f228, 0x7da13c45615e58b4, 0x7a1eef8121cf946e, 0x1389b603541060b7, 0x35939f7c849fad98, 0x5612d5495886080a, 0x126d9f7666c62,
+0xeed7e0fb3621983a, 0x33bda2e28261728a, 0x8a4dee14e2328f09, 0x12e60e667819c1ba, 0x27baf7f5264b3a43, 0xf0f9fe2b64118362, 0x773a5adb7c83,
+0xd351cc17a270b63b, 0xffd0d7ac66c934f3, 0xd349c8b34c8292c0, 0xe2bd8a2e53058324, 0xb2e8e72e1b84d7ca, 0xbef9450dc6789304, 0x4f0d6094b53c,
+0xae7ae0e86c75f5ff, 0x5f731a8e705cde2, 0x58d769f2e36ff7de, 0x695c5ea9378a6292, 0x3800f94f79ed92d7, 0x95571f8c30fcc4b2, 0xf95830b84254,
+0x736df6fcafee78ce, 0x4187189b5dc95a2f, 0x624ac9761f193886, 0xddb9d8115854f372, 0xc0a14effc8b7cfb1, 0x98ab4109abb6b169, 0x9a3b57476653,
+0xd6cc5a3c59c4c273, 0xf35c81cb70cd1de8, 0x6147c168c246722, 0xfbfefe118d386f7d, 0x919d8aae011200df, 0xd8df6e145b27386f, 0x7bcae203df81,
+0x8e35cac20b98b28, 0x9a740cb1bdde0493, 0x65b7826b4102cfe7, 0x82f40d90bac5cc14, 0xbd766f991c0ae4b, 0x488f8c8988692f73, 0x88738f24af4e,
+0x376e4dff52119116, 0x9696c7f550565ee9, 0x590992a9fce784b, 0xaf1fb910fa2fd49d, 0x548800f5f3f38824, 0x21e5570ae4790f47, 0x1e704a0d8d6a6,
+0x897700df212fa514, 0x9a936a075b501969, 0x4e4cd92decfdabff, 0xe7ef079cb9d768cf, 0xa2c20610122d8fef, 0xb398207a3df1d671, 0x133a24f39830b,
+0x9899f2859d0d74f6, 0x6b291b2b028c43ea, 0xf935007d9bd05d50, 0x9ae61b9bf9785f80, 0xdfb5a28b6e79f960, 0xac2077a4c8a1f576, 0xbd5b93b33eac,
+0x7fa415686681a316, 0x8147d1facfab4d88, 0xb61fc0cac01ad9a1, 0xb40fadda6c13c3e7, 0x955e0a193900c9e0, 0x3e3f030f4bb28779, 0x221ed1307c809,
+0x8839927af53f1372, 0xdb5e77050b6270a8, 0xdf500c79f8d3e234, 0x7397e4af21489137, 0xfb074f540cf5b358, 0x24937d8b699276a4, 0xe2beb58e1f43,
+0x6c09eebc3b808501, 0xd08f5ccbe480b4da, 0x18a7da53e2fa206e, 0xd1475aef5ff06038, 0x224c25d316f1bddd, 0x9df5fbf015f68464, 0xf6cf4101cb6f,
+0x61b95121f6f136ee, 0xb8e394b8575395aa, 0xa60fb335cf2576cd, 0x1988e3cfe3d0a3a3, 0x1564ea19074819c2, 0x1ad9b0b447e617a1, 0xa3d6f5a393b5,
+0x8ebf77a9820f2b8f, 0x4b68232c4a544102, 0x65a35ba89e304cee, 0xf201ea7d16058d27, 0x9da50d298bbc49e6, 0xe2b7edf305aed610, 0x1b3cb8de620c2,
+0x198f5667a0e138f8, 0x4f62a14a97461b2a, 0xd3d09fb9399c20ca, 0xa9524b1633d51195, 0xcfe7be09a17a4245, 0x7ae11e6c2c52fcb9, 0x19c4010fdbcae,
+0x95bc946838aac201, 0xad9a07460dff3e38, 0x602147c9e7d43d33, 0xfb96e57121f7fd30, 0xf50b837a81f12caf, 0x549a3fe62ba14efd, 0x25d3fed0bfae,
+0x2873ebe7cd493ddd, 0x25b7ca16bdaf4afd, 0xb657c7219073223f, 0x1bec67346c43f917, 0xe055d5382eae79e0, 0x4d8a9a065b855e49, 0x1af98c91cd30f,
+0xf2d3800e474fbb9b, 0x5df7c2191b433f18, 0xdab3ae5523b18a4b, 0x2f8c3c7b06da87f9, 0x5381ed7413429818, 0x8cc96a54e085237c, 0x20e58320c07e3,
+0x5650ed0e7b939b20, 0x525c840738e1c9d0, 0x53271414c7578711, 0xe774124034cb0da6, 0x2173cf6aed4b9b03, 0x9c55d10ea2399a88, 0x878e76ca02fd,
+0x7fb6b9f4a1232dee, 0x625c61ffa3fa6fa7, 0xfa7e4499858b5a35, 0xbdb6df98c032c2df, 0x921e68e635bbbb0d, 0x15f5f5e33616d2c5, 0x17076b515abc0,
+0x7cbeda0d1c4a3c89, 0x73982ccb1483e281, 0xe9491fa9e44dd5cf, 0x21f21468b1529d56, 0x5a07c4a4e06272d3, 0x91457a1a621d82b2, 0x4e8d79c862ea,
+0x2d06358cc797517d, 0x519ce99e9ad2e651, 0x5a1152dac27737f5, 0x1c578ff76395f74d, 0x3d50703cd3d6ccda, 0x4039de47b66f300a, 0x929578724da2,
+0x7c2ddd9cabe3d79d, 0x65c2bf2887896256, 0xe66da7fefa632e85, 0x5f1702be2ab5e6e, 0xf71b1294f51d2908, 0x1806425b9cca7bab, 0x11fbab6bab91b,
+0x4e786cec5f5b478d, 0x688d27c322a1fe52, 0xe031deea97f5e5bc, 0x702bb19902b0ef6f, 0xa3ebbd1ed931dd36, 0xcf4e0558e742b04c, 0x6d5d4388338a,
+0x1ae924494d652c7b, 0x1bdd23ac80cdfd2f, 0x175180e5e82da239, 0x6f064630851a4066, 0x65b6a6a93ced5f7d, 0xce0464319372d39d, 0x259b571f440c,
+0x512470b41f535eca, 0xe282291f1dff8cb9, 0xaae4a6ce1b984b4b, 0x7e72f2706e9129f, 0x88c0219980a54ac8, 0xc9c074c4faba25c2, 0xa12a881d5c33,
+0x4ed3669df211ce2f, 0xa947f59fb6d56130, 0x5638c08919f3e836, 0xc752fade9cc53f0c, 0xa0f96535831e8618, 0xfc2ab5351383c7a1, 0x592d92b69080,
+0x6e5d4dba90cea065, 0xf18827a2148f9149, 0x2d95c2b574eee1c6, 0xe45df60ba50cd91d, 0xf186c5fb7061474f, 0x748912dfbe7e289c, 0x12c5d5f96ee84,
+0x112166b515ba4d19, 0x86ec702af6897d6, 0x15a1e4a44d712a9b, 0x7992f8b85fd31c2a, 0xa11306eae3e7ffee, 0xb886f4d254477e21, 0x8989e6aa5b25,
+0x6840e0ace4b22049, 0xfb9993eacc8508, 0xfae632398f41f6e3, 0x6eec63929229aabf, 0x67b8c615a76c3fc3, 0x6735eea6b63db765, 0x10c989056cd98,
+0x7716fc6867804be3, 0xf6fdbda336d4de92, 0x8dbc2ebb61a041f9, 0x915281ffb6dd49cb, 0x5e44851d66c9870d, 0xf2d040101f7bc970, 0x5d6993609ee2,
+0x5245ce3de7d2e7ff, 0x7947fcbd889a30ab, 0x4699d5a90582b4b6, 0x36d3f89452995812, 0xfa57d6056a682302, 0x9e65d4161b0209b7, 0x36f7a8920c8d,
+0xae520b158a1ff06c, 0x80a75bf1a049cf, 0xcb34f7c15c6ef9d2, 0x37bd230485704a36, 0x371d40187c0f944e, 0xdbc6c6f6859511c2, 0x22cc2104afb41,
+0xc4f21c38c5b85958, 0x77fc5a339ed63183, 0x7149b5d638a75e1f, 0x8384f5a1b6181170, 0x195ffd7abab3096f, 0xf85f05d350a77aaa, 0x119e4dd8ca9c9,
+0x24903a617c32d670, 0x9eade27759a65fa3, 0x5808e6c06af433da, 0xc22ae258ee7e8778, 0x4e8c6c1ee9b0112a, 0xdf8dde8fe4c77d3d, 0x48685d4a6f00,
+0x81c46ce63870f2c1, 0xe3371eee83a3c005, 0x66f3c6e45c18556d, 0x4434182f4599887d, 0xe7e0b19c53fd514a, 0x7cea9f72cf9732c, 0x1892e7be236c5,
+0xe5784d46cc9cdf17, 0x7d1d62650c86d7cc, 0xf48997afcf66adfb, 0xa63f1a0534c9e524, 0xc737f0fdcf49e5e8, 0x88826872cf48a5e4, 0x84509cc5f749,
+0x70073633b6608af9, 0xb91e00bfa3ee6aca, 0x8f94edae607c8adc, 0x200c3cf9d4c6a779, 0xc80a8b0fd5e5ecd5, 0x55929f0136d66158, 0x1936db79f618f,
+0xd9e3be7f1b631de6, 0x8e7e115355d70103, 0x4f4e9e0736d537a4, 0xab86378357c8328e, 0x9ec1799846a36062, 0xeedb49cf02d60bcb, 0x34240f306843,
+0x4a98a54e02671b7d, 0x72d1201db3711cdb, 0x10362c18b232dcca, 0x84f4d9692f1aa177, 0xa7ff012f3bec4b5b, 0xb6464147247bacf8, 0x2111e3815f923,
+0xeeae7e7259bcb358, 0x18af927d1101692e, 0x78987e28398d7c06, 0x3af66c5f09a98ccb, 0xdf2555d6732d3eb8, 0x6c92e1bf5f717600, 0x138e67ef2a448,
+0xf8319f1300f7d2dd, 0x91939965262f1b40, 0x51891307fa41820, 0xded0aaf0e9a4011a, 0xa991918474e277ae, 0xc8341ffc284ad381, 0x1011f23114641,
+0xfdf18a82ae328a5c, 0x94fec8b21f0697f8, 0xd71081b000f4a31b, 0x1e27e2e01e34b31, 0xe4779b8349b3e1c3, 0x61f14b7d1b321500, 0x1386866cd4503,
+0x86ea27beb4878ae1, 0x38eebb38b62e2285, 0x542724ec865e05af, 0x24c8b1a34e726050, 0x2505d338c8db8d7f, 0xd03b01134b4df90d, 0x1017ddd9bd4a4,
+0x3263599fb3f71d3d, 0xa3a350a2d02b0488, 0xd9d7e395fce6783a, 0x9556e93bb46656b8, 0xb53bc6e16342fa51, 0xde142662cc2e6104, 0x100df88d5fdec,
+0xc3836f5778015fb6, 0x986ac352a88e25c4, 0xcfdc81c62b35443d, 0xe1fa789ff96f03ce, 0xd5636800386df996, 0x7bb2fc6054bccf90, 0x111da41c76863,
+0x153b71dbe7a70dcc, 0x9b0d415b0705e2af, 0x7b665834de35c100, 0xdf7638068d55ed8f, 0x9935363172c00bcf, 0xf80e14b55e673308, 0x1ea970db98a72,
+0xee21a1578f57a78b, 0xb0c2041ea59cc4db, 0xde16fd35f651dbbd, 0x858e3d9cd96dd9d0, 0xb82b85a0bef17571, 0x29fde580d107c7ca, 0x12bd0dbb22cdc,
+0x18970d888b38521, 0x5450584c25db307, 0xc1b6bc29e48fa3cb, 0x6bc68cec563a61cf, 0x5f59ebd823cb5502, 0xae38c932ffd50467, 0xecedc46cec27,
+0xd02186104ba9f26c, 0xcb660ade66fc5c2e, 0x7fc7c6f1b268c0fc, 0x945d37049c8f972, 0xd08d8734d7f19d3, 0xed96fcfd58722b27, 0x5cf52cfb6648,
+0x95bb325e34cc7ef9, 0xdb4950912fd1fc, 0xb09f6555a7588494, 0x9188b17f38d49ffb, 0x427b5ee075f8832b, 0xdf8f85112d99ba03, 0x111806491fc82,
+0x309d06f4f5f99a03, 0x5a04d5ee50522102, 0x1902faa65fc349e0, 0x5deaa3ac18ddb6f3, 0xe59547f38c2789a7, 0x1d95fff8d9a76dc8, 0x7d41c90296f3,
+0xd13bb6866c329f3b, 0xcdde08eddb8cd3af, 0x847d27ab60891f13, 0x25e03a84d317b910, 0x9d24b432c0c2a658, 0xe402114c416d744f, 0x13b06209b53b8,
+0x6d3e045108338d52, 0x44ba09932338af, 0x423b2b1594dc382d, 0x3e80441bdf37953a, 0xda26ae0ee5618f9, 0x18cab2eb3cbf2b9c, 0x252ecb0443cd,
+0x781119e2643e1a79, 0x988113078e56ecbf, 0x6e1ddad6333afe4, 0xe9ff6e4b603c762d, 0xd526dd436c52834d, 0x6ea04c62e27179bc, 0x20384e8694036,
+0xc0ff63b67b0ae30b, 0xaade4427d1915436, 0x4bf46ddc0eeb2b88, 0x7876865e61e773e2, 0xe4d73ae5aef897a6, 0x10c63a58d31cb97f, 0xb9abc1ba9920,
+0xc010b9e5fd0b4e22, 0x1b87860533ff8c1d, 0x3f8520cb51c8a321, 0x16814aad7b5281ca, 0x270de611657e481d, 0xcf3cdf9123f41fa1, 0xf662aeec196,
+0x429c2cddcc05c2bd, 0x7f3a3055dd5ef785, 0xa0e4e46191bbc4b2, 0x9e9460e9e12e022e, 0xdaf46bdb8e837d27, 0xda58050843ae7588, 0x207df30753b7f,
+0xd1a661450726b498, 0xb58bfb5d1193f955, 0x6ff51b55704c4c9d, 0x55e3c6e54f0199d7, 0xe11c76c9276c9192, 0xa7662cdc876a0a96, 0xd9e0829f8ee3,
+0xf4bf45b6add51874, 0x8b3899a96438a89a, 0xf4e8550053fd8473, 0x42601a829975acaa, 0x39c77f5af67a046, 0x69240151c46bb4dc, 0x688a0b45ce62,
+0xcc18e2ce4da7e2e6, 0xd0b01e79e8c9057e, 0x4728173c21dd11da, 0x81ee4dfdb2c013ff, 0xf53901fafa1ceb37, 0xdfded272de65e33e, 0x1614ac6416456,
+0xb64fce510ed76f11, 0x3901ef18729cc2b0, 0x9997e87b02a89a8a, 0xbd0ade77ff6c41fe, 0xf82b215d753b26c, 0xd9b573281e01a3e3, 0x195042f8fbf7b,
+0x9d63610f7d3d2f33, 0xa247b8a729f6045e, 0xa6f3a4cc7d418900, 0x983d8c6e6ce8688f, 0x786c9c109ed1143a, 0x50743df63d0caa90, 0xcc4aa483307c,
+0x8da2896921b1585c, 0xa07a41c83691e425, 0xa288eae31405f044, 0xbe28c17dc0bb9597, 0x818e8648c8b24f3a, 0x65ec5da20d613131, 0x223f0551c0a59,
+0x537bd2b9aee3df53, 0x6ffeca17ba53327b, 0xa0d43ebb7bb8bc7c, 0x3aaec836ddbf44a2, 0x7be565b87baae23d, 0x271feb5965f2215c, 0xac89f1d74511,
+0xe6b29b7dfd642f3c, 0x7424a8fa759534f0, 0x65f76c37bf396790, 0x2189299ea4f39c0b, 0xf09b01d202b0d3b1, 0x9f1f0d995a27577c, 0x1c8626477c15a,
+0xcb56f452b91632f9, 0x12d757b02f4b9d3f, 0xb1ef60d8580fa9a7, 0x4ecdc915961e09fd, 0xe0e088342c11315b, 0xb90fbb1ae91f8dcd, 0x10745e83ae4c4,
+0x9d88f0929d46af88, 0x2564da83723aafd7, 0xb775e9d87c529e71, 0xf2d74ed1a3cd76db, 0xf2caa8bef475ca4e, 0x316ad93212e9e235, 0x118316427fcf7,
+0xe4ffe5bf1408c225, 0x4f5c9d5a901e0a51, 0xbe66b606d147229f, 0xf49da5e8e78f48d5, 0xdf26a50adb53b52d, 0xef8ff5e2108a0ae0, 0x1e06d2f5a9840,
+0xd5f430af5a3833e7, 0xbfe4561e731fc3b1, 0x662b1cddc70bbd5c, 0xabc53f1546beb81, 0x433f9714955ff4a8, 0x47fccbd4098cdf9d, 0x119685923c77d,
+0xe38bb4c3f4f620c7, 0x2e79f60b32d74eab, 0x21ddedd47725439e, 0xe5d9f6bf09dc77f9, 0xdff664208756dd15, 0x428acd53bcd120a, 0x1226bbb252ddf,
+0xfe31e477c986bd88, 0x7ad0ad939b079ce3, 0x45f0fe7f39a77a65, 0x8d6ead24a09845fd, 0x9c71daeb9bbadd28, 0x12b38197606f8422, 0x101877c5dd102,
+0x882b046319adfdb4, 0x65f45d2ad0aa9741, 0xbe90ea79b7522c7a, 0xd73189028c2eb5e3, 0xaa544faa9b3ab11d, 0x552a554a9d37b600, 0x539c9a3231d3,
+0x308b7d877c8c941a, 0xbfe37a3fcb01a6a8, 0x2a523789f144174b, 0x4ff9628fc1b59945, 0x1fa04836029158a5, 0x8cb55c377ba3cd63, 0x7a4f0b6ba63e,
+0x57e8272763d93723, 0xb3c65ac93cb45cce, 0x91b95ab11eafcaa5, 0xb1bb8473855f1510, 0xf7696e69904c8fa7, 0xaed7de71affe6b3c, 0x17c70d6fc1d9,
+0x170c1a4b15b575a2, 0xeec8f40bbf0e4e83, 0x37c8e0a9f8fd9b5f, 0xcc831ab708775555, 0xea8a7bbeba39fb0e, 0xf88ba19dc73d6326, 0x5e2a22c42bef,
+0x3b97193812ed4e62, 0x53da0909c4359511, 0x282542fe6fb6791a, 0x91970a71e07e385a, 0x127f99c56772b9cc, 0xdb4fde71fea2a6ed, 0x22643a69def2b,
+0xec0efbe90980f443, 0x55b1f5b16f9db42, 0x20c627931f34796e, 0xc490e0b2fde3421, 0xfef31548229173db, 0xc4787f9acf7d7817, 0x6c50eec62d43,
+0x9a7fe73f2e464163, 0x1857f6497c4efa45, 0xee44bc6b661e27c4, 0x726dbea371089a12, 0x752fe6b8b08696b8, 0xaa30b9c0c5bd514a, 0x1278424705973,
+0x9be266a81862c78f, 0x45e9ba105f352e2e, 0xc8a1795aeb87d500, 0xa1b20a6356fc2301, 0x3013d311f6c52b90, 0x3005c00a849ac7d4, 0x63284746a38b,
+0x606c1106c0710741, 0xecfafe5c01ab0002, 0x3c2c04b27c8ad0bb, 0xe0a41c15ccf8cfa2, 0xcbaf97d834836f5d, 0x33b9169bbfb2ea58, 0x10c6d64d46fc7,
+0xa235bf73da82d7f9, 0xbb4b19b2d4c97faf, 0xd650a0aa9503ea88, 0x1b4f5c4cdf390f15, 0x1f584fd0faa17116, 0xde7bed5a070946c7, 0xb61982a77163,
+0x8c03450d80782a47, 0x235843b8907fe695, 0x827922747ab231c5, 0xa7c4403cbfbf7f63, 0x7745f5ceb6b4b554, 0x3fa3f9daec56a9da, 0xf7fad7418852,
+0x45fa70a140f81d90, 0xd34ae925205f886a, 0xbf80b33fd44622f2, 0x6acec0cadb04110, 0xc09369bfb0023842, 0xf13b14cc7960455c, 0x1bde2c012cbbb,
+0xe4b0a028ccf64308, 0xd2856202503aafd1, 0x3f64defc74fc10d1, 0x58f7d8756617eb9f, 0xf9aca87753565bdd, 0x5cf7efefff2c4d09, 0x1b0ff584c0ac7,
+0xe35239ed47e5ce83, 0x8ae983c28f99c4c6, 0xdee2e2c339a78e7e, 0xe1bc7207e9ac9686, 0x85d7efb372ee5b43, 0xeced62b3fee691c9, 0x1803147ad9ba,
+0xe345a5d1c0267391, 0x5f95a27369eceff1, 0xfc36026bc8dfcd56, 0xe4706a91f95d3911, 0x3b066aa2199b8411, 0xeefde56330889865, 0x15b40ba009fce,
+0x33c8fdd8dabc2405, 0xc62c02d4311b1194, 0x1957844458129140, 0xe9831e61e297c362, 0x9db76c70bcd4c3fc, 0xe9fd990132bf4fd7, 0xf3504f8a78f9,
+0x2dab6d0820cc0615, 0xb2ed03d5539ffd3d, 0x85ed74d694b9bb65, 0x78f6b5291a412d2b, 0xea031a135dcf3b05, 0x12734a94b8b95848, 0x16edb379f9798,
+0xf77bf0e1ea9d4b52, 0xde093f6538580471, 0x6017f905b867c6fd, 0x25c9f644f04e4d09, 0xfc479829c3e766d2, 0x4a043a6e53fe59d3, 0xd41bdc2e1b8d,
+0x83f2fee679d62235, 0x687c95a218852258, 0x3169c334f8f69bf2, 0x5740f0dc397962e8, 0x8f2eb81108ec4d9b, 0x9be7444af79a8486, 0x1948a589e7241,
+0x5831514780784563, 0x3bac9304fec31f14, 0x85b95c05ce93582f, 0x129a428f191d043d, 0x9b61265d9206d868, 0xe6dc70f03f93f06c, 0x189095149e657,
+0xf43ceef41c8b5c55, 0xc5f2f562a4fb10ea, 0xa9afb7f8cc902821, 0x51db94c6d445b6fa, 0xbb7761b3707b30ba, 0x41211e5822ce20dd, 0x232e891ad2984,
+0xd1ed3354b987504c, 0x72aef8172490ddaa, 0xdb01d82f56a8635e, 0xfdedd1eeff62ec, 0x151f3ff349d4a001, 0xea7b63c280789a59, 0xdb81758e1942,
+0xb52b1099105cd072, 0x6636fc149ba15bcb, 0x1cb7ee4dbb7fc83e, 0xb767ccaf1e6a814f, 0x827e6018d565a228, 0xf1531121958f3149, 0x222e2d5c702aa,
+0x956639fef5b306fd, 0x14cfea3941ab029e, 0x777cd291ef6b47e0, 0x64a71ba7ad6e0384, 0xc4152581c45c976, 0x50bb86bdec7573fb, 0xc44fd62c8daa,
+0xbec0185714d2f8e7, 0x2ba5a1458845fd1c, 0xb62468de71a5f498, 0x9ede0b26b98ed281, 0xdad6c980b0cad1a8, 0x3584845249789bb5, 0x12fcd78058c4a,
+0x472f537e330eb968, 0xd56aefff77017a31, 0xdd4f453d1eb30321, 0xd865a0f5e5bee584, 0x4c8399776152f6de, 0x6f3811575ff59ce, 0xa834e972f592,
+0xc84a15055c80f84b, 0xd98e48d4705eb5d2, 0xefdc7a2bf5b959b0, 0x44fad4d9908e5a57, 0x6e77f56f0d960969, 0x1870399a4f93a6e, 0x1c39caa535e61,
+0xd546c8d28ef10fb0, 0x1df231d9d64cc298, 0x67d08580821db15b, 0x214c027cb6ca886a, 0xfa240bcdb4c2edfd, 0x3963c6537be673fe, 0x18010c7ac76d2,
+0xa5da43bdb0fc096f, 0xddaa16ceae940cac, 0xae3fbc8c349279ab, 0xe28c41678fd348f, 0x27b96fbbbba37ce0, 0x5615718307991e57, 0x3bc3c98b48be,
+0xf530b1230aa0fcd3, 0x665a488958531090, 0x35bb424d0050bd5d, 0xe6bed192a33bf4d3, 0x2b84ea50abc9d109, 0x5dfa07c324dae3b5, 0xba6116e07d48,
+0x9aad471d339ee6cd, 0xcd9ecad9b407a668, 0xd6a52589c26c2783, 0x4914aad1b9fbce55, 0x9d9773600be2d02a, 0x7125116308cbb9f9, 0xa1a764f660b7,
+0xdcf167e5e5b6d5a6, 0x18295726f3078512, 0x52235dca58d7847, 0x70729ec659947526, 0x8cb3d62c7d336eee, 0x4fc52754808880ae, 0x1ff98401cb195,
+0xb774536fa516e50a, 0x6d3208c2b4c48201, 0xc66d9fbeabc2e4f0, 0x95f2a5c9134134cc, 0xbf7e33d8abdcd04c, 0x370ada6286976619, 0x1e45f6b168520,
+0xc61ff1f98541ca19, 0xa94a677b9a9b1eb7, 0x87cf9d3b2b8a33a3, 0x20880b039c52fc82, 0x3241591ec1fe7191, 0x17da4eb85e58406b, 0x1222545762788,
+0xf83cfc7275ad0372, 0xff32dc9825f20792, 0x99a6eefd08248a75, 0x71dc57fa72f9af80, 0x99c6817e504eb7c7, 0x79d8953e4b1c26ce, 0xc98f12696f87,
+0xfdeefe8c3277db5c, 0x5e73f1ef189565b7, 0x54dea913e650d4e5, 0x6f63255d69a47c01, 0xd089c9ba6571af8f, 0xc51935eb912a1eef, 0xaf21d77e0496,
+0x28f59c570d709a22, 0xbfa4f68fb63217ab, 0xda50494d73f19631, 0x1641f99bec6a4105, 0x9a53a10e0c49acbf, 0x23d0c96b9cb79634, 0x3916144455ca,
+0x193e4d15c1544200, 0xcbb058d5124c878c, 0x80ea07dfd8d5c670, 0x463338b9b9b59307, 0xde0b8057155e6920, 0x1c1e81c7bdfd3c86, 0x1f7a394ab506c,
+0x2c15acea4aab3d7e, 0x2aec15a1c73884cb, 0xb8d9010d02a1cdb2, 0x2e17c0a60f270ac7, 0xda84721d4ab451b2, 0x1d76b2008ad8de3, 0x13a0ca87c080c,
+0x72541e88467ec1ba, 0x49f99c21f11bea7c, 0xaac922c27aef5c38, 0x134102a94a194ef2, 0x9d4e2ff2c0063de, 0x26c6782c2c65a3af, 0x3ccae8adcf90,
+0xa7f53ac27e33e067, 0xc7761ca9cca24b28, 0x5123924e3b241ae7, 0x5ddd0ec1befde239, 0xe7e6d952019dc466, 0x3fb8bbb6e5d97835, 0x2fdb2e409c1d,
+0x345a6cdf5a7bbe05, 0xdd45bd1a0098451e, 0x5213740cbbbf7365, 0x5352c15d6691a059, 0x502354e5fa6b9571, 0xc056f4911f49a4e4, 0xdfe3b4342bf0,
+0x4a9cee51a85237eb, 0x628273205fe4b898, 0x21d72627dab1c4e6, 0x9b5ed512b681e4d4, 0x8ef24cc888f5a177, 0x1c3bae94ff7164e1, 0x10dd6fb29fd5d,
+0xc8d7bce2eb76ad5e, 0x3d4009e679433bae, 0x8015ab93fb790376, 0x5daf036a91fd9c25, 0x831582c7ebc56757, 0xe1ea0c3ac9342ec9, 0x20c661803145,
+0xd9889d6d1280cd16, 0x529fc0b8e1862bd2, 0xa22d3f7306e4469e, 0x9388d17f3aa53c4c, 0x796fe152f8a2fd99, 0x3f378694231de2bf, 0x1e38273e3e7e3,
+0xc6f8def4d664ce66, 0x1f9927d097d3b18f, 0x589b767c74678a7a, 0x4e22485aabd9a3e0, 0x985dc1e3f341254b, 0x972b717ee08a9546, 0x1ba05397a0d8a,
+0xa6d0df501959d27d, 0xcd58a2c210a6d2df, 0xbafab657c1023509, 0xfa2a4e90df61459a, 0x1b8d2d227e2a32a5, 0x518c4e16bffe0b01, 0xe3b3f06cd1ae,
+0x2ae40ca2237517cf, 0x1057e91b1e34c8e8, 0x798b723ca0aacfbc, 0xf8c4ebb86513a4dd, 0x5ed2ec691a9fbd22, 0x9ad0849937350443, 0x13f0ab9b3749d,
+0x480ba9f3a6dc86f5, 0xa296e41576b8ecc7, 0x93b3ed80fd590b21, 0xca66b03a88d551f3, 0xffe678d6c01ba724, 0x5d33fa21e69382fc, 0x15a52839f5b0a,
+0xb65c8272a0202f43, 0x57991217bc67b63b, 0x12ab3d16c5230958, 0x6b3b581950db08c9, 0x31983fab10d5ce6f, 0x8d70f1b94ca34f8c, 0x88bc2ab343d4,
+0x606b0e043703dbb8, 0x3ef82da8f543bdf6, 0x1280e417aab7a9c4, 0x98c89457480d612f, 0x55a5a0e73d9d8395, 0x1efc4d4346e7aa25, 0x184b87ab398a6,
+0xb43328672fb9b2a6, 0xf5135022a33f9d02, 0x86d9127ebc05ef2f, 0x33336b4e082f2113, 0xad148250868d0d36, 0xf2e28025f009cfbd, 0xa9fa1c2958b7,
+0x9b9ca57fe3b9e1f8, 0x5905f78b9a29707f, 0x82a8948be0ad8ccb, 0xf434e2fa02243681, 0x65afa692f3274149, 0xc360e393abc8cd75, 0x244eca9e283a,
+0x50162b6bb7140b34, 0xc3972ac6c75b3cdf, 0xab8b66205395768, 0x5db5ea385d477688, 0xd7b597150357aa78, 0x6398e3b52274ba39, 0x3c4bc0a4c282,
+0xacfc3f7a63cc73d2, 0x54bb5e3d8c426329, 0x19b63dd87b0648d, 0x7104f3a5d0c76cf3, 0x5846f8a77926a786, 0x40ad587ec84e2852, 0x137a42f364d51,
+0x39b457da6cd7b7a1, 0xcb691eaa231dcc22, 0xfa78e721737a1ca7, 0x2e22a491e3314f8d, 0xedd293525b12626a, 0x24b1b0157d62c1e, 0xa58968ffd926,
+0xc4625684cf4acca0, 0x8975fa57e8968bd1, 0xba5966257b50f177, 0x14380b27f9d9f723, 0x23f5f08b220aa9a3, 0x41fee3f22d73af1, 0xcad1c5c4df3,
+0x7845d8b60548e499, 0x94bc8259e6c48389, 0xf9fb5b70272e3c36, 0x2fe3fbb0b938a3e7, 0x314ed355d61b9558, 0xae3b54c5706781, 0x74d979401b80,
+0x2fcc4a773833bb7d, 0xd04bdd554c99f904, 0x2b2ed3a903d304d5, 0x66a53f31df18ded3, 0x5a9cb198137837a3, 0x96609b5a48894468, 0xdc64e6c06339,
+0x7897eb11b6711070, 0x50e2819bf860579b, 0x1fe5262ac4f8748f, 0x78b28d888a48ae50, 0xc731f0b03f1116f0, 0x59faac280c694b5a, 0xb3e49ece7134,
+0x461303fd15487dfc, 0xf3f2bb49ba936ecd, 0xe76ced7696b9eb07, 0x8f2484d5d28a6a1f, 0x269b15e1fe1c1439, 0xa6acaca8c4d1f311, 0x1123ef66bb30e,
+0x52486e3980eedfdd, 0xbedf30655e45c16c, 0xa16e6cca8f5a4eac, 0xdd477a23b738a8fd, 0x492bc68f412d8d30, 0x41053a8f349d5ec0, 0x48568b923380,
+0xa2ddae0ef71cc317, 0xe5d141e240528193, 0x14daed918a369b97, 0x19c8b90bad8b804b, 0x3d4c7ce8fd8e0453, 0xe8bc395a618c5deb, 0xdfcfb8dd6e03,
+0xfc4aa91c7fdbc5d9, 0x22fdeb151f1646e, 0x6429bb6b23829abb, 0x1e23ff137e9313dc, 0xc939461d83eef40f, 0x74ba65619ff0149f, 0x1ec49013120e9,
+0xae51c569b6c37620, 0x47f8530c661e66dc, 0x7e74eed867e8ff0, 0x70fafbe846c73c0f, 0x49f2ee8bd36381a6, 0x487a650537e059b7, 0xc6bc44021a1,
+0x8afe59b583b4674d, 0x9ca4136022a807e4, 0x69b62eef7e5b0533, 0x8844d2f553b071c4, 0x14f2be4333aa344c, 0x2bce945bdaf574bb, 0xafb5fe2e9c5e,
+0xc81d4dd9f7e5c70b, 0xdcceca41c4becc17, 0x2908dfdba0da62f9, 0x216d577d059552b0, 0x120777ff9cb336b0, 0x6d861e3e39a75985, 0xb7cf7b1a3838,
+0x6d46fdb3ff6a0075, 0x11a829326324999b, 0xee52d533af819757, 0xc0d05d9e117fd5e5, 0xb5454f15a538277c, 0x3a46a0833e65abc7, 0xa6ad1157a91,
+0xc556c2f878788a78, 0xaf6abe46f8a5e212, 0x7d11fceb4f4c5015, 0x8eb01a63073391e6, 0xfe9ad1cfc206ac70, 0xc4efca87f0ae8d4a, 0x87c89abf32ef,
+0x7a3ceb6a419079f8, 0xd4b290f7d77db180, 0xee013a1b60f6d9de, 0xd6e19ec6990260c9, 0xe26e7cb6eeb7b48b, 0xc82f21926eef6d2, 0x1e5bca1106f74,
+0xc8f3c4a35dfcb575, 0x8890d1ba8d8841a3, 0x581d22bd27d49f2c, 0xae4d8f7f83c15f4d, 0x9bdbe47a1d7e5890, 0xdcf968b61c09cd6c, 0x88682d50d3dd,
+0xbfecae5f5020833b, 0x759f395121609f0f, 0xe67fa7e5dc3ae23e, 0x7256b6d3da48e9d1, 0x24e6f4db85cc6e1f, 0x75c13d5db17d77cc, 0x11e8d013c9fb8,
+0xd84ba24bc61b5f8b, 0x6585bb76c5afba99, 0xd84cd84f3b9ecc72, 0x3a4a29fa5c521ea2, 0x8e2bd1604aa8211c, 0xf1ee4b8327961bc1, 0x1032e59f4673f,
+0xdb6d8c9fff143b9b, 0x387f620907605b31, 0xafa18510eb45c8e9, 0x7a4c0e51a7a13310, 0xe7f07a4192dc248d, 0x68ef0f8602f676d6, 0x57f6fc612a71,
+0x78be5e202622d06e, 0x84d3dc1081aa2bed, 0x8575a16213b45a7e, 0x1929e9fe9f259c83, 0x795c8d53b1ce6f0e, 0xc0c39f424b767e7e, 0xd4bd30818760,
+0x6844845ec1a7dd31, 0xaa3ea7e6061b386, 0xe93ce99f5b180e05, 0x1d8f2b05965e2776, 0xc42dc299d11db097, 0x6b41e262200d6ce3, 0x1935dbf7eadc7,
+0x57e72683298b9229, 0xafa5da8cae3f8629, 0xf9df3595f07cab62, 0xabe139025c397b58, 0x43202c1354bedff9, 0x37911924fdc094f9, 0x2107d1c956d1,
+0x7e88d1012a9b2b1b, 0x3da110e73b2fd926, 0xd549b788f7ec7705, 0x268d1a15dc8bdc08, 0x9807dcf1728c622, 0x5a5a5a72fe302dd9, 0xec660a640f3a,
+0x71753c2a6c7444c8, 0x1061d6ad7b462170, 0x4ddbb41545cdcccc, 0xab1b7735cb8bc92c, 0x2997dd7cc3ef33d9, 0x7330821f151b4b37, 0xd0430ea45584,
+0x5554c81f92af3c6d, 0x6ca7da46525a864e, 0xc9d777bd4c194938, 0x215c3641a3a7bb06, 0xae9e6810aa420d88, 0x75fe7a39692f9d0f, 0x10fe3cc6a7d94,
+0xf4b10d80c76e2639, 0x430a75e3cbd13271, 0xc2fa5f3d889b8341, 0x710984f3bcc0ee81, 0xade87c9b8c0d2524, 0xefb2758ea1ad0d1f, 0xe9c56d5cb170,
+0xce0fcfc28e6e452b, 0x7dba8d37e5640736, 0x1c9399ff513a963f, 0xdaae4ff25ef11542, 0x23cf54b1247b57b1, 0xd53df587081875f, 0x1b76ff559708,
+0x228c0dc4ee448b9a, 0xdeeebfd34f78e9aa, 0x4f77421b3c664434, 0xc24b230c803a8af3, 0x88538ae99dc11676, 0x3f945d978b63f05f, 0x1950df89120a6,
+0x70dccd47b3e861d9, 0x2bfe46be30fdf6dd, 0x44d25c00640d14a5, 0x5b3fc3960b0adbd3, 0x4e507c8a9dff50ea, 0xc453fc620ee19b9c, 0x6fe8ab067854,
+0xf544ff459c038da7, 0xaaa102672f1f1504, 0x58edfafdcd7c7791, 0x62b5fa80920b9e6, 0x6ffd7b9ab33257f9, 0x97907b2d04e4b6d9, 0xe533ae9a3979,
+0x169396b04446a395, 0x34fba86de755becb, 0xaf0e6ebc94011510, 0x9519c9c013c7d339, 0x792f4bc92ccc6219, 0x112eb9bd8e5fd88e, 0xde4546b45328,
+0xa701d8c7073ed696, 0x5a04d44b100ef88a, 0xa58c23ee1221a6dd, 0x814b4f442676c54, 0x56e251650fb224d0, 0x53d9958b216df257, 0x17720afb8b497,
+0x2d6e544ad33e2031, 0x9a5738bf96adbf2c, 0x79d4960bb3dff86b, 0x8f907fd968805774, 0x62e88bc56ff1b946, 0x2819849b4e830364, 0x14047800823cf,
+0x1d8dfccb16b200b5, 0x14fb2ebb54d331d2, 0x28dff699ce5b1d74, 0x44128657f412f55b, 0x4025722b7121dae0, 0x2596937ffec24a2c, 0x384760e7fe76,
+0xff1b4aa5b0941651, 0x9ee1404828f6f0e, 0x4445ba71b3ddacf1, 0xd2b2a7ae03e834ca, 0xa296db6a900f4911, 0x604934c557b74ad1, 0x108f2976b3ad6,
+0x15712dfe618db5c4, 0xd4b072dd457c2ee4, 0x9efba9e596cefff6, 0x226d35b7ceca4ea8, 0x3fd4f25ccc113b84, 0x17b5f726e1732989, 0x167551cbd4abd,
+0x7b6ae40fd0be7cb5, 0xb34d448c10667e80, 0x2eb7f0c212941f60, 0x66e9d74f51201430, 0xad735601ec9aaf63, 0x4b14c73a055b027e, 0x216e47ce6b755,
+0xe8a16d7e3739ceae, 0x3f7c1623b8329207, 0x6e948bd842493b85, 0x81fae01fb0967ab4, 0x168e3645141d0d76, 0xdd8921358283545b, 0x602c35c1a7bd,
+0xffa5f6251f48eeb6, 0x99f62a9fc9ad6620, 0x26e4392949e2232e, 0xc2a9c265aa6f90ee, 0x6838ddb2b100dd89, 0xe592436d8679690d, 0x4e317b4d53bf,
+0x4c7257a0e2cc399d, 0x2fe41452ad609dd9, 0xab805ac6b6a86a97, 0x44c3d551dac21542, 0x224787332a4d5b01, 0xb050d2eb8c6dc2f0, 0xc143f5545528,
+0x7dd52fda6ef25c3d, 0xe913b7d0a8a0db76, 0xe7dbbe6740eb7e2f, 0x199f7426fabeda13, 0xea144ad755f31f1, 0x96d60620798102a4, 0x1f4bb5e36b92b,
+0x5bbd82472806d0e1, 0x6fb38b5d9af55797, 0x4abe8b47e2bb4ea4, 0xe16cf1d5ec400db4, 0xd3fde664aececb8b, 0xa5a4fbed91fc61f9, 0xc18961b6fa5e,
+0xc4eb17dd64ffec37, 0x7f77154b6a604c6a, 0x939c82ec3a905223, 0x3c8c7ca3c79a7973, 0x726db7ec8485b852, 0x501b7087b7c9fc75, 0x69677ddf8a83,
+0x75e4b667ae97043e, 0xdf04e5b846ae701d, 0x3c47fa90166d62f8, 0x4810f025255c1707, 0xab2be1dd1f88ad09, 0x659372b4b664d5f3, 0x99a3fc5f1b57,
+0x83cb02653c07bdbe, 0x92c85eff74712d72, 0xb40c4e0a37f6cb87, 0x7fbf2d33defdec58, 0xede82168c29da7e1, 0xe23ee550b122c35f, 0x1b3ba5e9de3db,
+0x395a99c43d582298, 0x90539f9c020a3d90, 0x542c9a7c614b0264, 0x3a81e59ffcd07648, 0x818d22e2cfbc3773, 0xa912c6bf76598ebe, 0xdef0946b7db5,
+0xf3542b0d5ea94001, 0xbe6c355262cd2082, 0x514cccc6d2e7580e, 0x30ce8f7ff48d149a, 0x63a7b66bac381981, 0x54e8792866a8afdf, 0x2054fd93eddcf,
+0x2bd0794258da6971, 0xd207f38c605635cc, 0x1e081dd1d5b70ff, 0xff73903a4f1baa4f, 0x234c9be02dba0a90, 0x8ed9364987e81e1a, 0x1badb75823994,
+0x2b9a3dc7f47951cf, 0xd1f6186a345adab8, 0x3ca735f7f58daef1, 0x22badc6e43dcbf23, 0xaecd650b9fd4bc8e, 0x173f5061fbdbc6c3, 0x98a0d832fac2,
+0xf765528e4b4ba9c2, 0x1063c4a2f0146747, 0xf047dd7b8e5b387c, 0xdd833540b34fa5fe, 0x6936c8784df0105f, 0x44496df23b8369f6, 0x1a2e46723f58e,
+0x674b3e8b4d276c92, 0x25b12cb4c1e5273a, 0xacc90537ec54fc90, 0x9804ac89fabf39d1, 0x2bfd0a63492d00f9, 0x71d53946a2c3dedd, 0x7b9fbd67c01d,
+0x34fbd138c0a2e859, 0xccdfc33c65e43639, 0xfa4b682b2d07f38e, 0x4c7cd2949ab02b1a, 0xf24424e87da175f6, 0xd3c4366077fe2e86, 0xb14d1fe272b1,
+0x7e258e3296b20003, 0xf762d9151d1ea233, 0x2bff26bd2c813105, 0x61e75c78e179d7e1, 0x6b44153d6226aac5, 0x2a7e968d4023b648, 0x17c8fcb67b4f2,
+0xb2078912587c597b, 0xb49a338070f24dd4, 0x8cbb68ecbc04920c, 0x85d32025a33831bb, 0xedaa11e7232eb5f8, 0xc233866d77f761d4, 0xa1311d793e16,
+0x853548bd5ce6b0bd, 0x131d740c3fb7579e, 0x255bd7c9c0ea2808, 0x67d5f8fdeeb5c8fc, 0xf7c45acec6459517, 0x7f77a6434de945c8, 0xf2f26f299628,
+0xe794362522f4a72d, 0x9cdb852db9738d95, 0x62181633e73b1018, 0x158c0056698372f1, 0x4a071d4a179d92cc, 0x482bcd1f612d26b, 0x2089139ed4557,
+0x927e51f6373191c8, 0x4809d6b5def910b0, 0x52258a9d151e4d2a, 0x8a3fd9070c614928, 0xd32f8ffadb2f6a89, 0xd1e687584e1b9663, 0x2014d140f8c80,
+0x9325c11e1991ec9b, 0xf04fd160ecf5c2cf, 0xeef4d92bd3ecc8a8, 0x555399274603e671, 0xc9793d4389ac0750, 0x72e203ec972ca550, 0xe5506e09057e,
+0xe4d191cf8c73997, 0x155d3faa5ce70e47, 0x2f4d05968234ec05, 0x5da5737a52f64a0b, 0xac095878efe5eb0b, 0xf98341fa138a1cbf, 0x196d729c04489,
+0xf07271be20b1768e, 0x30e4a1c2c8f2e26, 0x30141343e85a8345, 0xfa4ea0b76ff5c3bf, 0xf75018a809ec9b4f, 0xa08ba4c6b79030b5, 0x72b4cc5d64ec,
+0xb075fbd804a281bd, 0x42f80773f9007689, 0x2af4588a38d0c553, 0xb11f5f33b5b32b95, 0x2b501210a5432215, 0x80f07e87d4c2aa11, 0xb6f263fb15cd,
+0x4712a70dfb3c90ae, 0xdf1fabd8eeeed455, 0xe399e07e3f88dea6, 0x937db32f2fe6a704, 0x2d4af0744e0699b4, 0xfd2d32a975e4e458, 0x1d4716a776acc,
+0xed3cb1b5ff8efb0c, 0xc723d0b662ea8c24, 0x7bfaab1cc8910f5c, 0x54a7e0ab3d1bf3ef, 0x3c43967503026aa9, 0xf5d23214e796152e, 0x2c49faf256e5,
+0xf2cdd9cad47513ab, 0x9592381b1962d2cb, 0x6f1dd8d81345dfbe, 0xf80ade19a34ccccc, 0xfd63699d448d7e80, 0xe326ac7c4fb6bfae, 0xf441a22a1c70,
+0xc949cc973ffc3a2, 0x1e6c9a28849520de, 0xe7dbd9cd41f5992e, 0x9c2f4af9d44c969d, 0xf73baf0af45780fe, 0x36c4cda508d9794c, 0x1e850b9845bfe,
+0xa9a51b08c6044a6a, 0x6284c875a5215982, 0xa6e005ff5cc5819c, 0x62a7d9dc045f21f6, 0x721a14b5c8953a5a, 0xaa3fe4af4d2ab70c, 0x64e0bff7fe33,
+0x6609467ef0513d7a, 0x967e8a38b1244622, 0xb3d939c4a7607179, 0x18d3eacda4a72035, 0xf9ce93dd2243b55d, 0x36c7a14a3783f459, 0x1c32ac7c929d5,
+0xe679f191a292849, 0x6ec68225b9cf770b, 0xd699886df4860171, 0x480af47fc2021414, 0xc5dd65c2225d9428, 0x3e64eb9eb997f7ca, 0x1252c961a30c6,
+0xbf969b02ad577b55, 0x54304c8415aa6bdc, 0xfcf06aff928455c5, 0x9a9ce567fca05bd9, 0xb278bcfde6b9f7ef, 0xbd24e06d17be6025, 0x4492ea157696,
+0x43f9ec2ff142c004, 0xef78f3bace44dc69, 0x31537e9b5981bada, 0x68eebdc2a9a3e9a0, 0x5990f3ffa3f0e5ad, 0x72c71e8cd02466f9, 0x500f83808d40,
+0x481864606ca6ec7d, 0x64ab311f1e5d478c, 0xa4345f0499d31b97, 0x89cfb8a997901409, 0x824e0e0822258591, 0xfdbb1d3773796eb3, 0x8eaed5f1d86b,
+0xac028cd57a921e9d, 0xd25a25fe48076940, 0xb088566af7ac441e, 0x209830d434bcba18, 0xea1a56fcb7572e9f, 0xc25e92d6e1212784, 0x1778e4b66edd5,
+0xca3686cf7e33e5a5, 0x65a07e239ca7c66a, 0x84d8c1f7f4ea96b3, 0x974cd278562c37c3, 0xcc415d49941c2611, 0x6e132729e3df332f, 0x1e8d995a64393,
+0xcf3af66bfafd02cb, 0x748855a9415c060f, 0x1be4417200f41219, 0x84d7324ee46ffee8, 0xe58ca5b3280cc1b3, 0xbe18a8a275b3c9ee, 0x3bca09199c93,
+0x3e9a0df01ee4cac0, 0xed760f491b98ee15, 0x4de603537e7140ce, 0x24a6d25446e780ce, 0x84aacccc87d4988a, 0x9ee90396d5a582c7, 0x2874a64549ca,
+0x4ebb3b7cf71213f8, 0x784abde43cffc372, 0xfa36b4582233969c, 0xea4104e39229ca9c, 0xba0f02fca954d9ab, 0xe2175d4613dec2cc, 0x1a86052e4453,
+0xca14341a6f5cd005, 0x439b7b0a3be64e29, 0xb5617d7071ab6f49, 0x6c6cfb6dab5698e3, 0x94f26be73bcaf66a, 0x2024f4fb2997a6d8, 0x1de600f7fc213,
+0xe7388a4bced5769b, 0x6b60acd6811edce9, 0x614664713b7ec77, 0xfb3f8cbade76ef4, 0x3db51b71d6d7ce3f, 0xd4195b15ca1e3566, 0x40b47dd3cf49,
+0x57f7a79c542fb4e5, 0x31cf5aca33a02625, 0xbb26a52aabc9e6e4, 0x763e0a5d479b0b48, 0xa2f46f6bc7d27197, 0xba9b66d05f99206b, 0x229e46acbf41c,
+0x3e653bd6a2bc85ba, 0x9ea04f24d3b02703, 0x786defdfc5d4f6a2, 0x8044ac6d8fd4cc91, 0xc1d9bc6d3ac56615, 0x6e79acae603c235f, 0x13d43210c059,
+0x2fd0363eabaf0456, 0x4059b27bbb4e650, 0x2357e36b738002b3, 0x168dae28f8b2744c, 0xd55af9843075e46a, 0x11e94e93f66ca78f, 0x1a71b1b41a7a8,
+0xf0b68d0ef0d6f844, 0x681b2cb7f791727, 0xff6d547ad5c6bbc0, 0xd0cd9ce5564b90db, 0x76c30cb919096825, 0x9b420ee3c6ebe946, 0x14d03d8bef2ad,
+0xc5d9854c3f47a53c, 0x555ac6ff73723070, 0x3a4aedddb37fc12d, 0x2f48010d225e673, 0x5960fe9973318f52, 0xf0971747e94568de, 0x16538a8686f3d,
+0x361aa1b0e723e579, 0x91b0871f597037de, 0xe4d3accb7862beef, 0x8e1088bdf977306e, 0xfa34f77a399351ec, 0x65c0a009c69f0c77, 0xb4e46965400c,
+0xff60dcef0e5f2e5a, 0x1fd5be5bd3fe17ec, 0x4009cc34604d39ed, 0xbca7af0449372293, 0xb46a12ab185d8a6d, 0x64590b0c7cce0239, 0x1ef2375a17075,
+0xe3f9ca11c347f21f, 0x9c5f0b053126be4d, 0xee90ba59dd4080c5, 0xe1ec570f161b2457, 0xc3fced00f1d284f6, 0xf2d6803573cea3b2, 0xef609ffb6cbe,
+0x6ad053ca234ca572, 0xd38ba45be0c40522, 0x54ab67aeddb865c5, 0xef26a8d4c95a90f3, 0xe8a557ccb8f97997, 0x7b4ad59d3e0acf65, 0x1bd108e861a32,
+0x9cc9bc8c7ab68318, 0x83993f6ae3b0ca5f, 0x1c5f5cc7b781f8d, 0x340b40f1c3cdfbb4, 0x32c0f316badde44, 0xb1930bd202da66c8, 0x2093cdaa92d91,
+0xc946203474cdfe8d, 0x841b3e282b1df3b9, 0xdd6ac6fa56398307, 0x2ea4b9cf7a0d79e3, 0xb0795bb66ce3b513, 0x515f554b053cd118, 0x10364bfa17f94,
+0x251c26e717949820, 0x570644939bf847ce, 0xef9047abd11c5b53, 0xcb60b4d2d2d7c9a4, 0xba1dc33c4ef8ea06, 0x717bf19b1507b8dc, 0x10a106b357b55,
+0xc1f5a5812ccdd5ed, 0xf509d55bb153bbd8, 0xe7b67257888acf00, 0x990687befe19d3b, 0xb571455bf70912a, 0x37c6f1a877ffcb94, 0x1b36df6a031ac,
+0xa4fe4f6076396434, 0x8d6579d7125976fd, 0x458cbc5269ae2eaf, 0x7f354cb59084940e, 0xeac89082764f1ec, 0xd48cbf02e26d9d01, 0x19ce157dc0200,
+0xedd99e4f65fb1a82, 0xbe2c3d946a4f2382, 0xc167fb9b0d41366b, 0xdbc253ab9645e42, 0xb05d14b20748e925, 0xb9e67da615c7fff5, 0x17ab7361578f9,
+0x3400570ebf4f0f14, 0x37c8c495c85d56ca, 0x996647ee855da493, 0xefa88eaedca9dd3, 0xe4cddfb198ade043, 0xa7f016b1201aa942, 0x203fe00f5306d,
+0xcbf33de9ce66e72, 0x63f39723713adf51, 0xc2f9d49bda02214b, 0x490734377dccc85c, 0x8043b3bd3c698b53, 0x2b8e30d4b26b8a34, 0x18c7fbb5283e2,
+0xe1203e0040ef7316, 0x80d016565b8a8cdf, 0x2a0b0f5bc7407063, 0x9cfb999e25c375c6, 0x3788805f8fd6ad41, 0x202ac12b25e5ac9a, 0x5be51d1648ac,
+0x892f541efbb0ecf2, 0xf7d79bf103c22fc0, 0x670df64ca40746d5, 0x230cbbb7a06f1a0f, 0xdb0d950ec5c53164, 0x6bde2db90c822ab1, 0x129d827f8fecf,
+0xf56105a4d5f316f7, 0xf55734ac7752d72c, 0x9b3609588e4f49f2, 0xd1549e0157a121bf, 0x11aed60ef5be7c8a, 0xfeae9e9ed2416bc3, 0x813838a1fa6,
+0x7df6f7275ac089d, 0xc618b4db06c34b29, 0x8710d1f8667ada8e, 0xaeaa66eb6c885202, 0xbf106aa283c8c8ed, 0x4854cb9bcc1e724d, 0x613767e7e83f,
+0x671f50b2af728521, 0x6b7ca58ee1e681e4, 0xc5a6f9682ade183f, 0x446369295a15f06, 0xe903df5f2a4f5545, 0x55f5d047efb79a68, 0x22d79d64a5d4,
+0x4cff76e4e4b48801, 0x75bf82445044a2a1, 0x478540587a598392, 0xeedbdbda88331141, 0x285288495017ace0, 0x763ec3a90ae5c1bb, 0xde591fa3e9b4,
+0x3429f885caf52325, 0x2b332e82ba1602cc, 0x53966e2e9da4cd3e, 0xbce18940754780cc, 0x9bb5eba29d5f1816, 0xea21f4e2799dee25, 0x232a5e783ffa7,
+0x5d2db53d9347b172, 0xe316bd15a0cfb130, 0x28f114afa0e42816, 0x5d58e9435d73a8fb, 0xe04572bb72fef85d, 0xbb4ebd95d4844b2d, 0x120d4760c8483,
+0xb2fc8d0e68fab47b, 0x2a5cb46368725b32, 0xfd6c68b8c0b11d3e, 0xd741a82ca761b10a, 0x9cd7ea080df83902, 0xe6837eaaa765bc6d, 0x148d413ed7189,
+0xc0a60f22b0c25251, 0xe26f76133def7850, 0x530a88cd7ed59c7b, 0x7bea2aee20aaa98, 0xb327af549b4f58fe, 0xa02951b8bf6ae64b, 0x1e8e2005ae37,
+0xae2ea48f127fb683, 0xeeaa8b87fb56cf4f, 0x84539ccda3b4efd9, 0x9552f5060a6fa118, 0x3309b2385589daeb, 0xcb4c7fd64f85271f, 0xbb71b9073cd4,
+0xb699d78f0f3a419a, 0x169662a4db7ad7b1, 0xfa0349fc94492eae, 0x9b584ce4b9aecda3, 0xd5964e41d86c5b2d, 0x8175ea9467b6d0fc, 0x2053ed132bd67,
+0xf1fa15488927397e, 0x69649fcff5c23f1d, 0xb14d66f2cfee63b8, 0x912f6b4f55dbf2bf, 0x41bb0196829e514f, 0x7cb618284f5d1bd, 0xd336c6b7560c,
+0xf0252bd793a584b5, 0x70f6671d57a091d1, 0xb6c0a41fe2232fc3, 0x33c61e2ce3732608, 0xb6dfdee4fa008e80, 0x5faeaf157a276f09, 0x10eb0034201bc,
+0x77930d5b0d1515ea, 0x5e88b99abdffa177, 0xcdc1e94905cf2ec1, 0xe3985146ba3e895b, 0x4bd1f138b8e98d73, 0x32c70187fed2c1c0, 0xc14c9d918586,
+0xd26a42eff144d2da, 0xae51b4ac93e97249, 0xafd523d101813d35, 0x6ca665d6793f9a38, 0x650b6090ecbe4fdb, 0xfd10b1132204ac01, 0xc24d5edce75b,
+0xe6ff85813cc4edcc, 0xc05225ddc53d3ff9, 0xa4c8d4d0a2b651e1, 0x95a3f1a4a992161e, 0xe222d61ab6355e2e, 0xccca276b8ae5b296, 0x1e63d8298b61e,
+0x3ae1aabfa7bb0faf, 0x8dd12643668d5c3, 0x1a4e104cb28d9030, 0x128d0f7d979f1365, 0x2190a2325b4d61, 0x34902e405161e575, 0x11011655f84aa,
+0x876b9cc9467a19c3, 0x6c0c8a8cd6d06945, 0xcbf445a3f816847b, 0xfa695fc52a7139d7, 0xc9a8e1a150802039, 0x31b3af7425d9c7b1, 0x1df7f4d35bc61,
+0xad3988944bad124e, 0x9f34563e0f9ef36, 0x4aa884d0be9bb33, 0x1cbba2779ea2bb86, 0x8788703c87012013, 0xd42586cb808a1c2f, 0x6e68a6b1ec31,
+0xa2db08a51bd073ee, 0x2432380f66e2808e, 0x8464ceae12a4965d, 0x8a8797b75b31cb5, 0x939442fdaca17fc6, 0x51079e2b60e8e67a, 0xbb33dd2578e5,
+0xbf70c0a23e7a5dcc, 0x5c6041eed04e65e0, 0x78250eb2e6c5f073, 0x523f0761c14c6e4e, 0xa65c89b9627d52e4, 0xc895e81cbf189513, 0x3ad7e27fbd78,
+0x43e1e1c796582337, 0xe6b78c3fc2893ae7, 0x362b14ec81d9f87e, 0x6bdade0aae41de05, 0x6ee50da2a9868d89, 0x29580d5161b76c95, 0x19617e1eae107,
+0xfa6e55220c5a4659, 0x38a0ba2ae974413c, 0x13207cf6c00bb854, 0x368d36b06ccd4e0c, 0x11dd56d500ba2a45, 0xc6ec3e1a3ecf71d, 0x1c1fcce18284e,
+0x1d27809d7b197bfb, 0xbb5877c4060b7715, 0xe9ddb60f9fe3fe9c, 0x38e7a7ba8f18ccb5, 0x5aba3eff257af6c3, 0x1dd6fb3e4821e820, 0x18b90a743c829,
+0xe18b78149d6cd21b, 0x47fdd2ae6636f99e, 0xd53516c7dc656d7f, 0x373697459005d4c9, 0x81622199caf7b341, 0x8be0e5ad82b61903, 0x1b63f609afe2d,
+0x7e3ae21459661f4c, 0x7953dd1e467e95e5, 0xd350588021c761ff, 0x67bf4dee1380ab0c, 0xc5d6acd90359c07e, 0x153d66ec605477cd, 0x1abb543443b93,
+0xe83a51ce0257da9a, 0xeec106b035cf1940, 0xde95ba328c1cbf0d, 0x407e1590fb6919ee, 0x2656242ef122f8e5, 0xd094db3bf6e83b60, 0x1e02a6ba80d77,
+0x7a234f6351008daa, 0x650f112609094cf, 0x8ce7e713c145a0ca, 0x2a185f475736c663, 0x2de2e07936489f7b, 0x49c3d7203d0d761d, 0x1f672619bc433,
+0xfaa836b6c1e99016, 0xebe07d5eee7d860d, 0xcf960e525da09081, 0x686d65a136153eef, 0xaa28b64c17c1fa06, 0xcd268e9ca64e8bc4, 0x14a4d34273239,
+0x7cdf7d53bc855ba6, 0xe6c1836b9950199c, 0x1de3b5d7cda3e34a, 0x6a609740db94f443, 0xef42b8afa3db5af6, 0x7445651b0b74b83d, 0x1573943610d7,
+0x6096a356fc999dae, 0xb512c62ee59aea12, 0x89ed9584d82c3218, 0xfbed8254fceb9fd6, 0xa186f580d6cbd36a, 0xbe74dab3d5e12804, 0x1eb661b4efcb,
+0x4d32ea46167b536d, 0x69e986189ef2a990, 0x4eeacd24c3b258, 0x8a8639e5bb26d8e5, 0xa08d457dff76e4ee, 0xfc4601127b32aa0b, 0x1670637d32aed,
+0xdaf1f871d8833a84, 0x2ec93e08cad287c3, 0xdde224cf6a8cb966, 0x302730500c4d0de8, 0x8eed260b50978447, 0xd5366f220c48fd37, 0x2ba5ffcc12fa,
+0x9864bee70aa14082, 0xe5629062e682ef2d, 0x5529fdbe29c9c6df, 0xae688aca18e1c843, 0xaa233e4973ed03a, 0x9ad54b24853789d8, 0x13b0adff234f2,
+0xb05a65b0b80242e8, 0x2608509e44dca322, 0x66ff1ac52c442876, 0x4a36ff3693acbb9d, 0x77ef7566513e142b, 0xb678fbc771491ce9, 0x1b076d4e63df5,
+0xd9caaa9ef18cf411, 0xfd61f01d1e552ee5, 0xd40e5db8c41d5925, 0x6362f1f8f2759501, 0x30fc40d751b25e9, 0xe5d80f19279ff709, 0x1d0d2582008f1,
+0x34c21dbd34466fa4, 0xd1e5fe19d889605, 0x710c1228f73896a7, 0xbcd17158b3575994, 0xdcd0c6ee0fd682e6, 0xb64b53fa2074420f, 0x3b6785804462,
+0xb19992d586a3ad03, 0xa756860b74b2f04c, 0x26a8759d96ed5beb, 0xeff8ae23a1034ac0, 0xd3041927a3a8e1d4, 0xe376fd5a16ed68e1, 0x109a33b4972f,
+0x43112d2fa6769e74, 0x4a39f59e8ea11de7, 0xbce18e60eb751c44, 0x694666b833070f98, 0xa2da1e787b063696, 0xa35181b4658b4bfd, 0x1edf3497bc338,
+0x7c4e74f74be454b2, 0xba334cc9ca0b429d, 0x41c913f0697661e0, 0x7124c96b26234002, 0xa64472b15ccabe69, 0x4a55dd15ec50670a, 0x1db532661a22e,
+0xc307867376745ec4, 0x295adfcc62ea4177, 0x708c52a5f813f27d, 0xc45ccc7e030229bb, 0xc801263262e3a7a1, 0x36ae3df2adc2832e, 0x1e069709fd09e,
+0x154e6be2ce8dc83b, 0x15329cbf131fb500, 0xf01be27086184ddc, 0xa4f393d626044be7, 0x3ef420964d1c53ed, 0x3272a095c1ac7034, 0x1506331217ed3,
+0x96555c942005074a, 0xf320845e8948e05, 0x64a07ba110d2b547, 0x8c9425bee0b86574, 0xccc2ae4d89837d88, 0x47509edd7a001aaa, 0x9cb16c5429d5,
+0x301c04cd96ded4aa, 0xf17335688cdefec3, 0x2e4f7610b347863, 0x4f610af2b39fac5a, 0xd061538f2addfb62, 0x525d439adf313f47, 0x1883fcf08d9e0,
+0xe9ab716b9399538f, 0x10d725bb0cb41b01, 0xfedbc320f18f1a93, 0xf980d3d28c7f9258, 0xef815801b70f861b, 0x3accc7e2da2a54cb, 0x145932bd17e7a,
+0x2eb58a6d489fb27, 0xfff1feaa7b2294b1, 0x8e5f8bb82f22e0e4, 0x425c4f439ed226fd, 0x87472834294b091e, 0x14c6c54dfd9c69a1, 0x1752b22793578,
+0xec1e13ef6aeedc03, 0x657075803e53909d, 0xc350e7d2d3066cb4, 0x408abab675c609a3, 0xc0dccf980ed1d08b, 0x42a7e9c218e0172b, 0x1534730a952be,
+0x7151f8dd737b0622, 0xfa8d6b25857c3da6, 0xc6b5f44b933b8c09, 0xd4d3a60bbc562678, 0x232817480a12934d, 0x617f3ddc194a1d4d, 0x360778b5d543,
+0x4e749bb93103816b, 0x9f51d0448b1f9a6e, 0x8dc96675a1df20d2, 0x42ff975f99fa9d34, 0x3f6ccc8d60b54d25, 0xa8b295816104dc9b, 0x11168c33b948d,
+0x587dad752bacca0, 0x7e2c0c487e90bbf4, 0xcbc6ff5829aa4abc, 0x79e2e636b5e3e93f, 0x9c99f006c2b70bb3, 0xa262ce0ff3e781e4, 0x1ae4b1a48298b,
+0xdfbe385c1f05d481, 0xc9d310d30bb002c7, 0x8a4df6b873826bdb, 0xe422a79a1df45b0a, 0x8139be7a1e536183, 0xb57bda077f024fdc, 0xea77109a0be5,
+0x23122774030dec97, 0xaad76a3546018762, 0x2ba6a4c220faa8c7, 0x2121047f428a0d0c, 0x24f09f27c742719d, 0xa04d965dc5b9084, 0x5842f5f8f486,
+0x6fa4b009dc8adfc9, 0xd62be59163a1dec2, 0xe751141c3df2b2a6, 0x6d47714713d23975, 0x522dde43ebe71aad, 0xf0f0fa0da2de2958, 0x7929074519d3,
+0xa39f964f0c83c6b9, 0xb24fce71b249cad4, 0xf4e7c4cd3d709e31, 0xe3a6f6c7cbe7fcd8, 0x74603df0dc7a990c, 0xc08c0b98bd4bce20, 0x1bd1b3ab4627a,
+0x6e9290e290ece9d8, 0xfe7216f0aad460f6, 0x2cb9c6c7b8ad34e2, 0x95eda8005010fb9, 0x308e47f62cb32df7, 0x5aac721b3105a86c, 0x1a8d0a7da4976,
+0x1cee212d95fd863e, 0xaa3d91ae7e34c65f, 0xc3337cf47778cd31, 0x87896031fd80f496, 0x30b9dc930c052c18, 0xf1d602ca0734f57b, 0x1b311de78980c,
+0x88be30b3e45925bb, 0x9e166e8a1887a110, 0x30df9617d94032f7, 0x2986b955e8962ca3, 0xe0c8a8dcdf2c5dee, 0x8c18da838b38de06, 0x22e2674694e0c,
+0xb684605eb60f5cd1, 0xf37776387f490518, 0xfa39e744b6de8d92, 0xf579f767029c1cbf, 0xe943e94df91c2a9b, 0xabc0a1a3f4f55bc4, 0x258b7f5e8902,
+0x41993bee1555702, 0x45696d1976e9c06f, 0x75fd01aa22a00cbd, 0x2be5e74bc3f5087f, 0xd1121019a0680b78, 0xe5d3ac242fc36128, 0x1ee7c23caba88,
+0xa4abedd6ca58b2cc, 0x4a7bd5d51ce94e4f, 0xd0350b6684df200b, 0xf0352863950a8c8c, 0xa1dc20bdeaaed0be, 0xd3ecf0caa01f365, 0x7481a62147bc,
+0x8d6283458eeed84b, 0xa7b4650c86638087, 0x8518fd386976fecd, 0x84b28baa5e74769a, 0xde3dd3d487d751b2, 0x690058c0d889738e, 0x36f5d5e9bf66,
+0x8b69748d33e0af9c, 0x1b3dfa9e358bd85d, 0x4ab3e53c27c07057, 0xcda1e646bfced2b4, 0xca47d6361d463b7a, 0xf577b751695bcb94, 0xc1377fa6fe29,
+0x2b2e1a81ed1ab348, 0x45051f53326ad620, 0x1d76c90da4849fe6, 0xb9523b2e6ce011f3, 0x9622726355acaf37, 0x465967e1d0f983c3, 0x5b16d499a7bb,
+0xe7fc5c49ec23f337, 0x9d6f7df11760add2, 0xcf63634bba89ca0e, 0x5e553a8cfa538fc8, 0xe37636ebed395033, 0xc6e27627543e8717, 0x153758f16e373,
+0x383b38eb9a1c5037, 0xf2ae8b9050228314, 0xb49490848d7b7478, 0x50590476fd8501a, 0x20f2b3edf9cc3bca, 0xc4b6dff0a321e675, 0x74c68d700b58,
+0xc9db1cb2501451b2, 0x9c3a1afe46ed02b7, 0x4df405899ada2d6d, 0x662bacb98f623e40, 0x228b8106f12c8e9f, 0xabcb2a0eaa51ab8c, 0xc70e22420832,
+0xbfe5c3be4438c573, 0x70e0a2cca1d3e875, 0xde91a7e55a6c9e78, 0xb44bde8cc51cb7fa, 0xddcf80836f9839b7, 0x307113cb006ccca, 0x815c60c29814,
+0xca4347589e0d1e27, 0x1e24676d739a1795, 0x72dd1b847b15924e, 0xb5d379fd6ebbaafa, 0x65bfe0310013e821, 0xec2d5adb55358e, 0x1ee876218799,
+0xdebc30b15a226735, 0x84b939faa9297dad, 0xc9b3feee9f35a471, 0x29063b14b90c10e9, 0x49ec6490409ea16d, 0xd1e90c1d9961d6a7, 0x138b53e2cf11b,
+0x4481d0871d865377, 0x8059d0d5c1a09066, 0xcd5cefd09896bd96, 0x796e1e15dba81d94, 0x2b3fd3af853edfaa, 0xa421aabf0da5c5fc, 0x1d13e9a986c05,
+0xabdfb25add3fe2c9, 0xe387ea4b1bf2f86c, 0x5310fd15350637c3, 0x913fec8157decee9, 0x86c32e29de9a39fb, 0xcf62813a1f42e103, 0x9d3a4ef1bc2b,
+0x3339defb0ce6a0b0, 0xa008166d4186f48, 0x7f0536bca3566b19, 0x3b9cb13396d9d28e, 0xa54e6910640adbbb, 0x2e4ba4d56fb405c, 0x9f391b542662,
+0xee88ce9805f53631, 0x59f7210e638a95aa, 0x17e7c29db08b8a76, 0xc4d731ae4d8f0c67, 0x8190385134d5c89, 0xf476aa824554d2ce, 0x22b56912edb35,
+0xddbfd5974fd45eb8, 0xd2f7c511d6b5ae6c, 0x17b7d41e1437f95a, 0xe09cc1f139088ac1, 0x10340a9e075d1c86, 0x683484a5e1fb1af0, 0x15c0f3e56c231,
+0xa8fbb1cb7e2f9432, 0x4e672084de87e254, 0xdffc125d604dbfae, 0xfeb9bf3fa0e3c73d, 0x3e26a27ad6ccbbfc, 0x79f38c26d6ccdd45, 0x9511231ccdd0,
+0xc56fb8c8650bbdd7, 0xb64c9dc5a984b2fe, 0x11f5553bdc0f0184, 0x922def124b57747e, 0x35e434c559290ee3, 0x7a3a555d2593772e, 0x1b7f0c8c8623,
+0x332c0aef5d326416, 0x270b50ce325f491f, 0xf55e54a726fdfc36, 0xa60a0bbe6e9274f4, 0xb2234efe104fde29, 0x5fcf4de2f26aa370, 0x87f13c53a25b,
+0x16e0dcacb8ba30c2, 0x4410b97c907bf4d0, 0xf0f8dbbc48b75849, 0x9bfac50e90e67d0d, 0x4fbb0b1551f0ef04, 0x25968dd007da2706, 0x12a3b63f1b8f,
+0xecc74920a62037ff, 0xb0274e22123ba2dd, 0x6739130c1c83cf52, 0xd8e3a31bb0f13b1d, 0xee8c2a9eccf0248f, 0x68aa8cf8f2ab93c0, 0x1a2ee5e384ecf,
+0x3c138763cf994a72, 0xb53ed28a746aabbb, 0x22080277b9d6d8ef, 0x12c6f070755f0953, 0xca1a6ed2b89cff6c, 0x176ab0f706cf3884, 0x1dcfed1fe08f5,
+0x62f823016bedeb17, 0xc74340cc1e369999, 0x829753db1d14c9dd, 0x9a9b83cb89111505, 0x45ec3bca9fffb293, 0xa1807e3d444a9c76, 0x2339afd348d88,
+0x9032eb1d27b5fef6, 0xf143582feefb0561, 0xc933e7f412a59b58, 0xf13eb5296c41a178, 0xd456ce1d46e0aee6, 0xf0c96f97a860f450, 0x143279211707b,
+0x34ffa88712f12ff4, 0xb8e3b4e1b7ae9f20, 0x2f95c72bcc30062f, 0x741387c43f424610, 0x24bf2b0801caea6a, 0xd4f8c122e50edfe, 0x1733d973a822d,
+0x8e5c954e6895fcd8, 0xac5b7acf3e966885, 0x37875433064d19aa, 0xb8dd8e9bd4600abd, 0xa9a96f9018a8f05, 0xa81cfafb65c531bd, 0x2321605f56935,
+0xf1b436398dd1d45f, 0x4c8aa18e608dec69, 0x52c7682577a4c90b, 0xa71fdc4db387d2a5, 0xd7ee167a9a6173a2, 0x9d5020e3cc784ae4, 0x85668e35b349,
+0xdaea69e26a2000f1, 0xba8d9f2858de1451, 0x7f00bf2f2d6bc0d6, 0x3c7e598cab961bf4, 0xe582e3d5581dea45, 0x57e7ae4eaf0e8e48, 0xb392ab2ab9c1,
+0x2eeb540dcdb40fd, 0xa37b787da412b979, 0xe63056649473bc0f, 0x965897ce66ed13f8, 0x2bafdbc16d9e6489, 0x41a4f65ddbf0c3f4, 0xd798d4611d3d,
+0x9375dc2c7a3d088a, 0xdd9a8f8052949dec, 0xccfc13b4df856898, 0xe8cb80d11773fa85, 0x73832d1799be2187, 0xfad91df4d9f8d50, 0x12fefd8e87e1,
+0x323e5d702f6fa503, 0xe80d3973d21b2f86, 0xcb67209ebf32f951, 0xb4fdb1a2ac3540dc, 0xcae8e2a6bdd6aee7, 0x903857be73c91df5, 0xf1d03b13a043,
+0x71db9fa3ccbe0bca, 0x68aa92cd0293f649, 0x27846aa4578ea334, 0xcb86a45bdec310f6, 0x314d37b5aefdde1a, 0x2e3a447583ce5c32, 0x23228946b7ce2,
+0x90c73f2621820729, 0xb039fb018e074d6c, 0xbe65cd39f3260d26, 0xe4da149b8bfac889, 0x29f2b19e9fcd97ea, 0xf92bdb49f5109050, 0x147e3a44030ed,
+0xea742777813b4752, 0x60ea59355ebfcdb4, 0xf48b8b5e817621fb, 0x72ce1384dc2d3e06, 0x3a470c79b409ed42, 0xdd6dbea00f977b9, 0x20e520b9a5638,
+0x3653fca03410a04d, 0xa043456a28de2e99, 0x3dc57ceb3e609050, 0x977f9a439f53ab44, 0xf285d90ec7230eac, 0xe98a52eb0db4c957, 0x6f6766d9efcd,
+0x26d218007ef0f1e8, 0x52c9a5298f84fe7f, 0xacf528a7e6822a5, 0x5a6fad7e1edb6083, 0xbf72fe0c85ec9309, 0x7ea4a7f0e2d99b0a, 0x23a2a3150d78,
+0x6179124f8020ead0, 0xa5021bd4700bdce7, 0xeab5db6da4827973, 0x42e8fb8bc3001f7b, 0x9ef84154e048cc05, 0x4b3f3217f51237b8, 0x78a28d6050fa,
+0x5061b4604b0f2862, 0x2be8fb2432aaebf0, 0xa8ec0e2f89aba565, 0x12c3bfa3ade7789a, 0xfe67c3ed3b750b18, 0x4e8b030fec628a41, 0x7262d27b360d,
+0x76ebf740cef2eba2, 0xdd4ebbdf5a0e2891, 0xe1cd45b954f91a8b, 0x8b55368711f404e5, 0xe2393b3ad4f2371, 0x8013ac9120fa68a6, 0x21d2897d99aa0,
+0x51fd3e01f9193446, 0xdba02e33ed3e0ad8, 0x128f04f612097b69, 0xf1a407f44cf4b64d, 0x7f1a70f62b6b938c, 0xf1880401484134f, 0x1ad9fe2921c70,
+0x6013c962fe7f90b2, 0x49b2d9290996dcc0, 0xfbad7a2e7192cadb, 0x4a622cfcaca512df, 0x5e12d6bb456fab7d, 0x9b2282c26b9c0386, 0x10f3a8618955c,
+0x4c5b2a8469f7ddde, 0x8b516a00bbb59f89, 0x672d0be1374eaff, 0x74310dcdb422dc94, 0x80fbbab2336b4f84, 0x93467cf0bba65fd1, 0x10e3d930dca32,
+0x4db4ca5cb992453e, 0xc51f2b925bf9b33b, 0x23cb7a19ede70202, 0xaf881fdd86de5cc0, 0x220d1515133af327, 0xbe4c57e1b2396558, 0x3a0b1e9c1ded,
+0xc9a057c47d1a1818, 0x66e97146ab47ea65, 0x3e1d21c2223d83b5, 0x1e648b4b9f98cc9f, 0xcf60c8eacdf5bd05, 0x8ad2ea2780eef90, 0x938da5333d28,
+0x8e73bd510d249093, 0xe3c30bb82694eeac, 0x9d0a56e2ac3bae69, 0x3bbd86ed24dcd4dc, 0x94b64e17b76bd7cd, 0x9a33b7c36be8f09f, 0x477475c321ad,
+0xadd3a0079d75dd73, 0x2d6b210894adda68, 0xac543d1c7b7e8292, 0x3a6033e751d57e42, 0x27a1cea6ce0e07e5, 0x338db4f5f493ab34, 0x1d53ee74cf543,
+0xcd7fdfb89c36dd5, 0x4a3cf9d5ea5d9acc, 0x37b2875fd4db77c9, 0x7e74c8ab712522ac, 0x40ecc3ddcbd05071, 0x6893613fde3542f5, 0x1f0ef414c1114,
+0x38ac52a8d13c0e3b, 0xe24db7122e13e0ac, 0x1e3311a924d40b6c, 0x63c7842722dd74a7, 0x74d5562dd7805531, 0xd1e73caefc80abcf, 0x21e193d7cfa78,
+0x302b1d4f2d03d003, 0xe349bcb6bd1eaeb7, 0x5ef87bdc28d31474, 0xfe185cb3fb65ac1, 0x79402c193cd4d678, 0x3022cbcee94aa868, 0x144bf372494a9,
+0x2e7ee062a02abf82, 0x669da4e2493cef85, 0x3fdc35a605c94245, 0xacbe92b42067c42e, 0x19294205cb9bbc1c, 0xf9c3c65b13cbc2ce, 0xa38d130618e,
+0xabdc471a0e8aabfb, 0x8e2a71b6e3bf7b2e, 0xe06fab2f336909e0, 0x4e586ea72ef6ac20, 0x883e6c0dade4e0fa, 0x82433061ad700173, 0x150571a7dfb34,
+0x3ec47527f44f7f2a, 0x54feae18d9aa940, 0x27d744aff4e7fbeb, 0x49d428c460c49881, 0xcf93fb15f27a70ee, 0xf7be22a4cec0f587, 0x10cd6f7fa6e4a,
+0x9b175d83cf043ddc, 0xb79c5256d1a1c515, 0x3d2f83212c2d857c, 0xb61ea8593125f7d5, 0x3d88efb357a8ef99, 0x744fdfa4e6b31f21, 0x161134e1aa461,
+0x822d0a3ea0592cc5, 0xd16b9b115465fcfd, 0xc8131f0c88bc8633, 0xbc356372fe426b66, 0x7061497b58e118f4, 0xda47eda0765aaccc, 0xa05e9d90906,
+0xf2bc50071a94c7b3, 0x9dfb19a4e93bbd50, 0x9888b7e1634674dd, 0xdf73d2d60f4985c9, 0xfbeb6533a3ddff00, 0x1199a0e058452641, 0xa7534d3f04b1,
+0xb8ac2d67802373a2, 0x2254a8a9a8a53295, 0x427c0b19bf18d313, 0xd0703fc2e341d4db, 0x9098da32ba8fb042, 0x42542ec9c1e7d623, 0x2ee9aaeaaed,
+0x6f42f45461c0980a, 0x54b8f3933020210f, 0xcc3ed3c9042dfcd4, 0xd5855ec00cb72c5c, 0xdcfadc09eb1babc8, 0x8d6303b9412a5ab9, 0x16d707d4aea8e,
+0x5a25a1c0c6685ed6, 0x34f62fd3c17805e6, 0xec03ce76fbad5de9, 0x520573781939edd2, 0xeb2bf480261cb969, 0xb59c4370580a2ede, 0x1c0efc22f0c57,
+0x56c2f3af4b787296, 0xa62d3dbe6a4091d4, 0xa3758b81f6d4914, 0xd99b5a5688a6480, 0xcac56e5dc872a1b9, 0x64360d66942926d7, 0x18c174c5f6327,
+0x76d8b5a17744f984, 0xec64485fd9175e9c, 0x931d80dc85fa78f1, 0x546b5217d9ead70c, 0x88ac8fc34a9f5d97, 0xf0316d811e81a3d6, 0x46c9339aacf0,
+0xcbb34b9d89bb43ec, 0x86e7ec61a5a23b15, 0x86d7cf1b45167c7f, 0x87d3696df4baaa0f, 0xd3530a33170616ba, 0x1ed9756a83df90e0, 0x222902002b703,
+0x868e800eb67c2f40, 0xc5c636161f8bf0e5, 0xe1c36e6190851481, 0xe9572652e3340701, 0x8cf5cce34ef58705, 0xd9d2d5c2b7fff41f, 0x22232a9a84ce0,
+0xf45979a72bfc3320, 0x5c1c2e66b6c1847b, 0xb51bdd4cae27927c, 0x8e69db5be5430771, 0x7872e033870b5977, 0x89e8d0429c1bc94c, 0x208fcf21f72e1,
+0x57e0b80644c27373, 0x233d3b421c4fd6a4, 0x196d2d005dbb129a, 0x5c87a9064d796270, 0x2e60fc1d73582bd3, 0x8ef92e596984141e, 0x1a6dd4288dfb,
+0x4e531e3b91fa29d6, 0x7684933acd2b9bdf, 0xf24da7507b43035c, 0x59d08b441d9f8b44, 0x945bf91a675de303, 0x6b47749f5f5fbdca, 0x1a1c5ae9fd0a6,
+0x8a1c204f11c48adc, 0xed0c84979d97b962, 0x345d68cb60706cc5, 0xb199308118e6df72, 0x6de50553820bebfc, 0x2734b8fd5b251a9c, 0xedb352f4d2ff,
+0xc3b2e48c4db1a9e5, 0xc9038ab7f1476a85, 0xf23a8664074813aa, 0xbea3aac4e980681a, 0x1117dbc93a9547c9, 0xd0a265d26648b525, 0xfb6a732ebfe4,
+0xec11331807c5691e, 0x4eb0f82fa1432dfb, 0xab2e04bdebd66f8a, 0x779b8795cf640f62, 0x969d1d569c608168, 0x7f31d80ec5a0ad6c, 0x1e280dfe723ba,
+0x1d58164351217cdf, 0xf32222061979d604, 0x80d8cec2ef767409, 0x7a4fd509094e583a, 0x6e6accc455f51497, 0x1483d8ce7b1761a3, 0x11d7d0f93e3df,
+0x36eb994bd87cb10a, 0x500f57b1f8cef139, 0x511c7cf31f7be8cd, 0x5739714c9c279d72, 0x48da895a20f05fcc, 0xb81308bbbcea8b0f, 0xde1cafec520,
+0xb32531a04f04e673, 0xaaca30b7211eab34, 0xc8efc40afa4a9bd1, 0x50fe221f3967d823, 0x87c444af2f45c792, 0xac9e22d261c7ea5f, 0x80dec63c65bc,
+0x695977208ef7d7d0, 0xea0181615d362948, 0xb503c2bf03722097, 0xc07c0b0e7244bd7f, 0x81eec0b4b8229d78, 0xe3cf78f3a7bfa66, 0x15ccf6db57352,
+0xa160a013e6fbf023, 0xc85f1978c934446f, 0x7f4c715c54b0fb06, 0xd81239a6ffdd08ec, 0x45a5dfdaa2394207, 0x50682379a8f729e4, 0x2268cdf5726e2,
+0xb7e5b566c91fb956, 0x712820c67f390503, 0x529e7d21c355f1bd, 0xcab36fd313aa655d, 0x1899b54cf86919fa, 0xff3e7ef29beddc74, 0x7c3fc6dd11f5,
+0x278f326cc2cd9883, 0x2b069245e19ac118, 0x92e1355b0495908d, 0xf05934e17a0d6789, 0xb39ba4b37b5548dd, 0x54e0b3848537158e, 0xb896986f3c28,
+0xfc28a4fbfa65da8b, 0xb1474b0dc0bfa92a, 0x2c8ef2c7622c97b2, 0x68c10bef3e0c95c6, 0x8a17ab524dd917e6, 0x197857b8dcc360f1, 0x1641150fdea2d,
+0x5d3aebd878427aed, 0xa595f596d56ef34, 0x58080ec5f25702da, 0x4b04b56c669d122d, 0x98232d1ab1a7bf76, 0x2d8a4038ffcf6cc1, 0x1475e35588a65,
+0x1800b8fbb8fc798a, 0xb03a02285b53ac05, 0xb01a2cb5ffb7cecf, 0xc868699292f52be, 0xdbe4590776adc240, 0x20b3fa20ab7ea465, 0xda80ba5b7741,
+0x4a18ed41cd795aad, 0xcd4b539c65280673, 0x8d983a9724260496, 0x9e0a2830b3cfdae, 0x6bf2a3ff55446c38, 0xefb3fa72c00fb5c9, 0xbb57ef9a59f9,
+0x699366458bcdd1e4, 0x863a4fd6803584c4, 0xb015468ab5bf5b78, 0xe7733a561ec4e19b, 0xc8f6e7f05c87be88, 0x8086121b12e7d693, 0x91850b89835c,
+0x608efd423b27a67e, 0xbe066abf8a415789, 0xb24a4aee6596f288, 0x394c132d5e6c3cea, 0x5260b20b84492b88, 0xfac6ce086da6ecf3, 0x1985eda4e7ef0,
+0x8b7f2d718eee389, 0xf568b2597d5dbb4c, 0xf7beb892ec39f50d, 0x7a1991741a93fe7d, 0xed75efdc263caf91, 0x5c8cf66eed677667, 0x60b56af7d72f,
+0x3c8e9a3b2441f7f, 0x7986cd3efc13bf7, 0xbfe8838766ab09a4, 0x45b59c53213a4a9d, 0x5e5f0d09ee0556b2, 0xd23a31b23babcf13, 0x2252f6842216c,
+0x745967108b80b66d, 0xc399f8659679668d, 0x39a5b1e587db9884, 0x3e5c60072355363d, 0x3c2dcec3a724f7c3, 0x3684176d990e24f5, 0x1d8d5e05b935a,
+0xe608231469e6c6d, 0xd366bc383fa23574, 0xed1e87ddfd0ed2de, 0xaf8e80712678dec7, 0x3afa3f227acc48d0, 0x1b6671719bab4344, 0x2123c8e08ae0,
+0x616634af9d24326b, 0xa6cf8f73bc67048e, 0x316236b4d930a3f, 0xbe8f186b757eee59, 0xd674bb406cae0740, 0x9219a6009cc670c4, 0x1efb76b9b67e0,
+0x8d4e61f483ff05b8, 0xaaca118ebf657320, 0xfbf2154163767bfc, 0x13700f7b1d4da042, 0x6eacaffd38df4bd0, 0x6b055f4141afdb77, 0x18a8375aaea75,
+0xd76590036157b964, 0x213cde02a820e771, 0x89e1d0ef79081ddf, 0x2c374850a0eb1bdb, 0x64b96cfb31bee15f, 0xb17da1b0ce0ef92a, 0x52e609f3aae5,
+0x61699512d227f4cf, 0xaecc9c33a5801d1d, 0x49387d672a6e8db6, 0x871e78d53f1a938f, 0x8c71d67a22b7d7fb, 0x95620f111895df97, 0x158cb659d3acd,
+0x23c7cdd6d100cfea, 0xc9f19c20ed1184ec, 0x9c8d90a57eb0098e, 0xe2e05bc2e130fee9, 0x40b5ac71f9317c44, 0xad4cdaacd0c49d25, 0x1f6b5909f3c75,
+0x8bfd81b32a71f2dc, 0x99cf65c5f1c2afc1, 0x5c0e7aa28f725f4f, 0xa7ed4c812b1caa97, 0x74de912d9c490b68, 0xf200bb350db70b4c, 0x21ae752818364,
+0x155afb843c1b5ca2, 0x405096c8bb5adba5, 0x93eb6a4f4e26d13f, 0x2e679fadef09b108, 0xf070898ea118f062, 0x602fcc4577fe090, 0x21723cc3cbf34,
+0x1e260c26e21e21cd, 0x7bb21a8efa7717e2, 0xc9fc0f52ba9d01e8, 0x3bb5c1be225d6ad6, 0x664b99bd5f0828ea, 0x42892a041eafa5b0, 0xcfd5fe7f2ca2,
+0x4f62813825e89d38, 0x468a8bf1a0724e30, 0x4aa9cfee0f61e07f, 0x2a304b6a509bf495, 0x3fe8cfb2980c6f1, 0xcd27640a0fd5ecac, 0x198473d73aba,
+0xcf39f348ca05458c, 0xbb322c50003cb367, 0x914140f1c0dac99b, 0x2b2eb8cedccbb96b, 0xcaef42a0e51f8673, 0xb6b717aaeb28de58, 0x181387b0f1638,
+0x389023764483324a, 0x819ba845db38febd, 0x812e1e44fb8120db, 0xf0bfe8136b9cbcf2, 0x3c27f003408b33b, 0x90acfd56f9665a74, 0x7c01d2cf3134,
+0x2d564cc35dec4bcb, 0x4df5db6797bbe455, 0x2fb14d85b98ef47e, 0x33d6dcebb05dc6da, 0xc513c9f7a4d99b6c, 0x735c5dc7114848af, 0x1c1a977335d52,
+0x17e5055dfe872215, 0x1f3a416ade4195c2, 0x458d97443430f755, 0xaa2efa239192151b, 0xeb9341b2b65a8497, 0x11207b1068e23c78, 0x1b3abb95f5957,
+0x68f852736019395f, 0x870b89a2dd87a132, 0x29df7ed528d8bb1d, 0x2dea62e8f8630169, 0x2f79cae32636da92, 0x41be328523b830c0, 0xfbe51475f259,
+0x9981127b7c4d3284, 0x246a42bf4a83cacc, 0x9d3f63245d8e80d4, 0x380857991f4aa5b2, 0xb0d3f37a705cc2fa, 0xe961251b8fe95d4e, 0x21f09ea1cee55,
+0xa8475694fe340043, 0x70a5c8512fdc90ca, 0xe179176c01841ae2, 0x187c17b06eb4582e, 0x684ccb4866a1c0ab, 0x749e55abcae23a11, 0x201bfb7b4fdd8,
+0x3ee7153e08b8aa77, 0x36f9aeb463f971db, 0xc307f5b96637053b, 0xbc3b18cd9f35bb38, 0x5c10dd5b715730ae, 0x3ce5f624d012447e, 0x1543d8be6ad4f,
+0x32593028ae3f2f91, 0x91efe05e712841e, 0x3d8f64687a5044b, 0xc5d63b158e0ef7fc, 0xc458345fb6cd5b88, 0xca24aef467ef1977, 0x1e247515b3909,
+0x1b7bfd1faf017f9c, 0xec59a2e511d7c6fb, 0x51dcaa74bf1f5487, 0x56d45085c8e9c539, 0x273522104d234af7, 0x9cc188da229905e6, 0x862ff66e667b,
+0xf981b20a81719d2, 0x3081ae351a862d4e, 0xe23f62558a18c1f6, 0xd3a636fb3a4f2e5a, 0x7057eefda1742d9b, 0xfe89f1484ba80b1f, 0xcfc3c73bef49,
+0x7391227e2f3940d2, 0x16546e147f1085e2, 0xff0004af6f2b0cf5, 0xb74ede1caff1cd05, 0xc88958f4e05a02d8, 0x692091b124383d3d, 0x1c59e491c9dbf,
+0x3c138b2667fe9624, 0xdb2ee5bf287df247, 0xe7fc10a195ae5e75, 0xb1affb47e106da7c, 0x42a7d67e0c3063d7, 0xee6a36c2d51fb3c3, 0x21ee9fe1e523b,
+0x2866bc18cb46bd17, 0x1c58d567e13db996, 0x72c4a57b5d5a7541, 0x201ddf99cc6b3bd6, 0x3d7a2a4ac0da245b, 0xca51dcdbc07bd234, 0x5110baa3d089,
+0x1116d30ec55e2cdf, 0x469f44626b9451a8, 0x5b6fae4f802265b2, 0xde5afe003510c2c3, 0x84001f3737e6e5b3, 0xcc892254d0671ba, 0x1216bde1e7437,
+0x2951ffd8a5ff669e, 0x8ed96e6ac11705a4, 0xaf5f9fb51e5f4242, 0x1eed9e3284cd2f7a, 0x75de37ad56d12926, 0xf9a48c9b4dd65c56, 0xeb72647be6c,
+0x1e9e78293972ad5, 0xe69e1dc90f59f7b3, 0x25d1e9900afcdcde, 0xf05cf1cfea5958e2, 0xfdbce340f0147c24, 0x3d6bdc0f306d94f5, 0x2af79c869f46,
+0x8bdb47fe78c58a63, 0xc8af96e36154ed6b, 0x48ca77b0cdc0d9fd, 0x4a76f15402b4e6ab, 0xc54821764b36706e, 0x3c310bc3cae37214, 0x156b0323a0edc,
+0x11c4b546ab650b, 0x2fb1832627ab7a36, 0xe928dafc1ec60447, 0x614ed00bf97455b, 0xa06bac697c6c109f, 0x7e0789d8c01f7692, 0xe43b338c83d2,
+0xccb06d19d13f9a52, 0xb00a656033662941, 0x8ec4808c7aa8835, 0x4ef220e11734c620, 0xc50a34471f393703, 0xe43435b5890f518b, 0x950c9a681a8,
+0x1c79569d0d88cc7f, 0x1fd41aaf5440aa03, 0x7c430c00a9eb98c1, 0xe45f071659ae4374, 0xe2332abb0e1fb07c, 0x6260e74824030d4e, 0x1d23bfc83bf73,
+0xbfc8cc757256b3a7, 0xc73100f816cbd88c, 0xa63a894667956da4, 0xbca16037243cc803, 0x8f32b4f20946fdb7, 0x69bd65bb05f4bc4c, 0x48aaacc07bd4,
+0xfed640a8642ce572, 0x82cf0dd678caff90, 0xddae6c534241691f, 0xad57f65ed23db888, 0x2f98131419d2d624, 0x384b7755ffa68163, 0x11d209f896771,
+0x1ad2f61c34caeb2e, 0x9a6e4628175333fc, 0xff9aed9b0799cc41, 0x92b859f3a2013188, 0x72f8acc6ee981f24, 0x7220eb2f5955a126, 0x53ae01bbf5ba,
+0x4f2a329d7cf93d43, 0xa669c78cbc525dfa, 0xe4b12e27fbd97cb3, 0xad2c7eb1cf54429f, 0xb4902bd1f040cf16, 0x51803aa96b9120e2, 0x1c682b5365156,
+0xcde41a4d8a7b2f38, 0xa17198b6471e015, 0xa6892808fd52e49c, 0xe790a5a9ba1f0e6c, 0x6c72246b49a57bbf, 0x4c7eb3dc4638d272, 0xa8321e2f343a,
+0x4c693df2d402ea72, 0x1f66a4451f1fa9d9, 0x6b7a389e612c81b0, 0x24845d952dd3c2c5, 0xaaf1a3baf75436e9, 0x4046eedfb08f1e47, 0x1fdc2b1ae14f2,
+0x4e3a27ee330d7641, 0x6c2c1be352fff005, 0xa5616a2893ab118d, 0xf4c5bdd1e68f9705, 0xa0dde448a16f95e7, 0x1b336baacd025626, 0xe36ec5255e00,
+0x84c34c1fde0354c9, 0x9e1a6ffa90d89e43, 0xe91ba0e9c7dd287, 0xa63e47a69dbe5208, 0x48b52a6e31266d39, 0xf65790c847bad3e1, 0x520f60b5d554,
+0xe4bfc5eb32dbda97, 0x5e5973de1b4ecfa1, 0xcf5e81b3d4e7a14, 0xa05779cbd197c46c, 0x4e51ae94528f6d51, 0x3ec8ef5fdd3411a, 0x101861e63cd9d,
+0xe461e866387abb, 0x240f4a971ce7592d, 0x5eaa72873245a3c6, 0xe683d83464e2fa79, 0xeb4367a0baeb7349, 0x29c37e102717a200, 0x4d62f6d5fbaa,
+0x78b0d627af55944f, 0x1da8f833b8f6adf8, 0x221004307055e9f7, 0x1feb6c0c92494026, 0xb0d7011261c2643c, 0xc2cedfeb20a35a38, 0x180a996b85152,
+0x23ca2fe471f71596, 0x2d7f7019e8a125ee, 0x221c85771949da69, 0xf467863d436c49f4, 0xbd5ff4b39523a96d, 0x8cd45668e2620b33, 0x185c11e37cff,
+0x7e7ecf5bd6304301, 0xa0694f0742ca7455, 0xa0a90a832bf47353, 0xc37080e8713ca211, 0x68ca348bc3e36a4f, 0x13512787fb3d4398, 0xaaeca7678952,
+0xc66e4755647ea21, 0x476c92c80f7f6fb0, 0xc338043d447f3783, 0xdc5650f71b8acabb, 0xb26ec914fe02cdeb, 0x4ba74f0b684d873c, 0x5ada7ee97b9b,
+0x86516fe4dc43f110, 0x96ac421de4c528ca, 0x4b9afc5a34b0287d, 0xe6eaa10ebfb0a702, 0x9c006fef06ae027d, 0x14a2d493d32315b5, 0x102460af76a7f,
+0x6b29a592b4d2ff97, 0x2571dee438d9df01, 0xb0eda889e16e255c, 0x9ec56ea68866c0ca, 0x94ed4fd326977eef, 0xd2014d091f1a631e, 0x2056ea4bcd80a,
+0x12ec3ce6fee592f2, 0x5f95b808a2ed7c18, 0x135def2a4206a930, 0xe10b9d8e6579f6e1, 0xea94e3a8d7a7246e, 0xfd8d74378d6c4f1, 0x2b5b20406fd1,
+0x1e3fb030c90d896e, 0xd8e33ff8aea90f22, 0xf52fd030e1413dd7, 0x62d9adfb890030c2, 0x4e2bf4ca87d4daa, 0x738e4306c1c65078, 0x9887bedb8176,
+0x21056f7fa3c55107, 0xe12d972265acb6ef, 0x88d9e6d764c697af, 0x1f9218c704914c2, 0xc0583cf501066297, 0x53768bc7ed2060f0, 0x2290e01bf59cc,
+0xc08b7528db8873af, 0x6a17106fe4cdc5d3, 0x6e4503e949e1270f, 0xda54a7f0ec6f03ef, 0x3edcdc7c349f658c, 0x553a5fd261401d75, 0x18d328f481af3,
+0x644172a1ea9e4088, 0x206ff42a4f4a348, 0xa93c783264d738a9, 0x631d107d59f640c8, 0xfe0ba60d5b04b5cf, 0xc8ce2449fe2eba76, 0x15678c7bda9e5,
+0xf06c1736f9b15964, 0xae17762508937bfb, 0x56fb2c75a284c71a, 0x37e0807dc1e42489, 0xee72e0dc7e893fb1, 0x8e53fc875d42a13c, 0x719fb8fbee26,
+0x7a9147565fc88c2, 0x38f9da45bcfaa755, 0xb45c3c0bc75bafa4, 0x23fdcfb2bf1f4aa3, 0xd4b06526852f4729, 0x94b3b4ce42c8826f, 0xe6e131ff7431,
+0x50115ecd29c252ad, 0x563e32b8c8f96eb6, 0x3475096041f619f, 0x4c8ae40bb5abd7e9, 0x82ddbb833206a05c, 0x5d02b459bc59c29a, 0xa790b0bedb7e,
+0x7ac538ded632f9fb, 0x644ef2f47a45e5b9, 0x85add548ecbab90e, 0x495f278a67eb2cd3, 0xc8c03462ebdcd0ca, 0xbcdce5a206ee05ba, 0x9b61043d7bd7,
+0xd9260b3d10d65271, 0x5a3d21e6445fc5bd, 0xa80bb57280ae2855, 0x30f12d0ea2568c41, 0xa16af8b7bb9f7ae8, 0x8aaf282a64c76248, 0x116a4836b0e74,
+0x8c9e2f1e345da0ce, 0x8eab7800406deaed, 0x2a9f68a067b46ddb, 0x6706a08ed4937b2, 0xe2f37840cedbe1d1, 0x39a4d5e6d00ae582, 0x18407837e6928,
+0x7085353078cef7ce, 0xfe0521c0e4b3fc18, 0xd2ac37e4a8136051, 0x1a51c993d7d8c202, 0x76d8d888a3609c94, 0x4b31571db735a83a, 0xe6912c387e83,
+0x368e80c092ba7fd5, 0x980ecc0d42104ae0, 0xb29073fa2d09684f, 0x29d09e1314a65ef7, 0xa1be7f4c9c13d958, 0xea7f7dacc9743d20, 0x224bd7a4b2180,
+0x5e31942f6604e5e3, 0xacd34f5c045854c8, 0xada1211d9c994608, 0x70f70d9751a3ac36, 0xb44bc18896dc205b, 0xafcbf016225bd59d, 0x58f05c95d007,
+0x1ccdced72f9b0f3e, 0xc979937d9441fe22, 0x89f82ef48399d71c, 0xcf129e937afc0cdb, 0xc1db9a0251e3b996, 0xc39d3fb81b8b1fa5, 0x218442a9e5a3e,
+0xd642c38940526c3c, 0x53c31f67d15dec7c, 0x49edf9376e370100, 0x90a7a3664418481, 0x35adecfd5dda311b, 0x3b4fe36cc6125048, 0x1092969e77482,
+0x7158647952e47cc5, 0x4d04d4b7d1e89ee5, 0x2e7f4d23cf1b6eae, 0xcbf75b58fc4dcbe4, 0x32e63c1e152f0755, 0x5899b2bb0294b30a, 0xfd027f474d86,
+0x821eb24d3d73859d, 0x842e24ae0ab6c885, 0x1a0b1cfc7a8bd896, 0xe783945608c99406, 0x8e4943af40d624f3, 0x653def1bbbdf1efd, 0x20c27c9e5f187,
+0x1d573e6738d507e5, 0x6ec3ccf804604cce, 0x68c2b5b032402c80, 0x4332f1e9c6ee3925, 0xdb5a5011ad12422e, 0xda611b7e0514b894, 0xc997e4b07614,
+0x2eca13a788636a2d, 0x19c7b8747fa1cb3, 0x3cbe8316b19c8d1d, 0x63db466a8511e55, 0x2894b2485eb7c911, 0x91cf8fb66af0985e, 0x1a9b449b0870a,
+0x5aeb2cb617f07bc2, 0x6df44014b4971135, 0xb6f572776f01c020, 0xc7204c71fddb56e4, 0xe381be8c417a435a, 0x47393f90a58aa0eb, 0x16c03a6af5429,
+0x2fa7d6ba2e38733d, 0x2bff1dd186844637, 0xa3e610ab9d08b2ba, 0x9487940e3888dcb9, 0x3e3674a8bb25044d, 0x96547317c0949685, 0xe1b4b4568b85,
+0x4db917d4b97eb4c7, 0x1e3554d1b71b3683, 0xd54c06e007dd00de, 0x3ed87cfc495deac8, 0x83cec081de16429f, 0x107da7f93734dae0, 0x93176aa94d99,
+0xbf65885f318cbf4d, 0x993dc6d60b9070, 0xdbe7ed3bfac8e31e, 0x87ffe59c3800e45d, 0x7a5701fd55f5a56a, 0xc1d59949f1c9db40, 0x19410313230eb,
+0x2be730be3877c48a, 0xe35e9f75878a4626, 0xd9e73581b2c122d1, 0xc0826bff2cab524b, 0xdc5d3e2224dd470a, 0x5cd846c3c34eb91f, 0x2282bd1ea4a40,
+0x5420998c11480327, 0x83dd73c027b2ae37, 0xc1ddfcf432fd4a11, 0x8be741acc0d62949, 0xb3f19a2e2745924e, 0xb6d6ca67e50a8168, 0xb539cc036757,
+0x8272550927f21717, 0x41278d84262710b2, 0x70adc3d83806a3e7, 0x4c1b509a1ffa2175, 0x80e298143aaa546a, 0xd3fd8f3c071f8172, 0x2134b7d339104,
+0xd55d7bee81dd6925, 0x488e462d44fb218a, 0xbeb7fb507ba5f0de, 0x803718000a56d93d, 0xc60fe3a90160939c, 0xc1b813a00a5c21b4, 0xce2a18bb6510,
+0x5c86c976fb25e4cb, 0x3e3e1c4c63a02f58, 0xfe66dbc4b9c51799, 0x51f22cb7976b3050, 0x33ad9b5db41fbc40, 0xc596e02d929553f, 0x1100b5251a395,
+0xa87721ec765a4eb5, 0x1afb7660768bb8f5, 0x89cb25e7c2613a33, 0xf264bd1070e1e8bd, 0x9f576bafeb5932a4, 0x4cb703079c15c926, 0x1b4f4471f64d3,
+0x6d5cc4aee191e3ae, 0x90ee85c805929d3, 0xadbb70210f671798, 0x87be3c004845447b, 0x423068ce24a8c093, 0xf431eb65e6f01236, 0x2227897f8521e,
+0x4bcc7a73e67c132b, 0xdacc8bba413c5a41, 0x32adba34be1fb686, 0x52a8d209647cfc57, 0x78b3fb52a8e4c56a, 0x83b785cfb98c134f, 0x1d5de79cd7630,
+0x3bbf92d417ba6f19, 0x1a572f85b49da344, 0x6ef6957c4d1c4b74, 0x36024b9d2c3ecdb, 0x9e01d45680ad416, 0x3c5e7cf59d15936a, 0x153173926e484,
+0xe77f9e4a7aae7b30, 0x300332f4ebd48802, 0xb03f91f230ca7648, 0x79063ba58478528f, 0x51e74e757198360d, 0x64aa9c9c39700886, 0x533a5fcf9a28,
+0x14164e4ba40c66f, 0x89919dd73e4ffd73, 0xb7d9d85605de8eed, 0x953e311a1e984e8d, 0x59b0db523a0b70d7, 0x68c9d0acd8582c56, 0xcce90fddb59,
+0x60c103c57aeac2b, 0xcc04a384ace34985, 0xc5e3f037f5619732, 0xec811f49b2e13282, 0x68f8949535c6699d, 0xf6e1cb5c029d9574, 0x1661f1fbcf906,
+0x81c7f31d8220b884, 0x3a412b3001ea5cb5, 0x873e7140cbfefec6, 0xb2b2cc6b88ac84c5, 0x8aa5afecdb5a5e46, 0xbecba35116516f27, 0x1a5b415733677,
+0xeff17513dab4d8e7, 0xfd6aaf0b8982188, 0xb0f4e4e1b9b6e64b, 0xba1f049576763849, 0x775f9b5189a008d6, 0x5a204b35c39c21a0, 0x2054328f3335a,
+0xc09b7ac380257e4c, 0xfac3474340977748, 0x504ddb207201b4cf, 0xb10a1be134b64171, 0xfd06b51d9e1ad533, 0x7337cd5023b05b9c, 0x1e5f7d7492f73,
+0x1674baed682d0375, 0xe5be8d3707599e44, 0x4310900369c5aef6, 0x5aafcbacb5fd7b75, 0x54dd93cb77c21b8d, 0xa2089fbec5d96199, 0x1dfb2cc63f589,
+0x30f5d8dd9bc09f3, 0xb8f7deec7d0d26a4, 0x567a5fb5d33c194c, 0x552d3e7dd367353b, 0x9228546bd3208263, 0xfc29154e4f455d64, 0x1ce3c35cd8991,
+0xc305106b26d2c77e, 0x26c4fb697c1d807f, 0x96f34594b87aff3e, 0x9819ac00b484843d, 0x707a6c70d9a41c8, 0x36a8ff403940ed2, 0x15a422416f895,
+0xc3ae354e968dfe42, 0xed1c0db7faeb4617, 0xb6cbc1c54a6973ed, 0xccfa86509d19a1c4, 0x36cce9d7dfba34e4, 0xdc0fcff127859b4e, 0x11fca07abb22b,
+0xcff0e9488f7b45, 0xc9d2eba00d777468, 0xd09dfca5257c4b00, 0x8be06ee0953e584b, 0xbad9314762d15462, 0xe6cf371ca2ef42e1, 0x3081a7e07994,
+0x67e1a8de601d0f15, 0xb65d382f8aa0b250, 0x3028e905c9dd774, 0xf78fec8c71b42728, 0x68632ade69aff9fd, 0xeb0a126d23695a1f, 0xd730b111b177,
+0x31750fd9e93504c9, 0x9559278602ea8b93, 0xf8c42fd5bd5943dd, 0xbc00919d6e19ee07, 0xf41552f9dbeee4ae, 0xe664bb5b03eb6b47, 0xdc85fff96830,
+0xbf8d32fbd1e71d41, 0x6787eb77cb965ec5, 0x3f3ce577dedaab9f, 0xde4bfa3685ad8746, 0x6a0741d4d7faf138, 0x7830006c8e54bdac, 0x7aea052857c6,
+0x30773b0f96b3c6ac, 0xa51de95767403cfa, 0xb39657c6074b2eac, 0x9a802b053437b4d, 0x802313127c98bf67, 0x66d2b1cbe173c5ef, 0x1faa460ab3606,
+0x639e0fedba8f533a, 0xd3ef707dd977e1d8, 0x8b5100cee274af72, 0xc964ab539057a84c, 0x359182836a510fa1, 0xe925cdfec4eb535e, 0x155eae50cb348,
+0xe226a8dc0fac8160, 0xa9a96d6863695a58, 0x735af6c9bc45063e, 0x4662b8cb37e7185f, 0xa8cf11bd0f2a31c0, 0xf7078cf89e67f676, 0x22df11f1dba72,
+0x614339bc56a2e439, 0x637dd0b37a6c3f07, 0xb26323a49ca41e0, 0x88351c0240637745, 0xfe811b6098eea142, 0x1345fbbb490a3c8, 0x1a03cf37c66af,
+0xe54d85fa89e2d287, 0x30220e40e244c115, 0x92196a094679cdc4, 0x127d3cd39ccc282e, 0xba4095e0478d5335, 0x5eecff44d9233d5e, 0x185b558609eea,
+0xbfeba744092b9d40, 0x645e3947625f708c, 0x557cc13ff4584802, 0x41559e44c51d7fe0, 0xa04bb12c7c7e81ef, 0x14a6e9cb8dd8d84e, 0x9e82847c99b3,
+0xc6c00af58ec45c2f, 0x63830058f0ada5ac, 0x5e365f5e384f5fe8, 0xe75e264b1709ef1b, 0x519272bf8e92afb2, 0x174347306a32b8dc, 0x1caf00cefd93,
+0x76cf6b503f9eb8ce, 0x106337de0b843be0, 0x9c0af41f9b6b6918, 0xb83f52178f7d2aab, 0xabdb59311ddb259e, 0xb9675df4f37f8fe3, 0x1f6e440e113c,
+0x93420527d94e0ed, 0x95f54ed9b035ff8d, 0xa28151eb90d33c1a, 0x94548536ea48f4c9, 0xb3766f17ae29c510, 0xd4a3baed021f49ef, 0x56a1ee6c5bf8,
+0x2a6d97cde4096142, 0x4d87ae29cfbdbde9, 0x7976aea2f6f0945f, 0xaf224d88a3cef98b, 0x4f611bceb7294d7b, 0xfe4767f746ca7ed4, 0x1a7a31cf0dd10,
+0xc05cb18ebf179a4e, 0x77732fbe1b79dba7, 0xbce9b6de19ebd58b, 0xf6229fd145a5a45b, 0x61a756df0feeacf8, 0xd5a696800732606e, 0x18b7d9be4e885,
+0x307f4166c42def40, 0x14c2a6468b6b2b9d, 0x12173f9193615ffb, 0xb00ee904cad8a879, 0xe2ec2e522e3e3c36, 0xc770800b087efadd, 0x5dd2566a9f54,
+0x8648fb4b932a10f2, 0x7f4e7d680e7948e, 0xdb13aac00dddb55f, 0xfe8812b646f3a1c, 0x5a3264ac96654134, 0x8f2c046197537c79, 0x13f1a3f683b6f,
+0x5c027844fe658565, 0xbd0903e43cf263ef, 0x730a8bd4173ce9f5, 0x9b49b9425050d67a, 0x1bbd97d1ec547f2, 0x3d29d7531fdce744, 0x1766552baa8c1,
+0x991a56422d7f2663, 0xdbfc76f5dc3c00a2, 0x3d67ea10b5cb3c72, 0xee9ccb65c15b8a95, 0x927637d3772305e7, 0x59b56ac32c454a69, 0xccd00f2d3315,
+0xe8debed9602247bd, 0xaabe85c4862ab126, 0xec906dd94cdc1a48, 0x57e0afbcf09473ba, 0x8f8e33e46815fce5, 0x3fa99932b63ea8d7, 0x1abee0475f2fa,
+0x5400d3a6f6005342, 0xd97a01b5fa958711, 0x48b36566b5de590c, 0x84b8716ff95c13cb, 0xbd887a12a15971a4, 0x320747d0d948bc80, 0xe0452f52765a,
+0xf66c2df73caa5fce, 0xdd89d0517f62ce0f, 0xb1213fbc864106ae, 0x909b53ac064fc3ed, 0x6a060e16d52acfd7, 0xb1c5e0bc823ba286, 0x21cc677b945eb,
+0xcb4ba71b806985df, 0x7e4ee57785a7d0cc, 0xb79f5346ba30af21, 0xd444583e6fdbee4a, 0xfbc87789d9cb8f8c, 0x43792a7be59386a8, 0x24fa2500b1e0,
+0xa004a03f20e5b63d, 0xdf759da453a906f8, 0x30a9bf93340a9ddd, 0x13351b17f5cbba8c, 0xfd9f70c74becef79, 0x901bea04e3fe7e89, 0xde30097af79d,
+0xd7ba4e2a8606d822, 0xb16f5f17044301e3, 0x49b2076a7479a069, 0x4ac85df8a28cb9cc, 0xc4c5a36979ddc7e9, 0xc38692a0f7f2028f, 0x1ffa2df6c5548,
+0x35a93a1076f1b773, 0xe63d4d0f00a12c5c, 0x6b34d19ac2883e08, 0xfad5b60443e97d46, 0x840ffee2b84a0a8b, 0x1e2718ea84f7a019, 0x18c7784bc688b,
+0x775aa871c43d9e56, 0x496b19804eacb9a, 0xe392c3e2277961d, 0xa0f901c685500812, 0xfd798f1db7823bd6, 0xce148b0a3eb08754, 0x1461987b3a999,
+0xc7bb4489212cf68a, 0xcb68ca2e20d5e89f, 0x7fcc4e073eb8e73, 0x167f28bf1d650526, 0xcae4ad9409a43c, 0x8cf282b4a622253c, 0x1dbd125a4f22c,
+0x984bd63103d5488f, 0xb7e3eba73d6097, 0xf91954592649933f, 0xae33dc00e84855, 0xc3feafec10c7d528, 0xe4efa47d7961ee87, 0x1ab870e79dbea,
+0x81ebc52f0ea11457, 0xfd423486f6cd1173, 0x1a1ebb7a883ea79d, 0x4cb5054d92135a8b, 0x870812a9adeff23e, 0xb815e067d34f8a14, 0x2322859121ce4,
+0x608bf411e88ff01c, 0x5d0a98ad2fbde6ff, 0x32cce89208209150, 0x6b5762f5f81505ca, 0xe3b333b74cc1875f, 0x25ce98b0f0b7d012, 0x1c91704b33a47,
+0xbc89183d80c08221, 0xd142943fab3463f8, 0xb7fac9cfa450ea6b, 0x2a30f0ff112f2da2, 0x58c290c026ae18f5, 0xde7e96de69295618, 0xb93b17ced0e3,
+0xd90b354b8c1aeab9, 0xe2f5d84d4705b8b0, 0x2e267276f5f4b51f, 0x1f07cb18f22aecc2, 0x1e4faa6a530f99a8, 0xf413cae41858d076, 0x231744fa2ed6,
+0xe4a769d76ef874a1, 0x61252703c6665384, 0xe03845e2eda23c43, 0xada92dc9ec8e0d4b, 0xe1aedd73c27bc2bc, 0x7849bd4757352cba, 0x64f32a4bcbb1,
+0xbc9e89f7c1278106, 0x6d27480ebbabdea2, 0xab6f460f93328741, 0xb3e18d31475c5833, 0x35871d3dc6d5ff0c, 0x463bd6d4165a3699, 0x13e272e94cfff,
+0x73c91411808dc80a, 0x3491a42eca0aa62, 0xce26632f66ff18f9, 0xb442bc97eb01697a, 0xd2418cae179700cf, 0xc23b2cb73fa4e183, 0x14117aa3d141d,
+0x964102e56f84f6c6, 0x3eb5055c4391e5f8, 0x9497777420a6c167, 0xf229228a95207113, 0x4c86b4ad5cdfefd9, 0xd59057a8a0e5ccfb, 0x167cc724b7c4b,
+0xe0e396cc25b3b038, 0x70b396f95453000e, 0x802abed108aa87e5, 0x511751300b7cbecf, 0xc29ec4d1f3f354fa, 0x8c59b14a0a633d6a, 0x20f67655f6ce1,
+0x4010cf3108c29e19, 0x529595cf48fa112a, 0x6151a911d0e4830e, 0x7fb2a07cc437b45f, 0xbcdfda5225825f6, 0xa9fce95533764129, 0x8d41f264cb54,
+0x1c3d4002a4462133, 0x4569b7878e99ad51, 0x542772b1bf329f8f, 0x3c611ee34998b942, 0x9a5bad72d0a27923, 0xc952b60d2ecc1d74, 0xbf6efec29315,
+0x9ac28483d56f3a61, 0x4e6b20fd7299864a, 0x645ff64bfd14c001, 0x19602c453a75f123, 0x631346e922116d1f, 0x394a773f41da1218, 0x1d711dc9ff23a,
+0xbb980bf71f612c2b, 0xd7b0bda35caabe1e, 0x43f4e322e7b1345f, 0xe2b71440990c6300, 0x28c7e8838364566, 0x2deb72a97a4a4de0, 0xc858754950c6,
+0xbe79e36f582aa9eb, 0xde1ad0c75932a6e, 0xf4184beaf8e13157, 0x941938bc6e631208, 0xd8269d0c89fd0856, 0x512e3e31bf91aae9, 0x145ea4ed8dfb6,
+0x363e62397dc27e27, 0x8aeb2f437c76bcb4, 0x45622a2435648db3, 0x58cc7a3e40594bca, 0x12b64e0dd435b191, 0xc672cb704a87d1f3, 0x191d42f149b48,
+0x8ba8f527fe0d32ec, 0x61bddd260e680eff, 0x3fc8c284f8a682b7, 0x8ad5ebda3b9cf220, 0xe06108de710ec696, 0xe0e55623807844e2, 0x11b45c4266885,
+0xb70411547a76d2b4, 0x36739e980eea6230, 0x3b8b6aec33f32c45, 0x40d8856e99ef59dd, 0x58bab3c2f57cb120, 0x532edd20057cf1e7, 0xdc5248ebbbbd,
+0xc67f7806e7bcaa22, 0xbdc01c9adb139ffa, 0xd06f88bedbf20f4f, 0x4ee8f75db210a2a, 0x29acc7e637429b0, 0x4062cb1a694b3e9a, 0x1cda48f5bd3df,
+0xee3f290bab431b82, 0x64ec1c76da59a0d4, 0xd6bfae13fbc00eeb, 0x7b9069a9862b46bb, 0xdfc9174c60545cc5, 0x864e0993582b1cf2, 0xc88eebc259b9,
+0x152780f3d88975ff, 0xd32cf5e81545ff1, 0x636d009a45ed1f6a, 0xa1e5375f22443e57, 0xc700a24d25447927, 0x878fe737146426bf, 0x4491eebdf99c,
+0x6689d23d0ed49f87, 0x1acb369c919c20f1, 0xd43d8d0f6fac65dd, 0xe7bdfe0121fdd1aa, 0x860a3863df4f0fa6, 0xa98844e881106ec, 0x85a608e8fb49,
+0xf01b25e3b873cc2e, 0xbffc842e05fd142f, 0xead44a12ba4d2a0b, 0x59b031e6287938ee, 0xdfc90642b7d0a20a, 0x2f6ee63e9429930d, 0x420509bc01cc,
+0xe6e31f32fd35b128, 0x2ed431c2bc798747, 0x7d0c00dc95049b3a, 0x7cf706f6da45d73a, 0x631790885c209640, 0x634e4accecf57216, 0x1c56cef8ac6f,
+0x7fb51df97f825e0d, 0x512d8f04afec4d0f, 0xc879d4e785d811ba, 0x8b2c587aeea60022, 0x8d460617146f9dbe, 0x5c358fcb9c4fcd36, 0x1c02aed73a974,
+0x17e336e3eacd0462, 0x415a523e3531af63, 0x3bf3ed186532edb2, 0x9648c44f42942bdd, 0x25cf04d5482c2c1a, 0x49b34d0c765bfa5d, 0x226e8cac7ea85,
+0x8fa17baed0b117ae, 0xd3e059a1614e1aa1, 0xb197da5465e8b033, 0xbf33a61b5d4df4ab, 0xb69d6ca017336ff4, 0x99c216a91074d132, 0xcd5cef213d7c,
+0x1534881cdb8184c6, 0x18dc22bbfbb2cd19, 0xb44e5ca5931d77a1, 0x239198357bfb80f3, 0x24f4207269a3c623, 0xc33519463b7f8edb, 0x126908ac5ae3,
+0x7a74c7833072379, 0x1cb93c23bc3006e1, 0x25ad2de31522df05, 0xb2098bcf4816bd6d, 0xf4663b1c43027aea, 0x821dca1b8672b77c, 0x20b1fe64f868b,
+0x2de0e7095f9e432b, 0x402279e6dcaaa087, 0xc122885cebe1d192, 0x4530366a329bad29, 0xc7d8127bf80a327c, 0x3f9a52142a5341e6, 0x12df0d8747cb,
+0xf015d1198bf89513, 0xc7295616fbc390a8, 0xc828dd93b2c88244, 0x9ec5762588d7dd41, 0x871cc1f5d7638cfb, 0x1d4764f1ab084d94, 0x1c3bb7d39bff6,
+0x9a4c8b7eb493b9f, 0xc2b3f255c8d760ed, 0xc513574fda000cfe, 0xfeeb22135ba4dba1, 0x5bf739b4d801a1ed, 0xb3984628781a89e7, 0x17ebea05da6e,
+0x499bee12295cea25, 0x1d64b47348a34ff2, 0xb3ae6222d28585f2, 0x2b3c1e274eb79bc7, 0x1a80a1a756a430aa, 0xba88051f1f7763cb, 0x16b6341660339,
+0x50da18c41da2f3db, 0xe869838b944f05d2, 0x95a8b3b06088bb7, 0x5f4ffa1d6a74fdf, 0x2356cc3766369e59, 0xfee6c905517bab53, 0x8e028886178b,
+0xf1fb905fc9bae7eb, 0xc5e0d6833e1471f, 0x2be0e4b788e8ed27, 0x654bec502b0ac864, 0x87d60450cbb8116b, 0xf849e3f63d0afca, 0x3e7cf77afd2d,
+0xad94e6ee494abb87, 0xc93fb271a8c26605, 0xaa3112cc97bfcf5b, 0x6c6c19f69071243b, 0xc41c35a98a92fa3c, 0x70754f0f77eae4b5, 0xe92b72200ab,
+0x93bf6b70b3ff7f95, 0xf97610490ee88533, 0xfc70c7bb2621c15b, 0xa73430ae6e735170, 0x259fbc082d408b90, 0xb5ef2d9c72d93efe, 0x16c2424db2998,
+0xbed38f08994db923, 0xe5ee785b8870239a, 0xb53cb4fe55087eaa, 0xe10af74d5bcfa7be, 0x81ebdca0fc2aa63f, 0xf17140ed8ca25cb3, 0x105a18e2fea52,
+0x27d57278f4170f3f, 0x351dd83485585a0c, 0x4ca9c5f935bdeed4, 0xd23749fcf4088b51, 0x686c775f9752ec22, 0x94d7073e9dd868a5, 0x1de5125b305a1,
+0xfd4e617e8454be1f, 0x471093a0feebd32b, 0x12454c90a29ba422, 0x2cc687bea43c9ecc, 0xfa0222785893b4fd, 0x797406c43f60dda6, 0x1fd2399200744,
+0x697c04affeef571d, 0xf0b1022393e272b5, 0x94f3f483a7209432, 0x77058c6d250b774, 0x13cd6e2b9c7c20f7, 0xdccced7768fcc048, 0xefd6faf96143,
+0x224f1f30ea3a451f, 0x87b7b8a53e826615, 0xe34632ef47a27553, 0x9f0cdce40a2eac41, 0xf5cf6f2cbf2cc686, 0xc5e3fc894a29ac46, 0x193aa9749c22b,
+0xdccfc524ce3152e9, 0xbb1fd80e57d56c8, 0xbe63a62771378d61, 0x83f1565bb81b6078, 0xccad39c0c9a9f2f1, 0x71e430f01e4ecb1a, 0x144839425a00c,
+0xd92d0ffd447a72fc, 0x7f2af77c29fb471c, 0x28643c5705864623, 0x99a88aaff820dc18, 0xec0a7d6f4abd4ce5, 0xc54942c0762e7836, 0x22fb90a567045,
+0x80fdc2f1cfa1ca3a, 0x999c884c29a29810, 0xbc98d07e123d8d9a, 0xa73ccca316ab3d9b, 0x3a07ad7264baa578, 0x6a135c8c36459a86, 0x1c47711df92c0,
+0xfe16dd384eaf7ffd, 0xac43abc085e145a8, 0x8c113762e8d013c, 0xd47e66944dffd3de, 0x9710ec674ca87756, 0xae60745f3a5880ff, 0x31cb11f660b9,
+0xf103afe63ca1ed09, 0xe48aef49803090e4, 0xecf273142b4f2eda, 0xb1173cd7c41a6a85, 0xfb9e0c4b4c01fa4, 0x4aba8bb96b0927c8, 0xccad5b331b60,
+0x8e87b97a971fda5b, 0x9f5fb42cac47c3a5, 0xf88b19e095e4303d, 0x20475bf8e8b303bd, 0x919d202e5b35d608, 0x64c754681f40c202, 0x394e8b6615aa,
+0x9423fd6904242c1f, 0x7b742e57ffde94d8, 0xf8cdb0cd2072c5a6, 0x3fe48d7eaa7b569, 0xfa5111dea0be577c, 0x9b6eaf3c9475d101, 0x1fdac98870c47,
+0x2f72dceccced7158, 0x1db510471d964d62, 0xef3d05a2ecc0be9b, 0xc1a7715bf9184c11, 0x1bc247ad1150f9ac, 0xf1e9e918b6fecee3, 0x19d3415ea1b7a,
+0x3eaf8f840fee89bd, 0xa5c947832fedfd03, 0x83c0af169517e2e, 0xa9fb5c13da123b92, 0x7b7e32569a271ebd, 0x3161ae7654194873, 0x208c2d27f2974,
+0x7de305b99a1bd91b, 0x9ffb53ace248b282, 0x385b1ff41ce289, 0x5363b6d525c05c47, 0xf192be5fbf28fb7f, 0x68e0c929d1d5096c, 0x20fca2486fd95,
+0xda53d4b5bf8fc708, 0xb9e36cc80f817bfa, 0x6197d3064f6bb9f5, 0x7162f3e42f7b175a, 0x4c0a6dc4c6fed836, 0xc1ad53dad2ab6d10, 0x1ef178cdc3f10,
+0x9315e5eb6f77bc63, 0x2ab9f7eb2a078b60, 0x7f06a91034a56907, 0x5a5453dab980a401, 0x5b0ad99a941896e6, 0xdbf0f9f7cb74f3, 0x219eb76846a15,
+0xcc2f54aa41a33127, 0x3c0a66ab31ae8618, 0x1df1762f1bbf7146, 0xd36fb447eefe27ac, 0xf9ce137885299ba, 0xc9037c0e53ae4d9d, 0x1a3c52f4709bb,
+0x74ca9a8df0828173, 0xc017d95337986afe, 0x908d0976502f47f, 0x7b0e617c10f3a719, 0xa5810608ca0b61b, 0x29a3edb33af4a51b, 0x16baa741d438d,
+0xc7aad347c1f7cec3, 0x92c280d4b2759c2f, 0x57bee8aa537402a5, 0x678b69295e34f6a6, 0x7c713ad087631af2, 0xcba05cbe63c5d501, 0x854dfb6b3ab,
+0x67c65ce975755e42, 0x55cc0dfbb0fd03eb, 0x47323a9f15d522b6, 0xa9fa1246c4267580, 0xc4aa81a44330694b, 0xfd03c05a0cc548c2, 0xf976f104d423,
+0xc4c1cddd92deec6a, 0x44934e30cea3ea0c, 0x93b7bcc55c24766, 0xa726b0e093aaeff3, 0xca2c2c77b2fc75ae, 0x3ccca4472274fcd6, 0xe790dc9f0dbf,
+0x30fe8db8eb9b955, 0x7e18f1e2e26f58f1, 0x7163e9ac574af5c, 0x2971c981faf3d808, 0x5effe6ee2e77a3fc, 0x542c2aba37cadc41, 0x12223805fe42c,
+0x108a6bc68de3635a, 0x46e368d25e43a987, 0x8ba1901beed033e3, 0x25be01076de2659a, 0xcaa13d2915c066cc, 0xf05edcefe0e1ad62, 0x21374403b79b1,
+0x745e8aec7c187bd4, 0xfc2e2e54c3607d54, 0x841299fd0b158f0f, 0xefedb1916d01adf5, 0xdeca3369ddaa6157, 0x5d35fa2f1025613b, 0x20de9c8d1d55f,
+0xf4beb3be80e9a511, 0x3b82458de45e8a44, 0xe84310e83090de32, 0x5affe41b7545552a, 0x59ca2ad50317a98d, 0x48951c7651106b54, 0x1fa5cc88f042d,
+0x95ad280943b969f5, 0x9b13f30577defbac, 0x20bdd1f5c03fa048, 0xcce509052057183, 0xe37d10917c9ec6e9, 0x83c794dd821304e7, 0xa743f36245c,
+0x7b5fb3723acb02de, 0xbfad4b4c8d96b1e3, 0x5beedeff6fb60d57, 0x27ed578c00db2e72, 0x8d3417efe91ec621, 0xafc55efa1b560ead, 0x10069ed66d55c,
+0xabcfb912552c29cc, 0x1498952ca38523d4, 0xd26797b0881ebe18, 0x8d747da4f55171b0, 0x72ad35fff958ce7d, 0xd915b437ccd752bc, 0x1fa14e296c1b1,
+0x58918578ee07f5c, 0x6ebd0f14d4b1ebd8, 0x6f45b8f784a4bfee, 0x67eba3d2b99292ad, 0xa735a8094b94c4ae, 0x197a895df71ac079, 0xe624aa80a76,
+0x8d006f420f845f02, 0x930b66d7fc41c35, 0x81e51dde184629cc, 0x4684f2a491cceea, 0xde12a8dda7f74523, 0xe60e5dbee40dcaff, 0xda5b775101fa,
+0xa1f3184358e9899e, 0xd24984857518c270, 0x8ce51cf7fb337759, 0xe78d859147e88c0a, 0x3a35a0630567190e, 0x276b17d663f773ef, 0xf04c608d35c3,
+0xcabdd52cc03c414f, 0xa62f1103f6d2cd76, 0xfdb798296ee8a4be, 0xd48e785b7ef1f977, 0xc0b8fa918bb88c68, 0x6741431a6a045044, 0x112bf5bceecbe,
+0x1cdb0a44205bcd29, 0x204d3812eda932b2, 0x292b948dd9604e7b, 0xa76312e83073dcde, 0x908ab3b496ddcac1, 0xdd22dd1a3657719c, 0x1565f7f618ff2,
+0x9004ced67542099f, 0x9a5e63fda4608590, 0x861be1eef04cf5a8, 0x85215f26206d3619, 0xf9deb02645062962, 0xee1da2d534c2bcc3, 0x9de3367f22ed,
+0x2c828a129a454634, 0x8b20d009223d50b6, 0x30281448cf2f30f2, 0x46bca7c4d8f157c5, 0xcbb37ef1398df61, 0x25e95d1f7c14139, 0x1111d41027748,
+0xf1cb42789089799, 0xfdcce7fbddcec23, 0x436cbb1aa69cf917, 0xade5d9b46329815, 0x29edfb86f2b02367, 0xbaa057b1a23822a4, 0x19b6429be04f5,
+0x852717c670837209, 0xaf1f536ac4559bb4, 0xe5054b2f86fc3019, 0x9cea3889b31356cc, 0x911c54a66c547dab, 0x4eba7b921e5e120c, 0x1762beacd0ff1,
+0x161a9b0fe00bd37a, 0x2ef934054f2a9868, 0x6ee5cab7e466e6f8, 0x804ed562d85f845c, 0x75a1c45325d72cae, 0x2361d6adc3cbb26e, 0x1debba812897,
+0xd430c64533574b0f, 0x883b39379e585553, 0x1b8c572fbccfde6a, 0x893fb63e49abf613, 0x4777824a1800c020, 0x8ce074620b8f709b, 0x12fd42592738d,
+0x46c6ca5f2ee8ead7, 0x3acc5eb574036577, 0x148acc6eb191b532, 0xf8162ea65322d997, 0x34e5cf94576fe6a2, 0x1b48dbcd14b2139e, 0x28791310df4,
+0x6f85ede53b988e53, 0x378bfc1d721ae47, 0xf543fa714b0cce09, 0xa4f6a1958e30e18f, 0xa51809494691d18a, 0x885673fe59b1da1b, 0x4fd5d94f7bef,
+0xc001ccc4e4fe49a, 0x91cd4efbc51d0c6b, 0xaaab1c2bbba49b7c, 0x57eafd8e706c8de8, 0x9717f2a4c7c616b5, 0x78db95c8cb17395, 0xa49b5a76bfef,
+0xa270d8bf9d0d32e9, 0xc258ed26616fc0ae, 0x2db8310066f408e2, 0x83791604e7d44996, 0x486e130cae635fc5, 0x13e1802131a191a4, 0x5dcf582b5eca,
+0x32a1ddc1033e738, 0xa66c2628a238724f, 0xf70233b12bf29dcb, 0x24b48bdf0bc60ec0, 0xcee4d1893f0a1b20, 0x3e4544ba01cf7d30, 0x38d40cceddd8,
+0x9e8acfc801c8044b, 0x1b756f44ad19c073, 0x6e03dc1e308c62ad, 0x6c1952c9a2c05075, 0x670339a7d6afbe2e, 0xb6d4c7c2df85e9d0, 0x1c68c4427c7c2,
+0xefb429d56857c868, 0x53e85ca24277af3b, 0x562636995ba13223, 0x195728f853abf266, 0x8840a82f442db5f4, 0xa36ac3eaf9a9afaa, 0x15b35788367d9,
+0x6a8143e61354d153, 0x6f84336c35dab238, 0x95e6dd5389fe6d76, 0xe99542d84394ea4, 0x46d89671845262d, 0xc81dc7956e9c71ab, 0x1377dc9ee1c16,
+0xcd27c68d25989ef9, 0x4b165542e7756b28, 0x81029a70176c7c0, 0xcbdb74a045a870cd, 0x9e028a39b28e2e89, 0x7326540625e94f30, 0x102ff6d7cc3a3,
+0x7df239f46b469385, 0xc71e29ff4bec24d7, 0x14ab2a3d24a3b118, 0xc3288cdbbdc79599, 0xfaf421ada9c50152, 0xb7927152ea7d521a, 0x186ef1c780fe2,
+0x359f116e5d8c9c3b, 0xdc76b10a8648a12a, 0x998bebfa4d1a0d3c, 0x471fc89f555c2299, 0xc3f664b9c6495a40, 0x3d6f955b96955cfc, 0xd8f2f04ff707,
+0x9557b3f958fe5b48, 0xd3f0f0ca534d19a5, 0x653c633b075ab9ef, 0x665686a7612d9563, 0xcdcde7ed80347e10, 0x7e2701b8abb2a53, 0x279c7dacec14,
+0x2dfd159a84e3d935, 0x9dd7ea4765e130c2, 0x8cdbe4d7eb2b8cf, 0x1e35c82440020b28, 0x58e078d7a0060583, 0x164588b223aa2ffc, 0xda9b105c647c,
+0xc16c6c6857e4194d, 0x793d04132c169e0f, 0xfd38f5d003166fb8, 0x8368f1eb6d3965a, 0x2195c251b2bab984, 0x2b8586165998105c, 0x21830d052d788,
+0xe13e41ab0cf3afcc, 0xc3a9232504b41b0b, 0x78509557b3d7b21f, 0x71c4f5c2dd81552c, 0xa034cd5d2e0fddde, 0x910dd0653f8ae2b4, 0x7ed04380db14,
+0xe95f0b702cffcafa, 0x7043ccf336b9dadf, 0x590d5a938784087c, 0x74071d70038c84c1, 0x819d352312c77074, 0x4384d1228a396905, 0x17f9987f0a681,
+0x40a1403fa3a0f97b, 0xc6b880c1112aa9d, 0x132325e2c702d858, 0xfb528744b80da1b5, 0xbba65114df402d52, 0x766036095ece25b4, 0x10067c80a39fd,
+0x948cf8b62a732d23, 0x3963fb48e1e03d05, 0x1e73be816625067a, 0x11f58aa7c2bfba72, 0x274275431ff72e63, 0x419b50720ca2fc06, 0x1190531377540,
+0xc4169432243d13df, 0xd2448bc3a09ccd50, 0x8eaf35ee93c97aa6, 0x61eaaaaca4d8f623, 0x968a1c8c53bb1463, 0x69c4375bbc6f4dff, 0x1268a9fbb3e45,
+0xa537af77df1113c7, 0x284e401285a71f80, 0x462c6a7f494a72, 0x175c9afd60bfeb98, 0xba1e3b079b5ccd1b, 0xf88e8c579fa7274f, 0x230cfac81904e,
+0x1ee272f0cc551cd9, 0xa91e6ddaf322dbb4, 0x6c625b9b52fa453b, 0x4bb140a5181776d5, 0xce8cdff4b907a4b, 0x8768297f0350bdf9, 0x1aa2d2448b202,
+0x2e85871ca7164eff, 0xf5e64b30e1513418, 0xd8265c8d46907338, 0xb7d2e92395785e0b, 0xcb3215e55ae640af, 0x7bb3caf6f812e698, 0x167f2cd2c942,
+0x8154967d8e180fa1, 0x6d8484e4b22ec2fb, 0xfd393aa081f617fb, 0x3a217dc3846e90b0, 0xeefb985dfc35672b, 0xcf46732c1b6952ae, 0x1ff6890053902,
+0x948b73ce850c0f97, 0x25d840ded8baf3b, 0x8bb98d7e586ad4a2, 0x948893405892e1de, 0xc44ac6d8c2242a52, 0x4ee0c384821f0a47, 0x11f9519a82b4,
+0xee900fae330235b2, 0x74eab107c1c49337, 0x6affe9170d809551, 0x993f833412868ec9, 0xf5047cdcbf8e8421, 0xa9ea4273460cca66, 0x6bd95f879084,
+0xa2298ca13d5711ac, 0x28469f5813070143, 0x8438a15c4ffcd0a0, 0xe9ecd18d229b2e00, 0xdbd82e7709d4eb59, 0x12c4e86c29c9a952, 0x4632a9405f15,
+0xcd110a6c8c57f480, 0x6ac2b58a1a3b078c, 0xfa140c2c434cb8a4, 0x36ce0e193e7ae52, 0xa8f91676f7d530d1, 0x773b80e36aa39f83, 0x3983449afeac,
+0xf4120107c16471c, 0xd976cb79ce48d551, 0xeaecb676e99aaff4, 0x8d74d52223f28cf4, 0xed8583fd02a357c9, 0x4b820a1ed2775fbb, 0xce605da76abd,
+0x1e47cd2f4c736b38, 0x5097038f653632ea, 0x7f46b00d2611c41e, 0x904af6e89834a84c, 0x47d57827b093c36d, 0x4916e38ecd50a2c4, 0x4b1b7638bde9,
+0xf293e681cc38b1e3, 0x30713f8ae7d5c813, 0x3353bf9d43c5a818, 0x12e04c1ed1abdd01, 0x161511acce07f6be, 0x1fc4340413564014, 0x65a303fd52ce,
+0x20ec19d5694b7f45, 0x8babcb336aa4e360, 0x5118f9c2ab05c66c, 0xd3bfe94dd703e746, 0x89d621535a12f21d, 0x81c7c777cc799aa0, 0x1a125bb1a4e4b,
+0x84ed16c24c17ba00, 0x94e9dbb768bf037e, 0x403c9bb63a020a97, 0xf49f0d62ae9c32df, 0x2fc813cbe1a876b5, 0x473712cf430e66a2, 0x152726ec4e6b6,
+0x1185de3e8ea4297b, 0x8e7af21d60933d9d, 0x3ef2498b6aa57ea9, 0x6df8853c8b4d7798, 0x44d69b20466770fd, 0x296635ef9a9d49f9, 0x1d62d8a1d0a4c,
+0x922a436a473092d7, 0x6697d249ed411c11, 0x47b77545a22ce8fc, 0xd749a773d33bfb88, 0xc3310e73c69363b7, 0xf79731727433ce46, 0x5939b83f7d67,
+0xb3b2c00229bbdcb7, 0xd1fc59e2a73e1729, 0x76e7c2ba8b4ca07a, 0x81c57404f3315bdb, 0xbe7800f9dc578868, 0xa747c505bf18a7ac, 0x57a6714517be,
+0xc0b54c779179453, 0xf9ce5e18c1a3c2d3, 0x808ff0eaba6d979c, 0x75d8f9cf1eccaf65, 0x31e0b9e6208a5136, 0x2d08f719629e6488, 0x15ee04b10e297,
+0xd770e5dd00f37f73, 0xea42b8d69fd89d27, 0xe49ac4eef38b9323, 0xab6c12b98b029db7, 0xc8bff6286381241a, 0x1d3d501f742699a6, 0x32d531fb88b7,
+0x1410c01f8573a46d, 0x108a27aea705fe38, 0xcacca3bf7af7a7e, 0x61c1cd4957b43001, 0x6e18780bb301434f, 0x153b8b33a48f281, 0x22a111ad78587,
+0x32eeb6f7bef9f880, 0xed80d3265f64ab1a, 0x5d90898c7417ea03, 0xc331f5cd121121d8, 0x8acab7496375da1b, 0x7dcb4778c045e38a, 0x74fe500e117d,
+0x87883b9fa0e635cc, 0x1c72cfc51c6abd86, 0x800d557fa904cee2, 0x1cbe546a9c0238c4, 0xbe9e7fd23a1935a1, 0xb415f0aff27b7152, 0xc7fdd331a185,
+0x1f63cefc437efeab, 0x5d35154f2f3ebf9b, 0xddf34ce34689af02, 0xa73adf1d827a3ada, 0x2f52739c48966b1d, 0x6839aa4f6565b930, 0x21beddbdce560,
+0x533d384a364f6d6, 0x466c170f770f1c0c, 0xeb98158fd87eb36, 0x54f2422dd8bf7d0e, 0xd7304ce699283e7a, 0xb6e5d639f99bc6d5, 0x10f8fc74053c8,
+0xe219c920eb55b75, 0x37158299e4315b61, 0xdd2a64132bfef70e, 0x4209644f31987e7e, 0xa9b2f9a9b7524bb9, 0x51c2a8cae8c7acaa, 0x1d55c17c1a929,
+0xe547b9bf0b0f1a58, 0x285872deba5af50a, 0xffd08ca052fec47d, 0x9d2025f9f5cd84f6, 0x6a54827778085e0f, 0xf7b7b2a699650322, 0x1a4a2b00ca97,
+0xecf4491248e808b7, 0xc699ddfe78bfbae7, 0xae796ff5ac9567e0, 0x8094ed09f57859ef, 0x4b19a4e0ff8d6d0c, 0xb7ded35dab5112af, 0x10979bf9e18b4,
+0x5db64e0fbb3fd962, 0xde05d8bc6608263c, 0x4d272e2afee2a3f5, 0x11c39ce82e6dc83e, 0xb78660d6a79d6e46, 0x63fd028005c3cd6c, 0xcd39d7470cb4,
+0x60b4073aabe399b, 0x4eafecac00bf0188, 0x5aed21e4de5b5e82, 0x480a897d3cdb33ee, 0x6f4a51c15f71bedc, 0xb4a4e07bb4f22a9a, 0xb2b181e023d7,
+0x33494b606a75f5c0, 0x98b71c7e6fa1e899, 0xe47881b79610d219, 0xb2499fd474eeb36e, 0xfef157c48fbdbe62, 0xed2d8f921dd005f, 0x230946fa07f03,
+0xf74ac9348ca2f0d1, 0x70d0358e1fde5ab1, 0x973fe4f3e3f4e5, 0xa37de73ab8723e8c, 0xaaa5dfe76e9f0acc, 0x71a33648428fbf94, 0xdd4665c9dbc,
+0xe08c4f87c7d2b3cb, 0x1c82c69927669ed4, 0x72f955573f7e1a57, 0xdd2dbf3a20be2265, 0xff27193ea33d348b, 0x167cfd38ee87d01b, 0x58fe338fea94,
+0xae7ccfbc2d96666d, 0xb4f8e23b0f24fbff, 0x7baebdbca765b5ce, 0x11315b75883502b0, 0x34662f0d679173d9, 0x6822fc9edb6b259c, 0x3116468dc55f,
+0x84f43166599c6964, 0x32d145cd6ded600e, 0x560899b5c44dda1a, 0x9e523e600179d7d9, 0xc99768c62b13b97e, 0xb7fadd7519ac5c42, 0x6815859dd6fa,
+0x560021537272622c, 0xcc5910d9b58c89ab, 0x6cc8f0bac20b2bdb, 0xb9cfd3efade958e3, 0x3452a32f41a952d2, 0xcb122c280ed3882e, 0x16db93b22733a,
+0x419f87f2c84c045d, 0x10ceca4e23e04d29, 0x509629045742ebec, 0xe86ec2762639f464, 0x6077df9c0ae46dca, 0x652ab722174e7269, 0x1aa3029f447dd,
+0x8d689668a60a592b, 0x51248772e6f00e2c, 0x4954d364169b906e, 0xc9d377040c8b2c2f, 0x74edb32b7aeb7c2e, 0x610e6a401a5d965e, 0xd22cc4f93e0b,
+0xd5b3063e78cc9543, 0x3c5d7993a5db0afa, 0x3847a3288b0cdf5d, 0x5d421168615116a6, 0xfcb4f4d02a7951ab, 0x55764455578c0ab0, 0xfd878b4d64b4,
+0xe7f1f6fe842f3e33, 0x9e2cf6ba7c2c5c29, 0x9a3fa0230f2c0ce1, 0x79f369448affa598, 0xea7743f8b0321922, 0x8f0d106a22e24a91, 0x138bd0bc6e341,
+0xe696a3ddc9e15da6, 0x5a0680a361f4fc3a, 0x37d546acbd49f081, 0xaf0a407cd3aaafc9, 0xb68abcaf8adbe1c7, 0xf5d042a69f077ca9, 0xa649042dfadd,
+0x69d2e068d23af833, 0xdf494ec116f5a7a6, 0xa9f24849f469db58, 0xf310b5d676f93665, 0x3e028f50f1d05eef, 0x1781f14853d65234, 0xaacb93cc95bc,
+0x7b5e84601ee8fa4a, 0xe13cb0beecc4fa28, 0x519ff311b012c576, 0x6d0ff5db010a335f, 0x8b4df7b0d721cd1c, 0xf7f58bc0602b3837, 0x1923a49e9e9c4,
+0xd55bba1ad0f27e91, 0x24e0079a6e49f5a9, 0x9a4d1276fc562a8, 0x724841e63b208890, 0x7c49f75fba5503d, 0x314c66fb81ac0ab, 0x1a713aaae43b3,
+0x41b16b8a00d7293b, 0x80f1872a9e4cf10f, 0x6b22a6d7594541dc, 0xdb2fc065fc77326a, 0xd9b93531e3970471, 0x422144ff46a51b2a, 0x1e5e8f7e59640,
+0x96440ee52dfcc795, 0x60e07930f3fa1ee2, 0xf0e9990a7963f712, 0xe7274cb820d180ad, 0x54e8c5c473f40b96, 0xbb88197901535c3, 0x178877fc31cd2,
+0xb0ef00b254872b8, 0x8c4be3edd055ef4b, 0x3e92d433a0576aaf, 0xd699559daa5bb746, 0xb75a3eeb27df2895, 0x494eebf4943e0937, 0x73696eaa383a,
+0x899b55b0a9b19d7d, 0x4bf94b7d92a0016e, 0x2106395d2883eab2, 0x570b2b4e95b5c7e5, 0xd9f77cf12511d75e, 0xe981a53eb47f74cc, 0xf1f43d10a8d7,
+0x49530fbd26a8d9f7, 0xd5b65fbfee09a03f, 0xfca18246889aa8d7, 0xa9fdf21d0c37f658, 0x5562da21650155ff, 0x5acd095f2c96eab8, 0x1c1463626784d,
+0x28e3a8a709802c13, 0x996bd8d647aecf0e, 0xa6b09bc15da60afe, 0x574dae815200d49b, 0x10f5b95cf32152c8, 0x1e78671e7a787533, 0x448263285a9f,
+0x8b2dd406d31dbf65, 0xff1fe480a06a43fc, 0x624308666a6bdb29, 0x46add5459a73cd61, 0xf9cffb9174bf3555, 0xf79c43ed8d9d711d, 0x30cac80cc048,
+0xbfb518424faeac9b, 0xc42e8214a6769335, 0x65da3932e38f7d05, 0xe22ce0d4f5270efb, 0x8a35c5ccae0800ae, 0x5c4c88dba65d1c35, 0xd23810109b95,
+0xcc9785563d0863f0, 0xc33b152a09103e5, 0x848022b87f16f5b6, 0x73d15ead9b301c77, 0x18d0171021cc5693, 0xd1aa17ffd93ee64e, 0x1020a8d58e1cd,
+0x8153cc50092a89d0, 0x4a40ab9a7fdec081, 0x748709c93ddfc416, 0x8423100788accafd, 0xc1f4979ec88117fc, 0x867be36928fc616f, 0x1afbdde0e5d09,
+0x40c93d55f529767d, 0xc441dad83ad0a3b8, 0x7a04eced9216b9ba, 0xf1c816b81afed980, 0xff2e085a8576e8b, 0x5f2046e34f0957fb, 0xf879d672ea8e,
+0xd9baf5edbeded3e6, 0xec7698bc30b530a8, 0x3558b586dbc33c03, 0xf7758630bc9250f6, 0xd03ca0c2543dedc3, 0xf12e7b162337c887, 0x199f7cf03164e,
+0x831ee0295a845745, 0xccab4feb03214231, 0xa1e1260d6ae3569e, 0x866ac937ca4bea45, 0x207946c0ce60511e, 0xaa3bdf3be6473aea, 0x1ccc887e4930,
+0x40bdc316ecc0a7f2, 0x7a8fab4b58dc0a32, 0x3d023b7d14ec3a0a, 0xaa0007b3a7df0c9c, 0xbec1fc729a2d895b, 0xb616c2287d636810, 0x1b2ed5d3727f9,
+0x13540da1bb6556a4, 0x1f57d7ed820c8460, 0x80815d67183b4720, 0x9a47dd3be498e4db, 0xcb87058b82e21ba5, 0xea034b4ecd615f42, 0x1fc3b5e974af2,
+0x94e4f6d0d7ab1edd, 0xd2221f1aae93dcb5, 0x81c572414671fbe0, 0x9dbaeda86958a353, 0x89fee4c94b21a99, 0x9520e1e22a6677c7, 0x1234c5b1efea2,
+0x55a0ad7a1008cebb, 0x13197461e4f9b32d, 0xe78f176bf0677bff, 0x81d23b913e9e9386, 0xdb368f44ea61ce37, 0x263b1e47433d1a3b, 0x366e6105d586,
+0x6cc8b0abafd855c3, 0x31a09d51cea660be, 0x9e300cdd394b8338, 0x6d99f30363879e8, 0x4dfd8089487dcf0d, 0x302126fa8a59edca, 0x1c57abb62ddd9,
+0xa0f6946541a70e78, 0xe4a659aae04e8049, 0xb989cb52c5ec4e66, 0x483877e3451cbe6b, 0x6e54232df4fcfaf3, 0x2d85cb7cc50c448b, 0xcea580178d0f,
+0x3363301e79e7d4d9, 0xa88a7b32cd8ac315, 0xac440e8e744f0600, 0x4ddd179ad10dc4a0, 0xfa24dd12b5d66993, 0xf9f95858416e02e0, 0x1a765af5e2975,
+0x1e2744d55ae87200, 0x1921de1fa00682e6, 0xffdb0de0c45c34fc, 0x38eb445a40b67d06, 0x8966a3363a7f9770, 0x8715dec6549c2c5a, 0x19f40192723da,
+0x256b08542449da58, 0x3dfc0ac52c547ce6, 0xe9b0a73c03d398a6, 0xffe57797986e8478, 0x7aab067302dfc53a, 0x4d09c611660919ef, 0x210c76375b3b1,
+0x7f9453726ee527d4, 0xbd543a7d8b51ac48, 0x56466ebf7ad8c9e0, 0x610810870c8d684b, 0x470671e702a43dbe, 0xe13aa6d25a264ef4, 0x221f5c94b8fe9,
+0x51ad29a700bd10c9, 0x9d38ea16215d6d86, 0xcd791c991dfbf47e, 0x5a35f21db45751cf, 0x2d8de784f55b385, 0x3d6667e0e05cac3d, 0x16a7f055aa8b8,
+0x18ee1c92e344bb78, 0x1dce78d6907ed108, 0xd2a9512d01ccfa0c, 0x63752ff74be13ac6, 0xfb74f32748e8f7e, 0xee005527af388c0f, 0xcd32a221938e,
+0x4d6afb43189b09a4, 0x886393593e9224c9, 0x699b7d78873083b9, 0x56a1289053ca43da, 0xe051cc9d84f670c8, 0x561406179a3db03c, 0xf9f506844bd4,
+0xaaab350e741321a4, 0xcacba7b8e1219168, 0xede2552dfbee943a, 0x6ce8f8781f87ea53, 0x9ad774028ee9234c, 0xa9429f508b3ee16, 0x16d0314a196c6,
+0x35841c4c0e672e4e, 0xe2ab1277777540dd, 0x71eddf8603779610, 0x25b94987ea42a20c, 0x48b88fba2f447622, 0x378a1967c51fed53, 0x12f3ee45942d0,
+0xcdf8185063438605, 0xfbac5e2ad2d4582c, 0x2f5846f742dde2a1, 0x49d89f41b0afa8af, 0xde0889b0ab82b4ad, 0xce2620e39883c9bc, 0x2205f0cbe41a4,
+0xc0be6decc9414e0, 0xb19aa71323730420, 0x5d9eef9cd5df35e4, 0x98b4d4b1b8133adc, 0xae7ab324e502384, 0xc2058b08510c94cf, 0x317ace68f7b1,
+0x3229f63ed3d4fc87, 0xa06d9bd38db3cf8e, 0xc804270de1fd1a11, 0xeb629b1dc712a879, 0x6b59951fd375b9e5, 0x3437a0c780aae86, 0x1756cf2d58e4f,
+0x2910d10a00cf8b9, 0x65b657f8d2fbb423, 0xfd0e09f7993201fe, 0x5f1015dd0c3da29d, 0x4bf046870dc13950, 0x10398cde234fa8d8, 0x6c0e2762b58,
+0x94d33f574ee6aec6, 0xc9f4e4b0b315e278, 0xb2f5822dfd49db5d, 0xaab1d026abb81ca9, 0x158d9ce3b70e862b, 0x640571557b5cffec, 0x1cc023d37856d,
+0xfd70d5c638718384, 0x3fb8e5ca2672eba2, 0x213f7c1f91f5a641, 0xde06267bcb555f93, 0xf2a1085245b2137, 0xf4dcd27f85cb8e7f, 0x117a551fd9081,
+0xf4be8fd3e30fd28, 0xb8d0f222ae0a6e1a, 0xb1b50cbcadce78bf, 0x6246aa1069db169f, 0xb4d63f91e2e4402e, 0x24fbcec2d8ea93ce, 0x20c99f7ce0333,
+0x2aa757dd1e04e97f, 0x2ff7938521154260, 0x1e58bd78e525c765, 0x2349821b9a8472fd, 0x19c9600a098813de, 0x6b73d650c8ba8fb7, 0x1600ec9a55ab9,
+0x84a7c78c6dd146d8, 0x3ed1e8ab8a2173a2, 0x4b6f85555d5c07bf, 0x30473f111ffcce50, 0x798cad07cda9df62, 0x4ef7ec1a2caf54d2, 0x224e34f89ed6f,
+0x26b5a9bd516defa4, 0x7267f8818a0d0f96, 0x5c6451b8f6d8b82e, 0x625e1b8882a12ffe, 0x9a10e7f9c1374411, 0x21d8e691c13650c1, 0x20cc5b74a98d7,
+0x443de0bba824b0c9, 0x5c41cee787ff22f9, 0xc0bc7c893a3c1725, 0x47115565371adac, 0xca6a45128d004bd0, 0x44c0686a95f1218a, 0x8c05a9146ad0,
+0x5eb9436b6588af14, 0x527ef6452d1c2e2, 0x591f1d233c23da0c, 0xb4eee662fec7e800, 0x2bac7025f4347e7e, 0xa8b841d7b80642e5, 0x4312fb89ebaa,
+0xe76ea7aab6868edd, 0xaafeb379c5c885dc, 0x47d28b0121c51cad, 0x5a0ee63e5d453847, 0xfcba10ab2ddb0b6f, 0xa31c9cd2b996fb98, 0x8ba6c9b3d260,
+0x5ae07d5d42b75b3a, 0x1107872250a2c8a0, 0x5566ef3aa4e6f788, 0x2d59668891d8e0f, 0x4170ce15968f3ce1, 0x366509182ba372e6, 0x5c04ac223dcf,
+0xe2812f2129d2e30d, 0xb3376e743cccb419, 0x84f6baa8749f30b7, 0x1f72f1534c834eeb, 0x66606aa2cc2c6743, 0x17383771b6877a59, 0x1ed9771e01f7f,
+0x354da3bece9d2c5b, 0x260b26dff2862f39, 0x8d263d9ecaef28a3, 0xd5d322a9a1611b9f, 0xe39cfaaafad06a0b, 0x410f3a7a9cf769bd, 0x1e142ff2dd3d6,
+0xcdfc154bb4da87c1, 0x38eca41a2cf4caa9, 0x908810be8a8b3b4a, 0xa3432f7c2185df0a, 0x6f041f1bff904d44, 0xc1f4362240f17636, 0x44a08657baa0,
+0xe3e524ff3a657aee, 0x56e3d095de5a55f5, 0x8b50d7fe0697cb4b, 0x81b7c0f763013400, 0x74936a5687124998, 0x6a8ecfaa45ce282, 0xfdc5f33eece6,
+0xfdead8ea96dc2dff, 0xa1d72c80cc32b61c, 0xabdaa05e6e28d10f, 0x8d5fc1dec6989050, 0xdaf7db3aa235ae7e, 0x9902f608702dfedf, 0x18f16227cc9ee,
+0x9335c39f5ffc679e, 0x8b5bb179315f5af2, 0xcc5f4558f52a53e6, 0x345867887b970c8e, 0x22b36b7729798fcf, 0xc5802dc3a8cc0f97, 0xdd4ef1e1f2d6,
+0x7228e113ccf607d8, 0xc7477cb0678300c7, 0x7feed3f8d11572be, 0xbaff6e1d23eb6f3a, 0x11b956a111c4e282, 0x5ef3d5f44c559653, 0x1b3aff12c0d70,
+0x14511cc10d4da9c7, 0x28e8b70fd2bcc827, 0xed96440ae7ebb121, 0xb90d7c8f2c8bbb8d, 0xd581f2718c222e8, 0x48849f09118a7f83, 0x7f9e06755547,
+0x1f78dc539ac32c46, 0xf87d5660462397f2, 0x33e5a3eae5ea39c5, 0xe2987424751cd2d9, 0x2be0e8299dcbc21a, 0xfa24a868cf26dbcb, 0x18a56e915b02c,
+0x937148be2b54be55, 0x75a051004dbb99ce, 0x9d77cb9d9f8841d3, 0x29faa5ce62d979e4, 0x859d275cdc16d2ac, 0x4e0f183f8beb7071, 0xe5108a6f1b70,
+0xf557f16261ad484f, 0xb83324ed1d8040f1, 0x384dc489489ce452, 0x6cdd3984386e4ea0, 0x7f4d4e6a764b93, 0x5df769bd2aa69753, 0x10eeac7218e88,
+0x2557546f466a79a0, 0xda70f32a8c3fc8da, 0x9a75d5cb32d547dd, 0xfe2b47a878bde903, 0xd52698550735709a, 0x6e48ee6eac2c26c0, 0x14ca5ecdaa109,
+0xf9f9b7a95a612ca9, 0x6a495de83ab57fb6, 0x3c9729a37d9a6d2a, 0x1e27db36cd2b73e7, 0x298d54a4943e2513, 0xc2523ef4e001e842, 0x1d3e7059d35d5,
+0x79cae91201487750, 0x8d569a04aac1abf8, 0x2e3135daa74b0857, 0x47fefc2b4896dcd8, 0x826d4be97f1df9a4, 0x1d626c089577bfc3, 0x8d41c9c14e8d,
+0x9b2e8060377c077a, 0x28988481b9097ff7, 0xae669c496eaec7b8, 0xd889992c205bee7f, 0xfcda93c273127088, 0x2957eb2f352d5549, 0x1eb891c8a4446,
+0xf89787fd293098d, 0x1b7db7d5b930a16, 0x59447dd81fe74cf7, 0x47e8a7572dbd7b8b, 0xed392f4d140f5b29, 0x57218abc93eb039d, 0x11d1035206e66,
+0x338c3a99f3179b19, 0xe03ad034386101ac, 0x6990c223a029c0a0, 0x9afbe4984b5814fb, 0x356a633785eb0f61, 0x567c295734cae7a4, 0x19682e13409f6,
+0xb791ff917529e79e, 0x63801801b2b8f6c3, 0x2b090f4aa4090d81, 0xda7fc84543c08460, 0x689712eedc438f3e, 0x65d2c863346f1b86, 0x1988bb0839d5b,
+0x789459943e40794d, 0x406aecc5f0d2341e, 0x2d10aa16f5c1b1d6, 0xc2041e02866cbc03, 0x36ff9184fb56d387, 0xa9fe1d22408c5262, 0xd010610f2c53,
+0xc7ba4e33fead55cc, 0xb24a2a130714b769, 0x80e22802fc275ffc, 0x32524f4cf20654b3, 0x98863792eb41e19a, 0xe58c6825be511293, 0x169f41513f210,
+0x52b7d832fb35607, 0xccc24de0884133ad, 0x224ee6c80e67caae, 0x3301e9be9bee975b, 0x6458c3565c861522, 0xe6f8381ba279db8e, 0x1cb0fdba472,
+0x6979d08fc7b912d2, 0x4ba698780d590b1c, 0x84094cc98bde85c6, 0x38feeac65558d368, 0x893babed2e6f03a7, 0xbb93271429fe237f, 0x206826fca97d,
+0x729d072e2ce1712d, 0x70757b696ea45749, 0x45027f52f210e0d2, 0x239a352f868db1c6, 0x1925985b75fa2c7c, 0x780c754e8bfdbcba, 0xd6a379698066,
+0xd965c5b012ccdb19, 0xbb2a1606b739b3ca, 0xe1408fe2bcaeee21, 0x9b601a9f7b9c01eb, 0x6ceed0b1bacf0801, 0x3a599748e401d853, 0xbf2daa2e4208,
+0x8f31fae9d580943a, 0x4087a885ef397e8f, 0xc36bdf1b200734cb, 0xde33012a8a6c066d, 0xa049a91acc0e67bc, 0xc97e543a138604f8, 0x2085e419c8b2c,
+0xed7e3520268eea4, 0xd21f55f57489d267, 0x670722e419f27606, 0x6fb10cc4c054b2f2, 0x4afe9b1e2588c368, 0x7335ec9f158dffb, 0x19cd7be99d91f,
+0x5f2c637d0f187a1b, 0x3c20f77197577173, 0x139ee50d9b3d9c61, 0xe6e9cdd3aa3e83ed, 0xdaa21906c0be47e0, 0x1010ca9042f3f674, 0xafdbbb398a7b,
+0x6b435abb007b223a, 0xcd76fe685b6a8fde, 0x2210050fd925e15d, 0x6b88f28fdbacfdfd, 0x3c054e3d085aa8d6, 0x1b92e81d45512e2f, 0xc27b91333095,
+0xbf764d6e4a6fd023, 0xc4b7cdb30bba0b9d, 0x5a5ea7d5fb76aee4, 0x555776d121f536cc, 0xaa9dae1a1673acc1, 0x5a27802ce22cf43f, 0x10caecb68a25e,
+0x34cee389a3ff1189, 0x1c18720bea83fe77, 0x6933e9ba3f4ccc61, 0x6f9a17d33902d61b, 0xe6dadd35cf766b4a, 0x628ab5a69163c8e6, 0x1b729a9f0c2a8,
+0xc6335c5cec8af4e8, 0x45f6c219b568d701, 0xdd975dad50031223, 0xcfa3b26fddb1ab3e, 0xdfd25632094fe84e, 0xd9f62ad025b4740b, 0x1f69d13be3ebd,
+0x799d40f5a50793f3, 0xdc39344d9d605a84, 0xe1e1185c5f573f9c, 0xdde65c5241e6a8ad, 0x2984bf00e466c8d7, 0x9ee5cadb109b8b8f, 0x230162b4bc321,
+0x97a1eb6619f7d5ce, 0xda72d7e1a5206391, 0x3ccc75e4dfbba157, 0x44cd312573659e8c, 0x31ed24714f611a28, 0x87e3bd6e1fe00907, 0x7d0df707a170,
+0x7a3c46c8959d7661, 0x1c65046ba65dabbe, 0x44d304f05cfcbeca, 0x82b4bc66905802fb, 0xb2eac0224ade16f1, 0xe2826ea5358d2625, 0x5ccde4520692,
+0x4dad68fde3c3b483, 0x58ea8625f323c369, 0x16d535f5ae1302ae, 0x3436ef01f946b116, 0x182a36ff2d672c01, 0x1eaa18d88c982458, 0x20b79a9a6169,
+0x969b7bc1ced13556, 0xa34b8a6dec543abb, 0xb453aaa652729433, 0x29e45b7efe34075f, 0x10fc141d8f77759, 0x1dfe3b6426fe4ff2, 0x20b728f272881,
+0xb77529639d4fe564, 0xd1a052dd9e1465, 0xe07b9bdf31ad2351, 0x8b8f81e95565453d, 0xc98f8a41aa04a5a5, 0x4a7d97fc800771f7, 0x1751ab69084af,
+0xaf23bb44c2f21efa, 0x685dee8243356d69, 0x4e0ca280cd0b59ba, 0x15f96f1bf3e98872, 0xb1462ec7ea089b3, 0xd91ef72e9119825f, 0x378485de1a19,
+0x516747b2ec4a6c7a, 0xd70e3d75dc26032, 0xabb48ee144cefc9c, 0xc10b734c9af098f1, 0x7ba9c04cb0e31900, 0x1988899f9acf5b16, 0x10ecaee119172,
+0x89127523a40dc616, 0xe18f692705c631f1, 0x1641bd68a2d78ccd, 0x5079d49d714da242, 0x23b9273652ee5a4e, 0x5527b4d854dd0c68, 0x7f8fed4f6193,
+0x1de994a2edd4a393, 0x1468c21cd1f51c95, 0x166d17a5c461e414, 0x426548756b51ae38, 0xd204144e2edda15, 0x637ca682b7c6f61e, 0x1d4552e109f4,
+0xc19ed3d7e58ecc61, 0x38a2c4cf46d9a650, 0xa4128cf97dd09bd9, 0x9733aea3783adb8b, 0x70c93003b8222bfd, 0x26cbde8a387097f4, 0x1c676f2279b8e,
+0x8242fdcad919c177, 0xc2ddcad417bc6edb, 0x2f5c1b1d222b98d2, 0x78c208cdd6c162c9, 0x46862e698842f6e0, 0xe0b1d17740c0c1e4, 0x62c8c4d97bc3,
+0xad859dd89752ae93, 0xce15ae00194171a0, 0x60288808f40ecf3, 0xe8bacf636cf472c5, 0xebf0b30bdd681ff2, 0xc009899ab729d280, 0x10cd229d88b97,
+0xcf2fe9fd0108f651, 0x920d6317b50cc915, 0x1e1cacf6291fd428, 0xbcda8c79bb95ff58, 0x81f004922407aaf9, 0x6a8ad904b6b2e5cc, 0x1c9e9a0744f2b,
+0xc781defbb577bdc3, 0xc658e19e5fcec682, 0x8deece0e36744d97, 0xb6894875598d9d7a, 0x825f291ccc882f1a, 0xdade462f3497635f, 0xb5685d8823bf,
+0xd8149656300cea61, 0x6970886268ae9671, 0xa65b2398d5c2b98a, 0x9b59d6bafd27c79b, 0x131e6c7fbf892d8, 0x1ef65806d1f4b723, 0x225d0c63ef73f,
+0x33a457b38e5b3ec9, 0x52c8849c3e6122a0, 0x8d0594fd9018e87f, 0x9ea8c422932876cd, 0xa1e3f4ca4bb7a670, 0xd3ae10f04065d778, 0x11c9eab4752ca,
+0x9b4dd5debc6d1393, 0x2d650ef605d7692d, 0xc138be41d5df4786, 0x2b802e073ed07250, 0x202449301a10462c, 0x7dae4dc54229259b, 0x203faf35c8ec4,
+0xd08f607c7372fd1e, 0x67f0b354f9338775, 0x36a010850ef04838, 0x3819b130204187d8, 0xdd219d989f218e18, 0xa055faf3dc90e5d2, 0x151f9a3d14cd8,
+0xe0718d63d7bfc58f, 0xb8e9908362c85ee0, 0xf16c889972cd7127, 0xc113d11b5dae3862, 0xbb45ed5eab91fb02, 0xe274777d34afb2d5, 0x1f39272c8c022,
+0xac25f130cd662778, 0x2cc101794e798246, 0xc5d9800f7e0743f1, 0xa6123dd81ac59768, 0xe375b8c1217c1b4f, 0xd9b7ce5ea290df53, 0x153b3a5922a32,
+0x3a0b2aed5e09dbc5, 0x5c7dc000084246e6, 0x8e2cb337edba92ea, 0x8be7014707036e13, 0x26b1e9981fc7c12d, 0x80130c77d0849f28, 0x16681453ea497,
+0xb3da4468cfb744c5, 0xc06ed6b0f282b7ff, 0x6cd133b00bef6819, 0xb3b9679f431e86cd, 0xd9956e2615805cf0, 0xab50081490ceefd, 0x1287c8c5ccc93,
+0x4d960797d35fbd8f, 0x3d7af175b81fc783, 0xada14cbb02064c93, 0x264a15e8104c94a5, 0x82be28a9383678bf, 0x7b6e43e6871c65f1, 0xeb382670e50a,
+0xcc66248117b9bc6, 0xd611bc7a2c15ecdd, 0x885b0e2b341172ea, 0xe285afb387ac9423, 0x3f695a73aef3533, 0xff8bf9eba5c19398, 0x883db65f9322,
+0xa476622eb2ee9fd3, 0x42a4161cb4c3a1a5, 0x253b77b3984c344a, 0x98ae8863dbfe57b6, 0x3c5e0b17031e7b24, 0x8c602044f4394217, 0x4a3e9f015989,
+0xd07dd9e1022edcd2, 0x79716e2d137815f, 0x2268e965d82fa284, 0x4433405462bb476f, 0x12646f8b9548e6e3, 0xb207125ee0f4279b, 0x221e12154906a,
+0x230e0bb06e40be6, 0x3b386131765d8687, 0xc26095dbc5066ed9, 0xe154b69edabe2f8f, 0xac63a1ad961c50d9, 0xbb9bb1af77314d45, 0xef29f08e2e75,
+0x808ddea0bcc197a, 0x4b0b1ba1d71a4938, 0x111acb3737eafa21, 0xc125ac47744f1ef2, 0x11866d65560c6ac1, 0x516d0fc3052dec87, 0xa199b26f5ee,
+0xc944053dc687ed71, 0xf17738e3a50372e9, 0xc79f3149d7b697e3, 0xcab04a56cc35699b, 0x23febaed57f2f582, 0xc9dde5a35eab44f1, 0x1f824fbe76959,
+0x3e8551dc21bee510, 0xf432a737d86027de, 0xf1d85016b9844032, 0x3993f4ad85d74cdf, 0xd38db4145940be84, 0xa6d3004b490d5aeb, 0x14e0b1169aa3b,
+0xa6b9657947372e52, 0x2702a0d9ac14edbd, 0x1774cc8b0a2ead2f, 0x438e646bb56f335e, 0xbaa35c3de1d24a45, 0x83ca533f2e77c2ec, 0x13a402b7e67ed,
+0x9730c6775da564ba, 0x23a43f28a76e47b0, 0xd32b6e0a647824d5, 0x319498919783754c, 0xfcf121d9eb4ea3c7, 0x7e5a6c1511ed01b1, 0x1560e48fd2d0c,
+0x55e720be992b88a6, 0xe0133511f4df3782, 0xbf4ef828dfe2dba9, 0xb9fb6443204bac86, 0x2d0b4f5f15833aec, 0x62e5bfa8457fa1ad, 0x1bdafba21132b,
+0x20c9e6125efc363d, 0x695d55d4b17450fb, 0x654389853de7cb66, 0x7b5cd4a58791c489, 0x45fb7bee401f045f, 0x6e58442fad07b261, 0xe58a43e7c04,
+0x3b321990e1cef062, 0x830ab70687efa958, 0xe5b23a64c36d7f69, 0x8237f78023fbbfb4, 0x1f609ff5db763472, 0x7f633276647692e7, 0x18ad14fcc23b3,
+0xdaeffc6ea5bb9f59, 0xfde45c25c374289a, 0xee5ab37598dddb5e, 0xe5d72a20d1cd58d, 0x55efca05d695c251, 0xe2ae69a7dad93d9f, 0x20407149c5282,
+0x62f67d2f2222ef28, 0x5aff309b4564c0c3, 0x72cf7d0be95317ac, 0xc27fb41c3379664a, 0xc47a3a22e93a87e0, 0x6127d0ee5ea68a46, 0x405a6d3ea16a,
+0x9e8f19e3567eded5, 0x29fbc6bad7cb2d68, 0x250c3e06ddd3bf33, 0x21f80726cedbdd7, 0x82ac1798fdff4abc, 0x66dd90ef2f87d825, 0x100a2bfc4dc2c,
+0xb9759cfe04f46300, 0x25e8d4c625da9d4d, 0x52d7970c022f141, 0x934ca2ccea3c4f3, 0x4833c81900b8d854, 0x10fe567e33b145d7, 0xc408c3319920,
+0x6461ed461e2e7db2, 0xaf1c5ea1a340a91f, 0x5a55e0a5c6b602a3, 0xd806d470d7ce6e4c, 0x58439416f3990fa7, 0xd9d4908e8d150949, 0x12864314775b7,
+0x9b20f44107531538, 0x2ce13afadb274d5b, 0x5f608aabeaa81dd4, 0x5bbc60ec9952a239, 0x3501b0d0c9d3ff1a, 0x689ac620a19b4b52, 0x11169aa94a9c3,
+0xa3f0efdeb0f7a4c9, 0xf07126b38a02cc70, 0x1c6a5468566d422c, 0x12e8c5e9236480c9, 0x38651f3c24461ca9, 0xd17e68624c04b534, 0x168c3e5386942,
+0x9201ad3e70eca7da, 0x2b8a8a24827eafdf, 0x372fc253675e0866, 0xe5d2ee97a70b663e, 0xb511cc609951cfe9, 0x3ba083b5eb614b1f, 0x1128904036d4f,
+0x46fa194b782c93b6, 0xa87d4ccab5d050ec, 0xc755d0cb89eac573, 0x4c6d1fc1365e0ff2, 0x78cd0c545b1e6629, 0xdcd05cd34bd088e1, 0x1ca29c1555d16,
+0xbc266ef55edf8b90, 0x24f3aec1b45fdd5b, 0xff7a8891fea5affe, 0xd0a6cf16ba4cd77a, 0x27f4662dfebf762, 0xd17198dd15a00a50, 0x12b3aa31762b8,
+0x897a3d355d1b01f7, 0x9883fce62d18f942, 0xa8aedac259314cd0, 0x8275c1a47fa8e191, 0xd5d2b9844a5754eb, 0x6429416268016682, 0x9e7d955a11da,
+0x9bc985e257636896, 0xb5274cc31e73b3e, 0x5ec14cbd2afb479b, 0x1c035c94757761e9, 0x7f5780737bd374c8, 0xbacc9c00b037b561, 0x8e8556f2c27c,
+0x23721f21c9c36e10, 0xb388841403e5c262, 0xf1bc46cf57adfffd, 0xfe4137f1f261cc46, 0x679b9bbf04d9502e, 0x6ca52a88bf88b301, 0x7cdb7e127594,
+0x18707df47472926d, 0xe0bc61044fb83c43, 0x1df65d921f241ea6, 0xd2fbb3e447b2bd82, 0x84c2db67855be9f6, 0xbe8374542f180acb, 0x21f662b3db035,
+0xef2998080a7b5916, 0x31867187cb42ab71, 0xa7357208dfa5c9a8, 0x7112cdfcca30ca3b, 0xd98720c683fbb369, 0xecb85c4b04331b03, 0x1c053cfcf9f6e,
+0x407020b561f1e104, 0x8429b214dffcb6d3, 0x55a5d2125b6e6e56, 0x833302b6e4930270, 0x1242b71f61e3f919, 0x2afc2c4914a20ee4, 0x1e89d0edd9fff,
+0x1a4aa13096a3867e, 0xab9628cd6a9674b3, 0x96462e186b11c39a, 0x88b961a041ff966b, 0xaae2505585e76ba7, 0x1d68fc5f71c84a0e, 0x3d94788e69bc,
+0x84b4bfa1560d7c3e, 0x3edfa10addb81ea7, 0x9120e11d33219c99, 0x744381a4693ca35c, 0x964745449ff4558, 0x924440472ef5a3f0, 0x1aec741a04c7d,
+0x194ba597b128c915, 0x3317a88dfc365523, 0xe4c9fdd8f2b12a3e, 0x88672b792a7a0176, 0x5487dd726a65d52a, 0x752244275b4b3786, 0xdb342135310b,
+0xc6fff58aef13726c, 0x996126071dd46706, 0x4c61c01739e2ecda, 0x24477eb177f28ec9, 0x690d286c49f788ee, 0xcc46f0cddee2950b, 0xb085064d36a5,
+0xbad4c7e1932d7009, 0xded3f6a98d02ad7c, 0xa4b77e3425b21d12, 0x3e60353754f53f6d, 0xca0707719c08b0c2, 0x310dbb612e857ae3, 0x1f919a35d415e,
+0x98d9182041e6ef7c, 0xe564d43c79be6451, 0xc6d9c65fe79a114d, 0x97bf74656b3d75e1, 0x7b4ec8d4e838a022, 0x99744975ee57cb20, 0x16a029eae49b2,
+0xd5d952255f0902c3, 0xe8256b302163e940, 0xdf91e368c7344d46, 0x81d9607dc86fd3df, 0x9d189f9cb7240899, 0xa7e73700283896d9, 0xd8843bc39cde,
+0xee00be0c1be58988, 0x62eca98631290f2d, 0x588d46502b229701, 0x625c70bca65c8789, 0x6791709e52d8a817, 0x40525b0a2d5d44d2, 0x1bbc78cf52607,
+0xe268b5b79bde0e03, 0x9e97bf4fa9d8a44c, 0x6f67a2b8b9408c02, 0xa2ff54ef74af8817, 0x8d4b486ec2bd9087, 0x9ac33949bebe3eb5, 0x149fdc0b658c7,
+0x4a1f001dc0ddc746, 0x25329344e8ec6bf6, 0xea0c97f3aceac269, 0xf0a0bb810bed7d61, 0x74d26d878d09b18d, 0x83165792bcb35fff, 0x1a955b92a64e6,
+0x68b1cf293197b0a3, 0x97ea1be9325421c8, 0xff73755b8587d9e9, 0x9b19fa0269be40c6, 0xd966ad5585205f90, 0xd8e06b2b936e3f39, 0x8eeccc957f20,
+0x5dce247ab6396acf, 0xba9dafd978c32abd, 0x1ee07a9e9bc1b3bf, 0x93f5741851645fea, 0xe03ebbd4f0514e1a, 0x6f070fe8d3611c75, 0x1a3cfcbff9c1c,
+0x166e7f49c1b7a32b, 0x315912c83bd3fa1c, 0xf7e6fb06f9c3d53b, 0x15e29f6678c3d6c6, 0x853a55d16d84a10f, 0x8f65e095aa63a880, 0x12eceb9db5ded,
+0xf8d850c4ca363f58, 0x8d9ac6f9eb8e622, 0xaccff5b96bc7abfa, 0x5c93cdd42bdaa67c, 0x3373b53f9bf6d143, 0x69b6efb6e02fb1b1, 0xc30c85c06899,
+0xac788a680c40aa7c, 0xf98ce4a9992e4470, 0x39c1e5531b28be9a, 0xa1e67b88fb1df13, 0x78ba9c752194a4f1, 0xdfb04e077710c2c0, 0x45359e967d44,
+0x38fd5351e8f83dbd, 0xc63f16544cd8a09b, 0xfccd44d78099afdf, 0x6401175f505e5183, 0x56a1e6a581b629df, 0x54b7866aee784836, 0x224512fed666f,
+0x9539c9fbd4e56a26, 0x2c74b199d89f7bc9, 0x40f460cf1d1dcab3, 0xfa92360193311ee1, 0x13a0cbda53c808a9, 0x510479afbe75ff10, 0x221486c3c4a33,
+0x7d4a38b12d634b90, 0xa1d1c1ce69bb7415, 0x6adbdaf6e1135e7a, 0xdbc4103645eb4ae4, 0x8889dc14a9a6acd6, 0xae93bddec8f54c84, 0x2084bcef0ce56,
+0x68534e1396ae68a8, 0xe0bc2daadadd79a8, 0x4fd358595367924a, 0xf290ecdb36b56b, 0x2f8cec8d70c697e7, 0x16a6175e4c126305, 0xda96bfc54c86,
+0x99266972ddcf1491, 0x92141d4cba1060cc, 0x6df9e676e516cee9, 0x528e90425a76d03, 0xc21efcf40390afe4, 0x61782ff2e9252975, 0x82090dec25dd,
+0x79c88443e6d21954, 0x78e14615dd68e38e, 0xca1d0ae1bd134db9, 0xfb471413afa0e9fc, 0x30f4b45f3a2b5e96, 0x39a477e38d235488, 0xd3755b11cb04,
+0x7bddfdb101d6cd5c, 0xc56f7adae70a2f0e, 0xdb627508090408b0, 0xe9e294dd8bce2536, 0x90dec70a893b0544, 0xcb9fb6e426dbad13, 0x19e9bdcc89c49,
+0x7bdfe2d364a0ece0, 0x54c990df22da6c35, 0x964972321154734d, 0x22da6a6c4a57d1bd, 0x56fc6c869947467b, 0x69f0867ebad17304, 0x13249cb835484,
+0x77657aa5c6612511, 0x4809b80efb031c66, 0xd1d65b4e5378bb23, 0x84c51281e0eb5cef, 0x274ec374be335879, 0x6394e99201055313, 0x1e7516297d407,
+0x3af7bb9f36a50f80, 0x52659683eca3fb95, 0x45b4e7ef7f2f547d, 0xd10dd04ba2b8b27c, 0xd3d4a30698dbc8b3, 0xf053224856d939c, 0x1373baefaf69b,
+0xfd532019afe85485, 0x953a46843eb5b255, 0x5aaa5cc8f49ec81b, 0x20245ba3e3af3e73, 0x86ba9e64e84df358, 0xfe15f0c0a8d8e171, 0x1d19c86433ee,
+0x8cfe9f52e3863a62, 0xc87eb2cb48de7cef, 0xd89d5cbbee5634a6, 0xd429a014fc26e46a, 0x23706c7474bfa634, 0x718a6e524b72c9de, 0xaad26e0dc8aa,
+0xeb930e43e7f7ce0f, 0x69c6980ead485a4c, 0xe39513c93f3bafb6, 0xa86bed313209f7df, 0x603fa5795cb7a2fa, 0xed56de30d00793e7, 0x6b514e24e3ad,
+0x7734c25a535a7e0e, 0x2139091f4a0bee25, 0x58d0bbf178c68664, 0x47dc89e8e08ec187, 0x8bd7269fb7360230, 0x90ee186c508c7aa3, 0x16dc1fbee405b,
+0x6307804f359843b2, 0x39271e7e093bab1f, 0x42ff0d794ca30ca0, 0x19926c902d1b5c70, 0x939988bafe187699, 0x7de95cd690a3546b, 0x1a1f52fd572a6,
+0x30692c9e73886d47, 0xf9c084d7b71d2e4d, 0x325c0ff91a405724, 0x645ed7a610574714, 0x2e470ec33e19aacd, 0x49d878633809c675, 0xed5db0f4f598,
+0x702a6f5209c3726f, 0xb27d4722c35e205a, 0x950688d7e94b338, 0xb5bc0af63a8b9bd3, 0xe892bdda2bf0044, 0x4b995040e46baaef, 0x14a8d3589b3d2,
+0x21b4e08a6022a316, 0x271680fcc438591, 0x418c4aafc5db3527, 0x69c4079058e0d25, 0xf14aabef872dd8a, 0x4724c5d6ee0c183e, 0x13cdefcae36f1,
+0x99df76829ef6a030, 0xf9c3b6e2ae2cdef5, 0x31413996a5ceb83f, 0xf70c386c3022c7a0, 0x2a2eb5857670d68c, 0x54e85d20031b14cc, 0x2112f1d8d97d,
+0x8af3cc49dbcbd850, 0x61dec60ec853bdfb, 0x95111d669dde2a85, 0xedc1f91c74468016, 0x4718fc5935ad4454, 0xd445111ecce43267, 0x160ddbff11e8f,
+0x9089881ca3cdc86c, 0x8b66e2e31d57388, 0xf1ae194bb601dac8, 0x3eef769ab70a0615, 0x4f9b9477277c08dc, 0xf1d98424aaf10b42, 0x4819dd96a511,
+0xe2a0605105789ead, 0x4b8c1459203c3f5a, 0xe846ac0ea896634e, 0xce464409ab9cb5ed, 0x3bbfab65e4182570, 0x86200e55d7d47535, 0x3039d21171ef,
+0x283fb8d812ba5f57, 0x717bb21805552ff8, 0x44872f219b3e1ce5, 0x21df326985aacae, 0xb50e1a4822445c55, 0x81c3e361b4427c82, 0x1aacc0b9b5ada,
+0x93432e6a6e301460, 0x34bcead6e03ca9a5, 0x69bdfc0a6ff9b61e, 0x689124c6dc2368e7, 0x872dc05461810fe6, 0x835d24d38b2a78e5, 0x20f2a1d109c0a,
+0x7dc4bb359217a445, 0xf00a7b75c836be13, 0x502c8863443be0b3, 0xe9f9bfbc10b5332, 0x3d53399683d70402, 0x952a7077c58cccdd, 0x1c7ac12da7927,
+0x636d6ea5cc4dfd7f, 0xfac1df78b4f3867e, 0x1553bc2390b0a746, 0xf15ad162f73b60b1, 0x8e2336f357e48d81, 0x18a3872a5aff900a, 0x113458d97421a,
+0xbe00fdfeb91b9441, 0xb69b4e414ee151b1, 0x3c38df25673c76eb, 0x4361eb0c538bf18f, 0x83b62b6329dde7d4, 0x85d2738514024305, 0xb434f280273d,
+0x6d889de8cfe753fa, 0x704fba766372cf77, 0xc13596ad3438cc38, 0xe9f880022f806e58, 0x82c87f1f8be1fad9, 0x657daa40d365c96c, 0xf3db68eb77f9,
+0x1ccd8a974bb0f2d1, 0xfe33e9451ca7f273, 0xf02a318d21d6ca69, 0x21cafb96eb481aa4, 0xd9b94010365e13e2, 0xc53318d81fd2a8dd, 0xc508ee3bc9bb,
+0xe6315a9ae1307d95, 0xf2282b5d50b97075, 0x55463fe020dfd65d, 0xa56f5df8bb26cea1, 0xb7008472defe1c39, 0x5bf3d79747081d76, 0x17788648f863d,
+0xf30a1865d23b9612, 0x5247c0335b2b1f7b, 0x3705596393cf20a8, 0x856e4dba77902b62, 0xb36c785f31b91df6, 0xe98ac0408d05c884, 0x107d694a173ab,
+0x90a99a15c68444e6, 0x69e8a2e726a135ff, 0x969b95f9a372dff9, 0x1d0b9ce284c02bee, 0x422b4182df800a63, 0xab7c8a87b745bf92, 0xde1dfb7f6c0d,
+0xe54fc76168d1633e, 0x65aaeadc533b53d0, 0x3e76dd8dc4abf066, 0x81cee187e9e9ccaa, 0x49a165808638abd5, 0x4db02d03c42c15c, 0x5ef1876086dd,
+0xb8bf6ac2d1fc073f, 0x72d055acb5ae9046, 0xbf8d3d8686752ba, 0xb465ad9890c898ca, 0xf70b62939a0e1400, 0x994813b06d324ed5, 0x1161f1b47ed0c,
+0xe765b84bc3e14d5e, 0x325174ac6986e6e5, 0x4b7278680054a680, 0x3b07480246feb1fd, 0xea3d583bd0b5a1e7, 0x3929f70a067b369c, 0x100a74605ad06,
+0x810cecf7656195e5, 0xc0514f90e6d9d448, 0x743a8e7518b0b69c, 0xbb5d6891aa3bbe11, 0x65f676adf8f7441e, 0xe68344e29950a6eb, 0x7f0a2ae1063c,
+0x9316b1518ae2e494, 0x3166dbfa86a9a644, 0x16b7e196f42d4070, 0xf68979a996426981, 0xb1af2d4c8bca8fc0, 0x1b6fe01e53e0dc30, 0x2112f04280236,
+0x509105294cbe4b7b, 0xca137d5768df1384, 0x8b92bd96e34b0fd7, 0x27d0bcbca39c9654, 0x83b36c7911d6f1a4, 0x6b12dd23a7e8ef40, 0x1bc13fb423ad3,
+0xb52630dc909ba627, 0x854b9da8cf74338, 0xbbe3a73e5ddac391, 0xd49efd2bb0d2d757, 0xd6d73619def0cf0e, 0xe02e0149e19b0eb8, 0x17281ddad2372,
+0x644c33a1edf5760f, 0xe73c617671eff85f, 0xddff2473ed686ac9, 0x933be9ea778002a7, 0x8bfcaba7b9a6e62a, 0xc0d0c4b74869c803, 0x158e217bda8d,
+0x6961a9792a30e9af, 0x83c9d2fb5193f14f, 0x50f2710f5f6c7b62, 0x21f8e2f2ec910eca, 0x1dc9f2f9bb0582fc, 0x1a94844ba62c80b, 0xf4d886e7e4ef,
+0x3e72ebc157a71617, 0xbd1e15971b04146f, 0x3f4aa8fba3357264, 0x991a7626318eb22b, 0x740b9d530ae135f6, 0x22fc47ed7708086c, 0x22b9515a67838,
+0xc85318ab161c9c6b, 0x5a5447e09b834ec9, 0xb1a0763098a9623, 0x373287db68bafe0e, 0x6c945d6bd47bcb4a, 0x840d44ea32619fe4, 0x162a51b0d858f,
+0xf5b42ebbc8167e58, 0x8fdf161b494332c6, 0xe0984bf69540f084, 0x55779314c0c4614d, 0x79e86ef0c3a3f227, 0x1fab52bc46ea618f, 0x210cbc87ded9d,
+0x2c724a4606a51e09, 0x78e8779b63f70452, 0x14db6eed59419581, 0x9cf59f345b0fb89, 0xceda0fab02791b11, 0x265885f04946bb1d, 0xb8069d96f91,
+0xc62af1ccabf87cf1, 0x355f94384d1b28f1, 0x4804dc218ba761d1, 0xa86bd9bf03483c89, 0x49fff18dee06db28, 0x33c3f473c467f840, 0x20e1335c2ed8d,
+0x21d042eb906098b9, 0xaa452a88ef795714, 0x2af6c3fb2c29eaa1, 0xe0f474ad86f2f4a8, 0xc018b33dbe859d81, 0x74fb588f2f0f6dfc, 0x11bf4b8add92c,
+0x48f5a212a01f1363, 0x52b413564743080b, 0xf295086bf6e1381, 0x6bdb9e7f3d258481, 0xffff7d17e3daba4b, 0x6015ee3eb1bb4fcf, 0x22496cac9ce79,
+0x66c0259654400228, 0x5a7ce361c4db0505, 0x88800d6803d411a, 0x9ba925077651f12d, 0x9cdfc36990c7ce54, 0x27145be0926453af, 0x1d31593c2516a,
+0xdf925f243be30be8, 0x6d82f85e88642c3f, 0xfb71d9b275cb4afa, 0xc90b6f1ef1ea8858, 0xc06e0ee6cadd3212, 0xe0383dcde4b648f8, 0x15af0350a0779,
+0x337fcae18af2ee59, 0x458be9cf67c41c5c, 0x8c57980bbfd334c6, 0x5fe69fcd9076ed2d, 0x5f39d33d6653fd6c, 0x74702ac357e82318, 0x1a004fdf32231,
+0xbc9eca01f6ad10f7, 0xe5ac3d3d99efc3b5, 0x9fc67802c846bbfd, 0xe11c1502a5eb4a1b, 0xea18f1d61968c0cb, 0xbfc1ebd61f6ba350, 0x967ccfbc19ad,
+0xa03ee6d168eb0fa1, 0x19ba56ab81b47561, 0x5fc33739e4f36bd4, 0x8e1f50f504bd3e4c, 0xd271038a49830ae9, 0x6c905c731db8a1e8, 0x10cc5982b0c57,
+0xbb1d1522fe92debd, 0xdb5f08e17f81572f, 0xb7c89c93af4a31e5, 0x2551344c6eef64c0, 0x9c6fc0356df34aeb, 0x5814be963229d240, 0x1e4477f1ee677,
+0xd2b9cf38b4d8f73b, 0x524fe05c0d48abf8, 0xb8ce78020c35a2b, 0x759ba28845b592f0, 0x6dfedff507a9290c, 0xf826c4692a2f2766, 0x1a79e1a1329a2,
+0x76c570deb51a6b70, 0x8a5999836a792511, 0x93678139c578ad67, 0xb40eb88e58298e2b, 0xfde0225f6f816715, 0xd0386062808988d2, 0x196ef97bde20a,
+0x8481572bf98b82d6, 0xc5c1160448f3fb56, 0x454d1edcf2562bdc, 0xe2a43c30b8c20e5c, 0xe35005f2dda57830, 0x8595dcf1b31a24c5, 0xca3a82d888be,
+0xcb4fbcd0d96d3413, 0xe3de9914bc34bfdc, 0x3a9e1e591d2c52f6, 0xf6b98d89169339e0, 0x37457a59fd8123ed, 0x1e25888a1b60d48d, 0xaea3ab3b6d7f,
+0xe6aac04f71521e0, 0xd9597d5d4d937b18, 0x5d96466e5ed517b4, 0xfa4c104e8405a31f, 0x4d040d45ef19f4fd, 0x33a5ba32c695d670, 0xda8d2ba9ecb5,
+0xad5f1925c7c1dfd8, 0xf305182398ae7152, 0x6308c4d9c0ebeb8c, 0x6221eb2d41c9b170, 0x5a2c69a638b81620, 0x4ea4074fceac131f, 0x25609791c140,
+0x7d71678dedb48d09, 0x21d53c22e7faebc5, 0xb8e3ea5ad00feac2, 0x5722f75acd508d24, 0x63a3a450ac85bfcc, 0xa0f9a6aea58d2b2, 0x9c05c90f736d,
+0x70acd8bf1ce98518, 0x937e082c13fca631, 0xa5b521ce25779418, 0x6031fc14d8e31655, 0x3e9a788fef7d3a27, 0x33dc01d0e184da9, 0x5aeb4a7cd359,
+0x3e3329b57c51e70d, 0x33881cdf634c1a8e, 0x4cde6ee89d11ae85, 0x7e7a9c6d59ca789b, 0xc91673c572b33bc0, 0x7252843fe43da19b, 0x9d1ae1656129,
+0x2663e790ea0bc6f9, 0xf33fb830199fdd, 0x24a42709350cf07b, 0xc157c87f123b36a7, 0x9fbe6d1a5cd30732, 0x720ea02caf16c4a1, 0x77c33bcaa167,
+0xd849045a28ae01cf, 0xb90b24c0821789f0, 0x8ea2680a0e7fba82, 0x836b7eec8fbab4a3, 0x4e2fde921d231be5, 0x3687438ead793407, 0x15fb868250746,
+0x4796c24ee6376435, 0xef6f2c8c3f64147a, 0xad6e29cb1d33ab0a, 0xa8ec5f6522628a25, 0xa76cb63c5c42c866, 0x1440f8f2c1f7d1f9, 0x2fbcc4e29148,
+0xc5f5fda3d9125c0, 0x77dcfa095f942d00, 0x44ba52e2c4876025, 0x3158a56fa1c51ae8, 0x56efbc895d0f3e66, 0xaa86c13891655741, 0xf04fdc7f4c2f,
+0x933f1147e8b5bdd9, 0xff7f6e533505e176, 0xaac11df53dcd8409, 0x455c9a7c12bcaae8, 0x4b85539885cb3381, 0xea72a4b9f646fd5f, 0x13db735f0009b,
+0xee0ee639a5c48f48, 0x58923f68e6525969, 0x801585617ad6441e, 0xab39520a924e4b29, 0x342c864484dbdd4a, 0x291e836e93d6037c, 0x1bec4221db12f,
+0xce73868b3986c462, 0x38ef263dc164550b, 0xc6039dc9d319506c, 0x9291aa590d20e883, 0xd25b98cea2859511, 0x3b94794b2d8ab492, 0xbefedff17861,
+0x3befc7244c0f11a5, 0x337c7a3927c31c1c, 0xc4f3ef68154d2e00, 0x7e66c43b030154ee, 0xc5b308e623a1fade, 0x79a43cfe19000309, 0x57f357f8cb1,
+0x51e87539e6e0129b, 0xdb36cbad64cc8e45, 0x4a85b8551f886313, 0xb95a6b9d12f07404, 0xb818da4487baff24, 0x74ccc2fcf7ebdca8, 0xb3d5b8cc12b4,
+0x682a868bfa5e92a7, 0x73057e223122a2b2, 0x3a0fd75e271f169f, 0x83fb23ffa2b811dc, 0x6c15cfc869a43671, 0x948ef1cce4b3c59b, 0x127045fa16236,
+0x3e929b96efd71a4d, 0x7920da8d82eb69d8, 0xc78f1d4971a38c90, 0x73881031659d72ab, 0x7288ba6646174606, 0x1f1af8e528f9ee1a, 0x15885d71d6ef7,
+0x31853ab2cdb5dae8, 0xa9c906fe0104b577, 0xe001894560c32a6a, 0xafb0ee2747305f70, 0x2e612d98d0547535, 0xc7f8605f4e342c42, 0x19be97194be9,
+0x2135cd2441e197bc, 0x8ca11d5e075d504e, 0x88eab81879c2e171, 0x7916c8531f28de2d, 0x5ab0302fa55d3819, 0x32fc12353800d0ff, 0x20c575ad12c32,
+0xfde98fc6ebc1bbe4, 0x71d1e0e063a5d82, 0x888b9a08bfc9c148, 0xe4042aa337b25589, 0x4f1823f233e5088d, 0xd268fb48827f306, 0x100d6ec272bd4,
+0xa190a311cad8742f, 0xe8487b094baaa80b, 0xc0c484370a187053, 0x84a010bd995305fb, 0x6d97b8e8cbb7007a, 0xe98a85def7cff6b1, 0x517cb9872647,
+0x19c9ddea4b1bbfff, 0xceb60507af1e8994, 0xbd0136b40a73caa, 0x14841f4f5781e229, 0x19edb800ff55ea9b, 0xd32ae948195130d4, 0x2dd16e745004,
+0x2d92c989fa3ca658, 0x7ad57d11b508f90b, 0x8d9beff94fde5be8, 0xd5579379ab04a536, 0xb5f48c4033d4316e, 0x8440db167c11f3cf, 0x19a86c67ed1e9,
+0xd4a78b782eec52c5, 0x3c5614de20f93c5b, 0xab6bbcf2dc1616c9, 0x99eb579cb89f31ff, 0x73739ddc01805d80, 0xd546c7ccd0f92906, 0x204d534c3af9b,
+0x4ba489e3e9b6cdcd, 0x9270ba881bda3937, 0x440d235746a318fa, 0x9621c0193c2a51f5, 0xe7767357c2e671b5, 0x44b9353f3a5aa791, 0xc5453f89e602,
+0xcd4e9471349674ad, 0x1aeb39f78d7e5b41, 0xfef2a55e65c6fac0, 0xc1cd75ec65ac60b2, 0xd28f1217288737e, 0xd96e226e8580e1ad, 0xd1a68a58865,
+0x421c0f367509d627, 0xc486fb7b52d6d10f, 0x531bf76b76b8171f, 0x4789c71a246a637f, 0x6cb566266ac479e4, 0x3c84e1d9a107442c, 0xa993596b5a50,
+0x8ecec974c1a4c64b, 0x35cd11cd18c99de5, 0x831afbbe7a1859b1, 0x9949dbdead703df2, 0xdd49f69c7f0bdd5a, 0x61a577f7489b1b82, 0xb1f6d594cd6f,
+0xb3805e8e2d3ed824, 0xfbd8d67b29f5096e, 0xdc18d79c62653c56, 0x667153508cb7e4d0, 0xf79c01376d6d6ce3, 0xc248845b0cf34a50, 0x1893deb26e07c,
+0x72498698eccd491e, 0xae5b08c2fe79b2c7, 0x72924562451e1d69, 0x4c125fc109300ccd, 0x7c0d264b7e55008f, 0xf0f323cc95031fb0, 0xcf21d51584bf,
+0xd4cbf02bb1e0b2ee, 0x33ed1f11a9a5c643, 0x207ab3e67a7e28ca, 0x14c2c7f9a2de8e2f, 0x4e2c07d1af4d81c4, 0xf7e61f6be6dbddcd, 0x1073f21cf980,
+0xdf99448ed3e32422, 0x44c4dbd1507755ff, 0x863bcac10cf9bfcf, 0x5be00dd0890214ef, 0x85b2fa0c45bbf75, 0xe56ddc6120c283f8, 0x70b8ba40e7ed,
+0x27d37c6f3b5b5e50, 0xe68d5d88f4d2e955, 0x6c7f8d6914a8a237, 0xf2534a55bef4112e, 0x215aec752af16bae, 0xf6c5ab49004250c9, 0x21d46716180fe,
+0x1c513c982ebf56f3, 0xb3bd64e1a09ee13e, 0xa9f5bf5fba3f2a63, 0xf7be5378b2fdabc9, 0x9ac1b7ed41a7d271, 0xad24d33179a1ed01, 0xca358d7dffb3,
+0x12349970fc833a4f, 0x2a0cf548a1837fe7, 0x8e37b5a084b63248, 0xcac9b182fb95a7cd, 0x7514b93a9982d7ca, 0x1f7a2d118b0dee80, 0x3725465e39cd,
+0xf34025b3e294a528, 0xfa22127e3ebd9815, 0x69636f04030a0325, 0xecf5714cd7f0c554, 0xfc32f83a16e7618e, 0x89bbb013badc0c2f, 0x1bf48aa6ba509,
+0xcc9535222a4b75a8, 0xe6b3f479ec8859cf, 0x24dd28cac270418e, 0xf2e87442983a50c8, 0x9742a49e7e618a44, 0xbeaffb4ae88a26a3, 0xdc88a080e69a,
+0xb499d0460baaad8e, 0xa6fe148b72a70dca, 0x5925cc87546a84fd, 0x41c2ebf2eaad9ab1, 0x86257289cbc7a9b3, 0x183aec877cbac79c, 0x21c99ef04eecc,
+0x91377af9c38fa039, 0xa9feb3e5db3f9220, 0xc145c29941c6972b, 0xa6cc565587082bea, 0xed83b2a270c90aa8, 0xfd598a4683891c63, 0x11e0debda99c1,
+0x61936816cd24cac0, 0x8a6f5f61f0d5d0f6, 0x687d790c09f0c460, 0x83b0b8cb6f4331fa, 0xaaaf63922e14bb1a, 0x6d65fd6a085a2970, 0xce5b3326a215,
+0x4b74e22cd4731c1d, 0xf54f2be9bb0de7be, 0x3eb088b17037d92, 0x37d6a38fb72e44bf, 0x2dac72977c37c3af, 0xf313695e497eb681, 0x1a3711cd89ae2,
+0xe246498deb410e09, 0xbffe26d928b04ef3, 0x3af0635365edb4d4, 0xb18aed2fd074ea33, 0xa351a2c559ac1a7d, 0x3442e71048ebf99e, 0xde1367159ce9,
+0x34fe66a134274646, 0xe5c720602409dfd8, 0xa79c43fad5086a61, 0xf0384377d95f6764, 0x8a21b4de2e20a310, 0xca8d24938b6ca1c2, 0x1242b94832761,
+0xb9eccd0cf89699ae, 0xf2b3aef5f0343716, 0xd3ccf49469a92fcf, 0x169daf296df318b5, 0xf9d0f6b50232246f, 0xf1f5aaa8810c82a8, 0x17821f7631331,
+0x616f43c172bb2282, 0x3162f77d63119e37, 0x5fb860bf2d9a0660, 0x9d9794cd581aed35, 0x3b7a786906b0585, 0xe84e387c5dcde289, 0xfb17719d4262,
+0x9436a5d72630d736, 0xbc6484ae0d2145d9, 0x890c58a1e7990bc3, 0x5f9a2bde56acc6f8, 0x2857b3fc66d779dd, 0xefe728a292f899c7, 0x10284501d1929,
+0xf09e7cab5fd83252, 0x6594132ed922a3c6, 0xdbcd8973c1751448, 0x1bcbf8ede2d814d6, 0x1f8b88371dd4a79e, 0x867dc9e228b8c7eb, 0x1d2affb1729e9,
+0xf5e0cb7741a42ed, 0x26d1891c868cd398, 0x1b5ac5c03bde66ee, 0x3ec786d700560d38, 0x931a39ef0c5eec0c, 0xd266079c6dd83be7, 0x7993d13ccc76,
+0xc179f1451f59716e, 0xe9dab2760c219fbc, 0x3e209dbf639b7393, 0xec6569b61221ee01, 0x1e9bf9e17e933491, 0xcf80f272059de0b2, 0x2cc7fa5829fc,
+0x900a370bbe3f25b1, 0xa9b0fa960f868188, 0x50a32d794c7f5b17, 0xd0b74b1d138a6511, 0x57bf0b0d2f188f44, 0x9276c74eac7222d5, 0x2d0606b2616e,
+0x762e053fa0b06c82, 0x2cac26d78deee6a4, 0x5f4955a4d40d2cce, 0xdad1649ef6895f44, 0x214997333a180c11, 0x3cec66b5b6358278, 0x238698b4a386,
+0x778d75afc6d4216f, 0x9cda738bc275b42a, 0xcee048a2b41f399a, 0x67a42d87a782ade6, 0x3d06f8dac90d17db, 0x734da4f615d8f09, 0x1aef0f242875e,
+0xe0ef953b118ece8e, 0xa1f7262ea7635648, 0x7fd4f57444702e8d, 0x4a67fd258a494db6, 0xd30e025603560d54, 0x35516561e6b53623, 0x20ef1b5ad5005,
+0xeb2e9e9dfe97ed54, 0x1cec27338a76a95b, 0xcc0210b3ce07ac8e, 0x60e11ec02027d112, 0x2d5c6d828ad6d9ac, 0xe2303295bb94f204, 0x6bace321958,
+0x120024be028d0572, 0xf5d909a020b1bfd5, 0x58805012397f10fe, 0x4b8cd2681dbeec61, 0xa3dfabd2d3009b1e, 0x3413e29e3f40d651, 0x1a3c40ea74ef8,
+0xb62d7dba9e5640be, 0xfdacd032d2c3c859, 0xf8801cf090256f4d, 0x50803b65b266cf3a, 0xe9e5d17c48bdaf19, 0xe90f34184912a4da, 0x1867649585db,
+0x80410bdb3db8788, 0xdf29fa2edb11409c, 0x9d6c9b9953419f90, 0x840208430aaf00c, 0x4a28d37666a0606b, 0x27f94c1ac8a33f42, 0x1c48651609bc,
+0x7a386068f3541fcf, 0xcfbbc71bcdb3c8ce, 0x303ed035f96ca971, 0xb5a0c8d62ecf2bcd, 0xbec7f89c47b9a7d, 0x8b9e6c344f6e42c3, 0x1f906176e4a17,
+0x334a6e1637550053, 0xa3e26f3455b920b5, 0x557bf01675c8a03d, 0xe68ce9460f79b0db, 0x30c85ccb4ad62a74, 0xf9db8d6750e505ac, 0x163d5fb169774,
+0x2153b48414fba9db, 0xaad0d5e4f0a240ce, 0x5447dd1f6d1b91ce, 0xbcd38dd3d5ca3db0, 0x455c6e4951197c26, 0xd6b968d3da8e8369, 0x210e83eb1ba7e,
+0x765f5fac48591625, 0x1daab77c82298e7d, 0x737b18d67cf8a323, 0x1bb72bcedddfbe25, 0xbf31d61c8c71202a, 0xbfac43f365d571c3, 0x1b13fe7d7fcd8,
+0xf80c0bd5f815dc6e, 0xbe359dcbbbcaa7cc, 0x11df6563d56b97bc, 0x7639cb18170216f5, 0x3cd4021b702d5c3, 0x3fff7aebae15fbc6, 0x679ddd673446,
+0x2c3f926ad0de44df, 0x8258c018ce873740, 0x439d47e2dffa354c, 0xc3a17cae4782476f, 0x9b5a7efc6d99b149, 0xe3b64e080cb4c047, 0x5704bd77b10b,
+0x7d45240aae8e6d92, 0xba9e747552c2d94, 0xe8d8ea0b556c7609, 0x50a5a903b66addbb, 0x94a604a82d9e28ee, 0x7258a97cef4b21b7, 0x144c03e455baf,
+0xefeb914432271122, 0x597aa10ab6ed9d9f, 0x810e4a16a0d15f03, 0x8704aa2aa7d64741, 0x6011e6868bf13dab, 0x1567d7adadaaec79, 0x2124c13c8a90,
+0x839bce9b285b648, 0x5890779c0c0f1e, 0x1d66c6baa5201265, 0x2655bd8e60ecd94e, 0x734bc606da8fd5d0, 0xb50331e73484ce78, 0xbca7290ba7cd,
+0xe3e8c90c5dec443d, 0x376f64a4a1fff980, 0x1e8bde27475bd07d, 0x1daa6edd94155ad4, 0x298b49392660f7e, 0x5c28d2b2f57a07dc, 0x3b653312ebbf,
+0xd12921163c3a4fd5, 0x4551250ba6b25730, 0x5f79ddc0af91207b, 0x4ecc3943434dba86, 0x326bda9d8fafa1dd, 0xd93b8cbda5d64335, 0x114faadb09e7b,
+0x31a906e1195c294e, 0x8af0a067c31e6d0, 0xa8d38caa1ad9aac6, 0xe066a038065226ec, 0xf09510e6236c656c, 0x2871b80de7f2fc82, 0x220efa0763655,
+0x11d872fa5924990, 0x236fe969948ef801, 0xb602fe73a0ad1794, 0x77fddb8bc21bc264, 0x6046c6e1ece60732, 0x13d3238021c672e, 0x11a0aed2bdac4,
+0x41cf0ddfc88b041a, 0xf16618e61c7513b, 0x49b6d2322a23fd4a, 0xe8f96b0ac9daf8f1, 0x36de9ceddc3a70b5, 0x3d79b397a6436ab7, 0x10b3dab9eac8a,
+0x8b625c3ebb94a0fe, 0xe75e00dcba028914, 0x908c4f4a8fc08360, 0x7d1d3008ea3a2c1c, 0xb2f952592ab844ed, 0x6bd48761c479b62a, 0xce9b54a02d8,
+0x2ee6c93b8c52de6, 0xb6150ba8030c2a2c, 0x41fd0a05135af92b, 0x8d47308daa85bb62, 0x1ea40f2b54717112, 0xbf89481f3e4079c4, 0xbdd7564ad71a,
+0x59b347e15dfc60dd, 0xde911be66de28bab, 0x792b78699f3be050, 0xe1fd4f7b4005aea3, 0x95966cb427c5e0a5, 0x12f2a93ce6d4e071, 0x19b61384fafd3,
+0xfde821ad325f64be, 0x3eebff9a2ff133d2, 0x509e1d07b255866f, 0xe7ff87d55a69ba39, 0x713258dd834e2b30, 0x7ba30d5a6ba7321, 0x6d08ae0609e8,
+0x3db90ccf94b3318c, 0xa7e60089751c8784, 0x6b6fc96f013b2b32, 0xcb0cd8934ecac550, 0x7e217ecfc1c04d7, 0x6716d8e2509c9356, 0xf55b86d54223,
+0xd55907d64f0c4c97, 0x65c747e57f57362d, 0xd7e35ed60b3f32f5, 0xa39addbf3f78e4cc, 0xb714a6cc70ff1d6a, 0x7e5eed5514cb3eba, 0x6283330bf4a9,
+0x78b9976ed4c67113, 0x50663dc51ed49d97, 0x57cab463c1c1adff, 0xaab0c0a1ddceaf75, 0x6636971c2232e05d, 0x4f2fedf62d993501, 0x9cdfe0a61d80,
+0x43d6d9e2ad7af37f, 0xebd4883d12312f4c, 0x89f1d090f4fb550e, 0x95d0915aaa21b3e7, 0x51004dbb5592d8e4, 0x45db3915e2d71f11, 0xa5ebac53a077,
+0xcc4ac2ac98d4aec6, 0x31e7e5e6da974a01, 0xf85bbbe273b7b9cc, 0x5df4d6496672e11d, 0x17c26414df64da0e, 0x8345dc17be58d612, 0x95f0f548b2e3,
+0x2d92b30880d4b500, 0xdb62c63ba0af3166, 0xb696813d51c9b3ad, 0xb3c1e1f3955d1355, 0x3de2bcde9ac12a5, 0x8140a62d5b59435b, 0x21701da1a52db,
+0xe645773332890d94, 0x376b9ff07afae827, 0x543485df46844780, 0x7a5079a12f8c0c4a, 0x25fa15d969aefedf, 0x3ddf083aaca14bdb, 0x1f296b0ef0e93,
+0xdff28ecb96db89d1, 0x3786989e35aec93a, 0x2d0345f22527e18a, 0xafff08ed6b2376ca, 0x394370331ccadab9, 0x48039e1f15b4ae28, 0x1718e29d837f4,
+0x35070858e80fbeb6, 0xb9093df8bb8e6166, 0xd2b50a77bdf992af, 0x7aeb03d580974652, 0xa5d16df0b445c3ae, 0xd5843a9964440970, 0x1d74e173f59b4,
+0x4098a691e07a85a2, 0x16aa8eb4808401fe, 0x6e91554308617912, 0xee8fbef97988aeab, 0x15063060b8f5474, 0x875a3017dabb3176, 0x1ee02701dc0a7,
+0xdf2ab9a36af680de, 0xad882f5660a41829, 0xf932d2800b955a4b, 0x9a1b74bac3a981eb, 0xb70919602be6c993, 0x83493094c3eb982, 0x1ee376d7fc67a,
+0xfeb50c8534affa89, 0xf5ca53f0c906c71f, 0xabbbfba4bffa65, 0xae8173df6d6e7ebc, 0x3b85525dbc126e42, 0xad045015007216ad, 0x1ac523758f0c2,
+0x22177ff0b27002c7, 0xc383b8cd9eff53f7, 0x4b8da33c219fc31f, 0x21e0d7333d77f5cd, 0x5507af352284456b, 0xa4a591bc274e122f, 0x1773d022dc4fa,
+0xd720d45d46c35383, 0xaf5fd29b98a2ec9c, 0xf598c12bc3c2bae9, 0x5c4473c7031feafb, 0x2e7875841f5d8c8d, 0xfe08d1e1e508d276, 0x4ce9238dd294,
+0x4ee51d88a16756b3, 0xd7357fe22f60e7ae, 0x86fcd2199b2d2043, 0x68db81ad115c3a41, 0xe293fcc7c8e7514e, 0x72ee97df071cfc3e, 0x15f44465c5c9e,
+0xbd762be936a7437c, 0xccc963a48b87ae3b, 0xd4cf24355b329b4a, 0x52dca984dfd7e48d, 0x4d8e617ae8789b99, 0x1b5873ac18c3619e, 0x9dd56beb0e1f,
+0xc862a622e75036b, 0x83ef5344d6161b70, 0xf87fd33e22c2aa55, 0x36fc6c3afb63c136, 0x4d576d1694718a11, 0x5efacb0577e98eb4, 0x2246f0556cbb9,
+0xa2f19cf2d5731597, 0xb77fbc97d78cd338, 0xd4882a71445a9a3d, 0xe013a3db9d19ec3d, 0x56ad87a3bdfec224, 0xa19099e9b264ac9b, 0x194eeff00004,
+0xde4790b659620f8e, 0x1d8ebe8a6a938354, 0x14f75cb966b06c10, 0xaf9b6d9d5d7f52b6, 0x2846d61928b1a9f9, 0x70e1b1fe4c2676a0, 0x72e062ec5ff3,
+0x538b3d0c310bed13, 0x8019e6c5c7902745, 0x8c477fc5cede223a, 0x12538a46d6afe277, 0x2fc81b836c615705, 0xeb2c765f50cf89cd, 0x188b678d7e755,
+0x6e07de0b4d0ba364, 0x3b3fa67a04c8ebd3, 0xd5f5ce62aeae2f2a, 0x6ee97745b60c9f65, 0xeaf9befe93ddfe70, 0xfa94906a22b89bff, 0x370e0767a9ac,
+0xdeca1f9652ebd5f9, 0x5ab98401474ba147, 0xe1fa0825749c7b11, 0x42badd8575287fce, 0x829a01b71c7610c0, 0xcf2f916080e9ec1b, 0xeb0cb3b8ac65,
+0xf4f3d93d7213be82, 0x95b57ac14a66b17f, 0xd7fdf6c483bc1a24, 0xe1e3d7d84997500a, 0xd197347e8d1cf5bf, 0x4a3ef1eaf99f4699, 0x11325c9deb65f,
+0xdfd91c9718841661, 0x40580bbe08f9f7c3, 0x43e313805f1c0867, 0x276431c5a2cdee54, 0x50a2b97c36ff9702, 0x32c5b7aa1a27bad, 0x1e012a1b6b83,
+0xf912cae65a94172, 0x32e619f6aa3e39cc, 0xd7ec1230d5fba799, 0xec3dae003c52aeee, 0x75f4ff3e2c89f07b, 0xbc37c7fed3ee368c, 0xbf3c4d1e3db5,
+0xd3020e07de3cb98b, 0xba559b05158a3502, 0x348b94dd4d6d4aff, 0x6ff1fe959c10add2, 0x7c218067e5652735, 0x2d722cf497563dc2, 0x159266981064c,
+0x562a17224a07c17, 0x62e238d805004eed, 0x262d47a1b7bde4c8, 0xb872ffad4bd903b2, 0x6a946bb50541063e, 0x35aeb71d8c51a971, 0x600e2bc463cf,
+0x4d72b4b522d246eb, 0x834fbb0dc190dc51, 0x4db6708047fca074, 0x17277f67536614cd, 0x6785c7171aeace63, 0x7908717031d03fb6, 0x120f470dd45e9,
+0x3127f4796bd24011, 0x6e3db70a9311a542, 0x20cddbb51bd419fc, 0x912d81dd364a30bd, 0x3c76c07d858908f5, 0x73973b86f1ed1345, 0x150f02dfb518d,
+0x4c3c1993b6ad2abd, 0xef7f8ebe08fd6db1, 0x38d457bc77838378, 0x2fb948e550a94c31, 0x1fe80a0e41cfef31, 0x47a20a39de540d04, 0xe6c69b99d5d8,
+0xee14d7bd31da1780, 0xe1665f194eda9955, 0x283d17b0d9dce0d0, 0x9b581bc3edc26589, 0x3a8c41dfff6a160, 0x8dc4997cbe62fbe, 0x16fdb96b6c160,
+0x1ea8ce23afd527b7, 0x2e19e7c9cc41a586, 0x5b1c5da1a3d404e7, 0x6aa3a083447cfdb3, 0x69531dcd3064bc07, 0xdb2617ef6364f305, 0x1c6b71362042,
+0x55223f262cd507f0, 0x7cc361fed8399883, 0x71379fd5856eca8b, 0xbaa12a35987ef146, 0xde4847c7ffb46109, 0xa84632e68122ebf2, 0xd1aaad3c3c92,
+0x66c47fd6dec87fd1, 0x30c692e43ce579ee, 0x18bd768b676c99ba, 0x73db19ed4f6795d, 0x51b98507ae269f84, 0xb63cd9cecdefc114, 0x1120d1fb0ffac,
+0xfec01b601caa958f, 0x4153848c216c999f, 0x8caab31b6e44343f, 0xc867d86be0f7723d, 0xbb714a0fc4f2756d, 0x3db636779f7a437f, 0x3cfa562d33dd,
+0x11b3dd1654a382e, 0xd95ff89ef801322e, 0x546ed4c2a91702ac, 0x5e31a87a007b2c8f, 0xbe9c9f3f90b1668d, 0xf759911f049b3bc6, 0x213ee758d9754,
+0x9b0d6b11043fc250, 0x3a3c4a53355f5ea3, 0x560a50544b5afb6a, 0xd285f98904a8b970, 0xe4b03d7f79940006, 0x4b655d933f707862, 0x15a7eb415d7db,
+0x8ede3dda1b77fac, 0x8c17b53a689f7bed, 0x33b20c6d4ab997ed, 0x7c2cae242e2f3bd1, 0xf221dba394c81f1a, 0x855deb7f0311d7a2, 0xd54a39c8c3f7,
+0xc421b9ff900d0602, 0x31ff60010d2b7b71, 0x36f1bcd7ed13b09d, 0xc28b21d3c17b1329, 0x1f2156cc124f321d, 0x12dcc2c9c3505373, 0xbbf28ee464db,
+0x561d15746210360c, 0x28b81ae9c1118a5, 0xa510fc007928f845, 0x38196eedb23078e6, 0x63aa0c300157eadf, 0xb08f005b6c1ac7aa, 0x1ea077b7084c7,
+0x6407674c502ffc1a, 0xfee536c8f03c9617, 0x1d0bfff2001dc98e, 0xcb44b09a21db9bc0, 0x6d5bdea5cfe68e43, 0x4f24bd46705ee98d, 0x1b7d014c7b03a,
+0x8dbab2497de6538d, 0xa30ac6ddcf8d3519, 0xd6c15f7ec8cbf5d5, 0x29771e9f7a848c3b, 0x5a95717416556275, 0xc9ad3a0ca582180d, 0x17a0cbde38b79,
+0x9a808d611d4ea950, 0x2061b7f870915849, 0x27f4d76353a8e4b0, 0x97bbad895b043df0, 0x454ce23eca0f3bdc, 0x68324aecff126b45, 0x67201ff30482,
+0xc8694de100951d27, 0x10e05bf1850ca875, 0xcca0a3d7b4038540, 0x37656ce58c457e1b, 0x771d324cb6ebda74, 0xb86acca9068a7d73, 0x2025fe8146a12,
+0x5874d7625784575e, 0xf136e740727bb2a1, 0xee961013ede96ff5, 0x4b0e91ae395103b8, 0xd9792ebf1b60da44, 0x4d37836095567d78, 0xe54cf3009491,
+0x3d9092e5bfe39798, 0xb245e833c5bb4105, 0x9fe4f2d6d4ae732d, 0xa3e13382ce251664, 0xdd3902a68bbfcde, 0x3925982f6b228d37, 0x16d0bb3bf1f31,
+0xb8acee97c35316a8, 0xf72b080c76d19b0, 0xae82f2c0608cdd45, 0x99e45327ee8458b9, 0xadcc5545f61c24aa, 0x36d31605f2adcf1a, 0x18048e6c68107,
+0x46d6ad82f483bb18, 0x9389687fe5cdcc22, 0xb39cea78d808825a, 0xd3574003c1a852af, 0x456e3c69a3a19431, 0x11ea7adb222cb2e1, 0x1f2cbf09a2afc,
+0x1e744be93db0f851, 0x58922852c0629e9b, 0xe015af6775dfeb3f, 0x2fd9ba64e5ce16ba, 0xb106d19621821104, 0x7f34e98f73fbcc0f, 0x16192eed40960,
+0x24473a46eb87c92c, 0x74ea9034b589b013, 0x50027c4ecf2bf5b, 0xa073d168927352c, 0x8570e7d47e1b2110, 0x750ec6dac1650a4f, 0x14b3164ca229f,
+0xdab71f406089a6fa, 0x5e783f172b329048, 0x87165eb0e2db796f, 0x33349f13b8f74c15, 0x1dc79f0d73b93de6, 0x7572be8e369a0267, 0x130ea18bf312b,
+0x2da787b3aacf1d43, 0x421b54e9f98a0e79, 0x9b995107910dcf50, 0xd25ce5a83dfd10cf, 0xaaaa7626776f78d5, 0xe2612c3cdb64c93f, 0x13f5da5706d3f,
+0x3e005af3282cb94a, 0x8204e40b5eecafe3, 0xaf9234575a7adec4, 0x2929e79a6f7bcca1, 0xbce3886d4d9e2a9, 0x2604f1b46ec46ec6, 0x19edae5fba2d8,
+0x60988fed145fb41d, 0x71daaa5f51aa9af7, 0x212636a0dd44067c, 0xcc84d2b8e38f7a96, 0x6d0bea2c9e602dda, 0x1af657a629b0b73c, 0xd93c88d771d,
+0x66b29af6bccbb045, 0xdc21bae0fb9228c2, 0x1a9513dd64ba0af2, 0xad9cb0bfc6c0a23d, 0x1bdf2c003553b631, 0x341dd68553c03abe, 0x903c2629cd31,
+0x5432f6b5b9017b68, 0xfe263a87ea71bba7, 0x8265e8c44e9344ef, 0x955fc44fbc60d987, 0xcf8502a00c212c87, 0x2913fd432337cba3, 0xdd2ec440643f,
+0x5f807a28a02a7c72, 0x2b69048d9f974a5, 0xcd0106f5eec6dff9, 0xb6c8536c90a6e84b, 0xd952119b61311f6e, 0xea30131f0c862468, 0x12073cd93d118,
+0x711c6cc7bda64dfc, 0xfc2c9a0edbd4955b, 0xb7bfa47bb925ef46, 0xce1708e5ce83ef96, 0x412fcbd052606077, 0xbeccee819fcf7d8d, 0x188306e46e38a,
+0xc0e62756e0d3698d, 0xaeab0d4d2045f157, 0xac05b30c7f4f9cc1, 0xb31ef8b18061d7a2, 0x5c16d656773ca0b6, 0x7314ad184fa0d6e0, 0x24cdeaa0138a,
+0x39effcd0ae093487, 0xd144bcd2646c0a30, 0x644311d545098eaa, 0xff4828875a476781, 0x5894b858a45f48b8, 0xfa78cba9ea2e832b, 0x3af1a3a8744e,
+0x9447922e5dbb6616, 0x9266584496d9076e, 0x4b132eeec68a1ef5, 0x2ddb4c141c07eb2c, 0x7bf149569e3b63a3, 0x46d4910f9d8888ad, 0x1e83ddbf92796,
+0x82ccc951c14f4834, 0xc39d86706cd43527, 0x10dbec29ca9d9f0b, 0x1d859f08e1a35576, 0xfbd3764ebe3c31dc, 0x486f411a9b1a71f2, 0xe3fae96c8d9,
+0xdf4eb47e0d9d8ead, 0x82f68d6286ff9223, 0x9c52db74b5d6d28a, 0xc1358af22694300a, 0x9c48b5fb4f9dddc4, 0xa05b6ddbbea5c0fb, 0xfddd0b99441c,
+0x75340372513f335b, 0xc23a17c12bb136e7, 0x75798b9f82b5d37d, 0xe80cd889c4260e36, 0xdd152deb37fd8b57, 0xe6e575e56b8df007, 0x6b9821a7232f,
+0x712c27504e6b7d7e, 0x388390e60e5216e2, 0xee24efef5a714baa, 0x256dd6c3f87bbcdc, 0x28709a6211ceeb5d, 0x932368e528c3005, 0x4b77ac9f4dac,
+0x2e19ecb98f74a1b8, 0x4e30df3e9c80727a, 0x4b0ef53f15ed86c3, 0x3806b4e3e6f45597, 0x712297955ba09e02, 0x235d33ed876e0e8b, 0x1c225f4db1764,
+0xcc996477ad11550a, 0xddb0dbeff9ff2eb0, 0x2cb5f8c0ae5a8546, 0x8d4578231a11ae90, 0xf5efcf7dbf89c4b4, 0x82c4b104dda846aa, 0x14859b52d8bc,
+0x4edba1a0eeb680a6, 0x6fb4a57ea965cac9, 0x2f5cf431fa04dd38, 0x11b06c1afbea0cc, 0x81014d31d1067f53, 0xe46870337de392ef, 0x219de1c732fe7,
+0x6f82d82b05f0bb75, 0xa18089a1358206c3, 0x57a076df3aecce62, 0x6a8764e7bc2ebce5, 0x78b1e16e6761b1b6, 0x81fad592de4adeb5, 0xeffa342906cd,
+0x3b3c95e16367e52c, 0xf489688939e1abd3, 0xb02d59aab6ff9c08, 0xca2d51c56d005678, 0xcf4d13f9e61cd78f, 0x297053dc69c7efa3, 0xd72b049c86b8,
+0x53d8554e64eb007a, 0x8e59871ea140063c, 0x34be31602cbddaf0, 0xf2e0901e347873c, 0xb6f5d30ad1a8f84b, 0x37412005d46e75db, 0x1b979edc14206,
+0xafeffc0e767be47d, 0xc2d4c3b0fcfe18e0, 0xd075b12558fb663a, 0xbcff19c2f9816b41, 0x1930cc589b2e96f1, 0x64612ccf37ebc165, 0xb665d740b69,
+0x483d228d2690d136, 0xeea1c47352c2a1cc, 0x138df6af5f1b17c1, 0xb0cf4a039a97b461, 0x8f12cf6779f6a757, 0xc0d4d767dbd4dee4, 0x13f3f00a72eb1,
+0x761809213e56b498, 0x52d257c9beb544a0, 0xf0451b37434e3e99, 0x39e9b119c4005471, 0xf152897112faa34e, 0xe3d17bb5f34a07c9, 0x205c34bc894f6,
+0x2a170c1c619931fb, 0x7cf3eed616b2c900, 0xa2f759aa6c7a3957, 0x84b9c5aac0599656, 0xe1570c9aae02af1d, 0xd88e59f528cf84b7, 0x501ba3ab239b,
+0x807e55698c903c8e, 0x6f4f7cbaf0183f15, 0x4b42adf85e330785, 0x9b5dec566155ff40, 0x3d232eeace169d91, 0xb7c7e56d43fb2dbb, 0xbf6c4b6f401e,
+0xb2c9f364b38dab96, 0xc41339c004ff3038, 0x49de3d55eb385428, 0x18418eafc7485165, 0xd4560a9246c2edba, 0xd254f931e6af5a0a, 0x1a01e45f39dc0,
+0x88245eec552430c, 0xe47483a4ac27da60, 0x33eac5aa442a726a, 0x4db92da4ddddd0fb, 0xe3ac168d240c66d2, 0x38865601a5231b39, 0x40939d5e2713,
+0x9489f974e9e9012, 0x20370c1a96bd06ec, 0x2a7a96d967e10a6a, 0x544ed4da1483a180, 0x5ab046be04d2a458, 0x526eab765bc6170c, 0xb9b3360051df,
+0xf2c083e94b3b39c9, 0xd07bfded92272c8c, 0x978aa90f8c9621e8, 0xc045dbe7e16baa66, 0x44ebe825aee85a69, 0xdb8b1323bce7aefe, 0x5524bf0ea8d,
+0x2d33a9a0f19dead2, 0xe00e424654acb4b6, 0xa25f95b0f0028b78, 0x3df31f8c39f33c72, 0x99fb63c79c4b5296, 0xa2e12ce91c8d042c, 0x577e202325ba,
+0xd879aa5ed1fcb719, 0x65c6b8581e9ceaa3, 0x887f0f0196ad600c, 0x89af64888f65a176, 0xae14d274e2f22b87, 0x8ec2e2ebd08b9aae, 0x1aa3a216c6ef6,
+0x1f67f13390fb4ac0, 0xfc8a2c7e8cac00a2, 0x612be7b033b4028e, 0xc8fded2a5015e200, 0x976bf5a8010c2a95, 0xb1bac1480df35f81, 0x157a1a87371a7,
+0x301c905e3a32d694, 0xa897e85ae8e64378, 0x1c6b5aae32e964bd, 0x59183d6006bfd273, 0xd4f24069940f86b9, 0x5ab7b323a0c541a3, 0x1cac87c74c02c,
+0x3568e55a7fd9b399, 0x4ff84c119192a4e4, 0xf4be58f737e6b295, 0x92de01c5240224c1, 0x59346b1a35cef604, 0xde37ccaec1526e9c, 0xa0c45ffb939e,
+0x1bce224e87826f97, 0xd91d06f55210408f, 0xfa949dd9ef61f586, 0xb6e8477fa8dfb3af, 0x221b4df832640912, 0x57118904f42fe0c6, 0x1a59ba728da54,
+0xf226e56d42f82d5, 0x8edc5ca0a921ccfd, 0x48f5e9d8e3cf0c25, 0xeff38e21f7789744, 0xa42302b4841f538c, 0x35998d05d7ffa006, 0x38c6f7d4eacd,
+0x2d38e68738874429, 0x265a1b8ed190cc68, 0x9b90842c2656bb24, 0xd21c4d9ca4d1b382, 0x7819407106d0f277, 0xbc39730a31254bd0, 0x1e455bf02baff,
+0xcccf139eb0429247, 0x507cd522b05d58d8, 0x10159cdb9a6abe20, 0x36ca81e9c92769cd, 0xd50683299439b319, 0x9b841182560bbb9f, 0x118318687f94b,
+0x30adc78208145b34, 0x3020c4d30ff7ae70, 0xf48e594e00b3679c, 0x5ce8f3a25ae19dcb, 0x14aca99d907e1c28, 0xd398b29ac4857b3d, 0xc2c302182129,
+0x4b49dafdc7bfddf0, 0x7199911f9127165a, 0x35982d74b9828801, 0x2f9915096c91a19, 0x6fded98a1e8a21f3, 0x59089ee92f0ebc26, 0xc6adbe68fe51,
+0x703bfd87a71158cf, 0xf92b30a3c169b204, 0x4e2fe6dbed93c21f, 0x1a0f40308a088b77, 0xea8169b68da069de, 0x28c2b21b8c4b13d, 0x120099d2cabb8,
+0xc4f13fad8ebfd543, 0x38c1e7d7b4b3f31e, 0xd071c056ac16ad18, 0x9c36ac48a1017a3a, 0x85cfc1f2de35025f, 0xcec8846dca96e33f, 0xa3d8fb71dd03,
+0x481724e6da35f60b, 0x91df05bb15a95e7b, 0x194a34f6319d29ab, 0xb001785058ec74b7, 0xb520e30c356ec9f9, 0x26ef6c824edadcd5, 0x1ab220ea66165,
+0x47467fff7522a4da, 0xc1fea82150fd8740, 0x1f0df1ff14b57bfb, 0x9f358f0224f34e9c, 0x3e03404afe4330c8, 0x794677ef6df0ec0f, 0x149255f457855,
+0x4406a19f7eedd074, 0x38ba3b3e64a5eb2b, 0x86afe67ddfe2ed24, 0x60185ad73474a032, 0x2c85e30d016d2870, 0xe8b7b5026fb61b46, 0x1abda93970eba,
+0x8a56eef0c471621b, 0x7b503769f662ffaa, 0x30aea8296a5f3e7, 0x881330f4dba67438, 0x32c452cb7a45c9e3, 0xd214d7139c229149, 0xf4c287d42b2c,
+0xa22e77fa0231ccb5, 0x3c4986b6e379293e, 0xd21aac39b7ccde52, 0x9da4d5350ccd7cd9, 0xa2fd9d86ad87b303, 0xf65ce5cc1221f02e, 0x4b0df8a2ccc8,
+0xe8a6f8d0732aab77, 0xafe37a572084e636, 0x44a3d49f2eb3aec0, 0x70b8987aeee91607, 0x3cd57d85f23a75b1, 0xca1f2872fcc56275, 0x106a65939da20,
+0xe7224a6452129e90, 0x9f539e67eac93103, 0x70d95b59767716fd, 0x166e549077c6ce04, 0xfa72672d19400f65, 0xe0d737164135dd54, 0x61cbda520370,
+0x338094c04c7d49a, 0x600ebd66c1505331, 0xdea7581a40ff9ede, 0xce2ad3c6a65f936b, 0xc6ac8bd830c8d5f0, 0x4b4453769a024243, 0x97d655d13653,
+0xe26f5a6e25ff97a1, 0x481cdc15b220f8ca, 0x2e1b2f52db278fec, 0x908efb6d90f552a4, 0xca9651cb2207bbca, 0xf0c3654f3e30637e, 0x8460f6d70cdf,
+0x49160a6d1596fe93, 0x6289d4cd4bf754cb, 0x47c043d45dd1488b, 0x2a4f82b73da01e66, 0x3ea83544ac019c6d, 0x52e58bdbd17edfcf, 0xf3e33f778dbf,
+0x57c1c51acc09f0d7, 0x6c3cacda61c502df, 0xf92ba36991f93bec, 0xd520ec58168653a4, 0xaf229f46917f059a, 0x7f4a8fbd2cfde056, 0x611ec992bb05,
+0x93f372fb799cbc16, 0xd60362188ce8e44d, 0xba23cc5bd94e6a35, 0x98dd6d8480d90462, 0x8ae5d7585928e10b, 0xefd287bbbd8c3465, 0xc514e1e4bd5,
+0xe70bbcfb3cbc4291, 0xe6036ea6f5bc1a8d, 0x994e9fbdf4871d08, 0xe4a36d8c66f4cab0, 0x1008482a6cda67d0, 0x7bdd8b2362d00d01, 0x2015894740cc1,
+0xe928142fe486666a, 0xaea883af5e0816be, 0x440ebae3dda0a3c6, 0xd4172afba345b469, 0x121724289e603f92, 0x74a098ff00a38e1e, 0x32114e0e300c,
+0xb426151c02bad612, 0x74ca3af4b122d7f8, 0xcb59fc6bb6589ffe, 0x6f1e5ca344b4d37a, 0x877a8672825f8dc4, 0xcb653b91f392762b, 0xd2d4cfbb7ce8,
+0xdb3d34d5b1fc2be, 0x4bf3d4735562b53b, 0x1d39f6219f551093, 0xf7e78d24df4312fb, 0x75d30ec348bbbfcb, 0x59170e5b08611ee, 0x1ccc6631cd6bb,
+0x6facf8b25f063201, 0x143e3fb04259a708, 0xe3bb47e7bba589ef, 0xd49087e5a30bff45, 0xf0ee8431a843a083, 0x995941b261882fb5, 0x14b4012d37975,
+0x810bf72e582da81c, 0x95c83c9b9164ef7b, 0xec531a40b999a6a5, 0x182b900f29d0af59, 0x9c1f64376b6eaf33, 0x6e5bced6223a2172, 0x1e17b9f078c6d,
+0x7260be20d91f6db8, 0x3fc458f7fcdbf334, 0x495f87192d7ceb3, 0x44ddf3b7c4eba099, 0x64b5029b1f630719, 0x832437860cbc1fd5, 0x1bf1f9daf7add,
+0xaabdb17b26836594, 0x2aee646bed7d6fd1, 0xe52666d22203e2b2, 0xc4c5e35eacf07c64, 0x78dbaa3f24e93ada, 0xb747980301f45222, 0x1f8f5a73f9d76,
+0x64d6ad47fce2b977, 0x22950e9c3b99d191, 0x37fa3c275a30c080, 0x79208f323bdee8b1, 0xa50a82c04b9fec8a, 0xb9589905959e2b31, 0x8046c658cc0f,
+0xd929d0297262d59a, 0x4d3c836e79a68b1c, 0x9dffa8f855dd81bd, 0x4681847a12f6672e, 0xba083984dfc4f1c1, 0xd041b3fb5572a1c6, 0x45ea065077ee,
+0x33c760f14d8ddc9, 0xe9d7c14ab52e5d26, 0x30bf2789b5285644, 0x640275d3f8c553d9, 0x3002ca37a0600ebf, 0xcd797421083870f0, 0x1fe77000438dc,
+0xdba3f6c78bbeeb72, 0xb5b9201aba85065d, 0x6be5cada18ef889a, 0x48bda52ffdcdd6a9, 0x83b7233f12659806, 0x7d382128d87f39b2, 0xe48ae71a9121,
+0xbc4fdbe455e4ac88, 0xc34ee16cbe4da388, 0x7fb8327b7ba42437, 0x688705887cd369e5, 0x3285c3a6f843c7de, 0xca152fae5055f704, 0x16829e65a18fb,
+0x6bc21cbcf2fa71f8, 0x570c960085763678, 0x3233ccba3b6dda66, 0x3e5cdf9345d0563a, 0x772ec08fb7d71579, 0x90b6a3a0ecf07a57, 0x52c546c684eb,
+0xf519f52404110b43, 0xb1377a1402867146, 0xba29711a653402a2, 0x57fe448f348a6d5b, 0xcf4fb80f3c9edbca, 0xc8068daefae0eea8, 0x129153fad6343,
+0x2c11ca025917eb6d, 0x9d59950e262b157, 0x4769a32a1d1a36bc, 0x981319e476e73e31, 0x252ac4cce14658be, 0x6a342093a3d389f6, 0x315230451c01,
+0x5029310eab2f656f, 0x81ceeb8f3cb0ca67, 0x6de6babd6927cc20, 0x17ccf2abb1510542, 0x680d75c8cee89f64, 0x76def38cdc98444, 0x1fd59aa5337f5,
+0xbe292d3069aec943, 0x2a564bb2c003bae4, 0x1df403e17f78d47b, 0x9921d50613ac601c, 0x829ceb4ecadcd932, 0x554b0807b96be760, 0x16fb1d4c172a5,
+0x7213a0a1e91b4ad, 0x8776d9fe5f70c2d7, 0x51a804ebe71fd034, 0x369d4083a0aa579e, 0xb7d2c4070ca39da6, 0x316c6e327c0c0834, 0x1ebc9b6f284bf,
+0xe1dfaaffd9653183, 0x84c6ae18e70c39ac, 0x82fc652124bd727, 0xd5eed5f32b529528, 0x422f575b2c8dbc1f, 0x5e10a004df14a08b, 0xe4c6ee890c33,
+0x78161dbc5ef9cef7, 0x22d345061ff830a8, 0x35efd4464396e886, 0xaf110ed976f785db, 0xd8975f505afc7eed, 0xd2cb55387b912f90, 0x817b3641e29e,
+0xecb9354338428f4d, 0x833facf77e8e55ff, 0xf592d202cdcc7269, 0xf216626397681900, 0x8e4de85da11b47fc, 0x68ba26b5f88ce7fe, 0x5ba33bd11949,
+0xd0c7b1b6567f0798, 0xda40de52b8be778b, 0xcc2be5302ee0dd09, 0x682cbebdc48fa89a, 0x3a76d283cbcd84b2, 0xbb71ca9902df6b09, 0x21db4e2e6dfcc,
+0xed63f37d402331be, 0x81fe998aca12f6a2, 0x288f1711de0365d2, 0xce036694cb063eaa, 0x97ee4b0e91f7e8a3, 0x4ccffc8c4a9cd58f, 0x14d4649ef8674,
+0x3a213f353ce006cc, 0xf2affcd1292e34d9, 0x57cda82c0fba5506, 0x23647c6075128f28, 0x379ff9c0bc8042b4, 0x5f9ee5cde44fb343, 0x822b3aed0244,
+0x4ca5fd55b3694168, 0xc3a973e190d2fbbd, 0x8b3d86a87176a3b9, 0x42ce6d32dbc78158, 0x2b7b4a18b4b64edb, 0xe9d11de8cbab0bb7, 0x141726cc3dc6f,
+0x4a7970132dbecb50, 0xae89f92c1a1d54b6, 0xe24194690535cf70, 0xcfcc08654df6fa70, 0xf4ff5eb4dc745928, 0xe55bdfb8c9def9ea, 0xd0fe4618d616,
+0xb8aea5b024296e4d, 0x6348f5d52dc6e2f6, 0x3d7d29a4f1264928, 0xd11618296618f04e, 0xbd3ced8bea2b30cb, 0x791f96ae0cdeda5d, 0x202da6fc77b76,
+0xf343f582e8c2d63e, 0x3785fe1e09cd9f7d, 0x84d9696af5100515, 0xedbe6ceeef9372db, 0x9ffb6222081874d7, 0x89fa7b6919610a2b, 0x1419d5680e5a9,
+0xd188583507fcfbfd, 0xfe130117c5f3104d, 0x1ef0f043af3e5e0d, 0x312fd2f5d9a58535, 0x2d0cd8c5f8101a95, 0xba3224ee46dd2f2a, 0x5bd127419e41,
+0xe62244dba90747f6, 0x5eb945514f3e747c, 0x6c4465a96ff5ed28, 0x211a2a191f7dea7f, 0x89790d2ce19fd656, 0x7244842f1ea13de5, 0x23075a7ef8de4,
+0x92098908de80928d, 0xb8f3ad486ff53954, 0xa0e4051751e6233c, 0x15fd9427738fb7af, 0x9b6b5d1980311d7d, 0xa4cfadd8a697f015, 0x558a0954ba2c,
+0x1f8bd1674721b47a, 0x19af0ca51774c228, 0x3245f4a3fd159d97, 0xe6b17b0fcb3e9eb7, 0xa0d36820b706e01c, 0x828e6666a7bd87c3, 0x47f0d3ca9f75,
+0xd161b710d7b52e97, 0x622bac75adbf5f63, 0x9a709b2d97ecfc38, 0x8e7ee581373b117a, 0xf15a153ae5cd77d5, 0x88db04775c7e9ab8, 0x9bca7c44601c,
+0x31c2b58a0ddaea95, 0xcd1d557039cee270, 0xa06090386282db2e, 0x86467a80af741f75, 0xc210a448dbeb4621, 0xc81aa553c0e4c872, 0x11c18766a9129,
+0x1ddfecec3c92b4b9, 0xde7f559a86d12db0, 0xb9a5b26acf9d3836, 0x5d8d595375e83e14, 0x9935deed51a55b03, 0xfc45b2e31ece2984, 0x1189fcba7064,
+0xb6383bb6953b2419, 0x764d1a2cebe0e247, 0x1b7dd5db64854b1a, 0xfb7e365695c1e19c, 0xdb7310f1cee6575, 0x4588692b1e5ccd0e, 0x220add407d00b,
+0x986e3b9eb365eda6, 0xdbcc42729bd5c3fb, 0xbf9c8b88b3aea909, 0xf666b38ad0159e9, 0x7a9507e5128e099b, 0xb51c475b346cf4d1, 0xccf6508e94cc,
+0x918be52aa88716b7, 0x1a8e722117699199, 0x66a84c94701c7ef7, 0x90667d908fd37679, 0x74934fef1689ff13, 0x180c8e6a8f0cc826, 0x9cf0d3220c7c,
+0x7d72a8d6c21183d8, 0x227b522694b6cac5, 0xa1c681e542a00c38, 0x46fe58285d2d7dfb, 0x88a3d3ad8eb8e2d9, 0x78f1a82c31bfe9e9, 0xde5413c39262,
+0x1623b2367318c77f, 0x777c996778e0d444, 0x2a375f68d8a671a9, 0x70780620109dc0d5, 0xb65ebcbae9f5dc82, 0xf9c7aed0bd229ea1, 0x1a874c2f0b7ce,
+0xea2ca7219ea6db25, 0xe1e35295f0974cb8, 0x78897554c5ed63aa, 0x93afa7f2f9b48203, 0xad350ee20f716d75, 0x31782882dc505814, 0x1b939f5460fe4,
+0xacc7e6276ed8a763, 0xf87e1d7700246868, 0x7e92fabba80f4ad1, 0xd2955095858ba508, 0x59702c27f96fd303, 0xffc100627a5bc112, 0x206101090d9e8,
+0x97a854a64c210f6b, 0xe33b3f0a42632ef7, 0xfeb991e94b43f5d4, 0xca670be98b124359, 0x6a1ed0fd07693da5, 0xa8bcd80854e2a413, 0x1efebda78a238,
+0x672385daf22ca4f9, 0x18684eac02c7c8ea, 0xa47b8e7f7b2dc8e4, 0xea3e1e26736bc607, 0x2531933876de6e0b, 0x14929e4325afe98d, 0xe8a98411329,
+0xeb96dec6c08cdef4, 0x49d26f0b9b58cd37, 0x12a135d65610428b, 0xe6e4084da578141a, 0x7a8c3e814c031c35, 0xecac58edde7fb260, 0x19bd16335197d,
+0xecd216226d6ba5fc, 0xd934959a4d7f4e5b, 0x3d5d29d2ef63bc6, 0x10de59e64abb0211, 0x72bfbe19e7929426, 0x792f2d5ef3abf803, 0x18d4d1bdafec5,
+0xba5e462c0b9cee24, 0x43124e920625678, 0xf883dd7775abbe8, 0x7870230c675374a1, 0x47a876e0f9fc2ebb, 0xd3bb57239d301aa4, 0x2192c98c5cb61,
+0xa21a09d8a2e7f4c5, 0xdabddaf12cf23c9a, 0x7a12034766bad6a5, 0xb2c57b5c88eb0c83, 0xae175be5fd690185, 0xdc19438be004ab7c, 0x13456fecb160f,
+0x7bf470172d16f41, 0x21a0ca8a23510b48, 0x3b1014a7b0d9703e, 0xdc0daca54ce159ae, 0x6c7008baf411c62e, 0xf7cc0654442aa13f, 0x1829b117a00d0,
+0x4e051c6f57ab634c, 0xc6eeffec2c5c6219, 0x809e79a39b957305, 0x1ceba0da60a0815d, 0xc82c3aaaa74da406, 0xa745f227e012a740, 0x18db0858b4d51,
+0x34e318751ea7d311, 0x8ddcd943ddcba095, 0x12c05fdb3675726d, 0x1cfa0fa1bdba7a89, 0x6c7673a492eaa3e5, 0x1aefa11a3077e7a6, 0x163aa019871f6,
+0xc2bd5e2b2aec3def, 0xf074d9e269224f7c, 0xd7b01c348a10fc90, 0xdefbe1d02ed8bf63, 0x9a85f5e874785d16, 0x189ca3ccf36ff535, 0x102a68fb50cb0,
+0xe044c6aabb81d6bc, 0xa1678730cd5d85c3, 0xb6f8ce0df211a40c, 0x167d947e206272df, 0xd088e46a44bcb214, 0x5b1aae28a5b0eb8c, 0x1dc4e8508ed6e,
+0xcce0042b279ef44c, 0xb90b635363d64fa8, 0xd37329e92e8ef0ad, 0xaa18aeb250d47224, 0x4edaa0c5b067adc6, 0x6a416bb9451a1f2c, 0x616e76a10e02,
+0xd3d1c8efd1d9b825, 0xac76e5b1f4b57d8f, 0xfd00c097b1d9375b, 0xe69d0ae1bd3e51d7, 0x6a0d1fa2c689c3b4, 0x5f1bdfc53e7e318c, 0x22e3635b3ea59,
+0xa8c17a1c8d88de6a, 0x5d81d3d0c56249ce, 0x20ea0dace1150559, 0x1ef7178427cd453f, 0xf223f9134c05d411, 0xe2a804e6bc8b7147, 0x20f0d21d491a0,
+0xa020b8b2d33c9883, 0x6ad1fa66baeece92, 0xfdc310fc949bf216, 0x81ce6522ea29e87, 0x958b590778cc5211, 0xd43728dda67531e2, 0x1084863b0f8d3,
+0xcd2c0657aa828e1b, 0xdeb810cfd8700f7c, 0x45d464ba6603a5e0, 0xee396594432022ca, 0x903e0ce5357aa064, 0x5b26a6233d720280, 0xe51bfde115c6,
+0xda064a136fa5bef2, 0x566e5ad769f36b69, 0xea2654be5623a69e, 0x548b37a6953b449d, 0xd06a30f9e7e8b37a, 0x4333914cf42a367a, 0x1f3863a9c27f6,
+0xe39abf1bba9b2079, 0x8ab49ca2ec6b82a, 0xb9412a29ca9eae62, 0x9b6fa13bed19d254, 0x90503adc1968d980, 0x7f93c6991bcfe48, 0x563350a3ae9e,
+0x415b4949efcbdb04, 0x612590cb6db367ff, 0xcae57e25ce1ee6cf, 0x1c3509bc90d7acc9, 0xc8ccc82fb72ebf63, 0xb4426ae234fe9bff, 0x21688eba8c688,
+0x3092a6da2ce8f46f, 0xa00e56d1b9fd3210, 0x7ad0bd58b1d493eb, 0xdd9d4a8a0e98b1d4, 0xecbc61ff3add4fb3, 0x858de730daec7b90, 0x16eed08105f45,
+0xffaab901a6fdf8ed, 0xfa2bc8aed9516aa7, 0xb9370204db03d13a, 0x99121eb8b9190747, 0xd309dcc7d889ec3, 0xe93951b63c05388e, 0x103fb48fb9abd,
+0xc1165803591d68e8, 0xe3bda0e43a163c8e, 0x561e1f9ce237e0cd, 0xb219bc0133280c35, 0xe8b55ca661287695, 0x51cf8601bcb89d4b, 0xdba0c99e9572,
+0x9de19d41b2859d3f, 0xc3198730b14a42b5, 0x2043ad2216301395, 0x93c3cdda774c0124, 0x4676a512a362aa2, 0xa003a8673d84a31f, 0x8bfbfc3b4928,
+0x281f42afa95c459, 0x9e8d052997558b80, 0x2899e5317f0d0219, 0x58154171a70e9b4e, 0xd8c3e9a27015c4f2, 0xe8cf63bc2acfd166, 0x5606a2f89a21,
+0xc3b7eaa756484778, 0x79c85e4fac250daa, 0x4dbc8554395bf3b2, 0x33f7886f393eec03, 0xc8c85bf56daf2b65, 0x89dc3eb8f02a8b89, 0x12097a33b51b2,
+0x7b3a1138e57811f7, 0xf94d3af6bf2bfa17, 0x1f22eb3be772945a, 0xe01292736efa6e60, 0x852ea6bf9fe532c6, 0xefd56fc33e7e8dcf, 0x1e2ef64b6edc5,
+0xf1ed23761cf4069c, 0x36bb5d84e28c852c, 0xb1e193e921934b7b, 0x9b163e973ae5c024, 0x72c03276b05ca012, 0x357b76b9ce788166, 0x18200dfc562bc,
+0x5975f200b251b590, 0x5c1104aac4dfdeb8, 0xb01def20140351bd, 0x14a66e6b7d8da397, 0xb83d692130535a7f, 0x7bce02298daca540, 0x5ebaf0218fb7,
+0xb6c9e86c8c481c8c, 0x9132b386dfe02773, 0xc6ccfaa5466d6c00, 0x39c4d11c793f171f, 0x784b32b10e221ac2, 0x60358fb3aaaf3fd, 0x178e17fe38cb8,
+0xd468e2924ab36396, 0xd17584eb89b36ae0, 0x9b602a834eec1216, 0xaa4c58553607a6f6, 0x5defb550fafce896, 0x921fb5369a53313e, 0x15ad068fd3f21,
+0x5ed39abd7925b44, 0xebbec3ab86cfc635, 0x329720a3a042d6a0, 0x2e93580c02e22680, 0xfe2332d1bb222a88, 0x8954731d2cc4541d, 0x187b24424aa0c,
+0x545e82c7af2c0bf6, 0x343bb76373a283d4, 0xd15d6656ff2ce65e, 0xc388d68c29388462, 0x4f568225074e35d1, 0x7c3db4c454f689fb, 0x8090c94cabf4,
+0x9b34dc793695ad59, 0x82fb9aa9a2fb9419, 0x22952e9d5da94d71, 0xe1e6ca892f37e610, 0xc88f8bd63b8d426b, 0x4e62348afe0a4275, 0xb94fe5aad7a5,
+0xf112735ee17e20c5, 0xf69920ac9933fd31, 0xa4c08093744a8663, 0xf327e7167cb6e5d9, 0x92205b23fa6b45a2, 0x12e04d37e5d862a8, 0x1d3d5de84c6b6,
+0xf70655f0e3a0e363, 0xe614135a3fee294e, 0x43c0f0d74a84fb88, 0x8839404badcc4701, 0x7e0c2defb2b175ba, 0xa21ba66e3d2cc7d7, 0x15893450255dd,
+0x2608d1820510afd, 0x49473d13c9544c5a, 0x4918bf0ba4ddf5e8, 0xf231570cda63b893, 0x48d2d395bd4f1846, 0x6cd124fdc90f0c73, 0x5b4c55112b56,
+0x361e98cba42142c5, 0xf66ed2564dc8d86d, 0xeb9f281244e9bc2e, 0x666673c1edea0c32, 0x71e74117903c0b1b, 0x7655be34c2f4f9fb, 0xc5647fe9403b,
+0xbf29e39e8074adb2, 0x9f5386cbf422906d, 0x9119b3cf41404c4b, 0xd80b0de690a91cab, 0xf00e68373e7ebfd7, 0x7b0bc4c0dffb6080, 0x179708661f1b8,
+0xefbf0677e3784e96, 0xc4ad7434f995a1c, 0x5b340156adc20154, 0x8ac2f2edfb8b9536, 0x1dbc439fb10d26fc, 0x5f0d840761b061ac, 0xf478f1f9a896,
+0xd3a278fa5ca85c42, 0xde87b0c5d0d445a1, 0x35b339a96610c96d, 0xf1579e5c6d6bcc83, 0xaa09186d9adb1ea0, 0x7624abf07f5e23cb, 0x1b57f869d3b97,
+0x710f70125f8a4bed, 0xe2152f9f21e7b1b8, 0xe0d58df3fec05c67, 0xb8b04150f61691b1, 0x290f85a5da04319a, 0x1c8e598f3fd7cbdd, 0x173fa174e0b87,
+0x8c118cde015b693b, 0xaed823a93cdcd746, 0x28d668a2dc7de144, 0x6189a840bdf16806, 0xd310bd2e8045b0d5, 0x5cf5066552d295ef, 0x1443545d752b8,
+0x46e3ce59bd0fcc91, 0x797bcee3eac01d91, 0x84be318cd5b73d90, 0xfd5b0ccf0bfbcc09, 0x59c2a46348d4f465, 0xc281ac21d73c4122, 0x217a9806cb883,
+0x70b59d4b3d61f8f2, 0x90a1ed4c1cd6e18b, 0x25277f5b77816bb6, 0x8414171f3084dc1b, 0x87b9dce551ce0157, 0x2d214777077480bc, 0x18a7079360e3e,
+0xaadcee9b382b39cb, 0x87e8cf58ec79af1c, 0x47d7d97b51bad63b, 0xe17faaee357ec44e, 0x11c52e07cbebd0af, 0xb17eaf83122da6ec, 0x1b8a872098b98,
+0xbed525c88ac39a8e, 0xec23a3f9dd9ff29c, 0xecf7c050993feeb, 0x41fce2dd029e50c6, 0xbe9f821c4a785ddb, 0x3548fc9aed7b7963, 0x11a5dba113b2c,
+0x7207090a727e123c, 0xb6129892c7532316, 0xc39b6e4172079154, 0x6b33eca1c160ae02, 0x622abdedb402ed54, 0x5dba1ab985b0897, 0x203e1773b061f,
+0x9100dd933bd36754, 0x245ab0c2db0dfa4b, 0xf79f51e698204c99, 0x1724966711a646a7, 0x6fe619f8de3fa043, 0xde908085f534f3eb, 0x1820e50fc82e9,
+0x145e467be757151d, 0x121464e5f4f79698, 0x12faa4a5ba816e9a, 0xe7f670b6464724f6, 0x280763b60ebec48d, 0xbb630c21af3b4b72, 0x1fcc436e5fc11,
+0xf8afd562fd97e0c8, 0x2389347b48446517, 0xe9f8c5c6819d1293, 0x63e46474908b94ed, 0xce07f95b973d6877, 0x340ff7ca0018a5d1, 0xf9400ff5b03,
+0x7225fe4950cacf33, 0xc49bb0a08c467a00, 0x6c6f99e1b96c12b9, 0x87f419e5bdf50020, 0x48b832d2f12634de, 0x58a117807f25995f, 0x9af1b2f3e92b,
+0xc7a7e1c63297f88b, 0xd841d75d9d3731da, 0xb42ed60fabad7fc7, 0xdd13b36422f00202, 0x4a1f4831e193fed3, 0x9fc7005a0b1743f1, 0x1dddbbf8454bd,
+0x140556f46efba7bb, 0x938477ac559fb57a, 0xd69292c6393af3bb, 0x1d1c943f63c64169, 0xf8794d06efac1d2f, 0xe8b8d281656b1f6d, 0x11d423d304dfc,
+0x16b0e7ad62d3c823, 0xcdbc72facea8e0ee, 0x65bb51acd976c2dc, 0xeb9cfb26b2fa1b23, 0x7b7e55e247a2dee2, 0xcecbc386f79b6855, 0x1e3a023e1732,
+0x4f2da1f84c8fa879, 0xbe85c7f00b8adcc3, 0xb57ad12bba281cd2, 0x6d580737e7a306a9, 0x7a1c611250e648d8, 0x9d014550a6749d9c, 0x141eee018a28c,
+0x94cecc5952b55711, 0x5b81ac02de45df7e, 0xb1f99727ec268f61, 0xedf6f99c723a6dd5, 0xb459c87e4abfd810, 0x99db05e90abaf354, 0x1e0779396b896,
+0x8aa892ca93c94c5b, 0x5ef4504ee1ea986f, 0x968741e12da426a3, 0x82422923b06b8a48, 0xb4ace0276d0d0785, 0xdb09d964a8ea67c8, 0x6994cff9f158,
+0x5719a27b9cc5ff93, 0xd423b2c9c76dc373, 0x1b1e10a9b663d1d5, 0x435c0abdf621cc0a, 0x7a079a203dcca2ad, 0xb802ff5e8e86a0fa, 0x12d743042e35d,
+0x206c701a7d67df7e, 0xd5662a62c3e159da, 0x79faab0f4c5fbc24, 0x599ee7bf17aa42c3, 0x12ed808e8f9aeb84, 0x666090591c924ed3, 0x12a57e7858ab9,
+0xe7634b8fca34257b, 0xda45bc31eedb19b3, 0xf53915dc6a3bbb68, 0x7f62b68aa0637ac, 0xf29e6040558828f0, 0x4b74bca7e2d7ab32, 0x11f3a9b191837,
+0x6b5746216f9e44fb, 0xd5d8ab919e895265, 0x10142d5d050dd28a, 0x7a3df03386158b03, 0xcae93879afaa62ad, 0x602e0c20aaca41e5, 0x1aed09fecec80,
+0xa56ce891aca9d7a, 0xf9ef6f8c746da5e7, 0xb2d35af02effa34a, 0x71fb42303397c456, 0x69f11667b316c612, 0x4da79e7841dbc541, 0x1fbe7fa9d58d8,
+0xaa0d00dcec812a18, 0xd084b6d9628ba3a5, 0x259484a9fd8b9e5c, 0xb7843a26d493ef2, 0x7a9f06f4abb8b396, 0x77213f4448f18688, 0x12ce0dfffecc1,
+0x1e8e54c13a948e08, 0x366e1101c0c12e53, 0xdffe8748af192673, 0x7928778478b3465c, 0x9fc19872b3f3d83e, 0x2ae95886ed96719c, 0xe5067c8eaf58,
+0xa7e41639e044ef63, 0x43e33fc6a0a10939, 0xf9f9125838f9374, 0x5ed4049be0fee916, 0xb0d0636b5130c634, 0x928d5b3414ccce6d, 0xebf06b08e428,
+0x73a6f5aac158e006, 0x5d01d6050ef525a3, 0x79381c7f1ed47ada, 0xab9c1d3405843892, 0xe846bf239bbd3d3d, 0x9bdf64f04b80a65, 0x19dbdd8378e4a,
+0x39b851d92acb81f2, 0xfe476c5d44a8a5e2, 0x5a7411b65c3de4a2, 0xcc838711a94dc1ba, 0x11c4fb5e1b7d615, 0xe17953b430b63ee6, 0x2173deb1c9c83,
+0x9f19d9b9974f952b, 0xb754fa65b9aaa880, 0xc13cb955f71ef91a, 0x6c4249a15e540869, 0x250f10a9f15fe4b, 0xec663a4af62b0260, 0x358c1d492268,
+0xf6e449ab8b0a1ec, 0x6906514bad27351f, 0x6705fa26b0aa6391, 0xf1b7814a6bc75f4d, 0x733030bc67a6f0, 0xe2a2dd7f353e6bfe, 0x1512ace963dde,
+0xc923b416fb84900f, 0xecc22e9ae2e83116, 0x5d675087d265b55c, 0x9b5b4f084af19563, 0x8bec0369aabfee7e, 0x196f895871f1e543, 0x6470f8461241,
+0x58edc520b5f15ca2, 0x820a47ef6fada8, 0x76d9e9690f5d1e79, 0x50e7f7b4f0961d14, 0x5aaaef6780a370d9, 0xb5822d77bd6fb7a2, 0x6ba4e2d574f,
+0x3fe561a36f15bf71, 0x49cb13d323695231, 0x9f080fc53187cc5a, 0x45999232b1169951, 0x4cd4ec393094c455, 0xd698a97d5cdc738d, 0x16be14d820f52,
+0x5e6dc62a392d16c, 0x17dca5a91d139c1b, 0xe25b3838a27f1999, 0x4258a4c8aef5707b, 0x4390b42dd7a04d35, 0x1fbe1c3881a47958, 0x1816fa6decee,
+0x4ca2efe67b97d215, 0xc9308da711e18c1d, 0x77f3165362025c2b, 0xaa1daa71ef1ba352, 0xd388790276601477, 0xc168feae99873bdc, 0x55199d2cf17c,
+0x7ea26ba67b02e889, 0xd96632b6cb20ca9c, 0x47d4345337248f18, 0xdec5d4245723aaf9, 0x7d9f042dee6f0f05, 0xf84382e15ee3e5a3, 0x18fdcb9d84e01,
+0xd07d00b4cb54cd44, 0x759db1c9d7a17ec8, 0x4ab5f86c02ed7b6e, 0xe040e4dc4ed4c182, 0x87caf3abf7ad3b76, 0xb393abb813c10d50, 0xfb9efd56d97e,
+0xa9cbf3fc0ac7c8aa, 0x94ee4f2e8fe6aea, 0xdc66e94571582f59, 0x6ac6f5b62a62ca64, 0xf94ff79fa8fa1c8a, 0xda6f4e3bc046a19, 0x1863fbf262ca,
+0xf7810d57aca7733c, 0x1041883c004a470d, 0x2f9b5ece1bfc5be4, 0x1ebb388184bc5812, 0x82160333c565fc96, 0xc443e57d4315febf, 0x8202685f95cd,
+0x616b71cc04d6fb41, 0x13505efb26828499, 0x569bf027400d370c, 0x63a79714c8a3ba47, 0x2fb21aaceeb08d6c, 0x9502dbe4dbf738bc, 0x181d153c7089,
+0xca172d06025251c6, 0x2c6c5ec81a015e43, 0x9555fcf457534e10, 0x40dc87931476d42a, 0xb616b89d710d4a35, 0x7d86168c394c3602, 0x2ed8ae4259f,
+0xd60df7d2df1f94e8, 0x27655cad33440cfa, 0xf31835486d7351f6, 0xadb7b31a0694cd58, 0x84a5e045993cb193, 0x3e88cfa559d0bea0, 0x52786a620e91,
+0x99999db3ad31b53b, 0x98e19f5bf71df03f, 0x3b2ccc0f7c66ef4c, 0xf8c06a343d494cad, 0x9bfcd0f78e8e2cad, 0x500fbf275211527a, 0x18f5412abeb3a,
+0x500504fdd8ed4ae2, 0x6057c45bbe7e9fd5, 0xabb3b99823af91d8, 0x4e32770fc58f677b, 0xd3c3926234770b6a, 0x690a4fa7186d8e4e, 0x712f9288c963,
+0x3b81ab3e8eaf2afb, 0xc7ec527f8f3987d4, 0x9a0761bd869ac65d, 0xc433f6611b298da9, 0x502e60bce864dc08, 0xf6d3ce55ee230a10, 0x29c1769a7c3d,
+0x1aeac92e3a543c51, 0x3bc24a941bff339, 0x1cca47e418af389b, 0x31cf4a443f2749b9, 0x5505df799b6c9f6c, 0x36d6f2f41d85c687, 0x1b1b680727ff1,
+0x130f499fc515d824, 0xb9d5564e3b113341, 0x538f6928efc0d580, 0x1f8a6f6863477cbd, 0xbac6e599923feeb7, 0x2a601ee6b98a529, 0x1e1149a6a26c1,
+0xff86cc95c527d9a0, 0x1ebccb758cc5fcb9, 0xddb165b53cb2b57a, 0x8144a9416adb302e, 0x76b7e361ef129a16, 0xf09475693d695c42, 0x23699d35f9fb,
+0x7328eacfd46a352e, 0xe3bf53ff44485b3f, 0xfce6e0745f3b11bf, 0x52ef79bc96f3d4aa, 0x622c2d015f39d9f3, 0x15a56d9ee7779a44, 0x32244de8ce16,
+0x62337046fdbc9f59, 0xcd3a5573e8c0329b, 0x77e1fd1a4e9c8e29, 0x5c4c5b79e9280c0c, 0x101774568b689a24, 0xddb668881a995868, 0x201c42c11958b,
+0xa5ada158a86fef80, 0xf7b4db502d57b98f, 0x8d01b43a5ee7639a, 0x755d79333ef42423, 0x4877d90dbc0eb4e, 0xbb920f39964461bd, 0x1dde5bbbafe60,
+0x23039fafb7e9eb32, 0x86ea93204b580de7, 0x8f0ba702ac02e718, 0xdf44cc1fe4edbf24, 0x55002e3b9d5ea712, 0x74caff646eb9f708, 0x1db36b91fe3a,
+0xc34994696c42d690, 0x53c68b127e7f9fc9, 0x645bcd09c112448b, 0x59e86045fe85e70a, 0x7d3e75abccce264d, 0x50bbd7170fc2876, 0x1b1b986a3eb38,
+0x3ee608db5303f19c, 0x21ecf8c21c11e420, 0xf4475abf6df3f95c, 0xf3a78b7a8099345e, 0xdfad2976664bde06, 0xa6d8eaa7c12fea4f, 0x2f3750cb7692,
+0xebca41f9c4c0b114, 0xd23b80cb6a45e585, 0xc0d60dde44f1f85b, 0xeba75c15dd82a56c, 0x7e46bcc654232e5d, 0x2a7991bb39b52fbb, 0x13525eea5ffc9,
+0x80fc5e126b0e54ae, 0x4418f04a83396d1f, 0x745994126ce99d51, 0xd59dcf7644b93778, 0x46071a87acb0988, 0xc0ec2170858a8616, 0x1e0ded0fffa03,
+0xc03072b7f1dc9571, 0x4648e2c0628de696, 0x3fe54724742e42d4, 0x773679bde9d4ddc8, 0xcedeedf8f71b7dd2, 0x78c1a61411ddf5b5, 0x155d63cab6094,
+0xa3a4441d144115d2, 0xcba4c841f92790da, 0x1913216ba15ee11, 0xc32a6d81c87085c0, 0x9d700f80468abc45, 0x90d2ba368219cbc3, 0x1cadbcb3bad14,
+0x7f635ff58e9608fa, 0xb27bca8448aec3ae, 0xa58c80e084b0385a, 0xf3f33cbb4ed05018, 0xf83aa44b13490059, 0xa603e860b8b2f0db, 0xd194908fb4e0,
+0x498c986bc3da1a1f, 0xb9855352817ed2ac, 0x1b6538fe457fc1f, 0x1cfcd70da14b3a4d, 0xed69f162c44cd3ef, 0x29f3cd0d8ae5ed, 0x60e479c07e35,
+0x2beceed00aeb1d77, 0x3998e292466e89ce, 0x6078e92f04d65be4, 0x9c500da573a6c660, 0x503347835bf7d500, 0x7d0f59f0ca0f09ca, 0x222161c7002cb,
+0xebac9ff79e4102e8, 0xf095a9c88c37390d, 0xdbc62af9087fe005, 0x8b5d6115b024f4bf, 0xb965fd2badbf275f, 0x307b6e3b32097913, 0x1309f05ff34d1,
+0xd4f43fd184841cab, 0xd11ad33e8838dfcb, 0x37e3d68aca898623, 0xe68ec1954f0eb2d, 0x90ae19a542287f25, 0x715f8a9a72ef2eea, 0x1761e1d46d488,
+0x174a281be1d4052c, 0x60ff55c66576248e, 0x2a33df9c29c58753, 0x4199b20be579884, 0xe85a0bc73916db0d, 0x4750f93ef57347d1, 0x22e5d34b81e79,
+0xa8f98d86c78035c6, 0x74be7b1d42f0c493, 0x4d23d971416fa123, 0x3bc75c3f9ee228fc, 0xecffe986e542fef8, 0xe978f2ef961ee57, 0x1e0c1f37eed87,
+0x62deebcd05b4bee1, 0x146ff9d6d9660950, 0xc2e4f58de15958c6, 0xbbc7e4f7f88149fb, 0xb3fb3b7396850e9d, 0x88ae30ec600e7745, 0x1779d764c882b,
+0x359ad2e94442e3cc, 0x23a6ec5b78b1c023, 0x20e2d1ea815785f3, 0xb7152a9c55a8c62e, 0xde1dbb3a5c018dab, 0x6144babd82120c89, 0x1e5f11b9f2044,
+0x1e7ce50da65ee5c3, 0x245345a4871f87c4, 0xb488d2ff40bc96db, 0xf4d5b3ae2bdc6af7, 0x294400c01c55b2c0, 0x804843e7434fa592, 0x199d5b1cb7142,
+0x20a28ddc642e21d1, 0x8669437face4076c, 0x7c722496f2cf8447, 0x957152b657dd5816, 0x9eec7637f1e30639, 0x9d2f3c9812c38c29, 0x24bcdefad3bc,
+0x40d2075083d7b694, 0xbd825405e06f83c0, 0x80e7089f3313d1c6, 0xd3dbd770fe718e9d, 0x22e7fbf6e2186cb9, 0xa73da5e243efec9a, 0x169fb191990b5,
+0x223fb1fea20c173, 0xf80329428ad9fa9, 0xb6900372ab8830f8, 0x9d005e155af896d2, 0x310c44cb952ef11, 0x1cf11e79e8b19032, 0x1bc6c1ccffce2,
+0x128d9649d3c3445a, 0x390ea9029bfb7d88, 0xd3ac7c64d8a27f1d, 0x92aa07aa280dd926, 0x2d09fb1be53e4bf4, 0x9bfc8a96b4c52a65, 0x69fe6645bbf0,
+0x357754aeba73c5d, 0xa78c59c4bb5ca543, 0xae3a62e9eff34f2b, 0xf9111bd725b66c5, 0x613a0036edc1d021, 0x113d0555422fe2c3, 0x202938fece0e0,
+0x3a9d337af0436e97, 0x67f1049a444bef06, 0x66392dc558cbbd8b, 0xced3a2a394edd244, 0x47a3da77528e233f, 0x61aa8fdb5fc77acf, 0x1e646719790ee,
+0x8dc3be95642817e9, 0x89c62ba467acee8b, 0x3ed265e14bc53697, 0xb0ce5e8d02ffc09, 0xde7034a20eb2521a, 0x9e9d4736e1bf792, 0x1112750e96ab7,
+0x46325c87e66e71e8, 0xea0530d2dc943077, 0x7de5b45927b73176, 0x54964b4eac422ec0, 0x452d680f334013be, 0x47f1e1345b4bf05f, 0x1f9186abe2515,
+0xd2ffb3c524cccfaf, 0xe72e6942975a5a8e, 0xae27031d0fadd22c, 0x759eed776dda25ca, 0x35811992a262aa6b, 0x1a483748dac6eb31, 0xbaa88f933501,
+0x28433e4376845ca7, 0x5d9a81de8330eae, 0x3a95af9638f03a1e, 0xc1431d046d51455b, 0xcb718a3cf22804d5, 0x94d4b835f45d95bf, 0x22f8e10a56a82,
+0x79583600ca868d1c, 0x9770a1696e0fe9f2, 0x5becf2a94c5baff3, 0xfc30ec7c1b72ed11, 0xf8b93100f98cc58f, 0x4349dd7451167fd4, 0x9656e0d6e4fb,
+0x39b1b12dcc6d11ea, 0x3ea3f67d87b66009, 0x957f537b41238281, 0xff359584ad6963a4, 0x104e91904a277a4f, 0xd72d6064cd77cdd4, 0x159753362774c,
+0x3b521124b1a5526, 0xeca6a6c0f6dbff2c, 0x6a7a612096ca30c8, 0xbddef647e4799dac, 0x8f36830a88235ff7, 0x2e15d4a52afb356f, 0x1cb891df24ac5,
+0xa97ce7eba01576ba, 0xcc06e55cf523bf01, 0xc27e6751a79ac8d, 0x70fb91bb266f06ac, 0xc9cc9cdf30af0c5e, 0xb90ff32aaadfbabb, 0x21e0a07894e89,
+0xa052d83a2d2fcd57, 0x723dda00d8ab019, 0xee941f98c9b9e314, 0xdbd03773cc76bde3, 0xe849289677e6efaf, 0x8755e87ecf4593ee, 0xb120a417621d,
+0x15ab1dbc59d7caed, 0xb76e062da0c6cf10, 0x29365ebdc8925624, 0x2a91789e70553bca, 0x5667d058b976975d, 0x43079dd075696c46, 0x21e0955e4592a,
+0x26073325ea907af5, 0x91dffc6d61d56752, 0x9c02ab4319e1f309, 0x8cec9930c500ece1, 0xff520b40de27646, 0x80367904fcaaa08a, 0x1ad959c030ffa,
+0xce5bd1c3fd886137, 0x78213892ae24156f, 0x924aa16233c5ce45, 0x7d3f9518621cd09e, 0x7dc87b808bd5ec5c, 0x68bcf092a763447f, 0xe155a20a5c17,
+0x8d6d31b0b026194, 0x3741a3b46b14fe5a, 0x7fd3bfa7a1fdf20e, 0x5b11644e6a72c0a1, 0x99b71cefe491965c, 0x680b1b6ba52d3b8, 0x15e5727f8ad6,
+0xb33c4e7b32adac19, 0xde714d430a9a535c, 0x7ea0e010c8301dd7, 0x22566d24a3be5fb6, 0x6633afab3cfc2fe1, 0xc65bad8abe059721, 0x4a01051c2cce,
+0x17b24205b645df8d, 0x2273e23c12bec813, 0x1dabc93328149d2b, 0x26e8fd8429644f84, 0x2c97939630b34f34, 0xf5f9881f5f2b9e82, 0x90ad7447bff4,
+0x7cff0be3c0d32671, 0x8d13e931b65a0600, 0xff9bac3e12775a8, 0xf55e0abffa504828, 0x9b08d89000866e71, 0x6abcb43b03c894c1, 0x1c2b98e82f8e7,
+0x84b56376f4798ab2, 0x984426eb72549fb4, 0x738cdecd07eaf7ff, 0xe01f407c9b2c0c1c, 0x2ebcba0b52fdb8f1, 0xdb328f7aaa563285, 0x8499ac3a876e,
+0xc0b590bb5823c55, 0x211768874b14f18c, 0xd30333f3c0246dc9, 0x8467812b1b99348e, 0xfb4ac1d0abd02504, 0x357191f1c992581a, 0x1dc2005ff4a77,
+0x931c93dee78f8d9a, 0xf8afbd593a247ead, 0x83562757ad1526a7, 0xc950ba752c59aa52, 0xa802d7177d460d65, 0xb48be82a62210e7b, 0x6d85ab3f632b,
+0xcc4f8432e1d0b6e5, 0xaa1d2831b5392c03, 0x5f3a0d9ecbd6f6c5, 0x357534302497f4fc, 0xf34a4ef395610315, 0x14438d14763d767a, 0x1f6cb342528b9,
+0xb6bb5716e1e6c177, 0x215949ce016d353, 0x4f6d4cf4ed4d36f1, 0x97fd1a248d64ce2c, 0xee4ba501b43b8ca9, 0xb1c65a7eb81b80c5, 0xba3e756ed886,
+0x93f88346140998ad, 0xe48130e00b566459, 0xa6ffaf74630e823a, 0xdb487691cbbaec38, 0x1b6dd0cfb2535a8f, 0xb5200db6134a6f7c, 0x65cda5ccc0d6,
+0x1923a1649a4719c5, 0x7511568ab18f1535, 0x1e368d4fa3488f19, 0x6e5065421a622853, 0x2a0dd4e5c0561f39, 0x3d21a7181803911a, 0x148fe2eb2c540,
+0xc363f38bba848c1a, 0xed18bae368e7b30c, 0x9e9cc379c62d4c57, 0xba59c41a2e1c77c8, 0x21719eeb82c69ee, 0xaef9568e86d5824c, 0x160339e90d123,
+0xe8d04206d8af3644, 0xff8369e714eb3296, 0xd87144a4f4e8a1fe, 0xcd9b623201d71b39, 0x50ee669885435df7, 0xb93493c6e48717d5, 0x3226ebe9f5d0,
+0xc90225e7c1d8294e, 0xe35292119753ee4c, 0x83ed45ef716495d8, 0x2c0221708b00a1af, 0x76ba6fc01fc6aa53, 0x835e315aac8e85ea, 0x13c8f7484c725,
+0xdd743941fafa3ee9, 0xad030604165fe546, 0xf0041371e3cffb08, 0xd5a93e488a294a32, 0x99506a0dd725f28b, 0x7bd7a2b557d9d2dc, 0x139bdc4521c45,
+0x1e635c5b1e53f743, 0x915e0a7a7722fb3, 0x55d02b0481e40fa5, 0xdf926a6f61197507, 0xcbb0fa81b3a0df72, 0x77a89da7164d5710, 0x14e60b865d9cd,
+0x6b47edea9596506c, 0xcf75275a130606b0, 0x24cf0345b5346805, 0xc5dcb91bba05db70, 0xe463bd4d1c19a3b7, 0x69be38f0826e8001, 0x114ca7f7ff0b5,
+0xa972b5c2e1ece4de, 0xf860bd8548475f4c, 0xe90efd7984f3b757, 0x1606c9a1b5b697a0, 0xb96bc2315f1fba89, 0x80c2eef54173fe60, 0x127e2c6fb5a74,
+0x3055b7d815ba8275, 0x8c056db0a47844c5, 0x6ab3fde34c39e67b, 0x387c08a4579c9da4, 0x88931cf770cccdf8, 0x516b8af35ad91f7d, 0x67cc730acf4d,
+0x1efd338859ff14b0, 0xe02a6a10acb7475a, 0x31bb1c291fdaae02, 0x1c25aa318ff060aa, 0x9a275f361e4686d0, 0xaf564301d82ea80e, 0x1221b4b5523a4,
+0x95c59c354a3a91f6, 0x615f9cae90dbdf5, 0xe927e248e1e2628b, 0x747a423367086b7d, 0x396f392876a4731b, 0x13c6e1aa19721af4, 0x1f63497288ae8,
+0x4109863ff8334863, 0x971cc3acbe0a37d3, 0x1796e4244861c9bf, 0x303d3fa2cb4738b1, 0xcba1c3da92110a82, 0x65fbeea733eaca56, 0x9de0ce152081,
+0x49eb9d611e15a23e, 0x8a0a82950c4f7170, 0x6268ec74b430b06b, 0x8a99db509864ae6, 0xf03a640fc4c8fd6, 0x34b6fbe5ad959091, 0x35b28a01e9e7,
+0x4a587c787cc1e62c, 0x57f5e174a21079d, 0x68fbe7ecbe70e4dc, 0xdb7c09129fe3843c, 0xb4ea2b5f183a855a, 0xb2739cf9e6351aa4, 0xbcfdc274db84,
+0xdd7e17c24ddce7d7, 0xf433cca845324e9c, 0xe9a68d76f4ddfb02, 0xad33bf67df356770, 0x738ced25c20b12f4, 0xdcea246e84c5c9e, 0xe3e3a5f3446b,
+0x5c3cb602b943ea7b, 0x8fb6075a334758f7, 0xbab87ec1e0854ae3, 0xeb2080645605bf0, 0xa03ef6a410ddc0f7, 0x6444cfaf857efcab, 0x17f6a035ae275,
+0x3c3ee977196930c3, 0xcdc0f49755d2b599, 0x486c33026049b3e8, 0xeedd3b0128d84979, 0x12fbcfa0e8db20f7, 0x6292013700e3ecec, 0x1fafb7758fa1b,
+0x149665005ae7d2a6, 0x234b203471478adf, 0x4c0e8445a28507f7, 0xe31b8abcf72e3de7, 0xc846f360f974a9a1, 0x33acfd09ac377ebc, 0x12908a9e49cd8,
+0xbbc6e12e8611d320, 0x88d882fb284ced8a, 0x9d4deec65205dffb, 0xe75b32002163f193, 0x3cf5c088972b2cb3, 0x76916f38c60a5844, 0x1111dbda8f5ef,
+0x9e4c086983a22162, 0xaef25bfdcb71dda1, 0xdadf5c9130fb58bb, 0xaa180b12cf822568, 0x1ceb0a80709cfa0d, 0x8af8ef62941d69d1, 0x1cdde98c3772d,
+0xdcb4365ba13d25c, 0x6c8fa18cdc1a74e7, 0x8e1c53c91a3aca5b, 0xf62e2a852a0cfd3b, 0x40a2394cd9d6f1fe, 0x4fd909c2aeb3397f, 0x1dc94587391c6,
+0x6ca06ca83ab428ef, 0x2696505ec733587c, 0x3363792d7fecd041, 0xcdca60a3db80570, 0x4b8ba4bd686f5143, 0x399673e7c9f6f51b, 0x148bb37ca8b0,
+0xc6656fca558362e2, 0x864b2d9c28d84d06, 0xa4ef9a3d6054deac, 0x52d72e79a37327c3, 0x2fc54208ce16e823, 0x5f3b947224b6a799, 0x2cb57f4db904,
+0x2262ed8e00862bff, 0xec1efde0c1453a54, 0xe12cab7e769d7074, 0x914909205713e5d9, 0xe3ab67d9cd40b0a3, 0x1477a7e43f1b2c95, 0x3ddc0c23cd1c,
+0xf7b782cacff0fdd5, 0x90c1e6e2dadc3fd7, 0x20a9a521942cc69d, 0x535fb2be1e862428, 0x85ceb37206979564, 0xf3f749791647e55d, 0xc919c99f5c2f,
+0xe2ea52b092a7a29f, 0x3fdbbfe8b6728c4e, 0xdf833c24966d50b9, 0x9d53227dc07ed9f3, 0x44ce8070f93a08c0, 0x35d81fd9878b341a, 0x2295b46ea680e,
+0xd61686c40cfad5bb, 0xbba7d4ea3bcd041a, 0x333daf2d9142151d, 0xa63ce59c86e720a1, 0xc5625043a94bbc3, 0x909113756d923ab7, 0x1bf5ee874e368,
+0x3196bf540eeb3f45, 0xa5454a74194c5ea7, 0xc4aff5d69ac1fb99, 0x730a160bb9dbe10f, 0x5c39edf2bdde4881, 0xab4d7e3e602696eb, 0x2fce14440b7f,
+0x89c4cd0d49fb3bc5, 0xc42be1ecd64e6933, 0x9a82769556560fb1, 0xd915badeb0fe8b9c, 0x8dfb95a224d7ab8d, 0x312dd4271c1d8325, 0x1463069dd01c5,
+0xd7018bb86bfa964e, 0x38e82b9b6220c4e3, 0x8101f094f25beab2, 0x8737f599910b5176, 0x308c6a04f6a61649, 0x9841b55e095da0c5, 0xe62fa06d0e50,
+0xac3b50e8ee8326d7, 0x59d2e8f48d4550, 0x51064d99007f7dfd, 0x37f9d01b19f6b708, 0x7d16fdc828000ad0, 0xc780c5d1a578fff9, 0x126456a418dd3,
+0xc44fea5e36316c97, 0x19963c74c5b65f05, 0xbc90984ad9ce8fab, 0x844838aac639f94e, 0xbeaa8c14779dabf1, 0xc83fb769aba6f3af, 0x15f8d961110d2,
+0xaedbcdac8456d9af, 0x61d0ae93beb00818, 0x946f827023009d65, 0xa388e1210bb2b733, 0x83c7742ee8da4c66, 0x33c6681b8ff879c9, 0x1b03042a673c6,
+0x54e4273385a71b06, 0x4b83a3210feb9f08, 0xbbf814f0f853a7e2, 0x3c335738b9a96357, 0x236915e132366069, 0xbeb7f8fa1927ec8, 0x217b39d5a1c7b,
+0x8f21e79d5d8416cb, 0x99f491224a19137b, 0xde4ad415cd11b19f, 0x64c667bfdfb16c39, 0x65c1640a92445f4a, 0xc032d8d282a7de7a, 0x12d50e30e8bab,
+0x7eb94b7f78e0a801, 0xc88b5f995cf32606, 0x946328e588d32bc5, 0x46df53a5eead0a35, 0x28646ed6978c0714, 0x4a67787e9778dc5e, 0x133d37c3f9e0c,
+0x5f898b07c8990157, 0x3d668012247425b3, 0xf2f2baf622707610, 0x74422aaeef268682, 0xadb004799c579f09, 0xe977f2c7abc59e67, 0x8e2921d37894,
+0xa1ac963f7aa95675, 0xf32f0c9f3b4d7db9, 0x41c2a8d8de211bd7, 0xdb319865aee81c84, 0x66f80b31fa3b88ed, 0xf9c26406f07bd92, 0x16adcedc8b914,
+0x79732e923106f88f, 0xbdcc559a3ab4ccb9, 0xd842b67b20273827, 0xd2bc6f072977aca1, 0x17ce74ca3ccf848c, 0x5391a3f9513d69f, 0x91859736ae63,
+0x4ee32d2a6a83fe46, 0x9872e3cfd3452f31, 0x50c8041d247e56f0, 0x2c97cda566c8f06, 0x8bb6ef1986ed770c, 0x5a9dde562eb53df1, 0x1e0632293bfb0,
+0xd824577730632882, 0x55d16291317f5dae, 0x8f52a58614c8a0bb, 0xa71905b32bafb66b, 0xbf3210f6628b744a, 0xd1975e7ed33519b9, 0x1527c40e53268,
+0x274f73f9ebda9b3f, 0x6d319a585c11bf39, 0x706fb3669f16a085, 0x1c0d011a56011cfc, 0xc3a685198d19de70, 0xe5f74e6233d13d2e, 0x1c525b7132e69,
+0x7c5808a650668a55, 0x61f8a57d9f79e533, 0xa0fcd8423ad4ccc2, 0xb4c6f8581351c96c, 0xbb30f0e8be9b508c, 0x52fe7e3d3b563882, 0x76502b303194,
+0x34e0c1a0cc218b5f, 0x896078ac9771c995, 0x858a979bbb596e90, 0x2b928e4f704252eb, 0xa85f5670a7c92528, 0x3d18fea6742476c, 0x11a797ede1206,
+0xb033f882fa5ccfc3, 0x84a4d276f2285451, 0xc061b39eff31034e, 0x600a3c4798cf60f5, 0x84b84332a56ed05f, 0xad267ba7306f0817, 0x181d3c2d11d50,
+0x9b6940cd949ed1b5, 0x2cbf28e3cdce883e, 0x92a96ce0c857cd3f, 0x56ddc32559507b7a, 0x3d00acca0bffba98, 0xe4ac0e5891e613dd, 0x5f98faa313a0,
+0xac0d0a36c54c0e6e, 0x52d63b8dfc2e2a02, 0x5a92a2e98ff56202, 0x244d94afe3e02691, 0xda539c1d78b8486b, 0x911bfdefbdba82c6, 0xd795f620da4,
+0xfb36f15144d18501, 0x36c73267f1d806ea, 0xaa0267dcb6344643, 0x836ccfbfc84648d4, 0xd56b882d43a6312b, 0x274877b4686f7ba3, 0x1d92616476379,
+0x41b8d0872788ddff, 0x959d255b10271790, 0x23495a5f2abbcee2, 0x2b1309310c85bf0e, 0xe1a196412727c886, 0xd85c5675c88ca629, 0x14d54425b46ba,
+0xe08b96171137b93e, 0x91d22ba4f0eefb89, 0xed6bdfb8f49176dc, 0x330c4becc618f1, 0x78727a276d771fa2, 0xf6a1cc41538b0c32, 0x41d10653dc03,
+0xccead13988c1363b, 0xc36b962708efceb7, 0xf0ddcb2dfe9ccedf, 0x529be48800837d7b, 0xd8179ae6bf4e4383, 0x94a41c430f563983, 0x1ae1b71696e7e,
+0xde7a833f307baf9a, 0x6e623aed257515e9, 0x3fd4a4cdf0261aa4, 0x29d5a2e064cc71ff, 0x13be636798deddff, 0xf4e605d1b9a00793, 0x9d9c5e337736,
+0xc79f6acc7a74f5c8, 0xe577e43eedea330e, 0xa53f39f793c4a661, 0xe8774cf477302cfa, 0x28b2813dc94cf0ae, 0x10d8dc4e1fdbfd08, 0x4fa4b5f32584,
+0x4a8305467786376d, 0xbc3e27a9838d5f37, 0xec296c7eac6d2df4, 0x9bea228fe88bd31b, 0x2501a7e769f542f5, 0xf3616c6e826d2c6d, 0x204a8827e82f3,
+0xa27c09cd6c6ec5ec, 0x949ac8b5af250db9, 0xd51edae2ab04caa0, 0x28fec2b114480728, 0xacb17de36284c13, 0x8a19501cd184d977, 0xcebd452ae863,
+0x46ae126a4e159750, 0xcead9593fcac5a90, 0xa2a59ff96baf0386, 0xfc6a24c4940269e1, 0x723202dea9235567, 0xb715023637fc855e, 0x232a486f7faae,
+0x5f4773544b449f0e, 0xfdfbdaf4a5d302a, 0xd138794d82630266, 0x4b4df8fca7e068c0, 0x6445c6f9e7c51ee9, 0x92c8d8d3277e78aa, 0x16d7930c830cb,
+0xb38bf45b0f55a02, 0x9688d72a618df907, 0x2665bc378e786676, 0xadcdc0996e6e13d0, 0xd5d295a4101da92d, 0x7472e096fb9bb1e1, 0x142faeb833d9,
+0x53ca27daee240704, 0xbc429b083af3e458, 0xd57738a66c777ac9, 0xb3a44ccafe3ef7de, 0x439756b474be7686, 0xa9be2ca61e6603b9, 0x59165e1669c5,
+0x563771605a061d5b, 0x466b336eb58247b3, 0x4ec2e4085b2e221f, 0x7726004d30fafe, 0xc6caa441a02f4cb2, 0xc462ebfd47e0ac19, 0x21a78709b748e,
+0xb9caa1dfc6baebda, 0x2e230ff84b6f2940, 0x1a5dcbca55cc5420, 0x855aeb2e08f19a6, 0xb2ef4a41591178b4, 0xa1b93a86599aea98, 0x1ebb50b4f60b5,
+0x961d75a11ea5bbcc, 0xd4051be454f6a19a, 0xd7d6b3b5f9b6f443, 0x8ad454e61df21be1, 0xd22b0361ff2ceb0a, 0xec74fa6d25f1f037, 0x73d308249f43,
+0xf3de81c2ee987ee9, 0xc810337d947b35cb, 0xe13999f0213d5995, 0x253515f875edac96, 0xf481d12ca80ec08c, 0x91fd8576e50338dc, 0xf22cfb8798b0,
+0xeddafc7e80298c75, 0xbcd5723e0699b5b1, 0x80dd9527339ad137, 0x8125180a4ccf2d49, 0x21e014246fd37ba, 0xf0b93f115c371ace, 0x1ffde2b469294,
+0x9d60aa206fec0b3a, 0x22cd6162f6fd932e, 0x68eb408366601487, 0x6e385166b90bca23, 0xf01d87a6b0fbcd11, 0x7b8a78e86b73ad92, 0x1ac4942023479,
+0x7f3bf113fd2adb89, 0xe26cf289ca3d093a, 0x740d52b609620416, 0xc62fd487b5758f24, 0xcdfe60ca2e09c87d, 0x35943be690e638d8, 0x6ed6c8e13613,
+0xb324ff9c12b781ba, 0x7805d54b9a94da67, 0xe3e83efae427f189, 0x1531f5ecd6d9b5ce, 0x85f64495b8693821, 0x2d65ae2ba0078356, 0x978a9fd5c9a4,
+0x3c7f27f2e473a748, 0xcffc0df3c4e69760, 0x1543daec3a38a2bc, 0xf91eebb46aec0f62, 0xf6029706b65f4361, 0xeefa31de01bbd34f, 0x11361a7c9d19,
+0xdbdc78d7ae33fd9e, 0xdc1d4c0a7d8ff4b1, 0xd25a068475d4f825, 0xf097b99a88627288, 0x6f33950d733e28f, 0x3fda22b41893f08f, 0x5ef76a123456,
+0x9035d39223997bb0, 0x201cc9fd0145de21, 0x45698dd3d8d4af76, 0xf74116d9dc91e9ba, 0x72ed04cceeff7fe2, 0xae85973d99cd496d, 0x1dc73c9158f69,
+0x68e352d4f0a82ef0, 0x6af784c029bcd635, 0x682600f2ec224a94, 0x3a9dfcda57a3219f, 0x5af36983c8d2887e, 0x94f04383c5c9380d, 0x19eeb725d65ff,
+0x294f8e8d76ebb3ab, 0xa436c915ff410100, 0x52cfb95331ea1cc4, 0x7974cd850c6558ea, 0x4c857596c3059907, 0x80a4c1a7cd8ea45a, 0x2be2dfe0f79e,
+0x1c36935cbe6c852e, 0x39d8eeb259a7616d, 0xdba3b211e058dee1, 0xfb60a13bdba2f7fb, 0xf81cbd9df44cc5af, 0x751b9ea5abcd1865, 0xc6ac34b5e495,
+0xcc2142c4f8608b51, 0xe1d70de2cbc0b73a, 0xef5c50745b35c0e2, 0x1ee24df1d58018d5, 0x8c4f9a815982b333, 0xae3705752c2e2340, 0x1bc7c68821714,
+0x30eed512cea4c7ee, 0xc46f2d4bac03a2d6, 0x9f8d109979f924c7, 0x4ae64579519e96d5, 0xfd2a1c93c649f4ab, 0xbb77bf9b66b0cf68, 0x2269109572590,
+0x6e4f143541ba9f7, 0x8f5aa6ded486d9b7, 0xd2c320c52b94cc8c, 0x130f0692b337bd97, 0x16ea73398da0825e, 0x90c38a83731ef9cc, 0x227f6f5535b14,
+0x864ab8d04ac75534, 0x7750582b32d1d3d, 0xbde1b23c07556169, 0x94e8627e558424ab, 0xf5df54e8a89723d5, 0x250bcab300909022, 0xd777f59a84b6,
+0x737a51d4de713131, 0xffb6d92f7c1ce1ed, 0x93185632894e701a, 0x36d02da9c7e1d95a, 0x68fea8a77900d28c, 0x625b3b8314017613, 0x17951a6243856,
+0x19de4392dd7f325f, 0x3e5d05c85beffce8, 0x3bf651e505bcfa13, 0x570899577a6963c0, 0x39344f4b003278c4, 0xbe572e4c6731f886, 0x1b12a9bf2b350,
+0x8134d37696292ee4, 0x1fa447538fc58ed9, 0x562c6bc96ed131b7, 0x349e316c96049b3a, 0x32bff5a703cd9bb4, 0xce58f8f8f199be3b, 0xe7e645395d96,
+0x61a3b5f9fd0edaf5, 0xa4bb68c8390df532, 0xb72312fda16d6252, 0x6a3fd35774fcf309, 0xae991209d6f1c9f4, 0xa53640193b26ac7b, 0xfc108bd443c9,
+0xaf697b7b27d3b998, 0x2e410a79c176b23d, 0xb240b26aaa533803, 0x4b4cb3a343101905, 0xb5689d5b1ca0e8d6, 0x166e767076ad3560, 0x149a9b30673f1,
+0x46be20ad0dc4b28b, 0xd997d73fd6358fe1, 0x1c102f3209ce678a, 0xa113d8be95242c45, 0x2e1ecdb0e5faf381, 0x938242571bd4c1d9, 0x16a86e3d59b9a,
+0xf74e07f1cdb7906c, 0xa7569546788e2e98, 0x7645c92058851372, 0xb1ad19d3a53103fa, 0xe3095dc4671ab21e, 0x7af9a2dfd5c6ebed, 0x34f99006dd08,
+0xf89054499c0c7b6f, 0xc92a47db03f788d4, 0xd120d620ce8ac42b, 0xfa046ccce4e55ae8, 0x5242a5d7d9363527, 0xdb7ac3a34c2d847e, 0x1fa3e9a96579,
+0xed7db21e31f29743, 0xa533163cca82b73, 0x664698afdddd5ca6, 0xa397584b4bb50d1a, 0x1c7be4d3a62ee908, 0xbdcf3de9d0132e19, 0x13ae4d2727a3f,
+0x80ac9419d6f57b92, 0xcb0f687dc5077a45, 0x26312579460f4fe0, 0x4168008404f44a14, 0xb2c77d27c24b5294, 0xc4e509166f431a11, 0xbeb88e1e74e4,
+0xa59e5d8854419c39, 0x3f918a3fdfca6985, 0xa4570fbe424fa026, 0xcb480422325497ac, 0x7df40e23e53e7ce0, 0xd494fe952feef042, 0x1a5e3674e6c1b,
+0x7dec7b2687fc76bd, 0x34f9f78813a9d005, 0x1d8ce872c0a99d48, 0xb936e8c781394e91, 0x1865a6979cbc0733, 0x214c17a87a57d79d, 0x1a97c92145e39,
+0xd5328a128523c450, 0xa7db97235886ab81, 0x4a0d85698e51ea94, 0xbddfb5442618b1dd, 0x203d1280703dde83, 0xff03d0f43d26c827, 0x19d5a70b5d05e,
+0x1878bcbe7dbcb32b, 0xb6014d7399346068, 0x60197f5e9dca8821, 0x71761708ad0911df, 0xeac97f9314ff16c7, 0xb1030d7de282d013, 0x4491ebfc273f,
+0xe75f39fdea20cbe1, 0xaa7c4e178ae6e095, 0x27c823ae77478747, 0x8a4c4efd8fc449d6, 0xc525d0ff68c3ed42, 0x19ec2768d0a55391, 0xfb08a7c90ff5,
+0xa474f261235788c, 0x823e598611ded871, 0x5255ab9b54579ddf, 0xbf98c41a15d1a3eb, 0x86e6a338eccd008, 0xa4a52cdc4f9125c, 0x1a8f27f5668e8,
+0x8d5fec9ae01afb6a, 0x3123fbf615a8e091, 0x3501bce21dd1faaf, 0x86b9da44acd65ee3, 0x92368553815f5d6c, 0x15475d2cc4b46604, 0x369e9c3d3cc6,
+0x9e9e6c5c7d4fcfc9, 0x948f15624d3dbd5a, 0x44d5b4197754cef0, 0x2271f655b633815, 0x930a484a9355c77b, 0xb8c56d3da05ea940, 0xa75c625516b0,
+0xef80ae7fe95e909f, 0xb11c82f0f2c0a88c, 0x2dc07d9efb5a4590, 0x5e58fff8597b48c6, 0x9469fe21d193f7d8, 0xa6e3bf5d09f22f0d, 0x2f1fdf41052e,
+0x9b3585c1f5432446, 0x2c5ff8482470f45, 0xcd95eefb097fa2ed, 0x186f97699fe4c6cf, 0x562144c7a4568f93, 0x5eed9a8ac31e393c, 0x1bde9e73a18b7,
+0x11a5d8ccdafb4207, 0x38aa3b72bb2acffc, 0x89a97927385c9b23, 0x56d45ec7b48c2b80, 0xe9d2319f6cbe84a2, 0xaedb24633f95cb50, 0x192f1055ea3c4,
+0x46b410e3831b43d7, 0x978ebd2e49d9dcdc, 0xccfa7de62c5949e1, 0x879cf5a92161df0c, 0x6a4a87634201f264, 0x3acc9263685edf03, 0xce1848ecdc14,
+0xdf97e5b80ba4999f, 0xf6832bf866fe6b0b, 0xf704b1d4023a7f8a, 0x64bccb442e2c55e3, 0x93635cada3f587b7, 0xed28591290406181, 0x2140b443c6f1e,
+0x22b887a400aa5f18, 0x117305b152789022, 0x7973a3ba23449e0e, 0x3f0ca0cc666c9b68, 0xcb993cf30261dd46, 0x584e5b9fe01de39b, 0x1502b29874425,
+0x779a5ce7b82797b2, 0xd0eb22f296c6160a, 0x1a7e7464f7f02e28, 0x3f3d949409028ae1, 0x5caa4e1e4e9b5bea, 0xa4557bf0ec76b2cf, 0xb6ea69fa1e30,
+0x5f2308e3a139d746, 0x697f48d418823554, 0x4ccb657072fbc060, 0x89a3b13cd2966b5a, 0xfc4c985a2203211a, 0xd0632d3db23382fe, 0x1dada18c9ce85,
+0xc1ac19c5e1289f71, 0xb42b9f6a68bfef3f, 0x1fe44da84ec983bf, 0x1f82a719c87fc87d, 0x8b959937a202e5cc, 0x961469ffc2a0e419, 0xbc2007d046d8,
+0x739d3eb60cae553f, 0x4e8c3d8c16769aec, 0x2931f5fa00dc2321, 0x783bb62346dbc2c1, 0x2c0f6f0693e77e9b, 0xaf815e4559583049, 0x22c2f880ff1ae,
+0xb7b9a777ce5c2f23, 0xf36e84cff159660e, 0x548add39759a0190, 0x654a480c0db669a8, 0x597251e4dcb9d329, 0xba6f51fedd95eca1, 0x1c14c731c5b9e,
+0x71065e7ce8040b76, 0x197f8230887a1956, 0xe7cf3aab479cc49c, 0x1056e8b2b2438fa, 0x307da7592699eb66, 0x84cfb1a77cc60f9b, 0x285e62c377aa,
+0x82d825b7372ea55d, 0xa9503c5326880c6c, 0x36404adcb147e44, 0xac601db23473e3cd, 0x609624da167629b, 0xc4a27fa1da1e0ac2, 0x1dff3d7ed7392,
+0x6fcf6275a6a8f83, 0xa142a469f0514e47, 0xe1b34bd723e2cd93, 0xd653137c2f89c36e, 0x57bde6a0d5e70211, 0xa81bf95ca9032aed, 0x38121bbb155,
+0x31780ab033d2987a, 0x1450ca13ab24d019, 0xee233334a3606bbe, 0x7f01c5aa392a4b57, 0xb771ea267acc1db3, 0x92a08ca18a7bc93a, 0x21291b7c105e7,
+0xf47dd4e45ebc968a, 0x889de3db4b97afac, 0x555917b863db95d6, 0xd2aa894ec8015890, 0x15c3a485727d2e05, 0x73e89724c68c6996, 0xbd263e2635f7,
+0x7492aa9c58b101e9, 0xcaf3b5e2844c771f, 0x4fe8eb195ce2bc3b, 0xe487418f88f5d332, 0xbd0684ec022c4141, 0x56991dac483b6263, 0x5db69df37a11,
+0x166dc22dd1d6d792, 0xb1d62bc34a508f3b, 0x659ca5ef42e2f712, 0x599213ffa5eea4a7, 0xacdfdb064094ef00, 0x9a24552f5826a792, 0x5ff9209b683,
+0xcd57d403da40aebf, 0xfddf15187770985a, 0xc5619577fc362292, 0x94b7043cc1bb5aba, 0xa1df983939f15430, 0x931165ec081d98eb, 0x20fa91e9dfad1,
+0x764c6ea9f66706be, 0xa9407bf0892c97e9, 0x1a36ae28be3ac959, 0x11e368952d1b492, 0xf98fd76e707c8927, 0xf25c837c7cc8cc36, 0x7f45ac1a01e,
+0xc13192ce8302a90a, 0x467895e6d80b97bf, 0x899010aee806ba69, 0xea8686cc08f7c29e, 0x6f593a72105df08d, 0x296a129bb3d0a7ef, 0x22794caa5a90c,
+0xa6f86b2200b048c9, 0x42ca1a2dad079d6d, 0x9c6579ed5908fcad, 0xe8aee86f80049a3b, 0xc7bf190f7252aff4, 0x135e78ae16c927b5, 0x9aad513922cd,
+0x17dfb7098ef515ae, 0xde0b43a164757dbb, 0xc1ea4dae4abd03db, 0xa79487f2766caa85, 0x63ce740785e2d481, 0x9f769e554c2e115c, 0x21953fc8a7401,
+0xf5cbe300a7415718, 0xb051e8f277d97fd8, 0xf949650218d315cc, 0x4b4cf46d0eba65d8, 0x4c069121d4370993, 0x889b112e41ec4c9c, 0xc5be26bb6ec1,
+0x9ebca60911a374b5, 0x5cc8ffd53dd9297d, 0xe6fb07ee89fcb85c, 0xf50d54887f2175a5, 0x48c50a04f24f7b12, 0xe2c2ff8153aa7594, 0x97d22136cb27,
+0x3dc8c8a304a9bb9, 0x681affbf799296de, 0x90aca28b9b75375c, 0x4966c15ed3b82514, 0xadbf294017f6f2ba, 0x61622f04c75d7e41, 0x164a692f5d76e,
+0x6f9631edb60793c6, 0xc820e3f8bdcb5aad, 0x346974ea5e12e729, 0x4e1c170721cdb7cb, 0xd5d415edc5d46bfd, 0xda2ee33cfc063e19, 0x147d6aba78370,
+0xaebbe5fad9a29da5, 0x8b08dd2cd28488da, 0xc8f8fde9c1c886bd, 0x7e32ed8030ee0210, 0x63ea74b36c0c9474, 0xa87a49697a9bba1b, 0x148c70a7089ca,
+0x4dfa786cdc7b40d2, 0xb24d034940a0d575, 0x383a4d055cdd00e, 0x91be5fda66c69f98, 0xf8aab96687d8cc5b, 0xcf43122d98d8c1fe, 0xb6448dc84a00,
+0x1511ba378b579302, 0x8447fb713c86e54d, 0x20b85c232020b611, 0x7b2dfab630407386, 0x4c61673f1421b2ce, 0xd084800c959668f4, 0xc21bf1e6516b,
+0xc862ef7588b0fa4d, 0xccb1e3d459ff5c06, 0x1517b25dea81fe57, 0x80ad239428140433, 0x3a6b14492101d06, 0x58c5fa5090b2c4a2, 0x6f03641bdec8,
+0x495c86b6d960a3ba, 0x412392d8cca7ab99, 0x768c7c96d1fda6b3, 0x9280184fb2dbabde, 0xcfc9b280b66eb24a, 0xcf47dc9dcf97a946, 0x11daa3d528dee,
+0xc11df4fc0112737d, 0xc3b52f286cf4f235, 0x855fb3b2b7a4628c, 0xe90b78da3316330e, 0x95376d07e67a4da0, 0xe357c22244ba20a7, 0x20d676582de4c,
+0xae809526e5410112, 0x843fd20b1a2d96ed, 0x97269f888f0375bc, 0xa4b291b93f6b26c5, 0xab818657e8c6e9d7, 0x67818618027871ef, 0x1b3e77628f1d9,
+0x506ea74d2833666e, 0x604d3ba188e1a235, 0xea753f6c673222ba, 0xaeb493db875710b0, 0x19cae48944b76ad6, 0x3ad1ed4fe367c8db, 0x1853469ed0e63,
+0x889ac7d8899ab4f4, 0x3df59247b148ba4e, 0x5325c20c344102cc, 0x517f64eea545a432, 0xe4809a9756893e06, 0x935e895c433d3286, 0xc1d45fd0ed00,
+0x88587ba907263131, 0xde07364f19e763f, 0x7c61e997a49213f6, 0x1b88046e6c2533e3, 0x601efb3e5d710c3f, 0xee928b88386ea074, 0x1bc083d61c6af,
+0x73b45308934dc13b, 0x32afbbcde2b3df24, 0x3272b77953574d04, 0xf58595fd47f8d3dd, 0xc0bf0099b879f43c, 0x91d5f6bd5caf35fe, 0xf6ae56d5b0b4,
+0xdac0a18cc4a3ff8, 0x689924944a5bd0d4, 0xc9b4849f649fc1f5, 0x4c23ed813f0c6de9, 0x829a4cfca85737e3, 0xcf2d08674c751f3, 0x16db64b6a5736,
+0x7f4c7829aaacf305, 0xf5dd1a41b3839acd, 0x3f3d6a41dc2c5fa3, 0x2b0486c508b6e1e, 0xdc9c892da5048052, 0xbad114c9c9c0645, 0x4c896c45b738,
+0x4bb45ea58964dd4b, 0xc3d1e31150965f53, 0xb7aae841b8155ac0, 0xd29d883e242cb89d, 0x9160aab7f998e045, 0x40c38dee9b82dadc, 0x22cd332e0947d,
+0x25200faa7d989c11, 0xaa6fc1ea056bf8b9, 0xbd093c36382cde66, 0x349b9c863c98499d, 0x5207962d1d53d7e5, 0x2d738c686bc3b12e, 0x676388fbf7c9,
+0x33c9269a4bd526ab, 0x5dad2144514c68cf, 0xecff1e0bde0dc489, 0x199f9a339b556740, 0x1af90f0b66748287, 0x4641ad05b61fd3c8, 0x18c2c7716a6c2,
+0xf68cdf70fbec14b1, 0xa6d090f8136d393, 0x712c278ec4024a52, 0x309735ce49df648c, 0x76efec406e5a7973, 0xeed15c4ee4ec2c12, 0x3a6fbf6441e3,
+0x4cce0f8f539d6d9b, 0x8884db7c94670bd7, 0xc901e5a1dc2b7105, 0xfef1b75b66261f21, 0xcedded9806a65dbd, 0x900a318647fbb0b6, 0x1067afe77fc30,
+0xbf790cf820472332, 0x1daeb58e61d65a8b, 0x185bb692ca9e08fc, 0xb7a53dd524e7dde7, 0x928b25c710e1645, 0x341da2751227af71, 0x1178ec1bcdb92,
+0x42a08f588ee46fda, 0x9682f8c91e0d607d, 0x1439a1b3e9eee31e, 0xa6150ad0150750df, 0x2268577e84c7ce57, 0xf8236671dd1e455c, 0x39499446e61c,
+0xa581f492f00e9402, 0x4c00c194dc9c14d3, 0xebe227bd2c7800d9, 0xb9d5e5dcf5675d2c, 0x707e2a578b203923, 0x6b086c327853fdaf, 0xa2bdfa972228,
+0xed8c42a1b0838972, 0x2d9cf6e50bc0c7c7, 0xd474d06a3e4495b0, 0xf3ad8d0c5c2a763c, 0x1cf3979489cb50e2, 0xe87d1cc5d7292495, 0x530a07116ff9,
+0x1a49f04cf90d9fc, 0xaa4db6625c6a24d1, 0xdf4aeadb4795e7f8, 0x23354c40eb2dadf2, 0x947c7c17d8ec98a, 0xb7f88bdd4a4a07cf, 0x1717f40e14d0b,
+0xcab06a2183d3d92e, 0xc2b0e0bc396ba97a, 0xd13dec4db2231658, 0x1d6acc30fc7d4494, 0x7778aebe9b370b5c, 0xbadfd6ddb4bec6c, 0x1c46307fbf631,
+0x5f6562b87826e01b, 0xce4dc73d90145400, 0x7c6e652ceb2d1ddc, 0xd3ffbdd6c9288dee, 0x11622fb7b2e03f13, 0xb979c64d8879c6a, 0xc345a5078e71,
+0xdbb3fbba09b27708, 0xc84bf178717555db, 0x5601d0d0b74564bd, 0x368508415aae840b, 0x614f24d56f15838c, 0x200417bea91e18e3, 0x1f0fa9a67e067,
+0xafc3ff62faa4587, 0xb925135d9fdbd858, 0xef9485eb8bdecbba, 0xb0624d4e32b6585c, 0x2cfd5c525e480a87, 0x15955213cccc324a, 0x172e67ed5eda3,
+0xabcc1312ef7152a5, 0x956177b10c69d196, 0x33b9413d668e43c5, 0x1502dd51aa3e968f, 0x3f36c43ae2e03db4, 0xd28b5b67df443fb6, 0x1549bab6561f5,
+0x795504e6846b5aae, 0x21e3fb162b61ac4e, 0xac39254c3e8825ae, 0x5edd4b9273530303, 0x1ef7faa4c5f3d806, 0x10d70c2df72fce75, 0xeb0ebf51e5d7,
+0x9c6f926b431ec2f7, 0xe2ac9e52dc84c5b1, 0x390f90fa118e4535, 0x98db7eee4b368973, 0x40838e2f0205f2d3, 0xb855fbb43f3b750a, 0x7a9ebdd4299a,
+0x1e5b554295fb00e7, 0x38971c976640d5d1, 0x8d87338500bc4eda, 0x6eb50f706adba9d8, 0x66088c4af8c48c0d, 0xc84def3539639426, 0x348303d2dddd,
+0x1a93e13795a26148, 0xadcc16dd6f6e4469, 0xa77ce6acc78bbd54, 0xde03ffcc617498be, 0xbc01e0bc495433ca, 0x6c152c87088d338b, 0x217b2717aa83,
+0x4830dbd5780b5942, 0x64d64e699272b0bd, 0x123a9f3d329a875c, 0x5ceed18564b066a1, 0x84db7ad0ac1efa56, 0x646d30380949c92e, 0x12da324d0ac48,
+0xa4f8d6e4a2ca7eb2, 0x20929ceec7c03db5, 0x691dfe81991bc66f, 0x6a96b28215295d75, 0x4bc94257729265a8, 0xece78bdb75effdab, 0x11c535b4aa3c2,
+0xa27b6aff031b7dc3, 0x7c492110dfbebf20, 0xc65c30ab1c9d7e68, 0xfee394f47994d0d6, 0xe3c99ee26ef26a27, 0x334ff1396bd889b5, 0xb61453eb76c9,
+0xf8c29bc4da5bbddc, 0x8e0968e70441ddee, 0xf6a484c32f14d99e, 0x3b14d2d7d2898057, 0x80112369a1be83d0, 0x89efbb889730c11f, 0x2a7bc3ed1c79,
+0x24a79a078e0d6868, 0xe8acac71e2dd51b0, 0xede1a60e0515c999, 0x8d87bbeeac7a8cd5, 0xe9e8dff74d088903, 0x8031146b673e676a, 0x22cb7a9be8644,
+0xa10a064f0e66b859, 0xdf33b2964a2bd519, 0x470a7637b1be2caa, 0x6ae88f035bf5f43b, 0x1b52a580d6709e95, 0x154c8666fc11a068, 0x7149b68f53c1,
+0x165bc614ae7fd11c, 0xa7ec9aee2c67568e, 0x6e16f9b5b72a5de9, 0x9084c873bd17735d, 0x9d8e5bb2ebdc1d0d, 0x2b51b6ef13a8347c, 0x22c4be5191869,
+0x8598cfd464f85b7d, 0x39a7305e6ea6ec02, 0xa5eb22d06580f6fa, 0x5e468590b2fba19f, 0x60c06ca7e7a01b3c, 0x9cfe2a610df3bf3b, 0x5b5f4c9b2e68,
+0xc4e433aadb1ebb88, 0x199046f67d299460, 0x7090de3a24cf954f, 0xaabf861224279f73, 0xf4a8c4f0ec1a7d83, 0xd0aed81452ebe9cf, 0x16dd5856370fd,
+0x1dcbf1de0584416a, 0x4bc06949afa9a1a1, 0xbfbae907a2f9b1e5, 0xb507a1131f0957f7, 0x25446ce0ea526202, 0xfc1e280e2548bf89, 0x22b5ae1790ea7,
+0x8802ca8e87164f7a, 0x4e64553b02fc380b, 0x86f95d9f46df29ef, 0x28071439202fe34, 0xd9734741b0ab7403, 0x6d5f77baa9713fd6, 0x64cc00aa5f53,
+0xaae4fa7c479217f5, 0x68eab71958bf8b58, 0x4bad9481dfa14c24, 0x2995efec55a7942e, 0xd571a69f215b5ae2, 0x2ab3d9c2774ffa07, 0x17824041c42b3,
+0x7311501858ac4d51, 0xf6c672327cb34a5, 0x655cc1b2245eaee, 0xfebd0f0d848d72ce, 0x3bc0330c93a54f47, 0x828cf08c0c743c03, 0x1c3da4afbbe95,
+0xaed062bd07d0efee, 0xbd9e293d4de25c85, 0x5e157c451cd4970b, 0xfc20a1f842e7c417, 0x205223afea363c02, 0xafee92d6d741c489, 0xa16e1608692f,
+0x39e29a5394f3177c, 0xb2e2d7a70e3d4cd8, 0x7a1a77f302c8aba5, 0x7fb1b7f684e4fa97, 0xc4bf5fc0ac90e516, 0x45b9270935fc3263, 0x1022178a75714,
+0x247d1aa4de51e42c, 0x94743ca989609fbd, 0xed829d4661a18a92, 0xdcd13a1cba44abd3, 0x9397ea2aad084bd0, 0x425244854c8a2d73, 0x21e46f4426a3,
+0x5d1aeaeab38afe6, 0xce4eea84aac67654, 0x4e1eb17c76b80a52, 0x1e6b97742159d2c0, 0x7406298453d92f73, 0xef312cd8d4f4e540, 0x1624ef93c52ca,
+0xde54112eaf2b7895, 0x17f33ca34e94287, 0xab698129e7ab8228, 0xebefff584581419e, 0x32f911a89af8f1b3, 0x75859c409f724349, 0x14e4e8b4d47ca,
+0x5039d574ae1b779c, 0x636b34232422853c, 0x6886ca54f3839851, 0xfa1bd16c77e90f4b, 0x5b717ca723a00311, 0x3c1c0e2a8f30e888, 0x5db4f431ff31,
+0xa8e30484ca2a4d32, 0x73826b5cad5a7219, 0xb3c5e96aa2379952, 0xafbe95831850f296, 0x45e9de24d1e6b2b8, 0x93fd355834c5300a, 0xb3e96b0735a4,
+0x6dbf407201128ab3, 0x9b9d19a88b2347ba, 0x2913f262072259f, 0x1836f49eb51018d0, 0x5ac8a2576120022d, 0xef369bb4a1f2062a, 0x4c3366f9b816,
+0x2259611a0d4ab6cb, 0xb9cdbd69a20c18af, 0xf38d14208994fa11, 0x3f817c5fbc54e063, 0xa2ae813ea5762c18, 0x96cd38975f4455bf, 0x645ec1e89f97,
+0x796e1e80438d9e0, 0x3c450145c448ef4d, 0x9c9f9e877bf93227, 0x4f03163a9b24c1e6, 0xe6dfd88cc77dc494, 0xfd4f48b8e0eab2ff, 0x146a86360f1bd,
+0xd2ec040c554536a, 0xef566b980dc7fcba, 0x2c1e8e715393b156, 0xea085aaf5efd7b4f, 0xa7793fcfc955d901, 0x7ac0fa0654bcd11f, 0x303e4480a75c,
+0x2870cbbbaf5d86bc, 0xf8d704cf874049ef, 0x8f56c86d7157153b, 0x9cfa5f159b96c6c2, 0xac03964f95eddff3, 0x8326109fd0f07e8c, 0x5bf6de600084,
+0x321c8ef11e988c5a, 0x2ee426dd27df94a7, 0x2ccdba357c689621, 0x22bd6771867f700d, 0x2b5a5e7bd37d9ff5, 0xced6915f2997f495, 0x1c40631a937a,
+0xe1d183570c452789, 0x48643920888a4736, 0xba03471d0cd982f9, 0x2bac7252c6fe3eaa, 0x5f215537077c5990, 0x95383a32896a2800, 0x94388233c1c9,
+0x86c4533ed3b8f3f4, 0x619f142c46cdeff4, 0xfbbb2d31892e0df, 0x8313c3f8beb379f, 0xdf9238db6c6eae22, 0x7df4c961a9aa8255, 0xbccde1e891b4,
+0x984db14a6bcc0c56, 0x9b84c66ff438372d, 0x3de82bbfc3e8a2a0, 0xf03b7e49c9bc9e37, 0xce4440a4d9f2af4, 0xb82fcac86adc0965, 0x1e5a9d6627ee1,
+0x73dec1de5bc1a55f, 0x3674314e5c2f2f3c, 0x26de61ad6f7d7a71, 0xb1b17d6ddd02f94e, 0xcec6f34fac3009f4, 0x62329e67771a3acc, 0x88265334d840,
+0xd9377ad30f840974, 0x7e0b114876de30f6, 0x75693ce4e13ac6d7, 0x2396a45ec85ff5fb, 0xeb1e1d1628028d3f, 0xf243ccb8d590f74a, 0x12907f577cac2,
+0x1b381bcbe74a622e, 0x4c2569ba0e8d8b00, 0x4251a4ae3494e255, 0xefd29d556a6a3f21, 0xe2282b641054ff34, 0xd31c4f26e87000f5, 0x1d77635f0a80a,
+0xcd52e1f9026c780b, 0xcda4bb96a15f33c7, 0x4d03cca259e28800, 0x95797b09bd2c0b21, 0x136b2816e9248248, 0x75f1e07bdcbfab58, 0xdd5fe01aca42,
+0xef4b9d49c0e91a12, 0x5ce4845159d26b6b, 0x10775afd73eee95e, 0xb8cf84b10d689adc, 0x6503755ab22d7050, 0x5d064f7b089a4a1a, 0x55112d5df666,
+0x6498f3218142bf57, 0xd98ecedef7d215d6, 0x8691c26126ab5c87, 0x826e1187b2e7aa8b, 0x479cea168713f5fe, 0x2eef19ebe323dcf8, 0x10919f9800182,
+0xdcf63dd4ce32ab78, 0x54cbb2d0a862fc47, 0x1abb1c3060822cf7, 0x5c6f2e0ba82f2cf6, 0xf81c5d971f9bc14b, 0x538326fd77444f4, 0x10257e9f3089f,
+0xfa258b298cb07cf9, 0xd6e47d31a29ebae6, 0x26d3dbd78ec89012, 0x181117e1c77699f6, 0x186f2a27513f4b1b, 0xc082de611daa90cf, 0x209c0526fa0a1,
+0xcd535a62b8df1b05, 0x6bdd826ee6b966f4, 0x22e707591d6e5f6f, 0xc7ed537fa0d93d84, 0xb0f4a2db753cc9eb, 0x40ccb12f1be11952, 0x109237828ca63,
+0xa57c2448e7dc934d, 0x4eb6c5ca60c510d8, 0x9940f61e157a4451, 0x197e4863ef9dcb24, 0x40a2b6b55974d594, 0x62314ce13d637d3a, 0x8971819924f6,
+0x352ae021dfb3d6d8, 0xc1cd629e109809dc, 0xaf532d827a7ff9ee, 0x53b3ce69869d38aa, 0xfadb71fdd22a33ab, 0xff791e1769cbb277, 0x3bd5eac542d,
+0x75fc2ee2c71932d5, 0xdf52808e90717c89, 0xc02e74a8a771ed8b, 0x32e8a3d6a61f8531, 0x6558ac735283e33e, 0x42bdbe52382e210a, 0x1cbdadccdab85,
+0x5105dbe2e75ab723, 0xa98bf120584f52c6, 0x69bdcb8ac1587587, 0x5198d113d6a2f88b, 0xd572618f0bc422d6, 0x30e3142e615adba8, 0x4d45e8f26f0a,
+0xedbf95889fd68bbe, 0xf570a12bd96775fe, 0x1ddb30567c19c4b, 0xdf5d1e0d86cf9c9a, 0xc040320d9dbe3301, 0x517ac73512987542, 0x17f925a954a7a,
+0x3b98fc1774c7add9, 0xff02c62f1ec3fdb2, 0x1887002dfecb9e74, 0x3ee10d5a24fe9a9, 0x9ab1c64ac5450321, 0xac103a0a7f4bdfdf, 0x1a9f7d0f4bff0,
+0xcff4d132d3208d16, 0x72accdb4da1dbc0, 0x1b4627ec00d3d672, 0xe396cd2be20643f6, 0xffc12b4574fe5e23, 0x78f658ea96e3974e, 0x15b031acdef2d,
+0x51cd23cbcd614e7c, 0x166609f6137a8928, 0x5f200b2c04209588, 0xafcafbaa9196bffe, 0x802804af654fef00, 0x82855acba7859994, 0x1987ad2d739dc,
+0xf11c546a56549bde, 0x86a6b78bd12cf229, 0x5910defa329b5c8a, 0x10ab69f52ff05070, 0xa0c23e1c1b42c169, 0xaf787fd8ce458269, 0x10d92df917011,
+0xca9401217a52b693, 0xe2a8238fb362dd76, 0xa57071232f09999c, 0xd84eda4077581d30, 0x2fe806d32a055281, 0x27c06902fd88eb49, 0x16154912dfa2a,
+0xe417df0dfeca49ce, 0x9c71112ba5311042, 0x41d0c84895ead2bb, 0xd316f3bf9d98d6, 0x8fed598312371ea8, 0xe9db40357aa237fb, 0x1d205ab11bdd3,
+0x9e98107947a43657, 0xd4edcf3a503b8b2, 0x15e0eba73d6f4f2d, 0xbd3026a1460f83aa, 0xfe306be65a7bf2b, 0x2bcb71cc82fb7f2f, 0xc2c2a1788997,
+0xa72343d6f0cc702c, 0x7051869eb42492a5, 0x55422081e423935, 0x2d95174d7ab93ceb, 0x8677ab815f4f3e2f, 0x19ce146161c4b768, 0x114d729c0c9c,
+0x748f54a74220620b, 0x3e2c365efa92483e, 0xc86b992a9b000517, 0x7f6fa6cbd7053ee3, 0x699747d6b0e5d59a, 0x8839f36d729af436, 0xc4908f4abb28,
+0x9d4d862c2e94b430, 0x27b342b2de54641e, 0xbe8c955e54e93caa, 0xc2d4584c77647c65, 0x62d4b39101093e41, 0x26e1a3a194cccefb, 0x3cba15b6cd59,
+0x3ab86e8eaa4af042, 0xb7ce1b15b72a153f, 0x60c87649346249e9, 0xa7ac0caef8f25e80, 0xb3701a9f63eadbb8, 0x7442f9a412d4977d, 0x1fb109bde7c6b,
+0x6ac08d9a9c575069, 0x8989008982a59853, 0xdc7c271c6e3c6c82, 0x3765d0da760e7e2, 0xaf57becc4fb51da9, 0xd853ca552c005fce, 0xb8349eee646c,
+0x29b087d365ca08cd, 0xe1ddd95478e37df3, 0x3d336f13457a136f, 0x9ec91ac1fd587a6, 0x4da55a86aa7573e5, 0x75713d5419f3ce6d, 0xaccdcb0c0a6c,
+0x3cb3a10c779c1f0d, 0x3cde3169f1f00aee, 0xa7b8582a1b84d34a, 0xd84c2e6a3235e2db, 0x4257fd3aa1912499, 0xfa87a99cdaad5218, 0x20ef8d1bf12e6,
+0x5880ce75780c759, 0x9ee2e8c45916cb87, 0xd38e8535377b6e67, 0x6dd65a8f3ebc714d, 0xbbd57391888c958d, 0xe691cc2be0c04dc9, 0x7624e0c3db35,
+0x88685550905d9829, 0xb0ab7cac8cbb4aea, 0x8a3f8a0f97740344, 0xe4e427ec8697cc41, 0x3ad6e63eb1e42b45, 0x6f37103362a90aa6, 0x22a765a45bb9d,
+0x3020380ba9f58d25, 0x4aacf6c022bc76d9, 0x1ef038ebce46d295, 0x95d9ab37a16c7357, 0x489e392f30b64163, 0xa8dbc546bdcb4d78, 0xe72fa2ee427d,
+0xba5ab82ae49e6893, 0xd4676ca641b9d170, 0x88d501b3eaf62a53, 0x7b4db491f9d66d25, 0x518b5e9ef4dea9a0, 0x1bcd4bd9b07af42, 0x17d3fe6068ef9,
+0xda1552c3300996e3, 0xe9465504ad1e7d44, 0x779a315216c370de, 0xb7062d7a03016a0f, 0xcea1276622c49703, 0x943d38c0ca4978e2, 0x1ccb2e520b4f2,
+0x99d34875214153e9, 0x4e2c222a312d34ab, 0xb24e5ed6e3d55558, 0xa62d4db3c218a629, 0x9ce4c3a802ae0db6, 0xa0aaf06cd756f749, 0x85cdc90deb7d,
+0x9ce36639e181d2d5, 0x102d7789e80b3e12, 0xc795bec26c2d083a, 0x2b174fa1e6aeddf0, 0x5c931243ded1cb0a, 0xdb7ea600b414739f, 0xf48c258ce7b8,
+0x10a563bc0799b18d, 0xb7b5d508c55b7764, 0xe1e85be618413d0a, 0xa71b90a1308759c4, 0x39f9a751a84956e5, 0xc56b974c6aeee833, 0x179cbcdafc949,
+0xce9d967a2763dd23, 0x517503512811b981, 0x7ef41fe63ee4878a, 0x5b6dc906585cf40c, 0x67a4b0e83b03b060, 0x6297c74e428609d7, 0x169673296176f,
+0x79d91baac59d2d9a, 0xf751e435297c5a55, 0x124d3d21377a6b5f, 0x18f2c405fda86bf6, 0x44d747f7db961169, 0x603ae5ce0f0a34f7, 0xa508e4fa28d0,
+0x77d0f172509bc76a, 0xb7396dcef0007887, 0x46f842b2786c9f38, 0x2e03467076275948, 0x7415b50b992f189b, 0x1ed071dad8f2ddd4, 0x20cab1fd5ac98,
+0xd672726b81e8dfdf, 0x21ed32374883115f, 0xe024c2ce01a748a9, 0xacdf47caa7e8256e, 0x3d943e2339bb6ede, 0x79ce00980132bc16, 0x25bc0f529d09,
+0x8dc401ff39d84c4a, 0xd9fabac62f33afec, 0x7f7d9386d344deda, 0xbce6407988d7c5ee, 0x11d326a834ab5177, 0x6b36372e29421a96, 0x1f780ddee9caa,
+0xbb966860e146725e, 0xeac83567b34a2699, 0x8d4273fdad557c43, 0xf211cd7f4be95128, 0x7e0c7932ca4616a6, 0xfc7737491d8f544c, 0x1ba5ff2574f50,
+0xc1bfbc2c730bea10, 0x8994979d95244418, 0xdbc736f543934e13, 0x6931644710cd0fcc, 0x53594765dde2fa08, 0x7de78c0afff6dd37, 0x10e21d737d92e,
+0xdab2a6353104a059, 0x8928aec6f9cb6832, 0x4bc9bedc39611efa, 0x4e39a093e9876502, 0xc6610cf00cda113c, 0xc81b8dac5235a81a, 0x1f7fdcf920748,
+0x5fe8d10da0c51e56, 0x4ba0b1f8ac01cf2d, 0x2670446beb49d3b2, 0x6bacf536532928c5, 0x67f5b6acc22b37e3, 0x8619b5d8821a35e1, 0x4eeebe3dd908,
+0xa03fa7c40e434394, 0x40a5e969dba48988, 0x87c84f607b25ae71, 0xd9a22255feb13f8b, 0x6a8c99cca60766ac, 0x4d07170df92d21fe, 0x21071c04f8583,
+0xcd1737aaa2b6750d, 0x725565a80f084c0c, 0xe2992e29ff6d5ae9, 0x4d0c22de92adf012, 0x645f47ca716346ac, 0x8aba9887cc5a2026, 0x2f81051718ce,
+0x3e3bc46cc146ce6b, 0x6e434578501ea507, 0x720dcb9c506f9e0b, 0x72abf94414be6308, 0x960058331913e899, 0x85db8b25dba2715a, 0x52531cc74ade,
+0xe6b97aaadc75330b, 0x6981efb5d6faf8ec, 0x57e262ffb4f88fb5, 0xbf7cb86849478da3, 0xe7e93e17f0b7097b, 0x82f7ab85fb26ca9e, 0x8ec691ef319,
+0x76f41226dc8a3023, 0x7be200a488e52102, 0x487627195f3851fa, 0x4178ea05091b286a, 0xc5821d7bbbc8d1ae, 0x39e8a975376bcbee, 0xaeeb22142b4c,
+0xb8e3fb4b8368ead5, 0xfa2ceacdc78819fd, 0x8c7b0736a4f4235d, 0xdb39af50d758f37, 0xefab2a6c37eeaab8, 0x32471bf3e9437aca, 0x1698d34a2ffc4,
+0xd8cb20490aeeadfc, 0x160514a6333cc8d4, 0x66c4ed11824eafb2, 0x1ead3dfd18268ebb, 0x3244cc56fbe8b324, 0x584815729dc75ed3, 0x1d4734d17522a,
+0xadc0c5b0311150ce, 0xc10fd94070220aa6, 0x508314e212d291a0, 0x3af879ac7a9b1da7, 0xb2ff7650bce1f25d, 0x327a5d1f5691d3af, 0x4ae5a8774b2,
+0x59479f58397d7d49, 0x6e409f3b94c939af, 0x8199507be7fc16c9, 0x31d51a16516bb8da, 0xcf4f30a5246d95a6, 0x6d367cb671a8db5e, 0x19943e87ff1ef,
+0x58700fe8cac4ca63, 0x9dc551b810381fd, 0xdad8cf1b6ae8a85, 0x46198234d62c5a6c, 0x58083f4f805adab0, 0x33e7758b76eb139d, 0x219ba0312203f,
+0x2378553d0883296, 0x374d8a369299c50f, 0x5a5102aebd08d96b, 0x4fef6e565ee9afd8, 0x70f717498faffaea, 0x344aa97d4a2684dc, 0x22df590f526ab,
+0x111111c5d6e8c70e, 0x73205d6e7fe74534, 0xe78e88cb7d40cb9c, 0xc6776c03d6ceff02, 0x936b41a3e7137feb, 0xadcaf85d9cd4a8a1, 0x1acc44332742c,
+0x1b040a6fa884dad3, 0x6fa62d265d3cb804, 0x3721bfbea9d02930, 0x4622c73e864a66a4, 0x40177ce985caea31, 0x412a5f3a47589d2e, 0x11f95bdc06291,
+0xc921b91de3cf597e, 0xda6a4494e8417907, 0xd02a572fb5481324, 0xcb8cf2259585c975, 0x8465a624339b9ec0, 0x2b0d8854846d0b7d, 0x18e25631b0f8a,
+0xda36581d3657aa18, 0xb6eb424b2383fd0f, 0x6f56898ffcb6d08, 0xf510151fb1d2fe40, 0xe21e0308527dd314, 0x3d9d09b68e5671cd, 0x219e56b78403c,
+0x7911f91ea658c546, 0x1fcc760a2a8348c4, 0x10d508aeb222a217, 0xaae4ed65fd296061, 0xcf4e7ddad1f815b5, 0x5becae7595170a75, 0xfefca4b62a8a,
+0xcc63b1cedce3a0b0, 0xcd32d70c9b3cc30, 0xd5613ffc0adc8958, 0xd5701d8fcb0b23e8, 0x4224b275443b8d16, 0x9efd16964724195e, 0xbc4ac548acbc,
+0xc4f50564ab0a898f, 0x1191e0e421d96f90, 0xe60159dae586d25f, 0xa5b3dd9044641c78, 0x1439f6a2aeef7b09, 0xef77fc9113ab6b8f, 0x52d98b48b1e6,
+0xc0296d3a26804143, 0xa328918638c7f14d, 0x9322451f370bd88a, 0xb378e815d88404fd, 0x3e195c3426602372, 0x147e52a280b8f0bd, 0x18b80af265643,
+0xe3d5f491e1286392, 0xeec57984e505cb07, 0xbccbef38b85ffc07, 0xe98473cceab76bdd, 0xbe4754797996d075, 0x8629aceafbe19c6b, 0x17f5967eb3d10,
+0xc77ea246784008c7, 0xa2b1bf6db84a5c1c, 0x9a1c9afcb970bcc8, 0xde67b7b590f37450, 0x3d9560d64750e6e, 0x704172ac8e3edf66, 0xf99e60d19655,
+0x2e5fd5ea83be52fc, 0x3751690f7327ee79, 0x6094eb16e6a3ef62, 0x3041451b7bcecf, 0xf27b951e0c35d04e, 0xfbd66a2218a2b884, 0xb3ee9df5b50e,
+0x532c29ab9bf6c6f2, 0xfdb353c0bccd855a, 0xcd30fc3c736e9a4b, 0x815c38eb565db2ac, 0x205d9dc4bb5218aa, 0x7a8b0db654c38948, 0x1c2219941d8ce,
+0xa3741fbd0092dcda, 0x22c3f7fb72dc21c, 0x46dd9dad16d23e36, 0x3b72bac069050641, 0xbc644bae280130f0, 0x540dbed07def1b80, 0x167b430af9f52,
+0x50f23d831abf24b7, 0x26e347901c7bfffc, 0xfc5db45c94f037a2, 0x8a7c6f66d6f2d536, 0x7d404b6f01ce4524, 0x9e7e3698cc6e0186, 0x1c00d01f975cb,
+0xcfc706533c7faa3e, 0x6ceb70a0551783b0, 0x2aa686bfdc4cd8a2, 0xe3eaf13cbe53449, 0xb83089d50a45bb6, 0xdf8fcc3f84fc4635, 0x19cb36888f442,
+0x8b9fbbef36d80d82, 0x293aa45c6c735142, 0x43a0fa4a45587021, 0x144c3d66d94b9c91, 0x9b76ef6b0ed9b041, 0x32d4340e73054e77, 0x15779642f90ef,
+0x14134e274dc9518e, 0x5deb15fc03200c25, 0xc88fd08b75dbb4fa, 0x1280d7bc3e8007b, 0x6e4babe4a689e29d, 0xbadd64715caa192a, 0x1efe5ad0bcb6d,
+0x8fb108f66d8620c1, 0xf60ec3a62afb970b, 0xb6b08e8da249bba, 0x22d59ff0c4b6cf54, 0xd147b8d752ee84c9, 0x2834e8fc9ea7bda8, 0x13dff282fc31f,
+0x221c7dc2f170e1e, 0xe907323e02a8be76, 0x5ca00f0036f5eea2, 0xf3676abaf58f990c, 0x98bea9b505ee28ba, 0xddcb22a395457e9d, 0x93ff077d985c,
+0xfb09a9c9707fe8ff, 0x8c6821ea2d4438f, 0x41653d2a767f0345, 0xbf4ad8b076656478, 0xf035bbadf8cc5928, 0x8c8f3f9b86a43784, 0xe136c6b542d2,
+0x11f9bb2daa01d1cc, 0x8c88ce488b12e9f0, 0x59742d1f9616c39, 0x33f3cf4d1559e509, 0x2d585f5531c06dc5, 0x426efeabb9c617e, 0x14c6213924553,
+0xa894de296055fb87, 0x5db8470a2ca41235, 0xfef5b8443725d1b2, 0xfca66de405fec730, 0xc4c544bfcfe70903, 0x74ce0044e253eb18, 0x18259f34d009b,
+0xc3273ca14ae62f90, 0xe31e217f636b3e94, 0xa41c63c97c7965c8, 0xf8991686f607b1fe, 0xe37bc311f302b66c, 0xe2ef85d8fe6fe9de, 0xd1664dfc3881,
+0xfe2a6047fa56cb14, 0xd004d6a4ba6949a2, 0x24689eb3fdcaafc6, 0xe1ef935b69fe5c5b, 0x6cdff99fc1866c35, 0x212117c3e11f21e4, 0x79bca3ab78f9,
+0x82ff06210e3edffa, 0x272e07a6431efd5e, 0xe719b1822c5e921b, 0xa906001b221df812, 0x52e6585d606220b, 0xed05e3331f99e229, 0x579083aa0038,
+0xa5a8d86b67ede20b, 0xa1ab9a415d3b7956, 0x21406bcb91b09472, 0xfa67c9ac00041a39, 0x2915cf0356f4e49d, 0x18d209fbe1868cdc, 0x2294b0d723898,
+0x64876f654e6d7c04, 0xbccb83701ca12943, 0x20a2de6b9daaeb34, 0x38f1e531c16ddbf, 0x23cda4a436d885a4, 0xd67f834ef974d12e, 0xf3f16264b006,
+0xc634c4819a1ed8f, 0x632268feb06ee93b, 0xbecf722f1e15d90b, 0xc951162d2da8fb4c, 0xb02a1b6be8a9ab68, 0x9c324accccc8c38c, 0x1b695a42186a,
+0x8e53d97d3eacbb01, 0x1546816422e55f82, 0xded0dad160d3fd5d, 0x8249b64710ad203b, 0xfca69b2ea8e86113, 0x7aad296bb1437b7d, 0x125423b1330f9,
+0x20d09c6e72cd988b, 0x7c45b1482f489be8, 0x814f72e497d69701, 0xf60752d1b298898d, 0x964604d94077cbcb, 0x9cd9eaa6e497942e, 0x112abf87ca91,
+0x97998525a1819501, 0x459c01e90c6c93c8, 0xa8b8e81ddf6db763, 0xba53cfec2fc0f5ce, 0xdf7176fd363be960, 0xb013728a0a86f88b, 0x1961a9e1f16f4,
+0xa01f56e1bc9b2fad, 0xb200d63cbd95d139, 0x52f9434b25f7b3d7, 0xbd2730b3ccd71edc, 0xa383fea6e544975, 0xd826affba218ed80, 0x21c37e9697cde,
+0x5cf0ac83fd81cc10, 0x6a58fb5996e09300, 0xc4a8b9a5026bbc78, 0xdb4ffd8758c9ac1e, 0x4d901a7580203ef9, 0xf3854a32cab303c1, 0xa346d2a6ba34,
+0xf50bd24a6265f451, 0x1438e4f88f730315, 0x2fd34bc6663c97d4, 0xa08828572ce4ed9a, 0x991c7ee0e1606f2a, 0xdf7707d1e2b076ad, 0x21d55caa9a618,
+0xa290b78140afe7b1, 0x23818505115ccacb, 0x694b36b3befd625a, 0x28cbe7c658912120, 0x7dc7a4a6a651d12a, 0x34f95c7dd9654592, 0x2d04c95231e6,
+0x94408985df01b82d, 0xd7edaadfa0e53f14, 0x4a245907960db392, 0xbb226a43832ccb13, 0x7b277bf33de3d23b, 0xc4aedaa89eb73b67, 0xd21752580643,
+0x84aed6258a895c6e, 0x36b24217e57e7491, 0x9e6f1e0a51d27f06, 0xe4f5e0643e93d39, 0x3896a837dd4bc3a9, 0xfa18fdac49bbab04, 0x34ea6ae877e5,
+0x33859b01aeee6f52, 0x3e6c28a1cfdab7bd, 0xff41b32f6087dc0, 0x5f94844e4b94a5ef, 0x10cc9efa03a2d0bb, 0x959eb30749fe0108, 0x81bfc8457daf,
+0x131cdfdf081f53db, 0x6979ba1c8cbedf7f, 0x556215f743db0863, 0x2fe5b47c001773ed, 0xc7ca96a1a9315bd3, 0x58909895a541d216, 0xbae282285813,
+0x775578fd1bdca92, 0x88272c67bab07d2f, 0xd896d246f0265219, 0x71845808bb1d3c7c, 0x586b1e6a8d274b6b, 0xec8ea7d036bdf3c8, 0x12475e5fc2e10,
+0x2c25f80be532f0bf, 0x480ca4277cba5d67, 0x5222351a61023586, 0xfdeed78ccb7a4b04, 0xfbe2cc54b16441d5, 0x756e70dc57456757, 0xdec2aad5e24d,
+0xa0c0ec4b4d737d37, 0xea5469ffe97faa79, 0x4b6ab9e3d050bf12, 0x5f1bdac600257587, 0x2303eb6df5087b75, 0x32f5dd5b5b709c26, 0x9a2a273f99f7,
+0xa29181ac94b1e446, 0xb4507a34df67c8d2, 0x419edcc1eaef28bc, 0x1d0725abc6d1180, 0x90962d54d99a183, 0xf4a04f6e0861f527, 0x43a75a10f9d1,
+0xc37cd75fdfbef823, 0x3a447e2f584212a8, 0x842b6213b49a1b7e, 0x98acfbcf9b171391, 0xedeff0abbbccb1e2, 0xe48675f93a5a6e40, 0x205157aa8ec12,
+0xf0e84beefee4f376, 0x976bbbe58c04ed53, 0xc71ee97e1d58390c, 0xa0157b6595ef3976, 0xdca4b1a36d29ae7f, 0x393096cbfd785e, 0x165faea2809eb,
+0xe2b5425782b1c709, 0x5a0e93225581f2f5, 0xc6afd0ca1f073296, 0xf20a4939ecb9bd9f, 0x5beeb369d0d4e3ac, 0xc7196170a6a22311, 0xe0e7b8ad7458,
+0x78d2e8f5477c9f66, 0x9e451900b8fa003d, 0x84388e9664bb7e3d, 0x499426ae0f29c5cd, 0x920c38802c563f7a, 0x84766b4032c387b0, 0x9137423c16ea,
+0x4c09c2cd7feecb26, 0xbd78bc219cae9867, 0x6645c723632a6c37, 0xce89923cbf2b18aa, 0xfccb328b228b71d2, 0xc8a405a4d896d351, 0x8085e599024a,
+0x199293da44e807be, 0xcb78b30aa7814bef, 0x44f0b10295729131, 0x53d40f7ee4604945, 0x6735df28551efd04, 0x40360f86f460559d, 0x153769661bf69,
+0xe8f0c60d09c277af, 0xa2229bf38196214c, 0xd21da40dc4ddc39, 0xf1207d6d1f683b2e, 0x18ab7b5d808e6af0, 0xc33946669d157f03, 0x6fca5d7d06c3,
+0xfcf6671f79583782, 0xa1c418034eeab677, 0xdd8417afddb902eb, 0x16e9eda0389c36d2, 0x90c8c668534e9b60, 0x61eefea96d4e6d78, 0x1fcef76e65baa,
+0xd9379c3602efa740, 0x14db81fe5a32c517, 0x419b8b23501ebe3d, 0xa6d8ee39da5d0125, 0x56107a9442b7c580, 0xeaa6a10898ee23fd, 0x22efac42e1589,
+0x992694c146b577de, 0x910f1157bbb6981, 0x637cb38160574e0c, 0x92d8eb069447957e, 0x63ea8765cb69e1c8, 0xdc9e59adeaf236e7, 0x12d7dcc203d36,
+0x2f5ca0c247a406a8, 0xdde367bf0f642412, 0x58b8950278fb5185, 0x29050bf178ab4d40, 0xdaed76dcf5437f7e, 0x4ca8f29e78198058, 0x1063f8ed2ee7d,
+0x86399023050a95f3, 0x1c06cd3e959204f, 0x1a417a70ff5a7888, 0x2b66036dd80951, 0xcac6d940a116fccf, 0xaf420c1858c09dad, 0x73b6b8943d47,
+0x780751c820676000, 0x73b1b93d4cd8c6bf, 0xee11834c0239d4c5, 0x530ec664c771060e, 0x69748fb23fd55e96, 0xa25ca9f3d2189f06, 0x20683fec59c1b,
+0xde4a5ea5fa2f81d9, 0xc002ad25906f2599, 0x2a14d8ffc3179409, 0xce34e60f7eccc3e3, 0x6a08855db8783d47, 0x3d068c4ccbc0b5e3, 0x20ad586318a76,
+0x2cf9c3dd57549e80, 0xff75c7c5c8411d8a, 0x5ac86b4329aa1e30, 0xd4a1454728e83789, 0x88f9a8848737db2d, 0xee329a298c8e04a1, 0x1dfc97ff288be,
+0xc44dd075b441c425, 0x64b249a6e8d7a3a, 0xe5e67e0d973363de, 0x6e7e9b098493454d, 0x5b0c18272fea045b, 0x463cc69ff3b34692, 0x1993bd0e6a84b,
+0xee1fa6de91086385, 0xc8f6c815dc9fdd83, 0x18d35930930071a, 0x8bb5400b695d2444, 0x5bbe9b9caef40d99, 0xea81eb984a3a7f49, 0x187fdfd082fff,
+0x8642c96e0a0f7423, 0x3099881236819f2b, 0x8ae7354fddd18ef2, 0x439ce6ab3d6cf9b4, 0x66f8a04d57cef193, 0xff3d1ef9f313c323, 0x209a49a9953a7,
+0xd2c0525822004198, 0xdae5c772a384675b, 0x40f44a811963eee9, 0xabbd861605ea7741, 0xdcefe077ce54c34f, 0x4d23b045d694a258, 0x22e42d2141a19,
+0xa4f0d7483faf60d2, 0x6a6f1cb4d40d143f, 0x66148eeb6b606c5f, 0xedbda2a395bee5c4, 0x1503372197a90ac5, 0xdf6f45c1a7c1d74d, 0x705591839e86,
+0x78ca2ac4c3f1e83a, 0xca49e553aeb410d8, 0x65eab474191e2872, 0x48dab8fc3e04b8b6, 0x8d25f9bde2918038, 0x92bc39e1e29d960f, 0xb8e2a1cd357d,
+0x3ac88d95f7618ec5, 0x2a6dc1be54ac34e2, 0xff37422e49f4a09, 0xac00f7f0730f670a, 0x5dee116abecfc419, 0xfb421b04138d5d17, 0x99810ae942d8,
+0xd4a38d9831c8757d, 0x17181235735820da, 0xcd59e34a61783856, 0xdcb8a1a8584eb55f, 0x156cafba65d8ffc, 0x4d8cc567aa9d3de6, 0x64b26d614845,
+0xbfebb868b8908a57, 0x5237682f9b452750, 0x59ccf79af996fb66, 0xc05f593ffbf60426, 0xc182d64e091f751, 0xeb0eef94889460c9, 0x1b5e585afaa16,
+0xaf4504eaf9004591, 0x2b006a05b00a34e4, 0xefd876de36b7d91b, 0xd049e30bf624ec5d, 0xb75b8cae12fe3554, 0x43905a617833ca14, 0x1ab21f82e7575,
+0x5e5aba40b0755e92, 0xfa54e31dd2c7babb, 0xf1086bdcac351617, 0x9857616875e8e5f5, 0xd910cf2b26ebdae5, 0xad192fe2b19540fa, 0x11ad3befd8b7e,
+0xb0fdf69d713bb1ae, 0x261bf03fc8754389, 0x58c717a94cef47f4, 0xcc71361b2b72190c, 0x8e84160f4d0c766a, 0x8d95965e5c194ee4, 0x17d739e621213,
+0xbd01fffde11aa778, 0xb27962e71424f6b, 0x6ba13b290dba7505, 0x11575bb922a5bb1d, 0xd2859d188ee812ad, 0xb513104c55daa131, 0xcdb0c33d16d1,
+0x4db97b32c9d23c73, 0x3a7912ebe1a735d, 0x4642b9f531a42aab, 0xfaeb795595ddde9b, 0x35141cd0e10c2dc8, 0x6509aed5dc4ad1f9, 0x4975ff52c56f,
+0x54cd2c9b1f27435e, 0xe5b02eab6a9685f4, 0xdbea2f0b07b7cd87, 0x37652fa16f106195, 0x514a317b5d2acfb3, 0x3ed4f30082a15e51, 0x1efd0a2386f29,
+0x44a834a3112fcc40, 0x7bd749d227bba61b, 0xd3bc968f605ba7af, 0xf3027c9bd5575b5c, 0xd56412b1e7f54ff1, 0x54f0f45cbcc75547, 0x900793c26c1,
+0xd662fec058dfede3, 0xf4060b98bf632052, 0xdc200a8a104b83d3, 0x101ba3557c526449, 0x5bf0b9ec000e7d2b, 0x2836e9f6ffedd43d, 0xba08b589bc8b,
+0xbc6d7b4422e3f1e5, 0x4ac887b105365746, 0x6f14f3127b06bc27, 0x2fa0cea18de07e15, 0x6cc3afe76148e94e, 0x2981882a4a21bbe6, 0x10e1253bbdf8d,
+0x273d9ba6fdef2f5, 0x3797b562eb0acfed, 0xee3a7e08fe097f6c, 0x1df35e8e5f74a473, 0x3fac3333da7179d4, 0xdef05f6281bb0c37, 0x11e7366049019,
+0xc727a9d0bd4fb3ba, 0x8fda97671aaeab47, 0x734fabe91d3f9974, 0x7b544e38ea104f04, 0xbed803a2e8b86b51, 0x33b1fe3defbf3bca, 0x159c8d33c3ca7,
+0xb88aaf76de568515, 0xfe60cf2fd0bb0e8b, 0x2674f7aee2d45872, 0xc389d57f94b21eee, 0xafe0515a92a019df, 0x9ed018b647da85cc, 0x1ef2cd523a856,
+0x59765026552b9c65, 0xa91cc19bb8a6bc01, 0x43a8a2e8624f0245, 0xd29b1fbf5eef5106, 0x9123dd158a4c4f9f, 0x247c6155316ee231, 0x1573935feec70,
+0xa73d1e8550dac0c5, 0x934885e0fa9c6c, 0x16b19b95a92870f, 0x32172928e8ed05c4, 0x7ca36d2eef4219bd, 0xa8f47034c060b4c7, 0x15fa8e0f5812a,
+0x4e5e5de514c96f13, 0x2ac2c798bbf7b098, 0x976ee2f3d5641bc4, 0x74576c261cea95, 0x871fdc0176077f2d, 0x2bea33718adb38b8, 0x207b71701c5bc,
+0x50d3adc2ccb580a4, 0xab07618076260833, 0x18126a46026f52b0, 0x74fa761f2e4ccd0b, 0x4567554ac3f5659a, 0xad891ede812893ab, 0x193060a996edb,
+0x15c85, 0x0, 0x0, 0x2d6e659411000000, 0xc3e9279cf8657da, 0x4e9a9d269ca0a2d0, 0x92acd020194c,
+0x898e8f7686f2f4e6, 0xe21377adf1509405, 0x2c278c05c90d38f8, 0x9e033cfccf292cb5, 0xeb1c3830c73809d3, 0x64de17327298ff7b, 0x1e05dc4b6d8cc,
+0xc4bec107f91f33c4, 0x996427c326a97772, 0xc0e03517bcb6562d, 0x98ad773ab7356ed4, 0xebcf5cdb861c958a, 0xce0ad56a11d2eb88, 0xaa3eeb94ab30,
+0x2a996fe8b0e26a42, 0x22b982c8b0e3b81d, 0x67743a2ede3a6ecd, 0x557ce2a90fa81a36, 0xee9bc1843a914368, 0xc8c73b2fd103c84e, 0x14bdc02d59ea7,
+0xe858, 0x0, 0x0, 0x721fe809f8000000, 0xb00349f6ab3f59a9, 0xd264a8a8beee8219, 0x1d9dd4f7a5db5,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0xc4bec107f91f33c4, 0x996427c326a97772, 0xc0e03517bcb6562d, 0x98ad773ab7356ed4, 0xebcf5cdb861c958a, 0xce0ad56a11d2eb88, 0xaa3eeb94ab30,
+0xd56690174f1d95bd, 0xdd467d374f1c47e2, 0x988bc5d121c59132, 0xa84493d1d357e5c9, 0x8d2a9af3f6c76b3b, 0xa43524a6b0c15807, 0xe8432441d49c,
+0x15c85, 0x0, 0x0, 0x2d6e659411000000, 0xc3e9279cf8657da, 0x4e9a9d269ca0a2d0, 0x92acd020194c,
+0x76717089790d0b19, 0x1dec88520eaf6bfa, 0xd3d873fa36f2c707, 0x5fbe397e13d6d34a, 0x90aa24476a20a4d0, 0x81e48a40f2c20da, 0x53c162609a78,
+0x4e5e5de514c96f13, 0x2ac2c798bbf7b098, 0x976ee2f3d5641bc4, 0x74576c261cea95, 0x871fdc0176077f2d, 0x2bea33718adb38b8, 0x207b71701c5bc,
+0xaf2c523d334a7f5b, 0x54f89e7f89d9f7cc, 0xe7ed95b9fd90ad4f, 0x88c7005bb4b332f4, 0x365f072d6d634909, 0xbf7340f8009c8cab, 0xa1191c7e0468,
+0x15c85, 0x0, 0x0, 0x2d6e659411000000, 0xc3e9279cf8657da, 0x4e9a9d269ca0a2d0, 0x92acd020194c,
+0x76717089790d0b19, 0x1dec88520eaf6bfa, 0xd3d873fa36f2c707, 0x5fbe397e13d6d34a, 0x90aa24476a20a4d0, 0x81e48a40f2c20da, 0x53c162609a78,
+0x4e5e5de514c96f13, 0x2ac2c798bbf7b098, 0x976ee2f3d5641bc4, 0x74576c261cea95, 0x871fdc0176077f2d, 0x2bea33718adb38b8, 0x207b71701c5bc,
+0xaf2c523d334a7f5b, 0x54f89e7f89d9f7cc, 0xe7ed95b9fd90ad4f, 0x88c7005bb4b332f4, 0x365f072d6d634909, 0xbf7340f8009c8cab, 0xa1191c7e0468,
+0x15c85, 0x0, 0x0, 0x2d6e659411000000, 0xc3e9279cf8657da, 0x4e9a9d269ca0a2d0, 0x92acd020194c,
+0x76717089790d0b19, 0x1dec88520eaf6bfa, 0xd3d873fa36f2c707, 0x5fbe397e13d6d34a, 0x90aa24476a20a4d0, 0x81e48a40f2c20da, 0x53c162609a78,
+0x4e5e5de514c96f13, 0x2ac2c798bbf7b098, 0x976ee2f3d5641bc4, 0x74576c261cea95, 0x871fdc0176077f2d, 0x2bea33718adb38b8, 0x207b71701c5bc,
+0xaf2c523d334a7f5b, 0x54f89e7f89d9f7cc, 0xe7ed95b9fd90ad4f, 0x88c7005bb4b332f4, 0x365f072d6d634909, 0xbf7340f8009c8cab, 0xa1191c7e0468,
+0x15c85, 0x0, 0x0, 0x2d6e659411000000, 0xc3e9279cf8657da, 0x4e9a9d269ca0a2d0, 0x92acd020194c,
+0x76717089790d0b19, 0x1dec88520eaf6bfa, 0xd3d873fa36f2c707, 0x5fbe397e13d6d34a, 0x90aa24476a20a4d0, 0x81e48a40f2c20da, 0x53c162609a78,
+0x4e5e5de514c96f13, 0x2ac2c798bbf7b098, 0x976ee2f3d5641bc4, 0x74576c261cea95, 0x871fdc0176077f2d, 0x2bea33718adb38b8, 0x207b71701c5bc,
+0xaf2c523d334a7f5b, 0x54f89e7f89d9f7cc, 0xe7ed95b9fd90ad4f, 0x88c7005bb4b332f4, 0x365f072d6d634909, 0xbf7340f8009c8cab, 0xa1191c7e0468,
+0x15c85, 0x0, 0x0, 0x2d6e659411000000, 0xc3e9279cf8657da, 0x4e9a9d269ca0a2d0, 0x92acd020194c,
+0x76717089790d0b19, 0x1dec88520eaf6bfa, 0xd3d873fa36f2c707, 0x5fbe397e13d6d34a, 0x90aa24476a20a4d0, 0x81e48a40f2c20da, 0x53c162609a78,
+0x4e5e5de514c96f13, 0x2ac2c798bbf7b098, 0x976ee2f3d5641bc4, 0x74576c261cea95, 0x871fdc0176077f2d, 0x2bea33718adb38b8, 0x207b71701c5bc,
+0xaf2c523d334a7f5b, 0x54f89e7f89d9f7cc, 0xe7ed95b9fd90ad4f, 0x88c7005bb4b332f4, 0x365f072d6d634909, 0xbf7340f8009c8cab, 0xa1191c7e0468 };
+
+const uint64_t window_for_Bob[(1 + WINDOW_LEN_BOB * WINDOW_POINTS) * 2 * NWORDS64_FIELD] = {
+0x742c, 0x0, 0x0, 0xb90ff404fc000000, 0xd801a4fb559facd4, 0xe93254545f77410c, 0xeceea7bd2eda,
+0xc4c747bb43797a73, 0x7109bbd6f8a84a02, 0x9613c602e4869c7c, 0xcf019e7e6794965a, 0xf58e1c18639c04e9, 0x326f0b99394c7fbd, 0xf02ee25b6c66,
+0x9e9b172ccebd2699, 0xfad634346bafb7ed, 0x523d0eebf568377e, 0xfe7177912738ab5a, 0xb427810f1c76b7d7, 0xc4f34e9547c66d94, 0x147631e19131f,
+0xb05edaff821f869f, 0x405e93fcf37aaf8a, 0x952f22d726e00490, 0x6378458cef3f4fca, 0x624b345def81a97b, 0x338e1d46ec977c, 0x1e2afdfe662f8,
+0x5301e44a504a6e30, 0xbee1067fee0eb538, 0x5f4d3774a2a481b0, 0x2e11f327c97c8ead, 0xa4b5fb9e795af9d3, 0xd0bf76d6eda7572d, 0x79c5d8653a80,
+0xdd2603e6dd2c8c5f, 0x597fafdaf0f39f9d, 0xab9d29adb52fa498, 0x25500181f0260bd9, 0x47bbb351556f0517, 0x8fe9bd81624bd267, 0x160cc7a5d2577,
+0xdcb93d08b31adcb4, 0x72733c529271e858, 0x26d9ac14b16c8b7e, 0x8cb6972ea92210c8, 0xf75e9657f465cc5c, 0x9094a59dd5ed0739, 0x91664fc40c6c,
+0x50d017ec70bdf02, 0x4240b23df7d535c, 0xac816f6e5c3567a2, 0xdef51335a482e8c3, 0x65c70853a89a692e, 0x180a6afe7440390c, 0x2325e7e8286c7,
+0x9f0a022652fb9ee9, 0x148149dbfc514b18, 0xa94b00b87ddfd97b, 0x3584e21f41772599, 0xcbc484eca5ffa8b8, 0x8ca59fcd34f69b96, 0xf8482947b462,
+0xe2b7313e9597bec1, 0xa41c8f58671156e, 0x7bef1df523b1d28d, 0xc7588d0f1d01d113, 0x2220d5c6bf9a454b, 0x6aa8e35d36dc56f3, 0x203dd908d45a2,
+0x48ce69a684204c5f, 0x6890b34105861441, 0x79a6cfc81df5ff97, 0x5a611ebc6be5f5f5, 0xaf2393510d587354, 0x9a0247233b2793f4, 0x6c1199f7af0f,
+0x144e73be9d57d308, 0xc66f34e06563d83, 0x36ffbbdefb3a7cdb, 0xc67709cb4b1f25d3, 0x604439f8ad4d2448, 0x13ff61da28bdb656, 0xf07bf61e33fa,
+0xcfa833723898625b, 0xea8fbb59cb0e8cda, 0xb2071adee0f3c09e, 0x94a0de3eb22860e6, 0x2bd871dadbb26c0a, 0x9018f97566b4dd60, 0x1791ebbbdc469,
+0xcce857af52257518, 0x91e22a4d22832be1, 0x50541b050d0393c8, 0xae781b76368073d1, 0x3ba706cb9dc2c62f, 0xe1b00bff8fc08ea2, 0x1859ac53c36fc,
+0x409c16584946f957, 0x266b18ad8464a33, 0x7465d229f025bfb4, 0x50f19d4340eed33f, 0x10727e481a4af757, 0xa6ca603667bdf37d, 0x67248b96ace,
+0xc79c2e95b0990e03, 0xb6e1cf0b44b68fd0, 0xb54b135f218e879d, 0xff5ffa8fecb621e8, 0xf9ad74179a24cb0a, 0x15d5aebffec2b3f5, 0x86b2bf41115a,
+0x8007f45ea122bd12, 0x88efcf90a914e6b5, 0x422766c5b4f1ab17, 0x15ce5362096749ef, 0x6c697c437a6fac10, 0x27c9109192d4d99f, 0x1cf73013680c9,
+0x6673be6dabfe55aa, 0x652b3e8abaedffda, 0x5584dc1f919d0663, 0xd82033da8b76083e, 0xc9018e6d29e1838d, 0x2e143d4926ee033a, 0x563e7509f89e,
+0x45ccf7b1b6debbaf, 0x9ffd9e79beb368d3, 0x15a6f8662b6f6ba6, 0xae4e8a1d1abbecd1, 0x25596157f78a12bd, 0x1e26d75e87fb254a, 0x1a2afa2ec543,
+0xe9e5f07d89ef68ad, 0x49b4992f4e9370aa, 0xf16ceb859e6c7ba7, 0xb093677f5ef0d0a9, 0x19b4bab77c3dbfac, 0x904e3ae71b4f200b, 0xa7905ca7a7f,
+0xea0e2a3e08272781, 0xeb99031452fffbf5, 0xb43910d34507abe9, 0x60f00d27903cfdf1, 0x8b41fc554d5b3ee5, 0x23ca3364487d29bb, 0xade2097173b3,
+0x8032c7b7e9655a01, 0xd29837db21a198a7, 0x3cac5a27b0d5b34e, 0xdf3f3ac857f08b0d, 0xbf0b4ee45d58af50, 0x6406839484141ede, 0xe8fef3091c53,
+0xb9872fb73ae25425, 0x5a1d411a13bbcb9e, 0xcae8e2637d6440c7, 0xd9a6d2d6148af4dc, 0x77439eb830a7e825, 0x23b6ba4fb696a1e0, 0x189fa01117a5d,
+0xd140f4741a7da1b5, 0x84ea67ab317ded22, 0x7d67fcb42f3e6260, 0xe1e09a0d38bcc159, 0xac20151ed43ab100, 0x5df69603dfecd585, 0x3b9c9864c9a8,
+0xc17b66207c824e61, 0x247482f10c2cca75, 0xef55c73b0e683f37, 0x3c7430ae79a1c5fb, 0xdbb04e4c6afd2c71, 0x3eba0f5a831756fc, 0xfe6a02bf32fd,
+0xf768f4bcf68688b5, 0x6a4f945ccd169435, 0x28d7eefdb819d1ea, 0x5b293f98348225ee, 0x7eea9f2bbcdc6a0d, 0xd2d661ac7dd1f34a, 0x9cb999e3f81c,
+0xd127ec7aafa1e416, 0x8038c30f7ce0d742, 0xd824a80c1540cb71, 0x16675ffc00b60425, 0x5b90cab7c84fac88, 0x4dc2667ac4992fe3, 0x1ad164d1d8323,
+0x2f2be4fc56d7ca06, 0x8a8d5ef3894036fc, 0x7fbc3eac37c51a29, 0xd12a72e0d1c582ce, 0x8472d17aec650374, 0x67a15ae66674f34e, 0x19f67dca4fef0,
+0xc5ef79c7e67e9e6a, 0x3ecd672184bd348b, 0x5d31036812bf3102, 0x9b7f7a85d371f1e1, 0x7a0a53b12a32a233, 0xede75c0d06f2de0b, 0x1b84665ffe58a,
+0xec27321195e5478c, 0x64afcac4e78c947, 0xbd9e33fd861e6c60, 0x22928c66456eacf2, 0x3f25eefb5c4a92f7, 0x95bac09a465ce0b6, 0x77736a7bba3a,
+0xae5774a3292c9bc7, 0x58c91d93383218b4, 0x67b1f8bbb6df5a6a, 0xef7af2318d240723, 0xa82d699aa582a3a5, 0xef7ef9ae28dd5c6a, 0x1bb19845c822c,
+0xbce6e39c382b33bd, 0xc2198bc43b10c524, 0x9459ea2083281a39, 0xc2c042cb05b6c9a9, 0xd0beceffcae3f507, 0x6e58b55c855a84e0, 0x14ba0467b61ee,
+0x3c3136bc6310fc3f, 0xe53ed2a6e816087f, 0x752e7e7d56bb417a, 0x89252f3748e6fd60, 0xb0d23304b8444dc9, 0xa2ea3af1e553ce61, 0x3c48e1637cb2,
+0x4373f7ec6e60b180, 0x598f7d5fb4cf6c70, 0xeab277f8f63fb2b5, 0xfc3b99712fbb653b, 0xfac498d60e2f416b, 0x876c32efc1bdb358, 0xd1f36c8f76e7,
+0xb88e63d5c146eb98, 0x5a470694bd69f0f5, 0xe637f3908b7a35e0, 0xdd9b125bd8115bb0, 0xf7b89e78bf2d70bc, 0xd6033f060e82c4c, 0x3269e007ada5,
+0x369d1653e0961333, 0xe044201a5554dc78, 0xbc4d06a4b9d58ca8, 0xfb6b96037c22c3cb, 0x453b9a262378ea07, 0xf13962b8eff2d416, 0x19a157c61a18b,
+0x87b03af9db54bc94, 0x173438b05e3f93e3, 0xcf1346d22e1762b4, 0x16e2c4cdbc7d440a, 0xe5a5b88372faf8ea, 0x9b6de3ad1ee309d0, 0x52632e74748,
+0xf0844ed627e5970, 0x8feb193f7d88a917, 0xa31851ecebb6db71, 0x3a5d7aa0cff8a13d, 0xfb2ba1a86122e83a, 0x1ef7ef0d3a1f63b, 0x1e3cf1cb4bc39,
+0xd4de0dd4b0840579, 0xc5ea8d277f09e583, 0x6ba4a42174488249, 0x12d03384c506853b, 0x31b88f6fea49b3b8, 0x2b51eb79565023bd, 0x1054e73bd5b57,
+0xdae990681996ef2f, 0xbf6aeb69924d74a8, 0x68df13b7a5c4eb3d, 0xb0dfa66959f27b8a, 0x9ed0c0680c1b6110, 0x5624850b34006d5e, 0x8522cfe87f65,
+0x593e4d458a9decc4, 0x95a013f94d12fc91, 0x78589042f1fdffb8, 0x60a72144784f6b1b, 0x4b6278724a0f221c, 0x1c22bbcc98e2968f, 0x1062a431c2d17,
+0xb7e715156deb346b, 0xa06caffdf492188f, 0xc8adb4d32421d796, 0x9fb0f0b759976671, 0x9ac98d136bb0df4f, 0xd443dfce70be0b60, 0x7e05403a11a1,
+0xecb495ad0492f189, 0x14527d9c3cd4b4cf, 0x7dde5e8aa8d33c0, 0x63fe8e1f0041f551, 0xccfe1a2ecf4eb365, 0x1d2afadd15a3d0e0, 0xcd5983c0f19c,
+0x9122ea6ff2422b08, 0xd93455c27e1f2fe1, 0x2d6cdad7da303c32, 0xbd144c67594aa256, 0x4b786a1a3320122f, 0x17e7c4b317c46f90, 0x15733c30414d1,
+0x2fb21dfd5b9c94f4, 0x8099d2bf6ac680b9, 0x3519d2f23a8e2c5c, 0xabaf36b5540208f7, 0x1e153962f17984c6, 0x39d9fd2017211b81, 0x27298c6ade74,
+0x3afa868d04f574f, 0x8a3055462e574411, 0xf4ba9665537d44b1, 0xc5cb92b2b18c98f8, 0x5d8227b80eadced, 0x2f96ebedeaacf5d9, 0x187229affb64c,
+0x751555b792f8b70b, 0x8c4908fdafeaec5e, 0xd87edfda79a79137, 0x9e93b1d9d409de25, 0xa6a9ddbf8465784b, 0x373f1b2bea293173, 0x1a81cf86707a9,
+0x9d319294e9907fe4, 0xd1346d5e1ba8eb99, 0x7b2438ed03c5ed86, 0x931866856152fd84, 0x58e18f5ce2f7f98a, 0xd9cc76c0b80c0b2a, 0x1513831f6e892,
+0x142936c6e5a04d3, 0xd47ef9145a9b3fd3, 0x99c331f63f9e52c2, 0x9871538bbb4c9ae3, 0x8b08f28b9ee7ee55, 0xd83be0c51b257197, 0x8eb480eec371,
+0xfce9c651ae6d1cb, 0xce9cfa42fa37a47c, 0x64ac20842a9aadeb, 0x616e8bed0c7876be, 0x7bc25cc73a2f5dd3, 0xa59856794d4bb81c, 0x11a72f6e60c62,
+0x68ba46678ecd469a, 0x2eb614cd97a948eb, 0xd96934fad5afba85, 0xfcf7fe93dac205eb, 0xd7d1a14eaa29549b, 0x2f32eb8234d38c0c, 0x170aa17bf5292,
+0x7bf161eb8181204, 0x93c7106ea2f59d75, 0x35f6a8f70dd7afb0, 0xf9691959313bd580, 0x363ef16fa9fb7b94, 0xcd1338c154f42154, 0xd27c2ce30579,
+0x101701740434e8ab, 0x9bdf78e95dd9067d, 0xed94af22d9139632, 0x2d81f18e3d04398a, 0x462b6c17385d7250, 0x1e67706ca8f5a348, 0x40a9be93a8d4,
+0xb582a1dbdab30b82, 0x138b6cd39ca02d1e, 0x754660224d72aa06, 0x3a1dd0e5b2d1b854, 0xb7757870957c2d2, 0x85d109f6386373d3, 0x20f9f5fbe7d5d,
+0xf01e7bf228b6a546, 0xe4eef8a39350f50d, 0xd6be9d53c6fc47ad, 0xee5bc1c8d9831cd8, 0x92cc5fa7a9be7e5b, 0xa20848646922f4b7, 0x21ea3491d2edb,
+0xe4025c63dbc51add, 0x5344b199b3a6a6f0, 0xa266283fc7b232ee, 0xf8892120e0164f57, 0xd0c70bbcab31082f, 0x486e4cb627991d34, 0x16c45db9f2aa0,
+0xadc8dad223040335, 0xc4d49d2ad73b7cbf, 0x934395a9a89f35cc, 0x3821105d442b1999, 0xaeba30cf24ee7dd3, 0x24dd3b3128241572, 0x10eff9e5978fa,
+0x33fd3a282887dbe3, 0x99707eae4b4a45b3, 0x5cad7740f9c953cc, 0xc4b43db97177aa1f, 0x5e90b8f5db9c295, 0x538e7449c1fac4ab, 0x10e5ee13e89b4,
+0x49c2e98886cc44d4, 0x5428a143ff54a599, 0x53d0b6f2b02c3850, 0x724c17c4613c0e, 0x43bc5d201e837da4, 0xcfcae83be2128c8f, 0x183c50b1d3f26,
+0x8b920336598ab932, 0x7ecc8b8206fed68c, 0x5bd37ee416654dad, 0xd7a66d7741af142e, 0x476f7632d2c3f70c, 0xeb0f133c2d120916, 0x21cec26a739ea,
+0x3a4ccbed1bc926a0, 0xcc5f245796b43b94, 0x535c51c7582a4813, 0xc36dbc229c7ace6e, 0x790779ecd5caf0b9, 0x6a9d56f7af5893ed, 0x260939ab6033,
+0x29e11ac6c1d191d9, 0xb0e6185abc50f7d5, 0xb89c28349789ee7f, 0xecca0211d3ed9ff7, 0xf6a1ec801e3b5d3f, 0x8512a1163f5e1ca6, 0x53ace6d0babd,
+0xdf4e6418aa2d327e, 0x9a340f7613e584d7, 0x6384b1e89741c5f6, 0x2d1c6e1bb11074f, 0xf6f43a2a1e043b99, 0x24d40ba45c8691d4, 0x127f15ea6250d,
+0x7d7b2a9f6dfb23cd, 0x5367333c46f36f78, 0x7e1dd12ac391e89c, 0xa0cdb5814cb3a5bb, 0x3d67ab9de7ef2427, 0x88e4014732b51ac3, 0xa5fc3f8dad6f,
+0xdee5f59541975d79, 0x31757c881949c111, 0x50c4c46770718f81, 0x375816516d53f6bd, 0xaddfc1eda14766f4, 0x4f515e945ac450f4, 0x1ad3aa9eb00b4,
+0xbba087e8a07da7a6, 0xd29f4a2fcc51585e, 0x1f0159bc8254c9f6, 0x81fcdb8564925964, 0x5bee0e0a13631056, 0x1785e9e519d733ad, 0x3857d90e8131,
+0xb3a1fda098f59a3, 0xa78a6dcb79aefe86, 0x76d9301b190ab2e6, 0x9769042360fa1cc2, 0x4ed1e3d5891c8239, 0xfa3741064ad77da4, 0x12e0e3937fae,
+0x52149edb8b34137d, 0xaec9f6c30ca1ca44, 0x487c5fab1bb256a9, 0xaa6ef7558b2decd8, 0x412249a0ec3aba69, 0x5f6eec20c3cd1882, 0x22e1d1ccd2c4,
+0x5f1495453ed840af, 0x32f1aa42ebcb608a, 0x101499828bbcb7c8, 0xcd6f7602e3119b56, 0x6ab99e832529f480, 0xdb98dface1173101, 0x18bfd46f00014,
+0x301c15ae9fb76c7c, 0xeef62b173fc5da3b, 0x9c9befa9041dbdd3, 0x96b8d3670c076b1c, 0xac58f94ce61933ac, 0xc2271ea599d673c5, 0x3f498f7a19ec,
+0xef6a57655239ce0c, 0xb893b9da2eb5a927, 0xbf0e7af2edb78da6, 0xee21ee2b39424e6c, 0x2378ecb406f9f4a, 0x9e09ab36014b0337, 0x231bb74e18109,
+0xcbe8b6ab207ae9bc, 0xe273039ce790f643, 0x26dc4fc25df3e4be, 0x6428d691261e3319, 0x981078ed6b32f388, 0x9a4ef36f97051f16, 0x16a9550cbf7d3,
+0x756c5cc0d9d8ffc2, 0x540c3ab95ceb0ae3, 0x2d357fe16d127791, 0x79ed7752ab4acee3, 0x5dd33f15ff585adc, 0xedf9ec5856acd5a6, 0x19b35b0061116,
+0xa5ef9e0baea313db, 0x7961c038971cb665, 0x2527199a1c586c34, 0xffce78a2c6310914, 0x836d97a5e4e16c4c, 0x184b233a3c503e86, 0x700620c9bb24,
+0x604ebed3ac4ec368, 0x23c994aba5cb901b, 0x8f57086a32093b55, 0xd2d858457ddda233, 0xde92fb46fff680b6, 0xd482df4dace7eb4b, 0x3cc2bcf2a665,
+0x4b322cf51f58a918, 0xc7eed0908e6c0062, 0xb4d41ea8d623b8f1, 0x5dde71edd1e4cdd8, 0x4082e05c8cd7c654, 0x767c377e511b069c, 0x2228c74789ee2,
+0xa499cf56cd8e904d, 0xf1edea6e04225777, 0x96e607153381c861, 0xf91eb24431b2d81c, 0x602806b38560d321, 0xfc052fde52e309e9, 0x92464d9dfc0c,
+0xe6c78ae866fc1b54, 0x230349531d26765f, 0xd8a7243b4bb26789, 0x9b1906ff348c6e1e, 0x22bd9661bafbd3ce, 0x95668c7677adf8a5, 0x171ea22493644,
+0x82054d489375b737, 0xeeffc89461d7680a, 0xefb5aa868b457ad1, 0xbbe32ca5dda06c96, 0xa9a5a56b2f944418, 0x7ef26bd2f5a32c44, 0xb002670ff8a4,
+0x5b6c71a0d3e2ed2c, 0xc0db5bac8f65c62d, 0x93985628aa5bd727, 0xacd5e8deabbcac40, 0x45d29d3d54db6e80, 0x1d3a6f16b1fe9721, 0x136e8b7c9ce07,
+0xb83ee6de7cdb9c95, 0x9b75d6ad37e1b4ee, 0x9a1a37f74033702d, 0xe7bce4784f776e8a, 0x68291f96cdfbe98d, 0xb8eccabcba4a0318, 0x1323d92f0878,
+0xa40ddec52412c019, 0xf230e4c8c85773f5, 0x5a4e9acda1263b57, 0xf45f80a1657af782, 0xe2276e0a60edd2f6, 0x3d9b57adde2151ce, 0xc8c7acb5e23d,
+0x790d4d87ba14b0e8, 0xf7e1139257a6b5b6, 0x4b7aac4434411250, 0x2638352c1d474a1f, 0xaf339fce5694bbc9, 0x7aa1db62a932ae2, 0x15b34b89f535e,
+0x38ea76512335ebc2, 0xc82a46b9525dc799, 0x4a996ba45b568f65, 0x5dd650489595a718, 0xd2fc1d0138b757c0, 0x4143bb6d9840aac2, 0xaf5a225cb39,
+0x5bfd62797133d20f, 0x270ddd65f2c40919, 0x7bf15611a0bdb507, 0xde8236b3545b89b1, 0x76e2757c184a5a03, 0xa05a4a4df7487141, 0x1a03d40f04a10,
+0x63c2b8dd028c8fe, 0xb00a010fe9360bc5, 0x532a83230bb65481, 0xb36bf88d0a78e2cf, 0xb8c116bbe64baa7, 0x6638781d1e032bc6, 0x1e21f02f92699,
+0xdcc30cc523344009, 0xa478cf6833f21cf5, 0xe336370cfb7cab7d, 0x1aabc726c8b24551, 0x66b7f1a495585dea, 0x37f4a777668a9fdc, 0xab63dbc7c1f0,
+0xab33857eb985c5f9, 0xb97e981648a4d04a, 0x5851b755fd589dfa, 0x5ed7aeac182094b, 0x58380fe7843b95fc, 0x9de841368423ec, 0x763a55de5f15,
+0xc9b6c05b91248d7f, 0x94e545287640c6c3, 0x7a70a7ffe783c2c0, 0x97a912184f173941, 0x4e4fccf358a571fa, 0xd74c13e28caaa1b6, 0x17743024cccef,
+0xdeb7dc97c413dd8c, 0x787365126206427, 0x7d5c85b7a4355137, 0x1d2cc08695bc41a9, 0xca7538b4c7649291, 0xa99299ebae7bd499, 0x231a707af9650,
+0x83ce4f4a65e584d5, 0x1949cb04d7e22f97, 0xa3737efd56498886, 0xc35de2d47eb39020, 0x22243f24ab46ea3a, 0xa82dec33b86dbb7, 0x79bda1efc864,
+0xe6b7b3e87f566df6, 0x3a270cd55187101f, 0xd6c02688aa982a84, 0x8f417a491336dc68, 0x4bdb51043ef0b2f3, 0x6535b30b154caef1, 0x1e5a1885fdcd2,
+0xf1f1667c1a3feb0c, 0x40f099553e5dadc8, 0x5072d16a56f786f3, 0x50a0618fe3f3afca, 0x3bd57c0becaad38c, 0x1579bd819b261def, 0x1bde7728d8147,
+0xe1c12e8323fd7a1f, 0x56c8c4bb112b9e90, 0x2812fb7ba10f1403, 0x6ee68767294b4871, 0x871288683e4952e8, 0x8d5183478965eb6e, 0x22226ebce837a,
+0xe60ce8d20ddc684a, 0x71990361eb03429c, 0xbe91975486d57548, 0xc1ff6ea3103e5af3, 0x8587faf678f967d8, 0x7df84f360577d781, 0x182689ace7a1a,
+0x3ed6bcc1c4519d95, 0x160826241c2bcdf0, 0x722c2c6abb09b871, 0x27dbc52e392b93d9, 0xb2369d9e80af17a8, 0xb8c8153ff62be305, 0x7c06a733812,
+0x73832b01f952394a, 0x9c8f4d22d9d57bd2, 0x9f13392b340e8db7, 0xb71f46626a276ec0, 0xda166b4792904186, 0xfdd59b4b7fd6127d, 0xa72e42649cf4,
+0x1d088b43f3f9d83d, 0x9cee96b61c518787, 0xe479fdae93b1fd25, 0x8728e69966e18af2, 0xd7db2ddb7fd26744, 0x1276fe015ca0e327, 0x1282ea6ddcfc0,
+0x3ad6b49759030f0c, 0x8b2e80d2f16fbd51, 0x1557388ee7065ced, 0x8f880d834c9e8e08, 0x9bc41d5f923abbc0, 0x6c0c61d1766d7947, 0x1a490a177b72c,
+0xf327b0d256be52b6, 0x3804ad7095c2beed, 0x81c4c0350dc591f9, 0x6af4aa6be93e3b56, 0x96e93ca3a24526ee, 0xa4f63b6d0df90f49, 0x223308413fef,
+0x541f7c8614fb371a, 0x7078455fa2b4237d, 0x944b549366062f9d, 0x2a053148f97ef9dc, 0x7eb4c96a4ad31e0f, 0x659e4027f78498ae, 0x21ff84b596a5a,
+0xe75b701003e8bd55, 0x7005b61c25a27cbf, 0x2cbd38b0b3729960, 0x6ecc65ceed263645, 0x1fac54aae481117c, 0x61be903eadce8346, 0xd54db4c4af7c,
+0x6ea17d8b408bfb5e, 0x53b289e805ef50b1, 0xe50f5f2b31d7963c, 0xd16f39ae14238430, 0xa91d5ad1003aa06b, 0x3c5ba3fd90516368, 0x1fc08a7b936e6,
+0xc3fcce190f3a7020, 0x67806f0c2fab287b, 0x45a15e90f89f2cb8, 0xd7a2c0743241f1ad, 0xbf7cbd13a4c5ace7, 0x94fe8c8cd3daa4b6, 0x194e60e198f98,
+0x484e5bbccd8a35f, 0xb80ead2d6739277e, 0xd645430896707ac6, 0xed8032c21835100a, 0xce9a2f4374d57e13, 0xcf7e40a954f63a14, 0x1e574a4a1a270,
+0xca0844452c9989b7, 0x5bb7e124a7fe4d50, 0x64ea2c1f8e785892, 0x84e9f3e1ed7f5900, 0x95c00989a7e76a1e, 0xc4372410180fc447, 0x1c090c38283eb,
+0x4d7aa7360d1af1ca, 0x40e5771c394ddfd9, 0xa35d32f4c76e2a76, 0x2a8f79c52bc94711, 0x745e7340a5b6bcbd, 0xcbb3447f0a493538, 0x1afca4ede3452,
+0x3551cb4fcb6ecc9a, 0xaf9792029de4e04e, 0x5377e4bc548bee74, 0x2bf6c22dcc3de16, 0x371bd4ba5785e144, 0xa3e23243eb8d55af, 0x2abfc67753d4,
+0x3bd08618ce55448f, 0x970174ce2e29bcbd, 0xe0f6a4ef1db518b1, 0x24df152f3d4cc15a, 0xb5442f01c3574301, 0x953339c74050da31, 0x180c6761e9aab,
+0x552704327223c03d, 0xa144f03333a4c10b, 0x322adf115a32aabe, 0x3f143c4c8db00310, 0xc624502b6007be00, 0xd916861511e05d38, 0x1a939fc1ea48c,
+0x1c9de874e25d16d0, 0x18184b7d0a96fe29, 0xc55c334710094419, 0xc2d8611a87246a97, 0x9fdc0bd6275019d9, 0xadea77d9f24f17b6, 0x1c8d23e07d34a,
+0xf86d54d8d381f3c1, 0x608d84a4fe05bcce, 0x87e72e81b494bdfc, 0x603f6df4b111d9d0, 0x4351da9073ed4079, 0x7d39e3453a12b1da, 0x1f2f2c259206a,
+0x8ebb5ff671ec8d70, 0xdeaedfb72ceaaeb4, 0x5b17760197447811, 0xa79ff1fb4a7b81f9, 0x3187f62957201114, 0xe89813041da1bdda, 0x11b5e499da7ba,
+0x670755a5fbfbe832, 0xcab7c57e5d45f838, 0x3a2605eee805a7d7, 0xadfef4605e7f7e7e, 0x7c5c5227154ea9c9, 0x5c669bc7e2be9ced, 0xa3be3e2323f7,
+0x7e64d46ea5b2fe40, 0x311c105ced1cc078, 0x3fb8961891be1b45, 0x5112a178c0c15e96, 0x534571812bff53d6, 0x2634ad05c49287ef, 0x8695aca9a579,
+0xc4c15d490249669d, 0x32aa52077bc741ee, 0xa70a32f6477c1f2e, 0xcf730741e1317e18, 0x1f62f9017e5b8263, 0x9cb2674e6103749b, 0x2223d1f3be6a6,
+0x84b8bcee0c41cf3d, 0x46cca969ebf26030, 0xa81c64dead6785ac, 0xedb3f65f4c79eb6e, 0x7bbcbdcceb1e93e0, 0xa2449410d9399728, 0x2235faec5f075,
+0x93677d561237df09, 0x6e8623fb805f5331, 0x2fd99622de1012d5, 0x46f2a142e50694e0, 0xe4b8f30672f55952, 0xc580e6105c87730, 0x7cc2511f49cc,
+0xa8278e233823a318, 0x48941af395499aa9, 0x9d0c59233c49c08d, 0x2d6a489e49188c3e, 0xf766d0636f2fc7a7, 0x5c964922f0a66f98, 0x60603528acd4,
+0x45a3aa9f17ce6627, 0x8076178b97437876, 0xd33e9d240e79b499, 0x51efaba90401373a, 0x3a10be8a2eb49cdd, 0x24b35ee1f198e098, 0x3f9abb7ee6ba,
+0x3d88686867ea825b, 0xda6f378522406a3, 0xb0354856df6c20cb, 0x72b9666d573b7e7f, 0xac0f801d9ebe96e4, 0x8d25cafd1ebe3a19, 0x258c53b73f9a,
+0xbbf8144e58394803, 0x1ab77df67951ec92, 0x56df6fbdee317bb3, 0xdd126d0cbacb840b, 0xca5b24e79d98cff3, 0x19fea1e0d423d202, 0x1aef45135b311,
+0x76b4117473f394a, 0xea663cc29b883b, 0x57155ef930da43fe, 0x9a977a313c635183, 0x4ea03201d86c2730, 0x76565d6117034bf, 0x190e3d7dd31a,
+0x65f71bbabe0e17b6, 0x163c77050297970f, 0xa4e3479d2fb55500, 0xea44929d4731838a, 0x748cdf3693c05cc4, 0x7fbd345462ca3533, 0x11e063e90648d,
+0x487c26cfc6835f54, 0x2d70961523dbbf7d, 0x42051211eaf6fe4a, 0xbc0d69af905f1979, 0xfbfbca5b1978eefb, 0xdbffcbb84bd5a3a7, 0x13ce4526cc047,
+0x55be7dc25edcf2, 0xaaffc89b6ff3ee0b, 0xebb085fa1a2a1a12, 0x595dd523bad2a4a2, 0x75be369f3c403bd8, 0xe9b4d7ced806ff4f, 0xc787a7081261,
+0x1a2ac586adc950c, 0xbb4b111d83b0d821, 0xcdeee4a1e1aa8453, 0x4664bb9e58b329c4, 0x7384016533c0030, 0x342f12d9ee6c3088, 0x1087c1af20aa7,
+0x9d38ea49dcecf7aa, 0x12f4a892129859e0, 0xbefa26b20bf1f905, 0x2ece19a55c85ff30, 0xee5521eb91e817f0, 0x4523580daf0a3942, 0x1566e545be3b7,
+0xfca61b3d38eee450, 0xf15ddaf659b671e0, 0xcd27e4c146a0af90, 0x57218a54bcd3649d, 0xb15cd3882c802d23, 0x2b3f029881261550, 0x2248fbc906a23,
+0x745e19148ce78ae0, 0xda686c4f0f10fc73, 0xb3c242663c97bdb7, 0x4e96c67e4da73, 0x41991e34de1a2701, 0x80e73857db8d2531, 0x213b1a6d60c57,
+0x70084b30fa5a213d, 0x49a317e31117fb12, 0x875c561695cfb2e8, 0x4ab797416b8c44f9, 0x9aac6ea3172f0e98, 0x90313ba650b8e8ed, 0x19b6a33365584,
+0x273a9254dbd027d7, 0xe9c4373ce557908e, 0xe7ab24743c32c88f, 0x16fdab264382478d, 0xb206ae701920dbdf, 0x3a4480dd7dbfc69c, 0x165a8bdbbc6a7,
+0xf47e85860065420, 0x16b242eae8667fec, 0xc1a96d1b36ae4ea8, 0xe150f19c01d9773, 0xc557f2aefea2955a, 0xfcb47da18674b911, 0x6d713924b76,
+0x3b8ea194f23a16aa, 0x4da68171e770500, 0xa88e07cd712923bc, 0xfa3bdcfdf5f4f5c, 0xb5ce32a4ec387efa, 0x1404c1fd6b9d4599, 0x1de5a87694ad3,
+0xdbff0d5a7cedc536, 0xbd1b90fa58474652, 0x78403355a3196ce4, 0x683c1385e8fa0ca0, 0xa42d4451a03fd017, 0x33f002305e255a66, 0x1e6554b7259ec,
+0xda378e1526e87d3f, 0xe38ab4cc5a9b283d, 0x80e98cdb405ab3d0, 0xbbcd186f6e8e5b40, 0xd938730ae33cc2c3, 0xdb518ce6f96cbf04, 0xb06db99da179,
+0x4559202811e5975e, 0x6053b9a8558e97f2, 0x9212c61456a12855, 0xe3debc380b05d1f4, 0x4d372836a2f3f7af, 0x87fbb38ebc4dbcaa, 0x1e8aa7cbd1fad,
+0x3eebb6d5e5fc3d02, 0xc8789f427a27b7e0, 0x4ef1f03900305a38, 0xd5c4a02f3fb3dee4, 0xfc3dab0429e390d0, 0x8e2e376669d11f93, 0x21814c37937d3,
+0xb4606b7daa24e39, 0x9fe4327ad8a956c0, 0x425066320374faff, 0x9e0fb3b36fac9638, 0x7f5bf4a1cc42d32f, 0x8ea3c19f311526d1, 0x15d27556b3d72,
+0x6828949dd00dd649, 0xff9f00b0c19c61cc, 0x50baca66f18f0a4e, 0x2db200a1ec0a762c, 0x1b384af329df1ad6, 0xccf9a5231c68ed58, 0x3f68f0b9f859,
+0x3762772982675423, 0x2f8c4b8c5db7a907, 0x6b5014cfe8710b31, 0xe7b036a0e87daa92, 0xd542ad9be3116c6a, 0xab48286cb82570b8, 0x56c374d7840b,
+0xc0f22e6a6f2ddbf7, 0x999e3b5c69773131, 0x491d7a7b71989158, 0xce84e12613249d5a, 0xb26029a8fad78289, 0x1a839df7439c1ff0, 0x7d10dae45299,
+0x3af88b5c5643fbcb, 0xe6e0216fd755ee58, 0x4752a6d65ee20e73, 0xb4e21b987a2c6824, 0xf2089447b930cb23, 0x9df5449b587f74d7, 0x156f8915b224b,
+0xa115375eff25a9b3, 0x1b916d864fc37af5, 0xcb595b4663793c14, 0x7d1c185dd0a8441c, 0xf2c9aac21310f302, 0x1671f639a2cd1837, 0x21c6fbfd1e5b3,
+0xbf10530da9f6732e, 0x51b78ff8d836a8c9, 0x2c352fb129bf0a64, 0x534815deb2614d44, 0x2ec646b779cba616, 0x3547866910e86185, 0x23ddc5234f76,
+0xb29cd84c6e0e427, 0x5bb26dcd4b29c0b8, 0x402208836bd4e524, 0x8b9d5c9e59d54818, 0x913e7efd15e1093f, 0xc690eaeda13b181c, 0x1afc9cc5a07d4,
+0x6d46238d98f22b68, 0xb5ed4cff122d8cd9, 0xc0a2e4fed8515c14, 0x14ae426ce18e40d3, 0x76c0c296b9b3cf4, 0xc9933389c14acd7e, 0x180c019c0ee55,
+0xc45ee66dccb58e80, 0x97b2d217ac80d4ca, 0xb5fa3af9b7378f27, 0x6ff956424b1d8eed, 0x984d4700579df7de, 0x818557499bb888bd, 0x641b2a81da58,
+0xe7b1ed74ad119092, 0x7a570ff5b3734d12, 0x90aca00a183c8c73, 0x4062b44cf2cae3bd, 0x19b6fe783afdc343, 0x46a8bc027c185691, 0x6caa77b045b0,
+0x524192816d542e9a, 0xe472fdd140331796, 0xb1aa3f60c59f71a3, 0x4997d07c1e4ec1f, 0xc0837150b044b9be, 0x9fd398b1b65b2658, 0x1116a93c3e146,
+0xb99a91e4047b0381, 0xc9fa09cf3720d661, 0x8620e55eae2ae9ad, 0x647c8d7857931bf, 0x1e677f914575462a, 0xd2ef0e65f3cea67a, 0x1b248d3bce56a,
+0xa09388eb4737824, 0x6879e2ccf0ad47e4, 0xa7e4d76103963382, 0x904409653a06311a, 0x8c6efa251c92f36a, 0xf3114f8dc54bc74a, 0xb5f2d2e59a48,
+0x61a661acd7834ee6, 0xca1628d97862cf9d, 0x68dd35dd52e0b355, 0x1f0de7ab615c47f5, 0x53c0c503a295a1ae, 0x62e798642aaddc06, 0x147ffbebf9d25,
+0xfbe03ced0a17493e, 0x22e5429ef0de1ea7, 0xa0b7fef8bfb342fb, 0x7e8ec9a2b2e6037c, 0x24bbe46bd5876bda, 0x740b18a5f68bebaf, 0x962ddf6dda9c,
+0x5db265c0d172f7fa, 0x6f8b3caeeff40ff9, 0x1c85730b15855413, 0x6f04ff6b0192af91, 0x17a183c71458e4, 0x85acda48bac98044, 0x10e12a4faf97c,
+0x7d4ca942c32e6dbc, 0x23fa995da7ed8d07, 0x81b4bc23de8c3de3, 0x4a8d5c1fe54aed69, 0x1a5afb0996b25e5d, 0x7e869663af06d863, 0x52ad87d43703,
+0xcf99284871571d15, 0xab64c0770b2674b6, 0xc039c2c16b445e9c, 0x23cc0aa659850ff2, 0x9b45cc9d91f731eb, 0x693ae1b3d75c0c1a, 0xcbe86ecbc958,
+0x64e0d3c3f06bde44, 0xb64ea350abb29146, 0xabffc3ff1e14aad0, 0x508950252866432f, 0xe40cf4e902f279a4, 0x943c193f71c1ad44, 0x1b0b2fd24f91,
+0xa7e4762fed093cbc, 0xa98c1d7d38a5e8cb, 0xd7c22735a0b06c1e, 0xa70b47af30000967, 0x7e94d6e1bf47213e, 0x6d591c514eb01f12, 0x76b62d6e9391,
+0x551ddff2fe323a3a, 0x453697c4c5abd6c4, 0x3c34341ab74820b1, 0xfedd75131bcf4de0, 0xe29f4060ea563847, 0xf45d961ec88e716f, 0x1fe8a6fcfb976,
+0x83ba1d257fe9f93f, 0x394edb5e4fb16f43, 0xd62e2e58abd8782e, 0x97be9c71070d9da8, 0x3aede318f12e8c79, 0x3191efbd4da7e55b, 0x5c49fccd31ca,
+0x754d62e04725c6bc, 0x43db757bb4665777, 0x5de8fa683c26bded, 0xb717adb2c2316123, 0x26ea9b8b10d2f66f, 0x15832126ea93fcb0, 0x132088d3a352d,
+0xba720c83aba971d2, 0x856528ee0f79b2e0, 0x1d327fba95d06b4b, 0x62949419df7b1a79, 0x5b810365b57c016d, 0x2cb3058f4c689cc5, 0xdeaa780cdab0,
+0x332fd14d23062e8a, 0x94ecb6cc1d731e0c, 0x73bfc2cba238d81a, 0x43ca9d84140f3f36, 0xa45fcf722787c793, 0x4ab36b9f47e1bff4, 0x548b88d735bc,
+0xd067008a3b3e17de, 0xc70ba64c7023d1b, 0xe8b106172078cf2b, 0x22efbef8695c053c, 0x753c300d6621c0a, 0xe0c6389d1d601bcb, 0x713590d10955,
+0x5e0aa314b708976a, 0xecedf14e9dab9467, 0xac7d842ddf829eb0, 0x5b26c0634b510862, 0xf4c67b322e4e91b9, 0x46e1f3db235b5f80, 0x21378cb0891f,
+0x241b3752c35be0ef, 0xd6268926220435a7, 0x6fb2983b3f2a40d5, 0x9a8f43ba8777864f, 0x983e435a1a8a1184, 0x4aff7196d5d19e9b, 0x88ce8172fd89,
+0x8487699aa4b31c71, 0x32223037bd35e8ff, 0x3e2729524413c599, 0x655789b91a74726c, 0xdf93e3a6461a6e54, 0xcfe72ed1beacf1d2, 0xc1822d949984,
+0x5e6c7453bce3f233, 0xd2076f4c3f6bfb3c, 0xad7fde2d0ed1e223, 0x1bd4daf8fe0107ab, 0xf9bb36c6171d281, 0xfb981255f5de499e, 0x4847b6123631,
+0x627cbba6de784115, 0xc0ac7b7951a052f1, 0x5b6fd9551666bef, 0x8e2d0b9856551eb9, 0x4d1404716ea5c98a, 0x310a602ffca8bda1, 0x1402c3bee4d52,
+0x4440acfd973856fa, 0x7bbd8344f7959e24, 0xf0467599f22743a6, 0x30d3046290b92a33, 0x93ca238ebd2607dd, 0x84cdfc44610ad102, 0x1e8fd07b7429b,
+0x9254065a6f545ac, 0x6497665e63ff30a7, 0xa2e0009b6ee1e574, 0x5e271208d6a2f938, 0x478fa7b401c40b3b, 0x215640d34bd7cc4a, 0xc350789984b9,
+0x961d123c74ac63d0, 0x5ac392e56b220224, 0xbb55a46f187ee750, 0x70a57bfeaed8a7a6, 0xcb5691edbbf0ab4b, 0xb80e26ee8026b8b4, 0x22444a804694b,
+0xf61dbe194d689517, 0xc9afd68bcdcdb654, 0x4fb469c43d4d3846, 0x4a45a17ff3146910, 0x6f1521979ad4d22f, 0x2053d7ab121690b1, 0x2762ad64148a,
+0x96ad80564e8bdf76, 0x7744243c192897e8, 0xd88ec5bb3f8c648c, 0xb5055d0feab46aca, 0x6ebed87784d07b45, 0x39d64b64ef7acdb6, 0x19c6024208afd,
+0x9f1abdd6a6589bae, 0x15d31c630821eb4c, 0x1fb0e1d5272f8401, 0x746d664dff2fc554, 0xd6632ad19c672eff, 0xd74cd75862be3784, 0xe79058db6e5c,
+0x5abc829463ae464, 0x8b64325c956283de, 0x318d8a3f296380ae, 0x103792b72fe5b218, 0x1f7f3a31a2f2803d, 0x42eaafb643136d51, 0xde61623b9d83,
+0xae789e66cae3ebd2, 0xc4b17314e2f6e9a2, 0x930cdb9b67b90bb2, 0x6359a8139db6161, 0x34ee1a83f007c489, 0xd36d6f810917d378, 0x137afac621823,
+0xb38f930e23cf03a3, 0xe6ff5f3bc51c6a15, 0xb971238b7fce905a, 0x1b74399ec6755e42, 0xd8caa53d06cf7b3d, 0x3b0c51a25e2a3187, 0x15d402a494878,
+0x3a183df11f650f59, 0xb6c29d279c3286fd, 0x319bb2872c268b06, 0x14f723af50358740, 0xb2dc551bfef25846, 0xa7745ae0cef97142, 0x47ec7f9970d6,
+0x43f6b3c705b91ea5, 0x2c5a9045e4990df1, 0x13864865543e0726, 0x97a97a23acf81d6, 0x2531288e4f3f8a2a, 0x98d0eb4a44bb982, 0x718781507110,
+0x9d3ad6610924d345, 0x70db8b610cdfd79f, 0xbdd809627ca58cb7, 0xc728e9a3b05007de, 0xf4b633bec855e800, 0x1ddc085c81cb1b65, 0x1f56e126425f4,
+0xeb73c07439e05aa4, 0x9840f72e2ed47baa, 0xf4d42ca7109145a5, 0x9fb003a08b5de78f, 0xd4aec31c0d7c50d7, 0xb7fd707579d1f63f, 0x7c29d9ef0bc3,
+0x16d4513dd1cf9774, 0x3eeb9cc88da9d43a, 0x3679d67f77c3a648, 0xe5e5d2f3d8de4188, 0x13b011c627223ec0, 0x54264255fc3178b5, 0xfb769c38922f,
+0x6f5af810ff13044, 0x6073e1893ad6feca, 0x84c725bed71f9ab5, 0x7e47603575830b03, 0x99a0334c35ebf706, 0xb88c324c645fda36, 0x1cb75c18656e3,
+0x93ec7a9c5d1963f2, 0xe4e6d76da6135b5b, 0x30e123cda7360707, 0x702a109c9948a1d1, 0xd11200c962f16dcb, 0x6da50f036927704f, 0x10a25ffc3c857,
+0xcdb23e278ed8bd0b, 0xa135190e4090a557, 0xfce2995a6e6ec8c8, 0x13da4b81ba33bce, 0x1b8f7f37acb1affe, 0x8f9067526ef1248f, 0x214a4bcafc080,
+0x9a25415fad09702e, 0x4b874a6ef3aaf0ee, 0x651e0e60efbcfa75, 0xa34ef15f18b69484, 0xc528f94b52306740, 0xe9180699496d2da7, 0x1cdc992cb808c,
+0x6b7f90578921614b, 0xebc1b1138c5c7731, 0xe468cd3cc0c25cec, 0x795cf1e238af57f, 0xd5ec4672afa0d163, 0x4d9dc8c2901ea3dd, 0x7efc1214df10,
+0xb412d2b63d506819, 0x775ac62165fa4a16, 0x118241854adf7e6, 0xfd471a9d306b247e, 0x956f7d4beb68dd56, 0x30406fc69d869961, 0x3b3254a52e80,
+0x7312fd27cd937995, 0x2817057ca383eded, 0xf877f31676181094, 0xa9587201c5430c0, 0xf10669096bb258c8, 0xc2c09a1d6f5d7cdf, 0xc8e3459c07cb,
+0x1f36066a51fb908d, 0x490ea6cc5a88d075, 0xeefe4078151737f3, 0x22c395246134019c, 0xfcf85236b131db6f, 0x1d42088c5d9cbbcb, 0xc38bb5f5268e,
+0x3d554e453c617929, 0x5c267a365416c767, 0x39ad01624f632699, 0x2a2cfdca40bb79fb, 0x71177cfc35f8776a, 0x2dc7786526c3fd63, 0x86890c187148,
+0x20aa9f9e0549b2d2, 0xb6618b19f5146201, 0xd4d3a1e75567a05b, 0x7d28f48ee9a75fc, 0xb63f2fc839e7cb7e, 0x27cb890b038d5916, 0x1f9cd814c90c3,
+0xf8bd4d4e8377de34, 0xb54c5a74f85dec3c, 0x77e0d8588573f007, 0x1bf7886db944dbdf, 0x44036c8bc403d5e7, 0x8951fc9a5d5b31d7, 0x1210e7a65bfb,
+0x4c0dcd83c841daa4, 0xc47fbbebc86f551e, 0xafca296e69088433, 0xb2509177cb4666c5, 0xc4f3856eae4b202e, 0x31f9b0f7f0367078, 0x16b51975def6b,
+0xf6ad53ca40e23525, 0x935a86fc44a752b6, 0x5e6f441653cbc2f9, 0x96a01fa8bf4cf707, 0x48a0a423b854aa41, 0x36d1bca43a46f513, 0x15421abb296c5,
+0x1ba64de08c1594e, 0x146276eb16bfce30, 0x6d85d56655dee5a2, 0x86c9eb293f96d27, 0xef4aa891a5615b25, 0xd586894ba3a4ce52, 0xf6879e9b4e55,
+0xdcf2678e4358f202, 0x51f6cc47cc565202, 0x43eca369a49684fd, 0xb8ad2514fd466f7d, 0xefe94a5af3178d78, 0xd0d61087ea6bc364, 0x212f9e506e424,
+0x79d93272a71a204c, 0xa1185a05d7ec591d, 0x8511d68fddd627ea, 0x94ff84bbbab8963e, 0xfc6b894a220d918a, 0xf8f1a5e10e7a787d, 0x8158d82b1c26,
+0xb98cf2fe931e5b57, 0xda348982d8d8054f, 0x22572c3fc4d1e9af, 0x6dd17228499b6988, 0x3ca367e59cc1c6bf, 0x84ef510b1ab9d355, 0x1aa904bb0409b,
+0xabcbab763eb17bb6, 0x60493a6044e5e5e7, 0xd885de283b28b7d6, 0xd3adc3a770f9549, 0xa313df108420153b, 0x6c9a09e9caf59e5f, 0x4c5d7373526a,
+0x85aa783dc4d8574a, 0x2fd0fd9708159a1d, 0x1db97dd3d28ffdf5, 0xcd7d924166c4a274, 0x508351f0d19eaf83, 0x75e0241d14a61a6e, 0x8e577dd99618,
+0x1a1573cde7bf724b, 0x5328500af62bce0a, 0x32f146228b289d57, 0x2e9dce195fc6e690, 0xa85bc92db13589ac, 0xe3661ba3326ad316, 0x69edb754d728,
+0x492398a6bbd5bed9, 0x7ffae5b336e0acf0, 0x4eebcd0101c40959, 0xaddaf788c76c35ab, 0x8c93fe9df359e122, 0xf2f33e171c1f765c, 0x1d4fb5cc2fe94,
+0xb7b89dd126b0774c, 0xc86542e628af4154, 0xe2f01ae2e9831, 0x1a111fee252d0253, 0xd580105001c8d9bb, 0xc5f30c1d547ba5dc, 0x1e8e628e6edc5,
+0x7e160de4d652257f, 0x4874b028fed9e98e, 0xa44d35b242ffca93, 0xfb1fdeabfe110bc3, 0x7068bb25121ed6fd, 0x7e7ba8ba9337cb9a, 0x1e2c8c8c2e7f7,
+0x9a9ad06de2c128a1, 0x7ea4826e127f8aef, 0x863ccc1dfd8fcfc8, 0x2fab0f4bb0b72873, 0x9a8cb63631df1d3d, 0x97aad92d0d43df69, 0x13ea897b9e89d,
+0x6e87372a09f45266, 0x4c6ba179b90b241d, 0x2f7d6724ed336fce, 0xae7426242a32aeb2, 0x36cd88d8aea103d4, 0x4e7e71fbdb775e28, 0xb5ee30bd9e5b,
+0x320865b4a14351e0, 0x39c1bb8869a444ad, 0xc12568b9ef405167, 0xb5c47a724bbc009c, 0x2bc3517fdebf4027, 0x12efddf8b585d6fe, 0xe2278a92bcec,
+0xd9fd898290b99dc5, 0x1f3a684d5118124c, 0x4b1b429a2acf86f1, 0x905042e796d350eb, 0x32b2468a825d5ea2, 0x429d256469157d57, 0x21c5806d0e4f,
+0xfd64ec0ec07471d7, 0x2a53b3451195403e, 0xe74dc809c4e5cf6a, 0xb00743ed8940df65, 0xb14706fe9e0d4c86, 0xedf181a4e0d5d7a5, 0x1ecff1c7d110d,
+0x618c120de80a4edd, 0x9fe54af221735231, 0x15a9f5e16f5cd0df, 0x7ab44e7bdf88a11c, 0x4e4c85a48c50f31e, 0x6d4c08de2bd450e5, 0xa8d2fe9cb1c4,
+0x95f9781bf761df1f, 0xe23ae8fb79d00447, 0x33752942629a1ea1, 0x58a5f2a6c10ffd14, 0x52d5268cb758f3ea, 0x5281e34f4f47d265, 0x6267ec5f9111,
+0x676092cd4eda276e, 0x7486102461f66f60, 0xf58f26ca46f42c24, 0x92d108790b635302, 0x7c6ecb163bd482d2, 0x24ffc4a2bf8ea8bb, 0x1e3d773ca7e15,
+0x6245b281ad04c57a, 0x9c7985314c293187, 0x9c9009b7e285742e, 0x3b639eb25cee3060, 0x56c0b59cc9a889df, 0x37e8be537f82400f, 0x662169ad67bc,
+0xcb9ae7ea2952314, 0x47db6c3b34d91503, 0x97a96631543b4bc9, 0x14bcb50eaa115acf, 0x86e40a3c447ae110, 0xda5cdbee89baf042, 0xfcf746d12323,
+0x79bae9679c4a523a, 0x5e2ab60191b0082d, 0x9c35aea4108b0d21, 0x208dc163fa8ecc7, 0xcd00f2065313a479, 0x5a91a8d272fdeeba, 0x535f33d0369a,
+0x62959e75c54c1ccf, 0x311eee7fd5abcb15, 0xa4d832bdb343f987, 0xc9bda764da4284f2, 0xf7dd7e10175fc8d7, 0xb520d320b9cc911a, 0x1089e81126a63,
+0x25ba6f68e3bbc580, 0x1959bf22a2289a35, 0xff521592c8f0c916, 0xf88fa003abfe1bbd, 0x926701f305de6306, 0xc4eef6c836f68c6b, 0x1ef51919154a1,
+0xc722ff5678d71aae, 0x16a527dbe6e4f597, 0x7d56f24380544610, 0x21a2b0ae0d0640a7, 0xe96674f4bd061f2, 0x6baa78328f6fd7c2, 0x224145e80018c,
+0x5c5490f9cb32023b, 0x21312aaa72404a4c, 0x8176784871d2840b, 0x2b2ba54938c405be, 0x9c1bbb7eec754731, 0x24759f9c8041bd9a, 0x12ba9460334c4,
+0xdbddb849929fd7af, 0x838785d94e0300ad, 0xf3de916a7fa16bf0, 0x8798a698fb83a621, 0x5fc94f7cbcc218a3, 0x99d8817d40c494c2, 0x1f6bd7712c8c3,
+0x85174a9e2f66e8a9, 0xb0b084ab6f392f63, 0x7e20584ccf33070e, 0xc098a8117a4701b5, 0x401099bad0c9652, 0x42576c4b7e0f91e, 0x201806322dc61,
+0x746b59768ed3c0c1, 0xaabc097a34ddb137, 0x935a4c7fe118428, 0xbdfd92a7dae5315a, 0x560256b7c1dfdf48, 0xdc5f2d030148558c, 0x16cf83f3752ab,
+0xc876e9e10d487676, 0x40f0bbdc390a1d2e, 0xef6969171612e61b, 0x6f5e913a3d743b90, 0x453d87d0c9c98deb, 0xe631a91a7390f7a4, 0x2282c984d9566,
+0xe2fe08814de5a359, 0xc5add50a4000d15d, 0xd6203a0cb44b5706, 0x6516ea3f6444ea51, 0x9682218bf330412a, 0xc1632253bb4b1a22, 0x2064f557962c3,
+0x85df8c1dd12cef72, 0xa97e066f1780cb94, 0x273af2afb2003534, 0x5a7d7b6c1fe8770f, 0xfc8476f07fea2bb2, 0x64f3ef624d913b8e, 0xbc5dcc1305d9,
+0x4840a3ceb11183bd, 0xab1923f649de244, 0x8e356ef15117be9b, 0x3c80504ceeb9b689, 0x40951894579793c2, 0xa44310686fc5c2c2, 0x17df365a6c943,
+0xf4097be2ba8a2af3, 0x40beda3c030d9fb2, 0x1e05d3a626941169, 0xac4e4629ae51b529, 0x10f702e38d6db80a, 0x396d8719f0d93517, 0x33230b7f8bbb,
+0x41817c91e15b2f26, 0x9c415503dc678fa7, 0x4b2c54d977698f9, 0x9446f64217eb46a3, 0x75dc8ab1bc36019, 0x3456188a03e3334e, 0xb9fb484d3af5,
+0xad047a9c55101f0, 0x610017a454a5272d, 0xda5c62407fe062a4, 0x60621e23b75c3be8, 0x6b60c536d2b9011c, 0x18debaad09b209e1, 0xbbadbb26b6ad,
+0x94a3d6c1fa72d42d, 0xf85276fbebf0516c, 0xbfbfef1099bc7a60, 0x60cc4c3f20ba6c11, 0xb6e6b42c077abaa1, 0x5a30990a53484420, 0x15885af5e55c3,
+0xf4c5ed407a1571c9, 0xe928c9907690b376, 0xb7868446783b6aa6, 0xa390d2046050fba2, 0xe609c8449f826004, 0xa75738aeb0995ad3, 0xd0851f979068,
+0x2bcca95af89e3b0b, 0xced3d4f88c3fd3cc, 0x69cc144d9bbae78a, 0x71a423b1da0d918d, 0xbd3699d214c160d, 0xdab093708f3af2d7, 0x1586746b73fda,
+0x5cea86442a91ec6a, 0xab5e37cadb766a76, 0x27660cd94ebe7218, 0xfeab9c0aa0015861, 0x5582f8ef9c924cca, 0x8300d0e904c72e24, 0x219bef2985d99,
+0xb4a0d5a130fb452f, 0x656eb51d45908896, 0x9e68fb66ba2b18f2, 0x7bc537c3668c013b, 0x2b03d3ca834a5a58, 0x77f0cf088f2f52f9, 0x14499a47d459b,
+0x163603939fa6b170, 0xef2ec99827acbb91, 0x9ad044dbe0efcf48, 0x8732a8356bd4f907, 0x5782ba7dab054cf9, 0x5d083b8326f671ec, 0x10cda60ad83d1,
+0xac7e2d92c6b029ce, 0xb55fea8a09eba66e, 0x55f6a79b391aa9d1, 0x43509ab4d1aaa093, 0x3944774903577213, 0x1214ecb79123a101, 0x124e1fd1cd591,
+0x9b11b9e86cc1611e, 0xe7e60375d6d7da7e, 0x714e2e02e42fc41d, 0xde902e9e7e5fb4f0, 0xe288f83dce10fe73, 0xa87864e3c6353487, 0x19e13f633eb2,
+0x936614f48305c59b, 0x1516bf831131a611, 0xabb009509cdeb951, 0x78985fbffc5d1e50, 0xf2398ba1e7157db8, 0x483297b732e27793, 0x68c4dd81f5cd,
+0xc2a95e734a4873f, 0x846da4418235c81b, 0x8f3f8a6a72fc0bb9, 0x71987f94749e2628, 0xf2bb86c164e7e8cc, 0x36df11856dfd174d, 0x873360d7fdfc,
+0x72fe1fc0e5fc5360, 0xafd0236841c0922a, 0xd0443e728fca8535, 0xc7028ce25a893e68, 0x26d868d412ee7bb, 0xf6f3bdcfba29dd9f, 0x14b50256927da,
+0x3e20eb9a77a74e1d, 0x6caf40fc48261b4e, 0xc3a1adb38bd8cdd1, 0x15c86fe64c031b7, 0xb2e4c4b94d978bfb, 0x8e023eb78100a13c, 0xc6fbbb846ea,
+0x592c84333f918140, 0xfc18483e3e33ecb1, 0x642ab7a384a1beb0, 0x78af0b15ad7dbe36, 0x32561aadce474061, 0x423a4223b213a3a0, 0x1bcc40081c67b,
+0xa89c335103f1cf95, 0x8eea14680c9f7a0, 0xf6e8fd65d0b024a2, 0x5ac8494ae0ff953f, 0x4dd7171a90e19307, 0x80fc22cf3f909a67, 0x568c6f97c075,
+0x59f94c0695dae6fa, 0xd03d6b61eda8b3b9, 0xc59c9d40263c3cba, 0xe15643cc16bb194c, 0xf59b3ccafe9eca, 0x8d2be952ce35f154, 0x11d577f480242,
+0xb90ad7fc4f3ae50, 0xd4ed4bc1a30ca85b, 0xfa5772b364961aee, 0xa5884c4a11139212, 0x22fb1f0cc32bbb0a, 0x5f5dc3715b1a4b98, 0x83c065b541f5,
+0xc37fd2eb76b942fe, 0xe21220d1c9857b4d, 0xb23eaa4382f505b3, 0x476f80845bbc439, 0x474d55f4accbc654, 0x5abf2ce9fc2d9e6e, 0x5aef6e229d32,
+0x9fd51d552cb70894, 0x668e3550a960f619, 0x2e2a0da3f73c6986, 0xc4be93e99bca43c3, 0x7e3fc4ff2ab17b4f, 0x1c3624cf4c5efd15, 0x38ec57305dc0,
+0xbb3258192c6330ba, 0xbe2253bd3ff39233, 0x4b46bd19b8e9318c, 0x27467bc37f29bb30, 0x4b1ec571ebebaef0, 0x13d55000b699be9, 0x7490605f919d,
+0xb82712c9b139a1ab, 0x7282d61143cce7cf, 0xa6f8154ec9fbe9f6, 0xf96da589f3f1681b, 0x4bd5eb63dfe87f1f, 0xbd486210e552105d, 0x229d8f5a2caa,
+0x411980c238f680de, 0x932a392f146aa0c6, 0x925c7562a565b346, 0x34de31d35535415c, 0x3ad330136d463fd0, 0x628e51a164ef6fdc, 0xfa40c05e310,
+0x60573bb4a41ab714, 0x274083bca6860986, 0xb12607e7a2a5ab8d, 0x7c060dd21285446f, 0x55f5be5eaf22d2e5, 0x89f48901e643046b, 0xc42a75b142a8,
+0x88116c66be45991b, 0x675ccacf9a7b7565, 0x3c1d991b85e865ce, 0x6cf181bc23da5c2d, 0xc4b6134d2cb53431, 0x9f88bd8b201a827e, 0x21a565b894100,
+0x20afbd0dbdec9299, 0x9ace310dfec1b5c6, 0xfe2e4d2352e05f2, 0xc96d6859edee824f, 0x4718a8d933661932, 0x1ed44e7e280d4a1f, 0x1a7c288d64e2d,
+0x6f3a54cc1dd82146, 0xbf502db7f196a651, 0xc86ad712418d3694, 0xfbebadb10f1a3074, 0x165ef79184cd9e86, 0x3e385be52b718ba0, 0x1bdbc3634f6b,
+0xc20063bf920a37ea, 0x9835b8059828b16, 0x19bc4b69ba8f362, 0x1d4e5bafd2e506a9, 0xe12813acc4cd6c74, 0xefe4018aef94391c, 0x1ec319e45a718,
+0x351ffff25bf676e6, 0x87f2b7354f29b3ab, 0x4b6eae5063729093, 0x3226e6689ec9099f, 0x25ed9f21403a65fc, 0x34b27ba97b4facd5, 0x1a303e8473bdd,
+0xb188450790f69cf1, 0x6b5a960b23682864, 0xd7878132cd3a7a52, 0x9ce46fd2e10ffdbe, 0xd7e8a1d6d2a58e65, 0x98d50ac9e92d13cc, 0xcc444ab4c1b0,
+0xa55a69eea575245b, 0xda9e67f07bd6f8be, 0x1ae161eb7639e789, 0xe5a69485fb96da5c, 0x5bb0c7909846cb52, 0x7ae73ea6e4c54338, 0x1e88506149d79,
+0x52d2980edf9d76c1, 0xd56469145e5ad4af, 0x643c346aa5dc0854, 0xa742442c6cf2b498, 0x1da678f5fc2bd7dd, 0x82aa08e42083fb60, 0xdf0c86cfdf2d,
+0x6fa5d7b237540fc6, 0x20853153aa886f47, 0x3f3d9901bfd522c5, 0xf2592645e4f417f3, 0xeaa2e77e3eca5e47, 0x4b5e90c4442da623, 0x10cfb261ae5f,
+0xe07ee8b20580d44d, 0x42fd1585d49ffc8f, 0x72ff754ec2771291, 0x48b5689bd85a3a46, 0xc4f3c7051b1b1507, 0x31ba09fde6d54e8, 0x9e98c200cd2e,
+0xcb63f62ab7b3a573, 0xc1c270d5a6cd2a66, 0x40eb4d01d80a4e3a, 0xc044adea10dde45a, 0x8570749d42a0c242, 0xe3845323e9583752, 0x21a78b5927f1,
+0x1f9f8923e1472e9b, 0x34974dbd1dad6d7b, 0x3ab44ce5b6230cb3, 0xe0ed43ed7fbbee7f, 0xabfa02beb4b7ded1, 0xf6bec8b4fd5cb542, 0x73e61b7581f3,
+0x304201ada750f8a3, 0x384f469574b3c6b1, 0xa4abd367003e48a0, 0xc170a5ae5e6ac3c3, 0x414237f6a1c76456, 0x115469faf9b09b06, 0x1b6fd92e52cb7,
+0x2deaa4487f4fab9, 0x82c648130fcf28e5, 0x4e3ab6e8ad3af8d0, 0x5b48f2a27c5f0954, 0x46107276f7b648a5, 0x93ced461dba62711, 0x1d23806b93ea6,
+0xd1608a6a445b5fb4, 0x3552385842f6a246, 0x56208b14a3b18bda, 0xa0889098cf7e7872, 0xfbc89dcfa51d3a36, 0x65a61886224606c3, 0x8b2d77816c7b,
+0x50add80ed54c0988, 0xaa4a847cb6689a3e, 0x933b7b916acbd7a, 0x45a207e7ff2a4bb5, 0x3bb24d1c38f774f0, 0x41c3af79d07aeec2, 0x80bfbac215a4,
+0x7001d2d8fe62dd63, 0x9e156ea1ddd2c466, 0xd8313b956ca3150f, 0xb23e64835782b591, 0xf325c0cad4d33bf0, 0x18627d9878aab96a, 0x20c8c08b1f5be,
+0xa080b6142b45b05c, 0xafc8f9afe158187d, 0x72e4922b1805fd49, 0xa1f374278b2b1fcc, 0xef7416e3c1f5d188, 0x90e94d2ec7e64bc2, 0x19faae3513be2,
+0x9cb69424d0d1d12b, 0x3b2a93356360b544, 0xb7e17dc7a18e6b8d, 0xf02c615468f1e3fd, 0xc22d4b22f86dbd9a, 0xacd40990448e2d3a, 0x129c85ed077f6,
+0x49953fc10ab985c0, 0xa076d61bf61d171b, 0x9224de6c5b44d20c, 0x915796fa86cd25eb, 0x7bf74aeec01fd711, 0x3df48e4382a47325, 0x7ba158d511c2,
+0x17be00fb9735fa0, 0x2d215f8e280cfba5, 0xe9fef18007ee9ac0, 0x969638f3f9265e67, 0x691994bf7f9d8812, 0x166ec86fdf71bd50, 0x1f536880a58d0,
+0x8018785892b6f073, 0xfe230eae2c7fcd47, 0x3e8d8c96948bc12a, 0xa0008b06b58edfcc, 0x1203055df46b4280, 0xbb09d1c0c5cd0dfc, 0x4b4bd9a31f62,
+0xacf7837600a43e20, 0xe8b5aac7f35a63cb, 0x6cecc95041ebbca0, 0x5951d0e87540904, 0x715634f143558272, 0xca978019a1331f44, 0x21513f213b1a3,
+0x85545b8de11f1af6, 0x78a1ffbd9b3c593a, 0x7f7e7b3038e82bc8, 0x5d2ee791f12aa393, 0x9f0a41c5694b0743, 0xad21d7fb7524067d, 0x6aed967e749,
+0xabc2bd0bba11eb97, 0x17b3cd8a4a8638ca, 0x22cd5dfa8e1c28fa, 0xfdf6fa6bfb1721d3, 0xfa26c5a5342924a9, 0xb5ba686b3f2bc409, 0xbc2cb534f5e9,
+0x13e9e8405cfa149d, 0x697964237773e037, 0x80a35d6efa4615c9, 0x3bfff6841d1e44e1, 0x891ac7c46a9a857c, 0x6dcb8b72686b5a93, 0x8cd1ada4b061,
+0x7d30f8747dcaf8f0, 0x6bd84f74fe2c80a3, 0x603ea96e0e3906c, 0xecce267dd201620f, 0x4412348ac02e9010, 0x1bf159e43a56b7c0, 0xadf4d8c04865,
+0x5c1110547bb9f7ad, 0x3139c913c65293e6, 0xc4e293ce83c2328d, 0xe357fe736e6d0d47, 0xa716c22d4e890c42, 0x8ea642886028324a, 0x1b914ae758d4f,
+0x54581ab06bc90b7d, 0xcce5547ef17432de, 0x47e7c686e13d0566, 0x48ff607d45201306, 0x18922175e5d20b41, 0xc43e509b6a30313c, 0x180f6a230f44d,
+0xd9ca1653a74e3b46, 0x3d3d1532f9716fa3, 0xcea0182cf9d2068, 0x76fc3077b7b80ebb, 0xee587cda4c2ce9e0, 0x7186a69019cb98e9, 0x128dfe3ce33c4,
+0xd9c37486bfde69b7, 0x316d16ce44e370f8, 0x58294de34758b194, 0x9512aef37e66a8b, 0x4871c08e48967521, 0x6533140109c86278, 0xb71c68ed3dbd,
+0x171527ad0b42a37c, 0xec3b9e32a127c7ef, 0xcfa7d2644b7b61d0, 0x5d7692f92b268830, 0xc5537f1ebba04161, 0x1374b06f173103b4, 0x1595512fb9641,
+0xb596fa6fa9ed5cbd, 0x3c529c513dd3f5f0, 0xe513dc738c1f62a6, 0xcf7dbc520f497e1c, 0xe75a9ca91e312079, 0x5ff6136f328a1c77, 0x2d3e616c6582,
+0xd49815d79574ea60, 0x3f3220e0921604c6, 0x8f2e9157b4f71770, 0x18450b17e59538fe, 0x816136b3c05eac96, 0xb539297f8e151633, 0x7ae89dd1ff14,
+0x375b9b9a7ec83361, 0x21b6867b8891299b, 0x4453ae62de1ad990, 0x4cc53783373cdaae, 0xaf6947e746f9297f, 0x2aafca0029744039, 0x14a982d0433e1,
+0x24e22d5e109c1a22, 0x93c6d201f7115099, 0x2d478dbd58b6c445, 0x9f000f3a3b13bab1, 0xc140ce04f24dc844, 0xfb02678ac97be8c9, 0x986f0580abcf,
+0x17ec51ba0169462, 0x48edb4a1d9391952, 0x29d83a99451e003f, 0x2e68f7299659e083, 0x59cb71b5d319f9a5, 0x8558e9ab1527b32e, 0x75c2c5e26e7e,
+0xfe3ca4f76624c818, 0x6f60f2341c7fd245, 0x523bc4ab7f01d179, 0x9d24ebdd002460e, 0x6d0df8eb0ecc4f91, 0xc2be009ab4ba65f, 0x9000ca51a779,
+0x8655cc070e7b9ebe, 0x194c04af24facac3, 0x51c67208aaf71d4b, 0xfa5e4c2f8ee15ec4, 0x2adf0a9e40214c15, 0x2c2c876d23489e0b, 0x12850d357d343,
+0xa618c65c1b4efad, 0x3ada50836e7cbcfd, 0xbe97aecdccb8ebbb, 0x9fd7d8910af2b428, 0x1b975dd021ce8fd3, 0xac7fa4ad075229de, 0x188db7cdc57d8,
+0x982251b6f598a22, 0x11ae320bc1cfc1dd, 0x96a285bb6b22b3d3, 0xb73cd733c2740710, 0x736238ab876fab5, 0x1ac51bb383f05f5, 0xc9666744697e,
+0x5660ec7df3d03306, 0x31f5c14f0caed017, 0x9b6193625f0d11d1, 0x4fe294d078337a24, 0x827245536ebc2496, 0x26544945e5f4d064, 0x667b30baeea,
+0xb9cb9846face925b, 0xc5e1716da048d012, 0xeca26db9ad2fa6d1, 0x9c9d241452326a2a, 0x4f4411ebcfa33beb, 0xc12df20084afbbaa, 0x1a8b0f925e20e,
+0xfe3fe8b4d3aec5ed, 0x5fb9c561daea8f7f, 0xc79a019dedc6d08e, 0x5580f71a4ae76d88, 0x84876e51b130b609, 0x4045892a2ba86875, 0x2290de8f54a55,
+0x9b83fcbcb165853, 0x3bbb1a64c6cdca7c, 0x995b6b1c4d27791e, 0x44385693a6fff3d3, 0xfd15edcfe4579cc3, 0xde5ee333c719eb5c, 0xd42e4079753a,
+0x217a9a2de478aac8, 0xf0781c51a7dd240, 0x60b305db5531cfc0, 0x88fadc1dbded7f13, 0x54f271e52a7fdffc, 0x403799dc415eb87a, 0x6a95943d9794,
+0x7d9b88c6c4917be9, 0x8bf236117be6851, 0xeeb508643a4854fb, 0xa05951b3139e0327, 0x848026f569068f26, 0xfb8b98cff33e46f5, 0x19e9af9fa9ef0,
+0xbfc992600aad3e56, 0x81d3dd34aaa22803, 0x7d2ff76d18fef71a, 0x2205440580921aa3, 0x923378c0f6618fce, 0xdbeb49f83e7e9160, 0x202142a1a9b41,
+0x94b76cf60ed5c50c, 0x4b2f253b4645108f, 0xd28b06476706772a, 0x95c2a28f4a09a385, 0xd745927b9de76373, 0xe44485dbb92455fd, 0x12930626075b7,
+0xc8bdee0ec03f8be2, 0x39bd190a8f505c15, 0x6c2088e49a6ebeae, 0x267b279ec782c15f, 0xb295d407ab014711, 0xbd96a63fbb0712e7, 0x1cea59108e132,
+0x84a5ccfcae75d45f, 0x43bb632f4d29452, 0x47849880ab4ed5c4, 0x8baaaf067cad537a, 0x994106bc368f40a8, 0x441da8373a7a81cc, 0xc233fcc3be83,
+0x68a589a5a664929d, 0xdb9956d6e8e53b0e, 0x8fe1f9b701476cd6, 0xb487ff167a055af0, 0x8163744657505f84, 0xffb0ea4da36dd19b, 0x326ecf2301cc,
+0x458d0fdb6e4dc5b5, 0x4c0734c1dad0fdfd, 0xa974cc6c60c7a85, 0xcd08f7f9b8e72c16, 0xbef34a3c486e9345, 0x646e10c65d87c2a6, 0x20aa807e77d6c,
+0x4a7cf99b18aa875f, 0x7d9fbab0a5d1b07e, 0x7c79c6030be501e2, 0x81085e38b2a77d74, 0xb841622289bff5c5, 0x930cce33b62a5fbf, 0x20fddbc222a9d,
+0xb42d46c2b65b9688, 0x642bd3fea0deb735, 0x1940431bd548d225, 0xd24befe4b0fc4785, 0xe6f3fed4a3d0e204, 0xfd602d37aae1af59, 0x15911ec38138e,
+0x7389e9766ae0bda2, 0x1f9dd3fc6ad4a5e4, 0xfa78963ca6f64343, 0xb747c7bdd50c3c59, 0x3569f2ac66b03f5e, 0x20d1f923dc45744c, 0x202995248a53f,
+0xcf14396954e670a, 0x3f9cb8b71fb68a4d, 0xf02aba08ab9915e6, 0x1d3534906ef5a376, 0xb4845e9b1314e02e, 0x9d83da6f624e5b52, 0x153be1b64a98a,
+0xb36cc62d9d086629, 0xf48d75e4e55c1fcf, 0x12c52a854ceef90f, 0xa8cb334da33df4f9, 0x3c30c5c43a91c1d9, 0x9c61ac571a19fdd3, 0x172715b5af493,
+0x599e6a244fc11d42, 0xcc1e9d01678cee84, 0x9febbc39ffbc64cc, 0x9753768ccbe8f5cc, 0x5aba858d278f80f8, 0xd781cafe7c24eeed, 0x1b98c8ad23504,
+0xed7e5eb1fc2dfafe, 0xcf5694f97d0d4f67, 0x4493db7ea29eb73b, 0x9ec28702d125cd34, 0x44bd02e7cf578eea, 0x320a82eab83ecca8, 0x922092986d4f,
+0x22dfb5f0e771c0fa, 0x6cd1e6f1766f5640, 0xeff02beb9df89450, 0x75a0c86064af1464, 0x47d33afaa7e6dc64, 0x6fb21afdb7665bff, 0xec7871df5bc6,
+0xf317722b45c5c876, 0x597da0034cd088f0, 0x6d3fa5866db2450, 0x6a6973c80c9c1e83, 0xda1630872b9e6d2c, 0xe13d6f786f056cf6, 0xeff129f0e919,
+0xc3068380b4a4ed31, 0xbb3bd8e90476c9ca, 0x8f1e659d7e1b2c24, 0xba14aee2263c2379, 0x9328275e9027e70, 0x172958b6c835772e, 0x1c8ac422b8a0d,
+0x54040415ff5c5ad7, 0x87de62c1ddf8d8db, 0x5d6282f76a55a672, 0xe0291402add72cdd, 0xa958c1e3539fe0a1, 0xb74cd76361a8a59a, 0x2106d770a085e,
+0x5bf3b0d55e9eee3b, 0xf08446f1124b28fc, 0xb61a3a98a4e3f16e, 0x1f85bcfc564f3427, 0xefda9f8f496478b6, 0xe76dd6d451fda301, 0x1846212a16a79,
+0x2fe7b717a82b21e, 0x41e097d7305389d, 0xd12bb0edf2d633fa, 0xe9124354aa775d2, 0x8e213cd1d257e10b, 0x34a458c9d813c295, 0x22304a5c82756,
+0x16d170de24ac1183, 0x2d7f0c0a5fd1655a, 0x63ef6972aeea1084, 0xc279b62365694e68, 0xb3cf81c28acf2961, 0xe42b1c58c7e91bf2, 0x6f4c551d248d,
+0xd689ccd02559d878, 0x9afa464a7a8f8502, 0xce85d7c5ff6fd9f2, 0x1dd8bdb41da4657b, 0x8820092475f4e9df, 0x59972b835da9900f, 0x146ff0e8b7b62,
+0x9962f3aba13d8099, 0xaaf4512c4e197d2c, 0x90d95c41c9d36a7f, 0x6d47eed3e9d3970, 0x3a2bb39b5fb83799, 0xfaee256f0b8b71c0, 0x6f0b39714968,
+0x4f4f0ace4dd33eb8, 0xc5f94f776c00793a, 0x5568ccf97edfe5a6, 0xcd09fc6f71efec6b, 0x6208b342e5cbd42f, 0xd7c9c32cb9f8b807, 0xfa4ac01806df,
+0x4933073ce38bf7f2, 0x54c6c6ab0919f6d8, 0x53e24db6783e31f6, 0x89dc7439f3a202b7, 0xf891befa022e0589, 0x9f4c455aed5f9bef, 0xfaae515f7495,
+0x24d5f8cace5fca49, 0xe52d9a7332dc5a9, 0xd2d426d0390c28a6, 0x2650708353f8f8c0, 0xe22c01899844f68, 0x1021c789c0fca126, 0xbb85ef2bfbed,
+0x551f5e1435a9a3c2, 0xb398227d1843cab7, 0x969b10012128990f, 0x287f015783b8b39c, 0xe7a9b83d4786818b, 0x3a60b1bbd01d8366, 0x16ef6cacee4b6,
+0xe606b14dd11a3473, 0xd843500c106297a0, 0xddc7150c34fb8416, 0x50b190053296048a, 0x1ace9c2fa333bfeb, 0x29a8994af2efa8dc, 0x1dcb0cdbd75ea,
+0x98c770dc843c55ea, 0x1bc63ecf334b116d, 0xf502c61ef3c800c2, 0xbb999ae06a0f5d55, 0xaffaf2800fcd1edc, 0xb9423b91c46ea9f4, 0x1a6afe7168367,
+0xb12b1a9e170d26a0, 0x6bb1c2f742a18e56, 0xa5806d85b9bc6701, 0xb5c792fe19ae8827, 0xc0dc36aa01f4fb83, 0xf00be08e8326a507, 0x1bf3bb2f3e000,
+0xb7666b89f8e64ef4, 0x8fa26b538aee6890, 0xda1127b1812a8f03, 0x72b306f926dc3412, 0xfebbfe654b09e2ee, 0xabe140e8bc8a8ca4, 0x225c931432363,
+0xb763cd026f89688a, 0xec04ebcfff29b2f8, 0xfc3d57da316d4a35, 0x329bc9ca4da5bee0, 0xf8ad15674bf11439, 0x55fc4ab51881675c, 0x66731f6f48f3,
+0xea8d7a153a5dde96, 0xc3a9bfc0dfbed5cd, 0x6cb6c29e9229487f, 0x72aafd10631dd79e, 0xbdca030c1d2de282, 0xe9f8ac6c1a59307a, 0xf36300dceb2b,
+0x8078abacf0567779, 0x7d32ec8b633b4c6e, 0x82699f1c077ec59d, 0x6534f11545e1431, 0x84d3343155bb52fc, 0x715ce05caf052a80, 0x125a9e1cc4e03,
+0x5bd0fa8cc008e667, 0xdf10557afe7152bf, 0x10b3cab0071fc0bd, 0xe119ff3994e5f327, 0x4be1de317eb59e41, 0x465019007c96cbb3, 0x5eac6df3fea3,
+0xd62e011aeb6f1ff7, 0x55c03d612fa5b0f0, 0x1de930eca16a884a, 0x74fe32255a41e65c, 0x7a4ba145fe1913ea, 0xb25f786daeb864df, 0x1627db65bc94f,
+0xe2735b22478c56b0, 0xc577c1632283abe7, 0x1b0e51bc501fd175, 0x7a1058416e39a098, 0x37d8d7ee345f02ea, 0xe9605173a90f6b79, 0xf327815bb24f,
+0x2054d43f67b1820e, 0x7517ab0300ceee28, 0x28ff51df240f3456, 0x69422e873e299c79, 0x5ab4b0e80c4675f4, 0xcd8145dd7d109023, 0xff03b09dae0c,
+0x5e32f2039bb84a70, 0x9d5c0c407c6175e7, 0x369c7a3eb28e2c56, 0xd3c7aa0ab5003256, 0x9f0deaf4626893a4, 0x154a00a1b4d61768, 0x5ec93eb2a1a9,
+0xb5453dd5c0229f98, 0x7e407c1185499674, 0x393b80668d2d46aa, 0xebee71ba1bf1a973, 0x9cc6f3c6d160f933, 0xc8c14949a48fd103, 0x8112a0621b9b,
+0xa4cc63a32cd1110c, 0x6883e848fae99247, 0x4567ef856a063178, 0x34a8365d83ee97b4, 0xcd6641ae91af18e8, 0xa452c5e1476597df, 0x49949e160c12,
+0xa991dabe513ecb02, 0xb5c60b6b1428d15, 0xa8d863baa779536e, 0x95650f78678fa8a1, 0xa1174cf23260a2f7, 0x543027bde19b97b5, 0x4ddf1ec85b88,
+0xcab0a6a32e7a93f4, 0x45e7fbf42ac855e9, 0x3b6f3fe7a8ed971e, 0xa22cc0ddfe42d1d5, 0x12544cd56c4129f3, 0x5a083b937bd39e33, 0xdc2ef5783db8,
+0x58510e60cbc7cc90, 0x919fc945d60502db, 0xc88095c97449d47, 0x43465f53be6e5ca4, 0x7fe9649c4e11dbff, 0xef370dab68bbc2b4, 0x35e512e6ccd2,
+0xd76b3b61c8bc313, 0x80ad43fe07b2aa77, 0x6b546d47a2a1179f, 0x4e5fcb1513452e70, 0x6f897f9d1270165e, 0x53365bdc276d6d45, 0xd4946ec8b8f5,
+0x1ae7be1e4b2c51d3, 0xac767bc60884dde, 0x9f730350134f679e, 0x4a8ab1a0b1394d10, 0x591faa17929e9952, 0xfe57e45b682a114d, 0x6de00bdf9bee,
+0xd6cc674b288dce93, 0xa5bdaba1fa8e85eb, 0x9d71c93a40365f97, 0x19d3e351c43111f, 0xe88fb5e078bbdb1, 0x6fc06dbdef17f1f6, 0x1d44fd59de82b,
+0xddaccaa075cb4c39, 0x97a172075bd9f904, 0x83361f49a4105669, 0x565c7229e1ed8c80, 0x29a86eacd17a707b, 0xe4aa16c2e3b17f99, 0x5e7d1cb622bb,
+0xb4f31f1921d20f09, 0xc9dab3d642eec91f, 0xad9cda04b3569264, 0xfc309c3669fb081f, 0x20ff54b5eacba9f7, 0x72833c2e1176cf6a, 0xa316cd29e5e4,
+0x5309cf44b09255a4, 0xebcab148f5ea7afd, 0xce60305242264b3e, 0x714f8d13980715c9, 0x919c976ac8a16c35, 0x29b203c822338640, 0x2096098ae9fde,
+0x6506d0ae9584a1fe, 0x84825e39946dc45b, 0x468d884a1f635afb, 0xe1c650f397c9c8a7, 0x469a42e062db727, 0x5ef9438e4f3f0a1a, 0x28c14dfb3fe7,
+0x787a306f1b3ae795, 0x5280d7a08c1546a5, 0x6061a2a31cd3a7e9, 0xbbd15a5a9983d344, 0x18233de61f8b2d9a, 0x115cd6e75a500e85, 0x225c48ed69af4,
+0xe083aa2acebe2cd8, 0x5f67d91e38cc5d20, 0x6f64a2af1fee4cdc, 0x6d587725d61bb11, 0x7a49154eb74fedd4, 0x2bdcdbb8fbc2d446, 0xc72423108b38,
+0x593afbf75ee1002b, 0x74b6e5b64cd3c763, 0x2e08dbf63ed182e, 0x11594ffbd76dec61, 0x738893ba63bbbdb5, 0xbe498582d4ed4c06, 0x1a16105a3d6dc,
+0x937e7bd4e9257982, 0xf318cb11d27fad6c, 0x40d6cf17dc71a898, 0xf576df54ae07bbec, 0x68ea705f8a5fe0ce, 0x6567a28075f6ab29, 0x1cee37032ee6d,
+0x835b4aa0b49d4265, 0x3caf3d6b2a11fdc6, 0xa05a7f83534a2267, 0x8458e361616d4c9d, 0xc603567750d30d01, 0xfd9d5f6fdcef8962, 0xffce3dc213ac,
+0x57421283d50f882d, 0xe551c408cfb055c, 0x29f500081b4482e5, 0x68647832f82b7bc3, 0x74b10363d190887a, 0x70dbc21dec50cc18, 0xb56e4758e6c2,
+0xbcd53bbde2eb23b7, 0x55631183451f1f5a, 0x42f7ca66def868bf, 0x9354c3e24ce4f0de, 0x4a8c80365716a6a9, 0x4fc16010a338f428, 0x36381d7df95b,
+0x8248caaee242a0ac, 0x43eb8e24186afe57, 0x8e4d449a5719de9a, 0xd5bc7ee00b954a69, 0xbd517eef2d1c1711, 0xf508b1c738e8c01b, 0x1d0634cb11d81,
+0x18815d72c0643f48, 0xf08c52b53388729a, 0xc5712a0a41255f3, 0x1229dff0a1b29ce7, 0x73f0aa7837d40fd5, 0x299278206296eefa, 0xbff0d0976b39,
+0x60f41e02a06b236c, 0x3d117b438c2e4cbe, 0xcca33348bc0dce8a, 0xc22b3715bdf14836, 0x8267a36a060d67a8, 0x4a05a8c9f515156d, 0x14db575c1c003,
+0x9f9070a633212559, 0x82f49e8e107a7854, 0x57b2e169002583e4, 0xc0a734d1a58e684b, 0x640c34526e17da6c, 0xc56972a7809ea481, 0x18c4791f95ac6,
+0x7baa4825975cebdc, 0x9083422c47178809, 0xec6eb6b6118d5c04, 0x7c1e24ee2d135bca, 0x4383ceb1e9fdb752, 0xc9febd1e0e38a3f3, 0x11a583ef5d4a8,
+0x556da55476c38b80, 0x355dba8cbd1aed75, 0xb767ec3fa8fe8c3e, 0x73bde74efe36537a, 0xa48b8e6ec2beceb9, 0x7c637aa11060ef7, 0x1a2edd0e995de,
+0x267e0b272abd57f8, 0x80d4c3bc4c7b51a0, 0x1558f888d0661423, 0x83ba7c18da74d9dc, 0x32b953838c736844, 0x163961ee062a4138, 0x10e28ceec86e9,
+0x5d7e2184a69e5945, 0x3b478a741a7e0512, 0x21e878c59dbd84d6, 0x886f4fe0454ba4dc, 0xf336fca9f9cb37ce, 0xb85c0fb8b7b28a09, 0x1f9a4fcfe9417,
+0x9f259321240d1fb8, 0x7c8c81029782aac3, 0x40fd0ce6959521b4, 0xb44db0a9b1a7128c, 0xeafb617164429796, 0x73358518bfe8efe1, 0x10a0bdee6b37a,
+0x829d71274528ba8b, 0x2cab3f3cc30d864d, 0x1886279f188f7365, 0x7565eda63418b3d6, 0x7478747e13567969, 0xea98bb8a2eca5c12, 0x139a15e41a79e,
+0xccca72bf2c911e71, 0x2c807d70a9dbe75f, 0x1e42027778ab627c, 0x8ded5d432968b6b3, 0xa6a51b996202a8d0, 0x872683730bac85ac, 0xd6cb72fb6735,
+0xd8956d9875d321e1, 0xb401941e35aaa431, 0x87c89841b44c882a, 0x1cb3332b0436d9b4, 0x569c823874a30bdc, 0xf17d479a75c0e280, 0x1c8bc958fdbf7,
+0x5c8b40a46c5f696c, 0xc9c6ea4e8a4c7235, 0x78153d206f91fc5c, 0xa9bcf9a2ea077059, 0x57f0d0356dda9c24, 0x9b122a4831e87c27, 0x6beae40f6654,
+0xd74759c9990b1c10, 0x5d3c59df1c61d554, 0x8df8b462e9a6a774, 0x7e05dcb880e09405, 0xe3631f8f5c1ea4df, 0xf8913e272355e2dc, 0x13c709f6569dc,
+0xc7909f1236b057e8, 0x2202372dbbcd3419, 0x5c7245d1364be830, 0xb3713a933f8e5ce4, 0x94607c6368ce3ee4, 0xb6a091aefee52c46, 0xf34aabde7e4,
+0xeda18e0325bc4989, 0xfa9e878cb3fdfab9, 0x343f176d14490cd0, 0x6110c24bddaadd46, 0x17664f1c1678f75e, 0x4718e5aa1d74ee3b, 0x7c013769d319,
+0xd8ebbd57e61b2cde, 0xa27a8f383187a945, 0xb3de44c3bc553207, 0x3f06765967aa2088, 0x870def7f7e3b57ce, 0x82f04f3a7e918f06, 0x21146506f2774,
+0x80a3f56d1cdbc65d, 0xcfb9255c8f5ad04f, 0x93a9b1d629f5eda8, 0x16c79809010b1e3, 0x4f06ec1b588ae81e, 0xbfab9c35e1a47e80, 0x201e69b4ffec2,
+0xbbf318c2415b0977, 0x332e1e33c648d80f, 0xc09185855e1bad30, 0x94ca44fe140fbb34, 0x8bb8e20cfd8e4293, 0x6c1ebcb4472d7b9, 0x1103e0605f422,
+0xf1b3d9a4989e9bd9, 0x5e06bdadf73434dd, 0xdcc39d539614e554, 0x4e5487161a5fa535, 0xf712a653625417b7, 0xbda4ef516b2c6366, 0x1cf78c2cde853,
+0xd0b9a7e84d1ab446, 0x9ac310c59fe2cde3, 0xfb1484cd71310650, 0xad305c7a0a6e249c, 0x82cbba8f95fb1d56, 0xcaef55b84d180878, 0xb12d6e4b4f47,
+0xa289d7f4432b9880, 0xcc73884056cdb763, 0x4c2ee63f656297c, 0xb1f9d40668cd434e, 0x5bbbc9efdf706330, 0x28659e02df96058, 0x20cd60cb56e77,
+0x94787ce3a8d8ff42, 0x811616b517ce2088, 0xb51ae26421fc734a, 0x19af763f457b3d5, 0xc3b45a8fc09974a1, 0xcf5ab5a29e08c139, 0x22f663db490ce,
+0x9538fabc004c3341, 0x215d12f88a0615f6, 0x81a4a896f714997, 0x5935c86c7eb39064, 0x8c295ba051564356, 0x580e7d2f28781ee6, 0x7ed7c1d08aef,
+0xbaf5761271125de9, 0x1d336286c775c2fe, 0x68e9bbca09d2db80, 0x121bc0c558b32d7a, 0x704659fe0fe1c64f, 0xdd42e46062eb674f, 0x1e9c33f59fead,
+0xc00de0cd5fb53560, 0x113731014f67d2d, 0x9398791f67435120, 0x4cad9e58392c6b0c, 0x1098dc996e0a2c8c, 0x779722200cf4ee29, 0x670101fb5196,
+0x7cb7dfd6407d531d, 0x4874530612531867, 0xf8b6823ca5889374, 0x18ee33d168097783, 0xf70508fcdd6ceee8, 0xd6a9b64cc83de7b7, 0x9ff6503ccc2b,
+0x62e4bb427e908fa6, 0x7efd4e2b98e5d2d3, 0x3b3b6350999d1f0b, 0x48f1461e971f193e, 0x779cfc00598604f8, 0x7c4e407b87ca0ff8, 0x17dc3a968290a,
+0xb16dd9b5a72967ae, 0x5ece008ed32ba121, 0xed2bfade055450be, 0x841133e0dca9987f, 0x478da5cc36a15272, 0x7c796c33c2f02118, 0xfc984eef2706,
+0x3d086b7d56412da6, 0x9341f3add44c046f, 0x52758b020047d1f7, 0x87a9c20b03ec105f, 0xbf12badf9a4597c7, 0x7e89bbd4456a59f8, 0x5a698dbff129,
+0xb4510499ee44fe82, 0x2a69ff8cc40c70f7, 0xb2963ffb6a19fbd3, 0x2478ab3fbd1014d6, 0x33abfcd8d30c33c0, 0x509b5e920ebb9039, 0x1683adf18f017,
+0x9d67dadfe841d1b0, 0x682f2099513d7ceb, 0x2018e6a65e1e0a3e, 0x50ff7722b9f962cf, 0x2227a8c8c5ef3901, 0x5ca88037a5cab8f9, 0x120867b033326,
+0xddf6c8796f0606ca, 0x6f759e3fc13999f1, 0xcbb9c298d1fad71, 0x7a183717d4c07ea7, 0xe1298d7bfe3dfd10, 0xd5f260f3ae6c26e6, 0x1b227b2d42a3f,
+0x7db1e6cbf4135c12, 0x776b320284faf9b9, 0xa01d1b9611bdeec2, 0xd24e51f84dd79a0c, 0x39e0523b1e74ae08, 0x39102a4fddc9bc38, 0xb6233fb1be43,
+0xf597666ced042490, 0x26c72c078db416f6, 0xc28dd957187006c3, 0x123b5bd75433b818, 0xe1dec8f7e1dc848d, 0xfb3466492357075b, 0x161b97cab1a7b,
+0x7322b0cdccb32f94, 0x4a7619a707622e0f, 0xc737aed78e9bc232, 0xa96dbe94b88c6ca3, 0x1d7cd6b447457c4b, 0xdd92902c321ecdef, 0xda6aedc2d469,
+0xc827fe6067d8381, 0xe7d39cb84a2e0137, 0x5422b7a9a8a5b8a6, 0xdf2daed444ec68bf, 0x57ff13b5023f4aea, 0xe52a0521a1aea34b, 0x1f2800c899dd5,
+0x2fa5d132e3665885, 0xdc1ab067e6a3cc01, 0x4e79230552290fde, 0x26c3e8a2a6db9ff9, 0xda19d7afd550f917, 0x4b30870ab7075ab, 0x14cbe825254d9,
+0xdfd91c6bbaac95c0, 0xc0b51560104b550a, 0x641bd92df6d9832f, 0x3b67f83b016110c, 0xa98919b6c27d3c52, 0x9d2a012b8a58190d, 0x158e3b39691ee,
+0x213c70d8dd5e823, 0x9c80024f9b2900b9, 0x44cb71e93c17af92, 0xbe6ca213d0a130f5, 0xbf761443346fd9f1, 0x34e256d35667ea3b, 0xc3c70d01d817,
+0x4d96eeff7435b467, 0xe33400529e8a7fbd, 0x650bf9ef25bb7d22, 0x6678a05eb7f1f958, 0xd9edc8a064957e2e, 0xcdee49ab84f38c8f, 0x901e3c58f1d5,
+0xc2e0a0c62a5f06c9, 0xd72cc8cbcbed34, 0x687f370c8426b18a, 0x9b6537345256a023, 0x4c7ef57ca7f63741, 0x3f8f181c15c679, 0x1cf7da5230c2f,
+0x49a337bd41c41d5a, 0x719d620dd2464176, 0x7f373173f0e8b77, 0x7ea9b5aa1d85117, 0xef2343fecd683761, 0x5008195a962d85b3, 0x1fe1be316cc21,
+0xa26e3a1c6a6fcc01, 0x80f2566bd70dccee, 0x3adc117a805e6c67, 0xbcc669c00ba8425f, 0x6fafe30b38070b93, 0x7407a4a57224dc07, 0xdb2a2bc56148,
+0x221024d2000e4cbc, 0x8acb0cd381edee3e, 0xf1dc775d9449b097, 0xbcfe40a4948ec55c, 0x59283325de5e74b9, 0x5d04c01f8f4b14ad, 0xecddb79999f5,
+0x785de11b0ef1c350, 0x6a9ec937bedf513a, 0x85505890d9bc1e1e, 0x57668567f5f56b3e, 0xbcfb9b440bc80617, 0xb2e70ff44a6d02f2, 0x209d1c43823fe,
+0x540756d8b84f718a, 0x2049fb6f311847fe, 0xf81e5ef8b148a219, 0x48c632a30c3a9a43, 0x85b70d93573d2e9a, 0x5247748393648d66, 0x161b6ec3c8005,
+0xc3e3681c89aa96c4, 0xd7df5c3dbe27ba25, 0x7942ed4a28eb0f4c, 0xe8ad0d130732a4b0, 0x96a375820516a0e, 0xefc19473cc2cbf05, 0xb5fb2f47a545,
+0xf87d416414f05608, 0x96550c7b8ab50bfb, 0x1b1f30ffacc72e6a, 0xf26a8d33e1c9e64a, 0x647000d3ed210513, 0xcfd7617c9cf3e9b1, 0x1355fa39faea,
+0x2955686fb1b2372, 0xecbb8cafe739cf9e, 0x1520e947ce036541, 0x8957d1b9a0ea67f9, 0xb9c492503c63245d, 0x95c28470317e6b75, 0x1205187ce5d6a,
+0x42ce057f72b242d5, 0xc193a1b1a25c1d68, 0x47d69d6b3adcb1af, 0xc550bf48129fe625, 0x53e424dc6ed7b626, 0xf329db2f78ecfd4b, 0x22c7aef469db4,
+0xf590b757b8556c1c, 0xc725fb3f9f81bca, 0x911db98f235e25fa, 0x58d67562f19fc02, 0x65a541d6f271e534, 0xe6fc4e604452fbfb, 0x5824ada73b12,
+0x22bdd1cdd0a70098, 0x781e164c551e6971, 0x20536fbf5eff8542, 0xe2f078274daf0830, 0xb0c25693241ece06, 0x749fb19fd2fcc897, 0x31432c065699,
+0xc4d31b795f0671fc, 0xda423a71c8afc8a6, 0x813a4a1725c0c890, 0x51d2fb0897323ea1, 0x1eecd286528af0e3, 0xb7efb25e0a7c2da4, 0x170d6c5ea1dfe,
+0xb7776ae4035c9b93, 0x9767924dfd0661cb, 0x98c775e8d4d64e70, 0x78fe3a1537f82b6b, 0xa898908e15959578, 0x2c6e3257719626e, 0xb87cf9b72fc2,
+0xb6b2559c8066527e, 0xec171ec6ec5c5a43, 0x8f36f687dac26462, 0xf114bc400d54e247, 0x4b2dc29195f6676e, 0x998cf508fcd6d885, 0x1bd0b23ff4516,
+0x2ed9684edb788c45, 0x615ecffc7cb663f5, 0x42f4719dea224298, 0xdd374e84fd5fa83, 0xb8eeb11685ea2735, 0xe9d3e29c2d98231d, 0xb7fe5c355cc4,
+0x65a55278d03c4b53, 0x310dda33a3f3ebde, 0x4dbc0dba4ff9a46b, 0x2912f50e36c1bda6, 0xba5ec594b648531, 0x9655af5824c3e891, 0x21e1fefd201bd,
+0x8e417421618ffc69, 0xb8d30dd7e37040b, 0x8e3433c07fcd6282, 0xb0e72e1ab4646126, 0x4a42b3fdc871190a, 0xb70522b4d9ecb0cc, 0x6b14ce7252cf,
+0xd14f670ed88ef7f4, 0x5111e54840e53df8, 0xa075bbd7796dfbb0, 0x2d5980508dcf74bc, 0x4077d8ac4d1fd18b, 0x2a11d0d8cc3d53b2, 0x1768586861857,
+0xa2e83874f336deeb, 0x7b8da83c81f9f0cf, 0x1c3aa63b852c12e7, 0xbc02ee2a21393b95, 0x4c3a5f4ff02fd8af, 0x2a989c2da1c3fb2a, 0xbb55c8913349,
+0x4976947415ae0cb3, 0x671117ebc1cfb785, 0x8e953ad5ed37dc15, 0x199a1add0d4e6e3, 0x8d2e3f17dff7b968, 0x2a36530a40017c14, 0x2de2d7e4cb7f,
+0x6160a71bf674be43, 0x7cae5e1aa3d1db, 0x6b9e9432bc2851c8, 0x7b56446965de9925, 0xa4106197f7103fa3, 0xc8a1c399618fd128, 0x17e2fa578393a,
+0xad0c84dd01821950, 0x9ef1b99408d9f78a, 0xe5d210638d11f707, 0x4dba29c2f0c0f1b2, 0x4eddf9a179a5c417, 0xd677ad264f3ef40e, 0x108f0e9973626,
+0xe4812369b7c3d508, 0xaf3307728a7f353, 0xb96eba96a9e80c4c, 0xffb9867faf2d9102, 0x881217bf3fe34506, 0x100014542cadf43d, 0xbe3c68f59c6f,
+0x505041911df62ff6, 0xaab84875128b01e2, 0xda15c4578b3ad93, 0x8ecc3fc262ec9347, 0xfa80e94ab11ae88e, 0xf9902d8e2aa74de9, 0x1bcd96d6ec060,
+0x9bf8358d541e36b5, 0xd8bef49a405b3518, 0x4fa197fa44b15e78, 0x2aa069bafa9321ee, 0xd447e57cda9daca8, 0xe78cc48d938beabd, 0x192a17b075442,
+0x2fc9285eb6f867d4, 0xae0cfd79520de81, 0x9ffba5452b05ec48, 0x2aaa176e2933cd1d, 0xfd2bed779f90b0cd, 0x57bc1c1dc5ac688c, 0x4bc03e768334,
+0x40c97127868b1512, 0xb7b2c55c182ce941, 0x5f31831fcb1237b7, 0x1409fa72d70d040b, 0x344b4277ab08dd0b, 0x355669433be24660, 0x73edc623911,
+0xfd9dd537156be0f9, 0xeb1dc91ea897fe4d, 0x9f92c851c580713f, 0x21b857c72ab98658, 0x309ea45c6719c9d5, 0x90533133e30f7ca8, 0x119ec63f029df,
+0xa8d737335977b4cf, 0x1b6706a4b85a9fdc, 0xea21beb7adc4ee0e, 0x8b72fdf6aa84a383, 0xfa3a90eed3ebff00, 0x8a0ab09cb3a3a907, 0x5661a822beb5,
+0xcd8b9b2dc8ae4882, 0x273d43629e9a36dc, 0x2a83a3ff762af7f4, 0x8b8351bf4561deea, 0x23de222b49d4b29e, 0x9eaf83f69d41d3ea, 0x15194378b7d39,
+0xd84c62b68c2852cd, 0xad6d8573f5c09ef6, 0x134e076a135a0812, 0x33515d88371cc9b2, 0xaca630fc6c242f97, 0x431a5eec7d151056, 0x1ecde0bc89e8a,
+0x1230ffa73c225df0, 0x6041348da8343e08, 0xbaadf494d46a2fa0, 0xe9c62319984679d7, 0x3192aca9100f6bc2, 0x740188b7cc833614, 0x1f2294e7c7b68,
+0xc97f39067075c7f7, 0xd8b487fc90b29d5a, 0xdc0b59b7fb54141e, 0x7be8b53eb2a3f2d1, 0x5afabb73a909e615, 0x11e04649669933b9, 0x7d6e8b6d83c1,
+0xed84c4690ab82a73, 0x6d38f38a51fd6294, 0x4ae42cf787d4bebf, 0x55381a9610e9c96f, 0xf713f1ed4d090e7f, 0x93aeeba4d2208fe, 0x15222eb4e1382,
+0x8d27eacd16071d43, 0x35f34a8eaa65e5c6, 0x2608de5f32a86b89, 0x12d616d9ec449243, 0xfdddfb8dfa676a15, 0xef9c6108c48b0923, 0x1c17155134099,
+0x8b82d9871d4ed8e4, 0x744c3abab959db42, 0xd416e4e063e9c401, 0x233e132275ae059f, 0x556f2a864f9c9f9b, 0x8a020ab7ff25acbd, 0x10cdb3f48c5d8,
+0x1e5416fc730d35d2, 0x99640ebc0d2ef346, 0xdcfd9569b6abe244, 0xa038b34858dd2ced, 0xfafc164f871d468d, 0x2dad79e6a2fe3736, 0xed92e1962ff4,
+0x294b10958019e725, 0x37c15aa55d115050, 0xc2224c2189d680d9, 0xadbb3ebd56e233e6, 0x925e2548a6fa624e, 0xd31acbb7890a0831, 0x199405b70432b,
+0xc39c2b80d9d58713, 0xae62b50dba54e504, 0x11cf0b68bc2e7250, 0x72834a57313cdca5, 0xf5f5c058d4afeddc, 0x152c82f581690518, 0x62978d7565d9,
+0x31b1bed610af8a92, 0xa8d65a5709fb66b3, 0x71d285f6b22fffa7, 0x329901aed15e2032, 0x7e9a24a9ed0f27a5, 0x4d8ac68628394969, 0xc6c54ad30f6f,
+0x651367a7fff81fa4, 0x8af7bcf4c4206a07, 0x19f6d8d6f2057bce, 0xab1cef93daeeaa40, 0xddf23ff3a2a1df2e, 0x36761030b9a49a4, 0x6ed23a14590b,
+0x3617ebf0b04439fa, 0xa9a516f5380e5adc, 0xaf80694a4d20fdc8, 0xd8c41eeb06cd51ec, 0x90ca4dce6dce1953, 0x896e5bddcc87ce22, 0xcfad991f2a2a,
+0x3fbfdefe5548a80a, 0x77f404f7ce44bd, 0x378bd711c379674b, 0xf948a4214b4bac81, 0xc237506497a70c72, 0xef30f87a5e912df2, 0xe03c689c1036,
+0x4cb8140d2c2b90f, 0x3efc165fd5af5910, 0xdee61c27a4c36b48, 0x4d87d0150268dea6, 0xa8fda78b71ddbce1, 0xbd0e938f1dc1b493, 0x224811c931e0e,
+0xa41e6767acfdb79c, 0xf45d32ac8bf0fd55, 0xe9fd6179de5c2362, 0x18f1a471c4377ed2, 0x5b18b74cb4f3f41d, 0xd8138a9cfe59ce4b, 0x162e5ff0cce8b,
+0x4b92cc502575f47b, 0x64bf82e6cd3aa8e8, 0x70a8fe0834b9e3d0, 0x7b4e3e10f2988f0a, 0x6bd2ec2025b0e906, 0xbcb9382b9d0825ba, 0x16a11c5d40bf8,
+0xb0edb165afb610f7, 0xb47a182d9ad0ffb4, 0xf609ce52fbb08dc2, 0x7a07944d309f94ae, 0xbc8cbb5bb2b1b883, 0x1cda94fb2cb21cf3, 0x352b2688c0d5,
+0xf5e9e6dd9fba41f3, 0x633ada687d9db9d0, 0xf8f15d94b475cae4, 0x1e8a46be2ecfa93a, 0x9f2a095263bba89e, 0xe6cd8931f8249ea, 0x3212df74bb3a,
+0x17f258163ca29788, 0x869028996b40adc, 0xb87ee9bbeb639d8b, 0x61ae880d69adcc27, 0x1bd3064540d6bb05, 0x5fea800018b7d799, 0xd060413f3382,
+0x5b04cb65d55f3f96, 0x8dd22894a05df4d8, 0x253897a066fd2b71, 0x903cc7ffc35eae71, 0x1c65da85722e29d6, 0xb2e41b2acc90e899, 0x7f74c5de26cf,
+0xe4377aeaad7f06aa, 0xbf8b15fdb9a2323f, 0xb9617a73a12fea5b, 0xd11d9f816c2a06c8, 0xdb61b65a4aba6893, 0x9e490a2b1b33e9b7, 0x15b6694c931cd,
+0xdae6c1a55adf3a5d, 0x5a48ebecb2fc462f, 0x2cdecb610ddb99d9, 0xaedf0e115c005489, 0x6cf4d71bb94bf882, 0x722a6a64361bbcb7, 0x173f8f99f12a0,
+0x96218c8e6f891e35, 0x8a579ca1871a7ea5, 0x79d72419f98dbb6c, 0xf5ea540839434b65, 0x267be9a090c1ba07, 0x93182bd2e574c0cd, 0x180c0113c9833,
+0x942e3c14ac61a354, 0x282f439a935e1126, 0x74477aed66c776fb, 0xe11fa7431c3f4eed, 0x1bb5bd54cfe9f5b5, 0x49171280081ac1d4, 0x2233ce0685bcb,
+0x9c270ffcd1bcc480, 0xc2ec619537887025, 0xeb7934948660c791, 0x1d7e01612b4ef1e5, 0x21f60806b5eb395f, 0x757f2b55d591e13a, 0x218525b54847b,
+0x5446ddc3f56c7482, 0x2009821f67108fa4, 0xc0a5149e80a9ec, 0x72dae8243a43b25e, 0x2bf869424c407149, 0x167fb87f28a6f603, 0x55642a1b5d05,
+0x2d04b8eb8b46650, 0x6650ec603c42276d, 0xb925ec4306f1df64, 0xeb038ebe4c18402a, 0xcaa49e2dcd00e9d2, 0xfc01266f1a4e3c0, 0x2a8176613d1e,
+0x96b82e489abef4d3, 0xd13a3f5bc1fd6b39, 0x2b0d202b8fc9bb91, 0xd9c9999710aa3748, 0x536ac2d95ba299d5, 0x7212819d34e49e5d, 0x1e67a5266b867,
+0x615723a0ce72728, 0xc31d10bc68f1cb90, 0x8fa84f7a59aa23fe, 0xb6c6729cbb944c9e, 0x6548bfed48dece1e, 0xf3e2c0ca66d5a99d, 0xd328abbcf40f,
+0xc3e5700b31021ce4, 0xdbd57faf278e060a, 0xcbd47b9d46678953, 0xd251b9ba6faa1aff, 0xcfa38b6db632a82a, 0x2e332b2c7a3dd27e, 0x153ccaf210c7d,
+0xf7347e70b5f34dc, 0xb9f686c3e739a147, 0xfaa7ec1c54eea832, 0x7f1e5f3729313d2f, 0x6196c9dd038ecece, 0xe8046d1025b42dac, 0x11cc6de716ecd,
+0x8662136baad5d10f, 0x932b00f18ef00ec8, 0x8379331293ee5f55, 0x857ac1d1eda02b7c, 0xda77064d12dc446b, 0x13d686f47c3d7c17, 0xf1b907cfdf49,
+0x2d9b3ff8e06fcd18, 0xf10f51b8c6960265, 0x34c314af867507ac, 0x91afed71b06cea39, 0x406d8e87d86ca96a, 0x26458ec584eed170, 0x1c864f52f5358,
+0xc37dd8a01e25701, 0x95c621e13d2ba7b2, 0xac8bdc284e181122, 0x6c7ef23c69b4d27c, 0x2230799ada27b11e, 0x502d3c08f0fd4084, 0x185d52e473521,
+0xbd736ed44f9a85da, 0x13cbfd1e4856ecda, 0x7daed5af1d3cb32e, 0xf931249c92d7a1de, 0x6e105638181fa853, 0x885d6f84a5308e80, 0xfe6dc40e005d,
+0x5a9601895454d04f, 0x818abb4d92466c39, 0xcf3da75308fddae, 0x6b2a8e69aa92b005, 0x7158c0bbed76093f, 0xdd3f2fcc192c8b99, 0xe8308b980f06,
+0x891f0a1aa87bf878, 0x52c9c8ff05dbb623, 0x7b171c36760bba9c, 0x8cf614bfbec9d08c, 0xf06b4a57c513618b, 0xade8b187351e2f20, 0xb0d484cac2f5,
+0x185a2d194b2b4bc8, 0x312dbc7c30741d2e, 0xc1b1fc00ef95809c, 0xc3514a4886ec0de6, 0x90c6b40a49e315f0, 0x9122a6a6a8a4743e, 0xde85567b2268,
+0xffc431235873d2bc, 0xc70b4e001a716aed, 0xc793b6dd9f077e3b, 0x624bd41a094e4366, 0xc2b920f1691c6867, 0x73377f63f70ce50f, 0x1c6ca7c72f410,
+0x8b1babe7e763a032, 0x2a347a08c6cdaeeb, 0x5f65da44f6772e01, 0xd3f421c92bf73437, 0xba574067e19a70a8, 0x738474826b5e6b1c, 0x14bff890ce7c9,
+0xcb141277db2cc7a7, 0xd69efda80aa1a3df, 0xcc53d2a4de4b0ff4, 0x38a6048739399942, 0x7bee9b2fd8d6700b, 0x43d772038f9657c7, 0xcb24e4d9625f,
+0x1dd80f5ecb9db352, 0x733b6275ffa566ae, 0xba0c16e49de565e9, 0xdd1ca1018e02ece8, 0xc595136f19b8bd01, 0x318031809bbba864, 0x1cc190f4c538c,
+0xd8d31d5a5c5e10ff, 0xa78848353c79815d, 0x2357404eed94d74a, 0x5ec0c5083dac3ddb, 0xdb5a22b9291a9dc0, 0xc57712bc4f100159, 0x2333511b5651d,
+0x67596152cadc8e33, 0x31c733ad866720b6, 0x594ecf57f13cb161, 0x730481e425961161, 0xa36e3e0ec426066d, 0x44f21a3e09c6ff9c, 0xf5ed7fdcece1,
+0x96c6128b573d8e4, 0xcd83a2e21b13d5cd, 0xab5a352e7f8c3279, 0x84f193a97eee76bd, 0xfcc3eccc1a3ea40f, 0x6776a5f386a2af06, 0x8d3ee7fe0be4,
+0x344fb30393630131, 0x4886fabba26e1da, 0x59554b2efbbaa937, 0xe32852f927b6f509, 0x7000cfba1211c6fe, 0x5e1b274c397ad96, 0x1c2e01496072b,
+0xef7c87e98c83ee2a, 0x1c2f654fff31e7da, 0x77288f0a34fe181e, 0x2792c82b3038d630, 0x811613a02128aa19, 0xf7bc9c0200a300a6, 0x1d57e73f7a887,
+0x792a69ed8497412, 0xe0d0e66ad24a1861, 0x3cf096607158a611, 0xcc3cb994252c534a, 0x6e0c79fa3a580358, 0x8e1409e31356d098, 0x191dc62ad9161,
+0x2b52c6fdfc10ceb2, 0x60a5cba72fadd209, 0x81f2c6878f7b07d6, 0x18e6f3da931f0782, 0xb9ec1980d9cd944d, 0x972b9264a47c412a, 0x1be1bb6a8815c,
+0xb8f360874e375b24, 0x4361b9d82f2041d1, 0xe37b3a92425c519c, 0xa289ffd4a6ec1348, 0x3e3d9935730808bb, 0xae39ff94e46a839a, 0x13ab5db56efc8,
+0x1d56c59f3c74f82e, 0xcc3b4e9618ace650, 0x834b326e47703d74, 0x2636aed389d829b0, 0xde296723b77ad2a, 0xfa539fad566245d1, 0x189f64cd83969,
+0x3301725fca08a606, 0xf552b8c37a1c695d, 0x8fa1ec311dbe0c12, 0xd1c6128de1fd33d9, 0x72a6306404a07f8e, 0x8c72351841a07f60, 0x58fa6c02eb0a,
+0xb321631376b9a18c, 0xac54741ae9181e12, 0x7c8f47cce60aaf64, 0xe0db5b8c90c8ecf4, 0xdfa70a94209c7298, 0xd5789f2527b9a2fa, 0x74ce88170747,
+0x66b6062bc8c478c3, 0xe5c7bdab21e68dbe, 0xc9aeae668ee36f08, 0x4f1d5bb0789883ac, 0x1e86e10b9e3de371, 0xcf8ac6677ca82ccd, 0xc114378e3961,
+0x79453530d216481b, 0x2aa91975ede6bc6e, 0xd5501abdbc753888, 0x24ef3f2edf73a61b, 0xa492a521e77de841, 0x78a5e9afe3f10c0f, 0x1f588156c86e8,
+0xfedcff0a217c20cb, 0x3e4e3865f46ec2dc, 0x789e526b79049b3f, 0xc69e5030784292cb, 0xa69c18a3fac2ee6d, 0xb913e811368ac4b0, 0x806fd7108523,
+0x5c75ec72e5e2ea72, 0xd30ae256daaf7732, 0x6f4e552a83bcdc79, 0xaeb3b5c067bfb888, 0x5234cd3356ee6c06, 0x7b84b7ce5b26935a, 0x1715fade38537,
+0x3d96a1d2e5c0cb16, 0xf1a6fe6234683a07, 0x4922a4c8d5d45fd3, 0xbab05040d93319c8, 0x945905a2704a5f09, 0x4c1ed287d3080169, 0x4ab8739a5054,
+0x93cdf380cdfc72be, 0x6a3a708a32670d9e, 0xd80fbecaa508a005, 0xa64e594046fa09fe, 0xf01b67eb9af27abc, 0xf0aff842a97e1fc7, 0x1feab9532832b,
+0xb59b05842e8f1a9e, 0xef1985fde38e9b0a, 0x9319894ff9de5b29, 0x196d2aac97074aaf, 0x4e044f7e4de52c10, 0x9218eb8dd894b4b2, 0xa7425a2381c2,
+0xf93d5ba24a92b2cd, 0x651fd7c541f46236, 0xe134367cc3a33aa0, 0x8633b2da0962ffaf, 0x3d9412244cf5c643, 0xaf028237c07c5242, 0xf222b273a846,
+0x9b76e04f09140ad9, 0x2e71b708b4722421, 0xe9059e04fe9d6714, 0x94c5044515bdab28, 0x98916c94948e3de1, 0xa05d9d1138fd824a, 0x1fd565729ed6f,
+0xca109c31f507c4e2, 0x7210fde1d1a61b12, 0x250cd680617182a2, 0xa171c632579a5154, 0x4277313f526b8271, 0x58188b1fce72762c, 0x215568d22c709,
+0x84b5c1c975fcf115, 0xc8d1ead22c653c7c, 0xe59c5907f11ba84c, 0x2e15ad874f5dcfd0, 0x5b87329e9480952, 0x4c5d1d5843195a8f, 0x318d88ca6b3b,
+0x29c316299c155780, 0x66c4b326270c1eb1, 0x61ae4217eff99238, 0x7a44aff9075860b3, 0xaaef4f60e057439e, 0xef1465087fdfacd5, 0x1c0cac3b99905,
+0x911404a24fa9cf2a, 0x877d172ad5652ccc, 0x5882cb179c6e494, 0xe5f6a8e5b81ec84a, 0xcbfaa77145d47e9f, 0x5daf1cf0ef05d625, 0x703949c3b7,
+0x56df4bccfb040ea5, 0x91599dab7df264c9, 0x359f14634cd0a7a9, 0x66fdcf4059e54913, 0x44d2bd2b601a3824, 0x1cd645fda7b9e066, 0x19bd59cb0b4d6,
+0xdd296c31b9ed73e9, 0xdc8be38242a09deb, 0xdcab86c5c65612b9, 0x63a1beefc4c2943d, 0x5fedaf03587f01a1, 0x3e698cf944037fc1, 0x195e4358a8720,
+0xa47ca10a9cae321f, 0x56070773785d073d, 0x384e8281497b6e72, 0xcc9f6b3d9a7bad02, 0xe12d0f81006a4ba2, 0x3b701bed9c855619, 0x17b4459052a4e,
+0x1baf361e2e707376, 0x443924712195aaa4, 0x54bef313e4b3542, 0x48ba39e5e03c246, 0xd6faad0d388ee7e3, 0xf8db9b65b3be61db, 0x2219dddbaef36,
+0xa00816daa6ea9217, 0x65f46b009e533af0, 0x46ed4bba27378a48, 0xfe851b2fb7e2e0f0, 0x29e8ad265dbe4883, 0x240ac829c8e61cb, 0x16e21edf642be,
+0x19ab3ac63ee95a64, 0x4bbe38297a1a4aba, 0x3d3448482862d61, 0x584af27e0d731b58, 0xb631ba8db2f26605, 0x783641d30d7fff17, 0xe66f4574fa5,
+0x18123fb1bfd75296, 0xc4e1cc7da05a60de, 0x30091ff2223bfa7d, 0xdcfc744776429d7c, 0x5ee57631c4ff1d8a, 0x2da596d026947dca, 0x6f705416bd12,
+0x20a58f00b4ef37bd, 0xa601dc876430fd2e, 0x3751da8e72435b83, 0xaed73b0b146b30af, 0xfa7d6af3c4759b05, 0x9a12c35666036f84, 0x1648a432d0286,
+0x50be413c2a01fff6, 0x826183191696a761, 0x8a4daaa7a5e28d33, 0x1594862a3a4a72f8, 0xabda1f95096a4ba8, 0xce74a203d4846976, 0x184dfb66f0967,
+0xb198604a72c9f13b, 0x6c9304a38596f64, 0x282fedf10a7b4c85, 0x81ce6f4df8013e50, 0xdd3bddc74205af90, 0x9058f802e540bccf, 0xc2af7a62f165,
+0xb71f02a4721511fb, 0x3e3adab1bfb37c0a, 0xb35a9956d5f9595e, 0xa2fb2db18099c862, 0xc5c2c62ab19d4b4a, 0x39aa128f6500904c, 0x1fce6c63e4294,
+0x5cb9a9940219d32b, 0xeee2ece6fb82ea64, 0xbe1b33564e058fd8, 0xe47a98b5c2433561, 0xdd76b7e73ecbb478, 0xff94b02509ad7462, 0xcccbc9406e15,
+0x7ec4aa8742853b84, 0x5576852beef53a65, 0xf3286639cefeff90, 0x38531c9e366c7703, 0xcfbeaf8b1d8c37c0, 0x8774306d1abf4195, 0x174238072dcff,
+0x2f92cc5c2e6e7933, 0x8dc25a46febd24a0, 0x3e3f7af1955664d6, 0x2a7fc9b7f32e8d65, 0x68cd5ae22015465f, 0xefd4e205741054f7, 0x2217e12dff06d,
+0x9a6180c004141a3f, 0x569c2ea238872438, 0xebf744cd9a9bdde0, 0xfb8309be50c61335, 0x81011f8d8f1b7035, 0x6362a4955c951ba0, 0x1f7946e56656d,
+0xf2f2dbb4b62469bc, 0x18ed2333b163e2ec, 0x1dad369c47e278fd, 0x89def6ae68dcd8ee, 0x42391e12269f8d48, 0xcf32664dc64f0893, 0x9b060931c965,
+0x63b1a194e5c84aa7, 0xf5fb0d9fc6e49617, 0xdffa0a231a8ba54c, 0x8466f2cc9cbffdd2, 0x3b2604b198d7c4e, 0x61866c03ae9d339a, 0x6331c24c4b0,
+0x7061bb9867860aa6, 0xea99322f6683d1de, 0xb39d36dc50828f44, 0xd6f136407f91e494, 0x20bf67ccf26b8978, 0xca8514b94e447903, 0x11fba3afa5fd4,
+0x1c12a1858aa945b5, 0xfd1f0eb6cd9e6e60, 0xce81e102fcf0f44, 0xa52d09ee6f66bc8f, 0xb34ca9bd57f08af5, 0xdc543e737951a65e, 0x158190c80a911,
+0x4f2dd5bf193f91e8, 0xefcd9ab6571b6ab8, 0xaffaabcfd70bf8f6, 0x21a0536ddeb93579, 0x1f6be2923feebcc, 0x660fbc4ea497a8e2, 0x131fe4884aae,
+0x8875988602446a39, 0x5e250c9277a60d7e, 0x5d6013998acacee4, 0xb9971fc020efeb16, 0xff3451ca2a926348, 0x12b53853217c908a, 0x69040d20afdd,
+0x78369d9e3d68d910, 0x1aa7dd6d0f9414c6, 0xed01d1ecab572760, 0x3a26656768d63c40, 0xca7ebaa6cc3e7148, 0x4ff0f6a9e1290b26, 0x2794588cacf6,
+0xce3e2a2a49611af6, 0x7cebd59e796d1437, 0x69b10817d26287a3, 0xb28320b632f931df, 0xd492b869c167674f, 0x3ada0291a66e8cd3, 0x125559be46142,
+0xb1bb92787d4363b5, 0x1f1f9201a53fbb66, 0x25a1c0c6bfa57910, 0x79b89f7a65701d74, 0x6c43ba6ff874bdc3, 0xdb74e13817e80bb6, 0x20f708004459f,
+0x84ec6d76d5d72e8, 0xbd0b945b8a120692, 0xf7b5bf161941204b, 0xfe7271b99c09433f, 0x209d2e4e00640ea0, 0x72620b5e593047ba, 0x14759a634c47b,
+0xc96264940033b392, 0x67ab5c12b0e89383, 0x80fc3cf11f030226, 0x5efb8970a8537f98, 0x93945d770b518939, 0xd2b6d977709fe93f, 0xa37f55e3816c,
+0x897cf48e75ccbad4, 0x9af516478857bade, 0x57a9c60e4c6cded6, 0x18d395caa777a044, 0x9186ff2dba87016f, 0xb4b588b15ffe8e7b, 0xf803fb92d7eb,
+0xd084c86c232578cf, 0xba6debe06659a5b8, 0xd96ec5ebc4fd92d2, 0xdda615e4ca01f840, 0xeb81476801976947, 0x7bd8483a8d58dea9, 0xf36e01a8c7b4,
+0x90b9e3e53ab6b50f, 0x33a01300a0b6c683, 0xd172ea145222f28f, 0xe1b34726609de5e1, 0x5b0542a405f61af0, 0x990a6f17e74af149, 0xa60836663ea,
+0xf72f85eea881617c, 0x380fa9d84ae7d376, 0x709a70d50c88ced0, 0x870d38a1e73c5449, 0xa029a7bd2bb03a81, 0x8938369b016e7f2e, 0x1c48aba9c7a39,
+0xfbfdd18bb1f74feb, 0xe8989fdf47394102, 0x1e7a1f3cf7e68078, 0xfd8ead13909d5307, 0x2451f6bb6d3f29d9, 0xdb69f43a6f6ffddc, 0x15b6aa0ceb8aa,
+0x5544af85f2641cbd, 0x9b5d50bc49a3fab, 0x6f39444b5dc3547, 0xc092ed8cdc505214, 0x633b72b83cf49978, 0xca648229f21961, 0x14e883f03665,
+0xa3b2e8ac1fc98ca1, 0xe63806c3fbb37803, 0x6cec621339138a79, 0xd3b3f5401616418a, 0x851a70f01e2ab5b5, 0xb1caae8ca0deee4, 0x1da0859b47758,
+0xb75231377afd9e10, 0x87d527b4ee4f68bd, 0x2cbb02d3bacecd45, 0x813f1d8f7e53fc69, 0xe48e12440a40e946, 0xfe1dfb11006578a5, 0x111445f2eb55d,
+0xc838687c215718b4, 0xbb8339ebd28c9f04, 0xc6a07e7c383878f0, 0xfcd7014fd7cd65ab, 0xbd861b68ed18cf03, 0x1a959549455b04df, 0x222bce769e124,
+0xa52048eee6a059fb, 0x5ad52d7bc03a9cd7, 0xa4fb4952998b1ac0, 0x644d6bdc91b9e344, 0x64eed32747785b80, 0xb596c18b2eb34c14, 0x1c1d0924e2da5,
+0xcc2d52cec3c1f816, 0x4419938066ed377a, 0x3c3cb8e9dbc483a0, 0xf3c1e301f12675e7, 0x898956f40890ac34, 0xc2b5bc060643d8f6, 0x19d8536c49617,
+0xb8032939b70aba4d, 0x59e3633a43a82eb6, 0x4075e7c73b38b361, 0x1c02f2909d9f2407, 0x928661dbc5aa1607, 0xeacb3042e8f9af79, 0x1ce5ebb85f4b2,
+0x9173e9807c5742f9, 0xd4b98ca523946825, 0xc4c0c3be00204f03, 0xc3c642a4a471362e, 0x8505777238034899, 0x485a318c62516f2a, 0x41b22cfb069b,
+0x840a43e5b32566bb, 0xe2c05fba19743cf1, 0x9efbca0bdaa45da0, 0x3f29f1f29945243b, 0xd183098e01ffc1cd, 0xf2d0b056b41c8247, 0xf0c5c9bfe94d,
+0x492f950b83aa2d3d, 0xe0f391f0fb310189, 0x56a7a2facff5467d, 0x8f5c35df7a409eb5, 0x6034cd85714e1f18, 0x90ab36cbf3b5e776, 0x1feed614f0614,
+0x6e91477c59fa4ee8, 0xc8e2dd90b3bd9ec2, 0x28850100d466b5e, 0xbb79b751fab216c4, 0xb8074c83712faae, 0xe7a3657825b19658, 0x8be076de42f8,
+0x2412c4d8f40bb1be, 0xa9184fd99a65ffa, 0xd43419190c2b43bd, 0xa24f697734ac56dc, 0xa91372978aacd697, 0x6630ed6d7934789d, 0x15b52d7d0492a,
+0xe91a6917eac8d567, 0xbda528d01c0b56f9, 0xf5bfac1cb85c266, 0xb6af367d1248356b, 0xd2d156dda29aa910, 0xf7df557e4e69bc6d, 0x26df91147a26,
+0xc4dbb238991b95d4, 0xa84a9cd31618f981, 0xc60d92d29ccd73aa, 0x8e719f617d2d1d0c, 0x350e705b75182b5d, 0x180ae75e83e7c790, 0x60ed8cb0f932,
+0x53b560a379c83c68, 0xa853ef42ffeb381d, 0x6b70947448c51cea, 0x61de96eaefaee44d, 0x64d50c936220b5bb, 0x6adfc1a17bbaaf27, 0xc69fca30dad1,
+0x40374c8c50441262, 0xed0595afc00b601b, 0x811632664c8ad60b, 0x393d1f4d8679986d, 0x8a680d6e8e4fe094, 0x376091e7216dc7c2, 0x13ae163d957c2,
+0x15d41849857d5396, 0xef9dcba55c5d84ff, 0xbfbd17929c243d85, 0x2eede026a6179644, 0xcf44e7eefc0bb912, 0x5678dee7cb2a9295, 0x1653189ff1c75,
+0x106c27cf164a96a2, 0x12eff8e947d1e628, 0xdbd7652c479a6bd4, 0x5358e95ad316dd95, 0x5df41d961c089569, 0xd9c2ecf24b766cac, 0x10d7768db9583,
+0x266838def1b60049, 0x629a823d198008c0, 0xa6b089a2199f1557, 0x177c10093a0a4364, 0xdcae43ec30e2f2e8, 0xccfee4a7cdeb2d3f, 0x1b87bc207158d,
+0xb9816acb7cf858b0, 0x88380c01ddb4f083, 0xcae0fc4b2d4cca16, 0xd7ea661a93c755e, 0x99c6a5ecca153fed, 0xb986c22d3883b822, 0x1ab21885a15fe,
+0x62dd026b1a32eac4, 0xac457d7c2180c17c, 0x32d9db044432cb3f, 0x11704324ccf918ec, 0xa42cb3df429da17e, 0xc9f5d7e644242b5, 0x1b47859d3442a,
+0x498029135447e06e, 0xdd7454f23e32f84e, 0xd782be5aea9412bb, 0xd4ac37e898a1c1b3, 0x4958cb16d24102a, 0xfd46ae34065f9355, 0xfe0ee3a7fccf,
+0x5c0d0e4262891c9d, 0xe35d9410c72b3f06, 0x36154b1e2c44d721, 0x1c93052a143f41e6, 0xe035096e2bdbed67, 0xebffb490dd949d01, 0x1cbafa809da6f,
+0x9e309515c2cae3f7, 0x2cbb7bc16c1f10fe, 0xac513c47b4c73fb3, 0xd9d00c7695553f42, 0xa93bd6a73711c79, 0x1e6bc952858fad8, 0x8630830c7ac6,
+0xf5aa31c615c1ddcb, 0x82e28fdfe7b4b734, 0xe006b7e5cf898422, 0xd4b7fcff111c0fc9, 0xfe69e0ebc9c09ef6, 0x4056102ed50af5a5, 0x1abd05e885dfe,
+0x6e2632b68444e029, 0x9822bd569d1c0df7, 0x218ae01b3de07653, 0x21043d2914a7b49a, 0x4bcd25687429d806, 0xe7a33df7aff1503f, 0x16252082cd18f,
+0x9d66c2192bafd468, 0xe6e644475e3101f, 0x96312e36ec641ce3, 0x1426cbf3eb810ab5, 0x44a27785015bf53a, 0xb374eefa24c36eca, 0x1b80ce9fc5ca1,
+0x958528666e03c7a5, 0xa72ad58fd56b5a5a, 0x8fd44139668f0892, 0xfb92fa96af0f6f97, 0xc7a942bf12ac8c17, 0x72de87fc56b565a4, 0x13f39b9ee63eb,
+0xce5683c07f0537b7, 0x99e05e01574a7d2c, 0xf7f1b9710a1148a3, 0xf39503a6bdfd7381, 0x38b53e406fbf61b, 0xbfdfcf7a3a756a94, 0xc78a0c9ec43c,
+0xbde9c10d4e5b4346, 0xac952b233d64cd4c, 0xfe6917773a7649d1, 0xbef83e17ff100182, 0xe71a46a0a1f82fe9, 0x575171194940d20e, 0x10ed888cbfc69,
+0x5f66a3cda2ae3160, 0xe98b7d120c7896a0, 0xe97988a77fe79caa, 0x238ea03beba4a479, 0x259115d7a14aab0d, 0xc050613d79359f62, 0x3a82e5e7dacc,
+0x94e8365f8e5d8547, 0x84de640a7c48f489, 0x787d21b48f4ec2d8, 0xf30c444c5423c6e1, 0x658548eb919095d3, 0x6ba37f1ab3a4eddf, 0x11afe0acbc142,
+0x7b387b7ec1d23d6d, 0x300edb7baf77547, 0xc79b17842e567cd6, 0xb1276dae866dacec, 0xa406e6bd6b28c8bd, 0x2931ffe279514d07, 0xab457b4c4d6f,
+0xd7daf0e1e4791ca4, 0x86dc0fcbd05c34bd, 0x27b3e15d30916543, 0x5e25d89563828e0, 0xcb00c3309eb0b196, 0x8bbe0b828ccc2a8e, 0x642f9b74ff0e,
+0x7c6413e524544c77, 0x8227187059af836e, 0xde15a134368ebc63, 0x7f56f48ad65758ca, 0xe840dbaf37cf390d, 0xe33bef79cb016455, 0x16ff501b3e302,
+0xc3205289f4a65b27, 0xba178030041644b9, 0x3be5ad44ab7308b9, 0xd6eefeaf7258dcd9, 0x1e1e23cecf61ac7b, 0xf4fcf26d0b44696e, 0x17f6c821b7155,
+0x2ef7db4328d86548, 0x64b2da9ee9d84176, 0x72bc00b323938f42, 0x30802bbf73f67bd6, 0x47a29bb9c3a70211, 0xaacc88fe2d09e142, 0xfa92a8fb67b3,
+0x49e3019f8e271b0f, 0xac295449e96c228a, 0x44d74e83e590f016, 0xee6633bb0a947a75, 0x16ed911a40ec0195, 0x89186c08e4e17f14, 0x11e64a6cc69e8,
+0xc752346736f26012, 0x5bf9673365118d0f, 0xe74b8a3634f749a0, 0x42e6ca655418d6b, 0xd8d34612684fba0a, 0x859d054a397a8b7b, 0x13ea0bce83751,
+0xe23fd65f84c86abe, 0xd9b1cfc265c81e54, 0x2da37192e74e147f, 0x32edf8bea003be61, 0x7a4b179c0d9870a, 0x4f57fe7b906545dd, 0x7455c794df8f,
+0x2595198c97619df1, 0x3061857f9c4d3041, 0x26cfe0afd656de9e, 0xa56a041f23bc5b97, 0xdcfd35ff4d163d05, 0x10c21a8c2e205785, 0x224d5bac63e2e,
+0x8d53a177bac00d76, 0xef4dcf22e3f8440c, 0x2dd4ac4c990ef68b, 0x95ffb7655fd62038, 0x95b1ef03a0ebb87b, 0x542b771adef504f5, 0x2083521aecd22,
+0x7e447950d1adbdf4, 0x188305019061b4f, 0x3d034ca6d6cdbdfc, 0x7f73b46f9300b1e5, 0x65a23aaceb878c9a, 0xc4efc3708052002, 0x5b4385eab318,
+0x71dfbcff0cf50af, 0x1f85554fb0ace1b9, 0xf204d78e2311c8dd, 0x20c35a48c262433c, 0x1d099ae071aceb6b, 0x47f94e96192cfbe9, 0xc5fdc1bb0a5a,
+0x5914193683671acd, 0xc45be47bd805bd95, 0xf0e6b8871fbeaa32, 0x62dabb31708e7ecb, 0xfdd6c09ce3242173, 0x1c1b9027b797e47d, 0x4035549d5f2f,
+0xd94d5a6e91f54671, 0xc1d903590184f15d, 0x8b384ed0d2ddc276, 0x6ae0d1133619b270, 0xe087af32deca886f, 0x34105fac40c66019, 0x13ead1b1264b7,
+0xc0be887f43621725, 0xed7828c0fc90e20b, 0xe36952286d4996d8, 0x5c96bd6a95d176f4, 0xb34bb79839032fdb, 0x42ad4587da19a7ab, 0x20779fd0dfd22,
+0x2cba94c903ccbd57, 0x8a00023872e4792c, 0xb05360520fca2126, 0x41ff6c83df9d11b9, 0xd5634505ebfa8701, 0x321bff0fc77bd208, 0xf37c451664d0,
+0x57c5dbcf164ba2e2, 0x99b23b60312c8fb3, 0x757372a364da9066, 0x1097642f8b77191, 0x288895b0c58a17db, 0x4a4145ae67e870ec, 0xfaf6ec86025a,
+0x35b64bd8f49c373e, 0x32190227c4ea5328, 0xd3af06eb1747af85, 0x1fa76f4805405450, 0x7b376a2823e0fba5, 0xbfa72ec79dc89aff, 0x15b74a5564fe0,
+0x401a1cf8a83d9c92, 0x953cc4c4c3fddb76, 0x1c00ff6007e80678, 0x6f4fa09402088370, 0xe736a5f1dc2823f4, 0x1dfa7647c2bc7625, 0x9f8d8505f11f,
+0x72f5f02cfd1e153, 0x990812811d4010d3, 0x444460dfd73b32b8, 0xd996a11c5d49a198, 0xeffb67d7e98ad74e, 0x60bd3c9bb972b7ae, 0x1766dd2b36fb6,
+0xbc64d321c862db2c, 0x14775f57bcb79f1f, 0xfe96a9e061f38971, 0x7914b91a6b1b7aa0, 0xe74dccd37052f499, 0x7fa5488080841d3f, 0x1e573ec3e00bf,
+0xd6e4066791e2250f, 0xdbccf0b559f7b64a, 0xc92c50a3c975edb9, 0x8e44264639152753, 0x2b9971ea0eb32a33, 0x95e9bb7892df98a7, 0x1408fcadb5b0,
+0x44da2a7f037055df, 0xd530bdf054cb57dd, 0xe0b14c10424836a8, 0x7c0095b93711e417, 0xc1c1ae453e83adec, 0x5329ef001a9b95c0, 0x7facc1b28a07,
+0x75a42c29c49880cf, 0x529752c5057c0fbf, 0xc6e0f6d5a0b4b868, 0xdf143c40c22dc85c, 0xc704dd11a8c8f12b, 0x25774564a18fdbb2, 0x183e1a0ec0515,
+0x21b241a17d47dbb6, 0xd2e350bf86ca1101, 0xd11f1ccd952959be, 0xd2774f193db3f6e5, 0xaf572655db6af34f, 0xce4e83b267e276e9, 0xad5d35a781a8,
+0xc3844eb943982449, 0x90eb631c8314bc3d, 0xf90cbedafa4ea04e, 0x4fdea10ba0393140, 0xbf9cd4ac2e56b3d5, 0xc4ec97fd35a921f7, 0x63945bff0491,
+0xa4040777cd1be2c5, 0x1b015541370c33c0, 0x9829202b910f1105, 0x5714a5c2a04e2a73, 0xc59f807bcb011a8, 0x75b333e73ca0f9b8, 0x1718409e58dee,
+0x25fef3e0092108f9, 0x9feda7e7df0ebf49, 0x965c37324f64858c, 0xb231d0dc8b9de571, 0x740b5f3ac95a9cf8, 0x60825826f72e24ac, 0x50b342c60679,
+0x60f20b9deeaea9c2, 0x159963d88443909b, 0x649b3875b47aac38, 0xb2eaadfbbefe062a, 0x573ff1a8c4366a17, 0xc144cccc6896f138, 0xd4583d7dc81a,
+0xde5b044b28202d02, 0x1107d7710c0a84e0, 0x28bd289494d9ac50, 0x25c718822bc1c5c9, 0x4d6607802189481e, 0x2ed6d4423c8f500, 0x2f5031fb8edb,
+0x106effa2b018bb54, 0x294922e798b36199, 0x46c5724209449341, 0x35c993014d2ee013, 0x551b1daba8711f17, 0xe8889a517ebf0da3, 0x187a4a87cd6e2,
+0xe5d62718ac36b15, 0x252845ff05b28e8b, 0x2e1e87eed33cad3c, 0xdc15763dc2f9ca25, 0x73022a560a1c6cba, 0x44723a3194a53da0, 0x1551d09ad581e,
+0xa4bba324fb95c1da, 0x1f7fa2bbb167d52d, 0x53b0668bab203b37, 0xb3ecf18a785966f5, 0xc00e860e06b54d79, 0x2e77f6d2b678149c, 0xf661885d15e,
+0xe594040aabfbbfd6, 0xe52c8dfc78455a1e, 0x4d31cd5d9499abdc, 0x958f80dbeaad2b42, 0xb63492d7334686e4, 0xe1e599355cd51917, 0xac864a8d04dc,
+0xbf48b5f86eb4ff8, 0x931cb1cdfd90d700, 0x47da38306b15f330, 0xd166f58bc4242b36, 0x3fb29f4ae87f4ba1, 0xb49713ec779f4776, 0x1f7e013371f50,
+0x80ea2068fa89390b, 0xd6403da66f627192, 0xf8602db010441b10, 0xe8828d99ce1b6c95, 0xa3cd9404e02ad344, 0xfacf951fc4ba2355, 0x9eeace3e4d0a,
+0xd4f2920ef64a5a37, 0xa820ec59247d713e, 0xafe3635db7342b46, 0x1f6b273a08532bc6, 0x913b89eda7a76dc0, 0xcc413108a2768f29, 0x18b00a3598289,
+0x41f5b728f5ca7709, 0x77cb30e1c43973d3, 0xc580bb0b3c68f043, 0x175efe09633092b5, 0x197b8a92f0c9fd53, 0x2749cf883433dc0, 0x1ccddaea3d42d,
+0x6655623aab966ad3, 0xb62248625b121c68, 0xfef3c47970b1d61e, 0x8cc873354c4127a8, 0x14c4d02fa697c381, 0xec0a577b0dfcf9fa, 0x662bbfb34b5c,
+0x80f5c78ad89da57c, 0x790d55c27cb9358c, 0xc4a543a06e32e589, 0x7a5906508f433a4e, 0xc5b07865d3644a91, 0xd3c0d4a452d57b7, 0x1fb61fd28ad76,
+0x5d92c26400b92d4f, 0xca37f6aa4f41af83, 0xddd46e3fbf11ac6e, 0x461321a4d982a178, 0x19f99312ccefc4a4, 0x8abe8d95ffd5a33, 0x1905552e21759,
+0x4f34eeb128e531eb, 0x4ce9035b30904972, 0xd0a0e45b244733ff, 0xe2b782d387890b1e, 0xe4328311e8a8d9ee, 0xea9a51818902b40d, 0x20aee030472d9,
+0xebeca840716e6513, 0x64a23e2d5951f4e, 0x616f1e0878af6bf9, 0xbbb87caa03aa4d58, 0xe79d9f01b488f54, 0xa3352f0f65e31619, 0x4a1d90b860ab,
+0x8ef12770c488100f, 0x7f93d737f553c0fb, 0x3d089c85e5dc2826, 0x12453efc72902154, 0xae8681fd2b9e928a, 0xcebbea02be752f3c, 0xc52c889d6c79,
+0xf182253399b1f164, 0xfd19312c86c60c80, 0xf1d17207f33c180b, 0xa0aa2cb528434014, 0xd6809406b305f6cc, 0xd74cb06dfc2c414a, 0x10909cc0b4043,
+0xcbbd14bb8f1b907e, 0x5a6e3addc5c39823, 0xb20a6c99ad9d22a2, 0xb0a65e5f4601cb1a, 0x426ceac3d0a010f1, 0x74c77f4ba6e8868, 0xa7b95896ceed,
+0x4cfdad13f5442fc8, 0xdc3113bef1632faa, 0x881f1ee1195a7621, 0xe67b62e038a283e9, 0xd496650aa2a92a8e, 0xeea228b0671b1d3a, 0xec45e5f573c6,
+0x890618daa641eb80, 0xa54853df2cd44e24, 0xd0597e15779617cc, 0xfbff7abff2178edb, 0xb63da91bb1e5dc03, 0xa3f60090f714e51c, 0x1bf34c60fdd3c,
+0xce7e68dcb47dd98c, 0x324b651414daa794, 0x6ec92f50c406f53b, 0x254a8f2de43446e6, 0x174d4b4339f95c7d, 0x524ac1866d3a37d7, 0x22014c1c497bd,
+0x27f4be0425ed1e2a, 0xf08ffa027a3e890b, 0xcf3c44832c7d73c0, 0xc1a1c75c817777a9, 0xd8c7d001478e728b, 0x7d8225847a7d4857, 0x12dab09b693ec,
+0x252d6c09f0bb4c1a, 0xf8934d0cc1ffebc8, 0x90e3989701652c60, 0x82d8c994898ffd34, 0x2b279bfa132f50f2, 0xefff32e811c5b9d9, 0x1bad2aa449d70,
+0x8f31df0ea87b1dfa, 0xd6d83b1dd48be1e8, 0xe8a9b9dac2764a4c, 0x78ca8c9b50ba4de6, 0x329694019185d44, 0xce3622c7acfc3b97, 0x152580063e91a,
+0xae37d23b0b8fa8fa, 0xa77cd4374eed7041, 0x4f851e014b216ef1, 0xc7bfdf82721b818, 0xfa824f25a6e2e6bc, 0xc7034d490145d26, 0xbeccbc8d6491,
+0x2c470b56b78fb1b, 0x310dea9db0fa7ae2, 0x49eb9b9cb1713984, 0x37c2c45bd86b6582, 0xde9cda5063d4ab14, 0xd2049089b4c73786, 0xed2dca05ce4a,
+0x521cbe449c294ad3, 0x51ab71a40db39d31, 0xaa78ab50e2513873, 0x86bfaa19160d5c0e, 0xafa32bc4a1141316, 0xe57dcdd753e9ef53, 0x128d4220866b1,
+0xc17525cde17141ea, 0xfd0219b3c3602709, 0xaa66d8bf8c26dd75, 0x690803aed9540e65, 0xe0c52c19aadae38, 0x16b1b46c8e5c2fd8, 0x1c8bdc67243ed,
+0x198b86a5171ebf92, 0x15ee51287650b93d, 0xa85a17b23a98eb1, 0x21869b2573943334, 0x52bdc95ede837e4, 0xfdb96a71c7d15635, 0x1cd781927cba4,
+0x48ff0eef431e872a, 0x818e531a6058e598, 0xabac26358ff335e7, 0x83c1d01529dd79ae, 0xd8593c86318cc221, 0x74dba00e76a37d5, 0x9413fcf3947f,
+0xda57de334f54ff8e, 0xacd736e360e68c18, 0xcd4766c628a0d42e, 0xf7d6eed87f4f7550, 0x91955b42a0c88c6e, 0xa27117379f76b53f, 0xa478af791c44,
+0x952a1905ab41ff41, 0x4e2e000d5e53dd3a, 0x93b9d0ea13bfb260, 0x3de171be436eec69, 0x8034d2f84489f644, 0x96487d01fadf824d, 0x100c3242750c0,
+0xbb4f18df0cd392ee, 0x4dbab61645ee029b, 0xfe996ea3dc6f8dff, 0x3f54abeb2bda4c2c, 0xb74b6d1f7dc749da, 0x4b75f64d2e84b1fc, 0x165d5ba14132c,
+0xecfb471168427523, 0x948fd098731a9f2a, 0x4a7e63d9c5bc839c, 0xd41b47328f9b996c, 0x9f14025e2a15519b, 0x8d0746061090b662, 0x1a0f2a1ebcf2d,
+0xdb2e64dd2be20a5b, 0x54e6eac331755722, 0x50920cdde575f9eb, 0xb39f6f67213746d2, 0x190112f8009c5da8, 0xaf5b13e59e21247b, 0xe9f730799607,
+0xc0b9152741085c90, 0x7a02c2dc1fe16eb3, 0xd01325404b67cc9d, 0xcd7b451287520af6, 0x8dc095da7d931fd1, 0x10164687e6608770, 0x11a7145ee5a32,
+0xd6f8cd2030d8da93, 0x6b7a365109c93652, 0xf93eace64583190e, 0x5b5c4125da19c465, 0x43e96826d5d180e, 0x7ca608796ad3adf9, 0x3eeb2834fb39,
+0x57789c928890f631, 0x634c745335d509a4, 0x6637ef363d61e211, 0x491d3b74d918a0a, 0x1ca752bbb55d0b16, 0x7382f31bf939dc49, 0x16c44bf449e62,
+0x952add16fc216ed3, 0xf1e071b3ba309303, 0xa8b9ae91b0df204f, 0x7d7fb258249576a9, 0x2cca0128e81efd4c, 0x990b9f5eb7ed1240, 0x328a7ea72a3a,
+0x65dec8a5d04f0564, 0xf49c0b19897c8bcd, 0xfbc84889da3dfb75, 0x4dd4a290f41b6bf7, 0xc6f410564ab5dad3, 0x9d0c0eac7aef6598, 0x160d8e118c4d8,
+0xe16562350afa77a9, 0xbb0e6cca784e16e6, 0x28e33d64e85a41c6, 0x56e26b29d6070098, 0x5bbd66aa74b891c3, 0x71883ca2bbab5fbd, 0x1fb136c05cb0,
+0xa66e08cf4e97926d, 0x7a39fff0c63f4536, 0x21e564772713aed2, 0xdbb3f3122ca42cb, 0x69981bb891f06a01, 0x99abf034fdb8cae5, 0x3c2de6805a3a,
+0x9e172b0b8394b97f, 0x922ded0e6bd44607, 0x7be3c57840bbdcb2, 0xf6f8779b0db6cb26, 0x4f862e6660b5fe8, 0x44a5776ebac04d33, 0xbb649463aaed,
+0xc1fe2ce5bd0b146c, 0xc145e5176de45565, 0x6ffa7fb901523bbf, 0x33c07e35b999279, 0xb61216da27fe35fc, 0x870f0ce772ad5642, 0x19f6db3fa6b8b,
+0x66afb9dd6845f17b, 0x7068649a081d45a4, 0x1bc9ce7aef140c2a, 0x17507eb13cdf9be8, 0xd69d4fca6f0d100, 0xca1703baf747439, 0x5de3815324a4,
+0x82ee16a31403b4f9, 0x7e4c5bee0a407295, 0x3694ca5ccdd398f3, 0xd294fe4140ce88e, 0xc8dd40d6e5e196cb, 0xaa235a4cf01c3e34, 0xbcb70103ad3f,
+0xaa0947c6df0607e1, 0x5b0f6c14150774f9, 0x50e1197db74148d5, 0x7aa9147ab55607d4, 0x7c0738aa60605898, 0x7c81b68a3eb7393b, 0x1fc0e257e6ab4,
+0xb344b0eac6e64ed8, 0x2433868fab2e1620, 0x3402f9531b5b420d, 0x5a3903d8d517c615, 0xc65800b93d8e9e3b, 0x4e435ec4dc7a156f, 0x134af7edca44e,
+0x660976e1786cc73e, 0xff94699b0660d0a6, 0xa33c79f88271c932, 0x6338c005c3f703c4, 0x551e59f3a369ddb0, 0xeae03d212779997e, 0x148236bd5cc7d,
+0x84159a5353621e80, 0xac15ac4e904221de, 0x348e5fb1024d0386, 0x832c6050bd2eb245, 0xcba34e0f8e95ebd6, 0x1a43ec2129d5b785, 0x2cc7e9d9c9d6,
+0xa5cd21ed5d534d5a, 0xe5654eabb5d8a397, 0xb002114d0d0bf6f2, 0x630c47a49b72e23e, 0x42a75055a97a14c0, 0x7f88b4e813e92c74, 0x15703bf084ea6,
+0x6e9013f0da64a499, 0xf33ef25bf9db7eb3, 0x87e127ca8c6e5f89, 0xf1063f9fb1d2c1c6, 0x1d2d6ca00e4d2da, 0xa87ead04a30cd3d1, 0xb24d0da7e13d,
+0x9793d04c1f8efd82, 0xb6bc76537769cdb7, 0xfc24886d3714229, 0x9e11b3e69d2b4b93, 0x31a81c1a6489406d, 0x7f9184bf1f1cf580, 0x372d02b78a42,
+0xcaa014446d11ba23, 0x997fd124a4b4cf1e, 0x709cbed75528b806, 0xd1f649e6cda6fc2b, 0xfe033db05f187a96, 0x9810b796b599c9d7, 0xa4268bffdb,
+0x7018b86850792b78, 0xd0374a2227bf7882, 0xa8007b0d8cae8531, 0x8e424ba2b6ff1b0b, 0xe7d80044d7bdc83f, 0x4e0d6b1e70cf44e7, 0xd3c62cb4d827,
+0xeb59942f19964680, 0xe800dc6307af83e1, 0x31bdafe8799b1dea, 0x329a6565d232f019, 0xbae8543e4b3315de, 0x60d632aa5c4e1939, 0x5c10a18dd94b,
+0xbeb37450bd466f0d, 0x244aa5eea3a92e71, 0x191194c58dd159b0, 0xefe3626b1bcc3dbf, 0x38afaaa531c8107a, 0x6c98392098de8e3e, 0x1f619c7cfd1f0,
+0x8e0a3847cabf5571, 0x94744dc86861b4e7, 0x4d0a9105a5881a44, 0x2aab6203cb6e1539, 0x246d2180b96044bd, 0x9edb657d43767401, 0x1c92b3b33c215,
+0xa7fdbfe6c419e923, 0x9484c68b5d7d5d8c, 0xfd3887597d8430af, 0xb0b42c868d0d8b2e, 0x8218ca03f5eea1c6, 0x531fa5d94c73a32, 0x493e8200350f,
+0xc5fd1c30e9887180, 0xd3e92435233cbb80, 0x884224d909fb89ec, 0x4c80ad4946ed25bc, 0xda6aa10aa496dd18, 0x94730849fda32664, 0x83f2453ce6ba,
+0xd7012061d3e3c399, 0x55dbf259d6d83f5a, 0x23d56e7a5d6dae79, 0x4bdf07a5e0666840, 0x5cf90421b8314192, 0x95ca9a4689984cd8, 0x89fdf26a8a69,
+0x56024810ffd30987, 0xb9e04e8d8455e349, 0x5c8a71e339f70419, 0x677349bfa920a34e, 0xb20f0d5912625ab2, 0x86e6379c3db9cdd7, 0x13d379bbc3e31,
+0x7d3477b3bf2f2fda, 0x882b1f16d129a151, 0x78ca41af7cf84b74, 0x30a0a391aa36569f, 0xc5ea6cbddc9455ee, 0x50c1c91b6b7d6ca3, 0x5c37f7453f4,
+0x1597bdae750a3cb6, 0x4a0c745047b1be3e, 0x5e2f706b4e5b03fa, 0x98b85d3c6b28ff18, 0xe577944ddc71eeb, 0xd5d6393ddae6ed1, 0x1adc84b5af0d,
+0x68d0f5362d9c21e3, 0x4a6bf04a43321761, 0xd2146bfdc7dd6234, 0xdc1d502892c77877, 0xf0b26856592d29b1, 0x6fb97f226b25e335, 0xdd3f1cc684f8,
+0x2b21ff9da70b0876, 0x427371ad3a7f087f, 0x94cb7691678a694a, 0x5fef2342d107569d, 0xa5ddec6786e2d32d, 0x97bed7022457494a, 0xba8c9f02d6dc,
+0xe6edbb7a8727195f, 0x826468fe3116a07a, 0x487e8f348c5a1531, 0xe3e3e5ee15a4edfa, 0x419865e813a8061e, 0x259dea6414f3955e, 0x23351ec62f01c,
+0xa8544213fb8d2f11, 0xe6e43477afae61e6, 0xd9039fb34fcab6e4, 0xd548a666877caf7b, 0xc40e924548cab3b, 0x4414cac52d466e6d, 0x30671be8bfed,
+0x2bb0ec65b33852ab, 0x7b12377272e03a70, 0x2b5af67c6d98725e, 0x852595e536e7fa0f, 0x2bc420ce2b5c929e, 0x98c8faccd60cfc40, 0x1b030a28467ec,
+0x9e3f4e522a749b2a, 0x8b79f3a77194a75d, 0x21cbbf6ec75d1, 0x8401c771ffc61566, 0xa89b88a910377167, 0xb30169794d25043a, 0xea1f48e933eb,
+0x6ac297f8865932fb, 0x6b12ff5541b1bca5, 0xbb0a60e94011e6d4, 0xe538cf3136308bfc, 0x18fe60cf7d62ff26, 0x2e3f35ce447a90e7, 0x1b7dc5ebc8ef5,
+0x94e350c5b0770304, 0xda9df84bcff427c7, 0x6b8d88a04108b07c, 0xf429fc70f917e540, 0x596823d62c496a8e, 0xdd71320ac2c51dc2, 0x17c746d59720d,
+0x40d0650c7772e1b9, 0x3f3d090d860c3a1c, 0xa72611f862ddc485, 0x6c9f4e77c5fa4b37, 0xf8ad572022f37b78, 0xefdbbed81b7b86e2, 0x18fef13dc0c51,
+0x33c150350285e4b4, 0xc0bff8dd3cca52e9, 0xcb4c313cb76ebe8c, 0xc6f07882fe32b639, 0x428d4ea11eeb63af, 0xab6ab05f65a60f2c, 0xacc6d2d9b7df,
+0xb8758ede94301355, 0xf49fa85bb531a392, 0x2c1db7281d301d70, 0x43c763c4d2290678, 0xc47823495f00e33e, 0x99959e7f87a29859, 0xe0cc330093ce,
+0x295c5c27297a1e57, 0xa9f3a956b7ffb537, 0x85898179aa754eb3, 0x509fd532a60bc2fc, 0xa14726fe33508102, 0x2d875f45c62d8a30, 0xedc2785254fc,
+0xddfd4f57fb145760, 0xb9f3fc4e20667d12, 0x4d18b7f857b01af0, 0x7ab80e0258f97890, 0x5b728cddb9320361, 0x7ad7287dc281fd6c, 0x2282145d8e678,
+0xc39b6b13b4c78c17, 0xc8e08f147da5dd8f, 0xb97129545e0e4972, 0x151e7b6964677ba8, 0xe5e79d694789467a, 0x72f589b97882308f, 0x139f2cce00ab5,
+0x988230bc42fb9ad7, 0xa7582356789a5531, 0xa5067c0169275e1b, 0xba6c85e568c30a13, 0x13e84174c825fdaa, 0xf24fc28395b279cc, 0x1a2ec27c73c8d,
+0xc8ab8633b912ec4e, 0xd6d8147cf8a4bf00, 0xf1f82a9783777b5f, 0xd3a996722266bba9, 0xaa3ad34361d555a9, 0x2ba7641d7082c882, 0x1a33aceefb377,
+0x802d9edb7e866f2, 0x3318aba32a8c8a15, 0x3e75737e6236cf08, 0xe7b8bbc042b82e7, 0x66eb932e0cfa4be5, 0x27c65def9808f104, 0xa7b8a7616699,
+0xc6b1c5b3885965f, 0x4b5009caec67a01b, 0x27d175f517724965, 0x2f02a687a98620a4, 0x19f304f5daa732e, 0xe3b698eccedb6271, 0x18d3b02a767a6,
+0xe8316f02e7780a4d, 0x3b9d59cd16ae17db, 0x8a37bf3f0b236159, 0x1ae0fc338cd58a1, 0x707718013a4d134f, 0x3439023bab4c74c2, 0x1e1417042e396,
+0x1188cecd2148c77e, 0xf61e8bd0a0ac6e64, 0xf614ed5d04c2cb91, 0xf8eaab68732e5e58, 0x445161332442e923, 0x3e80ecc9d203b9a0, 0x239eba7d494a,
+0xe1e580a88ad907ce, 0x434783309e400fd6, 0xf832e26ec804fdfe, 0xb0aebb8bcffd1b52, 0xcd595513296ea184, 0xf7b0f9843d178422, 0x578e10dd0b0b,
+0xafbffcf883fda735, 0xdb71e5dca261b2c9, 0xb4d9eb86b740e9de, 0x52ce47fbaea5b55b, 0xf98502ea96a1fad9, 0x62770f173ed57032, 0x1fbdf4468ace3,
+0x3d43b3b9039ba49c, 0xb468de8e8483e71a, 0x90aa805bf36d7a8c, 0x9fb9a43ed9869d99, 0x7ed172c9c80b4f4f, 0x64c86ffa62bdbe32, 0xbfe5c9c1529b,
+0x385e3bf38af00260, 0x718e0b179d00f322, 0xaa9ddf0232e9aa79, 0xc9b142312e3817d0, 0x838233b8354cfbe3, 0x1fd3dd0136fade10, 0xf2c02cc8c466,
+0x6d12eef6e4afbb2f, 0x790b3fb4dc60b40f, 0x7216efdac73d28b5, 0xcc923b4b06e738ca, 0x67d69f9082271016, 0x82832d20b541b451, 0x47b2cce8d1dd,
+0xf5648514d5949046, 0x27a0e7289a7991ac, 0x1f879aad5143f4b3, 0x22ba83ba42cb3b8d, 0xb5bbd2e7ad2ffa37, 0x9452ee2cc9ac7f1, 0x1a00ff7c8e045,
+0x6ccb14f1307dbf3d, 0x8edf6add9b949aaa, 0x5141c8e0d0dd8902, 0x6395ecdb0ee47042, 0x740318b50373113e, 0x6e11c5befc8e9c2d, 0x2005fee8b413e,
+0xa303cbae7ebcb540, 0xd47fa9f02f36b5b9, 0xce644bf8934f533d, 0xab21b4601111ba7b, 0x521efb2f4662ecc3, 0x673711b18e2108ed, 0x152ee87ed5742,
+0xbbd02b498af2bfbb, 0x9b06db60c74ee0e8, 0x6df15ba4919b323a, 0x2da746fc1eba9dbe, 0xc644db234bc83fb7, 0x5841355eccea2f1b, 0x21fd83832b814,
+0xa4c06843fab3ab8b, 0xd6b4ce1abaade10c, 0x3ee5a85f63885372, 0xb8a1c08a5ebf1485, 0x683b761c19552c2a, 0x6cb75905b0baa92f, 0x1ae43836229b1,
+0xe0ed7db8b9905b97, 0x17d2c18cde20f8b6, 0xedbf89e95b2fdc70, 0x686ea85c99a93059, 0xf2339c9470ae2eb8, 0xb650b95efa346afd, 0x12cea810bd68f,
+0x5712cf8a229b1e2e, 0x9a583609380c3639, 0x3d9f57a4ab993bb0, 0xb8db1ae973e9a4cb, 0xa0337fde51ca118, 0xab8429b1baf827c7, 0x7610890699e2,
+0x3010241c78a879e8, 0x2ac714df36bb1a0b, 0xae9a6c62024a9260, 0x43b16065d4f0dba2, 0x8337e9ecced1c82e, 0x9690282d0e2c0c3e, 0x16280ab78e00c,
+0xd33c87426413851b, 0x65faad8612ffd43b, 0x57ac83337192740d, 0xa3f6f69a97075a0f, 0x8f8785476ac9ea8c, 0xa9e668a89667f246, 0xf0c3a5074376,
+0xa961a5012ed6aa29, 0x398f315079f37270, 0x225b552f6fc4e03c, 0x2f2ab7d01d584f8d, 0x331f5cec05b020f6, 0x59ea1b416cf8fb34, 0x1681ab7357a21,
+0x588211ad655fdf6c, 0xc4b7d7a90b00fcec, 0x75204ea292f6998e, 0xa051a17c131dcdfc, 0x21ebfe60aeb89613, 0x153f3327e3ab19fd, 0x1ff0d5d472588,
+0x8f2f49dc074e68f7, 0xfb408785020abfdb, 0x73647a7430412021, 0x4770ec72bcd58c30, 0x41930c57f1ccb3cb, 0x3b0f3e932c176640, 0x8d8ad2695d8,
+0x85d4b54478797953, 0xddd4a743bd708567, 0xa173a11f7e4ca088, 0x4e4a0e097f0bd4c8, 0xdbbdb758f5963e0e, 0xb9112db03f70499b, 0x1549125770cb7,
+0xebb18cae12b2a97e, 0x826256a2253efea9, 0x4e4cd2f21d04ea18, 0x18ecc821eef0c6a8, 0xf56187b71cabf1ce, 0x5e67b0d119e35ca3, 0x40ee156a8130,
+0x7e8b71ebcf261f43, 0x87bc6b4e24712d12, 0x18ff02505ddafdf1, 0x16e1201231ced23f, 0xb326aadbf6a4b411, 0x94ca12c8a2635812, 0x2be03278eed6,
+0x8c19543289a5f856, 0xce440507f3c7a8d1, 0xbdd3b177432ff888, 0xecabe46eee73e3d5, 0x85d212a1eaf9434b, 0x21d0cac7fe380e29, 0x118f2a6d064ab,
+0x515d47978ebec908, 0x135aa6ff44041f50, 0x6af5c2b6a322b5d0, 0x1be4260002e687cb, 0x43ab8dc0b684d870, 0x3d7071c8abcb12b7, 0xb4c1669e6c2a,
+0x64914e35cad32fb5, 0x5669864cce11ffed, 0xb63f4fb2c05ce068, 0x290444506e69cf1c, 0x134f1970563209c2, 0x7b2c310f125f9bbe, 0x1fd20b61cdd9f,
+0x64300960cd89c035, 0x2a129a7006851af5, 0x415394477f6315db, 0xdd7c5a5f38fdf715, 0xf377e44d0f1cefc3, 0x330c0e4493bcbd0a, 0x10b6c69c664b6,
+0xb06960d115710e24, 0x484b201aa8021c35, 0xa49b529b76a8a62b, 0xd0c09e1f0dbff5ca, 0x5ab99cf8d83a1b50, 0x4c13008683834e65, 0x295b0c038530,
+0x46c9297769c37c20, 0xf2f791dd8ab033e4, 0x9057686bc1fc2822, 0xfb019c6d6832bb0d, 0x4dba735da99d90bb, 0x83aac96cbf8821d6, 0x168db21c34c1a,
+0x38ed9ea6d042f99, 0x96bc92a28e1a110a, 0x9a4f1399237ebd60, 0xeeb2ed3890962be6, 0xf1db7bb933720851, 0x3fda5a9ba08ce934, 0x20bc62e4e46ff,
+0xbd1c470a58946c9f, 0x702b47f7259e2216, 0x2cb416fbde13d7db, 0x35c2890afd59d2a2, 0x8aea3d04016cb004, 0x7e1d9603e930625c, 0x1da68eec24136,
+0xa40d9a4630c2a0fc, 0x35af8915154fe1a2, 0xb68896e0e35b79db, 0xe31226e0aa20a4dd, 0xcce3f6cae0580013, 0x44aaad68b0de1b4e, 0x14542cc427946,
+0xa052d11de98563fe, 0x48e4b33aa802fbb8, 0x86bd4d244fcc9ff9, 0xbe8f87221ae7bfea, 0xdadb62233cddc3, 0xae9088af18b7a475, 0x1dd837a5d84c9,
+0xfa1e905c4a258baf, 0xe83054d8783ada31, 0x71c77e301f0459b5, 0x47b9c677dd645e52, 0x93911951b9e0cee3, 0x616b0f41867b6e33, 0x1922797cc3d6c,
+0xb499481aebeaed43, 0xb7807f42bc3837b5, 0x922616f5a0a33a84, 0xa7acb71947b40439, 0x213a93b621684f8c, 0xdc4d4518a7b7f521, 0x22512e6a90e03,
+0xf244769357cfb6b3, 0xe033b6fd31ec2f85, 0xfd89f3d5cf8f994b, 0xc1f3c0330362e3f0, 0x8184a3945d3b07af, 0x90ff9ec3c8d69bcb, 0x6447706851b4,
+0x5ae111a562042714, 0x5fce3d418b838316, 0x6146f8aa23722bcb, 0x9716f7292d5a5e9e, 0x4edfed107c10e2ae, 0x86020fc836b815c8, 0x1090634407b09,
+0x1232eee72715425c, 0x11582b9cc3ce96bc, 0x6cde7e1726740eaa, 0x3572d0a303b5c1a3, 0xa8bc8d5407d8e1bc, 0x1a78a962870989ff, 0x1d28949912a2f,
+0x7b2555bdb9936731, 0x3f97853eaa41cfec, 0xfa7428aac74dd813, 0xb06c773fc40b6a4f, 0x3fcdafe59cec81a8, 0x13c4fe075783d5a3, 0x96aed8887455,
+0x80ace428593a84bc, 0x514d83804bee1a92, 0x71ab4493f2844efa, 0xac72e8536e1fc2fc, 0x3e11bb3fdf2651bf, 0xe24bfcf1d3e48ede, 0x22e439d2d5b9,
+0x35364bdcdd93e20a, 0x3b1beb3f439672e7, 0xa6d45f514995f195, 0x2cfb75fb73484116, 0x24298b3a5c18e306, 0x50952a4bc9f286c4, 0x16db0251d2cda,
+0x647c313feb8498a4, 0x21c1d6494cb84b9, 0x945a70dead5b0b00, 0x58432c96ff34fa5, 0x18e51ccb085e2032, 0xca27c5e4cb50950d, 0xb69fdbd2ff4b,
+0x36be399a23f2f190, 0x4c6a5cc81c81d841, 0xb0d244ffb1f29134, 0x25f428d2411a9fee, 0xc786ba72872cd59a, 0x25fd22a69b9420f0, 0x228a54c287a8a,
+0xe355852a836530b9, 0xf92e9af569211a35, 0xb0457a1e2827f5d5, 0x5f7fe7e3566577b1, 0x2a863c1f7dca4db, 0x9346f8f64849597e, 0x1d0c35d564df5,
+0x1f8e9df49c0aaf9d, 0x5fcd3d542b08f263, 0x2f6d9a426b619749, 0x368536adf7847446, 0x983fd091e63187e, 0x3b59296da9bb41bf, 0xd6a0c8bc3f6e,
+0x509201a82d6fd856, 0x8973dc7e0e329a03, 0x417c63ace99e7315, 0x39e6d09067481eba, 0x3ddd1e470dd21a3c, 0x50886a91d01f727f, 0x142c5178ff0f7,
+0xe5dd89bfa3b481bc, 0x78314486d93728d3, 0xad52f0fbc9a14c20, 0x4dea7a7108f9d70, 0x7286711df5246a7b, 0xca09aacdf8ed6885, 0xf031faf627b4,
+0x247faf70e795d68f, 0xdbd25ecd346e10b7, 0xd675f51ebf6514f7, 0xa40154038c095c5c, 0x74a27c2017af37be, 0xc14feeaf94930f4, 0x1f0f75d8116b5,
+0x442b0d8e51b11675, 0xc591bc6ba839fa0a, 0xfcedc4ee3c530cce, 0x756c84108c1ef9d7, 0xda8e90e9aedc1a3, 0xa84f9a171afea876, 0x1a261b81abe14,
+0xb7be00e045290686, 0x9b6a20a614764baf, 0x1a2437751718a549, 0x34499d840d247fa8, 0x2c88a44e7df64fb6, 0xccf92d28e078d9cd, 0x32dda4753ac1,
+0x5e9f3f0aa7dea1a8, 0x290abaf60f5d16cb, 0x634a554ab8ea75ae, 0x2553777f7ea71e7d, 0x44296c422aeff65e, 0xeb61b742048a4acc, 0x9393cb12743c,
+0x19c9aaf1df06ea8b, 0x87d6dd95667afb25, 0xe6dca9db64775905, 0xe87909fbfd2c249, 0xd122811e9b42e6bd, 0x3fd04451df4d2f3d, 0x1887ad2521c22,
+0xe4892685611e2f36, 0x4cc746e8e044c489, 0x535ceb7cc7bdf048, 0xf92da9098d535889, 0xc6078bb67cc66f3a, 0x5f2daf5268fcff24, 0x11940c4ec1018,
+0xb33fe15bf6018aff, 0x874948888229f268, 0xb88ccf573152121a, 0xa86791462fbae2ce, 0xd567988b4e453f8d, 0x94aa57202f9b9660, 0xdb1616e0ca5a,
+0x3ad32163217a34a9, 0xe83325f27d740ae9, 0x643ed94db8d4d915, 0x136b8589141d0998, 0x9da18f214b21d684, 0x9f46506f9384426b, 0x3b2ac9f43c0f,
+0xae61a56e6ec6de20, 0x280ede277745e11, 0xff41324fe62f49a2, 0xc4d83a408ab88bc4, 0x2665e1e8c97fb67, 0x10b0aa62e36b467a, 0x16a7b5278a3b1,
+0xce5c1b798437fcff, 0x4ae6607daa46c84e, 0x6810e04f69570eea, 0x7f4a1f85bd01b346, 0xba390993f27a49a6, 0x376822620509664, 0xd85e227b6a27,
+0x8aa2c6857409712f, 0xc348d0c74d016d3, 0x8919fdf6ff1111c4, 0x136789aa302e1a5, 0xeab13e73a6fa5bc1, 0x991ac733be85b3b1, 0x200c89bfc0513,
+0xf78ba90f0ef31e6, 0x1c54f24130ca82ec, 0x2d84fc0ee164d9bc, 0x16fca6d8a0d4229f, 0x40e8c28f485ef765, 0x1dd512f6112f115c, 0x3ae1d5cf0075,
+0x15e3c318de83def1, 0x4b4fe8e9c4c7e1ff, 0xcf2547069557af82, 0x63543785c9df3c81, 0x84c4fe1e4edb0805, 0xdaabb0cdec1bde57, 0x1dcbe26e3121a,
+0x844450fb8dd0c7d2, 0x65e106723c088655, 0x3a9065305fbefc1a, 0x57e580eb91addf7, 0x8383a6c27b82f58b, 0xbfc4c6aa42b9bfdd, 0x1e613a920059d,
+0x9054037a51e8d8da, 0xd73e9c4549c3a662, 0x80a7071dca66caa9, 0xc66f3cb507131e17, 0x6195b6cf2142f3ab, 0xba14819eca2e2bef, 0x1290b68f63482,
+0x93fe3d547f3fbfc4, 0x1fbe00116632b620, 0xc0476a3fc9808895, 0xd0bccb8d59ab2f9d, 0x9998205d9fb3afdf, 0x808a793bf820f76c, 0x1388c3b0eb44,
+0x17d72be6e980c35b, 0x9a67850aa49b6971, 0xfa8bc7bf9f11fa3c, 0xa3f4c32fca17b910, 0x64e3e079ae275e19, 0x1f753d7abfb464d3, 0x1ef108fcfc544,
+0x366d1ef0659d4bb8, 0xb6b65b173fb7947, 0xc08da3340d4ab425, 0xe4f3e8c733d7289b, 0xd3278ec5340f72fb, 0x751c54a7a4ef661c, 0x233e5d6f50957,
+0x599e9dce85f8df33, 0x7aa12fe7b506de44, 0x3ee4037c22f16817, 0x4439e07639612fb3, 0xbcfcd87a71736162, 0xfe4d8e830fde23ed, 0x22cc02e9cbb0d,
+0xdc8265ce112816ec, 0x1a1e79150cf54a28, 0x99fffc4e41f8e347, 0x992553906888fc53, 0x2fbf571e71c0a3fa, 0x3805e17fb234cdc, 0x115a0005dd27f,
+0xb6d5f40afbb5a23b, 0x8be2007ff038f52c, 0x9446fd25ffc02d5f, 0x58c6160e64ec04, 0x1092881266f6bcdf, 0x99c6dfc9ac2f3d12, 0x120ad736098a0,
+0xde0fc640eae1ebdc, 0x48ef8948903b96c0, 0xe5691c93b0ba871e, 0x53e91b4eac9c2acd, 0xfa17a9e1f59482b8, 0x4eac0b4bba9c5769, 0x11e4a8acb681,
+0x1ce39114695d4e9c, 0xe91905ab2fcaf09c, 0x430c9e850ed7d5f3, 0x76e907fd0c2589de, 0x939e41b6ca66dca9, 0x3d20920a48a350c8, 0x1ba7bc65bb5c5,
+0xf8603145ed9c21fd, 0xb4e2b08bdb5efabf, 0xab52bf574e2401d8, 0x88b9b34e521d2138, 0x6be715e928581434, 0xc44375137f5076a2, 0x1ff1747fb2866,
+0xd7b8cc13eeb1e929, 0x5f64025c9c49c309, 0x44f6c6095185f91, 0x96a5154645929737, 0x1fa9a11fee42efb9, 0x12bf58a3efa7c607, 0xc575b0354f30,
+0x9a983718b4338efe, 0xe66f5a2f3047d597, 0xc0c3948a3315c651, 0xd180016370cdad6c, 0xcadea93fa5db4f36, 0xf1e3ccc964a135dd, 0x9d2db1820fbf,
+0xfa148d9dba4c9a4e, 0xece2f953c82874a6, 0xad9bc7043f37947e, 0xa910c7218fe0d7e0, 0xc23a600315d596e0, 0xd5c7a7556134f67c, 0x15cb1978cf3db,
+0x78ae8ce56abfa22a, 0x38cc9fd05f7da005, 0x3c574584d4f72a27, 0x338b0579c1afbffe, 0xf6a46df1901dd8ee, 0x688dec611a420e31, 0x3a90b7c039c2,
+0x1b84dd0300c25501, 0x2328520f3a737d05, 0x7580d524c805b18b, 0x3bd6c806c341f011, 0xeebf376143efe0b7, 0x4ec276247322d28e, 0x20a59018375fa,
+0xdf918eeb400326a5, 0x2ac1d06c0b9c049e, 0xb6104cb2b625546d, 0x43abf84ecc1ccf66, 0xeece5bfe0a370e8c, 0xee6d02a275911657, 0x75e7eb681de9,
+0xb490b36f103a8154, 0xe583a15dba6e0b4c, 0x9fcbbd74c50ae68b, 0x3a70c1584d5a714f, 0xeca056042590f18b, 0xc7c134a59e18c2b2, 0x1110a24ed1d85,
+0x36dbc9e9920935da, 0xd041a65937816c00, 0xa2194cee7f4409be, 0xa98bc32c0e7b81ab, 0x697e6b069b2af1ec, 0x720208bbf93effc, 0x206627624b974,
+0x7c7f8402517caff9, 0x1faccc0c6078c57c, 0xcc13d13463051d4c, 0x6d80752fc256faaf, 0x880cce5e379bbb3d, 0x9fb58d59745694d4, 0x1d8aa5b2f1e47,
+0x87726cd5e0064d10, 0xb7cd5b59ae3121c, 0xa236a4bc95cfd66f, 0xf4e3605591db9183, 0x8116452f70d1ed58, 0x4357b6ee3ed761a1, 0xa2a9ca38f418,
+0xdfda653961b0fa6c, 0xad61e1a6e974f054, 0xd0da323a8f7f2e08, 0x481113f3b08edc06, 0xdb605b6b40d56816, 0xb082ae7fb299f3fa, 0x5262b8b19d34,
+0x38bc1e269870992f, 0x91a0f494965742f2, 0x9b46d0b1570423ae, 0x5422f1ebce1d47b2, 0xf69f043176e32edc, 0x30d4f6785e24d918, 0x1b1346458835a,
+0x7d56aa29151414e7, 0x1b13b5a2e385f9f0, 0x1e736d55d9959e11, 0x68a0c1a088407d7f, 0xa4ffb4dfc526c2ce, 0x7944f7fcdd73788b, 0xba250e7110b9,
+0xd90ef59e7ce5c2ac, 0x22f8859e9a799fb5, 0xc7eb3e9cfae44d56, 0x59693695cd18f36a, 0xf37a850883ae298, 0xc284d63f206e4ac5, 0x164dc70e9e423,
+0x6b2d6dcacad9364f, 0xfa9b56ee59982a85, 0xd5dfe52849c3e6d6, 0x9e963405239e34b, 0xa167b836682b29c7, 0xa36d9fba1b2405f1, 0x1de519584a016,
+0xc5466cf0df45f9e4, 0x39a7c1d042a2c89f, 0x1a0f9c6f5de0353a, 0x6f25fbe11c20cdab, 0x6ae0154f8e0a3408, 0x2eea3c28c5d45be3, 0x1800ee62cf428,
+0xcee6e5031781e78f, 0x7f41a5b0bc29f145, 0x7ae627819148f12c, 0x5fbf88b92b59b09a, 0xa65495def5e6f3ee, 0xe7947a6cbe91a315, 0x89d76185541b,
+0xe7f3374fbae01c33, 0xbb5e149db7635b30, 0x84fb22c4ecc4f687, 0xd9c02d689cbe32f5, 0xa5fa35764749d7fd, 0xa4efeada050081ca, 0x1faf183c4389c,
+0x77a4180be615cc33, 0x8b520493512aa97a, 0x720166aa227823ca, 0xc3e9344cd0d3a305, 0xee8cb3e182a64a89, 0xf68bd0f18c8812dc, 0x19d8b74dabbf4,
+0x10ad831fc95e0371, 0xbae0b58dbc62d516, 0x686e94705f81b137, 0x7bef440f1bf067c0, 0x2324d770091e2a57, 0xda7db0b990a16ee, 0x10d614eabf83d,
+0x9730ed1ce8e62a2f, 0x48fd2b8533ef52d5, 0x9c60ba2db7f5c145, 0x893ec041584945bb, 0x1b97de694373816b, 0xbf06bc580212de12, 0x72806682e482,
+0x4eeaa1245b9861c3, 0xfc6a10693f652d4f, 0xec740f98f8dd1659, 0x78009aac7a7b9de2, 0x8a988d26ef6b8979, 0x730f317f9d078ee4, 0x1df555773ceba,
+0x3098b075890db5f2, 0x6f7a647f037f36bd, 0xf8b00cbc24815bfb, 0xfac9d79ee670ec68, 0x236ce1bb652adb43, 0x3de42399810fd02b, 0x6fa0173b2e5e,
+0x9bbf02e24ab564af, 0x4bcab81a8b45cd06, 0x328210e6d88c91ee, 0x5f8161244cb4268e, 0x5f9cd289b381ae9, 0xacad9594e3d29024, 0xd6a57a8e7054,
+0x4f7edcdb11c34218, 0xf59b714e3cb591fc, 0x6ca9817dd37b2ed4, 0x48821951a003f02d, 0x5b22ddd1760e3d65, 0xf20f21433e5054c3, 0x14a022b2afec8,
+0xdc7f07a3bd797ff5, 0x37a7ebe1e66b0b5c, 0x420949e0af4d77a2, 0x567fe992f8c687e4, 0x672bf11cab292a02, 0xb19cb66d93dc16b8, 0x16f7ec2224314,
+0xf6b19129befe3255, 0x1d7976098838f600, 0x6850cedfe45019e0, 0x1a3df59056ac3575, 0x850d6de2d5331d87, 0x189cc81ae6f12c20, 0xf530155a71cf,
+0x57292eac98edf596, 0xd319abbb32d6762, 0x80aeb3c7b6beead6, 0xa2ac3752e737602, 0xf6fbf399a0c6533d, 0xc712b2710bb92727, 0x69eea0b2c22f,
+0x13bb8cf2e39bfa2f, 0x37794887b88790e7, 0xe45ec4043f41779d, 0xe8accec22c36f76f, 0xf8f0fc65cae6c8bc, 0x99ccee833a0505c7, 0x5ee6dbf00a87,
+0x5c9a5696271cfaa1, 0xd4a3d42032786964, 0xd2c8f348266071e1, 0x52925441ee04a33a, 0x18a484162783929f, 0x73c160b199173454, 0x1af61bf6074c4,
+0x8dbf10cbb9e599aa, 0x6e8270d89a62931, 0x605161d37bbd8a1b, 0xddeed40eb03f5d09, 0x3e9968e71b04febd, 0xd19271f8ecd8e8dd, 0x21b2c74d1234f,
+0x606e9e97028ef766, 0x4e48e3af5c0b2a8d, 0xd3165e075b436b09, 0xc346ceb75f026035, 0x83e45451094f1d2, 0x87c4f239f255db32, 0x20f6592c4b86c,
+0x459b3b293d0cea58, 0xbe9d529d6fb36563, 0x25d0704ab67183af, 0xf571398ba12d6960, 0x6313db616cfcebb9, 0x23c7e3f290a7dd91, 0x4f8248618bf0,
+0x96b937229b3beb1e, 0x4e1292c57ac72fcc, 0x28fff6f33d9c6cca, 0x3f4fe6d0cf8ff291, 0x2746ec6a8511d22c, 0xc1dd4e5593522db8, 0xb5c2a30135dd,
+0xb3b84c8f9223a84a, 0xf1bcfa8e8d93f1e1, 0x47e1d9b0be812cba, 0x8e5898dc3e5d45c8, 0x3ac936d95048aa4d, 0xff70ad96d4272073, 0x1f8ee0f232ade,
+0xde497c81969cf154, 0xd5019e22095f9915, 0x32f239813df88aa8, 0x51072f95db7739de, 0xd4f29727c389124d, 0x57797582d4792a4, 0x324e50bc2181,
+0xeebef55be196ef25, 0xec2680a05f78627d, 0x9074b5ee056aaa67, 0x71291c0e4dbe085b, 0xbf9feb1d51ebfce0, 0xd8912601fb241c6, 0x10f39bf499c9f,
+0xb0374ed8e7427914, 0x97c9b5ea2e492c1d, 0xdc8d072255e62176, 0x692c7cee3a3321d6, 0xf569fa32cbf54266, 0x5cf75237726b1e1c, 0x1ff031c9a1930,
+0x639ecbe2c898ae38, 0xae7b5f2ba691ad2, 0x4e8dbcf25b4d7d9b, 0xdd326c5c3a085ad9, 0x888144ab5479a7e3, 0xe0fe1a85e9c19cdd, 0x22b9b2158cd3c,
+0xbb05753591dec8cc, 0x848134b8a31bf42b, 0xe9c20f7d7747d413, 0xe0937afaaffbccc, 0x7f1e8ddd019c2abb, 0x77aa1ad05a83157, 0xadcc56f4f3c7,
+0xc4ec4650e889a550, 0x3a5fccc6636f6a50, 0x109e8f3561633077, 0xa6d5abc8b038c25, 0xd15f8e9cff192113, 0xe370a514a23b26ca, 0x16af0029ab160,
+0x6746e17f90c55e19, 0x5e2d42f45f9c411a, 0xde1a55abf161aa05, 0x6cb04a070f11760f, 0x895b2df3e19c4e3d, 0x4f1fe6f18eb2dc01, 0xef2af7013a85,
+0x7f418a1765fb4112, 0x83f25dd098092cf0, 0xc0b9f47d7be2a745, 0xc228a4baf390a049, 0xeb6e66b8e888dce9, 0xc29c505d3c1ef252, 0x12d23dcf56e9,
+0x82f7cffb9874c42f, 0x5d8c211e6053af1c, 0xed22e565d928afbe, 0x138a2558aa767989, 0xb539ee8a40a0e021, 0x22369d90ccad7333, 0x12b26d6b84505,
+0xc4c4855c5d9ed54c, 0x770b51fd65a280bc, 0xd9b3335bc26a3b82, 0x557840bc8ff1a2c2, 0x72da7b8577c170d3, 0x5aa136c776c7ed3b, 0x1b56ea5bbdab6,
+0xf76f4479bffcce40, 0x198748cf4cb0d965, 0x9fb619333d23df4d, 0x27ea942e602e8fb9, 0xa6e8e2d47d7d7fa9, 0x7797a5dabb041d61, 0x97fd3b147e63,
+0x929d524bad3506ea, 0x5ed7a0939c4c2fd6, 0x5735e69278862e42, 0x3a41360052a59d3e, 0x572f283b2e8790f2, 0xbf8907bc3c23e851, 0x2270d13fcdd85,
+0xebf6bf36b335f2de, 0x557990025a99fe69, 0x8501f24c6e8c718b, 0xc2bef58f03ccc5e9, 0xa81f89fcd15c08bb, 0x349f4ea4c9f6e9dc, 0x144eeb46a96d0,
+0x6018da671773d939, 0x17afa64b59183954, 0x6501f5be1851745a, 0x9bf27207b05ba928, 0xf62ab3fe3ed90683, 0x2be6a263eee27862, 0x2189b3ffbf91,
+0xe3ce5a03ad6ed7a7, 0x25a5226f49d63d3d, 0x473fc4da8c0d127e, 0xbed6b33392c39c9a, 0x1be735a93e981150, 0x317990eb9d7ae824, 0x16134f31ef0ca,
+0xe7a1fa697d19db11, 0x590b425af84fd924, 0xf0f1da54c29fa7db, 0x681abdc9f543a759, 0x7f6b2c9e379ed738, 0xa5cc145bd02d8b11, 0x131faf7355038,
+0x949bd8dbc61e3b40, 0x7480c7fce955940, 0xe2ca697244047bd5, 0x79679fd4134c9769, 0x44bf8002f6d66b9a, 0x1809c2a74a406d5f, 0x1bc798bc30605,
+0xa8f860fbacdfa29c, 0x658048074c5bd433, 0x2dde8597c8236131, 0x3be5bdbefe45d622, 0xa53a5b68f9a07d8b, 0x3caeb03ce797f842, 0x5fa1d6dee686,
+0xcf2f551086ee0167, 0xc53178501f917108, 0x37a9806f700c86d9, 0x5ed2df09f3989ea9, 0x713c7f2587d5751e, 0x9a15692e0f960158, 0x153f155c5f337,
+0xe7ed62615fa5fef8, 0xece3b6d4ace57854, 0xdf081bdb6d5e0298, 0x816a15cd0da2aeab, 0x54ef49dea6567ec3, 0x331eefa20fa04a88, 0x17ae8c477f3a3,
+0x6c0f4fd6e1b7eff2, 0x8df6c29c017ebfda, 0xde8d5e8d6f30fcdd, 0xea9e0d6712a8c086, 0xe488c09dd8711832, 0xbb54ba2c0eca0584, 0x953e7e83b32b,
+0xa5ea402e4ce9364e, 0x6806738571987db3, 0xfa518d95fd816674, 0x404297b47c349ab5, 0x6e9a59bb9bd2d8ac, 0xb82b23b94560f028, 0xb675e898a5cf,
+0xd6e3837f9c788f09, 0x35daab03a6191bc6, 0x3efa9b5042d45280, 0xe74d26b45ee90225, 0xe8478593c39fac7f, 0xd790d02d196b342a, 0x158187620d602,
+0x1cd7418c0cf05d19, 0x8ce235108982bef3, 0xfe41a9f4bc1e92df, 0x2c3aa9412007d6b0, 0x160eb02c9353dd6c, 0x496c903d37ce3209, 0xcaa099039875,
+0x675cbc349ec07e17, 0x1c00eaaae728746a, 0xf758565fab8586c6, 0x5561dc922951f4de, 0x510f8b844b43dae3, 0x78483d2d760f4029, 0x1615905fad28e,
+0x14a431dc665c0807, 0xed9888f528fefb5d, 0xb2aff2aab2bc5b94, 0xf4373c9dd2632a42, 0x8d88f324472cafb8, 0x9b8d7db4d099060b, 0xdf144aa740e2,
+0x90e4c626e6735242, 0x51fd1b1aad621cc3, 0xc567e5fae44688f5, 0x78f8781676db58ab, 0xc2ea06b2f6a19102, 0x7fbad9b33b2b6c2b, 0x1a562184def56,
+0xaa1aa35b7af291c8, 0x3f418d6d7f87d901, 0xe89b2ab247194536, 0xa30133b6bd9b80e0, 0x718ea52d5aed4be1, 0x40b0adac06916d27, 0xf12a85c4fef7,
+0xd32bd247e90f9227, 0xf811198e070c2cad, 0x902c955e4389a21b, 0x10a86217f46c5913, 0xc616b1ea3981439d, 0xa04de7d051789536, 0x1569988320565,
+0x3046b015417254d3, 0xa70ac204889ceb36, 0xf835faaf10be39e0, 0x13b48e4197202766, 0xf407920bd72939d0, 0x4702583aa2cd95d9, 0x18f117f44b2e,
+0x870bd2cf34789ad5, 0xf6025a04ac8848b7, 0x7ba631acce21e4f5, 0x5d60f059c2272e88, 0x4236d3b622aa75eb, 0x62a6ebaa0a8eb35, 0x1e016510badaf,
+0xea86a61c32fe246c, 0x7dfb484f55208a4c, 0x4c6f085f644f8665, 0xd603aaf6cd601e5c, 0x9deda7087fbb280a, 0x133e5801498e14c7, 0x2144d638b31d3,
+0x95d496144ba58c01, 0xcb78078aa7a81761, 0xc0eb9a1817c19d82, 0x5f093f7669a61d3e, 0x6fd59ae61cc7f05b, 0xc77467e28815a80c, 0x1afd5b5735e12,
+0x96de47556fbc6d8e, 0x57df6c53df80a10d, 0x66086e2b4e2bdbc2, 0xfb76a18a6eb6d2a6, 0x7050460bd136c90, 0x4d822e99b7207cf6, 0xade675ff20d2,
+0xb8744c08721c020a, 0x6c1b3ef30d0257b6, 0x6402fbdbd9657d71, 0x225af0ced6dd23fa, 0xd04f77bce39adc7f, 0x4a6d69a43838157c, 0x14b8037eb5d48,
+0xcbb9bb7368499242, 0xa7282c3405c7ba8f, 0x381f8105bb397b59, 0x86f9f0be5bb67d9e, 0xb7421be309af14e0, 0xd1f92ca8354035ff, 0x127a060fa0218,
+0xa7c51782cf84da22, 0x9dc91070d2340695, 0xe841d4c48c5a4a99, 0x469ecb7db5d7f9bd, 0x98b725d400387fa4, 0x80883b7e88b2d667, 0x1813f2bf54c70,
+0xd6d49ed12622511f, 0x1c296b58fe295901, 0x894ee03bab5e59f3, 0x63b736daa62fabda, 0xe6eac2c4edf08da0, 0xf592106c8a22937d, 0xba427beb2b37,
+0x2b7de79f1ffd50b1, 0xe6ccbfc6a11e0365, 0x9a9d39b471f8f9a5, 0xb7d4eeeafb7157e8, 0xb8f6eabd9012177, 0xa8fe9277fa5cf1ae, 0x217fb3e634390,
+0x525cd333f2ec5bfc, 0x669d2a4e92496b66, 0x3ccae6b7918473a7, 0x17d116f7fc649fb7, 0x80000abd4d370883, 0xdfab7c7e410ba5b3, 0x722cce923e14,
+0x500b131fd898028f, 0x16e22081397a2ab1, 0x894088e78df97a3c, 0xd981c3a531c72632, 0xb0d3636be1e0e3fc, 0xf9d81d7c74a64394, 0xdb7faadb03c4,
+0xe8cc343f2dcb4a4b, 0x2638318e5c96d271, 0x9b9aafaef802c3a3, 0xf139ebb8ba34b13c, 0x36e82b2b47a67174, 0xe0169a99ab5a18b6, 0x77a578a1dd67,
+0x7424690fc6fe5f89, 0x495682fcf4d98a94, 0x5c79339677b2f53f, 0xb0c19a3bde8d83f9, 0x9c5c99756e75327c, 0xc303a507ca861216, 0x12fb6c916edc3,
+0x5693163874273ca9, 0xf1afe39245799616, 0x835e535092319b02, 0x730053680f10448d, 0x236ff53133e162b1, 0x62fbb8317587d36c, 0x13e8d3963bdde,
+0xfdcd26a456e60b66, 0xe6eb0e51a4739fdf, 0x3bd05b544c5a5176, 0x76ace49bef0dfb09, 0x375f1621debf207b, 0xcf8e6e6a053873bc, 0x220e6a7694683,
+0xee972a43ab3f4b81, 0x65ef0ce470c0ef94, 0xbf39eb527664322a, 0x7e0cbc0fccdb82f5, 0x54a9beb9057d44c4, 0x82f7c1966676153a, 0x57f8182846f9,
+0x1fc04d897bb80a3a, 0x76ba5e51cee2e254, 0xe97b66a47fab6102, 0xa44052871c0767cb, 0x30caf37441fcde02, 0x1cf0da05465ab015, 0x1b30f4f5b2506,
+0x5abc3409b46be97a, 0xcad0a76506aad285, 0x106dadbe60b4ea9b, 0x9d71dfd0a08164d, 0xdf70f95d05a8b8f9, 0x6f2991d7ce917c2b, 0x8265d45314ed,
+0xfcfbe52ec48cdcef, 0xd54165284647aa2b, 0xe1a0a0f147f161f3, 0xdd3bf4c37f8a8955, 0xba53899755e69925, 0x84cddb9fd733a913, 0x18c7143db10d4,
+0xb5d49a49277426da, 0x193eb6e9f4296e66, 0xfc338ca8ac2b3dc3, 0x29640fbed16edc5d, 0x216ae58840453b8c, 0x8e2154111b51dcd7, 0x1e4d68e65622e,
+0xd730f705ac5ab64e, 0xa96eead6baf0f142, 0xcb70e8629f7984a6, 0x23d4a96422a99c97, 0xa4ef075510fe666e, 0x86896063d26c72e4, 0x1f29f15c3f905,
+0x2d5037be2d965f19, 0xd5ae1d71d1e8fe30, 0x941259ea8aebd0d8, 0xe111736d5f964620, 0x57161580d3cb2b9e, 0x974956e86fb9f9b3, 0x408e635a5907,
+0x1b2af200c2861534, 0xdd31f7382fbd1923, 0x9cad1ca61c99920a, 0x823806cda13bbd87, 0xb00704ab1d798e53, 0x6ba7b7360c501471, 0x195cd5cf3ad7a,
+0xa9747491f1ca3fd9, 0xee77a3225659b1b0, 0x3e2da8ae5f3f4208, 0xf03ea92674b9e065, 0x47768e40b862aaa2, 0xc3738f7a63fefcbd, 0xbf49e64d78b2,
+0x4abe1915187a7e4a, 0xb76931fedf88b796, 0x91813196968bd6ec, 0xa6241582edbd7c86, 0x578603e899292c01, 0x983f83e6cfe83be0, 0x16cb9d23b80c6,
+0x65c1e1ba6afac122, 0x4bb76f1988691bc, 0x9885c889d7da3492, 0xd9c1567fbab09efb, 0xd50d678afa52795f, 0xab3aa0c7d2e869a5, 0xc348f9328f3a,
+0x61028a190da876e4, 0x7e49f82c3ea18dd8, 0x12c8699554bfb3da, 0x25c2bb53a0dda666, 0x5bc5f5600e22f4f2, 0x7144dd3467e0589f, 0xe050a4073a6d,
+0x414443f91f40cbfe, 0xb60c5c1992f3c5f4, 0xe394bf15cf795b25, 0x76e33b567eb6e922, 0xc07c431416a2e805, 0x53cae9d49ca5b895, 0x1ed41edfb0e41,
+0xb1f0616a568a3e07, 0x1f1827a673579a2d, 0x485d0749531694c4, 0x5b4b813ec229a91, 0x860a45a6e27b2091, 0x94e4e29abb5e14a1, 0x1393c75c1cfd4,
+0x805b1a45af5d4206, 0x59a6638066fc665d, 0x47d99237ac422e78, 0xb300c9c3a782da8a, 0xe58d665883c52795, 0x78e4709013bcccd9, 0x216b62d2178c5,
+0x14f4f51a14b53c84, 0x3bd3931164373b91, 0xde09d7b60c2c10a3, 0x6860b17721ffbcbb, 0x1e821252d5ecb17c, 0x5017bc6fd03d7b38, 0x6d7953748e4,
+0x5a25cdf3456df561, 0x64bfd1a4a2f0643e, 0x2f649e82d75f4b08, 0xf7a687eb76fa6828, 0x168ea9f692cadcd, 0x2c0108cf1f8dd44, 0x2165e0348726a,
+0x4adf83fae643727b, 0xea651eb3e2c65c55, 0x7fd56b61f734113a, 0x16246871e80197c2, 0x93d99eb551bf5b7e, 0xc5b81417eb7f0204, 0x43a824de771,
+0x7ad80c458bd0d3b4, 0x82c83261c5764373, 0xf3a4b531f9363aec, 0x1d47c2ed8913ed0a, 0xa8d7708e5e21ee, 0xd9737367ded909d2, 0x27f23a299c48,
+0xcfb3d1d365a26308, 0x927b0a3ea963dc88, 0x55899aae7bed6cb1, 0x2509b22899db781f, 0x5c3bb01d5dcbdd2c, 0x8e47f4a28b01b3ae, 0x17f7ec0d631ae,
+0x77ecc4da53e332fb, 0x5922e6d2188ebdcd, 0x29da4b4e26b5a0e8, 0x80719e4c589e5f8e, 0xa31a20c2967f68a9, 0x4e4bed33077e197e, 0x11c3956e82f2f,
+0x83dd18cd670cbcd5, 0x936c9f94b344b501, 0x26c63b08aaf9b707, 0xd7ad1f658aabb272, 0xc100da57f2dba5be, 0x5441e101b8ff20a7, 0x1d3e530c3a61e,
+0xa9e02423b6ca751c, 0x41cecd1f1554b5e1, 0x97a261b320d4be9a, 0xd7b418883102e0e1, 0xe933a6cf267d9107, 0xcf50c0f5327b46da, 0x1e260a7792399,
+0x46b99db0623f74f2, 0xdf8aeb7e0927152e, 0x1a7f59fb70dcb682, 0xf26a9de5fb49ffa2, 0x7336171dc06d3617, 0xb966f74acee398d3, 0x78af91413133,
+0x88c5b2c282f77acc, 0x145c302f1be7af30, 0xc549b7717593bbbb, 0xf95065080878cf4d, 0x76d7811c775081dd, 0xe08eb6967353b41c, 0xa8f5480d3d09,
+0x55a66e0793dfbd66, 0x5c1eea09a24d0af, 0x7395b5164d3725bc, 0xe70b56178bb88e2a, 0xf712d21fcb9a42e4, 0x47309adbc4ccfc85, 0x27092dfa02b3,
+0x1c0fee1ab3a7b2c2, 0xeae1db51797fab21, 0x4fc768050be593c2, 0x2ff47223e26826f6, 0x3e2124e92aeff32c, 0x591e3a64daed4c64, 0x3965ecf74c73,
+0xb6a5d7676103d162, 0x41d58a5abced12b5, 0x37f1dc8f0484930e, 0xa90c8b9a62de25fc, 0xe98c40785ab747f7, 0x34a66535b8d6b010, 0x353a7f52cfd6,
+0x5b52804fe44eb0ec, 0xdc7f683ed664a588, 0xb29a486150960014, 0x2fa57d18cc48fc9a, 0x1e9cfcb4caf10182, 0x6a9e1500a7baaf11, 0x1154d30d84605,
+0x4ecbdf3cfdcf872a, 0x2f6def3bfdfa1254, 0xc01e496de2efe915, 0x626337f2f04beac2, 0x3a1eed069c589eb3, 0xd603a267c6905ad8, 0x109da5032310a,
+0x267fadfe6883a129, 0x7141e584aca07344, 0xe3359eccf40b4931, 0x5be96c99f5692d6b, 0xebea4df5d52f500e, 0xc3d756a8818ea8c9, 0x1b2f5f9a67f4b,
+0x6c2e7c441c4de5cb, 0x4e8468b1b9ba657d, 0x445a3b79524a4388, 0x616e443dddba5b30, 0x1bea72b2d108f488, 0xd45f868e6ab663cc, 0x20ba17bcbd8a2,
+0x8bbf36168bb669e2, 0x40b20dc765a9cdba, 0x52df661635714c51, 0xadc8081c45773cd8, 0x18e95fd6092686de, 0x25624f9ed0f1cf60, 0x22ea909538758,
+0x168e7ef17c175dc3, 0x87275828538c6d90, 0x899297ec7bd8f335, 0x992fda6793a0262f, 0xbda2a23ab1a317c9, 0xb51b43f86cee1744, 0x2199de11a4e4b,
+0x88309f7620ab7861, 0x53a5c753d4150b48, 0xbce08ce7d96624d7, 0xcb1b08d5af8c0d94, 0xbf4eb4f50b2d9e67, 0x79ee069bd6a73428, 0x133e9d44c23da,
+0xb455d4be767d071f, 0xe93c4aa230b79555, 0x58057e0032182c1d, 0x2b7163b6620f713, 0xc8818d3bbff99769, 0x95e0cdf6e8b0aaed, 0x5a1ad461c2c2,
+0xa402387016ef2445, 0xb6f90a472da80e32, 0x6381eca749d7a62f, 0x5336702bcf88a281, 0xd4a920b9b2b69411, 0x941dde8034373624, 0xef86e650f44b,
+0xdd7f03a4c242d891, 0x7be0d29d9bd32d2c, 0x1cc7143117d554e2, 0xad3f4d8553b54b0f, 0x85ab3bea9450761c, 0xbef463e83565df0, 0xf0f7c9db1e48,
+0x1eca8cc009fea5de, 0xb7b71460101181b, 0xfb319d5dad53a7c7, 0xde6c17b5187940bd, 0xe0e5942aa643bf4d, 0x8450c5f5d0aefbd1, 0x1b97c4e2cfe9e,
+0xcc4a824241a46bf5, 0x63b7b1cb20a2a2fa, 0x37c4931f7b55afc4, 0x9c38821be002a77e, 0xd126359e7dfed375, 0xe253c4516e0e90c7, 0xd4f54e5b5ae4,
+0x256d410e31e2e509, 0xf6502852f0223740, 0xdee81b3740aac6f6, 0xbce687c721d36487, 0x90f8bf8035523555, 0x8519575811d986b8, 0x11c69d2d17f47,
+0x99b4b4bf0b346464, 0x89d03d8c4123432b, 0x7c48de36b98766d6, 0x76af4a516d2c74fd, 0x107e9efb35cc2d0f, 0xaf7e3e4b430a57fd, 0xc58e19578d85,
+0x1228b5d73eec3e5b, 0xcfd5d014ccd88d09, 0xd357be1a7b76e326, 0x28ac16eedaa9e457, 0x9e161c923265d33e, 0x46e09f30910129e1, 0x1be7aacaa183f,
+0x1e59ab8248e8558e, 0xe00453ad1656fa28, 0x2ccf3d1c0d3006d9, 0x24b50ae4394d17d2, 0xac0db81c9b0f979c, 0xfc1c68b595cd1672, 0x1ad98716a4b57,
+0xe9a6bebbd3fef1f9, 0x7192de053b635f5b, 0xd81c126831322fe8, 0xf12e660a94ef48e2, 0xd0cbc39d9b138e0e, 0xf066813bc50655e4, 0x1809138eaedc9,
+0x3a601f7da81c1f4a, 0xb9ad3e417a3ec6cd, 0xab584bea410de229, 0xd8d7c48b888429a2, 0xb5d40fc279e0d4ad, 0xe84e58ba4f67162b, 0x63ec9ea0dceb,
+0xe8512bb84dbea204, 0x5aa27a59aef07869, 0x2b0654bc4baff9c6, 0xa7d089edbb3d5e2f, 0x935ad9489bfb3f8a, 0xb485a0f4f1fb2df3, 0xa0fd8336e8ca,
+0xc44e4ce83ec0fd65, 0x4e99a0fa7196d98, 0xa0703f2de4dc3f83, 0xcd889b57443228ca, 0xbda95abf5041cf84, 0x984d1ae2f3a1d224, 0x1e8137ca93779,
+0xda117aacd0873837, 0x1671636d7b453f74, 0x7bab1c0419e7bab9, 0xa99c40882407b29b, 0xa588713fb5930400, 0xb851548582b105d4, 0x1c2b67afb5f18,
+0x2c9ac314e03d2596, 0x8d6e1b087399c11f, 0xd831849ad9633ac4, 0xfaf6aba7afdac399, 0x2f5f19cb772beef3, 0x8007c2ee65b7b5a2, 0x1e1c8c779a2ca,
+0x4af9077fed1ff866, 0xd133ffd506bafba5, 0x8091eed9ffe2066, 0x1b9cbc442b263ad3, 0x6219ca3094b78837, 0x2dcb523be1d2fd7d, 0x13ed973ead544,
+0xa14c2e6a2ea9ad02, 0x474f0f3d1be8e2b4, 0xcd2fccc66ae8a645, 0x7bc50fc87c071a52, 0xbf4271b1c11d8da2, 0x4e7d7914c3d40a71, 0x17ea5ed2809ea,
+0x80e19a2f36e938d8, 0x7d3948fea206b868, 0xc0d9c1d4e8d164bf, 0xec52cbd9fd7550dd, 0xb506f09a93bd3e9a, 0xce6d3e7f5f08edaa, 0x2277ec9cf23e9,
+0x1d579e8b4db717a4, 0xe27297bb162fb6cb, 0x86dda4f09f34df35, 0xfd13840ec1263c89, 0x2600aca520ebad0d, 0xf0564c0ca8947e59, 0x500b2342f5ce,
+0x4ad5138697c27fce, 0xd889bd4379f11dcf, 0xe70ab1fd8353d9fb, 0x8c99133fa0c3a431, 0xb6ae558bd0245f52, 0x13a860848c6f26a5, 0xd91e15d30fbf,
+0xe6e80b095b6864d8, 0xb132dfe142c58c29, 0x9c5b6e9ad3214570, 0x831a6ffece923438, 0x9a138dd2d70b162c, 0xef3a9d1bd9433e5, 0xe74752567a8a,
+0xd08c8af97602ffe9, 0xb28e12209cb204e, 0x7d02176dee88c570, 0x8c0a363bdab0e3, 0x46f5241c460fd80d, 0x8388cd77cac0567d, 0x1b5a9cac05eb1,
+0xd8e1982070b10c6, 0xe0a2f73740f967cd, 0x11102be3d9ceae77, 0x488f8549c3248a03, 0x50beb0490169a937, 0x4a5dbe984fd8321e, 0x15bd5fa6b3b1c,
+0x419685deeab46816, 0x72264d25cabf8ad6, 0x12c0b58cde9af11d, 0xd91ef337d8b54498, 0xbe240438ac747101, 0x39563ba46719d2ff, 0x173537f982bc4,
+0xd5584db534edf756, 0x44e2f4a608105b3, 0x406e10cf3a81e03d, 0x1ea2db9164092c84, 0x8ee12a8c5dea13cd, 0xe057d6552901f9e3, 0x1343c7c98fb00,
+0x2bb6331e462695bf, 0xe7bf228e53faf437, 0xd9663d7e60ee4fa9, 0xafd90acfd7907d49, 0xc953e0bd2ef40fa8, 0x5b239cfc2c799ebe, 0x1a625ca1e2c5a,
+0xd50c432842b937b6, 0x3309a2af74e3ad93, 0x9bb9b05e518d8e90, 0x59f6353029a012f5, 0xb92aac7d988d0288, 0x87b071a4fefc284d, 0x97a7ea288ac6,
+0xeb552784b00d4f73, 0xddb96bad7e4e29a5, 0x3fcd752d5a6d6da9, 0x3c729ce571ce6a8a, 0xf464a87ef93ff268, 0x6d84a5f4b15b3089, 0x500089d4d85,
+0x66a134bf86a4a4db, 0x95f212a3ed8a23b, 0x7d2ec3dc366de8ed, 0x2f14475999742376, 0xb0d61e7f91bc9c54, 0x565b4fd8aefb9989, 0x14e02160e9c21,
+0x8b0ff13519cb9609, 0x32829c7572eb4f62, 0x3cf7f73a4635b0bc, 0x8f883a7c14272988, 0xe9d51787adf41d7b, 0x71bd3ceb1984c7df, 0x152f9b1ec5774,
+0xa587001a92632edf, 0x89e1415dd1b1643e, 0x4111fd0b2ac31f58, 0x7c1e75dc7e4fa46a, 0x281bf09cee71f139, 0xb69e8ce50126fb97, 0x1358083da09f0,
+0xed4df3a8aa6e5245, 0x6bdaa22b8874cb6b, 0xde5c1c982d01f2d3, 0x8d572e2d4a5485e9, 0x7a5b435a86c51c6a, 0x3be42f86880c35f7, 0x1520b60300a10,
+0x757cd6245bdca22c, 0xbb629935228cef59, 0x5dd5fbba98a3a9d5, 0xf1b757200427cd23, 0x2c4a7be68cb0b63f, 0x154e930258befcf1, 0x19eed75b8b1ff,
+0x346778b9877ba4d5, 0x294363d48d3f7bca, 0xeac07f9cbc017b7c, 0x1ae2ee09e0f6d8d5, 0xa49d709193cb4d13, 0xf95fb9cd98e3e213, 0x760dfa76a1ba,
+0xe4551bdd88b5483a, 0xe6d9162cb224e49d, 0x6358afb76cc7bbfe, 0xacad13af9a9d8fbd, 0x45fbd298c514a13d, 0x37f98cb37f743029, 0xbcf12974faea,
+0x3f9e9ffcc054ae8, 0x4c0b7a7372fd468a, 0xf9438b5309158cf9, 0x6c321fb94cba74e1, 0x877654b1bc15b3f, 0x1e5eae6aad1dac1e, 0x19cf9971dc6b4,
+0x5cb3452ff3579426, 0x31b4be69ffbff5f9, 0xad095609d2e08936, 0x7c0525c464ca2e3b, 0xeb6297d4d57aab5b, 0x77557828fbef531a, 0x12c966db35ec,
+0xb1def0b42ccd74f8, 0x7d76ca545cc0a151, 0xa9cc3a7c12d3f1ca, 0x698880d534fa1a1e, 0x65cc4f88b1b6fbf7, 0xd43a0a17bc906a3, 0x1f71eea37d3f4,
+0x25349d34b5532d6f, 0x65b3e9c2fcb111e4, 0x913f7a9a3665af77, 0x39bd2032cd1e4a81, 0xa9af0e65fd6980d5, 0x73c81b8c449f4761, 0x2246087236250,
+0xdca1186d2fbaf975, 0x9f4a275cf15c9231, 0x64b3fba36c4871ff, 0xcc0cee74c0ab6047, 0x2559158f4e5d4095, 0xf4f7a1783b024a90, 0x2284dbe99a9a7,
+0xb498a50f97b32f4d, 0xc362cb363c587f9a, 0x3442a9470ba1be44, 0x78c4966da9542b91, 0x5596451b69200ddc, 0x590c9a8c035d05a6, 0x608237417ed7,
+0xb542bfb3c1d0a34f, 0xceb7c16581a6b854, 0x10dee7e69b335c8, 0x56e7f7d7ef3d924a, 0x68e37d1b7729eee, 0x2b6fec54b7781821, 0x1d07a0e7e6b13,
+0xab22832200741f73, 0xedcc4a9a57de4447, 0x2822968499b84837, 0x9c89fec16b59659c, 0x8e3c16e07f26f847, 0xc40b2015321205d4, 0x22fc64ab3b271,
+0x47fe28d9771c6b65, 0x72aec68980f4ff72, 0xa0361799f06f18e2, 0xf11ee23c328069ae, 0x7a464eaaeea1402, 0x578da45769f5efe7, 0x178eb0e511bbf,
+0x1c1b4cea1903e79c, 0x7663cfcb04efcf62, 0xa808bdbc6a475107, 0xea65bd80a1e570fd, 0x610ba2b1d673982d, 0xdf67eecc77309440, 0x1e1d312c9ac71,
+0x20103fab5a48cabd, 0xdfe96b73199958cc, 0xfb599a6d93126bab, 0xcf572dc1357fa5d9, 0x10261cb7d0f212b0, 0x640e6b741d9a98ca, 0x4ffb467af781,
+0x81fef92db91edc02, 0xca79fe67f31fc761, 0x9272d54415b33b19, 0x5939dd2732bc9b80, 0x55ad6e03e28817c7, 0x3ec60f37bce0df9a, 0x196df07547d77,
+0xfbbf5ce3f0322d22, 0xacd0f5084d66692a, 0x958ce44d9085123f, 0xee7a283b28f89243, 0x768aca495140633e, 0xf867cf5d2d6d47f4, 0x13dd2e542a6ea,
+0x497f78de9e8ea789, 0x1e19f3786f2c9a47, 0xcd11fbde2c6771ac, 0xd1763e4f08cd332f, 0x3f71af1e6b095d0f, 0xa4040a431e300069, 0x361066ed2852,
+0x1bb105d2aab5752f, 0xb8044439d288ef30, 0xfc0514759724ab78, 0xe12a80096609076e, 0x69ba60a597dba282, 0xeb2dc8e1230bf2bd, 0x1760818945da5,
+0x662670bb766dd75f, 0x1082e4a8a9713dda, 0x541674a1bea50213, 0xc36682e40a83c29, 0xa1a3541deba7d0d3, 0x271121a1705b9e82, 0x6590f0701946,
+0x867dea2f2bc6c040, 0x481763eb5e3c8a65, 0x74b63e30511aa002, 0xe91b513c45fe411c, 0xb6ac0cc5951bdd63, 0x8627210115217fdb, 0x9ce6c3d7de1d,
+0xb4fdf52f0933d000, 0xa5b26fb434c72319, 0xcd4f4b68d9472bc2, 0xc4fbc2a217935470, 0xeb1ef782022eed98, 0xf5959b6cf0fc668c, 0x5f060e6d839d,
+0xd1f243bd35187cbb, 0x88657b0e976989c3, 0x652cd0d66c5ce771, 0x91b9af4645f852ba, 0x846a902767fd486a, 0xe92ba219d03f13a5, 0x1e4b145fcc417,
+0x369f64ea1bd95a1e, 0xbbed7e20ead6a540, 0xbe13bedae39dc625, 0xe9e69c95c3845fb9, 0xc9965ff91152e338, 0x36584e0c0106254d, 0x19141a9e305db,
+0xe866d57334738647, 0x10c857586908576a, 0xb02104eee2bbc7fd, 0x94b70486ad43dc3, 0x41a11ae4528cfa69, 0x95d722916adf7a15, 0xc7e49c0830a4,
+0x631e4999d16bad6b, 0xf1baaabcee7b1635, 0x37c94dc06528c2d7, 0x29eeb41c0c4c4cc6, 0xbe7b037485645805, 0x48e2e79cd1c22583, 0x1a78a642b67d1,
+0xd6d845536ce4e94e, 0x9d000eeec5bd8cbc, 0xdd683dfa9254a92f, 0x235fbcda0ca9460b, 0x830448dc328c8d00, 0xe0b66db9ecde584d, 0xdd0641232f99,
+0x6c2888868b922179, 0x995a9aea4750768d, 0xd9914d4a8f009199, 0x4bca66dd2ef8b5c3, 0xcebd38fba764b3c0, 0xd41196096a2f7ea9, 0x13d2354a59ecd,
+0xd68b251ddc4b4490, 0x48db0d68aec593a1, 0xdb6eac0dbd762470, 0x1f34fccaf781853b, 0xa6e225b4bfe98658, 0x1c310f29039da5a3, 0xd894c772bb63,
+0xb161ec8007dacd99, 0xf44c903b204b03b7, 0xb2968e4a8db317f5, 0x66086b241e89b2bc, 0xe7f7596cf131c251, 0xbdc55ad69cd5597d, 0x1961b675bc3c5,
+0x78e70eec43cc3f1c, 0x845097078f5bd5, 0xcf34bb71fe8197c2, 0x54f43efd570b3d52, 0x86435395d10c4dca, 0x4de3b3aaa0e307cb, 0x1f50e733d985d,
+0xbc01b1aff02e93f8, 0x279e6bf040a59575, 0x86d6fb2694d9e6e, 0x6d6ee4c31924b45d, 0xa1a5974b3c2d6733, 0x8f83c0b4574ec901, 0x1004e5365b205,
+0x1d831d41bb42e1b, 0xd1a9e9fe629de4d3, 0xe6dfae98638b8b62, 0xd351f63644e96cbb, 0x5bbfec9cfc7f2f1a, 0x863ecb471e0bf240, 0x215dc89679690,
+0x8653c33e164aed8d, 0x8362f5794816de84, 0x6b51a6e850a8c56, 0x1e3068ec8826fbc3, 0x37bb19e7acb64ab9, 0xab75efaebc232a9c, 0x1f5dc7c871698,
+0xeadf480895b17482, 0x898052b323cc03ad, 0x4340746ccb987c6, 0x9a291b2150228f55, 0x3dc4f043ab695d4f, 0x1aa9d688f93eb4c3, 0x118853c738819,
+0x75a1c3afe455d17b, 0x5ed8c102c95ab8d9, 0x2235442141a7de36, 0x96274176b9646444, 0x3f8d99f90153e7d, 0x2fff88a226197b62, 0x12c0111b1fbaa,
+0x9d0e22bca1a212f, 0x30996ecac4944c, 0xcffd699adbfc514d, 0x8f9f2106752fd89f, 0x8ff6b7677c676389, 0x8fce98724933f8c, 0x171d4c2219083,
+0xdea1136d856a71b3, 0x94ea6fb496390cdc, 0x255e6d09480b8cc1, 0x7ade463163abe227, 0x96f13155cb0b8bfa, 0x2ad423fdf1231b2b, 0x173cf8731652,
+0xda415a42d74779c7, 0x494d5ae954034868, 0xf00437813e09e15f, 0x8f10324a7d4e6e1c, 0x54f1d05b6b7ef143, 0xe65549a84bf0db46, 0x20d13c46d2a9a,
+0x55afa4d7ce49cfdd, 0xbc7803283257293e, 0x8fdaa8d6dd202d47, 0x80345ddd8826438e, 0xdc128d8350ffa623, 0x1ef32ef834400914, 0x21dd2c3433cd8,
+0xfde53e8f5d09b207, 0xa3d1c27acb161fff, 0x2f811eff2609daba, 0x1b82cb02266495d, 0xc866a9d2d0568c8b, 0x1884cc1dde329072, 0x304d571ec63b,
+0xc5d280c8f6331f8, 0xb7ed6977d371af8, 0x1fa2d00517677fcd, 0x1122b2132c42791f, 0xc7c17ee95420aa61, 0x664317ba85fbccb4, 0xf338d4976eab,
+0xfc28d126b50bef08, 0xded42a049df5c6f9, 0xfc7f4b1d00198df4, 0x98be23c9ce98541b, 0x1b305febd54ff2ad, 0x5997392fc0b8bb6a, 0x778b18232d0a,
+0xe14f000c346195bd, 0x6ac257b5671e9fbb, 0xe4238c06127193f8, 0xd250220812da8554, 0xbaf7f8225d4bd5b, 0xfb4749d43dd7d78a, 0x1e1f046cea867,
+0x1377ff5d36740a34, 0xbb54fc12d03deae7, 0xd617f79a956c9f8b, 0xfb7e3be2de836867, 0x2ed6a6f447a81a71, 0xe213bd319567eaf1, 0xfd66223dabc6,
+0x4eb1bf72583c7a0f, 0xd8710d009234530, 0xb38326ce839976b1, 0xf338e1f05a10b931, 0xe3639ffe2d76fe48, 0x9ea13df097ff710b, 0x1ff2ccd1d16a7,
+0x9ae7975201f13f23, 0xf5468ef3e697c7dc, 0x3644f41832858667, 0xcb29f0836a54fa5a, 0x51599e911d829d93, 0xebfe64179b283982, 0x22f03c69b5232,
+0x983871a2620e1aef, 0x6fff430fff4edb64, 0x5287200d7bb0807c, 0x415d3d0028c3e9f0, 0xd6081142d0ef89fc, 0xb5739685bc271857, 0x1cbb63a1e4f65,
+0x7cd048206be16eb9, 0x98fe5b85addd2bf4, 0xf5b4c957794a0d00, 0x8631abfede14bf48, 0xe90b4815ecde049d, 0x5f170fc986a9d688, 0x52a6c7e602b7,
+0xfc59ccf4c9461776, 0x6580359e0efcdf74, 0x289911565d94680a, 0xb40a3417ad87fbd8, 0x34b9e5d81844c771, 0x1cf6ecce898c9fa1, 0x8a39ef3d9e96,
+0xdce8f7800ec5e4df, 0x94f076e0f752e6f6, 0x731451a2aa0c2f1b, 0x39a8889769f323a4, 0xbc2813a615af98ab, 0x615b3f2f5aed5c11, 0xe3a7c4ad5026,
+0xa37c3ce4ec349ec9, 0x440b56946cee3abd, 0xe02db044d676d69c, 0x940e11d38038a0a4, 0x48db56aab42ca45b, 0x4cc512294706b0eb, 0x4b51768fba6f,
+0x9537531d7cb5b794, 0xc0cfedd496192e13, 0xe0f399fa084819c4, 0xc934709352eeeefa, 0xe372f43e5a185ade, 0xce5580c0d624938e, 0xd5103ed46d97,
+0x2134f280d72f05d, 0x62b12b2fbe6a8136, 0x7f3737308d03e3d3, 0xbb776cdc25a26172, 0x43b4fbda2f3f2a5d, 0x1680353f3243e3ae, 0x1fe9e388f61da,
+0xa8b36e261cfcf9c6, 0x110ffaa19f2ee57, 0x4a8c709d860bbe6e, 0x8c60c27e517ac6d7, 0xc37655e781cc8f9c, 0x6089178d56040790, 0xa113e71ddbad,
+0xc274dfa0d015996d, 0x99e3d75468f70a49, 0x4de4ce95fa09d8a7, 0x130376158773a75e, 0xedf0a383a5e90f27, 0x7641dc45ccb3ccb9, 0x1c1b4c74c44cd,
+0xa7fa4c8d8fcf423, 0xaeec2c59e37a61b7, 0x550a46ee48e8ec46, 0x235807baa648cf98, 0xecf3b5d48c0607f2, 0x9afb008f1855af9f, 0x1952d7ca964cd,
+0x31e11b0a5d8075b, 0x8f41f003ceeb4c4f, 0x700be80457a76f40, 0x33cf0cdd38f23d5a, 0x3817b56371efdf13, 0x10dbfc2da38808b5, 0x51e56e766b4d,
+0xea4b2b484beaa9a0, 0xc3017217614de419, 0xc05314b16d65e19a, 0xc37c1f7214a8351a, 0x5d01cbbf83db0cf4, 0xd9e301575901ed5d, 0x92bf7d17cb49,
+0xb49f6c605aecf5c1, 0x831d3700e1c6bae4, 0x3eafb9205bebb51f, 0x648dbeba0a8ac506, 0x3fadfd3a156881a7, 0x5ffb224f3fb57e2c, 0xd95e1727542,
+0x16aff9727dcc45bc, 0x89081aa68e11cdde, 0xf0c40c264d97c7a, 0x5177fb13b8448eec, 0x213ec37bd840ae97, 0xed73c72a0625bc67, 0x110465e2c63a9,
+0x469098f80ba7bda7, 0xb988a4e11b589a68, 0xa08df2bc60d9bb86, 0xecd9f532280e1f9f, 0xd580f7f032685d73, 0x3e78127c7fcae1b3, 0x1d25d06ce214d,
+0x380284084e8fe247, 0xd55a66a7d3cb7752, 0x1bcef47a34af85fb, 0x99df3c466bd84129, 0x846e5d3d763bcb06, 0x534d938a011d31e7, 0x21fde0a772dff,
+0x1365f8ccb4b372c2, 0x31be7e01f237e32f, 0x97cbc9373a2b92b7, 0x47641c6730f96f4c, 0x3e0d5c7d9615168, 0xe9eab6c608020884, 0xb1871e63f9c5,
+0xc6f9fe008fecc3ae, 0x29ab10292331fe18, 0x8ba61b5c4d19237, 0xc59858b7487c3fe0, 0x3751963a8d74c28e, 0x2b6d329f11517563, 0xe46110a1d675,
+0x3750fbbcb262e435, 0x9063beba62bb6392, 0xf555be71d1102d0c, 0x58ba20cee738eae1, 0x74cf1464692f2f6d, 0xe9e63da1a99dc07a, 0x1d0a5671b2aed,
+0xae644fc2c6702042, 0x7a2962432c8967e1, 0xf1b8276844b34367, 0x92d8cc242daf4166, 0x3359a7e070d2c50a, 0xadebd2acb5017e02, 0x2bf9be8ee99d,
+0xd15773327ddf98c1, 0x4061176951f25b64, 0xcd80b26000cbd7e3, 0x43ba72373482e144, 0xacc807908c32c70f, 0x33033e0fb978162e, 0x10c96ce2aad88,
+0xd5cf63cec5bbbf32, 0x282da4bd398ded66, 0xae06df2cba9933d5, 0x73151c7e74708a04, 0xd60d3eb17a9bc0cc, 0xcb0ce626b04364ce, 0xbee5ca4127ec,
+0x4e877898e831bc4a, 0xe3b9a5e1690be0c8, 0xe4ed127e6b6c28a2, 0x46db80555f40bbf7, 0x2a45f2d27d5dcf40, 0x6eed7884b1f9c402, 0xb8e230d19a1d,
+0x4bd35b94cc4ef8b3, 0x60264950e5e072c6, 0x990d53bde6f3b06e, 0x8da141c6cd4ff927, 0xe75b82d235cde68c, 0xc41a50ce362431b4, 0xe0ed10107025,
+0x1a8378c44d2e6b6c, 0xdfcc7b74d84c589b, 0xce2abf02fbec8993, 0x666d379e6a32ab0f, 0xe98c441a53aeac7, 0xfde8e125ebff3dfb, 0xc46dff88e4ad,
+0x3ff160b221b27a12, 0x3599b3c82d68d5fc, 0xb160d78189f1a924, 0x4121fac8d208444, 0x5da1c075f0a2354b, 0x3ebbe0077633b69, 0x12a97765fb997,
+0x4697d851dd6688e7, 0xa6d1d6343ddd3ae5, 0x24c498df5c9768cc, 0x2c6f2eecdddc6f24, 0xe3cee097ac302806, 0xfc9e2a21b7d56775, 0x40a695815baf,
+0x271bbbfbaa980411, 0x72311e9167cacce2, 0x9aff3b79d5d9718c, 0xb5c524f90e66a796, 0xec60c6962b92e88, 0xb38e78432fee41e2, 0x6f8cdf1a81f4,
+0x9a4da90c618a4b26, 0x54b15d4dedf8de3d, 0x1964a9c16dfdb753, 0xb08d0ec37db6bf44, 0x72578f2fc842c51e, 0x9a2fde39bee0fbeb, 0xd8459b1e41c6,
+0xcbbae92cada46a6a, 0x229719c809022e3, 0x5d7894858ec5e9dd, 0xe13f3802bd887d5f, 0xfeca67988cf877fe, 0xe43dee2bcdea1c04, 0x1b160dc739594,
+0xdf2db855c0d24dc5, 0x64b9a296e8a3506b, 0xbbd3bcfabe6b8963, 0xe8a2b74c3837e6cd, 0xd55fd3e2d8933528, 0x88a79d4338e06221, 0x6054ee3c61e8,
+0xfe54f7c59e33e653, 0x10f579014fe89d12, 0xd0b30503fb8473a5, 0x494347c06e8f5238, 0xf9a9505f5f70bf9e, 0x7f57ca41609412f6, 0x1ec6d54e83daf,
+0xf2361c18553d6add, 0x38aa2f10d864420e, 0x5ad393a112b3aaf1, 0xe60457eade548963, 0x1a0c1d2d0cba9383, 0x82a8526b86719928, 0x209f7932d2fd,
+0x6c9e8fe266804d1a, 0x4688ea204aa4182d, 0xd67c2e39fb04d210, 0x47cad427683f4c56, 0xc95ee159185092c2, 0xcb2554ca867e1f6c, 0x214c165009386,
+0x75ed347e7f59e758, 0xe2fcddaa5ff40f97, 0x74ac445e2d65e79a, 0x5cbf64acc43dd03c, 0x4e9a91d4d1ea5854, 0xc336fdcaf5d422cb, 0x254030cea521,
+0x825f162fa7766696, 0x13c57296a11387ee, 0xf1ae5cc3830b62f8, 0xb1854bedcf21083b, 0x96d09396d513183e, 0x2c558cf5479258f7, 0x1abe395294036,
+0x6b54d030fa922dad, 0xfa25693e54b1c16b, 0x360d5548708ce6f7, 0x9873e3c2e287105b, 0xc613048ba1dddd35, 0x817fabc98dbefd4b, 0x1252bc402bb4c,
+0xae1fe5a4c1ee49f0, 0x35e2eefa718daa40, 0x5d29b62ae6acc5ee, 0xc4878ad89672aa5, 0x3f125b4b590e3c76, 0xfffe63c6a2cc928d, 0x119a096cc2101,
+0x14a0d0813f77ec38, 0xaa2b22049585c2a7, 0xf7181cd7f78850fd, 0xa0276b2105ed1ee0, 0x17f70b8024160f2b, 0xca244e486a205723, 0x207ef72ec53c0,
+0x22a8f00267b20485, 0x677984f2feb894a8, 0xc9dc0579422a2501, 0xb3e33e486697cee8, 0x3db6775d1af66a82, 0xde4ef27fced09ad3, 0x65ff541965b9,
+0x207ad36e92e331a0, 0x20634a273ad1491d, 0xb645cfd3776eb32b, 0x693693908a832ab6, 0x719d3bd702d1ec8c, 0x2cfc73193faa50e1, 0x1710ba5f0d4cb,
+0x5f735444be4ce928, 0x42e6ce4611092af3, 0x6dfff3df168a66c, 0x5f50c7aed3dadc49, 0x4feeafac6d93302e, 0x962dd1d2e4b372d6, 0x1da37d4715ac2,
+0x9da6a272b046bb14, 0xed26029a96b70484, 0x620175ef6a4dc4dc, 0x19eb10f19ba74f5b, 0x8190e48907252ac2, 0x94e48adfd87e4e1a, 0x229d930682b42,
+0x8d52cd603d9f0e3c, 0x3bd2233700fa712b, 0x14f22b05ce4525ec, 0x6abff28194b2c62b, 0x63f5ffb81179caa9, 0x4c50a99a29bb769c, 0x22cd6eac5c525,
+0x695aea7b922a74a9, 0xe66c9591ce3d6fbc, 0xa32876ef8accca3e, 0x22d8e1849e6491c6, 0xc574fbafe83d7c72, 0x4e0538dd2086bafa, 0xb449c64b563f,
+0x1b519f9454a7f35a, 0xfe042ebf2ea25076, 0x6b2cf1e72c15d28b, 0xe1750cdd5692db28, 0x707ea678197bb342, 0x75f4f20054b9f672, 0x145ae059436d0,
+0xda88b3b9455144ec, 0xe801549f23f8c91b, 0xbb3b3177a5061354, 0x8024455aa8f6bdd3, 0x196267164dde785a, 0xc4d7db48f0cefdf, 0xe2b2abbe7567,
+0xc02600024c270a6, 0xf6e935cbb4454991, 0xcc7fc6adb5019818, 0x877adb59f6acbab6, 0xd1f89bfb31f82d96, 0xe7031fb71f82a1d2, 0x60a4c1a29fcb,
+0xfffa367a29332322, 0x7f9772784eaa7501, 0xd1d538e2f0fbb0c3, 0xcd6d3c6c9368f9a9, 0x8ae92f6d9d324578, 0x34a29f4604cbfe46, 0x19d466606ff5c,
+0x4fe6b56b96f4de58, 0x710a28c2cf48a935, 0xa6d1ba514950718e, 0x751934c39b1c07f0, 0x1c7381986e96da3a, 0xce77a5ad823ff3ac, 0x2179c065f1466,
+0x97f90c56493680fd, 0x7dbedfbf7eb7beb2, 0x460e7e62622e1bfc, 0x8867a4912d18623f, 0x9c5944187671c01b, 0xca418027049e457a, 0x100dd75303c0c,
+0x21af72b8eaf10b81, 0x795f62d42f7d220a, 0xcce05cc824386db, 0xc5d8bf88c4d6b6b, 0x3feea6b4a1f970c, 0xb460bba75495127, 0x1bfde47bf7003,
+0x994f5355ea7496bc, 0x597ffc25427f9735, 0x325b8570baf859ab, 0x6f82b7267b3af3eb, 0xd859087a915268cd, 0x3019a99929d4ae93, 0x10d27d1e4b69a,
+0x1b144d08f00c2424, 0xc0b78a03af8b5c18, 0x1a340043cc97615f, 0x2522e5c49eadbdd8, 0xe2dfc031f21add9e, 0x4510b3b7d74f8f76, 0x841dd3b26874,
+0x63aeed38c7e85148, 0x3a23dede2a52dbcd, 0x2822f68a8087f921, 0xcd463c21c8981f71, 0x20f320d4118b645e, 0xd455bd91cb143095, 0x16b715fcf430a,
+0xb730ed9c53178896, 0xc41f96d310b5a7dd, 0xda64b1f81d59bd1b, 0x4a108d07ec3e877a, 0x3be7a8b31e4f3c87, 0xecaee4411496249e, 0x2101a3cbda807,
+0xb0027865dbe1ce12, 0xbc4cb1aa8aab1f7b, 0x3f3afc9224147a1, 0xecd5fc6de6bf3f3b, 0xc89152514c99ac59, 0xfb04f923ffdd8a8b, 0x487028f3e690,
+0xeda14614c8ad1192, 0x48586cfeb32d9238, 0x1dfebcfbc8bc60cc, 0xe836e42041b4f8e9, 0x5aa3bd92fc52e8fc, 0xc6bea7c9a14dd76b, 0x2da5409373b3,
+0xff546592723b2791, 0x8cc65b81f818ec14, 0xbd2c0c703023481b, 0x391f60f71ad76ef8, 0xf0f8c2417eff1435, 0x4a8043235675ea08, 0xb96f991ac402,
+0x706e1cd4eb55556f, 0x66e31e58f53eb5cf, 0x86cb9c08a91262fb, 0x1fb40747d33f2ffc, 0xef23656b08b79198, 0x374b4ffd469c490, 0xf274d9259430,
+0xbb0fca86d3edbba0, 0x1b040a83cc63d789, 0x3c226caca61b131c, 0x3ea64f6aa9dd03a8, 0xfe74bd203e2de3e4, 0x9829034d009f8abe, 0x1ebebe0e567f7,
+0x3b211ad459c56b81, 0x90d8d49dcdea4d39, 0xb2dec93e2e6b62e3, 0xee897c6420d26ada, 0x2cb56603df126d12, 0x58519b00db159f74, 0x7ceb8bdf4a10,
+0xdd8347293e07cced, 0x8f0b2264e67098e5, 0xacfe0ffa6be46c3b, 0x868a655bf7d4bd27, 0x525167d75336b0d, 0x90d8325d5df5fee2, 0x624bd31f18e6,
+0x66cf3f705bfa5066, 0xf1f021c42fe1dc7d, 0x6ab48ef406593715, 0xe0a36cbb63a48312, 0xfa19cba1378c402c, 0x837ab11b9d7b8b25, 0x16512c0047948,
+0x6f02a203ac09d5a2, 0x2f038c3a54ce8aad, 0xd656646c6c5145e5, 0xef68543ea2f4fceb, 0x787edf99bb934e3c, 0xf679be382384c327, 0x116ec426687f8,
+0x7799550b014cdd2c, 0x9eed1a965490de86, 0x907abf9f5a34dd14, 0xef6f7481c3f0bab, 0x81c95c80db0fcf7, 0x4b46105e4a630d76, 0xb393b5a7c519,
+0x897c43e18e3914ca, 0xcaffcf3487a9ad6f, 0x16910fff14f744aa, 0x64783cba1d49b5c8, 0xa3bb9fde4c78e049, 0xb5177e2a8520c028, 0xffda1f907555,
+0xbb71182802491fc5, 0xb37651afc9181f5d, 0xfe2fa41f18388a8a, 0xe8a9c5d2a0530550, 0x7b7f5af524db563, 0xeaec541b693a4ba4, 0x7065b829fb0a,
+0x45b02d2b27f7b2ec, 0xdad18cce37fb2cd9, 0x609237df1edc1ee9, 0xcda96f23069e721c, 0xc12f1689cc94be7a, 0xea5e94fba3cac433, 0x1c8f23e05ae08,
+0x6c75d619a95e02e0, 0x2429643d6a2198f9, 0x8afe18a8060518e5, 0x86208be83f8b7dfe, 0xa812a52fdaf3427c, 0x4711454fddca99eb, 0x14d9f1764aa9b,
+0x54e75014f5561085, 0x93a6731652cd4aa1, 0xb4c6bbc79d370179, 0x4cc33bbe286ed40a, 0x9978da609f9f2f19, 0x76679c77bf7f5375, 0xf3f0a513f15a,
+0x31fe615058137baf, 0x39b9c814b8852cd, 0x357d64bb8595c18f, 0x5bc766ae0c4f977e, 0xc9e03eb952b74745, 0x8d714930397d3c1c, 0x43fc6da640c0,
+0x555eda9512c37d86, 0x1dedda85a0e36f41, 0xc08ba91e1bbf8270, 0x1fc279390ed61377, 0x8ff1b4cea4e02733, 0xb4fcb54d1ebc8a2b, 0xaf859b4117f0,
+0xceabb8a3ad37e4f3, 0x26fc9fe35ca31fd0, 0xefc7ffd313007d23, 0xb911bca0a27e3d26, 0xe590aed99e53cd3b, 0x137a57f0ab10122c, 0xda26a778500,
+0xfdead7fb9b768f2, 0x95bda1554c636790, 0x5e9a6f3c2c15cde9, 0xc774f1420e5a83a6, 0x96fc4e881c868b9e, 0xeece280cfa84d6d3, 0x127689a052913,
+0x88217d2571260ed1, 0x95b3e45c99b3c33a, 0xbab8e5146b730749, 0xd3a1fbb8e1347484, 0x39612a62fec4a587, 0xc98f441f0fae1e8d, 0x16c27b941ac59,
+0xfba8c6d8e56db86a, 0x5b9a113752c4ffc7, 0x49afcdb903f2f31a, 0x7b237eaff838237, 0x3a084ca5d165135, 0xbaed3ebd0cd6ff6a, 0xadff77a5e76b,
+0x14f15601d89f993f, 0xbd1e482b84a4bb84, 0x19e5354c1485a675, 0xd9ab594ba8e5d5a8, 0x489be023bb2bdbc1, 0x69a5dc677a9f3796, 0x104ad97c7c939,
+0x9f89d503b38eb0f5, 0x4d3ce14617df6e7e, 0xa34e8777da269b7e, 0xa0e38648009ed9b5, 0xf3497ecc603316de, 0xba3a7bbf9f24213c, 0x2165d224fbccf,
+0xc7aa133be309c09a, 0x59175bfcc9e076d6, 0x510412f4b1615eec, 0x57018163e5b45dbe, 0x593c8156dcaa412e, 0x5b3844b378f77dca, 0x1cb44812c78a7,
+0xec15b5a29a5965f0, 0x51dc2fefec1193d2, 0x37b9e918eed7ba7f, 0x5c756beaa00c5ff, 0x31a3028e3fa2ed58, 0x5ba979fec87ce8d4, 0xabee2211e5aa,
+0x86a14336931fbc34, 0xbc8f9d15fd054b32, 0xde85502955c1c5f6, 0x9a0445e74a509b07, 0x527c29b6a9fe549a, 0xfbc73acd2d6475ff, 0xb8541deb62db,
+0x1e898aa6198a9792, 0xa75246e3bf38252d, 0x46b207cf9f6d56a1, 0x9ec21555aad657a4, 0xe10a87245aeaadf4, 0x9de3feb9f5e0320d, 0xce39411c33fb,
+0x7b308628e020d09f, 0x4acd3bb015c59294, 0xaf1df6d015440c1f, 0xe312a768a22b74e5, 0xa28a39b792cd4d9d, 0x1f701298e4de5bca, 0x12f301c34a2ac,
+0x6921d602c00f46d2, 0xf2cb5b2640fcb676, 0x9cdb35576f8071, 0xf4da49839c6dea3d, 0x98f7d57694b5e43d, 0x59290d4a54199fa7, 0x17145a88c20e9,
+0x15ec02db25982162, 0x60b64520c2f6ad52, 0xd3adbdf5d8aa6462, 0x4a73c9e23c7a2c1, 0x38befc0bb8be28c0, 0xc1b5bc2671cae375, 0xd5c011483e80,
+0xb914386126ac15fb, 0xb1497d55ee2d1977, 0x4ebe731df4d170b4, 0x6caf08a65e994c34, 0x7496ff5794761ddf, 0xb14a62d53acc0a69, 0x99d364efd56f,
+0x79c855b89e646f13, 0x7cac15735a75235f, 0xb6144818dd26d6f4, 0xeae5ab3250eb1bef, 0x3bf626b0f6a9d268, 0x50679288631e70bb, 0x1b8114a3c5863,
+0x33895747679969a3, 0xa1fcf1b76e49133b, 0xbc9487cba4f2dd71, 0xe39bd09f88f23313, 0x1bbc45026b22a9cd, 0x2f36220740c5a1b8, 0x17f304b03b435,
+0x521374cb0eac67c5, 0xb1fe57fa9bd22aa0, 0x95c6bcf61c3dc479, 0x112285d33025b200, 0xe1f620df3f5544d5, 0xb5d2a92e7ddc6d40, 0x5d31a7fa587f,
+0xae1816b35697dde, 0xe9e16d4d47a7b914, 0x928473d20ab3f5ed, 0x3ef16c787cee88bc, 0x21b589345b49a9d5, 0x601574ce06466474, 0x7995ec7f215e,
+0xc8fe45a91abaa67e, 0x320793d264225c6a, 0x5060d87ba0488c3b, 0x436cb796938506d9, 0x60710e8e656f93f1, 0x6ff536bc7e2b15b4, 0xf6e0e1428fc1,
+0x197bf0bf62b206d4, 0xe7b3dcca1799e3f2, 0x60ce228b63fbc2af, 0xe691e487402aeb16, 0x1ee2623676ed4fa, 0x2a6f8eb8bd4b5ef1, 0xd215d72bd2be,
+0xcabb606569da625b, 0x4c94288d35ac026f, 0x9119acd0c6c36864, 0xf18bd784966d0dfc, 0x3da1fdd1de5ed75e, 0x3bac815c0fed132, 0x1b939edbafc3f,
+0xe66ea93c1c92d418, 0x74ebcbc38aa93f81, 0x5391225385e0879a, 0x2fb409f0b9812432, 0x5d32966ad14bd963, 0x7c2f3ed58570ba9c, 0x1d4e2999f7dae,
+0xec5cff49fa0df902, 0xaa5c827159eafce0, 0x614fbf92588979e9, 0xb29c8187a8559459, 0x56aaa582273ada8b, 0x6c7b561ed62d141e, 0x4ea34a03389d,
+0x5bc54cec8efdc4e4, 0x1c8e2e0f23f28b35, 0xcf19ad394807dbc7, 0x149776e087a6a179, 0x899a3e3d11b69c79, 0x4da8e61e5d74b916, 0x101cf24ad2b79,
+0xded92b05c6e1308c, 0x57a201c7d9ef4e5, 0xfa27cd78f239203b, 0xa6ccbc73eeb4a648, 0x1b371fa7ff229ad6, 0xa8f1a39d359034c9, 0x1497a9858e587,
+0xb41a94e4cc367e03, 0x23333eed38b82d7a, 0xbbe510d244e6d0fe, 0xd5db9a9014628dd0, 0xd6bebb4c599c46bb, 0xacdbdcf0fe8e05b5, 0x6c46b4e7d998,
+0xdea6f4fca0627498, 0x75c49936f406ccd8, 0x96d2acf93e1b1a05, 0xa05a3429616153e5, 0x87b2b1c992a212fd, 0xa921139ade9985ff, 0x660a0b14511e,
+0xec75478c98a2433c, 0x84b7974cfe07aa45, 0x65b964dd4729f814, 0x17fb72d4d8cabef7, 0xc25c1530e015b6c, 0xd0b02428a6fde66a, 0x1e6f0eca73311,
+0x33b2a97ef1ec37a, 0x59d7b292393def62, 0xaca192ef30830771, 0xf1c793ab7fa938c1, 0x562c1e7ac4b0ea92, 0xfb73b9466917afda, 0x164c1a86cb3a6,
+0x6efc27446a7920e7, 0xd9f3bb001a6be585, 0x52e81fccaf7257f1, 0x304bf51d1f90f5e, 0xafaf8b558f80b62b, 0xfc38199df31ee6e3, 0xbc3f8b57e4e3,
+0x470ebf89ddaba893, 0x9bfa2c3730c37528, 0x7a8c9b99a9a86e70, 0xecd5aefd67a9286e, 0x2f4414899339726, 0x91c26ca5eb0e1b7a, 0x1190471e18e66,
+0xe484f6626c744cb9, 0xd2d28895686eb6a, 0x6654a0d6e4c4f078, 0xbeec1c52f3adf233, 0x3e668c2ce03abd5e, 0x95cdfeb3b351a556, 0x1266e0c4d1be6,
+0x24e67c2b4bee1b27, 0x67e9d06a79f6132a, 0x5fd8204d3f3d1df, 0xe630a29f17aa206, 0xd7b7d520cf1f46b, 0x460cd5896a1ee614, 0x21c90ff423cd7,
+0xe39c7f604704a591, 0x7ca486b3bcc5c01c, 0xd21248e801f1be47, 0xc29d1c75efe9559d, 0xd235b85c3bf49dbc, 0x6981da717cf6ceef, 0x2030fd75bd2c7,
+0xcd42d92b71272074, 0x263685c004969985, 0xf1825de6de790253, 0x54d5e21904e58977, 0x71144847c4b825df, 0x2f565b71809f2e55, 0x1e526909e6901,
+0x323b11fc68a512f5, 0x7b3bec5b89675c46, 0xb4adf586f3099989, 0x8d6744136de8e15d, 0x3d03ffadab204261, 0xbf4d9a19f5560b50, 0xc7dab470ec98,
+0x476e34057f39ef6, 0x4a6664b93cccdf2c, 0xe89522003fb28aa8, 0x427b66ada3ff9894, 0x16121b981d067f89, 0xffc1bf07170ec2b8, 0x9e0d9670428e,
+0xc596898cf0a60642, 0xa5bedfc42ae2d56a, 0xf67a2c8b2f01b4ae, 0x4beb62e1415233bc, 0xe1292a33b8236ff5, 0x65d61cad07c06e4, 0x206c315efd186,
+0xb066081ffc1c40c5, 0x3b17da1d213b6645, 0x57f9a417abe0dcb0, 0x41cccb380aa37ce, 0x82f5dd94df9290e2, 0x451165380fdb920e, 0x2ad20eb7ca5a,
+0x8b1752cf3feae171, 0xce0e377fcf18445c, 0x1e9492356263ee73, 0x50f57ba154432dd9, 0x82560cba0211c21c, 0xa55266a812f1273e, 0xa3872ce61861,
+0xde12dccdf0fc6490, 0x8606c07b435be291, 0xb7b37c10813a26d6, 0xa4bf1da9eb1f5eb6, 0x1cf3a21fa702a8c9, 0xf5751052a50b4d65, 0x1b4781c574a8d,
+0xe6c915c409d79407, 0xb66bd2384016be68, 0xea1ebd30129f23f0, 0xd2adf446806c6806, 0x2a4933ca743b80e4, 0x51c5decc6d4f3b17, 0x16f6320019644,
+0x83f225f9e54c64aa, 0xcd91780ae44af6, 0xfe69cb025a83454b, 0x4d2db36114eeccb8, 0x7fd698322f001893, 0x2a4c052928bad186, 0x1bb980ade6af6,
+0x27468115613aa486, 0xfb3b589a5133ea03, 0x23522c59c8da9adf, 0x466d4f5a8fefaa2b, 0xf40195dc0ec96e3, 0x40f4ad28c3317c38, 0x1957aacaf28e7,
+0x5dada9633e33989a, 0x5a42123e0288dbce, 0x3f41e2fb1bb3d6de, 0xb98d5efbff1b6aed, 0xd3d641d2a2fa94f1, 0x45074e1200e4d5c3, 0x1af75da90ec64,
+0x7a2c47746d7cc721, 0xb608c28f9a6d9901, 0x9cd2775a08564162, 0xf91c96dbc53c52d6, 0x96218ace804cef24, 0x68547064b60e5ef9, 0x1f2d856b5fc84,
+0x250c384d0ba47926, 0x1e61be962ffaa7f6, 0x945d924fac8022b2, 0x70bd20662289a972, 0x7eee0bf5fb9742fa, 0x27b089da957c7fc4, 0x22998b6d7bc7,
+0xe2efbbdab585c0d7, 0x7f19a546499c1877, 0x3dc8a9fd88c6e139, 0xbfcae77dbd315519, 0x3ffcb28e40a77f04, 0x4549646d11e4c5dc, 0x182e530ea105,
+0x396c53fe591c4ec2, 0x7880119a39039385, 0x92652d2a7d77a9e9, 0x1dd1e5f163bb8a90, 0x7bcaea0910167af7, 0xf6a7945e44940ad9, 0xf4c38e6b516b,
+0xe8e175983492a77c, 0xe9f370adf1015dad, 0x1fc538eac386c37b, 0xee92823f4ec9ccd0, 0x99b5d94cd65989d1, 0x491dab45fb0538a7, 0x124a5e19d9fa,
+0xc22afe502200f2b3, 0x246deac422f87d04, 0x4b40cda287091d05, 0xafe7e29140ee8a25, 0x39fdc584276c2e03, 0xad209488cc122590, 0x164947189d1ae,
+0x1897bdd608541de8, 0x29e45901511ccf2, 0x683a7c519baa7c97, 0x29953d1e0f6500cb, 0x11e1c7c56f0947d4, 0x1931510b1108ac33, 0x1b01e54bb1cbd,
+0x693982e647c4215e, 0x4145c17bd2902260, 0xe95ed967ec7b56f1, 0xe9acb384a56841f4, 0x13f5bb0673c93f75, 0xb80550b2c0940356, 0xf4b8526b2ccd,
+0x216b688adae74fff, 0x785037d98eba0e61, 0x43fae5a030f72340, 0x5b48492f35b8f1d9, 0xbaf51bd943ff1b17, 0x61d3a8dc86996131, 0x8fa655e39d9,
+0xf89598ab1bdc42ec, 0xf1d8057a103e7dec, 0xfd594dac1b6c8adf, 0xcdae297a1386dc1e, 0x30b19d298f863451, 0xb3d652e9ce066b8c, 0x4244c8675cd7,
+0x48831125d4308344, 0xe7e948ae400dfc7a, 0x50aa959a62c521ec, 0xc2666365382c7067, 0xef54da7b52491bec, 0xc590356df362b217, 0x6b937806471c,
+0x596ca41e26bd7d4f, 0xa2cde481d71a108c, 0xd1c8bc0fcfb6cb91, 0x2789edf01bd18946, 0x295c5456c3834f8e, 0x34e3fe9a32b52d46, 0x2123eb50fa0c1,
+0xd840007f3423ff3f, 0x2a60b2f6482211d7, 0xef81c7c95b6452e2, 0x6df4ac1274051abf, 0x528f752850efbf50, 0x962373f765de27fb, 0x206294e03a69a,
+0x41fc816131096d45, 0x11045b6ce04a47e8, 0x8b6b07aed13b47c8, 0xb6789b61e3eb4ee6, 0x8801d2dbe8aec831, 0xaa48638e682a8aa4, 0x21d3a9fbca23c,
+0x4b8281d9f5a731a7, 0x641725055a624208, 0xa401eb499a625d7f, 0xd0e2bfab14647d05, 0x7eeda65cee9546c5, 0xa1c2353cab08de84, 0x107d6ddb0ad51,
+0x110f90e6511ab602, 0xdd37ea60453846ed, 0x7903b1c408dbb831, 0xcb9817e6008b2b78, 0x295913cdc135ff4f, 0xf299d3242da1c54b, 0x5eb3942ae7b9,
+0xc5d852fcfcae5074, 0x814c122da559c9eb, 0xa39e20badab413d8, 0xce936e0d5393df55, 0x5c1dfe10671d3daf, 0xf77150f0d0588a7b, 0x1e35f4ae04cb5,
+0x44c7e92027aea9b2, 0xc843f82f60278b5b, 0x497f545c003f25df, 0x58a1e28a89d42578, 0xac034621977fa96, 0x7a3b1c2f1195c35c, 0x193130220f25,
+0xa667a627410acc39, 0x97fd6ef438e3a99c, 0x6bb8a461257a3dc0, 0xd9ef26460c3d56ca, 0x4c849d41173aa51a, 0x20e1a9a6e2518d25, 0x1c188074107ae,
+0xce689339046d58d, 0x5642d2a70a8a51b4, 0x14353ec33110e034, 0x406a7f964344fad6, 0x49fbcdd0ec87bfa6, 0xfb1b523a2a30cbad, 0x21dbf496f8dcc,
+0xeb324e14a28d500f, 0x9f54ac53da54b176, 0xf512dd9f35cbc997, 0xcc778fd39e69d14c, 0xda39fa2b70a1a07, 0xf4e77ab88f3277df, 0x11f5f432b09ba,
+0xc07a15fd022a616e, 0x1a3dad2d1dcc5bed, 0xb7e4ecf3df6cbf9a, 0xb318f965b5fe06f9, 0x482fc0fd122c7a40, 0x90a77f3fff356cf7, 0x4cdf461c1e5f,
+0x389dde5435616c55, 0xf9be8413fd7c8c, 0x94a63deecb5188c1, 0x94918790c13d70ee, 0x8e9127e7803c9281, 0xc9d940c5a86c65d, 0x103b35e5e6e24,
+0xf5b1325c746a6a9d, 0xb0f1f8f0515a7b7e, 0x8e74fda1842eff8f, 0x8764ce53375012c4, 0x27e8d8c02d9e8947, 0x328940ad37a59d05, 0x4fcfa314d205,
+0x68fcf351b6f3e212, 0x32e34c008e4a67f0, 0x463310bbc87e7b06, 0xffb6bb55e838fe3b, 0x36d03492c30dde0a, 0x5f6ff7f87352f116, 0xf3abe343950a,
+0x3999d4f2ec1affa6, 0x966f933375b09fed, 0x94941422b92f2384, 0xf89ca82173abaa6e, 0x3e1df2ea1c29100f, 0xde402dc9fe0acbe7, 0x418bcae3fe6d,
+0xeb42e1a53ca046bf, 0xb4d630e796424eba, 0x2f5ba7ef55dad1d6, 0xec5c3b5b9e10ab9a, 0x670b35b6cd0e4d4e, 0x8a7ef8ac6fdab87c, 0x188b80796ccc5,
+0xac379d3300107f02, 0x7cb075759cc88ed0, 0x5a5acaecffb4a69e, 0xcd738e289384ba2, 0x27ac6d0b1292dfc0, 0xcac99f3de0404a6b, 0x2234b8862521e,
+0x983ff61bd76148d3, 0xa4bb5306a56e4a0a, 0xf3bf31502a597bd3, 0x4c265850fd627a62, 0xbfe2380af63ae8df, 0x43451f51eb19530d, 0xc7880d44a347,
+0x2d1e86817bdb4980, 0x94fdae6bc8eb1d99, 0xdaa00189d6d73cf3, 0x28e6380307f2432d, 0x8613b1a39984ff62, 0xd877057923bfddaa, 0x1e9c108d88602,
+0xb87f1f70c234af68, 0xcea3a03136e56ed8, 0x23cb682ae5397fab, 0x6601de55b6894194, 0x7f73c5798afb6a46, 0xee0f2504f444f405, 0x231136b33e216,
+0x1091467403ce3ab5, 0x11c1f33c425a44d8, 0x21bfc1069179ff94, 0xad839156b84b67b3, 0x252daa8816cd94cb, 0xf0c3fee301d7baeb, 0x1f2614453ca39,
+0x194afffc2cd18168, 0x7e9ff0bd94b77391, 0xc9da77174fc1ec7e, 0xe0154c3d0a249e5e, 0x153c307af88935c1, 0xb85a6caff091a54a, 0x1e9be8463975f,
+0xfeadc82916fbc368, 0xadf4f66683da3adb, 0x975fd0ec9cfeb2df, 0xf45c85324a885212, 0xb41ba4733c43b51, 0x5e45f6cc54a869cc, 0x21541e4a83ac6,
+0xddf8de5917c15af4, 0x665b4d5304e89be2, 0x2d1e4b2875a6b9cd, 0x97390650c464d2a, 0x883adb0b0dab28d9, 0x30ea7fa254de3c6b, 0xdead8dbbc9d3,
+0xe9e952445baf179e, 0x59083ae0134652fd, 0x7636396e79f532ee, 0xf97c75df7f3bca6c, 0x72b07602f12df3cc, 0xb1c5fef029342c72, 0x9a63a8fb2d1f,
+0x4afea2f5e86669e4, 0xe36dcf2b5e05e151, 0x9133969b0898bf71, 0xa7dd9b1c92096764, 0xb93f780a0b4a2f37, 0x10cd777e705bd157, 0xf95f7087de28,
+0x59cb1415c642a6c0, 0x7dc89049adb1b73f, 0x9d8f4b3eb5fc8bae, 0x43827076c984bfc5, 0x5839b5828d72caf4, 0x6b7d69e3d7e451c5, 0x1928123f745e5,
+0x77a395dddfbd619d, 0xaaeb6e2017f897fb, 0x654463d905b1fc99, 0x41976c8a172876f1, 0xae608d51d6406c2c, 0xefd4ac1c04cd48e8, 0x1875e97b85fd8,
+0x7b5f1abcfc031295, 0xacee036ccba3bda, 0x7a558d51f02c2b6f, 0xb39d70042bbbaa5d, 0xaf305cd98471d070, 0xc09ebd8c41632b5, 0xa3b2c2cfa3e,
+0xd6447fed57f161aa, 0x6fa28a8cbd64e196, 0x5eadd29db0699304, 0x142c6fed305e52, 0x1a9bffc403d6e1b1, 0x5d7b79fff62348f6, 0x178a0a79a1b1b,
+0x7b73e6003ef4bb49, 0x23f0e3fea710f16f, 0x91fe7571dd26b55b, 0x5204baa020024692, 0x4145ae13497d2b87, 0x380ac79e217ba2a2, 0x13588ef6e6fe0,
+0x92b4fda236c01e3f, 0xc610e71a013d037, 0xbfef2a9a25770ff5, 0x31aba8197a8d9fe8, 0xc68b2f1768dd1654, 0x4735bcb31a584676, 0x2134886b2a5be,
+0xf94d44541bb4675, 0xcb9241c02817d4f, 0xcaffe91e691544f7, 0x577e223c5a20e6d1, 0x23f5c27dffbf66a3, 0x1ba1d8a015a6929b, 0x1645b5f20a461,
+0xdddfd23819846cec, 0xe9fc2ec791c483ac, 0x103cda2dd4397d2d, 0x8b58659bb3cff409, 0x2b8028f18335ed0f, 0x1082be7a69b1b865, 0x1a0fec6f0fe0d,
+0x85a2fbe8236b6911, 0x1367ff2e790e8515, 0xe3e731c5f517db7b, 0x243a86ba49bf8ddd, 0x2c463dd90d58762c, 0x819ccd4a48b40830, 0x4dfa5df9d204,
+0xd073b7d9200ef, 0x646a14113c16de09, 0xdff977f4e6ccd9d0, 0xc92a13660425a667, 0xd89117e3e58e9201, 0x5214a0c2a2dd0bea, 0x2283d2bd2042d,
+0xcccdf0f2e26fadd1, 0xf0e691ca5b793be2, 0x4ea5c9f03b82c4e0, 0xf19273c4024e22ea, 0x6e0571f137b209f9, 0x3f79795ab0086bff, 0x2057f832d17b1,
+0xc3888ca8dfd2550b, 0xe884c7c0fd065b04, 0x535da51fd7b8540a, 0x1987bd6763b6b51c, 0xb6b5bfce22675eed, 0x914106f6d2ec33ea, 0xd75f4bc2029a,
+0x6d529e86f71acc6b, 0x7c03caffb489e941, 0x6bca7ae0671aaa58, 0x6f5ddf340aa5b1fa, 0xfd6ce48017092701, 0x7a04e1c43df13d11, 0x156cf1fd261b7,
+0xb1bd88ef14add5fe, 0xa46d1ae7ce3ddb36, 0x18cc4758cc2de6a3, 0xabdfadb4d9e1588c, 0x5ecae8a0775e543a, 0xc055577636e761a1, 0x96ae5a2ac684,
+0xb21a14043d0bb68a, 0x108802c90a6dd99e, 0x7aba0f11decfcecc, 0x74b53ddc92902914, 0xb1c69cad2c76728, 0xef27491cb55f1dbe, 0xfa60508200a4,
+0x742de9d4509e95f5, 0xf46e9025ab605a66, 0x885f91470e3f3277, 0xbcf91e823db4d647, 0x620ae7b55009ce2c, 0xdb3761e8cb84f15d, 0x17685ea2cd04b,
+0xff512170e8ffb416, 0xa2e4e59c82468f00, 0x54604e0f384d794f, 0x4cfbad38a2b7b1f2, 0xf01077680fa74e97, 0x26a13bab309c8946, 0x924393a64436,
+0x46de4b27a12db807, 0x1284ea920293af92, 0xe388b75bf5203b5, 0x988c6754393625d, 0x71523ba4891ca8ff, 0x203169fae16784d1, 0x102348d3569b4,
+0x887e4f5b6290fdc3, 0x31eed48b4b49733e, 0x6e63ebd95ef3f3cc, 0x702ee368e2318048, 0xe3f5e45b3854d6d7, 0x8f16008fb7ac1c2c, 0xfa4b02a2c862,
+0xe00c30908d839b64, 0x6775667bb4214ec4, 0x47f2707edce737, 0x6fd54a1c71ed447e, 0x24f3402aa90ac80d, 0x6c20f8f81041c300, 0x192487323c648,
+0xd528572481e45563, 0x8fa7cb1ed2e3e647, 0xa8b9f1e9cedcaa3b, 0xed7eaac1e4718bf4, 0x94564fd468fb2319, 0xba3807e3fba0044, 0x2218dc4c48f90,
+0x7a0f96c3b9058822, 0xb109c02d902c5b3b, 0xf2d9bfcdb3f0c7e3, 0xebfe7aef2e906fb, 0x9acdb4596fd4ff77, 0x9d12918122ce88d9, 0x5b23e3da40a,
+0x6ae3cd0110fe6f0, 0x46ec2c0d03e0fd3, 0xa183c17032a1da8e, 0xa8866fd438a331c7, 0x36b8955271b79a0a, 0x4f3d4a1c1bfb532b, 0x9d8d155d0b12,
+0xa9b061c27dac9342, 0x595ca2a5d9519690, 0xfb118f4294ebd8ae, 0xa6c18408a9196019, 0x758aa664b28ec0f4, 0x87a31692c2007c93, 0x504ddd9057af,
+0xc542cd2217cfa3d7, 0xd92939840faa139f, 0x2d6f2bbf47cb1d50, 0x1eb55c382e160e0a, 0x546f7b064a8d4e73, 0xbdb6a7ed8896b0c7, 0xb3361e5889c7,
+0xcc477882822f5aaf, 0xec2b0ae6ed9f5292, 0x545700a2bbbb226b, 0xc3a4e9158c73fc9e, 0x7ac854251a9898d5, 0xe9e2e1e149d42e6d, 0x679f9938b1a6,
+0xe343070a6c2475ac, 0x6d2a2dba386650f2, 0x55aaa7003effc3a0, 0x542a854b87d54df8, 0x7986a57310bb3d04, 0x68b26b2e6b1b9dbb, 0x289f3457ba15,
+0x52525da5d3e87b4c, 0x72e47a33f95dadce, 0x437ac9bcc2384246, 0x7105a26109c76682, 0x6497e695c89d42a4, 0xdfa227dd7e84429e, 0x1b1439c01ed98,
+0x9744eea74999ca46, 0xd2a6fcc4b47b0bb8, 0x49332c6760f1c8d6, 0x1236e58c9044d3e3, 0x28b4bd52e4bc42ce, 0x4fa79f69befe449f, 0x2063ff452ba56,
+0xa3731a2c2208ef1e, 0xac5b92941d6a0c11, 0x5420dc927caba657, 0xe2c39a68f6d5e495, 0xfbc9c4f34d2ce54d, 0xa1003a3c8325f9f4, 0x8988f166105e,
+0x3f1141292011a354, 0x391885f9f6e8c55d, 0x16401d1429bd53f, 0x35460933609fb3a0, 0x48fbc500b778c03a, 0x2e4c1832b3b2a3ca, 0x184a9fa01385d,
+0xcdf0c91312e06116, 0xa0c285d5fd01c20f, 0xa4ac31d529b0208, 0xb0500a5be97bd0a3, 0xd9fd54108960bced, 0xd2fba483eeb0680a, 0x1a2304187e763,
+0xe1428494c3abca0d, 0x9243ecc0b0516a84, 0x232ffedb770d330d, 0x23d3915f89fd8157, 0xd13617afb35552f5, 0xdb0af4586bdff3c, 0x1a6bf72fd3c19,
+0x6a3c962e8f69c10, 0x1e233ec301e5f6ca, 0x9ce4a511d3d3a076, 0x96980dd0921d868d, 0xe860631135f8f5ef, 0x7b4e60db4a3d2ddc, 0x211a33147a1af,
+0xc1b6c574c41c045f, 0x25c7ef61c26f2f7b, 0x1a97c92c2f468f52, 0x658d6b49b73514ac, 0x9c09208cfde2f530, 0x737fe07eae5083d2, 0x1fc56af61b2ea,
+0x22fe33e93b32b6e8, 0x7663cdac6342b118, 0x4ca83c1d855b85ba, 0xca60dbf99e37201e, 0x6715a393e5f431f4, 0x51b5bd309daa4c2e, 0x2094b4f82f50f,
+0xe84cd20f920cb31c, 0x19bd3bfcecb9bf97, 0x773cc29aaa5caf5b, 0x2cb72c963f62bd2e, 0xcfa5e94bf5bc7226, 0x503081ebf9076e93, 0x205fb677a7c9b,
+0xb353300a2a50ab1e, 0xd177897cef8dffda, 0x3ce92887f1665fc9, 0xafabd6b53c7aa540, 0xce3d1dd17ef92a14, 0x5f21aa1a44d5f838, 0x9116228e2ee4,
+0x5ce8f872e0718319, 0x27654576d8ca6344, 0x2429d4d0e7484448, 0x2ec894c9f3cb0ead, 0x917d10f651ca41b4, 0xd64303f9e7983863, 0x64f9dae0dd71,
+0xd7927dda1e7ed096, 0xe3ad6f32a042ae02, 0xee7c204769e508d0, 0xe06b17b271478cfa, 0xd29275b201b0e6b, 0x53832cda6497a995, 0x96260f976a7,
+0x2c0b34b383e03d3d, 0x5a174697b6500d74, 0x322ee8602eddee7, 0xde926e5bccef5882, 0x71209a752dd8c738, 0x76cf879f4931d19b, 0x14e6129ab892b,
+0xd5f342bbdae2e19d, 0xf23ef9f1bce8115, 0x117b475ae2a13986, 0x7dc28a47e909096b, 0xa539e82eef9b6cf3, 0xbcc2dfc9ee8224a2, 0x52056b9d4e0a,
+0xf2a12b1300412660, 0x198a175e6a5b1d5, 0x737a2abb63d47f7f, 0xe19154467606def6, 0x495bcbd7ef9fdddd, 0xdc27aed3008d87a, 0x91c3bdcc7b05,
+0xda28dbd729def78f, 0x40cd7dcdc951947b, 0xa59bfb6fc30e55aa, 0xdeda3e6560f73e3f, 0x4f464f245e2b8ca2, 0x1b81c4d00dab28fe, 0x21c1ca8d0809,
+0x7d2b2f361dd3dffb, 0x74744f1f6ad2885, 0x895d79113653da41, 0xfeaccd31e759e648, 0x6113ca3e102eb323, 0x7e6b00d9f349f8f4, 0x4b8b4f64b529,
+0xce03557d11a8ef30, 0xbe5e28537bfa35ba, 0x30a9585bece3a696, 0x55f27b4fa2c070da, 0xaa465ebee8335f7d, 0x618301d79be36237, 0x16ac9ab4f4ae8,
+0xd62e1bafb87692d6, 0xf95e38a1cedea5ff, 0xa1e2333892817a1d, 0x817a79c5edec04b6, 0xe5cb6b4680c1f10, 0x42057bf7f20a4132, 0x19e2b8df8e09f,
+0x61b919b1ce3b2d75, 0x25a799efb3b02d21, 0x5e0b6f510d4c71c4, 0xd72dec4f8ca21cee, 0x8c257be084fc62d6, 0x1f4bfe43e007b4aa, 0x6619ab38ebaa,
+0x26289c45245f926c, 0xa763f52f2c6349bb, 0xec18ed30f8ed7b5f, 0xa9eff4db57e21e2d, 0x54189c0f12d3cb71, 0x745de71fb061c356, 0x18d703c381126,
+0x80e7c1224b477f58, 0xc80bf20404ebd260, 0xce7715b1230bf52a, 0x50507fc7aedfbc7c, 0x2a7810a5532eb5c6, 0xe30b3048e284c4b0, 0x1ad9aac7a2b61,
+0x90714f201d895d63, 0xb9139712809957f, 0xcf082297bd7c4250, 0xd6af680f518c0b, 0xfd029bcd3df06170, 0x6d1b72e330b7a85, 0x1d9200bb044d1,
+0xcdd024c4aebea25, 0xd4544bcfc48852, 0xbbeb51a127f5d310, 0x5b1f55ff97c6d460, 0xf3982cece5a9b846, 0xfadfb55eef7d3490, 0xa8b6bded84f2,
+0xc2064436afc1b569, 0x526e2fcbd75bf427, 0xc1c7af565b226e50, 0x8399e02873b3c0f1, 0x89c371d55eb9f36, 0x7a9a3ceb350e9bb6, 0x18c32309a532b,
+0xccd950a6f8763b1c, 0x91e99e60dd19a99b, 0x5fbedc1088c9930c, 0x7913ea2422eaee51, 0x3bf158b088523a57, 0x747d3b8bf193915c, 0x67e4876ab5f2,
+0x48ce611d8b3459ae, 0x20cc0e39104f50ed, 0xff1e5f20cc7c6c6, 0x5465c214ecd7656a, 0xec5f572d226709e5, 0x963484c1ea40b1aa, 0x21d7dd789d057,
+0x9060d9b5be6afde8, 0xa860ddd3d73ad201, 0xb43ba65fd607d62d, 0xb90d1dc3e56967c0, 0xd9f52809f4339ad, 0x902a8fb8d925da94, 0x1c40229df83fa,
+0xe6e0765cfe634a95, 0x69e55abc550bc000, 0x29e0580a91bd2174, 0x780fc027649dc42c, 0xe25ea3fc8ed66217, 0x11043eb11edb85f2, 0x16a21304ab862,
+0xfeb172cd8e08f580, 0xc22598840c2bb560, 0xa8562ec6987f8ec2, 0x1b0c9f8722f0f018, 0x17177070df6a0de1, 0xa60b12383732c0bc, 0x1de922f1e4148,
+0xd40877dbf784c1bc, 0x6a969ed8a90af470, 0xcf436443a4799a2d, 0xc0ac3c81605950d6, 0x45e4bc5aa82186c, 0x6815ccaa579e8119, 0x9599af35c1a1,
+0x86a012f36f6c03ab, 0xa0a777c37502f3bd, 0xf2635b3f81bf216, 0xae2320627ef2befb, 0x7f0a21b3e37acda3, 0xc586f72cafa9ddcf, 0x21d470680c7ac,
+0xdd7421580118cfc6, 0x6bf73fbf700e3ef7, 0x238eb3318766f21c, 0x7580993835a303b8, 0xf950bc7bacd98e5b, 0xb389d887dac2ee29, 0xc4de9c8640ab,
+0x2b69605db80751d, 0x83776adbb71e354, 0xeecbe865022b5acb, 0xf4cc129521628c8f, 0xc69b4aa73d68ce7c, 0x90e1e9b6fd9e6ecd, 0xaa8aab91022a,
+0x115b28f2009c25ea, 0xb2ba47ef06c13f90, 0xdf079d766f01a575, 0x491c792ff6dfc95a, 0x254fa8af82bf839d, 0x307438e0df9b5fa2, 0x4cb8eb14265c,
+0x7d50ebc4e1899201, 0xa274bda677968574, 0xec253e66ce431772, 0xa896bf55f81b68fb, 0x27a26e20c905c58d, 0x61ebbd623e6589fa, 0x21bf3a1db0157,
+0xf54a903c2068df68, 0x73d76afefb8e00cc, 0x264aadd46c478a3f, 0xccfd669d02fba52, 0xc2fba46dfcdc5f77, 0xc049ef3ddb8c93f9, 0x204bae310122d,
+0x7c13e9729ca023c0, 0xf0498a115983c52f, 0xf134d6060981d027, 0x1e927488afad55b3, 0x2ebdf42ce67adafd, 0x963f100c33fd8064, 0x2dd5fdcdc7ac,
+0x1204c36bea9b4dda, 0x14d483bdb4f5e4b, 0x168600a3c610dbfb, 0xe5a162f77cb1fa20, 0xbf62a7229e42fd17, 0xc5bade87d65369a0, 0x236910afa2d4,
+0x7f073eb8d9cd109a, 0x6ebbbed33c745bbd, 0xb80e9a9d78959992, 0x7f47903f09db514d, 0x5dbd8c4fe5933a56, 0xb09750e98eb4f96d, 0x2072f71cec7c6,
+0x84a8e96731c02fa8, 0xaa489ede1cf06c98, 0x699dfa1d59c9ce8d, 0xb8b36af37f2dacda, 0x715fe645f94331eb, 0x8d735935bfecb83a, 0x19eb1f65b8e9e,
+0x7c65861935d2fec6, 0xf541d4b3c81a8307, 0xc31d7bac1e2ecd40, 0xc4cb204c12db778, 0x8d70491583561b66, 0x15114aa89076ddbc, 0xcdf2ee355ea1,
+0xb75c00bd4c5ca6d9, 0x3428a18a298c0e43, 0x46f255f042876e83, 0xa06081916a23994, 0xa49cc11c7176e1dd, 0xd3e13afe057e9a50, 0x151618b6cc2d3,
+0x9bcadeb2fb5639f0, 0xd29a30f7b544b04d, 0x3ae61acd58965a5e, 0xa3f97bec085c6aed, 0xa5d2a27fb9653ecb, 0x40f98845e947bcbe, 0xca0786ea17d5,
+0x8dc5e03246fdffa8, 0xbebf55a7f7b32de2, 0x6e1eea6a689d9789, 0x8fa1cff9176c0779, 0x83a9bced82c2e4a3, 0xcf67241cf77181dd, 0x19644ccae9021,
+0xb39c5ccc91d0a217, 0xd8aedd3128178d5b, 0xeb8f02f95ef11780, 0x32078f1bec5794dd, 0xc3c0aaa6a182bb22, 0xb05a28b39c00475a, 0x2175bab862827,
+0x2ed0445450bf71b7, 0xc954f003a1a50990, 0x4eaf90e65076cf68, 0x6f45ae719a2e54d9, 0xde60c8b3f73249d6, 0x5d2b6332dcefd8ad, 0x1ffab8baa5282,
+0xf945936574432a94, 0x9886933604a4502a, 0x867fb3712674f043, 0x525682e0a17e7070, 0x1537435fcb03ce2a, 0xf316ed08a6789e20, 0x175fc305e0d35,
+0x668f58afca4ece3, 0x446c78649d889648, 0x13427b4602aff5b1, 0x80bca522e6442a4b, 0xa080ce1a688e148, 0x84ba36a0233829e3, 0x1e19cd85acb3d,
+0x48e58a83d46a2112, 0x8ae58af81f8d3c0f, 0x123cb64d1fc80ce9, 0x34c16cb1dd29701d, 0x4d8624e57a0cb3b6, 0xc6164d4265b85a3e, 0x2066b2e4e2072,
+0xf91c4b188bb6232f, 0x5b9c1c74a458eaa1, 0xae8d6252d843ef15, 0x9892473ba24bc7f7, 0xe3faf5949edd8190, 0xb70cc0ed066a9f71, 0x10a45142ead4f,
+0xf9cb36821f7d700b, 0xdc424323f997c9d, 0x1c69d586ad254f5a, 0x73cf442cfb4b986e, 0xdea8fe36c6d91057, 0xc3b976dc37bd91c8, 0xedeeca0130f8,
+0x876b3b057487b789, 0x6414f0850dec4769, 0xd8bce03c3b29acaf, 0x35397c0652c2f413, 0xcd7af34c173517f1, 0x4d6d16c1b7d9cc9c, 0xb39fa195bda0,
+0x5f042554bdc7317d, 0xb2780129f029c11c, 0xad40ca962b9e0329, 0xe9f107cf598aa69, 0x4467fb98a15e2f6b, 0xc294cc62f1b89c71, 0x488ab421fa05,
+0x407017f93cfc3b27, 0xcb2a99fccfacf267, 0x9d5790ae7168585, 0x6d87e143ec67b342, 0xc72bd1ca7a0e6d0d, 0x64d576ccce1a1130, 0x105b7bab4f151,
+0xb44c06e6da6b598b, 0xd7f7f82069a4194e, 0xd1eddad59dc2d667, 0x263a77ba54f14310, 0x93fd60f3088eafbc, 0xfc83f6bf150aad74, 0x169265ed9963b,
+0xe73cac6bfd7c5da2, 0x9b49190be9b50cb7, 0x96779469fd43a28, 0x91ad767ae0a5f098, 0x53db97347dbcacd9, 0x9a76ef89e5f0877b, 0xda07b262d50e,
+0xf50580e05afdc8d0, 0x20b88774d0567d86, 0xcc3a9c85669fb2a9, 0x58979b8e7c415904, 0x3641643bbc0d4e3d, 0x4283cd745e095045, 0x1442a3fbf82d9,
+0xb6e501e22427defb, 0xacf77a3b32bfe82d, 0xfdbaf5eb2e629b39, 0xb3bb75040f5b2a7a, 0xfbc94047b9e34bdf, 0x50d7768f32d1deba, 0x768a64a34c08,
+0xbfc01ca93ff5c577, 0x58c58a1a43507ba7, 0x3d0284ffc1e2c27f, 0xf1c8af80574469b6, 0x8cbac624423863fe, 0xb574e8f4edf91d53, 0x218261fa3094f,
+0x65be0611ec686728, 0x49f8ba38312912e3, 0x5e1ecbf97b2ae889, 0xfc3ea911eacc8859, 0xc22dd7b9ffeb7dc6, 0x62ca825e76ad2f25, 0xdec69362f2cd,
+0x71fb238b7bd88a1f, 0x55d8401d13801f1b, 0x829f99c25153690e, 0x945e40fb9e572433, 0x918fab0354acbef3, 0x5d9aa4ff374d9309, 0x3cca551357a,
+0xac83bd3bd8ed2708, 0x6ece17e16b2af320, 0x838c44d010da1313, 0xf1006b74e14857cd, 0x2476b1f5c0145c9e, 0x376a2999e450becc, 0x1cc5b6118aa2f,
+0x4edbed56a9751450, 0x2800761ef407bc5f, 0xcf6d1918f1bad28c, 0x1bff35c690c936b4, 0xb3c56f0ce916c90a, 0xfc45821e0aa95de5, 0x1c5fa8e498349,
+0x71e32ca472c77744, 0x6764ae5c36cc58e, 0x2c668c2b37427c16, 0x952563cf4f339066, 0x4a4d8059207b660b, 0x9cc7845ba4abf1b5, 0xcabd36f9042d,
+0x1b7a7c49203df699, 0x5de1e9df2b9bcee9, 0xcb278fbd23839293, 0xbffc1f9cfb7e3f29, 0x631e9a619d84e8ce, 0x491f31d67f9cb0f9, 0xa74fb75610f0,
+0xa9d6c1ca6055204a, 0x7730f27bb29de308, 0x3276fe63198101bc, 0x5764295ac4d787f7, 0xb580af0ef3420249, 0x91ed7b17d94034f0, 0x18b7dc4df3f4a,
+0x1fd67177dd9cc318, 0xcb7b60ffaf95b922, 0x69a0dd5585b1a5bd, 0x7fd8018ff9d3c349, 0xbbca2597b7cbffdb, 0xbdfdd4f46f1f58a, 0x203d5364bd8b5,
+0x135b9f07beab14c2, 0xb64c824bb69a880, 0xc9eece60ea0bb5dc, 0xb5778f7ee61bfb75, 0x4e76b09f86aeb928, 0x8c60d20820c2caea, 0xa61b769eb7ac,
+0x2e83ba4f8e4b3ce7, 0xbdf3aa0d70cda8f2, 0x82d7e4ffbafe5a47, 0x31b4629bc728818f, 0xcf9ef1d820cfb8b2, 0x35a027245d38e8fd, 0x63df6dbaceb9,
+0xcc3e6c09ceffd6dc, 0x9f4508d6527da8cd, 0xbcf5fb44cd457a75, 0xbeb2245bdd30789e, 0x76a8b976cd06b978, 0xb67f72d674ac90ab, 0x705ffc92e0b2,
+0x49ed2ae7126a8ba7, 0x708823e6ddac31f5, 0x3eb6adc718aa7a5c, 0xf8cdb3ddba0940bc, 0xfe46beb5a7a6f936, 0x7be04fe5ec46c8f0, 0xb7ed22838b3a,
+0x58c763f681ca92c9, 0x71ec15382a27e06, 0x61954132f846503c, 0x8792ad28a22c2faa, 0x3480ee632bf35f3a, 0xe533eb5dd6b679da, 0xaae2a79a3a06,
+0xda274d34596bd49f, 0x55edbcdd8ecec9e4, 0xffc90ecf97f1ce65, 0xb153384f2ad8b058, 0x696ca878e3dd8f33, 0x82bdaf115d4493f9, 0xfdcc24a100a4,
+0x377ad820eec99684, 0x900a6ee418c0da6d, 0xfc32eeed5612557a, 0xf6a2b1c741e00c41, 0x3570868681a55e6, 0xc5981c87702a8636, 0xfc6060fac5b6,
+0x73a130d4d8b80950, 0xfc925739f8c1add6, 0xb71cc487655819c2, 0x45a7c5d0ea85240e, 0x58b02ef17f05ba7a, 0x3cbd47aa03259f1b, 0x1c3cfc3c5d2e3,
+0xced8ff858aff43b0, 0x4a667e8e949db824, 0x58a6c5f80ab8ee8a, 0x81ee09c737dfd533, 0x57c0c1f44e1869e2, 0x312bcfe96d64fef7, 0x187ad9e02ea90,
+0x40b97697c3f7f59f, 0xcab66c9daf9e17e5, 0x12ab60273d1a999a, 0xbfaeecfcb96f8a6c, 0x718e983d8908aa78, 0x2074b884a9b54bc, 0xc9f7da41cf72,
+0xd55e0697421b20f7, 0xed391301be1cd766, 0x1dad190a80e6b92b, 0xb91575891a3a9345, 0xb4efc3701a900165, 0xb164536b16ef0a1b, 0x1b5dda312bcbd,
+0xcfa56e282f469792, 0x7a73ae4234f11294, 0x755381d678a14909, 0x79c196ac16d49444, 0x31199af8ac6af16c, 0xbd53013bcf6d27bf, 0xb35eef18108c,
+0x495bc95c93d23434, 0xe655ad06e452549c, 0x4d0da22eda147ba4, 0xd18991a0eca811ab, 0x5b20d3f40e1c1ee6, 0x7ac39efd64888f23, 0x1b9f00748fdc,
+0xb73838930861bf01, 0x318c4c8750ff3036, 0x2a67cdcbcc2fb0e0, 0x244983903ca2ab66, 0xacf64c32d222a043, 0x1e5f0ac30ef24b27, 0xfdb7ab7fd31a,
+0x6eaf22cd7ba1797a, 0x1b5116bc3b2c6946, 0x1b652c6330aecf4f, 0xbcea124e07b19ac5, 0xd411d990a26e09c0, 0x5016d3dc2cb94d83, 0x2191ef082d3d,
+0xd47631a4076cb78a, 0x506da08d1193dd96, 0xcd0fb9e3bbb377d9, 0xf6a78918e13e1330, 0x58d31ae78047fe17, 0xa6b34d327daeaf3b, 0x8a6376c61dc1,
+0xa9da895362358aa8, 0xc310a864b0362e8d, 0x2ae35d07e204af0a, 0xbb84a2ecad1215e9, 0xa2f27605022ce3c9, 0xef7b97f97e31e8d1, 0x1ec729b36b989,
+0xec4397f965cc2f25, 0xe670853bcd8c36c1, 0x72bd682940970101, 0x1864c27b6578acbf, 0xeb6dbc05bcf687d, 0xb9c2f14af7a0c3d9, 0x1937fa94eb594,
+0x1295a322728e7df3, 0x364473bdc0e67965, 0xa3084f9e9255ccc3, 0xb9fc6dfda5a4be6e, 0x56ef1acfa96cdf22, 0x15c3972cac03d399, 0x7607502aec9b,
+0xad58103df5f46201, 0xe4a4b8150ce1ab6a, 0xee334e68c332284c, 0x4e0ce279b00831f4, 0x53bd08dc276907de, 0xe961afd529ad1b76, 0x201eadb539f99,
+0x1c1445365a99f091, 0x43f7e60b9ef66048, 0x61c843b8befd07ba, 0x57c1da3b15b85c56, 0xcbd5453cff7a9c4c, 0x98f15d6af9d0e14e, 0xbfcab138c368,
+0xa6727373f51fb876, 0xe5a58df2a2e41914, 0x77aab8ac5bc95ad7, 0x4d5ea8cec7f58aae, 0x994e654d4f56adbe, 0x52084d5db29ff13d, 0x2172cf485a512,
+0xb07df1b15b3d9d8a, 0xf32489689a0c11b1, 0xd226f1a43bec5424, 0xec785450f91b73a3, 0xeb79a53b2d0be312, 0x4681dffb792b3695, 0xab5e0f90a1db,
+0xceeee473ae77cdbe, 0xc36cd9c4a2c52c02, 0x3689dd0f9ec5946a, 0xe619902f5956ebcc, 0xe883e6ff9a2a91bd, 0x799676ee18c0a27b, 0x20c6a89f27889,
+0xfbfc2050cbcd79da, 0xb39567e32741f0be, 0xdd0cc2472a012f6c, 0x8b1d859f367e56e4, 0xa49bc1daf53c48d8, 0x497cf349a242750d, 0xe63fb0bee44b,
+0x524d643d561ae03b, 0x6358b51691a1fc9a, 0x4f1d9f45b962ad81, 0xc1b277672688afd2, 0x42b9ba734edcf4ad, 0xc88a487a5c4deca1, 0x22675fd56e12e,
+0xc4e6b70070b80c5b, 0x68d5a5c12567bffb, 0x2ec3da3e5f271fa, 0xcd839095822260c3, 0x2afc7ac460d4b3ab, 0x73c0c1958a0515ac, 0xcc4624771b2b,
+0x1fd02b59e1102782, 0x8b19006ba3ecf982, 0x8817c7b36a2a369, 0x737bd7f94e370837, 0xe857768f90ce8865, 0x49a8a4d6f1650253, 0x6d7af481f7bc,
+0x7a25ce69eaa6418d, 0x5f76f27eea85e508, 0x7e9566440e541f53, 0xaffaa4c380445288, 0x8ecc786f2241d9be, 0xba6722771f93ae01, 0x155450aca62cf,
+0x1e38ecf12a98ebac, 0x40740cc4ddbeb7c3, 0x43f20753c9a62395, 0xd98136d0b1570199, 0xe581e10ee1c9e38e, 0xf1458dc500985f65, 0x1939e78e32752,
+0x35d54aba9aece280, 0xf45aeb6b09aba071, 0x94cefdd22f6267fc, 0x4a2aa0e53bb02830, 0x9c9e98dc8dc90490, 0x1837abcbbe6cf88f, 0x15ab519af1cd8,
+0x41e2d0b12c4e1c8c, 0x7f16f2c6928f350f, 0xa766207c64a29534, 0x5f269039232ea5a6, 0x41d7084da965b0f0, 0x31e016f01fd0aa, 0x782167abe3da,
+0xab9367995f421ddb, 0x7d4b097624c59078, 0x8b2e23d6eb5bc284, 0xd411f7efd208d93b, 0x860e2bc3ce0d10ad, 0xf1ca161b8c99f702, 0x58b63f47e5b9,
+0x2038d87498e17ec1, 0xb7c8716d1b3c75c3, 0xe92dabbd5906683c, 0x452cef2750a14e94, 0xd676688de4b973fd, 0x6df9b08483f2372e, 0x1988c9bd27ece,
+0x6e2443e854aa1440, 0x6fdd95e880149fd3, 0x2d4eebc2358ede83, 0x6a5394d3d2faa7de, 0xc17173231a4d7ab3, 0x6d33f5ab0da0882d, 0x2226bb8a240f9,
+0xd81e324caf8ac972, 0xbf6fbbf842758836, 0xd109a7be1ca92353, 0xed5c97a93f230aea, 0xd69a9f74d4caaf97, 0x10077326179ce8d4, 0x1b501e8a9de5b,
+0xe4796f80f605abe0, 0x7d1976d9b2fcc00, 0x765f1d8f61b381b5, 0x81eb3ed43af602f2, 0xf8603045a14e03b4, 0xdbbc0f199a3bf88, 0x20f6c8ff92a2c,
+0x72a306fd608b9edf, 0xa7fa5f042876626b, 0xb93853552a739564, 0x5a1e06f618f2c97, 0x8babda47f65e9d6, 0x4336f9f7162d9066, 0x167aaece319bb,
+0x7d69190b28f1a364, 0x54d6b017a854a3c9, 0xa17291a228be4af2, 0xc0cfab77be686969, 0x107b610fe57eda27, 0xa1821836d26fa842, 0x203004e52efb1,
+0x7174f3cc29e38b38, 0x9921f8a2af6826f8, 0xf034e58343412b0a, 0xeb514cfa4123a2ca, 0x22a709e6a694f4c8, 0x3e76102f418062aa, 0x2164df25889d7,
+0x6cba21d475178611, 0xd53b79dc7e6eb935, 0x5cb1d1ceac1fc0d2, 0x9702bc24ae7ca91d, 0x6398689aa1c3394, 0x85e83f1efa84f927, 0x1fb685d0457f9,
+0xb14ec21c6158d1d8, 0xe7cd3fdb76d9e415, 0xeb46573975f94fd3, 0x8864c73600151b3a, 0x7b3398e9e729ec34, 0xa4626d37c8a33932, 0x142fc2782632a,
+0x5589893a58f65c31, 0x622295e29a19d494, 0xe9027a367346d2bd, 0x408a297743f06714, 0x9538f982ed080158, 0x673a172a0733bbfa, 0xca184fd0271b,
+0x1e7ab82c376bb14c, 0xf233f248633489f8, 0xe9bdbca1d344545e, 0x9cd051e3298c06f3, 0xa193767dac25d650, 0x3cbcb0db651dde46, 0xcf9376e9205f,
+0x46ed889f4bcb5215, 0xbc7611c709d551e2, 0xddb3600157a4310f, 0xeab42b7538233ffa, 0xcf2631e15a1eb20, 0xe1e93cb3914d97bc, 0x8772fe50d6b8,
+0xe097b3224307ff49, 0x368bc55dc6678b0b, 0xee08e4a0681e6a8e, 0xd9ada07ceba4562f, 0xb09aedafa533b1bd, 0x4d4c5ecbef18a648, 0x12c9899feaac4,
+0xec3e37e3acd41072, 0xd2a3b6027ed5b8c8, 0xb3b1c71c158037b0, 0x58687ea2a2fd347, 0x96608b9eb40874bb, 0xfcf4daf7228a9701, 0x1aa117b055356,
+0x3eac9628303f468, 0x87dc162933af0772, 0xe973912800eb3cdd, 0x51612a4a76759f50, 0xbcfdbcc05b85be9d, 0xd387463de172a965, 0xca6b49b0ccc9,
+0xa4f15dfe27b82386, 0xee0e8758e06f9d0c, 0xa1edfc2a7abc93d7, 0x78817d18c5f4a2bf, 0xece49070f90f71a, 0xe2f6bf4c6d1a4143, 0x7fb0d2e9a1a2,
+0x76ce372fb7c5b557, 0xe49fcd4746511125, 0xaff9a91ecc8c8306, 0x1df1e31358ac25c2, 0x99d83ea28f666f21, 0xbad5a0199f03f682, 0x6ad8a821c9f,
+0x2118965de011b0d1, 0x2cc9051380e17302, 0xa7a160fc2c751bc2, 0x948378e45be332d2, 0x628cbc9db084605f, 0x1cdb57287dd4ff12, 0x1ea633521058a,
+0x11ebedb0068803f3, 0x33291467f6115ae3, 0xfe2aa2d405e4e7de, 0x26ce523985ac4774, 0x232aa73e4b42e75b, 0x33e0e236eacf5ec, 0x20797984755d3,
+0x19b87c8f8a8de6fc, 0x4bfd4a0fa3e56dfc, 0x1898c34e33ad0054, 0x6dfb62948bf48fa, 0x3d4a5e8a56f252df, 0x831d2ff1755e2249, 0xd1bc72b359c3,
+0x2a36d43382b981c8, 0xa9a17b18c98e8bd2, 0x404bc3ae623bb58d, 0xf70db7004adc33bc, 0xe426252fd7cc151c, 0x74e00e0c757cc04a, 0x8bf314648655,
+0x8b1921aa44cef37b, 0xc8c1dbb4c0c3406f, 0x450fd8831be730b0, 0xa0ed9edc1eb86774, 0xbc276748d49a75ae, 0xde25ebb4ace5d0e6, 0x152a37bf6b08a,
+0xf0858b008b86bb07, 0x23cccdcd57f21808, 0xa3fc03705a4095b5, 0x820cf684ab4e99c7, 0xd25556a8055db14d, 0x7b7860027489460b, 0x12bfa33527d53,
+0x200a2704c41e1fe7, 0x15222de5549a72fd, 0x368faf0d02b6c7cb, 0x876fecd5cec85ebd, 0x63f6fcfd2b1ff20f, 0x158dc6dd2136d6e8, 0x11e2386be2877,
+0xaade52a8e13892e2, 0x7e61138228227603, 0x264e3458adc33411, 0x3b05fae83fcb09a, 0xab80ee9f27fd5bb5, 0x1be09bbbe4ba1081, 0x18791d82dd9dd,
+0x3ea9fdb0d4d66e22, 0x5362254a453a5482, 0x26314af06ce53cfe, 0xd192144ed8184dae, 0x107fc90c591d55ce, 0x5ea8ff578c8c14ef, 0x213ebbc21491f,
+0x869077e0f7234aa4, 0xe283f108fd865d08, 0xa765e9839c8ab505, 0x2f9e8c10095c1e85, 0xeeda5bb64db4d0f, 0xd9e44b349e4c3d4e, 0x2554e4f704ae,
+0x82f21b6011b10bc5, 0xe25b74b50e053399, 0x3f8cbd8b6e8b1da, 0xb74ed463396cc425, 0x8e911e9c36c5acd9, 0x362792df100cddf2, 0x2e0886024a04,
+0x7349deeb5e1ea86d, 0x8c86e2e1ca7f9bd9, 0x6fbfd2a5eb0592cb, 0x16c86819b836a2c5, 0xe59d9b1a956e9b5, 0x2a510f5464a856d6, 0xdb27c84dac0c,
+0xd43e686f90fd4ce, 0x3cb1eba302c5086e, 0x760792ecdff07b90, 0xb7c6e9b39aa273a7, 0xc8ccbfb664e9fb01, 0x435ff25d251dfc1e, 0x1ecf246c67fd7,
+0xdef60b3e432795e1, 0x6992f05a1209f417, 0x62c88e74c26b35bf, 0x9b28f6cdecef9bce, 0x6c5123cb30b9b0e1, 0x162262a686a8b003, 0xe66224ac0931,
+0x832903a6e4dc9b0b, 0xabaf4dfa48a0cf42, 0x41f150845ab8f631, 0xe6e5aac3808f5e63, 0x2c34546a20c245a8, 0x44393dc23cbb78a, 0x16b4c529cd213,
+0xdf7245e44ea57983, 0x50b98ec701337ded, 0x40cf9788265b7010, 0x2672ca2b0109f7e6, 0x4e1ab636a60bc9ec, 0xc77815b57d80b114, 0x1cce6432ee9a6,
+0x4ce4870c4ca51c48, 0x56a49e3fa41fc466, 0xfe3a1904cc751c9a, 0xdb4951bef9fab4ff, 0x7f7554014ff4d0dd, 0xb35b971680bfb1fb, 0x18fd5ade02d1,
+0xd09752e77b4fe342, 0xfa52e4ed84509660, 0x801ec63f1d9b9cf, 0x8d7a69ede099df3, 0x29ea727f02ad25c4, 0x1449895b0887eb7a, 0x1376c3ae69bfd,
+0xc6cc58320fdc7a5a, 0x635eac32b89122b7, 0xc4095689c956ed82, 0x9e6833ede5f45318, 0xe2f9aa68a3481ae, 0xc56b49ff3a309799, 0x870d1575566d,
+0x653706fe510ea72b, 0xc88815b15db14652, 0x6f2908debf116fb7, 0x81f3eff6247d1d51, 0x138f480f21f4047f, 0xe48af39805c249fd, 0x6a74a150dc52,
+0x59bf058819e0732f, 0x7858a076b756c4bc, 0x1f99545540342f62, 0x43b3410fea4a830b, 0x9d7fa7ae1684fa95, 0x5f3fc9e1afb8455f, 0x109bee56bbd5,
+0x75601f399ebc8a5d, 0x297a9f3954e41f9c, 0x17ac4488938b01a4, 0xf9ebb9deb34078c0, 0x613ac232b008e1c6, 0x7cd696d3df07c7b, 0x1bbed60111620,
+0x56a0714e4ed8c6b2, 0xd3afef463348a94c, 0x881e2b725f94b492, 0x430207a0fd5a6f52, 0x80382130e537e403, 0x2c4578b449b397ca, 0x1cea13fbd39a0,
+0xa42846457d00a03, 0x80484859ee459e4e, 0x1473130f358d363f, 0x616ba9d4ba2bd205, 0xcab29f2d41963537, 0x7d5394e4ad8783ac, 0x1f11046dddce3,
+0x8245dc80d1195d6, 0xb59915aaaf2bc93b, 0x87eaddcb74771943, 0xca3e64ec67174671, 0xba1fb9fdb9de281d, 0x9ed1f7b68b10994f, 0x9189b867b66,
+0xc074ea9ab42f2aa6, 0x761d443e3cb7c4a9, 0x4f5ba1dffecf44b5, 0xfed802e9e20432e6, 0x2ae769ff2600749, 0x446525a89abfb9eb, 0x2191dccc5ac64,
+0x8d8180a1011e7061, 0xd52278b7bfdade5e, 0x1bdec455ac027601, 0x49f197668618c58a, 0x1300c9b2cba9a3f2, 0x272aaf7735782c87, 0x1cb0d7d92d3f,
+0x460e9d730b068d17, 0x4ba010f3e9820298, 0x3bc322fd59350668, 0x6cd55ce21198e650, 0xf7ad48d35c312780, 0xf77debf1fe34b332, 0x1d4366ed912cb,
+0xb1abfc24aa8d2572, 0xe89485c4ed19bf8e, 0xfbaf9b8aecbbd707, 0xe870b42e3b39cf1e, 0xa62286cce4854022, 0xb51e57dafc833a14, 0x877c8b02ebb6,
+0xaae84090cb20a77c, 0x44e392887299b84f, 0xc01b7744702063e1, 0xd557ddcad4a08486, 0x7db88f0d85106ba, 0xc89bfcce40b2b3e6, 0x135ba7de3bc8e,
+0xb840ede508aecd9d, 0x17feee7ae87f29dc, 0x2e2d0e3ce87129e4, 0x4a0c395ac608580c, 0x401ff498b53ebeb0, 0xc451bae153206d77, 0xab6bd27ccdf7,
+0x182f97d55a72dd7, 0x9f65a287e3c87e9, 0x7f7a8e5c6de3ee73, 0xa99df81a5cee20b6, 0xf2ca04293c86d682, 0x8620b1fa93b01070, 0x64528b1fdb67,
+0xe44d644c604e767, 0xa491f8a024302932, 0x4967cdd73a818e7b, 0x589f5116ffaec776, 0x9601c350935b41a6, 0x8347f5bc26662156, 0x9a20baa147bb,
+0x7ab263cd4288bfe6, 0xb892ba3b92f915c2, 0xf61035416b348655, 0x5ec8fff8ba39a798, 0x315ec5afb6312684, 0x2703a6c63c552af3, 0xcaed26109b85,
+0xb49affd73fa05dbe, 0x3ce7b7cfda82966e, 0xffa6effb14922195, 0xe1a5913fe7759380, 0xe2e0c2565dafda56, 0x7fbcb2a541cbac75, 0xf2d45d2bfe20,
+0xa9778bb761c46163, 0xe482117da91dac9e, 0x3634c57565905e8f, 0x9715623689b9bd7d, 0x33416deb3f0301bc, 0xc327e4820c8bdb14, 0x20b69c5a303ad,
+0xe422b67fe62d7d12, 0xd5b416b519c85404, 0xbda24d7804703996, 0x93cdf201b5f7a709, 0x27e6884eaa9454dc, 0xa6b14cb5a31248c3, 0x11c0b3cdc844a,
+0x76a2a19cbe26656b, 0x93fd05fb78cb1a00, 0x2f5f9f419a882fb6, 0xd9e6c6a90b7e6a9a, 0x53a43bd051b7632d, 0x4f967345428be4b9, 0x5a648fa5683a,
+0xd27c506d4b86286a, 0x66c3dcb7d7247e8c, 0xd014a2ce0f9b58e2, 0x8e1b25768a236505, 0x3e6644b9e790fbc0, 0x54b5c52d4a0cf04, 0x161436ac36556,
+0xb72e7cf1e1e898c, 0x8cb9ae9da4283fa, 0x1158ff220017af6c, 0xe4cb98c36113dded, 0xb39b9e5fab7aa796, 0xd7df4a9912a0604a, 0xc616931c4,
+0x4a063fdb4bb19a97, 0x98da4f0b0b64bd4a, 0xaacae5d47de5ac78, 0xa6c2c1f4ed620a8c, 0x13a7384388ac0bce, 0x586f0964347dae6f, 0x1be9d5d2ed904,
+0x87462c46eb22017b, 0x3b52d2b445d7036, 0x8834c01c240a58c0, 0x46c39ce096ee58eb, 0x9d9290212c2712b, 0x31792180768178b3, 0x1f822a5134ae5,
+0x6410da2dbb9b221a, 0x548d26f7d7bb8603, 0x60bb74ea9c87f25f, 0xa775e455c31a6167, 0x23b6c52b1b89b75e, 0x7aa632356bc2a3c2, 0x897970262bbd,
+0x235c179791b5f488, 0xcd6136a38652dfdd, 0xf44c10b4ef1a7080, 0x9d67b6bfacd93715, 0x8d44f0e5200483e3, 0x84918a97b658bf79, 0x12b6fe3390f94,
+0x11b64845a02a3f91, 0x2cc11342d33429c0, 0x75dd14c998717986, 0x64b2087fb889094f, 0x34b389efd310c29b, 0x784dbf1ed6c9d7da, 0x46d2c057a68f,
+0xc729441a45111e13, 0xb92c7cd026191fe9, 0x9dbe2d52c3857e0b, 0x62833dbbc6c3f3ef, 0x449c07fdf506d44e, 0x40384c8d3fb476b5, 0xec81d016fee0,
+0x2f555399624cb981, 0xcccd473cad3ae737, 0xd65b5de03efe345b, 0xe2257578ad36a581, 0x1dd964b023d7414e, 0x4539aa483ed43764, 0x1beaddb121cb0,
+0x52b774aed02dcb7d, 0xe78eb553ffc2fde7, 0x8910a9a1bfb5bf71, 0xe8c1b11f43c772a, 0x3d994289acd45d82, 0xb287f8a1debe19f1, 0x15a62e9ce2183,
+0x3a68868f7a88af16, 0x475dcbbae126e335, 0xac9c75eec4f70588, 0x5eba068c9c941d3f, 0x67702c678bdd09cb, 0xa42980f09f490d33, 0x2138c136c270b,
+0x98c5f76e7ef0af5e, 0xfa4287ba81d12fcf, 0xabf138692ec8d1c6, 0xdf9c2738446bbab6, 0x82765f4db7a69bd0, 0x3571d79c2ebf242c, 0x19ca439ee4957,
+0x734de66e6477cf24, 0x99f5deadd4043c7, 0xd3a5d0941a37ac96, 0x894cec91f9718ea1, 0x66fad4c3011558ac, 0x26e8c1e39248ea29, 0x21a4cbf91bee6,
+0xfa89cee96b07b2e9, 0xce26f56509e4b571, 0xc4432c467abf349c, 0x889b9c93d6e84089, 0xddad14cc626cefcb, 0x7c290f6c64550692, 0x21d24b9da2c80,
+0x13df122ae2a990a, 0xa95f9ccb478c281c, 0x1bdc63c687544a3b, 0x20bb97176ca146b3, 0x9d08f2840812bc13, 0xc5eaef1d5ced666f, 0x13b1dcfbb84ad,
+0xd4d1983497bbbe47, 0xff849924053a7ed9, 0x3ec87068edcd6a20, 0xdd9a861fed162adb, 0x7d7ce29791f6bfe8, 0x141a8dd294a58a97, 0x22fdc32bfc8d6,
+0x9609b03308fc3bd, 0x64114ecb7c359096, 0x3132b38c69765ca1, 0x5873938bfae9a430, 0x5c5fecdafb95e9ae, 0x8119e701cfb5668b, 0xdc2dff9a382f,
+0xdd89e18c72babae1, 0x6d8cba7ac17b278f, 0xbcbd959c95d9b411, 0xc5d51986c1764427, 0x87e17f5268c16eb6, 0xf36c8b13c244326a, 0xd301ef3bbd0d,
+0x22f2ab11b5aa191b, 0xc392016dc4360473, 0xcef1e4046d733e81, 0x2e1698fb5422f76f, 0x38bb687723cc2452, 0xe035bd37f01e2d93, 0x64f1301226d4,
+0xbf2b8392c0bcf449, 0x124be29bf790101e, 0x5dfe6df491771bdb, 0x46198c6a4facb131, 0x331790e7180e9fc9, 0x3939bc96c1a96d8a, 0x7d3a02651c6f,
+0xd265d436b56243, 0xa1a3a751695a4450, 0xeebcfb4f086220e1, 0x9ade177df8144cdd, 0xae60bd6a520a4793, 0xe8cc81cf14c79c47, 0x6a04f07b1409,
+0xcf925e4c0146b0c, 0xab9044478eecc9a, 0xeb820d6d13ff7567, 0x7eea97a86c22aec1, 0x8953b9edb657d603, 0xe9cd4599cac49020, 0xd777d81a4950,
+0xf25d2e2cb368394, 0xaf4d06bbb84718ee, 0x26b005598098d919, 0xd2cfad4fe59e46a4, 0xb60b9a2a0d7e2fd4, 0xac3aa08fb5a4cef0, 0x1e0fa65fb7637,
+0xe35e224d2b55f070, 0xdc8e289c4c509bba, 0xf9c627bb94b2956e, 0x8232d24332bb1ae4, 0xf9b67831910369b0, 0xbf6fc4668a0ef313, 0x1c2e25673964b,
+0x3608283bf418aa96, 0x15687a7e11b49ee3, 0x557876b6bbd199dc, 0x6de348a8f1fd23ae, 0xc3b0773e8f436ff5, 0xfd7ae463937d7d48, 0xdbac74ccd454,
+0x3aae6b4acbe8213d, 0x22104a7ea062767e, 0xa5871de3f0caf603, 0xa26257cebbed9dab, 0x736d6eff197dac7d, 0x1f0b3eb08d60a6f3, 0x21f17e50fbd83,
+0x96b5331d0a84dd95, 0x66e7a8f0b882693, 0x5f63486de27d8985, 0x2a8f30f826fb7c1d, 0x241333f5a93e2281, 0x46229874316b5a8, 0xbb3e52c4bc5d,
+0x810f375009fc700e, 0x9b8dbe0af9603c5a, 0x6aee437c4b8c962e, 0x195cbd24981928f9, 0x150e1ef9e976bfe4, 0x133aeb51813e4e03, 0x7477f8944201,
+0x4e5ad6132691e5c, 0xf83b96995dd2c140, 0xd3b84e5d59b7cafc, 0x9e6978cb6c89ccc4, 0xec763e68c80c04b2, 0x2c8bc502ba77abb2, 0x19fd735d80a41,
+0xf5b4a14415e8abc9, 0x640767af15a2de7c, 0x96010e4605c0411, 0xd36c86ab049dab55, 0x63b9ba6f4c070623, 0x8f28d0ad00841e84, 0x2d123b780590,
+0xe5e3d03f1174b0fa, 0x9c4056564965f4a4, 0x8ef475b10c31d4c9, 0x4dee2ca7c6bedf6f, 0x9dbb65cc0c7463d8, 0x59b9304bf0cb89e1, 0xbb0f36f033d2,
+0xc81b45dde4c07df5, 0xfd2c944a582ad150, 0xca66a9a974df0f84, 0xffe66a8ba6b6339c, 0xcbf71ca08956c21c, 0x747c54f2f8db7e, 0xc131e5bb6feb,
+0x18d579fb1b6057b8, 0x7adc6aa595e5a164, 0x4aa5b871f83836a5, 0x643707526641c862, 0x37941524beac552a, 0xc3a710c18c93d086, 0x8d5310126cf7,
+0xe2a6febc2247e2ea, 0x48dec306369cb7b4, 0x320f59ff9cdb5e22, 0x32b40321fbaaf90d, 0x12ca271bdb151dc7, 0x8395c9995c95d079, 0xe1f24ed71801,
+0xf9cf35b7250f3e0e, 0x50a91ff63a1c20fa, 0xa168b6897fa00a26, 0xe5c9c3523e0fd13b, 0x356155502f4d008e, 0x28ea72fe5730db50, 0x10dc7bd784946,
+0x523e6209b5ccd7e8, 0x28a29e47e5ff348f, 0x7b36540b216adc79, 0xe66f61bf561a440d, 0x981be0d4e33fc0c9, 0xc22673fc20abc1ba, 0xe4d07d1352ee,
+0x69895b7de29aa34c, 0x7030b094a00ab563, 0xe99efb6a186b11e1, 0xc8dd2ba30f41ea3e, 0x948446864582c38c, 0x94f7729868675cd3, 0x8652cefee8da,
+0x8d05279db447bdbe, 0x13befab6f39a4828, 0x32e1abb63b4bbc6a, 0xa076fd67c0602429, 0xcf327e44163ca23b, 0x7cff4dde712e1d5d, 0xaee1f3564a06,
+0x7a491339526877a, 0x7fb57838b151e949, 0xdf462cab09e31392, 0x4386517016ea871e, 0x1f61d2979287fdc, 0xcc727f5d35ffb511, 0x1acf7708982aa,
+0x58c3b6690663ad54, 0x55d8f533da8d2f82, 0x34a68fb55b1895b7, 0xcf48ad04705c27cd, 0xac28876fd62fe915, 0x24605d4ca2a18391, 0x1e6276123f3b7,
+0x4a8aba2627a2943a, 0x3924a0821797cec, 0x7c214e83c92e362a, 0x9a24bcd34c3d9b2c, 0xefc21dc703c499af, 0xdfd9ffb7c9f5a449, 0xc207a6457682,
+0xd01c757795a3ffe2, 0xad3f770c2d7a8a03, 0xcf1f6032bb0a140c, 0x227d6176aa8f781, 0xb7a9eb5fe5307806, 0xb839e87a1ac333b6, 0x1799a59ebce21,
+0x5219ebd430d322c2, 0xa164850ac4a4037f, 0xad51f8796df5481d, 0xbc5596ae4de30100, 0x8a17f0da7b222e85, 0xe0bc594687f1f5a7, 0x1f4fb2ce1ccd5,
+0x9694d454375b721a, 0x7d1d28bcf9b71d20, 0x40b31a79cf3118cd, 0xbcb7a2084a07d387, 0xcf816afcbed03a38, 0x1e616b1d331883db, 0x1ed4573b2d201,
+0xec2f046c571ee2a2, 0xb7ffbad902ca404a, 0xff6b9bf91a6afd84, 0x96d6c36b397442e0, 0xfb9e2d4e1495d2e, 0x9b71491d86fdc080, 0xdeac7bbb8a93,
+0xe7598c78a1c5a331, 0xaa5b968f40778798, 0x5fe1c68a0b81261a, 0xa9d1ccc460af94c8, 0xf125d4f96684bfc9, 0xbf52e25f37f0c74d, 0xd861676c582c,
+0xe61d29fe6f0a2da6, 0x59142368f3560ba7, 0xbaee6ab16c3dfa5c, 0x4baf3f20b656cb72, 0x82ccb9db313608bf, 0x558166d30c35d8cc, 0xf5a5e5c40286,
+0xe31d1ceee33c6d2c, 0xc415f054e02efec3, 0xf901f98dd4f96442, 0x8a815e3a8b353372, 0x5f7dfd0473f3dc47, 0xe8a9071ea02fefc0, 0x1c47b2bdeb5b,
+0x9e52b0206046e98a, 0x73f174bef3420634, 0x2e0c596421d3840e, 0xaad5431858245327, 0xa0d381679ab65347, 0xc4cd02fe551073cd, 0x17376f8bbfc3c,
+0x18bed354b76fa0ef, 0xbac6ddb951358c4d, 0x55f1ef1c21adac69, 0x4b67b1e5e86b38f0, 0xbd73613525c45ba0, 0x16cd7c2858583ac6, 0x707524297f3,
+0xf2e6ded861d3a555, 0x47beb9f052b6b38a, 0x5f938faa3f61df86, 0xfac85ee06d575c9f, 0xa3843e5892a815e4, 0x614e17e0af379dc7, 0x84d14304900e,
+0xac68ab9a62e6c61a, 0x8332a6c80537b18d, 0xaa6ecab2817592ae, 0x170f36680095e72a, 0x83cc1c7601bc3c4a, 0x5536a29c4bd313f7, 0x18e3dd0980897,
+0xf7b17b537eb36e2, 0xf0c1887bfaa393a, 0xe970e8f9a9497e04, 0xaab10b70ea65997b, 0x4f2b6124520f0ec3, 0x54cc24755c456297, 0xf5b39d99040f,
+0xb594b93e0972be5f, 0x8d29789ce42abd19, 0xe8185cda3d8a3661, 0x25e5e354877bc9f9, 0xf9c50501813ba453, 0xe0e276bc7eda0830, 0x15fb03279f3d9,
+0xfe88c63affad24ae, 0x96199f8df9beea43, 0x6ecd3a2974c52c81, 0x5de49e4a6cfc26ec, 0x432083f793534fc6, 0x9ecdc3f27fbc88e3, 0x187387ae105f5,
+0x7e97b16cb565a13a, 0x60675a4372ed5b19, 0x9ed83ca3f2a61ef9, 0xbc59a9e050dca340, 0x7613646091b6976a, 0x2a63259d9c4ba1b8, 0xa0f027cd989b,
+0x868ae04bb0984c6d, 0x2423fbe3103924cb, 0x725ba0c6f8cba6dd, 0x8550a728211b463c, 0x2ec0f2ebb35cc5c4, 0x296ae19f2b7f7306, 0x1d0d1b4744852,
+0xb424bccb4f166f24, 0x2d3e6b36c6115ede, 0x5f0f4f8a69f3b242, 0x4bdf1b8ef2261cb3, 0xa6727c2a22e96120, 0xf14c2366fcd65208, 0x5e5428c3d801,
+0xee8a096498bc16ad, 0x32071862c4b74a6b, 0x60bf82023d241c10, 0x5a5ed4ae527a2802, 0x1b001d21b6ba763d, 0x4beaf57e1ef8215c, 0x268ff0c36cdb,
+0x6a30bb421af7d7a3, 0x45112c494c1b5f67, 0xda37d748d46f8234, 0xd2e1d8df53f12af4, 0xfb941e460bc61717, 0x6fd1f921216faf3c, 0x1b11f788d1ebb,
+0x9da0f129c3bfaf92, 0xbd0b9549ee22e44b, 0xf6215af6e03bc8c7, 0x9dd3813bfdeb41d0, 0xa66e6e69680a3053, 0x55c7879091331b1d, 0x86ca73b93610,
+0xa2cff24291cf4b33, 0x690caacc4f4a95a7, 0x7bdda092fad4af22, 0x6cbf7c4909fef4fe, 0xb83f3ae3b36cacc4, 0x80c17f9076c1a194, 0x1484c69c7a5f7,
+0x1c3345efd1aade90, 0xb64b2bdf377ce287, 0xd3764200198e1bfe, 0x73c8957ea8a90be8, 0xf7aacbe07971caeb, 0xfabfeda62366de6e, 0x6644e6d442a5,
+0x7aa03effa01d3690, 0x9a70e3d2a1b5c448, 0xc2144efffb5400bc, 0x2dcfc55e93dc8f91, 0x80c1963ab8d4ad7a, 0xf254fee564ce2a2d, 0x1e5b31e6fcc55,
+0x5f8eb5932b99bd79, 0x3606726c94914db2, 0x46d334b67971bf96, 0x3373e18ce1c18c3a, 0x985b5d510ee571fa, 0xbf01e135a26ddfe2, 0x5241d8443a9c,
+0xe6b712a663a0906e, 0xe61fba5a0cba97f, 0x584c5726a575ef4b, 0x86964333754a7001, 0xda8090d473c6778f, 0x1ce4bb359094fe59, 0x81d054442ad6,
+0x8f3568309751fc63, 0x787b6bf345579938, 0xc4ff4960a32b45f6, 0x68a335be2be5b434, 0x3317a6b02f5071b, 0xaa2e1b4e10490d2f, 0x1de637a09984a,
+0x5378ed080053ba98, 0xb210eaee2e0fe39b, 0x814ed4e2297e188c, 0x94dd1871d7317054, 0x281ef3639a99bdc7, 0x36dd4f863f435fd1, 0x121bd209baa04,
+0xf544dfae2dff46c4, 0x9e958ee6a57fd52, 0xfae7b78dc2957595, 0xc38c6666b9ef1040, 0xae5143b368936879, 0x53398fddce1a39a0, 0x1b125b0be11fc,
+0x4b63c3b2fc21e084, 0x93448e7547d6c315, 0xccfe9db801a2a2ef, 0x4fe33f0428e312e0, 0x6d0dd56b600f3e87, 0x937869a72d144cce, 0x7fb0c0553b51,
+0x24f524f595a6b780, 0x93d9554f0daa358d, 0x3d5579415b4ce28f, 0x1d20dac5998772dc, 0x8d40ccb66659c6dc, 0xa1c6a85978e8bb77, 0x14f9cb4ed3a2c,
+0x893a0f61cf4a892e, 0x5fb6daba16d7ddaf, 0x70b66104fe2ca992, 0xe780a9cc7feefd29, 0xd852699dc91d51ba, 0xc548725e436025f9, 0x12abd2db74147,
+0x8f206442acc65dc2, 0x5c2a93d7830161e9, 0xb5e6c8b5dfa5d38c, 0xdeaf59328c7f9262, 0xc387feddc67e6421, 0x786d13fc08b6a438, 0x7d5d0ab71cf3,
+0xd63cf040bbed6352, 0xe92860b2933a7c4e, 0xeaa10f843f7fc14e, 0x8f086da1bad257b3, 0x78a1a3eeeb0bb33d, 0xf9aad7b52cb20039, 0x15c2a0e21bdb,
+0xf8f757394e4c815c, 0xcd62a9a1678d1fe3, 0xd780ed51524e7c60, 0x37afc561b309fb6a, 0x24cf71bf7fbf8e4, 0x72b8990f66c1e827, 0x1ad2285bb7ca7,
+0xe7179c1a0c1c99f8, 0xf9227dbe65240b84, 0x317053ab1d09fe93, 0xf086188e22235c8f, 0xddbfb706fe3b1cd6, 0x558d26e8de831c5f, 0x1fce2e92b652c,
+0xc88b415d17c7a463, 0xcea565a9950fda99, 0xe6c678c6d8727816, 0x530a65ae8c0a0d9f, 0xe0ab6896a63477ab, 0xf47473361ac66d5a, 0x11e55948938df,
+0x40df82f3e89a6bf9, 0xfc8e9b64ec8f061f, 0xd3078da5baeed138, 0xb542af9d93efc7fd, 0xf69ddf0f1c26515f, 0x74c21d4572c1837f, 0x73933dfc108b,
+0x4bcde86963eb4fe9, 0xe54337f7c2233340, 0xdc47eccc420a6c, 0x236fcd095a88fb6, 0x1f04e4dc3beabe63, 0xee9a71174010c8fd, 0x66a12afedf6f,
+0xca4ffc9c9dc961cb, 0x1baa414a11612165, 0x79ced8841fe4595a, 0x2a65f5df9272f096, 0x3f3ad645653acfa4, 0x8b0eb1878c63feb8, 0x13c8b6ab90335,
+0x2bfe90332578d002, 0x71e5e0fb8bb5518f, 0x1c9e1a3401e72620, 0x2c480384da3d998d, 0xadc0ea203201c949, 0xff5bb48f61602d88, 0x1238445d55dc2,
+0x6a8284deba1a261a, 0x790287fbba25d4ce, 0xf7e478173dab91cd, 0xa3ae112cfa930901, 0xab6e109500f4d421, 0x7a165b28d8bed035, 0x78b752981228,
+0xafe65792e1f417cc, 0xd539abc59bb2bbf2, 0xdc84626b3cac4bbb, 0x881b91b8605380e4, 0xfc22382df58e582c, 0x8ed5ad281ce2047a, 0x1a89b65201816,
+0xf9b827b242eb09d1, 0xb345c173a40d27dd, 0x93d5645020621f3d, 0xb73a040a02484c20, 0xdf75e9f982ceab36, 0x26b7aed3cb53d4c6, 0x163643eefb42c,
+0x7e2e4ce24368b711, 0xc5452ca62aa2d5cc, 0xdb36518e48e73a09, 0x30e069e65cd994c3, 0xc907422ac3fffdaa, 0xad32c4d3caf63680, 0x34a8be03593d,
+0x35e5d4c21e8976a8, 0x9ab0b7db0db9e519, 0x2d753ec52b812399, 0x2d8933618cb61190, 0xf2dd19d7b46c004c, 0x7fa633b7a478c400, 0x133afbe412eb3,
+0xfb49588fe30d55f1, 0xc8ce034f2ee3a354, 0x9b36870f40aed235, 0xa61a3012dbf5fd10, 0xe5f630da263a8b2e, 0x507baba57da5c1d5, 0x1f5c5f0986e52,
+0xd50f315fd200b4c5, 0x2a41dd4187d0bfdb, 0x330f359df20c9d5f, 0x5a657ef5cfb5caa2, 0xbe52f6084d68c44e, 0x48840aacafa7a130, 0xa3b6ffc654a4,
+0xac31d26161a7c36a, 0x2479195854851a8b, 0x27a6912fc9eb88b7, 0x94005b94a505991c, 0xa1a7049a87868d1c, 0x5420f7547486a1b3, 0x1507a1e670ffe,
+0x7a4702ce82384aee, 0x680523cad4a647f9, 0x8d3f3c4a33255669, 0x2f64492f0a28f018, 0x289a8593111e3d86, 0xf0d6b98e0dd793b3, 0xec7c3b7dd412,
+0x13900b82a736728c, 0xfac88fb9224cee32, 0x46213e43f0c1ae21, 0x7e0b61ae570b3e66, 0x7eac96c2f2e09306, 0x612acd624aa875a2, 0x2228b89c33c66,
+0xadab4ba2cfc2489a, 0x70da6400f74e5f83, 0xb9aae7bef5f50209, 0x2a1a98de36fd1638, 0xca1bd751f603f419, 0x7e6741714fc2c407, 0x1b2354d7033e5,
+0xd2b5042d01d91f69, 0x461488be22a988c7, 0x187fe437d575cfec, 0x7a3aea12ba5dee75, 0x80fdbd87fbac0467, 0xd5e685388a5b312a, 0x19bcfb47181cd,
+0xfdeaef9cf6549d0, 0xc815f77c16ed8a67, 0xbf272b158f894bf4, 0xe1a619666c406a49, 0xed8acb61731f5960, 0x1f7c42b142f2bec5, 0x1e839eef45699,
+0x15d450aa5b736325, 0xee08f9e72298fa85, 0xe58e23d2e664b54c, 0x5f61ac90a176b513, 0x268dfa81dddadb81, 0xd4e262614c02ea4c, 0x5757371dc8f4,
+0xfe4a216d1541f5ca, 0xaca136d7682114bf, 0x91dc56c53a2200fa, 0xf6a03f1bd714b4da, 0xd43376525da59f8e, 0x6884ccb0bbd59424, 0x46efd2dc8c94,
+0x74c7ca78df39afe8, 0x3274128999825128, 0x59158467a5c684a2, 0x9642d7b8dc03d152, 0x92018d512cfb14e4, 0xe302e795c8c8a67f, 0x2325ff9df7230,
+0x9d1027e7207a3f9f, 0x19ab6cf9f932af51, 0xea77a494e74daf61, 0x57681f5a1e1a3b53, 0x5774715b7b544959, 0x7501ea5041765904, 0x166531ecdb9d3,
+0xa781fe16f41dd0d4, 0xed17ec7f73ea6896, 0xee3f77f95c9b51ff, 0xa8789caac626ddf, 0x2f976995dc721375, 0x471f0abd6ff0f81, 0x12079bf73d5b8,
+0x15952777e3a0fd1b, 0xc90b6e86e825be31, 0x3d9069bf96fa27e1, 0xf75a1223015f4e5d, 0x41cf777540f6e97, 0x4f16ee2b236ec464, 0x1bd8d33ffb98d,
+0x8cc1b01444ee9877, 0x361380649dc72830, 0x68c8ffe65ad9e6c, 0x5a5d682970f360fc, 0x1d9ab7d074c9b7a9, 0x8201413fd0dd8174, 0x15d5ab0886850,
+0xf5b0674de0a84e95, 0x33df9fd00ed40a5b, 0x6c09562763bc4a01, 0x7f4270d85378f192, 0xd37e05519e6a1f01, 0xea560644a8b657aa, 0x16c060a496496,
+0xb5ff520a6abd9414, 0x1b3e745031c6ae9b, 0x274ca0aa3e9c38ad, 0x48bc5c962649f5e3, 0xaec88b5cd56192eb, 0x51940f85d15325a9, 0xe554b1ee363b,
+0xb7e6b40e865d85b0, 0xfa17e5ffbc2126ef, 0x26a311f3bdf8e832, 0x8922183f9f9a5f0c, 0x5c456dc7fc694b26, 0x7babcf9a3eaaffdd, 0x366085e55be3,
+0x8a65fb041e9cc8d, 0x3303091ec9a4e095, 0xe91d84e683645e59, 0xbb17b6e591e56620, 0x457c1a9227838401, 0x8eba576a99d35c58, 0xe84efbd38ca,
+0x898a314ca0c0eb46, 0x617278377b6ca37c, 0x94726f5dafd8bc4c, 0x17a7c3ff250e70a2, 0xbaa1827f298a2db8, 0xbddf7da4bdea6d00, 0x1d6454191daac,
+0x46e281caeaf5b85e, 0xae5780d6106f8f9d, 0xfdc33ff6681c230b, 0xd418b0c60a659d4f, 0x8f07a59f3a6ece8b, 0x8630ef00bfc6d0f2, 0xbb1e2e9b7388,
+0xb3b633add68d4cd, 0xa8de0b7b085c9d7f, 0x13d57ca6e5de27ab, 0x552ae24ef58c9817, 0x7bdc5067844c9029, 0x2385fcbf6d95c87, 0x1219bcff26ac8,
+0x87001285e4983610, 0x7c59e72b92520797, 0x9bd1737d423bc535, 0x6f5ef11fbc551616, 0x8148cb26ce25dcb5, 0x1fd7956d9e478f89, 0x9724fffc08b5,
+0xa073f1b8bae8eeaf, 0x20ba29771e32bcf5, 0x5d0c62c926a5ac2f, 0x767ba5c1f6cf94fa, 0x62b3412d3faa1034, 0xcc3ea7a74fc426f6, 0xe0298af943e8,
+0xd0592601d312bc2, 0x444c2ddf4e845741, 0xfd4841b36d717a9e, 0xb3ee1521b383f3bb, 0xb723fb889d0d1525, 0x3f5bb8750eb3085b, 0x1a1f55da5e0f7,
+0xa8fb80eea8bbe3bf, 0x1338fea047a8718b, 0xb5c6194eb4c17d8f, 0xb65c78df602ad232, 0xacd9a27f84ad26d4, 0x3fec93e6e171e2f3, 0x18ed92f7f7f9a,
+0xd70953031a90cd5a, 0xa630abde5d8b7625, 0x3b1f4e5afb562389, 0xc60fbbad7b07bcb9, 0x9fcf2dfe7c68cdf4, 0xd021a5d7bd801ba7, 0x230f921c5e02e,
+0x6e66fcdb49024cb7, 0x99122c0e8bd4ec2f, 0x939e2b036654c69e, 0xcddd601778b6f05b, 0x20fa3103004fe194, 0x3d3ad8fdce1652e1, 0x199971af6db84,
+0xfdb0839a0ca20275, 0x39fcf9ea558be669, 0xcd944d66ca8d21ff, 0xd1ea4f28f33a6f01, 0x13cb9b100783c703, 0x94c2e047ef3120bc, 0x23b7092ee038,
+0xead8c46fe744998c, 0xf02a0600f69b4765, 0x71687738cdae078c, 0x28fb23346459423b, 0x99189f564c779b8f, 0x4d7dc024ce775af9, 0xaf1ec0d5f5b4,
+0x9a78b57a4489ff65, 0x2c601a9ed24a23fb, 0x4d4de0bbc50ac3c5, 0x35b8225f1c47dd14, 0x26e5e464086e51f, 0xe52f8884e6ebd37, 0x1610a90ea4dd0,
+0xdcf27e68b9d6b106, 0x81a710bab9c100ec, 0x4219f6ac2bec4ed3, 0x9218762f314a9b7c, 0x941384bde5857ff7, 0x9162d0085d9dc506, 0x60ec32d026c8,
+0xead3874558d4a6ab, 0x1b8da6255fd4209, 0xe257961a7ab1ef5a, 0xf444078365722a74, 0xf0096bb7e57b1101, 0x894ddcab56179ca0, 0x68e44bb3f81,
+0xf6506f6c6bbb785f, 0xe321aade1cde9464, 0xfa0ba97b6872102c, 0xf4e56f30b124903a, 0x59e5a48e1f8fa066, 0x81bee2e5a6b04e0c, 0xfb8f285a1be9,
+0x692bd2c56253157c, 0x664c17dd387e348a, 0xb71bcb6e4526929e, 0x8d2ac10bc976751, 0x762da15ea12e0580, 0x219d2d6dce0e4c10, 0x1a7fe5ac654c3,
+0xcbe720d4b4dfbf9d, 0x579076bad1a16667, 0xf9bbd0fad6c8375d, 0x4213d2a9f5387e0, 0x206597a04fc425d8, 0xdd2a0f724442f345, 0x45b0a98506bd,
+0x613aa43a0fe7f764, 0xb8534e11ad8dcfd1, 0x225bb8e0f6791e9c, 0x28c56046cb11803b, 0xd04cb0ed55c57a6e, 0xfe67c7222076cc59, 0x14d85ce88e77c,
+0x24aae59b55f9f7d4, 0x2848a80daf1e4d13, 0x66104698109b69e6, 0xdf26729c33989747, 0x2cd37bcb86b8d8d9, 0x843ea36ea39869ad, 0x1c6d1ce51fa7c,
+0xa3b211fa67163999, 0x7d77a5335dcbc5bd, 0xdb2085b9e4006852, 0xeab67b04015d7d27, 0x854f8a7aec478437, 0xa63015c769804770, 0x1a0530394ffab,
+0x7d612a9a1bb0baa6, 0x87a8d9e16a0d4f02, 0x5839fe4981f07390, 0x65352d044d9863d0, 0x8bd9dcff2ba2508b, 0xc3ca943fa78e0304, 0xd88b9dbc9099,
+0x37415beeffc7dfff, 0xc4de4fea82b2a5bb, 0xaea0cd228a4468e2, 0x6219da87cc5e9479, 0x91d62db005073678, 0x2c5969f20c13de30, 0xebc4b76eb7b2,
+0x3144a8745ad987b9, 0x2122f59b9d413c92, 0xf27187c34532384c, 0x8589631e3514cde6, 0xe738bbc7b536250f, 0x4ff0c44474372334, 0x1c680c09c3a45,
+0xdce359c9731e0ac0, 0x7b0f26637de5c590, 0x69ea1b9d96f0fa12, 0x871d1aed777e22a4, 0x9c1d80788d26eff2, 0x6c379ef818b17780, 0xe10f5398f2ce,
+0x3d7d57f6fd8298, 0xcd1300af131269c9, 0x12501401bdca6254, 0x632ad587322f0d8e, 0x6e246cd79d2c8f7d, 0x38ce5d1155198af6, 0xfb335891d1b6,
+0xb1a1d8b89cc2ece1, 0x821c028e4d647e41, 0x436d407c63db5e52, 0xf82b1fbd920d340b, 0x800a7405407d459c, 0x1718a8ea2017315, 0x140d944e85e3a,
+0xceb9681e04fe7a02, 0x8c0c395c5b06fc54, 0x11ac2b2aa48009bf, 0xfccfb67fa463753f, 0xdde242d0b1fb569d, 0xb8c2376ff77d5b7b, 0x20743d9fa53fb,
+0x5307ce44b67cbabc, 0x660aa1e7e917b8d1, 0x591601c9cae7aee1, 0x3489735a88e11c74, 0xf5cca22821d6e6e7, 0x3e745eb3a665f7be, 0x1ba06d9d38611,
+0x556a3d504724d118, 0xfd37f1b63a463e8b, 0x42f3323902660b50, 0x5cba00fa3d5d2c1f, 0x943ea8da0abdbd4, 0x74c19e4dda8afd64, 0xe0cefbbdfa5e,
+0x374b502413895402, 0xf160f606d94e48ae, 0x44b207a110448e84, 0xd3ce548b2763db28, 0xabda9141c061b45d, 0xd92fba0a4375c55d, 0x90a76d90de7,
+0xf10ab8e4bcdf9a1b, 0xbd74bb4769698db0, 0xdd59acfebb723060, 0x7edd9e3b4f913241, 0xe8e0a75e7deddedb, 0xc7d8d9ff1788c9cf, 0x7e457eef255b,
+0xe7eaa369917c0f6c, 0x725b46057eeeaabf, 0xeb4393e619663fa7, 0xc2bb42f4f766fad5, 0xff863b1f6b9473e0, 0x263e7705a30f145f, 0x10c321d19bcee,
+0xe2bdb4d5de543338, 0xca45c828ada64414, 0xf36b5a31cdf3e527, 0xf7f6eac06a71b7da, 0x40f99d7e1632d0da, 0x9946813897433ad3, 0xf87a9a4dc70f,
+0xceb047285ec0afa, 0xf9ef058828c8a835, 0x7266f66b307dc34a, 0x16e22e25d7a1d358, 0x49ab8ecf3531e2bf, 0xd050984fee7a02ce, 0x220b3013d49db,
+0xef919a7048feeb2f, 0xd323a6013900d17f, 0xdc63692b5dbe04b7, 0xbd5514608ef6d618, 0x424c023d7532d16f, 0x61f3598694b3f9a1, 0x11c85f3a2053e,
+0x16b5cf5ebac54a39, 0x1173239a5522b696, 0x700d24298af084b4, 0x2db5805d7fb6ba4b, 0x733ee05cb58487ec, 0x59fb67b1ba623e42, 0x14e17c6ca2eac,
+0x2bf3eaa8d0e2754e, 0x972aaffda0fffb4f, 0xeb05d8814ff5240b, 0x496c1757bd529c2f, 0x8506965009b71bbb, 0x173d1e9b801f1ad1, 0x733f3ec08a28,
+0x24070e9a0c3fe6c7, 0xbf65438e59d5084c, 0x4304e31b90914a7c, 0x98e5c0e14e2bd9d, 0xb3aa9df8efbd56f2, 0xa910ea96ab4f753d, 0x18d0d3b2e13a3,
+0xe2a4aecd9d35f50d, 0xbe2cf192bced2142, 0xaecf95e8f1778681, 0x7a0fbac64ed4042, 0x2750e8b58a8d4ce3, 0x51622e0185ea1afd, 0x1e166be2a8aab,
+0xb6bee8ecc9ac5438, 0x3f7b39180e36849d, 0xab9044e82a58b256, 0xeaefaa314e3bb193, 0x83e298fe418185a, 0x60eb99722e815a3c, 0x209be1619ce38,
+0xa59f78a95f183b1e, 0xc6eeab981c8e1d05, 0xbd2247bc0ffb8b4c, 0x1b2e03d6069af22, 0xe47538ff4412051c, 0xc53986f6e1e9822b, 0x1adf3938453e6,
+0x57ec7e01aee19c3f, 0xc07a762c43e887a9, 0xde66139c519c9705, 0x3b604009f4c90012, 0xb4420a0c301a6f10, 0xd5a43bd3eb6c5bf6, 0xc9c3c2f3b485,
+0xa0eb5766f82bb5b3, 0xfb7aa363ed7c5ca3, 0xa456cf610bae3af0, 0x92e2c9b4ab76a8b5, 0xfb455510c055dc0e, 0xe70f52f910d15e89, 0xe16e630c2b77,
+0xec57e694c7d89384, 0xfe666c60abe37cd2, 0x5a4e5cac60c84a84, 0x5e6f48fb98b63b20, 0x5994fa525c9d6e2c, 0x3adc5caab112bd02, 0x44f4f2edaf3c,
+0xe0a1c6d77ec36f08, 0x6573316f22462b07, 0x5c7723c7a7a9a4a8, 0x9184549d021c3262, 0x9392debf31b0f149, 0x26d634f76693e93e, 0xa939cbec586b,
+0xa3d0e679d16867c7, 0x7b4e7ceffa8a499, 0xddd4a3d336f55ee4, 0xf1686ad928cdb052, 0x7d7331a894f50633, 0xcdf1c03af15c6028, 0x55ab8e60f42c,
+0x493b4b0dcff1e320, 0x19995b28edaf6a7d, 0xad9ed57eea19af2, 0x5de59a598e145897, 0x4273acdd26cfa0a2, 0xa26d052b4bf32369, 0x19c2a895a802e,
+0x543c037bd1d71e3e, 0xfc5d126675ff779a, 0xf09228b83528c3a8, 0x73743177c88f8475, 0xdf63bd5f176b7a7b, 0x74363e34fe10b2e2, 0xe4bb3f7a580c,
+0xc04de7f1f504d025, 0xd2a50b61d772bc3a, 0x1682addd867d10ba, 0x6abaafc8311a2310, 0x6ae4e824654add6a, 0xe18f86ecc5e6ff5d, 0x206c3d4e277c5,
+0x3c486c5ee81edd60, 0x3216f18c38fbd19e, 0x22fc9beda3b501ae, 0x27ecfca0817c8295, 0x5599e207b95d21b0, 0x40ea04ac7f358f34, 0x19fd2db5ff743,
+0x4e79ad5322928d08, 0xb8660ac0a8b4c580, 0xf568a23ed2145175, 0xa664374ffaa70649, 0x21b589df808ab894, 0x1d4c413a08bdedda, 0xf63f35db7b87,
+0x542b525ec133ac18, 0xa672d5245bea7693, 0x91ab108e05dbbd, 0x802ef6bd50de888, 0xdc1ddb1e9a1d6e45, 0xc073a4cc2cf26c3, 0x608c06fd0bc4,
+0xbb2ee2a4dd473616, 0xa4b4de854bbafb0b, 0x5b2b3647b5f86e44, 0xd307e238858dcc88, 0x98fc127f12da5361, 0x691e90fbd4344fb4, 0x17fdf1bfcebfb,
+0xf4d979e24df8f05, 0x31d60ccf42597836, 0x36896c857b200d12, 0x720bd2f30eb6fa31, 0x5fd33e6d61270e3a, 0xe49991fd98a8063b, 0x2337a203350f3,
+0x3ecdef0f6013baef, 0x1e89bac4d1e32e4f, 0x430aac434b5c50d6, 0xfb357eaae53cf80, 0x9fabc75b28db7180, 0x6f92b291f3de7958, 0xb90c435a7e2f,
+0x52dfacc0ba1af40e, 0x6a25a47d42f89346, 0xe961e81b41274ed, 0x42a0916bbafd5b20, 0xf138f780a0da2fd, 0x4035f894d65cea13, 0x1137e49d63e6e,
+0xa2bae4933013524d, 0xcca2285c2b82db15, 0xce4cbbf680fecf9, 0xbd67067cd33d007c, 0x39f528d2bf496fb0, 0x7c8d62af7f706c3e, 0x151a11bdd3aa8,
+0x62c5bae910e72b9e, 0xc42201b203802855, 0x21b12673ffc7c3b8, 0x7bbada908151b8e6, 0x40fb05b4a6f68831, 0x21588e35d666cd7c, 0x95de51f29897,
+0x9c558dc72fd0c7a1, 0xe8bcc5712e269d2d, 0x2ad1e188b14ac965, 0x92df3eae52511320, 0xeb1a492648f5b950, 0x588cf370435b16d3, 0x1fcf0fbbaeda7,
+0xd8415b3efc0d15c2, 0xc35fec00c54bb7e5, 0xc8fa15945e5a7948, 0x4c5e8a1f84d62d7c, 0x3b3229cb36c84f63, 0xdde2a434d723c0f2, 0xc30ea0bf1fb9,
+0x1a69928de7c4404b, 0xd45171cdeb501cb2, 0x7820cbf314d23207, 0xfdafe2d91df7ca07, 0x771755784abe564e, 0xe3f8db02bc9c4c22, 0x8bef7abd50f9,
+0x2d7c77d7b8231b85, 0xbc0bc6a408b15a5a, 0xdd373476dafe6b17, 0x397a5486f0b8842f, 0x949f6ee54b1c9e88, 0x4d9956257c47963a, 0x7732dbbc5302,
+0x3861b17889b44bb9, 0xb617173a3f94b7c, 0xc80876d6f5c2b93f, 0x19673c0312aa7b7d, 0x2f0f5681dadd5d8c, 0x573a90087a9a85ac, 0x7effc9b7ce67,
+0x532fc640c121219, 0xbc7b3a6420daedc3, 0x7e854e7024c59332, 0x98473e06c310518, 0xeb495474786a0931, 0x44ce326e656711d0, 0x20b77cb00093f,
+0x3694a0849b02f53d, 0xcef4c9aad7539b60, 0x9db21d8a61122931, 0x295226dec66e32d3, 0x4ca65b25bce79e57, 0xd3267d5918d7cbb3, 0x9c1278feecb0,
+0xf5681860097f2d7d, 0x42629c146a307d61, 0x4b2738cd25da506e, 0x528cec691d7a5e5f, 0x2c0c107cfffe28dc, 0xe11760b249a5540e, 0x1e372249624ac,
+0x450c62ebd1434745, 0x1a9b10e3e2fc70c6, 0xa10f21f56d048f11, 0x3d760e39ec919f60, 0xd8b544dc88b28610, 0x58d5f9ab29499ee0, 0x106d5f3faef72,
+0x7c1914be9a8e46cc, 0x952587a5f72c21f8, 0x1473fbb0405b51cf, 0xb58fb95a58418541, 0xb60ef62b511f5cfc, 0x56f9914908f7fe07, 0x1a13d5845c8d7,
+0xb694c96ee723b9d7, 0x380835111fda5fb1, 0x5a1e08784f4c4d91, 0xffe21071148fb7f8, 0x8915a973a14eaaa1, 0xa07ff78083b80f2b, 0x10248083e46ae,
+0x1837d7107845a437, 0x1d06ef66911036, 0x31118c77f06d472a, 0xe5ea620e1b61c3d0, 0x2739c76df7bc5087, 0x1ac93db28a8d91d0, 0xa09acfb7d33f,
+0x8b86fb11b75de1d3, 0x65232b4fb67be081, 0x42c62914bf08047f, 0xc26e24c88ba87c7d, 0x8b755377f58e0f85, 0x970ebfa65e15827a, 0xbceb30666527,
+0x596896fa6d8e8e4, 0x55fe89c9af6cb638, 0xf6597a17a646ec8c, 0xe50b24663fb8a6af, 0x2f02cae0ddcc1f0d, 0x7b503a3f40ce6431, 0x15610251ba782,
+0x83a1eae646382cfa, 0xe0c71ca2fff19412, 0x7b1556a21d7531d, 0xd5ed1ec2f6f41159, 0x25612a98b3d2c67c, 0x544452e72751a7ac, 0x1b97c6a01825f,
+0xc159d45d0ec3e913, 0xd39acecb9054d4f2, 0x2fa4506025d15f3d, 0xcb7fceb186c71013, 0xe61214a85f84a0e9, 0xfb1f474019a8feb8, 0x16c9cb1d417a3,
+0xc76264fc1defc486, 0x3eaccfb4f06e7b6e, 0xdfb5f18df45854fd, 0xe25b5f48c80ea5b8, 0x26f0b81ac0ee9334, 0x24fa843ddca93c4c, 0x1f1167e954fa,
+0xa4533eec6ea1ab22, 0x1babe2dfff6f0fe8, 0x71630feb70ac9c2e, 0x27a7f6ee5a7aea15, 0xb7fb93aa66acb756, 0xe42389cae0400f55, 0x16a380a329089,
+0x1c0fb4f44a4d322e, 0x804932c6cc1637f8, 0x7279a022da0d3407, 0xf7c94840458f04db, 0x9d747841b8cdb14d, 0x89542c439a5e4e11, 0x1ec76d126b5cb,
+0x682bcb2457d0a13a, 0xce34b1725be35197, 0x94ec16125e0daca7, 0xf5dcd6ea9e37f5b1, 0x24dcbdd99b8fb34e, 0x4b3b0df0cc05fdd2, 0x223967d9bde96,
+0xa076c4a6d4b9c330, 0x22036ab9671bc700, 0xb5a137cc05470afd, 0xaad07c4aa3a6ce4d, 0xfd0356c0dac2e8f2, 0xf260e680303b3688, 0xff6d9a088073,
+0xfa0b554db3f5d227, 0x832e232261c0ab1b, 0x2e9a2af9e42d0e9c, 0xeba55e4f74586980, 0xbcb9bb7d86a87c8, 0x373a2c1b313e73a, 0x204745c80ebc6,
+0x20da6630a63bfa6b, 0xef2c3f9102037c51, 0x7dcfe623fe004615, 0x6486355197c77da5, 0x59c5f4a6dda482eb, 0x5a443e45e6ac1cfc, 0xb50bdb2c3380,
+0xf0b775b401770804, 0xbc87f7b2df70b3a8, 0xa785f04a0f19754b, 0xb43c6ef24dba828e, 0xbc36912f54403861, 0x991957f49d255f4c, 0x1a5c9141094eb,
+0xb8de2586f8ce821d, 0xc0ca621096173b89, 0x372261d3068fd3fd, 0xdc205552eab6a4dc, 0x28b0819e00d8b9c2, 0x254055e601e6ddfa, 0xf6c022c3cf5e,
+0xc0f2444725ead59d, 0xd3b965d2500bbd05, 0x8d50facb8912fdee, 0xd5091000b618c2d4, 0xfa2db5a9d028e29c, 0xe4f2154945b0d568, 0xd352713c9a75,
+0x1f21d0b9c493d458, 0x9be3148f9141f81d, 0x1531e3cc4a0ea54d, 0x808fbf0eb211528, 0xd18f13547eaecd6, 0xa19f67053068f907, 0x6a926808c311,
+0xe4eec7336b4a60e6, 0xecf576d8b6cc36d5, 0x4c32d09eb3e99180, 0x882f12d16eae9253, 0xb91cc4636312e22, 0x913df437b6563f80, 0xf35bcc5e1829,
+0x52e404fbdbb716f1, 0x45641c607952a8bd, 0x2a09bfe0150cfb79, 0xb9b87a2953eb3e8e, 0x93ec05fc6314e474, 0x30676edb2f7681ca, 0x15c0a25385a60,
+0xb02662033dbc691, 0xc1a54147a4fca3ec, 0x1f3020d5ea4b46ad, 0x747f11b6a86026bf, 0x509520ddf110b798, 0x3d4f2d7ce96ebdbb, 0x2108e73ee2e05,
+0xa10c6ee1cd322499, 0x7c5ddf8624da0cf6, 0x74375a72194aa708, 0x96669031ac116a56, 0x759684808a8cc702, 0x482be03b0752f2d8, 0xf05ec7f826c1,
+0x72b266cc9af6f6db, 0x84edee6c5973cf3a, 0xd46b9058b0f4d279, 0xddd62a1d96293a3e, 0x667567591b56e8fe, 0x84fb7a1398673c5d, 0x896d4399c4f2,
+0x22b8f01871a424d, 0x13ac5fbd14bfd0b2, 0x64602fbe7ad6c02c, 0x8be9001a36e5c21, 0x59acccedfa89bffc, 0xb0705836e4b3190c, 0x165e14bfa6296,
+0x6e1154f7fd95976f, 0x8b1a76a481e63324, 0x39b4a6861ca63c9d, 0x70881809898b0ce2, 0x8347963babaac397, 0xc1e156aa703b7d64, 0x14806a944defb,
+0x9d0e3eadfe69eece, 0x9930406c8db77aca, 0xbf4abaf210936175, 0x22d16463ae6630b9, 0x422c11ac1d8cb769, 0xb2e97619f7b939ae, 0x1dd246cb77999,
+0x9c3e25302d3258c1, 0x825f68ee82a27484, 0x342c899abb4a9aab, 0x53aadb0cdc9facbb, 0x8fec41e4fa3d6e2, 0x5e6225c1b94402f3, 0xbbd735b25634,
+0xf1d8607b1a08f9eb, 0xf538f7e5abc28240, 0x64efea3f603eec02, 0xec339d22a5c17fb5, 0x224acada20e2d833, 0x7aa02ec55961fddd, 0xb1f256b01839,
+0xe76d6f430b8a878d, 0xc535e48736962c02, 0x3279b5b80ad78af4, 0x3de2dba57ecc0e6, 0x46a8f51618d7db73, 0x46d3547ce67ab458, 0xe95276afe991,
+0x633efda89e27adf9, 0xfaff16a89353d19f, 0x5343e751bc94fc48, 0xda5737f14b40c15, 0xebfffe160d9c6bef, 0x4e77aa5660390469, 0x6a0075bd2b13,
+0xed473386f1ee5895, 0xfa5fd605f5bcf4c5, 0x1f7e0926256c798a, 0xe4099f298d3db65a, 0x40c140c506749843, 0x6f4d25d6b92bd157, 0xc067a0cb5d2d,
+0x8a4e97abc1f01a80, 0x71a3e735df67f67e, 0x7fead65dd649314a, 0x7ed9955a5686747e, 0x33386aedf50305e3, 0xdedbb682944f47a1, 0xade64824f19e,
+0x9b3ec943cdede5b7, 0x3168728b42ae9a7c, 0x71161b2a99869d16, 0xac39945e9bb33023, 0xe9e19c1c6866d569, 0x1d24f6780478511d, 0x1f832675279fd,
+0xdf9713e354605e42, 0x26a3ea05d97d3977, 0x9474032bc2c67a73, 0x519719d04b612fec, 0xfa0941b43cb9a276, 0xda56f98b5a35dafd, 0x155b99ef6b137,
+0xd45b1b6144985859, 0x908aa157295e553c, 0xdadd77317bf29995, 0x9cf46e780fd4d764, 0xbd1f88180a73ae81, 0xaa8b33ce0f261da6, 0x132d611a0df69,
+0xa2cdac487fb8f76d, 0x35d7a78cc7402e39, 0xb2cd929601c9bb27, 0x717245a723c53294, 0xc94251af9bb26d57, 0x65ffbf2217876b09, 0x22a7ddf4fb7e8,
+0x5bac39aefea51cc, 0x40a4c0e2b1db000f, 0xc7c44e670fd4cab7, 0x839e6b45b032c5d7, 0x6bead440722d93eb, 0x721edfaba9ae05a5, 0x1fb40976bb42e,
+0x458e5342cbdd8b3, 0x3bc002f23d236a25, 0xe9741c9e7ca3d0da, 0xca1191af6a83802f, 0xac482abddee62830, 0x9dd15049e520a3bb, 0x1f32b83f8a077,
+0xf351784b315c20df, 0x9453ef20dfded3de, 0xdc1a4b4e9a583bd9, 0xde1a8ae0028cf2fa, 0x296b560d13778675, 0x92e17292b518659c, 0x21335bc6ccb5f,
+0x8454fd93788b2ed0, 0xe7f48514b7bf3e3c, 0x16be557a7045621a, 0x45a96f27aa826b65, 0xa686439b6bc0a7d4, 0x3c2ee6a13e91dd7e, 0x21ba765deebdc,
+0x4e089afaee909141, 0xfd1eb12ff61b7753, 0xf43b89747c2c9680, 0x559641deb7f635d1, 0x3d3b75142f64cdf4, 0xa162eff5d25a2617, 0xe0e7f4157316,
+0x1b863b5f7ae9aceb, 0xcee23ae4e5cd3787, 0xc63cfd67b623f31c, 0x943e7750c224f1dd, 0xddad0e42d8fd6f95, 0x63c5ea6fb10a3430, 0x85d0a4aa3710,
+0x62d413b6eb4a739c, 0x5f8d261b5f8fa2a, 0x987c4fa93b89a852, 0x9ab5ccf7264cbf9e, 0xa19af2e380a610a6, 0xc115bb817f213e05, 0x1cb37dba2b47b,
+0xbaf15d263aabbaec, 0xaee5be6ae5f61596, 0xf4bf2324e300b4af, 0xc515dbbe99318f53, 0xf4cee44d82c67028, 0xb95d50dad30980fa, 0xb8c092a160a1,
+0xc9db0402aaac4b6f, 0x1e9eb38d5cb8dbd2, 0xbed69483cec98553, 0x4cc34ff2f94b4d00, 0xba44d86b68465c16, 0x7d3e167a5bd99d19, 0x911f66dff350,
+0x61cf305d76d2c861, 0xe556acd49db424d6, 0xa040e885ec6bfc8e, 0xb8e040298d45f5, 0xd0e50e93939ca6d, 0x9ae6e02e4c9ed9c1, 0x1152cf4bd2ef,
+0x6aa97a9a6ee51de, 0xa08e0f8b5be863b6, 0xfa15c406d68f15d8, 0x3498ed7eaa5b1d50, 0x83c9277673fc81ef, 0x94a884da896e16ae, 0x5aaa212e0cf5,
+0x8c3be842965ff50d, 0xd72286b532eefc, 0x636a8fa25a144499, 0xa0f8681e83078d31, 0x6c54a5e2b8bb5d55, 0x747ea64425f6363a, 0x12b4806aacf65,
+0xc84f37de0470eb07, 0x2c5f9da9cfdf81c5, 0xb95c418186203598, 0x9d6aa461c4e3f1fe, 0x9df6b7cffa3b6d2a, 0x5711d29c1e664574, 0x159f37b5f6dc8,
+0xa795298140ab4f63, 0xaeaabdac702cd409, 0xdb5d73795a18972b, 0x911dd44e67459858, 0x94f5bc6193ef5e8d, 0x7ffac91b4ec114eb, 0x1e2fcb6ca6371,
+0x847f406f5a2373f1, 0xbc2aada1f6d97dcb, 0x706272c388e6ce42, 0xf01d4d24f5cef47b, 0xaf3ae9f4d0674790, 0x1397ecaca0d07198, 0x1b0057012d46,
+0x2b065736021a8cf, 0x5e3af32ad57ec141, 0xe1884294511160c, 0x3c0102fccb782777, 0xf90d7df558d6d9c7, 0xe51fa3497b00276, 0x5ba4b72bd021,
+0xf0182f8b15a07c71, 0xb415879f2044bc24, 0x52a309f1589f06ce, 0xae9a517353c3eb86, 0xe75fb92c5000d4c5, 0xd705beda1e3da4ca, 0x1799cd35d02fc,
+0xb81f1553334bf6d3, 0x272c52b3faa4868d, 0x36e2237a0dfc3e78, 0xa7328fd3ba877832, 0xf0bbd89dc994b0a1, 0x21577291c434747b, 0x8698023dff83,
+0x4925c03d8183b236, 0x52f2b37001aa15e8, 0x2aec2876a904f9de, 0x819d7ee60acadcb3, 0x97ffb96e1b761bf7, 0xa96263acd560a2db, 0x3d7d742d0977,
+0x6240e3290c0ee035, 0x910dd79ed484b15c, 0x4604601c00b55fbd, 0x623536320c244d01, 0xf4906fd1f4712724, 0xc92e8933fd346d7e, 0x98550a5cef,
+0x767db716023c6206, 0x943c5096444af4c3, 0x5a4a522d85a5d244, 0xcf943538a28a8e28, 0x1e2c61c3046d844b, 0x5470e2cc5f8cab91, 0x4aa848207fd5,
+0xc0b20812d0e00b09, 0x4f804ba5e006d9f, 0x147ea6b3c5006ddd, 0x80038ec9b0ca29a6, 0x70bd5261d00a4182, 0xd0a3c841f81955ec, 0x1507edee65fe5,
+0x8b555e6a72223f3f, 0x7ed678953d2f421e, 0x5cb275ca18217596, 0x4bcd1ebe0654aaa, 0x7f136d51b2824c30, 0xeb880bde6fbb5d42, 0x17e3411d624c0,
+0xd8b3449541d881ec, 0xab659471a2cdb36f, 0x2c183d9ef5f952fe, 0xae886dafce25c20f, 0x5118053e208c9c97, 0x305f0d06910f8883, 0x1a25fde130e12,
+0xe6626d2ab34aef87, 0xc97df80162b6bdb5, 0x3ba056eb91ad9c28, 0x7b874c9423dfa8b8, 0xdca56f63ffb89aac, 0xee8d14fbf866b538, 0x2ac7e71ef937,
+0x4482363f6042b8b3, 0x75e9d65f8608bca3, 0x53a79b7730f2cb35, 0x447405598fa8abf6, 0xb51454176265b7a, 0x17708a75e6c66b27, 0x2216b4cd30677,
+0x918e889c291b3de4, 0x5918a492c96e6737, 0xdbe2485b7a70b843, 0xe2b4403b0591a30b, 0x104f0b6f39e5d5ef, 0x3cda29452d8fa547, 0x1cb8a33a3f7b6,
+0xa48de2b7309d6bce, 0xdbd8294d3b126928, 0xa02d0b8dca67bd9b, 0xebd8aef5ca06da88, 0x73ba28064432886e, 0x7405e8f45f2008ab, 0x9f118252e103,
+0xd7e2dddd1118e6d8, 0x29fc23a9acf5e015, 0x8414d64ba24ad17d, 0x75529dbab7734f91, 0xfb71c792bac161a8, 0x4e0da36f9e716cd2, 0xe31896af5a7f,
+0x2d3f55ea5cec3e53, 0x74ef5528934d2fea, 0x89304f7eb2ea4931, 0x9b234ef562a514e6, 0xd5fadfd1926e7c2a, 0x2cd25a4b2417df8e, 0x598739b89467,
+0x4a524ffd6c5d1ec6, 0xce4e58a7c08ca827, 0xe9c3335895d77253, 0x63dbd48d5f295ad1, 0x179e510c941eb38f, 0x3df9a06897b2c6fa, 0x1111840667250,
+0x85264ff5083448ae, 0x1d1007c9478af516, 0xfbb7c738cb970261, 0xf3f849ad5c30c02c, 0xa53dcf69c09970b5, 0x32211537363d2d87, 0x433fbdc45b4,
+0x9641e996d7a7c202, 0xc90e4fb8c3e87082, 0xb83337e813dec5df, 0x8c850d9ed03045d7, 0xed6583f5290f4b7, 0x49d8960ae0fd57ad, 0x1532e59f83510,
+0x2e3ea562ad070b52, 0x179da3647598ce1d, 0xb36d89f757a02c67, 0x38400204c579f386, 0x9f1e9b6ea8e323ca, 0x13e0c27df09fb800, 0x1e0882975b431,
+0x561ac1e8d6f2acda, 0x6d7a4dfaae3d12f4, 0xd765f9b2a9169a37, 0xd6ad33d955e727ba, 0x40acf6606c5df098, 0xd8baef445c0d3ea, 0x9cab07c102b,
+0x27131075430391e2, 0x813a747715217b2d, 0x6a8f82865e871fae, 0x23aece2b741a2fa9, 0xd3f760c97ee2a95f, 0x30a96b305d7f8822, 0x1c94d1abf9b05,
+0xa82e6b41c6143af8, 0x8e92af75f0aab5b7, 0xb8ebf1f67947103f, 0x4ee930d3dbd61c2, 0xa0401334ce60b278, 0x312ae9da476c580e, 0x20f98f95199c,
+0xc6bc597c07c4dcfb, 0xcef20ed04e83ae8e, 0x24c59eea2f1857bb, 0xaede09c57bc5568b, 0x26a07e8a854213fb, 0xd08b02d5358bbeab, 0x1a064233d7c6a,
+0x75306a2953c3f9b1, 0x5a8f7a4b9c672ba2, 0xc6620948cd6de764, 0xc7d3de03b7a03dcd, 0x9be7ffedf70e04b5, 0xf1507403c220574, 0x7ce444958fcb,
+0xe8f655a7bfab3483, 0xc8a84f98279827ee, 0x83d1466288e14e76, 0x34c58683c532bd32, 0x4094a131e86670bc, 0xd92409b7b3435ccf, 0x1b5d30b32b1b2,
+0xcfe556854b5d22c2, 0x2073d46613367d56, 0xcc5ede1c69380a32, 0x7bbbb14904618a9b, 0x53902bced833d632, 0xa4577c08986bc905, 0x386e38e1e41a,
+0x14f120d37a59a9c4, 0xa375b8de0b28aa76, 0x8db6a0d4158d580b, 0xf09dae59f2f3f636, 0x8a5d59cb009927f6, 0x186654acb24b28ed, 0x18b758b96883f,
+0xf5a237262b6f1873, 0xee4c53a8f8094819, 0x5100f983ece6f8ad, 0x88b07804e17e1191, 0xd4936872f7d61d73, 0xd4dff4e96bff089e, 0xe19ad76a71b5,
+0xdc4388092edc4bbc, 0x67d6997a0d626235, 0x4c406cbf4365e98c, 0xb46667d3344468a4, 0x95794bab4f3c37c8, 0xa1c1f41c08e41a4b, 0xd709f80e154,
+0xe9e29f29ff49c526, 0xec785c1aa1a61377, 0x3ca4e47a5adc0186, 0x7b139cb0d79891f1, 0x8e457690779ca41f, 0x19d2a6778923694d, 0x1e880c4d1c7f8,
+0xd76753c4ee9ea38e, 0xb3ac39b6f9da70d9, 0xe2895a40d4f6a765, 0x8fa07b4550496599, 0xe8510b9ead7b6a82, 0xf2e645fd73c110da, 0x19c613b10a769,
+0x990ab46be1b7c474, 0x4c352160c99ef6d4, 0xdfa6d2ba76e5b0d8, 0x5b0110cfdacd2bf7, 0x90fa0d54712f57c7, 0x7f8d296ec5db80d7, 0x9d1b471f9314,
+0x3b3ac19815cea396, 0x4a0b69048bca35d0, 0x5bac79d07b443f69, 0x1490eea30b8c94ca, 0xd7f584ef251cd14f, 0x77ab4a999fd02fae, 0x1415dea448de7,
+0x4e8537fb19042de5, 0x89c1f7e242db07cb, 0x2b250101f31d2dee, 0xb9d1df747fe4765c, 0x3b56145efbc9a977, 0xf138caccae405804, 0x213060ada3b4c,
+0xba0954ca78482cfa, 0xf8e3b28e552d8257, 0xb11d49da8480abe1, 0xd1d24678f46f1332, 0x7304189c2d1f89fb, 0xa1995b4b3ba67f7c, 0x785a319a2899,
+0x4922e3624504e10, 0x6923a962f9819b05, 0xa10dfc9b64dd667f, 0x712d138b0999369d, 0xcfb195594d1fc744, 0x29ebd78273930b51, 0x18fdad4f2fdd4,
+0x31a760381198b19d, 0x8a5cc2360190d441, 0xc7c51664b5c6aaaa, 0x8fc700d90b745419, 0x5145286a1cf8f82, 0x2542929ca9519835, 0x1a66d7b1eb1ed,
+0xf4e35d2404ececeb, 0x6c809a631360a32, 0xcb23cfbb388a436c, 0x7e6e2616342cbb0d, 0x5c79ae99d986f540, 0xf1df41661bff5638, 0x18470e44d42cf,
+0x3c8fc12f2c015f6c, 0x3df7b5f3b2886722, 0x635d376eed8e935, 0xa41c55d18f01986c, 0x7b7ca6a66f905d58, 0x4b48f60b186e1ba6, 0x14efbcea9dd20,
+0xd10dd32511cc72d8, 0x1bc41535dfc482e2, 0x37692b482871de51, 0x36226bef75d4f954, 0xe662a1800ed3f5a2, 0xe6ae89a3d067cd15, 0x7f1b509b92a0,
+0x93bbc439a4b0193, 0x655cebb7ad54b22d, 0x815580e80ca1fd7b, 0x3a402eae63e9b854, 0x421721ffd61f2ce2, 0x5ea1fbfbf7872d8d, 0x21989d1cb85d6,
+0xda299b0f79939a57, 0xf06881c9cadfe1d6, 0x6ac1be9b4c787334, 0xbaa78ba5d92db6df, 0x6e1a9b80f732cb88, 0x42eebe11ab3f9663, 0x193a935473958,
+0x7e227753484de4cc, 0x169ae2d7d38bc05b, 0xd0315609b2f5eb23, 0x4788c8dc8943a6c6, 0x6212f538d85347a4, 0x5215e086fca34498, 0xaddbef9cd028,
+0x7c2bf5594c670c58, 0x1fd060726d56b513, 0x162d7297ff58f35, 0x6f411ec42544b91a, 0x727bfad72ddc0986, 0x3232a697b306fcb7, 0x20415127b5b0f,
+0x5d153b9da6d253d0, 0x31b1807263fe3394, 0x4f0c932a9912a488, 0xb5ebce24de90e10e, 0x3c17e72c08b146bd, 0x40734a58233a4dbb, 0x189f480ecaf4,
+0x11239464f1ed0125, 0xd37e5a89f07eaa4, 0xd4d4703fd945fdc4, 0x219f789bfa12ce2c, 0xbcaa6b985379dc8d, 0x5616d03e24ad3043, 0x204f4fb8a902a,
+0x83ee86792385ecec, 0x3d26bfecd5c3cc62, 0x7eae4ce9486bfd47, 0x7e8bfcb4bbc5b37f, 0x17cbc1c68a9f43ab, 0xb1afce922e76150e, 0x208af4d9c8a84,
+0xc9f64394a2464bbe, 0xcb0be1dfdc0118d1, 0xcfc59ef546bc1c4e, 0x89a8eadb8e92abb9, 0xaa126df278e9ee34, 0x731fc637a086cdec, 0x169427ca5542b,
+0x3029e296eae74287, 0xce7a9650f152c528, 0x6ab52e472cef80a0, 0x84103eeb8cfcc8d8, 0x16c569980d0e4826, 0x39473d506a44ca6f, 0x9288f26370c2,
+0xde76bc561c588161, 0x382b215d771c11e, 0xf0663c62062074c6, 0x7b93a949451cfdf3, 0x5b7f6a10479b723d, 0x75f7befc6a316606, 0x1aa4a1595eca5,
+0x94c3b977fb4dad93, 0x9de023785540feb7, 0x8bee1b2f23277820, 0x47adcc146f599701, 0x30e06c9124a729c5, 0xd0fb14c2fa42c15c, 0x10507baa9c866,
+0x5fdd1d26dd43ff76, 0x1d4bcc8c36ca650a, 0x3a2e6ec77eae2104, 0xf7107a30e7c644f9, 0x8df75cf9628c7fab, 0xdee3fb0ef55bd70f, 0xf4ac4206df1b,
+0xe2ebf7a021a403ee, 0x82318e507697a57a, 0x9bf786c9d519e95, 0x9408e9e9cb218463, 0x4a686764642753ea, 0xacda0b8bdcc6d892, 0x14a49c3b94663,
+0xab4ce9596e0835a2, 0x7e93de66e7290edb, 0xfcfa6df98c93aa83, 0x256d9f7bd59026c, 0x964ddf7676b38030, 0x4f6d8ae810b796af, 0x269c45eb1385,
+0xe9729860053c79fa, 0xfcb58e4da1dd4fcf, 0xb5b52d2ac0efa25c, 0x1af4e0957cc42557, 0x48b768342f2ef509, 0xd54b89557ee44ac3, 0x16274580d33db,
+0x38e106f9bf965e93, 0x96512f89645c0039, 0xb3d65747d30d46dc, 0x7bec606c2a1185c1, 0xaf05558c56319027, 0xd7a50a0615be1759, 0x146d81ca02e93,
+0x8fbf04dc2c45f697, 0x3f975e58abf68548, 0x586e3d6736b9d99b, 0xa8506e1156497dff, 0x347709ca594e2bbe, 0xcb74fa5f0aaaef3e, 0x545f7a9668be,
+0x31cfa08b998a70e5, 0xec6065079968e1af, 0x3ddeea9723d8ce94, 0xf6d67b0ee5ace7fa, 0x65a3fdb6363e9801, 0x340c22837b7df2f9, 0x1cdcd917e2de4,
+0xf1209fc4b483025a, 0x46a4609f12e62d5c, 0xa891851692f66fdb, 0x2e5f6d8c944822a3, 0x60f2759a8bb4bf8, 0x6541d4d33ff7a692, 0x1a2f2dd1730ab,
+0xc65afbe430debef1, 0xe53b261c0743a5ec, 0xdd2466119e55c5fc, 0xab8865adae252ff7, 0x5a8970c98abb8754, 0x754a578e95ac6a41, 0xca44e74e1540,
+0x5846309ad6b3f341, 0xef0e9ddfb059ae53, 0x524e4a368e7f8306, 0xd7bf5874ea75e7f4, 0x24e47f1b311fceff, 0x68b6dacdeb8535ea, 0x1c2e9d3f1f336,
+0x48f898f3429a13ea, 0xaae2829a1fa1db1b, 0x448ba62914102591, 0x9f76264a909184a, 0xe1c409ffb2530f7f, 0x9f95bd84ce71826e, 0x8c322a124114,
+0x1dafe14f3c368a08, 0x9302f7f5a3701f4f, 0x85143c6112a865fe, 0xf1140f364916c39, 0xe4ea35546770f7a7, 0xc6954c3151245bcc, 0x1aaa83d37a1a4,
+0x15366529a22c06f0, 0x6a3c9f896c24bea8, 0xf47824165bf72720, 0xaab44657f0a1a3db, 0xcfb4f86322637b06, 0xe178dba29ced3024, 0x1cbaf6182426a,
+0x4afafef42d0c9f33, 0xc075a74932156b9b, 0xee32c0f5b9a7260c, 0x2a3a399fd49255cf, 0x49cbe32e3917986c, 0x1aaca9690d66995f, 0x18d2ba33c8378,
+0xab1b0dbe54f4b8c0, 0xee7dcbc8287f30f9, 0xc82dc69a479477f0, 0x1a51eb83ae79a44b, 0x349ea39b8983ecd9, 0x484fcdb2e4aaa783, 0x1fc3c5aa0ae29,
+0xcd5a4c305352b4a3, 0xcf9475ed57526adc, 0xa11020ed899b10d, 0x684ade93db195901, 0x9fa32d5f31767d16, 0x8b7e6486f8054042, 0x1f8d4874f34d1,
+0x1fe4f4ca2e7d3293, 0x5bcf5b1099321508, 0xa0a8d38cebf9f573, 0x2cbce13715983984, 0x75adbb0ca663c43f, 0xbcf09811b1f994e5, 0x13e322b277cac,
+0x765963ce0ce6298a, 0x7628454f0e5efda, 0x8cca329ddb4c0f39, 0x47703806bf26064, 0x1008ac5df8258b4c, 0xb51a01d8f7ef37a8, 0xc5a38be709da,
+0x221d518b891ad67d, 0xd1c4e86e8f9b76bd, 0x9b4e502c0a51dcd, 0x9a70eb44df6dbdbf, 0x15de138567b6760e, 0xd6ba8228ff5c3df9, 0x1303dcfeac3b1,
+0xbdd66178fb79350d, 0x27c0f51241d58249, 0x43371521286fcf0, 0x99f2ac0d4137cdeb, 0x9fac130c8d6a2789, 0xe0bedd75f2743a4d, 0x1457df027b8fc,
+0xd151264717f56856, 0xdd6b7aa52aac77d4, 0xb4d7cf5865a5a8fc, 0x905062d9670704df, 0xc0fef9abaa336af7, 0x2afaecac57aaeedc, 0x166e0d4f3c461,
+0x56f9134e06014124, 0xc603f5730b5fdca1, 0x6f30ffd14da1eb33, 0x34c115c90f22b685, 0x503aeaa9ea1c3c41, 0x99dfddb80a5688db, 0x63a79ff3499e,
+0x3e808f8629bc530e, 0xffccec371440de6d, 0xba78583edaff5c7e, 0xfa78aa21c51bfce3, 0xadee706d6df6a6fe, 0x7b74260aa1bccda7, 0xdd10a75b0543,
+0xe82a97deef43ad53, 0xbbbe78c0eb5cea25, 0x41d87cc23de83943, 0xed8aa027262503c1, 0x91241bf4d498be5d, 0xe879ddba80e08b6, 0x1a1cdbb6dda4f,
+0x5e8f99f09da6a98b, 0x807308d4ecc93709, 0xcec3605534c721bd, 0xa41aab511e8fe31d, 0x4b85365f26ddbb3a, 0x1cb28fd338ae4a48, 0x129fb3c319d61,
+0xe8fdcbd538a8e3c4, 0xde4dc08d030b6ac1, 0xab9456f63364852c, 0xcda71e314fc4259e, 0x4ab840f0384b3274, 0x2aadf2ed7997d4c5, 0xf0b00166eccc,
+0xa85f762a4595c5eb, 0xd4b53c95f24318f, 0x9cbadd10b927ac02, 0x7ff9edc04c616a00, 0xd15d993f8256bf42, 0xbb84ecc12509d024, 0xe7d825c6fd22,
+0xc2c960daf56b2ce2, 0x877c1f0c274ef650, 0x29cda473edcbd52c, 0x4cb100c9fca7dce0, 0x34f852353ba8f35c, 0x56d19eb75371cf50, 0x195e02420c822,
+0x56edbdc459b1867, 0xb156a4288bb334f, 0x8e8e8d458fe61bc5, 0x3de0f2be2a881c56, 0x8c1b3b0afa7fee9f, 0x2ae11b2fd2a6980e, 0xd61f200a8f3f,
+0x5bdb6e55ef4e859d, 0x8a7066c67b08d2e6, 0xcd9c755b99db2ef3, 0xa08157a48690e48, 0x3c961d448a48b6b0, 0x1c7d62caab149cb3, 0x1a2b7f6bc79cb,
+0xadb4e542938328e0, 0x16fdb55810c442ab, 0xc3e14dd67b8c83f2, 0x789b70d8afdf5d22, 0x13d8cbdfa5e5d690, 0xce8c95db31c4c8f4, 0x1fc9903e8d87a,
+0x1b09dcbc16eead1d, 0x722d72373246cde3, 0x54aba13d6d1a1ab, 0xf34ceb0fe61baa50, 0xdabab2e384a02ff6, 0xf42ea86244af5455, 0x12edbc7d475ad,
+0x3f0d738be549ee3a, 0x7c10bd952d0fe443, 0xe97574484955f4fc, 0x825ee55819e2d2b, 0xd55fa6f2871f79fb, 0x1e1757a57b61eac3, 0x1b3d3373980a6,
+0x95400df84c044902, 0xa2e68362402624f8, 0x13954118c3e5f9ba, 0xac6afd7098d3d79, 0xe69364a6841e1f4b, 0xf1afd43e84980127, 0x19a86f46867f,
+0x6c15cf6652f011c6, 0x5973858faea9d1a5, 0x4176543ef90fc55a, 0xf4daa72cd5dc1a4, 0xd9798023cece2fd6, 0x8a2a100fa5344767, 0xeb2543f7d9ed,
+0xd564da03f122ea9b, 0x599525913f6ce9a7, 0x8bdc7d91c772e11e, 0x8956f30265d5e6f9, 0xa66f096a94fa95b9, 0x68170522fe3d3bc4, 0x197a4310803bf,
+0x58c73eb0d9d19fe4, 0xea019a7a7e70e9b, 0x50ff14c436759220, 0x3933a9387f8ab4a4, 0x489331cc6bf4ea1f, 0x9d6e6f704aba4d10, 0xc52e354e1d0a,
+0x67cc3fb2b01ddab0, 0x6f59ef65b85c11e2, 0x47cbb799ac14912c, 0x9a77033de5b84629, 0x635b353d02b973ae, 0xf7635d4c6c101626, 0xd1ccbdd31ceb,
+0x195ee5c7b78981e7, 0x7124a6cbc2657089, 0xf2bb78ca567d333f, 0xeb911b3461148d5, 0xd686f36eae56721b, 0xc35582917c155fde, 0x1bd5aa2b08a5c,
+0xafa21e8393668648, 0x852dd80a6dab2962, 0x7cf84732e791a69c, 0x1ea1011697b4c598, 0xe6f15ccbafb0bf16, 0xd026543a29adbfe5, 0x13ee954fdc4e1,
+0xdde360c8723ad147, 0x2f654e5b42af157f, 0x49e180e8a7205389, 0x87405fabeeb3d744, 0xc17c281a645a0cb2, 0x5b215e8f7fc3326f, 0x13c62a378d6d0,
+0x38357037e6c395c, 0x7b6bb3b8fb46cea6, 0x5493885252db6034, 0x529a56a37073ccb9, 0xfa5cc75dd4c1bbe1, 0x7de11a37e0576be, 0x12b9f837fb89a,
+0x2732bafee471800a, 0x6ca863f3d502ef2e, 0xdfa6cab3da73e4ad, 0xbc7d95c25df56101, 0x7d2803d97fab379e, 0x63b2fc4531f3fb64, 0x896697eaf8b1,
+0x27783623444af4aa, 0xadb531ca64587e05, 0x2208304dd685ef4c, 0xded66a04f5b000ab, 0x4a69f0525c161af1, 0x2731d6ec8144e533, 0x1b2ecbb4cebd0,
+0xf99b3a43ab2114a2, 0xe9d2fefc5c412a66, 0xd87cb686fbbd9cd1, 0x7f85591575f7a405, 0x6002584fcfc0c682, 0x896e4eafc49f8032, 0x13b10f426ad03,
+0x8da8d04650d54b48, 0xe60b2b76be97c79d, 0x2bc46ff91c6356ba, 0x824222f7280a353, 0x5baec0176ba81382, 0xd4d92039b2d194b3, 0x1422403dd46e7,
+0xe41b5870e889b7ff, 0x20503e41eeb1e91e, 0x982d39f1c22ed23d, 0x8bfbdbf8e6588311, 0x935202e2bb0a9769, 0x52e09810f5e97410, 0x17906db9e6e0e,
+0x31d546b21484b0eb, 0xeb13af658c8daea4, 0x5d66d4ab5c5e19d4, 0xfa70fbb35e8a303, 0xf00f3152f2ee5e74, 0x4579e3fae4f0941b, 0x2a5844f9d9cc,
+0x1d3e48a4b706b8ce, 0x2f78b971e906d7d4, 0x12d9fcfa88b5d0f3, 0x97d80fcca6bf5cd8, 0x56167abcf97e1cf7, 0x886b34cce18f7912, 0x10f7b252943e0,
+0xb1ff60a34deedbcd, 0x869def4058824b88, 0x246b5d5a1cc7e7eb, 0x7b6ae9d862ce1833, 0x9aad452719ea4af7, 0xb8c25414f58fc306, 0x1f2d04be47d2,
+0xe6d8ec0919c9bf67, 0xa3e93027fee72e18, 0xea6f84b699a52991, 0x5034d5ffbe2cfb01, 0xa1837b19f8e1f3e5, 0x8a07f68dc955b2d9, 0x5e1fe03d670b,
+0x1eb045a98083b15d, 0x99da8b7a404a82c3, 0x58ce52b3e51d5262, 0x5bb6defb527650a0, 0xc893a9eb28279350, 0x687ae04a62df0f2a, 0xcdcee75ed130,
+0xee01fce696d9b382, 0x24e97b25d82a0f82, 0x76e64a82c747aa2a, 0xc0615257d2109141, 0x2565b3cb0ef18117, 0x77b9976791d3dff2, 0x86cf5868205c,
+0xe9167bf28021ac35, 0x299392154e45ff6d, 0xbf9f7e70a5ee1497, 0xe81befa6e4c210d8, 0x49792b0d522b53e, 0xadb9b662ee66caa0, 0xfc0f47945560,
+0x2af95c6373f7732c, 0x5721abcb62dee95c, 0x80e715e2bc8cb43c, 0x4aaac27b0b60e79a, 0x5d366145dae4a509, 0xfcc29c6825d0e8c8, 0xb70365d5af18,
+0xb41d9f387c9e14ce, 0x7e127cd63a86c925, 0x21c15c92d5f14abd, 0x9ef1b744393c0d7c, 0x9935a7cdb7ba2c23, 0x9b6377222085c367, 0x100aceefd52f6,
+0xe54e56696cb2c6a2, 0x375e428afecd79c6, 0xffa1784b7a9f6545, 0xdd49fb522dfcd89a, 0x4c9806d69eaf42e7, 0xbf19c3c8b86e1831, 0x1d2fc7d212dae,
+0x331c5c30db8662df, 0x64db6b3e7b9f8018, 0x4a49f7d297594996, 0xa787c4e08aef4243, 0x4752289eff7caf42, 0xed65b8800b38b32c, 0x92f4e17954de,
+0x32b586b833bcec37, 0xeaee2c5d3c5900e, 0x50c4672677d90307, 0x1c48f03b23748454, 0x741089983fa500c7, 0x3dc15038b04f87ad, 0x1ac8c89a02ee,
+0x33aa6ab93e56524, 0x4336aabd48b805d1, 0x42e60fa32720bdc8, 0xe9294e3d49ebcbbe, 0x80da4f06a96c3884, 0xbada5f5f6aae616c, 0x1ecbdee318592,
+0xc56497f3dc957b94, 0xda4ac2f81d1a7506, 0x9985999adbc2100e, 0x83343a8fd02da3cd, 0xb1b060dc9b213f8a, 0x4792bb29ec4e0d19, 0x125a391c86b96,
+0x19ca4c330e43c616, 0xe662dcc011ea8855, 0x56f9b60c868e47da, 0xd2220b517e3d59, 0xf3ab5a8bfbe5b06f, 0xa0b9b715e3d2eac5, 0xe16db5ad7593,
+0x239b4ed6594f63a4, 0x8b2c7d3fabedf2dc, 0x58173e61b96c5b94, 0xd6861e5b58c421ee, 0xbb142506e3f25dc, 0x5876c72957c27a5d, 0xc0478ca9fb5,
+0x731471b2a5421e0e, 0xd7ff466b09903241, 0xd4fa0782ef5e16b3, 0x64e99d18417a021f, 0x25278cb4bc020bad, 0xbe66341fc2b36ace, 0x1094e8c071c76,
+0xf40f8c2741f1b415, 0xa0aa261c6f2858db, 0xdc730cd0c0fc0103, 0xab564baca43fd310, 0x86e1b68c2783070, 0x17a47a57aec18ef, 0x7074142bccc2,
+0xf0797347d43a9d59, 0x3a5508e9f5fb9ea3, 0xae81eecc531c6bc8, 0xbaa4aa5052a47ba1, 0x8f6747c66939e9c2, 0xf742f44911013a9a, 0x136e9740d9d65,
+0x95256e365b8eedbd, 0x732ce53ebdd05573, 0x6bc10ff2a16c503b, 0x5e8e8c153954f84b, 0xb91dd0c06bbd6b94, 0x43a4e3663d7c19b2, 0x4e2fa0905c37,
+0x2e8da7e105483d65, 0xdb7f35ac4fd267d7, 0xdffd9e7d00d02be9, 0x2dce38bcdc2be3ed, 0xd040fac8ca898114, 0xf4afe7bb3202c84a, 0x54fbe20ad887,
+0xfa89bc450626484, 0xfca0834cd9af4af3, 0x4bcdfddddde1f16a, 0x8055303f5bb71c43, 0xb77839218236f266, 0x1dc7409ffa6e4715, 0xacd0b3c37d0f,
+0xbd1de2906a640dba, 0xf14542570b86065f, 0x72150bdb9e754ad5, 0x13a19b13d4435c10, 0x72a07935284e96a5, 0x500e4b74a102ede0, 0x1e7bea33d0294,
+0xe71d4235378fe416, 0xa6889c1103ddf512, 0x27692361dd32d348, 0xea130079e94a3ea6, 0x86538493b64342cd, 0xe440190caa58c397, 0x10cc1f929c9e5,
+0xbace3e32226b4e0b, 0x976c9f48ec944dc, 0x552dc7839f6542ee, 0xd298517f8a835538, 0x58a784dec207ea3c, 0x3896d7da9d66421c, 0x10be685d2f6d2,
+0x9b687fd8167e0f70, 0x4f9d9a0ae67e7f6f, 0x1546062e4fc06d0f, 0xbde72a31f2d40b3e, 0x92ea0cd3a8c520e4, 0x50bf207d41bc804e, 0x1897c0de48e37,
+0x6a984dfe9bc1e17d, 0xbb00b14dfae3b0f4, 0x86abd64dc9a136b5, 0x3d1a80e8eb10f37d, 0xe43e8adc07e4125e, 0x70852faba6693766, 0x92693a159f67,
+0xc598c3d08aadd6bb, 0xa1fca9c6f2dffde9, 0x9c2a288c63845b35, 0x24279d187654df45, 0xcd633fbc1f284b85, 0xc107346b749475af, 0x208a2cd27c830,
+0x728d8de463ba5363, 0x6b3ebd73d44bb0e7, 0x863f61d66d3eaaf4, 0xa4cbc49b712d616a, 0x5c5a663b7698f7ac, 0x51ce17bdba49effd, 0x1aa28e9f71241,
+0xfc5a4576e3a4f61c, 0xc1721e86dfba0899, 0x7db2078f36018113, 0xd90825cfe9291f, 0x428a32a566a3e78c, 0x5a0b9119430a2897, 0x224714ac6214c,
+0xccca4765cbc1a525, 0xf0d41aef87163ac8, 0x131976db2ed32903, 0x262b09a9b065ac39, 0x96cbf4ed33f06dbb, 0xdebacc8bf18343d5, 0x177975a7a43cd,
+0x877710d6d01b7fae, 0x656da222e3bcfd98, 0xafbc3b8112975838, 0xeee9a1756d3f334d, 0x27bc8c388315ac43, 0x7613925143ecebfb, 0x1c58817ef7d12,
+0x859834f3227e43be, 0x87dd69ce50bb08f3, 0xcb0b44100256cae7, 0xd1d695708c6b458a, 0x469b264ff7e4832, 0x6ca7469049350eeb, 0x1bd697b90f0ff,
+0xbed99dca413e2c06, 0xcdd27e86fe6b2013, 0x10e281d3c38eba8a, 0x693d54abc4bf6e88, 0xf59116c0bbf24c96, 0xbb4157bad9f0424e, 0xf7459e9146d8,
+0xb27c4f0dd94f4914, 0x2d82f00c4866f54b, 0x89d900cde8887954, 0xadc3ad2d09d7ef47, 0x1f006b96d3e7092a, 0x154ee48f4649876c, 0x581cb3514eca,
+0xa9250f5b09abd1b, 0xa31203a9594d44f4, 0x25768f95bff0cf41, 0x86d35490378ebaa0, 0x96d4bcbcde942aad, 0x10a25a1cca8cba83, 0xbb5d0dd3151a,
+0xd215d197e847af91, 0xfb83898ea11b4376, 0x288b8cd5fce32ba4, 0x71f861b8d5dc8eb, 0x660f4519057934a1, 0x9d76d38aec4c09eb, 0xc41760519c10,
+0x651717b22b087408, 0x731edb0e1e5a0e72, 0xe430616c43099e16, 0xd7c19049319b2e05, 0x1248603693226f6a, 0xa65b2af0eb232b15, 0x17c2779d1396c,
+0x1017e314634a173b, 0xe04b1f2f0b154d69, 0x2dd8fe7ca63d970d, 0x7b92c911628fc108, 0x974de1689bdbb97f, 0x575c91b46c3d7457, 0x751fde9147a1,
+0xa263ce0ad013ecc1, 0x9945a9f6b999dff6, 0x192dfc5990d3620a, 0xc276e8309a963925, 0xd0389cf412bf2ff9, 0x6c0f961fa73c62d2, 0x20cc6f49318c4,
+0x9ee7138023f4bd6b, 0xb420a8f4b3b9e0f3, 0x574d5a7572ef8517, 0x8fea4d104ad3d477, 0x6d30b80415786090, 0x92a564e662f0411d, 0x61b08cc6a2e6,
+0x9cfd6e8d5e8fd63f, 0x58030d0c3a90efb5, 0xecddf44524efade3, 0x83347327900587a4, 0xaf78c53132b1d9f2, 0x3ef49410ca192e03, 0x1825ff7ffd901,
+0x78b6bd81f9288f1e, 0x3931b5d608401885, 0x96bacd214dddc255, 0xcf9108c7011b90e5, 0xebde99dc053f80bb, 0x80f9e2729ecbbff9, 0x167a2810c4c8b,
+0x5b7b4a155b7d9f5b, 0x95149eae6bc2f8a0, 0xd93aaac7e42a138b, 0x6a3ba1a0e0dfbfaf, 0x166bc3d437c55282, 0x408409f6dc2d80f, 0x10c3d0f51584a,
+0xec75db03e8414bd0, 0xc2e7ed4314e0c591, 0xea13158fd45d7c43, 0x598f20dc73a5ba0a, 0x6f6bd329acbd8afc, 0x530dc2bd67d7664c, 0x19c0c2b21c621,
+0x768336a147bf31c1, 0x81eda8a711e997d5, 0x258e2e70b7e20199, 0x86c146c63cd56d8a, 0xb75ddf19e0dbca55, 0xe9d1283222ae8396, 0xfce68807326c,
+0x4295502f56cbf57, 0x924d35fd371a655a, 0xf57f6bf7e2c8eb6f, 0x5c636e37978ec684, 0x6b13f03dffe146ef, 0x94a32358d7f5e788, 0x15a5208d2e721,
+0xef12dee3971da17c, 0xfb85142c4d5f1091, 0x283450121165afa4, 0x84291b86a0ddc756, 0x9e6906cd8b7ee9b, 0x54b7000cd1eb9691, 0x21f17d941594d,
+0x490c3bc05d543a21, 0x6943570876257b65, 0x6c4ffbf22dff7c72, 0xe80fc20fd18fc6e0, 0x498719ff98cdcd51, 0xcf1e6c51debe0793, 0x8522a0299ddf,
+0xa2292f7dfb15ee9a, 0x7b4dfcddbb97e3ec, 0x2c68babf546afcd5, 0xbee36f39199079e1, 0x29e28b294b032d5d, 0x773358acdc938ed, 0x222fea077f6f1,
+0x35bbddaaf46d9904, 0x6231e2681bb6492, 0xce5964f0a1ff1029, 0x7f465a652d426ffc, 0x42ce59666fdf41dd, 0x41a7f77212eda98e, 0xf793385df2c4,
+0x69eb84a06d9e7559, 0x2194ff18d73a1f77, 0x46d3d740c3f31d1e, 0xcb8f7ae97d52dcc3, 0x5167ddbc6d324367, 0x1cce39a541626593, 0xa401f7190c85,
+0x53619a71acc29f04, 0x858e3b88cef869dc, 0x895c14797fd0b6a1, 0xdf196f4fe53ce605, 0x9b389cb3cae507e0, 0x7f4a883e827106e6, 0x16ffc6b33bc1f,
+0x509d41f5c8b909aa, 0xe11e94936bb932de, 0xe7bc3d377b1a1301, 0x3bb236c79fce2bbe, 0x78569e8f69ae6181, 0xa58e0c69318cbe06, 0x214c71ea2e913,
+0xccede6f2b7a3d341, 0x569191ae82f747f2, 0xf25fbb5895ef34bc, 0x7a80be602c325d4a, 0xa039a818a22815e7, 0x975522d5e08d8117, 0x1bc0bd232c8d5,
+0xe78806ce877d68ce, 0xc87f651a412e3409, 0x648a991d90f8020b, 0x8cce5f5aadd780e1, 0x501eca1478b2adcd, 0x5b99821171f7f0c6, 0xaa843363fbdd,
+0x97b6db3b0a507760, 0xfb59c9ea2266d0b7, 0xfad0d01cbed14d1, 0x2c07125bc746720c, 0x9fce2a6516d07157, 0x837ec4e3359ec027, 0x56c6ff3dcecc,
+0x1662894c098074ba, 0xc8f113977337c80e, 0x386d9f510ac42003, 0xd03de6a61865996e, 0x5f1569e5498bebb5, 0x31cfe1aecfdc9af7, 0xf6c83dd3394c,
+0x686e3fd976142b35, 0xb916c238e5096a69, 0x2f8beb9fced9004f, 0x69c4f624bb0799a9, 0x8c1ea094a569af5a, 0xdd093cf6683351c9, 0x9a7793cc02b7,
+0xb3228d1380b99832, 0x3fddbdc0bbb4f8b4, 0x7d2dd7a1bb79a624, 0xe7403c02b966e6b3, 0x1903f416c4093206, 0x5f08f5b9f26e5b81, 0x4f554d5b7a8f };
+
+#else
+    #error -- "No window tables for this PRECOMP_WINDOW, generate them with precomp_gen -w"
+#endif
+#endif
@@ -17,6 +17,7 @@ __inline void mp_sub503_p2(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision subtraction with correction with 2*p, c = a-b+2p. 
     
     mp_sub503_p2_asm(a, b, c); 
+    OPCOUNT(SUB, 1);
 } 
 
 
@@ -24,6 +25,7 @@ __inline void mp_sub503_p4(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision subtraction with correction with 4*p, c = a-b+4p. 
     
     mp_sub503_p4_asm(a, b, c);
+    OPCOUNT(SUB, 1);
 }
 
 
@@ -33,6 +35,7 @@ __inline void fpadd503(const digit_t* a, const digit_t* b, digit_t* c)
   // Output: c in [0, 2*p503-1]
 
     fpadd503_asm(a, b, c);
+    OPCOUNT(ADD, 1);
 } 
 
 
@@ -42,6 +45,7 @@ __inline void fpsub503(const digit_t* a, const digit_t* b, digit_t* c)
   // Output: c in [0, 2*p503-1] 
 
     fpsub503_asm(a, b, c);
+    OPCOUNT(SUB, 1);
 }
 
 
@@ -97,6 +101,15 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
     mul503_asm(a, b, c);
 }
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+
+    UNREFERENCED_PARAMETER(nwords);
+
+    mul503_asm(a, a, c);
+}
+
+
 
 
 void rdc_mont(digit_t* ma, digit_t* mc)
@@ -51,6 +51,7 @@ const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x3353B596D45A95A6, 0xDF7E0
                                                      0xD71E78E25FA4DB2F, 0x64BECFBE41708879, 0x103FF021EF7BF9, 0x2695BB8221E83B,     // XRA0
                                                      0xA08787E922A1030, 0x8D34581F64BCE547, 0x2FA5BED41306271A, 0xEC24812ABD206DCF,
                                                      0x978FA888C3CC6366, 0x2BFF991CDB7CE058, 0xA0BCCC1A447CF056, 0x2425429A072D82 }; // XRA1
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x5c4bac1c6e840305, 0xa984ab92669ad911, 0x91ee061e74276575, 0xa9c3cccc2c75a726, 0x4b0ce8e216669222, 0x2118c382ecc537d0, 0x187fb82e4dac4d18, 0x1af821c7998002 ,
 0x192a8592882d62ca, 0xdb700d7d4277d249, 0xebdce367da936169, 0x725ffea7788dc5c3, 0xdbbf752e2a552f7, 0xa278c18eb4b255b2, 0x9953e223fd933aee, 0x3fb2a368f7a25c,
@@ -301,6 +302,7 @@ const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x106c2c06f812a9b8, 0x63b4b940a046b7f7, 0x1db6dae6ced973c6, 0x97031a200af9921f, 0x69328704b44e624a, 0x7edcb1ed8e01f534, 0x51d4b65f4fbffc9, 0x1cbe3e14f2e63a ,
 0x346591a819688b7c, 0x5e15eeeb0c73f8cb, 0xedd8dc80b2924a85, 0x94678d1a67fc2c40, 0x19ca0b682b4e4767, 0x973a04f5af354bba, 0x9a630f1f6dca8244, 0x2023d24f3c49b9 ,
 0x300b65d4d9ef63a9, 0x8eea540e8c21d69, 0xcd5e64e032de8418, 0x8196ba7818a6b922, 0x4017a124120cec66, 0x9b22eec7dc5daba1, 0x614fbebfbaf9d825, 0xd243931232ef6};
+#endif
 const uint64_t YQA4[NWORDS64_FIELD]              = { 0xc7670a44560f938b, 0xab8547b43c3479d3, 0x3d569f5772456bb6, 0x17b5b53c0fa23b31,
                                                      0x38210235af583ade, 0x49a527ddb6cfefc7, 0x76288d14f23f037, 0x1620c022598276};
 const uint64_t DBL_QA[2 * NWORDS64_FIELD]        = { 0x273f6c464cb9ab1a, 0x83722dbae9836b36, 0x7236dd158d1a1bbf, 0xbe84ed2fd6fc9b11,
@@ -331,6 +333,7 @@ const uint64_t B_gen[6 * NWORDS64_FIELD]      = { 0xB810321963CF561F, 0xACA61287
                                                   0x6E3DEF7C8A5A47D2, 0x12D9AF90F92FC868, 0xCE33D50FC931894B, 0x2927354E05ED037C,
                                                   0x4864AD1D8B6E4E56, 0x2C6BB7E4CD4284DD, 0x50A30A93843DDC28, 0x38195667C39958,   // XRB0
                                                   0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }; // XRB1
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0x4256C520FB388820, 0x744FD7C3BAAF0A13, 0x4B6A2DDDB12CBCB8, 0xE46826E27F427DF8, 0xFE4A663CD505A61B, 0xD6B3A1BAF025C695, 0x7C3BB62B8FCC00BD, 0x3AFDDE4A35746C,
 0x440192590061240E, 0x60C942451EC3E20D, 0x2195638E3B7632CA, 0xBA84AC322AA59D16, 0x3751CBF97048E02D, 0x6A583E4C816EAC44, 0x7A984D4F477762C1, 0x27B5AB2E503D63,
@@ -591,6 +594,7 @@ const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0x70cc452356dd28fd, 0x43b3a37d9b81df98, 0x5a910108b606917b, 0xc8df839ae666de64, 0xf1bd94fd302d0277, 0xd27d44dadaf1f0dc, 0xa81a37d33b0098ab, 0x3b29730f8a1b6b ,
 0xcf7e12af56e48ffd, 0xbd4db97fd2ca22d4, 0x44f418dc0d506ead, 0x93298833378337da, 0x8759c50e74b8e55b, 0xed87c192918c73f7, 0x9990ed37b810c1be, 0x3ddb5ed76cc2ad
 };
+#endif
                                                                                                                                        // Montgomery constant Montgomery_R2 = (2^512)^2 mod p503
 const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x5289A0CF641D011F, 0x9B88257189FED2B9, 0xA3B365D58DC8F17A, 0x5BC57AB6EFF168EC,
                                                      0x9E51998BD84D4423, 0xBF8999CBAC3B5695, 0x46E9127BCE14CDB6, 0x003F6CFCE8B81771 };                                                   
@@ -599,6 +603,34 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000003F9, 0x00000
                                                      0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953 };
 
 
+#if defined(LANES_AVX512IFMA)
+// Constants of the lane-parallel arithmetic (fpx_x8.c) in limbs of 52 bits: p503, 2*p503, 4*p503, p503 + 1, and p503*2^51, which is
+// added from limb NWORDS52_FIELD-1 of the products to keep them positive
+const uint64_t p503_r52[NWORDS52_FIELD]            = { 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0x0ABFFFFFFFFFF, 0x085BDA2211E7A, 0x6C87B7E7DAF13, 0xDA77A4D01B9BF,
+                                                       0x11E1E6045C6BD, 0x00004066F5418 };
+const uint64_t p503x2_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFE, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0x157FFFFFFFFFF, 0x10B7B44423CF4, 0xD90F6FCFB5E26, 0xB4EF49A03737E,
+                                                       0x23C3CC08B8D7B, 0x000080CDEA830 };
+const uint64_t p503x4_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFC, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0x2AFFFFFFFFFFF, 0x216F6888479E8, 0xB21EDF9F6BC4C, 0x69DE93406E6FD,
+                                                       0x4787981171AF7, 0x0001019BD5060 };
+const uint64_t p503p1_r52[NWORDS52_FIELD]          = { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x0AC0000000000, 0x085BDA2211E7A, 0x6C87B7E7DAF13, 0xDA77A4D01B9BF,
+                                                       0x11E1E6045C6BD, 0x00004066F5418 };
+const uint64_t p503x2e51_r52[NWORDS52_FIELD+1]     = { 0x8000000000000, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0x055FFFFFFFFFF, 0x842DED1108F3D, 0xB643DBF3ED789,
+                                                       0xED3BD2680DCDF, 0x08F0F3022E35E, 0x000020337AA0C };
+// Montgomery constants of the lane-parallel arithmetic: Montgomery_R2_r52 = (2^520)^2 mod p503 and Montgomery_one_r52 = 2^520 mod p503
+const uint64_t Montgomery_R2_r52[NWORDS52_FIELD]   = { 0xF641D011FFC1E, 0xFED2B95289A0C, 0x17A9B88257189, 0xA3B365D58DC8F,
+                                                       0x152B6EFF168EC, 0x265B33A6080DA, 0x72C5A0A8D1124, 0x6D7493F8D6976,
+                                                       0x9D8951AABA0C7, 0x0000176B7F50A };
+const uint64_t Montgomery_one_r52[NWORDS52_FIELD]  = { 0x000000003F99A, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0xC880000000000, 0x132D6E600D5E0, 0x8CC349BE21258, 0x46481D20CCCB1,
+                                                       0xD3544E37E38E5, 0x00003DBF3CA7A };
+#endif
+
+
 // Fixed parameters for isogeny tree computation
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 
@@ -615,6 +647,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 
 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
            
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(pre_for_Alice,        (OALICE_BITS - 1) * NWORDS64_FIELD)                 \
+    X(pre_for_Bob,          (OBOB_BITS + 5) * NWORDS64_FIELD)                   \
+    WINDOW_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy503
 #define fpzero                        fpzero503
@@ -639,24 +677,65 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2div2                       fp2div2_503
 #define fp2correction                 fp2correction503
 #define fp2mul_mont                   fp2mul503_mont
+#define fp2mul_add_mont               fp2mul_add503_mont
+#define fp2mulsub_mont                fp2mulsub503_mont
 #define fp2sqr_mont                   fp2sqr503_mont
 #define fp2inv_mont                   fp2inv503_mont
 #define fp2inv_mont_bingcd            fp2inv503_mont_bingcd
 #define fpequal_non_constant_time     fpequal503_non_constant_time
 #define mp_add_asm                    mp_add503_asm
+#define mp_addx2_asm                  mp_add503x2_asm
 #define mp_subaddx2_asm               mp_subadd503x2_asm
 #define mp_dblsubx2_asm               mp_dblsub503x2_asm
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp503
 #define crypto_kem_enc                crypto_kem_enc_SIKEp503
 #define crypto_kem_dec                crypto_kem_dec_SIKEp503
+#define crypto_kem_keypair_x8         crypto_kem_keypair_x8_SIKEp503
+#define crypto_kem_enc_x8             crypto_kem_enc_x8_SIKEp503
+#define crypto_kem_dec_x8             crypto_kem_dec_x8_SIKEp503
+#define crypto_kem_enc_concurrent     crypto_kem_enc_concurrent_SIKEp503
 #define random_mod_order_A            random_mod_order_A_SIDHp503
 #define random_mod_order_B            random_mod_order_B_SIDHp503
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp503
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp503
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp503
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp503
+#define tables_load                   tables_load_p503
+#define tables_unload                 tables_unload_p503
+#define sidh_set_ladder               sidh_set_ladder_p503
+#define sidh_get_ladder               sidh_get_ladder_p503
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp503
+#define EphemeralKeyGeneration_B_ladder EphemeralKeyGeneration_B_ladder_SIDHp503
+#define EphemeralKeyGenerationAgreement_A EphemeralKeyGenerationAgreement_A_SIDHp503
+#define crypto_kem_keypair_ladder     crypto_kem_keypair_ladder_SIKEp503
+#define crypto_kem_enc_ladder         crypto_kem_enc_ladder_SIKEp503
+#define crypto_kem_dec_ladder         crypto_kem_dec_ladder_SIKEp503
+#define sidh_opcount                  sidh_opcount_p503
+#define keypool_start                 keypool_start_p503
+#define keypool_stop                  keypool_stop_p503
+#define keypool_stats                 keypool_stats_p503
+#define sidh_workers_stop             sidh_workers_stop_p503
+#define crypto_kem_keypair_pooled     crypto_kem_keypair_pooled_SIKEp503
+#define EphemeralKeyPair_A_pooled     EphemeralKeyPair_A_pooled_SIDHp503
+#define EphemeralKeyPair_B_pooled     EphemeralKeyPair_B_pooled_SIDHp503
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#else
+    #include "P503_window_tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
+#include "../isogeny_mt.c"
 #include "../sidh.c"    
-#include "../sike.c"
\ No newline at end of file
+#if defined(LANES_AVX512IFMA)
+    #include "../fpx_x8.c"
+    #include "../ec_isogeny_x8.c"
+    #include "../sidh_x8.c"
+#endif
+#include "../fpx_x2.c"
+#include "../ec_isogeny_x2.c"
+#include "../sidh_x2.c"
+#include "../sike.c"
+#include "../keypool.c"
\ No newline at end of file
@@ -53,7 +53,7 @@ const uint64_t A_gen[6*NWORDS64_FIELD]        = { 0x3353B596D45A95A6, 0xDF7E0A94
                                                   0xD71E78E25FA4DB2F, 0x64BECFBE41708879, 0x103FF021EF7BF9, 0x2695BB8221E83B,     // XRA0
                                                   0xA08787E922A1030, 0x8D34581F64BCE547, 0x2FA5BED41306271A, 0xEC24812ABD206DCF,  
                                                   0x978FA888C3CC6366, 0x2BFF991CDB7CE058, 0xA0BCCC1A447CF056, 0x2425429A072D82 }; // XRA1
-pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
+const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x5c4bac1c6e840305, 0xa984ab92669ad911, 0x91ee061e74276575, 0xa9c3cccc2c75a726, 0x4b0ce8e216669222, 0x2118c382ecc537d0, 0x187fb82e4dac4d18, 0x1af821c7998002 ,
 0x192a8592882d62ca, 0xdb700d7d4277d249, 0xebdce367da936169, 0x725ffea7788dc5c3, 0xdbbf752e2a552f7, 0xa278c18eb4b255b2, 0x9953e223fd933aee, 0x3fb2a368f7a25c,
 0xc173150294aac4c9, 0x803f8c2c90b4683b, 0xdcbd2583c772b76e, 0xb53adee9f46de720, 0xadb096f32bab1798, 0x495e13a2edd421fb, 0xb8c7baf9a8bf8446, 0xd5f08d7279f36 ,
@@ -302,25 +302,25 @@ pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0xc827ca9488a1e71, 0xfab7cb70e04f19b1, 0xe9f451c9f7826fe0, 0xca12cf8d1b5d24da, 0x19ebd55b1467cb00, 0xbb2af2639980cb91, 0xbc10b8c781602ec6, 0x3c088477e1c861 ,
 0x106c2c06f812a9b8, 0x63b4b940a046b7f7, 0x1db6dae6ced973c6, 0x97031a200af9921f, 0x69328704b44e624a, 0x7edcb1ed8e01f534, 0x51d4b65f4fbffc9, 0x1cbe3e14f2e63a ,
 0x346591a819688b7c, 0x5e15eeeb0c73f8cb, 0xedd8dc80b2924a85, 0x94678d1a67fc2c40, 0x19ca0b682b4e4767, 0x973a04f5af354bba, 0x9a630f1f6dca8244, 0x2023d24f3c49b9 ,
-0x300b65d4d9ef63a9, 0x8eea540e8c21d69, 0xcd5e64e032de8418, 0x8196ba7818a6b922, 0x4017a124120cec66, 0x9b22eec7dc5daba1, 0x614fbebfbaf9d825, 0xd243931232ef6 };
-const uint64_t YQA4[NWORDS64_FIELD]           = { 0x898e8f7686f2f4e6, 0xe21377adf1509405, 0x2c278c05c90d38f8, 0x9e033cfccf292cb5,
-                                                  0xeb1c3830c73809d3, 0x64de17327298ff7b, 0x1e05dc4b6d8cc};
-const uint64_t DBL_QA[2 * NWORDS64_FIELD]     = { 0x6448cb5bd976250e, 0x3092cf8c8803d8b4, 0x2542331c81c2c2f8, 0xc086e30db24aa32,
-                                                  0xd1b7f3e5532ee315, 0x226067da42cd56db, 0x1dea86eb48d8a,
-                                                  0x414795f6a70d543e, 0xdc7d2e0b9229a814, 0x679cd711c5b2ac8e, 0xcc92a943030f0d18,
-                                                  0xc2bb3cda074e0076, 0x19332e71dc423ba4, 0x1c95a2fc045dd};
-const uint64_t YPA[2 * NWORDS64_FIELD]        = { 0x9b989be60cff0d15, 0x8b80a32171813f53, 0xf4f067606a56228e, 0x48f8237e159577b0,
-                                                  0x42529574b9e74156, 0xd8d26313f4aa9f9c, 0x1279ac6bc876c,
-                                                  0x9597544cbe9d88df, 0x13801f440df32748, 0xe4ecaff9c15d0ceb, 0x7867d92eb045a646,
-                                                  0x2399062ba8c64ef, 0xe9258c0bdf8bbff7, 0x1ce4bbf872205};
-const uint64_t PplusQA[4 * NWORDS64_FIELD]    = { 0xa26194ab4bd1a16f, 0xcfcd9f7f04d5ab10, 0x1bb4a7c04c37482c, 0x71dee733632da36d,
-                                                  0x7335784b5ecf957f, 0x66ae2381533a7f09, 0x232bffe6fa42f,
-                                                  0x9f5341a276630595, 0x7d53aa5aa91a5dd0, 0xbc8273d537c02394, 0x9bb6e8d4e0abc121,
-                                                  0xaa2ba1f79eb6c5e1, 0xbd0ab574e9a88a82, 0x8cfbfc0b6fe5,
-                                                  0xda1e960ae3e5c4e8, 0x6effc0350686260f, 0xbd6eaccf62467b5, 0x65939cfb1161e478,
-                                                  0x5d0ed5901e82ddcb, 0xda8be7ee6d455d94, 0x19017b8ce77b2 ,
-                                                  0xd30ece1ea3e19f40, 0x3abb724e9467b8fd, 0xc34cec4a1f9f85d4, 0xe0b40f984e683dc0,
-                                                  0x684c9b19b4180b6e, 0x7314c90c41f2842e, 0xe0745aab36b4};
+0x300b65d4d9ef63a9, 0x8eea540e8c21d69, 0xcd5e64e032de8418, 0x8196ba7818a6b922, 0x4017a124120cec66, 0x9b22eec7dc5daba1, 0x614fbebfbaf9d825, 0xd243931232ef6};
+const uint64_t YQA4[NWORDS64_FIELD]              = { 0xc7670a44560f938b, 0xab8547b43c3479d3, 0x3d569f5772456bb6, 0x17b5b53c0fa23b31,
+                                                     0x38210235af583ade, 0x49a527ddb6cfefc7, 0x76288d14f23f037, 0x1620c022598276};
+const uint64_t DBL_QA[2 * NWORDS64_FIELD]        = { 0x273f6c464cb9ab1a, 0x83722dbae9836b36, 0x7236dd158d1a1bbf, 0xbe84ed2fd6fc9b11,
+                                                     0xf4fac85bba91e9b4, 0x783d71c36f23ae76, 0x6fc94cf24bda330a, 0x3929a6320c9596,
+                                                     0x3e3209393cb32a2, 0x689964ccab348a84, 0x74471effced8819b, 0x661d7240b28e2790,
+                                                     0x71aae7baae2179ca, 0x5da64f579d150d5b, 0x17919259b69ea954, 0x77328aa89bbc7 };
+const uint64_t YPA[2 * NWORDS64_FIELD]           = { 0xbc88bb85404378e5, 0x61071195bc44bf8f, 0xc92d13994ce9b8b3, 0x9ed615392dcf6ca2,
+                                                     0xc4a95165fb25bfda, 0xeeea8545ebeaec62, 0xac09c1c3e91b41fd, 0xb43ac79a90a0c,
+                                                     0xe8b38a79e90eaadb, 0x840b284661ccfc39, 0x6d5091432c311ad, 0xdafbd9cd646033b,
+                                                     0x3faf77bc98339af0, 0x75f0c7a7aa5d03a3, 0xd188da98de124c6a, 0x2780b2b7b1c9cc };
+const uint64_t PplusQA[4 * NWORDS64_FIELD]       = { 0x1482ea2c7a8f5fa0, 0xb42c8b9c007e5fe5, 0xcfcff2625c69e7fd, 0x8334c3f384c268f5,
+                                                     0xd71e78e25fa4db2f, 0x64becfbe41708879, 0x0103ff021ef7bf9, 0x2695bb8221e83b,
+                                                     0xf5f787816dd5efcf, 0x72cba7e09b431ab8, 0xd05a412becf9d8e5, 0xbfdb7ed542df9230,
+                                                     0x7b78b3515e458439, 0xef9c5daba0019d56, 0xbf88faa395fab479, 0x1c41b2a779f09b,
+                                                     0x4f151d6b2697df41, 0xf2286438aadddb71, 0x62378cc5be23004f, 0x822807933e84ad42,
+                                                     0x36db6c363e3d2500, 0x95941f4db77237b2, 0xfd917b6f231a9e7c, 0x1e1e9b5aa4f411,
+                                                     0xb3d457620c43d607, 0x96c95df412038dbe, 0xf4e14d69d3ef397c, 0x3ff63724a560957,
+                                                     0xbde046fe40105145, 0x5762a00b1b2c71f, 0x97e2dfed61620d74, 0x1c4742befd3c };
 /* Basis for Bob on A = 6, expressed in Montgomery representation */
 const uint64_t B_gen[6*NWORDS64_FIELD]        = { 0xB810321963CF561F, 0xACA612873FBC647F, 0xE5C29CB78215B634, 0xB277ACABE764F907, 
                                                   0x76DBA8FCCDFF4721, 0x1B4E6541441EB543, 0xDAAB92E8B2DD0517, 0x1ECAA65407E4C9,   // XPB0
@@ -697,28 +697,6 @@ const unsigned int strat_Bob[MAX_Bob - 1] = {
 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2,
 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
 
-// Fixed traversal strategies for Pohlig-Hellman discrete logs
-const unsigned int ph2_path[PLEN_2] = {
-#ifdef COMPRESSED_TABLES
-    #ifdef ELL2_TORUS
-        #if W_2 == 5
-            0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 13, 13, 14, 14, 15, 16, 17, 18, 18, 18, 19, 20, 20, 21, 22, 23, 24, 25, 25, 25, 25, 26, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 35
-        #endif
-    #endif
-#endif
-};
-
-const unsigned int ph3_path[PLEN_3] = {
-#ifdef COMPRESSED_TABLES
-    #ifdef ELL3_FULL_SIGNED
-        #if W_3 == 3
-            0, 0, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 13, 13, 13, 13, 14, 15, 16, 17, 18, 19, 19, 19, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 28, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 34
-        #endif
-    #endif   
-#endif
-};
-
-
 // Entangled bases related static tables and parameters
 
 // Constants u and u0 where u = u0^2 in F_{p^2} \ F_p used in entagled basis generation
@@ -871,6 +849,26 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 {0x8894D7E86C5358CF,0xE01ED56C2E374D80,0x1EB04AACFBB0B60D,0x1B0F1031360154CD,0x52257CF78935DF2,0xD1759C3E61E7823C,0xC5CBD367AD3EB0AB,0x377C52E4424CF4,0xED5FFE6B5FB024BD,0x65B8965C7A3F1BB,0x61A0E4FB6BAAF40F,0xD8ACB4A3CC9A6C24,0x38FAAD404A5D6211,0xF59F595458B10D72,0x13FDB0B2371936A0,0x1934F680EC8F88},
 {0xF6DC60A5C5734661,0x9CD9E9A6DA083A88,0xEDA465D0EAA7F9BB,0x87FEE132D788E4CA,0x94D57ED92F0D0A7B,0xA157AC0056BDBFE8,0x62DAF28EE0E30FC9,0x10E9FA4557999D,0x78942F9DE083A353,0x5FDAC52AEBA63CE5,0x905BC434EA6102CF,0x9CC2E0667372C509,0xE22094C33879AFDC,0x820B3999B77E5E28,0x7076A18C8D100A7D,0x1B55229ADA2623} };
 
+// The ell=3 Pohlig-Hellman tables depend on whether W_3 divides eB
+#if (OBOB_EXPON % W_3 == 0)
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T,                DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#else
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T1,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)        \
+    X(ph3_T2,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#endif
+
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(T_tate3,              (6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD)        \
+    X(T_tate2_firststep_P,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_P,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(T_tate2_firststep_Q,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_Q,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(ph2_CT,               DLEN_2 * (ELL2_W >> 1) * NWORDS64_FIELD)            \
+    PH3_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy503
 #define fpzero                        fpzero503
@@ -895,11 +893,14 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2div2                       fp2div2_503
 #define fp2correction                 fp2correction503
 #define fp2mul_mont                   fp2mul503_mont
+#define fp2mul_add_mont               fp2mul_add503_mont
+#define fp2mulsub_mont                fp2mulsub503_mont
 #define fp2sqr_mont                   fp2sqr503_mont
 #define fp2inv_mont                   fp2inv503_mont
 #define fp2inv_mont_bingcd            fp2inv503_mont_bingcd
 #define fpequal_non_constant_time     fpequal503_non_constant_time
 #define mp_add_asm                    mp_add503_asm
+#define mp_addx2_asm                  mp_add503x2_asm
 #define mp_subaddx2_asm               mp_subadd503x2_asm
 #define mp_dblsubx2_asm               mp_dblsub503x2_asm
 #define random_mod_order_A            random_mod_order_A_SIDHp503
@@ -911,12 +912,30 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp503_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp503_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp503_compressed
+#define tables_load                   tables_load_p503_compressed
+#define tables_unload                 tables_unload_p503_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp503_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp503_Compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp503_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp503_compressed
+#define sidh_workspace_size           sidh_workspace_size_p503_compressed
+#define sidh_set_checkpoint           sidh_set_checkpoint_p503_compressed
+#define sidh_get_checkpoint           sidh_get_checkpoint_p503_compressed
+#define sidh_set_dlog_threads         sidh_set_dlog_threads_p503_compressed
+#define sidh_get_dlog_threads         sidh_get_dlog_threads_p503_compressed
+#define sidh_workers_stop             sidh_workers_stop_p503_compressed
 
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
 #include "../compression/torsion_basis.c"
-#include "P503_compressed_pair_tables.c"
+#if !defined(TABLE_BUNDLE)
+    #include "P503_compressed_pair_tables.c"
+#endif
 #include "../compression/pairing.c"
 #include "P503_compressed_dlog_tables.c"
 #include "../compression/dlog.c"
@@ -0,0 +1,3772 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the windowed fixed-base key generation of SIDHp503
+*           Generated by precomp_gen -w 4, see tests/precomp_gen.c for their contents
+*********************************************************************************************/
+
+#if defined(PRECOMP_WINDOW)
+#if (PRECOMP_WINDOW == 4)
+
+const uint64_t window_for_Alice[(1 + WINDOW_LEN_ALICE * WINDOW_POINTS) * 2 * NWORDS64_FIELD] = {
+0x5c4bac1c6e840af8, 0xa984ab92669ad911, 0x91ee061e74276575, 0x65c3cccc2c75a726, 0xff9ac1e542124feb, 0xa84e07d53e44211b, 0xcdd4e0fea8992acc, 0x28888a1237148a,
+0x7b05f777caad354c, 0xc45ba91b6379f9e5, 0x825ea769e13469c1, 0xf1f6ae97cfa231c1, 0xe0502192e0aacb5b, 0x5512646bfe380a58, 0x8815f4496c9afb64, 0xc9a0f22b98b70,
+0x273f6c464cb9b30e, 0x83722dbae9836b36, 0x7236dd158d1a1bbf, 0xce84ed2fd6fc9b11, 0x96804584c42bbfdc, 0xe3d6bf4d45241a13, 0xc4d8af04cc4f6bee, 0x653193b290c00,
+0x3e3209393cb32a2, 0x689964ccab348a84, 0x74471effced8819b, 0x661d7240b28e2790, 0x71aae7baae2179ca, 0x5da64f579d150d5b, 0x17919259b69ea954, 0x77328aa89bbc7,
+0x85c7ca3e9eadb8ee, 0x97873829844cf9a5, 0x96510e240e86b156, 0xeede7282e40ee2ea, 0x834790477c5d787e, 0x3b30922b819fbb12, 0x503cbcff9f6eea85, 0x310db49979557b,
+0xb19d04e98b392c8e, 0xd2e39bff2a5e96f1, 0x1360f52ae4a91741, 0xabe9e841f06bd82f, 0x9b0f10004369da05, 0x9773a80a2d5b4968, 0x150f402f78ba17ea, 0x267889edda82d1,
+0x5dca970710e081ed, 0xf2ab1e374bcfc81c, 0x67f7a79c5a78c0c7, 0xb368923f64bae87b, 0x4a4b3558aafb0dcf, 0x8bac751888189696, 0x955c0ba1ed977e43, 0xe857f6fa10a4b,
+0x2b75fc785f1a303f, 0x54baba3c4e2cc6b9, 0xfaca184fe9cc5260, 0x32a3eca9a5cc1dd8, 0xb0ee85a09f62a2ab, 0x3c1366e8270e104e, 0xaec745176c66da60, 0x336eabcfed17ae,
+0xc1bd72b10da4fa9, 0x84a26f4ee4496fa, 0x34589b9528ecbf9c, 0xb6222ba5eece380, 0x27a5fa02ead7f3f8, 0x7663fdf274804b47, 0x4954c526afa4a7e1, 0x36648be8a9460,
+0xcb251808fd734f84, 0xea1db9dba11457a8, 0xbe247a8e2ee186d, 0x275fe19b2eb7f43, 0xdbc4d02713e06c40, 0x5c7d6aea148b13dd, 0x657e84e0cbdab22b, 0x2432f09dc4483b,
+0xccc477a4f34684a7, 0x7b649da33dfede29, 0x112c94d8a36dffcd, 0x847da2d8ad581d10, 0xffb3710fab65ebec, 0x4898b2806a3d1138, 0xb953d273f66b7087, 0x1d62b58671d8ed,
+0x504e08130da31f24, 0x16d74b0b99bbabd6, 0x697c14d34beb1c4a, 0x5f21279e86117e09, 0x16687010e5a0842a, 0xf2dd62139b5eed44, 0x6049773371d53e2f, 0x5a677e2f66cc6,
+0xdfaeab343b717670, 0xb091e5fd2b6c3e6a, 0x724b4fd23f86b589, 0xbac60c2090b8a2c3, 0xef812398b1464260, 0xf6bafff796f064a8, 0x5511fe113f08ee8d, 0x2f337cf9939a51,
+0xf3c528253e7d415, 0x6a21b1c56936e6ca, 0x1a5181e62eb67b4d, 0xed1e6e0dc5356932, 0xc232a3a8145383c0, 0xb3dec964835ee60d, 0xd5ba0fcf3acc0c9c, 0x20ed9acdedccd3,
+0x28bee1a9fb3399f0, 0x33619cc43935d84a, 0xc554e20e7cb1a8a7, 0x542fac25eb6b1ef5, 0x34cfcc08e6e2c74, 0x910ae977f3564623, 0x188e15b26b380b43, 0x15fea9b84910bd,
+0xaae58dd54f0ac8ad, 0x7c4c3462683d8616, 0xe5e8d7107d816774, 0xc592dbdc4d4b2849, 0xa8d49247255cfb8, 0x45dfcf55aca951fa, 0x5915bc6c043fc911, 0x40ae18d4d0f1b,
+0xe01b02b0ffabf430, 0xed5f88d2590604a9, 0xada943fa1dd8403f, 0x5e330d59dc77889c, 0x139080687dc5e98f, 0x1cf2b81cd54f9fe8, 0x4bb02bf0902937a0, 0x188104988b2cb4,
+0xb7d8cacdd61a57e7, 0xb1aff074d0533e5d, 0x6a5c95740929d714, 0xbab26bb2a69e78a5, 0xf277141029706195, 0xc9aef881adc3ba1e, 0xe5715b4d01ccc2b, 0x176a061cc47cc7,
+0x5c30c1273b967b08, 0xfdb2eb1b4971fda4, 0xc433cd971574f703, 0xa4304a16e5f77abe, 0xe6bf64faf007b216, 0x64d9e006558c8584, 0xf5badaf1b20f3b36, 0x35fd4076bc4826,
+0xc4a34d548542d608, 0x9d3440713ae21a9c, 0x721cc4f9e9a1dd76, 0x62877000d6997506, 0x2ea95b84639626a9, 0xe619072020b8e3b9, 0x37622690ba20bbb0, 0x34746d1f868c92,
+0x76f8878cab27a07a, 0x7d60e7816ee6add9, 0xfdfe7105e0eb94b1, 0xa0adbcb3b02795c9, 0x1a6b935ad2ec51cd, 0x1fd6aaf2c3eeeb7d, 0xf871dda6c80c8225, 0x3ceab3ae815fa0,
+0x48f38f481340aefe, 0x65cec3cd1e866cf, 0x3695c204df83eb53, 0xe43073f2421d7f17, 0xcf875c18be1191a8, 0xb6271c780075507a, 0x529c4bda94ac66e2, 0xbc314fac6bba8,
+0x543e8ed2257aca11, 0x3b5c06c39ffba443, 0x5e30d48d7aeb821b, 0x207573d4ebc5036c, 0x4c586421a4d504bc, 0xf7977d315092a989, 0x45fe333fe749cf5c, 0x34a876e3dce157,
+0x3775b0998b4bf8b6, 0x1e195d130b617f0d, 0x244be9c4e92d5095, 0xee9614e7a7fdd1a8, 0x7bd83a2855591770, 0xc3dbec73ce9f942f, 0x5a2f1629d7786723, 0x154f7e9cf0fb43,
+0xd24f9238a56afa7b, 0x2b596d8f07f7004, 0x30e6033b5ba69010, 0xf96da8247d8d1f49, 0x6128b07c08a37e3b, 0x43d348a2e977d705, 0x1e836132b477284c, 0x401f2917835c92,
+0x985a4ad89279d92f, 0x8b668f8a6cac4fea, 0x9d7ceb847040d714, 0xb5d8b6bf7b5fc56c, 0x1d6afbeef339357, 0x38b5919ad26b7835, 0x96788582316964f4, 0x32d239adae177,
+0x7347c7a62fe98050, 0xe6ffd4031ad617e6, 0xd740093a15a32904, 0x22d4cd9b98c4873a, 0x7aff70d1b15ca8fe, 0x35d36ec1ac1bcd8d, 0xae00dc313ca5f6e6, 0x2a87635f2d7850,
+0x3a69a8fdccea6322, 0xad230cb4a7c567c8, 0x991e76459518be2e, 0x7ddaa9743eeda65d, 0xa72dcdb0c4287094, 0x963c016d59e40723, 0xe9cd46eb69dd3ba1, 0x140416f5592587,
+0x267b9853a77df8cf, 0x9c22bb857f0d05b8, 0x113c140b5f4f506b, 0xaf9f80cdbfd915de, 0x920a2c22c4b80f6b, 0x55f21b2d733c00fc, 0x473ec7fce4e751f, 0x1289fd3fb90a20,
+0xc134ef92bbc31a5d, 0x21649a5c8c4efb91, 0x15e6b24a25cb6dde, 0x878204a4185cc609, 0x58171a7a67b9377e, 0x569e4a4bd9f3843, 0xff326d849e9e7447, 0x12833b71a53bc4,
+0xe0f7ac4702070dd1, 0x653079ac442af1f0, 0x31f2610bf98f7a1a, 0x16e4cb0f3be54337, 0xa2701dba6ed94b3a, 0x31d9571b36dcadcb, 0xfefd0c7f98c19018, 0x3f8d2fd59d4b26,
+0xe691f0585cd45b21, 0x4c86a7859a6adf97, 0x4013bc9a6569b606, 0x2a5368f964557ab3, 0x55fb5d5572cf483f, 0x18e63dee61c616df, 0xa6ded7cd7be3689a, 0x346b4cdc82890f,
+0xf238c2032dbafb12, 0xe29f7aaf15f306fb, 0x45dfa909e7653ebc, 0x9325c090b921f541, 0x7d18bd7b8a2fa1de, 0xc3036fc258cd9ec9, 0x7d744123622097a4, 0x10e3ed466e3e8c,
+0x8132cd2f847da8b8, 0x4afc83f0068deceb, 0x30daee5eff8cea14, 0xd89fdb2b91756ebe, 0x3bf36981e1ecf64e, 0xebc4fe8e9e8212cf, 0x31d29511c2723ba7, 0x3c1e06f04f5653,
+0xf6d3936a7e8712c4, 0x525fde819dbebae0, 0x2874e4ecc2630b74, 0x1fbc2c7d26cb7e36, 0xf75681cf0e5462fb, 0x93909f88676fc573, 0x295e93a843be4e64, 0x33ceaf9b01127f,
+0x9b8a62c5089194ea, 0x2474cd26c67acf1c, 0x9776c45076a0977c, 0xe805e224a4e0eafd, 0xacb7d10d3bab10e9, 0xf8f389f69b8f5367, 0x86a9b41152d32c07, 0x20e2f3d52a54bf,
+0x9a94d1d486737177, 0xb5989f2cf4a1b897, 0xc90f551f4aee8ead, 0x279618305e96caac, 0x7bb83d26a9961918, 0x913d0a07a4e1cb08, 0x6e0aeb7691a7c6e3, 0xdaf0a6ed54d81,
+0x6cedca0b8b513c8a, 0x79dbec9ff20bd4d8, 0xee7f4e001f81af15, 0xf4ed2c245cfbb759, 0x35a3ca53ec92f911, 0x33a3f2c694ffad64, 0x353f74e8d3bd6fd1, 0x13a03ac9580c1,
+0xbe269b61d16536b5, 0xd03ef1fef08e1497, 0xb699a3117fa61d4b, 0x512788543423cf68, 0x6c7f64b39a4e2e15, 0x6b4e8d0adce0beed, 0x52ed5ce2d6ff84c8, 0x2271e0661f2b91,
+0xf66f83c841e5822a, 0xc4334fe8a1e1d72a, 0xa042bdcd86e19192, 0x570e5ed7ab554437, 0x76e232a73f137ee0, 0x2bf11712838e81b9, 0x620cad3081cf4f40, 0xabfa98fa91b55,
+0x3a02c1f2625316b5, 0xba4ae4b73ed468ea, 0x5e9842b107bffb1a, 0x73d4ae1b206817b, 0x2196abb83d189ad1, 0x1a353303c98cff3e, 0x8c2d14f283b8dc94, 0x3fe79a656e8399,
+0x95ccffbaf1347e51, 0xafc14717ce543060, 0x8b508c370d24681d, 0xd78e5484a75cb023, 0xc81a4dc7d2434b0d, 0xe10ea15b3cd11ffc, 0x940708a7c81b090e, 0x1bd72abd59c165,
+0xf4cf36c3588c3b6a, 0x9d5493650ee6a697, 0xdbd32d48adf9dd03, 0xce823766220d97d4, 0x1bedb8b6a2fe0e49, 0x15b4e90b2fc2d395, 0xcf9d717a3e68803e, 0xd2deb9cbb059,
+0xce43fc803bb50545, 0x8e28f16a080f5a20, 0x330f72f37c9e28e6, 0x8a560df2c7e84a0d, 0xf25342e4992f4fd8, 0xc7ba4404e5c03477, 0x69301169a6e71407, 0x70974c1878e72,
+0x4f46f1087f80e08, 0xeabe338f3c3e8f0d, 0xff127371b32c2fbe, 0x6d7240e0a7965acc, 0x171898a00b27f588, 0x37789712c248a546, 0x6dd37825bc72c3b1, 0x3771e38ea36367,
+0x2d7724e2c27b1e, 0xd1833389b990438f, 0x16dfbb65f75223a3, 0x88644ce7b7f01da9, 0xaee1b49048ab90f9, 0xc3b288f40ac839d9, 0x95d185a930609fd0, 0x2f8c69d5ef6989,
+0x8c24774abb7fa431, 0x5341695414714243, 0x7673ce34adcb8932, 0x9e4d78196166c3ec, 0xb32797ea20e361fe, 0x328a84c13f177314, 0x78e496c747c09d29, 0x1350733df5abc1,
+0xb7042bf0d6b8e130, 0xc6a689e163eb578a, 0x593bcbc303abf6e8, 0x1e4b4f8c9a09b9fe, 0xe15dbf9add7dd378, 0xbef91fda06bafc65, 0x6a21a6c54eedf611, 0x2f3fbe51abf33,
+0x5c2269dd28d9e8f3, 0xc369e46b25135e32, 0x995e450356aa052c, 0xd01ceae25178d850, 0x8abd33cd428a101f, 0xd1b78386131b2a17, 0xa19599a63e1b29d5, 0x28be0c6cf5c224,
+0xf43a9ce8424fb5b8, 0xfeefd757583d0e69, 0xc5a37789263260be, 0x5691c19adff8920e, 0xa9c103d06781ac6a, 0xe74cd8070111cdb, 0x1102efac20b11a6c, 0x3c15eac642c5bf,
+0x4578b6a7d9c8152, 0xae57ed71966f95e7, 0x996e995f4151cd7, 0x87e23f19827f6f4b, 0x38581478bedc4e0f, 0x7c168a1b60fea5e8, 0xea7aa567ecd29730, 0x6be3d77c4c20a,
+0x672ece01aca3c0c6, 0x13162c4df93e6152, 0xa2111a21395b785f, 0xe47f820e6a9a6c9b, 0x1bd4887e7a809e90, 0x37c341d43970c8f9, 0x1648fa8e93600a7, 0x22576538e06630,
+0xafe3353554d26426, 0xdab6dd9d51c629b5, 0x1a4327ae6acb5be9, 0x33852bfa9eef7c91, 0x2321fb8f1f141612, 0x78dbf0ccee003aeb, 0xa4ed4cb1360e3081, 0x773909d79a4af,
+0x24ff8c0635be4f34, 0xfc05f4caae3c383f, 0xdf28d60edd085dc8, 0x47053f6b75e99e79, 0xcaf7a94999eb9e8b, 0x7e7f45f120d84cd4, 0x6d5ba90f7b8c200, 0x3a5b2561579ce,
+0xeca147958df4e877, 0xa41fc70844ada6aa, 0x97df5278bd442846, 0x4a377701396a702f, 0x5bf0c7a39ce3f9dd, 0x724edb9181126c67, 0xada67c6b0592da92, 0x1582ca96b01ae9,
+0x29c52afca3fa2df4, 0x5119de2a0546b860, 0x31bae65bdaf8ffec, 0xab93ba79a7ab5985, 0x2c8d37c944384fda, 0xe6a79c4723d9088f, 0x936f0cf38dca3580, 0x2eba544457aec9,
+0xc62f2eebd6856730, 0xfa81e22add902e04, 0x59baffcbca051c2d, 0x8acd5e929f062211, 0xba8d0313949433bb, 0xf020e07f119d1d8a, 0x67af92da3edce1c0, 0x3ba789b892b47c,
+0x8adb8c3fc0ffa6d5, 0x54aa05b9d0281e58, 0x7e8ac6021e1a46ec, 0x2ddb8e3eb9e6e071, 0xa1dfb1913ddd853e, 0xd0e7703be161caa0, 0xf4a89e0c48e074f3, 0x1d4e430d488974,
+0xaa3da5387a77a796, 0xd517734f93c9ca96, 0x8f7ae722f46da773, 0xac55ef1c8ab988b3, 0x18e8e804ce442e38, 0xce796b99ba1e6673, 0xee3855178a2558f2, 0x6298153102fb7,
+0x5918abbb03e5303, 0xe0fe7b1c9490b22a, 0x8b9b8a803b4ca2bd, 0x969c686eaa5a71cf, 0x81378c85890c2e3, 0x84fb8ba7db2f7a5d, 0xbde5f5a8878e3e29, 0x178554a4f41c41,
+0xac22a041a7639f1, 0x65aac921fbcc00d9, 0x53511f061d2c4604, 0x1e0f7f34a8e7acff, 0x35b15f1edb30a95c, 0xceab8c66df8e84e1, 0xbab0e7aff557b260, 0x1e8d7399ee74d2,
+0x561a1af92ee0620d, 0x83b5716f3050307e, 0x2f1728b590e536, 0xaff4023bd7ef472e, 0x8ffb0d6d1c6ac310, 0x9dee9a963254788d, 0x84264a7081a26d9, 0x3147039a462cb9,
+0x4a3bea3ae93960b1, 0xe03e165866fdbedd, 0x925c330c1e7d8226, 0x30fb772bb1a85afc, 0x436a12091e97d9d1, 0xee98c9a0eb42b05c, 0xf63cd3c900a0a350, 0x1d17a39bdd6600,
+0x6086de8f8146c8b0, 0x40566185c25ba161, 0xe901c89884636e6a, 0xb578be00d22d4401, 0xb58916bfa27ee2f6, 0xbb29c4cd5d3d1370, 0x561bfac5817ea571, 0x3261f12eaf245b,
+0x655858d5fd89f1dd, 0xe47c518457856ab0, 0x6ede0f13df8b80d2, 0x1a7a03582b70f298, 0x62b5a5c54b3d490d, 0xaa840fd16257e005, 0x67e4472cfa384456, 0x48c971acb01e7,
+0x5ab1c2ca90cbeb5c, 0xa25f64938bc48a66, 0xec946017823c05df, 0x896c703b4f137bc2, 0x32ea49999d906542, 0xc8b0d06eeb790e74, 0xba60c32ec55c62d7, 0x1aa03d36cf8502,
+0xb3b51380cfde9f9a, 0x800db6ea7b00622a, 0x96d24257e2959bd4, 0x66138e2213b8db45, 0xfcfbc265e95ac785, 0x88c6e2ea002f17c0, 0x133afffd2c114e09, 0x305ee486fef8ac,
+0x6da27203138d6791, 0x318e62064aa04949, 0x726731da137d25d, 0xc9010166565792db, 0xb0b9c7ec3e41e579, 0x75a93bf116ae58fe, 0x5691295e4f0bfd67, 0x6741a00bc7f3c,
+0x9e8ffaf253556784, 0x308d2f92623a0758, 0xe283e03d68849d09, 0xa62a3e8dc4720855, 0xbe933ca1dea1f275, 0x6009f11d5eeb04c7, 0x48cf021ad85286e2, 0x352903b55112b8,
+0xd043c2e2d1b77306, 0x63ff12d119064271, 0x36f29c4adba2cee6, 0xfdb6b49216d3743f, 0x97583bfb1634421c, 0x62f50b77d0d5602b, 0x4bbb0b43d24a746e, 0xe9f0633ed51c6,
+0xf000cad855769133, 0x76e09db5856376ef, 0x6d4af7a1a5b4f08c, 0xb86e268a7fb058ab, 0x38dd659995aa73ac, 0xa8e9290cc2fcd68, 0xe0323ff63ef88ad8, 0x2ede1e85d43b37,
+0x276424313c1a3e1d, 0x606acee2fb664a35, 0x9cab609199e34989, 0x4e77eea24252edb, 0x2a336bf03f755742, 0x3d90690a4a1182bc, 0x83e63180286ab47a, 0x3097feaa94d00f,
+0x9af3146127a87383, 0x86d06966e3c9bd4f, 0xc18b027e9c7fb47f, 0xfbfb888c4ccde2a4, 0xfb2812665fccc68f, 0x6500316ccbff6c32, 0x8999cad6a109686d, 0x2605212128434d,
+0x65ad07c38c98cfb4, 0x55bc5107f2e2d3a7, 0x2abf881ca3eb7d53, 0x5b3c3a18ea55a373, 0xa806227c1cc57aee, 0xdf61d03f3bbc0342, 0xd33e72fe27c15948, 0x6f92d43fe216a,
+0xeb1256b793f7ef2f, 0xf9342d3b236077ea, 0x222917f7911b2944, 0x5870f6b56830a715, 0x66ed442441fac96a, 0x67c1ea39022ce0aa, 0x16dffc1d53fde5b7, 0x2561de1bf44683,
+0x7ddbd2d778f2727f, 0x72be786710444e3a, 0x1606a472b909bd87, 0x522519656a945c8, 0xdb62eaa057ec78cd, 0x53c16d232ebbb0e, 0xc7763d04d6e552e9, 0x21ae705225ab6d,
+0x5e3a092f11893dd2, 0x7ce31e0c582ed837, 0xab07330f1f006699, 0xdb71c77a33d38014, 0x37d84f386ee42eb5, 0x77a216fb5ed21c3, 0x826fc664ddb3b6cb, 0x39ba5d5ee95e97,
+0x455360834f72b7be, 0x5965d9cab8f4ee6b, 0x232b72f1fd1fe273, 0xa230386d4dca331f, 0x94a0a28561abdd7d, 0x54a05fb6bb2173ca, 0x7175aa2c518b12c, 0x117d3e02839973,
+0xea574d73adf55d5f, 0xac62215df06a41f9, 0x6d3b95b6a67a9645, 0x826598e697a820e4, 0xe767f1063def9234, 0x67dfd36851a1039f, 0x7a4b7484423c4f7c, 0x31aac26ecb5d4e,
+0x5e58820ded947800, 0x642ec669ce845975, 0xa1601e7c1e1e0849, 0x9482ebff16084e7c, 0xf8a86a39c685fd0b, 0x1bb977dba5dc9e64, 0x8aa346c76a362bfa, 0x3c13e12e0b145e,
+0xee868c32e27d0563, 0x66472920173c8a87, 0x70e378dd92864af0, 0xfdbc0e0f3545c0d8, 0x25fc7aac6a049fee, 0xba9390567c02f767, 0x52804be88e363e0e, 0x2fe7497e17638d,
+0xbcf4dd8a2e0cc511, 0x90be0214ef644e2c, 0x8bd7149a4abeb28e, 0x191daac54720bfaa, 0xeaa3cc3e4692b71e, 0xb4dc4bb2cbafbdb6, 0xf8642056eeefff77, 0x377f5a4967e81,
+0xafb6b5749aa21b3c, 0xd8baed1f97a371ee, 0x6fc31cf502191578, 0x5ba3d24e695a0ab8, 0x51d2363389d9bbc5, 0xc9e44d50c75bd216, 0xdee374120dbf7a94, 0x11de684307e1fc,
+0x4ccd9f7c3899a6b9, 0x4221847d638a5d13, 0xc4e0587f32b605f1, 0x7dd188cab5177518, 0x4077682589f622f1, 0xe9654fbb5509041c, 0x4ad3fb62ad64ce86, 0x2e72e5d538afd2,
+0x94eb88fc3d2de5b7, 0x9dc52e4daa4994af, 0xb5d386e49b6b4e88, 0xf3de440a7258f163, 0xb309c4690ebbcd33, 0xab797e20ac43a8fe, 0x49201b1a072535c0, 0x15937eb9214b5,
+0x7f0ab57f68c87594, 0xa897da95b336ee57, 0xc50076fc4435d1f5, 0x8cc91ed441e10f4d, 0xbb9e806a102da562, 0x6daafc98cc858a0, 0x4d59111494514be9, 0x3d3739ddb32c5f,
+0xfb55999e956c9738, 0xeedb450b67d51ab0, 0x4c250383c9a5ff9e, 0x81fb04c1c8525cac, 0xf1f6cf0b946af386, 0x114d12219cab4634, 0x52694c42cc4d0069, 0x38810ac32da14f,
+0x963c1a238c1ae10, 0xbd747bb2c5d8a44b, 0xf943e6b36b621831, 0xe0f00275ce2b9295, 0x68d84e8c9d2bf7f7, 0xa09e62d7ec67919b, 0x87fc8cd43e58a521, 0x2454d56793816b,
+0x794abdfcc89c91cc, 0x93f1c2fdd0118a36, 0x47b59093519d3afc, 0x9f32484554af0d29, 0x56a57949cbe6a7a, 0x3ee3df37d18f9be7, 0xa8491be566bc5386, 0x274d6db7f93b2a,
+0xa44986611fedd5aa, 0xfd3bed6d4f1426d5, 0xd2c0f935d6893bba, 0x549c0adca0a55e9d, 0x8808ee1d1139c9a, 0xbc81c256df598d45, 0x7b45d53d12769369, 0x1b7e59339822d,
+0xdfdf5416d472b8fa, 0x266e6a4a074a6525, 0x33e3215d94920082, 0x200d66bd557cb382, 0x252c4b96c10c6d3a, 0x8afefa72f019310b, 0x3ea2856e59bfb8c, 0x1566d87799cf46,
+0x5810e4502fc5827, 0xed7a122df7de2cf, 0xa71748a5105c9d32, 0x4db0340e1d479d47, 0xb6aeb91f36abad21, 0xd0b61bf3df840a43, 0x33d381e7a9524461, 0x184563f21d8be,
+0xca9a36b9f4cd5a25, 0xa2d743ed9d94288f, 0xe11854245c2be3f9, 0x18dd5d0ea9c62b77, 0x71b5ddf069a38239, 0x462ff85d662b5739, 0x8f0775f6eb9f7067, 0xe9028cea5f5fd,
+0xef7dda0a270b0fac, 0x8d5b15c4b85cfdc5, 0xa3de0bfba5540069, 0xa6910d57ab8eff6e, 0x4781abc5c99ea8fb, 0x8cc560ca2bcf0e00, 0xae945e2c3b9cb9d2, 0x2aadd1b133219a,
+0x8f23e62c402fdecb, 0x947ef73a4794033e, 0xdf63c67cfbdef4c2, 0xc7a1e3299594f62d, 0x2c3f5e6251d15207, 0xdae5ac00d90cced1, 0xbc7e64aee5638d51, 0xba3c4739da95b,
+0x93ffe0de8250187b, 0x1d145333e5899f46, 0x1904eeee43ebb312, 0x1383058cf8c03c87, 0xf92ee48461f96224, 0x2da38d983ddb17e8, 0x6d2186d33e59c36b, 0x250774ecffa4df,
+0xa08b39b20f0b4b28, 0x6ddddd0aa0458276, 0xe7a46d35882293a9, 0x412a3f9210ab608c, 0x58eddd869087f4a6, 0x350fb8e8b3690a57, 0xeba1a418852965ce, 0xda928330b97c9,
+0x307add512e765599, 0xad084567822befc5, 0x75d1159d58f75a6e, 0xba5fa70329fed032, 0x322c289918dd5c15, 0x53a1fc93b12db4d8, 0xf97d73aafae2a90d, 0x9316db3e8feb8,
+0x216c54d5330cce0b, 0xbc2c3db4ce0888c2, 0x2c92aa85c95b4da6, 0x9d0e9a4b6e7210b1, 0xf6e6762771b5ac97, 0x2ec536b830889b61, 0x807c10d3b11ddf68, 0x3ff77b9e0a89f8,
+0xc8144e0c41f30695, 0x3e3216ef624a9a97, 0x1cec3e595606677f, 0x25ec1b46f719664e, 0xd3988cce8d90bee4, 0xa6225eeeac9fa979, 0xba1d02d6f0f81fc3, 0x16e7c4ee3397f9,
+0x9ce0856f85ede5d9, 0x1bc4b5d0e60d8392, 0x4a21dc70d7d70f59, 0x61a40c66a78530ce, 0x4f243c177781cca6, 0x1299183faa6cd9cf, 0x1a148abe46fc0cac, 0x329247676644b3,
+0xf1aa5af80708a852, 0x7c5614c299d45b33, 0xdab2fd92c6d6e379, 0x4923a8097e92a527, 0x9e4f2c834a2e2a03, 0x4fc9f59426e8c62a, 0xd970bfc019c55220, 0x1f32cf60bc3a46,
+0xf7a837e0bbf29fd4, 0xcdd29610c15bddfc, 0x8e07f2b47d93b04, 0x333165a822996239, 0x999013bc9449f928, 0xd71fc12dfe03c715, 0x6778ef59f1be335f, 0x1c868e15a8bc0d,
+0xb6f53e9b235b4479, 0x80da9c5a80371743, 0x705c80fd4b4bf577, 0xd4f6245b811ca276, 0x881304d6e072dee, 0xe4e639859aa241e5, 0x912101a12cbed05a, 0xf6f83235ca602,
+0x69e6a9cd65179b2c, 0x817ca2c49ab4eb24, 0x17083cc9de51c9ac, 0xbf64e3869ec97eb7, 0xff320d20d29f0f61, 0x66432da3f98a86a, 0xd4f80b84f589a57c, 0x24c0cf6fd16f1a,
+0x7f4e199f10210681, 0x7ef1190a54454ca5, 0x89165e94fa70d40, 0x7091143a4d289b7e, 0xae0843632469c0c0, 0x4c23c145ae901b01, 0x73428597eb9027fc, 0xa4aa3acfe15c,
+0x60dd66091ef9f724, 0x1713da394c304a7c, 0x93650f486a1e3823, 0x4748a18300898763, 0x5cf0d9565529f133, 0xe04370653045db14, 0x4c826d11d78c4ce4, 0x33ad7c5a501721,
+0xd9942c04b985ba1b, 0xa04c0fcd1fe51a92, 0x9ca6e9006c195efd, 0x4c4553e980a95fd3, 0xf8be423b25a8a7d, 0x5a1f67d1ffb29fe4, 0x91a5be542b0a932c, 0x63b25b749d19f,
+0xcd9369fe77a6475f, 0xfd406cd89198853a, 0x9e58728b0c5e5f63, 0x93654ad381ff38a9, 0xf7a697c0b1bf5bf9, 0x2911adc817dfe9e0, 0xce2b9129e3d04bcb, 0x2077144688124b,
+0xf3d1ae3d6586ed6c, 0x412653617030c4af, 0x51dca7f840df18f3, 0x31dc4da33ef6f4a3, 0x8816456743d517f5, 0x532d1fc445833127, 0x890affe1ec437e4c, 0x3094b4f6aa067e,
+0x95c481cc216b1211, 0x477d1d5aae8053e3, 0x3e10ae1a0f429f30, 0x86097da0f538ebee, 0xa678c13b31654c8c, 0xd69b2127ea535fa5, 0x9f4cbaff16f6e4a5, 0x1eb7f7a6ffcb87,
+0xc7ce763d75459cbe, 0x4d117faaaadde7f1, 0xe04802b5296917f7, 0xaf66929d228d7d24, 0x711bf772df925fc8, 0xdc53ef88f2b7a698, 0x523b36a439e001cd, 0x2bfc66c2056eff,
+0xc9d358a2674a6feb, 0xda1e1c8658542c2f, 0x353ac85ef9fcee88, 0x9894404df5433aa9, 0x326153984d660689, 0xdc72ccf21f6205a7, 0xed847e1bc83d15c9, 0x2dae03f3539377,
+0xb7843b0f8e53b335, 0x41dbecaed9220176, 0xd922dea699ead94b, 0xce590f9aa94ef37a, 0xa34a130d32966b93, 0xb4b77c2ebc4b4e66, 0x530c8318d0d78955, 0x1d74ffac945ca,
+0xb3240f90befd1a44, 0xbdcb5c65020d9aa4, 0xc224996d9d15d201, 0xac01c13a7f3b326b, 0x30f5cc6118a76e5, 0x1f00f7ee5c12c57f, 0xfad5164e8bf17907, 0x3c450ee4495cd6,
+0x9faae2250d83cb1f, 0xfc1d350ce1571a2c, 0xdff155fe52955f68, 0xd49f346604b5e057, 0xd5bdd1fcfea0a569, 0x766916a490fc26b4, 0x2579e68778e140fd, 0x2a952f4b968cea,
+0x39e8e3b92195063f, 0x98320add16f9f00e, 0xb933fccca104b12, 0x7bc38ebad0e85c4b, 0xf0f256f63dae1cc7, 0xc7d5bf766c3d89ea, 0xd37e546f727b3aa4, 0x1d5bb733396e1,
+0x8363802b976c8a80, 0x885f61fe9fdbe66, 0xbfd8624c4aa5e43c, 0xda25ea9122efdea5, 0x33ac6e863baf3030, 0x428936e8851b6633, 0xf06a2bf171e032e5, 0xce8041190053c,
+0xf164ef89b5308f25, 0x2245f4cc1523cab4, 0x48bd6f79d314209, 0xe62609c2a879c0e, 0x3b35ea208fbf25d8, 0x79fc7ab2b9b6b3c7, 0xe41aceca37f91b1e, 0x26125b0923736d,
+0xe26e8e34f21cab63, 0x48650e484b4d9607, 0x40b312913c0a7b2d, 0xda9894a7e31cb56, 0xc3bc111c387991ff, 0x3c1e4d6f956acf63, 0x75d5886c8c21375e, 0xdb84544db64bd,
+0xd22231d0ab3b9728, 0x87e8c2ccdc72822b, 0x92a87c71c5cb0cf6, 0x39644d4a65b7027a, 0xc5e46870fcb9660e, 0x67dafb55627af701, 0xa3e2eba48398545a, 0x20524144830274,
+0x89aaa72dacec1487, 0xf393788e3e99e0ac, 0x39332427aff5e077, 0x485f538bb231c278, 0x30f6c461fcc924a8, 0xe8c4a4d72f5fc808, 0x4d1cc74365d1d35a, 0x181d86c6341a98,
+0x36080686bf9215b5, 0x602d018177cd81d2, 0xe3641f6027af998d, 0x3b8e0fdfbb079394, 0xd2a122a54b97b729, 0x17f44b964268ffc6, 0xae4d570fde71bfa3, 0x14c7d16d56d1e2,
+0x6466107e7069561, 0x346e8735edf6cfe9, 0x8555074d6550572c, 0x2be3dd8e6ce42fe1, 0x7d49e486c984bdfa, 0x7e1fc7d4c20d1613, 0x55c7a2db2d5e0698, 0x1d9dda3b632481,
+0x4c1aa9cd5080a8c7, 0x12415f1d2b7c1c47, 0xe42d8f52ea34738e, 0x2cdfe05607ade66b, 0xa3c5939c4b7fcf1d, 0x8ddf73af50f16e3e, 0x31398f59ca516063, 0x1cac742c9ea0d0,
+0x4736685d0dc78377, 0x7a9e13039fe5298f, 0xf11631e4026205c3, 0x6525796baeed916d, 0xcc54e633784977f6, 0xddf4964c37e2e2b, 0xd24a23b4b6fadbd6, 0x3defd9719d7a6,
+0x33da34224fbdab57, 0x688be78449ad79ba, 0x631d04a38f51a07b, 0x9e15349d6d719409, 0x4fb676885395f0be, 0x4a50c409c9f9df8b, 0xa2a6f366212e27fe, 0x306238d89d8d5e,
+0x6daf8244db63567, 0x5fff33672cd3732d, 0x24308f5b9bf018d6, 0xfcce1514ead7b339, 0x6bac827fd991112a, 0xdf37867f43cbd4e6, 0xd1e853b4c151ac88, 0x153bb69795eeed,
+0xc2b0dccd96d923b4, 0x84fa2bac0d3c859b, 0xc17ed893c59886, 0xbf948bd94c3dc842, 0xe5e8e516ad745041, 0x51def67c63d51eba, 0xff263cb3b7dd9069, 0x4c7694ffb5bc8,
+0xaebe3f2b5f1491c6, 0xc44eeef5e128dd2c, 0x8254867236b5a579, 0x28009270db328e6b, 0x519ca7e8917ce06f, 0xb44db1f9e9b4db12, 0xe3334898d9e5610d, 0x393dab9885267c,
+0xea37dcff4148ef03, 0x5044675e0d34f604, 0x79a3aef16e895a49, 0x77693044bebac01f, 0xfc02dc2971917213, 0xf1b6952d918841a8, 0x34fdf716cb08694d, 0x24577943de5d6,
+0x4df51c242105a78f, 0xf83c2b521d868e84, 0xa781e76bd2d1d099, 0x9a74df6d4d88a1e4, 0x36f14cdc45cb2b48, 0x35c24b48340ac262, 0x289acb6b6772e4fb, 0x205d64d1da8b70,
+0xeb5bfdd5da805b5b, 0x18ed728bb4527ee7, 0xa58479024acf563e, 0xdd3fefb6d9dceaa1, 0x8d95ea76957fa370, 0x36a7ea0be5c651b5, 0x501aa21fa9bddd9, 0x1097fa30841fe0,
+0x435e7f15fe5df466, 0x825b435480f7b2fe, 0x33405c55fabbf916, 0x4eecba11e94f92c2, 0xa551609623475b3e, 0x10726b8b7f8849a7, 0x478939e7993d718f, 0x1fc92042cc8773,
+0x7539479c900e09bf, 0xd066e7c2e7fd89d8, 0xd61044fc4432303c, 0xa42e2af3e10cf6d4, 0x458f494c7de15bd0, 0xfc1b6c1a53bc91c7, 0x2d39e503b12dc5e4, 0x366af3fddd54b7,
+0x55c5c4f2707e074, 0xdefa1d4f24dde11c, 0x84b0cc05d4ab60c1, 0x1596dc5129721b7b, 0x8479ddc1a958b592, 0x872ac5ad06383c87, 0xd5e0b1bfba160e3b, 0x1bc6faebb3949b,
+0x7d304f8ae560cc28, 0xf5dac6b99a25356, 0x1cf4c58415593775, 0x7fca44231f25c19a, 0x4cdbc8abc051a5e4, 0x72d8edd946cdaa49, 0xb46753ff109f5760, 0xc307d695e4a56,
+0x86062ba4b21eb80c, 0x3b42184aa93cd213, 0x5a116c8ce0189032, 0x501cf7f8103717db, 0x284cbefd3305da3c, 0x6a08b7b622a34532, 0x712cd8f1816ad4f9, 0x1fd9b26ca27af0,
+0x73c4ffe57bc040d8, 0x191f834ada2e138d, 0x1aad15e90e8a1873, 0xdc913fe97d689b5f, 0x2bc4cb0ef224ad94, 0x2c4400cee275d643, 0xb39a10f5ac03d298, 0x39d74ccdb17d39,
+0xe131a207b6d70bd, 0x347667640d87b610, 0x433b4e077a4b07f7, 0xd1b359b02f16702, 0x101e13cc1b2de703, 0x333f90f4b6d0827d, 0x110ca5dfbe31d9a5, 0x36434204740bea,
+0x5dbda2226f3774f4, 0x441f58f2b7d77afb, 0xb6565a34080870cd, 0xcf59573e3bf1abc1, 0x5dcb3b9d6d6b258d, 0x737444ae6a2addc7, 0x23f1dfcb0c18587b, 0x3cfe3e21e45c33,
+0x8c5353e6ee3df366, 0x9f9668981f37a2c2, 0x69531d8086abcef1, 0x5d9e9ec9c0a3a65f, 0x64a9a63a341220f3, 0xfbb3eba25ca72ac, 0x1a04cd9f43c2b8cc, 0x2837c1ab0d5f61,
+0x6b79e7168ff95ba8, 0x49c08a7b4ed12a2, 0x71ed084ad027f31d, 0x3fb3a84a9d45ee5b, 0x3633fa15b2b215e, 0x788a419270248de7, 0x5fe47c8c55e90ee4, 0x3efe6070a937d2,
+0xb2756f6ba89f21ca, 0xfb1a9f6a156e5be9, 0xe5478454a16bff93, 0x9140f8bbef9a2664, 0x5f972bc3dc0f4cab, 0x24d92bb3d10b1909, 0x33f1c8df86fdad8c, 0xc2fe016cd5ae6,
+0xa702c359e282240b, 0x2617c4a9f8c7da24, 0xb8b53c22d439cef6, 0xc0cc09d57eff7c95, 0xc2e3589f37120c04, 0x4008096dc50fc557, 0xb14cb9d71f90c79d, 0x36a22ac97e9c3b,
+0xc9a50c74b107db6e, 0xc8b193cfaa20aff4, 0x630022fae2917d79, 0x2db400a4717f6f9d, 0xabdf7e40768e471a, 0x6ccfa89dccc0f698, 0xbd9088d2ddae00fc, 0x1f271e7eb14342,
+0x8563b6f784da2f6c, 0xe7393c6669180f35, 0x9d1dea565743425d, 0xd16573c6f07dd48f, 0x4b1b62cbea468eb2, 0x7044e8a80d6b49a3, 0x173f48fec75e0771, 0x175a6bba40ddc0,
+0x557f14a9a6ec7f94, 0x489adc4fe365e135, 0xbf45d3ab5a979a1f, 0xe8ab05910631da57, 0x222a58f2ac0b30fb, 0x965f47d797073df2, 0x54597ccaa4a46d8f, 0x1a370696448683,
+0x13e5faff3b6fb516, 0xaa2cbfd72331e3f2, 0xd138fb3cce69769, 0xa51857f9ee0c3f9c, 0xf45587afba43bc6f, 0x2b56fda818ab5ea5, 0x19dd89e6c50b060f, 0x2cb142aaad3bda,
+0x9bc60a65fa68745f, 0x66a6a933a28aec73, 0x9fa99804041a8cb7, 0x5c2497a8e6fd4350, 0xa4026ba00b179544, 0x7d8e55e4d41a274, 0x64735c26eb815e43, 0x1e61c91bc08c92,
+0x8b291889e9a1de52, 0x4d404e8b60700a49, 0x3cd0337fc993b793, 0x36946f218e4f9fd7, 0x653d63c1f4e87ea7, 0xcdc031081987c4f8, 0x7a413c49d1406772, 0x3dc6da880c3443,
+0x9fa474db02c04c26, 0xe3bb4c6845bcce4c, 0xa51372bb789adb4c, 0xb073d88b2a290064, 0x6b9a0051f35e2352, 0x4e06652e5f42c0e9, 0x34da25c0b0fd3d95, 0x43f36c3204cd9,
+0x2f9420c8e8dd440a, 0xd50455326469ff7a, 0x6d2a21a9c77aeb7, 0x1888356eb4efd335, 0x17c9e871eac65ac8, 0xd9fd6dccaf50f40c, 0x44903fcf9bfb1d85, 0x32c96c494e613a,
+0x33dfebf9bf435ba8, 0x8de71856f6276769, 0x8c0443a3d1bd7cf3, 0xfa2f513362f81a32, 0x3388b27a29f79be9, 0x8009ae009fc0b146, 0x7c83cbc4821bb624, 0x21aa6406d46979,
+0xc9667feee14bcbf9, 0x3abda0ff19dd27e4, 0x11e9c4c666af0d2b, 0xb8db81838d7fb021, 0x355ee3390dd73cdb, 0xde5f26e8a1bd10ee, 0x64bebd1ebf5151b5, 0x18135ee1c69533,
+0x29a01240b1c2ee1e, 0x67cad17532a3c508, 0x54e1853da437b5c8, 0x6a8be5f77fb465bb, 0x3c076a2cf29a6c19, 0x5624367db7953190, 0x9ad77c804db00da3, 0x6db7fa8fbc1d4,
+0x1143b29ffba3c177, 0x834252be84d436b7, 0x3f1c82fa3c2d36b0, 0x39784c86d64eed08, 0x215c20b986406412, 0x76d1f9584dc07c87, 0xeec7b2543806793c, 0x222dfb0b3042cb,
+0x103b8e2533d8b922, 0x6c9ee72938b03932, 0x6a052284f07a521d, 0x5fc33c08e322d4af, 0x8615e1410cf49e3e, 0x452596fb0bbec0c5, 0x369f4a69ee104ef5, 0x101700aeed1433,
+0xfb7a89d1955b20ba, 0x924c5a87bd5afb2d, 0xb0b0d6c7d4232d21, 0x8d98880c758d5d1d, 0xac96311aa4b67097, 0x56750becdd4a6e48, 0x109746a8da5b66f2, 0x3100355fddc6fd,
+0x8c6443628f7aaa41, 0x3bc15befaaa1cbc7, 0x7921319e5aa0ec47, 0x8ddab99d89312a0f, 0x3f8a968c2d716326, 0xa539134ee39f9910, 0x5a0fcb7f7a6b8b66, 0x134c6473bd6149,
+0xa209e493b4a83693, 0xc030e6a42a750a4, 0x17c77336df26b3ce, 0xf277a7ae4a1c08df, 0xb220dacb026b728b, 0xc6685c3f6d7aa97, 0x7997224ffdd571e6, 0x2dd827b4868093,
+0x5f5504b6681d23fa, 0xd59937257432ed6d, 0xcc640c8926074aff, 0xcad9f3ba951b7491, 0x74324b3fd3f2498b, 0x4a5fdb94bdc8d3ef, 0x742e2c077aa7a833, 0x120a6b8ce1674f,
+0x930b5cb5f2351d16, 0x54b1ff7b29e5894a, 0x1e1f6a2aee2ef222, 0xaf5cc284d6503985, 0x1990465fe88da933, 0x68b2676ac108bb61, 0x698a430510fb8cfb, 0x3f55cf2507dc3e,
+0xe0f2f8dd993e8e60, 0xac8818c3115e1a3e, 0xe88ec9b054fea103, 0x20c9535ce2416a71, 0x20d541dde86f5c6d, 0xa07e59f2126ee6d, 0x10a11a8ece97cbe3, 0x176971ca048a2f,
+0xb44e3c74f553fa64, 0xccdba2f47346c807, 0x801c58dd2cab7a7b, 0xa435f72557d72f19, 0xe7c14b764dc684d3, 0x80527a580178b456, 0x79a1f23e8ec9c989, 0x3c5277a58a2d37,
+0x4184c95d65a14e92, 0x405d960a31036310, 0xe31764eccf9774ef, 0x4056da1b5e7bc707, 0xf96a5cac4c463e01, 0x5c0497b4e01ffd1f, 0xc820be4fa8c9d015, 0x2a3187cdaed15e,
+0x1c7d160d890cde05, 0xd8742a80a183a819, 0x1886adf7a0b3bf7b, 0xdba31cf776dc029f, 0x72226680ac97c44c, 0x317cfb844c3a1b34, 0x49811e09cfe94a99, 0x39b448c64b933f,
+0x61e0ee4488589e90, 0x27789e855b9c821b, 0x86ff520a723a163, 0x887d996b18faca24, 0xd6020e3a901fc02d, 0x1f75e92931ec9bea, 0xf6cbc3b1a1aaf575, 0x179d40229b56df,
+0x37a71a078df0733c, 0x8f98d9ce2a17cd0c, 0x7bd2f1501f365f4e, 0xae9e10062fb67ac4, 0xef8a20902da9e015, 0x56ee2d47f3c2988c, 0x8daf4b7b3550b358, 0x2606abf73c5a7e,
+0xe6d4d42dc13335f4, 0x2bce9d78359bceef, 0xb67d7d5de601566c, 0x927bdb6e9561bc1b, 0x77d987bd66aff542, 0x4856160fc6a123aa, 0x46e78cbacdcbaee4, 0x25003051b1a196,
+0xd38e5d71666e02be, 0xc810c7bda092c07d, 0x49d3b030ccbb7261, 0xf904c8b024a16b02, 0x5441f13c9ac1068f, 0xa975815813f31609, 0x37c2732613fed8df, 0x3f862670d67658,
+0x33bbf4098ba480bc, 0xc83249aa48491236, 0x9b411f8da5b6bf22, 0xa459e0122421de5c, 0x9c977dc41577beac, 0x197c5f32f26c4286, 0x2cbb7cb07614d255, 0x378ecf53769ba5,
+0x322788e4b906fd80, 0xd1e10324624b08f5, 0xfc3218468024e9d5, 0x40e1fbed8159fb, 0x91e77142aba06c56, 0xcc922684322458a1, 0x7b8a422741108a4f, 0x38f48db22adfcb,
+0xc18cf1dc820c7cf7, 0x93cf0fe71aa952f7, 0xfe07a352491dc340, 0x3849120cdf2aa144, 0xbcdd29e89f90663d, 0x505c7abdf015eece, 0x71bafa7e515450e6, 0x3e8fddc2faffe3,
+0x2e4c920c73386e37, 0xcf02a78169a78330, 0xadb8111dd6a800fc, 0xabeda30bdc7782d0, 0x3155d58b466b65d4, 0xacd13be213f80213, 0xa95db22f74473276, 0x1b58d9ef2c472,
+0x9e65a0b1b8e461a6, 0x2fa757e262b28741, 0x5c0bb3876d1d4adb, 0x5349a379e0a3da22, 0xd075ed103afd15ee, 0xc34f17aa6f7f3e75, 0xb410c68d9c407d03, 0x2947ecee534aaf,
+0x8c2422bd6e871a46, 0xeb2b68b5a996ae76, 0xe57b98843a3541ee, 0xe513804b91395d5b, 0xe7d0b1e6f7636ace, 0x84380ba8cf95e45a, 0x850a3ed7fd1295ec, 0x2ac749d51eda76,
+0x7ff858605c13f7af, 0x83e87e24931d80dd, 0x73cdffe468bb821c, 0x4779457bcccffa60, 0x85c67c62546ea76b, 0x9d25c7f980137815, 0x718f9f2de935ae12, 0x25ea92a83799f1,
+0x6fa8456cc82efa72, 0x7edbfea2516d71a1, 0xc10d84952b18a008, 0x239fb5a0f2f43994, 0x7ea5ac8862624d5f, 0xc22d090b4c9f0cc4, 0x134ab606c45ccbf7, 0x3d57e84bac6ce8,
+0xda7c54db986093b2, 0xc6e0c3e37ba6d84c, 0xb56242bc8d614610, 0x2b92ed6bbc9c56b, 0x43747005191d3770, 0x98a79deec8b8e95d, 0x92077f3b9c937df2, 0x3cf6eebd9c400a,
+0x266aca56e1de18a8, 0xc1d3dbd56f86e3f9, 0xb369d89d470f65dc, 0xbd66f841dff477b5, 0x670d1940383dd0f7, 0x92655593864e0dc8, 0x10786eeca061155f, 0xf67dcf470263c,
+0xce59fae2aa423850, 0xaf440ce043e6f585, 0x90e8700c0795170d, 0x3969d7302aad8a1, 0xd768cedadea1b49b, 0x4393a019272d5913, 0xde84e5e240d02fd5, 0x12ae00ccd6b9db,
+0x348427c7a43f127c, 0x3b4e3840fee58440, 0x1af900e7ba995443, 0x39c8816ecc8cd8ee, 0xec20fbf864ec0ee8, 0x229113ef2bf000d8, 0x39e5c0411e22843e, 0x220dd50847279,
+0xb10a9d33b9d56524, 0x28f47398604c4e55, 0x9a40cade380c7ae7, 0xf9825aa6520e4102, 0x4c224e01a87b0e11, 0xe418576a1e9d06a0, 0x974f408227c6f6d1, 0x1feaf83f938b69,
+0xad8d3ef219b169bb, 0x850c2d3df19f74a8, 0xb6ff920cf9060745, 0xe4d82dd90b77165d, 0xce88608e441db5ca, 0xb97932bd74d7358f, 0x3966e6a5e7879cb7, 0x1cc62d760a1bbb,
+0x87ec741b5d1d3071, 0x1e15992f2cac10d8, 0xb33834e9c9cd50cb, 0x328f08183f17ef2e, 0x4901ebc5cbef7338, 0xb34d9de6da244b5e, 0x63ae35671528da50, 0x29d96f18ef9ab1,
+0x7ae65ed297bcb44a, 0x66708286192f37af, 0xf64ad12b0193a146, 0x444da3440a5b2bd5, 0x90bc28c111c27444, 0xf5c57c6825df69b2, 0xa503e7e640b13f7e, 0x27147bd025cbd1,
+0x5b896e1cdd5e975d, 0xd73a9b75dfd084fd, 0xfe0960ace0d59f33, 0x6591e49efb3248b9, 0xa5c10c5f7b0df48d, 0xd4adb86af4fcc47d, 0xae4cb0f273dd2ab4, 0xec74255e5c7b9,
+0xe204fc1954a7bd09, 0x54e6eccaa01104e7, 0xcdc90f59ba28c8c3, 0x15f92a53ce3183f7, 0x1606ec1ab1ca5bbe, 0xb2a50ba15fb7ff8, 0x5f438d65032fb0b, 0x1e6ff75e62d5b6,
+0x92c23a92f18d1f23, 0xad36e265a848396f, 0x3636017d186ce0b, 0x69bf74c8c05e9c14, 0xb8e484c2ce33e33f, 0x8b65e50b97f7dbea, 0x26ce6244f5f476a8, 0x2e0aa168af4ee5,
+0x5aca84650b74309e, 0x4e7cfe9a6abe038a, 0xb54923db0d5a3b2, 0x59b170cebd1e612d, 0x71caa8c7fa0ce814, 0x22eaf2c0dcfde6d2, 0xb437f05fa65bb4b, 0x2c7fd7fbfd5917,
+0xbc476fb30d5b5ee8, 0x1770e44d89442f00, 0x503cebacab49b9a3, 0x3671d2f3575d2a21, 0x4e6e72134f7eb263, 0xbaa8a26fcaf4c06d, 0xd9a2673f37e9d121, 0x27f3bc8c1d8f6a,
+0xae81fbc9377f45cb, 0xe24ee9209ca43c77, 0xf427e73f008afc43, 0x67bc3a00ab42f68e, 0x8872e08fa9e9c49, 0x3709b1fd99a9d88, 0xb68536003219f8f7, 0x31318f405f0925,
+0x75231e9fcfec2e3f, 0xa0aba279b94263a7, 0xf44ea5c8593cd9ad, 0xff667f8abcf31184, 0xeed35d5e25e44f8e, 0xf1254bc1c8ae3ddc, 0x8df813fda8dc5a0f, 0x22427ab3fcd5c8,
+0xdb2a33588ab17e0a, 0x30ce3cef2220bfc9, 0xc0c437ae023ab269, 0x9caff3fbbbebfccc, 0x907846a1695b2b22, 0xcbb385935e01a6f1, 0x684b6cbb3f75c640, 0x16aeebbd1f37e5,
+0x625c5cc9ed4d9d3d, 0xc3b3ef84e209d59e, 0xe51f957a572b4de2, 0x5d6dd5d1b5e18f0e, 0xaa23cdec899fb513, 0xe03ba2de7d9ab23d, 0x984830344839b7b9, 0x28c86cc5b7b6e7,
+0xf9d9c38e6c953a36, 0x4d3e9c9679b8224a, 0xf56f5a259e8a090d, 0x44244ef93a232df1, 0xcad8cb902edb37b7, 0xa53174fa3de07571, 0x9293c3770d1680f3, 0x1e5eabe8851d16,
+0xe8b33fb4518f47b8, 0x196b5d41e04bbc77, 0xbdcae9102fddcbc3, 0xa79bf400a1372432, 0xaa64f46ba8f231ff, 0x66cf354f003ec308, 0xc1af4df9be30a866, 0x1aaa5ace7d8c80,
+0x1e124051fcd7e890, 0x2733d36c28de35d2, 0x6cf20b155695ea1d, 0x141dab17623b2caf, 0xa2975036ba5eab43, 0x2e24a2709d1f153, 0xeba3679a6caf8e39, 0x1c149fe3e0b1fb,
+0x211597977cdf2ab3, 0xac44fd221ebf6d27, 0x8de20efee5cdeb6f, 0x408a50f771f286b6, 0xe99f7c25d4362fe1, 0x5d3e32d7141ee57c, 0x673f0204ecd30b80, 0x2aae07d884ed8e,
+0xe7643e5b291c4ae0, 0xd92634cf7a26caf5, 0xaddd3060dff74933, 0xe64fa5221a0dd55, 0xab789a26378ca632, 0x57a13547b820f7b3, 0xcb8611f7c5c476cd, 0x149f4e38ea83aa,
+0xa57c2d42e2771053, 0x4a73bbee8c5d0fa3, 0xb2b7e9e3c52d333, 0x3c5d961d4973bf14, 0x673127194bb77cd2, 0xfe31c15e432898ff, 0xafa1cc0537dd7e08, 0x319e89fcc8c32,
+0x97f0d114e4b7bd97, 0xc673c9670fccb409, 0xe9d25976d7fd2904, 0x2972d23329102589, 0xf72fc33f38de4efa, 0x95d44d5f58cb3ed7, 0xc6e4ffbb835cf559, 0x1df1809fe202cf,
+0x15875b82b01c3e29, 0xf4a4d5e1fbd86c1d, 0xd4d04700613d0333, 0xa85ccd11d242f157, 0x2c6e56b30ba24448, 0x12437ffda0d542d, 0x244dabdeba8f6568, 0x26b3f7cb5b589a,
+0xd5c07dea9bd4f663, 0x17ae004a8b439227, 0xb1aa7c7d20810ea2, 0xb44c65a604109936, 0xa8871a7dd839f703, 0xa9f794d0a9bf1fdd, 0xc79ad78d454f1dd9, 0x344e837a131db,
+0xb2982add0384038c, 0x11438e25c0d9f4cd, 0x16ab0f392b205c5a, 0x309749fe93218834, 0x4256b474dda05ac6, 0xfd138c081f96b57f, 0xbebf1605e80d27b3, 0x2f07f35aa3db47,
+0x238f6f6a1401df38, 0x2926406fdaebb47, 0x55f592b850e34e3e, 0x88507d3f90bf9cd1, 0xb4c7f71193d85a5b, 0xbdf5906af0edb569, 0x223189b2cea1ef4e, 0x426565bf7ad53,
+0xe836ac40922df96d, 0x6a648d5feb7cf523, 0x8d2d23c1ad5d9887, 0x1232119ded72bedc, 0x1d47957e1c584c79, 0x2c582e215cd6c693, 0xe99b93d5312ffd6, 0x39b4131247e972,
+0xf6704d012b250412, 0x394ad8f4a73581b7, 0x23dd83fb29ffc036, 0x62501da8905bde6f, 0xfb468ac81e24aca5, 0xf0b88d0fc90e424a, 0xebeec12aea67ec2d, 0xa5a3edf11bc40,
+0xf9f1dc89fca6bd60, 0x4271e53abc8f1260, 0xb71d5cbc9451e20a, 0x6b6d35e0d7d3790d, 0x13a8da817ae1f3fa, 0x8b7ece3cf7940ad8, 0xc14cc3421b5a7d98, 0x3d5abf2cd03e75,
+0x8dbcc16c40848f3, 0xa4fb18ac7e2db279, 0x355ade71b4bb10d7, 0xd64ad11abb1fddec, 0x440d9ce9c322d709, 0xd4c22b2a33aae76e, 0x7b420b29159b5743, 0x3c362bb737d0e5,
+0x9dcc7a51ec0d7920, 0x31e0406b9a2667a8, 0x508d36bc0f01acaa, 0x29df08c00ce9f5, 0x2e6470739df695b, 0x941b5a380f691d99, 0x1899e89b2eac6b2f, 0x805660e8ed4b9,
+0x207655795f5d2adc, 0x5d5477da9c7d11c5, 0x41212f9d7c7e7972, 0x6afeece8b6194d7c, 0xe664272694d338ea, 0xcd9fdadec45bdfb0, 0xf580ee41add39d7b, 0x1bbd580e8d4c28,
+0xfacd8b3770d70307, 0x82a66d6986974e18, 0x547f4d48ae611587, 0x160921d3650cb700, 0x60801a978d0d9fb7, 0x277c9cba8f9678a5, 0x3f7dcfbc9397374f, 0x3e1a4e28ce9d8e,
+0xd40a3759b50f7573, 0x8c11372753f4d466, 0x9e4984b03947d2bb, 0x666c8d2e04ae1e88, 0x5e892c34f0da0791, 0x1db46ce01e3d2e04, 0x80befc1d62e1b981, 0x6fb2d6904db2a,
+0xc0a247363371e214, 0x6244f1855c34abca, 0x22d7d24aa782f9f8, 0xaf15a7bace7ae9c5, 0xf3beca4247a49b3d, 0x1e147d42b5c51f7b, 0xc3c945efbc2f5ad3, 0x2a0223524bca89,
+0xac4f9443f66b432c, 0x1d0ddbf46d6d1c9b, 0x29bcacd7488e903c, 0xe6b6cce47b05c372, 0x4ec01e1801a44e09, 0xa89853c5d56e9303, 0xd03ee464e4d6fa58, 0x3533fbf9b5450a,
+0xe16c3fc0800585fe, 0x6ed610e487274cc1, 0x1da178da6582659c, 0xde8f0b3aef3a2275, 0x244d4c02a10ed112, 0x4b3b5ed123c7a16e, 0x92b479189c96da1c, 0x3f21935521dafa,
+0x726fa5887421adac, 0x1676d2b6343edf71, 0x64f870687ce0f93d, 0xca750118fe836d7b, 0xe6dc2ca8211a6a50, 0xa94b4b725a483502, 0xfc1e2f013636d275, 0x12bd210cf7bdf8,
+0x6bd45df51b99eb3a, 0xe7ca6fac72ddcc49, 0x1ab6c13b5cafdddf, 0x4a9b0fd485d0ef8e, 0x8477a8e273011a56, 0xedd0ea6554b39a6f, 0xdf6ce01a73fc4518, 0x118bda0e8d2a30,
+0xa51783c5282afda7, 0xfeec0fad02ec4b8b, 0x20e1160fe31bf48c, 0xd938366a30c517d8, 0x11afdac765246a2b, 0xd3c0e62c3c89d380, 0x90821414dca9e2d7, 0x2da22221ffbf0,
+0x769ff757c66152ae, 0x194fc8440266bb29, 0xd4079781e2e3f77a, 0xded7b62ba31ddbd9, 0xe664e09e8eb56a7a, 0xf60978f1574d7e80, 0xb77f3a31301c9df8, 0x17ef2ba5c74278,
+0xb3c9b84619b8d4de, 0xfe3b26596e9ae390, 0x3b181af8f821a16c, 0x82eb3dc41eb82ec4, 0xdd678b35a1cb78cf, 0xde1d8e6c7924591, 0xd7bb4831acac16ec, 0x1efd49f411a026,
+0x5020b4acc59b2ca1, 0x1cb378e32cb68a04, 0xacd70b0cc6d9e2ae, 0xadc03ea941c873e5, 0x85e911d67a3ea9d1, 0xf37b59dbc243302e, 0xf3f262639f775eda, 0x2181f90ffa69dd,
+0x28d8120d87d9d4f0, 0xb9b823e7bc73625a, 0xd678d51fc8768462, 0xe3b1eab4c8dd494a, 0x41e662d3d811643a, 0x8bd055f903899426, 0xbc9ecdf87231bac8, 0x35f75d2d66d188,
+0x2e5f351bbd958e60, 0xdec9b0a609fe3aa3, 0x3648c9a78778d84d, 0x6ded38a41041bceb, 0x6950276e04c12656, 0xfec95cd43da8d041, 0x3c8f03e93c367cbf, 0x3998ef951a8b17,
+0x3983a001ea896008, 0x1103d63bbef8e930, 0xe8141486d35b1298, 0x8e02f260f0c6e817, 0x283292b869c9c940, 0x17c9ddc498ee5f7, 0xbdc0dcfb8d8474c6, 0x2db7c1efb55e34,
+0xb523943f5fdab9e7, 0xd275d27ee4cc7c0f, 0xd76bc10f1ec58207, 0xe8e26a59c19aa01f, 0x105e5ee1cc7e2a58, 0xcabf66d6b22f1c0c, 0x3397df8480cd13ad, 0x245746e2d7de6c,
+0x7dca9c4ffbfea1b6, 0x192e528224b9f36b, 0xa84e0b587b1fdb5, 0xdd3c3a2bc31fe8b6, 0xb6112b61e102cd06, 0xc1b6c468372014ff, 0x1d29ad56625ef3c4, 0x2e2e34ceabe49e,
+0xb021f74a5c300a94, 0x5b0798959b5687b, 0x627c383c8833bda7, 0x4815f1caf6526394, 0xa4b16822b100e206, 0x561f66d0af9cc82e, 0xad3844f9dcb5d57c, 0x37e7866ee8a229,
+0x4a30150e850ee52d, 0xb5be846b31dd3a8b, 0xaf001cbc2ac177b6, 0x9a0cb22c8ea94c89, 0x6debd5758789f08b, 0xacbf2bb51278d4c7, 0x9720cbfd0650ea4c, 0x31310b0c2848f0,
+0x10840858b0bb5969, 0xd23b56eb810ed18c, 0x7d3f52f295e011b7, 0xd4ecce1558805800, 0x7714c1c556efebb4, 0x178fa9779897313, 0x7095c2ae42be70da, 0x1934f89aba4728,
+0xc204042eb242ebc3, 0x2f1c48be1609ef4f, 0xf4a847703272f45d, 0x8c59759c024445bb, 0x544a0988c4862d22, 0x90383fc6156b6346, 0x8759bf97799a8f3d, 0x5f8bbc47131c6,
+0xe7b8d43ab9ad0395, 0xde4b5ce9fefbc5e2, 0xd8c54e2dd08df51a, 0x84bacf96248501ee, 0xacbc6c1661d5e2c, 0xb12b324e7626d889, 0xef101a233f623d2a, 0x30c9183cc4ba47,
+0x45f2b1ef43e11ff4, 0x39c590a172f977e, 0xa4f31cfe30351805, 0x9034cc39e45b3418, 0xda435f78dbb2a027, 0x10b561bbe8be7551, 0x99e91fcb3bad3ce3, 0x300818aa76c815,
+0x531396fa399cfb0a, 0x7b95c0fd8757cae8, 0x1d0a9ebbfce77ce1, 0xc76a8cd252b95c07, 0xd96ac65b542d33a5, 0xd61593a31b465a25, 0x409f8d0843ddc285, 0x160ab15b1615fe,
+0xdbe89fcaffe9db54, 0xf6fc61965c66ef54, 0xd56e64883efc8c6b, 0x47e0e6d5f2feacb6, 0x4cde0b878466c45b, 0x1463bc52c9e76b15, 0x10630b0882324de0, 0xf6950f21e99f1,
+0x6962ebcf376ec10d, 0x6c0fbde638e03711, 0xdeaf9847ab6c5369, 0x30cd3d39e4e3b904, 0x930493134f6a86ce, 0xe99e68f62dc5556, 0xbd1e2bc05d154baa, 0x2a90c36cd540c8,
+0xee4d0e46458fa686, 0x9a0799415fc507c4, 0x429ec89d3e925203, 0x19c40ef12e05a705, 0x4ca99cbd8de77ffd, 0xf71c717b8de84cdf, 0x2118e4640d49ec7c, 0x9efca8f7f9f45,
+0xc938d800cdd22ff7, 0x9a19a0f949b0ffd0, 0x641d09ef6a6876b2, 0xdf5ba7dda9b67a30, 0x4d00333eed5d6bc3, 0x73a8966d4982e4d6, 0x771cd2f34da37d5c, 0x11e16546596ac3,
+0x11a76e405114f7ac, 0x56ecf96a412bf754, 0x8623cef7084c891, 0x8bc3ea4d58f85a8a, 0xd6002a93ccdb7dc, 0xd902b4eb2d9cc02, 0xace2337fea354962, 0x3f256e79ce9eac,
+0x56f0448af48f77e, 0x732474bc96b90f6d, 0x41bd2a58a662d92a, 0x55c56423ffbcdb8, 0x3995c17016dac871, 0x616fc7567a2442f3, 0x9e2e43d25b315897, 0x186c634b853d05,
+0xe9f67b5625f5a41, 0x644d19873c84a1c, 0xa408dadf509c039f, 0x8214d7266ac91eb3, 0x7e53f617fa48f934, 0x2c43659a35eed4c5, 0x11ac8cd36ace83b4, 0x3bba8d14fc838,
+0x326e7707dbaf3b44, 0xc974444750e9197f, 0xe68a4580bbd2b575, 0x32e49a9ebcfc32f7, 0x7f7836b8587303b4, 0xd1da706fa75886dc, 0xc19bf72f246b7dea, 0x3c2673cd369d4,
+0x1a6b1f3953cfae2e, 0x9d942a8f71b7914e, 0xcf20cf94bf3e63d6, 0xec697c1d8c8610e0, 0x195599c98e66a49f, 0x65d2b56d04d2e197, 0xc5af0808afbdff15, 0xd7b9d832c7419,
+0xb938606538d2e35a, 0xe066402bec86fb46, 0x3d717129ece111e3, 0xd6175640dd2f5556, 0x6402b11efe03d18d, 0x1df0474cd636bcac, 0x1685e1b3a95e02fd, 0x1a1b41b81889e9,
+0xa56f0351820e3207, 0x708c03b848f5d67a, 0xbaf66ebb5783dedb, 0x5daa93cc8db8c8a4, 0x52d758e91b650127, 0x3e697cd341cdae20, 0x201180917fc2c5b3, 0x1ea07ac72db3fb,
+0x790304632b05c295, 0xa3949de3165f28e, 0xe81a28d99910fb1f, 0x9ea62e62896deb5, 0x9a9011b22d5452f6, 0xa862752674fbc8ce, 0x4b13a1b8483285f9, 0x29573c8573c803,
+0x7179426ed33a00f1, 0xc95c088db6ac5581, 0x4e9ec64f542ad219, 0x7153ec343c4bc3aa, 0xba1dc1dd293c9f8f, 0x1881cabaedeb6800, 0x9dbb555031a241ec, 0x71ad25d8053b,
+0x5c0cba997a824085, 0x434d27a07247cc24, 0xad018016d8c15586, 0xe41e2fd2d8cca16c, 0xc4975b92abf03546, 0x3e766cf785440089, 0xf2c9eba6eff8f7ef, 0x357e05442dc70d,
+0x543892a29ebd4bcf, 0xf126b89ce28b6d74, 0x3490adeddd9db422, 0x10c19f0ecf7e4295, 0x8491ad19cc9a919f, 0x84333680cd1d3c76, 0x9ff622924cd10056, 0x3332da7868e3f6,
+0xf3e4bd538d3f62f0, 0xfe76b4e0ae5fbc1c, 0x3ee585c73013aa36, 0x96693855807e1a67, 0x6022d37e7c2fc80, 0x9eb444662685113f, 0x5f132e3d14f2e650, 0xfc53253117340,
+0x5a23d7097afe9b54, 0x4ba7f47509629779, 0xaf5d57a35c2a3d17, 0x86f2951158cadc6c, 0xfeb2064f2290c6f7, 0xd3161c4d38c832bc, 0xe4d8cc0f789c0372, 0x1d15e448d9da52,
+0x7a460efc62e8d521, 0x34862e5491cb46f8, 0xe47299a85d86175e, 0x15c6d71bfec15dd6, 0x4b329cff4dbc36cd, 0xf00545a69b017183, 0x3c3256aa48d7b713, 0x4e88e8ca44184,
+0xcc81e3420d982c3, 0xab92137f330c7467, 0x865588dea233f218, 0x481b6bff4d833028, 0xe7600e463c244670, 0x43d3526e6ead65f7, 0x85547808cead62d, 0x3e06f2419fa381,
+0x54b319d8cc2472d4, 0xaf2c5bce6d7602d5, 0xcb6ec77a8878c1a, 0xb3fc589a268eaae2, 0xdf445b6fd757e657, 0x542369f3eb349695, 0xd5adb75d56c5083, 0x214ca7328f917b,
+0x4c7ef82370759c06, 0x8dd04d3829e397a4, 0x1d83974e5aacc19f, 0x85730fd9756cb8a4, 0x21d94b25747fe587, 0xf437ec7a34cb2bc, 0xcd158099608ea822, 0x3c864c8e3a6669,
+0x71c6415d9fe7708a, 0x92eadb843c6fce84, 0x6dfa3beb91ea6c70, 0x6030bd32567d228c, 0xaf0e82a35c872b9f, 0x2da0cfa3a529567a, 0xda64e949ad90c0e7, 0x26dc47b622b3a,
+0x4a6a9d37fc21ec18, 0xdda86acbcc2f7dbe, 0x3440b4969273143d, 0x6b6882a1d3ba62ba, 0x36337af4feedf4c1, 0x1c4f2d55055a5bfd, 0xc58a6751558763fa, 0x30662c48c07023,
+0x453b86733c33f2a5, 0xe3bf68106d58e1d3, 0xb3aabd98567fbe6f, 0x84ca909d880b1e48, 0x63cdcf02ec53eee0, 0xc4bb9681ca4b8f90, 0xcd5528348b0188b8, 0x3cd82ec86f4d42,
+0xe3e6587311639957, 0xf6787f90a5ce516c, 0x588ff98ef38c003f, 0x38b5a489c0844d54, 0xe1da75ad48771bcd, 0x9c3b3088c0b4e714, 0xbc05ac5087ba28fa, 0x1d0677df74a37,
+0xa9dfac49f9d345af, 0xa47197e64126948a, 0xebdb557b81e81067, 0xdbd332c5212ddc16, 0x220f313ba2ee61b8, 0x8bfee7c6c8fd62e0, 0xb3ce45ed782d1f83, 0x38aa5dca7c7fe3,
+0x3e22c6b16a4ba033, 0x446ddfb85e28d127, 0xd1c645847919465c, 0x132d371f129915c0, 0x5baa391164c763a7, 0xccf08ce4106c28f8, 0xf0436b5832ea8368, 0x2e8d77f3ee10ff,
+0xd4376b00b340b91c, 0x6d2e81cd8a22aebb, 0x12a93d648382910d, 0x4d3e2a18e8c1fbc6, 0x292ccbc1f592df30, 0xa441a9c01614ba2e, 0x7b2ed6e44c938bd4, 0x2dd72d0b63f56,
+0x9e561eb27ce34b7f, 0x9b8c5d4a7abf121c, 0x5402f230e6b89fea, 0xd3900ec4bc8a6baa, 0xd7dfa587546b524b, 0x739cd0b366da422c, 0x8b25557a53c3a922, 0x135e45d2a0b08a,
+0x87b86c04c47aec5a, 0x1146c6a21e5e1c8b, 0x672ae1dc82f85966, 0xb33a33e56ceffc3c, 0x106001e4782cb1a4, 0xccaa121abad36f4a, 0x5ade1764ec21c79, 0x3e965ba4a1a136,
+0xe250c4b0a2977406, 0x7b809a99535facc0, 0x43352555443c08d2, 0xd21b6ce2da1eb9ad, 0xdd9281afdfa8dd38, 0x11671cc5956070d9, 0x1be9907f79a4f55c, 0x29832a8a382a77,
+0xf51d8d7d1736140d, 0x51c9f642f10336cb, 0xf34c255ce4534db, 0x87f2b51227db7582, 0x978423e7a94531c7, 0x892a85c273389d1c, 0x69862ed436e0db4e, 0x26adcac88752bd,
+0xc72c52d8cc2b39a3, 0x87074c39d550e7bd, 0x488db66ebd072412, 0x11c2b838ad497299, 0x2efe735e828ba088, 0x39459d5d234c2d8f, 0x3a0a74121c76b3a5, 0x226ce2f1c485ef,
+0xd15bb34ee63d136e, 0x5e5f8a17556a3a0f, 0x4997abd2e3198758, 0x12b8dffad24083c3, 0x24905ff2d46b70ba, 0x2a0a81f1161fe778, 0x28c7fbc59f8da3c1, 0x31a2d51495e9b8,
+0x6b9ea88e09fac80a, 0x962ac02025e37910, 0xf7aef98f102a185d, 0xc8301427de8f32bf, 0x311d5a99a3e66ae9, 0x86ffa4a7dd2a6264, 0xd3da7703120a6cb7, 0x29d5328b762c7d,
+0xe4aefe0cbabd7e6c, 0x3c2b0e5ac89df12a, 0xd599ef998d3a8149, 0xdac1492ae35019d7, 0x1cc606132a3c08e0, 0x98f721c3e4aa6321, 0xba43c34e083b4cc1, 0x20d62873d879fb,
+0x4683641ec4025726, 0x7fff9b467854dbb2, 0x1c336f8be4bfc89a, 0x20a94b7f5c212505, 0x12c1d0e912d95c0, 0x6cd81b70ef7a732c, 0xdae248892ecaf182, 0x1549440735526b,
+0xfa1e0e3ac620c56f, 0x5eb0efa160d71bbb, 0x8642fdf632d5eada, 0x605c7697791fa569, 0x8652002f8cf906d2, 0xa014f3c429e8566a, 0xdb759d59e93895de, 0xfde585ff9bc3,
+0x2de16d82f4f83c09, 0xf9b162b6438d8dee, 0x6cd67f54429a923f, 0xd235d4be4889a969, 0x8e0aac5a032cc0e9, 0xe807a54c6f6c6846, 0x4468051c3edd4ec9, 0x2ac7a39fd3c4e5,
+0xb85d9d098796b113, 0xa30beb0520d28f9d, 0xb41131625252bad0, 0xb335024e589bb760, 0xd9768e626454ebb4, 0xbf66e773ddaafe7c, 0xfd12526fedb08f36, 0x3cdcc46cb873cb,
+0x5e9edc5b0af3ff6e, 0x45f054fd28b6fcc8, 0x1f3e26ec5ceda9d, 0x7efe01beaadff973, 0x4d0a56ba93b9da0c, 0x2c6e14fba94ba750, 0xf12417c80009e1c4, 0x3eeb5a2589ca26,
+0xdf221e40e8eab14b, 0xe00e70aad404ea0d, 0x15bf3851c0191f32, 0x968d459f7dc0b36b, 0x84ef040d0623e13d, 0x4b1bd137d79d6e87, 0xb66b9fd2ee99742b, 0x6094771499506,
+0x829d14be24d678bd, 0x5d8840379fde8e5, 0xa3104bc1499655db, 0x54742ee25410d39b, 0x413027a42bc6a9c, 0xe8d8aec5094b7f73, 0x8a3df4653f45234e, 0x77dd8945a3ee7,
+0x44f9f412d74c6f39, 0x259c856eeb13b7ec, 0xd1c6d26e90149d51, 0x3e3bcf538f9b3376, 0x1a803747214a2ce, 0xb020e263a34976d5, 0xfb61f65e59e831fe, 0x95e16bbe1788f,
+0x34bcdca3c12a11c2, 0x89f69ae2f5351851, 0xc8ddd267f8de2e4d, 0x4a4aa6701788ed07, 0x9a2524271ef40484, 0x63dba87ec88898ba, 0xaef999e2d84bc8f0, 0x866e7ed46d87d,
+0xe8263e5e5ea2b996, 0xe78b70a49adf4544, 0x38e35ea428938131, 0x6bb87f68149b4616, 0xcf652016aee43d05, 0x2f7bb1e23fe40e7a, 0x8f4cb5a6956f228b, 0x30a74a9c94049a,
+0xce412a0d76a424e, 0x2e107073aea4716d, 0xe8dd20136e3deceb, 0x9950e331d3cd5fd1, 0x209e1c47e79ac7f9, 0xc01d923ee7638c07, 0x4e73766a6818bcae, 0x178ae112a3c7b4,
+0x97d23ffe36333567, 0xb5c037ab8747cdbc, 0xaa511ffb77bcec47, 0x9e5b41ffab60ff66, 0x3d37523411b16aa8, 0x4ff0f16966e02377, 0xb1297ba7741d7218, 0x14b75c603ec9c2,
+0x496e098abed640a4, 0x73e8b5ab35826c9c, 0xbd1c6e20ce647f2b, 0x80269b1850b938f, 0x154f9848133c3f31, 0xe019fce36f9dfcb9, 0x93610e0ebe7c4496, 0x93ecb184543a7,
+0xad4a881b2e88cc7f, 0x27ebc90cde4f12f4, 0x24e23f1ed8f5df83, 0x8403fd80b17d7869, 0xc73cbc00021ed2c9, 0x5279ef77b799abdf, 0x2d5f6bc28f992224, 0x29f86570e72c78,
+0xbaa49be6ee62ae07, 0x9258c939a57d41c1, 0xf3d3f452b6dd9d5a, 0x88ff98fe150b154e, 0xd2ddfd099ff0acce, 0xeb874a016b9b4bc3, 0x26c76dba66e6e848, 0x4008418ca0ce90,
+0x1e5d4db016d6dae1, 0x60810577922ad712, 0xddf55b7b8dff7bbb, 0x2044bed8bc622ead, 0x32d46de576beab09, 0xbfcfd62a1953ff83, 0x3af871ccf7aa392f, 0x19d2c79120494f,
+0xe28bc975d4af7d6e, 0xf5efccf475372dc1, 0x114e5c718c28321b, 0x81e0c09d630107b, 0x225c4523f5d6e08c, 0xec4688bada594696, 0x554e05572501567b, 0x11f9ac36578e8b,
+0x998e86cbe6981864, 0x76e727568da2eec4, 0x739fcae7dbecb7f5, 0x3d6622d49bf45acc, 0x530f9a0e17efb2d6, 0x4fb728f2b9cb84b1, 0x95f65a414bc1fda0, 0x191c3017705745,
+0x36fba41e43cfeef4, 0xc458e09b37e39aef, 0x95cc9a3f3d60873d, 0xcec95b64da9d0abe, 0xe891306ebf52f3e4, 0x4ec7d58e63c791c5, 0x1978a4fb990ca13c, 0x2f00d1d8fba14e,
+0x2eab9e15274c048f, 0x6969a8c1610c10b8, 0x75b82a0438e77f55, 0xa776d93feac3ef36, 0xd5bdb0397c1e273b, 0x260df05c9a7c2ea2, 0xda93fc947b9f08b4, 0x3e98dcd4a39ec5,
+0x13babf1b93da299c, 0x79920d4476f87b50, 0x98525ff184c8bd04, 0xfff80f2646b02141, 0xfd8651f968349d6, 0x25812cf1b7e95a24, 0x2e779aa7e87b6316, 0x1804219e8f7b44,
+0x3dd22a101e456843, 0x7912fa6eff8c339e, 0x7be00ac8fa38f9b0, 0x28c09da517398ed9, 0x1f051269577dfe61, 0x80e901f3fd1dddf4, 0x979d63f6263aaf10, 0x353437fd85212e,
+0xa60fec92edf44464, 0x186e882e4255eabd, 0x7e0989405be0deb0, 0x8a523bfe10abe192, 0x303a799f830de9d6, 0x97b1e025ec8bcf35, 0x5ca9ffb33e098eb, 0x3ae1b806c66fa2,
+0xf47cb97cf4438ef8, 0xe7567105cb5604e5, 0x8e5bd00fa2cae8a2, 0x289d90446d6239c5, 0x3d9011787a5ce2dc, 0x98cde19635a99d91, 0xb3396658789495da, 0x176da750c2d98a,
+0x4c297799121772e0, 0x747d2f84cd600809, 0x2e7b25819ee45490, 0x4db7c5ffab4c95fb, 0xe959b7bd11c5f2e1, 0x8925bb8f8c3d4a99, 0x332474f0eb657f4, 0xb723ab07f4fed,
+0x3c5a5a659bd9b6a1, 0xcad48cbfc8002e65, 0xce6204532fe06bd1, 0x64e9d22a5d7c4aab, 0xb4d20b5e7bc204cb, 0x360623a934dccd69, 0x8cd1944767b88d3a, 0x8792ee1c6eba9,
+0x239cfcbeb3f1e2d0, 0x4f4d02f5886a6424, 0xc9b359b2ebe30ffe, 0xe6cebb65a4e90bda, 0xc320da43c6e7aa79, 0xa8024830842f4a8a, 0x7a46dff32c3e8dd6, 0x182371c5e2a625,
+0x1d556160bb0c2bd0, 0xde05f26efba01ce5, 0xa1f50d05bec43f7d, 0x3665187751be335c, 0x7b14e496214d2aaf, 0xa14fafda48abfa1, 0x34c0257846a8fee1, 0x89cc230ce3e46,
+0xa8d8e2b1eea2f678, 0x100ba033690c2a69, 0xe6de109a98c4afb5, 0xbdffc707f7b6bc43, 0xf9ef40205a57cc14, 0x62e826cf2215bdb4, 0x80ed1996950957c3, 0x1a6cb3477d1fbe,
+0x3734516302601996, 0x2461eaee6a0fefbb, 0x864f42158b18d2b1, 0xe05deedef139bc04, 0x85c5cdda9df1f77b, 0x136b6bc475fe0d05, 0xce87f5c11ae482d6, 0x3f9d58f7236acb,
+0x2680476ec17cf0c6, 0xabe893014cf95cd3, 0xf0364eaedf0bdb45, 0xb2bad4d4b06ae7c3, 0x9a6c75c9f484052e, 0xdd0035947af5f314, 0x9a5bec28269ab97c, 0x220fc89c6eb57a,
+0xb8c19f0909188095, 0x4ae92354f1c281d7, 0xd1ca1dd10916e56f, 0xa077f725aac3accb, 0x9c3d694a625f846b, 0x5f9ee25121cde32a, 0xf0413a9bfc2347ea, 0xef8efea647173,
+0xfd74ae5fe556c761, 0xd06c0ec19856f3b5, 0xeeac21bf0ea6160c, 0x8516a0565e9554e4, 0x8ee3b5855cc1278, 0x3025dd3fc7c347ea, 0x8512196d42276af5, 0x81417f5bb2e18,
+0x7623a9326ca53dcc, 0x4e937398f4f085fe, 0xe98b8ce58aa88498, 0xd2ffdd7f6aa2fd8c, 0xd85cf1462395c453, 0xd00117764180b843, 0xe288b98abbd8df24, 0x379b8f9e1c440e,
+0xd597344c4cd9fe7, 0x22f16dd571891ddf, 0x84fe66095294fed, 0x4df32933001f4aac, 0x8e2b154d68333652, 0xb1dbf8247b15d83a, 0x547160065ac098ae, 0x308f112ca00527,
+0x3aa2a4e9612da220, 0xae223df595b10ded, 0xf9286ceeeb7514b7, 0xe3ed06faed9b91fa, 0x6a2249af6441968f, 0xc60d05f36b0b91b3, 0xa21ed0e2861095c9, 0x3f96f40b53d19b,
+0x62c4eb49b761c1ab, 0xb6d878926f4b22d0, 0xfde806e02d71d9d8, 0x449744fb96838d0, 0xe0cf7fd5abb8f4ec, 0x2417cdcbe5db4092, 0x1b81b71d573c1f, 0x97d9dfc1ee850,
+0x25ea5177b74ca8fc, 0x667a16a861a0200, 0x21a67bf5638a9455, 0x4c4ecf1c74f27a77, 0xcd31c1c95b76061a, 0xee187c4ee1dfebd2, 0xdba458303bfcbadf, 0xc7fd57ba420b5,
+0x64b9eee5e35c2444, 0xbb41aa21636bd426, 0x91df189f449d3c30, 0x7bfae7ed0c528e61, 0xb0cea198bfc0e4b0, 0xfa49e6640dc66bee, 0x4664fcad423b133d, 0x1dd4ab2ded16d3,
+0x123c161f917a74e0, 0xcc6350f3cf03435a, 0x5ffce01597fbf45e, 0x91585e47f51dfda5, 0x3eb8772cb20a9914, 0xe61d42041f6467d9, 0x4e38182c3cd0fb51, 0x3474d1ea7a9b43,
+0x41cdc8a2071c60d, 0x25826d3db93806ab, 0xd92027eed1694bdc, 0x8de6fb07d99744ea, 0x6bdde000c138f89a, 0xa8774e851061ce3d, 0x21b6181b1779ffd0, 0x28dc616e4b718a,
+0x90219fec05b49e76, 0x348fb16f74f0c601, 0xd7af8d6e0d7aa5a9, 0x6efa8bdf965ae5d3, 0xce8a50b8a574e9a2, 0x9befc93c354f1ae5, 0x43c6c7e8dd91271b, 0x1e45debcf75669,
+0x3577ffdf02860089, 0xa1b06e6e8bb9dcb2, 0x8f2ca26dff593e14, 0xa6d25d9dacf134f3, 0x67103131b284c319, 0x93ee08ed21243a46, 0x3e67919b206e472, 0x29d1bf8bf5611f,
+0x18f0b612773c873d, 0x877e5b174b01a0ef, 0x4c54692dfb0fa3c0, 0xbdfffbf686177669, 0x42c7b7becf07b5ec, 0x43f8295155a55523, 0x335a1cac0ce786c7, 0x16bbbb0f738d1d,
+0x530087a2685049a9, 0x997a435e795c8b70, 0x5c4746cbec6fd705, 0x4f857fd5175d3663, 0xd661377857b2f30d, 0x86cf368a1261ee7b, 0x4e93d2aa58f8cf2, 0x38b676053beb32,
+0x63d0f40efa027d5a, 0x2846fde6d92ac4fe, 0x29aef49497c40615, 0x1b42fef4743b87bf, 0xdb207c0a79a196cd, 0x8bdb7204079a29c7, 0xe247e32f34c63ba4, 0x69ab83d781f71,
+0x2b83b1ea24251928, 0xeb98bab370452b04, 0xf40c1b346b31e59d, 0xbedc0e75efff038f, 0x6f019b5f857e0c0f, 0x7d4d9402544abfe2, 0xb62a15c63ebd4947, 0x373edf6efc3b0c,
+0x5293a5c1cd021abb, 0xbac47914794b2ee6, 0x83e8ab18dc277580, 0x310c8db5d8b64097, 0x9f1f7952687fc332, 0x9685fd06f8ccf1d, 0x1b49c8873d57b460, 0x1723b211f18867,
+0x6b35994af1ca3266, 0x5dca98968fe41d7c, 0x501801ffddec636d, 0xee2cc66971405b75, 0x7fac2b96a813a90f, 0xb221f334cf5e668, 0x47a5d57cdc00bbf2, 0xfe937bdba3a7,
+0x4e9466c22e81aac6, 0xa1801e2b4d1384df, 0xbb39b69eed1710e1, 0xafab7a3cc180d48b, 0x5bfb435c18d2f601, 0x3862c3241eec8dee, 0x84a9dcd288c6c824, 0x1a4decd3e5ccdf,
+0x4e0740e13cdaa103, 0x1f2e418a6606a082, 0xa28a77387b399bd, 0x662ea18dc74e21c6, 0x8ecf7e994e1dbbb4, 0x257a245c676b1dce, 0x7b83424c9493809b, 0x1a75993da1a451,
+0xb2f8b399f8791172, 0x9d5aabc564a5fbac, 0xc02f9f19a52901d0, 0xddee5296be70f99b, 0xbfab693f856d9d13, 0xbd620322971b96b1, 0x7c86cffa634349b4, 0x67d63fcf495fc,
+0xc627cc7ecd1de5e9, 0xc66c56ac6f65f4e6, 0xb30e772b330ab4ce, 0x1473c12143c53637, 0x613ce91a4fa7a2e2, 0xa6e1f8ab63e087d1, 0x1e1d3bace7d6b6db, 0x3c0df831425320,
+0xb3982f2eaad2e71c, 0x70046ce886a0a502, 0x59ea49cad2363c11, 0x627775c38a7a7d14, 0xca4d998479de8202, 0xa9a6edc89a32dcbd, 0x3167eb55762230f7, 0x651bcd6bbfd1a,
+0xa6330cddd6aec4cf, 0x2589b6b10a1c6a17, 0xb87e26132ab3d271, 0x9acab5f4d7a799f5, 0xd9b94cda48a37eb9, 0x5ce9e377e0fcf207, 0xaf1b0bd37ea06015, 0x23a26e30134061,
+0xc83ca3a20c4bab98, 0x9536f2417ea22df2, 0xfd564468a55aec69, 0x9dfe983547624c78, 0x33d2ed0156fff495, 0x6d3943734a2c5343, 0x6746fffbef38d81a, 0x10c52497973236,
+0x4dc1c4877bc9dc48, 0xf8708745b079c4f9, 0x9cc1ae9ddf165ef3, 0x9da208032cb92ec4, 0x3033038123413b3b, 0xa89889758402221d, 0x4d5007ac2a594119, 0x3c480920227450,
+0xb38877f8c7868737, 0x22862ede3f684eca, 0xfbc93c7cb814df3c, 0xbb1f3cf0b4e867e8, 0x556cbc37fed5c2a8, 0xe800b64739e5a918, 0xfee706f755fd74ce, 0x3fdbc0a56bb47b,
+0x77260b337382cc0b, 0x466a28cc4c1916b5, 0x7032c62a2fada367, 0x97f9ac88386cc9bb, 0xc20053191de472f8, 0xca4b93e49ec423f3, 0x23246278b61fc208, 0x271da7c5d6a871,
+0xb0344959662a5e02, 0xbf8041ad49c698ff, 0xa9a272b30e06c57f, 0x3fd806a70fc898be, 0x6064260e0a6837e3, 0x847f5092009891e0, 0xe9bc21b4d42d88eb, 0x2675de2fcd973a,
+0xa0dbdefe00a7c3c, 0x234f8748b4b3a097, 0x84d97b7abde189af, 0xe25e0db63773c6a2, 0x4852c95b91edfca1, 0xc0f3f2a1438e30d0, 0x40083815c3e8f1cb, 0x357bbaacda124c,
+0xdad856970f358060, 0x95183ba93ea5d9ad, 0xc84f31b7374c1e3, 0xcfc5b468bb365f29, 0x8df28b0cd5e1c746, 0x30c888536f994c5a, 0xead23071579d3cbd, 0x92cb6d6aa53f6,
+0x3f3ac59b62d02e5f, 0x5b64111cb1eff9f9, 0x73267ed600b5cbc0, 0x91aa3942b5524f65, 0x93423757c29615d7, 0xad87d97bfd8b7f33, 0xcbe079aa15819a59, 0x2e2a981ebe8219,
+0x477b1a89de2ac4e0, 0x3c491f7d20424c7c, 0xf73db38604d70c42, 0x620a02e2ce11b9df, 0xfa717d739e39d3b0, 0x36e2425f175ef98b, 0x5c77d9d31ff6aa68, 0x37dd8954dd017b,
+0x2f2425d52722fa46, 0x5018eb475e2c644f, 0xced1ff5f479c3ecc, 0xb16e57a3b7a2351b, 0xd57a0fecc805aa32, 0xe882789fcb1c844f, 0x8a01b0f86b47b3f4, 0x1688488ea1b1e5,
+0x88f93de318ce47ba, 0xd9d54c2a56e6617d, 0xb814f113a36ae765, 0xeb952ae03eea4baf, 0xd841111b24fe1155, 0x6eadb76ef6471f9e, 0xb034eadd154b5839, 0x1054f73b1cf745,
+0xbbbda130364a1569, 0x42375e17b844072, 0xa83833aab45e103c, 0x7024422869721a80, 0x449534090692b943, 0x10ad5999bacc9a49, 0xb20d8a3e3538c68d, 0x185bef44df3ec1,
+0x76b2e6ed88a82a83, 0xb87ac3c8a5a03ad8, 0xc66bbef5a7d01448, 0x51880a8af804f718, 0xb889c273d8bd50e8, 0x51b417267ebb6981, 0x74e3db3ac255f77c, 0x18decb12d605d7,
+0x7b13d8f2f5f61ea0, 0xeaedac54ff340bfd, 0xf3cdd32af0af159, 0x1a6937db9719942b, 0x2ed8d26d9fec140a, 0xb5d21d8bec06c997, 0x7e7d9163a1b77880, 0x31b16e513c6416,
+0x15af7c0979e102c7, 0x3790b59eb5596016, 0x865331b3b8322b36, 0x7547af0c7414047d, 0x2f4a4f2e21793033, 0xae801d7ba317846a, 0xcc7981d547cfbf51, 0x3b44b99805197e,
+0x448d8d3f562521e3, 0xc747012ebad3045d, 0x58a01bd569fce929, 0x9f62aee32a5a5b31, 0xc20603497fb455d6, 0xd5829b547aa57ee9, 0x1668406cfaa38910, 0x38f844f8e846dc,
+0x5d4ec7ade62b5991, 0xd313bc439c27e1d0, 0xa3f4f6dc1150cd0f, 0x91136e3e2a469704, 0x73c2472a5dec6145, 0xf576b46e170b63ea, 0x98f5afdf6729680e, 0x976ab7cbd80d0,
+0x9ddb4e0b7d9959e6, 0x4f59bbcf93388570, 0x9f123e3969c8a637, 0x6f35a27074f8bc7f, 0x3de0c2164924dfc9, 0x80143d66239f9e84, 0xd7e6782ae5e9ed89, 0x33626bce9f62ca,
+0x7cdf4b3c0a8f2ce6, 0x9c60d9228ac76bc9, 0x32bc3f7b8d5344ad, 0x4511bdeaa638e2c5, 0x99391b33975847ff, 0x4075cecbd0a537a9, 0x95638057e63e8c44, 0x3d15a08f5e4d71,
+0x765951770cb0dcf, 0xe3d7dfb47a9980b9, 0x78edb7fd4cf668e3, 0x7625d28bc58183f0, 0xc64db579e71cfb6, 0x95c23fbc88d0f062, 0xa30413828f451224, 0xcea8a98bf9b00,
+0x45d2571012e58f2b, 0x86754a706234bf7e, 0x6dbd511d7071af30, 0x409312f7d7b7354d, 0xcd1d892d99cfcf98, 0xc5fcb930b07b01e8, 0x5ed13849298632e1, 0x1bab757651ea63,
+0x841d95ca72a1c92b, 0x15ef9a415f39cbcc, 0x285ebdd544ef3e0c, 0xaa8360cd4de60cc5, 0x90625cf7858ee40f, 0x405190078c78d71, 0xa3e984cd58ca85f1, 0x35f4e0e817584f,
+0x58a251cd18b09444, 0xadf77ef3b3804d71, 0xa8bee5d4d24bf8b0, 0xa7c45445ce61db2f, 0x661840ad8c674d68, 0xa3c4ba80b88af191, 0xaa9cd42ba94a4fcc, 0x373b36bc9ed5aa,
+0xa62617c5e972ae97, 0xd55c5d31f62000ea, 0xd4ab406677fda845, 0x78d3ce1744270890, 0x91f9661d585e84ba, 0x25b61d26ef00aa53, 0xb162d89b07f2cc84, 0x15e8acaa42a3a,
+0x654ed9ae79a0fd81, 0xa3496d3685891d7d, 0x49a45b1326006196, 0xf22cb25bf0141487, 0x521638b9e02cc771, 0xc489a683b388deb6, 0xd5ca8475143fee47, 0x3a3ebac3d2b48c,
+0x296b0bd2bb6961d6, 0x9ff3ba0788a7aaf3, 0x5144c4e4df2d2fef, 0x98fc6e16b974ea1f, 0x7789ab37c5a2c00c, 0x2738e848aef26a19, 0x6dad5c9b690ec5db, 0x7000bb7649218,
+0x4c8e83d894f7428a, 0xd994c5b1b57b48f6, 0xb6b9ebb459b095ae, 0x8c1056e65144e652, 0x1c52ffcea5c2a7e0, 0x67e2824191c5b1fc, 0x13688f140d9cc118, 0x39879283c9d0d0,
+0x1933e6963ccf09d2, 0xcefb10a7af7e9005, 0x6fd5cd669cd561f3, 0x73c7c90d8d6140fa, 0x83c7654b7c898ba6, 0x5b3f280715538ea0, 0x2c2d4c2f1e372779, 0x3979c06a6f066a,
+0xa84f1027ebb85b2c, 0xd4273449c4bb3b09, 0x59b474589afbd115, 0x2993b1652156844d, 0xf09bee28c52a3ea8, 0x6d541bdefa8216d0, 0x1acc807551eb61a3, 0x38a513c043b130,
+0x9193e7224fbf7e14, 0x6425e88ece94b42c, 0xee91dea81017e235, 0x967de8770bd6fe5f, 0xe0a79bb148237e5a, 0x700ded9f04f34238, 0x78177c7979bc6cf5, 0xff2d04b1ee2fb,
+0x9df69737f522cc21, 0xda6cc9035a478819, 0x9d28511d08050bd4, 0xf35f88dd1cb04ccb, 0x5cfd4765e9dc1468, 0x4622b0a109a3df21, 0x911db092b261e1ca, 0x34df4d700175cc,
+0xf7bbffceaeda780e, 0x48c5bc3ca7fd5ec1, 0x9460330cc7fd9b84, 0xa40088f6419687c3, 0x6b701271dd020c9, 0x2b6c05b03fe2bfef, 0x760cbfd262133f8f, 0x1c50f1bb47bc36,
+0x12db24e072fe2862, 0xb304ed56fa0e0ecf, 0xc804190c60c65a33, 0x4a579cde8c9a4edc, 0x1f35419ce9f700fc, 0x517dc6e11622233, 0xc4ad2c041ac4ad2a, 0x3dfee1e80b071d,
+0x8329d10104baa6ec, 0x2c55e7909bd16a12, 0x2fc614e69ce718cb, 0xb5bd185dfd9a6005, 0x247d68c21b21b1f3, 0xef08ba264634cf49, 0x83d22f19e8069b65, 0x61e6dbc463ef7,
+0x8548ec60cf017347, 0x44f3937cadacddeb, 0xce0930031fa8cbe2, 0xab1a1569cb02075b, 0x723df0c1faa08165, 0x6bc2047502589f41, 0x819bbaaaa39c99cd, 0xdccd35297f966,
+0x38ad04eba916d2be, 0x2a3e39755cf5434d, 0x7409225bebeeb85a, 0xac1d485d4a8b3a50, 0x6ed6d3b871680267, 0x59232244b3f6c6b5, 0x44f534c337386fb7, 0x84fe9d305b11c,
+0x5bd07669558df112, 0x70285dbc0d331ba7, 0x64fdfa5e5d328da8, 0x37ce823e8a5eaa68, 0x175101a9f44eb2c0, 0x58544362cc1a0fd3, 0xb8a2cf805092028d, 0x2a6aa2a6192001,
+0x1e0100eed689cbb6, 0x43f9ed46e1e4e9b1, 0x29a1e63db1debf84, 0xf88f422bfc0aac18, 0xbe15f1b23c4106e, 0x514c14a93f0db9a6, 0x5a1b7ac694411921, 0x2d81feefd3c823,
+0xe98f400abe5659b8, 0xa24eb8ffeff0efbc, 0x935c5759ca277111, 0xa5330df913ae9b28, 0xc47d645870009fc, 0xa5066a889bb105e2, 0x45922d13f943bea2, 0x27cba4b5241b13,
+0x5759c76e6e2b2876, 0xaeb5b90c889532fc, 0x47e4e360628129ad, 0x3208f4b24d8987e5, 0xd1c5ffe5b70136ee, 0x7c35b965a59025a9, 0x4c232d264afaa2fc, 0x11018a821dda7b,
+0x4282b1c5de1dd4f0, 0x67507ad3b769f483, 0xf96e489d154a20b3, 0x4e4ab1575edbddef, 0x62dd180797e3a820, 0xe7019818f1731313, 0x72af02c88b29c9e0, 0x1ffd8509d2af71,
+0x8da0177ab3ac5dfc, 0x2fc2a69c2bdab93, 0x9821af901999a336, 0x76e71847b000c1ab, 0x9901ff41ed78eb79, 0x9a3591103e9295e9, 0xcc789f5d2b5f9c51, 0x2d44ff2c27abb4,
+0xf1fcc6378950c5ea, 0xe31690bd5cea91ae, 0x5b1891f4ec467070, 0xbaae7e8d2d363535, 0x5c5e26330e7cb480, 0x3849a1421a86e02b, 0x78304d9aca1fe321, 0x1ae8f0cbd8075e,
+0x51fd794d31a98ff, 0xd94d8ffd998c46c3, 0x7ca0c99937ce69fb, 0xbe620051777a9203, 0x4684da4f34eeeaa8, 0xdbc194399c75c71f, 0xa0e23d4897db7b88, 0x2f90ea8a3ef1da,
+0x468827d01f1f4fb5, 0xaef2930d27c1e6a1, 0xe4b9f83c6f207974, 0x250d0db4a5a5468b, 0x77671fc8c1f3c2c4, 0x9de3238473678a56, 0xc7a4c3156c49a5e7, 0x130bbbbbda060f,
+0x7735475af849b977, 0xe1707cd8ef61e18d, 0xbafb9e8dc10e226a, 0xe7999864db214a6b, 0xdd06d9311432e966, 0xbc9a65e587b28bdb, 0x1137ccf54e504479, 0x11defaebc2ac3f,
+0x16aaa4a14292f0ab, 0x9e3ef90e27d944ba, 0x4cc7deb0103d6d5b, 0x88755e5a98766d97, 0xe17ad5651fc25503, 0x61f615b836a780da, 0xa23882b557f483fc, 0x1957300bc0df36,
+0x1d9b77fae3360d19, 0x925276a9cdcc815e, 0x69338997c74b753, 0xca6efae17da36a7, 0xffd6faf3fe05f4da, 0x90d95fa2fa37d689, 0xcebdfb699c43e3f3, 0xd1affc5890c2e,
+0x769de426f6bbfabb, 0x81e17e6bb2ab73ca, 0x9aeb43c1d82ae5d7, 0xc404828ebd4e3b47, 0x11adf2d27f851e2d, 0xf7d832bfd9b23e82, 0x55c825290da1140e, 0x2f7eb87d5520b8,
+0xef96ce955867622c, 0xabf76671af13e49d, 0xf2cd534f6ba6174b, 0xe96c3c39da399cc1, 0x3d772c0929802af4, 0x234604f2dbd61850, 0x2b1b68e2bb2b76bb, 0x2403085318d4ca,
+0x1c93d71aec9eb2a9, 0x8a196fda79733648, 0x12e2e3ec67b7cb72, 0x4aca7cd788bcc596, 0xb0d0589bd1775052, 0x77d5851967522fc2, 0xf7fcedd9977a673c, 0x2226337d349572,
+0x3d2e78884c54b378, 0x5a4a3515f18cbeb2, 0x535a78bb42ce19ae, 0xbd12c9396744083f, 0x8c230387ebd47783, 0x61e2c1d7ddaece44, 0xd25cb0b930b974b0, 0x3dd2a4e904f1c0,
+0x45283cd3183f54a7, 0xeca942cf0d4b7eb7, 0x4bfbacc16a689681, 0xf534151f31b9f51, 0x7b7f237c5177a441, 0x3294cf3cea8b848b, 0x96bc62c88344c0f0, 0x3a4837c6b5e7a1,
+0x39c0f4bdacc4c9c2, 0x82add31d7e285aa, 0x78be74df4b0dd23d, 0xe8f42e008d1769cd, 0x9baacaa89565d5ac, 0xd77b69b2331501c5, 0x66c772affd64b331, 0xa1017f2d7e5f4,
+0xf145c43469ed2ec3, 0xe7dc489503720db8, 0xf21f75f6c5d24d11, 0x9f78f2c756cbcf93, 0xc6079a981d4eec5d, 0x33a9cbece31385e6, 0xdbeeaf34293adbfb, 0x813acbd295f55,
+0xf9c44f282f8c9dc7, 0x4f05b06f5a2e292a, 0xcbb5bfb585d784ae, 0x249d75e7e8c3cc05, 0x963afcb51d08f77e, 0x3a8866ec3b367b4d, 0x191c6fab05b2e82, 0x1144bf5a1706ba,
+0xbaa8433a13011fe4, 0x8ea388d5b67f96f4, 0xe1dc7d98fd0bae84, 0x392a004956103408, 0x8b555a93d6c05361, 0x8438f93cfa5c4252, 0xb595edfb521f2a28, 0x10ea96ebdb4427,
+0xbedf478f5418bba6, 0xacd2789fd0a76530, 0x398f4c61638bd9d6, 0xaddec865c89e84d7, 0x9beacbd2ba73ab19, 0x140eb7cd0d13b76e, 0x75e9b3345719868a, 0x21e8832122ec4e,
+0xa2a01c478085dfb7, 0x6115a8c675777eaa, 0x1ba7189291f7462a, 0x32c73de4b7574609, 0x8e9ff046d5674af5, 0xc68b326bcfbe307c, 0x5d9132a8d20f3980, 0x36e24099ad93bf,
+0x39fdbf47a3a56dd3, 0x5f6cbdcbf2ccb4e4, 0xdaa91b5030953cae, 0x60213c236ebdd5f7, 0xadfd41cd1321d438, 0xe7337f4746d2ac92, 0xf3ef11954bb8c26c, 0xb96059f4b1b46,
+0x1cc7163bfc2d4624, 0x8fb9d5632cc71a30, 0x1f4dcecaf40d658d, 0x4da77360da04d7c9, 0x4a46b4808d881034, 0x6312c1612f4c09d4, 0x1dae9b2bef7fac3a, 0x275a39c1bd8c33,
+0x5ce0d650634f6c69, 0x71872068bf77c99, 0x9621e5f42f591643, 0x6a41304471957489, 0x31bb4790978354c2, 0x92629253bc715d67, 0x8fab805acb890c13, 0x2342a270e6e652,
+0xc2b5e1da8470b018, 0x89826ddd5ffca8cc, 0xb76ccdd1f84f40a2, 0x9265cb0b7ba898a7, 0x5fe963f39da51779, 0xf7221aec42d8434e, 0xbfd6ea4a184620bd, 0x11845358c8f0e7,
+0x7f03f2c74f5f947, 0x47528e0ab64ff939, 0x69d614e1e049de59, 0x19ff72b314805c7b, 0x8ceb79fd7e3f9484, 0xe3eb768454236aa5, 0x8115d9e20f2cd860, 0x219878c6a05af3,
+0x31067010d6bcd2b4, 0x70fdde9a12a7da95, 0x92185c44001699a1, 0xf3733ae791b1af3e, 0x7c6b108116c03f2a, 0xf04b5423ab7998d4, 0x7af4e2a1ddb0d82d, 0x3c62cedbf768a,
+0xd99fcc134f65ef19, 0x3e2f87eda795a170, 0x7c5b444b6814ffbb, 0x2fc0f09b668d28e0, 0x44cb2d58b82758ad, 0x97727ca3c8a1112b, 0x410f5fe5178e1ba9, 0x28d45f256842cf,
+0x6952251403957405, 0xa5baf15ec8613c37, 0x6576c085d04d5ab2, 0xb724f281f6008f65, 0x6a606bf20bddf86e, 0xd9eb3a6e9c2947f7, 0x6ddfdf2fa7d425aa, 0x3178de840c2998,
+0x36a0387e8413cd76, 0x8d76d58b224d4496, 0x380f7653298a22e8, 0x44a279c01ee651f0, 0xff837667cf10a72f, 0xbabd35d519b3b4ca, 0x372b65dfb1a28157, 0x3b9109b9d11517,
+0x2a7d3feee19c8aa1, 0x3d307f1163200ff2, 0xa0cc490b269c86d0, 0x9b9847faa23cf9a4, 0xbe1c9959c9c36971, 0x46787a0f12454ed3, 0x72d7631a90be7336, 0x3c4581032d0db7,
+0xffa72486c8305801, 0x111ad0cbc0d8a012, 0x17cd743da8e4b506, 0x2cae33f0233322fb, 0x86ff347d72692eee, 0x3c6ab15e15e8ed0d, 0x386ea90f85afc42c, 0x38d64d18ceb4e7,
+0x81af26895b2fd07f, 0x31e21793f9a6698, 0xfb1f12813774437c, 0x251a7a89c643eb3b, 0x40f8a64fee8dfe, 0x69a91d43c8a735df, 0x60b6202bac8016b0, 0x3e9f527817a9c5,
+0x2481649f75450eee, 0x97e471ad7ed219cf, 0xaa19750f3d18e9a9, 0xa8ebfc572f2a8e58, 0xcd18019332cb01d1, 0x6eda18ad7a8c24e7, 0x28ab46842647bbe0, 0x2c08856ec636a9,
+0x3bd4eca256faa97, 0x171a12ba2056ef66, 0xbc269634f9180968, 0x2e1a23617d4d1afd, 0x2ac8ffc841a9c40d, 0x3828837abe425323, 0xfa9624f6da20b100, 0x3ce1005cd9ee25,
+0x90a90c3a4b5069ef, 0xdc262beb86aae14c, 0x97d60be6811cc370, 0x38edfe635018fc04, 0xdbc304b4028a58c6, 0x4c637ad53453cb8b, 0x15f03e15879e3bbc, 0x78153822ef3e8,
+0xf9e2696651b94392, 0xafadf25488d4ace7, 0x72402c7bd848f90d, 0x60a2464192b1f01b, 0xda97e0bd1f81389c, 0x9c487c9df1444873, 0x28062b71f896c92b, 0x3b1cc4158c517a,
+0x37817e803b663df5, 0x5b9aa31f7f63d594, 0x4e0a703bef21d0ce, 0x4856b286afa4854f, 0x65fe1064977220d, 0xd442cd09e2acb6d2, 0x51f3acf10c9c5687, 0x25c162da7ba1e2,
+0x348914ac78796fcc, 0x42fb7d89ffc97840, 0xfeb3e475c0e3b9dd, 0xe524806ff2f63776, 0xa6345377210abcd, 0x7b2bb341e5cff55c, 0xf7952ed4b8af48f0, 0x41ef26f17ea3f,
+0x22b3a66ae383b76e, 0x26ac1c6db51a036e, 0xde2d0858dfc540cb, 0xd98ff8f3da7af07c, 0x212f97ea470a76a9, 0x99841e8a047148b3, 0xa2f36d8a0efe52c3, 0x11d3bce8d674a1,
+0x3d605df154114928, 0x33017925f87ad092, 0x1c41610b4b90d56a, 0x75b4393da9952e5a, 0x7ddde564533c5433, 0x49e702b8a66606b0, 0x877a19b7f2be6346, 0x124f6240d086cc,
+0xa1878dd95d86e217, 0xf285c5122b6c4f0b, 0xb5b7168a0fad4b41, 0x45e2cb08bd53e211, 0x2e8316227d57d4c0, 0x53ce5e42ea5c2f5e, 0xb26eb4f46db0c10e, 0x13c6f1f49cb306,
+0xe1c6738ad2568643, 0x92a1f12fc2084b35, 0x49ca8334cd44d75d, 0x68abab76be12960f, 0x230ad76c96e21f10, 0x890f216417778e88, 0x17d21d8ab028f08, 0x6329633511af7,
+0x71b232fbfc7038fe, 0xd2f8f10e16b290df, 0xd8c17c9cf9f1f752, 0x20e362fc37fc25a9, 0x83727a6a624b5cc6, 0xf115aedbe39877c1, 0xfcd67a4322cd0696, 0xb34a46843b3da,
+0xc3ff04a20b56369d, 0xf9d373123fb3fa95, 0x487a17c9a7e5201e, 0xa6279bca8a7afa77, 0x74e80da64689a3ac, 0x7907a0348a636306, 0x3ea0c223f4a41cf4, 0x34af438d852308,
+0xa6a0b7564887cbef, 0xcf282f85b4b70d37, 0xe28f205e2eee119a, 0xedcd32306538a957, 0x3d90e87bd4f88ca3, 0x73e0c9f9e894ca1, 0x96308b3450abf9a9, 0x169c61cb27f69c,
+0xa119090ecce57a63, 0x2346b1eea9b664a4, 0x71a3997132244c0e, 0x533372b3db8d2c42, 0xca0c052277e71a09, 0xaa7b820133567def, 0x236d2edfc8c89519, 0x27ad201b599e32,
+0x8f5d4304003d59e8, 0x16d071b8b936b40d, 0x2fe20e7b87c1dc36, 0x7491700675c9b416, 0x3c5c84f6ae973154, 0x1a4b9210a8d5124d, 0xecc8e5370859a1bb, 0x17742b37dc8376,
+0x64dfb4282d321c1f, 0x69e372079131ea0, 0xb5cdf56dbd403829, 0x4d2a3e0b17edc641, 0x1f6f038e193bef4e, 0xb7e8c291923ff4c3, 0x36cc620020e834c4, 0x16cf87bb842720,
+0x846c3ad23ae6cdea, 0x4d9aa1fc66f7f590, 0x322a41511241a8d7, 0xce11ce496dfd190e, 0xce2fca4e5762b3a0, 0x4f86ce355c2ddb27, 0xc725652ebf2d929d, 0x17749d1823a437,
+0xce1fd5be3fbff4d7, 0x6145a39104f00365, 0x4da444fe60f880f1, 0x26ed68063db74d48, 0x2d16dc90db774e22, 0x7a5a87dc5695a654, 0xb920bb6b2f39580e, 0x31870debaaf433,
+0x3f9f3ba506e39227, 0x26cd438a7dbaaede, 0x62b447b92fbf83c6, 0x70230caa13551848, 0xd831c7119fbc90a, 0xd4e61cad7d4cb1cf, 0x45f488201edba6ca, 0xfa5077ed183f3,
+0x5d042fc7c0b0e582, 0xde8d8df882a40448, 0x5e92c1bb439082dd, 0xb3c7271098b914d4, 0xaea84c459751ecec, 0x8f77fd5cc1591c37, 0x3ff4d41a766a7478, 0x271e705a0bd502,
+0xd7521615a64438b0, 0xa78512f045c78b35, 0x8424410d9badbb25, 0x7e78a37222eb90a6, 0x8b81405c47521cbc, 0xa205adec40cf5a7b, 0xd320e9d1231d0806, 0x3aa8d0b89c47f7,
+0xd9e7a9111a654c80, 0x666ceb0ef104dd46, 0xdbbfb3b83f1a8b4c, 0xf1f60b6997436572, 0xfeb1934b3cfca345, 0x550c48c44dd31f03, 0x17146fc9911364a9, 0x3cffe296668394,
+0x85996b7d60a7cc31, 0xc1575d6513efd895, 0xa26d4dd7f6c31a71, 0x787fecd613fb020d, 0x17598f4e8bbcaea7, 0xcbea18aa8690a7de, 0x6309e50e38b1da0c, 0xf0380bfda5f04,
+0x32b8a2847a4f5f3d, 0x6cadba3fb2d3f7a8, 0x6b8915a99bed3d79, 0x78a632f229aa18d9, 0xce972a761ea21d20, 0x811736ddba778daa, 0x7881e20cde1fbcff, 0x2c16ee89a95cfd,
+0xaff1320c7a738e2a, 0xd08f51a3e7ea8e07, 0xe5dd52189be94fe3, 0x8b3314a5f8e157cd, 0x785b07f0aaa53f18, 0xb2c4159680f1d550, 0x79cf060030ace467, 0x200a285d040eca,
+0x4ed38856e2c19044, 0xcf54b5b921b916cb, 0x252a2a7f828d9fb4, 0x6a0023c352f14368, 0x78fe27deca43aa99, 0x27e962f4020dbebe, 0x82cda38be35c84c3, 0x3c4350242681f9,
+0xd9e28e19bc86a08, 0x3748071b4e426f03, 0x9c8e4c44436ba202, 0xd78f61128cb058a0, 0xbc2c8b9ba4368388, 0x8ecb1a8dcdb93ff5, 0x3ca99dd4e44597a7, 0x1348d6300281ac,
+0xdde145e559e84474, 0xb5009516c54d72ef, 0x9b7d4f6a607966cf, 0x4f9c4c4da83d622d, 0x21d301a9ee542ddd, 0xbe43d9269cbe9ef1, 0xc4f1e2b21ed30757, 0x3bc5b96eae73db,
+0x4aa1fddd3995bc71, 0x7791dd4b62b5e50b, 0xafb1a44be8b0e82, 0x5b007a7f97871168, 0x92ca3a9a4d74e715, 0xb3c3d9b6175d7f3b, 0x3079de83897c4a74, 0x1956709fa240da,
+0x3636f08960d6f7d6, 0xaf9650e6ddaa7114, 0xe250ef134fe71db5, 0x7079d987ad585779, 0x866321cdb5bf8191, 0x6b106ec8115ad5d9, 0x160700aae18574bf, 0xfd2113ce5cfb1,
+0x56e7562a330ed7d7, 0x8b60e6ff8a3eafc3, 0x4b093be14b73166, 0xa31c1b506aefc909, 0xed9477a481d2894c, 0xc4d587d3354fc3c9, 0x46b89c253a61b565, 0x2d76f4bf599b9,
+0xd102f141b575e2fa, 0xffde0ce408638c1f, 0x563f0dee374b05bc, 0x644ebcae84f29638, 0x21cbfe06b4d1b0dc, 0x8ae8900cd49334b7, 0x7f568cafc14343f1, 0x1e168bb9f71c29,
+0xb525dabcc33f198d, 0x219208590a769166, 0xde7a1dc316311c6b, 0x6df53f4b176db6e4, 0xe8cb8f23bc0af4d0, 0x780003f1b13cf1c9, 0x8009e443ddee1c4b, 0x3eb05f50cb031c,
+0xf0909a8217edea4, 0x5863b5613ad3b37d, 0xddfdad52d6e221, 0xcb375d5354ef9c23, 0xfa4289afa423f3f6, 0x7d02bf63407c8bf0, 0xecccafd365664929, 0x1635fbd8a0aea5,
+0x4ee91a94f203def1, 0xddb832162eccc4ea, 0x550de2df63c2712b, 0x1ce44f2bb9c0e1fe, 0xf0dbe7463b6c1886, 0x84c98461ab4071a7, 0x29832b4a516baeb6, 0x11682c03bee3f5,
+0xd468b4b09ff670b, 0x87c564c56490608f, 0xad53e9e24f5254f8, 0xbdf2cffd81daa70, 0xcb06a6e5b4ae685c, 0x86c79eb8d4ad8a5f, 0x9ee092842c7d7379, 0x260701dfb2ba16,
+0x8f5dc84ecb8acf5b, 0xe08abb18fd920657, 0x638d9e685d749a7e, 0xdecdf7ebffceee14, 0x3e499e1eade0640e, 0x141cad9516e31593, 0x10de87b1e876959b, 0xae10dba5cc1b1,
+0xa1b991b6ce74ed2f, 0x29a5e053a4e55518, 0x390ce19596d45d91, 0x45b2b7971a92826c, 0x35175812c2d0d8d6, 0x6c4b5242ae0e6535, 0x3788d0cfeaca2a80, 0x3337290a66559a,
+0x1078353cf384299e, 0xa978861df7ffcf28, 0x1524f4b9c70179a8, 0xdb5daeba282e3148, 0x52ed795e67444bc2, 0x3093bebacfc8c1e6, 0xcc5535571728cfc6, 0x1907a1b140555b,
+0xb3584d25ecd625a0, 0x84b515dc097beac0, 0x83877f238974f262, 0xf3e810931fc01d8f, 0x7138e5fd263e65ea, 0x99559233b3ea12b5, 0x1a6acfa720a9b00, 0x18f4444cc0db03,
+0xb492b047a1b41311, 0xd9a3963a3e3646b9, 0xb93c3e24e4366900, 0xfcd6ffb5f06ea341, 0x255d29d664fd2395, 0xdb843d4adb71fa6b, 0x41fc939040e04ef, 0x2eef995d464cf6,
+0xfae704cd727e4504, 0x3b7d84881c0844be, 0xdecfc62fc11ee2c6, 0xa9eb429f5b0c3358, 0x96944a3085043f71, 0x1b6b48af724f100f, 0xa00a8dddcb8677c0, 0x56e69b7e0b105,
+0x2f433f1afbae668b, 0x3b8b6b256dd9a33e, 0x9034a4a8b55f44d2, 0x4cdb09768fed702, 0x198cc12fdbd08e68, 0x7f32fd4dadc7bf5e, 0xa59fc37ea7e44fc8, 0x2785933d12a6b3,
+0x8ef2e57ea8c8439d, 0x97f910fe07e410c4, 0xa2f273ffc7b6f746, 0x3a7d1ef137889618, 0x3aa8be0429f5aa5e, 0x12ce0976ed80e7a2, 0xe449feb3e5d79e8d, 0x3c89c83443cde0,
+0x1873e93c8cd21af8, 0x104625d2981573a9, 0x2a5c2251bb21868b, 0xba6f7c3c7da6306, 0x8c7ce0a71b10b9a7, 0x7d4737fb9237bb1c, 0x684fe458991baf50, 0x22db3432d98424,
+0x4e7d86a42cf3160c, 0x4098e42cc6a9fa18, 0x8f9ff958db6b6222, 0xa6c8a215e42dd4f, 0xa6df4b6fc95074a9, 0xd8716068e8f271bb, 0xcb84a18f1203c7eb, 0x1a60d7236232da,
+0x18d43984792419fa, 0xb380ba6240797a59, 0x86e77e1e9c7a8930, 0x4ff646d31a29269, 0xf25667e21ddbe7db, 0xe03df39491d95e76, 0x55f91700fcc09182, 0x3eb56218938cb8,
+0x5daed25bc5ce41bb, 0x8f648a53602f0438, 0x59f77ccc9b86aa8d, 0x9fdd3cc24797f515, 0xf05a43d0f3318306, 0x40f068d8f97ce088, 0xd07a6caceba395e4, 0x32bef75f8ccb2b,
+0x86d1919cede73f1f, 0xd7a6822837eebbe6, 0xcad57b6ec3934de9, 0xebb328678b665348, 0xfc580a7306a6bf51, 0x27c9276a5a416df, 0x7bf0849dd14ea6a1, 0x1389bed0e02d25,
+0x100df9eb51541ab6, 0x353d6726040fcfef, 0xf685fbae1bbe4b49, 0x30203aeb8d6c5ff2, 0xab2b3b5899af0d82, 0xb1f2390e160208ae, 0x425d1862553a299a, 0x2a069ba5ae5c4b,
+0xce210277b62d2f1d, 0x2f823ec630a6badc, 0x93aa54c9c6217b5c, 0x7b42d7ce2e1ce876, 0x2f1b6d1f4af6e7ea, 0x14efa4184ec03da0, 0xc2b2f8009459645c, 0x111e448270cabe,
+0x991bbab345c23540, 0x34e050a1072b3d3a, 0xf757fe38d5472473, 0x3dd97274870073aa, 0x59084c0f1e5ca947, 0xca263e5c892b8a97, 0xdcaaee0588b1dde4, 0x257daf040d358b,
+0x8f9e5eb5bd7782f3, 0xb5212691b0d365cd, 0x8946e6fc133b582b, 0xb396d9555fb77385, 0x99c2c313f37ba689, 0xf1d2bdb02c4aed26, 0xcc30b53be572061, 0xf74eb03cc229c,
+0x7daa1d2139411bc8, 0x56edd966b0ac3e6e, 0x7d5653af5a15a4ba, 0x61083351d1a7835, 0x2e6f8123006edccf, 0xb93cb759c06cf61a, 0xf751366fc8d013a, 0xdbef5f7080ce5,
+0x534319e087962457, 0x5656c54c7e3d33da, 0xb1e58cf193722d73, 0x89fdb13cf05e5b84, 0x20cfb64f2cf487ee, 0x1c0e70d1325d9e0c, 0x57792b409d24c89d, 0xff6b2fb5b6de3,
+0x58babefe319cfda0, 0x67c17ab6a603420d, 0x2757808e9fb7097c, 0x1bf509787c636d77, 0xcc6bb9b1db5d431f, 0xd3bea2e8ffe80152, 0x2e38636fd910c1fd, 0x38b7dc1aba79c5,
+0x264510e2e839fd90, 0xae6093b709f1f9e7, 0x290451b3091878d4, 0x9dc2c6fa8c93dbc8, 0x3e6d927430fba1d9, 0xbfae5bc99f69bf89, 0x8b002db6a3e8eda, 0x1cc0590e8697a7,
+0x6ea541d87491fe14, 0x8616a8cb94d5733e, 0x39dbc3dabb094b90, 0xdb2006c8d5e496af, 0xe1fec3fa1c1474ea, 0x1cb8cc0ded043b05, 0x6677dc7bbcc8491b, 0x2e2c4bee80ff08,
+0x6d50ba79174dfb52, 0x9689eefbf166107e, 0x94cc2ae8b82af246, 0xf4bdd1b4d7f93861, 0x4e7e5e9e4c3897a1, 0x86aac41ba86ac655, 0xd86365ca15467ad, 0x26c46ee0dc333e,
+0x7aebe7d073b5e61e, 0xf5331f3a7d1417e5, 0x14faeadb4df18105, 0x733cf0be35895a23, 0xb71af730526c3f50, 0x322c81d419b27e8, 0xf57be0be98b20566, 0xea488d74d147c,
+0x90f84d8eb0c2abe2, 0x335c5a5486cb457, 0x565c20f2e98d77dd, 0x2614b113e60af7de, 0xe2f8fd343768d607, 0x57bb78f6b2a7ba37, 0xc337768f02b3a9f9, 0x370fffd9cdeffb,
+0xd88bd6e085af9870, 0x75e77eb02aa0f8cc, 0x473c5681fb42ce24, 0x5e71abec78bd3c42, 0x2f7bdde02dacb82d, 0x7ca21a7ead71ffdb, 0x9e22c01e969a6682, 0x31e66b6896291f,
+0x202b4f552b558090, 0xd9f8c50360f753cc, 0x481125158ad961e5, 0xfb301d06254a2009, 0x2a4d424813060b18, 0x9946fe385121491b, 0x670024643140408b, 0x32ad16774a3beb,
+0xee5ad87a68a69db9, 0x96c962dcb6eef6ed, 0x100fdff52daf0050, 0xf9a37f323c3df1b8, 0x366d0f62cd34123b, 0x1a05d8086fff2425, 0x68bce22ceb6c9e2, 0x1360f847c4561d,
+0xbca54b10e403a70d, 0x9e306fc05b608b9d, 0x2e77563bc35c36ea, 0xff3efa2a262c499f, 0x383b6f0464e66564, 0xfbf55c9c20d99df7, 0xebc9970ed0d41642, 0x24ac0a41ad0dca,
+0xce3d2cc41509b911, 0x240c155eef014f22, 0x2337e901490cd2a7, 0xab73e9e1f3f1fc9c, 0xa24032c0bd0018cc, 0x2dfb01537f0d4216, 0x735abbe0c1c85602, 0x2faceec5a532bc,
+0x7d927688c2feb02f, 0x4e4ecca44c1e1fdd, 0xd949f225ece2ec5, 0x4360c78eaca77c0a, 0x267e76e2e71e1b30, 0xcde411aa89e8be54, 0x8e4bdbd3d0b4a3cd, 0xb8a2aeb4074c8,
+0x36e6ca51857b46fd, 0xf4d17082231d690f, 0x94889d14ded6192c, 0x70bc4abebafbeaa6, 0xb60965c3c4ea3345, 0xd1c8b0f51f99989e, 0xc3e18ed56e4e9d9b, 0x3d113b008cedec,
+0x88726d458ef35af3, 0x8a9ff7abdf529d6a, 0x3b11a254c99ec670, 0x4e5a6a36504c751, 0xb3ba634f5d68a91a, 0x6660a8e3e3d7d04c, 0x1e096a449251b49, 0x33ef842d0c46,
+0xe12b899c7074ed5a, 0xe10c4149914e3ae9, 0xaf96880e28fa3319, 0x57cb7ec13265c70d, 0x47483ae8e6fd0b5a, 0xfb857a766a846dd6, 0x14cd8db953af8827, 0xfd67523c8b000,
+0x12247161a21a14f2, 0xbb22906d3bcd9fe2, 0xbe083cc3078eda52, 0x14dcf30e7ce27c92, 0x157b82bacfa8d8e1, 0x4ee27abd70b09cb2, 0xe5489993ec8fdd65, 0x3a18af1cec10c6,
+0xdbd77a53ee48e1df, 0x3583ee8f90805f54, 0xc792cf1250a33314, 0x47bdecaa86d809f1, 0xe4f6d907c53deda, 0x7b9d9c920a8f0059, 0xabb545c19816bd34, 0x32220b6e606271,
+0x63bdd8b78f75309b, 0x61639832bda46858, 0xda14ec96684ebc1, 0xe312051bc7b35e77, 0xd9f24804089c1120, 0xab6e9c7c39c53c15, 0xda9dd622f1db74b8, 0xd81c266226a89,
+0x970c34a4e50e84e1, 0xd9bda1c695f8c1a8, 0x60c8a413e4cb826f, 0x6838fb002ee51712, 0xdf949435d2c032ce, 0xf6394af4247c8c40, 0x791459e011f53c5c, 0x22e43654ce7dae,
+0xa76e7fe463d1c979, 0xd0965c1a6b55cc5, 0x6106b2296d575c41, 0xd00a092641b79446, 0x44e046c9f581e795, 0x272118aacf15ec29, 0x477c84627cf60c60, 0x3bb6fd7dbdb007,
+0x733b7a13ddfbe7b9, 0x8c075ab626af35bb, 0x1533eef1e62cae74, 0x584f791de1857e54, 0xa556e0d5ae8a49d1, 0xd76a99727a8832a1, 0xcc491155c03fd3ba, 0x1de87873f5d27c,
+0x8cd23149975ed985, 0xd47ec9746cad31d0, 0x2b7f37a86155dbd, 0x37cdffeee709d9a9, 0x21f60f6fbc8bc0bb, 0xb276a136b3a608a7, 0xaeecec71b79b4155, 0x3647d60fc7e3f4,
+0x52989129339df65b, 0xd162a2e4654e2ae, 0x9039100d57e37e08, 0xc0eec2e0153dadec, 0x86842e808cb28112, 0x13769fdc179305dc, 0xe817c6d6bc7388eb, 0x2210038cb81a36,
+0x1b6a20a2dbf515c1, 0x4ea5c0f4c9d66dd2, 0x1dd835d64cd8f6cb, 0xaf48b8c02607b986, 0x8e0adafb352b3ae9, 0xa6e2cab7a88171f6, 0x44762d6534bed06d, 0x35cb2d6933f291,
+0x37237f6fecd10eec, 0x59775c3715f5438e, 0x59cc95fcfee74737, 0x5821cb0c1b85235a, 0xd3382d8a1b99fffc, 0x7c34d9924ccb77ad, 0x2459835a0532cc10, 0x1f76f040608df6,
+0xf86f8d270eb03261, 0x91e7809af560f29c, 0xd4d16f087910bff3, 0x9c528b1e835051f9, 0xb0d4f5cbc13c7e2, 0x590ae0255e5e7b0f, 0xda1e2a876ae91527, 0x2bd600b3422f36,
+0xf8e5a40f65f28fa8, 0x853f98834d6b76e6, 0x871c20d16168ad2a, 0xe705c1a6c58051bb, 0xedcf139a0eaf452c, 0xe98e0380047f6089, 0x8b3cb7f9fc2c5a94, 0x1aca9062f5fc50,
+0xa0212244ff020be, 0x359e0c64df6d540a, 0x50ec8358b3706284, 0xdb6ede8c72341601, 0xb09063e5c179b668, 0xa00bed903433b4c, 0x4bbcf25cfdb4572, 0x1fd23f32d85f11,
+0x9f9c5e33d94ce536, 0xb47e14190ebd80fd, 0xd1a4918b03ac58d1, 0xbd2889dee07046e, 0xb388fb01a40f2849, 0x63db97c7b3895ae1, 0x804cc6ce1cf2880d, 0x2e0e8f6b38e7ee,
+0xf00c4f470373ef04, 0xc67d3a96938ecfb6, 0xa7225f8f5087993d, 0x783273b5cf9ded34, 0xf8d5b5e7e18b6b20, 0xddb3224086e653c, 0xc974ef4e91b9a29, 0x1f4e4dd3e365c9,
+0x3fb1ad1817e3ffea, 0x8c8cc25d5b1ed8e6, 0x59c6cf66ffde1405, 0x42fc2030daf5ff74, 0x2c0054ffb4958d13, 0xcf78481fa8fe53b6, 0x5b4ad68a3db277cc, 0x331d2854347353,
+0x88219ac7a6390098, 0x36c594c219377691, 0x45afe246b805a101, 0x5e2437f2e14398eb, 0x72f24e994955901e, 0xb767121aced08d25, 0x9d7f24c87ee11f, 0x15b34704fff7e6,
+0x73d0d2987eec815e, 0xc0f153b445044583, 0x2d13a95078097449, 0xf0af4efc0738d7e2, 0xa6837163f3b19981, 0x65391eefc292c0f6, 0x4ddd2f14060bd77c, 0x2bca15f975f430,
+0x3685bd972d119f6, 0x2d44a482a8d048bb, 0x645f5b8a3ce2ebd0, 0x9e6f883466f05c62, 0x7896f05be2a64742, 0xa281b10790e8021c, 0x28ba8df6bc269aee, 0x1b298545b36ce7,
+0x46387a92bdce7a76, 0xe294a9abc07a44d3, 0x2c1e8fcb2c7919f4, 0xbc3d1deff574264f, 0xe10147bd32bfff5d, 0xaeceaee3e3556a3b, 0xd27d56a6824f9255, 0x1d7ade30714e1f,
+0xe286823819baca6a, 0x2759c962924c36df, 0xd65c6eda2f4d5862, 0xe23a4ccffc9b0bdd, 0xc6755b34c2bae354, 0x1e79cd295e0b61dc, 0xd8e0cc11102a4b, 0xa65d9daafecf6,
+0x57f5b3396ae7ec7c, 0xa27880994c84ceb0, 0xa108d49b1cb7774f, 0xfe3e9242d8bef8a9, 0x5913bad3ce790c53, 0x6f9d9f7bc7d2ef9c, 0x2465a683306cefc8, 0x22cf994ae5864b,
+0xa23789f47e3a3bc0, 0x62189b42aa6ca8bf, 0x51cced6a52195ae, 0x30a3ef37df8ba8cc, 0x99f3bf728147b474, 0x7307308c445e88fd, 0x7b3daf3e2004d543, 0x7964d3b2e48ac,
+0xfedc5b8b7a880afe, 0x688454f65498918, 0xe3c0dc761ef1308a, 0x77b29166f3b245c0, 0x4ec4b8e6c8c5b759, 0xd19dae3006fd3ae7, 0xc7cc62a4fad1c283, 0x22390f651bd62e,
+0x9dfce36fdb4923f4, 0xbb2174ce36f83ade, 0xf1a5fc1169e92c50, 0xd1d4543636a559c6, 0xf5d8ef2e2401e76c, 0xd09192c612de6d8a, 0x76088fb2626e4b83, 0xe0b92f39e5d9f,
+0x2539ff65611dab4d, 0x33d96382855c237, 0xbdc67281e58214f3, 0xf29f1f04e99dbb8c, 0x884e142406378b97, 0x3d5452d1547aaacd, 0xd1215193e1fc1467, 0x3dafc7f21bde28,
+0x32e3f281b1f79cc6, 0x9f60df654fc6ab72, 0x4b062c1670ab8f80, 0xa98bd110cd79bfd3, 0xb49fd3a300c9d2f9, 0xbf03501de94d1e20, 0xe3a02574048fd0e7, 0x267423157aa994,
+0x52072f2de9aef866, 0xfeda25baae4d6da0, 0x3521d72cc6d542f5, 0x88a084647ad4a524, 0xc2b8904815978f93, 0x1b2ac4bf48b06a1b, 0x9cd7321a747acd1b, 0x413b9a4a4a98b,
+0xd8afc0ee42ecd5d5, 0x6d7bbe9ef122f4e8, 0x88ed0dd14f9d1aee, 0x41f5836d5670b9ed, 0x8a2c931675330477, 0x9e3d9654c69b67b5, 0x95bf68b8f4327444, 0x254afb0b811c49,
+0xfb5c4ef03b77159, 0x443bf4fb9f4914fb, 0x3ab41756f336c9be, 0x79b213e3e518dd3f, 0xe45d06d509b41ea7, 0xdf6a53bc1807b152, 0xe42196825d5327bf, 0x366947bc79f193,
+0x89fa4e14a2106e0c, 0xb62620f7ab70204a, 0x40cd4a8fb29398b1, 0x2d813e17aa6a997, 0xfd3428a33b534747, 0x9d1a065a9742ecc0, 0xaa0a08a21327a816, 0x31799dc0f2b144,
+0xd83add666e14df5f, 0xfcb77e5aea73f697, 0x1bae1730bc8c73bb, 0x49bc3bb8b7478367, 0x1a7b715fd296497f, 0x873349d35eb07d6b, 0x8652ae24185b9116, 0x60709a0d3958,
+0xe5488fe9c1976602, 0xa17ec949ba8cff32, 0x33ac90ceacfcc647, 0x179ce53ad1697c29, 0x7ed780afca8e2a5c, 0xc305f21caf2de5e8, 0xc56ee67b616dde1f, 0x2fa9e76503b55e,
+0x2caab21bf7e61560, 0xcfbe27877a9bbed, 0x6941fb5d811a4262, 0x75ac9d99b46e502, 0xa8584e0d2d83a6ca, 0x342ac12929a7f754, 0xb06a9922db6870b0, 0x3619f06ec6add5,
+0x25afd2b023e40849, 0xaa75f13d78e8ae17, 0x2c6567f502322f31, 0x1c9a5c7974839af9, 0x19657272bf5e079, 0x65157920c87c36e1, 0xec6e72bbfd78aee7, 0x2d184d992f5255,
+0xd23211c679d6a662, 0x2713ac039b5f35ce, 0x4221b37becea522a, 0x1bf2b8b70bb197ec, 0x3d77c06e0cc76899, 0x79b194246d58669, 0x7a036dd045321f78, 0x2ce9ecd5f8232e,
+0xee498254f265dfe4, 0xc47e4c9383dfa4c5, 0x23e7e82eff31ea0e, 0x948808e6d1f60a4, 0xa13cabb6ba2b8bad, 0x81e9546bc8c58db6, 0xf15a76f1a2ec156, 0x2b9fd4541e9fe7,
+0x310387bcef8b2f86, 0x5087d55bb990dd0f, 0x627b4815d86e397f, 0x8f09bf5ee0e72a18, 0xf10c849f9bffe852, 0x4e8d997e21f5e5b6, 0x7781cfbc4206fb2d, 0x25cea76cfb994e,
+0x1f9487b2f91b3892, 0x6c6ee961bda0327e, 0x16c3ff1b6cb8b9c5, 0x4cff2d4dc85f388a, 0x1811d2ce3e49af08, 0xc5f5fa3158f249ab, 0x4d3c1bf126ef27e9, 0x812268e32a272,
+0xe3157b845f60d971, 0xebf890d09e9e30ce, 0xe1e0691a972a62f9, 0x6de426b553025915, 0x3651e3bf34896952, 0xe1287694717130da, 0x1a62f85e004d1ade, 0x1bfa4ff40e2f9e,
+0x97df74086e3602b5, 0x8379dd40803b2c09, 0x1767431e7edb2f01, 0x53ca99d91a717130, 0xf18317d0ff07013, 0xd6c4946eb339adc0, 0xaf7cfeef4a7a5c69, 0x4066e6e567d87a,
+0xca5fd7243728b0ef, 0xa50bef3ca6f3c102, 0xc52615174ed8f22a, 0xf99f3fc3122db8ed, 0x6bde188ec56eb48f, 0xaf2071e840b602d2, 0x4d5ed644708ab490, 0x1647781a0ace14,
+0x22e44cacec351d2c, 0xeaecb8abef57ec6f, 0xaec88917edd3a7e1, 0x825426fd776304db, 0x9aaefbe195e4487f, 0xbdb1dd8b600eb70b, 0xabc01645a7fe1278, 0x215c7fb19791de,
+0x3a3d7c83780bc54f, 0x8480117b358e3cfe, 0x662f3888662d5896, 0xc4ef86dd750b954c, 0xbd3e4521daa35918, 0x1e3c893ac1ad8cd1, 0x139dec14e39592c6, 0x1b19a66218738e,
+0x79f0b4b4449ca594, 0x27d0ec71a18226c7, 0x4b2734b295638cee, 0x6801e3dda230d3fd, 0xeeffa0d0c6081952, 0x21b894593faeeffa, 0xb60f389b24bf6b1f, 0x32fc08fa154ae9,
+0xe47eb04d5c81e19c, 0xaa3f2545032f1a11, 0x325d4581e1ce996d, 0xd0125121a923e222, 0xc527fce909272e02, 0x3669b2d3a145cad, 0x72112171c3b2d57e, 0x3ff660c2005158,
+0xc7cd443a6e6bb30, 0xbe1933430e6967de, 0xa1e370d0d1c6373b, 0xe048f1eb79c5c492, 0xa6b28b98662c0fc7, 0x2a18110faeff1a47, 0xdacc9a98f1bb5758, 0x2e38d9c8c9f209,
+0xa4435ebee9b49aad, 0xf1252c691a48cf4d, 0xed2b62d2d58817b9, 0x3840b55a490da8d5, 0x49b468125286bf91, 0xe16486e895f446bf, 0x79d6096194aae22, 0x3c51a8c2dedb63,
+0xd7129dd96251b0cc, 0xd8889b8eeb091abc, 0xf371d55e7dc135d5, 0x5b166e609806d6ba, 0x567447e15df056ac, 0x401dd7dbf02dcef2, 0x5f5625d362c4386, 0x3a6891fdd026b0,
+0x26b50014bf6afae2, 0x64933d7a0baabedc, 0x2d62071b8dd47274, 0x1a18bf547aeaf562, 0xdbaedead7e2a8d7c, 0xf965867b8ff1680, 0xf4bb9eb8b4d1b9bf, 0xe69af89ad059e,
+0x19551d83751e330c, 0x85d9dcf7389d2c25, 0x6848a69ae9dc1405, 0xbb637575e177b1, 0xfbb724f3aed0ca34, 0x8c428a035d2233b2, 0x63f51a9e8e9e4328, 0x1ee9efdd7d31bd,
+0x8f82a17784790121, 0x3398a3859a81ff55, 0x3a5f7fb3eb5aa816, 0xc804ca97d1948a91, 0x2d6ba62bb1fc4d23, 0x97bda6d05605c1be, 0x7a492faf39090cf9, 0x27c0c804e3920e,
+0xaaa249b282e94028, 0x824ee416cf37ffca, 0xca299875825b6c29, 0xba60f4c9fa4cff30, 0xdf2ece6dd9b4c7e4, 0x1a9dd60492a331b0, 0xf06a3c691ad8a216, 0x1c20273a1d7b2a,
+0x8dd46f90299bd9c3, 0x771475bf740c9987, 0x46c6bd0281bfb727, 0xcf3a41a696e9648c, 0xbdd2be74cfb1dac4, 0xdb2bb37f73ef846f, 0x66fda7078487fc01, 0x31653f5f576da,
+0xd8a02029b3efbbe2, 0x1627293fbc84dee6, 0x2bda2833582ec9e1, 0xc0b0673a625d79b4, 0xa18579375fc73c59, 0xb2151094642f404a, 0x2ccc5a093e50274c, 0x21283302893de9,
+0xca86a98d08872b1d, 0x840112169a7314f6, 0xc0b90b5b790ccdf5, 0xe97c3c584dd00a62, 0x9fc4a19b283e450a, 0xf4a5251d4062581f, 0xa2ce595f5f79be5d, 0x2413c8f28bc413,
+0x165f63613cd1570e, 0x2bf7f845a62e934e, 0x3d2d554daace6e32, 0xdf54905d4e6bf155, 0x7a4a239fef24bf71, 0xc3fdf5444951bdb0, 0x446b63d2e3bf3979, 0x70967fb6506cd,
+0xedb49973239fc230, 0x295775b7fffb7a4b, 0x58a98fa485daf4c9, 0xe772240d6b113ed3, 0x447f321868174ad, 0xceb2b5d19fc08966, 0x6bf1a78404d75f0a, 0x1993f439fc96a8,
+0xb3128a80229847c8, 0x4da8243e270a36e1, 0x70f7dbebb901275f, 0x78fe0548777736d0, 0xf55bb9f9aa1de88f, 0x8e6e8178f70cdb21, 0x7ec2d14365b7d5d6, 0x1f8f67575d7cac,
+0xc5c9ae9294d64ef4, 0x8d822bb1933c2cf0, 0x16b2d8c093fae622, 0x1f44ebe1be627b82, 0xffcbfde53973e979, 0x3f1793f0dcbcc798, 0xf6dfba0b80c13f79, 0x3608147b8b7324,
+0xd4404e19e572c932, 0xe1a46d73a19364be, 0x94b8568c8cb698ba, 0x15e07fe1604fb18a, 0xdb5a69701e75a444, 0xcdd21c6097f4269f, 0xafc3d6b337da9b98, 0x1c59062fbefcce,
+0x82b4eb05146d849, 0xf0ffd3b67ea23c92, 0x45e1350beaba6a16, 0xd7e0320422c6bb9e, 0xb674b8e6ea136636, 0x3ce32b5db38d2983, 0x5863c1153c8ed9e4, 0x2eeb523b438efb,
+0xefb5c70eb5b8c17b, 0xdbf21dde98c83efd, 0xbe48d46cf8946b35, 0x1414c0d14ee19ac6, 0x480e0ef4aa887f52, 0xc88fc2663e466eba, 0x2a246205d97a8eaf, 0x3fbfb485ab3915,
+0xc82ebff1068b61f1, 0xc541f1b13043c0dc, 0xbc1c40b0d9acee6c, 0x13763f83a473760c, 0x3a6f5ab818f1110a, 0x222ccfddec8cd9bd, 0xe833be73ddb7d8df, 0x3966f3b1514bb1,
+0xbc7e75f601161afc, 0x36cc481224b4a769, 0x5c7d170cbfe50a23, 0xdc39bf17ad4e68b5, 0x5c79faff9566c1df, 0x117fb22c4014f736, 0x6f2f0b0a31c6ca2e, 0x330b1465d9d925,
+0x331084923d419b66, 0xb18d342d8d927296, 0xeee38b0c2d5deba4, 0x1471d3c93f31e71a, 0x751f5c5406ec1f58, 0x6b342b594afec073, 0x375c9a9c695f507c, 0x1e9597d9e7c1ec,
+0xefb41a69ce71603, 0x988686775fa1595c, 0xd0f153eebedbc337, 0xbca361733c7ce272, 0x4cd94d116795d010, 0x9387b11b8732e260, 0xac9a3fe55cf8dc01, 0x1fd0475209c2c0,
+0x185be05733958450, 0x9ff438da87f3f9b6, 0xdb91ccbbc8d2f75, 0xef388b533e7bd8f5, 0xbbface9f41488534, 0xc4e19746d0c8172, 0xcee2497ad159fea8, 0x8c4828c28a13e,
+0x6c7a3bfc47e87040, 0xc0711a043888090e, 0x8b2ea85466c4b91f, 0x1d2e221e6588704d, 0x907e0af2a4ea77fb, 0x27e28c102ea02799, 0xf5520e56e70de154, 0x3ae84010f16c44,
+0xa3dd24aa74e56479, 0x465b1fbacd805e5a, 0xc222add6bf70aa1a, 0x6d2f6f85f2f99860, 0x762b93848e02a545, 0x409e98a21bf13102, 0x20ab4ce8c8b49974, 0x24f754e15bf5c9,
+0x88bc87f011d78856, 0x84db75e975f27891, 0x50e150c10f6b09ef, 0x69385f94ef6019ec, 0xbb78d878bd7530f9, 0x4e763e206672d173, 0xdfb9ea58ad7c3d63, 0x1998c949d14b4f,
+0x453352d30f64adcb, 0xe38efa2fc05974d0, 0x14ed2bc2b878149a, 0x85bcb0bbdda417d0, 0xde5d039b709088c, 0xa8e2b4e2d2b69b5b, 0x2ccff722feb1d175, 0x3b8fb091dc17a4,
+0x8f0e03485137ebc6, 0x44cf71fa7c787ea8, 0x5c78f764a8247bbc, 0xede5ceaa7993cf66, 0x543f564e6d1c2cc3, 0xa3134bfcd96994bd, 0x693d07c534820b75, 0x148643f13111e5,
+0xcfb4a3089cafea8a, 0x56ddb2d60645338e, 0x79e9ee766639543e, 0x5af1458b02d6b3bb, 0x3d5b26feed3df390, 0x5bdf595d4eb38547, 0xd3ab179d4ab49083, 0x28718478dc0bd8,
+0x313b0098a7fc1c30, 0x27de97d14aa410d0, 0x8c9c363f450a3057, 0x3e91f992d7fa07c9, 0x90d24f7ac7c32e7a, 0xa7b8cede6159df8e, 0x6f3d1c0fb1524a8e, 0xebe5961655e26,
+0xe34873bb17bfa945, 0xa92137b991e385cb, 0xc1814049f0e21d2, 0x4ac3d59aa6e6584e, 0x7451d7266d218a1c, 0x7724215d749094b7, 0xb0c45837459d1ea5, 0x1504d0e84d8807,
+0xf511bfa9e282d87c, 0xc8232fdc845d13fb, 0xdb7e476e0f92ee1a, 0x6b7fc0a6911aba70, 0xc4c21a7c308f4cef, 0xdb699286d7fe43d, 0x3941abfb914f1ad8, 0x3020e25ebb5946,
+0x3101dd85c96f272b, 0x2c9642e6d400e52a, 0x7f6da080edfb5989, 0x52663abeed863f43, 0x62ee49d4d6c7b30e, 0xe1c47b7e94a1eb9b, 0x88abf2b89d7dda4, 0x30479e53a5072f,
+0x41af13c9e43ab871, 0xf26342ec7ac3c054, 0x645ac7f5616da7f, 0x6e1d1d788869512e, 0x3d6bcc9efce1ffa0, 0xb157152fe072bfd4, 0xb053b57c9a129ea8, 0xdb3df6291114,
+0x51eee9ceebc0c94b, 0x2faeda053890061a, 0xc3f15e9b9be5fb8b, 0xca9d40d8d406a54c, 0xb435a7ffd187826a, 0xe606d17f8cecf172, 0xa0f1e33d6748005b, 0x1399f5708b5300,
+0x3dd2b1be08f16ac1, 0x917f85f5f0e1de63, 0xad54d14254031604, 0xe1a1490c1acc54fa, 0xb3e9daf0d786ab50, 0x408c36c838dafd47, 0xe34a2fae98180c9, 0x3589f2ffd78a08,
+0xfe284106596e970d, 0xab7876cda9411b88, 0xce6fd98b93a957d7, 0x43e31c5235f46c2f, 0x83a95a018f3f9aa8, 0x8382441da2a4f8ca, 0xc437d69eb223b823, 0x2cb5c87feb6228,
+0x28c44fc8e29fb1c5, 0xfaa0116d82e78036, 0x30f44165cbbd2147, 0x12390610425cdb47, 0x9264c94b1db5038e, 0xb3cde4d5127fceb6, 0xfe23a13b467ec6bf, 0x677af9dc7caa0,
+0x32cb02402396a374, 0x39f20f3c986d5c0f, 0x6c5e9cd40f43bd86, 0xa9b05cbfded2b4b8, 0xf48893fe61ac43e2, 0x73816c5d707e61a9, 0x90b3a8ce57963743, 0x2fab7578563d87,
+0x615c818be792f202, 0x958f4b2624346277, 0xd87cbc085511ab99, 0x3ddc07443cfa9621, 0x48fcd48c2d5d30bf, 0x9e7f8a83cc46c63c, 0x6519b0e48bc0ec4b, 0x1ed14ad2933ebf,
+0xad36e8b0f362d218, 0x72e47fc870660911, 0x8cdd5a136ebd180e, 0x59060265c5d65a3d, 0xd87328784600c597, 0x56efd11d81373930, 0x8b3fcdf051326993, 0x23d0061800c2bf,
+0x201c8ee167311ce5, 0x1e8fcc8b62c7c5c, 0xa17aab356cb160c, 0x9b2b5ed05513e1b1, 0xb6c1df88406d37a3, 0x4054b6fa81e2a063, 0xbc51aeda625a4e14, 0x102f8b2bdba6eb,
+0x6716b4f42b054b93, 0xe51f4382804d5c08, 0x2ebb7428365620d0, 0xd0b50d6ac5becf84, 0xd768d925c583fb62, 0xa4417cf5cf21eb94, 0xdeb9c75026887683, 0x1dbd0d5dda8daf,
+0x423b728b9d9f09d, 0x82c0c848eca75d67, 0x41be0c82ce9ec872, 0x7dac8a3d03b6f3d1, 0xd62b0daa5de7b0cc, 0xf75e36cc36c0e010, 0xcf6d22012f5db24e, 0x6756cb5fd63c6,
+0x468786e1fb77cad0, 0xec7b5dc72abb8957, 0x619f42ec9878958d, 0xb456e28922d96701, 0xa815781d2e09641a, 0xfef512a0c6a5824d, 0xba0cbf694050837b, 0x39f5c7a9834512,
+0x43f966a1579cc354, 0xb85cd45545e35130, 0xfbfd63736439f9e5, 0x2be3f59e8985239e, 0x78cf6d262b62cb34, 0xc8998d7568b3526d, 0x73389a1d5624bbee, 0x10e8c5b27d283b,
+0x86d86adb3df07e58, 0x341108ffe907b30e, 0x9d9d3034c0bc6e0f, 0x4829a6f4eb9cb673, 0xfcc49cc8608f64a2, 0xaec5358a682fc1aa, 0xefdaa9aaefb0a620, 0x2332d8101963ea,
+0x2926605f2a654d8, 0x3c7e172efc257e1f, 0x9b8cc7a1758148b9, 0x42e6cde39a329e5b, 0xfdd0e46b897d8eed, 0xc657f77ab620eeea, 0x1563ac4c860aa60e, 0x3db646c0ebeb69,
+0xc2535d78787088ab, 0xa45dfbbd5b9c3d2d, 0xc567a62c045975b1, 0x4142c7829f5e4a31, 0x49020af7c6cbacf5, 0x9c3c4244beb636a7, 0x232188f36d501faf, 0x3b3ada1de1da75,
+0x3475a269e207d6e5, 0xea6b87bb6c539ad, 0x748e25a3ac6861b1, 0x13187ddf4daf33b1, 0x8ac361c63ccfbcff, 0x71d7267e9e42d4a1, 0xeed8d320bf5d7f6c, 0x322a609c3c5a86,
+0x88c1d1d453dc81b0, 0xbab13225fbe44a92, 0xf218d75d61869e00, 0x71b8366a14cd3221, 0x6eb5b572bbe9ca54, 0x7beeb8c0f2baddbb, 0x367c93e4daadb25f, 0x1f102ed72890f4,
+0x61941095f5f8f51, 0x36650cdc14f3cc95, 0x694ee1b585a882b3, 0xc51853ab5aa6944a, 0x83a58cd0efb8268f, 0x517477ed67efc8ff, 0xa89ade57c42d0a5c, 0xbeb6f4546fbba,
+0x139fe785ca980463, 0x5271ca6af5babd5f, 0x7bcaa8bf5e323c27, 0x9636ff9218026228, 0xfe99e7420fe589c2, 0xa9da4b6f28d019c3, 0xb0904e12f8ab2bc3, 0x3984d1c5ac0160,
+0x199ddb3fa8cb7df0, 0x40e91d8bdb22c620, 0x826f4d6551c631e6, 0x5a82a6d637a4b33f, 0xf05c1d7063aad707, 0xa8861d6da5448ba5, 0x5d4e66ef2a10902e, 0x2ab9f7a9713460,
+0xa66483e0c66338ff, 0x2c701f4c656b58c7, 0x87dc7565337d8a02, 0xdecb7bbee19e4941, 0x4775daeff1cbb76b, 0x36c07fe862b85ae9, 0x42f50de309a26552, 0x1e051a38684e49,
+0x27cf6f60c536208, 0xd2a88770cdda7f8f, 0x612442620374e447, 0x5835bdecc05fde6c, 0x8fb1e7841da84fa9, 0xb52f832ae118cb51, 0x2a7a129458165eb, 0x779945c902bde,
+0x6895aed956c8e56c, 0xdb990a110dd64a75, 0xed56d20cb2ea80f4, 0x4cdbf2e58b922000, 0x3f0cb45c30523c2c, 0xf1bfcdda89b85457, 0x962490d48004a348, 0x1d9ace4cae8ab,
+0x206a2eef9a3bd99, 0xd428861333d5f602, 0x4dfab43f187e2e36, 0x273ebd22b8d3c984, 0xff247585f6c68e3b, 0x9154962ceb4ee15b, 0x4c1a89ef51342ff7, 0x5cfc5ed30cd5f,
+0xa8b16633242e03b9, 0x3a3f84178d9c9d99, 0xda78244e855a5814, 0xd0299eb1dd008ec1, 0x15b37215f3c88eb3, 0x8e20dc4d1a29d19d, 0x68639e050c1c9b9e, 0x2e607f69a702a2,
+0x94a75a75bbe7ff2e, 0xda75ba6e23e5f433, 0xf828bae75af9616c, 0x311dd75ca4e89118, 0xf0525b171424e0be, 0xbd2b3ac01fcf5a66, 0xe35eb80372499014, 0x309b01eeba916,
+0x8a53b2ab3c3a3109, 0x4d9198e1d3ec01d, 0xd8957bc70a7bc831, 0x753692b7a1cd24df, 0x4d089a39a4ba3f3f, 0xa47d6e44451d3cdd, 0xcdd52e28082f56ca, 0xbb35bbce29f6e,
+0x8425e7720221bb70, 0x30b9d738f5f077e3, 0xaabf0aec5528476e, 0x6811b185bc271733, 0x73ef819e07a6ef0c, 0x4a5deaa3c9f04e58, 0x559318b98b4ca196, 0xc3d5a971b047b,
+0xe715475be4a170fc, 0xa3f00fbfb950f535, 0x49af6397219acf01, 0x3ec2dd71c0eebc19, 0x80c02f0f1b51223e, 0x8f435bfe3822ed5, 0x581d8ff1fcb9a556, 0x2b8884e95b483b,
+0x6deab71d144c3119, 0x63271477fc646edf, 0x7842fc4cc06719f0, 0x42483efa143813aa, 0xa9d5347116d8ee5c, 0xade3331ea0e67829, 0xb1ba9e6c1df8689e, 0x3aebe3db697b21,
+0xd15216a80a1cdcbb, 0xfb19d40c8e7173f5, 0xfba50e333d48ce72, 0x539167074ca889b4, 0x4e1ed584414bddaa, 0xd13c1a1e0b34056b, 0x61839991f9da33b2, 0x11b16b6dd02715,
+0x6f350b41b0e2030e, 0xec5af6ca1c8018ba, 0xda19b9c99394cda7, 0xfcc1e865b0ca7e02, 0x74608f326fd050a3, 0x9c1933c5c0cce223, 0x3d3b0b3904225b5d, 0x188901582632b5,
+0xf3e9252efbb346d3, 0x14443c9a9e2f5be4, 0x74b956625b2153b3, 0x77a59d98b8e2457b, 0x68fefbb7ada985f3, 0x53f806100289fc68, 0x61aa662c51047abf, 0x20dfe3a01fb45e,
+0x8e9ce55ad8bc0d85, 0x6e319efcbb9163bf, 0x21f796c036b32618, 0x6555a20884b7540d, 0x52357b77fa19f84b, 0x9575d796433f2ef4, 0xc3f175c4ee2d9f23, 0x2db40db132030a,
+0x28edbb295c091fca, 0xac62b7023cd500a8, 0x8f931421e88d5e90, 0xda72edccdfb7b50a, 0xc6edd5bf697bf0b6, 0x30a9052576dcdcd1, 0x854aa0c48b8539bd, 0x3ed41457ebde2b,
+0x520447b4f314e669, 0x6ad6104b9ccfc3aa, 0xa941e15468ec823f, 0x8a959bd5ae5076b4, 0xb3a476afa3b63f10, 0xec49c4027b6cd3a4, 0x251955e900f0f53b, 0x14fc3c02f32448,
+0x23b830a5ac5fbb8, 0xed240b000863d666, 0x566df9e3eec8d978, 0x29b06c368d15ac0f, 0xf13ed00a8f00d78c, 0x1582d29a4faa6c48, 0x3100968a44fa0d0f, 0x136b6ce216b35c,
+0x375cafb43f9ef3e5, 0xc3308d1e3c960950, 0x81e04bd3e20a4f92, 0x48d1581a436ae002, 0x6518771905961ffb, 0x5ad224ca4e176a40, 0xfc28c40c12901f1, 0x1744ed79048559,
+0x5b31ef7c6e2b0661, 0x6df399331abecfdf, 0x3a5204e41f4b5d97, 0xab9becd3352bbe60, 0x54bb861881b0f895, 0xd89c0f0c1e53b9ad, 0x299199cd14f74718, 0x2d5b06e84beed7,
+0x2b9fa38f8721215c, 0x94e6a61157aa0b3f, 0xc81c29ce24bfffca, 0x79ed54406ab5d2f6, 0x308759d82d3ad61f, 0x3c2f7223c19fc661, 0x7cc6d271fec79528, 0x330486350857bf,
+0x26615f7b8a62ba0d, 0xf4a7b78420e031e3, 0xb7f47119011915e8, 0xbd2d4db8e56bdcd3, 0x762a8954379a958b, 0xfb34a0518b0dcdb4, 0x3205a9056032dcaf, 0x1813377cfcddf6,
+0x6ce219e07daf2b8d, 0xfc145bf1ae449fcc, 0x8260f9c07964aaa6, 0xc2a5042f0146835, 0x3cb9e47735881700, 0xfaad61ee7a985efc, 0x4f3025db4ca9dfa6, 0x342bb06c64afe7,
+0xf06b034ecb175be3, 0xa4924f89bcf95000, 0xe135c15783bd44ea, 0x6ddcffc64dd1a656, 0x9c2e217bed349cd0, 0x7177630d62386be9, 0xb9376f2b179310a2, 0x30eee9db27f6d5,
+0x900047bb70b5ec9d, 0xdcdef33ff6f35002, 0xc2612effada57fb9, 0xba15a15ca272e94e, 0xfc1f4df8f2eddff, 0x8b0457affc1784e5, 0xc68dd68a816bbb5e, 0x3b2157bc2bda4f,
+0x22e3b72f52219b1c, 0xe0fec0d3ee323cee, 0x685dae960e882ca9, 0x649f83de1abbee9c, 0x620ce18afcc6bf0f, 0x88ab6c5bc991fc3, 0x70c7992e6abed9ef, 0xb8289d7073c9f,
+0xe6409087c630d127, 0x3427c496da9d5d2b, 0x8c8abb6e20355570, 0x17cc96dc5fb9a380, 0x2506b75be9162712, 0x2d7362e51c27229e, 0x1475395b59062ca3, 0x24efce8eb5d215,
+0x2468f8fb459e6b7c, 0x9c47e7ab588781d4, 0x33e30c6072a800a6, 0x659d9b82fcc5c2ff, 0x8153a179c8df58a0, 0xcde6e933c7db90c3, 0x25bff4cdd9f3c0d8, 0x8ac1968271bad,
+0x85ca853fa17774a, 0xb44a85fb41397438, 0xc591fe2371f6fdff, 0x861f462a13bb6b2a, 0x302b856748f96595, 0xd6b1c27f1b3342b, 0x84397c544478edd, 0x3dd0f5bbc59447,
+0x82662f467bbd5754, 0x4df7a6b7a0c04ed7, 0x98fb6888374c5ca1, 0x94718b37f21d00bd, 0xe402574e15510418, 0xd64cbc3f73a249c9, 0xc2a2aaa592fa6eab, 0x345261ed48ddfb,
+0xa9216983c8317555, 0xbd9b29b9d907098a, 0x64c3bf3aa6887c81, 0xc2326a4604267764, 0x26604cd1a2fe4edf, 0x2877f2b9e686b25e, 0xf0b76470bcae1fd, 0x2b05c6d6bec54d,
+0x10ad56f68cdd743c, 0x67e9253e1e753920, 0x6e245af9e2117f18, 0xab80e5890a7c4817, 0x61fb736bc43a2284, 0x6d2814262134fb39, 0xff79d994cdb195de, 0x8df69aa46f22b,
+0xfc21dc864d7f762b, 0x51929444b613fe7c, 0x16f411379b745036, 0xa6e570abb20656a4, 0x5ae4ffa23cc38cb5, 0x471e53f061654d6, 0xf05e75753a4eb875, 0x7628b7da58a2d,
+0x30e0be0734d052e, 0x47d169a8b0347fd8, 0xdae2a7f912c9a92, 0xb94f95bdeb35ccd8, 0x7723d9db39d3533e, 0x3bdae09b96de6a96, 0x3d69b8e319761dfe, 0xc4540a9ebec82,
+0xb693eb847b29b7f3, 0xae1614bab1efa593, 0xb58bbf1b795b433e, 0xe3d1e2c51a3fcfd6, 0xfd17704c3014beb9, 0xd36b96732357a30f, 0xb9f0221779f703af, 0x2e3ef4ca76bc1a,
+0x84868d2d8e5173b4, 0xc14cd4a3cb890f0d, 0x14892ed80e6c2b96, 0x81c7a1408362388b, 0xa349a59953bf19c8, 0x8beb74f3f7763084, 0x7bc4b6b9d6b28019, 0x38fb1da12d2a6c,
+0x988fa996a8485eea, 0xa0fb1d79fc34ecce, 0x439a5e68f976e925, 0x3883fc15f3b3c96, 0xa4a7659381f01d47, 0x3842cdd791e3968d, 0x3d52db376ac83ae8, 0x384967c5098f2e,
+0x9a06ceacf43f197e, 0x4b496a033c0b6d4a, 0xb9d10ff000937f02, 0x8dd87bb11653158b, 0xa230c5ba53108202, 0xd80f55306423956f, 0x2ae258bf1549d235, 0x21e435403e3437,
+0xdc62b3c45930fa21, 0xa345b17aa2f3a849, 0xc6dce60d7ebdf424, 0x11622ed918d97d6, 0x253f30b81dc90df2, 0xcc419139fd6bd18e, 0x23eefe20ee3dd71d, 0xf9cd931aed018,
+0x617415ab2036f66c, 0x386e82f035c8f84a, 0xddb74387521de814, 0x8578191f3fb15b8e, 0xae102220387d8e83, 0x49a553cac8a824b4, 0x68051bf29ed1ca7f, 0x3329719a7fa60,
+0x245c5338ac3e9802, 0x10b7e4de7dc8a43e, 0x2ade6c78d897f9c6, 0xff4c8fedaba5b2ff, 0x5f36fa93a0976459, 0x44fa0bbbd28ba727, 0xc3f15bc9b088d2ef, 0x10bde7bf260279,
+0x956a35cff0cb9e91, 0x1cf1e09d4cbc6308, 0x61a54c7ea69c7162, 0x97c71e971cea8ca8, 0x8945da8ca6415dac, 0x28941c5f8077d08a, 0xaf5f38fbd3264ba1, 0x8b9d59266ee99,
+0x69e59024279bc9a9, 0xa535c16fc07ccd3f, 0x922c0f631639bb04, 0xa84eecc5684d16b9, 0x28653374bcb8c93, 0xdea97f1fac83ccbf, 0xcfa2fb6c22ee4535, 0x37666fd8dd5a3f,
+0xb64daa4540494ada, 0x74f65f084f078b1a, 0x44b16bf9044db1a2, 0x87ea69f36e9a3186, 0x8fd0006a183a430d, 0x606c6640b4f052d7, 0x2002aed1610b2904, 0x3fa50e5f36d391,
+0xd9de206d15c6e9cd, 0x8d980715b17fda70, 0xefceeaed73f13c10, 0xc2bba1e8fb1794a7, 0x3a6e2f009e1eab48, 0x10699e16557896f2, 0xcbad22a05fee5f6f, 0x2c1b4218159b1,
+0x7968b68194f2548b, 0x77b6908d3d041ceb, 0xfa952ce21e328cbe, 0x4dc29ffbc5afbefe, 0xcf38e86e121d3e2d, 0xc8a2efcf23a4e494, 0xab92f438ceb29b36, 0x39e12220dc2225,
+0x3545583e91542787, 0xd1fcc43db0433b7e, 0xa5d5fe302d44ff57, 0xf181f0cd4476dd5b, 0x5b99b950c2566302, 0x92e3f08f8b69da0, 0x4fb1c3d8df23dd04, 0x47c2c33b17512,
+0x34ca114fda740c12, 0x6b5eca669e43699a, 0x1362da969252bbf1, 0xa51cd44da7028e8c, 0xa0f7c8da8da11743, 0x1b03d19cafa21ee8, 0xa464ddaeb4614f22, 0x7e91bf72cb811,
+0x10c394456bac0e60, 0x72f18f2333279dfc, 0x275dc0e5c57057e2, 0x94c35a0acb52f874, 0xc3cf681377fd226a, 0x1fbcee7e4efa63ce, 0xf839d15c06163db2, 0x3e234da27ba7ea,
+0x20c339140daab3e0, 0x9968de5f0d920b4f, 0xb6edb26e18383a92, 0x70d8375fa339d756, 0xec285a6a32135cf5, 0x2210a64a60251b92, 0xbe5750ad6cc29a7b, 0xf3a9340bd43b3,
+0x1400b7ee02f899fa, 0x2cbbbc9d534f5a14, 0xddfd61cce19b7f5, 0x4729bdbdd7d90c1d, 0x669148510f08fe5e, 0x9919c31ae811416a, 0xea8ed4e5331d681f, 0x93195ff28f15a,
+0xc263cbc8aafe4ea3, 0x4df0b218d5ccad59, 0x80f7ad3a83b9678d, 0x2e87785f43554719, 0x71b6d258d084b26a, 0xa007acb227f68fb4, 0x8e0d708e46acfdfb, 0x25658ca00e73cd,
+0x67a512101b9bae64, 0x5548661bf404ff14, 0x2e46a24e1629cce, 0xf4ba53a7ab62cc9a, 0x900f18e5e4a927ca, 0x9a407a462993b7db, 0x7ae399df53e8898e, 0x3564f4a788ff96,
+0x85ad7d1033e59375, 0xf6fbca3bfb8e1dec, 0x69eab9cf2401d17a, 0x124cd3fa3ff0cea9, 0xa3460835c11a3509, 0x3c29b7db298623da, 0xf3e8d60a7a05bb00, 0x241a45e63b7029,
+0xeaaba164642ce828, 0x2b95abd7851a5f6b, 0xa5e4d95fe05ad367, 0xf84e36ecea40d4ef, 0x38c9c0bf587a3583, 0x7cb75cc15b67a08e, 0x17a667895c0b8ac0, 0x2fe63c3574dbf2,
+0x2d79f40c7bf87b70, 0xfe0778d9a3fbc655, 0xe7df2954fa5ad361, 0x92b42d4ecaff5dad, 0x789a4d68135d2507, 0x9f119d536ef19206, 0x36fbe0a7f435c3e6, 0x14c95917f24c6a,
+0x6b5c826fc0f245b5, 0x47a3b0843bf95ac5, 0x80f3389fc057a990, 0x5146b6cea0a3d764, 0x22701367ed73f20e, 0x52dac098dc8f8876, 0xbb6901a6fe77c316, 0x323d69b5b09a87,
+0x29dd7155b6b8b3af, 0xd7395c1b223e92a0, 0x131736061cfaaf8f, 0x9a9dfc608f10e832, 0xd14e03114b44d3d5, 0xf1185f332bb0a193, 0xc3cd500c6f514c4d, 0x3e3277b732c5b,
+0x74d2f6984d1070d1, 0xd04f6c2dc1221764, 0x4a4583be11420abc, 0x38d47ccb25c7527c, 0x83236e9e22f527f1, 0xd283a85f3822e2a6, 0x8fa973cc3770c10f, 0x2d1400a6639f7,
+0xeab180328c6a880b, 0xd8d7cd3e677971cf, 0x20b465b616937656, 0x8d0bfd2f5c6373e8, 0x3c01a6fd0836d6a6, 0x648837f6e8f3515d, 0xa2582f91cc5b8ab1, 0x17cf2a32041c7d,
+0xd25d6b50ca72f0b1, 0xead895b40b460a7e, 0xa1e56c4d791968e4, 0x3f10fea3fbbb71bb, 0x39f27a164e366889, 0x5a6c014e1e0c6ff9, 0xa80f7636dce613e2, 0x3938d004dc9e4a,
+0xe2074dca8843c43c, 0x37a1be431bc5ff8b, 0x5b9bab55e87a73d8, 0x26081f24d3f54e46, 0x1d5df2a9a3ddafda, 0xaeaf00a45de26d20, 0x1edc4bc2855f6416, 0x31a359fabc1c9c,
+0x2bddb89ab18138c4, 0xbd098b669c16300a, 0xee81450056c1df4c, 0xa53632930bdaf78, 0xab9859de3d01196d, 0xa6f925d840ae4c9e, 0xf8720ee79de3ecbc, 0x1570b683a37f30,
+0x474f5a34433d4909, 0x9c877ef33de40bf1, 0x8363e39e9957cd7f, 0xa523572e2e2c08f3, 0xa5a8cbcb371023e7, 0x7aed28c6b31df7b0, 0x8fdb3199c964b8ea, 0x1bee675a37aa6d,
+0x349640d9f435e032, 0x2fb6c9591b0f5be9, 0xe831dbda04edeb0b, 0xa6fd37d5dca23728, 0x4493a3f9635cb404, 0x30099c90aa520a9c, 0x1304ee5c0e321823, 0x44eac7e7ed373,
+0xd1033212b015fd54, 0x853c5cfe225503a0, 0xf5589b14db4c2386, 0x5b68683793cce9d1, 0x7d99274885b88a72, 0x6c322a16aaf630b0, 0x9384524415b4248b, 0x13ab4fc58f31c6,
+0x46bd285f4f017b2f, 0xbceee8dede44729f, 0xb266a608304c43a3, 0xa5a0ae185a98080a, 0x35422a88dcc876bf, 0x30dfe372df0098d9, 0x235dc6ea67d48a68, 0xb6294288fd136,
+0xd56a3c2e01bc31bd, 0x72b3d30a2a85bd58, 0x3cf80932df2bf04b, 0x4634cb34e5bbbb55, 0x398d4842747f8b48, 0x360c39a89c1484bc, 0x1605f9093ff6293, 0x1abad51e5bbf21,
+0xa4903a876351bc56, 0x6185cace787c3aa4, 0x391cb180688ec9c2, 0xb4da4d3fac916ce4, 0x6dd173217c4b2a7d, 0xd1cb7e8aab35b7e5, 0x8729f80d8ce2af59, 0x338e9c199529ba,
+0x1e8f47f4fc6719b7, 0xff9faafab1cb68a1, 0xdd72cc297a4cba6a, 0x2414f8f1b99dcd78, 0xc51a2c881fdbf3b3, 0xdc5e29d025939918, 0x1449b1996b6d2fd0, 0x1ec44014db5a3a,
+0x3bb2c50472370ef8, 0xad3ec8be3708977e, 0x1bbebe9905ddb22d, 0x142b5610e0bb4b45, 0x77f8effc633bc557, 0x285863c8556b690d, 0x79614723b8dd4b3, 0x2909ac5ff99d8a,
+0x52262b5dc3a2df34, 0xd4611c3550a5e3b1, 0x910a2dd32e2f6b82, 0x903630909a9611f5, 0x8d4940b1b5202d74, 0xe525f3a1bbb13ad6, 0x6258cc779657e8b2, 0x2d4fcc62837651,
+0xed2828254a805ab0, 0xe3d03f798c3c7d85, 0x2f980501bc14c42d, 0x871cc1504cd88f0b, 0x847564e81cfbdca6, 0xb2c41804f3ec303b, 0xb31eed244890f97, 0x37a4036e49f06f,
+0x6a350a11b31c1144, 0xff54733de87a801d, 0x3572732bd06e02ae, 0xb24108259a6483f6, 0xa569484cbd247b26, 0xea8d96ce7482d984, 0x7187f654b940eb15, 0x332b0f969f15ea,
+0x37f25e9063aac54f, 0xd3c2f77147b18a18, 0xca67071581845dea, 0x172fc4d2a6e8072e, 0x54ee84e15aee9086, 0x6aebb07795c34233, 0xdae2a0dced72e1d1, 0x388212ca71c7f5,
+0x7c4b7afe306345df, 0x8cd800ad4a8c6eee, 0xd37829ca037c9ff2, 0x8d18bf3ff12a8cf5, 0x104ed5c5ee3e1b11, 0xc3fe952ea2dc3d01, 0x4c88293dba78ea42, 0x1d6519faf0310,
+0xa61160914f854404, 0x9e4a879c236babc2, 0xef4ad4da7f0aeaad, 0xc6b9ab5e9036a3d2, 0x9eeb35ad000e8788, 0xa55e4c526bb3103d, 0xe59f6e77f4f06d23, 0x25814dc3b227dd,
+0x8d6c0170a6c4059c, 0x431f7e6abca04ba4, 0xa90ce11b0db3d28b, 0x525c3e82735a431b, 0x87f5fec7e0e486ea, 0xc5e024801833749b, 0x193c36e1766ed473, 0x3fa8a5d75261a9,
+0x89d413b1202bbabe, 0xdecc7328a2b0f085, 0xdee323707f7a1424, 0x4dff95c7c1c9b1b2, 0x716ed0c95b77da1f, 0x7d2b63a5d8ca457d, 0x92df859431416bd3, 0x290587ec016b47,
+0x11aeb54e1cee54e5, 0x696023bc2a107709, 0x9d9e75f377538466, 0xeb79d0c971549dfb, 0xd54724873e75d9cf, 0xc2e440b40513c83f, 0x181285ccc4e8f906, 0x1a09a302ad9322,
+0xea5d0fd44e270c56, 0xaf0fd99f9d4c3ffa, 0xeeece581c71d909f, 0x5aaa0ec966667e03, 0x626e1673e65b18ec, 0xe184fd5724aaf897, 0xb14962740cb5de0b, 0x19ec6dd3a0bb49,
+0x785ef605726d1468, 0x22b0009d9cb65804, 0xf29fb86a299dc063, 0xa95c7f5570258076, 0xed7ac6932abe63d9, 0x845568c78327cec8, 0x2bf75be151488f81, 0xcac2fd3ef2735,
+0x52e3ca993004a354, 0x25c2fe7a0439b24f, 0x2355fdf2b1279d79, 0x1693e20b0223b759, 0x1f95505d9944331, 0x72082ee69c00db7c, 0xe6008753314145aa, 0x3653bca40a229a,
+0xbd640d24b056d7aa, 0xd8da4081951de949, 0x58382c548afef2dc, 0xd5767cffc2c84af8, 0x2c4fedcd613c045b, 0x3bc5f9a8119545c8, 0x3dbf86f6327893f1, 0x28bdebba5e5534,
+0x6f72eb26d02237ed, 0x2d80a90a00498461, 0x58af6cfca04d41e8, 0x3ff1ebbcba29c2b1, 0x13b067aa2514e59c, 0xe73f3d6df6f6575c, 0xe92d1337237862ad, 0x650162bd741ab,
+0x19329775794cddec, 0x7ed3a47f9b8ba0db, 0xdc5c519d6b49d32f, 0x8ea61a01020960cf, 0xdb077db11700b008, 0xd7a6ef609d4e272e, 0x70c833bbcf3a97a6, 0x1095416c4d17ce,
+0x191c9272b3968cca, 0x1b80c988d61609e2, 0x68540bc56bb53b43, 0x839ea40bf1676003, 0x4a39612c233de208, 0x6a2fb6a8e387b39a, 0xa120c6d26d43305d, 0x2029924cf6e963,
+0x20839867e108454d, 0x68ed5bd2a25ded00, 0x728730904a7e3c82, 0xa5ca948e04a586d7, 0xe57489acc9fd3091, 0xc83498f4d8b1564d, 0x390033244c646241, 0x362f91f0d38d59,
+0xa1e1e0c9a36d1d5c, 0x45f227cb51224af9, 0x2071286090b0d695, 0xe06ad5161051ebe7, 0xd90568838947e2bf, 0x723ce89c34f8d1a8, 0xa88a425916cca433, 0x1c10684a55cd1d,
+0x59e3daead03e59b8, 0x4713243d725ae429, 0xcac2231e24cf6282, 0x2d174fb55d84150e, 0x29d98194e9ba5c4f, 0x766a38b9e641f00f, 0xb4647bc2b21663f3, 0x3693d9f6d84e01,
+0x3dc81d841172d7a0, 0x8e3fe22b07100c6e, 0xe25833af2f35be8c, 0xb6497f5e8ba5493d, 0xdbe83e7aee1343c3, 0x9bd62272d747c68c, 0x82b3d313e966d011, 0x27a78b8cbda52e,
+0x29c48a93eb28e50b, 0x26b3e7a5fc41a9ff, 0xfe621af38c099705, 0x272c374ec3473669, 0xef8db4ab6df6f390, 0x6522b50121c91ec6, 0xe6b2c1a282af6a7f, 0x3832d166200e5b,
+0xaebf43a7fb96889a, 0xd17a2a70c2ea5321, 0xff05ca259d867e7f, 0x6c85fe47568497bf, 0x75e45539e5f4c55b, 0xf0b9b8694da84397, 0x5ad5b2e453daa2df, 0x39365095ef15b5,
+0x28e99c5546a7f40b, 0x6c0c09e699bb5f7d, 0x1ed3ef4302b3d9a2, 0xa2c73a2a80584022, 0x2f20a60fee3e0cfb, 0xd69458ef635f1c00, 0xe3004978d6818f72, 0x3a4d2888eca115,
+0xf3995820370716b6, 0x393084b53be02be2, 0xbb3667840f813cda, 0xbb4279b0dab15f38, 0x76db01e82dbd9035, 0x1a1c76eb534e05e8, 0xbd053b7980f4061e, 0x12b6b567c1aa5a,
+0xd6f1bc6a7593cfab, 0x87665de15ff08649, 0x98c56769b605c943, 0xf9a0e22a51b75f89, 0xaf14d244e5f7339e, 0x968e70e51d357c37, 0x4d5e77d8d22c0312, 0x3af4111c8f519f,
+0xf95865b79ccefe81, 0xa53841d7d8636560, 0x8df60fe3fe9d5be, 0xd73cfae53a2450d6, 0x1acb4b1aaefbd76c, 0x6f9ae5553c47da6a, 0x22f01b82d9d5c3a1, 0x222683e40896d9,
+0x2458edaec621c537, 0x973d92bc482a86fb, 0x6106d491703571a, 0xc18671d79b002327, 0xdadbee6453678703, 0xf0f375ece74b5a37, 0xe9cc103bfca75aa5, 0x9a8822dd6fd2f,
+0xa88ddb1582857a70, 0x3b306bd1524fd81f, 0x2cfd164f06f3d5bf, 0x9db1b397861c7acb, 0x4680863a8baed816, 0xd0dc2d10d9fb37fc, 0x37f17f8fcd224416, 0x158464f6ceb2e1,
+0x28805fb758720449, 0x97096f71d510436, 0x8465a57c7d0986d2, 0x9f0510a4dfb0ec51, 0xf098e55ab1a76120, 0xa2e3cb6da25507f5, 0xa21c7a4751644ac6, 0x1210613505e329,
+0xc831e2e0bc509a4, 0x1782a442cfd7e8bd, 0x602ea6387e1191c2, 0xa2430f98c67c3367, 0x53a7fdcdfbc9cd62, 0xebe6300a7e24da2a, 0x7285a7b9d40f703f, 0x37d80962bfda7a,
+0xf67ff7d836825fc6, 0x62a2c115bf051c94, 0x4548d8c9b7c697ee, 0xc315596a89372ba4, 0x157a8562bad6552b, 0xda0cbe39ed73b13b, 0x7e43479a96b6edae, 0xd941f5d0cdb11,
+0x950735ee4df03e7d, 0xae77dcbf9c4f5bdf, 0xd8db0f61aae7967b, 0x7d19107ed6fc25e2, 0xaafe36f1260cd1c2, 0xf035b6b6de840b7a, 0xd7f332fad0140b5, 0x3a19854dda4545,
+0xdc857901fe025e6, 0x7727b1074193f32c, 0x77127292d7413f44, 0x1512f32d0dcf1dd0, 0x3f52de509f288987, 0x6886186c1b608ce2, 0xf5bb74bdf4111de4, 0xf076311d128fb,
+0x6a3cdb18afc86833, 0x306fc677c1113826, 0xab48d26a87401e84, 0x44102cd3e98b3993, 0x4b89b9b051a5b003, 0x2cdbe794779accf1, 0xdca33b6074fbd55c, 0x14fc68c21aa073,
+0x1293007848e24775, 0xb6d2b0e0d062e994, 0xe4d2a949caa95359, 0x813fa927a3894594, 0xa83d2a72272fe7cb, 0x91f35974331fc259, 0xfeab305fd1c50711, 0x24147187c73dd5,
+0x5ba40161bbf313ea, 0x3ef3c731b1592c72, 0xefea722d96eb642d, 0xd67c1101d53a97ae, 0xe764776eefcc93de, 0xb644860c6aa77d3b, 0x49fca55f2971dd8f, 0x402a2dd23801bc,
+0x4490bf9f244b5e1c, 0x422fb6ac49c49b67, 0x665533abb66fded9, 0xeb6a99474fcb911d, 0xfa8f82fe60de40dd, 0x4cd1379785a419b6, 0x20580613b5751415, 0x12ea94891a37ed,
+0x20a749dea17b73d1, 0xbe896db22c62a57d, 0xe7765edd73b3e2f6, 0x46fa28b0f502ec7e, 0xb947c05e03f151d2, 0x5c66c27b3f06bb58, 0xba7955a0e2514df4, 0x299753c3acc360,
+0xef51ba7a8f304a5a, 0x108359acdcc7228d, 0x51968d27d7a31321, 0x6b28b3c2ec241336, 0x88d79eaf41014e3a, 0x618b5697b80ac8c4, 0x83c974170bddc9a1, 0x1e2f4f587684a9,
+0x4c5b268e90fb519e, 0x2d00538e3d23914e, 0xbed05266f5b5d748, 0x99af59b8782ccc41, 0xa80c9b40f0770f12, 0x6452550a25e6236e, 0xdc6e147a36dfefbc, 0x38e93e6c332f82,
+0x90b7311d6ab70adb, 0xb8d12e0e7a352d0c, 0xa236de897db9fe08, 0x28b7c4ab7cd37272, 0xaa12e3efee94d441, 0x5e5ed1088d2b8dc2, 0x142e68ce96b1718f, 0x9711a85be6af9,
+0x1eaac2fced4e27b7, 0x4701f8c2b68ff84e, 0x376ed420d2cb91f5, 0x5786c35cbfea04df, 0xe50032c07572b602, 0x5f463ed09888206, 0xaacbfd7d0d24f7f5, 0x1cc42e4dbb663f,
+0xef5545a7925b4b41, 0x5984679e0a75f871, 0xad8a5d04a53c5871, 0xa1a50cae5b9f09f1, 0xa758ec2ef131f0fc, 0x310abedbb0071497, 0xa473cc8fce2a958a, 0x1a8a81b8bb1c7f,
+0xb1195a31e5292ca0, 0x1d75a874beca2277, 0xe28f2a3bc318c4cb, 0x58675f3e1fa4caff, 0x348c6626eccfa3c9, 0x2d9890a34a13daf1, 0x266184f047ff7015, 0x1fdaf936b2151e,
+0x6839e10a3fe14dc3, 0xecf2dcc8978b0277, 0xc884ba7b170b69fe, 0xaa539310c851d40f, 0x74b22590cf713fd1, 0xe3d7cec9fd7cab7c, 0xfd94c1fb064d4f03, 0x2a634c1aee51bf,
+0x3a07294952eb794d, 0xab9db12c3902a635, 0x495739fa65d9b091, 0x6b1561eece110d0d, 0x6c5cac1746a40e80, 0xad3527abd12dcfe5, 0xfe30f491c756fc02, 0x3fa4b1b98724b8,
+0xd3896871c72839ab, 0xb039dcd532a74985, 0x2c804aea3eaa5aa2, 0xb9a2a9a419ea4e68, 0xdd15364a69c1ad79, 0xed5908f982c917a5, 0x56634805ec3581b6, 0x37f473312569e6,
+0xfc4e60691bd7006b, 0x5b8141edf4cc1751, 0x33083b1df92de20e, 0x8d4e0ad3b5f27f17, 0x3a22f41e9df13c51, 0x86f6146fe1b147c8, 0x8bef3783d85ba776, 0x1f300df8e3e0bf,
+0xa9c8086f195b4596, 0x539a8cf0954a261c, 0xd04c06cd24ce5bf2, 0x68d29c4d6a671e20, 0xdd7f76be78aa594a, 0xed83b0ce5339ca7e, 0x8e6fa65112006a8a, 0x3e83368bc49a06,
+0x5ccee1086ef925e2, 0x7264c30a30a56c67, 0xdecc5d5a0cf6ac1, 0xea95d8db4917c21e, 0x6f66c281fb51326a, 0x8482294e794e61cf, 0x2210d0662df24e9a, 0x3226362e8837c1,
+0xf50c4a00eb1fa73f, 0xf61e5e241a1a51f6, 0xb9287f3e3f7c5a4f, 0x832fa4e58812df76, 0xaf78dadee0cadf2, 0xa0ce9c5692c577b2, 0x12593788a44aee88, 0xa0e62cf57f2af,
+0x8c945b03fc072cb4, 0x545a826ccc9a6368, 0xfeaa392f74afb433, 0x6a1b3dbb7ea03f8c, 0xbb0ae710bd04931f, 0xa74aca62d6f13141, 0x873d5906fe4de0cf, 0x3ac5d659ae27f7,
+0x94fed3799eaa9c10, 0x3bb04ca0cd057cae, 0x5271bcf4a94d370d, 0x721782805cbb7b59, 0x735585f4458f3723, 0x67b0959a060be04a, 0x84b5cc920e5a3ee9, 0x13b289d6cd07a9,
+0xbb42049bd17d236b, 0xf373700fee2b4645, 0x9a980fcbb5ccc007, 0x42e948c873f49f1c, 0x24b62adec16dd631, 0xc2e318746c8ebf96, 0xaac93bd19dba5897, 0x333c71e2c41114,
+0xb4dd7d81753c3d0b, 0x50c2733fa5314389, 0x6b41d640851c58, 0xa6bf7ea2b98b47ce, 0xd53fa0f65b99e65c, 0x418e82bb70054623, 0x2f16141fddae2d9c, 0x35f6e7a68d3e1c,
+0x7b70674ca5f0ffe2, 0x3b3e9fa9c40b28d0, 0xc1a0c479d4ce362b, 0x1e2f8cace2045627, 0xbf120674642f4dac, 0xa59d3159cec424f, 0x4d7166e501076b34, 0x2e7ca4be5bbfa8,
+0xfe2ac67825d3a6e2, 0x1caf7f9d6f263465, 0x6b1fc3751cf2a6fa, 0xfad134da52aaba48, 0x1ad2c0da02ff7db2, 0xea94024437d7583c, 0x9ea0ef519f288066, 0x4b4efeca67c3b,
+0xed1a70377820dbeb, 0xb4677e84d6ac8f49, 0xe6f1dc6ee5fbfd64, 0xcc9553685cc37cc8, 0xb2bb20e8299da73d, 0x8eb959c054617d7, 0xc221e6c76955ef9e, 0x23b99919dc4a56,
+0xb855520750a3b4c0, 0xf22e536979361a0, 0x942d0aaeabe8374, 0x40682d731a491556, 0xbe1367b2c5c202b3, 0x3dbf009c7d740c70, 0xe379fdcb61fd2b26, 0x1883bef5dc36b6,
+0xe26ffdeca659fb49, 0xa54fee5b677d0a40, 0x18a7a18a4f339997, 0x4e7bc928b694d798, 0x396f50d6b0677b51, 0x6b1d5a24c8aa8801, 0xe3b86d146535ba86, 0x1c3c51af0881e,
+0x9b2658927a19e5cd, 0xf06cb1bcbf25b4b0, 0x26918f58597a3f74, 0xa9f79582a514ccb0, 0x3b0e8d7ffb395607, 0x92d621b9c3b5f3ca, 0x16aa579dbbfd02f5, 0x2304390d6d534,
+0xe0c0108b8388af4f, 0x2c42bbec754056dd, 0x54bee615e6c7fbc, 0x38fc59ea32cbeafb, 0x9f26bf363058ec8a, 0xa76150b4e3f29514, 0xfe3ac077917c7555, 0x227c0a6d0ad268,
+0x4bf96ec998a9fa00, 0xc4eb4c37fd58576c, 0x3eaec45dacd24955, 0x9b306f4096925606, 0x6b1e9db27e9a9e62, 0x80bd5795eed3f125, 0x4f6c497f0e29dd57, 0x2401483c8a4800,
+0x4bc377ef474ede69, 0xa21f7aa8500cbff6, 0xe99cf75652804940, 0x450469df35986977, 0x9136a7b094c4fc4d, 0x77ab2f6ba4e03f97, 0x7e198355015356fa, 0x3ac0c3ad7362c9,
+0xca0cf29eaf307eec, 0x2990fd22a8a7d96c, 0x78fbd4248906b31e, 0x8f8726e35e5d6716, 0xebfe93d8a018b9b0, 0x8c2cab0394dfbda1, 0x7a044fc06201adc8, 0x2f3077e9e7d1e5,
+0xe428ab52716df37b, 0x2f36aadf7b8d6aba, 0x59bba1a341a29715, 0xd26a2a1c5855632f, 0x1b6d8fed6c0815f7, 0xc041f3e1f9e5b5a6, 0x9dd398af802465e6, 0x12b905ec736007,
+0x3634f283a21fbf0d, 0x2b2e9b485b2fef01, 0xa5c8ef9172cc9946, 0x1bdd00eabd0589c9, 0xfe87394af919a928, 0xfd099c6811ba10a1, 0x4d3330377f237c54, 0x321a35dcdd9,
+0xc33d054bbca896e5, 0x25de1d575f1e886d, 0xe8504cebd67c64b6, 0x9bf41278d226d254, 0xd1c6d01412a317, 0x327e9b086583b134, 0xc67edd97396a7440, 0xa60edc8780f2f,
+0xcb9b059e88ab73e2, 0xe5c410d48945ba11, 0xd2ddb8c2677f3cd5, 0xf71ae07666193cb3, 0x8b8694be93b0b236, 0x3f981bd5baf3cdac, 0xeb218ebf495b5fe8, 0x18832475446a13,
+0x69ff2187f902f56d, 0x15b5694d301d3cf1, 0x724d7bf142b212a9, 0x98dd53e6b21b649b, 0x2448a11472a981dd, 0xeeeef6af6352b6a4, 0x992c6df3ba37ad7b, 0xdd76c8414c8b8,
+0x3b90519faa531741, 0x71a161b0808fed81, 0xef495c5bd4006e87, 0x80bd62f0bae0539a, 0x19ee93f1520cb69, 0x470577dc35c6741a, 0xceadf3aef744dd6e, 0x308e1fa9cfe27f,
+0x99d8dfe81807f77b, 0xa7a97e1dddc40ee7, 0xb8e2d9681a308f21, 0x3bb7ba58c4d786b9, 0xa9ba1f83a297387c, 0xfe273770d3c7a74c, 0x9e797fac594c6b23, 0x289e91195ac0fa,
+0x4755c32cf3dad5b2, 0xa12c244172d8b9f2, 0xc92353c832f00633, 0x68a2177e9843100c, 0x48ea9798c994ca7f, 0xb7c9f7d9ae77e787, 0x9da5ef020eb550c6, 0x2b2f5c45cb28df,
+0xcba6af244fcfc87f, 0x953bc63c6135a6e2, 0xb958ef5721e11627, 0xf4dc8e2cecb51b, 0x62bf8f4760ec97af, 0x2c0b7a136efc511f, 0xd9b2524435bad542, 0x3ca9f2c73e94c0,
+0x24ac83fa09783cec, 0xde1a0c2fb8172d9, 0xa49d37cd9e14d4a2, 0xa42afe1a169a370, 0xa397413c45165bee, 0x1a9b95a3a9a3bacf, 0x45cb7aabfe750de7, 0x22933ed8a30ec5,
+0x95d563966938f465, 0x8b91e6e4f44270ac, 0x27d8b6854b6573f9, 0xf4d06b44611cab86, 0x5efb5e79d1c7e4a2, 0x8e116dcbccd3128f, 0xdefea225cd0a0531, 0x1dc1fa39bf0a,
+0x2b9d894cbbc4d550, 0xa024762537221309, 0x628c966c31c848ab, 0x40ec0f77cb985659, 0x390576bd91e53ec8, 0x9cd667427c114da9, 0x706cba869dad08c9, 0x12b3497f8c981b,
+0xf51448bd14b49593, 0x978fd673d862619c, 0xaaf4f5b7d8860de2, 0xbd1a738f71273e69, 0xb845ac0510b965ca, 0x834d43ee287b541b, 0x856dbe4640f0e867, 0x34f37b70153928,
+0x289809bcfe9e6a29, 0xb853e7a67e6b33c1, 0xefe60d7a178da677, 0x76deba296825f99f, 0x85605a24f8572b84, 0x284c9366b45a28e, 0x592b3ebee937c2cd, 0x14d5820d6b427c,
+0x334bfae6f01a7666, 0x648e1f5b46c5c2b2, 0x4a1ccc6617df4961, 0x8cc1956ab02be70d, 0x6e45e43bbc579bba, 0x493a98958bacc78f, 0x931be2d029441619, 0x2eb8186040b1ae,
+0x58203a9e7c2b89a0, 0x417e1c04efd89dde, 0x859cd7f3f0d438fc, 0x315362cb00495c94, 0x173cda7fe9c5d8dc, 0x74435030f8be7ffa, 0x12b3d95f14f7606a, 0x38dbbc319fa25,
+0xc2f9d8eda0c3be98, 0x1fe3f2abaec3b9a7, 0x3463ea51746035e0, 0xb1e6572c969a0e04, 0xdaac1f9eb3b1e890, 0x2b15bd7549206bfd, 0x2dda279b52291cea, 0x210b05c61ff58e,
+0x8d7ff4a2ba34acb4, 0x70e8c185a51944cc, 0x4457f01c88f8a116, 0xcbdc48be0f1c7e34, 0x44bf897d8d54ed78, 0x6edcfe42a217c2e4, 0x671ddb1396908927, 0x27874419ea899,
+0x62a512512db98ba9, 0xc8e891104fe652cb, 0xd5f7933b8da8d4d7, 0xeddf79c758466e6c, 0x9cc9b103a36ca038, 0x555b4b72e6ace9ad, 0xe308c53c24c97b0c, 0x17ebbab6e8e635,
+0x1bad08281c6b455d, 0x90c55ea55a1268, 0xa47ddb37863a8ea6, 0x4ff23ee6bcb110c8, 0x7282ce472af1628b, 0xf0824507c2e11fa9, 0xec3aed7e007e4713, 0x2df5a92b16a5bc,
+0x240926855e054d35, 0x7f7fef162b4c827e, 0x5226e6fc739bd052, 0x293c870cce7d0816, 0x38833b1f0aee9492, 0x681a6263106862a1, 0x511b7e5c1a780385, 0x5da98a16a8c67,
+0x7eed3fa743d3f53, 0xa5db36bdfa4c30e7, 0xeb75bdb075e3d53f, 0xd1188944eaa741ae, 0x412fd2fc16f80eef, 0x79bce1f75ab73cfe, 0x30ed8d24ca0804d0, 0x6209011c3a977,
+0x1a2d284056579f20, 0xac01fbed2571d0e6, 0x831aae78204ac38d, 0x8c488089c0b42ebb, 0xfd0c6d9d6979c4a7, 0x4f1b6c7d398d725f, 0xba2b4fe9f84da9e9, 0x255e7a84679769,
+0xf8eb6feb477b4dcc, 0x321d26c35207ee9d, 0x61802fff8e3d9544, 0x99349fc46a58f86e, 0xe58e97796ce0657b, 0x382b8361b7f93660, 0xaa6d36e749396b8f, 0x25c25b7b103661,
+0x63fb62ad2331a7a2, 0x2f18e8cedd8da6b1, 0xe19afe51e6701c47, 0x3001b017120bec0a, 0x692021a2d4ea3af5, 0x8945c724a27eaa60, 0x6823b93a31eabf1b, 0x7a47cbba409dd,
+0xc861663824cb8c8e, 0xcd3ed1b214a19f9e, 0x60d985d02b99db62, 0xb67730db3dff1073, 0x9539012658f3d59e, 0x8a71dfe46ac97651, 0xcc20044bf7f1d8d9, 0x22146445a4090c,
+0x6f669a179a9b8b52, 0x6bb5b43431ccc687, 0x3378c207a1f931b0, 0x1ee2c79de8197ef7, 0xbad36941db597506, 0x2ec7219bb97be32d, 0xc69802949f32a2ac, 0xf430123282487,
+0x4f47507e8fe97ced, 0x5d689d5dd29760dd, 0xacd04b45a3232bb3, 0xfb5dcf7f6e952fe2, 0x7bc4c96a80c333ff, 0xed2dd19f504c5bf0, 0xad8292a2a45a1028, 0x2bf6e42222046e,
+0x41253700a993b02b, 0xd2392491e28e61b1, 0x2d10a10de0b66bfd, 0xd3013d3adf1b3c4c, 0x99f037e8c1104d9, 0x99823500656152d1, 0x78885262a41e3af1, 0x360c52edab6ae5,
+0x2a368640156cb87b, 0xd93e07aaeb0b12e1, 0x66b056ae198e78f, 0xd1f9ce4ad6b459ca, 0x1da419c86a20146f, 0x26a98b13aae10058, 0xfb10393b09924401, 0x235f5bd51c01a0,
+0x3d23e6202e6b6a90, 0x654924be954c667c, 0x5fd3a8647a7a7db1, 0x72c7bc4b4fd4eb1, 0x18019bbe4e794775, 0x1822155d4a85a642, 0x5f35e66816c17598, 0x1882fe696505d4,
+0xe60c185d1cbd9f09, 0x5142c8c62944c0c7, 0x811a3caf1803036b, 0x5c83aa3f790f62e8, 0x92e6d6de3eee554e, 0xca30152f21e4cb8b, 0x5f2cba7c21df6cce, 0x404b0508e9cb90,
+0x7c2cde816dfa0f2e, 0xd080b78c354df43, 0x548ffa6e78ab116, 0x869fafac190660a7, 0x5d12156668bebbf3, 0xc8c81494593e9043, 0x375e0a2acd3bbbb1, 0xf502ed0acf14b,
+0x52b066db0de987e3, 0x6cf7d74a4bc7c64f, 0x43f67a9948f3a63a, 0x97b1850836bfa4d4, 0xdb1b9668a997e51f, 0xa7e227f1e3514ca4, 0xd123064f18d0da85, 0x10f2d07d2dec3b,
+0x2adcf7661fe09264, 0x6b210a2cff4c3073, 0xd444734596e24594, 0x1041d9fb29ce3406, 0x792acc26b54e223a, 0xb0b7b7737521bf65, 0xf7810fb372e87f77, 0x21f9affb31fcf8,
+0xb57d5fdb947f379a, 0xa54074ded4a53a45, 0x397344fdf1d6d461, 0xf5cdb0ea615c7660, 0x5604ee7b41ca47a4, 0xf714bfe6b529da47, 0xa69ce2112a7098ed, 0x9700a1c837255,
+0x1f9b2dcb815408f4, 0xc72d02eb3842ce8a, 0xb627212f0cca2a83, 0x8029a2e13e1b7033, 0x7f1e80d2b9d6bf6, 0xb7e2763ba3d4fa10, 0x3cf60a38a954e64d, 0x378ec0074363fc,
+0x97f8d809e98992be, 0xd8662cb1fb40b953, 0xbcf9570a820c4300, 0x24b73ce76ebd3af2, 0xbfe05628794bf9dc, 0xfc07251646b1b621, 0x3a815476ab52700a, 0x291e00cfc36f99,
+0x83ebfaaebd2d88aa, 0xfed58f2130f98940, 0x90ec0e398b3eb6db, 0xcd48f021be7409cb, 0xa84e99264989a838, 0x20e2f0fe185daf65, 0xa8c64d16e55146bf, 0x228d9bc178e384,
+0xb310f5339e4a3cdd, 0x6942c4b1f935fb9a, 0x99c0895a635b50ff, 0xca1baae1a7edf6c9, 0x2525548a31fa5d1d, 0xb962aab44abdf66b, 0x803eaa4dda486689, 0xd78ac6abd408b,
+0xf07380dd555ca6a4, 0xf450676a0d2d749b, 0x70c27f0cd98f06c0, 0xcdfe6c294f6d5b88, 0x42a9459dcc469544, 0x5dfa80cb3be66641, 0x79d798577bc72e7e, 0x207cc9981a8de1,
+0xf1e7ba5f4be174e2, 0xd5a1f8759ffd1709, 0xda367e658ac1765f, 0x4eb699a3d7032bd3, 0x9a39a08f40c9c8b2, 0x8432ec5d9ceccfcb, 0x6de68e785ed739a5, 0x34f3ae4456a024,
+0x394036503af2c045, 0x581c8801701ccd9d, 0x26e0cba049c622fc, 0x8313dd7bab32c5eb, 0x422e7c89a527fd4f, 0xcabea07162558086, 0x5cb45ef9dac7d8e3, 0x1affb9dfc7137c,
+0xce4b6fa2eb89bea2, 0x99a593105b49738d, 0x7e0d984b6bd7080a, 0x5822435de2e2b0fb, 0xecbc564368985a56, 0x4286c1bc4572472e, 0x7ce668200c07014f, 0x34432580c3c7cb,
+0x73dea51580f4d195, 0xc14f8b9db3e2204e, 0x4f60dadacd9f38c5, 0x83ebaa5aa1aa0bf6, 0xe2c9e6fc342f323e, 0x9c355d1e51fe8872, 0x1ec3cb76651f1953, 0x1de10b2d95e75,
+0xec53ad07466379a, 0x510ec867c7934100, 0xf22b20d10a4b850d, 0xdd03ab15a662dd74, 0xfba3be53cc8b9243, 0x44ab90aaa86d34ad, 0xdfa505b3bf6f97b8, 0xb99b215c7372c,
+0x97b8e83dfc1d3a15, 0x415a27ebf33fe099, 0x266fc90025cbc2c6, 0xbdbe72028094df93, 0x5609ae606c16e9ba, 0x577d0c2e1b263253, 0x5ecfb07a3fcb2b91, 0x36d1847e50ed8c,
+0x1fdf09405707eb8e, 0x5bf97df9d8727168, 0x79447c40e5022666, 0xae2cf3f550e943c5, 0x9ba2d543c0facec7, 0xd1585a23ae3868e6, 0xdf8cb8ef92bf825, 0x130e8a54cb0df2,
+0xd63cc1e2b4d776da, 0x6cae302418d4f5b1, 0xcaec10f5920bdc9a, 0xc4ff870c284aa77d, 0x435f5c90ce06bc5a, 0xd36d5f320fd4fcb4, 0xa29f26a0e6f2e7d9, 0x23ea3d4dd68b17,
+0xccbe3d47f5e25c18, 0xd32745dd45b40879, 0x503069d9e237a05c, 0xd811912895b56ca6, 0x728b221151c2d84b, 0x6ac7ec305fb4d8eb, 0x28c7b38a966a9372, 0x1793f8c48f8180,
+0xd4806cc55be5b1ff, 0xd10deca34f7910bb, 0x5d24444ec920c625, 0x302c7d72511fa428, 0x448122b65162889a, 0xe8a5a7ea770fd38c, 0x92d65192754c5d4, 0x1f3c97a2770c6e,
+0x9307e65e05e76d7a, 0x819661b26441f20b, 0xfc782e11bf98bba2, 0xd45132271d0f5408, 0xa7d446379683e4d8, 0xc7a570e78f001530, 0xe963f14a6304a414, 0x26bd4ae2397fd2,
+0xd2e8aae8e90b28d8, 0x64b74e0623bccf3b, 0x8d88848fb5c684ce, 0x5f1956bb42d6ab44, 0x4f502957b798963e, 0xf135d3108bfc81f0, 0xd56215f8f803da6, 0x3da1cc82fe0b7e,
+0x62a982b8b5626bc4, 0x9249a9098612f751, 0x11e4c214524c1b17, 0xc121d4240de9656a, 0xc7f0623868742ae5, 0x8f13b7c6d29d3913, 0xad4d2b9cc419eb05, 0x3de39b0a4771d,
+0x2bd06dfa8db44c77, 0xba6d4226a6c640a0, 0xe29198e8da110a29, 0x990394c24142dccf, 0x88caa47533952f70, 0xf62c12d517c22376, 0x4fed18731e203de1, 0x23e32e053844ce,
+0x19b6601854853af9, 0x337a1c92feb6e5d0, 0xc0600f5ddbd97209, 0xb3925d6a2466dad5, 0x99089c724ebf6fc6, 0xa8596bf1ec87f660, 0xe3edaa35d1217bd4, 0x1ea75c6d3dca6e,
+0x9b7794c9a332a68a, 0x8da2896bc1f3adb5, 0x43fcdee1a1242d6, 0x3a7d4ed83f93da8d, 0xd797ab237b43c338, 0x8a4962e841018a3f, 0x90f3f533fa3d1ce3, 0x2ec99ec785053c,
+0xdd779e3179fb8cc3, 0x2a4758bf84250c92, 0x66445f4f3defd596, 0xd3496ca6984bf628, 0x1bbfba0ed47d56d7, 0x6433277a2eb70195, 0x2247c8507f1ebaa8, 0x3da1087990faef,
+0x46ecd68fddf695e3, 0xcf453422ed3252c1, 0x34d65b0f58523f1f, 0x4e483ea84085aef, 0x7e5ff8288d4d7a73, 0x4a31fae9517b16cf, 0xebb11027152f2cec, 0x3d44206a382e4d,
+0x85cb201c15e1d45c, 0x5548955ca403777f, 0x8197fc9b14a8a6d5, 0x7f5acc5728287183, 0x115fc96203db4762, 0x5ceef2f8c60d371e, 0x6664143e02cc8d8f, 0x14af85afae3b91,
+0x63eee0773c247986, 0x9373ec1a9c48bfad, 0x1eab12ea892b96c4, 0xc966f2531bd1adbb, 0x33770633ff6f72cf, 0x3cb64edd2048ce3c, 0x6d94ea78f6f7d9df, 0x24e0d83ad73ba2,
+0xffb0b4a2c561d52f, 0xf53253b3b3a51a8a, 0xce8b862e73372976, 0xf2726ced60db803d, 0xd51be454391cae72, 0x62d1f038f6fc20bd, 0x23e4fde6677da041, 0x20b20db8b01700,
+0x40cf630a98b9c122, 0x9a1d26974b299f6a, 0xd0bbda8a34ddfef9, 0x2ce4333afa1daba2, 0xe1350ed8a7e48057, 0x1d9ae1c059f65409, 0x33209208d40f113d, 0x2bdbfa51658d46,
+0xdd5db7763f677098, 0xbfe4f7492268fe7d, 0x666837e4453b0767, 0x605f5e6068ccd916, 0xdc68659a83defb2b, 0xd1b3613fea555567, 0xe54c47ffb09ed4e0, 0x2d8cc4855c0c08,
+0xdd8354a676872acb, 0xbb860e2f0e2e6a0c, 0xca8a1622ecd6d29a, 0xbb06db3d72b275cd, 0x9b73f7cf3951af6b, 0x7250f43bdfbfd683, 0x6a36b2e8ee329f23, 0x177d7d1e1e85bb,
+0x8697ae77dc89d770, 0xb4e7711b30c508b1, 0xae0f18f8b5de9941, 0x110580e1e294676d, 0xd16168044f3ce0e, 0xa3729c58b5d983bd, 0x7d098ff85806b1e1, 0x2b0a72f5d22f4,
+0x82485b7ad76e8857, 0xec6818bb80b79daf, 0xe2e60ad08d84a882, 0x7960507417b5db7, 0xb14bc625ddc51cf4, 0x1de10ac2e49005b0, 0x1025fc86be722f4b, 0x1a25843a369aa5,
+0x859a429d3b54f26f, 0x934647ee54b7dee, 0x94fa389b80b07ef0, 0x1bf4f9d777cbef06, 0x158f77a4147965b4, 0xe4fb85ae0c04ea01, 0xd7d741143c264ab6, 0x37621a59cabe56,
+0x6e66964fb0a2f835, 0xeb5f1531ed3c0c3a, 0x4f27aa0750c53212, 0x6b72082f316fa41c, 0xcab7a5820c63d81a, 0x371258e112dc3c70, 0x2a2bd495c0503a31, 0x1f6fa9813b4a89,
+0x9d0c09f9b17f0cbb, 0x439cdbe135e8e55e, 0x9bbc02af31dd9c7b, 0x108512ef7f3dc104, 0x99c5fcd46ce88ea3, 0x8c48e5f6825e5d38, 0x464d806da8f4921d, 0x2869be75b08b67,
+0xf942ced2bf46eb2a, 0x577cb10370ac3338, 0xd6b244e510f67a42, 0x2a7f84839cb653dd, 0x41fc61d862a21fdb, 0x2d5e0ba175025efc, 0x83aefc56dcfe1bac, 0x1f7f9eef3d437d,
+0xe719f369afa42c2b, 0x65b826712d3de01d, 0x23cdb74764bb9e14, 0xf3f4bd4766b7a01f, 0x783a463b2d2bc763, 0xc4a4999338c2ff1f, 0xa02e60e66df7db63, 0x1b586430250ce9,
+0xa61eec7fc7c66657, 0x3aeaa5d798cf7536, 0xbe9cde9835a1555c, 0x4fe57b95ce592fae, 0xb1a0e0164cc32f4b, 0xb64e3b64778bf809, 0x36e12f806b53e85c, 0x121e6881ebbf2d,
+0x8c5aea09d704cfbf, 0xeb0fc0484f23fa30, 0x325fb370ccc33f00, 0xba2e98834371ba77, 0xd241f576fa11a5a1, 0x3b2e787c5c3312fa, 0x2ec91f34aee2c474, 0x13aeceb9fba632,
+0xcb013b372897877b, 0x467caf9b63a371e7, 0x4be3a825e0a291f2, 0x7f45f2e903ac84de, 0x7898aa75426a3d33, 0xecbe8ebe8a03ddd1, 0x2d953c2410b5ed0e, 0x2711457e249de1,
+0xa7a04647cabbed41, 0xd10ce9d2f6157f21, 0x632b6379c7ba7d01, 0xad3d45e50592dfe0, 0xbe586ae44b6a23b6, 0x7801f0e32f500d84, 0xc3e43900653777c7, 0x1f74e146c56134,
+0x5b29e6d467794957, 0x65ac4600fecea477, 0xc344200df0d9cc69, 0x2ad2add19178e927, 0xe85f8f146413333c, 0xf404acd3c9ff19ea, 0x5bc131d6a9fd823f, 0x1c0479c8f677d,
+0x39e2d66b1aa9834a, 0x55f9d3291bf1699f, 0xbe0fe408f1647bc3, 0xb2f763dc5becf67c, 0x6f4a323e9957e2fc, 0x9c40d9b47712e0d6, 0x270bb9ab1fded3df, 0x30161f3e6a7d3e,
+0x8b5fd74e5f156ee6, 0xe8565eb39a4d6d71, 0x18d51eec11386205, 0x1ab7dde5a3bfac36, 0xb8710d4f44600dce, 0xbf557e17fe66a36a, 0xb7b1818cbece2aef, 0x1c0a162415f13b,
+0xc338dfd08639b8d4, 0x9f27bd60aeddc6a4, 0xb207ebcc73631200, 0xd28de801cc36a319, 0x5e9c446ea7f9b72e, 0xb2fcfecc7e390767, 0x72fa3de227c7d1e3, 0x1bf71f3e54d283,
+0x5519978390006034, 0xa8253a86fff2e350, 0x9c38544011e80208, 0x14f6140453f6d4c2, 0xf837bdfd731d121d, 0x9db2e50a6c6de2de, 0x5706e82976887fab, 0xf7c3c05ee2ad5,
+0xb554c71ba04e694a, 0xa05356e35a1252b1, 0xdef9b8d075eeb1a2, 0xc7104abd70d04e7, 0x32f6e3e10e12f378, 0x3bfc4c597c707442, 0xd8fb190684b1b9ec, 0x4af8ad05b6289,
+0x96af44ed4f2fb982, 0xb833a179f965beeb, 0xa9c6cc5f7dba8c14, 0xf1460f3db21c7431, 0xe3b8c3ea8de930b8, 0x3b9cff486338578, 0xd1cfb9248b0b571e, 0x2469c6871adfdc,
+0xc98870d2b5722980, 0xd262ea07339a08b3, 0xdbda618a429135e3, 0xcd033cda26b0f21f, 0xb77284491026afe4, 0x66d3de57168b1069, 0xac890db94b844194, 0x1c8191ccef8464,
+0x90148ccd2aefa54c, 0xd9997c030be95e50, 0xa7967561927f6329, 0xf0e32ffc501055a5, 0x60fe935610c4b570, 0x15d8c5fcb519036e, 0x1aaec2e9672bbd8c, 0xaa700887bd8cc,
+0x5f6927f8fd79839a, 0x9f82496b23bb010, 0x6e41c5105b711653, 0x738bca1795518c46, 0x59fcb5f8668b3cd8, 0xcbbb8524da5af43d, 0x8a645fd3312d02c, 0x2992e5da9c61ff,
+0x1f79cf2fe90f15b2, 0x16c99901e3a06be, 0x9af066a9f143710, 0xc876f3f9b5099bd, 0xa9aa7b03e3c49d13, 0x5abfa44f184f03c9, 0x6c3ec451289e4b5a, 0x3fe78ecd665f5e,
+0xf844008c1fc149d4, 0xd3f59528ac9307bb, 0xb593eff89ce5872e, 0x950c08d83a269005, 0xcc6f51cb7706da84, 0x90f0c2bd1c67b61e, 0x21feabf835fdab57, 0x3ca1501b7598c1,
+0x1b6f9bfa6b321f50, 0x14143baf1fcde017, 0x6453227a4390c018, 0x61c56dfc6a99a8c8, 0x96520ac9a57f6ee2, 0xf935bb2db3b788c9, 0x9dab1477db1b55e9, 0x34b17ffd4ea3f5,
+0xc029b47fb1fb38e4, 0xc85d5543b6536059, 0xe7e0e16fea085a30, 0x5253d53dd9b6a97c, 0x1af979b14ddfc18e, 0x2e054b4f0e3cfff5, 0xe8a515f264b4b9c, 0x17cc9d51eeb66e,
+0xe38f49ee93b631fe, 0x559f5c8314730d0e, 0x709de6548c595eac, 0xa93075c3aab417c8, 0x1530125e5ad10951, 0x5a120efa75ffcd48, 0x970d7218bcdbeb5a, 0x1d04eef98d475a,
+0x83a4a196a2509bbc, 0xd805bf91b1ff51ab, 0xa043e5a3a0a4d9f, 0x9ac336ec31946b47, 0x9d88550348fdbbb0, 0x4e39c0e93ccfaab, 0x73454825dd1856ac, 0x1f71415b8a37b2,
+0xe9c5cb83dcbed781, 0x2100e7cb7c5f774, 0x2f6e0d68047356a3, 0x69a71af5b69307e1, 0x2e9feeaa4833ed02, 0x4cfb7f1d543ea10f, 0x2d3eb9fc372227ba, 0x465e401c733e8,
+0xe508e84b79f29c3a, 0x2425f522e8a2a00, 0xaa9f98bf0a0949f, 0x6df732199ea52c68, 0x353f279433b8e771, 0xf19a9dbe4c566a64, 0x6d5e9341f3b267f5, 0x304c6013cca1b1,
+0xf8be181ba7f1f0ea, 0xccb667d74d5b0dff, 0x7696e760790e13a6, 0xe691a4f67074f8b0, 0xdbeda10ecf0951bb, 0xa431ad6e2d12723, 0x304e75d7bbbaa5f9, 0x33ebf5faff6136,
+0xf594bfa427d53756, 0x608e67f94acdb5cd, 0x31a2e90d51ba27e6, 0x440576a1a7e102f6, 0xb5e781aaea600099, 0x1a436cdca9ab0d47, 0x9d86e0e666549115, 0x391b2b2554fb48,
+0x39402ae1c4902b7e, 0xd617dbd042406ce6, 0xaaeb4dd322e7b7e8, 0x9200f1236338c91e, 0x3b4f697659ce1431, 0x6caf26787bad921e, 0xfa5b9012043d24d6, 0xf7981d1e17bc8,
+0xfc392c21a688b8d6, 0xd5bfe57a35b67975, 0x6060ab1381eee84f, 0x12d2c03ac083a111, 0x3ab3701d8edc6115, 0x9dbc7b110c641539, 0xa7564e0f1e860e1d, 0x2a66692c65a178,
+0x6f89223c6f790200, 0xfe15b1a01bbba4b8, 0xa6e9b55f87de15f7, 0x6eda9b40d04b92a6, 0x76281c466cfee172, 0x2ab251e0b488925, 0x8b6dac200c285e56, 0xcb6074a47b854,
+0x8f360e221cafe74d, 0x6df96e6b00469a08, 0x25ac6515c7f405e7, 0x30e041db6e055f1, 0x2508473033e2d55f, 0x5683244370e0c970, 0x53ed97b5c8085b06, 0x15b8e4f2d2e6b,
+0x36a8d9808713af6f, 0xdd4c277b773e65fa, 0xd6071b8709e02ca0, 0x13bd9cd0cd403696, 0xddf81870e22c1e70, 0x45710a3b2f42da04, 0x7482d8258eff3630, 0x28d14aef948c67,
+0x753fc789a3970cd2, 0x542d6a07d0748f26, 0x3f523016655a209b, 0x626e8ee3f1ac7124, 0x6afc5a4760ee92ee, 0x3ded0de0547f9df7, 0x5e1ae0141767a8fd, 0x17cca047ca8625,
+0x1c72815f92ed9665, 0xfaf73a82dc41b83a, 0xe5e8c84abf84d813, 0xda1ca44b191d717f, 0x5c82e5033f76b868, 0xc0b4481c0ac3311d, 0x336d0d579dd8b473, 0x1855e928a8e00,
+0x445b3d32a14df380, 0x4a424ec787102f8, 0xb2a81af349e73f77, 0xa86ccfe7df3db0da, 0xd40bf62af9eb7ae0, 0x938f50f9125dbb17, 0x7496e86fced9e57f, 0x381be25e20a671,
+0x7277771665b89f16, 0xa8ed3c2e3265cc11, 0x72fe742ee9d76576, 0x4980679e8d2ecf4c, 0x1f585f57db832e7, 0xc263bf7a577ba6f2, 0x80e7da4ef4e3855, 0x2ccd217cf670bb,
+0xd5127d0bd0824a36, 0x985e581084337867, 0x199dc275dca02419, 0x6a77fa56c65ccdc6, 0x40a55e93cd74d198, 0x2eae6ed77b64e0db, 0xc6c13c2b26db32f0, 0x256059420ad247,
+0x48d1be89a8abf913, 0x1d77abdb6cac3b6b, 0x805259e988f66c2f, 0xfae616141e394811, 0xf92b2605601e67d6, 0xda50f3ce93eaa524, 0x7662d858ec46122d, 0x16262551c0489d,
+0xaa96237f4fba86f8, 0x8922ddbf8ea6a67b, 0x763593abb5c1df1c, 0x6f83dca345a59a96, 0xfd43a7fccc9f9484, 0x315c46a246afe97c, 0x11c50c7a1dd12d5, 0x10fd3d924fd227,
+0xfaca0c4371900dc4, 0x38e9dd6536173949, 0x88692965dfc47a30, 0xb0a31e60a103086b, 0xfade614ecdc0eb2a, 0xb06e9e3762ef66f8, 0x6c4bda49d7dd302d, 0x11583b405e0bb,
+0x8fdd185434f41f55, 0x9a8390ad8d6c9751, 0xf2be2b4153aa835d, 0x5654c347910f484a, 0x17d4e4003eb65c7, 0x85ad6dd1953accca, 0xc6f00ca4cbeb158e, 0x3ebe6d53ef8ebd,
+0xbffac8b7a5f9b112, 0xdeb813d9d8a871b0, 0x9a3c63f95c2bd259, 0x8d73778d0739bbe8, 0xcf64de70f171a64, 0x6090539ef1f118b7, 0x6325f5c8d96fa623, 0x41ee177a1eddb,
+0x7a7f375f128e730f, 0x5cf2c962ba6abf36, 0xd591b844dc8aa1ca, 0xf1b5a4410e6ecc6e, 0xee61eb741058b95f, 0xcca246ab9d2a002f, 0x3da926970d0b20ae, 0x1ba433bc59f63c,
+0x8adda757a6f8a491, 0xd6381add2c37f8c0, 0xa37f951137fe034e, 0x1d565cfdfd93505f, 0xa7b1f146696e7b19, 0x60d024af7c458268, 0x6e27901e8c80ac84, 0x27a89a6f1806c4,
+0x4aefbb31faf35ad0, 0x5c7afa2e5ae3f37c, 0xf715c0498069b7f9, 0x4506b12339a730e9, 0xc9eda7e704b17885, 0xd04b1b8663281fb, 0x7e18b3d73e335083, 0x2c359a53188828,
+0xedacccb84b3e085, 0x229935e4bbc02e78, 0x75f7f2a7d1e47689, 0x1c49a8fc18271ce5, 0x93bacd090bbf9a9e, 0x8f2e83e7d797d600, 0x4ef897c668dc7176, 0x18dd6e5f382a6e,
+0x4c211bc7d1266b39, 0x8fa12b9005d9e433, 0x31a498851045913e, 0x452011a7d07c274a, 0xb25b4237824de1ce, 0x2d49ade03440d8ea, 0x56a9e06beb151328, 0x3fd00eceae97d,
+0xeb26198cd6c04a91, 0x7f0893f175b71d5d, 0x34b181cf921320ce, 0x92c64f5d890bfd3d, 0xe14de33b7f111c14, 0x42b83e4b686f6c31, 0xd3e25f9ce3bf6621, 0xf1d1693675db5,
+0x8a50792b340185c8, 0x95a6fce94735b417, 0x46e92111528fb5, 0xc73a1caae8395694, 0xbfe7eef77e8235e4, 0x2f10879722a03a12, 0x8926b84dbabeadfb, 0x3463fd9d8151b3,
+0xb4daa723d0963c72, 0x501f48c70d7a9014, 0xcdaecbc04f0b2396, 0x21f08f0af990a216, 0xffdff8d02a1032fb, 0xb50125679420e8fa, 0x702365e3df85f902, 0x33725fec6892d6,
+0xfa28a86c3601b7d9, 0xb2b3c692f2ebef88, 0x24d53cf44a78438, 0xf9c9b32829a312a5, 0xb660a97b887a251, 0xcaeae584de43260f, 0xd10b03bf1d04b9ea, 0x10caed8a070d2d,
+0x1980687514328990, 0xb765ee05009ef0fe, 0xb02d4e7c11599ea, 0xee6d37699aa93fbc, 0x5bf44cf912c618ce, 0x34a0c074b52a39b, 0x894c09cf60cf8ba4, 0x26353df92b74cc,
+0xfc39f0eb4c473cc5, 0xd43cffcc29a00d7f, 0xde18e9636087d365, 0xfc8eb7e3606048ec, 0x6e7552a21931b1e4, 0xc9a2ec9d2115885a, 0x175a8b76af8ae595, 0x35a00d769841a1,
+0xb74409282f24e779, 0x6dc3b2e44b00b61d, 0x487f95909eef1780, 0xd12bd57b17897345, 0x4f63413fa35f99a2, 0x5b1236e6926f728c, 0xf2e34de5395c5fc8, 0x373c9575c4b975,
+0x42c006bdf1563351, 0x7a2a212c30758157, 0xe379dea4e81c1f89, 0x1575e448a1ffff20, 0xdf037dbcceff72f2, 0xbb04c355e0c1738c, 0x4f967542f449f184, 0x14584f5aaf16d5,
+0xc048735e87488eae, 0xc0c96d143545c73f, 0xe549b9bd4cf416a2, 0xefcedcc8cfbc8418, 0x33413d35fbff1087, 0x659390fbd8ec94d7, 0xb6f4b4d2b14dce88, 0xe5c335479a13,
+0xe245a66de1fb24b1, 0x81b7e0644dd401b7, 0xf77dcb5d9fa817c1, 0x24e2f35fbd605940, 0xe0b434f5249251d6, 0x7b8057e6d5abd23a, 0x65c9a096eea7915a, 0x340e8a50d38950,
+0xc996cb06936cf432, 0x869b3b3921104a70, 0xe8eb997654200bee, 0x6aa5ff2a72abb0b7, 0x24b2d7eed3632ec3, 0x1fbdf49862d94351, 0x3cf631cd21228e51, 0x24b079c5922966,
+0x930acd68c9019846, 0xc006b52a274c27a4, 0xa7ee060b02d8e08d, 0xe1435f8f9da328e4, 0x99ae407db0f32171, 0x2513c923f1a305fe, 0x9238d245dd38e830, 0x6566d9588b94d,
+0x73d26a3d434b57e8, 0xa43f7cab43c78c6e, 0x7cc014473bd43548, 0xa49f5e93a9e6d9c5, 0x797cfb8ca69a1479, 0xd3649ff8387bddbd, 0x811602e4712c3f2e, 0x344e0cfdc59943,
+0xd14098c3ac2a6ba2, 0x81c4687b5600d5cd, 0x3683a5f911b002ad, 0x6d00cc14f1b32ca4, 0x6bdeacf5c441f2c0, 0x90bb0160741ef484, 0xaebc62607f167d1c, 0x13d5203c4c2705,
+0xffa28aa9a0e46406, 0xc747fd4a9281af1b, 0x73fa784aecefb17e, 0x45d480133a865d17, 0xf6de1c93fa0b5542, 0x9accc23da92ca16a, 0xf243781262377037, 0xde53dfc211890,
+0x92ab403fd03b4298, 0x745a65238fcb2562, 0xe7901fad3c68f090, 0xbe1a826cb434e7b2, 0xeac327b102475164, 0x5ba81564d5e297ce, 0x72da707a4501d404, 0xc53f3d81e5449,
+0xb8b0223eb85bf0bf, 0x408402a2fefe2a8f, 0x4f27f8dc9224c468, 0x45439b521445f41f, 0x9b2ffed5f6b74f19, 0x68e21b268d7d317f, 0x5401b65c743dd6f9, 0x3b5048f13110f6,
+0xcc79011a181de1fd, 0x3d7fb58140e772d6, 0x94220abc071f5b13, 0xf4cc0f970988d40d, 0x69b0a2a67be24ed3, 0xdadf3f90cfa751bf, 0xfc9121278c6b50d5, 0x3051e5fdd3b6e,
+0x9ca97a140e49d855, 0xa1f7e23a4893bd0, 0xd4940c4329278e45, 0xffc34bc58b67ed2c, 0x431f2cf7ed7a80e0, 0xf43545c66a681753, 0x57d8d5a3453719ad, 0x2429bbcbe17e5,
+0x48994db38d287f0d, 0x519a9c3cc6cae765, 0x7d666a14d400e8a7, 0x31338407c2994e66, 0x3531561f5923e1a8, 0x6d0e7cf110689750, 0x9d1f8c15fcd5c8b, 0xa2455c435fd60,
+0x42249523ae5bcb61, 0xaf6c427f31f5f87a, 0x6cde0ca0e9e55c8f, 0x12b0416b3e35e2e3, 0x26790b97e4424abb, 0x6d1826ef791bd675, 0x7067473c168f69f4, 0x3593f71fb4129e,
+0x7a7088cc5e901fc5, 0x276807d5ab26e6f2, 0x74d13e55ba1c6a7d, 0xd4ea38be8a410ac, 0xb8e7a0506e6fbe2f, 0x235d818bc8e60858, 0xb9d438ebc7fa9221, 0x22b775a092c097,
+0xfa5c52aa2d646047, 0x5a5dc87611642ec2, 0xb3c9ea826bb2f016, 0x694e74f531801bed, 0xae1ca2d097c66521, 0xd78e5f60ae72174f, 0x13653acd33c49566, 0xaddf111f293b,
+0x39c7e1e2636e3b29, 0x92720c8771d6f21c, 0x11487e796edf625b, 0x7ac2fcf109654e4d, 0x56d0f3f2aeca7154, 0x5e10e89236e7a3aa, 0x9d1cbefffc7845f5, 0x172f62ddad0f44,
+0x6fbdfb444e9a0476, 0xc66b41117a6fc7e7, 0x89ba8af7fe89b5fd, 0x1ee51d3aa9a96d31, 0x550d86ab2a5becb5, 0x4d3f0ff4246756f6, 0x3ea847267edb77b0, 0x3cf49ae39a417b,
+0x510c422c035efbfa, 0x551cbb5b1ab3e2, 0x5a44102bc3fecd7b, 0x339975d8a2032b50, 0x8a81c3d335b24a1e, 0x95a7dcaf84b5978, 0x236ee927e8b31a94, 0x388a938e6ea9ab,
+0x4685e92e6f2e361c, 0xa90ff5b347924c55, 0x5f91b4e562762877, 0xf98a95fc5d9ca289, 0x5277d34bc866852f, 0x8e3ed15ba5412bd8, 0xa81f9e63c23e2f3c, 0x271728e32b18be,
+0xe94b6521c696769b, 0xa2872fc74892c4d5, 0x1d56f978a858e07c, 0x54eece72a694cf95, 0x264fa5aa7fd335a5, 0xc948d5908aaf0dc4, 0x688822abdfdecce0, 0xdbe34a5fbaa1d,
+0x6ea2e4183fdae1e4, 0xb43b2e5fa60550d2, 0x6b49843342be4277, 0x4694d6440bfc948e, 0xb945a9d8e102f378, 0x8cb48b75ebf09e68, 0x80a6118c30241d5d, 0x109f321157ef28,
+0x4d3db809a9ecfe7b, 0x311906ba9b313801, 0xb66625a992ff4f11, 0x13064c8bf223855e, 0x82f96c55e330bc, 0xd4b1b0824e0b9d59, 0xc8f207b1ad5b9a64, 0x3bd5ec4fb0cf43,
+0x28e3ddda44dc010, 0x3589cc501e75e89c, 0x60942c0b8fa8a9ef, 0xac14c180fd2062c6, 0x2f424d9002c6ecfa, 0xa91dfcaba16798fd, 0xe12e230951aa7a7a, 0x22c0fe952ebeef,
+0x60aa9226eb779ea2, 0x705473d270ec8066, 0xe709e0661510c76f, 0x382a24936c2a42a2, 0xac0ec76c10bf2e93, 0x59d1ea8454d42215, 0xc040dce2b7bb70b2, 0x2f52c774b930e5,
+0xc2f4435238c51b0d, 0x70eccfad708676b2, 0xd33746cf06246954, 0xa99731eab77596c0, 0xa349d0220237068a, 0x6bab711352520f18, 0x9ad008f66165d3a7, 0x3c109491027c4d,
+0xf5ead95a935cf4af, 0x9cef70557e9a35a, 0x5e9b37e5a60b4343, 0xf4769126aba8ef62, 0xb42e482817fc2d24, 0x2abb0cb89f36a57b, 0x992c941e743ae826, 0x3367581eed8d58,
+0x36bf66020a238459, 0xb51be35a05d20a5e, 0xf38adb592705e97c, 0x8fd7183d18828ae5, 0xadf78cb34fa48c06, 0xe5a3adc85fece03c, 0x6150796e4dfa013d, 0x309fdfdc7f48dc,
+0xe46f87ba6f4b97f7, 0x1a43182ff961e7c5, 0xc43f5baaf72eae93, 0xb6c2ec60efb47551, 0x4143793754172611, 0x2ec982f5fcae8bfa, 0x9ea59dc09d3bf8f8, 0x2587e8c6fc21d4,
+0x1b8a1f48c0973767, 0x1a3dcd8b19cfeaf7, 0x229055d6bd5704c4, 0xd4555946f62cf0be, 0x82b574ca67aa7183, 0x78b48f02d4b4e07c, 0x76062cbec5c901e1, 0x286893daab3df8,
+0x1dad109076f049c2, 0xc669961942899142, 0xea78533636dfdf98, 0xa9cfd17bc84143f7, 0x817c050fb37d15aa, 0x75e0e939df8892f5, 0xeca96dd68f001923, 0x107e96350f258d,
+0xe1ff2d05d38f031, 0x36e8f0dbba90d30e, 0x69ffeb66e415890, 0x653af19f3b3ee822, 0x4c8f81217bc689fb, 0x92ea22b7a595c09c, 0xeb4a517cdbf02240, 0x2184abe1fdd421,
+0xee143b86b916167f, 0xe921a2a725bb1e85, 0xa22ec39c1650025a, 0xa1e35024cdc20923, 0x6af743c2c40c7b8d, 0x516652fefd5abe57, 0x8bac70deb16c82a4, 0xddc42960f8cfd,
+0xbce627e69e1fdfa9, 0x32993e9d0aa4661d, 0x72690690db8ec2cc, 0x39d9a965a2a927aa, 0xc091e03ab4f5687f, 0x8367963841103bc4, 0xe189a64927adbee4, 0x2860e9d16cb1e7,
+0xf11262c81fb45984, 0x9a2951c4a2541084, 0x5255528903396835, 0x43ae8828d826c8d4, 0x1706738baa3752dc, 0xc3eae9d73e95429c, 0x91b6555b0895046, 0x37e5237bcd18df,
+0xa610aeadf952cfca, 0xd807c28ab41d5e1c, 0xcb2cae2d954876fe, 0x2339d8b39ac6753b, 0x21ba32fee39f7cfc, 0x30e9ca0824bd39b, 0xd264614a7a143808, 0x365718c9bff95b,
+0xd243cb11fe876926, 0xe393b89e293afc6c, 0x5050d7f2651229e5, 0x3996417fd1eb1966, 0x3993e598c5785e, 0xe02fc83e839654ec, 0x44176665be047fc5, 0x1aa0454f015e8b,
+0x566dc839bddcbc57, 0xc0e168dcad9a0592, 0x7362116b44381e53, 0xbe5da22bed489721, 0x3eff356acfe4af3b, 0xd1cc4a2717f2b0e, 0x44d272c1c3646eb2, 0x15b0e56706fac4,
+0x1528ea73b498a8d8, 0x7093bcef1250d826, 0x40363d04b1bb2d7, 0x56ef983175bc2392, 0xc19ed1ecb6a260f9, 0x7bfbb8f2112bc6f7, 0xc1fa2bca8da892d8, 0x5a28d7049eb60,
+0x4dbcf65b3316438a, 0x7c33712ff93c5afd, 0x2c1c4bc059fad438, 0x290258b8eae21566, 0x71bb5a6e8159659f, 0xdd1c90979752b740, 0xb2cb9789d3e07cbc, 0x33b74fdd8c1973,
+0xb06ee137b6f08b6a, 0xcf7adf39daf2241, 0xcb6344e84c895ccc, 0x94637c22d89e06fd, 0xb90e710a32ca611d, 0xafffd4c5ad153a6e, 0x3dc6a77a034f77d5, 0x3287d61b3e8876,
+0x5414f9c254ced9d5, 0x9cbefc51800dec63, 0xccd54fc475c1dd2e, 0x6d6ccf65e83aac46, 0xc41b11d29b6dd113, 0xff89a7e6a0ab8b28, 0xdba11e699996b1d6, 0x33f0df02c5a4c7,
+0xe264c0fd21e93899, 0x205f0d7823572a6b, 0xd223d0794da26bf, 0xcb42b19c27916ddd, 0x4bab035315e7e747, 0xfae86f8d8eaa373f, 0xf4beab3aec87e73d, 0x266089d0bfdaec,
+0x871a1910f9f838e4, 0xaf9e625273a2f246, 0xfd258d43934e3327, 0x96c250036ff693bf, 0xd478b70d1962fc28, 0x682ca13b9f394b10, 0xe86122599ebfe4fb, 0x2d43f2bf1e13d,
+0x8122521199960334, 0x6df66d7bfa231b25, 0xf98abc48c65e2c0a, 0x3df314455e7af328, 0x84ed97a293928c7f, 0x670dca6758a8e1d7, 0x832ca9542e0c613c, 0xffe5babf9df14,
+0x28db573db167abec, 0x17a461c6d782ba53, 0x93d5bf9f5f1edcc0, 0x7cca46bb642c3a61, 0x79661d776404ae1c, 0x83790e3b488ce6b4, 0x898a423302321a60, 0x2cdacd797a8403,
+0x91c9b479c735f010, 0xc46605677c3c8cd8, 0xca8a336d3799f78e, 0x1145722467a409d7, 0x29336b1c3f1a8f6d, 0x6895c23c30c28b78, 0x9b69996ffe28955f, 0x149a62a9eefe00,
+0x1a6901ff2102a68, 0xf8b5e3f5e5c86d34, 0x61482d659fe64e08, 0xc9198d474cdb497a, 0x264a36c0dbd530a, 0x6d79ead747df6ace, 0xb5b0c408c8919542, 0x1d757a94b8a2a1,
+0xa6b5da194fb212f0, 0xfd47f4c990a4a1b5, 0x6f37e556429748fa, 0xa791b48c22ba93ae, 0xea70dd5efa8e991e, 0xec9cb7be1ef575ef, 0xc8402e37e627f27b, 0x5ec8e947970b1,
+0x33dd4d6d895d3207, 0x3e5c5711ffcae6f2, 0x37ab5adb7398f4a8, 0x1b18bb7a6a734f22, 0x61f715f9aa8accaf, 0xcc32fcdf317ad82b, 0x2949e3cec22b7da1, 0x21c09874b53376,
+0xd18fbf578cecde5f, 0x6df7cd9b63861078, 0xe65c94ae30770778, 0xc4ce23c87dea5182, 0xed6256cfdd940d40, 0xdea1138d9a059570, 0xa7d2d1a3d3d6c6a7, 0x1b2433aa70d5aa,
+0xf1392786bd68d646, 0xe3176d15946f55b1, 0x6993c11085e7602f, 0x52d67c078a79e0d5, 0x29a42c25b2cf2320, 0x375ba284d084599e, 0xae61561badfe7f2, 0x23e5f4bbddf01c,
+0x7e6fb6d56b79773e, 0xf2b8bd27bf9e815a, 0xad85044ae4830fc6, 0x1c9879faf67620b0, 0xc878bb8fe1283769, 0x11e5b690a04f7b12, 0x7df8cc3efd53522c, 0x3a90a543ee0ea4,
+0xb1781614ee3e036d, 0x25decad6b0b6a309, 0xf88df2c0f6e6f282, 0xa15ae13ae2fb0920, 0xb4bda6ee6914befa, 0x5c35c99e19f6fce0, 0x4b74927b8c7401fc, 0x59e6e88ceb785,
+0x77acb9d647e37620, 0x1e29369e52580f7d, 0x3f922a1f8c4d6d48, 0xf54a7280d56b9b64, 0x8ea7d7816ed979a8, 0xeb4d5f03e23a9198, 0xbbd8da21547b217c, 0x1a2bf6dcb8821a,
+0xaa6576beb494180d, 0x8fb1964f3a72bcf2, 0x4379ef03aafa68c9, 0x3769cd26488edb50, 0xb88fd26279addaa5, 0x1e1eb63a4f540c0b, 0x6e452a7e3b383de1, 0x2413f852d1a6e7,
+0xd594d4a8b68ec3d1, 0xe511d1d560282790, 0x722de2bcaef22dfc, 0x83fe1d367e417b5c, 0x8fcec723483344e9, 0xc7f6f5c1a89f2d75, 0x2aeea964a948f4b3, 0x342beb95c3a2e1,
+0xe0f4ba21973c8183, 0xce39dee0356aca32, 0x207714cdb13cd060, 0xda9cef665807949a, 0xa437af8ec15c3d1e, 0xa9e80398962cc698, 0x26652673193f48e, 0x21193ee5adf9d9,
+0xc7defd11f9389d2e, 0xc612a09d0e0039ee, 0xb3893594ff65ba0a, 0x55654295dd6339fb, 0xe4c92a287b7f0cb3, 0x39fdd3582632f82e, 0x2046c011f89e3440, 0x2c1452a9ba014b,
+0x51df5d8c70825a4b, 0x954eb8fcdfe16c6d, 0x6583f716bda749a, 0x8a580c9327211ef8, 0x117e470c02af157, 0xbf25614f9846adf2, 0x2ca90cebfd4b96d9, 0x30b35615855e02,
+0xf811b0b7c323769a, 0x2b3f224416ce8c78, 0xaa995674db064c04, 0x7f63bc5955e7a9a9, 0x24b0e6720e2f3f65, 0x32cb077005330670, 0x43e294e62d61dc36, 0x1e034b9901080d,
+0x45a0cce5fffb3c4d, 0x5dce1bfc5fb682f, 0x5e628e2193357366, 0xf795bdfc7af10a2c, 0x602f61fbf856ec47, 0xb1f644f558eea60a, 0xaf2880dba8ab3604, 0x2e2b6c181bc868,
+0x7b7c2cd0153a71cd, 0xbcd12f416ebc8b4, 0x95ad8657fbc2c7f3, 0x73009b95610edbde, 0x2723f5e87d7502ae, 0xb29c8e948feb4846, 0x4b29de591da28b7a, 0x1586b3873adefc,
+0xbf590e7838e0e673, 0x51d2e78030e0800a, 0xb9dc8f0fe6d0a326, 0xe4059a3a9208323, 0xc85deb7b30b296f2, 0x485e488e6273545d, 0x271b5f12e8806677, 0x31427d1b090272,
+0x45bb4f488cb3b4e4, 0x4cc856e01f438245, 0xbf17a7f9ba249dec, 0xdd15b7831b18da2b, 0xa69e22a1b63c26a0, 0xe36002b839183623, 0xc55bccd169f056f5, 0x3596c04308d91d,
+0x4dd6b3cdfa192fa1, 0xcfbf077aa47bb90b, 0x61fb2f362090dd83, 0xfa0d7d8077bbfc63, 0xfc68f7fffa6edc5, 0xd3ebf32017d046f, 0xd3b520b501996d82, 0x3137f604b3e9cf,
+0x30d2e7404685d2e4, 0x95edf319dd7f6a7e, 0x4082b4f8411e82c2, 0x5275218538a5310a, 0x8ce6379e87f1f43f, 0x8111e65b3d6b1a35, 0xfbda192d92bccee0, 0x9a7099e91ed97,
+0x5f8f585d4c5d5831, 0xc45b7027a7bff4d7, 0x940c87f4523914a, 0x83fc9fc21c011de8, 0xfe0ad7593eae9eac, 0xe6e0c00006f065c5, 0x3bbba834005298c3, 0x4e23bff2363d8,
+0x43ac553713fb884d, 0x492f84d7ee9297e6, 0x725d90900145644e, 0xa5db848dba154889, 0x5bed0399b1571af9, 0xa30d34af5fe7f4e, 0x7a1fdc83391a86cd, 0x3d023aaa0af1db,
+0x7c9679e5280b27dc, 0xd93eef288863f931, 0x5185ce1e24f33398, 0xd99316d10032cd63, 0x5bc60442fa0ac3a1, 0xc1394da92e0fa6cd, 0xfed2970aedb3f674, 0x1e66f1f0a6559f,
+0x7ec5a2f2e5412c75, 0x93defb03dd7c85cd, 0x306a790fb1eacd29, 0x7ca430d893d835dd, 0x650db1402f0c09c4, 0x3c138e35033d3fdf, 0x10d48ae22ac4848f, 0xa0871a3c10e58,
+0xdcd27e2b2a1929dc, 0xccec005935e016c7, 0x7232696bed63775e, 0x689b7409fab0068a, 0x4aff4e8185574d14, 0xf6158e953b6d3745, 0x498bc64731a9103f, 0x2313392a58062b,
+0x6a3b80aff1f3b30e, 0xceb768af52aaa9c7, 0x4bfd8529e86560f, 0xc8a279b4c2f67f6a, 0x2dcfa0b11d84a923, 0xa1041ac0e79771ac, 0x12fef964f872cde0, 0x42bb7a751c004,
+0x39e0187e6ce3bc64, 0x1c04b93c64aee461, 0xb51cf62f31253f39, 0xf9382a14ef5e1f78, 0xc7cebbc0688cb5b9, 0x862f0dc9ce417396, 0x297ed9706b2f9c0, 0x883141e937a8f,
+0xb7c2795feec129dd, 0x194259186d45c6e6, 0x2889e7e7244df176, 0x6350197230067bf5, 0x7bb74de4bb5d1274, 0xaece992f7a370aaf, 0xe54eb9fb0cc854ef, 0x18924210b4cd81,
+0x269196f8d09f97d5, 0xb5f9e0f12bf0496b, 0x5b9a06c3c099b622, 0x138de905a5e0598d, 0x9a285062d719f400, 0x854ace1c18465338, 0x1e42329e02c8f01d, 0x18598dbad8c12f,
+0x7d0f9766ac487c7e, 0xc89f2ca5e6c391f4, 0xb871d0eb382496de, 0x2f5a30598748999e, 0x7981e9793efc953c, 0x92b0aed22a4041dd, 0x446f3b15a20b3570, 0x273c53c5c99068,
+0xaf9ea8f0b5ad24e5, 0x7358ef1185fc19c9, 0x9d40341a8dc3919b, 0xfb8e320ba6a618ac, 0x21bebf694b3f261c, 0x8357e7503db50d47, 0x182ae6b9b43d9cbb, 0x3c29ea548d724c,
+0xc81c20bf1b83f194, 0x8e5c5a45bc7fb454, 0x1dae0fc69c81dde7, 0x712288c58cae3898, 0xe12c65c2a6939920, 0x54a45994c36df6ed, 0xa13311dd01b53769, 0x277343981aa34e,
+0xa56fc3307d3025a8, 0x516e6132d30389a6, 0x61f4fde11814bdef, 0x6e604bd59109ef08, 0xa6b44373fda338fe, 0x693ed85dedf25578, 0x8cf1c3b81b6fb917, 0x1e529ea1a6140,
+0x35055ca344319fef, 0x6fcf08e38113995a, 0x8c414418649a12ab, 0x29dfabd50c23b10c, 0x750a0f86c5f0642d, 0xd6915968922dd8f1, 0x52b52df98482ac8d, 0x2ad2fb5941c947,
+0x6030e85ce22b11b5, 0xaa80093f95d2e35d, 0xb7f7457ba65990d5, 0xa583491e85ff2f46, 0xe3b6650db6b6bb62, 0x6253dbb50ae5cb07, 0xef7e44f2f7b6c1be, 0x1287c6c600184a,
+0x8d4eb83bf5a655b4, 0x43d5b345d1670bcd, 0xa5b771a723599d04, 0x498aadf8cba69df2, 0xae44a774705acbd0, 0x1cc81ff20370b51f, 0x15495b485afeb25f, 0x5788407166ac0,
+0x2b66c8d54490e8ff, 0x7aa7f4362fab58bd, 0x98cede4c3a551363, 0x87b84de883540ba2, 0x5297a19081c216bb, 0x1922dd927fa76dc5, 0xf1802e3131c386ed, 0x2272c4a2bd0e8c,
+0x5fbff266c2ccd0ba, 0x101d54f7a2946aa0, 0x5357487d5c4a8c73, 0xbe4f6b891644a383, 0x2ff0a28b63529cd5, 0xea8ce33c417972d5, 0x35ce6068f51ea475, 0x31b840ddd5c27,
+0xa46087687063b3cc, 0x9da973beefed2c98, 0x8b56eec4a49002b2, 0x187d9c156aac2f68, 0x12e0a5912db59914, 0xa17769c7cb2b244d, 0x183155dc8c9683cd, 0x20f1223693f596,
+0x9ea5c87e2d2d784a, 0x129f75d1ed1f337a, 0x63c5d44d834bec04, 0x9a0b21a3a4ccd927, 0xd9d4b986280824c5, 0x6b14946e870d4e01, 0xf79a7aafb72f608e, 0x20bb2a766f838b,
+0x4b368d457310fef3, 0xd61273e2186fb4a6, 0xda74ae26bd283799, 0xea22898e290cea1, 0xbd89333abe4d3e5c, 0x8947211363507794, 0x6bda32d4da126a1b, 0x1deac1bece428d,
+0xf34ecbfcf936318, 0xa38f15ffbfcc1cd0, 0x34e9065195f633e2, 0x813e2e35e15d472d, 0xfe1e984cd83ba966, 0xe8734cd167c7a843, 0xf3d6f02fbb6701b, 0x2e08fdeb85bd07,
+0x5576b9379c836387, 0x524ea7ab2166b3d0, 0x21e176e4fe960745, 0x3433da8f283e04da, 0x77e1b07e30290df5, 0x50320e660e3554b4, 0x5f2dc7ea28042ad5, 0x19ba2873a8f670,
+0xf9e9d4c38bd9dedb, 0x8a5d52c36d4f6257, 0x4cceab2d4d5b3de0, 0x254d9442584f6046, 0xcd3abe2d09a240e7, 0x36abfd23393e8903, 0x384c2b27e5166c30, 0x1185430b0e008b,
+0xc44f2c7ac9c214f7, 0xd37cd80af4fe21e8, 0x3a30fe09cab133f4, 0xbf19320291e7ad65, 0xa054d1483a691561, 0x239ded736d097a5f, 0x10f0bca988ca146, 0x342d9f0c229d07,
+0x5011c12cc6aa2a30, 0x24f557f59ba3dc9a, 0x9fe0079855882bee, 0x17ce19c432e8684e, 0x9d3eb8cf68677b7d, 0x40a17676ec876b16, 0x26bbaae2f056130c, 0xcf39f808bcb13,
+0xe40d659f32d4df73, 0xf4f9830b671587c9, 0xd40270d1e279ccf6, 0xda6c5fe1d1f422fb, 0x49e5e91eecab95d3, 0xfad7dc83c6b8588f, 0x26db5bd8552a483c, 0x3c83764348cf23,
+0x5e37087486d86259, 0x2489beda1244ecf, 0xf764c70c32cdb867, 0x70bf6fdd8e26a707, 0x3bd66371bdbaea83, 0xa934cebf67fd659e, 0x1e0edbedf364488f, 0x27aac8b8ed8ab6,
+0x96ee6550e0c4566, 0x8e4179fd853c2071, 0x8d3195cda9148450, 0x9f3ce3ca8a32d883, 0x402edcc4d45e0ef5, 0xb9f50cb2826a71ad, 0x56c09737c62c53a8, 0x3b0cc96032c78b,
+0xc38d5d7b212015f1, 0xb8fe5e61314def56, 0xd6317d7fbca1df21, 0x738ca65abd403cec, 0xb143cd0d4ac14ce6, 0xb8d86d0a5cd3154e, 0x7e60de9cdaf7eb19, 0x210d7fa26dbf80,
+0x1e6b372222cabfc7, 0xf4cb20d7e3ae9d40, 0x9e7458cc37255c2c, 0xc382d036e93459f9, 0x6f05f0051cac4b1e, 0x6219016d6522a103, 0xb4473d3821b7784f, 0x363ee652143adb,
+0xb50ab8e205690768, 0x772cf895166e5c11, 0x1f0694ec350ca492, 0xebedfe286d6597ae, 0xa0edb99c032483bd, 0xf1253c4fe9ebb08e, 0x6b7ffff6ba25dc37, 0x348c982457b37f,
+0xf0609f3a781d0911, 0xf04ae1f95933349a, 0x8bd7717f2522d599, 0x7579a8d60846a6f5, 0xa9fd8ec814922f32, 0x7e781d3d700e6dae, 0xa9228e888fb31852, 0x3c3486a595cc35,
+0x6bb7234ef617c705, 0x15f4a6e490a2e466, 0x2acb9524353b3366, 0xfa6ba369412256d2, 0x2c2e2027e9f6856f, 0xeb57aa9ec480e704, 0x2e2a05e321de5ad6, 0x2d7b413b626bb5,
+0xd825bbc2744625d4, 0x5dc8ed905f63296c, 0xf6f18c1b105a6d9d, 0x7bc2a89671212a63, 0x5e3276c7dace2947, 0x711a1f0d477ab39a, 0x58cab2e6afe3b736, 0x376d8aa5edda30,
+0x88875033af79960f, 0x8249bd1b3ae91c2f, 0xcf8cb0f628d10970, 0x2d8b0012ac783366, 0x7a0d6309b0e7f8e5, 0x6931067f4b0efdf8, 0x87ba35191f0220e8, 0x2fff82bc10bd75,
+0x1864911d711c520f, 0xf917ce7664a8cf57, 0xe94d6007ebbb03b7, 0x264633b4c8847368, 0x50d237f34efd537, 0xf343a489ab46e5d9, 0x4dbbd84c3a30081e, 0x151a76f6432691,
+0x86c3be624b80986d, 0xe6f919769bbc74b8, 0x3d87c694aafaecf3, 0xf18c22d00ca7ebd3, 0xb4de5d345ada5848, 0xd950bcd9d3c3f637, 0x558aee1993dfa01d, 0x3e5ca9097e2d92,
+0x1299923b19566901, 0xc66786ad42c08b0b, 0x24dd49deee2944d2, 0x9f84586782cfaf97, 0xc2a256a23f9a6977, 0x86825ee585523cda, 0x9b275135461552ca, 0x40173b84a1bcc4,
+0xb5b8ec07faece975, 0x7a1c905f579c5afb, 0xd7fb07d4d7f9ced2, 0xeef40f15e0970ce4, 0x29d578facb2e1a69, 0x46a2cd537b6c89af, 0x53cc6498f621c429, 0xbce9a2cafa183,
+0x4d05965b10aa2263, 0x88d70875860fb263, 0x44faa5fa98b268ed, 0x13a11e22ccaedbc0, 0xca7ce2171e297075, 0xae6346828b60b0cf, 0x48b5fa6e505b932f, 0x397794df551572,
+0xaa70b463394fb0c, 0xdcb8c6c13370b156, 0x2d2066dec3dfab91, 0xd67086f7d09c1a0, 0x8a0e127003620f37, 0xbeb59234f7658e58, 0x1f8d01e69ecbe4fd, 0x255fc9f655e3ad,
+0xf14535c706d49050, 0x7349555ff2a1bb4, 0xf00280baf94367f7, 0x9801b2549f396785, 0x832917adf4b49132, 0xe3476d03094395b7, 0xf0f8b0b059496d69, 0x208fe6c421391f,
+0x62f4b5600a224496, 0x638add23b847d083, 0xd0b781c3782630e3, 0x7f8cbe6a102257eb, 0x8fcd93f755e35c31, 0x97c893c797cc60d3, 0xbe7e37f411bf5fc9, 0x1bbd54ec00360f,
+0x5d8aa043f1f1948e, 0xf531b1c567b8bc7f, 0xada793e730cb1169, 0xa7f5bcde135a933, 0x6d2502f0de36006e, 0xd8ede53622e8d840, 0x87df85e6b9d26337, 0x158b8fce4dd4f8,
+0xfa72f44651a1a03e, 0xa9612dfbeabe7270, 0xdc8bd561bac89191, 0x7bd2577f7ac7e3cc, 0xdf5b854274d1c294, 0xb9e2f2ed3c42caf7, 0xc96c16af077b6ef0, 0x106985937aab54,
+0x809beed387c5a203, 0x5b87211ed776bf3f, 0xf0176282a26df489, 0x65680710ae673d51, 0x3df4306b0d09961a, 0x7a17ebeb553d91bb, 0x35e561f08473c2ee, 0x1c408d22486602,
+0xd3767c5156e90f91, 0xcf677e64df221ba6, 0x655c73eb14b71d4a, 0x887b60c6ad0ae803, 0x92e024a78b290040, 0x905c410c60c2853e, 0x5b8582c96d864909, 0x3d4e3de8d9e797,
+0x267613b57ec7228c, 0x4db56b67f5aa0d66, 0xcef691f0dbfc81cd, 0xf3f8236b48b3a402, 0x65e91db88a95143a, 0xab9f0b266e75a75e, 0x3cc6d7133329a9a7, 0x39b79b8acdda9c,
+0x104bd2d3d6cbf8a8, 0x3893ee63b63d2198, 0x310b41eb963834fb, 0x75c35bcfe53bbb78, 0xd0101e2e514a4f7f, 0x525abe50a438502a, 0x71d0fecbb70e97ba, 0xfc30ee19651d6,
+0x1a466e3ea5a6d418, 0xb871a478ad166cb, 0xf8f0f48acb500d14, 0xee1e6a068ef91d10, 0xb134c0b3c5e75bd0, 0xf507290f5d09071c, 0x90a596ff48859696, 0x3c5ee26dbc80dd,
+0xae92c458b1701c43, 0x15fbdf06cc4455ca, 0x7316e7d5660d1ef8, 0x4f4c5f835ffb6e93, 0x50e6fae71add84ee, 0x98aec9afd91a50c9, 0x5c1a205535c3391, 0x2b2e854cf77508,
+0x654a79726213002a, 0x4a53f240bf128206, 0xb20b739c08e71fd2, 0x84db67cd8de4fc9c, 0x4828d4a34f592b1c, 0xf6d5c4c6556c99fc, 0x8a505e5feada61b7, 0x30dd40d0a49beb,
+0xc74f442976beee8f, 0xf261b27f31c3fbf7, 0x35022ee23ead2091, 0xc4d3b787c1c7aa11, 0xc0a902c5fea79725, 0x74e3b215d43cdd9b, 0xe33dd7be05cc96e2, 0x38c355ad75b433,
+0x63520d4ce937acfc, 0x2cbb579542da5e7f, 0x86ec9802720a6a5c, 0x74f8a727f4314213, 0xb201c65ac5b8f9d1, 0x5a08115b0a03b3e8, 0x70a952fc9a07f37b, 0x15ee5cbfe61dd7,
+0xf161805bda5663ec, 0x87f64e09c1181d63, 0x2817849e1a635475, 0x54e5f2fb82b8889e, 0x5ec72b5342f44352, 0x763a04c090a0ccac, 0x11f26a479d63839d, 0x30cb354c45ea49,
+0x40e7477a8a90c3a, 0x85fba253db7195d1, 0x6b89f5c4406d1dfc, 0xda8e1217f4fe4f69, 0x13213c1ee257125d, 0x4b54c449ffe648bf, 0x17fa69633750e259, 0x3bb4032fa08856,
+0xa06c34a2a3937f7c, 0xdc389eb60d3a5779, 0x37d3aeb3a882d741, 0x62556dd562e7bc9e, 0x9c8049bd679eb5a9, 0xa5085da35e8ae0b3, 0x569197032a64dfd8, 0x35ae025613889f,
+0x444b3aea6fff3428, 0x482c11c7bf0a37c7, 0xde30961aac1cf903, 0x1106c4a9c4c2e38e, 0x18a79a6bd24f06f7, 0x69dff16f5d0def5f, 0x303805b0735cdeaa, 0x95afe15eeae62,
+0xed56e82e7ce0782a, 0xa1e3f622951f308f, 0x219574702fb17ca3, 0xff0c28b356958647, 0x86871b05c264f686, 0x2aed32539ef0dae1, 0xc142da6f6c5e5151, 0x26a6946eaba846,
+0xee7d7026cc2dd9cd, 0xae911bbd91553b15, 0xc2e84295849a109c, 0x208f223bd81e6f9f, 0x99e0704d441db99f, 0x3e0bea21a2f5dbbb, 0x79487669f8cfe2cf, 0x19cdf600216437,
+0xbd1ee00c10a07e65, 0x4c803c9fe912895d, 0x56b10d26e456dada, 0x91074f318d9d8049, 0x34805ea799d82e19, 0x508a12c4645a2c23, 0x184ccf498e4c851c, 0x20900f35a51d10,
+0x9fb9b720b2b31211, 0x76489bfa7f6a4816, 0x54a5df41401a6b28, 0x2f9147fec33c2026, 0x44a3a8cf3b9a2a92, 0x4265ecf3ff433242, 0xfd06786f670d93bc, 0x209f0d0798ff58,
+0x40dac08757eefd9f, 0x51b39d578fb50777, 0x4a1ee419f462beba, 0xdd35c8376ababeb4, 0x36dfc821796fcc2a, 0xa76d76577c4c990c, 0x671dc16c964ae4a3, 0x1516d506cb5765,
+0xebe5a0c718eaa6c7, 0x8e83ccc5d75fc2cd, 0x6ffe00199ed3c5ae, 0xc4c17e4ee94da845, 0x3b8e74fc6bc2cf3c, 0x96367ba689ef33e6, 0x471fa872a830eb0e, 0x35077b9008fc97,
+0x30a1b0d09ec2e1f2, 0x619995195de4014c, 0x9acdf46f2a9d3403, 0x44187354d6029493, 0x10238dd175340ffa, 0xf3c218117e196e4a, 0xe1e5036d12b4805c, 0x1347fb23af9ab8,
+0xdd609b1db4cfa6fb, 0x998b4b0f6148e88a, 0x6e1ad34ad44c036, 0x1e30b76d30603a52, 0x56c8ce0a49197ef8, 0x3dab6655b30750ee, 0x90b60b20afc77657, 0x230a68a519c876,
+0xc0926f289aad0add, 0xa587c39956a894cf, 0xa55f28c78e90333, 0x6cd9fe34b8c5b6a2, 0x48426d01e9aef8c1, 0xa196b6c3dcb16c99, 0x4b945b88682a86be, 0x10136ec2ba85d2,
+0x3a5454115c959367, 0x13aad00968610679, 0x2a45351141398ed6, 0xb66005f92a38edf, 0x6f0d8f35b5951a09, 0xb1e9bff9fce78215, 0xc0e2aed18b931942, 0x25f377d9566ebc,
+0xb6a01c2c2a9061d3, 0x261adbbbb7cd4806, 0xd3692e1f9e6c60c1, 0x31ba9f98b228d226, 0xe4c1b9688615a6c5, 0x67fed385ccdd352, 0xd5aefac52537056a, 0x322ccb405963f7,
+0x6ba2adf990a7260f, 0xe2a1a2ef4003da49, 0x57d2c64d7107ec44, 0x3a249efe8ffa448a, 0xebec4239ec993c0f, 0xef7377871f579d2e, 0xeac1ffc68838c2b0, 0x3330c85ff9e855,
+0xe98d65d0d8619e58, 0xe5d27abe703e2518, 0x7d9c447194f7a7b8, 0xf2a606cc35bba9e2, 0xb6d9866f02d23c3d, 0x7de98733b966375, 0x1f07fa5d3bd223c5, 0x2551a10912aade,
+0x73d83a9f7155eb19, 0x80ac997b4c77f360, 0xdac2a7ee11dcad60, 0xa7673e41035f420e, 0xe2127d12a269af72, 0xe8e99e42d2cec5a1, 0xbe809ef0654e650, 0xcd5be915b06e2,
+0xe3e478ed25ebc28f, 0xdb104d6f061ad1fb, 0xce458bc2f211b8cc, 0x4459dbd178367dc5, 0x5a06b29d2ef33529, 0x8638d485010625cb, 0x7d17ab068cbbb19e, 0x727f9c16e1fca,
+0x6a8e7a379fd6c13, 0xf073a61d55b43d32, 0x14f4a1d73c04b34e, 0x3b5099eec72a9cbc, 0x57199c6c56b9455f, 0x430115a2c196c7cd, 0x93bdd14c309e93b4, 0x3caeb9eb88f582,
+0x11235622912d168, 0xb86920a636e70d49, 0x849126a12b2bee2d, 0x300f4c3ed3034a8e, 0xc5508b60e8c48792, 0xb3ec1249d87c87b1, 0x5759c054ba6bf91b, 0x2829b559524976,
+0xe8e4066b2a51861e, 0xb8864429d4f0bc87, 0xb717956cb55f7d9e, 0x159a01fe289f9f7a, 0xd052887ebd208288, 0x442d7c655afbb885, 0x881caf62fb209c41, 0xd96afa127e4d4,
+0x12c17ecf3b13c408, 0x5bf743c40bd37d27, 0xe90495027d4e8570, 0x24938c2bbd8989a3, 0x1368c4e60c486cb6, 0x2f38d3278d93bf79, 0xbb373427533541a9, 0x392585ea0140f,
+0x8cc259f40d845a94, 0xaafa97021d898f58, 0xdd385b43dec43f24, 0xda937bd2f031e4e7, 0xb0755985e48aeb0a, 0x76e9d551eb9ab749, 0x86e9a37cc85cfb6a, 0x1ad784ff1ab8f8,
+0x611eb0ffe63b050c, 0x49d1a5904fc8a990, 0x65e640c1fc8aa8d8, 0x4b3ee4a20bda1a08, 0x5aa56d878014ea70, 0x3bc07ad207784a27, 0xf7970f7f37e65e13, 0x1a404dc7564846,
+0x51005dbfe9c0f64f, 0x10dcf42a2b5c3243, 0xcf237f05ef00e146, 0xbba55da1c4417049, 0xb49a00e3bbae1b28, 0x3b443dbccf69a9b0, 0x8f9a3b0a10ff89f4, 0x131ada9fe49359,
+0xadda8d27f1940cdb, 0x65f1689e601066c0, 0xe70ad38229f9de86, 0x88f43341a829b93e, 0x2d6ab273b4a66aa0, 0x4e36748f766e90ef, 0xa66fce00d3ed5b5, 0x37cf4d1a2158a2,
+0x40a23a32296fa026, 0x83b43ee943301429, 0xc52baa04306a5dfd, 0x2ba2b5688f26fc33, 0x97f9293a7be8acda, 0x83b992aa9f2318d0, 0x61684cbe615bccc7, 0x313be5bdb6225d,
+0x749b1525f2aa1bd9, 0xecb12f0b8b5eaf55, 0xfd3c6dcd67725637, 0x65fd736d22a4f966, 0x1145b3002fb5559e, 0xa7fa1bd5fbb3f69a, 0x8ef4c8f243e2ca18, 0x1c4fd6e3d59bd8,
+0x4497a8049ac5ec5f, 0x8f6a705b5a3e38f3, 0xd9199ab2043cd8e2, 0x2494bb97a8bc10e2, 0xcc060f3112e83ad1, 0x4e6e0c684336e22, 0x540046623a8d9581, 0x101b23ff96f5b6,
+0x354518beaa81cfe5, 0xb663a508df92ce6, 0xc8effe8fffddff99, 0xb0eeeddf417e40eb, 0xf6a63fe0f03899fa, 0xb1464efd6a32a290, 0x63561574a8a54aa9, 0xb345a20052b53,
+0x3f843f74adef4177, 0xccbe2efc80b6b82e, 0xe55206b98ad52708, 0xd3e28ebf0ba237dd, 0xf272999216483c12, 0x4e16388c2b2f0d50, 0x218eb7822727433f, 0x322b974323ba37,
+0xb39498dbba10302f, 0xb8cf2fe30b078e7a, 0x2f205694356d3949, 0x8590cc0de621794a, 0x9743a27b06b6d9f6, 0x56051d525c851615, 0x782463746598a566, 0x1c7464c005f4da,
+0x1b66e3dee2e63ca1, 0x6de2f1b55ee75097, 0x2b5d8a982748ba1, 0x6eb529307ad7a2ae, 0xece33de2b1ca5d3f, 0x9558d15f4446e15a, 0xcc8cda85a2d85e4b, 0x325194db51cc4c,
+0xd67c2674684c632f, 0xb23f0fd309240eca, 0x9019f429b9f259d9, 0x9188d8fb26e6f985, 0xc4dbcd2267448cbf, 0xbdb56921a7bda6d2, 0xb425dec6a7f7025f, 0xff385ae73e937,
+0xffd64e052f91e142, 0xec207ad0e89ab22c, 0x996d60a0ab704c65, 0x9eec896ab10ad7e0, 0x1b016c78700638be, 0xcdef3a46a7f838ff, 0x6382319e26cce079, 0x31c29d60868281,
+0x5c5bcb543760d084, 0xae6e8b947b8cb3ec, 0x5c72665d245691e, 0xbc63a408cda53808, 0xb30d72b300296d39, 0x93d7e340a675393, 0xdb47253fb79f229e, 0x38875cb0442a5b,
+0x36e0b1dbc1cbaf5, 0x75de4eeae52fde1a, 0x77c30085362169b9, 0x9ad9b4d794702b3c, 0xd2bcb980ec684de, 0x9316abd007df9906, 0xb1bc0122dbc10c9f, 0x2ace8cade8e035,
+0x8289dd2721b72d7a, 0x64d01a3800f19f8b, 0x23d32421b4530c46, 0x850f4652c268f4e8, 0x7b29820143078443, 0x29394e0a8ef5ce0, 0xa913247f0367f586, 0x690ef12d6b4e9,
+0x25de8c30647a833b, 0x6239e0d0c848f743, 0xacaa0ccc94961889, 0xf54653d341254bd6, 0x8147a70d00939be9, 0xaa0dc045cf8f9491, 0x778209907d40ca8c, 0x73204738a4b8e,
+0xda258989c65729c7, 0x96e55a51bee338b0, 0xf97fbcfe18880bac, 0xf29d8825e850a608, 0xec50910f7fe6b621, 0xbb18b3702332c88d, 0x10e6fd4cba40df63, 0x183453ee8a5c0d,
+0x65ec8b7294cb4d3c, 0xef402fa4adada2dc, 0xfa670e77ef9f39a9, 0xb7ed75a1332ad729, 0x8eb7082520099d92, 0x4ee01e8a73ac9cad, 0xfc643ca9af29f8eb, 0x378f93da848fc,
+0xf59f2ae84ec5c0a9, 0xf63d7b8faada6c18, 0x51cc9d08831234f7, 0x2e2b72d9c29dbfd1, 0x5f06f88b2216592b, 0xe900a9631f005953, 0x8a4bc22b63a1802b, 0x2d42fe0ff3d91f,
+0xac8ab19846e4763c, 0x9f1bc6155336d1fd, 0x43a55c13fa7e04bc, 0xe41ec3c30006a570, 0x9b0490f560c0cb52, 0xc9537fd4d4477b36, 0x7fa41bc02e76b115, 0x3ced669dd6ebf1,
+0x64683187f33e0d26, 0xfe3099f1cf91180f, 0xa49ba70331c9a8c2, 0x1edacba97b11b832, 0x37a415fd9b8cebd6, 0xb7606a65e78eca85, 0x807d34f1dee582b5, 0x368de7cee0f95b,
+0x9227bc08543dc0dd, 0x1977ac8d995c7b7a, 0x87cf60aee878dc41, 0xa0e1c26e176abe9c, 0x49fb1406324864d9, 0x1e101770605eb6f3, 0x13dee88887ad518, 0xac77457446e8f,
+0x142dceef65d69b1c, 0xb98afb52a0431401, 0xa941ca8457ee74bf, 0x14f289e8aad730fb, 0xd80617ca16dedfc, 0x3b244f2004c08fd, 0x9faa3cfb482410f, 0x4e2228c3ed4e8,
+0xd60001b835d88365, 0xb60d85472d9b0685, 0xbf048a370a79b030, 0x5b2319e0345dc02a, 0xac8b8ecf79e1f101, 0x578c89cb5517cd6, 0x887e2197d654a2c1, 0x23f56a4f04187,
+0x9185dcf263a633b0, 0x593a7292a2eb746b, 0x36d1335b33639360, 0xe0c9a7d4b6e18881, 0x93595d328772436f, 0x27c30aa880d79317, 0x7e277c7d0b15be86, 0x3fd3c6d4811b1b,
+0xecc9113ce9a7dc2c, 0xc12e91a0cd5e6744, 0x9adf2e73a6553e36, 0x8a490f313a994944, 0xcab3c854792ac57c, 0xde117c46f8d2e1dd, 0x6ed622e5df04f182, 0x323f0b6b0293e3,
+0x12a52b17477989f5, 0x76a1c8efa59e5df0, 0x5925daca3d531009, 0x7736d77965c796e, 0xc852b392a8c9fe9d, 0xf326b795a0ed6993, 0xb5823baed92d4794, 0x44984085042b7,
+0x68e98c8f45c735f0, 0xfd6d79519d3333d1, 0x8286ec5f328ba109, 0xe8b53e4ae0fe676e, 0x57035f1dc6bae8d, 0x78e8966b2f1188af, 0x4679f13f504dcbd6, 0x18aea6eb6ed3c3,
+0x74ff91ec9658ebf7, 0xf976026e4a20a04d, 0x3d1f6b20bbef58bd, 0x6389b476714f925d, 0x124a6fd50d4cf213, 0x4c43cf8e458bcfcd, 0x48131a6a9ae716cf, 0x218819793727a7,
+0xae2ed90521300b5c, 0x7b55b608fa9c250b, 0xbdb3879b01f99b89, 0x5846bf550d5bb998, 0xae3a5710da4ba618, 0xf7ab83530600b1b6, 0x8158e04fdb3e2372, 0x5eb5cba9c3b35,
+0x6daa861e36889f49, 0x9ce4db8a119a9cd2, 0x731530a6761c1381, 0xe45193f1af1d1ef6, 0x7517e3df7c28165f, 0xddc1b4c4db414242, 0xa7b514ed3e759e56, 0x30ae74676d65d7,
+0xed77c2862f8bfb52, 0x67723e12d4f98cdb, 0x5ae3a0318a6a83c5, 0xcb5609bf09b71d17, 0x5bc7dc98c58f9922, 0xc9b566bc8d00a86, 0x65405712184a8492, 0x325ceae4f3aafd,
+0x8b38166aa012c4c2, 0x1f8de9d854e870df, 0xcfd820606653639e, 0x5d4a9712d216c329, 0x20ad3af22169e827, 0xd92110c8ed5bf303, 0xa868b1988b452071, 0x17f87590998e88,
+0x3ddc368d74f95c4c, 0xa6f46779840f853, 0xbd0692ded2e6221d, 0x9843fdb47e28d86b, 0x18f92aa3bdf152b5, 0xc720ca99a1538921, 0x68b4fea821ed7676, 0x1fba59be6e84ad,
+0x1942c7919710f785, 0x7670cd053d69f580, 0x2020f9165b44759e, 0x1a296638a095a496, 0x56ee08a51b769ff, 0xc2d6224bedc0328a, 0x799962f682673d56, 0x2932e8dc9cbe2,
+0x543623d83e84cdab, 0xefb5d6f067dbee17, 0x394eccb3030bd90d, 0x740315680f3577af, 0x87848384f6d7861e, 0x17fbb66548cacd06, 0x9036537f89f7f911, 0x22ea1c0167df5b,
+0x1a65fe7a38d2ea7a, 0x8a854e9f718c9c25, 0x91717cb4e85dbd55, 0x22528efa81d34cec, 0x6187e6e8539299d5, 0xe14ba9bc375f7e85, 0xee4eb70a55e88eb, 0x32abfdfba2f7a6,
+0x2a5863ddd83934df, 0x38e6da20a0ac28e, 0xef58e7896339d311, 0xd1c10aa448dacf1a, 0xc937ecfe3a2655ba, 0x73b0bfa801a17b38, 0x8458a1304d4321d, 0x1728b61041f4d4,
+0x4092672bc0396a73, 0x6d7421b75a42b4a1, 0x5a788f45108064ff, 0xa0519fb121d0e8b6, 0xf4290896a7e390bd, 0xe3191b871aa17d89, 0x3c61ac36e365ebb2, 0x299ac1af25bdf7,
+0xb9c3fb6f67200ba4, 0x224dde505a56b26c, 0x99854aabeb941f44, 0x8ed21e1d15df3e19, 0x670a85375250078d, 0x3f3265b7ec191e62, 0xf0eb7c87380bc608, 0x26b8987a1e14c7,
+0x26b468aa5d52349b, 0x28081fe6272d0a92, 0x3b4919fa56bc2b85, 0x494caf558f6efdf4, 0x3fdd201313cb146d, 0xb97e9719a1eb8e40, 0xc061e50da3bdb7ee, 0x216ef9d7514dad,
+0x634b40d7be9c75ce, 0xdf08aca9aa3429f, 0xbd8e28de81aa258c, 0x19d876c70ec19889, 0x34b256f7cd4d8aaf, 0x3e306820d6f4ba29, 0xe88012c015e2dc9e, 0x3c02e4b68efc06,
+0xc2da8e3a2604e4fc, 0x22bbbd45110dc6a8, 0x37360815bc615e8d, 0xd3f8a9f7bd30ce15, 0xf2c1eb1c0a1da2fe, 0x9224aee7c8d5f50b, 0xf8ae35e3a640cf79, 0x20fdc6e06fc15d,
+0xe40364457dad877c, 0x94e4bf4bfe323431, 0xbf2d9753adec8ba4, 0xa207567b15532e49, 0xe16999ad385e4ffc, 0xa07222f5797604fa, 0xc263bedb00a096ab, 0x122edc9e8cddc9,
+0x2a5b3a77dcbed303, 0x6d7b78dd913af52d, 0xb45420c961a254ab, 0x983cb59c4e473631, 0xdc590c4248b5f03a, 0xf6700b41ff80b3aa, 0x2b44a5c375fd79b6, 0x345685d69d7d9d,
+0xd5b50b8ab38f9551, 0xebdb00ceda14958e, 0x7d0ec106cdd43a50, 0xb0b05b2c7d8a3c44, 0x664db8312a05b13f, 0xc64d1375e943d6b9, 0x1ff8d84db5cc85a6, 0x26ffab8b8c72f,
+0x6eb522cdef702a09, 0x8011c4134ebd1cb8, 0x1083aecfc0bcdb2b, 0xd0753401ff281f76, 0xcb30e4593864f3cd, 0x4a01e42bff838472, 0xd2dc8286a6dd3797, 0x1a5b479170338a,
+0xcb7f04a6d3692787, 0x77cbbb48b17db60b, 0x4b4007004c92a811, 0x7fb29675081aa111, 0xb2691c204964bf62, 0x55cfdbe21efc914e, 0x8415994db14bb0d9, 0x2a58b8386a220e,
+0xe2f6d44079be2390, 0x6a05be3a978c744c, 0x315457308c615a24, 0x68b82edc26bc3b0, 0x47c9bbc1e1fb5b8a, 0xd486b2efc33fef05, 0x75c23c40b2100385, 0x1eff4db6d1cf37,
+0xd19196437c49c683, 0x65144954598fb578, 0x49b09d31fa1fdd36, 0x34ba223c92e8bcd0, 0xb6f02de21ae5beeb, 0xd4934cc519df5750, 0x267f6a5305a514e9, 0x1fe9854be884f2,
+0x936c860ab05fae2f, 0x151e1a5b975a391e, 0x5995543a53241d90, 0x46a929d906f43a29, 0x1d2d7a826b14fa31, 0x1796f083532f192e, 0x9bbca720fb8a5853, 0xd15389b47e99f,
+0xb9c256aa695ca46e, 0x3ddf9650aa14fbe8, 0x4248162c97703ec7, 0xdac9af2711e8ffce, 0xc728994f78eaa365, 0xfdec9b1dfef903c8, 0x1fa2f45f12d35c17, 0xe178d7fad7805,
+0x45a370c9c2a0b149, 0x81e4850baf2aac6a, 0xf529acff22e3ac02, 0x70622cfc74db0d39, 0xc8fbc68aa195120a, 0x3f8c44483211aea, 0x938d4df8994b7157, 0x1b11f9eb8a945b,
+0x37fce04c6d19bffb, 0xb86a2211c91a07be, 0x9f599f5e382776e, 0xe31b30f45b033647, 0xa64649555efac4b5, 0xa87d7ddc8e4920cc, 0xbd33f38ca96347de, 0x5f732092b3173,
+0x665572d2b3a30188, 0x21dc64409e6b75a2, 0x2941d2625fc48118, 0xf1d227e9d05fdfc6, 0xafcf0ce36fa9ab8, 0x79b81386a67bf26b, 0xdcfa3bb5cb568853, 0x12e7c52cbac325,
+0x84c821ceaf961193, 0x6193f4e47c3958f0, 0x69a92cc898402877, 0xbf9f9479fc2ac21, 0xa733051cfedc204b, 0xd6f75b7418420bde, 0xcf802438036d1c2a, 0x3c02f73840cf0d,
+0xb05e7fba76e4764c, 0x8aa62e630145f572, 0x7f99d134d8c34cfa, 0x25dc93b65ac40e01, 0x8a8c1a152994a930, 0xdfa9701acc592d0a, 0x85f867510fc7dcca, 0x1bbf2242a25ec4,
+0x81a2b035f796fce6, 0x2088f0ce012d4b27, 0xb6825efe4bab0e99, 0xd28899140bddc2fd, 0x748baf160ffefef3, 0xe38883488d0fa097, 0x65c81fa7091c2b68, 0x2fbd1889b58f6e,
+0xb14da03b5245bac0, 0x58967a9dd2ce2678, 0x1770d71598db660c, 0x47d2859a449975f2, 0x1cecf8a6033edab, 0xf53048e42e7b57eb, 0xbc8003c16a961a29, 0x246952976f389d,
+0x72969520157a6f6, 0x2a6da5fa8fb1190e, 0xaf678972f5fa3b91, 0x1e867a47f663b6bd, 0x20f7b8ae7a264e70, 0xbe5e86f986d4d1d3, 0xb715274df41edc99, 0xddb67a47ce491,
+0x149d87677f68c59b, 0xa8d27e1ed078acec, 0x9882e9be21a269be, 0x473f7f967dc961d5, 0x4a4a32b9c9320fce, 0x87c47471243f75c, 0xa4ca4bcc72ed092d, 0x1abbe43a4a6f2,
+0xdc4ccfe96f1e213e, 0xb4a17ef3f6522cf9, 0x30b19068f4095f3c, 0xe44ef899539c29a7, 0xc030cf935c6e4c39, 0x58453dcb6aab0168, 0x3a97a0f7d269c2d3, 0x234fb7e6234f9b,
+0x8a878cab11c07b82, 0x2c95b7b07db6007, 0x47c9d2a32ff89b3d, 0x7d78a86b3afe96ca, 0x80153fc25dba7400, 0xa7bf71d35b3f39db, 0x439c71eddf6da299, 0x21532804bec8cf,
+0x1c3030b5874272e, 0xb629ab36ef5d6210, 0x7a7512b52aa12281, 0xec1e969e875e3278, 0xe7862b94d834a81c, 0x346815a261043cfa, 0x18305e6367a1635c, 0x3c6d45a2fe394f,
+0x6e5ae78a004dac9f, 0x459033ff267f7f3, 0xf75985e211f17483, 0xf80f7673c14bebcb, 0x3b7f3b0954bb29fb, 0xe9b80155f2b8450e, 0x5e114e209150877a, 0x31a87d11b25e20,
+0xf330f84d269d846c, 0x7be19aac189ffef1, 0x78706a5111d75bf6, 0x20b67cd7bb3f7e3b, 0x18ac5f0b120de6ab, 0x7899969ee07ff835, 0x88ac235cdaa45245, 0x261b6acbe7a6ca,
+0x19f0f661c1c7c04a, 0x74bf7473d58b5dbb, 0x3d2e8d58dc113fe7, 0xe0ec832851ec3907, 0xd92419924da92d1d, 0x7733a6ad9f7a1f57, 0xcd641eb1e648077, 0x3ac60404166ec5,
+0x9ae3bf13155c30f1, 0xe017bbc3212b500e, 0xfcf5b603e186393c, 0xe2afdc5f2477d50, 0x4ab7d5b4273c4160, 0x135c86f658b3daeb, 0x890c5a98c4affaa5, 0x158225594b7cdc,
+0x55e357e45cc7baf9, 0x6a4d9f66f1b98e0b, 0x2b33b0f463d24626, 0x277aee32b61634fc, 0xcaaf6d585054eee1, 0xbcd70ae9fe57bf67, 0x8597e9afaf70aa2e, 0x3076ffde5031bb,
+0x234e7141e874afcd, 0x54bb2846eb4fecac, 0x70389b8de1c27966, 0xfc65b42caa24740f, 0xac0f605e325d5dee, 0xc86c5a81b4056ac0, 0x8dfa15bb4b25854e, 0x2b0661b07b45f,
+0xa13318d5a69a966c, 0xe45999e437f0a9b0, 0x2eec0df4a583dead, 0x1583fa3a8936857e, 0xa133abd39fd2fb6c, 0xd778b18a5e25293c, 0xdf2ae2a9f532d3fe, 0x355bc91eddcb63,
+0x7da416cbe9ee85cf, 0xd57ad0eaa032ee67, 0x6108f89cb4563c41, 0xc12020decb6a524b, 0x84e3126082680618, 0xf85af0eb46fd7dce, 0x510afe1fc76379ea, 0x2266a3304bc48b,
+0xac38d3557f1a0e2, 0x6c1fc96a49cd154, 0x487f04285c3ea530, 0xd39360d45e30e657, 0x2e006963ca704fde, 0xd9ef72fa182f2da9, 0xf60cc03ddc2cb55b, 0x2c20f0c1153e2f,
+0x69006a86b01c597f, 0x36c655125da85fd7, 0x4fab01c483b63b24, 0xd86f3312ea2971e3, 0x1f72c5ae355f79ec, 0x498831c1794dc8c1, 0x3159dff8eaa91dce, 0x9bec51ec328d9,
+0xa3ca4ecb205c3ced, 0xd2065052a5db8970, 0xfc9722984d2aadf1, 0x9d6948b5d9b65ec4, 0x970d2492ad5c003b, 0x9dbbc399eb690dcf, 0xd484e0bc098a4958, 0x3e8521cbcc99a8,
+0x3cc24b1e2d75e60a, 0x2154b7166e8066c6, 0x12801d9e3f97e80, 0x7b5537a1556d3c15, 0xe33f830b52f35400, 0x12928fcaf95a85a3, 0x229c3572d6b29edb, 0x32fa2f59e3b92a,
+0x5f0c4e3ab2684bbc, 0xdddf3b35ef04e893, 0xb56062652a14fc86, 0x5174cf3cad0d5909, 0x2e1e1d961935823f, 0x31e4b15953173ea5, 0xca0a90354ff1a8bc, 0x6ec930011bb27,
+0x499fd1d2b6f53a78, 0x819cad6fe0bef57f, 0x76e2b9f5f5c6b21b, 0xa47febdf816325d3, 0x9c2809f7cd7c54fb, 0x9e6fdb423d029b0f, 0x71664db2b1f1806e, 0x1672e6b3510dd5,
+0x280cfc27675f3a14, 0x9f11f5ac4b839433, 0x11f2066d23258b66, 0x257a8a8ddea07b18, 0x415bbf41bf7955f3, 0x1e354f8bab312b9f, 0x9a152dbbe0f8847c, 0x2f7dfb38e5fa22,
+0x1ff8ae89242ec5ce, 0x6aa1c46c26a5dcff, 0xed21b02b6f583eec, 0x25b94fe555f51007, 0x960d4571f9d31b1a, 0xae135f04a946748c, 0xb36de6ab90ab8788, 0x3ff9bb7e8d298,
+0x4e5d0ab7a98e2e12, 0x6a3240479b923dfb, 0x718998cec23d85a3, 0x7aa7ff6e06d7ef2c, 0xd684152d11cf1a73, 0x4b3e439b18cedf1, 0xeceeaedd8536d6ce, 0x2acefc75361c77,
+0x9c9f3f7f8c5a08ee, 0xcad78b4e365903f3, 0xdc57df0665b8eafa, 0x7007fafbb06cfd3c, 0x2ec8c63ac9bdf5d0, 0xb26f2d77905900f1, 0x59e3a05c6bc9db60, 0x1da62e88a1ec1d,
+0xd452ae3ae07be91f, 0xfdbc5fe8615ceba7, 0xc0abc24bc34ceeb9, 0xc37a10cce08fccb7, 0x1ef767da561f1863, 0xcc8991b407329330, 0xbeb818f5e7d71ac, 0x2f7056508f18dd,
+0x9e14be0ecdeee02a, 0x96db752a3cc904cc, 0xd77e6875bb12a25e, 0x93ebc807d6cbad1e, 0xc52e126484718380, 0xb1ad903cce1c4888, 0xd2f55476e81b13ca, 0x2abd0b486889b,
+0x58adb76f0c24241, 0x413b527d1d23b60f, 0x93ca6c5c1e621edf, 0x8428dba53aaa490d, 0x219d4d711566ab0c, 0x142dfaef803f3b9, 0x9f8252457a6617c0, 0x338e7ccff1a764,
+0xd34a54dab5a396d3, 0x19ee5100600546fd, 0x62151e35ab1f1979, 0xa9a09c0c98d33ea5, 0x217c13ce21fb56bc, 0x4422e32a0edf7729, 0x4842cd0da3ddfdc4, 0x113e5daaf0b3df,
+0x6c838e54e627d167, 0xddd914f773064ed, 0xb026194bef49dc3d, 0x63cbb3939b3f45ae, 0x2df261aa0e7315ec, 0xc90b3b8f40d1fa8a, 0xdcc6b65f18d682d4, 0xa96516dbaf69a,
+0xdf8bd7c95ee5c8c4, 0xc01bb011598f9469, 0x7903534075f1c860, 0x1563fbb45d4e1be6, 0xee9f3ce9c2117ae, 0x8b190a37f9d4c6e6, 0xb2138be4900f35fb, 0x2f2c607d790152,
+0x9af326100bce0e2c, 0xeef9f46e226d9d16, 0xe71e3c209c9ee922, 0xb39536cfd7e64df4, 0xf4cc5f8f27efce16, 0x557a79eb14ff5f52, 0x5f15384b77e1f89c, 0x3395d8162c55eb,
+0xfd66dca5c7b7c0e, 0xe09beb11783c0776, 0xe6d449a6d17bbdb0, 0x2a1749408c6bffe8, 0x9f8735f9bd630f63, 0x11021a42e85f3108, 0x7af208a802d6945d, 0x2c32f4e2fb3656,
+0xb9be1d55605ac823, 0xbd31abc187bc3ef9, 0xc37644c15463edc9, 0xa5028b14eeabbbbb, 0xb42a8af5fc733e30, 0xb2ec04c3d7694a8a, 0x18e1294c3c3739da, 0x2d6863822f9f8b,
+0x94fc17867442823, 0x3ac17adc88fa71da, 0xb5a566447d1b1ae5, 0x7013e5ef3bb1792e, 0x6aa6b2d5bb55dc05, 0x6ca5d3dff108a1a4, 0xd4ed48b908fd732b, 0x1b1988e8e957d,
+0x17cb37ac3dbd0aeb, 0x13ec69df12d1871e, 0x6271c5386628ebba, 0xa8c6746c4ba952ae, 0xb94a5ee73fe16a54, 0xd7c1f1b7152342a6, 0x80361dc288ac66f3, 0x1058923b543df6,
+0x626f88d874d62629, 0x9bc6aff8eef95df1, 0xd3fd8495771d5d10, 0xeb47dadac9cce3, 0x5515ad5c7c5155fb, 0x742874f311d69a62, 0xe7c12cc1945e3137, 0x790f44e35f35f,
+0x8081dcf1dcfe7f98, 0x25869435fff783a5, 0xeda638aa01b1232a, 0xb66a8aacb03a1d55, 0xa51d17a43939dab7, 0xe0a82259018908f6, 0x624291b93741473d, 0x37a2f07120c1f9,
+0x568ec71ed0192bb1, 0x20f7fe27565ce342, 0x594cb1dcbfe84736, 0xa01566220767e8a1, 0xede9b5bf57455c0f, 0x3f539b316d5014ae, 0xab671c1b65d3c65d, 0x264136dd813d41,
+0x3fe10db160544063, 0x177d234af820513f, 0x6798ea88d75e31f6, 0x8c5e24d612dbe6d4, 0xc94ebc6223f90ac7, 0x21860ce3ca0fb4cf, 0xcd5e8669dd55fc31, 0xcbc34b475abf9,
+0xf96a0a36201b7b75, 0xf4d68f0285718614, 0xb9e710536caad134, 0x34100482d995bc43, 0x303ea1464fab21e6, 0x9f4b85608ce6a918, 0xf1158b865245c589, 0x2a587313878cdc,
+0xabe67f211ac80935, 0x834d8c326cbb3423, 0xbf3bba5bc9d39015, 0xa287891a8d72e078, 0x8dc21a8566b0677e, 0xcb9ff28702130959, 0x3ee00953fe20258c, 0x20d85bc5599863,
+0x8ac89b3c1636222a, 0xdba83ab21f4e8d35, 0x6e5053a4f0acbeb8, 0xd9541fa3043c5101, 0x6a961acbbedeab25, 0xe0f1321c0fe8aa44, 0x58677fcd3beb128e, 0x1df9e07d114afb,
+0x7253c4da37427387, 0xa28f55484da93c98, 0x85a307991f86d317, 0x864095da6e49aa66, 0x22470153a6ba5d86, 0xe93d3940bd90910b, 0x264c3b2a80857690, 0x3349eae74a070a,
+0x3835ced766182791, 0x65211ef6b4fd4dad, 0xccd98867f66c294b, 0xfd8425d994cc914e, 0x9b3a89b088768f73, 0x40da13c1906703d5, 0x6c142385b338f499, 0x27c4673513c031,
+0xcff86f0c9a738521, 0x208836b221c69a41, 0xcf412a86de4aedd0, 0x28f016d8d99f3cb3, 0xac7df7a74f1c3a69, 0x2f580dcd287b8498, 0x42cf580f629b13cd, 0x2c8f7ce5534aa5,
+0x3309dd66e401cdad, 0x33a82469775ac5ba, 0x896442d23e192722, 0x76e9286d8319b944, 0xd660e3e086d02c79, 0x6f011ae1c5fcbb08, 0x539fbbb17e64959a, 0xab200e260dd4,
+0x8ba0ad9ca5d36683, 0x88e948c09fe5af2b, 0x71a94fba90261f75, 0xa3df08c22786b2d4, 0x27dbd8ae09e28b7b, 0xb2e284bd0f4cb3e6, 0x14d5f607690cb4dd, 0x17f1fc59113ef,
+0xc596d86417c72b0b, 0xe0ab353bd06c24d4, 0xc382c38647b7806a, 0xd03f5bcf0668f7a1, 0x9a5829a2658d010c, 0xa4c96d25c6383eba, 0xe10fc28bca42d71f, 0xa5a05240c57fb,
+0x843adc79979879f2, 0xca7c0f4e5eee4033, 0x360a2505d8f68590, 0x2b456ec03bb61121, 0xe62bbc81c9c3614c, 0x4bc5a213e41a6756, 0xa17dd43c5c0e23ee, 0xdccd6e2b62113,
+0x9b195a7051a13a02, 0xc686b370b94c8d7e, 0xe72b8be2a6e46f7e, 0x55a3b2692c25bd3, 0x1df2a1f445dd1824, 0x6b7bb66e9d5733e9, 0xd3eb7a7294a9cf1a, 0xd240120958ac4,
+0x9daedf509de73cb7, 0x1372b3682912b5bd, 0x52e496e5b39f580a, 0x7f7b816af1fd27e, 0x1c3193a343af9b11, 0xfe623e421e0364db, 0x96c24defe28d7b5, 0x199d7691f53c8c,
+0xa2f0729592039380, 0x749f215c960be209, 0xc5ba5b980e9f8aa, 0x4fe6e0f5e202983, 0xd95e18e7ffc4da3d, 0x89fff3bd0dd453c4, 0x7034da451d760f2f, 0x40134b5e20f25b,
+0xc1386863dbb96262, 0xa2bdb49e583c444f, 0xa7ef5f68306ff9d6, 0x31cd49ec8cd1a3e5, 0xe2a51bee4c5dc51f, 0x5685c20e891d29ae, 0x5992d7f37b86e717, 0x3b1f403bbe7f40,
+0x54767d8df1937d91, 0xc01cc4c15555ef55, 0x70df637c9513eac5, 0xbb50c332827de04b, 0xa1f473c5facd0011, 0xc0d4f2a92b6b11c4, 0xe7780d48849b0e79, 0x15286a87c49509,
+0x537b2ea1ee0ebcea, 0x756a19fc02c3fab2, 0x90f2f9f12cadc9f7, 0x746af394149bb02, 0x2ebf3ad8104b99e3, 0x65ae7f02b8eb36f5, 0x78c6bf41a5708edb, 0x7d6476c41befe,
+0x535325b61dd7b3c0, 0x804ac7f824861753, 0xc11d0c995c1c6f7c, 0x14c63b4d869ea675, 0xb0474afa70f351a2, 0xe5fc1059f84e7ceb, 0xf3be8f20ecdb4a57, 0x7f9d1115c28e1,
+0x7766f1c4653f73ac, 0xed398d8c30866567, 0x4af7c26d1485490f, 0xcad6b73a3fbaff5e, 0x8c720a94fc2dc676, 0x3eb5b18e26bd1d2c, 0xe7fe11e635ec568e, 0x130091bb1f99d7,
+0x719f3665d346a17, 0x2af83d8932dc386c, 0xb0d85329ee5cb0f6, 0xc4f2274cb8676813, 0x77154452904a9fbe, 0x235151ba0b43e17b, 0x68d159e8261e29c8, 0x2e7bdf6566ed7b,
+0xdf21aceca494242b, 0x2d2d433ad1c42104, 0x329b51c0d0ffc003, 0x2db9d5fe7ce1aabe, 0x312cd34b68b1023b, 0x4c1f9eff9636dcec, 0x98809e89519a3e31, 0x221f6f8fb4532e,
+0x64778918348c0ff2, 0x45605412fa49102b, 0xc954f1b1a623fde7, 0xc38c616cdb5b76b0, 0xdfb63764034d122f, 0xa824aa66b52588bd, 0x15a121a5f49726d5, 0x3a7a61d3ffff70,
+0xdcd6f792e86a15e1, 0xf483bdb775b80173, 0x85ff10ba034c608e, 0x2beb4c04aa6ae9ba, 0x9f197fcee6b2ce14, 0xed3cbefbf9f4b805, 0x7c98802572bbdaa5, 0x1277087e59b896,
+0x6eadacc2dbf466b5, 0x12391d8daa046c14, 0x65057fc469e66691, 0x57b96efc623f343e, 0x5d26e1f25986f32a, 0x123794bf7022bff8, 0x8202a61c862a84fc, 0x329d9d9cf1d36a,
+0xbfe5d64fd192aa89, 0x7574bf628168b32f, 0x6552e342735e76b4, 0xb5fedba76203baeb, 0x7d2fc75742ef7c1e, 0xfccea3e4bf3cbc09, 0x690d80be0e8de9e8, 0x1e7f0045bc91a7,
+0xebf1b849e292fcb8, 0xccf6fcaffcec94e1, 0xcc8fa40003d70087, 0xf31e406fefb58050, 0x9db3c621defa624f, 0xf126063c51f8078e, 0xb928b7e8af1af4f9, 0x16055d809d9cc9,
+0x46726c2e35ae3097, 0x8791cdf35dbce39b, 0x3b66fae88aaa195c, 0x4614229b647954ad, 0xd8a238cfaceed1d8, 0xf0bbb28672e8ed5e, 0x48136fc517c156ef, 0x1d67b936f9cba3,
+0xc7319f6d3365ce12, 0x5f3578fd46882200, 0x1b8a1ec11c534193, 0xdc203cf63184d4d, 0x3cf4d97eaa495987, 0xf148e2d6c56064f0, 0x158e39577bbef172, 0x3d4f4780a41ca9,
+0x9f0cf9bfc2a2f47a, 0x909158bc15f9011c, 0xfe8a3acbef535182, 0x6e950aeb019aa612, 0xab77e59ce27e221f, 0x4eac9f72b99bcb28, 0xcac08df0140332f7, 0x366bd44d72b7f4,
+0x1d69ed7416d84d99, 0x62ce4cc58e9b0562, 0x4ced04b8fa49faab, 0x5b7e200e84389123, 0xf6a3d368641ea0e9, 0x9dd04560fd277f9, 0x3a869fdfd2e90072, 0x29d02cf368d711,
+0x8116ee88b70de671, 0x9bc80c64f2dc6913, 0xd609f3cb61919f8a, 0x7c21a71dbc5c91a8, 0xcd3cf7f432a9ca00, 0x8a6f6f7a5869edf4, 0x1cc1468498e763e8, 0x98f0a2870e304,
+0xd643b171261afce8, 0x707b59b6d9e527f4, 0x7055f574d9813bc0, 0xe0dd6bb5ba762d7, 0x6e13042a318a984d, 0xc3e6ff8d0a61f9c9, 0xaf49a127796cf941, 0x12dbd26d04fe70,
+0xca2e1b91960e9c3c, 0x4655642a48e40de, 0x85237233ca9d69e2, 0xdc7f935d99647ab5, 0x193286e0169e32c0, 0x29e7f8487acc2d0c, 0xd3e55b73b55eadc0, 0x3a5ca2d8387af4,
+0x75706e36d5e3c7e4, 0xb0c5468e276c86d9, 0xdd3ffbea0d35aef6, 0x4a8420f4ceafb840, 0xd043cfe9ab1b1863, 0xbe36b6b9aa120939, 0x11f1cbfd0de6e0b4, 0x2d52ade45b54ba,
+0xf60b5c2b31b1a6a3, 0xec875b35715d2030, 0xa54ed19143f5abc3, 0x20b199ffc5dea232, 0xf6381dddbe79a943, 0xa005ebb0a3ce11e9, 0xbbec2446493b5038, 0x368c9ae3cb3965,
+0x55cd4e77ffe513e1, 0x622a8608c1034d00, 0x3206de4afc31558f, 0x6c0f5a9d460c0650, 0x72e7e546eb0a8d43, 0xfc69bb555339c78c, 0x677e6d79efd00f20, 0x3b6c797d49cbe8,
+0xf6b76bda7974152f, 0xf3c18bba52922025, 0x6e991c375775c92f, 0x116d4cd7e9258a67, 0x171cae6c119ebd10, 0x4281a38325810d8c, 0x3338ea8f1a4b3717, 0x1f95820ec1e2ca,
+0x8d22336f4fd71c3f, 0x66e7503dffc125f2, 0x89cae5d20e31ce23, 0xec2d1a7ce3a6e243, 0x6487dfe6ff5a82fe, 0x31b5cf03325fd206, 0xbbd72798f69b5cbb, 0xb317fabf24b82,
+0xfd1a919c88f720d6, 0x5847d569c476fe12, 0x86e40467c7791eb0, 0xc878fb779f85721b, 0x2d2a222ca47eeb41, 0x37aefaeef10c2657, 0xed661e5cda82f604, 0x1d820d7dff183a,
+0x6ce3c514cd044baf, 0x9cdf7a42f6f644e2, 0x193f01a33db9ea29, 0x4a9027db1ad17eb8, 0xfcdc2df50edc3fa1, 0xffdb8657de0e63dc, 0x4c6574fa0af00d01, 0x53f8397c9c08f,
+0xceb9d03a2dac6e83, 0xb54af8409cdf75fb, 0x67cb2304fa673b7f, 0xcca10b44c054b9ed, 0xcd2030d384ac3dad, 0x408423e58bdd21c9, 0xb596c6db0ff7423a, 0x38c954dd096956,
+0x9665475d50f9362, 0xcc9c77ab5e1ff4f0, 0x8a7a2cb907ba2dc9, 0x33a33189ba778bb7, 0xf24294eaba4a6517, 0x65e9f0b498740822, 0x962e2fca8ab41003, 0xda621ef82dbbc,
+0x5fd409ea14bfefd4, 0x20b1663d203778c0, 0x2b5c2ef42018d3fb, 0xb07065d72ce1ddf, 0x38b23d42c6f22ce3, 0xfaedc4c043be3591, 0x64fd343994db1f19, 0x90589a54903a7,
+0x4a675be0732f3cc2, 0x3fd7fca29d537b15, 0x8522a8e6dc6b8bf3, 0x4f7cc4b38bc65e6f, 0x3099633380fb6b9e, 0xd24a4f7a8800cc3e, 0xde538079a7fc78ec, 0x189c2007d292f4,
+0x1526e5be8f658e84, 0xc776f1db5726ea68, 0x56bb74f56bb955f9, 0x141e52585faf5897, 0xfc48b02d4bbcc8bd, 0x5e4628e15525f7a5, 0xe9b0b3730d075b08, 0x121ad0b1ba838f,
+0xef216b57caf7e882, 0x8d9a8f13ab4809f, 0x39a26d1c7a9dfaf8, 0x8c00389c8e8dbabf, 0xc905a7fb7093a7a3, 0x987fe6c7ed691a85, 0x4984e7c3f3ab7359, 0x2c19d4813b27d4,
+0x5c705422e2679d80, 0xbfb7d5071fdf3f2, 0x231032306bad3c68, 0x71556bef9ecefe1, 0x890e93cc724bd8a0, 0x7e8bb9c69aef00c8, 0xa4496fc0851146b0, 0x72c1910b72f9c,
+0x527c64a901e25c9f, 0x90fc7f75b933164b, 0xfaf93f939900afbe, 0xfda713b8f11864ff, 0xd0b5bc32102ffb93, 0x404b4429d77b1c94, 0xa45db8976fa549ea, 0x4fd34519fc03b,
+0xda292cec6af18d87, 0x27c944bc44faef6f, 0x54cdfd26dfa962, 0x569cc44b1ed1d17a, 0xf35e93474189f3df, 0x36d5efbfde669a09, 0xf309207ca97ecd4b, 0x1c284bf8407503,
+0x9fc308d3989df2da, 0x2f9fbb16d6a2d224, 0xa3c9e14829004b7e, 0xf7b58a6d7ff961bd, 0x73be8b7559e2e66f, 0x9aa0f9f73af33ee8, 0x86f075d74aa64dec, 0x39c2e0fbeab9b8,
+0xd4ed70d94e76ca20, 0xe6c7447b7622761, 0x8c7aca677892fe20, 0x8098f56c853b1e28, 0xc8f968487b1f470d, 0xbc29322ab05c78bd, 0xa0a3b055da593acc, 0x14e60301c280a,
+0x91acb9c671abf24, 0x88fe9e9cead2612b, 0xd91a4df94e36caf1, 0x7820032ac6336eca, 0xf05f416276788cac, 0x3cb7f6d027b1349, 0x9463391ea376c6a1, 0x25d36ea750efd3,
+0xf77fa6e3e4c3c0c7, 0xb8f6f471ab0001a1, 0x6423530fdd8ab3b4, 0x65b6139b84ca41d9, 0x24edc50f9f01c307, 0x8d7337aea598cddf, 0x2a8d3ea45a505bf8, 0x4024db63f837d4,
+0xd0045fa4516bf33a, 0xbcba9aa48e6ac8c, 0xb4d4458eeadac16a, 0x29abff001b8ea366, 0x52a62583bc79de72, 0x69b9544e86ae17c6, 0x1b2d90f51b5646f3, 0x1b4603640d4e1,
+0xfb93f13b29638f55, 0x2735fb9b60e0bb0b, 0x44af5cf360b93898, 0xb79d32d0d691c8b, 0x647db22cd3b3ec48, 0x581a001b6b1e6c8e, 0x88cfe006a4eaa59e, 0x35de91da25aad9,
+0x32348aa7e5028190, 0xe8e51e22fcffc7c2, 0x98622197ad9704f5, 0x5142bd6164818419, 0xf1021ea84348f2c1, 0x5905cd2a8c9c96e5, 0xcd17f60248f2e29b, 0x37364a1b388d9a,
+0x7d6f5d8c3aebe4ef, 0x945be2be55b307d7, 0x21be32e95ceccd9b, 0xa744929fe3d326ee, 0x353a9023c3007849, 0x63adab889a394cb, 0xb3f35ec6539520e0, 0x2fcf5e600aee4d,
+0x51f8e87ff76d4755, 0xfa6e14684f9dd1bb, 0x5ebe030139e2339b, 0xbf4f84d27d808507, 0xc0dc9e40dcba544c, 0x654044e14dd84f99, 0x50e663cc828533dd, 0x367b9bc28f353a,
+0x34d44f9276b29189, 0xa33ec263f54742a1, 0x8bc1ba21268aed94, 0x2e5e6c4b3e870523, 0x478fd0841c825c31, 0xf1df08c430d8d114, 0x43420ddebbb69aa0, 0x288b02d88d5579,
+0xe938c313912244f4, 0xaeff76b57d5c1c40, 0x7ccb88ad6f09d186, 0xb6e940576b138af4, 0xc8292141b5a746a2, 0xc1c002beb761f0b9, 0xdb41f5237be7e1c, 0x12507b5804edf0,
+0x8ff0afa7625bfd42, 0x41e5d43b97c6bac7, 0x1dd46939faf26f75, 0x800afefd2c0a1e38, 0x5cd1ca2f0bcd2fb, 0x6a4e1d142c5fc6f, 0xf367774187773910, 0x2b22bef673dd18,
+0xfc445fad887094d9, 0x4811d731fc5c1ceb, 0x9ed6732d8ab89284, 0x57559eea5a6cdab1, 0xaf471698637dbdbe, 0xb2609f0492034ae3, 0xd4587b08f9a99924, 0x2a7a899ba6c27a,
+0x7b30241e0f0327d8, 0x50924162a14cc5fe, 0x44f7ad486ad6c182, 0x98e4c2859e344c12, 0x98dd1c9e26cb328f, 0x5e4db952b52f9ecd, 0xf84134aa2ed4b0ce, 0xc8ade26bca15c,
+0xe771f3ee210a17e4, 0x5d8a096f404d72ce, 0xdffb69f5a07009, 0xeee22544c6d76f28, 0x7ad58635f18330fe, 0x99ef398f08ea720d, 0xbfd5d56daccfbf07, 0x3865b328a05f1d,
+0x5e8b5dee4d692341, 0x175f837e1a0fd292, 0x31643a941186fa6a, 0x856d48340139eacc, 0xeffeb7f9d039a2f, 0x7baad3e161895193, 0x89ebef2e68f4963d, 0x10b92b7cbd587,
+0xdc9e6d07fa8da17b, 0x55e24b04afa3eaca, 0x3f73594d3b6fa55e, 0xb038039868b4d598, 0x6be9dc50c4edc19c, 0xfd9d40296d0f0ced, 0x92e70cb9f03ec8a6, 0x32ef8e7315e2ad,
+0xd2ef0bbef92fbcc2, 0xeee318baf5a3358f, 0xd3fc01292eb0f465, 0xb360d6845b9e582f, 0xb9a88770b0598df7, 0xe5c04c6aa98093eb, 0x76b4d1a8d80fc244, 0x1aaa022d8a5d09,
+0x32063fd87251a763, 0xc403e592ad955109, 0xe06337116646b5bd, 0xd1066a807c708769, 0xd639ccead3eab62f, 0xd916ce8a01b06ea1, 0x63cd9c0c4ce7717, 0x377c1d00279bb9,
+0x7a84a52ab593e590, 0x9cae0ff47e0759b9, 0x90c458862e00b158, 0x86b7b31f1fa4b0, 0x982259419e4f747e, 0x65949cb1f5e76d80, 0x846abbc75092fe25, 0x2bb0326962ebd5,
+0xc7d7e625c4b566f7, 0xce3b576c3c32311, 0xfcbdf6d481cff5c2, 0x88b5b25dc361f9ae, 0xa5f1ca258b3f51a7, 0x9cdd82e3544be95d, 0x9f0ca66896faa67c, 0x1259afe6626419,
+0x22ee72d73e12cd39, 0xf71b3f99f1b24052, 0x9faeafbc5a40a7f5, 0xc5d27f95914e732e, 0x68d11ae86522a0e, 0xce03e5b094c83ac3, 0x8e490ebeffe3de8a, 0x3b83a994324d5d,
+0xe6b3c005ce215394, 0xdd6b927449db9635, 0x4f16e9e4acef1b00, 0xb0d2ec85bfe30a90, 0x49653f7010ef307c, 0x5d0fdb1e0b01503e, 0x99c348be049d963e, 0x18a33c3ee4fcc7,
+0xd0fe7a7122dae8ac, 0x6d612d0451887fbc, 0x75aca867c57098cc, 0x1b63db52c13db642, 0xe5dcc4078908ef6e, 0xeacbd537954b5ef1, 0x5f1d2c85557e7057, 0x2a950925a141b1,
+0xd597cfb77f661b2d, 0x42184c2340aba5fd, 0xb24a870a47901963, 0x9e425c1711f17aec, 0xfb62a685e0613aac, 0xa12ff9eebc9d79cb, 0xd8def3fcdf1698fc, 0x33419f333f9251,
+0x44dde33768f7f3b8, 0xe7bb820b5153b3e7, 0x4618edcb5996bcfc, 0x1f8339670da8994a, 0x6b8593c632803ded, 0x498666d4643768f0, 0x107080a9eca5c443, 0x1ecfaad84a0afd,
+0x925912b8efc9d31b, 0xf544dc7f4b1ba484, 0x9153ce3b3a662523, 0x905ce33d47e36bf7, 0x8266550b27abd598, 0x155a0117573fbca8, 0x71f90cbeb5b5c17e, 0x34704ead34fee2,
+0x1c650bac8779ae7c, 0x452279c14fa7efa7, 0x49839063800598d5, 0x3bec54549dfbb701, 0x45fc9754d61ecfe0, 0xef25ad27a71b897b, 0x932cff4753e64f44, 0x1121dbbb31d6ff,
+0xab6c874965c8d03b, 0x6f8bfc88f3b08d59, 0xf49740255cbb5ebf, 0xc5d132b179ef9adb, 0x791b8ffd71ea90ef, 0xffeec6415a9a5a83, 0x9df747ddfe6ec708, 0x1441e27a55a113,
+0x699d781c78184fb0, 0x24f34ca8ac305731, 0x45ed5f9eb6e418c, 0x61c4160e4cfe72ab, 0xf7e6da11ad5cb40d, 0x822d0f4f5fffe677, 0x5a3e2f8d9cb3e8b0, 0x27f425929d2ad5,
+0xeaad1b18329b41df, 0x64b03a319ca63010, 0xad0b77ace066db63, 0xd26f773d42c1688e, 0x6156514e8397a65c, 0x6974b991418bfa1f, 0xd89a3800d82827ed, 0x34ede92ce4e1ab,
+0x91c581bc62df05e3, 0x9e0a5e244bf19ba6, 0xc25ff28177e6a7f5, 0x8ce3dc84d11ece25, 0x4744bf91eda1037e, 0xd27b201e25500eb2, 0x64ef44187a68d0fd, 0x2221ab5dd76af4,
+0xc8a9081d6cb85904, 0x3c99a2cb48b3730e, 0xa6a0aa5d9a012171, 0xd03dc1e36a2db690, 0x45f1638730da3a94, 0x5d34684a43369e5c, 0xd67d94765a942f22, 0x150ab19eb64470,
+0x88fddd6f5559e3b1, 0x2c552390bdfe75ed, 0xddf3de7c3a68aab9, 0x7351146f5c6aa2e9, 0xd9568bcb17db055e, 0x18286777ed7be08b, 0x16c643134b8d272a, 0x266efde80451e7,
+0x29a57f3a9eabfc64, 0x4b2b74b028516ad8, 0xe10d734e18f6d03d, 0x61482fb8992ef4bf, 0xa1f7fed3ea849806, 0x6174720841241800, 0xa5b1fbffe95adb06, 0x108ce57f060d3d,
+0x40bc95e67e316c55, 0xce010f456e42a7af, 0xcd232fa41ac5ec4e, 0x75b880a4f87868b6, 0x58b53700289265f5, 0x6897e1cb7fb66702, 0x67f3e42db30efb69, 0x185892b57fae2a,
+0xe4a3a75c5b0a2410, 0x44e76bbb7aa86a09, 0x50c23cc02f8f70f1, 0xd19788935129c30, 0x172570fbf2f6cd82, 0xbe684f73721758c4, 0x1e7911c9949989df, 0x2a2a8370d3c8a7,
+0xc497987bde0dbc84, 0x8443f01753b9b6ac, 0xeced20f727aca908, 0x10425bc06b839e42, 0x6a1ad98af0413910, 0xc89177e50c90cca9, 0x6e0fb477f2b3b85c, 0x2f7356c9c4819,
+0x4dfdae41b8d2fe1a, 0xd2ba7d444434d33e, 0xa66575a9b574aeb9, 0x647444ec674548b5, 0x43324cc9f5383e75, 0xcad42db011e248c, 0x9f052d3765d2b35a, 0x3388d907e6eb1c,
+0xac112efbc2086436, 0xfe45f19201141937, 0xc282e36c1528559c, 0xc58c4c04904d92a1, 0xae032295e9fb64a5, 0xf0892495a5dcd20e, 0x232dfe3c5d810c97, 0x10c8d297802dff,
+0x6f80a4ba1c513e1, 0xccc66cd69939d8c9, 0xf9940022ed4a23ee, 0xe59bad83ee4ff727, 0xd6227806e364f72d, 0xe2bc601b30bc0d3d, 0xf8674f4111ff04ec, 0x115d1468d04e44,
+0x81fa903f3cbbb751, 0x7aa3f0175624ec50, 0x75fefd9034582776, 0x2db3c5299b6be260, 0x237240574cc39dbd, 0x1b84d3612317b906, 0xe5b1ab4df50dfcf8, 0x9cab11e74f034,
+0x879c9bdb41308eac, 0x8bfc6ebd9d912e2a, 0x771170e799b74ecb, 0x48d4b43be7822931, 0x4b01fb2e5d799485, 0xe28fba3ec1d128ff, 0xb7f553faa3cf59cd, 0x399683ed82b327,
+0xd20dedf70c5a7df5, 0xf39d291b95f2e5c7, 0xf98959b22263f5d4, 0x4e5711e0104edba6, 0xc0cd6fa618882f55, 0x4c53a33a80e647e6, 0x2f9672b1f9610e7a, 0x170081181ee0e1,
+0x498445e0494e7983, 0x2b5cff8da2977cdd, 0x497ffba7f436df36, 0xc99767f28eee7351, 0x54e048cbf729c479, 0xd692cc657b19e833, 0x9d296dd62cb3b298, 0x3c275236367205,
+0x608588fd1e581b34, 0x87f5535bc8386a4c, 0xd4d5b3b730bf05c1, 0x8971b31f57581e65, 0x7fbbbf23c8e0e11d, 0x697f3366892dff3, 0x3ff443235d6466e7, 0x3da8970311688c,
+0x5ef30f918048fdb0, 0xf9224e121a87b0f, 0xa470a3ed6be0412d, 0x7b1c0277f702ffdb, 0xf3c942ee2060a929, 0x8374d5cdcf170c3a, 0xd14d87de59629d6d, 0x1544cb807cffd9,
+0x932c1108fca8a61c, 0x6275c01a914c474f, 0x155eb89b3b6c377a, 0xd373d012f31a554c, 0xb9d4cfdfa3237f1c, 0x620d6fb8251955b5, 0x59d8a4b090c9158, 0x260ecec6075074,
+0x9a046e4d46c34b25, 0xa48d1be5232fed79, 0x5d20d492e754a9a8, 0xc379ebebdaaa10b, 0xaca206ffc85e6398, 0xa7f9d3f830dc917f, 0xb0bc0b788ef0abe2, 0x3c11d63f5a81fe,
+0x83b6f35bba66330c, 0x56d918bacf452f10, 0x20e9e7b64150c326, 0x3ec97fa9ff9ab58b, 0xe1208397301c9410, 0xbdb3398bff04a5fa, 0xd576931a1d0f52f1, 0x34c47356aa0f47,
+0xac42bdbc9d21e3b1, 0x57d925244efc8c18, 0x4446398b8796a921, 0xc009d5dea8264675, 0x4b7a8a855c49e4ed, 0x75f65551ae654504, 0xc168045dec52d458, 0x384fac59a06584,
+0x7fdc09aa964d1fba, 0x6e87414f2fb260dd, 0xbc306c4f6f023291, 0xe079bb696473121e, 0x374a4c5348c61862, 0x2f8ecb9db9c69a0b, 0xb8310d5b43c3541c, 0x19a835f9d2634d,
+0xa05ec6e3ce587217, 0x910ae0ff0d3f4354, 0x16d74364c4e5fca5, 0xb39e17bd18d1b264, 0x4a8d31578a930130, 0x4a421c2ff443c1b7, 0x74850ff1eac03a62, 0x3bdfd6a4642f91,
+0x80481233c54daa60, 0x3d961eafa14ac365, 0x2d194a1b1fb0dac8, 0x2e899a183c3aa898, 0x876353d7d4901c82, 0x5cb4cb282a8f5dec, 0x90010f12f4acf54b, 0x24b43efcffcf74,
+0x5607ad1e329acae8, 0xed299bdcd56aab72, 0x8bbc97f350758561, 0x6c852068a2766e87, 0x59076ba4c52147fe, 0xa731a60764100129, 0x34db70908d7e1270, 0x1c2acfdb654372,
+0x2abd4b56191296d0, 0x1aa77852d2924eee, 0x5e3e1f2de6343277, 0x5eb588bd86ed3fb7, 0x9e3c3b3e30197f16, 0x19a225f051b8eb72, 0xbf3eeb2f2cfccd71, 0x33794ea6badde,
+0xa826ec5bc676b1d3, 0x4ba28952ad7516e5, 0x6a5427f6a38e00cf, 0xfc0feab0bcce3e3b, 0xfb5d4e689f12f1a5, 0x8711f7b215ddb4af, 0xa9f013ae3938b5c7, 0xb31f2a08ac894,
+0xd871ea5fd770088e, 0x778c1679a389bf88, 0xfef9d0e5faa2ab89, 0x665c9d08aaac45f1, 0x5f1b8588177bc298, 0x73d8433323dac097, 0xcd74f46134a368f6, 0x1d8cca7151356b,
+0x63ec7d437e201105, 0x53208de521666d60, 0xc997da7a372c92c1, 0x9de927765936cb28, 0x8baec97a756f5a3a, 0x2ba19851a64feba6, 0x8cddbf9f75fdb758, 0x25d8eebb076786,
+0x92852e522e3c320e, 0xf15fdbc466449454, 0xd686d23e7a4207e6, 0x850a7dc61cb30487, 0xb480647bac4d8e12, 0xc170a26714e3cf3f, 0xcfeb7fc9aa8f540e, 0x2dee53802bfe2e,
+0x3463333b284e5b80, 0x38e2fae58badeec3, 0x10235b748c2e1358, 0x993458f4c0dbbcd0, 0xfc18c0f5326de16f, 0x2bf1665b586f17b0, 0xf7df8ad865803455, 0xde56fff68efdb,
+0x569b43818b258e55, 0x203b2b7494d63ecd, 0x15cde4c4a47f2ba3, 0xe68014deb328db35, 0xfd3417183ac61319, 0xe169cd80327a6ca4, 0xfa6d0213aad3fc7b, 0x3c3c3668f8be6c,
+0x489ed6a4b557d7d2, 0x8a6db2b651950c0, 0x524a68843a6054ea, 0x3e7d0f0bb7b6b384, 0xc9a1b0876e24baeb, 0xfea719baf68e23bb, 0x9379e13f4e9c7fdb, 0x2227d90d17b517,
+0x609737113b95f8e6, 0xb1c72b4eedf9f7fd, 0xa4249b01f2ef4068, 0x614d55f4372cee3c, 0x82c2387851fcefa1, 0xac4e85c72b33eed0, 0x8add5db82be61c7f, 0x2c8bf1da40c34f,
+0x56b25eeb964b9380, 0xa8dbe460ae5628c6, 0x8c71dd5803e53d1e, 0xd13092ca54d6c4ed, 0x4c855c0f487fd007, 0x6a4e6fb87a5344e0, 0xde763948631986b1, 0xffcd5d47f3d67,
+0x662e8309095f5d63, 0x21f4ac3ed86f1f23, 0x193581663dde4f1d, 0xc1d7a2b7af693471, 0xd88a7029948e330d, 0x1eff8809e37c62a5, 0xfa834c77e7dffdd2, 0xbd7cd5eced48a,
+0x5fe2f581e2e91b4c, 0xfaac50f92247b36a, 0xf9bd463b2a25b31e, 0xd0f7743d32e7ca63, 0x183a6af353308756, 0xd92243955948e57f, 0x8a6cff1f7e463733, 0x130f89f71c9007,
+0xe77a054f82d452a5, 0x1dda04ef993cdab6, 0x94ea297e4d036666, 0xa90cd4e75e651088, 0x7c55150aeec5c88b, 0xfc6d0d27a196a1e, 0x75746e2bc110fbfc, 0xc6a7f3df368bc,
+0x8e6992229dc2631, 0x9b0483cc6bd02f8f, 0xf5611ace833b3f2d, 0x125130985eb0ac5c, 0x20b4848a232e136a, 0xa370940a87e7ddc, 0x2bb7c7b94d95d6cf, 0xfaa23139e4b2d,
+0xfde15a5ce2612744, 0x9074c5e76ba5ab17, 0x54e4c9a46f6e9b32, 0xb493ed7df25f8f7a, 0x7c70b452f3ede2d, 0xb705e815c01ee931, 0x57c4a576c4d15baf, 0x12c876633f6965,
+0xf657cae9ea86328a, 0x6f39ab8d3c5ac3f9, 0x442691fb392f976b, 0x8925ff4abcca90c7, 0x5b746bcbb462528a, 0x4e8b0e14baeb153a, 0x5fd1cac1f49a9b56, 0x3414fe1da5e7fe,
+0xaa482d0247ed2cea, 0xc3c6d2ee1b222a3c, 0x5e330018d254b198, 0x2d726f2eb3c867c0, 0xc23af793cf452c8f, 0x48b17ad2f6f545f3, 0xfe6468a2aa01e209, 0x2ebdcbca8df1e,
+0x2bbe1331701146bf, 0x8db5fa5d956b1f0b, 0x64bcef7c790dda2, 0x15549515cec27841, 0x5172279106bbf349, 0xd9c23b656062e4d9, 0x23ca4f883092476e, 0x367b4fcf16e3e7,
+0x4eb0290ae00185b0, 0xa8e51da678cc56d5, 0x8593517d7d43b82a, 0xea05f1bd601c6296, 0xb258ed809e218b0f, 0x80efc043528fe19d, 0xce2bafcbfb4309a0, 0x324b9f7507a7be,
+0x1fe04a9d46aa8575, 0xa0d2455715e697c2, 0x603b28d8ad3f201c, 0xd4adbee973d804c8, 0xb156860e0f9817ec, 0x5f61d5c376c613cd, 0xb4f40e88e234ef18, 0x36b8342819f972,
+0xa4508861835df935, 0x552697782be5a3f7, 0x851fc36a8da7078, 0xeeccc325e60ab4a1, 0x47c46d444063131d, 0x12471e3e0dbd3378, 0x31a779f8d34aea83, 0x9c19772d745a5,
+0x5adfd154ba39e5b4, 0x59215b51177068c3, 0xa1ea807e2e2d8703, 0x7829b8262022078f, 0xc46c0f946e6e3410, 0xdf94f92daf14f4f9, 0x26adbf4f05b0be6d, 0x16678fe85e40dd,
+0xd4e9b474aa9d1e1, 0x4c3b7a33e4e5c2a4, 0xb36aca624ca8f47e, 0xc345cf5235cc6829, 0x4c9e5fde3ec58c58, 0xd6915142fd2aca84, 0x4fdb8204022e5163, 0xb028d62d160e8,
+0x9c203bc10774bb61, 0xa28b0733ca0466a6, 0x3ec7f6cbb79c6b22, 0xd51b14cf4310657f, 0xde3cfdbcf3adaccd, 0x566fa20207bfa702, 0x4a4b8425177580aa, 0x29a5130bcfd9f6,
+0x7e0315875f161b89, 0xbb06403fbe99a12d, 0x14361d8f0a7f21f6, 0x1326d4f15099e5b8, 0x82d08357f960f8d2, 0xc99ab3507c6e05ec, 0xb750b958ff9a3e9f, 0xd670cfd1c2929,
+0x442019d1b4528125, 0x89428ccea64f3913, 0x6ec5e96167877e47, 0x802d103c95e5d37b, 0x1609b9e928ba3b68, 0x1d33bb2393d8afb1, 0x6a5c653e5eb746b1, 0x106ae551649481,
+0xc2f60b393e27501b, 0x4fb5dab6d1d17c01, 0xfe6b3c9ea3846f12, 0xb80f69de9ec60721, 0xbca0df6a7d7c9f4e, 0xf845e76ac0fbb7bf, 0xec0e3ebd50290880, 0x14b245a57fa895,
+0x3928cad001662e24, 0xf93a8dee1b32f90a, 0x116ceafc13fe08d9, 0xe6d844f8fb6f5eed, 0x2c268a72a090ae54, 0xc0c12e6b559c9aef, 0x905cfaa8e061339f, 0x21349df7c8a621,
+0x35228fa6a1bca134, 0x469648505a14bcd7, 0xf38c9076bae9c35f, 0x92eb1eb4a95f9262, 0x2d6e2102e38718d8, 0x7a8b03b1f3cc18dd, 0x77a57996367a8168, 0x11285b6bdda47b,
+0x928a5eb48ee0b8, 0x949127affd8c23f1, 0x9266458d77f89de9, 0xbfdb3a35f56fe652, 0xe8afc6d53d489e7f, 0xdd488b0485abebea, 0x6ec1a02c8537ba83, 0x34c692bf43ea66,
+0xfec110ddc1569a12, 0x4f7f000e2bce4daa, 0xb50bc96e48eec9e7, 0x9ca90d04125f43a, 0x20aec6957e8e0b39, 0x58f2696626900efd, 0x9121931762e07205, 0x1f15a1b711bb22,
+0x27d8e311f5cb052d, 0x6727c75fa36b3742, 0x11e7b8dd06c058ad, 0x81ac7059a987731f, 0x3552da16934b049e, 0xb90df865f4ee483f, 0xc6909e8dcf143a00, 0x3355393c1ba084,
+0x98dd72a6e4052324, 0x8518d4d03b9361e8, 0x49e6944d706de03a, 0xac36129b49f8815f, 0xbdc2e0c5a6d61398, 0xc3bf52e9658f812e, 0xc3d875d20d6e92ad, 0x2b3d12fc1f43f1,
+0x2c5317436aa3ae4f, 0xc7e1e7adb96d8ad1, 0xa5b7341be4dd48cf, 0x872a031873808b9f, 0xdfc3b9750e49af2c, 0x4722056ddc198df4, 0x9aeeaa6b524ef83d, 0x20f28437b5a5d8,
+0xf8ebfff0e15753df, 0xe8dc60250a67a915, 0xa218a949cce764e2, 0x255586ac44ce22ab, 0xe6d488814b17d487, 0x8391f7b7bf5bf6c3, 0x46e4e8c7589d6bf1, 0x3aee6d70b30b7e,
+0x42af804cb4d54455, 0xf1397a04f21ced01, 0x1f80e3b6925a087d, 0x554aa403aea7b258, 0xc7bf5d568e733e66, 0xa90a5036a14d9540, 0x285c3e5adcb6c88a, 0x12e31d12139bde,
+0x7db1a9f85e41465b, 0x138b20987354768b, 0x484b18ab5e6521a2, 0x905893ea39702a4e, 0x8c04f4fca1db1276, 0x7499204b5e89d184, 0xa9cc95737f60ca70, 0x3fd254e65c24a5,
+0xe2c322beefb4c4da, 0xe922f2ddef87b6d2, 0x1cff76c98cbd30bb, 0x1eb588582099a005, 0x40cd46f6377da9f8, 0xcc276106247691f8, 0x3c65585141be4f67, 0x3c4380f7f738c8,
+0xf74dca8b91f49b22, 0x15775c3d499baa32, 0xcb2de0a3db02ac38, 0xbc556a0d8592e137, 0x7d47e9f392dbff40, 0xbc73bdc8b5dfddd1, 0xc53ccc39e49fb239, 0x236d0b9e1c208c,
+0xe50d2b0a2e07c59c, 0xf27635d096679cba, 0xf07e2e9c742809a8, 0x2fe8fe8cbeddf59f, 0x2980fd3cea081a19, 0xfdf0570ac9e04fdb, 0x2d74336e81b38c47, 0xed83e79e2af74,
+0xb9133dc33ec686b4, 0x312bce45f05acd43, 0x8db96334f420d8a7, 0x1745589d4f82e68e, 0x573ceaf69aa0d984, 0xebab1285d401bd50, 0xa31a4fed80aec2d6, 0x29b9948f139f16,
+0x548c909622f78a5d, 0x2e6cfd0b724c9283, 0x507176a9e02f96cc, 0xc4d32e9051dcef62, 0x9df78947dbae5e91, 0x38fe278459616fbf, 0x5dab2706d331c811, 0x28be0f5cedd742,
+0x75dd7781e91bb6e6, 0xa97cf1a08130eee1, 0xb8ba396276a0b742, 0x4ce7585bb07fcb54, 0x3440d281e20e528b, 0xe6f81322e9e200a5, 0xb1885c585f6b68ae, 0xad55f1ba1285e,
+0xa05fd8d9ceb0de13, 0x3086ef68d4c6682f, 0x6e82533c19659e8f, 0x7cb06d914c3964b, 0x8e725c2b526f9b89, 0x2b593cb255d5eff5, 0x76a463de2a1e58dd, 0x17f27557128c48,
+0x1d18061bce2430df, 0x103ef37e0d360079, 0x6d05f871a131c2aa, 0x6ac2d56b1fcfa76f, 0xb2f69b119c82873f, 0x673c42d7ba0e0d0a, 0xc11b2c891b318215, 0x3dde7eaa1c7aa1,
+0x507d8458ad4aa50d, 0x775ba4eb9f27d402, 0x3ca8e9a0ca60fbb2, 0xc3aa02c16b81b780, 0xba6d9f49c9e1985e, 0xb02a302e4b643000, 0x35c4aaff3fd53043, 0x2f6df179b397e,
+0xcb8ea1855c2741c5, 0xd51ecbe06e7e5e13, 0xa3f0a8ee22ffd234, 0x23234ed7085494, 0x144ae10a9408f953, 0xa003e6214e8d5585, 0x32b4b45fc60b6853, 0x20f21e51e9be4f,
+0xa31fb4e309d2a6a3, 0x7c2ac89f18e33436, 0xf98bb8d0827c4d3e, 0x8bf66ced5342922e, 0x602ee7fe0b548818, 0x86b91b605161ff89, 0x5e8b3e9fb6cb26ea, 0x358bd24ba88fad,
+0xb05dea8af8e606b1, 0x5afe7eeb1c1df4b2, 0xf1b834440c9da7f7, 0x95142164784b6650, 0xc224fa9fbe58e4f4, 0x2ebb4543b36297ce, 0x3c41e5e984b1713f, 0x3c3f4775456c43,
+0x728a2fcbb6331f5c, 0x9422c8eb601250cf, 0xbd9be3aae7c62b64, 0xd4467a63621212f2, 0x9a8a186e93ca73b2, 0xe312ab1cc36073fc, 0x9adf1679f1484ffe, 0x2f039d2fa7a899,
+0x4c5ce5970c4a1ca5, 0xb6142c0485db264c, 0x9ab86e53a54a59c0, 0xb680735bc3b3b104, 0x784fddb03345888b, 0xb96ab2a4b8929a5b, 0x979c0bd02364c5a0, 0xbb2040d3ead8e,
+0xcaceb586c46cd98c, 0x29b5a8ef5281c39f, 0x47d5c8b69c1f4932, 0xb5b0e468445952b9, 0x4e5ef782cc4e2f51, 0x71294aa59be20304, 0x69acb39f6e77fdde, 0xaaccb7aa6be1f,
+0xf7fbce9f84c05cd2, 0x466926fe2062080, 0x8a5d8b78af92ec07, 0x80798c68540687dd, 0x9e0e56ac589980f3, 0x94ba8c632421ebbf, 0x976e4670438d1319, 0x26f49a2020de21,
+0xc306135fa4fb7ca5, 0x78a4ffb69b3a911c, 0xf1d7e251eeca919, 0xed13747480b96c7d, 0xc687360ecc052f31, 0x9b72d4c60f151a61, 0xe5209f49f0124c1f, 0x1b9ad97bcc5018,
+0x5e14dda6d3b4eec3, 0xf961de35931918ce, 0x4cb53ae0af2b2ec5, 0x95596d9f9d604022, 0x3d3dfaad166ab196, 0x9d657cbff7bd6c88, 0xaf12e640570704b5, 0x2f7af1a8acaf18,
+0xc2c7e20a34e73e96, 0xd057ae34426fae8d, 0xf855ced4e8b77f02, 0xb97f9ea89edda6a3, 0x6ecc8036a9b04281, 0x82e2fd5b2d2ff926, 0x7211bb91c666b9ed, 0x162089f3220469,
+0x8cc505374a3e5cc7, 0x3da1705fc93b4f9e, 0x177748c7b5bee8d9, 0xb90c27dedbbb2417, 0xcf22ab961bba75ab, 0x7ff83a308223594e, 0x1035dfe6735b616e, 0x26d3e47915c1cb,
+0x7f0453df0820abe9, 0x85101cfd07754420, 0x67d7ff9742bda4a1, 0x65357dde3dd2744d, 0x21939323ca83eea2, 0xc082b17a801e4291, 0x19d614c8f2785cd9, 0x1103006ae21997,
+0x5af19bd0b700391c, 0x4a614a3f7121cde9, 0x9e28a299357a111, 0x542d450f2850d9e4, 0x2991d2bb4e78f501, 0xdef41db95c83a08d, 0xa9d80b8e0291b002, 0x39ab497ee03323,
+0x8820d719767c8429, 0x6988215c9c1aa858, 0x57111e3dd586a379, 0xfe0284c0f5f478f, 0x307fb8f850db3ed8, 0x9b330443cff77090, 0xa0e11aef1568939c, 0x3da0c829ce3741,
+0xaecde2a788e1d913, 0x26418a4d84b058a2, 0x740a82c81ce3b5cd, 0xc8a11c7696ca91f6, 0xa848f577d8d71544, 0x6739f93194f1da35, 0x27a0996c47a3ce4d, 0x11d43801743aaa,
+0x2ae5d4f5b1c9b9f9, 0x1c63a11f51220f5f, 0xc2c4164b618abb6f, 0xe7f13309031d4fce, 0xb9636a0b8f7d55f2, 0x175b706475a3cfb3, 0xe1a21ecbc9892f61, 0x3df0e548039fdc,
+0x3a984fc7ff5adc5f, 0x661a421e9317fe48, 0x65502cd7cc751059, 0x7108efff5d553927, 0x9a0f96c8cad61a31, 0x573de382c4462e0f, 0x73f42820492050a6, 0x12f37a983db57b,
+0x7b38132c51caf123, 0x4a7fb08616aba90b, 0x62f9c8f945a6f494, 0x5c5763fbd09f26d, 0xd8ef94c853ad78c, 0x14c827894c7d11f0, 0xe51855e05af273b1, 0xba63588ca682a,
+0x6d44f8c8ca8b1fde, 0x1d4494fe3d827e87, 0xe5c1cbdbd9a94076, 0xce27f702d32b4867, 0x76a4acb7b9fe4bb1, 0xc81cdf8ab5997005, 0xe4be77e7990d5289, 0x391d296bf8b004,
+0xc846b6aab27aee03, 0xba802dc65cdcda6e, 0x24efe931f8f735e1, 0xabbbbbd5d4b95d65, 0x8527c27d9b4738c9, 0xebe7e5b98b2e89a9, 0x6ca2f8769c40caff, 0xcdd56eb9cecc0,
+0x7aed2656c83fc67c, 0xe301cfbbaf3407c7, 0x7e566cd6f6b28103, 0xf3860cbc75b9ed64, 0xdf0ef9f1e9cba73, 0x9818d49ef9e31250, 0x66d8ec09256b325b, 0x2650560c735213,
+0x6a16eb484ddc2064, 0xfd015449f09681de, 0xa40667f04e8ed2ae, 0x2d98832fc9c026a1, 0x24db8ef3c657497b, 0x581ddc35253c5430, 0xc9731a967cf07c71, 0xec2902f1bc511,
+0x812c1c7941e5edb5, 0x9f199105721f9a19, 0x67521f9ade132d3a, 0x1022d52bd6db1ea, 0x690edbfcae13229b, 0x82b9edfbcd2b76ca, 0x62ff7d0e5c9e206d, 0x5a16d45bd6b89,
+0x7abe3751ca1e4acb, 0x361fd3f2e7f1c839, 0xff6088c9bb4d550e, 0x3a88f4fae7a9ec65, 0x99fe120efe143d3d, 0x2b0707693427d5c4, 0x7c5a2c7e88d1fe31, 0x10d2a07bd7af1a,
+0x400d486bcc9bd073, 0x9e74bdfddce2737a, 0x2cb46b1f79fda961, 0x456eac6482339cd4, 0x1df08685ac67599f, 0xff71acaa28115b3, 0x3c9bac7b6ddc5c99, 0x3c156de3f38611,
+0x9f95d1009e350b47, 0x5a6d6ad5881edde2, 0x170bd0095a99a4c9, 0x395b6cf1afb58400, 0x91c9515acd81381b, 0xc49d2c96856cd4f2, 0x436b0e4c1f9a437c, 0x2140308687b235,
+0xd031c46e7506eb91, 0x214fcd010ac0332c, 0xcf19c33fb46c6678, 0x16c1b584c2b0235e, 0x3096d9854e6628e1, 0x85d70cd4f685e050, 0xaddfe96d62507833, 0x2152a3670271dd,
+0x3458b041fe731ce4, 0x7f86ecdda57981fa, 0x439defd2711c106a, 0xdaafbeb3065ee1bc, 0xf5812d884ef0b272, 0x823f44283f5feca6, 0x9dc7c9e6760cba54, 0x3c6ffa0d8de39f,
+0xee0d8d23b17f7bfd, 0xe71b52fe2ab56db2, 0x3bddbc53be28ec6e, 0xacd8cbca5165894f, 0xb894d2e531edbea8, 0x4e93144a13c37738, 0xf69787934f37fd4d, 0x2402815fbe4c6d,
+0x77d1b40e29f65729, 0xa7a1d760f8884d7, 0x207de24163b2a966, 0x302555532e13188b, 0x3bb65c0b8a7ceca4, 0xcf2065554764ab06, 0x854b215241a97cb9, 0x3fe218fb615e64,
+0xa0b906658700e56b, 0x1922b87db25bba2e, 0x12c89a2d6c0c548b, 0x4e1df6eae0c7ef20, 0xc0ebd6ca26d7d648, 0x380bbdabd7261cb9, 0x51b816beff363bc6, 0x328f6bd7a715d4,
+0x783ffb8b8d484f08, 0xffb94b51d4114c30, 0x65c5f340f7b983d1, 0xa88154b89f1d7ede, 0x5d04525fda03e29a, 0x2a62c1822ab18628, 0x4630b1cd5ee7ed55, 0x1f014d238ed44f,
+0x1093ce88a3f3a305, 0xc5662f5f40d5005b, 0xa07643a9284e0a4b, 0xada05b74dc28a7c, 0xfde8df675cf9d744, 0x45f6b1f5d7964d88, 0x3a667f0cf86df640, 0x2532569b4b20ef,
+0x51139121722c1866, 0x2c91218e896ec623, 0xc96d46f3212b6ed5, 0x2003af3273c674ff, 0x3137d25b58d491f2, 0x9c3ff74c040dbfa8, 0xfa310564c9f86072, 0x1195a6e05feb77,
+0xaedde34e1fc0be3a, 0x345d8fac3845245b, 0xe1c570044b70800b, 0x24893d5ed538278d, 0x8ed059867109e59, 0x6dc98dc67387c7c7, 0xa7b67f6b894317a7, 0x11740a276cc67f,
+0x8589ad7e63f6699a, 0xc48bf9a851b298a3, 0x6133d1c624aae5ef, 0xd8fd34c4b1467fc8, 0x43cdb7f81fe9774d, 0x9327776af3914a12, 0x24b279eee832d1f4, 0x3f269a7d0891f8,
+0x28473d5a86f490d7, 0xa4578a17bf61d96d, 0x1f745e25d1e8e32a, 0x9cb5f4c7b3871f2b, 0xb4892c10470e59de, 0xf99ddb63db83902e, 0xef78d9501a81071f, 0x187bfcb18fbdc3,
+0xa0c27949f4b49cf6, 0xf8bb40838349e27f, 0xc9b21f43725d2472, 0x5d27eca969e7cb20, 0x8c3d01fab2557c41, 0x46230f44022ad8e6, 0x9be9eb982a5f0f3b, 0x30c408f98873be,
+0x7816ffe0a48ce435, 0xe138868be58a3bf6, 0x88060a6a308e575f, 0xa7f6d80ff34c6bf3, 0xcecbf106d8f3a96, 0xc2b8cab8468de84a, 0xf3d25e381c8701bd, 0x185077a38ade01,
+0x2e7d78d67f852af5, 0xcb6ad14818b2b467, 0x951ee5546c4b758c, 0xf47ee3d90a8996d6, 0x979eba8e62f96d03, 0x269b71d071d9baf0, 0x9433a5bea6bb5eca, 0x2cd868257d6fcc,
+0x6ab535b391d43c36, 0x4447799496f1b79d, 0x39f7618b4f26e845, 0xef1d337c1051b42d, 0x2f01bc2dd1089d6, 0xa4e0775e02aa94c0, 0x9c47b8dd5722d3c6, 0x111b837ee327e5,
+0xd2019e60e0acff9e, 0x922f66666f02b99f, 0xe53a4e40ee7c881d, 0x47473a839ece2187, 0x78dd305a1e71d483, 0xd1badfd3321ad359, 0xafd8d5ade6241414, 0x6a8678d141a15,
+0x85cbdbd0495fca1b, 0xba87dbd7c19c548a, 0xe102f139d1ffe751, 0x442c23ba3a90a98b, 0xba88ab71a8cd3f28, 0x45ce400e9d7cfdca, 0xe1afdb3d359f2d65, 0x2d15ac258c77c1,
+0x1c05e720ba4f7442, 0xff1512d0d7245bdd, 0x486f0bbc5eb816fe, 0xbbded1e1c7252e5f, 0xdeaa2f2fd2731e70, 0xf1c2943cbfe2601a, 0xca9a7ec7ef13bf25, 0x3cd079e5b79ca3,
+0xd593531f04b02cf3, 0xda4cf216c11cf67f, 0x9677d1cbbc7601be, 0xf8675d393278c582, 0xa98b37c05782b959, 0xacbc622ed0d0be60, 0x645399075903c8f4, 0x1bfa938805ff37,
+0x2315fe084482dff1, 0x5480cd17f6b93266, 0x81633221858bdd7d, 0xa5e982f68f509c1b, 0x678e99975aae4ccc, 0x3d7b95efaf11ddd, 0xcc476f8f1e6f401b, 0xd554a52bfa1ac,
+0x432ebb975078fea8, 0xb6fb3930dbf3f056, 0x52da43d5b3970d3a, 0x3bd7560e8e00005d, 0x4303e2255b182e69, 0x8079bbbf0d3142c9, 0x857952793ba8ae3d, 0x484b6d28072a0,
+0xb356b4d9498e05ae, 0x67e1474ff6526fe5, 0xc17e416e7ef2649e, 0xf57a71679c12f12c, 0xa936efda102d8166, 0xe9e18c8cee9aabe7, 0xc2737f7e18d38ee1, 0x3124c7f1037c16,
+0xd1dbf0ae3335936f, 0x26149f68927ee041, 0x55251fe67dc9e038, 0x9d7a5faa2f33f52, 0x487277b702c873b9, 0xc1c408ff7e018206, 0x1c9edc2516efa38d, 0x3375e1247a99b7,
+0x7e1f3c3f1dcbf91f, 0x48bdc723a2a14ad3, 0xcecab1a9bf9d3ce2, 0xe759505980653f29, 0x65824cd4e99877bb, 0xb493f2a55b87ee08, 0xe0a3ccd2324db236, 0x201326ebc18210,
+0x61da9a61ae6760, 0x6bd450d43c95cad2, 0x35b41dc63e8e3c5e, 0x821f4c52c86306e6, 0xbee45ceb0c9a7279, 0x133d6c4b29f35d78, 0x1cb2de9fdf5e9a39, 0xe490c786a4d1b,
+0x2bbd625d24c611d6, 0xed0620932a2a0bc, 0x7ecb7d96b39b9986, 0x2ed8d0f28fba3af7, 0xc1ecc600c2012dc7, 0x3db9909129d9dbb5, 0x438d64ae687a04a2, 0x35901c51153f51,
+0x9be912346c9109, 0x41576881c630d149, 0x6d056d1d168d0539, 0xc1a331f6587a9bb5, 0xed51ad5a39b63dfc, 0x2ac22e474266c012, 0x1ac9f7488cffe8ce, 0x2db2e6976192c0,
+0xdf032a8281b1bd70, 0x1921e40c5ecfd6a4, 0x87a3a54001dcb8df, 0x370a786d9014860d, 0x3121da7d4708a72f, 0x2812f59aeff5e50a, 0x5d1b410fd1193e88, 0x30a5015e19300d,
+0x784978956ac92b4f, 0x6b3804ca9abe4444, 0x94f03aa2d8b71162, 0xeff1dce894e0ce1c, 0x17b28c1840cbf342, 0x6e3b88ecc4eae8d4, 0x3be17007db9b59b4, 0x26d1a6016c995a,
+0xdd3c4961a6ce2ca5, 0x1e79ac56c9092b03, 0x95ad062ec3e76e08, 0xd6c49558adcbc706, 0xa32dd488d071fca, 0xa553ac5fd4c47660, 0x183ca757446acf9b, 0x56feecde96dd0,
+0xde22c69fb2bd02cc, 0xf8669533e3c3f487, 0xd11a45e465114e30, 0x7adab3823ea505bf, 0x477849058cce4ecb, 0xf4cc2d2314fee3d7, 0x96a0a5fd7e2f7cb5, 0x1fde13c1098a0f,
+0x6527e1b130472bf6, 0x46f66abec76506f9, 0x49078e8ff2d33748, 0xce4ec51119d47d8d, 0x4aba5c714e296359, 0x24f424ee32c586a9, 0x9bee9bf6c22af6f0, 0x3bb0898ee6829a,
+0xa06b885b27e893d3, 0xcecbc933262d324d, 0x5559ca8e02b328bb, 0xb5a1c09f458352e4, 0x55d95f6cab5439bc, 0x62a59a5cbac1a924, 0xd73b68d5b128b97a, 0x1fd6e9c27b5413,
+0x970f04b169397933, 0xd717c689c2e9addb, 0x2862d2e0d3b5704, 0xdc5e7ee29042647b, 0x79c5410967d5d068, 0xad405f50b6e63f99, 0xf7194e9863a54c13, 0xa2b3ed899a273,
+0xd815ed259cc63930, 0x49c37560cd9cfb06, 0x6f5eb5a7bf85bf27, 0x4707dcdaa2c60ea0, 0x675dbe94ca8d8340, 0xc0646b5ee6ce1424, 0xd5940e27fae2ee9, 0x32151d6faee39a,
+0xc29a303039834f9a, 0x51e3d42515b7034e, 0x4850441990202ac5, 0x8be1f584125885e1, 0xb4e9f268cdeecfb1, 0x96003d883925345e, 0x86108d343592088, 0x3072734143e5c8,
+0x9f41483b04014ca3, 0x3cf5a4fe302138f, 0xc0b7c637280c8db3, 0xd73f86983ebcf403, 0xe40f3fb3b6d64b17, 0xb8f7970add368e48, 0x2c21701009bcceeb, 0xdc987c8c4fae9,
+0x50ef383c69134c90, 0x3a243ede66ebfc2, 0x2206beaa578bca47, 0x474014b4a2477520, 0xc7becd102492c919, 0xfd0cac38bc71cbb4, 0x75cde358c99f115d, 0x37cb4cd3549c8b,
+0x420d4a2b35be047a, 0xdca2bc3631f72c0e, 0x8bcae8335fd35bc3, 0x93ca880d299c321a, 0xf76d17ce871aa10c, 0xb50a2479fc384c35, 0x9013064e99804e06, 0x397d45ea12c317,
+0x2f81cb86bb29604d, 0x666c4f331b9a5135, 0x530b794c89019731, 0x925c7c38a37b0d59, 0x7c9534317c25108e, 0xc1b2d60db9fe9122, 0x6f098b0ea3de26c6, 0xf078268bae002,
+0xd5c0289bb27cf563, 0x25036c1e079c5a2b, 0x3a04773c98778ed6, 0xc24b55a320bc42ec, 0x69f65bca0002dd9, 0x43610da690c3fcdb, 0xce4e9e90592322f6, 0x21475a6a9f8b70,
+0x4c0a57ecb1ab0527, 0xc3b214fc4230b8b9, 0xee0d6e8d6c07f9b1, 0x3cc878ded2220c82, 0x62c167aff0a5ff58, 0x20607ebc3dcd2291, 0xdcdab1e971b7470, 0x12b2fa121ca6d1,
+0x2e3a196baf0d1345, 0x30d36552ffbee27, 0x875a46f23f727415, 0x4c88c2c987058c3e, 0xe84c609baa4ffb7, 0x3f5d81fb87c071, 0x8e9d513fbf8921be, 0x36ffe8fe6236db,
+0x25e6ef3ff1e43acb, 0x5d6acb1918f1b636, 0x629a4df7532311aa, 0xfc390002213365f7, 0x3e642939b2ed75eb, 0xf2ca21a4fc100ded, 0xa5780bddde3d21bb, 0x3ac79fb0ef3993,
+0xd2b3a4a90577882, 0x6bcdcfe594defd3b, 0x833a07cb6eb18863, 0x5420460c3ae2c0fe, 0xc3212c26a8112fce, 0x4196d9c830ad4167, 0x5ae0f3252fb47372, 0x3c8e81f7249459,
+0x8b4ccf904b812426, 0xd07f1a9ffbdaf84, 0x27c729ee9f5ca650, 0x1e12270d3fce3cc7, 0x8e1615d3c57195a7, 0xec94a7e9e0ee97bd, 0x233e280df42c35eb, 0x444f71b64473a,
+0x3ff7f453e7ffaf9c, 0xf7ac9de37416ad31, 0x6d053601f3494851, 0xb65271a79a9d24ee, 0x246fdac80ee53993, 0xd03da27afd4290a5, 0x484fc01084a0feb3, 0x6652172a29796,
+0x817c597abe748873, 0x45efc7c0d1b6ad44, 0x240ff72266bbb877, 0x706f7661e056b19a, 0x968965603ec250ea, 0x40b4d537e978a3b7, 0xc6f332b878cedf1, 0x16f8eb2ebf429c,
+0xa7c12b4a831da46c, 0xc90c8be0c2120d28, 0xe56dd205029d10f6, 0x24d6b4fc4d000ca7, 0xdfd9e3e8354f35c8, 0x47e2ced279a37de2, 0x916784082cd897c, 0x3b23e030efc51b,
+0x989b1e4af1fc427e, 0xabf141db43971c73, 0xd44c430c9cff3e8f, 0x3cabc6b64ec923be, 0x9cc7c1d7d81fd25d, 0x51af0edc88aac210, 0xf59b03afd8fe62bd, 0x2fd000d4e02ccc,
+0xece98738bf3c9cbb, 0x105c2e52cb1932b0, 0x4b3e90841c6f66cc, 0xeba6799da616fbc6, 0x13e0cdf11bcce5e8, 0xce0ff9a41cc1494b, 0xf6026d2dbf447a69, 0x3e28d887826e7d,
+0xea1c291ffee50386, 0x97fdacb79fa9d3a3, 0x3156e529035c3dea, 0xe3e7558082337037, 0xc8a403bd667573fb, 0x97db12ab278c1fd6, 0x5d925e2528c34fe2, 0x36393bb5f50cbc,
+0xae5c8b737c863bca, 0xe0c6bcadaae2d5e3, 0xe3ecc982c032d778, 0x1c6c5dfaa617725d, 0x128606a4e9bf14be, 0xe2178f7e17845432, 0x12c70fdd3971b6cf, 0x2302985fa727af,
+0xa8b24c7b649f4eea, 0x5d522933443d3f4b, 0xf3df3587f0b8d561, 0xa4aeb4e642336f63, 0xe13b11d4da9b05b4, 0x7f7fb56fd334fc8a, 0xef0e4a001d20234c, 0x68f352e059787,
+0xf9ec6c9f1c88aea5, 0xaf39ff94eaec195d, 0xc0c5a21552cca808, 0x24d68d0e7bec1c8, 0xfe0a277865339d03, 0xe9eeb45878ea9210, 0x34fb3d3dc36ed8bc, 0x39a7adc8403912,
+0xa00650c47568c26, 0x3c43ecd6b5dc8179, 0xf78bb79d760b0bd1, 0x5771a4c3edc44016, 0x8a0d9c8a93cbd55d, 0xb9bf713cfc647890, 0xa843fb9c42fb509f, 0x3518fd4630e4d,
+0x5cfef941eeedf29c, 0xae97474bf4425338, 0x85d45deb404e752b, 0x3a653cf016cf30cf, 0x13f47a8385d87e87, 0x9921e48b74eebc8c, 0x16819da66dc1824b, 0x3084ed2a5a8920,
+0x4be97455290aaae1, 0x7ca239bc37d49f71, 0x4e69dfaeadaded94, 0x788c2f5b0cdb5d73, 0xf0125c273f12f7ce, 0x327765fedaf51029, 0xd34ecdb5736786f0, 0x37e5a3d551f70e,
+0xd388dfe0440135bc, 0x9d6d506ec71c321e, 0xe4171113f844d4d7, 0xf79a0130f79f71ea, 0x4d7fe6836320fbb0, 0x6cc91bb32c4269d5, 0xcf0eb34f929e9b01, 0x13ac57e13f1ab5,
+0x2b0faab048a6d0b8, 0x1b6c0f741b2f1423, 0x33af480571d7bfa5, 0xe0146056ada88d9, 0xb27c9c09e88b81ae, 0xfee3c5746ef79cf7, 0x9e30c5bd3272105b, 0x1dd8a1c807086d,
+0x101d0fc46b5be403, 0x50e1e55f035f10ca, 0x90600917402272f, 0xb56fe25946b5f73e, 0xd243ca6c1917429d, 0xb0a41d4b386f3984, 0x4333b9eac604b41e, 0x401c501b1de92d,
+0xec73bc7fadcf6698, 0xea68c59ae4b4d31a, 0x62e8a21bae03f259, 0xd4ec36131fdd8e1e, 0x6bae188285787414, 0xf5ab34cddc07bd4b, 0x1a1f86cfe3cf946d, 0x3e56c6b3ed4652,
+0x2c82c7b5334304c3, 0x9e3e1c1513cfa81a, 0xc2de1420c4336b57, 0xafe3d6b5031995b5, 0xcb7a0685d576b829, 0xb35a935389d8aff8, 0xa61584f15d21f0fb, 0x85422cab9c0aa,
+0x278c221682e95182, 0xf120271dd13c10b, 0x3e0e6f6effed7770, 0x22c1e6526636b35f, 0x70dfa3e0f3523ed2, 0xcb7c2df72c2147ba, 0x48c6c4cfd2b1dbf2, 0x3b7e9c93d000fe,
+0x874891d44016f01f, 0xfbc62ca576b53086, 0xb7274a845d20c1bd, 0xd3ecac0f8681f68e, 0xec593134c1ac3766, 0x246e6c877e5b86ba, 0x760ea13cdde88de3, 0xf7ce284cba85,
+0xd9993c04381e21fb, 0x947618bfafab8a34, 0x1c5578f7e22bd33f, 0xccdfd9dc07f33db4, 0xf804be43beeb3ed4, 0x99a0145348accf87, 0x6dd8096167645426, 0x880847599b7ae,
+0x2100b6838ca12b7c, 0xcb91faf63634040e, 0x2241d8019014dff3, 0xeb7e8cd5a31a58ed, 0x15a3e73936b75f98, 0xc06f13720fd15417, 0x3cdf26d6592e122, 0xa326c9551579,
+0xff689f90dd74234c, 0xd58db103914b6d17, 0x1cc82df63ec33903, 0xbbc0241061be4dfa, 0xc5258e2c002c809b, 0xc02c8a23d176639e, 0x9b0441c8d1affb09, 0x394d0493f7c318,
+0x1d44f5aaa01e523a, 0xe73b24d484be20e5, 0x291d9c2efca656ee, 0x9567f0c13a6be422, 0xfac2dfa056420aa4, 0xd33cff256ba5f750, 0xd6ae4b1c36400872, 0x24f3da11093164,
+0x71fdbe027eb8d082, 0xa59c5ccf52f00e73, 0xd944dba86c52ab50, 0xf68582bbf9edd67f, 0x4ff2949003b4751f, 0x3a2315ba8a977ccb, 0x9504d1129e41643a, 0x31d8ccceddb728,
+0xb4e4c37d631e43db, 0x9ed6a486a8be2628, 0xf3a72bd2b28c9473, 0x7d908034e5c0811a, 0x10cbb7347ef39cde, 0x34ccff93833c3e20, 0xf040f8ef62d9b392, 0x2d1c01d057585b,
+0xd3b79249d2abd006, 0xda71a30f0f3acc41, 0xc6d496851fdb6f81, 0x3ca6f30d8e36f0ed, 0x41cefced2f5c0b47, 0x8336de502987f885, 0xb37bb45b6cae9b3b, 0x6a919364c16fd,
+0x19f84259adc13d20, 0x86e2feae1d49ddf8, 0x2c54c93304f83aae, 0xbe033ec57bf0758, 0xd89100f5f848fb25, 0x332b7ea8e31dcf43, 0xd3f7c3e30252da02, 0x3224316bc8c435,
+0xd6972d7def9fb19b, 0xdb35f80bb522b878, 0xe6a8ea4d44ca4b1, 0x33cf2bd73e7ad7fa, 0x36333e054994b0a5, 0x8a33d8859dd9bd1d, 0xaf64c00d40a0241b, 0x111c8146c0de6c,
+0x71037f8b49e6c185, 0xcbbf38bfac5df2dc, 0xda24e8b4e4f387a4, 0xf0d49ccc4681a8ee, 0xa315629367771f25, 0x85019174fece8be9, 0x48dc0e3d564acd61, 0xbc442b3b0db24,
+0xf71c30f2f43c4d80, 0xa3e726a25e11b91, 0xc9a9e1b5a2d3f724, 0x8fba1b6bf1ec30b5, 0x49af638a911e9aa1, 0x2ad3fb511746c68f, 0xed8c4ce2b85944e0, 0x1e827211c3778a,
+0xdfb1c293d4e83a1d, 0x9eb4bf3c1574a8db, 0xde32df490e2f117b, 0xd28cd725b27901e2, 0x87f72c404d42bfdf, 0x5f725b4ac066c5d4, 0xc844e763ab2e02d2, 0x39a77e89ccbb5b,
+0xbeb25eb642068675, 0x8db74ceab8535ea7, 0x9ac022540a4f2beb, 0x277a0350cd997317, 0x2a83282e61a2fc46, 0xbee0d6c2ab555b09, 0x24f058dce91f828d, 0xe28ed35677169,
+0x76f53dd9c28113d8, 0x9c5297afee07c042, 0x690072ba6aba3713, 0xcac173cd8f6f1af, 0xc46c6565d208a01c, 0x36365561297c0574, 0xf7d5a856f9aef754, 0x4331bc3b6d75d,
+0xd39aae69091a5b7e, 0xd9966330da15a7f0, 0x60bdd2197e5962e, 0xe33e44db925f3021, 0x1053d03b8b57e85, 0x91c29947f46b5bd8, 0xe49a9dfc4343b78a, 0x3599e8b2d55fe2,
+0x91fa1ea88a37f2ac, 0x7b702af299259959, 0xe8cfc1ee8837aa96, 0x6ed35303e3749299, 0xe92f2deab017cfc2, 0x1d47692d15ee9061, 0xea39d4da35611926, 0x3be4a5485691bb,
+0xd6aeba44270fe895, 0x11b34ec32acbb454, 0x80d48acc4c80a607, 0xd5727e7728c57843, 0x5451534af9d91000, 0x72d2a234bef68a4f, 0xe45bb0d4addc671c, 0x1ebf5279ba5b2e,
+0x524bdc21d7acbc2a, 0x6377236958bf92c2, 0x122b606865a6b3ec, 0x2f32e0fd8d6e78e8, 0x8b822717ef63a87a, 0xb2180bafebddb5f7, 0x445706949319b114, 0x201c62cdb0ee95,
+0xa68cfe9c32ac8cb6, 0x5032355ddec4abfa, 0x6dcc129f7a2f668b, 0x62d2038611c5b57f, 0xf6cb5018b1e31bbc, 0x76519f118cf4b248, 0x5485dea6651ce39f, 0x19ad552c0eaafa,
+0xc779069f236f872b, 0xa119ae8b95bf5e9, 0xda28a27659db0299, 0x39c44961e46ca7cb, 0x514679fafbef8f72, 0x7c666494eb3c70e3, 0xbc6c8fe23f0a065d, 0x48a341e7f93e5,
+0x28bbda3b81bd6947, 0x433859058eaa534c, 0xd770ad2955a1a1, 0xec2a6b83ac1a8e78, 0x4654d1a32230db20, 0x825bfd06c267ca06, 0x17b87786cf298126, 0x3de909b7230ad,
+0x56975c6659eecdd9, 0x98c99f76d53eaf70, 0x2130c453f58b2f9, 0x7426bb02e4c0f8bc, 0xb672ad535de92569, 0x669e0334166bde99, 0xa431a5280d725571, 0x3937b7400fdaa4,
+0x7c56bf395e8ef3b4, 0x855cec3bb3564485, 0x718f3c75dcbf9c3f, 0xaacd43e6fe5d7ae0, 0xd9be5936ce78572c, 0xb3087ede326c649c, 0x84e9b6ab1b9711a9, 0x2e7bb9d416dc12,
+0x2393fba175c76668, 0x5bb46653f39a0c07, 0xa50d45626a4b1802, 0x71acfea8bd1fa4d3, 0xb1ed3241cf836ad1, 0x489fcacfd737b427, 0x5f18361643906229, 0x18cb01bdcc5b15,
+0x1642c8c119fd6441, 0xe786029ac1926ca6, 0xd5ea676f8cec4ab8, 0x733b061f127818e0, 0x75862a60d1c2ff4f, 0xc8cba4048623234d, 0x55d3cbc7cf22d911, 0x298121534586d9,
+0x15a7a5b3b1d1a16, 0x9aff69187d54868b, 0x6863c6778567fd04, 0x4ad819cd8e55915a, 0x4b86e9f4d1a03a08, 0x84deb55bfb32f55, 0xb877df7d707e15d5, 0x1081ed2340188d,
+0xabf26362a9e904e8, 0x5e0e9ecc63ef1e89, 0x7beb8de267de1d9a, 0x938b65cf08b7c9b2, 0x212a58a027648e1, 0x5ff1d7b3ace895b4, 0xb81168516826baf4, 0x8c403e96ffa1f,
+0x20b7788ed5b60fa, 0x39144b7279e70211, 0xcfc28a5614c1c092, 0x1129720e7269723f, 0x3e2423d40295d2c, 0x6449c4ed48e60804, 0x1789d01e47328b36, 0x27bdb01c82b477,
+0xd8991fd938c92f1d, 0xd39c5cd20da49b4b, 0xe019155d0fa51576, 0x9db0de05546a8899, 0xda56fec5dd00b97f, 0xd8fbf6b0b2ec9ac0, 0x8c55037d86e28bf2, 0xcd290bc8c5b6e,
+0xd5622c5ba127af3c, 0x72f1f19d502aea48, 0xaca969630cd7a18e, 0x415e48d2c54e17fe, 0x8c2482a250f8b53d, 0xdf59568f10e2cc51, 0x28bfd6e04fdaa19f, 0x1f1b691ea24daf,
+0x6a325fe5ba36da23, 0xf40152a531ad6cc6, 0x7c50fcdee9983962, 0x148140d141ceca97, 0x1afa38e34138b939, 0xe220cec9ae009ed5, 0x5626a67c5bb6589c, 0x24a938b7cf5018,
+0x24e1c3d451374430, 0x849cb615e2928944, 0x141064327f9178a6, 0x1a6810256e8b2139, 0x46bd10de3ff6b73a, 0xcab77c7cc7cddf4b, 0x60ccf3488b60ceeb, 0x39d275a5e33759,
+0x27cbf9a724e2b981, 0xee937059f56b8a96, 0xf0307c1e872aa3ba, 0x4826754e9728facd, 0xc72e3ee2152a04b5, 0xaac7e299e0b4c2f2, 0x444a0af7007e109c, 0xca05b86e2abd2,
+0x1307227996889720, 0x6d4692182245090e, 0xfbe02624bb6a175, 0x6806a82426b3a493, 0x9c7e3f5d14934fe0, 0xbf16760e17ab96b, 0x76206426109e3f9c, 0x1cc863786d4df,
+0x378635d9adf1d747, 0x45eed7531307ffeb, 0x5afad1387f69f927, 0x8338fdf144910593, 0x5912de438094185, 0x3b5f51c7395aa440, 0x374ed9ca36d77ace, 0x3d3b98cead6aec,
+0xeed16b62df12590e, 0x22b38a3c5fd76b0f, 0x5e619ab38c6cb550, 0x7be620b301495bbf, 0xd73ed261927c0a4, 0xc8d3999c4339c84d, 0x43f78db1f740baa3, 0x314e40d51cbb6f,
+0x993d66d005099ac6, 0x2d6169f8a16fff43, 0xac5924fed3ae7bb1, 0x3e5bcc068f298705, 0x978aed30b29126e, 0x3ea0f1e8ae9cca42, 0xf69338bc7da82956, 0x1c5a5af04a4e3c,
+0xe982bff2c5e794b9, 0xe29156bd6c3c178e, 0x5ac915a83add6ce0, 0x76f49efe74dee6dc, 0xe03c80f259441db0, 0x55e0d21eb2b0095d, 0x840328240af81f70, 0xd7cc680a98935,
+0x88e69417ddae723d, 0x21213a9b0d167a33, 0x1fc3dddafedfb3f8, 0x62e6d7cbcbce7dd0, 0xd28bd3f1a0e57e3e, 0xec588c8232386405, 0x921c1c154efa5f05, 0x64fedd7b16204,
+0xd2b01739d5b0ad72, 0x5cc09747ddf1b38f, 0x9925603cb9a700fb, 0xd01a25070cf9734a, 0x30763ba13393f4f4, 0x679d8813240dab89, 0xf939514b32ca5e44, 0x39a85fd0cf595d,
+0xdd960376e7831763, 0xa616c2e8007caa35, 0xb60aa6cd2f655339, 0xd0a0c5aa9b6a7f18, 0xf1badc31b274f56d, 0x9b2d572f4016455e, 0x707851039d3ad72a, 0xfa46112123f6a,
+0x82232634c4ee437f, 0xfb77e0a3111d75a0, 0xff4b538eb0295e3d, 0x9efd68627f7400b4, 0x5cce879a18519d37, 0xa17ad569fd76b4a0, 0x46cb6142ab65f969, 0x1b8011164251c4,
+0x37de2748eb4b5f41, 0xec997909ed130c03, 0x364bc8d1b4f4e782, 0x2d3bd996236b4e2a, 0xdd6c7c2002769d45, 0x3019af5cac6a1e3f, 0xd820e0d972924dbd, 0xb00777bb5e762,
+0xc38568c72290aadd, 0xd254edcccccfb138, 0xc31974a28d7202e1, 0x275012cea9c382d1, 0x8e0897b43176056f, 0xfb87ce4934e9df68, 0x68307fc08ddda308, 0x197e110b61d433,
+0x2afbf090ab0e892b, 0xe69fc43a09f860f3, 0xc569dd6c4c187864, 0x384b00299db37c40, 0xdb652bd9bb88736e, 0xdd1618f0c5b3ecf7, 0xaf48f3a1144e8dc2, 0x1694cb4624d7e6,
+0x4ba67af586405497, 0x87703fddceed7599, 0xca02a0c61ea4c8b, 0x7f9cefaa31c762b4, 0x96bc687b5799be8c, 0xb9d4e0590f121231, 0xe161d41aac2fefc, 0xc56f1e7c7bea1,
+0xb48af92423d189e, 0xa6636725e2d2d112, 0xcfcb3ad4203fb56d, 0x93f3f28ca293ad1e, 0x9c3dfd32b98f52ee, 0x63eab7d5d239a8f0, 0x7c088fec2af2554b, 0x314128d2eeff12,
+0x7a82e99a21777977, 0xd5c4ca9ef49cbf5, 0xd4ac773f1eba7fe5, 0xe10b3b5176f567cd, 0x1326b5d1c433a6c2, 0x4b9f634d0213637c, 0x33cee9ae1808141a, 0x6e736c7977f99,
+0x96d814b21cb4c57e, 0x8b1bee5fd032334d, 0x3279457ff3d999de, 0x70e0875754d8ddd4, 0xfadde5c3e8700e76, 0x7ae1932fe075b290, 0xb2ad11914b449a7c, 0x2dfec6dcbc4009,
+0x415e165b41718b8c, 0x1a6f384b9d37a9e9, 0xb77b1cdd8f36fcdf, 0x28b2e0bd53889e02, 0x327645cb856f06cf, 0xe0d6afaa31a44dcf, 0xe4a91cccc3473dc0, 0x2153030148228c,
+0x9dc3283cf41847fd, 0xd0f623efecdca4cd, 0xa4f2bcd58fa2d8ec, 0x95ea298e9ec3c694, 0x8af5692a09e86e6d, 0x3e671c65e8ee1979, 0xb66471175fede947, 0x21604fbf4a4546,
+0x6394629bde06f1e, 0x1270ab4c279fa3e0, 0x8a8f548195a95967, 0xe45f0abca3dfe059, 0xd79f5f5f9aed2250, 0x84187179a8d2a830, 0x196cfeeaf39141bc, 0xb7dd38f75eba7,
+0xce4d65c0077b7469, 0x1cb88fd628df0f80, 0x3e29099ae644d338, 0xa927669b6cb8cab3, 0x3ac84cc66fe296bc, 0x99915234b073ab11, 0xd81a01d09e134e50, 0x3a9b3c14ef81f9,
+0xb25370fdfbc70884, 0x166e24ead1b6445c, 0xb0ce2ac9d9055776, 0x1a10d7e7e54e64f8, 0x76252b783635c66e, 0xc16ef5a9a27468fd, 0xe48606b7a1b4a356, 0x1cb9b4a8cb711f,
+0xae67f9a26a957959, 0xb0ee547fcf2c2434, 0xbee4cb75c9878e55, 0xe1ca863cf5e0f255, 0xe612bbf589217673, 0xb0f00a25c3f541f5, 0x6a51ad90c337132e, 0x26354ec04ab152,
+0x150c001cbbd8174e, 0x590e63a90bb7f99, 0xc57bb67a52e1d8f8, 0x573f38fc5064f37c, 0xe4b456907fec0b95, 0x1c6f804dd5883b61, 0xe782a987a0676e0e, 0x293135262db66c,
+0xc33b05d83385ede4, 0xe8e786aa8f2f6ce0, 0x4d35f6f0485d1e37, 0x851a0cca40b4c2b1, 0x572fcb44cd7f0264, 0x49022a2592f1138d, 0x15fedccb8b8d441a, 0x383ce544ef4fd9,
+0x3d7abdead61885b1, 0x1a68c1cd1e50120d, 0xe40cfc0e0903bae2, 0x13b296e35ef8982e, 0x487a17221469f8ea, 0xba0e9714a11e0823, 0x1df8129fa352e7c2, 0x2a972bf681d2c,
+0xeec08fb722d42e24, 0x2119f06a95351efe, 0x4da052b9c99150a0, 0xb43a4666ec405e87, 0xa469bbb85436f39c, 0xf9377506355eaaaa, 0x9719990b3a89808f, 0x6195aae105794,
+0x73b9052920c5a1cc, 0xabc3ee679996ef3a, 0xbeb3dff132f4cfef, 0x8f78ad464813f353, 0x51a059afaf5575d8, 0x5366faf5d7e898d5, 0xbdee43a29335f3b6, 0x3855fcb92038fa,
+0x7aa262c0d890b537, 0x436c7dd6b40ba21b, 0x7862bf3727eff4c8, 0x66c51479d6e65326, 0xf3bc622f05b4776d, 0x964c4196d2213dfe, 0x874553c0cbb35c3c, 0x141741bf42ca64,
+0x703026bcad6048d3, 0x35d7724f0ab318ca, 0x5d937b6afd95348d, 0xc826f322d9aa881c, 0xbbf2c76fb1fbcd2, 0xb5e8d8b941ad8806, 0x4389954f2f77d109, 0x345b4c6ddfa22a,
+0xf076b50009d1280e, 0x17c2b52fdc3adc26, 0x975b8943337be9ce, 0x330eaaee7ca60bc, 0x1db5fd7d40aac65d, 0x6decd2e0298df528, 0x1c8b72687f9fbc75, 0x3c7bc847fb4cef,
+0xb6276ca6eb0d0d34, 0xa518033aff68040f, 0x3d3b9610505e0db6, 0x8dd3d9d1daa15564, 0x5b0aac176b978018, 0x872ff96ce263b8df, 0x7317a0b49f53852, 0x3078a3f2f4af59,
+0x1ae6b418277829a9, 0x6db1daa64c42ac67, 0xf789a0d9c9a6c3f9, 0x4091af15beffbd0f, 0x712e26c8a2537d11, 0xa3c9c960849163a8, 0xa95fc4f56c3a0441, 0x16a0af3919bb8a,
+0xc2311c3ff51239ee, 0xf515daf90c990310, 0xf8677b16a4706229, 0x7ffde1681a55fd1a, 0x36cc8aaa40a33f4e, 0x5f8b777b3a5612d3, 0x4a46d3a0dc0748d2, 0xb122d55fe84d3,
+0xf9728414f64d1646, 0x5a47574f9ae6de89, 0x494a8c8492067b6e, 0x43714782ff8e5c2a, 0xdf706a93957ae297, 0x42c0ef21a5292af5, 0x464bb6e834d0063d, 0x1d74abe4ae0e2a,
+0xadb246c017aed440, 0x87a1b63f6f7a6326, 0xa669eb23f17e12e, 0x940343f4bd4e7218, 0x64ad02d07114270f, 0x41af6811c9dc8022, 0x4601785d6347f79c, 0xe67e13a46a90c,
+0x67920afb6dd17db6, 0x39a999c421bd6022, 0x9f9abdfb09b34e76, 0xa07316e8ca902352, 0xb0bdcc914da5a1ce, 0x38354ebc335e761c, 0x57df89a344abbc71, 0x26bc0cfcfaa9da,
+0x7fa326ccc6d76c08, 0xa537ef97fbd1ce86, 0x8c1315b9df5f1ffe, 0x69f26a041bf2a316, 0xdb1317f3d7641378, 0x93cab7b9865bb932, 0x8a97d81811db9b4, 0xbd31f3772a975,
+0xc5ecbd6f7ec95b90, 0x98c6c04ecfb6b9f1, 0x75fab35de1a7405e, 0xb906b0ffc80aa93d, 0xdb9d2dbf93f4986c, 0x2443513f80ecf0c6, 0x6e289fe0c990ad74, 0x395ab22fda0eb8,
+0x322e57c3c88954be, 0xad4d71add87ac153, 0x3a003fae79fecc3e, 0xde6a1dd8a63ce1fb, 0xdb92e455e7ed2b6d, 0x5205e3a1390d651, 0x69ee4fb9dc24a41f, 0x3f2e880b28ae6d,
+0xe3842c1640b723bc, 0x5d3eff26f7aeb34c, 0x42c8c06a64f699ae, 0xc3c183c5054de19c, 0x7be96bb05d30bd4, 0x54d659d2986884d2, 0xc668add37d23a6ef, 0x235262dfb3ebf7,
+0x248bb05e88f2fc2, 0x37a1427d76a8e58e, 0x721ca81ba3072d33, 0xc0ac6ac426e962eb, 0x29729be74308f480, 0xb8c12246a5854a9b, 0x410a6d5a493ae150, 0x1811cc4f9f0cbb,
+0x2522809d64553bd4, 0x36ddd8410fb3bd7f, 0xe5a9c43305cf5c15, 0xd64603f01ec62e5d, 0x273bd3e0e9a4c44e, 0x3c62cd0d91f0dcee, 0xfc25eba527d52a98, 0x1462c2ddadc471,
+0x5da82c09032cee40, 0x8ef5080476619fba, 0xf496f1fc19091302, 0xf2917fd3898513cc, 0xc0a46f6d2db2635c, 0xee285cd032f1be6, 0xad4b4d8a84bf6184, 0x1274abf631ef6c,
+0xc189eb84929ab0ac, 0xdb10fd8bd2d3b31, 0xf45402a91da10ede, 0xc13050e782ad38bb, 0xf1902affd87643c1, 0xc777c0804d19c3f2, 0x6fe7afeb89fc8ffe, 0x3d8da3245c35ef,
+0x2f2ca3e00b8792ac, 0x3038d78808535582, 0x2b9c6244265ed26f, 0xfadef2b90c302454, 0xb775ff0a3f24284a, 0x27c08fad8ae18a61, 0x7e1f91b90fe1efdf, 0x74c375dd4d0cb,
+0x5d92cc44d917462, 0x726362be4a5f7ee0, 0x2b417499d9cb92da, 0x1989c18646f8cbb, 0x3b2449b1316ae5dc, 0x324504611fcb4f26, 0xc3bc224fc35c76f6, 0x183f45de38b903,
+0xc24fd25baebdf09, 0x9cf0351f9c453327, 0x4bc87a38b11c8ab3, 0x9e8092145df7cfdb, 0x1d68b5b0bdfa638f, 0xf4f8f8c40c6c862e, 0x22ef837ba81dbb04, 0x2dda2ef5f8d28e,
+0xdaee9777512f6ecd, 0x2bff4d684a7c09ed, 0xce5f1a93a2e1b8a7, 0xd9ba6da20ed3e772, 0x35f42dc07cd06b40, 0x4217cdba3b9e2fd3, 0x3e7ba7247f79fcec, 0x763e83944b4f4,
+0x347ef329e7dbfcfb, 0xda83e50bb867b22e, 0x4f54c0d91d91a5e2, 0x67578f0b015ca3c9, 0x1bc05f25fa85f315, 0x9a1240ca6c095c0, 0x4a742cbc02d6819e, 0x3ade63668e5364,
+0x5ed6b009bbc3552d, 0xe5a04db6b894f30c, 0x15ad9a8f2e736ad4, 0xcd6f977dcbe83fd, 0x26f629212df78585, 0xd761ffe57d75ea3b, 0x56b30c87cfa587f6, 0x7ec44a78afca9,
+0x86c1fc7c1c0efc87, 0x65108ba06e53f7d7, 0x724225aa82f046ba, 0xf6983ffbeecdccb5, 0x169d7b4ab84a1048, 0x5be964caf402861f, 0x29c41c0730d450ac, 0x273f0a471dcfbb,
+0xfc0bb76445697094, 0xa12e8285d586ee35, 0xce5c1ce0a930d5af, 0xfc71113784e2525c, 0xb621642805e582d8, 0x520418f3e11061a9, 0x3874086dab2f71f8, 0x164cdb5e9f8acc,
+0xcd42bb383b9f2f6a, 0x6b7bd4f9446fbfce, 0x401a7c8724dbb69d, 0x2ec822be1048be87, 0xe9b4e21511bcfe02, 0x96aa772643d32c8a, 0x3ef2a6484a261a89, 0x2e39165e47604a,
+0xcde0d4ab0fd021a0, 0xdd6af4ea11afc0d7, 0xbac4986eb28f86e7, 0x8667e6cd425dc6a6, 0xeead5cf567e01f2f, 0x1c187d8bd0e15940, 0xe838df37f20ddfd, 0x28081decf0fecb,
+0x95a835fc3e62b063, 0x4d662eeb9134b08e, 0x5572af77d56e55f2, 0xa1c3fb792f2f74b8, 0x5bc97e1f0cf59a57, 0x358c5558585e5def, 0xf2a6eb79e05c5494, 0x38dce13515e69b,
+0x9f87ae1a69d71dfd, 0xe4b9515ba757204c, 0x7c9eb68a2fb39bd6, 0xf367a61c1274607, 0xe3b1285b40dc31bc, 0xc16c53cbfee6054e, 0x81a20886eca7b83b, 0xac27969a82b18,
+0xd7a5c628667d9aed, 0x756392d856d2af01, 0x6ef9c6255bc2f9c7, 0x69da9fd5fea582b5, 0x7b46226862e491c6, 0x81e85c8e0859a1db, 0x38af6db525dd427a, 0x3aaffd72b0513e,
+0xc8675aec0e9f24bd, 0x7f34464caa49e693, 0xb700fbacbf85bd0b, 0x2c424a853ba30cc0, 0x7f7baddc01dfa843, 0x5e0000a4971cdfc1, 0x2aec4bd47ff80f44, 0x2f9b0be6237892,
+0xe36c5fbc4453fb0b, 0xa8ea1f66561ffb7c, 0x19a1520b605bbd08, 0xc5d5056f968d2588, 0x5f9bf1cdc6cf1b73, 0xb6ce774c72900594, 0xa5555a28348ee8f8, 0xf5e4ac8ce8493,
+0x67e051b45cddadda, 0xa81ae59047686de8, 0xb0bdd69ae119de23, 0x309fc0c40aaf452d, 0x566058f264d2e5df, 0xc6fbcbb8db97cc09, 0xe974f02e9c477609, 0x286ee5844338f3,
+0x8bf5c42281cac52a, 0x21a6e382e0946033, 0x9c6b0f8b9b6d944d, 0xa304a557d2f9de2a, 0x995b46d1c099766c, 0x41a4398e36c9a10, 0x1753813aed576faf, 0xdd8b1e99ce434,
+0x74e361255bbbed83, 0xf49dbbba8416a1d9, 0x417c736ac404fbc6, 0x2a9041e508451dca, 0x8d64b39513b1c43b, 0x78c46ab9b9ec1154, 0x7e71733cca909288, 0x4840c60ae3a40,
+0x16ba8326504cd615, 0x14cd4ca3f7090cba, 0x548fa5bffba39b2d, 0x9e4d08dbbc68298a, 0xf39b581c1164ab57, 0x9122077a9ad4c49, 0x6da7dbcfa977ad78, 0x3bf7ff15388a30,
+0x9658fdf7c4de2ab6, 0x80c5e124487984a2, 0x2698484e38f43c03, 0x4596d7e038363fe5, 0x6daf7cfe07aecd88, 0x70f9d211c56484e7, 0x7d2524fa959f3e60, 0x1e580a6289b23,
+0x2268f6e48bf0a03d, 0xcbbb3ad11078a0cf, 0x16cf63f6e40e5f18, 0x7c1c5ce8bad232c7, 0x67ae097e8fdfc76e, 0xbb3131729745ae7c, 0xb7df6eb0e6b3315e, 0xa1d97034e3c47,
+0xb55c3b4a4d9a3332, 0x83bd15f91bb5817e, 0xf901e0c329d1a219, 0x50f7607fd8226e2, 0x229a13b5a0dbcb8a, 0x503f2554656571dd, 0x1a1777ef624baf5a, 0x25e3257359ee5b,
+0x8964ba1f9878f624, 0x20815596b573bd5f, 0x93f99ab02c04464c, 0x80ef1f058c5261ac, 0xedc121867ae08f3c, 0x503a9675b6bd01d1, 0x9823c5b35ef8d046, 0x397a256472595,
+0x7eebc5538d03e75c, 0xb2fa0f472168c491, 0xcc3438709048a641, 0x2753f556a9d6f486, 0x30c4e59e6c54213e, 0xa7988e7987320379, 0xf5aaefcfad9a6bf8, 0x26d08fc53e8e1b,
+0x9b303033e54b61c2, 0x83c22aad5d1e11a, 0x210f0784bf978f59, 0x1b69a61944b8dc0d, 0xf8f0564f8a26e1ee, 0xd21d3570781e4e16, 0xcbdc7b3599236547, 0x1a7e41b1ca5506,
+0x8441f569ea24d0f7, 0x2b88fe2bcb5ab804, 0x4df59e3583f2451f, 0xe51e9a7467dd6bc7, 0x6de7a6d49f6599db, 0x7bf80e76a5d8b78a, 0xcab50ac90a68e119, 0xa357fa8100556,
+0x4682d7091d93be1, 0x8475c58e61a8f173, 0x3614fcc922e45e42, 0xb5707ebf0f451970, 0x24b519c4ebf45359, 0x233d24f80c41fd83, 0x4777e5505f3c2177, 0x187d0e066b01ad,
+0x31a810f6d7de19cb, 0x165487e4c2511c83, 0x16735b1d0368c52a, 0xe67010842579c09e, 0x86cc9aaec089b518, 0x5d1f6a9404946cfc, 0x4a291ef0aa47d3f3, 0x1c5e7f47bc34d2,
+0x593f9eeb5576ce93, 0xd5acf9ad19e12363, 0x2f6c302076778cd0, 0x37a79d10b67c33f7, 0x51164c193e755ae5, 0xb928897dd5d3e571, 0x10128484da2ca2c7, 0x20d18778a87644,
+0xe04e3ee89df9cd10, 0x2d5f391e3ae0c010, 0x9b35ce7620268597, 0x2668bf744ee7181f, 0x6a92c614163f49ba, 0x1d70378f07c849aa, 0x6e1f04ac4b4576dc, 0xfaf8493d8921c,
+0xbe0f1ec4e87ff10c, 0x98355c62bcb83c4c, 0x4d8f1f24418a82e7, 0xc07b869df318a161, 0xa112611b694b206d, 0x8602267f7f995c55, 0xcdfdc143ef02ce89, 0x1a9859969cdee0,
+0xf2164f389a5a2bb7, 0x23a640616766d7c7, 0xd22285978baa3b9f, 0x4a69dcbb861ed331, 0xfc489ce4580420f, 0xddee2dd37d114ad1, 0x8c3253d063c5ec49, 0x22f64b55393655,
+0xcb2be3e19ba84257, 0x3aef992cc2d9d8ae, 0x5f0747f0c0b36125, 0x8f1a263aee7b2574, 0xd2ab63c9ef7c075e, 0x54a33dd34c389624, 0x62ae9cf03fe8836, 0x3419616998d55e,
+0x5310d0c9e6e727cf, 0x3379e34c8255ade9, 0xcd6db0803f4ea612, 0x6a6f0239cb3283d8, 0xf79918fee6f01dcd, 0x5d94f5cab8e4960e, 0x5f052f8923cff7b, 0x2a44b615ce7e8f,
+0x4ca668b9151f1fe8, 0xbe8b7071f553ab51, 0x26e51c369ff6abe8, 0x3aa93c0d1a9fdf3f, 0x754afc16468ad206, 0x8d54131dc55cdfa9, 0x4c537692ae773105, 0xec07357f36227,
+0x47e8e4bad4370667, 0xafddbbc94f5891cb, 0xd04412854ab23100, 0x8538e9d50802c730, 0xfa5925acf571e9ce, 0xeee5c3ec9c668cf1, 0xeff3da5dc6f90c15, 0x236945d4aaac8d,
+0xb2b1aa382d823817, 0x89071263c3d4a0c8, 0xefbfa075e967e724, 0x2b5e993ba08de828, 0x81d76cc5a1392992, 0xe5a4abcede7d8448, 0x796ac65267e99003, 0x315096fc35cb58,
+0x4b758029582c766a, 0x7c4158b01649d8af, 0xfaadda8d3e4536ae, 0x7d807e6eb5c438da, 0x3a338960ecdf3167, 0xabce197b90b3ead6, 0x92e0bcc627c68154, 0x195102f0e802f3,
+0x8f2eef6c462687e3, 0x46451011529ee89, 0x1c29e0a2e1210253, 0xe92b93e6ec933a1, 0xa9a2c37cd9da8e80, 0x1ad505ef046a6b6f, 0xc260af6f50d39a75, 0x1a9956f4b517f9,
+0x68045126d254f114, 0xa2f0504747dda5ca, 0x6859cf27798389fa, 0xf6a72643bb635e67, 0x2898459541fcd1d6, 0x6abc23b0534fc114, 0xfeacfe9aa4ce1e73, 0x2e4c041fc5fc8,
+0xa30157ffee7b7701, 0x10898b14a7047abc, 0x5b6872e922663226, 0x3831e8eeece95946, 0x8675daf8077d22f4, 0xcf95ec2584d182a3, 0x49572c214b27ee75, 0x2a0a2c45b04e83,
+0xb4df80eb1cb1183, 0x85db43dbde8ff6cc, 0x399ec33dcfb22c0b, 0x9da53a64a8be9663, 0x3b2e79c583144cb, 0x9561aab56faec546, 0x50151490b0e14412, 0xd9b6c7661436b,
+0xbc7366e0175128ed, 0x54d507eef35d5de1, 0xf7e61de527e3f6c9, 0xa1d0e997ef053bfe, 0xd121a6d4c033d662, 0xae664f0a348f547f, 0x42b4bf690a3fe7e1, 0xfdd21f5261996,
+0xecef01b11b840d6c, 0x3742896154408fc9, 0xad4b185a1f128446, 0x46265363de273921, 0x61cb52806a30846c, 0x1e4d015a51ee4a3e, 0x9485f98ace3808ad, 0x98ed053c18b15,
+0x8609c402dfe9e94c, 0x805811c3e88b0556, 0x80e3fa0559b349a6, 0x9b679faa57d64232, 0xd14f161eb02a829d, 0x16076717d345a718, 0xa9c5ff3e028a0493, 0x164c69bef3c2d1,
+0xca4c53b5b1fa6a69, 0x7146118fad6e739f, 0x4a824d2ea3a56b0b, 0x73e8c64ed16f714a, 0x9bd7ae7884d05172, 0xfd13f5e9cebf7964, 0xa1fc47982cfe9f7a, 0x3808e93c6e1fb8,
+0xbaee70f25d338854, 0x446546a856bead80, 0x125df9f1ea30bdd2, 0x86b6c14aaffd961e, 0x26e12a7a09d079d1, 0xe0d76562c2fea5cf, 0x224b65f818a4e5e6, 0x1208a83d86db07,
+0xe2d4138ea5c4e2ac, 0x6988938be8aa90c0, 0xe9d3dbe064483cb7, 0x949f324b467af3a7, 0x9c1af756d39e81a9, 0xfc4f5828703bcc75, 0xe8fc273b575ea7b6, 0x2d0a344ca4cbac,
+0xd90cf27631e7bb2b, 0xf125423649d2be40, 0xaf5719a7d738b274, 0x67321f15376aa58a, 0x3b48cbf14ca38e9d, 0xb6c66d01fb8429ae, 0x94a5666ab28c7739, 0x1b0a81d02f7a92,
+0x669c7df66357e3c5, 0x7e182e281f1219c1, 0xcba3f187abcf112b, 0xc748f26661bd5dc8, 0xad9c5bc19b5e47e5, 0x1a70d6eafda7a16c, 0xa8a9dde38ad0404e, 0x11857b2ed23266,
+0xc3252d04dfb9f6a0, 0x64e9f56b1f47cefe, 0xf1cf083e8e283b9e, 0xaabe8db6de21fcd8, 0x36a948454b690a30, 0x6e4b68786ef33064, 0xd978db725cb6ea16, 0x256bc17ca1bee1,
+0xf49e4f9117ec13d0, 0x919f5ecb834405d5, 0x56b467b37abd0c5, 0xe0f4a7e916d7b89a, 0x52842d83d97b6206, 0xa0dec4b94948d715, 0xc955ca31f8f4b34e, 0x3bd7a7ec4006d1,
+0xdea0d639c1e62718, 0xdc3d1f296d2b9da7, 0x141f2b13cb0852b7, 0xaa03dbbae47260d2, 0xbe77699d330c4771, 0xfe369aedb0b7491d, 0xdfd43643d06551b2, 0x1f61221aa1092e,
+0xfe089d9bd3ed5de4, 0xb22cf0d8b9437904, 0x26d1065317bdf979, 0x736e7911e8bd419e, 0xadbd97830b112bc8, 0xa5b491d46c4b8383, 0x6fc770e589cec102, 0x11455bddfee2b4,
+0xa3bd4e1f86d2f0a9, 0x4c1b8b4496f1ecc, 0xac365ad3a4de1705, 0x6e2ffbf3887e1971, 0xf89684a39f724403, 0x18e29dd0a34dcaaa, 0xabae6bfa75278547, 0x11333bb9623c58,
+0xd7c5f564beb73b11, 0x1a8e361634792fe6, 0xcffa43d22647d32a, 0xc0798e823e38334c, 0xfbccbd78be945930, 0x469d7af9a9096511, 0x26a5259ceecbe384, 0x22c97057d03f8b,
+0xd31d0d7f18a25ce3, 0x2957ffdce7e1f146, 0x76ed633f6d5d4697, 0xa5eba1a6ae634fa8, 0xe69a0c8d4a6ef792, 0x1f987028219dbb37, 0x8d43d5efe00cce6e, 0xcd64e324bcb0e,
+0xf22b8104366c3b05, 0xbc9a4ec1db3718fa, 0xa96b127ee280331c, 0xdfe8d449d8915f13, 0xd2a5b8f7cef3ec03, 0xf7e5fe3353de92b4, 0x96cdeea90fad7c1f, 0x20585616cd393f,
+0xe1c308d06b335253, 0x49b77b610ae5ec72, 0x34b4c128947949e6, 0x53d75b2a3be70ffe, 0xf1b2e2c5f4307693, 0x25d0eb51e9a0b7f6, 0x605523a223760fbb, 0x20b58be108a584,
+0x5973911e4f0a73fb, 0x1405d5f6ab9232d6, 0x3ba323a33f6ae9c8, 0x921aa708a677d68e, 0x9a5ab588d1ba2150, 0x41c0881f7af4dce8, 0xd452a88d3b1967a8, 0x3c4e8002cd7f0d,
+0xb368288fb280b0f, 0x30ca5cc6b5cfcdf8, 0x30b8b68d14a97ef7, 0xb15e628a8226a6b9, 0x4a81ff01e7049173, 0x54c02e9aef83efee, 0xdd5a0e31458d4c8d, 0xbe1dfa0c7909,
+0xc30fc6b40c56c04c, 0x604e884904a006ee, 0x2f9b47342d3c286, 0x1932c6659787fa81, 0x498a852c7724acc8, 0x88bb47137304e7d3, 0x3621c3d4ed50e95, 0x3295310a10acf7,
+0x3062efad7d32c937, 0xd8192ecf38eeb3af, 0x6d43cd5e6302b37b, 0xa54853deeb863943, 0x8e38864a433dd192, 0xda3d2ce4a57038a, 0x5bd9ca36ae7215ba, 0x146e00800fc6a8,
+0x3aea64b8061f8e26, 0xfefd059b76566dd4, 0xa2fbf3bbb343cd72, 0x32a06da51d9a145b, 0x64b8e1472bfac74c, 0xd05340d18930467, 0xaa1daeede436f9a2, 0x198ce4377f94f7,
+0xd4a6704158ecde3d, 0xe1dbbc37692f2d1d, 0xab032799cd847d20, 0xf112a09763d841bd, 0xc94207b46a50e640, 0x2a226b6cb21e58ed, 0xc901c2a8bf17c073, 0x3f925adb023e75,
+0xcd37842a192a00cf, 0xfc88440c370ffd99, 0x8b9e3d514e33b333, 0x4cd9a90936c5dac9, 0x157c075a75fb9091, 0x35413be548cf1e62, 0xa0763a0db6c4e6bb, 0x14f18b0c454b66,
+0xb80b37fcdbd729e9, 0xb966f0f6e289a9ac, 0xdf8a4bd5c2f69f77, 0x542609f4c0254c9b, 0xe2eb8350c4949c8c, 0x407d7d1104f218dd, 0x9181ff3c21cafec5, 0x217f4b649fbbe5,
+0xfb825a79eddc8828, 0x8e25f7d4df43b81b, 0x880f4fa2a3367354, 0xe70d6eac13495ed0, 0xfaee8e35d8300028, 0x8fc7f0a15e9910a2, 0xc702140657cf5eb1, 0x2a4e695ebd8e6c,
+0x2df56b3639a5a87a, 0xe871cfd4c7ba51d5, 0x6664eabe21c661cc, 0x33f4fa8110dd59cf, 0x66e67bb1afc1aff7, 0x23decf2f5c2d847f, 0xb2172f743312f825, 0x3bb4fbf9c7ecfc,
+0x56ef7a982d1ba9f9, 0xfeda4f030164b4d9, 0xfb6959a698f643e5, 0x7c4a3f97612009ce, 0x17679b05a0a0eb9e, 0x317e21cd9c7a4b10, 0x643f6904fe0bf15c, 0x10124cb9012781,
+0xfca133f99b521cbc, 0x7d94c16e170dd9ba, 0xf022e7426aeee721, 0x71e5d7e32ec6b10e, 0x9c7018483b8c0bcf, 0xf8a9f6dba36db0df, 0x185c99f2221ce50f, 0x3da7d6befbc71e,
+0xc49a8604c9eb4ee0, 0xc57c68411c37ee7c, 0x1972aacdcf6bfa5, 0xfb2799ca78d3c64f, 0xcf0178447fb47ed3, 0x2b1202b2b07fe32c, 0x8acc78222f68312b, 0x3867009532b82b,
+0x20c0e2b4978c5618, 0xe3089d5f1fa17d56, 0xf5bf801bad0d9ae6, 0x42f8baa87ade2b1c, 0x9752e7fb4e618635, 0x1b3e471be4a0e0a0, 0x27b723c5febf97ef, 0x3bfe6389a823d1,
+0x58903ae508284669, 0x49e357f5ab85e349, 0x38282f57c45b310d, 0x33368ada95359914, 0xde5482c7f24b1101, 0x14ebd063ad929012, 0xa2873803b2b66a19, 0x1d728f0fcea1d,
+0xe6d3699960d7ac2f, 0x9a064d08e677ffd7, 0x6552a79198396455, 0xd18e7c9f795100b9, 0x6014f3c57290a006, 0x9c0b68186fd3487, 0x3a00899bff562b1f, 0x23d747898d0f2b,
+0x56e505a195b85f13, 0xdbcef317f84a8baa, 0xe0a48c6f5d68249b, 0xfaee8758a1a86403, 0xf02ecfbb249c8248, 0xbb71d24c0c8927e, 0x8eacbcdb7190471e, 0x1a1b74d38e8e52,
+0x8ee63210da4b85d1, 0xeeeb3cac7d1887a5, 0xdca61ff628eb456e, 0x414352bd00941f4d, 0x7fe913d216105385, 0x87cc9991fbde4c47, 0xe3bd8d0de3b8853, 0x18eaf18ff66d9a,
+0x2769e5c866185fec, 0x28ad77beef460615, 0x98291a96a65800db, 0x900e717bc4f8fbe4, 0x39d40140c91ff72b, 0x12ae7fb60a819890, 0x404c3b7f062ba81c, 0x3f5e5358471d07,
+0xfa964ba609c39a51, 0x8e6830541fc9c95e, 0xcf622c1ec67370cd, 0xda711d230322a08a, 0x9d65c266306f5d59, 0x7a3d564412ac1a43, 0xf6c668b77df756d0, 0x18e65aba305369,
+0x65b59ed19a8c170e, 0x80a6e8c3db0b1ed8, 0x82b8c6acf6085ceb, 0x21f2b59d4c25b73d, 0x9dce5e00b53928cd, 0x7c7f063b9a559dc4, 0xced9cb5af0bf9e53, 0x8c601329bcebf,
+0x730fbc7efd7bfe2d, 0x721c118bb5b79940, 0x57d450098ed932c1, 0x98369c0d1656f4ad, 0x96f3791040ece76c, 0x1e46fc752f750acc, 0x172468ba4136133c, 0x100944a7fd75c9,
+0x25b746de7caa579b, 0xb96b60741f77cc4c, 0xef842a6a0a6b8954, 0x9f9b09982942ac8, 0x6d17c901107c4cff, 0xabdd7fe1cc8c4666, 0xae19aa20dd335560, 0x38dfab8e77346a,
+0xa7f4558e7e6dd7c6, 0x59aaec9a31b2b0d4, 0x1f4e039143f7e0ed, 0x56fed41cb3846cd2, 0xc115f6f29d7b2b7b, 0xf12b51e977967a02, 0xa871c4769eb77491, 0x14452c5b2b4036,
+0x1dade6d75d6cdc8a, 0x25314499ed7b1f53, 0xc2f2c88b72c56387, 0x6f0b1548d77cd418, 0x647b36506b138f65, 0x6113fa64592e5a63, 0x73ba87d115549ff5, 0x1e6eec0e28135d,
+0x44af9dd29bcbc044, 0xeb82c096fa5db19a, 0x64ab8afd2a85372c, 0x484157edd7a0a016, 0xa4349f8bc6af4b46, 0x40e4e36830446b68, 0x54f5b4b74c64fdab, 0x33b3c07be1c1d,
+0x5d41e58b58c1852, 0x97d9c5c11de2c000, 0x54fbcc9ea5b0802e, 0xda3bef8276e64194, 0x7a36ccb3b0674dc3, 0x30ebecfdf6721c7d, 0x34801817c411bb36, 0x34c33853b23e69,
+0xdda5278d75b2c07, 0x4c8bb5c0a02b111a, 0x4ff0564b43b1054, 0xa3e6d2a58b2b1d61, 0x755f62ea1c91e9da, 0x8dd4145eec82341f, 0x36f9c42d7b96a554, 0x2473602aff06a1,
+0xcc8e965a42a43e10, 0x4305317d40b2d996, 0xb406cc6f3c2a5734, 0x63ad76a3a0106de, 0xc6a2c6598fad8a49, 0x964c9c4bfdc89711, 0x866bf40e998c7b90, 0x30e17193e64540,
+0x98fd523e6faf845d, 0x130eb338d55fe2f6, 0xeed3d8460fb58360, 0x602a8f327516c9c0, 0xadadc25e1ba11183, 0x378f811113f5b8ff, 0x8fa4118fd7382581, 0x4416bd82c4e54,
+0xd0ffd8fb1e865e9b, 0xed38dfb6a2ee4c7a, 0x1bcc88130417e7ee, 0xaaefcabf636c98b0, 0x24b0775a10379ebf, 0xda89b2c300dfff65, 0xfb8bd7ce48bfee70, 0x273f4c6cfdd86e,
+0xc57f62a6b4d2a35c, 0x25f5d61dbd328920, 0x323d0843805c90a7, 0x477014ae43fb2ba7, 0x6a675b6c0efca370, 0x2d9d08e2da1155b3, 0xb4a888580b24a7e2, 0x3359ec9de7b4ca,
+0xccb699260d138fc7, 0xce54d9aebcd0b843, 0x5cdcb88f8481605b, 0x959edd7398cebbf4, 0xd6946a5baa81161e, 0x242d73bb6cbf23d3, 0x2cc78902ef62caa7, 0x3cb040fdd73e3b,
+0xd3569a9d036d1356, 0x43618b0c41197683, 0x941bd4089e56be3c, 0x284667faaa991a4c, 0xe90926fc46488015, 0xa4bc18602ad3dbba, 0xc7ce9536af24fe79, 0x16c2de08625f59,
+0x5ee54c1ce7e4e6bb, 0x518893d19ca59310, 0x7c92872dcb2452d9, 0x4c248197608c4e44, 0x1e8580ce179ab2c, 0x106b2e07386ed9e4, 0x9c9b94bda66a901f, 0x255e668e951530,
+0x22e7b12e24328b0e, 0x1560e6a29b961de7, 0xd3b37aecf9546d16, 0x27329b486c6aec75, 0xe7d4583a368f1d64, 0x950909db923368e2, 0xa77a620c2b5d98f2, 0xb1543696c4c49,
+0x358bf3baed8b9175, 0xa2d9b40dcf787184, 0x30037d95707b77b, 0x7efef81bc31a5576, 0xdc27d4d37422cdfd, 0x69977c06d0f22e23, 0xb1485c638a853840, 0x3d7f0763bb8bb2,
+0xd9bfc36b1c597793, 0x26c28508adc3a871, 0xdb40b4fd7b09cb7d, 0x39c893809eaa551d, 0xbd1f060e965cf8fe, 0xe6fe6c2f324b610f, 0x3f72ae422d76af6a, 0x2709b20a7546cc,
+0x4527401596171b42, 0x1b5fcbb4f0e3b439, 0x87ef8b7028ea917a, 0xea6c605e92e74d09, 0x5b707b7683b8899d, 0x85f88b4070a3b609, 0x6b8b570452b42a00, 0x142aa04b6e43f9,
+0x7a1def9780afe703, 0xd0ce68de4831c3d7, 0xd039896e183b8114, 0xcf5707d9408858b4, 0x6c4e7dd536e41e8e, 0x5391c78503bf36d0, 0xf3c499693eb98cc0, 0xfcc4bfb7ff0b,
+0x650f74035e1c83b0, 0x15406166ab121fb3, 0xe04a281d0f89e341, 0x33bf340e24e57b07, 0xe8709b84c95556e, 0x76d11e9c4cf1a299, 0x5aad8d0506e08ad8, 0x2beb442ab36a4b,
+0xc129f2409b48c94d, 0x33a613b5a5dde5de, 0xf557af7e52545902, 0x5dd1a523eb0a2049, 0x739e3f508eef5020, 0x39adc65543b197d7, 0xe6822333697eed6c, 0x27cc16e5a379cf,
+0x4c5e33c0a541bf81, 0x6cda0af2a323a3ae, 0xcc4fc1358a3440fc, 0xe35258976dbdeb02, 0xb9ef3fb756646888, 0x471fabaf062de1b4, 0xe83eb0fc90d6cf8d, 0x1190c7d13869a3,
+0xa0137ebebce44ddd, 0xabf346b5af5e0d95, 0xd7a1053b802e65c8, 0x845e84a36c78c511, 0x4278f04019602cd6, 0xe71a5e211d45aa5b, 0x1a0516123dbf2a86, 0x1c59dfa56b113d,
+0x9e4d6db6ba8eb147, 0x490d8e3c4820ab8f, 0x6e7951214ddfbae8, 0x21925e952066ee48, 0x3a141c0bf3b5de62, 0xf61ff9dabe691c1b, 0xf9d0ce6269bcca25, 0x8117efc21d6e,
+0x5cb232cfdf6b45dc, 0x536d8b2e2279ac24, 0xae19d03348b015ed, 0x282e02850cada968, 0x26898a7e5bef8461, 0xf415fdf1b13a016e, 0x38a5c3e7ad6c821d, 0x25748058ec4025,
+0x48bfef303a3a7820, 0x369698de5b162035, 0x6cac90726b4f9472, 0xb10322864bb63106, 0x75e7c45ef23d1f07, 0xf1299d7e6ae8ed55, 0x785dd10a44d9b789, 0x2f5583f8880e81,
+0xe77c401e0afee5eb, 0x1a19949a66b06e82, 0xc9bba51f2889c058, 0x8191d99ba218e58a, 0x18b7c026c7d505c5, 0xe35fc8514feaffe7, 0x585e8819cae5e9ad, 0x342a90cf3e2be3,
+0xc07eaa9ae96703bd, 0xf67f55895c4cfa34, 0xb97630d992fb0ed3, 0x4ac46e380d089b29, 0x3415a97e1bce58ed, 0xb5a81f4265980f5d, 0x767408222ec026cb, 0x3ae6e72a6ea681,
+0x43f4ab49869e918e, 0xb87e696b5ff31f5d, 0x193cc9670efc3818, 0x45fb519c6c0f99c3, 0x11578c7d2af6f0e9, 0x82606b146ef5c1d1, 0xbcb5c1c340f63b5, 0x2aa7c6008b7233,
+0x9943cef4409926b3, 0x23a716a5483b6999, 0xfca78612a2b90580, 0xfec246341e3599ce, 0x9e2a5955ad178cda, 0x7fbb23c1e583404c, 0xe3d3ca77f431afea, 0x1a9b1370b402c7,
+0x2b8dc2c5b41bfc3e, 0x3642a4e08a57ae46, 0xf48775cf390ab5fc, 0xfe0d5c647b9dc3a2, 0x4c9946f2e7fd1c66, 0xcaee8f8d0b0b7be2, 0xf408e3696c1ba92d, 0x743d0869f4127,
+0x7526e84c1eb6a01c, 0x5e1f70a5a0eea074, 0x6733e7ddec9c695d, 0x3ef6f8a70ef29acf, 0x60a0b4a66c91fdd5, 0x938e4b25eddbb4b2, 0x32b8750756ba4bca, 0x2bde92b105893a,
+0xa17862e39cff8bec, 0x3521b75314003a0, 0x126654e3ed362695, 0xc8d7fdaa79222bea, 0x959876757a664c52, 0x44b0760c47f704f6, 0x2a05b16e538637df, 0x263b39c77e0778,
+0xe1be4de5ffe63961, 0x1da74f8e7727dfb6, 0x47720d332d7cab19, 0x1204e14ea33b6fe2, 0x765f857a0dccd07d, 0xdefdb2aa2a41e1fc, 0xf0a71f4c4480be85, 0x888cdfc290937,
+0xb2b036de9d127b80, 0xb28b0ac2ac67edaf, 0xa675a58f9277ed35, 0x55986079613e8c30, 0x1d6b4a5be06a21bf, 0x5665c6e6242cc580, 0xc2ffe9620c1c2ee9, 0x1fcec32791ff37,
+0xbd37767a2d96d77c, 0x7b47a4c85fc1ed9c, 0xd2e2a6de51ecfca, 0x65c8cd614d9587cf, 0x82cb9dd513309533, 0x4e52a5a9b54d871e, 0x8982d738adb49b6e, 0x34bb9d4a897977,
+0x8d79cc472a2d312, 0xf0cd62d15f00c1c8, 0x1bac3c54bdffda25, 0xe995b8453a4922ab, 0x3ae892b9526e755f, 0x6f1702879332cfeb, 0xe36783948ad460e1, 0x2ffa071e0fd197,
+0x8fac0e3559e1835, 0x6eef759ba02e98bf, 0xea7cba27e06cea5b, 0x77a297b066b2e61f, 0x7cf86f479f56d2f2, 0x5a5fe3efa3072a4f, 0xab56377daa9809b2, 0x2831be1d185cbd,
+0x7684bfe0ad303c56, 0xd8d2a37706deaee9, 0xf37e6fe8aa31f8a7, 0x2ce6505a812fdd87, 0x73a0d6eddf66d11e, 0x35389cf804692b5d, 0xbc3b8dbcf914e65f, 0x16609257dc2111,
+0x7b4425e0e165b1ee, 0x3e23159511dfc7ac, 0x9ae3a16dc1932f4d, 0x10a6e5c24b582dea, 0xf2b799b355091dc7, 0x3f78c92b83cd8f88, 0x8f2b20e835d13959, 0x2380836aa77eda,
+0x7a2057a14703f3db, 0x7eb841e8909aa12d, 0xabc16ad6c21541e5, 0x531ff9d2f193a970, 0x984f0593c41740ed, 0x737e8d1546930f1d, 0xda1d7ad1136d8681, 0x3a703ad2a1c86f,
+0xa531d6c0ebf127da, 0x27215aefe6544335, 0xaebc8baeaeb3ec64, 0x97c6babf8c0fb478, 0x5e5ce39f11c5910f, 0xf16337538e500adc, 0xbb91bc717c8cc668, 0x36f5dc3841279d,
+0x48db1524de0d81cc, 0x73d0477ba47cafd1, 0x4f56a3cb2a2370f7, 0x605ac45eeefacf7e, 0x2a115e8faf2c6a96, 0xb79ab76b03fc97e, 0x6f11304e799803ac, 0x512ee9d1b3b0a,
+0xd0d9067e92aaa6dc, 0x5a2ad78ce79f4ce4, 0xa91419c80465e323, 0x59af1023e41b7975, 0xda12f09080a4e917, 0xde8ab856fb7abb61, 0x54f25516edf04b08, 0x35c3962c37f81,
+0xc566aa51c105a6db, 0x716d2667f5cfbe64, 0x1b0256bf399e64f9, 0x5c0bf2f0c1d4010e, 0xed1d5d43e7f323ce, 0x91ee10da5af8fa4a, 0xc1f1c6d2954b2d70, 0x36227ce8a03e25,
+0x56110075345acd04, 0xbd359086a81dd1f4, 0xdfbfbb4fdff6d5cb, 0x4c28349656afc00a, 0x3ffa62afcf971e1f, 0xb885866db4c79050, 0xf8d250c61907dbed, 0xeb1fefc227b0,
+0xa784411866bc226b, 0x3c4380050d5595d6, 0x330f2c177ab3f4bc, 0xc70e489c6f811a1f, 0xc2e2b3c73d73525, 0xe2716b580b50e284, 0xa5be2334f81a6dba, 0x7b20ee1206810,
+0x352eefb7a643f0de, 0xc85d8af3bdc9deed, 0xc4669e92c95f50d, 0x832a74b9316025cf, 0x40ac22450a313f63, 0xbfdd2fb6241c3459, 0x301552c359e91ca3, 0x2725444f1cf803,
+0xa73b871caabcf4e1, 0xaf5081c598dbaf5f, 0x8c0270e66fa5b6f7, 0x9a82140cddb4f2c3, 0x255aa49f7f7eed5a, 0xf5a41c240eacded5, 0x9a7de53dcb861fd5, 0x281fe34067c7f9,
+0xd44984200f92c4f8, 0x32247fa7cec9a09, 0x523466a36a4856e0, 0x992ce403f4bd110d, 0x98aa56a82a15998, 0x278f7da132fdd144, 0xf1f14d5cafd0cbd, 0x33d2697d01ccce,
+0x4720cb41359d6c84, 0x96c297995e5d7ebb, 0x8987ad88c13a7920, 0x73c47d49fd0e7098, 0x96daf5b0cafc9ecc, 0x1d5a6c87f09f0d6f, 0xf54e4b337c32cd18, 0x2517e7c6aea3d7,
+0xf55c42816868b4be, 0x70947ebd506a3a80, 0xc1bfe31e437a6313, 0x357fd845db1d5f2b, 0x15a6d3f4ffa495, 0x957fa42a5d93e4eb, 0xae64ba9c98483441, 0x36eb627aab6be9,
+0xfbfa5eed78922dbd, 0xe4062c3e7ed6ba8c, 0x98eae4af2a3b51a6, 0xb20f7729e6727448, 0xea7eea4d44346106, 0x557ad14a4ac6681d, 0x27182d8405ee16d1, 0x3080e22a3ff98b,
+0xd76df00c64775cd, 0xc485d97a0401d9c8, 0x51c7d24f3081ee24, 0x1a7b69d3903d0cde, 0xe3567ff9dfb610f3, 0x6e17a82f413706a7, 0xc8dd1ee7d3987abd, 0x2fcd1de00c1598,
+0xd332f9edafa5eb8c, 0x9541541fb2b3d8bf, 0x2e784714db63ef2b, 0x8a180705c0afbbf0, 0xbd449f513c03b3a8, 0xce15a0eb39625f4c, 0x648acd7260a6078a, 0x25c122bc76eb7a,
+0x9763353fcae0a89d, 0x1bc6ddb26f9b891c, 0xbdc8c5d0a4da9bc3, 0xccd80b10f4310ad2, 0xe3cab0215366834a, 0x5b57bf313227783e, 0xca5e591a2e60832e, 0xad40cf471a28a,
+0x54d34e1cb0bd827c, 0x15ad58d07530bc1f, 0xe5113ef7fa6b3573, 0x960049b85c0fc2d7, 0x653539508c527ddb, 0xef54be512af074cc, 0xdcb5353e0e147516, 0x37f8421e68531d,
+0x43a32acc6479a4a0, 0x26ecbedaf65e032f, 0x1d861a7cc7c9c61d, 0xb6efe263ec91b5a6, 0xdabebb5c80070d17, 0x84a0aef480c1319f, 0x9ee3ec8a9e43a8fe, 0x1571d3725a7f4a,
+0x19f680fdde02da57, 0x57cc9e18c5e56d88, 0xccd0a54094e95be2, 0x628f2eeb29e9c895, 0xa3fac16a55815e40, 0xfc2802b11dc9f60a, 0x70c78d81ea84981b, 0x197af44838b8ca,
+0x52a72c751833ff53, 0x3f95e51a038f4c3e, 0xf39ae524748d642b, 0xb4444db641f31a84, 0x9d38e10e02728190, 0xf0957ed7aa657550, 0x666ec8d9e8bfa8cb, 0x16387a3b59cc7b,
+0xd106cb8d3ed71460, 0x452c8e49db520617, 0x4dc03ca94e3e8eb5, 0xff4d98484fbe0805, 0x490c0e1915a60215, 0xebf2af1099795347, 0xd1507c2124f055be, 0x17b916bcd8e1b5,
+0xb6c349df91f1e763, 0xb5a958d3767ccb24, 0x7bc9e84637a142ca, 0x8229e6b140de6e31, 0xc2fa881cb2af3e10, 0x964a0524e24d885c, 0x2d7d2ce2d3bd7502, 0x3410d3d9473899,
+0x7c5f477f11a10190, 0x62845490d375e5c6, 0xd879f5028172973f, 0xfa8681431b9b3c5, 0xcec36f578927b388, 0xe0cac9b33f78ef0d, 0x9ba0570a025161d5, 0x3fc817ade63798,
+0x3828baa5aa9f3592, 0xe9abb8e36ac023d, 0x742f81cb419a427a, 0x8aa2ac4d466790cc, 0x8578733edcf2802e, 0x6735e41bde123b0f, 0xd22cb60571415a68, 0x3ce67afc828f5,
+0x1a3bbd7bf9932178, 0x10bb0372278fc6c6, 0x8eecb551b6e86fb, 0x8b187c1ce7218ee4, 0x51d642fc6a87a07, 0x3f5eb059a44932b2, 0x59653fe10d1c7d76, 0xc44dc4c7b8afc,
+0xd6d57d8ccbe20f8f, 0xe7e8f7eb544e5107, 0x1097389c71bd4853, 0x29ce7e5e29e07350, 0xaba9a67a9cfd19bf, 0xb64e7ad75b5e0fbf, 0xd019a4058ee2be37, 0x2e6b80612cdf3b,
+0xc85cb887762087e5, 0xaa822838c59a0069, 0x116dbb545ce0bd59, 0x3b7effe1336c27d2, 0x9f96d00f99c7c0d1, 0xcfee574da9020a20, 0x757c764c1a0d8e26, 0x3705cce9f14317,
+0xa5e47425c43875ab, 0x367ae5a5b4aceaff, 0xdc9be6cfe56dc639, 0x25564700adc88ce, 0x39f9ab9c1465d621, 0xdd53a59971f2a98d, 0xca6b6687c302d02c, 0x184e471ac1ad8a,
+0x5080e9f335c9c349, 0xc31f8946838556fe, 0x15aac611141872bb, 0xcc777d2b6ef2c3d4, 0x2f1db4931cdbf4ef, 0xf0b86316defea031, 0xec02242aeb2e9919, 0x1dbb2dbbd7125d,
+0xa1b9b4ee408dd655, 0x55106a3b8451038f, 0x6950ccf46beb659b, 0x56eabde59ab81a56, 0x699553e782f737f6, 0xa7bcaa68ad6c5fff, 0xa0617bad903da4fb, 0x3bc41e6701037f,
+0x68f63a78c3d44274, 0x993284ac9e1427b3, 0x7d72b13a9c645ae2, 0x109e78b179399397, 0xbcd7e46e431d3343, 0xcc770c03259cf721, 0x7eab1b9be4167f09, 0x2780ff602096f6,
+0x7c954ac561003ebb, 0xae86161d7b325d8e, 0xcaba9bc75d1263ac, 0x6cc7d3f6fb60a8ed, 0x96fe1fdff193d217, 0x9f6d7eba97a917c8, 0xeade284ab8e47e28, 0x16749a7f1757cd,
+0x54eaa5267e86fe96, 0x759d4455ed8e0b44, 0x86e92f4fbca315a8, 0x15043f92c53bdf10, 0xeec8ba4ce7c54e28, 0x20ce1846fc5e1d3f, 0x9f82c0c858c012c3, 0x1f7c4467ccd454,
+0xc5528511cf1043c8, 0x7c3746ce7d544eae, 0x70b146fcce54aa71, 0x214614815bc52566, 0x4d773bd191d08901, 0x798a6cd8b2892b63, 0x39fcaf890c393a08, 0x23bab1eb6126d0,
+0xbae0b21e5930013b, 0x605066568e6fa5a1, 0x8469d8f671e02c37, 0x6c00b629da5d14e1, 0x121d49557ab50f2e, 0x74c63d5bd659e70, 0x809de545466c4216, 0x3ab4dc214f2c77,
+0xc93f192e9a876902, 0xb1d7a8edbb82cddd, 0x817591d3b71601dd, 0x292047b5cb0fbd4c, 0xdb7b84486b0fc142, 0x895fdd96f8eeeed0, 0xe12814e9c709b90b, 0x361cfafa2c9d13,
+0xded0f6ec49a62f9, 0x846133e73875cfb6, 0x649bee8359365074, 0x990c4f448be357a0, 0xe047b514b6718f00, 0x694c7f38b1068b22, 0x1d38c03f4f3e060c, 0x35acc1871de99d,
+0x2cec22cef93f02ba, 0x6bf7430c2f724826, 0xb3cc88a0a4f8b816, 0x5477983b6fb87df6, 0x335dae1442fb7163, 0x80c64b4939270390, 0x4380d8d1fc464c5c, 0xce131e7f26838,
+0x5d69fd6fb799920f, 0x4076197d6b70a7d3, 0x76edf83ceafefb31, 0x5829b068c4ef82a3, 0x64ba6b516171d199, 0xb9ecbf828ff9da39, 0x86bb8f12c3296c2a, 0x2aca5444462c5b,
+0x4c6002b5f4222f8a, 0x36db2729a5444d5b, 0xd824fc38fdd8ee2c, 0xe9349b3bc75fe445, 0x5f6f84a1ac5818bb, 0x8774f904b5be7577, 0x35bdf007a6275c05, 0xdefbb4101bf45,
+0x6425a3b4e83cf6bc, 0xb6895a52053080db, 0x7098dec294075e74, 0x119788a0756e7310, 0xeea70e876631d50f, 0x48d630198b63e0bb, 0xd826c044fef21603, 0x17e8f800001a02,
+0x32bbf391284d1387, 0x11cb90413e07f3ea, 0xc21b66e54e952078, 0xd084af3081b48712, 0xb2fd962b9a3bac7b, 0x7e3339109aabe029, 0x958e349b04cbfd3f, 0x1c3d80688bf593,
+0x9dc9d1898d632084, 0xb94eda89e453b432, 0x3d05991a0c7c82aa, 0x38835e6436d8897c, 0x13ca7dba6de49277, 0x7a4870ba96143c96, 0x6e4b4fe4f4d6fb29, 0x26cb0d639f138e,
+0xd0556637abf6002, 0x7686f5623661dd29, 0x8554798464186a65, 0x77167759d5cc8c6a, 0xa341abb458442601, 0x2ce67f0f2d43630b, 0x8130cdaa0b58797c, 0x8f15008bad71e,
+0x4bcb5a7531eaf984, 0xc80007e7c85fbf43, 0x5943d3debd87af9, 0x10b1b1e8b17598b6, 0x544e544fea295b6a, 0xa6556b4836804ceb, 0x7e62326d5cb913b8, 0x203d08cc96410e,
+0x37754363cc36d8aa, 0xc767118e4ee1c2c8, 0xd6204b69fcbff116, 0x432c1c4d508470fa, 0xf7f49897f3e4be5d, 0xbce853b403ee15b8, 0x5f50b9f9fcac2965, 0x11350ef84f8ef1,
+0xea3a3f1fb67a0cee, 0xd4016699f87a294, 0x3eb46031c2c171fa, 0xa37c66d69bd81665, 0x6dbdd5d19701145d, 0x8b58a69c0251771d, 0x4237f35bb5f35e9e, 0x3d89a7328f91e2,
+0x6a62816d1b8a1528, 0xed51c04954a133db, 0x607ca611bb10addb, 0x65f46f51b5012805, 0x90cd849b6cd89b95, 0xe293c5e274e8af94, 0x343c5a3b610b2884, 0x4ae45761d1d5e,
+0xbca5d9b298949f98, 0x6c37613d26be04dc, 0xa1ad4a0159ae6fe3, 0x21b9e2c9425e5a4a, 0xede3a4405543ab1f, 0xdc6dd2b75df1b0d9, 0xc08de187cf5edfae, 0x17dac2d405a261,
+0x5d356aad587df825, 0xfe2347e455b31fe2, 0xbfb3918adaf72193, 0x4aa9b2f8bf1340d6, 0x33650706db3a64ef, 0xff863a84089d21a5, 0x9b83c7156c9e8819, 0x5b738b08fac50,
+0x7b1dcf1712c8e1ad, 0x310bace1336f3fbb, 0x758c55a2109e290b, 0xe1219842b36f6343, 0x3cc981e7e811c66c, 0xb4afbd5ee10fa572, 0x57c81c69e720749c, 0x1f0785e3c2ec8,
+0xf7f5dfa85fc4e9ac, 0x46d76b3809835921, 0xf68bbc6c31c832c9, 0x35566586b1e8be1a, 0xee8324ff6102110c, 0x78b0819780976bdf, 0xeda73a3cee0d0cf4, 0x1bbc570aadc901,
+0x14d3e2aed0c386ec, 0x8063dfaad5a3f2a6, 0xc2397226e498cfd, 0xf56505dc5c076494, 0xf0e7a303f1303268, 0xde6bda4f411f6cd9, 0xa7421effcb0a67f3, 0x315a45041055fa,
+0xbabf67f0b429a721, 0xb245a3f4c089bd8d, 0xd67b4997c22671ef, 0x2550b80dcbc87871, 0x2f1b7bf4e21c71a0, 0x4fd339e47cc86b1b, 0x76e32d7f57375ce2, 0x2c7f58c49e67c1,
+0x30e9e106c5296abd, 0xcb4f0c98628d1d21, 0x9dce380600f296ba, 0xc7a83931ed47ce18, 0xb7c244b66f8c5c0, 0xf81164b2f0d663fd, 0x36ab29e3ad214cb5, 0xe9076890c9c08,
+0x3cecb0396c5abe8c, 0x504dca6c095e727b, 0xe78db5fb567193f7, 0x89ef79f81cfe798c, 0x8ba5a13dacf19cdc, 0xa14051dd4a2fd8d1, 0x6255eae37a8fc2fa, 0x2ab9b92d3bf928,
+0xe2bf918fc74ec848, 0x52062f3da7c8a6f5, 0x58386094259b625f, 0xf4a533adbc3b1e08, 0x5b2278b84e0fafcb, 0x97f762d166606c43, 0xd2c628d7655429cb, 0x21c2565afef8f3,
+0xe17fef9c82a1b3ed, 0xd8dff1004ccff8d2, 0xaf277bc20656b9b3, 0x4532c862a1362014, 0xfa14edf29427f4e2, 0x45d29e2f7e1f42ee, 0xbabebbd8f0c24264, 0x32998c9af4ebba,
+0x3307f72272c4dd56, 0xa98e6723ba205571, 0x2cea98995423e32a, 0x6c679224d3862a5d, 0x7ec63c5eb2bf5a4, 0xac91f55b51dba4fd, 0x6faf3d410a2779f9, 0x237041dcffa004,
+0xd73106441814a204, 0x6a3fef11e3f31e3, 0x98264948e8e9a3c2, 0x7e64864827f6f6a3, 0x22e85b97bfc74387, 0xbe0904ca8477887b, 0xf6d2075b14218fcc, 0x1d0b26030f4758,
+0x39382851b620cb00, 0xc42e230577a47a90, 0xa808371d97ceb451, 0x710e60d86fc992cb, 0x3c9de054a0925083, 0xd6bc67645c96b9bf, 0x9e24ca585f0d8dd9, 0x3c1104f1ae69d5,
+0xf3a24cc876f2a892, 0xa792e19c8e6d1f47, 0x6cb6897d43e3dd51, 0xb6f2330e9ea9accf, 0xf6fc2dece4f59148, 0x9b496973525318f1, 0x479937650c894b9c, 0x337d378791392b,
+0xfda9cef695805247, 0xf0e6d808d267bf34, 0x2c994cb8e9a8f0af, 0x88dde0d9389b6754, 0x4d5b48ae367d3b45, 0xe10bb70d5bf4a609, 0xd1c9575ea26868bf, 0x2daab046ff3034,
+0xefd20a46822bb253, 0x3c43b1693b9f7750, 0xe83ca0444d69c62, 0xf4e7d7c0e3e1f2f4, 0x5e3f21971d03417d, 0x8bb3d87787ac4c0c, 0xeaede33b4ac23b27, 0x128854ba177d97,
+0x69b252b125b46adc, 0xc368060094395f29, 0x7c095ba7bf7f227c, 0x1c1d6efff4771575, 0x35a4ce373eb659fe, 0x9a037f3f83c893c2, 0xe4d2b17983307da3, 0x5db30ffe3f3e7,
+0x3758657ef9f57d25, 0x4bc0a1e441723ba9, 0x6c6906c0a4525707, 0x132b0c9f8365045, 0xe8929a1a420f7f02, 0x76211ffd3a1cd182, 0x789cab68c968c6e5, 0x3daf0af3be9d96,
+0x12f1e92aed0314be, 0x3e6651a7f5f7a6ce, 0xba86d4165631e6a2, 0x40e4461111d7f6bf, 0x95c9561906a5b4e9, 0xcf12c108e06b0d88, 0x5da3b6ad8fc33a20, 0x3fd4d78ff289b2,
+0xc9a28f8964c6dda4, 0xd33efeae5f84b8d7, 0x234002b9f8e8c362, 0x2e1b10063f128124, 0x65e8d28a3d8fba4b, 0x494294532a1295f5, 0xb77bc3ec834dde5f, 0x1cb462e201b5c5,
+0xd83c84f9ba3274c5, 0x33134403a0baecd2, 0x1d018f8a46a54dca, 0x2767b9543ce6d9e7, 0x5928d102828385a2, 0xbe8b1a8c30367224, 0xc0cb4c0e4ffbf7b4, 0x319a624c631630,
+0x681b239c0a709e3f, 0x556057b42a5776ec, 0xe29e7e192acfff95, 0x4f51d9323459f839, 0xfd1a279a8e68869c, 0x8aa7f4387ae7eaaf, 0x81326525213bdc41, 0x14a523deed92ef,
+0x9cc55acfdf254700, 0x362f562c2b8c7a8d, 0x709e53f005bbf06e, 0x96822e4967c583bb, 0xb55b22c627b45b23, 0xf3b80e3bad90aead, 0x578323721522b457, 0x2f55a8df2e444e,
+0xb04b082eae0963dd, 0x8e5fb9b3bd80eaa9, 0x926852ebd9c787e6, 0xbdd4c7c33f91d7a2, 0x426f225809089970, 0xd24da464be5d33fd, 0xa53be668f1411a16, 0x203f9b429769f3,
+0xcc9d08dd7d539, 0x1ce994c33b56fdad, 0x7fed10c284f926a0, 0xf6ba6658a909ad07, 0x7c6a4d9df04aa04c, 0xdd6a6e705e3cb55, 0x454af3f5d353d5f4, 0xde52ab6c85a73,
+0xbbfbfb3535ed7159, 0x60fae4eda8449a63, 0x43959b9c46cc5b2a, 0x88de39efd2c59ea1, 0xa0ca660ddb07ebdd, 0x92fb82a9f7c03540, 0xe80a6db9586333fa, 0x279b12aa564ca9,
+0xc41db345b80605e8, 0x8ad139bc540e5f6e, 0x803eb9da6afdee39, 0x8821790efa10576d, 0x62d33a1b5d86e99d, 0x97d5441bd11a2a08, 0xf823626af0de4f8e, 0x16c5b4894aaa23,
+0x81455296771b1f82, 0x394967f8b390298d, 0xd4f3f5eeb8f3d6d1, 0x31863024c6549203, 0x78ea11bc581b52b4, 0x942537bb93c98c3e, 0xaebbb2aed1ebcf7a, 0x2e316450c8ecb3,
+0x41672d8c425d89cb, 0x85cbe402e8bfcb60, 0x86009e3d53f54c0, 0x37a5c585ea270fe8, 0x9eefe30c25d3f335, 0xc7d3b58899a2d16c, 0x3eeecd827f33aeb3, 0x3e97667fcb99ee,
+0x5982af673b000ef9, 0x1d3e9fe43aeb943e, 0xdbc290321154f61a, 0xdab6d1f36adbd337, 0xcdb6343b33e0d6e1, 0x50366a980a470658, 0x98692e00014b4172, 0x1efa4a16b1e333,
+0x69a1256a47040d0b, 0x424272c9702d68b0, 0x1fa23db2a1bee8ee, 0xb8f60d419aac8d85, 0x45c9521c0ba9e896, 0x3595d0ab931f347c, 0x6b33c8a1105dd475, 0x14304d720758f8,
+0xaa8d787d097c3d8c, 0x9c010695ea1b28e, 0x4bd5072c2de277bb, 0xcdad92cf105c272e, 0x166b5bec919494ab, 0xadb84ca105eca5cc, 0x811a3f8cbf3c8bb2, 0xba40b90ba87a3,
+0x8a84516494275f66, 0xf1891af88b7dc942, 0xd975784c32d4e285, 0x12ab0a8865e1f4db, 0x67a185e69a60b64b, 0x65e8479a706b56a7, 0xf8b8e72bed56689c, 0x30ca4bb4389a50,
+0xf7820ba9b49f8b2e, 0x7a9fd438d4dfc2d0, 0x3b9fdbb014ada052, 0xd8cc1c51b1e19dce, 0xc1b4fa6456a6ce27, 0x37432536db7a495c, 0x5ac11699e3456c36, 0x783cd3f2ab447,
+0xf35241f01bb7013e, 0x4670ebe96ee5cb42, 0x9f2bb6e9fe57995a, 0xc0e752933cdb96d4, 0xa5fecad79421250a, 0xe3449bfe59db7aed, 0x869247e992fbc710, 0x886261b892e5d,
+0xf5d58d6f60265829, 0x5625e49b3735ad12, 0x748782a22326e0f3, 0x3fdca1a807976ca9, 0xfcd43c414b3df809, 0x2aa2d6cd7402a91a, 0x6f89ac7c0478646, 0x3422e2253e646a,
+0x684dc7624445c185, 0x423492c7ba521255, 0xb719b40ae68af543, 0x760922d8b0e7d418, 0x2bddaecbc5b0646d, 0xf4e1118498a4ffdc, 0xab6e2f352a6b38e4, 0x4a7fdcdb4e8fd,
+0x58623b4354d7de22, 0x9608c3433f683ccf, 0x44aed930405f72d3, 0x7cc86151ac7f056c, 0x3abd87e81947078f, 0xe4ef3013f3621893, 0xfe05b221c76b9f72, 0x3af13447bfc881,
+0x43e15a5eeca7b156, 0xc2acaaed57446302, 0xf2d62d60947fc333, 0xf9e349fd6122d443, 0xe8648c40f2345db0, 0x99167eaf7bf2585, 0xfc962f7e3c50ae00, 0xe91b720984513,
+0x1846fe81b2beea4f, 0xd1b8a3cacff2ebee, 0x27a6c160d1228c3e, 0x1d59ab05efed9d05, 0xfa9a0d1317553c92, 0xbd52008f79942a95, 0x5f825824dbf46e11, 0x816af69af4882,
+0xb7dd61e2a35d2887, 0xe581138540d8d18, 0xab86a26d1f5c6079, 0x442491cfc515763f, 0x3866e5400dfc533e, 0x5256d81e9fde55c4, 0x1358b277515d77bc, 0x1ac67c6ca3af51,
+0xd2fa60c227c1873a, 0xbd2b95d031efb1ae, 0xaf707835d5c08c4a, 0x40fe23154c730b82, 0xc86a204dde8740c0, 0x63585f28313c9427, 0x80cbdee8d5d1bfe0, 0x14525875054e63,
+0xaf06bb7cd39bbd2c, 0x7d88eef1f6b78aa1, 0xa24c96d0b614d6d, 0x401d5517a8336cbe, 0x1a669e78c13bf9cb, 0xcd72f60314f38d39, 0x6a2559fb41256bb6, 0x20a718b2a2b313,
+0x3340e78c02c315bf, 0x3c87ae4b9bd9a07e, 0xf66db82f46c5072f, 0xf9b6184db688f813, 0xaaeef8b6012c55be, 0x3f0ac54609737cca, 0xf44831dfce089c2d, 0x1b00c2a8d113ef,
+0x3b4f4e928d56fb51, 0x8738dd122c78f6da, 0x5b5e1ab08fdbd841, 0xfe63bac49bc9e3cc, 0x6287b13cafab0d3a, 0xe91ef97f43555860, 0xcda905e8606bcec, 0x118d829eafd157,
+0x1920d9143382ce7c, 0xa6258f8fb0484e90, 0xc86af2d906df64f1, 0xd8ee7752beac8913, 0xd9fb49f00dfb64b1, 0xec20d868a6c91787, 0x4359d6027811da66, 0x308dd398138f35,
+0x3e82959450fad176, 0xf776066fdace77a9, 0x9f342c183834083a, 0x8c2b9a09035cf984, 0x7af6f39b69a40738, 0x4ca640df2c6093cf, 0x303e887731383d59, 0x2e90ca6f3d25a1,
+0xdd9b6dd5eacf9e6, 0xaee5fc2117aaa470, 0x77489a6c5a57072c, 0xe26d5edf047d2812, 0x692778a2dbee72a7, 0xc3d2732e88f00a7c, 0x534fba2ade095988, 0x1c75f5f04d72f0,
+0x55e3192414463382, 0x9a389657e8a230cd, 0xe0e786a2831185e8, 0x526310edb770d033, 0x9567b3322458c446, 0x56e5cce7730385f1, 0xd6376e3b93e8ea11, 0x10680b9c8d6c2c,
+0x991b9bc015c7a483, 0x6b674d680b6d6c7, 0x5da9a651f226344, 0x9086a1cfbcf93638, 0xe4d54b71861411ca, 0x535a1385cd2603f6, 0xb1fc8022640115c8, 0x1665b669802af6,
+0xa0345ffec8514fc1, 0xe1a8935f3889f45e, 0x21e87b5bb6cc5dc3, 0xaaec0a5a02057c4b, 0x91a4d0208d817334, 0x3b9b6e9da9e55266, 0x127c6e560ef9baf2, 0x19aaf21de659d7,
+0xe3739383737a5efd, 0xa0e349411380b5e7, 0x874b158e9a2f09d2, 0x7b4409f8e3c08c5c, 0xbf809afb22f2fe4a, 0x62385b0331f5b895, 0x3cdb6d70be7b5f64, 0x264aeed5b6ea87,
+0x602a5354193cdab4, 0xc02ac755f2e433e8, 0x197704d0d242eac0, 0x6c9d998c6517a98, 0x3148f4e958b371da, 0x7927cd5f35eed78c, 0x6baa9115a94d8f5f, 0x382b7216c7f0a1,
+0xa43b30402e168e2b, 0x41efdae13d1ba659, 0x27623b1c51ffb8c8, 0xa6297763e56ac927, 0x88e4599c695c7efe, 0xb0e69858ed63f1e6, 0x7412a8e37f60fb13, 0x6784017637113,
+0x647420061023cc29, 0x5a53ee21188761b5, 0x71180d88b1a67b30, 0xfed48c2f49b56eca, 0xde9b0c76bd448667, 0x890391788e5a62fa, 0x550f0166befff210, 0x108d92031c1e8e,
+0x780bb6376dab6594, 0xea4e2243f07f2b5d, 0xb3840309c72e181d, 0xc22c5dea3993af47, 0x681e32bbbe342f87, 0x1a0bd7600287df0e, 0x616edaffb76e3b38, 0x2b6903ce0a3505,
+0x11eaee9853e18aa4, 0x7850b3ff4d3b50c8, 0xee522478a6d9002b, 0x6c32b54ddef93f4d, 0xe3e72c264de23ebc, 0x64751ca30a5d4636, 0x5f6e913818e8d113, 0x4d2cf4f0e9bd7,
+0x883642d01dd1a862, 0x540ca3c4a6830029, 0x19884eab0c240f7d, 0x6d230faa4bd5bd5f, 0x947cb72f57b00529, 0x8a404c741c9e9b0b, 0x5ed9e8a44febfc57, 0x2e12238079cf79,
+0xc367d0dd3b32062e, 0xf92c43f055fabc89, 0x4eb662176e48017c, 0x7531a0105944955f, 0x9615cdad0c3115b1, 0xd919d3020bdeb507, 0x87717af71b49aaa2, 0x245c7579f6e8ff,
+0xf6248f2f6fbad531, 0x4bd475bc59af78ee, 0x59dcf1989599d49d, 0x26d1932bf27dc5e0, 0xd38dcd086f857849, 0x63dae2c3ec1248a4, 0xb7bf40a686e4c35c, 0x1f9e7dd62b1dba,
+0xc46e2b094f2702a5, 0x74a70955df27f404, 0xe2d8f4978b6c93a7, 0xa84f17adce22612a, 0xbbcecda34150c89, 0xb32498913c96e4ab, 0x455d1cd9d062a073, 0x1ccd33b89943fd,
+0x6c67892b6a4441e8, 0xc01e8c9e10ff60d7, 0x34f6d29fb052a797, 0x98188a78789e9b7c, 0xb68c76667e6901d0, 0xf465d2e0eacda4e2, 0xee283afa34ce8a46, 0x37b1e1cbeb473a,
+0xce1db641916926f3, 0x66a37c384a5456b7, 0xf9ae7f1bd11c8502, 0x924ffef9f38c811f, 0x9d153e0c203531b8, 0xbbac8503ff2a43ee, 0x8a72be11c0cd1c07, 0x2a75adf4946be1,
+0x534be14c392f4b94, 0x6a28fe16c6ac4a83, 0x47404c65ca94e4f2, 0xf7c45d39e1b2de55, 0x97a2a81ba863267e, 0x74d4aa8a303a13ec, 0x2eb7aa0c34954767, 0x10a016eb27c1df,
+0xf2d6cf56fd004020, 0x77adca9317d29b61, 0x5ff57163e23ddf47, 0xe0fb104bd97f73a7, 0x2d3b95ec3ccb2de8, 0x67d825d0a6f741e9, 0xd5d61532821a4f82, 0x3858865b5a11fc,
+0x99fa5eaf3b9b1c93, 0x3e50c3c814eec8c6, 0x15c1819a12a28dbe, 0x1973c020b5fddd5c, 0x493fdc92ef40a9e2, 0x6424085351a43ea7, 0xe122075ac218509b, 0x2a49c86ba3baaa,
+0xb6b2af5523700f0b, 0x4cbe54245420d511, 0x87a83cb2f4a3e7ea, 0x10a147a24dfaf662, 0xd9b156fae7f18bf5, 0x2fd21557dd3d69d1, 0x2a9605383fdc686d, 0x224ca009240156,
+0x2b77b46a5c297673, 0xa76186d23eb90f8b, 0x49bf0018b9770bb9, 0x164e60d0c623180, 0xf1c75c9000d8408e, 0xd641593dc02977a4, 0xc98116e3b068b6a1, 0x1ef739d56e946e,
+0x7e9d5dec8ca13fd9, 0xb023fbb187a6b87a, 0x6eae158c6fe8d47d, 0x78876e510cf959c5, 0x5c8168f2bdec13fa, 0x370efe056e6d38cb, 0x40d1adf1eb1fd8b2, 0x1ab9bc90758ec7,
+0x7783dcfc5e41b2ef, 0x9e4637aa609c6c78, 0x29f1818ba2677720, 0xc2193bc24a42e8f7, 0xb9953533699fdc77, 0x4e2b836cf8b4dd11, 0x931f4c20047070a3, 0x1907585b6cf65b,
+0xcc3082679f09fbd0, 0xd7fc0f7c623a9501, 0x17bf2fe728874d60, 0xb77ec2f87fbc403d, 0xc45666ef38264b9a, 0x17093f85997a03d3, 0x4190d3f725bc779, 0xcaaba9931bcb,
+0xb7906280d9067cf8, 0xeeefff867bfc23af, 0x8d504191a6d92dbb, 0x9cd014f0fa8429e0, 0x743581cafc2822ae, 0x8eba1072b6f29bd4, 0xbb8d9677ca26094c, 0x371549466fa8f1,
+0x27dacf79e0ac9bdf, 0x625db3527d7abe18, 0x3f688b3115f1c677, 0x1b7a316909768a, 0x17f7e9554ea2d10e, 0x3d3b2ced18d91546, 0xf340ea8117f105e7, 0x14ae3e09e4032e,
+0x15ab80cd4d7ae291, 0x8d03e32ec77c425, 0xe9a0e2e57a404408, 0xa67012ea3e7338db, 0xb305339156e5ebd2, 0x9c8efeb52e465d3d, 0xe1ff99eee1931a6d, 0x1690630d829d98,
+0xdbc83776abd6f885, 0x544278eb19f9b3c4, 0x4e30961a5bda3293, 0x10bae885baef541c, 0x1ba8b82a77c190ff, 0xd51c580200c6526e, 0x124b3f4867ab2d03, 0x1f4890b8e0085c,
+0x7defb50d32a2bd28, 0x57204e151afb28c5, 0x39f9b857ffce828a, 0x39997c9e58ab9ad8, 0x76483010a3df9e7c, 0x65d3f9428196ee4b, 0xdd128886e0239899, 0x12e1e2db473c3d,
+0x3431be64e71e4d67, 0xcf2d9ab6fc402c48, 0x844029d9d19c21b1, 0xacdfad192ebdb524, 0xbf18748cd068b831, 0x35b5a10f02d85f35, 0x9db5ac1c465942d2, 0x444703d65707a,
+0x86d8e806fbf795f0, 0xb2975285dbf822ac, 0x652b123ec1628f12, 0xf3e6bd2e9cbe70d8, 0xfb0ebc35c6b5d2a5, 0xf52bf7604906dd52, 0x967356a75f986368, 0x218ff757f345d6,
+0xec4b93ec9f211720, 0x8d916ff8b0d9087c, 0x40754e098cd0be18, 0x39e8311631127775, 0xce513dcf0dd0c404, 0xc519324f1a280e5d, 0x49380ddb94f3b337, 0x1263b6013fad70,
+0xa68cb41d2471036, 0xda8b077248e8867d, 0xc25a25459af5814b, 0xba1375995ca2c504, 0x2b5e1ae4c116c6d6, 0x9194493f3f6a7c14, 0x1b3d0533f41b4edc, 0x22af7c5cd09445,
+0xb40f84eab3b987ce, 0xa31ed861b079f36b, 0xee62ccd37ee89e66, 0xdfd7ae1f67541cb6, 0xb9c67e0f5941cf06, 0x7161e43786e0350c, 0xae2ad089301889c2, 0x4f70b19e60074,
+0x196546d4383ea95a, 0xc3d1cf8137d02720, 0x265eb0eb09eb0d57, 0x69b7f5e1a0cdea09, 0x283eab5c63043374, 0xd60f6b0ef3e5dbc, 0xa75bcd542b83b97d, 0x2ec6faf38ac824,
+0x252826cb1a2131ea, 0x6f0cfb3b3d518b7, 0xb2b5753753047467, 0xf902000d405ac1d1, 0x173eb24219403314, 0x298881eca41e171e, 0xda96af6912b0dad0, 0x2d3a3a4dc86d7,
+0xc5d1154c50092ee8, 0xfc744d2f2f2bb1d3, 0xfb63f0c4faa28511, 0xf428d90cd5f739f2, 0x2849435e839f96a6, 0x8883134f56fc7376, 0x6ac77ad59d74fba2, 0xf135a7f94741a,
+0x283a881d03f15bf9, 0x155b713c950508f2, 0x1167db27dfb06bd4, 0x26986218e479eb49, 0x46b38af8e6bdcb67, 0xddf51fc79798e5c1, 0x6d26d5859a8b290e, 0x1f3b7987172835,
+0x43840f70f553bc9d, 0x66a1bba27b1d1c81, 0x3eb5e5a78968d3ac, 0xf96b52367e6bfa5, 0x5bafe16316fb95e7, 0xf4cb21134b8f228, 0x95da8d0cfabd89d2, 0x2d47d180da397e,
+0x64d3b0c95fc1c29b, 0x1453c5fc14b3736d, 0x2a9f2981a800e7d5, 0x4ae9178d34a9132c, 0x6ad6681b166d5369, 0x21df4646745d7ffb, 0xf3b1d18b179cfc0b, 0x2a9150f2614a6a,
+0xdb3ac09a4bcd2a0d, 0x315017432cc088ee, 0x9348f985f311bee6, 0xa64197046c80787, 0x3bb667b2060878e8, 0x1ecb051190a0a377, 0x9aa5241b4a0979f1, 0x1361938507870b,
+0x35fdf69f93b84ab0, 0x56bf70f8b5405d10, 0x82d8b37392eeefa7, 0xa6c5cdec6cf948f4, 0x6c4afc0ec2936cfb, 0xbf34ba30ac07e7ac, 0xa334b1c4d47dc066, 0x19f090d22891c1,
+0xba9dcc480839ccfa, 0x61ff773d8ac1fa7e, 0xde4eb346ba257cda, 0x59cdeb6021fddf16, 0x1666db2ec1a286d7, 0x817bddb8a6018a00, 0x50cc1455beb618a5, 0x2bbca099f956a5,
+0xb293188a1140b924, 0xf3ec96ac048b33b2, 0xb4ff0b97aaa97266, 0xebcd22f596c12172, 0xcb344769cab2b786, 0xdbce9c45d2817371, 0xd9d5817630da0c1e, 0xde573b514cb99,
+0xc5f8d437151e45c7, 0xf5da0383d96914c4, 0x4f47caf28929e2b2, 0x7c896b927d65e6bc, 0x3d682b526de9706a, 0xb82aa77c3ebefec5, 0x9c6932aef5b38a7b, 0x3c888ab13c474b,
+0x38ea338ec73985c5, 0x85d3571dcdfca018, 0x8cda6d8806b45b5, 0xbfd9b4c39363b124, 0xe85579905384d4c9, 0x8e42e0bd3b30aa4, 0xe01c86526d5b4ab, 0x2ba242c096e697,
+0x8e8553b94ef0aa4c, 0x17585cdf714abd2a, 0x44284d56844e2042, 0xb17d3c5584596127, 0x81b3e7e3509201cd, 0x1c7a6645ca03eb19, 0xaf676c9a942b6e14, 0x178ae6649295b1,
+0x5f508c570a1f63dd, 0x39c59a5fb45636c4, 0xabeae7b5a1d4249c, 0x2f0357d3e7928178, 0x74b2c29b02444a21, 0xad1b1206c694e871, 0x9e4450ead4da133a, 0x1db062bb116aa7,
+0xd6ca04f7609b8df5, 0x85423d4a72a2dc06, 0x48f09996c02f5047, 0xb0e418756eea9a7d, 0x4d8cc008e6150f25, 0x70bcab950e0c0f7a, 0xa20e2cbfaea95319, 0x3129f72b444ca1,
+0xb31b0fe5cde353a3, 0x360a2007445ba852, 0x1c0530949774ea16, 0x88466a9138167dca, 0x5f1008875176afa5, 0x9551b33e42a698ca, 0xe540a80c336fbea3, 0x3d8bd08bdadeae,
+0x14caec1cf37ecd98, 0xf0da3baced5990df, 0xf27b7be99d2261d, 0x11f88ed53565401d, 0x5bfeff0d07a62742, 0x83e7ca383ee8f751, 0xb4af78fca21bc1b7, 0xd65f6b5fe1429,
+0x6f9e4aad01e6a18f, 0x6d2af2557d8ef157, 0xc9a2f6ef6cee8238, 0xbb4fa32b9e4aaa34, 0xe022406e529a337d, 0xd373602a7aab288a, 0x6c32d33f595fe2ce, 0xaf57e80a4f20a,
+0x5218957ba2bf1eaf, 0xab426e55ab30af73, 0xe468a22e533fb22b, 0xb40333411d060edf, 0xaf3ca9be7564f02d, 0xf0ed1b1746f8c93e, 0x58bd03cb9971df1c, 0xa6cef8e52d2ad,
+0x731b957dd61a45d9, 0x458eac690e2ad0f9, 0x5d3d2edd8e0481e8, 0x115327cc79f2fb25, 0xe32aa6b498431e15, 0x9f09946a6458af7, 0x8f8ef6bdf5cd5baf, 0xa0d5f929b8f06,
+0xd568b869534470d2, 0xc6a219f0cc420ebe, 0xe226e5541f415ce4, 0xd4d8ab3d575b16a1, 0xf704594c77c1c27, 0x8362ecf87df0226c, 0xaed88c1693c116a3, 0x2762eef490c32f,
+0x426823b9bc27aac4, 0x4a21e54a8464f589, 0x136d418c55417385, 0x79d56039061f2fa9, 0xb9c780b8d94932c3, 0x582b43d26a774b42, 0xb33c668f676afbd4, 0x3f4764ecfb97e8,
+0x7d4cbfcfbbc0e27f, 0x1a4faf06f6ff1830, 0x73c454ef62c8c58c, 0x952c21435175ff16, 0x2d436f56bab6a05e, 0x557d4cdf609b0684, 0xf44ee3e21b86e0d6, 0x14fe731ecf34a,
+0xc6ed6a22b20f8789, 0x7f484f84c4ec97fb, 0x1cb7452555c8c80f, 0xaaa0b983cc00968a, 0x7c194ac4b6e49349, 0xd0cbdb281fcb6022, 0x64a9388f71752c0e, 0x40403e8fb2b639,
+0xdc22b10dbc0dec60, 0x54e86e768cdd4d96, 0x4c7396eb07ada2d5, 0x269a86944ef2c544, 0x3f4d6bf4b0cfc40, 0x4690f3861a58df7a, 0xd2b191209791ddfe, 0x1657256edf3a61,
+0x84c089d3c270298c, 0xec27f3e3491fea35, 0x31b6737f72cfe394, 0xdef3ea3abae42152, 0xae720bb63c73a630, 0x36d4e1533f4627f9, 0x54dae5549ce52b98, 0x3c8b7978675540,
+0xab102fe83a47700d, 0x6c2f000d9047a37a, 0x4ae0032b65ea4092, 0x332308ff1ac45fdb, 0x8dbfb3e919956a1, 0xe92a88074c510eb7, 0x33c24e0c4ca411a5, 0x3fef07ddcf479,
+0xb4145e9219aff13f, 0x1aca0c06a0e178c, 0x6384f87e4bcc1e11, 0x4e9c9adef03ebd58, 0xec52ace22bcb324d, 0x8e2cc2bf70a8bf46, 0x3d85606a064a094b, 0x2de674c3b9052b,
+0x1fd1eb9557e80ae1, 0x11560c8faf4105b6, 0x78e1f582e29c0cd2, 0xdd0b143407704e47, 0xbb8fa4eee287e6c9, 0x7fce68fb6a13aacc, 0x8b7e0cfc56e741d0, 0x38248a69c52e1b,
+0x819930e976ec6d43, 0x6ecf2926dbf4e43d, 0xf5a35d99d66130f1, 0xed5c75a023bd8fc0, 0xdde72bb009f23e83, 0xe110d3d6d3475127, 0x5d7c995606fd45b2, 0x1e2d84d243559b,
+0x99ba929ac3c63a33, 0xb19ff3505d5113db, 0xc79ff625d4297de6, 0xec82b29148a859d, 0x63c25286a255a1b7, 0x7b956765c167f5e, 0x83e625a6d8e0048b, 0x2e44c51b249f65,
+0x5950a9f41c2b45bf, 0x1f4c3b7a19d1ccd6, 0xa83a0cce04b8b5f7, 0x8dc0feba8b63acfd, 0xf5481a9241bad360, 0xdfc0c4220eb47020, 0x169f939a4476b9ca, 0x3a4b05213020d2,
+0xf0982d8883d7b70c, 0x8dbdd2b14dfe51c8, 0x9e65888c378f68fd, 0x86fd0621785b46de, 0x39e31084eb5edd68, 0xbb8c5e992cf66aab, 0x9fe7d2bd37c31f0a, 0x25a73c9efec41f,
+0xd7298593641078a8, 0xbfe7d9f0a55bbc3, 0xc779cf97effcab0b, 0x5c45122f548bcc41, 0x7966264c5245b4d1, 0xebeb9199d07c9503, 0x7db42154adafc448, 0x33d87179e4fe2c,
+0x14d5ada73f68ec00, 0x43c22665f1f723b, 0x5b06dae1083979bc, 0x1517df929bd7164b, 0x85531d4096ca6699, 0x437d3c2d1542f701, 0x297e8f544b657f3c, 0x1cbc01f06461b0,
+0x4f4e13a7752b5f13, 0xfdbb1adce0f530ab, 0xe543b0c5f3c3a017, 0x61f5124574831e81, 0xced6919ca87b069d, 0x13b2fda6a2f22af8, 0xc74bdf677277eb2a, 0x90a62a5d0386f,
+0xf83f49e2a64a642d, 0xf3e1a69fd839b7b7, 0xab5cb32e1ebbc412, 0x9a3daa38ed689754, 0x9f97425729af3fba, 0x8617f149dec657a4, 0x241aedaf4fa62f4a, 0x1bf9eae6111145,
+0xf60cabec7dcfeb81, 0x77c8c28629581055, 0x7bb680039732bc00, 0xc4ed164643e13bc3, 0x207dd9a9df0c84d5, 0x407b688857dd924a, 0xb58a4f9d6bd8d019, 0x1de1cdcd3d003,
+0x6585c8ee492585a, 0xca11fd7643e69559, 0x6dc5eb9f4c83af6, 0x8b7a666daf96e8e8, 0x12454f3ce35add74, 0x45bc6aa25436feab, 0x80a3b0493b07af30, 0x38840ad0e60178,
+0xe2048d718b3c27f6, 0xe3ffaf10ec6bde12, 0xa030b7e83dad3810, 0x2748b445b3d66c98, 0x98a2015e15362ca1, 0x6f7d882d3c85dd98, 0xc48cda40662079eb, 0x220fbcbfd5ef24,
+0xea8e45251ebeafe, 0x93822521f5894885, 0xb4e3091e88c9739d, 0x6b6d307db5fb7be8, 0xf4db41fae396c7f, 0xc55107cd689d6e2, 0x10124d3767b08170, 0x3012c9f162c156,
+0xde098657dffe98d8, 0x25c6a5f41d367da3, 0xd18165c7ff92edac, 0xd9e168ab9eabc88c, 0xee9be148fe7dd196, 0x7ec37b2c7be95ba6, 0x2bc78586659c888, 0x20cb4811e35674,
+0x6d1aee8d573ec453, 0x612ab3f6a8dd9d3a, 0xc94b8d24b15f67f9, 0x529a5aa288b04435, 0x7e3b85cd67f47c8, 0x6040fde0ed5f216c, 0x2aa59f2ce1288bf2, 0x9695e2f5c35c1,
+0x8a641a5e86de090e, 0xeb20f8b8a9e251f7, 0xb288d3263c7d8df1, 0x6c6d95974bf0f415, 0x1930bfdd5f3beac4, 0xf381367e54cefdde, 0x1496e173b19339d1, 0x3b1243aa2c6519,
+0x3535c89f89ed80fe, 0x39bf9260d52d2668, 0x9e49cdf1324c4bc0, 0xb01d1d8d2938852e, 0x7abcada17833b7cf, 0x286ec103b5b1ca93, 0xdf15be2627e7e817, 0x1c558e4c1059a0,
+0x9413a562eb665f37, 0xd541d78201ad2622, 0x231cb024816dd601, 0x8faf1a41e71956c2, 0x576ee1cb210c4768, 0x5f1b53c3689ce582, 0x3b7e982570e1c5c0, 0x2969effe8267d4,
+0x26a94a26664f9dc4, 0xf830ccafff7a3368, 0xf66093b6cbc73003, 0x355f65b3ac4061c0, 0xdde23ec7079dd0f6, 0xb73edec9fb014475, 0xd358e9cb9807992, 0x26360bd50fa3c2,
+0x89f42120559cfd50, 0xaa22e3d891fdd9c7, 0x741bb622ca5fc37a, 0x9bf8b66e31f2f8e5, 0xfcb7342b54dd307c, 0x4fde75b4b625e05f, 0x807605d43efa5828, 0x1ad351c239a156,
+0x19dff2c4fa57dd64, 0x4f9f498db7a8d03b, 0x80dec86414e2f5f2, 0xdf254b4808869c58, 0xe9c0a0576ee22974, 0x3f3958750935b337, 0xfd13b9d89ea5c67, 0x148b882d00b868,
+0x7cedd19311f2b21, 0xd878485b994ce6c8, 0x2ac339a0ac18ca64, 0x1c75e5dc42dbff5c, 0xb7dbef909b904df, 0xbee9644ae8fbf92b, 0x636acb9e2be60688, 0x3aca900cf0ba08,
+0x239eb158a34dad38, 0x3d2edea4f3c739b6, 0x4ef86c1d926a7802, 0x9447a0f20022bccb, 0x7aa5d9bddc258d83, 0x28f3fb3902c07e0a, 0x3360a5243c932cd5, 0x2a8b29c60b4e0a,
+0xadda7e531dda30cc, 0x1e7bc38f8556ef00, 0xa099ed84e70a4f9f, 0x42d038de33e68da2, 0x34b094318f3f1a4c, 0xd487b8412e418c73, 0xeec714737d95e18a, 0x17921bfb0ed32,
+0xe6fe6549e90a623c, 0xdc04f54f2d81e738, 0xdbf86a8bf308735f, 0x74954783161fdd33, 0x3c3c455e4830c446, 0x341d65368deac335, 0x50f0977d28b0de28, 0xde79d05bc069e,
+0x8f938b070c97c9ad, 0xdccd874a556e7eb5, 0xf9d819b60a98a689, 0xf60ec907c47b7094, 0x8255ebb18632176f, 0xb2d621dba506e2e7, 0xe5935d8337923259, 0x249615deac9252,
+0xe184e5e009ff4f40, 0xa2fa69300a46765e, 0x7fb75c449bc0402e, 0x253bae299ac46632, 0x1635db9f9f6dbad, 0xf754cb7ccdb346f4, 0xec8211524ac187f5, 0x266d901ed70f67,
+0x4a20cc8bd68356f6, 0xe2cdf854d9857351, 0xdbf7c1958120fc7b, 0x53034b34c6751704, 0x9842197f51b1ca58, 0x92680fc58d7eba60, 0x6442c851367ef3a7, 0x3afe5b7571bec6,
+0xfe92573715913b6c, 0xdde3debe3378c37b, 0x3b76c38622524749, 0x9f051f7c708ca041, 0x778bae1e9726f7af, 0x4aa1d11bede145f8, 0xc28db82678a3e503, 0x4046c8bdb04a54,
+0xd3fdbb6f20f432ff, 0x3a528f7901a6d00b, 0x2d73d11b1e974955, 0x7ce8922d42486c4d, 0xc1f5de15762851b5, 0xc1670a9a299f37d4, 0x692a03ea471eb344, 0x26bb9983aa1a30,
+0xc358c8a2bede5aba, 0xac8ac42944818829, 0x730d0cef54a30b84, 0xae83d18939b0388, 0xf52cfd98dc76b8f5, 0xb176c0dd8f5c8817, 0xb1a04399e40cfa72, 0x27b5c856f9096c,
+0xfc1918ea783d9cb5, 0xce6e7804a12c9448, 0x151632cd0da5220f, 0x39702a27c388a61f, 0x82776970f21db14a, 0x170e94c469d3f1cf, 0xa412728586a7379a, 0x3c16a5f79ad831,
+0xdbdae563954b62b8, 0x62ba9ec82c525e6, 0x34f1219ceb8e6e1, 0x36c4ac95b922c2c7, 0x1d07dfc4d9714848, 0xe03a5feac237f6e0, 0x70f6e5ac73950ad0, 0x3466f627d3264c,
+0x3132b958f653b112, 0x6cc935c9f56dec70, 0xe99d02cacf5f729b, 0x27d8d3b3d62065b6, 0xfcd9449e28c56caf, 0xb5d75ec8151bae40, 0x932f04efd5d64234, 0x1dad529b63c7dd,
+0x3e8f4a894e8a960d, 0xc7eab3f76abc8a18, 0xcd16a56c2bcdc18e, 0x9551ac47c1d488ae, 0xe1fc787cebe013b3, 0x75f687fd6704b632, 0xa3dd5ee7994d5119, 0x54a65bf3e9a11,
+0xaa85236241ac465f, 0x388c4c31d7958471, 0x1f586e9796b00037, 0x3853f08140adf073, 0x90e1dced2671cf87, 0x66c388e10f38296f, 0xd4bf39bad8c4bcfa, 0x27eb3b02a0552,
+0x46c408322adbd90b, 0x1ff856125ac3ecee, 0xfbf400fa0be57cd6, 0xd535ad1bb2a8e9d3, 0x8e35725798ea0b44, 0x7d5182836a5a310d, 0xc906412d23006b0f, 0x10c06d7dc9119b,
+0x84b97c9e6e9d4cba, 0x2aa9e5b44455a839, 0xbde05b49f2abdd41, 0x12fec4f971edee8b, 0xbb99daca169ab86e, 0xe829466c40b9b678, 0x36088e72021131d9, 0x29743d8da72354,
+0x74c70c354856ba99, 0xdb11771936ad35df, 0x2d0448d1681c3551, 0xde72d2a34061c425, 0xc2afba8c004e6c67, 0xe7738b44653dd566, 0xb94e2d285cd6c476, 0xd185342263382,
+0x65d8daeb298dcffb, 0x26e5f9aa379a43ff, 0xc167bab5a8178dd, 0x37d2d9c72fa09527, 0xd93c4f233c188e62, 0x5f89b910f33ab153, 0x1ff2e5bd60f8f373, 0x2d078d0c0e838d,
+0x36130205fe458176, 0xf15d9cb92395054f, 0xac14da0f09ba5c30, 0x47a29e2607516e9c, 0x9b74caa5fb93577f, 0xb1cbde56061375d6, 0x6de3f38c68e0ed6d, 0x30d93eb82ea115,
+0xc9eb02f5c8782460, 0x83a31688cc1439ab, 0xd8a92a291f75c3af, 0x64f0a6afcab02794, 0x9ec8f94e504aacdb, 0x654f4e6c5596df04, 0x2508ff41837e08f9, 0x6ab6c3cd97205,
+0x32c5f0daf01612b2, 0xc7b5f2dfef30b0c4, 0x3610c35dcc3214c7, 0xd5b27024f7e31a25, 0x9b4c7635c65b6e3, 0xa95c44c6131f68de, 0x9817448c56fee4b8, 0x1d0a5cebb8ee73,
+0x192fae482482f293, 0x572ed64b906cbd6, 0x5d49573b9556b38c, 0x48a22c47b4c410d, 0xa97137adde9d7307, 0xee95223addaf261d, 0xb45c8c17160146bf, 0x37d343204cf746,
+0xc544349c6709322, 0x939ea18f895b5b9d, 0x1345bb40abaa6452, 0x1484483750060899, 0xc813d4f2804d6900, 0xb31b5f5c47758d58, 0xad7b5416764ab377, 0x2ceb0441197055,
+0x55232143359bd1b2, 0x7c695f9759948564, 0x295ad3f01d179edb, 0x2db55ac588978d08, 0x6b6637d82fe1c35, 0xf22567dfd4f8e996, 0x20634f881ce99230, 0x50739e5485e9d,
+0x70d49075299aaa3f, 0x67d8e5321f433867, 0xc6a50c2960502a0d, 0xcc46e63a1b94b75a, 0xa60eb6abf2a28fa8, 0x2ce7aba405bf3c59, 0x2b5d6258f8c608d3, 0x163370def24be9,
+0x867a851edcb7e581, 0x29c5e892dbd267e5, 0x5b67c7920803ee7b, 0xcfe5541dba5027b7, 0x4db59adbe8dd25db, 0xcc0b0b8394da92ac, 0x6051f753f23c5232, 0xc53b97444c7c9,
+0xc52bb52fa1201a76, 0x15b37d74bd1fc110, 0x8d923f816f67ff98, 0x49a03637a491125a, 0x8853c00bd3ab053d, 0x75f9cf89150d7485, 0x43e257228849b607, 0x68518ac0e81ad,
+0x32326be8ae6d07a, 0x83022449c1078b5a, 0x72fbab4fb392c111, 0x3ddbbaa4958d48ee, 0x6483a8bd06e8655, 0xc68932ff736e9bae, 0x3432e2c7a0ba14b4, 0x18be4034130a11,
+0x886996ab9a112b5b, 0x2c78d0e1456db01e, 0x167e7b3ee37c76b4, 0xb56f50bbc25b1239, 0x3a7e925ab5fd8373, 0xbfb9403dfd1beca4, 0x37f6e14836f023de, 0x68ad3a58bc850,
+0xa7db5df3a0a08069, 0x7eb9eb484648518d, 0x14d86d941f3e2209, 0x59fadd95ae545654, 0xde7dc9554ea754ef, 0xa50e5ed2f7726442, 0x7d06bb28da829d3f, 0x2f476d8ddf63ee,
+0x77e0f48001d66789, 0x67dab41753e4d84f, 0x726c55593a8a6aaa, 0xdafb4dd3aedb578b, 0x38687c9600f1f991, 0xebb422914f78b4e6, 0xb32332e9774f63ed, 0x349ac8f60b6b41,
+0xf9d1655de1f7ceb, 0x2b1719c7cb199b80, 0x86337147c666bd10, 0xeda865573340c402, 0xe0c87fc685370813, 0x3361f0db37b3f481, 0x2932bfa4c9e35169, 0x39ea55f06a9d58,
+0xc8c384a414680ae9, 0x9e88196a0535f311, 0x20a49b6fef0cbc99, 0x502b112d80279801, 0x2b6f885f1e935c54, 0x6524b8731b9b42ff, 0xbeaf11381716991d, 0x2934af142e84de,
+0xe0315ef118e4ae40, 0xd7dde94aa13f3e5d, 0x38072742a4aecda0, 0x88a55b654a65d16e, 0x3aaa6cc8e12e055e, 0xdd898bb763ca0957, 0x3d85ec9e2c33ee8, 0x3e35bade45ab56,
+0xed0f71a007369ce1, 0x668ffec134480dba, 0x753d6d782a88ba78, 0x38ed84d608d5a932, 0x2aa2e76bf32633e4, 0x3903a36adfab59a5, 0x99f234fd109005f6, 0xa9fec10db3db,
+0x5c5de39bb5dc4b2e, 0xb63ab16334e6bea5, 0xbbc6a2f99fc59c4c, 0xd7a0dfced2a144a4, 0x854e3b597fa6846d, 0x5d085162b627ff78, 0x8dcbb97fc3e941da, 0x1396ed63559fca,
+0xe39f5ac5fadfa7a4, 0x4b28776e55ee4812, 0xaf37704842434c1f, 0x83c7db4d1deceb91, 0xe42bd57db046e719, 0x2677bba2aaf1864d, 0x6b0ebd87d2f37fdd, 0x1a8ae7659ece9c,
+0x203063e28c1be544, 0xcd304625235bfc61, 0x213db3367dda3d5c, 0x8d7c480c872c3d3c, 0xbcbc42065e2a823e, 0xe6500fe539e95620, 0x9bed933c6ec39ddf, 0x3c43e03df72bc0,
+0xc48cce09abf66672, 0xf0d968c153f59f65, 0x460c4a850dbac18a, 0x96722551e78b738a, 0xeb189d9b2d274cf1, 0x19309b49a30f7085, 0xfdc8e3ae23ac2340, 0x2eccb91ea46985,
+0x10928b3f8d2d900e, 0xd2473894856097b7, 0x7c7c7b1b3b410c7c, 0x1aa529e709e7f6de, 0x153e6e419a4a025f, 0x17a2b6ab9c4f0752, 0x7068d1e24e9220a2, 0x5c50f7fe10cf,
+0xd33c0193fa708782, 0x34a8764fdf6b34ca, 0x6d94b04b455941b9, 0x5aefca04ec111243, 0xf09e437522c65e6f, 0x265c93943e54cc0e, 0xa397b4e6f63033b, 0xc992ad17706d8,
+0x48737c5a3cfb67c7, 0xaf1dd4bfdd8bf38a, 0xd686c5ff02b4a24c, 0xbe071d4db1bca338, 0xf3e49ed68dd0b058, 0xae9835bd8f41f281, 0x4a980ec0ae59e1ad, 0x285e541f7d889f,
+0x37947edc31ef1860, 0x6740c7fe33cd6841, 0x51b8eeb572befc1c, 0xdec267cc958130e7, 0x99e613a004953b1f, 0x589480cf7de76fb8, 0x3ab0ee27fb7c2b38, 0x145d9aff2714a7,
+0x1b0999912069e5ff, 0x25c6ecdcd193b575, 0x25c924c1d5b88799, 0x4187dd73f19d7282, 0x9dab8f0a9cade4e0, 0xef1eccf096f997b2, 0xa34271f6560c283d, 0x2f1062990307b6,
+0x89f1f55fc38ff447, 0x62dfb360e5b9b210, 0x64d1f2ac3200e703, 0x9bfff9999014ede3, 0xb0344167f6199b9e, 0xfdfa0523e536f689, 0x9b916149b5301ce, 0xe3f47008ceaab,
+0x782ae3f6f1ad7f14, 0x267d5fb10a44ed60, 0x64b5a5be7fae8438, 0xcf2eb7338d5131d3, 0xdb18ef63ab9b3f26, 0xd43ab47bac9f0353, 0x4d7830f779517b1a, 0x30fddca0752171,
+0xf5a558e1c877a22b, 0xb2fecf856ac4f4e9, 0xc78a753657f1b241, 0xcf065af297611d23, 0xa50281abd708ef5f, 0x8191f2ed30fde186, 0x461262e43e2f2dee, 0x40557aa7e32047,
+0x87f142e4500b23e6, 0xb946d7beeb83a3ec, 0x8f15201f6f73021, 0x96d3547a41112e58, 0x600d91936946e1e6, 0xe2a57324fcffd465, 0x368cdca23d8a0b92, 0x153fa13a773d2a,
+0xf942323dd5e6cd48, 0xa55c1a1da0476617, 0xddae8401140cd532, 0x48b2fc4b6a4be7b8, 0xc1ed5bf4e89a0cd6, 0xf07b0da7e6354658, 0xc74945ea92aad2cb, 0x22d4673d6de665,
+0x14da5f440ee11297, 0x6b394761e9ab4d66, 0x3f8a92a1b73ff4a0, 0x795ba8ebe9836e5b, 0x3fcfdcaee68a8013, 0xa13c891fde6cd9b1, 0x2d96a469d4242f16, 0x3736eb8101ea85,
+0xf7d88cd450232f71, 0xcc2f8e884733f66, 0xf6601de04b4a1324, 0x62efee4be6dc25f4, 0x41f87c286e477373, 0x247231b5223f2c65, 0x8a3937b29fda7f2b, 0x3177326c5d9f00,
+0xd32e1e3abaa372b6, 0x99fdfea5f5420dda, 0xe7a9eb6e9db8b0f2, 0xb84c5dcec4da0380, 0x8e50c33e1f88c623, 0xd27f7f94156a4ec2, 0xdf97cad9396d91a2, 0x13842d8c064c24,
+0x7be312840b8ce0af, 0xcf58309c7c1597ad, 0x712692f0ebcb0f59, 0x96145df9e345e951, 0x53cbfc1facf58f10, 0x4ccdc7f8fc90ed19, 0xee4cb31d2e89ba7b, 0x2d43e39b548fa0,
+0x90850c257c51555d, 0x6be1a3029af51863, 0x515a0e0bfd5ed2f, 0xc518a9e71fbe5c91, 0xbae059213dd52539, 0xb2c825f1907e17cd, 0xd7c01bd43ab97951, 0xf367dfece8766,
+0x82c9c6dcf731e49a, 0x96ed55713a95425f, 0x15b1ed86caae3da3, 0x4502566b97e4fdea, 0x48c26283a9d98a0f, 0x563504234c5eacb6, 0x7ef7955d3c35d9e9, 0x5c5b8fed7b401,
+0xa19e9c9c6f9575e9, 0xa9157e9f9b3a1ec4, 0xf75dbdabdb89179e, 0x2686ee7f7e472a3f, 0x278675c57cebafc0, 0x8005286e17526aa8, 0x5889a1c5b3e2f8c1, 0x3f1a8b03320780,
+0x858d07476b69c371, 0xc3d0dc818b1c3f8, 0x8729ba7c5c95269e, 0xd671c5924e694d12, 0x974decbc473558e0, 0x2781d4f08dd3c11f, 0xadb63d01462a3479, 0x393ea2e6bbd2a1,
+0xdb7eee9e076da17d, 0xf6b3b4281a2d71f9, 0x7eb2a14d9ce7e55f, 0x7dfa4d657392ef02, 0xd15b351fd0aaea92, 0x3e3944a5bcc57c1, 0xbb7f678d3bfba823, 0x74581efcda85f,
+0x5c2fe6d667395fc1, 0xb2e02afa647dd648, 0xbbf4d48038cf7162, 0x509aeaf7a07260f5, 0x456f71674bed3559, 0x3224dc7137632544, 0x5003ff935578ff99, 0xf63203db73abb,
+0x34fa9a75ca7652d7, 0x34f9424f8f2e8bde, 0x71e93a8fdc2490c5, 0x943a87f137bab8bc, 0xd937c0ed52d4630, 0x99119c27a6e3117c, 0x638f1e45bc4eadcc, 0x16f3817da85310,
+0x3b5256c6ac8ed8b8, 0x991c72e5a6c774d8, 0xaa26cbb18064effb, 0x66649bb5bc2c343f, 0xb30f88d68539942f, 0x9630799b141b938, 0x2d3c0e6ed98d161f, 0x36581de1ecccdf,
+0x734d3d9ceeab20af, 0xad95c4c8e80a7eb4, 0x89183bf37198c10c, 0x8b6db3b07bb9ea5b, 0x65365566cf0268b3, 0xd3bca911c5c5f199, 0x5e2fe2cc91c408d5, 0x1bc2fbd23ec2f4,
+0xe331b299a1ffccb6, 0xca8a5662b77cd971, 0xc10c4b5a937c3340, 0x484fcba4af47077e, 0xf1274e53d7c3034b, 0xf76120556d332ed3, 0x9e0183a7d268934e, 0x14e0981bb4ec3,
+0x973a644caf25270c, 0x7163d894289cac27, 0x98952cb8b98739ea, 0x54708f688c7db2b8, 0xf2278f4f562cdbd8, 0xf10466575dd0706c, 0x81cab5ed8b58a421, 0x18f5370ed78ef3,
+0x1292011a4f9c1ed8, 0xa01c14e0b4a3f35c, 0x5a78799c25406073, 0xe2e1955125177b8e, 0xb43cd4a41cdabe74, 0xf738d7cc5b93eb6, 0x3557a4aaeb8d122d, 0x35f943e6e56a54,
+0x908bb99bad39cf34, 0x3f7ff7687372be08, 0x5355b6151c63b096, 0x908b8ca2fd6f040a, 0x7b1ef9d829ac3c4d, 0x6457557f7a089e7e, 0xbf486dae6783f72e, 0x1ea9b3533b073e,
+0xbaa61ee13d2fe129, 0xe63e371b7ec3b385, 0x76693aa790d6c421, 0x669498c7eeb232ee, 0x1cbf526db21fef77, 0xbc2f3a42f2d70a27, 0x94dbb64bd68e7b3, 0x17f0ae92489f4f,
+0xa7fde46cbba47593, 0x8002da72dcd1d2b6, 0x713ca2124bf168a9, 0xf554837c7b11d7e, 0xdc65e607f0e6af6b, 0x4eedc15f66d2edae, 0x914183c5900377db, 0x261d73b739ff40,
+0x1480492f9e72675c, 0x413e570f10e61141, 0x3907ba8876db7df8, 0x5cba5a2a0431e093, 0x318e067670208d4e, 0xa5db51bb58e6a841, 0x662bc24866390784, 0x3e60589b328959,
+0xb2475a308089df44, 0xb8cdf1c644f899c4, 0xcc0f98020b232a, 0x4cd129752b8131, 0x4b572f1f2c3918b, 0x447ed8da72a53183, 0x55534f097598272, 0x28649fada1fd3b,
+0xf7d7bdd4f7097de5, 0x126c1c5e5eaecf3e, 0x2a8e0db24a6ec453, 0xdeb88c0a76fd3f1b, 0x68cfc5ce9fa19915, 0xebc078e6f8b2c7ea, 0xcdcca21f79bad74a, 0x3c7b64183df676,
+0x7178d37a2febc46c, 0x82bf300b25d77009, 0xe5a40cb2a2e84f1e, 0x2f0371d0bd7554ba, 0xe4a3117e1f38b452, 0x6f598d63f19e0090, 0xea30f75750b693b2, 0x27b9b021d1e12,
+0x87b4d7a5346090fe, 0xae760e523d10c41f, 0xbe85b02f41fcc1e5, 0xdb8a8032a88d91c8, 0x246b1ad0a387b293, 0x46101dded3b23072, 0x9ea5a3d57fd730b8, 0x3f9a5fcf7cc873,
+0xafa7846a7a7c2feb, 0x737eb536f3340b23, 0x426a25a2e267c427, 0x71e08c109d2dc8e7, 0xe13a8a3822ffc4f8, 0xb5bfcdadd5919d0a, 0xdb0821b34f8901e, 0x3b09faa2f4daa,
+0x22283622e319ed4b, 0xd3e2dfede2bbb078, 0xab7c91fe7404e0f9, 0x369b5e9dffed6703, 0x1b5b8f821822c4d4, 0xe129c0ecba140a0e, 0x425f1477afbc849c, 0x2e0e6a17f64fe3,
+0xba2b45b70b7597be, 0x18af3e307309002b, 0xd2b4b653b7ab91e9, 0x97623714429615bf, 0x10defdfb276a1950, 0x77160bff1902e44, 0xbef581e5f584157a, 0x6419ae5c7e955,
+0xa7dad1e816df9a18, 0x1da854b3a2a9cf82, 0x3843b11074380273, 0x54b7086956da8d8a, 0x53b1377e237106ab, 0xe376e34b0692110b, 0x88fb6965f71f8b5f, 0x2373092c2d34d4,
+0xdfcafa8849214520, 0xce438da85fff60b5, 0xf84610480f64bf76, 0x2e9991e2fb6fd813, 0x54ee1721d6a29a11, 0x88958494e9102882, 0x19485dab0548d5f7, 0x22d2e554d58065,
+0x702c80ad2a4da5f8, 0xd1e1b08ab30992b0, 0xe7eed02a1e71b1cd, 0x87daac25ff20b382, 0xa5167f17ced82f94, 0x761925acaefc6ccf, 0xcc1b6d76b02b1db0, 0xd90cb1375f5e,
+0x89216fc4d08b5d85, 0xc7c01857a1f9796, 0x8b394c86c7225570, 0x6a29cd63a5ca4186, 0xaacdc18a12591823, 0xcf2d7f7da87cf8e5, 0xc1eb972f9a4cb190, 0x413d46aa4e654,
+0x17e786f28cefc918, 0x91d0db5c35e1472b, 0xb9e908983238dd90, 0xefc3da01f0f99862, 0x30a2ed16dd774c52, 0x70e07dd107793e3d, 0xe70c832d2903ffc8, 0x272fd3c3f2088c,
+0x98846627f36361a7, 0x7782db661b8e25dc, 0x86aabe3c6ff5e942, 0xb436bc82cb2d1f18, 0xfcf80f9687f78b4f, 0x7e6faaab02d7cd11, 0x33f87b497fa80879, 0x270741f521294c,
+0xce3785ab658181f7, 0x89c0879d55ca25fc, 0x84ef93fa96c32d91, 0x4877dbf5f0be48f, 0xca783edb15d47348, 0x83e8887e01bcc1e4, 0x4f6c279cb15bfefe, 0x3d75d2ee6c65a,
+0x3c106750230a2736, 0x371850946f9f74d3, 0x347f92fd46eec8d8, 0x45af459ad30da011, 0xd3145f3f846549e1, 0xc4c8b8a94340b367, 0xb1f1de71e5664925, 0x2d0004f9529f5b,
+0x8ad9e693570ace38, 0x2378f7cc9506357, 0xd593c30fdf1fefab, 0x30ba8c40158acf20, 0xee65be814d1c1a98, 0x8438d291e22d0f26, 0x46b9c782915ba730, 0x35c5a2abc56125,
+0xe0445f5677ac601c, 0x50960c18a4667864, 0xf925a503b850faad, 0x246f462ae30202ba, 0x8d36d664fb892b0b, 0x7dbb5bc89656af08, 0xfdbbd9ded4b77913, 0x2ea42af74d7415,
+0x1e2156090dc23737, 0xc921aa57308d5a73, 0x2f199fda77d37b6f, 0x6bb21f79c69a0a0e, 0x5a539c591361a681, 0x6aea43dd44398499, 0x6060cc73ccb259ca, 0x1546dcbf6db9cb,
+0xc04f3f6ebc5e693c, 0x775e022563613d37, 0x11a5f2b4bf9edc41, 0xc9a08048a65669bb, 0x15c5b13f76dc435a, 0x6c9da1e7760f2fe8, 0x53a6c600c7a1d03c, 0xae4826cacd1bb,
+0xec015b20598d3949, 0x219fb828424697a8, 0xf64982521e7353ba, 0xa17f4726d124e30a, 0x721b335373702aa3, 0xcc134076c36ddabc, 0x8666cb7f1c069c6c, 0x1e11618e8fb770,
+0x291b18e78005586c, 0xc4457e4eacce410c, 0xaa634b593bf7d7da, 0x3b564de164df11bd, 0xa3280f50e8f5473f, 0xd1157a83c81bb173, 0x2294112a430aa68a, 0x1b8704a90fe9e5,
+0x56b7e5f1cadf3313, 0x47b6351d7109c43d, 0xdd5666e5339fc4f0, 0xda8946080066e593, 0x36994943e044f666, 0x6a2b8f4464fb3e3b, 0x6775ecba97140b33, 0x2f0b20c119e257,
+0x4cbe7b2a035321b7, 0xb31eedf4016afc9e, 0xf853e0f9ebd7e953, 0xc88e9f8fe1be7272, 0x7db096e448017615, 0xd6fbf30304da0bb7, 0xfef5d9a874327177, 0x3ac6fa54d7dc62,
+0x1406f792488a773d, 0x5af4ecac6a208df4, 0xc7a7a32e1d8ecccd, 0xc48946f6ca2218ed, 0x74f9c021afc952ad, 0x810923b752cbf877, 0x748c1ed7ee985280, 0x394a7f4fb529fc,
+0xcf0663f73e0ad5d9, 0x477e2dcfc55b4053, 0xb69a312fb170a926, 0xa9e4647c9cc0d858, 0xd3cd679252dac358, 0x38dc6357d6c15573, 0x868d4e7136b9016c, 0x13636d782451de,
+0xd5693e97d8b53a88, 0xe4365a9243f7c564, 0xf4fc3f444cc54747, 0xdb2bf03b2aa1bfc2, 0x3382b49de21b8238, 0xb839ce1a807b14e7, 0xd648cb971e2df0f2, 0x195b1f31c8b985,
+0x5cf601ef691c8411, 0xfb61b0468185ae7b, 0x9c8370b8a4f911f1, 0xc7feb02f1f842e0e, 0xb516dcd90887bfe9, 0x8b713061e5e0e4bd, 0x2c17ad49de6ad232, 0xfe60868c75312,
+0x1716cd0aa072da6d, 0xb415bbab86265110, 0x7363569e03340497, 0xe931eb2b7cb1e82d, 0xc2a6e8fe80cac638, 0x682ed0a941a8f143, 0x50f26b96ede2df55, 0x97564618cd17d,
+0x55eb2b72652f5268, 0xfaf76509855d5aa9, 0x1f9c1fbeca8eb01a, 0x12ba8ffc1fd519b9, 0xe54f06e6ec986403, 0x46fb9cbe9d5d17e7, 0xcc3c0a7af4c26c43, 0x185930842e6c13,
+0x170dcfc36566f5be, 0x831c8abd51591f27, 0xe2d2ec02a80b902b, 0x41c0a0ca03bc79b5, 0x510365ae38c0bcdd, 0xad3efac35238aec9, 0x7486c3ab8abda8bf, 0x194c2ecc2442c8,
+0x62d0cfa5bc9c173e, 0xc912fe9041d92f46, 0xbafcc7fba3ff05e4, 0x3480da35ad7f131c, 0xc42c711e2ff13e5e, 0xf4dedb294ce941a9, 0xc113c1a75f95e3fb, 0x2316ace9f0a019,
+0xdc4a4a9cf74d74cd, 0x823c5a9dc23f3c8d, 0xb7e1b0d1e4279f11, 0xe1a20b0e73d0248b, 0x1e1616ba1321cc7, 0x512a1ee21a07c3c, 0x73474fc712381200, 0x3ccb776bac4589,
+0x333c48cedb3a228d, 0xa563b38e3b2ce454, 0x24a1811148bb586, 0x661475f95ca33de5, 0xc2457e96139a5fb5, 0xfe00b8ab6350becb, 0xc2019cc9cbc0739d, 0x28f025c96d3861,
+0xaaba9d1340b05a22, 0xfa67356acc404a0d, 0x5c87fc45fe5bc1f1, 0xc24f06241a283fd7, 0x5873ff137240b6b7, 0x4f2202dac0407a09, 0x7622f95d076787df, 0x3e32d3538ba52d,
+0x71cf043b02f4029e, 0xf2e0c6dcde4b5e4b, 0x9b20d0abd80adb52, 0xa342518da9c937da, 0x506c510850829ae7, 0x47c6cd2ccd05ef9d, 0x205d8ca94920a22b, 0x381e7404ce0cbc,
+0xbf73a9dcc6c81512, 0x81d487dedc5532ed, 0xc3e11a49533de7d9, 0xc86061ffe8b4a7e3, 0x669892730c20a51d, 0x3117a942f5658576, 0xcd2e0841a1da24a4, 0x1b445d4b7fa0d2,
+0x4d2920a05331b81c, 0xf8f6c605a5d472a3, 0x1f5f63a483befad9, 0x2de3926460c2a833, 0xf969d7734d88a317, 0x5b3195f6dbfc88e6, 0xa1734a9f53571c77, 0x83562054b02b0,
+0x6856b267dc03805c, 0xc06706b1e1ee03bd, 0x7feab0a97be154a0, 0x16b2f3664ac3f1a, 0x694e42e0c8151106, 0x255af045500f758, 0x8eb5f8845a39ecf0, 0x22a68e98f1d129,
+0xf233d4dc760f568a, 0x6975514e823c6524, 0x35c961badd7a7cd7, 0xfe0e9b53dc12572, 0xf12dc4df05d3ad5e, 0x1843ea5579c189d2, 0xc08b67535ba7f6e4, 0xe5e31a16b726c,
+0xadae3a0456394724, 0x737cfa1e5d838271, 0x73e19d37fa1e57a0, 0x3ad955eddc63f084, 0x6c194dcbaa26f010, 0xeb521e07a510e811, 0xaae81a03d8a440a9, 0x2f68f70c7f532a,
+0xf61c798e75f42d3b, 0xf7776a408a447aa1, 0x7fa016a3c4e688d0, 0xd1057aca4e3d916, 0xac80987c9be67720, 0x7c29426af4a7786c, 0x69e2b37db8389c92, 0x1ef9dbecde3c37,
+0x8c13bde0b9da12c0, 0x52e2f7f36a1296e8, 0x93d51ae4730a22e6, 0x343b92cf8cdf1643, 0xca5be8729340631d, 0x5e0f0058e6fa1d28, 0xfabebd3060cbd6ec, 0x3e701f129e0719,
+0x2b340b55cb01133b, 0x69b212b0409f1883, 0xf6578b97ebf9216f, 0x221edfa471b1b964, 0x6a5d5c8a7095ee6f, 0xbbfa3875f20ab20e, 0xe084026cf8aebac6, 0x2488854bf545b4,
+0x87c89fb2d58db5c0, 0x3439c7425c633cd4, 0x5aa6fa832d28a4e6, 0x1fc17984c593a2ae, 0xaf66e3037c26eb38, 0x9da9ba51e47ab560, 0xfe6f75e9c2f2439c, 0x1cb03974dbd688,
+0xb5446990e6c4aa52, 0xb3f580b359cf6538, 0x7323ab3fed1c4f64, 0x94e7708e9994aaca, 0x98ac0b3968c9affa, 0x121a5916fda85c8b, 0x225dd1bcff3373e0, 0x2ca984a7f2f4c,
+0x370c9af150bb3ccc, 0xb12b60596e59a1e3, 0x9b878061d12529ca, 0x5d85e5e0bf5c1d18, 0x5e58325432e1f24e, 0x585b6c2ac397f52a, 0xb79a25756ed1a3a3, 0x39c761aa8718c2,
+0xc394f5223f2efa7f, 0x264dd39f09a170c3, 0xd8f34bfc759d5451, 0x2f6364d757b15ff1, 0x4f7ce25e9853e8ea, 0x8ee5acabadc182bc, 0x88c6cd02c0a52dee, 0x1ecb6fb321fd3e,
+0xc63601acf399c4d1, 0x28858d5482719411, 0x704c6640121bc9c, 0xb62627413f79371c, 0xf017e7235bdeb0d7, 0x270cc45ed947b4eb, 0x8c00df0e0143b91b, 0x91a2f3d4eefce,
+0x401542c08a5e65cb, 0xbd2d07588d7e625b, 0x548aa1c97d96b04e, 0xe66bca082b146f90, 0x4d0a37b9e158dfd1, 0xfaf01a8a7c20a8da, 0x5cd8ef6748e3ffe8, 0x3676af316b22e4,
+0xae98986fba003312, 0x99ac6ac39159c882, 0xbf9ecfc393993307, 0x65762c6f29ac779d, 0x387a8cc25d4529cc, 0x65c1ce3a619696b6, 0x7e64dcb7c333ceed, 0x13e4983cb2c9a4,
+0x4ded04c4720ee33, 0x5a64ceafe858f85a, 0x8af32312e11774d7, 0x274cfa6aa509d361, 0xf7a0488c63b5a4cc, 0xc5584635a10fc961, 0xb0398f65333bc999, 0x291f2abf0e10ef,
+0xa1076a18d981d2a, 0x8f06fcf5d6de4c70, 0xcec9733838097057, 0x50fb065ea1cd9094, 0x93161acf5a59e2a9, 0x845983d6512fff79, 0xcd0e1c06541d52e5, 0x42c7aaaa0bb1f,
+0xe285aa7217ed5cfb, 0x13f7367d4ae539c0, 0xfb9c59aaf663aa40, 0xabd3304310774662, 0xe4214d6ad98968e8, 0x5ce1bc2f5fbbeb13, 0xea77defd87b7b3ed, 0x2ac905fee0f8ac,
+0xf342abb4bc678c2, 0x4b26ccbfce8ef8d4, 0x3142f106873b3087, 0x8f6134ab9a5fb04b, 0x98655f0400a5ff8c, 0x8e6f8fdbc2ac1b78, 0xd1ca54d50adce586, 0x91588311970fb,
+0x383a150174068805, 0x25ca454d9d325967, 0xa5a32f551a08e990, 0x9b8eca282867e54a, 0xa783094b2dd17ca9, 0x31bf30f6a2ec30db, 0x797ecfa3bbc27096, 0x296eeb12eb4063,
+0x7a813d7910a7ae4d, 0xcd7698379f20810a, 0xc2bd0c335c47da8c, 0xedbcdeb6e1651f37, 0x20c9c7d4d4e5b3b3, 0x6694bf77d77167f3, 0x9a99adc1afeb8ef8, 0x1cb2e021ccf274,
+0x4fe2dcf4ffdf1f06, 0x9a604b6cfe16fb30, 0xec3e031f268c7972, 0x10e9199993b50d99, 0xb089a13e702ae83a, 0x8385530bdca34e51, 0xd870e484f8fc7945, 0x3b2ea55231bb81,
+0xc79f8aeb8b83c1d3, 0x5c1bb7150c2d1817, 0x88c9f72996eec469, 0x38b7da95ba20cd4a, 0x54b5a923a04d0dd6, 0xf66ae4d13de7d63d, 0xd688f4e21c251ac5, 0xa68be5ceda95f,
+0x5e3af89a93104f3b, 0x6e72eeddb1d56d04, 0x2eee61fa02b3f96d, 0x4d88fa03eecd636b, 0x3aec4b609921175, 0x1d7bd0f244c364ab, 0x9a598f38ffb8158b, 0x159c1b651036f1,
+0x3f1284b397566300, 0x70881699305b967e, 0xbabb7dbad366c49a, 0x22243f9554b526ec, 0x2f806f286e381c56, 0xb26579cbab878065, 0x6d80ba9d9601b385, 0x2241d5c4338ceb,
+0x14c14729dd25325d, 0xa2838798d0293262, 0x74fb6a09cdd3dd72, 0xcd70a3b1933ea722, 0x521f4a128463e23e, 0x8ef17f5bd2dc90c5, 0x3fcb26af5e6455ae, 0x38bce20275285,
+0x793bc7acb2d1ecda, 0xb1d22b6ef98d38aa, 0x329175d68e114fb4, 0x2868ceb26c422d5d, 0x9f0cbfd399602e84, 0x3cab6106f4095148, 0xae15ec1922da64e5, 0x32ea4779b73de7,
+0x2e0598883136c79c, 0x60d7f1be3154fa44, 0xd6f491154c8bef95, 0x4347843d6b704977, 0x97d7f83484e25a68, 0xb404dd73b2b2a749, 0x29646716f028b664, 0x2ae1afd8f9b0d1,
+0x30f634ebb1f06e94, 0xb17576daa833a32f, 0xa256da0896115659, 0x5fa67941e88e3639, 0x1350eb959f2ef3b5, 0x788be520132861db, 0xbe9d413d9492119e, 0x2b2d7430be22e7,
+0x1e07e360d490bc33, 0xcee2d395831bec36, 0xb0a948f75e8a1614, 0xc1d62a8e9571a44a, 0x945a1dd9b4339624, 0xd48311e2151a0ea3, 0xc77d6fb21b8cb73e, 0x3054e58242a23a,
+0xe4452cd630fd3b56, 0xa73d8688f9e0bc1f, 0x83ae9f2d3cfd99aa, 0xd3b1a6bc7cd1ba07, 0xc18f975c493d9683, 0x8b4eb3fdcc38c351, 0x421c25ff1adb4430, 0x382c775d691da5,
+0xd4679a442fe26385, 0x549728149f3e1ac0, 0xe24a96b6751e92, 0xabce1ad8f7fe72d, 0xe22da792fee91a0e, 0x93c1bfa1f9f1b10c, 0xd9412ed67d0dcdf1, 0x28b1231ec4e996,
+0x612276d7eef6fb56, 0x30b3ce182fbbada7, 0xadbd1daf58d99a56, 0x91772f14d4210ad0, 0xa8ebc708a2aaa886, 0x43108f0be9eff3b8, 0x2a2c44d11c1417dd, 0x323fbaccecf92f,
+0x893b6ac12d72dc56, 0x1e50771a92aec16e, 0x32ceb191e67ee626, 0x9f135cdba9869a2c, 0x898f5a6fea0a731e, 0xa3231be36f0fd322, 0x3b018282520d58bc, 0x210b7ccd03e65f,
+0x736c3706a9830d39, 0x973bfce7ee4b278e, 0xfce8fbc4e34fbbd3, 0x99c1eff96e4bdfb2, 0xb5a56ab763176dc7, 0xcbc7af70a8642604, 0xafa9c364b4835a97, 0x807f4d4cbfd8d,
+0xb99848efdaa956fb, 0xaa9435bbdb07aa, 0x6f4ddd6a02d13b8f, 0xacac056e6570fc68, 0x9c188b34fc11e856, 0xa7a26e7701d497ba, 0x4c3fff1053dc1435, 0x29d48085843946,
+0x3a6f2b0c8dd2c442, 0xe5a23fd35ac0619f, 0x3f316b2382e7dd2f, 0xb2076c2823f6725d, 0x6b95db009e1c1e22, 0xe8aef6268ff45469, 0x94e9d0d5a0254829, 0x119e6e989922a2,
+0x8611c53b8144f62, 0x6cac5847fc068f29, 0xae53da0c9e12f600, 0x7e6bf9f5cdf26935, 0x3d4196dabe4ca9c6, 0xbd7628987c9e5b4d, 0x3c902317a2371372, 0x81fafdc59f63e,
+0x180e4bc0c5952015, 0x93732484e5f77fcb, 0xb0dd9ba95a209af0, 0xc3bea54d0341ccdb, 0x67924d6dc572e6ca, 0xc3f804e99cca8f88, 0xdfe98eb944bfa379, 0x119f861f162974,
+0xe8edb0cb3cb5b379, 0x7bc0a43c8a4a561e, 0xdf257155f0f91f2c, 0xf3b0066eed955f5b, 0x260bfc7f67ae4c70, 0x1bf08c00458133de, 0x4688b38a43aee733, 0x3e16eca7cc216c,
+0xb9aa48868d4a284c, 0x414943c0be3e4d88, 0x6393477af922c8b0, 0x1c9c5aa457c3766b, 0xa837024a2a3a1ec2, 0x22faef4fdba2a375, 0x454ed4f4de2aaf01, 0x30f521342a6872,
+0x3a164dd7b774adf, 0x6907e63096bf75fd, 0xfeb7eb976ee85bfb, 0x40b3302fdbe96296, 0x1be427855518710a, 0x87e592ed602e2b37, 0x7fb19c275322bb4e, 0x3914993ad2a8cc,
+0x7de7feb0438dadab, 0x805931f3620aff26, 0x8ecc6943937920ea, 0xf412897375e492f3, 0xcbd33e5410fe2dc1, 0xe69516d616a542b3, 0xf501aad91602c11, 0x192df78b37fb37,
+0x53b5dbb961a8c3d7, 0x92cd2fc959d693e8, 0xb76b09467f01bb2a, 0x7a912b681657a82e, 0x78d6a428f6e8c26, 0xaf68f58636d6c3f5, 0xe7144130c12dde1f, 0x23d0bde5f5c0c0,
+0x1bf08b36a5181e07, 0x6fee26d63fd6d9f3, 0xf4600638b8a000ad, 0x95a71a77f83ef707, 0x66c290996dbec194, 0x179d3acc9a54b8d7, 0xdb9334df62bf7313, 0x142b500fc6ea78,
+0x8dc81b1791577d69, 0xdbe49752cd507631, 0xce2795aaf59e2bb7, 0xb38cc1b3220c2762, 0x2bdbf7c667cfd33d, 0x2f8658f790565b53, 0x172ae38594d0a033, 0x25dad03a1c2361,
+0x41fbf1e190b4c6b8, 0x86bc4e8c911f7164, 0x683816115099d136, 0x952357ade621076, 0x9a4acdd90ee870b3, 0x3f1a3b5c44294382, 0x36e78468eb62b975, 0x35d80d75e99c3b,
+0xa8fe70d5806cc71f, 0x10e16a8d72145f33, 0xd612b61a2efab7af, 0x3cff7bd03534952e, 0xc28fd239bae71b72, 0x34cfe87fe7424e58, 0xf669a119840a237f, 0x35b3566567fa80,
+0x58ce347ba7862d43, 0x5a5757d50832ea95, 0x6671399c09564291, 0x9fb16314f9370fe8, 0x3285916a0bc688f1, 0xa42ddbd7c4a1214b, 0xdc008e34e3e42bc2, 0x3eb15ffceb59d4,
+0x14363911c9bb0680, 0x3d9b4d7f83e32347, 0xbf132fef23bd7b6, 0xab150b484f3bcb45, 0xcacbd2ec7b55c93e, 0x1d63b196ebb56512, 0x112c7510c7f1b42a, 0xccccdefc96fc0,
+0x4a613cc203ee5c02, 0xc81e767d21690f5d, 0xf40bd4b57da764a9, 0xc8def84f2c7f5874, 0x35cb6541e748483d, 0x6e58bbe9a3e1440, 0xfda85604aab25cef, 0x309686c84aac8,
+0xfcaa9edb82a6065f, 0x9bf1a72fd4ba7f2c, 0xde57a3a05da9e64c, 0x1a20e92c1ded19a5, 0x6dcadaec9fa7f808, 0x5ca8e407a2a37175, 0x2a95c7a08b7dc3e0, 0x290dee95f437f0,
+0x97a55f94a6cf6279, 0x7ffff5ecb9774a6, 0x19a427c9a7f4571e, 0x746af370b5bcb1c9, 0xdd3b1cb2e9e58267, 0xce79343a14196972, 0xbd41b0e64233c1e4, 0xb76410bb06310,
+0xaa676972c0d8ebf0, 0x2b83ecb4190ad5ed, 0x68c69626583abe65, 0x295111d16a65105f, 0x7a5bf15a317af63d, 0xece7ca6503a70d82, 0x5b36b80983371dd2, 0x25a0c29310caf1,
+0x15e2849cb46ba1a9, 0x7e64fb47720ffdf5, 0xbc55f35d02fdf038, 0x9b20409cd4ab2974, 0x5724d8003defcda8, 0x35204afda237e516, 0xea18edd18afbead1, 0x211b474ccab7be,
+0xdafcd3352232827b, 0xd27981253b6b32da, 0x402f2d30eaac8e45, 0x7fbd132a49235014, 0x7a1e7def3fe14162, 0x588965d6c3076911, 0x1f8ca62b9593bc2a, 0x16851988b75cba,
+0x4ae36f2048a18a86, 0xa61a45488d5d3b30, 0x30c6ffd1eef6db57, 0x94e05ecec5f1ffb9, 0x446980b73084a487, 0x9f78dde83380b5e8, 0x78c110df39f7b638, 0x3b9634bcab8a3e,
+0xf6464ca151a0007d, 0xc925603dd41feb1b, 0xe6542db180cb1b4a, 0xf075c1f2906adc1a, 0x24b5f5843795fb2d, 0x47f05c330282fd78, 0xe6ff2575bb01960a, 0x188f7bbeb51dd8,
+0xbec, 0x0, 0x0, 0x7000000000000000, 0x1858f371d28a907d, 0xd89de1dfb7fd9cc9, 0x4022a097759f1ef6, 0x348c1710aceddc,
+0xc7670a44560f938b, 0xab8547b43c3479d3, 0x3d569f5772456bb6, 0x17b5b53c0fa23b31, 0x38210235af583ade, 0x49a527ddb6cfefc7, 0x76288d14f23f037, 0x1620c022598276,
+0x4adaefe995b2ebf2, 0x5adc1a1df195726d, 0x464b2b8bfb5b82bf, 0xea56c0468d11d370, 0x6fcfbac133232bad, 0xb59037d8cf657518, 0xb75c0800ef6717ec, 0x303750af221353,
+0x42ac6d0e16d65e7d, 0x8651d2136af13c12, 0x4a305627fc21f90d, 0xf348b1934d77be95, 0x3b7b6577ed6fd676, 0x8ffeec4ac961c542, 0xef6827c15c2cb797, 0x2985d5648ad082,
+0xf8252660a30bf22e, 0x2929d3ff905f41ae, 0x2b40b2506b2f6066, 0xa0a00009e8e43852, 0x8b1de69cff614e36, 0x9ab2c8637ba5dec1, 0xc688c0d07bc6939e, 0x324286758f5a01,
+0xd531e77ce1015168, 0x7111dec439575b9f, 0x99eba58aeacabce, 0xb777689ecc6c0234, 0x47cbb698633deb34, 0xc0750a53731fd5e1, 0xac13634c0b24ab40, 0x38aa1cfdb58945,
+0xa9c6589ab75c873a, 0x89cf473f35598cd7, 0x8294dfc54caa514f, 0xd08dfcc500d72fa0, 0xfb60ae960e87b98d, 0x52cee6779432915b, 0x861ba777c28cf07e, 0x23c787dde3cde0,
+0xa32cfd9d88882255, 0x6ef8ca4d4cea23d8, 0x8d3975b70f95fadc, 0x8047a5f6e076ccdd, 0xde7ba404bc8f6c1d, 0x1138d4ee9b802a7f, 0x4337f39d5cb81fc1, 0x14648e23e0bf9e,
+0x26d0aeb54ff294c0, 0xe0d6fa1a662dfcfb, 0x9146ec9b9dcdc3e8, 0xe7b59d38b43c3128, 0x8aa47d365f1c6300, 0x170be845681d45c3, 0x73d7d987a2440090, 0x39cd4570222c03,
+0xdf0e75ca2a67f7cb, 0xeddc885ee3e897dd, 0xe8fd264294943771, 0x9b4a143bdf642ce0, 0x31b59a2f3fa4fad5, 0x6fbe6723535afcb6, 0xb7b4eade2654f0a7, 0x3d0e30617ad25d,
+0x87fc0ab2e7b14f9e, 0x7fcac4b636f3d3b0, 0xf7d4a3733b0bf434, 0xe0ef6fb9f356e59b, 0x1d5c8ebde9a1f974, 0x7f524ff9e0906a9d, 0xcf94f38d32d2df4f, 0x23fd7ed61e578,
+0x20757611db1374f9, 0x45fe0c955e97f6f2, 0x6768e45b2924c757, 0x7577c61f5efa48ff, 0x489c3aef79401d1d, 0x743a982018112233, 0x15b457a25620bf06, 0x13021764c4303,
+0xebe812c41deb35ee, 0xfd4a3a73fc9fca60, 0x3070bbd908df417e, 0xb141fbacb5c866f4, 0x4aa127c20e87e3f1, 0xa77deaa26700a74, 0x4e77ae2aa467f7e2, 0x218db05a7d4662,
+0x3bbacf90c14bad9f, 0xa8b043a2d71c01aa, 0x4bf8293b3723dbc1, 0xe8d8cf303ce3894, 0x5c131d07742518f2, 0x5070c98516eb6874, 0x98dd8fec61e1e6c6, 0xb453b67a2cef2,
+0xf75f305929a5cb1b, 0xe4a3581508c01e52, 0x4b271abb040db8de, 0x50256cdccf80d53d, 0x6a162bc5574695e5, 0xe5f6ddcb832ca671, 0xa67fc3d7efd230ca, 0x1ac1e1575dc2eb,
+0x17a8ac9e7ff6c508, 0x17b454638b60a6d4, 0xbcae70c2e4e573d1, 0xa953aa5c122d8f90, 0xc30ac5c0e85c3e6f, 0x6112a89be087e353, 0xd63582f4fe68d8b6, 0x2339cf326c8ce4 };
+
+const uint64_t window_for_Bob[(1 + WINDOW_LEN_BOB * WINDOW_POINTS) * 2 * NWORDS64_FIELD] = {
+0x3f9, 0x0, 0x0, 0xb400000000000000, 0x63cb1a6ea6ded2b4, 0x51689d8d667eb37d, 0x8acd77c71ab24142, 0x26fbaec60f5953,
+0x1c4c7addd4f8363a, 0xaa3d5c25e1e5c316, 0x6154b05446dd4a24, 0x4a252561f82ee267, 0xed73acd2395cd661, 0x68fb6775625746f3, 0x2c719ef645a9da4c, 0x15231a8f93cdd4,
+0xce333b218b3c3d30, 0x7ca5c7ac6eab0a83, 0xc2371676c024a76c, 0x61304e12c6edd27b, 0x938f051d73e2cbe6, 0x78c8ece70ffa0657, 0xffc1419d09632a6f, 0x178e0789f845dc,
+0x260342ca247481ba, 0x26fcc11f14a69c34, 0x897cc2894d3afc9d, 0xee5e15771145dcce, 0x658928cee51a6df5, 0x26c812554ed3d099, 0x47e72cc3b447c39d, 0x386030b1c65c1a,
+0xbae0950b79d4de26, 0x5c8463b6aadd9e38, 0xaa90d5a6114a36f3, 0x24fa3f37a7db8cfb, 0x1f3a77510ba60627, 0x4f19c6d97055489e, 0x532746192c836ffc, 0x31ebcd98dcb4fe,
+0xe11540fc5b29a0e7, 0x8dca319dac027a8f, 0x92e673f62b987efe, 0xb8906203d9dd58f1, 0xa371cbbe73730780, 0x9731d7a785f1bd77, 0xe489d1a1dbe926b5, 0xe48de81a0acc7,
+0xd11a273abf5ebe45, 0x5db7fa689dfef653, 0xe2c3f25b94f2b782, 0x9110c8e897089ba0, 0x554f3e3608e6967c, 0x751703728af32f2a, 0x159a2413d90028b, 0x29210367aeb4e2,
+0x2a04e952dcf4611b, 0xb1ab04f76c81645, 0x76089a81e075fc6c, 0xdd98534e2aec4964, 0xd0081968c9597448, 0x4659f1b91a05218e, 0x5f3d116ed3084cd, 0x2bcb5b1d5ac652,
+0xf14cd15a39bbaac3, 0x96957658466845f, 0x79d0067d21d71d37, 0x691a4dc7105b3024, 0x23a3476146a92fdc, 0xaa70a90cf704aa62, 0x6526e02fbd6512e9, 0x1ccdb73d270480,
+0xa8cac118404c0b65, 0xf0d7454c04844a5b, 0xb65f9fd8f4c0464a, 0x50437d5357de8947, 0x65e943839619b02e, 0xa7325a470940f4b, 0xf6efa6934e9deced, 0x156fc8a4141bde,
+0xce94415b8efe59af, 0x110d5b1b73f4438d, 0x82324febaea09b0c, 0xa432ffceb52b5216, 0xa0b46df212d70139, 0xe22f121f5b086572, 0xba0480f51774496e, 0x3dc961b9735eea,
+0xa4dbf6b42c1bf451, 0xc4ae4b6d634a209a, 0x587670f1994f5104, 0x2360128141d4c3ea, 0xf1323d7df43cff54, 0x69c59f16366eb4d3, 0x9237e137765903eb, 0x1f827febb5db5f,
+0x87b6037864f8808, 0x9bc27d9bfd1169ff, 0xf8a08c19761fb1f7, 0x99273195a70447c6, 0x28ba3d8d4e26d889, 0xb24cc0e1ec5a5fd7, 0x6548837178f8d29b, 0xca7bc3507f84,
+0x925c88027bf08717, 0xcb2e799ac1242c67, 0x12ac929c650b2dcd, 0x6e0d1e24421c613e, 0xf9065f20e1c298d1, 0x9799ca3d9016c259, 0x881b0152fad05718, 0x3171e79a0d1fe6,
+0x592420935e52bb27, 0xf26544c527b14b1e, 0xe2c2548f45d33d9b, 0x524d091952e65f90, 0x6679bc0ebfdcdb23, 0x349ec5510313a65, 0x5a9d9687a98f93e0, 0x1018ab5cba01c1,
+0xb00573d2d36dbd8a, 0x35d05e8db258368a, 0xb1e1e485cc84cac4, 0x6acd49ccda9091f4, 0x8e1bc1ccab6f5933, 0xe4521adda8ed464, 0x22689ff4e528f3fa, 0x2bac163c4cd215,
+0xce351106094997eb, 0xbf1c26d2ef431534, 0x6aca92ebe69242f0, 0x244042c57caafeab, 0x5cdb0031ec54fc95, 0xc05be8ddcfc2d09d, 0xea7ef4d8fed0df6c, 0x326171f0191193,
+0x425c044cbcc2bb8f, 0xcf3cd5b9cf67784b, 0x7321781fdb7657aa, 0xdd280a648c6b9ab9, 0xcc4dc6d35bc70edb, 0xad4baf09e95fd627, 0xde57356250572c42, 0x164b84827af7b1,
+0x664786c696babbb0, 0x49fa5261ae9eee48, 0x6992167f620cf637, 0x7e0597cb2a94170c, 0x65a2abeed5fbabef, 0xb6b3ed853ff50d69, 0x5dad2be3546e65d2, 0x20b9abe7f5e342,
+0x368f021b43008980, 0x3589a630bd317618, 0xd8b9cad661231c6d, 0xa8541155c4712a08, 0x705054bc126b6656, 0x9c78590c8c03a70e, 0x39c11148977e0efd, 0x19eeec332491d6,
+0x32e8f009d5668a9b, 0xc986b034c4714fce, 0xd70d4fe0bcd3a32b, 0x38bef862842cda18, 0x74cf192350f9351d, 0x74a98e0b926b07f, 0x8bdf5406a70a2f84, 0x1678595d5994d0,
+0x37a8b88a2e0854f1, 0xc922c5418c2ba9f4, 0xefc73f929283993e, 0xf16d65051eed1779, 0xeea412ccb281c606, 0x8cad7e93d5bbf894, 0x12239c5dc855911e, 0x1b849a259c44fa,
+0x151dc4dc0ba43ae0, 0x76b06344bd8f02aa, 0xa73b13b2616e180, 0x129e292054fdaef2, 0x3b4be41d9c11a585, 0x3289f2fc3da92ba8, 0x59996a0944884057, 0xc6ea02b68c364,
+0x4774248cf086f2e3, 0xdf569587c0c7d3d, 0xc2f4c77054989474, 0x60bc23fcb8f2cb60, 0x44e1dbf685126069, 0xa299c32ee2fbc944, 0x6f9c791272d53745, 0x18e5019835f1c6,
+0xc2873bbec7b7cbdc, 0x22cb973968183f59, 0x33d4680607909df4, 0x2f0d2bc136ac568c, 0xe447c70f50fe0d86, 0x51559c91f37b4805, 0x72596a8e7a92d4fb, 0x54835c36a22a5,
+0xa7432337ba7ffe25, 0xc78807c1f3c4b8d0, 0x44c554ec0a61413a, 0x790f39cade02cbc0, 0xb4b9ed6ec134696c, 0xe41a0440b97def65, 0xe3047e2b631b18ab, 0x1b78f6d5d933e0,
+0x264b1270e0eebf92, 0xc0e9795880ccd4a, 0xb0a371cb12c0e122, 0xae4747b82c5d04d5, 0x9fc40c15a424c16c, 0xf5c05f858f843c4b, 0x3253f897613f51d3, 0x304117563ee96d,
+0xf1849afc87bd68b6, 0xb0c458f7582e3786, 0xbfdd809a1dc0e42f, 0xd5d9372e523061d8, 0x314da10d67578879, 0x599384f20bbba860, 0x5e22f63b0c16687, 0x2774280517e574,
+0x54872d6b7d9e2b62, 0x45ae29152cbff425, 0x7093599019863387, 0x2f21041b22973574, 0x3874763c9d38c52f, 0xb0b0305dfef2cdd9, 0x2ef10363f5a46eda, 0x37d5e44f32f153,
+0xc857ac6625daad6e, 0xd16611374d70bcbb, 0x5c22e5b4292c113b, 0x785e941659980ede, 0x21e6f81aaa877458, 0x5159d56c7b86ba95, 0xdfa11cb946bd4cd8, 0x39c0a5eba23105,
+0x213ce9be616bd97d, 0x333ab6ab515f798e, 0xefbde0a9d7f3d18f, 0x491b9fe6b2a1f134, 0x62b5aa7ff6b2fa73, 0x727a1884177c3c70, 0x3b38c966d3fa916c, 0x38035d7483bbd9,
+0x149c4c85289318f6, 0xd36b4ede12ac1ed0, 0x6c9597fbb787f676, 0xc2652aea72cde6d8, 0x3c3a71b9593de148, 0xf1ddd1e597bb658a, 0x806ba56a3c0436f8, 0x1a4ee7826b5f08,
+0xaae35765f518248f, 0x40f3c15e8675c7e, 0xcbff242d1a7d6860, 0x2371779fad152b58, 0xfd6b904347687b08, 0xd5233047a10cef6c, 0x2fe2109c4fbcf6ef, 0x173f0b3427be08,
+0x9bed3ef70b279c03, 0x7882d125dedd3a31, 0xb53decfb44c200a3, 0xbb976cf9694eac4, 0xda10b7b348882b16, 0x3bdf46696c1be830, 0x2357030b1be2c620, 0x4055e63f2b08d9,
+0x9c51838b63d5b0ad, 0x538bcf0210b20400, 0xed390dc88c991c14, 0xdd014fb38154e0f4, 0x54db3e86e31a4ba0, 0x693e31e6d5bbd293, 0xf61e9daf557fe2d7, 0x2f6a4af152e10f,
+0xfc56c82dd0ea3f35, 0x5a11948e2cea35af, 0xe70ffadaa51ea289, 0xddbb70af691ca641, 0xfa86a1e4aa237a3, 0xf1d633ca45a54f9c, 0x24ef3843f133aed, 0x81b5468e94c63,
+0xe6212802fcae944, 0x4969960eabac81db, 0x34d0f5201bb4e8b7, 0xe8df4bc439e8e17f, 0x870592a244c0df26, 0x3db04ae632baf162, 0x914aa1173d790339, 0x1525c958ac482,
+0x96c9f4f83cb81b0f, 0xac4bf17eefe59fc2, 0xcab03acc2328bcbe, 0xddffae55fa5ce0da, 0xacea8a43a06056c5, 0x19279c22f31cec68, 0xc9f2fab8eac54345, 0xc9c4daf02c9ee,
+0x5681887da4e0f043, 0x18a106e2dc7cbc86, 0xc3edee003ad1d70c, 0x9f9f03cf40fcda4b, 0x7fb232d4388e686f, 0xa6a394cfd6c07d7e, 0xbe10d650c6a00fca, 0x11b6f960000e2e,
+0x6de3156c8fbceac3, 0x1eadcd6cf18c7852, 0x57b4cb06d332e8ab, 0x68cc8bc30de89541, 0xce0bf6921b51533d, 0x71d9bd4be9c32d1c, 0x32397d1db73ea0fa, 0x2802a31723d82c,
+0x49469d2476ee4379, 0xd61fe4221472189, 0x43f7f33d966c4e08, 0xd440fd102dcc9697, 0xa196413c76577d31, 0xebde06699ff1e5e1, 0xc770ab46eaa06027, 0x29e82291ac67fe,
+0x6dee173b09415a15, 0xe2693e60318f6089, 0x2758833fb09eb3d2, 0x2a89dbb6b247dca6, 0x526738d46b5a698e, 0x734bd2799bfb4dac, 0xe54e182557f415a4, 0x2c541d357b4e66,
+0xe1ec58889a736fba, 0xb29274528015507c, 0xf82842f4f12cb474, 0xa58c2e69a70e8d34, 0x646bbeeed5ab2ab5, 0x5269eea7f11383e0, 0xa85bb41759138b1, 0x27b202ed2ce9e,
+0xbd2afb74d16671f6, 0xf7663148fd273b81, 0x1636a71d7b6531cc, 0xe956375e1113afef, 0xc5d9792e2fa9d195, 0xe03686a9ad3fdfcc, 0xa56a2c55da8485e3, 0x3090c9419f4234,
+0x49c7231efcaca5a1, 0xfc0a630f66a7902d, 0x67eb2a28c2723bfb, 0xf819e648fbfa2616, 0xe65980b449bf8450, 0x63a5a60a75ce0cd8, 0xfc316baedf5861f7, 0x296b69c6e19edd,
+0x752f10d8277ff47e, 0x47d76ce511a75b9b, 0x4af32934570000aa, 0x59e5d9316845395d, 0xb512db5fb9a15f13, 0xfdfab67e3c4cbbfd, 0x24e83b2d735254a6, 0x1ecb91f83be147,
+0xe6b17d2bfd77d78c, 0x2645220266f361f3, 0x732a3d71f49cda10, 0x5d09b30ecfe1f789, 0x8ebaa3cd796fd5e4, 0x22b2b5e264e9c196, 0x828d8f4d449f3f80, 0x3937c8c70cf02a,
+0xaa4b589f75e77b06, 0x362b2dd3d94fae21, 0xbfa085756afae297, 0x7a02ce0fc079b2b6, 0x1970d90b267b414, 0x269950e1b01613eb, 0x3a41554f18ce5cc2, 0xe8e24e49e068a,
+0x68de81ab29c25d41, 0x3da9e69f1514df0c, 0x99f3384e8ee5412e, 0x572541bb4ac55b2e, 0xcc0cb055bc277e2d, 0x4ee0cbc0173bc67e, 0xf6b5b5b178930e6, 0x8321bf5633b1e,
+0x3d640fed213d88e9, 0xed6f82bb6497fb3a, 0xc1da3af60b689851, 0x7f45c28ddc3d09cd, 0xc2ea6d20ecb53e26, 0xe18caff74bdb25eb, 0xf00aecf917f878e5, 0x1503a89467dcdf,
+0xa907404813e42fb9, 0xcb4fdfaf4ab912bc, 0x233ef6f8a28595c6, 0xb794bff606859f6, 0xf7c110981c7c314a, 0x9506774920596834, 0x20293ed1b670c7e9, 0xfd2cecd712213,
+0x5bf077c9b34f5093, 0x1387d976e4b71ce6, 0x55c5d9aef20b08f, 0xaab721c5642752c1, 0x4f3d5a7b5d84db7d, 0x2535f6707c542971, 0x22e4fd2b48ac8900, 0x1b7dc2431bfb17,
+0x879c59799078ce2a, 0x36f04b181b247fb0, 0xd4e0841ec6b7e6c2, 0xa7232a7ab867d374, 0x3872a544b2afbab5, 0x3825ae8bad9f061c, 0xdd7178a0c338b591, 0x5c44cb5b66934,
+0xd59929aba533657a, 0x42b1d1ac1b7ad21b, 0xa94fce07ddcb7079, 0x3488a57cfb3b5f2, 0x30db3cbdc37d9d2a, 0x617c8db28d6e6812, 0x7bd316b78b9443a7, 0x3d7b495fd9c444,
+0x9df2777b6a2f6ecf, 0xd1ba658f01f0cf42, 0xf36623d85c8b1c65, 0x961669aa704a0243, 0xa5bf748c913e4f96, 0x1666f7c9309896cb, 0xe87e04a223c91625, 0x15843ef7622c9b,
+0xd6b3a28f461580e3, 0x37188340c042d8ea, 0xe8a22762592e0f86, 0x29ac44d8394ce45e, 0xe1d2e2a8d51e3141, 0x711ff4fb107e0943, 0x2165ae8d5c9045b3, 0x32d797aeb25fb7,
+0x51dfb4c7910c99aa, 0xdffb1827641bb7b1, 0x9e6007655f28f083, 0xf822fb31958e11d9, 0x3e06d93e25e9191f, 0x4f64dd9f43f7e9d7, 0x13997780f7c55610, 0x31a035d8db794a,
+0x327622057434a554, 0x3ff77c1e7822a184, 0xab2c64491d8db64b, 0x72096039e92bbc9e, 0xec3a04717434f4e6, 0x8cd986407173fb12, 0x252a223e8125bcaf, 0x11c1b505e8ab95,
+0x7f0b5a66cac7acd, 0x2b3d00e26c31e3ab, 0xf7885f8df5c30cf1, 0xccb2c96124d88034, 0x37c0a89a7170fa48, 0x333425092443507d, 0x1c91dc96e681be54, 0x2f42a4c3bd9bf1,
+0x2b93c6e98be2f068, 0xc946584b4006f143, 0x913721ea36b2b2f4, 0xe6bbdc70e58f34c1, 0x5f049f96d4de01ec, 0x6b7aba3fd8879e49, 0x7a224f5f13c480b5, 0x164413efbc3b1d,
+0x50aa16e8e18bff9c, 0x11ccfb835d83ac7c, 0x4be9ae1a22a7689f, 0x325ce991aa274c9a, 0x3f2a30b699eb0229, 0xca47876980a6398c, 0x27e6503442e04d25, 0x1e9c206eca6a91,
+0xf79f0563773859b5, 0x90bf96a6c46f3424, 0x3bba38d4f3e32fb0, 0xf15d897b078a20e, 0xe951cd2095cb9bd6, 0xd0df105eb6378658, 0xf19ec9bdf99221a6, 0x34afd573f38122,
+0x2f304a94b75179db, 0x350449343c398919, 0xf6909e3c39d6583d, 0xbe0013b012c9b7c5, 0xcf38747bd7ddb506, 0xb8b63bedf33c68e8, 0xb4a964bbcac6583, 0xae8371db2bbef,
+0x59af6d7b148709f1, 0x3261c58d22c5e087, 0xbf337eaf143a2db0, 0x4c6689a06bcefe17, 0x9a598292e0bb52b1, 0xf5bba6147fdce5fa, 0x768b51c9fafea1c0, 0x7e5c6ef9bdd7f,
+0xa7e32f373c367fc, 0x88ee84bff1afc23d, 0x4eb7e7fcf9b27ef, 0xb968a48fc1c66912, 0x16b5c3173b38ff16, 0x3095efaee9321b05, 0xf1a1676894b113a6, 0x3dc6c138e86c9a,
+0x25c6889a920a1ad7, 0xf38d483e760c23ee, 0x1e61781d150f409, 0xe406b5113ceee6dc, 0x2c952577c338be18, 0xd93140f709ff0bf2, 0x66993b2694c95b3, 0x324cf9d8397298,
+0x3472b91073c9df0e, 0xf70491303ed4d8d1, 0xbf98d630646729df, 0x1812c77a977f3099, 0x26565d375f8c4b1, 0xc396ad0c3f0ca6cb, 0x81d4c81ae19b8572, 0x4f1bbb33905a7,
+0xf037aea81ee2d79e, 0xcfa29ae7492385ef, 0xf2c5bfda0be1e160, 0x70fb7649b553ae9d, 0xc7916446ad7039d2, 0x2d6e44a177a123fd, 0xc42036b0a4d1225e, 0x1b9e16b61f03c3,
+0xe587d0190778c21e, 0x961e3696c8a7e949, 0x748086bdebda473f, 0x9e75257b6b2f8b65, 0xa0b1d758d7dd25de, 0xd4459e8c48833b21, 0x284fedb6ab589b9e, 0x1264097e5c6c2c,
+0x40168859ead870b8, 0xe88a4b64545591b4, 0x7173e2e35312a5c8, 0xd4a23a35b9774611, 0x1d6f68f8b747d9e7, 0x977315f3dbcea340, 0xd4983062a4739133, 0x12dcdaf3580e21,
+0x1c0730760d46621b, 0xc5a0feca1a3b6397, 0xea03aab2f403d6e5, 0xab2e8fb4a0f301fe, 0x1bc32c7a032be745, 0x582f3acc660329b8, 0x36b8de509ef763ce, 0x222dd2cf2e150d,
+0x30d084af792dd465, 0x390528f6f01038b1, 0x85bea165a6e07ff5, 0x69dca83ff0118254, 0x3c8f3a1322083516, 0xf896f0061a73d021, 0x5e506d10dfe801e8, 0x2555428b0ba11d,
+0x1f6eb8d901d59ac3, 0x5c8008a970d5cc05, 0xc289cea669982c97, 0x8b826b863ce3675b, 0xb3993228289c52c6, 0x7f5eda2eed2f112f, 0x26d26ed2eb2af21f, 0xfb34175f0c407,
+0xb6f33568a6d3aae4, 0xbf528020a6fa6f18, 0x39a3f9b4dfd052a8, 0x46dd57c6edebe3c2, 0x2b70e6cc46ac7d5, 0xb34bc63115722316, 0xacd9b5cb93ec1cba, 0x232aedc5249276,
+0x949923f1ea91f625, 0x6afc918d04f4d637, 0x61c636cccb822245, 0x33ba377936d96fa0, 0xa1e2a256cb1129f3, 0xf34d99a98d423ecf, 0x4872c04f4f4cd7d8, 0x118d0a7288b704,
+0xd8cc61c64b21e981, 0xc777a8df79ce66f4, 0xcb205f49465bcce8, 0x749f881cd7e7c78, 0x421f4a43af72fd14, 0x9851332f697d8bcc, 0x8fa251368e07dfd7, 0x35fb88eb635b26,
+0x32c97552488d8c2f, 0x602878df483991b, 0x3839ae7095122c38, 0x791075a246b0ed83, 0xf4d2953ee56e408c, 0x4a63a5d706dc813d, 0x9dd394327c3525f3, 0x278830a94d922e,
+0x977239169ce5e983, 0xc93abb29153d84b7, 0x2f023dfbb993a0de, 0x4d58f96c94fd6b91, 0x7992b01cc5c908a2, 0xe774a8fe2ad0c91f, 0xe2950d92239a0310, 0x15ff58af5171b,
+0x6954fb8f65d38ff5, 0x33bee9aa71614778, 0xedb5f829475e59b6, 0x6aee61d4b7d682ef, 0xf22473e8717e3783, 0x7c3269e58d67c9eb, 0xa4d729eac89a144e, 0x3feaf559643b30,
+0xaa2b46fc6a61d132, 0xef93b1ab5bbed9f5, 0x9d07c81a7d9b9ddb, 0x117717336398cb2, 0xd06b793c08374f9f, 0xc58c817b6192b411, 0xbef5e1287fe2da4e, 0x117f02a61dfe05,
+0x7a697f59ff0ead63, 0x18669354e3ec7d59, 0x1ba66a52afb4dd62, 0x46b227ee2876e20b, 0x392dee52502453fc, 0xf2f00ff44066069c, 0xcfd42d0b0c276747, 0x3b6182ef0b34bf,
+0xe523bc8dd91162e9, 0xf5d6b3653ba3c931, 0xf9f0409f472753a, 0xc9d54bcb094252fd, 0x45d75e0c4abdf976, 0x830c620b16a0fdc8, 0x7d1431629b27a739, 0xb8c9e3cfcffc,
+0x7c483ca7088289df, 0x7a0554635dc715ae, 0xa3adda49e0444e63, 0x4f124170fb902040, 0xf525d3269fd25ce5, 0xf29f3bcdab2a5b13, 0xb38fbd28718b377b, 0x4011a271f9abda,
+0xd606178514e72e3d, 0xe853db3861a4eae4, 0xddb9a7e10cc0dc8, 0x51bc88cb990fa6a6, 0xea8c40442573cfd3, 0x6e3d7ae2a18f2e7e, 0x3df795c938c78b74, 0x2c2e6e794615b,
+0xc818f7388ae97067, 0xf530e93d54d35eea, 0xcfc7a906147fdfe1, 0xdeecf01e153571d4, 0x4ebe6369ad43109c, 0x41c57f22d8626a31, 0x600bb94e072afc84, 0x2c241c480a6adf,
+0xb4154d74445038ea, 0x560ea8229b5e83d4, 0xa9d3f91b9af40f49, 0x78979277d7bca666, 0x79ac2ffd2c3208c1, 0xb2ed7df29eab95fa, 0xf46b46560f8c933a, 0x14b263f7de0f9b,
+0xf58f45f5493f1308, 0x32f493afb2565d00, 0x3fb13cb601b39660, 0x806b6b6a972176b7, 0x2b9cc8c3b4b34841, 0x6db91043d17b26e, 0xfd4066bddfdb8ccb, 0x11b97c40797b08,
+0x7b082dd78cdf67b3, 0xfc3b4eeb1b49148b, 0x2701340d4e9463c5, 0xc8e87568f6b4d0e4, 0x1444d90769b4bfca, 0x1cf2c6db1dacd493, 0xcabe9c3c447448ee, 0x3043fcdc6b94e0,
+0x6a5964bc0ab1e68, 0xbe9365c2db9dddd7, 0xea7c9072985b5642, 0x2654e39976d7f9d7, 0x816ea47533b83413, 0x53a215c47876d690, 0x6a45c0a149e02cbb, 0x189d46ebe19db0,
+0xec97ed368ec74993, 0x533b4e295234d6b5, 0x5a54c4a21861d6e2, 0x9708fe74ebd24830, 0xbf213b04fdbea326, 0x23460f12f3268e8d, 0x1d36ea1a5b7e5d4, 0x3cee3cb660d44f,
+0xaab63c1e4f0e496f, 0xcd78656c89c87f42, 0x1bb6df23601050ba, 0xb73ea9186df37eb1, 0xfae9a3f65ef443a, 0x69ae6ea02677ae2f, 0x431d3ad77f883e6, 0x23d2768d58f617,
+0xc9cd86d34f9fb036, 0x15b45b290ddee84e, 0x95005f92d1698f1a, 0xf751b2e555402faa, 0x58f4f12badb92745, 0xcc3c0ad1874e5e7d, 0xab0800ef33dc0c2f, 0x1fec2367988268,
+0xa8e09acc2db04913, 0x7b16abe7dfc3ccc5, 0xa82c9a5387797cd4, 0xf74fc0d2cc1a3e03, 0xff7e125295866eca, 0xce9a70277d61515c, 0xca597f0e9836a3b1, 0x50b2d2803c669,
+0xd348597cdaf6132b, 0xc1bce3e72e93259b, 0x70cf2b7c4459a406, 0x81a0173c78ea101f, 0x7ae901e60a2da53b, 0x33187c0601237ec0, 0x4288be3e658e39e3, 0x3553eff2ea2e42,
+0x76510acdf7897e5f, 0x5dbe91e3272792d3, 0xcd7e5024c3835bd8, 0xfd380abdfad245d4, 0xf57a506c16be529a, 0xccc2d458f36083d9, 0xa3ea11ddf085be1f, 0x1aa707fd0f932e,
+0x53317f51ece5ca54, 0xe2f5d08775e78078, 0x1f5d868dfd8ef156, 0xb4861ef14bfb11b0, 0xd60b33854408d1f, 0xe404d8711d93ef27, 0x66f554ec9dbca76b, 0x141cc94748805d,
+0x1a9b4c3142a933f1, 0x64f2d8ff537c2763, 0x4f1d9f4d88fd9227, 0x6d0d515e5e1b33af, 0x9db2068a539bb691, 0x2b39e0069f0a5aa5, 0x7cf0974a14b89840, 0x19ce4a0ecc6d06,
+0x84a1ed08fa9ecc48, 0x88c2ecdb3714c071, 0xbac1fa3f0c48c8, 0xaa65547c319a2e25, 0x63725096ac07a374, 0xf4a7766e3b3473e0, 0x49c46124669acf4c, 0x146d1e56728d,
+0xf0bd5c61f9d900ed, 0x6a9665d9f6677dd9, 0xf6ee3a25228387b0, 0xcc55c5f641741e1d, 0x2bc5bcb26f565154, 0x8c2b70a08c03069e, 0x26fefa378df4b747, 0x388fb1ec6a9f32,
+0xdc97cc2647c27021, 0xdbdb4d512a40ebbd, 0x411dd7286896cfb4, 0x84f1e6637cb0786b, 0x62a7891cdaaa71ff, 0xf1fca93daf739e6, 0xecfd8e60ee094e31, 0x2cab0737b6d5da,
+0x8219abf4908e23be, 0xd4c7d55e2ce41bc9, 0x185f3108ada66a30, 0x40de18f27c01a6a7, 0x53758e9835409b7d, 0x7b8c040b2e8ca1a5, 0x497a2d664418a03f, 0x2fd275c53dfa18,
+0x2758c05a4c6be55, 0x7c63065ac3c67b21, 0x755e0563448514c9, 0xa62672c4de574528, 0xe288cd0764378ba0, 0xaf85215b6d71cd87, 0x2d6464c197041c06, 0x272ed74f61918,
+0xa2607699da7b11de, 0x9af1944e06546506, 0x5fb9cb48d82a4595, 0xa2b990a4ae4e9db6, 0xc5043edc5aaf8a3d, 0x2bef579d199ac1e1, 0x865b06ec2c1cf232, 0x2f0ca98fbf0621,
+0x4fd66bd2728f4f80, 0xc16da4ff77407b40, 0xe91fada21c0aa588, 0x959186cb454580fb, 0xf0f97fd292d793d8, 0xf558a3209dc3ac7b, 0xc883c6895d9b8545, 0x7f39d7ed31be5,
+0x8f9f756e149ad2cb, 0x605f63163c9d8e8a, 0x9045778d87b46987, 0xda921a2c340b4bcc, 0x1730cab28860deae, 0xfa70a28ba0002c34, 0x63dafb3d2d9c77e3, 0x125546e5f9d2f7,
+0x2930340fd78dcaa9, 0xe9b327ced9dfa58c, 0xe52a10869dc38bab, 0x30c5d82bd5204e3d, 0xdbe6843b2522f4a0, 0x94861ca9a0ef1094, 0x56ff932bca1f70a9, 0x2791c2ce0d320a,
+0xacf0dd4d96bffe85, 0x352124cfe68174d3, 0x50e11b0cad36bfa8, 0xf96aa8337cc538a0, 0x6ee2834300b0e40f, 0xe5f23255b0181994, 0x8b65e68670553302, 0xac4936de86625,
+0x1742cdeeb0897d3d, 0xdd6f8e0e25e6405b, 0x12a8b7d33f61f82a, 0xb620b6cbf6921acc, 0x49abe3a19746e7ba, 0x76f708e887b95afe, 0x21c74dc7cda4b179, 0x2271378f586135,
+0x7bae5eced94a2f6c, 0xd59a290a5d6a02f7, 0x33649da09f84639e, 0xf892761bf08e0c8b, 0x76073d290d6aa3ed, 0x91bd2946eb35ce6d, 0x112b95f9b40bb83e, 0x1ae5bc84d37f20,
+0x6cc4c7931807eac7, 0xd784cd15f0214391, 0x999046efce6ab942, 0xc5309d646cc53cc6, 0xb21edc3a52e16698, 0xd4565be4fb0add16, 0x3a6f1cbafddc17b9, 0x1c9dac3f1b21ab,
+0xbde2d8c6c02ec897, 0xe74a2d245dcdc1e2, 0x75d18b57cee98138, 0x9a6a4e1714cde842, 0x28d8e628ecae7d11, 0xb7c67177efe53916, 0x4d7274ee59d779df, 0x3d4561369205ea,
+0x641be6f47b75339f, 0x1b3fef732df47e9c, 0x659d0fd4d285eebf, 0xaeac2c118347f5e2, 0x9e8bba952fc39691, 0xee333d2a77191c3c, 0xc664707911a7ded, 0x2f7132df454798,
+0x45c2429c2a03cb8b, 0x9634d0043e57fc5f, 0x2bc0c2561e0af73f, 0x82c0b3023ec387db, 0x65c9d9092a9e486a, 0x369edde8d0ff658, 0x8f1124c2f2156610, 0xd6bf7f73d0b5f,
+0xe2e34919b90eccff, 0x30f97c6d322ec847, 0xea43d0fe108f5cc3, 0x93cdbe92422e0819, 0x2deff8534eba8cfb, 0xcfddbd62a1583e7b, 0x8ec88e4f46d4af, 0x16600f139a03d7,
+0x4dd86c57c3e1cbc9, 0xf4716a9150cf9537, 0xf01fbeb7f63a6229, 0xd12fd764da29da76, 0x9d021df7a7f1bfdb, 0x72f2cef9c99c8ef, 0xb1d34c3548075c5e, 0x90df77e74469c,
+0x3a7fdfa631836a7d, 0xf2d034325807b54, 0x45ede5777f4c630d, 0x8a63e0466bc97732, 0x1fe89968192755e9, 0x23aac365b26bc29c, 0xadc9727c6a57eaa7, 0x71191ac115eef,
+0xec683ccfd0dee8a7, 0xdae43c669eb012f7, 0xaaa5e965854a71bf, 0xd098e3fbb4d07701, 0xcfc44c8eb846892, 0x679672f605a3a24c, 0x69e0bad2b151ceac, 0x194016866ccf27,
+0x10a177b0d721d558, 0x830733fc6ebe7204, 0x3741836fa02e9cc2, 0x2ee946c352a58629, 0x7ead2837d58f3, 0x949bc567b6372ed, 0x7d82e2ef6f34f781, 0x30f8655c5e8aff,
+0xd3beb80599c54142, 0x6aa69872db6d359d, 0xfe6274e9724feb23, 0x5bc8735154809fdf, 0x617eda09c06bf571, 0x46787c8525add619, 0xf44ebb571073299, 0x721eb12de078a,
+0xae0d33d27e308678, 0xf515fdd10ed158e8, 0xb04500b05497be37, 0x39bcd8a19d6241da, 0x1752f746c543c5a9, 0xf3a7290a4c528e4d, 0xe4d8229f70afedd9, 0x35d1686b0e29a2,
+0xf4878af1a86d0fc3, 0xf6a115d517b6e34d, 0x5ab504bf03e05f67, 0x82fb674023b3a370, 0x3123aa5b61e18cbd, 0xebf9f424610e38b8, 0xe0372265bf6960b9, 0x2145c7f1f64b4d,
+0xda16ffe7e0177615, 0x242ce24327d58bbd, 0x5b95c023ae30eb61, 0x1c91ec3f840df388, 0xcc5abdbfc84d64bc, 0x51e0211450449b1a, 0xa7e9abe27cdadc07, 0x134fffec8e6b8,
+0x6f63887d632cdc6a, 0xe1fe27652ae71b73, 0x1280235805e1550d, 0x9c9463914a16cb6c, 0x499b1979e420a4d4, 0x700043f36fd8a41d, 0xeb345b974d44fd40, 0x25ec28acc7146,
+0xd5fc02348713f8f2, 0x934d778644bfcc7, 0x12096270c2d2d998, 0x42fb25574251436f, 0x3295b2f3ca6df290, 0xbda152fa86e25c1d, 0x7391cb374b270b2f, 0x18b3fe4bcc677e,
+0x2e032774e1970d4b, 0xd7caaebb04e21aed, 0xf4de66471275d35d, 0xfce921e035dbb0ce, 0x1ba3f581492239df, 0x7af1f2f814eb07c8, 0xd7d862f74bad9a4, 0x3a101a851b781f,
+0x472d8e02160169f1, 0x6f03d576f978d220, 0x2b44287193bbcd93, 0x37ee46ca6eee8348, 0x5612ecfa6a6bbe0c, 0x166226b46cc785bb, 0x12d7513738c10260, 0x102de56eafc3eb,
+0x3ce6a7bdf0686752, 0xff5f1d7ce45d60ba, 0xce1df83794f50f51, 0xe764d7cf8b4195a4, 0xfd97e7786d3f2143, 0xc7226c74682f3a40, 0x8878398dbcc9889a, 0x3bd19b036477e1,
+0xf76007710f519f1d, 0x9c6b112d1ab2464f, 0x9319fa36f252d87e, 0x1f5fb8f280a524fd, 0x87edeeceeb05f1c5, 0xaed04591b494feb7, 0xd413d2f123498658, 0x5e6e4d1f3ea75,
+0x3d6e5c4507bbe86b, 0x56029a3eb2edbe47, 0x8608c014321dba8b, 0x5e46c6fdbd8e76f, 0x76d538b59041d65c, 0xf24e8af0b7233b18, 0x1e75edd9b0318f74, 0x131bf0d6013178,
+0xd58d030277a633cd, 0x72d7d7dc2c3ef745, 0x83a986a8094850f1, 0xcb1e96bdcd598830, 0x5d67a75f9ce3ac4c, 0x9fb388b77aeef416, 0x56af4edab80d7957, 0x77b2d36f2b9c1,
+0xfa838aa9427ebd67, 0xd398dfa65788e5c1, 0x221bf34bcb9191fa, 0x6cb61724fb5cfdec, 0x9ac90f3f2b08dc92, 0xcb38bbcc3b58b84b, 0x3baa104062eefdb4, 0x2a2d5ca5735df5,
+0x89194eff160e93e1, 0x69ee626e8160f4b, 0xe127a781209ffccc, 0x5bc77f1e7cff1f4a, 0x6209e1221626167b, 0x4bf22dc0d0231511, 0x63394dafda218f35, 0x2958e80784eb18,
+0x4b760b38e6ead72, 0xcc8225401fb60e6e, 0x2b9ff2fc81bf4bcc, 0xa9c12054ed000cbc, 0x8d5d2451f3b85d0e, 0x440df135cffacb63, 0xfcec2d943ffad917, 0xe49f6d19ec783,
+0x7e66e674af834763, 0xe2f3957b0c1986e0, 0x23eb290b07cacbc4, 0x4ab347678e2282a1, 0x138e7d20d69e92b7, 0x4f9a5ce0a3a620d1, 0xb56317c31235ad12, 0x1a6065fd00945d,
+0x6b1c895ac2cf49b8, 0x3b63917e87ba5bc, 0x7429da524e9254b2, 0xc63602cb3b23098c, 0xfff00dcf9e95f99, 0x46765feb6239c5e2, 0xbe9f628a1d4c6532, 0x23d1521955bbcd,
+0xc7fb17d83ef38df9, 0x3b211fcb0fa350ce, 0x694e9b2b2ac23fb3, 0x6e3a86b3d44d986e, 0x13433cd8e5ae0d58, 0xbd409c4eae5ac158, 0x1b5e9476074de1d8, 0xf258fe46d7d5b,
+0x999bc0f678c0e683, 0x994a89d5d68ac61b, 0x272d333e4453c544, 0xb14d957d49da580d, 0x2196d4d6fa42ab4, 0x9bdde89d19ce9414, 0xa77cd53397bcd104, 0x1515218a719d9,
+0xaa5538c0160cca0, 0x68eda808364bb19, 0xa07a5479cd8c660f, 0xbda53d942c9665c9, 0x44ad5b8ac3269c38, 0x955e233e86359f66, 0x8ead0231190926e4, 0x35f710d942fd3f,
+0x4156736d5e9c9fbc, 0x197b79c6c33e8a73, 0x866ad6c5141b7304, 0x94cf732038f51d6d, 0x291df793c3a6d7f7, 0xbf4b9f86f4ce22d6, 0x9c04fffcec7d6621, 0x1e7bd7899aaf07,
+0xd7debbe49ccfa77, 0x2db5d26697c305f4, 0xbf54d5470658f2ca, 0xf48317aae5df0e, 0xac29fc8e8d9a8473, 0xfc7b854a4fd933cd, 0x31689b152c3eb980, 0x396a2027ba4338,
+0x75881026b69191fd, 0xfa57cc7ec540e7db, 0x7da0afbef649489d, 0x94849719bd636264, 0x25a50cd499523567, 0x4a2c67a2a85ddbf4, 0x36c62f7393e0de40, 0xce5ff4df7bcb2,
+0x91635dc1b2b11836, 0xeee36fd39c6fa438, 0x31d268c28e34a329, 0x2cca064322566c97, 0x4cc6843789110882, 0x118c29f757ec31c8, 0xcdeae4d8ea5a7d11, 0x336ca118801cc7,
+0x90915c1593661976, 0x54c60f174c4638fa, 0x914b967a4a5802, 0x9712b9659dde3566, 0xbb573d9103f50665, 0x590b242c993dc887, 0x66efb00b5f99ed65, 0xde8314a72c793,
+0x84abfac260dc4643, 0xf99cb525ed03f8a7, 0x98dabf5af3848b15, 0x2870164684224d45, 0xf336626d58ca00c, 0xf06b7b2a7bc4989e, 0xbd1947219c9640d9, 0x273b8d2b5d7824,
+0x76c42f593f31926c, 0xd793a419e54c7da0, 0x97070b5c9acc5599, 0x3c923da33f053d26, 0x6c7f42aef05ad8aa, 0x94201af2fb086e0e, 0xa98eebad5758837a, 0x158876bc84537a,
+0xf11c8cdf5165bce9, 0x7ca46e6ddcaf9d5, 0xddac3824f50da88b, 0xbdffa3ea0b94c485, 0x73ff09f162dafd9a, 0xe2f329c16f90ccc5, 0x25fbd83d30291446, 0xc451cf71fb9a3,
+0xd3d7f1b604fadfe, 0x327b4e396ed274f2, 0x55562c7d2cf89755, 0x4185c94f7bd38282, 0xc48e6ec487431dda, 0x3df7c5139b0a0bbd, 0xa5a20c09441a9b20, 0x162ba6be9901ed,
+0x29f6297580189be1, 0xa07033e4e0b16f0d, 0x786a13da5285356b, 0x347200b63a8a0b23, 0x2b34923a625ca0a, 0x70e7be645e9803fa, 0x7dce10a9a70a16f5, 0xca1a9d97735ab,
+0xbb5dae24c7efeade, 0x9db8797f368f0fa0, 0xd7a8118ae6c91df0, 0xfa32398c77fd7231, 0xd15e21e8ced3225f, 0xa88772fff11e8d9b, 0x1c9e344ded67c03c, 0x38a5638024e0bf,
+0xfb5e2ff823608c5e, 0x3dc3b4502adf9d87, 0xc5f7c04cfd6f903d, 0x1f5fe5480b272a49, 0xd5518c0b62dbaa4c, 0x7b89019522eb3640, 0x3a86f647adad63e2, 0x5defb626afbf4,
+0x8eebaf0fd7a6af23, 0xe22085c2d906d3e8, 0xc5c5bb14b56c3052, 0x9abb062e27959357, 0x958dffebdd994c16, 0x4052c99072810792, 0x34229ae2dfc4be10, 0x9c492aec574b9,
+0x1f9f23ca6d4d7215, 0x5d0dd04f5097d4a2, 0x28d82b4fe65f26b2, 0x4345dfbf982b398, 0xcc1b8b46f41fe836, 0x3ac23a4a73f96d5c, 0x4402ce536c9b81db, 0x1020835cd62b2a,
+0x91826e053279782f, 0xe96faa740a4cb7f3, 0x3a96df9ff52f3446, 0xea29d38d44ae190f, 0x7bedae3fec079bd6, 0x6025560e9b9cb14b, 0x6a7e03ee35d106fd, 0x105dec08956d1b,
+0x98ba8c063200c7d, 0x3ab006a7eaedf17c, 0xb625259e0f3e35ff, 0x34a8d7194ad674b7, 0x4db916fb8f0c124a, 0x3621be09a61db24f, 0xe3024fc2bd19098d, 0xa827edbe04e94,
+0xb44716a06e69f62c, 0xac1bceaf9a4f8f68, 0xa9b98b4d976312b1, 0x8af4c5e4ba3c83f2, 0xee412a07b8ff3802, 0x63c3c612a37fca51, 0x6b1b0209bd71c06d, 0x190724e22b7a48,
+0x2558a4e45f03fde6, 0x9edef8ac1074a85e, 0x4adb32adf1b23003, 0xd9e4d53fa3c91aba, 0x1760a4136000652a, 0x1b46dda3a4110cca, 0xcb93b8485fdd501a, 0x244fd509246bc8,
+0xb7dd1b7185672a0, 0x74d7af71c0c49ad2, 0xcf7c696cd2a2f4d5, 0x17fa16f71e5a3da0, 0x60b52df41fb75eeb, 0xe0320a80200b8a28, 0xcd57bc257ba5d0ea, 0xde0c05d9c53f1,
+0x627f8a46ef8726e5, 0x62e473fc6860f50f, 0x5749c2c9aa465987, 0xf4256829585e4ddc, 0x570c217880cd5027, 0xc86311499f00f28f, 0xd9e08304fbff01fb, 0x294a916e5901b2,
+0x245931e25376cea9, 0xa04e40466ea9c6fb, 0xa48881e4fbd1858f, 0xbb8a6255e890f7e2, 0x66ff652f9fcbde9d, 0x7e9871cde4bba105, 0x5a627b68713d2e4b, 0x27e09a25453cb7,
+0x2af142503fd03e4c, 0x927d4711073f5443, 0x4c38f4843128d978, 0xcf5ba576321fbe29, 0x1eb2877fe1d3b657, 0x13e61c8505b48f75, 0x740265eb9e1ed47c, 0x2dcec5c26dd1a7,
+0x1e5e8122f49fe583, 0x479f2771075c797c, 0xc74b8b88d458d359, 0xbfcd5dc1e91b1239, 0x33b7584e6914ec64, 0x96a8dc7076d13213, 0xdb09ffcab5b3ce58, 0x19ea9c3b98bb61,
+0x6750a95e05c46296, 0x15ba6e119e5d99b7, 0xbfc857c5f1ac6674, 0xc87d7c6f30f35bd6, 0x28c0cbf4a1635da3, 0x2e46d16766472054, 0xa0f20a598ccd0016, 0xd311761de255a,
+0x840827c184c59707, 0xeac0a4b402aad100, 0xb3064894ff277143, 0x700e108862f8e362, 0xd74777e61f0d062a, 0x4cf6c9ad16968406, 0x3c649475d2cd7551, 0x11d2e9e4a0b016,
+0x672b462de56ba3b3, 0xe58902c4d0441121, 0x7e5dde9e767c7652, 0xa042e31ec794f368, 0x3f55662cefbb5179, 0xaf485c8e6d9fa784, 0x4df5bc0c4e5ddfbd, 0x2dc4b15c2daec9,
+0xf6a0c3be2b9f83f4, 0x8e9dd6b2f04dda5e, 0xca4d2f22c0804c12, 0xa18221b54b55eaa0, 0xa7e478f947efbbf8, 0xb3188124aaad3252, 0xfa3846962bb7adf6, 0x16b69a7c37e6ac,
+0x9312597c91baf1d4, 0x4e0294866f8aead3, 0x44cba4300dd78ae9, 0x2d6c2524dd6d0f5e, 0x31b745099f9eefb0, 0xbca98ec4a25fb1, 0x5264a576c6b36a85, 0x1c64bfed2a7766,
+0xfa9eaae3b3396cd2, 0x7ab4a94f2cbfc8df, 0x13a703c7c1dad8f3, 0x6775a7d9fd2be7d7, 0x7fe912a6b047703b, 0xcd13b6e75bf9648a, 0x7ff9b347f3dca645, 0xb70e1f018b600,
+0x41253e352aa10b30, 0xe8cd7b6181d7ede1, 0xff2c8a36f5f1447, 0xe269d4d71bc174df, 0x5c11d7e266c52a1, 0x45fd9ef6988aa738, 0x4e5976f2cc680f14, 0x3bdcf71aec0b87,
+0x7dcaa60c494a68a7, 0x23ee9bc9efdee09b, 0x73d6790eece67415, 0xc4c5382a5383654e, 0x68b1ed21cf854d14, 0x7292fa15dc040df9, 0x4649d78a960c3421, 0x11427b93db9ed3,
+0xce4c76ec52313577, 0xa696deb5a7bf4824, 0x282d6903f04bc5c0, 0x4a40dcffa3013a1a, 0x7b825ecb918d2c8a, 0xdfe2454c183ff498, 0xe5a741b784461961, 0x1cbed269a3b2b7,
+0x4125bfb5470fd314, 0x505ed359d1926f0c, 0x88b11cc794537578, 0x8286dc630a7827fe, 0xb0059c2813315c48, 0x14d26e2c8227f9c4, 0xbbd71073212412b1, 0x36d4fce2033e56,
+0xd8522ec83b29c13a, 0xe1530a2386af9960, 0x12c47ad64daad481, 0x9e090e1dcff813cd, 0xc0ba4639056d69cb, 0x1cb29e00f6ac1d55, 0x47e7f55039a4da11, 0x3d0ff37f1ea2bc,
+0x46b67282e20ae52d, 0xde2df5b08a383bd7, 0x8304c31b98d9080e, 0xf5acad9ce6dadc96, 0x1f4f2bb800f5302d, 0x9d25caca2ace1ff2, 0xbd8875b9fbe4ebc7, 0x31b6a95e3406f2,
+0xeb81df5408b8bb99, 0x3dd941b8a980d258, 0xe51c95a9b8f05305, 0xf7338afed26d071e, 0x5424fe9f79b9f2cc, 0x4c129a80fbed7c37, 0x5a78bcc83f580d14, 0x1a5ab5a97b33e5,
+0x75eb156d9bf264a, 0xa07238965b7239fc, 0xf210cdfecfcb3a22, 0xc3013a060e8c1a07, 0x7956f2c6e8ed6aaf, 0xaa21a3f754814687, 0xb6a38698a9f180d, 0x14bb4b6563c5b1,
+0xd86f5c3a5f6c7ea, 0x7f08c981a8817032, 0x67c4cd3b4145f573, 0xf1e12b331bd90615, 0x70be0a2c951c2709, 0xfdd4d09dc3248521, 0xd69bb153447224a8, 0x3b2d9030e5d2ad,
+0x7a1ce504f3d4d17b, 0x49ff0ac818398aff, 0x66ba907c2facf9f0, 0x44e4fd02f2563c51, 0xb071c604e1827572, 0xb0b69dd89b254f32, 0x482aa3bf65ceba5f, 0x24754b911c410a,
+0x11815fb5c8b4d149, 0xd8d87b5785f3271e, 0x44cd745a4ccb2f2f, 0x4296b58a86cdfc5a, 0xf27620c03c12b601, 0x96876291fe536122, 0xcc1b37fbdc3bbc45, 0x2e6ddc9e381b78,
+0x36a96fd0ab86e2d3, 0x830d1adcf391ffbd, 0xdac8e698b883a501, 0xb553efd3a2cf33f2, 0x45b4da54cfdd116e, 0x26b6e31dc1a2de35, 0x9c664520eb01844, 0x302825f8fcf753,
+0x73c0229fdd948589, 0x4c2d544cb77450e9, 0x994e649570a3642e, 0xac712c8259b8e688, 0x4b51a717e99f03e5, 0x83bef8fa97135c35, 0x215c8c021c0cab5, 0x327331ac8940f,
+0xc77e021802da6391, 0x6546b03b67b06df1, 0xcfebe08f6e7c4e35, 0x86cfd1d6119ebe44, 0x52a4c77950a41b53, 0x68dddb7d24736a07, 0x93c5b8c2ce0f77b7, 0x12b56b8e6ca162,
+0x44d5d8c72bcdd29d, 0x5c3f947afc586fa1, 0xb524da08c892137b, 0x3e84c705e32dc371, 0xa93199098e21cf41, 0xd972d021a63777c7, 0x95e9238b0874321a, 0x2decac2b9e7be4,
+0xade5a97c9e113655, 0x8afed885e211d2b0, 0xf513f7f6205e4fd2, 0x84f38fdd90c48c6, 0x15d8db8a6664237a, 0x524f56dc98465952, 0x4841869eb526bb8b, 0x2a1fc1c3a87c86,
+0xa339235635a052ff, 0x21e0e809c9819440, 0xa8e49e8927ff8cfd, 0x24953e8407b368fb, 0x42bb6e53899d4250, 0x1dfc7c964387f2c8, 0x30d5210d55d77345, 0x30e6e4625fd4b1,
+0xdfbcc1abb4b22951, 0x325ce1603e5b0c86, 0xd8461eda968a1dfe, 0x9e20b58b0e04d043, 0x41e8146710c9d05b, 0x9e3ae865f6c07c81, 0xc540503a9a2d566, 0x44390b1aeda8f,
+0x200d3a655dd9e9f6, 0x8a9272e236f8cf29, 0xe1458ed04ab5263a, 0x5c1b74110f7bda0f, 0xaf77eab8a9ab88e6, 0x7f6a690f557614c7, 0x6782148c2cb6d8c5, 0x321e75271985e1,
+0x4c8c062dad1147cb, 0xef4af4b67c297212, 0x3290b400f57d2c28, 0x81f569eab1239be7, 0x56f1e4e62bc08b37, 0xf9acc1098b41890, 0xe36d7b2311a22407, 0x2a6f8a724b032f,
+0x7b2587f9e393b625, 0x1af02ecb612f4f19, 0x8b7182b53859c438, 0x81735e6d20f7f32c, 0xa7c5af8964d22061, 0xe95fc9da07a39b77, 0x7f4028b4f482439a, 0xee90397bbb893,
+0xc89b61c56731158f, 0x142054cc85a374b2, 0x764dd6d6b5285905, 0x51264131fec6cee9, 0xcf04bef0f2a84ae5, 0xb8914e16c8d222f0, 0xa92652d55a76cafe, 0xbea0a3101c057,
+0x707d13ba45131759, 0xd79251f250ceadce, 0xb769467bfb378319, 0x80f6d6dd9af4bcb8, 0x10b8042dff857acc, 0x56dad7ed0a6613b2, 0x6516bb3567ec884d, 0xd736e91cc3544,
+0x345c4fd4cc30bc52, 0x5c7661d1e377e127, 0xc863aef4ab10c16f, 0xa7a35212ee86a376, 0xe8332139a6d95501, 0x5c4c441a840f4a86, 0xf8a405154975daba, 0x67f5b07436755,
+0xe18a575638a4eeef, 0xb9506020646ad989, 0xad12606fcd06ce0, 0x154ff0e04733c790, 0x6f1cb92c8e25e1d9, 0x9186d3797d1c57ef, 0xfc2548f8d873f44, 0x377613f367a5cf,
+0x450b63ec43db6eeb, 0x1e96b1e0a92d83ae, 0xece23aaad94e233f, 0x98a57ff3c1d9088a, 0x6a79312e1a7e96b1, 0xae68602140a3df1f, 0xa9c23c20a92bf81c, 0x4600dcefd1700,
+0x8430616699c6d451, 0x9197e7fae8351830, 0x66e3f398b2faad2a, 0x992cfac24501cd76, 0x73e7d39f9a0801ac, 0xae2deb54d1434a94, 0xce5468f37c0d0aff, 0x302a962181db34,
+0x48b309de52fd226f, 0xc689b1fcd063c805, 0x29452c09f598cfba, 0xd67452456a9fddda, 0x6be530fbb24fa75c, 0xc9157368aa9ce88d, 0x2058548c70a3bf83, 0x157661d0bae968,
+0xdbf1e56c312fe65d, 0xf2217dbbe751d29b, 0x838c7b9833d0fb1a, 0x3f7558cb0d31895d, 0xa2858c7278ad6fcf, 0xc34eadc35a52228d, 0x510caa046011006e, 0x315532eb79a7c,
+0x46e7ab8a36b10af6, 0x3c6c33dd72693b8d, 0x1d0723a60312e790, 0x97f535036aa3c078, 0x2fc375c16efa43e7, 0x3f7df4c56f55b859, 0x39772bec70f37bb8, 0x1c838f558e9573,
+0xb4c21405eb6c3063, 0xfff9893c8a17c283, 0x83ebcb88cbbbf92, 0x94ebc28111352fa9, 0x6e45a3c651ce4689, 0xc8df2ac4a7629f52, 0xb4b6c3eb6906a805, 0x141b35104eddcd,
+0x287739738ca2a34, 0xc0cfc22d83e43d5a, 0x42f8fe8a92dd074d, 0x325ec41e0244100e, 0x916632a160661e9c, 0x8ff6b0412bfd92a2, 0xa1bea3d4abd196d9, 0x38752a61dd225f,
+0x1132cee3e6907ffe, 0x1914ed8fb3c9f6ce, 0xb692357b1fee60fa, 0x49480f1a42a5c70d, 0x82f70dccfe17d2df, 0x538958852e5b608a, 0xccdbeadcd5e71446, 0x17f4fb82bfd868,
+0x7ee710b06e321849, 0x9f1f7100c6ea7a8a, 0x16464a982bc2e7de, 0x1f0109a9ee3d41df, 0xf9b3b852af3f3059, 0x570cf5f70dfbd1ca, 0xef27f7f06f309c4b, 0x1d6d0720f9fff1,
+0x805f86a72ebe4303, 0xa50f9742a574d6fb, 0xd8b0a2a76fb562a0, 0x6a2b833372491b34, 0xea3d1acd2300abe1, 0x85f66d52d4ba28cb, 0xbb494776718c3f25, 0x31f934a7e1d14c,
+0x58174aa1d6441284, 0x9c4a2a7b213e853, 0x8029cbe57838001d, 0x99204821bb2f41bc, 0x9a243b88170460af, 0xb97c4b72993a2e5c, 0x31f1cbb6241d95c, 0x2ec1c797e385fb,
+0x1c3f31bce309e9c7, 0x92078e9ad2cb201b, 0x96cde88a6b0d8b6f, 0xc4e5e6fc168095c3, 0x75b150332f43fb4f, 0x67201ef162a60abe, 0x539d0af6d6e07e91, 0x8a24a66dd142c,
+0xed609e2ca0accb96, 0xdb56f8f9fbb24df3, 0x3583ec901429e5f, 0x813828bc0a16cd29, 0x5d794129b8838f35, 0x35b8d8541fb9719e, 0xd911f724360fba9f, 0x1711e5649b4232,
+0xd36bce325d3e34d0, 0xcda3236c89b110d5, 0xe7844bc6090abc78, 0xa4d0bd04d8c9f716, 0x61422423e3b01bd5, 0x383a2f04af1cb61f, 0x1a6968dc490761f, 0x2722672c50bd9e,
+0x4946d994fb15ada0, 0x4d07d946151c3b71, 0x1847f77afa3de429, 0xe8a2fcee8de10ec2, 0x308bd6c9e562cd9f, 0x419925f8ae7bedfa, 0xbfbc4b13cceba205, 0x1185bb58e1a4a8,
+0x938dea67b407f779, 0xb18423ee8cefa59a, 0x7351cac1ba652660, 0x9f1e7d380b95f065, 0x9de1621aef529c1b, 0x37b676a393fc94eb, 0xcfeb2a5b8cfa2687, 0x306ff82faf2370,
+0x945c1b61da2f1392, 0x6618028ff22898c7, 0x268191ec64b52885, 0x36834205a095a682, 0xa46c0cfda6d63208, 0xcc9d594b07df48ed, 0x943ce34398d85eec, 0x662d7c5b7b8c5,
+0x4a01149fb2c9887d, 0x117816ed391944fa, 0x1d954aba46a5b025, 0x40b40741df43a8bf, 0x37b222e428060457, 0xa136f7dd667165b3, 0x3d6de51cdd126dd9, 0x2637ff7013fd85,
+0xf4bbe627be8beb9d, 0x54806ac80f0d947d, 0x91d28f8531212a0d, 0xa230e8cf2e86d76a, 0xbab7b30193a4239f, 0x70b7f92f2dcdbddb, 0xda1f6602c030ec16, 0x2bc067aa0cbd31,
+0x99308120f175d40c, 0x9488f1bb91d98137, 0x9c07326c46ce6443, 0x9d9f434627236ffa, 0x9617e7c3f6a7e971, 0x5372c0325596c40f, 0x9c76cc603dda40ea, 0x285aeb5fd8a1fe,
+0xb1371070a090f70c, 0x63cb3460379fa272, 0xea71b1ac2da903b1, 0x429b47d280216d58, 0xcfce9b2029fb7c9f, 0x66ebcf1926f6c52f, 0x20b6cd640bd5151c, 0x3502b8dc2d4ff7,
+0x290e48927da53bad, 0x10aefdfd1a1397c1, 0x635659099a3e44c7, 0xc5b64a49a925679b, 0xe7efe7fe2215c10f, 0xbc50fddf8679bd38, 0x28cd3d0deafce611, 0x270cd2b37689c2,
+0x82ae766db150b42, 0x478556b3a937cec9, 0xd70591022ad2f0e3, 0xc0d9ebcf4ff54e69, 0x2c29b3f513c68294, 0x81bbdcbdf9058d19, 0xcc10442ba0fd8010, 0x21ad75bc95169d,
+0xb3bb75e3a844526c, 0xacad5b50f6a253da, 0xdfae278afd37fbfd, 0xd0e839c566cb55cc, 0x8ded6ccaaa794c2e, 0xd708faa9d4741174, 0x498171a7b6867096, 0xd23b9141be18a,
+0x514651762ae75213, 0x27b9c5dd63fa89ce, 0xc29e86f19fea1d2a, 0x701187567623526e, 0x6c3e47ee22bf6920, 0x248573b02e0669f4, 0x18c5d32627dc4d3c, 0x21a489fb1f5a27,
+0x154f5d81ddd8e42a, 0xa5b4cb047bb65bd9, 0x6e8e343581b2ec4e, 0xb88be99f1ec5332b, 0xd4a13599037c0ea7, 0x2bc65abf8d138573, 0x4eeffb2494bbf142, 0xef0257fcdf70d,
+0x1893b4fc623be8b0, 0xb01af7fd53d3e2f4, 0x6281f378382a40ef, 0x5b4e474ee3eb80d2, 0x4ad6a4c9dc6bc395, 0xc1ecb008e3ef0627, 0x107ef56d716fb990, 0x316de851e649b1,
+0x7209779dffc65f1c, 0x24d06f54171818ed, 0x411c86be77238114, 0x37172150ea2a2681, 0x659b431e90ed6eec, 0x17dca3e279982ce, 0x858fd4880793128b, 0x1647acd5a4662c,
+0x8c6c8d5e9117dfb4, 0x11ea78df55fd1949, 0xe18ff968db7a9d79, 0x1867161bc4159d64, 0xd108b13660a390c9, 0xda304e21bce4765d, 0x8b1fe8e314a7c5f6, 0x132b6c3c76a3b3,
+0x266b05f8a14cdbb9, 0x25971ff5604beb62, 0xf950e3167b02f0ba, 0xe6ce752fa2d571c6, 0x6c1d61cc706087f7, 0x55a938cfec7e416c, 0xdea0030af29b0ec9, 0x3774ace394b7be,
+0xe0cdcce2dbab9b50, 0xb20b5054275dba8e, 0x1fedf0d283787781, 0xd13f337486ea9c8b, 0x872c35d362ff3733, 0xadebf255d056df8c, 0xc74f8cea2f5aa662, 0x3175a5d5ac987f,
+0x1d76503fbc4ec5ee, 0xd14cf88ad57de29f, 0x19a76954fce85d0b, 0x7645f2fac3603cd2, 0x11bba4f49e3b4040, 0xc89cbde3f34735bd, 0x7bbb020e7687c74e, 0x344e3629097b92,
+0xec91ea18769786d6, 0x8da29a4c07246fcc, 0x6994f0261f09943b, 0xf36533f2b886e04a, 0xdf1dafa855198493, 0x1a39f75bca9e235e, 0x41e230e9643b3c2c, 0xf300311864a70,
+0x58f5cd0e350a0900, 0xe246a08d19d9c3ca, 0xc6103ac79e01d831, 0x371dae98282128a6, 0x5382d6b6ce424853, 0xed4bfda3c61f29b0, 0x29a459e21dface27, 0x668020826b9f1,
+0xf63e5250d919719, 0x42a8f0631d050cbc, 0x33ebf7de0503793e, 0x566a77281c35bafa, 0xd41ac8dd57f73982, 0xcd33e143a3a49b7b, 0x6f7323fba5763105, 0x34ab4df0abaceb,
+0xacfcc2a3a5dd6464, 0xaf332bc783318629, 0x1318ce374dbecd68, 0x27d1f595517aeeb4, 0x4194400155f31732, 0xa971c44e87dca468, 0xc8398a35c1e88f86, 0x84b971e7f01bc,
+0x74f9d8bcddf6a9cb, 0xdf1853f62549d76e, 0x4181496a224a0754, 0xe97af4194b6dd6a2, 0xea33d38c246e316a, 0x41e18a26a15fea76, 0x3b360a0126ac9ef, 0xa21178139481,
+0xebc7f80d8ba9ce6e, 0x9d70c7d75d2a9cbf, 0x7d5c71ef118a1ce2, 0x524c5fff3bf96389, 0x86f6ee535163ab, 0x29c4d8db1bd6755d, 0x963f606ba9126439, 0x328ba49680f648,
+0xeb02e3af19be2980, 0xa395faab8886f753, 0x774a8b2439e8a77b, 0x5243d888160ef5c0, 0xfea354ea49544815, 0x3cff35486faa7fbf, 0x880ad556e7c8ccdd, 0x189d8defb55893,
+0xecd09c9aab38949a, 0xb172f8e5c33f8e95, 0x3d26f12a81af516d, 0x76525622e8a1fd0d, 0xb9f7d1526e9d60f6, 0x875d487c074405d, 0xb2b202c3a854e0cc, 0x2117abb510a07f,
+0xb5b7ade4c8863b38, 0x2aafaf0700ab8e10, 0x82b2a318355cfc7b, 0x21190c344c85431, 0xbf148b152a1b300, 0x401a883babaa9dcb, 0xc3d679d2c80a5b11, 0x3efd0357809c54,
+0x5d2f19af51d060f4, 0x38f05c325ad24e21, 0xae48570002b50493, 0x8ca3c132ae89293d, 0xdec29c7c747f1c59, 0xeca9a17106101334, 0x3c1c57270f51dee2, 0x243cbbe33a88f,
+0xa173d6f54e383da6, 0xf8d3342ba4fea9c3, 0x84f9f4eb6e8b5eef, 0x54051f77b9c9684b, 0xde3f9a28087bb8d3, 0xd56109cd63db993c, 0xed98d1d22535dd49, 0x18abf1715fe978,
+0x6cc054f049cea51f, 0xca0c6944aef14f34, 0xc29c4795eeb5a7d4, 0x921f133f2574d3ed, 0x4fa82723fd6a9625, 0x97a28b517eb8694c, 0xbc45542693f7dfd9, 0x37000086dc98e2,
+0x28ac6714782f2368, 0x29af2439cf3eaed4, 0x1f3267f88bac77f2, 0x750a9fa0a2cb7bad, 0xfca8daa836336641, 0xddd530b96a79a73e, 0x85f316a9bbe768d1, 0x60f987445d318,
+0xa36cede95b6cde2a, 0xdc803c8abf7d53df, 0xd6a5d515f94ab62, 0x3b2e34348576e385, 0xc12806cb75131d9, 0x4b3851483d0df9ad, 0x41cda62f31c213a4, 0x1d6484c49ff38a,
+0x3d02c65c2f36ac6d, 0xff149f3eb5bbb016, 0x11fee14c941b56a1, 0x9f2bfbe833dea25a, 0x9c2420e791533147, 0x70dcadf6b3632b9f, 0xcaf6b4d7d205481e, 0x2c62cb92d41652,
+0x41257ea8c7b89606, 0xe98540eba82c83ff, 0x99c092d36de3003b, 0x242b7fbdcec14d1d, 0x6311016af83a6a4d, 0x4040adec3a1dd3c, 0x6f5febc5c0f793c4, 0x23a5e3678d4182,
+0x2650c6465a19f668, 0xc3d023f842ea4aa2, 0x24a0f69bd8bc126d, 0xcf8d8c2c6813946f, 0xd79665e3b544719c, 0x67eab215aef9bb33, 0xfae159339cf540b6, 0x1f01df26159903,
+0x45aacbbf59ccd298, 0x59563dc8c15f06d6, 0xe8aa5dbbc1a46237, 0x4c84c21a87a3c010, 0x11ecf4f02729e1fe, 0xb127855b3c1d2a67, 0xe932070a14565452, 0xd3180232a1476,
+0x22596f36ff3e55c7, 0x35223a31750f995c, 0xff4faf62b3e98e0a, 0x3c08c84490bc2c02, 0x376b1316ba9c99aa, 0x2bf913cc2d1af861, 0x25ee0ada16e470c9, 0x3cf8f5e56334f4,
+0x710ab717631333af, 0xd96c8f010c49ef77, 0xf27f6ec0523298f5, 0x9a4dfeff2e493882, 0x1ad3edfc994dcd5b, 0x32ccc318052493ba, 0x562d26c3bfbe6126, 0x309a5aedce0063,
+0x59a8b0b99f2aa2b6, 0x215ef28a98bab6cd, 0xb62ccc059a2f3a43, 0x1edc6f71a1d6b28e, 0x6665aa29170b96eb, 0xc4b71e8c6375573, 0x8abac51f8f2a3fb3, 0xf091495cfda91,
+0xea43fb53bb49ef20, 0x1eee773928266f40, 0x93e2c35a76f14fc, 0x24c6c82629606094, 0x9ef401d8cf0e0446, 0x3a1061a01b9fdfeb, 0x7340a5986938d671, 0x1130e4bc3715d6,
+0xaf2ef870ac1b64f2, 0x4704240493aecfe6, 0xdc651e9459dec6bd, 0xbf53859091d031a2, 0x89c8aa6f2a702803, 0xc8defb5c8b27a705, 0xb649ba8f6c421d3a, 0xfe65e8d878b20,
+0xfea89707917b7c37, 0x6dd40cb751b99f67, 0xd925f2104ac02ecb, 0xf42e12496b39294a, 0x54ee926bf138debf, 0xc301d59afbd54bea, 0xf4b1ca8fc3d73be8, 0x14a2a392f688bc,
+0xa74ebaf1f2ee66e3, 0xe8a72b636cdd9901, 0xcb44d2657b841855, 0xb0c97701c1c3c4f8, 0xce70fed4836df3c6, 0xc336a9626c858ff3, 0x3cc86895d395a6fc, 0x5511dfba63993,
+0xfcd25442051f8a69, 0xd9a14c12999169a3, 0xbd17a6ac38408474, 0x5dc4f0817fc4eaa8, 0xcde50591534369fc, 0x37961232f18a9719, 0x79c97a6b18208e40, 0x1dea316f9a0f90,
+0xf488970dd43d6c2e, 0x58f011e3d6de470e, 0xeaaff6a17a5bb1b7, 0x9470b1b22e3309b2, 0x8e1b176c1b55cf7f, 0xbb7b25b9a32877e7, 0xfddbc4a89908536a, 0x33d269e0436777,
+0xd58d1507eeea285c, 0x41a58730484818a, 0x9f038abfbcfd6711, 0x16d166eaf9a413cc, 0xeb7d14ae744b5edc, 0x448bbf5814e5ce4a, 0x68299761c0e319b4, 0x357f4bb4591a91,
+0x147178de426399c8, 0x2eec23187d0ec33c, 0x895a28e424b4acb8, 0xcdae3aeaf12d3d0e, 0x172aaad0583942c0, 0xace3988ef1d28b1d, 0xfa3a6b6c9d87329b, 0xcbfd0fc8cae08,
+0xaeaecd4c1700a89c, 0x2f205c688d8f2e42, 0x9db2348b249d2bd, 0x303c9a476f5beacf, 0xafd8470300eb2901, 0x3f481bd07393468a, 0x47025228476bc7e9, 0x3e9f132014e99c,
+0x70682a6724d22864, 0xfaadf33cc67aac55, 0x318250155cfee0a4, 0x53785e39d261e119, 0x6fc16b80f68913ec, 0xd329d43eb518c808, 0x7a011a2aaa01f0bf, 0x2859f17a0f3adc,
+0x8f1904b0be5717a, 0x735d4079fe489922, 0xfab34baa81df02a0, 0x4b145d1d5e3c7dc5, 0x6136e12aa0f5ca1b, 0xffb967014218f777, 0x8c69803cf4cd7bc0, 0x2e500a8ab22b4c,
+0xcb3d46eb46a609eb, 0xb108fed52c648446, 0x65f83db4a97e70ca, 0x5c4683af7d760468, 0xbe8b167c617bba71, 0xb4c8d37b70d1453d, 0x660e2a954e26dc74, 0x3832b5e3489c55,
+0xf58e557e97fedda1, 0xfbd501f63e26b68, 0xb78ed530c06a4892, 0x56cf6d19ed0e306c, 0xb1fd63f6c4e9c1be, 0x656a6a18aa617754, 0x8751986a2b62cd17, 0x960a22b25bc7f,
+0x5e982b2639edbcd, 0xe40f7d7439c5c367, 0xbc48dbd8a957ec23, 0x8df0cc107038f46a, 0x91c5fc82680edd2b, 0xcc0695d498c8e449, 0xf3a91de582ed3994, 0x32c5aa56e77d37,
+0xd51504c55b6c028d, 0x36e48e059e069afc, 0x36fd3285db46831f, 0xea1a5737cbe15e37, 0x42a23e3b677daa20, 0x53d05e31458a27e4, 0xfab7eb01ad7e5825, 0x2f83d162784ec7,
+0x4f5d4762c871faab, 0x8583313d8865fe03, 0x5398b6d4e9e67ded, 0xa1c441a38a87369, 0xeab26991d02473e4, 0xd4d1e09cf4229a6b, 0x30e94e61f3ad2f05, 0x1ed8719b80e454,
+0x7d4234c7e0aed7ce, 0xc21f89c9147f7eaa, 0x5df6a2835c6910b9, 0xc7071fc3e3ebd55c, 0x63a8e4303fe0f759, 0xf12bd5d578684af5, 0x851a058267571b6e, 0x2106e637e8d810,
+0xb999244140d53804, 0x8705467c2f8d3ce5, 0x847be9528ca4d281, 0xf6093100d2671ff, 0xf9d35e4940cc5046, 0x7903bcd35cd60a3e, 0xb94f4208dda3ba44, 0x2d32832718d78f,
+0x4ed0538d3277b7a7, 0x21bc2fa4e973978c, 0xfd4f80524d723e37, 0xada62da6ce8dd269, 0xf5d8a794ec8d305e, 0x9a587c9fc810e81a, 0x83748745d63d9026, 0x16a5edf03155b0,
+0x18de9b39ff7046ad, 0x158a129db84abb3c, 0x93df1a1f74f241af, 0x23e38f84ded3706e, 0xd63d704b3368c043, 0xabb4ba8839339269, 0x71b7f7779e5b5157, 0xfc1ce084b5938,
+0x42cb0375ce6ab528, 0x3d5297dd48f5e7cb, 0x211174c6bc4ff903, 0xd3c5b68964c76511, 0xcd32c423cd7a6938, 0x5f2156bd2d3fda73, 0x834f0894ba381a42, 0x624d6a237bf0e,
+0x2c78b23e7ab02c14, 0x2ec6cb26c6a34f75, 0x2d92e52ba1c7212b, 0xfdd6cf23012b62bb, 0x8767565cb8f63287, 0x7a5846cb428b2658, 0x4c21dfba46a598c2, 0x36d3f193ca850a,
+0x5a9ef34d05b0c3ca, 0xa387c0607eb71d98, 0xd7ac8a610b8f8087, 0x3d912f7f6a511026, 0x3389ad3a62fa0b7c, 0x8b56b1009fe676be, 0x3ee0564a1469155d, 0xfa08ea2bdf9bd,
+0x943f73467e6734b6, 0xfc41c76180bfaac8, 0x6a3c844b296c802d, 0xf74823c89afb8576, 0x8a762e45209b97e9, 0xa16af2569a260d05, 0x403f0635c8e5c799, 0x3583555b01de28,
+0xf30cf911d114d76e, 0x9533ee74d751a6d2, 0x62db75fb79cadbcb, 0x9347695bbed081cc, 0xb81782a6b1a71f9a, 0xe4d6685744d6edae, 0xc2d19fe81e92f7d8, 0x248cfeaabd3b17,
+0x818208412e6078a5, 0x659f28d1eeb06b5d, 0xe308ae48ecde6f32, 0x5e076a2d352e81ac, 0x300fae866b4c31c3, 0xc76346b06bcf4d47, 0x50fa8368265f536e, 0x3ee20dfbc53908,
+0x8167ff294d70404e, 0xdcb1e8e4a5c80dfe, 0xa7218cb8ec1c99b4, 0xf1f55920e1d437ff, 0x522daccf86c56fdd, 0x1374de4f38155cd8, 0xc16d4ada1afe4fa5, 0xb16ba1685a788,
+0x5332e715f90e2473, 0x28ad5adde977e966, 0xc8aba71a6196fbbb, 0xdf331e6f505af64b, 0x8d57d28fdc47e1b3, 0x3cb340a7f9a1e8a1, 0xf23ff1fa47be023e, 0x1149174b9ee095,
+0xb55dede9ae38ca43, 0x1d2817b677f88afb, 0xf9ccfb748ce66b29, 0xc370091300d62b80, 0xfd7be97d5252c487, 0xef3913c1c9be8ccb, 0x53f6fa326eea686e, 0x366b8bae40a208,
+0x4b87aa1b093195bc, 0x5dd8845d318e7d7f, 0xc04067949739989f, 0xf604de370338971a, 0xd2e26dddba941bb, 0xe029e918df57853, 0x1782b98a82ca3e14, 0x36dc2a0f822231,
+0x3782b0d3dd6cab17, 0x5e7f6edbfa4d1fbe, 0x995f0a4f96f2f676, 0x55a594216d16d3d4, 0xaefd0348499b52e3, 0x45652d52e27cedbc, 0x6cffc281d639fc62, 0x2d22688191160e,
+0x20d3342e2ece55ff, 0x39ce61bd46bdbfe2, 0xd0d8de2a794ba29f, 0x3a0977f3b635e968, 0xf177c2367627ae76, 0xa613b437c9035cf1, 0x39e4efaf7385a3c8, 0xb07e7e66e6375,
+0xe8c2ea38c1534918, 0x63488b91c8fbea72, 0x4320d1e21d8e50de, 0xd85c2fb3f686a6b8, 0xf348fb43875224ec, 0xa715be842ecfd05a, 0xe8446bcafee3d3f4, 0x3ef40a190cfbf9,
+0xd58b98050f1280ef, 0x4b9b4ad4dbfa27fc, 0xe079dc46af5c8ada, 0x7222d38f340a20c9, 0x5e9ef666adf7a0fc, 0x3891a0999303f9f3, 0x9c003a4c7718978d, 0x295a20ce6edb0f,
+0x22a564bdaf7474b9, 0x96531c895eb9e8f8, 0x299e3093829ca79, 0x7b3e9a8e0bef3d43, 0xc92aeec5ffce100b, 0x28272b7b7c4f9bcf, 0x68c26a3065895bd7, 0x158e373ffd3f4b,
+0x749dd1c2bfa59fb5, 0xf5f539134b1b563, 0x28f55cafdbf1643f, 0xe8596d974956ba25, 0xcb1fc607df1b6be8, 0xe037744669124060, 0x56a1126f9279c82, 0xb1fac666dc17f,
+0x7fe1763053eca53a, 0xd0dcf944ceb4a895, 0x4f06458b2e96f7e6, 0x7e218d7b6dd3b2cc, 0x29ffa64c430ea500, 0xbfd4b073c2a616d5, 0xa69bedc51ea66f08, 0x8c667ed8c4572,
+0x4f5ff0448c123c30, 0x6ce1d01dd04789ee, 0x54e469ddd7e45638, 0x894ace9d94993a60, 0x7c32d4e7b79576f2, 0x6825dbc32ed55113, 0x4eeb470b54163411, 0x388e419a6ca741,
+0x227aa9879f7d7f14, 0xbcc8aa4659ef75f5, 0x24700730b3708119, 0x94c82db50767b1aa, 0x30e9dcd99e5752e9, 0xac909195254d7f89, 0xe77a9a5eca2853a, 0x255d409ca8d019,
+0x977a0efa480b31d3, 0x81030ad85bc4469e, 0x23d9e0b89e881acb, 0xc702b7a8f3d55f8a, 0x92b8cd364d8a0909, 0x90355c87efe3f328, 0xface2fc112812cc4, 0x186eabb3d91b07,
+0x2328c12e21dc9365, 0xa92c353d75a8e6c, 0xe3cf76db3a88e6d1, 0xd80ac28a53cb302, 0xdca10a7f2d1f7260, 0x643ddcf15c842a01, 0xf975d2181bfbe2a6, 0x3c6fa56f0f2e9c,
+0x737322fb61c2318a, 0x82631bc58b9a03b3, 0x5f86b4fdef27ed5c, 0xf2345c267d26ce08, 0x798db667c899fac9, 0x51951134a919701e, 0x2167532a28cf2e4c, 0xa8c9105857fa7,
+0x3b352afd930121b5, 0x415ce75e74826b36, 0x5f730ca40fe9a1af, 0x58c29cf154f92d50, 0x186b30148ff1ffb2, 0xaeccefb726e15815, 0x655f80c057dd8d32, 0x24daf9c7a62363,
+0x79b5d5fb36f6d7f2, 0x6a7b4eb1a1f4bc34, 0x19ca9a505206453, 0x540f5926dcab3744, 0x3cec2b467ca09cf5, 0x126c9cc3abe5ddfe, 0xb0501723380c1e9, 0x24a64e9b90384a,
+0xc15ec1a07d36ed66, 0xbc4ed1c16ec3fccd, 0x8eb93d23c319e1a8, 0x6d6bf9b9f354281c, 0x88edf8fdc3c648b3, 0x32b62e9d01d89d9, 0x32f7645e61f250bf, 0x3933c0195c8b04,
+0xe76a5bfa8445d8ec, 0x15a38863151b5b45, 0xbde0c64cf9bcc1c5, 0x79a1ccc04cac5a64, 0x309502edbb4a3994, 0x7bc2288dae716ebb, 0xd9d2c5ea3b676ed9, 0x203cdc0fb32199,
+0x64f40b0581eef5de, 0xe5ec7912580fcd71, 0x55b092d0c6a9a1e4, 0x7813487cb15be40a, 0x200b0ad3ff7ffac7, 0xa2c0c3ec69143728, 0xcabd7775647d44fc, 0x12c0a6ce5610ed,
+0xa198aa4626e9ada1, 0x1a8691422414044d, 0x801f2e63b0d05243, 0x5f50caa84f5da680, 0x674154fb1031a2c1, 0x3a6fafcfa2371237, 0x2081cbf0d56ef687, 0x3a3750129e3411,
+0xb5c516768be126f5, 0xeea8855a20454021, 0xf1b679ea17c6e8e6, 0x364d0ca43b226ae4, 0xe12e177eb978207f, 0x8c4393a99c315ce3, 0xe0786587cd7d916b, 0x103d546a3ab0d3,
+0xa7cbdf1f1723510e, 0x21486a47fa496f00, 0xe49753f3f9f26bc4, 0x1908d17b3b5ef169, 0x83adb75c83a81908, 0x193d9343f644a04a, 0x818d8ed57e98661b, 0x3af701c39eda1d,
+0xffaf885835a2a3d4, 0xa850d5aaf3d4400d, 0xcc34196d57df2441, 0x86e7ecfdc27d0948, 0xc7a521f7943580b1, 0x8f448aa024219643, 0x1224154d5d076f65, 0x11cea0505bffa1,
+0xa94633291213124a, 0x92526d61d5d29af8, 0x4132eebe62ae08c9, 0x4a3e089f86c33a99, 0xcdacfda070194fd5, 0x70698d9c81bae2de, 0x65fc91bd71fadc01, 0x5d69d83307691,
+0x50a3a2c7f1dfa0d0, 0x8278e14c6dd7ff51, 0xd713cf48733b34b4, 0x208a2140874647cc, 0x37802c8cf79bb3eb, 0xecc74ca0d0afd995, 0xee27d2f67c207ec5, 0x1fd95d498552cb,
+0x21900667c47fb2fe, 0x97662db01ccb2b6a, 0xcdc1204ae8f9f55a, 0x8f0293d2ea64ae46, 0xe5036cacccc15059, 0x619a8c516424158a, 0x71b32b4e2ea96a77, 0x28559ebd489e3d,
+0xd9436433bdc42cd6, 0xed6b5fe5c8f93ab0, 0x6066898a4990b3ae, 0x3ecbef2d65bbe501, 0x3a2836b54735550a, 0x6f93b2f9c50f2849, 0xf74ad7d828048df9, 0x5377d50eff5b6,
+0x8dec7e36cfa8eae5, 0x28a61a803270e242, 0x88f0bc6d84b40a2b, 0x4c899863552c3549, 0xcf67c8aae8e39c7f, 0xb60fc4365aa3b5f1, 0xe7710238e06e2e80, 0x317b277a0212d4,
+0x1c23bd9ae906bd43, 0xb4ea4280f5875646, 0xe652651397017db9, 0xe37ab967578849d0, 0xa652e34b28a97fcf, 0xeb43875f5cea8885, 0xc03236e690453acc, 0x3a06b736b6c60b,
+0x686f119ea715979c, 0xf940c8421c00a99e, 0x24c1f8d82f4856f0, 0x857f56aff14ed9a3, 0xa416fee4810328fd, 0x7ed44cffad678f74, 0x13ba06fc6831ff67, 0x81f50c8ec0ec6,
+0x7a70ba908f45c90b, 0xa6014473a02bb6e6, 0x3b1c64f9ccf32176, 0x2f3cee9f5671a22a, 0x45584e3749b80aa1, 0xd8460ee0b0f8156b, 0x18da939adb8755b7, 0x1f28f0ff687b38,
+0x8378c02208d0dd1b, 0x3ed526973cd79c24, 0x9007fa950ef598ad, 0xfb2692c4b93ea32a, 0x6d4895846734681a, 0x89bdf05b1b3262d5, 0xb816b76b2a840caf, 0x38b5ee8fd13d61,
+0x451be9ae63dec02d, 0xfb37fe90f373014d, 0xe140c022ed5ff46a, 0x740fc498617c552f, 0x35aa3d1ac1fdcb54, 0xe80bab8eb0203c53, 0x92172b2d3d023cc1, 0x19befa29a49dd9,
+0xd729668f6dc14ff3, 0xa0056ed8b8a766e4, 0x63e6105f87ea51a7, 0xa6d98722fe7e9850, 0x9d2ddb81c66165be, 0x6ce298ae29a678ca, 0x5336a182137b540a, 0x23f7429f10e0b6,
+0x58c7ec48eba32bc, 0xfbf2489f67be2ea8, 0x7411f5f9a2180a48, 0x77338531aca5569, 0x483e7788bc1bf631, 0x8f3e3a7eccc0eca4, 0xc45a6f1184af5214, 0x2e2dcc19f991e2,
+0xb8e1f812f4fe00b8, 0xae110ef78b5ca557, 0x4fe4a9bf9f172eb2, 0xfa061544e6a57ddf, 0x7954f51e73f80a98, 0x963f34cc286c25be, 0xcbe8d59ec92171b8, 0x12837bccf20a4a,
+0xc631b7b06a82e6eb, 0xf69c7a0e8afbff29, 0xca082f8867d40577, 0x69f134e203d3a81a, 0x986458378bb83041, 0x8b8ed944d26a7c69, 0xc8204633f775deda, 0x23e123fbd73bb3,
+0x25d84ab08366058b, 0xbcb3805e9401bb08, 0x2806a0b7393aad19, 0x79b98c87daa3d7a9, 0x53c2c79d0a492169, 0x102684f6a2091e87, 0x1b74c0dd221c3496, 0x3eddfdbefcbeaf,
+0x77702b6d3686960b, 0x9cb863be8dae8e56, 0x934903a238e7be85, 0x8f71dd617e9221ba, 0xe78a440a210823ad, 0x89ca400b7059ab92, 0x7e1a951061676d7e, 0x34b5f68ae5b4ab,
+0x565ed65069418df9, 0x795a1724e59dd716, 0x9fe6c16dd776567, 0x7f6cf770a88d4a3, 0xa8d7a8d50b054d19, 0x99a1a77ed3e617a9, 0x59d7b2f2df863189, 0x3989ad1b36c12a,
+0x9fbd81648b3400d2, 0x51074cf42d2eb419, 0xf7e920d34600e2fd, 0xddb2bee00716dce5, 0x6efbb82e1ab79cd6, 0xe89d28b2d60cf7fd, 0xe6b2c5f10564ae96, 0x1b39e9c589bca6,
+0x53006ff76dbd8edf, 0xa927411af06f1c91, 0xcf98432a393924ec, 0xe649f63a3bd674c6, 0x159fde926292a28b, 0xe9d2ce120c33ef26, 0xfa54a0482229fc63, 0x5b27a8c58a9bc,
+0x974dd8cfe09adab1, 0x2fa7f970c5337a2f, 0xf63e73a45abbaae6, 0x5fd95f0d0dbc6cf6, 0x5c6acfc0502611ce, 0x2b1e114aab0a246d, 0xe04daa0b391419ef, 0x15a956a4d789fc,
+0x24e97c2e7af7fa6e, 0xfe4a916ba4823a47, 0xc6659b34c586fae7, 0x13dce886ebf7e1f1, 0x954a7b4ce1441e80, 0x59e4a318e34f7b6b, 0x6db6d7649b460d24, 0x2d87544c82cabb,
+0xce999de44bb39143, 0xc590b84d3d7321a5, 0x9db4b4183219ab3e, 0xd080a5dcea3472a0, 0xd16473508c482ac6, 0x5526bd1a5d0a9794, 0x8c378d78cf5f1687, 0x3144cc8c4f82fd,
+0x9f7327365351405, 0x1aa346fde6c69952, 0x7b1ca3f32a685732, 0xcf81837be2e07c17, 0x83e7e7fb56f3254f, 0xbb920e0d887187c, 0xc2227ade088315f5, 0x3d2ad7b091413d,
+0x2a52816b6d39ae8c, 0x775a9c76b8fba0d9, 0xbd61763cf09ecc67, 0x984831a20734122b, 0xdbfa08b0e22b4e20, 0x9c3b31073b9abb9f, 0x2fd73c226ef9bf67, 0x2348df1ff25e7f,
+0x8f59d65d22585669, 0x501e85d59956766e, 0x67ae7aa9dd3ae3b6, 0x4132dd535bfdfabb, 0x2aa2ba182e516de6, 0xa7d14b1bf53b86b8, 0xfa9381684a7d9562, 0x8229e5ce9291e,
+0x968d683a001143ab, 0x3e17d013cc3b3e5e, 0x4c4288b9f966c46b, 0xbcd9b9c370064d4f, 0x6394fc7969e9cbc4, 0x1d97b7d8cadac47c, 0xf84521ca868fd1e1, 0x34b95082b34bb1,
+0x14b5a12fcdfd599d, 0xf8ec2e3eb8505f7c, 0xeac87737baa8d13c, 0x438519c5228892c6, 0x25037a7209f1502c, 0x8380c8d55dcee591, 0xefd0626327fb35a5, 0x32f4a43da912b2,
+0x2f24f096cdf95968, 0xe5d3970204068f77, 0x65d25e3786594f90, 0x9ca3a279a6bd1dda, 0xd0ec80242231d8bc, 0x9a77fd14ab60bbda, 0x856f51fbbb924297, 0x36b531ef1084c8,
+0x9f8cd250c81c80e0, 0x71ea084419618373, 0x965d5c9a80161fc9, 0x2d65c001ed5aee39, 0xa334dcb19057b513, 0xae5da79e272e4c75, 0xed4a5fe77fa2bb38, 0x2c0897a1b75b6d,
+0x41f67cb215e80eca, 0xbae74c8fb6759d1f, 0x5128a50415329316, 0x6f9e4260048e9a5b, 0x2c1d4f6d0af04d5f, 0xb06f0d7c6688e17e, 0xcda0ef610b054c40, 0x3dc86b252d92f3,
+0x5345eaf269ed4310, 0x72b5da1d676fec83, 0xe694d27313c18ad3, 0x73976bc51998480b, 0x11c44dafaf56d052, 0x61ce337730ce3449, 0xe453d38984fd80d4, 0x1ed7a1b392f9a8,
+0xf5439cf825fadb2f, 0xe33f82bb9413b5d4, 0x66d3654d3d2040b3, 0x585e7a95bd6cbe1, 0xbcd62ac3956755af, 0xad9e5f833033fefa, 0x92dadaea502ebcb6, 0x18c28e5fef7465,
+0x9fd8713b81105928, 0x8b0b995c2f41be40, 0xc8ddfeb6c8660b74, 0x268f4a8d90d9aa44, 0x6f404614606d2d1d, 0xa81b565f437b058c, 0xd4564908c388798d, 0x22464e8ec5bfa1,
+0xcb50ba1c1b4b0188, 0x639930e8e4824dd2, 0xb1efa0ade23b9d74, 0x450c18cbfce0c337, 0x62e0589915363431, 0x6c33679cc97c6bda, 0xe1311d9651748266, 0x3e787ff42e649b,
+0xe6439755d9eca377, 0xd0012226c97ba558, 0x140862e5576f8bae, 0xdb570b42d1e7ca39, 0xabfb1782b1fb642d, 0x216f5f4cf47a7551, 0x499b303804e02316, 0x2e832b1f495b01,
+0x64582acacb20df2f, 0x10d6236a9224e115, 0x1314428d9a0ee34b, 0x28a7291ca13fb614, 0x925c8a4fe026516d, 0x274d66ade3dd53f1, 0x82914158fed507bb, 0xeb8ed24744606,
+0xeca603e177e0387e, 0xe4697ffbbee65a9c, 0xa4bfe35f6d5599c7, 0xb2b14fe14e148cd4, 0xa0d0c0d77c14c0ce, 0x58f3376a77cf2f00, 0x328540441192fc97, 0x7f22e9af9e746,
+0xe902ea48bf02a0a2, 0x3754dd64f5e2437, 0x34775dd18353c67e, 0xcc198fd898c3cbef, 0xd93815ac74dd703, 0x10a3a3586639ef6e, 0x8ea5da56b1ce9857, 0x137621b81641d9,
+0x233fa8c293134e97, 0xaa15504327ca846, 0x6ec3a241a9d397fd, 0xff2c0174d48f509e, 0x4910960dd2091202, 0x1de3ea5ac210a117, 0xeeaa80df27901e42, 0x12317f6d5286c5,
+0x7cb63511df2dc93c, 0x92be079a627e6f90, 0x11181c78ec86e282, 0x4a6f0fe985690642, 0x7803d70ec295bbd7, 0x9fe1be3ed28fb611, 0x6efbae3267287e9b, 0xdfb11ce844df2,
+0xacfd9985a09a53ac, 0x82da9e033f8a9aed, 0xcdc2c59df82e25c, 0x1707bab981671c73, 0xf4cd6cd4c7b84a77, 0x60ba6fb7b796648, 0xfecabc7be6a2597c, 0x12502c4e351e0,
+0x304af784c4deec4a, 0xc1d42f50056e90f6, 0x3ee8677bed66cc49, 0x47cbdac7afc40059, 0x73185160a8571296, 0x2a5514d521d2b83f, 0x958cea50a29c6e34, 0x26a3a41cab4ed8,
+0x67dd8cbb467cde2d, 0x8cc59106bf065c6d, 0x9e084f10cde15ae5, 0x60f95b86afe4d3b5, 0xb0fe3adb381b3948, 0x8ff29764c8c7dbfd, 0x4683516e5babb1e7, 0x12175d3be0bf1b,
+0x39e9a84f652eba88, 0x61ad0447370352ab, 0x29f09162d5db946e, 0x43f6dee965b89f88, 0x3f0ea2a88ad2b9fc, 0x20ef9ceef8a580cc, 0xbc50ab438f892e1f, 0x3457ce540fe7ab,
+0xef39a4e742154daf, 0xdf94640bd1e21c1e, 0x66b67687498c7ad8, 0xd23c57fd107694c6, 0xd8c8440b10e2a969, 0x62f59b231a44af4c, 0x64e3c52d2d7fe792, 0x4b7ce952288be,
+0x42b14536fe033c6e, 0x40bd46a779f0f3ea, 0x5d233dc9352f2e99, 0xc428eb534a8c79f, 0x7e2741a4936380ba, 0xc1831fddd69af6d3, 0xbdaba11647702cbd, 0x2425cfa969ac3f,
+0x9dfefea649fcae78, 0x21ced945a7fd3c18, 0xf29d0f8b0896a7ba, 0x3ddab88330d28157, 0x12fad56589dd912c, 0xe2a53f2f8cdeda24, 0xe006a8d571ccf2ea, 0x12ab07124e885d,
+0xde43095bb15c80c2, 0x2f1e156b4b8dcc0d, 0x4aa186a93d7c4bd5, 0x9e9ca2eea25f7cea, 0x7f5d4089ab696215, 0xdab601b56978bd93, 0x2b4ec86b17b1a06f, 0x3f9e50838decd5,
+0x301d144ef71e4ea1, 0x2f14f85e4d0acead, 0xa1ecece35d2cf820, 0xd052ac28e393d6bf, 0xe555e8db2cd09a51, 0x5ea7aa969a2eb959, 0x86bd026246666b0b, 0x3aa073353a03f0,
+0x63642d01b456b980, 0xf6782900453efc2e, 0xa8041afb240a6614, 0x7dbc2061f418424d, 0x22777126bd5e254f, 0x1c67a0cd34effa64, 0x7ccd6c7280cefcc9, 0x737de04f13846,
+0x6a90b048fdba201f, 0xa780faf41ca47214, 0x169cd4b9cbd87c71, 0x68af99bf2eb8e9e3, 0x57cd499f7f82a899, 0x838403782bf71d9, 0x9fb9bbe03b9e3b30, 0xcc6d9ba090f00,
+0x5f19ae2e34e54645, 0x64c224c3af089414, 0xa0db5fb99b147818, 0x213c17a8cd400fc1, 0xedc4687c178b9e94, 0x27a7ed7382fcf0a2, 0x345c0bf7f051a64b, 0x6c130d053409b,
+0xe5fc3e9102f68df5, 0x875a510918ab02ad, 0x4a04b07cb02ec202, 0xee4d0ec7ac03289e, 0x67f8a93d2cbeb73, 0xfdabdad46721d407, 0x95fc2ce3e4a8455, 0xe49ddf8b5639e,
+0xdea99ff8cb5a7527, 0x3acdeb9d566480f2, 0x5aed34e87ab628ab, 0x500c1857b1afc075, 0x5e76bfe3ac1bbf4a, 0xc06c8aefb032ec64, 0x11f44016d3e5cde9, 0x1863dd19c9808a,
+0xa07effec322e17a5, 0x829dcd5de2dca7db, 0x1d8e144a694203bd, 0xbbd22b7ccb5208db, 0xf98ecefe77d658de, 0xc61829df8f982a, 0x92090018fad476e5, 0x590919b4f3db0,
+0xe8ca1a7e6d66e6a9, 0x102a95119006dfa8, 0xf0037826590e7b6a, 0x8723fa307068e33e, 0xd3128f45cde2cef1, 0xbbf10517cc2325e1, 0x6f149cccbab6f287, 0x6d093621db41d,
+0xde15a5e9ba3699f0, 0x2b1d584ab94bf351, 0x117e3c87a61180f3, 0x5d51461e16024ffc, 0xf5fba541d330716e, 0xebba01470cbf64db, 0xef40b5c3833ec1a3, 0x37b3591adf0514,
+0x64c0d43cd5c47e92, 0x14a469bea90cb331, 0x3b5facf3d7233c9f, 0x7f3cf8655dca6660, 0x5563e555f69c5d48, 0x1fb5a614cbfa18e6, 0xe316573581ac82aa, 0xaf97827450627,
+0xdfca8995da8bcfcc, 0xbba227506727ead7, 0x5c191104240ad5e7, 0x16aa841f3ebbc61f, 0xe9388c227e522d1d, 0x1ee96dea67c74d3, 0x78cec03efcb70a2e, 0x19fb55aa201d47,
+0xefefd8f48936e815, 0x978b417f0587e6d3, 0xf30a9520411ef7b1, 0x353f2514484373d1, 0x5d18424426a46651, 0xf0bef170a41d6770, 0x7f11eebecaf98e55, 0x1046e165a741d6,
+0x501e15dd74ae41a7, 0xc237a84cc37e6d52, 0x3c093b4ff2bdfc1e, 0x52620ada900bd23b, 0xf87ea5e1b4d6e97d, 0xb1d96a5a7469f954, 0x86e6a4bc7969a3ad, 0x1421781a840578,
+0xa9cbe43583a751be, 0xed24eec90b16d02, 0x3ca91e5d7ecfe672, 0x1009520552f0bc7f, 0x3a0472ac50cfd475, 0xe5eeb577373c24c5, 0xc63108af19e16cb8, 0x1cab2714786fc1,
+0xfaa565c0314ad3d5, 0x7c6839ae246518ee, 0x81a1674742f64edc, 0xea13385375d4df9d, 0x9ed375b7bf661cf1, 0xcca2b787b88a0e76, 0x8b9d4cba5c970410, 0x260a690f0ec75d,
+0x3e15f2dbd364add2, 0x2cd6e6b4ce8c254a, 0x20129a0e99c1bb87, 0x796a0ab6f62c1e90, 0x3500730c9ec68ff8, 0x10d82cba1978bfb3, 0xa0cc6291efdcb6f2, 0x2e50a849aa81a6,
+0x6db2346713b3e234, 0x7ee1308da048e6ac, 0xac31f5beeb5c9792, 0x7846c6cb1181162c, 0x8d6865f3adbf9c6, 0x8435444de284913a, 0x778a07e40c6b527b, 0x3bd98011cadc20,
+0xff82f208e1db98ae, 0xccb7de0f6c18b5b5, 0xaae1691f7f65501e, 0x86454b96fb21adbf, 0xc4f8c1efac4915c, 0x496ef12c3ce7ec94, 0xb9d730fbdeb2ea4c, 0x242fe04ee46270,
+0x6bc79692c4b197f0, 0x31ebd4b8b9b3cb4d, 0x2bb45f9db6b2e2ba, 0x70f5bfe9e2a0aaf, 0x1daea10e94371c4, 0x51a323bfacbb809f, 0x56e409171d9676c, 0x2d23abe3f77e88,
+0x51ffc7a9425e9720, 0x795cb41da617a4ef, 0x57cb9ecdf9a40c96, 0x68dbafe80d7305ad, 0xc6edfd5e1486fb0a, 0xa9fcd85db23da58c, 0x3e8a629dcaea717c, 0x1f7afefa21d284,
+0x1cd25a45816c1de5, 0x30c695379049372, 0x1f4b8322f6a7dc88, 0x7e84e0a0f8eaa6f0, 0x2414b8e700817bb7, 0x3e1b51426e2561a3, 0x121f00e33072f077, 0x61282ee73cc45,
+0xd183c4066889e54e, 0xc668b1764a27b5f3, 0x7af98981df1e44c8, 0x324e0dc493ee49ee, 0x66d22b250106f39a, 0x5bde26010ffd21d0, 0xc96496346c0ae6c6, 0x18410ec81c342d,
+0x45185a4dec7a998e, 0xac3971d3304e68c9, 0x104355b43c82b2d4, 0xcc7c2e5a4581f79e, 0xd33669c600a26845, 0x4e34bfc077c0c1b2, 0x82cbd7f829536ae8, 0x2cdfdfbc55e6af,
+0x6c47146f9d6fed96, 0xcba67eb27f550de, 0x7356675e83e01a1a, 0xde5224b2be2ec45f, 0x21469a813154c883, 0xf3fec99606257526, 0xddaf4eaa79822aa6, 0xdab8605ebe1d,
+0xfe29840ee3666e57, 0xc380c9d2d6022d6f, 0x8e87d03de399b31e, 0x53e796788dec48c0, 0x30e533c0e2254fa7, 0x59779088a85a85a8, 0x757c2e3ad06e1805, 0x38b82dc3c55679,
+0x81dc776ce03c771a, 0x49fa614a93cd55f, 0x94041982cf72ae72, 0x6d4e255a8b5ae865, 0x33b16b5208e92ae9, 0x56e29cd6b59e5f47, 0x71950f3f27014fc0, 0x12f0609fb8666,
+0xc199adee3dfb93a3, 0x275eff781020a84, 0x639d5592c987c2bf, 0x165bd2ceb7befdbb, 0x6a10ae705d7ee0f7, 0x95fd29542a6d4652, 0xacda995becd2d912, 0x12afd926bb0da,
+0x79961196d22d0264, 0xf46afd76a961a013, 0xbcf88e470fdeb34e, 0x60d71a29f2aeb337, 0x75560ae20e09585, 0x6b2001b27e093cef, 0x9a4c2921482c94bb, 0x205a515f0993b4,
+0xd17a433ab7ebd83a, 0xc2952abc043be22f, 0xf8aa0f7dd987babd, 0xced6f398037c97b1, 0xe91dd26549fbe64b, 0xa00767d5b53ec7aa, 0xb63684c1312ea0a6, 0x3194c9001a4bad,
+0x94da0ee01485b550, 0xa86ca2dfcf8b0d05, 0xf93c494c15395c1b, 0xc56eb1fa0973b4be, 0x9bd271e7994ab946, 0x3acf5e071abeecc2, 0x6d8238c1b43089e7, 0x95ac1e0edfe0b,
+0x44f2611b4268c0be, 0x5ff6f23aefaf0cbe, 0xb3f416b2ced3b26f, 0x758119850c42b28d, 0x3e004daed8ae1058, 0x5970283f8acfe2ab, 0xb3a3cc4350cc4cec, 0x1bbcc64c3e1e13,
+0xff2b203a29f593fc, 0x2c0eba2e2abc0325, 0xce8aa74740e6d3b3, 0x41c71bc0f1edcd2a, 0xa8e7c47c349fadfa, 0xc77def1a517817f8, 0x866aa654590fd720, 0x13fddfe547aefe,
+0xea97d812c9744df3, 0x1842035c78eef50e, 0xf4fbfb5f46eecd0e, 0xc32dadccea228382, 0xccd7c49f820f4bd0, 0xa7a10b5b03ff4f6e, 0x99b9264045e61d5a, 0x16a614293ea540,
+0x89298668aacecb1a, 0x9aa29803f88b209b, 0xb4826e0dce7bede6, 0xeccc060c73fa3f35, 0xf3a17a1fcf4f8620, 0x178101c28adf3b05, 0x32fcf42fd2d9ea10, 0x3dbb1bde96d6c9,
+0xa36add015f729867, 0x171b2da7ffee4cb8, 0xd0dea0b48fd405d7, 0x747a4dcf04cdc48d, 0x7deb9efd8c8260fa, 0xd785d72554cbe0c9, 0x9eb4664bd18164ff, 0x2f5d89a430b58d,
+0x3b4484b03e44840e, 0x54d8e8015c129896, 0xc9ace95851e5c0a4, 0xbb99c9aa4b92f99f, 0xb55b1c76a2dd23f3, 0x1365f7eeac74d1e0, 0x7b596a00498fa229, 0x52801d2b2d395,
+0xdc44b2d49a4f7742, 0x5a158fd5d462fb53, 0xae53eac037275b1e, 0x62321868fd6c64ad, 0xab6fa286d7fcd991, 0xb0c62b489e387ee3, 0x1298d23126f013a8, 0x36375d6a8c7540,
+0x52fa6c4f91e18cef, 0xefc19b8fd35875ad, 0x9da9e0f34cbdd7d8, 0x3b34b489df6bd43c, 0x516c5f25fd2be737, 0x951b04c5c0da6479, 0xece852d114793dc0, 0x2c7166a03721ef,
+0x4ca2a0d8e979df27, 0xb93eaf83b0ce0202, 0x3b55a63cbc97a9f3, 0x5b06eb17039ea50a, 0x7e2da6d1f18cb473, 0x40d73b7e171f5a93, 0xd9127472ad5e0713, 0x312cb7531ff372,
+0x151c48bcfdfe4ca8, 0x3708794c391a0722, 0x6716d0421792cab8, 0x86955cf42c85a126, 0x21cd915a9d1bab8e, 0x5aadcef12c12d0c1, 0x9ec305f38c9e7e90, 0x16732be8818e9d,
+0x34b00aa592d32d04, 0x5346928242fe3fc6, 0x85bd3bb68963da6c, 0x5468309665310505, 0x979dbe522087a661, 0xe6d018b9c5bf1eb2, 0x209b672b6b89ec24, 0x1dbfa6d0f23000,
+0xffb55c9f9e4091a5, 0x8138a9384acfa455, 0x16b848cc872bbbd1, 0x8c287756e4c4a991, 0xde2952b7201cca35, 0x58bea1bf14a72288, 0xcba7db636b44d1cd, 0x5a50527c7334d,
+0x139e7be0236b5627, 0x3400e5d27616d731, 0x2508b643943b61a3, 0x320e8cbc36279d0b, 0xbb8ce677836a7a52, 0x3718f475e185df30, 0x1609f68861600f05, 0x39e2fe9945c786,
+0x6eae0e4520d1af5f, 0x5b7e55b335f37681, 0x400b029f120e6974, 0xff11047d0c309210, 0xadb2d8a76aabb29d, 0x18a4a72b220be2f1, 0xe883f8ffca14c6dc, 0x1f8d0e7e730691,
+0xeb6ef1c7537d4b85, 0x127fec2b4a0893e6, 0xc7a706442cd152c7, 0xf7b30b89f3104b0, 0x56dee5948785486f, 0x66f8e16b1964102c, 0xfd62c916e6214516, 0x8b94ae75f80a0,
+0x4557339c5af29169, 0x3484a2c0dd395a06, 0x87f58bbabab307b7, 0x8f9711e829072391, 0xe506c418d3f9b054, 0x9809cbb16946726c, 0x94d14917170a76af, 0x345aef7af56b92,
+0xe538320bd9f7fe5c, 0x18fe718ab39e77e9, 0x487c36a68f3b9696, 0x809e003c2c1eaf1b, 0x943c000a3425cf1d, 0xae24929bcdf36a3e, 0x20036b7288416a54, 0x1250f606d84f68,
+0x36b9c733e594c6b5, 0x874a10a48dfbe8c0, 0x9d64503da2638b42, 0xd05221d187c8fc10, 0x677cf5637bf107ad, 0x68056d2b96888d3d, 0x9685fb42cc392eb9, 0xebeca439485d,
+0x1a44a66714b4acee, 0x7de0f5f2db457f25, 0xe3dda00c486cedd5, 0x6b1a77ea13b72845, 0x85fe68f9af7008bb, 0x3ecc4fc0851d1bd4, 0xe3bb58190771a17d, 0xbff4d82160ab9,
+0x6c0ad28de87d9704, 0xc44b7fcf4af41e48, 0xdfdf4af9980826a, 0xb046ca77d0445edc, 0x138ff65449eb6687, 0x654314f9237864c9, 0xef269502d34caff2, 0x1447198500452e,
+0xf4ae184f1c86b586, 0x8a8f06c9ec650f4a, 0xecaab4b55320741c, 0x6b2b94ca1f512ea9, 0xe4613f11a1bab2a9, 0x1ef81abfc0553d00, 0x49dfd4a922a274fb, 0x356a78618327ac,
+0xc742539e359cc252, 0x39e34831d7a761a1, 0x7be5195236b823dc, 0x390ed783a9ff1d9, 0x47ee8ebc91b953bb, 0xbdd299747dc3b58, 0x5965f96d3b0ac6a5, 0x2f867fa50679fd,
+0x1a07a0a341efc791, 0x958da2c4c28fdf2b, 0x989ed35bbf38b49b, 0x710b43f9ae7153b, 0x99af02a7e0e1fb21, 0x60af902349ebf88d, 0xc7e1a508ffd95a46, 0x3d58045b138086,
+0x372bfab424f282a, 0x6a926723588a508c, 0x50a63c5e17fe109e, 0xc88b639bf32da2d4, 0xc8c5ec313c9ba1ee, 0x4413b7683ba26f42, 0xb6437972d6b34521, 0x94562f06b264a,
+0xdf4605127cccb20b, 0x14980110cc3a5eaa, 0x96ac3f5aea2416d7, 0x99a2bed47270ad24, 0x7ffe2ff368893885, 0xfbb356b699dc8626, 0xa9c840c2e0d8da3, 0x3f4076065af7b4,
+0xa8a582a8115bd23c, 0xacbee34aaa76db65, 0x7576c9e592f56a15, 0xa2eab1c0e5fd25d8, 0xe793ed5b97e1033c, 0xe1999c59a4e36dc4, 0xc48326f4acce690, 0x14bdcef0fe0957,
+0xa2377d02db589c5a, 0x63be3e1991900a9e, 0xc88d28e63baada7a, 0xe21718f23d208802, 0xda2efca3c0ba837d, 0x90498da474a98d55, 0xb4bff7caebbf2e5e, 0x2746de6a6ba42b,
+0xaf3efb138ae3d4bd, 0x6e5b72a824f6f8d3, 0xb3260e86461a5038, 0x60adf5f1697353a, 0xaaa0c256d7f04138, 0x6fb73c85fd7d0381, 0x237f60aaa0cb1042, 0x2893ea04788e5c,
+0x15b1bdb4ff704131, 0x469bc142115b2904, 0x968cb5909730cb90, 0x81de9cf77f6c665f, 0x45ae26142f5694f6, 0x3cdbfa00b2fc61a9, 0xb3fa46b759913a0a, 0x34361288ecda03,
+0x40ffea8e6e6f3e5d, 0x2c8a52785f0733fc, 0xa979f59eb66b024d, 0x48f909a42d95b6f6, 0x260aedd4fbda5b29, 0xdb59bce34e1fab75, 0x8e27b0479a556db3, 0x7dec6ef72b8fd,
+0x52bf80533c9a5ca7, 0x2983b9fe06cb05a5, 0xfccfa4763e331d7e, 0xa39bf8c9722bcaf9, 0xa10de5fd088f2e74, 0xf9242700d4c06eaf, 0xd71c4e8370a4137f, 0x389d6d53271424,
+0x7de4a6f1939a238b, 0xac948ab427309d2e, 0x6ebb1ac424c2ef82, 0xfd092f42d8129f06, 0xf9e5b13670b7b061, 0x2be693b8cd72324d, 0xea97fed0ac2e44ab, 0x32595e7f9d754b,
+0x27e8beab3b153377, 0x6021dd74543f4a76, 0x223d3f3dd4d358a9, 0x5f6b36efe04f58d8, 0xad6eb055077ed22, 0x3c4127e643dc2ce6, 0x6044842949877cd3, 0xee849c0dec88f,
+0xd4bdb5a8dda8b29c, 0xfbee0b45f0ef84b1, 0x7f2e93e9d2622b6c, 0x63a28a93c9be3bee, 0x9f151975bf1ab86d, 0x943ba2915e0512a, 0x7f92fa78395c38c9, 0x33d92a68b95b48,
+0xad0e10c3d0e57043, 0x911b636a17d825f5, 0x5bf2063d6eb37d35, 0x6e0d43fdba0efedb, 0xb107f07b647bc7f7, 0x622b5bd3b9d734f9, 0x1a4cc6aeebfdd856, 0x2641a13532734d,
+0x2fc1f6a0e9903e3, 0x98a4ce8ef6b4844a, 0x8ef5051847f44e85, 0x8dc02630d8a65a2f, 0x16425a78232a9e4a, 0x66530e6a5ce6b549, 0x2b64d34b4988a430, 0x767b0ba00352e,
+0x691fc75e06f5d982, 0x3ab68d26622f865e, 0x54b7349ab2d7530e, 0xee4a7b90928367fe, 0xf8916c55aebb5a5f, 0x2801c2194b4ef294, 0x9a483d1058368b61, 0xa542dedde4cef,
+0x3e32f74b983b1fc9, 0xf80e4c2a5b8218ff, 0xda2a05d5d50e16e1, 0x2e80fe462428944a, 0xec36d4ff2907b1b9, 0xd7388b44f01cf779, 0xcdc84a132c935151, 0x6591671173052,
+0xa65b22cc58671aef, 0xa28ca929797e29f4, 0x19ed1e24c95e52f8, 0xa97bdaa3f371bc44, 0x5b0a1421a75f7031, 0xbcdf5f329b3af2df, 0xb8c67e0404362494, 0x575df9c08d003,
+0x8ca88f561f56e80a, 0xa999f0861d99b9d0, 0xac12698a7d89e7ea, 0x7b6862712122fd6f, 0x9a76d60cb94f629, 0xcbfee90a8f7855fe, 0x2867f47a60ffa309, 0x2cb4d742713de6,
+0x6470c0be66666934, 0x806b0cdf1984f449, 0xc84593a47c6837de, 0x37c218662661ea58, 0xa606461fce402d47, 0x40e18078166a7837, 0x4fdb3e7dc780820e, 0x534f2ec0aa2a8,
+0x227f63a4471ef0a6, 0xd791436e1c34e0bd, 0x17b7819914804d30, 0xad8d6df518ab83c4, 0x7e7cd1278b105885, 0x2dadfd1262a061f, 0x4ea10bd63e2c099e, 0xfd74b8903f707,
+0x2f9b79e65f3cd8eb, 0xecb604b6ea4ce187, 0x12d7009d2315e5ac, 0xfd617433119b5a87, 0xdf17d6f6820bcb45, 0xc6bb2a20322c62b1, 0x218f6db6cf1be1af, 0x34bb3ecf60bdbd,
+0x39d159ee7530caf6, 0x6458f0bd66e433fb, 0xab6efa295bc65846, 0x7bdebc848038fcaf, 0x778e19af56d2360f, 0xfe883b8d55a0fdcc, 0xefe780fcc82ddc68, 0x9bd742abaf71f,
+0xb7edf978428a8a4d, 0xdfdde3ada97179c4, 0xb0c01b27e1461778, 0xb72d69842df2653f, 0x2f042e3704a55740, 0x63f23c045393a502, 0xad8a824e9c09dd3a, 0x17cb557601f275,
+0x2278cb53272dd69, 0xc23111b4ac9640ec, 0xcf061975611d292d, 0x6912e7e01dc24cc3, 0x13d2f61ccf347f46, 0x5da51bf8c044532c, 0xa40fb0400a9e6373, 0x12de1811a2ac82,
+0xc658f9f8e6b893de, 0x224995f33d2a2f7d, 0x8e79408d738952a4, 0xccda85aaccd66370, 0x9586f306df1b25ea, 0x144eef929df23481, 0xdf088b72af606fd, 0x96c6ea9980bd8,
+0xf75b086194fe2f72, 0xd21be9cb975d9902, 0x8ac58180e2218443, 0x58fd12843ce9330d, 0x12f109c7b76fe6a8, 0x2068fb5efb17bfb0, 0x47417275e612887a, 0xe0c54b8f1b2d8,
+0x5fa3ccf82463f94, 0xc6a9417884388447, 0x213e19df39b23fa7, 0x5c153bacfa9b9db0, 0xa8af85bc725162f3, 0x188092a055e61664, 0x8b022d6f1339ce58, 0x2c714e3f9be7dd,
+0xb9299b13cebf489d, 0xa27689aa0d1de0ba, 0x25bc89322130e5b7, 0x5f3f6eedaa6c49b0, 0x2a7ca1d1515b1e0e, 0x12c10611d0db7395, 0x22b7fd39682da218, 0x2fc1687a1ebf8b,
+0xbf8a4ae9caed7bb6, 0xf31f76c463235c62, 0x7c3927ccafea6d26, 0x319a903c0b1d8863, 0x5d8a108d4513e80f, 0xed2c0c122c705f9, 0x83bd5327f7f63697, 0x282c6ae2d4324d,
+0x8d3e8861f5a0def3, 0x79d802fc8d0480f, 0xe3e0efe2f1794783, 0x916702d029db65e0, 0x4978176dcc25f449, 0x6f2cbeb292d13c1d, 0x9dfac35fe4340f6, 0x18004e7b47ea10,
+0x343f15b0df67a4fb, 0xdeee4499e2743051, 0xf76e093a1c713d3e, 0xecf0c4bb1ede8a1d, 0x292ad2ee1d842aea, 0x24cdac350266c57a, 0xb6954b0b5eb82df6, 0x14c45c46c7d0e9,
+0x3db98cf2ac2d6258, 0xa7f67050b615b3a1, 0x7fd9a1346e6029ad, 0x2ec9efd0d3c6a359, 0x265f4168451e84a5, 0xf3dd6a8582143b78, 0x6a218a9533697d68, 0x1370bfadda914d,
+0x8a0aa85c954e4121, 0x1d6bfd639022f607, 0x94e4dea00637f6, 0xc29f7f049a626d7a, 0xcc1a005e09eb1473, 0xa226c9abe9cc7b22, 0xe7173014f33e8af9, 0x1609fe2ae561ec,
+0xff85311569d512da, 0x4e3299a229b55134, 0x95555ab45bbcc3c6, 0xd7c3485792049e9a, 0x97d857f48db6bacb, 0x4642b6fac012b4d1, 0xb7450dd026e8e9bf, 0x3bd171b8be479,
+0x14f822282f0d30f0, 0x8bd2c174a6e6564, 0xb52254d80ea95e37, 0x91b5f0c68c6bdbd8, 0x5186f732f77dbd62, 0xcece55d4d55f51d, 0x7b274faf60bc3362, 0x96107f381124b,
+0xfb535bc5a0b07292, 0x399a1c50610bbad0, 0xf1303d87531c2e98, 0xebd1aac94ed7e9b, 0x3180a3e3927dc08e, 0x4790b1c3f69d5479, 0x47eb652352a1cbe0, 0x231798d7427e3f,
+0xd13136517f6defcc, 0x63d12a780c8df651, 0x85b7e7745a898604, 0xf013a58fc5f150a0, 0xe9535c4434b8258f, 0xb85dccffef0af95d, 0x84d21a2727e23436, 0x2ad23b130fa697,
+0x9512417dd03cee0c, 0x8299ba802156d3a8, 0xa00c1b22f896a13, 0x8ef665bd7e0baaa0, 0xe8b6173336d77b91, 0x5c7aa9e6d1ca0b1a, 0xab3e7fe5bfa1b11e, 0x305eeedabc7347,
+0x9b77f3ec6eb25b5, 0xff4525ee993311b7, 0xeb807713d337241d, 0x386272c495a42859, 0x2fc77d7084f86431, 0x121cd899d1252ca5, 0xbf139760a491df7a, 0x3b797ff41b335f,
+0x7f5e823ed38b69d5, 0xe7d9b51af7de03ef, 0xf6b18ca687caec1a, 0x85279e60ecea3fa5, 0xeb2f8736d1f5338d, 0x36debfc4404b1185, 0x4974a03379eff3c4, 0xb6f6d5205d58b,
+0xc2858d742ae0b910, 0x21cb7c6f3fb5799b, 0xdd5de32ec97432d7, 0x8f43a2de8bcebe70, 0xf07d21a6b31c4503, 0x2809ab6954ede21, 0x277975705c5f153b, 0x38a5a9b3785b96,
+0xa04ff1609191683e, 0x2783ba2b6fdd4b02, 0x841d24287a1cdef, 0xe4fc891c38eccb42, 0x790c57bb59e73c2e, 0x35462852df146cb2, 0xfdb474fc73fb1482, 0x3f6f9370b42eaa,
+0xa895cc433e49f997, 0x20be1c4fef08445e, 0xa0dd18ceadf6a0c7, 0x4ec50e94367cdd3d, 0x19ced61ba44764cd, 0x1d4f2b076c2656a1, 0xe66bcc54476b1b0, 0x2a611e1999cb9,
+0xe7f04868cf98c04c, 0x3b76827b0df0e38a, 0xda0008286dd0a7f2, 0x4afc567c290f29e, 0xea18a3d9507e4095, 0xe6b965ff878f8ed2, 0xd1a17d644247f188, 0x64ab407a5df95,
+0xd7ceafb40bb91a8e, 0xbe0cd8e6b12bac, 0xe01e2b41c822aeee, 0x86062318ec5e1fa1, 0x1c89bd03dc142e61, 0x831fdae41002a6e6, 0x4d693c7b93e11393, 0x3c51501b1f1196,
+0x51ecd13d7b247f06, 0x964edb01fa12de61, 0xb78532f282d654c6, 0xeb484a09b394d08d, 0x99dbf5f7ca427f00, 0x917a12bca2b2bc47, 0xc580464455baacb8, 0x167ace0f6f1b78,
+0xe2dac0e323bdebbb, 0xdf0e44bd98b689a2, 0x57ab69e8e63599f0, 0x6530a3d8b903aac6, 0x1ccfa16896c0836, 0x3ad464631b959b9e, 0x8ea418197b3f0448, 0x1a991207eadb16,
+0xae3390df4338fd37, 0x3cbfb2511c02e39, 0x615ef9f84e02e561, 0xdd142cdd42d425c7, 0xc11e4ce5b995e966, 0x9050fa7be9b605c3, 0x9215bebc748b5eef, 0x6b0eab16c4295,
+0x4fc64a7d0937ed3c, 0xf98a07038ee7be7a, 0x651f90b30a3d2a5a, 0x88c65bfb44ffe0e0, 0x1d29c37fbf704071, 0x88f61ad8b7092872, 0x7f73c5b3177a880b, 0x2c2dccff21615a,
+0x92b48903a11027b2, 0x4a2fd3a6676177ac, 0xa01202621db941a2, 0x60f1ab0c86a7c712, 0x2bb0875a20a7884d, 0x89dfc4c81529a18d, 0x33b8b13bdb27562c, 0x132252d90f72a4,
+0xf0d5bf02c200868, 0xb032703ce479bc1d, 0xfba990b6a0353347, 0x2a24654a83588746, 0x66881e417d82f17b, 0x7098a73cdacff3a2, 0xdace176925c0f508, 0x179f5a3c2977a0,
+0x4049afe8d86bb7eb, 0x2ccc4ea093432805, 0xd872e6d1b2ffcb54, 0x7640482f2abeb0eb, 0xd7017b8255c3fe89, 0x8f84f83ce87a804a, 0x969c7a983e588609, 0x2532a0fc0c686b,
+0x754896210a0dc889, 0x105d3c06cd599b06, 0x9796019adc7aec21, 0x5b7ee48aa0d2cb98, 0x52d7ba4095164ea0, 0x453a9bcd59d663f2, 0xc83794aa30cf8acf, 0xc96f422323536,
+0x2a7f5ecdcd8e7c0d, 0x4199bd8529b0b2fa, 0x9aa29061214b8180, 0xcac6c7b69772a295, 0x40a3095d388a3fe2, 0xcda43c344feaeffd, 0x87ef9f03b2eab9b8, 0x1c19560f5fb6d,
+0x12307483afcfdf0e, 0x73d63564cf7a4435, 0x84b1bdaffd17ed, 0x6fd7ed8c06bc9b8d, 0x137f7c621fd63b97, 0xb5bde83685c7a85d, 0x5a9005e273b4042c, 0x23568db54d6739,
+0xd448b9631a93ecde, 0x22606133e577cfd1, 0x3bd1c2d4549fadb, 0x70e4e7429c39dbb0, 0xd8076d0ead21abfa, 0x2aa06613819662dc, 0x4c65539683b0881d, 0x3ae34732d4f6f6,
+0x37ea17db9ebcd009, 0xba99e0408589dd95, 0x780c80668a8c71a5, 0xef1e0b7e26715f38, 0x17cc4335a238c5fc, 0xe9f5df83f02a96ba, 0xc15f2d007aab5738, 0x2f1a318396877b,
+0xed3e54cd853c516, 0xb5c8bd62f53dd384, 0x59bb3106ac98f859, 0x47ee8e0e654a203f, 0xad0e84df7a6f4c0d, 0x2f240f732a997d65, 0x6c1fb871a7915125, 0x1c25191df86afc,
+0x8d6635d2c29a0e8a, 0xc8e82842aa41aa77, 0xed1fe3fe613c3c64, 0xa178bff1e386e1e8, 0xd49d5684b9c2e72a, 0x136e759d4b19404c, 0x35e1d082d0935959, 0x96d2dca2704c6,
+0xfe8ac96e80ca8065, 0x8920dbe1b9cd354e, 0xdc61f6c4693d1997, 0xddb9e564dc753cf5, 0xb6126d64234ecb17, 0x4822e3baa20d303b, 0xcc937e37e8cc41f2, 0x3d7dadc5712876,
+0xe2794dcd41a0178d, 0x68a0f3c5fa02338a, 0x8aacbe5ed0997b52, 0x1ad8c130d8b8202e, 0x5b1e38d85ed8627d, 0x95389057d216f600, 0x5948e3da8fc46712, 0x2a1725d49664c4,
+0xeeab00b3837a9278, 0xc368e13aa112d526, 0x4cd14a0cf7faf641, 0x5ff53583a9877993, 0xef1476fbd49d388d, 0x523b214774295433, 0x3bf3bcfe0656d046, 0x33a65deac6c8d2,
+0xeb2ffada22220339, 0xc1a301096f52440c, 0xa915791f752f759a, 0x7e3e778c19b3e85a, 0xf1f87e670c2d6b38, 0x8330b9b9cbaf454, 0x25161a100ba85d87, 0x37197ab8425a8f,
+0xac53f4fce4c38f33, 0x3ff8079b7100435d, 0xe18b5c2813a20d6a, 0xccd4c13a13c613cb, 0x18b9133fd54e03a, 0xcf0ad1c316d519cd, 0x8893477b8cd63025, 0x28685e9b9ffa18,
+0x9989f09440325c62, 0x548072a3a9cf45f0, 0x589d3ee47fc1de7, 0x11905b2551bd0821, 0x69505ed0cc3fd313, 0x3ef7286e429a7ecd, 0x2efda4dd9d53e6ee, 0x3bde23ba4b6a39,
+0x528eb4b954a61eb2, 0x1a5cdf0165c7467, 0xdd195d4cb6f86d06, 0x5e4434d86d7ea994, 0x4b0e6e47ca98d0d8, 0xeb6e6215fd095048, 0xf5a1ba07756141aa, 0xaf84cbbb1e695,
+0xc21ec3fd926aa64f, 0x3dbd0388f1e8f28a, 0x2ab41a67a7044630, 0x3fe54b2fcdf9f60c, 0x531792694f72e741, 0xbabf244720090a4c, 0xe52fa2af6169697d, 0xdbf446b743e3b,
+0xaa61e72811862752, 0x614c570513c0ef61, 0x1ba4191a81bd057e, 0x54a2a8cd5fd1feaa, 0xfa7f9d3fa07d8304, 0xf56de30d872818ed, 0xa055b519004722c, 0x2df0e6d9276f9f,
+0x7b6d5336b6857a2f, 0x723b534ab7ab52c3, 0x984350c58d13b92a, 0xb61fa901927d58b5, 0xd2ccd3467b3dcb4b, 0xf7c70857e8ae3de3, 0x839f3436b4ec6b5e, 0x794452d9db030,
+0xbd2b040bbc61fb86, 0xdd671ad4938a361e, 0x59eaed31fffd81a5, 0x567b88c2cf8714d0, 0x8a3aa9904d3f8cd7, 0x7181951321575236, 0x29f09f6eff0ba3c2, 0x3f6859fcca2bbf,
+0x40c03affa09935df, 0xd8ea488744309623, 0xcdb36228c6a6e99f, 0xccd1693ee7eec72a, 0x28104645ed52529c, 0xfce222ee54a13eec, 0x7dba8d09ed013f7f, 0xe603cd5fd79fa,
+0x12ff76e46da2c0f6, 0x29bd5f750b2d0797, 0xf0f11a8f8712aef1, 0x82d800855f1e0d28, 0x731ead5d087d3a66, 0x4d2ff05f3407a500, 0x7e95966be56dd85b, 0x1cb04d78df98ff,
+0x45c4a81e712edf1a, 0xd88e64efa42ac6c8, 0x40f40483338122a3, 0xb9a9861c76a0e7f, 0xa1b9858d60c3600e, 0xea2958467a21ba67, 0xe824acc603290f95, 0x21321d789fc48e,
+0xa7364d5af0b6b3b6, 0x5fc60ce2db36cea9, 0xdb6a1bdf4ac2a6d6, 0x16c8f85437e21bea, 0xd48d9577f4ed9721, 0xe9a5b9eacc5f6ae6, 0xf47febdbb69155f, 0x16ae159f9a0577,
+0xd39b453471e61973, 0xbfdafedb1f9dd1d1, 0x52037c9abd68b885, 0xca5f0caa9f2fb9c2, 0xbd708bdd2ad3afeb, 0x34f4921c1fdd6e16, 0x576c07083cc2475b, 0x270e916a9f79fd,
+0x95fff9985d7a7427, 0x86983fd73efaf96a, 0x5b2ce925869b8e6c, 0x70e94f148276de22, 0xf22d5a93ae7a512f, 0x69e903e1959291f2, 0xef5907dcbe4e5b77, 0x26c6ba0d4a5582,
+0x91e5089fbbdc4269, 0x5b3b7320dad3b539, 0xffcffba0bbcec151, 0xf5726e6d0714070f, 0x798f3ceebb1c2e94, 0x5a9e2ac1d8d04cce, 0x9b25d7059e93b23d, 0x2ad78739df9969,
+0x3ca452973a473b8f, 0x91f477668006db34, 0x57a16b16cdd86a2d, 0x67f40499b5c36cb1, 0xb09bd2f10c2cf5e2, 0x37535abbbb3c4520, 0x2d297ea0e858fab1, 0x3841340ae0a0ed,
+0x376322dd56b614e2, 0x6b4e3a51158446ef, 0x668daf9716277494, 0x79173c4d79a81d08, 0x5a5084ee92500a90, 0xd91d8230aa5cd136, 0x8d620d7ec44f2019, 0x3785b35fe88312,
+0x8e1eda0b6a8d788, 0x110c5baaa07b29c7, 0xc239bc56ff04ff4c, 0x21a69adc46e73898, 0x97893e74d7749170, 0x8ec9ef94dc3b0f6f, 0x8d4a99a9ecc69c3b, 0xbd3146cc43101,
+0xaa25e9753d24781c, 0x5d941ca6ce44f8c5, 0xa3a7f3ec30ab9f5c, 0xe58091af323017f, 0xf8de38b66a96a879, 0xe4446a30d6e10316, 0x1d8e5a9a9c92ca88, 0x1b3e7c7ba574c9,
+0xa6f57af671e42151, 0xfea86ab1a3be65ac, 0x4830c31eca8f1daf, 0x87f38b42720260b8, 0x5e94b32f07007b2d, 0x156a9e4a3fddf6b5, 0x546911b3b08cc788, 0x4f5e08e7b03ea,
+0xa5c3d422706dcdd3, 0xdb1d3582f762931d, 0x9af55b84a0a59b3b, 0xddd3ae2b7bcfc044, 0x6a7ae8e3a16b006c, 0x8ccde24802ccbb6b, 0x7039c205a52bfc88, 0x8717cf1d10732,
+0xdca9339d0bee6126, 0x8a6f8e2839e6231d, 0x153c997f9185216e, 0x13d05d99f6dbc33d, 0x2bfc90dfb6d495e1, 0xbcc227c5f2b252cd, 0xa7d1d5aa4548b0ec, 0x168e930d3ac121,
+0x87fb30a0a7b08f77, 0xb0c5eff7b9ea050c, 0x6978f8cbc72b67b1, 0xd34e7bd3d2d765dc, 0x6075ed920f9d434b, 0xf00013b3379662a9, 0xc358f5a1cee92dfa, 0xaae11bc73b9e9,
+0x60f9cf0b5eac4268, 0x2e2adddffeece880, 0x6a95c810b6907e69, 0x34533129f9756d9, 0xc12fc23394d857ef, 0xa6cb3db870c27387, 0x2fa4153fc9c0cb37, 0x2c057d80e0baf5,
+0x5e20de00abd836c6, 0xca22b8f159a59a1c, 0xa286b4332dabaa4d, 0xeb1c5f614026b05d, 0xd27bbd209d0c91e7, 0xabd00c4f4c38829, 0xa8339f420c47786c, 0x1346dcea2f303b,
+0x3d420503959ac2bc, 0x8785901c9da92bd8, 0x6e3c112e3391f92b, 0x1a7fd7b9422d9c9c, 0xd98cfbd743adc11d, 0xd789aa50d502bf33, 0x6dd20b9282d9d9d0, 0x40024907d30971,
+0xfc69cd8c8670eff, 0x628e5c53500ea546, 0x398812ef01c3b95d, 0xae19eb17a66a7b35, 0xa259122e3c831b72, 0x269679b1cb858ccd, 0x820a28816d814d8b, 0x3f5fa11477ed83,
+0xe34badbb730e4796, 0x2ba04bbed25e97db, 0xd99995b30a1a5670, 0xc91c692b13dd289c, 0xb2154a21b3d2da3e, 0xcfe703a90978d2c4, 0xaf26cdeb1437babf, 0x262ad43a7e3788,
+0x2f750e68c166653a, 0x1f1bc53386e985cd, 0x778caf6be4ebef53, 0x5c4f92a75d515489, 0x6d1fbc9fc9c3d9ba, 0xc057a1c10b7e68b6, 0xcb041d3ac130b0c, 0xa14993db3b171,
+0x42803fb490247070, 0x6204cb61b0f9894, 0x1b741b68939738bc, 0xcb013896b2274341, 0xbeeb510b57c71039, 0x4020c79eebf55355, 0x69a29523e972a5eb, 0x392202d425554c,
+0x9cb9f0e6a4a356c8, 0x1d1abe0215d8c314, 0x85ffa87ac0bf4c38, 0x592282bb816e75c6, 0xfde342cb17e73e86, 0x24aebeb182848eab, 0x25c59be39ccc8354, 0x21c75ace66138b,
+0x7cfeb9feaaf703d, 0xc7a519dff4b0090c, 0xd5b26b24ab17546f, 0x394afe5f08ff6fcb, 0x4597dfaf2d73ae9, 0x39543b8414a552b9, 0x9fb19005ad83afc1, 0x3684cf9297635b,
+0x787e99b110f7e0db, 0xc094c23d54b9826c, 0x3b0f37c50504fe15, 0xbc2ca4f033af0921, 0xee5302e6dbb27c69, 0x99ca29bbb1abac0e, 0x8bbc77bdcc685eb5, 0xac2d47ac836d0,
+0x254417a91c362262, 0x7311e5c2772e71d4, 0x8796bc3ba138d684, 0xb98cc75902b67b26, 0xab638c7f864ce286, 0x8b0495aca1969563, 0xc99838ac3a869a3d, 0xc85839e52dcdf,
+0xa529f08993c35b, 0x15f38c343c98190a, 0x550d6692769d09a5, 0xc0af4573b51f05c9, 0x1d5987828999084c, 0x5c3a3859b284946f, 0x62738c0f08f051a0, 0x31c6b4ca711d2b,
+0xc7953d2a874d008f, 0x6bb037cd7bff7265, 0x2d872ba0f3ba410e, 0x7ba9a46f447e466d, 0xc2d089a4fb139a39, 0x650d5b27f71cd02, 0xba200db1d556a75e, 0x12047cde87037,
+0x2b7f57883bf50c06, 0xf90d4aa8f96ff480, 0x198435c6f20ce120, 0xc05a1997190f0c32, 0x76a31272ad598e57, 0x77c518e143c508bb, 0xf7f4c0bc8afdcb40, 0x2eed57f389590a,
+0x3e9cb02b827270c0, 0x310fde304ba14eb0, 0x150d7983ad3b2bde, 0x14aa4a966e999c4d, 0xfeecec76acda1ead, 0x482c5de3e38594d8, 0xbc74670ee2801b17, 0x1b7568aa0db57b,
+0xdce97503036e34b3, 0xcfb5d5b0c2f0bb49, 0x2295ea67cd3510bc, 0x5818313f87822b64, 0x8f60463c88cb5486, 0x53320e7723d660a6, 0x43bf445b2d6848d6, 0x87fd2ff26e5cf,
+0xb63e6a25aacd11e8, 0x97111280c32ca94e, 0xb8b9d8da434f9301, 0x1ec84edf3530f621, 0x5a171d2751a6fcd5, 0xa45426fa45932126, 0x23bc8ff279a4a9d0, 0xe54814596ce62,
+0xdeaf430df4899654, 0x22784107a442d818, 0xbfc1a79e355cbf9d, 0x171efadc428219e9, 0xa1ba5ec7b55bf92a, 0xe19ecd4cdc0e1def, 0x574b838cf660dc68, 0x2b729e2f6523c3,
+0xd2026332deda221e, 0x7168a8da208833a9, 0x9aeaecf58f37a49e, 0x72452687c8e126a3, 0x7375f69fe36fa9df, 0xa46fb0a6790f5571, 0xdc96e6179470dedb, 0x45973742e5920,
+0xf8e3b28b79c87f2d, 0x81f08eb669231751, 0xf0e8209f6a23e1b, 0xc8d1199f4ef551e8, 0x6c5db3dd4b6b9cac, 0x22fbd3ccb35e2958, 0x354e573133726509, 0x26d5d9cb91a016,
+0xeae271bf1e3d2dcd, 0x24d69c11860c49c6, 0x8f9224049964b34, 0xad328353974ebd88, 0x3c31276720e10371, 0xa435d740cc4c0e5d, 0xe867742ade3b3b24, 0x262b337cd6ced3,
+0x58aca0f29ee1874c, 0x2d5faca19d2dca6, 0x80f7ef9b50870a1f, 0x67d95c76579333bf, 0xad8fdb94817ff686, 0xff0b1c02e68b1dbe, 0xeb35ec8756025326, 0x2fb7dad4915247,
+0x374030dd9223871, 0xabfdf9b5b8559259, 0x9bd5b6435c15dc7d, 0x2614090a16de479, 0x67fea3456391555e, 0x5ab5d452d8e28508, 0x9be4336bb78f7937, 0x9525f7057f828,
+0xd7beff2dceec3382, 0x1ab9787a140df55a, 0x90336c4da67fba94, 0x21657fd493787fc5, 0xdf2f42694fe4cd10, 0x6e20fe07e04a0f9e, 0x7e4f0b7f08c12ef8, 0x151c2f37288ab0,
+0x156ddb7b4373717b, 0x6226b2fb53a3fd84, 0x7f53d3d9112c271f, 0x532953c0be2e3610, 0x3d22683e74c700ad, 0xf4d8b0dadc8299e8, 0x183cc7765dde8031, 0x1d899121146389,
+0x103f8e33a1e523d6, 0x882b2956579b9db2, 0x4f0bbd19a00b0f1, 0x5fc010986a7dfe4a, 0xb9968549ac3f3ba0, 0x9120f5458f538c3f, 0x9075d9af5178b231, 0x345fa757bcbaac,
+0x6d83d299ecbbeb2e, 0xb0bdf7bfdbfe7599, 0xfd7104dc3e2e8005, 0x3ec203b1fd6f96fa, 0xeb476feb65330e38, 0xc9330c9a0b543e72, 0xd1936d1f2feb73df, 0x989d1dd39f4d9,
+0x3ba77c3969267b29, 0x531066b4521ab71b, 0x351341c0168f73f9, 0x5e56543a0a861ceb, 0x2214cca7c8b031a7, 0xe0174e54be498b95, 0x8f24d04865524854, 0x2fcebc61dc894f,
+0x7c6dc5653ffc6f4f, 0xe0a1a2fe43cc8afc, 0xc91dfedba5d28925, 0xaa30c9cc6c232b1c, 0x90ff6ec66094a369, 0xdbad929b40c46efe, 0xfd4a489f2c696000, 0xac100bfec7700,
+0xd3fc39dc54ccfa35, 0xb5ca65ed4723be3d, 0x440008df1a34ddf2, 0x2a9f9f8affffaa04, 0xf5c9d71aeca49126, 0x14a3ce10ec85eea4, 0x818a514f93f11dba, 0xf9a6845bd20e3,
+0x2753b44792d64eb, 0xfdacc02574b4627f, 0x8c6d189f7f698f4e, 0xb9fb3178cf763192, 0xd5b22651cea6cb9b, 0x725f0406db1c6406, 0x9c5c2ea24629b7b2, 0x3ab2dfb01bad8f,
+0x4079bc2670e08933, 0x40559f4c700026c7, 0x9a859b19ffbccf56, 0x3b86c86ec5e5e67c, 0xf9ea4bcf92e64c88, 0xb918361dd7bd78f5, 0x8601277f21ab2c01, 0x19f38bc4a18dac,
+0x83e67d8ce3163a65, 0x3d2c2734a56a6af6, 0x873065775d9829fd, 0xd608ee0402e2055b, 0x8884310e7957febf, 0xb0b14ab184bb36b7, 0xbeaf640285924c22, 0x19e744755fd1f4,
+0x5cfc1fca43dea463, 0x3f4235d9515424fc, 0x47ecbf2c2aba16c2, 0xe70ce2b34b417c1d, 0xfa56e7141bf53329, 0xa62014a2cd861338, 0x38b9c2ce9f5045cc, 0xb5e0037a9f406,
+0xf604e923b5f6c613, 0xa76f3b59ce1d5be7, 0xb932e4c721ce43ba, 0x4493d07b067a4a94, 0x23e1ce4b04100987, 0x65176dd4d8caa7eb, 0x6c70aff513cb9c00, 0x2f9fc93c64ad47,
+0x4ce24155c3e2e56b, 0x655c905a37b3891d, 0xaa23d7514c5dd64e, 0xa33f1af64df41709, 0x221efeda0e08009e, 0x60e2efb4203a382, 0xa13f954cc5387983, 0x338f3a38301cea,
+0x6c59070ff2005902, 0x74f704d51c24499a, 0xaf60cf2f87d40184, 0xaed87b8873c82d20, 0x9f2e67b5ad5693cc, 0xddfde2ad7611ec6c, 0x2145c8697061ac98, 0x1c0dfba45a6a2c,
+0x1e4482d53f040342, 0xb7acc330e0859ce9, 0x21a42e3e9aa295b7, 0xf46159a6b69d51f2, 0x6be5307481a4b027, 0xa0f2db2896e97122, 0xb545bc6373e8795, 0x38dba6fc11bec1,
+0x7032659e669c0716, 0x470924545830f7a6, 0x31c430e7290be27a, 0xe6f91b8d7a609ef1, 0xbd9f5b7cd6c6fce3, 0x80be1c22ab92f2c3, 0xc52171be9b92a7ce, 0x387b9413898a6d,
+0xeee80b980fef4681, 0x2a7587867e581d87, 0xc847de792439cfc4, 0x49d02dde0f1b1ebd, 0xcc9e3115ce734571, 0xbc701c6830961cb7, 0x5fe15ca4129a3080, 0x3f3be8c1a380ab,
+0x1eb12cff53b914ec, 0x373e03492ae1c2b, 0x60cb70772fb43be2, 0x8190f8ad271ac5f9, 0xa6d7e881854c513d, 0xd89f2fa84e40d4ae, 0xe08408ddff09c59a, 0x1d2c31fab51ab0,
+0x84fb125742ec194c, 0x1bb3c8eeec24dac8, 0x26b5038eb4980bae, 0xf9ca82bacb0fa1ab, 0xa76c57808f0bf566, 0x54fcd3f18d7b7350, 0x65d7bb8e67f4ad53, 0x650105f719ed,
+0x41defeb28de94b69, 0xff52acec6fc4010b, 0x85539ab81731293e, 0x6263bf27d2a967e9, 0x16ad08b13b11f087, 0x7484e293b0fed9bd, 0x4b2578085aca44d, 0x35369452f3ffa0,
+0x85cdf5e62fee9654, 0x81787e246046703e, 0x4458d4c71c104a, 0xdc429887655ece02, 0xe941fd02dbffc345, 0x3a6bf028a4a34f9f, 0xbd665b79a5504417, 0x33c578adcc1488,
+0x9ad2d39d92502de2, 0xf68ce4e28922e953, 0xa6c0e1e1d8099d40, 0xb3f132a41a9c183a, 0xadf61107a0380544, 0x9d4a3b95b655f1b2, 0x720b628d28391a54, 0x2ad1d673cd8734,
+0xba9a8122a096d56e, 0xea3fa69a661188ef, 0x13e142001d592112, 0xdecbf1b76eff1196, 0x88fb5e260aa374f4, 0x9d4b6b498bd80fc, 0xbfa5d928d9153e78, 0x1a38216c6fa096,
+0x5df0733557ee0e10, 0xaf43ca11580f4753, 0x4c6a7178c8e282a8, 0xc8d1295881e97ee0, 0x205eca961d850708, 0x367f0365503a4c7d, 0x87d01cb142c0c7fc, 0xc4afde4fc7253,
+0x7812789237b0ea86, 0xae012f22d1fc5ce4, 0xf8131360e1548dee, 0xefdbfdf100499aae, 0x2fa5dc33d988ecf1, 0x8f2af8a0250ca900, 0x5b8fb907f7ac577d, 0xc6655f64e8180,
+0xcf897bc1021b846b, 0x319c49bdbf0a1d45, 0x6d216ff6de09a8dd, 0xe9f10251e58ab66a, 0x989a5e8daf5bc8d8, 0xdbc0878e262d45fd, 0x64c9ce79dd8e3072, 0x2a55762d54fdb0,
+0xc20f29b2cfacc8e, 0x355620e4a563914f, 0x87d22483ad1360b8, 0xa9cbf1f143648121, 0xe608ebb8afc02567, 0xd7950469a276ea7e, 0x4aeb24ca28b7170e, 0x389f5ec3448bad,
+0x1eb741cfaffa9096, 0x42b8ecd0cc05fac4, 0x7950422a11d87c11, 0x4d05111a76593c90, 0xb710be35596b28ea, 0x75d60bfe9e0bc3f3, 0x5a500e8eb68dac6a, 0xf56223218b191,
+0x4fe2862c13dd6bd8, 0xf7e71961d5a59910, 0xdf889d25ac406852, 0x4366e5053709ffc, 0x4bfee680e96e832b, 0x550391b8324e85e0, 0x434f034fcebd6704, 0x1b01009d79544c,
+0xcbc17f2d1f4f5f16, 0x1ba7f7c21659109, 0xb994947023146d79, 0xb3f5071324c1e939, 0x577baea9abd106ac, 0x484dd9684a23562d, 0xd15a6c9095f7d293, 0x152a08019127a,
+0x57a3c7ad3fa4b69, 0x71fd52141314a062, 0x8ffea5d6d5911304, 0x706e76f97366f754, 0x1ec098b0de06158c, 0x60fba4c6aa1246f4, 0x28f64067db148e2c, 0x332e968f4ccc39,
+0x81a93a8846484de9, 0xd20442f6c34702fe, 0xc39fad1b61b50b44, 0xe854be4cf6aa607f, 0x69dabfc009065199, 0x14db6cf979a0ac5e, 0xbb51483f5d01774, 0xaa194c3f72774,
+0x8bba821355842d25, 0x18ec7952304da3fa, 0xec0cec681959eb50, 0xd869ebdccd8aa039, 0xd078dfc4ffa13a93, 0xaf6790719b11582, 0x7cfdbd609e166fc9, 0x358c6761edc46a,
+0xa160f087a5a0b3d2, 0x197b6f6cc929bfb, 0x94eff30feebc7229, 0xdda4842f670f2549, 0xa24b69b713f99454, 0x99b5df2163b2df83, 0x6708f7828dc1c040, 0x1268da952a145c,
+0xf7226d957cff47e5, 0x3aaaa068bcc4de2f, 0x75e12573a02ac30d, 0x7a9747e681f49495, 0x9789252ed3d3c722, 0xe4b63ee91f4c4d0d, 0x41d9f08f685142c, 0x1d8b415f900cd1,
+0xee10db6a9d8b79f8, 0x1244e5dc42f9ba19, 0x7893c2c6c2bdc743, 0xb9319d2070b53f2, 0xfc483e97650ea335, 0x9afefcc86b72b5e3, 0x380ebd312081fd23, 0x2b8fd77608b222,
+0xb3ee86baf6502e2, 0x531a7c8c5039fd5f, 0x544276a7c3e05f16, 0xdab63851f84b641b, 0xe83c178b3bd2dcc0, 0xb56ebdc29bd7b816, 0x5c1139981d1b610f, 0x2da0948d81de42,
+0x9c413faee6cb79b8, 0x78e64028a5280ba6, 0x90ba6dbe40a5f576, 0xd04140fac001816e, 0xbe43ab70b6feecaf, 0xf22b90ac4d2bd2b5, 0xe94f9562cc06933f, 0x1eb17fab366a9b,
+0x471655a8dabe9710, 0x45c57ec3faeaa932, 0xe3134aa56acabf10, 0xd25237e78699e32f, 0xcc933c7be352fe1b, 0x4c627903718dddec, 0xb22ecc697ba5ee27, 0x18764f25194cfc,
+0x4e1c780a7c568023, 0xac0c0b617d4889eb, 0x148752e003776dda, 0xcb4c7d23fc1aab09, 0x1cc3e87f1b217b8f, 0x16ee5cdb75f28ffd, 0x2f5d1204052c840a, 0xf43870c01c651,
+0xf04eef8b8548561d, 0x265fec0d4306719e, 0x22b7148432b8ce4c, 0x1f6995069d587f93, 0x888e9770800fc26, 0x8cd86e6f9745fb05, 0xbacf7aad542d9983, 0x35490758b01eef,
+0xe318c57e5dba9c73, 0x257c41988c17a0bd, 0x941befb3a213a4d5, 0xeb8384ae8fec0568, 0xd659dc5e386de799, 0xefa9245968776b78, 0xfba158b59f89be86, 0xe8cee09543a6a,
+0x9e8cb129dd93ef31, 0x205e351bcd734189, 0x2fe119733b0dca4b, 0xd4cbe11f6c0e4b80, 0xbd8818596ade1921, 0x250ab3d62014289, 0xf3388b8d2bcdddc7, 0x2661d904e6ac94,
+0x429fc33dcedbbf74, 0x5ee03c01df045fdb, 0xdce6ba1bc5ca4981, 0x626a2f22db669d41, 0xe2a11ad7a13df8cb, 0x97fc25c2a38800e7, 0x89690e26d85bcb70, 0x2b4428d764f657,
+0x24a6d79af0530c02, 0xdca7a9ba5d1e324, 0x837c40cd283d35e7, 0xa5c7d1a8125087ba, 0x34cc8be02226a386, 0xb31fc2e9e534ffa0, 0x58e48b8b8a0531ae, 0x16003592b82135,
+0x64ad2135d21cedd9, 0xb78bd8ee47c06f75, 0xd8861f48c52af1b2, 0x39bd8449927103ea, 0x846727c6a1d7a284, 0x772431c8e20874b3, 0x33a00ab905ca38d0, 0x444d57139b106,
+0xca7d005968349b07, 0x4d1fef2fc5d6b394, 0x832346456906f660, 0x4386dd7d959e182d, 0x8bcfafcf48050357, 0xffaabbff566d2728, 0x6891577f40945356, 0x14a8568de62f7e,
+0x3e76697a86bc7b64, 0xf1055edd85dc6777, 0xa761ae9e75bd409a, 0x5e07e2b207281f9a, 0x6ae87c954b991698, 0x732c0bb37844499e, 0xbbfe537270f0aa39, 0x20092d64fecbca,
+0x6350a52f45697693, 0x20014d0aa89061a2, 0x5aaa48329a0c2923, 0xbfa5f332fb64b93a, 0x698f5842ca5cc1ed, 0x470007c98707f257, 0x4aecfeb5fd82414b, 0x1e35e25b0f6827,
+0x78818ef3b5a662d5, 0x8607d3caabeca52, 0xb32de3120a7fa42b, 0xa4a12c51856828f9, 0x9d4d17252a79949d, 0xee171714927163b, 0x5a4497f27f7f2add, 0x2c932a7fc9d267,
+0xacd31409981f6216, 0x8e9b5acee1980690, 0xf801ae6538b9ac60, 0x8bca411347d91835, 0x6fb451b7b62e5fd8, 0x31ea2c47e0408d5e, 0x1dbc5f8eddd13834, 0x11afe40f0fe2a,
+0xbaa809038b028f3c, 0x5c898f9cd1a0041e, 0xac94bf124ebfac69, 0x610373fc43d07fa8, 0xd0034351c9f3c539, 0xa879a2270775fb40, 0x694916e1ede8418a, 0x165804e7dbd161,
+0xc87360a01f870539, 0xb3a817c29bea64fc, 0x21c73c7b4a377c3d, 0x795f4ffaf3b9e5dd, 0xe55489403a0e0d2, 0x787e801f06735b0d, 0x1eddfb2aca2dd586, 0x3a77fef3013651,
+0xc3b70e75916cd485, 0xb4244fdc9d144263, 0xf8818241b455b45, 0x199f260652e28c1c, 0xc5d191221c0b28d3, 0x3b239146e1d76a25, 0xae896b683065ac37, 0x196cc7b85709f5,
+0x75ba0ef3d4c9fc27, 0xda57608c6bf75940, 0x555f62f9641dbfb, 0x8fee99af8175fd5f, 0xd387d4d76462c516, 0x2d16c11ed337c991, 0xcc4bb2fb3c90cdfb, 0x120297c7f87070,
+0xb5126ba2a3688b17, 0x9a4032190c931afb, 0x37d218d157c0bee7, 0x2a2c4c39d2cedcc4, 0x11787f2aadfe3fa3, 0xdbfd0a3635d631fe, 0x6e21725453169ef4, 0xa13c6ca05fad5,
+0x5cc1df9a79d94256, 0x65cd95e98ee9c15d, 0x61955938a2dfa13b, 0xe5f34e2f1f3610d6, 0x2caa554458eb8733, 0xfd51beb63c0754ae, 0xb2d87bec8241723a, 0x1fe524db6d188c,
+0xe1820189adfa4b63, 0x9c08c9503fddcd88, 0x720d318fe98f33b9, 0xca985688b0df2f6c, 0x54f01cc13fdd1eb4, 0x2660c541ec5612b8, 0x86cfb16df242fa59, 0x6773f559a355a,
+0x7e5f3e36de44ba29, 0xd1a90eaeb505012f, 0x7b426a4bd5168433, 0x9083a67b9edb6905, 0x1b96ad12fe16d65b, 0x6cf034622248792b, 0xd1608ec542839902, 0x28482e7daca989,
+0xef3dc2a8a8cc5a7, 0x7b72e8c492cd6586, 0x2f3d68fc9598724, 0xe4b92f4831e16c9d, 0xb657cf3b1982ad44, 0xef003b8c42a8e0cb, 0x321e5be811bdec0c, 0x36d90b31d2cb87,
+0x9ffd1888d000bdd4, 0x57c926c8ee3bebe3, 0xbb44fcbf3a5a3bd8, 0x893f8f9658fb3bee, 0x2403e8a9e65f4073, 0xd8d12af78f95f7d, 0x7be881b8f21e2530, 0x135823c8f99dba,
+0xea723afcbeea4926, 0xdf3b7fa5f91ba0d9, 0x64a816edeb1d6bdd, 0x99a629ff742d8d41, 0xbd75f162094e90a4, 0xd43a7e6754933cc9, 0x5566672c15f7160b, 0x2a9bb88caa0615,
+0x1c0b5b3d5b773870, 0x299c7ba5686d09b2, 0x5466d67a9ed6027d, 0x29459971e459a454, 0x34bb925d8c9d84f8, 0xecf6ca4f3b5a7ae7, 0xc3d0b35a701f23e2, 0x38c05ff1116a32,
+0x35543f24488ace90, 0x2ad183993ec7da2b, 0x93c8682739377089, 0xc70135152b0d412f, 0x58541e06a23e7c5c, 0x3bfe2a5431aa5dfc, 0xb70e933cd719118b, 0x24154fc4a4f709,
+0xf2c9f5dab2af936c, 0x15d5723d26863c0b, 0xaf0f02625f600985, 0x48a26e620bd7805, 0xb7eb240e4f7ba95b, 0x2ad19c7f4e22743f, 0x450d91985ae158b6, 0x35dec0178067fb,
+0xf6a035f8ec3e71d, 0xa59a0882950755cb, 0x94c719b130901a15, 0xa63dbcddae630428, 0x52a71075c8ec839c, 0xceb3ced6e218e49e, 0x9802db9fd7b17058, 0x347119a1dff718,
+0x61b9448bf34772b4, 0x8572d660f80b396d, 0xbea7e3b76379ccf7, 0xeb79aded44bad0c1, 0x61437872909515fe, 0x214733fd4a0cd487, 0xc470259dbf865843, 0x286446d734af34,
+0xc28df6e6d4c2a78e, 0xf7923cc03935b3c3, 0x3d97b92435d061f, 0x23bb7786c749e013, 0x3530fc27f75f0576, 0xa6bb97118380b0b3, 0x21214860b7a1c528, 0xf6f3f3baeab29,
+0xf8c5ce65ee942383, 0xaf8bc3b61ddd7654, 0xdca586f09abd91a9, 0x4f45e2c32a3c20b6, 0xcc491b3993185b71, 0x3752b87fb62f8e63, 0xea75d4dc345c1b52, 0x3b08fda1beee92,
+0x58521fd6280b7bd3, 0xc7ec58a7fef226b9, 0x4e2959b141170ceb, 0x2ffe3c8e5fdd71da, 0xa96817c25fa5b770, 0x82958b5e8b3bc6b7, 0x1f1456d4862b6b7e, 0x150190841afc32,
+0x8355c146630067d6, 0x2f79b802b92d57dd, 0x6a8458425c1036fc, 0x2c61d7ca4c36a75b, 0x8b9fe53042f4bead, 0x14b3ceb2e0433ffe, 0x9941c9232e0fd789, 0xcea0eb4e91d39,
+0x5aec7d8ae14aad89, 0x97b00d2f0a22ed3e, 0x581fbda6d1176f4d, 0xeb460a8bcfde14ac, 0x8ae5e74dfbad1920, 0x7b7c5b9a54088269, 0x8a1c526a464cdfe6, 0x887298b8c4925,
+0xd66fc8be3d933e, 0x139b5ad3d6cfbb33, 0xc74daedba3d71dd5, 0xdf8ce6c005950a47, 0x9ab7439dd287a956, 0xd920076992da5530, 0xa1cdf62d647ac31b, 0x11d1c777875bd9,
+0x4b54c063d2212db4, 0xe2dd6d287e97bdd2, 0xe8e1db67e7036270, 0xd92e4114688c17e9, 0x8fc54b34c4f5d567, 0xaba76cb700bddbcd, 0x3d6628ed0719ef45, 0x2c86379fd30e68,
+0xb77472f09fbc1806, 0xb4273fc9c54fa31c, 0x8dd662720f5416f9, 0x37c8b4ccbd47d339, 0xccb8ef792b5207f8, 0xc2a0c20e99f63cc2, 0x6915b6f8fbcbfcbe, 0xde79992a5a5c3,
+0x8c989c7c30b4c65f, 0xd591d239fe641d17, 0x51738f86f51dc2a8, 0x8f458ce0d170ef8a, 0x74fabe0ecc02c187, 0x3d313cb019daefac, 0x45c9aa5dad6786d8, 0x2648dfb9d02f0a,
+0xc726abd54561a925, 0x4c836873659cea29, 0xb13df08e27cfde55, 0x5600d65d14b37f1c, 0xfc9c51693f4d914a, 0xcd5f30117f2905fb, 0x8449606f96ce785, 0x34d4cfdaf70e5b,
+0x1163b7e639339787, 0x14108b95fa0253f7, 0x6b25358d65b9f78c, 0x66d20a93fcff5b63, 0xf2f1230d549819a7, 0xd8fe31e6c2bc4aa3, 0x12e5d136716378d3, 0x307b8f1ed9cee2,
+0x7cb01e0fc935211a, 0x4eefda31b229fe9a, 0xdc823deedb5b3211, 0x9db0dc179babf589, 0x84b2c4090998f5f1, 0xd70d1169455404da, 0x3be1e5d30e3660d3, 0x37b2e962577d9c,
+0xedcf1d05963a7403, 0xbb7aef50f44c03b7, 0x5530474b03718273, 0xb824d202cd0e971b, 0x9df14e1b1707ad2, 0x2119a330b3a65b89, 0xacff23773424e269, 0xd6ea19e41258e,
+0xc9a044305eb1e566, 0x9408cf816539d38, 0xf409885a448dd480, 0x849ff9171783ef3f, 0xa5eb9475e5796ff5, 0x79bf0c7026ed4bcd, 0x30857c7b5a646b56, 0x1d9c0822fb8665,
+0xa2a11a2e2069f10d, 0x3434139247b1fc92, 0x60d9e76b15816127, 0xd9d1179a15d3e8a4, 0xff1192e106b6fc13, 0x10feab1371525d39, 0xb1a26e7dab68313a, 0x2c6a5b29e9df78,
+0x720fac35cdec227d, 0x8c291fa4f12b45a5, 0xa76c9ef24936eb30, 0x9bdc348304906a35, 0x9848fc8febf30fd9, 0x522a95260f4375ec, 0x3de5a29508ee2b35, 0x131308db2cbfcc,
+0xb003a9e73014e177, 0xb716b223637f70c9, 0xdad72261cf20dba8, 0xe46e541d9d9eb42d, 0xa29ea598a16d77bb, 0xa3eb5dcfdcfb67c7, 0x8360dae9a530f40c, 0x34793fb3d8ca40,
+0x7bc2232727891d35, 0xe95d707bd1822333, 0x5ee23fc662fadabc, 0x803a2c669fa7d571, 0x9b5f10c85adc26aa, 0xfd9e6cf88d021ce2, 0x35979a2f66caac88, 0x2a368d6c31a17,
+0xca5cceec8df5a192, 0x8a94554405190b15, 0x1a42fb8b6e138faf, 0x66b0a4635a8ec88c, 0x5ab1860916cdfb50, 0xbc512e716f5a5acd, 0x2f350255bd212238, 0x29be15ba1d74df,
+0xcb2e98a9e4678052, 0xfe7ee63772a8f5ca, 0x91ba4258aad288f4, 0x916d6ef0c2a7e644, 0xd67166f077db3cde, 0x26960f576e5abd8b, 0x71ed036af2ea8c3d, 0x3e95b18a12b861,
+0xfc5737fde0d30ddb, 0x1b0679715a9e20b6, 0xdcd84012dc163591, 0x45c8835f51be6d15, 0x7e48346dd0d51dc0, 0x804f5855ed6a9a6e, 0x3ba8a02949b57131, 0x33b8f38a09124e,
+0xd6544de99f6a4134, 0x20cc03db805d5e61, 0xa34892f34d1248f0, 0xd89cd23ce77bd207, 0x3ecf68b434abfc7c, 0x7b2f8cc5dc422367, 0xabcae470dd4aafbf, 0x959c52cb39ace,
+0xfa4ea978b5b8bc41, 0x67b778e390a0c216, 0x5633b4fcfa43d01f, 0xe0ae369cd33bef98, 0xe3d3d52986fad54e, 0x118558926c979796, 0xe7ea7e8defad69cc, 0x3e09af2e88cd83,
+0xa417cf5ea80f8837, 0x51224918be9f5895, 0xf1046c0e90dc1c62, 0x818889a3f8ef2a3, 0x7d096168ce79f3a4, 0xb9220c9a39b5aaa3, 0x721b2c59229a569f, 0x25af1f5755ddcf,
+0x9e31501829645759, 0xbb38b1114b060651, 0xdbfc8d152a3d11b4, 0xe5179c7fc6b50fb9, 0x9ded0d06e269538e, 0x1bad4e0e8dbb525d, 0xf97760368f3cdce7, 0x405a98cfd76dfb,
+0xc109a1e048fd09d, 0xa4589f14bf7c86a9, 0xe1c6f42d35014f, 0x82d16b8ae1cfa1fd, 0x8b2c683b9881633e, 0xe30b6a390dd39636, 0x9b49d13190b46a18, 0x240c1c051126cc,
+0x5ce69d1efd95018c, 0xabbf697c27505b8f, 0x6846c2723aa16548, 0xf4941a2492e6ca6a, 0x935c31e37b1292fe, 0x8c07f173a063fdbe, 0x12abddf3fd22a4a6, 0x3c8e960697cf0f,
+0x5e60fc16be44b4e0, 0x473ce7eb93552af6, 0x8e49ae98aa6bc679, 0xe7c004bf406d8f9c, 0xf05f86ca8db43c4, 0x6a454ec91856c0f0, 0xe0affcf261f57b6d, 0x3c45d5e883673d,
+0x13feaf3d123d53f9, 0x606e25f6f51bdf1e, 0x9245546b13f25f4, 0x10c969ec9466ac16, 0xe10cddea66620580, 0xfa796ed40103ecee, 0xa0fc3767a9657bbe, 0x1d3f4a166a1aaa,
+0x5958180cd0430cdb, 0xbf5053a4bcf49591, 0xfef23b62562b0403, 0xb1fd7bdfa8a06282, 0x7498daac2058c6e7, 0x3b9f9a027e3fd2bc, 0xc23e89a078921e2c, 0x3ebed95ab8835c,
+0x29252e689b43d0a7, 0xe38ac987eeef2048, 0x2a7e8d5576e9515d, 0x47cd09cd1cb97cf4, 0x1a04d031c3b0dffd, 0x373f21f27e2b3e1, 0xab67b16051624dcd, 0x27e4443fdec025,
+0xdde4f20e763843f, 0x62c5a8beb19c4b1b, 0x32c6ab0ae5410e84, 0x752767a9f0fe73e5, 0x248f1ac8d3cb8a2b, 0xb520e8eadb9e2b5b, 0xfe9212f1992f6267, 0x9fac97b1fb99a,
+0x258f4397b800077, 0x2a1c921f2a6224a2, 0x6842a5d6b7347899, 0xb285dc7c5a1c09d9, 0x4ea8fbdd4886e5d7, 0x27c4dafab70db9fb, 0xfde390744e5b8388, 0x5a4e3c0583ff5,
+0x12a27f877aa85182, 0x73ff1f6818c91673, 0x53952c725fce3f62, 0xd6e1439a3bb3be66, 0xee4133ce10fffeeb, 0x6c10017b7d813055, 0x7958e2a0f130373e, 0x1c4777424e40fc,
+0xccf80cbab431b0a3, 0x36669a8631ef43c1, 0xad338cd15318cba1, 0xaa2210001a41261b, 0x33587f32ef19caf0, 0xeb48dc63c0f2147b, 0xa22168f9f4f4f1b4, 0x1fc90971d6936d,
+0x6378e1bee11679c0, 0x660b548fdccf287a, 0x35f3d36159288066, 0xca828055bead24b3, 0xb638739951296a5d, 0xc0df49b88e59f99, 0x44ea875efb1c92ce, 0x18986e3143aed2,
+0x67ab8aab1c8c983a, 0xa3d1eb60ae94b5d6, 0x96d028508d839091, 0x94cfebd3a1f8c784, 0xca0318cc396072be, 0x4b7985fcd232af1b, 0xe5b0fd65720a9abf, 0x3f22bddea5c54e,
+0x8f1e0491762a60a7, 0x8df5af69e788522b, 0x8f17cedeb22af76b, 0x81fab31b798c60aa, 0xa1506b22cf031c03, 0x2bd4db4d76f49db3, 0xad451fbd154e0b82, 0x4ab7766f3db41,
+0xde228f2492420b04, 0xc408a4386c5d0f0b, 0xcd54ef646b9e3d08, 0x63940173a5e53745, 0xfa6d871621c2871, 0x2d5367bd43f9cc8, 0xa56d91b722d9bbf5, 0x2f9cf74d45b47d,
+0x70329744f9bfd95b, 0x11179dcaa395b702, 0xc7bbd22d07c04cc, 0xd7b362ce39513488, 0x627beff11c34be59, 0x8380528e44f2bb5b, 0x1d7e26a53fc1848c, 0x301a3f888af82e,
+0x29a1e1dc7ef66b09, 0xa3b5c5af259e70f7, 0xefe353fe5455966f, 0x7f19891a64e722cb, 0x2d755ae3eeb824e8, 0xe040fd4e3788993f, 0x889ff75c8a2692b8, 0x201272a0f22a30,
+0x644a1a545939efbb, 0xc19f1bee666a9636, 0xe8bf6d51be78cadf, 0x974b2bf209d7eb27, 0x4288680868ff85f0, 0xebf499d64507dfc6, 0x4c3ca700cd48b98e, 0x24bcbe906439d4,
+0x1c09e8e5e8b35aef, 0x11d3483cfd71b921, 0x59000fb37b2c13d9, 0xf5b233b5eafbee4d, 0x221e198b187a1486, 0x8e0659c1c54ceedb, 0x7e732bc6978479dc, 0x1a1684593da8d3,
+0x6902479eb4c69a4c, 0x6092875209fea12b, 0xb5c055e17ca07aef, 0x7584130702b8e9f0, 0xd00e671305fdcce9, 0xda2a88a38695fcd7, 0xa0d85e8e8ccd45d4, 0xfd9a00992f254,
+0xdd4e3415443564e5, 0xf3afc0687f1e65ed, 0x87a61494ba7ad4f0, 0xec98a977afe461ab, 0x3997a79b9fc69419, 0xbe882c5b0213bded, 0x3f50d9b4bf740ba5, 0x24832ba9aefa11,
+0x196cbff4f988c05, 0x1f25d8027f957d2f, 0x2958fe03f32e4d2b, 0xd954ebc32ae1842e, 0x9f3a81741902f480, 0xf857f11a35896187, 0x493faab98b6d8ec4, 0x121d747005c918,
+0xebbc3e1c0752c60a, 0x933177199410ed28, 0x48c2f0d720a3ef17, 0xab48b066ce93d56e, 0xe4afeb3e9a372d7c, 0xfc551f9b052a80a8, 0xc209725af2350653, 0x288544639bf1a0,
+0x182733caf307e64a, 0x55ac9a05158938d, 0xfc2abba58fa5f216, 0x395a6d6645076cda, 0xbb97786e5ded45a7, 0x5465767c386a0072, 0xc6e902cf778ca834, 0x2a63faf4f649f2,
+0xda91b5c20106f565, 0x1a1b7335138a3d3f, 0x1a16bf8fe43d0296, 0x3d8274b75fe40b6a, 0x1ea37db6bc261105, 0x42101a04ecf6bf22, 0x6cef8e69e28fd975, 0x8845600b5c323,
+0x8b953526575e10f4, 0x221c2b99cbf16c0c, 0xc57f5f6c5699f6c1, 0x74b1dc49c17ef8b8, 0xb6ef07b92ea3daf, 0x1e6eb54ad3fbd355, 0xa102880ba9aeecc4, 0x14ac8aa69cd3bb,
+0x14360f7557d5217d, 0x1b900ca407732991, 0x1cc7bae87802ad5c, 0x5aa128162f7afbe0, 0x828636d447e5a31c, 0xb70cd687d88e8042, 0xd845ad55d0020550, 0x2f8800cd3c8640,
+0x2459c78a2cfa7a4e, 0x37125e2d369c23d7, 0x2c9c34b788c3ee78, 0x28733b04a4dc37e0, 0x5e6187b0d42afed7, 0x21b61b9419921144, 0xfc41b4280296d7ac, 0x10f1976901ec2b,
+0x2c951d3cd3247dd6, 0xac9b41ee998a7f64, 0xd3362c211547111d, 0xfd2a2799fbba302f, 0xc27960f0f507aff2, 0xf2c03851a318dbb0, 0xa4c9d943b6131e27, 0x18909dd943e8f4,
+0x641f59a51b82599f, 0x474f5a47b9962e3e, 0x6f5513d6b67c5041, 0x1980444db290d590, 0xb3e6125397549a3f, 0x4769fff66b2f5fc0, 0x1eb508ae8ee41c65, 0x1303bee8bbb3cc,
+0xb0842a6824c5c25e, 0xd859293834294c05, 0x24ab5bbb7505612c, 0xba642af09ad09436, 0x4bff1756d0f39d73, 0xac42099ccfa45832, 0x183f2647ab3fe06f, 0x3a5e8405cb4b87,
+0x2dcfd6d4445085ac, 0x81f3da9c9bd7b5c3, 0xd04cc4c51ef9f9a5, 0x6a74ba60ef005a6, 0xd593bb5339e8c7ee, 0x53b3fa48cb120d5d, 0xf09e2f1ee41f01f3, 0x13bbaf410a261,
+0xf616e11114cf07cb, 0x85d2185d935d54c, 0xbd9f822818b78074, 0xd845b7ab1c4de4d2, 0x4487f82536b23992, 0x566b598494dec9, 0x2872fcd6eb909f19, 0x3e677abb6a8558,
+0x8875b6260b54279b, 0xff376d3baa52d16a, 0xe267ef28dfff5b2f, 0x8a94ab136416ee7c, 0x80d24ae1f91198eb, 0x4fdf6a3aa0b00916, 0xdc60f20f43e6fc56, 0x13ed162378462,
+0x4f69ae014f47f7b7, 0x875cdebf48e96229, 0x89045c999288958e, 0x48072b58eeae2dd6, 0xfe7d129ad0653894, 0x80fa2e67fde27af5, 0x85b0f9999f7a4404, 0x138b2357397702,
+0xb0dfee399b3b6282, 0xaaee000823d2ab99, 0x2a06cb642eeecbbc, 0x53079315c4512ec0, 0xd95e95dfa1df6bd2, 0x7ea0f0056f274b12, 0xa80401ba47fcb6a2, 0xeecc16b89540b,
+0x6cf2e2ce87c802ea, 0xa36533de80cb697e, 0x519f8a707f6146c, 0xe1fbd6f4e0912029, 0x13d2f18ce9f009ce, 0x1fd060cd7276f80e, 0xfa9c0ca85a6eab7c, 0xc18aa6e89a3ac,
+0x25cea8924181e92e, 0xad75e87ee710e049, 0x9a505a3890133a55, 0x5724291566d8ac92, 0x3b7fb650c6f04f26, 0x1d9cbc6346269e0, 0xb8ab99796e6a6aed, 0x1c75ce64e92747,
+0x21492b66073c2505, 0xa0a9a0dd70988019, 0xc246582138307ea1, 0xc1b1fbaf41dcdbee, 0xb0d3acb4b60c7ac5, 0x1c7cd45d86d23927, 0x7c78b8154129edf5, 0x24560a43e68b95,
+0x4b20cdd371e0d0c, 0xb5bc304cc56f8f9a, 0x6e06db965a719e70, 0x1865d6e33ba9931d, 0x63b50654139381b5, 0x9c204906e52059d4, 0xb9c49d67f4063675, 0x35bea46b258682,
+0x8b39988fd49210e1, 0x7903303ab553269b, 0xee6c7c772c9324d7, 0xe2c01adf9fb419f7, 0x656818368ff90a77, 0x79a43c9e70756b62, 0xa44f14a1148a521e, 0x804aba19872ec,
+0xded180bfc947ad28, 0xc6ec02645187ff, 0x6385947e796adfa8, 0x250efb8f1d07049c, 0x443651f5d044d4d5, 0xe2a0f061f19ce165, 0x2783baacb7cf15cc, 0xec54d5582327f,
+0x228f203f62c5e8db, 0x5b95a926c9f8462d, 0x442ed8863eca32b3, 0xd9a0ed72788c64d9, 0xb552ac456d38d7ef, 0x3b705f42e049b7bc, 0x377b7bf0418fb202, 0x223a1dfb581bf7,
+0x551a29a4c1058a80, 0xb5926a644ed1c65c, 0x5b25233cb63cbb80, 0x42d2a858106c42fa, 0x6fba7f6d5509063a, 0xc1fe0cdbb6cf08ab, 0x4d0e2e3de70667ff, 0x2859f036363f3b,
+0xc527fc91af297818, 0xff219771ad7f7615, 0xe77bcfc5a06a98fb, 0xac7f927c12ecc46b, 0x93338e302f2f9a65, 0xa893999995e0d4ad, 0x4e8a2762ce6feb0b, 0x2cc5e0fdf96b85,
+0x3c7941a3e54668cf, 0x9cd36a59d6d71a21, 0x900cdbe53ed1c70b, 0xb0a0a90cffab5ccd, 0xf5a09d82b936be4f, 0xed70c28b019c5524, 0x694400e746cd6768, 0x2b490c0ea0c1de,
+0x7ae163a5645736b4, 0x485599e3e13fc83, 0x3556f0731cf950a6, 0x25ad90aa742056be, 0xa361049ca8c578f8, 0x8a004375373d7cc, 0x72df405a60411f1e, 0x229c24c60cac47,
+0xd9e5d2b835077956, 0x121cc2dbfe79915, 0x578046d33309e0c0, 0x58c379c9de85334e, 0x32fc08b6e30b59e1, 0xc31dfa080ef369ff, 0xda89729d59d016d2, 0x1e3845ba78ca1f,
+0xd2c36741c7224e73, 0x9ab5abd75e1e99c9, 0x81c58308f40db1ea, 0xfd624a8cd48cf851, 0x333c27b44c234d57, 0xd9487251a105aab1, 0x3a9c9d776c4f318c, 0x2524a3c211f209,
+0x44cc0cdabdb47fe3, 0xe5c05ac319b8424e, 0x26601754452381ca, 0x5c31514ea82abae2, 0x82369d104d4754b6, 0x8045c91280cd8777, 0xcdd516a1e3497e34, 0x1b5e1d79579ba8,
+0x96e909bfc1d021a6, 0x1c51501119e82116, 0x6c232a9452d9b507, 0xe510c6c90fc2f7f5, 0x1109467e41bd26bd, 0xf1468594d427b3a4, 0xe3c4f912c08c01f7, 0x72ccf27620585,
+0x4ed090e9b35b8e89, 0x1662bd194e6777af, 0xdb043d6820893e60, 0xe21c74850b25866b, 0xaa7c42eb8e017a47, 0x2975edebc8242b66, 0x5dd32b8594084465, 0x3aabe09233193d,
+0xa08de77b0e59ef79, 0x3c2c1c489257db29, 0x372f0cc8497fb263, 0xd2ed1397a7b85cee, 0x2065a9f67e5a7a26, 0xc9458f97bbe46dc8, 0x2b22c7d550f2ff36, 0x2adaa016037b16,
+0xcd5485e75bc7cf9a, 0x4fb86b956050ee95, 0xe8f4e3304c5b68cd, 0xbad13a0a63151075, 0xae4952017118b49a, 0x51f434c34b20df4c, 0xfa0bb317c21fccb6, 0x2de603dfce7e9,
+0x36bbf4468545c4de, 0x2fefea5b748c0137, 0xb93df49bea653bcc, 0x46fa3fbaa5792425, 0x15f17880b200a6b7, 0xde8751ceff9c86f7, 0x503da8396060a34b, 0x77d27c06902cb,
+0x98ed4530dfb73392, 0x76200596635023fb, 0xa165ec1d6d6dc692, 0x892a93fc914e8f4b, 0x263656a62177dc5c, 0x1dbef38a816a0fe4, 0xb7853810c874052e, 0x3e0e49c1d550b1,
+0x1fd0b299c0948b54, 0x23ec22b6f32eef76, 0x2d79b8c783fdbbc3, 0xd49f753edb17080e, 0xd7070afeddeed85, 0x6cf46c9a0f33cf8a, 0x234bfa4aafabba3, 0x18a8f5a00bb80,
+0xd23eaff5fb610ddc, 0xfa95fca44f2c5726, 0x6eb5a9cd2b71af3a, 0x44ab7ce9dc6863d7, 0x815eeae9483049c6, 0x68bc425c00265204, 0xc618ae23dba60a56, 0x1cb97522ab0e34,
+0x8681d6009f306469, 0x774b3ee918b2a30f, 0x310ad13a7a35d91a, 0xd2738ac14b501a7, 0x76ad612e3984c1ef, 0x47886f22208b19ca, 0x51d88560c404f4e1, 0x3dcbda23659c45,
+0xef74ea765f83787d, 0xdefac2b1268fe4ea, 0x3f01e24db06078d6, 0x2bbaab270f3a5fbb, 0xe693094a282ee695, 0x5b60e70b5af5d024, 0xaff89752bdde77e8, 0x35960e599f524,
+0x2e4dabd32c467f5c, 0xaae4cf3162790582, 0xe158f53e6d100e5, 0xdca32dbe3fed7bf9, 0x976f3834f36b62a1, 0x3120fdae06626ead, 0x3f5629bfe7fecf6e, 0x3ebe4b3f6587b7,
+0xba9d38357e1da079, 0x273f8befe081200c, 0x256d7c56ae35ad21, 0x353924755d78f196, 0xe0f31d5516ce7cea, 0x47225b599064eb39, 0x40bf9656f1bebb78, 0x10cfd1d2d80083,
+0x1f164b836a277b5d, 0x385483469fe09314, 0x55e1cb2d00c189e3, 0x4a30eadf8488c856, 0x4a479da9e696e535, 0x7b1b5304ddcb522c, 0xb7508da2eb8df2ee, 0x1a845e4abc9614,
+0xa0103a24ef762561, 0xc036f9322a653886, 0x6a690bb839c1fe6a, 0xe7a61da42268dc04, 0x41f1a5d67706e02c, 0x8b0ebf2cc160d130, 0xba2b4624555a0c41, 0x3f8eaf0d4b38bd,
+0x4f9a2fb8f1dbe5c1, 0x4bd44d831c69f8ef, 0x56e8fefcafb30ed1, 0xc8a0e809afa445bd, 0x14951169a23805d9, 0xf4964dbd70dd951e, 0xbee1b0b125f94d47, 0x7f21454106ee7,
+0xeedf770081bc99b2, 0x21f4a2e57aa344eb, 0x22d2a3f6c4629c93, 0x46e0c8d3e44bb1d7, 0xcb8330418fa57cb6, 0x33383dce9e0ce43d, 0x996ad74cae156a03, 0x2e74f52f33c4c7,
+0xa03d2928ac8189d8, 0xf6d81e48f3d0231c, 0x82bfbfef92f7c4df, 0x7c5b98e6ecbfed2d, 0x8579802bb06e97b4, 0x109af14c3e0338b7, 0x80cfe8f743f797b8, 0xe949d1fd9c738,
+0x593750c0118dd9, 0x67670a4bde7a440c, 0xc2ae39844f144d16, 0x2592e6872765e147, 0xd610bd7e11739732, 0x3e6e8a6e5e2c7947, 0xd0721ed50b540f4e, 0x2a8db6d986bdb1,
+0xb26848258a6c9c5f, 0xa9303259cac3f708, 0xe24fcfdf9d3cc4bf, 0x66ddb2d65db15659, 0x6688b646923238fc, 0x2ba49ead7aba5bb4, 0x3f8b1cfd1426bc81, 0x28ddfcfae6ed3b,
+0x7f8464ae00aa1a4a, 0xf4afd706e39dfc2d, 0xe51953730f8d0f3a, 0xf14aa56ab2b7e522, 0x311fa3a763f093bf, 0x5bedd8cf80e8c6fe, 0x380db35028d642cb, 0x1c27cd21773efc,
+0x96616c16b6e2e8b5, 0x5c2e2b899d977e9, 0x40da64015359990, 0x5f66c36acc3a3390, 0xdc3d7eecf5af1cd7, 0x2540f4948823af89, 0x6fce1721d05f1418, 0x1d4b45d9726d1e,
+0x720eed7bd205d558, 0x2828116913f0d97f, 0xaa3a6254305a7534, 0xc7f0ff74959cba3f, 0xd9e53a27052baa75, 0x83ceacd1725404a9, 0x13218c144fce3a13, 0xfb96082345be4,
+0x6e28777ef4229818, 0xcce5a4fdff42e1af, 0xad22638a14481b20, 0xd8a457aa3116c16e, 0x9ca64924eec71fc6, 0xc73fe22dcf066978, 0x4a8e809eabd15302, 0x2f9a478ec9a457,
+0xa8947b7cb7cff3c3, 0x4c43d9cc0cf3746d, 0xf5dc782592b2c56d, 0xf499a604699d45e5, 0xadfa0071f1960a5b, 0x72fea39e0e2b7ad3, 0x37d92a169d8a2a24, 0x1df304cbfe619b,
+0x9df68ba2385661a3, 0x5cc308114b964f04, 0xfcad4410af86e452, 0xfc5318096438291, 0xffe9990b0e26eb8f, 0xdccab85d9e2c8b9f, 0xbef7b24b2c73703b, 0x27be318471ab20,
+0xc9bab942f108c558, 0xd6a0314a5b1ddf62, 0xaff8bd73b6e1de1b, 0xe3b3a8316ffcc889, 0x65a97fbe72222b17, 0x60f6bbf308b5a2f3, 0x4b8b4fb6fe1650bc, 0x37bb74f4a21486,
+0xcc3e158947f6dd6f, 0x6787293312d25ba1, 0xdd096f26376fef1, 0xd1367874db636257, 0xc1539c2113505144, 0xa84d448bbe9fa0d2, 0xb3658c2217bca2e7, 0x18682bc8ca8043,
+0x945c3a1ff28d9efb, 0x2eaf09668e93fb67, 0x29201cd9645c1d3d, 0x6b3ee33007b5776f, 0xb96f82a67cc36df7, 0x904a81da3a3e6325, 0xdc764a8bd21d4c6a, 0x1446d2d9bf3068,
+0x3e1f049ec071314d, 0xaa51755ba07b2e32, 0xac36a2350420b214, 0xb5206f63aa2fe3fe, 0x218031c6182a9ac5, 0xf51c747c8e0fffc, 0xa2632d53f1c1006e, 0x257208205343ec,
+0x29808f5cdcc6a57f, 0xadb640646a4c4e5a, 0xfd39ca4dd639495e, 0x83b9168773958ece, 0x8007f75bb29b20f8, 0x8e7eedffb781f13d, 0x778f0c6093e4b068, 0x1b42f230c1000,
+0xf099e191edefd370, 0x4020a325211fe162, 0x2fb139a4972cf58, 0xbf9e5de348f97aac, 0x5a331428c4901868, 0x44eb6e9ccad824d8, 0x469c52dfd8a71cb2, 0x1bf697d77a411d,
+0x931a2ab4f8e64af2, 0x1ee21f1c374fdf6d, 0xa25bc308b5dbc7e5, 0x8f46079cf22a2374, 0x6f029d8353be5c0d, 0xffa63baa521b0ea2, 0xcf05a9fc7c25564a, 0x32a3885eeacf7c,
+0x2ec69281119d212e, 0x552efabda9400183, 0xc6c32c8e090147b6, 0x5cb2be4cf44d0b88, 0x53e6ac438ac2d665, 0xeba9785fd25fcb31, 0xbc23f33725cf20a0, 0x3942abb59878da,
+0xe3dc14d40e66bc0b, 0x9691c1d4d73d466d, 0x76874d9ba015688a, 0xeaa66205b8e430cf, 0xb123f5ca792d82e4, 0xa3be01f0d96134b4, 0x731f81a0a686b654, 0x30bef57a8d1963,
+0xbaff957ce55edb2d, 0xa4031d80bba878ad, 0xe88511d2fd2025c7, 0x4227abd7c92ece2f, 0x2677d01f396c31de, 0xf15b88f8a90a3428, 0xcb91d8fc0fb4f67f, 0x28dbea9ffacb9,
+0x946dcc321871947d, 0xda2acfa953234e63, 0x227a1b329da957b3, 0x56799686a4611585, 0x2ee88f7a28deb91, 0xa9a347e7e959412d, 0xe2c9d9b49a3129a3, 0x257d8c1e5bffa6,
+0x527f1f3128e8584d, 0xad26b6d01a5743ba, 0x647b05b21379db4, 0xef67cca6975e2199, 0x5513752d383750d9, 0x419ce23734aff752, 0x8a615bce91658b73, 0x286ff94cdf0391,
+0xcf64f6a2ef6a5511, 0x13dc3ea1639e4e98, 0x552d7690c332d8e0, 0x978f740c1d4b5337, 0x25b4761448e68faf, 0x1997dda6a9e5862d, 0xf474c7b335e73d5, 0xb6f21a153284c,
+0x675ba00fe5f8b46, 0x644b044335532fb1, 0xc230f069e0b2beec, 0xc7eacbce18b7afd1, 0xeee8a5781fd4a850, 0xe087b9972b3d143a, 0x63f680b90a9ddb8, 0x2951a7db655aaa,
+0xe9d0455f6a34c51e, 0x6ecd910854ddc1d7, 0xcf9deb92b4c39444, 0x7ce45ab33a9cb185, 0x49a65fc46ff43eca, 0x219b8f1f30e62e8, 0x6bcebd257660e2f8, 0x3cc255f7fac04e,
+0xd70adc8be6758480, 0xbd4f50c64f6b89ba, 0x3f928298625556e0, 0xf7f0dd778dac128f, 0x7ddc3119bcfafaa2, 0x5dd750c32d5e47ee, 0x47f39291e03c4b4c, 0x3070bb48a7b52b,
+0x764090cccbe76bdc, 0x6badd529eea2d564, 0xd5e07fc450032da9, 0xd741a2a12c2e3c, 0x6288053a63ff26fc, 0x54798763f3aafc0e, 0x6b746583de5cd4ea, 0x177f7ad372fa26,
+0x946f5c376916881a, 0xe2ade6a2d8622e88, 0x6384763723f24d6b, 0x60d43bd880bb3f98, 0x3f214312ef573279, 0x2a8d6fd979097d5c, 0xd03156f247ec78c0, 0x332cd016b8c95e,
+0x6192843abfac1e9e, 0xc1e7755532d891aa, 0x20dc602c185e63a1, 0x357f62d97c57996c, 0xff9585a4b80fc620, 0x9dabbbe7685ca176, 0x2690d2a21998195f, 0x3f293159e0ab40,
+0xb2aaee40fb34b8de, 0x69548c76d0c7e2e7, 0xec7dec94ec49e7f7, 0x916fc592ad5f525f, 0x7a7a5e5a8df7e4ac, 0xf4675facb30761a0, 0xe69398173ec4d243, 0x469d03ab518b9,
+0xd50fefb5964d5d6e, 0x5cde46c4bcebe2f, 0xdded30ba8a721d0c, 0x9f0cef84aee9640e, 0xc791c19d0ae9955d, 0x62d8b3db0ad5c952, 0xb720da71ac29ca38, 0x2ddcc064852428,
+0x87001df760c080cf, 0xbdd098bac907f904, 0x6bab6cd3d7b7544b, 0x94c11f5774c39ab9, 0x25866cd136c1af22, 0x3d762fa618b5313c, 0x4cc0b19fe9a4c562, 0x1879a8693e25a2,
+0xd96868c73c9fcaff, 0x44218fd4775c55d0, 0xd6ac6b2bd78ecd72, 0x8adc5c85dc51cc5e, 0xad9545788cbdc19d, 0x86a2af0af774f55d, 0x1c04de2a1acc177, 0x2b93088eb1b2b3,
+0x7c0e152f8ead69a7, 0xaafc33099c5c200d, 0xb44e60424a255e18, 0x29fe0e366677aace, 0xedeeaec80ae81cbd, 0x7efd3f4989a5de7e, 0x3a4b4f0d4390cc1a, 0x37438fabc18c1c,
+0x3101e473c75c903a, 0xcd2390297c11a9de, 0x85e73930ebdd1eec, 0xdc25ffdcbd680bb3, 0x5cbec28f104a562e, 0x3e8af7cc75588674, 0xd77c888491ebf4f, 0x4454c493c181,
+0x9d05b1db2eed95e7, 0x391b496d78197c79, 0x7bbae9e1b242417d, 0xdb32909d863bdd0c, 0x3c976c8c65b739e4, 0x24dd847e4e311d83, 0xb1af0e3256523b0f, 0x3f37917e7ecf25,
+0x994b0d4f91569807, 0x81775d57d4956cce, 0x49f455aa3cbc7b2e, 0x28f3fbf322e32d9a, 0xff0f492a53111e53, 0xc30ba29162a29a04, 0x13fab91f2708b900, 0x15f62abf365cf0,
+0xee32e836e8c83725, 0xe71b6fc961f5d2cd, 0xfc965e8b7124a2, 0xc9716e0fd11af78a, 0x2bc567bbd90f3293, 0xf67052a5cc67cf16, 0x24b6399253161c9, 0xa6c35d179b6a6,
+0x5d0ee363cde59be8, 0x10ec9102ccba6096, 0xf3c01fe95ef2f5ba, 0x93401c281669ac7f, 0x466d708b4297fc92, 0x87107f979d4ee3bc, 0x121e22be83ac7ca1, 0x39fb6dd1c44e0c,
+0xfbe8d576044b8855, 0x51c18826f3e175c, 0x873be6eb9ab12dea, 0x21d1666cc01288ce, 0x54d59013f2ea2412, 0xb50af0bc1ca2e557, 0x809a1d8eef0e6373, 0x46148c92d45ee,
+0x3236f20f1cbde4d8, 0xb5d10f658f93bc4c, 0x7663f1af5b55b3be, 0x5d4dee659e9ffc25, 0xfdd64847ef6e1798, 0x3ff431dca480637e, 0xb71ee6573e92290a, 0x266f3231cce491,
+0x2719e9d623832e9c, 0x43058faf1545fc39, 0xefee3656b6f9fa49, 0x8c3e6343d06dc09c, 0xcccb8db139723207, 0x5ef2f341d693361d, 0x43cc0f389e81cc4, 0x30b866dde43e72,
+0x4617d19e4abd9510, 0x64faf1833c07fc9a, 0xd89b59dd841244bd, 0x95956886bdad7b85, 0xd9bbe5ddc0dd35d5, 0xd8693e7a4b1fa73a, 0x2d7d3da70457eae5, 0x3c54d1db8f1383,
+0x8bf17df9ea969420, 0x9e9bcb9ba8e49c99, 0x22861843ea14214a, 0x23a9d5172544279f, 0xab7abc2cd9d0b0f, 0x661ffe3d7107b69f, 0x2ba83d990c5e0cc0, 0x3ac3b09f57f04b,
+0x63cc711c74600258, 0xd9487dc8ee5e43f0, 0xbc33dd30bc56386b, 0xadd1d851c2c312fe, 0xe4af4e75bbe72134, 0x3dae0cba391b3653, 0x25952419a3107711, 0x2ff85488cca078,
+0x366429896ef43794, 0x5d37c78ca4cf3155, 0x3d43e74bd1dfd9b2, 0x295e45d06df08293, 0x5e58e78369e883c9, 0x300972634597cf02, 0x5697366e797d0277, 0x21b36b466b70f3,
+0xbecd3f64eeb0d6f5, 0x3ecce6c46bdba95a, 0x7e2903fce1573bee, 0x35c266fe5c19c664, 0x95bd53daec75055e, 0xb95a08e6ea1e46b0, 0xa96ed56966e6f1e2, 0x2a1de44faf0982,
+0x7fdad36144c9e163, 0x8d84fd82e2fdbd7, 0x3111d99948de5798, 0xd55a6b50a7550ce2, 0x3f3dab14a386bed7, 0x3ae2fef70a8b0c3c, 0xfb39bfb1a1087ded, 0x2767e9a08098d6,
+0xbb4b930f5e085f73, 0xb71eb6ad173f50fb, 0x946ab8ecafe7c920, 0x6674bf2e143e5cbf, 0xa8b67d2f718ca3bc, 0x1ee13de2066ba476, 0x38bcb6feb28f146a, 0x584e878152a20,
+0x6ecd9c8c7ae69a25, 0x41ec91271ff693c2, 0xe10639231e521c0c, 0x75014b4fc31f40b8, 0x9fe19d91e4c18403, 0x39f598df3da6270f, 0x40c2de84774e1a9d, 0x2d1dffd01ceff1,
+0x6011491b054924aa, 0xd45381f705f6669b, 0xfd636fff4727198a, 0xd409482ed010a30a, 0xe28a63d64cda3b4f, 0x438061e46f987ead, 0xa079ad472f3df7a8, 0x3bb9ca5eb4ca2b,
+0x352248de6b5a7256, 0xa109df717b6dc159, 0x6d4dad8d3129ce61, 0xa49a2ba34920ecf2, 0x1e2e21b22f6ba40, 0x13f31c977fe4df8e, 0x2b3eed5a2c4fe8ee, 0xd3323f3f988ef,
+0x19276b3d28edff9f, 0xf6e433b018eeb1f6, 0xc7a78904b55e18ac, 0x9e718f4cd39b697b, 0xe3bd49563f89c9e5, 0x8e98d4094e7c5b0f, 0x83e5c325b354d5c9, 0x184611c16d31ad,
+0xe9788c22b11726c, 0x8b930c5d57edf1c5, 0xeda1e23213adcafb, 0xfe23a6f5fab8a07f, 0xb0ef7aeb56d18ca8, 0x5c3357b34070eb21, 0xe497531938729613, 0x2d7a2ca1a46343,
+0xa6fce868e9b43715, 0xf9a5b311eba4efd7, 0xbf34c214d8edf093, 0x293facfb352f21bf, 0xe93663d74fc9686a, 0x5c6a850585dcd8a3, 0xc588a397eb6cd3cd, 0x10e8f557590334,
+0xc4b62a467fbb743f, 0x24d7821804ef2212, 0x3c447b38ec3c433a, 0x24100406a8bc8bc, 0x611f8a323666360b, 0xccdcf6fea59488ba, 0x2d110a17aba556c9, 0x2b123eb3b1b43a,
+0xc7c2d2bc0ad797a0, 0xcc1241c2a840f39, 0x8f65e5363ef6f6a8, 0xf112dfd0ed8ae701, 0x84d91e63f23eeacb, 0xceb0ea455d275484, 0x301d7845407760b3, 0x3127cbfc5055d0,
+0x49098bdbf43cedfb, 0xc51cda10fd517ca4, 0x64dd1cf803d4c3d, 0xeef333d92a7666e8, 0x9707d00f52ab0c3b, 0x1abd4aac55084750, 0xfec7da0a6e422544, 0x13ad6cdfa41206,
+0x9fac83d62c784b2e, 0x8beca67db098c09, 0x114698d4310bf830, 0xe58a758d466a668a, 0x4b3980dc487e1a18, 0xd7c4c77b1311b88, 0x9f619db76b8946c7, 0x1440a748a5f56b,
+0xe0f0efd3846d4f33, 0x4a79ac6b4987e94, 0xb7e6dc3479a49c50, 0xc5152da66c5e43e6, 0xfe181f90811d0e16, 0xc40c1c2c6f7a07a6, 0xc945ab765b305272, 0x7dab9786e3e06,
+0xa5be1d518304a8d4, 0x425e87766d375471, 0xd4a18e9a97721a5, 0x75715adad89cd106, 0xa32bc6b8a35c9f9f, 0x93957f848cff9b03, 0x93544b063e96da85, 0xc4e4e60f742c7,
+0xd469858ecdfac508, 0xb411a8a8d447df1b, 0x2f61f751ce92523c, 0x176b4c5fc15b31fb, 0xf4c4a7688c8b27b5, 0xe68f6ec94a4ea916, 0xe5a6fcaff22bdd37, 0x184911839ab621,
+0xcdd9ab4d47aa52e7, 0xe562b249abcd16c0, 0xee2ec3ab28fa08e7, 0x611d6173e42f0f48, 0x760006061436d777, 0x3172158feab0d36f, 0x55a543e8b79f05b2, 0x373af0c4629987,
+0x8040baecf484ce2d, 0x1e4c92ffee5d91a8, 0x82e86e801b0c4efa, 0xd7d60bbf44bb6ad2, 0x5dd25f069c20cf2b, 0x57250601eecbeaa, 0x9ec10d0f4542fb56, 0x3108817ddd8259,
+0xf576669bbd795935, 0x901787a98c31339, 0x79c654989f295d93, 0xd17c7df240f5302, 0xd90fe4174f506da2, 0xbf90741b1f5a00f3, 0xe760a1ebce34eda1, 0x7d2434d16cba,
+0xc3b3da5fe77f0ca1, 0xc71556a559fbaad2, 0xf0277bd6a646988f, 0x4caa410ce1e8034b, 0x3485922ab393f96e, 0x3e6869a59685d297, 0x2da24e82ed47dadc, 0x3ef61ba180caeb,
+0xde892990de04a424, 0x68f63919feae491a, 0x2234bf73799dff1b, 0x4974bab9cf94e886, 0x4c3ae32a5a5c4ce1, 0x3a5e0cd1ab11f920, 0xe4d9719cf1cd8637, 0x1463e2f6be0298,
+0xc720ea5e7dd703f9, 0xf0fa4288c9fb6dd5, 0xf2007512a2eae5d9, 0xfcb99ad8f0ca8aab, 0x92bd318a972018b5, 0x5b51a79bf340ee07, 0x502344d44b45238b, 0x1deb72e03d801f,
+0xe7c147eaa0583293, 0xb67b1ed828de70a2, 0xc9712cea5d72fa8b, 0x7d526a856b5b2fbf, 0x72c4f796b752321d, 0x2a6d976b7c4d0135, 0x465b5963e0a8084d, 0x37337c386c4f89,
+0xf153a2ad0ade653a, 0xcf354c81e7539dde, 0xb0071755b074b675, 0x3180e5225f8d65a6, 0xd0e0ba3e7c872f28, 0xf946ba73bd39fc05, 0xbb0b3da660fa690d, 0x15fdfbdce04865,
+0xdd424baa2b00724, 0x6d6cfc3676a21921, 0x5738ef6fa4c1c214, 0xfe9da44085645fc6, 0xdb124ccd8f716eb9, 0xa8a517bee5a9645e, 0xff8f6dc6c6d47ace, 0x290544d3a9b278,
+0x14ecd8357cda9665, 0x7cb5bea082567ef, 0xac8fa63352815dd0, 0x945b8676f5916cd6, 0x9d30674e5df3d3a3, 0x901db545743fcb91, 0x3d19daf16f4657d7, 0x3f91b00aae536c,
+0x24e92d159147de0a, 0xd88dd5d836d51603, 0xca8a75e71fa077e3, 0xd6b49ec1d66aa5a, 0xbcca8f44a20bc1ff, 0x9c2429cb41ea8f2a, 0xd3923d74e25fa06b, 0x1201384cea28ac,
+0xc5fcd72d79f0b06, 0xd24f2ea30a66d2c, 0x67e3c55195bfd7f9, 0xa0d09b69e1c45072, 0x9a9b2156c362f143, 0x633d3173123e319, 0xb650b66e1cfd0541, 0x1f988876c38ed0,
+0xef93cd6c0a5d3a44, 0x3dd6196907649059, 0xe2aeeb109462a540, 0x34e1555b7c666ba6, 0xe6a30933039eb40e, 0x25bfa275c7c712c3, 0xe37920159718e15e, 0x12a2badde2b1f4,
+0xd643771590488590, 0x4d349d3d972a83b3, 0xb50254d6a5334348, 0x7048842c801c2a78, 0xd98ea30333070fd1, 0x865208648a27cd93, 0x70f0cd7ef1c913f5, 0x14c5ba815e4b0d,
+0x5952326b12d611a5, 0xdc1e7ee658c9a88e, 0x9b77803571e4680, 0x7aee3b8b6192c0f7, 0x3233cc7be669ce26, 0x2442b122c937fbcd, 0xf929449f17ab104f, 0x519551d33eaf3,
+0x8379a41499f06756, 0x6edfcfc8ca203b79, 0x368f882f67aa3f0f, 0x503639ecdbab6287, 0x960be8d0b779d4f9, 0x4a58b02ac7c37f98, 0xe92a07c590d0a4dc, 0x92f009da8ac3c,
+0xd1e661bde190a623, 0x91fe8feab8640b18, 0x21f8974908f2df, 0x78811144f95ceaa2, 0x7760702b8664ef37, 0xf981bdbd2827d32f, 0xbe739ac69b9a1d75, 0x2ad05a0d87f482,
+0xd6755a4058e3baec, 0x4cd7e6314c5c451, 0x971e9dfa530fa70f, 0x6c5149c4317fc53e, 0x1d1560277a0f7ee7, 0x47c4c9cf7acddb3, 0xf38698c1272d7e75, 0x2b46ca5d2396e1,
+0x3f9308cd19edd709, 0xfa8524b0423613be, 0x23581ba1c7cdb667, 0x198486dc67fbf043, 0xa53a335c4f305d5, 0x3bbdd30b2c35c813, 0x14d85f34517ce455, 0x279725ffc25d8c,
+0x7fe13dea6e65c9ed, 0xa3df4a7b0469e748, 0x4a72a1eea67898ee, 0x914dba36e7766a7c, 0x70da1e8034fafcb3, 0xe486dba7d515825f, 0x23c9d28eae18422a, 0xc7ec065cfb843,
+0x24a0e43f5bac008e, 0x67c81afd17808a2d, 0x8907e63e4eb1eb88, 0x566dc05794247274, 0xb72b1cf91f052a73, 0x13129dc400d1f2e3, 0x697b341920e00284, 0x2475f7fe0635c6,
+0x648e4ca4f0c0b7b3, 0x85c8bb020505528c, 0xf4ca4e7f50b2b9, 0x2108aca1f52b420f, 0xc1d2065cf5415594, 0x9c2bde9add022beb, 0xc924f21800b09e06, 0x32ec468bfcfb99,
+0x37000820e26daa2f, 0xa7be9a8c3318444b, 0xe52c84cd1d70b89d, 0x3622f327b081f03b, 0x6c98bfcb43ae611a, 0x17e726bb5b994ba3, 0xe667d0865966e9e7, 0x9b7f6bce86b4f,
+0xeb89ee9e2a443b38, 0xa822ecc2aea101ee, 0x7d55db66506c48d9, 0x4de7c5f5b8fb8862, 0x8b92ccc77951de8d, 0x65d5ab45b457851a, 0xa4c05a45ef34c2c, 0x19874b92110f3d,
+0xc9fbd8fd8d089e19, 0x672ae4057f685012, 0xfe1a87d396a3692d, 0xd9801b4f8c10032f, 0x1c81aa589a8fa747, 0x702efc0236c08ed, 0x4458f1cd954ec882, 0x1f45ee9726ff46,
+0xbd696abb4f799c78, 0xbf6def01bd06ead3, 0x75caab69df1f03ca, 0x2d0097bcede5f11a, 0x32a91da2709f8175, 0xdd8ee424727a4515, 0x83635f87db1eeab3, 0x28fd7e374223d5,
+0x2a4babeee013c9a9, 0xd8624a2a12c25047, 0xaf87ca49a7ca1c0d, 0x630d94ae1d551899, 0xbd292c190051d98f, 0x1e688ee3b82fc110, 0x418225f5bec96fa6, 0x3921afb3604d14,
+0x7648c4f8718d806e, 0x4133b7a2730084f9, 0xe726589a4ed869d, 0x888034717e0383, 0xf4200ee8dd5cd0fa, 0x154da66100384fd6, 0x74f796c7dbf9e261, 0x1f68af77361a7,
+0xbb8476c603444313, 0xb1d0d93bc62ef594, 0x9aa049b56299eb32, 0x1020e21df9ee50d, 0x2e2303d68188bee2, 0xf5823c696ba55466, 0x7c00ee47a1171c81, 0x16d78746b84155,
+0x1c5aab91371a1bc6, 0xa33932cfe25e5861, 0xcdfeb76292a14813, 0x175c2412c33dda4, 0x985e47ec9ba0f66e, 0x85738dce1a710f5b, 0xfc48e047b21512ce, 0x344ba9466397b2,
+0xa3ba90d783afa533, 0x41a75bb7007bda1a, 0x52cf02b9d3909583, 0x3642bdac19d834d5, 0x5bc928f21e2e73db, 0x27fdc19e90c092d1, 0xdc84982a89aa2eb5, 0x1a2c40d86c37b8,
+0x9ecd19547264c58, 0xcd8e15e314b15e4d, 0xa79c91c62d98035c, 0x41eeb34b55209c21, 0x712a8f71480f87d0, 0x2be3d35681487843, 0xef207f56a326adf5, 0x15817e58779619,
+0xded9dc4e641e264d, 0x1d9c0a7f1ee3f365, 0x49036a08fdc391fa, 0x75f85500ec52d860, 0xc7787718ac0222ef, 0x9504c8c3f3e92b71, 0x691caff2eb263d9f, 0x1f036dc5d4b578,
+0x8768603fb6e1a7ef, 0x2042320759061f1c, 0x2aeab53f17b1784e, 0xadeafde6a9f069d7, 0xd684719284bd48f1, 0x87c91230e4de97ee, 0xda53eac62499c581, 0x2e53390d64b6dd,
+0xd574f2de8b06e133, 0x618ddbce99452f0, 0x5c6cd25515aca9b1, 0x3bb8f41ac88a1a9f, 0x2b26b5b44ce090f9, 0x9453ae115715b948, 0x9256f8e97f8f2f3d, 0x15383aa4ffbbff,
+0x3d6b4403e8869355, 0xf77b1cb362c6c836, 0xfb4f0a01efbf8bed, 0x48b76dddb9a39fae, 0x964f18ab5be8c316, 0xedbef890c6d19b3c, 0x442716fd896a59f9, 0x2367f7ee5df196,
+0xf54b468dda9dca12, 0xca108758c870038b, 0xd52b558ffbc4ffd1, 0x42f9383989b387f9, 0xae4f2df6f8d4d73e, 0xd713ee2e9f975e87, 0xd50b9d4af9f0a051, 0x37e2b5790a8b3d,
+0x5d21bfdbaf838e23, 0x7fae01e9596dd05f, 0x9e6b73f23ad7a379, 0xe67cabe4669071ea, 0x23519d935fb38a22, 0x8242f62ae15ac5fb, 0x5deeb6ae95c72ae8, 0xa0209f42429eb,
+0x7596ae6d5a54019d, 0xa3b1ed7f0cecea92, 0x8a9fa757e9b80049, 0xcb4e5922471fc800, 0x3a9a7bb6b5f84cd8, 0x862069d4d94a782f, 0x4298f67d5a74cf04, 0x11015539ade58a,
+0x10bac86612d76343, 0x4517ef06080316c5, 0x2ec3caf93fbc5328, 0x642bd4cc5e776738, 0xa1bda2f531da90fe, 0x85b788b061d0fde4, 0xe6741149e48a6563, 0x31bb59c58642d0,
+0x801da8b931fa5c60, 0xa6df65e85dfacb9f, 0x7ef6e505cad1bb25, 0xd4ecade7d4cc3f19, 0x83213e018f7da36d, 0x49f6417eb5787812, 0xfdd54934a7339171, 0x29332813bd72ce,
+0x8447eec665309cd1, 0x36e6ccdb671c948d, 0xb45f9b04585e1167, 0x19653d5f036b91fc, 0x9555353a66e52bc4, 0x1806f8fada93ed22, 0xb4ba454ce2bd22e4, 0x3cb0d60309bd48,
+0x3d29e026a8def221, 0x464037dcb92d4576, 0xc68af04eccf7a9bd, 0xc82783fa4988923c, 0x459eba043067ba9, 0x5715be6db2c2d50, 0x2e9578ec8aa09394, 0x3d1a9bed0fd16,
+0x8d46a58c49a3a0de, 0xce297b9e448744c9, 0x5e393779e65c1f8e, 0x2eb3c1ff587e1176, 0xe01af06e3a49fda4, 0xa22193592bd1834, 0xcc00d7f9fee35f2, 0x13bef98f463358,
+0x5f4e3d13faf8da8f, 0x3b1ca405246cd8d3, 0x22eab69e07bc4f77, 0xbf13cb0173421281, 0x98222a44873e69bd, 0x6d156f9b038d1d0e, 0x8f882ee55cd62d3e, 0x4978450fa6a3,
+0x275810462ba6d62c, 0xde981035bfc375e, 0xd33656173c3b5695, 0x891109b92af43e14, 0x6de4bdfdca709f32, 0xb29661614f1f7936, 0x6694a84a4b4a1ba9, 0xef5389f3f07ae,
+0x5f116b1b6c312953, 0x1a6c4045a44305f8, 0xfaea12024f88736f, 0x1c8110672975f066, 0x8255f22d6cf3955e, 0x7c048cc7c961e414, 0xdf62d33594b743bd, 0x28e9b7aaefc98c,
+0x7a0f5d9d7b7ed552, 0x9dc11e7c330f9d33, 0x4cee7bf958820a03, 0x31d3a49f222a5475, 0x82fa24222846bfb6, 0x17603cf803dae5ee, 0x5486a20a9d5bf902, 0x1f75dadc99515,
+0x2b4ceb11f1757049, 0x763c317dadceae7e, 0x7f1965bf0edffcc, 0x44228a5748411cb2, 0x10e05e5f7076f9de, 0x8610da5ee2d3cf9d, 0xb208803e12d730c4, 0x18606fdb25414,
+0xa185610e494f1fe3, 0xc0afb92f2be16cc4, 0xca0226cbb2a5f3de, 0xab438aac91fc26ad, 0x7b12e23f10dce2cb, 0x10e0aef369740b85, 0xc3a32bb3fa7854d, 0x1dc1f39b1083e5,
+0x6068bb541afa34dc, 0x408d795c6644b2e7, 0x7b3aa6554e6cf53d, 0xfd5de3972c2b0628, 0x56fd6e89668b7e1f, 0x2f94f16e0a6b5fce, 0xd1657de5e1d56c9f, 0x5fa16483689d9,
+0x282f61c0ec2a6846, 0x219901da8ae37e9, 0xfb8c93bcbb4033f9, 0x9ef73fb056e9c4c, 0xe690a8fae5f98bc, 0xbb709ee0ff820974, 0x2349682c697f3e20, 0x3503da2536bf10,
+0x98628bac2bb6dbd, 0xdc641f113720ef5a, 0x524515bd7c5e9f60, 0x119f3ed82b4caea2, 0x8309c5f826a2637d, 0x4d64d4ae6cc8c0f3, 0x98a7a20abb93883a, 0x1a763445278110,
+0x7068a3b3d4c8049b, 0x9db519e82de8002b, 0x31c887451bee9954, 0xd2feee30bb47b36a, 0x569596f3ec1df462, 0xc7cfdddd09dfd07a, 0xc1e089423ffdd21f, 0x4189febc17365,
+0x161d5f87c49ce12c, 0xa28f9772bcde8194, 0x6ebb71c7c73f82cc, 0x3669d0614b25aa1e, 0xb43ed0fafaf17cbf, 0x1fda77f7b38deabd, 0xdf78e59da0367aeb, 0x214cd297d5665,
+0xb92fc45133d7a203, 0x697e2dd43b410f47, 0x6a429e9a2ae817a5, 0x7ff08a42e33caf8c, 0x135536f99aa1b807, 0xfdbc80236f71aa3a, 0xf650d4037c2f90a2, 0x116b77f3138bd5,
+0xd13a469768f4cd18, 0x4d58de4d04202402, 0x1599160cdadadc1c, 0x3d0bbe35152974d1, 0x505db57ef11db1cf, 0x72f7d498b1a120e4, 0xbf923e777edfa5c8, 0xaab1111d37d44,
+0xf182dd82dc87881b, 0xc72baaf755efc765, 0x1744e855ca24351c, 0xd2525ceef3300eda, 0x840e15b431c045e1, 0x4500b8e3e52dc8f8, 0xca8769a70adca88e, 0x27090a3112ffd8,
+0x81f08d6fce71e81, 0x2447734cec7b5b1a, 0x239e35b338e6b49b, 0xef146da46043a268, 0xd44f505960e40565, 0x2c07244e0d3bfbdf, 0x601cd1768b635ae6, 0x3d1951800a1c9c,
+0x720291ce3dcf793, 0xb099c89e1f3180ab, 0x2371e4118b560dc1, 0xb3b61d19366f2185, 0xa26f4603ffbf55ff, 0x7b7891f4aaabbd1e, 0x1023687efae9e21b, 0x13579a91d90e01,
+0x62f59c319cd22c3d, 0x9ca37646cdae026, 0x7c420b2c206bb50b, 0x29ff92fe4a37d7f5, 0xbb9ee0a6698cbc59, 0x70f18570b883bf3c, 0xcc821b3f596fb2c8, 0x38cb79d6b52189,
+0x2f05c990831d5855, 0x1d534ad7abd81960, 0xbd2a2a7a67e5a5a2, 0xcf51b75281b5b5ff, 0x18384c9d411a897b, 0xf0056fb6926f935e, 0xd8b0bddf55584458, 0x2a30e1dd1d68c5,
+0x4b175393dd7e6fea, 0x27c386efc7cb4f23, 0x1d26ca635b21b136, 0xd68562bdfd592cd8, 0xdb3da03fc0f8db4d, 0xeff8c80bf28979e8, 0x58e9540db1a34d31, 0x2ca8e2d6d1cb60,
+0x23d0f236fb58f028, 0x78e1276ef56d1196, 0x2ae887277ebe5392, 0x31f327b39ce952d8, 0x21a639ff16870b92, 0xc9468ba7a2cf3896, 0xc2199ef60860e51c, 0xd875ce59b9dcc,
+0xfc0d06523823d921, 0x398c886b64b26cbe, 0xa10b5e189ab1ea1a, 0xe240e701f3c7e248, 0xce7020eb83743f62, 0x2e26515ac95c596d, 0x412c75dfc45fff68, 0xe7d9182b937e,
+0x2a3643ae615e0649, 0x9ec5d615693e6852, 0xa6acda0530822777, 0xd1c6f4071f946171, 0x56db7dd89439fdf1, 0xa038775d748033f2, 0x810794828a93c13a, 0x1865cd8661acd4,
+0xa53576c7545a516c, 0x2861ce47e4332386, 0xa6b7b04acd900830, 0x81d16ed9a0e6f2b7, 0xf966fac3dab7cee4, 0x8eaa9098fa90d13c, 0xa49bcc27a3eea7a6, 0x24e687e28e99c0,
+0x3aaabeb594e5c43, 0xb00e78474ae83afd, 0x41801cdc51017b0f, 0x39860ee9bdcc7471, 0xd598d5fb040de047, 0xa38e00942c39e2d9, 0x18336c94223860eb, 0x28482f901b3359,
+0xbf855ddf01afe28d, 0xd43fce21acbd8eec, 0xd86e2860cdeb6ae8, 0xafd3f7e7bde1b1f1, 0x6d4c8388cf7c9152, 0x29f8e2043c4b8fc2, 0xbfe2c1ca06a023c3, 0x22f89b8f3e83af,
+0x6511f976536700d5, 0x7dd25a26de2162f1, 0x3a4f1a77d2a831b0, 0xc6f8cbd072cec9dd, 0x20d8167b916206b9, 0xe321a9d7610fbf2, 0x83094cc1ade8b2d9, 0x2acedea6319f97,
+0xdfc59ac18f92379b, 0x3b6b832595909c5f, 0x70990c8cf293c84d, 0x82322671d4611fbf, 0xe5c1eb2de3fafb2f, 0x560131676ae6187b, 0xcc21eeba052ec4ab, 0x6bbdb3ae2f07c,
+0x341b5c43f6e2bbc2, 0x722b4e9b0e9adc61, 0x16aa71e164638e03, 0xb4e3ad42e79b85df, 0x8d35a790262623a4, 0x27efb86c5c4b7453, 0x270833ca4c8af6a7, 0x2af9285bd8d753,
+0x93185d9d527a7042, 0x3c1be17206f1820b, 0xa1b368d4ed6fc35d, 0xe07a0ce443bbc133, 0x27b79ec591955836, 0xd0216d3bd3596996, 0xb4cb921ebe932ca9, 0x393fd83c5119a0,
+0x15d993f353ec8352, 0x23de40295c06a23a, 0x63e533b37f87a22d, 0x6b366bed310aac38, 0x4404b7e62d0130e5, 0xe71f918c89e5d13d, 0xd59d91a2a64072cd, 0x1fcef34df43f96,
+0x73f288270dc6b710, 0x64e6eac83436b84d, 0x64dc9d89d3e0333a, 0xaf9609c33e9f04f5, 0xd3c3bc295ef05ecb, 0xabcd3b5160a312f1, 0x1ec832f75cf86ee5, 0x1739bb8d49968f,
+0x5c8887df29779764, 0x50c24cf4f04bc153, 0x415df20d643f8229, 0xab7912b4c89d8b19, 0x381d7fe2d180e201, 0xd49f7a03cb8854aa, 0xdb6d917fee5eb1c4, 0x1bd3397e685a32,
+0xed2a5245a1818071, 0xbe1ad7001d7c8104, 0xa8dfd571a6763512, 0x1408b17ac056b5da, 0xf3f769c0f2d83b74, 0x6b0b28c19891588a, 0xc0787e46c8bf14e, 0x3a0d7da7690f6a,
+0x2d0d73a5a5851b86, 0xacb6c0e325b4bfbf, 0xf9be3948f79af6f3, 0xf5f023c8893f8aed, 0xb1c62bf112bd195a, 0x5d2d2deda5a9b2a6, 0x77d19ff9aaf4766f, 0xd67600acc3cdb,
+0x3999c7dad9e8d28b, 0x6f177f12426d76ad, 0xdf01e2431dab7a20, 0x86397a08ce17c969, 0x7a15309f57d0c9de, 0x928359898a78b64a, 0x7831f0d6f97fe63c, 0x9a29103a8e504,
+0x49f20ebad610218a, 0x1ac346c7f875d827, 0x27790e24007ef38f, 0x39a4a3fa26c752aa, 0x5dbf69ba419ab3e3, 0x8e359a9898cd3481, 0x7393d5752f87847f, 0x15f305c824d4cf,
+0xcf96245c236f90b8, 0x27cdc3fcd06b4268, 0x7592b234efc3c65, 0x9939425393730171, 0xb8648b48fc0dbeaf, 0x774fc091a9902c28, 0xdc6b5dc13d33c9a2, 0xa890fb52c3802,
+0x208cfaee52f2e947, 0x6a8e270d5cfdf9cb, 0x1fbc90d27a21b919, 0x29629dac82ce4a43, 0x8f70f38a326847c7, 0x1620565c215508fa, 0x5e49c00ec78038d8, 0x28a191176f0481,
+0x9e94ef014d02097c, 0x5e7b536d83ca55d0, 0xaaaa23083682a69a, 0x366374202f673a31, 0x3ab9dd980f372a4d, 0x9c5b30cc57de8912, 0xfb6c15dac93d92ee, 0x3c28488d8394bd,
+0xb7a2c00ddb7bdd66, 0x6aaf11b1c8c98772, 0x5008af30864ad2e1, 0x2b365309a19188ea, 0x3103aa1103d80d6d, 0xf74c04b4441ee4d3, 0x1d9f304725578897, 0x145b09da65be98,
+0x8b103c19d4ca89bb, 0x6a16c683dad8edf2, 0x7acbf6e84b9f285e, 0x3954e062f12a6447, 0xa271352cace4d136, 0x8d5ecec65ace0d06, 0xc4136c051155c6a, 0xffceae3572d87,
+0x58fb346b89954ef9, 0xf17da9ad55f01715, 0x2cf203dd5f86d0e4, 0x591526bbee369f84, 0xaa9045740d615c80, 0x708787d087f47b65, 0xfb713f58be5a8142, 0x3ab752cdb4a0e6,
+0xd82e9c15f18e72df, 0x38e3f73ac8dafd9f, 0xc8b324df80f24c3a, 0x1882583026bbbf16, 0x198dae3ad9ae4002, 0x959c0880450be82a, 0x476c7867150840fb, 0x14cc251be14f72,
+0x29d93c027525a4b4, 0x30248bfb56d18de6, 0x42bdd748e4bcc3a7, 0xb33e89714b06f352, 0x8e90dda148276cf, 0x2d966dd5fb9b0850, 0xb1146e6b0f41450c, 0x37d21cb7591894,
+0xac784fc50d857801, 0x9f5f08989cd67db7, 0xb739896895584962, 0x13a7340c888a3408, 0x637d02f05386f637, 0xb590df867ceba801, 0x7a8d720339d84fd3, 0x32eeffe3f03688,
+0x686661147c713426, 0x9bccf48d375e7f25, 0xfc2469e8a728ab11, 0x335b3699f567c78, 0x5ff11cb2cc6d5328, 0x67940c4791e4fa1b, 0xd437fcbd97ca69bb, 0x725dcf17597fc,
+0x6324c344011804ac, 0x1fc36d59f60f8b82, 0x4cdc3ebdc884c033, 0x2a359a43fa3fc9a0, 0x3bf08bd4c5300a7d, 0xee3eb07ca39127b5, 0xbd820c6be3a78cda, 0x2884aad6cafcb,
+0x722b19550c7d897d, 0x9e57fbfd18ff5c7e, 0x71064c27d356e7fa, 0xb1a66c9ee22e4e48, 0x728409545f1fc94c, 0x384f15114df4ca92, 0xde6edce4c4269b6e, 0x2b817d757339b0,
+0xd84458d96fe9a3ed, 0x759423bae60b9de4, 0xb7c8dff9816c2ff7, 0xd274da8ef2926490, 0xb8d34a19f01ee5a6, 0xd49e003d4f342cf3, 0xb93b0fbb00c9b3e8, 0x1f9d5b74ff88c8,
+0x57ba70dee5786e8a, 0xcc7dc7facc3c5da, 0xe918059ee4b73b65, 0xf5970bfefcac5ace, 0x2d8dda9fc28c6240, 0x2363f17565f59b82, 0x5911907471525a33, 0x1798834713be7,
+0x9a20156aad8c6799, 0x6007a38239c985ba, 0x48e106eb9300a268, 0xa00a2e19bec103f6, 0x511b2f2c20171523, 0x46da0bdead163330, 0xd0e3abda579f5be1, 0x34c1be1011e6b3,
+0x11d4179fa17e7bdd, 0x86684d45e141c5f7, 0xc1d3cddce45e8cea, 0xef6baad40ab77a14, 0xe995c2a4e2b8577, 0x75dd98baea32ef45, 0x4a55fd132e77204a, 0x3df15061ea45f5,
+0xc588856e985ac733, 0xd7539c411068bcd5, 0x66d1379752add46, 0x4fd123d9c1dfd3f0, 0xad9d34b43d045350, 0xbc674a513fcd552f, 0x928437d84ae6233, 0x2d332a16061a4a,
+0x7029777f8666c35, 0x1e0ae9490e2a6b37, 0x47d457abcb1aa947, 0xd87a6249137a87c1, 0xfcde41c6176c28a, 0xed0b9ec79aceaa00, 0x815f4463e21fb786, 0x1ff0d715b5517e,
+0x33e96f6cd531f65e, 0x5e75c32a69c615c8, 0x5820e10dea2f9483, 0xea9e54e71254ecb8, 0xde0291ba0a7a8125, 0xc3730aafee367a81, 0xce23c86dbe572d2f, 0x2acb8b0f326364,
+0xf2cffd0ba51ed2f8, 0xb4fa7de347594e0e, 0x402ceb4c89621797, 0x42de8b9830eb2f4d, 0xbba504794ce30e46, 0x63809a66dc212552, 0x5fd908504a60b3f8, 0x19f9dd9da732e5,
+0xafd1f8d41e29a1f3, 0x11748dc0f6e2c2df, 0xec4bcba2c72ea4b, 0x2ae740f9e1bed6e4, 0x9ed1d4fa5a51c2ad, 0x9f609b7eda639f69, 0x6fb66715294b5c10, 0x7e87c234d2cb8,
+0x32f5024eb2ed1184, 0x1a3956f4409f49ec, 0x76b9b841b07ed458, 0xf1f456a19069df3e, 0xec1037f58628fd9a, 0xf2ed3cb14e3175af, 0x1fa1f527262cf55b, 0x30fee58564f28f,
+0x44a31354cc9eb502, 0xcf4a28d4319402bf, 0xcfd3641ea455d79c, 0x7b9de895900259d2, 0x8b6d8641f5e3a736, 0x7f3f3a2ea0555ec5, 0x973d3160a12c1639, 0xd25c04136ee72,
+0xfbdded2c6fac7dbe, 0xea5712b4626a1d74, 0x9ed8ffe2b1173c4c, 0xe63970088e64df83, 0xa00c011fa8d7a1ee, 0xeb33fc8156d35286, 0x2bc0134fbd8ddf7a, 0x38f4afaee6d576,
+0x454e3d266f229110, 0x70b936c3934d7d0f, 0x50b6ec529d6b4bed, 0x17f495c3a1a1de2c, 0xa8767939ea75a891, 0x3df32cc84a5d580d, 0x2a9466574763ed3d, 0x340dd9519fc3d5,
+0x78372b3a98e8c78e, 0xce4e77358d2c52e, 0x1761008cb7ddb8bb, 0x8e58a101b6fa82ba, 0x3949c18a8a733870, 0xa589d1215cbe0580, 0xdd6defe61b3af83c, 0xf5a6f717abe73,
+0xe95dadc1e189f539, 0x21088b592364248, 0xd92911f30cd11766, 0xf79fde1aa305314c, 0x95836ed7120e7a3e, 0x6f115ee06bc5e5c4, 0xcb4a579d08a6b9f2, 0x37e6c3bfe4bd6a,
+0x1dd4a7adc6b9a78e, 0xd1cb994de71aa770, 0x95d2c416ab8bd6b8, 0xaab9451e328b0cb6, 0xa673f4fe164ee19f, 0x77ecc9acd9502fb3, 0xd97b5dcd988dd965, 0x2b04325d6055ef,
+0x3ed7ca4df5bf805c, 0x9e7ae418dd8d176b, 0x68dffec8ef68cd33, 0xbd74640d9bbe038e, 0x8a6693233496c856, 0x2885a586f6466792, 0x169d1bf54cd82ab4, 0x1ad323e71ec6a6,
+0x356d6b6b82d8ce93, 0xa7a02d828f8a258f, 0x38439c52ee6b2760, 0x4a0c29195152cd7b, 0xc005d2145ac225a6, 0xdaa32f2ca13efdd4, 0x95dc8d37214602be, 0x2f497863443929,
+0x5f6e9a9ce5a64344, 0x5df02747dbacff87, 0xbec29c4b21b76151, 0x2534525ec2b76771, 0x494762de3d1b9450, 0xc8dc083985abd479, 0x4032b5668c3e6483, 0x12d91ad74befc8,
+0x52f561d785f72ffa, 0x792f2a72bc9f12a5, 0x8063aed1ceebde11, 0xf43751a5f08729fd, 0x76410e2306122b2e, 0x974e363c4920383f, 0xc3f134cfaf6519ab, 0x48b2e8e4303dd,
+0x8ebb94a828d020b4, 0x5c703bc1e361ecbc, 0x822eb5dd8cc1c41b, 0x822cdc9bb775b31a, 0xb6f8b7388f1d6ad1, 0xeece90bf9f9a8102, 0x1cb80fb23e64f103, 0x38a6495fd65cde,
+0xfa8c26b68263f7ae, 0xb1c7b941713ee49f, 0xa310453e08514ffb, 0x6a01dc0b696f1dff, 0x68e79c8bf1ce6896, 0x220097b265864160, 0x373a75bf59e45b90, 0x2deeb1dee5531d,
+0xc7213ead14dbd75d, 0x62aae14c0a2aeffc, 0xcd66429b5a080b0, 0x19e370224cf5f097, 0xda106f788f20560, 0xdfbadd2876a716ac, 0xb829966baa44fb9b, 0x266c9d8bb3189f,
+0xca646c252489f5fd, 0x23e7b81409c06440, 0x26da07735528f64f, 0xf9190f468096417d, 0xb3ba24df30518c21, 0xd79e0589f9902952, 0x5d813826a14d27c, 0x3c28f1cd710a9d,
+0xb949bab5c20ebfb8, 0xe9311f3b715341a7, 0xc6e3a94d792c575e, 0x3d927ac2c5e72f8b, 0x810e14f7e7a194fb, 0x540b235979e78e7f, 0xe34a06e205680c7f, 0xc28c297436af9,
+0xc8c52252cca0e0f7, 0xaaae48e60e32c5c8, 0x5a5db2b7bfbcfaee, 0x2e357d9448d67c49, 0x8ac4270ef2c8d6c8, 0xacce6da5a9506fa3, 0x24feb6288d286a28, 0x1d1d6e31746392,
+0xc34be4b33eb12ab4, 0xb7784dac0f560a21, 0xd3dff05c0a9a7641, 0xfaace169b88ead7d, 0x66b7bb01498d93a5, 0x85adc0fd414e3de5, 0xf2f529215ca4d927, 0xd77e94584c035,
+0x3a877a38bad66ff5, 0x48a8cf67a46c799c, 0xf87ee13ec1133fed, 0x33da4a40286bfdc7, 0x1f2330a49b32cdf3, 0xbf3379fcb51e78f8, 0x2e619033fe22902a, 0x3339ea33fb0766,
+0x32231017443b0cce, 0xc6e355c75ae9d1dc, 0x20d498e68c2a13d3, 0xececf790217db365, 0x5dcb3cdfc05f9807, 0x4fb29af45963eceb, 0xa6c062ad065b6dc6, 0x9bb511d46d470,
+0xa3b8dd8017b91b35, 0x941747f44e769ffa, 0x58bad993148b6a92, 0x57e5f20132d0507d, 0xcea5a78475b24cc3, 0x88f3d168f562b8e8, 0x1987b26e62e2b94, 0x2dc2996542ce1,
+0x194a6c1add5088e1, 0x1b24a2bf7806e305, 0x6bcb7192352c0c45, 0xb924f955665d8e39, 0x6565aac984787935, 0x1eabe09f14985da2, 0x475eb4db50fc3152, 0x323532969d35c6,
+0x5be8f24f4cd6ea4a, 0x4a231f6418ee31f1, 0x2068fe6538bfc63, 0x80836b6c68b0d768, 0xc1d17f1805944e5c, 0x310b97239edee554, 0xf14f49e77b3e6e0d, 0x2f0f564310761c,
+0x9ce1aef827a7e285, 0x8fffc37fb13b63e3, 0x9db8f68157ec4a56, 0x246fbf74568b2243, 0x2d75a9b4c4f3c71c, 0x858af7794a63542c, 0x1ae937b234ccc08, 0x39f33c94c2ac9c,
+0xcf81491d9ac870f2, 0x5493d45cada484a6, 0x2aaa22bc3e524c2b, 0x57ad5dd04f0c74c0, 0xc24859a57a6aa297, 0xff59417225f99c3d, 0xed8dd004bd52c35d, 0x405e5299655c5e,
+0x7262c1532b3727d3, 0xea59f51fec322296, 0x168fa2885897961c, 0x16d83df9db244119, 0xe8de828ef9ac6b2a, 0xbb313292aeab7bf1, 0x787d86be3f4fe83a, 0x16d6acbe64c611,
+0x33644ed655339565, 0x36008e02310cc20e, 0xfa9f64a3d40296bf, 0xd5c2c541076b48fa, 0x6de455e984bf3609, 0x66983b364bf73a30, 0x54ef6e69e278280c, 0x35c1c2e83eaebf,
+0x9e6520a0a45f11bb, 0x7cfd4b4b55371883, 0x8118a4e9aad6877b, 0xc2aae6443285cae7, 0x45cc4cb63e287dd4, 0xb3edb87c21ce1b57, 0xd1eb5e4a4ab8c359, 0x3f258c2693ab7a,
+0x53ca03755d92b09d, 0xb3a59d5f2a1a9354, 0xb426cdb591a307f0, 0x4e71535ddbba400b, 0xef39575c9f0dafda, 0xfcc3b11ead1a9720, 0x7cfb2a421352f985, 0x2237154551fa6b,
+0xa71bbd13147a2333, 0x410eed582d8abca7, 0x2ced0871c45ebd8d, 0xcb48a9f7a23a5fe6, 0xf2c10aa1b766935e, 0xed4dfa55744b072c, 0x29ad173439045e8d, 0x266a4c6150f536,
+0x64e210606082b244, 0xc63287ae03c683c3, 0x32cbf17ea1f4c99d, 0x72540cc2a783a97, 0x8d30083246ea9c9d, 0x27bac548c70efb6c, 0x1d4c10895ea105b2, 0x3d7c92ed009948,
+0xb05eec6d6aa49cd1, 0xb5a33189b6ad5dad, 0xb0ce5b9d017c8c99, 0x16cf86a9a36895e2, 0x909530609420602e, 0x581f6d83e84b5eec, 0x71d4dfe4f88f754c, 0x1092cc7159d027,
+0xd25493f3f46efa3a, 0x70cc3499ce9d8442, 0x99e18bf24b44090c, 0x52debeaf0640a5de, 0x22bf87d6eec673b7, 0x273cd03b6101ca1c, 0xcbdf6fa89673a80d, 0x3fb5414f5ef5bd,
+0xe73d2257d0670b3e, 0xfa1c4d1f514f3e9f, 0xb9620b6ec8d77bc0, 0x9c825b9a8246a50c, 0xad1d84ce491605ff, 0xbc5658bf002bf265, 0x7d4d54962d59b13, 0x2db03f59390b4e,
+0xbecb31a2291c8200, 0xf0153a56d335fe4e, 0x89aad6542ea70d8, 0x4fa2f43cb291ea02, 0xdd03e260b4c093fa, 0x298b549637e9c5b9, 0x691b55eb0a5feff4, 0x8c1fad8488335,
+0xa434bebff9078f5, 0x79ff44f56f2e000f, 0x9b84581e5bc6af81, 0x500a62abdded8b4e, 0x53246a6e8c2d4bd8, 0xc64a505621c32a55, 0xda4c2c17bd43d40a, 0x24c67ee33856,
+0x5a75c9bb77a3ce6d, 0x191081b7b4199a18, 0x1662469af5c4c965, 0x273189752bc6ce0a, 0x21461566ebd3c21b, 0xbe234fec984bc0b3, 0x904c7a88b289a1bb, 0xd399617c5d6ad,
+0x8317abdb1e819d55, 0x414c34a09d0d2366, 0x49a4a6ad3b4291a7, 0x2c450b1a387abbe, 0xcdb1f6f14a03bc57, 0x2e613ff0f43d7327, 0xe44aa9d790751b10, 0x38fe3407486d7d,
+0x9b534f383cdc03f4, 0xa7e2cdeacdd27bf3, 0x46fe23e0af23baf2, 0xc34168b1010da568, 0x12836bc8c60a9b22, 0xf226ab3f15d55125, 0xedb4b9e8e78f07ef, 0x172c2471a00236,
+0xc9686ace605f0ab9, 0x8df28f8e25ac20a7, 0xc1098cffb7a7fc82, 0x94cef7803f7e99c, 0x446cf415c443983, 0xf8ef561b2d6db721, 0xc1f0baa6b7e4a8e3, 0x1e69c5abdcb508,
+0xda0c2005bec17e87, 0xbb12e59f7196c35b, 0xe14bdb473484ed27, 0xca64050a40d39a1d, 0xe3c6e5ce797e9a4a, 0x79f8a8b63b7f89db, 0x218a5b4e05cb79d8, 0x2784aacfd4f40f,
+0x3f113c7e7adb17fb, 0x73ee7dcbed9330f3, 0x5e06054e16f9e73f, 0x25a75c3126eb3247, 0x1eae5c289c3ec007, 0xb13d200cfef41f8c, 0x1babb1e7e5686a36, 0x13b3353d7ea9c9,
+0xab930caa0e0ef30d, 0x13965af83596705f, 0xf993d46e0572b8be, 0x92ee4c76f7e8c770, 0x2fd9f9546184d3f0, 0x5a1a2d4dc5ef64a2, 0x35e71bc94b46e4fe, 0x112f188dd1fc54,
+0xf15fee5db4aa5167, 0xfe0906d530350f08, 0x933784435106480f, 0xf619d978581471f7, 0x501b3a51bb364c9c, 0x25cad0ed1345c914, 0xbdbbefd0163ef808, 0x37575be8c4ad95,
+0xef4f34acefe90023, 0x2af043448e0a3a83, 0x463bb8f3863d893d, 0x905b9cc4713fe335, 0xd2e3c7884d733221, 0x7929995668f8b732, 0x6c122f1235ed0787, 0xd9d6706cb4592,
+0x6d55121fe2817056, 0x146a263bbe037dc7, 0x7166168b5c533129, 0x1a36503ea22e8669, 0xbf32297fa68e6e19, 0x20363128021d2d97, 0x8582523f2ef6f2c, 0x5ade3a9e82c3d,
+0x26bb790b31f3c944, 0x25adbc94cd08895f, 0x3a6b65a16d6f86dc, 0x9eaa52b6b33665c8, 0x18fbb202ed2a820e, 0x7b0a48f767623855, 0x62b98e4a2a48bba4, 0x22b334f925cc0a,
+0x40147a3be08bfec0, 0x70fe35f7673f0024, 0x9033fb0cf6d5b077, 0x9294037ecbe80023, 0xa3f3923681a5dd03, 0x7915f96be69079d9, 0xfe89b2a020414a08, 0x54ff9c07b0c89,
+0x6c822d206bd5c347, 0x464a4d7c6a49aef4, 0xcd18273dbfbc30da, 0x96c0467cfedfe178, 0x65c5e95ac4da03e9, 0x41e85fb725a4da67, 0x2aee276f81cfe78d, 0x2b4684ac0eed74,
+0xf1e572b044a17661, 0xa1c4edf9a86b5a81, 0xcb0f47ab7409ea74, 0xfde41a6880133034, 0x9a7890f3bd848099, 0x23e807a9358fb696, 0x912d20678c350ac2, 0x38b6a697c6a5c1,
+0xf8d294cffe2af123, 0x4843adaff8d53230, 0x9c2d393663147b6a, 0x63a67672166dfe97, 0x5d909b8924cb7f87, 0x1af0000213bd7a63, 0x1db34a23f2efe132, 0x242337b831f474,
+0x6c6653449ef0e975, 0xc185f019771c32, 0xb231c7cca58ff255, 0x319f53f43b8657b4, 0x78772f6081fcfe42, 0xdef91222d3570cf9, 0xc9e3f9066f31d9da, 0x2547e27bc8c811,
+0xc9412c448a2e6bdc, 0xcd0fdd508316e69f, 0xc8fdba08a5508c2e, 0x4a71912adbeeeed9, 0x8f75c6c87afe4434, 0xa3f8c3b3599f75d0, 0xd6c9df3586c54aea, 0x3ed16f866e47eb,
+0x892023b5826b9f42, 0xcd2eea4923ee3ffe, 0x9efa48c7fdc6aa03, 0xfee7b25b16842d3f, 0x4349c3ab27350993, 0x1963e9c938c530b0, 0x17e9eb8857539d03, 0x3b7521b23d105b,
+0xccf8f2d312045ccb, 0x5e7d7184f5976ac, 0x3f5c510d29ca4265, 0x77d46522c6b8f9df, 0xb88e2c7b2c9c5fc5, 0x9bdf676268036f7a, 0x98eca8ad7deb7057, 0x5abbe889bbcbe,
+0x8c32e794f94de343, 0x29f9afab4009e217, 0xb6cca1eead1522fd, 0x2675914cc39dd412, 0x662c0a0adaa396bf, 0x17a46d319cfb8aa3, 0xdf53971198009686, 0x262b0159289d6,
+0x2153a48c00fd41a5, 0x36738e861837bb74, 0xc665de3edcaadead, 0x7f5711a9d002960d, 0xa673096e09b1409d, 0x7366b487276fc5c4, 0x5b85578017a41d3c, 0x2347918c75e1ab,
+0x36ee7cdc8a3fc3a5, 0x5316e604203e442a, 0xa75f2a6f1af07072, 0x2cdeddb06e83ae9, 0xe3b6e4f5a6318d54, 0x9f259d6d00fb4fa5, 0x93738ca735fd1508, 0x2f4fca97fe48ad,
+0x6169488266576f8e, 0xd26cd71f4bb5a5b1, 0xab1149efb6e7f8ad, 0x82361b90edc01ebb, 0x96a2accbffa3034d, 0x78758e017b526045, 0x694be34b47186e3f, 0xaa6a1bc166919,
+0x7e8f897c3deebea2, 0x65a8f83c4ab2b33c, 0x9c81ab9291e1ad0d, 0xc2dfe3a3588e9c13, 0x1263df3c23a6e3d5, 0xe09a5d4f51087da2, 0x27bcb495c4ff30f2, 0xa50d6a00c7f53,
+0xfde0ac6679d3b95, 0x54ae52438838dbfb, 0x454ec2a4672a7f4f, 0xed67b4a37a4ac9a8, 0xf5bd136bb9545baa, 0xfed874a5321a9503, 0x8372958d418b9d76, 0x519c99331e4dd,
+0xa139ec8f6f092e95, 0x7791132ce76865e7, 0x5ddff584845478c4, 0xef127bad1226cdb9, 0x730c77a678be5504, 0x5113c27835e895ef, 0xde1b3bb9771cc91e, 0x24b1e59d4c3c55,
+0xbfcafd1e31b09fd0, 0x56ba7129af85d789, 0x1c5692cec922c5de, 0x34e1a173d9432f3c, 0xe3adf4e00dd62e29, 0x799eb5b5083cde34, 0x9b257fd6bc348620, 0x23d5b0228eb02a,
+0xe621437ddea7716, 0xf288ea5358d2488d, 0xa3617e25f08530ee, 0x3322e6fc68f7b799, 0xb62afdebecb49628, 0x71e3ac608892702c, 0xc4b1de2fdb075952, 0xfa5235926b181,
+0x439815c31d1eb838, 0x43fe9c55c95cb2e, 0x1c42e52b6dee2222, 0x71e78f988f4a120d, 0x1ec95deb60763da6, 0x5f3cceee10ab220c, 0x391b27e736345938, 0x449b078ee9a7f,
+0xd0e99f410e67e619, 0xbb0e62209540ba52, 0x120793e452d7151b, 0x9fcfdf777de9ac2e, 0xfcd507add2725d2f, 0xc2b88f89bffe137, 0xeae8348bf0620549, 0x13312cbc863ba3,
+0x32229cd2472d3edf, 0x33041da90c189d04, 0x179ceb1d4af13ff1, 0xfab59c8f394d3cf3, 0x166f3828e8867979, 0x94a212c83ea0e1d3, 0x100b731406101c3, 0x35e6176120deb6,
+0xd9fde862c70af1ae, 0x201dd250e2373de9, 0xb01ae1c2dbc440ae, 0xcb9f8ea3dc9bc146, 0xbfc1ca7ed34bca8, 0xe61204f7e8f6caf3, 0xa3cfcd3302134402, 0x3b79179546b74a,
+0x96c1f285e5c8ad36, 0x3adf88b69e30ca18, 0xfb8c254c242e0ec6, 0x5d7681fa915cf94a, 0xfd819261effc51a8, 0xc276761595b11119, 0x3bc7ff9844e51a62, 0x2c981b6fa3dcd7,
+0xf6ed6052a8d6f37d, 0x8a977510b7f253b1, 0xdde0142e61173aaa, 0xee2972e591cbafe2, 0x501c19c2ea87ddc4, 0x56fb69e9fc1dd1bc, 0x5dd0ae659e370d0a, 0xe5504c2d9b336,
+0x58142fb18967eece, 0x8aba459b1862f099, 0xe013bade68953ff5, 0xbf2eac135e8f2a03, 0x77164589835fe1e3, 0x73fb4a738139021b, 0xca3af77d3133a8d5, 0x20d90e8759a71d,
+0x912cb2ee364b0e00, 0xb584a690db4b3cea, 0x5ae0b82eacfecb68, 0xc8d44d8186ad560, 0xe4bee54f6eb7e4c9, 0x4c9acc90dd70437a, 0x1e4dc2c6c4b20a5, 0x363d311cdb622c,
+0xb2453bb9b96a0f80, 0xa31c40f632d5b778, 0x28539f933d0718a, 0xdb9a0d24724f3764, 0x5353213fb549e9d2, 0xb399bd49b8568e54, 0x97875cca5917e503, 0x3ac6a4c087ac0e,
+0xe4622ddb7ce44118, 0x91461f28057663f9, 0xa790b2d11ba5e693, 0x290c15219266ff9b, 0x2c9b5184f8d60db7, 0xfc66234923c731bf, 0x20f0ded5bf062a19, 0x2eef3e0aa7933d,
+0xd5407f14eef96458, 0xe92207823c72b0fe, 0xb628ae15cde9277b, 0x668e41ff9beb9ed0, 0x310a0240ce7892fd, 0x611b3c2a571b8c9c, 0x5c5da2feef5137ee, 0x5b965807b8eec,
+0xb2c3d9c8d1fdb89b, 0x18d722810adf74ed, 0xc91bc876f4822d48, 0xc4e64d87e03ef16f, 0x449b40cd7dd6258f, 0x9704257444033023, 0x612aa1d0cb11f880, 0x2a25a6b42a2e79,
+0x4637027272a0f80e, 0x949aa7d6b2f02361, 0x410807322506aadc, 0x725107fd98f5aaca, 0x7d515fac72e58d23, 0x6dee996850e95609, 0xec460acd4ea425ed, 0x3d501f7bd8bba5,
+0x6e88838281996b76, 0xb420a9d0b53ba1f4, 0x5fa27b9adede8de3, 0xbe42dacec57bb3d7, 0x86a575f650c4dba2, 0xb63c2e442b93ab, 0x43427f7310b79d6e, 0x18df3b6e0a6dd4,
+0x8f59e566ff990b3f, 0xd1abdbb8b0b9e2d0, 0xd093d83c97ba8453, 0xcf92c2cba225c422, 0xfe1fa4cb909b3a54, 0x212cf0f33ac1878f, 0xa64a873ae42feaa0, 0x220b0e6fbab5a4,
+0x48bb6dc8d289e3a7, 0xf40803ee8b99fb6e, 0x159d2a80570d1d49, 0x9c3b109361ea5839, 0x5e5839ecffcc0bb2, 0x31c2462b826a3374, 0x24cfaf1fae46bee3, 0x11bbb1d9b0bf6,
+0x1f3b4c9ccadb7dee, 0x1156fffa7ae42e1f, 0x5b6297c63dd1553e, 0x161ddbc27a3fa3f, 0x80477dc639d988b2, 0x47d21fdcdb12d1bf, 0xcadfe0d3ee1f8022, 0x367c9d9d603b05,
+0x3c567eb31f295c53, 0xd2101c641c769b3a, 0xdf84f181205d6e94, 0x83ca0dcf2897e1f2, 0x31f97a97107f75e8, 0x3ac796eb5ad986aa, 0xb9a056165bd9e25a, 0x2cc6f7d0b1dd29,
+0x6c954651ad0a7c82, 0x97f8051cf23d8414, 0x4e3b2398533dfe62, 0x72e1adf3b5c424c, 0xa7613394ecf6f3c7, 0x952677d05f9ada0d, 0x61784c91568d8cc2, 0x101c192526a784,
+0xe3a1232aa9eb3251, 0xdb193ca66f87c6f1, 0x53f3fb5328d8f333, 0x577791c78d17cd24, 0xa30f472be8160ab4, 0xa9f1e0e6c5f6597f, 0x848ede84610de0b6, 0x1e844b058d3bb9,
+0x6397ebf94d8b2842, 0xbed6b0027482b016, 0x2cc50823da508a79, 0xc19c31891e0b6b6c, 0x670b14fb568ba90b, 0x9f948c04727768a4, 0x689bdeea464316ad, 0x23d124d309d70f,
+0xa43d189cdbaf6d25, 0xabbeb175f733c12f, 0x298c76f4b68a6415, 0xc49a6186baf19280, 0x197d5cc08b563ef4, 0xd15499f469191b19, 0x46975a4a52b839, 0x3d4ffe2cc70aed,
+0x3ca454d7e5d83284, 0x2c226a420f353de9, 0x99a10719a15478f9, 0x5aed2ad2e9a70e32, 0xf8ff91d19660565a, 0x29422e329b2aa27e, 0x487533dead09c20a, 0x3e2536f458824e,
+0x308a67dfbe5f60e7, 0x5090b4455b05e874, 0x9291bc269ddfb657, 0x9a8ce60fcede089a, 0xd9e28ec98865972e, 0x22b5543cc445544d, 0x2220e37734baba83, 0x33fa7eb0c3d8aa,
+0x412f67539b89e67f, 0x90fe4aa4f3607dc6, 0x60ebdbd826d01a57, 0x7523a49a79727b29, 0xba3ae66063d86f14, 0x741b109360b686cb, 0x16f78dbcfd862ceb, 0x1867ee051e1e8d,
+0x531f358947bd87b2, 0x35c14d4100a0d857, 0xb1a85334e6452ea2, 0xfd6190ca06f73be1, 0x514ac7adfcc8f29a, 0x851a20b58444756f, 0xf0ea3886eab5864d, 0x2a21016ff2e47a,
+0x3020c9fe082aecbc, 0x3e411768a8adb67f, 0xc2445168f4be7316, 0xb3e6f8bb4cae2a6d, 0xfbdf2241ea5cefd6, 0xf71e1db271857b7a, 0x541ea9cbbd4fa2af, 0x8aeb234bcffe7,
+0x46a5ab1c17877403, 0xe55c21be31502ac9, 0xb6ea79cdc1777dda, 0xa8baadd69c8b070f, 0x495dd223c2fdf0d1, 0x7d2f1ce052c96f3b, 0xf1f44e294b5ee69b, 0x3197efae9774c5,
+0xe4e4b237224fdeb8, 0x7e49e49557a2c648, 0x4cc86bec3848bdfc, 0x968dbfaeff68ac4e, 0x3f93d46f097500e, 0xd9aa102eb5f4155d, 0x92e2b2e592603719, 0x36c9df83985b15,
+0x49eca986db9c4af5, 0xb7056d3a5136f6de, 0x21a4ed9de9bbcaa6, 0xd9716227667861bf, 0xafd0abe38a424e90, 0x56a89fbac8e1dad8, 0xcc4b60dac1ef5c08, 0x71ee93811b003,
+0x1c28bdf2f378a5be, 0x518df61604db5af7, 0x2cef50caf104ba41, 0x389502300f0bed41, 0x36f33ab9528b9094, 0x4d60c35fa1bed6e9, 0x902ef37ec2feb0ee, 0x13d29776b4cef5,
+0xba96b91d541daaeb, 0xd53e85756522c322, 0xa000714ad88ff1da, 0xb9dc143b598e2c1a, 0xc06ed0d8feb3b144, 0x3a65dcab1b0b9560, 0x59fbff49b44856df, 0x42a78537728a7,
+0xc5f57d86902d5774, 0x4d14a0923e99c631, 0x651327176712fb95, 0x7a4731901a37e8da, 0x77becaef5e1aed4e, 0x6121a20bdcf0ae63, 0x31cecc8ade9f5bc8, 0x1bf35ce2ccf9ef,
+0x227cc72676926d97, 0x91c9e2daae938b36, 0xd55cdbabfa40d595, 0xdbe623caa08256a7, 0x19809d912bab3f99, 0x5e4542d669c18faf, 0xc263147230e967f6, 0x1e9fbe4fdda1b4,
+0x300e7d4a6b19a304, 0x3faf13b2add12178, 0x6193fb4cc9dbd8bc, 0xf818905c7b510b7e, 0xed77097ad64f4216, 0x261b4f41c7b5616a, 0xe420f3f7bde3dea7, 0x24c79639b2b2af,
+0x97b663eac267a387, 0x1508c2cc96cd55ae, 0xe1f78e0709bbc7fb, 0x47525eaa6734154a, 0x26d06928dbd0e60, 0x440cc27a43dc68a7, 0x2191f10862dc36b5, 0xc8c92c47ec42f,
+0x8f02c210760c13ce, 0xcbf66ab1f77ef11e, 0x3b6570b6c37e3520, 0x9772722ac5a6cff8, 0x5ff35b1d600815a, 0x1f1249237168f54d, 0xcbfd1fd8279586d0, 0x3e3b98cb16f93a,
+0x80147b38f237983b, 0x6214af64c1894f7a, 0x7beb0b4f3b43acb0, 0xefbfd1b911145f5b, 0xb5e9d1387e1c2af3, 0x6f6e6f021036abf5, 0x3796f460835a2379, 0xa30ed6d1dd78b,
+0xb9eb566dcdfcf7a3, 0xf2b02ec2b27b78b0, 0xd88dbb7f7e284f84, 0xbb728ba8c3824376, 0x1a8384ab2d8ec2f9, 0xe7724051a18bfec2, 0xd9efb9c56ab2ae18, 0x2cdbf2fcf7118,
+0xaabb1338b9277f61, 0x46853915b69fde7e, 0xe613bf4ed96a2b0f, 0xedf3461a09191d17, 0x2dda589be85ff55b, 0xce74529fcb5a6cd5, 0xa421586480bf6269, 0x3874340a9ae127,
+0x4362976a1d7a07cd, 0x7cbc744c633c60d2, 0x445db53aa0e4f5b9, 0xb854bab13e0be692, 0xa83367b0ecfc5bbc, 0xffd4c13e567d2811, 0xe81b21dd6edbc8f5, 0x33ea7d6b3695a1,
+0xeb6fb0c8fdb36acb, 0x5a27e95bd1591f0, 0xe2b00d24f070f5c4, 0xe672a9209a2848bc, 0x7f20ba27b696b21f, 0xd46fbe436c12afff, 0xc3ffe3bec93084c6, 0x931a4eff0df0d,
+0xadf463af906e28c7, 0x56d50a38c61f35c6, 0xd01cdb47b1e68fc9, 0x6ebb7f2767ccee24, 0x7f8942b996f0ee1d, 0x15fd4b290510f8c9, 0x7e5b234cfbe0fa4f, 0x12a5a57db5c77,
+0x5bc5de7673852acf, 0x6f7bf4cec4206099, 0xd3d33c853a4dbed7, 0x4d0d225189a9664, 0x5e4301ed14686309, 0x14c63f1a7ee2950e, 0xd85d95ae08ea90fd, 0x28e12ace662fc,
+0x84c56a539cc6674c, 0x5506da57d37188ef, 0x8ea427b7ecabf1a7, 0xb95356548f788b, 0xbc84bcd2351104a6, 0xad6faaf9b36632be, 0x1a07773c4b7324da, 0x2a25f2b147fd62,
+0xeee58055b6496445, 0x8d2fd889bc7e8274, 0xc13e9f4de8872061, 0x5dc5af65f9f6833e, 0x54979c79f59c5587, 0xfe4844cd093da7cf, 0xac44ae2070a99ac4, 0x3b7591c652d186,
+0x4de3d867e6840e29, 0xab52ca60ac11b865, 0xc450a68cffba81cb, 0xc222bbdcf57f8d25, 0xeb7120d082740826, 0x1cbddc461647d0cd, 0xcd92d5e3b47d0d2a, 0x3b2a617c91f5e5,
+0x1145b683009e898a, 0x7e0815ca3ddf5cef, 0xa57187ab9d5ee8e7, 0x460353eb68b9ef51, 0x8879e1a53e429ffb, 0xb3b06b9320d49a3d, 0x5c4f21bba7171d36, 0x1f6f534ce0e0ef,
+0x4b643026b36c0c3c, 0xff7bd90931b3f8b5, 0xf5fe907486ccdf08, 0x7306f7cc5d563ce7, 0x45a0bc8fd54741ed, 0x8010d8951a742307, 0xe8366a38264e8ef2, 0x1f0c64cd8d490d,
+0x6deb16593afa9aa9, 0x68c60f719c6b4afd, 0x951c44da52d017cd, 0x283c44d3248aa3c8, 0xcdf10b70a6e21d65, 0xefdafefc2d34fbb6, 0x209536776d1023d, 0x38064624ee20cb,
+0xd110bad807171e65, 0xce8b7eee876e7986, 0xbadce3d280c0e7c6, 0x370d30450c2cdb46, 0x71bea785e5ddb22d, 0xd80a6ef9ae153c5b, 0x5d52e9795d900e75, 0x2e41c6f7a053e6,
+0xfa782dfdd79b68a1, 0x9565fcdb59ad7210, 0x21a22e2cfa82e15d, 0x3738b7adb19df2aa, 0x2d7452abce32f171, 0xbeb6234078387710, 0x5148ff013968acda, 0xf36af2d7b320a,
+0x904976265bcce0ce, 0x5cc478eeb1fc7085, 0x32066901e19ea8d4, 0x315ec6a1618e5859, 0x2e2a82fdab3a7a56, 0xd7d38ff8c34a939b, 0x8ab0a5e9f236ca7f, 0x2e82b37bdf1ee4,
+0x1c3f2a6f169d7940, 0xd2b1729bf6cb0f5c, 0x9a01d725dec07901, 0x59c7028937b8f629, 0x9f75ade85435260a, 0xc0ee65649361966a, 0x87481eff162f2507, 0x3de8722f64b65d,
+0x6a5ca0e1deb2a6cf, 0x30d3f457448b0078, 0x8f6eb085884a8fc7, 0xb19ef9b54d403639, 0x38ac8e93a8aeda55, 0x6a11cba76198f29f, 0x2e871c43f2b311ab, 0x1bb9f39bac28c5,
+0x229491073f433651, 0x1389b96c887fa9c7, 0x96636742aee017fe, 0x82dd817bf72268ef, 0xee787c762ad5c722, 0x4994a366df962b7b, 0x4969c630c96ba6d5, 0x3fc266f06adf49,
+0xde8c94c4c1674e8, 0x78eee8b594031a7f, 0xdf002a7be56a3902, 0xeea83318441d23b7, 0xa9c2805989951868, 0xfd4a1fb16bdf40a2, 0x39b9a7b635b9e6a9, 0x2c5af9688f0a6b,
+0x6b07ba2488880973, 0x2d187f9885c8d9f2, 0xf828d6ba1e894110, 0x21369b13d80206e0, 0x6e20c065e103ed5a, 0x9330be7c1eb52d50, 0x4165a6a53254f7ce, 0x30f48533af726e,
+0x9f4d637e4c5f1963, 0xbdfb89ca1ace7a2c, 0xc199c5e4ccb8fa94, 0x42bcc7633bf36b8e, 0x1787c728460143d, 0x76bf6facdf78758b, 0xd81d044e37092c71, 0x2e8d823b7dfa09,
+0x8f3088f5d7cbbb36, 0x2e025c63c1d8ac32, 0x3f202f31466a82e2, 0xb02f497771d0548, 0xf89d0de3eb9523aa, 0x4b7b84a44f74be49, 0x6c42c80d7cba2d70, 0x6afcc8ccc09bb,
+0x8d41984c33c97655, 0xd60edfe6162f8cc8, 0x71ac287a481624bb, 0x7ec8649a64223e1, 0x9d574869e2e2ea3c, 0x747ebd07a440b076, 0xa95a6a213f446c9f, 0x708a9731aa043,
+0xfb8afb4eb1467d2, 0x7f0383402f14bc9a, 0xe7ba3975eaa93b32, 0xfaf7ed137cf3649a, 0xb5264c24cd41c024, 0xe5810e198e0de111, 0xcee1f9cbdcd76726, 0x3eaa6a36453ceb,
+0x610facd3f6519048, 0x121fec264c014b20, 0x6d10efaa47561533, 0x2d5e05f9097c9c61, 0x74e0ee06046c7f32, 0x6b40a720fa6f6031, 0x5a249ff2cee4bb19, 0x3e7c318ca0ee9,
+0x67d562bba10f32c2, 0xef0ee743e26c8131, 0xd57206992398e833, 0x6d52033f8ea89fc8, 0xddb0e2508fc05a84, 0xea4fc2cbbff29fd2, 0xe63a5ac9da22c8c6, 0xdf2f5cdd6365f,
+0xef72c270caf07cb6, 0xfa90f3ff9b2da75a, 0xfa61d93812da76a9, 0x1d1afcfc1d9d8443, 0x1996433526b35cc0, 0xc7580397fa959b9f, 0xfc0be5ab1f3f281a, 0x18c3ef0dcd2a37,
+0xb8b137829387383b, 0x773c7e4350de8537, 0x88a031250a246ef2, 0x44416bed1b6b2536, 0xb2126f0e1224ddce, 0xdacb47066839158, 0x53f7d95949b04fa0, 0x22563224f30f57,
+0xcbe243c126c160, 0x7aca03a665c9577e, 0x5fb4c29b184fff5c, 0x9a6e8a5fe5a4b9e2, 0x8bfeb87fd6470afb, 0xd150006dd65f61ba, 0xa2410de7c7b373c, 0x33055010fa222,
+0x8ff2bef9572b78ad, 0xce48fb567ad5cc60, 0xbe70fd8107a35dc5, 0x5a691adb103c7111, 0x88cd1c5e58bcd6e3, 0xfb482e4c4e3a3bb0, 0x616f76a4133ae4b2, 0x15459a78587bdd,
+0x8e5b8e11192928be, 0xaca20b9488170a0b, 0xae5a6264faa239e0, 0x80f15c303d44640d, 0xd6f53d196e6b2265, 0xdb91faf72336019b, 0xa7a7cdd545b0c9e5, 0x2e538b960d3071,
+0x5a413c07d07063a, 0x8dd8260f466eebc9, 0xb39eb07c3b7b9ea6, 0xe4dada4e6f1c7d4a, 0x47b3459de8438046, 0xca96d69a4d028b5a, 0x249bc595d66722ba, 0x19264da3a57d45,
+0x352f8e27d284ac85, 0x4d80d668f691cbff, 0x199f1274690eade5, 0x8228186ac948ada9, 0xf2dbd1a6e04998ff, 0x2078af826bbc0ed4, 0xa859037b777750e5, 0x218b53082278a6,
+0xf3c214eb0c6e7eff, 0x9ab772468f3edd9e, 0xd37920fa5be4cc9, 0x47d36613a9bb088f, 0xc9c5446d8dd5c7dd, 0x3cc90e69bc8bb854, 0xb4fa99c0b60621ad, 0x4037606b0a7aa4,
+0x47e00d2765689e2d, 0x472067f6712f1c17, 0x6c43ebc20102dc08, 0xd3ba8054588c77e7, 0xb1a9302efecf0d26, 0xfa19ba767b972ec4, 0x902f0615b8772b1c, 0x3ffd6b04cddecc,
+0xe7ab1bd41ff9268b, 0x5aa22a6d2fd371c7, 0xb84062ba329c51b0, 0x9e92d64147ae1bd2, 0x541edad0ca90ab47, 0xe141ad7fa1f251e5, 0xe829a1cedd005119, 0x253021f3671723,
+0x2fabcaf297f5a67b, 0x289a1c14be2faf10, 0x4361af186731f02e, 0xcc96d14f8d86e095, 0xbfa360108f3a6206, 0x70cbfd0a09a82f64, 0x46af6a39371db7cc, 0x7a0b6b1898fae,
+0xf4d7a4e400d0e651, 0x2ffb437d0370cc7e, 0xbb7a0cf1fc80fa5, 0xb68bbe2dc0d66956, 0xa887dd71d6be753f, 0x1f1fe437505d99c8, 0xedb30da39d20f76e, 0x253e1d03db63e0,
+0x57fd1b2aed5a1d5f, 0x426862c84ebac8f3, 0xd2ac405e41a3f6f5, 0xe61777c5abc392c3, 0x6709b67561fa5ab1, 0xec53766b75e7d867, 0x2c577e1ed9c18d5d, 0x1ee5a43b6d861c,
+0x34a31685885a5d9b, 0xe4d2e552a60b425c, 0xed21e3f23a85e2f1, 0x6a2eb8a33fcf3c5b, 0x841735da595fda17, 0xa132e062532383a4, 0xfbe43dd917403abd, 0x2fe22ef65d66a9,
+0xdfcc9578ae71bb94, 0x2bca8005d3e96d05, 0x2ae735cd13d85516, 0xb45f0ddf8c1d89f5, 0x60177b385e5041a7, 0xf25992ddf7af7d05, 0x96705a1f2ceedbaf, 0x256d8471424b21,
+0x1e5b0d63e081aadb, 0x4d79fd482369a830, 0xb0e9f666f8f70bce, 0x36000b7fc4e57a60, 0xe517d82a77f18a97, 0x5972025b94b8f3cc, 0xeeeb8168a189bf7, 0x29e368fb93c778,
+0xd923be014bd1a85f, 0xbbad76074c66f219, 0x14e051b573a22296, 0x9c229710a7c14033, 0xd34b009a96e176b6, 0x69efbd152c115bdc, 0x9b9b90157167e4f4, 0x2b9f3c19caea65,
+0x83336521cb4edbb8, 0x3ea30adfc38cc6ea, 0xf5c2cb4169d9296a, 0x3b2b179280f19922, 0xa50e13631b0fb924, 0x6964488e15e61137, 0x2516dabb7d901377, 0x1a8db11596cbca,
+0xa4e46feb2dac879f, 0x1586023416f72df0, 0x6207dac10bade48e, 0x8617e8223183dbab, 0xf3ce1ab80b5ed73a, 0x1f5f78f451e607a1, 0x7e712f4134972ba7, 0x18cc1a46503ca0,
+0x2ed80844d52b0b6b, 0x5993248334e95201, 0x90ec222ee1dc89ab, 0xa8f57a4b3ba0d4ec, 0xdd029cd030eb4c36, 0x3ee567861eed23ac, 0xeda290a1ce3916a0, 0x7e309aee99b37,
+0x89696a891ab9f0e, 0x8149a73fdbbebfde, 0x57bef9f5c20d5a5a, 0x1da95bee2fb0cb25, 0x8b63de2d09c8003, 0x158a2f6898b7ffff, 0x628923f2a4482010, 0x38c68856563791,
+0x28c882b8264d872, 0x6ff915ddb1cb5722, 0x1cb608aa234cffd3, 0xd71902b88fd98819, 0xb0b2e330de4e2c36, 0x63b7e5438ed71607, 0xf5cf7da99181e503, 0x38c52bbd811e66,
+0x260a3331883ac23, 0xb5b7020a9f804d56, 0x54f32b716589af70, 0x2bf2550d98793ef6, 0x6935435e9807407a, 0xc4841dc8aecb9d1b, 0x1872e21b6a5ebfdb, 0x38dcdf30644fd6,
+0xc6c7038e87a0d625, 0x71f7ca2deafb27c4, 0x5fca13c3775d0648, 0x47055c0907202cf7, 0x97ce79997607797a, 0x904885c2383c90a9, 0x888f7b38c129c462, 0x32ed780a799b7f,
+0x7cc70b57c99102e, 0x16dbca545e7e4a86, 0xc47334a0658bf1e4, 0x3d51a6c59e3df04c, 0x7c8fe51e99525675, 0x793cc5708a444aca, 0xd0c9ecb8f797d1c6, 0x246a1b5c79687c,
+0xa30a89dd59a9a436, 0x7f5ec2f6de532c2c, 0x24dc74863d09b843, 0x668ad878757a2c33, 0xcaba9458efa5caff, 0x326b46cc3abc808, 0x212084ead0f1dfd1, 0x8160b9db4cc73,
+0xf03acaf21ae429e, 0xc7a345a822abf8b2, 0x96cbf183cf504ee4, 0x3f9599f28b9869e3, 0xd7753f5c6fdf711a, 0xcd42944c783adde3, 0x6ef6ccc7219573aa, 0x2923c996d74682,
+0xd50b355e4f657f8e, 0xcacff515c1c119f, 0x236aae6ce03aeb86, 0xf070432698f4c3ba, 0xde0d3d33c8568cd7, 0x914f39d61616d1fa, 0x335651c587dfa708, 0x37f89c9618d87c,
+0x653d24d01d0d7125, 0x85538447919d1577, 0x415cf892d89a399a, 0xe1359fc1bef16d33, 0x6cce257a953712ee, 0x5547887ee615c0b0, 0x46009c9a259eacec, 0x3335f2494cb247,
+0x8ccc8b3a4e36d000, 0x19a7374a571b72dd, 0x3be0d80864e0fa1, 0xa2253b6910f8c610, 0xf132d69a523aac85, 0xd95f0764508cc041, 0x8b8d596c550b6b43, 0xbb545c961f8ed,
+0x1b7bde7edfbeff32, 0x1f35ecc75e568f64, 0x250c05b9e52a6fc1, 0xc8dcbc531e85b122, 0x2269a4d4254e1589, 0x636eeab0b09f2aeb, 0xa71d928500a4b7da, 0x4025e7621c5522,
+0x1950a5c4ced11eb8, 0xac703b8ef41737e6, 0x5be04c5ee51d291, 0xf375559862459a40, 0xf6dfb51e77ff2c7d, 0xce2b16483e3eba2d, 0x69751c869fd47fdd, 0x199376db8f2b62,
+0x1ca4d402a76929b1, 0xa9785795be9ce42e, 0x1dadf4355dc4d9f1, 0x4b2dabe809843120, 0xcf7ec4fce9b5c307, 0x73875c9d92f03c84, 0x34109184bb501176, 0x2c142ff0ad7355,
+0xa4af85d5b1f4eb4, 0x29d1ffa38dc69a2e, 0x899d7505ac4eaaf3, 0xb04134c68aad6cb0, 0xd1b89170b02790e1, 0xdd3618eab7a0937e, 0xef6b3c8c899a6f51, 0x249f73d584325d,
+0xc5669653dd76e497, 0x97746540fd387686, 0xc0d3e8260dfe20d5, 0x5a50cfb438ca5cc1, 0x2e63a6c68a1993a7, 0xa913326e0b1035fc, 0xfc0bd28827bc5a04, 0x2d931ae8607c25,
+0xd71242888a1becce, 0x4dc08ec73ad5f533, 0x6a40294cca6d21f9, 0x947b6c401a5dbc2c, 0xa2fba388e577716f, 0x491b689194cfaecd, 0xa678b88a62b2ad1f, 0x2b2454a1adde5b,
+0xbe2576c74ae0af14, 0xb250f7ff30e3d44c, 0x72eec5b39df89ce0, 0xd244a59dc57f577d, 0x552e76f622ecd869, 0x50c4d1b31e33ca82, 0x41b36981e698bbc5, 0x9efd45ba8f0b,
+0xd01920b9d1234dfa, 0x78c01e0e7d62d22d, 0xe099932b4a6c5fcf, 0x2156104b51eec793, 0xa2be72b693a01be3, 0xa939b606c29856fe, 0xa2d0facfb1bca4a7, 0xcad4eba9964e8,
+0xcda37484dc650dbc, 0x7eaafb06f70eace, 0x9402f442e5b3e0ea, 0xd02e45c9b4b607aa, 0x61adbd595c9beac7, 0xf4cce470aab3b32b, 0x5ed0db030a4951cb, 0x50a24700fab21,
+0xd37279f407ba59e2, 0x7b89de565cf73934, 0x292df2659971c375, 0xa29a705808791bcb, 0xe440261e54b0f282, 0x489f95365d4ab37a, 0x68e8d0cd6bb0da44, 0x1c9acfa1885d4c,
+0x16095380daf411d1, 0xc2876a835c3f2681, 0x67805afc707cf74e, 0xbd8456eb7cdfad47, 0xfec60b5533f084ad, 0x8713988d7ac12aaf, 0x47e8118b0985b92f, 0x37b73354b4476a,
+0xf181031f0728f336, 0x10d2e072d243d962, 0xe5c55717a671d3a3, 0xe099a881d79b93f3, 0x2e37e0aee05e2e03, 0x5e6587813fe360b1, 0x776cc9da8646121c, 0x232bf24fbb6a7b,
+0xc86388dee45c6951, 0xef5f60bacc335dd8, 0xbbc507c087c2d9f9, 0x7686e6538253975e, 0xde8f5a018f8a540d, 0x6e3ace8611e5dd4a, 0xff00ac7d50138898, 0x385963f4ddb5cb,
+0xf39641ebe9cfa164, 0x7514995b6db315df, 0x99257f94ec274be7, 0x6334fb11fe7b777b, 0xb8281d8e83371e39, 0x7f032dd6f418940a, 0xb48761df11670354, 0x30305fb5b89e7d,
+0x66771103bbff30b0, 0xd5de9178d34da9b7, 0xcda1da4aead53b3b, 0x94c5933bb438eacd, 0xa978321c656c742d, 0xac6de0b3b32c582f, 0xac820a1c8f7b9859, 0x21b8dfbb5ef9aa,
+0xfc0a9a99b9d82eff, 0xafa8806a5aa6d92b, 0xab41f47ee2c40389, 0x59efc52b69dc5a6e, 0x46b9bae10063b90b, 0x1d0c17b4dd4d0d43, 0x300723034c997ac5, 0x1d4dcbb6b190c7,
+0x93c2e00446460476, 0xa8fb8eaf40cd20ce, 0xde38ffff29aefef8, 0xf80ba4bde6c5a810, 0xf56272d2530c3b44, 0x4ad6528d63693a3c, 0x583fd852c65ef388, 0x39e3d063da00b,
+0x90c5cdc878858e3e, 0x496f6ce2737428b4, 0x16c30698b701140c, 0xb8bbc43d5f4e6877, 0xcc6f84c4268a635, 0xf0c1f9f4341fed93, 0x1661476a80c1fe4f, 0x402b53fdcb5a2b,
+0x40d055c97110ef18, 0x59d7c97c028dce61, 0x8b07038a4a8c4983, 0xbc5a074763e1659, 0x6543f49435c47e4a, 0x7a0e5fff00011ed3, 0x5b58e83da879cbc9, 0x1037d0c3bc1386,
+0xabde26ac9ce78a26, 0x524c273e23d7220f, 0xb019dbc8caed1eea, 0xc8d6d24ab088a645, 0x63088b2e5a3dd088, 0x4c040c3ab9dc6a84, 0xa9739ee1aad3683d, 0x13052db007fd39,
+0xaa2dec4cb49f90ef, 0xe799e5aba604e619, 0x81a279df40c288c5, 0x58e33aebb193df6c, 0x597306d91d618af8, 0xbb97c0c09a863efa, 0xc1236c3ade5c4e13, 0xf36166e819c0f,
+0xdad06688b7d06d4d, 0x613d107b8117fc92, 0xa6f68754ca542d20, 0xf4ba729bf7748f7b, 0x1ef1ead137873cc6, 0x8d17dc6304a75e04, 0x233795958345373d, 0x9fe24e75687d6,
+0x6d73fd765f0a4df3, 0xf0a95db330c46409, 0xb8ae9334c3698539, 0x8610e9f21c8dc0dd, 0xdb2b33ebd0c58110, 0xfc89fc4228e3a1b1, 0x310d9a8b63aef885, 0x15d6ba5f62b6b1,
+0xfdbb128f34b1199a, 0xdaf9815fdb16ab29, 0xb67cc1c571854764, 0xbc6965c1b2539af5, 0xf2d4f85f44653419, 0xb3b979f0076360ab, 0x94ad39a0ba1ed086, 0x2d3107f04bb1e9,
+0x6540145c27106d48, 0x79f947ffc042ed02, 0xdc526d4dcfbd5702, 0x725e0626b02f8054, 0x5d9bc72decff0598, 0xc8dc843e4834e448, 0x4d0cf46a2fc6cade, 0x3a5c87c53aabd0,
+0xda41ba7d0bdca452, 0x84917c8ad0783fef, 0x3c100a7b27fe8ad5, 0x84e649e8869715e3, 0x34b78fa8cd745bb6, 0xff74542ea8fc7855, 0xc33506eadb6ca614, 0x38316892d605e2,
+0xeeab9854da3555e3, 0x56947cc280b60707, 0x7923841d653b468, 0xe413d57d9433cd65, 0x3973673070bf4f45, 0xf37d14463211f4cc, 0xfab0a20e90fd4808, 0x166da212eaecd7,
+0x38dc9fdc9a61b710, 0x5c5c7d80a3ce51a, 0x7c2242d83d8e6825, 0x26fbaa238dca776c, 0xaba019c2b040e09, 0xe8a32e9933dcba33, 0xa2e2d8df14ea0d, 0x1e2831504c63b7,
+0x8bc68a026456ab18, 0x8c07855568d6a0a5, 0xbf36b4f119f3a354, 0x43aee8ef4ebb808f, 0xb5bdf25a1a8da3ca, 0x62bfc541bad3dda7, 0xd5530191092ed933, 0x1e7dab1bc1ebfe,
+0x5933b2b13fec4a18, 0xec3dcd33c845f91, 0xbc642dcf0a68e5d3, 0xf6e728b3ca84d6e5, 0x2dc7db076c0b22e0, 0xc5a77b071de52716, 0xbc2be438376d0752, 0x2504eb82f16749,
+0x2361c2902736a285, 0x1045d85b79814a3e, 0x8d44336b374ad176, 0xc38966f233fbb8f1, 0x6d0e117195fbe6ac, 0xe4bd12e02964a476, 0xc70f850a68485a6a, 0x19de9ae6490271,
+0xda4e6dc8102a9484, 0x789ae56d24c81803, 0xdff5ab146e8c761c, 0xbc96e61665656aa5, 0xc6e98751db1b79c1, 0x4113bee1de5b1804, 0xd5704983d4515847, 0x2375b5dc614e6e,
+0xd4a7ccfd2dfcc3a3, 0x32f17e73fe293c93, 0xa5854adad820b75e, 0xef4da5e0e00d0e4d, 0x9bcd1b96da886aa4, 0x2a0ad08d6911213d, 0x4d13896c183fcfd3, 0x2cc65d1dbee16d,
+0xf9a212b13a008e15, 0x52b586d0ad7e1dc8, 0xea93e6be3ca83633, 0x5a6cdf35f4b2c08f, 0xcc443fb805f661f0, 0xecbf0a40f26b8784, 0xd06984da3ae75435, 0x1fc74668ace320,
+0x63d6f2d2f7c40de4, 0x6e9705a94540114b, 0xab308e3fd839199d, 0x62de1e5ff753442f, 0xa0c83118549c23cf, 0x5b044c80191dcb12, 0xf11efb0b319a39b5, 0x3b0390d6a2b228,
+0x16881638b078e000, 0xd37ac2d1f296d1c2, 0x225c782fcb1f412d, 0x28b1b58fd75d2346, 0xedfd07fca442a057, 0x457afb14da7f61ef, 0x29d865966011e3a0, 0x3b4a0fbb15ea8e,
+0x2a6bfc004979084e, 0xdb07ddb747190010, 0xcad7d31f93caef27, 0x42cd3851f469da92, 0xa1b615bd1d0afe8f, 0x5f807b0cf02f7a7b, 0x5245fe17c415a716, 0x15a8bbc46e6bdc,
+0xa18cd8277fd92957, 0x865476e67fafe513, 0x4acdffd2fd1dc806, 0xf4462fd16b04c613, 0x4cbbbf5f3105ef37, 0xebac9cac9144bf79, 0x596d30681e38006, 0x3ff42bc723c574,
+0xa5d91283445bfb0c, 0x9f7a910b4ad209c6, 0x8739453ce217bf2f, 0xfb897914d56237d5, 0x3b59374e19b8f1b0, 0x3faa8e5250eb7663, 0xbc312f3142717570, 0x134b54607bab4,
+0xadb35222da8e4201, 0xb0a9169fc8237cd2, 0x80a9c5862ff28faf, 0xbd8d3e034c532161, 0x5efaadace0ffddae, 0x78769f3de70627e, 0x7e315a0feb033c81, 0x24ad6bb125eb88,
+0x48ff8be02c5577a0, 0xab90bda1ae3ac646, 0x93e9d3e541e021b0, 0xa90939c432c68a17, 0xc53215afcc22459c, 0x3ea480ca33c8b9d9, 0x88c86c5d0d00dd5f, 0x1ac580fac43288,
+0x6fb32853bc740aa6, 0xbaf29ddc043bf783, 0x5ea3c1e39043e3f8, 0x5f48c52b31f22a82, 0xbb9fbd6e163af4e7, 0xc7062d756e888e22, 0x1b5de096ff6299c6, 0x2df2f56101cb87,
+0xcc239a88b378e311, 0xa5676fea550e9e26, 0xb2a9ff7346acbc6a, 0x7ca75996d3267e4c, 0x9af9fd0522520f40, 0x4436131368dca0ce, 0xe4ae8301ea16cfda, 0x143c459ea31133,
+0x6dc136400bb63b19, 0xedaa1fb92d41437c, 0x88f85897a0447144, 0xefe939ec9448f523, 0x7d63c692e6963dfa, 0x54b8f72591cf74e, 0xcd2d55474925a50f, 0x27a100a44526a4,
+0x44b17c73bb573a08, 0xf7691716b0bfb168, 0xb946d5585380f20b, 0x79b83688736cf2c7, 0xed2847a82d5f82a4, 0xef10ac19a7f36cb0, 0xb8580e5a59ef4006, 0x3c9874e2a7fed3,
+0x1068a70800bb519d, 0x4791730e5c969440, 0xf7bfbf9f7dc4d87f, 0x23e361f6b0886049, 0x9611efae10cd56ed, 0xef8172b08e56b4b0, 0xdd01e2c733f64c5f, 0x1bb922a24866b7,
+0x6e5775b6af8c4aa0, 0x7b3e823e3bbe7889, 0x5d632fe6fd5be1ce, 0x146f52ab3af3089b, 0xeb1da23ec57b01af, 0x361db42cac493636, 0x8d861594ef57e93, 0x14f667587582c1,
+0x1d54be3dba484f7b, 0xd56198b89c2670f3, 0x331b67fc108c51b9, 0xd7af5c76543eb7fc, 0x6f39d7a0e1bd63af, 0xfc8c73df2c073cb5, 0x8489e91f7286d846, 0x366ce22a24124c,
+0xe4e62fd54d326e4f, 0x6920766e9a0a5250, 0xb18113f347984b36, 0xa556a6e80227a8da, 0xe6f40e13b56d73d4, 0xd5bf152bdc402c, 0xfc4cc212b9500e60, 0x348bd51c655d6b,
+0x2ed5987c1fb38256, 0x979174cdb81a1be6, 0xd564684e9967d401, 0xf2a32b48e637d402, 0x47b16301f50ab5e3, 0x77f96b3e0e726bfb, 0x7b788940b1bea230, 0x31eae4a11d48ec,
+0x9ec44c48096a9e49, 0x8ff9d5dda5d3b21e, 0x2e707ba6ce55e33f, 0x4d806e39fef17f2c, 0x4358f01045ddfc6d, 0x245df5f8ddaf82f4, 0x11595dab42826f0, 0x375c0ebbd52f8,
+0x67b41044cf819d7d, 0x5e61c756d8d73bf6, 0xa544cb72379cf8ff, 0x2c706e83c571901b, 0x46a6c271a81e8bbe, 0x5bce949ef1cff6e0, 0xfc6d7bd85ef01d27, 0x3ef483a898062f,
+0xee6085532d9fd8f1, 0x1a96267eacf8ea6, 0x47e590c4545657f3, 0x172f2315586a023d, 0x7648d06f274bb895, 0xea57eb5445986d68, 0x52e7be743b7137de, 0x37c68c33ccd1e9,
+0x191dbf19ed24cc61, 0xbca68b1706a4fe1b, 0x383a026e0168670e, 0xa1aa7e26d6d043b0, 0x43af2b64052b18b2, 0x3a838d24a820e4d6, 0xeb592fdcabaed0d4, 0x2f419e98038e45,
+0xbddbfe015ff02d2f, 0x904f5ea742bd9400, 0xc5f03b12d1675686, 0x974b1758a475190f, 0x70758d3e60f627f0, 0xcbb040f518b86b26, 0x5e602a00aa88c9a5, 0xf752bc458d8a4,
+0xa9e9d3d963d1d125, 0x3fa6ff6a66330a04, 0xc634a9617b23fb76, 0x3a9a805a2c6fb687, 0xd53d0354750de450, 0x69754a7a078e8e76, 0x753a39582c4c41d3, 0x1ddb395dd78049,
+0x1922703aca54e99a, 0x59f06cb509ce597a, 0x494dc713e0549b25, 0x47fd4ab976297302, 0x8e1eb8ced19a0db3, 0x91c3cb720c37df6c, 0x2a44e32eef44e82c, 0x1861a2fcd9bbed,
+0xb4066cb7b4b88b8c, 0x9d97ed679f35cd52, 0x1f0cb9fc687f2ca3, 0xbae794a6754ea9ee, 0xf6b64ae714b9bde, 0x5e1ff9e9046a459d, 0x4ceb06d0336293a2, 0x137e9887fb6ff2,
+0xd9c79bd23f8a46f6, 0x816583bed14b8b0c, 0x63d1852e08680517, 0x3e986b7aa80ff734, 0x25a2b2691403b16e, 0xe522835bb3c67126, 0x887c6b52b52f411, 0x32024c1521d90d,
+0x8d4a58beea249f10, 0xd455287d2e6fab2, 0x9a490c378fa4ff17, 0xb5d2a88b7d701a09, 0x6bca4b274d2871c8, 0x86380f6d59d1b77c, 0x8b34a2eab9608ba6, 0x3fa22583554cdf,
+0xf865b2c73638025c, 0x6285405d12e0e53f, 0x24fcc546f03a5abd, 0x39e9abb5f9719c94, 0x8db1d4d28429c7a1, 0xb575fad7b1d09221, 0x928ccff7faa41f75, 0x1e7ca141da61a9,
+0x66a96f375cf7b09a, 0xa47528b4ff4b9d02, 0xd26b8480ffc591cf, 0x6c4d4a4e97c825e, 0xc5ddcd03ed04d9f8, 0x39fbd1cc22d93933, 0xd7b574615fd95f3c, 0x1a92b223369c4f,
+0x43017f241f3fa832, 0x153ba5242e302890, 0x4003639c730ac5, 0x3a10b440244a4018, 0x835c837afa290d7a, 0x51c9ba8d5de63414, 0x306ce784f5818ea3, 0x2514aa4bb74f85,
+0x3cd7ab0489054bd, 0x9a9aad0c325af09f, 0x1a3e4fd790ffc8b9, 0xe2b91e04c6d95ff3, 0x8194692a64ef67f0, 0x130f88a95b00530, 0x22d937dc62ebeae6, 0x6b8707e13706d,
+0xa496c89225100dc2, 0x5de0cd8c381d7d6, 0x6ce6ef42062bfc9d, 0xac3aea5ec7993f20, 0xd35e9a47855ec0ad, 0xf89205788babb962, 0xcb5bf5348a7d50bd, 0x34f5e6cf1e1e9a,
+0x8309558638ce444, 0x2da57988c8e871d4, 0xcd1adafb805f489b, 0xb986e4ed08049bff, 0x51908e7ba73c9038, 0x8fd68ea810b1a896, 0x40a259e3898574f3, 0x18e8d21fdc42b8,
+0x4443b5bab6ea0995, 0xadd6f85aeecb6c1e, 0x849e52677615e462, 0x5b7f1785c216ebbb, 0xc2be9417b655a0d9, 0x9551f0d7726731e4, 0x3e35a44a5cd5c51d, 0x388b1b14a99333,
+0x2700e2d879837cf6, 0x23b0a97161ddd07b, 0x8ad01a361a205be7, 0x6053a7cc9c96d011, 0x2473b7e18a24b441, 0x67c1814a814a5bae, 0x37b1d742b1313b29, 0x4e5f573ac86dd,
+0xa738fecc94a7c8c0, 0xe23e2c8eab9ce6e1, 0x76e88a3dc0eac424, 0x554340dc66f1f8da, 0xfdaf846658ec8e0f, 0x9667ba5d11af45a7, 0xef758629702dd9a7, 0x2214f31b98adb7,
+0x9081025983e721df, 0xb6383bb58a651a6, 0x72c344697fd892b9, 0x7ca432c6ecba618f, 0x25eb096263cfc1b8, 0xb4be20389b597d19, 0x925a36feb12afd76, 0x37bf89830b390f,
+0x3e55295f12ec49d2, 0x6590f3ad607d3670, 0x5297803a08fc6774, 0xd52f002ea48c2b04, 0xbaec74ba8d3da91d, 0x7b1742bc5b2628e4, 0x47f5650b4b19c6b3, 0x392bd193a4622d,
+0x781218f91e610758, 0x47dc3ca4cc6a62a6, 0xa89ba55609cd1d84, 0x648be75173de21c3, 0x500700d7282b46d9, 0xc779b68ca5e72f88, 0x8251f3e8f326eb96, 0x1e298fdfbbc47c,
+0x1a3f969a38246964, 0x820cdf6d0f105137, 0xd6de9642876ba969, 0x70d888193df16b41, 0x54224ec707f400b4, 0xcc992b8c84c9b393, 0x90d9b2addf0d8d61, 0x33f557a76cf774,
+0x1858c84f3bcae4ff, 0x834350d3ef4151cd, 0xee7f281fd973f490, 0xdb284913adec99bc, 0x27bb6162514f5d92, 0xadad5b445cb9ae96, 0xd8da42f146300153, 0x2ee3e315631a53,
+0x780c1bf3f1a602f8, 0xb874a4b2654e2476, 0x166d37e3725fa67a, 0xdac780f203fe9137, 0xda801bbbf1e6b47a, 0xdaa6f0e9763ec71, 0x697bc8eb50dd0bcf, 0x2849995b84025d,
+0x413651f0e50f5d5b, 0x4d15d7b490c648af, 0x8303d50f756a64b0, 0xcb8ac0b4144d3c1f, 0x9903baffa6ae4d3d, 0xd1fac82099e5ef2a, 0xbf555ffe27b0fce7, 0x89c75ba4192ce,
+0xe495ddc7134e69fc, 0x9f7471b6c84f8240, 0xab845db57b180798, 0x6f3948fd8363ad76, 0x34196b67730aa6f4, 0x780657343b4123ee, 0x1664a7cbc17e106e, 0x33197fa7607a69,
+0x931c498ee246e36a, 0xa562bc91c0ba5811, 0xea69f17e55ffde07, 0xbbd5fe4fd74ea029, 0xd2da93bc9d1fc224, 0x988a1e03c00e20db, 0x52e031bd1a0f8df7, 0x2558a4fb090b66,
+0xc9c4a184631aae29, 0xe8cf9fe5ad8de681, 0xd5b3e82f1dec3424, 0x1e8cdb98166cba61, 0x9289db5f8f75028b, 0xfe097867890e1783, 0x28002a00d59b1b63, 0x32170a4c13bd37,
+0xdd5903cf39007aa5, 0x6784a75cd760d039, 0x15a15198e912a089, 0x10fb9d76f659376b, 0x164676f24ca19c26, 0x6a22937ab1d1f1f6, 0x7a78336f9e274c8e, 0x2c13f59391c3ae,
+0xf816b72768d79aac, 0x7ef54640bf757a2a, 0x90d987d75b19122e, 0x91d29d162c375db, 0x8f8a682ba4616e98, 0xd1d18a46e40a1313, 0x5180a63a461d0bb8, 0xa0f0949d309da,
+0x6721bf1dd6045e7f, 0x75222f573af594ad, 0xb8a683a27b1184b0, 0xce4e5be22a05d52f, 0x26ab54aa148f5aaa, 0xce97d1bd29caef1a, 0x747356ce708ccea5, 0x13659fb6ea5644,
+0x4d8df6eb3967f4ca, 0x7341a36b11d2b2ff, 0x94d1b7daffbfd09d, 0x9131b68603dabd9e, 0xdbff1077b71871b0, 0x1f6d829b34f83b8c, 0x21935ce67cf109d4, 0x1213b9fb186956,
+0xa3c4e9cb02e78540, 0xfba9ecf196939bba, 0xf6789ce9a763d664, 0xb848a9e949ce0bfe, 0xc03ba688a9cdb9bd, 0x57e563612dbfba1a, 0xfa5e85324128c283, 0x2f4308c373d4a4,
+0x82f9819a19fd7c40, 0xc82c78ff0b933392, 0x93a15a41a8dcd5b, 0xab7d35dc9dffb315, 0x49b81d9ae22def9d, 0x47abbe97746220f0, 0xd9d2c45883fdd9b, 0x293af4dac11a8d,
+0x4c9bed9c15b12799, 0x57c32c3ea6adce66, 0xc664186d135a993c, 0xe24933c871d4b2f7, 0x4f3784f5105a7f57, 0xe56e65c9caac6ed4, 0xa7e2dcf0bd8ae92e, 0x265da944234e34,
+0x1bdd13a22721fe40, 0x7b85cb8176440602, 0xf958516a41790284, 0x38d7fca88958ec55, 0x7be7fe47c128e6f4, 0x7defdb6f44f88f6f, 0xdec6b99e27672814, 0x16b39fc7b6347c,
+0x7ec5d34c740ede3a, 0x4e62659f99346f7d, 0x7912b77589de9fa4, 0x10a32552c7398ccf, 0x15f1c3e2117e2c, 0x2a82687887681996, 0x2c6c0acbc70c5768, 0x19bfb34ed46d7e,
+0xedba519d1221993e, 0x318f178a6a91b9c5, 0x4e95c985ffd29e9c, 0xb19d7df2cef73ce7, 0x4b941928dc2ab576, 0x13c608da8dd5d422, 0x9e744058df420f9f, 0x713c7b52ea53d,
+0x16bde793f68e8ac2, 0x5895ada0cc2513c2, 0xcf2eff0c8e12a468, 0xcf65d58ccec858ea, 0x3bb788d5cdb09296, 0x35f533108cf29feb, 0x8e600f78bda3a117, 0x13d986ab4b0823,
+0x978324bbb50f016b, 0x59ee3fe2234d2efd, 0xc520e1d860a738e1, 0x542a2764f317ef9, 0xa4371441a845e18e, 0xa6c88ab76666ac78, 0xb57e8ed1aa2bfb6e, 0x19c0a2462965c6,
+0xbcb2a13a0f9c17b9, 0xfaa5586385bf491, 0x9b6622cf158b93de, 0xc7e46339c787d584, 0xf45b9f6f83eec426, 0xf2234df524c6e2a2, 0xde2a830892eb0835, 0x6b26198ced6f1,
+0x34e1a638f3bf066a, 0x3bbd2cbfc3c584e6, 0x1bb7bf30308c22d9, 0x2c68ee8f6714504e, 0xd43f895d5b429c81, 0xdef7ca708497589, 0xc8bc964561614f25, 0x428c4d29945b,
+0xb3df193e5c0b9143, 0x9aa1ca40cfecbbad, 0x1ac924b9aa80a8e1, 0x4a6bd5dbed41bbcc, 0x29e418f177289864, 0x8caa1c17187b4131, 0x4aa2403209743d40, 0x2d00a0ceb40956,
+0xbf73a1ee660e9a4a, 0x9633ddb6d5c845f9, 0xaea5cac4751a9ac5, 0x25f8b48cf38b5a48, 0xe552c97db9032163, 0x460acc725f1192d, 0x20479f4b5515b69a, 0x942b92948a7b6,
+0x6f5288318d3fa7df, 0x9fc5bbf37895ca1d, 0x14bafab3f01d29e6, 0x80a8f4df9e0dc6b7, 0x5cb4ace9973517a2, 0xa19181903a4e1195, 0x551ff39cddd018bc, 0x719b7040a5d8,
+0xa7cb7d6870932756, 0x1ef089933c4c982e, 0xdbbbe7ee5c29f80c, 0x32c244e0774f5169, 0xac6a8c776e4cc1c8, 0x7d6e6b0561820568, 0x3059bc5e4852c1b2, 0x21c4f8b600ba66,
+0x9285c7a35dc5fcf2, 0xed9e5721e4922e2f, 0x9e177e9730463fbc, 0x69912c0b00e11148, 0x7485f8de78b2b8f, 0xa7e6ebcb2ed297b9, 0xd4557abe5ea8f830, 0x2e14b14f8222c3,
+0x3542204d8edd4067, 0x846a4d6218cbe798, 0x34946492f1a0c317, 0xd9c5aafac62153cf, 0x6a4518684a3157b1, 0x79a12b267c64c643, 0xf74b0e371359f981, 0x2b80d905a1cfb,
+0xc1d609aad73891b, 0x202e48ec3b0e25eb, 0x3dac91c5d9eefa0e, 0xc2c30a7592d3fb01, 0x287d1b76801730b6, 0x99db0eb6f7790ad4, 0x10b55cc33c3a3d60, 0x108497dc3082f6,
+0x4edf25466c3fb9be, 0x493c682f98334f93, 0xd3267df54fabf5dc, 0xb77d9ba75f2257c9, 0x91666cd84b0ed0eb, 0xa58603c5403d5674, 0x9e975270ce6a85ea, 0x214e2c76a043c1,
+0xa54a4b293c3bbac0, 0x420b0c065f8628f5, 0x99afb221a305ffbe, 0x81028fbcbfe6fd79, 0xdf9a451020dbf9b4, 0x3090bc102cc23480, 0xb608cb096534a8c8, 0xd7682772f80b4,
+0x5ce5adde455e57bd, 0x10fceb927edccb13, 0x5c49a677a9ef29d6, 0x3bc08759ac777bdf, 0x4e47830a9193e601, 0x5dc52ee11164f45e, 0x52998f4705ec2c29, 0x10b4a0f20cc65a,
+0x734d81f8f6a5697b, 0x75c1f78b14cb571f, 0x734a108fd8c5afe4, 0x5f0cc40276ecec1d, 0x40bb9dbd3df5ab9b, 0x17da85f828c31dfa, 0xa17c97d69c42aba4, 0xcab2c1c816d76,
+0x772642112ad41bae, 0x51dcf2ec1c4f6e02, 0x73903a501fa7bef3, 0x829bc2eca1b1df9e, 0x7e9795e8e04be554, 0x39db0b8902258687, 0xa6b9f628784ad60d, 0x1c6258e34f180a,
+0xd66c7bbeb3573789, 0x52d7f119b4ce536d, 0x1c66216748a2f59d, 0x57b7f0d1e83b977d, 0x2ac32c1869d3dd5, 0x9d5a21bf5d299007, 0x25443dda5550fdcb, 0x231537b7ac2ec5,
+0x779fd95c7bc7894f, 0x66e936754154f5c2, 0x66d4f85f4ecdfba2, 0x29fec9b9a1359e20, 0x9b62367aee2e7e2f, 0x2c35d329b719380d, 0x6c887f1e492f3b5, 0x1db447ad08f670,
+0x89612305388a12a1, 0x680e70515c37c815, 0xc1bac92fc5812ce6, 0xf0d8a1ff2be6af0a, 0x690b43d7f0a5ca5b, 0x90a556e14952556a, 0xcf9d846e675a7bea, 0x2ff17e0a2d46f3,
+0x753476652ee93566, 0x7dc497b8b2a837f8, 0x87d6c243223614e4, 0xdffb533eb67c1471, 0x21ecf8ccea26bf, 0xa7b9f59a1b8bff20, 0x18fb2bc34bccb2f4, 0x3819230cb4f7e1,
+0x1ffa427f97355771, 0x7020651def8bc4e7, 0x8e566f0018a3a8d, 0x9fc1532f0573571d, 0x66f8b1b274f7b4a2, 0x7f8b0781a7b40036, 0x8b37dfc2e1b42162, 0x255eb9e4d79e54,
+0xcff4d4e561889133, 0x350effc1834247c4, 0x6de300d921eeaa74, 0x3c0917c02725b3e2, 0x3ec0635fa2e98dca, 0xfb9ea1cca59e12a4, 0x2fef560e324cb0f4, 0x83c7a520c7a7e,
+0xb68524715bbd982c, 0x8f07e846a604ef80, 0xbeffc38a3fb576ae, 0xd53f2cbda39e14bf, 0xe3f0b0f40588f578, 0xaf0c0cc3d32a1073, 0x59f8c37c8363df16, 0x96afaf6c05fbd,
+0x6d2bd3176ae66310, 0xf6d542b058dfe0aa, 0x8e99d50b7b1fb0c1, 0x2f1c7400b6ffc4d6, 0x96d9a14fd95b8752, 0x6584fcdb2687aa5a, 0x2fc1fe3bfbd25fe7, 0xb72028ec255ed,
+0x8c6b13299044bff6, 0xda9b959684947c11, 0xf0f9a86f6551452, 0x9b8544c382971643, 0x76526ea63445cf7e, 0x5cef521ef5cfcedf, 0x77b6503390800a7, 0x17e6a7a709e7d4,
+0x27445ff06da0e68d, 0x50e2f388b6efdeaf, 0xff3f9678d41725f, 0x4dfc0e69fde2b4ff, 0xe54a658367ffd8e1, 0x97a2ea071f8a0502, 0xf954a8e0c6ed4413, 0x31334f24c0113e,
+0xdfe9bf9024b110e8, 0x550af515ff05fe78, 0x60553df0659f0ce0, 0x99bacca0924edba3, 0x91f6c6857991dfa4, 0x98f6ce0bfa2c9bfc, 0x2b96031d6aa438f3, 0x2645bd06721408,
+0xf7c9779df9d179eb, 0x1760c6d738d4391c, 0x38c261e1c0740535, 0xcde1f748b2924dc1, 0x1a14f917b726e9e8, 0x22774481ecac477f, 0x4a47b976fac49f04, 0x407ac9bb4cc71,
+0xea9a7ab6ba020d7a, 0xa2898c8aca48f60, 0xc5d6aa520cfe74b7, 0x11f04fc2b3f7805f, 0xff30119a501f90a0, 0xc87953ce30bc8150, 0xedea3b5771f2925f, 0x3f760f67059477,
+0x31e0e7aa650fff4a, 0x88873ff64927b118, 0x6b221cd76a1f4a75, 0xd3aa529c92971e27, 0x533605db29a914ec, 0x68f90069c8889a6, 0x750ba797e44a561c, 0x15b5c7f35942aa,
+0x140431ab4fec0f0a, 0x61371ac94d79cbd4, 0x1a8f7a5f023804b9, 0xf4dc8f3b03c3dc45, 0x984111fe14fdad76, 0xaa48c9aeb0284b66, 0x3ccba7d3d9e4d297, 0x12bf766cdee206,
+0x4e0796a70dc35f90, 0x8b07b1303dd4583d, 0x22716d9101fadb88, 0xccbf32f4563077d, 0xb14b4dcb2ddf1438, 0xf1bdba06e4618402, 0x88d2b7c9a5f6596e, 0x2bc719353b7b47,
+0xd174c0735c8eebf9, 0xeddfdc5f4c9b4476, 0xcbb78db3fc41e2bf, 0x92785b85d187f8b2, 0x8ae26b0b13238ce3, 0xe5f2021c244b0a9c, 0xbf6aa6e148d93d48, 0x3bae09103f6bff,
+0x4293628c77c0bf68, 0x8c8ed16a6e7aabe, 0x2b8bfd1874fef08e, 0x151aa12e9bd78007, 0x53869f66afc2080a, 0xd03cab0a5bbf4ff8, 0x2f2dfda402db926d, 0x2be0e9e4f202e,
+0xec4267fc1edf67b5, 0x716e058218222baf, 0x7ab5008c285d0486, 0x906e91da92120a5c, 0x34822daf2c558de2, 0x9a6e0f3a110c7f59, 0x5fa765fc62ccc27c, 0x1e6fea4b7110cf,
+0x27e180d68be1b345, 0xd553c2d4d823f5df, 0xaf081be4e0ebdebb, 0xece2cae9a2c0649c, 0x84a1898ef8b1a6ab, 0x44f0fd3f2d123643, 0xe4440a67d8fd0624, 0x268e1cd45e5407,
+0xad3d8d1fd6d49d7f, 0x88f43dd9bf8a66cb, 0xbc3cd8b0ae93ead, 0xac6223d90a8029f6, 0xba5121289c3266eb, 0x9f6d3a15370526dc, 0x9b489889d9ca9f21, 0xe9ec29063290,
+0xc77d5083d8e18014, 0x6e6e9f7a90a14372, 0x5c0da7d345da4e6, 0x570ee35aee23fbc0, 0x32f33305f78f8043, 0x904aee8835182af4, 0x471c07552d49aeb, 0x3dddcbf83ca4e4,
+0x1a88dec9d516c82f, 0x3c6f437eab7a6542, 0x3c4e55e03303e6c9, 0xe7387bb634725156, 0x2e700914b174aa91, 0x36d5de8dfb40e08e, 0xfead043c98ba2f53, 0x3e39b82c9be01,
+0xdd5978e8d56a7b50, 0x632cf78203aa32a1, 0xebd88f623a6d8498, 0xe581b8fd1b8390e8, 0x8136cd55664a91ff, 0x3bbad4af977a215b, 0x24f8a90f2c8621e9, 0x27e98d9e6d1e6c,
+0x715e312046b7688e, 0xa37a56bf52ce0458, 0x27c6c418140d37f0, 0x47f60c6840aa43b7, 0xa9d20c83dca9a854, 0x9af407efa53a1a83, 0x6fd0500b08767d4c, 0x9112dad60af33,
+0xedb96ce0f4ca393e, 0x61ce959b7ac8892, 0x375421e240ef4ca5, 0xcd91bcfbab2f909, 0xa43011d1cf1881f3, 0x6eac7fd6d0bc8530, 0xeac0b624e943ad0a, 0x7084e41c5af92,
+0x9471ce88e8c408f9, 0x606bde443def100, 0x45218855e8fbfd89, 0xbf6ea974729b6e1e, 0x50f8133a43bd7961, 0x2ac12178868d4bb6, 0x7f3fe88915c60a46, 0x2dc3c083cc6da5,
+0xde37a8a247074c5c, 0x36cb24d8764bc2c7, 0x705db929d53054a1, 0xa501e5e21f310f50, 0x4d59f4f6462226c6, 0x178eb0df6c9938ac, 0x8ae5ce8a0caf7488, 0xcc1d2d1a4a50c,
+0x85e6aa64a09f828a, 0xfe208abbedb1d9d2, 0xb1cd266a53c465d7, 0xd426fd658769a807, 0xc4f794d9b7d53f3c, 0xfa9af4ce13691e16, 0x9acaa2ba5e8622bb, 0x1ba46c5025da2c,
+0xd69c63340a70539, 0xcf3f1ab84b84c313, 0x769deb610d5c48f3, 0x1242ebe00f5c34ba, 0x3012ec7fb92c49f1, 0xce519f1c822fb8d0, 0x5c528397ef6c1d4e, 0x66dd84f2241f3,
+0x8d347bf47a566642, 0x1b2361a8c1aa8414, 0x44b3e59b4040b91e, 0xd4a61cd55f5f47d1, 0x345e24820d56e9a7, 0xab6218f6a3759385, 0xcfe098e0c5a864ea, 0x3f6bec8d64c9ee,
+0xad717f632685f4fe, 0xcfb2eb8252cdfc85, 0x9d6751005d209c17, 0xed5c9857fba3fb84, 0x4f3f1fbe4cb614fe, 0xeb040be9bf0c09e8, 0xa5e63d88b6bab7a4, 0x3fbbc2b374eb83,
+0xa5ab2df83dbf0fda, 0x6a0bf9d76cd279c8, 0xd796b6d591e82fc0, 0x893098ea27079a5d, 0x4b40bff909769172, 0x956232b6c14762c1, 0x801cfd89fce06c35, 0x3705f05e61df34,
+0x8b6239d38f4ed1c9, 0xedb8240885c1485f, 0xb6f764fea3501e3a, 0x2c0538cc4a14a165, 0xc0c03c42a4ce429f, 0x225f2c9d608fd784, 0x9793f1d6f079b49f, 0x36db60a0b9872d,
+0x28dcff41d78fe02b, 0x3b4efe5b37410872, 0x1335638e04b03ec4, 0x7eb75bc26dc68614, 0xa38453a660aa7734, 0xb7f2960c1effed3f, 0xc5b523412702a418, 0x1fb5ea5eaaf3ba,
+0xffe668d7e7744efd, 0x7e562493bdd3da52, 0xbfaa7c2b5512285c, 0xdb0cd44677109ec0, 0xadc3ba443eea8118, 0xefacf27b5d27a6b7, 0x37fb6c2c2bdff822, 0x1edadc1b2d2557,
+0x106304e5df13564d, 0xd4e53a885afeaefb, 0xfc12ff69c2fd5a00, 0x14db9b079b83dee1, 0x12f8f4bb71226faf, 0xf876cc25aec18abd, 0x20c58f9e43a289e1, 0x31c110d0209d6c,
+0xe7d035a9e4f41479, 0xf007920f64987f20, 0xba8b554fec285232, 0x7c039b7b6ec07ec, 0x7a9ce93b22405c30, 0x423edd6fa28dea8b, 0xe141966ae27e59b6, 0x312be268e5107,
+0x9638802917f2d7b4, 0x513109cfd6225e13, 0xb7cbf355a5b08c6e, 0xbfcf18ad1be83aca, 0xb03cf03ca355e449, 0xd3054149e13c350, 0x4ec89bb43f08b173, 0x809adfb8b3241,
+0xcf724877943629aa, 0xf16c07b18059d8b5, 0xab521084c95cabda, 0x1c69f26cd3e11d10, 0x453037ccd5ea0251, 0x8035ec75df1a6ced, 0xfb022b3af694cd46, 0x1a084e4a1de6d,
+0x422084b44f9a5a53, 0x5ff2da89123143f, 0xb8934c57e5a66b61, 0xcd3ccda4bb60c279, 0x610c265b19cc0de0, 0x720b5090d0cd9d57, 0x24834ed2d20eff5c, 0x144b5824fd8b69,
+0x776c7afa22e4e109, 0x8c833bac751a4ae5, 0x7788cb53f7a47479, 0x4b90fc4973492634, 0xfd61a4ec6f71bdc2, 0x6b42e9d1bf04016f, 0x7e461d0819dd29e6, 0x2814b558344a0,
+0x732ce735123a1ae4, 0xdc37e0508f18e8c4, 0x1cff366ab5a255ec, 0x135f2940aa8cb3bc, 0x6d850e0ea1a5321d, 0x8f163b5435051f1f, 0xac2162154a424ab3, 0x319ae2f5ff0d4a,
+0xc785e37c7c9e6148, 0xdc5cf49569ef9541, 0xfd46430b3fffba9, 0x85bf175df02d705, 0x32d3fe1a3f967745, 0xb1c77d8bf3aa494c, 0xb38f4d2bc0d917d6, 0x97d55a4af9c33,
+0x32215c89591f4aec, 0x985aec03b2edb10b, 0x24e92d0e8488296a, 0x30ee2c4930ecaff0, 0x9f3c67a51e5cf128, 0xdc9de1fb7c95fea7, 0x5cd956b3f5828b6c, 0x1daaa11640f2a7,
+0x218c5cdb067ed80, 0x2b78d7a1f3c06288, 0xecedc685f6e8d8d, 0xebf0687e879cc9bd, 0xcc6ec8779fe0d1b5, 0xfd048d71c4d6643f, 0x69656393afed6d13, 0x17ac48ea67f9b5,
+0xe539016c490c6cd5, 0x50879522253ccc64, 0xe9bc24e7d38baecd, 0x72250b75140cba78, 0x50e9b248c4dcc129, 0xa224550140d2d9ec, 0x6ded73fda15d1b2, 0x664ccda119742,
+0x7c8983773b180bf7, 0x1003d84e89360064, 0xce357776801735c1, 0xb153a89cb7297b7a, 0x44d7931269ae91d5, 0xb01f14a1899fbc4d, 0x8d39043a811b3d9d, 0x3e151dc40df220,
+0xc9f710d0036718c3, 0x76d0b3724e4c385a, 0xedf553aee434901f, 0xbf78d3ec0915a2f1, 0xb8752aeae89d30de, 0x9542bf8d641262c, 0x7bf52a5bf3df0a3, 0x1492a881a23893,
+0x93010009bc83fa08, 0x11841f78dd5af153, 0xb1a8833e9d081a71, 0xd9b56d6206423032, 0xf3a4915af8ec3f17, 0x4ef3d98d2a7242c0, 0x73bae93ab05af6ed, 0x1ce40c9c9ff1bf,
+0x308eb51e462b67e2, 0xcba97457244aa2da, 0x5110410a16c00435, 0xfda5141eab6b4a78, 0x92b8534f3bc5bad0, 0xe607343e357d4a21, 0x97bc0eacec0d38c0, 0x37c9957bbdce40,
+0xff03715cfa19c1e5, 0xc9e99e4589c0c279, 0xfa6fee1a16b166cc, 0xec0efe572bd5920c, 0xb1af0e8a1e263973, 0x823a328e353c957c, 0x52441f038361afc, 0x216eef6577a716,
+0x17457bba5b6f5a41, 0x699fa78f850e9801, 0x922693b289442295, 0xfe37640716bca505, 0x4044f598cb601577, 0x1789d089a012cfe9, 0x9cc8d01a1ff4912c, 0xfa0516e0a3dc1,
+0x809132e675ed531f, 0xb6993407e0ad4f9d, 0x714b11ee4404b90f, 0xdbd8dac966608bbb, 0xee0fdf341a967a42, 0xe4398cff37275fd3, 0xe8c720f328510378, 0xf77ae5f6cd5b6,
+0x355b841ae18277a2, 0xbdd1d9e80512245c, 0x4577e7d92a412f16, 0x75682b6c5e73cc90, 0xc43bd40e582b1866, 0x40f672d6ba8adeb9, 0x8b227c237919ff5b, 0x1393421ede2318,
+0xf3f7b45aea7d385b, 0x44ea7439235692cb, 0x4e2be91bf7b242e8, 0xf8e512cc214f0ea8, 0x6afb0ba88c4e8d83, 0x3768dc4ac54f2af1, 0x83c6e521cd5ded22, 0x31ec7dcab47541,
+0x5a50c1442349512, 0x46bc5f7b8260df27, 0xb8df51019af2e513, 0x1ac998939c251803, 0xe2d4256a59f16c19, 0xb3c16780d5643992, 0x6890803b03a240d6, 0x2dbc059b36bbb5,
+0xe17bf9340eb75937, 0xe7e7241913f1f1c9, 0x15c53f133c46653, 0x932020ab28f55c2a, 0x962f928d319a9cad, 0x671db58d0d9fe924, 0x198ad0e53a36794a, 0x1b43dfe74da8de,
+0x74d5a9cfad5b3218, 0x3da5bfe7082a5542, 0xb55c4030543448b, 0xaff6f5048c1b8089, 0x2735d137e2e89a56, 0x7de7c46dd032fb81, 0x6ba18983bc612574, 0x2c0329fc23b184,
+0x3374135e974f20b2, 0x625d5153adffbc5d, 0xa42b38395983ff62, 0x5a31358fc3332c89, 0x7980eff78843e156, 0x5365ca3264432d17, 0x93e9a05f658c06a1, 0x3377edeedc72c9,
+0x54885f9d03b72c03, 0xde6f107353f51aea, 0x19f196c86018d3bd, 0xe552de0f7c1dcc85, 0xa7c5ea25cd6c7b18, 0x5837c56e515e2d68, 0x5190062abf4b6781, 0xa152e5873a6cb,
+0x6aebe65f41e52c2e, 0xc629f580a428a600, 0x5aa4606547c43e06, 0xc79fe222801547de, 0x3a284ae6f3c41f79, 0xff223d42a5d2af0e, 0x73ea3064d2b94f3f, 0x3d01c5137acf1b,
+0x560b87b7e9ec47e5, 0x7d4f1510937fac47, 0xfd84e91b788373bb, 0x3e11a6799f344fb6, 0x1766863a0c0745f, 0x79e05a9ed9aa3c39, 0xf36b3cbc09c28c6b, 0x14c110ab6f33da,
+0x727bfecb69cac7f, 0xdbb0cc3cf814f2cf, 0x6f3452885a843041, 0x37e84bb4fcbcb029, 0x9c7809ca9f26b4d7, 0xaab65e5076f93976, 0x8a22789b46524713, 0xc1e471abef873,
+0xfb245ab1b044426, 0x745fe19b570e38d7, 0xb13c98a0ec54606e, 0x3d8fa254aa56c56a, 0xd559690ac868317, 0x6892ba857f97fa78, 0x6b955c89cb5efce3, 0x7391c58f31aa9,
+0xe2ecf228ccd73d50, 0x30a02317b86de331, 0x704bfc1a1663d8cd, 0xe196a9122f7c49bd, 0x4d756c32676a859b, 0x6b1ea5c9e43bc1bf, 0xbe250cb50d757617, 0x97ea4ec0d249b,
+0x85323a7ca356969e, 0xb01e23f135835467, 0xd7056a5c6e6fedb1, 0xde48d82e066ff64e, 0x3090e7af2336f1b7, 0x7e64741840edeae0, 0x9c70b83da933785a, 0x257247f07eb039,
+0xe96612e78c30ac55, 0x75e32c10ac0ec356, 0xe68073bb92735374, 0xb47bda2e649813ce, 0xc761b056d40e190c, 0xaf5c3deb4d73652f, 0x24ead672bcfc82eb, 0x362b4244a23678,
+0xfaf2bd87b35ce91d, 0x401b26ecc17dc4cc, 0x27ef501596022f48, 0x99ac7c3f10c1e29d, 0x5e56e16b06f5d3d8, 0xe22553e3bfcabeef, 0xb9037f82d483b722, 0x2361ea98ea1df1,
+0x2d9a8c4dc82aead4, 0xfe90a9db99d0bb51, 0x1c274b4770306ed2, 0x88ac717cba7212c, 0x5463307e02cf0ef2, 0x351b0dad245c46f4, 0x9195e96ea1ebde98, 0x2516731977ac04,
+0x8e50364270cb3eca, 0xdfb6d2014856f51f, 0xa14d0de75473db2e, 0x2c5154e2b3bb5a, 0x6c3c63ad11d1b69a, 0xcb06e95adf662620, 0xd4add98cd43da110, 0x2ae3bcb400f8a,
+0x76831def5460047c, 0x147c54a1a9967f3d, 0x7f5cf43b0bc6647a, 0x6ffca7c41021681c, 0x9e203e342420b5cb, 0x5ae1b0a3da975607, 0xe3fc9f255e18b776, 0x2068e6f853f741,
+0x53f06f1e11728cbf, 0xcd92e37dca7d678d, 0xc5c99a3f3e377c0f, 0x98d8d912aa3e2533, 0xdf56a90f96a81b58, 0xe1c47a25ae654955, 0xca2d0046ca25d9f4, 0x30e93113ccf1e,
+0x956cfb97b24c82a9, 0x2e7b3b6b974442d9, 0x7d3e627bebdfdfb8, 0x32bedd49f975a5a5, 0x9e6e210081106711, 0x8b62d34319c8b29a, 0x1f7009fc97e78538, 0x2c79ea470f269d,
+0xbdd891cbd33f69bd, 0xe4c1239523d6cab8, 0x71c4733862dd0284, 0x759582f9023e4ad5, 0x8d3b08c85814eb56, 0xe62c13aec7ca73cd, 0xdc57bfff8da03c25, 0x1b79cc641ab8a9,
+0xdde9814263bc8dfc, 0xbf8245b7e9d23d5d, 0xb2289180db3a1740, 0x838152fa25b11fdf, 0xc81bf412061bb19d, 0xb98f31f9eafda77, 0x8e4da45e8031ee43, 0x2af529f8ee7955,
+0x6419cdeabb91feab, 0x4cfd37fa31e5156d, 0x5dbf6f2b834498bf, 0x27727700be84c288, 0x45b605ab9128d4b9, 0xae7ca2ffa8ae9e4, 0x346711908bc2f264, 0x75e387e7c8afc,
+0x26ec560dbf855c2, 0xeea9e453813351ec, 0x58a17bcc13de6a16, 0x391805784c94fa94, 0x1cafe5879aa4c390, 0xdd1bce651d7e1274, 0x4562b57080ffe88, 0x21065e7aafecb5,
+0x2b0d1d24b9ced0e, 0x60cd2d77f9647d75, 0x4bd4615d3d9c104f, 0xcc817ec4cb10595e, 0x7aa119226c74e7e5, 0xaa66507f562c7442, 0xbd2dd2bf91ea57aa, 0x2b55513150df89,
+0x616552ab8d38f7d9, 0xc01e8327de5f4661, 0x6a6848030c388139, 0xd4bbeb93bda4615b, 0x699ed88bcfc46113, 0xefaaa3247ac062bc, 0x7b79454a35a2a3da, 0xc39a911617b9c,
+0x3f2099edcabfaccd, 0xf6682714d485b72c, 0x17262966b021b371, 0xadf11ff6de5668f4, 0xb4c48b0d94a4e481, 0x34951fdf218f6961, 0xde01caffd106ad1e, 0x2c59d030547bd6,
+0xabce0db2c60de776, 0xadaf7efee91b50b5, 0xcd8e2d860e0ccd9d, 0xf02c13dac0ebcf41, 0xa03313ade7413816, 0x6962f39f34ed78ff, 0xd136f07bfb8f8e28, 0x2698a6dfb4736f,
+0xc29cc91dfe4e63b2, 0x1198f21f7f38dd7e, 0x44157e4407dce205, 0xfbe49cb2dc201de8, 0x7ed8e9bcedb25c8c, 0xcaf1b01a4d9f77fc, 0xb92938e0acd0a4d3, 0x35d2985a493183,
+0x81143abe5ab31e80, 0x83f1c5ab082539c7, 0xbe191b1d6a91a044, 0x495f1c9e02f85a9c, 0x8a1b4623ad320c52, 0x198a29a434c71b63, 0xa98e3e62687d491d, 0x358cd8bbf9eb3b,
+0x7f24308b4e7c1625, 0xbd7d4b872de353bf, 0x2edc4140417d0a87, 0x4addbdb5125564df, 0xd03a3c7627974484, 0xc5ffb9c62595a1c5, 0x81e1daaa62a8401b, 0x2a795975ca5b66,
+0xc0252dc942a442c2, 0x72feb2cd5f57b499, 0xb632204e6412eb6b, 0xb489d9a2c28fb282, 0x38c1a994e46a058b, 0xd830a493fc46e56d, 0x34768d7b1415fac, 0x3cfc2be570f89d,
+0xa53669b50eb48a39, 0x2a97605e243010bb, 0x52f4f8807ba3d4c0, 0x49ed693bf0d881d1, 0x5b9255fc8a4e8b23, 0x364f69b21d54dc08, 0x9c61007b3303eab5, 0x26d3206f0889b3,
+0x2dff24d2298c476a, 0x4652e8ac5765abfa, 0x3885ae0148ec044c, 0xce5b20aacae34fc, 0x5b92ad0bc85519d9, 0x50d3c2cf2afdadbd, 0x95ed222b86c782df, 0x152aa26ac787e3,
+0x1267602f13d97a91, 0x699473415f847376, 0xd25c8e9d95dc59eb, 0xb501537b946f61cb, 0x8eff48e36dd1fe5f, 0x60b39c3853fabc0d, 0x2088545c349deca7, 0x390c2f7fac1bca,
+0x3dee337db1ccae95, 0x254a26d590ec976c, 0x88ff834383938563, 0xff61d5af8f129a26, 0x6ad9e02dd59d140f, 0x460601cfca600554, 0x788ec828a5a07d63, 0x2d30a5e6445fa7,
+0x6c41e65f7ebb44b1, 0xfd9e4562d810c885, 0x61f83519a78754d8, 0x25a5fe3c87227d46, 0xdc4c4ff16a1a9ef8, 0xf9d190f1edf51daa, 0x17007691c5d40720, 0x3bc591c56ee04,
+0xb39f1aa140a93254, 0x9c587adc5bc3224a, 0xa5f2072379c4e254, 0x562b5512db069c83, 0x55b25d1686821c7e, 0x192d402e53b538cf, 0xd9ac9c53f43d0c7e, 0x14599682b332e5,
+0x6cf53b60f2eecf83, 0xb02ccfd90ed16bbb, 0xd804e9c76199e357, 0xed657eb5c6af00b6, 0xc8eef574d17f9cb9, 0x365db088a2c835a0, 0x8ff75668c66dd62b, 0x3cfe67bd028739,
+0x837c8f40739ce183, 0x44ec16b1dbb34558, 0xbce0b73dc6568faf, 0x44b2061820528138, 0x6456ee6f2bcf2574, 0x83e04cbbf327ac6f, 0x5f375cb4e1b8bd4b, 0x16a7eb0f88d790,
+0xaaad4dbb1d79b026, 0xcd7917130cca1bee, 0xd7067b450e648889, 0xf703cf82e06d63fb, 0x95e9f9ea5a72a9e, 0x5ef0bd84c69c018b, 0xe9af3cc8aa6c2825, 0x617abc796c40,
+0x281be0c68f4e92c, 0xf950b5c4e33d6ca0, 0x4a1ae67685ded2ca, 0x45d0eec5d3134ead, 0x926f6ade42df7d9f, 0xe3eb2bcd180f52f7, 0xc394dfd09fc8222b, 0x29de81749a17b7,
+0x80c161876a11a3b5, 0x4d0ee110d3454700, 0x6ca8fdf8f8d9df2b, 0xcc857eb893f66b2d, 0x6d93746da3e3d7a0, 0x63cbcec9178b0b89, 0x8d325d26527b55fd, 0x31089eb1acfe65,
+0x98bf4eba1021ed79, 0xeb47caf5e7497fcb, 0x984c8f561aabe6d9, 0x703381b5cc3ebdcf, 0xd76072106978141e, 0xad92847d929fc098, 0x2b9a3f171360ad93, 0x23e0fe4be30a24,
+0x39e9e0c10815b1, 0x3ff40aa4ea3fbcff, 0xf7a88814a9c330e4, 0xca6b60cb84bdaa3c, 0x9005138484a864f4, 0x68017990e7fca665, 0x8914f8809570f9dd, 0x288724b6f1aa5e,
+0x43cb3b542fb9642d, 0xec414a96a2f2e7ba, 0x9e6bc7c05d1a5e90, 0x58be4ad68eded6, 0x5a49731e25a530fd, 0x6ee103f0e4cd0665, 0xd9cd68321e36e66, 0x3ec38e6fd7549d,
+0x6b6de2f7395d84e3, 0x8cd6e53980f429ba, 0x303ba46afca05e2e, 0x401dc07c7398157a, 0x9b5d4faea8bedbe0, 0xebf5bdbe7508de40, 0x65884b483a062aa5, 0x1c62fabf9239e9,
+0x3c0d19c47677e425, 0x2bb06465e116d137, 0xf5943d42e96a2ae0, 0xa971c0fc49e06a01, 0xac9baf798c11371e, 0xe7a5c104f9a43156, 0x139d748d42b48b25, 0x4339958bafef5,
+0x1d483d0e07f4c7b5, 0x5adfbc619fcf57b3, 0x814ff83916c7e646, 0xdb84140e952c9eda, 0x162085aa074dd7e9, 0xf6382fefcde51683, 0x97e3efcaf3cb8958, 0x308a9f5ab1e872,
+0xa7212c13dc99b1a4, 0xf6b220b263df0b2a, 0x9bfa581b82ad300b, 0xc8c693f65658c0f8, 0x3139333378e0ce86, 0x59a79a422ee7335f, 0x147515869930b98d, 0x2a998c02a31b8e,
+0x66c0357acb4b0c0b, 0xabeb116e3d38de07, 0x1ac1cae48174e6c1, 0x2884e4cd5c788af0, 0x55b8ab2ef9dd26f0, 0x14b386fb11c368f7, 0xf033c0092de84ea8, 0x24caff9344580e,
+0x1d5848a173ac78d7, 0xc4e25d61eac7d7df, 0x42cf189bf7ba2305, 0xcfeff7a1a0d3d8e0, 0xc2b614f0b8bc4d3a, 0xc1566e2ac6af5113, 0x227ca87abedbf922, 0x1dba8f86936f7a,
+0xdaee752b68792aef, 0xcc6b100949d06626, 0x36c25f65747b3adf, 0xde997e772409b224, 0x7cc0a33b10bde033, 0x82f2b9b3f9909a8e, 0x62597da7cc5b0707, 0x315e0f7867ac46,
+0x1390a1c9d182a26, 0xa00329c67bbdd789, 0xed370d7902c8a15f, 0x8fdfa155cf7aae7a, 0x41a9bb2b72c285a9, 0xd1f331272fbcae03, 0x3441ea2a06a0b88c, 0x5702b37e2a838,
+0x197839ba2ba413dc, 0x9085cfc7a0e47b15, 0x84904c3fc21b3d4c, 0x37edbf3616e4691e, 0x54bc2396c0348444, 0xa8470d221d5f6510, 0xb901994cc4615f75, 0x319a4fd78f8fa9,
+0x905f1fe9c6f0044, 0xf681dbf919f6d339, 0x9bf0b2f344bfe67f, 0xf7afbbe1cf4cfac, 0x630bb83219261a01, 0x4221ff815212ea5f, 0x99d93362c4645402, 0x28236bc92607b,
+0x972afb8db51b4541, 0x8166e708e0f95cd8, 0xd2ad046c600e7aee, 0x5909a34c06770b4, 0xec0ebceabbd769ea, 0xb023b7080c284ee2, 0x5d0101af55b68bf5, 0x1e7f747e65eb68,
+0x93920c0a3e640891, 0x520c0a12bd35b5a2, 0x217772b88c528f2, 0x71d608b6b5f57d3a, 0x4b3fa781d41710d2, 0xfeff807e0be37c2e, 0x14aacef8adfff34f, 0x22d59c2f5dc477,
+0x6d9825defa2ef608, 0xb3bc3d13bc067cad, 0x118c8e5813336bba, 0x90d5a034aa91965e, 0x88b7c3f18f953704, 0xf9a9d51450a028f6, 0xdddcb11f06a3b054, 0x243f84e73b5384,
+0x3d665485b82dfe17, 0xb0e293238bb1b159, 0x259fbc07c5710d74, 0x7c857624982bf661, 0x102309c7a46c0da, 0x37bd92f94314f0c7, 0x739d0c57a3f0f62e, 0x2a6a79451694d,
+0xdb38fc057c121038, 0xeec3d87a9bf49c5a, 0x4453bcbc1621f03f, 0xbdb61b49fd4e65cd, 0xf18cf8d7387001d8, 0xd128d8244a933d3c, 0xb7f7bb6e3a3f365f, 0x1f91081d6b2950,
+0x4c2ae835369b3281, 0xb25e973407b74f2e, 0x3059752f8cbac719, 0x4651737892301e74, 0xde822d5126ffd42d, 0xa7a3ded54b529be4, 0x2e1d38b35dcd953d, 0x1428a2b24cd3c7,
+0x8429f447cbdee1ab, 0x556773c8c862900d, 0x1f2bfa6f61b7cf6b, 0x2ced48c119341849, 0x7196ad4b2e8c3ba3, 0x537b66202131d48b, 0xc53cc878ec15d42, 0x20201d10def452,
+0x9e9f707994681ac4, 0xd549b8193890182, 0x25d9b3c760302050, 0x423986c330af40d5, 0x444317b0b2be2bdd, 0x6b831e97f6ee66ff, 0xb4cf5a995652d3ea, 0x8bd50d3ea771a,
+0xded24cef91377656, 0x5340150568efa072, 0x361fa06a216adb8d, 0xc70416ae1a37b490, 0x62b89baee81be5d1, 0xccf25df2de63af7b, 0x5092c0184bc61ee9, 0x21b1b296200b39,
+0xbf0997518fb34b38, 0xf5c03486061646c4, 0x79a938692056f639, 0x8e67813b355890e8, 0xc36e43678752602f, 0x4017fc3dc98051f4, 0x1f28639ec47e733b, 0x19c77a7e98ecc0,
+0xca48601ee0edb89b, 0x5cf15bb7390d9b9, 0x4b6ac2d909df55ae, 0xba2eed3871c258b6, 0xf8cd2590d24a3a03, 0xaa127f81b233a217, 0x2cae81f8ebc70b9d, 0x3a4ae0c61234d8,
+0x29fda7dd4220d437, 0x7ff6721a6a7d9b9e, 0x93ff845c1fe8ac78, 0x2a1cb5ffa5e4a5f9, 0x92be58abebabf605, 0xd2498bd2174575ef, 0xed443e04a128c524, 0x2b1e07cdcc375e,
+0x2865ee70825ede4b, 0x165b3b2b0cbb6ce3, 0xba4a2b1dcfaed257, 0xa1452291c69a84ef, 0x81ca3db68bc59584, 0xb78240e0048cd074, 0x73af004ab2b60b06, 0x34b351c71b2b2a,
+0xa403bc00673482df, 0x4ba9e701ffc6a6ba, 0x4fe32e84ce601a16, 0x1d6b314e718ffc91, 0xfc06a294648d9ab0, 0x572773f31e0c952, 0xf2da29eaf6eff34b, 0x21f5a8d2bd99ef,
+0x5b65a60b75c1f92c, 0xfcf5f88deea48146, 0xe02aa8ddcece0de0, 0x8393504f20bd58e2, 0x11c855dae665b303, 0xc9a14906d86c90d0, 0x823170a553012430, 0x380d6d5a56d052,
+0x6c16fc2d76477d18, 0xe7ce7b0c7355cffd, 0x6f1bfce51501bee7, 0x741d4bab08db9580, 0x25bfbff763b89173, 0xfa0c5c81ab8f73ce, 0xbd76ddfa171fce76, 0x1b74d880f35242,
+0xa0f887bacf6deb06, 0x6675b5b655d3178b, 0x801c2849e02b37ee, 0x95bb6a676f834aa6, 0xfd29e4babd657ffb, 0xc20cd0cc3645b89c, 0x77ccad28996a5d38, 0x2d8f42321343b2,
+0x1611f49b05dba5c0, 0x68ad4a2669d5b91c, 0x70185dc183fa8275, 0xfde86dfdc6424201, 0x64892fd58bc2b2e2, 0xb96b2ab9560c17b4, 0x44eb315b0947b5a0, 0x178ae78f882f56,
+0x5911745300d95a6, 0xa85c1d80d4b975d9, 0xce2ae70e731a0b59, 0xcb53b4eb9bd38166, 0x55d2500d87fc3125, 0x50b269d92cc33acd, 0xfc5683f652619f2e, 0x1e4e95103d711e,
+0xc18d5a2871a82308, 0xd362faa9d3ff901e, 0x7d0830aea24226a5, 0xb11850d506b76de4, 0x84a20b50c9a107b6, 0x939eb47b82a36adf, 0x9966723d4a771845, 0x14934053729482,
+0x88c80b0c4ce89b5, 0x67fe1b2d9710822a, 0x159e916a41564902, 0x91f71ab43a8dfe16, 0x109f66843299df13, 0xeaef8023383b9245, 0x9f3c0705aceaf25b, 0x132165eadf3409,
+0x4808300330073503, 0x358e91195d0a3764, 0xc2059babe8a68f27, 0x5587fd4980280296, 0xf84edf1898959f2e, 0xd08d92fa8063c633, 0x8650a76c2c0808da, 0x1d589496e6f8a9,
+0xb48b378403dbaf33, 0x894d777807353541, 0xfa70a843ead0b20b, 0x3f4b7b0d6fad9599, 0x2748125ba489bbe9, 0x3d8c2aa2eef99701, 0x915547d8220743b7, 0x1472589a0adc16,
+0xc2738395b22ee83d, 0xccecce26666761d4, 0xecb75aae9e267ee5, 0x57fc765773d3a674, 0xe523cc8c7c2c1d34, 0xafc4810f8cb5f93c, 0x81643d98414eaf8d, 0x75c152c72ba6f,
+0xc3b7b6d8aa16d165, 0x9ff1263e7ab97e79, 0x61c4820dae8eaaff, 0xa567624ab5a14502, 0xfff3847cfa82e45, 0xb932a98ec8ef045d, 0x6ef51295b74ac82c, 0x1b5c016449fe5,
+0x6760ec75e74a0266, 0x97ba9e778aca3359, 0xebff64ed34df3f19, 0xaf9c9dae6d1484f0, 0x2fdd739437d706bc, 0x16efdb4311aa1c07, 0x9fa1935d71341e0b, 0xa6f03dd409ec2,
+0x1ab6660590e07082, 0xb4fae07d7ec266d2, 0x5ecefed6bf42416e, 0xb2ec19908b25cea9, 0x140207f7d5c00b81, 0x1b799ed91871e0f6, 0x13914d53abe0d8f1, 0x23408c29488877,
+0x31caec669a6062be, 0x2f383c871ab4f97, 0xccb1e6dad6942d0b, 0x174a652b9ccbfb0e, 0xe8d6f8d6f0018586, 0x28f092b2bb1dc7b2, 0xa91d7aea801d738d, 0x1c10afbc92a125,
+0x89c61561289d9701, 0xc8ef7d2af2d4cce8, 0x7cdbfe28c3e4c486, 0xfc88ad4a413e82e7, 0x5ff0157ae1e347ef, 0x54a10b74bf6aa4fb, 0x11f6e7c2d53d738e, 0x7629f19c411d6,
+0x9a3bc6b8359af42d, 0x24ae0d807b146bcc, 0x2a85c6c18dafd7d5, 0x3c20348a82938894, 0x33f11cb3af77ada4, 0x40c24d9b56e9824c, 0x1f3d6a1a2957e992, 0x15b439e9cff184,
+0xff5795a403c1f8b7, 0xeacfd6e744824404, 0x9298746e3ee646ef, 0xa0efc3527bdfe3ce, 0x425d484553af718e, 0xa29b2ade21e087ff, 0xd4df27d823e40674, 0x3ed27d52ade0b3,
+0xb4b13beddde3aa14, 0x95ec1d818921261f, 0xabf3fbed7356f4d, 0xef4c2c38d4b66f05, 0xf6a6999f63e622d8, 0xaacc83ea1186f824, 0x4500e9b5cbe691bc, 0x2d1153af82c656,
+0xf8af3b50cef12da9, 0xfea468953050c39c, 0xc3998b9a127f340d, 0xa78e74157a9eabac, 0x2004c5a288e30ab4, 0xb00e1d3bed9ed736, 0x4a5b15ab2a5dda65, 0xe5da1e0fb9c87,
+0xda5b030ec712ca4d, 0xcb9d9e303d4ca23d, 0x4ef49851cd01ec73, 0xa86afbf1047a06f0, 0x816394f7605d871, 0x5b577d1a82fe8e67, 0x5c043378150970b9, 0x2e03441141ecb8,
+0x349a3d00fe2448d3, 0xa5ad8d9cb10dc293, 0x1e92ad3ea22c4347, 0xb7822590d567555, 0x18b5680fadadfac9, 0x26acebecd13a8fe8, 0xf294678f399fb22f, 0x218efb472453c3,
+0xd09544b5e2497c26, 0x2fc4bf6b9b654ac8, 0xa116b233c69977ad, 0x179929fc40c7620d, 0xfc1c45234d3db45, 0x38bdd8340088af0c, 0xd640c1c50fb71894, 0x3726bca6ee6adf,
+0x9a34b1f161e71d11, 0xbee559fc50fadab, 0x251902554dab1085, 0xc0a36ec092771fb5, 0xc3dd59d9f8dfc702, 0x485a1586410bea40, 0xb7aa10cc650f027c, 0x36f4987336c9a8,
+0xe1545ec4b75b4be, 0x3c137fc2d86dbdd4, 0x33b0ab42e865ae75, 0x882660cdf071a40b, 0x15b0c1329808c8e4, 0x5da106ea329ed140, 0xcccb4958880387e, 0x161f9dda2dc7e2,
+0x447d903302696cdd, 0x223dd65c83e0c14d, 0xe927a44a6f9152af, 0x737748fc942abd1d, 0xad8be51367db5361, 0xfd062d558b5c202c, 0xc14c13ef67e83bf9, 0x49ed8cda3b9ee,
+0xd91afb150d6c8da0, 0xaee09747192699bd, 0xf40fa2052f9e2e08, 0x52b376cb67069bfd, 0x5ce806d988afa964, 0xf555ca4fb305bad4, 0x495f1658907872ba, 0x80c6e4430f6ab,
+0xe679be1d3bc41a4c, 0xc312127014af1493, 0xe58a0b214f430935, 0xf37bdffe1521e321, 0xda6b6946f786478e, 0xff6eba0f562b02d4, 0xeccfb1560d77a8d7, 0x15d6f190fccfc9,
+0x72e4857aedea359d, 0x406ea35936f7e5ec, 0x2aaaf319cc529f88, 0xf6146bfb23585520, 0x7fb20648ea3ae403, 0x2e99871b4f12594d, 0x51eb840b814e0fa9, 0x229afec52ebba,
+0x5105d92c5bb9e8e9, 0x63080e0da43852f5, 0x897db44df12ba4b0, 0x7a8f8bfa8257960f, 0x149ead810b4b61b8, 0x7d5b65ccecc8be4a, 0xc9d6f6ac819d61f3, 0x2b66ff549ddcad,
+0xff857eaebfd28d38, 0x59bc726b19cb03a2, 0x6963df39c4781bfd, 0xbf65e173a4c000d7, 0xffdc505afdccf6ad, 0xc282884a920514a5, 0x4935feb262305a27, 0x5185beed6fd81,
+0xa872a5130a33f5f9, 0xc84b92e293ced2c9, 0x52d91268721de1ca, 0xf4fdd2e7666c3952, 0x4acfe1c0f6188d0b, 0xae0ebd5fa1415055, 0x49ea784b43df7df9, 0x1e92a7255b90cf,
+0x15ad56085d45ebe5, 0xe6b96409f35d5cf4, 0x75487295384e757a, 0x896387a3c0c5d3, 0x8f2c38009ebcf821, 0x1947e87986d2b4c1, 0x5de934ba1b49bf60, 0x8e920b2076b25,
+0x8b2497eec6728b4, 0xa37d05f8dbfc8a6a, 0xae9b5bbf11a03a10, 0xbefa5419df76c871, 0x6e700511c1c36680, 0xf19c4a0ceacc9ef0, 0x5c1fe52cace4b5fe, 0x1d3404e39de1b4,
+0xe63b534dbdc85d53, 0x27cbb95a097eb665, 0x9783ff0d127e0730, 0x3ebc087a687001e7, 0x2448031253f81a0f, 0xa7f5c43b22bb9d50, 0x32a8cf48ee9d756a, 0x1d4bd61202ece1,
+0x5d187e374af01254, 0xe05f71261a2ff18, 0x564fd40f3ed5fcd7, 0x65278aaf7b6547a, 0xed15b14c42c1f3bd, 0x7475533a54fbf5da, 0x8deb3e75917f3b9b, 0xcef43e33eab45,
+0x3e8f76ec096a7c69, 0x9ab477eb9793d259, 0xd36402e5313df4fd, 0x19084f27eb82e130, 0x44753262a871e7cf, 0xfb97bd9be6e1b313, 0xcc9698fb17367cad, 0x7c9196e3b59fc,
+0x56f978af47781841, 0x2b5bc77a5beac9ef, 0xdfe4fe5dda74c709, 0x26ff79dc356b662d, 0x34bf1d794cfb307d, 0x57f285aa370922eb, 0xf4a4f1c3adf6d0d1, 0x1ddcf8a985093,
+0xbf07ea6838862497, 0x2737606d7f54c037, 0xc1e5cd5f5063a0f1, 0xd370f35dce506180, 0x58d36e177abac3c2, 0x4d64d315d00b4463, 0xdd2c1455c00748a1, 0x3e3ec2e63172c4,
+0xdbae53784c08a1aa, 0x9837f11489d8a7ad, 0x49a3ca15e48c921b, 0x56c90cce34980c77, 0x149b1606044bd20, 0x537c78474d66cb03, 0xcf92b03444b362b6, 0xef9342722f6e8,
+0x8537adc52c214cc8, 0x594e949a34554a0f, 0x62a95b02db1a6541, 0x579b02790de59ca, 0xc6e06a9173a02299, 0x5f3b0689aee7a5a7, 0x6819573906946f1a, 0x116bd69f68126a,
+0x8afda7fa7c4482d7, 0x79ee91cea9acd08e, 0x4b71ca1284fb88bf, 0x4192bc194203f9e, 0x3d7965c7e53d908b, 0xddceea9863f98fda, 0x6496edd27701756f, 0x2c7f8c9fafc56d,
+0x8b1086bfd235549e, 0x194a76c4607ce541, 0xac14e2d99814b7c, 0x61adc2ce08d08390, 0xbf4f61ea461bda4c, 0x59a88413af9bef52, 0x58bd834f1d3a402b, 0xb929bc2d2500c,
+0x8797d1f93b703082, 0x6d47bab5651ded17, 0x557eaaab788e9311, 0x53389807c3fb0160, 0x5b0a7289bc3a9aeb, 0xa757ff8eaf6f20bd, 0x4a2bdadc860af6f3, 0x88262613150e,
+0xd7820ecad2ba6046, 0xd89e1e12290b558, 0x8631d480c51ae625, 0x9c1de036618ebb79, 0x7a5159f657acc458, 0x4929d3515f16b0c7, 0xca850ca6334a8ccc, 0x28f143227dea1,
+0x4c098edaf058f3f5, 0x2f0b0bf6058a6e20, 0xac2a09ba57b9f264, 0xd9e14f6e1f78f5e8, 0xa8609bab37fc3e3c, 0xf3fdfab05460e842, 0x8bd26b1b3d6c8d03, 0x3b35f60785a1d,
+0xb33bcba2deee09f9, 0x777715bbea9a68c0, 0x2daa7ba7965cbdea, 0x6440629faf6755f6, 0x118c88fc3ca7a162, 0xb2f21d2cc7762b2a, 0x16b6e417d6c2ec98, 0x23c6d0858466b2,
+0xe4d01b9a4cdb48c0, 0xf6f55ec7110f04d7, 0x13300b6c559bef4a, 0xa37bc0c3f09d572d, 0x17ae1e7c30649a68, 0x9042d780f96771d, 0x72e28dcd8cd6b3f5, 0x2f4deb4d586d95,
+0x94d22027ea18c2e5, 0xff467d6cbf503a13, 0xe3a6e627ec61e4e2, 0x691560f8052e50d7, 0x718b65bd815c5c40, 0x7f36f27221e169de, 0xe4691bfcf4c8f1c2, 0x1f43880d1b61c1,
+0x5aa90824978301f9, 0x65d1e8331727e2a, 0x65a7ff67a441ecbc, 0x58a1c8132082c1e7, 0x4f8b62bd9d15487b, 0xf6b1c031325bf0f2, 0xfdba6f33f10f7676, 0x16f1789ecb5819,
+0x5500452b8f52bb81, 0xb1b5729b6f5c5d3e, 0x39cbb020880e4250, 0x41e0ac358997f23f, 0x5defd6edf17c4992, 0xcea60a50d2d7af1d, 0x3825818a46a4c76b, 0x1183c18797aabf,
+0x8a0fb509bd185544, 0xd0167e201e14215c, 0xd5390cb365eb14ef, 0x2a2c4258fd2c0961, 0x355669d0c2f825e2, 0xcbbcdde014c0188f, 0xd2fec9bc134d1984, 0xbad1c8df88b99,
+0x1f32107ed9f12808, 0x7bbc1cf66dc39385, 0x188de3285fa30da4, 0xaebbd4d36b950a2d, 0xeaca2e4e16402507, 0x5d406449f76d74f6, 0x3bce27064c748144, 0x21543be0b9bd13,
+0xb498dd23a12fef7a, 0x6904947377a8e413, 0x6f90a3985e15b42b, 0x3d17eb67c2fd907, 0x72bdc1f5b7df4b01, 0xeff72106933bd00f, 0xace0738dc95ee49e, 0x15b5d70c49d725,
+0x1991eabfcc0ab10c, 0xfd425b7317bca122, 0x26d2c66d5043af54, 0x121e07ad23329981, 0xffb1eedb0362527b, 0xf4998fba55daa827, 0x6cee92e6e5d0cb93, 0x28e98440af2d1a,
+0x369439fc1f1e6af9, 0xba221e317c836e33, 0xee69bdc160b8e985, 0xc8ce4bde8699f950, 0xb6ceb95c30b766e6, 0xabd84839284abc95, 0xb29c808f4594737, 0x273f755458cf03,
+0x3f267bc9d119ecdd, 0x6aa062c7f423ee8, 0x47d522f1a376e7b8, 0x43ee06d53670faca, 0x9a3a69c49e699e08, 0xe4b251fd780f9841, 0x3aa3c3beb4b16afc, 0x347d309f1c868c,
+0x318c2038d42d526f, 0xd4905a0ea58b52b6, 0x30c14469d14827e2, 0x792ea90f480c02a4, 0x4d86dff216598ecb, 0xf381d2c717f05275, 0x51fa23b15d1928b1, 0x551e2dc31146f,
+0x3829a867955fbfb8, 0xdc35ef3003800b6d, 0xcc231adfc0b1dff5, 0x5df8c40f6cda55, 0xf87564c0123b7631, 0x96b4a0682959161c, 0x9594a68d17d57222, 0xa0d80b1c3d120,
+0xca59dfb7efdb3575, 0x9457a6d799902e21, 0x52f5b9ab8640aea4, 0xc14f88e8625eefe2, 0xd4f87eb8046cec67, 0x696fe841016db0ab, 0x4345b57cfd4f5f97, 0x3b626e0af4224e,
+0xf34b5845ab4a2bb, 0x2e2b682132bcb637, 0x88f1f628d0fa130f, 0xd358fabab10eb043, 0xd46a4800b5574442, 0xc3156aa2c7728be6, 0xe9981ac35f6bfc5e, 0x38bc0e21c263dd,
+0x2bb2d6c324a86841, 0x12b7f8def450e245, 0x4157c8436415a492, 0x1f10ce01d85ee0a4, 0x8e8965514b1bb79f, 0x9886d3773c124e9e, 0x5f34f48ebad65f5e, 0x22c2f9bacf41ee,
+0x2d17ea36870774b0, 0xf71d90bf6e412996, 0x7129c25aabe5b8c3, 0x345acdbc145f716e, 0x6326de2e1231f20, 0xca83ece6f84a62fd, 0x11e683f1218eda72, 0x2d46f28c5080d1,
+0x2231ce9ca6530dfe, 0x4eb6127edc64b551, 0x502e6b853f18eee5, 0x7635887c4a983d0b, 0xf7211759616809e6, 0xb98c357ed7fa897b, 0x66bd507ace7f6943, 0x16f7e1713ad28e,
+0x67cc9692c280dbe6, 0x14aa28ab9ffb8e7e, 0x6aa52e5dc5da431b, 0x8eba3443d20c9314, 0x4651c90aae5b472c, 0xdebb71d6d975e8b5, 0x20d573b21d52056e, 0x3fa3eb4d4f1e70,
+0x28c8e498b0399523, 0x4e95559dffef8186, 0xfe3efb7fd99d56cd, 0xa586cb9de8e93e56, 0x293fdb78eb2bdf90, 0x524430a7ea6f5547, 0xd572c1ac533698c1, 0xf032b57c518f9,
+0x3a3d9a038337481, 0x4f8873c8a48e2e1c, 0xd0bed0505da39ba4, 0x5febb533e65faaf, 0x91f07d3984565e95, 0xfc07c51c5307e6e2, 0x345ab4e97284545c, 0x63afaa340dc24,
+0xf23f57bb8d08a2fa, 0x68a7e14801ef7d66, 0xdd23d452f9bd3bed, 0xb7d704ffde9552d1, 0xad109ffb83befb05, 0x6ec276516159b042, 0x623e86a34424fe60, 0x2214ef71315bc3,
+0x66f50c044ae941a3, 0x85c3dd2d7f625294, 0x837fa991fe04f620, 0x160782dd91474db9, 0xcf804b6198c1756a, 0x45fde5f45b28ac81, 0xecd6e51bb9134d8c, 0x3ed6feb80d8261,
+0x6ea0e2356853f177, 0x17fed54b71991325, 0x466edc5739ac5334, 0xffa1d2e2d96949d3, 0xd88ac9e876ec419d, 0xd9f210265905ba60, 0xbe3ecdeec0b6712c, 0x3ea0ac08f3602c,
+0x7d38d25f8b4c3a00, 0x569140d26810f8a, 0x40870f22373e9e5f, 0x5b6180d7d4f58596, 0xd54d228a2437dbe5, 0xa81f8dc2ae3c4223, 0xf8e2cbd5feefa83e, 0x3845ed4ab422fb,
+0x8a3fdac3454d7246, 0xe2e2fe9061016361, 0x308642e6a5e9dfc9, 0xb7aab7eef02b32c2, 0x574d040bce7606a0, 0x996cc9ccb3af8bd, 0xae1c1b38d15f71b3, 0x2a34a7881ec3c4,
+0x3f4f34a5ef787dbf, 0x7b4d2d4879eefc53, 0x285e33e66e45251d, 0x26a99688dcd1dcd5, 0xdf2ca436d5e4ebf5, 0x1dc183d681539afe, 0x5bab8eba589f9880, 0x36241fb6648f63,
+0x9be6538333506266, 0xd5a289f501db8739, 0xf5ff9363e0e2b355, 0x8805cfbaf51a6cc5, 0x38069fc3a5583276, 0x1e87ab2ec8a49620, 0x919eda527a2e14fe, 0xad39f66cdb87f,
+0x44ef691bfc3f8ab3, 0x504b40675aa0fe20, 0x5cd39252a80d081f, 0x8b53d4eb213099c4, 0x5642b74474aa14c3, 0xccfdb0e825447a37, 0x6e623e9592fdf58e, 0x11ceb426e3e17,
+0xb2790f23a3cf2b21, 0x27634e40c210ef53, 0x8497953d63f11ab9, 0x2f35b131df72e805, 0x9120a8263d681c1f, 0xd9dca140d19c5ca7, 0xd6934da62cb0b7ee, 0x60cfd7431bcd,
+0x235e177672b77e5b, 0x95dc18554a54abc, 0xf410d582a098517, 0xfb84fa70bdd360b9, 0xf7c34191d5344fb4, 0x5946e34d986b37d8, 0x64ae1280c309615, 0xea1b42ccf0182,
+0x37648da27b3aafa, 0xd166d4d75fb17023, 0xed37c5f92e20f513, 0x69d5789a2c9e258b, 0x58447da60040307, 0x280f7c64874f7585, 0x955b1ecc617054c2, 0x3d25d3f480c4f8,
+0xb8a406f16c1e2e65, 0x6ade572372e24932, 0x83696566a2fcec5a, 0x178007d7b556883c, 0x2d4338f7b147a84, 0x9a51c52abd9993, 0x59aa0cdf659f1c7d, 0x34b299f35d7d14,
+0xea005faec0e30208, 0xa123f007cca6ff74, 0x3b24950caea2f6ca, 0x2a87c9ae6933fafe, 0x71b8b72294cfc5f7, 0xb7bcf67f70b164e0, 0x162395e43443283d, 0x3ad5172e5c0b4b,
+0x9b57f4fd64f82c76, 0x8f974265a06a99cb, 0x2a74757971d140f0, 0x14d9e96834d160c4, 0x44740ed21f986199, 0x53292c3b0b5de1c3, 0x4ba48296c1edd87, 0x15e00119f709f9,
+0xe0b89784c0e8152a, 0xa58d712480a944eb, 0xa136992b2245a8e, 0xac710c16c29b2628, 0x7a648c78d3612512, 0x49a693c190ea524b, 0xbe948d2f252c86c7, 0x39f4624526041a,
+0xe46fb828affb26b7, 0xaf7a3502db6ce080, 0xe3bf12e00e2d4372, 0xeeb478c3a82f652b, 0x7a9e81f035dc87af, 0x2980c448e7904bbc, 0x4dc137606c78f394, 0x23a0fc08a2f158,
+0xd5c56dcecb8639e3, 0xe95f7c8d8b3c0e1a, 0xbba8d196609655fb, 0xf382018575747cef, 0xc942f3a148e28d0a, 0xa8a924af8f38228f, 0x63de71be99e9172a, 0x29ffaccad950de,
+0x7df06a7bd2499205, 0x173c26dca2f576ba, 0x387673c0a4ff0eea, 0x97f8e2604b051db3, 0x526cc20370bc3, 0xefc136f05e1ce767, 0x74a026f46138de64, 0x3a3e21de61747b,
+0x7d9e23bc6ef16f4a, 0x44eb70eead56d228, 0x1c6a899dcf2c10a5, 0xa7d96809e659e84e, 0xe84c47ece214ad08, 0x6400c5c872bf3623, 0x9235fd36b445b52f, 0x1970cc24733c56,
+0x1c1751222c8aaaa4, 0xdaaaf8621cb62248, 0xc943c7918f431bd9, 0x9a073bab8cd2958f, 0xe5a8e2861e43c04c, 0xa082ac091531ad75, 0x823980ea51738045, 0x29e681c61d61a3,
+0x7f26a93f8d81e03a, 0x4df6b9b730645684, 0x6385b57da5c7d59c, 0x16930fc4793234d, 0x52b8f9fb10723ee6, 0x2dc650e24eb035b7, 0xf14cee7a6d9291e7, 0x17155bc1ead745,
+0x86822e60b614e0e6, 0x546de364f1cfd6c7, 0x84bb390176573c54, 0x8977fff24c575747, 0xc62d26a824ae1a96, 0xb216b3cc36b00aa4, 0x528ce95f72c16979, 0x590fc748990cd,
+0x86afc9b43375901d, 0x83234c58d6cf928, 0x58b2bad336e472d8, 0x80072d63b4b90262, 0x713152b01a581cf7, 0x573899679906b6d5, 0x1be01a834ff42c3b, 0x3d19e85595e5e0,
+0x9b359386009bf08a, 0xdbc55f51e43857c0, 0xfefc51fbe984850e, 0x42e1d2228a0955e0, 0xf3f7ed9714aa4ddb, 0xc4504269bb451bc8, 0xf0d178bdcd278ef1, 0x3fe4a7e0eb64f1,
+0x7cb5ae08e79e9449, 0x2b8f157b774ec817, 0xaed5b8d13d47eb6a, 0x8fd22f4cb03bf3fb, 0xead52e3ad693f8a2, 0x84385057306c3426, 0x465af8b02543f4ad, 0x13c35c469dc629,
+0x7cf31e5f26ff03af, 0x76a95464a8dfd678, 0x12ec4788d877a321, 0x745ecb16f8fc3779, 0x107c9ac667398045, 0xe2773cbb6b8fd86e, 0xb715dd68de10f6e5, 0x3fa1abd0af994f,
+0x139128063ab5884, 0x79f9b6e4a1cf2158, 0xa172ce9d3a582f86, 0xe97fc857fcaf5796, 0x8ccd60af69976b50, 0xbc041012c611425, 0x388ff5ffd4676391, 0x24a6416b1997ec,
+0x9058a2331e8c95b7, 0x6bac52f3083197da, 0x27a652e8fd52663a, 0xbaa0c58f31ae08ec, 0x762698dfc6709a2d, 0x6704f2f04d1e8335, 0xfc261d22b8625263, 0x19d09ed81d6226,
+0x8355997f351bf187, 0xef045bfeea3345a1, 0xa9ff58b655be01c4, 0x6561aa1a50f0562d, 0xe96fe6165346fd1d, 0x39f6ab93358dc291, 0x536c6317e49efbfa, 0x3b38862d656e95,
+0x1770a016a924de96, 0x4d12f653c34a5e91, 0xa5a85536c23f61d4, 0x815a483252216189, 0xe2487d26b8853088, 0xfe427401b73d20c4, 0x77ff55c8ca566a8, 0x1e43a352d22e16,
+0x51399ec7895ca687, 0x36fc3d3e4759bff9, 0x5c3e14f34f8e8589, 0x7c93d0b28841203a, 0xf6b2c14a0c3f9094, 0xeef47fa61ed81d6d, 0xb5825faeac0410b9, 0x36304c3dd5552a,
+0x7780cb84d9871240, 0x6742801cb8210ed0, 0x77c51f2e35f8cc98, 0xba786aaf56582ab, 0x25361debdbad7a9a, 0x6af45e05b625c833, 0x51a2da3b19100db6, 0x349b14870a67d2,
+0x3bc39ed7d7089e7e, 0x2954e47ee09f101b, 0xb2e83388d50e44ce, 0x99f7521febb81811, 0x5d3df8356a8f694b, 0x7ed167d058ace33a, 0x808356d4c918c865, 0x2c775065d95b6d,
+0xcfb4001ac42229eb, 0xfe6c062117b35f5c, 0x698a042544054b42, 0xb6c7f5c3a3894ed9, 0xafd8e1c52288b55c, 0x4819ffe54210ff5f, 0x6bb94fc90487261d, 0x1a50cf9ac0fe2,
+0xf1062c005ebcf4b6, 0xa1c96c73c75791eb, 0x1724de27d137531, 0xc40d7ab568828cc8, 0x2bd5d626d2919eaa, 0x5e34255c27bef69, 0xe158716af9cd826a, 0x3c69efc0dc5700,
+0x306407d2096c7f0c, 0xfde9b8ae37d55b1f, 0x651faff70cd960b2, 0xab5063257631b3ed, 0x7dc1431e3e60adae, 0xcf95cf6ab4ed0cb7, 0xbc7b452af3448e, 0x271978559e90da,
+0xcd210526b643e7d, 0xa6be4d55f9c867e1, 0x25b6fc816bc45caf, 0x9b9f272a3754e484, 0xa3cdb7607baa091f, 0x718336c4445926bd, 0xc431c2446e92fd4e, 0x2029a5840377e9,
+0xcb98ded17b7cab3c, 0x9578160ff1fbe26b, 0x60e59633c1bcb98c, 0x5848525e8e5f3d1b, 0xe7a3bd5ab3fb5f9d, 0xe0183cff6ec77b90, 0x3ab549ebbdfc4e2c, 0x35296c755ffe34,
+0x7c309ee1a5ab7c93, 0xd1b2ccb78c58fdd7, 0xc744c293bf55c59a, 0xafefdb58d7d7bd, 0x1b8a9f203ee80183, 0xa1ea00eea45b7f74, 0xb5078b45508b1f4e, 0x777275f80791f,
+0x99abbb6e42461e26, 0xa9f361f1a45d5dcd, 0x5ca9502cd80762f2, 0x70b57a6d82fe869a, 0x468cc213b666b145, 0x58100686eb6138df, 0x1670a44fa1448913, 0x228c77a063fc98,
+0x42795ceefa40c88c, 0x22b3737bbb119ec, 0x3d67d31c2e6a9610, 0xb0bdb42c7b0b83c1, 0xc9ffe2d396364cc1, 0xa135d4d8c18eb3f3, 0x7247fcc9011df54a, 0x265cfff472414c,
+0xf5b0561a3d130ad, 0x707cda8d0edccfbb, 0x3fc0b7cf84267a0c, 0x2f25116871c23b7a, 0xa6da2b736c3edf00, 0x54e0787b572853d9, 0x81b930e9c4c72f41, 0x1a11ca9d9bcc7,
+0xfb07bba8fabe022, 0x2654425da3587619, 0x94d4eb75187fef7f, 0x9c0232009afd995f, 0xc9d2bb1ed2384ee, 0xe2b3c4da176ae641, 0x31513436491716c8, 0x146ef793be2e21,
+0xce41e587e966c051, 0x5a9aa6d2450aff0b, 0x143570972a956fb1, 0xa13028dc82e26857, 0x58f2547ae439a94c, 0xf79abc01fc635b1d, 0x86126bc7895bf1b8, 0x270ed650433213,
+0x4ea46e89fc6d17d5, 0xef505e900559ae1e, 0xcf3d5ca168aa095d, 0xd2b1c4b0942abfb5, 0xd2f08d21ac6679c3, 0xf25dd7d430821f7a, 0x5731cecb8e9dd082, 0x3cbc59e9fea3d5,
+0x6dce14ab6115b2d9, 0x1925eb56d80ef2ac, 0x31b1ad98d52a39e7, 0xec13f372100bdd25, 0x6b0bff4ef9979942, 0xe87b0a43a6c596b2, 0xaea8684fbb7896d4, 0x15b774611695a6,
+0xe276e3785d6e94fb, 0xe609fc3852420091, 0x90a4e7894d3dac2, 0x9d036f08f43dc65, 0x72f94aba7392af1d, 0x4ad3a39b0cfce976, 0xd374fdb2678b19fd, 0x10bbbd1462732c,
+0xbab3816efab60f45, 0x52a3b9c9d6ac88f9, 0x49ffb28cd1086714, 0x3c7e4d6636317d29, 0x3505e57767527a0c, 0x68ef806915f49faf, 0x9f315c1b19132792, 0x33c720b794ddd0,
+0xa9c0169624c72e7, 0x678d53bf6fffc72f, 0xbbcfabdf35d78194, 0x7b5d99b6e7fb1687, 0xb2020203ed893a96, 0x5eb2b5ed2f3a926d, 0x7ffb7b57ff50071e, 0x341f583d10b6b4,
+0x8e0af5a1e2d3efcb, 0xdb23d8ac6d41ba7c, 0x3ed7ebcb9faab295, 0x80859cdd04021550, 0xe6c464dcde09cdb8, 0x552c1f85cc410926, 0xc9245d4cddf94dff, 0x3bcccd4845778,
+0xa4a8f19eac56bcbd, 0x36c2b2cd0a09f861, 0x327380d7ab7f42c0, 0x2343ad02efc639c5, 0xe58426055bc4ae17, 0xcce95f5824b630bb, 0xb0c1520153935a9e, 0x2d4acf72aabd71,
+0xfe4435a5ef732189, 0x6c6a7fb89b22a891, 0x43894213a885266e, 0x6587702c120dbd17, 0xbc98619ea41c803b, 0xd172fd169c74353d, 0xa9a59bb23c1dbed8, 0x3ff71c32d779a7,
+0x4e1d2a998db717e7, 0x94200d8536723a0d, 0x18b0bd8e0442a024, 0xc77a6a4a34e43540, 0x8622d542dd71b6ac, 0x3b9e702a90513f64, 0xa0ae4190ced9d475, 0x7be1159f00295,
+0x371be9c4cd04ea74, 0xfbef5f30357522a5, 0xe02611605fd5754a, 0x9c23804435a54aa2, 0xba2e5601e5f1d39e, 0xd114426b6068a159, 0xaa5312cbbb192d5b, 0x21819f4bc95606,
+0x776105849c572a25, 0x9a919bccbeaf788a, 0xc84cfaad4cc01e0f, 0x199d073597c2cd63, 0xe04a83d64a8b3dc5, 0x332c3466d7cb1bea, 0x5ddd7ccdaca81d28, 0x1469784911a53b,
+0xd9e94506e04c48de, 0x102da4fb74fb6904, 0x75b5b5cd11ba54c8, 0x252a44de77f85e82, 0x74e8e06026d4e36a, 0x4934614da82bbbfb, 0x497a8ea7cb694af0, 0x17f588d6f43f09,
+0xc810677a966ddf9b, 0xae38b99c9b005096, 0xcc031b519a7ac8d1, 0x6cbccb2c775e94f, 0xbf4a74cc8b7861ec, 0x62bdc2447fcb5060, 0x804a547f0641d634, 0x344ac7aaf6f822,
+0x86920777ef4283bd, 0x910a63e19712aea7, 0xc6cec23a4efe539b, 0xb64260a80b3db307, 0xdd9150fdce17ce53, 0x5ff9c1784b94a44, 0xac73755075a621dd, 0x19630356bb4e76,
+0xb213887580c41ec0, 0x2aa01a1427135eb4, 0xc86d778220fcdf31, 0x4026a1eca00c100a, 0xf2e28c79f9c984dc, 0x6758caedf9b73cb, 0x45cc24041377fd, 0x122a3e74af7b6d,
+0xe4be5abbcfdd5d61, 0x59e10cd7d7a90899, 0xd06f2ca4aa9c9dc3, 0xed6ecdfad93a5bca, 0x9170d3242288ed8d, 0x10393e698e84737f, 0x6f4be040a999687d, 0xc987720e82653,
+0x7867b3b831b1c2fe, 0x9d46afa328765a73, 0xce55390cf18dfe34, 0x65a1a2c147ff882b, 0x33358d8c00536705, 0x96f92c00bb6dbe22, 0xd24ab4a9824c342, 0x6c0da63b832de,
+0x2aedcea0b95de63a, 0x8f6534ebf673fa8b, 0x9cd3ae2946a1a34e, 0x8a8ccefefc829d2, 0x34dc3c348586829c, 0xad4c580cffd5339, 0x1df48b6c89de92ad, 0x3ab9dac3f867fe,
+0x31a8010232250e20, 0xcff55bfa678afcb4, 0x62a80c16f19ecf8a, 0xa797da992ac367df, 0xc327f5eed82176b8, 0xcbd1814a92200a30, 0xb380222e62eb123, 0xd8fb7dc8d0ae8,
+0xf46897476e9bdfe2, 0xdae70a15bef0749, 0x883092cd746dce2a, 0xae1bbf822b97a24b, 0x15500e286b93f103, 0x4f96669e254b92b6, 0x9c07d227cda87ad5, 0x1e6c99007faa73,
+0x5561c8121edfc09e, 0x62cad557860333c7, 0x315ed2d9e42c10a0, 0x870e8cac9020700d, 0x43314624ad6aaa49, 0x6521c4c4733b5fde, 0x7fa42ef3a480998, 0x1676524291d2cd,
+0x8628c8cd8d964e7e, 0x61caec4fa81798f6, 0xad9719c707844e6, 0x17c28467231ef0c9, 0x3dfa2a2ebb21b746, 0xafb97a3ca67a11fa, 0xa72a7a3f92fcf5a3, 0x124e3bc2f58c44,
+0xf81728790bc59b64, 0x9733ec746f32438f, 0x49559038b615826b, 0x1473af9dd185c5c, 0x9a5a43165a00d157, 0xdc85ede5bf0b2e0b, 0x54ba69fc063ec3ad, 0x35e999398214ce,
+0x62633f95957bf854, 0x48ca989ee3388b15, 0x4d8e32987b8460b7, 0x55ff2fb676df7093, 0x661b1e5be456a188, 0xfeeecd125a1543f, 0x359e046b7a548ce1, 0x28daf636fcd436,
+0x5744afe46cd3ae9b, 0xd153b9dbd278c04, 0x55e31ebee9c8949b, 0xd851cbad2d93a320, 0x7d82f66f98b5f091, 0xba8c7b8a062b4166, 0xc223f91a0dde6a9a, 0x250d82756bfebf,
+0xece9422e0ba94d84, 0x2a448d5461a28bf5, 0xee9c77598fe075c3, 0xa16f78ec4e6a907c, 0x462ae20191f7cb0f, 0xfb993512c57acd04, 0x909373c61faf7a1e, 0x3119abe3dc287d,
+0xcb7dbbce76d2389c, 0x36dde2ab3740ca0a, 0x8128097cdbe15441, 0x2f4dd44a23d12468, 0x7910edb1f5208ff5, 0x130b2245a2d2cd6, 0xad548a3eeccde24e, 0x2f6ff241db7cc,
+0x812ba88bfa5db1e9, 0x11f2f95c2f79371c, 0x9151e269dae9d85f, 0x64f2465bde96a52, 0xad8581d1447e3120, 0x560a778883e8639e, 0x836b0cd2808e434, 0x9d58567fe6fd2,
+0x2ec302a6b4ff7a3a, 0xd45cc95c6f7ae9e1, 0x6eef7cd866cb2b86, 0xbfcd1d3d7be240f, 0x2426b910b7712309, 0x7844248c8f6c9fab, 0x8b178ee47927d337, 0x2fb358eed49309,
+0x4d275fd9dab51457, 0x1302b823cf8f749e, 0xfce7f948e2c8abd3, 0xf5b21644a3449bad, 0xb0590004ac6a931f, 0x682cbd93d35ea6ff, 0xc2bf5d9837486399, 0x29140bd5b9c1da,
+0x1a114d714a180bef, 0x928fc970a36923fd, 0x50fa0d08748c5ea3, 0x4ea214a1e2b7d76b, 0xddc04c0701633543, 0x35cc68bd652311ca, 0x753f0e6e1e54488d, 0x394e2fb3b0830,
+0xd20f8868d5abf6ee, 0xbb5f8805655e9261, 0x10324b7e37779ef7, 0xf3cf39baa66df0c4, 0x1ae9e3a2700c7de6, 0x3005f506b941f998, 0x4f0c11ab9dd71940, 0x3601c58eaee161,
+0x2840a7427deb3820, 0x7639bb4fe43499b6, 0x2c93296e23c68f3c, 0x68f3df72ef00e4ad, 0xa81bc14001a98724, 0x52fd8b6ee53ca2dc, 0x65d2c445f23c3a1b, 0x9a558c95e39b3,
+0x77f471fe31baf3d1, 0xe8e0cdb9c51ab428, 0xa6753e3fce1dbecb, 0x879003b35b06c13d, 0x640c6b81640e1d91, 0xa5e9854ca6084f44, 0x2599bcc4b6a85d78, 0x16b8e34166982a,
+0xb1ec27860952ac8e, 0x761dd4a72dc3286c, 0x85998d8bd1f71676, 0xbd5c7c9d353bf714, 0x6bc0b5ad4f797505, 0xcfd819837747b302, 0x983b81ca7f24a466, 0x38e664aee7a265,
+0x8858547887895f56, 0x156e9b515347d321, 0x726c8a6083f692ae, 0x7cf0d7765ab17a0, 0x893d3645a94d1667, 0xbc443a4de860550c, 0xfbd646a06dc8f687, 0x219cd277f1ba41,
+0xc86c1b22d1f90b72, 0x5ba79dea0286a161, 0x66ca7e9edde89090, 0xaebc0f5d19df400c, 0x8a22515b918a7f5, 0xd24f3a19d81ff66c, 0xfaca2e96c4618e7e, 0x39485261f4e783,
+0xba7d6f62db743785, 0xc30bab2ae77d5be9, 0xdac0bd861e74f612, 0x7a1ab552c986d2d6, 0xdaaea1433475c021, 0xbb8b4c25d952a014, 0x373289af9c564542, 0x322eb5f6bb49bd,
+0xd6b40be3dc5fd0c6, 0x1cb7ae29d1a7837a, 0x1cdc52474de87681, 0x3be7369df463e245, 0xf10acf957600b751, 0xf64ab454813896b4, 0x3b87b411f6c9bf79, 0x2f98bffd68a918,
+0x54d993fa2995283a, 0x761b6c0be38b7d5d, 0xb8325137d5c37e7e, 0x5e88d305a91b4096, 0xf1046c25bf0ad289, 0x8a6a6f5ac6e3bac6, 0xf50badbf9dc71a9a, 0x2f0478e07db35c,
+0x3b49af31ce9c4d5e, 0xab394513cea8668e, 0xf75cf092c6bcd9cc, 0x296957d80d230698, 0xae142afedf89a2cf, 0xd168f19e7ddb48d0, 0x15418542e38b3264, 0x3bd10a18da54cb,
+0x1fd9cc887daefeb, 0x75ae5b83fc77e782, 0xb4555d77f699b8c1, 0xcddcd89e3f90f2b6, 0x473c67defe35f77a, 0x21645f330e560661, 0xfeb94dd1288b39c4, 0x1cec9657587e27,
+0x8a2b730fba8ebc24, 0xb5b5b2c41b1b06d7, 0xbd4f9b3a81371936, 0x7c2d82e42e822f2b, 0x7cd30ac30de3dfce, 0xc9211da699b1b302, 0x2404e2a618bf978b, 0x1dfdd4427b89fe,
+0xb06502fedac4d932, 0x495ac0d1f446ed74, 0x16bd6ee64555d9f1, 0xd80f05d108f9bd4d, 0x54e0128f28eca229, 0x8ce2966503859e41, 0xab4f4117a5aa7e23, 0x39f1f0de5db22c,
+0x1f49ba5237441e97, 0xda8d9ddf87bed6f2, 0xb9f4252964afed9c, 0xd407a683e18bdc23, 0xaef28384fb3b00ac, 0x2e8b5c8c5f083461, 0xfe1657cdae612774, 0x192b129ff8bfd4,
+0x4fccd8687c752f89, 0x8876b89623fd240b, 0x81b66dc8a504f1ca, 0x74b76f0b8d0dac36, 0x6ddeae68f4f5da5b, 0x50b5c69a16c32089, 0x4167f707d643d402, 0x278ab0eb33be8b,
+0x911c5821ca538e0f, 0x4e8ad27277985b2e, 0xf7961f0663e74a34, 0xfadd82c756e060c9, 0x899c678da8c748b4, 0x1c380f32a4e656a6, 0x4067e25fec806cc9, 0xf2b86ee872a51,
+0x2c9fb40e163b561f, 0xb44c422b29e238fb, 0x36b249a8cf681ae1, 0xb1fbff3f2997e340, 0xd1c0d815d4e0b470, 0xe79ef06e781a70c, 0x5d41879673fef0c1, 0x19315a42b40ab2,
+0x91388fbe8c2dc66d, 0x9f3d4b747f6b38bb, 0xb29d3940102dd9b4, 0x63fa1730444cd631, 0xa9d3c905c66d9ef9, 0x1a6bbcf5978fa3ee, 0x889767bb5f2c8890, 0x31373fcb3395a1,
+0xe4f8d03d7315989f, 0x824e1635e1d60c6d, 0xed37e9b049accebe, 0xffe084a97e618dd9, 0x50ee915171eb6412, 0x84e24c3321959761, 0xa7c0d8fcf9729ed7, 0x2b2ef60e0458d5,
+0x78466437620f03d1, 0x316ac9f90670318a, 0xe7190c5a2053d56f, 0xd684b0a9a3c121be, 0x68dbe468ed4b76f1, 0x68d5e69e542ee9ce, 0x93d07ad107e9a2cd, 0x324a9c7c1e1344,
+0xac552e98426947f7, 0xbb0e252ab459c4be, 0x65256fad0e7b19c4, 0x5eba2b927a0e5fee, 0xe87f0633d431e60c, 0x16b3df5f5d259e81, 0x698c08dca4c6b465, 0x168ec6bef480e2,
+0x5daaa1a4a27ee13a, 0xc48b3ad5a299c495, 0xbc5c84f5268fa383, 0x31e7addf132bdad4, 0x7fff1707bc724e1a, 0x1cf5493b21aa26, 0x418e8f385cbef6ee, 0x314ab6cb36039a,
+0xa7b34db7daf3033c, 0xdb68722467b3ce76, 0xd114ae4cf41df556, 0x49f0d9e857171328, 0x97e48045be078d53, 0x3deddff164fcd1a6, 0xe7108632067112af, 0x117795f9e6e9a9,
+0x764415b0f787d219, 0x99554b7940321ee7, 0x2ef51705af5835eb, 0xe2807bc0062f3d8f, 0x2e1b1adb5581b1d7, 0x1ea1db04e3976267, 0xfbe085a792b61981, 0x1dbc22c0ef46c4,
+0x395eb27602d4cc89, 0x8713bb3d9567013a, 0xce123ed4bf08036d, 0x61c457d555d20313, 0x64fa817a37b4347f, 0xca6da0da85a376e2, 0x4bff3abd673cf071, 0xbbaba066e5825,
+0xfa7b242fe6e614a7, 0x8c9eeec8acc59947, 0xe57c6c66a992b41a, 0x58ce50f24970b3bf, 0xb0f5ba5703691eab, 0xf8dc97a9f94d63e9, 0x693dabe5fb1d3a78, 0x5dc8cfcff4e61,
+0x6b06e308500562d8, 0x6770ce63619e532, 0x9db3db4cb07808de, 0x84d90c4b6bf5609c, 0xe58e311d01128e53, 0x1f4080367ff80155, 0xaab43cce5eb7a084, 0xe0fb98913ede8,
+0x6348ab5e495dcf72, 0x30d32e81874f15d4, 0xbb626cd6c565ec98, 0x888c2d247310607e, 0x1b80262e8227a901, 0xeb2d06f4bb9dd24a, 0xa341b3b60cf285f0, 0xe14c4245f001f,
+0xfd561aed7e16a2da, 0x1de2136d3c2b64e9, 0xa936b8f71ba6aee, 0x391c2c3b695474fb, 0xf1d1cd83ad601019, 0x68ef3aa6219d9b7d, 0x320a2b38275209bd, 0x44316f4e65efc,
+0xaad85eb2909bba42, 0x64a4cc3fb0a1e302, 0xa3efe674a1adb53b, 0x9382753b40a26533, 0x73bf28cc71396bd4, 0x756d615085753146, 0x6c49ed1918e1968e, 0x19b0c0c0ababf0,
+0x2dfb5239e972839, 0x666ac5e29b163fe0, 0x98ddf0551f9e611e, 0x892757f008eec713, 0x2e52de345bd30354, 0x3af4ac15922d1613, 0x544d34b877cfe4cf, 0x2e13139c3442f5,
+0x4fc11bd14b397bf7, 0x72bcb25d75705f7, 0x485832faec9bd0c9, 0x8567d101ff141d18, 0x41948b7212d303f3, 0xbd7a3305a941ed29, 0x3b3f1229f3d8d4dd, 0x13ad78f1943be6,
+0xb67e19f329624b04, 0xc192ac7a46799e4d, 0xf9835254771a76e6, 0x99d41163e1c4e442, 0x5cbe100949185309, 0x449614e069aabe26, 0x40eb2546c5e54da9, 0x9156ae57be371,
+0x121664bedfc6017b, 0x14166e9940db1c57, 0x7a3e8e7d9b13d3ab, 0xa91695009f8f8307, 0x9a7a5c03c283af54, 0xbecf64ecfd91ecd9, 0x4b90fbe5b247f778, 0x30d3abb5a19242,
+0x709f0f58a2138b11, 0xd625588b845b06ee, 0xd3b769b6c1b3775, 0xe55cf5850b371504, 0xc95662cd4fb0c3a, 0x8ae0167932579f6, 0x6d4f98b84d354bc3, 0x160d99c8ee8e4,
+0x7a8df0ea6cd1730d, 0x84d13e638893fcb0, 0x8c0eb0cb64dc6b02, 0xb372e4def4c9191a, 0xaa34b9ba0a0825fb, 0x67745c1228820c9b, 0x9c6d7f1bbebb4c14, 0x8e915ab434c4d,
+0x1165156858d3432, 0xf7115c5482752f60, 0x4c6e6d193041b041, 0x7addc8e469ba5e96, 0x6f9c0449dcbb163, 0x94d1e02ee1a7e99b, 0x2550af8c02e3f983, 0x36ede150951f07,
+0x93e82f80953861e0, 0x80e9750a41b00f92, 0x5d67f100aff44c01, 0x2d55bc6ab12c9588, 0xbe5a860206a3bc8f, 0xe4f1418205fc4951, 0x111821fcdd648327, 0x36be34b234f3b2,
+0xba9dc01bd0792ffe, 0x9d09c74f9c1628ee, 0x2cace28b6287e998, 0x88d86f13bcbc84f5, 0x7d8dd92e48bf4954, 0x7862b9174e73d6b1, 0x33e4d7ad2458f8cf, 0x39a73dc8aaa794,
+0x949529eeda217c22, 0x7bac1a6619be75c1, 0xdc803d64e637cc6e, 0x2f7492e2043e5f72, 0x11171695493a5e2c, 0x6e8ac100a2bf0bab, 0xb042a004585f69d9, 0x1e95d1655d4321,
+0xf375730a8d26abe8, 0x925f4b90b0a07db5, 0x6e01ab9c7535e7ab, 0x36bbf5d2c6a35a92, 0x39ea3d6c1c13f7da, 0xdfd2cbe7972681d, 0xb13cdce65d9c0b2d, 0x1ab60416316092,
+0x36e3dd3017548b4b, 0x63ff0f1ba0c3348a, 0xd2416a82c8366cf8, 0xa2d4b266dfb77d6a, 0x5aed32872596d49c, 0x1df5586e5ffef9e5, 0x1279ec44d3bf003b, 0x1c256213c8a413,
+0x7addd92868d01b34, 0x31d171896c18b4fd, 0x16dc62dce4f5e8c4, 0x496f87fe574babf9, 0xcfa02f3a1212b21e, 0xb05575e58fb0238d, 0x8f510236ce6adb9, 0x116d6aeb3b4f75,
+0x505f1d38d26abc05, 0x3909405ceed61609, 0xfa1b7e8d5c03066a, 0x69eda72cbb7ef36f, 0x50046bd3f0d090f7, 0x9fd8787853c05b9e, 0x5540e9514513260a, 0x1d997eb019904b,
+0x144b58f557b39975, 0x3e1f0168515eadc9, 0x586494f6dd0018bc, 0xfc926cefb75962c0, 0xbc2c1ded41d022e1, 0xb07fb4484cec0c80, 0xdb33bc262d81ed78, 0x2901b6ff359180,
+0xe21fa43c25a58d08, 0x61556bff6cee0b80, 0x75b21e76219ecd62, 0x328accd69a076727, 0xd89f72608dd572df, 0x28afdca869d29ed0, 0x5982132164095e02, 0x4021729d198388,
+0x816c7985aaeb2c0a, 0x243d79204c507627, 0x896e18645f83050c, 0xbd74798b8ee399f2, 0x538757f6d48e32d9, 0x569aa7885d2da466, 0xe51af5ef4dc3f3d2, 0xe581b01b5f29d,
+0x8128d5c4dc44ed2d, 0x3341d8c7c9cc4af, 0x7e0dd80850f1f7ab, 0x252b43c5d7e21c68, 0xf95426f2ef3d2b56, 0xba552149a8f38, 0x81383d0f198b542d, 0xee7add588355a,
+0xceff7880d1309c66, 0xc03245e1449f87b4, 0xe5c5f4fde4501c69, 0x57f533aef917f355, 0xe715a4023be6ffe, 0x2e55ec4081599a95, 0x76d07c9cb43429fa, 0x21fef6e5da6423,
+0x2b6ec3b52f6b024b, 0x578041dcaf256fc7, 0x3239370597afeed4, 0xaa5f59c0275384f7, 0x9c41d601a7d1c603, 0x525b7fb8c9601be5, 0x434f60c3129d908a, 0x3a54c9d079e267,
+0x60f5fc6790ad8978, 0x3ead7710ddc49565, 0xb3b497a1baeaca06, 0xe3439821619dbdfb, 0x8402ffaeb9fb0ad2, 0xb333ce9f325ed0b2, 0xf855c1ea43cc98ce, 0x1f681ddd795d3f,
+0x1ea03dac1cc87221, 0x5d2bd793c03cd4c3, 0x8c223af1b8335e85, 0x7f1ce3f99ec8fdd9, 0xd5d91f58d6287ed8, 0x2fdaeb8a1decf22d, 0xa60854bee5c8dea, 0xa8c5db31378f3,
+0xd05ed0bf3d1d88a5, 0x7555f875235a20be, 0x44e51f49d6cea766, 0x8582ab0b3b924166, 0xb970c5731758e300, 0x3d37402f40dedb25, 0xba795e20e57790c5, 0x254bb74d9b295c,
+0x8f9fda983fc35b12, 0x680b98e7d98dea17, 0x356c34327dc67930, 0xc5247cd72688b768, 0x44ae7f6d2e9cf410, 0x767d56c21cb2b39a, 0xcd783814f86a7e41, 0x111524c3658002,
+0x59ce03e927841875, 0xb1f809132cd18a2, 0x6d6efde59269764c, 0xaf00ffbdb3774974, 0x53aa146b5ca617f8, 0xdc64fadc5d5a76e1, 0x9b169a602ad5e28, 0x35098515fc491f,
+0xb455b422cc00178f, 0x8569a048277c1ddd, 0xa56bae28c07da582, 0xefe4513c2abe7554, 0x8c5effbd77327e30, 0x186ccac36154c44b, 0x144fc178025810cd, 0x12285cda1f22da,
+0x331b52160c805b37, 0xed16efd5c1be4352, 0x1f7313915540d72e, 0x5e49595a17b0076d, 0x64f559f889964f60, 0x424ee42dd4c9d166, 0x1db4765ab5c239d5, 0x3e94af2a219517,
+0x4b3342ca26f731a8, 0xc69bd382eaaa168, 0xd4c738b29ecd5a3d, 0x8ccd8cc153ba6933, 0xa0c328e8acd0f511, 0x8521d1bb295cdfe6, 0x61eb0478023ff1fd, 0x142956e0d35899,
+0x8e41776ec807ce8c, 0xfdab1a9868f2b6f1, 0xeb5dd8345f8a81bd, 0x312b4bc412f6ac9e, 0x58828ab0a63a9c14, 0x5e0c4787c9e7699a, 0xd1802a7beb1a2e9d, 0x3810330c0970ca,
+0xe305bf147cf60fd9, 0xcceab8b2c59c5aef, 0xb1352be543fe5d96, 0x7d3f33d5b4052927, 0x957729d6b512e500, 0xc7b0fb03e295f9bf, 0x412e57de90b02696, 0x2603ae1a2585ad,
+0x1134bf5f3597cb4a, 0xb342f2cf5658933c, 0xebad7ad4d71cd935, 0x2d532b1ff756d4e9, 0x1a13f092a6141c7a, 0x4b488e58ac41260c, 0x72471b4609585185, 0x334220f8f4d25d,
+0x576bbc2c8d96b414, 0xc43c182e21f14edd, 0x809eaa963849c8a9, 0xd994d8b4fc8d1f6d, 0x99ec94147031ab66, 0x3cdabb79d0cde0d5, 0xd71ca384be8746a, 0x38d6d09bf8331d,
+0x5fc7de93b6595a2d, 0xaaea45bf8fbda917, 0xff6bf16b53030b6c, 0x6cf4276b88121e68, 0xa8bfcbaab7d1a971, 0x680d7c925d4a5aa, 0xd31953f2678e02d8, 0x3070d1ecf49b27,
+0x9c35412bd3a98aff, 0xdfb8e5ddadaef1c8, 0x9c75f9e8ad0538c6, 0x1fba7a26c269b25b, 0x752ac8498e8ac405, 0x888caa0897097731, 0xacb15f745172b32d, 0x343161e3e30e43,
+0xc2b745d5ff6b7ca5, 0x23f673755f1a12d4, 0x4399be48750b83f0, 0xd5edffab9e6423a9, 0xc8c9544873fe706e, 0x1cceccd54e79e4e4, 0x5e0ce08610e736a, 0xeb17b549fb5ac,
+0x17f2e00103eba15, 0xb08739fa3c9a865e, 0x3510eebec056ae5c, 0xf1adfb5d66b06296, 0xf124c716a9a2324c, 0x6a389062fc7e624c, 0x6991d2e10c1e67c7, 0x24981a0ca1f73e,
+0xc0d3777eb9c3ec2, 0xf9d299b55b7e06bb, 0x6f68adb6d9512d97, 0x384a78a859dbeb26, 0x4d6624c12aa4f88e, 0xea60d164fe7eb9bb, 0x969383ee72653c68, 0x3bd867b61e0d21,
+0xdd56a018b3fbaa62, 0xbc0941e4a61a0d7c, 0xfe3ce65ccae1233b, 0xb68953f48ff924b0, 0xc93e94e1e5025f5c, 0xc411e35363c41bc6, 0x190340101d147f03, 0xf11ddb8984b7c,
+0x19ba21813a336628, 0xcbf072a642756386, 0xaed5d9f8761132e9, 0x37a88f936cfb6590, 0x772e8c3c2b0b6393, 0x3b5ac2edc6e30866, 0xfeee137aaaffe133, 0x392d11302e0406,
+0xba5238b493a12654, 0x3180298c885a6493, 0xf866bd4c8d440e99, 0x1e949ea76f55f1aa, 0x4698636066c6f01d, 0xbd9957d942fcdb9a, 0x273e926093439b0d, 0x16e3092efcc06a,
+0xd56fa8d484c3b703, 0xfd58c5553afdba4, 0x494efe871ef2ec1e, 0xef4d757fbafd3c18, 0x93a8ebcdbab7536b, 0xbc07fea00fa75f55, 0xd8e0a16c12e5b05e, 0x161087ce151979,
+0xeaaa1fdd35074378, 0xa90c05f3bd41349, 0x3193c0dd685d012b, 0xab3e71b6919c4bab, 0x24d0addf859f924e, 0x22ac112bcba3f1fb, 0xcdd1ac27093efff0, 0x1d86e2d4146be0,
+0xfb94d8416537f304, 0x9b03f34d8f15864e, 0x241338b45d22216d, 0xbfbcff280a97020e, 0x3aff96f9e641737b, 0x2d3209489dada157, 0xa4de0d628496542c, 0x2a510b51a1ee4a,
+0x8ae75d91ccb66a29, 0x1bcac58a558738fc, 0xb2da39de55f20e3, 0x4fc1730e0a89c011, 0x1accb0c393c82e6c, 0x5f64053b2b41e015, 0x374abd31d307b3f9, 0xc6dba42944cbc,
+0x5f8c87b5fe68f359, 0xc50704e16699ac90, 0x8ea1857e42c3a961, 0xf6e8ee36f57cc74b, 0x1f9bc251fbdd8ff8, 0x39d57aa74c928935, 0xb5a4e4cfaee8ae7f, 0x1efa92bced7155,
+0xed933859da37c841, 0xc6541454068736cf, 0x65ab6db86dc4c1c2, 0x9e69fbb81e24db16, 0xe986dc82ffd81055, 0x6c4b14da06b1c48, 0x84d2b9c34614f87a, 0x35d74207aab07d,
+0x367190bae76466af, 0xc4ab84387e055ce6, 0x6dd23594c4be38a7, 0x1160b1c4eee11dc4, 0x90aaea73e591971d, 0x4dbb24f202eca0af, 0xbfa1c6a0674ce96d, 0x448264ebc9de9,
+0xb0f6959303b5e7ef, 0xb2fcbf98f87b3d24, 0xfe91991f78616a0b, 0x842cc6bd93b71ebd, 0x597cdee9b650813b, 0xe2ef54c945ee102e, 0xf3c9e403b6f0b8e5, 0x1977ccce64d1a6,
+0x1e426ced75516bed, 0xcd9176338ea82fac, 0x18b35de895733fa5, 0x498c0244d1ee9805, 0xab74f00bd075d700, 0x4e842b38ec20adc5, 0x73b24f16ea388881, 0x30bc670223feca,
+0x166016922902cb1, 0x86a6987d68e940dd, 0xb3dc106630e3916a, 0xf6961b12b2f84592, 0xf0460ca621fa8f4e, 0x9d5bd7ed06601c28, 0x23949557d87d6476, 0x3cc388654155f3,
+0xc20b3ac429ef3226, 0x17bd0ab0c9f8bcc6, 0x895b0733dda5d090, 0x728f700121e7460b, 0x2ffe254e409b8da7, 0xbca16522fdb94037, 0x7812b229aba495eb, 0x25f1d04978d2b6,
+0x4f8ac708a0e462d6, 0xfddfa455f4560a4a, 0x629e02ffb733511c, 0x30a38b8713392ced, 0x9a4d1000b3ddb6f, 0x762cbc34285203f0, 0x7051bca189e96775, 0x472070e02ffc9,
+0xe6dca5dd1546f4fe, 0xd18c82e6e1a54791, 0xe4de713b160c1337, 0x530de02257611cd1, 0xdb23929a314b9f7, 0xa7a5bb87caf1bc41, 0xd846852c259c57ea, 0x1b2a0ad5e18b5b,
+0xf75298107e6f5dba, 0xff9b951c557f98a5, 0x6945f78c371cb3d, 0x13abaa037bd49a14, 0xad621659962c23a2, 0xa4bd374585bc1a2f, 0xd91a0f8e8e2d03c8, 0x15e54f6c0dc936,
+0xba72ec7bcc22a7a, 0x549011358df5bb0d, 0xad953c0d1ad41dba, 0x5deda68bc451117a, 0xa185a302e2f4f0f9, 0x37349d743af2f1fe, 0x5eef1c120d56a09b, 0x2efe68397378ec,
+0x33be52d11166f1a, 0x7703f49c6ea67755, 0x865f284574ff076d, 0x6612e9377f556b0b, 0x2373bd939dafd90, 0x9ef458bd1fe5af5, 0x87c4ece7533bee90, 0x23b2545e6cb876,
+0x73e6471975777232, 0x4f04e26883555776, 0x817f578119974259, 0x3f8fe44adc5e4c7c, 0xecc6ce69428e526, 0x4db1cef0fa253eee, 0x6de8fc53446d9836, 0x227f1ea13bb9fa,
+0x32418fc3fba628c9, 0x49386c306265dea9, 0x59e100e982d9b7c6, 0xeb18ea0fe98bb7db, 0x9ac163f630450a17, 0xdfb6828378d4696f, 0x86407140da8660bc, 0x1f0fe4db7664aa,
+0xcf867240a93ea695, 0x8cdd603e21513026, 0xc6bbc1690f4b86b2, 0xb52523f557382033, 0xf9947c212d38b7b9, 0x7b7805abab4b062, 0xac9bd606331bcd3c, 0xbc1f0203637fa,
+0xf62de54cbc2fc8b9, 0xb8ec034b2201e8b6, 0xa7540ef880322d3b, 0x503fa703857ab3ae, 0x12bf437c71eb7198, 0x73c7b91f36257021, 0xd927987c8c7ff034, 0x18f84139efbb15,
+0xcf23b5a85b526d21, 0xed6f1cd629c7162e, 0x3fe3047be1090e81, 0x212f86b996516c4f, 0x2159680899798768, 0x9139cc7bcfa0b70, 0x23a5adf60500f727, 0x22d2645fa54a0e,
+0x8edb50440e450836, 0x91b960cc3bcf584e, 0x70764929bdfc378b, 0xea4ad2a01f282083, 0xafedbbd29bca7330, 0xf54781aac84556b2, 0x8ce560c6328d079c, 0x37c6e488655746,
+0x19644dd21b53f275, 0x9b06a9c7de2ea170, 0xdc79695b489d808d, 0xf49b8643fa12fa87, 0x407d4201c7db1756, 0x9ae1422f2619dc27, 0x70113bef833e750a, 0xcad52a777f890,
+0x86345d1afa86116, 0x5b041db877624257, 0x638a4c990dff75c9, 0x548e661a5140c875, 0x95ea2c17c6cc7e12, 0x835b8f96e21234f5, 0xb97082e05efa4f87, 0x400dbb6aaaead0,
+0xbfba71183d88a9f4, 0x77e613af96a3f387, 0x71af0493ce401278, 0x40df8334e4af1f7c, 0xb710a3c8d9ef749f, 0xae03bb87e6f237c5, 0xd42a6b711f77d439, 0x261e4f12e31b20,
+0x6bddb516a9f799b9, 0xf26869985dd0988c, 0x7b08bd4984c1fb0e, 0xe91832cb9bc78c69, 0x3ae1b1924813679c, 0xa2f64288fe824f35, 0x993abbd7d6de3cec, 0x27720502d68267,
+0x2a58d06352f42957, 0x90d95027641f7cd5, 0xccb234bdb03c7b01, 0xb5ce34ca5f5082f7, 0x47f6c4f8de9ee2ce, 0x246ac0dad555a1b1, 0xfb0912d76d92ad4b, 0x1e9d363e192ebf,
+0x91246f0bdde17296, 0xb0ce3770f9e8fabe, 0xcf99c58b97f79c1b, 0xe774bd14170c2d36, 0x4a7342d90c9ec085, 0x5d2d1163dbe6058, 0xc5d0b5fcf6af9e4e, 0x1f69221ee6c4b5,
+0x90129bba5b4aad55, 0x3551a5d545ee9e79, 0xc331a848cee2566a, 0x288bddedf7bdeec0, 0x857fde1d1aeff848, 0x23e80ccf25e273a2, 0xed0633d6f79ec973, 0x3d4dff467dd4db,
+0xacaa2e914ba3a2db, 0xc0812574d15d1dae, 0x8542a561a004200d, 0xb0fc9772dd351399, 0xb0c3d244eb936a6d, 0xab1485a3bc079541, 0x3243b6552e1d81ba, 0x21f6feed13b452,
+0xcc2b26025331a277, 0x8805134dee10e3e3, 0xe641bb1cfed2f9d0, 0x9ea16b41acfcddfe, 0xb1c4ffec70eec53f, 0x2e1e3555918cf56, 0x3262b3cb54d3a17b, 0x3c432e371a3e69,
+0x1fa3f4bc8f0a1dd6, 0xc8a51766b2833af1, 0x69be5dccb466a860, 0x946dc0bdc80f15a3, 0xbad905af4c9795e8, 0x532632711f75c720, 0x7aa5e50eaf4dee22, 0x2407b340a98d69,
+0x92acb7dd08eaaa98, 0xc52dfda92c35665c, 0xe58a7cbca9731f8e, 0xa35196cb6aac5e90, 0x4728264e2f20d6e7, 0xc436d0a8043951fe, 0x7bbd139040593cfc, 0x1ee87e1a06c68a,
+0xf1af1b0443561f00, 0xd6d76aebb7c6591e, 0xfb78ae4934d813f3, 0x709e158de7461961, 0x9993255d8a81b5f, 0x806e41766aa59f62, 0x3a65eaab807a9093, 0x95261bfb6736f,
+0x6bec8f1ff23b1b41, 0x439c2e70844ab1b7, 0x2fd13a2007011991, 0x728169eb96fef9c9, 0x77e1df00fb55f6dc, 0xa03467b257e68eeb, 0xaf436368bd42022e, 0x1869bfee820f11,
+0x242fc908330e62b6, 0x6958979c26ea5ec2, 0x4bb07eeafd7644e4, 0xb323e41296ac57e, 0xb4b7286ce94f4a6f, 0x66b2d426d8f7aea5, 0x6bbea3f23f474f69, 0x36a36b3ab414a4,
+0x356d2f7032163c16, 0xdef7c404b9d2ec2d, 0x5b5aaf9a92e70db, 0x53f46537396d39e6, 0x35383dda2d3b7bc4, 0xf62fb7bf211ea5a2, 0xe154011c44328c1a, 0x14e09e3e369797,
+0x302feba8e26b22c6, 0x8e8cd446ca192a7c, 0x6e4ed92e39998b59, 0x3d817cc9686ce2a5, 0x177e42c2b33e7d13, 0x35f2f2ab2579f2d1, 0x6e1bd0b88e0b85d7, 0x29c56345222497,
+0xcda592d597eb0e7a, 0xc10ef4a4ed48e3, 0xea65757155ab0833, 0xd352a0ad36e6450, 0xa2d13ddc5e6d776e, 0x1ececfff49032ad5, 0xd3c2ef93c81fa2db, 0x3ce9dfe1cfa10f,
+0xccb0adda91c6e4af, 0xe4e4ed75441c897b, 0x7d74d3bedb8207e3, 0x945f9b066a157dd9, 0x996ac10a088dee9a, 0x815136ca38062b33, 0xd249b3339f3b33b, 0x2d41d3f0a36750,
+0x1e94cd598bcccc22, 0x2f8ed16343a91461, 0x32114ba9be2ec7e, 0x382e45353c5d2cad, 0x5320a83255d56cfc, 0x3c62e0fba03b14f3, 0x92eaca5b5c1a9636, 0xe78dc4bb21454,
+0x1d6f59d4d5647118, 0xb6cc9a6cff181bfc, 0x807dbd3b7947429b, 0xb92b2d0209ff8bfc, 0x8d117c846b395745, 0xad2aa25d0f591f0b, 0x3d60e4915802cdde, 0x312b6c47c28eff,
+0xa3fb878dd3f210ff, 0x44a01cbe24855742, 0x6ae1b3ba41f180f3, 0xac88331d15eb59f8, 0x85e1d66ea831cd3d, 0xb40d8707b912a283, 0xd9e4c6875e9490ef, 0xc4fc6a5d08a7d,
+0x37d700a1e2a5d775, 0x3669556b9f8b7b00, 0x464619cac076d122, 0x62d894c6e2a09013, 0x8996e7faeba9f105, 0x4e78a828aa5610b1, 0x1f5c1c92b480b16f, 0x24b94dbd0056ec,
+0xc6d0d52a6cee0ee9, 0x28c8098751017368, 0x7bc2c9836a0e1fb9, 0xa3b701fe7f9041d, 0xfb626b10cb6b9922, 0xa294f53ec9ab7367, 0x1c43d61504f04b57, 0xf5558286fb910,
+0xd7f97ec7082b80a9, 0x369be7f05f5546f2, 0xab1e09f034435f43, 0x892dee1672bece8d, 0x12dd53b41eab18d2, 0xfca6f7455386ba0d, 0x1cc9f8f422578979, 0x9a7847b05acd1,
+0xd0512aa470da4bf0, 0x96434a30f92b4cb6, 0x2a5361f80a4e6aba, 0xc9be0c2509ff0175, 0xda97850dedbc0d5b, 0xe0ce58ea21318445, 0xf8acdfd7230efbf2, 0x27cec26125a6b2,
+0x11d649be4cb6ffa7, 0xcba6a9a2ea1e2cd8, 0xba219b06faa1efb8, 0xb4e24b8fda14f97, 0x45b035149cab63bf, 0xeee9df88023aeb80, 0xa22df13d30b819a9, 0x30be20ddb48779,
+0xe736f97e2b099654, 0xefd45c9cebde7086, 0xd08038469822f9b6, 0xc7243421fdf189cf, 0xb5f373aab18cc92, 0x6b5f9adb6ad4daff, 0x348861bc4c9bea36, 0x376dfccfd6e7fd,
+0x20302224f35a45a2, 0x40bf824df61a533f, 0x3048c3f635297dcc, 0x3390ff2ad5e9e84c, 0xb91a56c1a637aaee, 0x33c86726eec09957, 0xf8c231baa2d41045, 0xd393f9a6812f4,
+0xa9b8ef613464f457, 0xbab473cc428b4fd9, 0xa3f492f18e72c69, 0xca1bc543ba2bb338, 0xc99e933cb4bf6d3e, 0x33aec04faa45687f, 0x4aa4d881eae0b4a3, 0x2f44a18a85157b,
+0x760d6ac9d5303ef7, 0xf8f37797457fb276, 0xa9cff72d9b72cadc, 0xfd79dc8f8d41f5c5, 0x90b2b0e497f5a05c, 0xc070177230fc6e16, 0x237750b8a7c88f1c, 0x2738831658a83d,
+0xc4d92da343f7f9a9, 0x7d6831da504266ba, 0x7325d5bac9d4a631, 0xb1c0947e9d54eacf, 0x8677b29efe7a9908, 0xc69392d2a3974bbd, 0xdbb9905e154c2c19, 0x2ef678ed78ad66,
+0xb84b825f749a2a22, 0x27a2177dcf52a786, 0x105dd64a6fd23b13, 0xe9d7e57ce10de366, 0x64fff56922716191, 0x589b3853bb3fd4a1, 0x337c833fdb490665, 0x275ef2871a62a2,
+0xe51f645dd4479c4f, 0xef82ad2e2d2fe307, 0xd984ab97c5eceff8, 0x8c9ca064f8990626, 0xf4975ae8da928a26, 0xa8eca7f5b67ae3b5, 0x6001a2bac612d754, 0x338d715e5d2669,
+0x914c680e9dd02f2f, 0x17963d9abcf4f34b, 0x2608e5684c38461b, 0x73788a9bd0dc178a, 0x38ae587d5aa692c1, 0x34e0d6ff511138d, 0x63c4857161b98408, 0x15953e51794b86,
+0x543c599393cd9d36, 0x524ea69438c413c3, 0x3fe209b6e3436bfe, 0x97be03b8dd006e3c, 0x906ba15ae68cc5c8, 0xb29677690d7bad6a, 0x439bb85427e31c57, 0x19f1361f35d4a5,
+0x6c5108d96f910c4f, 0x387727748dbc3dea, 0xe36c2846ffccfcf8, 0x54f615cad9a49a1c, 0x44d1e011b0f0512d, 0xcb9971a9160ace4, 0x32ba2a64c995bc2a, 0x30051f0913c123,
+0x4440eb4fadd46e0, 0x1dbede27111e7cd9, 0x139b1cf6bec063f7, 0x2b7ace63f690e334, 0x2fab9d9bb73b2d86, 0xbb1db2c8b6cbcd69, 0xd0448fc442d189c9, 0xc93aa5cd0923,
+0x79aad7bae5c9123d, 0xbc0f9d11accc4b23, 0xf442719c38bdbe4, 0xfa0439afecd1ebc2, 0xcaa01c553ce195df, 0x7dba5b368ef8da4d, 0xbeef3ae40b49c306, 0x2e4eae98e31428,
+0x2ebf90cb6242ce21, 0x680206d79d2b1af7, 0x883a2d410a0064c2, 0xe4dc87e7a19d9442, 0x1101b381b4e44912, 0xcc47112b6c62a8b5, 0x33764c1f4f42a358, 0x1fed2646439fd7,
+0x828312727d75f5d9, 0x134a9b818903337e, 0x971f1608697c8e71, 0xc390f9782e06d220, 0xf97b558060db7147, 0x496dce63afbcd699, 0xc078527456d4a63d, 0x9fad47b706689,
+0x460f728a48cdb655, 0xd8348e18e8295443, 0x1b79e7246b004036, 0xb61ecb99af2d07ca, 0x8655b2969686b70a, 0x2d99c43aa20826f7, 0x4b5494039a6abd15, 0x3b16d06dd8f63a,
+0xf08d48453510c7cc, 0xdb77f4397a55369e, 0x1ab2f8d2d4a56e0e, 0x3e34b23d865016d0, 0x97027ac9f28041f4, 0x7e267121f2445564, 0xf24cf1c49825d78, 0x20c286b0ffedf,
+0x4dd1d13ba1750c1a, 0xd0c0576a2b13d8db, 0x99422071c3f067c4, 0x68b905d0dd423446, 0x452d435645f1e0f, 0xa92d703059afa341, 0x58ec62ae418112b8, 0x629e6b0d005b4,
+0x6a2577a96a848040, 0x3768eb37d5c45629, 0xddddafcbfd1c2e01, 0x7f9b5eed444376aa, 0xc1a1b6015a928d8b, 0x2738fe01c2eeaedd, 0xf707c98438586bec, 0x18a4fb3ace45c3,
+0x171be79105a6714c, 0xd41d91db67a8b2bf, 0xf1764c59d5c7641d, 0x4474512d20810172, 0xedc98ded99bfcaff, 0x2b81af5846c2b23a, 0xa97b736a8bb4c55a, 0x19d01afffdfa82,
+0xf5d904cc456d6be, 0x271b0ecbf462521b, 0x2bd6bd4a68dd379, 0xc1e0f7c48ad3eda, 0x874d1d94424b1a63, 0xb368566a40b6be0a, 0xd0225afad5d874bc, 0x2f24375c21e3dc,
+0x5a44190b93cf9495, 0x7f144429bb405436, 0xf895ac75733dcf8f, 0x22a12a8cb41920bc, 0xa2df55a87ad758e4, 0xa4d976a61ddbc893, 0xe7e32b4471a22b22, 0x7e2c2390e5b16,
+0x20b5ae036d0548e2, 0x988e4e8f5bafb15a, 0xefc068dec56e52f7, 0xaaa9ab234f40bd7b, 0x4a44816179ac8939, 0x77f64ddb7ba35a2e, 0x51bdc96d51b8b397, 0x1cafb5f75692e3,
+0x528ef9d0cede78b1, 0xc1fcac28961f01b0, 0xc4db4ff24a0237c2, 0xc939cf2b06512997, 0x9caed0de5098f241, 0x756fc4136dac0fc0, 0x93533fc775dde400, 0x318224390ff4c2,
+0x6c1afe10910cc5f, 0xa7bedab2d3b39bcf, 0x9c2a9afe16e74333, 0xa3b19c01c47d475f, 0xd9dad5d85dbf4e44, 0x5f33d3ce2d6ad52d, 0x8b9e9635a503334c, 0x86dbbe1ac2c0e,
+0x71c005fe7605eef, 0xd5ddaca4784da984, 0x39238a2da9502220, 0x6fa1109ed0262b64, 0x70bc19b4f0560f50, 0x3a24056dbf093113, 0xee0304b69029863e, 0x1c2ed128292b7b,
+0xf6586ed84170b832, 0xdbac97f5efe3d72b, 0xcbe7987ecba9ae4e, 0xf3cb11bbd47a4d42, 0x6f3aa8bb15ec4ea8, 0x70533a9d00541e48, 0x5b21a7f58678dfff, 0x2ade8436af8c9a,
+0x6a162f77c9cfae25, 0x1f8a51415a6a9823, 0xa773453d241e3667, 0x7e8b5c67e133e40d, 0x97a379d2e9e63e7f, 0x1955e52ebca954cd, 0x374c456d26fa9c77, 0x2226d45fa9b374,
+0xe50a5c4b947c6030, 0x9439fa46513cb4af, 0x5627cf09063d4b19, 0xf89b451f696ed86a, 0xc3374ca59a5f69df, 0x9aefed44aba6975b, 0x64c8613d308ce0b1, 0x1a46f2f79ffba4,
+0x78bbd5b7a997463a, 0xdbf700ad9503d26d, 0xe399c78615f7c1f6, 0xc85243ef04b58159, 0xdfe87b3f0a50cbef, 0xed53e7779c941509, 0x90b671f05fa388dc, 0x86712ae6d4e94,
+0x8ee67f2c500f4a99, 0xc22d1e04689a2924, 0x68e76ea35e047433, 0xd273bfca9daa3016, 0xb3c6a497733baf3a, 0x2a8028f9c1a4e09a, 0xc95c93821201d5d1, 0x1b3f1ba85ef2e6,
+0x7c92d66ed18df63f, 0x349794c2391696ab, 0x7319180069823f51, 0xdd9013142bece733, 0x7a97e708f2d7ee64, 0x7e14ee61805a2c83, 0x194028006e059c72, 0x2a6fb6ffebc5a3,
+0xe92a07f56c7a26a1, 0xef58400ef9d70fa8, 0x9a140aab5691148f, 0x8635853e23bff264, 0x6313410ac4836acd, 0xce8c833bdd85d14f, 0xc72527e6c456456b, 0x353abc39bc851d,
+0xaf2a266610c600b9, 0xba0f22b2660ef, 0x3eacd9ed5c01aab, 0x28bcc87883466137, 0x148474398e52a779, 0x9641821e310b4367, 0xd7debe8d8b520329, 0x2fb6ce47a7d153,
+0x79231384a96e011f, 0x66ba72cdf8413110, 0xe8c139c2dec9f0a4, 0x712d274a3bd171b, 0xc893330cb891a79b, 0x4bc724b0a99da896, 0x1387e88b3df78777, 0xd90d00afd3f6,
+0xb1d7d0b91f281e6c, 0x7f8c771feb158663, 0x4f0ce05573231f06, 0xb7f9f0cba0a401ac, 0xe88525fe7e4d806, 0x9026c522bcf113bd, 0x7a5e5acba88b120a, 0x1fd47c1f412c71,
+0xaace6b69429b260d, 0x4e445de09a6b44bd, 0xb2662356697b9477, 0x97a55115b84d7b3b, 0xa16fce4bef042a02, 0x4cee6dd3c9f0acbe, 0x9d087df410c67a1b, 0x14a819fa26d7b5,
+0xf5cff14b6b2cdb99, 0x1013e8a05f61f24d, 0xa1473b26a86abbac, 0xdff305fc8baae381, 0xa8ba2b157beb3c94, 0x2439f16561fa7563, 0x178ac87042855f05, 0x528d88110ee0b,
+0xa614c4db04cf7c51, 0xc183a70cb95da6a7, 0xdb1521a3d63eb201, 0x296f718530b17510, 0xf02b1dea1ea7cb2a, 0xb236f89b0b82aab8, 0xecc0385f29f8fcca, 0x172fcb48dd9cc3,
+0xaf21206895c7869f, 0x76fce4d78e07d9a1, 0xa7bed402253be813, 0x9ba2dc3e0b93263e, 0xa6c9f462d40d19f0, 0xdbab992a9306d90e, 0xf529718cb22bd408, 0x34252fdcd23890,
+0xff89d23adead80a1, 0x706119eb13e23e83, 0x2525a81458f8844d, 0x9a89ec133959aacb, 0xe0c2795eb6506188, 0xc7d3ee25cf877027, 0xf14483461f1485a1, 0x35b64f8f6c5629,
+0x5fd4efbfcff6d0e0, 0x34c676686844055, 0xa5ccb002eeffab26, 0xd13f884140f9b224, 0x3d0bc0c1d4c24cb4, 0xed0307e961a915a5, 0x43ebc9a27fba8bac, 0x3369b9bbf4ab1d,
+0x196d65b06a2d4480, 0x1dcec882b1169cc6, 0x339b8e1b96c1568a, 0x2d03b766557a406e, 0xc2d7efc86fbc5a6d, 0xace1356aa741063a, 0xafc21752ee3553f1, 0x1b309afc9721b2,
+0x3d40a74703235664, 0xb6306e7f575cd12, 0x8cb59d471b82052d, 0xb7df6b6f270a0121, 0x38e1f7aecd21be1a, 0x29fca164e3e4b029, 0xd3a0d7bf51aa0e6c, 0x230e9295d912d3,
+0xf91358a8c3dac7f4, 0xe7eddf4f8a312d7f, 0x3f2d8865c5a7ac70, 0x4f5b65b7ff02314e, 0x455a7ec3cc35d435, 0x4763e5e18899f80e, 0xd71ac5cddd39cc18, 0x2bff35b90479e,
+0x2d3f55687023f6ab, 0x6cc5d2025ebdeee, 0x56b967322bb0d834, 0x604d271a20b3cdc1, 0x9860817cd94d0127, 0x718e6d9845d16c5b, 0xcbe4548f85835d52, 0x2f4058bc54716f,
+0xe3a091612fe5e6b5, 0xa14180e2d1bc9c05, 0xc132d9f4e88e7b1, 0x150dd7790a1848ce, 0xcdfe930a4be520ad, 0x649019245af2a0c4, 0xd267b83ef92018ee, 0x1c01273a7fb54d,
+0x553654e3dbef9606, 0xa1c452194edd7d16, 0x8e534433cdbff84, 0x988c329cdf9506ff, 0x7756465261fad90, 0x210cd7e3fafbeb3e, 0x6ce32c061474ff00, 0x38ba6b428887c3,
+0x84caa1a624369f6c, 0x1906aaa458195205, 0x8adc06b23e8599da, 0x106a1583d6708d76, 0xbb6de846252f4e8c, 0x11496001c7b020ad, 0x6d2862c38d187667, 0x150172ef38c25b,
+0x161f87b130b8f870, 0x2ab3630068cf4af, 0x16cf8b6e82a0f201, 0x6ac26831760dcd25, 0xd9b51bb3e214a856, 0xe9fef0c3bad8569b, 0x279adac1eee49830, 0x104ea8e5cfa71d,
+0xd830a0e3df7a9a8e, 0xe167b18dcc5f5893, 0x6bb93418d74f953b, 0x99c272b6a7ae610, 0xcfec812c4a8f14c5, 0x96f2a2d58a1fba6f, 0x2c04ec58dd2ae16, 0x33a463f045acc8,
+0xd3eac993f5416610, 0xe86c227c4b1926c2, 0xbca2e298f20544d, 0xeda6ec93ebfebbd6, 0x11bae7d6e30be7f4, 0xf5b0163121ec8c9b, 0x25f918b96b3b95fc, 0x2bc93207b5fa51,
+0xbe802535a8b76bbd, 0x55b4296e211ee79f, 0x7335c44f5c040334, 0xfc5e010d4cb05e8e, 0xa441df206753685c, 0x1974b59f173361e6, 0xbc470d5619523b84, 0x9126ccf2512ff,
+0x736f277b918f38ac, 0xa18daf3fab4e66fb, 0xa6fbca11068d5064, 0x6e675f003dfce67, 0x3034f8ec98f1edd6, 0x7047af41a97e4740, 0x9c083af120ae51b2, 0x34fb7984396424,
+0x486bd3d778a5b9f9, 0x47d7e9fc5265f39d, 0x38199639043885d4, 0x425d3c6fce05153d, 0x53b919d9d7786490, 0x9e1e9078c14bcf98, 0x4d79af09831f5dc6, 0x2721c3299c7865,
+0xa2811684697b9647, 0x530b807d17dda581, 0xd0384fc7e7a2c3cd, 0x555676852a450f72, 0xd8c909c6dc982e0f, 0x3b835f262c147632, 0x6c6dff91436e7d5b, 0x23dea7b0a8d4d4,
+0xb1692549b362341f, 0x671bd8003caf9b68, 0xc8ca1266347ef1fd, 0x9bf3f8fc9509b365, 0x3e013380d3e8cca4, 0x255e04bd8dcf3d02, 0xa6c652459e2a4b4c, 0x35f25351efa0f8,
+0x5937e9db11251254, 0x9d3b3621c6124ac9, 0x7c1d10572521414a, 0xcba1cef028210b, 0x90f13c70399d7c34, 0xa7f6350170a8486f, 0xa6cd31565fd747db, 0x3bf2004ce1bd44,
+0xd22abea647533971, 0x6fab578e90d97809, 0xa6980415d130e9c5, 0xc603d8558416a805, 0xe8bf9bd98c4fa3cc, 0x773a474ead86a126, 0x6fe3cebb5f2bc912, 0x3842edc4c7e00f,
+0x6b6abba235edb44a, 0xab7e200f8294eca5, 0x40c1fd3bc653305c, 0x49d66444af318881, 0x6246ebe2d25f0729, 0x5a86b9a6c57ae55d, 0x8f16859a5a370740, 0xfc508d42549dc,
+0xa45a0f7ec70e0c4d, 0x8806552f6fba8b22, 0xd519c7dba7469070, 0x2aee156eec23d176, 0xc89b4c63bca2bd09, 0xe174e07e484571f0, 0xb59844f6736834f, 0x2fba84a280506a,
+0xc2ac000cd9670031, 0x2d9801883ba24a15, 0x77cf736934e10b9, 0x1b826c3932cecdaa, 0x50498f254bb053c7, 0x2aa6a6e99903ed4d, 0x979308cffbd50983, 0x3ca094fba7a5bc,
+0x5ff2c45dfdaf546b, 0xfc864d7c35d052bb, 0x3900e90ddb6a1d76, 0x102665987bda5451, 0xb1cb91118b312806, 0xd319ef8731f56e35, 0xeb037f5028cf13d6, 0x1b5bf4a3e307a,
+0x1174cc3c465cf919, 0xa0e8832fd5ef4c55, 0xd44c166ce7ff3581, 0x1bdb785b3d4fa605, 0x568c5dd7bd2054a2, 0x25fe23405150d902, 0x47593239d5caa2c7, 0x107db948391418,
+0xc60f6d75f020a8a2, 0xed3af4ba29751091, 0x280c37dcad4ca87b, 0x37d517322da46cf5, 0xce0c0f64251e8938, 0xe84891c16dedfe5c, 0xf42839fa42d1172d, 0xa6c6c26d78dcf,
+0x737519ffa516e83e, 0xd02e547856386bf, 0x49e0c17e4ebb78ea, 0xb0de8e5db1c61de5, 0xc26e25308153a641, 0xca5b00e5eb82d88d, 0x29a8687251f1e562, 0x21031280e32033,
+0x7217ddb01efc0e30, 0xe0b8abeb34736aa4, 0xef010cfc18d1a46c, 0x37cde5372f8db0f1, 0xa7e58c5012180422, 0x43c54e6bf19a79c4, 0xd94de68da78237f2, 0x26ad7a457dfabf,
+0x54d4cf13aa551ee9, 0xd9aa9d66aac68130, 0x24fd3c957fac0a1f, 0x616d6762ba869ef3, 0x286d6d3f2486fe09, 0xe2c777b00df45de8, 0x6c829dcb6a99ef9b, 0x18048464cdd863,
+0xb7c05de96d0580bf, 0x552aae3902a1cb11, 0x9de2eeb1eac050aa, 0xf64cf64df22c45ca, 0xeb03ce6bc1150ad7, 0xc7df8793678d2b43, 0xc0181bb49bd1aa24, 0x27206188ba6b60,
+0x2b48e83e43a46a32, 0xdfa923a518e2c1b8, 0xcbc1f91aabcb636e, 0x35f5937ff36f7252, 0xd1541e7b41664974, 0xdceef301e3c3299, 0xf0655fc178aaf8c3, 0x3522a6f08ab684,
+0xac86ac95f5e5eac1, 0xe4d032a903e54f0, 0x5c9634693bc08cab, 0xc99ab5feafd3af2d, 0x9a698bd329f8d97e, 0x8b10985687d06b5, 0xc010a0e33fd0f3bb, 0x36c19d6f29f84e,
+0x374877112065c044, 0x6da84a89e02cc89e, 0x51304b3d67a6d2e6, 0xca060e3ca8847c96, 0xe21bdcb8ed38f8e0, 0x9cd6aa2c6ef66931, 0x403405a6853bd11a, 0x29a03bf504b49b,
+0x6c6b960bcef14dda, 0x25e9df761791ed8d, 0xe16eb0dc808ad5d0, 0x3279606b9b563aa1, 0x69f1da5fcad98d2d, 0x11f82d1c52d64265, 0xe60c52a81a532051, 0x20002457acc216,
+0x96c5d0e86153abb7, 0x935679f235c9dddc, 0xa39f3b0dd055ca8b, 0x478e2c5fd99e685a, 0x9ce77614c3f83de3, 0xaa654e604366de22, 0x6f1cda4ef9e0980c, 0x33af0b454d5b9,
+0xe3903bebdeb15aaf, 0xcf17fbe88b8c1756, 0x264e16c195d5b563, 0xce28b3ebc0fcc763, 0x9408e8e426d4a15, 0xa33ece8bd9975ba0, 0xa136ec5fb53110b2, 0x2782f3d7bb1a58,
+0x3e569daac35cd2cf, 0x1fe616d9846b2e90, 0x46dab3f2c9adbd97, 0xf6d90fe65e4676cf, 0xd5c299b8da6ce9e9, 0x69d7731eaab55a7e, 0x89b12512317ebb74, 0x33f4f6b69f7d99,
+0x7a39e4c13d83232e, 0x1ace14432d996d05, 0x888430f88d3459e0, 0x44b6400f44c918bb, 0x6736def67c57b9f1, 0xf4a4e2e9aa30fab7, 0x27f47751def865ff, 0xeaf79e87d51b,
+0xabb7ee756e8fbb87, 0xe3ba1f46dc5497b5, 0x54f8b12bf2989de, 0x8fadb12608942622, 0xb08fab47a29af8a5, 0x7d1cea92fc925da7, 0xe3fcd75dcb78e445, 0x1a80804f66273a,
+0x3fb9947c71bf9f86, 0x3b4be3fa9d349622, 0xb725436c1822baa7, 0x6ac1674237d88e90, 0x12155828529c4478, 0xb4377c46485943f8, 0x8e77fdcdf2c0ea4d, 0x10156739dc1345,
+0x82ee543826984ca9, 0x751501833a8f75ee, 0x8bb026ceb9b5189a, 0x549a48e5dbe41c47, 0x4ce130b06df8585, 0xc07c0bbcb0fe5fd9, 0xc434aed1e32766b7, 0x382da7bd017423,
+0xe88fd4d095f124c, 0x1ca7c455e1a99b12, 0x98ea14904c2bbd37, 0xebe182d503fe18f9, 0x768bec9e17035042, 0xe7c008a73cf3f4f7, 0x3caa8bea831007c8, 0x1a619a1bea4666,
+0x21854a40d1a43889, 0x74148c6f12e31ebd, 0xa36c8d5f93a378be, 0x533e50982274af23, 0xc114eafa5f141f0c, 0xf8e5e4090bed43ef, 0xe68498f27b680217, 0x2fe3580b697a38,
+0x21cb8d70b5b7de09, 0xb391dfcbe6bd662f, 0xf0701d6ef1f4c5a9, 0xa5e0f793a8a77086, 0x3838cffd5eb4ad14, 0x33097081a6f07d83, 0x86094320fd53f364, 0xa21b77b6044fb,
+0xeaa7505df8dd567b, 0xfffca8ecb489743a, 0x3d331cb0694b523c, 0xff5302ec9a650bf1, 0x882c3c77b130b1ac, 0x2c9f112cda42ecea, 0x360763390c751fa8, 0x3db8594e0a047c,
+0xcda17353fd8e6f93, 0x62b6ad9bce2d7c45, 0xa66a3453de10b4b, 0x6ef276bf08ca5cd, 0xf0c10a27d306552c, 0xd2b8df7d21a28d91, 0x39737de7e7bc87c6, 0x74b9ef4254673,
+0xf5ff486d3e63ae20, 0x87bea9270f09be3f, 0xdfd2cf4239cd5aa4, 0xa674729c2d343e6, 0x3e7a5dad43e0fbd0, 0x158a5b85f8a629d4, 0x435011a33215823e, 0x30e05e4412b53e,
+0x41652ff4de329e9b, 0xc2a70b8a4e719169, 0x8f25034682c72af4, 0xaa59ab10dd06952a, 0xedbf6b3ae1cf1cbc, 0xfbc2832548d8c407, 0x5619c728a3646e77, 0x1b087a99a95761,
+0x755ac59ba3cdd989, 0xb06007b5886b25ad, 0xb871ed0bd4e774d7, 0x903f0563ca8dce6d, 0x47049b97a86969e0, 0xbf665a1dbbae5a7e, 0x292c52a06208b0f1, 0x299a5198a9061e,
+0xdc76407641dbb4af, 0xe394e882a0586445, 0x72a43631da320168, 0xda8015a052a218cd, 0xce4b920aba5f5fe4, 0xc9d6c276b833430c, 0xcf237aa608024fce, 0xae2117a3057d7,
+0xc284bb227b0ddefa, 0xbd5e6648ca8506b2, 0x6fe04b99b178723b, 0x32b0bfd13b01f535, 0x6ad2bd52c5be6c4e, 0x3764c49bf7bc0e06, 0x88f749e52e910dc3, 0x978be26362f9,
+0xbbe1398b263947f6, 0x3c4c7fdbc9a1670, 0x7d85176defa689c4, 0xc122b0a65566e793, 0xc559a7da48aed12e, 0xc165e3b811afd276, 0xae49f8ab5d9a7b04, 0x3880fef3c7797c,
+0x829bc3192e1e41f7, 0xee13db494068ce5b, 0x30f65ba611f09ac9, 0xe471bc364e94d519, 0x597295375fa11dc0, 0x95f6f05ad1a4c634, 0xfc02dc16c26a6748, 0x2aec75b519d4c1,
+0xbd33d9ebdba149a1, 0xaf558c894115431a, 0x730ae683d76f9303, 0xcb1e7803bf7f9967, 0xbf5727bd4f564e16, 0x65a7090a39105c0b, 0x514d296a248c3167, 0xa3297ba681465,
+0x8e5b2e735132ef0b, 0x1f8412cf27d80c52, 0x4ee9a9d06a610264, 0x8a9e7e518e6b3589, 0xb6bcc9febfbee3b4, 0x6a00467bd24f1909, 0xad2d2f0d00770a88, 0x139efd7dc81397,
+0x2fbc95b644657877, 0x6f3ef4cc8e5901be, 0x94b0ed1627cf869a, 0x24f64cbd4b2727ca, 0x1a5d0a651b6c9347, 0x583361d164f36852, 0x4fb210aabd386613, 0x15b3aa3258840d,
+0x4002b2d203a630e7, 0xc190096f5ee88d4f, 0x2ebd3785f0cd6034, 0xdb96c3b1495f3f34, 0xbab3ce5d347bd8e8, 0xf4b9459e85ed0cea, 0xa7d5c64c4053e922, 0xe5042acdc8b49,
+0x8ca7c038e34641a2, 0x8bd0089e7ca74ed6, 0x4405614338ee4cd, 0x92da93fc90bb99c4, 0x2c357494a42e4067, 0x510fafa6287d1953, 0x88e5101b4a4b179, 0x116ca9393a37a9,
+0xb179bbad25c08520, 0x8ded0f328100e558, 0x23c5320f40a78a49, 0xa1f5f3f8a667e55c, 0x1023fdb13071f073, 0x92a419bfef5b9556, 0xd75bc767cc0f467a, 0x100f04334ff4f0,
+0xe93e3b9c88f19f1, 0x91508f15983179c8, 0x1316a505e2886684, 0x57d1ba80f8d72ad1, 0x25c6efe04b78c91c, 0x1c82aba303e23f48, 0xd3749eda62fd4216, 0x2d65d9827532a4,
+0x20822e2b136aaac1, 0x1cc9ca6a1c00ba5, 0xfe67aeb0c80673d5, 0x95e6e5661dcc7a6a, 0xcd9e30253bb85208, 0xf3d4b5c603a60269, 0xcc79978a1cf5c080, 0x2516abd17e525f,
+0x46a273b10bd304c0, 0xbdaa5c8c32761d84, 0x75a1848b1b17bef3, 0xcc79f93c387e27ee, 0xd045c03c68e1639a, 0x3645f030ad51e826, 0x9ad14e4558a08333, 0x27d2b924466ddf,
+0x730a7d1cb69bd474, 0x706f94ebafd3d40b, 0x3f983612f65919c4, 0xcba03ccb9b238256, 0x429475c698a14ea7, 0x63277b31068f2904, 0xdb6a874109a822d9, 0x6fec167337bc,
+0x8a7376a034df3d0f, 0xbe0ad31dfed314ac, 0x44d4ff57bfdd2cf8, 0x46d58651d4361fe, 0xaa0bfc4aebedb16d, 0xd80ca9a19e6b41b1, 0xc45add5f5ef559c5, 0x16fe6945c3e5e7,
+0x3104ef3dd12212a0, 0xcf9e9f281243f5ca, 0xa6021f16c1d2e9bb, 0x11aaf36d8f93cf5d, 0xb64b90c5df41a91f, 0x9fd901374444e7c6, 0x7b4e9a365ddf25b7, 0x3e8c92bebf7272,
+0x227185cc42d3c75b, 0x269669df261f9cd1, 0xa6511351c541b325, 0x8f449614ccb527fd, 0x23bfb9ce306d4f4c, 0xe382e4cd86f80483, 0x504d07a9a8bc4779, 0x6c38245817cd8,
+0x94819e472f96c972, 0xe2c5e09dd588c030, 0xd8cced719d7ff4bd, 0x8dce4e92ac4190c6, 0x1888209fa69a6a7d, 0xd147c4851a814f64, 0x33549d3d64cf99e, 0x2a195a23a6e0e6,
+0x4a6af42abb4a53bf, 0x7bc092937b02f43c, 0x1ed8e325cdfd7603, 0x84555fd7ccb2e0e5, 0x563a638133e82e6b, 0x2eb66eb3d71d9652, 0x8248adeb0058fb38, 0x2f663624e32f74,
+0x72f4ddf5b943dd37, 0x843bf0431b851424, 0x2d7b8878efc93896, 0x8996579a5614b15, 0xc698ec47b8f7e18b, 0x3edcccd1b33a4ab4, 0x8d380f1cb8ff19a, 0x199d5e721ec595,
+0xe131d8340d8795ab, 0x6d0f90980024d5f7, 0xc1da36bf8a7da202, 0x3fe7fb5896b1c8a3, 0x3fb8386b1848a5cf, 0x8a5a854af9ab32e3, 0x49df5fe6e78dd006, 0x1da291898f9f8,
+0xad0bd41ec1edfa62, 0x9f31966da6599b0f, 0xaf0b7f6f9a63f2be, 0x93cc6f586f8fa5ff, 0x9bd9d7bc4f307829, 0xb4852e7477c6dc79, 0xb096906e0505a97a, 0x2ce5fb28bceb3e,
+0x41b5cd9f760a2ec3, 0x6c0ad7424990f4d8, 0xc0532257f1f77912, 0x9b38d90d4849efe5, 0x7dce681291a3dca2, 0x12f188caec0c366a, 0xcb25702f2abc945e, 0x1596fcab51ea0e,
+0xd483be74ba6eeb47, 0x7f2986d14497533b, 0x8b042492961b661b, 0xa2cad7a2abcd54bc, 0x12e11e9c6579cfd4, 0x3111cf396a2f118c, 0xcfd460ad6e2e2814, 0x1a833bc97085c0,
+0xd521ecc00d9d72fa, 0xa97fd9370e97ae6b, 0x2131bdfe2cb6a14a, 0x151ff336d77e5c6f, 0xd1414c34bd3c36ef, 0x557bb3bc3c90da20, 0x502ff8e573762daf, 0x277e014440e54c,
+0x7257aea072ba60e2, 0x4a6844c8c11114a8, 0xe3b0bb7a9157a2, 0xceaf1648b758a7d5, 0x7e3071d106042161, 0x50d248d73bdbc0a5, 0xe7fd1b06d8bf63ea, 0x376d315dde0548,
+0x60ce0f1d82cab931, 0x7f0665717c97b06c, 0x625a7357e720a646, 0xa03e42f5e52b98c0, 0xf6680c27eeec2021, 0x115b47b4ca406a7f, 0xa42b2a8ae11bdeac, 0x3c46bffbcb90a4,
+0x673f9391dfbfbd9c, 0xc3287d7f7fbcc019, 0x25a85f63c9ac26ca, 0xe43e8e1439886cd, 0x273a23f6994fe692, 0x46436366f1c98adb, 0x8fd348352c482c62, 0x330be73b36923b,
+0xd398d73762bf0e2a, 0xb65b208aad34d4fc, 0x93bb0c85f1dd8bd2, 0xcf6e1a96c825b03c, 0xb0be1c176481927b, 0x3686cd29b6f9ff05, 0x6b601aa6a020daf8, 0xab178ab61187e,
+0xa8e2ec940d10c936, 0xd6f15c8e1dd22e71, 0x40c0e4dd39f318bf, 0x4db44690b9e0a22b, 0x148b92f65dd017de, 0x987e1c8728fd9598, 0xeef7790595c457f6, 0x1c82904723d565,
+0xe49d08a5f559488c, 0x407aa51e07c7d4a2, 0x68cdbd996de6a12b, 0x55cd20b0f06317c1, 0x186bab04b3c94d2a, 0x22f2d9b0f582fe41, 0x59561c51eb8fcf7a, 0x3b3515ea6711f1,
+0x1dbc0de30e2f4f6e, 0xa54fcf65c3f198a8, 0x5afa20799de8ec70, 0xdd531dff1ebd7da9, 0xfed5320c9cfdff59, 0xded76f9b89cee884, 0x164d1cb84e481184, 0x340a1564900972,
+0x25dd9dca5ee80e8f, 0xde7df6ea52b1089, 0xf2b6b989c9664e86, 0xd88731b5677bbc84, 0x3202f35cb99cd326, 0x810ed2cc906f0f21, 0x17c6008b26b4d717, 0x2add0887037f65,
+0xe95d432058b998e5, 0xe8530a680f2dab7, 0x130ac5dd672b09ba, 0x3f14b9ee393457b7, 0x62000bbd52ec9b69, 0xc4ddfd12444ce008, 0xfaff3398f2dace6d, 0x292f90acb3927a,
+0xdee6fd89a60f9e11, 0xd4b7e8f8bbfd69a8, 0x4a1e1bc79bc339f1, 0x339055e350466bea, 0xf5d4a7e03a8b345c, 0x5cb004ce465efc0e, 0x14be0259da9ff44b, 0x2df0ab4b1f57e0,
+0x25749899bc893b8c, 0xc5efd91e97b3a204, 0x6d1faf8e6e34de83, 0xd0c95a2108554ec6, 0x9af71b0d38dcec8d, 0xc1d74b70b972d2d3, 0xe630ac5589b36c48, 0xc594f861930f0,
+0x9a9a2e3f6c01ab27, 0x147483171519933e, 0x2c4747408e00a24d, 0x521abd3cbc80c737, 0x63714404684ce08c, 0x8231da140f172150, 0x9ac52241727c0bac, 0x1b267dd21f2991,
+0xa18501f76460515f, 0x89af6b542bc7d72b, 0xfb0ef41778077389, 0x7818c62a03e5b4d7, 0xc425898c06c231c4, 0xa10e5f636e5b945c, 0x28cdf26948eac2f0, 0x15b68cb833899b,
+0xc36a367e23cf3a74, 0xe382d6aabc41c12b, 0x91c53be9dac3ea79, 0xb0d093b608e94620, 0x7caf9cbb4aaf82fe, 0x2ea0a0e859edbaf0, 0xf8f910e45af271b8, 0x811213d1ce3cd,
+0x2d14e7b50bab0d75, 0xb2f83db2d1ca3c9a, 0x2fb0765e40c7a9fe, 0x96e4e45a5c7d19e9, 0x8fac2e55469dc2ff, 0xa88919d834533542, 0x375b0553a046139f, 0x56a51933a2ed0,
+0x6b0297302ec636c7, 0x27d7a8fe8112dc8f, 0xa14a599341ad7313, 0x320f3ec70d7768ec, 0x6c8e05f53214b3a0, 0x3a90276d0d57feaa, 0x5a708742a2e56a2b, 0x2e6ba4d0173956,
+0xb80576b7d924648, 0x66f423f98ea40d, 0x83e7b262de3c5ff, 0xc02a561ac99da12e, 0xf56c0eb998436215, 0x6bd1066a1ed24687, 0x9e4e719f67fa351, 0x38f595ed414d2c,
+0x84fc4424b148bcea, 0xcb06a7afc385abc3, 0x2c8df4f8b8c541c, 0x5dc05cf832f5187d, 0x83dce92b1879c45b, 0x95c55398cda85cd0, 0x76f2189186773ce0, 0x207cbbab72f52d,
+0x6df162873fcd99c, 0xe90502344c5899cb, 0xbfb278ccf88c6beb, 0xcd12a56eada5771e, 0xe1682653b90098f1, 0x38e17deb6ce527ef, 0xb463b7fb8d11670c, 0x3427eacce81e6a,
+0xe89fb49bc36fdd8, 0x41f36a93b186e32d, 0xe5fb9fb5dfe97cb7, 0x4204027a6b3c5de3, 0xe666e72e0f793b33, 0xfb662113f840f9bf, 0xabfbd18b2eb9793f, 0x11d77266c9f1b9,
+0x74ef4c5d4c883077, 0xbd2ddaeeaa078761, 0xe5c8dee914465e4b, 0x7e7e82a877d8a292, 0x307cd7f078e88d1b, 0xe6f5ea1e76519765, 0xbecf4eaf89dd133, 0xf16b85e677068,
+0x1a620101d26f9593, 0xc7a7c7196ffb5630, 0xe890328a2a0db203, 0x46f67b5d0a90df29, 0xa0195872fceaa3d6, 0xfb81d902973cc821, 0x585c16f8ca736033, 0x6621fde4a1e40,
+0x3fa2155e85f8eb69, 0x6174270f2b841fd1, 0x5ba265f832aeb633, 0xa66b978633732eba, 0x7e655bd337a5358, 0xa374984070ecd194, 0x6f241a45cb4aee3a, 0x2c09ad500f4698,
+0xb830d4ed982df99d, 0x4deb7940e17933b4, 0x5d3746d0d63ad2a8, 0x30f62de47c7f1b35, 0xec3b8f09e83027c0, 0x1277e18c442e9ca9, 0x3f9942b64ea1cfb6, 0x3e451f80fcebc9,
+0x30031e0e8cc350b1, 0xbc339be1c9b5223f, 0xd23cae7c6f7a1857, 0xc68af4a2293a1650, 0x8bdcd0afc9e46fe4, 0x422df2ba9704545b, 0x82a408d62a7260e6, 0xe4afb75c7c5a,
+0x32c36de2cc40dae7, 0xe3c07de715d4eeff, 0x35ceee148b75fdf7, 0xa320210571819d6c, 0x982d63ffdbc3bf93, 0xdb8bd13ddb5c7184, 0xac6eaa105f5bd59c, 0x273da86d86429b,
+0x1aba6591e896d473, 0x14b10499a20e8b67, 0xd644f479e325efa9, 0x2ccf6851f8cb3a63, 0x27be990457c06f9e, 0xa6694d25c3214d30, 0xff254a2c2409a5fb, 0x3afe7cc55e7c90,
+0x66f92959ffd6c6ce, 0xd8bde9abc9a6485c, 0xd8888f4ef9d02bf8, 0x5ed4d6caad5a5767, 0xd05331ad95c51bcd, 0x4d23f623bdb120f8, 0x811f32c3c68e87bd, 0x330d5620515124,
+0xa58e7812fe452a27, 0xb310df0bec3de063, 0xa95d274d38a459fb, 0x2a606b10c7ecbf79, 0xd5cb2ab837e9acf0, 0x3d6afa667e077d55, 0x41fc7ba90ac7854b, 0x2c8e04474afd2a,
+0x4f56616ee95da60d, 0xb21a19ecc272e462, 0x8fcbb50131e0d86, 0xb62e07c82404451d, 0x3db965ad93376bd9, 0x96ec18413e033b53, 0xf3ea378a9610c658, 0x12b766d94e3ef1,
+0x1c991ea26a610b22, 0xc10ff1a1e8b453de, 0x66f6a66c3b1519c8, 0xfb9563da41bfd797, 0x4fd041cab1a0a6cc, 0xcde00359b27d379, 0xdb40c674128cb13e, 0x312af275da8a8e,
+0xbe68ce72fa19cb2f, 0x53f74a99c30d5894, 0x97e18790e39eecf1, 0xd90760ef9d1ebac9, 0xe86015abea61654e, 0xc1618904d3ac4203, 0x64c3c5e9d4f829d8, 0x57d351dfa4941,
+0xa48c5af50cd58816, 0x58257fa6cde1c6f5, 0xb5f6604efb73f4b7, 0xbd89551bbbc34484, 0x5a9f4faa8807f225, 0x1ee4c949dcbe83a7, 0x32239a1c940435a, 0x29d98d1b2a932d,
+0x6f1f32146c2cdd91, 0x7374364618a347af, 0x2f513778ffe182d2, 0xf434893a3f24bba9, 0x9195a4a737f66616, 0x4eb138a0434c2315, 0x7b0765588b3424c6, 0xbff1b4b00342,
+0xf6661c2db51b3355, 0xd2afb91af9f50ad7, 0x154e030b2ca8a6d0, 0x4d5cba2d1997a93e, 0x9b6dd9885d0c17af, 0xbf9dc06504e4ba, 0xfd3277d4fee9e000, 0x17ecd6a7025f93,
+0x4a98deabf649b21c, 0x8314e3aa82a5c7b7, 0xfcca82ecd5e57eca, 0x7dce2fe5b914a9fd, 0x565323aac001b98c, 0xd0a04d31b26bd7e8, 0x827b1f5fe330fb60, 0x405590b4904315,
+0xefef8f170853f3b5, 0x3930ab5e6e6f24e1, 0x71e5c263dc2a42d0, 0x8acde64e9bb60d72, 0x456fb775d120a319, 0xbd2c34a81207b05e, 0xddc5b95348acd17f, 0x155e220e4ec427,
+0x3d458a1a7a980f53, 0x40be8061212bf4cb, 0xafc817af17684fb4, 0x2c5ded34f8620f82, 0x5a3237df54842e51, 0xf15a37277fa959e0, 0xb6121d2f588f7acc, 0x2397040c3ad2fe,
+0xfdd889616459b753, 0xb2d12484e2a819b4, 0xea12ee980cd30ea3, 0xacd10afc33c70dd4, 0xe78687d3179438cb, 0xb7cfd71a833fc204, 0xc8480f44dcfb4be6, 0x201cdb1c2c793c,
+0xf8de0d0dbec083b2, 0xf55072f9cb8b8ff1, 0xbf2085b13b77d58e, 0xd8070dd696e3f471, 0xb5e2ba6263608ae8, 0x89e7b3d714c7b757, 0x6cb7d3050aba0687, 0x142a8ce5db972c,
+0x9745ec9fdc27a59c, 0xeab1ddd4aae60952, 0xa09e449d7ebd3118, 0x92b4800539bcd6f1, 0x6fad91a7642eef97, 0x132a4908a3174956, 0xe4013f3a97b9c12f, 0x2a2c35635dbaf1,
+0xfd92ae46c8effee5, 0x3f1582cfbd369fdc, 0x27108fb6aa39dcac, 0x6e18aa9dc74ef33, 0x50ff9bea83124f67, 0x1a0bc44eb5c57b66, 0x1aa573796842cb51, 0x122a685c75076e,
+0x38b0a14823f713a5, 0x920a3920ad57dea4, 0x3f5e07eaf90a0587, 0x1f879275accf81f9, 0xc74e54ed51db49ff, 0x79dc18c0fd4b2943, 0xe56d7d273313a532, 0x162048a3152364,
+0x5c883ff1827b5660, 0xf17d911d8a948015, 0x229fc0636fe7201e, 0xcef4fbe444368606, 0x850f892f83723b6a, 0x690242c35130d2e7, 0xfe393ea5c7db1e5b, 0x1f55f32a186a71,
+0xbb19db423d4a021b, 0x105c793f8694e373, 0x36f5cb90b8ab2cb4, 0x5ee447ff22993461, 0x9d3ad20d1db82283, 0x707590b37c5ce62c, 0x39ecc5604ae58f9f, 0x1e6076f2dd2262,
+0x98fb1be9ff021d09, 0x7b78ee6848f69e3, 0x4a33ffe000953682, 0x26cc2df90ca49b5b, 0x700034b122c5de17, 0x802304868a9a09b, 0xa63da948f33a97b5, 0x186bd8e5b539a6,
+0xb1714b943f784a6c, 0xad4e80b89e76f6bd, 0x20d6e9c8402c6baa, 0xc1a7d7ab81fc7111, 0x2b3b59e2f5b5f055, 0x2ca6f85bc83d1d3c, 0xafaa0a1ca1ad2a7f, 0x1f338c88239678,
+0x141d64b3487ef71a, 0x59f11098fb3142f8, 0x42c5d04c9d721ac9, 0x1e42afc8ac65e529, 0xbbcb3445b12a8a31, 0x867506612b7e1bbc, 0xecac57611f1c9658, 0x17252a34101aa5,
+0xdaa9e7593d1217fc, 0xd6212ac517f41463, 0x59271aaf2b1708cc, 0x262d0f884affc58e, 0xe33cc15116534a03, 0xabdd24387c7c58bd, 0xc7627c176749c774, 0x11c699800aadfc,
+0xd951c413ef1c711, 0xd3f4df1cd832ce80, 0xf5e15423f833f110, 0x4bf53c7d346c0cb1, 0xe65173bec86ebd48, 0xb408af287bf90849, 0xc4bfd56dd0afde8c, 0x20385569cd521d,
+0xe2d1a1b47577f9, 0xca95563eee52c3f3, 0xcc8ba50c5e7f6a77, 0x80deb67743134401, 0x10ec1e5c273a506a, 0xa76b36cde82a23a0, 0x2f7eb22a92bef107, 0x1f8a19409aeea0,
+0x9487291ae3dc616f, 0xa9405d0b0f6d5152, 0x3f038b23a33699d2, 0x85a636db3cb13b54, 0x57dfdbdd5e1892ef, 0xe50fc5773de4207, 0x36197ff7bd9c3528, 0xfe4b6a1f5bb0f,
+0x57eba170b66fdd9a, 0x77320b54ced65d13, 0xa52254a00a7cdf3e, 0x6feb23feeb9b924c, 0x34d8ca69a34c0700, 0xd22f768de7417c54, 0x56179721a9db8e6a, 0x1cac7385b6dfa4,
+0xebb135fcf1e65b7a, 0x47b38c7938ef1a37, 0x5de0f07fe04281c1, 0xd54d9c63c433a213, 0x7ad3fa2df99fea99, 0x4fb2e52f6da21dc6, 0xf495f5ae525e9914, 0x3e5718a39d63bd,
+0x97bc0e90e6b427b3, 0x860d9464cc9551e9, 0xd590a933355f1522, 0x22ea214504c11ef8, 0xd39f55fd5eeaf081, 0xda10dbdf7cbc7f92, 0x5966b15a3050b279, 0x2ec01e918f5bfe,
+0x6ad23d7faf6a64f6, 0xffadaba26036d63, 0x90578135fef3b513, 0x4ffe89f07771df82, 0xd232f67dfc9e0c1f, 0xe5149f7199301ef7, 0x23b8085bbbf4e603, 0x1ef9cc0f81f263,
+0x8fae510f009fc3d3, 0x6bf6b0436c84dea9, 0x5ccd8cd34816e57, 0x47828a4513481b9a, 0xff921b826c38c2e6, 0x3702dcec736820e1, 0xf1da083eb225776d, 0x3aa8bbefb59616,
+0xbf2221916f884224, 0x9105c9328a0a63b, 0xd686d1d5475e7581, 0xe6e0cfc49e4734b7, 0xd32ee69cbbd7c553, 0x2bd81da40945419a, 0xc8ee1aeab5513d4d, 0x38e77634ce1552,
+0xb39fa0c7e5111158, 0x3ce72ebff586f632, 0xafc178172cb220b7, 0xca87cf445a8a38b1, 0x30e9e261621b01b6, 0x356a5a3827b932da, 0x7b08fc035a70e9c7, 0x2ce17fac31b4a0,
+0xce9aa42cb7388968, 0xe83a4b455f7864ff, 0x52c8beb26a9fc754, 0x59505a5dfd6b2ed9, 0xed335d336f0c611, 0x31b436b7c0436a4d, 0x9b8d7e5e0518d39f, 0x2a4a617e1582f0,
+0xea7a7f264c4a14b, 0x8e70e229f0bafdd7, 0x18909c2809bfcd16, 0x41394bba2811c422, 0xd3170ac83f3357a8, 0xfd7560e743ba2ee2, 0x362fafb47561fe12, 0x2ded8bb30582a7,
+0xaecab281e3441eff, 0x917f265450a3d4b2, 0x46c2171381fbe316, 0xd070c3705a953f69, 0xe684957b38354176, 0xa665985600475a60, 0x8fd2e3f2e162e90f, 0x214ace10ff9821,
+0x8b04e5bb06df6815, 0x5a68e033aa0dbe1c, 0xf50003de1200da6d, 0x85cb6ba14298f1b3, 0xaec3c618e44ed4b1, 0xe98d0d3cce26d9d, 0x327929e8cc7777a6, 0x12a4eb0fc478d2,
+0x7d34cbf9bb937cde, 0x7ca060437bf3a38f, 0xfe19d62ef67dd992, 0x4becaf9f6a4a26df, 0xd81078fa12b230f6, 0x1e2e68e0829109cb, 0x98c3fb0e2f8c4791, 0x7868912137947,
+0xde641cb5d380c8ad, 0x22d9fbd969fcfe7, 0x434a1b40da56dff7, 0xdc98cb74604bd537, 0xc8c34db499fa4fa4, 0x563c97106140cf0, 0xa551eef3270e87b3, 0xeae845db9f80c,
+0x89eccaff9ce7ecc5, 0x1b521fadd26aa6a, 0xff0133201e2625c1, 0x104df578f20bc5d3, 0xe8c31fd8a87f008b, 0x8ebe1c5ba7115de, 0x625b7cadf3ce8c03, 0x20dd645c1a828,
+0x1b065be146a1b7c3, 0x47c58ba87759f68b, 0x42370cc5c32dac35, 0x56ca75329cec602d, 0x2e68402717621ad8, 0x453a96b365cdd4f5, 0x7bed05cb0a35c9d8, 0x637410962d01,
+0x81e9957e0b9f5a03, 0x98a74dfc19883b54, 0x50969b837870ad69, 0x4891f72ef1243bed, 0x7cebb54b428c902, 0xe2bef01c47c414b3, 0xcc6724b699078df1, 0x394963fe44948c,
+0x1cfb949b55d424a2, 0xec9487700d76f951, 0x91e3b1ad9d5438bb, 0x79785ce167b6fc04, 0x1fa325eaea6e0dcd, 0x7ff1d1797f289817, 0xf45156e71c38a27e, 0x120a4c3ba19a94,
+0xcd1ab4f6098296d6, 0xe59ee83556b85182, 0xef48f59a4a5551d5, 0x7dbeccea31c6887, 0xe99d809f94e323, 0xa76ed0399d2c9b19, 0xbf5e28c311ae84c8, 0x2e4ee6a6d59cc8,
+0x1b6cee09b2be3bbc, 0x1fd1111b02135027, 0x618eb182ad84a5e5, 0x7d6c083a9c183920, 0xb56b32c5c2713155, 0xa04dd71b25b5bde4, 0xa7224f1ceec6b24a, 0x50a1a5e26e20,
+0x5ee5b4d87e32d888, 0x63eb9716ad211f13, 0x90d0bf91d844def7, 0xbdc5445be3aca992, 0xb97a7842aea8d8f7, 0x24347a33501b035f, 0x2bc5224afb721caa, 0x256ee9cb88dad7,
+0xe64a3a47cee1238, 0xe518a0282fb09f45, 0xb7b9961c3fa8b8a7, 0xe832a219706f985b, 0xeaaf09a861223eaf, 0x6ecbf63831bb74d8, 0x291dfa652230114, 0x2fbc9964d0baa,
+0xd2093710cf4295af, 0x4adb005323a9db98, 0xc256366c3b440c3d, 0x10a9d61dbf363c71, 0xeb45d35519e6b233, 0x4bac6f0154449ddc, 0x78ab5f15601e5626, 0x18cfaefc83d5b3,
+0xf6fdf5693fdf1f78, 0x6d95facfc55c026c, 0x6936adc721d00e6d, 0xeff44411b074677e, 0x8db473368ac929b4, 0x745444a1f571f705, 0x644d94211248a167, 0x20c2a684952122,
+0x912e4d3abc1972cd, 0x1083979a79166f79, 0x1503aaaab76c8d7a, 0x139c63fc12301a9b, 0x1bfb1c5744c7bb07, 0xb37f1b4621c6601b, 0x6677e2f910ea31fc, 0x1347de232565c3,
+0x5abfbfd801531dae, 0x22c592633954c340, 0xfb650b51c8451df1, 0x81800a51f1d13515, 0x11fc56387bcde844, 0x4141cebff147d948, 0xc2e96c5ed68eb4ea, 0x334c02aac5e6df,
+0xe5ff72370ea5b48a, 0x5e230398b64ebdf4, 0x92a7999293791568, 0x27756729116f7b65, 0x1933019a8aa177c7, 0x68b8cdd59523bb11, 0x1071e25b9ea0bd58, 0x1043c791b2fd07,
+0xb207366cf506bbc4, 0xfcc4f763e23da5c2, 0xfca2bd14d38dbfbb, 0xde9edeefec218304, 0xd98e500990db5b4c, 0xe520ff73fc5fc984, 0x5bd89b367dd30e1f, 0x1b091051bc4de,
+0x3cd1fd1c25acc5a1, 0x8b749472163fd61c, 0xe199cb120cc5e8bd, 0xdb102cf9703e3bda, 0x6f16bcfa5a486a8f, 0xc2f8efb7f73f7c59, 0x75e1aab44e188cb3, 0x3f8d0efa872cfc,
+0xa3246aa080f15402, 0x3bec2544cd520775, 0x5c5b9982ddb967a1, 0x1da76a71936a864, 0x9115ad375b64ab9, 0x5a774beedb2493e5, 0x42777127a76dc6ed, 0x45bca6e272395,
+0xb0a34b515b7d3a05, 0x7762c4bbf79e1178, 0xe7c3be0fec6bc27a, 0x6d89217054894175, 0x30b0e2d1d827111a, 0x8406d65421023456, 0x701d4fb5d1747fb, 0x29d002cd66521f,
+0x3ba73e4fda74e67f, 0xbadab6c901de2713, 0x8463979d40a158f0, 0xdc1961523ad47ace, 0xd0c6e96791fcf3fe, 0xd0cab1dece809b50, 0xe11548b0c561124f, 0xc7f49509724a9,
+0x735de0d981952992, 0x4f3ac26e5ddb13ac, 0xdd4450c736b2099f, 0xab654fe81c1ab5aa, 0x63761882556ca9cf, 0xe3aa5f0a982d32f9, 0x91d44f91fe0a8387, 0x1eb8e975b5e1f1,
+0x3ca31c31b5f77503, 0xd516a29371678110, 0xbbc69423ee7d3309, 0x1d9354910874445b, 0xde8abea46f0d0e10, 0xa24dffebcd688542, 0x71262fe490f07271, 0x21acc4ee42412f,
+0x1b5f043e9e1d9476, 0x56f5aec6d1349201, 0x1b73b316ae3fb8a0, 0x80c2b2949ebfea76, 0x522b6c1517d31dd6, 0x2d762d726c7bd127, 0xc0e91f24d51858c2, 0x142633b12b950e,
+0x7dea717f01db8da1, 0xc0e2470858e36346, 0xbb0c442fd619d20c, 0x9eb1047b8ebc18a5, 0xcb7caea72f05b441, 0x9299d9984aac0732, 0xfe00cbaf48d3f49c, 0x11e8926b14d7db,
+0x1fe811d0af059a2c, 0x614b529059efd109, 0x7e8b1625e1df10ae, 0xf5e25edd1e0c16f5, 0x1bcbd9815db8cf4f, 0x8158523b5b7732b0, 0x5285775a587b5da2, 0x2490f296b27d67,
+0x9f07d32ad5023b7f, 0x81a4276505b8c4fa, 0xcb53ba4b6f65b437, 0xc359464666f33047, 0x3a739dcf58d029c2, 0xa8c90003483f19ab, 0x861dbc34ef06e709, 0x1127b0d95ed2c9,
+0xc025c7644e808b80, 0x3118805d34cdaea8, 0x8464a07de327bec1, 0xa76e9812934c0df0, 0xcba7afa1520dab78, 0x75b40bf5cf97697a, 0x3cfd3380923ee334, 0xb69d78231ca75,
+0xf79912ee9b229de1, 0xb24747d6946e8ffc, 0xee5daf19451a62a7, 0x2cb208c5ef0a3dcd, 0x3e71d9d6e8f91fc6, 0xc4cf69494af2203, 0x3b7a6738d43f58d4, 0x28b109afcf5f3e,
+0x90f4f8da45f9699f, 0xceee45afebd36a2a, 0x4c74526ae0f6e837, 0x37e989e9bca3bd93, 0xc15d67ae3ce292e1, 0x6e6e5041ff71db19, 0xccf648bd10e626c1, 0x1c7f9216628483,
+0x92cb190f1653a4d0, 0x1e65e66f8c2a0397, 0x3fd463812921ee0e, 0xab014a81775813e7, 0x29631aed09c0894c, 0x37ebcadb716a80d7, 0xe9b9afb303dccc55, 0x224899b817cd37,
+0x50a680c83dacd317, 0x3b23edd81d8256ee, 0x67a694c5e874f1c0, 0x5f6870aeb103f012, 0xf41d897ec6c45006, 0xe660486d38dd8702, 0xf690aaa786ecf584, 0x30fea69064998f,
+0x5f6c6428eb655bf8, 0x96ef63c2d3df17f2, 0x5a9dfc35a4ad0d16, 0x180fa3b7c0134607, 0xc91ce07b833c0ab1, 0x2c95b88f310b4d32, 0xe74a6ad8214ff143, 0x358226a6d6c809,
+0xfbb8d9d5f5284618, 0x19df6be52c06c550, 0x7fb2d3ddf8ab0c38, 0xdb3c27b307628f35, 0x3cc5fb58529d7ace, 0x40a7c9472c39f164, 0x9c1ea61580e7eff4, 0x3868a9f0ad72d7,
+0xb516e6649e5e8191, 0x708e43ffc1384c31, 0xebbe16e47c1e5dc2, 0xbe2fec1fe4bf80e8, 0x64d486f37970dd23, 0xf1bef4a24f2b573d, 0x1949ad64f84a2668, 0x8d567d5ae555,
+0xd168ac349720c13e, 0x71b634b3e41b86b, 0x3e8a9d58fd3e2499, 0xf0b4306f3f4c1431, 0x40b96a680603f6a6, 0x63c295cb9a2eae38, 0x580894c30d2a6f84, 0x246cfbc9004ba9,
+0x7d2e0fbe046832e6, 0x959ac60d19af6bf3, 0x465a9c687d6b8620, 0x45c557719bd66ab6, 0x928fc477315c802f, 0xbc2a02a1cb0aafee, 0x95b019adb9ca1a18, 0x3158bbc53e6d6b,
+0xb78fc745ebff90b6, 0xc54db0862c2e7bda, 0x9b5e66aab0671545, 0xc5d686eb109c467f, 0x3eb0befcf1e65ab9, 0xf7a026769ae7a208, 0x532d215494d5aadd, 0x114d1b766e3629,
+0x72454451153b2015, 0x4b3984d29996fb55, 0xa4fd4a82f75ff983, 0x288f87b9d90403d, 0xc7f9528f61bd0115, 0xbc77e34355e73b0b, 0x6c1851456b6ba4e5, 0x661761a893f13,
+0x5abfa2179d8c791a, 0xc1ddd635f3ff2352, 0xc16939fa22e9e522, 0xa7856c4c271059d4, 0xa6c03eff25199179, 0xffaa7030c8023a07, 0x2c77562117496427, 0x19da1cfc0ff07e,
+0x6b773b761b422b19, 0x86176aeb3d76e47d, 0xa596cdd5d64c3ffb, 0xaeff909bef1a334c, 0xa963c835f710a794, 0xb12dfbd8df26f4a, 0x2796511c61f74d0e, 0x3992d88a86c471,
+0x743fa1ba5f97f73c, 0xf050661971334b34, 0x27709cbc0c3ee278, 0x630f10e65a28bbae, 0x141a81ed0a08f8f1, 0x847ebec5fa619bc3, 0xacd91cb30b6b27ea, 0x2f95f5f7aa0b42,
+0x966fdc601b6e0bf, 0x22b69d7636f4b25a, 0x3be80216b1f7f203, 0xa88bceb6e38fadf5, 0x3201f170ae804200, 0x52b998c2f228077, 0x3c4e9b62225b0c94, 0x1ad9c24826a39e,
+0xf6a2deecc5921bf, 0xd19b90d7638dd36b, 0x2a033f937440c94f, 0x8e8faf71d2b80b0e, 0x5eb7bcd38ef8494d, 0xf01b3cefb1002ce6, 0x3f212e360e311f31, 0x25ef46fcf3e1b0,
+0x53f8cd3b6f80886b, 0x6f9f94cb327be903, 0x8494af79a287d303, 0xf617917a01608a57, 0xceddf7ebc2c9aa91, 0x929ddaf5d2ead3c0, 0x446d2dc5f2e99743, 0x284c7a39c35393,
+0xe5b957a194b26130, 0x6c067b8966370b3d, 0x82664fd8d06c13cb, 0xc66e11744e94a82f, 0xa9be2da4c2e0cc99, 0x6840ed968fbb260d, 0xd12d2f9dc97e0a1f, 0x114558fcb9a278,
+0xc3c0d2632a10323d, 0x7d50190bc3cf8ca6, 0x7c6e2b4f4685fa9f, 0xd769e7c3f97b9d6d, 0x8b19bcbeb5ab59e7, 0x1b59f9227c6f5d27, 0xe25ec7ca162239d9, 0x1ab016a3273fd0,
+0xc3828b91fd3e4cc2, 0x60743154bb5c5d9, 0x1c63f773e4df0fa1, 0x5b1f421ffe7b59f8, 0x7981420e57d96d38, 0xccb19d7a8e2aa082, 0x2e0b8b205e550d89, 0x30701bfe5768b8,
+0x15544fe774671e39, 0x4ceadfc87e691f1c, 0xc2607e3f2e9c07a3, 0x3638874af3e4ad8, 0xd89ede243a831a50, 0x199e6b643a99dd60, 0x4a5b68c0b33c6038, 0xbca1ac534ead,
+0x8584c45ac478e14d, 0x7e8b0c166d4c3c6d, 0xc06350456541a4e2, 0xe46345cc270d1f2a, 0x79c417fd595d57b8, 0xff3d1cd45f041e2b, 0x5d8acffd7d615498, 0x2c52a4b0f00d8c,
+0x4079d2b7d1b68a26, 0xa47b1c9890f51024, 0x9dab91fd99ce268c, 0x300ab28d6833db68, 0xc65822581f28e64b, 0xe4406553d01e9610, 0xbffdd79b780b3a2a, 0x2ed4213e309b4e,
+0x759e6f9a9267c063, 0x27d9ec9f6f4bee7f, 0xa10fccf875d2c055, 0x22a64050d32a58f7, 0x45befc9825ccce13, 0x81f58033292db32f, 0x6df5db6515aab98e, 0x12d22b772428ba,
+0xb55e42f900826321, 0xe0eda7b3ebbe7f0a, 0xca21fe8bb244c446, 0xf5b4a1e3d8e1bcae, 0x59e25eada8ef23b0, 0xd1b2b4cf258653c8, 0x9d05cecda440abff, 0x35c14472f5cd92,
+0x819e0162be3872, 0x8b4efddb29a4abea, 0x56e8aab3dd03752f, 0xe3cd6fb32fe6833e, 0x9de99cd2985fbbc4, 0x5b73ed060f19519a, 0xcdcbe21d89a23724, 0x304a63e3579ba8,
+0x16067b89c4423b5, 0x60c055011b1fb1cd, 0xcb63b18c6fb7a171, 0x22729d946164b9a8, 0x9ec8594e62accad1, 0x9a4f89aa37796f8b, 0xebf639097560328c, 0x1be115a72a214,
+0x9c36929d66f4e3bf, 0x9aa7ed1f7865dda, 0x28528ef43530a6d5, 0x88013427f5329439, 0x3960e8cc4a3924ce, 0x452c761552b42358, 0xbc3f1c1eada27f55, 0x197766487e3aa4,
+0xf9422196c48dd1a1, 0x6e18f7d26d9aea12, 0x484cf1db30761957, 0x77d8c3f5f8c3b9b, 0x54f185e2ddfa50fc, 0x1c0c373277dba449, 0x936624bcfc7ecb2, 0x31fa1104844e5b,
+0xd10075b024c50155, 0x12238fdff4ce5a16, 0xf382ac03056a519, 0xf19fee8854066fb9, 0xf8ca0c7bfe6fa988, 0x881a1de4044348ba, 0xe5dc72689b8c7faa, 0x26a559ef992f3c,
+0x8e6237ffdd862155, 0x960f76cebed675bd, 0xd2a77f57d64cb525, 0x5371bbbd0b9c7190, 0xe744ebe1f705caf9, 0x2338d8873d40bdf5, 0x633cf0ea5ae0a5b6, 0x1287669d869681,
+0x9277918d9f764ea8, 0x1bf191380982ab03, 0xe7f6c6cc2df02bd0, 0x12adf19ac2d6528d, 0x55c01ea6c553a0f6, 0x158c6553ef4d8d4d, 0xd99d8caea16ff7fc, 0x3f29569864eef,
+0x62fec522ead18c13, 0xdffd14a3b7ffe039, 0x27a7511f3f823122, 0x84e906bcec7d4db4, 0x68da0a588864d163, 0x395ab7044a256a2f, 0x8f64747d5437b084, 0x2acde6e077353,
+0x78695ae8c29626ab, 0xdc8584fa202c991d, 0x1e60d9a9569f53f6, 0x7c4e58580e03b2d8, 0x8391d1a8e6b4a564, 0xfe12006fdd049516, 0x22f77a1c5632201c, 0x1f182976f5101d,
+0x7c0f6a29776888d1, 0x8ba183ac3e8322c3, 0x426b9af668fcfa4, 0x42ea95cc88de7111, 0x2ac44d70089a03a7, 0x12dbd89f1b52021c, 0x6685836398343bbe, 0xafe57e1f46159,
+0x39a3bed9add23ec8, 0x35deb4b6fa33da19, 0x1db4881d1f014665, 0x78f1bcb35f4730f1, 0xc52fdee6198ed63c, 0x1e69ecbe7fef87a1, 0x3948f4445a1072c0, 0x2dbf07831a7a88,
+0x20c121972c36932c, 0x83e490e51e43f10b, 0x681981cd92d4302, 0x8fba3840b8b6ac9b, 0xa1680450a6017a74, 0x5735247763210c59, 0x2cd319b6aa2679d8, 0x392eff7a35b485,
+0xff815fa36d932e85, 0x7643444ad64169a7, 0x7a896516bd759c4e, 0xa5a0d6cd725e0c49, 0x4922a996e8c99aa0, 0x47f3c549da7593ab, 0x4ca0fe0fea6b537d, 0x1a24cc534caf49,
+0xb3d111a7bcb48789, 0x62e45bb6cfabeb6f, 0x22fb9f4e172f9706, 0x8978a99c94ffd398, 0x2b770ff57ac05917, 0x8b8e513b0ca0bf6c, 0xc42268a13d9afa29, 0x1096c2429ed3a2,
+0x2fc12b9359b9255e, 0x87b26c9c040cd63b, 0xa49106751c9c7ea8, 0x663c0777723d31a7, 0x5134d26015e2e222, 0x95bd9eaa7577ab64, 0x36877daa41cc20b9, 0x1176245365955c,
+0x24713934ea1d8dc6, 0xb728eaebc118ff49, 0xe9054fae95456f85, 0x479e4d2da3606d44, 0x29e46de6d4545b0c, 0xe35e49a504c9b57c, 0x695877e8237a5ed6, 0x2a2b0454a9d16d,
+0xf5c908a7ac75d240, 0xd28127be9e2b65eb, 0xbe61a4cf837c300e, 0xea51f6b2a9d99137, 0xf786c180fda94e70, 0x465965b99552f247, 0xdeee9ad0e8d1a35f, 0x3b0e12a050ad89,
+0x2fc436f3edb677b2, 0x22e6174c9b766306, 0x763315266600585c, 0xc86e655744ec10db, 0xa6b5e2a382b26df3, 0x8ca71545d396f5b7, 0xc9038057fac64d1e, 0x2ec3662f48cfab,
+0xfec7e3afadd6cff9, 0x35e440642ddb943d, 0xf18c12fc411d853, 0x1c5be4b48b3ec09d, 0x4cd38f9adb6ff89f, 0xbabfcbb0801b1a0c, 0x72fa12da2bdc0b13, 0x323bf1bbd89cb1,
+0x5671b1300c16637c, 0xfe211308dd7525f8, 0xf24ee9a1430a2aeb, 0x795ff260f85dd81e, 0x433f57318454c6ec, 0x4c1c6510f1f5bdd6, 0x22b6bf83a397846a, 0xd1f916be45399,
+0x49cca72169da0bc4, 0x58c4e17b26045c58, 0xb9bd2e22144507e3, 0x998559464c4894c4, 0x8e5dc8de32d8404, 0x94e1443b2eea8ebf, 0xbe6f54f13585fc9f, 0xe0d762b243ddc,
+0xf7814beec57fcbe7, 0xd5a594e24813e514, 0x14f911c14821516e, 0xbc0f9efb2fb35532, 0x4eb11a7bb10423e5, 0xe920b8b7eaa4ad7f, 0xc80145ba6a2c15a4, 0x1cb70c223951d,
+0x3104efa6fe796cc0, 0xa9f8cc2acbe66a59, 0xcaefa70efe4c9eac, 0x97c335c50171cc10, 0x95219a8914c33b90, 0xc51988ac08313784, 0xe16fd7eba6e52668, 0xe865c2746e3ff,
+0xf707759bb4459b3d, 0x3128eb40aa9268a8, 0xde7ecb83c2777553, 0xcabab8af3e057462, 0x4fdd5e4532eb5ddc, 0x4ff3d68e3690c013, 0xb465dc3cdc1f8932, 0x215c6edbd3594a,
+0x755083926f5ce3, 0x2a9a32bbb3475f81, 0xd0082850e5c7c82c, 0x26fd21591763f68e, 0x3db84b07b1c1a5b7, 0xa8cab3700926c20e, 0x991b5db3eebb3c39, 0xa2960c2707f63,
+0x1bbd1001e2b5ca31, 0x5bda3a6d5a4c77b3, 0xf22ae47a615d9691, 0xaf66765246548fff, 0xcb591104db2b71e9, 0xa2650f063aa4cbd9, 0x63e939e8279ed933, 0x2c31c578c1e72a,
+0x712f9f2a58c477a1, 0x2fb256120051147e, 0xb25f65e6996eedce, 0xa561afb4e133fbbc, 0xc38443bca2622cdf, 0xa4eb5ea2013f9a25, 0xe357f96e5b1cdda2, 0x90a7787b08600,
+0x2ce3b30f4a9d13bb, 0x1f0cc8d94f59690d, 0x52b1ab5ba415831c, 0x9f5e93e86594647c, 0xe21c5b2dd8343375, 0x4b6b2e0f6885347, 0xb0fe671723777a9e, 0x102204b353a996,
+0x7f64274a1a03d295, 0xff0dcb85711702c2, 0x3e91a9f03ae4d16d, 0xcf3ca24c921b1b9c, 0xd616830533150392, 0xfac207ccd40491, 0x9efb5c85637a9fc7, 0x17b280f5eb0b1,
+0x6f3fdda68f1e7692, 0x9c93b39f71904e2e, 0x4ae26a24e43ecc5a, 0xa4b52184c2febfea, 0xc9a37afa9a3680e0, 0xbfd41dd4285b782a, 0x5518e20f2d0caa8a, 0x37ab64130c2bd5,
+0x1d1c6dc87d543c8e, 0x50c477e70c61663, 0xe9e3150728e3628, 0x274353a3424707d5, 0x9cc863a37a72f275, 0x1f2c93df1135db30, 0x9c2d015ec6a2629c, 0x176b189a02245a,
+0x7c338e6dcf7aa3f1, 0x27892870510c9128, 0x50baf0296029218, 0x6d4342319c3254ef, 0xcbaaed217192e516, 0xf48b248e10dbc629, 0xd8375c38207bf5d0, 0xd1f25256f3205,
+0x504ede359b03e48d, 0x23a9b75986fc7b8d, 0x7ae8484cd1e2c09e, 0xb6a0a30621c32806, 0x5ada8a3b511482f8, 0x365324f14d4f2fcc, 0xadc693c37205efb6, 0x18d8f52715edbb,
+0xebf4520fbacddf4b, 0x3097509e859bd364, 0x1a95c2a29c8c8c71, 0xc516bc5647928c84, 0x407317adc6d5f47b, 0x265b7cf1ba45a150, 0x77d50336a8680842, 0x28f9ebe8f42625,
+0x363b5d050a8fcd8d, 0xf6602d6830139ea, 0x461ce2fc1c33544e, 0x73a784c659928bdb, 0xdf7c25313b3eae41, 0x1707febc0aad1570, 0xf4c5e90ea2864b3a, 0x3fddfa3bb582a8,
+0xa49701c5b87d08b3, 0xb737ff34e2927566, 0x650c32deddf4c319, 0x94b60d89715c4cd9, 0x5dba81f6168bf673, 0xcfafe372d36f3a7d, 0x5e35cc45ca5968ab, 0x1da7ae4cbc7fda,
+0x36c7251556df11b7, 0xbeb2721e4e5086e7, 0x19ba2c6d206d3c22, 0x77a052c369a2206d, 0x702387218dc878af, 0xdc6868860712e7ad, 0x89abee363d9aff0e, 0xe923cbf15c231,
+0x7b0a5914cfe11bcb, 0xa8c25ef77d3a37b3, 0x32afcea985cd14e, 0x5f2c6c91a41c9a51, 0xd45de40e6ec8429d, 0x1c466fdf8cf16030, 0x72d34c68be5cca6b, 0x29b65763afeb72,
+0x5d953f03c1942db7, 0x97d4fc55e47522b2, 0x386b72b75f071dc4, 0x880ee8c8057a9505, 0x96a2c4ede6e513f4, 0x12ce66f4949d204c, 0xa1cb3bc4f741f5ab, 0x3a617b0cae44b4,
+0x6924cc9e26e3f27e, 0x350855519e7afa00, 0x9d01aceb4ac1eca5, 0xd35b7ba245db98e6, 0x3d3c73eea8d41e0f, 0x6ea13f0e574195a0, 0x50b089b6fa150cf1, 0x2c39801a79e207,
+0xdb438ce77fbf3ac7, 0xb8d17af281c323a4, 0x49cd04fd1aecedf4, 0xcf2f49971dd630d3, 0x70f929c375ba225a, 0x23e41666575628, 0xfe80281f32c0a7df, 0x3c19328e722cd,
+0x4cb544ca563071b5, 0x569dd69b9b3869d3, 0x3ce85d6d59683e95, 0x9e8514a1d8850222, 0x21089c02d8708c66, 0xb3a90bb1264f1392, 0xa8e594efb036ee1f, 0x34938d85514687,
+0x4edd2cae1de34c5f, 0x21589754755ee3fa, 0xd7769bb3950d0f30, 0xe678080076e36771, 0xe4796cd7639cc629, 0xa08f3b20d8903e2e, 0x592138f45a0a4c76, 0x999bfccb42d46,
+0xcb96641602e93da6, 0xddf67cbb4a0e9d7e, 0x47f42a0d453ecb91, 0xd3cf76a709a77abb, 0x26472706cc9156b0, 0xfcb3c94f2234663b, 0x60867316cb51d2cf, 0xec25bf53372e4,
+0xa355375a6fc5449d, 0xe10cfa93bf92f102, 0x2b9e3d6fc47ea21d, 0x67327e8925ca1431, 0xfa6a137720916f2, 0x9841b68f16607e38, 0x28a3fc7f3fd29cc4, 0x3d224a51fca302,
+0xd5adad3602e05d03, 0xf596c5fddad59759, 0x3112b3f262aac820, 0xfac86dc29fbc7f, 0x2b1c5174a927faa7, 0x91ce0e2d44a43d46, 0xcaa882d116e7494a, 0x22e159d87491d3,
+0xae081ca67df8c0e, 0xe7f197b162c6c438, 0x2eabd92cf9b0b7c9, 0xe61ead7812693d84, 0x611c7075a0065ed8, 0x64579660284185de, 0xb4412399c3048f7c, 0x121861cf4338d4,
+0x1fc8caa0985f9f40, 0xaf36cb709a3bd58c, 0x77005a4c65361d41, 0xf5f34c7f0c2c13f5, 0x32cfdf4b59ad7478, 0x4115e8947e7c77bc, 0x565e68424ed248f0, 0x47289a5c7b9c5,
+0x9eb377248b381272, 0xcbd3e1982ceed7fc, 0x92aeb4706c55fa03, 0xc34622ea9f754752, 0x77d0b67a523b7012, 0x6705c2332febdf18, 0xb444ee8d13dee4dc, 0xbd507d3ba6995,
+0x15ee555ecafd8e3d, 0x648547f2d8a14900, 0xfe76f523ff89aaac, 0xc8ad66b62c33be9, 0x66dfb56d7583958f, 0x4a20c373b0d37b9a, 0x42df4c73cc355d4d, 0x3e05e6a458f129,
+0x30f83a7b5db10615, 0xb66f2fb9485064bf, 0x7a45813955f17e49, 0x60b502914aaf935d, 0x7aefee8c9eefb5bd, 0xd38eab38890e3d58, 0xd1b6a43b571121ec, 0x14d6bdf4a8196d,
+0xf3d72ac5923ae893, 0x8ef9a4e0a1bf6863, 0x1cb97d1e62941a4c, 0xd8b15ebf148c2b3d, 0xbbfbef88d81d447f, 0x71403d34003157bf, 0x5b2ad0e9ded5e0e6, 0x29ac8513dc2742,
+0xea55d197c3af0935, 0xe3a06141c4d8d919, 0x5d1d2c6b0a6f502e, 0x1e27eb7a92e545b5, 0x4ff0ae1665fb1b5c, 0x5ea12f1fd6b1f761, 0xc39efc83a36314a6, 0x1eb62c10f28f45,
+0x897e7a29ad3f51d3, 0xd0872b4041b1ed11, 0xb5210515df66255, 0x43f7cffe32ad054d, 0x4dd7b384adcfb97f, 0x11138fe6053cb46, 0xc663c19afba3a990, 0x2e382ff0f322de,
+0xdf1225f0fef93dac, 0xad17b265993f9d17, 0x9124c3966131fd2b, 0xa50b4e4c79418cab, 0x8cf0f7cde94d500b, 0x15fbc210adc4152b, 0xa1ca3b36ffa4569a, 0x17ed6f9f8b886f,
+0x25e40ba983dc0e33, 0xcc756c683318f54f, 0xfa28fb8d606c1946, 0x7f4c2610cfeab06f, 0x280d4b8a8dedb19e, 0x312e94c431972783, 0xa3e7d26ed893664f, 0x3c46a54139dcee,
+0x3d918f208e0ff604, 0xd5c107260274d9, 0xbd730e0f7e55878b, 0x17a0c7f5e1cddc79, 0x7106c3025e718d4d, 0x19b309532effb2c3, 0xa3c46a22e947b417, 0x354211c2ab9ce2,
+0xa8f0383ec6e481c6, 0x875cc7e1f652462d, 0x22c568379c09947a, 0x6c92e0875c156b5a, 0x41f7a345cc44bc00, 0x45be1e0d06e9919f, 0xc1e260779145e9e7, 0x2839efae1d63f1,
+0x489415b3ac67bdbd, 0x1657fbf9dd5f2168, 0x203c875ef8765bfc, 0x8d987b964106d8da, 0x636a2fb8d7c2ef86, 0xd026fb5b96b7a8d1, 0xb6c08e5026a8b7b4, 0x1b58e18329c1c2,
+0x608888c2d22986c9, 0xfd713cf494cf0342, 0xd4cd21eb843e914b, 0xfbf827b19633eb41, 0x90c0246f8c2651e5, 0x968c94c1e5172455, 0x4779472e8373ea9, 0x7bd323907e25a,
+0x6dede940cb1d5b9d, 0x9722ac4172a2c1, 0x64240183feb84304, 0x3baebf01830db3bf, 0x731adbb323d69c29, 0xa52d8b59d0a5302e, 0x46dd4a1f32bf02b5, 0x26472db8979467,
+0x3ad3705e9405e94, 0x52bdfa1e3cd915c8, 0x2c46e425311228fc, 0xcbb680e8f8a6d016, 0x7a8bf04b8cf203a3, 0x911c771df98da8dd, 0x43d07f115ec99bc4, 0x10f8cfb1d3548f,
+0xe56c15882bc0fd51, 0xc5e8e5326dd45ccc, 0xacdfff9d263aa8f3, 0xa7d2dc32366c2e9d, 0x1ec13cbc0cf197b3, 0xcbcd1deb5a2f5f95, 0x924b4ab7a3a9fd86, 0x106e8e00077dfe,
+0x86db00932553f4d6, 0x8792b8678c465b61, 0x497991c6cf748d7d, 0x6b1aa9a53ce3afd4, 0x682833df7d83ac14, 0xd492517928dc612, 0xb13fdb3df6cb10fc, 0x1ee4d44bc1c553,
+0x5148b81ce6bd0157, 0x52ccb3789a5df684, 0xc0d2fd37e0622da0, 0x443187394f3ae083, 0xedf7847faa46d5c5, 0xbb76aae1f2aa31fa, 0x9dc9d1bcfd3db000, 0x4637ce289cd8f,
+0x2420155031aad6a5, 0x5c0ab3c5cf930825, 0xe7abf2bae45e2504, 0x1d5cde67a0832034, 0x641b1d92e8707ec1, 0xb6425fb38738231e, 0x4e06131fb171fed1, 0x23e2f221891128,
+0x951c989f461106cf, 0x96ef19b6fab58a19, 0x3cb2c61e42b9cb10, 0xeff9996bf18edbec, 0x1652710d1c6082a2, 0xbdd0afdb271d3e98, 0x470617eb3a5d7ce0, 0x1a48e265464d34,
+0x61cca325818e0b60, 0x6f03300d016bde46, 0xcf9b611b356d01eb, 0x8f4c5fd08b797811, 0x2fcc8ec3e6d02493, 0xed66df8931038aa6, 0x23d4c9bc38937396, 0x313b53cdf6bf45,
+0xdee9eac81f34de06, 0xf75f1bf52c52a960, 0x27e348824a021c2b, 0x4242fc210cd21adf, 0x90a67bdce4a1a9cd, 0x8af41ff63e24d447, 0x51e4ca82c85eb123, 0x3a04f044c072d6,
+0xfc15565461c3dd50, 0xd1a2c298302550da, 0xace9f27b8803301, 0x498365072baca6cc, 0x9c862e8712b0cd76, 0xce2708f1b6478f07, 0xddaf0b5c6d9cf9a5, 0x3c02d0e2bdd862,
+0xfed3cff2971d32eb, 0x4b95511b2c5f9e93, 0x90d9fb6ca67588a, 0xc48c936c6cb23be8, 0xab2ee7e8f1abb3c4, 0x50a328d51aa377ab, 0x390e396c158bbb1c, 0x3ba0f0583b589a,
+0xe88333bb8601439a, 0xdd70ca33549143b, 0x295f43d09b99f4a7, 0x7c84d597913bbf6f, 0x1d7e79837c00db78, 0xdc475a41ecbf21b3, 0x5879899dab9cdb33, 0x1b79f72854e784,
+0x25de31f7588bb34a, 0x45211580c9038d, 0x46852b62bf6ea1ea, 0xcc686539f288b9c9, 0xb7aa6be3ac53cd2a, 0x99485ee3f23cc393, 0xa6117a3970966a92, 0x3f2821d0240e09,
+0x18eaf333df7354c8, 0x5a4e7e3b47523153, 0x3c9d59b9697b1b4e, 0x8b8095e3bb9ee83f, 0x7401a38238071698, 0xec6d66c6ba85020e, 0xd76e07d0f0fe1fdf, 0x3e9eb8ba52fc2,
+0x3674871b70edd9f0, 0xb15d1a14a9f4396a, 0xb9ea305d6c9695c9, 0xcae5107a8ffc83ce, 0x6e58a9562a2859f5, 0x869a49da21dfb681, 0x247faa70ccd175fd, 0xd200159f1736d,
+0x4d06c4b5966aa2ba, 0x76e50e81342698ad, 0xa3bd89effa819913, 0xbd3a2a739a41e3ca, 0xc7151a8f7acefae9, 0xe43a776503bc23b8, 0x730029a35354d8b7, 0x33b5b6a7bc3398,
+0x7a9233c64a6777be, 0x1f9abe48e3ff167, 0x5519f7356cae3f0e, 0x36ee10166c2aa29c, 0x9877b9b1d11c0019, 0xdfca607961e1b70d, 0x89f2c9b122024609, 0x37aa38928be6fe,
+0x81fd66512a197d96, 0xa8f66280c27bb1b8, 0x2b0a91b3347f86dd, 0xfd5745a55bf43ee8, 0x8d1a27666671baec, 0x6f045f4f03282ed8, 0xbcbef8132f238e72, 0x11a713b4f36f95,
+0x831f7e0def4c0a77, 0x4bc5e3dccf78fb92, 0x78fb49dd238c4c25, 0x97861d3b8ec8b215, 0x2e2ef6307d2fc445, 0x6b6d53863d142df5, 0x8fbda64066aba3ae, 0x9dc92e9ece45f,
+0xbc2efb6aee94a0b0, 0xfcebf62ba0685a0a, 0x643173f5349f7a3e, 0xc1ae3fcbb8360318, 0x18b2191c631cf301, 0xe425d7e478c7a349, 0xb1c54f7c603319ab, 0xbef81a66aa6b6,
+0x749e19f17c2f1eb7, 0xaf9cc4b55b460f67, 0x9269a06fea3fc5b3, 0x654fd9d21e68a1e6, 0x3741159efb323a08, 0x16e4fd5d3cfb1760, 0x2005cc09f5734e76, 0x21ab564e606eb4,
+0x2ca30e2da1188f5, 0xdb38c71cdd757870, 0x5a80a76447ded70d, 0xc9db48a6dccfe3b3, 0x481b45c8717d439d, 0xdd9165db226894eb, 0xe82b93182280d172, 0x8ad6b007a3df4,
+0xd22dfbd641301456, 0x29876ba7aa6e5665, 0x46aa3348c5dd5202, 0xa5aa41c7d251d8d6, 0xa121bb07c1e672d1, 0x2a22b6f0e6ce8eb2, 0xd08fe66217ed327d, 0x330af89f570ed3,
+0x5612ea1c695a38cd, 0x9ac901e0b07a4a5f, 0x59eadef2ec28b302, 0xdf018cb509ef2a6c, 0x5917b90e9c38ab58, 0xa29a50c9ac925592, 0xc00181d928ea5a60, 0x3a505a65dfc431,
+0x4aeef320cc716b50, 0x8b994244c39df79a, 0x9c537b2fb8515881, 0xecf532035be694cf, 0x54c5396c2fa2d180, 0x931387eb621e97c7, 0xe81be782add55965, 0x21bde0571e23c9,
+0x308ae66e17652601, 0xa4c6f9a7d61b7654, 0xc2fa73c93b3296f1, 0x58af35d6488fe5e, 0xd131bda21791624, 0xad40e2e675dc5615, 0x138007e5545f41bf, 0x1f26cfc495e0ba,
+0x6a73c55df7daeb27, 0xd8ff7c31e335a359, 0xe2634b88ee29d488, 0x1b06661fe0620f65, 0xd3647ddd82e16841, 0xcd7eafd38cdc8af0, 0xf1e9d73f692546a0, 0x306be4151e46ad,
+0xa6fd8f37be03807d, 0xdd57560aa771fd9, 0x29a2af8d93b1f3e0, 0xbfbcc689ecb5857e, 0xea85e19316a75fb4, 0x21a36452099baf2d, 0xd058d457650542d6, 0x1c8745d7d6cda9,
+0x71d6a2068d254f12, 0xec50f2dec68a80f1, 0xad82aab7d9df0cf3, 0x80b0d3bada84f80d, 0x6859a0b3eed1bc1f, 0x53797d1be78f6455, 0x6accbb9fac1817b6, 0x405cd56d35f0cf,
+0xb0e52dbccb153cad, 0x92599c337cc33a9f, 0xc08a1c0dd9c7dadd, 0x893de0f559f2203f, 0xe27a912b4b08b4eb, 0x2a1e82ad3a13ffc4, 0xffb18a5ead522f90, 0x20b1b3f2205b4f,
+0x53e53ddbddf6a8d, 0x29944ff85255f42a, 0x8c3ccff9a1870969, 0xd5468333877f37e1, 0x7f2679ec5ab731b3, 0x107ce005e1c20dea, 0xf90315fbc00cad99, 0xbafcb70a91a5b,
+0xeffaf33d012e18f3, 0xda914a0d26f6c13a, 0x48c5fc351f0f5d10, 0xe4a6ef07985729b7, 0xa8759a1ce53a4e7c, 0x624ce8b7a0976afa, 0x1e941703a3dd0f3a, 0x1f71f4064b2616,
+0x253ed7a36ee0fc5d, 0x4d705b8c29921149, 0xb63e39335bbeace, 0x1f1a5f8e75b18877, 0x6db2910085c9f5c0, 0xcee7a1c7aa6be5d2, 0x26eca593702d58b1, 0x17c30a9308cc67,
+0xc5df98428de01041, 0x4a26cf86287b7f9, 0xdc48beab461f4ff5, 0xf2af24860787f1b1, 0x9da567f53e7afed2, 0xff67ce4cf98779ad, 0x2617cf0740f69a45, 0x29f3b48057f48f,
+0xec737ea374aad717, 0x6f8b8dc4fcb23808, 0x687faa9f70834399, 0x76d8ae636437779a, 0x8ec9a62dd5a09a39, 0x43f20d76b8587ae8, 0x5a89f0af55b2ddec, 0x34c7867331bad1,
+0x73683f6adebc304e, 0x4590a04bd4a20081, 0x9b57de14b4845a6d, 0xbc5d617d8ff5d122, 0xde6d198a8dbf5b72, 0xea5c9af38ab7c4b8, 0x1a06ed515a5ddff7, 0x30e35f5174d6,
+0x798a26b536117026, 0xbafcbeb08220eac7, 0x28d9dcd1a7ad709, 0xddbc99fc39b32237, 0xaa66f69a7a8655e9, 0xdd8d80c1c2252751, 0x3b8504759c3b9edb, 0x2cb93c89fdd6cf,
+0xdd604aa950d5eae9, 0x6c1408cb5ebf3a55, 0x2968bba275285738, 0xd20f1e2177906961, 0x2cd4c797e7fac7dd, 0xc0ad3f5f4201f29b, 0x952d03a1c49415ce, 0x26a807e1a8671e,
+0x3a7c747f23e1f20e, 0x39f8c7c064be9cd0, 0x3153a2bb3af968e1, 0x5344b6fed2c2bebf, 0x5ed4a070f4eaf3a, 0x90c0dd4b3fd8a4b, 0xd557dfb19a7b3826, 0xab2c515ba74dd,
+0x91fb9abae2b5842f, 0xe4d43fcf3f9ddaf7, 0x8090776b0afea86b, 0xf369ccbf385a0a0e, 0xb170f8afdcd6edc, 0xa5a66de1f5fa71d1, 0xa00dd0ee8e547d6b, 0x1fbc9941398cfe,
+0xa46c4675c95b09af, 0xac16349656038926, 0x31422a8a01a31796, 0xf619bfd277dbd8c0, 0x50d71f334b63316c, 0xaf2f4625bd9067b7, 0xb58d252e659b11ca, 0x3dab3622743573,
+0xca86426582f3a4c5, 0x20663cc1e4b399f7, 0xa101ae12aba26821, 0xd3a948cfefe6a4e0, 0x16c5c3039daff5c5, 0xa0f84e40d334586a, 0xf9b125d0c329535f, 0x321eb027bb020d,
+0x9ffa2d2f201673be, 0xa8bb8800d6923415, 0xadf10ff60139da3e, 0xb78b67f39c3d19ed, 0x77f10b25613b75cb, 0xc2d6ccc7f5962f4, 0xf169b1daa2507eb3, 0x3d9d8b704d5b3e,
+0x2bee20102615c46f, 0xca5f299cdecbe20c, 0xe19f22d31da2cdba, 0x8b3e1143b488db68, 0xb58b3c491292563e, 0x609413cdeeb30c47, 0x3b974bf9bc11d0a0, 0x2b217b4af56792,
+0x1516f4499b794c86, 0x31ac5da46f6c567f, 0xa3d7e060f5ca2193, 0x4b1f111bf6dd821, 0xee0c29fe37c597c3, 0x279c2cc21b5965ce, 0x7c0dbb9081c2ca00, 0x19faa67ff1ead5,
+0x327614fda9c70685, 0xcce879a0cfefb6b3, 0xf5b4a5897d875668, 0x5ed08e0630518570, 0xfc8989ba6829d64c, 0xf96b7b5729a59fce, 0x3a0021fdd3af5676, 0x23e3bb4a6a281d,
+0x7d03fd55e52b8b75, 0x29b0b497deea0516, 0x78f745ef9f72f831, 0xf014bd145e689c63, 0xdf00a13e39dbb0c1, 0x7219ee82cd77afec, 0x2c1a0e8d6f994cf0, 0x2d144efce76009,
+0x7465c5b2e3375697, 0xa9f92b3e341a677, 0x854fe2a0a5e50690, 0x9c1cf630a166689b, 0x14ad3cd0721faac3, 0x5492aecc8b4f2355, 0x5c454409daee735a, 0x23a3a387bd50d9,
+0xebd4d3b91a6ea71a, 0x5eb9b2c1aa7b5d6, 0x9f68add6a8b1732f, 0x54b639ee7cd38bd4, 0x6c8cd688fec3058b, 0xf84d6bba65a9c7c7, 0x8ee995afb08caa6e, 0x3380ef71d12006,
+0xde94d4b9145f505c, 0xa65c118890c14cf1, 0xb1e56bd856a203a0, 0x2c7148bb7e2a9a52, 0x35a75012f1d66d15, 0xa83e379438fd30ee, 0xd5debd722218203d, 0x138a23279a6535,
+0x9a8ee6cecb027500, 0x961b6c2f6f60de9a, 0xe5cb3002de493fa4, 0x366a5079fc5e9932, 0xdb8d674a8b34073c, 0x759ff48d119b9c41, 0x2544b4bbed596512, 0xa3e3f3b9fdfd3,
+0xa37fd491f74d4ea4, 0xa188629c847ca5fa, 0x6273ddf6da9a6b73, 0x7816ccacb01ac840, 0x903f977604b04a0a, 0x6b24fc9f53584d27, 0x3fe944cdefa2f562, 0x2330a4d6d15655,
+0xe2e4556a49c1b75d, 0x50c46a6d27dbf417, 0x323eca2ff2f80903, 0xeb31482d4de6e6f7, 0x2057f98bf4b5108, 0x9a984a56be99d0cc, 0x8c9858773603b1df, 0x1e3a098e2b2cac,
+0xcecf00aaebbcb975, 0x630aa1927d0ee7df, 0xd234ae175dd63609, 0xa7b80b33b4bf71c6, 0x9650f89a364247c8, 0x8d5d54979a5ae8dd, 0x91579e7cfa96ca14, 0x2c4bd92f252df3,
+0xcecc901d0ef6c6b, 0xa3d79152a8275485, 0xcf2300b1c1f01061, 0x529ed4c6d768ef8d, 0x5e54e539af679f40, 0x62d4d5ebf30007d2, 0xb1f463b55b1702ce, 0x1da7c3e2852af8,
+0x91b48ff2a1de6cb8, 0xd989e5e018af93e0, 0x523e953f26924c90, 0xe1bfe7352afcbbfa, 0xc1b989d4f11aebca, 0x2e1b69a8ebf68027, 0x41606d0e079e1239, 0x18a65ef2c7738b,
+0x735f4aa77d73bdca, 0xe212603aba252497, 0x6493722457af0cbf, 0x1e8c22cc33abf819, 0xe716c7dfbc344726, 0x7c20d444bd8ac409, 0xfe294821592462a1, 0x1468b660eaabba,
+0x7421a29a28d023de, 0xe76bc0986ba1de9c, 0x885f77c174b13a, 0x1e022af9e545aba6, 0x53aff34c13f736b0, 0x76ea0df23ea7d6a8, 0x87694d31ba5a9bb9, 0x2204c781a2512,
+0x9176b450532aad68, 0xa46691b9a8c1f4d1, 0xf44d7fa2a738ca4a, 0xdfe0247de5028e83, 0x3110c35a4042397, 0x111ff00991140792, 0x5f208bc68ca66d0b, 0x149f73befbe665,
+0x3b266e6a85241123, 0x491db84a7ed642ed, 0xb2991e1c808fa890, 0x6c17c2064e114d1f, 0x3c660a8412ebd772, 0xd2499d15ceec55de, 0x2af9ca8c65384b2a, 0x149e4a15767e45,
+0x2a426dfc29f2f4ce, 0xc03e89ab262cf548, 0xe5e246c172f41d92, 0xc35412c691276ff6, 0x559989030bf52a85, 0x9a8b2ea4bc67ce53, 0xbc8c39417a550b8f, 0x3d65f1fc95e236,
+0x486c6ca48f081f4, 0x666632f14cfebd1b, 0x7e251069a5585946, 0x8d3c27f6388d9520, 0xf40f9a8c273a9da2, 0x8e65d483e9a0601, 0x8034a735d74709b9, 0x26c65448439111,
+0x9518c81209a457f9, 0x1090b934ee916e7c, 0xea57a45d18b4d776, 0x6fee1f74486f7f38, 0xa5757bcc4eb2b3e8, 0xdef51460da5ad803, 0xc37ab2950b384b49, 0x1136f9187b835c,
+0xf004e6b503821be1, 0xd56a115f71e7df75, 0x7e2de0bc73ac960f, 0x364be792f7103f4, 0x346887f052f396aa, 0xc37a19432a241292, 0x4f1eaf642dc77233, 0x190a7c03335c78,
+0xb9cef1c5475c3bf0, 0x8eca8c11dc3844fa, 0xcf7c80753663999d, 0x4ff2a809a7002420, 0xbe25ccc2a3651d9, 0x64013b38e6cf0ad2, 0x88c0135db9c99590, 0x17e60eb1c768e0,
+0xf2b909c0fd70cce6, 0xc2f11b3a14f6d8c5, 0xcc956c7fa7d729c6, 0x7d2692b83bbd6203, 0xffe640c64107ffde, 0x7852cc84ecd77e7f, 0x6b5360cacb256030, 0x231a083e8c184c,
+0x725da58021ab25a, 0xbaf426d109ca4258, 0x6ec921286f969209, 0x1115d9c50012e3cc, 0x11baf857b8498fdd, 0xea82c4c0e2d10816, 0xbdf05ee6420f9926, 0x3e961c1cc91e8,
+0xe26da28497f8dd16, 0x8cb89b839b4ba49d, 0x8f298e501db01357, 0xea089318971237e4, 0x882a1763f235cfa, 0x214db64903afca00, 0x4a3f556350445ec3, 0x14b359d6edc16b,
+0xf090c657e36f8460, 0xd3a7d76e69eea249, 0xf0e38ab0fab5b82, 0x42d83c7b8111dd4a, 0x31c52295b7c3339, 0x78f7dd247a6eaa39, 0xb838e9ab1baa0907, 0x3bda813d61c035,
+0x2d7b12f24a1a6ce2, 0x92c036b2094f7d9e, 0x2abce9c7d2719ebd, 0xd10d6ba7fb48931f, 0xcb6bb8303fc9c14c, 0xf8b897257787f60a, 0x50d1e5c9aa15559, 0x1ef10c23472708,
+0xfe45a3c8eab24cde, 0x300575b89388cc99, 0x83e7eacf5aaa3ef, 0x462086b4abdba7ec, 0x6a4f46c858bdec24, 0x4989003ec19a6701, 0x5b4e4393b02fc8ba, 0x3143e110d975c6,
+0x93e63efbca9850a5, 0x9b54b76ea235a3c8, 0xacbb3af507236221, 0xaf49141998d93f58, 0x5386af9f66734a15, 0xcd18a80d7422cc00, 0xe7058029fbd16383, 0xbcb2cbcc9164c,
+0x54cab2406731948e, 0x86659391408aae4a, 0x7c8cb73db3fce35b, 0x2004def2e05e4ff2, 0xea786338a8ee1cfd, 0x14755402d480c9e6, 0x612f9536a1790752, 0x27150e16c4aadd,
+0x6b7055083cbe4cc2, 0x4efa1cc6d85b7043, 0x66997043f38e6220, 0x62de6a684d722db3, 0xbbc45222b8f7670b, 0xef5c0f8b1b8fd986, 0x817dddc0c378fe47, 0x32555dc4f570bb,
+0x87d6403ac56351b5, 0xe52a54f0e33592c7, 0x6ca4c743809cb6c8, 0x2800adba7d0f3aa1, 0x7251f48b541a5665, 0x96425879052834a2, 0x6c34038f488f4ed1, 0x2618d7598da1d8,
+0x2ec8849bc7e88cc7, 0x5e4f6b820e9e2026, 0x2c284314d56d2f4b, 0x2703aaae7961118e, 0x42127298244d4907, 0x94b0f0521667952d, 0x7ff4d7c9ca668bb, 0x2294b8a029bf91,
+0xcbcdbae4de364c2a, 0x55b5edf58c0f6893, 0x9ab3af5d99b93784, 0xf2d93dec64ba6947, 0x838fdb121c82f4b9, 0xabd11664f2329197, 0xdcaf4081be589569, 0x2342b5edf5cf73,
+0x1f977e390a456ad0, 0x7b8885c2a8f3366a, 0x1a309690f28e780, 0xa8cfeab391bf230, 0xd051ceee0995f29f, 0x63b32aa9c4a04c42, 0x4372bb5b0d8f3534, 0x31def2734edb02,
+0x8d120c1892a47fbd, 0xb53b0905efb2dd60, 0xc202c59983377849, 0x89b7139f32245bd2, 0x348ad067556a44b7, 0x3103dbd41f8f403, 0x51aeaef5011220ed, 0x3d819bb3a9b83a,
+0x42cf955c37758d7e, 0xc9ff9703d52a94f4, 0xd2359701a8ee8f5c, 0x75567594376cb34e, 0x4df67a1baa266112, 0x1e84177a2a69737f, 0x3de7d99e274bf695, 0x2dfa9ae890d472,
+0x9589250f64adf207, 0x3c18a192812c64d5, 0x747de5aa78815077, 0xeb735e3dbb6ec790, 0x35fbccc3abf0293, 0x366b42fd4292d4c1, 0x41d01bd843ed96b3, 0x14332f5187789,
+0x47dac76d8d46b300, 0x2f8fde96a78d325e, 0xc480d318eacbeea1, 0xd9136c5e4afb0895, 0x6b18217d8d94f728, 0xfb05985ac05caef3, 0xeee9753e222c9e9f, 0x3673568241318c,
+0xde12d1f9f812605, 0xc25336dec475846, 0x6df4efc570461eac, 0x416d2ce4f3ee17e4, 0x8f835ec33e177101, 0xde1d44b184059508, 0xa3a657ff215808fc, 0x3812b8e9e26eb1,
+0x5d80fb1f656a19e7, 0xa1687281a6b47d9d, 0x6eba872311a6c742, 0x5915f5a29053358e, 0x8765244751845b5, 0x4571943daaac741d, 0xec568493dba04062, 0x54cd995bbca0b,
+0xaba8772a01da4eb6, 0x2c9d8388c5c6dd7d, 0xe3e3c2c720440944, 0x807bb2c46b484d45, 0x6b5c305a5e907b2, 0x36b4cfe85e10b514, 0xdac099ed7127ca85, 0x2ebb9f6ebb0153,
+0x647d7e03ed88423f, 0x6a3f853127756055, 0x62b84c9c688159c6, 0xefb78f77afd208dd, 0xbc2855d8aa125eb8, 0xe7136f5db7b22e87, 0x5aa58ca35e3a6312, 0x1857acd6ebbf63,
+0xe5e534e824cd92d0, 0xd7ebe66226a68d94, 0xfd647ca728736f3b, 0x91a0c2c519d041fd, 0x52cdf518f3dea708, 0x367400dbc3645c1d, 0xd537dc8054a394be, 0x4dd08512281dd,
+0x7012e45171aeb901, 0xb7e1be70dd86bd17, 0x575b9ad5bdd5eea5, 0x2b78ff265c03825d, 0x52257dff55af12ae, 0x6459d91a090160e3, 0x2df0036772fce824, 0x71e7a38ba0611,
+0xa0c1e28fceb1ff60, 0xbb31c5470ac34253, 0x45b44909a99dec48, 0xe31d819b970bbf33, 0x98bed5715b392f4e, 0x3ce5dfe8cffcac36, 0x59731411d61bba0a, 0x37c736f59d5256,
+0x1c3861e72d4307b5, 0xb878c10229e0b2d, 0x24b0580d48d4f238, 0x49ab35dae1a9ce8d, 0x6f2f48ee316689ad, 0xcce685238fb671e0, 0xa7c1cbec9359622c, 0x35a1a9b4398e8b,
+0xbfe2d1380502dd7f, 0xc168642003e7e06e, 0xe57956d6744d4ba, 0x124ecf5780eba5d7, 0xa8f3bcebce5c2cc5, 0x9e9aa99c0f5b1bb5, 0xa6f70fc2187768be, 0x68774cc8a61f7,
+0x846db30d7081ae64, 0xa43a61243a2a5f72, 0x59fa34ce0624f6, 0x23b28163cf9997e2, 0xfa2987b4d146fb57, 0x3a77e3aa14880f2b, 0xf5d01e6971144f06, 0x1b7032db9f151b,
+0xff0c128c5ec201b5, 0x834ad9f23175398a, 0x988e6fbb60739579, 0x5311f32c5bcf9929, 0xef8785dbb3eb10ff, 0xe304474d6b4222d7, 0xd5b354ec629ff681, 0x19d3c5ea0c2f54,
+0x558ec60b43cc482b, 0x84151397b8b0124, 0xf91c5eaa35436084, 0xad33b5f5ca25699c, 0x91a63b5fea173089, 0x2eae3d6a31ff88b, 0x96b7da50e3d918cd, 0x28d3fc77a3f5e1,
+0x36890d9b7402f49b, 0xdd56fe0e391cdaad, 0x654cc520b91e971, 0xe4fc28115eeda38, 0xa59e0314ec85bade, 0x9b64bb913bd9ea27, 0xbf432673ca4b1125, 0xc960994d11309,
+0xab0658eb02ee0e8e, 0x360ea00d685e93fb, 0xe58ffb1b93c95928, 0x99e0c4857e7fd027, 0xaf0445fecdd2b9db, 0x621daeb246f32bb9, 0xb17c48ed2fb10007, 0x15b718f2e67477,
+0x765664f92cba1bbd, 0x192e2f682bf58e7b, 0x5f721fa4b48f23f1, 0x6042f9c7ce4a6f95, 0x7f1a545ca8e01a56, 0xc83360861ffb9a05, 0xdddd2d85bbaf7c88, 0x372518af19751b,
+0x82d3dc2f5cb83eb9, 0xf859d90af4f3df8c, 0x707d03877b908876, 0x2efffd3fe03ea88b, 0xb889afd4fba8657, 0x144937d9aed89729, 0xa37528e164593992, 0x13945afaa0eac9,
+0x8b530faba146c1eb, 0x5a431625d9e78949, 0x25b80a700478a86f, 0x4578a1c7f8195192, 0x6e3c9e866c682b82, 0x54c55238b7c39d0d, 0xd2d62f00ac9321c, 0x3bdcf4f6be07ed,
+0xf39065cd7a127687, 0xa176510cd66ea07d, 0x7153746f49ebd590, 0x61e3e9de02ce7b05, 0xb9c140e37eb18078, 0x448cb2d9b45e390b, 0x4774dc514943eb17, 0x2776d52c88a76f,
+0xc3de7195fed1af9a, 0x84290291b2355ba8, 0x4fd2ee1860caf48, 0x17a83b5f688f33bf, 0xe4af9246636026a0, 0xfa73b86b9baaf27e, 0x13a0d73564de1386, 0x2c873da730e3d7,
+0xfc8e37a87e357afb, 0x112263afa95bc6c6, 0x5d5f8e1c469bf6ca, 0xddb53cec064c6c25, 0x9bea927c1a04d92f, 0x1de992e295884bda, 0xa4a892d01464f3bc, 0x20f243d494c99a,
+0xa67bd273009a947a, 0xd439702a25183c27, 0xf8fc2be94a989c70, 0x98262a2a2f01b860, 0xa31329a3220d02d9, 0x5eca0d64aee2bec8, 0x764cdaacc07a9155, 0x3936c3e5f9b3d2,
+0xee715368a0c449f3, 0xb970c92d4828d85c, 0x725a90dcc0362358, 0x9b447765095327a0, 0xbe32cbbfa8939b71, 0xd088f382ec2e6522, 0x1fad31620f0df56f, 0x376350d8c44bcc,
+0x3af66e9adf63f061, 0x957bd890a5e8d194, 0x8ae9712540450a3b, 0x16d8c467c4023dea, 0xc2ac548bf5d3c590, 0x77a99940d1a664fb, 0x1f703e1730c3be2, 0x873cbc7ab51e3,
+0xbbfd1c49cfdc5347, 0xd8e2655e746905a0, 0xc4dbd785d7de9f23, 0x7efd29ee604c5776, 0x9e50d0409bc56d1d, 0xdd80c82b2dbf12ab, 0x302d57fec619cfd6, 0x1d60b7c722a89c,
+0xc4108d5224a0840d, 0xf2fed8e04aa7d5a, 0x9ceb7fc07da07524, 0xaacd099fc2812cc6, 0x926b863e1c89b40f, 0x8b4fd424201560fa, 0x51f1b78f52958702, 0x5b321586606a6,
+0xe8809a3a14d0c17c, 0xddb47040a8bcfa7e, 0x9b6063d4ee74e632, 0x9594448db40e2ece, 0x35ced71ff8d9e85c, 0x2b5d686d33d60b01, 0x4d179f166548a4f0, 0x13c07b59c4ae80,
+0xb7b50cd731cac0ab, 0xd79fa5c9ca22fc0, 0x1162e0f865cdd5c9, 0xa18a36b274ff5ca3, 0x485c9c53a3a713d0, 0x5a6473444f506df7, 0xa88bb1f93032de3f, 0x31ed5ad2cf8857,
+0x13c63b315b678d3f, 0xa8671f88c59d47b7, 0xc42dcce66be5203a, 0x996644b419f59c6e, 0x1045ae8361cb70e3, 0x55a8b491a6937eb5, 0x9add9d50f6adbc35, 0x212160e5112678,
+0xec3b2b7a092f899d, 0x4fc4e12a6beb2650, 0x7075b923164aa88, 0x7df8cc4f2aa994b3, 0x610a7f53fea631ad, 0x746ec9abac196963, 0xdd9d42c4c573b96b, 0x136652cf3222a8,
+0x4d99c2954830fbff, 0x8e10f1658eaff388, 0x38a14a0e7f0029a0, 0xf8cc0d2daa04669b, 0x42d0976492b2e2a8, 0x196939964c3aac4b, 0x5062cec5eb2a9e45, 0x100e1a5deb94cc,
+0xc59aad29a64032f2, 0x96505871f17c3af0, 0x4a5131d661dd7b78, 0x2cc6aa4b786a511d, 0x5bc04eac6871576f, 0x1ddd92affe302feb, 0x5372768ef988974c, 0xe15ceaebb7267,
+0x1f43d7c75f1d3755, 0x8c8c89ed1e809b96, 0x9333567053c5f377, 0x68387d14dbe1bd9f, 0x4fa4e56386f90757, 0x632ab57d185fc192, 0x1947ccba0ccfcd5, 0x26651c855a5222,
+0xc78b9b4a1c786e99, 0x6556aa2a3627ad4d, 0x7069974705a695a8, 0xde4c4d157bd8fe88, 0x878e3c5361148674, 0xea47b75147151e92, 0xba66607a1eefc11c, 0x12294530e0e4e,
+0x7b10c63467cef7a7, 0x9aa549d1a19435fe, 0xc89c8957a489c56b, 0xb90ba77c37316e9a, 0x97e3c54f97b08d71, 0x99af2dc12c6b2be3, 0xeaf4b2eb3b20f01e, 0x12fe4869c4d51d,
+0xab58e8eb0641ddd2, 0xc88ed2957348059d, 0x585a27e48c437473, 0x24b22b3a086e3940, 0x92e301eaeb77112, 0x3cd389e464daac4b, 0x7fb78b44112e66dc, 0x158aa75e075bef,
+0x1f52636f411a7726, 0x1436a9b27b617e73, 0x28a7fadca663bdbf, 0xd17e94fa4e6c8bd6, 0xb1afe3a30c7ee065, 0x639932c4fb7f4ac0, 0x12d54d7c01abd12b, 0x20560bea459c9e,
+0x8423fff5578e191, 0x3a73eaced1ab7169, 0xcfaf86a1594e89e, 0x752347328ffad84f, 0xa04b9b497229e343, 0x1e9a7991d70b3edf, 0x10e981f073c58401, 0x2d0be9b96ad01b,
+0xe1957c539c55a594, 0xf07b6f3439c15fe0, 0x617e712448bd3341, 0x12590c427065080c, 0x1af9031b3fa312c3, 0xe3e3ef2717be192d, 0xe87f3685cff6a82, 0x39e28d052b0a01,
+0xc5ebab35598a49ab, 0xd6abf0b97a030f69, 0xa73c28ea00686951, 0xe207d8b22ba8d996, 0xdc215ade6a7970d0, 0x48dd287c47ab0b41, 0x3242082b7d7dcd72, 0x21a2e19adf4a8e,
+0xbf562500e8c5dd12, 0x2f623111dbf5e4f0, 0xe31f24c92b40cf79, 0x4aba205a296fd767, 0x312571c21b01c074, 0xb5f405792ec8746c, 0x99da3b19b884f463, 0x1b0a9bdff9d413,
+0x60d8ea70e4f41ca7, 0x7c2693569e6c8377, 0xff2ce655b4dd1059, 0x14efecc3e11b8c7d, 0xad6cc6601e964fcd, 0x293f0ca0351664a8, 0x4eab0fbcb5f8d206, 0x39754bd388b597,
+0xcd7f796ab377e71, 0x47e3e15b00be3f3c, 0x214d1f5ea6534b95, 0x7f527f2af986cc80, 0xbd15324d1637046b, 0xff55f58b50b64313, 0xe2439cd0d7a1e68c, 0x8692e9b53f8cd,
+0xd2940320568cacc2, 0xbb6d040b64f57efa, 0x2f7c2c5e00be4fbe, 0x3e085ecec3e305e1, 0x843cb2f9a64695db, 0x383c921d1c0d5b60, 0x92c9bd2b1efbdaf0, 0xf14aca88693f4,
+0x7d8b4991a0f517a3, 0xdfa6ac1f6984d766, 0xc14f7126beadc8c, 0x3e88068c641d9147, 0x9a6f98ab0e0792bf, 0xe66d0caed66520a7, 0x5a792ed5288f3677, 0x38b3a3c4cc3c1b,
+0x7e507531793b82b6, 0xadd2e6bf6f461acf, 0x693cc2da4c7420a1, 0xa6dd23523884f179, 0xe3b4a144d5fa9b34, 0xa9cd14d3fffc3dc7, 0xeba0b086aa696987, 0x322c9082d8890b,
+0x61cc142ccef6342b, 0x8d5bfbdb6ad11490, 0x6702b5e72ec48ce3, 0xbacf6c5d46571b56, 0xc80cb54963a9ddf1, 0x7e28430f7c8d5f17, 0xa46b39ef06ad4492, 0x2164503432529f,
+0x493ccf2a5f9c05c1, 0x7e764caaad8e73da, 0xe858f04ce9307d47, 0x8c08fd43a6163258, 0xa292e8423a49f53c, 0xec702697eceaccb0, 0xe55c9ba9d45a5a8b, 0xcb09d1560af5d,
+0x3a9488ab45f60848, 0xc76840e08e50f936, 0x25f80285eca956c5, 0x54ee68c9e4b48781, 0x3a43999dc7ef3c9b, 0x6f06a672b541efa2, 0x83aa94f6d6d5a99b, 0x330ba06ffa74c4,
+0x1368d6721820c06f, 0x3c662dd814be33ca, 0xc2e591e157beabe, 0xf8a8776ce5739487, 0x19c57ffb8df9a27a, 0x8530df00c73a25c9, 0xc53416423e1153b8, 0x343c4ed4257a05,
+0x927f002bd150f7e6, 0x2d29d0fb19eb8611, 0xb2b0ef451b5742e9, 0xb97732d4dba4b02f, 0xd948db350874e923, 0xbbae7d24dde90886, 0xeda581fcec7840cd, 0x19bd1f5589c055,
+0xb733b12b16b8a66, 0x76d03dd0455fdc6e, 0x70561ee02839c9b4, 0x13b5b5b1d19c911d, 0x3339d731172965dd, 0xfd65a93b4beb5ea7, 0x53c8b953e1837b3, 0xad2703dee9718,
+0x1060b481b7534b0f, 0x601175679fe07eab, 0x6e67e412efd55c3c, 0xfa253509a4d31ce7, 0x38c1c27bbcd01d0f, 0xb562400f14ed6bc2, 0x72603ed0cc06249d, 0x12377d2256b8fe,
+0xb92f39f41b6686f2, 0x45c277832fc21d3c, 0x1f09f653186cf355, 0xb2578c018d6f01ee, 0x97f105d24bcd8a45, 0x5c7d9b73711cd1bd, 0x9cc0bc35b9b937a2, 0x2ce0698e03e4af,
+0xb86debb21f710850, 0x94b44e6624e36a48, 0xa2040edde803b3fe, 0x8c9e48b99ae3aba1, 0x4ff35b9a31298403, 0x2d8e9a2c394a96ae, 0x44cde271b8a9137, 0x37e1ee8271306a };
+
+#else
+    #error -- "No window tables for this PRECOMP_WINDOW, generate them with precomp_gen -w"
+#endif
+#endif
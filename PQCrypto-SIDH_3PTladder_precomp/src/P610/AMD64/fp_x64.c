@@ -6,6 +6,10 @@
 
 #include "../P610_internal.h"
 #include "../../internal.h"
+#if defined(_DISPATCH_)
+    #include <cpuid.h>
+    #include <stdatomic.h>
+#endif
 
 
 // Global constants
@@ -34,6 +38,7 @@ inline void mp_sub610_p2(const digit_t* a, const digit_t* b, digit_t* c)
     mp_sub610_p2_asm(a, b, c);    
 
 #endif
+    OPCOUNT(SUB, 1);
 } 
 
 
@@ -56,6 +61,7 @@ inline void mp_sub610_p4(const digit_t* a, const digit_t* b, digit_t* c)
     mp_sub610_p4_asm(a, b, c);    
 
 #endif
+    OPCOUNT(SUB, 1);
 } 
 
 
@@ -88,6 +94,7 @@ inline void fpadd610(const digit_t* a, const digit_t* b, digit_t* c)
     fpadd610_asm(a, b, c);    
 
 #endif
+    OPCOUNT(ADD, 1);
 } 
 
 
@@ -115,6 +122,7 @@ inline void fpsub610(const digit_t* a, const digit_t* b, digit_t* c)
     fpsub610_asm(a, b, c);    
 
 #endif
+    OPCOUNT(SUB, 1);
 }
 
 
@@ -162,6 +170,184 @@ void fpcorrection610(digit_t* a)
 }
 
 
+#if defined(_DISPATCH_)
+// Runtime selection between the MULX/ADX assembly kernels and portable comba implementations.
+// The first call to mp_mul, mp_sqr or rdc_mont runs a cpuid probe and installs the fastest variant.
+// The kernels are published as one table through an atomic pointer, so threads making their first field call
+// at the same time run the same probe and never see a partially installed set of kernels.
+
+static void mul610_base(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Portable comba multiply, c = a*b
+    unsigned int i, j;
+    digit_t t = 0, u = 0, v = 0, UV[2];
+    unsigned int carry = 0;
+    
+    for (i = 0; i < 2*NWORDS_FIELD-1; i++) {
+        for (j = (i < NWORDS_FIELD) ? 0 : i-NWORDS_FIELD+1; j <= i && j < NWORDS_FIELD; j++) {
+            MUL(a[j], b[i-j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        c[i] = v;
+        v = u; 
+        u = t;
+        t = 0;
+    }
+    c[2*NWORDS_FIELD-1] = v; 
+}
+
+
+static void sqr610_base(const digit_t* a, digit_t* c)
+{ // Portable comba squaring, c = a^2
+    unsigned int i, j;
+    digit_t t = 0, u = 0, v = 0, UV[2];
+    unsigned int carry = 0;
+    
+    for (i = 0; i < 2*NWORDS_FIELD-1; i++) {
+        j = (i < NWORDS_FIELD) ? 0 : i-NWORDS_FIELD+1;
+        for (; j < i-j; j++) {
+            MUL(a[j], a[i-j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        if (j == i-j) {
+            MUL(a[j], a[j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        c[i] = v;
+        v = u; 
+        u = t;
+        t = 0;
+    }
+    c[2*NWORDS_FIELD-1] = v; 
+}
+
+
+static void rdc610_base(digit_t* ma, digit_t* mc)
+{ // Portable comba Montgomery reduction exploiting the special form of the prime p610, mc = ma*R^-1 mod p610x2
+    unsigned int i, j, carry, count = p610_ZERO_WORDS;
+    digit_t UV[2], t = 0, u = 0, v = 0;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = 0;
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        for (j = 0; j < i; j++) {
+            if (j < (i-p610_ZERO_WORDS+1)) { 
+                MUL(mc[j], ((digit_t*)p610p1)[i-j], UV+1, UV[0]);
+                ADDC(0, UV[0], v, carry, v); 
+                ADDC(carry, UV[1], u, carry, u); 
+                t += carry; 
+            }
+        }
+        ADDC(0, v, ma[i], carry, v); 
+        ADDC(carry, u, 0, carry, u); 
+        t += carry; 
+        mc[i] = v;
+        v = u;
+        u = t;
+        t = 0;
+    }    
+
+    for (i = NWORDS_FIELD; i < 2*NWORDS_FIELD-1; i++) {
+        if (count > 0) {
+            count -= 1;
+        }
+        for (j = i-NWORDS_FIELD+1; j < NWORDS_FIELD; j++) {
+            if (j < (NWORDS_FIELD-count)) { 
+                MUL(mc[j], ((digit_t*)p610p1)[i-j], UV+1, UV[0]);
+                ADDC(0, UV[0], v, carry, v); 
+                ADDC(carry, UV[1], u, carry, u); 
+                t += carry;
+            }
+        }
+        ADDC(0, v, ma[i], carry, v); 
+        ADDC(carry, u, 0, carry, u); 
+        t += carry; 
+        mc[i-NWORDS_FIELD] = v;
+        v = u;
+        u = t;
+        t = 0;
+    }
+    ADDC(0, v, ma[2*NWORDS_FIELD-1], carry, v); 
+    mc[NWORDS_FIELD-1] = v;
+}
+
+
+static void mul610_probe(const digit_t* a, const digit_t* b, digit_t* c);
+static void sqr610_probe(const digit_t* a, digit_t* c);
+static void rdc610_probe(digit_t* ma, digit_t* mc);
+
+typedef struct {
+    void (*mul)(const digit_t* a, const digit_t* b, digit_t* c);
+    void (*sqr)(const digit_t* a, digit_t* c);
+    void (*rdc)(digit_t* ma, digit_t* mc);
+} fp_kernels_t;
+
+static const fp_kernels_t fp_kernels_probe = { mul610_probe, sqr610_probe, rdc610_probe };
+static const fp_kernels_t fp_kernels_base  = { mul610_base,  sqr610_base,  rdc610_base };
+static const fp_kernels_t fp_kernels_mulx  = { mul610_asm,   sqr610_asm,   rdc610_asm };
+
+static const fp_kernels_t* _Atomic fp_impl = &fp_kernels_probe;
+#define FP_IMPL    atomic_load_explicit(&fp_impl, memory_order_acquire)
+
+
+static int cpu_supports_mulx(void)
+{ // Returns 1 if the processor supports the instructions used by the assembly kernels (BMI2, and ADX if enabled)
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7) return 0;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+#if defined(_ADX_)
+    return ((ebx >> 8) & 1) && ((ebx >> 19) & 1);
+#else
+    return (ebx >> 8) & 1;
+#endif
+}
+
+
+int fp_select_impl(int impl)
+{ // Installs the field arithmetic kernels, impl = FP_IMPL_AUTO, FP_IMPL_BASE or FP_IMPL_MULX.
+  // Requests for unsupported kernels fall back to the portable ones. Returns the installed variant.
+    if (impl != FP_IMPL_BASE && cpu_supports_mulx()) {
+        atomic_store_explicit(&fp_impl, &fp_kernels_mulx, memory_order_release);
+        return FP_IMPL_MULX;
+    }
+    atomic_store_explicit(&fp_impl, &fp_kernels_base, memory_order_release);
+    return FP_IMPL_BASE;
+}
+
+
+static void mul610_probe(const digit_t* a, const digit_t* b, digit_t* c)
+{
+    fp_select_impl(FP_IMPL_AUTO);
+    FP_IMPL->mul(a, b, c);
+}
+
+
+static void sqr610_probe(const digit_t* a, digit_t* c)
+{
+    fp_select_impl(FP_IMPL_AUTO);
+    FP_IMPL->sqr(a, c);
+}
+
+
+static void rdc610_probe(digit_t* ma, digit_t* mc)
+{
+    fp_select_impl(FP_IMPL_AUTO);
+    FP_IMPL->rdc(ma, mc);
+}
+#endif
+
+
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = nwords.
         
@@ -465,11 +651,36 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 
 #elif (OS_TARGET == OS_NIX)
     
+#if defined(_DISPATCH_)
+    FP_IMPL->mul(a, b, c);
+#else
     mul610_asm(a, b, c);
+#endif
 
 #endif
 }
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+
+#if (OS_TARGET == OS_WIN)
+
+    mp_mul(a, a, c, nwords);
+
+#elif (OS_TARGET == OS_NIX)
+    
+    UNREFERENCED_PARAMETER(nwords);
+
+#if defined(_DISPATCH_)
+    FP_IMPL->sqr(a, c);
+#else
+    sqr610_asm(a, c);
+#endif
+
+#endif
+}
+
+
 
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
@@ -720,7 +931,11 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     
 #elif (OS_TARGET == OS_NIX)                 
     
-    rdc610_asm(ma, mc);    
+#if defined(_DISPATCH_)
+    FP_IMPL->rdc(ma, mc);
+#else
+    rdc610_asm(ma, mc);
+#endif
 
 #endif
 }
\ No newline at end of file
@@ -50,6 +50,7 @@ const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x31C8AF7FFC0DE9FA, 0x8A8AD
                                                      0xECB45AD6D24FF76A, 0x850645B4F39EC5F2, 0xE6F78202586C9B3A, 0x2923209A250F7F66, 0x26FB150F, // XRA0
                                                      0x5AC7B27F9096F718, 0x487DDD2820132C83, 0x6B21AC48569E12D8, 0x57B54E5A827D1CD9, 0xDB7C4BEB143E4130,
                                                      0xB6781CA1DA245EAD, 0xCC09878A2A6D7C45, 0x980726C5232C75E5, 0x50D3A7350792C35F, 0x172B595DB }; // XRA1
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x74a381ff7e9dfbb1, 0x8abab3b37e438712, 0xf1f96e0903f158f0, 0x1a4624cce765a1cd, 0x21c7fa0b79c87353, 0x4952b72d11f238e5, 0xb044dd46ce7d9b94, 0x433094ad49aadff1, 0x526f4869c19ef71, 0xba8f87de ,
 0x9487769b67b32ef0, 0x23bc5e9af868d805, 0xcec313220093461f, 0xf10579b2e8c5d627, 0x973eb967002de0ef, 0xe87844e2e63e2879, 0x1ea0fcbdc1ea4612, 0x6e22d42a15c8ea96, 0xb5cc1ae6d9ec2990, 0x19e9506ff ,
@@ -355,6 +356,7 @@ const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x18e67601526d3134, 0x651bd6f6922254b4, 0x875b194b1558a596, 0x5ccc4ddde0e64417, 0xedadea41a0939f3, 0x1dac4dc552ad1b06, 0x3152f8058cc28f2a, 0x1f050ad8f70b6bcd, 0xcf2d86841fc44ec2, 0xf6fea733 ,
 0x29948af2e35cd377, 0xbfeb9b8fe0ebcc1a, 0x60f188bf087c1227, 0xa1b2d56f18513503, 0xcdaffd59d9f6dde5, 0x438b22f5cfd19327, 0xf76bc590cff2cd1f, 0x88a57f7134027bcd, 0x28a7bbba311a9703, 0xbf8b3d8b ,
 0x6c0e736abd23bca8, 0xabffc7bdd23fc888, 0x19692a9d4c809e3f, 0xa041cbb86d8d63ad, 0xb9d244dc2ea97ab0, 0x600250e197ef56a7, 0x39f289199fba4516, 0xc3f3adaef19bdd05, 0x367e1c63c5ee16ea, 0x8f9fc46e};
+#endif
 const uint64_t YQA4[NWORDS64_FIELD]              = { 0x67205e1b881d075, 0x894bb12afe2fbcad, 0xe7c2b8ff7c89a4a4, 0x3ccb5c538771a30e, 0x472e884966422a98,
                                                      0xce478a13952d16fe, 0x97e302edadbd26da, 0x514eeb8a7ed09cdb, 0xce48cda905f9fb56, 0xe0bfa119 };
 const uint64_t DBL_QA[2 * NWORDS64_FIELD]        = { 0x2c9e52fa31b9b76, 0xef4088ad3e54c6dd, 0xc18e7055d2cff348, 0x24b3268c87d5f690, 0xdd80d94ade7b0a93,
@@ -385,6 +387,7 @@ const uint64_t B_gen[6 * NWORDS64_FIELD]      = { 0xD4A2CF040BC56F2C, 0x58F1D1D2
                                                   0x4F62205A5DAFB369, 0xA2B75D5BC06C691F, 0x6B82C9B893D51C38, 0x2C2467D7AB7DAA2C, 0x8A8D5AC13C2C5ADD,
                                                   0xBC3AEC544F8953F5, 0xBC43C1BE1B1DC069, 0xB8CDA0908AEBCD84, 0xA213356DB0FBFCFF, 0x15F063030, // XRB0
                                                   0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }; // XRB1
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0x203596CF0245B227, 0xFE7D4CB978F11517, 0xEC79574E9D7DD13A, 0xD24627B69D4DFF63, 0x85B4D3B2B5426BBF,0xFF0237C357683FCA, 0x2C3E0FE7792534B1, 0x8B68DB1AFC3F9CDE, 0x5AFD2B5021786921, 0x16CFF1918,
 0xDFE1CAFF47350FFB, 0x7F6641B5806DBD07, 0xD558CE2B43292C47, 0x28EB4A4147C77BD6, 0x143218EB29F5FB6C,0x5F457BD167A2260F, 0x26D9639E9DD4A15D, 0xEC9DFA3764433777, 0x9D8C59E2D257CACF, 0x1D2D65779,
@@ -697,6 +700,7 @@ const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0x35062cb3aeaadf83, 0x25e91540e3ce12fc, 0x866cc189686c689c, 0x7dbbbdc4f77222c2, 0xe1cc4250f6fad3f1, 0x72606ae73e17993f, 0xaae5a55a99730264, 0x9278a16cf9a22f7b, 0xb5af6d3835f43390, 0x16486cfd2 ,
 0x5e67e77ffab6dc26, 0xcca60a6f0e111fd6, 0x1eca17ff21fdf74d, 0xa51437b8d580f6bd, 0x4245311b3692dac5, 0x7a099ac25364c48b, 0x47f5ca83958a5678, 0xf857ad126857b29d, 0xa8c3ced0f0e069cc, 0x7387fee6 ,
 };
+#endif
 
 // Montgomery constant Montgomery_R2 = (2^640)^2 mod p610
 const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0xE75F5D201A197727, 0xE0B85963B627392E, 0x6BC1707818DE493D, 0xDC7F419940D1A0C5, 0x7358030979EDE54A,
@@ -706,6 +710,35 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000670CC8E6, 0x00000
                                                      0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2, 0x1369026E862CAF3D, 0x000000010894E964 };
 
 
+#if defined(LANES_AVX512IFMA)
+// Constants of the lane-parallel arithmetic (fpx_x8.c) in limbs of 52 bits: p610, 2*p610, 4*p610, p610 + 1, and p610*2^51, which is
+// added from limb NWORDS52_FIELD-1 of the products to keep them positive
+const uint64_t p610_r52[NWORDS52_FIELD]            = { 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0x01FFFFFFFFFFF, 0xDE8AA5AB02E6E, 0x048FF9ABB1784,
+                                                       0x4252A9AE7BF45, 0x8CB255B2FA10C, 0x19010C251E7D8, 0x00027BF6A7688 };
+const uint64_t p610x2_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFE, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0x03FFFFFFFFFFF, 0xBD154B5605CDC, 0x091FF35762F09,
+                                                       0x84A5535CF7E8A, 0x1964AB65F4218, 0x3202184A3CFB1, 0x0004F7ED4ED10 };
+const uint64_t p610x4_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFC, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0x07FFFFFFFFFFF, 0x7A2A96AC0B9B8, 0x123FE6AEC5E13,
+                                                       0x094AA6B9EFD14, 0x32C956CBE8431, 0x6404309479F62, 0x0009EFDA9DA20 };
+const uint64_t p610p1_r52[NWORDS52_FIELD]          = { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x0000000000000, 0x0200000000000, 0xDE8AA5AB02E6E, 0x048FF9ABB1784,
+                                                       0x4252A9AE7BF45, 0x8CB255B2FA10C, 0x19010C251E7D8, 0x00027BF6A7688 };
+const uint64_t p610x2e51_r52[NWORDS52_FIELD+1]     = { 0x8000000000000, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0x00FFFFFFFFFFF, 0x6F4552D581737,
+                                                       0x8247FCD5D8BC2, 0x212954D73DFA2, 0x46592AD97D086, 0x0C8086128F3EC,
+                                                       0x00013DFB53B44 };
+// Montgomery constants of the lane-parallel arithmetic: Montgomery_R2_r52 = (2^624)^2 mod p610 and Montgomery_one_r52 = 2^624 mod p610
+const uint64_t Montgomery_R2_r52[NWORDS52_FIELD]   = { 0x7392EE75F5D20, 0x3DE0B85963B62, 0xBC1707818DE49, 0x419940D1A0C56,
+                                                       0x979EDE54ADC7F, 0x42B8C423A6030, 0x097B7859D1FF6, 0x8237F07B840AE,
+                                                       0xB5F36D80DA241, 0x5F0143247BA71, 0xEEB6DDE842202, 0x000040D650180 };
+const uint64_t Montgomery_one_r52[NWORDS52_FIELD]  = { 0x000000000670C, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x0000000000000, 0xE800000000000, 0xC8D86DD0F9009, 0xDBCC378C4703B,
+                                                       0xA1DAD7F2E43ED, 0xA728F8FF884BD, 0x68107EFE1013D, 0x0001F3151AF8F };
+#endif
+
+
 // Fixed parameters for isogeny tree computation
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 67, 37, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
@@ -725,6 +758,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
 1, 1 };
 
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(pre_for_Alice,        (OALICE_BITS - 1) * NWORDS64_FIELD)                 \
+    X(pre_for_Bob,          (OBOB_BITS + 5) * NWORDS64_FIELD)                   \
+    WINDOW_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy610
 #define fpzero                        fpzero610
@@ -749,24 +788,65 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2div2                       fp2div2_610
 #define fp2correction                 fp2correction610
 #define fp2mul_mont                   fp2mul610_mont
+#define fp2mul_add_mont               fp2mul_add610_mont
+#define fp2mulsub_mont                fp2mulsub610_mont
 #define fp2sqr_mont                   fp2sqr610_mont
 #define fp2inv_mont                   fp2inv610_mont
 #define fp2inv_mont_bingcd            fp2inv610_mont_bingcd
 #define fpequal_non_constant_time     fpequal610_non_constant_time
 #define mp_add_asm                    mp_add610_asm
+#define mp_addx2_asm                  mp_add610x2_asm
 #define mp_subaddx2_asm               mp_subadd610x2_asm
 #define mp_dblsubx2_asm               mp_dblsub610x2_asm
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610
+#define crypto_kem_keypair_x8         crypto_kem_keypair_x8_SIKEp610
+#define crypto_kem_enc_x8             crypto_kem_enc_x8_SIKEp610
+#define crypto_kem_dec_x8             crypto_kem_dec_x8_SIKEp610
+#define crypto_kem_enc_concurrent     crypto_kem_enc_concurrent_SIKEp610
 #define random_mod_order_A            random_mod_order_A_SIDHp610
 #define random_mod_order_B            random_mod_order_B_SIDHp610
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp610
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp610
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp610
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp610
+#define tables_load                   tables_load_p610
+#define tables_unload                 tables_unload_p610
+#define sidh_set_ladder               sidh_set_ladder_p610
+#define sidh_get_ladder               sidh_get_ladder_p610
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp610
+#define EphemeralKeyGeneration_B_ladder EphemeralKeyGeneration_B_ladder_SIDHp610
+#define EphemeralKeyGenerationAgreement_A EphemeralKeyGenerationAgreement_A_SIDHp610
+#define crypto_kem_keypair_ladder     crypto_kem_keypair_ladder_SIKEp610
+#define crypto_kem_enc_ladder         crypto_kem_enc_ladder_SIKEp610
+#define crypto_kem_dec_ladder         crypto_kem_dec_ladder_SIKEp610
+#define sidh_opcount                  sidh_opcount_p610
+#define keypool_start                 keypool_start_p610
+#define keypool_stop                  keypool_stop_p610
+#define keypool_stats                 keypool_stats_p610
+#define sidh_workers_stop             sidh_workers_stop_p610
+#define crypto_kem_keypair_pooled     crypto_kem_keypair_pooled_SIKEp610
+#define EphemeralKeyPair_A_pooled     EphemeralKeyPair_A_pooled_SIDHp610
+#define EphemeralKeyPair_B_pooled     EphemeralKeyPair_B_pooled_SIDHp610
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#else
+    #include "P610_window_tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
+#include "../isogeny_mt.c"
 #include "../sidh.c"
-#include "../sike.c"
\ No newline at end of file
+#if defined(LANES_AVX512IFMA)
+    #include "../fpx_x8.c"
+    #include "../ec_isogeny_x8.c"
+    #include "../sidh_x8.c"
+#endif
+#include "../fpx_x2.c"
+#include "../ec_isogeny_x2.c"
+#include "../sidh_x2.c"
+#include "../sike.c"
+#include "../keypool.c"
\ No newline at end of file
@@ -795,28 +795,6 @@ const unsigned int strat_Bob[MAX_Bob-1] = { 86, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1,
 
 
 
-// Fixed traversal strategies for Pohlig-Hellman discrete logs
-const unsigned int ph2_path[PLEN_2] = {
-#ifdef COMPRESSED_TABLES
-    #ifdef ELL2_TORUS
-        #if (W_2 == 5)
-          0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 13, 13, 14, 14, 15, 16, 17, 18, 18, 18, 19, 20, 20, 21, 22, 23, 24, 25, 25, 25, 25, 26, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 35, 35, 35, 35, 36, 37, 38, 39, 40, 41, 41, 42
-        #endif
-    #endif        
-#endif
-};
-
-const unsigned int ph3_path[PLEN_3] = {
-#ifdef COMPRESSED_TABLES
-    #ifdef ELL3_FULL_SIGNED
-      #if (W_3 == 3)
-        0, 0, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 13, 13, 13, 13, 14, 15, 16, 17, 18, 19, 19, 19, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 28, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 41, 41, 41, 41
-      #endif
-    #endif
-#endif
-};
-
-
 // Entangled bases related static tables and parameters
 
 // Constants u and u0 where u = u0^2 in F_{p^2} \ F_p used in entagled basis generation
@@ -967,6 +945,26 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 {0x3E77A9B726C4E35A,0x72508865383E24E9,0x703A850A1795B24B,0xB744F39B78F82E6,0xBCA3D4CB44C8DE88,0x98BB9A1523EDC1A1,0x1055B9EF0ED241A1,0xDF619C4A7A3305B,0xD3CAD19AFBE71CE8,0x8A810A03,0x78553A5AD2AFD1FC,0x87C486E5D053F7C5,0xD49A2C8D3988259,0xD059B9BB567D1CB1,0x5D10F35FBB64BF63,0xB6A58DE0F78BF9DD,0xCD0DEBAFEA4B0478,0xDAF46A0964D3FD0A,0x8E33C74FE2F70AFC,0x21CAAD2F8},
 {0x3BABE989C4B7C8C6,0x2BF8F447EF3BDD7D,0x20EAAD8C5457CF18,0x8C176F27BA3E5B6D,0x6994DF1010BAB10B,0xC508E30E46C0CA1E,0xA48AA3C16405257B,0xFDA00D371BEC4681,0x9D86B52EDF6EC9F8,0x1C34BB8B6,0xADB4F379816C780A,0xC25F504173CEACF5,0x1DA0375FEB0BBE8C,0xB87264B37860585,0xE0E1B8080C0215AB,0xA4E2CD906374B7FC,0x5326260B7A3021ED,0x168C806A9FD020B4,0xDD2E356F2066C037,0x110BD582B}};
 
+// The ell=3 Pohlig-Hellman tables depend on whether W_3 divides eB
+#if (OBOB_EXPON % W_3 == 0)
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T,                DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#else
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T1,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)        \
+    X(ph3_T2,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#endif
+
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(T_tate3,              (6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD)        \
+    X(T_tate2_firststep_P,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_P,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(T_tate2_firststep_Q,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_Q,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(ph2_CT,               DLEN_2 * (ELL2_W >> 1) * NWORDS64_FIELD)            \
+    PH3_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy610
 #define fpzero                        fpzero610
@@ -991,11 +989,14 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2div2                       fp2div2_610
 #define fp2correction                 fp2correction610
 #define fp2mul_mont                   fp2mul610_mont
+#define fp2mul_add_mont               fp2mul_add610_mont
+#define fp2mulsub_mont                fp2mulsub610_mont
 #define fp2sqr_mont                   fp2sqr610_mont
 #define fp2inv_mont                   fp2inv610_mont
 #define fp2inv_mont_bingcd            fp2inv610_mont_bingcd
 #define fpequal_non_constant_time     fpequal610_non_constant_time
 #define mp_add_asm                    mp_add610_asm
+#define mp_addx2_asm                  mp_add610x2_asm
 #define mp_subaddx2_asm               mp_subadd610x2_asm
 #define mp_dblsubx2_asm               mp_dblsub610x2_asm
 #define random_mod_order_A            random_mod_order_A_SIDHp610
@@ -1007,12 +1008,30 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610_compressed
+#define tables_load                   tables_load_p610_compressed
+#define tables_unload                 tables_unload_p610_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp610_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp610_Compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp610_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp610_compressed
+#define sidh_workspace_size           sidh_workspace_size_p610_compressed
+#define sidh_set_checkpoint           sidh_set_checkpoint_p610_compressed
+#define sidh_get_checkpoint           sidh_get_checkpoint_p610_compressed
+#define sidh_set_dlog_threads         sidh_set_dlog_threads_p610_compressed
+#define sidh_get_dlog_threads         sidh_get_dlog_threads_p610_compressed
+#define sidh_workers_stop             sidh_workers_stop_p610_compressed
 
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
 #include "../compression/torsion_basis.c"
-#include "P610_compressed_pair_tables.c"
+#if !defined(TABLE_BUNDLE)
+    #include "P610_compressed_pair_tables.c"
+#endif
 #include "../compression/pairing.c"
 #include "P610_compressed_dlog_tables.c"
 #include "../compression/dlog.c"
@@ -67,7 +67,8 @@ void random_mod_order_A_SIDHp610(unsigned char* random_digits);
 
 // Generation of Bob's secret key 
 // Outputs random value in [0, 2^Floor(Log(2,3^192)) - 1] to be used as Bob's private key
-void random_mod_order_B_SIDHp610(unsigned char* random_digits);
+// Returns 0, or -1 if the random bytes could not be obtained
+int random_mod_order_B_SIDHp610(unsigned char* random_digits);
 
 // Alice's ephemeral public key generation
 // Input:  a private key PrivateKeyA in the range [0, 2^305 - 1], stored in 39 bytes. 
@@ -106,4 +107,85 @@ int EphemeralSecretAgreement_B_SIDHp610_Compressed(const unsigned char* PrivateK
 // Shared keys SharedSecretA and SharedSecretB consist of one element in GF(p610^2). In the SIDH API, they are encoded in 154 octets.
 
 
+// Workspaces
+// The key generations keep the curves or the dual isogeny kernels of the whole isogeny path, which take most of their stack. 
+// The _ws functions below keep them in a caller-provided workspace instead, so that they run on a stack of a few KB. The workspace 
+// must be aligned to WORKSPACE_ALIGN bytes, hold at least sidh_workspace_size_p610_compressed(op) bytes and not be shared between 
+// concurrent calls. The other functions of the library need no workspace. The _ws functions take the size of the workspace in bytes 
+// and return -1 if workspace is NULL or misaligned, or if size is too small for the checkpoint interval they read when called.
+
+#define WORKSPACE_ALIGN          64
+#define WORKSPACE_KEYGEN_A        0      // EphemeralKeyGeneration_A_ws_SIDHp610_Compressed()
+#define WORKSPACE_KEYGEN_B        1      // EphemeralKeyGeneration_B_ws_SIDHp610_Compressed()
+#define WORKSPACE_KEM_KEYPAIR     2      // crypto_kem_keypair_ws_SIKEp610_compressed()
+#define WORKSPACE_KEM_ENC         3      // crypto_kem_enc_ws_SIKEp610_compressed()
+
+// Returns the bytes of the workspace of op, or 0 if op is not one of the values above
+unsigned int sidh_workspace_size_p610_compressed(unsigned int op);
+
+// Same inputs and outputs as EphemeralKeyGeneration_A/B_SIDHp610_Compressed(), crypto_kem_keypair_SIKEp610_compressed() and crypto_kem_enc_SIKEp610_compressed()
+int EphemeralKeyGeneration_A_ws_SIDHp610_Compressed(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, void* workspace, unsigned int size);
+int EphemeralKeyGeneration_B_ws_SIDHp610_Compressed(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, void* workspace, unsigned int size);
+int crypto_kem_keypair_ws_SIKEp610_compressed(unsigned char *pk, unsigned char *sk, void* workspace, unsigned int size);
+int crypto_kem_enc_ws_SIKEp610_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void* workspace, unsigned int size);
+
+
+// Checkpoints
+// By default, Alice's key generation keeps all the curves of her isogeny path, which the torsion basis generation walks back 
+// several times. With a checkpoint interval k >= 2, it keeps one curve and kernel every k steps and recomputes the k steps in 
+// between on each walk: the path takes about 152/k + k rows instead of 152, for a slower key generation. The 
+// default interval is set at build time with DUAL_CHECKPOINT=k, which also sizes the stack of the functions without workspace: 
+// they use the interval set below only if its path fits in that stack, and DUAL_CHECKPOINT otherwise. The interval applies to 
+// EphemeralKeyGeneration_A(_ws)_SIDHp610_Compressed() and crypto_kem_keypair(_ws)_SIKEp610_compressed(), whose outputs do not 
+// depend on it, and to the size of their workspaces. A workspace sized for another interval may be rejected by the _ws 
+// functions; changing it while one of them runs does not affect that call.
+
+#define CHECKPOINT_NONE           0      // Keep the whole isogeny path
+
+// Sets the checkpoint interval, CHECKPOINT_NONE or k >= 2
+// Returns 0 on success, or -1 if k = 1 or k is larger than the number of 4-isogenies of the path
+int sidh_set_checkpoint_p610_compressed(unsigned int k);
+
+// Returns the checkpoint interval
+unsigned int sidh_get_checkpoint_p610_compressed(void);
+
+
+// Discrete logs
+// The compressed key generations solve four independent discrete logs in the groups of the pairing values. With _PARALLEL_, 
+// they are spread over the calling thread and up to DLOG_THREADS_MAX-1 threads of a worker pool started on first use: each thread 
+// takes the next log left until none remains. A key generation that finds no idle worker solves its logs alone. The public keys 
+// do not depend on the number of threads, and without _PARALLEL_ the logs are always solved one after the other.
+
+#define DLOG_THREADS_AUTO         0      // One thread per online processor, up to DLOG_THREADS_MAX
+#define DLOG_THREADS_MAX          4
+
+// Sets the number of threads solving the discrete logs, including the calling thread, or DLOG_THREADS_AUTO (default)
+// Returns 0 on success, or -1 if n is larger than DLOG_THREADS_MAX
+int sidh_set_dlog_threads_p610_compressed(unsigned int n);
+
+// Returns the number of threads solving the discrete logs
+unsigned int sidh_get_dlog_threads_p610_compressed(void);
+
+// Joins the threads of the worker pool, the next key generation starts them again. Returns 0, or -1 without joining them if 
+// one of them is still running a job of another thread.
+int sidh_workers_stop_p610_compressed(void);
+
+
+#if defined(TABLE_BUNDLE)
+// Table bundle
+// With TABLE_BUNDLE, the large precomputed tables are not compiled into the library but read from a bundle file generated by 
+// "tables_bundle-p610_compressed" (see tables.h). tables_load_p610_compressed() must succeed before any other function of the library is called.
+
+#define TABLES_HUGEPAGES          1      // Put the tables in huge pages
+#define TABLES_PREFAULT           2      // Map all the pages of the tables at load time
+
+// Maps the bundle file at path read-only and points the tables at it
+// Returns 0 on success, or -1 if the file cannot be mapped or was not generated for this library
+int tables_load_p610_compressed(const char* path, unsigned int flags);
+
+// Unmaps the bundle
+void tables_unload_p610_compressed(void);
+#endif
+
+
 #endif
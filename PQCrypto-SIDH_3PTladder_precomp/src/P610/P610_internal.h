@@ -49,6 +49,27 @@
 #define SECRETKEY_B_BYTES       ((OBOB_BITS - 1 + 7) / 8)
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
 
+// Lane-parallel arithmetic of the multi-buffer SIKE functions (fpx_x8.c), in limbs of 52 bits
+#define NWORDS52_FIELD          12                                  // Number of 52-bit limbs of a 610-bit field element
+#define ZERO_LIMBS52_FIELD      5                                   // Number of "0" limbs in the least significant part of p610 + 1
+#define PRIME_R52               p610_r52
+#define PRIMEx2_R52             p610x2_r52
+#define PRIMEx4_R52             p610x4_r52
+#define PRIMEp1_R52             p610p1_r52
+#define PRIMEx2e51_R52          p610x2e51_r52
+
+#if defined(PRECOMP_WINDOW)
+// Windowed fixed-base key generation: windows of PRECOMP_WINDOW bits over the 3-point ladder scalars and points per window
+#define WINDOW_LEN_ALICE        ((OALICE_BITS - 3 + PRECOMP_WINDOW - 1) / PRECOMP_WINDOW)
+#define WINDOW_LEN_BOB          ((OBOB_BITS - 1 + PRECOMP_WINDOW - 1) / PRECOMP_WINDOW)
+#define WINDOW_POINTS           ((1 << PRECOMP_WINDOW) - 1)
+#define WINDOW_TABLE_LIST(X)                                                    \
+    X(window_for_Alice,     (1 + WINDOW_LEN_ALICE * WINDOW_POINTS) * 2 * NWORDS64_FIELD) \
+    X(window_for_Bob,       (1 + WINDOW_LEN_BOB * WINDOW_POINTS) * 2 * NWORDS64_FIELD)
+#else
+#define WINDOW_TABLE_LIST(X)
+#endif
+
 #ifdef COMPRESS
     #define MASK2_BOB               0x07
     #define MASK3_BOB               0xFF
@@ -62,15 +83,31 @@
     #define TABLE_V_LEN 34
     #define TABLE_V3_LEN 20
     // Parameters for discrete log computations
-    // Binary Pohlig-Hellman reduced to smaller logs of order ell^W
-    #define W_2 5
-    #define W_3 3
-    // ell^w    
-    #define ELL2_W (1 << W_2)    
-    #define ELL3_W 27
-    // ell^(e mod w) 
-    #define ELL2_EMODW (1 << (OALICE_BITS % W_2))    
-    #define ELL3_EMODW 1
+    // Binary Pohlig-Hellman reduced to smaller logs of order ell^W, the windows can be chosen at build time with
+    // PH_WINDOW_2_P610 and PH_WINDOW_3_P610 once the matching tables are generated with dlog_gen -w (see tests/dlog_gen.c)
+    #if defined(PH_WINDOW_2_P610)
+        #define W_2 PH_WINDOW_2_P610
+    #else
+        #define W_2 5
+    #endif
+    #if defined(PH_WINDOW_3_P610)
+        #define W_3 PH_WINDOW_3_P610
+    #else
+        #define W_3 3
+    #endif
+    #if (W_2 < 4) || (OALICE_BITS % W_2 != 0)
+        #error -- "PH_WINDOW_2_P610 must be at least 4 and divide 305"
+    #endif
+    #if (W_3 < 1) || (W_3 > 6)
+        #error -- "PH_WINDOW_3_P610 must be between 1 and 6"
+    #endif
+    #define POW3(e) ((e) == 0 ? 1 : (e) == 1 ? 3 : (e) == 2 ? 9 : (e) == 3 ? 27 : (e) == 4 ? 81 : (e) == 5 ? 243 : 729)
+    // ell^w
+    #define ELL2_W (1 << W_2)
+    #define ELL3_W POW3(W_3)
+    // ell^(e mod w)
+    #define ELL2_EMODW (1 << (OALICE_BITS % W_2))
+    #define ELL3_EMODW POW3(OBOB_EXPON % W_3)
     // # of digits in the discrete log    
     #define DLEN_2 ((OALICE_BITS+W_2-1)/W_2)  // ceil(eA/W_2)
     #define DLEN_3 ((OBOB_EXPON+W_3-1)/W_3)   // ceil(eB/W_3)
@@ -80,17 +117,12 @@
     #define ELL3_FULL_SIGNED    // Uses signed digits to reduce table size by half
     // Length of the optimal strategy path for Pohlig-Hellman
     #ifdef COMPRESSED_TABLES
-        #if W_2 == 5
-            #define PLEN_2 62
-        #endif
+        #define PLEN_2 (DLEN_2 + 1)
         #ifdef ELL2_TORUS
-            #define W_2_1 4
+            #define W_2_1 (W_2 - 1)
         #endif
-
         #ifdef ELL3_FULL_SIGNED
-            #if W_3 == 3
-                #define PLEN_3 65
-            #endif
+            #define PLEN_3 (DLEN_3 + 1)
         #endif
     #endif
 #endif
@@ -123,6 +155,9 @@ typedef point_full_proj point_full_proj_t[1];
 void mp_add610(const digit_t* a, const digit_t* b, digit_t* c);
 void mp_add610_asm(const digit_t* a, const digit_t* b, digit_t* c);
 
+// 2x610-bit multiprecision addition, c = a+b
+void mp_add610x2_asm(const digit_t* a, const digit_t* b, digit_t* c);
+
 // 610-bit multiprecision subtraction, c = a-b+2p or c = a-b+4p
 extern void mp_sub610_p2(const digit_t* a, const digit_t* b, digit_t* c);
 extern void mp_sub610_p4(const digit_t* a, const digit_t* b, digit_t* c);
@@ -170,6 +205,9 @@ void rdc610_asm(digit_t* ma, digit_t* mc);
 // Field multiplication using Montgomery arithmetic, c = a*b*R^-1 mod p610, where R=2^640
 void fpmul610_mont(const digit_t* a, const digit_t* b, digit_t* c);
 void mul610_asm(const digit_t* a, const digit_t* b, digit_t* c);
+
+// 610-bit multiprecision squaring, c = a^2
+void sqr610_asm(const digit_t* a, digit_t* c);
    
 // Field squaring using Montgomery arithmetic, c = a*b*R^-1 mod p610, where R=2^640
 void fpsqr610_mont(const digit_t* ma, digit_t* mc);
@@ -212,6 +250,12 @@ void fp2sqr610_mont(const f2elm_t a, f2elm_t c);
 // GF(p610^2) multiplication using Montgomery arithmetic, c = a*b in GF(p610^2)
 void fp2mul610_mont(const f2elm_t a, const f2elm_t b, f2elm_t c);
 
+// GF(p610^2) sum of products using Montgomery arithmetic with a single reduction, e = a*b+c*d in GF(p610^2)
+void fp2mul_add610_mont(const f2elm_t a, const f2elm_t b, const f2elm_t c, const f2elm_t d, f2elm_t e);
+
+// GF(p610^2) difference of products using Montgomery arithmetic with a single reduction, e = a*b-c*d in GF(p610^2)
+void fp2mulsub610_mont(const f2elm_t a, const f2elm_t b, const f2elm_t c, const f2elm_t d, f2elm_t e);
+
 // GF(p610^2) inversion using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2)
 void fp2inv610_mont(f2elm_t a);
 
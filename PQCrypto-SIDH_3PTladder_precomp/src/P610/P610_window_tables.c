@@ -0,0 +1,4582 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the windowed fixed-base key generation of SIDHp610
+*           Generated by precomp_gen -w 4, see tests/precomp_gen.c for their contents
+*********************************************************************************************/
+
+#if defined(PRECOMP_WINDOW)
+#if (PRECOMP_WINDOW == 4)
+
+const uint64_t window_for_Alice[(1 + WINDOW_LEN_ALICE * WINDOW_POINTS) * 2 * NWORDS64_FIELD] = {
+0x74a382004cb78d7e, 0x8abab3b37e438712, 0xf1f96e0903f158f0, 0x1a4624cce765a1cd, 0xe82dfa0b79c87353, 0x330deebeb87a7d35, 0x29f14e7510354a21, 0x364725ded9bc5e8b, 0xaa68e8a1568b7560, 0x4fc2b33d,
+0x1e77e12d82c17e73, 0x263c5dad0c3d5e29, 0x19d097e79d4860a0, 0x906dad8be169c7b0, 0xa22e115c82eb4eea, 0x988599c7f4c6da94, 0x465e4d5b3b1c91a1, 0x457df68335cc6c9f, 0xd60803377c8c36bf, 0x23f3e38d0,
+0x2c9e53071352d43, 0xef4088ad3e54c6dd, 0xc18e7055d2cff348, 0x24b3268c87d5f690, 0xa3e6d94ade7b0a93, 0x489bad43902f0b0e, 0xa1a300a465cbb34a, 0x1e3d0279d17c14c0, 0xcc6901ca8b4eb6ee, 0x6deb13a0,
+0xb84b1e242a63879e, 0xd3a74c3d2770fa06, 0x49df32c277de73a3, 0xca452cb04eba1741, 0xe36ec74b21763cf, 0xee808c414124f7b3, 0xcdbc7c4c7fa2f565, 0x6ec6a04436a3b6dd, 0x655153fcac56e490, 0x1c8ae36cc,
+0xd8a293b6cf2bb40, 0xe1b641c07ddead64, 0x752811982a639080, 0x5ef082eef14391c0, 0x4e69530b77f63838, 0xe5342eef727f6792, 0xf833326993e90187, 0xacca058e8710d072, 0x55f4b4f98df5d0c5, 0x24dbf832,
+0xad40559d73a22753, 0x4fea70030f3d7c30, 0x9d351d611c377861, 0xbeddeec5b19ef48d, 0xeb85498b19f2bb0b, 0x81699d09b184fe3b, 0x5192c626b954608f, 0xbe03d730e9eafd39, 0xb1cb16413a4315a2, 0x16254f779,
+0xf5d1c7e642e6af6f, 0x63c6e24ead29ef4d, 0x83b1bd51106cb0e8, 0x562575166bab199b, 0xa3562422cdf511b4, 0x56547dfb6e76ffc2, 0xa60298f9a62fcfaa, 0xad1161a0e5012138, 0x380728c6e3c3284d, 0x15dc3ee31,
+0x1fa0633098c04fb1, 0xd643652e85bb94ff, 0xc395c277486483ea, 0x48c80e115cae8591, 0xdc5f5e9675f9dabb, 0x19552e2e405bc469, 0xe1ba01c1ae0e245d, 0x5c59deabdd033b06, 0xe3a5ab41eaf9ff8b, 0x512ebeda,
+0x535c6e813e9d518a, 0xad64453323044a7, 0xb68696f72cafb024, 0x67acf707bbc8b400, 0x4deb973e18a70792, 0x64c75184c18b7735, 0xc143a2c5b37680b4, 0x37002c2db2585ae6, 0x7137052c44ed8446, 0x50623905,
+0x25af94fa7f46084b, 0xfa16e40c4015beb4, 0x30b5f128bd2d717d, 0x3001a48f6c04aba9, 0x1ebac5083c31dc97, 0x3e2216f817dfd05b, 0x34d63d8988b80fac, 0x53d6dbbf58318c8c, 0xee135c318b0b4fbd, 0x61be9479,
+0x1357a2ba625f143c, 0x7edeb45d4be6b114, 0x7347c96dcf639c41, 0x3d7fb16a92ebbf8c, 0x2b487fff0b9dd2d0, 0xcd0c378bd33f9d59, 0x42e0455c3c83967c, 0x7b7f8b096a1400dc, 0xf5eb74c3410fcb11, 0x228fbcf9e,
+0x1eeb5717e281b9d6, 0xd1fab10082d07329, 0xb4dfbcc48066dfb8, 0xf4fe4db262af989, 0x9ec9a302e49679be, 0x4c6ed1eed50b62e1, 0x7acd926a6ece35e0, 0xe0cdd189aa2568f5, 0x69a6e37ed1b0d795, 0x248d05215,
+0x332cd658730186aa, 0x179192d1d15bece8, 0x65df8fad0cd324c, 0xd09c2ad71492fa5, 0xad434b1265ec6cb2, 0xe76fae11c62cea20, 0x74cb8ebf84bf7c9, 0xd6470002b4f541b6, 0x712b399d507d1e8a, 0x265209e00,
+0x34d2365ba4c3536b, 0x752d727116f093d7, 0x83bf41ec34a9342a, 0x9c9eb54077174ac5, 0xc3f738e1a6c8db2c, 0x210e5b4fc3f7f5de, 0x748352cbfafe3efc, 0xd70fb80c9940acc6, 0x6cd91b620ffb1b41, 0x6791de13,
+0x5d23461bc89ba66a, 0x93228f73f59f81a6, 0x6791a6d4ff13a4a5, 0x3d9b07dd3049c922, 0x3b56a6ec2848cae8, 0xb263ea0762889d6c, 0x5fb42400b24b7050, 0x62b1ee0c25568e75, 0x5127f71d86d176e1, 0x2e2e3b06,
+0x90c8349e1f7dc678, 0x657f866666f1625b, 0x2ba25966b1f41926, 0x1580f40c5e52c0fa, 0x58264749385478e0, 0x38af3d94c1a51269, 0x692d148e95fa97b6, 0x6c7798646ae3c580, 0xa2d40bfdbe5cb9ba, 0x1a16520d7,
+0xb7306fe6c6c844ad, 0xcadfdf1d57932310, 0x4fb22989a00760ad, 0x4de5d4cce59dbc2f, 0x9aa0897142b34383, 0x7dd86fc4567e949d, 0x9260f5e77bf68c2b, 0x7a3e0578161b1f91, 0xdd7175e107f0e9de, 0x2313d9822,
+0xb209045d4051d0ec, 0x27a160d0e5fc64bf, 0xcd99808eb0e7cd46, 0xf89ecda143f74d6c, 0x416622bf3824146f, 0xfa7fb456ae512fb6, 0xb0e4f93cc69d314b, 0x97729dc4a7f13d8b, 0x5c2d47d495feb5ef, 0x1079a6b9a,
+0x8d41151814947ed, 0x8aa681e34db3a76d, 0x1e9daed0a45f2694, 0x94742bd62bb13229, 0xfee5442e5deb510b, 0xbf48f797ffc7a05, 0xeaf4281927aeb526, 0x2d920268e007328c, 0x9d86b350daa52194, 0xca820b20,
+0x6b462be752b73bf1, 0xdbba52a00419d7be, 0x37d1bf2d0524a7e0, 0xb96cf1c2aec5db87, 0x6071a81245e5943a, 0x10923b42d5ff00a0, 0xa37d7c01ce249c0e, 0xd1681d7f6113790, 0xbc2eb042af75f731, 0x24028c20f,
+0xb48f05c1d25b9675, 0x7ee43b447ec030be, 0x408ac07ea57e23a9, 0x3b14f46129c1ac1e, 0x1b9ce7f93d0b906d, 0x69ae696cc516f2ad, 0xbba7e17f9aaedaab, 0x6a9f7307eb458467, 0x69c88e9087f5da42, 0x10d7f0828,
+0x6bcaa1f0a5d86628, 0xf54e63b6944add34, 0x31e7f6b13fb9d4fd, 0x18e99d9782f76006, 0xdb5d05684635b204, 0x733752503c9baeb1, 0x9e24f80176912abd, 0xc68beb262f18f08e, 0x83b426cea1cfd0a8, 0xa0a6ffa1,
+0x512db18aedaca9e7, 0x455ba226493337fd, 0x3e149281731f816e, 0x794608ecaf467ce2, 0x18e87113e3bf925, 0x810eb9f4fac0fedf, 0x95d424b69a2d085f, 0xebd2b6b2bc597aa1, 0x8bfde23159119727, 0x2599dd96d,
+0x51883cb379ade8f8, 0x7b2368f13e161979, 0x69f2a0f3b3b89d94, 0x2e7c3bb0f175f12e, 0x986ab1db96a21688, 0x52f6df458e63c6da, 0x8df184e59f590226, 0xc93056793ab4c9c1, 0x6c1319bddf5cd55, 0xf13cf29b,
+0xffad8aac1cbc8a7, 0xd1b65d134b28b02c, 0x84d3802187204675, 0xc2d9c224eff91c25, 0xdeec7640990c59a, 0x4fb2d7901ee6cc26, 0xba01a05da66697bd, 0x36e68e5fcb291ab8, 0xfdd9dd7c49e43708, 0x236f260c9,
+0x167fd56d651a89f, 0x7dfe925f431e6eec, 0x123a6790aaf5291b, 0xaf8e1e2de3861e62, 0x8b970e21eb751135, 0xd72eaaab88649706, 0x75af8c5943b4b593, 0x1edea3303d308e5f, 0x6fcff349dc25399e, 0x24fac216a,
+0xe8e4555d96119a31, 0x30180fc9f03f9f94, 0x27b8f3915cd5a84c, 0x838db2f279f028f1, 0x603608fbdc83e404, 0x3ca2b63d5c5527c5, 0x2607c6f6379e7f4a, 0xfe83b771544e6a9f, 0xe5d4402cd5d26ae7, 0x1c680338b,
+0x839f0d4e05803b0b, 0x8e1c340c9ed909c7, 0xfaa06d6a054e7463, 0x6fed8b595557ae71, 0xda23fff287bae6f0, 0xf619b43fede3ff3f, 0xb48da234867f9af2, 0x9f910b2f51e6491f, 0x2a5533277d53a045, 0x3ffb1d64,
+0x7364d3684ba9c43d, 0x4681006ea8584655, 0xd4d5b7e8e79e2f2e, 0xa17631165a50e19b, 0xe8f3a91e3deea012, 0x770577d5bde5e23d, 0x5371d3888270b023, 0xff263c8c04c56873, 0x3d1df9806d68aea3, 0x1163a1621,
+0x2ee923405e06b567, 0xea787dd0d6bf2a6f, 0xe349c825d8ae3f6a, 0xbde4c6975815521, 0xeaedeabe942e3495, 0x4f3b47a973573845, 0x780064c717f4ec37, 0xb4d877151b0a3478, 0xcaa4be197a8c3691, 0xfe164d3e,
+0xa4c6491a60e4de36, 0xd61ec5b5b8cfec2, 0xe91be5a9e6095594, 0x76b910aa1d149c0b, 0x7bbbfb7fd9def6e4, 0xdbf1568baef7edd3, 0x1baf85ebdbc4e3e6, 0x82cf11cd53111147, 0x7b54c94def5ed9c9, 0xe67e37ed,
+0xd6f5039499c3b1ef, 0xd2efd3ac75457ede, 0x32ba0e4173a79726, 0x585c8f11be7cdca0, 0x61be6f64c321a165, 0x55ce1d2a5727c5bc, 0xcf08f39bd5705a24, 0xf98a6d718f210ecb, 0x976d77ff470b6050, 0x1a7fbec0b,
+0xe3eb3ab8143f2340, 0xdae56670f6991736, 0xa79d1b2de9f5e2b4, 0x490044836a4c4fcd, 0xa6e9eee8b7ff06ab, 0xa7d5c63bb0227849, 0x25d81cbf5f39ef75, 0x949dcc7da7d8be9a, 0x4a7de4544bfed9cf, 0x179e0634d,
+0x7503d6d3cfa98967, 0x7a3dbf374fd281b5, 0x8503065669a8e21c, 0x8550407d68b26bf2, 0xb177c65f71b8db7a, 0x5a0d45b0b9a837ca, 0xdc8077f4a3fb45c4, 0x153f3c5cb9e7c411, 0x17d2017d1d0e9a84, 0x2e11e8f,
+0x5f22068ae94c4166, 0xc7432715bdac1304, 0xab480dde9a1bc065, 0xd162573fdec6853b, 0x35da082590792f4c, 0x2deb1d9a1f6b404e, 0x604ce900ad128374, 0x8f33fa9a1d79371f, 0x3d7a20eda39eba74, 0x11d8d4c4f,
+0x4495ff76c0bee7a0, 0x3ad1b456fdd7f86b, 0x12ab903d9992aa49, 0x8e3be3d4211fa9e7, 0x6a9534ce89c10ef4, 0xecbba15e69f5c65a, 0xfddce4d0ce5cbcd8, 0x481729622964f7a8, 0x36377fb17c18d508, 0xfbe3b978,
+0x74a202f450a7c6bb, 0x3a61636703448a7f, 0xeee438117a01b1e8, 0xdcb1288fd9d5ea0d, 0xb5c4ffbd31f11934, 0x39870f81f8dae256, 0xc244283c90c4dc15, 0x318928ebfcca26d9, 0x9490f65cd66b8ee3, 0x10cc2ef0b,
+0x6ecab890dfa2f9d6, 0x37c245a34e690cee, 0xbf1c5fe53349a7d0, 0xdf875c3c2a7ba91e, 0xee3705886b6e8249, 0xeb3214ec1e33849, 0x9fa397a261851a39, 0xb325c28eb7c587d, 0x734281286cfb68c7, 0x11f579b8f,
+0x13bbb9c1b414e1c, 0xd9aae4d9d8b2af0c, 0x6d732141024fd8b, 0x437658e4f1fc83e2, 0x6af94f0a48d4088c, 0x3526a5ffed777880, 0xc0aeaf3f9c1bd66e, 0x5add0233869daa1c, 0x660415191c524ba2, 0x1b1c818c,
+0xa0b9f640337949b4, 0x743d4ede527ad851, 0x2b0805a428e85026, 0x4b8021d7fca4208b, 0xdc579898cfd992aa, 0x9dd7bd0ae4fb28a5, 0xa2cbe0bf4fe509de, 0x34697254c6428572, 0x327b9dcfd35fbd38, 0xcc1395c9,
+0xe247f7d175bcc75b, 0xcb712670dd2702d9, 0x968e66b32021a3d2, 0x9a7f7b75cce99d34, 0xdf8ecb5a6de9486c, 0xa4c44fa8446fbab5, 0x124e15c0ac086fc3, 0xfff8cadb9ab5af, 0xb587d10bd53620a6, 0xa4198593,
+0x628d064a4612ecd6, 0xb671bb5059c97eb4, 0x939db8e67d43083a, 0x4451744cc5d4aa13, 0x7b331d6968cf9627, 0x9f8e2a80aceaae00, 0xa39769fb56e81cff, 0x111340ca0e9a85fc, 0x9d1176d50e1aef57, 0x1ea350a8e,
+0x6595e129633f4ea8, 0x48cd6e0be1748762, 0x3e8d17e2a116998c, 0xdbf69b6646f6379d, 0x9b9aceb84fa2d0c5, 0x6d3bf367f423a5e, 0xd371b396f6ac15a7, 0x79c90ac1477684b3, 0xeb8b8775f59c431f, 0xec93b27a,
+0xa90a9386ddc008b1, 0x1c867470338e694c, 0xe85b06301ae774c8, 0x89fe25ee2b209a28, 0xd93e9dafbf178b9b, 0x8d1c81503ee6ec8e, 0x262963c8c0e91408, 0x8696bea5dc036e67, 0x7fd3a61590634839, 0x25df55069,
+0x3095ecaf20f86dcf, 0xe1df4b30654fb20, 0x5beed5f39df578b4, 0xe48cfc4239fd618b, 0x827835482a5a3947, 0xa049452865ef982, 0x62ae9c5bc4e667c2, 0xce60bba8900d9b0f, 0x54d129a8b1e5aa95, 0x24724ab2,
+0xdf35f504da858840, 0x4fb2a27ab9293937, 0xf921fd8e3587f764, 0x36c05f68f96cce41, 0xfc21502fd566792a, 0xac4bfd0819e39e7a, 0xd59d6a9c5627a47f, 0xe3a3c02b00aac17f, 0xf5e1c1bfcb17f9c4, 0x1df4ae5cd,
+0x8f9948543b99aca6, 0x36f97d42a2d36739, 0x7dbab23d616b79c8, 0xad727678d082265f, 0x9aa4ed08a53063f6, 0x62a93aadca656130, 0xee4eb68243f93fb1, 0x919ef72927726452, 0x43387ae2e23418a, 0x1a8d88c04,
+0x114a5f37c004e7cb, 0xf214dac001515c4f, 0x341693e0b4c0fdb3, 0x84d8576224802b1a, 0xe0ed480067011d08, 0x1a2bcc2e5532d8bc, 0xa040f74c0c3d2a48, 0x9c77da5cbbfc1e72, 0x440e480406862351, 0x16faef420,
+0xc1175441c34a450a, 0xd2bb093253909005, 0x9666b61df060a9fc, 0x3b68b754b4a9da7d, 0xdb4a8e9c26572400, 0x992dc63761074486, 0x3debfa4dfe632807, 0xeca58e7c26869332, 0xbe5b71b3d7c02a4c, 0x191633989,
+0xf1af0d4f7d2a597f, 0xb0afed5c3b4df771, 0x896682a5161d92a7, 0x63db556b9b996f2c, 0x55671f5f00226674, 0xbaefc639353920a5, 0x4cd9302c408eb286, 0xedb74143ec18957e, 0x6e05b139dc65262f, 0x87141f6e,
+0x8312a5c1c006f7b3, 0xe4f4df58b39f3ac6, 0xd68f5bde34d9e31a, 0xd2913e82efc4e235, 0xb34efd1add2a5c8f, 0xb756659a44e23d98, 0x620d4d7356f80613, 0x19d94556a4f5dcf6, 0x8021ac6cf2ec5916, 0x1c220a311,
+0x2412d5de8ffa63b, 0xb5f108b7031de6c0, 0x55a4864a1ae9b838, 0xd0f5860e1ed13297, 0x8caf4da2cf2e971f, 0xecd9bdbdfad9bcb2, 0x77263066bf4c4d38, 0x33f854dd13294335, 0x5787a2ea2bb63b14, 0x261c9756c,
+0xc8a5b4499f5f1b98, 0x15d42723eeddbae1, 0x9c20cdff6089ec17, 0x5bb5d454f59b757e, 0xc12280c0d5afede3, 0x34423dcd97038c66, 0x190bf00212c53220, 0x2febb518d3be42ee, 0x28ecace17cd5302b, 0x19dd13418,
+0xe4f9fe36fd52ea10, 0x40c3ff9bac29701c, 0xbfdbf8fb90816ed0, 0x680d2ba327b18972, 0x29024551f8b5e711, 0x85e555efa733075f, 0x53d14383d14d0f8f, 0xd74914afa8b9cd9d, 0x1c73b8619e7c40e, 0xe07b3d9,
+0xd87a4282b060f625, 0x56158205ac815880, 0x1bd47b14a24ea91a, 0x9e278cc5a65ced26, 0xa0a9dcfd713520ab, 0x4b1daa4df1cc81e2, 0x7c6cb3d7b7296e60, 0xf390935f60c1f3ca, 0xf1971bf30a8d79a5, 0x14334a28e,
+0x25ad5620e761c025, 0x277c2cfd3859b108, 0x683f72d17446284d, 0x6f1b87741cf7f12d, 0x5fab787fc79ed45b, 0xe3cceecb65f1b8e1, 0xcf968a1e596f81d9, 0xc124c09ac969e115, 0xb66508ed7327ab5b, 0x14d9379b6,
+0x36dc838834c943c3, 0x17321bcb6007119, 0x6dd4cc2895251fd9, 0xad3ba7bbd66e3bc5, 0xc7454742c9ad46f8, 0x4560e5ff0da74aa7, 0xbe96634ecf001a7d, 0x7b116f6e09dd2d49, 0x84a7aa3daf62a52c, 0x2713e183e,
+0x3f1a1fc873c56a93, 0x1e823d301b2432fb, 0x6272ae6afdabfb11, 0xc527baf500c89c, 0x1cc56516a9c3b9e9, 0x2a7ea15b9dc113d6, 0xe2b340725f4d141d, 0x4b9f4b215b658d8f, 0xfdd8140810f5f9c5, 0x8d28fa76,
+0x5806c57545990b54, 0x2ab9705f1e6b722d, 0x114f2b26079858c, 0x65df6cdb68b20cfa, 0xa574b30a2081b2ac, 0x6b4586f5b440cb80, 0x8713201e99f5f3cb, 0xdaa1338cac8b29d0, 0xb22a305085137e32, 0x5aab4c3c,
+0xfa465dabe7e1b1cf, 0x2d92468b21b4ec0e, 0x52c88352ea7ab9a3, 0xcf3317f6b535dc15, 0xa14d5ed3e40d1b47, 0xefa8021ac47fc2ae, 0x3bbcebe54f6debc6, 0xc05d1efcc070088d, 0x628695295c8b4ce7, 0x13744a983,
+0x629171fbf69cb2e5, 0xd28c537322c8f429, 0xc104bfe5abad6974, 0xe91c99e2e8bc5a1b, 0xaf092424861fcf7c, 0xe2521e8c4291e4c, 0x4389730ccc9d8b7d, 0x7d1db9968f466479, 0x9e1fd1274f9b290a, 0x185e0051b,
+0xd37638d432042b90, 0x887f601d6caace34, 0xe56a739a88ab3252, 0xb21da9a94d814091, 0x5bd1070925a20990, 0x823252e7d3c73b22, 0x1481f9fa0021cb63, 0xda698c7f21f34768, 0x5c39cc60fefc6651, 0x14cc52e59,
+0x2bed0c1fe378f2a8, 0xda2a696bc0b3494f, 0x50c4f1cf4e48d8ab, 0xdfcd6052ba3fac7a, 0x8335f1e373f5ae6f, 0x85c65a19416959ab, 0xfce4314639429572, 0xff7fdf47ad3e1fab, 0xfdb0f6514c9a30c2, 0x78783d53,
+0x230d045a79b18db2, 0x1e68580164026785, 0xd671ce8cab69255d, 0x1134fd7e383d9f01, 0x29034b57e92e00d6, 0x781a01b4cb80f823, 0xd5b0bee3168bf4e8, 0xc84c3ca6daa23d1d, 0x278d4719d946e4b2, 0x1e90610d0,
+0xa92675e44a8c4c37, 0x658e0a94e9d4d9a5, 0x6bc9b662f494c1b, 0xdafe8559ba3e1df8, 0xde44293b06d5a0ca, 0x1a7f9ccbf38731d4, 0xfccb6b8068cb4ccc, 0x59aeccd0bc88b911, 0x7eb6963eac6da86b, 0x187ba26b2,
+0xbab5987121504ddb, 0x366c3b3df4114a58, 0x2eec6f679ca0c63c, 0x6c070fa1c6edea55, 0xcd878f98cf05090e, 0x6f5a044649225dfc, 0x7081a7b7459ef13, 0x1f31f9530b2db722, 0x412fabdf800b31eb, 0x148b46d40,
+0xf928075505c772d0, 0xf5aeeca5bc3c7755, 0xb9171878671a504d, 0x335e3b9152b6fe4f, 0xd4145deb844133b5, 0x3c9ee6e6b7106b74, 0x1654f6f04ff88f25, 0x20575e80992da732, 0x7f52908df0213bbf, 0xb04899ba,
+0xedf434f763d48b3d, 0xb79e7cd5ad70d53f, 0xef729734b15f4a86, 0x66f7ca67b531a78, 0x66a3e48805a116c9, 0x46c0443fabc53586, 0x97759832fb0c9718, 0xffcd457e1b0d5618, 0x96b2ed4581fbfd81, 0x1814b7eba,
+0x74f374f3afddd98b, 0x44c89434120d6d2e, 0xf401b2042193889a, 0xb93371c269702247, 0xd01997514733e4d3, 0x48580eb8358bcc72, 0xf040c70dde52dae2, 0xb89401a0bb11fa5d, 0x9cbed1bf6fbaeb3, 0x13cdf2630,
+0xd66a304fd62cb10a, 0x5b5f6ac0883dc531, 0x41c3e11a22f343c3, 0x499823ba6c3922a6, 0xcc2f58b528a4ec64, 0xf91bce15545efa56, 0x9b00731d9a250208, 0x5142e922e648d89a, 0xc1b3f3739f808b89, 0x14d663531,
+0xa014352baf525634, 0x22820d16d598b010, 0xa177ad7fa98b4e1e, 0x256fbdbf619fd61e, 0x5edce52141091ec7, 0xa7b6fb2f7d6be643, 0xead37b9a9265956f, 0x65f4b10edd1a1d03, 0xdb7f379d3ce44bab, 0x2199a058f,
+0xefe95e60353b1b01, 0x841e2ab8e1e99b68, 0xdf8bffe38874569d, 0x67c822addc94616e, 0x921e39853ad2012c, 0xd9f7703ace7bf231, 0xa40ce27f5f578b27, 0x407cf5e3910eea2, 0x1853e35f0d3c3d84, 0x18f45c918,
+0x5aed9c81b3566124, 0x8eca98923fabfb80, 0x3a5026367752de03, 0xa950d2748a10db6a, 0x21532088f3a477b0, 0xcc57d36ea6430b56, 0xeeafefa977afe623, 0x5f546d4d9750704b, 0x163fb7cd177695f5, 0x16e8f9f5c,
+0x9d4723e1232c4966, 0xe4f65ef5e7f648ea, 0x4db562358d77c0e4, 0xd53d88f251fc97bb, 0xc1e7837dd05d11b1, 0x82fd50dbb4035e25, 0xd4be825134618b55, 0x78182f21438c7683, 0x88e4809312f71cac, 0x13cd5bd8b,
+0xbb41623df62811df, 0x7070fcff9ef48d43, 0xa9c84620a42f9e49, 0x3f47aa681f94cff8, 0xc173740b72aebe91, 0xd02fa4e543e9cd97, 0xc240b710c3b970c3, 0xf33bd025d25574f1, 0x1767ce6b862333f0, 0x2f610453,
+0xcae79d193a0fe2ac, 0x2ae0f298778e4386, 0xa6d35b72eace44ee, 0xf54db13ced30ff48, 0x1a4dbebdc4aec8e5, 0xfa6c6b342aef9e01, 0x68ab4dbcddced803, 0x30afa51cc93f757c, 0x71c865dc3e706fb6, 0x453b3da2,
+0xd3d42403679ad82, 0x62dbc05c75294bca, 0xe621cb241200ecb6, 0x6360ebac16390da6, 0x336fbc81df7482b9, 0x3eeb6169b100559a, 0x784432b3f3631af1, 0xebe5214715aca3f, 0x61f930a38ac1c914, 0x1c3f2dcb5,
+0x4b7933c7ea55a06, 0x38807524175d9e98, 0xf6b8841d7f83a4a4, 0x69de1eeea7509380, 0xe98831716e539db4, 0x920b78b60cd4e9e6, 0x669165e748e8ca78, 0x296083b2d2c98be4, 0x55197b31435f32e1, 0x17436b5f7,
+0x593650894c1ff144, 0xa8c33079b63a05a9, 0x7ecc6c7f28b5b678, 0xbfc468ac665b98e9, 0xc642b74318ae74d7, 0xe43d7490aea9528d, 0x7c0142a3f6d743ce, 0x25a7831ffee5e930, 0x2721c34bb052a944, 0x10eb5d7fc,
+0xe24b4bbd6ef13357, 0x1d67b3650f2e961, 0xf8583c34b77acd27, 0x193747fbfd1551f8, 0x4d57dfb2ca223c94, 0x8dfd1624575a92f9, 0x79fc1fc281976016, 0x13d33891995feb28, 0x8fddf3925a79fa2f, 0x17f9af862,
+0xeb04f7e38afeaf74, 0xb25322263d31d86d, 0xee712916d8111c24, 0xc2b4acf09fb5e023, 0x6fd094bb14a7ac39, 0x4578d2fe3581105d, 0x4223e6a3b459b37e, 0xfb6981a0efb8b434, 0x9ec2bb58defeaa2f, 0x326715e2,
+0xe65f170c70eb2c56, 0x10bac97ce82b042e, 0x697f9b5063949b41, 0xb8384a16b9998e65, 0x8f88563499449681, 0x8c20649923b55abf, 0xc15e5f41bcce8b50, 0x8fb05bb8aa780153, 0x3693868085f1ba7a, 0x12e89cab,
+0x670197d24a03b825, 0x3f91b9f577fe3ee5, 0xabc1dba1ba8f098c, 0xeaa3700328cfb9c3, 0x45e08838edad9733, 0xe69646b8fdbaf6a, 0xca71d7aacfd3fda0, 0x416b47c383c0e6f0, 0x2c82a7391dbf414b, 0xe9899222,
+0xf8015e9d8b8ae9f9, 0x202cc8703c8e1b2c, 0x412bb7e9b9369986, 0x81cca020da605c5e, 0xd422906bf8d31ba5, 0x3844aabaf314f840, 0xfd10cac3edc5248, 0xfad6bc825080fecd, 0x33be1d5f2d333d2e, 0x1888ffff3,
+0xe1c45ba867c71cc7, 0x3691ca033e3d5a77, 0x9cf2f9f4ef05f5c2, 0xea6be783f3908051, 0xac0c5684e0e9da47, 0xa4beaefe9b49518b, 0x68890505cf9ca09b, 0x4b5a93d801b6ec9f, 0xd6704ce657845343, 0x1157354de,
+0xe72dd6e2b43ec207, 0xa6e6c98d28b08dec, 0x3c46179a2fdfc0c7, 0xe75be8d5179365d1, 0xe94ff40a77aa2e31, 0x15e9af7bc315f83c, 0xb79d57c0d6ec6968, 0xc88a28982fc404c6, 0x24c96e451d2f96d9, 0x65916444,
+0x618b547d2085e665, 0xf7cab882bd695d6a, 0xbd17334456ceddb3, 0xafc4fd057575f32b, 0x38268ea29cb11176, 0xa43dd3500a20e63, 0x489508b670ed5938, 0x91290916b704f704, 0xe652eaf4c3c30363, 0x2d7398c2,
+0x6f18771c21ab588, 0xdaf2e0d3d7ecf588, 0xae648f16d011ba54, 0xef6a4181786c4cf0, 0xafbf2a2bb489fd64, 0x4647a92174823b45, 0xf91d5372bbe4fd02, 0xd2ed671b14221c9e, 0x351d6392b4794db1, 0x10e606431,
+0xd46cc4e5e1f026ba, 0xb0bd91f74e79f56b, 0x1f793976d5f576d7, 0x5c3c67674bbef992, 0x42464498c8dedd21, 0x23b7e67426097fdd, 0xed5e08502d485b63, 0x35febde355b80adc, 0xa21548b7ef3ed93f, 0x22f9e5682,
+0x5013bb86dc8edf8d, 0xca6f5c234c7faaa3, 0x3af8bed9e38c65de, 0xe73862983ace011c, 0x201d8afc5c13075a, 0x4be2c869d45bc50, 0xac98655d784a9e71, 0xc4ba0926d543b7dc, 0x6c4f9187d363eeaf, 0x271a7fcd4,
+0xaadff966256bbd50, 0x80ebe5d6b6e49992, 0x383afd08c4cde543, 0x5154f24a99ad7cb2, 0xd5bf65350003c1a, 0xa024806753069cd1, 0x242bdfbca345dd8c, 0x4ef6a3bc9b1276b8, 0xcd8eddf983ca72de, 0x8b160cab,
+0xc6f4bef6faeebd7, 0x36e3b0497f4d0972, 0xda93463d4e87040e, 0x200458112b7dc531, 0xbb801a9cf242295f, 0x2062d46d1111c1af, 0x474c379f4f941950, 0x1414950c54c42552, 0x3f2557dced234e38, 0x178d89081,
+0x28b5af5d56cdbffc, 0x528cb9d9b21cc751, 0x72d66cc56f07fa93, 0xc1210f83201ee242, 0x6916ff2cd2a8cd73, 0x186c8e31b277de6a, 0x646d3d76acbd4965, 0x43a2a3081cd0c090, 0x16059cdc55d8ddbf, 0xba5900e,
+0x192fc0a416495766, 0xd9ab13f2a667a98f, 0x891ab6e2ef60c157, 0xd218a531c411b34a, 0xd2e05758a116e190, 0x7a5163330070ea6c, 0x482edb3dacf094bf, 0xaf9383d30193419a, 0x8b268c74bc4e749b, 0x8184d5f0,
+0xd60b3de7d04b4d80, 0x8815dbc4e44e3949, 0xc120b9bc6535be7a, 0x4334403ed19f8d29, 0xe3269deffe38083b, 0xb066eb77da9b1ca5, 0x85d7edb2c71559f3, 0xe69aec407c4fd60d, 0x65751c3a74e029cb, 0x1330c7aae,
+0x2681cde9afb1efd2, 0xe6b61a7c87e4849d, 0x55495cde8a96479a, 0x229446dbb1932328, 0x70edf88fa8ee5f0d, 0x4b2511b06b9ddd93, 0x703ffa7685ab4275, 0x3d1163b24f38e828, 0x3a1b34198ebfdfba, 0x16c893bf8,
+0xfafad158c41a5358, 0x9e0b1bb68453c995, 0x8e16911aedfc49b0, 0xe26a257312cc2b4a, 0xf23743a4e6d0bdae, 0x43e2794015150291, 0xcb56b07fba501bd6, 0xa67bc6e631ba336b, 0xc6d9fe4dc3e1d849, 0x11ddf080b,
+0x37c06513e3d85ec1, 0xfb53866f4352efa9, 0x7f71c5cbea3ce536, 0x6ff1478f397c3f09, 0x68f6c40a253f82fb, 0x65a0014f2c2035d0, 0x7e93d36f5735d533, 0x45c0a125060a63d1, 0x3cf0921bf66ea91e, 0x26e90c572,
+0x2aa8cd224b2f7d6d, 0xa6734dabf1b6bfed, 0x8010a84842280324, 0x104c2556eaf398e5, 0xb188b68834b313cc, 0xa0eafd30afc12de8, 0xcef3bac1ba435682, 0xdd7293935a5e5d37, 0x75a4c9adb6bdbbad, 0xcddfc49f,
+0x63ea2c96339e24b2, 0x4c3f97341c55c784, 0xa3974c7a01dc0f91, 0x72616595a7342d84, 0xb7958c056a4a1f02, 0xffa025c32a63c8b, 0xa9fb257805e123dd, 0xaed191bda4085c54, 0x12d2f4d76b5ce484, 0x1aff682c1,
+0x86337176cc08a4c4, 0xfbddf1107e927b5c, 0x9c6d2a71f032798d, 0x388581b92296d458, 0x6a0654cfb284a8ec, 0x48ff10afcda7a7f6, 0x117e2aba24bf8aef, 0x645d34dbf23cbee0, 0x5c2a2af26ede2b4a, 0x20e16674d,
+0x99f00b6bea9fdac8, 0x636a2ecfa8763ce8, 0x39ed1ac0bc574615, 0x3baf61fee7c71cd9, 0xb035154168f92b7e, 0x91f072c347310148, 0xc004286cc328315c, 0xa161cc8b2717af8b, 0xb7b17d4e4918b96f, 0x1ed1c7084,
+0x70849f3a98040d0d, 0x90380494de3624d0, 0xebcbd3d2e2972b8c, 0x19f76d329891d6a6, 0xf01d851909797bb8, 0x82f11de121f3352a, 0xa2df905447c70429, 0xa16434216b638c73, 0x25aae8d0ee5b1723, 0xb63c9aea,
+0xe6417588feb0e934, 0x3716d542a184244d, 0xfccbcda0e91b6a62, 0xe6d5dbf238eac674, 0x8b4e2ddc994ad282, 0x688cd9ef535c6538, 0x6e7f6b2cc5cb00c7, 0x83da6dcee4dc04e4, 0x71a3964d34fbb14f, 0x8ef75bbd,
+0xa59d3fd0dbd2f110, 0x4f7b6f8355566a3b, 0x26f667ce92ce4d68, 0xd7f10459647286c9, 0xb1e248926b4c5a8f, 0x2199b206e3b475e5, 0xde2df9126f652aeb, 0x71ee3c770b94c16a, 0xe1476677a14abf9d, 0x18e871c04,
+0x86bfe6affa31c62e, 0x2cd1a7614ca2db02, 0x5cb88bfe472d64cb, 0x8b96077b115d5619, 0x1cfa2000146a4eab, 0x2d8382524daac013, 0x22dd69988479c049, 0xda9e67799b0e4b8e, 0xbde2ac4ef711c1c7, 0x111766d82,
+0x1640b0318c462826, 0x6aec0d11cf5f1ea3, 0x9b3a4ca591917194, 0xcdab2be379984218, 0x2763fb622d58a965, 0x66e25e7cfb808e9c, 0x2deb005666d03312, 0x59922ab6c7454d82, 0xe3a1be83680c0d75, 0x20ca9844f,
+0x8c6b9c391a4d94d8, 0x12f89d9cf053bf6d, 0xe9026ade0c74b24, 0x4a06c288c4c46e42, 0x479b6699573d91d0, 0x14630ed1b17b6165, 0xe1036c2b198dea43, 0x463d14dadfa2d7c1, 0x32bcb895a5597179, 0x12544b648,
+0x640a2030403ee4d2, 0x482c600d899abbe3, 0x453ed68dc034525e, 0x81492f4b3aee07b7, 0x332ee1996904a25c, 0x501a4085f3771e9d, 0xaeef53d9f10cf041, 0x50919f4eaaf0d230, 0xd27a2c81205c3a2d, 0x1b60f2c61,
+0x38b9e070f5d3b7f2, 0x69cd750dc6975e5b, 0x3dd4f31c2a35569d, 0x6eefc28a9a54a7e0, 0x320f8e86de50dd46, 0x89586adc8cbc1082, 0x8ebc6499356b356d, 0x1199877995f58fd0, 0x973ae21d738e58f8, 0x16e480938,
+0x8160de278819bb76, 0x4d80545763d72532, 0xe93299ad7e1f0d0d, 0xa3ff0f0541cb2af, 0x849d2d8c934e99e8, 0x12f2bd64a2e3e913, 0xe9b965eb576039e6, 0xc099ab84f7cd1cfd, 0x76ce52ddc0e558ea, 0xbb3b19b7,
+0x861c6a80d72dd74a, 0x82436e8c5b1f9a0, 0x54addee6efbca92e, 0x1d7a7255c36746d7, 0xfa8900a076ea994a, 0x445556183457e1b1, 0xd6146fdbe5b26bc8, 0x93990f0c1b5988f6, 0x5af085af42d3cbe4, 0x13d08b2a1,
+0xfa62150b643782cf, 0x331fe89501b824a7, 0x91d8210c5a5ce2da, 0x56b9af95b6ca9942, 0x78f5d975a9a65a7e, 0xe1aef9f8d9d2491, 0x79a7ab228d681ab1, 0xc409e9a6d4d0403e, 0x5551d2177351e4df, 0xcea6ca57,
+0x72b3eb0aeeeb36d5, 0xfd69239a7f226a66, 0x4cd6ab877eaedfe2, 0xc6fc0f6df2844d70, 0x7c615124c329532, 0xf443e23bcc16e02a, 0x1ac3b542820fff3a, 0x37ae77fe4e64f126, 0x11d0c28a18b5fd5, 0x1a5c11799,
+0x6537bb98f8f38f7d, 0xe1249c9dceaaf979, 0x4fc2ef665ecc72f1, 0xfa7a3c40e5c8c100, 0x4925c7a591ec63e3, 0x94293a67f69ed0ff, 0xd1fc213d7f3d17a6, 0x4db6b88893803e46, 0xa3040c2946b11f5e, 0x104e18b19,
+0xf26449e5c411cd85, 0xe40f8617ef92d172, 0x2ddffd51d6ecfca9, 0xf9e22b779e31fd20, 0x92b72643847becfe, 0x164c708e761dc729, 0x90e2d1d3f6b0883e, 0x1bad4bda463c9ecd, 0x2819a4d8e3ce25e8, 0x16a8eb07d,
+0xda0986986fcaf789, 0x7f6672b116128451, 0x28285614a16e015c, 0x88b4d23d74014361, 0x8b962d763f95339, 0x7c5886afdf50a482, 0x3183788a93b5cfd8, 0x55e509822e8ea82d, 0xe9db72e05a413d6c, 0xa82859f7,
+0xfe636405e0a4e4d, 0x864a35980512bc72, 0xaa059b143e68e3d7, 0xb496fd8b9b8402d0, 0x579ac9168719455a, 0x1d4f08413399916e, 0xfc215c210baecdcd, 0xbc9cf1cba81a4c78, 0xe049e25bf1db5a8f, 0xd9c6c3b1,
+0x4ea14ebcb4867a6c, 0x1225d1b9da460f43, 0x1c184e2e0f756ebb, 0x4e62742027975e98, 0xb1274df87506d7c1, 0x20d0e55e467fad61, 0xf334d4c833bb26ba, 0xd401a4334698035b, 0xccb8bf7b2631ec55, 0xc2af3625,
+0xf017e901693247bc, 0xfc73e104b8c6c5e, 0xf5ac5526b8cdd7b9, 0xd42ba6785b8f0548, 0x4caf9991770096b8, 0xef960dd369b9d974, 0xb5500caaf5342d30, 0x6335d91a16574a6a, 0x802e78a877fb73a8, 0x1d63f8d31,
+0x1edf2bbf8daeee89, 0xbaf0a8bf024fd265, 0xefa44a1d1b080c38, 0xe2c3374859c07c04, 0xeb94b2271ae71298, 0x572b51154c3742cb, 0xbb2636a0c4e5c1e2, 0x55ab9d4219abdd2d, 0xbe4d702d5dc26f01, 0x1b376c022,
+0x52373c84ddb9a727, 0x57ef85b95aba9877, 0xcc7234e8963b19a0, 0xea28ee5801e4d605, 0xbfd6a820d81a1833, 0xcc95c2e9428b7fd3, 0xb48256a45ea23b7a, 0xfdc1a052e631ea74, 0x2c91f2c18c2bd41b, 0x18273c6ac,
+0xfafa7038f98aca3, 0x3587a7addd62850f, 0xbfc0d0555338c346, 0x49f0225252a047f3, 0x83dcbd167bfa5429, 0x4175569b93323f5c, 0xcb61df6362ef1491, 0x5205be9e01a38294, 0xcf84bff4eedf165e, 0x23d3431e5,
+0x9bf2cd69ef0eaa0a, 0xab6336ec548e87ab, 0xdd8b11b294063fa3, 0xe01f6f890639b576, 0x7416f6c266acc44c, 0x239bff3120466a1e, 0x6cedbcc733143b00, 0x8a36d478dcf9fee8, 0x7224e36b685f2b57, 0x599f8df4,
+0xc1ef4933fcee677e, 0xaef34a2d8cda036d, 0x49d8a63d61663c0d, 0x43b856cc72ed457a, 0x897a9dd7571c3983, 0x95554c1070a3188c, 0xb10bc5d8f6a0d62f, 0xa6b9633bdcfdda97, 0xb067e99984d1f23b, 0x12da40e31,
+0x6288f3663ef7b740, 0xc930178f7535c7a8, 0xb07c04d81b422e94, 0x60cd417134853362, 0x643a14db580b196, 0x24cc07a55acb952b, 0x16493e1849fb2b87, 0x2a252d48539d6975, 0x4a5237b3bc682cc9, 0x15028c557,
+0xb69ed05645fa9b5b, 0xb5d7edfd86e76650, 0x81bf5017e2519271, 0x8c26b09725a8bcf3, 0x3a55ae3ab5db65e4, 0x247bd031162c0645, 0xa06b98e10b3a23b1, 0x6abf7cf44f52d266, 0x9f2b9613e98d1ad8, 0x1f8e63a66,
+0xcdb3220218b99bb7, 0xa279b6a9819d96e2, 0xc864c2106141e4, 0xd08f1ce7c024c73, 0xc07dbddcf5f77284, 0x7d815d0a4aa6bc56, 0x87a38d1fde051b49, 0x85053f11ccacbacf, 0x725f09a9c89927bf, 0x9394c321,
+0xb3c6dac8df38226f, 0x5dcf7654eff59eff, 0x738d97792cc55170, 0x37aabec24b49dcc6, 0xeb13354793ec4681, 0x44a578a47fb958a5, 0x70ae96107cd4d7ff, 0xa27ffb8e70b5ef8b, 0x7e0c181cc1244b0a, 0x1803147f8,
+0xe3981c1b3d6ffb3b, 0x33596926b5ac0dd0, 0xd087876f64358f0e, 0xe3aa8c4f665c7900, 0x17c71b2d2f59d589, 0xc40cd420083d498, 0x8ddb6d014fe616ee, 0x9420e07fda295641, 0x4eaa592cc5a119f9, 0x19b35b42d,
+0xbbfbdfc686642730, 0xa5f3ee4afa30be73, 0x5b567d7a346fe549, 0x1138ec378f2f733b, 0xa2a6c07438f11071, 0xc50e42afd3538530, 0x1e1cd7e70a092897, 0x6affbafd3e5dd3cc, 0xa850e20884ad9f6a, 0xcb5ccaef,
+0x5fa5a71fb8495ebb, 0xc6bcddd22a69c3e6, 0xf5746ea970f76140, 0xd5d9339067577ab2, 0x78934803fed4b6f8, 0xc183800a2ea1ebf8, 0x2a19c3632fb1050, 0x7e5f1570bd10bbf7, 0x2eed1afe00d91fbe, 0x22e8bcc5b,
+0x76aff7d154668c14, 0x23e2373e09d8d418, 0xaa712ef936b48b62, 0xb81bc24e53f438cc, 0xac3e079620db23f6, 0x2bc4d0814e532ea5, 0x694ec6afee557e9, 0xcb40aaca47ac9d7a, 0x4c6679cce5b67442, 0x173833d26,
+0x120f9ff6f00dde16, 0xeeff8f564261c925, 0xff5c097895adad59, 0x1816b4e4eb4c238f, 0x3388498be0e50e15, 0x20fb1178af0cf1e1, 0xe4fa403b12777783, 0x3a0ecc19c89bd857, 0x7dc818120f25acf7, 0xbcd577c0,
+0x5e6622313742992f, 0x1a6677f2f943fc45, 0xf5f91966442e2e47, 0xde185b1b28fd1ed7, 0x2f1aa0e214ca0cad, 0xfb0947508d85cc67, 0xd1ef487942f72b4, 0xa93de5581451191d, 0x555e766706c4cf46, 0x5a165efe,
+0xc56fef2be5963dd4, 0x4bd0740e2544a7e3, 0xe9fdf8efac891b23, 0xb613ca627c8eb4e2, 0x2231d7b0177ea62a, 0x466e0be7883b73c9, 0xcf08327cf959b870, 0x430a0d1bb9271145, 0xd1b5f89cd0a7e9f9, 0x1b6e93692,
+0x8d1c8fe5c4a00803, 0xfa789d51b48f1bf6, 0xc08928e058969e6f, 0xcbc918bda08edb63, 0xfd02878dd8541000, 0x5070e83bb4e23f43, 0xb1c84b2944ca5781, 0xf8f2658f434d00a7, 0xa6dc44aa3d4c7609, 0x24ca26cd5,
+0x663fb44962f9cb65, 0xaff90654b288a114, 0xed3f802806278d33, 0xe2fe782498abc9fc, 0xb53dacf36f4c54df, 0xb4ca7fe0b27f059e, 0x319f6cd7dc53acb9, 0x357943144d3a6d81, 0x636cde5a52714b87, 0x10aa67425,
+0xbb575ab7da6d47be, 0x28d849964e028f36, 0x1a0e0f8eb925d4c9, 0xcb96ef1cabfc1732, 0xe6e45bb47ee9f0a7, 0x9ad51a3de5fc8df6, 0x2094c3c025e94b85, 0xb3408f2f97f7621c, 0xd2eaa78432eea226, 0xfdb1a012,
+0x75a818c65cd63c84, 0x74cdd03a0fb44da1, 0xdc12357e4ca6f2dd, 0xc78cea4d3b1a90cb, 0x6e63cfcf0fdf16d4, 0xda1e614a8b4080b4, 0x8b20eeed2c1f2f2f, 0x1110cc26fd360359, 0xecc3c2ea86beb480, 0x1583f52ca,
+0xd13abd0d70c3c1d2, 0xbd18a6ad780bb0b4, 0x430ea32af25c158c, 0x6918e90e1b12b94b, 0x3aa06caa9cbd970e, 0xf2046411ff3934d9, 0x74a444532cea5ba9, 0xa3ee1106e53f9a85, 0xc02a3d03fe2f91ce, 0xb60fb561,
+0x3e991bc5413bd914, 0x955b01a107033d2e, 0xe2caede172a00ea1, 0x2020a55bd606d90e, 0x415b4318603ad19e, 0x197559cde9274827, 0xc592f71ce0709d05, 0x32436a87532262d5, 0x713dcd36623a9981, 0x1fde3e4df,
+0x913b1331a0df66ed, 0x34eedcf632f8572e, 0x7f468d0c47863eb7, 0x5d3e19aa180cf981, 0xd4c4a8d93c8a8343, 0x708141980ff0f8ed, 0xa3655150534db659, 0xa07b6b2e4cf046e2, 0x480c24d3f838cbf6, 0x268beaf6e,
+0x63b3883b493e32af, 0x7584771f5394449f, 0xf25e8d655b2a6a46, 0xffc9d4a0ae12d606, 0xec781a57392239ff, 0xff420d7878d5b374, 0xa3e79fc5bc121440, 0x94598ea30a1c4a64, 0x3a68a0ea6acb7031, 0xc17efa07,
+0x8249ac703db5168e, 0x1b14b8f6179294ec, 0x3c7e089a40934a0e, 0x7831892e47eb7dc9, 0x2cbaa8899c29af19, 0x249bc2917ecb0018, 0x2fd336b33ec358e3, 0x917521bc095297bd, 0x4dd360ee32dba12, 0x1fc6ffb01,
+0x884b4370fa620555, 0xb27ed1f5097057d3, 0xb710222f420ffc2a, 0x8b8ee1fc6f982802, 0xe7f581d57e6e63cd, 0xb021642ee92fe2ef, 0x4e03ae8a7bf3d91, 0xc313def6aa105f7c, 0x1c0a7dfe06eb5c50, 0x345b4d6e,
+0x36dedc4fe5e2b790, 0xa40fa12bd6c6c4ad, 0xb2c45b69c7f5af, 0xb8859c519b31ab94, 0xed9bbe2296f5125c, 0x75622e23bfad7a9d, 0xabd84e8ec9d48413, 0x21e162c92d590f1a, 0xb024f64de1b55d17, 0xe600b160,
+0x311bcc8452a4c7db, 0x85bfe3d3a016d851, 0x9190480c9315ee2d, 0xa1344f90efbd9bc2, 0x719bb89201740395, 0xc2575532bd2221ec, 0x7791e73d7a3e131c, 0x622aa61077ea3b0, 0xe9e2ce161816d34f, 0x58b2542e,
+0x76a68c6e3ba38a48, 0x4c37a8fd41a0b231, 0x16e50675812bf422, 0xfad3cdcf0731631c, 0xaa7578202d176c92, 0x73a796d42354c040, 0x516b835226774ad2, 0x1679336361a51e4a, 0xf60a0acd70281666, 0x82e43591,
+0x2d26a0a01bbd1e2e, 0x78cabc4e7f43d69a, 0x6471aaa33c8afae6, 0xf9668f59dd21d334, 0x264fbf47b95805b3, 0xe98f65c75355d218, 0x628db536990643ce, 0xd1ccc1fc0b548829, 0xcd0243dccb831382, 0xf3183e0a,
+0x9307a4847cd8611f, 0xbe1392a9bf8340a3, 0x6324e31dd68d927c, 0xcd1e7c6141f89516, 0x121784e02956e060, 0x7ab86908449902, 0x806cd90e0f7956f9, 0x258efd4c84a975a1, 0x230c8cf165caf343, 0x6a8815bb,
+0x2de94b59542fe0be, 0x4d64eced95fb58f3, 0xe875792903669acb, 0xb836a2d99f3a0404, 0xa195528908634cd9, 0x1ff72b3c7acf754e, 0x95979d2abcda7dea, 0x17436bc8f45b213, 0xe219ccb15602c516, 0x1900aaeff,
+0x7eb25ab2a364993b, 0x8b910f9b746725cc, 0xe71bb1c25fa868a0, 0x80189a7087f2db1f, 0x83789a429a6abf06, 0x2ba4f4b1c62167bc, 0xafcd849827d6bd49, 0x8a5e5496ae4be71e, 0x83a8d751ba71c30a, 0x23fe1c14d,
+0x57132f11e208a443, 0xf5156e2240348de5, 0x950561759897b22c, 0x9f06039d1a5482a3, 0xec4fcac98ab7be08, 0xadf03fa4a23f7741, 0xb373a34a11c45908, 0x493e052653698f3e, 0xcb9397591aded3bb, 0x83fbca3e,
+0xb774d4813eac11c1, 0x4ae43f37b5812d1a, 0xd08c33fbb8ce45f1, 0x830b77e63fd61e57, 0xb26c2992ace8447b, 0x6f0ac440adab63d6, 0x4ca1b43f6a5d77d4, 0xe1a4c6d9797268e9, 0x60f6d7c7219b190d, 0x19d03420c,
+0xc401f3baea2667ca, 0xb3774f1c8e2f219c, 0xa4190419a25cd5b5, 0x69ed88e124ffb00c, 0x1c1e5ec98660a645, 0xc134d7e9cf2ac0f9, 0xf1b8dcd6fecdd4c0, 0x7da172324199d67b, 0xb2e6adde2a4fe872, 0x1a97a1feb,
+0xec2aa8eb33cfc593, 0x3a595c2d69b2d65f, 0xc61d4b9a2b25816e, 0x2ddd4b469a42c636, 0xde3776089521fd86, 0xc01d19d498e2bd3a, 0x1d5c0c52b41efece, 0x72dd72df498f34b7, 0x498b461ceab8eaa7, 0x15f0fdf74,
+0xf4f5f485bdefa835, 0x73173a97836e734a, 0x52a5941189cbdc27, 0xa33157595301f7e1, 0xe651d39a3efaf5e4, 0xdac0fd970ff6f752, 0x67ec520ad92d680b, 0x6999e00cc769ee40, 0x4eb43f95ec5fd5a4, 0x1cd90ca7a,
+0xd80e7fad10ca2f6a, 0x2c7d6538223e1e4a, 0x751708cd3068606c, 0xda3baff229939a7a, 0x6d6540039104f608, 0xe403eb54ce9956c7, 0x73ea5dbd291ef88d, 0xf8d19a9f0850969e, 0x9fe5a3890fc87325, 0x1f9571fba,
+0xb659676c1a573c4, 0xbeb887bccd59a54, 0xf0a78b8794e73a4, 0xe1fd48896ff9b4e3, 0x1bf78ddff3b8be7b, 0x3da0237e3a9fd395, 0x8df6cba794389f2e, 0x8dc9f9df84515118, 0x301b26d1a448056e, 0x7a2858e8,
+0x9b0573c54d2f7fac, 0x20e7665020484dd9, 0x847d4652c294fb10, 0xf611a8087aa2e2e3, 0xad90a05d6288f0b2, 0xe63ab152e352720a, 0x95e2a447ab42e3c3, 0xb74044c226c8f271, 0x8b67f7389d025e78, 0x1d7a6e09d,
+0x845996a777401c72, 0x100983a64841d1ba, 0xbfc8fdcbbbd928ce, 0x6cfc7a1ca5f1bdac, 0xb3703bc0196bd006, 0x9f7b0a78e220fda1, 0x6cb39da9176eaf2f, 0x6485ba661dffd738, 0x2cec352cdd5ed4f3, 0x12ded9527,
+0xc75d0e3a296c8b4c, 0x26dd45165f4deed9, 0x90abd810f17fddae, 0x687ad1d03e968261, 0x5fe53cedeff68b11, 0x5d04a280552c42e3, 0x9bad6efb1c1f03, 0x6cc9303ba20a2fe0, 0x651673ff88db61e6, 0x112daab77,
+0xd96eddca08955b58, 0x1ee513807f3f69fc, 0xd686886102a2d681, 0x288e7db6beffe5db, 0xa1b3a72c08737123, 0x7df20b39ab56d3ba, 0xf7f30baadfac1642, 0x664aaa1ba30bebf2, 0x84c7cdadbe33f22b, 0xfafabce1,
+0x7f40b2884e0c120c, 0x8ff9867f377ca6b0, 0xd22be33eff04012d, 0xac4429677668a03d, 0x3f460cc07f248fee, 0x5930a5045fb16309, 0x6c7b81bb8c4124dc, 0xe248eb953d8a1d03, 0x99ba0feb3b237f08, 0x1e062ce8a,
+0xe4bf4167601fe073, 0xe8207cb6d16516b1, 0x778c5f88a1dbd2b2, 0x1d0cb3d2c861438f, 0x3e690ff90a3c623a, 0x942f270f32f5f202, 0x85637154ac218d53, 0x575e91b89e44143d, 0xcc466f576f49bbe, 0xb6e771b0,
+0x1931c8ce6e69b253, 0x71ac68aae6afd897, 0x3a4819e223911668, 0xe9c7a3bfe34a8289, 0xe7fcbe26145cbcf5, 0xa0f719cb2060d0de, 0xb83737d62581aa50, 0xc50a1a37e17299d1, 0xfd90ce76c33fedd9, 0x1dfa97b16,
+0xd490c88035357a89, 0x1f1d1a6e4fa78e4, 0x22b0bb17853c431d, 0x6d8526acb9ffff07, 0x8963a8f3197ffd3e, 0x6c15d87070e8f748, 0x4d3cfeccd3150822, 0xb5d75fd49eb3b8f8, 0x20ed55af8681c46, 0x6823ee78,
+0x3ab15c7ec65cad14, 0x8f9ecd0df7b1d2e4, 0xca7820298ffa1ac9, 0x71d1c3fe984ede88, 0x9060491ffae3fdaf, 0x69281c22a02c3967, 0xc4836d0ac311ff95, 0xcb7c7e9028ea74c3, 0x447339ae4caa30d1, 0x4c0bc8c2,
+0xe9725a69830067e5, 0x691845948547213c, 0xe130b980d5fb65a7, 0x919fe9d607dca60f, 0x3d072019ff54997a, 0x7cbff8e27f38eb50, 0xfe0836141de530f, 0x16e4ebfc57734dc, 0x1954e21f46bc7d2e, 0x4bb8f3a0,
+0xbfefe0f6e2e69fc1, 0x277d693cfd5eb000, 0xada1665fea6fcf72, 0x8eee72c5bc282e3a, 0x2b1bf5438d36a94d, 0xf9108f77e2112ff7, 0x3928223956c4e426, 0xf64c3c997f224128, 0xedbd1fdac45c9a0f, 0x3aa3fde4,
+0xa0890d5e1122abf6, 0x33ef7058ffb51030, 0xfcd01b71aee3bed9, 0xc6d7d698ec7e4787, 0x9ab78add4e91643e, 0x2c66abdd8b83e74e, 0x23c9a4f38d8ec55f, 0xf49953b72e6097fe, 0x94aa803ae0d6b48c, 0xda033a55,
+0x5c2be15b01e75350, 0xc801b24ee3eddcfd, 0x46a0058aa0618895, 0xf385e4a8cc9fa7bf, 0xd4548dd5de3c3a96, 0x35bca6c723c1e8a2, 0xa2ebc8ee23003035, 0xa8283f9330c3ebf5, 0xe816af07744b7f1d, 0x19bb65dcf,
+0x63bb1799660a351c, 0x2b308cda14387633, 0xd922d1c2d8da22ae, 0x1adaea731728c2e3, 0x5291c561821a69f3, 0x626bccf3b8668143, 0x491df1c8e5558446, 0xda26e7c8f4e8fe84, 0x21331449c524ff11, 0x1f3a1f583,
+0x8e6e78b0ded30c93, 0xa14a0a71e7eb7f01, 0xf9a160a3fc177b90, 0xb1a0f04a9f75e145, 0x6375cedfb591cb08, 0x6b56ef3c7684bd7d, 0x64c0305807e87f9, 0x135f41ef51fd4c01, 0x271bbd522559703d, 0x335d634f,
+0xaa328d65a91bf2a6, 0xf9c1696d83b8886a, 0x5b0cdfe727f9016f, 0x10c012cc94e894eb, 0x24b31a3ec242e20e, 0xd61e856590374a11, 0x540c325c0495e89d, 0xc43bc7c84b20553c, 0x1a1d353bba89dc0b, 0xb4a254ec,
+0xbcb2a08230a5e900, 0x2f63c6d34e47ab1e, 0xb26fa108938557db, 0xcfc308ca9ae4ef51, 0x8a86815f05c766b1, 0xe2996e63ae236937, 0xf37bd76203aa1360, 0x5673f32108fa560a, 0xfc3a1a5ec178d6e, 0x30285f45,
+0x29be00f265eefe75, 0xc9cf35efb3e30db2, 0x88ebaad469bb72f4, 0xe1da640893919989, 0x6cadea316e44c25d, 0x59082f11d135324d, 0xc895af0690654d09, 0x1871202e589214e8, 0xc89073d994537e28, 0x23fd8b623,
+0x873c29ae7d9b4503, 0x6c51d585fd2df344, 0xe2d3726c466ca209, 0x2a9690662ceead9a, 0xd5f1c02b64c1633b, 0xc784f38eaf9e2387, 0xaa911a0375544272, 0xec1b42b079836670, 0x246037fb51e4ed8d, 0xe2d70601,
+0x25dc8898cddfc9f5, 0x4cdfb91aae46045c, 0xbf10bba57b974839, 0x9b6c24d7e0a9ad5b, 0x13a4704de927087e, 0xa1d50d91014036ab, 0x7383e01c3aa53b10, 0x1bb3db22d2971e43, 0xc38732140a391a0a, 0x727407c9,
+0xda80b9a9f4dbbe6, 0x418d5a8e1b5c9427, 0xb818142972776714, 0xc428a9a162819d5e, 0x128623ff71add8a8, 0xe1f8fe5216a8f7c5, 0xa627de2a5006cde2, 0xcb78a6a9dda76168, 0xe6a746d484f1308c, 0x93d45e48,
+0x121f230ccd26b183, 0x5b5617f9abba7b1e, 0x873d4a7e200c59b1, 0x3457b742beb5201, 0x32e56d98bd1ab76c, 0x31d372293c1a8281, 0x41ebeb62254e920a, 0xe804fb2ac59de9e3, 0xf6b7a5163051d7f2, 0x20355a52b,
+0x1bde1fc69cbdf3ac, 0x38aa9222836cdc10, 0x39b4b45bfd01cf89, 0x5c0bcf66f690606a, 0x6335d1a344e1702f, 0x84f27db595cac6a4, 0x9731df321dde5e9c, 0xd46908d65ea24ef9, 0x3427c54a2f31710d, 0x1ebf7eb3c,
+0xe09f51f291edbd2f, 0xe5ff403324189a5, 0x1e44cb7e59cc4f6e, 0x16fef66969be26ed, 0x97239a32b49dc773, 0x69ca086e5e2bd3e0, 0x94ea261b68d432e4, 0x2766ac70e35e0c2f, 0xbca156136567685c, 0x1042d64f,
+0x65f7cf1bb1e94d7c, 0xea22cdab452542b0, 0xeb88f3bc9623e803, 0x9de16b6abcf79031, 0x5c16dac9c43708a2, 0x8608b48da164a88f, 0x2a9165993cb421b0, 0x4f617d7b628bc371, 0xa85d0a3bc36a296b, 0x2293b23f5,
+0x123a876dc19ed2c9, 0xeb606e3d8197998a, 0xe265f33ed01116ba, 0x46a6e263d364d763, 0x79ec81557c979d0c, 0xc9eb5079fb916174, 0x81787e0c2b4e6716, 0x9b87756b36141650, 0x77d6951b940b0a26, 0x1e88f2a5b,
+0x3681b667132b9928, 0x3be54f5b8b59c28c, 0xaa2e50af2d920e51, 0xbb91b2ea4a56181b, 0x2b62a8d4b180cc66, 0x903554bfac1f5895, 0xdf3d4c16f2411df4, 0x7526c49e612b41b8, 0x86b232d303218c7b, 0x143f23279,
+0xcd4613ee4b1c1072, 0x1f3dd73bc8cdce29, 0xb806549e754eb42b, 0xf7e95e38a38d5e7a, 0x2f0637fb0ba5914f, 0x309cbf7f755335e7, 0x1e02eebb777e27c2, 0xb46b35b1ed6e5f1f, 0xc7d71909bb898a9a, 0x1771657f4,
+0x3e0c904cfc9f27b4, 0x68ec6a05b4b84bf0, 0x15f86eac4634f525, 0x6b829ad93c500767, 0x5cd1ad50cb72d2f3, 0x685e45bd0b8e03cd, 0x8feb6ed575cf6fce, 0xe80e66dfeec428f4, 0xf253b1841df666d9, 0x11515f561,
+0x3aec92d0c61e2f01, 0x2621b24dd76a83a3, 0x7afe9014028f6503, 0x27d9a7636cb7e44a, 0x387fb88d3ab30119, 0x9c68f48e40f52082, 0x8a03c572259c2374, 0x7185e7267915b83c, 0xc8690c4432a8c51e, 0x1edfe6d77,
+0x3cbda8293b09cf5e, 0xea236d06d2be585c, 0xa178fa8ed3981fcc, 0xeedcaccb6442b287, 0x38c77a36c1e1faa3, 0xfce9460ab3696a92, 0xf1c3f7433fd91b03, 0x253f83bc09aa22b8, 0x3c48789ef5969152, 0x2456adac,
+0x56867604ce75f7da, 0xb44b40509dd6e23, 0xb42853c03115dafe, 0xf8da6f47173a02b8, 0xb96e23e95e7a1e4a, 0xe9bdbe7bf7e55f61, 0xd898ca1ee310aa9c, 0x5bcd47010ba57491, 0x283c403785bf67ef, 0x215ba0d9a,
+0xad497adc72a8cd7f, 0x22d9906e2702e3bc, 0xfe4ae42b947049f6, 0x7c0464fe61332c4b, 0x8b961ee87e614719, 0x9a8d3f9967c7ebb6, 0xd74437859257fe92, 0xa531dce423a9f698, 0x8bacc6158a5c1586, 0x178217df0,
+0x44fefe21aa425fee, 0x54ed913b54e71200, 0x3736b76331463850, 0x5e8c74ce9dddd931, 0x43b2c31fbe9cd4fb, 0xdb4a337dc743824b, 0xba70752302d1fe6, 0xd53956f0e63fa188, 0xe197a795c3f0d45f, 0x211aec450,
+0x205441ccf6faa66e, 0xca3c83c10827d4c7, 0xdaf115085cbcbbb8, 0xaa2d2bdf86dee186, 0x532f4dec34a4aa1f, 0x24dc2a615718299b, 0x4a40a4323f0e23f9, 0x62ca7bf540a2c076, 0xafbd42d680c4793c, 0x5d6466a,
+0x5f5422a7fe2ab9f0, 0x9a0019cfa9a173c5, 0xf940a1e846573fd4, 0xa513451bc009bc72, 0xa213d9d887ee4d32, 0x756fd98cb677a068, 0x4e5790218d7781ae, 0x8192fc3d7903b226, 0x74ba046cee9e14ff, 0x8aa1d13a,
+0x34c134eda2037b18, 0x78ef16cb2a1b8ba4, 0x9da4fef217a734cc, 0x23ca49cbeb5ac385, 0x5a488b5f9f1f5fe4, 0x7c3b969b2bf12d3d, 0xef602fabf17e0411, 0xcc2e718de0bbe4, 0x197283cb900ede98, 0x1ade8821,
+0x1d5904d4cc55d5cc, 0x7491913304d1e514, 0x12dd4e2039baf1ad, 0x65eae25cb530e9b1, 0x75d7d77ed5040dc2, 0x9bbad04eca329143, 0xd8584171416b52b5, 0x44861aa72393f59e, 0xd228529b0022ce22, 0x444983c3,
+0x8a6e94797cd807cf, 0x503dcae5f78bd022, 0x2d4c3f5120537be5, 0xbe7252b66ef62ef2, 0xd204f9422cca76dc, 0xbf646a7549380b68, 0x1aef5fbaecfc0e47, 0xf08f1733404c0511, 0xf8f618a28595ea76, 0x187f93e8e,
+0xa6cb4736baca759f, 0xeb47173200dbecbd, 0xc770658f6ecc948e, 0x779ca00944abb158, 0xa89b1e6bfa3c11c7, 0xdf6ede4a792da949, 0xa1af2bc6efabc26c, 0x82cd75562b68116f, 0xddda41ac654aef20, 0x78e9cbaa,
+0x1a2d0c3b3e165a0e, 0xaca4928585f01ea2, 0xbe4ca427317b885e, 0x938d8e8f32e7bcc5, 0xf86cc4f9740865e, 0x55b2dbe38bdc2aa7, 0x3ac9dce959b08229, 0x1f5fcee0bc406749, 0xc40a30238a25feee, 0x9046bef,
+0x19be138d63f40e7, 0x436640f8382f5665, 0x375347e54ce33b1e, 0x4c4f10607195150f, 0xd95ca2147f4cf217, 0xf278e6391c50bcce, 0x106b381473c5a025, 0x6dee128f0017a60c, 0x557a7214d2130b38, 0x144896790,
+0x65e22248e1dcebbc, 0x774eddfbdb4999d1, 0xddcfadbff5a3a0c3, 0x8c731d5d03fe4a60, 0xead49abac4389bef, 0x2000ec31ccfafe54, 0xffa303ef74b3d0dd, 0x7e6cab6a3ab4372e, 0xd611cce6df481109, 0x14faa42fe,
+0x73f63ea082d60fe9, 0x1fb676ef68b0f123, 0xa7a9ab471dc54709, 0x3c4eaf396e1e3f88, 0xdd2a2e02dd2ae441, 0x4de19beccf60b3ba, 0xdd9d0564af26daf, 0xbb0e0e338fda2486, 0x66f7fd343254b5d4, 0xedd62f80,
+0x9100f37bc09dc3e2, 0xf7b3a9e41d11b340, 0x92dc9be82b21790, 0x280f9f72a64ebc99, 0xa395c2b27971bb13, 0x33bb8acaa5852e29, 0x61c92731a7eb4362, 0x7eb4e29e7a4c748d, 0xed8626dbb0ad52c, 0x15f2ff65,
+0x2918f1490cbea20e, 0xa68b08bc05ee9fea, 0x691ba27a0b783a51, 0xf2296f1e0676450, 0x3b22bce35690ad6c, 0x15067a6018b97e8b, 0x2f7bd8fe29c50a10, 0x3345af4bed5fab3d, 0xea5e944ac709bc26, 0xebcff4aa,
+0xd078ac500564eb66, 0x349f01229ade0f95, 0x24b43cb070d26f79, 0xd7dd186d8f071acf, 0x94cb2ddbd8eb0138, 0x2c6e447df81f9632, 0x338cc2db9d239d70, 0x358c55e3b6202990, 0x61c7892e497105e4, 0x159ffa69b,
+0x7bae8c20791ac1f5, 0x6c11e0d9f3d7a48a, 0x14ce2086244e0bde, 0x62d64a79ec2a126c, 0xdfc4b91decab40a7, 0x5b44fc9d4434244a, 0xa22e99e850a3c7f6, 0x12699ffe0dadc9ca, 0x1f950e4faff355ca, 0x13b38e6a2,
+0x4978ed3863af44af, 0x942b2c767ea13923, 0xd242f542bf694515, 0xa124f30a86cebf34, 0xc448b8054e7aa580, 0x9c793357d44a1a21, 0x58e0d3bd3ab215ec, 0x1ef219bddf0629e0, 0x4cf29de07c270db1, 0x24725fcaa,
+0xd634f34d16a10dba, 0x3205b7cf470ae565, 0x62cdff947de3c163, 0x7263714909bb2da2, 0xd55c7dd3e1508dc4, 0xbd6d4064c49ab790, 0x34fa5d552740527, 0xee926a89a3a696d8, 0x510cbe55be00785, 0x1f41cdb,
+0x4d1478efbc7ce622, 0x2365099ba74a5b53, 0x3303c7e6a1564b3a, 0x298272daba20cab6, 0x91a394cd1efaac1d, 0xe2140e2a838367f, 0x4f7818449f307a7d, 0xa61e3930450a3f5, 0xe91585bddf2b01d9, 0x1dfb182c9,
+0x72dd786ee1c959df, 0x8ccd9d6d2f209f14, 0xff1ddcd09890fc91, 0x711ed78f1b17d90f, 0x91ebe98ade92af0d, 0x25d838c178d6757f, 0x6d5ad3caba5e4bba, 0xe2eed5c1e0a42b4c, 0x6e1b4dd295025497, 0x257e5e64b,
+0x3c402d71a39a3ebc, 0x72360211c3f6eca3, 0x5b7711dc0dee04e8, 0x26117e7625b1690f, 0x5c99da0e07c1fb84, 0xe231162e9b89d69b, 0x725b41b111aa6ef4, 0x79d9482aa5489a34, 0xa5c2aba14252fe7e, 0x172bd5ef3,
+0x6a91593bcbbf4ba9, 0x9e1df6c4b8b5083c, 0x3d3477a51eabdcac, 0xe19ccaae11781ef0, 0xa3989b17a1a387d9, 0x4deb4501171c52a2, 0x677e3e0abf786418, 0x17b5d4287d2ac1be, 0xd42c37783e0eb3b6, 0x9b4a65c2,
+0x31ce1197540d4775, 0x321c3a0b7b16006c, 0x2b7e52783bcf2b21, 0x4456d981b006bd5a, 0x98dfe42fe49b53d5, 0xab2a66d0ae7970d1, 0xd5206aa1a4cd7695, 0x6157fff4f98e7f15, 0xdb5c07f2aac95c40, 0x1a854a007,
+0xa02abaa33955576c, 0x10c66dc4031841d8, 0xb8961fec4d21092b, 0xa81e49f5ee5c04eb, 0xe196a99f8a9ff7ed, 0x32cf0c078539c972, 0xb6286d6f3fd3bc37, 0xdfb7d276d4657e1b, 0xd1bb77b904e9764a, 0x251143cf4,
+0xaeb9114e92a54389, 0x66b25cd8dcc00cd9, 0x109e2e8e6ef70148, 0xa57943493865be38, 0xe8fb844d11e140e9, 0xf03a57edebea0e7c, 0xa77f19123cd58b29, 0x6c3cc9015df6292c, 0x7f8c5be72e1c2dd5, 0x19de616db,
+0x5de1ba5330f4093f, 0xb1045dc3f8c99739, 0xbe209ef1d6741899, 0x21dffcdba36454da, 0x2427e3def260a177, 0x5f6ed76d0a233700, 0xc184f005d219d65d, 0x22eb3fa6035426a3, 0x85cc1fd2e9f9c65, 0x21ea7bb75,
+0xccd6b75d199f4a5b, 0x2f3b24325145c2d2, 0x2301eaacc422ffe6, 0xdb21c4a45ce6401f, 0xa3d3a5ef8a14b18, 0xca7b58167e6e2d48, 0xfe3dd28fce22b710, 0xbc9b40b5c8d03265, 0xb26ed15901aff025, 0x7ad83554,
+0xde65211a95293d0, 0xeb037104dced04f3, 0xe7a019eb8ac72cb8, 0x5b7e199fdb804a29, 0xd480d87a0a99ad8d, 0xeaa71a6bca46e4c3, 0x31407f756a5c31d7, 0xef83beb7360aeaca, 0x3a189807b256266, 0x185995edc,
+0xea311bd325186e5f, 0xaf78540867d000b4, 0xc8fbcdaeab2144e2, 0xe241703756d2827c, 0x6732b7cb1bf5fdd8, 0xfc9dd563b15fb32d, 0xccff682eccfc4f64, 0x75ac00c1b8b5fc79, 0xa2462436ed7f2aa3, 0x26f9ed792,
+0x8da85685fca9ad60, 0x4be5f5df322e9e85, 0x362f8f09aafdc65f, 0x3b978e6c9b335835, 0x36712941378f6b75, 0xd9db7f0566907200, 0xf5462218ec98b5, 0xcd3da5c1cf48e2d0, 0xa4516ba2aa47b5a1, 0x176b90a2d,
+0xaca8148f87d22f59, 0xb7bda94ff2346453, 0x1ec8038b2aaefd46, 0xd65a791e5a284009, 0xebb6d98fab2d948f, 0x48794bd30ceeaed, 0x835ee58eabc18421, 0x63ba333850852c4f, 0xf7baedbcf3b67609, 0x19e845ff8,
+0xcb05aa7422097317, 0xdcdf1988877aa31c, 0x7038c39b6244e56d, 0x450eb09c627218e, 0xae5a5ab22ca646f4, 0x8b74d72fa10af9ba, 0x5dec68f4ee931f4c, 0xebae104ebcd76db2, 0x4f823550ed5f8e10, 0xbecf1e7,
+0xd0b96a98583d4faa, 0x3c67d72fb0855792, 0x7210b2368795a5ea, 0x852ea637e146762a, 0x5570ed6f509db043, 0x43efa281cfb1934b, 0xe6c189514efdb098, 0x4b25984c0c19a128, 0xe2341db56df4cc6b, 0x2352be239,
+0x24afef3ae3a4da73, 0x4ce10d368a99b019, 0x4c43557b43013318, 0x5dbcbdaa3d9647b4, 0xfe4474a5349b4087, 0x820fb67d051763b7, 0x609df535b766ff77, 0x288105766faa2576, 0x9cfd65551aac72d1, 0x1f463060f,
+0x3996c32e66ba105c, 0xf13c733aa24c1977, 0xa63ec47ad146edd5, 0x7a3290db5499c339, 0x227db17019123440, 0x4b862a048c40d26f, 0xc375a7ceda886fee, 0x744b73e50855d97a, 0x521b9726d044f488, 0x2465daefb,
+0x6cfc818255940bd9, 0xd750a450ea5ea832, 0xe3562bc4619f4b41, 0xacd5affac7c95ab8, 0xaaf8503d0bb7e3da, 0x293f4014fd4616d5, 0x72896f681605db07, 0xe3d7220ee83261df, 0x913c214476f9018b, 0x163deaca7,
+0xe594a6bb54a8ff80, 0xdf0c62afaa34ceb2, 0x500df09258544840, 0xb02b132480ee8763, 0xebb12bbb8e70dae4, 0x6de8875a079b6ed5, 0xc1be01ed37f21759, 0x70896df609d6267d, 0x4e7b48eb81525f8b, 0xfa1eceb1,
+0x1e4312ac351a2ae8, 0x27b770d8685b7dcc, 0xd91058888b5b1b6f, 0xb2c998f919abb311, 0xea9e150525dd7b1f, 0x242147b66ebce669, 0xab14a74945178567, 0x8e285b47431ad3fd, 0x8cb2e0dcb2637136, 0x111a2b783,
+0x89cb0dd5a11645f1, 0x8902044dd79f91f4, 0x8b7649462f1fe138, 0xd7d22837c66d77f7, 0x2a37d3a10e51a1e0, 0x2a63bd2c4956a0d8, 0xebb61fe3d868f2a5, 0x73a5e8b1efbdbee7, 0xcec409012db37517, 0x236266804,
+0x9c178d4eb33d386e, 0x18d6df41f85b420e, 0xcb7cbb2a9a280169, 0xe50704c3065dfdbf, 0xf3abf3b7f72824f1, 0xb32c764b1d3a0323, 0xbdc45c49b9c205a8, 0x43f5756ec0824eef, 0xea32efca5313df0, 0x60337e0f,
+0x5bd063cf5f26b9c0, 0x4655e80287bc2538, 0x27f7c68693db7dbb, 0x5e6f553486e33f2, 0x7eb263e0b85d0fc7, 0x1ae85814e9b73330, 0x4aeeed77f6e4ca6f, 0x325e7dda01a16658, 0xda67ef08a304f2da, 0xdde80763,
+0xdc37d399a8f82596, 0x3ccc1ce5bc44e654, 0x4023fa030e56e858, 0xf3a5848dae7ad32c, 0x6909784804958f12, 0xc0e3d6a30015c5ee, 0x8b35590520e2869f, 0xe301761abb3e5566, 0x654a119473f760a5, 0x1fda9e6d2,
+0x98bd6c465424e015, 0x915a180fe64f8ae1, 0x1398c1742a093b32, 0xb1a8f0ea3728267c, 0x50a4a8b7e5480d4b, 0x142c589fcf578fa6, 0x1bcaf15e1239bd3, 0x8ac689f0b6239be0, 0xa633cc668c17907, 0x26b2f7389,
+0xae3ce908d033f12a, 0xf37c36fc63d83772, 0xa897bb5f5937a219, 0xd31c9329e36e3872, 0xf838302cb3796d84, 0xe9a7c3ba08efa1ab, 0xbdf47aba15ff7f0f, 0x3e3a57d709920e1b, 0xf608d81da4d249a4, 0x20971b4a8,
+0xd2786ce6e561d2f8, 0x7b47065ed2c7bde6, 0xd448985d16231166, 0xb31921c01aab0c1b, 0x50c10f88f637296a, 0x834a3c94b89443e0, 0xffd76ad0229e8efe, 0x4a598857d26d1c00, 0xbad08d9550b5fc46, 0x1e0d2de4d,
+0xe0b81a558a1e903c, 0x326d47fc72d7f1b2, 0x4a8366b4fef1fd41, 0x97deb6be5ffedd42, 0xa2e0b2c3c3b26752, 0x646b7801afa99bd6, 0x870308ae29e743ad, 0x7528c98dfda28a8c, 0x60eea475ca3dcc40, 0x55561576,
+0x72ccadac5473a115, 0xced35242acefa744, 0xab649a5d59b1f1ed, 0xb8bc01dcb2099db3, 0xa1e2e1cab8179919, 0x2620c7b1040d4626, 0x64c29dcd47c51982, 0xdf9245513e556057, 0x59c3de8678c84dca, 0x1f04213fa,
+0x160ab4058f39c6ce, 0x720bdb3f4aecb976, 0xea1a65241c9ac5b9, 0x8d98babd00760b75, 0x87237aa2585f8a57, 0x50c37ffea002b96, 0xbef7af90228b0436, 0x7740b999d4379dc1, 0xec48ea6f9e315867, 0xc86d2d02,
+0x750bed6b2fd56b52, 0x9af29b3205fdde72, 0xafe2aaaacc2c26ad, 0x4ec562db2ffffa96, 0x59e5a57887764912, 0x3415ab6314ece979, 0xf138c4c7a3301274, 0xc105c73abb4dbc7, 0x68a31da0d4a87532, 0x19df055bd,
+0x1ea98f5a54d97d5a, 0xe5d1c790ffff166a, 0xb122046edca0d43a, 0xaaddc3e7e191dc1d, 0x230bb45b47e7e7c2, 0x4936b7422eef15e1, 0xde855b7a470d053d, 0x7feabdff6728a7f5, 0xa52f36e0bc28fa5, 0x2307e9a5f,
+0xc8eac3c6239886e7, 0x5c7fe864a19a2716, 0x698047415788cf6a, 0x92cb19554d0db7e, 0x2e601e6d591a558a, 0xf2b25df232a005ad, 0x54f9731094b4bff8, 0xec6cd52ac62ff139, 0x40e5e728a0a06708, 0x21a77a821,
+0x3f8e881c47a1f208, 0xcb9293d0a1649a52, 0xbc4aa74a19c6d3d, 0xa219c20ac7377fd5, 0xb1a0d4248d2c8c7e, 0xe71ceac53fc127db, 0x4f3d8e699b468334, 0x5aae420cb95c2126, 0xe78e1de7225e805e, 0x21959f564,
+0xc5fa9363ccb75b9b, 0xb1a77d21fbffa00b, 0xffe4536bd2fc0753, 0x665077786faac5e, 0x8259ff865486801b, 0x2e2d2393662f3853, 0xefdf4b047f5b6272, 0x22e346edffcbc6b8, 0x1a282cbbe4235f21, 0x100b2e2e8,
+0x3a362eff62719cc0, 0xb7a1f13f13074c4b, 0x1e5441f1663d92cf, 0xbd0e208e32b4dbee, 0xa4cbe7e030fc528a, 0x7362700f593c3ea0, 0x9ace449109346d6c, 0x4412439ccd833a4b, 0x642714732cc44dc7, 0x22e0d0def,
+0x33b9926bdce38f7, 0x515c27d04806b045, 0x8e0806a5d94a8d33, 0x79092b72d7076113, 0x736d7394ac7d70c5, 0xa38752ebed99ae57, 0x1bb82f9798bfb264, 0xdc400afbcb065355, 0xbc2075970719bae5, 0xa8e351d1,
+0x8fb7bbad2bf71782, 0x50c2bb8190112c49, 0xff3e463a8ca29e00, 0x69155440a2bd1f62, 0x1a68f00097abd8f, 0xa378ae9e9f8b9672, 0xc5fe9c5bc2711bd9, 0x2de5c2bf883c31d9, 0x6c3ef8f2eb791331, 0x1743f15df,
+0x3ac0819f164e37c, 0x1c93cf27fff4e0dd, 0xb28897142e35ba04, 0x5912dbf0a8379841, 0x33a2ed6edc4b51f, 0xd124a8bf13e0e69, 0x7fd4bb21492e2819, 0x2ce1e0ee05c90b54, 0x3893128a6a171dbc, 0x13a1e025f,
+0x4b8a185bb27a9db6, 0x306c877512860bec, 0x9f3e50660f0bc38a, 0x597c8dab0d3ebd92, 0x528a533fbc5de8e1, 0xe77c938ca2c12dd1, 0xdb980aeb910767b4, 0x882d9a051865194b, 0x93db29ef85e1fc6b, 0x6bc27e98,
+0x861e3e39a5f2869, 0xff95d45a04eacf76, 0x4b913a6568c895dc, 0x3731540eab1d6f1b, 0x881ce4a6be494b19, 0xc7c1b6a6966d9ab8, 0xfbe2cd45a14ef125, 0x8d7992a4c59b5ec9, 0x1f5e9e7a45a57b27, 0x1d6803b11,
+0xfbafe9237fc45760, 0x2d7f36d2cb253446, 0x48c90c6d53a8e5da, 0x3de540ab8cee0921, 0x3cb905f3a44debe4, 0x37a63c1aa9b453c8, 0xfa429eadf505cadf, 0xd79d161514f3804f, 0x87575838eaaf217, 0x18b0b82a1,
+0x869060becfe8686d, 0xe35e8580408d127e, 0x71cee8a64893dadd, 0xea9e2b0707965c63, 0xf239f0283b6ed11d, 0x9b37e60b45ea4e13, 0xa29f9210869a9fc7, 0xad97c843c51b1cbc, 0x52501c3bcf42b479, 0x1d3107629,
+0xbf4814fd4f1a35d7, 0xe49f6e5f7e77de62, 0x42b5ffc6814c8c2, 0xae5f18f769e2f891, 0x94bf9a164b3147be, 0x2774374dc3187fe8, 0x2e7b5ad1fa93a98f, 0x1c8e5806f117891d, 0x19930dbd6ab38d42, 0x14fbb626,
+0x10d195f7725d6378, 0x71519e3cc98d93b7, 0xa0e7e4718b26dbfb, 0x3ae180294456d54d, 0x1e0013a3d07fe523, 0xd15e23313c40c13e, 0x83817e85f63f602f, 0x10bcad843e10c186, 0xd0b25ff795afff57, 0x240dbe243,
+0xc600a561472b9013, 0xb3823e75ffb7cd62, 0x2a376d412dc6ed27, 0x830418c35caefa14, 0x7caf4526d47c3a92, 0x7ebd0e39f9eed16c, 0x2b304e53dbbf3529, 0x6a37196cae354719, 0xdb00b3d31caf2573, 0x1d7f30bb0,
+0xafe15b13d8c35eef, 0xd3bdafd5cafb0f1a, 0xd776856893ae8d7a, 0x33561cb3a8e0a58d, 0xe7d6d011bb8b3f8d, 0x9d49e6a3c512490a, 0xbf18e231877c3ac0, 0x3b6d30a360f1f1ee, 0x702a67e337afd84b, 0x160ac1fb1,
+0xd53ababad1551c7f, 0xfff2db98b585571f, 0xa292a8107a31f3d1, 0xa12668f6f9631e86, 0xf0a838bfe90924b2, 0x2390cf12b4ffdff7, 0x4a51ec363eb2e51b, 0x427e17f146e4e86c, 0x538b7e4c6dd95d72, 0xf6faf54,
+0x55d6fac6d75c9f3, 0x460ab540380f05c9, 0xb91fa96b92000272, 0x12434fefe1aae83, 0x10f0b3a7b39d98ac, 0xca13c9cc1cdf8a3, 0x5275bfa60e6b912, 0xc93bc14cd2a64ba5, 0x54bec8d451afca3b, 0x55dfd9e,
+0xeb54644b55b58507, 0xd9be2ca7935c27f9, 0x9335d2cc7915feea, 0x182ac62a8beecb3f, 0xf01746d7761bc2bd, 0xaf4377dfffcaf1af, 0x9c098edef2eee36a, 0x2dfd7bcd8060a8da, 0x448b120ad1f380ff, 0x85980132,
+0x375ecd001e4167b5, 0x34ce6e03e2dff3ff, 0xa40f6a9aaf7da357, 0x9b717c17348aa577, 0x1f8b732ae1f9e4d8, 0xd7d344485c29724b, 0x71d830644f674155, 0x6599ecde6954d54e, 0x5336746eaa261f3e, 0x1c5ca8af0,
+0xae45165549fe5826, 0x54c13f90fc8d02f9, 0xc0b179af8323c102, 0xc35db9ee55a969dd, 0x83993b7ec2b067fc, 0x164ebeddca2834d2, 0xc95904c4237f5986, 0x3f5e892f42183a26, 0x69bfce0cc7fb065e, 0x1c8c2c157,
+0x9a3f1102d0971f3b, 0x163bcadf97b85613, 0x25b08f2c21a2e06d, 0x2e84c4147adea4e9, 0xcd60b22ee7cf785e, 0x2e28c002eb329613, 0x553589040bd43567, 0x47016d94e02125e, 0x85a29ee85c75144d, 0x1dcfd80ef,
+0xfb8df614ad744c0e, 0x2318ee572b6a6899, 0x9a1b0c6197913773, 0x2f808c56e8ac0f67, 0xabb0a4bfb78f7fe7, 0x6dd5b39c5bfecf05, 0x427e612804880ae8, 0x4cdf53ca318291c1, 0x3edb54cc8f1e2ced, 0x203eb5f6,
+0x69f962e1ff030f0a, 0xc6289ddb7f7b4752, 0xcd86089076ae8f6e, 0x378a64c7ec2ef961, 0x645e81c6577f1ad5, 0xd60b91ae75b10b21, 0xfb7f5277504a9dd1, 0x96280d1673c49be5, 0x510fb39ab45f513e, 0x265264cd8,
+0x88f5f57ccfdc722f, 0xa220bb8d21a95769, 0xaab9fa5ed6bc9819, 0x82bdbd4c92840f75, 0x4d129b04108881e4, 0x1fae58881aa66211, 0xbd65ae05f8ff3b41, 0xe92863836ba3b740, 0x9ff08e984eda7f3c, 0x202a28d85,
+0x7f7049fc0630db53, 0xe4d8032a2b0e27b9, 0x961159f1946ccbf6, 0xe19cde48101ac41e, 0x5fcf009c69cfefe0, 0x21aec9dc10c1fa2d, 0x2d6be905d3c97a76, 0x97700d0cb9631fcf, 0x1287586fef459380, 0x26140926f,
+0x918ffd7bba7b29be, 0x489d0aef98922a6e, 0xb01a845b91a29257, 0x4d98afdd13f68965, 0x781fa33da6d16c7b, 0xea0d58a8a144c2f3, 0xd7f35e97f0b1a1ea, 0x2aabf5ac73f1915d, 0xe1ce413e81b24cfc, 0x6ac2d5ca,
+0x53927f1f335984dd, 0xfa0a66d077e83c30, 0xdbaf50857560f671, 0x7b41c8bc1742ec12, 0x82bc01db7a79f2a0, 0x1ad07fc767101531, 0xee6edae66ac864b3, 0x83c718f8e4681112, 0x85740d4f13b89dc0, 0x5f0b6f0a,
+0x7f2bad9a4163aacc, 0xad6ea86440df7296, 0x538a64beb01aa671, 0x779c9e7c7a14172c, 0x6f42fa1cdc1ebcb3, 0x22863cec8e3d388a, 0x925c5f787c6b598, 0x88401a0f01ae4aac, 0xfdc7447137c61023, 0x14dc767be,
+0x7db4a9433af6c83e, 0x21fcdb33ca766753, 0xb7e2c9a98ecd480e, 0xd79cd57353e02a8a, 0xdb1a6d43ebe73673, 0xe10247c5cf20d5cb, 0xf33348a8ffebc53b, 0x1f8769321f8b50, 0xdf784aea2ff05d4d, 0x258e51a26,
+0x7650f2d4e46d9bad, 0x7e2f7238c108f928, 0x7b3d07115dfb4d34, 0x5e28e9ccad190fa7, 0x5dad14d625b67eab, 0xb3a3bbee95bff834, 0xb5e0a39c7a65f64c, 0x2d3ae462a195cd9a, 0x2d4988bda87ee73e, 0x148d62f12,
+0x123bbd2186f857e3, 0xbafe58d06f738e99, 0xb8f26e9ccf02d9f2, 0x5c0d032abe80c623, 0x6293d8b17599717, 0x7c27e19f4e3f47e1, 0xb50b22316c6c641a, 0xaa536be3b1d1ec25, 0x5b62865f3cbda369, 0x1e8c6ce12,
+0x7b55b35c5775da28, 0x350041b21016da26, 0xeb9dcdc919489115, 0x8a409c14cd2071f6, 0xf5640d22fe2ee431, 0xa3d1c33cf70f5c2c, 0x487902d08ed8496c, 0x80c33b0dde5944f5, 0x109aff59555766, 0x1ab05c4cf,
+0xa985ec150e478afd, 0x187d082bb1f2485f, 0x22cf807fb92106a4, 0x4aeb2b4476d02d3, 0x84a14eec0b1e8d47, 0xeb45142150e35d5f, 0xc9664376355127bd, 0x7c58f2c70c722874, 0x8ef97aa1549d14e4, 0x50b0f562,
+0x9bd5a452caae467c, 0xdcf80ceeb8399dec, 0xac89e467964c9274, 0xf25bb6c226dd573a, 0x1cc1a779ba6452cf, 0x5f57e95446fa8bf0, 0xcef407c975872d8c, 0x726fbf98dbb5f479, 0x1decad8d9c2bc6b5, 0x1bc0309,
+0x991f550eb6ee2389, 0x9e245888a756f626, 0x499fd948bae1fda0, 0xebcd6700e0dc022d, 0x73dde1c1d882b0a1, 0x38b045a16272f57a, 0x26e9a39afed23a8d, 0x249a1e540dbd419f, 0x4c6bdeeed824d9aa, 0xcda8d846,
+0xc6c4f45e7b24f224, 0x7dbfab4e0f3d33d2, 0xffd30d322999f364, 0x364c62b59b2a65f9, 0x43832bf7792ed3ff, 0x32bf6d41acd9b10c, 0xb8cdab73ee84e6bd, 0x9dbfdc0c7515a9bb, 0xb514b6720e8702c6, 0x5edb401b,
+0x7ba3ef76d73964d0, 0xbafc44c8346e7f35, 0xe234ec0291e3c3f3, 0xaed545d2df38fd35, 0x38ff53a2bcfdbdb7, 0x7e1a9292f3f75fd2, 0x97baa7c7d12815e7, 0x2e645d01e15fb338, 0x862dbec5bbf51c1c, 0xaec2bd7e,
+0xc05a525455e867e8, 0xaf1d17fd297f85e0, 0xa26681c4297a1a96, 0xd423703745aed2b6, 0x6ab8d9e537d13c64, 0x8d5589e765f9b286, 0xee01fbfa91684af0, 0xedc8ce440776a508, 0xfa8fdd9b5176a383, 0x254f48b3f,
+0x80925f86d46462f2, 0x424a8c35fad5f653, 0x313b616114922f85, 0x74900b7467f111ba, 0x29e22070f0072347, 0x2b7cd392dd030457, 0x81bd41fd46c54a07, 0x8ec81908ba2471fd, 0xcf266abce4a78b50, 0x767091b5,
+0x9273c37381502534, 0xf41e843ee0ed216a, 0x1f0741f838c24e5, 0x9db0afa719d01435, 0xe6ed309e32296dff, 0xe4c1bd094e369974, 0x4f09fa162e0b75a5, 0xb39d516872e405d3, 0xde3bbaa9dcca58f4, 0x1ba42fca4,
+0xbe505976ed20dbe0, 0x398b0584b60351f3, 0xf8fa5c660e2daf9, 0x9c12d001d283dca2, 0x63c002c41101ac7b, 0x80653cf3aca6ba97, 0x7c5a2e85f73f161b, 0xdb99ca5c80849334, 0x9a494dbe2bfbcf7f, 0x1e34e8b49,
+0x12fca3b072e0ac6c, 0xdc177c3c50579187, 0xf2335a4e6943a2, 0x8ae4b1cace4a1a18, 0x7a6171342396fb94, 0xd01318d65af30229, 0x7acce9711df82062, 0xeef86d6dc6d41085, 0x7e3ad1f39a112fd, 0x1a400724c,
+0x413a4221b71f37fb, 0x50afb98f6b585e02, 0xee93c1d4115d992b, 0x63a4ae3e60f77ccc, 0x583605b9c9450d8, 0x84e8f04422a2e051, 0xc2a742143dfcbdd2, 0x69f8175c8fe054fd, 0x7c365b62216ec818, 0xf00d763,
+0x85bcfc4301989bbd, 0xf907b417356ed2be, 0x561ab1fbb325f854, 0x7eb5d490dc546c76, 0xa3526293b5dada5a, 0xd2a9f8a9f20acff5, 0x5e1d4e9cd04eb336, 0xde21cef388af39f5, 0xb2d608de09d1d2cf, 0x431b032f,
+0x5423917cab352afc, 0x1494ed40d6a56b97, 0x3d43b1829425e704, 0xc6e51d9e00c2ecbe, 0xad6a1e4da2279a99, 0x92ebb6f3cc03c3d4, 0xe304a6e1b27a20cc, 0x4851683fa2c9ee52, 0x9f8e35b2efae9f73, 0x1f2664056,
+0x880ef8ddaea1c816, 0x9a624683c4302fa5, 0x40a266ffc6d86d81, 0xfc8a92f03981a7c6, 0x9d7b6d5d2733d5c0, 0x4652ccaba5dcab42, 0x51b3c954feead531, 0x7fc1495d356119d1, 0x55cf96c01ce6afdb, 0x12d965ca9,
+0x627cedf8ecc9bc08, 0xaf2355d37655d901, 0x5fcb4b0a05c8d2fb, 0x10179b5c58fc7f6a, 0x90b50fef48d04c82, 0x8bdc0bfea98d7cce, 0x60b89dec2822d8a0, 0x40e22dfe298d9024, 0x3e7b4c8e78f94487, 0x62a20129,
+0x24c5efed50f001f7, 0x35af063e983a39f5, 0x553f2b27a355dded, 0xa68484dd301b8b0c, 0x632ebf548cc2dc3d, 0xe9bab35da6bd7aa5, 0x46ba72433c47a3c4, 0x326ac4fd1aa57a2e, 0xc59bb5a566ad4745, 0x7e1e101,
+0xa0127bd3af862008, 0x2ec2340645002289, 0x8dbecb82d0b57e5c, 0xa805b01109a01f7b, 0x90b49cbe1eaaf11f, 0x1cb02d7ecb975125, 0x31d64efe16f1860d, 0x66ec122ac9d91fec, 0x3d11a9f41b2d57a4, 0x27bd8c50b,
+0x1abee094d58dd2c6, 0xa1b9da6a54b449cf, 0x28807c185e30198a, 0x6f0940ae5b2a87c2, 0x503bb611a5880c0d, 0xa16f0ff50233e121, 0x236853fee5d24d2f, 0xebcc7760de62ae48, 0x86388361e620df97, 0x1159cbd84,
+0xc7e9771e699863b3, 0x3a7905f01c9aa88a, 0xdfe911e9e2fb8fce, 0x8c3a6b6f8b812f9a, 0xb5cf4e140c33627d, 0x987e0f231d8b7039, 0x8fe00d7e62601eff, 0x50dd145688cf2297, 0xafa8a5777e53d98e, 0x213ce919e,
+0xd3695738a9f08822, 0x2aabfa130906da71, 0xcbd14b83c8c528ad, 0x69c33fc5d9526c69, 0xa5f4f59324fee23a, 0x8adcb6fec8d3ae59, 0x2c7f9fb2e4824f10, 0x523a990ef51bab37, 0x6b29e9e5ba91861d, 0xf15b8716,
+0x5984c9f0a6d531dd, 0xf29a05d2db7811aa, 0xe519d37a1472bfbf, 0x636fc546a3567b4b, 0x5dcef5d405391e1, 0x3a5659f9b45b389a, 0x6faa65c69931138d, 0xf2232ed7cd43fa9c, 0xde865b4a20598a8b, 0x12a6ea44c,
+0x1f4751b5005d073f, 0xe5af5feca94394fa, 0x4c00abb503ddc029, 0x22823a3a36f1e58a, 0xfac39b3a9b270bed, 0x6ed11b8d4207a277, 0xdd1e760cf652c1e2, 0x5e5b858494a2b9fe, 0xba49c90c1b7bcabb, 0xd580f4dd,
+0x33fe73456994cf6a, 0x2031309b3d79187f, 0xe5485deac52cdae6, 0xee0c6db89b6348ea, 0xac4a53127f6633c, 0x65e95b96ce5633dc, 0x479774fcf3a511d8, 0xf50bfe27fd4162db, 0x7c3c55aa4849fccb, 0x5463873,
+0xfea1dd2f09bc939d, 0x945d34db96f62803, 0x314716eca55c7bf4, 0x2611b3071591c333, 0xde7d3c5e72cdc9ae, 0x89f8841f963ce3ae, 0x6cc7e7426319a74c, 0x81988a2c95e4cbd8, 0xa807cd23809f953d, 0x1935d0115,
+0x39adf9bf41ba7878, 0xcb2bdccceafff322, 0xf87d08147669fb05, 0x46619ad950d58a9, 0xbc24bf655a37a5cf, 0xa5876f6d6ddc9c57, 0x22c510a4939bc703, 0xc1531b7b1fc289f, 0x3290b369f9dc689e, 0x1629a9512,
+0xd6046ef72e8702cb, 0x3d622064fcb83138, 0xbd8747194f5e6e1b, 0xb2e531446052b5bd, 0xb2830d9616524ab9, 0xd3960a7dc40f037a, 0xf89b0a96ffffb67b, 0xfc227d0a00cd9ad5, 0x1db6585274f2513e, 0x5cf61df7,
+0xb6dfd29b61c57b89, 0x42fc40d3893d1b13, 0x1c96383a8b159412, 0x1d1cfc98bade2481, 0x3fc47ed746dc7acc, 0xd0583ce2e95985e1, 0xd93653854bcd7b7f, 0xef4ef3440f9b991c, 0xeec27b5adfafd8dc, 0x16146eed,
+0x90d14b410d3c7f8a, 0xbe5985108fc0ac48, 0xf0cfeb13bb767936, 0x92986c19161f1699, 0x1d61551ad9c02a14, 0xf9596bb789c095e3, 0x8cce592b72373d68, 0x7904e362357258e2, 0x6749ddc094ba6042, 0x6801d2c7,
+0x72f8a8e695451afe, 0x99f74e651de3e9e4, 0x48608e5f64c5cce3, 0xe02cd4ff460462de, 0xfbd79a4c3254bc76, 0x4d8350f3bce0fa57, 0x8965d1d809d2bec9, 0x69c599a9f01eb2f0, 0x897a4d80eb89ca92, 0x20e91bd5b,
+0xecbacd331c1dd066, 0xed560e78dd931bc6, 0xa9a1c45255b3f11, 0xcb6e58de2d599922, 0xa73e8f1c024e684c, 0xe8f2c0d196b01b6d, 0xe767020905868b26, 0x98babd35a5a2dd5c, 0xd859124ad9a2b335, 0x11fc49e06,
+0x1d9606d4454f1f86, 0x8a5d03d931e8f18b, 0x55d752238a4044f3, 0x93b7cff69a8ca10d, 0xe3cea34ed2e888f5, 0xc2caee7677b841ce, 0xd33560a9f0f7f4d0, 0xadbe38c1cfc1b64, 0x24cadd7aad90ad13, 0x13d21f7b9,
+0x74cbd092f9f4b614, 0x361ede8529e4fea1, 0x6565b722cf1be245, 0x6f14602cd34139d2, 0xccf97d31f79f0077, 0xa8250c1ebd0738dd, 0x61edcee5f99172f1, 0x5466f8cc45702705, 0x4912c7929834635a, 0x471bdaf5,
+0x69df80f6fdf9ef62, 0xd18f4a56ae99b765, 0xa9d86a947e4851a3, 0x59b361289c478eae, 0xcf6f18d822a58b4d, 0xe2c13f0ed4072a90, 0x33abceef0adaad43, 0xd1c55732f984fd96, 0xbc41389868e01468, 0x20d6b41d1,
+0x4b4ae44cb2396a2b, 0xfa9022cea95dcb0, 0x615491e6c186b3e8, 0x95b15cc3522c36d1, 0xe7548c75a8b6455f, 0xb4444ac2f843cc05, 0x92578809125afc2e, 0xd4c11b247c01239, 0xd5daa0b124dde470, 0x22f2bed8,
+0x25b65502b13ed275, 0xa41d0d07dc4e2151, 0x246618e06ff2688a, 0x293b769ef63ddb51, 0xa8b7d221eef2e287, 0x89647e3cbe340aaa, 0x73f70c58c2dc88fe, 0x2b5357f0795c6a5e, 0x7b70a5c385dcc95a, 0x4538f6b0,
+0x545739c38654e57, 0x78285993baa8efe4, 0xbf430871bd809f2c, 0x57d4a0f7e2e0ca51, 0x1279ba761f871d15, 0xb1675624f172cc32, 0x1b2cc8dcaac284bb, 0xaffcf5feb1d847b1, 0xc23f2cdac9d2c871, 0x247c9481d,
+0x270b505473fb6336, 0x97fa3566ed8a5044, 0x93e30e3982286b95, 0xb7562f2a42dade15, 0x3ea27bb016f7548f, 0xb0ccccc2a1ef710b, 0xafd28feea1a199dc, 0xcc62ccb47147c6f1, 0x9f815ea5d4555d51, 0x269505749,
+0x68220fb79c5a5cf0, 0x727e43d240672069, 0x1ffae9ed924db8e6, 0xaabe08ee2e53e7aa, 0xfb584752129b98a6, 0x299eb7a09d28bc1d, 0x77e33b17a5796e6f, 0x61fc020138603eca, 0x7b0b35f24794b18d, 0x27b30d9ca,
+0xf740e88ee09b3ea8, 0x601ffb8bfa81b0e0, 0x9a7e78d6a3dc38c8, 0xf3f3b62b867facb5, 0x30defdfd574998d1, 0x587d4a39f5d37e25, 0xb7781625e0619270, 0xe54b7d7d9495349e, 0x7929fd43f68d0da2, 0x1e7b09819,
+0x90656a3cd4b22be6, 0xd5951986257a2606, 0xca7d4abef6fe31a, 0x20e82fa2d0be755c, 0xe084df355550f56b, 0x2b865c6c7b54de2b, 0xf460d2ed7aecfe3, 0x3dee11852e103937, 0x18536218900823d, 0x19739d98a,
+0xee4023cbfce5cfc0, 0x3603fb4b01d00bc8, 0x43e52bc80a4f18a5, 0x9e839f488f63d4ff, 0xd2048da12e4c629e, 0xd012731e70fa5fd3, 0x36ae0601247a4d09, 0x409108745df6c511, 0x31728f2b69184956, 0x2013e4c3f,
+0xcf961d3a99da8b1e, 0xd4ba105b0a4b81b3, 0xd88a466f2e803fd2, 0xfbdabe72caf9543e, 0xd90fd82d2c1bb170, 0x514e530b92fa91da, 0xba4bfd3eae849605, 0x4bc798e6d3b712a2, 0xeba97333adcbcdf1, 0x19a4959db,
+0x786541588fc11e68, 0x25de13f0078b9dc1, 0x4ded147adf0fb4f4, 0x4555e0b6990fe31b, 0x3434ff8a7dacb6e4, 0x787455b5c3a1040b, 0x8288ec928a49fac3, 0x9f482a4330c97b5f, 0x82811e8126784f86, 0x1eb2e6ffd,
+0x28972a9aae63a8dc, 0xc5cd6edac081f437, 0xe8f03122bafc1212, 0xb1766936b26d4b02, 0xf1367abd7c0315cd, 0x377c858b1ca642ad, 0x8b9528abfa23e024, 0x45047ec19e436c15, 0x6044e7842efac486, 0x214b73603,
+0x5505286569a584e5, 0x97063b9e634b4914, 0x41e473f18d65cb32, 0x27eeaaa652d9ebb0, 0x94dd4368a2c12785, 0x8dd4028583b9ab67, 0x1e9e49c2e465727b, 0xadb34f5f2519b7ae, 0x3063592324a993ed, 0xc15a7d04,
+0x831b8fd0a031e99a, 0xd631df1cb640e62d, 0x271528a1bd3dadee, 0x209288c55f9a9a70, 0xc87f4753295bb7de, 0x18719c658589b2b5, 0x5d379d289de75fd, 0xc8be348f69fa183e, 0xbb6cf165a56d33be, 0x7464c11c,
+0x164e8355f78e747c, 0x4678652965bad912, 0x9f574e5b2fdc9f40, 0x76e199813657d035, 0x77c1cb169595302a, 0x6dd63e46396e552d, 0xf5cb620e22abb284, 0x46311abd50340c, 0x782fb914662adf12, 0x45a66148,
+0x94208958b323fad4, 0xdc0616a252087686, 0x9c23842f84bf1954, 0xb7cd1cc8d755fa73, 0xd93c759bc59c44a9, 0x8c26bb1b2fbaab7c, 0xb65f0361e3866f0, 0x81ae0488f7a75334, 0xcd1d77e242bca35c, 0x1bdd1d0bd,
+0xa621505cdbca1fa, 0xaec504a7b9f1edfe, 0x7b1522b714e4fee7, 0xb8749ec60516dde6, 0xc99637a5f26fb444, 0x3fa4fae81c3ed5a0, 0x9ccf4b1c10b864a4, 0xfda7e63a783506f8, 0xcfad25df35b66688, 0x1c246dc6,
+0xd3775551620ac180, 0xa1c11be152fae4a0, 0x88fc374803a857a5, 0x76904d8b184864e0, 0x6c108cee373827ef, 0x7728ddc170f397dd, 0xb29c36215ca2b077, 0xdf5ea2dcb5013bc5, 0x4d7eeea93ac1f48b, 0xf83626cc,
+0x77e1eea56ab00de9, 0x11498f06bb0ac280, 0xab97d8f77abb636, 0x14f3992f4ad40173, 0x1b9b430cd8f9693e, 0x591aa6b626cacb7d, 0x89815a93a20d72b7, 0xd2e9864e5c295564, 0x3cee5b9e519a42b7, 0xafd73b17,
+0xd87ecd8bae6bf11d, 0x54db9e48b573ec8c, 0x70a7137c95efd1fb, 0x2dbf85ec7a79e04, 0xd374783d101f5cc4, 0x7080245b52d0b70b, 0x71e4f2133e056a54, 0xddd8a284e119f77a, 0xeee618059d46d4e, 0x1e00631a8,
+0x83abec884ce8adab, 0x982df0af0352b1f8, 0x67eabba6b0c2fdaf, 0xcbdad5b2d3f448db, 0x8afbbfaa20565dc2, 0xda5ccb030daa9185, 0xfa9d9d28c749ae5e, 0x5ccd6f8669bfe35a, 0x1b94950513f2764, 0x23147fabe,
+0x951a154d5993255f, 0xc731e45e13ad7c18, 0x4de429a7337c7054, 0xd006e8d12af68ee1, 0xf9d2205848de21d3, 0x440d3fc897ba6b6, 0x9be16248511abfd, 0xbecb9abe784dc6eb, 0x951f9c1656d399f, 0x12a1a8b47,
+0x9158c00c5bad9bbc, 0x2f5d16ece5462665, 0xb852ffa57e660e1b, 0xd46a97f502ff9ace, 0xf209c2b115f6a82d, 0xa7a31868920a143e, 0xa92a331a211bf473, 0x115800945dd322f3, 0x2a97a4fbd97e7b1e, 0x1c88b82c3,
+0xda61e72c4b07abfe, 0x530e71eee043cfea, 0xb7ffd470d18066d1, 0x358d07442b943c57, 0x45eeab6dfe6caa49, 0xc63b6555d54cfc03, 0x64ef2272cab9d1b6, 0x34b640b7321f80ba, 0x6194e206a2e479e7, 0x24fac0b65,
+0xce9afe1171acfb43, 0xd03a7f23e67575ca, 0xe3c8f01f7a83e775, 0x7eefa7cd7ac88ca0, 0xc1b506c693fa72f0, 0x13752cc3ec9e3905, 0xf147f491b11c58ab, 0x44287d5370696e91, 0x9c0c100a4a69e668, 0x10821ba23,
+0x63a34fb3753e06a, 0xdd8cbb99fd64356a, 0x34246cf90a20207e, 0x31f1c35465fa0359, 0x5fff216407de2335, 0x76d2a679f4ae1580, 0x9e598045fe2c6195, 0x81326746dca2b86e, 0x4c9d2388e28f76d0, 0x25d417d99,
+0x6279c55ca2b860bb, 0xdcc5044e36d6f6fc, 0x4f49c6d356fa6efd, 0xab2b333bc5ee85d9, 0x2d222815d1e39fea, 0x152675c456ff7cad, 0xb3e3a7ac9db13051, 0xa965df4d5eafec12, 0xf9643df56d0994cb, 0x15bf305d5,
+0x6903b486f7c8ce4, 0x5fab6dea35bb31d4, 0x9bb92b375134c736, 0xadbff645ac985d0a, 0x8818dd8bb9d30d61, 0x5f3e3ab8108ea80b, 0xd984113d138c255c, 0x5717d36cef3434c9, 0xffa6b795dacc4ac6, 0x13a80c0bc,
+0x875c859e2cb913d8, 0x2fda04a1a00db3e2, 0xae9402f6549f65d, 0x54b989000834aaa8, 0x3aaa490cf76d958c, 0x8b6ee1451582e7b4, 0x618a28449278918a, 0xbb1c9ad1a2fd1428, 0x1a1fa03d43a21a39, 0x1f55eb62d,
+0xae91013802b984ea, 0xac0dabad37452125, 0x86c0fb09721898ca, 0xea1b790e8a1782e9, 0xfc1b26fd3863a20e, 0xfe4d35fb5a837edd, 0x57cce275e383741e, 0xc209ded0dc353d81, 0x67f25e45cdfcb48f, 0x18404691d,
+0xc21e6bc23961de1, 0xa9fd8029e8af2984, 0x60a564c1b031c40d, 0x7983b5fcf2f98c9a, 0xad5c4e507eb35781, 0x428fb730a2a4e80a, 0x38deb735d31c73b9, 0x254089c38f9ab451, 0xffe0bc6d09bfabcf, 0xb3eaca3,
+0x1c210e8222786523, 0xcb5a0762f0158202, 0x4ca59d9f53e8282f, 0x9cdf5e353bf7a04f, 0xb67459397648c17c, 0x7668ea5b60c9314c, 0x7cf07becb7b0f510, 0xea09efa0c87be005, 0x6fa334ac1e78d38d, 0x917b0146,
+0x14afa46c2f300dc2, 0x20556e164fc8c4e8, 0x2d741bfc84566fa1, 0x66f957efbec86fb1, 0x75a0a56f202b9d65, 0x92cb64e4e3ee61e6, 0x7b9cd84dc779d930, 0xff8aeca77db3f5f5, 0x1bad8acf9e60e131, 0x11fc8628c,
+0x9a5a73b4c370c595, 0x9dee93efa2d17c1b, 0x70312c1b0f0dd983, 0xd83ad8390968ff4, 0x7b349bb4be8cb2f4, 0x6a0935ca61da8b15, 0xdb8d46bf1870547e, 0x1e833a3c884511ad, 0xd59060895324a8ed, 0x6eb9146b,
+0x1e73753dae170fa7, 0xf9ac98c6a2d632c4, 0x853b75797b49dd3, 0xae83b474e759d26b, 0x1c21504bd7ce0e39, 0x931fa6601085ec08, 0x4dd743ed0e7c08c7, 0x36c2fe3dd7ada423, 0xb9940cb510261f28, 0x6b803c81,
+0x8fb591b1498a4d78, 0x8645efc3ca035742, 0x1fa1bf726649c335, 0x5c61628983680c58, 0x3c31f62f14e31988, 0x7c1e59dde1227ef7, 0x1059ea9d9260e907, 0x7b5fec16f9dc8268, 0xfc00b8b95fbf9d0b, 0xf0e4d2e8,
+0xf5c3220c55dcdd1a, 0x95093deb4077890a, 0x5f1a35fa4b3a35cc, 0x91bd4ee2ca2ccae5, 0xf445a52063dd1550, 0xc9770a424538a9be, 0xbcd5466ff9bdbb9c, 0x324370c52dbc7f42, 0x2ba63a6240cf89bb, 0x11c498379,
+0x225cb6a50fc47b32, 0xad5eda5cd35751b8, 0x471d368b700b82b7, 0x2000a15d7165ad1a, 0x43d0b639544db9, 0xe32217fb60fa6f93, 0xd0b793d27bca17c4, 0x6b6ae34f79d48630, 0x8ddcda06cb1e2ebe, 0x19f2593ec,
+0x2b1fc932c79516f0, 0xd31014cea023395d, 0x6c9af547ab5ee817, 0x89c80998f2822516, 0x907423ff9c0399cd, 0xcc274e8232e616c9, 0x504fcf1b30b29824, 0xc72636050084f6f, 0xc0e80908023093c6, 0x658a7bb,
+0xc627e40f58c7be48, 0x76564f6cea01a71b, 0xc4378658bb648d08, 0x78d7fe8217740fb4, 0x8a488d53aa3fe5dd, 0xc1b0ff8c5b412afc, 0xd2beec047dd003b6, 0x9e67492076d5de47, 0x4d62ca163c781eed, 0xeadd6b1d,
+0xdb39a5240c0cad13, 0x2d7d525c9e20a13, 0x97ffc42291578a4b, 0xc5d3180c6ba04a64, 0x192ac972d4498bc1, 0xa2fab095d3ebdf43, 0xd4ac461981d8ce7c, 0x3b60b2ed754e83a8, 0xd64cb754f87a8bc3, 0x5aaf9401,
+0x39afdd0ff4bca5ce, 0x14a58685bc950ce0, 0x6d15bc82a380a7d2, 0xb784930028d56bbb, 0x98ba84259493f500, 0xe91a51b45f13fd41, 0xaba882714d594bf8, 0x1671ad7871b908c2, 0xd99e98bfd4be7bda, 0x1493db3c,
+0x8a852be2e9a06929, 0x911eb5196962532, 0xded7ec907a3841ab, 0x1f2f6d42e30df91, 0xf8cb5e44b6e3bca8, 0xc1b903af28d42c94, 0x6bfa422c8333ed81, 0x6d7b5f513cb0511b, 0xb176b4fa446296, 0x10609df51,
+0x5089d95c717d64ab, 0xc37f9481464c1298, 0x4b79c27c59f91c08, 0x18cb2779ab5ea3e, 0xa49fa59d6f39cb4f, 0x90c963442342122e, 0x5741f0a0c572abe9, 0x1ad9d0e5ff13a852, 0x348e4100f49a3208, 0x107f17ad9,
+0xf249a2613719b24a, 0xb0a6f010674c2ff7, 0xd9c06248b60d220, 0x531fed0064be7828, 0x706a361a22564383, 0x61aee42fea0ae32e, 0x7c888cf1d9e7498a, 0x2c322c14e466f2a3, 0x130de4984ce90b3f, 0x22eb2726a,
+0x44de2dfa8a0e5a11, 0x1554a976df3d0cf1, 0x3badb8742d4de871, 0xc704e43c610556e3, 0xfd4155218bb2a841, 0x6771fd2d67887f12, 0xfe4cc8770b336454, 0x14c2d02ff0f0b547, 0xe1dd5dec59d633e4, 0x727074c8,
+0x7ff8f4774be7ce2a, 0x63bd778030d122fc, 0x69c00ddfd36fa79b, 0x2ba29a119092493, 0xe597efe7e05ca7ba, 0x23507015d28a0cf9, 0xd0010b77bd61731c, 0xb548eedb2f33c829, 0x78fd61ccec52180b, 0x1edacf941,
+0x94d780fd6cb097d2, 0xab890b9b73a9ebac, 0x630e2c6194b4610a, 0xeb327dd84aed8c19, 0x8e05d8aa2cc6eb3b, 0x28da8926aad817fd, 0xd2f4d05706119728, 0xe47c4842a50b020f, 0xa7495f0bd39aa7cf, 0x2216b6fb4,
+0xe8ef78812a82f6fc, 0x4ec1e4a34b8d84cd, 0x994203b291d96296, 0x7a1e8423b9152b72, 0x6871afe298240b67, 0x3cc9f8613a8f5c1e, 0x6e5e4050b795fa52, 0x160dd36f5db5d089, 0xa18c90f65a950d0b, 0x11f320b6d,
+0x46d975d5cf4ac465, 0x4329947caf097e9a, 0xa592d22405d97bff, 0x53bdb050acc16aba, 0xd011981a82bdab21, 0x9ace34317ffe1809, 0x7506da5953fda7b9, 0xaec5763b236a02b0, 0xd7fe3b9c2a248deb, 0x1c43a7a74,
+0x76aee0c07b7ea517, 0xf3ee2a2a87d20abf, 0x7917f999d541783f, 0x9c7a6c1c8d9f2d51, 0xfc3db1886b850ee, 0xad89be7ea4b183ed, 0x77bab1aa10c6febd, 0x958bfa2a5f75c710, 0x50e2588921eae850, 0x267463254,
+0xe064b58e839e0b7f, 0x9af66eea1f604a27, 0xd53542d1dd755e94, 0x73a9b6c809782100, 0xc5acbfd053670aa1, 0xee490d48f6fa30f2, 0xa999bc8db15f7b4a, 0x613bb9a0e88903b4, 0x9f2af5a7211fad10, 0xc8d8e2f8,
+0xd7d7ed3520f249bb, 0x64d225f1752a19f2, 0xb4f4699f98b00a1a, 0x8c0370dd0b5888c2, 0xbdb56ba804c1648, 0x95eea0f88ffe7848, 0x42d1a8e9acb48081, 0x6d14434e43fe2873, 0x26bb9b34d51080ee, 0x26506812d,
+0xc238d055f42a7197, 0x267df3eb98f33d98, 0x38987066c5e276bc, 0x326e2bb8c092dd69, 0xb61f7acffebbf1f6, 0xf722eeea434ec481, 0xf908a816fde70bc5, 0x65b02fd6d3ee8109, 0xae4d48a4cff5b363, 0x1ff281609,
+0xc9d1ff1a4e83d0d7, 0x9f799636adf4b1fe, 0x8561a83794d73b8b, 0xf454084a133913be, 0xdd8f154e80d8674b, 0xa9ed2bab16fe35c5, 0x9dd5d45c2eba2d8d, 0x8f0523b8027d7815, 0xba798b087b8b76a7, 0x1794b220b,
+0x152993e31baad62c, 0x597c3eccd81a580f, 0x8e60851a927d2378, 0x40a5081187554200, 0xb554c97601166216, 0x463dd32859f5005a, 0x9a67e785b1a9b525, 0x853828438ba97486, 0x53e77431c8220755, 0xd479ab37,
+0x20a91cc119e09088, 0xa83d03da90df5d1b, 0xe21b16c062e7ba4c, 0x98217903a047182d, 0x1d17cde09ea2f383, 0x7b38388ecbbfa369, 0x9ce0fdd6299105d4, 0x7348dbdb6cbc864c, 0x9b6c01cf6d1c43ff, 0x14a723a5e,
+0xf0def0bdd1c12838, 0xe4c37bb35d1dfccb, 0xf2464c587d56b4cb, 0xcf7a9e657b19339, 0xf0db26438afd1c7, 0x120a7074bce7393, 0x4e813bd370ed79c4, 0xbd646440e43ca1d0, 0xba26975f376b9bf2, 0x1343ebaee,
+0xa57de610346303fc, 0x11952ddadb859d2c, 0xb09945766408565b, 0x10788158dbe62774, 0xe961e67b99e053fd, 0xd00fa858b400c1d2, 0xc626e74f44f11b04, 0xfe5e06e24354b4ed, 0xeb70594edbbdd051, 0x13c492fc3,
+0x1c0494e90b0c0861, 0x9f23f7fdaf6d546a, 0xa1936ce57a5f4c10, 0x967da4deecfa5b6f, 0x2ee9ccea59a82671, 0xcd319c71e3e84610, 0x76e727e148e5a0bb, 0x9a15b6b23f72c0ea, 0x77247f6095ac3402, 0x247a20548,
+0x320823eb4ca46481, 0xc4268b676cd69f86, 0x8821d1830229beec, 0x2d552a6b0feb6788, 0x956ee19f5ccc15a3, 0xf3b4cbc621269d44, 0xb2d1f9a73eb4576b, 0xa5429f1cca54c25d, 0x83484d7e29c1a912, 0x6e555976,
+0xdf4bf211600ee36, 0x310ba4d60c26ea61, 0x9824fb5df3b14507, 0x843712d3fc854b7d, 0xf5e24802618f148b, 0xa67d22fe4ac5b292, 0xb38f97e2cedc75f1, 0xaa7c8e4fe1360493, 0x5c22448216441310, 0x1e51b5424,
+0x3ef26df54994196a, 0xc321e585caae26bc, 0x3786eccad2c711ee, 0xfed8c6645b725172, 0x9250d4e7fb5683e7, 0x8aeb608c268782d5, 0xaa30edd91190d256, 0x8b77253988b89045, 0xf6eb09352c385062, 0xf5466ab9,
+0x67faba3d13bc68ac, 0x5c1c999148ebf5ed, 0xc856663c8401a4c9, 0x50fb4908c24fe44e, 0xf45c87ad7ec92225, 0x8f943b20e70af40b, 0x88fd323004c73c6, 0x1158a7636ec55584, 0x2ec6768b16a870c4, 0x666fd424,
+0xbe089d3cd25babdd, 0x3a2213bf5c940d5a, 0x1394d6455c498a56, 0x607e0ff6e9110703, 0xf4358446e6abc22b, 0x5e59bf78505d4a2b, 0x4ff7cbd65993621, 0x930237733daf0976, 0x2e8a66350fd1811f, 0x732f1cda,
+0xe3f5a1bfba0cf55a, 0xa5c8ce626e720970, 0xe3de4195aea6bf1e, 0x4b3d9f46bd833cd, 0xd781df4996eb15b3, 0xbd6636b17f0341c, 0x8f1ee53ad2612841, 0x472400a580414724, 0xc6986dbfa2c665dc, 0x1e2519eda,
+0xc494467f4d17ea5f, 0xf695d650d587cd55, 0x73e5583357c27fcb, 0x2dc8f74e09b9e84f, 0x7057e1c8eb934e88, 0xd51c71429b7120dd, 0x5d6789760918c10b, 0xf408eeb61f16832, 0x98fad908e8278124, 0x1cf98275e,
+0x70807ae66f138fc3, 0x9d16371efc35d02c, 0xe738327cdb98557a, 0x92ec1493af414ea9, 0xedee95017b848952, 0x11f7eec467fa9ff8, 0x8fc1d133046f8b8e, 0x4546517894661ab1, 0xc3625943356f3d1a, 0x13818dc2a,
+0xaf1d927625df595b, 0xdb0d78cbb36499f0, 0xf1d9affa85147d15, 0xb91bf123ff0e6650, 0x2ad3d7417771203, 0x5ffa9f8fde0aa04a, 0xd4e42a646369f16a, 0x9c1f561378ccd44, 0x504937be51d5cb2a, 0x1e155dddb,
+0x32ec4d2b0e7ca268, 0x6a662f824b9b1f6f, 0x6bf9abd401ce7553, 0x791238334733ea6f, 0xb875e5110fc914b3, 0x6f5226c61db04a54, 0x8534ea90fbc5e08, 0xc3c993b8590543fc, 0xb858da0913ac0bc0, 0x196c863ad,
+0x52b2177f236f8cf6, 0xc0801028e43fb04e, 0x3946420ffa08ac75, 0x448ae22ae309e067, 0x40caf48ba134fe69, 0xddd8ec488aa7fcf, 0x8b9f03b58f8bbfeb, 0xa917185954eda8a2, 0xe1d54c6aeef5590a, 0xea77116f,
+0x54638b2c985b767f, 0x3e70421f91f0ecf8, 0x923134c31f79cc34, 0x25bc7e6dc0a9d374, 0x8bc9a7cffeb79b98, 0xd6bd05f3c8b947f6, 0xd1d87991a68c90e9, 0x5c278504dae51a25, 0x8c6581fffc6fdeff, 0x25488943c,
+0x8bf95fa49a82e961, 0xfba89b2eaed4f27d, 0x10a3ca0ea1a5477b, 0x27f19dcf03d6fc85, 0x9e86ec5870c84040, 0x567c31865520c9cc, 0xd014f5faf335a4b1, 0x6975fd27f3e2a599, 0x436c09c3ddf73f38, 0x2ea79389,
+0x6b534bc2985584bc, 0x4bc706267b8ed9db, 0xb1dc51f4b2576cd4, 0x158ef007dfe63aa2, 0xb70d17c4d50b7f25, 0x3631acc9ceccb6e, 0x9fb6ef84a7385db3, 0xbc74612042ab6c6c, 0x1476febb98144cfb, 0x5a5d4f2c,
+0x9fd7b8699a5905c9, 0xced7f5ebc09d0133, 0xafeb3d5fb9586a8e, 0x7fd59c1d287b0fe8, 0x925d908be1955618, 0x2c3e61a58f058ecb, 0xef98123b4aa8a75e, 0x62599217ddd07d80, 0xfe700d6455c1aa64, 0x243642e92,
+0xedbba1363e7f373c, 0x40f77ce52020d312, 0x61aa3efdcbd56aee, 0xe457a29e1ffd2903, 0xf097a1d267e74b16, 0xaa63aaa8a4b5d5bc, 0x8fe4e8f71548784, 0x17462c1c5f666b98, 0x2733d6d59f2b10ac, 0x175e1ed04,
+0xd0116d7525f93377, 0x3be5f6e598033026, 0x31f7961c1b9b2c7, 0xbb1b5b49f2bbe3a1, 0xd00dbcc46f273a62, 0x39356ac7b5b3dda9, 0xf60325aa3fc9e697, 0xd079eba7d857f73a, 0xd879bf44e61d7c3a, 0x18aefccc1,
+0x52e05cd693cbff10, 0xda0d4153cba4893d, 0xf94b8a7650525bd8, 0x337f2fe224c0f801, 0x5b064772cf0b31bf, 0xfe0bda5a4a96d8a0, 0x78adf9214d1ef38d, 0xce1960076c2fda96, 0xfb2601a54de4e81e, 0xafc31dbc,
+0x7057eca8d4554f2f, 0x814305b827fd7ba9, 0x4acf116b89662ed1, 0x283300def2728de7, 0xa8b9bc57844504cf, 0x21ff749f3f961075, 0xff9767ea71e61553, 0xfc615ab4866fea14, 0x99308dd55cfa9954, 0x124cf9ff4,
+0xb76b22984a53af2f, 0x97b66a9e9a5391e, 0x978b5ffa40465ad3, 0xc518070a4a046d57, 0x8e273c791af4ad46, 0xcbe6680725c8f62a, 0x5650aa546880a112, 0xe1f199d2987c80b5, 0x5f059f016f42bde1, 0xa4b5633e,
+0x22c509775175c4, 0x68c84fd77f745d90, 0xbebbe6abd71ebff7, 0x7da11f00a68a94cc, 0x2f83a11a603f73ab, 0xe32ff460fd028fe4, 0x1d93ea9475e1e121, 0x17e458688c26b402, 0xe9517b1de756f733, 0x70248530,
+0xf221409bc034c59b, 0xd436c4c8758ae67b, 0xb998d270ad800ecb, 0xf7e2c58bd814aa1f, 0xe265a73cfc6f921a, 0xa83ebb641eed0088, 0x2880dbaf685b7b26, 0x63ee26055500878e, 0xf3ad67559b0f2991, 0x19b7babf4,
+0x4051e61b9a0bd69f, 0xc5ca90a14bf0855b, 0x65157256f524d2ea, 0xc7ce5f92184eac6d, 0x633043a80cc1d644, 0xba5b3958870b4e2a, 0x7bffec1eea25432d, 0x2e8e28f3d43108a3, 0x38f6bfc5114413f2, 0x90113f01,
+0xe8695daafded0df1, 0xf7e509c249a6cd5c, 0x5e186554641e5b90, 0xed091515a6f53ba5, 0x879ec2dc6d33d63f, 0x50a35aac637e731c, 0xedef35014433ed69, 0xa291107f58e76282, 0x62e4b2ad1c83a01c, 0x8808b1e2,
+0x606f288b77af0def, 0x8b31e0fa19ac64cb, 0x65f1dd1f5e7e106a, 0x4ad3e08b185c8670, 0x76f3812647c01b82, 0x61be6be5f46e325d, 0x2eee2630e83c16b1, 0xc297e3681e649f37, 0x6994181c0feb8e2f, 0x158f09164,
+0x1ac4e7e3f4e0b1e, 0x2e3f1af14bad32aa, 0xbd76434002230ffd, 0xea6bf0ca65a88346, 0x461ade273586d216, 0xddbe553720a0b304, 0xd510bf69f7d164b5, 0xf556f3e3741db06e, 0x44b443f899f088b6, 0x17cddc2aa,
+0x55de7bf1a9cc537d, 0xb35b6c4f805f3ff2, 0xfb8349006a77ff0b, 0xaca807409ac43afc, 0x242504a48e5e75a1, 0xe0842fb6d5c4d38c, 0xba9aed0e505172d5, 0xc231f1d68cef1cac, 0x23d147c0a18cd245, 0xf4fbdcac,
+0x554a7853273e0845, 0x68753c62f95a326c, 0xe50f36f13005a8e7, 0xae0e55f9057969e2, 0xe2e78080dfba44cc, 0xbea3b22466d7f799, 0xfe408cdf6dc55bde, 0x7aaee969f339a857, 0xcccb82050936d1f3, 0x1662dc8b9,
+0xdee0e6cdd3aab5a3, 0x9f304598af70390c, 0x9b35c6a74b9f3821, 0x656c47703f739b34, 0xa7bcda700dc32449, 0x709a1f3b53de037f, 0xa4d634633bfbb9b1, 0xe436b0a09089b2f8, 0x4c9fd46948ca83b3, 0x154fe1c7d,
+0xd6e1dd0282d4acd3, 0xc7d9c74d6d76af6e, 0x2a167e84602c027b, 0xbc61de68a4ded2ab, 0xbd80c3a8837a9d42, 0x3176735a9b188774, 0x83821f833ecd403d, 0xa08e2868065406a5, 0x9aee05c00e92da89, 0x503c871b,
+0x122e673aa34d675a, 0x69f4bc4a25883632, 0xe60d1ecc0fcf7fa2, 0x813bb8e199c1f368, 0x838daee6a04e039b, 0x30aec55ee0efa144, 0xed670eb98bab7962, 0x7af18989d770e99e, 0xe77178b5bccd19b6, 0x258110a5a,
+0x1887d38552b32ace, 0x9271c2dab949393f, 0x5c419311b0bc44d2, 0x51f034f39726e399, 0xafda2496b69e53f3, 0x1592d52b09927c15, 0x54a0205b607682e9, 0xf59588c08f739dcd, 0x3c8fee6f5f53fd35, 0x18607b576,
+0x795efdecae1974d2, 0xaa3f2e7df653c1eb, 0xd26142842d4157a5, 0x35f1594d0f1dccf7, 0x1552c5863c11923a, 0xbdddb6f9d85288a5, 0xb3beabde2eb71174, 0x6410c4fc3d3861a8, 0xa1fb67b2b6136bdd, 0x23fe00d70,
+0x17304202f5733466, 0x90dd1bcdfafedae1, 0x9ad8ee73c599e68d, 0xc2fb68cd2bff9dc8, 0x417aac93fa48a42, 0x5299d1fe353335b9, 0x75c0269d62f73d25, 0x868b46a97b4790a7, 0xd5414d81676af255, 0xdb3d870,
+0xbb0fd9a540cb02f6, 0xfc80a91aa35f53ad, 0xb26139cbf3af6c9a, 0xf1162a020657b486, 0x203182faa753ffa2, 0xb21908b226d2a878, 0x506876f6798ea8f1, 0x9008b7f575d4ed28, 0x24e59da2806d34c0, 0xa6c4b5f1,
+0x51040d9ba1872ece, 0x346cf771da55575e, 0xdcd8270862e7212b, 0x63daad16e3ad39e7, 0xb7751a573d86de38, 0x1f98657306dc8d8b, 0xd3322685a5b5ad42, 0xf3bcc33660c54e7c, 0xc4e3c37537e412a4, 0x1bd6da4bb,
+0xa1b7577a6e8324ef, 0xd034b827f0b1baeb, 0x25ed75f581ad8bbb, 0xae19a41c14b4b934, 0x201024e3551186d4, 0x70cd8f941b0fabfa, 0xdf6cdf1a8f1c8439, 0xed1b7cdd0dbcc1f1, 0xc877a5b87e606f7c, 0x218a877c8,
+0x7d98619beaaf7f69, 0xc66ce882e59ebc6e, 0xd08c6a1627a161ce, 0xb80221f2d2240786, 0x4bd19ec519fa4d7b, 0x1b2b2a0c3e69ad08, 0xbaefd8dab4d7e881, 0xf9912adb5d20266a, 0xb5d1bbef7a08bb4d, 0x10a101fcb,
+0x6a78313ce3239aaf, 0xd8c896b426492d79, 0x76b481de165cc948, 0x1215b59af7939b36, 0x6c8e3dac51206eae, 0x1e9ff28dfadb294, 0x3a1a639a6cd2db73, 0x53ce303f26af8a51, 0x428a2daaf15984e0, 0x276428491,
+0xfa67051772911b15, 0xe78c8d05eba67e7f, 0x61785ecaa6700cb6, 0x1ae023cfacc22772, 0x71ac373ae3dccb4b, 0xaf21d971b8d901d6, 0xb1d4628ff44901bc, 0x8e4771a31a4e1278, 0x9550d013e254169a, 0x22b11881c,
+0x8d44057fc6cc0985, 0x3ee1a31b1f075852, 0x2534d7b6d135988b, 0x7d1be429b6e1abec, 0x8411ee86ace393a0, 0x8839dccc6e7822a2, 0x9871475fa06e9f80, 0x289e522371c0f109, 0x29bc54c8fa73b221, 0x2120d487e,
+0xbfc52771bda9ac1b, 0x34bc698717390ecc, 0xd39c490055bedfbf, 0x2ea5b63898cde661, 0x376c351450922caa, 0x1fad0009eafc7601, 0x9b299a109b4a25dc, 0xf3c5c650f1eee031, 0xdb785959c9aaf93c, 0xcdb411e1,
+0x9a3208aff3cdf4ad, 0xe42122c05b453b13, 0x820b62fe042fa8a0, 0x7aa5e58d5f77b628, 0x7a0190dc88e69898, 0xadd262192c40c691, 0xb08bd9e5518cfd63, 0x7e105196e8761192, 0x461908dbf3c565cf, 0x23b0dbae9,
+0xdd5f63be93129bf8, 0xcc54d2de864dcf9a, 0xdf77c6f0c8a313a9, 0x1fa5fd355951957a, 0x596b21a8968048bc, 0x719382f8c40a5c51, 0x15b6bcae711fccc8, 0xbeacad0c1d6d2cc1, 0x5e29d9210ad24838, 0x23ecc41d1,
+0x26ffaacb7e6f98c4, 0x216fba77fbc8f073, 0x943ee7114d0b1ba3, 0xfcd0e0b2abfe1b69, 0x425740ee362eadc6, 0xe4eb3f881b8f72b3, 0xe2970671c73c7567, 0xb9b636cae162e036, 0xc91cc59418db0719, 0x223ba560e,
+0x24063e5208fd7532, 0xcaec4970fcc6d56, 0x2887cb711653c459, 0xbd77b34a886cf6fb, 0xc00c2f219a5742b2, 0x8aef17749fed1983, 0x7bf991fe6717c071, 0xe579eb6f174e4e8e, 0x5a27b861bf140df2, 0x218a3a595,
+0x931f8996d35c8cc8, 0x5647e7145a4913b8, 0x552879084f7bb98f, 0xc95b19c904440b2c, 0xa88341a3b2e8fe3c, 0x91501b4db5288705, 0x7c67a599714270d6, 0x98bca87c8c64b13f, 0x7278d28915666c57, 0x19a524281,
+0xf4bf0fd61b4ad7bf, 0x9a9ba976e59bcf03, 0xf1f523917ada049c, 0xae319b2b0b55c4d6, 0xa5e416e30c1f55db, 0x490e7cd6c7697229, 0x266f302e30d2cf5b, 0xd8a0bdaa0a5afebe, 0x1e2584df87767dd5, 0xc07f39bf,
+0xae8e9a369eab709e, 0x2303ff7260121f8e, 0x6c71c1f8444d198d, 0xd8b281ffb51d16de, 0x387b0c3cc7a201be, 0xcf1d385ddc5949fa, 0x8ff89dc330dbef9c, 0xe7451dc20f56838f, 0x116c69d5b76b12eb, 0x1f7077eeb,
+0x4fbfd03d79a52a2c, 0x3c49c0dd8d40ff20, 0xf0ed8574cab6bb63, 0xcf683eea14c832c6, 0x2c561290f4782fca, 0x751a39bdf31a9312, 0xfca1830a56ed5e0a, 0x1d65441460026e93, 0x1f190e83be6554b2, 0x24e36f712,
+0xbeb35f807fc09ba, 0xae247ecec6f9107c, 0x9336698cfb91d3ef, 0xc0bec459f598a330, 0x36a503f70543cdf2, 0xe487b6eb4747c78f, 0xa45b29f3cb85d273, 0xd384367bf2d2fed6, 0x7b57c5ab6c23bcaf, 0x1f6e7d60d,
+0x4d632d2b1699840c, 0x172895c05c716968, 0x1c103879b9d51656, 0x9e79d72614b78b34, 0xd211432b3c241579, 0x944e9e0076d3b161, 0xa568c66e177e87c5, 0x1e25489bdd21c74, 0x73c302765b91b9bb, 0xc0c5c933,
+0xb8591c832a89c314, 0xf7c042f2df1b62, 0x6094ef7b2620174f, 0xc8bc2861039141c6, 0x430618bef8f78e6a, 0x50c4b29b150facb3, 0xee0605c6a191c87e, 0x9304ef6f35c5c71b, 0x58753689b7fea904, 0x231489db,
+0x7bcdc580af47c7ab, 0x12d903f0b2ab443c, 0xef094a6c21f50afd, 0xa786587c01866800, 0x2c7266166626b40b, 0x33922e8cb65da904, 0x17e6582b5070e6f2, 0x10d561f8ff8e4a36, 0x60aa0fd7992257c2, 0xdf6ef78b,
+0x85c2eae6523e77e2, 0x3db7a8949795cd02, 0xe09557f7769811f1, 0xfdf7683e5e3ce9a8, 0x38ba402898fee463, 0x22d54957f529d4ef, 0xeba08ba4ff60e2d8, 0x9a679155476dfc77, 0x4a97247ec66b68ff, 0xd604f0e1,
+0x9ba34b249c60cc36, 0x4d84e1f19835d616, 0x66a20084d3f32844, 0x7ccb556a5ea0f631, 0x785a4138070d3a95, 0x360059d5a6338ddd, 0xc17b7af0264a9300, 0xedd3da30549a77c8, 0xfc4780abceb50c10, 0x227c3dc90,
+0x3128e0ddadd18a23, 0x3b952e7cb7a6c065, 0xe107d54d686e9005, 0x153447e218f61198, 0x3fd7810eb91fd2da, 0xea6b3a5a17e97fdd, 0x9649b55e124f2b03, 0xf61403c63796fea0, 0x7dbe9200b5af20e, 0x17865cf96,
+0x630e500707eb82b3, 0xaf328783f3e1ea9a, 0x111f17d8896f83de, 0xddc6899c81e9184c, 0x4ff3aedbd2c43545, 0xb431b92740e22da, 0x7eba14eb5f0097b, 0x1c26120f815f65df, 0x4bb33a0edc26f788, 0x8bfddcdf,
+0x17d496b13865b89b, 0xdfbf9aeb09d81868, 0x372e450f50cf2b4e, 0x406b3c6c5e233626, 0x33fec964d67ed9c8, 0xc2b0b5ffa7a7788d, 0x1d999934603bab8a, 0x67cea06f666c1665, 0xc6a5216971003750, 0x1abfbf76f,
+0x27df189c36241ed6, 0x920247225e7624ce, 0xac29f84e5d9c2860, 0xe0b2ef56ebfb9260, 0x2b238e401e0e3288, 0x9c25fe80f75d78e2, 0x6972846009ae96b9, 0x8d9f308782dae300, 0x962f5b934600a47a, 0x24cfe8db8,
+0x46a5eaa10ecaf15, 0xe4151ca08091a7b0, 0xb5d2b0d63b04f2d1, 0x4a57539502f52b33, 0xc07253daa68c99ce, 0xca585b007a0317b1, 0x68da52821e92a70, 0xe52aa7f33714afe, 0xd7c7d471b843cab6, 0x1c5378ac0,
+0x85bb78d52143df8, 0xb95af42bec047a0d, 0xfc7dd2b3ba9229e4, 0x44122088f81aaade, 0xcafeba4bca79c750, 0x8c535e833fbe9c69, 0x34c1222388193152, 0x3284a44ea5309e9b, 0x5d7f31a36d2f63b2, 0x8df0702e,
+0x47115f6a0a87026e, 0x9ee95514adfe3357, 0xc9936202facf7e32, 0x8bb92e6888918d2a, 0xf79cd05b6f3ec36f, 0x8b171dc00df64616, 0x3f457716552b1169, 0xcdb05cdaf6ac72fe, 0x47997d1108a5e074, 0xdeb19a94,
+0x3978ae812674d9ac, 0x659505a27ab04d1b, 0xb6bac0d0db9e6a30, 0xfb280f7f4a05e31f, 0x73839b7afd0e6665, 0x271a1d0d182c5e74, 0x3a85f041abfac045, 0xd4feb73b8b8c506b, 0xf1872674ad6ca305, 0x57a2d65b,
+0x9e9209f697bbda51, 0x1c3c50369c6865bc, 0xfa195e5476830005, 0x1a1facb0a3818396, 0xf51bafe5710c73ca, 0x739c2285ed7cb095, 0x19bafc827c8562cb, 0xefc01728f60ec250, 0x885408dc31cf061, 0x23caab328,
+0xb7939b87d608e2b8, 0x44bb18cbc7d69ad9, 0xd8f88e039720b66a, 0x5ec133073493524, 0x4fcf3ed92dfdaa89, 0xda2903f7fd89b9c8, 0x2dd5aabb053575e5, 0x2f2c2babc261e87a, 0x629f10abeb7bcf8c, 0x210985db6,
+0x36121378e26c378, 0x66aca2045cb638ac, 0xcefb6bdac9023f26, 0x891d9e23bff4aa65, 0x47b08106525e8e6, 0x6f0d92d78768154, 0xb9a2d522cf1f094b, 0x11699a2467316fab, 0x84b662aa396757fe, 0x10cf28eff,
+0xd33944c1f7c53410, 0x7609bbbaaedf37aa, 0xf4ebc086c947932a, 0x7f24c079dfcafd76, 0x861f18fdb86d05b3, 0xa362db05b03960e7, 0xf9ea45694be32070, 0xf99a638f060e0544, 0xe3eb7e4f4390ea41, 0x1c37a8e3c,
+0x13bf17edeaaf0cf4, 0x3004c688962ed941, 0x9ab52724f0b286ad, 0x87f8f0fa2b29e77c, 0x5d135c1c873e06ca, 0xbb07f5e480edabe7, 0x6b739733db559853, 0xbd1ee9d122030416, 0xc70ced60f2e648d, 0x25073cd85,
+0xe6bb1cd1d86313e2, 0xf3bd215c7f5656f8, 0x1bde7d5cf90e63ed, 0x5cbe6531adf07da, 0x9f7183e0c8704865, 0xba2429cc21ff5e8c, 0x96886fc8a83d4396, 0x54f162bd65eba499, 0xfb0cc36b2ceac3a9, 0x1ba825a57,
+0x2c6d037ceb09100f, 0x512020479be8da3b, 0x7dca979e9cbaa567, 0xb3538903961d0c5, 0x97d160c04d963abd, 0x31f0d42f4d64b381, 0x11a0da9969dddd86, 0x9b916731c18c8771, 0x6e785c9ef0009e63, 0x1f6b9364,
+0x50ddfaa4ebf816e1, 0x87d435e636c1a01c, 0x385d26b2b2bdc6fc, 0xf2bf4b9657079d1a, 0xe5c7dacb664a2e5d, 0x159a37717511d589, 0xdeeafb2dd45f272b, 0x699b066df1a32d46, 0xa8f96e97028085d8, 0x1c972bd75,
+0x9827e126fcff3641, 0x1850174a4ddd44c9, 0x5fd99c21e50ba180, 0xed62357bed328d1c, 0x8a922bab96672e2a, 0xb5b03e1f47b1756b, 0xb0dba2f8f753166b, 0x664bbac415fa141e, 0x7e189b40fd58c1ce, 0x34fa117c,
+0x87aecefdff18e3e2, 0x3e1c06fddc3f2e94, 0x6abf25d30b5de102, 0x71bc8d6ad8b2a535, 0x32305846819cf10, 0xb858f40adf75847e, 0x98943d8972f564a7, 0x6fca9c900336326d, 0x99075c7caec13847, 0x1968d54c3,
+0x4f2f6763baf885b3, 0x3df6b3c7c5292408, 0x9e8863616072edf3, 0x97e0b0669c96d532, 0x1a6c53d38ae8ff5c, 0xe03b05738c4d1fc3, 0x4f41c119d0833a5e, 0xb1c241254a842d16, 0xe57dc85dfb9f544d, 0x233296f5f,
+0xdf303358c6f62078, 0x50a34c2236ad0832, 0x89ff8751aa17b065, 0x2b6b0b1c09be4a02, 0x4c549f18e60e9999, 0xcfd085556a7ed49a, 0x6671693b22c96dfc, 0x4cdd534d9877b862, 0x3d494f4ddd431a1, 0x239fc97e5,
+0xa89fd0d88b3a2b98, 0x856fd73f7473ee82, 0x7c2457ef6d48f17d, 0x17b5813fbad5c12e, 0xad24f9a5c82bae56, 0xbd6dae9c710c6138, 0xcc00705247d01ac0, 0xd2d035197290a330, 0x818595d852e1c808, 0x7f14bf31,
+0x92c4eac5c1de58d5, 0xeafdb8c6de704994, 0x5cf6e1986480e340, 0x3eb082eddbb81798, 0x80276fa8e65927e1, 0x64a1016fc3a63aa1, 0xb06ae24ea1b8fc1c, 0x6593f6e344a8ad8, 0xc9ddaae4fa7e1678, 0x18121bc6f,
+0x669165e45a6339e3, 0x6578d213c4f31c7, 0xe22723f0f3e8f312, 0x13836de05803b8aa, 0xa5b996b7de7a3b51, 0x2e412b3f6a7a0467, 0x6b487cf0f88946f2, 0x3a1b0dad8d054bd9, 0xed0ec2e195478c31, 0x12fe81215,
+0xfc1ae5e86282870c, 0x5166f5676db44d56, 0xba614ce2c8f4d34c, 0xda40342e7dc32b59, 0x7acc840a9b1cb68f, 0x2f2f15ef0dcb39e9, 0x90673c915c593243, 0x213fb33cf2547f0e, 0xdb0cfa4040eac121, 0xd0f960f5,
+0xd53ae26ba658ce7e, 0x839601faffdecf3a, 0x86612259aa431879, 0xdc325ad4b8cdcb56, 0x6b83d3e774d7c6a9, 0x13019c32d65449aa, 0x93e87aa0579cdd7d, 0xf48c8b7f9b82cccc, 0xf819d01471d58ed7, 0xcd208d9c,
+0xfd8591b1a906dc57, 0xb7bee708c3c3884a, 0xa9594a41e733e67c, 0xaace073abbb33019, 0x41615469d994aefb, 0x196c5a13e8d55644, 0x9dddf214ab26d117, 0x85f5b43cc5681c1c, 0x44692c0806ca9926, 0xdc9eb53f,
+0x9f17fd8bab328da3, 0xbc3c6d85d40968dc, 0x70529c9a9985155e, 0x4de843480bc6ad15, 0x78599a2ee863b233, 0x8914f135e0e42079, 0xb102b3abd94bf96d, 0x137092db3941bf2d, 0x589417da65c4ed4c, 0x227a66812,
+0x35092a02ee887223, 0x254c02841440d0e6, 0xff189b199e7c2194, 0xb79e2b88c71d2e9c, 0x61da402251d7b029, 0x6fc4cfcfe9c2eaf6, 0xc99958bf50312828, 0x1b66d2d98996fe0a, 0xdf671c51257e8606, 0x22355fc64,
+0x80279209ec16f9f, 0xeabfba2909abf47f, 0xcc843465044db609, 0xcdad64aa8f3e67e, 0xa76a816ae0e70545, 0xd855b09febe4c095, 0x1226267863ddcdff, 0x9097282d5f7a011c, 0x34f0f5bd2b682523, 0x1c0077280,
+0x1057ed6c7880c174, 0xc695c03aee8db96d, 0x7dd378ad9af30f76, 0x9f4c5d556ac5af61, 0x5c13aeb65d24b485, 0xc2f0bff926858655, 0x214dc0dad95a36f9, 0xfa121b141c40d81c, 0xc293e7016ca95e04, 0xd13c8820,
+0xabcb72568d5a933b, 0xdb8d8c883de6f012, 0x8811a56695f7ed50, 0x391852548972689c, 0x5079bf4df223d642, 0x63764599c888b553, 0x229e50e07cffaf6f, 0x92a8307069307dfa, 0x92a2fc3fc6d46046, 0x100fe24a5,
+0x7ce87a4c343a2bba, 0x8a150bdf56048ac3, 0x262eeb1d11d2174e, 0x74ee6231ebc03f47, 0x3eab2bcf445817ce, 0x5a0eaa74c99e5ef9, 0x551428762a41d3ca, 0x116e03dc044cd27c, 0x50ba3caa3df0d0ec, 0x277466e78,
+0xde8cada0ac54040e, 0x7cfa25282f927f3e, 0x4230583057264fa6, 0xf7c4c55be4e225f9, 0x5787b7e34a951223, 0x79aa9b565d3a5c19, 0x9491d1a714cbf4f8, 0x7d41f12da62b2927, 0xe7f8ddee3135558e, 0x2025c7bfc,
+0x688832a0f2866022, 0xb5d187601611753b, 0xec3dab186369aefc, 0xfd3e79bbaf1037a7, 0x8b2e7c1bf20ba2f8, 0x6f74dff4e2150178, 0x885d9ffddb0b4f8b, 0xa831097dc81bcfb9, 0xd04a7c292f11cc84, 0x176267bb7,
+0x3d7e2bbf903b0758, 0xee4476a2c3d42074, 0x74a49bccbc67a40a, 0xc0c41cc7bf985d11, 0xcaf92e3bb7327956, 0x1b3b9679701ef822, 0xed5c5558ecf4c1e9, 0x2c10baca0f9d6ac9, 0x33b20ae2ab1e71db, 0x21d1f7dbc,
+0xf5c34028cdcd9007, 0xfe86a8105d13f574, 0x75a69c5077358ca, 0x49dff8818947c2cd, 0xcb1a395d677562d5, 0x216b00bf6d6bc153, 0xe47ee948571e5499, 0x150156980096b9f3, 0x7edb5f01fcf20110, 0x1d519b86a,
+0xd30089f3f14bd475, 0x1fdbaca3d14af12c, 0x87e49d9be8fe3da4, 0xf2d18d2be8acae5d, 0xcee2f892f0f39c35, 0x660b62f277199da2, 0xae81200159676c32, 0xe5a92fe000040612, 0x1cb4291c5b724c93, 0xb2674427,
+0xc337d4d2cc2c27f3, 0x78bffe56fae214f7, 0x620b592c3ae1f495, 0x4be6e715b9dcd103, 0xed55dbf9ce399b22, 0x789721382093b12f, 0x20d69eac3518d7eb, 0x6b7b160d06230cb0, 0x8054853ae1125193, 0x247a48c1f,
+0xab8f8ce70b61803d, 0x66b0743d9b6fecba, 0x4bd5f5bb2ee173b9, 0x567b5e54b048a3b4, 0x49a322e7b764a0e3, 0xdfd69086dac2ead, 0x5a37316ee55801b3, 0xd626a23fc0e041b8, 0x1839e9a5142b77f7, 0x2409653a0,
+0xba63593bed5cbaab, 0xb38a48c6ab7a4be, 0xd83193c9a7af6e7d, 0xb1a910dd277a2dd7, 0x87c71435679ff43c, 0x8ddbcc400332b8a9, 0x1b06d71a6532147b, 0x7e17a3ce35147d15, 0xf1f21043240698e4, 0xa4c32673,
+0xf55be75170be9359, 0x8f6ca82fd3e4c873, 0xdcfbc60b7328210a, 0x90539121ac94919a, 0xc1269ad5f80ba391, 0xcc28cb8a40a2316a, 0x5b66e931f5f53750, 0xc042d486489ee7fe, 0x697f71ed2676ccdd, 0x1be9db52e,
+0x370e153c8f24fb85, 0x87158b365f5779bf, 0x5d72744a9ff29d9e, 0xf5c43c4e6a38bbfb, 0x3ccc94eed397532c, 0xce340466155774d6, 0x8e6705630623216c, 0xa4d6892efe69d15a, 0xfaa31394a3f97252, 0x13c485401,
+0xd8da8d35d4b52458, 0xf4abac582324ef72, 0xe10fd7716210a040, 0x9bd84b138a711e8d, 0x39f71eecb82ac17b, 0x68e4125e158515a, 0x5204d5e9c583894c, 0xf7acf63afb866c38, 0x9f8897323313514e, 0x2aedbc8,
+0x337e9b68cd2d39b1, 0x6fce84b93a0f0090, 0xbaadb8fad2cc5e86, 0xb298d177b4971c4d, 0x66c618455430ca9d, 0xf1a9f569e72b63d4, 0x8492b8b43b0adc0, 0xbda4c2f9b9aab3b8, 0xa2a9a1acfd0b8f0a, 0x1700f8f7d,
+0x5be15cb938ea9cf7, 0xa2f29ef7c77169e9, 0x82176c8707b639fb, 0x482e398ed9fc3760, 0x16baa51c94310ecb, 0xcf751c3cf4ce4113, 0x399f76048c6022c9, 0x7f850be9caa0a94c, 0x7100d4ecb6bf901f, 0x1ed4b624a,
+0x3a49d27c96812f48, 0xc144c195ff18e70e, 0xeecdf349e40a7288, 0xfae48a39fb94ace4, 0x7293388104584bce, 0x84fadd0ba70b2516, 0x881df9dc7024c3a0, 0x478abde0458b72c, 0x81041c483332f322, 0x219fe091b,
+0x67a7e763a238920e, 0xfd08f2d176a92b24, 0x368dff2116f75c5f, 0xe3d6d6be003dcb16, 0xd6f56c77b8457cbf, 0x1adf58ff5980ace1, 0x5ff3afc99520e49, 0x503e4842abaead2a, 0xd5b15c6c395106e1, 0x61f4bf60,
+0x404a79a6a996186b, 0x97b32b97e3a145c9, 0xccf0ee32e9697e31, 0xa210491da1fa2c6d, 0x293726010e871bb7, 0x3827b0fab32aab27, 0x7642a9b44a697ea8, 0x2d1273bcbf9c1a0, 0xdb546bf99c9afcaa, 0x261a785e6,
+0x3630cf896dd58b5c, 0x661a5fd70548d688, 0x82faf890613e75d1, 0x81a8c41c0e53f1d3, 0x474105d55589111e, 0x32de2451f9debd05, 0x53a2fc17688a36fa, 0x17274820c4320652, 0xe5186e751f147601, 0x19a98a56f,
+0x1ed0c0fec54868ea, 0x5ca0e18b5735e3e8, 0x1df05a233354ee7b, 0x20e28670f41710df, 0x37b46605da27b69f, 0x2f5fbf31292f762f, 0xcb8f0bb1e9a42c7a, 0x16fdc4d0febfa1c7, 0x16dce49869af40ce, 0x1fe869bd,
+0x1c3510219d3a2139, 0xc98b34167761df2e, 0x3de01caef3c266be, 0x4dc09537e945c355, 0xc6b6b777f45e6be9, 0xcc921cefcc987de9, 0xa18ccf8d61a6ff16, 0x57bb914ecaee0820, 0x4073f1a7cd01c739, 0x3b07dc82,
+0x217412254e587774, 0x31324f3054ab254a, 0xdbd4369b789e1f60, 0x683774c2203f9611, 0x713016a8eae64352, 0x8fa14bfbe87251a6, 0x64bcbdefb93c2d06, 0x7f6197f1f41616ec, 0x1f0bebaf10604ff2, 0x244e6aa3f,
+0x9cba19049f864f0d, 0x7995ceda236902fc, 0xf9da84c41bfb1c3f, 0x8d23b658facba9b4, 0x66582b2ff78f0553, 0xdb85e0e758860b32, 0x38f61f65e9d05cce, 0xffed372b2db29458, 0x7d1332d3ba865923, 0x140ee7e1b,
+0x4a507911200c75e4, 0x59bb1f55958166b5, 0x84de9dc9dcf0ebf8, 0xd066ea6782679791, 0x3dad8ed62d29c3d6, 0xa8ef1541905cf9e7, 0x9edbb3ab03ca7384, 0xb08e11fd35da25a2, 0xfa3df97c04e425f1, 0x1dfdac410,
+0xf488146cac7e62ba, 0xf5576b84c78a57ac, 0x9695211bb7511a6b, 0xbd22a5681dbbe1a4, 0xea7e7e7348723296, 0x97c1005623ebf8ed, 0xba59dd78bc670914, 0xa3cf8c4832ce5a13, 0x7813f93b4cb5c8bf, 0x64bfe77d,
+0x1e885a709c8ad098, 0x316928e07e3970fd, 0xb3a8fa3318a3da06, 0x9389d3d08d1d899e, 0xd20570c3d06e9362, 0xd01b6bafb86ff42b, 0x26a163a2fd8a7040, 0x6e92393ee29a8e28, 0x4bd0638afc652f9b, 0x1c8828b36,
+0xce12c87ecdbd6d20, 0x7d3c5cbddef0b0d3, 0x6bdaccb47e5e87c1, 0x2517f971290bf8f5, 0x696c13cca020caf7, 0x356648bdff6f5317, 0x9bd28b2dea27775e, 0x8a160c7e02029c1f, 0xd213842d48582736, 0x3f6e645,
+0x3c79c3db5f07d271, 0x5771d1f897620245, 0x912294df0f4ba9df, 0xa459586259721070, 0xa3cdf885faa15e74, 0xebd83dcb14fb18d7, 0x9da4380b6448b47b, 0xfff74ad44c4a49a7, 0x52476db9fc6ee3d4, 0xff76781f,
+0xe128b31b04eb0f10, 0x9f05a7a6d1dee427, 0x14613df925c333ad, 0x56eb5d50060d2da8, 0xa8c084faf70f9ede, 0x8bfe73da7950a40f, 0xbf8ef9bfb5ef0250, 0x5e498bad2341d972, 0x9ae33f003792a856, 0x207762d7a,
+0x193383655c557a6a, 0xb88ce2cb578120c2, 0x77888afe5acf6021, 0xee33a210c2120ed, 0xc3fe5539de4dd0e3, 0xafeced24d5897a44, 0x4e5125c13ebf7823, 0xf0748acd0bc3cae4, 0x7bbc7038546d26dd, 0x272f23cf4,
+0xf55820a14555f60c, 0x78fa1a781b82de35, 0xd41c8860ae33c74e, 0xf8f253f2256b47c8, 0x6e278be437de0dfa, 0xab96c9c697986baa, 0x155bc6a24542f2fa, 0x53eaeb57ddb34bcd, 0x77c7a31c1386dacb, 0xb8c11fd0,
+0x8cd1c441b80f0bd4, 0x8345840b813da230, 0x1df3205fb189f358, 0x6a5743999d20c343, 0xe63d4364fdb5a66, 0xc0e4d302e3a6570c, 0x63413c50694fec5c, 0xffaa5f89eccca3e, 0xee75d08bea5a52eb, 0xed9eb010,
+0x86d711fc4d812d4a, 0xd220c3e2412a2c7, 0x8fcecdfa6c225a66, 0xefccd43d4520eaad, 0x6998dade33f53a9d, 0xd92d4d77c6aeec0e, 0xcc10fba4803f6d00, 0xe267e137d74bf021, 0xc7f05db5b4627e25, 0x171ff9d28,
+0x111e7dadfa0a377e, 0x103d32c1a76c5f25, 0x52edfc4311870fd3, 0x983732298646af8c, 0x92169dfe77a608b9, 0xec76c0e7242104b6, 0xb77eebb45d7b12ae, 0x28fda5dc619917b7, 0x953ae4dd03681671, 0x212287019,
+0xff65757f2fe8cfb8, 0xe2e32e9c89789ba6, 0xea4b39a2fd3f0deb, 0x6da24ccf036275c9, 0xfb8e87e583ccc5d8, 0xf029c31f2edd8810, 0x6831e896430a02a4, 0x7a82cf37785b1b, 0x240f20661cf05c2, 0x19256f08e,
+0xb0753a20c00f117e, 0x45a20b79d1fb67c2, 0x2a8b0a50c016feca, 0xddda75196d827cae, 0xa9ebe83354e440ef, 0x60e92f32e6accc04, 0xca5ca7553f3ad1b8, 0x9251357503b19f13, 0x78d03c71abe54250, 0x15fc1f011,
+0xd2788fa09af76395, 0xd811a7e9ad74a3c5, 0xcc5f18b2e7848ea7, 0x7c9b9f55ec16d776, 0xd4683c38c8f150b4, 0x43399ce47f06a77e, 0x2845263704bef5aa, 0x2d225265193adbe, 0xabf5370094eb9f19, 0xf936806e,
+0xd1ea659235dae5e0, 0x69617abd93b66df5, 0x66005757cd5b59, 0x1e608a6e02c2adf, 0x9b6962701994a014, 0x8b96e50ac8246f73, 0x5c1d20bf0707957b, 0x5805e97b94369169, 0xf7b4353491d2a034, 0xcd3f8bb0,
+0x8dc029fd45143bbf, 0x4b3de005f70c1302, 0xc00c907086dc349, 0x6a40e0ac7ee353bb, 0x74d1a770d6135681, 0x8fed714086f4a31, 0xdd521af7cb454f78, 0x5828ecd77321f241, 0x7beeb5e64e22463c, 0x18a9d2fa7,
+0x76b22573d766d0f8, 0x20ee0df0f54b1b6e, 0xa507cf6c45ed7ee1, 0x17aff65ac70df53, 0xab5242941b62c0b0, 0x8c12f72915083384, 0xa792a792fe66f006, 0x27858d4f3026871c, 0x959b360e4be5a4d4, 0x1ad974da8,
+0xe5b48c10edce2f9f, 0xaa28aa5967a33351, 0xca974440243f5fae, 0x462b485bbe5e51fa, 0x58025191f2f019a2, 0x9c67e965e5035b2b, 0xf82907b8ec5fc49f, 0xe7474bac86336058, 0xe18707f55c1b9f3c, 0x268035e60,
+0x6ad717eea6a27c3, 0x39599ea3b32b32eb, 0x59083a92ae7e10f1, 0x7c4822a8fdc8f991, 0x294c29d9032ceb67, 0x19e2bb4707a3de9f, 0x3399e120823e1b95, 0x1bea8e35e6e2d161, 0x6d5f142dfc96e6d, 0x25758d073,
+0xb21ec5f1363c7329, 0xe88096720fcacd21, 0xbe2cfd80459c022b, 0x3c1ceacf8226e63e, 0xa83fcf548313f47a, 0x6e918239281e555f, 0x681e476a895f89db, 0x8066b4b665281379, 0xb9cab1b9958ddc48, 0x1e0a5aaf4,
+0x7e8473c5e206b55f, 0x2448dcdd0919567d, 0x4441fc3a4baab6e5, 0x275fee4b82d2745b, 0xde61bacea3bd42b5, 0x74ce9fa2a482f182, 0x3e17c6bd90f13c4d, 0x863e9f0aa24f2f86, 0x3aa618492201d526, 0xf14cc8b3,
+0xbe3326ec8c352f0d, 0xd4652d9c0386adda, 0x58a6bfe7328c431f, 0x937e457dd870253d, 0xdd05f7835f935caa, 0xbce7ba83cb32b9f8, 0x4ccfb1061d1739d3, 0x95451c86b229c885, 0x75ebbd8292ec5067, 0x27b7246a0,
+0xafaaefd923fd9498, 0x56f910c0cc4e7b98, 0xe4d2cc0a7e9fd3b5, 0xe7387620259f5d05, 0x4689b2da51d36f67, 0x66ad6b465ee7da5b, 0xa24e62928b36a1ed, 0xc22843fcc2a0bc07, 0xe6d9a026d0118629, 0x25c4aaf3e,
+0x85b1844c5af1ad28, 0xd5e8b2da0f982060, 0xfc3b576a08e2b7e2, 0x2a0d6783fa2a724b, 0x4334bd9bbcf1e44f, 0xf848c3b9c5cbee7d, 0x3a6d00bba22ba4dc, 0x4c6ebdb81809e06b, 0xad2fb5b5580d129c, 0x1d2a95169,
+0x218635da3e5461e0, 0x14c4b9342a8f63ad, 0x6761e5675e785cdf, 0x7afd2ecce0b1e460, 0x276d3b9b81922d08, 0xde8be7d6dc1ec3b2, 0x4a4916c509dfdfaa, 0x535f69be19ceabc7, 0x2cc15db4b0b34760, 0x3c98f687,
+0x46a4943391459d08, 0x3398b6a3bef430e4, 0x77dd81d60cf149b, 0xd5847d99d85c40e5, 0xcd2e9bfdd7df33fe, 0x13db51d5aeccff45, 0x6bd85dc502f822f0, 0xa4b7d83c5b0624a5, 0x5b20d265bb1d5d63, 0x1b6b597e9,
+0xba50f11887c92f2f, 0x13bd4862d5a99e2c, 0x93e516b91918dce, 0xf36dc86d391e785, 0x451e14b7558b715d, 0x1f51662a6c01ce62, 0xff7736644738dbb7, 0x4b78624e0f1a65c8, 0xf48dec779f5ec8ca, 0x3a6979b1,
+0x85e5b681fd29d40b, 0xfd1544765a55704b, 0x813da3779fd354bb, 0x7ab34c329b91e0a6, 0x510e84545b4a77e8, 0xcb261c4330c47819, 0x346e65a327211d3d, 0x5b181eac02849193, 0xc0fac8c2d284264e, 0x6d33d50,
+0x1901a82214be1073, 0xef893ff7b7ddde6c, 0x9e22f9d624bc26cf, 0x881098f45de9eb39, 0x64ff6f079c5179e8, 0xcaca52ca9ad247c, 0xec908994ca4b4b19, 0x6de69ddcf9f43d06, 0x3e90925ecc903faa, 0x1fc02bb13,
+0x79651024b6f91070, 0x89182bc6c8cf3234, 0xa0af17b25d9f6f30, 0xc77e8585fc7a13e6, 0xe3124ebfa22dd297, 0xa90fd2b1305d7f6b, 0x12f9f4ca2674d423, 0x1cce5c40ed545def, 0xf01bcea97835ca5a, 0x105dacf72,
+0xd0987ed5d91f2357, 0x8d6403881f6bbbe8, 0xf5545d3e813eba9b, 0x246e9a312901c309, 0xa75dc26f537b5fae, 0x6b67c50aeafd4139, 0xb2666fab540b4d9b, 0xe475015c9534b887, 0xcc3f9f65a6336503, 0x214a9fd52,
+0xfddd98c8eb5b2e44, 0x563306a0dfde665d, 0xe1ac48fbd6b035ee, 0x22b7af34aeaf26f, 0xf545c253215af749, 0xe035d7a6106784ce, 0x995a6fa8c2dacf5a, 0x7dc9e53a354201b4, 0xc8a65f3d512f5ded, 0x272707a58,
+0x1877377a07a9e1c1, 0x1fc791ef21f30dc4, 0xaa5dc21ae8fefa3e, 0xec905448be44a248, 0x71fdd4ec0d8d8fd3, 0xe3a5d9dd92701f03, 0xe8c2d23cfa9524df, 0xdf8479a32967cd17, 0x3717c2873b9dbc4a, 0x25f2c8e4d,
+0xca64281ade2c7988, 0xbe1860d8dfc39418, 0x64d83724f121ff9b, 0xe9b95b3c909438e2, 0x46ae1e84fef56800, 0x7369e7535a43463c, 0x217f5c870364f9a8, 0x40f30cb6f869387a, 0xe39a4f6d108e6ad4, 0x4ed88446,
+0x7dfbc3c1fdb393c8, 0xdf96772f1b7053fa, 0x318bc706dbab41c3, 0x68ba2fc910c56b89, 0xa9b020688d4401d7, 0x3dd8baf3eb1fbb87, 0x798144c36eb36a0e, 0xd72f5eb6e2e7ab77, 0xf8e2101c7b3bffd8, 0x2231669c8,
+0x7cd5e1c48138c17d, 0x51447f61abbbd693, 0xa296776cb32e83e0, 0x88cdff531ca06d29, 0x803d5ed3e2000787, 0xf76986a956a22118, 0x1344e93ae258837, 0xb984a536420fe18d, 0x9343c6f2490e46a6, 0x277d906b0,
+0x9cb1003ae386acb9, 0xa1150736bb0b9fac, 0x200bfcdf0b9eedfa, 0x575234749ada9abe, 0x81e58f9ea5e946e8, 0x36c2860b2ba1e12b, 0x5046b7530da09531, 0x3b3815dd0ee00ae6, 0xcf787f4281ddbe2c, 0xee0629a0,
+0xe4e6ff208c67ddd5, 0xe7148f4b17a63cd3, 0x2c32356f6180234f, 0xd46b47d2f9a15fcc, 0x99ac348d59fc558c, 0xf57274e35db5f7a6, 0x98d552089aaefadf, 0x65b4996abcd417ab, 0xada2416e7d69b850, 0x1aac177b8,
+0x7e8b43d0f454af50, 0x8a4c0dbdad28b383, 0xbf586bae003f3347, 0xd234c7f542dd82e7, 0xeb6890662a05f0dd, 0xff453668190f9b6b, 0x8cbd0d60c5b5b38, 0x543df06f9c1c7b48, 0x985c32fa6dd1103c, 0xd6b2f984,
+0x72a939a0876a517b, 0xe9b217364f79c375, 0x9946c83a06dd9af5, 0xc249a71f1547af03, 0x70dba36189695e21, 0xfa1932b344a630cb, 0x9987a305117fa84d, 0xa8b84f34478f32f7, 0xb3ed98360e90881d, 0x98948aec,
+0x41234afd2fd1d139, 0x70488c56d308b309, 0x4782329f96c1fa7c, 0x16b6ea6ab74d6fbc, 0xbdc77a453685ee55, 0x8a3109a8b1b9f21b, 0x617553fb7b4bbdc0, 0x79be438e737925d6, 0x33c049ab6c1ad38b, 0x23f9bdec3,
+0x179b47874fd000dd, 0xd8ec57422bb7c616, 0xa778d6ff0efc6cb6, 0xfef95cca98ac448f, 0x9257b13cde270e41, 0x5439a3ecce21746, 0xf9a7eb5570ccc9c6, 0x2130572e0171a387, 0xc8b37c3c9b2498f7, 0x106b07a55,
+0xdbc3b8bd687fde96, 0xc682dd1a0fe1b4d, 0xccbba64739008700, 0x67a010bfcd8a37cd, 0xe3ef25e3d75a05f4, 0x6a4d1f693a1e2882, 0xb6ee94d0570a0a2b, 0xf0e8542360b8ac87, 0xc24ac48d7aafca14, 0x4c07f204,
+0x8b6a632b5bb46b1, 0x357cd28b85377f01, 0x79a95f425806b3e3, 0x9331a0e19d4d90c6, 0x1d74e23359dcd3dd, 0xf9d9a739b7458586, 0x2a2e1a16282664d7, 0x7b73d8cf7a7415e7, 0x5ef6a0a71b75b65e, 0x22dc3224a,
+0xa09f8def836e649b, 0x7dd595726d9511cf, 0xcec1c118ce215d63, 0x912a7c76b8f9f750, 0xaefcd2e487f268a5, 0xb29135a3a5e111cc, 0xcec0d27230c2a529, 0xa280364b3d150d, 0x7df31924c97f784f, 0x12b8e910e,
+0xdbc2830f08a53cfd, 0x920dd6fe5d95060e, 0xdc231cf5b0eada1e, 0x29416dbbc9611343, 0x47ec31e52b9e5a51, 0x7cbf27d6e86121c7, 0xa9084aabdd635a1e, 0x67d786b419aa90c0, 0xd5eae7648cd636e9, 0x200a0f310,
+0x393439313b2bbac6, 0xf03b0daf593e2410, 0xa1e639e05a6fb37d, 0x6755780f8acd5c03, 0x482bcd854c3928ef, 0x1121d36aaebd4da6, 0x18771ac44de45ee2, 0xf6fe1925a5d5dd0e, 0xc838257e1d3c0911, 0x653848ff,
+0xcac73f2d66fe3511, 0xf53102faed01d2f, 0xc63c7adc4ef8b8f1, 0x23b5ec04fc583408, 0x675beed957496113, 0xcee0357cd4ef441d, 0x82a18bd424d5598d, 0x12b6e9d85ccaecc8, 0xaa2367f83342a148, 0x138a17cbd,
+0x46e87b57c68049db, 0x9f4380a129ed4573, 0x210b7e5ae4238a41, 0xa27ddf708090d06e, 0x1cf51de933656d64, 0xf3d3240b9b0aa44b, 0x7127d0ccd2fa12e2, 0xd254de29beb0f089, 0x59a8ee011ed8ef47, 0x126a190e7,
+0x2dc3824008dcb802, 0xd2f0cc54c9eb59f8, 0x72818c5d14e2c825, 0x9829701c00c8e841, 0xd8741bac1a550509, 0xd5dee46ad95f43df, 0x8bec777250e6aaa7, 0xbf7b23c2f49405d5, 0xc8867c690f361ec2, 0x6107c354,
+0xcd6a2ffbdf9202d7, 0xaa95841a93e9124c, 0xcab7bd2bcbda4c6e, 0x3db5559be3e644e5, 0xa25908f437a06bc9, 0xb3b87de126b4754b, 0x93a032ce0d04b522, 0xa5355647dd6cbe81, 0x5cb20fa67d36c7f7, 0x64417129,
+0x13330ee77fe477d8, 0x23312feb0e35fa83, 0xc9a9dc3428299e9d, 0x1c9029a95e3388a5, 0x859a0d2d10b15559, 0x827cd23e3a2bb02f, 0xfdf5ddbfdcada869, 0x33a5a3a9e35f3b50, 0xe5509bfc80cb921, 0x20403ad3f,
+0xd22a82d248e18c3b, 0x833e276dd82f5d82, 0x37fdd0e671d2a641, 0x65d36817de1f300e, 0xd26a64d569ac9b1a, 0x765dccb171e216bd, 0x24f36e87043f3543, 0x6a1fd1ae583566e1, 0xc980a503cd65f581, 0xbdb94d62,
+0x76b98b2e696eadca, 0x96e4be2330af5e6, 0xdb1d035eaf1d1e92, 0x2a6f2642bb68d203, 0xc542b3cc7a1971b5, 0x31717446cca7898b, 0x54503149979b3b8b, 0x3ff40b483a4c5fec, 0xd78f10ac4911837f, 0xda0c705d,
+0x7536396e4d17d7f6, 0x6184a66bdd587248, 0xbca301e1e6186108, 0xcd6e669d70b320cf, 0x7a974265abc8c607, 0x59ebe17919fe3a28, 0xf7190ae12c873b2d, 0x60850af96a246de4, 0x4a77f4e079b21dfd, 0x4fd3f7d9,
+0xd8dda9cb519c41cd, 0x40d73ef40d0aec1a, 0x26fd1e870f192b77, 0x285a8b55b13720bd, 0x7cb91f3440cf64b1, 0x1b31804ee4a40541, 0xbcdc613990826273, 0x91eee2e6980feccd, 0xa3d26f11aef0eab0, 0x28ad0a99,
+0xd79287eb2ac4880f, 0x3769c4c9f43b4b0, 0xbf652d230a4b812b, 0xfd7e461c6f0634e5, 0x50ef01442ff45911, 0x3aebd9aa22cbbe9, 0x4ecaa9fbf6fb7bc3, 0xa90c08100731d672, 0x86ccc4ec302ce9af, 0x24da1a0ff,
+0xbb89960e5ca70718, 0x87120e76b65011d1, 0xa8dc65053c111956, 0x2fd6d2e25fb861d3, 0xe83e3c871ca3c7d5, 0xc3eeb782ea88a99f, 0xe8411fb2b132cf76, 0xaefdf9431c03c958, 0x2b75762c8d5de0ad, 0x13d89e71,
+0xf6a9a55d5af081ad, 0xd70c7fae412205ab, 0x527a86da555aebae, 0x429bea7c2abbdf34, 0x727b8b44041709f9, 0x48ae4a6916eae927, 0x4f426c55c71a5108, 0x886b9460b1a97e00, 0x7169f74054b7ae42, 0x274c9a0d2,
+0x4b32a8d6dce21916, 0x72a5ff45562f5e8b, 0x1bbbf018578319c8, 0x24055fe032304e1a, 0xc83921868478edf4, 0xb42f685a0ca0a4a4, 0x61c31e88a4557fbf, 0x9bc97813b54cadde, 0x38c694f1bc7a6ed1, 0x1cfe785ab,
+0xae0f596d8f9f0cdb, 0x23726a6e082ab875, 0x5129bbed379beb9c, 0x5d3edc8b16196004, 0x25765b0407e1224d, 0x384585a263259f20, 0x3d6cedb7549bba3b, 0x6e566c3502a088fd, 0x5f79c9ff30eb9cc4, 0x2474d7922,
+0x8980198093a297dc, 0x737164517fe3aa1a, 0x23f5b8541d84aef7, 0xd4ce89cadaea8618, 0x84439bcd847d758f, 0x9920a90c82a54391, 0x6c0a3cdec9fcf006, 0x8c079f9b1d17367f, 0xb66ee80bf391a380, 0x1b12eee09,
+0x162a64ad6f5b2559, 0xc2c7a8b579b8d012, 0x1b5c5cddb1f6fc, 0x6929e35fe48cce53, 0x5fe859ab4674d7db, 0x3eba1136be5ea38a, 0xe455ed0a2147ba23, 0x7c6eb10d4d07b83d, 0xef71e5d6102ba193, 0x11ce1b58c,
+0xe3c74ac99c735631, 0x9ca665787cb54d53, 0xeab3eb2399cbf92b, 0xae1a67fdbbbe2ca9, 0xe2f1c9dcafee612d, 0x19f2ad8a5093b072, 0xcde817ef8ff269d5, 0x71174f60eeb2415d, 0xcf01dfa6a60e4926, 0xc1eac9ca,
+0x4fe2fcc7fb2e328a, 0x44e465728b0916d5, 0x38b7a436861b9e84, 0xdddf324d8c1f7a81, 0xa9610577887621f6, 0x8076e143681ef51, 0x22b1976cf69aa58f, 0x2897e15924144f2a, 0xe21ca85b43a6700d, 0x373f1233,
+0x5a43417bcfdb8e38, 0x65dad5aa7bb597a8, 0x17673fe18db66017, 0x832ce6a07b09a2ff, 0x754c4c7af7f4ab95, 0x31bb7c24dea07f35, 0x29be63c559e92043, 0x4df97d14f15af44c, 0xdbe2789bb6dda18c, 0x20f422e30,
+0xb42627b53064dd8e, 0x99502ae460c9b598, 0x1dbf757a570df878, 0xa263f9bf48ba63a0, 0x331fc18b91a08b9a, 0x41cddacd601c6090, 0x8c10ce31b9d6b8bc, 0xae339d30304d6a47, 0x5dd68240956bbd2b, 0xbe52e716,
+0x571e72fbaa49b4f7, 0x8cf92f641badc1be, 0xc9b7fb8855504a9a, 0x5126d271a9d422ba, 0x5246bb866ae6f44c, 0x20b07f7e1d680f25, 0x6988f498c4ae0361, 0x87243dfe7a660e74, 0x9ca0a572be729eda, 0x119e6ced1,
+0x2c487f593c2925c4, 0x81274385d98018be, 0x2e0a291b3cd09cc5, 0xa0893e3548413d0e, 0x8c10f7d9a87f6c3f, 0x5f8bf91a76a8f06b, 0x800d91fa5d77a4a9, 0x6ef6386fc144e3cb, 0xa07d6700679f775a, 0x3d61bbef,
+0x3e062bb82c185485, 0x3c953eeb777f5487, 0x9f39e4537d700b16, 0x88fd94c11e3ed09c, 0x9aa6a6e1cbfe7910, 0xf3cdd7b8b3db6b59, 0x39052477dd3187d7, 0x2f14803857140bb7, 0x6432e7cbfe5f8a62, 0x1fde1ac7a,
+0x35d64e97359c2a79, 0x4e4067520f13f773, 0xf0504718db8c3ecd, 0x63665fc9ae31de70, 0x412f3b935b9e8314, 0x8fa97127394cf2e2, 0x2a3758390885a13f, 0x76716a28dfcbc4fb, 0xc25b25fe6c1f01aa, 0x1a9ad0702,
+0x50bd1432316ddebc, 0x50cdfe764d599de7, 0x8b2deb276bcdd3ba, 0x5189b3f2292bd34d, 0x3b26b7d47000f060, 0xbb78029eea465ded, 0x15c5e9da9dfcb1a7, 0x891d2e22a46ab2e, 0x5f941cce3a6988dc, 0x1b88b2026,
+0x13f403f9084a8342, 0x1dc4f6f837ee00c6, 0xce7baccfe4901be0, 0xcd90ae1520431297, 0xea0fd43be7e94963, 0x957f6557906874d7, 0xaaadfee6b820e17b, 0x745da4a862c47cdc, 0xde4bd14cdbff4da4, 0x4244df74,
+0x69012cfc163dc291, 0xba5a834251764177, 0x47c1e1c2fed158a2, 0x375bee75113bd313, 0x2797737663665e, 0xbe2e7c1176c06195, 0x35e2475900b9340b, 0x141a66b9a61d8ed5, 0xe1f3486088244699, 0xda541d29,
+0x8b6dd5bb1f25405c, 0x9ff459395648a5ce, 0xfb1da4fc84800d00, 0x17e895fd08a9c7bc, 0xb5b85929a068d10b, 0xddfbaddfbed0c142, 0xfa1913799b703799, 0x681e4bb9f298633f, 0x1d21d61b64460047, 0x13fb98a5c,
+0xe68f1a5bd5affb7b, 0x93ea4df3e363113d, 0x4d29dc2878ba878, 0xad54a42a7329021a, 0x6b09b57545ae7442, 0x25a745eab9cf5554, 0x1539c7700045d746, 0x61973f38e84eaffd, 0xa1757e27505d0cb7, 0x1fc57c81f,
+0x39cfa87b1a5a0abf, 0x3f05d608ad072f56, 0xff62c244170bf298, 0xe959484e07aa3bae, 0x3b1a87ceafb748f1, 0x31c60debcb00ba70, 0xafe831e51892f9d7, 0xa347580fb20accf9, 0xdb444785a5fc3867, 0x2003a6684,
+0xc6ca950df23102d, 0xf19ec9ab582fe4ac, 0xdda9d1e0fe6a95b5, 0x9448fe1bcc9f739a, 0x365462cebe6e905e, 0xef24ca6bf9e1ad2a, 0x2b29cf73e02e59a7, 0xd64732b525a8ce97, 0x429b871abaca89d3, 0x666d63b7,
+0x537cd10d72f936de, 0x85e5830a630b7516, 0xb52ccc45cd6bd510, 0x86ba6bd3d6bf4719, 0xd09c683823ec9ea4, 0x958a583ebe074f2f, 0xa513165958350199, 0x585a2167acc59a06, 0x9829556877c8f546, 0xd2aa3ece,
+0xc7cf7b59293ba7e5, 0xb4d121ddbcaca08a, 0x753192d6307142a5, 0x506ec07b692689bb, 0xbd6c17db67fdfdc, 0xb95d8777bfbf170c, 0xfc1c787d44b1e3e8, 0x1a9d4d321a3eb0b2, 0xf3b1401a38382b5b, 0xbbf408a2,
+0x3f17dcbe75b64269, 0x9438c8a8f94dad49, 0x42c4912449df540, 0xa044c4d8806dac78, 0x6717827ef9bfb579, 0x6205c02de9413f39, 0xeddaed4f3045c289, 0x30d748ed61cad93a, 0x98b8d175b1caba3d, 0x1cc7b2ee7,
+0x7f3150fc5ca0d970, 0xb3c74f9f08bdaf8f, 0xfcc8de48ea374ef0, 0x8abff6dfe0cdddef, 0x2eaf31046d4810b1, 0xdaa01805a46226b4, 0xe7dc492aaa2b09eb, 0xdc7834efd7dd59e5, 0xd52621caef8c4b46, 0x1e65593e4,
+0x3996237933c4c849, 0xf781c8ea430eaed2, 0x31bd49602bfe7852, 0xbfb70a5a1f41a7ef, 0xc6330e17b17b6269, 0x5fa6dd62283d2ac5, 0xb8babddd5803fd13, 0xab2e45485261d4a, 0xcbc2739aeb985b76, 0x1a50e6dc2,
+0x7ff081289c4ff30b, 0x3320b930002c16c4, 0xd5be5f4da9aef22f, 0xde7fde27d4b922c8, 0xdeac622772b2f0e, 0xfd5f07d677b256d6, 0x11e22964c8bb5d7d, 0xaf2636ef9060bcd1, 0x837cc6f0eb375943, 0x1e527253d,
+0xa6d121cb20c4ddb0, 0x1ed441193c78adf6, 0x7b1afb7764702a10, 0xd0754928ecde46e1, 0xb892f5d5e0879f1a, 0x3533e1000086dafe, 0xe75999ed413161b2, 0x6d17c0b29559aae7, 0x51a03231dba5fd15, 0x3fc8525,
+0x897c49a5effd0336, 0x2aaa96ede5d7a4be, 0xebfbd3663541e008, 0x5b7aad127265265, 0x246951a3bccba209, 0xca0bcd034616de08, 0xead6a7181c364689, 0x36cb0f699a63794f, 0xd00558456d2de657, 0x2d90b0c7,
+0x4aabc6a07ceaa7aa, 0x204951523efdc0d3, 0xcd0fdcca5e353c12, 0xc5b04477813ef2e, 0x43b70735db894589, 0x1e1e05c085943195, 0x8edf4432ab849393, 0xf280ceeff2eaec9d, 0x1ebf887e46d75803, 0x1785d3b9,
+0x713aa1b553a8d88b, 0x8541ad8b1b6640e7, 0xbe0ec2ee982eee2a, 0x2abcd8c85df853fd, 0x7e9b1112ee2c272, 0x1387c443399359a2, 0x1d7f12af1819c4f6, 0x5f8ab082bb577578, 0xb372471f532a23, 0x277f5e6c0,
+0x48a7fbc942b9a230, 0x53c6425af4be6ced, 0x740c1f1c8b286f03, 0xb52ca173022019c3, 0x45927c47f78cd40, 0x4eaa0f0619ec18d2, 0x88f390ed630b351e, 0x4b0ab846e42e62be, 0x94492a0d0d4aeb31, 0x103bd8ec6,
+0x440cab7b3264035b, 0x9924dc4140aa6df, 0xedcff84220263e3, 0x59cbb195c686c2c1, 0xd36dea9f6ed79983, 0x7d16cbc5e3079889, 0x4b9445737e91725, 0xa9ba5b7b0d97e39b, 0x38fa77b462fecacf, 0x1c2fa069,
+0x5e7b0b7d423f0b5, 0xf53484417796c197, 0xf9f2bf26f8c170cb, 0x80fdf1cdcbef8832, 0x74f8bf3fc330ae61, 0x2224a2fc26d971b3, 0x423ceeec58cd04f0, 0x3100ff838abfdfc3, 0x98f28c02d59b5540, 0x261d5cb3a,
+0xdad08f01097fbb35, 0x4195345e3dfb6c1, 0xe85e0f31444eec18, 0xf1315ca3e24095d3, 0xef0cc039ac6304c2, 0xaddb7992dd6f179f, 0xe68978a7e691aaf1, 0x12c91ea034b8678d, 0x5acfef96b94e3f9f, 0x1f4a9adaa,
+0xa8524229baa1d4de, 0x649c18d70ae1c2e0, 0x8ffbeadfc08fd291, 0x9eb963df50ce484b, 0x2c014793173fdcd7, 0x9b30555d8b1c632a, 0x64749b377ea2f578, 0x3ac733bbd3f5769f, 0x45e0624746bbb806, 0x51be10ee,
+0x9efaea9cef6e3605, 0x63fdb72a0bff4dc2, 0x104e194e58984805, 0xd14a91736de7954e, 0x8701112e65f63c3d, 0xe00bb3ac5cb6ffb, 0x40e688e849d3eddc, 0xc08b2f85f4444465, 0xabe60b5a9a133cf1, 0x1d66e172c,
+0xee97aeeb3e0cd948, 0x7e74eeca79e29840, 0xb57965993820c4b3, 0x7908f3a35fb6dfbc, 0x9119e57f8e79a1f, 0x584097d560d3c34c, 0x55972d6865e48ff8, 0x3b7e889e92c2be1b, 0x9cc9b25ceaaba506, 0x161091648,
+0x56e3c9e3a4600626, 0x9b6b5facf23c120c, 0x3553c6e25c6efaad, 0xe87a087c26a7dc14, 0xee8094677f2b4b69, 0xf25ff04a4f64f27d, 0x8f899a7fe5f597dc, 0x11395f5bb3472177, 0xb15f90961f651d4, 0x1328ff2e7,
+0x84a4f318b9ba7307, 0xfbde2cddb495a63, 0xf06e592d9ea5f017, 0x6c4ac4128c82083a, 0x7ff79c224c9b84f0, 0x2acf562acfa437c4, 0xa96074ec5b9c2377, 0xe57230e419f30863, 0x2679a19db892682c, 0x133cfb590,
+0x89e039843a02396d, 0x60d92cb40a900d, 0xe6777ad6ed89ae1d, 0xcbad0de579c8f193, 0x822cd572a6d8c0c0, 0x5ce571ef30a385bd, 0xe442d1067cf09ef, 0x89148c826528399b, 0xdfdf3d470aa98e74, 0x17477ffb5,
+0x7239b13b051d43c3, 0x1f8fdb3f2ebd05e8, 0xe1c77c5401220c93, 0x97b535f2cffa370a, 0x2df5553625074166, 0x11789dcfbdb19730, 0xfadaa088bf176d3d, 0x3f92723b92edf7a6, 0x49fd8a0d30fa38f, 0x23d9f061d,
+0x706bacbf9fd5e243, 0x616df50d7be75036, 0x1db78beca98e845c, 0xcc7fd98da3eb5242, 0x6a8fdbccd5cdcc59, 0x510121c7c34b0136, 0x231ade05ecbfcf71, 0xc05edf7372b50a2d, 0x118fbff9379771e5, 0x90cddb12,
+0x85d9c2450e235b45, 0x1fde6275c1d0134, 0xf1037d9b2951a02e, 0xaf6a82a381e4c2ed, 0xb024c2c554d9bea2, 0x33db202fcb151774, 0x199ff00383bd7659, 0x4ac5c2af8dc258e9, 0x1d0defc2065bf91f, 0x24288a78e,
+0x85298cc8b2120c46, 0xad27f7c48d0a3f69, 0x761b0ea6350936bc, 0x90637926e4d6edbc, 0x1970966a78711ccd, 0x7ecc7bf387a6d0d9, 0x7125d70b3f87b122, 0x123ba0e90c794c4c, 0x10f15ff4a297332f, 0x238c7b087,
+0xd6b15491483e1865, 0x4585baa825891bd9, 0x5500a247d949c159, 0x2e0662b9db5e110d, 0x86d18d4be7e8aca5, 0x1fba53c7940a4610, 0xc4fecde3525bf233, 0x9d3b9e6db0592424, 0x7ca89a36cc13885d, 0x1723758fd,
+0x414e6ff1f3dfb666, 0xf195736dbcce3e3a, 0xe514b685498a3d34, 0x9a1e31ead7cd8fa4, 0xb5956b4b4d704803, 0xb79f6a5286c486d2, 0x9d9fc10464d54547, 0xbe13f2bbee9f7771, 0x48ac9fee1b435102, 0x49749454,
+0xdfa685c7967b3ded, 0x7f8eab9dd155641d, 0x116a803f80de3a55, 0xc2dfeacb36033d62, 0x6c4a74db3c38b098, 0x3f7cb8b9a467db6c, 0x52998151e7d85fdf, 0xfa8334ad5c1be151, 0xfe8ae24b10dc242a, 0x9ea6895b,
+0x6c254d316b3a6e6a, 0x650f81d472d3f21a, 0xdfb6b0701998e64c, 0x5613047186ad6ae9, 0xde2537d2b5dfc034, 0xa18a85b99f9460db, 0xce6eddac3e94218b, 0xe2a785c337194ee8, 0xf5bb4b09db8704b1, 0x6b3169c7,
+0xcf2af0c40a208ff4, 0x807ceee9ace9f32c, 0x361f683f9aa5138e, 0xaaead8f16de8cdfc, 0x3e1eee970369b39, 0x81a519f66125c4, 0x9e4d710142828c8b, 0xe957c247a65d6d78, 0xc13961352e421220, 0x16f6e14f7,
+0xcd3832d6a97c0f1a, 0xf38e07f7ad14c2e2, 0x91519f86a7d2be8b, 0xa8c6a9b1809ca045, 0xcfeb2183286acf0, 0xc0a72d023298e15c, 0xafac8d1bcc855edb, 0x926d40ce695293b1, 0x9f97c318937fdc84, 0x1c0e50906,
+0x2f01d38efdf8ca6c, 0x982d6472a6d7d8a, 0x915be4284dd4c091, 0xc067f29b48d87b28, 0x9e551f6c0767610d, 0xf7a5ea9a285951b6, 0xd536c5dc90ff17e6, 0x12ad4d8049492fbc, 0x2cab89aff089024f, 0xfc846a42,
+0xf2aa14d37887eb45, 0x10dd936aa2d55182, 0xc829d121fd6c95c8, 0x86bba6454394287a, 0x5c429b32e07ba073, 0x8f2b2a3c17099afc, 0xaf11b9982628f825, 0xf0ea446611efdb0c, 0x45e7596eb8fba660, 0x1d6032683,
+0x793dfadc34d3e501, 0x32fdfba987c5902b, 0x4e0fde537f4a484, 0xbdc7af6c616dca78, 0x16478b033ddd171e, 0x9ab72336e34adbf9, 0x9d8211c5733ed743, 0x143c8a757b9174f9, 0xc8d750f4e26ce7b2, 0x2609282ad,
+0x3a78b663e0009860, 0x13175ac6038f056e, 0x1d3b858b01de41d0, 0xd229f3d7f4a6d4c0, 0xd07cc5fbc1535f3e, 0x39802eca9d158329, 0xa7834f0f237d22d2, 0x686fb6cb8fa183d3, 0x71711f80e0288188, 0x1831d9408,
+0xfb0a39dbe77c92d2, 0x2f008883f7d3a6ba, 0x74462c1ec9f67426, 0x1b416b4f9631a8c4, 0xc4c2fc77103b5f9b, 0x9389e6d894f5fafd, 0x2042614d172552f1, 0xb0127b54969b376c, 0x175128885a7ebd16, 0x6829a71b,
+0xd989e3d2c51d2664, 0x80f1c5ea20d875f1, 0xf4c26912cbf5077b, 0x3b2d7af925edb794, 0x5dcf52df33de478, 0x596db62aad920286, 0xd82bb271605b6a3d, 0x49ce77abd52116c, 0xadd850bf223b3e69, 0x967b34af,
+0xb3e7f501af7ce01a, 0x1bfb4f91fff51727, 0x295ff86f72c23a8c, 0x2d5e6a2976f5c24b, 0x2698d738c8435da, 0x56be98e348abec14, 0x27c1a1a08c06183b, 0xa359abf56d4100d4, 0x7ef4932a9f1473b, 0xc87ad3d6,
+0xde5e6ea8587ec23c, 0x38727da18eda2ba7, 0x1c0e8fc4d145bd05, 0xb6546967368e5ed1, 0x36ccbf77530cec10, 0x451cd772f793c34d, 0x1fc6281b89aff749, 0x1d97ebe8a85f0225, 0xdb9fdbc32af1905f, 0x16e07263c,
+0x6605ac663b4c7b53, 0x35699f1b3336c08a, 0xbfc786678502bc17, 0xdf8cfb37d05cd5cb, 0xaddccd9585e2b531, 0xf5f1cceb1fa5eb9e, 0x90a5985e48ef0364, 0xb35e31df335b5c37, 0x4bdda1581099f89a, 0x19f7af065,
+0x3c78302065295072, 0xc9c8e7d88e30084d, 0x6f363f8fca5e7f44, 0xe0f46abbbce05b3c, 0x3599a4aaeaf2cade, 0x7ebe6c0a6294600d, 0xbdcde046a4c0e477, 0x7178c7c82f398d0a, 0x89b62e0663bebeb1, 0x1b3457ec7,
+0x3ed5258ed65d739, 0x88099b2e664787e8, 0x8a3910df23bebaa8, 0xf8e8decd29e587f2, 0xb1e0e6b9480827d9, 0x5df2dd8927d7900b, 0x921408001964932d, 0x2a0fa2b6d0328885, 0x491c73bbe1d008f6, 0x130c80c47,
+0x7e77e850b9b8e5f0, 0x519ab1cc6fcaefb8, 0xd01313077cdf0419, 0xebcc33dec45afadd, 0xde804ff92e1b3ea4, 0x78a4389e50114941, 0x941f57a43f99e76d, 0xba5d2998eb4b169, 0xb2eed699a0d2e219, 0x151adec47,
+0x38b45872cdb16ad6, 0x534b960fbdc210ae, 0xfe741e7d37a6d161, 0x78f2856b91b5c06c, 0x31d74f8fb0339977, 0x6c71c7b6db244d49, 0x693ae460c9f1fea, 0xceb7efde514f5553, 0xa4f3bbfa7a3b7740, 0xeb5dd4c0,
+0x7c00e8b237187afe, 0x5b54bb709c1f7e44, 0x787a315e00ae4428, 0x8b981f0fd4805460, 0x77788db0101dd2c0, 0xdb6e95e01b0ae103, 0xdd99a28001cecf37, 0xf771b9d3dc1cc28e, 0xd48e29488cd26838, 0x256ff0e16,
+0x268c2165aa8ab9e1, 0x23696b24d6c49ae1, 0xd8f5a7e8f4fb559c, 0x83bdb336ff330197, 0xf58af995ee909dd3, 0xe8690ad468f09924, 0xcf8601dac89301f1, 0xc336b52fc59d7aa6, 0x2471c8107dc1266e, 0x1d2f6c46e,
+0x992055e08494db76, 0x111f0f4cc091782e, 0x797220ebee541075, 0x56ff2b2350a64d36, 0xe603c76eab953e8f, 0x775f91aba80a8544, 0xf553b4f2fe939b50, 0xf6334f70df13fc74, 0x954458b4d5ee7301, 0x124fe07ce,
+0xa72e368f552d9739, 0x34f3727174c0b877, 0x3c8c54db62230d71, 0x1aede37d321a0191, 0x1d5a6235df3f08f7, 0x507a0ebe94215d26, 0x87c2fa10623ef421, 0x9e7b64626d465687, 0x74e4b29539ef0af0, 0x142c60783,
+0xf4f34e1434662a9c, 0x12644bec86dfc2ca, 0x424fa40b88225a5d, 0xbe54befc68fe600e, 0x9231fe4d7d451290, 0x9a6770b6556366ac, 0x8f70f96121654be2, 0xc8ef1c8aab6ca890, 0xf9b2524b1562ad69, 0x1ba453f97,
+0x67a9b7b650cd0b92, 0x5fb91d04b59d52c8, 0x4266b69c1ea6ae1e, 0x2af319f655393aae, 0xbf69847bf2ee0158, 0x57dcb66e2b66059d, 0x928b20a87b46f288, 0x7c0e082e6a911629, 0x2fc2ceb5b3b2e61, 0x23be856b0,
+0xe59ada5255917589, 0x87a186192f7a76ed, 0x3108869a9dbf094e, 0x8ca19aca2a68104d, 0x5b4b1ab311bf7f1f, 0xa0cb4c9d4e85fc, 0x62246b112211cdf4, 0xbba0588bdb5739ad, 0x563e75c1b6c363cf, 0x569779a2,
+0x35fce08d625630d1, 0x507b77ebb381a730, 0x7590aa5b02571b5c, 0x4a8af82c1f72b5b3, 0xc571e72b9ae5562c, 0xa9681783b70084b1, 0xb15b6e30d6581477, 0x679f4da68b6cc4a8, 0x2f46f97b1b667d30, 0x1e9c4af4d,
+0x3d7b7844de2e7d02, 0xd377feedf3218fbb, 0x2afe0eb076ca57b7, 0x94bd10a996f141c, 0xfd9b5559907b9d99, 0x352f3c3088e3a902, 0xbc65d069e4ac1f2e, 0x1cef4a0d56fdf949, 0xb6302ba5aba5e876, 0xcde87676,
+0x8c044f8e5498cd32, 0xbbb20b7ac418861e, 0x74fac9ee5394469a, 0xb4f67c4bb448742a, 0x9c71179809bf1179, 0x36d581ea526dd2ad, 0xd2ac36369485f062, 0x6be69b5d012671d8, 0xf601b9b1d2657875, 0x11b8d565f,
+0xd9720e10cd4940f8, 0x880dc625c06c0ee6, 0xe8e80a54cf8ef141, 0xe8af2fa31db8bd42, 0x5653c9cb7c30848f, 0x2a280bab9412372e, 0x875d4c51672bccfc, 0x2d53ec774e70526, 0xc13443dcd6952d72, 0x200fe633b,
+0xbe24e1adf38c7913, 0x47640eef6999c43f, 0x9be43df18eae04e, 0x8bd076e979ec8fb4, 0x9a1c0fbeb9b089ca, 0xdcf91de20a850308, 0x84c5cc86d61b28d9, 0x5ddeef75d0307501, 0x7adb09dfcda721c, 0xf214d3a0,
+0xf379e5ddb0006f3f, 0xefbeccd271be7013, 0xbbb2115dffc96258, 0xdb16622ff585b1b8, 0x7b99307542134f25, 0x18a4a69aa2451671, 0xd2489da75b50c14c, 0x9e9d2960fee67925, 0x9e0ef012a6205a1c, 0xc41c8eab,
+0xd09d60c418abb5b4, 0x67589b3cf7a4e492, 0x568335a0d5eb2047, 0x42d6ebead4e2af14, 0x55fdeee21baaab0e, 0xa5c659a24566385, 0x60e2a67e577c3e7c, 0xb0f6c5824a9b5195, 0xff4f66dee7e41a34, 0xb7890fce,
+0xf8c5525a3b6db800, 0x7b312181620c5e7c, 0xc29bdc5d98340e79, 0xbcbb23e145391375, 0xbcb701d089e3d612, 0x6870c6e1e27c7767, 0xef94fe8c097de302, 0xe80cdbda4886ef1, 0x757a58b0c41ad4ac, 0xe1514ba6,
+0x68adc48fbba6c642, 0x3f6d58483937992b, 0x777024348fd78072, 0xf071a885d7980c0a, 0xe9231db8f7759a64, 0x5df3e239d74f66b0, 0x58c21fe3da5b84bc, 0x26b41b2e213430e2, 0x50677367119ce67, 0x27610dd02,
+0x8237845630efc72b, 0x84e20317220190b4, 0x7554ecbb20e92f90, 0x62cea703b2ecb063, 0xc035410a4ab3faa, 0x8114290c34ad7612, 0xa07ac3f8ca0c109f, 0xa8afaab74059b209, 0xd4d3329801368247, 0x18b8fe5b,
+0xfe857c2614bcc3fa, 0x851486811520a653, 0x89cd7351abd94e89, 0x37a96488e5425230, 0x706a4d3db01e5d72, 0x8ef25cb7ff3ae231, 0x1b97dad32391ba0f, 0xe5fd1cc62eb40882, 0xc51c123168e037f2, 0x1f31c0e44,
+0x9ddc15504995703e, 0xb602833bea8ce044, 0x859ddf20e7a9658c, 0x641ab5ae51ff1aae, 0xa6b4bdfe41a9e9ab, 0xb9a7aa3b19718309, 0xf1ed7cadc77b27e4, 0x583455c4651810, 0x9d6c2efe342358f5, 0x7946bd63,
+0xd8387ae1cac5eb5, 0x180fbd537c425a1f, 0x654e393452f122b5, 0x19d9da3f0ac72dac, 0x847ccb8d3289bf83, 0x12453eb3abb3954c, 0x7c6847eee35aecb1, 0xfe1ad94ae855ad54, 0xb498bf1f9952ab4, 0x18c967ef7,
+0xcb88706f094c8b75, 0x8d8b3fa22723ca05, 0x6cf5c2e9ffd547d6, 0x754d16c0ee1c84c2, 0xdb9bd65062fbc871, 0x8ca3524de2a73e74, 0xb6f71b33e1126e3e, 0x17f56aa9606713f9, 0x7ec3f905b8c40223, 0xffc426f4,
+0xa768b440084813e6, 0xcc19e02932c77f30, 0xd3a4b71833965e69, 0xfed37ebc5adbe70c, 0xa9a52c79ed860d73, 0x6b6267d1951f9626, 0x7b7c7b3472de7969, 0x86d75e69c15b9bf0, 0x5b3e9c5786d66e79, 0x16519e54d,
+0xa05bac8bfec4a90b, 0x4fae0fc7c506f3dc, 0x52077ec3b18a8112, 0xe092c5419223d2e0, 0x27b3a6350718227, 0x8e7ac3ad0430501b, 0xd4ce5420efaf2993, 0x7d77bcff435a60a, 0x9b6b334169a79324, 0x2601cd7c1,
+0xc84ce27147d1b5e4, 0x228da6d31ba38018, 0x72b2febe0f198b7b, 0x1701eb1d93f69122, 0x54b4a8a242e61cdb, 0xa4770a6cf6ea8e09, 0x36f1434b193c5bfd, 0x94541cc9d256c338, 0xd740960a13f3cfe9, 0x3338c092,
+0xb717a8fd8e572209, 0x5c22ae89a8f5e724, 0xc40db4704b47ebfe, 0x7be2b406e138e577, 0xaec570c6f4dbab37, 0x7d3034cf8778284f, 0xd54202a33bca4a9b, 0x630c301a820a3772, 0xb54027df6f5a3a8b, 0xbe5cb8e1,
+0x9bebe27653f85aa5, 0xcef7ee11109df39f, 0x34084c3f895aaf5a, 0x54edbd6490d2b288, 0x1a62a18d55c604f8, 0xe95b81b1379a8a7e, 0x4844ed312ed67906, 0x46da3f1e76cdfaa8, 0x1924be893f0b118, 0x8b1cb5a0,
+0x27ef449ebc59a99, 0x145a40c4014722ec, 0xd36f07d00ab5cd4b, 0x5264178ea5c3a4a9, 0xbcefa4eb6cb3229b, 0x84deaa9e266dd96b, 0xe48bb4c212b84fd8, 0x9d9a98a6bd2ceff9, 0x1312d65c415bf785, 0x106ac5b60,
+0xdfb5c402726f75df, 0xad2b1ecf3197378a, 0x1fb7447016f41455, 0x7b074e8d0d6c5ea1, 0xc1a8643640eed961, 0xa5748d8866816e54, 0xd06eb6882a9e7365, 0xbfc4ddfbe25dee9f, 0x7f59f957a1c062c1, 0x1ba7cfee5,
+0xc391936bced4464d, 0x63f22401a7d1b0f0, 0x85ecc94ba778ddd1, 0x5a7392b7179d2f2b, 0x8fbb337926cbbcbb, 0x356a67d15e0adc68, 0xf2f31ba7181c3536, 0xce261b9009df4922, 0x892a49724090cfba, 0xc5236400,
+0xfa260423b0c5c3c1, 0xb4d40f3545f7a698, 0x2e9428566310d138, 0x7bdeef1d82ae2964, 0x9d0a0bf13610ef4b, 0x10e7c10252a7ded3, 0x5ec7dfa49263d021, 0x79b9ea0c78a438b8, 0x407d686209a8066c, 0x16323bce7,
+0x145f6276fa27a6c6, 0xb36f62296430d165, 0x3e0996f80efb191d, 0xb6f748a7fd3e6de5, 0x82df3867ae04f843, 0xed78ef354edf4865, 0x798336fa5f4ecca5, 0xb10a73a0466a5f16, 0x8e21b8426f90d546, 0x19fbda47b,
+0xa44c01c141c931e, 0x8c07a2e6e39d3f88, 0xcc33c66be2bdc1c6, 0xc0fdc5146019b52d, 0xba15fed87e6e50f1, 0x7ad8a322bcd751d5, 0xebfa12d6ebbda4b2, 0x1aafed616b9af149, 0x13c286a781871275, 0x1fb67beb1,
+0x1c9ac6ca21b24c64, 0x83424f8f9f756e6c, 0x39c9ebc59b19e6a6, 0x65e08399f92786cf, 0xc097d2a243bcdae5, 0xc57bad2825e1b0cf, 0xeba9eb91a76dfdf3, 0xe0dd0973ed73448d, 0x51be5502ec56f25b, 0x1918e7b51,
+0x9ce980d283ebd2ab, 0x1a7750ebe594dae, 0x56acb5cf7a263667, 0x297423fe10ccf610, 0xffb1adaa3a544999, 0xed52329602131156, 0xe9a21d5bfb83d6b2, 0x12843587976bff40, 0x102d06390309ff5, 0x5919603b,
+0x2f7c6bc713d55385, 0xde8f84928918fc5, 0xab221b4ceadfc206, 0x6979fef97fda27a4, 0x93b7a2387f2a1a3f, 0x4f2b99d33cc11d8d, 0x7e0303849a65f1c3, 0xf6b6a0fea8ad87f3, 0xf68788e054e43bac, 0x278404652,
+0x59ae23f8db24e8b7, 0xa111113c8b1201dd, 0x4aa35145335f10fa, 0xa95448a7e1c28770, 0xd3d06b487bcb6768, 0x4ba6cf87dfaeaca4, 0x1b9e910e88db2f79, 0xeeadd0b3399e80ee, 0xab8cc4ac6e37fe53, 0x1a74b899e,
+0xde83304987beeb89, 0x27943e30152b0011, 0xf972d6240eb52365, 0x4f217346e20fe326, 0x73e50e839458b98a, 0x95b88b284c7ea614, 0x7bb8c5d60152e232, 0x6a905d9981b4d0b, 0xe6b9dc0501f9a9fa, 0x2148192bb,
+0x2841a46fac0a793a, 0x8df927c239cb0262, 0x20d12655cf3a1e52, 0xa2f148ff2955037, 0xf1f822aff5437a27, 0x7363a490f4b23c42, 0xf09ce426fe9d5987, 0x4051ba6fb38f1a9a, 0xdfb33af32a615ee8, 0x74ec051b,
+0x89b734f9d2b6fd8a, 0xe8e31ee932b32529, 0x5422c77de3f7f78c, 0x5e17b43e2aa02c1a, 0x79b5eeedd2d28447, 0x964b33e1b87130c1, 0x78845494f7177e07, 0xcf96f232a056c608, 0xf6cbcb9acf939dcd, 0x13b5c489c,
+0xd1e684471164a76c, 0xb2b546ee82c34b2d, 0x1bea38afb06a9528, 0xb52535d8888bb6f0, 0xe2dd7c9041e24801, 0xb87e6d4bd587ee73, 0xa294d19871d8e81a, 0x10d79b62a004876e, 0x276d21e30514305d, 0x1d56c3b8,
+0x3f13b641aff97da0, 0xd631ffaefa43f359, 0x20d10d876ae8fa70, 0x3c1710a5c2dcac78, 0x2ef03fb15bb173bf, 0xb7b67cf28122804b, 0x79fdb039ae04b30f, 0x2b83382b61b13549, 0x77bd170d4e6c5ca6, 0x1adf28a6d,
+0x1edc69989647658c, 0x196a3ff5b4f02405, 0x60ee29c80eb748dd, 0xf6db7c581f78abf3, 0x217990c7e1c34d8, 0x24721c79c2c189da, 0x3a7d42f38e580bfa, 0xebc8fd37163affea, 0x209c954df96481b0, 0xb28a5087,
+0xbb8bc0eabd826db1, 0x506ceec404096d94, 0x89e788e2cfd039a6, 0xfe77571f963ed7dd, 0xfc8c108ce2d64e36, 0xb95a4229b95a5493, 0x5559c9c4cfc9efdb, 0x512cc7f1275bec85, 0x5295a1231fb3c720, 0x2418a89b,
+0x74186f9528ad8945, 0x5eaa814d0ac68d1a, 0x367f550b80531800, 0x4a9a27ab2661b882, 0xaf5df149fb550e3f, 0xbaf886b111065326, 0x15a3eac357366f03, 0xf5fc3d4803728812, 0xd471a234dd3ba160, 0x21ceeb13e,
+0xa830a22b22283c22, 0x1721510953466f49, 0xe7001fa1364f3e10, 0x99932cb8b049032f, 0xdba4894a9902be56, 0x5f23d6205b7c540c, 0x13aae3db35966f69, 0x75af5aa5e7170b21, 0x3f0a1aa66a7fb331, 0x1d7f291ca,
+0x8ce4c67008183680, 0x660cce32f29f5848, 0x6f6ff77e769cd672, 0x620fe4a669e54578, 0x6c7805acf5df7cac, 0x1739f0e5ca6fcb21, 0x418866e5215f0e56, 0x482a4bd9de669c0a, 0x2bc57fd0e5ee169c, 0x13eeababe,
+0xb6df26b2bb2a8928, 0xae561dbc3f8c748e, 0xa7ea5486dcb44757, 0x6dd6eae12561c1ff, 0x583ec3236102b266, 0x9ccdfdc4cc2583f, 0xa3b530c341b042ea, 0x619838f4c7c10ab9, 0x910ac9248ef1ab8a, 0x13260dea8,
+0x9fadfd225270d023, 0x216f8d22a7882594, 0x308de095adf02948, 0x8a4c2297a7ce251a, 0xbdb7a29e3a00ee6e, 0xce004f3e427d0974, 0xfd6529b4bc733f57, 0xfc5b4a895e1319f4, 0xf6244635f6b0e3ab, 0x16aa788c9,
+0x233508f68047aa82, 0x6c73b422d1dd193a, 0x47e4b32ad6655c54, 0xae68d7d066d5a03c, 0xfe02462b7e5df500, 0x38edcc9175d6ee8b, 0x1c668e2f296c03a8, 0xf3259d5ef414df66, 0x3f3740e22dc1d26a, 0x1a2f15c24,
+0x9b0356adf80c671a, 0x656d5452006596c8, 0x244ce794a9492e65, 0x35623760a380c5cf, 0x7a711224376ddb, 0xb7692d893accc530, 0x63dfed510a1395b7, 0x24b2f48a87ba67b5, 0x3d888315331e8a62, 0x1ca31ff92,
+0x8aa8258fb2fd30af, 0xf7b01c7707a793d8, 0x30718f58e7bec70e, 0xdac3aff97471636b, 0x9b7c0d5ca181696d, 0x6de41967ee12ab7e, 0xbc17fcdc2fd6ebc7, 0x52eb1e11f3225cd7, 0x7affad306d08077b, 0x24dcd39a2,
+0xfb301bf55f6d3187, 0xde54f3e61c603879, 0xc0fa8e1aef114958, 0x7b446cd7fa8ed7a7, 0xbd5080f97c5c3f40, 0x5f6ac17791e54111, 0x3bc742bb92d9ad3, 0xc983de6fba5a905b, 0x900e1031e41f62c5, 0x39eac35c,
+0xccddcdc09e80a08b, 0x3eaa36f6644d08f3, 0xf26e3c8053d2fe8, 0xec98ba47f7474064, 0x8daf65d12f80967e, 0x22b875b3ef095031, 0x7cab18b45f14b526, 0x7d9a66f546f08c20, 0x7fb3ac45dad93ea3, 0x21ee0e135,
+0x22257179702c78a8, 0x11f7f85f74b3012a, 0xde0ff9d051c90abd, 0x7cf36b4563c6a3f, 0x1556cc9256e625bc, 0x6aed0cad4ed56cff, 0x518300f40cab8276, 0x6b6a7ad61d5a3439, 0x87b48b9f31bcb1fd, 0x6737009a,
+0x9bc4643580835fcf, 0x6e1817aca2ae7832, 0x172cb35c8497a696, 0xca8e90734bd89711, 0xa6e8890fe5913d5c, 0x2b5289e2f8db99f, 0x2fc5e9842c9ac8ae, 0x9943e7de446f85da, 0x95c77af5200491ac, 0x215af4d44,
+0xc577e8945a4d12ce, 0x24b7fdabb9b6ba6c, 0xffc2c14b98e6d99, 0x954e363449f9551b, 0x9057500c641aa485, 0x30b96ac24667656c, 0x59df9c13b635cf5, 0x639027172a1eedac, 0xd62b325c733f4fac, 0x821e18f9,
+0xb63c31a1d2720dee, 0xe9bcc0a068310512, 0x115abb6bbe41aec, 0x312321e65040f68e, 0x104a40cd7f57d480, 0xf620364de0a03b2c, 0x16a75830c5247885, 0xb09dd0d1c57cffd0, 0x6b27b3c463d69fdb, 0x18b811635,
+0x5450f63891d197f8, 0x29b7440061f39752, 0x2ae83e7cf76a534, 0x40c4afe2ea6baab4, 0xb622342a02dd976b, 0xe4c20f1150e60460, 0x3bfd63f2c2d7310c, 0xe54ca418276cea66, 0x146b5496f4f320c3, 0x113a128af,
+0xf8f6ef9a0281bcca, 0x3767df0c562bf16e, 0xc036bca95582b8e8, 0x18e3d7730de00f46, 0xe22d33a271599d50, 0x83dd164d31bf704d, 0x3cdc5d685be62c4a, 0x760edbaa7c0c17d0, 0xa7f7ea3950dcaef3, 0x27857f533,
+0xeba547f36472fe5d, 0x5a9c381baeb40b7b, 0xdaed4c852f266d6f, 0x4a9998111c8c24d6, 0x49d98eee83662875, 0x55853fc1c5cd604c, 0xbebde1f950c340c8, 0xe17b723996c3218a, 0x870386468a33fff1, 0xd06bc983,
+0x6e44e281e93d6768, 0x65588a689778f5b3, 0x5b067a7ef1be747e, 0xccd2a8b57a5e5a7a, 0xca0f507a0a27ca78, 0xaec1f52f0c4f2a08, 0x8c59275227fc0dff, 0xce3eefaa67e4af43, 0x9afaa264aee622cd, 0x2031357c8,
+0x42f4942bdcbd4a01, 0x9b331e1b800a74a7, 0xdd80ebba47e6be4, 0xf598766190530332, 0xc2e9420a8758e23e, 0xc9a4e17a12c5a98b, 0xa305fcac6e5afe3d, 0xe10ff391f432abd5, 0xc2abbabb23b2d224, 0x7bfbc3a6,
+0xb6c33bd6a9d7f483, 0x11c07fd152314b56, 0x3d341cac05b35187, 0x491bfc55537066dd, 0x4fd9cc0bbee2f6de, 0x7026481d79bff91c, 0xe508527559eb677, 0x326215f8d1c11a9f, 0xf2d91303f250f1, 0x24882287e,
+0xc3cdee83ca09e00e, 0x3d8f0c694cfc02dd, 0x48d267b3e01bc95b, 0x6c575e36e800f79b, 0xda696bb8bf5baa0e, 0xc14e5ddfbbffd21d, 0xf8892631f22e324f, 0xb3518a161da4f641, 0x3fe4370f2783ae53, 0x1e596955d,
+0x5362ace195241f44, 0x58bf18997bf16c03, 0xf352a45b4439b298, 0xf4937c495deda19, 0x3f5df8ed84d8092d, 0x12848962592ae43e, 0xf0451d7f1b3016c7, 0x7d8fc8508961e8a1, 0xa146dbf3da6109cb, 0xea168848,
+0x62caf527e1bcce9d, 0x8a68575c6bd1f459, 0xbc8c4d7562fdb641, 0x4118800359c9de7b, 0xe63e6645919f25d1, 0x35bc9499cf9c259e, 0x903e63eca7473b40, 0xbcd21dfb345cf45, 0x3bd454a5429ab594, 0xee570c45,
+0x6a0d51a508c1b22f, 0xa3033c53f9c34247, 0xf3cdff9c8c0a8bcb, 0x6ff0f154016ac85e, 0x5b201bf126b833fd, 0x84e5a29e046bfa6b, 0x6dce6ec1cd92edec, 0xe3dc93567b4fa6f, 0xbd48c7e6e618f61c, 0x159b0c693,
+0x67cdc9966c9a67d4, 0xa718eea2e6d61e13, 0xf6ebff945bf99772, 0x3ebf9b6efba348c6, 0xd2dcddc337728333, 0x202d6b5f04ccba83, 0x870e32b57f4ab789, 0x9baab06fb43eac57, 0x6fb5e41a391b1ae6, 0x1d4220407,
+0x4cf6b8cde5f163bc, 0xab5f8c0f6e58318b, 0x19e9cf821b0f80fc, 0xc204fe5d68f679d8, 0xad1459d892da27b3, 0x402eabb07f300679, 0xe872f3907b569a4b, 0x83745556fa6752b5, 0x46b1581b2aeb9e9c, 0xa61252f5,
+0x64e14a4b16608742, 0x61f9e63634fe1aee, 0xc0b4312dc95b0125, 0x9a08580ef85dbf2d, 0xbf5fc6ce0c6ea279, 0x5618008c82a307d9, 0xb414c91d3027f836, 0x53fa3b38b4819dcb, 0xd062fcbabad2b6b8, 0x277ae7dab,
+0xb8493e7e7053f0c3, 0x4bee2b7649aa248a, 0xf407574d0d33216d, 0x5d12930f8bd20656, 0x34f123e1f1a6d034, 0x5dc27ca3335fe2ad, 0x14427aabfa0abdff, 0xf04f2b63ead44a33, 0xbe337d91e69b1abc, 0x212bca3c4,
+0xaa72450aff65ce97, 0x70393f7437250f00, 0x9f2476a3660882f5, 0x603c6664f25a33f9, 0x6b5f2ba82b489af2, 0xf3ce9af8342f14bb, 0xa6ef82e5727152e9, 0xd1cc8a58aba94677, 0x5ec964b4e1377c03, 0x68f95c05,
+0x79a4e5edc28de415, 0xe09bd9a5efd7597f, 0x6c573cfc224fec42, 0xba95d61a6374cd63, 0xec5763811f6a2da7, 0x364b724081115d13, 0x28ad23943d7bc9a, 0x5d631bb3e831230e, 0x4e85da7de89bd78c, 0x189a6356b,
+0x4dd18ac44b6f923d, 0x2359574b09a837b6, 0x5fc3788a34849f93, 0xca1301661707f4a2, 0xd5d656623573a6bb, 0x2d43982daffcf5ea, 0xe7e31125d6c07d62, 0xc1d93a4780483059, 0x4d984ec67efbcaa7, 0x10599cecc,
+0xd6943e7d905adb50, 0x3b8e8a53d0d60bb1, 0x56f1721a6c11d778, 0xb1ae3338c3c2cb43, 0xaf6a8d6e321bf56, 0xb5fe3d6ffac3b93e, 0x2ef1c46731b83be1, 0x22de5f9cce9887c0, 0xdb2e37e0fceb2538, 0x19a62c55,
+0xb568c5ca45b42886, 0x36930a8cceac54b7, 0x2174834417cb01b6, 0x466772a1c80a1217, 0x7df61f97fa5f8ede, 0xb6170fe034dce567, 0x4a927d2c68f0670d, 0xa5526ff81a5126bc, 0xa84eb64aca42a6a9, 0x9fc3181b,
+0xa2b838fda8ad4682, 0xd25ffb661aab078, 0xa1c1e42a10206ad5, 0xc9e03dfa375d4f08, 0x48f00521eb596af5, 0x5c00fc0ab98ba055, 0x6f662eea9d200c17, 0x1a6242fa6d1a76e9, 0x275f026dc79b08e2, 0xc20fb5e1,
+0xf19fe9367dc32eb2, 0x76bb419d4154ef64, 0x8c2834f453158ed4, 0x4d2db8cb5f7eff3c, 0x4096423a15c251c3, 0x37723718e4d14c4, 0xaba9fe0378a8bc55, 0x3f7ba46f5120a13f, 0xb1e0aa7df56b9b2d, 0x2524f6fe9,
+0x51efcb34a15ce863, 0x10de3fa87df374ab, 0x5e441ef4136be938, 0x49a858879843b061, 0x852529c848cdd9ec, 0x8a7fba3633024a1a, 0x53c281506dc8438b, 0x19754ea2fbe4adc2, 0x748f6d07974f26e5, 0x2001752b0,
+0xb96a828cb660d8df, 0x9e20d00a6cafb074, 0x3148e4933142e0fd, 0xb1cba33e22597b48, 0x2562be29772f29a0, 0x8e63559f9b76b6f3, 0x61d12d13af6bf8ee, 0x1a1e648ce6f7e1a2, 0xea3f88828ab02f11, 0x1ed744fbc,
+0x6d8e7a99dadf29e, 0x1dce9b4e1f0a8ef7, 0x59d6713f2ad78128, 0x707775708b686c55, 0x1acdadce493bcc71, 0x1661dd9b9b95738a, 0xdad8c24ad4ef4bf2, 0xeef066955ad96f03, 0x28a9af8b47da48c4, 0xab862f3c,
+0xf296b705ff4195d, 0x8950a30a35ba8c69, 0x93dd5ac9975e5e02, 0x7eb9eaf62f4d0100, 0xf08fd6fca32f0575, 0x1846e18e4a444598, 0x7ed62efc0ee94bb3, 0xfffe99166b6fa8bb, 0x8971cc52ed494ba1, 0x1fc723629,
+0x52b50867cfc4c3d8, 0xd021d0e588db2f3a, 0xb6b18f36e0ec3161, 0xe2ea877956437fe2, 0x2689bc70dc3568b9, 0x6b62d3b8d0c91e07, 0x1a13e9b16ea8c632, 0xe7cd4670fa7d5990, 0xfa52ed3bf65b7f69, 0x359e7af8,
+0xebf30c7731250f10, 0xdeedbd2747fe298f, 0x2765c75eb5b9fba3, 0xddd5412633982fba, 0x9f2f7be709452247, 0x53525384b6ecfdd3, 0xda947b2471855793, 0x5c8c3e1b413519b7, 0x1251f3dae7458b9f, 0x8b43d7ad,
+0xbb35bf39d8512b6b, 0x852cb5fb9e4bbc69, 0xf4a590205e6a16ca, 0xfbd64cae549bbbab, 0x4afe13094a18776b, 0x5384a6929b9914c8, 0x4aa022021be25865, 0x47054f736f2a42a5, 0x7a78d859fc1a3270, 0x1437a952f,
+0xb1153c46f6c668a7, 0xc3a2ae53cba2882c, 0xe5ad90e32ebfc008, 0xf3204d065c007645, 0x2815e82984bc14df, 0x70d63470ce4b30c3, 0x93af07f072dac399, 0x8721358b6cfdc2ce, 0x8aea5565f4be8647, 0x1718a384,
+0xf4b656c511c870b1, 0x5433ca7159ed966d, 0xd9a9c46f9335270f, 0x18c666a33006b701, 0x9b410287996707fa, 0xec4b3527eb0ce745, 0x33698f627934fbbd, 0x6c75828b3d991b50, 0x7827229f09fdc503, 0x113cb7338,
+0xe218602b62d64ba8, 0x11d662e3ec343e30, 0xd1ea5855c42e86ac, 0x964d104ed08d2136, 0x22bc987ee8ca7f08, 0xc73dc7f32b1c4552, 0xf7d16acb15c0375b, 0x1b625707b4076fe7, 0xba92357e67e41946, 0x4e806448,
+0x1c1ec70ff05a3e4, 0x4b65c4600a75d167, 0xf1316c64e04855c9, 0x26290b4946061533, 0x1a50597aa34d255d, 0x3c4eaddc15a5be2e, 0xea0a28cdd1f236c, 0x6323665113ee18cc, 0x692d6431ba53acbe, 0xf6d3eb3c,
+0x89804ac7b6c1de01, 0x9e3f23458997349a, 0x482c8cb158272b32, 0xe29017eeb5bb72a1, 0x7fdc984283a871db, 0xc14033ccd0c03d3f, 0x319776ef7c0ab41d, 0x41e8273d39614796, 0xe7d8fa0e5060fe4a, 0x180c68c0c,
+0xaa4e60c7d34fabc2, 0xd7537ffea46ef3eb, 0xbc8960827179b3a7, 0xae4828ba085acd6d, 0x655a608680133ba9, 0x7194a5e0fd22c443, 0x66544de201ecc83b, 0xb12e4b4f614ed4c2, 0xe9c40512bb25ea81, 0x21194a5cc,
+0xe5511c14adb4bd61, 0x634e71dcc7cb2a28, 0x8e511961e2d0dea1, 0xde404ceea3913c42, 0xc31c6287b4a29929, 0x68bd8b2480d073c8, 0xad1ff8b39cbb148d, 0xa49c703508cb43b1, 0x2842823b6143f385, 0x1617a61b1,
+0xea319e5d7e7e76b0, 0x4800d6b71f6d9878, 0x89fd31ee1b405178, 0xee095f316fd37c1b, 0xac86defba2f404c4, 0x653c402015ae1ca, 0x56df369521daa535, 0x169b90aff8c7a145, 0x322a720be99363d3, 0x1333bfe9b,
+0xc7b196f5aeed22c, 0xdfe2e0cb5205cf1e, 0x7651c44d8e48852d, 0xba6dbce0b20017b6, 0xea1d5da6aa57e80d, 0x3a379430f57206b4, 0xd6afbf46f2b25a3c, 0x2339994a50bcc0a2, 0x9cd1678f7a04d089, 0x273067e22,
+0xe22655a9619b0e44, 0x46b6b7e33dccab2a, 0x7da0307c0e059384, 0x3590c5c3539ff2d6, 0x82fb83bfb581eb07, 0xbd224bd5e6d78ea0, 0x63eac04877461927, 0x24b1940d8491b627, 0x9724605548b72aca, 0xba323f9d,
+0x6a2ff83a51cdaa0f, 0xa2f0357d93f32fa0, 0x8b4ba1bc207b0e35, 0xdb1a307e9348fb2d, 0x7f288e2cfd2bc8be, 0xcb544733f60af037, 0xf943e60d4f0b528b, 0x45b9c2d43ccf7def, 0x722e2d7d1f8b4d1b, 0x15f6ad9b3,
+0xaa83b42acc9529cd, 0xa553dc6653629fd, 0xba5f224e60350c72, 0x22aba80448f2d19, 0x66a4723e5e23139d, 0xd199ca269de44159, 0xa3e9a8c09cfdb9a6, 0x320542af98dcb58, 0x1f6056c0ddd6a24c, 0x40fbb08f,
+0x7b879b0f859277cd, 0x790901a2e049c471, 0x3117d60bbc3dbebc, 0x2157656ba8290cfc, 0x4f5d4fd648a9c5bf, 0x73936f9ea93c3638, 0xa9265ebcb70f97fb, 0xebd7e582fe9062e5, 0x8fbefc34c17afe8e, 0x160e2fc72,
+0xcf11b811546d2a9, 0x263d709983818b76, 0x40abca0d0da71be0, 0x9ca882d7ea9591e7, 0xf1faae5a2b4c93e6, 0x17c4836c150b98a6, 0x74b8159243116532, 0xf7f0f8221d68a52c, 0xc54e4f62ea7af839, 0x1be63d589,
+0x9baa4adb92560567, 0x55030392041ce737, 0x347f87f5cd75f9c4, 0x582c1192e4f22f21, 0x4888a0ca4db2b9a2, 0x94cc10719af8e273, 0xc039ae7e5d1b65bb, 0x1b6efe7a8b28d49c, 0x4bbbd18e80e2e396, 0x27317dff5,
+0x9c91369dc7e37468, 0xff512c69362fbbef, 0xa3f06ec556ab36a4, 0x828415867a141a23, 0xc008e28288bf28ae, 0x6d3608dd7f447f61, 0x7a464dab86c70b3d, 0xe19e9f35aa5289df, 0x235a919a4a42981b, 0x23d85bd16,
+0x37b9b2acb23e1e9c, 0x81fce7b5edc8494, 0xd18c31e21123b38e, 0xde6d70846de6ede, 0xddccbd317772d965, 0x4ce03710a22e2072, 0x7a0583e93c6d9580, 0x5d94b0e197a1f15e, 0x968d29cd1aeb0477, 0x158767636,
+0x6df05bdb4ca2e424, 0xbd1baa40a85a1c59, 0xcfd30c0d11b7b8b8, 0x5da76089638b1c8e, 0x4908ba3f2191f4ce, 0xb5ddd249e91c73b2, 0xf095800b9986e21b, 0xde8b239f653e497, 0x5776f5213fce557e, 0x1633cbf65,
+0x67f4cfdef9e1d23b, 0xf47ff07189133f9f, 0x21e58b542797b343, 0xd257e87fd8255a44, 0xc89fa330a18f5081, 0xc55c12f5e5f8e4b4, 0x6e368346c857836a, 0x97e10a9821567e04, 0x622b66db3bfedf20, 0x1014525ed,
+0xbc0004e1596d8655, 0xc3a69444a2d73ad1, 0xcabc9641c1e0803a, 0xd4ec11c55144f140, 0x229554f2e9b23d01, 0xaf2a058971e79c18, 0xcac6ec7d0a6f4852, 0x31e1bd0c683f6236, 0x2bb45355b98ed60c, 0x1cc3702b2,
+0x4a8d40e85113e517, 0xcaf74614e0279f95, 0xe4cb7354aa2dea46, 0xc0ae6fab111fa8dc, 0x18f6f0a8e7eb49db, 0x5361bb1316f84939, 0x1e7efcd0659a83e3, 0x596b3d5625671725, 0xf79684276254a231, 0x17508df00,
+0x9020bc0a908aa634, 0x6fc4a3e7af1d87b2, 0xcd831631c1e6af26, 0xe39b41da537ebe5a, 0xcc15c788379c2b83, 0x88c5df7d783ac290, 0x7c8659364445bb66, 0x1b85609a0c65e54e, 0x76685c7fb06338ef, 0xc9a2463c,
+0x12a4960ec02f05dc, 0xf3095bb25e133731, 0x8b22a6a12177e1d5, 0x9a9d57497c18dc69, 0x45ea18b47621f582, 0x555ce18c8205394a, 0x7abab296d6ebf0b2, 0x7e7d132391d69014, 0xc9b09ec2dc0b8712, 0x16e93338,
+0xb4d465e80302a744, 0x489e08e6375291, 0xe8dc3bdc73392e41, 0xceef5b11feb686e2, 0x1c5552c3d80b5e4e, 0x362bf1d5ff4c304d, 0xb89f6e8bb1205fb6, 0xe075286b2a338309, 0x56892659da477d05, 0xb9b05267,
+0x7e612856282f0fea, 0x1a9d56ec4dfa6d3f, 0x1872db2a5d61cba, 0x57ab6dcdd4861321, 0x780ca44ef173034a, 0xea66906b0d9e6d1, 0xfb26790ea7e8ba45, 0xd46de9bbc13e58f7, 0x64b5e4446aa034c1, 0x1d176145d,
+0xe7503fed10da98c, 0x60c613a626a0c6dd, 0x25336cdab28a0c6d, 0x902d0c8cc3a5c9eb, 0x4e0f97652db6e07b, 0x45e6024edb509595, 0xa2880de157119029, 0xc866bb826365bd00, 0xec48217d6afc7acc, 0x2173c7c93,
+0x2c937b70fcce331d, 0xa8c0a45382981509, 0x39650ce75eb6a297, 0xb81c766580f73748, 0x74c2f8c6805573ff, 0xc469151fe887c1a7, 0x56f26be116c00a99, 0x710cd1aa007d59b6, 0x8894667c90705b5f, 0x423e5fbf,
+0x57e2927d19201731, 0x6faabfd1104a0000, 0x4df46c64a0afdacc, 0xff7abdab21cea4cf, 0xd92a20a345c9c967, 0x6c1e3e1b7882e46a, 0x2d3ee416741ec6fe, 0x3678a42355b323a1, 0x8658108a30c67584, 0x125406614,
+0xad8c39d384b6c7c5, 0x9c466c6d4a5f8de2, 0xdc64774f9d38bfd6, 0x4a825d53b635d90b, 0x5ed14f47d54b0a23, 0x3e3fd7501eb53033, 0x26605e0e4aae137f, 0xb73a3b4e51d2a2ae, 0x867c9d72b652c701, 0x617227ea,
+0x2550094d4708c8e6, 0x5a31e8cc9e77fb83, 0x1da143f22d3d9047, 0xc1d1518e17210314, 0x4d883c3a34a0af48, 0xbd4da74fbd337708, 0xd49e9cafcddea4e9, 0x235134dfcff73926, 0xa20690d822450c2a, 0x1b46a06a0,
+0xb3246be7c3314dcf, 0x11b3d180e52bfcc1, 0xecd85cb59e537e12, 0xe78c2a56a0bab40d, 0x543672cbb9bd6989, 0x15ce3f1ea05acb9d, 0xf4e887143574f653, 0x5553b1255e390c18, 0x47a9ecacdbc674e, 0x22587a21,
+0x4e076ce7bbcaf730, 0x513e9a9b4602448f, 0xfc333e98da5b73ba, 0xe272e353f3a2e084, 0x1dd148b577fc42ee, 0x21bfdd4d2b60364d, 0x36ea2887827f8294, 0xb2fa0fbb2ccd1fb2, 0x282ee98e1c1f4770, 0x2164afa1,
+0xeed705fb07281a65, 0xcc7c2c465f39dac4, 0x669070bc0b26d10d, 0xe44bac912dafa52d, 0x7844c155693d5712, 0x64a1643717716c8c, 0x210a5176d2e70894, 0x8db9adf79fbd9af5, 0xb2294953df21d606, 0x2a8283c6,
+0x9ecab4d753f760bd, 0x5d92cb9f1e0098fe, 0xc694f6b42047b5e, 0x9349933716537f6f, 0xa499d35233d75896, 0xa3a7b62b3c68bb39, 0xd6e7efbaa2f03c1f, 0xfd16046ec4838e86, 0x935aca94f76f493f, 0x1d2889433,
+0x8e0d063e7d2722ec, 0x45718b76da5e8514, 0xfeaa8d970bca28f3, 0x67f44ff7de4af92a, 0x74ef599eda2ae6da, 0x404c2511e606784c, 0xd14bda63e47d717a, 0x753be9efd46ff7ed, 0x7d75acf1280a0d39, 0x1237af34a,
+0xe7ec179f8444d238, 0x925ea4d473ce5bee, 0x9ecd377d9d6b56d5, 0xf4cdeb248330968e, 0x5b73d00d4c0fe26, 0xd3643889ef6909bd, 0x2656cc4b4c5ef9e2, 0xebedfab23e75272e, 0xfdb75abf3de90d92, 0x5335e0b1,
+0x9de6e18246b5f998, 0x6672241cceae8b56, 0xb46cd61866a231c9, 0x7fba8ba170a53eca, 0x6f572eba2a369e35, 0xe59d19572e067852, 0x13d4a70be4dbc8d9, 0xb34b080a20c7a8f9, 0x626325df27cfd2fa, 0x1b542a290,
+0x563bde9037af2328, 0x4921694ec77c686, 0x5ce448f17db21166, 0x5fcd622f22c1171, 0xcd0cff9aab535222, 0xd373a7ad66b53074, 0x834dc10a15bd1909, 0x72bcb479ca5c23e4, 0xefda60b166c7c343, 0x236d7b870,
+0xdfcd3e214aadcb02, 0x20521cef5507c863, 0xde24887a5d4d4e48, 0x3c36a65fadf22d89, 0xb5e67cbcfc31001a, 0x9333f77c9aa2f99e, 0xde1150d5e84f7a72, 0x1b7c1499b0917d20, 0x1b96b09bdf2702e2, 0x1c731a4c1,
+0xe1421b1a60ff164a, 0x6688f65d5704ee0d, 0x824635ddd5ea6288, 0xee5df538e11bd39f, 0xda387cd684d8969e, 0x143d36e647f27793, 0xe244b508da1e9a67, 0x6d08240e30af7158, 0x9ea4e7d502d5418b, 0x93b49a75,
+0x4d8d6ae1301ae812, 0xef0506ca2a06363b, 0x17a4cbb301cb0b20, 0xf7a6c411f9950386, 0xa11ebb6350599a55, 0xb08838d2257287a1, 0xe374708de99247de, 0xac353494c39af7a6, 0x134a5ad20f165ec6, 0x216d579c,
+0x3532f9a8208fbc14, 0x4025de5be3f54d06, 0xa68323416f1fd188, 0x65e57b8b843e0d7f, 0xd4e3df27fb5eca08, 0x886321225d4034cb, 0x9b23c70e58e4fcc0, 0xf5ce0e71cf3f0009, 0x51fc36f81b313e25, 0xe2ef4ba8,
+0x385ad3104cb5065, 0x44178781d50b19d9, 0xc24bf447bdcf3b5, 0x2f88ca0dd6fa6d46, 0x6e07486163e36aa7, 0x9050a008c5dc83da, 0xffb0fbdd697eefde, 0xf8bbab02bcb75655, 0xdfffad2c3bdd7449, 0x2183cd65f,
+0xc61624952207b6bc, 0x13adb7d4d04dbbe8, 0x8669aa2c0bc60747, 0x16339a068debd3f6, 0xdc2ffcfed98396b0, 0x6daada1b0539fae9, 0x1be3287ace75a6fa, 0xde5d8b14411da911, 0x3dfdb35098caf6d8, 0x220ac4e01,
+0x2e4b496ed7839c44, 0x4520463e9aa45744, 0x982ad67fd0d3dc14, 0xf8d23331895f61d0, 0x493fd561264735ca, 0xe9a2b873a82ea110, 0xdba2adf70e04655c, 0xd7a78fd28b38e4f0, 0x33f19a8670e59737, 0x7107ca87,
+0xcd4f7c589571cd73, 0xa1f4d1bcc02be42c, 0xe3402d18cb1e0912, 0xff2961da371bb180, 0x6d8a64c21917a330, 0x8a7c36e70ad8ef89, 0xa2abb0a487ea7165, 0x540c11e3da8de4b8, 0x4cfcce72d7ebade9, 0x1276a7554,
+0x5ea015c2b8e6bb93, 0x2a1acc787e47888a, 0x1e558211a72dc09d, 0x5ed0e820ac9e8399, 0x7de3585e3c674a91, 0xea6afaa36a42e942, 0x6a6c97b8767320f1, 0x11be633057e752b2, 0x8d2b821c6e98a93a, 0x4cc77c8f,
+0x562e08bd3d85480f, 0x246ef47e35ec08f5, 0xc3f734040224cf07, 0x7579c3045d9726a9, 0x3665d0ee471f5068, 0x1def43edb6cddbef, 0x466926331d8e1214, 0x86162065b69fb7ec, 0xae2894f1412e050a, 0x139a3099a,
+0x714ff97458f33a4, 0xfa3152d925d214d2, 0xdf21d44ea6a73a62, 0x38e70783720da85d, 0x993a4a0d42782553, 0x5938360d4ff2be9, 0x530023d3d9978725, 0xc31e07a67ca1c069, 0xeac7fc8e927e056b, 0x14cee1d23,
+0x34dbe4926e9f8947, 0xaea85f03dbef4131, 0x13abc194f9e0c734, 0x8adafac163ebdce4, 0xb6c980b69e0593d5, 0x727f6516ffe47cbd, 0xba95e1d48785548f, 0x8e954bf925ac4011, 0xf96b72378752a060, 0xcc94cde5,
+0x8f24d235aec893c2, 0xdd61bb0fbea0c79f, 0x1818a6acefe3e179, 0x3cbe74f3576a40b6, 0xa90891e21b46eb91, 0x775c468d1e817384, 0xe477e5ff558883fa, 0xd8ecd9121cf6c046, 0xc4b6a04c03f0485a, 0x1b8b7b12e,
+0x68d0872bbc091a56, 0xcc4dfc690fe60007, 0x316f82e9d91d5d7d, 0x71f3c51da9e79777, 0x8c2be7abf56911ce, 0xfaf13cadec413e2e, 0x5532fe685de19cec, 0xc9d538eb1de4711d, 0x8e6364b8df309e8f, 0x1fa11734b,
+0xf79af60b2385cfc5, 0xfeab72775572bffb, 0xe4bcff1a2d0b8d03, 0xcf65706c6e7889f2, 0x8c8f8f6994a56bf7, 0xb5bdc23f88af539d, 0x880fb6044641f3c3, 0x2eceafde703c6e22, 0xc57b890530b396c7, 0x36321d3e,
+0x12d5dedb95e5853, 0x8630f0f06b44dfba, 0xd323db5c11adeffd, 0x51993682bd786d71, 0x6e4ab5e4394d558, 0xc7ba662ebf66e108, 0x723488aaf1f29d21, 0x8e8ad04ecfa9abb8, 0xe2775807e2689c3b, 0xcd6d773e,
+0x4eb39d3a66c4f79b, 0xea46a0214b244362, 0x240860408d1775c9, 0xbc932d3df1382e7b, 0x5b71abd9d9f41b3a, 0xe9955567b71da10f, 0x57809843ba775d5d, 0x4c2bc886604cf3ba, 0x925a05634379136c, 0x112f37be5,
+0x7c67ab30685620a7, 0x84e0518e1166e716, 0xda6575f426c61387, 0x4f1ec01eb32512aa, 0x18464f3c3c840a06, 0xf07f244a802e944b, 0x452d77248d7b9c54, 0x53657e590bac879c, 0x2ebf3a8cad43f6da, 0x88d58215,
+0x2847f6f937cc6b88, 0x69aec135fe98c610, 0xac282d41908a43de, 0xb1803169d377f194, 0x6fa9ddbd2c6fa55c, 0x6e8fd535e3d010f9, 0xebd339e64a103774, 0xab1f47d3f66c6d8b, 0x2932b292681c0795, 0x99c12204,
+0xeb9e32733fdce611, 0xd14246d78152f293, 0x3c20ee706fab849e, 0xe0b8947fc244f7ce, 0x78d0ea8ae973ae55, 0x115a59ea0add8c04, 0xf5e5e9e744b9efda, 0xcd96780b8028abd4, 0x9a45858924963ec4, 0x1107c5db6,
+0xe51abc9f32f18cf, 0x200bae207482dcc5, 0x6a55f1d226f40052, 0xce8e5b1d12f0cb0b, 0x24a33d866674733f, 0x557db13e7769fe53, 0x7af2fe383225641a, 0xe683c6b289acef24, 0x7a6b3da0bfe73bb, 0x45b79277,
+0xf34f3369ea96d643, 0x33bc28f12e66e1c2, 0x4c7ea01821aeaff0, 0x7a4b0de360761781, 0x66abeeb550371e01, 0xe3c3a385c4287157, 0x8c9d1d39a11a17c9, 0x7082474aa11a8325, 0x1b1385269a676bd, 0x2a8d08da,
+0xfc59bb3c9e94b6a2, 0x8b8113592af655b6, 0xd6c8e86ad051ae4f, 0x67cffaaec77c06f4, 0x7923f1541fc4948, 0xd7c09a8434f996a5, 0x58b044dad1cbe06, 0xf61ade25cc5731db, 0x36ab3f8014305564, 0xdb5d7f5e,
+0x37fbd1c1236611c1, 0xdd8f0e97509299a7, 0x57d0d609738faf78, 0x5cfcb887c24be32a, 0x456a68ee17c0daeb, 0x1940a0e12d00b307, 0x5a18cbe1960c23b9, 0x279333f7a713d494, 0x6c25abc744aec3a4, 0x12be537f9,
+0x24effed3fd72ba24, 0x5302db138188205b, 0x3a8aa7d3674589fe, 0x179ce89326d3d8cc, 0x701fac0f9dd469e8, 0xf8901bbf838542a4, 0x39064bba76ec8caf, 0x8b808dffe0e80582, 0xf227da4ba1711ff5, 0x1afba3a27,
+0xdb0a826caf7da846, 0xf071d65da66fdf72, 0xc306d5e562117039, 0x6d0cab73af9702c2, 0xfb89ba4f85219cea, 0x33acbf9d6cdbf345, 0xf167f727c11b8e4a, 0xf35161ac72cc3d1b, 0x10365ff85e40dbe3, 0x1c28caa7f,
+0xb6fe91d92758da68, 0x82fa11428bb2906d, 0xce21705e76a090b, 0x9a234281fff7ef1f, 0xd815c05a781a166e, 0x3ea287f4e682ef82, 0x95dd14a9c20f103a, 0x5abf10e94cf61498, 0xa86ed16c5a8a4372, 0x17a27aacb,
+0xeec90f0d626826df, 0xc9cdd2eb6395af06, 0x2707c8fc58670365, 0xff3be232d86e85cc, 0xe9d18386c0abfca7, 0x7f29564f283283b5, 0x364e1df2188ca7d4, 0xbc365bdde9deef83, 0x9859274595747964, 0x25b98b674,
+0x79e149327cacff43, 0x1487dd4f46821f75, 0xe34fb00f702b6760, 0x34e193bb4512af8b, 0xb48cf15f6a20a616, 0x160b9650811d85f1, 0xd33eae3f627b6f64, 0x501e6b182f0df15d, 0xae5878ddd5c241b4, 0x1525be08e,
+0x153f669abafe10da, 0xdc0cd68052a71fa5, 0x5ba01c34c0524291, 0x4d112b09897f5c15, 0xf3bfff8e48f526cc, 0x5232af18de7d9019, 0x2c17d1b6fb68e4c0, 0x3597519b24a35792, 0xf243f773fb2cc19d, 0x19ffc1ec,
+0x953eaca38cdc98b9, 0x1eb28447b9121055, 0xd08b31c7a6fb6d29, 0x3e22899e89d8223d, 0xc7305f51e14558f8, 0x3171e1390e25dd56, 0x92300ef6096e44d, 0x2fab8338ef43c368, 0x5fd1e5995da0a6e7, 0xc446abae,
+0xa0c0c48a2889b892, 0xdaf26d12627e6297, 0x1d90dbc05990cbcf, 0xe3de27fd4dd55627, 0xa18e5e2a9e923104, 0x7b48bf88a0d4462b, 0x5ba93d1c8aef201c, 0x8135ad453446f076, 0xda3a758f545b7b41, 0x63feff7e,
+0x4321fe0bfea9a0c2, 0x822d511c0c39366d, 0x760385c39b5878d, 0x11e885601e1458f0, 0x43e9f8247dd22e8c, 0x8ce19b7e235ede0e, 0xcb26e02910c4effc, 0x9a48e4ae5f90c7fa, 0x955bddb859d24777, 0x2797621b4,
+0xa14e319eebef1686, 0x1b384e3e43a0cc02, 0x680a3558c1c9d78c, 0xdeeaffa05bd50a5e, 0x451472879a532d4e, 0xf618a8d3ebe2be60, 0x82c5e675d2b15d4c, 0x47f5092e9286a838, 0x19c016fc96e2ec40, 0x1f50ab826,
+0x700125dcc2c1975, 0x3ab1b7430e892816, 0x435b704099c8a6e1, 0x299a3b07283553e2, 0x1553895565879c6, 0xbde4430b9052c445, 0x8bbcba22c93dd5f4, 0x83b4aa41c520ee26, 0x7e5169c8b0b9bc8f, 0x81ccd0c6,
+0xa0b974259bd9d478, 0x45651d9be007ee25, 0x3bbd0ca3b76cd696, 0x78a8174b3e98450b, 0xd6ec39336a3ec5ce, 0x8facbf653ac3f760, 0x30fb49d2b48f15ec, 0x67b89d6e8faed6e3, 0x1d561431f0543b05, 0xe567ebcf,
+0x644cdb2d2aa424eb, 0x8130f4510a9cba13, 0x128dcb969e835455, 0x8454f6b495da5442, 0xe55b22d8ca203fab, 0x231bb1bacc446f7b, 0x614636a0499d2195, 0xe9056c9a18c13bd9, 0xdd8a2f666053f1f7, 0x215291de6,
+0xee2bcb3f395cbe5d, 0xa16912f5712ebf2, 0xce9065026a5a9a23, 0x30c540cb74e5a004, 0xedcef355ae6102d8, 0x29d75e063be1cdd7, 0x44c92442f9082783, 0xef7c04a4c86f4fa, 0x3a51c9830eb0c1ce, 0xd731a90e,
+0x97d5e3d012bde5dd, 0x26d40493b6f7df0c, 0x1b874cae1c9893a, 0xda8f52a07e138703, 0x8ef31871e35976e1, 0xde3d8c7da662f814, 0xa2760fb1b5f4abf7, 0xd06c9f8a487caefc, 0x37d0db2184a36787, 0x12bed3bea,
+0x944b06e34afa642f, 0x2b4f394112b92b0d, 0x29561fde1e54a260, 0xe649969751416e43, 0xc92cbd60ed457d7f, 0x59515eb98c34a22b, 0x180925b6970beb98, 0x29d763ef242799b, 0x4852a597231331fb, 0x20acc5303,
+0x49a2c9e557f28de9, 0x86c8ba8588136ec8, 0xfaf3733eae0e5e2f, 0x780188a36d48100e, 0x9036220079a8af6b, 0xbf9bfe90768b90ea, 0x80b36139cb586c18, 0x1ef0aba11abd3e8c, 0x7d4d3d18796565ab, 0xf130070c,
+0x1af62285b498de10, 0x1c5326e68bc3f212, 0xd0cb200994fa747a, 0x71ebf62b46c5a8bf, 0x282054aad6df575c, 0xe12adcec43e8701b, 0x96f76d24174e4508, 0xdebc71522dc90d74, 0x12b332dcee5c15d5, 0xc075694c,
+0xf54a213450bf1f0d, 0xc4551e76f716bccf, 0x482b3e28eabec973, 0x61cfe5f66fb6c828, 0x29c1e19e5583d84a, 0x9ccfff94debb52c8, 0xb09bcdefda81a495, 0x19e760769cc0a51e, 0xf00f43a98ca63f23, 0x8a6067a0,
+0xfde6bb008ecebea6, 0x81f3cd1845eb6b53, 0x951086890214684e, 0x320a7d0884c82798, 0x212d6d5243f44b43, 0xd356a6bcde31a9fa, 0x3b1774904d2835af, 0x9cff88d21a61ded, 0xa5b79d61b93148d7, 0x7f6541d,
+0xdde5b52d09477d1c, 0x9fdce3bce8aa1f69, 0x1200b7af58fcb209, 0xcf9ef42747508c48, 0x8b47268794e87c1, 0x8c5feb0b5624d2c5, 0x6ac8f2d513f26c7f, 0xe653bed0d8404b4a, 0x84c56b5b0ccd373d, 0xde838c11,
+0xafc6b268a5b7d436, 0xbdf2a64fed52640d, 0x84f2560a5d83c323, 0x956152dcdfb02acf, 0x4ff385f579f990d0, 0xa57288de43a83abf, 0x44d11968501dd9be, 0x715a3f0837466c9e, 0xf51996d992af25e9, 0x18913794d,
+0x4237e22cbb18e3ce, 0x1eb6b3931778e8e4, 0xb0f24190e918d69a, 0xd4f4b3683331c96a, 0xa9925814e74207dc, 0x7e333900a2b5a70d, 0x5aa4bd44bc55379f, 0xabc9854e993d143d, 0x21bc0f576e4c0443, 0x1e8158975,
+0x2ede93253e166ede, 0xb58333cc0ef6d542, 0x197bbf397795bb8a, 0x53ad320db6913fbf, 0x44e2e26a0e328cbc, 0x2d6e6bd5408f2928, 0x6a52b8afa8d11fb4, 0x791bd41d63573dfc, 0x3f293d0fa8b2ef2a, 0xae305729,
+0x84dc639c87d16c9e, 0xe6638d0d3750267b, 0xa5c6d3d6e96f1094, 0x7fc2e424a34c8ba8, 0x5711455b9e2eef86, 0x318d63f86807d313, 0x9d684ed0018a11a2, 0xf77fdea80636b084, 0xea4b2ab240306abf, 0x1d4f7f8f5,
+0x333e8dc5702081a6, 0x4e7849b3d311e3e8, 0x8a04268652ce3dfb, 0x3d7c04e2d5ec58a4, 0x80f50ac4cc130948, 0xbc5a719513b826bf, 0x90ada3aa0aad6550, 0x2b99655d0c618881, 0xeb20348be10497bf, 0x16d0add72,
+0x80bb3622b2168487, 0x1b4d49ac6297131e, 0x607e20c70bf5a700, 0x72e434d04e08d21c, 0xa455953e7ab26180, 0xceeef01b55928ae5, 0x9d8f70f4b1eb0e85, 0xc42338fa0240c73f, 0x2ca1d90b2f716264, 0x1c589475,
+0xfeaa919a54723f8b, 0xadedd668298d526c, 0x32d6eeab4138b8ef, 0xb447e9948879e7de, 0x4b9274a43073e7e2, 0x41165f9c4cc34152, 0xa5c6e8e2b37d63a6, 0xe5736aa8b9971864, 0x56a5354d5096044e, 0xcfaa38a0,
+0xb4a7d0fad4524e7, 0xfe90ea345650e92, 0xa30a793145e21d50, 0x72c8abb9911c57e6, 0x1f2ab15ee44a47c2, 0xe59d051266e32715, 0xf0837859b9932d62, 0x4fc464354653eea1, 0xfca074a16ffd6a6f, 0x1de734357,
+0x926b4aef51b2e5d5, 0x44b260e86fcdd95d, 0xaae877d36116a0ad, 0x74df1a8908c019, 0xf684c223375951c1, 0x8ff840e7515f840d, 0xb3d4363a48d8a072, 0xb57564b4a4cf8f08, 0xb072ad5bb13e9fc9, 0x121aba54d,
+0x26358fc653211666, 0x94e3937d2f0b2024, 0x33ce3c3474b40958, 0xe60fb02fe275703f, 0xb7e7906117fa27d6, 0x7a51e601a84c644b, 0xfe480acf3360d77c, 0x50b16e8932ba7bb, 0xe05c266e5e5c9ca3, 0xc4e9be0f,
+0x56e4df15d414f03d, 0x7056e76b685fcb1, 0xa5045b9363391834, 0x2d42f94e6752e6ac, 0x7ea0d5c05e2fc95c, 0xafe276269621342c, 0x97929c29aeb9028a, 0x74891599968d6ffa, 0xcda05a845c9172c2, 0x114fc8d74,
+0x2780d4445a03a4dd, 0x8969c476942f8036, 0xb4ba6122c730cc8a, 0x961afaa5d73c97a9, 0x857ab5c20c2159b5, 0x27c2d8d8c868e8f7, 0x212c51dc472d6244, 0x8f06f26f0611fefa, 0xfe22790737fabcbe, 0x212fb570a,
+0xd819b1f7cf728bca, 0xdc607c6456434523, 0xcd9f4147f9c944a4, 0xf49af9aa90f49fd2, 0xf9e284a150070460, 0xe65b759d4f248c28, 0x6d7e05e9ffc2d9d, 0xa98f418652d1522b, 0xe043164e49ee9e40, 0x13bf58e5a,
+0xac597c4bd91f685e, 0xabe870da53bdc631, 0x580ec5b75f73f3f7, 0xdab831061bfc0e10, 0x68d97f0786993fc7, 0xb94ee536f178e197, 0x294dd4d065bbdd0f, 0x15ef6b8dc1116efc, 0x754b71cd9c659999, 0xf5e68b4d,
+0x5ad017f412f9251c, 0xb1f15d915aa98fc6, 0x55bd336f2f86bbc7, 0xbfafbc07f8350b9d, 0x1711caad3de90b9a, 0x6cfcba7bfd98e875, 0x19ea96a6ad5d1816, 0xae34053bcd4eaf53, 0x691fe2a23eba8747, 0x51200c84,
+0xaece38b02f2e48d6, 0x3d70304a93948621, 0xf95871e7318a5f2e, 0xdfb09168e3395c92, 0xa76a4abc5b91ea35, 0x400a4527f054d848, 0xbdfb1efa84d94553, 0xdc7da43f455cf86f, 0x7e2f99c2f70b27fa, 0x2410a5be8,
+0xd9a4c9318777b336, 0x5690c95bbac0ebd6, 0x489b016f18575dea, 0x19bb11a189b2a50c, 0xa4a83c30437e2c75, 0xcbb4d613d1e0523f, 0x2ce57d7423b7fa1f, 0x73988ed0a3a3ffe8, 0xf56033488273e3b2, 0x1070bf3ce,
+0x6a0efe4a004d1718, 0xa602455dafc6665f, 0x56abb91c3c3e5745, 0x3da275433a77eb3, 0x392da9005a9a35f9, 0x79709f4901e481d9, 0x232303bc4254eb58, 0x8ee893f365f7ba0b, 0xbb4b1eaaacb01df2, 0xbf1139d5,
+0x4852c6e78a4071dc, 0x207c9ec61f834001, 0xb4448e36141d7899, 0x81bbbe94fdf57481, 0x2fde06e1f31da7dd, 0xe8d773e455e3904a, 0xbcebc929f93c8884, 0xfab27fcf07da88fe, 0x78574bb9e4618caa, 0x1e231f565,
+0xa8aabc79a95bc8a4, 0x5a5b2b1d7c9a581d, 0xe3e42e6bfcbc1c6d, 0x5c94d2b06833c2ac, 0x9734d1d8dc788046, 0x75e8dc2a77e627c8, 0xd382f48ebcbd5ad5, 0x356461ff2b6edf8b, 0x35b34a20d0ca13cd, 0xa30eea6e,
+0x999dfa38360d70f6, 0x122c9fd7b6307802, 0x674f67142cd76ec8, 0xc28396e1ff45e9fa, 0xbe62b50ddde69aa8, 0xe3cfc68f69196240, 0x4b828a1dafad83f0, 0xc42ec0a8d19f5cba, 0xffefc1707e62a7f, 0x15bde5bb8,
+0xb0969953ccdee419, 0xfdaf7a0a43558bff, 0xabb516d4368aa6f5, 0x8c3ce4cea2980381, 0xb9126d5a7a99ec7c, 0xaa9ab73eab4f2a12, 0x1dfd60222508a300, 0x954269f30e6553e3, 0x25411e6ce9f50273, 0x260c6a63c,
+0x5b04abd2e21e596f, 0x515414f7a8717586, 0xfe0fa78d5b78de78, 0xb2b96b36ac644166, 0x42920e6ac60ce3a3, 0xa74df1b5763190ac, 0xdb111c18e8518fc, 0xe8c00dffec70b658, 0xbe9875187b7282db, 0xd8d583d2,
+0xd3d08302c01754e4, 0xe1f89bc5769ea533, 0xd225a3841bc19450, 0xcda260800b19cfe9, 0x87a883feb6b3d74f, 0xc14b7799f153c7a, 0x7b0c7f8e78be8c59, 0x1b5efb7ab7267777, 0x691e840a3776ea94, 0x1caa3406b,
+0xd6a2d0625d25463e, 0x4ba4f812aa22d923, 0x23f45a04d0d97276, 0xc24cc05a9552423c, 0x21fbc5f7862cc7b5, 0x7da9ba8181f89963, 0x5d0ebb52b12e3559, 0x9f065fe54b5fc41b, 0x54699c221ce56606, 0x1a5ef46de,
+0x2f66777b5fad5a5b, 0x7cb4d256a7cd3cb9, 0x8779ee0a6986b732, 0x40ab55f0c1df32aa, 0xcad03eb2a8d964c3, 0xd419d0fcd8bf4382, 0x1590ff1f2498ebaf, 0xeec05008d6a0ad3b, 0x8252f6aa87db1a1b, 0x1ff3a175d,
+0x36ef775f3f0e6ca6, 0xfa516ca83890a2de, 0x262c8436507ea905, 0xcb885042a877188, 0xac94a3d7ed590fdb, 0x5ce2b68558388b79, 0xb3d4d6a194e4cd6a, 0x961e2ff99e221c90, 0xe1752a76ab94e8b7, 0x15b17581a,
+0x911b5820d15c3d95, 0xaf9fed73f997ec78, 0xa6f968f857335995, 0xe51f88976abef825, 0x78b4751995f28ac4, 0x35bb2469f0634cf4, 0x79bd9f4e9aac9fd0, 0xc97eaf1e4d1586dd, 0x901a4bb262321c85, 0x7fb5b099,
+0x2a1b35b4e98327a0, 0x622f6bfaf9eaa8eb, 0x6d0e9f1bea62d15c, 0xe898e0d17a3a3014, 0x9ebf0a6222e5ba71, 0x27fc1ef7d9d35ad0, 0xb8bc8a89ba613055, 0x85c3155582fa9aed, 0xc1cfd91befe71bdf, 0x11b584dbc,
+0x96dd523a1d785112, 0xc2b32f19a028bb9b, 0x8e6f5c471d04b682, 0x18d3359c11da338a, 0x32c86abfd9db0f4e, 0x53709862213f4f11, 0x61fa55585380b76c, 0xb47daf26e3535f5d, 0x8e4e5e518cace1c2, 0x229fcf7ba,
+0x71d2c3945ef62a26, 0x2c3dede2c0c4ad86, 0x1374877eefd802a2, 0x6fbf3d0224248837, 0x8274799909840bad, 0x2294fc23e3d8204e, 0x47a1be70759f8c7a, 0xae324aa8d370a4d5, 0x59fc5bf347dff6b7, 0x16fb2452f,
+0x9187848c6d2eace2, 0xb2ca637339578b79, 0x8646a8a3f9433fdb, 0x90b210d84111a21b, 0x56c4b5e897fafe45, 0xbbc42997aeb0c7e, 0xc0aab45e109f539b, 0xdc00ec8f1f083a00, 0x2cc885df901644eb, 0x25d87ffa9,
+0x2e2732711e297c84, 0x71078530fa84db5d, 0x91d89e3ca53c711e, 0xa8221757bdd71444, 0x6d7d15eb77684aa6, 0x4de168cfdcbdf7d9, 0x8576e3ca08c5c683, 0x186822c26f6d6372, 0xf2fd5fe934d37e0, 0x1827a3589,
+0x3a8c106fd0b008c, 0xc0b5434c4e1faa20, 0x361d3bf01f749784, 0xd2892ddf6a640ee, 0xdbe3760ce00413cb, 0xf3a6226693a88d69, 0x611c12e3a0186f74, 0xc302264701d67a6a, 0x30d8c132dbce6231, 0x33f28df2,
+0x1e14ceb74680bfa5, 0x165c5e7b6b33568f, 0xc67e9606ab4bfbf8, 0xcdddccb5c3500c6d, 0x54cdece1b6210106, 0x5ec5291a792e62ec, 0x5655757c2113f94b, 0xd6c55255a9510fe5, 0x84e1edc3660f6902, 0x144c94827,
+0x470e775aa3988564, 0x972309253380a2c, 0xf004f1c9192517a0, 0x1cc4cdf2088d173d, 0x14bd04b4b2725b42, 0x710388a92c7896bc, 0xd013186fb95b7b31, 0x20716fea2fa391e9, 0x96d42511a3ee4f22, 0x676e061e,
+0x77f2fa690a5a906e, 0x39a36cb5e06de2a5, 0xb24bda10455f36a6, 0x10c865059bb05ee1, 0x604cc37c93b15010, 0x413ce3ec722b3283, 0x5e1aa7ebee582e49, 0xc742f5af225ae3de, 0x8c5b1a373abb202f, 0x147457010,
+0xb0965b7df8642862, 0xc1aada6b101a5907, 0x8fa0e1bea22dfa6c, 0xfe2e772b4459595b, 0x5f68343be8db771, 0xe142c934c57af0a8, 0x250b25d3814c76ba, 0x25371373eee752bc, 0x6178583ff1ccc2f1, 0xa5645149,
+0x41e89ccb3660b7ac, 0x7909b5045adec3cc, 0xaddbd699f8e3d918, 0xcee37b5cb5f733a5, 0x701b344e349f233b, 0xd2b0762059779158, 0xa6df6e02716ab5fb, 0x1e3ae8b5449f0434, 0x4cabcab5bdd8ef0f, 0x2076798bf,
+0xc59965fc12fff6c4, 0x33dd4f2894c7438b, 0x22c36ea1879b0e96, 0x9af659221975b7fb, 0x4b5edf769589ebef, 0xf2be2ac979347d46, 0x86eea9294de1058a, 0xb512b7ce4a1d1c6e, 0x409cc7600b9ae66d, 0x259cac021,
+0x378678999c4f33cf, 0xb8e305d11a977511, 0xbdbca6d94194c92e, 0x3c1be1593d8c2148, 0x77864a0516df83ce, 0x80485b5a9896c8f3, 0x76b8b40a676946fd, 0x8d74f5544cdb6085, 0x6f553669163c8f13, 0x45ca450b,
+0x617d9cb830d3fdc0, 0x95e3d4fcf0d072cf, 0xfda86d6530fa18a0, 0x8744c59ba939e5af, 0x6bff9addae856fc3, 0x5932e59d8fe36388, 0x8982247851281218, 0x225c92e9197bd8f4, 0x7bcdaa08fc8ec03, 0x1adf760fe,
+0x9ce7fd2837cc4691, 0x7460032f37ceacdb, 0x58ab1867bbf941fa, 0x83ab8de2ea1e3cc2, 0x752957083061f9cf, 0x4f1b5f3d195e9b25, 0xc4d02cdb377cb478, 0x4e4077f448a89225, 0x4280010603fea485, 0x12e03f3cd,
+0xa55b7467a953b313, 0x9430252206992b01, 0xd25d2d97a9f28df4, 0xe98683b83bd9d9be, 0xa4671627813c92dd, 0x7d324083420ad08c, 0x1e02f2493accde4e, 0x41dc2ecdf21b683, 0x61093445f8b4fe61, 0xa322f5fd,
+0x781f4aa29ce2f58f, 0x5a3f311160ab92bb, 0xb46a1ae79af5f4ca, 0x5d46956ab05580b8, 0xd3b63d9ace2020f8, 0x1ad96cbd7af8ceca, 0x129b8128360977b8, 0x1067011d03b408b6, 0x22198dd5d4eef9a5, 0x274d7a918,
+0xd0917f90233c3e68, 0x383aa32997eda1b5, 0xf4c70ac7b587f941, 0xbdfce1f1d21c5ef4, 0xa63405e2f1e23a1c, 0xde3536bdce0e970e, 0xa98662d02765e776, 0x5ad1d2122f7d6bb, 0xb46a5e1bf0d9f856, 0xaa992188,
+0x9112a17296e8f04e, 0x38f4aec5839734d5, 0xc465f477326af217, 0x3db0b53136200b63, 0x4a10fb2133b61328, 0xe53cdb75cbe62a5c, 0x2f2e1bfe41553008, 0xb8942ad16b44e668, 0x9871ff80319b9ef3, 0x1946c9c13,
+0x7135d4a0f1b5d71d, 0x4a37285a5ffbe34a, 0x3c36e451b73966d7, 0xe9e2da915f7edd49, 0xaf12448a5255f781, 0xdd19c51ac90a97c5, 0xa265708b7d53ebd, 0xec10c29f02cc8d13, 0x80720232cbe79805, 0x181f22164,
+0xeacedcc4c0709c0d, 0x472f91762c0f6194, 0xb5c7847b1c8cf5fc, 0x130a1a9417248ef0, 0x83737293a24df19, 0x5da4048b45705bb6, 0x90cf854279ef3abf, 0x59438359aaa080fb, 0x9c11ce850d82031d, 0x1c1481404,
+0xd883065a4001d355, 0xea6ad6e5128682da, 0x1988dfb2920768e1, 0xc627ef3855fe2730, 0x7d4a0f185a46fa52, 0xa2bc3fd7cb9826c3, 0xe84cd86cd90b3f04, 0x937890aeb25e4745, 0x5325d2d22a6f4619, 0x48284ffa,
+0x79998cb60f7d9cbc, 0xe03798c28fed25f, 0xa024ca543a83f5de, 0x5d87e9b76d9da6bb, 0x254ccc8e8a27366a, 0x15a0026c9e135998, 0x53ea3932476249c7, 0x155b0e7c99480a6a, 0x7be9822d177d6879, 0xd40f36e7,
+0x63ee30b03bf49b56, 0xa6b4f66d5bf4be7, 0xbdeda56227a96477, 0x7beaf48726a67d6a, 0xd0b489c0c0ea88b5, 0xedec950b4370dc6, 0x7643df0eecd83843, 0xcdfd6e7fca2a7231, 0x3662d090b0ae4eed, 0x8f4a83e8,
+0x3f38331adc462e0e, 0x533b50d3f45c9ce9, 0xc9a42ae479f85336, 0xa5b418c561c2cdba, 0x85ff758ee70c6b75, 0xcf5dd4a2bd0c4086, 0x25d83e2b6a3e0d38, 0xd4dd5f550f770398, 0xd4d793c329b96efe, 0x1b44e05ed,
+0xe098a8b26e11ec9c, 0x476385d2df635055, 0x26c005f3ba0875a, 0x20b22e29dba1a4e0, 0xc07e58b75ca8870f, 0x4f87d924e51ed6c, 0x9e235da69e003637, 0x9eb52f7c4494e142, 0xf2f0a5b5ad83b4dc, 0x24bf205c0,
+0x88fb4567636d33ff, 0x50a74a8df50abeba, 0xfc74dd75ee2235c1, 0x167261e85da665bb, 0x9e2e63664640c0e5, 0x83d0c6b3430fbc1d, 0xfb22ce542ba13c2f, 0x3b8700ce4dbdc1f9, 0xdc022f8c433a2a01, 0x2765b36e2,
+0xe436bb8f54586643, 0x71d4316394cbbf19, 0x21da87ab12d7bbcb, 0x1ed0901fdb0aedfe, 0x9ddf5108d0c16c86, 0x459005e0bb0c65fe, 0x32f0372573ddb90f, 0x33c01cd2229a70c2, 0x32b11db1c58f9c58, 0x16cc1e00d,
+0x273d947e47404086, 0x4c0d449563dd523e, 0xe3aa8538c61815d7, 0x5e468ecf8a7ee246, 0x8329fe74d95314b4, 0xbacd72fbdcfd8390, 0x52d317f6f2d4fd65, 0xee5fa13cd36aa857, 0x9f05f7b7bdbee0e, 0x2507d0581,
+0x34c93608a020bb47, 0x512ac80fe6cd0b62, 0xc80bfa1d3b4c6633, 0xcc6b6bbae39693c0, 0xd839a944d356725d, 0x335c8e1773c25007, 0x36ab7ca7fcbfb9e7, 0x27bd54745eccf5d3, 0xf03fd20fbc03e805, 0x17131ee99,
+0x30249138bc1df06, 0xd170d0ce25c762ca, 0xcbcc6c62b859b62e, 0x314186c317edaf72, 0xb158275f1aa86ece, 0xd51a8354f7194cc6, 0x4afa67f17bcd1659, 0x27f10e2c8ce7644, 0x1d4e9c1e8f5ae86f, 0x12f3c520b,
+0xab7c0c062cfb854b, 0x5b73a3b45e2a1084, 0x5a34277636cc4fa7, 0x658af92974a27ae0, 0xef1658d56c151a1a, 0x644342a955df497f, 0xd7f56551d8e021d4, 0xa2e56aacd4441014, 0x13beb21bc66f7fb2, 0x2185b18e4,
+0xa1cc3d65190aff16, 0xf7fa84e8527af5d6, 0x528d46c50a21cfcb, 0x9212cbf8877d5b5a, 0x3646afe122aa44e3, 0xce35e5439ffbfa35, 0x480c8c641eda2425, 0x259f67009624f112, 0x255c24ac767e27da, 0x8df2ca4a,
+0x7f54f39d9f7dbbcc, 0x73fc1cd5560bb61f, 0xaa8981ad97ee6468, 0x8305865c73d9db5f, 0x3b020bb5c6a611b9, 0x2b00891f2169a9d4, 0x829b9329cef77182, 0xcff52be41ed763ed, 0xeb31c6d1b72e2f68, 0xfc623105,
+0x1ca848a31e6f0ebb, 0x49a992356f7ea735, 0xad48e5b1426ccdef, 0xaf15217d67522922, 0xa5f5cee0faf81be8, 0xf44e8330ba834e19, 0x1456a648b7ff0f39, 0xdaf96bbe0c933c45, 0x9a2ee25faa435d88, 0x18e73cf2f,
+0xaa9f9ab0bb06a9b, 0x7b86a2bbd0f3f105, 0x85bcd8bd27d82462, 0xc917c82a01a236ed, 0x8960b2d679b8451b, 0xe4ed80909f9917b2, 0xaaac05d97ac10709, 0x3b89a68f36edb4fe, 0x18a87007c52ee227, 0xc7da6a72,
+0x9e9c0aa98cc0056d, 0xa0f121d33214fd31, 0x83d4ad3ae171d563, 0x2c14bc0c188b6a5f, 0x808b0d8ed9f0bc8e, 0x376437d159f39565, 0x7e57cabf5c6abe5e, 0xd677115a85046915, 0xd208723abd97093a, 0x1554d250e,
+0x2825b6f60cefff6f, 0xe1c83b2e1dcfde45, 0x6ac8c164220d979, 0xa3bfeda139767451, 0x642c55be6e0e6a1c, 0xc34507490f3439d2, 0xa79db0ce739428a3, 0xd552d7a83d40987c, 0x9aced2ae63cf7652, 0xf9d67112,
+0x6e19d5b87fa6efe, 0xbc858fa0bae42878, 0x93114b9b0a7ba0e0, 0xac28e26abf5a8b04, 0x491e80ca70e69f1a, 0x538e1d77f823e04b, 0x930a7caf08ebaa53, 0xb9705fb1494d75e4, 0x255213ec28e012ed, 0x2421d7a3b,
+0xffdd97bc9244e447, 0x2fe033b2930cd5e3, 0x828b8232bba86e2b, 0x69942a6e0ba19df2, 0xa6325e4ec265250d, 0xe9a3e3d18b1ae9b2, 0xc0f05936c0cf606, 0x6865225a31f58064, 0x45ece68d6a858a98, 0x599eab4f,
+0x4cdd5143ac8e6a02, 0x21cae805d9261d07, 0x2212ade087b9c628, 0xd0446584f902ef3a, 0xb5ebf39feca55341, 0xfca3d0afd041fa58, 0x56d82623d6f63fa8, 0xaf4a156699182e68, 0x775ce1b94f869fae, 0x11373c5d8,
+0x3a968da9b5873068, 0xdd8813d1e0197217, 0x19c6f8933af4cc97, 0x6ce65b235882ab83, 0x4549b1cb35d43c9, 0xbd448b2fc6191f39, 0xdd4555a70e06c800, 0xcc859d0f429e0bd4, 0x9c173950f826a9e3, 0x1c6833f3c,
+0xe5cc24ca6f5b6407, 0xa60d7c8f9f754791, 0x110c1929d6e8dc3b, 0x53acfa122458a62, 0xa6e1696e510caacc, 0xecd52985250d4bad, 0x55db2c1f1f99bd91, 0xd645a0ef359ad788, 0xb8e2f468f5bc3a0f, 0x2198b3e1d,
+0xaa2e15af99a41e32, 0x125f0d92b766df07, 0x9adfac370038610, 0xd079864dd6e2046d, 0x8516d1164dc83979, 0xe3d679077a8d16a5, 0x8c46aa1ad3ad66f4, 0x12044d29f5020f40, 0xd887c9e279a6e492, 0x1e7ab37e7,
+0xd594315135013558, 0xecd0bfc87a85afbd, 0xf7393d0dd2874b3, 0xbf19e324ec07246b, 0x3ab91e941e8a5f51, 0x7f74e35a887ef73c, 0x5dd233dd831d49db, 0x47f32f75409ceeea, 0x743d1b07252046b1, 0x169e2eb69,
+0x579b35735b8be472, 0x6972594617ae57c8, 0xe7c09009e090a861, 0x48633238e8eb219a, 0x3117689a95ca0c61, 0x40045b737103b4f9, 0xcbe66ec7d9e7055e, 0x22ff30074f3a6c62, 0xca4cc3a54996440b, 0x3e5a4f37,
+0xfa02e172a7b32365, 0xdcae99d2678d49d0, 0x7ab30d5398470f95, 0xe978e0873499d085, 0xadf9d816402cd7b7, 0x7c569d961ee4ea79, 0xa2a2da8ee63a93ae, 0x3d035358d29a58ce, 0xfc90364a4f7f4e0e, 0x22a1f1ccb,
+0xbb631a4a4236a5a2, 0xda4663b2fb1b185f, 0x82b367e7f49af94d, 0x7e0d4e6d229983db, 0xe2b29b44072838bd, 0x541a557c6a9c8900, 0xa11fc30bf1ae5c96, 0x213a75cbf59a882e, 0x3783327b06e652da, 0x3ec8e4bd,
+0xd8d6bd1f55882a1a, 0xc3d6c4792c354d5b, 0xfaedfd3949b6329d, 0xc545e61a055dca85, 0xe09d752c9c056056, 0xc28c6b9e8bcc38f, 0xb682149fcd256515, 0x1c49b3c5bd2f142f, 0x65dae5a09f008eb1, 0x16f19a838,
+0x5d6b432719ea6e63, 0xbe6191058f6704b4, 0xa599910fab764193, 0x6507b70b22ce82b5, 0xb32e4537ad4a129d, 0x3d12042bc4ecd0f3, 0xdbda9d6ce37ed0ea, 0x2b10d8bad517adb6, 0xea35707540cdb270, 0x163746ff5,
+0x2220ee6a04695363, 0x377e43d3bbf5871f, 0xcf22350db92127cc, 0xeb5394f74622ed4b, 0x203d09ea5401fbba, 0xfc94c5c24f39791e, 0x6143d9e59445f7ee, 0x6e98ce6014f2af60, 0x2ca4258e15666533, 0x11badab5,
+0x173469c748761712, 0xd6a2ad0e70c5e0af, 0x1e64e7455b4fd7ca, 0x837d098b1273a30a, 0xbb2d71be73db923b, 0x73933449e4fd93f6, 0xef412293e1e4dd95, 0xea00b8f72a832913, 0x9a060825988d7081, 0x86613bbd,
+0xf7a5ca1b14385f15, 0x6ce81bc4b0a56e39, 0x75746f35fb6f514e, 0x31e9027740d745a6, 0xa8ff6d28be46d103, 0x9656fdbacfa72751, 0x1882ce033afdc317, 0x808fcae4f385051, 0xb19e4d315a931361, 0x21abd81d9,
+0x59903c87f06bf5b9, 0x8fb311384074df2e, 0x8c98f2eb5bf7e86, 0x7b3d15d73a5d2968, 0x4c8c5894dac4de0d, 0x939629e01c9514d6, 0x711caf61bd7f6d06, 0x7a5d814a7db0e395, 0xe37cd73d7c904f3a, 0x1de0a6cb8,
+0x904064ea07610de8, 0x396d61f4b4f03c2, 0x505bbaec7424ffe0, 0xda36345276710aae, 0x42d83d40b03a95ca, 0xbebc9d1bd0d9773e, 0x86c029f6840cb0a9, 0xa2dc9f394749db2f, 0x454e74681c8ab92, 0xc4253e17,
+0xf9c40395f5b85dae, 0x7ac68a1bf67ab6ad, 0x78cb20647d60a6e1, 0x6e18ba869256dd60, 0x16d05a4e622930a6, 0xff4f4bfb9427a7, 0x1b29a97afe3b8003, 0x38fd4fd8618ca8bf, 0xfd9b3d05c9476dca, 0x1b8065af0,
+0x1e815ef4eb42f182, 0xde29cd8679e9bd8c, 0x10e5884733255a48, 0x5b1a23def002085, 0xbf18a5466c9f44a2, 0x7a4e3ca2632de86b, 0x8325bd06d593c593, 0x497c0d9e31e0d758, 0xa7aa0bdcecfdd662, 0x1c9537819,
+0x46dc6fc89ca7af3c, 0x5c388a4e8b827614, 0x7b0d3bf033177d2a, 0xb6519ca2521d723b, 0xf7bd13ddb290f57a, 0x8366082ff5629a72, 0x8598b9079b9bb54a, 0x6c5d67d4746cd62e, 0x7315a934038dc317, 0x12279a3eb,
+0x33dba489f1ca0307, 0x9c7f55c6f2d68703, 0x335d8072354596f2, 0x91dde9d3b5bed3d8, 0xb873cbce90a4e3c6, 0xf5f68090d23d5b17, 0x213ba56cf97a32ea, 0xb6f7dc526586733a, 0x1539939cb8abeddb, 0x669f460,
+0xe1e2c8572707997f, 0xf4aee5a8769a0bbc, 0x63643fd80a3aca83, 0x3ae78308ee156119, 0xd16170038a2aebfd, 0xa7240d668723cdb5, 0x31e3155762931568, 0x6a9cde4444574aba, 0x96db5a216742cc10, 0x27838fc57,
+0x65e4317fb5dbbf0e, 0x4a58b0f8eed257ae, 0xccc74526745ca9e7, 0x15642cb9924de5fe, 0xed5d8fb22fb12804, 0x6d74ec64ffce546a, 0xaf2ecf4c3aa4d9fc, 0x3b902f1f5b88cdcf, 0x8e50a061955ec913, 0xf909db2d,
+0x42a7410bd90bdc7c, 0x7c74b9d127110c67, 0x8d2489ea991ccd51, 0xbd0ec3eef184c44a, 0x97a25d5555613092, 0x499a85e434e27752, 0x162b441b1c0f0099, 0x56f165ec4f414fc9, 0xe34e2757fd7a59bb, 0x63d53534,
+0x95ab54d489e802c2, 0x9bd45e202ef3e854, 0x862cb930b50b3617, 0x7d982ddcd2e5e9dc, 0xd506da5e5699f5, 0x1a5540f966bd6d53, 0xb71063738d44c617, 0x7be94903293d5df1, 0x5b8f608c29527b57, 0x2519b8e51,
+0xa951728d3b87ba17, 0xa281fb8b9de2e734, 0x5f25bd3df13e1b90, 0x5a8e7a7108862cb, 0x50847e5fb01e6a03, 0xb2565091a79339c, 0x6096a5ca838fbb97, 0xe0a1637aebaf9be4, 0x3eb0d51b8bf67e12, 0xfed3efff,
+0x33f0dbed5d64104a, 0xa0df11032e7931e2, 0xfba8c030758c60a9, 0xa43683b91d675432, 0x8cfef037c4844039, 0x3da3990dd27a23ba, 0xfd3a604498d992ac, 0x6404c97831748670, 0xa875accc9e406a42, 0x1b71a38c2,
+0x4214dbdb648f269e, 0x207aebebd4ea3b4a, 0xac01c5a4bc8dc2de, 0x715ea80d3e6ee044, 0xc11b0b0182a0144c, 0xe1f297d7669fbeb, 0x407ebf10cf5434af, 0x6be19040ae46ab4a, 0x80408595be998d7f, 0x213b9e3a,
+0x48e331e6a0f9268f, 0x167105389244b89e, 0xc3a3f5087d7a0db8, 0x89ba304fc6a0c590, 0x6e716d71cd54449a, 0xb3b89c63200cdead, 0x6dc1adec0a1318b6, 0xa7ac650e91f80abe, 0x76671ad0b6d0e58, 0x1265a0f52,
+0xdd28262bdc702cc6, 0x819a562f9f8cd8ea, 0xb00b1dc056840783, 0x324eeed5d16cc728, 0x70de67b0068862ec, 0xc35b7b02d21d2fed, 0xba7effc477099924, 0xb3a1cedef0f540f6, 0xf02f11082721ac4d, 0x1681269b2,
+0x5045f317329aee7d, 0xf95c71bf6b88c457, 0x5fcf164eb14ad6ff, 0x6f21456c05b23917, 0xb58dc697ca26b8ea, 0xb26a230088cbbd0d, 0xfeab0023ea0aaff6, 0x93963f86aef58042, 0x490253608d44c93b, 0x162b72135,
+0x117fb7055d7093a8, 0x1b6b0e55d4a48df4, 0x88b44ae18eff5410, 0x441d4b7169e55f3d, 0xe2df7ca26c30904d, 0xe1205c36234c0b33, 0x1182071de252e479, 0x98c7d31112311ac9, 0x482714683edf0e79, 0x126755c28,
+0x3d689da9edd65b71, 0x29bf18457a127137, 0x8cea1e9b4c11277a, 0x77b755474fc502bf, 0xa6808b50c747639f, 0xfd83425ad9271383, 0xa0b1ac4b012986a2, 0xce6e50eabaa0e90e, 0x8eda343593943ecf, 0x65006850,
+0x2fc08bab652885c0, 0x6bf90cc9d8e20dad, 0xb9a1a6514b40f4be, 0x96f8ac478e0431ab, 0x47ab68b69c880a49, 0xeaeccf53d9dd0599, 0xdfc4c77c2a218fe7, 0x3fa9f77889420792, 0x10e9359c1dd7a615, 0x15949001a,
+0x20d3bbef4a73c83b, 0x650b44fbc49410ae, 0x472e9dff5df0764f, 0x572b1e7fc9f37b7e, 0x5d690d6d534d4e80, 0x2aba0ec4e85d8787, 0x7d0375356ef090f2, 0xd7d15f62cc33d0dc, 0x88426cf0d8f0860d, 0x1220d74b6,
+0xba5b34394c711288, 0x80b2a1df16e13add, 0xd7fb84d2ad891a4d, 0x84a198c9cdaab500, 0x8b3190b3e0c888b, 0xe89f302c4e6da9a4, 0xae76243e2971b9e0, 0xc5ab36e35601f7d3, 0x7e663e5621e5e12, 0x2d0c69f1,
+0xfe46ecbe2e47603e, 0x54a87323b24fd5a2, 0xca3f215b012e5b6e, 0xb9783dd0e4050fc3, 0x8f21f84aaffd32de, 0xe147d4da630571b6, 0x973c62403bed149, 0x833bae77a27534ba, 0x6253fd90ace789e1, 0x231abc048,
+0xc9083c4209c4b079, 0xb75f29af719d5b3a, 0x53cdfd53484e7788, 0x29e86e4c08028183, 0xfb0a64f34950691f, 0xa069d89a011b403, 0x2bc5ce14e8e3807f, 0x68589fac9fd21c9b, 0x19068e87603f3345, 0x117ed9375,
+0xddcbee019c25b9dd, 0xd53a88bc5da83faf, 0x1ba4956ee0dd3e42, 0xe65b00dee3ca1924, 0xbf4564ea5192ee93, 0x7b0d9349a0d752cb, 0xafa06e9bb6e55315, 0x63ecfbb9b4d09dd5, 0x2b5f316f1fd0b85a, 0x1f95d909b,
+0x57da052678059d5e, 0x1fc44218e918224, 0x249e01034875e307, 0x626db629c09aa9a6, 0x7c26d70e5a982306, 0x9e5e32e7650d375b, 0xdc91cf11006f6bf6, 0x82313140786435fc, 0x835ccee234060146, 0x77f2b563,
+0xb7df7069f496cee5, 0xe744dd829a1126ac, 0xd7a51c017db45d79, 0xd43a671e607b894e, 0xe18c63566cbe491a, 0x68523a121f7ac38e, 0xbf34628d23a44bf5, 0xf7c50a90cfcac619, 0xaf8e51dcc66bd32e, 0x27814f9dd,
+0x7fa6118bc13e2683, 0x4627a9b7b211a9ce, 0x22f53d941955f0c, 0x2c604c952b81c5dd, 0x6a667f391f583e1d, 0xfc27fd2ad3581e1b, 0x514770a86f21def6, 0xa9017b3ff3c0aa4d, 0x7f54a5f0b195e728, 0xe636f696,
+0x993c570e4ba8875c, 0x94aeedfd640dcb84, 0x9e1fcb8f9b66efa6, 0xf53c89eefd140dd1, 0x21022a301c8c8e82, 0x5f5e56effd16300c, 0xdbdbb64c95ff658c, 0x16df4aaec5170aa2, 0x33c2e5f79555f3ea, 0xe981c836,
+0x3265a75c8ec9db44, 0x9573b607bf5e0c3c, 0xb92af1bec3df2c08, 0x9e6f4a8fecec84eb, 0xc32672732011f96c, 0x2a823e20a4a1d9f9, 0x5f73f02c5ee012e5, 0x1559d1a15dd7032d, 0xbcc1f927b0409b92, 0x201d9795d,
+0x5fde736af4f0aba, 0x5d5ddd6ef5ad3c5a, 0xf99bc4d6d6730284, 0xb78fd27fff8a71db, 0x39f9042af31ffc1, 0xa8da8ac0a24c56e2, 0xd442e510d238fbe4, 0x4e977f40ce5a7a3b, 0x3eb3977e7cbb876c, 0x1e54993d0,
+0x4db2c85c38fef929, 0xcbf4b560da24f51f, 0x8eb0bb9f4c0669f7, 0x5c091abf62173288, 0x6579b51cb3358301, 0x7e5b71c02c40124e, 0xcaaeb2a36b4d4861, 0xa16f0f94030daff3, 0xc656accb1f2bbc24, 0x16435d7bc,
+0x3afc756e654f5ba0, 0xcf406940ec9e9497, 0xa7a7f637efbf5631, 0x382bed3805bcf71e, 0x7631960737edf596, 0x1819a37d15243932, 0x73983f526cc2415d, 0x984c0956d6fdede0, 0x542a7147411d766a, 0x1ef11f953,
+0xd23a9f54a15a6506, 0xca9173ac7d91b4af, 0x25cf46334fd37910, 0xe93a77030b95af9c, 0x90c41aeb435c7031, 0x39dfefb84e096b67, 0x746d36777933b340, 0x73f3bba41640ae4f, 0x2fc93932ec2f1334, 0x9a1881a7,
+0xe36bce1c1cf135ba, 0x7367ffbbe6ce09c7, 0x38cba30a8bc9274f, 0xa954484b7bff64eb, 0x7e5d0f4b37195e12, 0x308559b37379527c, 0x2226fc595f9f2eec, 0x2de53e533659dc11, 0x22d05a6089e30fd5, 0xbb66e678,
+0xe61bd0eb3a478887, 0x46730afa0c7fa9ce, 0xc685a67051fb3767, 0xed8dc5005ca1e995, 0xac61d99d9639f581, 0x971b78d295d4866b, 0x4b6cfd56eb5d40f2, 0xea2dc2b14a84c6ba, 0x617314bd147a7fac, 0x173cd2ad7,
+0xc95db1390b3e0334, 0x68d1f60fb4aaceef, 0x6dff5e2857eefb43, 0x60e9387dc39dcdb0, 0xf6cdce74c07ccc1f, 0x246a8cdfe4a1f397, 0x7d4e74efdc3eb885, 0x602912f71b703fc2, 0xe7223b121aa4e8a6, 0x128d3dfeb,
+0x1371e4269f23db17, 0x42d8744175c14afc, 0x1a71898c2602060e, 0x18d2990662e19802, 0x19660b9a2f48e0e3, 0xe6f0a5f53bc9001e, 0x801cc4a0bd13917d, 0xfe4ff7b5f17b6de6, 0x96e269349e9919e, 0x2512e3d51,
+0xe583bc05d34bd00e, 0xcbedaada3b28af16, 0xe7b0a5e42c4c6d9e, 0x4029f18160dc0d3c, 0x19d9691caed45310, 0xb694b1ac526f2c85, 0x9f1add66caeaf40e, 0x396388c24ebb7a9b, 0x945a75e63ec3f231, 0x23ce48c2a,
+0x8cd38271f0a1827b, 0xc17268c39aea26fa, 0x6a5f0ac75ec8d986, 0x1acc4d35a027f337, 0x53e5b0daaeca8985, 0x1ec4ffb588245b55, 0x1aef11b5572d04ba, 0x647abb2cd644ff60, 0xd5504a7042232cbf, 0x7dddf3fa,
+0x2770fcd4e9ae2cec, 0xbdacebe03a4acbb6, 0xd3f9392b2866a892, 0x22a5139e83d5f358, 0x8053cff2f8d2aaea, 0xde7f79aa532a5b3b, 0x57b6c9bdd916e699, 0x2b1869539b5779c6, 0xff0ff154459ac0ba, 0xd2197564,
+0x4dca6127f2ccff79, 0x7c33906146d07f82, 0x2b419e543d781c5e, 0x36fb6ac29876726a, 0x734659fe51b50659, 0xa92c90e4c6ef67d6, 0xc9c0bdcdb53ba0ca, 0xb37cda14c77cea0c, 0x91c91a0505bb1920, 0x242321ab7,
+0x2d8673f8d0c6bc3c, 0xdcff04624b5dfca8, 0x151956bdd592343a, 0x2a05447b2b8f20ef, 0x3615ab7893f13cb2, 0xf7e12d00dc3f12ee, 0xeefdd7ca832d5aa4, 0x8f21959d58f52f17, 0xa69d43d6e25cdeca, 0xb4ed7afa,
+0x67787d5abe17b8c6, 0x4739527be49cbdb9, 0x5c7d8ee3f0d85691, 0x934e2360c5c07af8, 0xde80a018fba13351, 0x54c1a2fe57836a98, 0x4ffddca860842e5a, 0xc46f331d3836f545, 0x6df70160d56e7496, 0x4c80e455,
+0x51b31b928bcf5a16, 0xc5bebe02adaecb95, 0x867d9f1febe0ce9e, 0xf982b0e5b570fae5, 0x5a888316384daa69, 0x19293f94fb12aa90, 0x7a51603f1cf64a0b, 0xf3ee10fcd0e9a673, 0x70169c140b3c8ef9, 0x920e73af,
+0x8af3230b75ace02f, 0x7aed2c3c49c0fe67, 0x71474c472592bda6, 0x68e5fa2f9d9d3e6f, 0xee4c30d83a79cfce, 0x9e5907e66d585217, 0xe897302bdcd05b70, 0x7f16f3389fc2c7b0, 0xa3497c4fc3e7aa74, 0x8241ab9c,
+0xb6b6caeff89db3bf, 0x92fc2d572e9779ff, 0x1ea04ffc85809c09, 0xbcdfdb220f76ce8, 0x1f5630030190f799, 0xcd0dc8b458645643, 0x33f2fd036516156c, 0x908a146529eccd41, 0x876dd4422565c118, 0x15ce3fffb,
+0x3482f57d8e6f1c44, 0x3fee3799c88c66e0, 0xc16f8abe026368a2, 0xe572209ee981be37, 0xf0decb1781e90e9b, 0x4ed326ff3c243ea2, 0x381e1ffa20ff6c69, 0xfea024eacf32116f, 0xc59967063d9c48e6, 0x244484b42,
+0x2ced7381cce0b23a, 0x85e4e812e171d763, 0x6d64c6a219eb69a, 0xbfd8167c44344887, 0x77bce682347c3d53, 0xa5c06be9c5e15628, 0xa56b2604a9a75244, 0x40ceee275aa47c1d, 0x7f39f9636354a7d8, 0xe2e8ce22,
+0xde57ee6d5b84a475, 0xe83796983461a6a0, 0xcd051908738f345c, 0xba24c22ad487584b, 0xd67158f36332afde, 0xa2e09c952a68d465, 0xc32f39b18c01d892, 0xc68164691c15649b, 0xdd195d27f5fb5275, 0x23cc3c2aa,
+0x4cda8f82a2d2d551, 0x48292e4c2c1f053c, 0xbc4aadca6b3cb7f1, 0xdcd784b82186494d, 0x64ac964d2e80ec66, 0x6cf4c4f4d7acb899, 0x2ef2014fbb18b1ab, 0xd90c31ae2a7589d1, 0xbdda933e0edcc2fc, 0x1e81216e1,
+0xcca21762f66e550b, 0x769c7b678bf0110c, 0x7b961a161eb0068, 0xc961eece6b12ddb4, 0x8aba85146d279ea4, 0x8d2a254be14c558, 0xcf75314a5520ffad, 0x6efa59e3b7f00f7e, 0xe25f06ba44c2a3c5, 0x9ff46e7f,
+0xa630ffe1498c6845, 0x733150a8de0798e6, 0xd063c23307bad348, 0x403873c4971bb860, 0xcccdb86056e96b20, 0x96c0e925b2dbe09d, 0xba603fed7c62d469, 0x495bfb8703a52863, 0x7342bad80483cb64, 0x1b73ffc43,
+0xdb20575032b9a17b, 0xbb1b208b8405dd4b, 0xcce36f7d10edb2b0, 0xa25df51d4738434f, 0xb0b88660b00b4b38, 0xbe9de71445b2e5de, 0x6acd12a61cb042ca, 0x7ee38943b5b95bd7, 0x567025771c8e7369, 0x8d52f7a4,
+0xee99902eb3d091e2, 0x125477db62e69219, 0x7724d48394c94b03, 0x352107c80517c027, 0x1483f205428ffb5e, 0x217fef49d964acb1, 0xb0ead2c0ae410cb1, 0xd2d1ee08ef52c6b0, 0xebdc6e673388a218, 0x2090219fc,
+0x16ea480bef10bbc, 0x13179d0ca16f038a, 0xf0498678806693f4, 0xd0362f6de78ca861, 0x697a9c0182f71f5c, 0x86b112e48f5b11bc, 0x1fab4ceaf7d943b7, 0x72ab0132de67ae7c, 0x76d925a57342943d, 0x1b238d6b3,
+0xff8069585bf74021, 0x6df5b29c983eddac, 0x24a6ee33079ad107, 0x9f972ee9d93cbf4a, 0x749b15caf5cdeab2, 0x241bf1b214ef2ae0, 0x8c38bd7c781066a9, 0xcf96977ed2b89e95, 0x4eb91e4dbe7568ec, 0x1a3825995,
+0xbee918beef1df3a0, 0x31f35ad06df50f92, 0x3cd4e67b0c4a8d67, 0x31caaa5dc0abf797, 0x8df1b1d4a06be1b6, 0x71afefe6f5652233, 0x8c379e241420ef5d, 0x20e90fd23ad7e2e3, 0x32d9c710870c245e, 0x1e8afde17,
+0xa62e8214f721d627, 0x55e2c3bd55f7fcb7, 0x3fb3f11985154206, 0x79887851c465c79a, 0x9477d5f24188158, 0x574dc837c7f6e470, 0x8c2cd309bc271c21, 0x642b5fa5751de0a6, 0x54fd432428aeb057, 0xeccd1708,
+0xbcc9f90272be43f6, 0x453801b50414ff9d, 0xe3dd539c72252392, 0x22af6443a40d5610, 0xd3846450baa2cd04, 0x6f99371c331d67bc, 0x976044a3408d03d3, 0x88db5411a8462d50, 0xd79b98d645eb808d, 0x156bc4566,
+0x72694408844c5cf9, 0x8104f157eb9ec165, 0x41075e84432dad3b, 0x8db04845c4e2c490, 0x7d381857d5f98f65, 0x89f42714800cde42, 0xa2863b04f7ef1323, 0x161b940e177171d4, 0x408acde5ea924bd4, 0x11a8b0b1d,
+0xc1ba9a5fabc4ef56, 0x6e0a1aed37080a75, 0xba76a3b011ce0506, 0xa5a6d57c89907db5, 0x5fb4bb4870ac0a91, 0xbaf69c00be0ef6dd, 0x9476916ca92f0a3b, 0x5146da1964d6095d, 0x46d80679b62afd7a, 0x6082d8d3,
+0x4f0fb945a2085a91, 0xcbe3882f13751cc, 0xb274d8b4533731f2, 0x2424466f245daaf, 0xc204ff08299202ec, 0xae2c48a0c62c452e, 0x2741f81bf4a3ec1a, 0x1b40a6c736a0bac, 0x3793a85fe7a53ade, 0x256cc0186,
+0x10ba640130208c43, 0xa65e2b67f2611c2f, 0x5f331ba16714f16b, 0xf02a8ff77f2faff2, 0x642df9f1718096d7, 0xdee349abadfb1600, 0x28af3153c5a197d3, 0xb8bd8a8898fbf5fe, 0xe97b6cf2ad7c31fc, 0x25a12ac82,
+0x81de135193712c5f, 0x8885fb82b2a15b19, 0x53202b71edf43a04, 0xc76873dde578bc61, 0x69ebce10a71ebe6, 0x78e663c37c8f9285, 0xdf5ee0b38cf8661f, 0xf45da14f3185c044, 0xf9ba066c11f0e1fd, 0x10436c682,
+0xac6129e6f5e45a10, 0x9e60376728eeb69c, 0xad9f19184366f8c9, 0xf504b213c1ee3b39, 0xb8eb219a7936ae67, 0xced99e65e2ad56a0, 0xbbb1d6b3d5b02737, 0x22fa14d327851dd8, 0xb8da550ecb56057e, 0x14b9f0100,
+0x3a40de347c63b562, 0x96f106db93911ad8, 0xde6f175700936ebf, 0x9e13aeb6148937bb, 0xa0ab14b0fabc636e, 0xe7f34ddd9e13dd69, 0x3e80bc860ed6d1e3, 0x4576f9326a09554a, 0x906568b548e34a74, 0x8408179a,
+0xcb17a80eed6ad5bc, 0xcac596c055cb5e63, 0x322ba5d5458f4931, 0x5bed6ee90cfc85da, 0x147906d6abc143e4, 0x1d39815c391055a, 0xfa4d227f40fd2151, 0xc5e719935417f8e6, 0x437dcecc6ca1b2ce, 0x2008af070,
+0x54d0bef49f5a1158, 0xc1516a1c600c2df0, 0x574fe00070c938be, 0x5b0b09d21cdfa103, 0xebec49599a985f2a, 0x2d07612b558557d4, 0x1b8c3c12064fd1d6, 0xb68718b0995ffab1, 0x3875a2c4c4fc19d2, 0xf0255780,
+0xf8a35729f9b64a6a, 0x90574f5e273e6f39, 0x9107502b83317de9, 0xa97eee392ed2f51d, 0x459a43c5c0497d11, 0x71520c35339c67, 0x75e68cd1e1d02033, 0xc4d6be71517d46f4, 0x4795717024d4665d, 0x2546dce78,
+0x9cff05f948f50613, 0xe559fed6c28b81c7, 0x96eedd17a57d1b1f, 0xeb0f03bda7f6c875, 0x348d7bb95580c62b, 0x8e2b53872bc6c2d2, 0x654d61cc1214e669, 0xc44cd95c2fa8477b, 0x3d35a7f50e877e80, 0xf04eb948,
+0x2a3c80ab2f74575, 0xa10c661791fc51f5, 0x1cedc8bce3080afd, 0xc804b63501ec4d8b, 0x37f07dc817ada974, 0x9a89d72e465140ec, 0x5344a78060016d91, 0xee80e823bb4c1b6c, 0xb79b77a21591c33d, 0x4009ffa4,
+0x1237c96e8948b28f, 0xb9f0fabc33875c12, 0xca592c0a7b08ff4f, 0x6cf10edfa4523ac4, 0xa6c172e4ec8ec377, 0x86dbe43fffe96cc3, 0x37e78a3c23a6b906, 0x5181d96c80d82bb, 0xba1fa96ac2d84200, 0x11adc056d,
+0x2070270a005b4036, 0xa3bb799c09b9509b, 0x84f37adcc7754ac3, 0x456e7585011c4e66, 0x9226a3632b896b97, 0xd94a1ba2b0bbfed8, 0x3c995e3406b62067, 0xf35c8aea41a465, 0xdba511446f866b8c, 0x20d625b26,
+0x27bbae4bcc2d3940, 0x98dc49c894e589bd, 0xb6324bff03cad84, 0xbefe1e53138b2e06, 0x9ed89c7a187c78b7, 0xf6b45fe53b913fef, 0xb49cefc199daa55d, 0x10051b03f94cbdc1, 0x5f22e054bcb4d840, 0xca89766e,
+0x2e7beeec111a6c07, 0xd33b8c7a34ed549e, 0x71f33c564a7293de, 0x5dd4d533f279ec62, 0x795f1e3c1e92fba6, 0x33bbffbeb942950b, 0x20ba0555e15952c1, 0xb1a542c3a9e101a9, 0xbaa1cc33f1a5c934, 0x5b84f752,
+0xcb374abfa68edc25, 0x9dc4a36072629bda, 0xa6b01680f5d96ab8, 0x2733a8fb988bffb9, 0xcde975f25692793d, 0x6c3c05a2b7e074b8, 0xd94cc1a903c1a38a, 0x1325d8e41a76ceaa, 0xb062a28d7ed5e0ce, 0x84a8cabc,
+0x9e239e9b220b30d3, 0x3e32ce482110e7e5, 0xa350a4fabeb4aecc, 0xd2c062ad0dd4628, 0xdab4990d0d229ed0, 0xfee93c59b3bb2495, 0x9b3de9275e47f77e, 0x50da4244c92464c9, 0x683c450ca2c9bc75, 0x21db1a892,
+0x82b9fbc736f5599, 0x2f1fa37d0d1ae9a7, 0x9958efe30217371f, 0x44861216a624e7d0, 0x2cb4862dff4fae48, 0x728a8941c4b5c61c, 0x8f8dd9da92b98ee1, 0x4c4cc9c44b9215d4, 0xbd9d5d1012cf9f49, 0x15fdeaf0a,
+0xd8db4ea71ded04b, 0x694737a7072c9495, 0x44d622994c0be558, 0x4ce4bf64831a7bec, 0x90718d421c87600a, 0x72adc586180364d7, 0x6b6bc2563436f1e6, 0x15e74ff834ebfd8, 0xd1c549a486595f7d, 0x2651c9cca,
+0xd9fdae7b1bb0439d, 0x22eccbb019a7b2a5, 0x8c840b41450e8bb6, 0x9701e74ab3072c86, 0x89d64f049f039787, 0x68ad5888ac4f0e96, 0x6fc57a8e27fec0b5, 0x928b3e7d20823faa, 0x2a292851a81a0f9a, 0xbbca0dda,
+0xb138f4d48d25501, 0x9cbde2141d0146ac, 0x766cf68aabb8dce3, 0x684b50cdda86362b, 0x94e098821fa088bb, 0x859028474735d548, 0xe95e63f2a93611dd, 0x96d577622a84ae0f, 0x89f095850c8d7b3c, 0x18c305fe1,
+0x80700c9e60ca2af0, 0x85fde92f68f8e5e1, 0x4e69109045cb7ba7, 0x2c92337f395161ea, 0x1e84e2283d833e67, 0x55d280ff12a0db99, 0xad0dac803fd639dc, 0x8b9aa87e7f554289, 0x271157f5bbb606c0, 0x25f93bef1,
+0x59900fd0bb1bf112, 0x4adba069719a40eb, 0x53b2180c3899e721, 0xb7622df74d3b89e1, 0x74818f4443b49dde, 0xd653cb50ff3d7c72, 0x9a323e373784380d, 0xac75eab1a267c39c, 0x18390d1f3e0c350a, 0x88c7b471,
+0xcd226b11aac2829, 0xc5acfe8f3f93db32, 0xb5169f747ffeb96e, 0x5c12dba543bfe668, 0x9384059da69d62eb, 0xd6b144424927c38, 0xdc452d64b89b0fb5, 0xd5a130d456c2f561, 0x72d92b2150e64d76, 0x329f350c,
+0x2646f1c3285c8973, 0xe3aab336c3764ed8, 0x2394f97f1690d554, 0xe37b7c06c729167b, 0xbe572b5b9f23a24f, 0x6573d6cedff6f404, 0x46850fb4450e91e2, 0xff2e5b00c00425cb, 0x8e5f44f0bdc265e4, 0x8e386108,
+0x4fdccb8a13d6b26a, 0x5618d7da160d1051, 0x1d8a3e4c80d32240, 0x6add5c4e62c98a36, 0xaf7e638209997dac, 0x4306ecb9097fbe81, 0xc8bf5cffcae094d5, 0x827bb10d8a7cff49, 0xa393157108e86821, 0x24c072cc8,
+0x7763ffd9e3e57313, 0x13ebc8fae6b01f12, 0x162c383b2325a0c7, 0x348fa68065149ef6, 0x33ba6e464bf4684f, 0x8d170f10ff60b903, 0x4e458e09c36d9018, 0xe23e01bb5b41cc63, 0x74a1da45a062496e, 0xb433c934,
+0x98c638e3d59a60fe, 0xfe0c64662b1f2b32, 0x246a8978e60466af, 0x3bee193887456f94, 0x88ba8bec3ba9d703, 0x57236a2fd2a5fe6d, 0x238f72940d505482, 0x4ab1bea4b33a4cb0, 0xe61dcbb9f47b04d2, 0x34a92d49,
+0x7a6ae6346ca47d99, 0x996c37cdcd6dbd2b, 0xad592085906223cb, 0xa185547f221f1e68, 0x31c88a1f79099bd4, 0xf60a1b405019f295, 0x6e0c6aeba051dd59, 0x7842c534720845ae, 0x6226ece4026ad286, 0x2457faa7a,
+0x3b3b3544b740952, 0xb3a07c01d3d564af, 0xd9e279a6d982d45c, 0x59ba9fb2c62d9bb8, 0xa791ed50d743ccd0, 0x969f92454bd70a21, 0xe2f62b1be43e9047, 0xb42f5bf6a1f1fb83, 0x3e8e6152edbc7128, 0x192ffed65,
+0x9dfd4f444f292919, 0x3997a0b5617f18fa, 0xc1d2855554cfd78b, 0xb0efe92df4cab159, 0x46a83e7d5b71accf, 0x20ad5896eb545753, 0x149c07d12652be05, 0xce36e8a1afd5501a, 0x177bc35f7b128e33, 0x1ce85bc6f,
+0xbd4a6fb33b849aae, 0xa6bdb6f6359d752f, 0x1ab9e6016b0be83c, 0x16b6f3be378fd15e, 0x3adf211b74a506b6, 0xcf8d2cb8d3a8fa94, 0xd37374f151b6eabf, 0x9b8e23aa07809b75, 0x147a1942e3f75651, 0x1281c4ab7,
+0xf9fced168adc2304, 0x271fabf796f4590, 0x46d4219e9d62bd44, 0xa349af7bc1c4a43b, 0xa99dfd18fbc7dd35, 0x7cd00c7de01f3005, 0xf1cd27037fd28257, 0x250a8af5a05ff6c, 0xfff23acd35dcc61c, 0x8c514bcd,
+0xd5b406082addab32, 0x6f53eb1bb4164eb6, 0x28183192ed062f8b, 0x967ed1bc677eaafe, 0x2c3f0e47f0e24fda, 0x6041a07c6957fa7a, 0x82a05a897254657a, 0xdad374117d7c3ef7, 0x61eedb3f0769200b, 0x1348affad,
+0x843fe5bb973cc181, 0x6a8eb706febd93b1, 0x893900d7b34a48aa, 0xc75476691e91e89f, 0xb4e7d29a8dee534a, 0x605134abacb46cb2, 0xb8d853b23348f6b2, 0xae4575de85e8ac8, 0x7313a78c6246ae93, 0x2535ae067,
+0x972b61d88a0996c9, 0x18ba896f15765f62, 0xe5ae6d2967cad147, 0xafb3bc8905923b35, 0x18c616951992a946, 0x8dd804b23a973985, 0x4011f673d0208928, 0x8b6cc11937662b7b, 0x8843a3a4dde2e70f, 0x25175a6b2,
+0x7f118cbec09b5a4e, 0x91c28fe1283d32e9, 0x32f816671962ee9, 0xb2594ff563baf8ed, 0x2ec984e6d8e77acc, 0x895dd5a7f319d1ca, 0xec057505c433054e, 0x2208c48d4725170, 0x80d4670f7409af65, 0x58a4e18c,
+0x2a005ddb78e0cbd2, 0xe4e7bf0fdb1db134, 0xe42e00adb7f2c18, 0x4743ff9753eaee23, 0x7323d49cb6c09661, 0x25c2947ba78bf836, 0xb4be5286925b7e90, 0x5f22ff9d0afe79ac, 0x8d1e022bf5096e60, 0x17fa8f272,
+0x574f06763fa8a170, 0xd323fedc9a9c050f, 0x3f4a0aba924c80, 0x578c41eb1c3fe4c8, 0x5b7c68dc755e6d12, 0xd8f2462b7083cb2d, 0x7e4cb11619c6648c, 0xfee5f4958330697d, 0x794e58553590b717, 0x176a6fea3,
+0xcfb81b1fd6d9d3c1, 0xd3aaebdff9e964d9, 0x3a5cd90452d2a2ab, 0x79f909dbe1e03f3d, 0x9826d24a825a7454, 0xd34a3b3df03ed4f1, 0x96235a24afa36bfc, 0xaaa60baf12c9d0f, 0x1fe9e642e1e08c70, 0xa0952afe,
+0x55a07c134ef21231, 0xe87805ffbe35a9ec, 0x8448fa390c8f5d06, 0xce56b8f7dcd6d55b, 0x3d2ac3d7502bafcc, 0xdac691b1df332519, 0x14bb703512f01001, 0x4107eb1ce50f9d19, 0x2d79941d415d3746, 0x954ae1ac,
+0x2a0edfee6bc7fede, 0x54523077a091ebca, 0x79a95a0a6fe9fdef, 0x44780e24067f402b, 0x73792c8fee90eeef, 0xf53cf2d8ed3d38f1, 0xc0607d7d0a6a34, 0x3b6b2170c6ffa664, 0xebd2c43f763c9d88, 0x20035d740,
+0xf10f56edefac4a50, 0x3f932373b0daf0db, 0xba57c7ee4293ae3, 0x1499c81372e88b9b, 0x4201ac76a140e435, 0xf39db91f59a1f6e2, 0xe96da6e6edc3dd2c, 0xc10c3b0eaf1ddddd, 0x2aedfa1bfbfb36a0, 0x248fea378,
+0xb990f69afa702999, 0x2436e03c4893652, 0x2e3798056ddff61a, 0xe6751442131909a2, 0x9ea3dfa510e3756e, 0x17ccac8f8431ec13, 0xe9a4bdd58395babf, 0x4563f6de8c40e5a1, 0xb2a8d41b78b60e17, 0x14c6e58f8,
+0x929fbe2dff07cba0, 0x2250c6fc7922ea14, 0xfd616189d7a590f, 0x97f76cabe3d47fdc, 0x70f6704da6d34238, 0x20b5f944804d29e8, 0x4a1bd4bb76ce60e0, 0xd3efce662bec6acf, 0xe4640000665a8d07, 0x1cce926be,
+0xdc95343641d46452, 0x5d1e84ee1cbfb941, 0x47232f01348255c1, 0x3244d2057c802ab9, 0xbefc4b4116790dd2, 0xa79ab8508137fdb9, 0x963a7eb31f502fc3, 0xba248fd681c3a2b8, 0xb4ee30e58ba97a11, 0x1dd34bcad,
+0x9d32f3cdc179f552, 0xcecb2b4291ec62ab, 0x9d83ed4be38eb9f9, 0xbaf21e3e2c2648ef, 0x15a798789a497a49, 0xb371d5c3c6eef7fe, 0x9b358989e0243c6b, 0x889635cd22761969, 0x7423616d5bdace84, 0x24c786287,
+0x4dee14d3a6f2d42a, 0xb4d1665bfdee05dc, 0xa34c15f65a4d5157, 0x4ab34fdfdb565523, 0xde54d95aab78ac22, 0x7eb4c0cd180c9d8c, 0x2133c8453657ec19, 0x9b474b6a0e8723fd, 0x32d5ceb28ef33d12, 0x78d7defe,
+0x3e41d22195b5dd2e, 0x4a4a1caf056713e1, 0x626c7c88af34a413, 0x47308c009cd87542, 0xce031875be9ddf44, 0x47e30f293d763696, 0x696dec987dc97ed8, 0xa5285587a6feacc, 0x11c51c3d897b468b, 0x6271dfa0,
+0x841d73f026e65714, 0xa9f8d47b1e1874b9, 0x72d4f9f462ff9c96, 0xaff77093c54d6e72, 0xb28e50841325df, 0xc78a7743479a94b, 0x6a5bc7cc16d171df, 0x80a933665663cd0f, 0xf45b3ad33ae458a3, 0xf23ecccf,
+0x2467e1fa9ff936c, 0x6489e1a119178330, 0xc06345a40a148e21, 0xc60af6709e0b69ad, 0x23c65610f3e333f2, 0x70f8b8e51e3bf965, 0xb42bd1b2fa086a45, 0x4f42efd9d9154cb2, 0x3520bb553337f6ba, 0x14c214ca,
+0x7fc19d00ace75e9f, 0x7932b627d7039708, 0x17465cced9b1f23c, 0x2280836b712580c9, 0xe553d02442098073, 0xa28f70ded620dbc4, 0xaee469fc4072679b, 0xdf7c398e9cfc15b3, 0x9c9e1f762a28aaf0, 0x528f0924,
+0xcf0bce45ebe917b0, 0x27a98d60aceb3283, 0xe9425f9dd9bdf089, 0xe1c98404188e7442, 0x3f66389a91b78b9f, 0xc65ffcc56352bfd5, 0xc742d70ef43e6b06, 0x3755ac2cd5640388, 0x34abc2af94447176, 0x21764a3bd,
+0xd44509958c4090b5, 0x476d68ed42d1a140, 0x4753b62c1379b924, 0xf77c523860013b42, 0x2eb48fd138cda964, 0xf0424c6ed4b1e9d, 0xce09271729f5d83a, 0x4bd922c9a583cc69, 0x784c93544eb32812, 0x243bb5bfe,
+0x78a18cfa96a29503, 0xf9ab4c5bfa3bdf8, 0x403590451ba22e60, 0xd6d6c2319c3eb184, 0x99324685e82118f4, 0x399bab0b29373393, 0x7bc4fd2a50ee0507, 0x96491e7fcd73719a, 0x7688df72c26736, 0xff1a92b1,
+0xe489601a01015efe, 0xc5abcd106ce57308, 0xff4e5edd0151a7b3, 0xb941fd3ba602ee0e, 0xae7cbb52a69bc8c4, 0x9866055409fe0d7d, 0x34a717b14ef16d18, 0xe716abd93ee4704e, 0xca80e688231a88cd, 0x1a02fde43,
+0x370efb3730395505, 0x4a003d75f8f4e411, 0xf8e4102ff641677, 0xab896ccede738bee, 0x6c52a067a1db029b, 0x8e5e492e341231b6, 0x1870f32c94e8a6ea, 0xa834336e3c3e400c, 0xba1e02bc2ebd6cf5, 0x1adbe4259,
+0xa42a8492f9ebf9e4, 0xfa0f9d21141017d3, 0x44384d4b18b300b4, 0x1db6c0cada990bb7, 0x64f7e42cd962ddfb, 0x3b4def2b1f2cce3, 0x5738329b5d5010ea, 0xd185679a935e05c2, 0x4c73fea3f9425fc9, 0x16ea0fd82,
+0x51b6500fdf222895, 0xf466c8eabd2b7d43, 0x4d363caec9e60640, 0x3ec15050429624e9, 0x62a3b403cb57487d, 0x755f3db1b5291ba1, 0x24d977eaa457b96c, 0x3e96953a2d2d59f, 0xae17b744f2400ec5, 0x25152be8d,
+0xb74d42960f5b2178, 0xd8f1dff378718c83, 0x61400eb0a491380, 0xe43cd7e8ec9e379d, 0xe82beee3a7986b71, 0x7cadadb2d0095774, 0x626edb817373443a, 0xc58ef9a1f409ad6c, 0x125c254dd07e3a35, 0xfa4133fa,
+0x9bb52cd08a709522, 0x6fb5c218f0284a69, 0xef91c475bded185e, 0x4d7e27be80cc4e3, 0x98aff4401df7b6a9, 0xb9a3190ef6726a, 0xadb59c63618f4420, 0x3af65cade3a46a54, 0x73d0185d33861ab2, 0x1a984cb75,
+0x6eed427ad07848ee, 0x36aff65b734ad46a, 0x423195c27e539ebc, 0xcfbec471ac8aa5e0, 0x1a44bf1b4beec1ca, 0x68c15e474fcd2d3b, 0xed70b31836152bea, 0xfa7c0e890d2d67fa, 0x531c54fa627791c, 0x104de2814,
+0xc572696d63dab93d, 0x5c618845cce0f139, 0xc18bd0dc3d732198, 0x4c6f2073afc5f038, 0x3b6225a0ebc30269, 0xae985fc9b0635f76, 0x8519d23196ec7ebc, 0x63c12cea78dc2eb4, 0x594f5fa8ea962068, 0xa6ab4d5,
+0x9b9e677190630661, 0x4f060a0741984461, 0x92c97c45c430dea6, 0x6ab182408b2d3d8f, 0xbd344d89c1cda90f, 0xab46e2175c81f4e7, 0xc00a77ccc62cb9e5, 0x2f6aaadca2f2606e, 0xd0420c41f5ca2bd, 0x1883300c5,
+0x3754e2cefd189830, 0x6b4b137db2a7abbf, 0x5c0e38a284dde1d8, 0xd1a0ca8f4d9b59e, 0x4b3f658d7ede4b75, 0xef92b2e77d4cd6e1, 0x36aa76cfc52fd6c8, 0x34c85669e2e93c50, 0x6fe6c359d5127792, 0xba974c77,
+0xf26d58fadd95ab03, 0x68176f4e1005a2a, 0xebc6bf602cda2637, 0x3a28935785843251, 0xb5a0619bd2c08cc8, 0xa30a1720d7305165, 0xd1e8adce2537217e, 0xbd172546705919ca, 0x85bf218a7164fa31, 0x55f62f08,
+0x5d68ce0b9cbe3bb5, 0xf9e806640806c153, 0x4343c07097ee6df4, 0x9197b17a57c43abd, 0x9a456b04ff423257, 0xadcf5bfc6129ee5e, 0x7bb50017ba630436, 0xaf75f979ab90ed4b, 0xcc58754b9456bfc7, 0x20b22fb08,
+0xe3c8c8fbee5f013, 0xb95835e820cc7753, 0x3022161bc85b9a43, 0x4ceeb27a2f34b23a, 0x1fed4c9735509d20, 0x86a42a1d345ce83a, 0xa74f040ef6b97da5, 0x23d74ceef8935d1, 0xcfa326a09728cb6a, 0x188bf7299,
+0xa21668e0d680bab, 0xa446a797e1f7f9e9, 0xa29fa3df8eb902f2, 0x81c9428d8c488aa4, 0x903b4ca1b2f678db, 0xc7c05d5552b5115d, 0x3c90efc78b4f50de, 0x5ea03dda8d022388, 0xc65af4c52153a116, 0x12578b446,
+0x7c50352846e6bd59, 0xa64c1646e89ec5ec, 0xf5909a71c8d3bff3, 0x9f866490be38d3f7, 0x15583157d31f9e14, 0x38c193db38f85837, 0x2cc3b97de4c0150f, 0x2b4687a8706d9381, 0x551d5ef9390e52fd, 0x21af09a86,
+0x304d583982723ce0, 0xf3407e0922f0f2c7, 0xe6e61337d6cf556d, 0x2e572ad3bc0bffa7, 0x5e3461ae7143f1cd, 0x13f04550f8604cb4, 0xf7ef803b0a58fed5, 0xf89cc6bd6e3fc593, 0x2e38729628b1bf32, 0x2248ee47d,
+0x8d120f8695c2c314, 0xf8824e4706b1ef96, 0x7ff20e0d3151b561, 0x338ea73bf880d284, 0xaec7b70605af750d, 0xe9b59396edbcd9ac, 0xa28ad4e46af9c07a, 0x8ada7dad7e4251a4, 0x863c1c9e5bdaaa03, 0x19640a865,
+0xc767d406008529a9, 0xa7e0503349e80f4d, 0xf87e52e1c6715287, 0x734343550b4cd719, 0x97803661014a83d8, 0x461e29c2987c0cae, 0x374e9dbcdb761819, 0x62bd13ff875c6e6c, 0x707256ee5de4cad8, 0x1a0955dc3,
+0x5df7171a175bf9b7, 0x4205ec168b4ec59b, 0x5a30af6b69101471, 0x508d38b96302ea45, 0xcd0e4319e398c9a5, 0x7509078349380d7c, 0x6b7f6078194c337e, 0x6ff17ae13c05790d, 0x7a8e0380bac94594, 0x21f98a8d3,
+0x89613396e7c0fcf2, 0x6e6705d0c91561eb, 0xb5d69c783724ec, 0x29c6265891c912ae, 0xb969e2bca8823c44, 0x649e1ca6f263fc3f, 0x6e90479eb8db5563, 0x3d4dae65af666e84, 0x7c28a551bc7efe8, 0x1ad7e3812,
+0x9a407d622018a803, 0xc6381ac322c25507, 0x4aab76d9f2f1f12c, 0x712b1b3656420e09, 0x1f954e4b98851133, 0xdcbb610ea68a3399, 0x60c9b448b51e72a9, 0x2c1aa47372bef5c2, 0x529ec530f14f7d70, 0x12c56d493,
+0x1c746d5da00c925b, 0x9e7e02682430dcd4, 0x189ffefc3900a271, 0x5da666ab35853414, 0xbac99a2b6f85407e, 0x2ac94c5d6bd00e8, 0xd34eb72ae2a6485a, 0x7ce5d21568dbc27d, 0xae7b3c4ae01eb6dc, 0xafc7db3a,
+0xf2943270f7e03064, 0xc907a0d318ed149f, 0x7c8109d1fdb2a16c, 0x17222382ae1967ac, 0x31c213eee33f752e, 0xaaeba03d67615eae, 0x3aead95b39e99e0d, 0x388724a3e30c5553, 0xc9eba761403707d4, 0x2463fe132,
+0x5a2cd88fe7d3d94f, 0x9b7379118358368, 0x5915a98ef06805fb, 0x8c02ecfc2f4d0de8, 0xb400a3d719604aa0, 0xfacff94276a5c0fb, 0x283d847de43d377d, 0x7f80233c0b76e773, 0xb414b88c55731991, 0x55d50f32,
+0xc4f275180c3f69c1, 0x7d7145ee0b210a96, 0x6fe6901e987e1beb, 0x32e88c318076af80, 0xf67083fae1023221, 0xd025c296438398ed, 0x49718b6bc1705740, 0xd213791bacacf398, 0x3a2e24f026be2003, 0x135c966b5,
+0x9bf18e6122c102c7, 0xdb6198c9a3f6c93b, 0xd540a083488c6db3, 0xaa33b71d9b0a38ab, 0xecf785431ae6202a, 0x68b7efd87c43e2c0, 0x7b7b8f2532605a83, 0x957d34a37ce48760, 0xa7de04eed16cbc32, 0x104c02c5c,
+0xa1e98f1911bb6e7b, 0x286f24b50a9462a2, 0x6ca1eb15036baa00, 0xa68a540f13dc764, 0x1e5d5b395611ac8b, 0x7212e57fd03a377e, 0x56871dafaa706d04, 0x39cec455674d8f17, 0x5a4e56a6f199e62c, 0x1c01bd380,
+0xd8f9e8cffbe3c4ce, 0xe7b1570a4e53c651, 0xcf87e9a494e172de, 0x392db5fd9ece96ba, 0x29fca1f420289d18, 0xe49b0275dc6b5641, 0xa8038f0bced911c, 0x82ee3a9c9dbb1240, 0x735e62c87f0e4fef, 0x269b8b483,
+0x8bd20f511bc7fe8f, 0x56e25d9329158c6f, 0x2eea8ebdee23dd6d, 0xc135fea63d9e5594, 0x66d463aa4472614, 0xe56fca2db978a26f, 0x569d63e93d51ede, 0x11c1c6c43c51f4ce, 0x836529e36a2e16a2, 0x6a97ef69,
+0xbc5459226e155e26, 0x6e228dbfcd79d48f, 0xdbff15a672afab80, 0xaf81fa2e00a2fb9d, 0x3de6397165edec5d, 0xa019fb80bef747f5, 0x7c42a2b80517fe23, 0xaf3392d91af3b4c9, 0xb6d279eff0d86f7b, 0x1d637b8fe,
+0xf2dedc696efb432, 0x147706b0a198f657, 0xd1302e74690e1615, 0x52380299f26128cb, 0xded540ea128e30e8, 0xe15bd8f2c32bb416, 0x6900549281bb8b79, 0xad991d6cd211b42c, 0xc4b6f58269049a3f, 0xd4a04dfe,
+0x76fcd66b331bd0c0, 0x66559f3a2f366869, 0x40c1194a3edb0d58, 0x6d2836b5e0acf69b, 0xd8e3a0bd3a51c6f5, 0xfd1b3982c2a14e31, 0xd0b826c66427b400, 0x78c55ddb2473cc18, 0x7b3c8093d1f969c0, 0x207ba9058,
+0x2c1ad035bea194ce, 0xa5add7e255dc8be, 0x565383448d1a8d68, 0x540d24f72d128744, 0x86b2b5150090c884, 0xafe5a4e5324efba1, 0x275b05945812083d, 0x997138a59fdb3faf, 0xe12928024ab47343, 0x15a887289,
+0xb6b516345cbe3d24, 0xf0f195ed69a46601, 0xf888dededa98f413, 0xaa53d7fe0aec59eb, 0xeae5b95c6aac3ab2, 0x9369bba475beaa99, 0xd1d17b5849c7c7cd, 0x27c6f67e8fbeef7, 0x85d29ea9478b353f, 0x15d72d995,
+0x5ae6c220b38ffc6d, 0xfd7173ed72cc5233, 0x18eeb5b73ceb7aef, 0xe5308a45417d21d8, 0xe2f7f8dde05bbff7, 0xea006b310793c693, 0x21d9605070ab24f0, 0xefa582a6b2a4bce, 0x9d05a9575de49f51, 0x14e6c4d5c,
+0x12be2d98fd956ea8, 0xefa2fc0af2c5195, 0x5e0423f4eb162ffb, 0x4b568cc936a6b0e1, 0xa8b7ab1a3392744e, 0x935fc67cffac7d1b, 0xcd23b78dd68ffa51, 0xd997e29fb3848a29, 0xebc0ae8654d43652, 0x814ad58,
+0xae2c574837fccef1, 0x79d28296d08c8540, 0xe98204eb13414d55, 0x3c53e2a2777041fa, 0x3a179bad9ca94058, 0x745daab3c9c9a210, 0xa6ef06cc84204da2, 0x2839353dac70c6d5, 0xbe3a378049084217, 0x11cd34bca,
+0x59aae7a9bdbe8c60, 0x55767cf426a30bcb, 0xce7c0225c5992aa7, 0x2a43dd2b20dc2a5a, 0x4e0c2d78ffcfc808, 0xa4972ec9785fae5f, 0x401cbb1d20557ebb, 0x5e4a9540fc00f226, 0xa5c2da4f756e3064, 0x17fb82aa9,
+0xda828f83fcb5fc57, 0x9cdaa47e030b13a, 0xc39ce6784177dc4e, 0x624326774c7e0633, 0x837252590f2d7da, 0xa42210b7d594d566, 0x7dac55f76b243f8f, 0x14b09cd43c5b8636, 0x12a2e79345931307, 0x1b6d14799,
+0xad21240624de60bc, 0xa649c06819d1fd77, 0x4b570b23425199ef, 0x210e50a24baa615b, 0x1cd2556d2596fc05, 0xa63b8734bb9489af, 0xaad758ac0d649352, 0xa293062c6c021a54, 0xa610a3012cb7b1b4, 0x1a2d3eff7,
+0x713411b3377cfe0a, 0xcd8f3d0d97926e3e, 0x951ca66f3875b711, 0x232766552955740b, 0xba1c81971084d058, 0x8c4af887323d93ff, 0xedc6ed56b13c7874, 0x846e001d003e0347, 0x439135dbb971706d, 0x9cfae122,
+0xcdcf82f9f272734d, 0x7aff959efe679b25, 0x1008d0acae8998c9, 0x17f669d7d2f23121, 0x356fdd1c64033bad, 0xe22f7021e5ec93d6, 0x422a8615a00fa0f4, 0x2f26d7301464c67b, 0xdebe07edb543300b, 0xba85f21b,
+0x5c56830a80c53a54, 0xe890323f869568e4, 0xc9678caeef5cd340, 0x16e820a025e9234c, 0xbd02f37785273268, 0x7678d9b81bb93cd2, 0x5ddc7052692d85c6, 0xf570bbc54d47462, 0x645f58c0ab183c6d, 0x225663a84,
+0xce331d02fec12f5b, 0x6dfead4ee2021dfb, 0xd2d7f89d263561d, 0x30f56c27cfd9d360, 0x5291415c16d362b3, 0xa48adafcc41e65d8, 0x6ee0f7641ba16ca0, 0xc0655f173b49aa0c, 0x7998087c42193a7f, 0x2168b3112,
+0x74e6adfab3f20de8, 0xf1c94703c0091c97, 0x67c844e2988e77a, 0x47804bb94e860bb, 0x2091f6abc82ce1f9, 0xb3b9f05256487653, 0xdba8e14cc84b5ee, 0xe8747602d4715b37, 0x9d5fa3bf108b4e36, 0x238e5ddce,
+0x20ee1356aa2e006, 0x72d7feaf51692897, 0xc8262787a8fce8f0, 0x5ed61ae660123d57, 0xbbcdfc68a4038a32, 0xa9b1db42413de2bf, 0x75d47ecdc81da3cf, 0x21a035f58aff51f5, 0xcdd34a7dc80ee13b, 0x1c3fdb640,
+0x56263d4d9ea27cd8, 0x9f2911f5cafcb525, 0x40e2fd434e764b25, 0x3fc97722c8467737, 0x9cd5b1f5f5a99881, 0x6434fbd096f4c1b7, 0xf3362b20e3d626e4, 0x19bf1301ed987434, 0xf58fdf88f473f617, 0x122c82a37,
+0x90e1e9968c09f774, 0xb2203e4525a06166, 0xb19459d78c87e009, 0x9775028e422dbbd3, 0x18c496ee0b41bf3e, 0x881d01b199ad320d, 0xb3412a007b19c27d, 0x7b64d43269811cb9, 0x2964e9fa7723159d, 0x111fee716,
+0x4be4be9d27550af4, 0xfd3bb724790fe777, 0x5d9a868227dd1d18, 0x24b90bb9b2dbaf84, 0xfd5dfb75ea78a865, 0xd055f2a35c319990, 0xb1ed82146690e154, 0x7005e62c22a4263b, 0x4dc2c29aa7063d66, 0x223e43f7d,
+0xaa535e4e99316148, 0xed40afa7faa804d5, 0x3d78ef0ba1a7ab24, 0x1ed239ac2029bad4, 0x21d1edcd500cd2fd, 0xf4692ab9d8dfac83, 0xf8eb1ebdb80d9d20, 0x1a88c830c3b42d8d, 0x99488a589e642a55, 0x5a351e14,
+0x9f6e29a5a832cb87, 0x1a46f5cac623295b, 0xfdf63097b6314fb4, 0x81267984f41dbc71, 0x2649e5167346fd89, 0x7c2201f5e0143274, 0x6d3a858d9f4fd539, 0x7c2e6342fc5e3ae6, 0x4dd0da43169226f9, 0x1e0073785,
+0xa31db22bc6215e62, 0x842da4438b4ccd57, 0x1d86345e991de78b, 0xb8817fbc38893d46, 0x611e7ecb75f2eb39, 0x52d6e7957102b552, 0x1e371b67b95f4db0, 0x6f1dc6b949012a27, 0x194b6b3d60897671, 0xeafdfcdd,
+0x1ef00252fb27d436, 0x85b26611d6860b61, 0x18ad826caa1c2813, 0x1a217b3ecd4276fb, 0x5fdcd244672df546, 0x58a250451fa8c7d6, 0x47d99e3b25562eab, 0xc945614f7f67194f, 0xabe85f2798a9b60c, 0x180dff1ac,
+0xbb8260c62eac199e, 0x231ca09172c3d0c7, 0x29adc6dfbe2ab2d, 0x51d6a2e55ca360fd, 0x691e30f57bfa4fdc, 0xef0bed97afa17c14, 0x86cdf437de43c182, 0x452624bc719f69d0, 0x6438da2b82e2a615, 0xb2686b,
+0xc6d030d7b1272f8d, 0xc8e029b8ba259b2e, 0x2b25c32b37a4eb43, 0xa7abb5c94635d270, 0xa01ab757e7628ceb, 0x48a2574fc71b75c1, 0x8651a6c9bd8e30cf, 0xb774dcbc7a66fdcd, 0x2f7af2448bc90fd0, 0x269b07c44,
+0x1861ca73ab44e260, 0x9b3a3aeb58a295c2, 0x6e23e2d39764ca22, 0xa16e569b83acb5b7, 0x1668372c0bbf9db6, 0xa241d624a8747505, 0xa95d0c4b9ca0ddf, 0xbea6fc5bae215710, 0x8264080eea7c4964, 0x3a7956ea,
+0x34d8a9502d86d77f, 0xebd7250b2df1f0e7, 0x77190c525b20043a, 0x3a4310919d9d1e22, 0xddde9801aa3327ec, 0xa6d9bb2692896346, 0xca09b738ae4a41d1, 0x497f163b61a26563, 0x35ada39ad6dbbe3, 0x117bd71e7,
+0x9097f408e236a96e, 0xeb8c7c06bdc81384, 0x6f1ae00488c2d096, 0x5d95445de64dd368, 0x16441ac7ae61951, 0x5f03c046c23c5453, 0xb3288bf4787c77c0, 0xa1ca6f1b4a10184, 0xd322efd6110cf35e, 0x215af00ed,
+0xaa7087e2ce32b147, 0xeda41e1969148ea9, 0x4d03c4a9b28f31b3, 0x179ca1d7867fec7b, 0xe4403e3042586a01, 0x7e7f7820254cb993, 0x946030d6f33a967f, 0xd6d13999ccfa07af, 0x62d1a93d266f4976, 0x11946a302,
+0x9581fe8cd27b881, 0xf287c4d9c874e5cf, 0x71c545b6252090c3, 0x94adfe9b1692e4ac, 0xcb72419b8a0e3e6f, 0x7fae5b11d4cb5455, 0xd77ab86258fbf431, 0xa26a2724de5d2fa5, 0x7bc03f849607f83c, 0x19413ab03,
+0x3a9229c686124716, 0x34fabb1042efc86d, 0xd822a9a7d24313cc, 0x182a51c15814f6f4, 0xb3a977129850fd39, 0x3472119b9e8ab0b6, 0xdea931290e6e08bf, 0x4d8364c036f1aad7, 0x959b5649219c6ff7, 0x11ad0e6fb,
+0xc894aa0ad1395bb4, 0xd06004d1579e4bf7, 0xc1815b540adb1774, 0xcfafc62429243f, 0x5e00cab17bc32889, 0x4e53e2432867fcb4, 0xa6ee686193dffe4, 0x5dac83b4b243867f, 0x74e813161ceec8a, 0x25a24c332,
+0x6d2f0fa4eec9ec2, 0x8ebd9b780e724da0, 0x462cd82cd5a57b54, 0xf4680306c82c4eb8, 0x99b289587de4c135, 0xdf0a01c1398c7752, 0xa88add072877b906, 0x9d592156a6bd86d1, 0xa3722e36a7994c93, 0xa44b0381,
+0xa6c63ed688559496, 0xc457aa2661d1b9a, 0x1d460beae7e2ec8e, 0xd51abf66db9784d, 0xc1cbe6f4149aed7, 0x305a58c67597dbf9, 0xbf13c769c529d9ff, 0x554f796cc530b0f7, 0xf4a51c0e02918ebb, 0x2cf805dd,
+0x428b990b1c26cba, 0xdd890059b124cf5d, 0x806b9df3509051dc, 0x93ba96242ae50c10, 0x1e6b6ff43a310f15, 0x31c236b0a29ba2a9, 0xd4ccef9483edcb5d, 0x8ea34c3342679dda, 0x4d5333cfaf6dd467, 0x2431c2f80,
+0x66ac3a00b8f9c2f8, 0xc96f966d54fad297, 0x43ad55b69dbbd1d6, 0x29eb39a1485e04e7, 0xaac20fc78736ed5, 0xef7703fcfc1d69fc, 0x1a3ddbef3df03ace, 0xa99ad9382675a040, 0xead9d11320f60d9f, 0x1e77a7f94,
+0x25fc8b1155c7e480, 0x8b69c0d9248cb3fa, 0x86195f64c5872c32, 0x2dbab9da2d1a490f, 0x7fb8e090c888e81b, 0x2b8af21590d93742, 0x97319c3f8fd690ee, 0xb3b768750566aa29, 0xb821d8d1ebc2a73f, 0x244d453e2,
+0x5c0498beae17488, 0x2cf7da7c1964b4b0, 0xace9a085d2b3ffd0, 0xf1dd97cfde3fa370, 0xc27f20f6dcd20110, 0x7fa80f2b714ff145, 0xcbb4422e9b032a4a, 0x8794d96316695849, 0xfe5a7e36fc28dc4b, 0x604f1739,
+0x9574c7d6cf3c2f31, 0x6be3a6e1b05391ae, 0x81a39cba78b57282, 0x25b56a46778e9fbc, 0x89547427bad953bd, 0xa222d6068a26e103, 0x979991a17f1c96a4, 0xb8da57540ad6776a, 0x5c962aa86a11b35, 0x5b5cc8a4,
+0x935c80e47260bead, 0x3c92468e7b1530b4, 0xd73c23e70ba1cd4c, 0xa0ea889485368db6, 0x56324a0f207b3530, 0x9a6201fce668a7cb, 0x43d374aa93a174dc, 0x800e3b224baf98d0, 0xe4a87f3592cae1de, 0x6e17e0f3,
+0x97ee301f07829aa9, 0x5b2437734f340ad5, 0x3eeedc47b083aba4, 0xe1b3f7e01178de8c, 0x113970b550d7a2a0, 0xd25a04f618505d60, 0x350f1e8f200a520d, 0xb3a9a85c73ac1658, 0xa849a29d3298df81, 0x1dbb04d91,
+0xc99176551d61bbf8, 0x66c1b81860e96e37, 0x8fd2c453063e79e1, 0x194c9742af4375c3, 0xfd6f9662393f65b1, 0xa0811974ba55623, 0xdd16887ed4eb45b8, 0xc5b0402b7e3b594, 0xf13013ace45f46eb, 0x1389b3782,
+0x44fe26e7136b5577, 0x1fde2aef7a6c9c37, 0xed7f0121d1dc0dcb, 0x7ce4e60754da6cb1, 0x1b2f89f24c9b68a8, 0x264a05c808cd643e, 0xb232945e38eddd10, 0xab52350d4acd8a38, 0x5599ded834f29089, 0x200d25c04,
+0xff9b4f5279b89c9c, 0x2be165bbb55934cc, 0x6962df9fa75b59f7, 0x2b370185ed7464d3, 0x8fc66d4f4e218e43, 0xce8d8a3c684d2b19, 0x2144ea438b2a6edc, 0x171dfcdae2d66e5b, 0x2bbe64879c193160, 0xfb8300da,
+0xe868b2d018ada074, 0x25d93b75c1d47270, 0x9a452be4130641b8, 0xf7cfc65b08c21556, 0xc44516175fda5d61, 0xe6e6085dc5bccb48, 0x7254ff3cd1c3a0e7, 0x47c1afc063d0d8bb, 0xd1a3e7972bac77ff, 0xd9f24f39,
+0x962b183c2feb8666, 0x32e615b8bc1c066e, 0xd32073babc0a36fd, 0x22c25ebd406ec935, 0x37145e9f0e438543, 0xc63973e736c0f164, 0xdd734dd3cd65739a, 0x7858599d7a47ca9, 0x782bb654fcfa8865, 0x3ea9e822,
+0x3ccd22ffc186c2a7, 0x486679e055a35f03, 0x2da75b896e5acd00, 0x570ab320e567a8ef, 0xd422062dd81cf261, 0x79f3f317bf2c9665, 0x2e9785796c0b02ef, 0xc55eb42a96db79da, 0xf5e0236645b0a9a8, 0x258db5785,
+0xa5d851a3ba05914f, 0x5982b3e7db53ed84, 0xebc3dbe4edbf48a2, 0xbb9c9962684c24b2, 0x2986a27b70cf14c6, 0xf05d7a8a79ad1836, 0xa1fb9992c85163de, 0x9b98b2d44444f825, 0x29eb4d976ed63d4d, 0xab4e5a1b,
+0x54014d7e526bdeb2, 0xbf4bd263c434ccf2, 0xd8a7044bb46d023b, 0x984f01677c67aab8, 0x2a8668722c0831ca, 0x461ee741be99fe65, 0x89316888e77ded32, 0x44005e9a679b3c37, 0x75c2e37d4d9d8bed, 0x14a0136ca,
+0x506e529122e19f4f, 0x77dea56c269c60d8, 0xd2c0433ce6a03347, 0x1605ba1f586e42dc, 0x79547de57b6eb00, 0x146a749bcd871b2b, 0xf41e7473ef744a11, 0xfc8777962caaee4a, 0x64092fd574f2b741, 0x12d266a2e,
+0x7be9f5a8176fa758, 0x9a98f0af48a621a0, 0xcd86514bda226fa9, 0xfbd75683bc119c58, 0x3e41a690df73de37, 0x20af791840246956, 0xc6c605f980c52873, 0x7ec722a6dd907ad1, 0x6f567c1290e27ac0, 0xcc81b55b,
+0x8038b9fdf6c7f5e, 0x4302dcd3c7c5f9cb, 0x3b8b6f2672b3c27, 0xe071844df2d5b6ca, 0x9993e1776baa0353, 0x762ff2541f99e73e, 0x13f3c26e755c7384, 0xa5a3ec06b0616998, 0x962e4a026b703c8d, 0x137a266ad,
+0x4631259486c1a03a, 0x516df5d711b6a069, 0x199d50aa141408fd, 0x1d54ed82623df891, 0xa40fa108ea0e1e43, 0xf1b80f56300a5a60, 0xcd4e4766edaf6d39, 0xc5d790fdb945eff, 0xc47c1b3fbdeb1b73, 0x1ac5c2a04,
+0x7cd007283e491c73, 0xb7b9d699bebe0f9e, 0x68719eceb9251607, 0xee86e6e63a75e8e7, 0x7be53699e7a7a163, 0x546fe26d30db0723, 0x669cafffb0601d33, 0x10f3e1113bc0d168, 0xc016461d06a7c7e2, 0x27baf91ee,
+0xfd6c6a6c66e0ca93, 0xfdee030866a8a879, 0x7ec27b3e65e3b454, 0xb24bfc7fce73c0fe, 0x981b6fc13b86f4da, 0x493201ff097c05d, 0x83885fbbc91c25ce, 0x927b0de1fdfd2455, 0xdab12724e6d99bcc, 0x193155cf4,
+0x68692e3e60729e65, 0xd40dfe231eb5baeb, 0xefaf934b75f67513, 0x8409616ca400ba38, 0x35dd68222d926391, 0xccc44df57965c32f, 0x320d019988eb5f97, 0x465722d28e63552c, 0xff3baafb9e62fa7c, 0x195fd73e3,
+0x974054d9f25bee91, 0x4aeddeb742bd8116, 0xb4133952d152a578, 0xa786ccb512d3dd8f, 0xc618f0d1c5650bac, 0x10668ae0aa53caf8, 0xb0b1f50772ca8b1a, 0x95935b7ecf9324ee, 0x59e05c402dd79c7, 0x3afc6a0b,
+0x2df00851fd682395, 0xd039b0abab2bd7cd, 0x127077b5e4139521, 0x5489a8e050b51c3b, 0xa9f58f1a938438c4, 0xc6ed7186f399d44f, 0x683e6b2ae0fb336c, 0xa736edeb56460992, 0xdc4caec0cff8e115, 0x15f58bd67,
+0xd0c2d473af99554, 0xca8e931fd661e6e0, 0x6e038222785c501c, 0xc09fa760592dd6de, 0xae678089eb349064, 0x8d2a6ea08d4a5552, 0xc4d75f8d385d7740, 0xca2f4852500cf7de, 0x781a099c1d15078e, 0x99465d40,
+0xca7bbdc46a9848b0, 0x3cfa9e92b2176107, 0x93d6df5e4dc3376a, 0xcc0b8db7e6b54674, 0x7df8a78e386307dd, 0x353a1f4b935d1d60, 0xe6904ffc6151125, 0xc76c6c597177f4fb, 0xde738155b55ab014, 0x19b73990b,
+0x15f3e35caabcb3e4, 0xd7594a3c1b5795cb, 0x114f442c104cd814, 0x32a2b1117e5cf0c1, 0x4208a4097b7cde94, 0x7134d3371d2ebce, 0x931ccdf7eb42b44a, 0x4f3b40c58954f6f8, 0xaa8bca2ab33db444, 0x13272715d,
+0xa6addfc9dd5c752, 0xeb1c29e17b297819, 0x8e0da1263829bd2f, 0x4143519a180c1c89, 0x185de49078e8ad22, 0x9268d2498432932a, 0x454281d7adabf815, 0xb211dc4a632211c, 0xd446f193779ba03d, 0x1914d9e80,
+0x63e00e6d9cf55ff7, 0xb5ab8940d649508c, 0xd09317fe70d090d4, 0x81f03a5b14ae84f9, 0xd3dc658c247e3ad6, 0x71c8292af434bf3, 0xea3a782d4a8d3aee, 0x1e0746e0e39b478e, 0x5e429c281f2ce798, 0x43e4998a,
+0xab9102ba4aa3645a, 0xad73385b3da1ad8d, 0x3605e6e7ff22c42a, 0xd2a052fd4d5ac913, 0xf6dbe43891b4f053, 0x9523d357f57050e9, 0xcd73e3527770aa47, 0xa190de947e49ac60, 0x9b05736ba4cf756a, 0x1c8f93613,
+0x983eb8bf9935506c, 0x8380ee4f0362ae47, 0xa46c97d002c15d4f, 0x631b3b385de6540d, 0x546b11ccb5e9f6d, 0x5295ec011974c417, 0x4c460395c2dc72d4, 0xe480f0713add8501, 0x43e7d77a2b0490a6, 0x225443713,
+0xc4a82e47dc436477, 0x30c3392fd2c49adf, 0x36df29c53ae16a9, 0xb627f70041727d70, 0x15e41ecb873898f6, 0xb419107abf7cf3bc, 0xdbc488043e02144, 0x71546852800ff3e1, 0x4b8e7af09e975135, 0x15477c826,
+0xb5bece1a87a42f2a, 0xaea1b32c51729fba, 0xa0a06ff7e40576b6, 0x4b677d2ce669ed71, 0x304d3555e62986c7, 0x9362a3b394e8617d, 0x3460a51fe708fdaf, 0x4d386c2329ee1b40, 0x1a58ca5d06d849e3, 0x12a83a900,
+0x668f822b90b077f5, 0x7877dd3f907aa632, 0x4de9da2aed0f49b9, 0xe5e8f6b109374c1f, 0xd4862ce24844fa6e, 0x68d74f0d6cda962d, 0x6f1234b83c8fd25, 0x81e557512f925242, 0x8f03f7b7395b0d14, 0x100c4fc28,
+0x314bb8c3e9ab0c1d, 0x9076587de5da08ff, 0xbaebf74905bb1497, 0x130d73f271dc2727, 0x8d921f9bee61b333, 0x360f974dd8afa97d, 0x5e56760ebc80aa84, 0x2e110e08fcdb078d, 0x15fa1aeb80be0255, 0x182fa0be4,
+0xd0e175cc1c68e683, 0x2ba0b1a9f2b4a00a, 0x6fba4f53ecb03ce9, 0xd35fde99f082a883, 0x979413d90632d941, 0x671d74eb8062dae1, 0x53cbf600036838a9, 0xc3326b0dfe908478, 0x150e84567805eb27, 0x2771275bb,
+0xfd730b16942b8ae8, 0xb651aee400a83cc4, 0x22a84a983529a7f4, 0x81788f8f447b1e69, 0x37fdc85d39a8991c, 0x7714ceacc08d7f34, 0x1581c40710e1a8e5, 0x4848883e06c17041, 0x12d625cdd018616b, 0x159cb852f,
+0x173e9072ad15bfc8, 0x2a76038cbfe30d62, 0x31d0927ef48f97f, 0xe20589b807a01e21, 0xc7a6ae0101cdd5ee, 0xeffc6c823b6cc95a, 0x529ecbf85c951328, 0xda481db47afc1f16, 0xbf75c98e8252f287, 0x1df074f87,
+0x5a250ca3d3c6c911, 0xb8b7e924b881fe9e, 0x945344ea8bc7151, 0x3757704dd66f5723, 0x196f0fdc2f4fc709, 0x6f4837daac08a4cd, 0x2c8e2f21bcc22f2f, 0xca3828d49d360352, 0xe20c2392fddd8114, 0x682927a7,
+0x6774ea64ea1f8dd0, 0x8ae0054fa767766b, 0xa80edccc86de5538, 0x39acb68339bcfc5b, 0xa87c29378ea06ab6, 0x9b2ba4350cc94492, 0x78c569029724a6eb, 0xfabf7c65aa938490, 0x2ccfe699bff8ad45, 0x302c4cb,
+0xc69ec54fc19b5480, 0xbb2282fb97bb7ef0, 0x2b23bc8026834c9e, 0xbde11b24625c566c, 0xc03b268793e115b7, 0x1dee20584a93c99e, 0xa227c9ab672c1757, 0x5b516680a4e3fb07, 0x12b8ee563e65aed0, 0x1b0feff01,
+0x34812fd3e4d90a92, 0x4556397ddee18295, 0xcce9fb86d21ceb4, 0x640f3f4f796f884c, 0x71594722eea54fae, 0x73f57db16ceadb69, 0x30ed0bc0de9688f9, 0xd765d822bfe83380, 0xce8c462d8553cf0c, 0x47089d35,
+0xcf87ef03db440633, 0x66fcdeee07671c2, 0x645154c84fded670, 0x99e93f876aa89adb, 0xc0555d0ab08be3d, 0xdab82e8b9f39e954, 0xfae6765c649459c, 0xfc30cd370ec82a36, 0xbcc1c0c02ca1dc2a, 0x2070c214,
+0x7f0f60f6f4b1eaba, 0xea330f7a8883bfa4, 0xab30f2b207221eef, 0xbcf4fa7835f02e10, 0x5d3dc4ef17ec6c9c, 0x14c7320a69d1fde7, 0x5555cf5243618659, 0x5684bb05303d2591, 0x125f95fd6e107be5, 0xea2b38c5,
+0xe7ed2331a104b22b, 0x69e340c9f49dd073, 0x9ead21aad00f33d7, 0x5114f634215406cf, 0x1f9fcf0bc0c9632, 0x1f2921741d3ab1f9, 0x8e3da122bf9b3d4b, 0xd6936c8bfa1db87a, 0x876221a8aace3d9e, 0x1fa910ca0,
+0x5d473d7fbebccb29, 0xc9c6be7be5a6421a, 0x1974bcf3318ee7a0, 0x4e2b16550757501a, 0x55853e84ba5fa72b, 0x2e6bb54490a89f52, 0xcf49a4930e17e2ec, 0xa225f55594576773, 0x97092da9f6675af0, 0xca3ebc2f,
+0xdd4cafd98b10216b, 0x84c520d145999220, 0xe4418c0d2dfae61a, 0xf08779c17dbaa93e, 0xbd50ebc027def495, 0xa1f4f4fe8941a986, 0x495a4af75355ab4f, 0xf81577ba84614eef, 0xfe8a186f2213aa5e, 0x1803eedc7,
+0xf189e449c3da4651, 0x6d67a10bdaf36a5d, 0x1045278a1a169c3d, 0x85a633d2aa04a823, 0xa4548e4e3f2b9f64, 0xe1abc6d06305c787, 0xb95ef775c9523d0b, 0x226aef97b128b618, 0x8ff3265580b12574, 0x30670371,
+0xe838832a373a02e3, 0x75729fd8c146cdd0, 0xe9d1a8c2030be2af, 0x4cf80ccdfb184b9, 0x2e1cca7a87c0dd6c, 0x6ec52cbec4c77150, 0x1163575e282f759d, 0xdb9c4d81fbe429d2, 0x20c21c754df4ee2e, 0x8f71f947,
+0x8be27c46cb31fc7, 0xfc4b511aa2b5d3b6, 0x86e167631bc218c, 0xee77843ba2fed480, 0xa6e16d74be731cc8, 0x32d041d9dec1dbf7, 0xe94aa7a4c16bbcc4, 0x4f1f0ee117238de5, 0x757b9d8e13742761, 0x1ffcc7ac6,
+0xc2844c369e2da4df, 0xf9557201a0d8f90, 0xe73154c77b2bc5b, 0x297d68ac09ce313e, 0xed217bad9dc1773, 0x738aca7ba5321951, 0x1c051f375991f34b, 0x969fedb74c3fda06, 0xe87739e8236eecf5, 0x257edf6cb,
+0xbf2ef23974578ce3, 0x87179447534d2b9, 0x9bf036ab7f713c3c, 0x79c5749be6f4540d, 0xbfa5c821f37b05c, 0x5eb9e24c98bafb34, 0x4d4a31a616cce07a, 0x9a94d9a489b8bc70, 0xb7ab6ecb123ed756, 0x187d8e061,
+0xe52ab9252b1027d2, 0xd6db4c80e7b28722, 0xbe71af594ff4f0cc, 0xe9065bb34906ed72, 0x9fcecd404a4070d4, 0xd699cfe7adab0901, 0x2c698e09e6655a26, 0x9ac86b2796042a1a, 0x1c4d257a027eee18, 0xbc0e6695,
+0xd90005e58a9e36fc, 0x7017e1f85175921c, 0xcb93f3bc7185def1, 0x67bf9d609e958d88, 0xc9982574a878e32c, 0xc95e0d1132bbe8d8, 0x6d1c188ddb053302, 0x97909a2c27873bc5, 0x3a2f1737e7eb3df5, 0x1472f296f,
+0xdbc6c707aca48bb3, 0xabbf9592ea209750, 0x6636b7e80cf4e5ad, 0x1113369f84300d63, 0x40b7a1928b51b865, 0xb2be44ab115017fe, 0x2e03b1e0434563f8, 0xdc76b50fae4c38aa, 0x1c1f2c21b0a9f627, 0x1e1b7c4df,
+0x2eee472c6ede85ce, 0x92fdcd0bcf6d376a, 0xc0a030cb241ac3f5, 0x814e975bed7809b0, 0xa90fca30cacb7ecf, 0x3ea3f62bb5b2492a, 0x5578d87a6b62f8d4, 0x1d120d1d321aef9e, 0x84a29a39422bdc7a, 0x1acbba6e9,
+0x7a3658ae34bb78b4, 0xfbd0c84a80cbe3a, 0x12d1c6d8c00a965a, 0x7009705626888b4d, 0x5e4283dccabb56fe, 0x59119247ff8daa51, 0xe3c164b44b3f7330, 0x8bbd00405bb175f6, 0x3771e1088ce60b9d, 0x20dafff6c,
+0x90f3d54f0b85f3a5, 0xb04865175dc7ad71, 0xbded1a4b1852a92c, 0x5e475e5ba0d8106a, 0xd01620e1fca22a5f, 0x65dfc273d6016d1, 0xefcc12c524a1a004, 0xdee04f26033ae0e3, 0xd5f6257f79c12bf2, 0x22d065e78,
+0x8720b8e2cbc5286e, 0x4e093f9e8c99c35b, 0x109c988a45d7d7d7, 0x89c12f99fcf5b167, 0x1fa7ac56e29500fe, 0xb60fa1b74655ee9d, 0x288422485ef3280b, 0xea9753d445d8e172, 0xa07a8297dbea21dd, 0x9dcc4506,
+0x5cb040381a294083, 0xe3ab858c736cf6b7, 0xa1fd34601bc9f977, 0xf552c5d3ecb7c441, 0xec3d7aa3686139fa, 0x6d71089b7332076b, 0x9987d3df1caa999c, 0x8b636635e5f7dd2e, 0xa2d2bd81f0e5f6ed, 0x4c5aa3fb,
+0xe79dea7a3f35a38b, 0x880dc2a7b9f66dac, 0x7ce62758c5256eb8, 0xbfd0a245137e3ffc, 0x8ba8543c72fb2468, 0x88eb230ed75026b5, 0x8af8aadb61af896c, 0x9fd4ffc22de2038d, 0xb1faefed3ecd118d, 0x4508c6c2,
+0xd244ba97ef9021bb, 0xf926f0a27950b409, 0xab35de640e0d1793, 0x577f144ff963bfcd, 0x617cd2c9843bd02b, 0xf73cc2859303a956, 0x45ca313ab3ede1b, 0xb232cccf49d1ea38, 0xd865a8cb154a4b39, 0x49379a17,
+0xf39c705eb0ba72c3, 0x6678fb1e7a32983, 0xe9c9bd8229eee2f3, 0x314287e18331af17, 0x2f402cc03b2754db, 0x1cf35420d3e85587, 0xdd70fce4154d4986, 0x3438115ad6b288c7, 0x194f3b30ef3d23ea, 0x1e7096e90,
+0x4bc90fe558e7937f, 0xf2c09cac61678850, 0x2a0c76bacb8f3e64, 0xd8b57216d915ce5d, 0x15e485e9b3f08621, 0x17e6166a91aa15ae, 0x7a373ef5e96151b4, 0xdd62e5bcc5e39bcb, 0xffb11def73116b60, 0x1ee7a2f77,
+0x8a0a58cba55aa054, 0x29069a518d58d16d, 0x7d45f08f7fceab3b, 0xb5cb16311c128a48, 0x8a13fbccde03ed19, 0x3468c6c7f747534d, 0x12f8cb8853d0697a, 0xea1413fbf977dcb8, 0xd650b34e7761956b, 0x27b585617,
+0x23df2ca58990c003, 0x4c54c30a9903a8fb, 0x344dec72de4c6bf7, 0xd9c574ba1999511a, 0x1dbe27170355c98e, 0x3a36549337d0483f, 0x94c2686e5e0fd34b, 0x2796ac1c2375b855, 0xef9bb1c4d06eac01, 0x6700008e,
+0x3e0bde90188c84b6, 0x8e849727a3850c82, 0x55412496ed017018, 0xb52b291bac547ece, 0x76bf64edceed2263, 0x79fdb74af9de8a3e, 0x533e3ba325c0d15e, 0x8fa9704c48f2870e, 0xb0a5bc66f13c4dd6, 0xd305fc4c,
+0xa540a04293f6e323, 0xa869dcb4f7d99fee, 0x5bc8e201fc6273a8, 0xd90695188ed5310f, 0xfc1cd039d71ede60, 0x5c6438ff5e816372, 0x99368f2155ecce53, 0x89024cde1339f474, 0xe81217e589cf4175, 0x1580c2909,
+0x5b76103a75364176, 0x6f051f6dd725f2f0, 0xb1dfbb32776c15c9, 0x97a237cbc84aef89, 0x23dc6df34312b988, 0x6b8df9f348e839c1, 0xae2034d22e145cb9, 0xdf8aa0de528a2e5a, 0xfeb974472020fc55, 0x11b15f997,
+0xf8f474e21703c960, 0xa7367f0988342d01, 0xf6aff6898f1aabb7, 0x2ff23f3571e9bd65, 0xf2f5105dc96ad69e, 0xb50a3103f34c024, 0x60888e20827c7cb5, 0xf8f81b6a47ddf5e2, 0xc608f65601da227, 0x2781a93be,
+0x47fef8906c79205c, 0xc9ee621ea49fb1b0, 0x284e4d422f925148, 0xe55551c579c6c0d1, 0x416bbaabd96ea218, 0xf039a399e03a4dac, 0x6e460593a74e7846, 0xb07ad79ed91d1c73, 0xca87a09ca52bba1f, 0x93d41e2e,
+0x52faa3f606b7e478, 0x822a97dab7e2be69, 0x988d94f4b2c85d4, 0x92414651a04b3a32, 0x369a5d8b2e670c71, 0x72c14aae982bc9e1, 0x6000054fc1168798, 0xf9e76c729fa9c2a1, 0xa9cb3c5ce92ec7d8, 0xd822a03d,
+0xfe5cf172ab3622ff, 0x227da7acfc0e7e, 0x9399b48f4ec8ece2, 0x72864078040fb04e, 0x1deacc8ccd62ef79, 0x92dabd0071285cf7, 0xc7697a6df0d2d43f, 0x83e3efbaafc06047, 0x609d073f66167a1f, 0x184cc473,
+0x2cc80589de34b1d9, 0x922c90f51e88c2a5, 0x7eba9eedac9a7098, 0xa6a0deaae5b5eea3, 0x9477dcc317520b34, 0xa7a4be5c657f6f17, 0x1f30de12363b61e, 0x93121230e4036d99, 0x603859a1a675e2cd, 0x20418f78d,
+0xd7cd52196162c7fb, 0xc318067ece69b323, 0x4dd908e9b419acc2, 0x2374f77d3d5a3f77, 0x85cfc6516a7dacc1, 0xbdbbe027beae884, 0xcf66897b8f7b98e0, 0xb68e7d4f1a008847, 0x1b796952ae24305, 0x34d8a34f,
+0xe7873e4d7d556363, 0xebe254b5ba244926, 0x78aa1a8f9dd40891, 0xfacaec47c63e9ca, 0x6703e6e71ea3a97d, 0x216f5f990fec66b2, 0xf030d9d471f128e8, 0x8fa795e35a449286, 0x3979c1ce4a3f1842, 0x23f81495,
+0xcc2a81255490770b, 0x12a0243f51d8d579, 0x867e2fb2bcac6599, 0x8ae42ce07b6c847a, 0x1f8e38e67e4d45f, 0x203a1f1a4214a8e5, 0x9442de990d99608c, 0x43e31debf86bf91, 0x8bb7021a8852aeda, 0x6bb47155,
+0x17c2a07ca077ba55, 0xaa85b55a1b2c1ab5, 0x969f1963f8031815, 0x3a63c9a0a86e9e95, 0x43fc3b7decf9dc44, 0xd67cdf5537ef4c6e, 0x8be7e2a05c2e3ecb, 0xfa38e10ff347d33a, 0x8ed9d88145c5e1a8, 0x361b8bfc,
+0x58f3820edc183fc2, 0x67f46d33cbca361e, 0x6ec3a314f6b49525, 0xb40c5cb75eacf786, 0x43b57efaa27015ae, 0xb5b716458b0a11f9, 0xda095b305b927401, 0xb659d6c1ce0b3880, 0xf06aba6856349e04, 0x1e677c357,
+0xf11de328b6dbbc9c, 0x2ecb19880e3c8aa5, 0x2ee6a300b81aa2d0, 0xaa0e2a1f580c04f9, 0x8b306922e72cde98, 0xa161a1dadb7052c9, 0xff56221ed0cc8e5, 0x8ff083a8b2f2a86d, 0xfef72c857f7ae3d3, 0x16b81ff54,
+0xcc82e61f3aaab366, 0x26b6aaced3b69d59, 0x382fd8c8da31c9b0, 0x64d999e6fe10608, 0x536f52831a163ef3, 0x9fabba2eab256014, 0xc7e99d01d518acf4, 0xeebe6fc3b4e9f2e3, 0x7478dfda1ee8aa28, 0x269805d90,
+0x265ec072e1f13516, 0x66f3872d95c9ad4e, 0xdcc4accb5e8084cf, 0xcf221ade66c9883a, 0xd17579627b86602e, 0xce95116c999d91d1, 0x9e30ec5bdddcd03, 0xd849eb9bb65f90b1, 0x69939359b5ca7267, 0x20ccc7c66,
+0x660f042c36b5fbe0, 0x883fc7b644bd47a, 0xc51db6a325b71901, 0xe516765312dc8f5, 0x2247930d043f4315, 0x942dafb85b905a87, 0xf5dd561a07ee1516, 0x434848e742fd8482, 0xa9e87a936b3a8abe, 0x176c56648,
+0x5efd4782dfdb97c1, 0xdae1ec1c50b5e7fa, 0x61fc0ff1dd8dfa75, 0x31e978b493854971, 0xccba62e9de0ef2fc, 0x5f9ba5211835c22d, 0xda3b78b1362ac410, 0xfb44e42b314f5e5b, 0xabd39f3257450071, 0x211d4f4bf,
+0x8911c57e0fcf5952, 0xeedcbf2ff8ffdcc, 0x9d7fc340a2a631a, 0x888822621e734ace, 0xe1f7c3fab575f002, 0x2322a748d6942ba6, 0x8a21afe8b532e7c4, 0x2d9274c828205073, 0x6ce271f191c00642, 0x23307130,
+0xaa22e0831167e8b5, 0xe573bfe8bdbbff9c, 0xb06b65495ac18b45, 0x69e0b7be1d405eb5, 0x37e4ec9c7a1c0a48, 0x3ce30ccf15208e98, 0x530cbc2cbc7235aa, 0x5759203dbcee9aad, 0x4a05dd43e943ac62, 0x20ebb43fe,
+0x19d1ea7cae4ddaec, 0xd7da1e36e729a0b7, 0x340f76a1a878c85b, 0x87318c9babe8f817, 0xb07ff595ca42ee65, 0x3c4c00410240d8bb, 0x1a35a366d35e2240, 0x6a631dbd157573a7, 0x2a88cb8f8538d25, 0x2155d66cc,
+0xe80c8cbb5056c558, 0xc85057e9235ad189, 0x2a8b3b5f07e1bb47, 0xa95feb4fcdbc7f6b, 0xf36f746269cf027e, 0x6ce883ebb0097ed1, 0xcb7721a91997a495, 0xd38891179b6513bf, 0x121aa1af5e9c803a, 0xd4852740,
+0xb8560c7eca570f12, 0x7ef5f7ece14108aa, 0xbbae98e1679fa778, 0xef42e23097779d43, 0x919f2af151af659b, 0xf7cd034229385abb, 0x47d377160274b85b, 0xa5089564b98038a5, 0x629872142397e3b9, 0x16612f169,
+0x1f1e2284e36adc53, 0xfcd1ec5cbbf1826, 0x15d411cab2b26814, 0xbdf064746c81a30e, 0x290638265e2d8496, 0x958d37b989edae82, 0x8ff1f02e67899c39, 0x1833c1a469fee7fb, 0xcb21d3763f4f81a0, 0x1657593d,
+0xe2b51d43c894a805, 0x83c2c7ad271aa35c, 0xb2a0f17c6bec1128, 0x9574aabdbf691f4c, 0xe9f66528548c6f9a, 0xa55744029c5e5da1, 0x8006f6b16a1ad068, 0x95947ebbae875a77, 0x42ec3bc644e54771, 0x57f30c1d,
+0x93a21131e8d43fc4, 0x82eb3c0a7a26f203, 0xace7601056fa883d, 0xc935190d1f06a52c, 0xa671dbe3d71ec8ec, 0x2824e29526b9a612, 0xfa3eb5debc4e487, 0xbc6228bf7b63db9d, 0xafc94310781406d6, 0x26a1510eb,
+0x40cc87ba804771c4, 0xa1c5a734de16630d, 0x7e72ceded4473e9d, 0x4d26668f04ff6935, 0xc6506116feec4947, 0x5e78ccdf6a8784cb, 0xa1895997397bd6d4, 0x5f19d9861e86d7e2, 0x6dcc696bba04bf1d, 0x17476de3d,
+0x5e462255ca8724b4, 0x200c3ccb4608e7ec, 0x7a4fac74a7c1f2ce, 0x249d851d4ad65d7b, 0x184bcd186304fa17, 0x97d15b5771a5e428, 0x16b30fbe3afed1d9, 0xfe1ffbee2e2eea42, 0x80f9fade3a7edbd5, 0x2c06ccac,
+0x93ed0e055df70197, 0x8833a2d7e7a4a063, 0xd4f909643b247c3c, 0x44d1ee62d085e8d6, 0xc4dfc80ebd286c9, 0x28b72f13f2f69141, 0x84b5a9a0e23c9d58, 0x8c8f3dd06851bc7c, 0x6beb3df62921047d, 0xd048eeca,
+0xa990b0f97ccb35f5, 0x4eed77b74933e127, 0xd40e960a44cca313, 0x1402fb750f0e4995, 0xafc5208f168d3bf6, 0x952db9b9fcd85cf5, 0x646bc524fb87418c, 0x9694047fd93380bb, 0x7853674bb86c5426, 0xc8b0828b,
+0xf3b23101d31674a2, 0xefdb5b2791eaf064, 0xadc045b3a41c4763, 0xce5b3fcacb8cb0dc, 0xeabdc5d2369c2e86, 0x2f2039724d4ca03c, 0x18ed3ad7d3e1b1b1, 0xc3c0a777df610a0e, 0x3fbe53cb0c6ad1b, 0x263b09581,
+0x56925eeaeb6100f7, 0x1a1fc1d9d7240817, 0xf6bdbf6747010fbd, 0xf7bed6f5ee7fd106, 0xec5cdd15d07f5002, 0x6d76951824ad75dc, 0x81e1c6832c190c47, 0x538414f64247c3e6, 0xba4d3fd6624be584, 0x1c9f9b696,
+0x3f68433c04d5fedb, 0x4906248dcd2d903f, 0xd94e12140706b421, 0xe54aa8da34e3a6f0, 0x263aaa953933958a, 0xb2292287b683dfd3, 0x2ba204432af20e44, 0x753d7fdd90f9e2bd, 0xb3feb04eebf5a88e, 0xcba70243,
+0xab5596df5d01b012, 0x7bb88c816f4c715, 0xca464dcc1602436d, 0x37835d9e06a4522d, 0x51bef880c4001f7b, 0xb88eee6ecadd0130, 0x710c8fd4af6aec66, 0xd684bee15a71c9f2, 0x10973f7fb4d5cf4b, 0xb41f4f0d,
+0x5e52906ac9be08a1, 0x3a7fb793c0f8843d, 0xd5ceab7ee1bb9d43, 0x83ae1aa4733b4778, 0x9992eebfd70dce6d, 0xdcdedba5b9e26e89, 0xe16d1f4f01f09fcb, 0xd8cfafbb67ca0a0f, 0x2f270d6479653da5, 0x1679e55bc,
+0x384e4f48339ede4a, 0xa9db307bbf5d16fc, 0x7bbd2fa452155b9b, 0xd506d1fe77d2e1c0, 0xc6576ec4bdb81f1, 0x99890581a62b9db0, 0x154952db71dd9628, 0x6c8d65751b025a2b, 0x5d66ed042c18b89e, 0x155fb1b6a,
+0x7a7fcdce6ed9d63b, 0x1ffdb61c78bfbf8c, 0x7f9ecaf8cf60e0bc, 0xfa943434f5e1cc57, 0x11219bc796a2e336, 0x61d0b03ebf5118b8, 0x9083e608acf3a434, 0x4835bd5b0b37c364, 0xe76354d6226c455, 0x1a278690c,
+0x835c6130b7ab7088, 0x22ff6da8af79fc89, 0x581d34ec53bf3b56, 0xe69708a8cfd9b10c, 0x5231e3f5273bd0bf, 0x2a045a66b7b213c4, 0xb1348c87a9f867b0, 0x19bc711c46242d4a, 0x89fceacde4aa38b, 0x8c19b23c,
+0x87b75c4290ffb025, 0x64cac9e3de8b16a9, 0x4b5b9afab977efff, 0x6fa2aa45324561e2, 0xd94d64284d8ba7ed, 0x3641cbf00d141501, 0x710794016bf91477, 0xe6a456fc976a4998, 0x21c3ca9313d77948, 0x21b28b212,
+0xc6401bc6d25f9273, 0x219c968bf44b8360, 0x4490fe9a231a0c90, 0xdbf3d8edc9640427, 0x3ee963de89a6f468, 0x1f6a921f6bd57f30, 0xd3ce8d20608c9e86, 0x3fe3676ab982db6f, 0xfa08493a8bbbcf38, 0x3f4a77d4,
+0xfcdfee61563e302, 0x7133c1a8820ca294, 0x59a73adbd99666f, 0x5e479f3ddf465c04, 0x37cce02f3728244f, 0xcd1ac9a0f391a09d, 0xe714422585ccd72d, 0x92c13c2be4ca7165, 0x9fd0305be28c507, 0x14022c9cc,
+0x61346e9fb9b87ec, 0x8f0acc41a69fea08, 0x61dfe15e0c51b719, 0x848da53f9893d43d, 0x8aa1fced5cfdcd9e, 0xff00f4b814e90bae, 0x6ad501f2631e346a, 0x643b3837fbfd0f98, 0x8bb1f6333a599f0e, 0x21cd3d2b,
+0xb00118c274088be6, 0x2ffa5e401154d4fc, 0x8b1eaf719f5ebf10, 0x318d5aa0b8ff6196, 0x22e3ffe64c63f23f, 0xad449a1d0aee3f0c, 0x7b2236ff6bbc8167, 0x520bf17df1ccd4fb, 0x6c5a2d1cd7b69dbb, 0x10a3db2d1,
+0x44391a8824cc5137, 0x677342f2eaf8b232, 0x5ecda0b4cb460ca9, 0xcc16744fdc8b61b, 0xf7316d8c6dc92345, 0x2721e82b50861df9, 0xd3272f0db024f668, 0x52f524debc23a75b, 0x5aab65da1a62214f, 0x1b8be3967,
+0xeddee899b26e6010, 0x13cb25db0575383b, 0xc81c31891dd84a9d, 0x3186f912de167ad4, 0x601f84eee0bfaf5f, 0x90a93a537fbf5b81, 0xadf462fd944e092d, 0xbcadb7ac24961972, 0x844341c94910ebcb, 0x137de3cd9,
+0xdedfbad079b4c9fa, 0xd5f4f79afb1ec578, 0x1103dad72a96956f, 0xb7de6a08a63cde98, 0x5a2a94d306f9ac7a, 0x67814e20fdfc4856, 0x97a517e08009457, 0xf7b68644547dccd3, 0xbb16931b34f63d14, 0x19e57f616,
+0x9758f0c8cf5eb4bf, 0x83fee1fa0c30a010, 0x38cba8a89d17414b, 0x795a75e262a917e5, 0xfe95d8336e9cf6b8, 0x5d000bd42a4edee1, 0x263150cd71a44e2c, 0xeb9a75032de11c67, 0x7679946e5cefed06, 0x24367e260,
+0x6be4cfb35eea160e, 0x269da418df99e814, 0x7b8bd3e28dd59f95, 0x632d56b7fbcfa979, 0x7c3842fd2b7df80f, 0x418df99a3fb68a1c, 0x17feb37f3c10db8b, 0xfb482fafa97e9784, 0x9eb386becf6e9cd2, 0x12e729406,
+0x578f8375bc7c9406, 0xbc9fd58d5caa74e, 0x50bdf0a5d335b2db, 0xe7f5ad8ec6870473, 0xb7c4e4167b794802, 0x7751610abc24ca83, 0xb85926569bee7340, 0x8ff04d825cfd28bf, 0xe80dd8ecbeef5936, 0x78f838d4,
+0x621da76394b7e712, 0xb3bf012f1c6319d1, 0xbc10bb9001d07fbb, 0x1d1a9137fefcad9b, 0x48cf109033b10567, 0x5fd33c26d0f5be0e, 0xd37c81b6730ebf24, 0x31abcc031f7ddf49, 0xd085515c61dfa08a, 0x1e0761f89,
+0xd81cba21c8125222, 0xbd3015d023eec77d, 0xdd1edac99dda7489, 0xdd694856db1fb2a1, 0xb8e20494167e845a, 0x6d9b5317d7dd1eb1, 0xa7178f84d9894a62, 0xb49b1d01906d7aea, 0xc481df3573650ec2, 0x155962ace,
+0x4cff9b9d34b95f1, 0x7eb5571cbf6de06c, 0x168d9f4fcbd0cc84, 0x3e8b8b96d549888, 0xcbf0667e8ebffc1f, 0x7bd1cad708766843, 0xba43846aecf38669, 0xbf4729e9ebd43ed0, 0xf1d41e02e731db1d, 0x91ad73ba,
+0x2b9e3c2c8a84e802, 0x6a87bb492bd41648, 0xef940e097b9d7ee6, 0xeb942c6a3b2e3400, 0xfac43caa96f2178a, 0xa7a00220d709ae3, 0x2b7adb6d26aa8a5c, 0x3a3c5cdf1cf984c1, 0xe1c365c7a951306f, 0xa5b3c2a4,
+0x893473d00975392e, 0xedb551803a8c7455, 0xd2dbf9f1b202ab84, 0x191a02d53a262822, 0xb5fe93efb94605a7, 0x2c9b939d97cc6ecc, 0x36ee266a13f02697, 0xb8b0539a8f17ae5e, 0xed006a047d5021df, 0x11d946d51,
+0xbfc6def28413e86a, 0xc4b21bd5fc11efe1, 0x301cf4a219b14341, 0x96982e21eb16dc7d, 0xac7f94eb2768b101, 0xa40c7b4996ad32fb, 0x6102f61b06349609, 0x413f9169bfa39d69, 0x564bb40326a76909, 0xea83255b,
+0x838dd0955fc869c5, 0xbd507c89574c0fb9, 0x2f699f0153dfb16d, 0x98783fde542dd8c6, 0x4a2ea727af765d93, 0x34456a80779b7d0d, 0xc5b8e40d2f1f1d2c, 0xfc696dac7b2ef2a, 0xca9347e7ca0cc12b, 0x14dec4ee8,
+0xd51ac7f764c10fbe, 0xb451843199875c0f, 0x189d3cdd06f6dee3, 0x7d0829fd7885893b, 0x489811fb8f2f0032, 0xd4f26bb40e9e6f1e, 0x286a362d2f2f0bc5, 0xa819302b5969d8ae, 0x242fd299dfae5ea6, 0x64e09c68,
+0xb41ff412c7671843, 0x2255f116bfa6948f, 0xbd64e8940756f747, 0xca795742343d5671, 0x8d5cf07894ff504c, 0x77cef406ebf44de, 0xbcec2ecf5c01bae2, 0x3ccd1fd1e62e1f29, 0xa1a1f8e3d16e9bb5, 0x1f70ba8d8,
+0xe13538adb0176fa, 0x325b160a9e508009, 0xadf4e43eb8089b93, 0xa29d0ec59e19120f, 0x5d77f717e3888b2d, 0x492b801575ee0f6, 0x8788b56c8253d6f7, 0xabb75648db05309d, 0x7acdd0e55ca9313c, 0x150192c3a,
+0xb09abe0005c3e639, 0xa6aec8eaae5d4565, 0x850c77946978f1a1, 0xe728387cceb10a45, 0xfec9810db2b19947, 0x14dd0512390c54f5, 0x1b832984d6b82117, 0x863d426ac200e26d, 0xd849c54791961409, 0x3b7b7dbb,
+0x2c2237d65c842ae8, 0x80ea3eeac297a84b, 0x7e795b858dd66698, 0x7fe557b4e99d1662, 0xcaf18967f0f3fe49, 0x6fc875730e06a237, 0x2b0975950edda86e, 0x5065e92c674fd29, 0xf2aa098064cb200d, 0x173a70555,
+0xa2771f13cc683cce, 0x9aa54908782adaef, 0xfa6a3625e46980eb, 0x599a2b1ac95001, 0xbf49b6b1986b408b, 0x4bba5292958fd355, 0x9ce51793f09c3777, 0x8d0c04c256c8a14b, 0xe4aa790c5c50266f, 0x577120ce,
+0x7416eac2fd4f1723, 0xeda22831e75d37bf, 0x5622fc877ed9e589, 0xfcb8b2039e833799, 0x640f9e07677249d7, 0x1de252e4bf954886, 0xc37d182f6e71be51, 0xbfb20f0d5748cd10, 0x247c811fb7462d0b, 0xf5e6d868,
+0x34022476480c01a7, 0xc507b0ce0329789c, 0xcb58340b79d84c90, 0xdd2432cc37aff3be, 0xdc696983b67b4708, 0xd2f4cfe4ed338c33, 0xf13ab737db4dbf2, 0x7f0e7e0d0d1b46a4, 0x5c5a0ea627aefa34, 0x24ab997e4,
+0xa4419b72253cd831, 0x69c7193087d7e3f1, 0x4cb125e2fff684e4, 0x7b936fa32bc6d741, 0xb0b80d9286110f2d, 0x25a8120189fe993b, 0xeee3b7c14d3e5ecf, 0x46f83da59858bfff, 0x9eb9b234a541cc7b, 0x7f1ae1df,
+0xc6bbb35428dc2a44, 0x66bd8924fc0979be, 0x230d08477ab97994, 0x7acfd6fcbf824c00, 0x6a93ad82e1c24670, 0x69d31ae40d83751e, 0x31087d40beec6613, 0x980942622d1a490a, 0xd0831bcaa52f8fff, 0x2391b4631,
+0x97899749a0f4dfcc, 0x4bdb79a099351068, 0xe9b6400caaf70aa2, 0xe0281e8d809a67e7, 0x51aad5a4c3d1e8a7, 0x2e1eba28fe488652, 0x32890871b2afe9ae, 0xf9980b9e1816debc, 0x4263c5fcf71aff0c, 0x680cc7b3,
+0xc8fb6cf38bd890f, 0x9c2f68736cc03ca0, 0x72f6d762aab35430, 0x6f680c0ebf66fc94, 0x6482c8a7fb1e9433, 0x5e06921d713baff9, 0xbda9480cea4d6547, 0x792572f5b323af05, 0xa296cbf2e4c318f9, 0x1dcc930ad,
+0xf0f162ec9372eb3b, 0x1f93ce7772139c26, 0x553576f78fb3b721, 0xa054780b96d2ba05, 0xa37679a3d17004b6, 0x25624c3d1634d4cf, 0xf58b75f6b4d3c27e, 0x88b06959b7058fd3, 0x8043d5ebeed868df, 0x27715c3c3,
+0x7a9891a435afb7b0, 0x2a7b025ee27918a6, 0xe9de0136892c0aa7, 0x7c140a17a6386793, 0xb8ff01d15807a0d6, 0xc9f96abb11e170d9, 0x2ccd795aa0abb302, 0x17e016616f7ba59, 0xa75601e48e5d9990, 0x1f10c67eb,
+0x67f1a88fef8717e3, 0x402b8f1f6607cbba, 0x7a194f27717718c6, 0x442e2b0e8e36db28, 0x37bc03e343da79c2, 0xc6a7231cf624c0b8, 0x8febc0041842feb1, 0xd24b74e4f3d6c795, 0x29f2af32a5851969, 0x230734a27,
+0x80b218dd30cf835a, 0xb6cdab2697282ee1, 0x2f916bcf23d5503d, 0x57cad5d1cbd9b801, 0x73105ce47a5a8fa6, 0x2b67165f64f7d96b, 0x5ee3d515d848a7f2, 0x6c69b7a1ba750807, 0xdc63bea6522069e1, 0x25f3a082c,
+0xf65a39dd4e5b1e4a, 0x133774b395b67a7e, 0x4367f07a34c16b44, 0xcd2117577f4637cc, 0x32c9d0d9151cf5ef, 0xfe8cb5932264c4e6, 0xca8ea588feba1705, 0x4695f5fd7f27f104, 0x4b8efd064db8b27f, 0x2383efc8a,
+0x438d9fefb8a04f65, 0x871030aa9887c668, 0xca9fb71d8986eaf1, 0x664fa6628ca0caba, 0x535664aa779cad3b, 0xa8557f9a2e11ad6b, 0x5402234ff2f090e2, 0x295db35686e8813f, 0x1c24c7309f547637, 0x1d26b7b78,
+0xd351c4d8fd3cbd4, 0x51e8fb1e6a088ec9, 0xa7c146dedf7ea627, 0xb89e3d2f76f95684, 0x4ba97f0361343023, 0x4c3757a2bfae603, 0x6ee611dca07c6afa, 0x274b5b3eedc1dfa7, 0xaa3ea980becfce78, 0x1b78104dd,
+0x9a7053ab0b4e552e, 0x5ba8340b0430c473, 0x8113c475e03d4e3f, 0x29cb7f4d8d04a9fa, 0x75edd6482000d86c, 0xe9fb2145fbb5feae, 0x73327cbc9e54cd1b, 0x671c1cf08035d5de, 0xc5ebef64a9b6bdbd, 0x20188408e,
+0x1ae805a83367cac6, 0x3559abe79ce0f32e, 0xb00c28ec3746e636, 0x4e847369c01a2672, 0x5e68a12bcc85da51, 0x2242963eb2d443c8, 0x3d4970614d6f48eb, 0xf1ce9bd0df06e873, 0xa672a19d9fd0e389, 0x1c123b483,
+0x861d6e8af1986109, 0x4926fc8973b78ec8, 0xf198462b1dec09f7, 0xd6f337be8297f183, 0x9015a2fa71cb3155, 0x48c4c1ab386c1f5c, 0x676aa39495fb89a5, 0x566f5a3792af6cc4, 0x71ce4a92a49bb845, 0x3606e33b,
+0x989fa6a998faac98, 0xd270daa963a34cff, 0x9982d1881bf49ffe, 0xf84aafe78437d4a8, 0xb1b02b2dc40bd8f3, 0xed6d6f5cd3d1b66a, 0x249de72afa64e290, 0x22f04e995259cbcd, 0xe85a915c2ae803cb, 0x125ffa28d,
+0x31b528b160991255, 0xc166427da654b10f, 0x4c99c22cc6c8d9ad, 0x9fd031bd0b4ab188, 0x89434b860ad37ba3, 0x6d37a4fb87acb7c3, 0xd19255adb03439f8, 0xdc81fad4125d03e1, 0xee2718e070269d2e, 0xccae97eb,
+0x9da0ad3bb219cada, 0x125bc239e33c600d, 0x5e052ea3b0064353, 0xc5c268b5ceecb4dd, 0xb6b3403003b67374, 0x811a3b1c4377fc72, 0xc1465d868c36dcc6, 0x95f153b693fc7f66, 0x3a4ff82ce0131d07, 0x93e2f5db,
+0xfffb5a3a86070329, 0xd507f02d738b28e9, 0xdfe68d627f4e7e56, 0xe3b8d172b7dba591, 0xcebc42a5a81e9647, 0x85c080c23438c176, 0x2628aa9f32f2672c, 0x2b31276eb5fe87b, 0xffa6436a73d528aa, 0x614d44a6,
+0x52a6ac2151e0d4de, 0x6bff0f7f5cfb5b31, 0x721780973e163253, 0xe8a8aca5fb15e3c9, 0xfb1b557e574ae911, 0x7ca01344a183e515, 0x80d9508c139cf57f, 0xbdb7e7e068c81f3a, 0xb18d94cdb5e6aff0, 0x1a5968121,
+0xc0ac89b5ef2d87e9, 0xf110b014448e5623, 0xbcd8816826a364d4, 0xdcfcb469e09e9866, 0x2ffc38a00a4bda8b, 0xcd040a692bd03148, 0xf8af1102c0435fb4, 0x78e60cfecf94eb9e, 0x6e9b9059092655a5, 0x1e04c354c,
+0x33396abfd1c67165, 0x7b1b0aac74d953e4, 0x9b045e25bb0d5ae6, 0xadca9a3c026b1350, 0x8d6b47eec883db73, 0x74e79a6709da7b33, 0x8b60e9ab139c25ca, 0xef8f47ba381c860b, 0x79ab8a201bb85008, 0x5bcba066,
+0xac5d099e81a9fe23, 0x618053c7db7b9ce9, 0xfebc546231c69f54, 0x3ba5fa24e2cd4d9d, 0x61133d3e099121ff, 0xad8baf7a4b31df42, 0x2b0ad66d79fdaa9f, 0x7b581e67e4bf179f, 0xdb187d4b27890b38, 0xdef0a129,
+0x2f6a3d8e583cf090, 0x1815b4fa21d586ab, 0xbff4775d3385ceb3, 0x79da356875c6a069, 0x6f8b436ac5a86526, 0x8b9f6c2e23b964b5, 0xecca20428957500d, 0x294a11e38d9a5e49, 0xe40fb4853d4e3a3, 0x1e3ea8466,
+0x8378a79a1dc77e41, 0x4c99326e3e9329c5, 0xb7a46b4d1ce3828c, 0xacce659e84b3d83f, 0x6f25ec3485aa343d, 0xcdb0bec1345829b9, 0x9f13b68e2d216f17, 0x5609eb3b84698f57, 0xcd8674fcf40ae46a, 0x620fb207,
+0xe2efd1b388f132f8, 0x4487a63eb7000a21, 0xb11eb8dbd99535ae, 0x99a82a5d678cd882, 0xd8d397d1f815387a, 0x26dce639d76a5b2, 0xe5bca6d325126ef7, 0xdd34474294b47645, 0xc527cb0601e45f39, 0x209f457da,
+0x4a9bfe0ce60d4537, 0x81d407a6eeac2330, 0x55138888b6a089fb, 0xc2f6f878f448a3d4, 0xdf3cb23de1f63e90, 0xaea95c1f21383fa, 0x84dd0567c9d11366, 0x4ae33e0bc3c4844, 0x4836454508ed0383, 0x1c31f591,
+0x812cab75189c8d72, 0x1233ee5c901cd43, 0x418153ed0be795e7, 0xa49425661005a9dd, 0x746455bf6f856b63, 0x56b740f7d6a1c80c, 0x5b859188f5fd1383, 0xac987c7c62658891, 0x93d455f38546e53a, 0x103695dc2,
+0xd2472b4f37c5ed29, 0xaa971500ae190804, 0xe6cdf6950dfb291c, 0x50efa96bd5dbdad5, 0xb803a9b8d3b60d02, 0xe8083b903ad3fe01, 0xd18a6ce4d9b2e401, 0xcb27a8afc1bd7961, 0x78fac2fafb6cf05d, 0x1a0c0dacc,
+0xad0e4dcd29451f66, 0xd30a3e8683d0e752, 0x241f66d42a663af2, 0x1c9c730ad532db94, 0x4c27a0f001bfd913, 0xe5b22b5aacc98711, 0x9fd9078db15837a0, 0x72f4ed4282d17dda, 0x7af1a9c89aefc047, 0x21a4244e3,
+0xffbbb08e68a4f306, 0x69bc984caa1e0d1c, 0x5614bb2cd2c1bc1, 0x29bbcb0a30188af3, 0xfb980fce7da0dddf, 0x4f10ce9a023936a9, 0xf5e6d6166314c24b, 0x4d9145381ef5ab42, 0xc18971a35a305571, 0x7c0e7a2b,
+0xcf1f814dd103ac8f, 0x7ae315bb0eeaaa89, 0xb42915ded6be0303, 0x9ed0bb4236d4a65f, 0x9088079bff4dfe77, 0xe1ad1d02f5f87ccb, 0xf6475371fe2d891, 0xf69dd242626cdade, 0x16b3bfc5e2225a3c, 0x22c9795c5,
+0x653bf8174244cea6, 0xf51353319cbc049f, 0xd1da5ecbd351f61a, 0x286ce6773f24f6d, 0x465d2ac7dead35bb, 0x6e984f15a71866c4, 0x647295ca783dab07, 0x363b09ccd717617d, 0xf5f08bd705f484b5, 0x25a29849c,
+0x15750477272531fc, 0x4d193fef1aef3cb6, 0x28bed5c0f0cf29a7, 0x9ca6205363c22bf8, 0xe16997ae1cf6805f, 0x483d2efbfa60cdde, 0x863e4e6083453395, 0x97841ba6a9c5d337, 0x18a4437692aea84d, 0x24e788cd6,
+0xcd4ddec0021f8655, 0x241dc66482a5b93, 0xae6835b804ef75e4, 0x3b598690a08b90a8, 0x5c572b5a3c3fe73a, 0x4281a4753787d5c1, 0x28d163ada9ea91ba, 0x8b90ec00b9fe7c82, 0x3ba9e527c792e261, 0x237ef3de7,
+0xb8692414149350d3, 0x9d157287ee7eebf1, 0x1b1925af9abcc64, 0x9b142d02c40c004e, 0x337dfa2c98011264, 0x7bbf604d3f2172a4, 0x2efee99670ce4b58, 0x51ae9bc9daf3b2b5, 0x6aaae9e470cd165f, 0xe43ca38c,
+0xb200e8ac5201098a, 0xa2b36cee8a53aa1e, 0x3f62b765b147714e, 0xc2ad44bf06a92818, 0xe4109fbe31c94dcb, 0xd69e9133cf13c4b, 0xf52d20c283925028, 0x20b7ca49526a1163, 0xa43676edec5ed65c, 0x1bbb82dc0,
+0x8e71007b942cc3dc, 0x555c61485c74723d, 0x72bdb76a14421171, 0xf4baab06097b1a7e, 0xa6901ac6e7d5dee8, 0x64d53de033e3a74e, 0x27f82fc083846d79, 0xf26995fbaeed47d3, 0xdde5ea692a706b50, 0x1886d01f6,
+0xc84c47dedd24467c, 0x4cabc9a6375a030, 0x298531117671c157, 0xf78e4a27ace42cde, 0x97b71a9a2e898906, 0xfe4315825a91afcc, 0xddb614b017100969, 0xceda982ff78c6bd7, 0x512bbf472bfe09bd, 0x60671838,
+0x574f693f6a2561a3, 0xc4bd4e266375221e, 0x7cd3edf790d742d3, 0x1ed8e781da96326c, 0xbea6f223cebb91ba, 0xd6d6919858f136f2, 0xa79af42c46ed9c2a, 0xf01471dad432d5af, 0xfbac81cbd831f472, 0x1033d2733,
+0x925c885d87777080, 0x6b7ac653d0a09cdf, 0x90faa66661d0091a, 0x833abaed7bd0e18d, 0x4ffda60efb045a28, 0x90f878d47f7b6035, 0x4d4c382b67de9d2c, 0xe7ce6ae79a1aad07, 0x68cf670294645133, 0x201d93266,
+0xaf74c6b5f83c618c, 0x87933c77b831400c, 0x664d59fb1628747d, 0x7a5a8b895e6c7d25, 0x315e8073a8e65073, 0x3faab002ced8c4a7, 0x9b79f444a4384f69, 0x9deab8925d1b3ffe, 0x8ff5d2a9a1d405ba, 0x480557f6,
+0xd67f721ec80dd7ba, 0x86f2cbb586c55a22, 0x82f7ba9dc20e4f89, 0x65470db39a2b4438, 0x7ccb4d4bfa90973b, 0xbeac6aeb3f2c45cd, 0xf981853898a32d61, 0xac3d829fa176c411, 0x701ea41642e789c0, 0x196782bf0,
+0x12bc109e827132ce, 0xa01afdc025618fa6, 0x8025fb58aeaa2296, 0xa0d1692c1ca0b5dd, 0x7f77894dc5661585, 0xcada3d3c251a20fa, 0xf0005c16f97bba6e, 0xda0021b4118ae551, 0xc17bca982e1df228, 0x22402ff9e,
+0xda7bfbcdab7eebc2, 0x661885dbc4779097, 0x5ea655ea009d7497, 0x2361bec0888be305, 0xcff80dab0cccc2a9, 0x76555b6a18c0399d, 0x9857ddc94bae4a30, 0x39ad3680c746f736, 0x5eda6e7c615b4970, 0x1499630b3,
+0x642c56280c704ce1, 0x9a205cd31e900339, 0xe61afd032cfc07ab, 0x6bc82fa15d641145, 0xfe0877ba905dbe51, 0x5b704526a0c062c5, 0xedd824cc4cdd0ff9, 0x961920949f9ab6d7, 0xfd75293c55114456, 0xe8f04ee1,
+0xb2a335ecbabdd7d, 0xc7936ba5fb9f7c77, 0xdf94671733774ac4, 0xb7e76634906b81f, 0x784a5f0a9304ae23, 0x1adb288a2891d255, 0x9a3fff00d1b33128, 0x452870338599cb69, 0x8a31e0ff4f6ef653, 0x1b94e01ee,
+0xbb560c50edeccd0b, 0x3f1f9bde3c677508, 0x64e49a2482fe4ded, 0x880b7b500aabc7d0, 0x9f0355791d434cbe, 0xef7bf6bce4b3e3cc, 0x1d7ea4f72b72e934, 0xbcb118585956a157, 0xd85972181eaa2944, 0x169e44b8a,
+0x64621dc1d1f9fcd5, 0x825d6c515c66afb0, 0xaa2227f14c5e4385, 0x4b18276c6afbe1fb, 0x5b287637dd27958b, 0xd6f00894cdf27050, 0x24cfbf90a1d0839, 0xea77956d1dc22222, 0x120bd93e2ba27f98, 0x26282a801,
+0x91eaf89c7c8a86c0, 0xec35e0742de3227e, 0x6388fe613697c4c1, 0x862b66263466b314, 0xbe7daf296214fb61, 0xae007b3ffaea15f0, 0x5fb5d861d9b211ca, 0x1ac35477786e5d19, 0xe43b1b29151f8bfa, 0x12a4e11bf,
+0x56a1d7295aefc08a, 0xfc76e221d69f385b, 0x631cae958c65ded3, 0x635275564aed1317, 0xdc63713fbe95890d, 0xc5fa1d0943f39884, 0xb19d119a1b8ff62c, 0xc0a75bfa738e262e, 0xf51c03adb1373ade, 0x31e44123,
+0x790e8be226f35487, 0xe09ae53668b1821e, 0x3cdeb43a14c39ef, 0xcbf2e20561b74d95, 0xf88177882386d84e, 0xac6d28ddfa91381c, 0x60a05683bcabaa11, 0x611cded57c3943a5, 0x8b4e4ab107c8fd32, 0x62159002,
+0x9dabc66b03c44b17, 0xfd3eaf24dcdce78f, 0xca54f5547284e14d, 0x20b3989a7c30ce4f, 0x4919d472c3b6f396, 0x5bc8522e94d76942, 0x766817078e0f6ec3, 0xa85a502b810b658d, 0x7646baa6371e73d, 0x230fecb77,
+0xe789eeb9508c440, 0xb10256b16f30c615, 0x8897683a75abf1c7, 0xba8f85859648759c, 0x3713fda189ef9cfb, 0xbfdde62bb0a42e92, 0xe2d6fa0942787bd2, 0x1c332e71965d8528, 0x123aa26b2b1f22c4, 0x7ddcdf07,
+0x11d23283fa40303f, 0x85f8b0651be0c5f8, 0x64c9c56f69679b2a, 0xad12dccd4e7a0270, 0xac8a4afc80012be0, 0x4a0f32b47c5ce069, 0x9893ba4a97d665cb, 0xf037e535abb36d10, 0x44248df8f79cbec6, 0x275f2b1db,
+0xd1f02386ca7e58f9, 0x9e7a144ffe08c7da, 0x92366fe7d7a9bc73, 0x67663249cacbb91c, 0x115594152c6c0170, 0xe9b84c85637ab155, 0x455ab17edaf3366b, 0x3f94ad1691d6a19b, 0xc7158cfa2582d514, 0x195763312,
+0xa06135c1986e8269, 0xb60944997b8cadf6, 0x71fadc7ee9e612e4, 0x380cad021b9b5297, 0x2f4d89e386ef5b68, 0xb4e911ffd409324c, 0xa1cafb1b6da04c94, 0xe1dafd375fdd793, 0x69619a2350d63993, 0xd1f568fc,
+0x16a88c772e3977ca, 0xa85d25933b9b5344, 0x89c8607161178517, 0x253a51848118a37b, 0xf3e5f52b9a5d227b, 0x6e91cbc06a1896c0, 0x4425b2a04d72e3ea, 0x8e5325182c814beb, 0x6eb93c7d86fe549b, 0x241347606,
+0x2b0e0b59634fe7f4, 0xc77b1f2fd586a919, 0xf79622d1fc566d2f, 0xd53bfd8eeb5f9fd9, 0x56992551a4cabcee, 0x715413bf66fafb68, 0xa9de99dfd4d39bbc, 0xb4cbd5aa84a861ae, 0x9c6d853f5e909b6f, 0x2380b258e,
+0x40512eddaeb66a4d, 0x79157d6a847ee2d7, 0xe9fc58426e17818b, 0xf27a1ba80c5ea2be, 0x1527498682b8c05d, 0xf157db80cd767208, 0x95f277b217a3fc88, 0x9c6b81f5fcf88f79, 0xa0772b320d9b1e81, 0x25d95ee21,
+0x8b4e74b7082f5a73, 0xd00b59dc2df42776, 0x2f9d7d88d0d067f8, 0xb2edf23538250033, 0x59c942034d4b1801, 0x6aa89fc51113d8f, 0x380f3e17b0a342fb, 0x43084c468286c7b1, 0xeafa7b02a3ae7d6f, 0x25c43267d,
+0xc073db5a7cbdc0ca, 0x1c0c00db964e73fd, 0x6840a5db6299127b, 0xe4d77e18c459101d, 0x4014174a3eee68a9, 0xb2fc08bb5a7506e7, 0x9c5c49c30207b456, 0xb46f7e0631d235e6, 0xb76bedc48454150, 0xd69749ef,
+0x2518ef585c0ad17d, 0x19f4a54da26dab97, 0x62d8fbb7affa34fd, 0x581191b349d97415, 0xa2e197b8174f1d44, 0x71d4fc263df2114b, 0xa90203bf2ad01e1e, 0x8385f2d5b2ff5dda, 0xbc9a77516767247, 0xc84eb898,
+0xf9550cd0fa0fe3bf, 0x19fcfb5ac4023b07, 0x49824a8f3b70ca2a, 0xe4cf5bab9f0de70e, 0x78e4237e3880a461, 0x82b129471dd35efe, 0x8b16d8fc9a7546d0, 0x2cb5afe18f40f9d3, 0xba2466c610245427, 0x157dd56d8,
+0xb76f115c5d5bd376, 0xa39027173aa35587, 0xd737ea8575b88d07, 0xa17316b0b9af123e, 0x809864d9aabf8e87, 0x6b2a6d9c454619d1, 0x6abf6cfaad31d001, 0xcc3af19b4700ae5a, 0xf1c692dda89cde3f, 0x1dbbd3eef,
+0x90b74b000f085142, 0x3832ec53c538fa3, 0xee6342b7a6ba86dd, 0xc9ba3a26e114ea54, 0xf3b5abe7935e0d0c, 0xbb320f54383b8be1, 0x8bb3fba7f915a1f7, 0x7eded9e58508b44b, 0x83badec48a9cbfb8, 0x5f994443,
+0xb54c173b24c2c4eb, 0x16ba17cc23651b5a, 0x874d9df4d3d2b265, 0x564e1df9a6129c1a, 0x87fa31dd466504c8, 0x8f03cd428f4abd5, 0x387b0e46e7c79735, 0xcbf892924b97dbd9, 0x37748ec00cc5241b, 0xc97fbaad,
+0xc12a2e8bd1259130, 0x1abb2710d31e5af2, 0x80f3cf637e33195b, 0x96d330495ab5a44b, 0x1743b8c34e9881cd, 0x2666b14ad3851164, 0x91b467f9df2e77a8, 0x10c69afa81172b0f, 0xa863498dfdca5340, 0x94bd7f34,
+0x648b3df54b7b393, 0xb70d388eb7ea0712, 0xcbb4477a78b7c05a, 0xedab19b6f01f8ca4, 0x419865d67fb41b12, 0x9b019f5426a1084a, 0xd72c179795edd795, 0xf16270fd3e28b845, 0x4780b616083717d0, 0x8be0cb40,
+0xdb79d71332c02847, 0xb04993c123fc258c, 0xb21bbbad060dc7f2, 0xe35a29257e81d91b, 0xc4daa24fd36844a2, 0x2b119c5646ee07e6, 0x8d3bdb2de6d64ffb, 0xac573163381731d8, 0x81a130a48d660847, 0x13946b6bc,
+0xbbf475a2c6b39440, 0xa1dde78b84cca6c3, 0x1d230bce895615cd, 0xacfce8a17b7d2c21, 0x14e3ed5059fa48a5, 0xe574ac9d51ee3abb, 0x6179e0f87f166005, 0xe7fd42e0236dc114, 0x531f410248c157c9, 0x18cd08672,
+0x4860eb56ed6787, 0xfa13676f3f4044f3, 0xb751cc3d8ef4b63f, 0xbc09a4d758669b8b, 0x231750ff57ccfb0d, 0xc688e3e0d117f17b, 0x54e7d74af2ef62f7, 0x1a7659780b626b68, 0x5c2b4aec7dbe69af, 0xe1c832c9,
+0x1b937b25a3942b98, 0x931cb7f914569d22, 0x66ad8f6a7acc4591, 0x1686ed7888d5af32, 0xece5e790c15be68f, 0x9fe64fcd71251c8e, 0x697b6b4700ffb3e7, 0x408a264d81ef97a5, 0xb980d64f34ed524b, 0x158f51f30,
+0x4bd5436bb20d2478, 0xbea399bf970af3c8, 0x5748a636b039048b, 0x305099e5bab5e8b9, 0xe9d0ebe99c089999, 0x1291b68d2a345adb, 0xa8cb2cd8e5563567, 0x8ad1d44a78955b4c, 0xae8fc5cc015db57b, 0x92f7e272,
+0x4216b7a74753f377, 0xf5a6c178cd6bc9e, 0xafbe370ac86ccdd5, 0xd85f7428584ef02, 0x16dc14dbaa4e9759, 0xe0949415e09e5711, 0x1d164691be79a89c, 0xf64a493546c4c090, 0xa37d5ef23d264fc, 0x10717781c,
+0x8b4fe78914a69836, 0xdb24d4b022c341c, 0xaa0360e24a0bd753, 0x2211f90fb19962ab, 0x4d2d2870cb01f48e, 0xa7aa51d9bbf2781d, 0xc3b84096183ffe97, 0xbdfe206a91b1ddc4, 0xab529e8f37ed1a09, 0x2418492cd,
+0xa59b0a31c4172cdb, 0x8c6941b6528abb3c, 0x4a537554c398c6d2, 0xd51e73f7d5fc126, 0xf5caf43eb51ea166, 0xaa31506340593b0c, 0xa128d234f7335e4b, 0x4c5a88b285ad692f, 0xc6128a5f45fbded3, 0x25420b2c4,
+0x53b29bb5907e45ac, 0xc82f835aa623b4a3, 0x44853b4a92f25a3a, 0xea5e1e83a6ab1734, 0x68f3e666f954d449, 0x3cc24dafb00b1996, 0x3dc627beab1e595a, 0x890ea8f6ed21a05a, 0xe192cb43e3334fad, 0x107fd9aec,
+0x600c2561ffcdc7e9, 0x95d7acd2d533c8e, 0x7de867cdb400de3d, 0xb7809a427032603f, 0x5549ceee9b829946, 0x22c6afcb5f4c8a3e, 0x3e0282101af47111, 0xa6585539b7d3472b, 0xef6eb02e45659777, 0x1007f8a1d,
+0xf51250c7dd19364c, 0x55ce7b230f6deb13, 0x24d68f8a802f43c2, 0x61a44874d6f13171, 0xe5a36a7e54c9b3f6, 0xa7dbaf518ce86d97, 0xafff607932d2a550, 0x352e39419dddc849, 0xeeed62ad797f53f4, 0x17df73834,
+0x2997087b8acff31f, 0x30b0730bf40ed99e, 0xf04ae71b1513a437, 0xb378e8648be614e, 0x4dabeb3dfd98fd56, 0x3fa30d8c51e20e3c, 0xc706ee5196a0d4fc, 0x3a7fa68ab111c906, 0x97c105b5150582cd, 0xf843797,
+0x96002c80332c9ece, 0x1ba13a1fc6e18b34, 0x8bfa4c3cb41b9e8b, 0x1b4ef546c4238d88, 0x9402d123e08e36bb, 0xbf642a45b6e0efb0, 0x70bfd84acb9f48d, 0x7749e62d024dbf61, 0xb006be74649ffd9b, 0x193de5370,
+0xa65689c2f8062907, 0x222c997bc2ba6f20, 0xdd2a663ab78147e3, 0xe96a6f1abd205672, 0xdb5a1832b8ff69f5, 0x110a8a030df56325, 0xf188e611b4b67062, 0xba96d5470181d162, 0x542d27a986013918, 0x4793912e,
+0xfbac719ff937ea40, 0x919b6327b86a5e33, 0x6fea0a68781f57e1, 0xd98c39a981d405ee, 0xc0560f9f164c63e1, 0xe85f594eb13d4ceb, 0xc88c6b0ff1c0f10a, 0xa53283728c9bb8dc, 0x22cc087d33fd2a43, 0x195b933e7,
+0x3ac63de188e5bdb, 0xef04b2bd61337246, 0xcb0b8dc70879cc3a, 0xb7d09c52e1aba817, 0xc1aeca6ecaf18c36, 0x1416b223024edc71, 0x6e6fcee042b94fc6, 0xcaf3da4276432a29, 0x3eb688f702df8439, 0x24e8e7e2b,
+0xb96ed6875f99e7bc, 0x83ff4c878e74ac24, 0x7532d455e653620, 0xdf4d45affe29f83e, 0xf2b7258cc296361d, 0xcf8327e0cdeb04f4, 0x92a69dd3769f988, 0xcc5e61f642f0fa7b, 0x40c08d2296cea0b7, 0x72d5bcfc,
+0x88e22c1f262fff7d, 0x4db3115bfd4f5859, 0xbb93e8cb742c8a70, 0x1b010a2e7b5893f0, 0xb113714365fe0483, 0xcf875acea67847c6, 0x62adacf7d834dc39, 0x6afb1364efe12d2a, 0x6415837cc39deff4, 0x279eac22c,
+0xfe638c8f6d0df919, 0xff086cce1eecd524, 0x20aa1a72db7aff11, 0xe298e1605d347dab, 0xd9b9cf3d72b74088, 0xd5d789fecc008e05, 0x7df4969819321875, 0xf47c6a86b1881a4c, 0x6395163949bc0737, 0x134e681b3,
+0x367e2755a35910b1, 0xf2342b693df60818, 0xaf3d1c6a1208d565, 0x393ab80ff2c6a503, 0x24ba57ae43d51a9f, 0x87fc1e5a47a7ac9e, 0xff19dac4fb5715c2, 0x3e66c28d579fde0d, 0xd52ea380234aa829, 0x15ea224b9,
+0xed93091bb35b42a3, 0xa753d32148fe3b54, 0xb26a7bff5c847e76, 0xa7f9980638079d4b, 0x36fd09d71fb5a2b, 0xc4659063fac893af, 0xe68a4ed3e097428f, 0x7961efe00d47289c, 0x9bfd43945c459aa, 0x11e4a32e6,
+0xd0bfe095ab6a0130, 0x24f8832137dc1430, 0xda815fbe26378a5b, 0xf51839553f42975f, 0x44ff2cdbb44b3741, 0x111c65127cc42d47, 0xe8363e958d80abfb, 0x58afcac62c336c41, 0x3126bd5d96f88079, 0x1ebd68d68,
+0x7dbeafeeb94348c7, 0x42afffdfca428df9, 0xb61cd24aafb1aabe, 0x324bd28f6295620a, 0x82950d14f2e16ba5, 0x3948c0c38171b93b, 0xeaa4e7599162c790, 0x9dcf97126fb5595b, 0x228e725b539715dc, 0x219799fe7,
+0xa1e0241dfb2ef59c, 0xbec890c9fb4e5da4, 0x8f0f27269116eb59, 0x1a1698ad84ed3a3, 0x24bba17bc9db297f, 0x624028fa3a902998, 0xdff6c9585ffb7c85, 0x78cf3e1fae54874f, 0x934630487c363ac, 0x21d37d7c0,
+0x5256bccadf82ea34, 0x41b8d45f402d5059, 0x5372754ee49aafb7, 0x4f19a3cd8e264aa8, 0x6a67688bb60ac2dd, 0xb7b13574d5ad47f1, 0x2110315ae74e3019, 0x8bced3460939f2b6, 0x1d473ff259b8b802, 0x23fc3e373,
+0x5329c6c7dcb6daf1, 0x71067c896f9c815a, 0xbf4e847f037f6d4, 0x6f5d1cf638459101, 0x1702c93bde96aa79, 0x7b36ec7d4f24204d, 0x1ab0a240dd9f73d, 0x96d72b44d2238ab8, 0xcdfabc9558bc8b39, 0x12464c3bf,
+0x3aba1cf7b5ea6efa, 0xaaf0cbeefff6d197, 0xda52dec6d7fd4256, 0xb5954dc812425a0, 0x13c4b484d6de8b10, 0x43260ae1576680fa, 0x1293527ed9bf5770, 0xb8d12e6903056d4b, 0xa1a8c6a864580d8a, 0x18c2dffc4,
+0x2f10937fc1934587, 0xc72211796f664519, 0x68dcfdeab49aecba, 0x303d6afd091d87a, 0x3da9fd43afeb8e0f, 0xa8c2b5624eda0eee, 0xed3fb9e50731f00d, 0x7efe56877467bc59, 0x12360487d283b92d, 0x2750aa06e,
+0xfd44c3149e49357e, 0x6100cb9873b7c1c6, 0xd4ae6dde4e5429dd, 0xc153b893dae5ea38, 0x4c600dc7ae87963f, 0x57c1eff1dca4f535, 0x180429053d308cbe, 0x879d2a73a1844b70, 0x5635ec6b355aff38, 0x25daf7d89,
+0xff3ee3c28e2ea24c, 0xfc5f67631c10bfc9, 0xe86ada7b8fd5f019, 0xc5933fd39b73f818, 0x23b2b2a5ea33ae7, 0x95e005e3043531b3, 0x2a0d7b0adec4ab4, 0xdd3109ae1bcf3eb8, 0x9f9e31b3d2a73975, 0x1819eab25,
+0xf237d07ceae0311d, 0x41d8f5c9f0a8c04a, 0x274c4c046c94d4e6, 0x9555b3b1d453c933, 0xd3ff55abaaabe5f8, 0x784b02f2a057e203, 0xa7973aa4808a8f3f, 0xabe2bb0af4e7e366, 0x50ab199f4067b12f, 0x7270fc27,
+0x2ffe69e8cbfd5d5f, 0xfd0a80f2ed28fd03, 0xbfcfab7beacadc1e, 0xe66807c8df279aa9, 0x471e9b237ea165ef, 0x8b254e786b13e639, 0x308ba890a779fe8a, 0xe50cf11af2fa73b8, 0x4b425f88b181bbf2, 0x1a109e81d,
+0x17ebc0d73b99b538, 0xd85aaf04e83f65c6, 0x8b73ec7e55d69be, 0x587b1ca4eb9834c7, 0x5d1962073c79bcff, 0xdaab60a8e3675e44, 0xdc4614f85988ea6e, 0x5a366598ef5a19c5, 0xc922d99f4e7539c6, 0x247c0c37c,
+0x9fa5fd5fc1e551b5, 0xe17071351e175da0, 0x3753c921eb711624, 0x7bbb76f794a44c72, 0x4edadc14d321e55e, 0xcfae6a5c2f5a10ea, 0x9222647ec215439e, 0x350d84c531c976bb, 0x5826bb2320455660, 0x3c12d3b0,
+0xa61604df597427a1, 0x8b347d3f7d3d70f4, 0xd5d8d7b581ec8d8b, 0xea028d9fc9190a57, 0x475d0340c79d6f89, 0xfc0320b12ad47f9c, 0xae0b5a383b295f4e, 0xbcd8bf3e306fc1e, 0x94454306091e2f0a, 0x5a1745b0,
+0xca50431bfc68f539, 0xfb0035539ed57298, 0x8120ab8aa7b4e275, 0xe00ed788a679449d, 0xb8a86433f1c46c09, 0x429e1b108dac79cb, 0xbba6f3b287995453, 0xc327815e20dda21a, 0x1616926f94bb8cb5, 0x1ef4c270e,
+0xbe46e6454df1021e, 0x9791d3cba9c8d505, 0x627fa22c8cd4415e, 0x2da89e70b7787263, 0x5afe8bce39401fef, 0x3f7bd85580d2505e, 0xbdf6bbf2979645eb, 0x3882e6802e4db74d, 0x90e51ec9add6256f, 0x273f4caa,
+0x78b32f8435a30eb8, 0x58352cc79ea8893f, 0xc30453c29cd47f2f, 0x56d00534d6218cac, 0x37fb7c854c60b374, 0x7a0ba2bc72d94985, 0xa0dbd6bce090f231, 0x6b9c473a6ceef43a, 0x17ccf6e4eff6bc90, 0x350ef100,
+0xb8a8ad7da5711596, 0x9017c1ab5bd8e297, 0xb5d35a6ef9f4af62, 0xfcc99c06289bb3d, 0x9a1abc36055a71a1, 0x1564fede32febe89, 0x79a8409b8b07b6d9, 0xafcd6660b70eca70, 0x7f3386a58cf6ef0, 0x2a9332e2,
+0x43c68ec706332b76, 0xde9d3440fa74a48e, 0xbfa9978804e53058, 0x9c0a9cfba9daa3d4, 0x60aadd6cab3cde2d, 0x81dd6dac97ab23ba, 0x2210764a8ef5031a, 0xc4d7503689ecb3d8, 0x32016f7ed6779218, 0x217ae8e20,
+0xe36735ec9ffd4cdf, 0xa6318340c137f7c, 0x32ddd0a7fefa0efa, 0x8fff02c03f11dae9, 0x1fa6eec013ab7db7, 0xa42f002cdddd5f91, 0x8b105763550593aa, 0xf2ef0471cb2aa23b, 0x1cdcb832f3ca1b8e, 0x12bde63b3,
+0x8b7dee7126130871, 0x8b88482eae8ee926, 0x53f04590c5425fff, 0xf8936177235d649f, 0xc08b5eccac0cdf6c, 0xda6bdc80d146a478, 0x6d1ab540258119bc, 0x61ec389e33586561, 0xbb8ac998c8196ee5, 0x1357c16f2,
+0xe185126503479dd5, 0x865faf7770a3c3ac, 0x44335900b29935e3, 0xdfac7b703c87e00e, 0x89379969255cca3c, 0x7bb78ce7721ec6ae, 0x5057fd4bb534d581, 0x52673729ffa9e8fb, 0x2ce3c05ef9b67cda, 0x23e06d9ef,
+0x9c8148fa67a2f6ee, 0xd08c2fc7af76c666, 0x7f4b8da8c2620ebb, 0xd2f46399e223f08f, 0x697c4ae1b07a1326, 0x444b229fee7a9172, 0x428160beba4c5eb7, 0x1f3e726e594945cb, 0xf47ea30283612e86, 0x11a3ab956,
+0x8b87893e7eb80631, 0xfad240eb4b832a8, 0xc6a2987cf8784362, 0x89ae38f457dda8dd, 0xc963947523e73e8f, 0x88a9a3d614290f39, 0xd44b310ebd97c6e9, 0x370e11ee44012ab1, 0x3ec6006ba384ae4c, 0x1831d4822,
+0xf887de24b9360544, 0x19095b69093f9e6c, 0x42f6f38b53f9845b, 0x3d2946bcee6cc04c, 0x1661ec972e3a8167, 0xef067252621bf70c, 0xd17dafc657cb5783, 0xeb656d53f6721546, 0x4e9d7ce82b86827c, 0x2588dcf02,
+0x29fadf174c944585, 0x66c5a64d201341dc, 0x7ddde25a606a4f43, 0x75d76737d7153b9, 0x136f3b5329b9311c, 0x6642fc280013c610, 0xf104006cc8a62998, 0x315671a9df05a0cd, 0x13e2acd3d37d958a, 0xce8f5843,
+0x4460ae2846eb7f5b, 0xcc83f525ca107555, 0x75b4be86586db68a, 0x7ef736d70e3e7b80, 0x82e1ae8c0e4c57b4, 0x589b1c9da28168cd, 0x96eb49bad7e11761, 0x1e13e9d47b6ad6ef, 0xf7546374d5b312d6, 0x23994b83f,
+0xc1fdd887fa18fbff, 0xc19f3710a2ed6c25, 0xd88d6490c322bf4c, 0x11f3dafbd6fb3246, 0x149a7506b1bf2ece, 0x1c56000de04b4a80, 0x84d802ca6be3d8db, 0xf006c071dd93b747, 0x46fb9c3945bc04a0, 0x3c0e3b2,
+0xdabe4799ef362431, 0x9eb1cfda6423756, 0xed39e975b8d327d8, 0xbc31d4feb67aba6b, 0xa67426224d44f153, 0xe28e2e35e7bc1ce0, 0x651ff748c685507d, 0x6758b371e9549167, 0x11c2a1ecbf89b7e8, 0x27b3f2351,
+0xaa8009fb30274189, 0x6cb4a6ddf28f5ef6, 0x8e1da02e852d726, 0x8cd0cb453c33fb3b, 0xddfb1903d5f3684b, 0xa35ceed228faf0a8, 0xc18b4f0011a46960, 0xf121ec92b88f70ab, 0xb8ceb7cf1d3859f0, 0x19cd6f3e,
+0xbce2acfada35f589, 0x4d2922764c20f26d, 0x7a7940680282b453, 0x18a8df0fb1092e2f, 0xebfdd96e8d9575dd, 0xef498a31f2f189d5, 0xe63656949d70c805, 0x646aea971ec03a9, 0x67cfb5c4d9f2f1f9, 0x1b6379778,
+0x1d0664d65d22f8af, 0xbf0c394fc78e37df, 0xb6b5ca462824b66, 0x9cfe048c3c733801, 0xaf48a310b23dea77, 0xf9d43ca01d90329f, 0x73acc8fb70a81992, 0xc46e5b23f3f96a3c, 0xfe2f96581cca9138, 0x1df796395,
+0xe845b073019ef3a9, 0xdee0026f6fba426a, 0xf08cb6d126d657f9, 0xbc247b488b39bf8d, 0x10691034b79bce8d, 0xd288ee43a31c370f, 0xc140cc00e4c71249, 0xc990202bee428f52, 0x6231031839fe9fe2, 0x1579ebba8,
+0xa8d8e0f3e097f444, 0x52cfc561ad0cc649, 0x25f90f7dd92d6358, 0x38d540e1850a9cb4, 0xf15031d08919900c, 0x7f65843f23f5ce13, 0xd4e1f39712612e06, 0xb636310e2231c4a8, 0xe3784f837c0d8524, 0x1469ed469,
+0xab39ba4aabe82c69, 0xab712ba3a33b0bc5, 0x8909daa0f66ea5cc, 0xc362a9b12eedf92, 0x486052eb44777de0, 0x917b7a58cdc65c94, 0x367345ae23af9538, 0xeea07aaa500bd330, 0x5a8c5f155c1b073a, 0x1715b596b,
+0xa0d0dbf724348434, 0xb7f8dac20efd2044, 0xdcf7f21c5f9aa933, 0x6200f04c5647f662, 0x7e8484ba3d0d2255, 0x955dbcd50f7b706f, 0x5fe949cc3795b32b, 0x95c62f33eceff223, 0x79bf13539302cd88, 0x1583793ec,
+0x42b99298acef15dc, 0xda4ead682cae4916, 0x8860c9b7cb4d7f17, 0x56160f716c681455, 0x9afc7eea6097988b, 0x3cea64b6758987f1, 0x2904c4bbceb36a3f, 0x39743bd41bc96e84, 0xb662bb08c1f241b8, 0xb574a255,
+0xb229a43451500ada, 0x8b255404085be434, 0x5ef58c4fec8861c4, 0x3c6a30b1ae3a567c, 0x8b01a1bde4f26166, 0x6df53cc674b4e8c, 0x2937420588e1b1c8, 0x86843197ed0f9d11, 0x9da7df566a0a3ac6, 0xc29e9ee7,
+0xef6bf68327a568e8, 0xf45eadbdc5dbcec9, 0x2e2e603385fdf9f, 0x89b9c7319ab6052f, 0xf78e7cba059f9ed, 0x761d0d5ebb7e2170, 0x82ad4de9587e398a, 0x6c095522f3f26fc7, 0x625888b6a9e2e0bd, 0x1871cb5c,
+0x72725f8c3791343e, 0x7d9846c6a9ffd5bc, 0x53b7f6e47aca7dfd, 0x32b8d988776dc8d9, 0x1c3dc3e6755b8d76, 0x361a8a7367e3e723, 0xddc7db8919d071fe, 0x5b8e90d7fefab31d, 0x68488a0dd23b0c0e, 0x26fad5b54,
+0xabdbfddff21cf97f, 0x606bcc1577fb60d5, 0x219a6bd3cbd7f8e8, 0x7dce64366a489296, 0xdd36f107ecb8f49b, 0x718b28404733aca3, 0xcea2cb30f4dbbae3, 0x62b14b72ecde1d17, 0xa32c27f86e2473cb, 0x206916a81,
+0xb6211aa462f6feb5, 0xd43e0fc29293d4a8, 0x60258734bc780cc9, 0x89aafd8720b2e8c5, 0xf09b2306cbd20a09, 0x932c5707bb9cfb7e, 0x87ae2ef3b9443f17, 0x1cd1d6f651f510, 0xbdc66a433b6661a6, 0x19aaa550b,
+0xae80b7e34bad2daf, 0xf147ce6b60a60193, 0x56f874981a0150be, 0x58202dfae56d0981, 0x66bbf56406fbde73, 0x58e5dc46da22c328, 0x419752b7a337ad91, 0x85a81de6c195f8f8, 0x32c732574edc6c3, 0x273a0f448,
+0xf076311b08f7d5d5, 0x910bef3dad88c43, 0xafd0f8e27a2f5ea6, 0xe7f67daa5dd45858, 0x8babfe66cd1fc8dc, 0xabeb12b7147690dc, 0x65b21649f1ab1276, 0x76f30dca1105cee0, 0x30a015b6ff7a686a, 0x12e8c6f44,
+0xfaabeff7196daff6, 0x7f18745e2854a8a5, 0x321190f5bfef125c, 0xeb1fd0fc143be75e, 0x88007b4442587360, 0xaf55ec6850c78884, 0x766bb6b054cc4e9a, 0x102eecd4fd76fe3, 0x13b6aa7d64a8db8a, 0x11052186f,
+0xebe904e6ee5649cb, 0x229aa1ec243bd2ba, 0x399f2be10894d76e, 0xa4ba87d8adf5c507, 0x5c594a270e74a4a2, 0x6ddb94497328485e, 0x635f5d4c4c9d776a, 0xbaac5c22985d3fcc, 0xf26861dcbe282896, 0x26ab9c237,
+0xec3918ceca156cc5, 0x1fdcebcc57edf2a2, 0x7cb3f35f4ce78854, 0xf493d94e956be421, 0xec61184187fc45fb, 0xe2bd1a1d75677f2f, 0x290a8643f5b329d8, 0x1aa8f71be446705d, 0xee78ed9a009fc6e0, 0x397373fe,
+0x9c8227de27b2ecda, 0xfe16bc19600b3b66, 0xa74d136a6156917a, 0x2e59b3a5995c9bf7, 0x78a1a467707a6c50, 0x78b09cde808d1976, 0xdfff3a63c075b0cc, 0x3a35117129e97b6d, 0x4fd6789e495b330a, 0x492d5a3d,
+0x5edaee223bb20e9a, 0xc98e75f4aba9bf77, 0x909e7f6f91036cf8, 0x359785febfc010dd, 0x48f41c0bb83982a8, 0x516e60be7d43b798, 0x9336e3ccda697082, 0x931dd8a55d6d9921, 0xc060ea62f5104a68, 0x2646a0a6f,
+0xeefa1e66404a0be3, 0x4374c345ffda8c8b, 0x62fa3b244de1ece1, 0x9a01f5604153e2c6, 0xf5b9ed911ff8d7d0, 0xf965d66aa58c0ed8, 0x2a61c611baa5cfed, 0x6dba67e08f7e4104, 0xe4756f3c83e7b06b, 0x4af79c6,
+0xa9ef563b9eaa4954, 0x26f31294dfead430, 0x7beb225208df4d71, 0xd1ca1cac39393b8f, 0x3e8fe7dd00e06a60, 0x3faeb637369a6b5d, 0x4f8e3c9f4b1945c9, 0x80b12c82d10fd6c0, 0xfa06f2e6792ed574, 0x208c59a6d,
+0xc840316ddf2f1aa5, 0xe8c7688a5e064538, 0x49fa91233cb949f4, 0x892c8544a917226e, 0xd7ae5521d7c71eba, 0xeb90f6e398f3ec50, 0xa1b9dd237c05b968, 0xd45415d2d28081ef, 0xd7130bec1b89d72e, 0x1a59a3b1a,
+0xff5381177339aeb1, 0xd94a1df8d79d9e, 0x78f00085f995e492, 0xa2fa05d933d23bea, 0x3fe46f29b04452ec, 0xcb138e646db79f9d, 0x3a8e56ecc12b4ced, 0xd3ab10937d3c4f7d, 0x8a875b8cc479922d, 0x20b04bd5b,
+0x5c8fb09e05225c85, 0x1945cdfaacab0db7, 0x6755b2d160654a94, 0xa4ceb18966e26a5, 0xf65a56fe9eea19d0, 0x38a1a5438f71cf82, 0x7b0cf3ea8e315d78, 0xe1c26478dcc0cbb8, 0xeb00ac677319a305, 0x146312fa2,
+0x88454a0cf7a7e353, 0x8d706c554229f472, 0x76e50f981fa1e6cc, 0x456cbb719777f3f2, 0xc1e65cef0783179c, 0x4534d16f01ef2468, 0xa3f764fcebfbd8a7, 0xc37a0eda55d3cefc, 0x89f8fc33d43cb16f, 0x126dc0b95,
+0x6fe851df8eb17e6a, 0x13b4e1b9eb7f858b, 0x1f9376ec6284d7a0, 0x5c6583261b794d07, 0xa0790170f6bed14, 0xafa1acf049b38ff3, 0xa06b3c9e55509718, 0xde6bc7ed72b0af3b, 0x5315e03b00e95b27, 0x100ee57e7,
+0x3bdec94815f26f23, 0x299b0f70e5406ee4, 0xb5a2f100567e49a1, 0xb3f5a06aef2dad, 0x77ef63fd801a046d, 0xdf5542e72038bfd0, 0xecd943fd579eb11d, 0xf0174b9fee12f6c5, 0x7df17de1e43f26bf, 0x16ae7f90b,
+0xdbffcd14a07e0f72, 0xa4931dfc6f6077cb, 0x8bc2c5763cf18a95, 0x87547ce25d54ede3, 0x44301ccecce685ea, 0x169cf8491ce56bc1, 0x91ae0d3be08feb7f, 0x712638b30fb971, 0x9544315efe7db8bd, 0x95f8b5eb,
+0xfdf37224e3dc0356, 0xdd3bf854c79e9cd, 0xc0095830462451cb, 0xc530ce2a272c9221, 0x7784f6c63bffde65, 0xebbc509ad62f557c, 0x2f3a4099e4e4e1f7, 0xd3dc9fe2e97ce7ed, 0x86b7abbfdb0d6243, 0x1641baa52,
+0x2e55016340d561e, 0xef5082f03479c40, 0x6b4d6b7ed62eee00, 0xcb835fe2a109249f, 0xc53de9a298456088, 0x2e98d2a97f21d83b, 0xc41785fce6fd434e, 0xba92e255ce187065, 0xa6016e9c1f613a56, 0x19f23c0d,
+0xa026f32ba4ce8443, 0x7d174bc47501f640, 0x1f97a7f02489988b, 0x793bb1e6dff65b02, 0x307c4b7a0531a946, 0x790653f24a87297e, 0x533f12d3ad445a35, 0x9c684d64649416b4, 0x87e6a989d1854045, 0x1a7689bd8,
+0x1fa1356c08f18c0e, 0x422000352a9960f, 0x48ca5498613f9beb, 0x397f07335b63c000, 0x5c6b973f979e2b3f, 0x5c94474bf289eb0, 0x58b6bf563c664c8b, 0x4af9bec69a6a876, 0x895d180a89a0a4e6, 0x1bc48e191,
+0xd5df8d248dfc0ad, 0x1c19cd783a5432e7, 0x7547cd92b538cff3, 0xb61d813dd74aa0ce, 0x28d1510244bb2eac, 0xdb065703e5072fcb, 0xb3f98c03677c816e, 0x8ebfb5f0bedcbd87, 0x8f740db1ce10a7da, 0x1767e2d75,
+0xf109fa8bd1faf6c7, 0xb5122e99f751a36d, 0x50cb64709a59c710, 0x9853e24772980799, 0x31a509b2e2849f21, 0x7408ed7998125284, 0x6e73b08d1af32d33, 0xc3e214adc4b01b8d, 0x542b5183a183775e, 0xdf710240,
+0x7780cd909a542cf5, 0xb500f0f0012ac04b, 0x96d0b40652db1ec3, 0xe72c4550678d598e, 0x91140617dc79d921, 0x70a6cd63e0f671bb, 0x2e3819529c69ccbd, 0x7ea4b526cf6690a5, 0xa599dc16000b6dbf, 0x1597a4da9,
+0x5d0f09438ccae9ba, 0xf5c4ecb89b30e5ee, 0xeeb0e9b9dd977b3a, 0x593b6383cc692b78, 0x50e4bd6b79254c2a, 0x60b32adde99cc26a, 0x8affa5bfdbc8567e, 0xa038f230f549b02a, 0x93eb85eeed1fac1d, 0x11e8f323,
+0x45db61ee64737941, 0x1b36e28fe2d96db4, 0xe6dd7d046283f3c1, 0xdcfe805bae04f43d, 0x610c93d1603b88dd, 0x76c7199cc78613d4, 0x61f6edffdd415fe7, 0x26beb2ca5cc38f21, 0x1beb4812b818279a, 0x240a472ed,
+0x4cdfdbcad7e22378, 0xfb1207a0f3f7a465, 0xf3d128a4e23e5a9e, 0x5778f51cb56daeea, 0x8feb3a36aeb3d17a, 0x632cb6fc829d9154, 0x92118db39d4810a7, 0x5c6537240d05aad5, 0x1f2a68195280b774, 0xccaeba11,
+0xedc96dda07aeb877, 0xebe4326e1fb6b9fd, 0x7ca4c4f70a7ab79e, 0x5556e8fcd2ac212b, 0x69dd4b0426a4649d, 0x9ff6f6c9b13793a2, 0x2eda870581024ff7, 0x2844cb0ac6207356, 0xb549dc9276f667e4, 0x178357e,
+0xeb5fef9ae0662cdf, 0x81f28f8e8d6378c7, 0xd969727d5337ffd6, 0xda1efb476fac9d01, 0xfaa082dcc1a7309f, 0x8b6571beda89df61, 0x43a68d8d84bb516a, 0x9e8eaea4695c5661, 0xadb7c46b835fc947, 0x12f5f606b,
+0x2999da6b917f2560, 0x25079eb117569ff4, 0xc0ddbd1822d31020, 0xfa1082f6b2600dc4, 0x7a18a7a52f0fb192, 0x24c46adf2d64096d, 0x1d9e79a751407620, 0x19f00512dab001b, 0x51759001885d2aae, 0x1706fa05,
+0x715e12553e2b6bab, 0x7699d95b791856d8, 0x13821a3fe0242d16, 0x491489674feb7bd2, 0x206807ce633d33fd, 0x211868929bf8277b, 0xb11f783adf9559d5, 0xc559d048a7b4fa72, 0xe8ad7d2d4edecdb2, 0x24474899,
+0xcc71411b2cf8eb56, 0x7c943f369db99ddb, 0x819822f9db0387de, 0x8c91a4778c58a5ef, 0xf287cb72fc2f9202, 0xe1bd57f57ad6aa25, 0xbed2ca6d251d730a, 0xc420f5d381d1fe81, 0x5b2f4ba4f1613bc7, 0x5b763399,
+0x792e9b5cdef23401, 0x728af3ee680c5e9, 0x8f4ce2821c9e55b8, 0xd78fe5ea24cb20cd, 0x14d9b43f88ba5cf3, 0x994db2c88cf1cc5, 0x45579fd8e480ef3b, 0xf387ed3005b9155e, 0xfd8a69cac68cd3a6, 0x2310f2763,
+0xdee170038c1f6d8, 0xcd6f5a59e537e5b, 0xa4dd5fa3eadfd3bf, 0xef6155599b73c3a4, 0x645f89037b6ad21e, 0xa494d34631812234, 0xd8facce5a821ed7d, 0xd66dd66f6c2f25b5, 0x89803ab358a8d52a, 0x10e3e6a40,
+0x47768417e2474449, 0x286afeceaee2f752, 0xdac0c0d48c5bae2a, 0xee17bd433914949f, 0x1557a7a7ab96bcd5, 0x396269acde2920b7, 0x70459388fc4f378d, 0x26ec8285a0ea8850, 0x83341828e6b5e906, 0x1ac52f507,
+0xfeb1d08246129778, 0x152e3ee602342429, 0x8b8bd8c3223d114b, 0x5bcabbb4d1027c8f, 0x63630d5ea18bcc97, 0x629640d6387602eb, 0x65933c97fa52ecb2, 0x8518c096738dc8be, 0x15ef35b5bca84e5, 0x42ed3d93,
+0x9d0f8121401cc2b8, 0x2a9cfb65ad641d9a, 0xd00006a80e4e6e53, 0xd40d8277173154c5, 0x6fb8b461e21f9490, 0x7c82922dbf57e7ba, 0x11aeb52927768359, 0x4bd1ce57dac2150a, 0x37610dfc6279217e, 0x1263103f,
+0x9e9ce26b9bc170b0, 0x431aaeba9349f2f0, 0x6c455a0df1666ec3, 0x3bcb8239b4890955, 0x6751d08f1cfd566e, 0x71892bcd2ddc1c26, 0x84811ae58ce1abb1, 0xa43d1118214fda64, 0x716c8b373aa8cb75, 0x9f354398,
+0x7aecc882ecf0e5d0, 0xd1cec6621f240688, 0xf455848d4e13ea26, 0xb56a52479998e2ad, 0xf5aa7d005678d89c, 0x17c85d3d0eb0f9c4, 0xe2232690698ba9c3, 0x61266200f8a4dfed, 0xaf0e337c28a60617, 0x77a99767,
+0xd85fc7932900b6d, 0xe1edd21f2abc0214, 0xaca3a473973e257f, 0xbddeef54c4e30ece, 0xbd619e93b866ad5d, 0x6f9282a187a1df9e, 0x50fc3c1b66a71a28, 0x4ec9b1aa0c03be03, 0x7383398cfde08e3f, 0x1c971189e,
+0xf7b04efb9937c026, 0xd1128e5f3fed0af7, 0x5e0ce2ba26f871f0, 0xd139e37a7ce785f5, 0xc9bea6599774c2ca, 0x78291f7034d70bca, 0x846b04b690e34540, 0xde99a2fa0a747486, 0x6f93e503c7678285, 0xb30642c7,
+0x4faf6528c193d152, 0xaf6c5fc6566a5080, 0xf98736ed970440bc, 0x8fb4f795597c7441, 0x4233e099087217ed, 0x534b7c4dc1997e51, 0x8f022ca0a1e64ec5, 0x7750b852e42e8417, 0xa6fe586218c92091, 0x1840c0732,
+0x7ebcad41fab058c3, 0x93325bdd5a29115d, 0xa3b25f1b2bed91de, 0x90b3f54b69495a11, 0x4ae83dfaef156fa1, 0x7984befc664205c0, 0x2d25e4031e680ec2, 0xaa9620f3596ce93, 0x2cbffc22d1881630, 0x2200bdf2c,
+0x629e07cdad69edc9, 0xcba665dd377a138f, 0xc8453f39da768cc4, 0x859fee33b9d75f88, 0x35019771574a10b0, 0x7df81ab6f1da32c6, 0x7c94cef04525ecb7, 0x34e222ad4feb0055, 0xd0c52e56d6bc1b42, 0x1f424fd29,
+0xa95370260c390020, 0xa6fd29d04cec6d87, 0x240aed21f0ebf971, 0xbf311b1f10ad195, 0x42f356b9ed6dac1e, 0x854357f82061b602, 0x10c4a12547f9d236, 0x98513d90c64347ce, 0x3d66a5c94e6940d7, 0x2709070a8,
+0x8bf98960823758ee, 0xa4734e06c3302367, 0xb418a1180aefa0db, 0x60b93945faa6e7c6, 0x8b969aa934def48, 0xe28fd066d277d2d8, 0xacd6173e430a5172, 0x79fddd26e4c7b2c4, 0xed68d96324a9ed01, 0x2f7fbe7,
+0x616912e335c88cfa, 0xdfe27d3d6cf985a1, 0x16cfd647412c096c, 0x55a98dd9de0acf3c, 0x42e00c5b2a9dc844, 0x78e335e419d96689, 0xfeedb2c4cd682079, 0x7e1e5ecb1bee79e0, 0x7d35e5fc993438fc, 0x2650ed0a4,
+0xfe3f081934ee36e3, 0xcf7ff391e335565f, 0xf7644b5a9f23f3f6, 0x250b8ffdbb22fd03, 0x6d02b1ebf9aad401, 0xb2345d99252c5b56, 0x6b13540c09213657, 0x47960e7519ad2a5b, 0x5a2b4f45cd7c7374, 0x117da455c,
+0x46f7603c42918039, 0xe747edc2c098f243, 0xa77e9f654cff81e5, 0x68ca0c3461a68a8, 0x8b6995f7c7691125, 0x17134dd796e8c245, 0xf7c4dd0ddd92dd8e, 0xeed548104cfa66dd, 0xf00d49c6cdf39f26, 0x24ff12e4c,
+0x856e443246167143, 0xad2640ff7e5a5fe3, 0x749630a4bd086d02, 0x8daa9912e9fc829e, 0x96be96db6ea32d75, 0xf7951c6cdf69fae0, 0x8cce037befcc89c7, 0x93f5101bd7debdf1, 0x9ddce2c08f21b33e, 0x26c30c11,
+0xe2786b38ccb03349, 0x811e2ae54f12a5b8, 0x7282e8d432d63b70, 0xa8ef75eaa296f5db, 0x92c78ec121d30ed6, 0xc5e4a4347e43fe3a, 0xeab1e78d41193606, 0x8b6a8acb69530318, 0x2f60c711e8685e98, 0x1ec76950b,
+0x932a03eecf632b8e, 0x48a0698c17b3da61, 0xdfaaa4ae8d851411, 0x6cf201ac72a5ae20, 0xf467ed41d97e1626, 0x72694601e1548648, 0x877c8b4de0c816fb, 0x7b4268aaedf6cd14, 0x23933d1a51ef0299, 0x25beb5178,
+0x9b603e9407fbc98, 0xa8f25c14035d4a16, 0x48d1f546ed03006f, 0x55e082d87632104b, 0xe6bbbbc8ef5b20ff, 0x559443c566599ce6, 0xd880602d788364d6, 0xcafb1fed0519507e, 0x7271325ab1c48304, 0x139354dd8,
+0xb422ee4b4ca2172b, 0xff4bbd5c3c469505, 0x3b5be668b3513a66, 0x2fbc1a96dced964e, 0x2fa69ab457c68377, 0x51464e93df50bd73, 0xdf0a5407b147f7be, 0xc8fda1bab93d0794, 0xb30f2941402e05a0, 0x2182b6130,
+0x8b4a5c0a4f6374ce, 0xb1e135f15dcc5ad4, 0xe440c20826f92e71, 0x2e6cd259adf48a66, 0x966b70fdb2ebfe68, 0xf1a2d759819e0e66, 0x2d3baa10efd0ef79, 0x356c2f3066fd0b06, 0xb1b0c6763933d5d2, 0x16fbbe87,
+0x3208fea0a4a92f1d, 0x6a7f8b0a308875c0, 0xf97551c7683a339a, 0x46d97e92c0c24d59, 0x872e14465ce8c81c, 0xc61ffc80d4f78683, 0xea47266f0857050, 0x91f5fbb944f37907, 0x62049af407dc13e3, 0x18b4631c6,
+0x805551f5837d03b, 0x9f43c17d4ccc28d1, 0x555cd8f9955c48ee, 0xf9922f02c604f2e5, 0xebc10a641855d633, 0xb4740c326fc88ced, 0xcb07143cc16b8069, 0x23fb4b51c5d95b5d, 0x2c3c467caf8b5bdc, 0x254dc1d7c,
+0x996757a73da1d082, 0xc73e8b4adb53cb62, 0xdff43caaeecd1302, 0x7b15e2906722e359, 0x3e541de488d6c8a4, 0x6307ec6498067165, 0x1ecf258e6a3e18c9, 0xd88fe762a37fa89d, 0xed81cdcb027646b0, 0x1d2e4c6ed,
+0x86770c48e4fe8151, 0xf4ea9f9134bc228d, 0x57af21129321d30e, 0x233f919d8f0fa1a9, 0xfa601c6b0d5fdf3b, 0x752a884afb612a12, 0xbf3ff6b2a9487db4, 0x1a571770823151f6, 0xb56ac7eea33d2964, 0x4953358b,
+0x96b890ce8f2824f, 0x9e639a2d9811586a, 0xec96c739b0a3d486, 0xc70d0a632f8e56c, 0x56387406a5349b31, 0x2abdcde600c92360, 0xc64175dbb7ebbbc8, 0xd53882d2e47f47a8, 0xcf0b0dcd32385fc, 0x1a6b9c7dd,
+0x7463f1fcaa9e73bb, 0x32dd9089adf25068, 0xf688032715d8f4ca, 0x163553f391143aad, 0x9156b7adf75ec8c8, 0x397b582188b30543, 0xf4ebe4fd1f2e443b, 0x5c7aada50b230f26, 0x677164b226fedb80, 0x21acc0354,
+0xefdf1c68b1cf0308, 0x9d500c104a341974, 0x2d18df2f8761b3fc, 0xcf7e2566d8b3734f, 0x17b781326d864e19, 0x650f1fe429a49644, 0xeebebde287ae977, 0x36bf26f93c4ac47b, 0xa9c66452477cfaea, 0x83ffac52,
+0x17be73d7cbbd9e04, 0xb24456d8498edc96, 0xda8970d8edd97ed7, 0x1053afb20f77b0de, 0xbebffe06d7fda274, 0x9f9fd5ff62b66570, 0x8c0c35a6ccb1670f, 0x68380374491e60dd, 0xf3e0817d69276a55, 0x111ba5b0c,
+0x3cb99b6fac4089d4, 0xf0f7ba81e4084f13, 0x9c5f4d55a4d79776, 0xd713d979bcc5b49, 0x19ec4bb9ea805a03, 0x86b9c621a3411991, 0xade3a6d760497b70, 0x3dd5007c675e4a64, 0xb07640bb7a3b0479, 0x1b672f3ad,
+0x6fea3ba996f2cb82, 0x37e5667d2c3ec87f, 0x15c34b777990b30f, 0xb7bb38dfc941e79a, 0x6678e28cfe0d09ff, 0xea1730401937a6f6, 0xde724348f09fd2ca, 0x3ace0a3740c8b2b5, 0x9d20add1875bcbb0, 0xa89d45bd,
+0xf44dd639890f088f, 0x24fc6e8179956b4c, 0xcc838987bc40fd2d, 0xf0703595fbf2cf8c, 0x5b33e45594bab370, 0x47bd7326cef4a57e, 0x7eb711eda4e44df9, 0x85ba9b979169d6d4, 0x15fc00b9351386af, 0xc0e9c0c4,
+0xe848aefae71fcee8, 0x4cb82cdaba2bb311, 0x4ee6f8f27b6ee973, 0x57d3f462894ba36f, 0x8bc6dc43e31de4e5, 0xbf64084e42eeaa95, 0xa8855c05ec4ccdad, 0x3697bc4ef8e5b75e, 0x51f77239dd72155a, 0x356e6d23,
+0x3b252bd3b17415e7, 0x18158048a7dddb74, 0x1b85d6ec6a8ae974, 0xf16c955e34d3cef9, 0xe6440aadb87939fd, 0x9bbe95e79f2b7417, 0x161c09683c59b3a7, 0x9226ab1ce2cf9693, 0x771afa95cb269b8, 0x29b42615,
+0x481ff49d41a434cd, 0xc2c56b6cbb1f043c, 0xa2f1b7ffe4f36c2a, 0x54ef722ab4cdfe5c, 0xf08792224f41b208, 0xb2aaa25fb49fc28f, 0x71f245699a28d14, 0xd6dc61ceb7873328, 0x8ccb98e94b889a62, 0x1c90a596a,
+0x67a903400bdff235, 0x1fbc62423e0e9fc0, 0x1c31b470adec5f5d, 0x6df9515d1271bd8c, 0x96c7259d7d9cb91a, 0xcde9622f40618784, 0x8e285f18163b0bfd, 0xe70a226b965d3960, 0x9c4a1ae8802ea12e, 0x19ea549f5,
+0xd4388e7d7e7e0150, 0x918685dcb2ccb470, 0xadaf3946de3ab538, 0xacffc5398781d01, 0x7e166e10b3b26ea4, 0x3f9a77bd15deae57, 0xc988fd340556c9a5, 0xc1cb5df1ebde584e, 0x37e28d81ffe8218, 0x1363cd323,
+0xa768b2f8ed8edda6, 0x84e292174f4f6d6c, 0xe266678ff1afd4ad, 0xd2a33128646d28e9, 0xca83608113efc522, 0x94cb044c01921367, 0xa69723bd750e8001, 0xbd68323d76ae81af, 0x99bc735ffc75214b, 0x25a084ac6,
+0xa35064d9fe944bc8, 0x5bf80769c770db76, 0x246617c85a5b242, 0x85ca337da51718db, 0x73b120975200ac6d, 0xefb537b3fcf66d0f, 0x51e3ec8ccee08cc, 0x215b355d3d213155, 0xa0c7e4152e7b3684, 0x1caacb438,
+0xc0194c5892eedb09, 0x94bf5bb4d5944712, 0xadda95ba12948596, 0xf5b69b776e02295e, 0x9081c1c0af3f40b7, 0xc066806be301b546, 0xdfc2e2abea67850c, 0x1580df7d0601cac8, 0x595a899376ef3467, 0x15f4b8101,
+0x6657acb159dc4336, 0xb635e277c5774e5b, 0x9b22957e63915584, 0x4ad059229349b122, 0x16d4d0790b435b5d, 0xb8b27b648d2c0d9c, 0x7c00c79d524343d5, 0x8b05dbe070eae46a, 0x220537d485c42ba7, 0xdd939157,
+0xead784dfefd94ce, 0x1ba3f79b854ca45b, 0x3e3a4aa2e1169464, 0xfdf594645ddd46d0, 0xcb4529d51ac85ed1, 0x1fdd9c852355b900, 0x2d9cee2f0672cb89, 0xe5bdf9c1376802b9, 0x335baa6422a0ca1, 0x70e65014,
+0x5be351a110e843aa, 0x69772de5b8e4ebca, 0x9405e961bb9b5a07, 0x743d2f02b2094e70, 0xcb73c964882ea8f7, 0x3175e907a5202a51, 0x1aa08d98f68a79b4, 0x661b76473e19b6a0, 0x304bcadd200de794, 0x1c2b55984,
+0xc387485e858fb3e1, 0x622aa7c6afebbaa9, 0xef74dcd537ef6ed8, 0xe8d918c301716ae0, 0x7a474748bc32e833, 0x6f97d515957b366a, 0x5b67586b33a21f82, 0xf6792fb29c9b0d38, 0x6a93659313cbce33, 0x15edeb260,
+0x36bf478b62c85821, 0x266995778ed67d5e, 0xc960b6807001276b, 0xef8f31dc5179daa6, 0x94f7a7463f884623, 0x339ae7a5c057b8f5, 0x70239b8687b6d9e9, 0xfeea463949fca8f2, 0x658df347b0e153de, 0x75802712,
+0xfc04804fe5105ccd, 0x46071d5612400f8f, 0x85452148ee0f0d, 0xf75ccf86c8501604, 0x56745311806d9078, 0xf1a534eba5b10526, 0x221f2701b850184e, 0x613c557e8f2a8126, 0x485f7d4db18551a0, 0x3972e3a2,
+0xfa98af79bdf300d7, 0x2d1491733bed4bc6, 0xddc9308f94b5b3f2, 0x4c726c63842e86a0, 0x35fd58ee2dcf1c07, 0x26ffe2ece3c64b64, 0x24535ac5ac87809d, 0x4964469fe1e393d, 0x3bef984f6c80b728, 0x1b6551bbe,
+0xfbf059454dc382fb, 0x80c969b70f02a657, 0xcc74c0040d1322c7, 0xc7e7b435eaf6aa97, 0x3a35082765ac7125, 0x3536889435306d67, 0x3f8257bb5e2fd09c, 0xe790263a614bd688, 0x612b9b573d47b1b1, 0x213eb3333,
+0xb984296ef2490651, 0x471f27e57a3544ea, 0x406b0198cd47eedd, 0x124b64a213cf1b78, 0x1a731bc5360e7741, 0xb510d5a86e3269e2, 0x8ca98d70c6b1fdfa, 0xaaee55ec6a475195, 0x207037f4e3f7b2a7, 0x7d899447,
+0x54217dfec7372498, 0x91abe69d7c548a3e, 0x193dd07c975f3044, 0xf0c843ea68ea004d, 0x201929eabc591d78, 0x482249799dd5fec7, 0xc4895d970616fa32, 0x82a4582dd087aefb, 0x29117f6531a5d9da, 0x20acbb493,
+0x64fcaba872838881, 0x97b99cc11a41ac22, 0x28c03ae986611d96, 0x72d058134fdaf5e3, 0xb4702862da2d1d, 0x4c8c9d69f6754fc2, 0x818abf62ca120dec, 0x2275a6aeee36b0b1, 0xa2416bfcdd0169f8, 0x4f9f9038,
+0xc383472f2f696d6, 0xd15be032208ac9d3, 0x4fd9906b4c2c0147, 0x22f4a1e43a6ce741, 0x838d2bb8aae0ec16, 0xa3f24e601b776999, 0x1f1588ef99cd2eb1, 0xc535981589ba0aea, 0xf28ccc96ad139c67, 0xbdfdc8c3,
+0x47bfcb5934d8f382, 0x1f4ddf14c0264788, 0xf03f773db2afbeed, 0x836292fe77764e6, 0xa82282ca0e8bf2e, 0x129ae2fadec593ee, 0x79e1dfcd1cd9dc73, 0x32febf7561a1c178, 0x2cb503ea3963126f, 0x1208e0790,
+0x4e497bbb09e0189b, 0x3347cd56fb9f1501, 0xb5c2f83b778d0826, 0xf2ee194dc4c48355, 0x207cb2058c7dfeeb, 0x7a0020f37e884d54, 0xebe5af7e49068bee, 0x1df1c0d5a6d6826f, 0x66403f2b5a6c9480, 0x32bb292,
+0x7dc7ce1989248d95, 0xaa2b5b8546349085, 0x680ea7596596c914, 0xdfd060393a37842c, 0xb7f08d356218b06c, 0xd71df03d65a7dbb5, 0xe82dd40b64898a74, 0x2bf2653145a95824, 0xd709c0e1865123e8, 0xba5bef1,
+0xb7a955863a988963, 0x3dbfd5ba833d0729, 0xa1a74c76229b52b, 0x529e33dc3a2d00e, 0xf26ede018a875e91, 0x1bdbe6ed025fcaf3, 0x3a8546e0b77525d1, 0xcbc873cfad8b9aac, 0x44a6959d41a8113d, 0xdf05373e,
+0x28b51f9f4637a8eb, 0x84f55872cc73ec1c, 0x8e34b797e7592a36, 0x3fad97a1b689b81d, 0x58af779d2ceee1ea, 0x9c38d8207f6c4b51, 0x11cee9bda9bc7b97, 0xfa81a98af8c265a2, 0x6300c3db89dec234, 0x171dcfb47,
+0x11a704afab9f696, 0xc6113d6144f25919, 0x655f37efd292580c, 0x9e6b29fa76759a4a, 0xb27864c5c51b44cb, 0x9d57414148eb2e8, 0xc4eda064f50f9495, 0xbf9932887181f9a6, 0xb0ab0ac610fd04c, 0xbe518f15,
+0xa2a12c16e73a97a9, 0xe20e8062bc155d1a, 0xf24361d78e926a, 0x251544e5e2da89f8, 0xf3003e47b6fdc8ce, 0xf531d91f1e23f705, 0x35fa0bbfb51778c5, 0xe325a73f9105a816, 0xc169f94a7e3514be, 0x182a34460,
+0xc7013b258923b67, 0xd34e10a5c242384, 0x89078ee67bf2f4ce, 0x9e3538bc5ae5e2e4, 0xf4d8d3ee298edae4, 0x9e77060941ced86f, 0xd31ad6134644fe3a, 0xf48a6fcf0ebf0d5a, 0xcbbf12506bccaf5f, 0x2773db68e,
+0x7b058321af347411, 0x2f64016054520a31, 0x2f649ab03d0d6560, 0xe2c66a845827293d, 0xcba493560d66b89a, 0xa21d95bbff94f0d9, 0x7c323c2fd4ba2ac9, 0x60d422bb070d224f, 0x13bb9a1ce6d00302, 0xadca1983,
+0x41ac33f498b9421c, 0xfe3cf8a1b40453c6, 0x6dc05accd264cbe5, 0x6abc4ca4853a84f7, 0xc01b8503cec04e86, 0xf777a3a948db7f6b, 0xddc9625c43cf9d1e, 0xffcb54e6257ea8fd, 0xca4101c07a82647, 0x517c2ec9,
+0x42003935150a8c92, 0x8678c4a13052057a, 0x455d985de19e6873, 0xf02e39f168ba6624, 0x81df4dd5decca81f, 0x3d33aef30e444f3e, 0xc5c1517c1ebc4208, 0x9cd80e0dbff9395f, 0x35e5bda42bb3fbb8, 0x1ae893eec,
+0xb6ad1116f96dc277, 0xe039008add5916ef, 0x29462d9f2a804656, 0x47e59e154ef266f6, 0xd573cb8c5100f7f1, 0xac13fc43058501c8, 0x62f2ae3bbaaa59ad, 0x6b62dd2fac2d304e, 0x2d1f47b92f621ba1, 0x5947d2e6,
+0x344f509a008a821, 0x4db2466355612e71, 0xa3887b5efe979f03, 0xc621fa4a5c846e4, 0x1c04aeb698946646, 0xb50c3d53fa05831, 0x96215f9eb575df3, 0xa33ed90249e6a4a9, 0x2cc9c6e4056d420f, 0x181663fc0,
+0x91add4784b3d4ffb, 0xd6b459b42ed072db, 0xddf89d13bcebc7d, 0x3dca16f84490ffcb, 0x258f23c994076a90, 0x88e8f18f082d5526, 0xb413da6759f9041d, 0x2695e2cab6dfef00, 0x4ff709c496c95ee2, 0x2d0bf4dc,
+0x5ea05c20a492c691, 0x38f8f6ccc6f8b541, 0x2fe56b5931a0c6f1, 0x96128a966bad3caa, 0x21fe0398a0297279, 0x815aa270023e0c25, 0x7e0d6703f2f958b8, 0xbd84e3acbe653f82, 0x79b66b9210f9ed15, 0x16becbdd8,
+0xade94821b7f09f56, 0x6fdc91d5921e818c, 0x73dce9c643364089, 0x217ed8c120c8acda, 0xc0f64e29286bc380, 0x2741de1fee05363a, 0xe5c4a4e3f286d9e2, 0x8ca3d9240eec1205, 0x295dc1838c4a8b45, 0x270c61a84,
+0xd8b70e047eb360f6, 0x764a4832ac51b396, 0x821f3cd787ef8071, 0xc80fb60774bd755, 0xf93e43fe640ab552, 0xbfd476a327da74d, 0xadc0b7d50e6b2f42, 0x23c99707f3a3122a, 0xaf97dbeb39bd316e, 0x1619e7ab9,
+0xcf12b28b730f5bc3, 0x88302cffde6258fb, 0xda07ce1ba459f02c, 0xae5823157443f939, 0x88899b9267fcfc1, 0x97bd1403b0832de2, 0x4540113456613587, 0x8418405773db65f2, 0x55249f2fd3665349, 0x25938779d,
+0x27e9cdf72c507e15, 0x3ebf6ea50d1a9f4b, 0xe7dcf27c3dfed1dc, 0x5d6574c21a108c7f, 0x394f5d55befabccb, 0xa230e4eb2fe79385, 0x8d344f24e585109c, 0x54fa1cecbbede429, 0x90b810ddcdc82bea, 0xcc1c5226,
+0x645ba26959d94567, 0x41a07151f49335ed, 0x2039169b31991935, 0xdb7edc51268a82ce, 0xf7793fb16f9012f8, 0x89f1771068419e36, 0x272edddc09d011f3, 0x33a29f0ba86c1688, 0x1048f9df263aeb84, 0x103b4ff24,
+0x64509fe552e0c19b, 0xe0a423cf85014fa6, 0x2887d8c44c1578b5, 0xf1139443fc9bb776, 0x3b53e2bf976a8998, 0x1af723b9f4f3eea4, 0x710b6467560e64ce, 0xcaada6b296d84fd7, 0x9380736202b5027f, 0x1e56c5275,
+0xfac7b00c5a7d205f, 0xd21ee3c033677a6f, 0x49c225b1c35d5650, 0x11e334df587b747, 0xaadb7ecca5665601, 0x5ea800ab70d4dc9c, 0xe0a245f444bc82bb, 0x1bddceb60ce10972, 0x398ad0863d1c814a, 0xdc8ccbc4,
+0xd72465d394ca7348, 0x29708d4d6b27971f, 0x4bb665e2945d4582, 0x8dc6b8836caba379, 0x83acd743696c51f7, 0xe119d78dae9cb640, 0xca121d7b78d2b5b1, 0xb9af0803bb7edf50, 0xd679d4ba644cfd99, 0x41230ee7,
+0xa58f3378c1476418, 0x6624106ab51d9ca7, 0xc0b656729e5e1898, 0x3617ed99586eb2f5, 0xd3cb52e8600055dd, 0x83399473f5bd9328, 0x5851fa280b2f5a64, 0xc479def6bd38de69, 0xf1468b7e1678532, 0x79df8ffa,
+0xbff209464023bb47, 0x1386b43cdd22450e, 0x57cf507acdbde6b1, 0xb36204c687706b8, 0x6cda4776a8da2c92, 0xf9d8170556181c08, 0xb2862a1821ce3101, 0xf64725990fee3618, 0x78e16ebc514f2b7e, 0x110158939,
+0x16c07287253c4ec5, 0xb3c9c4d1ea97dfe5, 0x42446491aec8e186, 0x49751290c7176074, 0x5a3a4a107079e9d9, 0x223d266be3b4f2d1, 0x664e57d6c23bb7e8, 0x97a6259b84053498, 0x5315015cd2a8f5bd, 0xbff235d7,
+0x5c39db577cd8e25a, 0xb053d601e92c7816, 0xd0c90b16e3f57ad6, 0x6043c33fdc100699, 0xcb3419f6ffa2f89e, 0xb0d048cd52696a1d, 0x9c38777691b42d62, 0x9a6f7d14e3f4b0c3, 0x9c970976aca9de31, 0x13f4e61b7,
+0x1a43c2339d92677a, 0xd229b59dcf03a062, 0xc799383cfa62152b, 0x561ad6f326ea4528, 0x7f792303a3fd1be1, 0x5b7de432c7f902fe, 0xadd84da223edde96, 0xb59d31a1c26558b9, 0x3865824325c7412e, 0x1be14c227,
+0x19732a9e278100f5, 0xefbdfcda76fa7bf8, 0xe4a190275a247d8e, 0xed4d1b72c3d2776, 0x881dc4f67742f24e, 0x4eb52af3bd2cd8a2, 0x5e44f54e5dd4b369, 0x8d107b57e0cb37e8, 0x851e14b97d9d8828, 0x19a8c337c,
+0x73a3cf4d50eca9bb, 0xdd2cc831ae424e4e, 0x9fea949e44d6ecc2, 0x936747022c7b615b, 0xcee26c4922fc7f24, 0x1107ad39106e1359, 0x889a1fcdf58e9beb, 0xca645b095ff073f3, 0x46d6d4694fd014b3, 0x60ed85d8,
+0x2a0126f8a8c61ec3, 0xa06f8f110d14b6e8, 0xb8cc051fb03982aa, 0x4345de6a94f50821, 0xa7b625644ef47510, 0x61028ea6d5b2fed9, 0x475aa6a9b061adf4, 0xf4cb8cd2147b408, 0xff36fe9cefdffef0, 0x1244dd572,
+0xff5646fec30b609f, 0x86a6c145a137cb0c, 0xe7741eabb8f88ebb, 0x288a22f759b08891, 0x12147415bd7209dc, 0xf2ec2d80c30d8bd6, 0x6ec814942ff559d0, 0xb5fa79c79d05a73f, 0x9b80355e15ad69fd, 0x507d5f19,
+0x7abd871b1db0c0fb, 0xc35c6d4db1b5de88, 0x7f3df2dc85bcbcf0, 0x8bb2be7a47734302, 0xc6334211548988b4, 0x749e189d148e8ec4, 0xba23758f58755d34, 0x9e4db9e8325f542c, 0xa3f3bf9dc6555d66, 0x1eef409ba,
+0x2272ca4a6abd9221, 0x3b611a7482ec0d5f, 0x87286633477ce38b, 0xed579d1d5950c6eb, 0x9fabaaba39a74219, 0x47ef957b29e7552f, 0x209b0dde94c9799b, 0x55294288d581d971, 0xbb03e84bf5ffc860, 0x2507013c0,
+0x34cf61bb4f909c13, 0x3918979bb9eb787c, 0xc75ee65cded69d41, 0x7f38a35ad213c173, 0xc1842a12ccb94ddf, 0x855780281050c753, 0x94f948fe6933685a, 0xd76be6cfb4ccc8ce, 0x31b01495a1a252fa, 0xb9918f65,
+0x2f34a930286c828e, 0x6637d66ea15556c, 0x2e7cc532fbcb688b, 0x4a834b00128da346, 0xc19df7465a1e06e6, 0xdbd536e67271741d, 0x702d6a7a79036c6f, 0x2b6a7369b65c85d2, 0x6c13f5900294132c, 0x22746b302,
+0xea537818f9dc619, 0xad70fbbd713142e6, 0xd21cdc318d827594, 0x7b465e260538c380, 0x484bb160c9d2db00, 0x636fd6de4db67ff2, 0xc6065e7f2b006dcd, 0x2b0197ba61406ae4, 0xfa23099478114358, 0x9cb7f3d8,
+0x8f85079a5eab3915, 0x4a5f5a5b2a4a9750, 0x4ede6d0b5e0d47d5, 0x78cc5d724673a079, 0x3b31ed902c73201f, 0x9ee5d4c6493e716e, 0x6bdebc019af4fd51, 0x9f7929da8e8cd4be, 0xb8b2fa2677fb8a05, 0x113ea5be4,
+0x64e37853870a76e, 0x138e33a65c1e31b9, 0xd98477ee3baa99d8, 0xed0197c21a7a65e0, 0xe18f5897eaf4ea5d, 0xa1e1fe8497195b12, 0xad50397505d9d7bc, 0x104bcaf93b999d77, 0xcb6bb7fe275b0c5f, 0x237ae7c18,
+0xa9131056327a20be, 0xcc3e259d96359487, 0xb713ccbfb8c3100e, 0x9792a886ebeeaae5, 0x29d0e8bdf6db85f2, 0x68749fac511a28aa, 0x7eacde2b9556f1bd, 0xa440ff5eb3cdf2ee, 0x8bf336f11f88261f, 0x1cffea827,
+0xcb154886464a3267, 0xd1130007bf15e002, 0x75e9425189349b72, 0x8cec062a9b00ec30, 0xccd631f3c67aed51, 0x27721829c09a6e9a, 0xd93e4f15ac1d4272, 0xf3771eb6129c9818, 0xd624291e1b97096e, 0x326c5b2c,
+0x4b25fbfe4ac43eee, 0xb2befeffc1f4527a, 0xa77cc9d85c9280ba, 0xeeb183279fe6fc89, 0xd792b9a0c2eff863, 0xf4de4a95a3658eab, 0x458ea50303a43809, 0xd4631f3ec4627de2, 0xce4e4a7352dadac1, 0x111d08491,
+0x325585ebb06ce50f, 0xb33c756b795730af, 0xb444e3a447416a16, 0xd6271b9a11af3264, 0xd8e83a3fcdd3214a, 0xf37cf90c5653e72e, 0xa05de5455e625aae, 0x7915f2f21979abdf, 0x2cbc50a1cf3881e2, 0x10c5d6a07,
+0xfea464a4716e6703, 0x1dbaabbccc43ccf7, 0xc8da0d9c0a945101, 0xa31aba4143fb5ab0, 0xb3584f874aa01993, 0x737fcd2389ee58aa, 0x487fda299789d165, 0x98c0f4df5f293289, 0x47acd571a92b1345, 0x1d25cc71a,
+0x572bbb58875453a0, 0x2646fee34cf69b91, 0x2080b00cbf542787, 0xb6062f612db22589, 0x275be404c6354655, 0x6ca77397ef3d14e1, 0xb77e472041dbed8, 0x6b23ead82f53e5d7, 0xe1574106d326fd01, 0x26eada064,
+0xaf273391fe5b93c3, 0x8975b431655f5a8f, 0xcac7e8217790caff, 0x6dec9d4033b71a61, 0x65ee1dfa0e0ed2e4, 0x6e0d799e0de4a15e, 0x3555e01585d52f19, 0x3a08f01b4361491e, 0xe6504a5f43310942, 0x27a21976d,
+0x8600fdc84f99cfd2, 0xdbafdfdf3f0b06d0, 0xb21c54c3994991f2, 0x2a86bddc72dbc6f, 0x57059eb57214a228, 0xe7792f142e35799d, 0x96f9fb65a8255427, 0xaba907a6c400dd20, 0x94a701b21537e32d, 0x1e1780401,
+0xf7b752bbe9d6c867, 0x208eff09277cbdd4, 0x86b6798a511e9e5f, 0x2078eda6f9555aa0, 0x4a0948b608211f98, 0x8e46533e442e65c5, 0xbc4661e48626d3d0, 0xc3bb09d6e2ee7bf7, 0xb0c149c3a9bc1fbb, 0x15289e84b,
+0xe4b0039cb8480392, 0xb0bfbc0eefeac205, 0x71e3e3d8f81bc335, 0xddc78ce5513925a6, 0x88780589feb5bb30, 0x297d91009b9c0bd9, 0xf28a0ce312791a99, 0x7180a7fa0dbe5fba, 0xc0cae4d5cf25c7a8, 0x14bc1d6d9,
+0x95251dd4d6d6d81e, 0xabcbd08328581768, 0xa8d6217075110f32, 0x3f3089b88b89aa9d, 0x15904f0d36e5701c, 0xfcfa2974ea2cd2ca, 0x6bd1bb2c3a334022, 0xdf5db0ee8b9284b7, 0x35e78452d203393e, 0x80432852,
+0xb5471765b6e08ab6, 0xe7d42da6f42a2dc1, 0x6605c131fa60283b, 0x4d19db1b9af33bab, 0xba91c266a2b112, 0xf90447c41c7123bb, 0x7dba193172873505, 0x45a26994cf5f287a, 0x27ff64c8e293106a, 0x2160b0788,
+0x6fe79b000cc95005, 0xa79545d1491b1316, 0xe59cc396635ffe86, 0x75f41e12139db1a6, 0x2e79821795f708af, 0x2de37ac970235b72, 0x673a6be97c33a071, 0xb23e8af4c637335c, 0xe5d49b937cf7a72b, 0x25c4385ef,
+0xfd1010f2dc8de3b4, 0x114be6cc7e4ccee8, 0x4264d091b478eef8, 0x4a7dc9d74815382, 0xaa62fd59013931b3, 0xe87fba8a4abda62b, 0x62f2ad0f239e83d6, 0x24f1dc8908229012, 0x26b6c5ddc2d118, 0x1b5d5ec4a,
+0xcbe1e6eb5199bf4e, 0x3fcf98da5b0baf33, 0x3ac3cf293cfc0f19, 0x7de9df55d16bf73c, 0x441b2224447c6ce0, 0x56e9d8754cbfeeab, 0x7feaa2874ca90a49, 0xdb6e22c2e6c82631, 0x69112b5b79a11aee, 0x248d81bba,
+0xd279a06d7a3d65b8, 0xa17da5ba56d2b079, 0x683f63f6212f8fa2, 0xd120f53d1f9cbb4c, 0x2cbc7696fadd1eca, 0x62163f16d0dd9d5f, 0x8fca4ff8e6fd5072, 0x2cf41252ebe1b56c, 0x56d89ba145a06338, 0xa9de97b2,
+0x507b9bf94e55115e, 0x105d4538da5a8489, 0xe954666e74b3642e, 0x434367c039ae094c, 0x6181513845ec1a14, 0xd9067bf4248854e4, 0x655c51b76ddf7d3f, 0x74db71b356261edf, 0x4281cba54313451b, 0x16b6f9d1d,
+0x3ab14d2cf4b310f4, 0xae2dc828b3568515, 0x420ab7350bdb15dd, 0xbb128ae35aa69eb2, 0xc16312a7085219a1, 0xf3ed697e10ce8841, 0xc18837cac9108208, 0x749c59d72357bb1d, 0x16be27752afc1b14, 0x26613bd76,
+0x3fe5cbfd22396395, 0x39906f9244bdeb27, 0xb892d5406459eb76, 0x3995d4e861d3c0a2, 0x2af7a5a6e93de61c, 0xba5c3777516d3e9b, 0xfa51824ae357b624, 0x60c102b4d29d3653, 0x9120a3f74c45ed1b, 0x1ac92310c,
+0xf8f0d78fac141ebf, 0xf78f1b6ba02edf09, 0x89f812428aefbeda, 0x4e2a5abf928b9a1d, 0xe19fa6369b34c11a, 0x68cd1a4be27556c2, 0x5bee2a21b34a3da0, 0x6fa91be2391430bb, 0xe7500b2f57c6a9c8, 0x4366fc58,
+0x75e19ca4415a8b14, 0x97e51d5d14649905, 0x3878c453ef278c10, 0xdef9c7996fafdbcf, 0xbf590635c31bc27a, 0xf03003c3ad769c5a, 0xdbaa50745c0f4006, 0x52a6101a01f8c112, 0x554c5996de57e21e, 0x1a679b249,
+0x72a9b0db1109bbdc, 0xe5cced73a611090d, 0xe7e60c501673d0cd, 0xc8d1cf433529d5a6, 0x21e7342c498f29e8, 0xd5c9e9aaad5ba1db, 0x544cb70628973ab7, 0x2cb165a20ca5439b, 0xf52f439652b42374, 0x97e7d77f,
+0xdbe231efd22a253b, 0xb3c3687e442869cb, 0xc871f00dbed1b9bd, 0xde3993553dc7a68d, 0x401423d20d0787ba, 0x955295dc6203a19e, 0xfb8ca6a2d46aceda, 0x7bdbac22ce6b3e0b, 0x8ba7f67f1e5fa003, 0x165fdd40a,
+0x6edbda0ba83cea3f, 0xc9d783016d4e5313, 0x9380400b01f720e8, 0xf4896693cb520c26, 0x62fbdce4b8b56535, 0xe75d7f2f6d29deab, 0xdef126d685cbdf76, 0x23ccf1d6cd6e8ad1, 0x3d31d26d041e5fca, 0x26e11f239,
+0x676545bf65c81521, 0x7f9940480a2dbda7, 0x9815444e21e176e7, 0xc8aae1f26305327d, 0xa73435d5d3eec8b6, 0x8834bb7e3174f5c4, 0x709ab9152979b1ba, 0x2baa990ac311dfbb, 0x4468e1c8999edec0, 0x1aa1827c9,
+0xc5ffe0d070894d5c, 0x1f8c525bdeb540ac, 0x3dfcb155813e52c2, 0xbd3a68c4e9c4454e, 0x726fa8bad3a18678, 0x4f5de7f5a1ff9c5c, 0x188f4deb70b609af, 0x7180b28d259dc318, 0xcb301c5ae8e217de, 0x22e92de7d,
+0x4bf4b4e5a3575180, 0x26cee8224db9efa1, 0xdd3fd2d01e117ed3, 0xbd1141cfbcacaf6b, 0x46391bf517bc8f94, 0xe18cea0177d93939, 0x3472cff79ba2ee29, 0x8626791edf885ea1, 0xd91eb533838d533e, 0xbf53673a,
+0xd6b170a739a9eefe, 0x92f96c179f3c3745, 0x83ac5b3b1bc243f2, 0x7608eed0df1c75f8, 0xeb12f06ad2e2b397, 0x356aa1b9de63d311, 0x5c83c44a6b933f95, 0xc7b3565f80e0b6bf, 0x955e676e7004e9c3, 0x2239fcb72,
+0x7ac5f3c9e1ea0e8f, 0xab2f4fbd4b55dc9f, 0xf23e35eec8b7291a, 0x27111934ff88a040, 0x7f65783acc43a070, 0x2217fd9427773231, 0x9c766aaff77d4ca8, 0xba2ffe502d704256, 0x8f3cc9c790665669, 0x2022417b,
+0xe0224c4fcbae0fbb, 0x51dec3457d1e5e55, 0xf95600453b4ec874, 0x60af8af351258578, 0x45806adef6e6b891, 0x7d9ce9de53972ca4, 0xece7af20bd6c5cf4, 0x5bd21971af2f954, 0x6929bf905a6cdb05, 0x1c1dcd2c5,
+0xc787ba6cde404d01, 0xb4cab29a2278dede, 0x3509b69a2c9985e6, 0x806b85cd5b96f43e, 0x5c36223810c06512, 0xa71ad5f5f143df6, 0xcc95df06c8d51397, 0x93ca87ae2a8d3db9, 0x526303713f54f6e7, 0xbe009611,
+0x248b7878b9b0264, 0x490dd0802c891eb, 0x667183ad856fb1c0, 0x5efbe4780b292228, 0x2245ad8597b6ab8a, 0x7dd2f26ce01e9bba, 0xd056109250f0d2ff, 0xbd0abc1a8616ffd, 0xdbd6334e0b85d457, 0x3ee5ec8f,
+0x9a4503ae4b67feca, 0x764ca17fcdcddf60, 0x7d18d27b78f1f8dc, 0x155d2a6e2132c2f3, 0xc4efefeb78474d73, 0x8433cfeb765778a6, 0xa60850d0f2dbf2b9, 0x138ab20c9490e75b, 0xdca22728cef2efe7, 0x39037840,
+0x2abfec6cdbadfb08, 0xabd9eb6f1ce1619b, 0xf2959e2f7d7d456f, 0xa5d11f4b26b4366a, 0xfe3d9b6b4f68a7d5, 0xec051bca85a97e24, 0x2ac3ecb797301692, 0xb826050f16bab94f, 0x6489cc1f0224d7bc, 0x4f5044cf,
+0x7dc98c9e49537c, 0x3449871e3ac72d70, 0x9916f282969b45a2, 0x999314c5a3e3bf3b, 0x1b83a42a3155e148, 0xf8f5dcb2032525a4, 0xc1f32ed8cc48e343, 0x55e9db7849c00867, 0xc3b07d9402cb638, 0xfe8a1118,
+0x2be326272b782997, 0x638712b7bf460538, 0x3a6ed25a9b380901, 0x2d22f1f97a195a9a, 0xf215c31c36455792, 0x8f95da1f2909991d, 0x4364e0e8af9b5ea5, 0x65c593981e2f6f1c, 0x63f634f2f406277c, 0x2368d7cfb,
+0xd417db4c3011a1f3, 0xfa63ad4a307a41a4, 0x14bd2a7717396767, 0xb3ed973660a10947, 0x7f5bc5bd4b93974b, 0x16f4babf8708fde5, 0x96c484df3a225df1, 0xf6727bd7eeaa242b, 0xadb4b9d92e77c97c, 0x18e5c4c5c,
+0xd89deaa6ecb9f9dd, 0x29f5dcf865467157, 0xc3b472581c43d7b8, 0xd08a71a2f7418236, 0x524989d71c462941, 0xc5fe2b46fb3d71c5, 0x8a28250fdfbce28c, 0x708be26bfdfbe305, 0x2503654392d500e2, 0x15d29e58e,
+0x52de41ef270da84a, 0xdd090430199da9b4, 0xc1d332fded9ca479, 0xf8492fa13dfb2b97, 0xe0e1add85d5525f1, 0x841a5c65fc618aa9, 0x4a89f97ebbfaf00b, 0xd6db9b8e9aa93236, 0xdc5b8bc4e1fddc56, 0x7f00a474,
+0xe74d78159501a97d, 0x3b4abe10a98723f9, 0xe4e5d5973db1593c, 0x69a7064bed6436c3, 0x64a4dc44a9260e7b, 0x8a3cba5f5697e8ce, 0xb0c4fc6a02a2e48c, 0xef6c2603fc19b582, 0xd8e7c600f6abef6, 0x4b100f6d,
+0x264a5ff9539b7b9b, 0x8e75d0907186314e, 0xa1fc150548490fe0, 0xc9e32cf4e422efbb, 0xf9af4b4e45eabab8, 0x5d44fe4dfc069b31, 0x36eed61bb905f044, 0xbc56a486d1e5d941, 0xcdeef305fb62f03c, 0x1113d713,
+0x38bbde8f425b07de, 0xc7de441b3ef46d51, 0x78ba8436e4f6c17f, 0xffb61a52c7f1b651, 0x7ab86785793bdaee, 0xcaac97856df82e25, 0x92962dac442a255f, 0x4c5cc1fa3066739f, 0x5731a5a5993fe834, 0x3c33087c,
+0x14bbdfcadeb2ce6d, 0x25f967916158a6d7, 0x4abef3e1691f18c9, 0xb4a8c10930d8e5e5, 0x99faba6d66e5402d, 0x1801a20238fd92de, 0xdc4020cc216be822, 0x4c60e66b8703cbc6, 0x25e58528b088a6c7, 0x19f81c099,
+0x857f4179f4db4cd6, 0xc038126aa2390b9c, 0xad27f598c440f89b, 0x9998175f9b7204c7, 0xde5bcbad7b0bc1cf, 0x287f15511f35f6c, 0xa2a6f490ef6b9dc, 0x4692ef1ac7e151e, 0x453b59757e2bff18, 0xd191df7b,
+0xd7305f91ca62dcdd, 0xaec70fcb9f20f47f, 0x770dba94ccf4d49a, 0x9428d056820a9ae8, 0xc8fec2d4a5f6b6fd, 0x1a7f5355e4a0ddab, 0x802fcf69f1a9bdcb, 0x1e25af028690cbbc, 0xf2eb7870b9b33fc5, 0xc0a6a5f7,
+0x3f0d18899ca80f5b, 0xccfc33f79793f09f, 0xd1aa862da99f53a1, 0x5a4e6fb88e65271b, 0x1f9aed3bbe95b5aa, 0x3675b199ea95f19, 0x899c84f6ce2d0960, 0xbb85b52c27afce44, 0xe68ac40973e78cee, 0x35f5a16c,
+0x3a9774bf7bd9f322, 0xe09fd0edb006461e, 0xfcd7c3120066b684, 0x51aa7fdd395ac797, 0x8aab2535c3a426c9, 0x81fe64c535efa6c6, 0x87b3d5781abeca6c, 0x5f427e1747051942, 0xffb5373a0db3a865, 0x21d9644b2,
+0xb9aaa28fb97e8e8d, 0x6fb9c0acdb608989, 0xbc73bc420d696c3a, 0xcb5b634e7b72af02, 0x3d76d41e337b5bd1, 0xd61a6134273978c2, 0x546a385512a75b09, 0x26b87f363c92f2a1, 0xb31883862f9d020b, 0x1dff69289,
+0xe69a1effb1c40407, 0xa01951d316b3e6c6, 0xe4ae0ab8709e9c49, 0xc0575619e6a523d7, 0xd329748051df2297, 0x2458ab08a42ee438, 0x5698872a50447186, 0x60647520ccf83e0e, 0x837a036b43e96922, 0x225c57139,
+0xd6e12d871dca1a81, 0xacd7aa018c3042e7, 0x449667c85b01e4f0, 0x24b144fc26a0e138, 0x89f12022ae6dcc05, 0x3589189bae41a06e, 0xc703a32fa4417642, 0x712fe356bb7b7b5e, 0x2b92f85b1083779c, 0x174ebd815,
+0xf3dfa8b0e6fb7b21, 0xddeca9fd8913a354, 0xc1b2d4f6e347743a, 0x48dad0c04bbdd47c, 0xbdb0643acae81cea, 0x9ae08de01ca62bc2, 0xbde4f71f62c71df6, 0xa2539de22de0ff90, 0x577bee945df3ce26, 0x228b552c,
+0xf7b6a0e916afa689, 0x324b28df43383977, 0xedc6dcbcaed8b7d0, 0x4bcab2fb20b201aa, 0x61d8039e9e08bf0d, 0xf251c8e9e6a87cd0, 0x7a347d2c10975a1d, 0x81e9127e4bc639a7, 0x623ff1bcc64fa637, 0x1cc9104c4,
+0x370197b194b8e1f8, 0xa41c48a4c7c87ac9, 0x92b7beab21b44802, 0x2f30745f8f31012d, 0xbebaefc4e6c0ab3e, 0x6bb7a71390740da8, 0x72dcebd770aa17cd, 0xd0fb33c2035a4380, 0xbd2aa8af80563190, 0xb5e0d4ab,
+0x337e3e787c28d6e6, 0x3b47e88e0b2198cf, 0x27a98dc2e413b943, 0x8e6f6282ef1e4166, 0x6729e1e0b3269d47, 0x1aef24750d4ed7bf, 0xfa1e6cb43b27f72c, 0xf6f4855a515bc0da, 0xd55a4e83bb74f710, 0x21edfcb66,
+0xda3148e037e6f3c1, 0xc2c03632b7ca417, 0x993567fe728609cd, 0xb4ff88cdb9c9ec25, 0x8d11cdc51879e80d, 0x7929939340f10c20, 0x3eecf4dfcbbb6128, 0x1a81ec45c9f19d7a, 0x4dab9471dabd837e, 0x11d8212b5,
+0xf28652af4280f93a, 0xf1bb3ccbeb718d3, 0xeddb1631d64c0388, 0x337d2b0aeea0743b, 0xc37e7b2831ca0bf, 0xe314df3ec3eee873, 0xee6e487c2b4ac57a, 0x1b06743d062bb771, 0xc659850a4ce0c647, 0x11b7ed10a,
+0x4d9a71bb613f760f, 0x83d1781c2bd9143f, 0xb0b0427e59e07605, 0x277926ed2d16a063, 0x1ac6340e841eed7c, 0x70c18c8010f672b1, 0xd35d640a113076eb, 0x2702b35de30e822, 0x351f19209451a32d, 0x158f5d89b,
+0x9d85ed5ded31f53a, 0x98fe4c9152bbfca5, 0xd3546ee07743d958, 0x99b919f0a22d846, 0x64803617b583bdf7, 0xd6d60a4d91b25b88, 0x9be810a185a95d2, 0x6de484fadf5682c9, 0x497c53af8e7a08e9, 0x87d0ceef,
+0x496eced41360d098, 0x7757f62b0cd23da5, 0xf9a12cf4702bc684, 0x1ae270d01cb7447a, 0xf59a886a06ff9f00, 0xa1faf1da54cef315, 0x3663866db54c12e4, 0x21ca259f098ed5f5, 0x915a3b726c2e887e, 0x4bd15940,
+0x19b0b87d1a495434, 0x27158134dfce166b, 0xa8bcb0cabf2cbe59, 0x3a4ae05e6466796f, 0x7df20deb54327beb, 0x7bc1e5272e9055a3, 0x83432bbd8b0d68a5, 0x6053765c1cb00252, 0xafced6befdadeb3e, 0x15f0c280c,
+0x8cf3e5ae609355d5, 0x6776fe4f75144d21, 0x4c3eede86e12d484, 0x3f4cb44e40bd8c67, 0x7b4cfa8daf701f98, 0xe7d5e65ce9940cb, 0xa9a35a979a750afe, 0xc995d905770fda4e, 0x23bcc180d1acf6ab, 0x520a4bd8,
+0x5d7fa24d6abf6bb6, 0x4a264a9d8635e857, 0xd0a70ea6a026f9e3, 0xb2cd7bac66bd03c2, 0x236a6e006a88eb23, 0x3bb3663ca408206f, 0xa82faf71ca38e27e, 0x1b53913dc941c1bd, 0x1a62a271041f5484, 0x18a752fde,
+0x40f1e475accc7fbc, 0xab8d652ec5a0cd50, 0xddbb7f8a23879216, 0x197c87ceae8057c0, 0xe508c3f31d673820, 0x56411b5bfe6d8af6, 0x38e14ebdebcec103, 0xf9605207cc1fc457, 0x40a98c950ae0b43c, 0x1c00246ee,
+0xfce99ee0c6f3bc0e, 0xd46d3f4913578acd, 0xce1207fa123edee1, 0x40a611f448bafb1c, 0x9a3fc84439368adf, 0x22b0db85f64ab1f7, 0x423f6c7a6e0af148, 0x6edb40c2e977de64, 0xbbe0d428ad8942ca, 0x2783408e8,
+0x3e9dd55beb43b90c, 0x59dec7f062dce6a3, 0x5b5ba596174ad2e3, 0xb81acec413677294, 0x175fe23ae2f49242, 0x6d6773e63bb8ab69, 0x2d1ab336ce0d08e6, 0x79474803b4d468a1, 0x10abea4534b818e2, 0xf2664fc4,
+0xb90f214d4d631150, 0x71c53f816c16845, 0x804dc156220335af, 0xe4ea54ae47a953c2, 0x4ecd3f86ed9fff84, 0xfac8c3fec746b547, 0x20e71c30615a3044, 0xbb41c9bdfa3ea9f, 0xacbd0b1cc9263ef7, 0x278c94f19,
+0x92a2e01f4f6a70e, 0xd6632372e627a8a0, 0xcaa37a9e5a822d5f, 0x43526199ef0c335e, 0xeb5bbb0e38bc44c8, 0x485ccc5a45681e72, 0x20895a83edba073d, 0x4fbd984d1b95d0c0, 0x3c77df176165e06a, 0x136d3460f,
+0xb89b7611c1940cb9, 0xffc4ea7f26937fd1, 0xebcba0f65c3287a2, 0x7c66c03aa4609c5c, 0xe18ab97a017f7a41, 0xacecec1de2265531, 0xa43299a50e291885, 0x53336117ef8ca42, 0x8b426ef8730c8ba5, 0xd658662d,
+0xda343dfa6752d53f, 0xcd2209edf5c43ffd, 0x4fc37134da1761ad, 0x213d58db4f52ce4b, 0x1fbb3bd08a4123f1, 0x1ea9663852a140c, 0x4b4f8009817453da, 0xf5bb63e8e127aa1f, 0xa6a01e70bcea4ce6, 0x194520bfd,
+0x2978effdb77ad745, 0x3cb8d8f77d0b5d53, 0x8bd1b6aeb7e09518, 0xaa6e36643b11658e, 0x77d0ff4be65aa94, 0x729b8b045a604ca9, 0xd8129a566a2c3241, 0x94564ff0880d7e51, 0xa908ab103eb174af, 0x1b9708d6a,
+0x9ad86f4987681581, 0xab093514c0545ad6, 0xac95b3240a45afa7, 0xde3bc36c1885a5c4, 0xc71eaa81ff8ad301, 0xdf112fa9e9e0661, 0xe4ee0879c39081ae, 0xd59f7137b69b1b16, 0x5b2a30c8d471b44, 0x1aa658c9c,
+0xcc1acbd2042ad62b, 0x4968bb5ca000f64, 0xa1ae0e428e7d9814, 0x40800c702998210a, 0x8f526627c1b1abfa, 0x8e69c6e75fbd5a25, 0xbb8ef0dd16da0d3e, 0x219cf43251f8f24, 0x6b9c188b8c803d0d, 0x18709f5d1,
+0x8745b215094ef965, 0x79fe3c509c78a20e, 0xe6af3739e8c57316, 0xf0f880a17ab830b8, 0x185e312c36291494, 0xdcfac42882a0854f, 0xc467939bce3ac43b, 0x40cf659514781f13, 0x8357f0df5b838d61, 0xa32da027,
+0xb14e230b696a94a9, 0x5a7304fb0a8f79e7, 0x243c3343f06e144e, 0x3490418be4c609a, 0x79ce827958758e9e, 0x15d480c283a18182, 0x2bb85c30bad049fa, 0x617013692f4d7de2, 0x993c17ce56eb036d, 0xfc1b9b7a,
+0x6223bc912b2f76e8, 0x8950c758200e1668, 0xbc026c8ec185516f, 0x60177cd7007565b3, 0x2e6e6abea6921d40, 0x7b37a26ddf5db032, 0xdd61acf22880947, 0x2d133b5e15434e40, 0xf7cd7c06e7fa8389, 0x2693d0c0a,
+0xe0e40c5c5161089c, 0x9355dbd5e618b3fd, 0xc098b62897a68c93, 0xd8d700d9487961d, 0x8ec7f8f298df7b5f, 0x1e73f55963e1a64b, 0x3da5bf22cac5f055, 0x122d6f11a6e358f4, 0x420645c03cb8caa7, 0x1550da1dd,
+0x1742ca83de775d37, 0xc7ed4c2dd654dfc, 0x4500f0deba28dfe1, 0xaa483de4b111e638, 0x2e3a567755d6f568, 0x149237be58ed1439, 0x3acd622ea0eaa063, 0x9e1d099216e2681, 0x656a62d36c80386b, 0x145039da4,
+0x7bdca97b1819f4dd, 0x8176f1cb56fc5ef8, 0xabc521a8b24fae8, 0x2767e7c180fd9146, 0xe24e5ce37a86a319, 0xd4abc0a64825610a, 0xffc68a68072fb6a8, 0xe2543a35ca77ead6, 0xd0db7afc6c01009b, 0x177c91f01,
+0xfaf7f11b20e79a5d, 0xc23647d971161432, 0x97bd5bc7fe43f79b, 0x6988deef1083e0a2, 0xe791f6565542414c, 0x921a3fb65e3cafe5, 0x462866bded4184b2, 0x25b221aa4b016aed, 0x6edf49138702b4a7, 0x90921131,
+0x8f86a27b66140c10, 0xeb09ff4773edf82, 0x5232abcc08333172, 0x14e816ed311acd58, 0x4c498a3a79f4f94f, 0xbd3cfd77eaee168d, 0x70ed043d8977e61d, 0x7cf50623e822357a, 0xc45ce67983e26b27, 0x1faeb8e36,
+0x2c6be65659f8698d, 0xeb7c6f61b260fdb1, 0x38ccfa978050d069, 0xb5cd71ad885b4de5, 0xc663edf187885dca, 0x734030d9f838a751, 0xf7c2e5c8959b6d48, 0xd30fe4bc9f85f7f5, 0x7821002e9db9c1e4, 0x54b0dca1,
+0x48dd24ce20381477, 0xd3cb492cfd1b02c3, 0xe56120c28e93277c, 0xda425d13297e93e1, 0xc1670b9bb61ac344, 0x532414cca367326f, 0x554e81a115c4aafa, 0xf77203ba5e9386c7, 0xef489aed852c8c37, 0x2741f43a2,
+0x6f7f2d091105fbef, 0x5a9f9a377e36cc15, 0x6dcf67b8bc535bbc, 0x63c76dfce46556c7, 0xcae2fbe2393bc8bf, 0x7442f89e802cc764, 0x7b733b5567525bf5, 0x906984b917f1f32a, 0xee4ac3e4f23f5301, 0x17d7f8fed,
+0x709b92afffc15274, 0xe8865127245237bc, 0xfe7c076d5db2b60f, 0x5b2a39cd3612aa08, 0x4254dae8516a56df, 0xb72fe0e9afc29ae4, 0xc687485acc40b348, 0x16505aff74af08bc, 0xa40c328b8864c812, 0x272a76100,
+0x9a233ed22ca7016f, 0x3638b61741c5d718, 0xc2763b15e5991f41, 0x18833a8694e3aced, 0xe598fffaccfc4ffc, 0x7994620f8a3032c6, 0xe1683272f4ad8184, 0x238696f4ea01393d, 0xd0fb997ee366598d, 0x139c9f71c,
+0xc498c8c1c7dca355, 0xdbde2255eb405f89, 0x2bfdcac08c115d35, 0x46daf73bf068312e, 0x5702878f1844f167, 0x135bceeb9d7a0eb8, 0x35485a90f5705cf1, 0x81315a383709ba7e, 0xc9d604bace22b11a, 0x5738e2a6,
+0xc742a193fd59a69b, 0x490302be264cab28, 0xd8a580cfa75d817f, 0x1545f90eff91c93c, 0x239655a38b45f656, 0xaffc0758b6d2654e, 0x6ec66c22c5902fa6, 0x6fdbb3bbff5acc11, 0x11bb61efee95c05c, 0x2497b4d7,
+0x5293104cd65115d7, 0xe0fc04466487675a, 0x8f24c475e43e61d1, 0xc461eb70f28fc0, 0x67530ab4dc5c4316, 0x92c6d6f006476ca0, 0x66b6c461a9e908fb, 0x86d07c4c5416e1ee, 0x66012102ada8e7fc, 0xa0cf704d,
+0xbac50c4d3d9c1f2e, 0xd08714a442dcc798, 0xf1752254a3257eb0, 0xf84db14d671c9bc2, 0xdc902d2b724a668e, 0x72411fdb8514857e, 0x36f6f6b1f0303dc6, 0x70e4b276d85af7fe, 0xa9a2551f4648b64c, 0x236f31f7,
+0x737b5551e8f309b9, 0x564ab13ee1a2687c, 0x5f1512d29af98e1f, 0xb98ef061820f80d0, 0xce9edb00046f0088, 0x16656ddf9fc7f4ea, 0xf6925073de5b46b0, 0xfa6a6a5550d54419, 0xe1db08f1b0f97b7f, 0x1e33ec4d6,
+0xe23f012241511de2, 0xb21fd54f1e6a4086, 0xd2c9dc756c79f499, 0xc564512e0d4470e4, 0x4cba1d336ec00a94, 0x98a20f94b064cf47, 0xb81793da011ce94a, 0xd26d457f03da35d, 0x2c066f64df885f83, 0x1d51936d4,
+0xe787838f9130b923, 0xc94031138781dbba, 0x24430f134192f654, 0x48813d225d802d3d, 0x922082d57b4c52de, 0xdcb510242b896dbb, 0xba160db2bab14683, 0x37c03395713a0daa, 0x92e3992ecacc61be, 0x16ffedcd9,
+0xb53ab49d5b1462cd, 0x832ba9a551003ae6, 0xbdc412dbe7b7f4d4, 0xd3f30614d09b9bf6, 0x490bca9ff01ad263, 0x2ec2e88514831c8d, 0xa3158b10b76f5fbd, 0x7e9b91529f64fbc7, 0x866146732b149a0b, 0x225de0b07,
+0x673446d737077924, 0x9e7cabe786b70b5b, 0x2c7a72758f92b5fc, 0x44db91c6cee4414d, 0xfc0d96896f4854d6, 0xa3405ccbe453ac77, 0xc47abc28d09efdd3, 0x6b8d6a0558903498, 0x738f0d467219555a, 0x2762a443c,
+0xee4ec1ce43152d5a, 0xccfebfbdfc480cf7, 0xf3ebdc1fde20a3cf, 0x920a57c9cdbec751, 0xa69ff647cfca7679, 0x6efd66557f75405c, 0xfa965cd23fdf8e61, 0x69059d54855527d3, 0xfaab524610e01e2f, 0xb3a27c84,
+0x4450e34f06cba34b, 0xc38806fb7b9a9d4e, 0xacf870eccf075a50, 0xcccfe2a7440fbb40, 0x97852cc2c700af19, 0x869a6bc54e1d1a9c, 0x46ed9e056110f0e6, 0x9e08d0cac13a4ce1, 0xccd65045f26b0ec6, 0x15562829f,
+0x2ff010c963f57b25, 0xb8759b75cade20db, 0xff773cbad44b77a, 0x356200ad46666d9, 0xaf155688b2cec82d, 0x1cefdeda19764cfc, 0xd73cc5fc1e69a64d, 0x3817e76d30cd6814, 0xe5de8fa47a0a508f, 0x19b3048f5,
+0x5f97ab7fe794372a, 0x1ba80debd7d97838, 0xd61066ca43604428, 0x27a4831282fed4da, 0x745199e04e62b9dc, 0x9959ef18539d77ed, 0x45b4e8297102b484, 0x653145fe21711a66, 0x4d0e754f8ba58f4f, 0x121f97a78,
+0xe8c8bf7aea02042f, 0xbf9eb72548df59bd, 0x86da08f9de0e180b, 0xb5b8173748797a3, 0x7aaf9400a654b237, 0xfd34c7ffcf599658, 0xf00361fe9eb8b435, 0xa2a7c1046cdf36cc, 0xa80b07b98dfcf69e, 0xf655b5a1,
+0xc1e432814a80b33b, 0xc4755529cb7a1c6c, 0xadbe4e39779270e3, 0xda918604c3680067, 0x810cd3c95ff9de19, 0xac6b55f525af6e10, 0x4a44716288abacd5, 0x12f774e364a39681, 0x225bca5c748a4ca, 0xf4b2a771,
+0x1abee94e2e67cbc0, 0x3d5465c57450d44a, 0xedfa46429dd84a33, 0xd67886289e83c453, 0x8781ea85bc711a54, 0xdccc030ac7921934, 0x8b329fe4dbf08c7c, 0x19ac58b76fe7e16f, 0x22e3941032dcb790, 0x2783818eb,
+0x51ce59a85a4fbc2c, 0xb4d89d64369b373b, 0xc5a665090b39b887, 0xb4908c6ef21014ad, 0xaaaa85fdc58fb860, 0xc40b15f6a92c9961, 0x39170aaf986a8908, 0xdcba8b0fde86de6, 0x8a2d0d2a78c114d2, 0x21e71cc48,
+0x82a4197b1de49bb2, 0x942b053d9fa4dba, 0xd33f1e1543c7df90, 0xb748c3c6a7eb7c85, 0x5adab9014098fe6c, 0x853fc9f0317b544d, 0x19b3ef9c960e0764, 0x321993b2499099, 0x16b63d2090bc2ed6, 0xe47d860d,
+0x2ca054f953ac269a, 0x4557cdd2ad1ea96b, 0x2ec9de2b8793e755, 0x88f0f8bd2d05bf2a, 0xfd1809bff13ab352, 0xbe47d351a06bcdc4, 0xcc4d79658dfe96d9, 0x7877e67661e41402, 0xd150cf5d265bb331, 0x2731695c8,
+0xf77e31e660d8d345, 0x5f9caecf51300572, 0x8d1f7ea69f5e2796, 0x52132c8ecb69ee89, 0xd002d3f1343a6647, 0x18e177f4b94ce52d, 0x6567359bcd30254b, 0xecaf5e852826d9c5, 0x93b8fabb1b99319d, 0x1597a6654,
+0x19ea71a806ba498, 0xfb6d16ef1dffc7ce, 0xb933adefea2727ce, 0x81c55aa3cb1dd899, 0xa2a556da3ae045fc, 0xf5f2aeeefcb3a2fa, 0xdf1830217f68bc3b, 0xd5947537112019fe, 0xf04e78129d449843, 0x1000b6f2a,
+0xaaf66fcea8291135, 0x92d93d28002c1b81, 0x85492ef87f70a0c5, 0xa6b05f5eed1d6294, 0x7d2ed11927c76b1d, 0xf595d111e7299344, 0xfe74f85c1905c4fa, 0x4b6a9b97a6440f9e, 0xa9efc8b9f36b0d64, 0x1bccbc5cc,
+0x743e26648ff63fbd, 0xd09eabe6baf23844, 0x2469248a7a4ecf30, 0x496678212f89d042, 0x3a1b09afaabbe5f, 0xb98a0894a8939a9a, 0xeedc86bdc09645ee, 0xe640f72e9030bafe, 0xbafd098b1ffd0222, 0x7df9ccf4,
+0xe4e88c93b491bc24, 0xa36d0360dcf8ad93, 0x4fba995558bdb48b, 0xfceac4f51cd71d2e, 0xe2fbc26c2213a352, 0x4bd7328ec5fe89b7, 0x8f62813441874b06, 0xb6ef6d4b0a5a2f0e, 0xc27d7ffad4bc5c8a, 0x25f59cb77,
+0x976eddf48ee4c46c, 0xeba7a489535c1a6b, 0x6fdf6e149ae7da01, 0xb8af2fd7a93b8a0c, 0xdda29e239a8e95af, 0x644ebd33dc601361, 0xbbca851a234842ed, 0xdeaf030ee45ab304, 0xe0bf12998a083618, 0x148fa4f62,
+0x4fec767d19328ac2, 0xf2aea959b5ea2c9b, 0xbc55d00ef99b76a4, 0xd97e092a25ee7c0, 0x76a5ed4b2478fbe2, 0x3c45077ed3fed327, 0xb5dce77bb0ea7bfe, 0x4f5471f92113cf09, 0x7faeb22310e8a806, 0x1a98780f,
+0xe9be84088314d646, 0x45aa91b7b3e5a24a, 0xa3e04f14f885c39a, 0x5839355fb0490c7a, 0xdcf890dece391e7, 0x806bfd6a32eee661, 0xfa67a40fbd25457f, 0x5c32bd6fd7d5a4fd, 0x9104e9954382eea9, 0x19e19c180,
+0x5b0dcab2ce55a988, 0xf7f8c4b8470819d3, 0x33ce39314ad5ce51, 0x8f8a13fd6aee63a7, 0xd613f82f62683f91, 0x582a372d47f85d49, 0xe05a8d1503735dd8, 0xd96ecc611daf9bd2, 0xf30fe48567497916, 0xe03eab28,
+0xfd5a8abb32c1e5eb, 0xf5b37ddf65a87ba, 0xd88aaead8997fb53, 0x8cda9b1e98205da0, 0x861d8f218d6c69f6, 0x71d16efb5926851e, 0x466e598294dfc333, 0xa696563b8a03f33d, 0xb5bff03a6bca5, 0xa570f033,
+0x574a4f1e2b96d832, 0x5ff606514a3edd76, 0xd55a2839e87f0392, 0xb7bbb91c1f4997f8, 0xc2049600252697e0, 0xe0aa35a90bb66fa3, 0xd6672d7e784d3779, 0x5571b3740d4417bc, 0x47e05b138319cac8, 0x136a66198,
+0xd99785e2614fd5bf, 0xbe68cd969d3c7550, 0xad747c8e92e0707f, 0xe51225e148040192, 0x3b94e99bd3f7f818, 0x55e93ea9100bc563, 0x9f80f8c68d2def82, 0xf227ae8cece08eda, 0xae9527ed541b113d, 0x121887786,
+0xbe1d2d6c057d6058, 0x2e614f1aa52fae94, 0xb7e3ad4ee91202e, 0xe36aefd2281430be, 0x22d9569bf4038c09, 0x16d72b1c1b74ee9, 0x715ccbe64477c832, 0xdfc89f4fcb6f99f4, 0xf20c9bce75ae98b2, 0x26b45a0f6,
+0xab69ff607896f5ac, 0x8bface3ebc840d32, 0x2917e1933ee9e56b, 0xdf3ce39c6990ff9d, 0x404897918c60616c, 0x99156007d461e6e2, 0x598783552f9dbfbe, 0x2692d6983ad33b46, 0xcb02996501ca1337, 0x22a30eae,
+0x9325c28f9382d658, 0xea496fea7b8b6c7a, 0xa74b1ac5a95d87ec, 0x293803376ae3148d, 0x73d26ca83af7fa37, 0x9d0c49668e90bb8, 0x7702cefb4a637bce, 0x7c5c379ecc48beb9, 0xd84e3a6d52423424, 0x74e47fbd,
+0xc9876f2857e98765, 0xb71146b430353b3d, 0x7662e0cd42d22e28, 0xa430a06e338cd431, 0xbb1d3174bf806ee8, 0x9b5da84adbbd213d, 0xaeca711f323afcc0, 0xbf851b431908b3e2, 0xdfbba64a96d84b3d, 0x3ba7f0a9,
+0x2c88e6909b428def, 0xe796b9b49ab1d3ba, 0x7c025ec57613d089, 0x375cd51c452662f7, 0x41c3e3d14f64274c, 0x6b6b44ad472fd94c, 0x83c40fcaa205bf7f, 0x72d57bf439f8a510, 0x3fc50020364ab118, 0x3f0b7044,
+0xb34a786a1eb23717, 0x7aa4bfdbfd12a3d0, 0x68918f6479fa0467, 0xffbd490347d3f85c, 0xd44a53dd93b68c0c, 0xfda376094bf00463, 0x679cf9e638022aac, 0x4393d26b6d7c3db7, 0x3e15bbc91c795bc3, 0x32d0423b,
+0xa51c2852d8f9f330, 0x6d824eb7ca92e48b, 0xc666a64d3142ac9d, 0x8e4b4dff5e10a280, 0xb8eecb58e4e14bcf, 0x9436a408662fd687, 0x439114b38bbfd006, 0x4fac6d80928767c7, 0x38b406b93eedb4b4, 0x4af85e99,
+0x64723d4b4cd55046, 0x7fb9878f9d828fb1, 0x1224c91d9687db05, 0xe9a7d53b5897c8b5, 0x857d64874ed8c689, 0xd9e1a6d051aa334c, 0xbaf50a3ca2c07245, 0x62203948ee9ef8a9, 0x40cf4d6ca2fe341d, 0x133d83f72,
+0x61831c5347386148, 0xa6fc78b710e04cda, 0x613530bccfeea4bc, 0x33d7b783b611d9f6, 0xa1a26c09d6860c4c, 0x4a82df1d1ccebc51, 0xa28f0dc42bc89b3e, 0xbead6c545769351d, 0xf573946f6478c66c, 0xc9e9841c,
+0xb3fe84a5fb13f42f, 0x29d17f19b606b4c4, 0xce33e10b3c44467e, 0x79f67b8e7d58cd9a, 0xc2f0e14d64c27034, 0xef9a2171325534e0, 0x5d2b880272606552, 0x50c990f820d7f3f6, 0xb86446c67c9f539e, 0xf2202ead,
+0xbd78f5f61c574e45, 0xcb0c51d021044e66, 0xa8927c5aa4f46ca7, 0x34d50abfec2fac6c, 0x233b8dd93e2967d6, 0x9bb6e7249b549526, 0xe9b1562a67855d7c, 0x1238f63aafc51db0, 0x76afda7015c439d1, 0x19c4e2e2,
+0x67ddeb14f60af1bd, 0xc6ef8db0c833eecb, 0x39258c366f5f5f8a, 0x8a752dd36eeeee07, 0xbeb9a01f2c9cc343, 0x3b8036b1569ac3a7, 0xb473039c24f8d162, 0xdf02e7bdd9ad8038, 0xe8dcf3596a01bff3, 0x2013b3f53,
+0x5a9043c6a173bdcd, 0x37404fa7c75d1da9, 0x8d2a797968c04910, 0xc06f9539e1c885b1, 0xfddb05e96fdb4fd9, 0x574adac1d902e2c7, 0x878bd68adb137174, 0x3530ac30b98731c1, 0x33d31eebc52d37b3, 0x13d306892,
+0x229d51264f404458, 0xa30a5367a18c614c, 0x99c827565210e7c0, 0xdf5cf896d99e1da2, 0xb153aaf6ee3c4761, 0x4c1e1dd0b66ffe2c, 0x246cf74255e8d19c, 0xa9aca644bdb832be, 0x6700217b72b3ea2c, 0xbeb4e7d0,
+0x2aa54deb72b5b463, 0x4e3960e61bb7ebdc, 0xf8ad1fddcb603fb9, 0x59eb3d54a4675a86, 0x6ca5f0d14799af86, 0x8e9ffd57720c32d2, 0x6fd1595f822b9f93, 0xcfece10aac68fda6, 0x25896263b0068dde, 0x2635c9e2a,
+0x1411e49f7b8b70be, 0x2b038812722ea704, 0xc030087292a99092, 0x19c4207bf9598467, 0x7eef597fc6376b03, 0x767cdbb97e5b5383, 0x82521e35c6efb912, 0x73cc4574add50e18, 0x44c7eb58518809fa, 0x1d4ee3111,
+0x89fcccb3483ed105, 0xdf76f50953e03ec0, 0xf81b85ab8b1c1809, 0x81d470063caa2f75, 0xc88c7d8675fca850, 0x96bfb0e286b0af87, 0x456e9593cfc36d23, 0x9e59310538d47491, 0x2c108f3a61503a4e, 0x1f6a4a450,
+0x141fcc1d140e4dad, 0x2fd9e2b6613c8fae, 0xe4fd896f461fecbc, 0xa1193dd9eeb41ca3, 0x88241b085551938, 0x39ba12e6fb1dee42, 0x925a470f8e6cef44, 0xbf320ff34383ddd, 0x33baeffd20a047c7, 0xc7b4ddf4,
+0x28b631b509af021b, 0xe98b4df82bbfc355, 0x69aac67c1d8610d1, 0xb6f20613ba902f37, 0xf433dbb30bd401fd, 0xc6fe6b2dcfcce76d, 0xe0ccf74098452e2b, 0xdb8de49b93d0f619, 0x65857f81f604c90d, 0x310748b6,
+0x365539f83699e67c, 0x4cf9261e0c1aff37, 0x1cd695a387d772f9, 0x9aa2f8aed43ed60f, 0xc5087ff672320ce9, 0x9718c07b58be418f, 0xf5f9854399f720e2, 0x51a2e502bbf3c076, 0xee3bdd9c8c40d8e8, 0x1893beaa3,
+0x8ba9db6385d2feca, 0x1d74161dd728b499, 0x903d90065c37a87d, 0xe73926c3fcf083, 0x70b4c9f6444d429b, 0x17beb88ecf3d0038, 0x3f604e29ba3f92ba, 0x7c18834394f8ddff, 0x9bfa0a29499a98f7, 0x22127aa2d,
+0x43b0e674bd5ccf4d, 0x270f51ad589477a3, 0x6b627aee106c22a2, 0xb498f15fd7e2bf86, 0x4391fecd9512945d, 0x6f0de5b434b45a5f, 0xd91b359a122a1cad, 0x472dacb9aaef7161, 0xdb855a8a9367df16, 0x115ac0edf,
+0x17ea99d9e544d133, 0xd9b64792c5801897, 0x8f63eb0ce279b6f9, 0x93d4856e18712375, 0xcf73f6f77c5f8a34, 0x689ac81ffe2374a9, 0x7a55a5cfb1fa8fdb, 0xe5b64a7c570cdf3d, 0x3264bec5fcf81a82, 0x283634be,
+0xe39e07b0e3034361, 0x623c46b0953ecc8a, 0xd976a55ac6265cfa, 0x4416d5f9eac05981, 0xb7e7ab0053875f6e, 0xbcf5aa6dad91c05a, 0x6929281b5f257c31, 0x446d88a07185e7c1, 0x3b0bc945c6b59ab0, 0x485f54b2,
+0x4d57ca0d4fca44a0, 0x29544abecf1de6b4, 0x6495f354c2a6ac7e, 0x9be8886c2a9565e6, 0x64a4a8b4d7c5d64e, 0x2ff5ce272f018914, 0x98876d9631203ca7, 0x7560822753d6956a, 0xaf5a091a65b9451d, 0x599eff77,
+0x3e565c40bd86419b, 0x412e18ff9395b8a8, 0xb41a67e1127ee864, 0xd671b5885af69ce4, 0x7e270b60d654fbb4, 0xa023544cb590fe2a, 0xe14ce2439d7e633a, 0x1cd0c68ee88f4514, 0xbca9b65e5f3acfb9, 0x19350056f,
+0x2fc245a2fca1b615, 0xc5a9e08951882aff, 0x7fa3b999aaad45e4, 0xc234d6dfa6a51f46, 0x9dccd84ce521b1ec, 0xa98e28c04987a2bd, 0xa69bf4ff23e18f72, 0xc57f4c6924833aac, 0xf972691538875c30, 0x2639a333,
+0xcb999476aaaaf1b9, 0xa3b25093cfce0cac, 0xc9a810f62a5934cd, 0xc1311261543034de, 0xf111b7799b1f0006, 0xae107d522fbb36df, 0x50921fb147e13f4f, 0xcac392c65d2a6449, 0x8b990f40d18bc6d0, 0x2d709927,
+0x691f7bd23ca3b704, 0x43f168e6199963d0, 0xc60d57b865ad29ec, 0xab4e19948ec3ed54, 0xc694bae6adc4efe, 0xcdf3b92ac294e110, 0xc24be54215b4018c, 0x975cf06ae6fec4ca, 0x8330e5b7361737c8, 0x6879b22b,
+0x12ec5a4fdfbcc700, 0x6cc2877e322c2434, 0x515c19d839f83e8d, 0x6d3209988cb3bed4, 0xc238256e00d5f67e, 0x69e438edae04913d, 0x1001973b911408af, 0xcceae10153aaf3ce, 0xc3098dfeadcf3cd6, 0x1d3c61fba,
+0x137d1328d1219036, 0x16e90b4b41e75d35, 0x496908ed57478902, 0xcd039a6f3d3ed1c, 0xa76ef6e9f26e9742, 0x332429b0c4145354, 0xadd4d2a515445d16, 0xc4f415f88ed79a42, 0xeb229764725e8386, 0x61ec2170,
+0x1d4050203bf65fde, 0x12bbf994f37d1b36, 0x2e9e763bf842b716, 0xee8d17525c1d71f6, 0x1f88e1bf3e4c35f3, 0xa4b331d385c88259, 0x65fc9e9db2f6bac3, 0x98b24af690cd0806, 0xbe04e4c70cd40b32, 0xb097d5e7,
+0x6cbd69f16a8fd963, 0x2b2b63366e454421, 0x8013446bd4830c04, 0x4d2cdcf06385e1bc, 0x4eb086f374e2b093, 0xf1fe14d6e7c4ecf2, 0x18b932499811d276, 0xb95bb371f85bcd6e, 0x2286b9ebcd2554c8, 0xf428a97d,
+0xe5aff0225befacdc, 0x5286fd5c0be52fde, 0x5c25fc63c377dc6d, 0xb4cec4856a213ccb, 0x33ba3b885f66acb7, 0x2f151ea688cc810c, 0x1708ccde235bc236, 0x688d7fe334eedf05, 0xa6ac7790b734d6a6, 0xbcfe7f68,
+0x28bdb909246384cb, 0x45d78d08e0eba3c4, 0xdb1898b22e5f2291, 0x8108a271ac63a695, 0xb85a5177fe8475a5, 0x11bfa44d5d9a765b, 0x7261f7eba90bc485, 0x23bcf426f7c7948b, 0x95d61c00fa8d0478, 0x1fc1d024d,
+0xc4795abfe7cfe306, 0x5da53012dd16f6f, 0x10a591e28fe54766, 0x6ca6fa569fcd6cf0, 0x83fe488be522f8c9, 0xedf381414a4a3075, 0x8740abb9c44e47e2, 0xcb37aa40a9fcac70, 0x51a1f7ae6df92cb, 0x12a38d91c,
+0x8826619066bce19b, 0xa8d65ea109ff5cfe, 0x42071e2a5c5723c1, 0x3db31377edc0c877, 0x7155c6edd0ca92a4, 0x2ea811058384b371, 0xed694ba240bddb72, 0x7d16f61666a8a5ce, 0xbd4a117755631e87, 0x1b6c46702,
+0x3b50080b71f7e978, 0x77c4ade26dd5d929, 0x2186149241a1900f, 0x1b4294200d2e4d45, 0x8e4d50f115b201ea, 0x1ec82966e9a1126b, 0x13268e3e267c9e21, 0x2de68e571e9a2218, 0x90d194f3975ed961, 0x1068cca1,
+0x9f0374571024bbc1, 0xe06c569d8e207036, 0x427720e06141d60b, 0xa471e3e45707cb94, 0x99900d47330f38cb, 0xcfc49e55972edba2, 0xdeb04c52c5fe6a2c, 0xf575243918250888, 0xcef89a59e35f69fd, 0x18519c18e,
+0x599aa8cc02e5d5e8, 0x604ff7e3ae5f347e, 0xca4e2cef15cc5713, 0x6c43cfe9e19b7368, 0xb3ced8453bc850a9, 0x5e49fc2aa6f3f1ab, 0x15650661d61976fd, 0x1f84283090762401, 0x47027ee3a9925ee4, 0xa6b173d7,
+0xb9c1d8b3a198776, 0x1dc15a25a75b62ce, 0xfdccf667fddfb86a, 0x69b812c7bce912a5, 0x27fa126e143ab71a, 0x962a4294128b9891, 0x6d82bf9819219085, 0x5e646bc650687f9, 0x2a6ce9ff2e329b2b, 0x389cdbc3,
+0xc8dbdb965f2886a3, 0x3465563ec8aeab42, 0x7771942d86bd8a1d, 0xb0b954428621bcc4, 0x4720902f23e41466, 0x52cc192f2c3af546, 0x86a76a841b32470e, 0x9ffcde8091de0ea0, 0x1ea144b9322f3b81, 0x10fe87556,
+0x6ba9431b4e8f7e76, 0xec4295e8e579d88c, 0x2d852d6739fc0638, 0xc80875231d2749e6, 0x2d278e0dfe3ac148, 0xc719af7fb2c5cdb8, 0x2d45b9dd1f5f8b46, 0xbe48bd36b862b02e, 0x51ad903e621372ed, 0x228810b70,
+0xe594b777bea6654f, 0x4eba4f19a5256607, 0xaa3f70ee7240c560, 0xa281318c9779054f, 0xf991d755cea8fcb8, 0x4317424f27cb8cae, 0x669ede30cb54ceac, 0xbb70a598c0185633, 0xfc1b0fdc27a138b2, 0x968c0da6,
+0x7aab04b1a92a500b, 0x58cf990253789c88, 0x150dae37430e1957, 0xb4d8c9850d29736d, 0x1fb504f5d5fccb5d, 0x2037e0f5a6e40f2d, 0xc9f1ae12c406565, 0x144699754d792660, 0xab9c71b56a2be4c2, 0xb7a26fe5,
+0x26bd8eab15316c3b, 0x4efc3484f93adb0e, 0x653cccec24f90644, 0x369c1aac29a99596, 0x49b79d8ce3e6c7a7, 0x61a6f7580d6db678, 0x4ff16f0244e96f95, 0x16fc424ce5aa8089, 0x7e148d4e363a0c95, 0x250ff4b85,
+0xbccf021482040da3, 0x585de3f7226c8a0c, 0xeeadf4c3c5e716e4, 0xb6fe2a6be83ef2df, 0xda35933b72734b9d, 0x1e369f917f7364b3, 0x355020550c7624ad, 0xa7438a1f2e4da91, 0x7f934e26b140b378, 0x5e1e3899,
+0x8f7c253b03e94c2b, 0x31c840ca44799e51, 0x1f23d1a1ed799102, 0xd1378fa7c7c20437, 0x4e3c8f9bf39e05a7, 0x37d0e115f496b79a, 0x58e1b12cb7794817, 0x7d0caa24e23ae9da, 0xb2886f5c8908e97e, 0x12b892b03,
+0x6384b9a2a8b5ae92, 0xfd75ac4e194d51ca, 0xeead27fb845f55a4, 0x79f58475da524952, 0x69e155ed192802a4, 0x9cc914230fecb9b5, 0x73b359cf6eb23695, 0xb91e40c6ba35406c, 0xcc513711b21553f8, 0x19b589fbc,
+0xacfed07a570fcc83, 0x1da55319397ad39b, 0xe526438eb5935c3d, 0x8722cc64f16af726, 0x2a7a545caea0ef84, 0x3fad7cb857d9c396, 0x7bbeea569c1f1834, 0x5083b6586b2ccfdc, 0x6ab1216d84450fbb, 0x67ab97f5,
+0x87f448b7b10c513c, 0x1726445cf5b2ec7a, 0x556ea317ebd36fcb, 0xe7a25e880bf7491b, 0xcabf084ef1391700, 0xbfb0625ae0cf41bc, 0xd726470cd18851c4, 0xd04874cba7c6724f, 0x9afeb6b7c2cd3a0a, 0x2243bca90,
+0xfd2e3de39d2ade4b, 0xda7617b06f209515, 0x35b0bd46e342d3c0, 0xea90e9c1d0aa5af, 0xa841b9935c254ab8, 0xb82e106b399dcb16, 0xca62c4c521a00fa5, 0x1cb769d5d8395e84, 0x661faa84baab6730, 0x1844bd753,
+0x19564650234693c6, 0x7f21d3485f7bc969, 0x32bb0878dfb32305, 0xc321cab5f85c6631, 0x47f0303ebc2ffe09, 0xe41a56825b01db00, 0x91da9f3b87cf6cf, 0x924861cde2d976bb, 0x4a3424295bd3037, 0x166162869,
+0x63426ab970f6c02d, 0xa60bcab0b8381472, 0xe79443f4bb95b4e3, 0xf39df0173425fc80, 0x62ad29b0b925885e, 0xe7106d1797520ba1, 0xe316fb1cb3917d09, 0xd7560170b270005e, 0xe887ce216c3e2bc5, 0x83fbaea,
+0xe3aa14cab693fac8, 0x7dbb3874b2f45876, 0x4c92c0bbe59823a0, 0x52592c198a53d65c, 0xeff67d0ed4a49445, 0xf2b7e94aa90993a, 0xaeeebe26bf952c53, 0xee6dfb17f292b934, 0xb985b325e1f380e2, 0x1fc2502c7,
+0x6b4d26ef58cb7873, 0xe94cd662c0958a34, 0xdec5328b9f2181d3, 0x6814a761ad5f048c, 0x6a682d87cac5f689, 0xe19e590c857430a2, 0x8b26fb911644607a, 0x1ae98acf3198037e, 0x3547702a723d80c5, 0x1bcd94270,
+0xab3e1c454fbd851f, 0x6931315144d93b8d, 0x1392ff060ca949d1, 0x39b6b31e39690ba3, 0xc06443866909bd81, 0x4367913e35483bfc, 0x6622428e13ba2f0, 0xdc47fcca5c43fd08, 0xb8112a62aa59de7a, 0xda0f9267,
+0xaa215d640f016c59, 0x4ba1eb60970c3c97, 0x69e06cf38fe1611c, 0x3b3de30fb55c643b, 0xe073e2ea9371b4ea, 0x2c89e661a8a6351f, 0x46ece6f7cb1bef2e, 0x54d639e2d2c53c79, 0x3c806c36e7b14b90, 0x1dc88f7b5,
+0xf5c9379f5dea017c, 0xe7180d3a42091814, 0xb05c4fd896aeb631, 0xb6e456306858ecb7, 0xc1c851f54fc24e86, 0xcfbc9287426a003f, 0xbf2234cac9828e59, 0x567195fb6311a9d9, 0x928e78ff9119aa8d, 0x24ad71ba2,
+0x9fa5c974b9131519, 0xa79e2d18071ce32b, 0xcaa134b8856f5a79, 0x45e6a4e1427221c3, 0xef89686e1a7824ad, 0xd147485f6bacba5e, 0xa8c09e0f636abd23, 0x77afc908372f4c83, 0x33236ee308f01204, 0x245a076d2,
+0xb1853f69d2b4dc23, 0x2a590e714f0c8c40, 0x8974224520b951d0, 0x9b151f5d3240eb3b, 0x78e2e5c172b48e5e, 0x3b8c494d4170c622, 0x24e10749470b184b, 0x798ea930538e67f8, 0x99e80375f5ef39fc, 0x2a2c5102,
+0xe334ff3afc73f73a, 0x27e218d6a7cd782f, 0x9166d739e7c2a2fa, 0x1e3cae4a11d8f597, 0x7ae695c8e9544cba, 0x3efa8b0e42f69434, 0x978285d5e4a4c207, 0xaca0ac34fddbd506, 0x298c54e701bd0171, 0x1c452194c,
+0xf4ec7c7dcdb0542c, 0xef3218141db57a4c, 0xd847342bf924ac07, 0x8b9d4bd63e36300f, 0xeff1ed70f5805674, 0x95b89ede00b81a7a, 0xfc76697e43d9a36, 0x93cb740e99f072fc, 0x99239ef6f329a8ad, 0xb6013fe1,
+0xc782dcde6cb5c4e9, 0xc1eab4d876b3ad95, 0xa8b98ab759f4862d, 0x22d0a8db03ca50e, 0x5fd05e4798ff00eb, 0x459e163b1711b930, 0x2420b2aa97d47e4d, 0x2a0e9f3414cc65a8, 0x7debfb6a94e28787, 0x126a53ce9,
+0xe484e18b0f769a6, 0x85051479fe940adb, 0xc5aa02fb71eb31d6, 0xcd43d97175c53b1f, 0xd060b9c95621c948, 0xa95dae833208734e, 0x63745c1abcea3c6c, 0x24883ed39c63af02, 0xe9c0c091d86304b9, 0x21e197010,
+0xbd4eacd86fd9cfa7, 0xf7731ce401f17141, 0x75132fd4c4e9482d, 0x8dddea1631253cab, 0x8064b303afef236d, 0xd0c0f524f9fd05f7, 0x16f28b5801fe4b2a, 0x7643d62d7e713c76, 0xc7d1144ee28bae3e, 0x156170fc4,
+0x1112c5b4d3f31660, 0xf1d72f69ce4df49d, 0x45073ba6551475d7, 0x5e11d8cec14070de, 0x1c05d960ad88faf9, 0xfcb0d68b96fba836, 0x7ac473bd8cc483bb, 0xbc184a145cc57acc, 0x1f617fa7898d5d51, 0x110238141,
+0x82300d19a0d1cfc0, 0xb01f8173d79897c4, 0x7b3fdb54cb7af611, 0xa85ecea13f7ae1d0, 0x4309552b1ab04225, 0x7995c5317d67cbdc, 0xb9d601885a4a1c79, 0xa30dd3a2f1a227b8, 0xadd709a290ea3211, 0x226a30c37,
+0x9f305df38d4e6527, 0xe44883a89bad4526, 0xb2fdb1211eba2223, 0xd59ff5adb3063403, 0xc29145f3b518a585, 0xf5700ccb1de31ffe, 0x7aad0d1466a62b6c, 0xd18fb540cb001bc6, 0xb0c2ba83d34a2461, 0x22dcb175e,
+0xc88688a2a7d6b657, 0x5a07c2f8943d3bdd, 0x586a6e68cfccba25, 0x3a0de7e4cadafcc6, 0x16fab3a55b2f23b6, 0x6b46294a3f25897b, 0xb9d8e63a12aeaa74, 0x5c098c229316c763, 0xb90830a6b7fcbba, 0x97cfc1df,
+0x252b777b2a0fa63a, 0xc19341f0889e29e5, 0xfbc28ffec43cc3c1, 0x7b4964fba7075f87, 0xafbb93ad315d5b58, 0x415cb6be8a066e17, 0x6f94856f2ec4de4b, 0xfb0de4311cb92b6e, 0x4dd55e8699fb5389, 0x120c94708,
+0x4e29c660c40488b3, 0x596555be744b3e66, 0x34e654a992c1ad31, 0x861789b640cf34bc, 0xbd91404c38845d3a, 0x83e8fdef79a67c52, 0x81ce4b7cf1bcf519, 0xdbd64c1007eebbda, 0x14b507612446cbe9, 0x17c11ba49,
+0xe5d7f0894491d9b9, 0x3066bc514846c302, 0xda985531d03fd2da, 0x6875a505ce91c5d3, 0xe9192abc2c99e68d, 0x169c3157b6c6d39e, 0xd81f515934e7f307, 0x2b739241b80e3cdf, 0x3ba6cf4d2327dcb7, 0x37be03bc,
+0x27aaf5bdb67609fa, 0x6e2c7c71b9928f0e, 0x854eafe823cd0bd8, 0x7671d1df369290f9, 0x8bfebeb09c459c52, 0x1f930dc0659f184c, 0x66a1817fe5175501, 0x2a12c9edd3afb927, 0x25cf888db32ed821, 0x1f9fa97cb,
+0x82c4049db85c7643, 0x457aca61944939de, 0x4141ce6a1f2d036f, 0x63d6d15994352e3a, 0x35f693ad240319d1, 0xe40bb4a55dd69f6c, 0x49c2790c5e2a9875, 0x12aef4c327474f4d, 0xffd45184c2d4326, 0x163900647,
+0x6b0b2c76ceaa5a4b, 0xb1df27789cea7dd, 0x4e095d561590405f, 0x2d821b98564b8331, 0xa5389d1ee3ef95cc, 0xd48d447aaa951f6f, 0x4fbc892b4be06488, 0x10da6b6d77bcc1a3, 0x49d01b8e797efe54, 0x124ca1c9,
+0x940217aab65122f0, 0x253dd7e14c321057, 0xb21bfc2dd28db3c1, 0x3c7914d9ea6833e5, 0xd52dc0876d239b51, 0xec702d2e0a161901, 0x729440b81fb2f9e1, 0x990745370741659, 0x4b0a6a477700798f, 0x45764ca6,
+0x40b6d39f5215d81c, 0xabf92451309ab8db, 0xc3b25162d867c6fe, 0xf84a282c8075f143, 0x5d4077de286f483d, 0xc1b79bcaab4947f0, 0xee49745cd4b1a39b, 0x2bf1df9f476fa00a, 0x40bb1773d9fde1fa, 0x21a771832,
+0xcae82c4dea6c988f, 0xf24e16782ef06b7, 0x9dc8151a7afd2888, 0xf86ec0e70060b530, 0x6d8b5555c5bedde3, 0x30885c23e6e10580, 0xa49b8343875c8d5f, 0x93b2d068cb9cd3d6, 0x752af4d7cbd535fe, 0x250707f10,
+0xd9bd73183599ec61, 0x29c99e14b57ee9e3, 0x96d7f9feccd48ba3, 0x725c486d28ef38f5, 0x74cf0b4a0e083093, 0x223e60351e86e2aa, 0x865341c8e546ebaf, 0xa9c58c03f99aa11c, 0xe5eed83eecc37d7a, 0x94055223,
+0xd22a470106ab7fa5, 0xd99724cdea4b412, 0x6da75d184847d647, 0x83190b6262609d42, 0xeacd6a5c9f6b307f, 0x9e7878c33f934fb3, 0x43054d3c66a38ad4, 0x4f12faacfd712d, 0xade63988266b24e5, 0x20c50243c,
+0xb432de4f0c4f5dba, 0xdd882a4a2ab66b3, 0x43d7e9169c12ecc3, 0x7b4c02a95367f585, 0x4cfd3095f5cfd8d5, 0x6c924f8050a99b96, 0x4d0c34b9302d2296, 0x19ab983a55f4f3ee, 0xc437805ba976d4a1, 0x1d3da0de4,
+0xf791caa769136362, 0xfbe951d54b55110f, 0x506fb3187369dcb3, 0x2d89aa8454e0c150, 0xad4789d5242a225d, 0xe1dc2f867b41cd99, 0xb8f31cb67a87c024, 0xed12d1ed8441dfda, 0xaa849a73b2a73907, 0x12fbbee1b,
+0x90a4a9f302c8270b, 0xd03e75c1d0b357b, 0x3b68ddff322123bc, 0x63d4589ad241a993, 0xdf4e495975de0481, 0xd1764b4f263054ce, 0x9663211ab458a1c3, 0x24778c00b7a2f15c, 0x97447f68f610b9cb, 0x10e4e20b2,
+0xf15cfaa252164ded, 0x49e5165cf0bbefad, 0x210bf450bb4e7071, 0x9c4ac54968d7f377, 0x735215bff4e16e2e, 0x520d2de2a4481e8c, 0x46333c9600378950, 0x2c819928a3e46189, 0xf82ccce2c490aab5, 0x12d631b58,
+0x69c4d46a1e4e3851, 0xc26535613538d5e6, 0xf210418be0a6d38f, 0xf96d2e4c2454767d, 0x68f9f68fbc8c8853, 0xbe45e1e4ad8f4e3e, 0x8e8143067c2f6125, 0xf447f46103e338dc, 0xbc76f98e3c42769d, 0x10e0dfa7b,
+0x8b68ec6d2319d215, 0x8c8f0640599bf786, 0x62925df455d96329, 0xfef266b6940422c9, 0xa67c63741090abfe, 0xa6ec973dc7a9e137, 0xa00b78ab3b4863ad, 0xd567f92edf355a65, 0x3654defbe34c8846, 0x1fd917262,
+0x43adb616a04b5ade, 0xcfa36c06faa363ad, 0x58bd13a61287009a, 0xebe8abfee840366, 0x3a242c288b43d1d1, 0xa16acab9553a7d1d, 0x136663f2fe207fb8, 0x6b889610dc409eb0, 0xe4c931108b306004, 0xe13de10,
+0x9f368393f44f70c0, 0xb6a3b45169b6e917, 0x8c2f3141f8515b22, 0x1be3edaed3a2ca67, 0xba9ca3e6f569fac9, 0x62fadf93fba9d7e2, 0x852eb9ccee7b2fbb, 0xc7e56e1169146eca, 0x8c05c6fb145860f9, 0xbec38b5c,
+0xd825edca5c23d18b, 0x894a0ce680c8ff4, 0xecd20de0bed35bba, 0xb94bee5d441538c0, 0xca01bbb9acc067a8, 0xd93b9b34fb83131f, 0x55182a18bbce0724, 0x8e80f296b26bac49, 0xa6c48b33e92c1e0, 0x1b50e78bc,
+0x200269b60d98acdb, 0xf0cefbc29d88b0cf, 0x2b85fbeb47f70054, 0xab3f34172b031207, 0x7e2cfd4382517cf, 0x72540f2e33534947, 0xb05a0c41181cf899, 0x554ea1a3445b26a1, 0x62480b0a596ab7d6, 0x23937be27,
+0x9ad597a880d68395, 0x6e60b7dcb7638c51, 0x5628e98176c9caf5, 0x3456c6a3a7f350, 0x9fe386b82ef27db7, 0x3dd3b6b039aac5fc, 0x8a1c19eae869156c, 0x9fe434ff2e1b28a7, 0xfb548c24515ba3e9, 0x126b8c759,
+0xaf4a09b58db52c61, 0x6523c55cdd5340d9, 0x2efe4a12ce1c15c2, 0xbb90f3a2f613d766, 0x3bf1fef51c42f924, 0x4e26206e9bcfb9d7, 0x1760d16df6318625, 0x87a3f5c51fda4d8, 0x412e06532c71df5e, 0xa7492dd3,
+0x56d318e238c2c9e1, 0x278a3ccf2d02fe8e, 0x49ec4097c281d4b9, 0xd81158fe7eff9a33, 0x8ec38104d2110936, 0x97999277a93eeef0, 0x420014ca1c441026, 0x5f03aaa97e783fb2, 0x708e8119ebfc96da, 0x1690efcc9,
+0x5ff3357ccd01a5eb, 0xe66840d5b3bf4701, 0x1cafc2d0fe28bdf3, 0x6570915234118837, 0x5c73645e38acd890, 0x988890f4785a1485, 0x5614f41359d43cc5, 0xf68baf1e9fa0bba6, 0x2f8262920524f878, 0x2776a6105,
+0x7065e3e098c1b253, 0x3d3ad8c47b2374a3, 0xb04e3d7209cb089, 0x3dc4837a0d0b0153, 0xb806abea8a2ee6f3, 0x7ae2b82a7f6e0097, 0xccf489d04c64d85e, 0x5352d03e2b570010, 0x4d8daaa7587aa4e5, 0x25666ab05,
+0xb071d13325ae6c49, 0x4452258015fd46fa, 0x55901d95ca71a584, 0xe01fdecbe9e96879, 0xc7bd3ea4a446cdd0, 0xe0baa7a8686bc1ab, 0x8e767153c24f4e47, 0x74a298443ef8cdc8, 0x84da480564f41f28, 0xcb89d233,
+0x3c51130373d74a48, 0x78205c019d7ed6cc, 0xabef676045d5844d, 0x6eca0067888de4fa, 0x6628acc77af07ea5, 0x770a1e639ee4762a, 0xb81df3da926e4530, 0x882659a22931347a, 0x85461510e75d9ff0, 0xc5ebe86b,
+0xa56a9eed3392b26b, 0x9b7a7de6428beada, 0x8787db9b9de2b8b1, 0x6ff6a1ba9af1c604, 0xfaab038a07775689, 0xe9c2f82bc47521dd, 0xa70619225a10490a, 0x52c0f824570ea676, 0x8caa95010b119a96, 0xc4b31c36,
+0x2308cf4a83a8596f, 0x52dc0e473374600d, 0x946ff6bcf102d373, 0x189106ef713026f3, 0x3633294ea222af70, 0xabff1ffa2c0ef93e, 0xecbe21afff505df6, 0xa8e4f37b2b4ccfc6, 0x18933a3cbe16d5d0, 0x1e0ce57e9,
+0x545a2e21209fbf4b, 0x89181268d9fa762e, 0x38cc8f2fd20676e2, 0x5edcb0e5c3eb9e18, 0x92996a923f9a2c3, 0xde463c5940da671b, 0x9774cdf3d0b40440, 0x618951b262a6ce44, 0xa3270738fbbd2bae, 0x914ce71b,
+0xc197b022a351a23a, 0xed13f03eb92f8331, 0x17106415536f2708, 0x52ec87135eceff50, 0xb3307c3934caa509, 0x8bd048e335bc75a0, 0xdd7f8410636dfc24, 0x228e16a7348a7682, 0x8cb099949949dddd, 0x15fbc3b79,
+0xe69d1b461f2dd9c0, 0xc90140c699fe1258, 0x2f4b61d91089ed1e, 0x951cc0f32ed3b838, 0xfcd98f2b24af1fb, 0x151a0d11a05f61db, 0xcee221fec85bf004, 0x8dac01579313ac81, 0x8c588040bba199c2, 0x8321fac8,
+0x6641c80f3c39d820, 0x68f81f5d19c78822, 0x23f61f1164815f91, 0x6952f434998a64c5, 0x877853f9290d2fa8, 0x5b5ab28c28bce6cc, 0xd3b901fd9d60e21, 0x850053694baf30ff, 0xb05391fed4661110, 0xa2ddf805,
+0x72195f0af6f68ce9, 0xd2e129c84adf0ff6, 0xbca17815be5badca, 0x7330e20e22907c43, 0xb99ff234c073606e, 0x55db9d7dabacc4e5, 0xbeacbbb8edd331d8, 0xa424459967eba69e, 0xed5c696537e57c91, 0x17ed0bed,
+0x75ba29226471784d, 0x9b5015a217f3ecd2, 0x850e2c6fea267308, 0xf36f6d9bab0e002f, 0xa3df29cf19dd8a5a, 0xaaedb92bb1ac261d, 0xe27555f2e4eb2393, 0x8b9dd5ba213895d6, 0x6bafd2597735c3d3, 0x13a41a225,
+0x952110efa40a474e, 0xc57f854ecefc79da, 0xa81cd4e35807a6e3, 0x355192a91abc3945, 0xa865ff1747f43aa7, 0x7086962787b9e3a7, 0x2858c8d805541265, 0x479137d1a21fda3b, 0xd5eb21c19cc58ac2, 0x160e2258f,
+0xfec03f436c95dbdd, 0xfa996f0b215b7094, 0xfdc2d0a5882d9a18, 0x67b29469048fe30a, 0xa6cd21efe38da4ae, 0x3fa2abc711c6c9a8, 0xeb201063c5592f3f, 0x805f1494d06ec227, 0x50cb7d7e258f5f04, 0x178b9bf65,
+0x774ae5159d096027, 0xff69fab93a8d7727, 0x44be34b6d03a0f7c, 0xfae1365a3018bc9f, 0xcee8a0a5bd799e32, 0x3c6c0ebeb42b1b08, 0xdc96a75bcac79149, 0xa64be8ced2109ca1, 0xc2bc0e034197f66a, 0x2748b4cbd,
+0xb94f87541e108a84, 0xf77ecfd07a63b6d1, 0x948dbcfb1a0af050, 0xd108375ceac593f5, 0x1532008128b8ee6f, 0x29777640a1fec250, 0xfa7622de59814fc7, 0x3ba1d0213716a3d9, 0x5ab9831722df89c0, 0x25decd08d,
+0x6697319b68effbfc, 0x825d0ad60aa78966, 0x51b8d55951837598, 0xaee66b2169a202d9, 0x53892eb1153e1bcd, 0x13e3b5b0f666c711, 0xc49e6670d0cb1445, 0xf154a8d045357955, 0x60e0c044fd7a6ab5, 0x209280b5d,
+0x438c46aa028b6e22, 0x76144e705c51dff7, 0x58bbae66bfc74bbb, 0xec83087d5958ae36, 0x672d69ce57086a8a, 0xf905262075c621f7, 0x26ade29282d6d011, 0xe577d93db0661ff6, 0x865a045fd30715cf, 0x181f3df87,
+0xd00df487f148d9f7, 0xb44ab019fe7eb214, 0x2f3c69e65f728513, 0x7f3cd11d8acb5d9b, 0x236a6695310e1dd7, 0x965e0f66bec15c23, 0xff7aee5db4a42709, 0xfe2972c69f79b42a, 0xbbbbd9c012123851, 0x1b545d7a,
+0x74431e2bbdae643e, 0x7ad3480d83094cc5, 0x51b1a43cbf411494, 0x8cc908fd992ec1d0, 0x5bd2300f31b03c60, 0x32f7dc1d29c239a1, 0x235693c25fce6b8c, 0x984af12ea06bb482, 0x9a42d27c6f0a72d, 0x8c53e6f4,
+0x3e60a9843d70f60f, 0x87c4d422d4bdcd21, 0x9ddd13f56884960b, 0xb46244c785049c77, 0x22c52250b326691e, 0xd5395528fc894764, 0xe50b65f75e0cd685, 0xd4f1c2fae8639dc, 0x5026265ef579901, 0x1cca3e4ab,
+0xa7b085c102a28d3c, 0xc53765c68e46f442, 0xc0e76492b9e4755d, 0x82e452c5c21c24d0, 0x737bcd7905989faa, 0x5cda6f59ba54003e, 0xa52e707b2b0641d6, 0x4f989a1c9734206b, 0x57f354499453b094, 0x20e59168e,
+0x8f1709de94e8a44b, 0x834db5de04cc580d, 0xdc07fb93a8543590, 0x81d6c164c3cfe777, 0xf4cced8c325de1d3, 0xbeb3ca1db541b52b, 0x510e1bd088be2832, 0x6f7b7b00d5c80324, 0x88563c199b67c476, 0x1bf0d53b5,
+0x4c0528e42853946d, 0xf39882d45e7fce4f, 0x208f6ff5f9ece9af, 0x7110b025090d7b3a, 0xce7f9e2b0b37b9cd, 0x8c73fd2ab6ee40c1, 0xd37669bc3d6de898, 0x5a707e7a4a3df00, 0xf333b45cceaaa1e4, 0x32110c0c,
+0xff553a114014e873, 0xdcc320fc6efbbae5, 0xfb366810979cb425, 0x1090bda27f596652, 0x5a891f911f82d283, 0xa781987aee7213c3, 0xba1e3c6e6ba77281, 0x3e1d3d13583cbcee, 0xebf791074818fca8, 0x22e777470,
+0xa86fbc26c5ad4b09, 0xe845037a88284af2, 0x6e9cde0675c0b8a8, 0x2b57b9f706968302, 0x93ce5de9fcd47780, 0x4de8f56911f8ee70, 0xa78f71ff4255e493, 0x190e04fa82cc474b, 0xc85d1005bc3544b1, 0x854ff6b2,
+0x826b0d805c8a0fec, 0x44cf2e0a9062b952, 0x86026f082054e992, 0x50b0f7e64053d58a, 0x527981bca267190f, 0x8acf3c803522b793, 0x2711f5cb068fc3f1, 0x1c3c731845c8e28a, 0x37f7893581e0831d, 0xa4fd7478,
+0xaa557cff9066dafd, 0xa3450d4105b6575b, 0x5e03335a4fc2c151, 0x4b1c4262d4da3876, 0x12de8a88d135284d, 0xee4d58760c83986, 0xa46ae23aa14bf672, 0x5b8787e2f3467a0b, 0x1a2d0b41289e4b66, 0x150bedad6,
+0xf360f8683960bb5b, 0xccd76e370186e73e, 0x949d1cdd7ce95849, 0x6735c5b62aa51e40, 0x27719922cd227c0f, 0xabe31c91e9fa8d55, 0xd69a1ade5218f2ff, 0x37cbdadc0969c8da, 0x5cd1cd70b6a72fd8, 0x1af5a4c2a,
+0xec5f4c4aa352dbc3, 0x6d86de39db5582e2, 0x6c1baaacc11fa77e, 0x4994dc856cc60824, 0xbcd2eaa0cb32728b, 0xba807e6d48dbc9dd, 0x83ee8fcc63044383, 0x4a21389a0e309e55, 0xb60eb8e16e631ed2, 0x12b8cf05d,
+0x98c6692da62eb9dd, 0x453d7f485d848bd1, 0xeebb503538291f55, 0x6599e255395b25c7, 0x8ac173bdffeaea96, 0x906232cc61911fb7, 0x114b186e31ebec9b, 0x39ce5b81e26e5c03, 0x93a2a941b98d081b, 0xf8032362,
+0x650892a4d1e748d1, 0x248815e59b76aa20, 0xdbafa3cce9286e45, 0x501a2a54740aed7c, 0xc18763c376d9c14e, 0xae2c5de412d74ad7, 0xf2efe5d902f4252, 0x6332cdaa5cd52c7a, 0x9893a015a906650c, 0x1a98bb6a5,
+0xfc54368db56e3943, 0x5f44a747aca5752f, 0x63b6a05c6c5e8878, 0x9e45e0344b20c1ee, 0xd71ee69c5abf925a, 0xb584ef4170688176, 0x93279a2b0eb6d96, 0x588a67766c9a159a, 0xfc4d9973dae71b37, 0x91b93e67,
+0x672dc786b2a7ee02, 0xb83fef28723422e2, 0xd2fd51a96163f2da, 0x2af6c72492c36dc1, 0x320dca42fd152064, 0x385bd2a6baff9f8b, 0xfd7e07fccc17d616, 0xd291d341bff9e4e, 0x588df9f9b6e61aa7, 0x252c9ffe6,
+0xdb1cc408fcf2bda1, 0xdf2223d043dfe78, 0xb948bd235feda1bc, 0x6adc6da366f62124, 0xfd6dc845db64bc9, 0xd64c644df0ca42cd, 0xca43033dd2c98f20, 0x675feb0b011b2d09, 0x8d85cec7ad814d48, 0x40f971c2,
+0x99c01c4cf0bf831a, 0xf19bb16d70d2e40b, 0x9f2d0f6120228c9e, 0xabedf0619c9aebfa, 0x5fc508df57b521f3, 0xa40fdbfe3377f805, 0xb1a7a536f5c20456, 0xa1af191f24e1d3a9, 0xcadda7d12d0a529a, 0x34e8abac,
+0x41fb8be4c60aacf0, 0xca646a1bdf53365d, 0x5cd337864aca570, 0x86fef6025070c3cc, 0x423aa07ffe0ebf9b, 0xcdaed26ab8aa5b01, 0xf1b694ed01e163c, 0x474e0019901ab1e5, 0x81cc1cf3fab9ab2a, 0x9df54316,
+0x44062ca63053f7b6, 0x1f8fb6377fc36eba, 0x2b85edfcf533d7c4, 0xe12cf37a7665f932, 0x17ebb6b0a3bf749e, 0xe7851591d3c90532, 0xa81db507ab3d3d60, 0xe6ea440cf6a73a8, 0x16c9960927b2831f, 0x1efb5110,
+0xc28dfb5e624e103c, 0x1d24eb1f8f17245b, 0xc704e42eb4078bcb, 0xfd2bfa881bcbd1fd, 0x747275fbc75fe3d1, 0x25873b07c0289033, 0x734f99c393a382da, 0x77af2ec88982b917, 0xb07350f228371fd3, 0x16c8528d9,
+0xe47b86341d216057, 0xe6afe1b648607f93, 0x19577c7086eeb557, 0x373ee9e701c98719, 0x7b0e97d71aaa1e29, 0x6b333633b6b7f539, 0xe3cd03c6e35c9c31, 0xb8fd6fc3b4209b0a, 0xe57ccd1f3082892f, 0x274a8a25,
+0xc7b5521b0062d4ea, 0xe4c3727ab0c1f1cf, 0xf909fd4abbc35bea, 0x9399b3f92030b31e, 0x3af74eea1fdd5e84, 0xa954e2e3dd857cd8, 0xcd49d44e883d5cff, 0x78ba6f8b57f8dc4d, 0x849b9a91d2a95ddb, 0x1e2a1946e,
+0xbef9c105f9d22661, 0xb616de1fee23290c, 0x64f3c45c7833effc, 0xd4be1c0e5fe2d90b, 0x4e5d4c47a41c577e, 0x5f451de6f4a49c5c, 0x3f22f8e893b4bcb1, 0x579db904f3f4d6a4, 0x718f5f499d716a50, 0xc7b5c36a,
+0x8566d5e10e1ce34b, 0x7ce21b4eb37422b0, 0x93372906b803759, 0xf9b9cbb2aefcdb58, 0x12452e94dba1b50c, 0x8ab350b77ef244, 0x4adda2c516e7a827, 0xca49ea8c6c9d52ca, 0xfde2db60d55627e3, 0x1d08df55f,
+0xf94df508a8f67089, 0x4fb2d4c52a045aab, 0x1d4d07ceb20de9fd, 0x50ec7150d510e02b, 0x2c2aa81ebc48d5fa, 0xb60ed50f34bd3a6d, 0xb092f7db2c66415b, 0xe35c493d75253858, 0x6cf9daaf5cb8e195, 0x15db7afab,
+0xf90a043fb085b204, 0x38e19d8fbc99d67e, 0xd50079ac3aaf7540, 0xc3ba64d9738353b1, 0x528feedae399d15f, 0xfb60f080dd2c8347, 0x5f2ff745241743f9, 0xb63682fc879bf218, 0xaf7ec455b51ba001, 0x234a1b519,
+0xfb4cb2c5cbbb607d, 0xdbfca2e88e23946, 0x5cec56e607347e0e, 0x683d26866047b643, 0xb105a3b3b9783e9d, 0xedea825e986dfbf8, 0x8276f73ed1b4dd7b, 0x32151653e8309740, 0xead949c39682ffe3, 0x10fd2f6bb,
+0xa27b821c1b6327ee, 0x6c53d61f0f47ae6b, 0xc3ba251d26e10201, 0xe1514a6bd14a5b00, 0x58fb4d65d9656434, 0x5662acc53f3f16b8, 0x9c530da048eef207, 0x1d0133fb3472a164, 0xa3c68025d41fb888, 0x312aa9c5,
+0x3327d4ce454ebe1a, 0xb0d9ff9c3b3e16bd, 0xeee20c6823124793, 0xe159e239ce69325d, 0x41335cec677734d9, 0xe00a331a0d537b6e, 0x988b9140a9c3f6e0, 0xa1b9d23780aa419, 0xcc0c55832d1f0457, 0x6c58b72a,
+0x115eec99f9291b2f, 0x45e0d18d3d9c87ab, 0xd63660721d897b2b, 0x8798d55379eda9d1, 0x76720b9fad4bcc71, 0x79603c6c39231dc2, 0xe5239ed740e02f54, 0x11d0bb711cc84ae8, 0x3bcf11a9a234f5ba, 0x1e5286105,
+0x1cef61e75de82694, 0x6c1729f2f1033d6c, 0xd5d5ca41cbccad4f, 0xbb4c13b77998a982, 0xc8969daeb6d5c5fd, 0x46be82e3a5f8f232, 0x4afd5c0951ed157f, 0x611f4a42358fae40, 0x5924230bad7b1049, 0x46479db1,
+0xf8622469f79e8004, 0xad0196ee46a42471, 0x8c114edc52c63773, 0x97c75bb0e5656f91, 0xdb31878ec5b5ea4b, 0x78daf75479880208, 0xe3d840da10fb840, 0x1037fbc122ef73be, 0x145294f370b5805e, 0x27aaf72dd,
+0xcfcd342cbba43641, 0xca7a9e6b7871c735, 0x2d9e9deaaa145685, 0x21cc0d8a204a8f94, 0x1781ffc5b919098f, 0x631d684632fb1041, 0xc0bb81d9d5c84b27, 0xd2723f3f130b2001, 0xaa25abb84f0b4448, 0x1f611f5cf,
+0xb4f86f72c2a0fe33, 0x27a5b0f31cec0219, 0x8add03e56e7b2387, 0x570299fbd700ba74, 0x54afe7eafd1f8a11, 0xe8a7bb86bb254390, 0xd24b8214ce8cc4c9, 0xa5a8e84e99c83fb1, 0x5554d1cc43710ee0, 0x1d3c25900,
+0x9134d898d9b78c8c, 0x766f7d8eb69ca6cc, 0x20f748d7f3cf6983, 0x23ca2e705cc80ddc, 0x1d44e632196037e4, 0x74c6ee701816af30, 0x97e07ed4bd009f0b, 0x60610116bbd135ff, 0xc652a695baa9d2ee, 0x13ba95a35,
+0xc660867ba085ccd8, 0x7a130c35d9b311b9, 0x7e7e8888a667fad1, 0xcda97163ba965be7, 0x9f1ca156db7facc5, 0x2386345d943558f9, 0x83461bdb9ada0f0b, 0xca233359fe71be08, 0x35d399754a098f8b, 0x2f23779d,
+0x8574eb0c761748b, 0xd0761d1781038ac6, 0xdf0ef042958d4be9, 0x28ce3f6cb7167136, 0x4b5e536783684b09, 0x52dda7e9885e1959, 0x363d20e984479280, 0x403e420632c9034f, 0xc9b72ce8b3755136, 0x2287b80ad,
+0x914059b477764011, 0xc3835cf83526753, 0xd4431896461d7d63, 0x2f6c4e4b3ee68bc9, 0x61a94792e870113f, 0xb63c2128eaf4f6c5, 0x4e4872d4d718d50f, 0xe7a622dfcfdb824c, 0x7df14312c84dd76a, 0xd16a638f,
+0x411fd18f7f2619e4, 0x4ce2feff832f2aad, 0xe7a95f3c5156028b, 0xd0016b5e1eb2a637, 0xba96222848e94a01, 0x51fb8f36a21b2534, 0x727f55da3e5a6a6f, 0xf961483e3136a130, 0xdfdb72ae73eb4f24, 0x820780e6,
+0xc80dd89033db3c81, 0xdab5c3d0e8e6901, 0xe8fff65c044de83, 0x4127882c0b3444f9, 0x77402f4cc67fba2e, 0xa69375a3b46d58c0, 0xab303b6eb05c51ad, 0x102d6201ece04141, 0x281f3a7d3322de33, 0xbb285538,
+0x3673193aabac5cde, 0x9c809a166512916, 0x156dc4ecf07421eb, 0xf06e64b2348a0a0d, 0x9be092a3b757b044, 0x8de637fb3c087419, 0x972f79871b5d5804, 0x5b5912a6ea22ddf0, 0x8efff8ce699efb83, 0x95f4af78,
+0x15081d581fcee229, 0x13d6f3c7c75e423d, 0x72d204a1785b2d02, 0x2fbdbe5dec105baf, 0x5c0420a49bd9f627, 0xd795a972d3fbcf86, 0x54f22cac98978425, 0xe1999c72163b590f, 0xa5b162f9747979d2, 0x25cdfc414,
+0xa2aeef981c8e5b61, 0x7ecc4162927e3394, 0x7d551157ecdbcda0, 0x209d820de2bd6ac6, 0x17766ab88d3a6838, 0x1c2b849c580c0720, 0xc8c6cff13c50b1ee, 0x249f79d5a91c9848, 0x8ab94064acf16615, 0x48c26c0f,
+0x8a5f74d491a0ca94, 0x26caee7aa9cc750b, 0xf4904b3bf3572b65, 0x10dd6cdc1f0aecf1, 0x333e2d46cd841117, 0xa9e69a34a9effd56, 0x44529c2fbbc30138, 0xe50efaaab93c54b1, 0x9caa6c8a9b8cbe66, 0x909d9f51,
+0x872c96c6d30ab971, 0x3580b4fb097d2af, 0x214e095e35e4e9b9, 0xc9f56eef9ae34aae, 0x8a67420097220a54, 0xc2a3d9daa47c0465, 0xa03b2c276043419f, 0xc94ee1369dfbe9e3, 0x8beb931822399baf, 0x6c22104e,
+0x23977d4650363d12, 0xd3e5a9b05099ddc9, 0xea534083faf04e16, 0xa384b5f7bba0a810, 0xf2c6529b9371bdd4, 0x7d46b9dff5d93757, 0x96717acfcfb5b060, 0xaee46f52e3c2fcd2, 0x7ea7fef79e7466b8, 0x1d44f2507,
+0x85a97c2002087cca, 0x8622139810893688, 0x161322c7455c94bd, 0xd8cd7cc534da9a85, 0x9d074401bbe28c21, 0xe5736aa103c96f6a, 0xd33803daab4ac6c7, 0x7c582c9072d22623, 0xb1bfa4edb97d4d6d, 0x1f5e74dd9,
+0xc583af900f8c67fe, 0x797eef9e566acf65, 0x19f0dd401f988767, 0x7625e34e15fc70e1, 0x5e3265876aeed8b0, 0x907120f1d234c229, 0x238079dfbd2ecd0d, 0x36cb031cf020759e, 0x1f4fadef098cef20, 0x144d4256a,
+0x50563f50eb2f0d4a, 0x7a3fedc13a067ba2, 0xe544d08537bb7f57, 0x13d3974795878b30, 0x90e6c419ecb69c75, 0x7237a4365bbc3b69, 0x1c4e2b41d1919df8, 0x90c2c39e9b0a45fb, 0xf0604a2aaaf6d65, 0x2247bdddb,
+0x86966f9254e409d1, 0xc8e081b880702ac0, 0x7a781ccf6f409f73, 0x5d157fe9da700d2, 0x429d3e1a240735c2, 0x161405c0e28f0bd1, 0xff5de7c968883aec, 0xb3cb6ebffeadba20, 0xdb9ef22b2ee5b9f4, 0x17bbc926b,
+0xa574bd355744790f, 0x8f2ac1b23ed9d40c, 0x6dcf5dc28a9854cc, 0x4e8d7d729b9da84c, 0x2886a79f7344c9cf, 0x7779c91fcc95aca2, 0x818d81f909414f1b, 0xa98082e7f47de3c9, 0x81c6dec676e65e9c, 0x207a70463,
+0x757a568ed352e313, 0x62e9ab846592718c, 0xcc811e922888edc8, 0x2a665dca51743d23, 0x281945b273a98bfc, 0x4d19824b3249c116, 0x8e8f7da73e902569, 0x7ac91d187a693b28, 0x94b75580a4c8ac00, 0x23bb5f3e6,
+0x8bfe807642eb59bd, 0x6bb3b2351de82d4d, 0x6936acd7a610e22d, 0x1c8accbde71b50d8, 0xc5d6809317bd531, 0x203b1b198daffe9f, 0x630df327059c5496, 0xea80b5a111b00233, 0xf4b8956556f84f15, 0x23cd07a04,
+0xfbc447a96efe1397, 0xb5c6ce91d0da7819, 0xf3d162e1d490b818, 0xbe9dba74d776a4a9, 0xe5731bafa0548329, 0x1bd0fbe9aceb2d40, 0x80e287acba697f52, 0xd7d1fa763876012d, 0x762bb019e223fb8d, 0x15b105640,
+0xbca70d9d750501b9, 0x9d6ab102d69d73, 0xa75d081d44efcdb1, 0x540ac52908a9196e, 0xcb2ec18a426a675a, 0xb6953ac65286afe2, 0xc55033a6da1fb521, 0x9c03fd9455ae20f3, 0x2d4bb0505b68d0a5, 0x9371a487,
+0xf5acb5874edfee9c, 0x1c584904853849e3, 0xa4d7e19b1acad775, 0x7bde558b15ebb0f2, 0x991d6a8a24b9041e, 0xf2262987fe4c41ee, 0xb6aab35cac4533a5, 0xb542cb1cb5df4ecf, 0xb6464325ad58af2, 0x449c780,
+0x38ae6f79e6fd5697, 0x3ea3154002647057, 0x7e8b41e9a9c0b4a8, 0x1547fcac22310ec7, 0x524a923238e86a1c, 0xfa2955b30a4fbeda, 0x945476fd8d9f1241, 0x233e1f053b99eb92, 0xe32b36585a3dd7c, 0xcfa2ce2f,
+0xc6eb4eb059a50ac4, 0x750d0dd01245d823, 0x4799945df1a41e66, 0x160fa8879f6547cc, 0x398430df49f12a5a, 0x8b2d91bc34148211, 0x229606407e64285, 0x85b4e767ab6c5d4a, 0xf4086f5a8d6836e8, 0x275d66928,
+0xc0fb96cbac7430e4, 0xd2fa4d8e691ca620, 0x93d77e96617a43d4, 0xdad1d7714deebda4, 0x7186ada1e0d6798b, 0x59a3695e461d68b9, 0xb63cb7132910afc0, 0x15704c7e198da260, 0x473098857349356f, 0xdcc77f87,
+0x3ed2c596671b6d38, 0x76d9b348ef9a7738, 0x18f6483892f71575, 0x7cf0f76887383255, 0x7941a6ef2c24cc1d, 0xe53d313bbeb0e206, 0x8e0be022a0664aa3, 0x302b9391ea9d21ca, 0x511f24ffc6c69719, 0x21f5dabac,
+0xd69e3a8d5ca5e117, 0xd4476aaf574b998d, 0xdd56d31f667130de, 0x638c4a43bfd937a1, 0x78715ec061deb9db, 0x425d128b57c99ed9, 0x4da0a81f1ee780f2, 0x92df54c814dacfc7, 0xf97844bd776dbdd4, 0x1d46366eb,
+0x4a0543e7a5a22bd5, 0xa439ad798a0f3631, 0x734256c6769368d, 0x7c0e21c9147463ae, 0xaacfb239b2821fbb, 0x90cffd7a6514baa9, 0x4ca4668326f0f37b, 0xebc49ef4716e1a2f, 0x23d5724de503c4be, 0x17f813fb1,
+0xfc6dad8e4c5db9ff, 0xdc175a1918df2426, 0xf30d4efc37ca0984, 0xef6e248f90a7af92, 0x3252a78bb10f2ed3, 0xdf8a5f0c03dfe89f, 0x2abaeed2dd16914a, 0x3c42d8df3aa476b2, 0x557c7d3955d08cea, 0x10a5edcf8,
+0x4fcf2cf175f0c624, 0x2799b3ecf6c74ecd, 0x26920e87fdf1a360, 0xb9f432f98bf601af, 0x693d09dea6fecab2, 0x32f746fd99b8aba8, 0x5f078da755f49c8c, 0x88e6bbd22d4af988, 0x9d0eed17f4442de2, 0x26125926e,
+0x2f1a4f87ec099846, 0xc19204739ec136b1, 0xd050e3c23b4a8576, 0x6aa2e7828db6ca33, 0x2cdf7be4c72e97df, 0x712d82f148047f1e, 0x3484794d951092be, 0x53d1d6dfa8bdcfc1, 0xfc1ba63c24493bc5, 0x257d8ee93,
+0x70cb94e8188268d6, 0x6993c4c5b4f18ead, 0xf08b99a0dab18d4f, 0x8acf6463f266f8a4, 0x855fc7f6494c473d, 0xb0ebee9b1c4ce959, 0x63d042e4bdb03d7c, 0x74fefb72d5dbb3ee, 0xaf9126f23f0d405, 0xdf0a1c03,
+0x41cb33a6a6e9e6dd, 0x7e482d3f8b6a2aa5, 0x37429b6a1fc7740f, 0xfd53c8689b94c4b9, 0x388110e12992d395, 0xf70d3e21ce0009f6, 0x1e496b0245bd6828, 0xab8db47c6058f2a8, 0x13c1d1a525e11e0d, 0x11d483e07,
+0xff05c52e9abc5208, 0xddd7bdf167136c67, 0x80fa60ee9899c7a8, 0x131670490e4cbf75, 0x3818e1c38924b566, 0x3ed908cc64ae315, 0x4b65ab02fd0a3dea, 0xfad976ff84a24f24, 0x18f409463db7d753, 0x1c98640e3,
+0x7dc735efdd94ec08, 0x5095dcaabf3a8aad, 0xa0ecde6efdb9cbf8, 0x15a6e405e223348d, 0x85c24f8f199749b6, 0x738271fa67e5d6c2, 0xcc257a0e2ca7f943, 0x72c7ebccbc26ed97, 0xbb9a97076cd6fdb1, 0x1492b30ad,
+0xca9db7f724a025d2, 0x9c10f650442f71f2, 0xda89cc8163e5d800, 0x732d0bd28cbae63b, 0xf1e1eb1046e318d6, 0xd0d8d75c58666b73, 0x6a41cfd5ef1af66f, 0x5ebcfbebf23a5594, 0x538dcb878c22c65c, 0x21f2cfc46,
+0xfd61652c7232f54a, 0x80867089d7fe63ba, 0xd97a9890ee83ed6b, 0x9c76bbe01a65cb7, 0x9e27c7ace3f83b06, 0x4d4cbdfb7816990f, 0x939ea97cce55d652, 0xbade00cceef3e0f0, 0x9646f5a58b321ed3, 0x262a6b0b0,
+0xfac46b29179b34bf, 0xd321aba7db560b15, 0x3b29c8291f754ffe, 0x32d1c42d489b6a27, 0x8d8b5cfa5e69d18d, 0xd88d9fa5aa103870, 0x6d6bf163b7f9f5cd, 0xf69796b4ea77af59, 0x5d3bc0786c2b68a0, 0x218bb9d80,
+0xab149521a5ff0468, 0x3ec20120b323ea2b, 0xf0e397360fb2762a, 0xca46f8dc6372ea4c, 0x2dc0785015d56e05, 0xfaa685443be98374, 0x266dfdc70e81c82, 0xd87c31f24b3b2f03, 0x4cd327a77528011c, 0x7900a8aa,
+0x61c5511262a4b1ec, 0xc9be7b9cd4927009, 0xbb2f98633de9e970, 0x62295a164bcc5870, 0x8e305cd0e02a6c84, 0x9fdfe5d846a96b39, 0x266ace02bdd09dce, 0xd86796a32a08e6bb, 0xe9165242b3485972, 0x21fb5177d,
+0xb701abc5fa25dc43, 0xb7c5916144b1c8e8, 0x19b0aeed1fb065dd, 0x9374b33e83f78c50, 0xd458226240178e22, 0x26cde8f74854ece, 0x4fff2703d161fc24, 0x92db0f21a1a4aa7, 0x748839cbac1a082d, 0x4b1dfef4,
+0xa2dbdf7d121d523b, 0xf9d55c15de4b1af, 0x7fda5a88eeeb5f10, 0x7bdc60899f28cd2d, 0xd82a2112b03bf3df, 0xb7c188bc34323a8d, 0xbfc2f03a91d189e0, 0x7684a77661afba3d, 0xbad0ddbb12ae9a0f, 0x128f39dc1,
+0x2e02e5b88a185305, 0x2c79ae4afc9e28be, 0xe366267bcae8abce, 0x5fc56a3e1f53364c, 0x4c4287012d558503, 0x511293761b4135fd, 0x5a3e645f3fa37aaa, 0x8149b6c77db33e12, 0x59189770b032d951, 0x737502d8,
+0xd8b5d60ae8976901, 0xac1f2a1ab0277220, 0x1b28dafa53a62c4c, 0x84a6db508f500ae7, 0x10dcd6bb8ba40323, 0xf83cec9d8fd42f9d, 0xee30d81a9927a380, 0x47622b4f5bdff67f, 0x2665c34bed79d024, 0x13e8d99c4,
+0xfb1f96f8cf377472, 0x3a83e0b51d8fab36, 0x243c296125943cbc, 0xd764fad8991e24f5, 0x5c66cd573c4ba825, 0xda77e29c04b4a5db, 0xe8110c82b1dca973, 0x69a46357dd65aa82, 0x797707fe9280bdad, 0x1ee582ebd,
+0xad24b59cd0d2a839, 0x95dbe3e45aaadd00, 0x17d37855fbeeeac5, 0xabff19f3ba1c2b1d, 0xecd0417b36563ed8, 0xb0ad488445b4e25, 0x9f3d46ffcf91b6b7, 0xda05472d83d163d5, 0xdb13a74021b59793, 0x18ff5ce69,
+0x2ea54b88d85296d, 0x35ebf5286709c6eb, 0x966a918cbee3c903, 0x3df2ec8b7385b71c, 0xa557062f3fe43966, 0x1ec8902fd25e3969, 0xd24fd90de6f15944, 0xab75cd6c7860ba, 0x88ddcede4cc1ddc9, 0x13ce5b342,
+0x204db34c203dd176, 0xdf6bf3572fc7064a, 0x5df436cfa68840ee, 0xd6f69860e2b3a0d2, 0x1fa0ecaade549a25, 0x756036f6e5fb8b24, 0xf05409e3e2cd4d7e, 0xb816e4e58f0e2553, 0xdc2c9d0564b06d5a, 0x1868a75b5,
+0x374aee79cad503dc, 0xa49ce55ef59f804a, 0xdae409618610d152, 0xfbc64167b65fabb4, 0x10120844f0b55a93, 0xb415ef24276dde1f, 0xa4bd96c5aa6de720, 0x519291d7e9e76a03, 0xe89df09370893d47, 0x21aac3926,
+0xe1eba2ac909ffae3, 0xcf75bc58b9dbecc3, 0xc1c21a77ee2ee37d, 0x624a00dbcc19f269, 0xbc01d7cd1eb620b7, 0xf238c9271b11d0f3, 0xc68c3c22e38813b4, 0xf06b8d1f6916faa, 0xceb459291a9bfbd2, 0x133078449,
+0xcb512be620406a23, 0x73488f13426284dd, 0x8822cd1e69a79fe, 0xa50b0569d024ca79, 0x7ce379b74ed5e003, 0x99ac51ba18c05ba4, 0xa224c10117d551fa, 0x6addc0b7ea380d44, 0xabf1986e296890d5, 0x36147602,
+0x93e6d5a2631b89ae, 0xcde894e4341df9b8, 0x19709472efa45e62, 0x9782f665bf7b46f7, 0x99d4b703ed308ea2, 0x748dea8b1edf179a, 0x312c715ef1029f72, 0xcd4e09ab05f7e22f, 0x133e2175d342b366, 0x48685a51,
+0x5ee728b2da5da0b4, 0x5230c4db01358813, 0xf6af6ba6a679b204, 0x8891b8f356c6cb00, 0x20e10bfa4d33f643, 0xe066ab1f5b3b9e78, 0x6b8257fbee641d67, 0xaebeea6ff884f505, 0x2c00fbd6d6548ac0, 0x21270c73c,
+0x94ee6774c4b764ab, 0xd3e2d24d964d496d, 0x7e077bd387abe8ed, 0x1a49255e9c6a8566, 0x7a0f8d74332d38a2, 0x6931a7cbf93ada6d, 0x1f79dfaaab265dfd, 0x745a5b736ac7b209, 0x517f07ce0494c97d, 0x135ea824f,
+0x90f167c1a5fa581c, 0x2530d54c24689f60, 0x982c874dc9256480, 0x246f884dbc88561e, 0xa12f808c74af4f71, 0xe590156d8c6e37f1, 0x1e4fe107a0740c46, 0x3b74f658b6c5a915, 0x4520d8e2ed977320, 0xad79bf5a,
+0x35f2676c7f1217b4, 0x57362958644da2e1, 0x13ae3c0d9dae563d, 0xdf310bf4a35e0ff0, 0xae23fbc17120da35, 0xed6e94482f4f92a7, 0xc25ff2674130f4a8, 0xcc2588680f4f9674, 0x52bef0d810b47032, 0xd6d41e2c,
+0xc0e78b98625be4ae, 0xdb5ce665a934da00, 0x3819f0ea696408b1, 0xa17c8c28819073d2, 0x3f2edd71b9892b11, 0x8c6a81f37dfbbe10, 0x9d6da15ee62e563, 0x894e1d8143b5abb9, 0xf43b534cd9fd8aa, 0x13781812,
+0x31c76abb0e1de2fd, 0x12e2bb29587f5e29, 0xbdc7edd7cb0bef5d, 0xe00ab3e7e0d441e7, 0x65dc886b48f78222, 0x146eaf26eed0cdc, 0x546c912d6087b447, 0x60bc401734c84dce, 0x93b9a74115af9d15, 0x159277e87,
+0x2bd855dd7de98c0c, 0xdb66b7370e237c80, 0x870408b58976acbb, 0xef55358d072e8a2f, 0x5420974b3e3bebbc, 0xf5a553eab2f56961, 0x93d6d2a0399329db, 0xc8d87eb7e66a5d, 0xaa73e0d34810b2c8, 0x62275b3f,
+0x89f5e1b9fb7202df, 0x5599c430c6a239f8, 0xa43c0e99c318dae7, 0xd8ce730858d9921f, 0xad5bd81f116e18db, 0x554148edef4ece50, 0x390f89c67923c7e3, 0x49151d85e61148ac, 0x2c9d0270f7ece7a9, 0x882c6343,
+0xcea3b198ff39a1d6, 0x9d7f2f9d449cfa3, 0x2e08caf5ec3bdd41, 0x390254f97c07119b, 0x1f0c8ecaec724fd2, 0xf30caca0bc55fd00, 0xa76843e78876ad9a, 0xb93fe0548b5b8744, 0x6ed59c49fd0a29a, 0x17fe338f0,
+0xad169ec536d5b420, 0x1d7e23bbae4c4d5, 0x1a4bb8403c0823a6, 0xdca1542a4c75814a, 0x2910e747a0695553, 0x385b6f792227b767, 0x5b1a310c8e1c1b5c, 0xc8a25e96cdabc742, 0x174d99950539b18b, 0x238529bd1,
+0xbb0157a5dab81f9c, 0xde329c447839f12a, 0xfa1d22d1aa11a2a3, 0x4621d879a8740950, 0x66d08326ace5ad3b, 0xe5385acfd9c9bbc1, 0xc99e0492610223c5, 0x4eb093fbdb62a508, 0x704ac2bdf21574c3, 0x22244069e,
+0xdcf80d04262feea3, 0x1e5e3086c845279, 0x8586d77a1c2b4ce4, 0xa63755ee719ead9, 0x26ff04f96850d9cd, 0x5d9198925aad7fba, 0xd6135a735fc236d, 0x8f657d978d62caa1, 0xbea7becda8759712, 0x8e54cd15,
+0x4d84ead073f8695a, 0xb52d28f6da94eef8, 0xc0688e18783ae773, 0xa9a01180f816eeac, 0xdad71b24efcddce2, 0xe79151f310b73dec, 0xe9d6d4db2fda7fb6, 0x9a010a0b89acd16b, 0x8296877edd293244, 0x277f3545b,
+0x831fd72541b899ce, 0x83df9e35fbd3ebc9, 0x25e3f432cb63c1f9, 0x236665668e7279f1, 0x8d12c421276a565d, 0x6507ec6544d63db3, 0xa71d32f51c264463, 0xa8b026fbaba20fa6, 0x6cbe190be34af520, 0x2286b9b41,
+0xfe3fc37a66147d06, 0x43c01b9246949467, 0x9970c9825ecb35, 0x46901811c28b7793, 0xeface45281c1b9de, 0x7d116598d1ad6b4f, 0x1825fb7d374578a5, 0x666c82a2980dc537, 0x2baa0b7d515b6e4c, 0x14f67e0cb,
+0x1e6cc3b61543681f, 0x3b61d82d4fc9a731, 0x60d82a25031ed680, 0x46a0137552d77dec, 0x7635c0032681488a, 0x18b67fc6a5462abc, 0x748153f7c659e4b2, 0x12e2d3296e901024, 0x876dc412d487ff5c, 0xe27bf179,
+0xa2066c91ec11247a, 0xd55d673b4bb7acd4, 0x583aa6d68f641351, 0xfb1ff93d853574a8, 0xd7f348c6bbb62e8d, 0xfa7b2931fb411c95, 0xdb085eb7e45802d4, 0xc918ce0425e06809, 0xe616f8f2d6473890, 0x1a89597f,
+0x534d42aa3f6abe81, 0xbf5a99cc764e6ad9, 0xb76d293d59edf4d4, 0x2947d8c5b321d193, 0x4d18cea38a7e9ef0, 0x8739a045dc851a6c, 0x9b243d20a7c6c56d, 0xc62c9fc171de541b, 0x78ec715869abc126, 0x112b414eb,
+0xfd4fbb828093d8bd, 0xbedf6c45bbe4ba60, 0x119707ca51d076fc, 0xf868c278515679e1, 0x2a22b7224fe75055, 0xf03f44a2625b6b4f, 0x8b2771205ce5490f, 0xf238b547817046ef, 0x3a5975add4baed5c, 0x7a490709,
+0xa31c6bd53093d9de, 0x338fde615c6d3aff, 0xd2933658b72922e8, 0x5f2c27e404ba1807, 0x9e6e18a042b595d9, 0xf5b24bc70d4379f9, 0x787e88e766381514, 0xdeed2028f0bb1874, 0x1d61ab111f592c7e, 0x1071f8e3,
+0x3be5032e566c72b7, 0xfb4b334e9d3d2858, 0x1ecaadd03cab4150, 0xb0ab4d0574015493, 0x8a65480b67460689, 0x717dbdfe6a78c61a, 0x7b688aa1a781df12, 0x7cf5e20938eeddd2, 0xe68529486f05c8b7, 0x181d5d0a6,
+0x783558faff349411, 0xbafd1d1628c67b67, 0xf9f9a48719525554, 0xe98a88f3edce485e, 0x6dc0cb6649033189, 0xf1ad590d5cb1ac1d, 0xfb1a6ed3e976615b, 0x166f7524f0b45a8, 0x975807307ec3d63f, 0xffef96b1,
+0x4a907963ccadb360, 0x7db0ad3bdd0e3872, 0x8ffa0e85e92d517c, 0x30a9bb802f6ebe64, 0x133e04fe6be40c4c, 0xef836ccbfae00c5f, 0x20c78df49bcf8f75, 0x6d1e47fb44e933b8, 0xd23943fedb388727, 0x1e57bb295,
+0xed04dec5b2d10b2d, 0xa4cd1758842c1b2e, 0x2d84bd6a938417c, 0x91150963f922796d, 0xe90bdd74096ac4d9, 0xf48d7d553ac5b2f5, 0xf1a97933762eaaa, 0x3750c4529156ab3b, 0xd317e502cb7718c4, 0xb418715,
+0xa0b65dbb8e1a356c, 0x8d3ed7484c77f4ac, 0xfa1b5c5e74b0b74, 0xdba1f309b4371351, 0x3b28348dd7ae81cc, 0x823fcbadf11e9259, 0x3b7f9e4c8189adba, 0xb320c606fd9219d2, 0x9400cbd7ab83e1df, 0x85b97f84,
+0x5e9e2a5fc890b5bf, 0x4b2159d014a567d1, 0xa16b3e4ec6187481, 0x9c0b56b2799d8f1a, 0x896a09fc9e5d031, 0xd974794fb8b887ec, 0xd56e286c9563c8ad, 0x8411f8b0b7af4d3d, 0xf3975b47fa519bba, 0xbab6299f,
+0xd555229ae4f0fd87, 0xc111f7f14c1abcf1, 0x343746e50e47f517, 0xddf06f84dc00df53, 0x86ba780bef628cb0, 0xce0ea3172d2c3fb7, 0xc5590036305de90d, 0xa1e3dd18be3a8da4, 0xcdf5de23cc599a28, 0x141478f16,
+0x48295d0de9629f20, 0x73e69f48e46641b1, 0x3c5d21613bf87acb, 0x391b92b0d18eb181, 0x6510c98bc7cc8096, 0xa69ec68c4b75783d, 0x7f6bb59a382e47e3, 0x8d905e49c6278169, 0x22d1b01d4f4ed26b, 0x102d29f5d,
+0xab403390453b5409, 0x36bcb49d8ab1e700, 0xb38552bdbe79e282, 0x456c498b142578dd, 0x6105e6b81e06593b, 0x9ed48215add53884, 0x308d021bd168536f, 0x2ce4f90fd01fa4b6, 0x5fde5cd196efc1dd, 0x1f3ef93e,
+0xc0660d548829573b, 0xfb352cde5af61590, 0x8155caa137db9487, 0x594cf962f3d606bc, 0x1c40715caee2dfa2, 0xe764f8f9a162dce5, 0x5de7f948e8c706fa, 0x4fafc77c390b3657, 0xfd00d488614e7268, 0xdb12a5f,
+0x84fc9a42821484c5, 0xa9976e644671b91c, 0x4ee855531d730f8c, 0x30753ac5e53a05e2, 0x47c0e0586cb1f4b0, 0xb774b8cceb445d11, 0x1521d3385fb08287, 0xc1513e6ae2b2566a, 0x5e4b3224f50e4dd0, 0x16ad10476,
+0x19905e5ea3fb99d1, 0x19ca1859314df9bb, 0x5a6a8d0785db13, 0xe07e956034bf4d78, 0x5f28400ae5aff912, 0x7570c97c956cd9e9, 0xcd5eb24329333e17, 0x889b38e3891af3f7, 0x5a7c0be89d8593da, 0x20b5ab0db,
+0x96a9cc6b2f56123b, 0x3c0e95960acea034, 0x53a5fd617b3daf7f, 0xd7a6715633248b26, 0x560d4a09a38c5070, 0xcfe72f39cc68428a, 0xc5b1a5a79f286f76, 0x2d8a4baa74aa2030, 0x66000eeaef27dedc, 0x5e68c220,
+0xe10cbb5590d1ef02, 0xc048482b28f36912, 0xae45bd61c24f53ff, 0x8f8ef19b1f668cc5, 0x10df6f67f787a554, 0x727cbea3cd7a6c7a, 0x21a94ab24e3795c6, 0xe321d7efade0eaa8, 0xcb0023c71ce255a6, 0xd0d657c0,
+0x8a3b5843c52d3c61, 0x3b88a0dcf928c489, 0xea42b7c313cd3ab8, 0xd512da54effa2ad3, 0x364fadd5697c15de, 0xb1c96859f33150cf, 0x2abccb6e24fdb7b, 0xfab2989284e23585, 0xe5055b246ab4d21d, 0x22448abff,
+0x5a5f0365d139dfab, 0x88d04cd57fa0fc1a, 0x2acb987833c00f6, 0x9a44e29e46dfd097, 0x5c9609483ad585c0, 0xb3687de29fa5485c, 0x45478dcb4e3730f2, 0xd8ba10fc265ebf09, 0xcc47b425ebd72850, 0xbca31476,
+0x273548e271ab820f, 0xf18343ddbbb4d77f, 0xea1bded8b7c4ddc3, 0xf092aace8d7f9daa, 0x82a6ec55a535d6b7, 0x34e207659cc0ad37, 0x83472d2e97ff5606, 0xd00b3aedbb6a00f6, 0x5f45bf01b5d85b26, 0x1c82443ba,
+0x5620d9065fc86145, 0xc2f99fa0c5c3a461, 0x19b94f96c97cbc9e, 0x80e5b0efd58cec2d, 0x1732f4fcd4083550, 0x181b1ce97bc0c65b, 0x1ec9210bae55ff2b, 0x56d5359ba4e31b68, 0xecbc365c37b67610, 0x16750c426,
+0xeb39c3b8d2fda20b, 0xec8e94b5a5cbf60, 0x554451580ba58c7, 0x52154fd9d37d1983, 0xdfab240c49929e0a, 0x6a9a9263533a1ef8, 0x661829098b0bcbbd, 0xebf81770fc1929f5, 0xe0c2c6a22cf85bf, 0x2399f22d9,
+0x745074d1f23120bd, 0x3886e09c57891f67, 0xcf6ec1a395c9bf0a, 0x61861afb06cc7353, 0xaf67016f6b9a45eb, 0x6f5c0863e5358cd6, 0x2b14ef8d71f66d41, 0x93111aa02c8da53b, 0x799882a43f770fa6, 0x9c682a7c,
+0x4cf8c924a6486ff1, 0x4fe3f4e97093a50f, 0x9fac74c0f39ffca8, 0xd4af2583e84dbc20, 0xc3fd8294d626b245, 0x61b2bad6f0ce2595, 0x13881715a6e8a95e, 0x13b537ed4cbd0b24, 0x8c03c0ed7bf3af9, 0x16b5f2b3a,
+0x9ca80f6a7f1ed6e4, 0x9808c567788df395, 0xa650ce07d9dfa8a7, 0x20663b3fbb6fd225, 0x5cf60ed4fbae5f53, 0x5ac33421f49f1e29, 0x497ca7d991dab78a, 0x229caa5f6242b05b, 0x946f5fa7ec5c8b52, 0x242413154,
+0x4ecd4544a6f8f58d, 0x81f9ed3c8decffb8, 0xfbf32d7e1d23047b, 0xe08d97f32a045b9f, 0xe222dac18939b708, 0x13d3e7d9d02b8296, 0x42a461f6ec6ae2ff, 0x39620fedb9a0052e, 0x52bf5aea60f7bfba, 0x849c566e,
+0x9826f94464983430, 0x22023174e9ddd13b, 0xebe3b69169d02ed8, 0x31715b5468ab442f, 0xa919ca522ecf3bac, 0x82291b83cf256166, 0x24ae579bb061a51d, 0xbadaa54e1e8f999a, 0x445918c5103201a5, 0x248fb4862,
+0x9ed745afd4656c00, 0x97c059c2993ae206, 0xd5dc7ecc0aaa2987, 0x388e765e68fc8e13, 0xe02c25e4f43429ce, 0xf586d09fa4c47128, 0x3a3b89c10a52b566, 0x5cc1f7649af90c8a, 0xda5ff980196a8eae, 0x1f1103dd3,
+0x907f32ed25c81648, 0x321775d10873fafb, 0xc8ede006f71eb0fc, 0xc6d4b69e26bae05a, 0x86c811774d024ad0, 0xeb7de506a434ceea, 0xef39496a6d5921a4, 0x6ce46420f8186bd5, 0x926c422ab8b62214, 0xe714e452,
+0xeb153ac8b54a84de, 0x5b70229711056a63, 0xff731260417f398b, 0xa8f28d9e4d13381b, 0x11654da777dbfd7f, 0xc927746d18df7c9f, 0xf34d44c679ca2efa, 0x94899b760faa86a9, 0x731f540a360ba02, 0x19ac431be,
+0x5439de7e4b2d175e, 0x9bbeb73d84fb67a6, 0xabf23d8af1a157cf, 0xd176fed67f03d91b, 0xcc417c29911b0586, 0x25de562907c260c9, 0x73c32b0b39dc4e14, 0x9bf64d0f35aa4a7b, 0xff8efa7c8f091ef7, 0xe7d769b6,
+0x796cdc97a323d218, 0x24ef4dbebde3e90e, 0xf8fe93b7d2917fd7, 0xac4a6ab4e0b53d3, 0x10240ad1e209dc40, 0xe087ddfa3720dcff, 0xa6bad6167683f950, 0xe65c1ff5de0d599c, 0xc64f4ddcea279eae, 0x50510f23,
+0x7fe6ab9e37c03222, 0xfc922050789e3f97, 0x8eb1c0764863b651, 0xcce9aef1fad5f411, 0xbe70aadeb18a737d, 0x6d83399cd76806ee, 0xdc102a8574f79036, 0xaf9871cbd37693d1, 0x7dbc1ab0c9ff5956, 0x1d0bf96a0,
+0x3029e45c6f526900, 0x2c51392fd11b727d, 0x2c29ba7157c4f82b, 0xd8d2a96696cb7431, 0x7f52c5d6dd3751c8, 0xe5ae119a7ac0fb11, 0x7a3b72891cae1417, 0x570e59e96fea50d4, 0xf998a8fb8edab176, 0xa0877ff8,
+0x1f8055c0d3670eec, 0x3a9fbcbe10737c53, 0x13c52de4dee2bddb, 0x1c669fef12381a25, 0x628c8446249c81c, 0x38e7c691dbdb3eda, 0xe2824adbb411add4, 0x80a9ced33cee08c8, 0xead57ce490a61ded, 0x1504d4403,
+0x6aa9a03799fcae5c, 0x2c1d8d49c53199b1, 0xd067fd4e1f8127fd, 0x21b65df5b05bbe3c, 0x9c5609480bab46a4, 0xc0dc526d3a3ca71a, 0x96376003e52267ad, 0xfb5a3367d63872e9, 0x9880321c49f9c991, 0x85f5cd5a,
+0x89ed0983098ab4a1, 0x474359f09a3d8b93, 0xab50a24c5a549eb4, 0xea2eaeb4c53db3bc, 0x750eab9704c5d034, 0x7612dc2773466bd2, 0x2cfa0ff28cf31619, 0x9e81c9ba0cbfd6f6, 0x91bd16eaedfff6fe, 0x8790ac83,
+0xc340664ad66f2760, 0x58b58940d4b22d92, 0x8199d64536ecfdbc, 0x47e06313a1adc904, 0xab58c4ca03d10913, 0x43871c41ac4f4472, 0x83e1038d6f05749a, 0x9ad135b8f4f12307, 0xfed8d684f2206511, 0xa8355fb9,
+0x215f98b662f085dc, 0x978507a78f49bd5b, 0x8ae115548cc27a02, 0xe8ace77893f38f7d, 0x7a1e7faae9f5e180, 0x24dd729d785acf4, 0x3e1308853cccd30f, 0x7b2b2f42db1e965c, 0x7ff1e9dfc5ea082e, 0x16e9d3f54,
+0xc7de95e4dfdaff62, 0xe715e899ccafc893, 0xc9781d394334b9e, 0xbcc4e9d59f6c58f5, 0x50222dadc272f2b4, 0xeb184ff750b7e5cf, 0x83387daab7a14b24, 0x456ba19dc2afc4f5, 0x877eaacbc8118f74, 0x11979c563,
+0x6084e8f7d6d0c96b, 0xaac495310f7d433a, 0x861e11504ede3075, 0xa4498d5aea082178, 0xf1a2716a801e93f2, 0xf6bdde8895cb4461, 0x868dd2c679f7e037, 0x3a1884a5f6b99cdb, 0xc6e178e32ac7a2f5, 0xa9a1fd62,
+0xed7a434b674b6a3d, 0x7ccaf7e2552b7179, 0xb662157c345c2cf6, 0x8fabd3d40d6784af, 0x28dfae565a8aff4, 0x7e629d3a6d3c2213, 0x802f969b48b2aaff, 0x9325db2677039f74, 0x2359d9fd56ff2601, 0x19a2174c7,
+0xb287f77efa13dda8, 0x623fff9920ac4a03, 0xcf5dda5dac833da6, 0x8c670e28caa54cba, 0xd1ca8cef9dd48874, 0x477e5639a9834552, 0xdc556c475f25b380, 0x6a99980e2ef61b42, 0x9cbde210e4f0e00, 0x1dd9e66f5,
+0xeb65a77d46faf2c2, 0x9a4c87f5e73526b4, 0x864fbebd88a224e, 0xbdf4116d21e3d46b, 0x34b5c867680a1fdc, 0x85fad60afed929db, 0xee7a2b5c620c7f28, 0xf5a583000898d91, 0xb92d733dc12f76e2, 0x10c1fadd9,
+0xbd7a3a201fbe4778, 0x74c366dc91e557ce, 0x6b84083bb3d9e2f4, 0x8d97f764d4cbf7eb, 0xab81e002643c40bf, 0x65748d2d8be37bad, 0x8fa42d05da9c58fc, 0x1545f97b21ff72d4, 0xbd3897bbb04f3a6a, 0xba83d698,
+0x1cf79a5a1333196b, 0xf48dc70113a5b728, 0xd127385d444f272f, 0xe0547603d4181aae, 0x5884a40b9af89dad, 0x80f6cf96e561e3a1, 0xacc01a6e3f603829, 0xb6bee3d9d7bce674, 0x9022b8a777052fff, 0x1c7b350d8,
+0x613a151a4099a8ee, 0x9f1c78cc2486942c, 0x5133afd28088ab2, 0x322e50906b63c186, 0xd747f153488fbb5a, 0xb8a2a74358a1b9e6, 0x4637ee307574e574, 0x919cff9146d5b31f, 0x41696d3f9c023230, 0x26864c5df,
+0x4b1bd1fd39b7ea15, 0x9f17b51611ad1c29, 0x7e9af72ab32fdf88, 0xcf2bbd9160632ae3, 0x97387e2a613ef148, 0xfb0d1a35e5388140, 0x6ea6906aa5992db3, 0x6fb031e3ceec15e4, 0x38f6d67974340498, 0x185b19f3b,
+0x506a7410d1b02dd4, 0x1b7206ea30309b6b, 0xf8dd584707337cbe, 0x502efc8581f3fdf3, 0x42f936c1de24cb2a, 0x27a0ceb1c1033083, 0x338694a043f4d7e7, 0x3488d5445e5437d1, 0xd6a47891303da7b1, 0x1a478cf43,
+0x8ae63515f5a147b2, 0x99de878a93cd455c, 0x9bfeda5ececf7e39, 0x770adb1cacd7a707, 0xcf9d47e63ac75ef1, 0x21d9fb497a5b7c59, 0x7f47eb0371b5dd3e, 0x3fcf3a33ecc76ba7, 0xd04f51a612e79daa, 0x249b3e5e1,
+0x32cbf6aaf087aeb9, 0xc16ff019a247f23d, 0x706543e0ecf396df, 0xf01de88cd36388c9, 0x7013755c9e42144a, 0x480796ab1285708a, 0x1d18676fc34aa150, 0x1e816150782c6a73, 0xdfd9f880de0f9a1e, 0x151809e55,
+0xdc8c9f1e9163e817, 0x76f89f7be1785b45, 0xcfd232e0e3df7ec4, 0x7f7d6f506e3937ba, 0x55a05065f98f74e5, 0x5fcb96af22ebc389, 0x2a707afcd314dc3a, 0x1c68ee4e52ea3851, 0xe4e155b3d48c71c4, 0x23bddfb5c,
+0x8a56b3a90cce3ea9, 0x602155798a8830f2, 0x497c8a71208ddbba, 0x72fc6af57e9f29d3, 0xdb94680bb7b5374b, 0x3fc43e7ed773bd7a, 0x35ad208813cd52e7, 0xd93f2a3c4cdd3e1c, 0xfa8526c049ef82d, 0x1f65eba8d,
+0x7aee9a8c8ada45d2, 0x5f9690555e71720, 0xcdaddeefff8dcf02, 0x390697dd321f1b46, 0xf07c48aa402f5cf9, 0x7d496c792468c016, 0xf2c4029996a752a, 0x74c42e05739bd6c8, 0x5406a431fe8d9c10, 0x1958a4d3e,
+0xf8ba6b64ad638b76, 0x1d4cae9f8f9d3231, 0x42a1ea22c4bfd4e9, 0xd18ae2bd0734222, 0x9bb98788e9d28c2e, 0x3021a541ff7ce24b, 0x821a0630dbb4e277, 0x4a6c30ec4b2f5569, 0x15f173180354b9f7, 0x82f43d78,
+0x6ab755d4417d47be, 0x1c3d2065b563f57, 0x44483834667e2f7a, 0xf2bc10bfd469e5af, 0xc29c4d50daf0b271, 0xca20d62f09ec624, 0xa015653f179512f2, 0x997b56616466d95d, 0x73d13a50e67c176f, 0xf4d44c3e,
+0xfedcd2ccf105d7b3, 0xaf28707638d91b7, 0xfec66c19733c598d, 0xaa3faddc79d76723, 0x4768d38ce4971493, 0x54e1ad8993cc5a91, 0x67b29962fff52e55, 0xa63051b3e5bca674, 0x5b7e610d41e1e985, 0x1dbd026e9,
+0x1260f6164977865d, 0x92a223b99637207d, 0xc21cf7c1fcb6f9cb, 0x4783c910835d00d3, 0xb4f70aed2289e545, 0xb32dca37a226c61c, 0x79419ac99a25744e, 0xd0b9d5fe9ce8d357, 0xfa3643bb06d697d3, 0x41712e21,
+0xe40da3695dfeec51, 0x560914bc45eb0d14, 0x9eb563364bb4e5ba, 0xebe35cecd6837978, 0x7ca1ef8c67609425, 0x69d733a482486287, 0x2b13a35e2af45c5e, 0x1ea5f4377a79b2db, 0x46fca0e1d474cfb4, 0x1c9d1b08c,
+0x9e1397dd123ac5f6, 0xb8813bf0987e1364, 0xad6a62db8bd4b52d, 0x9fd7cebb712c1e7c, 0x1503e6c4a47fcaab, 0x548ccd4f601ad65c, 0xe8d661140fd62a7, 0x983ef6e5f045aae3, 0xa249c18e841e59fa, 0x12b149b25,
+0xf93ed1e08aae284b, 0x4d2c8c582b446765, 0x8a4fe46e7698ca49, 0x61477afd52cd10f2, 0x6fa8de86e5ab0e62, 0xe8ccecb6c1ca795d, 0x3cf1679baac5a5f3, 0xe2d1ef397980aac0, 0x51e14227e7020ca9, 0x230748707,
+0xb8e33f7341b9110c, 0xf573c3615f6563e1, 0x703f202e9c81afc2, 0x4dcdde216a9bb612, 0x6f5ad9ff69dc89f4, 0xb1215e7dd8cd6a5e, 0x5e48483139b6e4a7, 0xb8113f07921aa93c, 0x1820a8185a444f6e, 0xca2757fe,
+0x2f242a2f907278ab, 0x3b71825e9085abfc, 0x8acc4ee8fd3280, 0x2b4d4ef79b346b82, 0x8b569beb89f9bb2e, 0xbb7f460c1845e9d, 0x2019a73140baab1b, 0x59a01e2fe2735af9, 0x9d8b762617fe48cd, 0x16d21e00f,
+0xc4357401ba1badb8, 0xf5ca42bbecf7acf9, 0x10a55819b169358a, 0x51e9e5ecf996370c, 0x2f08442770ceadeb, 0xe96cc9d2580c4ab7, 0x9ce98ff8c67a543c, 0xb51dda4151e23a1a, 0x4f9e89b7dffbc90e, 0x22579db3a,
+0x8fc871bb9f2e6adb, 0x6fbe45594ec33c75, 0x5885aec94261f1c3, 0x67ab7cc2108df49f, 0xf4889858236d654c, 0xe5e74b63a6b29a53, 0x7ac08eb8bc99b638, 0x40dc7e2f23b3149f, 0xb0001c595a2916d7, 0x78a4d9a9,
+0x1778bf072197596b, 0x90cd594b66898e32, 0xd2af1f426eee827d, 0xe87953b90a40f942, 0x67f97b88d4032f0d, 0xc2af65c6084b1b86, 0xf2fc0a7a91b10b5d, 0x3b3804387b29530a, 0x440809172f4a4783, 0x129c89f68,
+0x5fb1b869f63db8dd, 0x9969ddcb1dd561fc, 0x4b770976b12c1cef, 0x5ae42a47898bd8be, 0xe0ff9108938afb3e, 0x94a260b70effff78, 0x8be358ae6cb8fa80, 0x37ae022af40b8215, 0x4a40b7bf1d21fb47, 0x26951519d,
+0xb50463b57e9d470f, 0x90d2754d6772d708, 0xec5ecc0ea23bb60a, 0xaba78a7cfa527343, 0x47bb4d7d4664105b, 0xe9a421f040bbf1a8, 0x59776937f01528f0, 0x507e32998b16e54c, 0xb5172435b85ac7c1, 0x213a06c19,
+0x8df9625be193f829, 0x72eb9469baa6186e, 0x530bea72aedd0327, 0xcb3f4bcae4a756ee, 0x50e3cbdcd8d7fdea, 0x32c4ce81fddab949, 0xa6a678446def5e78, 0x7cdf73e06adcb6f2, 0xee477d4278bd0875, 0x101a3cebf,
+0xe44c9558dcd5d7f0, 0x57098dd246d0e35b, 0x1220579e45fa6fda, 0xebaec0085cdef8d7, 0xc074e30967840406, 0x863fb1f22645cacc, 0x1366e2f9a4677783, 0x3601e8e51a258250, 0x65bfb6bd0d9a6d15, 0x1aeb1ffb5,
+0xa9606e66d26925d1, 0xe9fbeebb4830b652, 0x9de4d0e1dbf934d6, 0xf72c1fc46ddd5c0, 0xdb810c64433eae28, 0xc07820ea6a999ba6, 0x1757bbc06f7a7580, 0x5b753b3723382a6c, 0xd5a6ee9139be8f5d, 0xa43a3907,
+0x680d640694410a33, 0x312b5cd96931b818, 0x25cd9d991e80a6e1, 0xc677da8baa424557, 0x26ee453f61729b05, 0xc81a5022e31f3de8, 0xd69b35b639c23853, 0xa7b48a55f609584f, 0x828a5fd34ce5a5f5, 0x8a643f9c,
+0x4aa8c54f2343be61, 0x586b175c56f34084, 0xe27f71ca96ecbcc2, 0x63cac72987bfe8f9, 0x4b09c53bb25aebc4, 0x743d7c14281634b8, 0x890bda03884fc57e, 0x16bb106c570bc8a3, 0xfe00104f26106187, 0x1b1170168,
+0xafc7465f8ff9e509, 0xd861bce9f42b4e63, 0x1b896ad785f74bab, 0xc5dc781bb78f87ee, 0x5f1ed320d9114d94, 0x4eb7613607dbe855, 0x5cbe6c5d5202564f, 0xb3991e2cd2a55ceb, 0x883f5cc08ab68e2e, 0x1362fe21b,
+0xcc26542868b60a24, 0x98c4b6217503bf78, 0x5a2d959999d676c9, 0x4ec8fbd192bd78b3, 0xbdfadbac9f1a5541, 0xf8fb87e5918d511, 0x3e55972a73e7a912, 0xd2678732b8ca00d, 0x8e50ff0b560f2ad0, 0x4a74bd2c,
+0x87e1c9acb914b0e7, 0x14383543f11ef74b, 0x94c3add28e305019, 0xd675ce8191b1dc71, 0x4c2a96238ae1d13a, 0x21ae767b72d73d09, 0xa6a64b9353c3e4e8, 0xc572507ca62fbce9, 0x30da796b245a72d1, 0x2a48b29f,
+0xcea4853a0ca9002a, 0x79d219707fce6dd7, 0xa089a62e7da6826f, 0xef8ebafdaa175880, 0xe4bf1a4d9cd3818, 0x8d2d0904de26e016, 0xe015e54f2cc655c7, 0x837c564b69fed5a2, 0xb9027568c9945c99, 0x102b94143,
+0x60360cc5f5de1b8c, 0x85400e788ca29fea, 0x57482b873b1759d4, 0xde6aaf4d4f7feaee, 0x6a487e30b953327c, 0xe328f0503a195340, 0x1ef70a77bb6b155e, 0x7553ebc7166a5d7e, 0x9cc84df9ab3359f7, 0xd9c8ea9c,
+0x62634eaaa9727903, 0xe4bf20174ffa544d, 0x1d6953a9ac2de330, 0x5ef4b8d491f84496, 0xf0236de97a7a75bf, 0xfd8bad2ed821e512, 0x9807af2c11398c1b, 0xeda1773d3cd6dd8b, 0xeaaff98c8a7d37c, 0x1e4fa4dc2,
+0xd858d461910fccbc, 0xf7e773f7e74077fd, 0xa97151fb896c18fc, 0xd4d9290573755b3, 0x2ae62c4055a4eb60, 0x101f1cd98eb3f948, 0x8433b1ca96ac131e, 0xef32715e79492b8d, 0x613dc48e9f6ff0c5, 0x19fdb7ec6,
+0x632121f0954b917, 0x72c327da95f2e2a3, 0xee28ca89b8b3fa51, 0x3cb813f8086df9ca, 0xda43a366eacd767d, 0x877372de00f81c0d, 0xdff2782e82bd95b2, 0x6de6ef6df301d2bb, 0x8ade3d10092ec3d6, 0x17ab6017e,
+0xf435a0c6018a614c, 0x24e91576ca59e0e7, 0x3e8937a0595dae38, 0x528c7cb5391f7c44, 0x8239018b13a60c67, 0x41375b50d7ad0bf2, 0x108b57b052ee770d, 0x126e55875dd421de, 0xa4daf13e9be512b6, 0xdacd3b92,
+0xcc249b5a6e4013f7, 0xc6f69dea644c776d, 0xbc457aad29579c29, 0xaeaed36c048b543d, 0xcacf1db2dc5b3e22, 0x2e00055a7ceddc3e, 0xd69d4f715718a2f4, 0xedfcee937daaae8d, 0xb3cbe4794bb98704, 0x1e4438788,
+0xec3e7941db118cb2, 0x77cad266c6bd5d4, 0xf3aafba337d19fed, 0xaac25fe3870433cc, 0xf72325d2cf422661, 0xd4d95ab3518c24b, 0xe5cd7efbc1b01df6, 0xa38f1d76684d8d67, 0x64a089903ed237d6, 0x18affde32,
+0x1e2977f7a5530c55, 0xe9cfb215bd05dcac, 0x5e7caae9b273c0f5, 0x1eb95cbf544e83b5, 0x1266fcbc208e297a, 0xebb8ccfdb96c9cdd, 0x3f66a0674305ed4e, 0x32688ba7e970645f, 0xb47aec96ee9637b4, 0xcc52156c,
+0xd6994b1b48e98e8e, 0xbfb1bb9777a91090, 0x156a98f660d3d6f8, 0xcf812ffc97c05f8c, 0x4f77fee571ffc778, 0xf5f55395d73399cb, 0xf477eb9aa1ff4fe5, 0xdf76cbfe718c0ab, 0x6a224dd01dd5e097, 0x182d71c06,
+0xbfda47bea5a2c88c, 0x1051461f15400199, 0xa12cd33264b63d6f, 0x4b743a29e791f6be, 0x64e8efa38b10ae6c, 0x6ad74adb583ad0e5, 0x39d852415b4ab481, 0xf60cc87d663b1a9e, 0x82db0d1423725fed, 0xff9c7aa1,
+0x5b0b53c1d20d68e3, 0x1ecc8b14da2a49a0, 0x892a062b6de07c07, 0xfa51b556746248cb, 0xcdc4b7583c661834, 0x8a5b4a823e75388b, 0xe7bfe01ac77cc7e, 0xcb6c6a945ab619c6, 0x30afe59484fd69ec, 0xec28a96,
+0x30f14cc39488a2cb, 0x435523ccfda155ee, 0xe2188a24492bf834, 0x855d61f63e36f9c3, 0x2a80624e6cde900, 0x9d755e4f00c17691, 0xa580f48eb2193e1c, 0x5d3398de504988ad, 0x7b6ab464d5f878e, 0x108c07810,
+0x39be885caef2a825, 0xd3c562b59c106024, 0xab35586375c09611, 0xf086f23333239598, 0x9be57610445de10f, 0xab96859c2e1403e4, 0x3bc9fda893dd10aa, 0xb693ecb54e74b886, 0x2b2a2c63b253e419, 0x9a2ea01d,
+0xd94ab6cf0932652, 0xd4257ad27689fea8, 0xd98d87df6583ed1, 0xc8d48b7f26115f5e, 0x48b7135364605c37, 0x10255c17d3a83b74, 0x376730bc3c4617d8, 0x780f48b9e1e2de81, 0x56565aea4a7c7442, 0x1df309947,
+0x5f3a4d040d9efcc, 0xd282bfe201375d53, 0x15da58bbcb167ca8, 0x12591a734664b527, 0x89414cc8dec5e7c6, 0xa87be6989eb01b77, 0x42616bcc6cc23adb, 0x41201ebb3511e9a4, 0x65a06fc69685b70a, 0x2ee4efe2,
+0x6480ff1b4c577eef, 0xe3c690ecb4ab18bf, 0x406c0361dc7385ce, 0x98ac2fe8a7345673, 0x53e112f0295cf4f8, 0x9f81293b28f53e0b, 0x5f70a365c09266dd, 0x79c298e2d81c0347, 0xafe7f65526124f7e, 0x25191766a,
+0xe93900fba4109aef, 0x700d3df99a6ced17, 0xd920ea596c71ae51, 0x735b4d3570ab1c22, 0x55f78e2beb4e19b4, 0x26b9479d56835a6, 0x7a25960a9dc467c7, 0xb54747fb222de4a7, 0xb982fcd382c5d0a5, 0x25f533eba,
+0x3e98a136ebb195ae, 0xa9ace3614c69191f, 0x9397fe43c4ce0d2b, 0xcff578acd9b2f67d, 0x6e664d3eb28b91aa, 0xa59a5c4875da417, 0x4a652d1b31153a, 0xe806fc67905685ce, 0xeea70b612154a7f3, 0x21fbcd47b,
+0x2ca8edc7076c4ae0, 0x711d9eef11e1d931, 0x803557e7d5d7e679, 0x49e32ce8874f6f5d, 0xe6ef0e3efd43c91f, 0x78dbd4a75ee0f1c9, 0x82b511486368ff90, 0xf2fb930b73be6fd1, 0x6ce79de87fb7e9f2, 0x6cdbe0e2,
+0xd1c7ce2417d37cc1, 0x3f7900c4f2c79828, 0x643912f9ddf2f374, 0xe357a7cf7564ec1f, 0x6787842371f1f123, 0x56448d720cf8044d, 0xfae8a032dd840484, 0x37ca1c0b1923dfe3, 0x409190668fd8d021, 0xd53c7be1,
+0xcc1140cb0ac0133c, 0x14c541ef93f79af7, 0x653f7242ca644e4f, 0x33be0faa19546a8f, 0xd9d2984bb7adb01f, 0x6a4a996b2f94cbe6, 0xb37c04abb619b90c, 0x274f34514eac4c85, 0x2b4f46e57df26e89, 0x258958334,
+0x5469f1713f8e2916, 0xabc5713d3de4f937, 0x2360b7919d6c6873, 0xd0eca61a38089e5f, 0xd5c78ef3b7ca41f2, 0x9ee268703cfca591, 0xbdcb44acf714223a, 0x70862598ac8a6d16, 0xb7079f0bda398b84, 0x1e0b7d55a,
+0xda20a8e0025e12c2, 0x9d16ac198b093170, 0x41024a67a37016dc, 0x98ab62d2cf494fa5, 0xf0e9ec2a1d1ce196, 0x1b2234cbeefa5441, 0x656f49821707a5a3, 0x6fabd78d7b7b4845, 0x34924c70262b5ab2, 0x1fb39f239,
+0x77164c140393c099, 0x6cd38c7af9c6fb3d, 0x720328510453bd19, 0x15433ea59e460c34, 0x1044e45b10fcf587, 0x46e125d8483c0f72, 0xf9e11b968e36e5e3, 0x8ad739ded003d484, 0x62d691a0321f9822, 0x1594533e6,
+0xfc62633aac06d61c, 0x2e33d5932bbc4b1a, 0x4a3884d37d34ba33, 0x5e4cd557f94c7018, 0x4bde0a46f1d220f1, 0xd274c66f2a3d7d84, 0xfd05fc2226ed5faa, 0x9800ed2397246abb, 0x33d5874af6c833ad, 0x17e7fecd6,
+0xcb1f893498459d9c, 0x1f07ee505030322b, 0x136e3f8cb0391039, 0x169089f06f7f5c85, 0xa9806fd67a367e63, 0x32724a211870e0b5, 0x810541b556a90e7, 0xf6d76ef6722f048, 0x2c2599c5ea8f91b7, 0x11ac8c90d,
+0xc1bd622928235196, 0xfdfa94a4958a340, 0xbb1cf1af6dac3fd8, 0xdb8622cd8de64206, 0x2e32d98448e1d3b7, 0xf287c58b15cfe46c, 0x8f8e1b1cd5c42800, 0x57b293449a6c2ac2, 0xe92c290dcb14e8e8, 0xc48c134b,
+0x6d333d33f1e28725, 0x905cdebf92e5ccf4, 0x979f35a0d940934b, 0xb004198192789607, 0x78e40abf5ea75f81, 0x5e65bd2e4e2bcbea, 0xd89ab0a88b539e70, 0x457f7d7fa6715cf4, 0x400e61ea6993eebf, 0x23d69c9cb,
+0x1b00c26966fcc4ce, 0xa4747599d3034e95, 0xfa6bf0f00b3ec69e, 0x6b4c9f6c44a97978, 0x50abd55a66e99591, 0xd1e3252ad6a01f87, 0x3064146c0e0f49ac, 0x2e8f6fb8447b5596, 0x5c4ac7cca4e5e3bd, 0xad4c549a,
+0x7c95d4a56f66eef5, 0xe1b2f7cbd2457efb, 0x32b2e09d069b55d7, 0x3eed370f84517db0, 0x1312f407752275ec, 0xd94e9db35c764a41, 0x70e09c3383e64b42, 0xf39dcc5e05f6d93d, 0x3809adbde542f9ca, 0x1c9d85a03,
+0xb9cff9bb65f41e81, 0xb600cf7d1613f708, 0xcd8f898a6abc5340, 0x4ae79e8c1c45378, 0x29c86df6b77aec36, 0xa412dfce97df9990, 0x5f5366c656b057d2, 0x7c1114f2786300b, 0x3adb7ee626f10298, 0x1758cf60a,
+0xbd0425de3d620358, 0x7bb751e6094fd684, 0x55ed286dc602c654, 0x6826bba33a33db58, 0x8a766f1cc31f9722, 0xef062f89401fde6e, 0x450fe86f88516fee, 0x6bf18d08e1033911, 0x349e540c34f7ef86, 0x1ed795acb,
+0x6fa02d7c9506c0bd, 0x790d97b1c2beb3a8, 0x6e1f9b36f745f4bb, 0x7db377378b639d5, 0x7442bf076b0466b5, 0xe5b676aa1ca0f84, 0x669c03ad71657f32, 0x51dfce57740aba53, 0x272d17164e26bd13, 0x2517edefe,
+0xc3792be48965bc7b, 0xf511846b5eb6c79e, 0xd199b0c86411f09f, 0x47327e74943951d3, 0x3897e42091649b6d, 0x700b85e876d0cef0, 0xe1a2440c70817, 0xbdd82e05a5f0ad2d, 0x67d065e453428bcd, 0x23e0b5bb2,
+0x7b27412e0211ddf5, 0xc54c866e65b387c6, 0x43d256f3006c1, 0x952b0d469dfccbb3, 0x3411e7e8447f037b, 0x1f0c13843c4d93c2, 0x9215af05f689fcc7, 0xc122f8bc85818bca, 0xc8a75d9959060bdc, 0x122cb155a,
+0x3e01474460a89c50, 0xf3c4e2e82853d6cd, 0x8eac0e358e7fabe4, 0x5ce635d6e329b3c8, 0xff530032a382fc20, 0xc072214e05e569bc, 0xd86bf43fafc1c626, 0x4d743a7ebb142f91, 0xc31ab8262572d48a, 0xb56f60d7,
+0xc4678c3bb97eb9a2, 0xf108bf4694586e8d, 0x4f1493326f1c5f5f, 0x3ff6d17ff3b01cdd, 0x6e11e8116293fb07, 0xc99d49a288c54a6a, 0xb9587cfe74ba5f94, 0xa0c7fe39ec43705a, 0x23fde64b291f809c, 0xe482d36a,
+0x8d6419253184121e, 0x3590ad547eb4d491, 0x16182c391382727d, 0xaa01e7a4f36db41, 0x97b76d4b81963c4d, 0x19c84f37cf1c0fa1, 0xa56b9729c90377a1, 0x5a13deb5d4840e0e, 0xb46894b3e5092f09, 0xedf3a616,
+0x130a3593a68a04d6, 0xaa46d845c87f548c, 0x210b4c39c63980ea, 0x8f58f13107c9b0c4, 0x8facd25853df7e1b, 0x323b44b5a09f7058, 0x2ed4f7e628e9f8ec, 0xe1c8faf9ae56cead, 0x30cefa2f590fb3b3, 0xd82eaeb4,
+0x4ee9c69a1516e97e, 0xc6f6fcdfe6d2764f, 0xd7372df5fb5cb28c, 0x8d35547708f0130c, 0xe8239baa6bc190c2, 0xdba2c73bcb51551e, 0xd32ccfe6108f8730, 0x8c35af429148f6be, 0xae3093df0a37a5a9, 0x250ec1627,
+0xe9cb53f4f073e8a4, 0xd4762c472a861650, 0x6a46ca9c8b1c1189, 0x9a8c30a2f1466368, 0xb1626b23081751e1, 0xc5275164ec7b70cd, 0x6fb1545a0da038ec, 0x412fb97d8a184b60, 0x23b8bbd50ed71a64, 0x217bf9de8,
+0xa3bfef995defd07a, 0x78ef2f39329ec99c, 0x25db52703350345a, 0x17c55e361a4cf6d1, 0xff1cc811328a2d9c, 0xf80e29360111fed2, 0x1948e28ed295daf9, 0x9e7220c17f7af112, 0x6e84e957628beaa5, 0xb54a69f4,
+0x679fdc68d5dd6a71, 0x77ccd31675099ee7, 0x2166a36db7665523, 0xab88292e1c086be, 0xabd79eb56e6bb829, 0x75b2068f0946dc3f, 0xd272000e58ded9ef, 0x4c582820f899c409, 0xb78e14ac33849411, 0x21227c1a6,
+0x9f40198e840221c6, 0x5ebb71f7bd6bae58, 0x35b9d7a054cee38a, 0xebba3d2a22b27868, 0x8e67856bc62ead9a, 0xa3281850ede17608, 0x9d1f2f2957c59388, 0x39c2227eb02f0ef5, 0x838452b8efd35f27, 0x21ae2cf00,
+0x6fd62341ba5c3f28, 0x21f2dfc06da5df52, 0xe779e0b19f7c0f4c, 0x4ee7cce903b78097, 0x26545603d9da6d35, 0x79552c9b97318425, 0x54d93943c80dcdff, 0x51b114df4ed28343, 0xfce9d465f1470d10, 0x93f5b46c,
+0x1c7525df40bbd468, 0xcb8675c1e9ea77a7, 0x7c89bd2651feff7f, 0xe2e22e33da17239a, 0xca6104b701c60c21, 0x8f09e392bf9d74ba, 0x264517459f8e6fbe, 0x40fb8fd3948986b6, 0x9ad48ce21ffb9d09, 0xd275351c,
+0x3b0465c7e162c684, 0x48e2a19137e14259, 0x8db213f10b45054a, 0x77d53ce1070620f5, 0xf7c83ff6a8c258e3, 0xe558c3f900c6b89f, 0x56d6990a832c2e88, 0x13d0cfc7b8b690dc, 0xaaa09d10e3608aba, 0x21f1f7d80,
+0x8533c36699c2f707, 0x89abd244a1ceeb44, 0xced5ee29617fd639, 0xea272b9d3e81ecde, 0x820582e94503f278, 0xe7b3b75dac86d249, 0xc85383f6b35a68a4, 0x90e64bd011ac9ff5, 0x7b5fe6b287283ea4, 0x1bb61856a,
+0x4472f691afcce034, 0x3d854115366c8d5a, 0x4d29998f8f702ad3, 0xc812e4b13076bab0, 0x2f56eca65f39547d, 0x1cb24d664fa57580, 0xe53a6bcdbef8c415, 0x31a6f835a82728f2, 0xf74f85577fedd30a, 0x120da3dc5,
+0xe28e2aae6929b8ad, 0x1915404cee9ce505, 0x4a0d091cd51d26fd, 0xab551e0a77a04acb, 0xd9b142b5f1752110, 0x7dc2057e5379316a, 0xe0e55ce8b3daa91b, 0x7928a6fe2f30d22e, 0xe29169e8f43c5751, 0x2cb7d5a8,
+0xfc079267ed7452ea, 0x6f0fc37402859939, 0x57a7b24b429ead1c, 0x35fb0213c31a7113, 0xa10e8d7af945f7c8, 0xa7ad3116da9d75f5, 0x38b6d54653b45eee, 0x5a6811e8f948f5ec, 0x7f85de570b2c04d7, 0x24a52836c,
+0x94364e8c913b445d, 0x663e2a14d3a04138, 0x6f1ab19ee62ec5b1, 0xf874e91db1a2e389, 0xb86c56895c5a20d0, 0xcef49f715909b2f0, 0x44970bd39782309f, 0xeeedcf09f379339e, 0xeee7c11ae292f189, 0x21445d0e9,
+0x5c74ad260f628452, 0xda1268abd7d79db0, 0x51390038ac757a3a, 0x71e01156d42cc9bf, 0x1f2dd9544a67f4a4, 0xe9237cff6853a46c, 0x25e6269e7d3699c6, 0xdf3f89d42b44b97, 0x38a5300e489fddd8, 0x9f6030df,
+0xa0b847ce198c8959, 0xa2c36a8829e5e68e, 0x7c14937161f2ed41, 0xb4f3ad3de58da84f, 0x6c0a712a2849e696, 0xb8ce0bacbe2f0bd1, 0xb25b89336c612133, 0xffd7480edb82dd07, 0x42af5baf145bfc44, 0x14c37e473,
+0xd1e88469f0ed5cef, 0xa026646346366c71, 0x15f59cb6a238af17, 0xdedd19c6fce245ee, 0xd3f4590a75cd5445, 0xed9bb20a498f6342, 0xf3864dc134bce000, 0x3ce92a5e3ccf1bb0, 0x635cbe5c3994ea83, 0xcb772e29,
+0xd6484eeb44aa2213, 0x99072b9aabbd9a70, 0x75bb94836a0f1a7, 0xf93a467874ddf8f, 0xfe67db9560eff4cd, 0x3fd1ef59d1f58173, 0x7244f2c3006a3fd3, 0x12ccd3566febc4af, 0x345540f01deacaa4, 0x1be6a18b4,
+0xfe96994db19a7d55, 0xc839827ce059125c, 0x688caea7baed7936, 0xdb5a065e20f671fe, 0x633caba549fa0e8e, 0x827f9ddc20b209a, 0xb0fdd6910e4c8ad5, 0x821dde0bc6d34ba8, 0xda6eddfb8c6d2623, 0x27130cb4f,
+0xc950d46a1746ed7a, 0x2ce70b3ebd3cb579, 0xb4058c6b1d3c31c7, 0xa5116a8672416b75, 0xee57a6bd2522d67, 0xc144800cde99f54a, 0xf2456fe1def43ff8, 0xe30fc64f006ea498, 0xb591e6f73a45fc85, 0x23ae1495d,
+0x23cc087629e36b0e, 0x4fdb55c5d903e410, 0xcff2e4bc2fa0cfd0, 0xb59a13b4d773cab6, 0xa51db3d023fe0af8, 0xb11f7226580c3811, 0x632e46b831b42d5c, 0x98bde3f6a39d4977, 0x4b3b3a5f1c3218c0, 0x14ecb410,
+0x8b060e77f084d8ea, 0x971b93dd503c17d5, 0x4002b8de021272a6, 0x4eb3d7c19a592477, 0x87b9bc0b264cc382, 0xdcd93e7295f69adf, 0xf4cf84a31c4cf501, 0x5b67e8a4b6b8c70e, 0x8b96c7943a19cba4, 0x28b06f9a,
+0x380aba0b6d5a969e, 0x8aab68aa52b53ce7, 0x5fa2912607740686, 0x54861a2e6d0a3eb9, 0xecf664e8210e7f9f, 0xf73799eea78e044, 0xa2166f9e4d96601f, 0xba7c9a9110ec58ff, 0xb3b3ff8668d3ac2a, 0x11cbaa47d,
+0x8078f1010e08e213, 0x70207c998478ebd4, 0x2dd4477ecfef6b42, 0xa4d822bbaca52f2, 0x94e467d0c0725ee1, 0x2fc5f83335d66456, 0x144aebbd9da8d79b, 0x96ffc889dce1e080, 0x5e9e2a926bda3ec2, 0x1358e5e85,
+0x423309a86ec8887, 0x67452653392ebd79, 0x12ed2e3435877eb5, 0xd6cf7dd2a47b0cf0, 0xd6988fcbe946cd08, 0xe50c8d87651027e1, 0xbfc42676faefceaa, 0xe53d319ff0c3576c, 0xa1cdc1b378771d3d, 0x2154d2588,
+0xf361fbd630b5b25c, 0xbb33ff4d2a2d96c6, 0xf9d9578ff8f97652, 0xaece646f1425f432, 0x5a0f104789ab6ffa, 0xc4676520405ace1e, 0x6d9096a67a5b3feb, 0xd373c5d0698140b6, 0xf183694591ee4c8f, 0x21ee344dc,
+0x64eb472b28e9362a, 0x674280bc72a68d0b, 0x66f4da08d573123b, 0x4ba587f77b8e4419, 0x67119c92b5b7cd62, 0x3aaaec0ef80dc884, 0xd81ff361907f748c, 0xd2ec700ff7911eff, 0xcc2f1b2881c4f2d7, 0x1e00b2805,
+0x15ec7a5dd17697e6, 0x428b133361f5fcfa, 0x5f9c2998b4ae6330, 0xf2f187e26b4e27f8, 0xad02cb748cda0c50, 0x5126d47d9b8b3f4b, 0x853668318f1c00d5, 0x632c42cefc968b76, 0xc8ceca2904e34ca1, 0x150974f5d,
+0x1eabb77fc6d391f4, 0xe9019d525059f169, 0x742aa7cd7b96ec07, 0x2cbd3563bd59812a, 0x345f5277e1f336e, 0x2ffb0e73943b27cb, 0x8b8d07878db22c55, 0x6cb09b17df02d0c9, 0x6c47c41658b9e7fe, 0x9bb51663,
+0xb58eb2728137a35d, 0x3d475813c1c6fcc2, 0xd1dc4afd087a6c57, 0x90d6bad357ee64ee, 0xef485531595e43fa, 0xfcfe82352e9af33a, 0x599ad9cf37b01843, 0x61b424119312c4b0, 0x8f6de9a25845f11d, 0x270021b7f,
+0xbe081ed2f9ee22c5, 0x625fe611c094d650, 0xcae305494e17dd5b, 0xc4518488de4bf876, 0x40cdba9493e8cd4c, 0x9b8b42f169cb98da, 0x63432b8eeeef564a, 0x1e3f42d6a9cc38d7, 0x996ca3cec272fd7, 0xf153a27d,
+0x80a781565a1ccace, 0xb8b190f49b47f12f, 0xef7553b54ddd2bcc, 0xc156b649c580aa5c, 0x7268407e36b93385, 0xfc155ed40cc15aa8, 0x34b1ac84d7a35d8e, 0x1d36d249b9740ffa, 0xbd0f647a6f420451, 0x1f03bac68,
+0xf2736f95787ea35f, 0xfd1324fe80a32057, 0x9492a32948216ed, 0xd0e1da76a6702eae, 0x81d2d8a2c9018d6b, 0x4e76b9bf9de40c5b, 0xf2e7ebbe21c7f4c, 0x806f9a5d04cebe4a, 0xcc930dfeaa2a486d, 0x203efd9ee,
+0x449bfead5df3c039, 0x85728d711f66920f, 0x9ad8ce684b1cdd74, 0x96fe241eea0e1dc4, 0x733bc392f316f1b, 0x83a748d55e53b05d, 0x5c7ca0b61db07658, 0x161f79ca7b43e32f, 0xa65958a8ca8a0c4, 0x24fda03df,
+0x25bde4c4234b9fa5, 0x831a4a4154ae23c9, 0xc8ad672768701080, 0xa7112122518aeb85, 0x9c2d5af35572da07, 0xa455e89deea5dd92, 0xaecd5ff337ad07b6, 0x4c68682f7e7bcf03, 0x9d391f105ff737de, 0x25fc57b9c,
+0xb984a10a8bcdee4e, 0xbbf5371830ce7edb, 0x123494aab72e3ab4, 0xf8ef100a984dc639, 0x668e23fd1148b518, 0x30147be9af62c62a, 0x3ad15b8535caef9b, 0x4256e30630dd9ac7, 0xb1d2d51524f0fe32, 0x254b552be,
+0x87aaed33d5d83aae, 0x7b334172117fa45a, 0x91ba797a4e70c46b, 0xe6a5e50567ffa709, 0xddad276042511f9b, 0xffb3cfb809ff5ac2, 0x43666d0f8dba2b81, 0x1efb93cc7120ac, 0xbe490911312d5ed, 0x221bd625b,
+0xacff5245e7ba5286, 0xe0126495eaa012c6, 0x15da2f05ee0adb7, 0xab7f1730bf31602b, 0xd424fe2931c328a0, 0x1d48d35f762e20f3, 0x21d6efcda2791df1, 0xbd7f40b4129d10a2, 0xdd0af3c42e187f97, 0x59dc7352,
+0xf98c3b62a14c4e0c, 0x8f9ec444a18af324, 0x2bc634bd97ff4727, 0xb4421357a13b7d9c, 0xb58edcf621ca1133, 0xbf26fc9d857bee32, 0x57c241197e9082bf, 0x9df6e7b98bf3a253, 0xa734908ff658d9e6, 0x11195ec46,
+0xff00221ad011656e, 0x653633fbf51b8d02, 0x648ff69ed5ed3f44, 0x845a13af06b1b440, 0x24003baee6598810, 0x488177ffaad7e129, 0x398b5f894a6ee330, 0x8189623e2a5cbea0, 0xfa64176c916ddc4c, 0x20f4de01e,
+0xcd660fdf3628edf, 0x7c325d5074199b77, 0x36e11251f2d4d3db, 0xc8a0b10117536f0a, 0x1229f807218b5411, 0xd7e718093f6a47bf, 0x24d2ad583e6b85a4, 0xb041ce4fa37153b8, 0xce114c05da98cd01, 0x62aab8ee,
+0x478f13bafa310feb, 0x5668dcc0f3166cd6, 0xb620eaded0d03322, 0x235bf479b35be1e8, 0xd7945a87d0bb2a5, 0xf994dcc4849b5a88, 0xf6d89a6d2e1f7fc4, 0xb3f60c037bacdbd6, 0x4b056f6c31edd0cf, 0x52062095,
+0x280cf92b02706457, 0xf0640fa1a71f876e, 0xe4ce0e18cf4afc66, 0x17ec6d3257a064d3, 0x21623bbcd0e10b9b, 0x815c40adfccad5df, 0xf9d24f0fe9cc4a81, 0xbd0a93e19f922317, 0xbb01f954fddcc917, 0xf0af4c30,
+0xb328aa64dbdca21a, 0x8f7448960f6dc4dc, 0x24b0d9ab785445d9, 0xc3a1a9f91cccff93, 0xf52ef6df422c5d11, 0x4ad247b2adee4a26, 0x1dbf68230fa40961, 0x6bc6bf96e8666079, 0x91cd9b300c0bffd7, 0x1da64743c,
+0x38ec033792d900de, 0x9fdea8c01576ec0b, 0x904ef6e4324f4e6a, 0x150fb4835ee47462, 0x31ac478259a5cc61, 0x5835348d96c1d1ee, 0x4e1199dd66aae83f, 0x654c8c2048908df6, 0x96d8d637ce928b3b, 0x165024ec3,
+0x2d2039ca1bebee08, 0xcfcf2f3409cac4d6, 0x861b8aa99c053958, 0x69739c76748bea9d, 0xd2ecd6b538a615f5, 0x64870c0e63fb0e6c, 0xa2b57821f9afd0ac, 0x9a78d9eaab5913dd, 0xdbec4da549d3aef2, 0x226bd2972,
+0x60ff75d4dcce9188, 0x6a19803f40c10464, 0x35e5f2935b076798, 0x676cc50bb20e8cc2, 0x9d0bc72fe261ba94, 0x686b029fe3afb26a, 0xa9f14072e6d59133, 0xb0e88854ee5fd845, 0x329662e70babc080, 0x1532c7023,
+0x9e23b48cf8c7413a, 0xfeb25bad63962a13, 0xafbea3b5b93faa80, 0xcdf2ef16558aba83, 0x8a668e296568609, 0x18f93ae8ab7de699, 0x21193a2ae05dd78, 0x709461f7e6313dfd, 0x645e28c2d72dcd15, 0xbda6fbd4,
+0x9c2392d8ad1ada25, 0x3d97d1b1b4765f42, 0x8270698ca7722f74, 0xfb5d55631fe634b7, 0x71fecd2fa9efc956, 0xf033095ff38f2f92, 0x5772820e7a60745d, 0x501ccad35718648c, 0xfae45831416548c1, 0x17ce9cc14,
+0xdecc85a8d6451cbd, 0x64260a33ab8e563, 0x639e2a1bce158d23, 0x8291bb1b15d2a320, 0x40f1321caa3977a4, 0x5bc9deba034caa8a, 0xf07a28ddbda05dc8, 0xbc0ca731091c63b0, 0xdd2e43c8650a5c7d, 0x18385e25d,
+0x472911141f05c338, 0x6886a64f4113de0a, 0x7b8ec9252749fe44, 0x144d81ea7e95e9b2, 0x68b615b8b56dda31, 0x1c818e0aa7e4c08a, 0x2a25cdf82ba6b5e0, 0xc9bdfbbf5c8794a9, 0xb6899996510583d, 0xa8374740,
+0x497b7f2f6a561723, 0x3f57001ce417abcb, 0xaa89a93bef3cc795, 0x1e6650906806c853, 0x898e1dac2f4a0d6e, 0x89af51cb27a3c5de, 0x19b26d309ba14c63, 0x2f647cc62a70244d, 0x576475657ab3a35a, 0x1a7c9d896,
+0x1a3e12fa70cc8a2d, 0xcccdbf9a829bdb75, 0xd8cdb8f42476ec49, 0x5a310d8b2e6ac229, 0xdd064782ffc009f3, 0x8a2af6ee088c7c50, 0x8cf33be618633f01, 0xd95c2d114598fdf9, 0x3cca190277714a46, 0x26a22aee7,
+0xdac139ad701d292e, 0x26f13adc8a451f1d, 0xc8d4617f581425a4, 0xa2c60450e4802fed, 0x879dc83bf0800910, 0x3c715c1c42094fef, 0x9b10305d9283ec45, 0xf490a80af647e955, 0xcc2fa0bb3fd4479d, 0x13d90c1a7,
+0x98a65d7a8e0b1d0b, 0x1bdead7757660cbe, 0x868f074f20ba4c6, 0xd7e3cca9a57f7078, 0x6e1db3d5a7e53c7f, 0x22d2982ee248f778, 0x167dc547fa0107c2, 0x1ca07dc125d586a4, 0x59c37451b9402ecf, 0x22c5a3495,
+0xc62a131731cce56a, 0xb6ef702e25540007, 0x7374358d10a9acb7, 0x202a5fd2e3a467bd, 0xe5499447574f084b, 0x6908e321c4aad2d5, 0xebea61e046745744, 0xa564bb9c2d25679c, 0xe07213129d95eda3, 0x1c0f8ae17,
+0xf585e93ca433514d, 0x3fbf00131c21780c, 0xbdf3131d83df7f2d, 0x6988ad8d4cc51b5d, 0xe8a44f60d8f79efc, 0x181f75041c9cb90e, 0xc458ef24b073cf6f, 0x8160660f94159dd, 0x2774c1f969b2a101, 0x151ed33c0,
+0x4e7ad28e836495d4, 0xf4258713176a7681, 0xfa16c965f568cee5, 0x6f24a661cc71abac, 0x20421a8f6748be91, 0x65618ec8b09cc6b, 0x31b15560a2a60827, 0x9e477add45a55c1d, 0xdae1e6ce1e7dbbe6, 0x941b46ea,
+0xc5f4abb538f7dc0f, 0xb951281cd34f3c1d, 0x6481fdc1bdf3bbd, 0x198bb90cb9b30ab8, 0x81a98e809788ed4f, 0x7dcb5d9397c734af, 0xc6f5bee927d3c1ea, 0x81893f700f940cde, 0xc42c527f43145625, 0x5bfe3ee8,
+0x674677065093e36a, 0x4a18363f67eeeffe, 0xb174d38dfb8924a9, 0x2da244109baa85a9, 0xbd4fa8f02388e4fa, 0xf0892fbfd73aecf4, 0x76eabbe13f8ebf4b, 0x77872cf378cbde2b, 0xe6200591540eb08d, 0x25b856d47,
+0x81eb489348317893, 0x5d44ea9897238515, 0x66b5cfb349603bd4, 0x8b484123ae17f78f, 0x67bce00946748b28, 0x89f984a8c0897f57, 0xfeb973179bd4c419, 0xcebb74e81493e838, 0x8792f703e8210ff8, 0x1d72ddd2b,
+0x5c720aee5f9cf88a, 0x2bf40518857f1bd5, 0x142237cc82435ecd, 0x8b4bf0e1af33172b, 0xf0d60ce7b7f5f3cc, 0x20f7a84524cdf8f, 0x2d4a01b4e5fdaa24, 0x74be95463ef4d88, 0xffd111ba4ad5e3a1, 0x157ab0d07,
+0xb28d8eb5a829c695, 0x62059839b62b96ef, 0x785887f40e0a5a31, 0x619a203705b7216c, 0x2ced890667dfc2d1, 0x42517d585c2c5621, 0x89794cd97eece611, 0xa2cc1e241795368f, 0x5f292acb8c8d0e03, 0x11f12ae1f,
+0xf387b251f7ed79b9, 0xd68420f152c43f3c, 0x8f371baf3ae88ae6, 0x6890aed57cb66813, 0x3461ccc8fcc6a7b2, 0x5ccb6e607806b90d, 0xc0c16a1196592f31, 0x9564f24857079421, 0x5117c246e127f9b3, 0x343270e9,
+0xa3f893ab7fea148, 0xe0af90f791ac688b, 0x6d6660d5868cb538, 0x1b7e261d1486a590, 0xb554b1d067ab9da7, 0xc7bb776f20c30901, 0xfd78bed46105285e, 0xfc4a1066c7f32f0e, 0x31fd9e6a91709901, 0x1911144e2,
+0x364f6f929c356e5, 0x48245e71b9558b4a, 0x6df742ddfe979398, 0xe4bfa6e1c9686bd7, 0x4da4026cf993e00d, 0xf3e41daf82d01931, 0xf406af5a73d0617e, 0x5fbcf1c686def39a, 0xa69c9e80194e1e5b, 0x1991fe154,
+0x9e5fff7f6b723f6d, 0x6c692c61555eac63, 0x4123da568e67e342, 0x586e04da3639546e, 0x1b598ef19b5cb1fd, 0xdc97d91cfe2f4877, 0x6564e77af74f82ca, 0x3e333896a87d503e, 0x50570fd3e42592ac, 0x1f1df01fd,
+0x470c3a26601e7c58, 0xc0c47ea9d123ca34, 0xf0748c608bbbcf94, 0xde03ba2190f59450, 0xc2bccdd43fd10249, 0xb6b4be3dbbc40ab0, 0xd7eb17d177f18e1d, 0x277e478f9613fa18, 0xe41aed09464c5ae6, 0x2208a3a38,
+0x61aa1e9406f99d61, 0xdef66061105b886e, 0xa8d663021aab19d6, 0x1efe6fe574664c5b, 0x48364940cebbf816, 0x3b9ac88cd2c5d0bc, 0xc82515150e88e3e0, 0x311ad47f7996e7c, 0x758d8131f44dee83, 0x1e504fc78,
+0x5a4453104876c2b6, 0xbdeeb4da685b4003, 0x1a32d2ea0e16c455, 0xb89c093917bc981f, 0x379f60db6be0f914, 0x12d7c86904a9dd66, 0xc0f39c420b0bbda3, 0xe35dbf76f0efe3cd, 0x14be8bd045cf3028, 0x2577261ec,
+0xe60b3eacbf6ab670, 0x2b898361f972cbe4, 0x8b82fc9195a6fbf9, 0x93a575d37d1d6df3, 0x7ca46d69aabd7c52, 0x6d004253fbc90da4, 0xc8161f15c8c62777, 0x7a61a14524e525e2, 0xe4f9df901d271aee, 0x9ef3146d,
+0xdeb5965c52f06553, 0xf764d334e08ab2b, 0x8be8c191b0d3925, 0xf5febcf4dd631f08, 0xba1d9ec5bb434f8e, 0xb38563f4bbb73ed, 0xcc163aca09181c21, 0x7b85603f505c45ba, 0x839bdea756e94b54, 0x124bc13d7,
+0xd7861fb9acc72e98, 0x1ffe0365e77421b3, 0x20025e30af7f8684, 0x665ac570336aa030, 0x81c857f22a9e701d, 0x30fee34700088444, 0xc23f243616200084, 0xfd5db335f7073f54, 0xcef63b062aaa02f5, 0x572df6f2,
+0x6d4da7d0bfc4137f, 0xdca2361b5f3c30c9, 0x6ef11a916507c979, 0xa77417b885efead2, 0x91c8293d98fbb85e, 0x99f0ee2fc871a5f1, 0x501c746b0e47f589, 0xd537ff10b60ee199, 0xa56ba9dd7fc5a83e, 0x7733d4a9,
+0x301b944f68778894, 0x45e300c5a7cdc394, 0x298741e8b97ff9b0, 0x37a61fd5f690a521, 0xc2cf9c5c9727211f, 0x1ba745fa4405620, 0xa16d5c262d03364, 0xa76ae8cf845776c1, 0x7fc9006044a9fd04, 0x17a2dc615,
+0xd3a4372390122c4b, 0xec25e674d3e4f18a, 0x68d041774bc5450e, 0xbd4b40c8c30f22ca, 0x797a3f9a71aa7f97, 0x7293b6f71a74c24c, 0xc8487f8adad89c7, 0x45bf8970ee279932, 0xf0cc8d43e618f919, 0xb6c10ff3,
+0x4430cfcc28b397f8, 0xce9bf6d0a0c03deb, 0x6dbbba4e66f9a5ac, 0x4275c07e769dc239, 0x873e8f8af637a36e, 0xcfba3599880a1803, 0x805981778198a507, 0x3054b4a270a76b57, 0x4048d74b27f5e361, 0x23b1f56e5,
+0x7080deca4c1bdfd3, 0x99db325c127afe1f, 0x753ed5f5ce1aac37, 0xf3b8c3aa48747990, 0x736d1ad197c285b9, 0x6f40f3d5539bbf0c, 0x5ea06890af24a127, 0xa59fe6205e87d3f3, 0x64e9a320206ac354, 0x70a29d0,
+0x12275387e78e2384, 0x13a2fd58047d1934, 0xf38f1d2c21dbd00a, 0x2a5f9c43d2a5b060, 0xad6a309b7f444c9b, 0xe959eefcaf7e0445, 0xe00748d76ee93f2, 0x99505186de868fc0, 0xbcebe4cf614873a, 0x2f03534f,
+0xb5b60fc3af4c3f5f, 0x516f7d4d4d84b0af, 0xd6563def453b717, 0xbc6fb594231c7c5f, 0xb51d71cee954a651, 0xd7518b417e8fc71c, 0xbfacbc8dc26a2119, 0xa24d32001fbdd550, 0x8bda39349cc5603c, 0x100783385,
+0x9dc6de50fde6cbf0, 0x720e27a35441a6ca, 0x48e2cef841fae4d1, 0x7c04a8166977455e, 0x60a118dff1cffca6, 0xf3a2471ff7dd0e04, 0x299b0a2aba22a536, 0xed74f684e5da8f1f, 0xf9cd07652e70a81e, 0x2e5d8c5b,
+0xfbde83423d0efb35, 0xd6b8d96513355ee9, 0x8fe80e027b523b8e, 0x42040875878667f6, 0x73382355197d574c, 0xa0c7624b26f2c69d, 0x5f07955857e46a5d, 0x5c8477d4901d911d, 0x8e0e15f3ca287f7, 0xacaeeb2e,
+0x1b4ccfc361811e8c, 0xc25a61ccab300326, 0x2b14897ebfd1a7e5, 0x38d87147eb1b1a74, 0x404419e15cb03e09, 0x4e18f7e7c3f93672, 0x840a96ac1502b21e, 0x6786251cdeb75c9b, 0xacb76b55727f45b, 0x119b444d7,
+0x892a82d4eca1cf31, 0xcee776d837fac749, 0x81443df800db10af, 0x4eec7b6deb8660fc, 0x2c97385ba72a7fd5, 0xb7f7c163d50fb9a3, 0xfc7ca6ccb710f231, 0xd62bd16946d4fe29, 0xd4ae17332bb11ae, 0x1a1ee1c18,
+0x86bd5fa1f4ad87e1, 0xdd7905bb2e5bef4, 0x4db816b12ea8242b, 0x881b151685425d69, 0x8b1e71f055ff59f9, 0xcfeb441c198eb939, 0x2b086a91c93d5b43, 0xdf60708c52f006ae, 0x72d16f5d1df97467, 0x42a39b12,
+0x90a8a69152a5cb78, 0x23da464c151b6281, 0x8f99069e7d6a85a2, 0x403be7b5567e3f6a, 0xc2f30e08bf19baa7, 0x9b658f274edea285, 0x427f0dcd40c5b053, 0xcddb2fc119832766, 0xa0b90f45f3a4d43b, 0x1da0a8e8a,
+0xc1a3990de8dea3f4, 0xe106bf169988e458, 0x420d0ec9b758e17e, 0x5a02884a7b6b5b0, 0x3afae13576ce81cd, 0x4c4da0000dd047c6, 0x6f603531f2a3335f, 0xee92c6c2bff65d91, 0xd33ce33affbb2d65, 0x173ba723e,
+0x5dcdde81cc3f087, 0xed0d9409e5dfebe2, 0xc771ffa45524e97b, 0x621cc297243968c6, 0x6ebcf08ddbf3d48e, 0x8e45f13c358005d3, 0x157e3a15d226f8cb, 0x8e3d5a4ae8442444, 0x45c9f4506ac6e76e, 0x19cdbee4f,
+0xcf0088977e800f6, 0x6c688ec211cc2f3e, 0xc2c951d032c815fc, 0xc1d5c17cdb826e76, 0xc776ab328abe112b, 0x289e7864fea91414, 0xc533eb0e741ba406, 0xfedda3a59d9a4ba9, 0x81dea13c5531276f, 0x1e00d3d91,
+0xe447a2e165eb238f, 0xc0b8d64fccf0b684, 0xe1630b9229d39845, 0x10845a160bffb1fd, 0xaee1421e37ba0821, 0xd0e096d6af534dea, 0x1240356dd84ee4a9, 0x5b752afa1cad19b5, 0x113cf274777ea1fc, 0x12d5f3cc1,
+0xb93d1ecff4fa2fd5, 0xa41be17225a19b53, 0x3f0f8dd867a1bbb2, 0xd166f97b6e00197f, 0xc3e41a7d1e50be6e, 0x4ea66215ceee78ca, 0x603f580c5b8f4dc4, 0x13b693e88a284927, 0xc3da5ac82ce3029a, 0x1feb94a8c,
+0xd0e6b63c8b853f81, 0xa3c4fc6b94ea5446, 0x27f7af5ba21fd907, 0x142cdfb218290a1f, 0x24591d37f068e8f5, 0xe5a5a43e208b851e, 0x14d5c2ce1fa0f5e9, 0x9462ac2da7fc213a, 0x6f530920f1794f8e, 0xf73796b,
+0x921d9f76cac1c001, 0xf056c17bd9ad0fe9, 0xa31730368d1d48f, 0x4c94e1638206a5e2, 0x1f12cfcc6cc4da0d, 0x498bf0dfd30b5c52, 0x4b32bc6052f90011, 0x622c5d87fe1f2e52, 0xa0a7b57ce10516ad, 0x2721fe3e5,
+0xe94450794f054f5b, 0x852a3e346c25f1b2, 0x9c4a9f261abc7339, 0x45e935af3e855bd1, 0x8a81605c7b7e029, 0xb793f6c22eab04a, 0xe8aacd0daeed5f0e, 0x41c86b6d0b358476, 0x2cdafe83e98b7310, 0x1a0abe566,
+0x7e997282111eaf35, 0xedca4dba31272de6, 0x3f29c90888a4c234, 0xce0ab0ecdb2d270a, 0x93de3f131a55c06c, 0x8fc78c09c6a1e587, 0x79c3ba4a7b287f06, 0x8b036c5be31ac50b, 0x744b3f8ecd61a961, 0x242de42a1,
+0x143fec85ad29e66f, 0xcd8536e6fb0a580f, 0x414eafb041c05e11, 0xc51aa3c61d2196f, 0x533ec6276a301867, 0x6abdfbcb3445515, 0xb2460dbcd08b94de, 0xeb8ddb48f19897e, 0x649ab2a4b762395f, 0x14fe6bbc4,
+0xc08db7b40343f6b0, 0x6a2ec4677239c591, 0x9cf58f1edb6cc898, 0x65f4c2303b0a5f51, 0xa46440500f8e7a19, 0x2e86ca06ed013357, 0xc07214be23a498b9, 0x8b5a1820d234addf, 0xbd17593b440f8644, 0x2458bc06f,
+0x53e68b1381ef5830, 0x7030b6930be00de4, 0x8c98e8f32bfeacc7, 0x7820d653760b83a8, 0x73ef4cc7b854369, 0xb096690bb9c20a8, 0xf41ecd97a4861306, 0x3fe5597d8b85c8da, 0xf6caeaefa529605e, 0x7d1c5a95,
+0x912fc331d2549d90, 0x3cc05240fc5f6fed, 0x922341008665bf31, 0x2dbfb2099a12855c, 0xea568f0b66cb5274, 0x1b616e5d5c7afb11, 0x6bd56e15a4002449, 0xc2c04c9070d03e9d, 0x77c060261172d571, 0x1270257b8,
+0x9b8a8c92eac2cff5, 0x6668ca19d5dab6dc, 0xe39eb25e03240f7b, 0x92d0d0c300ac76ad, 0x9083c3d305547ba0, 0x2e8652c70caf5e5, 0x4f94ebbc53a7ff88, 0x14c8a3c9ba4ba0fd, 0x6ea5fcaa5cd78596, 0x1fd38b86f,
+0xac6ac4456ba58b63, 0x4634d20ea0cff198, 0x91baced4d037b11a, 0x8910ca2d63a18ba8, 0x3e1551e7047ec4ef, 0xa0aa18e9e17c2422, 0x9ab8e0e14d2aa81, 0x4c7caaf0e8c5a567, 0x371acea5afc8281d, 0x26febebbd,
+0xe9825fb72774f450, 0x9d47a90d9e02c727, 0x872ccad4c101e3c2, 0x1b91680725311cf9, 0x5264602df16884c4, 0xa8df49739eec3018, 0x8a7e3fccadfd0572, 0xb50157173ee69555, 0x9d87c696c6adf693, 0xcdd6357,
+0x6913b96db74e7188, 0x225612fdac660a4c, 0x4f6aad7dc7a8bb8d, 0x8000861e54546f0d, 0xf300f74543fcab04, 0x876a12cdc1fea4e9, 0xc42bcb329ec2867b, 0xf1f4ae46736624f, 0x7260e1199a785ca9, 0x4b8f1e6d,
+0x8a128e393b069278, 0x8e9d8a6706a0858c, 0xa55a19ce5fbd3abb, 0xbc94994744d45c60, 0xd6010d5124c9ee2, 0x8aa258ab5fe83ee4, 0x42af06a6977b8c49, 0x480b7ad011d6442, 0x621878a487e3975b, 0x1b6d635f8,
+0xca8ffc4b497c902e, 0x6608041fc7be8e61, 0xd34348a1227f25b8, 0xdb6fbd78c638e50f, 0xd83920136ebf7dc0, 0x6e334b3612b74435, 0x16db4e06f1802005, 0x8ca22a09d96b8654, 0x5405acdfcb2c0719, 0x113f3bf89,
+0x59fc8ad646607c7f, 0xf7d2e189108c17e9, 0x598a00c3d2559bab, 0xad033d5a91dfa935, 0xc41118aaf805c2a0, 0xbb3dc4d32c2cbfa7, 0x797f4a56c6cf18ae, 0x520a4ca8dcb5caf8, 0x1958f01b2efb4636, 0x1710ea041,
+0xa1797b5a1a4a98ef, 0x61b8e8171982c183, 0x30986068dff5c727, 0xf4a41d50ca980aa2, 0x2d35ff7f4c0edf1b, 0x8c83b6da4fb6aada, 0x4247241110bb20eb, 0x642b896be743d0b8, 0x9e8020026b8f5c1a, 0x256dd0f56,
+0xb052639d578d6bbb, 0x88d8e7886a5e0e65, 0x663c9416fb40a2bb, 0xc3a3fa9bb8eb18ac, 0x87c058bdb62efec9, 0x15ebac3d3d0dfc1d, 0x381bb7306d3eb9cf, 0xe401ab779e7b6be7, 0x85cd9fa3d9906bff, 0xc680b27c,
+0xcda9533eb12379e9, 0xe6d87ec7027f73c7, 0x71524b5f670ff0e6, 0x367d44a8ba551082, 0xf7034759ffb3defa, 0xc8c52ffb0f77dae7, 0x7ede1a687e98f4a5, 0x4f56540c9e167367, 0xd3b7e78d2f5a4fc2, 0xfc10b11a,
+0xab495ed0f37a4c4f, 0x76654d796a0c32fa, 0x9bbb362663019c37, 0xd9004f4aecfd4116, 0x6923d4ab30d9fc1b, 0xe0a5d74e3beab750, 0xb031004805458864, 0x2790a796a796e0ba, 0x64792f1d1415dac5, 0x17d0ce379,
+0x5e19ea2bf8704350, 0x7af73d53cb4b371a, 0x89f37c136c28427a, 0xbebd0eb88b2d611f, 0x21b4c39cbfd5fc09, 0xd90ce48b82487bf9, 0xad71bebdf65d9e37, 0x6697471c99b7f823, 0x5f053f4248761783, 0x109112827,
+0x1473f280245a0f40, 0x834230c5699d700c, 0xd6e43232d458d343, 0x3d284044e32ec317, 0x78c4346714ece44f, 0xaf65acd85ee2ec16, 0xfebb7a12b2d0266d, 0xf86e30ade2ff1518, 0xec13bc5bc2fff97e, 0xa9b8f771,
+0x71d9ffbc67582f61, 0x7889161593b835c, 0x297747860c3deba5, 0x7908d079fc859cda, 0x1f4b98b0bd7de042, 0xbf2d80f5b5b7e615, 0x5abe61ae73c29296, 0x84ae8dcbaadb329e, 0xdbddaf660d6cf545, 0xaf7dffff,
+0xc6c30350378e3716, 0xf02473a106bfa5b1, 0xbbdfae7cfdd2b4da, 0xeb9d4e93456ce265, 0x885e7b36f1b458cc, 0x7e89fe0ff55791a7, 0xe0ba06974718b95a, 0x36419918888f749b, 0xd8726f4107eda120, 0x275496116,
+0x806042a5f9cddc1f, 0x127ec0472cb1ff82, 0x88c7cadd22d3ac23, 0x3c2f62fa9ec34ed7, 0x3ce20b56ba3605e, 0x4992bc554774e7f5, 0xb95199e5c1a3190e, 0xaa1c09bf1cef6d1d, 0x64d69841578680de, 0x224e84384,
+0xe969469b9626b82a, 0xf16aebb4aa0af00c, 0xda8aa7b1fc12c87e, 0xfbad0628c3404847, 0x42d5f26a19393e78, 0x8583762496042623, 0x4afbc264f8d5448a, 0xaaf0b13ae0dc80e0, 0x64b88ff89b990d24, 0x18cd5efc1,
+0xb4dfdd67d2202bbd, 0xe977ffce6afa2d02, 0xb9a2f7609551a74f, 0xb4254c687a2df2e7, 0x44a14dd30db71ac3, 0xadd6c6aab24047b, 0x9c10e76acaea65af, 0xc6516e5ad8efd8a1, 0x22a40b59424f4db3, 0x941c3624,
+0xfe878259e0e83c29, 0xc1f0dc7bddec90b8, 0x287eeb28f4c63f48, 0x40971ec3a6d6c1c, 0xf3a1252027f8fb8a, 0xcad18efbb21d3b50, 0x314899db389a34d4, 0x70f207891fd86205, 0x620bbeae526b24fc, 0x25ed21055,
+0xc90dab38a1c9a8e7, 0xb489d5cdf5b56426, 0xc5a51b483619b380, 0x9a72584078f2ce1d, 0x19ce9225674170c1, 0x6218c6938896b27d, 0xad64701992c7d511, 0x4747455428e2c0f5, 0xaf8e782ab8a79640, 0x165ac7ee0,
+0x2e121b0f9165d382, 0xabeeabf0308adae1, 0x5e01662aa87176fc, 0xbce213b1458eab1e, 0x1868fca63621cdd0, 0x1c11dc8ac5021699, 0xf62c56768a334be6, 0x7e332c6e54f45784, 0xf0a500621b8bb336, 0x1e00bb462,
+0x72c9d0e12d39f233, 0x89372094a172b6b4, 0x5011f66207282cbf, 0x1508cdae262e255d, 0x6e95c53e3679af52, 0xce8880e4d5cca4d3, 0x6de8e3dd1c0f5d0, 0xd3a156b8439fd1cc, 0xfa4748566ba2ec11, 0xfc5c4ca,
+0xd82715152665328a, 0xe9b6831a60d4207b, 0xc98b000e6d9d6ab8, 0x6ef4e191ce9f826c, 0x86f971ce1eb82612, 0x8165fe00498364f2, 0x8b2baf9df25db76e, 0x1ec92f62b0c76481, 0x715277b364cf539, 0x279af999d,
+0xfc586484207dc573, 0x6a2f5329354d08f9, 0xdcd634021747ddb5, 0xf140334eb1be4dc1, 0x3b1abbe053e503ef, 0x22af77a5e03d3f2b, 0x807206cac4855f29, 0xaa1a922571671755, 0x35f42afbf4b6bc8, 0x1620de079,
+0x9aafe1ac6f614d0f, 0x7627997b66080e88, 0x62a20f2d976f7846, 0xcdc5edc4bc130aaa, 0xec7bbc9b82c61eff, 0x758de4072d1cdc13, 0x67489945fc401ff4, 0x479fd4a3ad78563b, 0x915b0a1c3011aa62, 0x471478dd,
+0xf17d4048620d59, 0xf0c1a7ff4a825308, 0x77d84f747cfb5262, 0xcb347f037ebf7df7, 0xe791ab588db815e1, 0x5c69180aadde3c24, 0x2bb10d14391524f7, 0x5026eb6f183d72e1, 0x929a5443bbb69f49, 0x1bacd9e85,
+0x3713518d5aded048, 0x6afe5f1caff6e3b4, 0x93621c493eff3c87, 0x7c2d5b0b1a5516e0, 0x7d86916f6c04372a, 0xb60cdaa8852e0a16, 0x49d8de44b4a7048a, 0x2a742d6e5341a213, 0x324daf2adf7a2967, 0x169c09f1a,
+0xd6de260749128be2, 0xef54f07534be04f5, 0xe3f65fc9b864d5c1, 0xad1409541018964c, 0xebac9279e295362e, 0x6ea42d98f4f885da, 0xf079d2a906fa9690, 0x25d7c3d291676846, 0x27d106430d6890c7, 0x1941a80ba,
+0x46a18c0024a82fd0, 0xd25e0214d54b6ede, 0xbe90cac2882ae1c5, 0x717b5d95e91f8ac, 0xf9152bdbf724a193, 0xdab7566105eb7c1a, 0x4b10c202608f58ec, 0xef9f0f0d6711cdf6, 0x3f8997b2b36385f, 0x130b0c8f0,
+0x3bca48d9a7fd248, 0xfe99d92cd6a7e87b, 0xeab61166aabec612, 0x3901de1db32778c6, 0x2d61d8fda86116b2, 0xb62710ca0c3d60c3, 0x39b68862f05ef8d, 0x7e678448dac79d6d, 0x56517b2cba17827, 0xce71a741,
+0xa895fe550f882736, 0x922f2e1b43893341, 0x2b605edfe9419c99, 0x1a03eb420c6a7065, 0x382c0816bee1324b, 0xb131d67c013a1314, 0x36a7de07297cf895, 0x84c99402d8e4d799, 0xe0b5ae5750293b18, 0x138c09d88,
+0x755e175867b45546, 0x73ec0edc2a5b8b38, 0xc6dd16f14bdb3949, 0xae8d28944fce9a2f, 0x7be53098c5ee2ea4, 0x4591d77324969fa6, 0x176eb976dc6d795d, 0x79ab2d4f08cfb8d5, 0x9f0ad51e355fc56a, 0x195d8b833,
+0x335504093c9cac16, 0x740e7b724d906fa2, 0x5f33861f1922455f, 0x252e70daf75da6c4, 0xbfa08138537d7fa8, 0xf81c94788a1658e6, 0x7fecf51eea07b8de, 0x8322f172791b46d7, 0xd6485fd6a2f0753a, 0x1665b545b,
+0x14078f8ceaac1d74, 0x57fb45616df0eacb, 0x6eb091955270b202, 0x6c8439db177fad12, 0x8c490bc74499ad60, 0x19fcc4475e350e75, 0xb848c9643dcb2e98, 0xf11bea65dd57599f, 0xb1337e2473934ce9, 0x22ea554e1,
+0x8ba89e312da3d14c, 0xde3343494ff9f94a, 0x4762ee354a884bff, 0xa3fca5da187cfe52, 0x7cb04720f428d5a6, 0xb80d421df99a1ba, 0x1cf43fe15af64422, 0xa95c7a7df0bb209, 0x29e6b7b9b8cedc24, 0x20bd34a02,
+0x3cd2199114fbf52, 0x6697e8ce5f99d6d5, 0x7149e99c00343048, 0x60e42d1a6fe70969, 0x9977f7fb64c64e49, 0xb804ff2a72840ae5, 0xd1b3d6a1351e5cac, 0xaa538637ade8f4f8, 0xe0ee9ce934d480cd, 0x1bc307813,
+0x3a54d8aa2f8fc50f, 0xbefb031afea8ea1a, 0x55550bb1e862b2cf, 0x3e0285b345a35e6, 0x4aa2e55c789a47c0, 0x5fdc36e489fa15e8, 0xf6b119a04c2a50d3, 0x3a4bc3807da5e1bf, 0x771aee13a837f4f6, 0xc47af8ad,
+0xaa4670d834fbcb00, 0xbce22fd995ed8d8e, 0x39fdbdaac6ee698c, 0xe63469fb774038a8, 0xd7a7734f68561d67, 0xdbd3c9c24cd4457e, 0xfefad2f78c7f4420, 0x487bcf979396cea, 0xa02fcf1c35277e08, 0x2563a7193,
+0x2812844066577998, 0x596c24a2db2efd0f, 0xbba9b43c2f562691, 0xac1bb8f30856bf09, 0x32f5b94b69669ead, 0x473d9ceaee0b23e, 0xd8f56e30c86aa9d2, 0x2aa53d86a021cded, 0x915914e32138f7ef, 0x1dac64441,
+0x7ef388018e36d3e8, 0x131542d63e26c0c5, 0xe7f62f0a4625628c, 0xa966a25bb1935909, 0xa6aa4e5a26c4d348, 0xfb5134c7605e9def, 0xff5b03eab23bebd8, 0xa62c3c44cacedccc, 0xff3d2e5da8a47c86, 0x1901b7359,
+0xf23ca2b943a110eb, 0x1e9554274317c65c, 0xd6ca2ada0678969f, 0x65dd17c575196c32, 0x26e4708275d858ba, 0x82330bf6ec182b5b, 0xa99c127f8a14663a, 0x2935a88718672423, 0xc5d2042299e3cea1, 0x12528799,
+0x41a1c98f4bff6b40, 0xa64ad9d27a5e4f1b, 0x9832b6690e789ac, 0x59423aa014174546, 0x2d58bf28a6ed248, 0x72281082b75be5ae, 0x806767262713d0e3, 0x701c281a1becfc7a, 0x836e98e24128744c, 0x116b2d1af,
+0xaf214b65dac67e85, 0x1a8b751214824e76, 0x5dda1965af4826a, 0x2b580863db5f2cb3, 0x74f001fefc07f1a7, 0xf2293cc975f99aaa, 0x6f3a105fc633acbc, 0x5a8cb2a3206285e8, 0xb2d38cbd1198433a, 0x6f50757a,
+0x11cbbe096c38c155, 0x7a186c0e8a2944b, 0x52d86fecdc5f23a2, 0xb78bca35ee5c2e84, 0x51fac7462fed0208, 0x684d33033142c9f, 0x1fb4e01e37e30388, 0x6db2f1c0a7b5ec5d, 0xec185e1006e6ea67, 0x1f466bd3b,
+0x5178bc855111a68a, 0xdecaf910a015cca4, 0x2d9c7cd51e0cbdee, 0xf123460d9ee8ad66, 0xbb1b5dbc9920a70c, 0xb15f6ae121875ff9, 0x60f47ff5803cd618, 0xcb8c634551df178c, 0x50bf41d165620d48, 0x17f21e1bb,
+0xc786dd2dd582eccc, 0xa10c8d8af3079ae3, 0xf481ebab11b4bcb1, 0x501f9d552c9340d5, 0xa2457952e225d7e, 0xde6cfc59c4d5c8e3, 0x6399f8f26f2ecbde, 0xb89cf0b85fd51f0b, 0xa7092c24c11b239a, 0x1a773c3f4,
+0xb6131c8a93dc7295, 0x57e4ad1854118d83, 0xaf4cfd64d01f58e, 0x5bf7668e3753b21c, 0x5a29937e7cff3251, 0x1d930759642b6b2b, 0xbb87e02a8366436a, 0x3a6e57ff35915363, 0x7cccaefcde717485, 0x40d56699,
+0x69ab8af0f2927fd2, 0x207d2bd6dc992aac, 0xb56cd3f02eefdd0, 0xc12d1c524ed9305d, 0x6e69cc56d8144b7a, 0xccff3d8597a5eef7, 0x6e9443d6d1d2cc31, 0xe9d1b833f2df818b, 0x691d75f24685a055, 0xa7ba2866,
+0x538f8c240312c13b, 0x777f362ca6a74304, 0xf52e2936a5dc19ee, 0xe384a184a1e33b4c, 0x6161a90ac9e9ecc1, 0x80d1b46128248dca, 0xa1d5d531151100ea, 0xcb2c23911a602fcf, 0x983a9808f71a5349, 0xb03b19db,
+0x211e9125877f7d02, 0xe423882d9955bbdc, 0xa9d60b8dbc48c0b7, 0x9281f604d2c75321, 0x283662c6b7e6ccc4, 0x1a4c48924d06be87, 0x2e65966c3b9480fb, 0xa4a7f2b16fcedf50, 0x9521e674bd500ef9, 0x26e2a244a,
+0x33f28ce530ca9f8c, 0x5ab29fbd79f4b1ee, 0x7e7c20c59d86049b, 0x2d09f2defdfe861c, 0x90f3eaf47c0494fd, 0xbf525cd8c9e6a982, 0x3fccbeff8e8c9b00, 0xac7931116f8c7371, 0x5239e7c307aeb742, 0x24bb7d671,
+0xbf76a8fad0daaa14, 0xd2004cf04f54ec99, 0x5e47f9456a3174ce, 0x57bab3a8741762ab, 0x8496427ac700892d, 0xc2ab4d5257247b3f, 0x27cde9a05e18122d, 0xcb1a8f6cd0ee95ff, 0xfca5fd0edb894231, 0xf5ef8ed6,
+0x78f778133380af0a, 0xde91638dde139665, 0x2fb85268fe699242, 0x922f8c4c6cd0432e, 0x66199a09e45c8708, 0x9b7e207420cf1fef, 0xbd7a55ff4286dd65, 0xdaa590d24a45049, 0x2c376a2f4d8053c9, 0x1b18a802b,
+0x90d13cc299631532, 0x72436e73f1a46bd5, 0xb8be8ca1056453ce, 0x8b92c4c094a9fa70, 0x9cd128fe4e0f94d, 0x635d62ffa45085ee, 0x9492d9e12a30a7cf, 0x97151f7a202e7ee, 0x92dca9896261f2e7, 0xdc625cfd,
+0xb3575ebfb19e87d0, 0xaf126f98b368e8f2, 0x7514a2b8d0bd0cd3, 0x547e815c316aad1, 0x8cacb1052652e86e, 0x6e2faa046d8295de, 0x2bb372dad632f0dd, 0xbc9625f828eaa14b, 0xa67752feabd3c8ae, 0x135f1e708,
+0xa55edde5ac4f8105, 0xcd2f5bc959a74e05, 0x12964b9a79202561, 0xf2a40572c6401a9e, 0xbb7880aeb58c4c0, 0x52e1dc787cf2ba23, 0xd98d825dabe76388, 0x545e52c1ec7b81b3, 0xcb90eee709ab164c, 0xed97806c,
+0x8cfcf71f5a8285fb, 0xfcb2bb90b96b2957, 0x910cfe18bd771c77, 0xc4a7a4839662d9df, 0xee7e2891b0ad1a8b, 0xef8c4ea3a5c68a1b, 0x74162aaec5130455, 0x891167e2e5080456, 0xef477733a049bf10, 0xca5c4e6c,
+0x4f7283699afa8e1d, 0xbc0e73fff43af9ba, 0xc187eff70b49db4e, 0xe2821990bf585f19, 0xf05ad9cf27a567df, 0x6f0008e2ff5073c2, 0xa1327bb089ec8c90, 0xac0e18787512b78c, 0x34c1f08778d5210, 0x169cb4b15,
+0x9c8583935725f515, 0x8ac9d856356fed0e, 0x4496767e7b1aadab, 0x268a34d346ca334f, 0x427c2903b8e6bb80, 0x80371734724e6487, 0x205ebaa0befbbb37, 0x5c897204003560bf, 0x968925177759e971, 0xc056c385,
+0xc1ae3d5838da0105, 0x2bfd42685aaab514, 0x981347626c7b3763, 0x4a288dec22865d04, 0x510306d8ec93fdd0, 0x21cad0b97659bdc5, 0x50ab531ca0a6422, 0x592bd1cca786a1cc, 0xab537571be32578b, 0x20edc616f,
+0x74959bae46eabf28, 0x6de438b9550546e6, 0xc6454e1542b5c532, 0x6a8b183c14a2bfb8, 0x14d55d0cbd386fee, 0x355c1b943b956e82, 0xbba9bab48a6b21a1, 0x6d6523c94263c452, 0x83697cb3311a7a78, 0x18839a93,
+0x833cfb09d202eed9, 0xa2076ee70d4bb111, 0xf88519cc507fcff, 0x7e043c990a6cf0b7, 0x460b2cc5981edb62, 0xf43eb9452fd2e508, 0xd61722390adcdee7, 0xa87db1ed3ebbe9bf, 0xa295966797292d64, 0xe525c776,
+0xe8a7acb3269cbaf1, 0xc3f8a49d826fff12, 0x2c4726f1b34eef7c, 0x4402c833dbb3bec8, 0x89db78b6ceac62c6, 0xb015fa37ab870d5e, 0x4175bbfe0e16304a, 0xc7f6380afe85afcb, 0x5ee23804c91ffa23, 0x129117af5,
+0x37afd6b5c3a00249, 0x28529d0672c63d20, 0x2a8c9a9ea095ef5a, 0xd44990ec63e0b959, 0xb3506541019ed404, 0x5234f1c9faef1ee2, 0xcfdc9a3d8329ed21, 0x5772c643744d5688, 0x1bb33649a2e6323e, 0x1902c459f,
+0xff2b40023fb4d73b, 0x5ea261ee1f702e37, 0xc6f7ac2b7b649931, 0x85fec6f7dfac4349, 0xd8b854c93e5eb31f, 0x325b1b055d4f1c95, 0xec2032fc2a975897, 0x5b4d194abc73d165, 0x242e726f8b06e80c, 0x1288ec7f8,
+0x2567a52067d9e4b9, 0xb53f2dc1c4e15ba3, 0x83ef7095cf00ef6a, 0x78ac47301f7bbc87, 0x6e52f2557b3ff53e, 0x44c6f5e538bab0cf, 0x86434d418ae64b4, 0xf54ed192faf86e76, 0x51d27457965481ec, 0xf0a36501,
+0x6cded0ec85bfbbf3, 0x23d60eaa885efab0, 0xd5a85812576afa38, 0xe2b3ebba8c59f561, 0x70cec62789167128, 0x19e11dede8040d94, 0x8f99e0621d2112af, 0x21418e44e0ea8776, 0xe04c3b17048c8bd0, 0x2ac3caf0,
+0xf17c3a6c8814629d, 0xbb2b143e0ec9b0c1, 0xdb60a29f4b0c6f34, 0xda995674ea1fdfb2, 0xd24f32a079d5eb45, 0xb89a0dfba060ef4, 0x2a1596d53db2a680, 0x319d355a5202dfc3, 0x3d9b5e3a575ec9a4, 0x8467d7c8,
+0xbcc6a5f76883e5bb, 0xf7ad8e248aa07b61, 0xa29230e53284e538, 0x4c12561d2a1417c9, 0x6ef8acadc8daf693, 0x796ddd8cdfca8235, 0x6d4cea2e21ead520, 0xdf30099d18e5cab7, 0xb36fcdbe69def08, 0x1233c71a4,
+0xd818ecac418d7631, 0x5c840f76eb79d928, 0xd7c053299f633953, 0xc5b3c279467aa1c1, 0xb7cd3c670d163479, 0x953fb0b91b29cb18, 0x476cd0e27bffc8e4, 0xbf6ec31796f9b0b6, 0x674f56b71b420c51, 0x1ec7d8809,
+0x2150fb594dd6c6f8, 0x7fdc212dd39dab5f, 0x5d89d7b348000b27, 0x95713323e1bd27ce, 0x5b4f1a85d05139b4, 0x66961ea94e5df820, 0x5916e69a065300a, 0x2d7527cb257c0d0c, 0x903c62dad314eaeb, 0x12162a56,
+0x690e420478064b77, 0x97ecc4b3eab9bbbb, 0x84ed223da69c3cbc, 0xf8ad4f600957d332, 0x756873b097e340c6, 0xbd785a9a8943906b, 0x241401321172e122, 0x8233dc6338ab0f5f, 0xbd23e85af82f6b82, 0x1417b8885,
+0xbf528b6556acc9c2, 0x11d82b32c4f1e1ce, 0x8eddce54b875eb85, 0xcd5ac5549de6774f, 0x8012376d661c0233, 0xb2a6807879282bc2, 0x35c584701ab0d0c3, 0x9a72daeb04522a08, 0x6c382138740acc74, 0x1f30cfa10,
+0x42dc356bcf2dc784, 0x1a30e20d7fdc7398, 0x11bdccbf26f373da, 0x7fb5dd5cc6efe3af, 0x27ab9ab18d8a0395, 0xf8c20bddc6e74e3f, 0x3b62aff9ab3337c9, 0x1ccfbd9ea223f335, 0x3c941584d227dd88, 0x3256686,
+0xba9ceb4df3b6e4e3, 0xaaa83f308b40ba14, 0xc6a6542144842f8e, 0xcf9d66cd82592dec, 0xbc0a2344edc420ab, 0x663d2f7d5e1155ec, 0x636af3d816338a71, 0xbfded7a58814fdd6, 0xbdc122d58f8e2a73, 0xa288b50c,
+0x8226b656abe1d735, 0x98e92a5796ffebc8, 0xd638bb198a546035, 0x5747deefeaadf817, 0x6873550eafa9a651, 0xecc256700c5f0c9, 0x6607606f28cc7e3b, 0xdb482e946dc20bcd, 0x9454b86b3d9126ee, 0xe1d341d8,
+0xd64726e772a6cf21, 0xc2c66d557203b3dc, 0x8be780eab76f44c, 0x40b448d1990fc628, 0xc8e3cf0c5e348060, 0xd5b3a93b4f328464, 0xba79234c8fe0a3db, 0x32c9cc4a69d18ff3, 0x8d0487d28f253713, 0x23dec5556,
+0x786429ab2fa9d83d, 0x6ab72c774847b62a, 0x9572f74bcd05ec2d, 0xfc2463013cc2b523, 0x6e5b585d58cb040, 0x2e25bc02198dbce1, 0x84eff5c8d97f8795, 0xced233c011d2e3bb, 0x8c7486a5450f38d6, 0x6b339282,
+0xb4176116edc16d86, 0xd06e72dcda6815, 0xd80926b62785fc56, 0x69a93d4cd853c3be, 0x3623c49ef25352d6, 0xb4ad1ce28ec50c71, 0xe7dddc7a724614d8, 0x3172289e840924a6, 0xfbf19865c7019fb2, 0x145001934,
+0xd0f554746b8d697d, 0x400e145d988081ee, 0x181084e01d361d34, 0x76820f3f63391fbd, 0xaff8319265d0f2b2, 0x1e5b2b41957ffd3f, 0x167c83daaa3f9d95, 0x143884947ed6c12b, 0x65dc0a38b586c834, 0x3080d525,
+0xab1df775bdfa9a44, 0x89f3755772bf44b3, 0x25d6e6c4bcdb1e02, 0x9dde293d513cf663, 0xa71793d065fd82d, 0x7851d2b68e675c81, 0x29e4cf07c5962df3, 0xfaaf80d38fc42388, 0xd6b1fd08d6a3fbcf, 0x25ad5949,
+0x4e815ad8c14402dd, 0xc60f7576c7caba50, 0x6e699812e0721db4, 0x2083e6213280831c, 0xaeee36dea95759fe, 0x2aed4aa37825c7a7, 0xee870ae96bbf615d, 0xae3aad09ad5218b, 0x346ed4e3357795fe, 0x27794fa6,
+0x10de8fcda7fc7711, 0x7f19a9ddc9bbacbb, 0x7ac06956894d611f, 0x12b7a0d452c61f60, 0x54cfaee905ec40ac, 0x264b0ee00146519a, 0x3fe5723783562bea, 0x35d4b998a35758be, 0xf0c9b3838e3891a5, 0xb27dbccf,
+0x40d62abb068b1842, 0x638b5ca03c4adf69, 0x906c5c365eda4a74, 0x8f961215a71da785, 0x270b43da830b8724, 0x258fbf7f61f8f802, 0x98dc592050351797, 0x1c9f86a6af049a28, 0xb9959e9b43816cdd, 0xa80e30e2,
+0xf2b83c323125f086, 0x19a6b34587b9de9b, 0x758e555ee2f6116, 0x3f9c7eb4402be018, 0x3ac9c89489df8130, 0xd36794e4f7872de, 0x1d4ddd7c034ba681, 0x49b61d865c45eb51, 0x28875cc716d68bd8, 0x14358c39f,
+0xe5aaac97cb60e817, 0x4c19fd56948f4344, 0x465835da0b34e6a, 0x58986c7a2dbe0225, 0xdd1d5c9e22c93983, 0x3c1fb1ce3974afd, 0xbcbc15ef61a6b349, 0x28cfa1dc41e4a906, 0x2bef26a23f04be9, 0x1c39e9296,
+0x90280b7fe6264d9d, 0xa96150e5e079c4d3, 0x40aa0238de862775, 0x8d1d225d46a9f9db, 0x477ba613083322ca, 0x65b29c73ff0d1cef, 0xa31eddee601b6a97, 0xacd2581bad3e0c3f, 0x7a0c82bf16a89cbe, 0xd9cfc500,
+0xbaa762886e542212, 0x9a67c43297759e9d, 0x54b238520e0b8e5b, 0x4779a2bab6f36d74, 0x36d6b7e1eb6cdc27, 0x4b73f1e438a77bd5, 0x4b38b95992cf35c8, 0x54e65b22597294f, 0xbaf35fc0f940ba54, 0x23322a630,
+0x25ae53ff2fc895c9, 0x394cd24bc011d04c, 0x68c7923333618d32, 0x4c39ae8b1a415e6c, 0x2949c2a1622b00fd, 0x6c940c06193a41c3, 0x7e76920fb278efd3, 0x3d476c8e6b5e1f68, 0x9357be8f5424ac64, 0xa7906061,
+0x3bc54c4ab52c2eee, 0xbbe77d66d4af6463, 0x4ac7febbf7f13865, 0x84848c5c0bd7a841, 0xf7c90d9f4145b93a, 0x38e5edf08134b5ae, 0x2fc07b763b9e8d47, 0x9a87bca09b210a22, 0x474c59a0bd25eea5, 0x23a05e991,
+0xe2d7606e56dfb649, 0xf6550adca118e735, 0x1556d04ba961ad87, 0x8cd3585e85de678, 0xd3275b8773dbdbb7, 0x19910ad6fd7c1236, 0x5f4c631f5b7eb661, 0xca9a92f74548edcb, 0xbe8a46672f049e8b, 0x198990cbf,
+0xcfaebdd978100041, 0xd28a7a30ecd36db6, 0x87dfbdfcca87d567, 0xa9bd733f36d7b64c, 0xa0b47a3967e5865e, 0xefdb8f1aa155578a, 0x5e29b46163d852fc, 0x6b3cecfad4dffbba, 0x9aff8d0ae463775, 0x168e6a66c,
+0x1577611f91b56a98, 0xcf38a630332e898, 0x6e067784485a5812, 0xcb164f90d4885b35, 0x9da112e0dac28098, 0x62f546816e7f0749, 0x54ab30ee7b170729, 0x4bea80b7c417dbdc, 0xda8b2cf7d908eebe, 0xbb50ba3f,
+0x99edf393e4c71817, 0xe530d1ffcee4c474, 0xcc798da5eca35a1, 0x9862d3493e4263aa, 0xe88975bb889b3094, 0x467106576bc96b88, 0xd879ac8d36efc6ad, 0x4d08f50b06b08938, 0x80d70b21921847, 0x2fbeaf54,
+0x1e33fa11b86f7e4f, 0x39f77bdf4d09a43f, 0xcb2cec66f228f804, 0xeaa073586598e94, 0x7bb3534c044fb347, 0x85d56b2ed809b3f9, 0x5d3c325f624ebced, 0xd66f988e6a2011a6, 0x739f737ccd3e8251, 0x1f7bc1303,
+0x1a88092ba157e879, 0x1217e372e1a17757, 0xeae1b03c5aa75c86, 0xb553ef361ac27f15, 0x35feb9698dcca7, 0xd8c5fb3113bb56f, 0xf9485543eb19e614, 0x6fb1a71170092ad1, 0xc15b8fe001ab1027, 0xeb3fb306,
+0x5c4b1fb1819ad612, 0x360a620181840bdb, 0x5f72eb0ef9e501d9, 0x68f9ec5a981efb09, 0x4363c811d18e956b, 0x99156224c2c04c21, 0x885556beef65debe, 0xf1398fa7ac8bc95, 0xa1cabffc52932d5, 0x3db3c760,
+0x817ea28b5f1529db, 0x86eca7f1d6e3640b, 0x1b447195da21e284, 0xcf62070f2161e36c, 0x33fab1e2e9524da4, 0x1ca002fcda10ef13, 0x4e6a26111065f519, 0x7f5debe844b7787f, 0x225507efc5a9dba4, 0xd0387129,
+0xc6f186992db852b7, 0x2c6db4ff56fed696, 0x1891155d5317261b, 0xc6871e521c0bbb99, 0xa3967cef973c5ece, 0x44f7d1c30b4e084c, 0x9aeb09372d443d87, 0x2864459947d737d5, 0x97b327f95bb0d8a4, 0x120d25950,
+0x25f6d903d898c3d9, 0x21b8503d321f32e7, 0xc27e9db72fbefe1c, 0xd11de225fb917582, 0x97921f1db00964ec, 0x40e12c0a0103edac, 0xc3354b5a03e494d7, 0xf9b793f823932ea7, 0x5660ba189c7f3305, 0xc3a531cb,
+0xf7105e4a1ac03aa0, 0x431db059721f03f6, 0x617c2f12b53c9ca4, 0x52935b256c5e01cd, 0xd35e35d801881bc7, 0x35a678bdd0ddb29, 0xf07c33b7b8ccfe43, 0x358de78f71ea77f0, 0xec5e22b8e5b3111e, 0x201655517,
+0x95310638d630fcac, 0xbae868443542e59a, 0x3da32d2dd3a12b83, 0x4c000dc24dd610da, 0x6a9af3fd34d28a2b, 0xa5cd4f8671bc63e4, 0x12f1644b15ccf928, 0x2ffa273a29c6afb5, 0x9752c26f0502ae17, 0x2c551e89,
+0xe2d1d857874bd9f7, 0x25de821e70b830f5, 0xa51510c7a47a771f, 0x843d33560052cc83, 0xf4a6bb84bc885ab7, 0x961523351317e70e, 0x4b4a9f6a8a55668b, 0xa52727186a75090e, 0x63f889906b91efcd, 0x13a9a3a6e,
+0x97d027b9944cd54c, 0x52acbe74036a3a39, 0xe63e0e6f561c79a8, 0x706285bd050c5393, 0xade6247f154b2871, 0x6510e74ae7552982, 0xc78b4f37454f0454, 0xf6f7aabfbb50cdc2, 0x5cd36c37f3eb9186, 0x19452f000,
+0x5e32168d567bfcc, 0x15674a033be30f06, 0xff76e40c94ecd56b, 0x9e48e1944f4a9662, 0x7aefed47f76a5e3a, 0x407683f56ae32fa2, 0xee854fba9627de9e, 0xedf3b8c99e5ad22e, 0xf64c4f3dfb7ee474, 0xed3defaa,
+0xb36bdb553683710a, 0x2ae7506e14a53f33, 0x3cadeeb4029e1c72, 0xa02f5c76456b1ac8, 0x943b2c45efeeca56, 0x1ebd8d66824b588e, 0x1c16596221cb9980, 0x8efccff2e5ba693, 0x44ffe9f96793b35c, 0xf10b9a0b,
+0xa0b94cf76e1f7a8f, 0x576a4a8b1542b94, 0x39ca5616ceadfcc0, 0x850d580efdfd32f1, 0x9e1a76d45bb5f482, 0x3945a627e96dfe12, 0xbba9d0d46c50af26, 0xb8995db295b75e2d, 0x6619950d65a1de68, 0x4fa3da72,
+0x27824f538dee01a0, 0xb1bf839440e4bc8a, 0x3decb9479a7ec91c, 0xa4c7f5ccd20f2d5a, 0xebe238b5d424a5fe, 0x26548950cf79452e, 0x3c161aafce675e21, 0x4f8e045e6dea736b, 0x8ee79b3a2711643f, 0x14d678f4d,
+0x2d08691a5e1fb9d4, 0x7c6506ebf9ae1004, 0x9474b7e9229b3ebf, 0x5b1d26792f73a4fe, 0x9a106fdafa1caaaf, 0x409b7085766d0f8f, 0x49f5be37b6adb74b, 0x3f9f4e09f68f7d9, 0xdd686e2d25d9b0a0, 0x372d4add,
+0x5ebde5e4a442043f, 0xfaa7f47e49abd0ed, 0x989ecc9ae23031e6, 0x501bfc2a7d35ab22, 0xdea42644da2742e, 0x72a953c6f953c48e, 0x8d67e1138f0b29f7, 0xa45fdd486e5f7c33, 0x67831fc84a7a6826, 0x2213ddab1,
+0xe0101a93e9f88ddf, 0xe08d3d69b7f69b5b, 0x342d47c4b6a80179, 0x3a7550196f15e955, 0x61400a51d98257ee, 0x55e0d0ad17f134fc, 0x64bd4083cce1b01, 0xa208aa54998a5ed4, 0xb6027507cf6930b7, 0x29047444,
+0x9afeccb12d147fd3, 0x2c198f31569a6ff9, 0xbc9fdbbd0fe54f06, 0x101fbe9d66036764, 0x8ddbc3ca7f942b01, 0xe3e5c3a2cb23018d, 0xc713e4dd931a90c9, 0x653735032db0c53a, 0xcd9ab131dde67e89, 0x25c49ade2,
+0x151e72d815a3cbb5, 0x8bda0248fde85d8f, 0x10cc0362cd2fdf91, 0x269051e780e00eaa, 0x7977c80aee23f404, 0xeb6d400b923d5b70, 0x22dc32e49fd94da9, 0xbdc1eeec6afda84b, 0x1b87b8371a996589, 0x7ce89e67,
+0x987c3dd3011db62, 0xcfb6be5930610608, 0xbd64d8705459fc0d, 0x9ea72d5c49a45b22, 0x5c80ec8196c2827c, 0xab4a107ed2de5387, 0x3a8a626abf7c99c6, 0x6ff0cb44e8bd87c3, 0x421755330ba67074, 0x14bc56ccd,
+0xe9afcff7037a9f6f, 0xedf117e07bc55668, 0xe0989de056392794, 0xa8631baf50e7be06, 0x5f752a9bef87fd54, 0xfe2f8943544bdc6, 0x6464cbe8f5e5d366, 0x778d5001e58b3d6b, 0x1fd08b5120f95a0c, 0x1b0e626f7,
+0x557e0f3c3813a0cf, 0xd8466d11347269f, 0xfa2e2abd19baf0f8, 0xd14f5e0234675afd, 0x29d190d0501ac09a, 0xc0ca5d1966207ea5, 0xd29a43304fa8c4ec, 0x57a6c89326c3119e, 0x1bd2ec47f33d8c5e, 0x67fb35d9,
+0x75166face0265ad6, 0xb811fc8d858e6b70, 0xd72804b7599447da, 0x1ec0d2477d0e804b, 0x1f4785669086dd2c, 0x67923b475e5e41fc, 0x2f2c4d7e1f25c56, 0x4f4cc9f69d61f3c5, 0xd7ebdd9a155f552c, 0x258a49049,
+0x41e0d021f85633a5, 0xbff9cb171edbceeb, 0x4a1d1b441e1d7a88, 0x7110d599fa345d08, 0x585f03c8808771df, 0x7970c68cb1a92eba, 0x53cafb76b3194801, 0xbd8e120b96bba008, 0x80a87b1ae06dae6, 0x1fa99b4ef,
+0xc099ac9e877cb81b, 0x1ce5bd3934ad8e48, 0xafb433c946b4623b, 0x9bd6a6e89723149d, 0xf0853c7d444f76e0, 0x399fb6293eeaff4a, 0x1bad89450dec50af, 0xbb63e5c9947717ca, 0xa285e8c5da31c8ae, 0x1575dbfb9,
+0xe2e79e636d2e41e0, 0xbaaa6bb6fca3aa14, 0x5d93ac86807ec92d, 0xe41738b0d6559e1b, 0xe36b3d978af7d756, 0x98242ccdf076a130, 0x91218d701bbd1498, 0x94d7f76805f960c5, 0xd0deb417be4c840b, 0xb66da491,
+0x8885b5759541fbaa, 0xb9db2828ec528353, 0xe23bf41bd520732f, 0x4ab4b8e55d208d29, 0xd2fa2c40d5173f8b, 0x8709db383dfcd2c3, 0x7b3a8b2486152eb3, 0xa78e9d73033174de, 0xe7e630d915cda0d7, 0x2424a3788,
+0xdb11f7833e6ea288, 0xeab1c13120952520, 0xd75801c91f6e34b1, 0x7dd0ac3b037467d, 0xd066dffd92e8e010, 0xdf7cd09a5a0d0346, 0xca34386c334d827c, 0x257e55c3198c66aa, 0xc379f7de490789bc, 0x1ddef968e,
+0x15d9910c8e2f90cf, 0x75144f1c6930402c, 0x3bffdbd2c81978c3, 0x99541514f0007bef, 0x64959610d43c29a6, 0xad4affdeaa6f9100, 0x64332de2825f9e20, 0x354ef7e09705fe5b, 0x5f4da359e849ed0b, 0x24cbef495,
+0x685f60038073712c, 0x30deca815d696128, 0x809fb05720540728, 0xc0ee283e878f607, 0x45ab9ded76cf14c3, 0xfd45239699d241c4, 0xbf90e5bf576a169d, 0x8527ab18f383576a, 0x7d3165db3aaf9b06, 0x118fb0737,
+0x238a4c695ce3cce1, 0xe5bed5243f74d30c, 0x3fba5878ae3706bb, 0xe92d585be7b7f338, 0x3193e901d297db5b, 0x5c3380f0781f6fcb, 0xf7798c9ec22b2a96, 0xc3321e10161ce095, 0xe8ce38db818be8d6, 0x1d6d87130,
+0x10e5455eb7141be1, 0xe2f802a34081f7bd, 0x7c0fa1775bacf41a, 0x3f73e6fef5fe6971, 0x8b00dd2195886725, 0x84d9467225f51066, 0xe155260e9043f670, 0x561c4f2459873082, 0x8f0382be4060e16, 0x66f93538,
+0x264cf0e6c16503a5, 0x70078166df249b63, 0xf69d089d22ab859c, 0xb8814926153f5c55, 0xe932feec1a822c5d, 0x66a342ca72b4c876, 0x8f539d79ff509a7e, 0x2649e4573a62356f, 0xb473f0189b9764b, 0x4d5f4616,
+0xba12afcdc297682e, 0x61104f96ba417492, 0xe5b2e510b71dd46e, 0xef9a147f64bbe6a4, 0x79859235b910f3f7, 0xb70102cf0ef98f41, 0xd4aff8f2a4f9afc, 0x2291cb2767262950, 0x15fee1662b7de046, 0x12745aa33,
+0xbe53b25954b374d, 0xcf63a38772600463, 0x6b2a3c33bee8dd01, 0xcff1f28a4a59882a, 0x4e440aedfe15fb5c, 0x3792b0e1af8e6cea, 0x902ba323e37d54c1, 0x3c6f46074feeb135, 0x26340b23dc82dd9, 0x882a3260,
+0x87a862b73063ff40, 0x90ab8d11d1a95b42, 0xed5a799f257e392a, 0x69fb458a1a3288d, 0x452ce4ff7ece4687, 0x23703337323113e1, 0x64dedfdc0e9c57ce, 0x72a9b630af698d64, 0x8a67893c05e3f85c, 0x1c59b186e,
+0x597c62388dbe5c3e, 0x36cf4f411f25f1a, 0xacdd1f67a6d76ef5, 0x8584f659a45351ff, 0xdf9c67fc91220c10, 0x6d10190c9159f210, 0x57b3795febc23419, 0x94bf066b1195766b, 0x667e498763053980, 0x25dd19e30,
+0x848fd81fbc66f687, 0x45aee6307528427f, 0xc6e337e6f65e9d02, 0xec76329ec4140362, 0xca2bbb4dfaf9f56d, 0x14a13482d2eb843f, 0xc306f41b6d275246, 0x54d45cfc2c383023, 0xe6c7ad5525267ba5, 0x19b20939e,
+0x2e3907c85e97cd77, 0x1f1aeb936d1be009, 0x3a31fb4f526ab500, 0xe8c9f881c7225cc8, 0xb5a4f166d6be1333, 0x954c74e9887c2f3b, 0xe8b9f16ee4ed8a00, 0x35cccfa2d0115819, 0xdbc4a1a17c9412b, 0x14c57327a,
+0x73d4d09d6a62fad8, 0xea1b1978364d6d73, 0x9c9a3f77f44f068a, 0x2d7c373714ccfb21, 0xdcf2ae718f94314f, 0x987d0f2a0288f019, 0xf16c2f52bdd7abd9, 0x7c51b401a200f934, 0x34f8bde98e4a636f, 0xea5565a7,
+0x6a7b3407dd7247d, 0x5e3fffcd7f2608a1, 0x9a647d526278bddc, 0x767f7ae63fb732ca, 0xbb1cfd2610860917, 0x496dbb90e449043b, 0xd6454079da96b1f8, 0x4b52da993f393488, 0x25f66e2fe364b43c, 0x132d8dfc0,
+0x2d213f74050997c0, 0x14edaf274ef6f2c8, 0xca7ae29621bc8b1, 0xf830a2ff5abeed14, 0xe8d34ce229dd719f, 0x4f395b504f16fb97, 0x6d3305dc80812e48, 0x299592347448e59e, 0xaef5206920bb96fe, 0x8d5c7f70,
+0xd074a1819e272433, 0x5ea92fde9dae1877, 0x11355f63e6020c3a, 0x9ced5b6a94ad8293, 0xddf6fafc293c048b, 0x723366453eaae13d, 0xdafe498dd258211, 0x669551b13e70cce7, 0x774b32ef2b606b14, 0x1e91353e3,
+0x8ba1d53d37cd3ad, 0x6c7c06b467a5b1c7, 0x38fc453e9fe2cb42, 0xe208849f743578c6, 0xed5e40bf47dc0829, 0x8cebbb17630190f6, 0x96ccccd55f059383, 0xaa669120bd3e5432, 0xb03fb94760772af3, 0x2439b85dc,
+0xaf5de09074e3b9ef, 0xa779a4fc8c207ed8, 0xf6d09f4d56e2d564, 0x5af4f7be1a40a29f, 0xffcc5be9104638ad, 0xbfc41a3e2050c935, 0x926916be3a713227, 0xafe3c5920a02ed19, 0xe9ce87e52061556e, 0x1be9f5636,
+0xe709461f18cbf79a, 0x936c1ca64abbe5e8, 0x414b50acba91f029, 0x426e0080719448b5, 0xa030a1b2e6a2b0a5, 0x6e6c42082a860a0b, 0x4150d498095174fc, 0xa1b30ab42d7995af, 0x579ef063d64a2f43, 0x61a79b51,
+0x64e0162c57bb41b4, 0xe092352a6dcaa369, 0x9fedf67fbcd133d3, 0xe25c467179210a7e, 0x523218227a6938dc, 0x3c93449c7b99b393, 0xfc1b75ba3cb2f615, 0x42458804e7d7f9d7, 0xabb7d85536e240ca, 0x3f07b33c,
+0x7dc0ed604a01cac5, 0xee3bd73e79a6ff31, 0x7a4f00c3adeedaec, 0xce64a405b870dad2, 0x4dd11646e2ea28f, 0xde70d2337f4bd3f2, 0x25a21ebef990dd2, 0xdb36dd15535d6566, 0x4b0b0fb3aff1c6f7, 0x148f93d72,
+0x4f0ad75a6111aa37, 0x89596b4a2abc3a9b, 0x77bbfa93d5056b8, 0x7ae511f697b0c88f, 0xc9d6e1ec1e4deef2, 0x12be2532a4dc19c8, 0x77e42c76bf7e577c, 0x9b9e559804ff9dff, 0x1e069ccf59093526, 0x92d64175,
+0xbca8fd77a7264377, 0x867d612dd34d1575, 0x2bf14006c74c5d66, 0xdacb88e95d8c5523, 0xf249ca3ac821e9e2, 0x8cf56bf3a0472273, 0x2a89508e122ea1a1, 0x5e924d7551519b85, 0x951f60d428af4ce6, 0x20ee08203,
+0x378c52d75e3add00, 0xa9131aa32be0d87a, 0xcf13a48fd20b405a, 0xf860f4694a4facd5, 0x4939e6cc7c27670c, 0x3b9d9058ceb8cbcc, 0x2f0fa05439ee3b8a, 0xbdf7ce321fce95e0, 0x6ec549f0dcb56c32, 0x24723299f,
+0xb402c3db46c5f2a1, 0x2de2b0c69634800, 0xc02008606e927c04, 0x3260ab933db963da, 0xc1c04a631462a07c, 0xeb640fd625623ecd, 0x7e8e2e67a7bbdccd, 0xd9555b915bdc9c60, 0xd0629b51a2ddcb44, 0x173016671,
+0x588f43f9592a6ff, 0x2c352c2c7c3189e2, 0xd37c1380dbdf1303, 0x4a97e137435baa25, 0x55a81a180166407e, 0x34b57b9caa930e02, 0x877fcf24666e4ab4, 0xaa335c6ed9b7034e, 0x5c81b6138f0bbedd, 0x1476bfb8,
+0x8c78cc9e7b775226, 0x82ca3253bcf347a, 0x8b396d7676a56c95, 0x944442601b7ff309, 0xf9604bdfa91c78fe, 0x4d86f519b9f7177b, 0x83a573b72d12995e, 0xa529d788ac1bc96d, 0x7fc3e9b28a5eb473, 0x184198a07,
+0xf24b0adbe96b8353, 0x572196f09d42f6a8, 0x508f26150bffb60, 0x3c514ef20c94f864, 0x5e1316f91527505f, 0x803912e28c6622cd, 0xfee71c547f709fef, 0x7b912f9e3aeb2b38, 0xf49350d5f936f02, 0x4e10bfd2,
+0x147c0926b7f92045, 0xf1145b4bf244b4d3, 0x8f285bd34409e26c, 0x5c174813feb92afd, 0x873b57262527209d, 0x951b5ea5db359a25, 0x5a4be2d2d1cd6a7a, 0x1232a4e35493b98f, 0x1f7e4199fce3e490, 0x254d9d0ae,
+0xf0f6dfcaf14f5f41, 0x930a9903e6844050, 0xb0b4117f4616d3aa, 0xedb0eedc81fdb8c, 0xc35666a3935575b0, 0xb79876a79636a0f4, 0x2d3ed0632053dedf, 0xc0f241f436dde009, 0x46edfb26df5e3c11, 0x718d83bf,
+0x4ff2ed6db02474d4, 0xaf9951e9f8be4af4, 0xc383494184af712b, 0xead78bbac5d1bf7f, 0xa347c87dc420190c, 0x4c5cf13a5b168c56, 0x53916e7638a2b2ae, 0x7452fe5710f9a9e0, 0x35733ee3a7194c31, 0x17990b312,
+0x2788725fc6fdac2d, 0x19c24f85719ad8f1, 0xf27688f074b415ab, 0xbf04880352a8a70a, 0xd04cf99555dcb5db, 0xd34154bd0088c8d8, 0xd6cd876f715700b9, 0x570e15832ee0cd34, 0x6420dcd5ba590f23, 0x268b7304b,
+0x89c0b4b8f0a01554, 0x1f9ea9b69f9e63d4, 0x8d932a4c860dd86f, 0x5968a5a951b983c3, 0x2d2dd9f07fc910c5, 0x8bba74dd91e75104, 0x7472ca8cbb5db2ce, 0x22b326d8586908b6, 0xb81bf8e3b25b65ae, 0x176e961ed,
+0x333a34e1301b40b5, 0x1bb2513845ca4f0c, 0xf635e4f591dfdd56, 0x84cc7336034af933, 0xd38ee04bd058ece, 0xebaa09180d07a2ae, 0x8de71d9200476884, 0x5ccc8f7293906ec9, 0x3085e63e2dd772e5, 0x1b1e33f84,
+0xff43b0f6f55586f0, 0x2e6df974f874e23, 0x531e70045642976, 0x872e2e2db18176af, 0x6152718dba7ed648, 0x82b73016d76a0b3c, 0x5d0fb171bc175707, 0x2388baaad988cc78, 0x9cf58d312788366a, 0x1c6c3f931,
+0x549d7660f026e23d, 0xaf953e43110a11c, 0xa4200bff6831ea92, 0x2b569dfeef5fa83a, 0x370a3b7d59ee4d43, 0x4f5fd3d3dea3096, 0x680d348afa1cdb13, 0xb3c9d909c9cfcdff, 0xd25ef3a14ca6807c, 0x389eed4a,
+0xcc328c3a92900a0a, 0x16b5b89420d2af0d, 0xc7f024da24a0ac6e, 0x2c8606e1f96214f9, 0xc7b57ec7d77dd8fe, 0x3d46b845e290041d, 0xbf4cf74c542b127, 0xa08bdeb0ecb1f68b, 0xcea10062baad2d8e, 0x1ebd879d9,
+0x7c3914a013235f9, 0xb3665b6eeecf0f52, 0x11698ea8e696475c, 0x608a3ecce917b91a, 0x96e7b2721b8c528d, 0xc40dea6796c989a8, 0x6b775b21be44820, 0xd58651d3eac731bf, 0x480a46c21035cbcc, 0x10979593e,
+0x1c116e337af30874, 0x4856e7ebae81d5c9, 0x13839822b6789f72, 0xfcce1b343b6574b4, 0x6d52446a75953f80, 0xd042bbd0be40accb, 0xdbb02fa74153135f, 0xe937c064cc417943, 0x77097b11adafcc8d, 0x30e15d7d,
+0xf6f5103b3b0496a5, 0x7ca5c19c6e9adb37, 0x9c2edda87db7e6ff, 0x248b0c5efd2b9231, 0x1463f059372656cc, 0xd4fe18ff04bc4c5f, 0x31eed3f6f775f54c, 0x3f6aa948e3f36b28, 0x3876b304ccf80e56, 0x20bac8e5a,
+0x8539ca00cc2dc8ca, 0xb6982bf1e2d7d332, 0x62bcbe33fb37e340, 0xabb01aa6e5d6f583, 0x3df4208b38532fd5, 0x9d3426d32ea22c99, 0x59c3af86ea5f61da, 0x8fb844de4f964be9, 0xcd940d0f4f29eacd, 0x21c17ba56,
+0x265663a3f08672b5, 0x5892c03e5cd632e5, 0xc376318402058efd, 0xb9c235341d911395, 0x30f650c9e6d536cd, 0x5babb4427f5681e7, 0x96bfadce12657ced, 0x6767889270a6eb2a, 0xad97aa23feeb7487, 0x27bd23e49,
+0x65306772888bbd19, 0x3be49cfa0bd0e9ac, 0x53d368f0f36fb9c7, 0xd4ebbe04902ce84b, 0x276bc1b075eb0a8, 0xfe0a580db10c41e, 0xf3296965afbc703, 0x96e85110546391cd, 0xe9346b3506418859, 0x83a6e089,
+0x635da58df8c7582d, 0x14d142d84aaa2050, 0xa2f98d73cccf0820, 0x639ae042b85cc341, 0x80a50900dd06b068, 0xfb2c35ef5aa46ff2, 0x33089efdc7b3e5dc, 0xbaed21e9bb1300de, 0x25ae6e221003bf8b, 0x2457f264e,
+0x3b3395703f66f0, 0x7467f4e178535baf, 0x5d34e5c47f5dab5a, 0x4d63f57e82459137, 0x2d0395d0b9b00087, 0xb65c8f4c251fe18c, 0xb8f738e7481916d0, 0xc196d10b75e3f047, 0x4fdd3521ff52b470, 0x1fb79fa7a,
+0xa7805f7137e8ad7e, 0x771e8788c603a61e, 0xe80a8886980e2263, 0xb8fbbb79ac24ffbb, 0x17a1b28f7afa1d63, 0x6753db84c661e28d, 0x8091fefdf131d407, 0x4a5896c09f9d2da8, 0x754a6c85f5814ede, 0x48a5d7c5,
+0x7eb31f012e1146d6, 0xd23c5784866c9baa, 0x180d65816e124dee, 0x8429b382beb532cf, 0x3c14844699c6df1a, 0x7ab0ae801609d43f, 0x5d1f2c46789ca5bb, 0xe8081142eed2c4a1, 0x9b25bdadeb16738, 0x1bd5ccf20,
+0x98759a5788df2fda, 0x224e71db785ac8ab, 0xcb32536b88c387c3, 0x36ce6460a07f3d2a, 0x413ca4f9ec938195, 0xd013bc1055c52e1, 0xd49992f687396be1, 0xf78f0db9ad98ccfe, 0xc7d93b8829d2923e, 0x178b12cb4,
+0xc31200d6a21db932, 0x6328e89ea00485fa, 0xdadd3243a9e0a881, 0xa406ab3ceb37b757, 0xa536e3d9b62783cd, 0x74c0476d759a04e8, 0x55dbabebd3b960e9, 0xb0350dc4ca8849e1, 0xdf7f6d3dcc3462ab, 0x200e6c78,
+0xff5b3e6e9d87eaa7, 0x45195646b5214f4d, 0x3fba47eee363852a, 0x32767a875a3d39ec, 0x81a19670dffd4415, 0x3b3ecab012f9093b, 0xe9aa9909cfc84921, 0x85be8f30eb919e15, 0x71d13bd61ebe02ed, 0x50307aec,
+0x7f257cf2834a3640, 0xe5369e2cc09d0d58, 0x130f049b972f56cd, 0x30842ac885ec2d03, 0xd7e7be84ffa83f33, 0x54622ff84fe2e0fa, 0xddaa70cab6cd0929, 0xc82e538a5f5183a0, 0x5fde00b7c1edd8af, 0x1a8291ab,
+0x70b884afb2b4b10, 0x8536470e7141b527, 0x7221b2d57bbf0e83, 0x35fe7a23d9229d23, 0x391bbdd129dc7683, 0x3e881c60b30bc577, 0xb05bcb7d2dc32200, 0x6a1458e46c82b644, 0x3f5336b63290b60b, 0x2209592fe,
+0xbc75562ed1d9b07d, 0xbb9d97f90e8f56bc, 0xf86939ba6aaff884, 0xeb5208c1c9ef39f4, 0x236e28750915b242, 0xb50c1d020e690272, 0x2d00c1e9fa71aa11, 0xd9f0278fb380327a, 0x4b951febd4564c02, 0x14a7c7a70,
+0x9193681cab15f7b5, 0x1376e73c32071ac8, 0xee476a22fdbc2701, 0x8de1b7a57cc887fe, 0xd6d7458baa62d4c0, 0x86be9f3c5e8c1167, 0xc0824386b7478aaf, 0xcd9270255c9ca67e, 0xa70c39b6a4db087e, 0x2639329c7,
+0x8f873c7e0ec49cc, 0x6c1cee64aa2c9e48, 0xf69f1b2b45cd017b, 0x766c975044b1e317, 0xcb5e7044f168c2f2, 0x8d65144649cec43f, 0xe9817d828c7ddcbd, 0xfee8aa533377a7eb, 0x9caeeb95441dece5, 0xec70d73b,
+0x7a5dbe799bbab47b, 0xf235d5d7385a9252, 0xcd71dd3f03ae926, 0xe23f2e685609a418, 0x7cf081b17f6c99d2, 0x260fa7302dbc970b, 0x4babebfce30ff9a5, 0x60b2d195fd9d94b2, 0x1f942e584f00a2cb, 0x49879ea,
+0x368d48e2a6488cd1, 0xc75a35eb1a53ecf8, 0x6f2ac698072f414e, 0xf825967e5daefabf, 0x9cd75fb0856ce904, 0x5bfd0087a93b9ae7, 0xcfc2a56c73805f0e, 0x1d5cf98c0bcc76c0, 0x281114d7e4310d94, 0x1e29dd909,
+0x409fcebd06828df8, 0x4f9dec394e4d79cf, 0x15d1e906a94404d4, 0x9b4b5806a5d0bbc1, 0xff3cfb3cd4ab0bfd, 0x697de0b6271e92d2, 0x2cfa42880054e908, 0xbf82951e5e6a409a, 0xd5e14fc14677dacd, 0xe2a30ce2,
+0x5d00e8299fd42b11, 0x95872533e484fb92, 0x9ea31ea314b34adb, 0x3cec9bb6c1eb06d, 0x3963181410e93957, 0xc0bc826212bde6ab, 0x3bd1602322527b88, 0x746a993e26e421ec, 0x62deda47a3b76867, 0xbd3e7bdb,
+0x139c38065c9a4485, 0xdf637af2397cb70a, 0x504067477577c777, 0x9bc29e9c4364bfa1, 0x62804166cb6b622b, 0xd683d263a7c8cbea, 0x1f38c3241525eb7c, 0x153817b051f88dfa, 0x721be8216fbf1a4e, 0x132644d3b,
+0x2a3546bd729eaffc, 0xc47b996365f69cd5, 0x82b792eb92b5ad86, 0xe6ebae2fd829fa4e, 0xdb88b1445d86abdd, 0xaf56234ecba4c21e, 0x7a007bb924bdf61c, 0x393b1d4ab24498a5, 0x863a3ef680f0f8cc, 0x82df26c,
+0x5c90988c4aaae011, 0xe555105a1df7186, 0x966146713af3b9b0, 0x57ecb76bcf299f0e, 0x2c3cdf1e8ef0b8f0, 0x81972c9d823473de, 0xc8e1ef4f3dd9cfec, 0xf196653d5a15d00d, 0x5f96eca35bc0fcb2, 0x3557571c,
+0xfe80c3dd8c3b3f2f, 0x276b9a1beecd4997, 0x7f1759e98a5161f8, 0xd9c920afd6d776ae, 0x75d43c97e3fc0bfa, 0xd647ffc56f3d16d4, 0xd66cd23919e64d41, 0xf9252e299bf5251, 0x80147ddb39f2c2f9, 0x56b01ee5,
+0xc9db9f366ba56917, 0x6972e77af302c871, 0x112b76c670cb63f8, 0xda63973885581425, 0x11a116a64b8cea6c, 0xfe73886f51d39dbf, 0x2b8ec42b2b18e246, 0x45c2b3264387dd4f, 0x3736f7e250f5992d, 0x1f7c38a2b,
+0x6a18063797e43240, 0x6712cd328faaf84, 0x897fb1ae18efb881, 0x3bd7ba0ea18d9089, 0xaf5740211e2d820e, 0x734bac54f1963c68, 0x8387e8dc57562f20, 0xcce7c245db8a8e53, 0x8a755d8ba6e68e97, 0x16bd3b456,
+0x349d08edd6bbec20, 0xe8609742ee5a795b, 0x2533a27d619111f, 0x6fb9fb28caa509e8, 0x5589043dfa8d422f, 0x903cac2ca04ca081, 0xb4a4d987c75e9959, 0xe12fb4b172fc45fd, 0xd42b0d481fe4a109, 0x277b9cdf9,
+0xa3fcbec89f2da471, 0xb84499d5b2809018, 0x1140b15b86a619be, 0x326fbf48250ad293, 0x38b5b4019c221a48, 0xff2d961115ed1d1, 0xad95a708fcde4609, 0xf9f6205ee35e65e8, 0xd50c65399bdf987d, 0x1e8a056ee,
+0x877759575376f7fb, 0xe3ac625dd58e3269, 0x70a91dd6baac3b59, 0x38fe9036c2dbf11c, 0x249e0330f735ac39, 0xbc5a89798ef77f29, 0x6e0429a357d7fc88, 0x4d203608e3fa6510, 0x2cdd590f601e8c32, 0x2480b8df9,
+0x392e526b77778094, 0xb9fdcfd8a21138db, 0x1509f037fccfd9a2, 0xc3afae73ea944712, 0x6a2c3b5b07a2a7e9, 0x647c6f003176ad99, 0xf2f2371cd31bfc2, 0xd86f8a67e4eab4db, 0x3e5c378940f3ffa3, 0x14145680f,
+0xe7261af20e1463f4, 0x4dfc02bf38f9e12a, 0xccc9384ed12d5f03, 0x4e4db276a5a6e88, 0x957efc08e0c896e2, 0xf9d4370304a9548, 0x85e21f106fd7be49, 0x3cbf476d58923845, 0xa0758dedfd0d66db, 0x1994401f9,
+0xe24ac6894a3df65, 0x847ca39abde25b64, 0xae12adbf5ae1c557, 0x568c5f1b34d44333, 0xff69dd3d947d212b, 0xcc1b65c9e0de79fe, 0xc6d2cbe56120285b, 0x91e34e1a4be1b2fa, 0x43c0d0e9d2df34fd, 0x330d4801,
+0x68a36a59c170649, 0xe1f67981d83370ed, 0xf05111437ce7932e, 0x6374cbf66a05210f, 0x2ddd9ef76315cef3, 0x4dbfc7b75f7064c3, 0xe18c0876db3f2b07, 0x522047d95863e146, 0x722b019338b6c563, 0x147e94cf8,
+0xfdc090ddfd8b67fd, 0xa44b095fee2dbfde, 0x3c4c9dc11e39b462, 0xa4ccf72976d89681, 0x71698d2bb8fb9b2b, 0xa43ebcdddc4c35f8, 0x86bf8723ca958526, 0x5291f96807586ee9, 0x5d80e994ceb83fa, 0x2062f4dd1,
+0x6d934dc58e731d6a, 0xcc08128d48929ecb, 0x1502e12758da7d34, 0x292599c63fe0e474, 0xe7b4b50a9bedd5c2, 0xf9264c934e0f0a02, 0xfbf8adc518bf61c0, 0xc444ae5bec1c8a22, 0xbfa8ba74820cb058, 0xca5f2572,
+0x6f201bcfa0a7ce2a, 0x2c8ca605a0a3baf6, 0x3c71617f850138c5, 0xeb47e5d851990883, 0x97d3b3bdf9141f83, 0x95e14e86cbedc167, 0xaaac2f1dd49a6f03, 0xadb9995d4919da34, 0x6cd3ba0e0e0806a0, 0x1b67a2cd6,
+0x97a2a0e879966ac1, 0xf496c1704d7f0313, 0x3a4738837305fc8a, 0x408d65c9049d55b2, 0x6aee57c3aa398d90, 0x7d0854fd9829dfed, 0x3326a584b89e8b32, 0x9fc1534d68593705, 0x9c7d4a1578f11062, 0x24bf1b1da,
+0xe5424d4513f9461c, 0xb760f87e118e1cd6, 0x6723176dae4d4e9c, 0xdb7f9bc5c4ccf440, 0x7563ed6234e6e0b9, 0xb69b07485906b063, 0x728d18b45506561b, 0xaa5e124f8927b401, 0xcd572b5c3919e357, 0x1fcdb8dbb,
+0xc180a1fd9c8f395e, 0xb7d231cf20202828, 0x8ca4570695b35a3, 0xb640427789ecc0be, 0xde5e94179b2de9ca, 0x8486ade010b09b87, 0x183a4d468c25255c, 0xf8f59394984f3d91, 0x6943ac26e34a8899, 0x26398c496,
+0xbc6434f0533fcf7a, 0xa5855b30c8af337c, 0x133e05de8c27f1d0, 0xa09d18e7d4ab08bc, 0x1a8366faec2b0af1, 0x14f860bcff3a5d0c, 0xb4a4979c1c7df933, 0x61c25052e11e6b5c, 0xe11ec75959a2390f, 0x1b0237f40,
+0x8c41180981d2b093, 0x6c67fbd97f681876, 0xec1bb735758e93aa, 0x3c172066c6733984, 0x35fb4db8cb7eb004, 0xdfdc787768865c62, 0xe5907523ffb6a854, 0x9433258bbeaf4056, 0x3ef42274a799c310, 0xabaac482,
+0x5638be0090adca4, 0x8b04b0cc7f625427, 0xd9c40ced030b9e48, 0xe1fbc186644b7c23, 0x72b968af42100196, 0xcf6d604e403c0278, 0xe2c4f42070c2f15a, 0x15c17cbe7eccdfbd, 0x855ec718f7e5bd57, 0x23a2c2157,
+0x71535e8ddcae5cc2, 0xbf70bb09ae623bba, 0x843f6b773458d5f, 0x24be5d22b13fb662, 0xa1a44e13fe2dd429, 0x9314659edb78be19, 0xd339a451d2b21897, 0x814dabec80a42c84, 0x4125204224e817c1, 0xb749a0df,
+0xf63f3f766913a2d, 0x739db7db0db090b4, 0x6e3c6bbf29487e51, 0x22c94bff143b1026, 0x4a329d254a814054, 0x71e43d19bd7b37fb, 0xf9c30e9cbf1cf8b6, 0x5f2292996fc11aca, 0xaec9f66fe4648c15, 0x192890c18,
+0x20007f8bb9044a61, 0x4cd6a40720fdb2d8, 0xa782b18253ce97ce, 0x256c8e1b161061a6, 0x4a25220dbd70a34, 0x25e0c566bf7490da, 0xeed7038cf19e80b6, 0x1f90ef43c9e0fd92, 0x10aa3afdb2551c78, 0x161e701ba,
+0x2a0231b2dc3e8132, 0xa3cc6b2f1facc432, 0xf41bb6b6efc7ef43, 0x8e42c90b94a3982c, 0x5f0a1b54c50f113, 0x78e488dc1d447237, 0x1894f51dea5f211c, 0xe21846aecf2a18c, 0x7aea9be3b6fd9dfe, 0x26fc7c9b0,
+0x6c62665a51b174f1, 0xb300e86c1b0dfda8, 0x894bb9d8e8411219, 0x98cf4cb7f547cfb6, 0xaa113f0e9c6303aa, 0x3b4921decf7933b3, 0x614a7a8bd4090c1e, 0x64f2921ddbb94fd3, 0xbc692a31b7d39075, 0x19ad91b3f,
+0xc45d47a02b496c12, 0xd81f798b123ff502, 0xa517ad9a5e88b983, 0x64e120c7d2901f63, 0x7b3c24b920a51cdc, 0xd69e68f37caaf20f, 0xfe7f92c81083953b, 0xdc3d264d0f322c1e, 0xdb44819ff1b3fa57, 0x1642f1652,
+0x65f6171eba0117cc, 0x56f932b537f2c36e, 0xa958fa0019a62247, 0x891ac372ecd943ec, 0x118cd633368415db, 0x777247783f4cafbb, 0xa4e28c72b75e1f1a, 0xb16f742c0d404a55, 0x657b1e87104a2601, 0x36db712c,
+0x2740eba93e573f1d, 0xb8f549736c4d338e, 0x33e3c42795245e80, 0xc8a1047f84153aaa, 0xd20f6935dcbe9a9a, 0x33d9c90e542a3263, 0x3bd3d945c3e3e565, 0xa4f2451b504330f2, 0x1a73b8288973988, 0x23f48d00f,
+0xeba678a66b79d3ae, 0xff711bd219109a3a, 0x6c0dfc67dfec9ea0, 0xcb473fc42cfc8908, 0x110eb131dd4e0b53, 0x3957976c8925f477, 0x10b2faa5157a109d, 0x8a9ec0dfdcd4026f, 0xbb1fa126f974d44, 0x1b8d4771,
+0xd4f80e1267c5fc3c, 0xcbb7d6c3d412e9b7, 0x14868e4007d48705, 0xc96d5d09f7505cbe, 0x2dd9211c1130730d, 0xb331722f31881f25, 0x5606dfc6097d1938, 0x1e9d2e1587dd3f2b, 0xfaf8451f7eb01aec, 0xac8e756b,
+0x9487b5c9f8bf60b3, 0x2a5a2b403788647e, 0x1c3ef84ba2f77a61, 0x8105f278edd069e9, 0x56d63c11205c960b, 0x571121f4bc168cf5, 0x1ae009f507cd725d, 0xd8f3170711a180ca, 0x771eb637ea8d3c4c, 0x8e4063d6,
+0xcd714811000df7e9, 0xddd2fefbc0080819, 0x1d0e74018e58c0fa, 0xcc7687cc82e3764c, 0x49117c02fe715ad6, 0x2732f76e930caa3c, 0x186c9afbc2007ce4, 0xe0f47397e266b193, 0x79b2bf4ab078e042, 0x16e51d28b,
+0x82f5b3d76a3434f1, 0xf59fccbd7cb3a7ea, 0xaf48707549adbeb9, 0xb82be4d5431d372e, 0x9e6ae3c67d7d2dc4, 0x3b34fdfdba5066f5, 0xad0d794d3f5739bc, 0x9e552049f6b46c4f, 0x7e46c9368e87617, 0x18a8ef4b3,
+0xe4da6c7e62f8c145, 0xbee7d65605dd9892, 0x2a5ab937b1ef9e01, 0x1fc38642e30a4e73, 0x245422c7929a84c6, 0xb7c5e0d41c90d465, 0x95e629b963045c16, 0x957ff02a209b5aba, 0x69c4687125ce092f, 0x53b0cc14,
+0xa1ce7a83a7ec713, 0x5865f67a2638513c, 0xa75bf011342e0616, 0x8e92709dd92e69a9, 0x9d4764586b815243, 0xd2637265fec6754f, 0x996438d5463aa37f, 0x4815b1c0b239e2d7, 0x784f0e7f0483e1bb, 0xe84a0ca0,
+0x24bb0d8d4100742d, 0xdc79245f87437282, 0x86933332f9e00527, 0xe12af30094030f22, 0x430ceb88ea3b49f0, 0xfaefb1a2fe8bc1ae, 0xfb508e8e7e14f0c8, 0xc182643bdd76a45d, 0x673f2f48ee99a5e5, 0xe787474f,
+0xdd2ec939eabcd05f, 0xc116077d5baddf0e, 0x8eda7fd08861b689, 0x2f8ab5952fad8c7c, 0xeb959e16b16ca93d, 0x90e25b98c56559c0, 0x38814865189efcc1, 0xd7534f042bdc9322, 0xe8e4a4fadd8a1348, 0x6783975d,
+0x940eee4b794fbb, 0xe58141daf305aca1, 0x8d70a261a992dee7, 0x741f7c81d5d0464d, 0xea899d7e0be62379, 0x2ee456da0764dc8d, 0x73ac5dcb697173ec, 0x9c4e803d3f684213, 0x274efd639d466556, 0x1066fe156,
+0x6e473630cc7ca71e, 0x29b07435f86a0a12, 0xb0ed0671ea527c85, 0x371224ccdd7631dc, 0xfde6be8327be0f8d, 0xa974eb84f10e11dc, 0x2dd765a041d4df4a, 0x390c7004c115ef36, 0xbe7bb2d7b2a96bcd, 0x231cda4b5,
+0xa7109de1c927bb2a, 0x308c5d190c04d526, 0x7eae9fa6eb3862e7, 0xc3d7703ef66d4cd9, 0x9f99eac99ac0d1a8, 0xae498fe8a947619b, 0x2242f65b7ba11e6c, 0x44173a1739ca9073, 0x87a0599d516331d6, 0x138fba5d3,
+0x514117a88645e1c9, 0x68e440f56e55d434, 0x544ca6b41284efb7, 0x4c119c554461bb9e, 0xf7a4faf5465820e, 0xbd3158420c37d8b, 0xeb1ee6f7f4f2a631, 0x9aa9a881499840a8, 0x767a7e7c79d01a35, 0x1ca2dd385,
+0x100ff854d32c9583, 0x145ff5224c79ba4, 0x4170cf349be208ba, 0x38ea264ce6d74c64, 0xbed1ca54ddecaf19, 0x1faaf8f4383d9fe, 0xb2ccf0da3e142a5f, 0x2406fc7e86891df1, 0x575f872116dadc17, 0x1d67126c4,
+0xecc6c18c2509755f, 0x955fb658082e615e, 0x57355b207a89a8b4, 0x410e9c83977ef42, 0xc5e1dff20a077648, 0x9376c8589a4253d4, 0x681730402dad9968, 0x8813e13e999616fa, 0x420e1156870115e7, 0x93beaee1,
+0xb0088014cd355f37, 0x43ba423caeb2b29f, 0x41730db9d56d5768, 0x5f6089cc28dd6dcf, 0xae3d71a575ca5fd2, 0x75b6e9edbb0c2f13, 0xa9337468a947155d, 0x81d3da4a7d1170d7, 0x1a0f8a012f14ac5f, 0x1225147ee,
+0x207e86d79c5b3f70, 0x9b809c72ae503dfe, 0x9d42b9422b0f980d, 0xcb907db289b3ceb2, 0xca69fd5f3239ba14, 0xc80cf5d0f452087e, 0xcec6d35c9341408, 0xa236df7e63db7b45, 0x45f09e66b439ce0c, 0x11225be0e,
+0xd0327b25def72490, 0x71607a86549720b4, 0xd5234df0535a633f, 0x4cd28ccd36bafe80, 0x85c456c7065f0d66, 0x39d34a20fb353dce, 0xfc66554bf89393cb, 0x422ef3b4122724ea, 0xe51b9b56590573b9, 0x67385eb4,
+0x4334a4e74626e417, 0x7a0d4dd108fa748d, 0xdfb429cf2b9181a7, 0x540bb4a82e3dff4c, 0xbfe0220ccac8fa2, 0x1344c7790382b5ba, 0xa2f274035614d255, 0x90e3d1ac74954ea2, 0x607cb22e46f8eb16, 0x156149218,
+0x8fdb21fcacb66ce7, 0xcb35d61999e4c8b0, 0x748ddb1c776f6386, 0x2168fe41dbc77236, 0xff877909accd38fb, 0xb63693373d9663e2, 0x956fa0a7765a4980, 0x658b9b73ae96b361, 0x3e28b74fbc4c236e, 0x20f7d7ca3,
+0x8a6f77f8b4b20809, 0xfd783d89e0257c7e, 0xbf7607ee74f5319e, 0xe0aa1bd207f97944, 0x367a737dc67b74fe, 0x6fbcc5c52ecc4bcd, 0xe1f5e6738171cbf, 0x138c60e7e05aab7f, 0xd62f56b3451fc463, 0x14815eeea,
+0x9658e11becc280a0, 0xed2717bc0478d0a9, 0x196e6d10ee4516d2, 0x1bd6488db393ceb8, 0xecd3b61fb1742a89, 0x289190c0bfaeeeeb, 0xb8a87368ec5bdf83, 0x10a115d19a0943e2, 0x87c94e1749f74dbf, 0x1395e7dd5,
+0x1816a596cc11c1e2, 0xc4dc7891c3e7d80e, 0x6c019f3dbb409425, 0x1950111a66c2cd5, 0xd2510c8cb4df98f4, 0x874b96ec4a9b6f61, 0x591dd7c432fef855, 0xdb80c80e8c72e597, 0x93bacd2b4a2d332f, 0x162c92d4e,
+0xc311bec916afdabf, 0xece273e1bed8d6b8, 0xe8f7a97b25a85d5e, 0xe5fd0b472d3ad70, 0x337d582c593fede5, 0x51e6b72b1a31a32f, 0x74962cbd17b137f2, 0x9ad6ff20c07279c7, 0xaaef7ef83127dd47, 0x3972da58,
+0x66b3918e3fee5dbd, 0x12853df493b2476a, 0x4a8202d0de377b2, 0xc0040d3bf9a2197f, 0xa8da0ed17c21f110, 0x9941a437755f5e07, 0x74401d92ad619847, 0x323c8678058517e2, 0x9bfcd39e53b317c5, 0x12611f542,
+0xdcad32a098d61f79, 0x1f77f5259e1cd25b, 0x89da9d40c0bfb9a7, 0xe93de4da2cb3c5a9, 0xe58936365512ace1, 0xedff4eb4712c3d0b, 0xec783d44da5c030f, 0xeda6c2d6312541d, 0xbd8d13d046a2df04, 0x1b442565e,
+0xea9a39c54dd052f3, 0xe6707a959332ed0d, 0x62a782ede04354a0, 0x306648399fad28f5, 0x6ff4bc8986b475fa, 0x979d97d346365ed4, 0x94ac48cdca9c6b74, 0x41ca1f48cdd1a395, 0x9727c0188b77e817, 0xb218f621,
+0x8a12754f5400999a, 0x19381c3b6fb8afe1, 0x72c233072fba3fc3, 0xca865119fa53b7bd, 0x902978fd63a082b8, 0x3eef694f2cb0e406, 0x316418ff4985400b, 0xfe3dc3b0ce152a3, 0xace29e0348ab60c8, 0x21d47404f,
+0xc089fa673cebe8f, 0xdf102a088fb35950, 0x5438f85336618479, 0xb3423cc5c365f0ff, 0x964cc56558e2cc13, 0xbec4b2a21cd9b3ae, 0x2131465766cb90d5, 0xf31e1078d646033e, 0x68cdd7b311908459, 0x21eddf01,
+0x397e71c549732f8d, 0x432ab7ef0d3f7058, 0x99cfe128a7b8077c, 0x53e9711bff869847, 0x5ca75ec2d788f24b, 0xcad7d2de1380ecb8, 0xf60bec594135855, 0x9a4853845be3ba44, 0x70596a1fe238f0fe, 0x163daf1f3,
+0xf91682fd0ae57151, 0x71864a40941f0147, 0x4dc2d02d12014c82, 0x1f0c6c808dc47df5, 0x4a243817000d63f9, 0xf194a1098f3272a4, 0xd6aff11a5a628000, 0xb020c4a292b847af, 0x4d685bb2bf1a1c82, 0x1b88aed8f,
+0xa90c11d4122b933d, 0x5751918e417d6bd2, 0x15c96f98fd9f034e, 0x7045e3279bb52e73, 0x384a8d7af63c83dd, 0x8febf2a9a062658c, 0x6b34a5fd3dd851ef, 0x4deffe32486e8dc, 0xdb5a0b466adb88e8, 0x1c489e126,
+0x6ad6960840c5a43, 0x4f9c34209e37390, 0xe2d813f4466dbd68, 0xa7f646f43b752bc3, 0x3f4841b175ec0b87, 0x93d1f89fbb055d78, 0xc3bd8788a7214f02, 0x4e3ab4e525a5e1e4, 0x4be0094f6b41d3c9, 0x15fdc8ea4,
+0x435a4013e5cb2f20, 0xccafd73b5446292d, 0x74f742c0e2afd734, 0x3a8ec0d583e53691, 0x97dc6e0e49216648, 0x7a8d4cb96e825b10, 0x487b7423b1ea38d6, 0xf31d84362d38d56e, 0x2d7077d2c0feac45, 0x235e50b94,
+0xc3de16ce72bfaab1, 0xaa5c18169fbec749, 0x22bded92130eea43, 0x9f1b8bec77c70a4e, 0x377c0d42884ce2e3, 0x953df8e72801c902, 0x41c0cfabccbeccba, 0x14847ce6ac5cd6db, 0x63b3ccb896eb566d, 0x19ddc4646,
+0x1e0c3b9a957a4ac0, 0xfb4560e0d2d5ebcf, 0xd5a6c1acee3517c3, 0xaa4b4e3be4e13054, 0x2e4e7a510c3d1e76, 0xf5ef8900e3fce120, 0x7b92ce40e0d8c481, 0x4a98fd8dbfca47af, 0x4c54449710ff8666, 0x16879bfe1,
+0xbde114f939a6d868, 0x6003fa26f189ca15, 0xa418b301235e4c0, 0x20cab603b3b32cd4, 0x12e00020d6e39889, 0xbb71e71d2826d44a, 0xca93df77502d8f55, 0xfee5d62636497a6e, 0x7b8227501a2500d, 0x118d39c15,
+0x3dc113ca1a61f935, 0x560c773abef441fe, 0x7c04e6257b0fde66, 0x9f05fcaffc8f7ba1, 0x23a59a09c586c18f, 0xabdb5d7a909e8942, 0xdd756fc4e12df358, 0x6982bc770e224c4e, 0x680f89643d1be8e, 0x11aada046,
+0x660a98a05e3991ea, 0x76f141f63924c73c, 0xfce18c62c10de155, 0x4cf6a5145496ba7c, 0xdaaadb5faa40421b, 0x3799a427cce47031, 0xab85d765628d780c, 0x86cc2987af34f172, 0x2911467ff91b99ac, 0xc436b1d6,
+0x59f66003db269a44, 0x8351f7263b5c5832, 0xfbbdf7dc77e15eca, 0x9ca3a55c9314cae0, 0x5080325b67d188e5, 0x44c8c450d5176d63, 0xce2bb043e2bf02d6, 0xb6613f094361b3c8, 0xab63a7a65d65513e, 0x23df2bbe4,
+0xf60c2875dac46eb4, 0x61699d49f0a18b41, 0x8c016a7150425d5, 0x77e17027e603b6b8, 0x929e881ef8245d15, 0xd3c6704b7eb94532, 0xf331fd4e926a23bf, 0xc48a2149d9ef342, 0x2f257616e908cf29, 0x258d471e1,
+0xec29a109db15d3ea, 0x5f774efce982c2f3, 0x5f74e78e44b69af, 0x120aff25cc30dc39, 0xf71ee68f95f24cc5, 0x5579a3008ff44a2b, 0xdfdcc986ea4835af, 0xc4755b7973b615ee, 0xd33f8e58c0e9df80, 0x14199e4d,
+0x4f00d2cc87c14f3e, 0xf4f8ab117823ea29, 0x622f0579400cfa7, 0xaf3df19c6dd63e80, 0x83766903001e88fe, 0xef42d6afa2fdc67c, 0x4cfcd51eb134eb18, 0x760f71af87aa908, 0x366f1045f162d131, 0x367aef1d,
+0x49e7004ed3db94e1, 0x427f50060fae47f1, 0xed5ae3ed82b8f297, 0x2cb5b7c2e0140ed3, 0xe2222755f6b870a3, 0xa6896c134ca8b016, 0xdfded26c3aadbc91, 0x282c9906e67ffa80, 0xeee589c8c2f077d2, 0x5bf2ef84,
+0xe52929674d35678a, 0xc45e157328423ee, 0x8aa93809dba13b6b, 0x88575855745bf18, 0x217b5ca09d859aeb, 0xc9d22c9c048146b5, 0x49c8c4c024f650f3, 0xb58879631f83a6a9, 0x9d030a1917e53cfa, 0x263f2c333,
+0x3ddc5036597783dd, 0x727063b5bb3562a1, 0xcf0868b7ed1281, 0x9fb3307e15568d4b, 0xa390ea63f2bcf526, 0xdd7fd9599ccfb49b, 0x1ff555d8bb469333, 0x1e0f5e7a8effd4f2, 0x6c0c84698ab0b62a, 0x52d3590,
+0x8b7c902cb12bc16e, 0x71eb49fe31574524, 0x9d96084db7ab5a72, 0x7c31af47c7d52061, 0xa9ffe7ef186f7672, 0x4f545a2a3733fc7c, 0xa66e17ab807e564c, 0x64914cce97f96887, 0x428ad30a77bd7d7e, 0x1908728a4,
+0x6436199f4e54eb7c, 0x6cf8d7c167630f6, 0xfdf09b1c68f3abdf, 0x5015f545ec4a1f06, 0x83436d06b92996fd, 0x4d941f83a729f5cd, 0x9106a401768167a1, 0x176063bfa615f3af, 0xe1ab152a9b0ff7b4, 0x26cbbadfc,
+0x5f9d3a6a946f9520, 0xb0763985407a2823, 0x7346d76720170d90, 0x74bc5c9a75d2c142, 0x173b6d390cabde3f, 0x3a5248695635981c, 0x128d331790a74220, 0xd162d8b1b99884fc, 0x9a69504b2516b8ba, 0x232a1ebb9,
+0xa87df77056e938ce, 0xf486c72b61accdcb, 0x3ccc4beec98b0d3b, 0xda6c5e9d20b35c52, 0x586a00273e239e85, 0x6e1b4f376734a732, 0xcb78853d8b07cdad, 0x4d577b545982127d, 0xd6bb921f9b3ef46b, 0x276f9a17c,
+0x70441357e8eef55e, 0x3882a101dac9489, 0x15e9646d4aa738a7, 0xbc4d23999d2deca8, 0x33c3179d4fc9da39, 0xa035a0b0c18a1d2a, 0xd279500bf3973972, 0xb45ce8e8b28eb32, 0xd118488bb6588712, 0x1ced2b3f5,
+0x7f7ab4e29a06732c, 0xd64dfec00372e55e, 0x6682109547ace192, 0x5aae09c9fb19e238, 0x94fbd7e70991a30c, 0xc5b1e6079ce023eb, 0x51eaa23251345f71, 0x44c728868ad38efe, 0x950b6363c81489da, 0x197f7ce39,
+0xd0780c26814e9e90, 0x4a6434258a4269fd, 0xf5761aebaa47ebaf, 0xd0d1db8178fe45f, 0x2aad76992199d28e, 0xdc002ad3200cb098, 0x28ed97ad16f6e009, 0xc35b18321a34a16d, 0xb9a0a435ceda9a77, 0x18e13b780,
+0x794faf859c35c0e1, 0xe8e3c2f19cc2f824, 0xfcbcd5294c40769e, 0xea6548287c0e3c50, 0xc545005348a68b25, 0x87ff203702d1cf9e, 0xadfc7d17e643bcd5, 0x29126458aa54742a, 0x479addda218c9327, 0x1d5f4d1b0,
+0xe6c16c031d324448, 0x16b4893c28e2dcd1, 0xf88539c4bcea7573, 0xb4747ecb7165e71a, 0xc0404a8c70630fbb, 0x1bb0915450b67, 0x9862b874a5f611f8, 0x98a9cb655722275d, 0xe999b8e0bd37ea74, 0xed928d8e,
+0x1c83e179c8f69510, 0x9f1290efe7debb92, 0x7653f3d62db5d7a9, 0x3b6579569e1f537e, 0x7c225045304f45dc, 0xef72dadf9543bc0d, 0x73b2488b45ea1c25, 0xffc427db0c9662ca, 0x59a498c1edff3fed, 0x457259de,
+0x2259779b4db8a5af, 0xbefa359f068f222b, 0x77dd79531530662e, 0x45256b29c16eb64c, 0x133f38c385edc63a, 0xbab06679a1a0de29, 0xcce7687e43127f75, 0xd73694c55eb5fc0a, 0x344223fec5c8cc55, 0xe9860c62,
+0xdb22e7bab36d65e8, 0xd5ade73df81ec28e, 0x7e8456e23aff6b57, 0x87039dec9700fbc0, 0xd727a7cf153f5bd9, 0xdac9d28142709220, 0x555f2524643f9436, 0xfdf70592c3786a82, 0xc699791f21858c77, 0x7eefd92,
+0xaf2d3f1d38e1808b, 0xab3f885d7eac7f85, 0xf19265b7051d08e3, 0x97939d3e435a0f2c, 0x355e5409f340fb7e, 0xe11a830068d225a, 0x36bed4869d545bf7, 0x4b404b2257f118ce, 0x29193119e20a7797, 0x1aa067b9e,
+0x346c217c9cd60cd6, 0xcd0a4db898461f8a, 0x3caf1893582d1452, 0xc075f8e13e1c0cfb, 0xd3cbb8b006725b61, 0xbdbe17769177ca69, 0x36fd2081a9f890c5, 0x8cc9a9337f76cbf1, 0xbcfd4bbffc7010b0, 0x1af7fec68,
+0xb51d21a91292cdba, 0x5a555fd766e4e4d8, 0xd073e7173901a297, 0x5d983af03f4e3ba8, 0x8d2fa9e21491c71a, 0x6d5bfd445c746393, 0xbe299b1842c32898, 0xb7aeb7f1624cfb4, 0x18af8d3bafff114, 0x14b58df3e,
+0x9f5aa00e388ca54c, 0xab6ea1fc92709f2, 0x4f2d1426641f84a1, 0x6e3498b46035853a, 0x953c55b9dc3cca33, 0xa296d5d3590056c5, 0xf94fe09799f80764, 0x91a6d3e485d5adcc, 0xbceb3adfabf132ca, 0x27579a124,
+0xeca7bf222e1d709a, 0x6aa45f6ff006c0a, 0xd38bf11f1dd02d28, 0xe5980c24fc8c7613, 0x4ccce40c5b2e483d, 0xfa14ef6bccd649b, 0x5d2c41cb11752861, 0x2189d6d8b1c4c428, 0xe5be58428f7af252, 0x2313ce403,
+0x3e7d0e31f54c3f3e, 0xc48a8fb59b9ddc39, 0xb9e84db3d80f8953, 0x6b51302e99f1f671, 0xf400d562824daa52, 0x7fecb24e0baece7, 0xf4854a22e9ac3280, 0x61cffa674730826c, 0xa2572e0492406265, 0x125904822,
+0x8298517958f7ff6a, 0x3babacace64f52d6, 0x972aaaf9cdf60c7e, 0xf7b319002a629698, 0xf1722c0bce4599fa, 0x571388e70e98d9c2, 0xae998eee5f038a40, 0xca3dcc0420f9a776, 0xc25878c6d94b56f1, 0x62908803,
+0xe842de8e497df434, 0x464a4b617da6edb8, 0xc5cf85b3d099ba40, 0x79f0b60825a59fc2, 0xc4dcdbeff8c4655e, 0x5c306d213d73bca7, 0xdf43d071f0deac0b, 0xc8f500ca26b460b7, 0x47e029de8105d90d, 0x4465e3a,
+0x408dfc9954d03499, 0x4e834c14881d6aee, 0x390e21cf1e327588, 0x1280f2d670ed9914, 0xfa8ff981c5020b70, 0xf8849653f4cfe09, 0xee677bc6702a7e87, 0x2ca10783d268b096, 0x449efeffb3051e2d, 0x279bb5919,
+0xc0a1732c80d43581, 0x7eb58f52362c7216, 0xf1b7d88666c231eb, 0x2d1ce9d4b1dc9c9b, 0x5da67358ce82c923, 0x201edc7083d0bb5, 0x630cb021d6e6c8e2, 0x7cd56ea12226e0f2, 0xfcc45268d083a2d1, 0x1bfeb27aa,
+0xf490d6b5288831d2, 0x967637b59b888900, 0xc0f997a087701ba8, 0xa7ab3b53cbb740c8, 0xfafc7855ba14ae1c, 0x7f732c43697ef0c7, 0x205e4e9f3ffa47c7, 0xdd61dc69f844f245, 0xd1807c5fd5f54351, 0x17419cc53,
+0xb225e5d9d47cbf35, 0xecb6e485164650ff, 0x8d222f824c778a93, 0xdb5979d656b2e1dc, 0x72b2e5287a5fab91, 0x82900ca87bd9def3, 0x2673f9901479c688, 0xfc2458cc2f52d3a7, 0xeaad61f0b268ad6d, 0x8add5278,
+0xa03385433fc34d3b, 0x97b2f0d94462d9d0, 0x2f2f1b281b44e415, 0xf8a15e86992618e9, 0xb00f2499483145fb, 0x39e4a59f42568e26, 0x9ec90ce3379355f3, 0x574ee187eea2f5c5, 0xd1fce9641af61497, 0x1e105faf,
+0x486db287c2f370c5, 0x1c2ae6a84e04475a, 0xec4e2893ababaf1e, 0xf9bb7fea0043d08f, 0x2d8e75a853e0c0d6, 0x3592999166259fdc, 0xca252d865d128b25, 0xfe08f58a6e46cd04, 0x4f57c6c4c02b78cb, 0x1b5bcf85,
+0x7665c2cc49dd73a2, 0x79b317bfffd9dc99, 0x6378466a4ad19478, 0x378aa5d21a69910, 0x12f9733c6a382b66, 0x22da5048f012598a, 0xd3d462c668ff936c, 0x131e0b76e60c0d64, 0xace81437f98d20c, 0x1d8f79e0a,
+0x9d92917bc68671b6, 0x5e90e3d25282bf60, 0xba1646be145ef077, 0x78f677af70d37a2d, 0x990bfa45019f6e27, 0x9cc7cef9f9d1d657, 0xd9afa30b635ca5ef, 0xbb12f8b99bf233dd, 0x62015b167fd84e58, 0x4a2ad674,
+0x7d0600d98a7e7a91, 0xbb5857c87a896409, 0xa8f3bd3e6f847a21, 0xd5bcca3adf05db91, 0x966b3eaa9e1f4975, 0xa1c5b8606b901c1a, 0x7f384c65d4aeb0c, 0xbc1047e4c82fbdd2, 0x53fb8abd43a2ad9d, 0xdf031da1,
+0x5405e6d1e685663a, 0x9b6a901648c57d7, 0x4112aa0b80885ad6, 0x63c3622d8cd6f64a, 0x4ae218d420fab586, 0x4f26991394e8f88f, 0xa91d04186ae3164f, 0xaa366545ed911262, 0x2f1def39ded93845, 0xea0d823c,
+0x96b6f1ee510cf886, 0x77f19c8a7456b02b, 0x5f77a46606b699cf, 0x918c148904ee34f4, 0xf6915b32fcf04127, 0x72ed11fde6bfedfa, 0x30921d2ad436821f, 0xbe6d4c49c86a8e7a, 0xba128aa6f4e2b034, 0x1250dab5,
+0xbe3a0e20e6cca24, 0x56e19746270d7b76, 0xa2261b617535fc, 0x3fab1c3079f2f0f, 0x5948983f30b3541c, 0xa56d27df0cb1a10c, 0x235f407c8afedffd, 0x147b2b8944094e5a, 0x805caba9fd8f57ba, 0x5cce570c,
+0x4d4e0d6fe8cf4a01, 0xb7fb04d719667cee, 0x1cc85763334890ed, 0x806515fccb8aa87c, 0x5307566e313c04e, 0xa4149bff985ba0ba, 0x246f419cc677ed4a, 0xe9e8a2e817018c12, 0xdd40548061532fa8, 0xa6483912,
+0x38c7b0043d0c9dd7, 0xb492a0cc7fe860b9, 0x4ff4b96859736eb1, 0xbe9e5b3f9370d5d1, 0x53d2b27c2d9b0b7a, 0x3bc4a63f8ad5aca4, 0x790a88a1a60ee06e, 0x83312abf07122728, 0x9f44dbdfb0b3e981, 0x7535ea7,
+0x24ea24bada34e8fd, 0x46c3e26bd6e4102a, 0xbddd0e14810c2cb7, 0xbc93276952a76539, 0xd73711e3f883b6ba, 0x5821f0dbdb2bee18, 0xd5988a16573000ac, 0x388385d46290c857, 0x6082fe5664d0a310, 0x16423aba,
+0xa81e41911fb6deb2, 0x8b60d08f869a924e, 0x464936f6d28510a0, 0x6ca99d5e0907b12c, 0xf26c2f2d8f4e87cf, 0x1dd9f28200005425, 0xa048271273f3f7b3, 0x17dd71ecd8787d1e, 0xea205c00ef6d85c, 0xc54980a4,
+0x222630d34497635, 0x6b04bf1d22f04b97, 0x2525a34d59f8e708, 0x73ec91e04c462728, 0x17c6041ef0ac27cb, 0x17e95f7139524a68, 0x92735377303b0d1c, 0xf81c5c02d3518f73, 0xda7cc511a57d83e7, 0x1809660d3,
+0xd17a4d34810636be, 0xa73994a7f21164c, 0x880de742fa38e216, 0x3bf185daa109a65c, 0x22be995ffc9a5770, 0x6ab47f2268695cbc, 0xc6d859b7d0cde46d, 0x67ed9f76958e356e, 0xa6949718f4b3904f, 0x43f91bf0,
+0x2f079a6b77a383a7, 0x5fc6191e6fd964fb, 0xddcc1c261639a13, 0x8ef8c7e2da1e8dc9, 0xd5605ca2d912e05e, 0xd8139da58a538ee1, 0x96d0f133e42cd542, 0x66fa1e655ada5192, 0xb6430fa1e2e405b6, 0x213783fa2,
+0xcf3241c11d2f0da3, 0x69a4e775ee9fae43, 0x471d369ef074441c, 0x4297210d65053839, 0x9b70aaafb0280ea9, 0xf2f316078fda07ff, 0x9622133fb7507c8, 0x54898eeb825eec07, 0x45277a8c90b57784, 0x1364f05bc,
+0xbf967314f4debd5c, 0xb0254578bda4e5d1, 0xd8b76f5b81e163ef, 0x511824adf3bdbee, 0xd4fee742cd465f84, 0xda68502ce5bff5bb, 0x13cb34fb632d3047, 0xb52c4f11b9234569, 0xdd35c2ab70d317f2, 0x23efb3f65,
+0xaf4153f6aeb6bc09, 0xc781c8df4c260895, 0x1430b38e81a6d386, 0x178fb186efb1a72, 0x7e3dea164e9ec0e2, 0xf647ff1e7dd2273b, 0xb7b0a9f6c909cbc1, 0xfccee194aafb7a09, 0x90e0f43281114383, 0x9325776f,
+0x9ab054bc84a483be, 0x2085ec547152a253, 0x6394952d6a784686, 0x1118d146daa43ef7, 0xc8ef6a8fc65a7767, 0xacb115f5a8b68c27, 0x4d3ea047479f810a, 0xd64ae74eca5167ea, 0xe7aa45bd3f864452, 0x258b4ba6d,
+0x2daa234d150b5f25, 0x6a0bf7bce763950b, 0x39ddc826fbbc3c15, 0xc0b037e5bcbc4a39, 0xd0dcf7741936c443, 0x358ee5075685b230, 0xe9b419009f8c7e86, 0x1a86ce44ef95edbc, 0xfec5a8a3f2f03322, 0x17005902b,
+0x7854473cb7189f8d, 0xbf417b7f84cde35e, 0xe29b9bee1cc87691, 0x7a0cc6aa5e4a3b6c, 0xcac569f3d7bf90cf, 0x8bfed5d908babd39, 0xb1aee458f77b3b6e, 0x75488443441a675f, 0x42558989de40df68, 0x234a4a392,
+0xeda490b2d09f8a3b, 0x2ddab3c9ee82654e, 0xdc1226c8867d324c, 0xb515028b57ecb2fa, 0x59aec39af53d1444, 0x1d27746fadffc44b, 0x491710fb39de13a9, 0x5530ca98d439e2c2, 0xeecfc7b2ddda131b, 0x186a82778,
+0x40bd4bc56f6d5d66, 0xf33d8749ecb96c34, 0x7a3e51b303468140, 0x115abd35ce8ca181, 0x5eec091464b7d16f, 0x56abf61e55522125, 0x6121a67de21813d6, 0x30e215faff6a34cf, 0xfc811e57ecde25de, 0xd2174005,
+0x135265ab3, 0x0, 0x0, 0x0, 0x609a000000000000, 0x3754fa4ecef9be90, 0x83f68967e4db82a9, 0xc5ccb347607c507b, 0xb8aaf689409e352c, 0x9dc814c3,
+0x67205e1b881d075, 0x894bb12afe2fbcad, 0xe7c2b8ff7c89a4a4, 0x3ccb5c538771a30e, 0x472e884966422a98, 0xce478a13952d16fe, 0x97e302edadbd26da, 0x514eeb8a7ed09cdb, 0xce48cda905f9fb56, 0xe0bfa119,
+0xc89de66a8d99bd8, 0x9844c90b6e339aaf, 0xf4db2febc3acb175, 0x6c0b95052f1f7ffc, 0xeb0acf35ac3e1e7f, 0x2c81b27ab22e4b50, 0x655495dddd45e2f4, 0x319efe9f3c0a0a05, 0x7f6207cea192bbe7, 0x215fdaeff,
+0xc887bbcb9791a668, 0xf81f5b3241a1365, 0xf696f20f316588d, 0x5fc5d13957f0eac4, 0x6d3c4e2ab3a54647, 0x948f9110cdd1e02, 0x56b358bf5417376f, 0xc09e51e99880a53a, 0xdbf11a17e2a47033, 0x1bec465e7,
+0xc571d0f1e43db556, 0x835ca5ed1c3cf19a, 0xf69cc5da0b307aa1, 0xc5b90f7334606fa8, 0xcffbf7f91a44e68b, 0x4e044957c76e4d21, 0x895ab338d34032c2, 0x80ca742ee4859ead, 0x578eb9ded4401917, 0x8601fe90,
+0x5e8c2fbc45ddec1f, 0x9a12b6d38c0ef0aa, 0x4390b7f02aa1e3ff, 0x86df555c4083af31, 0xbd3f48ce3eb6e66e, 0x3ab05e93cfde423, 0x5555e09e576407c2, 0x2d6cc599eaec3312, 0x366215403db4d2a0, 0x532cc8f9,
+0x9a5bdeef41102c66, 0x2a46f592cf66d789, 0xb681cf2d26da8c81, 0xefaa7d843ee58b39, 0xf3c39c6f25c43a19, 0x8bdc652ee6c482e0, 0x18fce898d63a516, 0xff719eb2c067c994, 0x83d31cd306eb2ada, 0x5374923f,
+0xe8879609b6e0bcfd, 0xb621f428a229c546, 0xcefb4ceba2cca1c9, 0xb37728f5dd22b486, 0x500489f5ca8e5381, 0x9457ac5f174085a, 0x1e15bbff99e89d97, 0x42d136d4e1be9961, 0x14d5cf560d132bf2, 0x27a7158bc,
+0xce1991cc, 0x0, 0x0, 0x0, 0x3468000000000000, 0x9b33857a50e2f47f, 0x149430734647a838, 0xa56c442ba0d5a3c4, 0x26d204dd0c595e7b, 0x21129d2c8,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x9a5bdeef41102c66, 0x2a46f592cf66d789, 0xb681cf2d26da8c81, 0xefaa7d843ee58b39, 0xf3c39c6f25c43a19, 0x8bdc652ee6c482e0, 0x18fce898d63a516, 0xff719eb2c067c994, 0x83d31cd306eb2ada, 0x5374923f,
+0x177869f6491f4302, 0x49de0bd75dd63ab9, 0x3104b3145d335e36, 0x4c88d70a22dd4b79, 0x1dfd760a3571ac7e, 0xa832d322b8e6a7d4, 0x7cd203456aa75c14, 0x6f847c252f058bc9, 0x6cba416c44d4ac9a, 0x1854eac,
+0xc571d0f1e43db556, 0x835ca5ed1c3cf19a, 0xf69cc5da0b307aa1, 0xc5b90f7334606fa8, 0xcffbf7f91a44e68b, 0x4e044957c76e4d21, 0x895ab338d34032c2, 0x80ca742ee4859ead, 0x578eb9ded4401917, 0x8601fe90,
+0xa173d043ba2213e0, 0x65ed492c73f10f55, 0xbc6f480fd55e1c00, 0x7920aaa3bf7c50ce, 0xb0c2b731c1491991, 0xadcd47ff6d5ccc0a, 0x4591dea6ad2bf1e9, 0x84e8ed6025d7f218, 0x4b2dfb82143305ec, 0x228c9de6f,
+0xc89de66a8d99bd8, 0x9844c90b6e339aaf, 0xf4db2febc3acb175, 0x6c0b95052f1f7ffc, 0xeb0acf35ac3e1e7f, 0x2c81b27ab22e4b50, 0x655495dddd45e2f4, 0x319efe9f3c0a0a05, 0x7f6207cea192bbe7, 0x215fdaeff,
+0x37784434686e5997, 0xf07e0a4cdbe5ec9a, 0xf09690df0ce9a772, 0xa03a2ec6a80f153b, 0xc5b1d54c5ab9b8, 0xa82f54d79d7d922c, 0x44346685b078c23c, 0xf1b7611078437ff0, 0xa59ef6aa6f436858, 0xbd324180,
+0x135265ab3, 0x0, 0x0, 0x0, 0x609a000000000000, 0x3754fa4ecef9be90, 0x83f68967e4db82a9, 0xc5ccb347607c507b, 0xb8aaf689409e352c, 0x9dc814c3,
+0xf98dfa1e477e2f8a, 0x76b44ed501d04352, 0x183d470083765b5b, 0xc334a3ac788e5cf1, 0x26d377b699bdd567, 0xe330c3d5152d9930, 0x304bc5756d2d2d0, 0x6106c76f91f3884f, 0xb34743194beddd36, 0x19b37064e,
+0xeda490b2d09f8a3b, 0x2ddab3c9ee82654e, 0xdc1226c8867d324c, 0xb515028b57ecb2fa, 0x59aec39af53d1444, 0x1d27746fadffc44b, 0x491710fb39de13a9, 0x5530ca98d439e2c2, 0xeecfc7b2ddda131b, 0x186a82778,
+0xbf42b43a9092a299, 0xcc278b6134693cb, 0x85c1ae4cfcb97ebf, 0xeea542ca31735e7e, 0xf15f6eb9b482e90, 0x5acc57ca55088f09, 0x39c618c72277e5d5, 0x81739cff1159f05b, 0x850ef26a6509b2ae, 0x1a9df6762,
+0x2daa234d150b5f25, 0x6a0bf7bce763950b, 0x39ddc826fbbc3c15, 0xc0b037e5bcbc4a39, 0xd0dcf7741936c443, 0x358ee5075685b230, 0xe9b419009f8c7e86, 0x1a86ce44ef95edbc, 0xfec5a8a3f2f03322, 0x17005902b,
+0x87abb8c348e76072, 0x40be84807b321ca1, 0x1d646411e337896e, 0x85f33955a1b5c493, 0xa33c960c28406f30, 0x2579780fa19ff2f4, 0xe938daec0d14be3d, 0x3d0d2eb6cca9bdca, 0x3f3a873873a6f924, 0x475203d6,
+0xaf4153f6aeb6bc09, 0xc781c8df4c260895, 0x1430b38e81a6d386, 0x178fb186efb1a72, 0x7e3dea164e9ec0e2, 0xf647ff1e7dd2273b, 0xb7b0a9f6c909cbc1, 0xfccee194aafb7a09, 0x90e0f43281114383, 0x9325776f,
+0x654fab437b5b7c41, 0xdf7a13ab8ead5dac, 0x9c6b6ad29587b979, 0xeee72eb9255bc108, 0xa512957039a58898, 0x4c737f301a42406, 0x4da91efdbcf078a1, 0xdc0acbab4672bd40, 0x99e5cb0512619439, 0x2341ecfa };
+
+const uint64_t window_for_Bob[(1 + WINDOW_LEN_BOB * WINDOW_POINTS) * 2 * NWORDS64_FIELD] = {
+0x670cc8e6, 0x0, 0x0, 0x0, 0x9a34000000000000, 0x4d99c2bd28717a3f, 0xa4a1839a323d41c, 0xd2b62215d06ad1e2, 0x1369026e862caf3d, 0x10894e964,
+0x7cc6fd0f23bf17c5, 0xbb5a276a80e821a9, 0x8c1ea38041bb2dad, 0xe19a51d63c472e78, 0x1369bbdb4cdeeab3, 0x719861ea8a96cc98, 0x81825e2bab696968, 0x308363b7c8f9c427, 0x59a3a18ca5f6ee9b, 0xcd9b8327,
+0x432712de8f66ff84, 0xca807f8d832e555b, 0xc241f575982cd5b1, 0x764e988bdc832777, 0x730a54b80dc2b829, 0x57112fe518165e86, 0x7316cf03c8623f7e, 0x96f3221c664828d6, 0xb4370fd0b2ba48e8, 0x225becd73,
+0x13d252554af613e9, 0x66d32cbdaa2ac41, 0x12e20badb7db4b3c, 0xea68fd8dd7ce0884, 0xf68e7ff096c11f22, 0xb306cec7e4ae0fe0, 0x49cddf6a3efaa26b, 0x31a4ce7270587b3f, 0x51d48d1f9df73eb, 0x237ef0f36,
+0x7692d35b0cf15444, 0x618449018081903, 0x82bc0ac704f455e4, 0x2926e2e2865a72af, 0xe26edecfce9bdaf0, 0xe5f8f43dcddac881, 0xc355f7ba6e1ea01f, 0x5dd7e4f5eecabb4b, 0x57130431a2b2904d, 0x201e72b00,
+0x9bb39f26574d0f03, 0x323902e87b80b29c, 0xda2498a3aea28e63, 0x3708700145a1be9, 0xfae6fb11c418bc8, 0x85db9868379ad3b9, 0x5467f0acef732f5d, 0xfb230613897aa284, 0xd2759f194239116c, 0x2454891fb,
+0xdb0c93e20a9b35c4, 0xc63ffdbf086a1ffa, 0x7ece78c2a1eb015a, 0x7216c87301606647, 0x1ec82e0e0357c50f, 0x1cefad9c2e720089, 0xaa1b2484acea6e13, 0x23ff2ddd882b3be, 0x4e55fe945ba1ca0, 0x277a1fab8,
+0x4cccb3b90a5bc456, 0xe79af36f530c4f04, 0x37c21e645866f52e, 0x9dc73a37824d2ca3, 0x85a454180f54b529, 0xe983f740b7156317, 0xbc3dd05492c2ca4, 0xfeed261473b2060b, 0xea55c5431c2d9793, 0x129f758f5,
+0xfd37be089b639268, 0x93d0a6b63c0ad119, 0xa0047c71a26e9507, 0xec6608a49118e276, 0x8d6b14bdcf189ee6, 0x19823c2f5c586e2a, 0xb27e38c72edd4acc, 0x5ed5c14796a5b30e, 0x31e1436f1fe456a2, 0x1338e3b9c,
+0x58604c4238dd66e6, 0x6a13808d38cc32b9, 0x7bf88954892ab50b, 0x3655e796ebe41244, 0xb235bf457d229f38, 0xb6203eed836ae817, 0xf907b77db75ce0f4, 0xf91b6d61befd4172, 0xefd022276a0f12ae, 0x12f848afb,
+0xf615ab3f2d9e4948, 0xbba0ebec68a56873, 0xd0d69c5113d53c73, 0x90ebdd4a00cbcc43, 0x6669174e6a26feb4, 0x8f822f59449532d, 0x913ecd1bdc64cc47, 0xb5cf2355a0d416f2, 0x1c56b6997164f0d0, 0x188df637c,
+0xe4138926c1dab95d, 0xb8f15cad2f1f06a0, 0x8e475dcac876ad53, 0x460a2318b632999f, 0x2425acdddd38f6f8, 0x42b13129d6596892, 0x2e1457b945f10cc2, 0xdb2d744ca310a44d, 0x35de3af290ff4b07, 0x5e78feee,
+0x44c26965207542e9, 0x35ddf4d2a2383fe1, 0x4f8375e95e94f6d9, 0x122d490cf3ea301a, 0x52895ac5dd3a4666, 0x566a8711d8fb82d5, 0x169a67f9cd9888a6, 0xc456bbe0e05f45f3, 0xde204743f9781a5a, 0x222ac5399,
+0x88ea6869e35bf4e1, 0x5ef6cb1d429ee1ca, 0x34d7e97dcf14facf, 0x819882eb00121e01, 0xf9128300728eb06, 0x97c25cdc4e8db2b9, 0x4f78e524f29ba5a3, 0xb0cf5885c8dee9ec, 0xbc9a5a48c1398ae0, 0x216371ed3,
+0x979e84052bd97215, 0xd952ff20aa3a8f04, 0x7e455728e5597a4c, 0x12f99818c0861af9, 0x65051d56db0bad8b, 0x83c5e9d3a3a0d3ac, 0x36c708a9ddf09a, 0xb52e0459936c03dc, 0x73fb32b651fda3e0, 0x1cc1d6f00,
+0x7c5c11db5c8f50ff, 0x79a6de95e8ae286e, 0x5e66600314b29e7d, 0xd8ebe45b3802673, 0x40f28ae632e23e92, 0x7ed0ff2ee8fbd61b, 0x11a76e42ab41c71a, 0xd04f25eb6b7a7223, 0xca19857d5ff0e74a, 0x190bac4c6,
+0x68ad8b270fade547, 0xeab1da04f38b7a8b, 0xa80c7123b24d174b, 0x4296f311ca695962, 0x9ee637c78afe2e90, 0x6224b226ce924a8f, 0xb9f3f6edc0ad87b3, 0xb6452623dedff0cc, 0xab82c0a0952728b, 0xda5e6980,
+0x3a55fbf84b6362b5, 0x518cde8bdb054255, 0x32c8e7e683c36a64, 0x4f2e95016b4132b5, 0x1f2db307c9a826a9, 0x9f36ed7280d828fc, 0xcf19a6663ce12cd6, 0x4e1e77b104f97e33, 0xd38c00bb0a73d8d2, 0x1b1ec9a13,
+0x4fb388ae7c21d7fc, 0x1712e7ae647132f6, 0xdba5cda85beca252, 0x637d29aa9e079feb, 0x3a39057bb04748d8, 0x7b374ad50b658ada, 0xa8566afa4567f40e, 0xc169498c09e9cb9c, 0x125b0a559022f475, 0x21a7363c3,
+0x2a40eeaae5806eaa, 0xdd47055ba9e88b7b, 0xac62e5d5ab27f974, 0xf404fcb77627e2cc, 0xfd103ca2e2400b16, 0xd0ba4fdd23dfdec4, 0xbddfba77554aebe8, 0x6ae20e6dfcae819a, 0x95a4b68b5fb69aae, 0x90712cc8,
+0x90d83d031ef41167, 0xd3bc099100cdfb96, 0xa16a702c82376043, 0xaa01612d87e67def, 0x8826627219aec576, 0xd3ae68743e321948, 0x774a699972f420ef, 0x833eb35e0d4fc36, 0xb14c3487c0433efb, 0x2637944cd,
+0x741fdbe120202265, 0x71ac1dc01d3012c5, 0x67cb222fce5144e9, 0xe3b81755906d1a6f, 0x76ee34cd22b82187, 0x83947caf6ded78c9, 0xf62a3960a634f01, 0xfd406817ef0811cb, 0xc44d76dd6e3fdb7d, 0x16ef8b8ea,
+0xc69631af71575252, 0x7be6ab3f6be55774, 0xa8320b4238a4ca2f, 0xa3cd1b22486cf2a1, 0xa281d1352df89b64, 0x4906b2e2084beadc, 0xfc5fe7920d836635, 0xc8b2856121f21ae, 0x46f8d2de6b645761, 0x2e53f355,
+0x8ac5fafb8aa95bbc, 0x8c766e73dea4ccbe, 0x4b6eaf84e75799b0, 0xfe17bf57d9e22e, 0x2774283aadf53378, 0x229ca63f813b625d, 0x25c90206fdcf171b, 0xa2b0158867e191be, 0xbd1eb58813cc63cf, 0x9ff2d7db,
+0xec254c1f5230ec6a, 0xf326aa76d1b1570f, 0xdfff818435b3cee8, 0xf748bda11a49a8bf, 0xddaf908db48007bc, 0xcc50e9bacc3b5f63, 0x8eace1e5bb835e6b, 0xbc396a2b6cbd4d0, 0x9c6906fed667286, 0x24d4abba0,
+0x6f87ace093d6ccd4, 0x97a28494575c10c3, 0x3f906d7c627a5ccf, 0x8830adaed87c2ca1, 0x9ca73c354ed42aba, 0x5bfb1fac4c05fc37, 0x61308383bc03c181, 0xc93146699b2513ce, 0xb55ed7954b27bf35, 0x25ac075e6,
+0x3d5c3d4340433a7b, 0xb2aee14121451e6b, 0x6f3167a34f41c5ca, 0xdbdac3a18d9892d2, 0x15ee76781bb2b9e, 0x3c78993c1e81b285, 0xfd166c5f8bb3399d, 0xca0eb2e96ab8a5dc, 0x25e81f90a54f67a1, 0xe7d3a3b1,
+0x9e82cf22e13d8bd8, 0x37ef18d0a22ba745, 0x87bb3cdf2ad97bdd, 0xd3cfcb5637e688a1, 0xea26ebce23deb6f, 0x1e4a8c18f85f960f, 0x7ee8d3e93a23f513, 0x6af7073c4b48c1b3, 0x2733a7a03ab2ef9c, 0x19038ebff,
+0x70740e2ac3772f3d, 0xdf7ec1370f3d02d1, 0xa83582ec89c46470, 0xdc7e6cdfebe8a2f0, 0xb4209c82ddba2314, 0x31a81dccf6e1fdbf, 0xbc1a8af975470522, 0xde978b711cf6a93, 0xdc59fc9d61260805, 0x62cddaec,
+0x88d81c81548c7756, 0x27917c174a7f6a04, 0xadb9f27b61b3a771, 0x407050385ac2834a, 0x9ce7eee17b690da3, 0xc84b7742da66792a, 0xd4351d4d37593aad, 0xea82580a266f0dc9, 0x92e8531de1573d1e, 0x23d675518,
+0xc0949f83293bd547, 0x3f1d337ca6d5a004, 0xbf6ece7972782d72, 0xc16f3ddf3d8255ea, 0x4039dbd22e69eea8, 0xeda738d60ec1b6e9, 0x7d97509752439bb6, 0xcf2e522358b36ba4, 0xfcced72a6edf937f, 0x57d375a6,
+0xc444f1a6a6f6a9c0, 0x1353740647f1f073, 0x8091c6fcd03ef946, 0x68a75aec684c4d9b, 0xf84cf212fe1c8704, 0x605439c0130b0b79, 0x3490e8060756eb49, 0x37e291dc37667c03, 0x4f0bfac0a1be2656, 0x262b469d6,
+0xdccfaf221459cdef, 0xbeec4b0eb55a3ed5, 0x268f0ad3eed5eeeb, 0x9bb57055e7d16b6f, 0xec51bffd2e13e39f, 0x87bd23651c1a71db, 0x75a3838bac77811c, 0x6df017f7a1293b48, 0x6160fc810053b71c, 0x173dce0d9,
+0xf571b999e6ae2b50, 0x990a3731bf18755c, 0x461a0cb1b94e7b31, 0x97ee122b3708eaaf, 0x979bd8bbd831602d, 0x9f49c5596f9e9b09, 0x8412adabcc78d692, 0x497a7f8ed2566746, 0x821c44cea0af6534, 0x2036e5f7b,
+0x5e5c915edbeff60d, 0x17fd0253d6b8bf, 0x20e95ace31259941, 0xc9db38777ee13c77, 0x5fbe0aaacb16830c, 0xa393344f7ca5ea79, 0x464f778e7931d7e5, 0xedb6a2ede0c18990, 0x5d851559ecef2092, 0xbed6aa41,
+0xffc275c3d2771450, 0x2c38f7da4b04b181, 0x79e0c31073a6b420, 0x32471ca780084a2f, 0x2434b26f0e61d105, 0x4d7ae0d4fb731a25, 0xfe2ade9f2daf43b7, 0x8c2b76c90007c698, 0x4757799ddcbac13a, 0x22d1a57d8,
+0xd2db06b661650769, 0x48f0200bc88230f7, 0x845c4455760b7116, 0x9744c28926cec5fb, 0x5107af8e459d2e84, 0x133dddd30c0e8390, 0xa370aa2fc76d13d7, 0x93f20e94e3c475a4, 0x42840b0942f3b593, 0x1f39187e2,
+0xc8c02414ad6203fa, 0x2748044c145c3bcd, 0x4ef7be0f23298fc4, 0x6c244bdf774a271, 0x4a83fb815005cebd, 0xd029a830eb15d68a, 0xa111ba31d6c91f73, 0x4b29d186c5771275, 0x4450ae118b2765e2, 0x1864f769f,
+0xd6f89ea01075e17c, 0x8645f28fc67fa727, 0x4fb91e2ac3d89d10, 0x82473e8b237cda20, 0x72ffc4981a2907a, 0x36c6d1f3a0fa8789, 0xb8e3edfa7d9ebd68, 0x735e1ad4a1bbd4cb, 0x4dda0f9bf1ee9bfb, 0x42e27555,
+0x7ede1a69a7769b39, 0xf5ffda57d908b2c4, 0x208e9bf20beff14d, 0x58396cfd87f29d26, 0x6776fcb6ca0f641a, 0x3787103c8cebffc1, 0xb3cdba782a654409, 0xb025c3eae4050144, 0xca7119fc6a5b9f07, 0x6bca8ef,
+0x41b63a366c0b6adb, 0xeabdbec6b5473030, 0xd86f203f184a8187, 0xac6f8b1e7232c373, 0xb2f5bfe293e57818, 0x187734d4b8cc1d98, 0x2a880a0e839df201, 0x58dfa8c424f4c5b5, 0xd1bed9396f926120, 0xb9d26409,
+0xf3fe68b042dfe133, 0x1df29445f0f02059, 0x9bacddd12178dd54, 0xcfcd7baba0d75a4, 0x3f5427184afa25be, 0x3257d96e79e3c045, 0xa7260b17ce5b65bd, 0x5009f4ab5164dc5f, 0x5d131202119d3709, 0x1c067ad2f,
+0x775ecf767cfd6de2, 0x8c71795dcce46676, 0x454aa9af73cc6fd1, 0xb73b4f8810c3442e, 0x2576d4e4b7e70c5f, 0xe3d9bda17f509d60, 0x3608e081dda7a697, 0xa17ee26997b5a2f9, 0x6971505b10b2861b, 0x208d488af,
+0xf43460514ddb260d, 0x6bf134f0594256f9, 0x985dd3d0a2c9d9c, 0x1d43894882cbdd25, 0x98c1f47c57c47873, 0x3c0858943c5a92be, 0x6463845321d501b7, 0x7d471285ea747176, 0xb8fb262aa76844ef, 0x6517a9d1,
+0x704bec5fcfee8d49, 0x5ba5494c037fd4f6, 0x8425772346b8a81, 0xa09d976505788b33, 0xa06489a74cca02a5, 0x88cb9cc8a885a54, 0xff0ec12c8b701af5, 0xff5989386a48cb7a, 0xd227937e0ae311a1, 0x9853c70f,
+0x7a980666ec7a9f7b, 0x405232dc58296949, 0xbd7a504cbdb77d2f, 0xfe8c88a08f1c0ee2, 0x8fac7dd4e9fae063, 0xeb0ec870e071abdb, 0xfced0efbba8350b5, 0x7d1c253c952ceceb, 0xdeb635b3999573b2, 0x1aa4f7842,
+0x13d04fb5ec255a22, 0x7ddcc5d1e1e95ecc, 0xfeba0a129d4c9449, 0xfe45de5033142bba, 0x81b56ac52714923c, 0xd92e0b227274dbd1, 0x2803fd8d48415795, 0x2fe7b9d8347861f4, 0xf617a5c2621aa094, 0x4c555afa,
+0xf5707fd10d48d7ef, 0x47153728031833ea, 0x70931c8fd60817b9, 0xf41ea3c194ab20ac, 0xef61854e3b928e8e, 0x87004c9fd9af6710, 0xdbb0ccc8efd2468, 0x14a6195a846ed06c, 0x176757f6dfbed227, 0x1eae0d8ef,
+0x9bd4de11221bd5, 0x4f4f5610506a0ba8, 0x637a8771a2206372, 0x986f43c8abdca4f8, 0xdb1f22e0dbebde29, 0x5eae8bcf0718c73d, 0xa9c58ebd27b4c79e, 0xb8affa7138540536, 0xb9b3beb8bc44ffaa, 0x12360587f,
+0xea6308aade5327aa, 0xc7485af348dffa21, 0x5a96e5eec24522ee, 0x7241ab71004e3694, 0x5d5d58462071d64a, 0x90e93819df5fbe65, 0x780998284314136b, 0xae323e2961803325, 0x5ff8b2e887238ae6, 0xb944d1ed,
+0x9ad82574273b1aa9, 0x174e7b2514714650, 0xc33ab8d0333d10c2, 0xd6245ce8e79a4ada, 0x14dd08b8aefdd088, 0x84abe743b50b9e14, 0x863444b80ca9c388, 0x1d8340976688b2e7, 0x2aaa0c9fa68e9815, 0x55813241,
+0x266c12efc0d95e8e, 0x7ae86cadf5397455, 0x46314ff489641f36, 0xe79e10b6e858fae4, 0x52d6b92dd44fd5dd, 0xfe7a2a4ab9af7ab5, 0xfcb8a2ab0bf54df1, 0x18546e189a888718, 0x81e1b2156f6321d7, 0x16217c63c,
+0x536801e965b1adb6, 0xad514be221d13a63, 0x84f2503c5e0be04a, 0x1371b59e9d99b47f, 0xc857b3553d396e38, 0x3004f14862d1a61e, 0xf1baf72f13c2acd3, 0x878deff076831cb5, 0x44338a7f3b6ed498, 0x14782fd73,
+0x291ee0779dd6ac84, 0xd4b39d357e9cbe40, 0x348c41881c755325, 0x10b9e51df2d0510f, 0x65af264c577d7932, 0x460c560918e312d0, 0xac50be9d2c5c266c, 0x7b2f13269fec98dd, 0xce9c375fef32e4a9, 0x1f65c4561,
+0xf88aa9611202c6bb, 0x61f4f52f5a390bcf, 0xe2153de16b6460c5, 0x65162a4e17ac8c94, 0xdbbc3cb38d0cc02f, 0xaced637620c62f3a, 0x272c789812119bfc, 0x11991db28ac10646, 0xf18b74c6dfc320c8, 0x41550f08,
+0xb8aa0a41d354ca82, 0x145b21bb171ae26a, 0xfcb5942c8ad4d68f, 0x2007286c3945f04, 0xfa269b5bd4a285b0, 0x8671b469cb4f5587, 0x7064eb66bf094e9d, 0x96943178092c53aa, 0x291d9c2b518164b0, 0x51f0175e,
+0xcc7d05dc641888b4, 0x7f0f7211efdd0a9a, 0xdfd6e06c3c5e8a8f, 0x6e6fdd139423c649, 0x90183548059d9ea4, 0xaf075f1d0a84ade7, 0xadb5972c61002910, 0x79bfc44854036fcd, 0x7b511fbf294f0405, 0x24168b2f2,
+0x341d6b7be8c59494, 0x2d73e040134d314b, 0x728c7e6816ac4b68, 0xfa0647f37957b7eb, 0xe950d2280ef1cc59, 0xa8f8ea9a35394190, 0x1f8b1289e80cf011, 0xcb9eb2ac7950ca82, 0x16498d6e050f1efd, 0x1a6c4dfdc,
+0x9d4a386a11f3011a, 0xa7cf67b8f9f034e9, 0x646e9b7161d8b35e, 0xceed207add4a80ba, 0x8bb82822922a1e8c, 0xa563c1f3d42687f0, 0xb566fbbd6f8b3c56, 0x9e8c05067d0d5ce2, 0xed5207794173a263, 0x117bb327c,
+0xad1723dc13bbde41, 0xdee630b4387df14d, 0x9cdc230f313b899b, 0xfe5d8a4a44d098fe, 0x3002bcf2f4756fd, 0x9ff68b2f0f69c1a8, 0xdad107fd0bb1e269, 0x535972de34c41b3a, 0x5b8e734e4ecda533, 0x1519e6a5c,
+0x766233096d3f989a, 0xf59109ddb9f11bf, 0xd7923da17d0a1a7e, 0x25ba1f44bd4d6561, 0x9623f6d65f6b4f1f, 0x1598a8bfccba67bc, 0x35fb40e76ce773a4, 0x9e2aea3692041ecf, 0x9ef9f925e04bb8c1, 0x277f8b289,
+0x667142ad18faa919, 0xdab285048aa0ab9e, 0x230bf8e917dd0a8c, 0x6aa5d7f2c0419ba8, 0x37b024f646d3f987, 0x45721b267ef9535b, 0xbab09806b24222d2, 0x48ec4b741802e7be, 0xce99db910159dad8, 0x20fd73f75,
+0x9a35ba534c8cc43a, 0x74743022481e040c, 0x980b77e628c9258e, 0x6eb1e091c94dbc83, 0x35a94ea8551c195, 0x58dfb1988b30ce41, 0x1a3560e1ba06d5f9, 0x596347fb8516ee31, 0x7b9d7a3b99ec8130, 0xe68b672,
+0x39dca98af5645e20, 0xc57271bfa7d2810c, 0x4dbedf479023c385, 0xf729223cc3be79a7, 0xdd7f5b62885330e6, 0xb7d239b0358cf37f, 0xd9f5c4a85212f86f, 0xf0a508ac485a6272, 0x867a099dee1319cf, 0x2022eddf9,
+0xa20d8924ee6cf42e, 0xcbe8b3c43e89cb24, 0x2593c2dd0031f8d4, 0xf4da7d6b8c5a8538, 0x953da164bdc717b3, 0x49bbea7b0f82a710, 0x52657dd31a7a45de, 0x8e057d2fccc0d814, 0xd9bb469935978acf, 0x259314562,
+0xe10fd2bdfd59ecc9, 0x984bd9541088ded7, 0xa5e7617c1f3ad355, 0x37f15298592be, 0xb11f621911e5f565, 0xf3168dcc5aca1b0, 0x53cbfc80dd2a9461, 0xdfa74f0356c5c7f8, 0x2290e98da8da7efa, 0x3e082eda,
+0x54c9c3ffd621f5f3, 0xa8694864eea3b748, 0xaeaf840060c3098d, 0xb27ca82f249acfff, 0x58cf5e79f74f6b53, 0x7f33b81bbd14c711, 0xd25c7e0a68f16b63, 0x771521c1398aa92, 0x9109d12bd05618e2, 0xd5321cd5,
+0x3233975bebbe9ef7, 0x88e5db278669a7d9, 0x3c73dbfa0fffaee9, 0x1f0eb065ca3c3f59, 0x863678b72f298c74, 0x83edab0bda02f5bb, 0xb5bef22e31bdf3c9, 0x6f06f5ce1036e38a, 0xee00075be05f618d, 0x1a1eca3d,
+0xb3bfd8c918cf83a, 0x81eb8277c4097284, 0xb9bf1575926e16d4, 0xf8b160ccb6604bfb, 0x1001f7a406776332, 0xe385673014c0c379, 0x4143327cd73baa7a, 0x4679cd701532a9e9, 0xe792aab8868552f0, 0x1f792a7b7,
+0x6049f02a6a9e5ee6, 0x32b0c7321537f98f, 0xd84b6d7c3e696670, 0xce6452e0496c52ae, 0x7d2411c3ae5a54aa, 0x49cd8d269fd3ff66, 0xaacfe09dabe9d134, 0xfe0a40af15fe74a7, 0x631907b2f125e128, 0xb316655b,
+0xce6a36c9a1e61f1c, 0x728b290a37fa0d86, 0x975ec471334ed35, 0x1a9b3fd463dde0eb, 0xa0e9200685b884fc, 0xe6bad52b42d84136, 0x31a4b267f373b179, 0x4da70784018e9647, 0xa7797311891dd80, 0x7cc998ab,
+0x8bee6fc7bae479a8, 0x5a0dc027ac87a5aa, 0x5720576206b94588, 0x2a50d873b3722925, 0xd59e06853c01bcac, 0xf5b0d5635844d84b, 0xb989c4c8955e7a84, 0x44d468543e8fe32c, 0xfccbbae6c89b1760, 0xf7873c29,
+0xb9ea79eaa220bd77, 0x454d8fc4fa517132, 0xd4ccadcae86a14ec, 0x78a704a6cb7bca66, 0xae8e8f3c96035ea9, 0x9cecfa1479f0d1e3, 0x69cfb56b18a3b8d2, 0xaf5a5ffc1adcb4e3, 0x127f69fbed1fc797, 0x1f4773b94,
+0x50a8eacc545ca5db, 0x8668aaa0d4c38a49, 0x681ad22a0e96ee1e, 0x612e8a9630af3e5d, 0xa78bc8289fd39e40, 0x26fbd914242e02a5, 0x2a773ede6cf290b0, 0x1b7ad8e4b5cfa1fa, 0xec4fc112e20d61d8, 0x1dbea1d67,
+0x388729d75cc57f67, 0x78d9152f3e98c2ac, 0xf141950b3fec0ff4, 0xc802baf3285e52fb, 0x2e32809b1408ba9c, 0xa46bf667571a386a, 0x97583ccbdee05bfd, 0x94d7c556a2d4152c, 0xe7ec8694516ad407, 0x2521b4aab,
+0xee17a047f4ba008d, 0x75376c0ec078931, 0x8819c12c5f6a4c39, 0x27fd62973227fc82, 0xdc013d726edf9284, 0x9a06ae8a41075ee4, 0x33f6573df3d0c6d7, 0xe474c2037d1cbe10, 0x604d2016706cab0c, 0x139ee0e03,
+0xc6821cb83b7ac26c, 0x689018c9d8a246e4, 0x5b8660c2da19285c, 0x8bc77ab21ac87596, 0x41f687f1c81f0a8d, 0x3a992356ffaebee7, 0x518e788cd52eadcf, 0x9462bbc19ee58a57, 0x225cceb1f1c7f29e, 0x1dee88025,
+0x4d6536a6fc7436b, 0xc1e6536c1f506a68, 0xda25de61e4bd8217, 0x3cf3130c6bcd51f0, 0xd4a9f43e47b27de8, 0x719626145d3cd0ed, 0xe5d2480f1c3a62f4, 0x5e86f789358e11fe, 0x46c7723ee48b9398, 0x13275e317,
+0xda8e5841bae0077d, 0x71c7404f54bbd0dd, 0xc3f225402b381aa7, 0x91f1cb1549427eb2, 0x2a01d23f39ee971c, 0x42f41ac26f824c84, 0xd396f07217f76b67, 0xad10c68269076353, 0xaa421f2455246865, 0x1aad86a54,
+0x90035b41c9a6f2da, 0xcc38008b2cf84e7, 0x90b4ff211df9b922, 0xa40a4cc1acb3b190, 0x2dbee9f08ccacfda, 0x22742b7e4e78e85a, 0x84b5d391442c947e, 0x8d3b3e3493bb3bea, 0xad7243d24f89adc5, 0x1957bc0a6,
+0xafcb70fa8d65da8d, 0x54558a4f413bf122, 0xf72762a38dd55dfe, 0x4d81bd34209f37a9, 0x12d82a16133e65f1, 0xed8da5d14c0fbdb5, 0x144c0bf315d3454c, 0x28715a46ac39dd85, 0x14a838d49351307e, 0x30f840a3,
+0x281a975d6ba160d9, 0xabdd41237e2692b4, 0x3eb0fb83d1d00042, 0x5a5b08a90ae1b2b6, 0x251d281cd66ae41f, 0xf07012a1321718c7, 0xc8170bee08143aaf, 0x2cb42b1f370094ba, 0xae4b37b4dc4b6245, 0x348cbcb,
+0x2cd738b32a79fa78, 0xf453321dd4303c13, 0x2a82f0d52c774f8, 0xb4b8008d46f9dd5f, 0xe66d121c995a0d05, 0x2e0b6116415f02d9, 0x2f5884baf04d1362, 0x5dc7b92e9bf6b2d2, 0x8ff1b3000e056ccc, 0x19ad6ea80,
+0x2b8aed329980e9aa, 0x9c8a6cd2773bf2d1, 0x3348013df2b8b1a9, 0xe9037d8404f0deff, 0x45cdcfbba3e7817a, 0xbe992104e9eeb507, 0xb6406584d23148, 0x19a4861e786dff4, 0xa41be9379a40bd7a, 0xb2a1dc22,
+0x98070ff29f07fa19, 0xba2f3e1a188f1b0c, 0xe576d796c8f2e010, 0x47d01065a293d2f8, 0x9f8ca2247c0cc694, 0xd67cc516323816cd, 0x1a64c3841c7a3a8b, 0x5c1f3afd7c006e37, 0x70831b4f19e30802, 0xac7dd69c,
+0x9929135e145b5f92, 0x85356b68172d0f55, 0x2848cc7a6c930a9f, 0x4b4d7b6e69ad9c75, 0x12f3153140815649, 0x1f8d63fbd8f13a05, 0xe45f8bf52694c881, 0x2c3e5c0101dad73a, 0xb668d09dcd985cf5, 0xa4d10e4d,
+0x4f7361fd05b5bd01, 0x65e3bcfa8933a8f3, 0xa7d0570809424c47, 0xbbb9f1a5d5ded67f, 0xe121b475d4321edc, 0x58adc6c7a0fe3981, 0xa4bcb60bec566cf1, 0x2e9f5fa627bfd03b, 0xdc766029f2fbb812, 0x22e0dd9ae,
+0x1ca8766fc000ad3b, 0x5829634b7a9796cd, 0xdfca6086944d9c84, 0x69a22fcf189ec259, 0xccfdff26f6c650d9, 0x2a9bcb14f9be877a, 0xc283fd5b78497ca3, 0x96d5b4937c447708, 0xa766b114c646eb99, 0x1a5da4d23,
+0xf56389f1bd16affd, 0xa75e1f2c70c27c04, 0xd724d2d8d9cd4101, 0xa655a4dff6f08ce3, 0x442071d3698031cf, 0x4544f8ad6e324e26, 0x684791762213775f, 0x1da9dba1569e4cff, 0x42a2167c79ac511a, 0x1561da81b,
+0x87b0191587d7f1ac, 0xf616fcb59ce5b3ba, 0xb6b818858cb31aa7, 0x3c84d96cbfaf1260, 0x32e61f7665a837ad, 0xa6317aa3c033c6c4, 0x1b380073fd4c1154, 0xe01339e6954a6873, 0xf130e567ce813c93, 0xb29ea739,
+0xf6d785e62413f6c7, 0x4cd7da204bb12f88, 0xf2f5852ef04e24f0, 0x23c1198ffdf74098, 0x6a0c5c39d72d6086, 0x674d1dac215b8d29, 0x300035fcbe631423, 0xd3047626b5fc88d3, 0x73b20c6c49f43fd8, 0x3f8a5747,
+0x11b5e8509acf0265, 0x9bed77692ccf996, 0xda37fa7bd7021791, 0x5dd3f8e53f2832ec, 0x75e8c58a28ebfff1, 0xc0a256af7f289324, 0x94fe8f0539a54715, 0xe6da158b40aab1c5, 0x17f796e71c2882cc, 0x7a177902,
+0x1d7fda6367647a1b, 0xd2225923d125ea7d, 0x552932e3be027e68, 0xf79f85b57628251b, 0x6b5e97f71f7b2f10, 0x9400d8e236844734, 0xdc33a6cb3b214b97, 0x1f5500a91b7728ad, 0x6b1d94ac2584be78, 0x114d5e82d,
+0xdf44a92762c1f4d0, 0x47c33b4f0ad56f15, 0x85cc909f518fbc51, 0xe2208521f28fe4a5, 0xbd7eef77a775959e, 0xb93e5413e048f4a5, 0x24cd8ffdf940498b, 0xbe6f22b3e9b4e42b, 0x2f2482c2833634cc, 0xd691ad3b,
+0xee94bb0a01fcc13d, 0x2996e6291928256d, 0xe50444be4e0e639, 0x3af124357c87aaa6, 0x59e8785f7a229536, 0xc75fd2e6161dfdaf, 0xf24eda28e022132a, 0x8d886274d5db2675, 0x36c6752611ecd3d, 0x8981798e,
+0xea236efca012be1f, 0x2ea3b8da1e2cce70, 0x249a39c2776a75ee, 0x8d2bdcf50eaf8be5, 0x74576ddae2baf721, 0x7f2418137c0c0b33, 0xe068b3ca688f01b1, 0x4734bfcf517bdf49, 0x368127511ac10b9f, 0x744f3425,
+0xf5ae57aca59af8c8, 0x31b3f03a083c2bb3, 0x86573d934cc73925, 0xc2e158fa562d605e, 0x3cdec97157394513, 0xcb4a8507e3f0afe8, 0xcd9326dea972bc39, 0xd8fe495e2df36207, 0x7524eb635d399a5b, 0x1ef559450,
+0x485a1e036f89ca62, 0xe839dc0d6a4aff7a, 0x11025dd106b45e1, 0xd7ec443d07c1f371, 0xda427882343a847e, 0x3d5f938558939497, 0x72de78ecee63613, 0x9d33c960db7cbf5, 0xd6dc56d565dfa75f, 0x177e5f9db,
+0x234d59d97836a222, 0x59bcd07df2f42a11, 0x1e7b66c14983bcb2, 0xabe9a7a6d77bbe03, 0xb0fab454020437ae, 0x1c710d60c6b040c3, 0x68c025bb5a940c14, 0x2356c4fa0244ab8, 0x2e69da5f88e26973, 0x624ba6f,
+0x6746da2539c0c36, 0xc109ea0ee16bf7cd, 0x76c5f6627a0cb0a2, 0xcf6cf1b56b34d554, 0x9870e5dc7f7b7d6e, 0xca3b37be558b0466, 0xfe6341aa47af69ec, 0x326c96d4a1d8315a, 0x3e9b7d0228ab2efd, 0x22b37b2fa,
+0x6e1da8c3a2e613f2, 0x188dc61cbad73c5f, 0xb85dedd1bca351be, 0x933fc3d48ae48927, 0x9cce1800860a955a, 0x247b02e8bab3223c, 0xe9ae7c7d7f29eb78, 0x79968bd18ee6f6e3, 0x5aace77d1bd94c1, 0x2c3f3d7,
+0x102dbc45bdeaf107, 0x541e3791b0c98151, 0xdda359658a07fe91, 0x277753d57f0b62c1, 0xc9161b2ee0e8ba47, 0x5e3abfe6e2e7517d, 0x83597fa1741dc2aa, 0xf55a5cde34bb3e4b, 0xc8000ecd9de83614, 0xfcc15157,
+0xa5dc1cdca93469e, 0xc37c5ead62d2976e, 0xbf93d4e40445310c, 0x453b8e49b0f94c82, 0x55abb1560c3c9939, 0x63f2229dda6d169d, 0x7f84d07854e370c0, 0xe90ef01311648724, 0x720b1d516f1d597f, 0x2249a8789,
+0x3236c24ff612df3f, 0x3d01898826b59fdd, 0x258d4eba34f564c7, 0x5dce548c69b9d34e, 0x984767dcf13a9076, 0xe66122ca5bf83cbd, 0xebccb8dd30da6434, 0x5b3e6b1079d04112, 0x41b560f68f74a795, 0x20f2834d6,
+0xe7c0d8e3c70062de, 0x80bca7ed990831be, 0x5d1c5e8a6cd57fe3, 0xe16b4a10816b8a66, 0x3c2aa307981a8b6e, 0xe3816e40f60e455b, 0x126b658fad0dfd68, 0xfdbd30807f8f1cf0, 0x517f1804977cfe54, 0x18285a974,
+0xa770ad5bb4cb4920, 0x755b8cedea6772b2, 0x4f99e05540b0c64a, 0xfbfc6a9f1a89a484, 0xe2a8378f5177eba9, 0x4ad3b0587d02d02f, 0x5cbbf86aa29184ee, 0x15c6ac7ab32d18c, 0x1e1fd6fd638cf743, 0x311aa3dd,
+0xad1b82cde50cc49f, 0x6d7407329b979e48, 0x7bc434f6ca2d9c15, 0xaeb278debbf0d522, 0xac462e0d43880ca4, 0x24f4dc5c70ec312b, 0x2377d6ee2f309eaa, 0xace97b5e9d4478e, 0xb11dcdb830e0a2f4, 0x991230d9,
+0xd5ed688a6b429d29, 0x2fbc432f40521812, 0x7a59015755497d95, 0xff112f50a1a7f665, 0xda7494a9a4f8fc1b, 0x29df8f8e856362ce, 0x6f34982a95d5e91f, 0xa60a1747cc9bf1ee, 0xe20c7a9ecd18cb9a, 0x17c84c0fe,
+0x59387277533e794a, 0xad6e7c8e717b4d7c, 0x3f1c5c4cbc625c3d, 0xfc3716b041dd92e4, 0x2fd7451ed7d38064, 0xe548ccb22c0eb8b5, 0x806005b42a241c06, 0xd9308d26cb3d9c90, 0xa940d56d6748deae, 0x5702a689,
+0x8fe88742d36f121d, 0xfe66a0ecfe9d3963, 0xfc09aa48016ea1e, 0x300b1556a8cd08, 0x2432be8ddc162f7, 0xdda446299a9dea7b, 0xe9f0cb128938dd88, 0xb95c7014c59053bc, 0x8f8640be2b8c26eb, 0x268f51e19,
+0x82d6ad392048efcb, 0xdc79cff8c7d425be, 0x4e3d564ca319a075, 0xa417576550cd6fd2, 0x38dc92d051b65bce, 0x1b37ff03c1dda2a4, 0x26ce24510bfcbccc, 0xb6a0c75ab6b6ece9, 0xcbf170d1b9abbf31, 0x3919e201,
+0xf2bfb2b1aed8fe00, 0x5ed3e22bb2a8b3b8, 0xaf228dc0d9cc2f20, 0x16701d5dea8f5512, 0x68e086b40f77852e, 0x42773da5694f2cd7, 0x8f07e9c623b76e1e, 0xcdf40f52f21de03f, 0x46c0194353a31c81, 0x1a1edd51d,
+0x8cab540b01bacb7a, 0x9da7354ac5bfb648, 0x939bebc497a6861c, 0x670197e8d6132faf, 0x89882ccc101e6859, 0xb670860d09cd6368, 0x8de4d295ee70f67e, 0xd512f881c41d32c5, 0x1cfddaec77a23440, 0x90e1d867,
+0x1776ee5e6cf8259b, 0x33ed6edbf72b2746, 0x5e2b787718595327, 0x1f1cc40a9f5cb218, 0x56235dfaf0503254, 0x2795fa402c136e31, 0xb41227d8c2479b9f, 0x4dd2aa375649be10, 0x94f12e1f20fcaba, 0x81eac252,
+0xc65b73eafbcebba9, 0x3fa4b6e5ccc1e334, 0xad81ca286a4095d, 0xe4d37dbe21d8ec1f, 0x52f92b147454e6a, 0xc2a13f20f2ccdb97, 0x64ae6f15f2edb70d, 0xc3249f168cf8bf95, 0x57f8b5ee3a517b5a, 0x12628e934,
+0xbf1dee0dec9d7f69, 0x8529d17e37d7674b, 0xc44745bdf04d32d8, 0xad1cb8f1eb28d6df, 0xd96c997d56091303, 0x6e5ef6f579c16884, 0xf84e0786cafe0cee, 0x80185090cf0bf741, 0x6c1173fc036b1471, 0x884e6409,
+0xf997943ced2e1be3, 0xc46d549d9886d89e, 0x3cd6d897c2a1da71, 0x536573b7df57b11a, 0xf8d23166645fcca7, 0x634fb406a5ca4c7b, 0x57d5a7fac0f9e3b8, 0x8e01a5e9ccc0e421, 0xcc00d39d3dd24b00, 0x49b3a409,
+0xee34d17fa192af2e, 0x71d6017c1a891d51, 0x6318bb7d0bd4386c, 0x726b945bebcc6260, 0xb6c609eb90cab198, 0xb15c71ac3ff240d7, 0x7aa14f83f623101a, 0xe30b760ee8560485, 0x13577db30a3df418, 0x12e394641,
+0x5f8e8dd735d82af5, 0xe4574b26a7186a58, 0xf196a5ad2ada77b7, 0xf0b2817da1ef28eb, 0xdea55f49fe22aaff, 0x591f736e168b478c, 0xa633af954dfb3a86, 0xc705abea37178ffa, 0x928f9e6888771d03, 0xc17097ba,
+0x28f10ee549f76207, 0xd733309d93e6c34d, 0x575376573f218ddb, 0x658684f7a74542b2, 0x519ded5f2bb94244, 0x22e70a3ee0051499, 0x6457529940a4ab70, 0xa35ace98d75191fa, 0x29f168afddb65988, 0xbd49af4b,
+0xff7c2553111c5987, 0x1e8f70b840ecb86c, 0x4ae35296cf2037e6, 0xe34cc4488bd4b24d, 0xd212d154b4eae84e, 0x867b27bc715b699, 0x2e4c2c502f55b64a, 0x19d0ae50e28caa9d, 0x558606fabbc94603, 0x1a6dab3cd,
+0x9ddf2836ff62f2e1, 0xbc137fec0e5b3862, 0x6eee9bc9a6c17904, 0x557f1c4552ee075c, 0x325fbfd782ba73bc, 0xfb983bc40254b2d7, 0x8f0dbd069ca60fd, 0x5c3133044b2b87f5, 0x2ca5fdfeb6f87, 0x3e35d158,
+0xb9b9b30bcb331906, 0x2feed1aca19280ae, 0x58d256a3b76fab3f, 0x7ff7e5c28f110c4e, 0xe77d80e7e7553188, 0x450c0bd60b49b4a7, 0xe150df5b720d1da4, 0x50302fe1cbee9569, 0x74cecd0ec65b1345, 0x1d3856b8e,
+0x3e8e3defbb9f988a, 0x9662b76ae9afded5, 0xf31838b3714235ab, 0xe2b9f0f139e4c4fc, 0x34ac54f16002392c, 0x2b74e0b00257f76e, 0x18d761e100eb9b18, 0x525fece23c741b79, 0xe99ca225bbe1564, 0x8d8b2673,
+0xcff7f3b25f6b71a9, 0xc4cfe441901d15ac, 0xecc4baac8814acb6, 0x2f2fa72bfb00de94, 0xf54d0a3043603ca3, 0xed58470b34e86782, 0x7753256fe6a95235, 0x9e71dfa8f737b06d, 0x3033280b64c3826e, 0x169c4045b,
+0x81d5c16188279b7, 0x382caedb5b7cae69, 0xfd1f046f0f092299, 0x519080861d7e0b9d, 0x7d41ad31103f4d9c, 0x1b2389729b83c118, 0x933875f22cb6d3d7, 0x3e244d864d57fdf6, 0x8860bee8224affdb, 0x9c2617a0,
+0x604ad5524277fb17, 0x97f6cb3c221c1ae4, 0x1957b9b25e6e1d7, 0xf93bc1ca4763a259, 0x7bbd92c7c709a29d, 0xaa4322266102d433, 0x121005bedcaa709f, 0xba97fcd16cce849e, 0xb3c1200eaece7460, 0xf7611c2d,
+0xef43ef65a4a782f6, 0xe53e04b8c06099f0, 0x6a1d67471ed23084, 0x57606e40cedc31ef, 0x9f2ebfa84e67a65e, 0x5d8ded3a3ac8e88c, 0x9a5f5ccaa65b8980, 0xb8905e33ba6ca537, 0x16d68a011e522a2a, 0x268d52e93,
+0x47c384797996a951, 0xa782b92cfd95611f, 0xe53a4a8f924d5377, 0x935acd99079cbe65, 0xa8e7f6145adf83b8, 0x828400cdde3bac83, 0xdda249c2369abc5f, 0x3ad87ec23f774917, 0xca0a69d48732f89e, 0x18f82e362,
+0xc782aa6d11a25a30, 0x251b42bb859da94d, 0x4c24cd65f351cb68, 0x516865a15318c670, 0x2bc764a08600e49a, 0xe26630e54ce07ad4, 0x57698e1bb4df65a1, 0x41989312f776c464, 0xa8b867769164d0bb, 0x1be571650,
+0x34bc4b65b30ceff0, 0x832511dff36621d, 0x43e29bb3571257a9, 0x5069301d11ad8cad, 0xa1afb544eb779a49, 0x9cce30469b85dad9, 0x5a39f6644edaa893, 0x698f3d37d4799f88, 0x56ef98606c327a72, 0x12f49e0a9,
+0x9576c9f223d706fc, 0xb24adc1a50de2359, 0xe6d5e52f1ee6f068, 0x285f7e7d443e7967, 0x83b43011d13b2cba, 0xd00705e125a6c311, 0x6b084a06b5b710d6, 0x6e70a5a0e34e0176, 0xb946f04ccee566ba, 0x253bbbc18,
+0x3a880cafcab4199a, 0x57ecfb8dffadda45, 0x2ed5e0e90770c2d4, 0x4ec4f7c141bf0acc, 0xac0b47a48969278b, 0x8f9331fb036c2313, 0xd9830046204822e9, 0x17a23eacb83deb16, 0xd213105070ab69ed, 0x242540ae9,
+0x87ca50687f70bde4, 0xebbd6d3b7e375b7b, 0xde2e296cfb387a19, 0xaaffd62837ca2f9c, 0x63dbc38e4905c547, 0x614e2b3be0764db8, 0xb1f98e045a4de670, 0x5c419eed746497e1, 0x97df5922560c8afe, 0xa41befd4,
+0x8c7bfc3c8f3f26ea, 0xf8a615162d30811e, 0xe2e48565c8a7232e, 0x36c76ead5b507383, 0x52b0019c83363f36, 0x9322d53fbf14aab1, 0x314049c50d00f364, 0xe75278f4d3b75be8, 0x6b90a5a7fa7194d1, 0x1d0dea89e,
+0x49eaa00a70b5b124, 0x2725a3a21664e556, 0x947b8171e5b6719b, 0xcdef1eb8359c7d5d, 0xca8d80517ddaaac7, 0xb2eb2198c9f4c33b, 0x4774f6af9cf4af0f, 0x4d4ec949997bbb50, 0xc92b20e37c4bc0a4, 0x217b9b597,
+0xf13834e7d05bf5d, 0x2aecbf0560012e2e, 0xa95174c79591862b, 0xe62ab33c47bbe9c9, 0x3178ad1681c3932c, 0x44103c6167012af6, 0xabf82ec9b03fba59, 0x6bd7738450771d62, 0x68cf2a42218e7326, 0x16df368b3,
+0x93b257421ea61cb1, 0x1090355f49428302, 0x4fe0ec793e6db108, 0x4663ecb9a6dc51ed, 0x530904078a6bc11f, 0x45b6b545e174d115, 0xf4791a8c259beaf9, 0x75b8c178c2391ab4, 0x785fdd0bb76a5c9c, 0x19389e70a,
+0x427737f2fd761a7, 0x1c07d7fd04634e71, 0xa2b9a6847bf38363, 0xe5fb7061a1d62027, 0x15c07d854bf00e99, 0x7abdcba05770e9c9, 0x89fb4664e9c40166, 0x4b3e516097cce5da, 0x974a9cb4a0a6e0f0, 0x1132a723e,
+0xcda97fb1b8f0f5af, 0xee63ce3ed630bd46, 0x7ca00dee10d188a2, 0xfdaaad2e8954a6f6, 0x672b54b2b48d28da, 0x44ec1690c84d18c1, 0x8297e1f3d298a4a8, 0x135f790f09eba31e, 0xbbd499090431f23c, 0x75acd23c,
+0xc21f72d2b11c5e23, 0xc39b99bc6ebf6fde, 0xab42f781fcc76f4e, 0xb431006de8f94071, 0x888a6f1bae72788c, 0xe539d42a4d542ca6, 0x270b92eb75cfb5b8, 0x13c74b94bbe57d2, 0x6bb7bd0a6f34b941, 0x25a51a30d,
+0x34be01c4556cbc94, 0xc8e7f999bb9a6b, 0xddc3f4e58e610705, 0xa97737b30a145388, 0x4155eb94679f05ea, 0xf2756f5189875233, 0xfa4742ea3de6e97a, 0xbe316c113964a38e, 0x967d02a6e954522, 0x6b32edd5,
+0xe5b07c23db06004, 0x82fb250b21fd885d, 0x4c5a8f02714e6807, 0x10ddba34668363dc, 0x24d8d4a658030434, 0xee67ceb84ae87ad, 0x6384511fee11ba19, 0x576055485c3d856e, 0x60bfef0f43da9ed6, 0x21a0fd61c,
+0x96cf1f6f604fcf56, 0x2c3480c86fce6be7, 0x5179868a8af3a10f, 0x9401d6aa1b2dbf88, 0x9e169d46b5a2cd8a, 0x6f5e5f10a23d06f4, 0xe6af3cacac7d86c1, 0xb5d5324f645d0947, 0xdbaade3206cb9128, 0xddaea075,
+0xac20d52afae6825a, 0x4fe2a45d86a63c04, 0x32e4b58daea7b7df, 0xdbbd964d356edc43, 0x2fe166a007c5b9c0, 0xced48e4a84fbf30, 0xbf83b57320375f2c, 0xb2d1a5678401a002, 0x1587dd1ccf6a86b1, 0x25bd149c2,
+0xe628051a66f0480c, 0x9ed3a2b30b642622, 0xc24800d34b2159d8, 0xe2bbcd3974acfb3b, 0x601ca28eb0054637, 0x6002e53a9764269d, 0x9dd13c1e8210475, 0xcd1c4c1bc9bd6762, 0xb83e46d8120a477e, 0x27954dc99,
+0x6754e1b599efad97, 0xd1b4efc6d6876edb, 0x4460cd17d2d6237d, 0xffb756a385b0802, 0x85581d926d7adf14, 0xac645b977935985f, 0xc4e8f580fe5754fb, 0xa19653fb19f6fc4, 0x67a13a818b48993f, 0xb4028f25,
+0x61c6167302090ecd, 0x9c816276b58e8b95, 0xd2aa12f33b6b142e, 0xcd6091709b474b59, 0xcd116c639cd4aa29, 0x2383fd9c9da7f4bf, 0xa8410c5e31f7dc8c, 0xf84589f9ecf3bfff, 0x60496f06a6cfb026, 0x15ea983da,
+0xc7caffe74ceac8a3, 0x57e24e64930927ac, 0xb09b9ca89ce8f028, 0x36a062392fb8603, 0x14c2ba33fc8e3476, 0x20542150e2016de2, 0xef0a9488698aff4b, 0xc84dc671568e0c1f, 0xd17786ecf532e2ec, 0x8e4c2e70,
+0xe36b25910b64ca34, 0xc3043e4e31f5cb11, 0x971186843b8ada83, 0xa1c45b2713bef0a1, 0x388956a111cec119, 0xd0f380656a054f8b, 0x659a105f71e76510, 0xe9141f0ef8daa6b3, 0xfcda0e6a737cfe7e, 0x25f6bea99,
+0xfc032f800469f8ba, 0xc0d0d0698585d21e, 0x51622c99c781a576, 0xaff0d967e7f2bc7b, 0xddd2f872f0cb5d09, 0x5acbe26fa1caa650, 0xab33541464ddbd00, 0xd844e186b392da09, 0x5be41e2d48181caf, 0x622a570b,
+0xd88e7b4379187f34, 0x4e9ab97a08a3c67a, 0xff6d3b2c928205b4, 0xa919345841e931c0, 0x196c6203d9466e5f, 0x2098f9b6921cd6a2, 0x28568cce590bf903, 0xd9e31281979f6d3, 0x4700a8233414d754, 0x178d401d0,
+0x9fe5d4b61d46a940, 0x6f8f7f821a0ff243, 0x1567bc366dbe843c, 0x420140307f689c3f, 0x31b88265a7bb1686, 0x2a1c0751bbf5f048, 0xb1b13841e5ad93cb, 0x22c5d57c1ed165c6, 0x428fbbda46bfd73d, 0x38f63a94,
+0xdd033932515f1c37, 0xafa747b0fdcaa855, 0x370e7b5e63c0847c, 0x9b05e107df76a3a0, 0xa06554b2e00520ee, 0x734c6c632c392e91, 0x41090d2095d2a293, 0xe64089f6455ad23a, 0xdef40320ff6a6345, 0x171d99ea2,
+0xa7a0541bcd297792, 0x2d4fb22377861e63, 0xbe7380d1d8d76654, 0xbf3f245f4e0a2b43, 0x92ee816c2245536a, 0x9780db8e32fdad69, 0x7128e7c152597b1f, 0x58a989e8b07dd5c4, 0x139468992d6b5551, 0x1095a05af,
+0xc8fb9e3c9a223d89, 0xea331867ee8e3d20, 0x37cd810beb77ed49, 0x8a7af2e229dc3373, 0x8d42f0e0b12e72dd, 0xccfbef6e04ea1145, 0x801b474aa2164b5, 0xd0a2022829454862, 0x879e5f28bf23a6d6, 0xd2b9906e,
+0xc713cb26a1d67d05, 0x38190c785d03fc36, 0xabbe334d4160bc69, 0xa8a5e521f7afd565, 0xd65ea3ff5e979ba0, 0x51aa9c3ada55922e, 0x73f22f36f3dbeee5, 0x8510307d61f46114, 0xc7fafefb8a948112, 0x30fac680,
+0x1d1377feec2cb1bc, 0xa5c095574d0ec0cf, 0x4d5d148c6dc72005, 0x5013d437accbcb74, 0xc654a8e142e6c65d, 0xf99567cd4c8cdbd1, 0x1dbdaad17c4fee85, 0x8f8d7db482344a50, 0x98a8bf4bf24e5a27, 0xa7b55658,
+0xa17d05fc43541fa7, 0x92cfb25d38d7512a, 0xdb59a69bf6cdbfce, 0xd6430dc0ef318159, 0x993ab04358454ad5, 0xc224efc9cf45ce6d, 0x467d18ed318edc22, 0x7fa75695cca580af, 0xc585140cef9c66c9, 0x93803ce,
+0xee6c72e65ab8961a, 0x6f0caac0538b1d50, 0x4810700f50295d97, 0xf909671cdf9d3bfc, 0x94a62c520ee96514, 0x146a6d06e45ac164, 0x53a29fe2cb39c8d7, 0xb33a50a0e337428, 0xa69ab40c8377e342, 0x3cdfc8b4,
+0xe39746177c034707, 0xad6035cd038cf643, 0x6c80428ddb08c2c4, 0x969902a60089c630, 0xe2b63f2298cbf7dc, 0xb6d74192401cfaf, 0x61fef2527fb3c77e, 0x1dc9a76900030bd7, 0x587bbe3141eab33b, 0x17b086fdf,
+0x2afa52279842172a, 0x98128c50d77934d4, 0xfe371b3ed419ceb4, 0xa13789fcd82d44c1, 0x832eb0e05502e782, 0xdf333386888c52c1, 0x2c4096fa6ac1cce4, 0x70d5c6ab744a1440, 0xa1979d11edee02a8, 0x15c07e027,
+0x8963987b1406687f, 0xdda76a50a6c2ba88, 0xeef3cc067a4c7fcd, 0x6618efd569468a4f, 0x2e6b5bb34bf545e, 0x1e9e4f11f90d99ab, 0x82b1fd79ae982e24, 0x6623dfd9a345ca5f, 0x1d5f5fcb6978f1c1, 0x181708578,
+0xf3c374bcf2268f71, 0xf3f7663696afdcb7, 0x484d10e1cf0a82da, 0x19369f149167ec9d, 0x28766ce5d54b4e1, 0x49926778e002bd2, 0x3b98e17498fedd27, 0x262c4b7e282cd48e, 0x23ce74e6d3ea38e2, 0x3512d2fe,
+0x53d86428135acdbd, 0xeba59903a26ce91b, 0xc46be035d9f1c30d, 0xb8f46e337ebff2c3, 0x78c48c6f04894b2b, 0x532cd3c492483bf1, 0x57a452a7e1dbc35d, 0x37cd6dacc1914c1f, 0x30b9572262a5b253, 0x13bd670cf,
+0x660870c0bf1b3614, 0xe6c256076119ea5c, 0x2edb695f4d9e10c6, 0xad41d3b59eff8946, 0xd1e34262d4d0ad2d, 0x4fed04e6bdc7f88b, 0x61b85050c7c0917b, 0x6e89b89c7943a794, 0x83a329a1a3ddc76a, 0xe173ba8c,
+0xb636dd741d974830, 0x9ceafdbebc88ee07, 0x9d7938bc224d698, 0xe5fa2601c5b8a02c, 0xc1d434f2e42288a, 0xf5ed5a29746f18af, 0xe02652a1bcb98a89, 0xb848c1b1a5bab98c, 0xe381d75523e31d01, 0xca1de6d9,
+0xe8b8363f5f62e32a, 0xf96da51a52a09e44, 0x3a2389e7a1aea89d, 0x5a8f8bd7c710d580, 0xa06233f7c89602e8, 0xdfc971fd37fbd85, 0xc7a0d6ddafa0c2fe, 0xf6d4a67b9541b63d, 0xf9104f74fdacd1c6, 0x184508a13,
+0x74ef5b8e5f592876, 0x99381689fd9805d5, 0xe16474937bad3efc, 0x762120b8c59a85c0, 0x7a2e06657d296c6b, 0x9b34a8915a435376, 0xd7fb3d6a15fedbdf, 0xab7564a99d609acf, 0xca7c0e1552cd512d, 0x8c8c9174,
+0x545bd0a60f118d3c, 0x24e95dab10b33394, 0x71bcb5dcc2f9d64a, 0x1fb5227c23479b92, 0x4708f28c95e0980b, 0xf290ac16ed3d0b70, 0xee7b1d0857a86bd7, 0x6d017abcf5557ae4, 0x1ea14c420d15a2be, 0x1089da3c1,
+0x788fd6c5998c6513, 0x3ba02ea7c929b2ce, 0x6485c1d6fa9a2e75, 0xb90e2c27ed4c24, 0xe3b6f2a8201d7ae3, 0x567a6a427627f2b3, 0x1f122ab689f3b6ba, 0x49d814890bf869f9, 0xe39e62a588a79d32, 0x197dc0aba,
+0xdc16ccf6f82419d0, 0x692b3163fdad1fd0, 0x2ce3427e4f6b6d36, 0x8fa92f56ceb5591c, 0xca1661e62021516a, 0x2047f4e0b082f511, 0xed0779255bb06c4c, 0xa2256c656453a1ea, 0x34b445e78cf8ec64, 0x2400fdc7e,
+0x14d76e7c05547443, 0xbca9dd7b74f22dee, 0xce31958427be6fd0, 0x54529b6383705a5a, 0xcdf69db65955635, 0x9e5881065d14ced, 0xb6101cff3476a087, 0x9557e65516c0c189, 0x57d8a2d6130c001e, 0x9105ab7e,
+0x128e56ffeb47bbc7, 0xd73f76c3cf3604e, 0x4de0242e6ea9ac81, 0xb0f26d16d896db2c, 0xc2119ad929c9b178, 0xcde1c294342e8fd, 0xe78584b05e9fbdb8, 0x4280ef3e7ea39413, 0x8856d15f6916e4f, 0x850fc707,
+0x71730104c8bf51e4, 0xeb63393984fa1341, 0xbbed031f2d699b87, 0x2ee8a7471a9400ca, 0x77517ba0c019b76d, 0xc87f09b229c81b80, 0xa262a033653163a9, 0xe247df26b96efdf9, 0xdd4ca55da1959356, 0x17500e132,
+0x446500a62004b90d, 0xd16019fedf1db08b, 0xa924353afb6e06ee, 0x5a109c24236dc102, 0x829ec66188ebdab6, 0x3b5961692742727b, 0xbb53381e90dd9b24, 0xa7626eeee4a3d486, 0xb2fd0c520d97db83, 0x266ab5170,
+0x4348ee556cc276e, 0xd5f6442f1d42128c, 0xfc1b21b6450c830e, 0x1858ddfa931b0adc, 0x8d9e3281c4c8d0fa, 0xcf666ba37698fe3a, 0xfcdd8fb8745f0fb0, 0xf375abf996c9660c, 0xd69cdb3cabfa125e, 0x248c4b7e9,
+0x777db3581b943997, 0x6b1fa28b1cb2a1b6, 0x86131c331ad71a8b, 0x1bb5d56f0b45044d, 0xe7c83ee1681c8a3d, 0xa2ac6720415981a3, 0xcf0dd44d30dc2c3c, 0x9fa3258b4f38f700, 0x777a32920d35c925, 0x24ed648d8,
+0x9b4f56a7b965a62d, 0x449638d8cdc4af, 0x766eb5e8bdb0e9f5, 0xedc5dc2f04e0d7fa, 0x4bdc381e98525f5a, 0x3f943edad9e9d250, 0x197a281ded31cea3, 0xa028c2fbaf8abace, 0xdea788bb994b7cf6, 0xd26efe2c,
+0xad1859d7f68e1ef2, 0xede1747cb9c09c44, 0x58e3091096593ed4, 0x5f7d7d5f29302316, 0xcceabaa98061a3fb, 0xf6c2fa9538acbf7f, 0x6f207615fe82f36a, 0x839cb25ad1ab888f, 0xd90c72f19b91be4e, 0xd5c7856a,
+0x1aeb2d8c5c5302b3, 0xc2bf64921c4c0f1d, 0x56caea3ca61bb935, 0x28149c90245a3809, 0x3710c5ddfdfa178b, 0x5414bcfd76fd4ab2, 0x14228b7285ed338c, 0x284b28de07029222, 0xe409778a6af17a9d, 0x449c030a,
+0x9daa973d8ee0cb72, 0xe39bdf435b3a08ab, 0x52356f67f4697c24, 0xadebcc55c58e633e, 0x7c9200f7b3b84a05, 0x7e23167dbe6e662e, 0xe3e078144cc2e0cf, 0x963053cb27bf8dbb, 0x69028a7697f18918, 0x21e6f0410,
+0x2bc6af8f450476b4, 0xd299b90c591a16d6, 0xd64e67147211f0ad, 0x14a3bb2b505dfb26, 0x21d60674c3ca58e8, 0xb0d5fa97988b01e3, 0x42477a7ca19c6fd3, 0xfb6b07f55441ea72, 0x3a335f48f292bce8, 0x122ed126a,
+0xf277b33221e7ad68, 0x81f96901297fa8ae, 0x2026d7c839ed8384, 0xeee9fb660f56e9f, 0x39c4b549530176d9, 0x4326e1346f3d22a7, 0xa77ab987f212f310, 0x4949820bf0c99029, 0xf8f2f9bb0e8a1826, 0x8c6d0f79,
+0xd5b0d691ca9ef59c, 0x62ca5c99d069680a, 0xa49ffed73efb940c, 0xb0fba6df0e2664c, 0x9271e68ee221c4a9, 0x2f5ae0108f3596f5, 0x88994936141e33c1, 0x2e4bd2cbcb008ee8, 0x9075bc2d34eb1352, 0xc00dacf4,
+0x746a1a312d113f31, 0x5c324a8c63e3c3d5, 0x213327e76d6b5112, 0xce30d4e4bf3e4650, 0x8477578857eb5d6f, 0xa7fcb2c48e8ee682, 0x7683aef5fce2209a, 0xc21594c94f83f36a, 0x1d40af95c5041a4, 0x27abd68f7,
+0x4b9a8cde6538cd8a, 0x8cfd8ad9ca98097b, 0xe6eb5b49c0b94c3e, 0x868e15b01b51c424, 0xcead3899108214bc, 0xc1bd272c665cf777, 0x70d09ac1ca671d8a, 0x220921b844dc91bf, 0x444a6a6dbd14b42f, 0x26d588453,
+0x5c0dcd3b6aa57a0, 0x4eb3c9571e0d1ba7, 0x4a2cede2b9fa85de, 0x6c3e2a2442626c86, 0x955df92f19ffb4fb, 0xacffbe3f688aa542, 0xed8ee13e04b7b99a, 0x9819801a98855e62, 0xad6327ea535a446f, 0x82f8d86e,
+0x625983c6f8ac099e, 0x14487fca9ae5609d, 0x38d459fdb7c25ca6, 0xee74d912e68b0b01, 0xefba7d7c6fa9ce8a, 0xe327d8ed9b93b513, 0x2b1bfd76c44d989d, 0x2efb28cb9daae1c9, 0xb3538a5a8de14c66, 0x1df16b735,
+0x63f9b1d4c958ad4e, 0x7fb066cb20ee5c96, 0x8179c553b1b1ed7e, 0xe1d5964cf48616f8, 0xf834bb4bda6366eb, 0xd746b75840859175, 0x8ba5af85e7108244, 0x82d235f3b71bd018, 0x86e1ee564d455844, 0x15500889d,
+0xe29d360885f00868, 0x1bb7332de477b1ea, 0x6aef9a27967057ae, 0x69ae8c4909ac7d75, 0x265e9d511c76950d, 0x9e9106cf99541180, 0x2eeb87d9e8d3da87, 0x272993eea66bf7c2, 0x128e4b6b233205bd, 0x18b2fc23c,
+0x2c68f8952d47df83, 0xf00d63b95ca8a74c, 0x9ae1dc5bb18a885a, 0x14d74ca170d6a34c, 0xf3325ddc37b7f498, 0x5cfe4a8a87988d80, 0x33ad784a16432b71, 0xe5bbfeed969207b, 0xc1c6c2fcba0a17b2, 0x35071cac,
+0xab7046e0334eb197, 0x15f6db19ef492dec, 0x1fc913f5bd78769d, 0x6516baba37f29add, 0x5d94312419b71e15, 0x5ef371a118ddf23c, 0x44da48f5a58166f6, 0x5ca780d7ec398ce4, 0x9a1ad690fde69542, 0x1fcba1e69,
+0x5dff7abb668334af, 0x1769fb0bf3b5dc0e, 0xfbd2d8388cbd2801, 0xf380ca3c0b1be8fc, 0xde72d5a5a70cad11, 0x23dfc096af6d662a, 0x76057faa1e630c4f, 0x58778862d9b57fc5, 0xfc1811faabe1762f, 0xed82c0d1,
+0xf3518216e7ebd07b, 0xf51085fcdf8ac8e3, 0xbdfa1008594152d6, 0x38069fcbdecc8bc8, 0x144d30bf6cc75a0f, 0xb4f7a95ed45fdb5f, 0xd6896d035e6c30e5, 0x303c3d7d838627eb, 0x67c8f899a40dda15, 0x27dbf4fe,
+0x3bedf9bceaadffda, 0x98fa8950ab497988, 0x225d05fd16ff48f5, 0xbee12387898ef3, 0xfb4bb68a5d5364c2, 0x3b5e1e28861355a7, 0xa6a9c9eac363b4da, 0xc1959075ea2f1e35, 0x3cc93dff6fb563db, 0xd975ed07,
+0xa2e420dbc85ce9f8, 0xf9e80257869b9918, 0x2a83cbd97fdd2585, 0xc8f691c0f26c698f, 0x8641a45cddab60c0, 0xa9852927da8563cd, 0x4ffb6cb5de522e30, 0x58774cbccda10c56, 0x1209a81857290f88, 0x2775ef942,
+0x990a206d412d0890, 0x6bf3283df2c12230, 0x1f6a010606555951, 0x2e3e4b21915f7c47, 0xc2d97b97db927bd, 0x5bea733e3ba65709, 0x5b776d05aae993ab, 0x1f39fc3053be5ac9, 0x6cd7565372d4654b, 0x5acff472,
+0xf088d2ac448645e3, 0xf01e6117c3d9df28, 0xb7fff33ed6123ac6, 0x56ebdb99489674f4, 0x1402bfad912f9325, 0x9743fac13c57ead, 0xedebcd07d66f20ed, 0x23aa01371b8fed5d, 0x4260a29f4c178b87, 0x1b5f12e3a,
+0xa30af4f70b954d35, 0x7adb3ee8b400a85c, 0x9b84e15ef70f669a, 0xb7e99e5108a030ab, 0x352d87c0a2df797d, 0x84f8c1b0357fade0, 0x92cfb6ecf2c6496c, 0xe152d229390b75ca, 0xe3b79eac4943ce99, 0x1b4721af6,
+0x2973dba50772e546, 0x59f9218ed96df149, 0x2d9926449354855d, 0xebb5f4a57cb4b920, 0x1949edd363123108, 0x888e0961ada99b83, 0xf2967e00755f1917, 0xf07a3b993d7c3739, 0x880d0281bda395f1, 0x911ca4da,
+0x7e0d360496289808, 0xa96b45d14a769cc1, 0xc1a1788d043b1470, 0x53f229e3b1e263e0, 0xa629aa505f405b50, 0x51fa75cc3358a5a4, 0x251159ca855a5347, 0x47b512bff317c499, 0xfe85e34a800a9cd5, 0x75ee03be,
+0x5bb0122da8158ea7, 0x490597ad19037ee3, 0x36b6294e63999303, 0x8b47475da6a098a2, 0x8d70d36d0561ddab, 0x5d819fdb3838060e, 0xcc4ac47c5a1a7b8a, 0x1c5d533ba53489d1, 0x3a57e11fc2db3599, 0x9dc2ac4b,
+0x82bdd2e561f60531, 0x43b630ae626745f8, 0xe75d101931f7f2e4, 0x2df733335c89413f, 0x1d381294f4651beb, 0x10cfd783ebf2eacd, 0x2a585aa92c2203c7, 0xab84df22522b1e98, 0x4206ec6015e94d1c, 0x58cc1706,
+0xdd5e68d8d2532f73, 0x85cd2f6d1e5e3e57, 0x472081e5d186e564, 0x66314212dc3c627d, 0xc43d4b8d08c3b2c1, 0x5fb7aaf349abe8ec, 0xe970470d6e8a9f33, 0xf8d5751e08c08afb, 0xebf92165c7c46ead, 0xe3f15e2e,
+0x1c4e301551cd79ee, 0xbb3871f50b3748c6, 0x100aedf3e2fc9c03, 0x32ce1a96bfd79aed, 0xbb8a86598eb79c1, 0x99856da84d68b085, 0xe1e9b661152ea2ef, 0x94b7a6bd8e3c92ed, 0x30c82de77b300b8c, 0x18bfe8830,
+0x6bd36393dd279906, 0x697a86b331b1fcd6, 0x808c5e51312898e9, 0xa9e13a3cd769d5b5, 0x649d7fb00d3a984, 0x44c65cd0a1a3c537, 0x54292a534051f829, 0x6fd48825cddc384d, 0xcf61476df7c11683, 0x1b30139b1,
+0x29b1588cecc5901e, 0x998e210742f3ccee, 0x292540eebe5a1922, 0xceb0ceae9a4ebd73, 0x7179b75e6d4bb80d, 0x54bc425e44fefb28, 0xe9680d060239dded, 0xe410f41da9c83297, 0xc419e4429fa90792, 0x1ac941051,
+0x11c7f0546c11f26e, 0xa617ba4c9614531b, 0xe05ac41a82bb6ccb, 0xfaef5687699fb0d3, 0xa19fa3c561d1ebbb, 0xcc540296b66de991, 0x48871d79783afa15, 0x750f1fdad73e6ea9, 0xcc74a6815f77cf72, 0xaff10846,
+0x4797d253f6d59ff8, 0x80b3d4f8d71edfb4, 0x78f397ed75f77cb7, 0xdb1da05f057ccf97, 0xe00ca58d80bb0d35, 0x8e00051722d66614, 0xb338575568c35b45, 0x4421a21738ad8375, 0x6968be8fc35853d9, 0x187f76d48,
+0x9849b56c55a66126, 0x26472dbad494cb00, 0xd602d9a81119537f, 0x31980b8905067556, 0x1a2245e286b1af79, 0x797aa17ac5f0d9f5, 0x1fc186718f07ca17, 0x27e0493aaf8b211b, 0xf3a91d629b2a4988, 0x19ff12977,
+0xcdebaaf51c4e1046, 0xf4b64ab8c006a492, 0xd6b758158b2d1a0e, 0x915ec1176748465c, 0x9d1d7b5719df65a7, 0xe3b120cd1195b1f6, 0x35f21305aa06949, 0x448e358ec3ab644d, 0xa25af0cecbe414dd, 0x16aefc0a2,
+0x63270430d41f9750, 0x63763eb3b0da85db, 0x8cd9deb0dc54999f, 0xd0bfa5d9b9f12f48, 0x12427f66298d2141, 0x671f5a6e1a8f388, 0xedc528b00720da1b, 0x683cba6f8bf79541, 0x3577c5e8f9e115ee, 0x5670736e,
+0x91fca724f0fee2a7, 0x6bbda18d37d3fd60, 0x605e23b98ceef576, 0xee096701668fa281, 0xadc01f49c6543f12, 0xf91028aeaffcbea, 0xd8e27d2e3e7e35a9, 0xf310bdc8a522a48e, 0x66d8c3b2981974ce, 0xc0d8453f,
+0xaf04f5ebb0241930, 0xe9b4d4e8ce94852e, 0x9c5c16439b8937fa, 0xe37f54ac89c65f26, 0x34aca6a95ef9b6d0, 0xb782e4d73730a634, 0x8efb35c003c3fb22, 0xa190de048ee4a34d, 0x765d7b3acef5c80a, 0x205841ab6,
+0xd804d903e73ca877, 0xe2d0fe15d325d0d5, 0x41759646c5006934, 0xc9f2f85a1b5a957e, 0xc1c97fe0bf24841b, 0x689f91aa08acd2d7, 0xe690b177e20a98c6, 0xd6b88ab503cc0dd, 0x629cd0094e6515f9, 0x1ab2df6ce,
+0x3ae784a17b5a3728, 0x440f93e43ffc9b71, 0x1d24561645f60dc7, 0x66655d0ff23922d8, 0x7370fd988e09c00b, 0x5bb34701bbf42ed8, 0x75b444d6bf103f1c, 0x619e653eaa7b8c3c, 0xf38a162a4119123b, 0xe5e7a3b5,
+0x6be0bd03ddb24629, 0xfa664091f9007a0e, 0x3c277546ba591f0b, 0xf9d285de5a0150d9, 0x8ebde0c992292b0d, 0xbb0b6249b54521ba, 0x45b36afba46eb0a8, 0x8c9903fbdc9d81b5, 0xc4e0fe6b26b02f02, 0xe05995dc,
+0xf4439e97673a120c, 0x7afecc7994e99851, 0xfd25bb025d60d4df, 0xd601d1ebc35055c4, 0x66160bdd2794afea, 0xba381b1123571376, 0xab7ccf7335cdd551, 0xf52438eecfc5a9c6, 0x1903c350cc81271c, 0xee20a62d,
+0xdae89bed3e6196b1, 0x82705abb7df01b2b, 0xd3ca7ac48a589a1f, 0x77f83f805197a673, 0x24d9cc77f456a652, 0x85f331e2696eae55, 0x2063f4f1e21c9c41, 0x6f8742d955f9f6e, 0xfeffb612a7826d06, 0x1e8c7a7da,
+0x2aaadc70ded2a26e, 0x55ee9f34a2d88153, 0xa34dd2a7b4dbe689, 0xfc22e4d3d65bbe0a, 0xac4553f7df75eb68, 0xa918c2f1760259d8, 0xa574689b956410cf, 0xa05bc2ab72a9835, 0x8530dfb31af259ed, 0x175b1f3c,
+0xc91d8e3a1ac47d8, 0xf4cbeaa826cdeb53, 0x6ea7a5167ce1953e, 0x3bd62b9f7b255a04, 0x6bc3841108d00ae8, 0x6d0a2184642018de, 0xe9e6a39217ef26a4, 0xe413822462339e1f, 0xc1e5fdb09584e0d2, 0x20e6c71ea,
+0x73b311a2bb02c74d, 0xb77a78a19eb677dd, 0x72640ae72a8988a5, 0x1075ed1c32d437a, 0xe54cad9d8fed1a23, 0x388233a268d89baf, 0xb11438162adac6a9, 0xf2b0f13b365eeabd, 0x83d08104a4c7a38b, 0x8db756ed,
+0x14cae63ecf7c84a4, 0x6fecad6bd93f99d0, 0xd7646655b0ed9374, 0xb6ff91c20308afc5, 0x6968aab4f3b8b73a, 0x58bd63150fde0dd7, 0x401490164d472a39, 0x786f6835f53bd940, 0x8f200e877dacf94f, 0x10e0c6402,
+0x9104945edc695e07, 0x4420fa82999a874f, 0x14fcb65e1718d90a, 0xd670d917c5a33ebb, 0xee7d3bbb658a3a4a, 0xd062dc74ffc4b954, 0xa29b4592760b2fc2, 0xa979d4408ba7e521, 0xcf8fd34f800c00e9, 0x13ebe0834,
+0xfb81f0f5880e98d1, 0x9183f75c512dd73e, 0x7183b89d009712fe, 0xcdb3f69d54c5970b, 0x3c17f29b9bba382e, 0xb451e51766613594, 0x3173094ef8cfa815, 0x67f392670f94756, 0x2c0a7c9e8f15ac75, 0x1bec7942,
+0xcd9df45a5c5fcf, 0x98e52c0e7a371e5b, 0x68019f96b8aa1413, 0x918d1b3460b3075, 0x9521e362e81426e0, 0x556fe26519c6135a, 0x4f2d5dc3909b9e0f, 0x3e0ae02d1a702e90, 0x39347a384d95e383, 0x16a691d2,
+0x824820667ff205af, 0xd35dfd692dccf5cd, 0x679637841e46b30b, 0x3c1b7f785c885b17, 0xf684a5a4c7aa0c77, 0x46f110dde228aa70, 0x29b0badf2fb0f8a1, 0x4bac7fdfadef3871, 0xf003f226f1a92cb4, 0x23ab8a407,
+0x595cc04f79ecfd57, 0x4c86b7d93451c2ca, 0xd04188a020097d7f, 0x999e92d89bd4ad1c, 0xf4fe9c383cebb15f, 0x4b520ad6625e2dac, 0x44fbdf0f6d08a2eb, 0x5267a0aee5f70c7a, 0x52eaa98fe9301045, 0x1eab12cfe,
+0x9e79d34a7ade1314, 0x9db016f822b30335, 0x5a599c684155356, 0x37113cb2a60b890a, 0xbdbfdb71354eb1c5, 0x2e14b1128664595e, 0xeeac66979218ba52, 0x43c47a2bc3f004ee, 0xb046b10ab13aa2ee, 0x1193b38c2,
+0xce85e89a0c13ece7, 0x2c110ad9ceb29d58, 0x4d297aca9194a2ae, 0xa1583f07669c999f, 0xd5372cc6786fea03, 0xa6c59c738a20b6ad, 0x589625c53bc3c645, 0x6fb86ceb7528a6, 0x5c2c6f175d265fcc, 0x1c062c610,
+0xf59937087d53aad6, 0x143c5dcbd5004bbf, 0x405dda657394e970, 0x6dd5d6fb7f46fd45, 0x7f0fd9404b3551a2, 0xa8219cee1625cea1, 0x6da4be1d91f0e009, 0x109f0b644c946998, 0x6e9c0530b7c11627, 0x1b285c58d,
+0x45c2e1749dd70d35, 0x42795d50bb127ea9, 0x7d9b31792e268fcf, 0xbded4d30078d1fd8, 0xc6a5a000cdb6d700, 0x81eccad1d8407dc3, 0x68d2779deadd9449, 0xd45062707a727552, 0xf4de2392a92f7a10, 0x21bdeaeb9,
+0x9b4202eaa729cca2, 0x7628c237c51c67ad, 0x2d3ecada1f9107d1, 0x1eed6f7a2eb82c20, 0x1cb2cb5939912fd0, 0xd5136cd38bdadbb8, 0x29000455a4c78586, 0xbbc8f88025f041c2, 0xc58e03ad923f3b75, 0x181b69e5e,
+0x1147645de00b35e6, 0xdbf97d336f4ddc82, 0x1a6dbdb536abc285, 0x46f809e7e0d0fb5, 0x5cddf06fe22b3345, 0x7bbcdc772216864c, 0xe244a28a60363e1a, 0xfb95072540bb92f, 0x9c1ae9df28d446d4, 0xb57c1eb1,
+0x99aed84cab33b759, 0x29f709438999e22f, 0x237aa65ab76e443b, 0x6e25742ff30e2af9, 0x76f8759462329a8a, 0xbb528258353c6cb6, 0x931f5edd35458dde, 0x9d3680bbdbf3d377, 0xccbb5b6218e17c7a, 0x11d873210,
+0x40403b78eaf09c9d, 0xcf5862e3263d477e, 0x4cc26c5e1bdc18c3, 0xd47cdfbeb802960e, 0xd1f43e00c61cdcfc, 0xaf5b5ae6046c76e4, 0x43426690c660ac3c, 0xa371c389f4c170dd, 0xaaf6b6291175f6f0, 0x1dc44fbc1,
+0xacd1fe807047092f, 0xae4200d03e12db7f, 0xa811485a956efcee, 0xb1fee675123c5268, 0x2df976492222fabf, 0x23b6efe40b5380b6, 0x80126636f465d71c, 0x427b1cdf1edfa9e0, 0x7bab673a0bbe6e1e, 0x16119f96c,
+0x841d3497eb581eee, 0xcf077b70df0f55f, 0xec9728e554bfba2a, 0xfb69c11b9d6b175e, 0x3cff6bea52fb15d1, 0x7e0cbdfbb8f5b5f7, 0x3c033bae377ad7a0, 0x1645ed4b58f9bd1d, 0x30c36592d1f9fd9b, 0x1409917d9,
+0x7ad9fde00cb2ab39, 0xb963c76da9393c9f, 0x41e094b7460ca0a0, 0x612057afe8d1d576, 0xfb6fb474301c997b, 0xf18124f077f6035e, 0xd7bcedc30f332ce9, 0xc61b8451f7b5b6ec, 0xa2cef28a9bb209cc, 0x40f3059b,
+0xf94074189cd9d061, 0x68a5414387176559, 0xa4d1256b97953a4, 0x1a1647b7b1a71e33, 0xcda6851f42026a77, 0x56dd332ca3118977, 0x134008a1a7dbff, 0x814170a5e7d610c4, 0x6a1be2b16c62f928, 0xb4836087,
+0x156e32056308f51d, 0x10f5e464b23df860, 0xc1538c893d687585, 0x32b4eacd8930fe65, 0x4e21070ca1895192, 0xb93424384d2907b0, 0xdf046375cb5e5c27, 0x76bd09703a1bc4d5, 0xcd303f4c0d2d6b9d, 0x1746343d8,
+0x38304bc762d11642, 0x1abee50cf7a6acf6, 0x2794fbf0aa72d81a, 0x8b7bdb91a95f3e40, 0x8fbcf81c9586f52e, 0xa1011af5cdcfe833, 0xe99a6a1729927f60, 0x278dbd3934cf74b1, 0xf4377ea6737a213b, 0x15a092265,
+0x48149c34db1a574b, 0x14c2a3e2defb6064, 0x2e6b39501d1ae83, 0x708c91a68ba6c09c, 0x9b37042937dae239, 0x75a25eae580846e0, 0x36df8635efa141a5, 0x1a4e55a94532fae6, 0x3f6235e32726747d, 0x162ebd104,
+0x8206b6415cf8cd4a, 0x673e3a23ae60a31c, 0x8e8ce6a685f311c7, 0xf635e72a99999366, 0x4f2b729dcd072f3d, 0xd81470a2ca49d1a, 0x1e20adad3f85da3e, 0xc951139af82700ea, 0xaf419217493320bb, 0x120c6577,
+0x4600e1d243bf19bc, 0xb5a6e3245cc8085b, 0x90992366d363ff93, 0x23786df7a5a0d15a, 0x66c5b09116d743fb, 0x271a7c8b8ffe1dfc, 0xd943ccbe5fbd079b, 0xde1bf2d71c830e40, 0x418b6e19276b26cb, 0x8792ec89,
+0x87c50422a2774b7f, 0xc93b8683231283f5, 0xe45036047ecc9556, 0x35ad01ce871a00d, 0x3629ecee493c7c84, 0xb429f0fff25df57, 0xce7a7c665a1924cc, 0x4f69d97d998296f, 0x4a0cef4d8264f370, 0xd9577b04,
+0xfb8d86030a656bca, 0x45c1b3340d5654cb, 0x65b2e1bc97246ae4, 0x3bf73f7a861e2954, 0xcb443fe59ac7af3b, 0x74a28d06902f71a9, 0x413a641f05d6662, 0x644e09f76c8bcd09, 0xe2b19cf02c1e19e, 0xbdc71056,
+0x7f8cf11ce4e3df6, 0xf1ef591a9b4dabc7, 0xabe8916e84d33ade, 0x8e582af0b0b1e18d, 0x67c87c423dfb304, 0x6c11c49edeb0866f, 0xf1fd67a0d8b3440e, 0x91a1cbf4d9fe4136, 0xfa8da4b26d7c1b19, 0x4efc91ef,
+0xdc0cd534b2dd64ea, 0x40832cfd5eb7be92, 0xb1a997119f859df, 0xb67f72161c1dea38, 0xd5db079e563a9c49, 0xef4f32e0551c34ab, 0x995b8d305f548d34, 0x2f3d2b97f501f831, 0x254cb4208b4635da, 0x1a0f8beb2,
+0xf47a53426f38f287, 0x5eabe327a700d0c3, 0x813013566415876f, 0x7f67a33ceee3acdc, 0x5e4e69680129165c, 0xa27ee04540d8a361, 0xdab0d195035aaa23, 0x5e4f4b59febb12d8, 0x945dd1a6f3b894ec, 0x120fd7f51,
+0x2432880f51dbd800, 0xc4e26d785c39c8cd, 0x329dc7e159814198, 0x92a11283c4d7f5de, 0x4b2fa3baaba218dc, 0x7e280db5c0b1f0b4, 0xbc14ab1da580abc5, 0xb6c6c1b19645eb84, 0x17d561271cea078b, 0x8101ec2f,
+0x42b0f297c6a95807, 0x29809584a468645b, 0x6a65aabbe7efd632, 0x9078585befd5db1a, 0xbfec829d758018d, 0x50f5e4e0063020a3, 0x233a2bb3ddbf21a2, 0x3cbf60757136df24, 0x7f54e628d7130703, 0x8b4547c2,
+0xb3e1421075061970, 0xc8b25c4e0322febc, 0x662cc801c3763d96, 0x83dc9d5d55e83de9, 0xab4357e7fbc5e735, 0xca7c7167a39e5c56, 0x53c06e3fdd56e005, 0xda949beae7457945, 0x900b3a0effbd280e, 0xf1653bf5,
+0x3ec9861f1dcb8404, 0xc2805c6e97401d87, 0x4a9e96c103113310, 0x22e494de9ee5d7e3, 0xa1bbb7a25681ffe6, 0x7514a302df27b60b, 0x24d5602d9bbab962, 0x28d186f04cffc6d1, 0x9b0d81dee5cd3080, 0xed27844,
+0xe3158aadca135bbd, 0x14a082e12d9052d7, 0x9ae73059a2fe1758, 0x6036a38f7f59ff8, 0x654c17759d911dd8, 0x86fa29701d2e9940, 0x341f64bd708fbedb, 0x457f816c222353ac, 0x45d161316cd9d9df, 0x1bd2b8a1e,
+0x81e788c1351c177, 0x75fb51d7131e75a5, 0x41f1e0b0702dfeb, 0x82ab0abf2624be58, 0x78ff23b9dd18b22c, 0x9273f3b8ade2e97d, 0x1653bf15a788a294, 0x4a7dc94b2aec508, 0x9baa90bdbe547f49, 0x250c4eab7,
+0x7ab732602eae7430, 0xad899332d15a4318, 0x992ac51663b51274, 0x3c06dba7defe1be2, 0x9129c053b79eed30, 0x5a02b0329e0a276d, 0xdad5161d5ef83ee2, 0x6c73173decaf563b, 0x18afebd60ca7e865, 0x1a8419fac,
+0xc58735c993804e34, 0xce13fde0a116d329, 0x13ce53a27ed65dea, 0xc01491cc690822e7, 0xc982420582c31d42, 0x24a0f42959010a2e, 0x70df2bde1128a1fd, 0x9e6163f00a581aed, 0x93244d203585059b, 0x702d9e1c,
+0x219087f4f3156e1c, 0xe5a54a91d1e0a3bd, 0x24e984aee509c8, 0x971a7dd4f695de96, 0x1808bdd65eb45a15, 0xdaee351a8a41f0b, 0xdf8f621008e3d487, 0x5ae7e9286e981bc6, 0xc2643f09a989b98f, 0xd4442ee4,
+0xad26ba565fd43d10, 0x8b03ad8b843cf0be, 0x47fbe8541e5110f2, 0x3d369afd72d41005, 0xe6a081b77cc3a3d9, 0x3085f8105024b51b, 0xeedb22662e877d30, 0x2fa1bb6111593de3, 0x800d4156be9c6d1, 0x128dbc08b,
+0xc53b39efb75054a, 0xc5c34f211a3dc058, 0x73ac04764d34cbf8, 0x24b3343c9f772e77, 0xdc36216a4d2dcaa1, 0x4bf406bf0242e8c1, 0x5b4bb1e38228d140, 0xb69b4a8b5b2b97f8, 0x64d9762e136cda92, 0xbbcaee6b,
+0x23cb1eb8f82fae13, 0x2de8906b5565a61e, 0x1934947040740888, 0x8b7d8a23158b9904, 0x1c2a261e5d4a425d, 0x2b3252c7238d33fa, 0x309485cbc8c4f1d0, 0x315356880edf0fd8, 0x71e7c0ca2348fd05, 0x119656e56,
+0x3ae0b5a26aae70d4, 0x174b812a7e62641b, 0x4a95a97de1e86ba5, 0xed812da1c6ba18ef, 0x16a7da2e880d27ca, 0xc7a9150bb3ebbc22, 0xd09ab7401ae99dd, 0xc752b63e33d2efc7, 0xf32ea8e6cad4fd91, 0x1caf31444,
+0x3dadf8e01790cc1f, 0x1d90e3762e9b6d4, 0xf000c435682c9bca, 0xa35a01a74e70feb0, 0x692805c0de615c54, 0x99c168fc0684a718, 0xd93b827b069ba981, 0x9e82778cdc2b8f42, 0xf14ae7b8ab14a6c0, 0x1fd09cd14,
+0x9e201b1a6465034c, 0x62c4a394a20566d6, 0xe6e23f5310738c1c, 0xb37d9a9f6dbb5092, 0x1fba8fcec0609e27, 0xc829d29b0c9b8fad, 0x710ca440c74281b4, 0x1c287b0f78ba4414, 0x1f0ee26e8e9dec86, 0xecbd7321,
+0x2d2eeb9689de1891, 0x43b13a4d61ca69c4, 0x27d29427fafdbd7e, 0x91a25d82c7665e69, 0xbb9cfae16256020d, 0x2eadea25e3debd5c, 0x3943f87934e4b90f, 0xa3177728fb98ba96, 0xde7d56187413dacb, 0x2086c8ad3,
+0xb03653812d4bad99, 0xaa9f951167421dca, 0x1514422387b92c09, 0x559d72675b52133b, 0x68b7ce9af2f8782f, 0xcebd644e6aa81449, 0xd740e9fec9a442ba, 0x2fdc95843aa99ace, 0x2e81c09303bed492, 0x23a5c0a9a,
+0x77cfd17fc1b92610, 0x72a929b3fa1df12f, 0x1fb9255e67921cb8, 0x7f9aaa9a56413ab7, 0xe94e2f5b6e9e989a, 0xbf420941e0a63b9a, 0xb1d133071380ae5a, 0x8544e8e44338c7ba, 0xf7d0964f185328b, 0xfe37b14a,
+0x5ffcf9b142db6f79, 0xfb3d1a5fbb3d1dc0, 0x58f0dc25f25d6d34, 0x4911e30a05b2e698, 0xc9648b381fd2a9aa, 0xf8268626a8d6e6ac, 0xb9140f9f50632203, 0x6a822ea13c73f4e3, 0x9dc83c4e89e90071, 0x6d5874b7,
+0x4acefc7482fc53cb, 0xe5340572e0e9cd5c, 0x78aa906570466ecb, 0x1ad19970cf341827, 0x77b088946eac5d81, 0x775a40354b897fc, 0xe99e5ad9886e0893, 0x176b02281d6b1de, 0xa52c8e96245bf58a, 0x9a058b24,
+0xa134ed6b9211bbc1, 0xc33c976cc8b7b4d4, 0x83cf523bce4cbde1, 0xa39f44b5add8f433, 0x6342cc292b64fdb6, 0xe3abc5c1cb68f5be, 0xca546529c569020d, 0x493b51950ea418f5, 0x745cc84ee629e87, 0x1ee42ff2b,
+0x24ca200a7f2c66d9, 0xb738c876ea13a1e9, 0xe23304304a7ba74a, 0x716926f0ffde8e1d, 0xc8e77199d2ec963c, 0x41f549733c44d5a2, 0xf2c80b72723b2a8e, 0x38e717183328059f, 0x28816e45d171ab5e, 0xdb4f27de,
+0x7b60785531908e5, 0x3e704d95f09cb0c, 0x1fe95cdb99135fa0, 0x912f818c6650a06a, 0xa2ad50b388759c40, 0x66dbe03402812f21, 0x6ee7355b9d525a7c, 0x120fd9c419795664, 0x76af25a09a67116f, 0x62dc41e,
+0x3c9067a66d02a383, 0x34b372117a431042, 0x6ee536c570d918a1, 0xa2641aa2e09e691, 0x4d629e1a0c2556ed, 0x4e0c26f69088326f, 0x78bd20770f226222, 0xc24de95afb7decd9, 0x39acdd91619946dc, 0x1c7715d03,
+0x9a21a279eb897832, 0x9ad0c1c3eef0add3, 0x11c6c2ff1a05a4f, 0x94a79563fce33b0e, 0xcd578a94e82b77ab, 0xed890e17057bc236, 0xc7dbe6e4b3e4edf2, 0x9f34b7bd264d37d1, 0xdf4fec04dbba913f, 0x6baa5394,
+0x7bd4ca15086c45ed, 0x763e51ede445406c, 0x3da4576da73ac5be, 0xfa2b94a1c79921d5, 0xe3dd38e8d101333, 0xa662c824a3f8109e, 0xd08f05ce5595a83e, 0x7966ef9f4715999a, 0x728acb89142c8f58, 0x24d9de50b,
+0x640b1ce6cefd7125, 0x60c49b343dfabacf, 0x93988143d6c6a6ed, 0xc305db9f64fdb558, 0xe7a0b1e10d8b370, 0x9c48014db3ddb980, 0x7b4deccb9e1084ee, 0x4ae1883cb0a6ce2b, 0x1198868fbf5e2a, 0xeda8b2af,
+0xd5b47b27d5d18964, 0x57585636979259be, 0x63356612398df86e, 0xf65566fe3314d3a6, 0xe27cb64dd7d9a5a9, 0x247a3f007fae0f03, 0x5b6e3d5b0395b9e9, 0xc23b1b6334392cde, 0xc04c472b0e4786d8, 0x1cedc1699,
+0x2bba229c94c09939, 0xd58086c703b83af5, 0xdc7742784fabfc44, 0xb87f28fda25c6372, 0xc08a1efeeb555fbc, 0x1d9a592bfd1e01b3, 0x75da23a4fe224ff3, 0x7146ca0d05a74de7, 0xee9b08858ac6b135, 0xf05e7812,
+0xd2733a4fe873b63c, 0x9cf590d492950d08, 0x136350d3e31aa273, 0x4b68197753a650c8, 0x93f1a5f23fa50b2c, 0x8e7cadf7045d6c54, 0xc4190e146f815a39, 0x176006cb1cae6a9a, 0xf7e13c8890957ed3, 0x1ef493144,
+0x3ad07926ed12c659, 0x6ec57414a42f635a, 0x846835e960167f67, 0xea688838a1b12ba5, 0x446f0c0824ceb68a, 0x8bab7edd03fa1a3b, 0xe644ad9cf393e409, 0xa85b2cebcf2689, 0x9a99915aa1c55b78, 0x18c9d1958,
+0xf3222141cbc01b99, 0x6e3bcf8d824ee53e, 0xfb6ca27a21dd921c, 0xd9706c413113345a, 0xa85d081d59d971ff, 0x762cd2bc526006a9, 0xc57a59a9a10e2ed6, 0x1d516dde5ea5bbfe, 0xef19b30080e1d635, 0x15e3a7581,
+0x4697bbc09ebcd7d4, 0x505628970e6c70af, 0xfbbcd30aab2b755b, 0x2c792e565eb85743, 0x9fe829d4377c124b, 0xd0fc21ffa1f7b01, 0x9bddd910785ddc3b, 0x2a547e6e832e81c4, 0x90ad279c4c9b85f1, 0x15982e529,
+0x870ce6cc82cf9163, 0x97f5a824acffe20b, 0xf55b91dbe4c4d2d4, 0xd67620fd3d6ade9c, 0x5eb4958d16b8188b, 0x5ff3019c6af3a3af, 0x5b1378377ac4827b, 0x2311341f81478492, 0xf010e899cceb1c2b, 0x10dc4cab6,
+0x15fed9dd25d70479, 0x98aa4f3f9fb53fb6, 0x115e5eac0ba38fa8, 0x4fe7263f6d344c53, 0xeb49a3ada6cf8da, 0x71d4471e60759cd1, 0xcbeef47ad9a57e51, 0xae1e2465c6684e45, 0x9f1796b2053dd922, 0x1fbd3ff4d,
+0x693179ab5b9f7cdc, 0xa34fd8057cecac8d, 0x606cff87ef2ce3ec, 0x9f2ad0f308034583, 0x82ba926be67e44aa, 0x2e9a8ea0fd264191, 0x37d98306a1322ec2, 0xe2ede604c942cfa8, 0xc11b8587e26d0e82, 0x1c29a4e58,
+0x40f6a29892326b47, 0x3959f9c4e7a5d48d, 0xa88efb31b5266d71, 0xd1d7606ef77d18dd, 0x2e06aa9d21f7f153, 0xafc26c6378e9e686, 0xfd9b02c6dca211b9, 0xd131764ba922b8f5, 0xdc527ddee1c39638, 0x23c4de540,
+0x49723da7f249b014, 0xeb1a83e10a46c483, 0x9b9ad38e5ced687e, 0x7fbbd75446686518, 0x4bb39af87ecbd7da, 0x2ccad96d2d464c89, 0xcafa0a723ce3fed9, 0xd86b3d00b56e07c, 0x51d162b6c30ed86b, 0x7bfe6564,
+0xf0efad475bb9581e, 0xd849ade4097a7f1a, 0x5fd2218194939ca4, 0x8905b6533b372b7b, 0xe19225cbdb7d05e8, 0x6206b4afab2147da, 0x55e041dc0cd1bbb4, 0x57b4a25491228f6f, 0x23480c22cd0d976, 0x199c86f37,
+0xdd10cc08e740d44, 0x42f8b0b624fdcfbd, 0xf044faf6527f5d80, 0x9bc2149103cb8578, 0x5f26e4ca259866eb, 0x893d51f5afa34162, 0x17243a7434ae0dac, 0x1a42577a06793841, 0x91d7c2d42d6df3, 0x20393bc6a,
+0x8ee5ef799836658c, 0x400545a12b05e99, 0xb535f6d97b8d26c3, 0xdea3bacb06ff32bc, 0xd9a69ce0128498ce, 0x50ae490d9b04fb31, 0x6ca7cb895015693c, 0xefb6449f2eaf1cd0, 0xfe7aa4a310e0266a, 0x3e5bcc14,
+0x999a8ff09df3cb75, 0x6166f2aab06f04ab, 0xa4ab3674ec1ef875, 0x9617f64bb37160ac, 0xc1db3ffb0cf43ff0, 0x63e7bd0633fe4d0c, 0xc59b09fac96b3b07, 0xdb6bbb0e01c4a093, 0x926e7d223a494a9e, 0x1415596cb,
+0xa16af2c7e334c14b, 0x7b37a6b428b5239d, 0xed8080a3a1f75f03, 0xdf2e922f7d26a63f, 0xb83f1e8e74b97e80, 0x698f7226f6e7eaea, 0xefafa1836634a054, 0xae1d8e82e659cc2f, 0x6f21acd02b30f6bf, 0x1c3fdf382,
+0x92e2794d472e5454, 0x111626ac3fd8448e, 0x30e6d4a81df28be0, 0xbabf313d2744b910, 0x5b3fef8665ce30df, 0xe5d1b950c5807180, 0xc655b0ba7596b1a0, 0xdd1713accb8a87de, 0xc83e96894ba96e3e, 0x294861a0,
+0xbf94fc157dc6b544, 0x8cc3441929c4cc53, 0x1575b26b146a71b0, 0x575d0957ac4d0b4, 0x365da54bfecdaa59, 0xa051665ed276e53e, 0x9ea730254f9bec1c, 0xa9cc5f1c1c22d5cc, 0x5f7370f1bbafc363, 0x4da97417,
+0x4da09fb326c8e7ae, 0xfa1581967c7e3348, 0xd72eb04a0b95d807, 0x3c991bc743715266, 0x22eee3b473f4b341, 0x6a1c3a09731637aa, 0x590359549345a8ad, 0xdbff24078b62b08d, 0x844951e1e87b831f, 0x1d163fdb2,
+0xd68e574873691674, 0xf14e221765a27201, 0x8af34bba1cdb095c, 0x2f25f861b8f9027c, 0xd0f79865274b7be2, 0xd3f80cff199493f9, 0x4638cd52a1d42ec7, 0x104665c8ab30d58c, 0x759a6815523e0640, 0x1f109fd5d,
+0xc0f4d159c0ec9f45, 0xca43ef335dc01825, 0x342662cd29e49e96, 0x804c31be2d3e7d0a, 0x4b0d15e92ae9c3e9, 0x77ec863f3257dcc8, 0xae3e52d38a7daf1f, 0xbb04f714c077ff11, 0xe96b87772162c258, 0xb4a847d7,
+0xd17d98c701f5d0b9, 0x5e3231d9094343ff, 0x130805ac6cf93124, 0xfb97b40f6f5a6e56, 0xcc2b72d8b4f801eb, 0xa371eb0799cc13ab, 0xe3e4ee6d7c837fa2, 0x33b0ab6cb36aa939, 0x1f26b073528388cf, 0x242fc9f96,
+0x312550ecd9ff35fc, 0x803ee313ea1b9e25, 0x5c01a52a4b3a1771, 0x6a355ee34049d3b7, 0xcddab74443a40e4c, 0xae2ebf3980c06ada, 0xb2d42bd3aefafc56, 0x25248b0bbb059c2d, 0xee0b45323dbf9a5a, 0x10145324e,
+0xd5a805e3e17bdfb5, 0xea879a0e91733fae, 0x1b16178c5fc944fc, 0x4d5f1b922570f76c, 0x94448be9aa605e6d, 0x97e3dea269851a2b, 0x3085ef92af24ba31, 0x903c179aca34b294, 0xd81a9eb8673d96db, 0x18aa0a29a,
+0xf17abd70ed093033, 0x9f1736b45ca7053b, 0x952f7d1f53df1678, 0x77e2304ede613668, 0xf2126706d605a087, 0xd5fe85c89b0d0995, 0xd6f8f23fc837cbea, 0xf8359adcb61c5e57, 0xd76883bd5e854965, 0x173308654,
+0x48982bf94ddbb4c3, 0xe2d542ca4ee30acb, 0xe7d59b9748fd6982, 0x5a66dd23bdb9359a, 0x4d6074dc6b3f8f8a, 0x9b855bffd93d73a8, 0x7142d836c6bcd88, 0x47239c3e10738dee, 0x2372e2c1c5353d8a, 0x11de64a55,
+0x96b95cefca210713, 0x22a3871f5a9aea9b, 0xb553be3a2b98e2c0, 0xd92b256e05e3f9cf, 0x6805f6e584a59f2f, 0x66707db1632a508, 0x782a421c7496c6d0, 0x10daccc426d3818c, 0xb3d78ac5e1d8b6f4, 0x14d8571b7,
+0xfb7894ed549c7f0c, 0x37e2d8636ea5f2f4, 0x6986da5286301e3e, 0x740a804a106c49dc, 0xa41577739f7b3c6c, 0xe19b933a67dae172, 0x41001854ad3a7824, 0x50cef9255e477129, 0x9a45f65ef9a7d4dc, 0x4f780690,
+0x2cac0c32baf40c11, 0x414b022d56c89c89, 0xaab2c1d4f49fa3e6, 0xe66c4b6ffcbca983, 0x552436d41b25721b, 0xa597b68e0b0812a7, 0xce78aa72fa180be9, 0x444d82a24075962f, 0xf194f7366184e826, 0xb4fed0ae,
+0xb862f7cc75d9e8e3, 0xcbb2e428f80b9418, 0xfd5688163caa05c5, 0x9d7ff86e6e04354a, 0xd266cdfe610a3b64, 0x8b396569124a396c, 0xeea46173c7f12932, 0x51ed2062ca1eb823, 0x61f13599a1d6c961, 0x18f647364,
+0x9e666438f8c6ef59, 0xd9cc13284ffb96ac, 0xbb5b9af1a1c75a86, 0xba4d2978e7450e12, 0x3fc36c20360a10da, 0xde38b9e95bb8289b, 0xc1cb56b0cc76046f, 0xb5336da8bffa2870, 0x2b4cb8c1c4aea6e, 0x1277976f4,
+0xea4279d0c87f47a1, 0x329a6a8ccab372f1, 0x1ab5f3eca84db08f, 0xc59e674b9dabf426, 0x99f45dbce95be3bb, 0x631a5af2c325d5c9, 0xf9e5c6d85bb9dc43, 0xe5d5146528792ff3, 0xd4f1e27da9b319b1, 0x25086790b,
+0x784a77ef8b75670e, 0x403005a596f1baaf, 0x587ba20f1ca47c4c, 0x8e60a4d794ff3ee1, 0x4f7c0b51dea349f8, 0x4829ba3505a21571, 0x8223cf5e69b79b9d, 0xc37d681194db9f32, 0x7facfae7df996b99, 0xd0e68390,
+0x2d83fb285c840646, 0xe4371b651f63c2ff, 0xe7e481897eec7b7c, 0x8f7bbeace93ca5a6, 0x569ecaea4326ef6a, 0x93fcc45522cbf398, 0xcfeaca306356abb2, 0xb3af42d9eb585566, 0x547169684ac09102, 0x150bf3b4,
+0x435cc10d7cd49dde, 0x11592173b5c811ec, 0x72fbef3a9fa80aea, 0x22b4cdc6b85d9a7a, 0x656fa80412180fea, 0x85676d996f85a074, 0xb10fb103bde3247d, 0xfafd161ab5fc5a1e, 0xc5de026604b7d21d, 0x134def4ba,
+0x27baed1b993699b1, 0x54455c228f2c7d69, 0xa5eda171f4f1bce9, 0x3bfd8a52da402007, 0x4ae81ff35ca48d7e, 0x1954fcb0db72efa7, 0x785a30612a9968a1, 0x79aa7a19db3258c4, 0x599b430a25075f30, 0x177d032a0,
+0xf43805fc61555456, 0x4a39615d42bd2a44, 0x393be59b8e47ccb7, 0x749f220f11c8cc79, 0x935dda57ccfba8ce, 0x9ae51849c9fe68c6, 0xa0fe994eb38cb073, 0x2cc6f0e67006ba92, 0xaf87f244ce0c7aaa, 0x16d8cf450,
+0x13635aa02807e941, 0xf79124c20167632, 0x3609a785b8f1a3c3, 0x539b0d8d6cf51b4c, 0x32d39ce74b570e79, 0xeb51ba33562e3a18, 0x241e11f662f244d9, 0xcb86717a85df95a2, 0xc13b8b98212a3519, 0x12ad33df7,
+0x2e2e6b30cc998227, 0xf66e56620562b3af, 0xfd24bbef26bc1133, 0x810d193e5337305e, 0x56bb6c0a3c8b81e7, 0x42169e964b076eb8, 0x8101358540189cc1, 0xb137bfed5915bf56, 0x175ae9f500dd71f4, 0x1f7cbf8e1,
+0xdce5cded92f6b90d, 0x205b6b1a9937ef36, 0xf2805116f02c05ab, 0x458325286b7db144, 0x9292b1cefaa36de3, 0x4280e1eb6c530e40, 0xcf129de49fdf2d6f, 0xccc657d9f1e96964, 0xdbd8b336df4d231e, 0x406a9ac4,
+0x1d1e52f19ac8e245, 0x69d6158683bca8a3, 0x493248b1ac8ed1f0, 0xdd84832f332868e1, 0x2dc44f4e30b58543, 0x5c89ce8f441f5162, 0xcbf43a4f29e9cd6, 0xf8e6bf61da64149e, 0xf5b6ed5efbafbb63, 0xb71d91f6,
+0x4eed546023ac25e0, 0x2f7932333c747db3, 0x8c684d58caf1cf69, 0xcfbba911f24769b0, 0x3b6a9cc351474c12, 0x5d455ae470721166, 0xe3b10ae6ea0c9ede, 0x8ec424e0cce41b7b, 0xf293b8a1b5778290, 0x8385b1aa,
+0xb3405367472c946e, 0x5d347d5a66dcc1e0, 0x2c4b68716681dba5, 0x98028ff8baffdd86, 0x3c3f1e7d8ad1f496, 0x9b30c03facf579ba, 0xf421db6be4f6b316, 0x18f2fa4347e96c3c, 0x613a75501b308961, 0xb693e5,
+0x4721ba7010afe248, 0x7c08728c9a404e88, 0xd43803313624ce5c, 0xe1ed1149e26568dc, 0x4256534da0d52ced, 0x37971b6ccc43ddac, 0xc1aadd4f782d0d13, 0xa73aaa5ad17f1c31, 0x1e32cfaa421855bf, 0xa45d34b6,
+0x97150051ddc3a69e, 0x842db6681ebdd2c9, 0x5201496ccd06a76a, 0x82c9c74961657216, 0x5787f3b7ea9399a2, 0xd0e79f473364222b, 0x237ceff7d89efa29, 0x4c5753f4362640c5, 0x1035a75d016bf770, 0xcd67974a,
+0x2e8968918c8f5cb7, 0x1faac17db2b0e88d, 0xb4387041a55220b6, 0xd38266fcc1ce2322, 0x3c27cb64e7d7a16b, 0xe63e56a408bee03, 0x3a30f027fc3b08ab, 0xf93b748aba02370b, 0x7f53e5c3f0c61, 0x127b88f55,
+0x678852df3e641405, 0x4773d7782829d55f, 0xb6ce415382d1849a, 0xc950cb926cd5b817, 0x8343ee2fa6fd4c17, 0x9dd57fa526039891, 0x8fbbf4060f30540d, 0xe971d540a23e9c37, 0x6f20fee1a657bcb8, 0xbfd04643,
+0x689c80ab3e28b06b, 0xdf6ec29ae5a58450, 0x703ea0c6da226d09, 0x7716e98280ed9c73, 0x1936a937f53d7853, 0xd77ae5dea032d67a, 0x68a5f3045c202714, 0xca9610ecf06e2b8d, 0x346e8e51324285b3, 0x97575fba,
+0x2ce500891108b0, 0x8fd943a9dc1bcae, 0xa6b20ff4234ffc56, 0x8db2fae328a041b9, 0xbbc1f8c44558fe0e, 0x3b9e383fccd3bb43, 0x8364942e147dfbda, 0x8fcfb6bbba14d022, 0x8dd53264d1d86f97, 0x24c8944e6,
+0xb3f545432a2c551d, 0xe3a668f9a6388257, 0x55ebcd8ef24eb527, 0x8ba23735663711c7, 0x45482b2a56d20d05, 0xc9eba03259d1d79, 0xbcc58a6d47c9de5d, 0x7ed391990dd733d9, 0x2cee10f19a9be1a2, 0x252a209a5,
+0xfe8000687aa9c12a, 0x636a45f04cb705d6, 0x2826e5fc920283f9, 0x186560b0897700f7, 0x799203725c6aca25, 0x591fac16cee5ea42, 0xa1fa6abaadb2e4e7, 0xbad423a332c04b32, 0x9a39aa4074259ffe, 0x1e3455271,
+0xba17acafc1791be1, 0x8731407323245d2e, 0x7570a288827f41cb, 0xe6174b6173857804, 0x20423bb5164be9d6, 0xfa64dc3fcf265e23, 0xc7ba6d94198430cd, 0x13873de182eecb18, 0x937d0d178b8ba3c8, 0x24f2be34c,
+0xbf67a5f91d2aeebc, 0x958507152d95af57, 0xc191145dd82ae230, 0x470ac4a83416ca0, 0xfc5496e77f33e364, 0x38dd24bd4ce1a562, 0x31552b3638ccb7ec, 0xb8878f2092f10e13, 0xba778587c2ccb177, 0x1ce4dd13,
+0xa7f382b4266e5858, 0x1468256c47835a4d, 0xdfc2c9421ef2bc6f, 0x4389fc3cbf956376, 0xbde68c2a40dd56c5, 0x46b1eeecfb4603c2, 0x44461fcb78816424, 0xcd95c4d8cdf2aed0, 0x10a664f0e5239ee1, 0x1afe20510,
+0xc502ec80773541f7, 0xbad870b6e1488f8b, 0xba66ce5cc4f63e73, 0x7a5a2856e0403190, 0x5c159a00faa9fc6b, 0x53c21beb4e7b025c, 0x5fdaca90c4225ee6, 0x10795929d1803e76, 0xe16421c1ea9ea522, 0xaedda43,
+0x4eb7bed8593eaf47, 0x2885e56ff50cb6c, 0x8252bfa5e5ced172, 0xcd4f78d6c493442a, 0xf2497cc34065e0c4, 0x93c5d7fd48adbd4b, 0xdfbf447153c4f42e, 0x1616cff4e38dc593, 0xb05c55709bc92d3c, 0x27181dd7f,
+0x12b761b473f0facc, 0x534da2a7c9ce9db8, 0xc8213f9a067f9421, 0xa93f16b4e433fd6b, 0x75ee5d7352d74588, 0x3d2ee8053c56097e, 0x58f6ca9f8a0004c1, 0xdbb8e9efb299a752, 0xc036eedaf18aa02b, 0x100a11cba,
+0x8a2dd33f7103c519, 0xb2e2ac3b61a70f8a, 0x99ce04703a97d57, 0x6829cda2c1c3bf9c, 0x8995ab40b3b78bac, 0x24c62533e36b3bdd, 0xd5dbb558592ff268, 0x35179586752895b0, 0x96842b4b188cd486, 0x1f29e6e44,
+0x3e7b44b7c9d49ca1, 0x17e3533819177b52, 0x92be9a30555bed6d, 0xf7aba276b224c3fd, 0x3485708ac5ba8a1c, 0x6bf28f3969485787, 0x5b27b37965b260c6, 0x8d329b4e91f168bb, 0x8a830adc8651b7ce, 0xcc866804,
+0xe2ba4d2bea00f2c3, 0xfc75483fa3bb2af9, 0x8bdf207d83e7fe17, 0xd8a45cf58fccca46, 0x81bcc22eb62ed2da, 0xa6038f80100bab39, 0x517f1e5d9cc19b03, 0x6b2059df1d40454b, 0x4fe3bafc9c3e1d92, 0x7401b7db,
+0x7631b2c176655dc3, 0x9de4d69865df97ba, 0x40992b16a773fd66, 0x86689e7da92cb38c, 0xf438f94ecad20db2, 0x6357f669346226ba, 0x508677a7b5ee3735, 0x2d546ba9078b0af4, 0x3a375ab150aadab3, 0x124d93919,
+0x417cce7d8d49ba53, 0x5e96780e82975b96, 0xb071b2ce543b516a, 0xcf87a567f9765202, 0xc4582e9f0576a72f, 0xb09b3e3197c0e184, 0xf2c4642a8e7c7bf4, 0x1bc118d7e081cc88, 0xa2c5f7589cfffed6, 0x159b5948e,
+0xb31dd6109a7d73ca, 0x40d1c766efd78285, 0x4f1e4576eafe0fd0, 0xa614cc7e6d6479b4, 0x69173198cb966d00, 0xf2cb3058b23676d7, 0x709b07b54b3e59ff, 0x278d9e693981fa3a, 0x88fe1bbf43b1eb12, 0x1ed01acc7,
+0x91875144383a8a84, 0xc9c266af3c77987e, 0x84b2e7cf28a6500f, 0x6b0715f98ef5e41a, 0x8761583bc5b7198, 0x8cb0a1024c4f79ff, 0xc2eb4683e23bbef3, 0xdb1563d679cf9541, 0x809ede3bd7c3e4cb, 0x6f50d00c,
+0xad4b864c78ecbba8, 0x20a316874cce4ddc, 0x2431c6c62d397fda, 0xd9a097dcd99caac, 0x3e7e9d0608107ba8, 0x8f8a4366281c0c3c, 0x2a179916e14134ae, 0x93459ff1d5973c95, 0x4044006af36e67e5, 0x24495e57c,
+0x304744e921d671c3, 0x1011ff5160f58ee3, 0x6d8ca9ff3d89b333, 0x42c90538e7c4c5cd, 0xe3d31aed4fcabd04, 0x2d4034b960185a41, 0x80f525f4c568f43b, 0x3613be8621dab3fc, 0xa87e8ba55619bd61, 0x1dc9a93eb,
+0xa9300c27a28e3573, 0x2c4967215add613d, 0x3c7cefa8140c707, 0x5268a0a397555d7d, 0x7ba21a226fe205a7, 0x9743ac1963843872, 0x3325a0379534cc00, 0x227b5747de353377, 0xc6b1edfd0b93211f, 0x1e32832c4,
+0x9ab67b4f1ba0a39, 0x2abd5ebdcb0e700a, 0x85a4f6c5bb070a26, 0xee1f41f464c4d860, 0xde56b67d142646aa, 0xd31c94738147bcaf, 0xe17c1bc588223061, 0xdc212df31811e989, 0x335af8cad817fcdd, 0x574a5914,
+0x86aede9c94ea4b9d, 0xcd4d2dea4d3129b9, 0x21e07c3c9ec71b3a, 0xe454c7c1802fec92, 0xa5ec555ee4a83fcf, 0x7b91ac171d7700bb, 0xa06eafdbeff85003, 0xeb5d8c3f389521c5, 0x932417d90f52e4ec, 0x7f46718,
+0xa279e3e2dc89aaa5, 0x19e62dbadae0c0c0, 0x45c47cd83a4ce171, 0x39fe5cae365d7b9b, 0xafdbd45723e2810, 0x89df105ad3a3d371, 0xa859f3c5e45a3e20, 0xf0140f6e87bdd92e, 0xc1a03d19d15eb4c4, 0x3c80ba48,
+0x28dcd320a8ffe41, 0x5245d5f171f41c1b, 0x78be616ad9b5a607, 0xdfe642d716c45475, 0xa23d78a99b6d175c, 0xde122be23dfd0d6d, 0x11707de5d9be8691, 0x2bbbf975e71afee6, 0x167d96dbab850df0, 0x9f6c7a67,
+0xb3ddd453318e0cd7, 0x7653f42f9a66e163, 0x9b1e94e5ba2c335d, 0xf25c578df4b925d6, 0x717f977ba6e83d3e, 0x5858a3bdfbed69da, 0xcfb1cb943a533407, 0xd335a7d4c9f01ce4, 0x5e4ec7189024998d, 0x809800ae,
+0x9265072bdb19cd9, 0x3e24886a5b672d80, 0xf35729459182d3a0, 0x8bbd1251f594e232, 0x1d9b168607811873, 0x54aa444f1ad1e2cb, 0x64eaf906ca1cc76d, 0x27f0a8e724fbd62f, 0xe4eecdf629219a7a, 0x1905723cf,
+0x713b970e5c615367, 0x811a3b8e9c8daa8d, 0xa0cf1acec449abca, 0x5e36a13a05645c45, 0xf01980aec39e0aa5, 0xad50ced7595ef1c2, 0xfae5b840155e98b9, 0xc5d3affb3c3b7cc3, 0x3af027a4ac48ab6f, 0x1e3267dd7,
+0xb0284696fdea71b3, 0xffc823ee93398718, 0x118e49569693d1ac, 0x20d03b3b542dd87a, 0xcd187a08f499d421, 0xc3a876b74dfebf9d, 0x58f08b79146269f1, 0x4e1b1e1fa9165d02, 0x8d9e7abd93130b02, 0x19c0f753,
+0x7946f12a0228026b, 0x83030d289e385b60, 0x94844bd844f6f2c2, 0x13039e482121a6a8, 0xa7335bb67b19cbad, 0xfac7c61f16a0415c, 0x302a812d8d3d3187, 0x677cd861363ca967, 0x9d8af599653b52d8, 0x20d2353af,
+0x1db294c22af7b054, 0x7ad481d48a326609, 0x41e48d3fe79f3150, 0x2d85ccd1e7c01a16, 0xbeeafd1fca29e2ae, 0x61058b6ec10cdda8, 0xc5d27973cba9eaf9, 0x6ec600abdb861d4e, 0x2c7a9f70cc9404c9, 0x159fd0ccd,
+0xc24fe612b1b13cfb, 0xb731e4db92206b2, 0x68badc1504ce2f71, 0x1709d968269077d1, 0x5b0858b88867b144, 0x9e92824bb66d1403, 0x20b90584a9c2b298, 0x647f5b15b814b266, 0xa170ed286e66fb6f, 0x1e18f19d1,
+0x910685bc1fe08097, 0xa249815f389e12ba, 0xbf3b5fae8c933994, 0x26b350c21ccd3753, 0xa485a40a6824cdfd, 0x5b0c26946291429a, 0x2281dd2ca93dd921, 0xd6feb6bdfa62df, 0x3a53fe9014e2dea7, 0x110bfe956,
+0x90b585ac4842f8ea, 0xa03c4d82973b60c1, 0xe0fba55ab71c8059, 0x3d389e8ac61cf71f, 0x5c28d21a06d1353f, 0x3723b3e91688a17b, 0x3638f362884cadbf, 0x4f19d86b0e534466, 0x37356cf61913f0d9, 0x22a96dfc4,
+0x99c69da6f5b176f9, 0x7698e3da42360bce, 0xc424ab74f5bdbda9, 0x614d6575d335daca, 0x945cbdfb4394fa5c, 0xfe62066e796ffe79, 0x63a57cdeca9339ca, 0x11203c20f337814c, 0x15c677509f483327, 0xa5ce5b9c,
+0x52e80557e04414df, 0xfa0471482f4547df, 0x41482c74455867e0, 0x838c3d5a24fc731, 0x8c5a106e39e90f97, 0x84367375b04d88d0, 0xdffe72fde67a311f, 0x28e50ef1104e1127, 0x854532734b283c66, 0x391c9b6b,
+0x39c0b144a2a8e961, 0x9f5e5fb4fc6fc841, 0x5b32d8e2b44198af, 0x8610d2a00691fe27, 0x194a80e27a665714, 0x9ef226b17167a65, 0x6820c255897e1152, 0xaa5f590c99a2fc08, 0x8d67825e8b8e263b, 0xe315dba7,
+0xe68f445ed8f8758, 0xf4fb40206b2a0543, 0x54225fc3e7a279a0, 0x5a37c4f77934ab8f, 0xd9418d0e383a7797, 0xaa0dd9f7ed84074a, 0x81dc242ab8e55ddc, 0xb387bd8e8c4c71c4, 0xeaff24b0964dbc53, 0x1b8372e97,
+0xd613e31aed1f3a3a, 0xb777295305a36b0d, 0x7cf009a2d6d89790, 0xc3572e510f9704a4, 0x1bb94cd631783dac, 0x27856e722338e842, 0xaadcd3388ee8e12f, 0x6aab97d85da058b8, 0x7752ed41c40e942a, 0x1f9a816af,
+0x3a7623dab659c176, 0xcfa5a6af35815e82, 0x48fd6fa182331422, 0xb2dfaac9b3ca9740, 0xf83902440e2e7f17, 0xe68daee040ae450, 0xbd681e2ad1e18667, 0xee204bbdab3ecb74, 0x7f4ff56f9cb93ac8, 0x243ea3dfc,
+0x6785c08986336595, 0x97bb2e40c8e521ea, 0x18791a61754e905d, 0x3c9fcaf86ae0dbc0, 0x3a064e09b1c86032, 0x915dbac628f6ebc5, 0x511943ba305ab3ae, 0x60a2e4986049d10b, 0x67e80e8bd208432c, 0x20b7c8ee2,
+0xf2b9988656a72aff, 0x31921384875abb89, 0x20941f69e17ca1f5, 0x134544c77d761a49, 0x479887a5f31855df, 0x52e7c23ee5891a92, 0x1bf889314dbf7c2b, 0x1aef15c842e4d475, 0x35707e40a6bc750c, 0x2333fb285,
+0xfd43e07455357f01, 0x880851693e241a8a, 0xd9e9a82117a2bfbc, 0x91349d11e583b3e3, 0xae12513d66e82922, 0x509a226d8af54e66, 0x3c07e5e21e11bfa6, 0x2db8fb252a4a4dd7, 0x15102d690f17168d, 0x147b47034,
+0x6806edc58e8b0e83, 0xbfe52913af490510, 0x19651bb5875ffc2f, 0x145ea7ba192c39cc, 0x9d56bb1db8449b, 0x9184787b41753315, 0xe7d66038571cb8ad, 0xfeeb3405340d3ee5, 0x8e30171ad62c6c57, 0x19a974c03,
+0xe0047ac2c802d0d5, 0x994ce5a24ab7ec83, 0x60127b2547f5bbb8, 0xad1f9c2c6e65641, 0xf9eb3f3ad1e5ec25, 0x21b52408a3504864, 0x9fdd9e1f9701fe46, 0xcd58a9a2dd7d35c1, 0x243e8291a33dcb67, 0xab299e14,
+0xb4dd96486d063dde, 0xa01e9f4136367a94, 0x602d079b1db457ab, 0x9d2681af169bbc46, 0x44c742551ef12bc9, 0x9d93cc6c618a2602, 0xa735d598d34c8007, 0x9ff34a2477adae9b, 0x4ee8d716daa0b4ef, 0x15c4b1503,
+0x476398b0deface75, 0xb0717e0f9f55571, 0xcfedd9be104cf5d8, 0x50f483ce95e784d4, 0x4c0ebeff5ee6ceda, 0x46daff24135c377d, 0x84bd5dd00b4df535, 0x7b639f25339adbdf, 0xe3a5ca84f8373287, 0x92ee78de,
+0x1fe86b5066af3c2b, 0xcba87b422add3789, 0x5a0950efc7dc9598, 0x620b17160e5a6994, 0xda0ca2773889c2a1, 0x4a6f142d42f3b6b2, 0x569b4d80b3d95bbe, 0x456573a6aa33b4e9, 0x8c8d0fc93a4d7df8, 0xe54fd306,
+0x1746882fbc295fda, 0x9a69857e6b74337b, 0x86d48a766734219, 0x445833386b96a4d3, 0x216a0a7a353cda8f, 0x5ac3ffe223c0b0fe, 0xd14977ca99049232, 0xc54269a06480e15e, 0x2c06cba697ec0b3a, 0x1e7cac0dc,
+0x212dc4a2d2d1047, 0xf0f5528f73ad21ae, 0x713e5a6164f74719, 0xb270453504cd356f, 0xc43af1e52c4f9c44, 0x73b6708578a0b81f, 0x18c46ee8f9d44ae1, 0x1452a90ad5a1fd7a, 0x49aa1bd56691bb5c, 0x1b4946bb3,
+0x7ad3e32f35053bfb, 0x2fd377b9958b7dc1, 0x3ffafa0ce019e363, 0xe6dcb3e18c3e7657, 0x82668ca9850a3a26, 0x92d3a0b5f1d458e3, 0x4bd232f57d661e60, 0xc02d12d96e1c2096, 0xfc20276c3ac5aeda, 0x14a4c07a8,
+0x124d3e9c0752908f, 0x8f6b928d82804c57, 0xae3f1e40b9ae2f24, 0x5a8a312fa5087e6f, 0xc28d84bc99bdc8a8, 0xd271c81d8fb0e463, 0xc46b8583985ddc25, 0x2472d99e6b2c11c4, 0xa8018d05e30cc8ff, 0x93619249,
+0xe2a56beeb98e77b6, 0xa516e3c509edd699, 0xe5667ddf028ad53b, 0xc267c4f3b1a683a1, 0x2f467c6714a812ac, 0x5b81e2640f0026ba, 0x32b3f6d3adb31ca, 0x9145ab66979b7711, 0x29a1b9e34322c16a, 0x16205dea7,
+0x50950f3adffe9582, 0x51bde41ed12fd358, 0xbd84670c0ab6e179, 0x3fb477c7e0f8138c, 0x47dd64b04b8deb35, 0x215b081e68997600, 0x291118e32de984d6, 0x47e8717bd5751a6e, 0xee523841941f9790, 0x10d7d7b80,
+0x378f43ba84b24c72, 0xc067057d147c3f42, 0xb384cff27c05acdb, 0x76236ff393a5429b, 0x2f78223f19dafe90, 0x4f532c2b08f1215b, 0xcf6e4be222edb1ef, 0x70c8b1e4e8ff819f, 0x9d50c37ffce06583, 0x1bfa2cdc4,
+0x9ee6eac7fd673677, 0xc2e97f7abc71553d, 0xdefb7195ba6775a2, 0x8b7b11726fc65ba3, 0x80c6082a62b634dd, 0x362a8d53855eacfe, 0x91f08be4e2f16749, 0x53465d1be481e939, 0x4a7a177478c67b3e, 0x10161301d,
+0xe663c8746ab607b, 0x74abb946ebacfc8e, 0x3fa5adb17552f505, 0x7ced8fa2967713e7, 0x690c488c0fd38fd6, 0x2b4d82840c4db07e, 0x199acfa4d14ae590, 0x55c078dff79068bd, 0x1fee2c22e09a9a50, 0x195155ee4,
+0xabb238d3597ad2b, 0xec4487e849e7e81a, 0x9879ecb5d89bf84, 0x82f52ce7d03e1469, 0x11d0739a2f93906, 0x6e24082618fbb054, 0x1f03e035115f8203, 0x4a4a218fa1835e50, 0x9a3903dc3ea776f2, 0x10afe509d,
+0xa22597b42df0d889, 0xaa2c54e4df13f1a6, 0x4eb081b0fb2a2241, 0xe806f202651de146, 0x7367333808169e9a, 0xe91d0c4c70049d55, 0x46b7ebf5b2528a14, 0xa2e59afcac47461d, 0xee782eed3c81c4a2, 0x158c2003a,
+0xa7a0c3ea3496cf9a, 0x95b200b6633b84b7, 0x8f38773460e228e3, 0x1cb77b13edeb0736, 0x18537dfc2948d75a, 0x164fc2270ebeec38, 0xa89f231774393ced, 0xf9af4751fbb40d01, 0xba5b2a9587460116, 0xdaa6b6bc,
+0x20373b208f85d1bb, 0x33cbda5a20d3911f, 0xc6cf63a13b3d8514, 0x33ab25786b272c75, 0x6695abffa6f1a8a8, 0x5e587b24c35be15a, 0xbadc77f8f83334c2, 0xda56574de485a3a3, 0xc848b950325e23e8, 0x1f6283d0e,
+0x5c0bde1b6099a4be, 0xa03847c9af2baac, 0xed319430cd18ff22, 0x2e1af754c301a83f, 0xfa09c71bb2b7d163, 0x83d0519289d42b66, 0xc151a7240c809299, 0x7b27689bd5680ccf, 0x114e00309e4adab7, 0x11ef8fb0f,
+0xa256b108207eb01b, 0x8617dab3d779813f, 0xe771910dfe67d013, 0xfe81024366445008, 0xb10f6ae4f3b34464, 0x60276ef86aeb149, 0x97b51383956567bb, 0xba4dd728582687d0, 0x9bcb45982ae63046, 0x1cb1f840d,
+0xa3dbf978b5c5099, 0x9f443b927b2dd19c, 0xb3066e729bbf864a, 0x511e795184d701f0, 0x23d235cbab093f0b, 0xff74e6f274974d98, 0x3c4977c112778198, 0x62c761226a4e6f5, 0x92520cc5f5df1907, 0x1d81e913c,
+0x1f22d3d75ee148b9, 0xab24d72a8997f73e, 0xc153a07554b9d160, 0x8b650cca04393281, 0xf6227a91a9874a7c, 0x4df3dfb0f8379faf, 0x4e010dec59848a71, 0x785b023bc7eaede9, 0xae78a7925691a689, 0x1153e09f6,
+0x3f59a0e9de794d54, 0xb9b84992d05364d5, 0x6e164346cb6478b4, 0x9d7565bfc39b78e3, 0xc33566c091848fba, 0x3abc2335ccc5f754, 0x14ac4abf5215a2a3, 0x4ed7516251a6babd, 0x14e68bc4ac7a409a, 0x1a5bb2c1d,
+0x7e572b4197618717, 0xd333f2e2e95a7946, 0x6e8c94e81d8ff746, 0xccfa40f7bbba3a8b, 0x3f238dab7d7626c8, 0x2dbd9ea481fa813c, 0xaa99b1e262da8cb7, 0xd8c1ef25901b5534, 0xc73576985d1e6925, 0x172e8f2c3,
+0xb233356b4f90f636, 0xbdcbc37573ed8086, 0x5b6fc689ae06fd9c, 0xf66d20e5ee4c8a6d, 0xb51d45d48091706f, 0xb8833f56d7db8640, 0x7e8e04f816347143, 0x130668cf298c65a9, 0xa309d598513b6991, 0x266d3af6d,
+0xf60d0d719101b72e, 0x31ed72a28f871630, 0xbd0a662cf776184e, 0x9af8a739ea4f65f, 0x51283b49ae97a0f9, 0xa0f321e67e0c1c53, 0x7c786a4a7bd9d16b, 0x7b53a0e9c65b6750, 0x28df2ba9da506314, 0x1b486b1de,
+0x535a864d63e74c5c, 0x458cabfe6980f6e4, 0xfeb97149ba1c5192, 0x95b5b06f6efcdbf2, 0xe691912a4d39b46d, 0xf8e48dd6bb03d330, 0xa64f58a85859b4ef, 0x12253d1333c3e976, 0x2ca2e287f6831a3f, 0x27aed788a,
+0xcaad131081ed54cb, 0x382cd5b82a562908, 0x8980841b5a0b0815, 0x566a902743fbeaa7, 0x4855f1167aa0e912, 0x1d153a3518a822e1, 0x91a88b61b3f556d8, 0x2077d89c941be19, 0x4d3b25339d164c2a, 0x15deccc9c,
+0x6c44f018012d1e5, 0xd27b1f3f3411579b, 0x696bffce11fb8516, 0x240ea723bfddb636, 0x89d18598cbe20c9, 0xb35cf854564d6897, 0x779ccdc4fe48e19d, 0xe50f937978cf3d9e, 0x585602d569805ce1, 0xd727a70a,
+0x2bf7738aca50e805, 0xe00fe3633519f63c, 0xd7b139b74ea2ce21, 0x6b187b6a27b4eddc, 0xf6d0ceb4f67e5ad1, 0x3ecdd0907d9cf650, 0x8de6e40ec022f1f6, 0x3993f8f1ed2aa98b, 0x9a09c8e9e7e2f2c1, 0x21178a22a,
+0xedd35c4bc6b39e66, 0x570f87608ebbab00, 0xb1e56d3978b84d17, 0x9c31663089663e51, 0xece0522e7b683732, 0x11e03761ee819313, 0x1470426177299b07, 0x508d53c16d2a3aac, 0xb19ec21cf5524556, 0x2346905a5,
+0x56b79d77c9700c89, 0x87c36976b342f456, 0x3c928c5866b17719, 0xf33f453ac87d06b8, 0x67f5aa5f04cae7c1, 0x788383f5e352b2f, 0x538438d34de35604, 0xacfdc75964403c12, 0x29290d0fe23a5ae8, 0x1b48aca2b,
+0xfa2ddc7841c2cd79, 0xbb1b5ae54fb1c045, 0xdefd6508f1c3e612, 0x3493909c5f6255b4, 0x48ae57f23c65fb70, 0xd1e94b4c0e1695b3, 0x54c231feb5ad413c, 0xe0bddbd1366b6ab3, 0x8d23f288ad6c56e3, 0x46feb341,
+0x43d735276b204d34, 0x9bc2ac12234839a1, 0x5fbe76d8c97eb867, 0x7732e7e657c6e11c, 0xf7326fbea4c352c7, 0x32169eb21431f5a, 0x20e4223e20010425, 0x6d686e5c2218e7c6, 0x17437b4beeb4716f, 0x1de9a3f4a,
+0xd5f340d080d92276, 0x22c0bf7a7c7cf03e, 0x99b72a70f7063954, 0x799db714ce3105da, 0x55ee6f487fa29a95, 0x9daf8d48f62089cc, 0xa313898a7fd15ffb, 0x95e6e9b4536f261c, 0x4c4b85af4cf72967, 0x27435a537,
+0xf720fbe5769bdd33, 0xbceb00f3e8421518, 0xac5dfdce839a3ab7, 0x2c744190c526bc1, 0x6423c5c6984c11a8, 0x2ca63b567e0131e5, 0xf7cf050c88fe54f0, 0x66fd74139b1d3a8d, 0x3a7e33c9e2567cf6, 0xf6a7f29a,
+0x7cd8286594f4bf9d, 0xa11c6a58cb15f8e, 0xf015e79f04928d0e, 0xc8eb7d2074d4cc7b, 0x75ed3469db78eaca, 0xb3f59b3eedc1edee, 0xe8d02a0e6864080b, 0xa53d38f5c0f1dbb3, 0x15a9c477774cb6b, 0x277a2fff0,
+0xa638aa250870efb9, 0xa1de578b72993075, 0xef85bef15f807c66, 0x64527a3a51ac8b16, 0xc8bbe4b7740811ee, 0xd77bca76991c7a7b, 0x328a17c91c0f4b6e, 0x7718600522bb66ab, 0xcaa88ddfcecfc44d, 0x1ea2c25ed,
+0x7fdaad2bcd8be356, 0x1ecf59782e0c51b4, 0x6dcb22e6349a15e9, 0x8ab40ec12ee84146, 0xf8d7c143b2b92a0e, 0x938ec3a5e561d3d7, 0x7ea42f3048e10a4b, 0xfcb782c4b9fd4be6, 0x71483a3f5043d5a5, 0xba047daf,
+0x59c3d6ca2d857d96, 0xd8399527098ed9ed, 0x37810599ffdbee1a, 0xb5b61408620642ac, 0xf04b110977adefd2, 0xb06357228c12db27, 0x1b79b0bf8eba058c, 0x8aceac319acdfc56, 0x134e34e8816c6683, 0x17a5289ff,
+0x758a9aab54cdfe34, 0x593d2bf111eab477, 0x5bc14859678a57e, 0xb5170668585929c, 0x8b49e11c0f34bbf1, 0x89f2d789d9f74207, 0xe8e45486e41bd057, 0x4901d54b901d5d7e, 0x5418ad50ac3066fe, 0x1a8a114c,
+0xed07dc0f9f8cd707, 0x1034bdd9cdc53717, 0x72bd73adb16c3e4b, 0xd8b29d62b2374adc, 0x4be3ff472afaeccd, 0x7bdf03e73313a5f9, 0x8e4b85415c2177bb, 0x5469a91bb184a821, 0x2fe4afd3388b1d3d, 0x154d9b551,
+0x2256252b404f5bda, 0x529c4b44a934355e, 0xfe52877b7f5e2bb1, 0xdd275a785b7ab9ef, 0x4ee4dc008205afa9, 0x29750e74df3a0739, 0x71c3b8c02ff64f05, 0x56d28b61f6aeeacc, 0x549f97b637027530, 0xc52508cd,
+0xb1948230b3ffd0e7, 0xe5bb3408baeb4104, 0x7b89e780a70f8764, 0x76d6904a2315751f, 0xde007e9b46dcfb40, 0xec62ced26894ae5a, 0xa81507d2cd72ad64, 0xa4d6f903ee0c22ca, 0xe45e16c9ac7fe442, 0xfca5c135,
+0x77fd7581c8ff642c, 0xc5250e3d04299384, 0x747daa45bb4ff226, 0x364093a5a17dd79, 0x16178fc2796ea40e, 0x8a9636411985d0da, 0x6bac48fedc62a691, 0x53ed662dd4f0bbb0, 0x222abdb5ce07780c, 0x233544a5d,
+0x3592a8a23cf4a8af, 0xb656d283b3eb831a, 0x1b07d4ac01438840, 0x2b673eb8ed96fac8, 0xb74512d057536e47, 0xa90e6525a2c48917, 0x35a9fc5d62178c80, 0x12c0db24b7ab31, 0xd155f6d8e8931edf, 0x1606e4f06,
+0xad86511a1f149cca, 0xf0582118e6428b86, 0xb8be49e1606f01c8, 0x97c0dde0f7c7e983, 0xc13a8f90852747b2, 0xac72a00a675df6d4, 0x983d7669fbf66853, 0xa52e059a6d6491b5, 0x4bbf587dbff441cd, 0x10bcca57f,
+0x84c001934b00b73, 0xe25c15af727ded4c, 0x91fbfa9b3182ca18, 0x6b0b574cb5c408b2, 0xb0e896cdbe006a02, 0x525783ca0cb2a714, 0xcef1ee8696df766e, 0x6e2f28057149b908, 0x4fadd7457b16d120, 0x10077c6f1,
+0x69d8a425a7a2e69f, 0x340f9e5b3e82473, 0x50ca6642caff90c6, 0x41da5c17625720a3, 0x542dbcd77326b223, 0xc11932e1c4a9341, 0xacbf28db7a24d809, 0x722829a5f314d520, 0xa96199d7900e8f4e, 0x22f4144f8,
+0x10e83a7ccc782945, 0x4faa8b9598de51e7, 0x9bd023f33821aa4b, 0x1f0909c755daa4c3, 0x12dbd32fa1772d3f, 0xf7fc9b950fd8a629, 0xcfeb5e5397c1c749, 0xf8921b3c0feaf955, 0xa56e10701f87e02, 0x19c6f925,
+0x7bb4eebb1224bccf, 0x3f0506b67b064035, 0x542ad6c422c52954, 0xc4379ef07dc5b134, 0x93153575dd572939, 0x7981010a03b14e53, 0xe0260517a8fc43fc, 0x5d13f3c9de22bb51, 0x7835e3b1a1369c70, 0xc7da2688,
+0x83a95636a031e47, 0x19f6a84265606a0e, 0x25a056e63544946, 0x6f7d57cbcef5944, 0x8d59ff47d35f1cb2, 0x1e9e4eb8f3ffe549, 0x3a868687a2e2c82b, 0x892913cda7ea516f, 0xf06ea74f103bd007, 0xe95221a9,
+0xd590ea206b542273, 0x75967263ac48169d, 0xa182b495d007840c, 0xc598f6847e099c80, 0xb89859371b583b8c, 0xbf086e3ac6224387, 0x287e065b58ffee0, 0xb92c8ba33dd0b09e, 0xb40161c7fd2b12d, 0x912718de,
+0xc575c03a78c72f40, 0x2b0e02687dec9454, 0x90cb3ff8e1e44a1a, 0xb671d8cceba4dbca, 0x1749feec6eb5e054, 0xefb81a7c37262d69, 0xc097f80bc8b5f4ad, 0x1bfa2b8455a5c1bd, 0x5b773d4bb0e0ea7b, 0x24a2f9bda,
+0x430e95afcecc298d, 0xdfd55118145cc9bb, 0xdd9a0bdb66e5b61a, 0xf330ef55e8446464, 0x5ff70c9b2c281d4d, 0x62df1037fe1d876f, 0xbc27e4b680e119dc, 0x9719b15260f41db, 0xa615070db49b9c29, 0x3f660cca,
+0x5c7eb78199d7efc, 0x972affdb1dbfe7e8, 0x45f8b89d1e25fcd9, 0x1014c7e3121ef4a5, 0x6a22570d6b62abca, 0xe3968a4b9b3a19ac, 0x885070debe27e961, 0x18c721876fdfd0c0, 0xdbe6760240c75e64, 0x1608bab6a,
+0xadd3efb53e0c5942, 0x3b097a7350f728aa, 0xf8284e540f760c2, 0x652599930a0d23f6, 0x745276e799ca8891, 0x5a400e01cf007977, 0x9ef01da2d48a968d, 0x6a3ae703e4d63b74, 0x1f46f0f6255dd77e, 0x1aff88680,
+0x3715b2bad310ede3, 0x24a7292f398b470c, 0xd58c7e6a7dc2765c, 0x6a38ab34e3781682, 0x34111d1e27c8c27c, 0xb1db0c88beee2107, 0x9b4101bbba091059, 0x365c4f34bcc84620, 0x817c22213d7dc276, 0x18995d7d3,
+0xbe7b38553dafe79f, 0x5728951b6e827b9a, 0x21f89151367acfb3, 0x3e70b4f985b1a2bb, 0x421c501d9b7d04a7, 0xe6a99f7709da78da, 0xed596076d45d77ab, 0xcb429d327b3dc74, 0xc60d4ad2a0341c24, 0x1e4612a8b,
+0x1cb2f5fa436b6870, 0x10acb7d5d59e30d1, 0xe1538d132372afe9, 0xd3bfd609f3bf33d6, 0x874b6656da9604f, 0x4a436c42c8dfdd6a, 0xab1a397641202ad1, 0x9d527f9be23d471, 0xc7b991f7d8d4b9a2, 0x1993d1b71,
+0x58ba53b0f82f94a8, 0xe0d68de91547f2e9, 0xad39d3433cc7bd55, 0x668d16bedb2c7ed0, 0x965da63abab8cd4b, 0x459d7eef0ce55c0f, 0xb2e28d3a1aef63e8, 0x15c3de70bcd3189, 0x863e1c9cc6da8312, 0x5a3fb6ee,
+0xf22b7a5d33f098dd, 0x8db87c92b434e32, 0xeffcf2154485b2ec, 0x290a353aa6e3012e, 0xd626f6ad4268e7ac, 0xee6e752bcb7a2f39, 0x2be91f257be27d9a, 0x6479b2968c08e48e, 0xc1355c27b26bb939, 0x864dbef8,
+0x492f8b8ebda176be, 0x5d442fea7099ce25, 0x260684acf6ff397a, 0x1466c9afe406a5b, 0xfb3474369bb593f4, 0xbbac616bcdc163d0, 0x4519afe67a653d08, 0xff50441396d3c7a, 0x3e1967b5e02b28f9, 0x148041ccf,
+0xef9d33a1c7ece4a6, 0xdb0b53508dd894d1, 0x2dabff119a5b2f75, 0x9516cbffa066138a, 0x95f45ad537f139f0, 0x5dd5a398f6384fd3, 0x85fad95ea6a8eed6, 0x68f42e74f351831, 0x46c803f6e4ca49eb, 0x11b20457a,
+0x6c2a5a621d5a2db3, 0xadc6abeb292befa8, 0xfe093959c04d2133, 0x66f1c39c56bcc492, 0xa6030acfc836e1dd, 0xb691c7a3091b706a, 0x61c813f41df6965d, 0x3a0f8e8f66b05dfd, 0x9b88cd2faaf95597, 0x2420d15fa,
+0x51afd5aa2e40cf88, 0xbf248f8b3d2ce53a, 0xd1a29286698aa254, 0x3f2170b679a8a53e, 0x10f89a32f06d4611, 0x8ae453261c7576d9, 0x2704ab3f8ad7b6e3, 0xc5e0ac4b5ecf0d6c, 0xa3a5107558af1877, 0xf36d34cf,
+0xf634e659d742b3e1, 0x9dd23095c3508f4c, 0xc7e475eb9f9e88a8, 0x3e0200a27ab740d5, 0x69a6e1fb14c9afe, 0xeb5c4bc5c7beb2fb, 0x55141dff82803665, 0xf61392f2daa904a6, 0x5a67475e47d95468, 0x1dd3a8da9,
+0x3f071aecfa060d8d, 0x5d9f8f399eafcdc9, 0xf5a12508365c9fc8, 0xc742a3c6e77f6c3c, 0x1a1da6054703b810, 0xd963580d54eb2950, 0xe56fba97e0431a2c, 0xd10a8d9be514e183, 0x2dfdacd75988279b, 0x1d194d35b,
+0x58312702e506538d, 0xae7e258b111a45ca, 0x51e30b6986f1e906, 0xb2fc8d528db8c6c0, 0x74adaffbe0b6820f, 0x97854537e5ddb2b, 0xc4478a2babb91af1, 0x54230e82f8730824, 0x2965741d67f9ba93, 0x1c433074a,
+0xb45e3c72025fdb11, 0xb583379e0ba74cb, 0x352b964a950606b7, 0xc7275fa3a4a8bf4f, 0xda7999a6dcf1f872, 0xd384d0df6c14c8ff, 0xbaeef1624bb4abf1, 0x5c62599cde48f21a, 0xa68b75bc9f44eb4b, 0x33070028,
+0xd99d356ce3a95122, 0xe0299e955c87d461, 0x63bc98fe1c9be29f, 0x53c340af188c39e6, 0xdadb2090c49a7ee4, 0x66ce6ad81953feb, 0xf0f75cd8acbff254, 0xef19077a44880884, 0xd3707a987db15253, 0x24abd9084,
+0xf8e2ea074489cc6, 0xd8aa778808cb69ce, 0xe9b7df696db6ab0f, 0x980d916a6ad280aa, 0xb570f5828eb91e70, 0x9ac23a84a9fe16fb, 0x5b863c358c8a9911, 0xd28c2590963e9e77, 0xb9cbeec570601f9a, 0x1c45a8ed8,
+0xbb15da5cee7624f3, 0x7465584b2d647a19, 0x69b42888b20c0a69, 0x9a31d3fe48037602, 0x890aae807684a44b, 0x48b5f6d4f253f913, 0x4b62d02a52b9e1d4, 0x8cf34e83fa6d9ae8, 0x37d6d4aa053567c, 0x114918f4f,
+0x85e7a2c95a94ebf6, 0xa8ac400cea7a649b, 0xd48a36c7c8ad2861, 0xfb75f2bf7cc7740b, 0xbca7594bd1d08d42, 0xab568f3f95a9413a, 0x7423a101f7a5406e, 0xe72953561ababf10, 0xdc3bcd1f34caf988, 0x1df2109c6,
+0xca0270f0a01f5e39, 0x7f39981bd06693c6, 0xd13ebc0cd6a24cf4, 0x4b6c054d89db99c5, 0x901f6ebc83b0e912, 0x6366d18eb81b0fee, 0xbe33805130a955de, 0x49fbdc46839b95d0, 0x6da32960622a0d74, 0xbf22db50,
+0x6180c0467211acaf, 0x54785a17e199af9e, 0xa7faa5c2b9a0b2a5, 0x9befaf57b6d3c4ab, 0xdc467a6b2b64ced3, 0x3a942ad645fde8ae, 0x6b822d51fbec70a9, 0xce05711de787d86b, 0x30d7a312ddf83e89, 0x12ed8df8f,
+0x18b58ae3455d865c, 0x758bbd44c2537778, 0x7e5feacb1631e3d, 0x6c63d9bc302bc0c2, 0x435b814c1af9557, 0xcaac1629e603f21c, 0x57925bc94ce1cf3a, 0x57d51a7dd49bc1b8, 0x9abb375046213ba3, 0x5552fbf9,
+0x507e7f37e69a8a47, 0xb61be07b1af059c4, 0xda0e3b69b5d7d94e, 0x9bbc7a283964c39b, 0x2b94b2644725d85b, 0xbb9c02dcfb0c5cc4, 0xd76521d4e302e5a8, 0x9d61749b78a46243, 0x2501a19267a2510f, 0x25652b349,
+0x63f055f6fd4a06ec, 0x9eeca9f89c3e2ea2, 0xb86f855de31ab9e4, 0xe7e82b3d5cc838d8, 0xf7a548caa2d4ffa2, 0x5cfe3f4899516bb9, 0xf8e5f48d264f013b, 0xd5f52d9dbbf9b7cd, 0x2b3ba8df68dfe722, 0x2450724e2,
+0xd89dca46b0155178, 0xc462010ec88966a0, 0xe7f8b4a2a3fe9030, 0xec86c65cdfcb0bc9, 0xb632a37363198c8d, 0x8316d70526b31bac, 0x50907972c9abcbea, 0xb07aefd6b2215a1, 0x97b77abc5a0829a6, 0x1a6f5e04e,
+0xf511813fda786936, 0xe84f75b79a4098f9, 0xd3a41eb5717a2393, 0x6097be410f5f24eb, 0x16e0f35865812a90, 0xe960b0efcacd5ece, 0x4357d2eba64571e6, 0x46f63f8cebf94b5c, 0x19b3035ab9438c15, 0x26f040396,
+0xe9d0cfef14fbc464, 0xa4d8fd41f9a95d4d, 0xb5fd1d857e09cf13, 0x6348bcefa6004e6, 0x182ad508cb9fa511, 0x47f2c23fba40dfb9, 0x5d41c3ca3aeb18c5, 0x8ea3ca3443e850c4, 0x71dab16abcde1258, 0x1806b3a4f,
+0xd0f251529a3a1d8c, 0x587b057a431232c3, 0x2391fe96b8514c25, 0xa33f1c96fd14b5c0, 0xf6c5b28d26f864e4, 0x52b2ac9930e4b1fc, 0xbd09014c5027fab4, 0x2a99c7a910a9b8ff, 0xf1f194b22d6df7d8, 0x1bf6137b5,
+0x3bd0603e18ceb462, 0xce308d21ce38da0, 0x152e5e386952746e, 0x9d7907c245f54f57, 0x42d743ad76e4d62f, 0x1bc2bad59ddd0609, 0xaacec991c43923b2, 0xe74f9d02a8b052ac, 0x6eb8f5d226ff08b3, 0xdca76c00,
+0xd788a7bb116f3fdd, 0xe48c2bd48cd33ef3, 0x5c895f4f195d17dc, 0xa5dd7e63e509b77c, 0x7778f1e17b03ed9b, 0x8a35e47f9bfac542, 0xbe54273a4de192ba, 0x6b15f33e92c88296, 0x23d2472c7da226a4, 0x194f16f92,
+0x9b97b7f0ccad2523, 0xd45b043b40921545, 0x66683ffbf114de2a, 0x276404b2470c6988, 0x28202d78cf6507be, 0x50a87f47284809f0, 0xbf7fae70e172c765, 0xc6405661c1caa97b, 0x3c2e19082b0d3120, 0x26ecda7b5,
+0xdd64c18a295e0db4, 0x87eb9eca6e25cef9, 0xe96c5ca3381ceb76, 0x7b73238c32702d5d, 0x18979306d447161a, 0xda3bf7e61e07a04b, 0x831028cc3f1e5c63, 0xb7cd49b2ede317ec, 0xd9a4e89face43444, 0xc42fe778,
+0xf11ac1bb5d56e410, 0xdfea2c4c35fb7455, 0xd35b97780cfc33e3, 0xab976c4fb52aab50, 0xaf45c3ef3a1e44bd, 0x4e505efbf069aed1, 0x83cfc92c90177a78, 0x90da60ce8bf58af4, 0x137f3f6c95f9bfc3, 0x1ea45142a,
+0xe2099a5883aa75d5, 0x37b07f5721bdf619, 0x5d38824db8d6441d, 0xcb08b39f310bde85, 0x8c297dc19f3bbc7, 0x86c0980fa3ccdf07, 0x48733225a2a39587, 0xd42cd06bf55f0bb7, 0x4264f0b708c35777, 0x1773da3c5,
+0xd8a1fc4e8428b5ea, 0xc87286aefb787c7b, 0x1e2a41923173a525, 0x69f73662495f1a35, 0xb6ffbdeb27bf9d9c, 0x6f53a5ab3e863c34, 0x7eab6ed2e0065b44, 0x5084b7f487254864, 0xaad91b6dabbf854c, 0x961556cc,
+0x7d68e0d746477825, 0xc2d04dd6e9b1f6db, 0xaeddaf0607205a1a, 0x85aebbc080545568, 0x394813a63425e08e, 0x3c6ab5e477776f11, 0x134c7bae694b3130, 0x96e6274036ceec81, 0x11bb8976a15cbf61, 0x121a27dcb,
+0xfe54e4cbfb6d915e, 0x3c97019cdf822ec8, 0xfc1b6d8ae1edff88, 0xf031da4b79f0bf8b, 0x7b7e2d78cb4bae53, 0x5c74629f84e425bb, 0x9585bdac83cfbd5, 0x190343581bdf7420, 0xb3ade27199d00468, 0x2235eba3f,
+0x54c02fed41f3f7ba, 0xb8bd14e6b8249428, 0x1c16162e07a0c5c6, 0xd3c85aec9fd2837, 0xc2191b63f65cdf5, 0xacf327cb8337865f, 0x2e56afec8b0ca7df, 0x318d9dd87b6cdc36, 0x5ddf7b7b4cbf5122, 0x2356afe5b,
+0x6e3be34ef3192a40, 0x1c5c789c6348623c, 0x931a88a0943fa235, 0xb1d7f33c5d807f89, 0xd5bd99d6df917fd8, 0x1e65e78d28a573bf, 0x6885c9d567115c25, 0x8a42cf12d5d3e8dd, 0xb794b784fe2d725c, 0xc68a2f54,
+0x76f2b4966ac24c39, 0xc91adf5a90027118, 0x8c3560fbaddae712, 0xdfd0e8890d03ec89, 0x4b594c764a33bec6, 0x5ff0b9717d060abd, 0x580824bfd6b5b1ff, 0x5cbc7050011511bf, 0x44027185e208aca0, 0x145fbee24,
+0x95601fa4d72118c7, 0xb9f9aedcd2c0f9b1, 0x98b59e6b2218679a, 0x7509f02f5078be96, 0xc0639a0b3d0778fb, 0x8af3708707243bbf, 0xe5884922dd80d3ae, 0xc39fe9640d0768f3, 0xcc8c90f3feb42f3, 0x366578f5,
+0xe255758c4549344c, 0xf372c0a10db29037, 0x5c7a781a38fa220c, 0x54a3f96b35765d1e, 0x7299926748d461e8, 0x5ac567e3f7b51225, 0xb78699da24bbebd4, 0x703e4557b9b2f94e, 0x97edff9014fb7410, 0x125f5c0f5,
+0xcd08de69cf9bc235, 0x4a224a4f2ef390c7, 0x1114bdd096241e90, 0x5af6c09b63257822, 0x54774362cb1c7b27, 0x527aa5e8bea53144, 0x209d63bb4553746b, 0xa053cf49f1e98b02, 0x72e6749a8cf02083, 0x167bcdd3d,
+0x9dcee8570db908ea, 0x110bfe96cf438205, 0x3d57ae20bdc9a2f2, 0xfa8a198c4bc4572b, 0x7735c3f211b201b6, 0x60435e25b9ed63ff, 0x19310e5ef5c0e2d5, 0x131bf8d9a1048da4, 0x56b176737702b91c, 0x14b205bc6,
+0x10c7bd84b29c1d48, 0xb96a9bd3259d112a, 0xdead43db1063e5e5, 0x778ae93d0464942c, 0x2842e8cd648ef5df, 0x1d79a5971ee132a0, 0x7f98bd3fc121f59a, 0x32bb49accd576367, 0x669c6743af662165, 0x18ef86b0c,
+0xd7ff54a95fcad048, 0x9047b2d4bd6b645f, 0x65897844449af885, 0xfc83055490c6a8f6, 0x1bf421733d5214a6, 0x593f60bd43685910, 0xe71084d8f59f127d, 0xc179949547e99032, 0x1232c38b145e76ee, 0xe822f803,
+0x9553af008d3f2, 0x842225a11b1f9b86, 0xc3af87a42bd04117, 0xeddf7570289b281, 0xe49699ca1340d75c, 0xd20734cbe80a57cf, 0x462d606351fe458d, 0xec0f54486512d898, 0x9656294cbf9045be, 0x101e827f7,
+0x112c415b8151d3f3, 0x3ad177316f4c29bf, 0x3db40a30f43cb37a, 0x13220b8fdafd1c, 0x631cd39ae5bdff73, 0x340cca8d5681874e, 0xeb9f1857ad4b2aa5, 0x94d09c3bd1d8877b, 0xdee74fa4c37bd15b, 0x11f162c3c,
+0x5160cf91ef85f1c4, 0x1e4f8b6dd25760f3, 0xfc19530959841cec, 0x2f12191e680671ae, 0x5f480e928f67ad54, 0xe552accc32db4462, 0xfd9606696b12ab, 0x43327c279761c083, 0x3e443d023b2f6f15, 0x226f806b6,
+0x483beab44b7d01b2, 0x104dbe22fb71a769, 0x49f0e4eb3a648625, 0x23eda23195a9b19d, 0x199b3af71c1d97de, 0x90ce08bb7b785297, 0x896e6f620e309979, 0x9b1d8592ecf0839, 0xb9aa9369871b50e2, 0x17ee9f209,
+0xd65a875b87ffc15b, 0xee14064c32e715a1, 0xc038f2b1e2b82c9, 0xe1cc5f720e5541ff, 0xd97b2d720f7d0717, 0x41946c2abd35de89, 0x5a3e8d16c5bf398d, 0x32997a93d033bc79, 0xecc890d1928a422c, 0x158f85941,
+0x800dd0e6499435da, 0x2f734892b340bd2, 0x4f0c59822d97e949, 0x2484428a1f2d3cb8, 0xc5549ebc4555d1cd, 0x84f726298b40ca86, 0x2c32d1cc9a58cb8d, 0xb095f7ed16edf50b, 0x2fcde5b6bad8ca00, 0xf9bd3154,
+0x3e7fa12d5855d7b6, 0x9a04a5a8bb9d77bd, 0xd14b0cee5615e652, 0xde24e4d30f72ad97, 0xd130b70cc7cdbc44, 0x972e3c21d47eca22, 0x81e94decac34cf37, 0x9e3b4a3f2f08de6e, 0x3ce3e78d1bc450f9, 0xb34f206b,
+0xa2c7878d5069a748, 0x42c8814b061e7903, 0xfdec4147b0601290, 0x11ab3dcaac18a3d8, 0x863f19b4eb013356, 0xd180731438e294c2, 0xaa9d5e769dec187b, 0xba017f127fa798b7, 0x358ba1d74bf4c36f, 0x242373067,
+0xd3c23d35a3b6fe56, 0x6a6c113d98a3d99c, 0xc8a116169618414e, 0x570ab1e40eb13723, 0xde240846cd40c53d, 0x77e7f76da6c48a10, 0x38f1af0f18c0a69f, 0x606f49b17634b54f, 0xf0ffd274a5ae19e5, 0x118f0e97f,
+0x34d3eff8ef38c5d0, 0x1bfdf89c79f11f67, 0x4103f400234afa4e, 0x2cdba0c72c4d1489, 0x4c5d1ecb98e13494, 0xf67d507fd5822193, 0xca84b3488a90e986, 0xe3b7c769e28b8f5b, 0xdace72733d230889, 0x160f839a8,
+0x191c6656932d3595, 0x56c54f30c57feed9, 0x3deea745386a83e4, 0xe7750df3ee42280c, 0xb8688bf314dd63bd, 0x62e24a8e7af055b0, 0xc2eb8e77ec06c9d3, 0xe3897e08a5552dc4, 0xefe611530e5223b6, 0x1de1a7e4d,
+0x1576268bc1bfe627, 0xe2f9c8829213a932, 0x1d7cfb10e7e6da55, 0x267d297b5bc4d806, 0x686556b5cef02949, 0xc978d0c499076d3b, 0xfc562e8e109cada9, 0x8b9de85d305a946d, 0x8109694dd1018ff2, 0x1b41c787d,
+0x4fd150790599b0c9, 0x43685fe9acc6a12e, 0xbbb56697605c1419, 0xa3506d3545f3888b, 0xca1927462ff6e919, 0x35d779c0db8f7610, 0xe5f566aecf5ee0ba, 0x55d072904e545eec, 0x6043e9aafc9f0f24, 0x1336a86b9,
+0x6ac3bb78bdfd4972, 0xd55fadb50cc6c3a, 0x6c01f1f478c6cc59, 0xf7f910fc59003342, 0x53196a23c6609368, 0xa091679904f2724b, 0x6602d0328f3c4613, 0x85ad6d3134df6da3, 0x84ab6cf6d259a94, 0x229499ce5,
+0xfccfd00a55a2be46, 0x7dc08379248b65da, 0x23ae35f7a064c073, 0x6e823d8aa2f2439f, 0x374905d3cc997b7, 0x9f510a1a64697791, 0xd908fea01468cff, 0x708bc5baeffeb41d, 0xce12b72fa96ec45f, 0x7d093ede,
+0x3c201f4b7f2cdd0c, 0xc8916ab3e79bf5e7, 0xb0bda3cd41b82438, 0xd04cb6576cac84d9, 0x3bc2522a09676636, 0x7a91cf6d50e86d72, 0x77ca11e6d11dde7a, 0xff5fc5adecdbf9df, 0x5f35a06de9806cb4, 0x207886718,
+0x58be255d11974cf6, 0x19745c23fd9b2ac1, 0xba30acd87aae45e4, 0xf0fb6778dc4cf651, 0xa864b7c3b2458528, 0xf4fd5f70bc1b3332, 0x5120b0e937a964b2, 0xf7e8e91435f67b0f, 0x4203b1fd8cb679c1, 0x1046f0a48,
+0x6eed8e7a27cc704, 0x26f970ea24353edc, 0x9095e5c8d54fdd7e, 0x943df700cd53f2c, 0x61e9fb4345f3ccc8, 0x2baf8c882723aa6c, 0x19a2a035cf706412, 0xd0ea901508a78ef8, 0xe88ea3b440100a01, 0x59436ebc,
+0x1697892e48157c63, 0x98e9cd5af2f33390, 0x7f1764a6125bee02, 0x24abd2de97a90135, 0xbfac4b2b60e02801, 0xb38b1c3c164f6c9e, 0xdef7c13446424dd3, 0x77c248910f9f47f4, 0x3347324af1836edb, 0x85a3b741,
+0x7569d0ece8185b0e, 0xa0515afd4b8ce453, 0xeff340a80b919301, 0xb228d324cb5b5298, 0xe60e3304ce713eb4, 0x5acc6186a978cabb, 0x6b87f94fb5dc0f7d, 0x62a96f146bc9f568, 0x81dbc109129319f1, 0x963d6aa1,
+0x9991314c71dc4b10, 0x6a970d50c84e8ce1, 0xb9c3158251dbed57, 0xae965baf65a0bde6, 0x344277f34b3a19b6, 0x67a857cf62c20339, 0xe0c523330ccd2703, 0x8491481fbfaa915e, 0x5bb4c286bda14a7, 0x11b1f5758,
+0xcafbfad6b44d4b26, 0x73837f5c44b463e1, 0x1c3c19c371ac8adb, 0x51d45d1fde509e70, 0x5fac87dab56fa0b8, 0xedbfa5039f320f2e, 0x11cce8509acfe2a4, 0x63b692460218c592, 0xda35882cfbc3582c, 0x10d8c2ae8,
+0x3ede485ff530245a, 0x5760f68cb6eb95e9, 0x95ebc5275b28dadb, 0x29709555ac8d0b1, 0xa5d9cfddb9a8314e, 0xae4e85cceeabc044, 0x494962ba996f9ed4, 0xa25898124beeecb3, 0xaf893a419dc57521, 0x1f537f00b,
+0x8c2621d0b91bf7a7, 0x5f32a41ce37f1cd5, 0x808db647f6d4657b, 0x29d02f3bea8bc0e4, 0xcc0ede9b5a4db4ed, 0x45ba34818936a7c4, 0x779de2ad77327976, 0x45b228f71e853dda, 0x55bd9cdab9dab873, 0x1e4535380,
+0xbf27e0129829e6e6, 0x5388695f9f11105a, 0xd7b7c85f5702268b, 0xf39732ff0938e7f0, 0x13c7454b9f946dff, 0xd0adf9b46fbea128, 0x2daa92e717ee40ef, 0x333ba5b2c7f2237c, 0x45a70959ed559d34, 0xa4993347,
+0x3e0963e3176add38, 0x20a102724bd60654, 0xa38e0eb34840a82c, 0xcc3f097a9f49576e, 0x1a699457074d9518, 0x1470e4f0cf7561f4, 0x34b55fdbde1647ae, 0x117e29f0d1f43b96, 0x2e258876a2ec659c, 0x15dc7db6b,
+0xa95f6cdafb9325e0, 0xc2ab00262f769ff7, 0x99d3672fb048c0fa, 0x107d98a38d8f5908, 0xdd93534546bdf3dc, 0xfca53d43602281fb, 0xa37e1ae5fe4a84f4, 0x69dbb3d563b41eca, 0xe80aa219e24d234a, 0x1dbf0b983,
+0x94ae7b38d6880b1a, 0xbea1b85d035332ba, 0xfaaec89645259468, 0xf9041502f78f3f65, 0x154c5c067c950ce1, 0x9dfb9381bec11f21, 0x7bf8ae2ad7406895, 0x8557b0a044d28bb7, 0xc4f895429d951ff7, 0x11b4ec144,
+0x180706549e81dc10, 0xd7b97b937aecb07c, 0x1347cc4952e68b25, 0xb8ed9ed747ceac9, 0x7e79da7c6a6c9259, 0xb95e163f46fa74c9, 0xc5967c5452cf424, 0xf71b20ee72d3e0cd, 0x4418e1144274be4b, 0x1c4a796fe,
+0x8d908a2b2f611de7, 0xa868579ce45b9d37, 0xe9e0da847459d770, 0xde9fbf4d5525211d, 0xfecf131500416027, 0x26dbd98d1d22b00d, 0x5c01450887f60283, 0x84d2107f0a1e9ff, 0x94426256761edb15, 0x2441ab037,
+0x8638ff91cb5a8d75, 0x846ab5f913381266, 0x948fd30df814fc86, 0x700cd175395b8b5a, 0xc8f71e18769f5e3, 0xd688a18339db0eab, 0xe5431c8b1a2108f3, 0x4b71094138554b16, 0x20cf11a3bab611ba, 0x17cb5e9be,
+0xe59ad8a97e2d04cc, 0x7ba679c0db9ab6, 0x9bb4d3d67604cd0b, 0x8156a0bae8179c7f, 0x36790f9b028d090c, 0x7807f43593e21edd, 0x9dd51232f49ebaa2, 0xc0b10955b3a0cb78, 0xb78c22b7f596532, 0x24bdda502,
+0x8719100b2ee7043e, 0x47663d2bb02717b9, 0xa471b61c669728f, 0x1f1f10fb88d73ecd, 0x9ccbbac6ffc48a0b, 0xb6f248b6f523980d, 0x1e852bceda97d975, 0x97f5a58e6bc3d505, 0x5503f1ef30e99fd3, 0x2351c18c5,
+0xb5a7701e41a92124, 0x83cdd001fa592487, 0xcf10c35bf891ea1d, 0xba658c74f7ce95c, 0x6c9099a52ae20712, 0x5dc14100e9d62de8, 0x5013d67a06b0d399, 0x6b59af9eda9a62c2, 0x3bd9a296e4fa289b, 0xa3849089,
+0x1d31529893413f35, 0x7a99bf5279cb17fc, 0x54c1d7a0586239a8, 0xd619f4df3408d6eb, 0xb64e9cacbbbb0915, 0x932e2dce0a888c70, 0xa376163d90ceb221, 0x735aae962f020bea, 0xad2efbeb0c74afcb, 0x1c27b33fb,
+0x8df9f004b65dcee1, 0x5d83fe3d4e4dd58f, 0x8b0f01c29c3ee95d, 0xa31e13b70aba109e, 0xab8e34215f596bd5, 0xeaf1f616bd012dda, 0x608ebd1c542098b6, 0x339841d7ec7923a8, 0xdf02438716c69a8f, 0x168c0ed7a,
+0x5e57dc836d05913f, 0xa5890861f0c8d7d6, 0xdba33a5ed208272c, 0xfa7b52afd19c494c, 0x30770676043cc7c7, 0xbb140db0beaf76ce, 0x17a0c8ddfe881b47, 0xf603ea471515131d, 0xfbab447de76a573, 0x1b7e6421d,
+0xc2f8b84bb56022c8, 0x6d167c526c84a4a4, 0x6ebfc5f11ea65a68, 0xeb7503d1af7be124, 0x40e4ffd90cd9adfb, 0x1e659cf88359bd07, 0xbc4d009e28a89fc, 0xb86bf78283d99c87, 0x291eab234500a90c, 0x10f00b7e6,
+0x222bb2ed15f729be, 0xd94301e2a7789268, 0xda2737d4e20ea846, 0x9ad63b60ac439068, 0xcbf445efd24abf8c, 0x1c557fa81d7229f6, 0xfbf545a14a4cc6c8, 0x6b9960265189f4eb, 0x718d8fa7633e2c8a, 0x193d27853,
+0x84abf0c335ce91a7, 0x54669d5d55243158, 0x1f89b92731bfd5ff, 0x2e9e24f1478f11f6, 0x7d490081be6d1fc2, 0x449651115abbc7c9, 0x32c1ecd9b3843058, 0x7f35684a693fdc63, 0x44cc56da7269fc32, 0xb9373326,
+0x3d729a55e6f94964, 0x4625133f248db5df, 0x70df90d3797f10ac, 0xcacb4f4ddf9d60d5, 0x610d84a9f8f3afd7, 0x9e762e9e70f4b6c8, 0xd277f42c535706dc, 0x476c387f80609be7, 0x96c6a0c625333732, 0xb25d7ed8,
+0xf5762361c8d95461, 0x9acea957858ca9d8, 0x135e376258f615a3, 0x4722571d276ab0c4, 0x1f1c1d85604fded3, 0xa9eb9099dd4d0110, 0x8ca7755131501754, 0x61aa96a3f3473cf5, 0x139419f79ff8d60b, 0x8198526d,
+0xdb08457b895865f8, 0xc21156bbd31a901e, 0xd2d90081b15bfe9f, 0x82a4465a1f98758f, 0x6f387989f41fe2ff, 0x4b975ecf6789d4f3, 0xb473e57e832a2812, 0x1060dca4b9e2fc12, 0xccd45c3ae8787d5b, 0x23cb06b92,
+0x659240c040e21d2f, 0xdcaff317c5ff10d2, 0x86b7359480947c4d, 0xa4004ba2f000f201, 0x70ae0d73211842ac, 0x50b6aaacfc70cb63, 0x5aad8c4417bd08e1, 0xb10d214fdb85fa0, 0xd14bc53cc5e29ce3, 0x109d01d16,
+0xcb344999a5cc430d, 0x920afb1f7bfbabc7, 0xae360cfd3a1f3ba, 0x4c81ce37079b4954, 0x8604685505740803, 0xa36e6109b5d1c527, 0xfb3b312786d70e6f, 0x284cb43cf80113b4, 0x3d21a5e2015a6726, 0x212d3a005,
+0x7c10a4c156bcb02c, 0x3cb2ac150bd4d91f, 0x207a061a16a4fa4b, 0x5b073140c18c8d8e, 0x4976a2d000cdeba8, 0x508a5c261781d6ef, 0x8bece80c77ae502d, 0x875436f5cedb14f2, 0xf2b07641b7cb4c4d, 0x126e30249,
+0x8f18c02dd2bb2344, 0xca3c85d4c37fe1a3, 0x8d953d533c7e46a9, 0x3d840e094efe41e2, 0xa64b946ac4ecbcaf, 0x5d88216ee161dcd9, 0xc6c2f6553a635b2, 0x62832ac1e4007144, 0xd98f539775fe7472, 0x11287d618,
+0xf48d93b97261b79c, 0x3932d085a8ceb068, 0x346bdeb508dd4abd, 0x2f0db6065fb8429f, 0x973e9fda15d09f5a, 0x7c24e5afd5d07e9c, 0x129b3720fec1eb4a, 0x4f5ac651a82b0c45, 0xb1c6361ac10a33c6, 0xaf3bfe90,
+0x37c633a067753aa1, 0xa1ed1673808e89bb, 0x6edd05a3cef23f31, 0x26b04d09be53747, 0x36a0915eecc0909d, 0xc2b4d805d884a7c3, 0x96865dac6348bf65, 0x9bef148d2a27ff04, 0x7810f288455cd6ed, 0x81fccb4a,
+0x46baa119e2fa4447, 0xd3333fc85fd510e8, 0xbe140fefc0d26939, 0x4ddff2d1a7d2f880, 0x846dc2b0224153ea, 0xc7012327582c77bd, 0xd50f22cb905309bc, 0x7f5b6253be9574a8, 0x481fa6f5e0d7274b, 0xa9ba2e7c,
+0x247b6d713c56ffc4, 0x2ea6b9789199ca6e, 0xf9bfb7175d049171, 0x36ed38d4db7e2dff, 0xa7efb56bdb66cc6c, 0x7a2ea3b84a9d1eed, 0xaf615efb58489165, 0xab4ba5c8ad15ef1d, 0xa6488971028920d1, 0x269eccb4a,
+0x20638972803141dd, 0x73c1c92ed55aa25b, 0xb6b58ba0f301c3c6, 0x5a1b429bee091465, 0xc8e52ade536f4f18, 0xf42bd367821bf202, 0x8f46c90cefc964ed, 0x7b34ec027fdbac2f, 0xaf6d7200a2e8b9b3, 0x16db99dc7,
+0xab5f2649729e006b, 0x9c832086a5288806, 0x865c7d7cf2eae68a, 0x62c3bc4abbdd623c, 0x38f15fa9dfc48706, 0x51ce5ac4df48e19, 0xee86b429b4ce686e, 0x531eb2f1f0e9bcb5, 0x1128c1c142a15eb8, 0x55eb0add,
+0x3f01d1c6fc551b43, 0xd4577b4f1b71911c, 0xd419fba57a536559, 0xbe2580d0feeae241, 0x73e647da77d36b35, 0xb66822d6781bbfdc, 0xe23980c8c307716c, 0x327ea2a624785c4a, 0x8b3fca83cf57657e, 0xdad423cb,
+0x9461bd1b447b61de, 0x62eeee93aaffe0b9, 0xff1c58d0e230df92, 0xa32fd75f581d6037, 0x4440daa166a23d2f, 0x13f62cbdd5de76c0, 0xeaebb1a01cc88721, 0x7fa8ac98170a7e90, 0xe733a7f94f1095c4, 0xa5d53af,
+0xe531cd52c8d6a4a9, 0x7420e1821efa33c7, 0x3bf3b02e8706777c, 0x1aba6ff3c6275ca1, 0xb2a43dfc4a41dc9c, 0xc6a4914a2b7f8f98, 0x9b414456ebdd02ef, 0x72825491898f6103, 0xf4fd70de2c620e41, 0x1a569eed6,
+0xae080e4a69c3cc8b, 0xaae3c70ca3cee981, 0xef6843fc68cd725a, 0x3f5a6b341e7254d5, 0xc7d38fda02f92e92, 0xdd8d619c0a8ad666, 0xd4a355f2ef86d9e4, 0xee7f3b3d0078d038, 0xa43d2a02c4d977a5, 0xd8c4265f,
+0x2a82b612ba51a723, 0xfd7fd34f56bfe5aa, 0xaa58c92d65fd327a, 0x2db3ce5eeb171503, 0xa9fc5fb93b005937, 0x1e7db3e4ed2bab48, 0x2baa7f6e69293088, 0xfec66605c655ab96, 0xd9fe017c2c6293b, 0x1352569b7,
+0x1c8cf9a7780267b4, 0xae28f0c0dab557f, 0x494d723b44a21a3b, 0x199c7ac9ebf1c69, 0x11c188f69e158c77, 0x4b210e056fd19dcc, 0xe8e50f5ccc4c5b50, 0x15d70c6c7639dfbf, 0xe43e41ca457d029d, 0xe6da60f2,
+0xb9c7c702da25e4da, 0xfdcf59bb139096db, 0x96dd12e472d02c53, 0x2df1414a310683fe, 0x68f5d393cfc64a8c, 0xa0a40fdca625d8fa, 0x4c01c7e95d64eea6, 0xed7b8274063fa8f1, 0x4962b3191e62e467, 0x707caac1,
+0x6bde89332d64b346, 0xdd8ab484398e147e, 0xa1f70a4d92ec8c06, 0xa8178d3fdf56fb30, 0x1c37829917fc3501, 0xdb9afa279a948856, 0x3ac24103052210f2, 0x69839115aad36355, 0xe2c3aa8c52d53078, 0x2613e6f84,
+0xeba57c33a1fb9f6f, 0xeb5f7704449d67b7, 0xff95fd3dbb652c39, 0x7f25012e20189b70, 0x471b3b1ba6255b55, 0xdc5a6d791a504d0f, 0x536af0069846dde, 0x812e985c40f2e55, 0x2701745c41c79af6, 0x1b4c14167,
+0xa1af7b38e6c3ce16, 0xb51cf3649d3ccf3f, 0x3991db4396cd4551, 0x632f3ce2726b54ee, 0xdd4b321f20f39d11, 0x8aa8adb172205d01, 0x1a8de36923ced31d, 0x43eb13e588a29d15, 0xa7b34d71cd5579bb, 0x27a60582c,
+0x9201eff5adfd673, 0x2001917c37825487, 0x8c096889604650b, 0x75df4c166499fe78, 0x5903a054bf23869e, 0x6db66f77f0bfe6f2, 0xc2ecc49ee57bd8aa, 0xf6f8a9cf961ade7a, 0x4d75c517e7497cf2, 0x1efb4d66,
+0x62e6ce4c64aa6b3c, 0x5cf1a760f2b770b7, 0x6fa2ac6d1c73e3b0, 0x92795635c70cd2a7, 0x6f4bacf71e6b711b, 0x2b9a763acc432ea2, 0xa547f926f56bf8ab, 0x5d44f1d2d43d9e9f, 0x1089516a80c307, 0x207a2fda7,
+0x36396952d01fc053, 0x1a459a10d2bc8aa3, 0xd75e19c4699278f5, 0xc4aff70d288b095d, 0xf3458981bf22ad59, 0x5219929050dfc30e, 0x80cbdf7952c4bce9, 0x733b71776b7589d3, 0xdfe01362b55dc872, 0x1d99dd7d3,
+0xea13da8d31a5f3d4, 0xec6470342db86da3, 0x33fe4260a64063be, 0x4587470fd7ff0821, 0xf8ae5d2a99434b0d, 0xc7ef8b7d0ac8c129, 0x76c5d268acf8e331, 0xc18b30f8d3a73e12, 0x5692d45c190cfbab, 0x140e0c339,
+0xc849e09e5b83d066, 0x1c1f6fb0a2f61c83, 0xa2884760dfdcae6b, 0xf527c7a36d9637ed, 0x9c131b575d28c635, 0x145d7d3405e8b8f0, 0xa2f48f16643e31d, 0xeb879ba0670984b1, 0x95d8e852add4aff0, 0x1bff4fed1,
+0x6bb2cd48fb2ba907, 0x904352965f8533aa, 0xc46b83620ea8c080, 0x90e4c2b3d1d6e376, 0x103cf563f8756e64, 0x2af70e01ebcf08c9, 0xc697a5a8d3da3872, 0xc62b6b72f40e9b0a, 0x60c10ef97bff4670, 0x21fd93035,
+0xe3ea0fe0c21cafd1, 0xd2381dbbd8fa64c3, 0x496da8f554905388, 0xf5b2d5bd3da9ce2b, 0x7086fce895951917, 0x54f28aacec09ea72, 0x3fb75552700b0b01, 0x2419dd90451a80b9, 0xab3b91cb2659f439, 0x10fd88961,
+0x47de8c06da960701, 0x4899a0c7bc239b64, 0xb02e698bdcc2e831, 0xd0a58889d6cc3b2c, 0x3b34e54ac518517a, 0xc92014bcf8ccd452, 0xa5bfcbbd01e03629, 0xbaf821933e1cc85f, 0xfed1ddb5c220eb86, 0x4a7a19e0,
+0xf5370069607ea92b, 0xd373498865ed4298, 0x8aa608a01cee2590, 0x73ed8f2788c52128, 0x1382c1331282636, 0xf4aed153b5df85b5, 0x24290d25b545f9ce, 0x32036e00f309a585, 0xd06f009c71874fd1, 0x40b82f32,
+0x6b63f87ecc833917, 0x690e740e779e342b, 0xd53aed5dc407cdb6, 0xc7f255f2e95849d5, 0xfaa3e47beccb4cb2, 0x43613dcd5fe77cec, 0xd9028c58095dd18c, 0x85c028bcb18ae4da, 0x3e52e5ec63629bc6, 0x27251d4be,
+0xd64beff8db90b86e, 0x4ce133ed856afafd, 0xf34de2ad5c7d8025, 0xde27b80fa0b1cc93, 0xb81ef091a95b600a, 0x17f7853206c168fc, 0x10b6b68d074bced4, 0xf8b40d4d42f1d2a0, 0x9298c1c434949994, 0x590cfc16,
+0x88497fbb55ef4ce7, 0x9d6352b7c9c83683, 0x99bfc36004816ae4, 0xf97b1f0605e031fb, 0x3e88cceb9c5759a7, 0x296b274fe80a4ead, 0x2b156ee672463cce, 0x7935b07843fb1286, 0x1407838004f13950, 0x1ccef08a3,
+0x74f6dc1af9520526, 0xfd32b4586aeea22c, 0x5fd59c4513378e5f, 0x46f2a3a20bd8426a, 0x63b2f34888cff519, 0xdb359692c2069efe, 0x195607e713f00960, 0x98120d3eb0b2edb1, 0xa2b65d6021779d3f, 0x246ad27c2,
+0x7e7117e99fe3b875, 0xcd0170da97b276ff, 0xd2be29201e2db59c, 0xff2926c773342ada, 0x77246ddcd6539683, 0x64e66df75054f596, 0x3c1fb5cf34e1dd53, 0xaf517de2a99aedf8, 0x82f2f10a5465e66e, 0x4fbdda60,
+0x304cf4b76ab11a1b, 0x208f953f547ba90c, 0x71873f293b99e97e, 0x724dfd2f2c38987, 0xcc0f77dff05f0cd1, 0xd6322306454c27a8, 0x5aa9598008afffc5, 0x409fb93c6de2d8fc, 0xea19d2d755780ce5, 0xb2ecd370,
+0x55e5fcac11404645, 0x5a25200f1cf46abb, 0x40d4ebfb8f426292, 0x805dd4e3f5f2a6f2, 0xc98345beaeb1b410, 0x72cf09e085d3951a, 0x1058a694c1ece44, 0x48c0d616411e6181, 0xfee4b140b40676a7, 0x1f10cde15,
+0x50d1adda159f1e4e, 0x8c737f7831c153a2, 0xa352d71bd06d6b60, 0x7487459eff21bb1f, 0xb09a6da6ae1ed05f, 0x6fa15088c551b5ab, 0xd1431191615cd05a, 0x71554e660debf141, 0x87a0646310e8bdb0, 0x196bc88c5,
+0xce0cf46bf7b5d8b5, 0x669d627083819a43, 0x5ae8c0209cf07989, 0xf89aff82a52d8542, 0xd3e560aa7b7871dd, 0x769a75b04e1203ed, 0xcec16d06f1c6b5a5, 0xa3ee180d12523e51, 0xcc4ba60fbe45cc6f, 0x103b0f628,
+0xd2e2934e657c7bf3, 0x7d388928c6721996, 0x4128c4031750b4bc, 0x30eb4ccae14943a1, 0xcb48ec84da840a6a, 0x4a67420868788bb2, 0x7b6483ee733233e5, 0x7001582a47734596, 0xf7ee66a9edc0d1c9, 0x151003bf9,
+0xbed9cc72b99ad94e, 0x5ec758981f04cb22, 0xf437dd771af1ca72, 0x2d3f1a012d937c34, 0xbb3a4d4f785a3d37, 0x65d9b921ee2b3a6, 0xae49ec4fb0eeefe4, 0x8d5285ea2314ad8a, 0x4876cb15f17f7ef3, 0x1faf46517,
+0x299283687d794802, 0x4f000aca5b3c2be5, 0x9705ac3057addb92, 0x21149d0a2c322ac8, 0xc82fbd6c92baa91f, 0xdedb988b12a98dc6, 0x6dcf981607dec6f5, 0x9ef57e130a2e9e, 0xe95848fce9e2f62f, 0xd1d0c742,
+0x748bf54552d7296f, 0x715b62981c0d13a5, 0xe948610ca6cff1b, 0x46b82b0c15f1656c, 0x9a8b8f317cabedbe, 0x881c42c806281ad4, 0xb9b99f1b1f2a2f28, 0x8350410e14e9ab5a, 0xa91980aac1d428a7, 0x150df1faf,
+0x64b4c6db39012836, 0x79d6f2d1d7707ab, 0x3952c2723b840021, 0x9b9d41860de1bbe0, 0xfa71b4bc53e22ffc, 0xdae1b5add24b7ee5, 0x7553f5c43247c6ce, 0x5c13bc7148c5ff11, 0x8d8b425620f7befd, 0x143b334cc,
+0x67e60bc0ac51cf7b, 0x3b89890d10c57e90, 0xd8c9d45b0f1ad0c3, 0xd1b7b582c5820ece, 0xf4436bc40f89d1b1, 0x346b1a47fa811fca, 0x79e32a7a581b921e, 0x70ad612aeae62dad, 0xca3ec4515fe91a9a, 0x19b696cbd,
+0x80c9bc37a8cc7189, 0xff52883aac24473b, 0xaacadc784068a5a6, 0xdadd4e4df3f935cb, 0xb6b5c85e26c61e29, 0xa9273d7760f3eb68, 0x981f8ce700dd12a4, 0x69079ece290a0287, 0x202a2c139aa25568, 0x52898ddf,
+0x9ee1871d4b1505eb, 0x2b7f5e957aba5b25, 0x9f988521a7cff4cb, 0x9ad806f05305ee74, 0x3bd1a68b5cad0515, 0xbb85ea5b153145f4, 0xd2090d7ee6f820f1, 0xca9f96a979ff2e00, 0xc319f9ce646454d4, 0xb876b62b,
+0x25fedec23a458a88, 0x1d898ff34f947bd2, 0x3534d6b8a385d880, 0xc783a93a2339a218, 0x49fd08f09406b7ab, 0x4fa8accc34018c58, 0x3269bd3d44724847, 0xe5e1bf48e7898100, 0x75bed9dcf235ec0c, 0x1bf548318,
+0xa966fd107640fce8, 0x1910383cc4dbace, 0xcd1162d62ae25718, 0xdce0a1aab69e5a7e, 0xb574aa5e8151b29e, 0xa5b657ef20ccffe, 0x4fbafae55d1b6475, 0x478c57fa021ddacb, 0x13986c846cf53d5, 0x1a0340ea5,
+0x4516ff4c29c6f03b, 0xb425ddd14eb5a53a, 0xed74bfea11f6db5b, 0x29223aa4529ebd60, 0x730f436410a6dd26, 0x4f1dc51576c9b8b1, 0x1779cefb73bb6fea, 0x9032b7ffc55f6626, 0xb2ac144d310afaab, 0x226265a1,
+0x459f37d0d4edb83d, 0x378d27ecf66ee374, 0x12518b0549bc073e, 0xf282e0c8688d49c6, 0x198bb9a16857588e, 0x76261d5c2cb955a1, 0x53902725a8c0f17e, 0x44bef871a11b8153, 0x376ec9aba5da0c26, 0x260bf3f96,
+0xdf9ec55727c8d7f4, 0x2159bc4fbf3448bf, 0xeefcac046fa43416, 0x28ce4b23dd2e4c53, 0xf621265709eebd9c, 0x97013ab4ce3f5783, 0x435a1b1fd1778f33, 0xeb53f6cb0b63abf2, 0xd427c98a2b3b4b4f, 0x2678d3690,
+0x6ae3a538ce37e296, 0x1a0dcd0f931c0c55, 0x8dc7bc998707980a, 0x6a7f31cdc017a9ec, 0x6cfb9ca848dcb60e, 0xa7da946df07df67e, 0x2efa3f38e17c6ece, 0x297b0049dc05a22f, 0x80a9040fce6d1cca, 0x13aa77131,
+0x8b5be58151e91298, 0xb8a94468d07e624f, 0xf4e47b0f19f0f502, 0xd5c0153dac71d798, 0x3b36be63adf586c7, 0xb559c63192b7dde8, 0x22e37f35f4d679ef, 0xbd23bccd715a578d, 0x4b1de0fb4ab1e195, 0x131e74e56,
+0x21191b55fcffee80, 0xd4cc8571024198e6, 0x887104eb63996e5d, 0x15ed880a2440927c, 0xfe2e99612960a3b1, 0x1b73826fa272fa28, 0x565c58628a014f9a, 0x2b7de81e5c644b4d, 0xb3ff9e33fda4c8d9, 0x1dcc9a287,
+0x846d0bd14c9c3461, 0x3f3917d24f787ec2, 0x84dde08e6e4cbc48, 0xe6060ce7fd9d07c3, 0xb1b96dba6db14770, 0x43966554fcc5bda1, 0x6a1931944a6d8567, 0x2817b7614ed3394, 0x50aa286b0aebbcc3, 0x261961229,
+0x8bb9676780cf7d13, 0x9e7d5639dd2334d2, 0x5edc0ea9aacda677, 0xb64698039e51ea31, 0x2d517e6983048966, 0xc30e1e570ddb14d9, 0xa6b76e0582a68d16, 0x3a588d1533e77eae, 0xc25fa0ef45e6996a, 0x23be188fc,
+0x32089a7783de3954, 0xdc03d252f2b6cc5b, 0x4aafcf170c74cbf0, 0x34ca390ccbddc63d, 0xcf6de49b2bb306cc, 0xd55ccf610e590864, 0x3fb52afeef752ce4, 0x4d3ae91107825ec6, 0x1a123d89d0ff287c, 0x2068bbe46,
+0xbd27282a072a89d0, 0x2ee4d21981d5073b, 0x2f964a8b894e84c, 0x3b0b4e15bc3bf304, 0xc1223959f336d2b, 0x5dd2b4c7eaed7ab3, 0xce025a9f23beb2ac, 0x8e7fb8d9059f8da7, 0x29086f45a24b3a42, 0x5f00bd68,
+0xfa82bbad9901a011, 0xa9ae913e394ab811, 0xee5a2e0ec32f85f1, 0xb058a2aa86640a1, 0x996c108b7b6c4d64, 0x3232a2b361bb237, 0x2ba3cdf9aa2eafd8, 0x547adef4ec4abc11, 0x2bdd25f424677f47, 0x252a09d63,
+0x6c35f4ea54317902, 0xab075b198faa9bb, 0xdf2b8f1033dfb38b, 0xc99fe69d020863e7, 0x98f8460e1b39fc68, 0xfd1efff007762612, 0x76245f386d2d7cdf, 0x36ef179812641608, 0x98065b1877144284, 0x12f5dd227,
+0x8a658b82e194f4bf, 0xd752d1f510447f3d, 0xcdde2a320e93f29a, 0x6ef5e5644bedeafe, 0x619ff36f3cf90094, 0x4d8c87b8d5040d25, 0xd2f214184a0f467e, 0x3764f1591f4106f3, 0x88a7bcac25b17c0, 0x1a7383ba0,
+0x7f5eebf3865ba51a, 0x31421f29d0ee5df1, 0xd9a6c6c852079e2a, 0x7a3c78777136d0ba, 0x63a71513516a08a9, 0x519efd08107a8e1a, 0x2a9c4fcd2199a25d, 0xe4e38a75aeea86ba, 0x1c44844ec0aaaaf2, 0x639ea5a0,
+0x444290d743f31c9d, 0x52dbbe3f8785c938, 0x411d5fe7dcf34e03, 0xea3b131144cbb409, 0xc631712599debef1, 0x7cc5e7fa9639b64e, 0xe3c1a65773b451bf, 0x9b11c1a15e9fff1e, 0xa41fe4707dff1617, 0x62e6797c,
+0x2322a4a37e9d792c, 0x57aa9c31dd8bcd44, 0x1ba8a22465af38cc, 0x7345b49566cb8248, 0x40f33aa52c43c4eb, 0xec0660ff0f28d763, 0x97afc8f6e212f5b9, 0xe2e30e383e548ca2, 0xc90d51f218e254ae, 0x1103bc101,
+0x59cbce1fc42c1d55, 0x54ef88d41ce784c6, 0xbec48c1939d9929, 0x6871e504380e3975, 0xa7fd008f9df81925, 0x50c0787ec0ef43a7, 0x4cd4b205ac2cd484, 0xfbd1daad05f03502, 0xc403dc3c2c3049eb, 0x16da39dea,
+0x2df6701816c896fa, 0xc9a36cb386fea85b, 0x49b73e84d90bc360, 0x4b8a2b615cadf05b, 0x58aff0b30a0232e5, 0x880bd48fd669f66b, 0x424495d2ba097b56, 0xe2fb9d0ffc3dcef9, 0xe363f10fead76fe4, 0x12182c893,
+0xa7df4f25eb52f227, 0xe4262d97bd44d4f, 0x36968a60ef4f74a4, 0xa3aaa1f9cac37310, 0x42599a251ad29e89, 0x8a77b5b3a325d053, 0xe9adee34ddf3fae5, 0x2bd2623c88668b1b, 0xccd85c2d12d89572, 0x12a39ad14,
+0xf96d57c1e8fc41cf, 0x357d5e48e1dad2f, 0xf267cc22e1b64189, 0x238ec830c4798624, 0x8f3b226578c6803c, 0xf3b536d9730f3729, 0xe12b1f5f3e0ad50e, 0xb0ebe40ef1fb52bc, 0xa27a9a08f121a5a0, 0xdef3413,
+0xda156ba1022c2016, 0x94d3cd02cbbfffc6, 0xc883f9c81685c14b, 0xca8fa70a33d6a304, 0xb3a03527d8b795e7, 0x1aab21c6daa1020a, 0xf65242f68c7cbdd5, 0xcc62cf309058cb71, 0x1e2440a8124f558a, 0x29e99e52,
+0x702da41299b3a0fa, 0xe4b19d196752e007, 0xc2ff98b851161c01, 0xf7872614b5be765d, 0x1ae6871c7ca01c7, 0xfda598c65b1af586, 0xe78730b49b2485ba, 0x13d365a6504b67f1, 0x9bf28deb316a03e8, 0x627f8014,
+0x14c42cbd72541892, 0x2e2311c91a1eb6e2, 0x41e008bc8cfe3088, 0x671225f232bced87, 0x283d3ddc2da081aa, 0xaf995275e2c2dcce, 0x5f3f4634ab94d6d5, 0xdda03f9dd84ebcc1, 0x386e761f468d89b0, 0x27ea0c97,
+0xb38ff3f0b9be001a, 0xd01c49516981f50a, 0xe468ce85d83a468f, 0x84ffeb4ec695ea4f, 0x50fb4bd027be7fc5, 0x54ee096b4d257855, 0x57905b3a2b45ba5e, 0xda134b30a559f2fe, 0x5d7e3a5d06f9e9, 0xa3fa5868,
+0x4084b160fda2f338, 0xf63916d1fa4facb3, 0x7023444ddb8dfd03, 0x279ad8fa75365c38, 0x760b3d9d1a382436, 0xffd9211c57c2acc4, 0xf652ef7dd79c3b51, 0x4d2088aec513079d, 0xb2997e68dc4a0681, 0x8a137663,
+0xf9aed477379d3ab4, 0xde9bca16414ead9f, 0x1f785f3d658efde5, 0x33006c7a281043dd, 0x17accd8461c39f88, 0x722464922bdabd7b, 0x36f3c8dc16cdfd59, 0xc0262c10bf4e93cb, 0x5d8ed9de553b62c6, 0x84652f12,
+0xd6cfbf3f31e4bdff, 0xe981fe064977b340, 0xd6895147a6f7a57e, 0x75afd2a42cbadc94, 0xf7361b26120fb7f2, 0x539d0501ef6a250c, 0xf1d8a9c5e9ddaa86, 0xdf25f91534538155, 0xb80c7ce1a0fc3443, 0x24c386a5d,
+0xd48cd8985fe57233, 0x1cef475edcbdafba, 0xb5da606b847e4cab, 0x22a131893848c463, 0xfcc92cfac6ee1017, 0x579a7af833780acc, 0x8ee220ab7f018efd, 0x558cc82dc1b47b5c, 0x666097625f5ca6c, 0xf3f39ba5,
+0xfe5bdf6077a95411, 0xfe33e3dfb61ada6e, 0x4c7f892c063ea98c, 0xda5e1c638759f1c1, 0x1aa2c18d0a29675b, 0x955a06e36a26ff35, 0x3becfb64c8bc40f9, 0xfc24462f6d0a383d, 0x1e5fbdc45199f143, 0x2fbfd8c3,
+0x8a45736fe15f21b0, 0xe78acf9e968534a2, 0x11df384e0fae35e8, 0xf7cd348a6f1986bb, 0xc64b6229a84c34b3, 0x83aeaa1f6e0ac24d, 0x6a002c9049a567cf, 0x5895161f683fec12, 0xf3a7d185c5e6d36f, 0x22b0c2210,
+0xca98e8283c1c628d, 0x7920e3dfd6ab511e, 0xcb1c7b0fc0fb0337, 0xdc7c079c7fcc55df, 0xefa35ef211fba110, 0x230bac2291bae145, 0xde8bf54c12e8b64d, 0xf80b4f7f10ab5baa, 0x132f99270af91638, 0xeaa4cb31,
+0xf2539b0004025c97, 0x9067383b3e48e3c9, 0x9b7e273562dbcc06, 0x5b9d97685b0aa91a, 0xf4891c5e9693c9f5, 0x5bce5ae2ab473f85, 0xb877ef2853c88398, 0x3c218321e2db0b35, 0x4239e548bad1d602, 0x1a92770a0,
+0x3289bde97b2dbb4a, 0x8146b14654ff36, 0x12a82000c25955c9, 0x94f3c6824334ecc3, 0x9dc04fd275bad9f3, 0x56ec1828ba1649ab, 0xfadbcb448dda6ff2, 0x1f57c862d616d649, 0xa6ddd8955b0b2d96, 0x328fa466,
+0xd0e8beebb0bb3a4d, 0x84c40e9b1654de66, 0xf418b68905694cc8, 0x36c5b98d18683675, 0xd523c6c3baa0bc70, 0x9c64cd7ea863ee7d, 0x6f1601fc1be9f88e, 0xbcdbe11f30f63f02, 0x85e37bd8b93793a7, 0x2060e6d81,
+0xe7c09c18430060c4, 0x681118d1c678f46f, 0xd386b422b0c4309e, 0x1e043b95c8f90912, 0x2519e9abba9b427, 0x5db7ead979de1aef, 0x6d9c27f33d386a7b, 0x618d961477f23e19, 0xb7f689ad9c3b1a5b, 0x14112a567,
+0x277d77a96d5b230a, 0xc0d566f05cb6bf49, 0x5fe05b4a1836948b, 0xac74a3c770af411a, 0xb82b2a20d89aae8f, 0x2f2683a8138f8e9c, 0x9e33545886decffe, 0x18a66f5e6f17d8ae, 0xb9b3a3925cba38da, 0x8aad0cc,
+0xbd50eb3700cf88af, 0x4e180a451e01f30a, 0x6faf0ba978094245, 0xc863f41b924ad82a, 0x6de12dd13871cb93, 0x628bdd190939197d, 0x1abdd8e86d6f0373, 0x850108c9d7f0f606, 0x97e4fb96533b320d, 0xb7cebbe1,
+0x8cf20337c592b580, 0xec03c88565890296, 0xe13f3010e2ddb6f7, 0xb6bb90fad51c4575, 0xc5ba0aea89c515cb, 0x26bdb875e9d3257e, 0x911c5b7ea135a513, 0xd04b41ffc66e87a7, 0x32a94d3e9e639765, 0xeb91b81b,
+0x2792618fa1c2f42e, 0x6367b9b491804286, 0x1bbb94d6b0fd2cc9, 0x10efe406f30e8883, 0x95a42fb9aaf7caf9, 0xd66e6f3189a46e88, 0xc1f5c7dee55f23c3, 0x3eda0ddcf5172231, 0xe2fffd556220e706, 0x1e3568f80,
+0x9c001f3ae525e72b, 0x591c19c95ce6997e, 0xee0aaa9978aa42dc, 0x14933d8318677edb, 0xdc3a5f27a76e0ace, 0xe05d1018bf0783f4, 0xb1c619c9ed42e068, 0xf79457326128c6bb, 0xf95cebccbef3d07e, 0x723ec421,
+0xedc1dddc5b54d185, 0x3bc3b109cdf79c6, 0x699b8fa7b6c1b81b, 0xc5b41bb31daa7dcf, 0x5498fabba80b415d, 0x971875e1234c98d2, 0xff26f91a95d6b4fe, 0x5724fc0230791c07, 0x93fa2533fc9ac602, 0x58cf282d,
+0x41d57808ddedd268, 0xb7b12a287246af02, 0xcc47fa66527c7268, 0xe0b968637ec3fd92, 0x5555ac3bcc3e5fb7, 0xb5e674a5b766d911, 0xef559eeb47a5ad9e, 0x23173f238025b558, 0x7a414e1d9cb96046, 0x11248d7f1,
+0xd9506dbb0be331ba, 0xb71e550fe1c5f853, 0xa064c814ab135ef8, 0xe4b7f89cfe6f6ef4, 0xc2004af02a136e0c, 0xc5f79f46d5303e3, 0x89804c5b6ca55a1d, 0x98bb93c99cb6fb67, 0xf860fd6673fc6d8f, 0x150b59947,
+0xfcf9967c8338bfa8, 0x5315d9ebb087a66f, 0x70bbbedc6847df08, 0x429f25bd1e80203c, 0x658a0d2dd4db29fd, 0xaa234e4c5b968baf, 0xd105826e9ce3628, 0x8dc50dd9c400e5a6, 0xe179f218e3785636, 0x2063bf65c,
+0xc04a113aee38fbfb, 0x573d5ad92f3365c6, 0x188c70073cfd60fe, 0x1fc8465759b42c7e, 0x783174e470b51e94, 0x101977226c59f334, 0xf5323ef2123e3e75, 0x4fd4db6eec976d99, 0x14d01f382a8913e1, 0xea292a36,
+0x1467a36ac0440d3e, 0x4a6707e3e70c9e0a, 0x1112e927f6207d57, 0xe5f03e74a50837d6, 0xeb10dd72e21aa14d, 0xd8e19575d4beb404, 0xdcd63bb0263d2504, 0xaafede65ffaf9adc, 0x5bf8bac855131f2, 0x9cda0807,
+0xcb92e000d074ca73, 0xff2c2320bf38ac69, 0xa836b96137104e38, 0x4cf19f19c51ae469, 0xadd61a31e8df2c67, 0x7f91fcbbee12725, 0xb30fc5d27daee0e1, 0xef23b9d6bf9424a7, 0x26cc901431d98bf7, 0x25f8c0425,
+0x7c91d3276d0885b3, 0x823364a24fa32889, 0x8dafecaa586eefe8, 0x2c62fcd521a1daa9, 0xee5edd86ed3541dc, 0x70ff7234291aa550, 0x67027a78af82c512, 0xf1f5707cb2257687, 0x1f9288072cc95597, 0xa1a616c5,
+0x8185d43d175abade, 0x14b064ef92b711e9, 0x9e88085599a4c8af, 0xa4ddaf2a111fc1a1, 0xffc688631ff99aff, 0x72a410e861d0f116, 0x384274b7b4e528cb, 0xc0a5344363f5927a, 0x2b4709889ac46f5a, 0x127916f08,
+0x8247a956086ce458, 0xf1dcff9e53045168, 0x2a5f69f490fd5243, 0x4e63d5d80375da1d, 0x989561516e4318f2, 0x4f3baf3551c0c9e0, 0xa54d44f3cf3f71fd, 0x2bf6b2fbbfc30424, 0xcdaeea80fb3e7e40, 0x1dc55db85,
+0xb1e25b760a13df7e, 0xbb3d59810e307b7f, 0xbbe1e7a448b33356, 0xf37e6518767de055, 0x74182e3ad48020a8, 0x2b97954539550bf5, 0x21eb7e71ac30ab42, 0x5aabf07a7b508416, 0x9853154c3cf39f3b, 0x1f433c7fe,
+0xfacd01b1b86af24e, 0xf1836eb0c72db01, 0xc3f40368785e377, 0xcd37130bd8eb7260, 0x922f75aa83e4a38c, 0x9059b9d93b48ab0a, 0x51dd5837a2d652da, 0x120749af3ac4c4de, 0xfc00394ddef45bcf, 0x892271b9,
+0xb4434b21df191c77, 0x917053a2ef68ee46, 0xd9477cccf118e88a, 0x21bb369c8d282de1, 0x2f60eb310ac4d173, 0x2969ca55469a43ee, 0x5e95f3ded8e364a9, 0xdbec14d414f50dc5, 0x2fbcccd5fe9af49f, 0x2516a7544,
+0xb6548045cbf8032c, 0x7bf32758a34560e, 0xe17ed51c2913be94, 0x3880541b01ae7fc6, 0xd7ce8cc6a64d15b0, 0x675fe8b90dc571c0, 0x54e55e7b01375c2e, 0xd3880e69ae4502da, 0x13c3bac6c1f4416, 0x1c24833f1,
+0x3edaa5f55bc82fd3, 0x50e4fc6c4e7db5b9, 0x9ca32b620ad53808, 0x37188913b58d6853, 0xc3dccdd600cf5d2e, 0x12bf38b8665e46d1, 0xd64917528ad3bace, 0x8b5af065c000784f, 0x3c970398aa3a2f9e, 0x1a099d14e,
+0x111988ba4b1e6407, 0x6eacc5ce1bccec53, 0x20a7821a6562da2b, 0xb117fbd151d59e5a, 0x493e3a8f9c41e092, 0x17a70e3c42b51143, 0x6e2e796de70a7d45, 0xd67ca1a471e007a5, 0x5daf17b947b0e31c, 0x131efdc1,
+0xc52695bd01d39702, 0x5bda529063abb22, 0xdf6b48929d90bb33, 0xb4e4ba10b6d1bdfa, 0x887b1fb4a538321c, 0x221fb779eb4e86c5, 0x3ef4ed3b3c9c9689, 0xc7e85c1e11e3a910, 0xff300f87500edad9, 0x4eff0dba,
+0xc8242523b9a3a39a, 0xb9680472a1e7c3ff, 0x4c48ca755c5f7655, 0x357ee435cafbf7f3, 0x5f3bfb872356961f, 0xb68fac76583e7f5e, 0x74f5427296b098a4, 0xd8ca0b61941fa08f, 0xa2226e26d30115de, 0x1826ce29b,
+0x6cb676a1fa70bef1, 0xa041531cdd9801db, 0x6e7d7eac88efbe60, 0x719a001be7bb4249, 0x6a1e05081c61624b, 0xa182dbf7db7de337, 0x136bf3663074a3f7, 0x15c418456664c933, 0xf6b1f2b5dd1778a5, 0xf3712620,
+0xe653472ee462e4d7, 0x6f7fc8f9cc1d176e, 0x44966a81e2353cf9, 0x2e96c6534518bee9, 0xb8383fafe8ccb22b, 0xd50255d70229a419, 0xa3f2a175b5633223, 0x18e7a850082dc95d, 0x18a4549977e4f454, 0xd7b71393,
+0x90657e4842235dc6, 0xe5ee9802321809dd, 0x1d7cb7b625685f6b, 0xa4568c9c6167bcfe, 0x96238560cc1f7934, 0xe9242035d7ec2286, 0x3454e0284fc216a8, 0x1db674227702cc5a, 0xad905cd812cb8864, 0x14127f5b3,
+0x9d298ba75af2ad7d, 0xf7f1a3185e69ba62, 0xe8d65d6eedc48f9e, 0x62c93204df72778b, 0x8c1e68cefb305662, 0xda3a9ff15cf09c72, 0xc50e9e67f9742760, 0x810328c7c11b4d40, 0x88f33129646dcb3, 0x1dda33460,
+0xa7e38cb58fea5416, 0x4de2470e73315e36, 0x39eee5fa5e4d10d7, 0x4d4d06e3a706e003, 0x924c2af986feb85, 0xe9ec9bad24326e3f, 0xa8e816c31e1baf2a, 0xcbcb6a44dd795df9, 0x3f948a0f1857b2d0, 0x1deec4863,
+0x7aecbef709ee65af, 0x6443a878186ac330, 0xebccd1930a1e6760, 0xa87c875eecc61e5c, 0x130fa0552e2b7c4e, 0x9f663030bffea45, 0xb20b61cb7c07cb5f, 0x89e3f5e0ae1341b5, 0x9f26fd3d7c8d843, 0x1fba1408a,
+0x3520e63a3a95afa9, 0xaf21824c8e1ff6e7, 0xef46a3f2d4864e8d, 0xb8a1bd27f011d943, 0x23cce37ff987f574, 0x42b937ba99ad2911, 0x63dd52a3a8449318, 0x534e7b0fdbb2e3e9, 0xa930f794e9409d14, 0xa9762096,
+0x95817dc8c3d35f0, 0x4fad003efb1ae4cf, 0xf76ccac58e63a3aa, 0x1a06325ef4e10816, 0x78f08bab32f36186, 0x356d40d8afdee9b6, 0x8433f9c5f4b338ad, 0xbc3d08bc509b624a, 0x3ac004deb6a09f35, 0xa72dd3c5,
+0x6ca7fd6a20f509bb, 0xdc395393980846c7, 0xdedcad2ce073b52f, 0x940b12b1eacd2534, 0x4f789cc11d81a66a, 0xbf2f58bb6ee5a391, 0xc284ae747f5874d6, 0xd9f6bb3dc5bdf07, 0xc41e74d4a7379dad, 0xe1283a60,
+0x5cb2facd4a5935aa, 0xff2bd67bd223f8c2, 0x8fdc7c481e6e867, 0x8103ac24b854026d, 0xfd5e8c43a8f5d1b6, 0x1236e19fa8a7ea16, 0x46fe25095f45261b, 0x460b5d7e77590230, 0x480619fb6c795e22, 0x17a774062,
+0xac9f69114a92a3a1, 0x569ecbed8b4a7b3c, 0x2eecf070bfa8407e, 0xbb60e2d6e580e2f7, 0xb339682d2edbb10d, 0xd9614808d284d34e, 0xd2b4c77ca86821c8, 0x9235f819a039f721, 0xfdff5f762313ae83, 0x5395faae,
+0x34687b3293fddc8f, 0xed0ab6f0202c35f, 0xe3e52494b0911acd, 0xcdb35db62411b1af, 0x3bee0300645b4249, 0x83dcd2e34917de95, 0xe3d8a8e931ec166d, 0x8b2ace0f137a35ed, 0xf6ad31a74a272ccc, 0x37a72855,
+0x56b4e1d51f0cc55c, 0xb2b3423f63d5a5f7, 0xd56e064e48efee2, 0xb9e4d6885604cd27, 0x973523261f7282e4, 0x7018b36b103b31d8, 0x3f4f314af23833ec, 0x6f799105c714891e, 0x9272b7ff784b34c2, 0xd643fdaf,
+0xfac66ed838dbca8c, 0xa8576a4bd2dbfc14, 0xcc0fe375e2e83b7, 0x4d627ca52822ef29, 0x3ead534fb3043892, 0x53056903c70818d6, 0xb6a501cc1ad5e66a, 0x472a9871b20108bd, 0xd2666ff0f06e063c, 0x256f6b316,
+0xbaf7fcf627cc3891, 0x6db7ae36fed033a8, 0xf43c4b19938b86b1, 0x569b8896aeb575fe, 0x93c023b645ea756b, 0xcbc0ccb2abc96047, 0xa3a67afec00c6ef, 0x26e94f65a49f69ba, 0x5d74685f66471f12, 0x74664c06,
+0x33bd8d25f8d1ff5c, 0x24687783c70573d3, 0x9f256d5637848a7b, 0x3ef0023e89d533d1, 0x825e5dadb8c0d78b, 0xdd4b3212e6413f5c, 0x2350296706adfaad, 0x59c9e426fc02dfaf, 0xb0c2b76da1b44877, 0x19bc61491,
+0x17855caa74549ef7, 0xdf1d9234b66490b6, 0xefd7932b1103fbb6, 0x594148c0c26086e6, 0x91d650ff851dd663, 0x1574e9d0c773bb10, 0xc726d23ddecce596, 0x23679c054cc20198, 0xb7172f2ad47730b, 0x1b249e800,
+0xad33448afc30b397, 0xc8bd9cc43e19fda0, 0x6e64f9cab5547690, 0xe10214385429bc8b, 0x2f5db533bc9ee660, 0x5922d8f502e4d3ed, 0xb025946d19764ddc, 0x615ae6cc0505749f, 0x78deac1286076d97, 0x10e494bf8,
+0xa13987d46da745bd, 0xfa75299acab59588, 0x9ceb69978a2c61ae, 0x3df3e280f871125e, 0xb64a3177b7154b40, 0xe39504712e705ce0, 0x3f10536acd9d6872, 0xc2233ad9636cbf0e, 0xe877153e4acf3c, 0xe360b426,
+0x186a82723332885, 0x366d010540a067db, 0xabddf7eee6aba38b, 0xa1dbf49a9f924207, 0xdf5bb7b0e760a1f0, 0xd8c4ba6b4b34305b, 0x1d66fc1219c582cc, 0x463cf54629e8ebf9, 0x7f9c7ce753d26cde, 0xdd53319a,
+0x2e5cde00757be024, 0x7077a269ed1bc27, 0x976613415f180181, 0x94ada335e1a04e21, 0x24bb9d43bb23ea7c, 0x6ed8edecb92dc5fa, 0xbc8d19c3768271a2, 0x57c9a211c527683f, 0x15d7b3c2a2401ad, 0x1c1db2168,
+0xd76b2dc77ca80191, 0xc071eb474c4ddc3d, 0x23ccc5b874a294dc, 0xa8bbf68ff0e76f34, 0x992d23b6ae42e41c, 0xd823a83b781c8562, 0x12ab0747d3253fb3, 0xe4c5aa1d42992960, 0x1ea033cfd2f41907, 0x18db0db56,
+0x48802b07de24c26f, 0x7d8b2ae8ca9c13e4, 0x501b37988056cabf, 0x48808542f5d31f4f, 0x250be82592d20ec7, 0x512f9b6de0337671, 0x765994eafbe8cca7, 0xcf071162e9c4b79a, 0xed429fae2c2ee220, 0xb83ebf80,
+0x6416e82a7171d2f5, 0x91747b4681ee5bd0, 0x35a6fb2c408092ff, 0xbee7ce591f607edd, 0xf7e7a90de6277154, 0x562d9d08b11520a, 0xf6cda736acbbfd41, 0xf4bc62e29cb894e3, 0x4e4d56e6ad95a04d, 0x1b3464926,
+0x71ea6f9e4427d0fb, 0xdb42e19fea69f6d6, 0x4184ec82608e2e1e, 0x143778ffa4e6e21e, 0xba9de9fb70a67d8b, 0xe35cd31355629d29, 0x5fffa914b660598c, 0x44a9bdda2d92f1d1, 0xedc5802335a8b762, 0x37a7db15,
+0xbf5beecf133f62b3, 0x32cc5ff48cce3dd7, 0xb6605bf072f98bc3, 0xffbd48f45a41739d, 0xb32753b7b28a8170, 0x9acfe33e83ef8101, 0x7f6affe156b73932, 0xc68aacadd0487293, 0xdb08986165aeeeac, 0x7234e5b3,
+0xd434b56cc58b8600, 0xcb6b575f03473431, 0x4f0561ad4d6e6571, 0x6eba2ed1cdd58846, 0x56c148362e8c5c78, 0x266213a76b2433c3, 0x8d9de4fb8c502182, 0xdb345bf446de3c96, 0x5c06df50c94b3b, 0x11627eb78,
+0x9345f06306ee9f7c, 0x7aa7001de4fdd396, 0x1c6c6d53ff2bd9ab, 0xbbd2f41d678c30ed, 0x3c49109d84dbdc5a, 0x18abfaba380b9371, 0xa48ea699b0c3b7c9, 0x4b6c8e7d59be265e, 0xd508823bba2b1b2, 0x1bf5f3143,
+0x802b13f83e1f7c67, 0x1c333aa83151efb2, 0x6c3bde56736b00b9, 0xffe9998e638088f9, 0x6b6b173dd94e9891, 0x258792152df5da40, 0x98b517ea61034794, 0xd175fba9c8fc3a38, 0xd2d0603b7ef090e2, 0x45d3e9f8,
+0xbf132f15e65e9870, 0xaf1f404fd3ff7459, 0x48468b79bc65d9f3, 0x1fd80b93d29ea787, 0x8adb9eeb2e598621, 0x9a05e3b05c825a89, 0x4a3c5e9b41c6c802, 0x2bb5ce95825f5164, 0xbc858baeefd61a3d, 0x19ca28d2f,
+0x6fa2ba3dd5347f5b, 0xca94ec87b0f03b83, 0x724cc5022d5d216b, 0xcb003c40132e6734, 0xc94255bb746cd228, 0xb0bf234615ca691b, 0x95acc599ea09d4a1, 0xca560644396fbed9, 0x8b2c7fd29c4c8e1e, 0x68ea4b5f,
+0x11cd87978ecc1835, 0x72f9953a8edc4920, 0x95475a9f0e7efbe5, 0x1dd733c06ae48970, 0xb35fa43cfafb73a0, 0xa6d1a5884caf4372, 0xb086371347600f23, 0x7d1e1ece318ff9fe, 0x3e22171a1189521a, 0x2538d2fcb,
+0x17ed6990d2f08973, 0xd053323b9b4a3c4e, 0x33571f858d7eb3f4, 0xec7e2b5dd04ffe85, 0x282b2279b56356a5, 0x1869215c210b6839, 0xa82c0a4dfa14d6bc, 0x5eb6afb36f7ba252, 0xa287a74ad3d912bf, 0x1fea37ef0,
+0x66a4bf08656b2250, 0x1daa07023a66d6c, 0xecfc2964c1ba9e5e, 0xd14ccba4b60bf021, 0xa95e799976e87761, 0xaf72249ca17c363e, 0x77289c404bd14a05, 0xc2fab98faa97392c, 0x2fa1a00143790cdc, 0x2669294da,
+0xa0d315f19bee277c, 0xf95aef1b3a065622, 0x415b2105b97fcfb0, 0xc5a65bfbe6f50e64, 0x87870a9a75c6c55f, 0x6c352e96864c986f, 0x60a72fe3cd84b0a8, 0xc7379a0fe7ac01f4, 0x1d1c464dffcf2031, 0xb79ba3e4,
+0x14ed914e25b77139, 0xc52e94ecf77d6708, 0x62b231a67f0910c1, 0x303e787a603d4420, 0x77054bad73272ae0, 0xf8a1981b64c7818a, 0xe5ffda44b010f070, 0xbd55e3cfbf76e04c, 0x6c86b3c583ce27e9, 0x2a00b0b0,
+0xe5f639616f3bf55a, 0x3fbd0e5de177ee06, 0x6520f026e794ebb1, 0x4dffcd903ff628a1, 0xf7b5577743c09079, 0xfb79cbbf084854a, 0x8fbb7c831847ce2c, 0xf76b0e0a4152d932, 0xe83f8405607020ad, 0x3e426a4d,
+0x19f75d23fbd4820d, 0x6b55099d17eb3961, 0xdbdc5a099670b92b, 0xf9cdc549b8b15771, 0x76c535a748240fe9, 0xdf031e82ae8cb568, 0x3406c3c1afd64cd4, 0x2415b7862ad3eac9, 0xbb62440f4ad3182b, 0xdf87a807,
+0x247207b3d34f5539, 0x8d5e9009e278defd, 0x8aa6d8d1fa45b80d, 0x4f60a8b4acffa89e, 0x13ae57f001ccc9aa, 0x1c662c1c574e7f0, 0xa090b7e8fdd8932e, 0x4e3b4fb2d392ba1c, 0x539b2e749cb3c4ad, 0x8feb77f1,
+0xa462a9041ef6ae9a, 0xc1b0ac363837108d, 0x1dfbfa2ebf0e6365, 0xcc94e4c7cbbb119a, 0xa88dddd1d2698d96, 0x42487793bd391cdc, 0xa4f784131c16c196, 0xc4830509ee2bea7d, 0xb929144f8e7373c5, 0x1f699b50e,
+0xf33cf58ca38a9e44, 0xe011593069bba632, 0x42868fa7b551b7db, 0x5f0eb01d3bbbfe79, 0xe7fcdb4b332c7621, 0xe3ae6923649b17d1, 0x17adf592599775ef, 0x574ee32742843dfc, 0x2d3ce54e84037bb4, 0x1a1173162,
+0x6708a4136d496bf7, 0xe44137bdebcad2eb, 0x5fce430c8a258558, 0xe1f05c091e0aa682, 0xc5cea1d38e947c6f, 0xa5c4c61ed9671b50, 0x699b6242399677a4, 0x2ddd4dfcf33980e2, 0x3bc317124a87db3c, 0x3912fc19,
+0x3559623be0a2a02f, 0x8a90068ce2262f35, 0x4d97173c8b9f1e62, 0xe70d651c4796f2e6, 0x23b62cce3e08aa8b, 0x815fe356158efc65, 0x94a9a46934779e31, 0xafc9a269b375ba6a, 0xe2687b5e148131a, 0x11c36372,
+0x17d506947f629708, 0xf70afa4fa21b6b8c, 0x6d2839dd5568be72, 0xc64e7e1eb3010fc4, 0x8f0125954df078ae, 0x6747c74cb0ec1a9c, 0x65e0bde6e86e97af, 0x53890ece55bdc666, 0x47a2ebb4d0d95d87, 0x2ea9c6b2,
+0x44e58f1671a6c1d2, 0xa81c6ee3ca0798d1, 0xa10d3e9e24b71e8f, 0x8330c0f891c0be87, 0xb5427c3fbeb1729f, 0x9f7de2f14929abed, 0x18e45dca865a5c95, 0x739771412202064, 0xcbd730e9d3af2723, 0x1d02784c7,
+0xee63f9f58b2bb60b, 0xfe3315262d5645fb, 0x81ca73a8921e0f25, 0x460d6b071d808112, 0x752e81166ec669a3, 0x998dea59d3e8b193, 0xe6477113ba93b5b8, 0x6a6d7f4c258dfa37, 0xd6c4fa694f90eec7, 0x1f9cd9521,
+0xf4240b6c3718a01, 0x656afdb8f81baea8, 0x672a8c5cc83b8bde, 0x8fe64ef8b4e30a17, 0xcb722839c35a222e, 0x4d0adb957e76ffbd, 0x9b5f7c1b34a1ecc8, 0x9dbf034c4d8a005c, 0xac04ce2a58be2fbc, 0x1728d7413,
+0xe8fdf650c5cf8872, 0x9334a79cc47d90a3, 0x5407343440c3d56d, 0x59d505c151899b97, 0x6036237a149f7005, 0xdb9d21d100ccb4cd, 0x24e2d3a2a27586bb, 0x3a7d048b232838dc, 0x8b20b4f56a26c00e, 0x1da892c78,
+0x8e719d7048bf8aaa, 0xbcd143620e5fbe43, 0x605d3cb4e0bd47f1, 0x7213b4ed7f4678c, 0x53946a91c833e6e6, 0x2c5d57329c63dc20, 0x35c0cc18cd1b516e, 0x308451eefd7a18ae, 0x25352332a716a036, 0x13e56eeed,
+0x9f6612d225ab7d13, 0xe4ff185c7248b3f6, 0xacb53a403bc901b0, 0x301428c84a8c85a8, 0x90c550719b70b0ad, 0x44a1845a1d41b299, 0x394ec65be7958837, 0x607cc86cb950efc2, 0x28a83c9795f72ec8, 0x1694965c2,
+0xc29b12e47997478a, 0x9ff0c5a284c4ca5b, 0x6a379cc1b9d94cd0, 0x4be8d9dbce763c78, 0xe3d70449e673df0e, 0xc841daf9df0c0f6a, 0xed8eba2dc9cd5501, 0x8faf54612f53fad1, 0xb9a6949bfce7c8fe, 0xda285f4a,
+0x32078c3f907714b5, 0xad277bc4744e8401, 0x6aead5ab0d8cd699, 0xcf96dc37d8436ff, 0xaf41422af9412c66, 0x9dd7f2affdfb8ed6, 0xb8d57e078f2fc0a9, 0xf617e5de1aed8cd3, 0x656aa1e65c1f826c, 0xf7f111a2,
+0xae4096a17ea2880d, 0xa3bb2551436668ca, 0x311249a8226469b7, 0xacc1ed57e216ea4c, 0xb5772f67f1db11e1, 0x18478fe39cceeef1, 0x677cd8b16b598b46, 0xf8c31c3149c4bd06, 0x5c4e5e01c7113799, 0x7d945131,
+0x8403e459d741afe5, 0x96845a5f8779270e, 0xe7d1f7c9ee52cbb4, 0xf9dc9db440c95dc2, 0x16e91a339d2ed0ed, 0x54572795298e0b71, 0x723e7f3b0f960939, 0x4c6460893a63883b, 0xce3db72851ef064, 0x1dfe3d683,
+0x9700364f886c6972, 0x9cdc3e453a628e, 0x38363deb78c42cd7, 0xfd93c25daa70630, 0x1dda30554e76318, 0xcd02265429a6df6d, 0xc4739a7dbcfda4c6, 0x22e65cc4ffa1a48a, 0x5f35ff9d89f1a4df, 0x64d53170,
+0x99ad679e92ac1067, 0x8aee38eecfc0166e, 0x81ca2c112aec0ee6, 0xd05569da1b3abeca, 0xe8c587636afac28e, 0x8f85505d6f409958, 0x8fb1002ac21fa0c7, 0xf72ff7757df78cae, 0x8653318ab7776d6f, 0x1dcfac3b3,
+0x1e9d27a9e8ef6b15, 0x1581f836ba477dcf, 0x4ec362a6d61aa431, 0xbc74e8e7155a8d67, 0xf51a01bf6ccbc0c, 0x3ff77d594877587c, 0xb8342ee9a4c5c17e, 0xd329071f3aa82311, 0x4997deca8dd865c, 0x27b415f27,
+0x2ed52c0226abe7c8, 0xb377aad08d759b81, 0x8f34a47702c52cfa, 0x4d4eda3e621acd9, 0x6cf0acf7af8b9d56, 0x7c9dab314fd5fa22, 0x5c52da6d65567349, 0xf45e92be81338314, 0x6d2f273a135e7eaa, 0xf623c811,
+0x81c772603ebe28ac, 0x8654f0da591a3a1, 0xbb66d14830cbe26f, 0x6f1605b1e75cecf3, 0xbf2a7afe451061e3, 0x391107cf716fd4cf, 0x27eae2e91f9ba260, 0x1b1c9ee213ccf6cb, 0x48dcb4dd3e4ee010, 0xcba66c5b,
+0xc70fa68c6c0452af, 0x39426f301473c5b7, 0x64dea9881fa90435, 0x2f494093fea40be9, 0xe85a8a9b1793ae8a, 0xff914fd5df7b84c9, 0xb4d96dd6a83f3afe, 0xa0b108365ba2183e, 0x27bdf528bce44bc0, 0x1d8bb676d,
+0x891b7477d9fa6d75, 0x4910cab57f62973, 0x1ccd730b017cddf5, 0xdc0da922302caf78, 0x3f57456d5d3230d3, 0x3d9a5454e8631de2, 0xb6c541dbcb2c5ed9, 0x5721675c08481002, 0xefd35bd1918df65, 0x1b7dafd46,
+0x554a535a59ec6254, 0xd2fa860014ce0ec1, 0xcf89cc64a9d04be2, 0x7f075ba0d4494433, 0xa5b0947e7a0e07d0, 0x6aaea4ea04cc987, 0x42fe2338d90e124d, 0x2d5351c37569550b, 0xae11cb4c3f691a5, 0x17732714d,
+0x1c5ba9c6b6251615, 0x7c3ff074d0e2409f, 0x2d0e9b9952e805b4, 0x869d23f1918d4f32, 0x10d5958c2f6f3b67, 0xe906a5672a33401b, 0x7f513414aafe525a, 0x1fe5e15a1cad74b1, 0x7d46f6238c303629, 0x1b2d58f29,
+0x545322f3f6fe11e5, 0x2392e2f0e4c675c8, 0x905f6f6b0b2d26d7, 0xc99c3439450d5688, 0xc0f3526d05b9a15c, 0xcecd47a6fdbad274, 0x14f9d90459f67cd8, 0xb120cc7864697d13, 0xa81239d8c68fc9b3, 0x1b50e2fb0,
+0x174a078015e20165, 0x907f0cbfe5a08096, 0xbc0027b3c867f884, 0x76eb6df9a3844b2, 0xcf8c86b15b794617, 0x5d0a2427a3938758, 0xfad04d8886bb6a10, 0xef56811867759c66, 0x5460070d7fc0024f, 0xe5ca34f1,
+0x6aae8ca5ba15e59c, 0x5cdc4302406bf32e, 0xd56cbf9cd28cb4f9, 0x67a0cb63a64e90ba, 0x69d6f56ab8dbce07, 0x1fa001da26be73c6, 0x521e0b14ce9d87ea, 0xc94e8946436176bf, 0x8c53a3b63699fd0, 0x128e8eee,
+0x2c47237aa7276e5a, 0xcdcede8b5e68000f, 0xf1264d963327d823, 0xdf5015a6cf35a393, 0x13ff17a2fa50e5f5, 0x9f43c1b5684693f6, 0x1f34e737f53907e7, 0x440c69c98b2db9ea, 0x96d5e601e82b6912, 0x2bcdf9a,
+0x6392b1ee86a6271, 0xbf20996db364073d, 0x9bd4a50c741d1b39, 0xd4903c8d02094c81, 0xc727449bdd013469, 0xf7649017e338e0ae, 0x17313ca6512d7866, 0x8d149ea516edb6b9, 0x54d11e2efaf0c976, 0xf285816e,
+0x58e9cfcbf29a3022, 0x6e06119b68599129, 0x52f26c0c891360ef, 0x3f68db1340b91d91, 0x55c7d9f72794d1b7, 0x6e7d611294abc76c, 0x4411eb9348190cf0, 0x33254d8db968d3d8, 0xeed7d0211d9258f5, 0xfa634da8,
+0x3ebc344003929933, 0xcd247b55262ff635, 0x72cae439497d56d4, 0xfe85f3bfd5afa1e3, 0x6d4f9ca8ab0bb85b, 0x9d252d40c4eb22bd, 0xb530444e1793cf38, 0xfc3edb97018cb313, 0xb401aa8703226f51, 0x6d841373,
+0xcd3cd3b172a41166, 0xe0e3cf5d419ffae4, 0x70ae8de04e25ddee, 0xc1e18af2bb4463b6, 0xbfc3d44de7578f26, 0x55ee0d85ae9b73b, 0x74d949b56a3950d3, 0x6552091b8a4ccc2b, 0x998cbef836fb24e7, 0x10b0dba4e,
+0x979dbc510d51cf1c, 0xf529162f6b9c6f09, 0x535dc267d8ab63e9, 0xb4a3bfac262779b, 0x976b0a020f631eff, 0x958d5b0da9f436ef, 0x90e9b9321645ba46, 0x74ec1a7488c918ac, 0x217ac74277db3bba, 0x4bcbe2d4,
+0x22476f27e374fba4, 0xb4666f7d84bf5643, 0x7fa0bbf6eb936df3, 0xbca47e68495aa493, 0x28ef856b11213444, 0xa199950f9f980cc, 0xcc31f599e26d8674, 0xc6a9084da23926a4, 0x67340f84fe5b1384, 0x1028489e,
+0x4f58a092cf7a70c1, 0x826a0d1b05d96a3c, 0x83aad5e883e9060a, 0x7c7ed8e4cb9d712d, 0x8127f6f300c474a, 0xed8897a69854e6cc, 0x6d2a88185961d43f, 0x63422ddf1848d5a1, 0xb504a683db857e84, 0x1c468b78f,
+0x5fd62a122c49ab84, 0x25cb810ae75f9ba1, 0x8d01ea9dd0802dfc, 0xd4f4ed52a3170939, 0x7cac22bb16a85b8b, 0xdb5709d774fcf671, 0xd1f45c4e19bb1878, 0xd4f0070e4aa9f8ce, 0x64fa9b934c4adbd9, 0x22f5ae204,
+0xdd2373367d47f7ef, 0xcdeabd21bcb11645, 0x12d92024e75caee2, 0x21d757bc32eac917, 0xfcab2263e8c3a7ae, 0xe89bdeefe02fcf51, 0x607bacf6141ffff3, 0xb29dbaf10bdcfebc, 0xbcf35617468e90f2, 0x19a6bd93b,
+0xe932b127a34b7db3, 0xb89e904200d51bd9, 0xdaa80b06b8c4a8e9, 0x4f4160bbc95f8f6b, 0x73dbff6d0dffa22e, 0xf3da92e1eaffbdfd, 0xe9590dd598e4e758, 0x6bf1743b3e5af08f, 0xbbff5c885d7b36c4, 0x1af6a5fd2,
+0x83680a533d3eeb3a, 0x68ffef0c9204aa8d, 0x9293e3f8121430ff, 0xfece13e1303dc11d, 0xf6c692949ba4c029, 0x77025359ef3885ff, 0x146c9cf6816f55b7, 0xe62a540fc0a1e091, 0xf5e77342a2a57278, 0x2780b67c,
+0x9beff43d82c7823a, 0x9df372967120a686, 0x20232f41888b33ed, 0x73eba6fd37f37c89, 0x567e735b788f5ab7, 0xbef514d3bb102541, 0x5ec919b2d0600107, 0xed3e23234acf9e33, 0x6847b136d79c2989, 0x2553c76,
+0xc7878fb02d887f90, 0x30a4886cbd3cec6c, 0xd098eedc7cae112f, 0x4b37baea0040bcf3, 0x992c1cc09bd0718d, 0x30c5eafb956bc33d, 0x90d132720c3cda21, 0xcebc72bfb099bb95, 0x2c9ffd200e2ef251, 0x2770c6a03,
+0xbacdbf57db23e21b, 0xff54b71f0d37869, 0x9323df45df40e89f, 0x8ddca2030c1d28bb, 0x5aacd659ae28c0f2, 0x64faca4b5d261af7, 0xa9d8684454c915e8, 0x1aa60a3028199794, 0xa1aec104e3232c96, 0x1c38b36cd,
+0x35ba88d3fd326a6b, 0xb84909f85b29d578, 0x85498869ee913d4, 0x3b1bf621fbf28fb8, 0x8b0c088c99cb6e81, 0xff909478b1f4e86c, 0x35fae9924486baa4, 0xeb00c23c60ca19e7, 0xaf1752f8b4d5d6c7, 0x3406b670,
+0xc827ed434d97b635, 0x16b77f69300b21b3, 0x71364c797308d39e, 0xfbc684cb22f6b514, 0xc1536d8145cb691, 0x1888d454f6add16f, 0x912daf21da3a5f95, 0x329d815fe20fd979, 0x1f53c63bc037a82c, 0x2e35ff51,
+0xdacb653c6db579bb, 0x98e45877fcb0c22f, 0x94e83898c66e9c1d, 0xa749df3ebf37eeae, 0x9bde350a30206f0c, 0x23ef242329ce8b27, 0x24fc7f186058e99c, 0xfdfd8d2664469458, 0x664480248a8dc2bb, 0x3f905cbd,
+0xe6da9065f3caeb20, 0x31acec1c048a739e, 0xe8d27745d8e4e83a, 0x3c2349872e6a454f, 0xb59102afd3e2ddc0, 0xc001e61ea2378668, 0xd31205dbee70d294, 0xab10a2dd118c1f5, 0xfa06a2e612c0813b, 0x1cb5cae37,
+0x6064ef0602f06d65, 0xf2f81921dee563c1, 0x7d4c20a24686a1a6, 0x8987ef725505ecda, 0xdb8905b10410a72c, 0x13bad7afa346c1e6, 0x2cef18d0c675d47, 0xf60059e6581ef7da, 0x2db2ae579183d21, 0x9a70e526,
+0x2a91efa64716de20, 0x6a9cafc46d2711b5, 0xcdb4646abc19e258, 0x638c4eab811e69fc, 0x4d986e428210f515, 0x5f7f0a6c74c88df7, 0x9291ccd4ca4f2d4, 0xaf5dba8abea8a34e, 0x578d6b4793903725, 0x8dad354,
+0x3bd31da581ab6281, 0x513e540fd7e5335, 0x3d4c8cdc71640b57, 0xaf03f4228ce74d97, 0x44ee085bf1c42c8c, 0x5ee5aafe2e1d5d55, 0x571cc3c4770fff8a, 0x6fd386c830651d8c, 0x20f6f2a7a9edafc7, 0xcd8634b,
+0x8a14b2a9313be7a1, 0x833ff0202bbe043e, 0xf14d4f8a6fa1f9b6, 0x87c2310754eee55d, 0x3d70fd2408480114, 0x10961c8e97a55d7c, 0x18fefd8101d0f15f, 0x5d9c643187018a3c, 0x9d7e616c0a8d511f, 0x2590ddf90,
+0x59ac8511e325051e, 0x2f0384de44a29f7b, 0xa6f6910a9d06d75a, 0xa2b259bd161ca349, 0xc76ec5b373469848, 0x12e13a9e4d14c4f5, 0x19f83f93bfc4afcc, 0xfcde858cb65ee17d, 0xf74543244201a6ec, 0x2217be914,
+0xa3074ddb9c7f5031, 0xc4168bbaf882bbbe, 0xb679c26ee9c2bed6, 0x6c6d406894608895, 0x8af1c9272fda9166, 0x5dbf1bbf987d3073, 0xd15a85c6e833ca41, 0x9ef0cfede7993531, 0x8f6cab39b0d01db6, 0x9acabb37,
+0x246c9f5b3727105b, 0x7f80ae3ba8b4bc55, 0x80bc9dceb9d9020d, 0xd9656d2c0209a5d8, 0xf02de5d9d15f8922, 0xf16913f3fdfa3040, 0xf28a58c4a21e56b2, 0xafc7851717c5c5e1, 0xec90a13f6d16ad50, 0x275f19c5b,
+0x77e0390e044599d8, 0xa323d1f16bba32ad, 0x8343129ece95fe0b, 0x8281839b5e17683d, 0xb027b83f8d01ef24, 0xfa3fcefadcff2001, 0xf7604cb21c6d828a, 0xbd554a5e8eeb65b1, 0x61e6e99442317e6f, 0x463e8b43,
+0xe3a410f9d2d03e68, 0xcb37d0f351b7ec0a, 0x251f07641e45326c, 0x3dd5e1150e72ef2e, 0xfe6f6067a6e3983d, 0x6c15f275832fe35, 0x37458c202809cde8, 0xbcab5a366cd9626f, 0x1e9336ad14f1ef71, 0x6321abe1,
+0x1b333d41c3a7bb12, 0x62142f8d86006b41, 0xab7c3c684e71ec4, 0x1f0e3f20837fceb2, 0x881aa781f4cc7b8b, 0x5cb2d6207973d2ad, 0x64d9c96225e7b186, 0xe6dcccd4d7b19e4, 0x3fa8ba38bacee062, 0x10849fa99,
+0x4c741149d09bec18, 0xea75b7903b60934c, 0xf76002f8eeb36149, 0xd7261bcf672ea186, 0xd3614528bf0b3ed4, 0x730882f8dd1f0dd0, 0x317f665293f4813f, 0xd59cc03afb3403f2, 0x5a74ac30e39a385c, 0xcafc54cf,
+0x965c21de1142f37b, 0xdc7f76fe4c450b98, 0x5089acbf9d144495, 0x8f5e4bb5ea2a18ae, 0xfab128eb53675fa1, 0x4491369888b9b43a, 0xa164ec0dfc265dbb, 0x1b71c59b15e8da1b, 0x9f4d99c3d4baf97b, 0x4ac5d1ff,
+0xb13ce52f842de584, 0x969501ea8e8f880f, 0xe09342e6bc58838d, 0x2b415502c9268996, 0x16f6f63baf20d334, 0xb11e6cbec9403b8e, 0x2332a52a55d28c82, 0xce0076acc716d20a, 0x7a5ea5dc8854388c, 0x25473c773,
+0x75e1cb199e14e7a3, 0xdea379469e15fc67, 0x2992cfcbb7aef410, 0x38e90d9262b69944, 0x10741cc956758236, 0x150cce7990bdf7e1, 0x30414ff2951520d3, 0x16cca0de60ef7362, 0xb31665c88eeb1e07, 0x24f4e8750,
+0x3727cd1fb5d8d9c1, 0x89872b81b33493d, 0x8819dbe6d2954dab, 0x9da4899faa2bf7a, 0x2ef85e1ee24765d3, 0x6af133a26c076bb6, 0x2ab10d7f9a4efade, 0x1489830a0a79cbe6, 0xa3298fe49e84abfb, 0x124a842d5,
+0xb268c9eade80b6db, 0x8e5a81792c5ca6e9, 0xd3226f2a3d299f42, 0xc3cea0ef217afb49, 0xce428c2eb2fa505e, 0xffd2ea1c61c27802, 0x78d05077e10c7433, 0xd55fe181d64ce9a1, 0xc79b6dd34333916c, 0x4deac495,
+0xd56607d1975abace, 0x6b791521c02cbd8b, 0x89deb762fb79caf0, 0x859296e589d3c5cf, 0xf1d45e5879c379d0, 0xc07c2fbe59fc749c, 0x76568f452c80c89d, 0xac1126aa1177f0a9, 0x646f4d16f0284569, 0x10c7c48ff,
+0xdadb482ae675c927, 0xc13cb68a3336f87b, 0x2fe7692ddb2b5d01, 0x95650f9ce3bfb3db, 0xe8d01ad2d59230d7, 0x15921749d9663af7, 0x6647081ac6b004ea, 0x919d45d4386c8079, 0x98ddb55f623ac676, 0x2cfdc5b3,
+0x158925866efcd1fe, 0x8784945bd0e50c98, 0xf365970d3d3760b1, 0xc9d59eed8a1c7f50, 0x4dfbbc4dd5fb1a89, 0xb9a7b8ec644492f9, 0x4c589689fa666dd, 0x13f6f6903321d288, 0x27bb8a1bd2e311b7, 0xee86c08,
+0xc19cea41c09e1903, 0xcde29c8e64da32f8, 0xab5e9896cad29866, 0x69db0fb480576c66, 0x539ccf4891402e2b, 0x8ce6ae77a17a9855, 0x429efdc40e3c1545, 0x2197d19af975891c, 0x59c873bd06f8d745, 0x16e113d57,
+0xaa47e54c9c46fce3, 0x90f592a27abdace3, 0xbeefe81862881022, 0xf46cfd4852e30e, 0x4ad0dd8818e6a419, 0xfb4e7c003f5b303e, 0x54d76d44a4d7bd51, 0x3ce58407dc53f338, 0x9861d89854c40d6c, 0x190a8fe5a,
+0xb057b68d510d89ff, 0x74da3a30f7c8d631, 0x72de0fb1018b32f6, 0xf2da482f0912f073, 0x50bb1d26604a4277, 0xdaf9507978be5cdf, 0x7405d1bb6293b9f2, 0xbd13b740f3582bab, 0x7d279e4d795c1b3, 0x5a55f322,
+0x3bb143aa00b5cca6, 0xa5fee7beb063b01f, 0xbd53554e7ff7203e, 0xaa8cf68b4da04c2c, 0xc3a67be1901e42ec, 0x656101186d6d63f0, 0x7383e7c747f333dc, 0xce934bf73ea25c4a, 0x9c550b1d39f45740, 0x18613b2c7,
+0x91dd44a3f925fde1, 0x1bcc5f9c247f30b8, 0xadf987538f52153d, 0xa0589338c4cc14d8, 0x1675d39cab8ff256, 0xbad275c56d020b97, 0x1af3db8cc9c3970e, 0x4fa251e3505b4a86, 0x74f2d15c9b62eb2, 0x19e763f7,
+0xfebdea63a7efc923, 0x51e19e25f181d582, 0x504b22ac9892d233, 0xa03098a5218a80cb, 0x36d91b13f8566ad7, 0xb1b5c0ad9d6805bd, 0xa331e3b2b7c5853, 0xf22c700f8210442, 0x8b00546d420e7ab1, 0x16c563e,
+0xfab1117f1aa8d861, 0x6ee9e88b2f8b1019, 0xadac602d73847f64, 0x763d15f3df2d940d, 0xeb6460053201d865, 0x569846b521096ba2, 0xa70acff33cb450fb, 0x171cae9da3ff887d, 0xf2404ca6afc1119a, 0x15c60f98e,
+0xd63b664eff7d89e9, 0xef04b55ad174e4f5, 0x31c67502d9532804, 0x3a2093ec783b8d95, 0x793f3e89ae77e896, 0x2f08617421befeb6, 0x831fb03d0e927cea, 0x1f402fc273a2db63, 0xc81ab176f35d02b7, 0x2669acebd,
+0xa22500f880a8a98c, 0x1f1ebcc8811c32a, 0xaebcbfe7f3c90482, 0x9261de9b286fdce8, 0x85ba74f9433e3b41, 0x51dc644ffd6b85f2, 0x7ca0d2234b292382, 0xf9ed82845cff500e, 0xebe785170a552e0e, 0x5522c1e9,
+0x1524dad594a6eabc, 0x8d467ba63d93bda2, 0xe8ae693f955526b2, 0x4fa111fa9608340c, 0xd9947c00308ca013, 0x404758356c9f4797, 0xdfb66fe268dc21f4, 0xe8bd93d1a9b2a184, 0x989d5f29a00c360c, 0x181ed2e27,
+0x6879dc7ceb69f420, 0x83754bc1c7aad0d1, 0x8c59982a6f8de83c, 0x4c28d6977580d246, 0xac5f2e3d31b56086, 0x7db17928a29914f2, 0xac680546a327d8, 0xead65845b1911474, 0x4e84bdecc309cba1, 0xb913e361,
+0x20a869ae5ea04a86, 0xefefeca7588cac6f, 0x7b60af07b2dbdbb3, 0xfec96d8f06dd9b5c, 0xf3b20dbfbace42f0, 0x510b683301b425b9, 0x438290ee7999f508, 0x9acbe68ee4bbe8c1, 0x9c2bf6b52b288348, 0x6d85a7bb,
+0xfad783acb9b21ff9, 0x473b530f39cde748, 0xf564f0400b29e199, 0x2ef424df5299df, 0xe103eacc8c1542fe, 0x81b9716c85e74daf, 0x7fa90e07b2356981, 0xba9d8a5d1d965c67, 0x73ad93af54cba6ff, 0x1ae82b0,
+0xda5ee0cd476fd5d2, 0x2ad655c58e931e7c, 0x84cf1c34aa0e5fa2, 0x2fdc8a42984a0bfc, 0xecf3a789330dba8, 0xd04b7ebd20d53588, 0xa97fb658116665cc, 0xc0be71e7ca866c5f, 0x15c337a09afcd980, 0x146991e1,
+0x8952ba6a0f12153e, 0xf7b37c3ba4c3812f, 0xa02d18f6a15c1bc8, 0x5f767f48f3778008, 0xbc7021ec1cf16383, 0x1e2df7749a0f657f, 0x97ef5074ac18140f, 0xd3f30f7be8d08a5e, 0xb95bc5ea24ca6fb7, 0x245bbca70,
+0x8567fb0abd89b5c1, 0x5a6007cd343b3dc8, 0x46524a2086cfef95, 0xba84fec0f95467c1, 0x69fe80df4c0f42b8, 0x80be039102a8c167, 0xdf31639bf95c3ead, 0xb7d30b42da2fe547, 0xb369ef5b55fce777, 0x21afa8079,
+0xceb1c85eee6ecb65, 0x3353bc5a87fc8058, 0xbc15c6358c39f5a0, 0x98420d382964cae7, 0xe135eb504656cfd8, 0x5164101acfc052a2, 0x9ff37f37f6f86c68, 0x20d41e2ef435933c, 0x8419b714e7c21562, 0x190a53d6f,
+0xeb13a2d17f08df48, 0xdd9aa83ec5467790, 0xce2b7de7862ca900, 0x6f4145043a9b6625, 0x103d6a0ebffdd5c6, 0x90b86145041248d5, 0xddb3e0981f46d6de, 0x3e704b0aab92b19c, 0x545ec7b3b4226016, 0x270f2b549,
+0x96d84ab33907e499, 0x3dd53f9265071187, 0x99f7919cb6093cc1, 0x5848daca08d53169, 0x8390a278b70fe157, 0x1b5689bfd92f9989, 0x6990bc1addbd4b67, 0x9a1e03c6552acef5, 0x380f065b5ffad5e, 0x16a2db026,
+0xfa416ad5a946bee5, 0x6c14bee807a3ba6d, 0xeb09a015d61d6f6f, 0x365f1654f75e88d0, 0x493cd92b14bf91b, 0x32d1863219dd9dc, 0xe5ae56348620d8d2, 0x8b219552ed5069cb, 0x7e27e319e7273133, 0x8e114734,
+0xfcf0dd22e91ee6c, 0x52f25f408e4be6e9, 0xe955f1277cbe6d95, 0xc2d019490d385336, 0xb90052b21c6a6de9, 0x5f77fa1eda7694c5, 0x1227d4922dd2742e, 0x2a9f1ac4997a25e4, 0x3d69d791832e97ea, 0x154dc035b,
+0x775cc5140677f524, 0x9d4a3040285b7a9a, 0x1c37b34027742680, 0xf8e197f396df07a0, 0xc7d56237fc621ab0, 0xf39ec8d2357c73f8, 0x7d5829281dc52b89, 0x8f0209611b1658c9, 0x37b22b868c89e475, 0x22b1004c7,
+0xbad9aa33715b6b2b, 0xaac9f0909bb12559, 0x1460523c22750126, 0x79f63602dcf72067, 0xbd7c82f835ca6272, 0xea953065b7b23f83, 0xaaf556cb34d3f3e7, 0x31a9a9f5c5e80c00, 0x1298fe19126ec763, 0x26f48ea34,
+0x9d121b3f3d608fa, 0x8f9005ed96c519e, 0xc82b1842e62e80b7, 0x6306f46f6d025bc6, 0x75205a54b20a7b3a, 0x9541520528e56388, 0x485ec4f24a44c1, 0x340687cfd69b43a9, 0x8de238d3b34afaed, 0x25860007e,
+0x753cd70fa912ab22, 0x9a9f3b1542621b42, 0xcdd004a2fd2083bc, 0x1524e90e83783cf7, 0xff88d738d14eec2a, 0x5c6a3144949a5a22, 0xca891bd95638b3de, 0x8e64682a7d6a3045, 0x3f28be71d5a5f4a8, 0x1126389e8,
+0x4d4afd3e2124e947, 0xf768078101b6666b, 0x82581d58982106fb, 0xc87effefd7f235d9, 0xe7f09cd5a342f4e3, 0x7404c5012f47e6e4, 0x28bb30f2d21f8105, 0xa614fe23656fb2cd, 0x324d20c033daf9de, 0x67b95dd0,
+0x6a4b3ff8caf75298, 0x8e99af54adf08ccc, 0xf2f869136ce4848e, 0xce6d0482cfcdbd7e, 0xe91bb67e57395dce, 0x8cba9a87d3cc9b81, 0x2d8cccbce3a30c1c, 0x379bab7894c37d08, 0xd90a8c3aa70f06d7, 0xf0db904a,
+0xda06c0402dcbd5d6, 0x51126e75a5a2bbd8, 0xa55860c0ab96e6e2, 0xd0fdf5315f3c3f8e, 0xeef6d748d0edbed8, 0x6796e781ed70bf71, 0xe1413fd40d05c0d1, 0xb2f08ea1cd83d739, 0xcd9600717027c5d, 0x20ec52c5c,
+0x160cf85ac3533851, 0x7587dfe7bfc86928, 0x9cd5f2d3b5c545e4, 0x84bbbe370c6e8fe5, 0xba18680b68bdd4e1, 0xeb7546190213b3a3, 0x2ffee015570b1932, 0xde56e70159589576, 0x839c4c31f617a38a, 0x1e535413e,
+0x592788cedade3f3b, 0xf26b19f653e9f012, 0xbf1da3427785becf, 0x61bbdbfec9faf433, 0xc8951e13f1207fe1, 0x6dd3a99b16dced8f, 0x3fa77ea7210b85a9, 0xaec6455eda1ee1b9, 0xc639d9dd2f4b1b8c, 0x416efc4a,
+0x95797283ac79fc67, 0x97e3f9c35702472f, 0x6872edd32b60dacd, 0xb03d26b1b6170769, 0x7fee60a8ecfe8fa2, 0xbeff3ef980fb723e, 0x2e1ac9614e5fc1cb, 0xf7e29b1f0f075f5e, 0x960783bcee07d9cb, 0x1fc98e24d,
+0x79ac28eb03f087fd, 0x26a2dba36aac3386, 0x8f3370cae91c87eb, 0x51c49a6ceddb0fbc, 0xe42f33fff53dc5f3, 0x7cbcd8f24d49d692, 0xc1d3379ed61fdd0b, 0xe453e78f8b772541, 0x595084ba9744e8b7, 0x1bed8ad2,
+0xba297e57eb0a8493, 0xb585d08f76e852d3, 0xad693bb4f94531af, 0x976c21515de93688, 0x4426e61ffe30ae5, 0xb87232d1f1b86150, 0xdc958e23c12029b3, 0xc75c96b53d04f0e4, 0xbbde92c8bf182cf8, 0x240cfae3b,
+0x68c8302aee01e2e, 0xdd66c1b8fcf8c66f, 0x63b8bf27c23f5adf, 0xf21bd0a9e61741f6, 0x7d79168c8ab4dcd1, 0x16415e8a27c5a972, 0x7169ef4f1f7b9718, 0xe88d87e4d9fb2659, 0xacc23334bc63998b, 0x51be5c4a,
+0x1f02be1b7bfc3515, 0xde59b8442ec3696c, 0xf62f58a54b6192c4, 0x6c0cabf44aeadd59, 0x435dd8739f740e07, 0x9256b60dfb568daf, 0x364256bcbb978f99, 0x462d3b91a5af7384, 0x8ac85c4d9284c5f6, 0x24cdb2b18,
+0xa67623792601272f, 0xcfc68c18aa7cb351, 0xd7aa91c96bad8632, 0xa61fd608df3378f8, 0x175cb1ffe251413b, 0x786dd94522befec4, 0x150a203379045657, 0xad7b27718d0afa92, 0xd780d8274d8bc9f1, 0x1b534c2,
+0x3c89dac7ee6ae9ad, 0xa1dc80745c53dd9, 0xba72e18eeeabfa41, 0x51de260b089335f1, 0xf0722908117147b9, 0x4fff35def3324903, 0x3d0534b77f25bd18, 0xd7a0c3c563133db4, 0x21039d07da1c325f, 0x358c87ad,
+0x42108487843a94a1, 0x6dd2443a3047d234, 0xbb1370480ecfc79b, 0xe3a282e529411e50, 0x36da9bfe8515ae0c, 0xf7460c6e9bc3147e, 0x6aedd34f083ebe9d, 0x3cfdaa5b5e7e306b, 0xacd95d1c82321cd, 0x7008312c,
+0x2f9d18cf4312ee39, 0x4e1b9463fd365c1f, 0x3c24b75c56179167, 0x28d7d19e3dce2de1, 0xae013b5407d854e7, 0x65e4affe439a3b90, 0xc1d5ed6d08b3da9, 0xe1dae0640c2a8743, 0xde96cdfba444c658, 0x24ea5196e,
+0x9fea12ec1f83ca9d, 0x109a3cc2ffc35e67, 0xb59b75757e9be799, 0x3d19996c286af0e8, 0x9479542ec84e47d6, 0x58bf5c05657ec0db, 0xbc179e31615a80d, 0xd4e31a66c71e5cfa, 0xfbec704aff7d860f, 0x1f248edb,
+0x8cfa8820ed1df24e, 0x5e1d6c729457fbcb, 0x801778423bf1f61f, 0x5b0146e8a5c220ba, 0x4bf2e96a3d5ff49a, 0xc7ebfc774bae8505, 0x3a6b0c3be42a8800, 0xd25197a3de7041d4, 0x1535e88990708cad, 0x1de116f9c,
+0xd52e72c89f3c90b6, 0x858dd8113a4dc505, 0x9a51f6c7755fbdf4, 0xcc8652bc2cfc86f3, 0xce955967b650427a, 0x5b45ac59339423a6, 0x10fa37d41423b061, 0xcfea22365ed08cb4, 0x18ff6ff615898e33, 0x51a86327,
+0x6045b02839349fea, 0xe0809e8518347d7c, 0x65d16536e3edf3b8, 0x7d2ffe0300264142, 0x25901408c06b0961, 0x9562395fa0580197, 0xa3faaac999d06b93, 0x4b7c84547629ea05, 0x7e36d6a704386475, 0x15e794318,
+0xe775275b2492e013, 0x64e181a86cfca8ca, 0x76c07a30b8f4f315, 0xe07280b12e08912a, 0x67aeedc0889dbd31, 0x73227b9d097350fa, 0xef9e130fb9507fd3, 0xb2d8da74d4071e20, 0x111762b2db6f8be7, 0x1fa52e55d,
+0xcb32c60462429f62, 0x797c8e9fbd8e5b69, 0x90659d59289d6e8a, 0x66c083a9a2cac8f5, 0xf142988cdaab4658, 0xdf45ec9f8a37ea83, 0x17a6a45863eaf5c8, 0x125b98cc7551760f, 0x7796f368fa7e7186, 0x248c460c0,
+0xe3ec3dd4ede1732, 0xb1c6c876c1b97a3d, 0x9dfb40fc07a0e836, 0x81ae84909af6d6dd, 0x185d671f1654dbbf, 0x28eccc15d43a2ed5, 0x812c1ec9752599d2, 0x27642fbc6f5c703, 0xec81825ada3d73f8, 0xa1a225b1,
+0xff4387e0baecff4a, 0x708b2d8565ae231d, 0x125da750cf923ca, 0x8f623cb7e98b5374, 0x30d32bfa4a3ea7fb, 0x8b2089e4a18ac4fd, 0x2ff7d2b6b325a715, 0xca322678d8542175, 0x83f62a742c71dce4, 0x1afdf04fe,
+0x494dae81fcbdb90f, 0x2199ecb50286b05, 0xdccbd0c141c45326, 0xdb2538fd2778c836, 0xf72f9dfe6f80dc7b, 0x5fba9f0d7cf004e4, 0x77519beb7bede57c, 0x8a03f3946af18404, 0x3016a771b761565c, 0x18ffd126b,
+0xc0d75df9b4730b9d, 0x46bba57799b1369f, 0x9900557d0cb44cea, 0xd47e5510af14b80c, 0x9e49ef64e5010b5f, 0x64547993877dc205, 0xa603358516d02fc1, 0xce4c5c2d569ebbc6, 0x92c8e92fa21cdc21, 0x1f96b258,
+0x98db0f4e4dee86f2, 0x2df64fbef178c0e4, 0xab65d57b1846f257, 0x31bf6a0f3cb8b488, 0x9f5deabd309aae8d, 0xad3f90fca26734d, 0xe2234e8302be0f1, 0xb048fdb7e1f6126, 0x4925ef4b09624f11, 0xe42bb495,
+0x45d96ffac68b559f, 0x1c2be24bf4731d3d, 0x5f9b0430639840e3, 0x7e7396c4e9fafed, 0xe6976f30de811713, 0x954a5e1a9df49d78, 0x48b2b59baacd67c4, 0xd54af2613a4da3c6, 0x26fdd736d5612c6c, 0x21ea3744f,
+0x1e587d482adf8081, 0xe6250828a6667ce9, 0x742174c057a3c295, 0x8df64a02456547e5, 0x12c17af6f49e60d8, 0xcf1b291c9bd1a3de, 0xd345765ab4269f17, 0x242373754de3aec, 0xc8313018104c67ef, 0x3d795d1c,
+0x4b65cf031447933d, 0x11250ba88c00dee6, 0x18c7fea9fb7ea5a3, 0x8d2eb109fe64510a, 0x3c501164c6264f74, 0xbf3a6484b0cc9749, 0x1c312d725b1eb128, 0x67be3fe0b533e9f9, 0x98212d27cf3b19d4, 0x18197bf24,
+0xc1d7e1331dd8f845, 0xb889987e406aeb5c, 0xd29607737cfa65b1, 0x89861500f70339c1, 0x74f3c1f65a7d18bf, 0x3914a85ed335082e, 0xc9a045405456f018, 0x1fad9f99fa22f6d8, 0x689131569e27bb50, 0x146137131,
+0x620df701d7bd9fe6, 0x83a202c7a9e1cb90, 0xddb3e7f5197fecc2, 0x9b18443c8ba565cf, 0x1f7cb6ffa4056a7a, 0x51555fac2213a9e0, 0xa39a95f267d1fb24, 0x73441a5345a4527e, 0x2b3ee313ae25a297, 0x264ae7ff5,
+0x911ba6f8abb581c3, 0x9995aee6626dddc4, 0x5779db60f65dccc2, 0xf42fd6d8787cb6e, 0xd9bde6fbf1a8f586, 0x2aa91d9489aed57f, 0x48435e750b22df72, 0x42f8fa9b0fc6b11c, 0x9316e5dac02cd8c6, 0x26825bf20,
+0x3364173e77a5c1e8, 0xb8e4172a1f766c1d, 0x5275aca0e3ec4f61, 0xb0fb0f22b2b487ec, 0xc5bdd9f6264f3ec2, 0x776cd954622f131d, 0x808c3e8c0692eb2, 0xc1c4db160cfdb614, 0xdbbdf02db71aa68d, 0x11ba5fc24,
+0x51dec3c2d4c22917, 0xfa2d4e7e6c114fae, 0x60edd3f6ebaa6ae7, 0x399ae6585842f314, 0xf79366405877dcf3, 0x3eda1fef1e8864d2, 0xa06fd3e98c8f7516, 0x1d04c2523e9e5169, 0x822f25114b38f9ec, 0xb06bd4bf,
+0x913f2f23e346f316, 0x4dc39b9dfe4d0e58, 0x147a80bdb6a1623e, 0x29d7798e67167bae, 0xceba2f1c0dbf2976, 0xf1a2721eb849943f, 0xa90673d9c4ea6445, 0xda4b90c9f56fa52c, 0x6ca7fc9f120f9a30, 0xe44afdb6,
+0xebcab6be9de8e1ab, 0x857c1604a1f4c14, 0xc92a9f2c530e58ac, 0x6998027ec4f4c3ee, 0x17eb867d6582a474, 0x35ff13c6ce25d630, 0xa8e9ca5ef69304b1, 0x2bc44967721a7812, 0xcbc4ff4cc804879b, 0x2359ebaa8,
+0x9a8f543411c14e49, 0x93305e58487ef7c0, 0xb8881b57dd508943, 0x6d9b22e3aa9516eb, 0x692350966016109b, 0x173b3698cbea59cd, 0x748657a0476856e5, 0x3e03bc9e7e8afc43, 0x96a8e638221520b, 0x21fb33603,
+0x3f640e6b1b1df9ca, 0xe3f625412d4934c5, 0x927123d1298750d1, 0xf65fbdae209dc300, 0xee25f3dee6a896d9, 0xcfde3065970b481f, 0x734d0d0df29c23d4, 0xdfa5bad942aa23a8, 0xec2bbf322b38ed0d, 0x14a98e32e,
+0xf1b489af8585ec87, 0x6e97e6cf4a82d2d, 0x1d3e49f0305aa0af, 0x4ed8f0e0d3caa34c, 0x4d78586486661bb3, 0xa88aebc83438d348, 0x4dbdf5cf87911e0b, 0x2525b28bff2cce7, 0x5f631ef4dc4f3f9d, 0x161d6c67c,
+0xe16e0c5ea99aa66f, 0xb37f10de07a059fd, 0x68a8c3705a596185, 0xf69e64aa3596585f, 0xde45418fe60f6ed8, 0xac0d213d4c5f47b3, 0x8db6cef5d9fdd44, 0x48f21efe18cc17e5, 0xb57a4e425eac3897, 0x25e0bbb27,
+0x47efd4e891f0ac7e, 0xe6f3511b408d0b6e, 0xf2e337621f52b87f, 0x79d74f781154196, 0x4ec786acab37071b, 0x85bafd5fcfbfb9ce, 0x2cbd4b282c5aaf83, 0x5f98bb9eb62d4757, 0x2e531c7a12e0b5b5, 0x21bc25c3d,
+0x8b6ec8e7976a4817, 0x9173cdddf31de339, 0x14ccc9821d493808, 0xf756f3951c2c940b, 0x6f7a529e9d0a68fe, 0xdc8c53d43a181568, 0x554d7786e1a0338a, 0x5fe47c1cf1bd069b, 0x265cd034952346bb, 0x1b397bff3,
+0x3c37cab056bf7c9e, 0x1de182861ec2c3a5, 0x23c4784976ce95ad, 0xa800c459c3d65594, 0x275dd666253e10c0, 0x10c1395aec09b0de, 0x799a70d9021a46b0, 0x4b39e6d34584a181, 0x7b7ca4b304738341, 0x461a6395,
+0x5e6532435b6b9a, 0xa2a66c5c51c83f39, 0xdc360c0ea2fdc7ad, 0x5051fb59220eb2ac, 0x56188e0c73811924, 0x2077c540314eec0b, 0xcb951b594711240d, 0xbf6b4a7a1655acd1, 0xee9f74b12a60d44c, 0x593428f5,
+0x8bffdacd3aba92bd, 0x59d59dbcdc7913a, 0x493b1986fd56a94c, 0x8036b7fac7c5d4a, 0x279c10b5d0bf22c4, 0xed46430bbf8016da, 0x7a8bf634402ca802, 0x6e4cfdf934543617, 0x76bfd04e05bafab4, 0x24d64d2f4,
+0xc0d9d411941d184e, 0xbb6a70bfaf77f991, 0xb3c4b241a495f6cc, 0x428cc2d91ae337e4, 0xffc517c170846360, 0x36834e929b04f9c3, 0x8d2468572de5d83b, 0x3261f7631abcc4e4, 0xada4f462d84f2c3f, 0x21aa4e42f,
+0xe5e84a0581a35bb3, 0xe89b3210251939e7, 0x523d5012d70136ab, 0x5ac7410de65ae7d8, 0xf8681b06e0311231, 0xda566dcdf0e3872, 0x9086172bf076af38, 0xed063edb5c4be437, 0x89139a463d7e17b2, 0x13009f647,
+0xd6c89b992f5cde83, 0x65c7c85f4a546829, 0x6316366fae8269b8, 0xd344dc7ac397b7c5, 0x6f9137d1a93ffb4e, 0x48576783f81a9499, 0x8dd2377f732c18e5, 0x7a8144627332529b, 0x789edcaf240a63d8, 0x1fe3c12f9,
+0x4b41f7e1ed2db6e9, 0xe81ff650be0487f9, 0x9f727bb273921c92, 0x9b34fc89d2f4e729, 0x227ee53c95a572c5, 0x93547b865adbd092, 0x3e993c171e6ed88a, 0xca45eeaeb634d8d3, 0x7e67b65410f2911a, 0x1e20d825c,
+0xc458b93a7d89eaf7, 0x336da0c1f735157f, 0x460970ee5eb55954, 0x6ca924948cea854c, 0xf72a40b8c0eabe41, 0x8f5daebf299cc24d, 0x81d4e923765bf15c, 0xe813a881a5083776, 0x92f39ddeb3d54a5a, 0x21c3ad192,
+0x3fdf87cf97f57020, 0x49d63df59fc9a3c, 0x4ab357ffacf6bb45, 0xec86d3bd9be7e7d1, 0xec985c0fd8dffb0, 0x55b0a03d66baa350, 0x3e6003a890db7a75, 0x42f22bc4f801a863, 0xd6fb0b84ed626f69, 0xb95d2b80,
+0x346cad7cb60c52ef, 0xf0aaa895e8d8633f, 0xfe3c617e370f5d98, 0x902c6e68807c7dde, 0x272dbf8d1b2ac39d, 0xa8bcc64e2d4dc7b1, 0x5391434863f3ac6f, 0xbabd0ec09a7eff3c, 0xb9cb9c96cee88b5f, 0xe82dbc59,
+0xef11a78993edcb4, 0x748cd48a58b3a6f0, 0xcf10a3286b63e98e, 0x5cf4badf20ca9948, 0x7ab1302b8753e3fd, 0xd3e33be48453b200, 0x23d53a813c01446f, 0x55feddf6089dd3c4, 0x96383f206d2b7ca1, 0x973cd727,
+0xb3e7e1957d7bdc10, 0x6f1d7a15d6aadddc, 0x36538ff71a50724f, 0x1c756b4a48d4f30, 0x4ef1b8140c86566, 0xea7dd22e17ffb92b, 0xb87c84ab9bdf283, 0x8b2ecbec3091c70d, 0x5b1a2abce3fe6400, 0x997315b4,
+0xe79b38fdcfa01a9c, 0x1e18a36b0539e17b, 0x2b4b489fc9930aaf, 0xc03efca0a09c2ffc, 0x29f2c88d9cde2651, 0xf9f668775344414, 0x8ec00d0e3f5c86b0, 0x4ec4b1e060861a50, 0xf635579937f82fc9, 0x267f9f491,
+0xdc906ec634dd64a5, 0xec17509d4a1d2204, 0xd069aaf469cb92a5, 0x56c323cbcafc18d8, 0x42620c781fa16d7d, 0xe249a99b70d45d42, 0x8fae37a151bd2d42, 0x5feeb657a7606b50, 0xa70c709cf748d11, 0x1d9cab027,
+0xfac6fb92f03bd3ee, 0x2cc202ffb121b213, 0x35436634b15fd343, 0xe827d3ddb5df92a0, 0x529da1e58795456e, 0x3300c93014218485, 0x2e84db22775f9982, 0xb229926efe0789ae, 0xc75f13fd9572f494, 0x5b998626,
+0x18ccdc6ab77b4400, 0x562f4db44ece34ac, 0x1fbb38386a7a7f25, 0x4a10fc1b330ebad8, 0xb8c5d95b1cad3924, 0xae930de142181224, 0xb1bc57fad09fb222, 0x3d8955b100040eab, 0x27f4723c4ff73eb1, 0xbe0ded17,
+0x9087ab36de332f5c, 0x86fbdcebebbd3f5b, 0x537bccea2366085b, 0xb46ab063186be8f9, 0x683a117408d4f5d4, 0xdfe1bed18b036276, 0x8629265347f7509d, 0xf1d4b4e124a67ec2, 0x230b2604919e7e70, 0x51dea5e5,
+0x8d111dd746c964c7, 0x599a3057c8d89554, 0x9da2808fab2cea5f, 0xdf9e3c0e3e9ed870, 0x2fde4f64fd1a3fb, 0x6e6343dffe1668ca, 0x6179ab3a489cbd87, 0x127e1539ab4008f5, 0x96ddd4f702a982a7, 0xa98b54cd,
+0x9fa72f254f2acb3e, 0x6eb878f218514ac1, 0xb7a47a19b48e2285, 0x73cee8a54e6f71a6, 0xa1e5f3b5b6762aca, 0xf075783a1808d9d7, 0x1d3d7d6558a0d4ce, 0x3eadb84138d12735, 0x8af6ff3750e740f, 0x144d8afba,
+0xf8ca27c5e5856705, 0x2e0ccb07ea5e5a51, 0x547a4428fb98505c, 0xca35e6b2eaa307ca, 0x7242f3d416fff72f, 0x611b3052e44f3739, 0xb12bdee22b847203, 0xdc16adf8c7f7f7dd, 0x61c8acec16f18edd, 0x3d72db1c,
+0x7b22d6667aef882b, 0xf3a835d242122fdd, 0x111da91120102357, 0xd754930fe1d573a, 0xc876d11b638e0803, 0x36a2d75dc2961ca6, 0xc9be1a16b151f05a, 0x7c3f4d8997c470ce, 0x7a8833288ae20320, 0x10116034e,
+0xeca95a9ddc1a9a0c, 0x3d00034025d51d0c, 0x961be9e676d0cff7, 0xe0815a2ecd856b7a, 0x4cb8cc45dbb6656c, 0x4feda03fe582790, 0xf01da838e2853020, 0x78611d8dd6860ca5, 0xa7d13bc6fcd51c1, 0xd54d7cf8,
+0xc899b3f43497987d, 0x2ac3a4096606f093, 0x74de8dd55b0e88c3, 0x77b0bb84fee6fe22, 0xf1284626601a60d5, 0xba4ddc8abe754908, 0xee6db85e411c5a30, 0xca0f726a0e55fc5b, 0x7451c247c3121ff3, 0x247ce82f7,
+0x3b0a9fbb90308bcf, 0x4c16e8b77f47c0a1, 0x63e1cefd553eed9d, 0xfde0a01e1a1f98a, 0xf1977d75abe57c39, 0x161bf5709cc1b084, 0x7beee6f6450472, 0xb6e02b6bc31f4892, 0x3ea16a337baf66da, 0x1a621753f,
+0xab70d78479eb10c4, 0x94219521f8bc27f8, 0x36c9f7537869bdee, 0xbf66dabc64d16dc6, 0xca9bbdf48b3d06e9, 0x57c9da6c7568952b, 0x5de28f3ef78746e5, 0xe261c58f15545f7c, 0x411bd6e9c4508339, 0x22c77089a,
+0xde05196cbeee4334, 0x286e1023d650bdd5, 0xc7bdf41c41a13828, 0xf34da9b3d1c4b5f3, 0xbc74dda76b0683f0, 0x13b99ced657fc28f, 0x18eca9d9353cab0a, 0x380eb2e8d2797de9, 0xf07787d784f1d8c0, 0x2c3a7798,
+0x5ad3ed012bb0142c, 0xe4705751fb47b0df, 0xd8869bd73652235f, 0xcc617ffca8342134, 0x9d5ec26f538ef87e, 0x46febda1a7a79266, 0xfe7f34eb068f741e, 0x576a9af79fc39039, 0x156659a5cad2126c, 0x1a30799a2,
+0x95de2c8fd13b4f2b, 0x805de0cde255d486, 0x4b14286ab314460a, 0x1ebd2da89aa23dca, 0x37e3df3efb4167a2, 0x11155d80920a3377, 0x8ac898d84f259ab6, 0x9ed2063a6746d23e, 0x2e2b5a60fd002761, 0x6d1851ce,
+0xad88f52e3a42a652, 0x3511627279ab210b, 0xf788894ebec51abe, 0x379e491c2c7bb26c, 0x6228aa0a5181db45, 0x7f74ce01ec7a0659, 0xe2f254209643991a, 0x2dedbed22496b97d, 0x408931112b96f706, 0x1a7fc91f5,
+0x620430c3ecd23be7, 0xc6318ba615d80ba, 0xda4526a541be7af2, 0xebd2a8f9bc77a7b3, 0xa43155e8db01db7c, 0x1d713725b0c670b2, 0x51eb065fdf6e3a4, 0x4ef5efac845e4cf3, 0x91283d2b27c89c02, 0x2290bcf1a,
+0xb417de8a08cffb3d, 0x3506a4935ce1b229, 0xc5de2d160da2c649, 0x45feaf7ee2f4130, 0x31df929201acce7f, 0xa8405ed24b5a0712, 0x3318706f3d512918, 0x81601757f28d8e09, 0x77683e9d0e67d248, 0x805fabd1,
+0xcabbb72293336371, 0xb9cf7fb1e3a00029, 0x373c2e7ea54d94db, 0x8fb3b3f96526d818, 0x8c76d18835265618, 0x473c75245d9d55cc, 0x3941acd07e23bd49, 0x906b893f1c1c36d, 0x94988525e7b4af55, 0x263c689fc,
+0x452359ea99fe10d7, 0xf2b673c1ea0aae5c, 0x4b4ed43781afd04a, 0x92597748764e6216, 0xb46182ce3eff347c, 0xd31c3aed488d6850, 0x94fd55f423db132a, 0x51a5d2854ce8ab03, 0x56e61d6ce8c3cffa, 0x896a630f,
+0x1fc8bdb01d4ff053, 0x1c6095a1c1f40aea, 0xdb7a7b4d5c083f12, 0x42d55ac07e8f45cc, 0xc78dfbc41f90b725, 0x9fcee3961431af89, 0x7d8363e93ca56bb3, 0xe7fd377fca916301, 0x67882f9e1907eab9, 0x453155dc,
+0x7e25f0e69d0e0580, 0xb6af3511a5c26, 0x7c292153442dd30c, 0x8faebbb37f1a64d2, 0xe24d9624c9412234, 0x3568ee44c9304d3, 0x6a13559821e23050, 0xc91d3b8901034a26, 0x2ffb6630be00f788, 0x206e7f9a8,
+0xa17c9a4d44571d91, 0x5dfd4c2888c1bbed, 0x17461d786dca84fc, 0xd9fcfb94c4e0ea4d, 0x97defc28372d6b3e, 0xfc987d6f4b96f8da, 0x8fac092de6704b02, 0xb244991ecdb1fac9, 0x7a5766a7dcf46078, 0x1d9588c5b,
+0xc651e3f1ab06ade2, 0x3212e413c1a79a7f, 0x77fd2c4f7e89021b, 0xa9635f044d4bef2e, 0x7bab40c553539402, 0x8fe0d4da2eee07c8, 0x11703804a794bd0d, 0xffb3e86ea44b9f0a, 0x45b0b1177bda3b43, 0xcbb34c1e,
+0x78b0befa18820a75, 0xb1db6ff8de211fde, 0xcc35bdaaef2a8b72, 0x2018cade04d53f65, 0x8cfbaebfa2c6f5db, 0xad88abf6e480be9c, 0x7fc4e1ae92317181, 0x9669fed0a0edfc3a, 0xf2923fad2233da7f, 0x11811f8fd,
+0xe5f9b82d19cb5013, 0x804c3903950fae4a, 0xa6e11c4e3130febb, 0x46c158f3f5f1b642, 0x7c1781c9c4baf4ef, 0x8f2201130932f301, 0xa37ea0c55e8f0f56, 0x831383cba10739c2, 0x8ca9f424d016b6be, 0x18a7fc886,
+0xa05cbaa3c1dc0376, 0x1abac255253136ac, 0xee7200f7ed10bfe1, 0x4af4da34e7e964b2, 0xe83c3a523706518e, 0x6fd6443224214ae9, 0xb2fcad2c76732eaf, 0x8304fec44672e1f8, 0x23c3d0d033f0aa3, 0x9cff59ef,
+0x814f8e069e33a4a0, 0x8d73285a49389f07, 0x7215ef9b645ad45b, 0x1f70af0466a0760f, 0x6fcbf6581e92001f, 0x300bb6ab6891d13e, 0x8e095d4300cb328d, 0xd53e3d7d16576521, 0x9faf6a312b4923d3, 0x1004da3c,
+0x80998ea91aebf8e0, 0xc1c65b43f5310c32, 0xac4ae2f8345dbb60, 0xf88c89b132b838dd, 0x61bac7cd63b75dc9, 0x65a0040d54281262, 0xfa62fd73a4d61a32, 0x42ddd7cb3bae1a69, 0x6e83aeee092074e0, 0x9a05defd,
+0x4b62a887c37b3ab9, 0x46e1acb0181f65e2, 0x459ebbd5e24d699d, 0xf11feec230f7bdb, 0x4d610fd399978f82, 0x7cdbaf93df50a395, 0x6a8825c3faa1d728, 0xee32ff15ae40803b, 0xfd0388b001d8495c, 0x220cb329a,
+0x7c5b06839c4351c, 0x4f74938abbff255c, 0xf3948b4cc6cc63a6, 0xeb883a1c7ccbacef, 0x1cc1d88dc9653328, 0xffa3936cf6e3df24, 0xa87b5c3b5bc77b4, 0x478819ff9a7f5501, 0x29510fbaf32ca68c, 0x11e05e90,
+0x307487f24c144b17, 0xa7b9f24de16c6fc9, 0x44f141f04d1ca480, 0xa8414e2bc823628e, 0x5a803f5d99940e39, 0x66917cf746c17e3b, 0xe79014bbee7ca7c8, 0xaa22d944b6e23b46, 0x118714d75583b071, 0x36307ad9,
+0xf904c0d4028ae733, 0x51facfb5c7d09ffa, 0xa37764d53c5c8d58, 0x13537843e82719ba, 0x3f7ca731b69d9267, 0x2bccb02792c5d28d, 0x66d90357c3b05bb7, 0x969b02f32469492, 0xf13525b1f4d36d9, 0x7fe4d89b,
+0x1d3d1e8498fb8afa, 0x86b62ee451f9c004, 0x7096e6d724afe00f, 0x46d5632d5a273d26, 0xae40d24d05c7897a, 0x58f50387c0f8d4cc, 0x3d82ad706e124e9, 0x37cc26bd99b469cf, 0x63aaddbd4379921, 0x168f0dc5e,
+0xc8ef465d965c2723, 0x24a12db5c0e1113a, 0x6092f00e3e516635, 0x75fca8b2ac800d10, 0x302edd8bf798ef1a, 0x7b14f82e87fba457, 0x9f8d111fdcd6a6c8, 0xea1a8aea6d63323d, 0x942e382d355ead80, 0x23d90fcca,
+0x2fbef294cf5664ea, 0xbe9b769ccf667255, 0x7855642a7d0bfb40, 0x8733261683fb4ab0, 0x32530a58ddc0a574, 0xde34623563526598, 0x232bd580044fc3e4, 0x17b65ef5422e4cd1, 0xf408cd363c2f15a7, 0x1c64d5cd2,
+0xc747bde67201b70a, 0x553bfe6d0dbd366, 0x958965dd4404f69e, 0x155795144be936a7, 0x5af8e8c16bf717a9, 0xb84030a71ec6f6ed, 0x6d1ad513e3a4d7, 0x3a0747fbebb07ab5, 0xe687a64f249871ef, 0x247726010,
+0x9df60d9bc2c49ebb, 0xc03034d9c9e082c3, 0x54d59cbdffb23347, 0x48902588d6f98dc0, 0xc9b2c3e48cf3e820, 0x890b708c7adb33cb, 0x9138630c68caea4, 0x30e9fd1e4f832d09, 0xc612197a911d3383, 0x992f53a5,
+0xc091414b3eadbe8b, 0xf8cec3e434f134d3, 0x7a3bfcff7affcab2, 0xb65efcb258d1f74c, 0x29a9949e7b8b97ba, 0xd423f065d84e981e, 0xc10b30eeb88d5c5c, 0x88b946d1a89af761, 0xf3e3ba0bb325d661, 0x25213d6c0,
+0x64ddd09d223978ba, 0xd7a1147c80c53032, 0x9ebf11f7312ab855, 0x6ec04f93e4c64ce0, 0xc8e3a6e03bafbd14, 0xe9a7ceaa9295e4de, 0xd6e5842ad0480118, 0xa419d0a6c1798ed, 0xa44b6b48f8009224, 0x92e9cafa,
+0xc661a8a514c1e9bf, 0x2a939fa824a2ba75, 0xe87f1ffcbfc570fc, 0x65228485631f5d18, 0x75991c414e96205e, 0x65b5c17c4aa8870, 0x9514922a9a948255, 0xdb789adc5e461d4c, 0x9b7e22e8c9e52e9e, 0x15db0dbfa,
+0xa8382cfd980c03bf, 0x87e9a3100621e4a0, 0x589fd2f7b0a92bca, 0x6fe42c69e5df4cc2, 0x8f8447c031b8c932, 0xa94aba2baac41d89, 0x216b4cad6254cfe2, 0x21d5d8679321562b, 0xb0cc0b53712f386d, 0xb50f1f7a,
+0x14d072ff3bfb738f, 0x442b08205166d92f, 0x6996a0ad624ac941, 0x788ff7e501081e89, 0xfb02cd6898587e0a, 0xc51076b3a72bd701, 0xf98336e3b08aab8b, 0xc077e90048e1b193, 0x39d37aa9cb0c8c70, 0x4984309c,
+0x1d727ebefc798ed2, 0xdc7c73371afc438d, 0xc32bc3c07bb13f35, 0xf3dfcd2557617466, 0x8c95646cbe96571b, 0x734867f830838b13, 0x401ded84027ba9e6, 0xe0a84bb731f700e8, 0xfa3424e49c1229d5, 0x104256c90,
+0xc0f490f6bbbdf776, 0x33b2b66e1077a569, 0xf16d6484e000f8e8, 0xea7be6a209b86a9f, 0x909ee16eb6a76938, 0xb81c2dbbec3b43fc, 0xa192ae280f1ade8a, 0x9b39faffa63f224a, 0xaec7f9c19e067760, 0x1b933f34e,
+0xc0a2a1a9f9d8728e, 0xaa10ddbab55898d, 0x611ec115584a4f68, 0xbba06cf072187062, 0x5af59c1413fc003e, 0x56bb4f30efee06be, 0x8289704b25bb735c, 0x6402b7b4355c6638, 0xe62105df10791efa, 0x1bb21dc2e,
+0x76bb453d3fa49200, 0x6eb17408cca368e4, 0xc9fd1428b1c126aa, 0x2b012d7dc5058bc, 0x46c5cbdb55daa3f7, 0x39e7eac30256c760, 0x8bd103c614efd10e, 0x66304cfe3e4a75c, 0x127aec7e60dc088, 0x527de705,
+0x4273021818a148d2, 0x750c1eaa31970de7, 0xef5e83e952cf73fc, 0x685bb343cc5a6734, 0x80f7e642ec26cc7a, 0xf329187328470974, 0xd3cc86d1b255c351, 0x2b60407374f26612, 0xb6fbc85293c73b35, 0x1f83af8b6,
+0xe12764e14994310b, 0xe3d2045c9e6fa3ce, 0x6baa966d71eb7734, 0x7d0d65cce908c632, 0x8079556bb4495498, 0x3bcca1c6114d423a, 0xa64497d8a09cf0fa, 0x485d7ef195fd52f5, 0x330308068f7436f3, 0x19d1d186a,
+0x65952ae7ba6e94a0, 0x8812799831cc7852, 0xcde8a5ae1ffddb3e, 0xc228f90380326287, 0x5c63c34647215fbb, 0x12c2a6a8dfaeff21, 0xc13e0c8898a58b10, 0xe0d85e6be6a29a71, 0x8875ff1feb237104, 0x23499fb5d,
+0x80252a9905a82a58, 0xc3802b10b02ebafa, 0xcd5f468cc870f416, 0xd41830a8cbaf1547, 0x8c0133eac3cd391d, 0xc4bd7b207ffc6def, 0x9cdea8c158c48b92, 0x92f11cd7e576a86c, 0x62cff3db36717761, 0x190bd249c,
+0xe9be5819402c6578, 0x77f72ed46fe0917c, 0x9ba732b2495eb516, 0x7a4564a8d17fe7ba, 0x567512733f673300, 0xf75fa105cad47ca4, 0xfb1ab2c2567c1deb, 0xbbea92f3a450f305, 0xe5c815e496148ca3, 0x5bd657fd,
+0x809628e84311c0de, 0x2a111aea3d5d0757, 0x732f73f715b42a26, 0xa2b7f090d2a7ee39, 0xb09b093d13fbebbe, 0x10c5134e368ef1f0, 0x2c469a397056a4a7, 0x181adeed81f5b8d2, 0x22600b478f658a95, 0x9bae1345,
+0xeb1ef52248dc30, 0x286decb5b3f762d0, 0xa73720948286e5cc, 0x91022ac43bc680af, 0x9b3f4df72ec21bed, 0x20965c058b0a06a2, 0xec59e66447a76911, 0x2b5d1a681695d30d, 0x7ae70dc52ece8411, 0x11a30380c,
+0x36dc187e0c2d89f1, 0x644bd1776288621a, 0x651c4af5f967682c, 0xa33999205e62e5bd, 0x7dba07e651dbb7a8, 0xff9bd715b22108ad, 0x47c61fb071abf895, 0x411f2ba155a58bf9, 0x8ccad74269f54ecd, 0x1b0312b1c,
+0xfe1e99600db48de8, 0x49ca6d520324ca01, 0x2811dcccec6d9a44, 0x4b0a1b2796afe194, 0xd14ffb0ab733598d, 0x64ccf5944d9f6ec5, 0x15fe3d4fe71bedf5, 0x6eecf8b52fb2f369, 0x9037ba079ab2bcff, 0xb3f2f515,
+0xeb8764a48c7bc9ab, 0xcb8d8088dc452cc8, 0x465c6951d78c9a5, 0x5c2a2c638ee100a6, 0x414e402ea0468b2e, 0x41df0a094dccad4, 0x84f4e9b8e7dfa2af, 0x8f252537168cbfff, 0x82ad759209c8473d, 0x1e275e6c8,
+0x9ec5844c354e52a5, 0xb81a8c5d01517bcd, 0xd944e07bcf8dc415, 0x1f134d48cfde3833, 0xc9df168c6ee587a9, 0xec1e376a29326f45, 0x6ad45b8f95a25118, 0xdf25b718db046b4b, 0xe6b03dc9263d51a2, 0x238323383,
+0xe853f04b7e0a4477, 0x72bcf3caf85c201e, 0x400b4b6a68f509cc, 0x904bdd65f86077ca, 0x88cb49d950a5c9c9, 0xef30325fbd2a43ed, 0x889c553f62acc21d, 0xe5b82cfe353acbac, 0xd661548309f9d106, 0x1f802f0d9,
+0x46039029529f7274, 0xa4d91aecee3f63dd, 0x54ec6c44472ff3ae, 0xd45502e8941c84f2, 0xd27f84088c4afe94, 0x60b37f2c5b1e1e7c, 0x9b8be3bf18502fbc, 0x601e4d7bc331adf3, 0x6ffa8a4cff3a7df1, 0x24c054a69,
+0xe62320295270506f, 0x9a3989e5154e65ea, 0x573f8e39202f6f80, 0x307b18d4bcda7a4c, 0x92c21d1cf5f88259, 0xd82986d4daea913b, 0x61942aad8c5bd734, 0xb90a37da5cff9f60, 0xa3be270815a84a08, 0x2616e7a67,
+0xe10edb41bf7e647e, 0x8bae035344ed16ad, 0xa3e1f1a7ee557d82, 0x7b4fa5ac5843b947, 0xc0289dd257e8c4f7, 0x96aa2b72cfdf4a31, 0x30dc251a106d0f5d, 0x2d7f05cfac3846fa, 0xcae73e9efc1f234a, 0x213a865f7,
+0x4b623e1f8f41db5a, 0x4a0c4e97da7991cd, 0x52454df1b90522e7, 0x263dac377a50d54e, 0x985a9797c0d1d418, 0x5c78fc5525410859, 0x41152d59937ee380, 0x4ac4457109a6d472, 0x7c2f5ab01912492e, 0x13f828f1f,
+0xeb37d4d357ece9a8, 0x8da520075d72ddbf, 0x7333004fb3837cb, 0x5ebf3e59f9885c23, 0xd4f5e5e2730ffefc, 0x3eeb118dd551a9b3, 0xda9d22b199f1871c, 0xee96c2734d83d688, 0x2bf3713c2a304176, 0x1cd405015,
+0x6f92a94e42f99c2, 0x284c6388b9bc2f4f, 0x9cc961adcf191675, 0xf91e3f87b5059508, 0xe3bf5f05549da7a8, 0x10120e8942b5bd83, 0xf85c93faca47b6a7, 0x534ab63e0edd2ae3, 0xd85c3ece5ce83542, 0x2df66207,
+0xa1c5deb5363dc89a, 0x60d4ee52066b9a32, 0xcd4e1ee3d728d798, 0x652ea59a50974356, 0xccea7252bc9ba0f0, 0x393b80e0cdcf3773, 0xfc87da3b060440cc, 0xb4f1432de74e84a1, 0xcfd434308a2e7ea1, 0xe46587ee,
+0x5c04e51fcff48c2c, 0xc759d2167d76d498, 0x983ec9bd080b8b80, 0xe866111f03d193c7, 0x7372fa1fb1e4dbbd, 0x5346521ddbeda209, 0xd5eeba4de2bd739d, 0xca0962aa80734d3d, 0x1a5ba3508ff708fe, 0x1eaddd763,
+0xd2a5b95566342e30, 0x1fc224e59f48ed44, 0x409f87afbcf9e0ef, 0xf631719c34e1a61d, 0xadd399b2fb8e96bd, 0x7b57b9739e0c30f4, 0xa69bd73052a4db36, 0xd29fecd977f2187c, 0x3e55b0c31f03e170, 0x67810e21,
+0x2d0f250a80227a63, 0x21a0ab465ff644ef, 0x1595827d8c8aa162, 0xe87f98e9cb9341ff, 0xcd4b894e3f6be44f, 0xc679b7a3cb388622, 0x3438316e56e07e9c, 0x869d3a50cfad26b8, 0x13689f549f69d766, 0x18fef02c4,
+0xdc56aef2cd35f92b, 0x4b810a9f1083be54, 0xce674dd5b4292d33, 0x5d15154dbaaf9a17, 0x2f703493ec468e61, 0x6aacdd65aa1e9436, 0x1d2cc21f95688e4c, 0x39979c3b2a7bafe, 0x3b79dba2701577e4, 0x7714e7f8,
+0x1f6e9294819cb4cb, 0x250baa366f98caf4, 0x6c9ee729f1ea0e4b, 0x2f7e32298be320c6, 0x967da51b694e79d0, 0x7bc94a65d64d0045, 0x8c56b265c0524ebf, 0xdb9744bed97cf2c0, 0xeff76530ae891f8b, 0x1aa1a6f2c,
+0x2ca1271b17ab1f04, 0xcd6695d340a93a89, 0xaeea1c7a5dd041b8, 0xd0fd3928f8f992e, 0xcbcea91e20e6dca4, 0x547a2b78fd38494e, 0xb67022272b38a84a, 0x5246c51648a44dd, 0xb49cfec874752be5, 0x21c1446ac,
+0xc4bb8f3bdd10128a, 0x52cf85722f08c10, 0x43fb6f72083d8f1, 0x28a47120ef30d5c3, 0xf751a51446877da8, 0x85b43f52d1f98837, 0x595fae2653a0dbe6, 0xae1fdb7177ea1d41, 0x599cb29cb75a1710, 0x11d71843c,
+0x7ab6e08c1312870d, 0xd926b0d2d8e84ef5, 0x2d7b7b9eda337743, 0x251bef67e347cee, 0x43f109f011d3fe6b, 0xc8ce6dd2a61435df, 0xb4042fc52a671bd1, 0xe573bda386c5e417, 0xc804978c3330627c, 0x19ad64c06,
+0x405d261a72bc36c6, 0xa9ae1db6d1f4a33f, 0xd68ab592fdb7ed12, 0xdcb5b65914f95ab6, 0xa378c5c88808c45, 0x417403389df63b41, 0x7738b102c156b6cf, 0x3e6e7eff2dc3b14e, 0xe88376ed5d336dc7, 0x17ab1aa5a,
+0xa38bd5049670f98f, 0xc567c0a714b11ada, 0xf346c6d2cb3c123c, 0xfb7f364a134680f3, 0x31c5b890982ff5fe, 0x40d4e10b788757f1, 0x61bc7ef95b77cc2a, 0x35fe87df937f5d0a, 0x9b6d13d6e7992cc5, 0x869812a4,
+0xf15d7af13c22675a, 0x35bc619063155195, 0xea4142e3784dffe4, 0xc0279d4f9db1c618, 0x4fcc9d5fe91c350e, 0xcd6c9a84b81aa295, 0xb4edc46735d7b921, 0x1c443780a4a27ac5, 0x50c77708cf8f6d8f, 0x559c8c29,
+0x8f2d9f7182671fd2, 0xf496de9406362ef4, 0xf8223849fe11d468, 0x40a42886604d462a, 0x4132914dfbf82a31, 0x5f684f5de0a5396e, 0xe80e4965e328502e, 0x42f04592a553ef29, 0x4216e6c0731f943a, 0x13037e532,
+0x4f309e4546f02f68, 0xcdc00b920d586b51, 0x971d24a79974cf34, 0x91e0c57fce2fd0b1, 0x67a37347fdfbce8c, 0x48e44fefaf2443c, 0xde351679480b63c9, 0x333b76404b7180f1, 0xd95520feabf1555f, 0x177074233,
+0x3eec29049ecc54b6, 0xc0df5ca0f8a213f9, 0xa9df1b21810f9281, 0x1de91b664b9ab511, 0xaaaea17dcfde7f40, 0xb8e0a158eae242c3, 0x83e6e9919c88ebdb, 0x3d4b5301950166e7, 0xb1b127b492d7d1cb, 0x120ce9421,
+0xb6be00d731de0790, 0x40e67f62db9c9e0a, 0xff898f247302a1be, 0xb9ba2d18eb907b98, 0xab8eb8f64452e5c8, 0x32ae8296d04885e7, 0x6ee09aacaeeea638, 0xe7f54c3f0d918c76, 0x10543b4074a9b34d, 0x24593a346,
+0xf783cf52b49d31dd, 0x3120a65559e8cdc2, 0x6c7f4bcf109be02, 0xbc23de67a4c61b34, 0x12d9177382d39a37, 0x4e97c2163111d342, 0xb56a4f880f6fe5b9, 0x65d664b4e86bea3e, 0x6a6d5803e7010461, 0x628fa2a0,
+0x362d558b72f181ba, 0x6e46945e6f723035, 0xa816eb8d7e26f653, 0x98e0a0d470183d30, 0x567bf6c627f1003d, 0xeffd4241cc2bc46d, 0xd8cfa234120d76d8, 0xe894272f842f323b, 0x75480378c9dee550, 0xd9c42936,
+0x475a86c1c59de3ac, 0x9a45430996daae79, 0xc0807cae918926f4, 0xc15cf40366eaadbd, 0x3d89e91ec121b206, 0x46f543c3f96e0103, 0xc03a5bcaad609004, 0x15807e20a81500e5, 0x4993e868f0f24750, 0x2769fd8bc,
+0x5e61172157d904eb, 0x3a8558d100679dce, 0xecea96a069cc29e5, 0xb2bbc7ad2af04e55, 0xd9c9b9ac249a6aee, 0xb06fd77d037cafe7, 0xea3d78bd30d2f346, 0x692185844026b201, 0x63c82f7e87ec1557, 0x6407f556,
+0x5acbbb15a7869958, 0x42263aa57ac1bee3, 0x8be0a46c690dd181, 0x15a8720a1c6a27c9, 0x146acef83007642a, 0x2d1f83af0edbc512, 0xd714fb239e67bf53, 0x126448d9e0f1d21, 0xf104e141b72aad38, 0x1dd4aff55,
+0x47c5a21ea422f34d, 0x1da4be472eff2fb4, 0xd82ac4134b6a4849, 0xf12357c1a36239da, 0xe33738b9bd15b222, 0x5443e1ab0c634e2e, 0x20a86d014f753760, 0xe9e6911500d21900, 0xafe9d4f7755b3bc1, 0x6cfd97ae,
+0x6c405a7e715ea7bb, 0xc764c2cb4663d342, 0x16104b5c84e5e843, 0xe2d04d15ffeb1d83, 0xf04873d5b9209dff, 0xef3cc5113fb29fcc, 0xb1bd8d31947175e8, 0x35c601baeb0e2eb9, 0x48cf3830d7c5d0bd, 0x164fe5141,
+0xa0aececb3fc2f1f0, 0xdf8c0875b307572b, 0xaa416945d93aded9, 0x365cd01c78f9751a, 0x660723f62224fef9, 0x8353cf569e919eba, 0x9542a43dbb96d2b5, 0x9ef43af8ebbbb4e2, 0xe2cb15822bf67a92, 0x10551d6cf,
+0xd98e8aeb13e24604, 0x89a56ca5ef73b96b, 0xe04cd0344e88d40f, 0x521d91f095e2b68c, 0xbfb6d92fee0c3b28, 0x4ebc0f73ed2255b8, 0x9c2beeca6bf47788, 0xd2bdd1707afd922d, 0x7b1a919084894fc, 0x1c88bad0c,
+0xcb1466edfecc77e2, 0x28caa5feb322066, 0x6ad6808337256152, 0xaddd758cefddf9e7, 0x322ecaf2cb865f9, 0x33ebfda47cd4c69a, 0xc0461cd7d3614a95, 0x199655366fee483b, 0xa01d48c6c5efdd7, 0x1c48b545e,
+0x964b795a1c7fc18e, 0x975e8ba1b90fdafe, 0x825212a3c10b9f3, 0xadd57fd7441a75e7, 0xf1676382c94e61b2, 0xa25aa995d241b4ea, 0xb6cb32498f3d9f00, 0x66cbaa57aa1ed3e5, 0x70d4aa0048df7968, 0x1602ec61,
+0x9867e1ebec0e425, 0x7736fb3bb8d0f255, 0xc23abc36cf050347, 0x6892f88d8abc862c, 0xcca92f49bdc10c95, 0x75ed17e737f9b6f2, 0x5514e26b0591ca11, 0x2cd14452b9a612e7, 0xe3d1159338f984ef, 0x15fdd1985,
+0x61d60b7206942672, 0x894f9d7f5b2bc80d, 0x566c9cc266a24be0, 0x2fff69366f9e90f, 0xed5c95c13548a5fd, 0xb00366777df8ffcb, 0x6a5b22565b159b3a, 0x1725641e460cc611, 0x785c51613e672bcf, 0x19cce770c,
+0x4b822dc54539e72e, 0xf84cf9342fa90b2c, 0xf7db0751dc1ebc87, 0x7dd2024c80e11923, 0xdfcf4d505bda71d8, 0xab1446d11c6711ca, 0x5b1e6c9cc9a05055, 0x9f2050a407ef5aa0, 0xff06d86dad6817cc, 0x1d55a3482,
+0x18001a41421b12e8, 0x7230a6c9f3369fa7, 0xa312c898d89eb5fd, 0x628fc941fcd51ecd, 0x94333271eac6fa0f, 0x948a77bd59ab9347, 0x8b05c636b09d730e, 0xc345bbbae8b93d71, 0xe206a8ece5d9c60e, 0x1ea0561fa,
+0x6553e1c5d635a664, 0x5886bca9704f07be, 0xdb9011aa5dc703c2, 0x6fd0177542cc8a72, 0x4209749676a807f6, 0x369f71edec1b52fb, 0x68a77651f4123900, 0xf6012c8152c44d26, 0xd77d7125f90a6396, 0x1148b2f6e,
+0x17a610b6f82ef84a, 0x58bd8ed0fb4f2914, 0xcae1c3e346b0e3fb, 0x60c26df0d1874785, 0x7c305a65ce7ff9c1, 0x450a4dc75227a222, 0xc39f7ce13c043684, 0xca6ad8b6c992c1d4, 0xdd93be1dbce63a89, 0xed4baf0f,
+0x73202b84b189635f, 0xb3bb6ecf274445e3, 0x2ae11e1a1b299ffe, 0xc97c0ed25f4a8ba2, 0x696ca6144ac97802, 0xc52783c96fab778c, 0xdc21f57db89cdb3a, 0xb8c92d2782573f01, 0x5090fe96a3e5b830, 0x1b70449fc,
+0xf9713d1d93755b12, 0xfeb270e642d6b57, 0xd16f21ca99ab68e1, 0x787f8bddbecd64b7, 0xff46f1a65a9fb0e3, 0x7be13af81b6eaa52, 0xeab3ecfae26060e8, 0x3a6bf020b564d8b5, 0x2241be403284e5df, 0x21aae19dd,
+0x2b7bd6fa5c259500, 0x1ebb5310a3d770af, 0xdc29fcdae4479cfb, 0x17538ce3c0ec24b5, 0x2ed0583d6ef7abe3, 0x15ede22602ef4ee4, 0x24b9ddc16cfead2f, 0xd76b684130be4e1c, 0x335afe5c95adb24d, 0x100941df4,
+0xf0dd466615d5e998, 0x7b3989f8d638bde9, 0x34be8a58b672173b, 0x880e7a323a09a12a, 0x58d62302c1ee112f, 0x2454fca824765a81, 0x7f725c0501d94e0c, 0x1ef46888d3ad96d1, 0x19df7ac9953d9e92, 0x685de24b,
+0x7443fcbfe8168a75, 0xc90cefdacbefa2c7, 0x9ae19c1254cb0207, 0x300912eada7612f8, 0x6ec47ec0bc28258a, 0x130eaebf0c7eaa4c, 0xee75680d2aea8a84, 0x14b93a930b179313, 0x2eeead41b58aef56, 0x554c6578,
+0xb5631ade177d978f, 0x1b637f9d36967adc, 0xbe1ce35fa54fbbbd, 0xfd45c07b6f4697a3, 0x9298591e406939a, 0xe7031493ba0263ac, 0xd9454106c21e5d1, 0x6c65a4151b172fac, 0x5e53eb0d9d5609b, 0xa17cc656,
+0x5b08147d26edb03b, 0x7bd4493c25e34c54, 0xb3f7f0c61e445d68, 0xb99618c128b8bc4a, 0xd87777fc40780e6d, 0x3645468bc66038e5, 0xdf936b71ada9216b, 0x87cddfb9a2c57965, 0x80d680c924e6e7a5, 0x21687c2f4,
+0x81977e8bdc56dfc2, 0xc6b1224753387932, 0x8a9e7dd19cd97045, 0x1634ee679535ea77, 0x3d0dc141820f358a, 0x8eded4e3368ab732, 0xcc25bdebd479580c, 0x4712b8a25a238dd0, 0x7310e004f5885ca6, 0x45137d16,
+0x27d1fcc11d60f041, 0x61d4d2e546119c0c, 0xc92bbe4a78454656, 0x79788b8ec545ff8b, 0x206af8b5d6546318, 0xa3310ddaa235bfad, 0xb43f670daaa6c82, 0xcd467331fcff19d1, 0x7b26e76ec5e1307b, 0x159977df0,
+0x925227f110ea7032, 0x58410d469b1e30a9, 0xfdc6b01ecb171cfa, 0x6f5aaaa5eb97ec5b, 0x68dc9543421d950c, 0xbfe5e8ebc6949026, 0x96b48dd0a863d7fc, 0xaaf271f2963914e2, 0xeea10532c6b68c24, 0x10401f8ad,
+0xbc7440a4f9f68a0d, 0x9490a60a5f9fa9c8, 0xeb6a2750d8cb2028, 0x64d5f5fb9d1ef881, 0x6611a262e248a786, 0x9a25093c0246454f, 0x97e087c09b0e578d, 0x6a6fb9fd6ebbb301, 0x39f7efada6505715, 0x1d96439d0,
+0xd04ccb5c03666d02, 0x3e61ead865777bfb, 0xc035c9c24f3d3b94, 0x560a39ec3ea5fae, 0x7cd65c7bb91293c5, 0xd055999175edbb79, 0xfc82b08a17e3db86, 0xc8805f3443f7f34d, 0xccbef6a27d5b0b8b, 0x2342511be,
+0xbc46b2e6ede5badf, 0xd5c9f8082be9f295, 0x25803e8afd088764, 0x8273a59c60bbe78c, 0x145bfb4b9ab9e17f, 0xeb2b6ba14fff617a, 0x988c17d83bbee997, 0x472034a09d46c1e0, 0x6790071c527469c4, 0x1e7a95119,
+0x12d2b50b267ba5d1, 0x5464144d87365cb2, 0x58e882dfc85c8ae7, 0x92e711827947b40c, 0x9294954935f64baa, 0x7f226385918c0828, 0x8696a4a3a35dec1, 0xc77f508c62d99c29, 0xda321b2d8e74fc66, 0x254dec863,
+0xd7ae8ab3ea3a4c5a, 0xb9d1ed2293474916, 0xa83d28d59eb8d9c2, 0x906711cf995a6092, 0x2d686aae38b2993e, 0xc772a4e13dce7851, 0x9ffc68721d9d033d, 0x2ffcef1f16599c39, 0xedcc20ffc6eda598, 0x1e7ec39af,
+0x6f9d6f385833c28c, 0xff0b7cb1a646d6c1, 0xc2d390d42b66c25f, 0x65b69989efbf3bee, 0x3b2630c4b469b7a0, 0x9c3a0163a16d0ef6, 0x1daa437dfdc95bfe, 0x98578fbb851d36d3, 0xfa4b7d61fb39b25, 0xba18c841,
+0x11da9d41120f3421, 0x1d2745a4ec96ebbf, 0xc02a411a5ce8981a, 0x2356f23e5ee00e18, 0x325f41ef7fa9411f, 0x32da186edf1366f1, 0xa3046eb26dd0386, 0x46774afb48ed1a81, 0x5565e5141e556d59, 0x1bc1dee0d,
+0xe726e50e9e5c8daa, 0x89b49aa0627fe799, 0xf365cebc8ef16c47, 0xe6195a35a730f0a8, 0x572745531e1d3c93, 0xe00e304d3f5975a8, 0xed3e67e0a36a6f96, 0x80d5735d18e52667, 0x68c4e9cf373128a, 0x1edce183d,
+0xce9c08f18cb86540, 0xaea45d114bcaea6c, 0x91526b6d425f1878, 0x642dca4bfc2d39d5, 0x6ad665ea39719463, 0xb8da7bbd3fee282f, 0xbb575e7bbd7d69d, 0x6cd2fc2da01694d8, 0x2e7418c99035ce88, 0xcfb2bf94,
+0x289b2d201908b31f, 0x5f35ac7fac13784, 0x4d6af15c954d8e46, 0xcd3b7a28ca040461, 0x1d61091d08e89a82, 0x179317a7a72a4088, 0x5c0d652ba04b1814, 0xf4ffe37c3407f6df, 0x38c63373903d01ae, 0x1c8122106,
+0x8dcd838b71272314, 0xbc5fb4e89a767b91, 0x4d01c911465afe26, 0xe982670195a16fae, 0xc03c727f965a1890, 0xebb3f6069068f8a6, 0xd83dc9513f274a29, 0x87732cbf1e65527, 0x4310f67884cbf17a, 0x17f5e108a,
+0x27d2e06d0eda1f3b, 0x1411961d148d504a, 0xf2a6cf8a025d3085, 0xf8fd311417ef9cd6, 0x9921454a266f6272, 0x715d86bf66bb623d, 0x66955e66209dd661, 0x36a6461e783dfc19, 0xd645253363471619, 0x5738fe7,
+0xf3a3fade48d8fc6, 0x3a142f837e563298, 0x78d79cde52c7f0f, 0x62062dc0c65ba35f, 0xdfdd158de008f450, 0x252c26f03ce7ab42, 0xdb4297729b4fb7a6, 0xcbe0997b9bb3127c, 0x7104167cf1282f1e, 0x9acef3d2,
+0xba41929963cc5979, 0x605fd1676f2b522d, 0xa025929a2a4416f7, 0x9385c361a87fbbc3, 0xe7921bfc7c9e0921, 0xa96773da0c5fa4da, 0x51e6f299b91e764e, 0xd7c5ef75c4cc9012, 0xbfe5dfa32159f873, 0x13f48537d,
+0xd60e3e590fb1257e, 0x3086e94067b452a, 0x8949bcf052b6c067, 0x8cfc741043e545f7, 0xa5ac30eef7207ca6, 0xd144661c0af98430, 0x2cf455691694e03a, 0x85e69ca3e9ee1601, 0x44e710f90240b87b, 0x17120433a,
+0x4a6bdce4dc4daf7, 0xc040ec54c4a42c77, 0xd599d7fd2e650bf7, 0xae17f2fb98b4eda, 0x8a357a6a2b581cb4, 0x330f66c65378c340, 0x36acc6c9f2a76d24, 0x882bbceca635afea, 0xa7bd654744cabf99, 0x75edb501,
+0x4decb8dc9dcd1a38, 0x6cb187d6cce3692d, 0xdeb28258042e9219, 0x2ddcbf8d8824b9c, 0xe1a93e8c20496673, 0xb95d3679ecb39282, 0xc72592f6516aee4, 0x44d3c560ff1e4253, 0xb7a781c021ce735e, 0x26e9a0fe9,
+0x83597c45ce8bbb78, 0xb8c53ac68dff4dd0, 0x45e40dd5cf3be61d, 0xc21064af47b81dc5, 0x3abb35408ba4652c, 0xb2abbcd2532b42a6, 0xa00ac43352f2449f, 0x3ebec2a6dc06b18e, 0xd08121d4bb3dc2dc, 0x255b3f2e1,
+0xeacad8de371afdbb, 0x94d6d65ae6e91a25, 0x535739aec370193a, 0xec3063e3e48135b7, 0x1b3e9dbbd0df0fe1, 0x180520b72667e72, 0x664201ba926fbe44, 0x5d477e131d78a201, 0x6372c75077daecfc, 0x1d4948214,
+0x15f27709209fcacd, 0xa753485ac93aa353, 0xffdf2ef53a84ce7e, 0xe4569edf57559793, 0x598a5c246458c35, 0x426cff3792516a9, 0xcbcae07c1367d6aa, 0xf4c0aa3b821e9d04, 0xbf152fbc8c6305bc, 0x26e32d11e,
+0x6628823616668c8, 0x805a6afcb9436ec8, 0xdf3ea735363a142a, 0xead031dda9156ff, 0x1075b1e769555e00, 0x89b8d45af9a6c9f6, 0x8de997f5ff6807bb, 0x6c00e56501f3c8fa, 0xc7e0e4d5a61edfaa, 0xec1e013a,
+0x681a85be095328a9, 0x958f65ac6f47265c, 0x853766cbd12adbf8, 0x83ab3d55d64ddc7b, 0xa1123d463d4830ba, 0x7a3dd46ad34a27b4, 0x6aa9761adda6f552, 0xdf092c11b12c413e, 0xff3b5db28008164e, 0x1d84f4a84,
+0xc9624cda8fa0541d, 0xe3a291055b0891e, 0x866b5f5d0762d60b, 0x11bd87a9dc31104e, 0xad2ea17aaad48d61, 0x8402a8e5ac94f276, 0x2795f2e513754ca4, 0xeb564aa869a68958, 0x538cba1714750d23, 0x139d98cf7,
+0xfa070932d5009ade, 0x1c8b76a6c21f6e99, 0x36440a894a111d85, 0xaec4ac285c919495, 0x41971cb82b872223, 0xd119b1f010ed1c77, 0x7f2830d70b12dee0, 0x33389ccee43cfd98, 0x91c773876d993276, 0xf0019c8,
+0x99f01309aa96c9cc, 0xdf6e8f231b81b978, 0xd6ce79746fc7315f, 0xfa34f603a6a94a7c, 0xbd1188d93c38b104, 0x7e95f64729e0d7d1, 0x24c12f44cbe5d899, 0xfdeaa79908245740, 0x6f0923fb3623a270, 0x162095c08,
+0xc592ebbcd2852b40, 0x50276e0c7cbe871, 0x4bfd10ce084178b, 0xff35f11729b19180, 0xbeba9dd160fdf8ee, 0x17d0bf9340d73d7f, 0x805ee99c599e9013, 0x7648cc0480c0d502, 0xb23e2464a56a50d8, 0x1000279bd,
+0xc0b9f8ce8e571b78, 0xec49df8493eda6f5, 0xd9a0b03533193319, 0xe6f12c5c8ed1b7f3, 0x1e731067617e935e, 0xd07089084daddc21, 0x935147449b47ae1b, 0xa147ce66b0850d25, 0x838ce20343936712, 0x9e211fff,
+0x4fd2db797492257e, 0x7d9bbe086ed9f514, 0x173ffa57f077ba9d, 0x28f9ce92d931007b, 0xf63a561b2dc3751c, 0xd4c413940d80f93a, 0x14a8a79a6b9b743, 0xc42893d5187c53af, 0x6b6b6c5aaa6a7efe, 0xeca8964,
+0x78d6f01f154d2612, 0x5ac5cb39f7bd544c, 0x5e8168d7a04923ad, 0x4b42d3be481288ec, 0x8bec6d1e57874559, 0x3add19de18a25fa0, 0xbec7087f825ce5dc, 0x9d4b11abd6da4c24, 0xdd675d57ce601b27, 0x247e173cc,
+0x4e0eebfb86de064f, 0xb6e07034ba5661c2, 0xb7d62e8a1f1ccdcf, 0xa7474982d947fbee, 0x4301e3666abc598f, 0x568535466356688e, 0xea4f8b818b1ddf5f, 0x89981276ca639fbe, 0x23e70510ec754344, 0x1e73ac3cf,
+0xe8cdadb141dd4b2, 0x43293689b1b26cf5, 0xa3a59ac1b5326e63, 0xd20c1cf3a41ccdc3, 0x62b29614c21af268, 0xce62a41415c0a9ed, 0xe849453bff27a993, 0xe45bbc086e0967c4, 0x849645969e927a44, 0x5aaac9cf,
+0xc64fc5498bfefe8e, 0x45c770e8a92d7faa, 0x33cad3236b8e839f, 0x28eb9be15f3e90f7, 0xe2c3178adc091f8a, 0x8419bded6f007043, 0xdfde1478864964ab, 0x519c85cc75aee6b, 0xd0978792058b8848, 0x24fa24560,
+0x349d0961b41cf017, 0x270e965a8e90a37a, 0x48d35967537b3c72, 0x1fc462b9e95e49ef, 0xc53bb3514c6ee9c4, 0x9786651fd64805c9, 0x2597871e94e5d9ba, 0x377dfecf20e3d9e7, 0x1a74b6e29091b8d7, 0x128c205e3,
+0x7af4c41abdbf43eb, 0xa9e645c4db9460a1, 0xd5fa1cca499cd999, 0x3724ebe1da4f4741, 0xd461b83dc27e3b00, 0xf83d67b62a898fc3, 0x4ce824b6833f5d0e, 0x8da35d388e3ddf33, 0x8228ddee5019c188, 0x2092622bf,
+0xaf15e97d952904c9, 0x4ce11678d50cf01, 0x906d16a3bfe0808d, 0x545659e4408549b6, 0x7b89e348b294b329, 0xb15f1117010f4938, 0xd54c97fa97cb43d8, 0x5ae71ed59dcf9d49, 0x82e5faa0ec9aafa9, 0x26abed88a,
+0xfeea979a65cf4218, 0x1a6a40186de215bd, 0x84fc6dad558c035, 0xc7df2e6defbc53cc, 0x351283c460b03e36, 0x821202328da7222a, 0xdfb47908d56060b2, 0xfa199b4a4453c31f, 0xf485b283cc457ca4, 0x276395ac0,
+0x3c0358dd5e85ac3c, 0xc03afd49a47f9510, 0x63d7f2e87263e58c, 0x8a250d5d722eff45, 0x2115547183b0903c, 0xe5b4c3230b955847, 0xabcb71b15162f79c, 0x54e75a94ab447824, 0x1fe8f33e47edadfa, 0x20df4f4fb,
+0xbdb572a41d2edb39, 0xc671a89270d5f2b6, 0x8e037ee5aa8b828c, 0xd0911134bbb7f18d, 0x541b3bf017480119, 0x36f57b18caea1bdf, 0xb473d17c971eefd9, 0x80176dadec36ac87, 0x2b5ad6204d53d824, 0x1ed209069,
+0xfb9cf4932b95c265, 0x5e61ab7c71f69dad, 0x44cc3ed8b2db2e9a, 0x9b379d3716dd085d, 0x6be90215aba4d4ea, 0x8d54c6ac40c84263, 0xd982c65fd96b8dec, 0x29b1382fd62f09, 0x66755383ab87211b, 0x1917f1eea,
+0xaf6085ed6dfe6b60, 0x1e411a13a6d2e069, 0x2ef2aa7546ef3e81, 0x5fe2128f648582f9, 0x946423b64b7efd3f, 0x1b0e1c510021bed5, 0x8b1491b8f2ad5f24, 0xc03e4bc9814e3b38, 0x33fe4d96b0d633e9, 0x600f5f1b,
+0xdcdd0d8074d62553, 0x77415a90c56ac804, 0x16aaa96d9cbcf053, 0x114537b1bdeb300c, 0xbf249661a3bcf43, 0xdd30fe7dbba55e1e, 0x43a40f2856583b87, 0x10e6d0563c22ebb6, 0xb4db142eecbd1f42, 0xfca6d584,
+0x48d8227c4d1baa4c, 0x77280a0635acced3, 0x3b8f7499f1b4f54d, 0xd5404e814fbfb78c, 0x57f528f28f5a97c, 0xbf8c6bcfe760ba4b, 0x58be2e2c18bf0523, 0x77342869bec5c137, 0xf7cc2e852611cbd2, 0x32caa301,
+0xc848b4c660656d55, 0x1b1bb87d6f048419, 0x341e66bc98d6a303, 0xae07632ed271db23, 0x1d653c3e0edeac40, 0xcbe5fbcce5c5feb2, 0xf78a9c4d3c40658, 0x5961ba4d61479731, 0xf70130fbbac816e, 0x11350b8e8,
+0xa9f858dc4b554445, 0x3ecd674d0d5aa9c8, 0xdeb3ee2b40dac3fe, 0xda50eab95a5aa5ef, 0x3168f23152245041, 0x50321d37f770f3f5, 0xf580a6d3a1e633bc, 0xcb03ce880a6f73c8, 0x7f4ff63a490ef2b5, 0xabbfc75e,
+0xab167e356bace0f7, 0xbf7d83a272046db5, 0xa688b4938cd44bf6, 0xd33eb14e1f177730, 0x503a86a79bc3db36, 0x25039e19eba11efa, 0xe08b5e8dddfb2622, 0x7cc595f14554b608, 0x92b2b1552ca1426a, 0x26e367b4e,
+0x79c9dfcf36e1f99a, 0xad60731f8dd0aa69, 0xe5f028950b246e59, 0x46690022208f81a9, 0xca646b5a5890f89, 0x7776f40b5b77e9a, 0xcab642f9910e6dcf, 0x3f95ef8bb931202d, 0xb66572adb6c8edd6, 0x14554304b,
+0x8e80d2f5b85c2bd6, 0xa42c2295e7759453, 0x1f93a82a22332411, 0x9dd68a9347a0da8f, 0xdf9ad55c2593cdda, 0xdde0313a04fe24c3, 0x27e9d5a216221158, 0xe2bdeb098c7c7b05, 0x233ae16f7283377, 0x1c24288f9,
+0x68c1b5fecd9ab4c, 0x220878fd026375fa, 0x57e4bc8f72e0ec0d, 0xb1fe17752e05ef27, 0xd1a57ff476dc6794, 0x78aacc73c6402010, 0x582ca538a91cb99, 0xe0d008f70eb4b272, 0x7da6c93b021e7632, 0x12c1d1575,
+0x2cb96e2f16f88ad2, 0x4642ab5824a4dab5, 0xc06a4bd9abe52492, 0x43dc8c790362619e, 0x17ceb98f25b3c4e1, 0x1ec35312fc462208, 0x2a8e4ead7d9ae90b, 0x821b4688ebe2ef6, 0x9256ce727880601a, 0x10b1ee81d,
+0x250a34b2307b6b7b, 0xa94b15ba92e7a81c, 0xfb5207473428c378, 0x10cd812cc3e93736, 0xad5c9cc6d30972e1, 0x6ae075a4d1c54b61, 0xc8881a38ea6b4b81, 0xfab22f5a856c4cd8, 0x871c319b32819299, 0xc1b9b051,
+0x5f2893bea2baad37, 0x873bc1b62b90adda, 0x69ff466d743cc4a4, 0x11df5ab649b5514f, 0xe44c7468b06709ef, 0x1cd461181ccadc7, 0x1e8e0970e96b9753, 0xd68f8a1ba9d2d7fc, 0x5a17c2e8035ec376, 0x854d9317,
+0x18964e2fbb75cea, 0xf3c2d0aaadb04fae, 0x761eb2e3fcfbc36b, 0x98079bdb870be0bb, 0x52ed3ceb91e709bb, 0x8e0dd4403cf3e319, 0xa1de9d3b28947100, 0xa117cb22c0df22f6, 0x9d5de17363e1028f, 0x16e74eb81,
+0x418580f32202314b, 0x5e8c873dd1195283, 0x6fdef58cc7fc8be, 0xdc7a3b05dce31eef, 0x8433f08065eb0cbe, 0xdc5985038aacd263, 0xb7308499e99b0821, 0xe4615c1f444d786a, 0xa0ca8826d834fde5, 0xe5184350,
+0x1f866b51e1d87916, 0xfa28a3a30328c184, 0x29867489b1229156, 0xb9ef579b2c843d33, 0xcf99c674956eb6fd, 0x73df0c4b3b6c749c, 0x8b612ad12d8c8b5b, 0xbfbc754fe50697f8, 0x23b1516f0b623160, 0x223f59e96,
+0x2002df4d9d711f93, 0xf18dd15fb55db6c8, 0x5c64ebb585489c7b, 0x63a4bb506f7905d2, 0x5a50169d82f5762d, 0xe5eeef29c5d2e274, 0xe8dadc466ef1a1ed, 0xf4920bdecd572b3e, 0xd55f9b26cbc41fb2, 0x241f99738,
+0x528ed0acbb68488d, 0x7fe1150ee8845608, 0xa34a89047067f7fa, 0x222e26e90e969b0d, 0x31e604375666a419, 0x21d96abd2ad14b65, 0x5ed91dc9ce08a8a7, 0x49132186005e9549, 0x81656b31f25af0ed, 0x1d9b0e205,
+0x7eaed1bfcce132a0, 0x9b9deafbbc761c40, 0x7d863615b94f3434, 0x866a985e51b2f781, 0xac4c58ecaa1fab5b, 0x745b0014a12de1ea, 0x5fe7efa20a549670, 0xe8e44e77194585df, 0xd87ccc450b1da53, 0x1877e5625,
+0xbc88ea45874160b5, 0x9b09e9a24d6e967d, 0xbd0feb7e97b50bba, 0xbd2c0f8398e6bbef, 0xc4eecff0c61ed452, 0xee9135645ce486dd, 0xc18b770178a33a4b, 0x530f710048c6eeeb, 0x71e79aa11e969caa, 0x246e7240f,
+0xecd9e6b74a749bea, 0xec81170adb19aba4, 0x527dac3b005e44fc, 0xb671aea7252733bd, 0xdb575c802d8c99db, 0x9f2b5878f8bf4334, 0x45f72b7eaa54940e, 0x7ecd96ebe376e6e5, 0x86ab8c0fb7bacd9c, 0x132d7065d,
+0x892f4bb86b5d3444, 0xc8cdbd24c05ac03e, 0x4cf2b6067e0c0296, 0xc43b8e67028bce39, 0x37f7a3c128c0836c, 0xea1e8a1f27187331, 0xa09766f3918a1b66, 0xe2e9ec767622621f, 0x67ce80757756a81c, 0x78fe1d21,
+0xeabfeb6fffa057fa, 0x27cda439b05e93d2, 0x910bef0d2793e85b, 0xd642ad6a63814da2, 0x48b9defb077ee1cb, 0x68e3b2615b6fa4ec, 0x2396b77953f398ed, 0x2716d82f8e14c286, 0xde091ecd982982d6, 0x171be7799,
+0xd7ae43bb78101e4, 0x9974e6bf16d3ecec, 0xd20daa2bc7409b07, 0x169e072098668174, 0x206f3f053fcd078d, 0xbf5af8de40c97f2, 0x7fb5728b8f715919, 0xdc21d0412e37ab5e, 0x6221b19fbea5fd9b, 0x24b0bf79,
+0xf2568b7650dec160, 0x68ee526f8ae86564, 0xddd08e980ab54d7e, 0xe256f7bdf8c9aef8, 0x4dbb157352e3f37f, 0x74190fe88dfa886b, 0x6de2506f487a9f88, 0xcf14b4e3f0fb3996, 0xfdf3b64e9d65a17c, 0x119aba31c,
+0xf49600b113838213, 0x37562dcbb4a0471a, 0x9c211347a911417b, 0x6d4568e9da70ad53, 0x3dabd264332fae0d, 0xf9daba69f4c6e254, 0x90bc857b54462f17, 0x3f121426621d3bd7, 0x20835b0226d81e20, 0x19e4715ff,
+0x546140718220d579, 0x622dccfcb4086c2b, 0x6675b562196841c, 0xbbded82b6db1e01b, 0x954a93acbbc44408, 0x558a8f3d49c08899, 0xd4660f7bd8e3d817, 0x3a41330286e7be01, 0x725db1415bd1a586, 0x136163da5,
+0x1a7f12a632a82fde, 0x799f4ed96fe30b8a, 0x1bed2a7f86c0b71, 0x62ba951f2d191624, 0x59d4a26e49494d1c, 0xac582c295d9a9fe4, 0x42a4a984581e2d02, 0x9e0f2063f375f6fa, 0x568ac59cd41c8a2e, 0xf3dbd49f,
+0x37fd2058cb713e37, 0x407208218012162, 0xcc0666bf1aaf1fa3, 0xf915665a0f674a6c, 0xfe2bf55d69391af4, 0x85ba1f1c20e08173, 0x2afb90b5fa0b4330, 0xcd7aa2072484ecdc, 0xc9f8b233f20f70c1, 0xabc01e9,
+0x131a1499e673d4d9, 0x9b53e106e6d20f7f, 0xa20e0f4466945148, 0x1f487ae8f976eb05, 0xe0001cefb0581cf7, 0x1cf115a1a3cf35b8, 0xf981b9edf183a88d, 0x50cdd493e2744b4e, 0x1727f457360c0054, 0x12d031f64,
+0x797b0d7d974fbbbf, 0x20e07ec677a67ae4, 0xdf11991bfd802e61, 0x7cd2c3dd15e848e6, 0xb093de627a504ee9, 0x90b718fe656f18ce, 0xbf2026cb51aa0005, 0xadeb342a316e61a3, 0x30641475d74e5409, 0x4ce34e17,
+0xabf44a8eb4aedfae, 0xb83224c4cb20b4a, 0xf1b197ae2b672b13, 0x6f049a1c662285bd, 0xa4ea8d6c51b834fd, 0xe7efa768365ff31c, 0x7033e5ec511a5fc7, 0xdd71d4406884249c, 0xa3aa62089197568f, 0x237ab4df7,
+0xaaa2fbe983731a4e, 0x4395f837f3a0d98f, 0x759572d6fc138c76, 0xcea6c33f7dc58ea8, 0xb98c7a24a32133e4, 0x4299a5bf0944561b, 0xc64213b138ea84ac, 0x116a37f33205f9fa, 0xc50c97a4179e3c4f, 0xb01a3f5e,
+0xd3b65f2f1f3cb887, 0xbb3c5208e75af20a, 0x21ce1d83744c161b, 0x2d6ec23741f5183c, 0x24dd95789e7e9826, 0xb3f8fa7d8df1e756, 0x686e4be82910e3f7, 0x6e2ac8abfb5b7c0f, 0x23d3d5e22b92f450, 0x5ebc1bf8,
+0x64e0e9d22594b964, 0x6f8e525353dac65d, 0xfcca3fe6f91f5aa7, 0x4448761797114da3, 0x32cd74a319f08fdf, 0x607436615d544229, 0x2a0aa803eaf9c4a0, 0x10c9043a1f49e8ee, 0xf984e22cfbc3930f, 0x24434d046,
+0xaccefb55ca1252f2, 0x628b251a57f44214, 0xe45aedb8b3874cd2, 0x5cb179e40c51351d, 0xc8be57b87d280ce7, 0x534626ce1d071f05, 0xeadd9f93a518746, 0xb97cdec2531a7770, 0x5028decc556d729a, 0xe081747e,
+0xbe9e45fe0e212608, 0x3a9c7cb9ef6cd9f6, 0xf02fed7d291e62b9, 0xe3ff8ddd9e216c58, 0xb03263c5a0016dc4, 0xce3eb057758e751c, 0x6e042349bbb8a1a8, 0x4fd29998c8bd10ea, 0x2728bf832a69004a, 0x29856954,
+0xeb03b21148a8ab7a, 0x26505da256dbb419, 0x9bba3e0eea4059b6, 0x1fa98883b117245c, 0x403f049234a3290a, 0xee002dc4d843a638, 0xcdde38c9f8093f92, 0xc0349bc9763fd47a, 0x85df3afffa3a98de, 0x20d71b86f,
+0xc7e2371cb5379470, 0x636571264c739377, 0xc33730f24a573c44, 0xfcbd4a187f8496a7, 0xb0771b832caaf601, 0xa8804cd8f8c83b6e, 0x13070e0e81f4c426, 0x18132265cc0692c, 0x5f2c8843fafdde13, 0x1013d2eae,
+0x80e07274d249727b, 0x7507ca52cbcc5f3f, 0xea50e4b212f4681f, 0xbf0c62daa2123731, 0xf94ed2a307c35fb8, 0x866ccd4fcd99933d, 0xaf39f3afafb4206, 0x5c5f39be2892dbe, 0xe5ffc7d95a6f073, 0x268af435b,
+0xcba51eba26c74e32, 0xd7a3929eb6fcdc6c, 0x53c626a47bd8f312, 0x6cbb14574f1af593, 0xa27d34e3865e028c, 0x30e1b802a6a257a3, 0x956d6fc85fff94cc, 0x379205ad5e480677, 0xd6359e523a28d91c, 0x1c8a5e2e2,
+0x19f63f0f2451e4b6, 0x6dda8c9bd3033ff4, 0x56d242d0419ced0f, 0xc38ad8e038ad1241, 0xed083cf2efc1e34b, 0xdacbde732590888a, 0xfeae91104e168bd4, 0x29d88c9518af0798, 0xcd0d829325c6752b, 0x27dd30fa,
+0xb9f94c1bf3bc36ad, 0xcb20871db18a0c8e, 0x346278e0e4443125, 0x5f2dcd78dd30ad3d, 0x29914e3bb7325048, 0xed0d0fa6a70991b7, 0xc4dddeb525440dca, 0xaa9717eb532dd11d, 0xac8fc6502424013b, 0xeee0171f,
+0xb632a72f2a4f8a42, 0x5459f5838cb85fb7, 0xed4d36990e04bf3d, 0xf72336a2c81b6c0d, 0x7b9d83e6c90aee2c, 0xdcd3754407c924a8, 0xb17d1fd9c0db5b8c, 0x831d45825406e860, 0xc79027c45545aae, 0xacc9bb12,
+0xc0b7f698823bdbc3, 0x8ebaf82bc3857301, 0x17c5ae06ba166367, 0x391ee325501f4805, 0x679b75f6dcb05905, 0xa6a2b60cff217b6c, 0xfed42afdf192c09c, 0x58ca54261aa601f1, 0xb6dc5f9e59aebb2, 0x276e67dbc,
+0x5965adb4310b866e, 0x3695845512a2b16e, 0x96abbc294dfda159, 0x9eeb3223039362b8, 0x907cbd949adce314, 0x5640017f3ba82cf1, 0xf153d2310f07e5cc, 0x492ed8e374db6ffe, 0x310a56fa3e3de869, 0x101ed1194,
+0xe39da49dfbe323fe, 0x612549527936a231, 0x637a032626465cb3, 0x74daf80be77ac4dd, 0x1fb87c63518246a6, 0xbbd6c38bf1a4d768, 0x932e59fa957eca87, 0x61dd2fa916d101b2, 0xf07cdae28f763255, 0x1de9c275c,
+0xf31b727d25581add, 0xf5399ff2d1531e20, 0x9192a4c2bc2df466, 0x84139d6fadf3e976, 0x5b9ed6d9133418e4, 0x1452d28528560951, 0x83b6aa92d72cb083, 0xd33a2179d2389467, 0x29d47b783fddfd60, 0x12c5711f0,
+0x288ab78dfe99fd84, 0x62aedd4fdc4fc58f, 0x8b8254ea139688a6, 0xd8b03a7929c08e3c, 0x2b1b5f5e61cfe034, 0xd0908e77deb03311, 0x328e001d960217ed, 0xc60304afc33335f3, 0xd0b122ec590ae609, 0x23ca4a825,
+0x5724e0c7dfec5e43, 0x4ad6bc9298f862e6, 0xb0a88fa4a4ef5e5, 0xb94e781b2bb1f197, 0x423cc3585d660996, 0x8a68c1f09f3e6e0, 0x9266721a3ffa57be, 0x1d0b688b0021acd, 0x913bf084d05e2519, 0x2563b621b,
+0x598ab398aad7a147, 0x410dd65892a68996, 0x4fc211337d40db83, 0x125a0106496958d5, 0x9c543f897bb29bdb, 0xca388de04e421df5, 0x78983f609a0e631c, 0xb738934374a8044e, 0xf57281ff7640c174, 0x89d0454,
+0xd55df748399ddcbf, 0xf5addffbd1754a9c, 0x9896155eb047be9, 0x978ae61213e5948b, 0x5b133117e2ef7a7a, 0x31caa85cbe5cb53, 0xa1956dbc7df29396, 0xa464c6cbe3865986, 0xac8e2df68195c343, 0x1787f135c,
+0x2b25b49c32bcdd6e, 0x176f1373203bffa2, 0x52ee7f42a8a18728, 0xd53f0d52fd758abd, 0x8627d8f8f8a2d863, 0xa3392eeeba767e4, 0xa1b3f9d113b153b4, 0xb9f2aaf035931667, 0xcb1059ca0c695583, 0x17883c6eb,
+0xf8377bb956ba8081, 0x7a659a441d0b6b2d, 0xb9cc3e9d62bb961b, 0xe2dc1b61b450f721, 0x9e8a9b6f773b7c62, 0x883e90cda7ebfc91, 0x14d7eb90f5b062a7, 0x62796ac3dceda5ce, 0x8c926f2a9dbf8f75, 0x132cd114b,
+0x23ad81e339497a0a, 0x40b6bb02c9ade639, 0xf023fb5ee3bb1454, 0x5ddbad68e14613b6, 0x8878d716311464be, 0x3c0941658be5a61a, 0xc11d9da3637eeb8a, 0x71aa8ade77bab16, 0x7d3a05ab817da975, 0x1e5c10944,
+0xf4426ac3ddfe59aa, 0xe11858667ccbe254, 0x5cc8f8844b337e5e, 0xbde40db14e743072, 0x38edac4e6fc74972, 0xdb008126d62e2074, 0xbf28b58f40331f67, 0x812867339cc72647, 0xaf27c4c149d05c3, 0x27930cb19,
+0xf24e58085eb67a73, 0xa7b19b78561fdcef, 0xf5c41f3902d96212, 0x4baee6a7834ff66f, 0x102f30c7e8ff4b5c, 0x2c1ac11778d49698, 0x845c267cbb32cd69, 0xbdbfea6b3177bb49, 0x61d5734dfeb2d35, 0x51cfed35,
+0xd887b4aec242355c, 0xb8a9351fcd29246b, 0x9174c5faffaeea20, 0xa0586aea68af73cf, 0xc0bfdcea7f113d0a, 0xbe3b45bd5f565ff, 0xb4ea9c6c2aef1375, 0x77c83252df4d9aaa, 0xbec57fd371e751b7, 0x8ec99a30,
+0xb52b57f114ba29f9, 0xd777fdbee5fca27d, 0x260b601047a94e43, 0xdaf27fd9c43a31d4, 0x3459c01425ce4ac3, 0x91d67d1535f27115, 0x2463fb1d84b50f06, 0x13a6d5a29cb34aa, 0x95f4cfb9401697a9, 0xdd93a807,
+0xcbeb06a4fe28469a, 0xd3b467f8fb20598f, 0xf198f23a105a9fa9, 0x6986336891720dd9, 0x9fe57018afbabfa0, 0x4422a8fcd3715d91, 0x677fdf0ac689bec9, 0xd2568baecef4a51e, 0xe12cc91693374a96, 0x1297127de,
+0x2e0dce6b0932691, 0x79358b5863cc4b08, 0x9ea45ae46f31d984, 0xce1a414be7a87b90, 0x4edbc4d79e810caf, 0xb5bf6b719f642c46, 0x166b9447b2153934, 0xdd1a1a9724a34246, 0x82ba4e06820d77fa, 0x1b504bed6,
+0xbf929f375e2f3073, 0x3447503c881c27b3, 0xa34c5b7f9e4cf98f, 0x22cfe4031a9f809d, 0xa6bbfba75d74e869, 0xe0c55374ee37630b, 0x83e4e11752a4cc3a, 0x26742f310c4b9168, 0x96c207433b775ba6, 0x275150b74,
+0x969e495f5513ae95, 0x822db8ee7365e2af, 0x62c017bc1d4e4633, 0x4c45517e191fdeb0, 0x6a0838ca4fad2437, 0xefe2e30606807b5b, 0x612b7152c3bce3d3, 0xab1cac324658c557, 0x5c8f166f22fb62fa, 0x25090aac1,
+0x4d44f389d3255d0b, 0xdc44e42c0d2922cc, 0xcbc1c96f7dc51c9, 0x41dfbb54391897df, 0xda5fb4f3250dc65b, 0x6a0c49419ef00502, 0x8f067b8836f4f3d5, 0x669f94fd9159be68, 0x24d58b3e6eedb381, 0x72f12e33,
+0x722b8ade6d6e710c, 0xc7cffba84683290f, 0xee846ffd39237b45, 0x67cfdac7490a1f63, 0x2a876445ec8b46be, 0x8433f3117381f707, 0x184562b5280580ee, 0x761cbfa7942389be, 0xc826b3cf7633d1ad, 0xfd307f4a,
+0x1eac3f44450b14ef, 0x274849cc3b34492a, 0xb5335a73871b6e81, 0x7646ea25790f3af, 0xa00d5816ded95573, 0xae965bb86873de37, 0x86b4dc67e05d9af7, 0x89964c01750f64f, 0xb262a8fe73a1deb, 0x25db327bb,
+0x3e31ffa8d1642eba, 0x6d94fad02e40e28d, 0x7dda965d1aea9961, 0xb8e9980b9a986136, 0xd6634bf4f93bd734, 0xeada88e795300270, 0xbb15b74a2ca36fe9, 0x7fa81553cee3c3b, 0x9d60f6d5c6f16ec4, 0x1307144c9,
+0x8758411e52d65ba4, 0xc4ada0afdb6a7dbf, 0x360c50a4f4d444a6, 0x4fb8c7e5ceac4a36, 0xa9f11d04d725412d, 0x457fe744b6ded852, 0x298f49efaccb9a65, 0xbf835cec9dfb0d83, 0x6e3819f07d50d4e, 0x2115f4251,
+0x829d32f8c64d83b1, 0x434ac4ceca41ec68, 0xcd7b5b720be7a0bb, 0x5d63e9c4fc7bf643, 0x688471b41e2993ba, 0xb1621a760e47145f, 0x898764d9e80a99cb, 0x91a9b531d9b115ef, 0xc7dc7ad33e851389, 0x2612acdb,
+0x4def0d00b503a933, 0x32031a5037521393, 0xbdb83a8c18a85be2, 0xc4ab53a146b7e4e6, 0x2845d0d7db06cfdb, 0x608f8289a8e73bc4, 0xaec2f33236e0e384, 0xa6ce8132bb5eff61, 0xb08e2843883056d7, 0x1e67d1b8d,
+0x593e3b8370c911a8, 0x9967980fcb4331d3, 0xa1277936c0281701, 0xb900546c00816db4, 0x19c8b9d8d12eecc6, 0x4ba143ed713827ab, 0xfef5b020081c7810, 0xd8f2a8044a97a84b, 0xd5f9ea8ed4ab264b, 0x1d8659f54,
+0x122dbe4d06ddda1c, 0x583a566b8c61eaaa, 0xb9b8186b767e076, 0x1a43c772b03c6f52, 0x618ad07a751d8f44, 0x1a916ce72be78d6d, 0x44dc29bf5d0b61, 0xf8b88a3d42f72ea1, 0xbd1582fc95026985, 0x182e88b4d,
+0x3beb88c9971e03fc, 0x6c48a42384d43ee2, 0x11b440db27c4306a, 0xc7679ac072b709b0, 0x9247a6eb2d373d03, 0x7186642556955122, 0x3fbc0f67f817b8cb, 0xfb0c6e5a78a406a6, 0x23e6d0caeea3b1fb, 0x66eae109,
+0x2288a0ddb637625a, 0xc755e3ccf0c7da59, 0x2f60b94230a4b610, 0x2ed5c033e70d9fdc, 0xbe086854c295479b, 0x27e57d54d7ddb33f, 0x898468b24766ca29, 0x78c0f6c8d2b92731, 0xb998cfcef7693c17, 0x60afcb7a,
+0xbb9bca3240a71bb7, 0x352e1aa83d00d170, 0x1189d5a2ac551159, 0x5e8a17684ba749b6, 0x47154454fca9da7c, 0x82c30cfe4db7d645, 0xe2096d1520b71f3c, 0x4de31d1bb8c3a438, 0x1cfee5ff6589fd6d, 0x1698ab141,
+0x8349b874dd3d1513, 0x1e83a095683ada70, 0xa0230eea033ef12b, 0x9de696f1b2af7fc0, 0x34b6c5668a61f932, 0x9e31c1c3a55857e4, 0xc6dbf0c7470d8ec8, 0x5d391091a3ae6bc7, 0x2ebcbffd1739cd8f, 0x18422e3ea,
+0xe8f945e7deffbd21, 0x1f60e12f5643ab8d, 0x1407361b533bb968, 0xb0924c85619165d9, 0xf88c0fa5a9b83980, 0xe1ac6fa81045ceac, 0x1ff9758d091691f2, 0x313a09080557ebb5, 0x25398721e39a393a, 0x1e1b2e8b0,
+0x243957be71465521, 0x880a99073e660618, 0xe666f59cd08565f8, 0x99f55a5ed95f536e, 0xf5ab4b207b0cb006, 0xa96ddac828ef4fca, 0x3fe78246c1e38a24, 0xa131a47913bade25, 0x796b227112204a46, 0xd67a674f,
+0xf88466fbd6e13b11, 0xf351502ba9b87e07, 0x61feb2b7604f9be0, 0x6edd7c4c8cc7056b, 0x1ae82c8d47879241, 0x3ce9e89c44cfcd90, 0xd989fa6d85eeea72, 0x9a193bf42b663b76, 0x28983397132b6ed5, 0x267fc8fd4,
+0x118f5106a38ab91f, 0x8eb4c4e1668a31, 0xabd482b3abf2211b, 0xe6d001b9a97d6bed, 0x1d03f1cc01571959, 0x5736420cb8caf7e9, 0x57c5614bf5c84d3f, 0x9aa4eb1f553b2228, 0x3fc6e6094f586e58, 0x247f71a24,
+0x63229ac4e1abb9f8, 0x20af2b3b7d23809c, 0x55cff7db9edda74f, 0x6fab33d971bc29f9, 0xb211bf0b51f8e5d4, 0x8fa13a6c30141958, 0x68c275a50257e12c, 0xba71e238ef349b37, 0x2dbd7e15e1641242, 0x1aff8f780,
+0x70fcbb043d6b2cb3, 0xfab0702f78668ed3, 0xa9bd8a7b78d6144e, 0x2ec55d392ccc7880, 0x65819bf08837ce35, 0x8c6b47855c57532, 0x2d01318acbaacbc, 0xc3ab98cf46e4576c, 0x1210e80eea2116b, 0x1ba06cf58,
+0xb73598d33c270217, 0x9eac8da00753fa55, 0x817d3326e12c5946, 0xfb7c40778a7a2ed4, 0x96a4566261deed58, 0xb3a6e6932ff7435c, 0x3c07897d87c2896a, 0x31f6b1a612fe437b, 0xa5951b7526d4d198, 0x2485a276d,
+0xa578ef762ccd8537, 0xfead453c6c14a4b6, 0xf2205b8ebdb081fd, 0x7ee1ba938b1f87cc, 0xe1696fe5402f85a5, 0x4958d4a914703301, 0x8f0bce79d793aee8, 0x85980f0be7a3e084, 0xec732dc39031fc85, 0x7f7c8d9f,
+0xebc0a165a06c606a, 0xe5d041b88d9c5e30, 0xbccc465a7a2c8ac9, 0xbf7eedd3f2decc62, 0xd73345a593d1f0b8, 0x49f0316fa4676967, 0x2e5ce1faaef6683f, 0x995119dc4b4b1de4, 0x1ef209e238cbc1e3, 0x13b6a6fdb,
+0xed4a2531e4b62196, 0x34033573ffa4a4af, 0x3e8e255895a60caa, 0xce0f648bfd323e07, 0x5ae56e314599f1f0, 0x2bd842f41fd8fe4b, 0x7b17f8fd140cc770, 0xc7a777de1c7ce2df, 0x135ca5caf2de92e, 0x119b630ec,
+0x626531064f957d33, 0xc6931f4da851125c, 0x441f957d488efc21, 0xddc6a797ac2330fb, 0xcb6b889dfda9bd7a, 0x83d24236e1bb91b2, 0x88bbb98e90034e37, 0xa968cb237525bad5, 0xee081b16ca946bcd, 0x1f98cc2f5,
+0x6a56a55c926c69f9, 0x59949309ad8517fc, 0x16d117b0dcc2c34a, 0x8bb3d49d0228dec8, 0x3b821815e1b26abc, 0x62e1c3c047ba38df, 0x79136f57b3af5403, 0xeeba135a8a63d92d, 0x3405c713297fe859, 0x1034762ae,
+0xa81b9d0bd9794f2a, 0x152eff0727ecc6a2, 0x43da10f86402ea8d, 0xc2281e1f9a897d12, 0xd8947272664d4323, 0xeff7a4289b1f6e5d, 0x20e2f47ea539f80f, 0xfcb51c884405edfc, 0x6140a989ec5a5a97, 0x1a29039f6,
+0x466752db888746c3, 0x5aa0d0d491fe342b, 0xb161ee2ea8382e20, 0xe5861280c4425a12, 0x9e8bcd8910b08402, 0x61bbdff6201728e3, 0xdcc80664731905bf, 0xd9e73213e208c372, 0xe1648114d890fb6f, 0x13fcbd654,
+0xed70dde18c40230, 0xd5d5cc81609398b9, 0x4bb688c6580053c8, 0x7fc13be5f5daf546, 0x8a7d0a8ce403ce06, 0x9cacfd2344800039, 0xdff6588a57f6ba73, 0x34f5b4af231af8b5, 0x9cb558320ef949fd, 0x1b11ebc5e,
+0xfb97da56dc9f165d, 0x9eecc1365c394cf6, 0xbab27a561c150b9b, 0x50a84799e5e67a82, 0x6e6761a9562fb6bd, 0x570528b66ef8ca2, 0x3dc7b35cdfedd0c7, 0x9ab64e3fe50de00b, 0xb3d295640dbbb0d, 0x10314ebeb,
+0xe466861c2f6ae5f2, 0xc0f782ca997b0151, 0x55c2e01393745c86, 0x57a177bb2976b3b1, 0x4cfec1b4751081f, 0x47102ecfa454591a, 0xbe41b3114df6f709, 0x8129c3dbb2b38b9e, 0xfcfa5c75c00f9d85, 0x1869291ca,
+0xcb2c38befb077b19, 0xc29f9a8673c49eeb, 0x19d415dfd550ec30, 0x8e305d632ffca65f, 0x5b1db75e0225860c, 0xe3ea2b44ad95d48c, 0x787a6a2367618a5f, 0x5da94195c4ef40c1, 0x1d60c3ecf450733a, 0x2697860d3,
+0x358deade0cf00a79, 0x44b2d9387efdc9b1, 0xa1f905d088942f60, 0x7b19b26205e56ed6, 0xd38343c73d7ebdec, 0x98c5a3502d996d57, 0xf539043dfc2b983b, 0xdbe35d091ff79f75, 0x2b76e0b2939b797a, 0xc1eeb68,
+0xe4f07b8ad0abccf4, 0xa9efe1a2c75e25b6, 0x62fbc2faf1966a8b, 0x63b417ea0503f81, 0x14e191f442925c92, 0xb8262403c6a1d150, 0xfd75b2c12e8b86ee, 0xc19f606e5936283c, 0x9db21ed91361df48, 0x848731f,
+0xa0848b113916ce06, 0xa5ec78153b9f554e, 0x4633072446ba0e9a, 0xde28144056b0bb09, 0x66a4a721ced7ebad, 0x2e3f74f7e8f77edd, 0xbe4004b181b4b8a, 0xc1fb0a1dfacdff94, 0xacf82e38384b0066, 0xc732e9de,
+0xf6031348d0a6ca48, 0xd9172190e6868830, 0xadcd59dc7c7ea701, 0xa87d6be21240d807, 0xb0e7c5e072add035, 0xba1a6a2e8f30264b, 0x2535a1aa1cee498e, 0x4861ffdcc8825364, 0x79190cf61944ba6c, 0xd701f167,
+0x5d4aa46aaa2e36e3, 0x4423483e7cb1f87e, 0x7b7cb006cec47ff2, 0xd47d0ec7d5b00373, 0xccbd6e3d04554996, 0x7215fdda4ac80119, 0xa4b200bc39d46c25, 0xdd6b8751b57031c5, 0x129021e432ff037a, 0x17dcb9c88,
+0x197233d3c6d769c5, 0x2dc7954e2a4c2e64, 0x4b9794409aaf7b2c, 0xc9a3342d39f47066, 0x60909c65e5b4b331, 0xb9f1d1c99d16cc46, 0x334fd59231c6bd2c, 0x1727c5086cdc3d62, 0xe998e6255b87c2b0, 0x124b4d900,
+0x1cdff1fb965a0f3a, 0x5b68547f68ef2794, 0x6d09c79f786c7b97, 0xfdc7ea4fd7a6707f, 0x55aa9c78fa86904d, 0x3b44b70db38162f0, 0x24f88c20e0c87668, 0x6e2d53ae21888199, 0x6cd0010cb02b8e8e, 0xa4f156e9,
+0x8777da98f8aac1af, 0xdd6cdfe5c340e83e, 0x22e45d235a68c4b0, 0xadb380ec97d7b8fd, 0x8131798b18ead46e, 0xbe76189ae8c6ca6a, 0xe5079e13171ece7c, 0xf6af11d56128c03, 0x5756ab434945517c, 0xcc271c43,
+0xcd38230c697b6d57, 0x95d92f9c57f823b0, 0xe5cec4beb014bb2f, 0x7a6df0407f2bec9, 0x7510fbe6f579f2e6, 0x21d6508bdabf1987, 0x939a668417a8a355, 0xb81728cddc3154dd, 0x7cb770b891dbe69c, 0xde4a2ee4,
+0xc752bea5d1a152ba, 0xcf8ee335dff8f6e5, 0xf6c656f7dbf8e929, 0x92c6246cd99e8483, 0xd0f8d6ca7835b529, 0x3203c38ceac7e6a1, 0x3f6331b3bfa032ef, 0x6fd4ea5b1aa6e1ca, 0x7c0c8d1c66db80ba, 0x85bb761b,
+0x586f0ab3ed737560, 0x6c877ec8b9d2c4ad, 0xaaee192b99edaf07, 0x8733bd2b8bc0cc8c, 0xe08609df6583cb54, 0x8c91a7050e3dd31, 0x74a5b2219017e453, 0xe77a860b69848428, 0x3becc5719bd61958, 0x96cfeb3e,
+0x118b645e453f111, 0x53ba074f7fb42799, 0x4d4d7f18cd121bce, 0xea435299a923a47f, 0x6027e86bab018058, 0x367492672352521b, 0xa14ec060c24102, 0xb6c6e440376b58dd, 0x5d88b3493a45d67, 0x206a1afee,
+0x4ad897a71a1ce266, 0x617efbc58d3c430c, 0x667d4ed91d05018a, 0xd9ea35af6401c328, 0x5ad2fa579356c6cb, 0xf6cd307668531497, 0x898187b826214830, 0xd8fbb5a2ba9ba280, 0x1b7f94d47342a33, 0x2153647c6,
+0x997dc9a69c72560f, 0xe1efd41121788c2f, 0x7e45564b99c01156, 0x72b3285f91660406, 0xc2b6642882bcd7b8, 0xfa91df48775df9a2, 0xbdfa0ab6f422c059, 0xecfeca8bd0e2bf83, 0x3fcd7a0d14688e24, 0x151089f1,
+0x4a5fe7a16618d479, 0x62ac2a3f050e8371, 0x6b7d73e402f2d825, 0xeac28fa295f91d7, 0x797659aae8a7c281, 0xab5f0205f73ba5e4, 0x391e758d3ca6454, 0x47a60b414cb5194d, 0xc67e227488850eb5, 0x173c2b65c,
+0xa2813addad572dc5, 0xc83cbe9f920c1937, 0x5c53962b386ae37f, 0x5c51608a80fbd6de, 0xb6e5e0671e7097df, 0x5c110e820f2960c0, 0xcfc91fba6c9a6981, 0x68c2a219f268d46f, 0x79768a19c0afb50f, 0x22f69dd52,
+0x83966e6d246a487e, 0x47667a06fc825f99, 0xfb7b43ab34c1b3b4, 0xbde9bf2cbb8d1155, 0xaeeffbc995e4d6f, 0x678e586291ef9692, 0x43d65fef713df9a7, 0xd8bde6ed690b1457, 0xca4e5557d3ef9df6, 0x4da9b2ff,
+0xdf7679f263c5367b, 0xf07215c2c24b7617, 0x783c438e6c70c25d, 0x5a88957a294938a3, 0x6c7497d5bd1e2fa1, 0x1238c900aa016866, 0xbe83467bbeaf1ed8, 0xf2062fad3e7dfd09, 0x2ebf609c61021ad3, 0x204b7e80,
+0xe360c56b48fa06e9, 0x24a2fb5708e2a2e6, 0xa7b0e6f0657a69c6, 0x9b2ffdfe8344d651, 0xdcc1c0594281e9a0, 0xf1d69a561f55f240, 0x37b4e2650b4ac6d, 0x72c97bbd811e592a, 0x206fbd0622d5ead5, 0x88c12e9c,
+0xc2eea573272a20be, 0xb28e2f8dbd9ea1f0, 0x989110ca7d2c10d, 0x3663f66b627c2acc, 0x44fdc3c85bfefb15, 0x740e13b24d1d4006, 0xf4ce169c3fdace55, 0x9fa190e3210ed53b, 0x2d8304951f4538f8, 0xa108b9d,
+0x3fd24c6f6d84148, 0x9b7ac10bf8632b9f, 0xfdd17d169d7be190, 0x53b133c1d444b1, 0x98e3481dd95fd93c, 0x9671afa18cc4025e, 0xeb2c35c1adf72188, 0xf788ccb3c9d6d24, 0x2cb861a67e567011, 0x18a93e415,
+0xeec769ee8e820bf, 0x96bd1d9b61ffc244, 0x1b33bd4aa20345e1, 0xa4d246034d8edf8a, 0xd6736b4a6860c2e0, 0x2cfbd9db45c1f96c, 0x8f81c5c5cc90d38f, 0x4ef6cf183ae5d04, 0xb466c865a3984eac, 0x1037647a,
+0x672877a82905feda, 0x562bb5e717de2090, 0x3c66b45cc65fe081, 0xeaab66b5c9cdbd4, 0x70dfe2a0a84ff22d, 0x79d0f9346d7330fd, 0x2d7d61e363af4471, 0xba3f5fd70a0fa7f9, 0x6e60c78203589745, 0x1df1926b0,
+0x2c904f2f2d67f8ff, 0x22a27260e9e25ccc, 0x11e8bf45dc11964d, 0x87e8edd1ff00cdc9, 0x99883d80359740d5, 0x3fbc09117f0380f1, 0x24951029907e392b, 0xd151a287fc2eec3b, 0xe9ffe870a54de763, 0x1ef7445c4,
+0xedd701e7d2f6d358, 0x8979d59dc1e3e70d, 0x8f4d57b9a6866cb3, 0x2509fba88990ce05, 0x864656e1a3c4d83c, 0x720792ae26f11ff4, 0x4c4ed39b47b35ccd, 0xced63c044d3cc2da, 0x66a6e35390f22489, 0x222ac686f,
+0x535dde59814bd941, 0x3f81e565d0fd96a, 0xed387d4d647e5003, 0x70159dfdeecf20da, 0x4a6b8c7506024fc5, 0xc96f0b4f1c5000f6, 0xffc27dba73718e09, 0x2cd967c1294be22f, 0x2e44dc93435801ca, 0x1324ce8b3,
+0x5b921c8dd9e2e889, 0xa3a498ee8cbd9048, 0xb4a7fe031193f90e, 0x5c33c907d01325e6, 0xd3410898d3438532, 0x3efe9d6db605d689, 0xdc592dbd872770a5, 0xefa5c498ca5edcf, 0x204ce7a34abc7b06, 0x1117eb195,
+0x5c79a94bc4dcd0b2, 0x27a1eebdbcf61ce, 0x87128cf8a82d1209, 0x45d25ef6cdfcad8c, 0x4a83f66c6bcda0d5, 0x8420dbf01d1ba919, 0xa6e00f5763edf92a, 0xe8afb7295a6e9289, 0x810079bef45b068, 0xf09c0703,
+0xfa4a1ed10bdbdb7a, 0xb408f85f91af1187, 0x6624e758af9e0aae, 0xe0889a08994b6346, 0xebe5b151d8fae587, 0x4971bafdea66120d, 0xd79fd832c61ac158, 0x54bfe5591fbc330f, 0x3245f9901d359939, 0x50cb740f,
+0x8ac0c99cee4bc1db, 0xe3a4a92dc8872acc, 0x8904fbce62ff5ae9, 0xc4643e023067a0ab, 0x91c703d13b8c8528, 0x8788062024cd559, 0x9cbc94b168c724f2, 0x1c7ecd52bbb7e89d, 0x1e2747c9ff85f2f0, 0xd9728841,
+0x53a53d2b728850e9, 0x459cea717a01885a, 0xb4e4f9b904b208f8, 0x2a5b68b732604c1f, 0xcbc4cfe33638c149, 0x9e47620a0692182, 0xd5a769d614cbfe1f, 0x5477b7d4099da776, 0xf3a10277d5956831, 0xe49c25ca,
+0x6a2c4613c095cb64, 0x75f631cca282c149, 0x155d9a2363b8de8d, 0xc662e6166b626746, 0x9ed8d69534ef32c9, 0x8671b3e0e50aa82d, 0x4ef64c712a012e1a, 0x76cccc4e82b8288e, 0x6c9fd107d53c4cfe, 0x1182f137d,
+0xa7ab0f869c23b128, 0x42cb9e87a1ee0485, 0xa00c400e20f97e91, 0xe46da158d828696e, 0xf0d3031e1495c3c0, 0xb065980aead22a7d, 0x9b14ebc7f718b2c5, 0xd4430effbb04a6c4, 0xd385d2df2a08d5fc, 0x11b9c191c,
+0x1b852d8cd4ffb9d6, 0xf88152affb411c6b, 0xba6f7c7adca15f58, 0xee4c3a3cfc5dd7b1, 0x7282cef43e961d00, 0xdb3625c7fadd611d, 0xf33a8f454947cb79, 0xc0f014b6e9af277a, 0xce10fc498479928a, 0x24457e13e,
+0x9368e11ea6c04bd4, 0xe83ce46e4f810c13, 0xc3e0cea96bf8b895, 0xe06341a43b3a562f, 0x5e26ab88a49942ce, 0x67c6ee084ab492b1, 0x62a0ac374e5f23ea, 0xaf45a91ccdea1d69, 0x5c0731d2e0788d0b, 0x704e8f33,
+0x1cd3e2d828980cda, 0x316f4bff4de563c9, 0xd768950008832faa, 0x8e5d7ec29fb65314, 0x21372dc0b3a9e3ca, 0x6e06d5f190c2cbc4, 0x3ed11f51f1222d2, 0xf7aaac04f98500ff, 0x5582529efbbfa8ad, 0xdedf08b8,
+0xbeb2b93ba879060d, 0xc1961979f527fae6, 0xf5f9a89132e3d846, 0x72826fef034c2da0, 0xc48571fd1ab12ef5, 0xff9007ded3522a48, 0x7947fce78f86f5ec, 0x576a74d9b71029a0, 0xfc45dff68fc290cb, 0x2139da471,
+0xd05a3de698dc0f1e, 0x85927ca74c85200, 0xc454129733409b77, 0x878c3255545e871, 0x90ed57b8f80ba6d2, 0xab1760d72bb84a71, 0xaa5e9f86fd6c3f54, 0x6bca6efd74c3544d, 0x7339c7bb6d2e3f1b, 0x154f8bd28,
+0x525da8a092085d74, 0x66f89c6d97b6366c, 0x9bbbee97cd80c303, 0xa6ddea67b7cfe4cb, 0x3d885993b12647f, 0xa04442dbff141b65, 0x6c1d4abea96e2e72, 0xdce3659b7ee3b8bd, 0xf1568c7f5d71a2c1, 0x49d9838b,
+0xddbf178307301cba, 0xe0fe236c003868ef, 0x58b4e48a7701e296, 0x688964cbcd27f6b4, 0x5a12e97f386384f, 0x53fedc9fdfde48a9, 0x34de1a085537ef22, 0xd298ae95fbfcb930, 0xa19337e1bdbdeeae, 0x1fc1bc5b5,
+0x5fe38ce6d8cd07c4, 0x146ced1098945e40, 0xe905759fce7fac45, 0xd6873357c9b1bbd2, 0xe776abe0e207470d, 0x2f58a8818a982877, 0xe7d1ca5138c2575b, 0x408fcb4a393574b8, 0xba7828185e39ae1c, 0x263cdaa10,
+0x48c952783a4db345, 0x47bb189c7cf2dc3f, 0xec3462b5bb66644a, 0x57d1441f2955a6ff, 0xeeaec6c7a4a5f4, 0x238d16f4e6c328cd, 0x579d9e4c34714a6c, 0xc82ba34a51b5655f, 0x99579830b4f57ff2, 0x1914a25ad,
+0x38133d81010290af, 0x7f420ead2e85961f, 0x89e7d75c588f0ea2, 0x572043b4cc859ad1, 0x111e9e412faa5e6d, 0x2b55681326a99280, 0xd83d2edd98e19684, 0xf5e92292c58eafd5, 0xa975498522d04417, 0x2031acadd,
+0x847a916847e14566, 0xedf232aad26e5336, 0x47996fb9cac83c4c, 0x499b2d01147c04b9, 0x15b88d508a4c4217, 0xb0b137ecc7e2662d, 0xd9da4db081e4f62c, 0xba4429c8cee059a8, 0x7f60a57be8c8cde7, 0x1f4d650eb,
+0x406d36370d63437a, 0x212700927eb11bf, 0x9ce62b490f8c4dc, 0xb00d86467f6e0034, 0x27230d1a50627cd7, 0x1b9bba06a04fde2b, 0x101e8618b1ed36b9, 0xe025670066c58a1f, 0x2bd885d6aca4c0d8, 0x20dfa80fb,
+0x11390d363b53ca93, 0xaba7b6a1b8329406, 0xa07f832e2b04f260, 0xf9ebb61fd89e8148, 0xfad9831dc989a566, 0x65e0029aad7fc4d9, 0x6590fe397c328d9c, 0x2edcd33abf8e1c2c, 0x6d0cebb8929c5f35, 0x1964b4b10,
+0x286806c862875ca1, 0xb882df17ad0a68b5, 0x83ad8bef989f52df, 0xc90b225dc95f234d, 0xbc6249670857d609, 0x804cbf9ea1d7407a, 0x3e4b782a798637aa, 0xfa510b1a2f42c5bc, 0x893a6de5d61dd661, 0x1d02c7dde,
+0xcd44b5fea5866de, 0x8a598ec7af1f992e, 0x57db3aa0cb78049e, 0xb93ef491637afc52, 0x90eab190eacebbd4, 0xeb958dc62a32bb44, 0x619064e70b379da5, 0xf6d3af10e487a73a, 0xabc1128cd396424e, 0x1e87a693,
+0x2ae803cb2627bf8f, 0x30deadd1e7e99126, 0xc337508a7733df2d, 0xa5569be32f80cb57, 0x878e089798d12fbf, 0xefc19cfd75bd7a5d, 0x2d993c82c452a76, 0x4091e3418c676df5, 0x60fdf0925cda0313, 0x1f930f44d,
+0x2d38b28d6bf6da71, 0x4563cb9a73649fcc, 0x96a08901c1b451f9, 0x965f6245bdd13b10, 0x13b8dc8e87a84e82, 0xaa2017a1ffdf5962, 0xaf057b93bcf22991, 0xf7fc15e659fa8d90, 0x62f94f5ab8b2f1da, 0x578138c0,
+0xadea6ec2bb2a4fdb, 0x69714c7b92d500ea, 0x29fa4f7d8b9c7275, 0x7a4de8400f42ec05, 0x8e54b232316f7ce8, 0x89ac4c561bb5da5a, 0xf1e4f76c934ce30b, 0x4a4623d72f759e22, 0x42cd6148c0f3304c, 0x230d46de6,
+0x265a9a597a3a4571, 0xc1edacca8af7a888, 0x111b5d853d8f0cf4, 0x688dd5d6aa5998e6, 0xf44b0f1ee6d60ee3, 0x6ec83b7f3139722, 0xc2407f182e445dd0, 0xb93a3ccd3f7463d5, 0x6ab94ec01de93e22, 0x161df191,
+0x731b034a76793e5f, 0x4ddb260d23230a63, 0xc27b9ac17f9c7034, 0x75b44a732ffead8e, 0x92dff6e9a95c920c, 0xd3de2e476bf3e80a, 0x7ffe5b668207c547, 0x3b0c1d4839e8dac4, 0x59da42b4e07c5097, 0x1c37782b7,
+0x2e0287df5f06f5aa, 0x1c98400fa2f6077a, 0x18c4fcf412ba60d6, 0xce00fec65d23f7ec, 0x5b1aae839fa495f3, 0xc67cdc29184ecc4a, 0x59d22bf529312f9b, 0xa92c2ac432e7d2c2, 0x647884a28448e4c9, 0x15dab25c5,
+0x1b9600f96a5ee480, 0xb9fa35c651c8176, 0xf876235777972c3f, 0xf3608bae3b0662e0, 0x3b82c151326f65ed, 0xe786ca9cf5b13268, 0x7a8424de2b06ec55, 0xf490d8ddb5ff5180, 0x6593b6bf996cd455, 0xcd03d763,
+0x16aaea42e6027579, 0xa0efc3a3a4ff4eb7, 0x6411bbe7a29bef15, 0x8cc86fea2104a4d6, 0x764fe5fa693d71f4, 0x9933c211fad559f, 0x7e2d6c2b7dbfdff8, 0x75fd6e5ef56573f7, 0x99752bf78cd2b12e, 0x873139b7,
+0x9b8d19291ea041dc, 0x97dcc9ca2c67e3fa, 0x49345ffe9175c157, 0x86d282adbb0a98f2, 0x1c68a539bc76bd2e, 0x9e93afd4b1f8e4d1, 0xfe504d14421b0469, 0x4d9134517aed65eb, 0xaba3f49280143768, 0x184cc90e9,
+0xbd7f81a2ee31c07a, 0x895dd9dcf2496f21, 0x571e4a60c65a3c37, 0xabe0b0c5ba1b365e, 0x4e9577cb6d45eaad, 0xbdb6c1d906ceef23, 0xd6efda95ce77473d, 0xfb18d94b519d00c, 0xa61307aff99433d8, 0x213688d36,
+0xfde6b9085d1cc666, 0x8d53d6affa39aea4, 0xa3d92da8bd888842, 0x7996511ee8d977d5, 0xae5ebbebc619e14c, 0xb784cb4fe93f6a25, 0xfdb511b62b4f6222, 0x4b9bc4ae0083e999, 0xd74b3b65c3074177, 0x1a26c68eb,
+0x4ac7ba5724312d64, 0x8b154fdf8da8a3d6, 0x77194c59910c99cb, 0x55c37b4f009f09a6, 0xe9125378afc5c7d, 0xf16721df30bd7922, 0x61489a841ee8c5b7, 0x4165f659b01eccb9, 0xf4c57933ee03265f, 0x254fc542f,
+0x1c0ffc4540ade9de, 0xd103729fbd277b84, 0x1a11e7a69e1c2a9c, 0x5b1f539eecc1f720, 0x7d0861dc2fdea64b, 0x21a39d0f441afdde, 0x34af01495b08487e, 0x6bf6cc2b537d151, 0x88770f4e599aae90, 0x1c75130a3,
+0x6bd306af30bcf8d6, 0xea7c39061227a6fb, 0x6f866c298b12e7a9, 0x794f70ce8f3a1c52, 0x19829303c9efa896, 0x939a4e0dc8eb0e00, 0x85d9a8cab31cec66, 0x3210816e5aa0694b, 0x8d431ceacb266951, 0x8964a06e,
+0x8f0f0f4c82d338b6, 0x6715fcad3e1c162a, 0x56fe8f00572d47d8, 0xbe55f7877b9f5307, 0x5b32af136e45f36f, 0x9d47a737235a9522, 0x7ddccfccb6313afc, 0xc5318dee66154532, 0x19ea2e2e96e62a1b, 0x1ff1f1f4d,
+0x45dc2f9dfd48b0b2, 0x9b88d4b9c3095a64, 0x408c761ff55245d1, 0xdbf7ff7a40bb2033, 0xb61031ec4daf6279, 0xfc38c27016aef8c7, 0x5864c20d3d487518, 0x6c3bce942c497c73, 0xf44aa91b9b97af19, 0x121b47955,
+0xe641aded28fb25cc, 0x83343e6bb2d7ac54, 0xc5d3fb0bb51563f6, 0xfea9be24f7ed668a, 0xa8ab767694dbcdd7, 0x9af8301840447a5, 0x7ef5c626c2d5f5f2, 0xc0fe7ebdf75bd1fb, 0xccdd48538d3cff87, 0x1209775ff,
+0xff50a0e9ab2f88eb, 0x94abc8e832da2eef, 0x3c23c27905670366, 0xcfbb539aa2e62de4, 0x23f90f1e2b82e65b, 0x39040a269433eec2, 0x3e6bbd08ee143e70, 0x3224c75285b5d762, 0xd1d56cef17854577, 0x24c513b32,
+0xd2f92cc6799e8c52, 0xb27084f14e27b342, 0x55406bfb7f41e2e3, 0x182f0ce26e1ba88c, 0x43ff1358fc93150f, 0x1145a5aa0e37dde5, 0x4ff9f82d7ea69d75, 0x428cbbe74416f06c, 0x776fc4b8244a9031, 0x195330765,
+0x5d73831fd7860581, 0xeca89719b216b70e, 0x78db7767e4927fe1, 0xada1fd5076233cac, 0xf2067f66ec8f4212, 0x2a41f50a19850316, 0xbd9e4a78fcaa7e57, 0x1132e714989a49c2, 0x8568a6d45f8b1d74, 0x223374ec6,
+0x2ba264e693ed0bb9, 0x3741896ba82a34ab, 0x11c8d895650e5b65, 0xef5a5396377483d0, 0x70acf85c67a6e970, 0x80b2b8bc430ac127, 0x578405d522a0835a, 0xcf8d43e001c7fa41, 0x9c8a36bbf9c3c91e, 0x9e53e7e,
+0x5266808648abec33, 0x542d94266135e64c, 0xe020c25984610a9a, 0xf8305787c4e0af4d, 0xa5de3b1cc7a67fa2, 0xa1e7fea08ff8403, 0x951c03180a5767b0, 0xeb3556eb7b9d1d06, 0xb42dc2a73603c691, 0x502f6e39,
+0x33cc904959596cd, 0xb7a5b2d80042e4d0, 0x9ea55ce565e465f6, 0x8e65171ffdac730b, 0xe454d74e022cb10a, 0xb992e86d56b0e911, 0x9bcd1120e1a598b3, 0xdba8747105ba1dba, 0xb81a232862043752, 0xf038f8b2,
+0xfcf19528c1ea9e7, 0xf4e181d5baa4c173, 0x73a51d69756eddea, 0x99e6183ce1adf011, 0x664aa20d910f9a, 0x1ee2333e02038dd0, 0x696d22db873099d3, 0xe5ef4b3319190fe3, 0x358dc768076bcc85, 0x1e6a56939,
+0xcb814bdd351611a2, 0x60cbc73cb7dc1f17, 0x2ed9befb74e9c13a, 0x1240094efdc85ed5, 0xfea464ab3b4ba205, 0x164989f76ba76072, 0xc5ca1ee2c3e15c3d, 0x41f707a9be4c0031, 0x715929e3376453d0, 0x1549e67d1,
+0x13afa4eb47ac6884, 0x205940c30016de94, 0xc2c75ea8899554fb, 0xdfd5bcb3a9782425, 0x3b7cba576a005751, 0x2a788682bc53b363, 0x4eb16145b455751, 0xc72267660c1ad0d5, 0x95eded83fb0f9f42, 0x19240940f,
+0xde6627b1eca5dc05, 0xfab6a2a245d02084, 0x3465f7d648ba7940, 0x32251bdca883d841, 0xae17ff33d0a4a081, 0x8d723a2188b8729f, 0x79eb7100c40df2b8, 0xc6d209ce28d6fa9b, 0xc6306b2240e45e15, 0x1f1d3358b,
+0x9527d6b49a9f85f9, 0xf0fb9e2e9508f8d8, 0x66f2eb200e39309, 0x80268a544084c237, 0x2361c33fff023457, 0x2de55ed3da731d0a, 0xe81be6332911a936, 0x10a051b9245c3d08, 0xf3f238db67f2e4e9, 0x450bc0b2,
+0xfafdc3f9b2d05b0b, 0x57154a0d2d1a0126, 0x928923c69b911cfc, 0xc5de9ac25bd7a069, 0x21c8b63949cede2d, 0x7592c38978701f5b, 0x39a6b1a099d2d84, 0xe4b76788466af12a, 0xdb980b1e80da66d3, 0x1537ae30,
+0xfa358744a2b55e1, 0x2f2a15f48c02d6f6, 0xb19b165bef61dcee, 0x97187ec031d35c8e, 0xb807d9106b4158e4, 0x7d217de0cc555137, 0xbdd5f0f33772157a, 0x7f4ab1dcfa4fc4cc, 0xe9417beab9b6d87f, 0x24fdc812a,
+0x46a2384a3c4b64f1, 0x504d2d05f512b0bf, 0xe82df06bd0ec7b61, 0x86a2d1038d662abd, 0xbd372a256d1d355e, 0x83f76b8d0ca51f89, 0x39234dc1eaa9482a, 0x786389f685577fd, 0xa37b6b7de5218a83, 0xc21b9ce6,
+0x4d31080e1c52c201, 0x26a1ca4c293a0642, 0x9f405653904a33bb, 0xf4050704a11387d7, 0xaf50aa8251590294, 0x339ec122b8d142bf, 0x1ce96d29a47305d8, 0x699034233f63b815, 0x973be414a6477c5, 0x1382f3cc6,
+0xaac244a8ed6b0e7f, 0x4db7621a2de0de90, 0x3dd02809373dfbe3, 0xe46c6d79addac21c, 0xd3e70f8101f08a8, 0xc5ecd27fae497e52, 0x16056fb8ee44991a, 0x67c8926153551abe, 0xb8862badbde97fcd, 0x19fd260e2,
+0xea170f6c1e391d17, 0x9e158affc9eed263, 0x4f1459be992ce246, 0xfef2896d70adbee3, 0xd13d84413d8e94dd, 0x8f26607b59cf29b0, 0xca924714525cd4b9, 0x1f2ac32940a4c31b, 0xf2b5edb822757492, 0x1ffbd875a,
+0xc902ebb5bc0232c3, 0x6d4a00de0d6acba0, 0x87c4e2a8b1c3ebe9, 0x12e11ece0bbdcd65, 0xf921a97c60663b5b, 0x8651fc7678f5a620, 0xacde3fc3bf110aee, 0xb6e4577519b0f284, 0x33cb0d2353d402e4, 0x1fa4ee2bd,
+0xf2f44246583bb025, 0xceb2759edc154023, 0xf782bfb9219f8ce6, 0xeebad6f9dfe3d8e, 0x4c1a7a44a1f06ed8, 0xe181473b887fde0f, 0xfec204603f4287f2, 0xc37fd566144f7d0e, 0x9c36fafeb9186100, 0x1c98cabfa,
+0xccffead367874131, 0xddf649f7f3c2c65f, 0xfbf57006a57a56e5, 0x7e17fca3601b6be6, 0x7b4ce0a4542b76b8, 0xd0f2a5b89a65bd6f, 0x69a15c45534c2a, 0xa29cb42b4dcf42bf, 0x7ebd95820c8cbaaf, 0x261d50954,
+0x1c217f1319667feb, 0x88f03f329ff02141, 0x704a53993c055c46, 0xf5050487143436ea, 0xc5aad140df97cefc, 0x89ca314101eafa80, 0xff65c32b32cc489b, 0x860e9cf29b288af5, 0x40346c6a0daed5a6, 0x155fed12a,
+0x9215e2387449aceb, 0x194e20aaccb901ec, 0x3044b6991cbb4f26, 0x391c470460f98c42, 0x83e2d60e0c0bfd64, 0xe9ed99fa5e8bdd02, 0xf30fe554a8077891, 0x2fe3556ee88a0bd0, 0xdf4b51c67e4486e6, 0x14faecaa,
+0x5d1da97f795f7947, 0xd690a6c105d17e14, 0x348cb4f9fdcff1fa, 0xa19e89014cb72b8f, 0xd346def98b398b10, 0xdf9fc49f154e60b5, 0xe8985e47c1490359, 0xf500372b30d66ad0, 0xf9a94b8616bbbc19, 0x878934f9,
+0xb094ba2d80101c3c, 0xeea4601ba304d0ab, 0xee124ee5ba28c899, 0x2e88352511188bac, 0xc30a321cec2c1584, 0x24c49a8d60e14934, 0x58958443ff5c9ae7, 0xea2de3ebccdf4760, 0xaef6ad16d2f1929, 0xa42c651d,
+0x64e1775f4385ed3c, 0xca6fda24efdc388f, 0xf37bb7a84bd51d29, 0xdefb04d958e17010, 0x2106f2b6c7e66111, 0x7536b2389282c5a6, 0x631c9018d75d8695, 0xa1ef562f36d71ae8, 0xaf3dd6a990f1acc8, 0xac9fa288,
+0x13d5fe31a5bf86e2, 0xf9e7e10b17782320, 0x2c4944276e4798bc, 0xc787bb5b45774b2c, 0x5dc418b82f17e148, 0xc7c3a91f3d8053d9, 0xd87416d891380af2, 0x9a5e993fbb75ddf5, 0x80f665a185cde07c, 0x3852fc0f,
+0x836e5c1e380677ff, 0x2ee95606442e756f, 0x4b15364d29dab2bf, 0xe0699a2c5629ca77, 0x25bcd03cf9d62813, 0xcfa04bbc54b24599, 0x10021eab3825c504, 0x25e2ff8efe067439, 0xcb3c44ab2fc7b931, 0x10f86ab89,
+0x786f2d2e4d43ff0b, 0x237567d2b58b32c, 0xfa69b353ba00fe54, 0x8dfdf546b8c0af39, 0x4ad62b98b3936b5d, 0x4d51eb100453d948, 0x9a5e70c93242c78d, 0xfbbc8b6e541805c, 0xcc68d71c08eb8b44, 0x268368e63,
+0xd2f35b61718c8bf4, 0x4b42a67920249ddd, 0xb5a29b1946eb140a, 0x1927fbc0344f1d69, 0x594ac822b6cb43ba, 0xee0ce96a07b42eb3, 0x75e5be1fe625ef5a, 0x556bd6549d0cef4, 0x6dafb9728f6d862f, 0x1a8f33d83,
+0xfe251ac80f4dde92, 0x7a38d81dd6f518bc, 0x50201dcfa1ecc1f, 0x1de0df5a3ac150d6, 0xb8f49e8612eff6eb, 0xac4436b4eee25d3b, 0xad4736e76c524a9d, 0xeaaace8a2b6741b9, 0x1cff1edaa380d285, 0x120912d9c,
+0xbe375f31bff3c8e2, 0x87bb64ccf3379a, 0xed9f259b79509642, 0x237e10bb85aab5c1, 0xc10350afa6463b6e, 0x4ba87efaa01a12fa, 0x2c6d7a02f65baa10, 0xe275654ca1808b77, 0x8f6d1ff4734b66dd, 0x26dba772,
+0x7aeb98072a519ebb, 0xfe8c237a92aa30fd, 0xac84ee6d7303e592, 0xeb244c536f087769, 0xa6ae6c5c3db2c233, 0xd977026bcbc21a0a, 0xae4154e194ebe492, 0x6108e3ef9b09e7c4, 0x605faa477aa7cec0, 0x5bbdcfa8,
+0xd4513c9cf0a22106, 0x4baff19ec3154e10, 0xd00fc3abbaeca88, 0xba14ed29abec934, 0x5767348c4f83aa34, 0x86079254770be6f3, 0x2b7c4670b34ef8e3, 0x25d74d156cf22118, 0xb25edc5aa46f8d99, 0x19d83b143,
+0x654aa5485bc2f2a8, 0x775b560ce60946e4, 0x21a9447db19e1f13, 0x87184691fcebdad2, 0xd08950726133425, 0x11702ebe0029a93a, 0x4c46139ea8a08a09, 0xff82f19193f2d07, 0xc079f343e2d3028, 0x2219c8900,
+0x2908c47404675b87, 0xae5bae8e095502dd, 0xc652c55f07c9a5c4, 0xcf65a2d6b10728d3, 0xf84de5e20d737a2e, 0x77e6f7a1a9a1c6cb, 0x181dcdc0b1ab0665, 0xedf8567ff19ff6fe, 0x57b6a609d4d2728b, 0xc218b18a,
+0xc22d46cc2582ce0, 0xf71722995caaf79e, 0xefb293a8a2ff3b25, 0xfaab7a486712bd53, 0x94479dd05552a0b8, 0xa09e13b5f8d41d60, 0x19549c46e631b157, 0xddd32f939054882f, 0x30689dcfdcf38214, 0x491174a8,
+0xdaefced70deeced1, 0x9b2f472e90387e17, 0xcd4ef3abbfae0747, 0x33c80096367949b3, 0x34d6b20f6616600, 0x2e5c7e4ab67e2869, 0x67f078d4e3314e95, 0xae711aa90ef882bd, 0x976ed027f8ce6161, 0xa1357c47,
+0x6ab0a835b3cc2161, 0x47a370c763e54099, 0xee23d6ac074055a8, 0x9721752babcdbf31, 0xc73b6a2154463d03, 0x3a5b734b3e07b338, 0xa3116c8193ac0b83, 0x2fde9475370fc9b6, 0xec2f9bc829f5c675, 0x1e795a812,
+0x6ccee4ca6667a995, 0xbb8844d417ff78e4, 0xeba3f6ece3770271, 0xc4220e5c0b37506b, 0xc62a606aa18de79f, 0x5d98b7cc75eed6a6, 0xcc45db97b49e8043, 0xcc106c9ef0848b4c, 0x89720ebeaf5b3d4d, 0x23b8da81,
+0x1b57687cebdf9273, 0x73c6ade325075675, 0xdcc86cdea244e85e, 0x1b98903fafb8d60f, 0x2eda8687481d63b0, 0x7a3f51e181d7a19d, 0x79a2b0e5d0fa6284, 0xeb80b12252162bba, 0xb83229fd81a9beea, 0xd1d7bdb3,
+0x21a7798dc161aea3, 0x1e72b9412b15b829, 0x6825ee5f1db12cbd, 0xc17c4298c6e0f5f7, 0x3427ef0b0f0cb8c, 0xf04338c18b1267e8, 0x790bca76f92cfa1f, 0x99829922b3c3f0d5, 0x4a11ae52302133dc, 0x2cfa672c,
+0x5eaa9efaf173dae4, 0x301306d7239e451b, 0x8eea2ccfcb8b4077, 0x6c10a48c4d9e6bcf, 0x754871d2b513c361, 0x5a02416edc113e3c, 0x8051e69d861cd3a8, 0x1fbc9c3ed0f8ca84, 0xe5529db6375b1395, 0x1bc971fa6,
+0xf2c797ecbdc17a4d, 0x20ce388bc10b36cc, 0xfa37eba0633cf34c, 0x1a80d57dff20177f, 0x5e3b04be3c00ae0d, 0xa2bbe8cd1cd3125e, 0x53cb148c49551fe3, 0x93b97fc20a9d63c1, 0xaefb8ee808c6b3a5, 0x2430d22b5,
+0x8e4a67f3879d6ba6, 0xe32295f9b94db58e, 0x4cae7660d8710970, 0x5fc647401ed3b19b, 0xd12ad37c40103ae3, 0xd85abec13b9d56a3, 0xac84a69eb6998273, 0xbc1f04832ce8278, 0xab954df2bb40cf30, 0x10d28069c,
+0x74a3faec89a804be, 0x4cb9631a73b352bb, 0x1cc4873322fc4305, 0xc13abffea734268f, 0x5b47df3272fe8538, 0x988bbe930252152c, 0xea49cba143a83c6f, 0x8d1d7b3dbcbde87a, 0xdb2b4d638b3663ce, 0x1fe15a1f6,
+0xa41807bd6ed6a728, 0xe69be9000ba9414e, 0x2a8e607f6ffc971d, 0x16451c6e005e2e3f, 0x8c7e1964176335d2, 0x97858c342afce41f, 0xeacbfda068247a9, 0x11649009c8e6821a, 0x890f4476558894df, 0x6eacea2e,
+0x929d1610bab0b660, 0x76ef912885470429, 0x2e246e480e2f18a6, 0x69ccf4f591c87224, 0x493641e3039db67b, 0x2165affb47af01d6, 0x8d7af7fc2d07781, 0xf85852e86e57dec7, 0x1ba46ec6b76bc0f4, 0x1d0a41054,
+0xb337699a0d77cb0f, 0x177081704279c85c, 0x158e82610669c3c7, 0xc4f12cbd67658962, 0xee549357a736cee9, 0x8a5c02660f6d2959, 0x547b8c6e80227914, 0xde5ddb6c653df4e6, 0x16e8b82693e627c1, 0x1f907f71,
+0x9e48757ac671e7a, 0xc91a86c1b01741da, 0x31d891484b8a2f05, 0x41704effad607541, 0xb08486b15d1a794c, 0x14f95c247ab93e6f, 0x6982c5b4fd480ea0, 0xdcd1aa4b34594195, 0x8da9e246af129b2a, 0x1a9ef6a9e,
+0xd0e8ae107275f60c, 0xf906419d8674b085, 0x3d6fe8c409c2ac51, 0xfa63b5e0c59ebb7, 0xd8ac78b619baa320, 0xe5cc98f6795cfd3c, 0x1c6ee94214525826, 0xcfb46b9896ec7129, 0xcf7bea641cb4b6b8, 0x1cc3e2416,
+0x62342b92e8140b66, 0xc40311dd3bf5c36a, 0xc7a85923536c6a1a, 0xe9fcb86192bb6c24, 0x94c7493cb86fc82d, 0x54c1d601069666e2, 0x1cbe898ebef30c9a, 0x2c3189cf0577f543, 0x8a30254d2058106a, 0x2dde974c,
+0xd45f36c787ed6305, 0xf732faf360ce2670, 0x31a96f40487dabd6, 0xcf4b6eb0ed685af5, 0x93a3c1306434775e, 0x8ed087e1e8213293, 0xf7924a8e13348e05, 0x20b4e4dc5cf5f2a7, 0xd6ee53678878ef8e, 0x1fded19ba,
+0x4060fdd33ba15061, 0x9991770db137ca6e, 0x9d6b710a4c480e5c, 0x9600126d36538406, 0x4f376021f77dc3cb, 0xe36bde2d8a00e478, 0x55a88f68e15da2d6, 0x79d642da23a0515, 0x8ba33aada9623517, 0x21ce18705,
+0xb14bf6a86c5f5a4a, 0xf4dcf5e42586abae, 0xf0b4c27265b60fe7, 0xa6e28c31105b955c, 0x31708feaaeec3941, 0x5e2efd447bb51756, 0xe7a47f291a1ab94d, 0xa01360ea888479d2, 0xa14efe1433da277c, 0x144350ba7,
+0x412bebd598f8bb23, 0xf79134da86d86814, 0xc14f2a40e32ad91f, 0xfcdd5e821d38b159, 0x2b492024bf55498d, 0x5405dc5e6591a077, 0x5f21ce5e8523b59a, 0xc8efef4fd2b90c79, 0xe68ca5ec2818e96c, 0x47651711,
+0x6dee58377adcc1c7, 0xa93d426da0946c2a, 0xd5011b4849951caf, 0x2100cfcf1fd8f03a, 0x7ccf3557eca63a47, 0xa39b7f66085ba468, 0xf0a83e949d556aa7, 0x67abbe93da89d237, 0x4a7794bd13e7f9b5, 0x5b76b030,
+0xdefdc85a93bdb6b6, 0x76a08da7e179fef, 0x9e3df0ed54d51f28, 0xaf9a30630106e00, 0x6066442544948eef, 0x52c2f94a6f6fd05e, 0x71126186bfee0093, 0x1f46723d00e52853, 0xf121b36a5c3c693b, 0x2241d689,
+0x730b0e131b44c262, 0x527593a3b4948858, 0x7e890ec686f90a8c, 0x41994360a72c9846, 0x84ea0cf16f604dca, 0xd4f1b8ae171c6259, 0x395e59e21c9fc9b3, 0xe2c1b57b0bda9ffd, 0x1abc027845476fb4, 0x11a696cc5,
+0xaaefe3ac3ffcebc0, 0x947ce34bd4b93ac, 0x9735a1f61eb9286d, 0x3a37ae090871bd77, 0xd47c97d5159cf1b6, 0x670fa9ac1620f709, 0x28962263466de6c5, 0x9e267666a46682a5, 0xa3ba6e982adb4e96, 0x1419e0473,
+0xbbc05a5222c09870, 0x9e77130af80a1784, 0xddddbfada467cbad, 0x28c02eefc83c682e, 0x1bade840033e85fd, 0x4fa94b99b53817e9, 0x367b2425f4b1583b, 0xc3e4abdfe3db7c24, 0xc7254f01e5644a7a, 0x4972f2b2,
+0x6d9784b15845cea7, 0x4d899799001410b7, 0xd4c3e68bad61db16, 0xfeea66393ffd5fa3, 0x1a263a7fb4364eb6, 0x33287b3389e1ad1e, 0xaf4507176ff10c3a, 0x6382f929e565c4a8, 0xdb85b13f95f4e250, 0xc603f623,
+0x7d0293c18a0cee69, 0x343eaeb3d2ca624d, 0x39de81e7429cea4f, 0xd93d1460022dcb41, 0xeb2ef2ce9c56e7d1, 0xe30b359dc636dc21, 0x6012fc3cda040629, 0xf7fcb336f5e6f880, 0x53d97b67b516cc4c, 0x1a8b9539f,
+0xa1baa4bc00533b67, 0xbba34ac4c5fa09cb, 0x5f63392ad0de1e7d, 0xf903fc0ca200d3fe, 0x63307107b4b314dc, 0xbb3de8802308dd78, 0xbcb1854c11336e33, 0x71f89455efdadbab, 0xa77999bf48b8cd3d, 0x8cc5a713,
+0x4ad177743b403cde, 0xe47f1ef04acfcc5, 0x82dffd79e7f4c2eb, 0xf3f012bc6c32e687, 0xaefcc896b25e7851, 0xfce01f091b931fd5, 0xdf029623002e3142, 0xa1834b42ea388740, 0xf749484ad1e3dd22, 0x1060f072c,
+0x74eb9678b50a7ec4, 0x507e4014d13670a0, 0x4598ea14d1724077, 0x60770748cb6e4953, 0x64c4d0012d70c6, 0x2f4259b2e0622c64, 0x2d6e6c184a44f93f, 0x589e756e2c675827, 0x63029a009fba83a6, 0x6b23bac7,
+0xf7082eea09a8742a, 0x6eaedc12a9a45951, 0x61f8116939a6f334, 0x6a86818a07151a45, 0x55834c028f01191e, 0xf17f0e98453f8e17, 0xb9f0679727409ad1, 0x8e0607b680367b7c, 0xeae78fc0f94519c8, 0x26f0462a5,
+0x35db79194c519e92, 0x1cce0a9642e2409f, 0x93528509476550d6, 0x32ff1a5f8ab8e315, 0x607826f1a8704ed6, 0xa85983e09f2a539a, 0x2a5fc18a37b00e63, 0x17f21ed4fe9d8635, 0x1aa6f6504ecbdda0, 0x24035464a,
+0x5c883cf19101a525, 0xd445219b612da898, 0xda47771502022ce8, 0x9a27453d4d56f64c, 0xe7b161f113441515, 0x9bb0aa0a740749b5, 0x155f6ed66f0acacb, 0x59f65aadc7337d90, 0x7c98bca1a4d441f5, 0x257e4ca1b,
+0xf8c57c4cd6aecfac, 0x4768c774f27e3270, 0xb1f4730833d48c51, 0xbb33d4aea944da69, 0x2e5bfedb79ac874, 0x25e63e51f0de4923, 0x497b539ebeffb8da, 0x3ce3778592eed781, 0x7b2950b54541c1c5, 0x20ae49397,
+0x3726638c6b095ffd, 0xffe6474567c07b23, 0x14e1bb8791ddbd0d, 0x779349b2742418d6, 0x8aa3937908dc7f43, 0x9b2ff50c9562e97d, 0x535ba8bdc1bb852a, 0xc81c2562beb387ed, 0x5c39739554684c58, 0x182862e3,
+0x2efc5f36a54d9268, 0x241a5bc39679c982, 0xab0d57d957db3de2, 0x7bbe840d73001ea9, 0x471d96643b0bfb8c, 0x97d2a5eefcdfc316, 0xe49b22450eac89f1, 0xcd79b7b2acdab1a9, 0x1b11e75a19bb8052, 0x10f718241,
+0x69b714fb7fff2213, 0x7c48ae7bbc8def95, 0xca34c046eabfeb4b, 0x2ccabc63e004f591, 0x50d66cc1151d00e0, 0x94fa5976c69292d3, 0x2d102ed11aafde2b, 0x88530766bef7b82e, 0x55aa1f913aef2946, 0x1e8660dd1,
+0xc169660360db349c, 0x5bec8d741f5271bc, 0xae47bd150d77eaa1, 0x18fab916882ac758, 0x49fa7506383c0d20, 0x4c8306a9667194e0, 0x9e471fea16d8fc1e, 0x2c40a163a6326cc2, 0x8be4697b06c85365, 0x6ee9c936,
+0xe9dca3720708a621, 0x922e00111e008424, 0x4c37fea90d32bfbd, 0xff964891b05357ca, 0x56a34eb38631da56, 0x6a3269cec167f5fb, 0x3250e2fc0eec064c, 0x2dbf00bb4c75c49a, 0x6ab58aea5b80a13c, 0x1f496ced,
+0x9013ed20af72ba59, 0x79f728994a16fbab, 0xe4110e0997c326f5, 0x2d5f227a494f7eb5, 0x7187cb8ef0fbe361, 0x3bb2c1b105d08609, 0xab13be79225e7243, 0x99e9323fa4a106d7, 0x7d38665fee653e6a, 0x229d6e698,
+0x94152486aa4d1321, 0x42ae7f382835457e, 0xba4b69d552d6c5b1, 0x4b2253ef1e0141ba, 0xd21d0e7bed8c4a52, 0xaa2b5ef966f40b15, 0x31aa28e6bdefd8fd, 0xeb7f7007b4aa66d9, 0x13d5beff12a3f25e, 0xcee20c2e,
+0x244612c9519c4409, 0x4fd5242c39c40b05, 0xeca54a1d2a3069d3, 0xd4aa64e5f177fdcc, 0x47145d315e3e782d, 0x10dcace938d6ce6a, 0x6f6530c2c83c16db, 0x4043ec6199775ac5, 0xb158fa41c26f7cf3, 0xc44ca270,
+0xe24ca5e054141375, 0x4ab72754d88fef0e, 0x452ce2146b13c25e, 0x7ede9de418e2435e, 0x28c33918bc4f9f9d, 0x35205cf965bf417b, 0xb7be2b82c8781efd, 0x6e652f8f3cbfe510, 0xf1109dedbed21d28, 0x1bc9bb9d3,
+0x45e685735fe97116, 0xbfef663bc21831fd, 0x9b0e6d4cc74fc5ed, 0x104a01cf8aea3fb2, 0xe9bebdc07a99d72a, 0xd5f27b7bcf3ddbc, 0x5d84f3528bb0aa9d, 0x18d942b6f4e7b7f7, 0x8fc9277095fa22d1, 0x15e4c37be,
+0x19863f53ab1822cb, 0x8005a83dd0f0624f, 0x8d7fc747578441bb, 0x3f24af9da90cc8d3, 0x49e2ba8b7982e379, 0xd03d47211cf5fb0b, 0x51b5d84bce94075, 0xe6b3ca5ea42a9d1, 0x1c5bb185611e60f3, 0x24a468cca,
+0xf2d913ea8e8e98a1, 0x8214136693737b42, 0xd45a6d0b9abe273a, 0x4b5bd0a369ca904e, 0x509006ba5c8aeafe, 0x1a6a1e37d3290c99, 0x786f99258ea98912, 0xbc88544beb9aeed5, 0x482707655de67e29, 0x1f427218,
+0xa6a0639a26f3f08c, 0x3a6655d32733dfb3, 0xbf52317551c08384, 0x29409829c4615494, 0x4dc959ba5a6c6c91, 0x46fe123faae4936a, 0x28000e4b28d4150f, 0xdc031ceb35454cb1, 0x524a1e09391fe55c, 0x90585b8b,
+0x290940b787d65c2f, 0x5eb53b402d148ccf, 0xf21831fad97db515, 0xb18cdae29b0facbc, 0xa09df058c2c742ad, 0xb9d137370912d621, 0xd0e405af31e63ce5, 0xcd6b4d8ce1d4aeeb, 0xb31899f170c5e7ad, 0x1c8601131,
+0x5328118e26fdc224, 0xe00f5b8009bdedee, 0x57ddd9079ad31ef0, 0x9c32efc5646215e0, 0x7373bedf47a31cff, 0x1c2f2036049a4695, 0xcd314ec6a978a5e7, 0x8eb51c6f34afddc1, 0x360aa7214f9e4caa, 0x2362695a9,
+0xfbcebdd15573472c, 0xa0e39a954513c148, 0xc85d20ae5cef1061, 0x92877abb38a6b254, 0xa29d1f25a369ee14, 0x99e6971a613c321a, 0x1b92005ca011b060, 0x98a48c64540f909c, 0x5b0ead0c2813f685, 0x139e3644c,
+0x64882753d8a914f6, 0x4185fd3607145ff8, 0x58c71b0590e05363, 0xbe792b2d8bc5c64f, 0x5a3f1737e400a842, 0x1b8b38c3c84aea16, 0x54b0c59ff20a7896, 0x45d7d52efdbad6a8, 0xb719a29f7874c929, 0x18d011869,
+0xba140b09d831aae7, 0xbe1e612db3a3d7bd, 0xf3cde45789330a6e, 0x569860abc7c96e02, 0xc74513fa976588c7, 0xdcfaaefd22c81894, 0x25e9fc9c5bc7abec, 0x60d0889c272fff3c, 0x158094db25ea5824, 0x12c786dd,
+0x7ad79f649932c3c5, 0x7c3ad7ad60b939d6, 0x683d50351ca50aff, 0x9843e084e25a3861, 0x7a193dfe98766b19, 0x4d7375e5275bf78f, 0x5b7765fbaf7f0ba, 0xa46eb202832850e5, 0x72bf2a33e9efb3dd, 0x255ec957e,
+0xe33a613eba14ec47, 0x43968e4269a106f0, 0xe7a70b96396d0082, 0x1e51da621981a3ca, 0xefe2a334ac150aa, 0x416ef11a5bab8bb1, 0x577d793df02089d4, 0xf50431cb338f2514, 0x428180291c84e3cd, 0x175c6e92a,
+0x9fcd6cc2f40e331c, 0xe8f3f6674bf247d2, 0xdae1850766d94c9f, 0x20337955dbf59ec7, 0x3ba149d0811bb857, 0xbe4761e3d458a525, 0x7affaf23bba670bd, 0xa8fcda40ef84a3b, 0xfd3390c7701da96c, 0x16bbee3aa,
+0xfb77f58004a2537e, 0x38dddc989cfb725b, 0x741fbe693be771cd, 0x2d0d612df541339f, 0xab56bec6d3dfa2ce, 0x4391c87b9bd2a33f, 0x57dd736685cceee, 0xc7e5822cf535e436, 0x8c1eedd665c2471a, 0x258737946,
+0x8c26e980c9b82f42, 0x7a6c38914ae8ead6, 0xb0f7f9cc05aaeb80, 0xf5de17c5388393d6, 0x6f17913fb46ff795, 0x654a25963b1521f9, 0x6259682b7478fd73, 0x3244d86ca81bcc5a, 0xac734721996df8eb, 0x19903ccf5,
+0xf41048bc86d90e76, 0x31def0bae172d759, 0xbf634689ff9061d5, 0x1a38c81f97223479, 0x542abf13775f45c5, 0x5f5c8aae7d07c0c3, 0xfe25030362986d5a, 0x7a42cdb035a47d35, 0x15cbccf146a60776, 0x1332d740c,
+0xef32107cfbea4546, 0x16266c3d93138ec, 0x93fcb2e6688a671f, 0xbcc4e30e645dec7b, 0x6c68666cd8e8d8cd, 0xf6c2af1044c05465, 0x40ca90309bc97056, 0xb4d95320ef01c39f, 0x587ab140bd35fbd0, 0x1e1ba1c73,
+0x63a70d9b6ec20f83, 0x65cf0ca2493a732e, 0xd6e6825fb6615fab, 0x8c844ef9b43bb381, 0x662de425fa7910a2, 0x896cf6416117ebf7, 0xadaf41d040f78205, 0x15c355eaaba2a1d8, 0xd4add00c46aa697b, 0x17234c8c7,
+0x8f03c085ad9cf4b2, 0xbe4fc74d322287ed, 0xb5fc87a70ff56aa, 0xc2cb19d1a1626261, 0xaae9e4e54ac397e9, 0x5bafd3dc8b1027ed, 0x97431b770b54155e, 0x5c7d419eb065bc20, 0x3474721bcb199eda, 0x1c3439728,
+0x75eda0287b7c8fa3, 0x2f7c47501b98a345, 0x1c8cdf70c5beddcc, 0x9216ca66fa80542e, 0x4d4465178ba744f9, 0xd27c40bc4fa515f8, 0x6de0d4a691e233e0, 0xfb9a9f9252bd6e32, 0x9afc7d876f790c69, 0x1b4000ed8,
+0xadaa45c68f299d2a, 0x40b2eeea653df8a1, 0xb070e4cd4a2fe4f0, 0x4bf58ea097eea235, 0x5b4c4b9fb754516c, 0x79626283a3615c1b, 0xbe39122bf2123899, 0x1d4142f288f42970, 0x780d7fb8bbd0bf1c, 0x14e64d65c,
+0x80aab0a6a2a318e2, 0x536f79a7b8a9afcf, 0xdd56289d627ae6a0, 0xe79fbf905ce09052, 0xb1225ed1dae01e0a, 0x92b0295ff9c72c5a, 0x74da39b68727451e, 0x1876cddf91c14a0d, 0x5ba76ee52dc00498, 0xf3103dd8,
+0xe2141a2889528ae9, 0x886ffa1464dbd45, 0x444a35840a05c750, 0x625fad5810e1aab2, 0xacbb9d4c661045b0, 0x1b51fa40393bfe9b, 0xa7e0b14b230b02f5, 0x6a0996eb861b14db, 0x8cafc9c3aec4e8e1, 0x1b427a1c4,
+0x11dfae44b19cd369, 0xb752116dc94c818e, 0x7d949dcb2a070d08, 0x459e5e2310c3dc2e, 0xbfd09f6136d4fbef, 0xccb883efbb146a1f, 0x54c8e244cb479118, 0xe0eb360554cf7e09, 0x84e85f53aa5f840f, 0x20e8dd527,
+0x13e0c263728c4bcd, 0xe68b412256b3f1b8, 0x8816ea06168ff259, 0x55398d605c35774, 0x95c5b0a80d086996, 0x824e773fc579ba13, 0x58ea7cdb64de1872, 0x170a605250b5917a, 0x9b2807371f2ecda4, 0x7ee50ab4,
+0xb9911a447bf3cb33, 0x8485308e0c895eae, 0xb62634f17594ee04, 0x2c247d6c8aa2eba1, 0xd91409ac405348d6, 0xa988d3e1e992c08b, 0x2ba896a3796afdfb, 0xbacce575768156d6, 0xac92d9ec61cb2095, 0xb6e55625,
+0xc9d33a9b4023165a, 0x86e07f0bb97adb1, 0x2db9265e340eac24, 0x896dee3e27431807, 0x72e52b2b633f5d40, 0x1eb925538da4348a, 0xcdbbdbd31af60c16, 0xdee3208d9e57471, 0x80513039f5eb2782, 0x2117991b6,
+0x853d5c841a1064c4, 0xad957b1bdd90a97a, 0x27994b247ca04060, 0x434bcccae2fcf662, 0x1f29d259c07c3e90, 0x3d8eac48925b283, 0x4e2c7acf6fb19c04, 0x390999089b08ea96, 0x92d630705e566daa, 0x779e7b30,
+0xa22fcc66a033af69, 0x46f2b4ba4095130, 0x24ece9abff0bb17a, 0x8ff337965f44286f, 0x9b9a42ffd3c85524, 0xb3fe8343b6bf60a5, 0xd84a82dd4a469867, 0xbadec104d83ee30d, 0x58af04fa75363775, 0x134f7a7bd,
+0x8473dd33ceaee6a5, 0x6fc7ccf630565a3, 0x97233a1ecab3629a, 0x2cbddb03a5cf1004, 0xf1941c227873c371, 0xea5810a4e0eca30e, 0xeb7bbda7c41cf915, 0x3f89c6aec2a4cc2c, 0xf0588447441a2cf0, 0x2569c70fc,
+0xfb63eaaf6dcd7244, 0xee46327754a569bd, 0x256504c2735b9d70, 0x61d9737b4f41cb28, 0x4fa4d8cfd409cfcd, 0x5f62168a26d7b9d6, 0xa06fac1e279dee2a, 0x16034b8fcea9931b, 0xa0582cd16b6850e5, 0xc542db37,
+0x350de4affb71ab56, 0x601cbe500c056a9a, 0xbfee3a33329e3401, 0xfdcebcfe7a97f07e, 0xff4eca215551b1d8, 0xbfbc4e887d773df7, 0xe56cc76e10a2e282, 0x68ed547c0349e356, 0x87cb93cc08433ff9, 0x73268e5f,
+0xc2392d3403ad3bf4, 0x4dd01f020563a5c8, 0xf66c9aaf1939a904, 0x482c5ee80b831d86, 0x76d704ac6c8a28df, 0x1a40acb4e5315aa5, 0x975fc2774eec5d9e, 0x475734622621cabf, 0x25505634a49d4d8e, 0x244d9c330,
+0xade76b639ab1f44d, 0xbcf2dd72dab56778, 0x9e06f4c696ccc612, 0x5665dae44942f088, 0x568988c09ec79c10, 0xe0457dfbdd55fedd, 0xfe4ca72b6e02f049, 0x2463cc6d8f64a6b7, 0x94126e439f5b8266, 0x135f97079,
+0xe3e6011c36c10629, 0x2dd7acc7abb0f77b, 0x111c1068ade63596, 0xeaf52c24c2b0be85, 0xdb8f169097017119, 0x90de24eb0c052eef, 0x132d660f392569c8, 0x2932d9d56a7a3891, 0x8134420984abfe0c, 0x22738e2fd,
+0x377e8190dd43868a, 0x3823097c13afd18d, 0x1b420d25588c65c5, 0x847dece859929cc7, 0xfae2c8fee212941a, 0xc133fc3f22c8671e, 0x6a7df620f1d2a2c1, 0x31d97e7b44417dfa, 0xe2a0227f02b9db7f, 0x13eb6e0d2,
+0x8b4fdb48a4631def, 0x23826206956d4059, 0xc8056a46979dc820, 0xf902dc886a3ff847, 0xf3e21aa331425a03, 0xaaa3662929abd662, 0x4f492cf552de64b6, 0xeae836817211acac, 0x7e4aa1dde06fd2b9, 0x14d0f03a,
+0xca34e35bde4813b5, 0x72d07e45a12bc3b9, 0x93d78bd53b85ac4e, 0x1f52efb6dc9511d8, 0xce23ed37ea9e1ea2, 0x595f32834b385106, 0x2dc5b214031e18cb, 0x852e2ab422775f89, 0x7138f4c92a9a7321, 0x224370399,
+0x60770a9eb3a7139d, 0x53431c5aaae07ad9, 0xfbf26953715eef73, 0xcf8a71e5a63ff61, 0xdf59b789918bb5bc, 0x50f3df681237e6c1, 0x7f1f87d31690527d, 0x217f5a1604787847, 0x80e83a39baf323ff, 0x963260cd,
+0x909d711a4f377aa1, 0xc5bafaee07a4b631, 0x464d188f244f85e4, 0xe819f96c3a51583d, 0xe82ae99b107d25e8, 0x4355a0dd648a7d94, 0xbd6da8be0b47ed41, 0xc9d328cd82b3b12c, 0x8c8aae41523f314c, 0x1cd167062,
+0xa81ca5cfe4252387, 0x7071da0c1306a904, 0x1f25a7cf2bf9b176, 0xe78bd82a6858525e, 0xb28094f5cee15387, 0x5e39b73f71801004, 0x8163fc077380a9c4, 0x78b1d027ac286201, 0xa26393c708705288, 0x16353e3e2,
+0xa4ff2a361bc0c3f8, 0x5ac1b04822c10341, 0x3fe7cb2645f4f87f, 0x6018873567a9d04e, 0x132f9e88633e22a, 0xdd36c58cf0cae55c, 0x12c0df5e79cf6168, 0xbe213cd38597492b, 0x54a28f48909d2cd4, 0x1cded209,
+0x4d7e29381d5d5c45, 0x53319cdf5fb78397, 0x6407df0e2586a81, 0x283ac487581438c0, 0x411c346b6821f36d, 0x6390f7eec17bfa74, 0x15f4cdb386811476, 0xe044c13f286f3a64, 0xbb0d2e797fe82766, 0x11ca9273a,
+0xe943e537e794252a, 0x8a832af3be084ba1, 0x225045ae0b82d781, 0xdb6b468907e83b1c, 0x76c16fb0b64dfa51, 0x1ecd9eff238a263f, 0x451d11f141a31a5f, 0x699f238ca4ba9d31, 0x84ed38d39038d4c2, 0x1eab9ba7b,
+0x7a4321694b3032c8, 0x80e47e7a40915af0, 0x61ba9c44f5e814ae, 0xc01a3a2e8012c6a5, 0xdf4b055634182d96, 0x2a3575e8f59ce1e3, 0xbd17d459732d5511, 0x278e0f048a243b70, 0x5356beaedb077e84, 0xccc9ee37,
+0x98e4fceb45f2063f, 0xd8c91f2bacf24392, 0x2c0cbd6d1dfab428, 0xce78e7307fa2ee3a, 0xa1b1b99b243c99b, 0xce388bca04fd4cac, 0x524fc4c0fc5412c0, 0xb91f3686f32d23e6, 0xdffc402c71122679, 0x247a089f5,
+0x3ca1108cdd93a0d4, 0xfcd7f85bda2b6e5c, 0xbfcd16e078e61a8d, 0xb7dbc629b3af1a25, 0x99f423857073403d, 0xa8c8fd13f383cc94, 0x90ce9ab5ec7620f1, 0x97f0f804dc9991fe, 0x7ed5a3994a92835a, 0x1788062e2,
+0x632011b3a867fa02, 0xd3906a7863f2725e, 0xc39056942fd67f41, 0x985d42ffece8d819, 0x3e36606ff751b549, 0x726f3503cbabd0be, 0x9bed3127de48b9ae, 0xbd391c904b4eba15, 0xb58aeb4129ad960, 0x4c690a88,
+0xd89c32e8f89b0d1b, 0xde23d46eb63f6dca, 0x26b08befa7ecf2bf, 0x5162e5fa7a838699, 0x2952c143a41a4a96, 0x3fc3d65eb09711cb, 0x4fdb32252c9a4e7f, 0xdc4c3558e169169a, 0x4c2e071d2c282aba, 0x19f395732,
+0x648ebf8f1218cdba, 0xa815c7cae7dca596, 0xfc96ae6bd3a8737f, 0xbfa6b61f17238fc7, 0x9c51bb085312ec83, 0x408ec969d2125d6f, 0xed9933515b6caa7e, 0xd08551234ab24b65, 0x904de4ece9b8f365, 0x17845a4af,
+0x7676b12e807dedd7, 0x27f8acf9e3b5f0ca, 0xe12c994b4b89da99, 0xf283f365ac0089fe, 0xdb11db7ba4f77931, 0x2c464e661e932adb, 0x8e8d9d372d49eaac, 0x5d4786fbd7ed2713, 0x43cf1fd485f155d1, 0x18b050f,
+0xbdb00644d4dbae1c, 0x3911151babee5516, 0xf4b2a082e9cebb42, 0xd8e86f45c7a46748, 0x987a9e09169ed6b5, 0x4663800ab524032, 0xbf62094155eb7fff, 0xd81a06c77efc827b, 0xcb8a4c416530a92f, 0x1c9c673f8,
+0xb0f897d84b5d8514, 0xdb58413f79c053f8, 0x19772d028d670ab7, 0xf8a3f93a1f991dba, 0x4372739ec7831543, 0xa51e67e7eafb7ad4, 0x3574af1d13758e8c, 0x1f40ff961cc86453, 0xfd7eabbb9bbcf961, 0x210593c85,
+0xe18c5b82c4e4c5d3, 0x12eabec714dc30da, 0x3abde1e82e2f18e2, 0x59a938e55d74dc19, 0x8400bffebdb2efd, 0x7b941baac193c1f0, 0x4efac966efc1a5c0, 0x7c0ed8bd146a4959, 0xfb214c118e2c85a9, 0x25e753ab8,
+0x341af4e505651698, 0x1e95bbb34b31c07e, 0x8be1ce73868e7ad, 0x23656ed1e3023124, 0x230b1046e4a56f08, 0xb360d76a0c500581, 0xfd34e150810df2ae, 0x85af0ef1e7c97fc, 0xf50401c9ce5fa473, 0x24e49cd9,
+0x90eda6b9774f90e9, 0xd94f7b4b8a442950, 0x49aa864da4d85f45, 0xd3a900a9410a2e78, 0xd2e5ab1aa02a5fb3, 0xcff0bfa58a0f849b, 0xae26a93a6a1d0e96, 0x2097038f8482be5b, 0xec69d83a7d6948cb, 0x93589f30,
+0xeab8dd94f4d999b2, 0xe70fd61e20e6be63, 0x41314f9389a5c399, 0x352ec75bb5e83d2f, 0xf3b6e3a320d941c5, 0xb61d7be81656b1b6, 0x388a975f3128c545, 0x1349dba0a5b9de49, 0x1e772ef8521a0f1a, 0xd1b8e3b4,
+0x5cbcca0bec724120, 0x6a3a9993a010ca56, 0x8c23d36dde4d2d7d, 0xddbcf8b1c50c039d, 0xbded2688ea8c96b9, 0xa5fbd6e5bf3b9408, 0x2fc233ed0da054b8, 0xd4a02ca5272e6440, 0x9dad3eb73a182e75, 0x76e14164,
+0x3463f3af12ee1f29, 0x663831f88c0354c9, 0x26124aef884fb6ab, 0x6c0830066e05a5ba, 0x127ea5e64340095, 0x171ee2d335ef75da, 0x5a9804b921fc0b00, 0x354d38b8d3ff8bfb, 0xabc0dd48bcc19be9, 0x648e4103,
+0xd4e7ddd6ba210538, 0xb049a35a0602162b, 0x3704a16749f4d5d6, 0x3681cadef07e5f50, 0xfc6ed343bb82fe72, 0x4b2bd2bf94261c0c, 0x421018c36afb13ed, 0x5ece9701dbf3bfe2, 0xe51f3948afaad677, 0x1eeef01bd,
+0x8edfec61f930799c, 0x666d4db3d7352c5d, 0xdb1997923bc03584, 0xfc09fec57e11d6f3, 0xc132d234bc0a5582, 0xe939ad3250ae3363, 0x5b093d058bc86a44, 0x89e17462ce1b886d, 0xf9972309c6ac09d8, 0x43a5b8b7,
+0x8f577efbc80def19, 0x92a1de3a5d7d2b0, 0x78bdacab94c106dc, 0xf52f0e795f31c562, 0xcd5239adab537c24, 0xa053729252708fe6, 0x7b2af45bf29f1061, 0x7c698f9f604846a9, 0xbb97a116a806143b, 0xfff92946,
+0xd6ceea580dbecf44, 0x4bf6e62c7422378a, 0x560b63901724a372, 0x87f56c14ef7b69, 0x9894c2618de81c78, 0xf638bed90ca1b15e, 0xd660571847aac0d0, 0xbbbc2decf5d9d13b, 0x3118a32b0ebf2fec, 0x4472de7e,
+0xd4ad5096ccd6b3d1, 0xfed854b6d6888a60, 0x88ef4248541e3bc, 0xf5e52aed7c4e66bc, 0x71c34e35355a2f6, 0x6bc2c0152d488aa4, 0xb0564af74121e603, 0x8ff178e353ecc9b3, 0x458fecc34ba00028, 0x20933a2bb,
+0x5bb438bf78d003c3, 0x3a7f818ea4d33c21, 0xe78209df38b59d7e, 0xc6cb8afbafb9c50b, 0x9581d701e139cfca, 0xc2c2d4587b2b6c9a, 0x27ee4e44f5bbfc00, 0x7dcd2e5aa9a0eceb, 0xec3a5924c00b6a0e, 0x1126e2bd0,
+0x149d8be30c9772fe, 0xf3f65d1444940a3d, 0x60f41e4cc1bdf7a, 0xf62aa6b2d6092635, 0x222f7de5c59bd777, 0x30ac0b39642d2579, 0x8d0a214fa49cdc37, 0xb9818f39f7af28e, 0xc4c33bcf2a31c766, 0x1307a68ba,
+0x738f4cce34b76ab8, 0xbbb3c14025140b8d, 0x720ec9a616dda940, 0xa72156aab17531fa, 0xba8bb6010d59f61c, 0xd756ec60b36e2a69, 0xb4fa36ecf9508b1d, 0x705510216767239e, 0xa43f3740151186ed, 0x215a16959,
+0xaa675e3ac30626e0, 0x44bab962d5cec16b, 0x6969831115c600fb, 0x99bf3f9719f2ae69, 0xec1e922c0d6f4c3a, 0xcb94372738751ee7, 0x53de7135d432b3a7, 0x2414af81f9504109, 0xa32d94fdb5cabfc4, 0x234774642,
+0x21a2b9736523d493, 0xa3eeed740c57768c, 0x24af5b59da059f94, 0x666d01f099e5abae, 0x819129e3ff52307a, 0x70f0353012d44d5, 0x1b1382a71d24ba34, 0x67ebff049f6ffd93, 0x49633a5900dc8310, 0x1896796b9,
+0x92b688e63fcc87f9, 0x40e27b30f07dbfbf, 0x172682d71fc72afa, 0xa392dd6e56f222ca, 0xcf0eeade84271304, 0x35821bbc0f75fc52, 0x17aeb42ac2b02be8, 0x63b1b86c459f1d56, 0xe525ca64c7365763, 0x1dfe86cd8,
+0xc6c8efecb767b34e, 0xbf2a7386f6f525bc, 0xa95f441635a2da66, 0xdbfa4db797fabd58, 0xa91e774d2c63d1b2, 0x24227b0338561ceb, 0x4d8bb839562522a, 0x3a6b94b7a21a5537, 0x22b819c31ecd2f3, 0x10f23882e,
+0x88b88d5a7c133f56, 0x997f952384cf869e, 0xe9008754f01f1f31, 0xb5d17ef7809bad02, 0xff82613126afa14a, 0x6f60ae5927438449, 0x47e06d542f227318, 0xcc476de058444a55, 0x1007857e7499b74c, 0x11f566f6b,
+0x3c0846959def9c64, 0x2000afb565334b0e, 0xd6454711bb4d4aad, 0x94a8238bdcc6c9b9, 0x4a09a374ac6d0d1a, 0xc18a8ec565ba064c, 0x49bbab65ea0e5270, 0x473f4492351fd10b, 0xe23c24a712d791a, 0x2b1a21e6,
+0xc8b16e887af7379e, 0x488fd05196c0f152, 0x8d260bc34c8d8757, 0xa4c4a6b3a850a81a, 0xfc297acaf250aee8, 0xfa7337ea56934b2e, 0x735991cbfa474a2f, 0x50f94da21c3366df, 0x1a9ee18680c11db, 0x2564af3e4,
+0x373f26d3ec90204b, 0x4f89d8b1bc4122bc, 0x7af70df27cd10d1d, 0xa1b4cc52936819cf, 0x205a16bcd77a20c9, 0xcca803d58054c32f, 0xd47efec4d546087a, 0x8c48b2f09dde767f, 0xe269ac3e6a39b529, 0x140241d76,
+0xee2eab12dcd70314, 0xd1f5e77ed838f5c, 0xbdbccc7cd1ff466, 0x37d00f9b8d675377, 0x1b25b20c75963bb4, 0x51cb74fbb8d2ca8d, 0x8087c3fa9359b7d4, 0xf12421508389a1de, 0xe0a915141f7513f4, 0x1c13fde96,
+0x16d89c69cf9b81db, 0x474d036ddddb3af9, 0x3cd5f413c6f37392, 0x112024c0022f4853, 0x3902dbfb0bbeb4be, 0x8b826e346dbd9b99, 0x829f21c72e8d67c0, 0x4ffd7a62fdbda846, 0x7f451198590044d9, 0x443f9d5c,
+0xb1ae5d4bf868de1, 0x39380ed796844819, 0x68ae3bcf525a8473, 0xd1cf26116ad6f85b, 0x976e6a84b0230d75, 0x4edb69056737a8a1, 0x88b14a5faf2c65f8, 0xc77f98ba260670ef, 0x9c8a0fb57db46d4c, 0x2664c049f,
+0xf4bfbe9392c2a4ba, 0xfa6a3b1bd07b5ed4, 0x2468d6c6f6c98df, 0xd8352e5d01b36b56, 0x581b9322ec81f4e4, 0x3f3cd6503a52cafd, 0xbe7213eb05b0eb53, 0xd01ce9ea9cfa3502, 0xb91b1fe49e2a29f2, 0x1028abb1c,
+0x6126f2265f6f28fb, 0xe942a553ebc5961f, 0x309af529c1713611, 0xdae814da04b75835, 0xd423b213755c30da, 0x4061e81d648af15a, 0x352dda19d2f24186, 0xd47590f2d5d14f3, 0x7cef1ecfba15e9a2, 0x1d15f138e,
+0xb765058811a584fc, 0xf07eefa6f31b7604, 0x693129eaff6a95e8, 0xe59a64508907e965, 0xea4985a3804bb1d8, 0x4fb9832d7279caf0, 0x4527d1185bacc96c, 0x8043143edb8220f4, 0xe1390b399a6cf8fd, 0x777292eb,
+0x9751d02a8aff2f91, 0xc5c48bbac254371b, 0x3c7e7c4a4a9050d8, 0x6f20bdc2880f718c, 0xb86f40e30c3d3beb, 0x141c6cdfc9b2787e, 0x83df464d346183fc, 0xd0feb5a654481288, 0xf569b182a91e4fbb, 0x4291c5fc,
+0x4e2e88dbb478444, 0xfc31a5aacd904fd6, 0x1919f357cec29a2e, 0x229de7ed50b1091e, 0xa3363deae46728eb, 0x27d4ad4acc148e85, 0x7dcc7ba5f893df5, 0xd0ee215cd3d682e4, 0x3bb0927a4e2bf5e6, 0x1b36a9805,
+0xe13fb4aaff1a647e, 0x5cb274338dacf031, 0x398331320c6ada0f, 0x8aa1de4ed484814b, 0x2c2f95b728feecab, 0x8bb3f46e12cd5938, 0x439f9c696f8803a0, 0xcb29cca1fdd50db6, 0x30b44dea69fb7ca, 0x1a2c77c7f,
+0xd1b68ec1076fd603, 0x6a1e1e47f1d1d73c, 0xaaa8258bf5fee9e1, 0x10af7a6b86d935cc, 0x27c06a091df75e3c, 0x6513a346b34381c3, 0x3d30ca41c8f820d7, 0x928d1363044dc624, 0x4d8cced06c985bb1, 0x345e2dcf,
+0x7a450113a5e6b718, 0x455eb0d3eb897912, 0x3f18f31bee382571, 0x232d99c690fd639f, 0x64dad5c2ee326775, 0x3efcbf2aa8133b9, 0x7fd0f36b2bf7ee01, 0x6756e384155660e4, 0xfc0ad3f3d93db0e, 0x1c6096f51,
+0xa7f897ffbe92bfa, 0x9e684ea2e3b9dd94, 0x20b0ca9fbc2c5c8b, 0x4ed9d00699cd0d8a, 0x750d399bb4e98a51, 0xcc2822b22b0b1e3e, 0xf96e63fba77bcdf4, 0x3fae83939f86b3e1, 0x3321f14764decc76, 0x1e87cdba7,
+0x41d0ed8cbd852968, 0xcadb4e16abb0827a, 0x55dfaea8043e8f5d, 0x398a7a199ce34227, 0x29376563aac502bb, 0xa4a68dfe315cb850, 0x994c9e901fa25b05, 0x1e28b50542a13655, 0xec21cec6bfc8120d, 0x1f0886f3,
+0x5d646678cc8f191d, 0xc0ee8c76a7656b55, 0xe12e35d32e7a0d19, 0x5d8a65b077888479, 0x482f167c69f65de9, 0x8f8754355b175d26, 0xe7bffd31a1baca52, 0x33d216349c2a58b8, 0xf9302460fa4f9184, 0x147e9a913,
+0xe280f7661d7946ad, 0xb580d6dffa12198a, 0x97c266840cb3eddd, 0x3b319d49e7c74076, 0xd6dea8ec2de25ece, 0xe65e74bd83cb7d0b, 0xaaca43951036fcaf, 0x134c90bf89845298, 0xa0aecfd24c2794e3, 0xc5b89ade,
+0x1ac1d33f0d85c4e2, 0x4b5e22eabe9b3318, 0x71fa07301781e720, 0xd199da171f93fc02, 0xf931b0a87aca4df0, 0x6e9c81ea39a14b68, 0x86d236f1104bacbe, 0xb4a9f618f9b81a81, 0x5c3ebb3e58adad3f, 0x516b9c4d,
+0x34182e70630ed9ea, 0xe954e65b1c8ab7d5, 0x9a252ba51a71edd2, 0xf75f94db33c4ea57, 0x1e5f4eb4b0ecef48, 0x4eb319af428f4591, 0x6aee087914590a0, 0x567d207b4cc0c19a, 0x64998bf96c29535, 0x20a497356,
+0x93c61f0a34b9b898, 0xe10a0df7d259a992, 0x87a40e813945b067, 0x8b486e75f1f3f85b, 0xb95879842233d1be, 0x6afecf66078381ae, 0xfebd289ec212b5a0, 0xcbdf4a1cf6e86f9a, 0x1b6a6cdd8fbfa4dc, 0xd8660adf,
+0x7f50443206b0302c, 0xa10171050e3aba0c, 0xd0eb4c4e7df3dcc4, 0x293c0d2ff7cd272e, 0x538861a9ffa372ac, 0x97fe647baf6ee80f, 0x4c1fdb6a3782befe, 0xcb9cd540015a5988, 0xa330b057235a2718, 0xc91bb1,
+0xdb2272d24ccd7eae, 0xa099e13bdd05eb48, 0x37246a944f0c07d1, 0x5d75e9268b48999b, 0x6b5d30f2ad56202e, 0xd255b5dbabfebbdb, 0xe42971809906d2fa, 0x52e820e423e38acf, 0xbf838135dde99305, 0x90f41145,
+0xb81d91b98f400b6a, 0x5264436133e59c38, 0xfc272d4653ca936, 0x16a4cbb52272b83d, 0x604217fb3e69265e, 0xfa32692ce07fb11b, 0xb869b6bdbcc623cf, 0x31660268ffff3145, 0x634d4cb628f28f4a, 0x2363d705f,
+0x778347ad611727ad, 0x833c24809bc02795, 0x9334e89ca971f12e, 0xd4fa92392f297c93, 0x67eebda5e644c941, 0x298bc8ec6275f5aa, 0x834298629c07b8da, 0xbbe67848e0783b9f, 0xa956f61e8bb8cf53, 0x114aeb1a4,
+0x963ec324cef0b92f, 0xe00dd0fe11dfeee8, 0x577421a89e079762, 0xa7dc6d81ea71191c, 0x7cb5efaded9c0743, 0x1f2c62a2450b1967, 0xceb0965fdd713f74, 0x17ea366bf8f20968, 0x2491880ed8168d83, 0x174dc096f,
+0x888f7a78371b8281, 0xd2ff7c267e1a353f, 0xaeacd4408bc51573, 0x58cb9c87130c80b6, 0xe29b2c5ad32df98e, 0x984b42899a1dfa73, 0xd94851fde702c293, 0x89017f6724b489c5, 0x90beb3dbf6e11280, 0x2188981ee,
+0x7c997341227290e8, 0x8c1ae4375ff683a3, 0x172ce15f83e6fde9, 0x942bacc2721e55bd, 0x37dfff89968823e2, 0xa2141c76d9be4eab, 0x7883724e7b08008b, 0x61a847442c7653eb, 0x2a2db872e11403b3, 0xc17f3bfc,
+0x892aba73c66b01a3, 0xbaeb458d80abc41c, 0x82eedce6e47821b2, 0x1b2ed977c1172fe1, 0x951959ad2b789acc, 0x5fdd1fb8d27d175b, 0x959c5e67810c2957, 0x7bb17b1c825c555c, 0xaef02713411c0b82, 0x169a23d12,
+0x37fd882db5a6a3ad, 0x8895562e7b614a89, 0xdb330f13c33d8921, 0x8b21b5ed2280d0c8, 0x8c3bbf7f75f66e00, 0x7be2ffba163fcee1, 0x13a9581df61dfeb2, 0xb727fa91f4c6686f, 0x51b47b58d6394b8f, 0x12f72f5d0,
+0xb7a63a06922495c4, 0x1fa43411793c7d0a, 0x1b99bbec8c191c71, 0x93b6eeaaeab30fcd, 0xe375eb5ab3f8d2e7, 0x83e3bb47df988472, 0xbea11b7e430756c7, 0x2d02bddce1e77009, 0x31fb7dd3b989bf73, 0x1391a97,
+0xaad87f82e05221eb, 0x2462749e00ce8c07, 0x1093cb74d2ccb837, 0x55f5d9defd2e09bd, 0x793f61f9ba91ef3f, 0xee252b7d6a0e0508, 0x77bde9cab72ab1b0, 0xf9ca78c00731fc06, 0xac8f569e40cb400d, 0xad788b1b,
+0x1b439e5bd7dadb71, 0x93f6dd8507023381, 0x9a8042658787d1f, 0xa2c099b4e8e0d0b3, 0x279ab38cf65b5940, 0x2afc9b7b7eb671e0, 0xd84e4fda839914ac, 0x3c40d588f5dbe3af, 0xca9ab8f9b804ed16, 0x13deacbb,
+0x262d8216d8be9560, 0x4f3b66710c906e5, 0x452978ccd427f2fa, 0xdba2437234cf7b73, 0x803dee969f35c746, 0xccd32fb51819f574, 0xf9e01dc9991b9d20, 0xe56485d5b6679d21, 0x7eb398b4f2fce4d3, 0x25b35a0a5,
+0x17499bed582886dd, 0xc112572b8974e799, 0x8d13962532a68c2c, 0x59796a6f31b3b1d5, 0x56d498bef41719bc, 0x389e7d98b7476778, 0xfdddc2b812f08de6, 0xd3f6186439f7f39f, 0x9070bd78e77e7a0a, 0x1633f7dbc,
+0x90113484ccdb8157, 0x7fe5e0e6e31f6fee, 0x1520f5aa2e1d152e, 0x43e8cb7b33665898, 0x4dc02caeaa3d833d, 0x598800d20fbda872, 0xc1008007c25b6801, 0xa27d436832eba691, 0xb8b2f2f2fa5cd25e, 0x18c25469d,
+0x6925068a462e72f4, 0xb59d53ccd2bd1e68, 0xb49d26dab01c4f84, 0xcfaaadd2896cb7d8, 0x7ca8517b2b02c392, 0xd68eb6568b6c8d6a, 0x7cc95cdea4b60e34, 0x8cc47f06ec3e130d, 0xf1fcdd8d8a7ab937, 0xb288cf15,
+0x6bd2a946e986d56b, 0xbfbb91db54ba061, 0x45b405c85294bdc4, 0xa0573b756025bb1d, 0xfc1b053964a95ec9, 0x3d64a26fcfc569fc, 0xe0315d1965543ac3, 0x5212fcbb508437ad, 0x53f3eead8b85b2c6, 0x18c8d1685,
+0xc0bd395cc8eb5adc, 0x3a8643bc1fb609ee, 0x3439f55279ba1b47, 0x73173b35a8aee9b3, 0x51e27c383e0aefc6, 0x10a8f7ce3b5bbf5c, 0xe691ed7814f46c47, 0xa1f291435a52f2b, 0x63dc4dde6c6c75b3, 0x224846e1c,
+0xc3eb687f1956291, 0xbdd9b976d0663ca, 0x7e9dc3960344b6f6, 0xe7f3a7ead07a285a, 0x76f3468b4f816662, 0xa88be6d31dcb620b, 0x3120577d3d2b4461, 0xf864b7d085320681, 0x3b3463347eb3d73a, 0xb27d9e60,
+0x7b8c81b47f114fac, 0xdc905d8c40ec68b9, 0x50b4031636c0cb6d, 0x11b39fd181288846, 0x86b6c31d77af5f15, 0x94c142df88a8d64e, 0xd560afdba5f3c5c6, 0xb15368f5c0b8eba8, 0x4133cc313d02bdce, 0x1a6cfa32c,
+0xeb65fd6775e3388, 0x8ed0399016683a1f, 0x46b0f1da7b7d4c1d, 0xc96261603a6d135b, 0xe488abba375796dd, 0x49fe4cb9a472fbaf, 0xc81af68e69a773b5, 0xd9f2e79b0c59be03, 0x61780d6e9810de5a, 0x22ad9cc62,
+0x8d70a92930ef0700, 0xa91f8b4d408abe7f, 0x3bbe5258284fc961, 0x22e92b72c6630a9f, 0x6443b879d2f3b673, 0x1c3ea9b3ba9b534f, 0xe7574cf2023c8abf, 0x3de9a2fa4c01eba6, 0xffd8372a3ff52d9c, 0xd59ec6ed,
+0xdbc77458646e4263, 0x32f871791afc991a, 0x872e7824fb1d3053, 0x1582ff7c5de9d73c, 0xb76daaca312e6b33, 0x66344116d1ff0a7a, 0x1e5fd8d931f2a61c, 0x2d58e310bddc67f5, 0xa5b2120e9504d7ae, 0x5db504c4,
+0xfe9a5c509b93b457, 0xfa17397dec610ef5, 0x6a90a543fc483853, 0x2c9457178e79cce1, 0x82096fe2a0af6e3, 0x15c4d33f92d15347, 0x554a8fb46bc17124, 0xf975da1c10af93d8, 0x730b3e7be0bcbab0, 0x2772b9609,
+0x271abc4ccc59de3d, 0xb545c960904ad582, 0xe17d49cc3cf7823, 0x647afab54af968f6, 0x66e3736349f8ca11, 0x3e3208781d3da955, 0xc10d4403877b62b6, 0xb010781337f7bfb9, 0xbe10da316eef15cf, 0x148612715,
+0xcc0c74fa01516684, 0x8c55a3cd1ba3ad7d, 0xa8416aae024187f4, 0xc8034b9c03f5525e, 0x1d109c575b0f331, 0x4704c81b5181e675, 0xc1192f18483b2f19, 0x512a798cbe32e2d5, 0x4b095f81e21bfb1c, 0x1ec566802,
+0xfef9b756be59831e, 0x888870568756b886, 0xb376422cc739b4a5, 0xc95a1beefe60f40c, 0xe481ff413eb772b8, 0x7fc859c30f27123a, 0x83a6961e4a5abe8a, 0xcff65f9923454f07, 0x8aa2769396d4fb65, 0x192b50a43,
+0xd59fa38548965a8d, 0x691a0842bca32e54, 0xbbbda0bab9667484, 0x46eed831a2847689, 0x779d71fe299bc1ad, 0x79144aa595d997c9, 0xfe5e1dc9c66f09a4, 0x3faf59e43c533f, 0x19c8171d1e36652e, 0x250bc80e9,
+0x65095d53aa5ab5cd, 0xac02074fca4eec20, 0xaea5120daa0b6ca0, 0xa0567357f780585f, 0x13be94082205fcf5, 0xf466a735379afe4c, 0xe12fbd58e1a730ec, 0x20d724b75f1c9e29, 0x7ead071876d8baa5, 0x3d1f8c7d,
+0x928a8b931b4aeb16, 0x9dd6523ceff986b2, 0x239e4ca2e912c55c, 0x2096ae0b8a2a27b0, 0x9d0a7f39d1cfeeb2, 0x4196f3c667190808, 0xbd1f9c1b6c14a5bf, 0x5c73f72ebf50186c, 0x4eed90710f9ea9fb, 0x102dc96c0,
+0x316c35ecb273d968, 0x986d9163f1786961, 0xad15651de54739c1, 0xe01552f6c96f7faa, 0x4d4c02d5bb15c7bf, 0x3f788d72cbd4c34, 0x4861774f907de6dd, 0xdabb12eca2c93f11, 0xb6e3b34e7614794d, 0xb7739dd,
+0x4e853e90cc053e71, 0x46ed44fd8e0c3663, 0x936213fa2ddd5253, 0xe18521b90ff7e125, 0x57dbdeb3ec92ec5d, 0xa07114b3a7271a21, 0x161065dca99c9f0, 0xb6a4355d38ce2cb3, 0x187644fc499100ee, 0x256e2c9bf,
+0x137db638cfcfe077, 0xb8912ae185a48e4b, 0xe985afc52ba81afa, 0x74d3e97ad88c88cc, 0x3003d199d1a87d5e, 0x5db3f05e516dfe30, 0x1128a3a38809e5a9, 0x1f2f27200cd53296, 0xb5eaf853d5e14ce8, 0x35f162de,
+0x25abf344f9785bc3, 0x1459c93b25ed59a8, 0x483a11247ae6ef9, 0xaacfc9ec7d06d9a1, 0x3072b7d8ae4bbe7b, 0x74070c0aeb3c933a, 0x3537d757d02c71c6, 0x71f7bd58f525fa07, 0xa339fd07f04f7bb6, 0x1d96646fb,
+0xc5d46ffc2ae58cb, 0xe0c619a27f6d4093, 0x82a6980d2e441751, 0x9d12d8bc29abcf0, 0x80cfca58c76ba87, 0xfe19f3731c347877, 0x603edc739e2405c0, 0x2b6c062921cbcd2, 0x12dc2db8763adf3a, 0x208d9b322,
+0xe3ae10dcf0669ccd, 0xfa6a26aa335cf583, 0x68e01d717e90dbb9, 0xcf5f50f0b1f3d9c6, 0x59c983c273b10536, 0x52a4d0494be0a101, 0xe917093c032c8acc, 0x14b3e8460c1b4813, 0x7c95fb5065cb8e2d, 0x22ee53f27,
+0xf8fde3345e0989d6, 0xa16d152987bacb02, 0xdc02fd6149a3e0ce, 0xe992728b3f8960cb, 0x4c2f2ced6f353801, 0xb5993c4593395e7b, 0x8110a3c7e76760bf, 0xee7b76144aa00d7d, 0x870b78c05d115b83, 0x25b3cac73,
+0xe5eed5f349d3b6c7, 0x9527054452c54c75, 0x9ccc6a338c6172f1, 0xde6523354340497e, 0x1bc442359c38a710, 0xad1ff2537cbcaf76, 0x5f918970f1b2693b, 0x5ea213b99fdb5705, 0xbfd8a5c09b9162cd, 0x2e6a3a2f,
+0x2023fcce7b3794a6, 0x94c57e9e59814932, 0xc42de8f4bd3e29bd, 0x27211d0948711137, 0x3fd5388dd80b6616, 0xd8a26cdc917c9925, 0x1835f782693b9086, 0x6468781d5acf7f92, 0x8ce81d66fbc2acf9, 0xf10489d,
+0xba774dcf9bae66d, 0x31a0af6c48106f10, 0x61ec4c8211287635, 0x851bce3e28649d85, 0x2a1b4b0e150dc3fa, 0x6e0f7c10900d19e4, 0x99a22804f4d7b88e, 0xf22cfdcb3e03246e, 0x108493104d11c820, 0xea493592,
+0x93bec4c09839bad0, 0x29d0bc6d576612cc, 0xaf579dce0919d8a4, 0x47f171196b03e3d7, 0x2030ea1f6b273be3, 0x24c7a1deca28da46, 0x55972fd77e6b9791, 0xc6ece26cbc1a00d3, 0xfdb00aba261edeb4, 0x1b5d9ca76,
+0xed1afd1e83a76c4a, 0x44a3c6aa78a724cb, 0x2ad185508a35f54b, 0x6ebabe292bbf810e, 0x2716d125be2d5c5e, 0xf60484bf7bbc1dde, 0x467ced86a3d8b885, 0xca372cde107ff91d, 0x5fa18594f5eedd90, 0x2504794ac,
+0xfa48acd493c31a4, 0x2598b41ccab0c132, 0x809e12391564e674, 0xda54340a341c1aac, 0x504f2e17f6fee023, 0x40d80cd22cc3de87, 0xc311d182a0e8785e, 0x6be164c66e70c855, 0x10b6307cdbd01fcc, 0xef560836,
+0x2e8ee4518890ab8, 0x3c33f466d75f0c86, 0xac15706adfe58ad7, 0x349176002aec1acf, 0x26bfe5ce3f7c42f4, 0xf072b7d224eba8f7, 0x410041e079a448d2, 0xc28302ac7e0932ca, 0xa332d99fd46b13b1, 0x100476731,
+0xe4ade02235415821, 0xeb96cb86dbe72014, 0xe43476b3ad64daac, 0x85f7afc641b057d, 0xa18c37752283646e, 0x6cf7511869da1597, 0xc8024f7bc2681eb1, 0x601d402b6655981b, 0x4f0725c0caa46069, 0x1a580b6ca,
+0x5f8ba094d8b9d151, 0x1ed9f527df9daad8, 0xc556e977ca2be5a8, 0xd993b5bb6c9a43eb, 0xa7977ab496aaa4a0, 0xe51e679c265c7438, 0x275e08c3a8aabe2e, 0x5f59ffae3ac769e9, 0xd521168aaf527c69, 0xbe1beae8,
+0x775e93dfdee880cf, 0x1ff102b627f7b16f, 0xaad0f37b97364ea1, 0x53bab68f72bdd224, 0x3910efa2756de7ac, 0x7b886ffe52788823, 0xb78bc870d681a260, 0x55fd7d3a130e9e52, 0x468a6897300ace74, 0x195fba5f3,
+0x78f165926d32fe6c, 0x4a2d0eb26edc0f6a, 0xbf6cb21f2b23e8d9, 0x2594fa108ecb30ed, 0x994b60ff5847d0de, 0xfbc2a686e11b47e6, 0x1c62536f1c51e5bf, 0xa208af92928f2451, 0xe08ccd155f38899, 0xccd187e1,
+0x9203eef7c8bf485c, 0x86524e0b2829bc8f, 0xde35f654b80ae255, 0xfec6327e89fb5af6, 0xf79dc8cbb031fc6e, 0xcc7c9695fa33a0ed, 0xa9a4169e32c7ce3f, 0x2efdc4597ae26a28, 0xcd1659966e68d6fd, 0x18acd99e1,
+0x905e885d067889ce, 0x9751afc1157049c6, 0x601f2b2ac476d6c8, 0xcc492be8ec73efa9, 0x82f7924d63803aca, 0x87b30e304a5ba283, 0xed17739e5c1dc1bb, 0xdc0700d0c8098b62, 0x1c51688f10621a19, 0x15af2f80,
+0x30c0e2b5cc3bb727, 0x8c592b1ffc16b5f8, 0x194b8cd4021e4128, 0xaf4d4aed7200bcb3, 0xd2e85f621449b2ff, 0x8d834168d905ec2c, 0x2df144c509e1544f, 0xe190d0726ddf9d33, 0x8ad80f44c02ef758, 0x10b61b7a8,
+0x1b406517b01bba8a, 0xb95c3101b44359d3, 0x28ed82fbdc341e09, 0x7a55fd1e36a857b8, 0x62771189422fdefd, 0x9930d6e85d6ace7, 0xf74c63fd32c2338e, 0x4b030906179c9f00, 0x541dff6d3692fb6c, 0xd9884534,
+0xe332e2ee6532f393, 0xf20a4c860ef2fc5b, 0x5e466a9f889a1459, 0xd181dce7814bd169, 0xb0cd56f0d6e0cb01, 0xccf82951ef5a1da0, 0x4c09941c07b29ec3, 0xd0f848ced0c6590d, 0xee7968fc3a705fd1, 0x58231114,
+0xf114726152120626, 0xf69d511cfab46c5b, 0x4cbb9dd6522ac987, 0xe22caafb51e6c70f, 0xb144cfea6005d2d4, 0x37d4df48cc73d388, 0x4c35a9a966e7ba83, 0x2dcbf8d0ab641602, 0x5d3b5c8e624b7508, 0x156bf594d,
+0x3335be1ada94e8ef, 0x8aaf8ea935ee92ee, 0xca4edc1ee1ed16a4, 0xa491bd93728d7aaa, 0xcd6b8c2abdc2c5bc, 0xb8385797da16ee89, 0x17d5eb41ecd539c9, 0x6590af321f36d3ef, 0xa5d5955ae20493c7, 0x123c4b367,
+0xac2e7fb3d755096d, 0xed4915276e97db5a, 0x14f6fd69e0145f47, 0x5d3ba29ba9a581ef, 0xc5d96e77946fa891, 0xe7e645bb71cfd65f, 0x4dc0d4a0f02b4995, 0xfcf0e29b775a97ca, 0xc36d98ba0e5a1194, 0x209ecec97,
+0x422425f59aecdbb2, 0xfdc33b047db802ba, 0xfac802348d924a66, 0x6e4beca9aa2d2520, 0x76498a845b702d30, 0x83b6ad1744ac2c64, 0x5ffc5bc44b2af187, 0x472a456bbd616479, 0x4fde25162ad63c8, 0x153e35e6b,
+0xeae5c5e1f873c72, 0x34dfdc6957f904b6, 0x236080066edd06cc, 0xcabc07d984e66791, 0x7bd603a8978e266f, 0xb019c0730542e7fd, 0x9fc3bf4bd68e0cdd, 0xc99a9267d879e4d2, 0x245f8e0088e0449, 0x1af8bbd81,
+0xaece77840d2f200c, 0x9943f4c39ca1979e, 0x1eaab1dcedea14f5, 0xd3bf91538f0bf30c, 0x495e524477e8754d, 0x917432842674b543, 0x7e7a93a718b89175, 0x3ff2d2748bc1c238, 0x56cef9e2614d6ddc, 0x1057f0619,
+0x9bb45666de2974a, 0x603304250df1bd9e, 0xede0aced053193d6, 0xd80c0d361f3d73aa, 0xa20a6e9f336e0a00, 0x9c5a10ee49beecc8, 0x98623d37118a845c, 0xb4cff1750d951d52, 0x5b56a32a73accc89, 0x74fdd035,
+0x8c2278b006ecf2c5, 0x87776fc9576c7ca3, 0x65e3a6e97086a7cd, 0xdabd3612a85aa01a, 0xd2b0fce1cb5baa3c, 0xfbc1e64e5351c2a, 0x7ad6760c47900f4e, 0x242191603b4f5ddd, 0x664f23c71b91674, 0x18f035de8,
+0x80cbb3373f4e761c, 0x9aa18d1318cf3ede, 0xedb0ce6db8c4c65b, 0xd804f1ca301f8374, 0x3c71a83f2029b2cc, 0xc18240d854c7b444, 0xe959efed90513d38, 0xad7d7a22e86e69ce, 0x8873154d4cdce183, 0x1f55d58ba,
+0x6bf77cdf86054b45, 0x4a24e0efe3ce0dd2, 0xc109443126da0a6a, 0xa23de53c80e30e27, 0xffe5088708a5a08c, 0xb6229396b580c8d7, 0x4887d2000ea68b8b, 0xc9c0acbf942a81dd, 0x7ebdd31b431aa151, 0x22651177e,
+0xe93c013ae0504118, 0xc249915199af341a, 0x347aa2c5233099f5, 0x813add3d5d4792d5, 0x10ca2c3b57940e3f, 0x458ac7762e07a7f, 0xa50c976a235eaef7, 0xad25b09fed91322c, 0xb6637b473cc718a7, 0x2790947cd,
+0x68b98832900cd434, 0x551309a0467a4a2e, 0x5f36f27a853f9724, 0x938010894f4b68c1, 0x2e340008f2089cd0, 0xa501cca670204aa4, 0xab472ec67f0acab4, 0x9277a9b260e5df86, 0xa48e5b64f7044a2b, 0x99c24c08,
+0xd969de0031642c2c, 0x9f16f9b867a6f6ba, 0x891d5d346d93cc61, 0x2b8cb0c67da426bb, 0x306153df8416e5c6, 0x2afcacb4eef6493a, 0x504727d8111407a5, 0x4ba272d6a3ad43f, 0x6a06976274c90276, 0xe6cfe990,
+0x7ea365cbb73e2ee8, 0x2d2f09de64232a58, 0x788adc914736599a, 0x9a22d36034ab7fc, 0xe39922b9185345ea, 0x9691177d7c424962, 0xc4fc7a39b7328e16, 0xfbbd01e95abf7ae2, 0xad8875fd05862200, 0x14668e3a1,
+0xc4df26d160e7f823, 0x4cd90f38a2a124e7, 0x6ab2534a42c80e0e, 0x72b1fd0422cf7a4f, 0xd41c7edf6cc7f83, 0x789583c6a0663898, 0x20a09b1bb0c7b58c, 0x3464ffb2cf7c95ce, 0x6bebfc3a5f36a122, 0x2255bd5fd,
+0x215a68c34800cab7, 0x44bb09e55c18c68f, 0x4b809b474c3b95bf, 0xe4505f8133a8ffa1, 0xcd10d783cf422e95, 0x832a5363b9b025d0, 0xc78b82df32a21849, 0x818fecaeba73de6c, 0x34f5a67f085cda13, 0x18db5050,
+0x66bd3faf5c8b1a7c, 0x4a455072b38e439c, 0x65493be70208d7b2, 0x65c008419267eff5, 0x870be06dd5f989db, 0x1034a14172b5f517, 0xc3a75a43f8efb6ce, 0x6eb9649db393c581, 0x1cff17875a140966, 0x23f8798f9,
+0xd63f04ba6a5908e0, 0x5d9a8ee249632e82, 0xc4d31bbf6055e795, 0x8139793fd308c40f, 0xa55b316821c98158, 0xbfdca4e1350c10f5, 0xa3b4bd0a31470d2a, 0xaf79ee836348a411, 0x418453596fadbecd, 0xc1d891b9,
+0x32a92c61a8d46229, 0xa57a44a353bfa187, 0xbbef4d95a8a8ac69, 0xf65eb12d767ccc98, 0x714cf251a1969d71, 0x30a2d620716c8e9a, 0xbd914e3f0aa37597, 0xe49fdc3566204a65, 0x272f7178e07985d9, 0x1cad45417,
+0x6e96845256d2bb51, 0x9bc11e1b0bd41570, 0x1d06e5d5a260b1e4, 0x851520dad36cfa03, 0x90339bcab0287b83, 0x85150c3a3f52c34d, 0xf98c284e4179ef25, 0xc274f5f4b66aa6d7, 0xa10a76d97561ce85, 0x6e3d291b,
+0x25d671191101b6f, 0xef17d0506da5b684, 0x86563f2613e757df, 0xb8d2c4d734a29faf, 0xfabc5acf15f02a9, 0xd38562de54a72eff, 0x223c626deb9b7dbe, 0x566e30f3354a939d, 0x72c4f1ade0927013, 0xd5a276cd,
+0xaef221b833b02dee, 0x7f7780438408a8c5, 0x152bf853d820e95c, 0x6a52a77b2bdf5811, 0x28e193afea554953, 0x5e81bf101f5bbaf0, 0x8d92618769e62d7a, 0x2e657bcf521d48a4, 0xa27b99e55639617d, 0x251188ec1,
+0xadbf6ae7c43d3f93, 0x128562db1091efcd, 0x5e035a4673a8f3d3, 0x5ef370c77f5df2ec, 0x317568a9a47d9b90, 0xf54ad547758c9caa, 0x18a3eb92fb37ba00, 0x54227a767c8a3101, 0x406e99bdf044ce1e, 0xcaca49cf,
+0xecb5822b9d4ed3f0, 0x81bdc11e15e559bc, 0xaed00da9fe2d0bf, 0x13075d0956abd682, 0x603534e808d8d4b1, 0x1f4b1ca705978854, 0x4923aeb8951f3cb, 0xbdc1aa9c991cfa97, 0xa37db4e1fbfbb419, 0x1b0d4777b,
+0xccdb77502ce195cb, 0x583ee7e0f5fc7029, 0xfb440efb7d59c9a1, 0xff925aaa8b2d4368, 0x287036fbb76faf1b, 0xce0e3dacd2be9e32, 0x1fe765ca98cd602, 0x9ffdb1441ab7a784, 0xae56d9d5f31611c3, 0x1bc0d8452,
+0x82a0ac3d731a360, 0xcd5d1aa3c37768f3, 0xee2758a3d3744195, 0x958dac012febe29e, 0xd161a6d6415f437f, 0x9daf99d4bb75da2b, 0x53af3b97085447c7, 0x5cea4603ea64a6f8, 0x427fd46bc7e6cc7a, 0x23a058f50,
+0x70e380f4cd67ad9f, 0xdbb1953a107e5afb, 0xf7ef86d3b3090cd8, 0x9a8ee290f2d87983, 0x65ea541556d5838a, 0x4101393a1a294fce, 0x363b456b7e721641, 0x6774e3340e2bbbdc, 0x66dc1cfc7b5b4163, 0x985eb7ce,
+0xcef331c8c96ca240, 0x46e9dcaa8ae3132d, 0xc2d77ed9bef93f7f, 0x763f20d84a4cb3b5, 0x4713c4368ad58d46, 0x5af2309e217409ed, 0xb877988c9d9ca223, 0xc8eea7b5e658ed85, 0x3834727ed063e471, 0x15c54e940,
+0xd2b7c614e445cb85, 0xede9a581b34be758, 0x9967c20e591e27eb, 0x9e85e77c8fc6e01a, 0xd03f50ee83a64098, 0xb28e2ad03da8bbb1, 0x366e9bb16bd987b9, 0x6db6b77f35b2ae7d, 0x389f109ca65e8270, 0x1bb40cf6e,
+0x9e05b2f80d40b6c2, 0x42021c25c4a51276, 0x8faef6f2805246, 0xcfa7fb2d2836baf5, 0xe0d6adadc2b51617, 0xcce049b58d780e2a, 0x61676b9bf75ab4a7, 0x70726d089b9e0fa7, 0x3a8f25c871922528, 0x21db3688e,
+0xc1c3a379d1aebfd0, 0x4a2405e114e8c3ce, 0xbceed77a3b20b8e4, 0x5dd7c3198b1cdb07, 0x72ae7cd430e27f2d, 0xe5484795a6f3a8ea, 0x76bdfa821a51c237, 0xd79761a7c0743d8, 0x690ebc675f6324b, 0x242b03c77,
+0x1ed9914231d93ebe, 0xf188a4bf7165fd55, 0xf3cf0b640997399e, 0xf7caf4691a4a4929, 0xa3304848aa2b6493, 0x72155790665d765d, 0xb2fcc51a736e2876, 0x1faff1487fe389a0, 0xfc7d0e0831896b3, 0x557b07d7,
+0x987252fd834645b4, 0x2be22483dd39946, 0x26663571aa866b32, 0x28eda5641ba1c87, 0x223084478a54477c, 0x63432364a0f0407, 0xdeedf2dd8bb2b424, 0xae7d6ffe395b761a, 0x3e8065dd9049aed6, 0x8238f041,
+0xf3ae7bd690e61140, 0xc494c61864a90021, 0xfbed1ae3710d4812, 0x678c9c1a03141204, 0x57784cc55cec8354, 0xdbbd1395a938ebbd, 0x6f2fc586be23115a, 0x7846575a2f2bcd1d, 0x553cb1310137e302, 0x1c4eaf7ef,
+0x6419516db7f2115e, 0x737d7eb639381161, 0x4b63b93c5228daa6, 0xf8d25fe346304bb3, 0x1ebb861b1f6908ab, 0xf3a3a6a8b69c8743, 0x58814147b4f21beb, 0x8bd14db784bf9a75, 0xa84c536c31d167c8, 0xed1e0faf,
+0xb1270336d13569d0, 0xc12c0235361837a5, 0xeedf6a02bcc6dc88, 0x4a32d71463c7b410, 0x2bf3a489f9f9fab4, 0xefc13442b6ca71ac, 0x2b8d1af75186f04, 0x3625fb081cabcc3e, 0x2a0a88c84a04cd61, 0x149dbb055,
+0x3e36d7dd4abd03b6, 0x55e176951b3b6563, 0xa514641b3829d5ff, 0x8e65c4349d3fcff5, 0xb0660ad51d440417, 0xfa913b6c74b0f8c3, 0xa03a29b59d14df43, 0x19622a9484408445, 0x96fa0ce5dc294bb, 0x5b285510,
+0x20df283d82e74b23, 0x36936faa02dd248, 0xdfc6518bf70c813, 0xf74b88d718af4fd1, 0x70a9913787e6ca8b, 0xa714bc5a9156a2d7, 0xd4e0f79419b0dd20, 0x7b558bdaa7bfe533, 0x447004c3e8c916e4, 0x155ed7a59,
+0x8e2a649267a8831c, 0xe993a1d4ab8fda9f, 0x5c8aee29e3318a4f, 0x4f082eff9a312d58, 0xa3f75c9519d7b921, 0xd25600a98f123ee, 0xfeccba21b3381430, 0x5f99ae90bdf160cf, 0x93f821673d8620da, 0x20f2fc60,
+0x80a377ed9d65ba44, 0x4986a91e27201a3, 0xf7bf9dfe8932b4f, 0xc23a138648d13c24, 0xc84b4b14f1ae495a, 0xf65edbec7c7eb31f, 0xfe520b647f948188, 0x62ed0b01cb1b366f, 0x6f0556acc4571662, 0x65cefa8a,
+0x8e72828f1d0bd22d, 0xe529adc5626441c2, 0x951398fce917d411, 0xff84d2652b7fb494, 0xf20d9cc1f9bbbb54, 0xbf2574c9aac4a48e, 0x4844ddb9d433fe8e, 0x57be75a92db3234b, 0xee6d5153e42cbaf6, 0x119dad213,
+0x8644275843a91628, 0x840e06e24b5de1d4, 0x4c43aaf2111cf07, 0x9e1cf28a954e023, 0x4a227d99c3ebc3af, 0x66b8924319a967ec, 0x615c1ec05c0428bd, 0xd07b65b136e804d8, 0x6cc7ca5b4f7e961d, 0xb59858a0,
+0x3cc3618a0b692ce5, 0xe5f0985374ff84f8, 0x9916f21bcda2ad6d, 0xb4d4cf6052846867, 0xe7d9fc97c16bf8a1, 0xcccc7a17a72512db, 0xd2c0c74b68995ba4, 0xc09272af842bfe01, 0x9db10deef9714c2a, 0x25fbe758b,
+0xc25b4dacc1002c2c, 0xeabb1d05e7252c36, 0xda2d8be7809b31ce, 0x7b24eb24a9373f1a, 0x874fb379349fa9fd, 0xd1011431c0f569cd, 0x5ba1b92746c75803, 0xe66dba958a713e65, 0xc88b3ce12f9eb6fe, 0x99179432,
+0x5ec0a2ca3bd4d513, 0xd8f89896fef806ad, 0x4d12d6b40a22851a, 0x7a0f99fba6081253, 0x509209ca70309b17, 0xe5841b30291a7f0d, 0x16ae0a2a479cf48b, 0x2285116c961f3973, 0x9ad5d083bd68b91f, 0x12231d9e5,
+0xaf79f01ace88e974, 0x28d7d6a2e2f7fe0a, 0x715774a3a552accf, 0x95e07c75dfbac5e0, 0xc8763a1de7696066, 0xa89f6b80dcd90acc, 0x53773334b0c6478a, 0x37a2919bb0b33df4, 0x270d4d6986bd8b54, 0x133d31607,
+0xe95cb30ecd0232aa, 0xd7fa0c90c4d55c89, 0xddcedab99b82daad, 0x82972428465878de, 0xf8c727ce33fc244a, 0x9cc768f12659df3b, 0x5955ce5948f6a83c, 0x5d5c6a8ffd4fae12, 0x72de118d181e1385, 0x208e3d551,
+0x1d0e2c88607e15fc, 0xd4e878af42537442, 0x3492bad839eecd56, 0xcc67795feefb8891, 0x3f840f33e15d3fe7, 0x836b5482f77d14b2, 0x7864b0d5e91c3fdb, 0x456717544fde1397, 0x339d7f297cf09a35, 0x14433b502,
+0xc501c27438f97b04, 0xc44dfd3f39485007, 0xad5da1173ee79388, 0x4f545ae6c4a0c72f, 0x12f94377b32514dc, 0x2f4145e8b18277f2, 0x2d378ea0609d13a, 0x111f82abb54feac0, 0x500f71a3f1a7e64c, 0x102becec1,
+0x5be1cf729498cb1c, 0x8b9b774106504068, 0x35c0ba7d6b9b548e, 0xc0ba1e1cf5af1cca, 0xa923c3df057d082f, 0x516ceb59ed7581df, 0xcc7713fbfc340942, 0xba9d0cf783485e60, 0xdd5794f426e3d3dd, 0xd1ec0bc6,
+0xdef7c0ef3b44ec11, 0x4a885eb9ca3d3ed4, 0x253a55586428ebfc, 0xc1004eb972bbed48, 0xd47b21e66740619d, 0xbf51e05358508a8a, 0x9a036e89e928fc5e, 0x78dc5618138dbe9d, 0x31eafb9659b3bcf, 0x246e93a01,
+0xb93cdd7ca1c89733, 0x692dd537ee371948, 0xf8e1abf24a86bc8a, 0x43cc0fb9aeec9d8c, 0x294c3d0159029310, 0x224651ac3e16755c, 0xcf70bca8be83b584, 0x76aa2608de47ceb8, 0xab2ca127dc3baaac, 0xf0e93ea2,
+0xb47ab32cfb0d3854, 0x782b3107630282a8, 0x8099d95e32327090, 0x5017e7c31cc2d9af, 0x5a6ca129388af00c, 0x89795256e5b5b41e, 0x7118cfa3f26d51bf, 0xe06ae100b1a64c20, 0xac4c01f4e0cbc477, 0x6c8f2c85,
+0x8be6e333473b5f0d, 0xb1a2d17c1e0ce5c6, 0xe54fa3724ac9e248, 0x570ab3b1c6afe158, 0x708705b000422783, 0xb59a2ed10a49d49f, 0x9883f3a922812e48, 0x6818f2cd003ea0f7, 0x2edc63b95fe474b4, 0x116278f0d,
+0xf3f2ce78f3aa2217, 0xe4db9760d6dacaf1, 0xc1c48a9e0c252e17, 0x231c8527440af4ff, 0x596af5efe733aafd, 0x9257d87ae896470b, 0xc01ed95be095c3dc, 0xea7421c414b99c02, 0xac74d3d046bc1f9b, 0x2078f6ac5,
+0xb19a8102a454ad4a, 0xd33abb8070971cd8, 0x908814a95cdaf3ed, 0x2958688be1f38172, 0x10020fc8ea1c95ef, 0x59ed8fa9b2af6b45, 0x2f4f5204eb74e148, 0x32f1c7cce580787a, 0x7d1e45fc37735a76, 0x3bbc80e7,
+0xd1c1f2a02200ce44, 0xf17582c316628cf8, 0xada8778484dcb297, 0x45327aa10ddcc3b8, 0x30adb7c6e63d0a1a, 0xba5d277b9ed846c6, 0x7402e126cab1f7c1, 0x4208d9e74b279bb2, 0xc105d383a36c9544, 0x1e0f56da9,
+0x39c58f6b905653f7, 0xf96a0fff2e62760e, 0x66d07e2236d4f44e, 0x20987ca9c3c8f4a7, 0xf5212abaec4466db, 0xed351a0bd2c1e221, 0x250829bb9d45c5b3, 0x81380ed1940a8620, 0x57530ad913dfd82d, 0xf39849c,
+0x7648600af9e4d496, 0x76d214688963fa95, 0x51b6fd67fc4bcb69, 0x26689ef16aa0904b, 0x96f98b38b1ecaa35, 0x8c19f17ccc43081, 0xcf586ac90f90dd85, 0x2e6e2b7deafc70a3, 0xaba616bc7e65b3ad, 0xc67427a8,
+0x9092597859e31c15, 0xa641fd46f0c4a4a2, 0xd498f9284d40054a, 0xccedd7a8d826dfd6, 0xd838f2727aec9d83, 0xc0f35bd88f609536, 0x6a95e130fc6d8d0, 0x7fef6f50ede1f991, 0x57fb5d4c0ae500e0, 0x25ed35bd1,
+0x4c28b128e38b2cb5, 0xd95d343a3d19e1f8, 0x699f33d1722688e2, 0x4cf3e6614dcd7cf2, 0x95f6a4903b6e7ed9, 0x98a487eef4f09da2, 0x1c876c48707e3c61, 0x85ae1ef4820d895, 0xc24bbde0446059c2, 0x237a2c2fd,
+0x6dd4fd9856c2dd7b, 0x71fea2c3424d060, 0x5dbf0f5372fca4d5, 0x8d76218928039568, 0x859ad3bf78ace431, 0x37a8d8d036cb2546, 0x90725a2777990445, 0xa2c59dd5cede08bb, 0xf38cc50d67fda4df, 0xcceacf2e,
+0x7b501ecbbdf73beb, 0x76ab3000364e0b33, 0xdc2d6d32c87149de, 0x2d527a9611ae06d7, 0x9f4510a37acb7d92, 0xbc857cb49160b6dc, 0x534c71a4d3fb83c2, 0x825dd66e208d762, 0xb7e4a0ec524f0831, 0xb37aa42f,
+0x51ae86954de75dad, 0x5ae7fce163c2b46d, 0x1a6dfef71db1019a, 0xf36085b2a8e6c54f, 0x8f5ced44897190b4, 0x8358e4612c45af43, 0x67c52ce8e6e8dfd1, 0x3310473540584531, 0x4019ee233b26386d, 0x8b6b7c0c,
+0xd7533104de6e80ae, 0xc7c999aa6bec6fec, 0xd1b0bcf413fdd53b, 0x810603f8055be02c, 0x5bf5c3d363156071, 0x8503a065820e2dde, 0x225fcad088fdb0dc, 0x76588a9717269261, 0x84516fb75d6f1ee1, 0x17a253597,
+0xc08c588a2bbcfb11, 0x70b962ba98f5f2, 0x51a233d4619e1dd7, 0x9fc7e146b9070f89, 0xd1a3bb91427bfec, 0x99ad91967ddbcbd7, 0x822293953a2402b2, 0x8870fd97d66ee9f8, 0x4adbc6d60b6bb661, 0x1ef1363bc,
+0x6d09c3f1d39f2091, 0x4664818a5fe0ad05, 0x81bb6d3075ff9fd5, 0xf7a5ea4d1cd14e18, 0x9fffd5506516524f, 0xef3efc67d5e5c993, 0xe910a0d74a2e3d86, 0xb4ad5ea17b47c498, 0xf28035ae651fb65, 0x19c18c198,
+0x506fb1068b1f777a, 0xca1071ce7519db6a, 0x150f7b690813c9c, 0xb5d1962c0b68775c, 0x43f0e77c7e5126ab, 0xb363ce9ea6d20278, 0x3fc19fc9f47308e7, 0x14f01e538b58c07e, 0x4e302babf38edf68, 0xd0c15211,
+0x9bb26d5c16ae9dbd, 0x6a00c4603a2a96a6, 0xf591bc3ed67d1b69, 0xe9a145ac45464edd, 0x12039f689cf80de0, 0xa2594003671af677, 0xbf003850d2d3bca, 0x6d756452bce6e25d, 0x313b93ff2c3bf0f4, 0x27852e6a6,
+0xdc48e40fe4cfaa38, 0xa08ff44255ca6e04, 0x94ffe3333e0467bc, 0x52084deb4d10f675, 0x69d7243f8e2bc638, 0xf602d48d2b4be7c1, 0xd7e2e244250ce1e0, 0xd9db76b01f019c65, 0xeaca0dc7a7177ec6, 0x346ce4d2,
+0xf0d172f3df695304, 0x889e4fc512c8076, 0x32ff7ef49b768684, 0x9fcc2433718ccb04, 0xfd3dafb0a667f3c1, 0xec9c7bb61224cf15, 0x9dc866c1510ad3a1, 0x2baab3b220af2764, 0xe0340cd57d973118, 0xf6f27112,
+0xe7ce04ed00c932cc, 0x2e707407ba8445f0, 0x551d6eb26a83e9bc, 0x410b175342791f73, 0xfbe7b902a3204651, 0xcf518f27f9ed4632, 0xcd16fedc46db2140, 0xee8f2652d3a056cb, 0x6b4e410352c2f716, 0xca767b89,
+0x5bc383f854f1d7cb, 0x4cee3105a47d31aa, 0xf0354c97941f81c9, 0xd3031479b41e8ba0, 0x4e186bcf479848d1, 0xf46a5231ee6f6bce, 0x858a1b72a05d66e9, 0xf97e392c1e07b2ff, 0xbb841136c275b933, 0x885cffaa,
+0xcc8cebcea6407883, 0xd3df816d5acec2f9, 0xf3e8975ac371bf48, 0x4f813e3dbd539e69, 0x511bceaceddde4f0, 0xcbc22ff9872ca02b, 0x2954fd827f452940, 0x253a56adfac51830, 0x12603f5944c48494, 0x22eabd22d,
+0xf438b6252bd7aa0, 0xa51e1b3240bb1856, 0x6bc6a51436bc1c09, 0xc5549a5fef795f89, 0x7a6bcc276708ddc5, 0x73c194eb6e95fe39, 0x9f997639cf6c67ae, 0xaa3705fef9460edd, 0xd6f4df60f6708ddc, 0x7dd5e8ba,
+0x4835fbcbe52eb39, 0x3250de103abdc255, 0xb1156c3a7ac6ea50, 0xaddbc33d2eab44f5, 0xfae0b9cd76d649a8, 0xbf830bebf0f6364b, 0x45967285bdf1c768, 0x21687a6dd07ce52b, 0xd8f4c6fc4309c4e9, 0xa1e005da,
+0x257735df384ecaf0, 0xa907c14a18165d6, 0x6e696d0233dc4b63, 0xc64261f038e37d9, 0x2e59864c53c9e097, 0xed6d57f17971fbac, 0x9623a9855eb57da3, 0x3e7376218c176e62, 0x39a7c781a4f175d, 0x9c4e6800,
+0x4daa109d13612f0d, 0x65aa65a9b4cc21b7, 0x42391de48302c796, 0x759385e9e27f828b, 0x544c3d3f5a7045cf, 0x68e2e889f216cffd, 0xfd6e1ae370b02265, 0x3f63474c210d1e80, 0xd4ebce21d182e6ed, 0x355b24ef,
+0x6f39f026e93ae37a, 0x983c9632ab0d92f6, 0x644d79707979559c, 0x7a2871b88a80a314, 0xf46f64b586e2aee6, 0x2463cc647980e4ae, 0xe205e0054e8a28f4, 0x5b24bcc1a926e9b1, 0xc3eecd8573751560, 0x1c9f21994,
+0x10f75ed37ffe765d, 0x3edc29973109baef, 0xab941cc9812177e0, 0x27f7a60cb9a9f98e, 0x92b0e07784cb2a9e, 0x2007345abe0a9f7e, 0x76a17fba91e2a8b5, 0x5e164fbff112a0a9, 0x18543f28bf16846f, 0x2765cfa6d,
+0x4d6d16a0a675e6b4, 0xae627a22e3257a02, 0x5f98137a738e996e, 0xb504ad8823d3021e, 0xe2d9019ff1f9e999, 0xc28c54fd063957c, 0x2a80548c893abab2, 0xdfa7daf3294afb01, 0x901a8a5f7c80818f, 0x1f8d1169d,
+0xf669900256b8a751, 0x6530f63fce40147d, 0x495e8e147719d4c6, 0xeac6b57d87414a79, 0xdfe3385d9dd194a3, 0xf6241e46caff762d, 0x115a4c5abd5601d, 0xc9063c9acd3c552b, 0x41d264a26be17af8, 0x123e9ebd7,
+0xac77cb6f677e4b3d, 0x2a8050e7c4bad71f, 0x468b796f61fb431e, 0xf6ac8f69cbc8219b, 0x1a61a3fb2085cdd8, 0xaedab1402de5122, 0x5f3ba631fcc5db1, 0x2c930d52bc782e14, 0x6b3b9abb5a9b5562, 0x102217560,
+0x75794c2688b47a76, 0x1996c94426b77c9, 0x553608f729ff98fa, 0x2c3d78b504c3f395, 0xeca142e814e65814, 0xe1b8c35b60aa1e25, 0x4c4be0bc7b82fd50, 0xfbb37fdeb15919b8, 0x92184078be8ff052, 0xc6636691,
+0x3853ad50d30db0af, 0xc1a8a801aa8b217, 0xf7a70eb55870301f, 0x86c0f32c019a00e4, 0x5f045605f1fdac79, 0x90cee8428f5b887b, 0x56a1079b2df5c8ea, 0x1e58394c00e50122, 0xa36cf721cf497692, 0x1f9e5c645,
+0xb2618494e940c0bc, 0x2a5ad099bdee4e5f, 0xc63c9652cd785f34, 0x913e025f7438c13b, 0x64bf4525ab13a698, 0x16fb638e3df5a43c, 0xa23594d87b42de98, 0x3ab3335c63fd12a8, 0x8b2f184f1242608f, 0x26ca5db52,
+0x2a179c0002bc0d23, 0xfbbb3d8b66ce7b73, 0x2ae4eafd49ae83b4, 0x40350e85a1119cfd, 0x8ada7db9ee93d0ea, 0x3f93416828460b0, 0xdfd91ff83ba741dc, 0x948972fc0ddfe6f3, 0x5224795a0e53131e, 0x101a506cc,
+0x8fcdadb54b00633b, 0x74654e44c471c000, 0x72eec92d26db907b, 0x9f0bcd7a029070d1, 0x7fcfee1be09bc676, 0xd4d6b4efff0ed5a4, 0xffc5d686989e0f0c, 0x20223d665216c41c, 0x96ad89408eb7db97, 0x266a9b5b4,
+0x7754a79083595c4, 0xbe443b82a63bf68, 0xcd343e796f26aede, 0xe47ef6d77c487920, 0xcfde5595849f8168, 0x6398c6ce72a34b7, 0x72489b4bafb62b54, 0xf3d59dd684e1cc3c, 0x5ed14c157c8fcb76, 0x1195f6cd6,
+0x1072fae1127e1b75, 0x738166b159143ab0, 0x6ccda2638deb0531, 0x1b7c81abe8898883, 0x13b1216da54fe6bf, 0x383b9c88dc7912de, 0x5222e2dd733e4b29, 0x888322c443da142b, 0x19808e3a61bced1d, 0x253728ed8,
+0x961805ce2086cd1d, 0x4369f91a25f1d502, 0xd5be8d25fecfe93d, 0xd3419eef4c875c46, 0x29faf3d3a55d17c7, 0x109057bb6b4daa4b, 0x716c011e53ac09b2, 0xa990776b530fc728, 0x790abdb6828de22f, 0x2f5a1811,
+0xab2eb5d46ef86d88, 0xd5808cced093aafa, 0x2ebc7ffce1759eeb, 0xe8c96194ac4bb2fb, 0x2c49cc64612d6e0, 0xa35eb5c5e4dc2139, 0x59300f4c94f3c76c, 0xa6b9d7ca4dd0d7db, 0xaf6d433e0de4572a, 0x1ae1278e9,
+0xe29e4a471a921121, 0x9ecdef82c0aaea72, 0x2ea10b553899bfeb, 0x112f548eb4bffab2, 0xfa83f277af795a42, 0x8bca88625b84566d, 0x16dde70065640660, 0xbfbff38c2c843c81, 0x413579b06398c310, 0x239cc205a,
+0x5262e651c9a8f32, 0x9465e2ad142e24c3, 0xcc6721cca1dd5763, 0x7219a00900816d17, 0x6e4b9c9a71226cff, 0xb91155912e090c06, 0xca225a70b71a2d9b, 0x807d22e9e838d48f, 0xc91c62fc02e5e355, 0x18d6b616f,
+0xaf1b28448a3846b1, 0x4312ec606b742219, 0xb3cff232872caf7e, 0xfc0eeeabddf6fa8b, 0xd0237bb487a724b, 0xe29d5ff2c8aead16, 0x793781479ca3d20e, 0x3bb4f6bc934bef5f, 0x808a00aa78f076ae, 0x5fda8677,
+0x33b36b2c9df47379, 0x58f087314c59bfe4, 0x7d3be3690eb8261b, 0xa12559209739e3e6, 0xdda445803c84f8f4, 0x315dccb1d8a4749, 0x36c459201d88e62, 0x8a91b2d0c94bf9d1, 0x1e84ef3c35a8c46c, 0x107f613ad,
+0xa34177c831d0964c, 0xd9d334270b1e5c97, 0x4566e1a1a5c29b91, 0xe44350dfb3fb3c00, 0x6a5ceb8e82a33163, 0xb184c3c37ed0daa, 0x9ac38bc86296fc4f, 0x6bbaa9b8ea6280f7, 0xf96f902f14af28d4, 0xc48ce416,
+0x2a1b4be3ee1de347, 0x4546d28593d1602c, 0x5fb9a8c7c0bd3dc3, 0x1fd845b866c80e9a, 0x20d650565bbc79ac, 0xd75933f9c7c0ee17, 0x5383d91ee780546c, 0x355769724b806a76, 0xc24b2079a1abc69e, 0x1de302ad0,
+0xc94e312782622e55, 0x29a49d3ee65edbc2, 0x197ccc743b20adaa, 0x8a65789f12338a15, 0x9bdccfa59c7b5663, 0xa17042ba9966abd8, 0x528d15efc2539099, 0x2daf04b19d635694, 0x57fc76d38e58da7b, 0x8618dad5,
+0xa3f6fd18a2ec4bc4, 0x4172a854f1405f22, 0x1188ac2b59cdf8ef, 0x2cb2ae37e046a1eb, 0x1120d2d93623b7b4, 0x5fbb0e3213ee4159, 0xf98e38ea39523bc, 0x4b9965cec068400c, 0xf1e4fc4b51d45e2f, 0x26fce4608,
+0x421865246f73e884, 0xbf431b19cf15900d, 0x4fdb7dcbb7d8463c, 0xf703f6c8c577b1c0, 0xfff9cf133b6f0dc0, 0x4e71b1d7e6495a16, 0x1a293bed96380507, 0xe3f720977f8dfecd, 0x45af1a86d66aa754, 0x7dd17e08,
+0x52a1b2c1fee1848b, 0xfe4b15f158fe52d9, 0xdb0162315be4cc2c, 0x999fdea90218b0a2, 0x71f92187a538f101, 0x37bb47a8b6eea284, 0x8a3165d78ba861f3, 0x2cdb09e09473af79, 0x17dc7764aefce4ca, 0x2055d7890,
+0xf9ca6358ffe8c5ae, 0xe0b79482d1de4adf, 0x516c24cc9bef9417, 0x52fbae4977c52a2b, 0x37d91b0ae9d19946, 0x582d86b1d14aedfe, 0x6a1aa3fc060c93b, 0x1958665f80bbe744, 0xdab39c86d3a5cdef, 0x11757f55c,
+0x8fcda26a8dd6c83, 0x76a90ade1a6f7ff1, 0xfa01fb3a011619ba, 0x264d19e873a373ca, 0x5f64008249c17dd0, 0x3f120f4caf76f5a8, 0x3bb3053ecf473e36, 0x124c0bd2c469e0e9, 0x91dffd6eabcd601e, 0x1de4c75bf,
+0xe8b4b9d8a6957aa2, 0x787ad31646f7e1e4, 0xb5b3d4743de0d399, 0xee21ea2088c344f3, 0x2e1392589fca057d, 0x367aa801f4f22b73, 0xd67c00025f4ac699, 0x448c87184a0e657f, 0x90713d068a6695e3, 0xfd1da46e,
+0x77335174ebabd8dd, 0x60357bf98d53139f, 0x9b4bd81085c50680, 0xbe258188af44e229, 0xecf15637a56916bc, 0x42ea40d0666a4c24, 0x48d07f65558cb458, 0x5c9304c19cb0b995, 0x41b1c5899b25ed96, 0x137a3de1,
+0xe21386d798555d69, 0x96fdbc40787dbdcc, 0xf47457005711b04b, 0xf556e88516522c9c, 0xb985ebba8023edc3, 0xd3a7b530dc08ae74, 0xdc20e25ac3bea02b, 0x28e9dba0f994e251, 0x3af4ba46d4e79308, 0x5d866a36,
+0x3029e46b693bce78, 0xe7f600f6b8ec3287, 0x7516955f3cedd79e, 0xe7b98d4abbd0f219, 0x89c13808e66dfc64, 0x24fe77cd73b17ad, 0x42ba5774669e7c00, 0x868f334dd9972433, 0x94fcfd65374f9c24, 0x14d56347f,
+0xac3daa6c2405f71e, 0x75ca801f2176a1f, 0x661792df5614100, 0xa6bc5fce0209efa5, 0xdfcb79aaf9b5f164, 0x35efceffffec3ce6, 0xaaa4900d7ad4b798, 0x62e6628c1b891eac, 0x33bb63ec2ea24073, 0x1e97f7ae8,
+0x71faf42a4e771d91, 0x91af18b8508c1eb, 0x87be9287447f4828, 0xabafcb9177f3da7b, 0x6783059ecb6bda7f, 0x523b150ab20519c0, 0x8c3770606d031469, 0x687133a84ad64cef, 0xf9595bac90bd6c50, 0x171dc1f30,
+0xcc3cfe4a90d9613b, 0xf057dd3835653bde, 0x8b0c3bc6a018d98, 0x341e90362e4775fe, 0x9b1d77936eb9e103, 0xec16fc40dcc17ef2, 0xa98127b31cee8663, 0xf4c76284d60281fb, 0x857bfafe94214ec0, 0x196eda82,
+0x24fcf0d551479c7, 0x507ed619f40463ff, 0x1b811bd949d06735, 0xffbb69a53a65e998, 0x42d6f49050f957ab, 0xb189a63ab25cabe0, 0xc85593b75e670e52, 0x3982acbc5b9af934, 0x32d076124f25eb24, 0x1f82cccaa,
+0xee979468a3b39970, 0x8b9e7e96286d7aa, 0x60440ff0a36c2534, 0xd712db2153f171f1, 0x15026ce2d4a4083f, 0xf952af611a56739, 0x95f452ef8b0429fb, 0x8222c0a73b34e89, 0x29902fcbcde29f02, 0x3eddea53,
+0x264d67fecc4e84cd, 0x723ac0b79574c7d2, 0xf12b69140ece9700, 0x65ed0403cb84144b, 0xcaab4a5b595129a3, 0xdefa306a844142e1, 0xa36ce85956bc8fab, 0x9597cac350b45492, 0x797696a292a85d78, 0xb1bc0584,
+0x2249f74281b7bfb0, 0xb26425e00d9834eb, 0x302b6c0599330d7d, 0x986ee4588ca84e7f, 0xa9651240768ce1d6, 0x65c55e465f38a04e, 0xa364cb2f0d1e7b2c, 0x281b931f0a9a5d27, 0x36bd5aa7f0045da0, 0x6955927c,
+0x2e457c6375842937, 0x3da321749449854f, 0x266d5de60d976fcf, 0xf342f2f83f2adc91, 0x99c0195b21e4b5d9, 0x89adc697955c57e2, 0xb9b348577fe647ca, 0xda9176f0510bc849, 0x7c3f8dfe4a994961, 0x14592033d,
+0x5d0bc715de151a11, 0x1f968a0e73b1b1b4, 0x41d0c4ec1b78ce9e, 0x820ff6b151e86a3a, 0x9e2c10442ef2d95d, 0x8c23f7ea39fc2e99, 0x197d55dcc5c514b5, 0xa690b8d3f89312e1, 0x97a97c4c97fe57c8, 0x59fdcf9,
+0x7fea0d3dd4ffed11, 0x67ecc4fea525ee5a, 0xb366316d1bad43a4, 0xcfb578067c9a2332, 0xd365ead315feacbb, 0x65e11d7427c80afa, 0x8012900dbf5564a6, 0x1648b2d640bc2a64, 0x9337564f27caf50f, 0x1394bf0bb,
+0xf3498ff3ec9c76b8, 0xb8c622b15698df9c, 0x746a1fa5c7a0ba6c, 0x2f39688115d2ad92, 0x669f4d3959d0e495, 0x3fb04556385af237, 0x831535b41175d059, 0xb54fae93f1ac75cb, 0x68f1bc1fb06dbcbc, 0x127d8ecd1,
+0x912162a20a7d1ec7, 0xac1edc287df451b7, 0xc01786bbdbf547bb, 0x110200e015642357, 0x517a0b7e4e3a4b28, 0x6c7c8dcd72540b9d, 0x7e215304c48fe920, 0x659ca3b0e25afebe, 0xb074cc6041c0e819, 0x12e704b70,
+0x90bfa3a07fef8a5d, 0xcd72c457948a7c7f, 0xb6b07788d038be03, 0x2412015ac861a19d, 0xe7407529338d18b8, 0xa9bf9911448107df, 0x5cc5de4bc874b76, 0xc7df10392e37b870, 0xf4f56f460eb97852, 0x189904017,
+0xa71869e06cd99872, 0x24f12c4b745cb66d, 0x7baf58ae8e88c883, 0x255424739e84e207, 0x2581098c124accb3, 0x7f4062373576559, 0x717ebc1f89d8ff50, 0x333e2f3ae22bf9d, 0x425f2dcf1735befb, 0x1bd3ede19,
+0x36573ba4f276226, 0x12b761f643beb764, 0x79dfd86cabec691a, 0xe1bb04af2cadab83, 0x182aa3c97127a728, 0x570161db4d591401, 0xc2a263b1d323d3f8, 0xb8836629ec1ab384, 0xfed4224be298a57d, 0x1fd7ba053,
+0xe9b2f0e50541c97d, 0x31abcc4e35df68f4, 0x3d66f54678450624, 0x9a5d112231bf129f, 0x431e176cd09c593f, 0xad68f467f278534c, 0xde550dc92d659e69, 0xd0dbc3881576a8d8, 0xa158b5283eb061d1, 0x5fdd973a,
+0xb74b2097ecdf5b06, 0x201f1e6d3fc74d82, 0xe6033cda3df8be9e, 0x5bef5e5354d99353, 0x85e2b807bb7bdd08, 0x158e60663f79583, 0xad22e646a2bfd043, 0x827d4d0ee1a75d4c, 0x47b1fab9991c1175, 0xe573137e,
+0x158bf91ecf4d5fea, 0x6c823cf5d1726d22, 0x4c38f78039213858, 0xf60f176e1aa54e4c, 0x15c7eed199daf40b, 0x17ed24637afdccc7, 0x65459eda6e8a75dd, 0x42bed1ddd4442ae0, 0xd60bca8bbac6c6c7, 0x15242bd0b,
+0x6f82faddc857dab4, 0xfb354248cd0be72, 0x7da4aeb75d4115a6, 0xfa55fc44ff431046, 0x5a994534e3a8406f, 0xcdb52ebee7c193c7, 0x26542dbca9af38e0, 0x34d5b1ed39f56e3b, 0x2c596dc27815080b, 0xb46311d,
+0x2b7535ebcf990bef, 0x163005751fc9f38b, 0x2bc92ac9e2edae7d, 0x85cc3779015b2a2e, 0x11b42498cfcb239f, 0xf4a94113a1d9b1f1, 0x62db1c040b17cc3b, 0x571af50c9d394945, 0x80034da1ae46ee17, 0xecedf13d,
+0xbf9d50d6cff7f4e8, 0x273414b89098f003, 0xcd73a280afe91b0a, 0xdf479ddb68e5f375, 0xca02ce420164f714, 0xcb5bd15df3e6192f, 0x93b479cc61492493, 0x8c584eed90ae6206, 0xaaae2aa8fba3f1a3, 0x16682943f,
+0x3bdbfa8897aae91c, 0xb840a95aa8b6e44f, 0x1f987f7af73dffb, 0x8c66ff4f772dc40, 0xc20d7a984c20cea8, 0xf4b584633bb8964d, 0xe3ae873b06a11a8f, 0xd0567754fbd4b212, 0x6f69559c8f79ea15, 0x24e8c3951,
+0x34df36dae3236198, 0x4c7b3a054c3b5995, 0xa7bd916144c6e7de, 0x9c3dc8b099c9376b, 0x3e87318013365bc2, 0xfb4332244783d154, 0x9f8a32d63c274d32, 0x95c9820ffc7b394f, 0x3d3222e33bb5e4f6, 0x24a23bbf6,
+0xaf66182d4a2a8fcf, 0xcca3e13b577ee9b9, 0xb8e4d73c74e2564a, 0x67e28912d4fabb, 0x19aa1b65cc79bcd7, 0x28d4ff2227e09e09, 0xb549d13a8c771f59, 0x52e975827e3503e5, 0x1807b9ad9a6fde68, 0x3be59641,
+0x93b4d04004a9e308, 0x4213f3ea2dead1f5, 0x8146ce717301ac8, 0x179eefe571adf8cd, 0x92394d8ee2dd61e2, 0x84be4f1d3d87e463, 0x285f0acd1b30cb54, 0xbab9dc0a0c45091f, 0xf5f19bb8fd6a1c6d, 0x1fc6616b7,
+0x9e2b4f97b728d53e, 0x96facafe5008d1c6, 0xbcddd2ffbdb0560a, 0xb98952535e0dae80, 0xbb5e5a3d5b00566f, 0xa63770d569098e3c, 0xdf66c20caca2d736, 0x9795414e0eb1d154, 0x2dbf536d98e5cd04, 0x20fec2bf1,
+0xb30c9932e6af9141, 0xf4e7560305304256, 0x1468b6ee61dc3f7b, 0x660bb85a031a96c8, 0xd6a01f7960bc1885, 0x5761598d67a1240, 0xef51fc7cc359456b, 0xf644f8944e99a8d4, 0xdc9bcf081dc887fb, 0x2020668ea,
+0x487523a88ea86a07, 0x6b2fc4462144660b, 0xc0ff88e73fdde399, 0xafccd0bd0d8ff9d, 0x15cd170ac7e9ca87, 0xa7da6114fc5fc97c, 0x4456ed6244614a2, 0x460ce63a01c56af4, 0x991d16c642b1485d, 0x22113c04a,
+0x85ff891926393968, 0x43e5264863103883, 0x44cc84ba1a118435, 0x97cd734b985afcb9, 0x29cb13d35fc5b1c, 0x7b87b38525a327b6, 0x4c45738b416f72e0, 0xfc339efbcd74a811, 0xaee244478cdeb065, 0x174d86d6d,
+0xee29e42849961594, 0x9fe96b534f108687, 0x4ce38f3b7a717eee, 0x965b3a424ab43353, 0xf076fcdb81363f46, 0x91f4c566c4894a21, 0x9668352f2ccf6134, 0x9dfda5fe0599d8d9, 0x9e8dc7c218b650af, 0x79415e50,
+0xa814e588f7a50db8, 0x2f701712e795f375, 0xec0d78c2e39e5451, 0x375e4aacc27479e5, 0xc1aa2aa0f8f784cf, 0x2bce4e51f60c6b7f, 0x6ca8375354b99afa, 0x927256b3bdea5b5c, 0x1ee05cdc307f8a9f, 0x1ebbfdbc8,
+0x77b7d12c7b2fdd95, 0x1a29605494cec3c, 0x2e1a9f8ad151f32, 0xc06c673bd349f03e, 0x748136c2f3545e7, 0xcb3caad60d0b75da, 0x75a7bb1d0c15f956, 0xbeb3a68626bf531a, 0x5c41b32c94d65278, 0x181e0610,
+0x683fd48e4106812f, 0x1db126c1b7318ce7, 0x63c4e468d628d301, 0xc8333fa823bf6e39, 0xa299b18503086dc7, 0xd78abf8834febfe3, 0xb6aafce681042fbf, 0x2cd4af1c9db0e30c, 0x8f547d4f5f47ba27, 0x4699ecbe,
+0x475b6f69365f9a59, 0x96e6f7f566aa0cff, 0x6cb6e8cfbf625a83, 0x318564f31ece98d7, 0xa7b2dba1b55168e6, 0xaf94a7aec6eb67fb, 0x5613e89a4d539c19, 0x758444f75ab69f5a, 0xb73e1e7e0146271f, 0x1713e9038,
+0xe5e66d14ce8cd701, 0x379f83873432163f, 0x3fe9050a0811714, 0x9de4a6307289e412, 0xe3c6a535cc8d17f0, 0x92eeb989a288cdba, 0x419e5712bdf37b16, 0xe9ccbe7a1b971d3a, 0x360eb7c2bf7809a4, 0x8e6c5486,
+0x8741b9307a5dde36, 0x25cb61864262d60f, 0xd038df70ff5f3149, 0x5e46bd8b50e748e7, 0xb463d5121e2486fe, 0x5255aea42ede925, 0x5f34b95bccbdb112, 0xc706bcdd1c08b06c, 0xf6a33273c002adf6, 0x164a01932,
+0x64c96b4df8a17a02, 0x75db66184bf8af2c, 0x50225458c85335e, 0x1bbac7278aa6551, 0xba60af3bd575744f, 0x6a4d26d795840294, 0x5df6c01e627e6d0e, 0xa7b845d8d215c493, 0x8e6914991d68ac3, 0x1c4ed830b,
+0xfc75aa881edcb95d, 0xd2e05ef253363551, 0x773bfda1d93c1566, 0x846e0148b630190b, 0x1152301b92f43427, 0xa0cec93c3618488b, 0x66e55c1f141b2bff, 0xb348220d61a3de83, 0xfac5b112a45d2ae9, 0x1f398ed65,
+0x1f008398e94cf1c9, 0xde9b9cc115bcc1ec, 0x870d3dfd59a5180, 0xd130b231c2e47710, 0xf961e7a7d36f0812, 0xef11fd9df0ce1542, 0x11827653ce4fa6e0, 0x39a7daf7e3ad6abe, 0x9af2aace0a8046ab, 0x25366b324,
+0xa4f75f47f003266b, 0x87590afd641563f2, 0x5c06b295450ffa1e, 0xd88bf542a71f57fd, 0x7fa5a0ec5c5126fd, 0xab5ba6a10cf9f2dc, 0x3c3e94dcbc274fa1, 0xb357069af4ef3f86, 0xd9c01ea2789937dd, 0x899fa7f9,
+0xb32ae1ccfb8218b8, 0xe0dc57906aa17cc2, 0xca66ff1d24e7cbd7, 0x390e68edf5793c9e, 0x4f3f2a9c451f092, 0x342f3409be6d21aa, 0x68bbae268a1ad9f, 0xe60c516cd625a12a, 0x2dd47892618676ca, 0x245d5af88,
+0xfbeb04256a520361, 0xb7038ec1fc16713f, 0x970bf39032c1e89f, 0x70fb9cbbfe747a4f, 0x2e03b6ff8fa15e05, 0x2de69f9137b0fb6, 0x55653edc11a13cfb, 0x91898c459885fb82, 0x778c42d9a50dc758, 0x14465793a,
+0xdb392705ee933376, 0x369ee5c2e5a81057, 0xd5e6acdca5e51429, 0xdf8114a5059ddad5, 0x2b0183cd5cd25fc3, 0xd93ea9cad65dd334, 0xc02729dac9da2448, 0xde6c642214933d57, 0xa543fa92c8c1ebf6, 0x2793764ca,
+0xd3e2cd65a9d8de35, 0x576a771f8c53d67a, 0x678fda7a863d538a, 0xc1d147efcc6b62d3, 0x5fa90e8b30d5e53, 0xda95aea26e0cbff, 0x9ee833a9f848e32a, 0x47aa0af2b0932592, 0x85022b568d994dff, 0x19fcff9c1,
+0x943b9882bf70a403, 0x187c78d6488c852e, 0xb5d7e433469f7665, 0xd457b1304b8c3b78, 0x16f353133f40494f, 0xfa6c33d0bff4d9d4, 0x32f98bc1e9001425, 0xaf434964f6f3bc3, 0x7ac1c8d052039884, 0x1fdb6b44e,
+0xadeea5b59bac96ba, 0x2756c856708c26f, 0x441cb32a67164e70, 0xacc15e2959e5a3c, 0x9696a854469c4c24, 0x1467feb2d0bd6e6b, 0x75c770cf8e067584, 0x1bf4fcd019ba9675, 0xd430c0d5f741893f, 0x20f62b825,
+0xce0eeeca99f6e3a0, 0x6ed0ace38b2316ed, 0xa9ab3529862885ed, 0x34c480105166bcb2, 0x104b35fb6705ea11, 0x1d83fd23a1637ce2, 0xefe00d397b6414b0, 0xe82b6156814d32aa, 0x193ebcfd2b45d41d, 0x62cf5309,
+0x874f4577699b868e, 0x612498df6d01d70d, 0x7b17e05a4816f486, 0xfc255ba8e7cbd095, 0xec66e964ecdfedc, 0xb2c7360aa4a3d24f, 0xfc08797b49031672, 0xf0008b1ef5f899a7, 0x8d57940391a3307d, 0x26b596eb2,
+0xb5a4916b646a87c6, 0x54b28058537cc38, 0x1f2d327caf072841, 0xda62c97218ac0c04, 0x9ee67cd511847902, 0x646962752bb80ed3, 0xf446c2006c8adda7, 0xfc4b842c459b6226, 0xdd5c1125b8c0c9ea, 0x1c1899158,
+0xd3384d4521d0b44e, 0x32dd8b50e3709146, 0x73fece5b8d82b93e, 0x977713ab41e444c, 0x416697ddc570e8bc, 0xaaba3c23a3e22cb9, 0x6e014b0ee0e81ceb, 0x30db4550b9cda47c, 0xa96d205ee5912fc6, 0x2254f6963,
+0x3a5ba20206e3a5bc, 0x48529f9ba6965d77, 0x1908ee33453030c0, 0x11726aaee1df4fa5, 0xa851feb9fecd4260, 0xf9832d48372e026a, 0xa741772024f8cc03, 0xdbd5aff28920980d, 0x7346936e508ffe91, 0x65b9f700,
+0xf639c1508646563, 0x229d0c16d0288ef6, 0x50066e13d97e79c6, 0x70a4f3f2df69cbcb, 0x39b975dd60ab27d8, 0x6ff8ae9f61880b5a, 0xd3807ea99211df3, 0x6b9d63a0ce2f3dae, 0xed8974a7d3d12264, 0x1d30d5b9,
+0xc04e588493d75538, 0x3e42abd65b9e1dc4, 0x852e6b911fe4d169, 0x5dd7e3835bf65e17, 0xaa4563c5a4c5b004, 0x3508c7aa7e60ab59, 0x34b046b835fc6330, 0xfe6fa3941e59126f, 0x2b69d46b3e893de, 0x14cb01f20,
+0xa9e146e61d980d8b, 0xc9fa3c75beb5309a, 0x82b536ddff624d2a, 0x39e682e1f01d1577, 0xffa9109b75bdb90e, 0xf346abbecccc718e, 0x8d4bd6b4ab77f131, 0x4822a391a9091de5, 0xe962828b570b85b7, 0x1453b41b,
+0xffcd8fffe5b567fc, 0x82126c567af5a25, 0x5a3a20cd0f7ba991, 0x603461de818d984c, 0x385d6c3ecaeb8ff5, 0xdf2c3faf5fa6640f, 0xacf80922d3dbe45c, 0x56369daec8eec590, 0x3065b6bdf0fddbd4, 0x1cb835123,
+0xb1f07c3e3a83ec1e, 0x26b5dcf42c96d188, 0x19b2e0b9ce190249, 0x9578e27aac44a3bf, 0xa4a0e21e9ab4fd32, 0x27e41ffc18e65979, 0x9366a9ecde92086d, 0x5591fbabbcda4334, 0xaaf0ba067626b584, 0x1a02512e2,
+0x15a34fcacf6438c4, 0x59895cb363778903, 0xff5c9bfd997e6972, 0x94181a0831e33d25, 0xa5ed6cae203a4a28, 0x5d6245b1bba4ed6c, 0x9432f5d1fc553d7d, 0xb92e944a1c684055, 0x553e7f61cb4bdc46, 0x288ee77a,
+0x50fabbd6cee97ecc, 0x7389beb39e5eadf0, 0xfc967f2436866aee, 0xc07697529089e60, 0x9b5a4ab524c84a99, 0xc9c666844866191f, 0x44b8939d65022c39, 0x219f2a1c4474589a, 0x6c97f6596ddeeeaa, 0xd99bb18,
+0xcfd31f34987c23d5, 0x103de446a9cce55, 0x58c3f7424a041ef1, 0x1255b1ca088182f3, 0x396dfac1b2703a0e, 0xb2af417223a05c26, 0xf7aeef6b53e2979, 0xe7050b5e123edd2a, 0x64249a61c95b686f, 0x2276df318,
+0x38a28447798019ab, 0xc63c7546e89c7c05, 0x9af6de1a366c5901, 0xb1211fb7cc168862, 0x6b304844c5b5cef8, 0xf2cebf52be463802, 0x708f6bced5fa7653, 0x324eb8a6d03df3e6, 0xdf9daab1fe6606b2, 0x191bece6a,
+0xb625190c8e381bd7, 0x72f39259f919befd, 0x400d309ebb7e41ed, 0x2f4819e3810cc9f6, 0x18ce0862aa22475d, 0x6f5cd2e7b4abc184, 0xaecadcff74b5f9a, 0xb69f69a9ef883cc9, 0xf1ef2f06f7eb078b, 0x1bd651728,
+0x78e1729a85b40516, 0xe48e9b9cbf614ac5, 0x8195980ab24f4ae6, 0xf329a0a96f7bc29b, 0x27dae98f95593e76, 0x6f1a5afaf54b7d9c, 0xdcb0def0ff3a863d, 0xde77dedbf21ee6c7, 0x5e26f6bec7e5ba68, 0xbb261ff0,
+0x504242393d81a9f2, 0x2b9932ea4bd22700, 0x8adcb904ef2e3b7a, 0x9b4a4644ae8028b6, 0x71a10a5bd78ffcf0, 0xf11c39818a74929a, 0x3f2225e53421725c, 0x19652e65793dc426, 0x19dade41ce1e7f65, 0x842b1266,
+0x513588e4a4effa36, 0xf3f30ddb1afee893, 0x9eda1f262c66c6d4, 0x15ff402feb37161b, 0x90bbaaa545d6866f, 0x77c3229c777093b0, 0xea223e7a0ae70546, 0xe497a32e0babe77a, 0xa6aaa951eb67dbeb, 0x25069bcb,
+0x5d71312c145240c1, 0x682f1be5f86c20f1, 0xeed64dd72f0980f9, 0x4436a1c7db13db5f, 0xc69c70041bc98e87, 0xef01dd954ac180c8, 0xa38f15e51a934da8, 0xb1de18f532a9b862, 0xaa3f846b072d1e3a, 0x181a73e33,
+0x2a6acdc4611e9ff7, 0x90b89754b834ab53, 0xda79e686468f4daa, 0xfda2806173cf8e73, 0xa3b39bd1b2de96d4, 0xa7e5946c4fc622da, 0x4d3235427ef331b5, 0x9a4325f903a8e0e6, 0x57c8ce30423fe4e, 0x226dff8b5,
+0xb9ed60e32749b0a5, 0xe783971452db849e, 0x1309328ec66d3b44, 0xce6b6e04dbaedae3, 0x82cc0e6119bd462c, 0x50b6081d42bef4a, 0x9510a6d51fbb801d, 0x750494a66bc5e296, 0xba00584552ab5cc1, 0x15fc07ec0,
+0x66536b2916649ce0, 0x94194bbb0cb58451, 0xa33b903cc55184c5, 0xa43f3da3e6b6403c, 0xe5aeec0887cdff5c, 0x4c825eb75ee56b0d, 0xcc6ab016c4540977, 0x3b47ae9b6bd8ac7b, 0x47a8c0504bcc98b2, 0xb4b97c46,
+0xf389cb114afc51b8, 0x13cc04048e68c3ae, 0x65fa09025ce8115e, 0xa931c68c69db70a0, 0xb6424fdcafce7a9, 0x64d7b05bf4867b1c, 0x6e5b304bd00ec996, 0xefb7a3e47e42386e, 0x89c7482f08414a72, 0x7abcd91a,
+0xccd9870eec3b8b3f, 0xbb0c1f779b5c0313, 0xd57bdb4ae9b1ecfd, 0x8c2d891a0cd277f, 0x8c9d1928e7d84f3a, 0xfe70876ac0082055, 0xbf30757063f9cb52, 0xd67fb02f7d94b0bb, 0xde822ac1da3d54f5, 0x258aebe21,
+0xf5204009f0527191, 0x3f674272e4079dd7, 0xb265d98e986c7b12, 0x81db322565f37e42, 0x47ce19fa32664057, 0xcb88ebb1c05fc2af, 0x604c025cd3a5a5be, 0x7d148ab5d8213829, 0x6e32f64ca8dbe33a, 0x22ec9bf4,
+0x842d6b735cc4724f, 0x805e237e5d87a737, 0x47cabb5f8deaa35f, 0x3db51be1fdb88779, 0x80f91eb534b9c2b8, 0xc698eb2b90c872f0, 0xf5934fca5e94bf8e, 0x5937c42db0756461, 0xdaaaa2e2028b1c65, 0x68da110d,
+0xbb31cf302b8c78b1, 0xaeaa1128814b85fc, 0xe87966d795e3db0, 0x24c61e9301bec979, 0xed9e9229303dea1, 0xe820c3ed81e3354f, 0x97089982a12deaae, 0xdf9cc62d120f7183, 0x37953bff8cba2975, 0xf8f65c0a,
+0xa8df8d29d18f5b95, 0x52f5797d2fb7691f, 0x11657616b4cd0169, 0x6ba118b2fa87f045, 0xd2984955f3a2d6e8, 0xda797093101c0009, 0xe0981255b5505e2d, 0x80907886007e1dba, 0xc531510addf60468, 0xac469989,
+0x4e4032daa7936a83, 0x28913f31fdb1d8df, 0xf75f1b1690e55a73, 0x36ef01d0822b3fb6, 0xa5177b35f2998d15, 0x9fc680c5ea009f16, 0xe598573a5b5d8e5d, 0xcdf45cefdccfc659, 0xc102bb4c3d9d8ddc, 0x1764a3d14,
+0xda443954d16adc9, 0x499d87a5efab789e, 0x5ed590be234e3351, 0x41479efc2020b2e7, 0xf057f04518677392, 0x6415b07ea7c3846e, 0x263e85ff83f1c497, 0x639e770438d3731f, 0xee20d2a8e77bcfb7, 0xe840cc07,
+0x9e6f376c143b9888, 0x7b848339afca5cff, 0xd361f90d9665ae73, 0x2e9d0de004effb3e, 0xd24a6a23915c4d36, 0x3cf73a3dc36bcec6, 0x1e9f618ed8c377ee, 0xd21c1b74dc045fe5, 0xe2ff05e389202929, 0x1783ea18c,
+0xeac8b5b1d67d1ea5, 0x592f413dffdaed8e, 0xd2beb0463123fa59, 0xfb8a10ade276d6f1, 0xbf758d575a74021e, 0xcd9bd4edd888fe81, 0xb56b3ea439d8ad1e, 0xa41e650bf2b8013c, 0xc52e7465e356dd9a, 0x13a21fbf3,
+0x446fb12233b06065, 0xf48313f0c4dcf4b6, 0x26a6e2ce4a4f81ce, 0xf47bf8f7c82563f5, 0x4fdec8693bdd9757, 0xb7efc827b85be7bf, 0x1093b2563fa006a, 0x21cd13ab2e49d51a, 0x91e5365ee97768ee, 0x1d91fd7d1,
+0xa14568bda6176e03, 0x3b28ae1d3f909c2b, 0xd84031eb8d655780, 0xf1a4ad371d6ac120, 0x19883e7bd0c76b95, 0x3c503ed7427de267, 0x980c11cc4daaf412, 0x7cac3289d97e9cbe, 0x3a4b6daa2167dc58, 0x16983e94b,
+0xf4af90a7f138aae1, 0xa24fd801cafd1971, 0xfa952e361db86907, 0x598af392e35f00e0, 0xbcf619f443be8bac, 0x861dab32cff58dfa, 0x12167ca3d3d29d6e, 0xa1b87c52d751cfb, 0x15e0842ca58ef9f, 0x1d447725e,
+0x3de0186ccf25c6f0, 0x8eaa15ea7f8da89b, 0x39872f8b08e390ae, 0x1298b3dbb72b0edc, 0xf5bf200921e53cb7, 0x9ae0fcdc0b209873, 0xea6e446ce1394f2e, 0x1c95744bcd617dc9, 0x288d00d5d4c72f03, 0x2140d5ef0,
+0x319f4a84a490b464, 0x32bad8a80ac35cd5, 0x48740354036f30c7, 0x92032edf4231fedb, 0xdf6fa11b1770370c, 0xe687ff1b585ca927, 0x3fb83e199d46e630, 0x49396d5ce8017d16, 0x7c49542e87bbc48b, 0x2c7c3827,
+0xd4f60a7e4a7e8bb0, 0x71b40be8d115e4ae, 0xfa593840269d38e5, 0x876d96ce7a6a3d8b, 0x233449e6d1120c86, 0x7d1c6bd51bb58aed, 0xbd82ac780748ddfe, 0x7f743b8fff4eee7a, 0x37f729f7c743880e, 0x20e210c19,
+0x966f9f42988dbc1c, 0xd0b1a9aeee7616e5, 0x9188d43a38db47e5, 0x1e5a240a41ae3fbd, 0x9fff8bc582b74c27, 0x52e75c601d8142e3, 0x2bb302b078c7adbb, 0x106f032e4712542a, 0xaea98aec97a48e1, 0x1700f0004,
+0xa351a144604cfb63, 0x78b646819743062d, 0xb031d06ab7485e2b, 0xb6551c9dc139efab, 0xd1a63ba26fcf6c62, 0xe2f279db838920b6, 0x9864ebd01e4aca97, 0x4e9449ca8d23dec5, 0x76348acef0058d1f, 0x8d1e36fb,
+0x9bba6049e929c7d5, 0x9107e0a40b2c9c4a, 0xdddbc6dea5f27caa, 0xcb772c9d604aa7d4, 0xc94e187fa7ab2249, 0x3fa6929780368ebb, 0x15b6d30fe71b910c, 0x58bb8dc0bfd6cbf0, 0xc7ceb4c28b12174, 0x66e7837d,
+0x3512fc6e4166bb66, 0x6fd09d236226d239, 0xd7afb18f9770d721, 0x59c41e59ee5b7c18, 0x7bcf60c3f2ba3fc8, 0x2fb76d92b674a7f4, 0xd6a107cb90aec938, 0x115c82b6a801e6f3, 0x892c3ef6620676b8, 0x1ff2f1928,
+0xc198529829b08660, 0x5150f51af113c4, 0xfab8e4ef6467f6aa, 0xc2395b83c33e3bd5, 0x1761fa7687d924df, 0xa7eef7e047e56d0a, 0x475dd5641846153f, 0xaf051f3654a5c814, 0x35221c7ac9039dc4, 0x19f87d8df,
+0xe142754eb65cd2ec, 0x3bfe4a3a8dea1973, 0x21c5414333145411, 0xb2d32e02fcb8f39c, 0x2979d0ed126ea457, 0x22b95c80dcc2084d, 0x6d06f8c77d9e23b9, 0xb27514309ea94ab8, 0xe41a8cf508d013c5, 0x8016b48c,
+0x721d8ea70dc3c6fc, 0x85b21168e582359f, 0x9696c537de013f6a, 0x3f3e3946c4867278, 0x3ee01c88fef407bf, 0x5b4f32b6cb847395, 0x32364f4800eb27f0, 0x663f3584f209dbe1, 0xc59c17592b9de596, 0x247ea7bba,
+0x7671012021d7db30, 0xaafead4f72a9e1ca, 0x702a10ea8b661e54, 0x360f18f20623adc7, 0x6850d85ebdcbc9d4, 0x885860d39b1b33ab, 0x9a4708274179d76b, 0x1949f233b9a6b361, 0x725d6db8ede76128, 0x1e807ce8,
+0x24e95f9a55497670, 0x20c89076e1d8d316, 0xe36bb7faf657bbda, 0xc3755c15afad6afb, 0x3e0d25ef66463291, 0x7beaf49cc5228c05, 0x8caa60ec2b0d10a7, 0x7398bd15d8f9696a, 0xc5f2d9df18dd7aaa, 0x1e34d5cd2,
+0x691fd37c4add992, 0xce547664967ec426, 0x3c4a715ca45f611f, 0xd3d8befa183b5a04, 0xd7680aff698d0133, 0x2b100d0a34dcc12b, 0xd264a7d89464d6ea, 0xf932a321659bb187, 0x3a2637562cf78278, 0x56910050,
+0x26c25ef95236ca4a, 0xc7a63a341afcd906, 0xe9ff2f2d8adc87c3, 0x6697c0498183f023, 0xea54b6ddc4eecf90, 0xe1225b3588a327d0, 0x1852c58d530b3797, 0x5735a041dbd6cc04, 0x873be3a8fadf4ea3, 0xb4cdf4c7,
+0xec923929bb32bde6, 0x18f4cab6ffde87df, 0x35e41ebe62ff53df, 0x34585245979e52cd, 0x67c70c11666541aa, 0xa85c895b8b8ca7fc, 0x88410bf2e01c4221, 0x36b9bbf51cb0c544, 0x1d5b2ee5dd919900, 0xdd6bd05,
+0xe980cdf24ac79ffb, 0x4d7422c0ac5fc555, 0x4a719fbbf8eb7892, 0x21dc1e2ce1d3996d, 0xccbdc3fa28d3f0a0, 0x23139b5213c8fce6, 0xc171fa69b7374d2b, 0x2086b98ffd3d13ac, 0xa75c04c47660b5a7, 0x2240466e7,
+0x81b7f3a1a3396b50, 0x984c0ab4b73ceb9a, 0x71aa819bd0999cbb, 0x4e2ea61c920b41c8, 0x31be62954a039143, 0xd895a28b83f6bfcb, 0xd20c7ea8ac1fa7f5, 0xbb39583bdbb2f9fe, 0x6318acfbfa2b9dec, 0x1ddbec2be,
+0x58bcd20fb51184c, 0xd33918d47c37b205, 0x48841c07c8dce7ed, 0x2c908ec3bd5b6295, 0x40c80412ad5b9f0d, 0x4dd088aa530ba545, 0xd7d587d317f7ab86, 0xd593ce837cb3ffe7, 0x889f0d3eeb36118, 0x15ba17d69,
+0x7fa0b5bf044bc65d, 0x7e9dd21f4fab2266, 0xbb58da4585419207, 0x2e07968eee7788b7, 0x33274607616ecf60, 0xf1aa1e6316b73c3b, 0xefc5162507be48f4, 0xe7c9b7526caf2da4, 0x95900c04ccecd928, 0x12fc4f524,
+0x1c0b9b9dd0b7c057, 0x584d0341799a18b3, 0xce81fd434f6ec42, 0x89f52291dbdb7450, 0x1ff66c8557d7c2bf, 0xc3ca2c1b4136fb74, 0xb8d126a64c63557b, 0x52b66fa7aeffb98a, 0x7645130e33e34585, 0x237400d4d,
+0x6986cc9afb12a107, 0xf0231fec4179484f, 0x55f1b31bbd689f2, 0x46c9403ea5d95124, 0x490a081079e36983, 0xef990feca6ddc7f6, 0x9329b0646e51f6ac, 0xe7878776f50b3705, 0xb8568516c8dbf11, 0x1cc89559c,
+0xadfff63493a7ff53, 0x7f388370150da9af, 0xfed4a0f7a4a8fa55, 0x4419d407ae7f14b3, 0x8eaddf84fe6ea7de, 0xdd3ed2970544b2e8, 0x3dc3c5fd1546a2a9, 0x10586f5525529d91, 0xaab3050ed6fabc81, 0x2190f0327,
+0x8937bf3356ac715d, 0x27c3c42cd71b353a, 0xd928c31cedfccca1, 0xcb2140c8df493647, 0xfc9f2767d8686b6d, 0x9e21089caf7ba131, 0xc541cbca06a4def5, 0x6de73e213502700d, 0xebe619c240c03b52, 0x188c08e5d,
+0xf6c54a0446007722, 0x88436eedafdb59e9, 0x54adaba684277cfb, 0x8edf0801c44307bb, 0x9564128d2a9ce2d9, 0xf9a51edad68140d6, 0x53dc9e79ae46b36a, 0x14173947668f9b3f, 0x3ddd22a432b433ea, 0x20054c5ea,
+0x69f25dfebe0ddcb2, 0xa63119f91f3ed7c7, 0x76b03c38dd7d569, 0x5ceb2d9d65895530, 0x902a14d651c3cf8f, 0x1e9b9059096ed0ab, 0xcb6a0a866b43a0d0, 0xe9708943e92e853b, 0xde9c38893f793078, 0x188946eef,
+0x53372941378a03a0, 0x4131bcfab5976d49, 0x433d70b30a112adf, 0xbf40383b2110d4cf, 0xcfa785bfa4a5798c, 0x888c7eef55fcb2a9, 0x9cc9c1c45bffa26e, 0x216a36bfd2e4e207, 0xa22922418d1d25ed, 0xce4cd552,
+0x186a889ed8f1c757, 0x35e054551b6278e1, 0x9f1a90054dc0b561, 0x35b908c9238c892d, 0xcd3119d10b9c2911, 0xf2b993266491156, 0x128fa0fab6701378, 0x2961f05eae0373cf, 0x49c5389f7a20006e, 0x2627c875,
+0xda22c496816ddf75, 0x4f5ae4b09b04fd07, 0xacc18a870c8f928, 0x30ef4dd863ef29db, 0x80e88b8a756e98c0, 0x28cedd9260995853, 0xfff5d41e6cbe407e, 0xe4b865fd16747732, 0xa10a26e6a8204c80, 0x252a8c1e7,
+0xf74c5eefdbf30566, 0x34b038fcd10c8692, 0x8fa750f741d15711, 0x227c7e2f8ea24348, 0x64578bee10ffa4c0, 0x3f6b595c087033c7, 0xd9f82a6b853f9d8a, 0xe56133200740ca5c, 0xed83c75a840f8a0a, 0x1139d8dc,
+0xd6b923a814be2724, 0x23c0f11049344266, 0x345d2665bb557bec, 0xc499a1fe398b6a71, 0x573246b104cd2495, 0x7322f0ee0d4a7c8e, 0x305e492ba8eb1aa, 0x8d6a312c0e31208d, 0xecf8da21ba8fd84c, 0xbc12d56f,
+0xb63b0e6e90034f71, 0xe730b8cc13055d54, 0xc0b8b51bb8fd2147, 0x729b7ff47de4adfc, 0x17bc861850ad303b, 0xcdc27f347301534c, 0x32cee63c4e64e0fa, 0x5bb8b02d281c9d60, 0x3ecaf9c5df882a77, 0x277ab228e,
+0x4426e11ab79b9de9, 0xca8ff507dafa218d, 0x4480a643f3ef4ac5, 0x43ec050380b4dfcb, 0x4b45758a68a1fb03, 0x374840779755e6a3, 0xc29c068f3e2f6dcc, 0x8865a3da8b3afc35, 0xac0e869e083a520a, 0x129418cd6,
+0x178b186fc7a89d5b, 0x58680954a4e21000, 0xdf16272ac15b29e4, 0xa95bfe5cbcc71990, 0x7190894adf3e9b5a, 0x47077d000f185632, 0xe735a3e71f3612c7, 0xf0d60633eb7d31df, 0xaa028b11efe5aaf3, 0x1a6582ea5,
+0xb538a64655d8df6a, 0x6f45818983e4014d, 0x25d200fc2c1e31e1, 0xf0b80b8d6047680e, 0xff85e7a1230675f6, 0x1d9849be50d1cb0c, 0x559bf35bf572925e, 0x5e29d0fc592e50e7, 0xe4294ff4d6964736, 0x261c76c69,
+0x8cb3153215561ba, 0xfe2df44f29d4b4c2, 0xb1e15b35cfe9e070, 0x4178d941e0593a10, 0xe631d5624b9ad540, 0xc877d4f7afb85660, 0xd2d476f6d288832a, 0xa141a682ddf49f4b, 0x485618da2d27ad8a, 0x272a2faed,
+0x9e23a8c21aa367b5, 0xe332417f7d5bfa54, 0x883c3a6d6be88bc9, 0x921fd0ffeea4fd42, 0xefc65ff81f8275d5, 0x304dae6bb5fc40da, 0xffc90a65d31eaa0c, 0xaacc9eb6acf146e5, 0x2f8717853580420c, 0xaefdc87e,
+0x82cd0369d18fe6cd, 0x96a6d61d58b18d34, 0xb179a75b61de24d5, 0xb4c5463aa466485f, 0x59b2726d4fdc9638, 0xd09c52ae05b0279f, 0x9b8cf7d5d064f3b5, 0xb8bc5a81cff1f2f4, 0xefc97ab2b9238c1f, 0x221d955c2,
+0x265a15d235f77a50, 0x3012a59355751fa1, 0x8ba797316d92fbf1, 0xe6643b7a29330cf, 0x608372eb5388fcd1, 0xf4632d58bbd6de79, 0x8f49a28d70de5b40, 0x938ac265ed955b06, 0x612fe7d74c6a5db9, 0xd726d5c,
+0x850b6ce3e6583fbb, 0x2e88d85a68ae3a95, 0x759a7811da6a8793, 0x9051031be2a5af7c, 0x14eef812125b4f3c, 0xbccef5d204ffd9a6, 0x7031c55228fff54d, 0x53318dc23850040d, 0xba882701191db794, 0x25c7f524c,
+0x73f0d26a26edcee7, 0x6cc84aa70fc4753c, 0xd5b80d00fa78282d, 0x5c281730d95e809d, 0x92db8a48329b4761, 0x83b2d1b55cc0c805, 0xf7d8af3452d3cc01, 0xeaf980dafb0043e4, 0x505f734486cefb50, 0xf7d1c3a5,
+0x11447c3e90cc041c, 0xbbe1bcabca55de81, 0x44b2b4d0bbf2b73d, 0x6c3c99e14afb1038, 0xc1d1721719291786, 0x42b87924b266d367, 0xa1fc332cf973f156, 0xc813835e662f5e79, 0xf3251cb439bff54e, 0x232a3681d,
+0x918a66c42486932b, 0x7f92328d993faaee, 0x44f6862af43f16ac, 0xf365086b10676f27, 0xf943411ae84baf1c, 0xb1400486eece3dc1, 0x8f709dce567a4c1d, 0xdd5105f00938d447, 0xb291c632489d4bf6, 0x54a49e15,
+0xad5ff0ed6cbcbf88, 0xd02676c5b8eaddba, 0x8fb80eae4d525c37, 0xd7ab1d3fa14e5a95, 0x2c21d45af621ec66, 0x21ecbbb40dbaf66d, 0x245fc45c0bebc0a9, 0xdd6d7fb1c72e7209, 0x808dbd6528a0eba3, 0xb032277a,
+0x350695d655f2d16a, 0xf12e7feb50f46ff3, 0xb737bcf20df99fa5, 0x34005e9ea481c3a9, 0x178f265ce388e87, 0x54f72279500c5d0d, 0xfcac4ea56e530db7, 0xb8891e10faa8765, 0x330103e91a5094ea, 0x1fd7625da,
+0x33976b6f3b24b738, 0x385e165671c442a1, 0xa2e5d495b6ec71c5, 0x11462afc5c0c6d21, 0xa268437ac1e2d8a8, 0xfd3dc02445882698, 0x5aa0c1a8d32964fc, 0xf7f46cd638b9524b, 0x5c512190fdf177a, 0x236571f69,
+0x4d38c07b8ab7bc3c, 0x1651130d0a63375b, 0xda6088c7392ba845, 0xe00fd10024199d0b, 0x5314f8fc233b3cbb, 0x8b42699f3ff11e40, 0x247aeeb7455e8231, 0x9799a5efa3b4d4e4, 0xbe1d47c6a620ae97, 0x3f7aa6c0,
+0x9df99b659c5b25ae, 0x18d35e709690a07, 0x8554162fb920b9ac, 0x4062d8905423aef3, 0xb511b04e84164ffc, 0x21006f164a243c90, 0x4d19aec7c1df3b67, 0xaefc104743cb3c54, 0x1ea580da0519bd97, 0x1f9b9d9f4,
+0xe3f0705db99915e3, 0x4d0e40ab449f2732, 0x4411adb29fcee049, 0x83f9219e05c79f74, 0x40e2dd852d2d10f3, 0x814716cefab024de, 0xee79d0f147cb3d67, 0xbe6e6880cadbc5f1, 0xf0269ec2f49e124d, 0x5fcd9d2b,
+0x8bea71a5c5f8e259, 0x73f1bf2ad8ada607, 0x71fbe10100e04217, 0x8b5146d84fdaf86f, 0x8b8c7452840d5135, 0xae12d2ddd9dfdbe0, 0x65dde203992a373, 0x10500b6ba68992d, 0x1ba13c4033ca6980, 0xd849da69,
+0x6a7987d49bdbbf46, 0xa333bf0d9cacf11e, 0xdae94f4749bf2ec1, 0x1c85d784b3110a72, 0xf351469c0fccec1b, 0xf3e0d0bf565b62c9, 0x9dd914fc824486b3, 0x37eb1c2d75b84352, 0xc17e6f30e8acfd4, 0x161783d7b,
+0x28dc22617265a59f, 0xb5f42f8b3b978e25, 0xf2d4b092c2397d24, 0xab25bf7ddd36ac1d, 0x6d23c0caae1d0089, 0xe0daeb883cc1f5ae, 0x13d707f282715f26, 0xf551888ca13fd847, 0x4373001a35b795c7, 0x245fd8008,
+0xd52b20fc231c67d3, 0x76759c26dcaa02e8, 0xef9fb550018f7d12, 0x8f6134640178d25, 0x5921b9e788b9b02, 0x57cd238cf64e0943, 0x687e22d9f628cc55, 0x859ba7a7664b2456, 0xc3ee8a590cb93dc2, 0x1c02ca618,
+0x25879a172d6b5b0c, 0xc8c2ae0631a5da52, 0x3990c8be3e222a29, 0xd0e154721fe36c36, 0x4892d6acb59e16b1, 0xbe796521a7c4f8e4, 0xa03b2c5f9f163d44, 0x10aa1c8af34b71fa, 0x77646e24df13bb88, 0x1b3120f91,
+0x915d45f1013865bd, 0x85fc84427f62778, 0xa7d01be2ed8b9f90, 0xc116edd3e4b2461d, 0xae6035df775b31f0, 0x88be67a92fbf293c, 0x92ed38db29ee99bb, 0x435ae871df4e15a, 0x9b92e4be890e594e, 0x40c333de,
+0x2e60d171c96bbfdc, 0x692b90c8194de95a, 0x3c9f46bcb6320481, 0x9e21c90cdff53ce6, 0x71acc7a417f55c6b, 0xf03a0ff48489cc18, 0x18ae3d9fadf8c319, 0x647115e362e7efb1, 0xfc182492a7d54741, 0x3cf5d761,
+0x4fe0e1330a8ec278, 0x547c6751b2c20f3a, 0x1223b67a9c8ff80, 0x4908d9e4faecd8f8, 0x1a20771fe8fdc62c, 0xdff462673e318a49, 0x198184f736856648, 0xd743196684011e1c, 0x3362d42ecb4b4768, 0x1da5073de,
+0xde65ed2bf81e33c1, 0xec1782e5dc37c97d, 0xb4b1749210762b4, 0xb89001e75e23c16d, 0x9c010d6bd5026d22, 0x56245e22bcde499a, 0x1def68bf4cef08b5, 0x492e1236835323d0, 0xf859a2b4da49d919, 0xa252921a,
+0x32baa75eaabdfa9e, 0x96d43252d7508523, 0xa7ec737eba89b90a, 0x25bbdec3ab61ec5e, 0x3414fa8a619195af, 0x64568a78fccc7a84, 0x4afa438ac7e4439a, 0xb5559df0efb8860e, 0x4279785b978ae708, 0xeca53b87,
+0x5943f693cc4cdb42, 0xa25e230481276258, 0x837b8afe54995220, 0x87aa21a8d610dc7d, 0x784284a0883f9c69, 0xa1d52004bee00681, 0x79637c845623af63, 0x6590e35a8cc133ca, 0xf2af444ef2bd81ad, 0x26bf7c2b1,
+0xbd0311781d41e47c, 0x68f6ad32abd2229c, 0x7804329ad7195f23, 0x1a1c8bc506d429d8, 0x89f0d2cf5998b0c6, 0xdbcb76bc2585e81d, 0x95d4c894a325dedc, 0xbc684d5d892049cc, 0x718e2fcfa3fa8b5e, 0x22adbc966,
+0x1a4c25148c3a5011, 0xbe45d18a278de48b, 0x80950db53667b7bf, 0xd62eeb52ca79ee13, 0x18a13235f608fe09, 0xeb7e5c52c29ceeac, 0xd7886e878ba68b17, 0xba586bc21f0e17f1, 0x3e075417dcaec0ad, 0x110b8c33f,
+0xcbe1217722cc9a6, 0xb5d73492910a5a6b, 0x299224afe128ba8b, 0x2d249d4538081646, 0xcd324017b459e9c3, 0xae58a04f14326e2a, 0x600664ec843a7f62, 0x75efbc8f534a87c0, 0xeb065bd61b7757b, 0xf14573af,
+0x185d10a8dfa7acef, 0x170e3ff63b861218, 0x841695368c546a0a, 0x4a76411e47d16a8, 0xd93fb11bfea66510, 0x7c5e7288ca77554d, 0xe2a07675d053fb5, 0x81b148fa7b758985, 0x6c90bff6e4c50f6b, 0x1b500af0b,
+0x77b19ce9f453f227, 0xc214465616ca3, 0xd5aba9b716581454, 0x3a132db45182505, 0xbf05c4c91fd6c871, 0x1e3ca17b3e502597, 0xc3f75545685bcd95, 0x3e79682b9c7fee55, 0x7aa91c9d6e928e38, 0x2492a922f,
+0xf52fbe7196af48d8, 0x2096b157b97179c1, 0x1d8c78b49750de0e, 0xf06d9d641218f104, 0xa8daa69beb650e88, 0x11e9e537d672e78c, 0xd38fa9c9698774c4, 0xba6899847999f1e5, 0x9bde854090619b08, 0x1b8176895,
+0x3c8d4f46bae3284f, 0x799fa978eb91238e, 0x992d4a834a590ad5, 0x9c58ce5f35d57164, 0xcb93b06bacc85df4, 0xebbf4a4a72c4a0d6, 0x72d2f37de6636b14, 0x38656b2f2862d0d0, 0x27c143b899ce4421, 0x147598b5c,
+0x127782a4fcfa0c69, 0x3ce452b31f97bdcb, 0xca49d23362158c95, 0x910627a78497ae22, 0xa0a7a1869471882d, 0xa3aa62e4c8e16302, 0x5fb707e96a298d77, 0x2220c9c298a7d083, 0x94bdbdd059b66ed1, 0x575be374,
+0xcb4663e4b0185953, 0x95997b90facbf411, 0x5ab60c356ae1a603, 0x78deae599356ec, 0x25d84757888a26e7, 0x8f804f2e4dafcfc6, 0xc3ba2d524f1ffed, 0x2c1ccf741b781bb8, 0xe100a9c194e0533c, 0x98cfa80f,
+0x56d8fc642bc17e71, 0xfa262c74a5ac9497, 0xcce8feba5c1d2ce5, 0xdb4562a18db0aaa8, 0xc90b01d04d0b415, 0x3a04dab9f15aed5e, 0x51d341314d67b173, 0x36a54f84c8506095, 0x8ce46e7ac042f11f, 0xbc55faa,
+0xc2085ecb91a80e94, 0x2b8801dcbd488cd8, 0x12727061aef4ce98, 0x95aa48595e5f7f9d, 0x1dbc4ac60e5bc904, 0xdb547593b4d79dd9, 0xc22f792108eaeaa0, 0xf838c47b972630a, 0x9a71818fbfe4e97a, 0xb9e746bc,
+0x271bda69df2fd695, 0x6abdd70303f08dfb, 0xbe84b7be55f35276, 0xb74c9dc44f14ac26, 0x2326201cc15e2ea5, 0x2ab92836f6be2d2, 0xab6b70fc8e733ece, 0x74dc3d3a4045f626, 0x84c012bd4a07f763, 0x7913a65a,
+0x5ff626274dc63a23, 0x20f5f4cb1579b023, 0x9d8890efc94b4888, 0x1511e48aaa1eb13b, 0x9453a4bbe849bcf7, 0x22f9774f06e42e69, 0xa30fcd9a3310df57, 0x605600e01cadb027, 0x717a88c1bb20d052, 0x1217fa0d9,
+0x6e605425d841e0f5, 0x25317031e8ddf1c8, 0xbac545b323bf62ac, 0xee979fac444d8149, 0xd93c897b8f2ce0f4, 0xca3e5031256f5899, 0xdf59e2db66601671, 0xe59b6cc3b5af41aa, 0xb68cf89927075b5, 0xb69a4573,
+0xa714c2761bd3890e, 0xdad87d25d5200d1e, 0xe720c0857c763a9b, 0x193b1bf53ca2a27f, 0xe82db96ec2794c36, 0xff406cf43b1a849f, 0xc2fd669f2c24c340, 0x51ea8312a6296442, 0x10b3909ee021c350, 0x1cf901757,
+0xf4ee2492a0f92087, 0xe04ace0437f7357a, 0xefcbe0b013a4cd81, 0x932cb6296be71f09, 0x7c6efe13ab0de5f5, 0x73ef1fc383fb50f4, 0x81b6a93c9702abcc, 0xd5677c9172c9f550, 0x387ac8033109c8ff, 0x2262d0ecd,
+0x485ce5458802d927, 0x106c1938a55dede5, 0xd08ee3941bf716e7, 0x86076760f3268cac, 0x7fb5ff07111e49cb, 0xc4a78104dfd83993, 0x5bc082e8d51f9a7b, 0xade32af3f5a95fb6, 0xbb6207052b2d530f, 0x1dd2cfd32,
+0x144df0d865c7b644, 0x5fef74bf2da363c8, 0xbf23d99302a65c0b, 0xa8f949d162b9f1a0, 0x97ee5b9ffbecd534, 0x9c09b1415ed1e4b1, 0x9235e2612d14d800, 0x55488beffe83f4fd, 0x606b4f04ba483db3, 0x263bed646,
+0x14676e6b02cb0860, 0x87781fccfd1dae88, 0xfdcaa3d95ba37396, 0x5f217398e11efdac, 0x782129a38c2094d6, 0x39c7b95d54411785, 0x7ec10d93eba7087f, 0x714f6ac206ea58c5, 0xd68182be9bc688fa, 0x10e4e8f56,
+0xcd017cf83b033bc, 0x1516720e4424fa4, 0x1fcd4a7f525c1d0f, 0x4a064132a8f1215, 0x6c5640ce895b7371, 0x546af73fae61b22f, 0xda91bfe5bb0694da, 0x3871467bfbac9350, 0x1230af1950d5996e, 0x1d775b96f,
+0x4c1b45f9c9ab4b79, 0x10d62a94a2ee1063, 0x40a0508275e3b440, 0x20e92331a5b6be9f, 0x139401a06e7ddb01, 0x9b5eb24a71850be7, 0x1ed42a1328310ac7, 0xaadbc16f4e1ea987, 0x443e09ab29a2705, 0x1d47068d2,
+0xfd9a4aed47946430, 0x5cb14faa405fb861, 0x1bc6ac56692a294c, 0x9b1644fbe3096810, 0x51625b20cb44fc1b, 0xa781671fc6d8969, 0xaaf4df0007fac7b9, 0xf8c79fe96a628908, 0x7aef40f4e4f4761, 0xaeeb6269,
+0x24756f4e4880fccc, 0x79e34a2fde38b85a, 0x6cb72a377dfd664d, 0x60a4af394993b07f, 0xcca2d35a9a959b00, 0x27bfdd941f89eafc, 0xfd8bb5811caa124d, 0xb18942316d2ad7b2, 0xf5433a05a4b43c04, 0x90152a64,
+0xf9b8464cf393b745, 0xe3ffb6ccfc1996d5, 0xbc90e2c13470f0d4, 0x9200b9e5eded2727, 0x2a8667392386c206, 0xf3dec035794ab79e, 0x83f7163fa041bae0, 0xeabede1f08782487, 0x6ba8966295bd8ced, 0x1ce82935f,
+0xfc450d9a3afc4e8, 0xf71606e1de1d2a50, 0x4ed8544d4f290e58, 0x1ec0d1011dfec27a, 0x36c6b37d753fc55f, 0x26b9770bc12f7d15, 0x20a6d6e701607023, 0x797bc51cc96e2a1d, 0x384666ec5d71a47e, 0x84d3a57d,
+0x58a5b99135a4f1c, 0x68b185fe820f484b, 0xd62d7f8c81d6c4a7, 0x29f95d0c37cf256e, 0xf0b1edc84c4e6903, 0xd488009e8f1a5c01, 0xb94acb74f87e5742, 0xc9d04dee9f3a6917, 0x67caabb0c4805ba6, 0x1f6baff24,
+0xd2faa300ec326ed6, 0x26dafb2797d0cc44, 0x4c348001dbab6619, 0x13db0c113e0467e1, 0xa640c221956695d5, 0x7737f35cce995388, 0x807bc88649a6530e, 0xe920bb755b037960, 0x256ebc4c380f7c4e, 0x9702951e,
+0x908a653f4a3847de, 0x42df247fa0b3bc34, 0x6295f2b83bd35d11, 0x8b77d3746c6768c, 0xa420c9de5e525ae, 0x26a39f7b30f38520, 0x80a233966272b213, 0xb295e71316beecfb, 0x3ee12631c44de657, 0x11b13212,
+0x4ddc47db55249bd9, 0x82e9d3c3b2373d9b, 0xaedd64c802aac1e2, 0x599f316bd6db8b82, 0xb7ca8e1be7b3437f, 0x90aad6b425e68ea1, 0xca666adffd3a001c, 0x4761aef40ddb3218, 0xbd6958fc8618f0f5, 0xd78585e4,
+0x997d5a925cd3bf40, 0xbc6e046a3f592248, 0xd44b4c052a5877a6, 0x62dc84f560cd069e, 0xab673c2baa012ea5, 0xc617c0d787bf73cd, 0x10fce97f8c5f93a2, 0xdbd44add5fa556a3, 0xd75d13a4d848e457, 0x1db7a9629,
+0x2af254900b89b2d8, 0x9671af16525b6e79, 0xaa3d90b6e7e8e401, 0x8b92cee4eac522cc, 0x62bd52edb95ca809, 0x199a2201e6b2625d, 0x6b3a680d2a66c83d, 0xca0b68a053c3c79a, 0xe77c8df1aa189ab3, 0x1eca22fcb,
+0xa15f348eb51faf21, 0xf8ca5d7e0a7546e7, 0x618deb01fcbe7657, 0xf5437dfc61280f5, 0xc082dd5997cfc05a, 0xb4e4fe982c27c796, 0x7f5567c246562028, 0x941fb7424b6bc414, 0xf4254ddde5d6b33e, 0x1b44c9a81,
+0xc5f49e5aa92ad47f, 0x7661e43f6b1e62bd, 0x60e7bf0a5469d80c, 0x3d176d232dce72db, 0xd18fa7952948be6, 0x2302917975678536, 0x116371aa61b95fea, 0x8522cdfc113214f8, 0xbab6193556fb954d, 0x1b06dc941,
+0xa89cef768148967d, 0x7d4edd6fb80b706c, 0xed8766ddec35c03f, 0x40b7100a3ca41ed0, 0x9584e0f3be86d0bd, 0x7059d6ecb649d397, 0xa8bbcec7eaa48a25, 0xf93eed2ae1c05295, 0x766bd428d76ab0f4, 0x26a949737,
+0xf09680914c83cd6b, 0x43db3014498102ca, 0xd719acf174ad4851, 0x32ce7090c21ceec0, 0xc4f7ffe3279642eb, 0x9327e91f93996643, 0xc64aa5f9620f451e, 0xb20f9b0891ca7dc8, 0x5824245b315304be, 0x14f8f241,
+0x158e0a1ca2b7900e, 0xea4482dacf9ff27c, 0x7f76342e6aeac5c6, 0x8eae2d30131f2607, 0x7d896809c5c68fe3, 0x77c275181201af5, 0x64f6977b7fe33314, 0x5ad9522abc59b768, 0x4e76f5e63fc522fd, 0x17b0d2cbc,
+0x97c1c871aad2fb12, 0xbe68058b821ca1f0, 0xfb8fe442ebbda50c, 0x2e3a3c99bf774554, 0x93d49ab2e2c9da12, 0x73e17c2278eab2ee, 0xdb05bf7ec8d62096, 0x9a5beab91479888d, 0xb989a2d1aec4b2c6, 0x18cd6129c,
+0x98efd23839aa4b5b, 0xde78bf721c98ef6a, 0x806da976a237dc3d, 0x1a32fb0d17fef5b2, 0x5d866b8eacd3d4f2, 0x3b5652461653f96b, 0xcad909ed41b5b005, 0xe869502c708ffe3d, 0x2173bbcf9bd6fe9e, 0x20c6a20d0,
+0x43f84451f555e335, 0x2114b49e525da811, 0x19b7655b0a83fa2a, 0x3e284f3906b87347, 0x87eb94caadb0d0a2, 0x439428ddc91e85d, 0x5fcb71c7b248cacd, 0xffa01f080f151f07, 0x1b08e2c0cd48d0a6, 0x13c223a64,
+0x5fa6f210d654146e, 0xf62bdd209a1f13f8, 0x5dcd84b2699f4129, 0x35919cf89079b79, 0x4b0df1d47d12b198, 0xc643c7f4eeea4a98, 0x6c40139aa81fda25, 0xa19c8dd0b5e99af8, 0x7c0ac0615c774239, 0x46576b3e,
+0xd76c7a9fa1b32741, 0xd67198cbe00b59bb, 0xfbe60898f4359f96, 0x9e48cad9b9d84d42, 0xb16c282ddaae436c, 0x4ebaaa32effe043e, 0x2d5b3eb6ab62a55b, 0x4b4445052edd2219, 0xaf3087e47a85d4e, 0x20518b926,
+0x52cf38c474386246, 0xd97fa33c54e32669, 0x2b4b1c9ca31cc1e, 0x72905c1037f347a4, 0x838184ff715abecb, 0xb1c5d35741a499f5, 0x5b22bd7adea6f835, 0xa2ab2861d26caa9c, 0x3f1223afc59f755e, 0x14377fe7,
+0x32b6be555ef3c191, 0x494abbe61794a7, 0x9eaf63a62beadfb8, 0x92ac7667a082a7b3, 0x7a44c95d3869b106, 0xeda7f67c5f3718e5, 0x61445f98d49a03de, 0xad09101994508b22, 0x8dae954a7df8299a, 0x22e168745,
+0x8de2ce0ae6969470, 0x83c9901bcc72a1c8, 0x89a90749078921, 0xa190399755536469, 0xd1d9266aaae940be, 0xc21245dea3c7ce04, 0x2e5528722fcfb3ad, 0x1d6886695339ad80, 0xb6a6084ed536c7f4, 0x116e0d4fc,
+0x889ad2df6542bfc8, 0x3c06c1be530e4d05, 0x6f6e7add326b0767, 0xb2eb1efd07efbdfd, 0x9b04bd33af454566, 0xb34724a4dfa8c7c8, 0x8343e8652d076366, 0xd7f9f7d2f97262e8, 0xf036088523316a31, 0x2fe7e068,
+0xc47147c48717a355, 0xf70209af03b1400c, 0xafe01097066ac96f, 0x37df0966d420a02, 0xc5115ca4a8cbbdca, 0xf357a61624ccb72c, 0xe6eaf7406982afba, 0xaf3ad142a2589515, 0x3e4d4e4898b9db8c, 0x158ddc8b9,
+0xcfcff5497d04df3a, 0x9f296d0c3953250, 0x7ce854a0ccf90aee, 0x4b0f585c5e34ab28, 0x5ad8259ad15fcd4a, 0x1dcea455668cc78c, 0x555d8a2bc17fac85, 0xbeab8ced99116a69, 0x5f086952ff464032, 0x222674372,
+0xa7bc2793acc645a6, 0x2b3a614457e6e447, 0x414b127b5fc6bed8, 0xee5a8fddc94959ff, 0xf05b5f12e7028f6f, 0xb58674fa4f79e6e3, 0x348576109324bc04, 0xa273eb2f1a66388c, 0x579eeb041f8c356d, 0x434264b4,
+0xbc04ec29553caadf, 0x560948f5bbeaa301, 0xf74d595e296bad26, 0xf4ad195287e675a4, 0x9cb952ff0642b89, 0xbb1b5aa190e47f58, 0x6534e117a90c0d9a, 0x72405728674690d3, 0x54aa6770e853c3fe, 0x276b539c8,
+0x8bfdceec76330e76, 0xbc485a23026b186d, 0xf3ad8fe01a4cf00c, 0xc1ab4a2837db7b35, 0x7633eae50134ee4, 0xcedd17ab4feae10b, 0x6b41264b58d844aa, 0x9f36fb19872d52bc, 0x3a7f3536ed8bd206, 0xbe199c40,
+0xa90a5e6a9b4cb21f, 0x48078b3ba02e0bb5, 0x277f835dd5a7020, 0x7704e2544ecb2491, 0x9e766c4fb33a4414, 0xc279b478c2e2b1df, 0x307d74247227028a, 0x984462e4b5019e3e, 0x30a144cb422cbbb3, 0x1f62f4c6a,
+0xfddc9051b5a2389f, 0x3fee84aeea89635c, 0xdb113a1544d25891, 0x7b56acfdb960ad3b, 0xed3dcc8bb7d82182, 0xda01b995680e6d8f, 0xdfce3f7d3706e051, 0x9f0f4de15dad837e, 0xc443130a1b5584e0, 0x1431cefe8,
+0x42c68b0a329ff687, 0xd6c0656e0a46a2a6, 0x5f4c54680f3f22ee, 0x2261db5f640227f5, 0x32711d1c25be150b, 0xdf99f9cb2ccb10f6, 0x28aaa0ac068d1129, 0x7b1ff3eb547a5a2c, 0x6ff81e526842178f, 0x13210d7b9,
+0x6597e587a79fbb21, 0xff8b5b1640caba62, 0x63a195ed8cbd7303, 0xcdb04706bed17395, 0x78d1bcc064d98e13, 0x1b63bd5d6080d181, 0x634bc23b58f20300, 0x6fd72b8bce8ba988, 0xf482ae786e556c7, 0xf8db0d05,
+0x525a7c8c91f48033, 0xc94acded2d2b3ab0, 0x4093d4f1136683c3, 0x70640d253b31fc26, 0xef0b1ef5f9232bd, 0x7264a1457ce80ad8, 0x5fc4b6b04a5f019b, 0x61fda4ff06023d2a, 0x442eac760d8231f2, 0x253da7b82,
+0x20d8bbed0249c073, 0x5ac72e3ed8e1eee0, 0x610a764cbbd7387c, 0x8d5f6562273ebf96, 0x4ab14772188ff167, 0x4e4608d2def3e9ce, 0x430bef4e355d551e, 0xf65d687203ecb477, 0xdbc291bbb2c04f5d, 0x33e66e16,
+0xff8a64abe35b36a, 0x382dd65e0f5675f8, 0x308850c8f6ea318d, 0x79e6b4e57b3c7b16, 0xb1450823164cb71d, 0x8d2eadcb36129d1, 0xa12b590887cd7748, 0x5241e8f4d6d54724, 0x2642e924cd6cb39f, 0x8c2c801b,
+0xfdbefe0a2e56eadc, 0xc1bebaffbf6bab4a, 0x872a4a6bb22fe811, 0xe2a45526bc876318, 0xe8ff8c7f9b9e636, 0xb4782b9cf1d97115, 0x4c309dc820f490c, 0x31bcea7b47d0401d, 0xff5a7d0bedbedcd3, 0x204c0f752,
+0xaa54c0384396c62f, 0x20f3fb81db4ccb57, 0xc7dca5f33b28c9a7, 0xf85fd4d6a9374dc1, 0x3e964ebc40c1da57, 0xbac0886a7d70ca80, 0xd1beb90d7b607326, 0xff48e7c881544ea7, 0xc792e42ece0c16fe, 0x23dac8821,
+0x53d9786b800cfbd2, 0x15db03c4878d0427, 0x40150ba779794fad, 0xa33da24dfef41f4a, 0x52b09b9d76dac37e, 0xef08ec2234b03089, 0x16b85b59c6d279d3, 0x6616379f93313e48, 0xc5d1ff90e9e90027, 0x8e668411,
+0xd059717bc968d18f, 0x933eca632fb9666d, 0xc650b719bf603955, 0x5b27cd7d3b935dcb, 0x545a05ebcccfdc86, 0x32ba177b58d23949, 0x5d102e69a8610462, 0x446386829e62aa7, 0x62df152e1b5410c6, 0x11c8ec0f2,
+0x4f6c723f248782c9, 0xeb0132c5b3f2591d, 0xc61805eed36971e5, 0x136b297676873e86, 0xd15faedd9b8f4e55, 0x2736e135b6656663, 0xd1199f48f10dbf6b, 0x9ed2a94c983de255, 0x723d55511e9ed6a7, 0x205f554b4,
+0x2f60b29df605dc95, 0x7d9af6aee7d3119f, 0x333d1b0d76f8062a, 0x5ea7628f283c3605, 0x76d2e8d4d69480fe, 0x9e83fa3a3f18db30, 0xe1b7d8781338780e, 0xf1cf1c0254884a07, 0xfd8f60462c2dc58c, 0x279fc1759,
+0x99fb6f30870ac29a, 0x69be69ed3c94bf2d, 0xdfa090e567b0f854, 0xeb2c3d7490759ba8, 0xa710636dc60d0e63, 0x457711c4eac1180c, 0x11289dac8e7d06e7, 0x7e4eabf514aa5fd8, 0x6a59d59b0dbb5854, 0x22c140e28,
+0x52367e7cbaca61bf, 0xade001297369fe46, 0xc09597c92aaa54cd, 0xa17e134695509cd6, 0x49243c10fd373f95, 0x42f44554660d4050, 0x1f7c6d66a1eb1a61, 0x25288d12080f3fe9, 0x2a2202e3f9d03759, 0xb6ebd26d,
+0xdec06816b3cd2b01, 0x92d9ce925e07026e, 0x824ca5ba7cb09db1, 0xf797a85a357446c0, 0x932c450397ac3f3e, 0x8d01a370b060db8b, 0xce652ff9da775760, 0xcec687ab1e8f7c19, 0x3242784163a2da3b, 0xf24821a1,
+0x83ed46427efc307f, 0xdbf822ee35658313, 0x95b6beaf5890af48, 0x3f45cfeec7337492, 0xe5c99e8a4aeeccc7, 0x3c956fd98bdb57ce, 0xde82f187864f053e, 0xc2b5f4adf928e27, 0xf6b290d1c6aec9b2, 0x1d2df9b67,
+0x7a07e1a932687ed, 0xce68018cd346e0b4, 0x4de7a53897e8a9aa, 0x26b21e02dafcebb1, 0xbf3812ff604ccc2c, 0xfeb05be99634896c, 0xba3e1d4f02238cbb, 0xd43f72f35ea75783, 0x7a6755a7e98f2191, 0xc218125,
+0x8b3718c336fb4d72, 0x62e0b2fd5770b94c, 0xc99cfc3833da3990, 0x517a032c3536781c, 0x8e4b0702f7b45751, 0xe0f7f16971ac35a3, 0x4089d40bc4d7385a, 0x18437b49bc469806, 0xf611bad8c53ef62, 0x17a7ded53,
+0x49a5203c446cb478, 0x7b4fe5bb74bfb46f, 0xd8d906dbed90fa6d, 0x4e526287fb1dcb17, 0xab80df41c8391b35, 0x6d3f0a77a61635b0, 0x679ae1eb12e6122b, 0xb575eb6b61bcd9b9, 0x5bf5d336b2384068, 0xa4042794,
+0xc7adad642ec4fc9b, 0x3d01f29e8b642a37, 0xe6e8ee8203d9fc17, 0xcc42c60a126b4bcb, 0xda90a53c76732027, 0x7ba992e18c3949b1, 0xcb2d89538377962c, 0xc1a52c84aed3bdcd, 0x9b541505c8b928e0, 0x19b60010f,
+0xc3270689faf13afa, 0xec8e5225c5247366, 0x7d8919871076d11f, 0xfa0360074684b5e5, 0xec22117eb92b2bf0, 0x20d46c8913d2476a, 0x49f4b5b9679eb2f5, 0x14888b741912732d, 0x1ada1430f5877b80, 0x12d1bf0be,
+0x5f23652d510f7e06, 0xe0f25edbbdb2729e, 0xc112013c8ecf4e67, 0xf2973411f6534728, 0x33fe7a2bcd8bfaad, 0x8c602accf0e6950d, 0xd05a8a894921c2c7, 0xf4797826efe9a8f, 0x2b44d63171b8aa64, 0x133801b88,
+0x26047db41bc558c8, 0x995cdea5a05b5b8a, 0x702dbc9e87c7b3c6, 0x16b0c2eb6bcb549a, 0x3c851d7347a35bf1, 0x73afd51e7c890f49, 0x47c7f8ccd4679bff, 0xdcb8a721d93f246a, 0xb49adc084824c864, 0x4342c246,
+0x6c78a0208490f504, 0x49b804797213f2c9, 0x72ef43701fdb2d50, 0xb0f215660f8a6a21, 0x4fddb9adda4d0238, 0x6df641d04df3cc87, 0xc5bc08fef4352e7b, 0xb4cd9a414331bbea, 0xf6625122fe55add7, 0x1213dd059,
+0xf5ca24346acc2694, 0x313e134c0b80ddc9, 0xf98b4034e06f3153, 0xd1c2aaf7530887ca, 0xc3dc3febd5e0433e, 0xa5dca13c1ab6197a, 0xe4f0b358a5e7404a, 0x7c356eba4ac806c5, 0xf9329701069273c4, 0x27705cf96,
+0xf5bcf45469a56c90, 0xd73594ba37f74c2c, 0x2311c1a8f1a2a47a, 0x727eabc71d33919f, 0x2c9d34b1e6c39db5, 0x8d1500375830b323, 0x880a430eb11c41aa, 0xa8fb55df1d8191c9, 0x7233fbb7d761e9bb, 0xf5dbc208,
+0x1bae8992fffae3d2, 0xcaedf5d578b08867, 0x2932c4176bbce19b, 0xe2cb2939dbbbfd0c, 0x6515e60785b4af6d, 0x68850e1d884223b5, 0x23f6e6ce3eb9a538, 0x2025507dc12d131, 0x4c51d84975cf20af, 0x986f2b5e,
+0x8f8df746e2875d23, 0x66d86e1f05ffd89, 0xe67ae5548f1af7e8, 0x913f3bf8f944f4c9, 0xc2befb738857ac9a, 0x580feaba0a6c33b, 0xf5fd581c295e7c83, 0xe7c0ce42d278714f, 0x460fb8f4255f3d07, 0x4c6808e6,
+0xc0071c4f8c7f9eef, 0x3aea2dbe5a4ae997, 0x6c0371888eebc296, 0xd6941b1ee60c393a, 0xbc9dddf7217307e0, 0x36cf6f553c537dbd, 0x3494b6a874bfca78, 0xf418a98010a068aa, 0xdfd59cdb0c9a54b5, 0x18bcef1b6,
+0xe0b808ca62726354, 0x210202ba667cfbe6, 0x62927c1226f469ea, 0xa8caf0a4ec8fffcb, 0x430634c25c79cb5c, 0xd5a4918845b71f63, 0x41bab8555aec62c9, 0x9545a735157abf03, 0xa829ef64aa339841, 0x2ea81c29,
+0x6e53fbca1ab568f2, 0x81d615d8d057b8e2, 0x9242131f6fd9a128, 0x7924516e27edfc2e, 0xcf9ef793807b0fae, 0x2b4841b0d4d67bcf, 0xbb0fb373b34021ef, 0x3beb8dca51aa735f, 0x85c0baf0a1f3ec7d, 0x1040c54b6,
+0x3349ed3e6cf03ce1, 0x6f52cf3dd10965c1, 0x68fe04081ac813bc, 0xce424cc875b83a4a, 0x3643c018b34a53dd, 0xabc331404287e578, 0x9155b550b91f2cd1, 0x947e1e9a8c9e3106, 0xb6089646df6231c4, 0x1fc8f6dff,
+0xdd17da17d1283300, 0xce10fd802315b64b, 0x8ff54ed7860e4723, 0xa9df4f23e625d2fb, 0xc4942e777d826fde, 0x67db9f4b566aaabb, 0x91147add2cdf21ac, 0x7e6e52a249d8229e, 0xda61e91f44294436, 0x24ef4ea6a,
+0x7e7112e0e271eb84, 0x655c8eec6e9ff7aa, 0xf6d24ae10f1d1de1, 0x58752bf70d2bfc68, 0x51755ec2f85a1e10, 0xe3d2d337a0dd85ee, 0xa9b2cbefbdb5c27f, 0xfed433f23e9d21e3, 0xa393577e68855f97, 0x1726c982c,
+0x151d9b16242e6ee2, 0x9f4b30f371abe2a8, 0x75cb2f7e8fcfd546, 0xa6538f4235ab21cb, 0xee5e71093ecde042, 0x28cabaa627df42b, 0x3bc4022beb050c57, 0x11218bcb99b1558, 0x40096ccf18ba5e21, 0x19102f2fc,
+0x3ed8bcd4c901ac16, 0x7696787f4658b877, 0x699887b966f5ee34, 0x9e5e1badb8c4348e, 0x43cebb80cf87b622, 0x1d2f279441504a4a, 0x3b0e3d25ebdd4fb6, 0x96c76a5cc4d17b62, 0x2db1f5095d5532d6, 0x11b4a04e8,
+0x922acf7d3ff57964, 0xeef6c9112b80b69, 0x8efc5c3eff0bc1d0, 0xa4b160e2eb2cc04, 0x86b5307fdeddc2fc, 0x794ea92353d7545, 0x422d5b3ce0a3fa17, 0x5b19c92fc7a0f320, 0x74879d43fff2ce1d, 0x167260931,
+0xa43919c03f99619, 0x996ee8bbf8644984, 0xf35918ad4b138498, 0x9e92fe5e236716e9, 0x4f71e64f88cdccaa, 0x3ae07439a2b67b4, 0x7c064a4590a91d84, 0xd150a4808692e433, 0x2eeea2687542db5a, 0x94506d18,
+0x3600bd4ac1c3f03d, 0x66d6b00ed6e2e64b, 0x693d6eb418b1ee3e, 0xd87d6df238d9a2be, 0x707bacb50eaf16a0, 0xce7ea4b19a66dd8c, 0x2685c27d867faefe, 0xe1d0321d9a580ea9, 0xd75023170a7754b3, 0x10df8bf88,
+0x72bbe9901872b616, 0xdb17a29955635422, 0xc872d837aa1f7af9, 0x85c9d16ec3ab0641, 0x14693deeb84536a8, 0x8ccd48238634a0c2, 0xb853fc23a12a277c, 0x625ec6ca80e2ceeb, 0x5e5a950870b3fb14, 0xe1c39b41,
+0xa8526b2a7e32c323, 0x34fdbe34dc32d73a, 0xba46aff77186fcd0, 0x292654083fd36bfd, 0x1f71719985b4bbca, 0x39e62436fed14d9, 0x79ade427d8cd8947, 0x42f283da380e8184, 0x9cc4c85f8d5f0a4a, 0x18ae9de0b,
+0xde2a8dca46e787c5, 0x25382ebcf50dca19, 0xfb3f28119ea57d4b, 0x699bf8af2704ade0, 0xb5162c8adff9f965, 0xc61a8e8c32fc6c4c, 0x861fc9109734f3e9, 0x6c7ea51163d5bc65, 0xa7a05885e1b32062, 0x283b0cf2,
+0x6f117e09d51064e6, 0x4e2498e636012241, 0x312a7693cd31f5d7, 0xe4f33dbe3254ab6d, 0xe4b1b9f7321dc397, 0xf62f4b5980f8c3d8, 0x512d4ea3dc363e01, 0x11882b0708c55f17, 0xc7119df5934f4b27, 0xaafb6302,
+0x848c4640e23b4138, 0x852e4f3cdfc85562, 0xd234843833e95ee1, 0x9f469cbd6c2f2965, 0xeaf42a97de62bf80, 0x3ea7e06f18de21ad, 0x4218f45209396aff, 0x495caeba3380cf0c, 0x2676b771c2f4f22b, 0x20b68330c,
+0x2e304c72cbf12f3a, 0xf0ae6ac8db4c7887, 0x2e03a50563f95de4, 0xbce81ead2cc3e1df, 0xc54f6efd3ce8d7fd, 0x521e7ae23f678e56, 0xfc30dfae334bd47b, 0xd82b1bc11ae6206f, 0x8e9f0272fc954ebb, 0x18f02a387,
+0x238e0685cfa53b, 0xe0205ac5fbe1dbd5, 0xe72eeb5a1ede0d59, 0xac0d08be775f14b6, 0x93779f39d1e12393, 0xda570fe7ee20a43f, 0x4c9a081c07375a2a, 0xd22728fe7935c706, 0x93c95462ca317ef6, 0x1900600c0,
+0x287a2f276c1fad1f, 0xe2adfcf93f911554, 0x4b951d1ab0a6d25b, 0x101f22c7829d82d5, 0x5b775d8afb0a455d, 0x65e772a2ee4c1736, 0x73f8716f58aff884, 0x68ee9aeb0d10d117, 0xafa4d6c1dd13119c, 0x1aa6e23a,
+0x5005cea42b4892e9, 0x4ab84320462074d7, 0x5c59303aeb89685, 0xb518a1b1a14a6ff0, 0x98a55fbefc0e28c, 0x9dcece7f43a431cf, 0x1e7839345a960848, 0x5ed4537a44671761, 0xc6547e9fa22a1428, 0x1164e01fa,
+0x4033f736e7122db3, 0x70b2f3ab77d39f96, 0xadf90fbbe0b1fed6, 0x50097219d96f45ba, 0x7de1ce4931f87cd, 0x11425bc8dc12cee8, 0x109a71eb1cde1eda, 0x86c06908ce881faf, 0x3527b10101de3826, 0x1e48425f3,
+0xb17a20f37f05cb8a, 0xe6caf9ed2619558a, 0xaeeabd9df0120c30, 0xed5efb673399d6a2, 0xc334df48283fb550, 0x90df6a0b550a1629, 0x21f77e11efe06a1b, 0xd9d449c133892a00, 0xaf6d89dc99e1945c, 0x205d3333e,
+0x56669ab8c67106e6, 0x431ada029bb84638, 0xb88a7cf9b2374225, 0xddfdd61fa8f0582d, 0x3291a7330a6c272b, 0x5a6d7747b9269693, 0x2af199acf2530db, 0x8450b7ebb03de85d, 0xfa0d3de7180de09c, 0x16a702644,
+0x9ebbfd8f955c5d3a, 0x951b95ff0e8c5605, 0x4245e238a2c33d6b, 0x3c41a80472680409, 0x98eba979a2ee3872, 0x13a515b323aa015e, 0x89b912c7c298ced9, 0x4b5eeb254ed2acf1, 0xbe02d670dc68843e, 0x20f35b8f3,
+0x123f2ecba102d857, 0xb14a2f84a7f17794, 0x7190991d1f5494b7, 0xef70878a6425c0dd, 0xf25a2b540926913f, 0x5c17b39a819e608d, 0x6dca938eb96e08af, 0xd71520e9de97efc5, 0x893cd3ed5d9223a7, 0x6c35fe91,
+0xbcfd9d4a46f8906d, 0xbbebc825f73e6dec, 0x4c7e83615e62392f, 0xc0a5326096d91d58, 0xc19ce70384a6aba0, 0xa4bc76bb4379e17a, 0xc5d079672b6ae719, 0xf2918c71c70afa00, 0xb90f4a46c7848c0e, 0x1d8da2180,
+0xb1119e2d80c48960, 0xcb0457f44f8e88ad, 0x9d375bafa79d8787, 0x9e3a9653931f7759, 0xf809cd55d0251e3c, 0x4c4148601507869d, 0x2c778bba1d304c15, 0x26ee91328b48ee4a, 0x37a15aef4b600109, 0x2029e4b07,
+0x5926bfb4e11feb7e, 0x816ab35a2d77fef, 0xece43004b7092d1b, 0xafae182757f9cb5a, 0xf566fc10af768669, 0xa162980ecdad9a0a, 0xdccc730341b256bd, 0xc54196bb0a555753, 0x55d9283817b12221, 0x20e04be9c,
+0xffaa8e11279b4fca, 0x64e2d5beb66c9192, 0x4ce136fdf23b1d50, 0xcdf9c7ccf6f7c5bf, 0xe7543d35ba1bc037, 0xd0d507438eb476a1, 0xafa9e8c7beb31134, 0xbb8ce0fd17562456, 0x78e18b77e709d956, 0x174586978,
+0x1679b30492edcd6c, 0xa45fdcf67a9af7fc, 0x73395d0934dd2dbe, 0xe97726ddc11cd542, 0xde6ebf124a391e61, 0x26911714bd9c27dc, 0xf7db24cb5ff96995, 0x2ac2efa93d003888, 0x2d4f4c62af0a5f38, 0x2229d3d90,
+0x45985298021ca52, 0x52f2e818f5f609eb, 0x35a7fe9eec19c7bb, 0x3f6261cca64ddee6, 0x7ba13dac1875d5d4, 0x4199dfa4c88da6ee, 0x8273ad91c4bbcfd2, 0x8c26d791c5a2881e, 0x2dd0582c67d6fdea, 0x22b2508ba,
+0xf114c81fd937f3a, 0x8773a603c961cd31, 0x26c81c351659594c, 0xf26a12691be88d37, 0x700280c10755c506, 0x21fc9abe2601fcd1, 0x6fe4b905b038d2c8, 0xa5c0f580de1cd4dc, 0xa24f04b3f7f0ee22, 0xbbaad07b,
+0x41f4ec85ede1b40a, 0x784712bbef6ca1ec, 0xdef0bd37be0033dc, 0x734617fe766020db, 0x537d0cc46e9835e3, 0x59e0fc81a5cf7915, 0xf39aea4ae326bbc2, 0x6f19345ab0801703, 0x519a444823090b61, 0x20329b0bf,
+0x68c7153dc8aa7e67, 0xe079b7df5e96b20, 0x7c76b44516757d9c, 0xfe663aa2bc325e39, 0xe34654473d363f4e, 0x83f2e2e213c8a2c8, 0x5338b1a4d4496229, 0x3fe91e6b4c89f216, 0x5364ada266169a1e, 0x1e167ef92,
+0x8c5259cce97a335e, 0xdd314e831f0d49d3, 0x71803c3a0c3e901f, 0xa90d22079587d025, 0xa0d96a3aa0df007c, 0x1f6edc23bdc9e36c, 0x5d9060651cc8f939, 0x886fb9f156e6c17b, 0xacd18f9143435385, 0x1db239fb0,
+0xc3f5e0d3013a9879, 0x2c30029ec005cd3b, 0xa4d1fbbce7156c0, 0x4ec634fd73089c08, 0x386cceca5e6517f, 0xe3f8c5a6b69d682b, 0xfde768574dd4768c, 0xb5093795297e5d3d, 0xc726bb55ea9c72ab, 0x6e766253,
+0x3046ec1252523359, 0x1d97d83e77559499, 0x39ab986d1ffb0f2d, 0x124c9548b61c04a0, 0x97dfd5c54edb9de0, 0x4b78e936f5949713, 0x4c1613bd3910065b, 0x360abd37d0e47ee5, 0xee1715ddf053d2d5, 0x1600de186,
+0x2371ebebc9f8e55, 0x55b4014281ab78a9, 0xf442fdb9f1b6eba2, 0xd77741a431013aaf, 0xf8f2be4e385eaa3, 0xd3b0213b77c67268, 0x646b4c1480256f22, 0xaa0473d00e43eaa2, 0x108743f8d3e31950, 0x190471206,
+0x335346acc1dbc304, 0xaf8ce6cb45fdf12e, 0x15b285e058a14bcf, 0xe6558fc2dcc7f393, 0x3fda0d84763b31cb, 0xb667291cc0f107e, 0x593c01d674600dbb, 0xd1d0be614f83fc3e, 0x8f5c283157f248f7, 0x2205c9bbc,
+0xe019a8fa4a13706a, 0xf2879ca8fbb83bc0, 0x62d3226547785a1, 0x1310df8f431d75, 0x3a43262185b54f87, 0x938e03acf37c6c1e, 0xc63d26be3dc57204, 0xa186327a2361fad0, 0x3fd91a8a80a39290, 0xd8689f89,
+0x43d6afcea64868a6, 0xdda65e6d23b0339, 0x72ebf1cdbc181bd0, 0x9072b40c00525eba, 0xe9c423434002325c, 0x25ad3d46c1e0cdec, 0x4757ccd2b149366c, 0x15cf5d2e215fa353, 0x9a73349a662d059a, 0x12e67de58,
+0x9f1a0f1bd9542da1, 0x8ad4b7bd015f9438, 0x51c1cac27d542c3, 0x38c04c063a8fe97d, 0xee9ca94532bc538a, 0xa1543b490c4c9a4f, 0xfeddf679ebc96292, 0x830cf3d8aed06721, 0xeda04171dc313979, 0x20bd05d21,
+0x83f70dae53e6ef58, 0xf26a8152cefbe802, 0xa7bab7c6aa813e5d, 0x64ebaf09cd7df1f6, 0xa18759664cabc9b2, 0xfd881d8e076120ce, 0x26be1c99a184561b, 0x4b0ae7be6b3c14ae, 0xa05a88c6a4e44ea, 0x205c110af,
+0x8b9e7197ad165050, 0x814b2eab02989d4e, 0xf8324dd7348271cf, 0x710e884bd9838fa5, 0xc95f3db3b9969a7, 0x33472a6341da9f43, 0x9f4c55d10b917b46, 0x5aa874d43fa74f1f, 0xa9d7297c313e6501, 0x1dcc2a1f7,
+0x2d188c2b1d197170, 0xb4d8fefe16f59fe1, 0x6777644d40073b51, 0xb9325b2f6f954bb7, 0x8e6fc4d1dde345b7, 0x11ebaeb7cc3588d7, 0x8faea8a077135a2e, 0x4ee1ba77134356f6, 0x2f46e7a3b5b63ed9, 0x625f403,
+0x2878b43a114a134a, 0xc703063b2c45f59f, 0x7d270e82ec0f0f94, 0xab254c23112f56c6, 0x5025c0b25f858c0a, 0xd91bb46bcd22383b, 0x42b984e929e4bc5e, 0x3758664e2f3efdbf, 0xda1a4d6a4f3c8993, 0x12b3e8edb,
+0x3c82d2533f2e55a9, 0x29a6b44a74ca7f42, 0x47ab5e1f7afd525b, 0xd79fba5e3f8e4b20, 0xc632f6881f9fa271, 0xde24a30b49d1845d, 0x275a8e5420592f6e, 0xf3f19a59a12e2db, 0xb9d068994e1f9d17, 0xfa2cc2ed,
+0xa9068d39125b7a37, 0xf11d9e1e4dce7f54, 0x629bc4651efec9fb, 0x23948e2133cd9ffc, 0x4a2a9dfd5a164bca, 0xa1807603da2c8fa, 0x6caa07ef7ecf3fe, 0xcf3c09a074b58482, 0x4336606be56afd48, 0x123346adf,
+0x1182a02328c06bf9, 0x4327f88bacd9e3f7, 0xa5fa975670a83c8f, 0x402b61a8eb3edf5d, 0xfb370a3316eb10, 0x424c8706c2ec23f, 0xc82f950c05a5a125, 0xe4efb5346ecbaa04, 0xdb583474ca497a44, 0x26cddfd22,
+0x9c08c142b372af3f, 0xe7b82386efd09492, 0x576070591e95ac2e, 0x443b4fc4572836ca, 0x142d802e41de2681, 0x2baa362f072441ac, 0x754eb6ff6cb81340, 0xdf39c71e6266a2f8, 0xc271b46348b2f688, 0x279eacb41,
+0x295bd17080340cfd, 0x744e76eed32717fb, 0xeccaacb60a4de665, 0xc5120de719819b8b, 0xd402db76176cb769, 0x5f6953a5240881f2, 0x3d6eb2ede0f83480, 0xe07ef8c5709333f0, 0xf55b3deadf6cc305, 0x32ad30e7,
+0x1bac20e2f0acc8a2, 0xb872da6b0b57d1f6, 0xc7d0ce6b9c14e45f, 0xe39c362c311721b3, 0xde48abaa8a49faef, 0x8d9e3bb0a94c5e0f, 0xd0afccb9fd72cac3, 0xdc10869f835467f6, 0x376fce11b93987e7, 0x1fd72ed26,
+0x63b7bd60a0d734a9, 0x35b38f9317b9e183, 0xbb2844e68834bf8, 0x6b4733dcb11e4416, 0x68af6f97435c6bf1, 0xa7b0a373f196cc99, 0xd641ae57f15b10c3, 0x75c5f4ec9c066988, 0x3dbb267fb0b17033, 0x4b7017a9,
+0xd39b4b662d1cf813, 0xba64dca5b6daa90d, 0x1256284c0982de70, 0x5a7f7a4adef1b1b0, 0x6e6e6084d42834c6, 0x68914711f92aced9, 0x675709dfea920f8, 0x5ed27dfc55b66f1b, 0xc6635c6a08eddd37, 0xc8e7862,
+0x5a8a77cbce3b8f6c, 0x246767662c863e80, 0xa152530e19a3796b, 0xab6e272615990ed7, 0xa395dafebeffa5d4, 0x9e2fb6c200ad068a, 0x2b94a846ab3e26c2, 0xe2d231a09157d9cc, 0x170b2b04d70eaa5d, 0x134d62abd,
+0xe9b0ed5f554103ad, 0xc0f1c84a299cb235, 0x6856b38ae2cd9a5f, 0x5f12c108afc719bc, 0xec8c7c0a9551d657, 0x21ff3ba049ac14b1, 0x14065130d722fb8d, 0xb193d82aff377e60, 0x47c0b21cd0c0b65, 0x15fd212be,
+0x91dbfdddf2ad022d, 0x701eb51f0060ee31, 0xdbec4f40e20a4a1a, 0x1ef7c4486063de62, 0x20d0bb657f375c04, 0xd0a3f837cfae85ba, 0xbc34dda3f81c3349, 0xd3ab2fe064f4e6c, 0x6263fa80e24db7c1, 0x2407f2c6b,
+0x71d9072ebaa898ee, 0x2f78a3cc7cb96222, 0x614f785f27f7dd09, 0x48b24ea03bbf4983, 0xa5925c2dd5c14b24, 0xb9f7ba2494446889, 0xc35ea0aeda75ab9b, 0xf8f01c0ee9dc1001, 0xa4280d05f4e14da6, 0x208e1f01f,
+0xf3bb7a968a9a7b3c, 0x605ca29247ade337, 0x7c301e691b28389a, 0x36792498f8546684, 0xc5de1f280c099704, 0x8372ddaca1ef95ab, 0xf2f3b5c6a873198e, 0xbdb6765c95955d1e, 0x9812d93dc95f7437, 0x154828303,
+0x3c1ba4a450355788, 0xf4fbc8d6363a657c, 0x76cb07da5a5fedc3, 0xd6d6ad03ab73f559, 0x8a4ac480a72793d3, 0xfb884e973ad59d1e, 0x5592c126fa623bab, 0xfb303b2938f7f5c, 0xd5c589ee21ae2e95, 0x1297ea887,
+0x78b8b9ccbea70fc8, 0x4c4dd4747335474e, 0x63fad811d4f425a0, 0x6e7eaacb9e1fd680, 0x1ec9e4b69bcc2ecd, 0x9c1a684adaa93aee, 0xe798f4470c1ccb05, 0x641e2a97eb7d85da, 0xc25b6be8f69115a3, 0x9d5dac6f,
+0x17d0888e6fe2de78, 0xed92ba79809d790b, 0x603a064401533615, 0x24626014ffebaedc, 0xb081d11ff727315e, 0x70777c645456c286, 0x64b07d91be5afc6b, 0x12e6572de71557ea, 0x15f700f90b06e295, 0x121d98fd3,
+0x7a375205e8497027, 0xe413da2509f8aca4, 0x20d38fab5bff89c4, 0x1c2b20d1908573aa, 0x7704c5f46c586494, 0x814734d509fac247, 0x7f1ceb2a7a5951b5, 0xc663f2eb5ac2a04f, 0x95a49e58583496ac, 0xed32e73e,
+0x75391c026c309c3b, 0xe29fe4ae7db0b14f, 0xac633971062d57b4, 0xff4c34560f926ee4, 0xed92c2c8c5a150d2, 0x4cb6c4e7af77d8d9, 0xb6ae52932a8b4c62, 0xa9856249ff6d5f06, 0xa85ff97d7b7605cd, 0x98dd2316,
+0xb5eee34437a7ad1d, 0xcd37087edb773907, 0x9e2922c9f6a0326c, 0x551ef9271c541f9b, 0xcd1f997bc70a9fd, 0xfe201a391c787520, 0x60205dff7e10437, 0x64cc457703d54315, 0xeb5e92bcaa2d79e1, 0x7b3e39c3,
+0x812ecd47ef9b38a3, 0xb2bccf8f80d31bb5, 0x4ca326751cfabb5b, 0x28b9b7e8abbcb41e, 0x5b009262fc6eb4b5, 0xa20815a7a34d91b6, 0xc57a205d710c4528, 0x6b4c3b36a513a2a0, 0x5ea944ee5a35cb5, 0x79a2f432,
+0xde9a58827c4547db, 0x7840bb25084e1a11, 0x76e8b4982fc13eb1, 0x16b1b065b032fdf5, 0x2c26a73c626f2e3, 0x77e1606b0763a927, 0x2b9bce3f0ef8bca8, 0xc84441d5f4b748b6, 0x6439c3ca6826834c, 0xfd453f9b,
+0x66bc1d1f745de6b1, 0x5bf430230c967336, 0xf38db78af21d9206, 0xadafea05d332159, 0x58f3949ecacfa675, 0x31f24d312fc46c03, 0xe9bc3546c0eebe4f, 0x8cb7bc5f5fed6940, 0x304651c9300f2a8b, 0x1fbb0ac1d,
+0x5e7f7fa630dd64d0, 0xcaebb8e201376e3d, 0x73a5f82e1424f82a, 0x2910a01b8d23b8e5, 0x39be59a01bbe0eb, 0x9d70dbdc7323e543, 0x80624fb1e8daca21, 0x86c99dd79841417a, 0x361ecd4030423eb, 0x13e9c8564,
+0x7bde3cac576c16d6, 0xa51ce8c7f494ab78, 0x5fc45a67d92ffeed, 0x631375c8c9a9f3f0, 0xe075a2a9a6c731c1, 0x987bf491bfc7518a, 0x389a9486594463d3, 0xcf0fc559cc481ae1, 0xf522e18884d8726f, 0xc5a8e959,
+0x3fb10d08d81e38f0, 0x8acfac427c3618e7, 0x44613e9d29e5c08d, 0x630a5fe4ff00425f, 0x949b23257d05c9b3, 0xece7bbf305372521, 0xd063cbb12d045b73, 0xc15217d013c34e33, 0x286720023ba0dfc4, 0x240933040,
+0xce36305dc52f0e8b, 0xd32770effda8e593, 0x12d6330c57c08bb6, 0xcbbf0b6545de3d8a, 0x8ed3b018d8e70948, 0x1b79cbb350917697, 0xb1c568bdf67b97db, 0xecbc770c3deacf5b, 0x7961903ea8ff525f, 0x198419b5d,
+0x4d97da41fdabc0ea, 0x19e74ae2bfa78f95, 0x434504520fdafe70, 0x2577f318ada66477, 0xb84a4b6115d7a924, 0x92f93b79f70e44c0, 0x850163a9ab39d67, 0x56ec91174591b4e4, 0x29fe25df4b97f852, 0x1f6e69b4e,
+0x7da536248e0e8274, 0x60df5aaa493f3ba4, 0x110b4977e493bbb7, 0x9f12b94e61ee901b, 0x242e45facb78744c, 0x70e5a507a28a8d98, 0xb3e453e09744713, 0x31c3c6a03c61a346, 0xca1089b3ae304133, 0x56584e27,
+0x197a1eeb824a358e, 0x2c6bbb5c4abef822, 0x73136dc583b0d235, 0x2f256b60f736de64, 0xb8a141469df8dbe1, 0x8f8e800cf9ed2a59, 0xa3fcf9e393e420e7, 0xde68ec75f8822b02, 0x611107921d88fcfe, 0xb6993ffe,
+0x3fe10c38cbc077c3, 0x280a61e45c38dcf3, 0x4ad68125a4d6ae4f, 0x37f424f8eb3ba98, 0xb3d31fdee7edc709, 0xad9b6ce0104055a3, 0xce19852bff8a65cf, 0x16d99b234cccb26a, 0x7be27e25dd863435, 0x1701a8f2d,
+0x736faab3de4ce75f, 0x36eaee81050f6923, 0x50fbed38176156df, 0x1c0abab9b38851d0, 0x6bbd50dd18f323cb, 0xc4fd23f78008d994, 0xc6ff948343d5f27c, 0xc2700305db98aee, 0x8f8fec31a1ea157, 0x23a03fbfc,
+0xd640ee1b0730f24d, 0x8575efa253b4d8ba, 0x58cb80bb9ccd4cff, 0x7c4af2e4a28bae41, 0xab348dcb82f4be1b, 0x524e666d57b9b605, 0x349e4f5f690d9ac3, 0x193bf1598746a1a8, 0x1a2e4cd41e21fa76, 0x2a8aea48,
+0xed6bd5a94a9e1e38, 0x325e598bac3c5c6a, 0xefda0666b10bf8cf, 0x74abc833c413655, 0xfdad409909455374, 0x3e180e8f61b57dda, 0x90200723e828095f, 0x381eddd1ee25e3e5, 0x15da9577ef7fb2b5, 0x243e89375,
+0xf4a9ff1c981d1bdb, 0x5471fb738a5b096e, 0x147beb6a208e6e08, 0xeab269a06f0ad7d, 0xd3539a499e50e858, 0x660af0f5e34b62f8, 0x291c2ddcc1dd1ef9, 0xa28243dd3b22dcee, 0x5b746f7fc061afbb, 0x15ffa8c21,
+0xcf5f91ff3ac56204, 0x2ecf895fb558515a, 0x6c6a1175cf5a1a9f, 0x7680e056d985be16, 0x87ef7e6da98d1344, 0xc3f538a54b6308b6, 0x1233a1d6f436105a, 0x2e9328d850f9c062, 0x8c90fa11c59b7903, 0x16b9f373a,
+0xc187b0eb9c7bf1a3, 0x2e5714bc23c52bb4, 0xab490ae52f734b59, 0xeb4819e5ccfcadd0, 0x631dd8b0ef069fc3, 0xa620641c19e95f00, 0x47ac209620fcd23f, 0xaab3b6ff83f00098, 0x5f087cc2bcef1dc8, 0x117933f1d,
+0xe699150a02cc7bfb, 0x6829ec252a253963, 0x24db9cb4364bd77d, 0x3aab8f8199315f77, 0xdee5cb190e40dec0, 0x2470a8df36d9d7a8, 0x9d7fc4993f292b1d, 0xd64d9aa51f496076, 0xc431543be4764c96, 0x17a30670d,
+0x420985c545a933bd, 0x366b3c4845eb1c22, 0xbf7ca14d81e582f8, 0x5bb2cd899fb26935, 0x2d12939996c22dc2, 0x7bc186eb076cc652, 0xed087c96d4134dc0, 0xf8d365cc9a0f6bb2, 0xe86104a7ddae830d, 0x15dc3b416,
+0x7f1e8163734e72ce, 0x6858d4f74947e6be, 0x780b84eaf4aa83f3, 0x211c7e2f59eb8ae9, 0x89ee185a2d236448, 0x312980bc5219b8d2, 0x878364efe0c11874, 0x3cfb4a5d3346350, 0xb2f0b965c355885b, 0x11f7499a2,
+0xc645b02c07f99a3f, 0x93ba0896cb66d9f5, 0x1d7b24209a8b5ea8, 0x224fe7c0a9f5a0a6, 0x7d2e15cc0cdeec1a, 0xed1497786ccca4db, 0xa49a8797fb5ba34e, 0x9099533724c9ab54, 0xb95c1cdccad8bc51, 0x16bc88be,
+0x99b35643e545cfa9, 0xf309c5a8eb169b65, 0xd049fdb6047015cd, 0xf052f6f59d0aaa7b, 0x3c8b8a78bdf22bb4, 0x996efd47668e3e5, 0x9b806447e81a2e61, 0x544503ea414b02c1, 0xa6c22d2653d39420, 0x1e95df9c3,
+0x830d82975773c8b9, 0xb1be62634ff68211, 0x591e11eb800b2bd6, 0x792cae4579ba01fb, 0x59f9ad446a2e7df8, 0xa75abae649183044, 0xdb2528c959dcda0e, 0xef99f0efbc413ebe, 0xfa83bf3c6a072ed, 0xde928fd4,
+0xe62e9a427d69b730, 0x58bc9ae2fd0157c, 0xf7545bce7369360b, 0xbee4011b096fdcf6, 0x26bc72f88d7a09f7, 0xe8e0e24ad6ba25b5, 0xe8d2f831cdee8a14, 0x7a311096d15a0105, 0x1e08f5cfdacec4c1, 0x4ab4c074,
+0x8804021e7de94656, 0xc1dda18a4252f9db, 0x769cd76dd5928f89, 0xcc8274d35d57553d, 0xf6a3f99c4a993cac, 0xe1ec7e0a9bf4dad8, 0x555f41d0ab634456, 0xd41324ddb4037a8e, 0x29000f3bde58ef00, 0x84bc907c,
+0xa7b8a7f16838c34d, 0xdc5c8895e0939f3e, 0xdaa33fca393694d9, 0x966425ee777866dd, 0xfdf7ff5f925022a6, 0x900d21dd0d33389d, 0xbc35c646de71b75d, 0x28915b0254ff3b1, 0xa9612fb85ece7dc6, 0xa6945a87,
+0xd12805d1a88cb68e, 0x7a5ea068a6db140c, 0xa3061c5519305ce, 0x5b86486d215be343, 0xc80f5e74e95bd4ea, 0x66487af3c2ac7bdf, 0xee8e67d2f6fc1a0e, 0x95637dca1ac55392, 0x261816e29718ed9f, 0xa7643cac,
+0x1018e67d450ba18f, 0x3dcfcdc20f3487f8, 0xa90c910921fe1cd0, 0x617a6db338ce4bb9, 0xd723a28ad185b772, 0xf3e0e2b4631560d9, 0x6736415726c42b9b, 0x96254fb469285be6, 0x70623060df726f4c, 0x21cb69776,
+0x668277bd87183bd4, 0xd1545cbbbe47553a, 0x3510556e1a1e5828, 0x19f8e9afaf603f99, 0xb9ce78c679af07a4, 0x120401bd567465aa, 0x97c011ae3d0c94d3, 0x60a937d2ed23ac75, 0x9256f7e02887c49b, 0x24086d2dd,
+0x72504f814b6bf613, 0x52fbc449a0dc3535, 0xdeed4adde6bae0cc, 0xa59c1fef489e4b0, 0x5aad5ba2e0fe8e73, 0xb1c06a8f9c0897e5, 0xa20ef793b2351fc9, 0xde306dd0b41734d3, 0xf260c8fd0903e7a7, 0x126771528,
+0xda03baa9ca6963d1, 0x8850d481bb1dce2, 0xb5f725c76f23425b, 0xff625ce0a67f5c7, 0x53d7172971b11914, 0x1a80e8bcb99e379d, 0xd2195d1c87b13530, 0x9bf42c972a3191b7, 0x3b8a5704e9aff1ae, 0x1f4049d46,
+0x209309b7bb80377f, 0xa827f93a296ed94b, 0xfe3230eb2518b9e0, 0x2db5f389f1c5088e, 0xbc4d82f759fa6db7, 0x61599eb40f1cc28e, 0x6520a9eab314a461, 0x33a34eb2b15b3639, 0xf335c1f558617bc9, 0x1e5e8e524,
+0x48aa6fd1df203fb6, 0x8622af7b67e899ca, 0x3a6750e311c35846, 0x19e3c5610b47edd3, 0x85702a49281c5802, 0x1f93ee262bbaa03e, 0xaff397f9c88f8596, 0xd416f112da6a7489, 0x1c7819224af37f1, 0x1dadd382,
+0xa1fe9627940fab78, 0xbc4caf414b7c0ff5, 0x82a5c4064d4f46fd, 0xf2ce3661b9e90b23, 0xfbfc80aff93d0bde, 0x9d4650c99eeeea02, 0xf32bf57e746a78d2, 0x60591c979e0e3274, 0xe7f5c84483520da3, 0xbfca5c6c,
+0x13b2f9197fca93f4, 0x8b6a5467b27e876b, 0x19ea0bf41f9125db, 0x7c3fc8e747ae5c26, 0xe03b1e64a685e94a, 0xc777693d970dcedb, 0xc33083a5c3a439d0, 0x4e6539d1a19af38e, 0x56b45187816c3bbc, 0x154a6ed88,
+0x7b6a8fb894b7343f, 0xcfc4ab58a379dd8b, 0xb0565adfe29d37f3, 0x12df72370add2d87, 0x1a70af4ace187a00, 0xaf673bb07f2e3ec0, 0x176e6be9ec929381, 0xae47caacc5557c2b, 0xd05d3e4b08b2de72, 0x178dd7794,
+0xda4b0474e24ab94a, 0x88536a7bdf9aece3, 0x6110ada9e2549fe3, 0xc3c00827667ece37, 0xee1fe26daa77c808, 0xd6fc76934b78889, 0xb53e499f1f92cfb4, 0x1c14b227835baebf, 0xf57b58afa3f2ef4b, 0x10396de5a,
+0x6c2f1e09d515da66, 0xc727fc1896b15c4c, 0x59a1495e4e284c3c, 0xcd7466bee0ef8b5f, 0xa1fd508035abd953, 0xcd3c899b48b87a33, 0x80944069b1a85426, 0x5dbde7a043d7247f, 0x7e6caa9090ed87a5, 0x24741429b,
+0xd6e2f9ddd52002dd, 0xa0e992b7f9149d51, 0x16df497b19b8e434, 0x164360f1da10a712, 0x8428b4db336517fa, 0x94622b8b9089d6a9, 0x6f783788c48b5bd3, 0x1d1a8a68aba877dd, 0x817c8c7ea24e9130, 0x21c04b94c,
+0xde0768da0bf485b2, 0x726a0ef385ccb550, 0xb2493b2bd7b6527, 0x5a807b9b2b54a474, 0xb2780cddbe34a05c, 0x42e4685504def171, 0x6f91fb48a66b4431, 0x2d119f2f0bdae51c, 0xfefb626fac588b0a, 0x1b20d8fb8,
+0x2b5111d62c45f63c, 0x7af85087e8f82f98, 0xf1e7160f5a94fc7b, 0x571cb427b0650d32, 0xd815ba735ba62e8f, 0xf6bcba747961792, 0x1f4593d2a2c50b16, 0xc317dc7f9fab2711, 0xd171a3d88f217f5, 0x1bd887aff,
+0x10a1a406d035c32, 0x2a9a6623fa571317, 0xb9484e2aa52d59cd, 0x7b114983fda1d476, 0x4c10ab2cb0d7fe12, 0xe206fef4bea16f0d, 0x98d832e248479c2f, 0xde2b6120d4b7278f, 0xa47a8e0c5484c59c, 0x5b531e4e,
+0xed9ab823c5669b3e, 0xb8b8fc4fe59ce139, 0x24f70f285488643a, 0x698613701f91b823, 0xe5e7975f893b622c, 0x2c21e725e0e85ed7, 0xd05ff35b78c0777e, 0x9b7df7f995ddf95e, 0xbb8cff008e44c98b, 0x24c7da6bf,
+0x5dd46c2274c5a5a7, 0x633f94135b7fdade, 0x584939ae9092f8f, 0x44076f558648ea, 0x201a507725cf441a, 0x8907cda476fdfb2c, 0x5359170ba28024a1, 0x7d0382a83a257793, 0xe23536a5ac778031, 0xb7012057,
+0x604d19f61a567bb2, 0x6b10b0021364d698, 0xc7a83f1b8f000ad2, 0xce5d4b74d7c737be, 0x59ceb4ae295c0d93, 0x6f1fb188ee666e33, 0x5dada658a4b82b1d, 0xa0b4f789d96c98d9, 0x7085ea59a4c66462, 0x269d07705,
+0x9949dad5b1f52651, 0x2d74c1e7b1230d4e, 0x1a86ae8d801d6ee1, 0x849db88cee64d612, 0x30e95a7da696e497, 0xa6d6efb81a670f66, 0xe3e0ce3397484685, 0x70d77e16a641c57b, 0x4435a3f5cd206e97, 0x1dc589159,
+0x543574fe1255bfa6, 0x57704df1e46e50f7, 0xf295de972142a839, 0x9666bc6d624e9366, 0xe3068d0b43005f8e, 0x96cccb751e6cba03, 0xa867c50c71d8a050, 0x78ce07fb53489d63, 0x418b300d0bdcd31f, 0x244ba0040,
+0xe1dd61eb00b3603f, 0xc24a89faf2bb9dcc, 0x523534f16a0664b3, 0x564f92ab53087ecd, 0xafeb94b542fee393, 0x8b84f658642d38dc, 0x6179b4aad07c8a04, 0xb1b1c29975268cdf, 0x8aaf35ac57d21adf, 0x157bead8,
+0xc0b98d7068b82f5a, 0x9775a6585659e76a, 0xfc6beed395fe81bc, 0x2e4e741470190494, 0x7128361fc872ece3, 0x1bc0ccb7283a19cf, 0xe6dc6cf2de763c9e, 0x5685f0d4e7a0bf44, 0x7ebef742cea7d9b5, 0x1f80b547b,
+0xe21a786afe258318, 0xcdb41ee00cf04dcd, 0xf5685878cc06d565, 0xf3a6bbf1de4d5ee, 0x7f4ad93b96b0289f, 0x73485e638743ed29, 0xea30ba4293556e01, 0xdebb27624556bfcd, 0x37ba5ec98b2077d7, 0x2fff853a,
+0x1aff155b4ce6ee09, 0x5256ba383909b508, 0xb748c5a56092bc1a, 0x871a8431346fae3f, 0x5c786a899d0ead37, 0x24adf383b0d64a31, 0xad39b4ff0b534b79, 0x81c127769f61d7f4, 0x33fc0613f7668811, 0x1616fc9c7,
+0x3c8cad8775c4e04f, 0x538b1ffe5a90812e, 0x6a7852c62fb5e5f5, 0xf75269a6b32a125, 0x6b4be03101f2bb9, 0x520c0c9608747848, 0xb653df767b838299, 0x493e73cdd8f1cf2a, 0xc8a7a96d45250bad, 0xd5c93b7f,
+0x21528e9b20130896, 0x9bd01bdc3852591, 0x8d6c91217c994948, 0x4351860a1f9071be, 0xbe8f4f5872dd48eb, 0x22ff60cbf2fddcfa, 0x509f099f3cc633cf, 0x17d82f17d79cb9b9, 0x5d26cccb894c2c3c, 0x175577089,
+0x7210e751d0650773, 0x9c3a60eb0305954e, 0x23af5dd57e554ab6, 0x690ee41e888b08b0, 0xedc7459381df4ca2, 0x71c1ecef47dcf84c, 0x802c82debf1b792a, 0x9e8495520764841b, 0x4b9d516f25de3d82, 0x12a9c8075,
+0xb26c690e43c8d7b, 0x386ad7a00ac180a4, 0xbc06f0d91992426b, 0x1426bd1c076acd42, 0xf42a9f99119f28e1, 0x3c57bf0a774503f5, 0x45b2057abe953456, 0xa21b8fce542c85d7, 0xa171b549e0ee4ffe, 0x425212a5,
+0xb809e93ececd8eb4, 0xa8ea25d16cb1826f, 0x2b6b93ffbe5a3b9a, 0x6e7bbad8533f3605, 0x985e0b1fe2c7a10f, 0x557334f31d3a87e2, 0xd283b3758e653afe, 0x9be35c1432fa08d1, 0xa312ac9b13a9b0eb, 0xc7d7a775,
+0x543be1806645ecfa, 0xb11b6c5abb439cf8, 0x36f9f4f23f8353d, 0xdf95675b9764c39b, 0x6081b9235bebdaa9, 0x9087c83d57cb71b5, 0x8c6896eb8a5f65ea, 0xe65e34e817c9f82a, 0x2ac1e74422d6dbb7, 0xce384f2,
+0xce545057f21a61fc, 0xa75c9f3e80e7a1bc, 0xa820ed4b94cd34c4, 0xd5a69eb76f4ac615, 0xa6296283b1f29992, 0x46ba6ed6199111e5, 0x7e2b0631de4dad60, 0x616194ccd8e273e9, 0xd100e67513db60d9, 0x892830ed,
+0x3deb6a8eb0af7bcc, 0xa589654f7f653e86, 0x71487ac164832387, 0x5bccc69ea064c6a, 0x610c798e3b7ffd38, 0xd0b72f998846fda0, 0xb757ac3671aa4369, 0x206026116e25d90a, 0xf25b746a571a0c18, 0x187e82d2a,
+0xb937eea06138596e, 0x7c5d02783e45e88, 0xb53d1b9ab99be7c7, 0xc6abb601b4f56505, 0x5bed78357818f17b, 0x331737651292d0c, 0x4a6846c1eb2812f8, 0xece306d745aa4b66, 0x18935c3f56936276, 0x16a743409,
+0xa9d6747f02e85c9f, 0x647850c696a66150, 0x3dd3f4efe06f386f, 0x34d3d411e38e344c, 0xed13352a45f27413, 0x441ccd4c49f413d1, 0x654dc30e6beb6d45, 0x73b5499b9709767, 0x4d5d546a89ff1f29, 0x1fd389434,
+0xfa6a3670f04b8e14, 0x1b99c2a12589ddf4, 0x27dbfb9fbc0885b5, 0xc4df6f208418a42f, 0x5529aa0f4bdb73bc, 0x5837ef05ea7cf335, 0xb88c5ba184408d37, 0xb5bd0a01e35fe276, 0x2e6701b5e24c7078, 0x21bf4af7,
+0x982256c31e993539, 0x3bab60c33c09331b, 0x1e787e40e3963be9, 0x62ba5dc662e7f251, 0xab570bdff06984ac, 0x50609c65d52df74b, 0xed9a6829df7d8f3e, 0xde7b2c3605462d47, 0x638ed58423ea7e26, 0x24c1a3424,
+0xd366142295a9519c, 0x44fd87c1e94722f6, 0x7cc08debc5b85c4e, 0x60d55b27bd348f3c, 0xb3f441158824514c, 0xfd5e5fbdd3e1baf0, 0x90e7a63ad410b041, 0xa9e5606fb26acfac, 0xf7d0ae9ec15b7290, 0x18d09b21e,
+0xef1d37ce62167ed3, 0x4f469f2ef99558d4, 0x24515ed51f9ce498, 0x1a7f071c8411c552, 0xb8cf8a6e53e87c4a, 0xc2e3504b06f1ea4f, 0x6e5d1aca00463888, 0xc71552bd526f3db7, 0x39052217d95f4ccd, 0x65aa7c80,
+0xe42adeeb214964de, 0x454e7fbb63e91e4b, 0x15e2df78559dd943, 0x2fa8b66107d4de91, 0xbf215d42fe7c377a, 0x31e0689c3640b97b, 0xbed08911c9e44feb, 0x54eda4f1b016c6d5, 0xa42b617b7bc78b1, 0x80c3d881,
+0x867c5dc13c115509, 0xaa993a9a0eb97cd0, 0x2551e530fd4e1d85, 0xec8c13f00022d245, 0xce53b5d3d23faac5, 0x7e3cee7978692774, 0x65941b8028612dbd, 0xcc19488125195854, 0xc02b962c29db2add, 0x273fa628f,
+0x75bb63debb45e4d5, 0xce7669c81acdbc80, 0x5562cc894d12a644, 0x47af92a6becb94a6, 0x77ac6a189cdcdd82, 0xcdb3ab2e9888d562, 0x3935eb153284a7c9, 0x3a37860e0f78ba32, 0x3a3d669f6987376f, 0x1007eb0f8,
+0xbf76aff6dd5eee08, 0xd0ce4ebfc04cf57d, 0xf40952912d0019fb, 0x9339578d6ac0bce1, 0x567661c2918446f4, 0xa88f74086be708a2, 0x52385c782a316cf, 0xf03d3ba91cf9acb5, 0xab385667cbc1794a, 0x1ef73fe47,
+0x782eb3edd7c41fd6, 0xa8b77c36d94046fc, 0x5be1b055ccbd34b4, 0xfaacb5a98bec8085, 0xc4e65e17a5b8846a, 0x9b5fbbab9148511a, 0x219487dc00666f41, 0xf6e3b1d184bda0bd, 0xa0d4755d145bb050, 0x212d30ff6,
+0xcd60adb3b7cee32a, 0x40c263eb6d2d7fe6, 0xc41edca74d68953d, 0xc74b59fe770c80d9, 0x88d489f7989eab7, 0x2ddc39fd91385e1a, 0x1b1c8020199023cb, 0xa789f4cb590e27a2, 0x7a4d37c36b45ddde, 0x29bbfa15,
+0x1d7f85a3cde7a4fb, 0xa9329a3e41c850c4, 0xc84faa03a4332a38, 0xb3fd32bde4648b5f, 0x1a20e5ba69de5bb9, 0xfa51da065e10017b, 0xaf40623319387e0d, 0x7939a28d61fb80c, 0x4ab6551d52517114, 0x1a1f49acf,
+0x84e8b61c71760d6d, 0x80858a205253ccea, 0x35272b09af85a2ee, 0x81562a5eb2ac38d4, 0x968a2a1efc4f855, 0x586a14f07aa007ca, 0x68021b5b4cc45b44, 0x648a51e9373b6f62, 0x7c2e5f2edd6b193a, 0xeccb0e6b,
+0x5523d39abca4d0e1, 0x63e1a282ee8d1337, 0x28bb5a950b8bb02a, 0xceaaca56562afe16, 0xc919200bd78d2b7e, 0x6cdce818379ff02d, 0xf4ddf8b730bcd5d8, 0x6b0403e3ca4a63fd, 0x7e3a075422c47b0b, 0x2083aa9ac,
+0x5c36c8543d4904dc, 0xfa36ed0e96858cc9, 0xe0cd254cbae6db91, 0xacb1ebe8ced9b3bc, 0x10f9ed318813c2c6, 0x7511462bd4d815d7, 0x4ca0eea6386ee149, 0x9de48b57643af775, 0x93822a135b8017e, 0x129d5d82d,
+0x550ea71e7fed759f, 0x8b19f7f09effad3c, 0xe0ddb74b27b34360, 0xbd87a2a342f8409f, 0x4925d2aec32c95cd, 0x6c68acbb2a8c0a90, 0x915298583cabe4e9, 0x906522ac5fb777cd, 0x3b5c37b1e206b8f8, 0x79d61d20,
+0x58eff8226e8efdf6, 0x88851843608327fa, 0xbe2a8d2d4780745e, 0x9176e09cb862d0d2, 0xd8cd6b25805cd6d1, 0x6fa41a325d21f45c, 0xf2618c1a221ed81a, 0x68c5573617c9bec8, 0xccde74e1fe0f4a7a, 0x359deba9,
+0xd0652614dd0bb27e, 0xfc4c399c93fb5d4e, 0x91467e40c9f16868, 0xe3b82e43248ea0fe, 0x2ca58c833be3c0f1, 0xd3f67815d98c9d9c, 0xe765864be7b4fb09, 0x16036eced0dee97, 0x196bfa8bea35a666, 0x89720a59,
+0xdf47560a65ef9dad, 0xf4e514d3515e92f4, 0xd957f23f6122e326, 0x1dbc87adc9e0a653, 0x54339831b6e300a7, 0xe00e7860e93baf33, 0x9310a7d9594cdd80, 0xb89d8dbf4e776b61, 0xd14c39d04e673f83, 0x181fa3a7f,
+0xe7a889010812f297, 0xc418ba50addd6808, 0x8a088c1390e9e680, 0x9af0115bb2a79d49, 0xc7198e697d2ad17b, 0x52911990aa847e49, 0xb639b938d56cd956, 0x5cd6958dfad80e40, 0x637fa03100aae1e2, 0x1365b9ae6,
+0x6fcd239d2154b61, 0x1de2c2dc5e27e6d9, 0x6cd28801a7fe6bc2, 0x520bde63a121986d, 0x83d0f4002a45bd9d, 0x96463028ca594257, 0xaa325c3270cbdad4, 0x222773a1dddfc684, 0x3b016f6e53f7eb66, 0x14769da66,
+0x397d78a87312a4b7, 0xebcdfa44d48d8041, 0xd1d9e34cd3d9f462, 0x73bb177adae40710, 0x1501c9bd10f6a48b, 0xbce6c398e3e1eeb, 0x7ca23ca2f9cb8c16, 0x609df5045d6900c8, 0x74ee05db2362f022, 0x183f25b7c,
+0x5dd7922bcdef5e22, 0xe8d674819e4322a3, 0xfd0d34826ce8b50a, 0xa1ebb84540713680, 0xa5bf6c438575d4c5, 0xf49b854d19b6a42e, 0x38e88be08c6bfbeb, 0x9de7966fce55782, 0x63b0cbd60fb73e3d, 0xa30ad770,
+0x53896349a6f94ed3, 0x1eddadcfd7c195b2, 0x90ce800f329aa694, 0x65d2429d7d137067, 0x9f759fd15ff969a8, 0xdba37fb311e32708, 0x42470c8c85c0ebdf, 0x319f6f10b7e01488, 0xf5bbf5d56deca6c1, 0x180eb0649,
+0xc558cd7870f377ac, 0x44fb86a6793aed9f, 0x789b76719fbb608b, 0x242d11939e54a25d, 0xcc0809f09e42fd00, 0x9fe1e251b80f730f, 0x90844128af1355c5, 0x8a91adaabf690cdf, 0xce2c04906df48865, 0x24702b20c,
+0x1559b280b0528b6e, 0xb0aa76a59aacdaee, 0x463f789d25946fa4, 0xb13c1e0ed0c89ca6, 0xd31edf97cd0dd97a, 0x8675cb01ca4145b2, 0x45e5206f2680e897, 0xfac23e8d35a1ab56, 0x9828765fc45a80b, 0x42c1b552,
+0x4d7a7ae2230eba14, 0xf0be8ff370a2ea55, 0x4788c8e2e8c8356a, 0x3d0ff9cd8f815e75, 0xc8d1113af96a159d, 0x880d2bd3794600ce, 0xf4b4a4cfeebc4818, 0xe6a089d0dd1332b4, 0xd8a63a2a4266b2f9, 0x175da7596,
+0xd3f6ac35a1c2bedd, 0x3be1e6996b7cfb58, 0xf02d2fe954e52234, 0xe47f86b43d82d5dd, 0xf163f1415eb76274, 0xae35f77f992fe5b5, 0x2cf1da65fad67fa, 0xd5588c4f8cd4415, 0x363c345310155cc8, 0x1b39bd18f,
+0x463c1572ef608f24, 0x6504df9ffed65544, 0xe1dd4f3983436a98, 0xe2100f7995f8cd7b, 0x599f4f95b0336b91, 0x6e320383c24c6d39, 0xe1fec8c8c306174e, 0x20b4f6a5390643e2, 0xb766e46273cc384b, 0xefa89937,
+0xf20c5f8900b1a343, 0x935ef671a661ead0, 0x2dec205b1189f024, 0x323dc5c5870cb7f4, 0xc04653b83cba0db, 0x22cb4d66cfd341b6, 0x97e7dd0b9440baf0, 0xae83efab2a1a77db, 0x47949f50650ac95d, 0x4507f163,
+0x65690ad8d024438e, 0xc8dbf88813beaffe, 0x3f13b2a5ca4eb749, 0xb60c929cd9b6d228, 0x8c4c0327d512060e, 0xa0ab6c7ef5ddf407, 0x2f68c60b7d7b84ae, 0x123541f983bd8aee, 0xce036cf6999dad98, 0x1cbf294fe,
+0xd767dd4fce67f524, 0xe0cdd6fba65347bc, 0x21442c2fb26b00e, 0x3cb944d690c73435, 0x5727cf83d3b2f949, 0x5336efdc4546c2c9, 0xdad51d354d4cd1d8, 0xe014a1ccf4d4cb43, 0x10ea7b92b812b528, 0x175158302,
+0x45bc630d9a63a4bc, 0x90ecfa753bca9c34, 0xda72aa778670bd7e, 0x9da789fa8e974b28, 0xefb335f2b8ac34f6, 0xc7219220ccd56399, 0xdff636f4ceb453df, 0xa62948f3f8474d18, 0xd4dd224792d8c579, 0x201b4f582,
+0xd1a9d25ecebcc8a8, 0x89e6950edee63865, 0x919f4f801635df1a, 0xfd4aa1ac99c77fba, 0x40f6c2b71a3df51b, 0xbd0f98ea742f443d, 0x6b49d276e8e42c26, 0xdef4626dd8f043c6, 0x447ea00282739483, 0x193ec6174,
+0x3e03fe21bc2f7f0e, 0x38de099d5b3a591d, 0x3f034b3765562dc9, 0x8ea5f8b73ffedb11, 0xdad3c4a63b20ccea, 0x6c167a546b610dde, 0x5c95c747a1ccb132, 0x4998a10affc94084, 0x9426fee9afcc6aaf, 0x16ee76dd8,
+0x2d4d543cb399f4ea, 0x147817b0eff17dd6, 0xc223a6cb230029f7, 0x1350f5e989be0929, 0xc858c20c8e5344a7, 0x2e59bed338d50e59, 0x47208dbc0691565f, 0x6968b06116410978, 0x72828767d01d3a0b, 0xb1a3f214,
+0x43caa452691d840, 0xbc7000be3dce001d, 0x435921ed1fd9b38d, 0x6ed72a4091d2fc13, 0x4003a3651c9506ea, 0x49ae5a12a8f8365a, 0xb1ab10987898244, 0xd797232e64541ed4, 0x7465eee084b63a79, 0x18e4fc461,
+0x34c66d8f75c42596, 0x162958aafec49578, 0x7ce6d0a8a515bb0f, 0x837aec5731286aa8, 0x4c63aa9fd11cfa9b, 0x609e307a6f0ac4ab, 0xe7c9864e6f578f3d, 0x64c5e609d47e187d, 0xe21c249a6ff89ce1, 0x27a4c6226,
+0x9cf7df6c57760ceb, 0x8bbc62698f4c958c, 0xaa35dc938f4c5d9, 0x334d5f27da8b0561, 0x75b6a9de90fc6f6d, 0x9d985a36f449f689, 0xcc405d8dae7b4840, 0xd6dd3eeb3d313cdd, 0xbcf8938acd5a53ff, 0x1c311cc16,
+0x1577c24a554e72fe, 0x53f7703678feb6b3, 0x71c5badf06a0573c, 0x41502412ea9c0690, 0xba864eeff932a4c2, 0x44ab3650b3483af, 0x45de981e0c429738, 0x29754afa87f6dae5, 0xc82f0443de5aeb5f, 0x229551958,
+0x74b3def4a4906be2, 0xd3c925c1a2f4ead9, 0x48bd59e23ee0c180, 0x8c2c030d9e09a54e, 0x3b9fdcdbf8710200, 0x832bd46d0324d00b, 0xf2c32f0c0b060427, 0xd7fa032be056b287, 0xdb79af0b598b9295, 0xd4d83df1,
+0x4e112dc7f1ad541c, 0x3ddf30cab71e58c1, 0x34e466f4ce15d1ee, 0x91b49f4ea06beebd, 0x1f0752aa4e4fd68e, 0xfc359c4a273bfa39, 0x5d714376b98bf44e, 0x3c65dd9288592c5d, 0x2ca9d6faca4e354, 0x23c1e304e,
+0x53cb63c6751665ac, 0xbf6708e02e25ebaf, 0x9171e395241cf95e, 0xa961f10999a30fd1, 0xce439041ecf8228b, 0xe932f6969e950d7b, 0x8c588f1b297fb775, 0xd2654c9586390b23, 0x16aefae0be74f111, 0x851c7274,
+0xa7624f6e1535e5c2, 0xaabf79359b2b16ac, 0x9696311e28af531b, 0x9cc9efe416292985, 0x3b53b584597c1dde, 0xb03086428223b9c9, 0xe1ef5cfc36a50db2, 0xd19c87d09fb17ed8, 0x394d38a8e8dcbcca, 0x1dde58623,
+0x8160265d4c66592d, 0x2b3c35d2a931a69f, 0x8a76ea7a3f042e19, 0xffac635f9e5c2094, 0x3a1c77c1e9d9ee31, 0x663b5877fbd3bee1, 0x2dda5b9b523b519b, 0x54acd6e54ee8e6a7, 0xaed85e794b9df542, 0x1dc6250bf,
+0x900a8f990d386689, 0xd42677c4be79a194, 0x4271f3d42b7ceabe, 0x5eb621f5bd1859cc, 0x682e64c63e9a8ef4, 0xe8cac10456745806, 0x5771ad114a6d6f3, 0xdbb84c332c760f9e, 0x3e92a2c1a22785ce, 0x25e22ff16,
+0xf1c708751845f2d4, 0x62a30e7c63716a2f, 0x13785851ca0d528f, 0x9077b8dc6e9e816c, 0x54861e043ed63d53, 0xcfaca5433a155cab, 0xd5436a9ea5bfa1a, 0x51854734a010d5e1, 0x3db064e4e89496c6, 0x104b17529,
+0x82ca9c6a24bd143a, 0x38680d8f475ccc86, 0x55c2b4c76dd02d47, 0xbdac72cefd4c011c, 0xd3b668d1843111dc, 0x46bed1ddf661d1fd, 0xcab49c7005a3e16f, 0x66981f64c5e9a7c9, 0xe53d1ea9448f9071, 0xcd04fa05,
+0x26a9d476ae2a7822, 0xf38c3b77218ce631, 0xd1a130dfa8b63789, 0x73b56ace89654bf7, 0xc250936e6b944ea4, 0xecc6a4d9fd08d41, 0x29e4e5a31976ce6, 0x8f2313b951d8a0fe, 0x26a96750b2f3ef49, 0x1e3f2d542,
+0xa7abed35546a3319, 0xcc4b6fb0e8b3b50c, 0x3379e67e630a8728, 0xef733161e9749d8, 0xdb6521ee118c5d8b, 0xb1e4ca14f9c49b97, 0x54bae48e5ec7bb0c, 0x1967a81b5705bb09, 0xd32bcfc08bacee8f, 0xe7342029,
+0xaaad4e76c238f5ec, 0x40ca5de7cd97c91, 0xcc2eac8632d8e356, 0x41de9c1fd4afec5c, 0xc5115c54fdc7406b, 0x6488696ca0e8a05, 0x3bbcbd375e4c7117, 0xae169f5c1dd5622e, 0x516cc8d3f9ab2f22, 0xbed8482c,
+0xf27b4e6ea629e29f, 0x30c1b267d6d17169, 0xc03d94a57e474aa4, 0x5e772933af0ae1ed, 0xad9cba16f2b6afd2, 0x1d6d8cdd6ead3007, 0xbd364ca368544d3d, 0xb7da993681a4b7d0, 0x60bf90ed5bb0169b, 0x1a07ce921,
+0x4fd580cd61154dd1, 0x3618d84fee335e07, 0x7ad472d82e18e74b, 0x5a466b9e3883611c, 0x3bfb2daaa2e901c5, 0x9ef9128d46ebfcee, 0x3bfb98b28543887, 0x11d0c04758be84a0, 0xd43d25d80bd7c89e, 0x912f556a,
+0xb93fe1479bb7b7c9, 0xcf25169348f8c753, 0xd59e8a74c29e165e, 0x596532c04f61a155, 0xac529c646bee90c7, 0x1726503ba1ddcd17, 0xcdb16a1761c15ada, 0x7ce3667233f51902, 0x733b4342b9ea0dbe, 0xf4fb5f79,
+0xaf8ea7a9085dd701, 0x1877420704c2985e, 0x12c7b8440c2fae48, 0x6e536156d08bead1, 0x2a083ce59581631c, 0xf417c54ea5f40c5a, 0x9217faf3afdac5f7, 0x57fd6dd1031ffdbb, 0xfa50e90f616b6772, 0xb3c776a,
+0x987f56902380e936, 0x13bb478cdf417644, 0x30c6d4834bfa03b4, 0xc87bc3d0e2243ef6, 0x6d3d211872b7ffca, 0x2f5134af64dee195, 0x9afe5528f083f3ce, 0x8b4304c475e1e20d, 0x794a69e2b2023f3a, 0x429d2545,
+0xf810c402edb614d7, 0xc4ae198c9efb6ff8, 0xdad5046e09d1b5e2, 0x4380c5f076b35a0b, 0x53f9fc5dc80c05ef, 0xe62fb0d79d65adca, 0xca5959611291ad1f, 0xdfe96a390e07ef8, 0x6bc585c9cddbd9c8, 0x1ce0f3831,
+0xa02c2563f2e6d2a8, 0x5dc8733a5732dcfe, 0x3871de191d686f5c, 0xe7c1cff50441962e, 0xb2bf4081aa97fe2, 0xc8165095f90f5813, 0x5d0afba733bbd7e7, 0x23ab4dff04b2427e, 0xdfb38d01bff85786, 0x60219b7d,
+0x3955045654970cc5, 0x4d27ea097b787e98, 0x8e05d9e70bdae0e4, 0xacc0793dde96a146, 0xcaf3c70cbcada585, 0x38ddecbb352128b7, 0x7ee567cbee48f9c2, 0x83840d9d42c4a8d9, 0xf3543c68e7306179, 0x1d85aafad,
+0xf1b83fc77628a072, 0x62a6a154d8dcb122, 0xed7fa72c300aa82c, 0xfa0d5e9b1c025f3c, 0xfaf1a71fe0d0e79f, 0xb8c6180265bc044, 0xa694bbd06e95cc88, 0x9c327edd3e03d4a3, 0xfb91ca5ef2b626d7, 0x219c85c3c,
+0x13ccd8f8969c5bd0, 0x6e832b9d4da7f7e, 0xaf29a515db7df839, 0x20edeecc409cef22, 0x6d42dd3a53c44168, 0x2175cde4005af738, 0x49a87a4f1cda382e, 0x15eac0044fc6e9dc, 0x6972008068ef9388, 0x4f3db3ea,
+0xd2e0b8c66067f038, 0x32cb9d063e06c6d, 0x351ff497ab4d73e2, 0x9d01539a7f6faa6, 0xd87447ad71fbeaa5, 0x560f12ea3a4bcc44, 0x48260e2d5f7c35d2, 0xfab9beefdb3a9d60, 0x1070dbd590c08d93, 0x19d412492,
+0xebd456473f4a5a71, 0x323d3fae34220a4a, 0xbf044b074262da63, 0x65a8d0eb8b528939, 0x2fd2331cf31bdfa7, 0x948914c26f62af8, 0x8f842b432854d017, 0xf897525e3f31cf52, 0x4802b87eb4420853, 0x4bece9d4,
+0xe9ee8cd5e8d5db04, 0xbb2db9f44770f605, 0x53278b090c2f4c80, 0x420987fd848416cd, 0x31f07eb72a3daa6f, 0xeadf8bb710071e2f, 0x8e7382deab72710a, 0xca36b29fc3af4f2b, 0x45e00ad0281e9056, 0x9de53d06,
+0xcd31e92b4f46bfcc, 0xea69e5b90b7175e6, 0x998b4d50597fb0d6, 0xc66031af9276ff42, 0x4f4fead270eb6050, 0x23a0ef0637136ffd, 0xe6fa803d51d13a3b, 0x5693273d6b3985f4, 0x81aa2765a6a36fa8, 0x7e7eafa7,
+0x32fad7702bb21414, 0x10dff70529a3093f, 0x1407ecfd55f343d8, 0x25fa7100fafa9fb8, 0xc862c9fbd428e126, 0xd58626b8183a4e7d, 0xe4bc139b650deb8b, 0x5034079a8a6341af, 0x56c172f6a2a16116, 0x16a2d1d74,
+0xb47fa093f98e85d2, 0x5580be54e320c28, 0x5625383eca3c1e43, 0xb1bbf2dcffec6dba, 0xe636e402ea9018d4, 0x53b806ae6a0d4c2, 0xe0f8c7c812ef9f92, 0x9aaf2081f043ef38, 0x5b1b36125b8d7f44, 0xa2e5ff8b,
+0x61b756b05ab5b564, 0x38fdd1cefaf91591, 0x2566c916d442c104, 0x22316b76cffdcd5c, 0xdadc2ea2a9b7244, 0x1422d4616a920503, 0x9f436c91513168f5, 0x56bf1c3d62de0a85, 0x1988b39042a004e0, 0x222963bf2,
+0xc9aa4a09d2f6d622, 0x70f820cb0f9e1bb1, 0xe8f4bf2d5ab7bd38, 0xc3455ec42c0536bf, 0xd8e94daecb1304a6, 0x13a0bf783d998883, 0xe074c510ee9af4d, 0xd677bbeaa4c9a214, 0x2396ff94544357af, 0xa98d1938,
+0x5bf5a13efa917409, 0x531e378508f75a21, 0x374709fc4a476075, 0x864c983f915843b7, 0xeb76f8abe227b5ef, 0x3b1d14c939428adc, 0x8a69b8c4607e5d5a, 0x279a5d6e4d665bb9, 0xf1da817c167369d4, 0x39afebfd,
+0xe6289ff0c8ae7ab9, 0x2e01a0d8045115b6, 0xb23ae2e00eeed5c2, 0xc97e387ebb0a5e52, 0x796842ce951e3013, 0x87c65a2e3f30e54f, 0x1854e1330b4504, 0x3135fb9e62f6de56, 0xfda3dccc1ba9a7d9, 0x194333d17,
+0xf4953a406e2d56ec, 0xe36f96224c1baab3, 0x5a5918af64369fdf, 0xebedcad62777e821, 0xaf446184313ef4c3, 0x2d0abd15d875d8a, 0x8e9a6e7494aa8f92, 0xfdfbc08c1578b997, 0x8bddd29a7083e2d9, 0x140ac449d,
+0x4575af42b464b3b, 0x5c5c4eb6a2adb329, 0xce61a14c11154af7, 0x1629f4ddc8767257, 0x96ab006f368d9493, 0x979785c2fea18460, 0x209f974bfba8de17, 0x3b91d44f0f58c265, 0xf08856328fe097a1, 0x2017d62bf,
+0xd86ec285d0ba4275, 0x674f782c588259a0, 0x98fb554052654762, 0xe4295bba6009dc5e, 0xd2c600bdb10a34e2, 0x92301ff974615048, 0x14eae5880fad4c30, 0x37700abe28b59056, 0x7eec4bce56f23f61, 0x16dd03eb3,
+0x523e188f9ad400ca, 0xb59df2b647210134, 0x883af487a065f898, 0x1cfdbe37066c6cb5, 0x3e7ed71baa6e951d, 0x9038a97a3586e38e, 0x8675d03fe91ae562, 0xc9f091c0ba3aab9c, 0x6c515d199dae85d, 0x1c3d4a25a,
+0xb302a8ed399cbae3, 0xd78f4366d42c286b, 0x5a984df17260d314, 0x9292749d23391317, 0xc8225e1deb8cc8b2, 0x67652e17287e87c2, 0xbd239fd20f0476c5, 0xc1aab195b646af4d, 0xfaa8c5f900cc65bc, 0x226eb93b,
+0x1dc57cc664beea32, 0xda85f12098af489c, 0x6514c5ca3cc5d9b2, 0x97c01ad17c413959, 0x5740df83929be511, 0x48547ae91eb5230d, 0x63573a4955fa8af4, 0x5b4cfdcbb18bac36, 0x13bf75517ae4fb0, 0x1656498eb,
+0xccbbca10dfdeacb3, 0x576dabc028243c83, 0xc0246f9ecc97b78f, 0x68ab91409ce58c, 0x96bdd28e3be305d7, 0xf51dbc9e21e9b9ee, 0x3a8cf5875d509f52, 0xc2e33d819b85d475, 0x3505b4825924d40, 0x22126024e,
+0xc9417072ab8717c8, 0x682bfd7831a73738, 0x70273dbd0087df33, 0xe5ee6371268f2c46, 0x743b70df8846af19, 0x230dd3144d712447, 0xc586e31c0ffbf58b, 0xf117c44de9fc5d2c, 0x87d58edf70867c5d, 0x188300c3f,
+0xb27d1c504f2a459e, 0xd85c8e4bdf1ff24, 0x5895eebdee634da9, 0x98a941add6f96970, 0xf89b04cb761872f1, 0xd5be001a25a7080b, 0x823410aa6b17696e, 0x4f898a06547671ff, 0xcffbadba557efd51, 0x23e23dde7,
+0x607cf4df3e1de2ed, 0x33afaa59c06d55f, 0x8dbca1312d135564, 0xac31b921dbaa9328, 0xc52acfd5f453560e, 0xcb0772a56f0ac4b5, 0xe994c112a53a00d9, 0xe40727d2d93ceec5, 0xbbbfedd08a6e64e7, 0x1c85ee7c6,
+0xc5c8d89ea3395765, 0x5899d9b6ebc38286, 0xfff95ed8057c67f1, 0x4113897160e7c2a4, 0x76e012c1a887193a, 0x8c9e8130c737de38, 0x2236ac3fd13f748d, 0xe0d75fb868b08b33, 0xce45fff8ba252fe7, 0x7f24b6bc,
+0xf45bc93ea0239bc5, 0x763d6041c3045089, 0x92275f8dfe9cdcc6, 0xaea28e9b5ed12fc9, 0xafb1464dc3d14a03, 0xb1ed8347d2f18394, 0x2e850f4d5c73ac1b, 0x203da7436b5bb2a0, 0x3cec8b6df32e3c08, 0xec6a1f10,
+0xd36b0d036944bee8, 0x260b539f5eb41602, 0xc94bd7bddb370374, 0x8a887a2f7b43f813, 0x6f6b0a47fc04cfe2, 0x3adcb6afd91d52ae, 0xe9628a4148b871c7, 0xd8621cccfa55cb3c, 0x398a62dc4d024c18, 0x24e4b606f,
+0xd0baa4c1b4db7e8a, 0xea3212769d7f9e03, 0x8c721da65ebbdcb2, 0x314d2d4491b938c7, 0xa4384e29bc4a73f, 0xe34b1d4a4e7e93de, 0x9d15597204d15e26, 0xf78c297e3e01eb99, 0xf9ee092db8751b7e, 0xe29a861d,
+0xa8d007b4539a3c20, 0x2463b8576bb0538a, 0x7541954d805414a7, 0xf6a2ae9c234aa86d, 0x6f828418e390f840, 0x60285d2f2471d457, 0xcefa80d15af05527, 0x4cb19da8d71e07b5, 0x2bf6c6d95f364af5, 0x14dc2a892,
+0xfa12c3a6da7f756c, 0xa6fe497d358023b, 0x65351654fe6ec678, 0x5bd8e0db818665e1, 0xbb2ac62b0ea4cee7, 0xf281eb9bb0a03611, 0x4c726a77581a40e5, 0x3ea13bd910b8feb5, 0xe740ffaa58ab4aa1, 0x384c3382,
+0x6c1cbf8139404caa, 0x324277a1e2d36bf4, 0x7ee2674ce9ac0294, 0xe8d3d0f4bb5ab334, 0x35914cd3d67ba7bf, 0xbf2ca55e9d01e25c, 0x34a322413a3e5eb8, 0x90ce9c3c98b75535, 0xdc67a621d757e999, 0x1d26ddfc8,
+0x2d938eaead9fef39, 0x19a94754e8c0e287, 0x51d815244434ecd2, 0x439ed04687919068, 0x26fd80300265b641, 0x72296f8f34bc221b, 0xff6827fd271e7487, 0xad5887d83d7e87b0, 0x43561356106ef472, 0x22a493ac,
+0x5e7f1ca47c84385e, 0x35060ecd481601a4, 0xf0f39b35f989d046, 0xd414c1408c9fd122, 0x92e5d622b16db63f, 0x80a6557c584c4850, 0x90df5d82238bceb3, 0x72c69e50268cf785, 0x91783dba1f98b194, 0x131a9a719,
+0x32fcf7f0d14ee1c2, 0xfc9f3542953a80c7, 0xca8bbad227970d55, 0xa7f49f25e165916f, 0xdfce376aa2528ae, 0x6e8c2e59c544d2c7, 0xcd1d9b0bf124d877, 0x1d832cc5e2c005f1, 0xf0f468401c96de5b, 0xc8195f81,
+0x16919e1ef5d70f73, 0xced3775fe34743a0, 0xd57052bac5161f7a, 0x5fdc7a5c77dee691, 0xf0ff8bedc7b54951, 0x50801603c5b2b38, 0xafcec9b20e466776, 0x406d79b82174bbda, 0xfa342d36e3077a98, 0x10f09e3a4,
+0x9cf0678482c2ae98, 0x9476d1b8cff3de70, 0xba8cc9df6fa0cd8a, 0x4fa77869e9eb4295, 0x476fd0a93f0fb12b, 0xce51ae8cd59c2b1f, 0x490afb8383d72e2f, 0xad0e7859993cdc8d, 0x2212cd92ca695b7b, 0x26f722da0,
+0x60086f1b75f1fd99, 0xf85d1e257b8f2b74, 0x8fe95a6f50ca4bb8, 0x3f778f38455fa0c9, 0x7041a5e788d4a76e, 0x820e0d0e49243d65, 0x10b9248dabe3b0a0, 0xd10db2926ae734fe, 0x91894e776ec223d1, 0x26fd27926,
+0xeeb7b1945c2b18d9, 0xf8d26f6980e02c79, 0x45705b867b1813d1, 0x5934ba4a2696611f, 0xecccd5ccb4553dd2, 0x9fea020e809c07e, 0x96a0e55990cd5ec9, 0x9a5df3f18ac1fb14, 0x68b52e5442fb7bf3, 0x252670365,
+0xad35c535fe9cade3, 0x1895b69b77f621db, 0x482a7416db7d62f5, 0x6f4946b8715b2050, 0xa72856ee4ffab29, 0xa96cde425f397aad, 0x6ea18a066ab4a042, 0x7b2a02fbeeb026fc, 0x1b0aca4726a37d0e, 0x1f4519a44,
+0x9c369d5dff476a74, 0x5b024ca06574664a, 0x389a6499f765ce2c, 0xb1e8ba1e7914c1ce, 0x6d46e7c085759de6, 0xe8e78ed5ca1cdba5, 0x58da121cbb449cd6, 0x5a534e1c86f34abb, 0x9fd6a2f51594c0bf, 0x1b0207091,
+0x784a66100513919f, 0x4669f0ce0274b637, 0xb5b0710a01b1e8ad, 0x8ae0fc062a61706f, 0xdbce67f1d145715e, 0xe2ed594a108a0bfa, 0x2350c1f8fa60c8c1, 0xf001f6bea7e77512, 0x76755609f8febe9c, 0x124c3f3c5,
+0x6a1738ec8d065e61, 0xc68ed51c264ff31, 0x13cc1032cf1daaf7, 0x5544e21bcbea2188, 0x691002712dd65c4e, 0xd82d5948ead9b489, 0x36521cfa582bed2b, 0x249f2097273e3c9a, 0x2e79d795e4e6c80d, 0x46d79cd4,
+0x532a5200f8fc30e0, 0x9d2306b7e400dc89, 0x866eb1471607b096, 0xaf947967261895b, 0x371986feb93dd5fe, 0xec6ca44ed3612aa8, 0x3e48bd3b03e0dfeb, 0x15c817d525788ecf, 0x39d5d32c7e0e8649, 0x85e4ea53,
+0x502f18a18aa72017, 0x193a07ec49b20a6a, 0x6ffe145bd8a08421, 0x62b00249664c9494, 0x9470cd277a9041f, 0x520f0d31ce8fd6b3, 0xae86533f5b5d044c, 0xefe45b992c91e30, 0x69bec94e0c7b8885, 0x278e744bb,
+0xe79151baf9ec5699, 0x1084575185a923ba, 0xcba12b330eaedcb9, 0x8c9b8462fc4e6888, 0x3f50f1d6fa99c035, 0x7614359407db8291, 0x5a49586f3f2a2d0f, 0x7051a240da2b2cda, 0x403874438ce9fbef, 0x6713f768,
+0x55531b9c8b188d23, 0xcafdbd4be8ee4979, 0xbee4f41904c05452, 0x3c6e1bbffebab0c4, 0x7dbc22eea006ed3c, 0x74d9b6e7a521413d, 0xf2d0693dbdf9ce48, 0x9e0abd456f3cfeca, 0xec2bcd7c7a197867, 0x8813a24b,
+0xcdee508edb3b5f33, 0x26ea3639d81c0a14, 0x9600aaae289f374e, 0xd2c58db14242dce, 0x91c5c9b9643e3113, 0xc1b9bcd5833d4b25, 0x3919320f0b20cb42, 0xb39a8dd0536ce023, 0x579457205bd7a60f, 0xe27cf37,
+0x1b5bc73d107aa592, 0x9ebe7ca6ca142ca, 0x94216061a42b2b19, 0x62023b1e7d4ee319, 0xc22042b3d99ee891, 0xa7edba7de330c8ce, 0x5cfd6f3dae288cff, 0xe8960015ebe54703, 0x6ee40c4a5f0822f, 0xe5917370,
+0xd00be32796af2382, 0x9271395c9111f728, 0xdd470df53131b873, 0xfae0b0f2d84d66a6, 0x4649ff71895a7e58, 0xc09a5e7d95e5c361, 0xcff64767a7242b7a, 0x91b351df503479e1, 0x916f1a9840cee432, 0x26d41a788,
+0xb9c694aded07a680, 0xa049903c41338ef1, 0xb6781636ed28878d, 0x22b800895242b597, 0x859d060832b5c0cd, 0x91e54efa467c6c70, 0x7b9fa6ba6f4e8af6, 0xb16f64294e4f118b, 0x47e735ff049205e9, 0xd67c205d,
+0xdecb79c6c6508ce5, 0x3ee38d609469e087, 0x79bb292a9fbd4c14, 0x6b576e4d1747acd7, 0x8c6b289a4ce846cc, 0x12b944efc4d28ea2, 0x6b74bda16a88bde1, 0xb802517eb2d320a2, 0xd250f1df021865d7, 0xe01bb8d3,
+0xd42fc0328005462a, 0x1b7eff09c720b872, 0x89bd80d8446b19a3, 0xf0960e6a8cd00e96, 0x9474381983dd33ea, 0x9ad7b3c09b6a78fc, 0xf398deba3f1846a9, 0xc65ab7e0c2c2937, 0x3662d755b846b7f5, 0x53023fe6,
+0xfecedacc1cafd049, 0x8ed837940b263c0b, 0xaef19111f229c8a, 0x3cbb0365dff5f057, 0xd7538eb1b764d00d, 0x7cf1dfcb12994612, 0xb7da2666299bd2ef, 0xef04e0848332b67d, 0xd9fde02cc5bca45c, 0x12a46fa22,
+0x6a624ac33249a55d, 0x51eb6cec444fa57f, 0x6ee1baa4189c4fff, 0x411115ae837aa04c, 0xd84613a79ce05221, 0xdb566560879324c1, 0xe933b4a59c477daf, 0x10f1ae8ab489511f, 0xde5e1b6ff4ac9d69, 0x11fd6f489,
+0xb1cefaf0f15ed2e, 0x78f307f1b6ffeb69, 0x442e7b6c2ace95d5, 0x6fcd6747001d5dfd, 0xa4e45ee2566dbf40, 0x9d604259655c127c, 0xee48e88cefb77ba8, 0xbc4d9a95e25a2e44, 0x7909acc69c3c4834, 0xe4a6153f,
+0x5697d61b2cfb32ba, 0x8ee03474244a35e8, 0xc9971cde95437f7b, 0xc17a1d008ac63381, 0x7739c0baa3d03028, 0x1e3338e45d200815, 0x26963d2d743cb31e, 0xd6b6438c763788d8, 0x97c1e4b28899870f, 0xa74f21e8,
+0x99f54acb56185f68, 0x666d160a7c384f6a, 0x2701878010eee814, 0xefc07bbdf95c0344, 0xd1dd2c91dfc765f4, 0x5241e1de1ff5b92b, 0xf97b6d813f7bac82, 0x3abeb35c5199e9f7, 0xff3857828db8ffaf, 0x1a1a9fba3,
+0x568f0a1afe489206, 0xc198bd1bcacc886a, 0xc4085b213bcd7f4e, 0xc66bc40c7f1c180d, 0xdcec80237059e4b3, 0xa95b6a3d9e8a0e9b, 0xa78bb87507bcb1e9, 0x75eb35e0d24060c1, 0xbe02a7f1a9568799, 0x1c9af0162,
+0x31b39247518abb5f, 0xb9d30edcfdeb1a6a, 0xa4e144925e1e4fc, 0xbf86cad5772bb4c0, 0x547e184335dbaa8, 0xd27d7a78c98c1a5e, 0xfaf9e999baac0bd8, 0x14447a269cf7540d, 0x5ad743bc571286fa, 0x694e8ac7,
+0xb2a7bb2a9c1ebef2, 0x105d0a23fbb5f766, 0xa6759b322562ee0d, 0x3feec65390fb9af1, 0x6c6270b416d65647, 0x4c5699ee115bbf03, 0x1704d14d4418b7ea, 0xd06bf7128fc3d20d, 0xc05592269f3fa4f, 0x266b75c8e,
+0x2eaaf95be35fe72c, 0xfe1fff4d87a2c111, 0x921a55d7f093965, 0x9c26ae152f76eab2, 0xcbf0c914c22777ea, 0x49a4018d89dc84e3, 0xc13fe7825934f8fd, 0x477f26fcb9b8e0b3, 0x7bee7a16496afc41, 0x1ccb80c21,
+0x2feec62a34ce9261, 0xc6af9e12ce28fb9e, 0x58f112bce7156e16, 0x65793f09ab25434f, 0xf45f0fc9fdc65ba8, 0x885a16a968ff6f8a, 0x60af6ad4ae4efd80, 0x1fba852d87a19128, 0x7a2a22610b384885, 0x58183e32,
+0x3077171d397e6052, 0xa5329e9462ff5a85, 0x104f776c12ffc83e, 0xe3d1f44e622aba8e, 0xdbbc7e7061905ef1, 0x63955c01b3e72b11, 0x2434d5aef17e5a60, 0x74f2605c70a0836a, 0x9a0d1c442e35c5dd, 0x14677ea87,
+0x8393f5f4bcc1b1c, 0xe96dfee85baa9bda, 0x225ec7c8574931ce, 0xa3d7f3784b573cf7, 0x5d74554e0bc8c327, 0x9b83393ec44c3415, 0x378909f0c4597d99, 0xa15d3ca610a848af, 0xbadd308b78efe503, 0x72714611,
+0x5efddc34acc97dc0, 0xeb452c5bd9aef088, 0xfb4fb6ab577841ca, 0x824cc091c17292e6, 0x90479f2a35beba7, 0x5316ac9bc29d0b2, 0x4a263f7004105eed, 0x9952512d0a4136b, 0x10202f10a29dec2a, 0x10e369508,
+0x34613a6262f15326, 0xf6ea7dd0c6ff31a4, 0x7d9f3efe501a9c87, 0x3b63bb93c1e5df8c, 0xbb49b9fa136b3186, 0xff7516103fad85eb, 0x3cd7bade6a87118f, 0x3666e5a71fd4a999, 0x396a443d08a0fbf8, 0x1b5fe03a1,
+0x6495ca05d15b9769, 0x8b5e057ae57a503c, 0x14be9e9166bc19c8, 0x339d7e7745cf6104, 0x88ed23959ed914a4, 0xea3d96a0410ab502, 0x8239b1e43e040549, 0x730e7cceb77320cd, 0x46122510bacac7d6, 0xf3ec1678,
+0xda64213434f178d6, 0xad3a8e66fb2030dd, 0x3d01d59390254f64, 0x67e1f3ad6efc4940, 0x92431737dbe150b2, 0x22e152dc1352b661, 0xd15b456252fe8808, 0x3e5cc5ddb56888a4, 0x7f63f1491dfafa2a, 0xb1a4e102,
+0x76cf99cc09095a12, 0x92489c7e298a3462, 0xf6ee67c47f1e594b, 0xb90f23a695d079b8, 0xd0d16a580191c7, 0xcb6da82da120e084, 0x416b6f650d365892, 0xe6e9189317683392, 0x8a72b3f08a77af4, 0xa18be78a,
+0x9ef21c992080a54, 0x52e014b81fa728d6, 0x9615f5248d0ae110, 0x862a33efebf4f403, 0x7c6e277764f3a9, 0xaad880f3165ddc30, 0x20f073e35b322e59, 0x98e86b8b2b2d3cd3, 0x168de570d60b443b, 0xb449d3c,
+0x747767f42458234f, 0xb6e1b48cadd08c53, 0xd90add8665016100, 0x9579245185040ceb, 0xceaaf9d084d0a7db, 0x4a3808258f75add9, 0xc8a67be2be8ac7ff, 0xc6e77817474b65a3, 0x25ae41ba55591c77, 0xd3855f79,
+0xf1b2c8ffa5370aa4, 0xb2f1b217ae62c98d, 0x6f878b98eea99390, 0x13916fc43e028d13, 0x6ed3b4039d747128, 0xd79d209f8fe61b8a, 0x3f166999065c6a8f, 0xd1fb6cfc0288f1, 0xba6ffb29f7010858, 0x5d7e17f4,
+0x176f52662599b316, 0x583c78317ba102b9, 0x6d63646b4d208769, 0x2a1ff8303f144e62, 0x7b3a3c3d789047a1, 0x5e451da6b438fe62, 0x9b6be7d7a5a5c2f8, 0x43e8306e0e07911e, 0x8cc65e3bff378365, 0xd76227d8,
+0xa008558cc504140, 0x92fad9c74bfa117a, 0xebc8b90903cda4e8, 0xfe836de9c454f0e5, 0x43e00df5a225cb9d, 0x283d6d95db32085d, 0xecfca2b351affb68, 0xd075880d118d73a1, 0xb422917fd656db60, 0x1738cf422,
+0x436b8b65eb7804e, 0x2def973836dcddc6, 0x2b5f012beb00e18e, 0xeda8d669147e42d7, 0x78c40bd6fac1def0, 0x68d20c6ea26ff0f7, 0x1c7097f9cd649bce, 0x6ad900841357dab, 0x10492eb2605ec08f, 0x276b81265,
+0xa5794c00c4300a62, 0xeaf61069a3f02969, 0x12a894a7e0a66ad1, 0x5a4a4fde53c7db44, 0xe37b5a8b8e1a9bd0, 0x7140c313eb847486, 0xf1b00a0524308962, 0xe9744d1fdc6ef01e, 0x2b726475728473db, 0x1714f6c42,
+0x35771325b4a75be7, 0xde8004c2997cfb0f, 0xdf46ed5d3305bab3, 0xd13b7c38ae30b1ef, 0xdafd28e07d5862b3, 0x47511eeae6436f57, 0x258d4f228f5e225e, 0xe184372410de64bd, 0xd346b430e4aa9365, 0x39a61db8,
+0x910c52fa648777cf, 0xe8659cfe895efd4, 0x4152f0c4a585362f, 0x991d5e084b42e3fd, 0xbd07a84756d9e5aa, 0xacf0f37f59deae2b, 0x33ac090c878860d7, 0xdcd70b42dfaa0fe, 0x8b1dac5efe421e2d, 0x1c0e5866d,
+0x6ff0c62ba2402e24, 0x7dd86f2e0fde58d9, 0xf2dec37246ad9367, 0x33dfb73803f2d539, 0x28720a64032f92af, 0xfc96763b1015fefb, 0xf6a973e165980f72, 0xa29fdd6a25780cb7, 0xc5ba39b823e195c, 0xa25dcad4,
+0x467abf03450a0b5c, 0xa352bde21812c812, 0x232e14bda27469fe, 0x2f41fd4f0295d6ef, 0x5177c28a545724bf, 0x112c75cfb216c52c, 0xa8fd51e8b4af1165, 0x3c36faa4ea0f97e8, 0xadd93f94032d3d1c, 0x21b82fb39,
+0x4eec99f418fad59c, 0x678899d901d7f42a, 0x2d55aa5b5ae841fb, 0x5bb3ef09dfc9f47c, 0x1300fdbf15e1e66c, 0x44983b1e619b268e, 0x9faf544b1f450824, 0x272d0ff0da22d27f, 0x822e750e93ee263f, 0x15e81f471,
+0x7e235000484cb543, 0x446e71ca139bf6fd, 0x8e98b0ecf5fefdf8, 0x9436eb4402ebfe, 0x218a458e928cace3, 0x1e5486699a6f89fa, 0x5310b38158d811f3, 0x6bb6017fcb58e709, 0x602af1e7ed4a8ff4, 0x5411fc30,
+0x4580654bbc86fce, 0x51c6887a09d136e0, 0x5d68ba9434264bc9, 0x92366a19c85b07a1, 0x8378e89b831fb38e, 0x9639ca89d9441820, 0x9396c70c0c9b1bd4, 0x2e8d787384a15d18, 0x874c9a0b8b71d3b1, 0x1ac4edb7c,
+0xc69e17d2718fe411, 0xc1e4dba26167adc2, 0x6d656db6dd7b0787, 0x642daaceb8fc508a, 0x25cdd2b177a832a4, 0x3e2039722c2bdf89, 0xfb70d77517c3e69d, 0x70163bcfe767a588, 0xe023f58a353b6524, 0x5eb08d41,
+0x6a7e5f7208aa7af0, 0x63cf5af0e28e6e56, 0xd26b2b24a9606f5a, 0x6612cd622ec17adc, 0x6f09626d4a6b9d73, 0xf2a96ba2444e2d31, 0x212d56e880b90f1c, 0x31981be9c9c84e27, 0xb7aae4e9f3183f, 0x244750b9a,
+0x5f1a0445061b4b60, 0x6aaf885c315a7e07, 0xf02f2ebb3bb85595, 0x144170e4254599e0, 0x7746fc273d51a63e, 0x81426a26d28f5aab, 0xdbad41ecb108f35f, 0x7db903f303717e39, 0x4da0fd7b9be1de1c, 0x203b53b06,
+0x3b5019c77b6fef49, 0xa3e660d5936c2189, 0xb4e1394053645c85, 0xd178370ce1d262f6, 0x4f334a47d31a1b60, 0xaf5e11743d0737a5, 0xa8f07cf4c230edbe, 0x48a68a4dfb04a75b, 0xd51ec44dd9ce7d32, 0x131d37718,
+0x7c540ba14159a6a6, 0x16958e72a45e4598, 0xdd2b8df3bdd5f6aa, 0x82096d81e06f3f06, 0x525bc5f4de7ccd60, 0xa784633c76275229, 0xb7eb82691eb35741, 0x493db2e3e4984d9, 0xc6b5a2866f754d98, 0x53e64a09,
+0xc2acd480dd97eac1, 0xeb60de07bbed05ca, 0xb712d52e61634a03, 0x2e3c0df3cf58a30e, 0xe459f58a4d59916f, 0xe7be80843c01faa5, 0xdc447151bbe71c8a, 0x66a704cb9ab03f72, 0x6c40d395b4fad9fd, 0x86b2b7d3,
+0xb7a09a33019ee603, 0x3f6a5436c9e85b28, 0x4a072b4b502706f2, 0xccf95dc9eadf04b1, 0x9d22c106dcda1edb, 0x84976b9eb73959ae, 0xb5cdb30c35a1914, 0x1036b08162e8377, 0xb29753e7c0a9f453, 0x26b185bcf,
+0x8d83721554971e92, 0xbb1d1a9dcc7cb38d, 0x80b40f0f66de08c, 0x84a17b23aa3e7bee, 0xef22bd18a8f2c0ab, 0xb9c3f195d74e4cc6, 0x4a168fa6bb3b6e1f, 0xa98d1a82ed6b1d3d, 0x8ca9f330628b702a, 0x18ab6299c,
+0xedb2d7c9c2875e62, 0x947c4fc10d2994d0, 0x6a3a6e3f6cbd4b0e, 0x2eafdf18034ec7e5, 0x167cec541d709f58, 0x5e667eb719c8e559, 0x23ca8f183393c864, 0x6aa7569dd64b422d, 0xf40014f70049e8f4, 0x35863fdc,
+0x4607d99419b9a3ea, 0x8aa5b8c007dc8bd0, 0x322aaa42afa497f9, 0x5591b837841d655, 0xf193b948bf7431e, 0xf4700957b81816ee, 0x5991c3225383c8e6, 0xf49fbe2fe496bed6, 0xe167a3edcc3a4512, 0x150e25ea9,
+0x20a7b0e9ef664b11, 0xe00328d2960f2f57, 0x70a2b5a8483b6852, 0xe77cb0074722caa3, 0xf759bf8ef5232a89, 0xa39fbfa981760169, 0x997eb02a27bed847, 0xc633447935f7063d, 0x4084cc2f5e1ef25f, 0x23814b745,
+0x74d15798855a3876, 0x6333a2616da54a6, 0x7309ef484525e69e, 0x7450deabd6776fee, 0x55a699eb9c3ac312, 0xbab99c999f79a7bc, 0x6dee323427be056d, 0x134be6453e9fc512, 0x8fd987e7c56fdd49, 0xd94316a3,
+0x64e83521acf624c2, 0xf71892b83fbe9933, 0xb8da55381cff7b12, 0xfaa138fcece1d6d7, 0xc136e04dfaefebbe, 0xcd31d677045261c6, 0x9a52de805b49bac, 0x34957a5bd97f6b6d, 0x611dc8fa05e1e154, 0x2024fc48,
+0x72c00d077965e2ea, 0xbf84a9983bbcc967, 0xab59115e6de8127b, 0x483e1ddd47c52349, 0x7ae159edaf6a0153, 0xe781f0e0b4e421dd, 0xdec47b70ffac991f, 0x72b82260d031089d, 0xa11dc27d125b1730, 0xd0ccd3cb,
+0xe699aa51b1c7ee89, 0x69b0ddf0877acee, 0x236d47a42471597b, 0x74bbca43f6359cf3, 0x30a9ced64f1c3910, 0x866afff3a2dcc5d5, 0x9b17ddc636613a22, 0x1fd52f8137224b4, 0x96ba6c6f112e7113, 0x21a629b98,
+0xfcff12bd4f2f2bdb, 0x7c7845d38b2a7770, 0xcb2d356390b4b6b5, 0xd849b8515c43fbe7, 0xee5c4170c75bd5b8, 0x80b3a42ccc57e1d7, 0x9adcf9ddfbee9b85, 0xa25f98db3e4f21b1, 0xcc953b862d8c09, 0x25215198d,
+0xa988b547118aa360, 0x904d0c6dcb0d1bb8, 0x86f00ad387bdbc3c, 0x1a2af73878b1b8ef, 0xbdd3066ae3b81d29, 0x6d88d5eba3cc936c, 0x9537735a85029f71, 0x28587f5907f85bf0, 0x942f5839e1b6eae5, 0xe90985a8,
+0x8cc72c6dfd110b84, 0x7504021b6dc990e0, 0x338abccfeaffc3be, 0x3948d86d49a96130, 0xa8efdc80f9bf9691, 0x625de28623c5d3bf, 0x98e39eb953c07701, 0x76ceee01e5de8941, 0xac495e311de49071, 0x3348e34,
+0x9894fb65254a7f9f, 0xa7ff25e2a08c87a4, 0xbf418de3d9d70020, 0x9216b0ea418dd8c5, 0x1425ed01a480bb27, 0x1fdceb0362dd9ba1, 0x22628dd8d76f593, 0x71ff78f2d4438e03, 0x8169844e27fa0406, 0x2376a8c56,
+0xaeae60d35fd4d576, 0x79c4bf5d70946cb6, 0x4fd46a261a8c6338, 0x900568f71ae9caf3, 0x16fa0cc6a7ec62a5, 0x6f2aa6964e6ae4d1, 0xe869ab16a9d94fd2, 0x664442293c505ea2, 0x6fa32f9cfc25c1f2, 0x388be179,
+0xa0ee42c164647f9a, 0x8d8d9ede7215b96c, 0x7288934622e1903f, 0xfeae7e5b52aa500a, 0xabf1afd97bb84975, 0xbe699ae8f3144e52, 0x6491731cf4abdee1, 0xf0f56c9bc172aca3, 0xd06eb1c6bd8591cb, 0x1ee6f769e,
+0x2b3350d31506b6b5, 0x26c9b023a3da6313, 0x2325ac59e025deb8, 0x68459e04be457623, 0x6c01634556790637, 0x60cd75bfa5a6ca3f, 0xfb3dbdc208f86e82, 0x73222a85e146e2d8, 0x204d9547368d6b6d, 0x1f63d214f,
+0xe6900978d84981f4, 0x1d5fe9192dbb1b2b, 0xe80edd1d58c1904c, 0xc983cdfcd0ac5f, 0x3a3810cddf3aaaa8, 0x6610db36383207d6, 0x1481d1b1274c55fb, 0x48037e63cf059965, 0x56bb7096fb31f3a3, 0x641604b6,
+0x43ce2c7cf304ce0a, 0x67f0966380ed8cf9, 0x5f08c8ee5a48f81a, 0xacf957985caf292e, 0x584bc0b00cab4e6b, 0xc23c44769842e8af, 0x5c9ae840505c8393, 0x12120b692b8917cf, 0xe87497e8f9da951d, 0x1ab92324d,
+0xfa211674d0686b68, 0xfbcd81aa7969e4a2, 0x826eec94c92fd497, 0xbc8135901c89a521, 0xe73669939a3f18f5, 0x2310003369a790d0, 0x2a441f812c4feab6, 0xe5c3190cc38a2a82, 0xb5e1245388a87c8c, 0x1328824a3,
+0x3af3a7f17decc80d, 0x1878f16f7534a65a, 0xd801b65ec3727002, 0x4b2750ca6bc58c14, 0xd117261df81c9202, 0xcc692c13e1c1472a, 0xe3dff0ed630014f9, 0x5bbe7c429d2ec828, 0x587be41066d0fcd7, 0x2514e5414,
+0x7ac0e72465d90c24, 0x26d2884ce4ca120a, 0x120a3c87a5a2eb93, 0x1b50ab804f4a5a04, 0xf4a9b1e52762ed6c, 0xa243f11bbb55fa33, 0xa0db594f3abccd02, 0x8e6856f352873bc3, 0xbc34b709610756d5, 0x18a4805e4,
+0x29b18a7faab486f1, 0x249934b2ab54ee12, 0x46495d4e13536b4e, 0xb5ff31d61fdad878, 0x79a33080556f4369, 0xd2f954ef45f6db3b, 0x58ec5f16bdf0df01, 0x991f5181545772c3, 0x432b6ad47d8983b2, 0x12a52a208,
+0x4f690a5818b3209b, 0x83bedc878e39491f, 0xa21436dadc78fed5, 0xb783b748f77f2531, 0x34db908583005f02, 0x4f1380c4bf0a750f, 0x4d12575df8459567, 0x7f4631eab9e58c18, 0x1059543ad30df55d, 0x215034a75,
+0xd1d2953fab13b7b7, 0xd37e867121b40c6e, 0xb5f957156dcf05bc, 0x3674ec04330141e4, 0xf95f28936d7bfeb6, 0x3bfa8919866fa83a, 0xaefaccd8eb2e3d0, 0xf82a1f79e6ab6317, 0x1ba87d8a3cc283be, 0x13d4d630d,
+0x31666a79598dc6fd, 0x5c06b3312984156c, 0x8b12bd5d87e7d9b6, 0x8335f458ad8cf7d9, 0x341f5a9d3636503a, 0x903afa4f81c66052, 0x3abc80041170b16, 0x4b40d917106e4be6, 0x8e1334d0992e5071, 0x23a6c8ec6,
+0xb1b5c995b1e56967, 0xe4da73ab3440fd92, 0xccfec968fea5be62, 0xb495d42487bdb86b, 0xf6984f1421a5204, 0xf88aedd9b8f17ce8, 0xe481d1a23387a51b, 0x5fb496be6b002bb9, 0x2b168a2af947268b, 0x13632966c,
+0x40a5ddb29419d09, 0x36ee9c25b713baa5, 0x2f0c4ad5d5b4a12c, 0x3cf6467bfeae6e38, 0xeceee94c9ffbd25, 0x26d1d7cb0f5a13f6, 0x6c1c0922e9d9de04, 0xf5b4177b1e68ab5d, 0x689d268227100f7b, 0x1e04a1c2d,
+0xbf0f91d4178a8f80, 0x90ec6235df13ed23, 0xd6283e1e34a7e10e, 0xc1efa1d53c93f69e, 0x3a417a8dc5fbc410, 0xa1c1b786cf0b23f5, 0x8d87070f287346a0, 0xbc076b1f941acb80, 0xaae02d2748755110, 0x1d00a795d,
+0x3bf41cc19b8206b8, 0x9d581e2f60a1059, 0x1e8926336fd7c0cd, 0xcd22304371da4582, 0x2bc4de8974c54385, 0x659478a9b5f7f995, 0xd22a089053721e0c, 0x5187d429157898e2, 0x4142fa3b10c8daf, 0x15d42005b,
+0xcb02d328e19cadfa, 0x41911a1050d81cde, 0x7151fbb5a466f06f, 0x69072ae84d2924d0, 0x5249e227c45d054d, 0x117ad302fb070be0, 0x993d1481c6b8111e, 0xbf5fdb75e72e0b63, 0x533962645a692d30, 0x212e06cb1,
+0x4151c3ccc4f47c69, 0xb8b050930cfc1306, 0x4a67af14a8e9b54a, 0x641e36da40079052, 0x48d5fa77dd5bc4a9, 0xfda7cec6a51047a0, 0xfbc8410992ed8155, 0x51593ddc3a9d4b56, 0xb207309412a89ebd, 0x43a000c,
+0x3bfbb98e4ec05495, 0x38cf27d9ef6c181e, 0x5fc8af6542e28b92, 0xb78dab93d5d71424, 0x9978f3bb8d18ec64, 0xc2c1c538e3d5b317, 0xafba9e9015337590, 0x50d3b9a1131451af, 0x5107f79ce56b1f61, 0x1680ad75f,
+0x5d9ebeabf882584c, 0x7487b8d325bcdbe0, 0x7c8557effcae64c2, 0xc88b0bef0bbe4c6d, 0x3a24424f61ed2953, 0xa60454e11a3c84c7, 0x7e9ab60589eda184, 0x5189932bd4331e7b, 0x751301696f510d00, 0xbf1fef1c,
+0xaeb79bb198ae007f, 0xe7c1ce53ee2fd383, 0xb69116a358369787, 0xc10f2de13f421fcd, 0x23f2006bc017e6bf, 0x7e55223de76b1745, 0x6f217eb72143ba61, 0x947f60f6692b0561, 0xbcf9fbef454854d5, 0x14bf0fe23,
+0x80993fd36c7dd101, 0x7b317ac5c1f12a44, 0x26a3f4108388fd1f, 0x9e04a5eff6fb261, 0xd144a548d6169a18, 0x330f2ac0106de152, 0x3d94bebb892b73be, 0xa9ab1a29d702eabe, 0x7680e76483589d67, 0x3ec7385,
+0x41d1a5eb390cc5de, 0xea3cc8e6754c01eb, 0x927bf893812d5464, 0x4c70b8afac38733f, 0x19a34d78f5798e2f, 0xb49a40e7c5a8aa78, 0x2acd7767a14ac936, 0x6cc11cac286b5975, 0x8d6fba63cac69906, 0x1c370889f,
+0xcdfd487e74d04ad7, 0x281ad2293496564b, 0xa2a9bb835aee9d, 0x71823f625d07cbda, 0xf0cddd23eb604671, 0x9728b0055a8b8598, 0x5c2e79ab69f82dd0, 0x9dbb93e84466ee2, 0xecc6ad8f14a42f73, 0x25f1aeded,
+0xa1fb34ff08a4a672, 0x40ef2cf21966f55d, 0x9c2cac6a2a85f83, 0x52a944ceb9e416a1, 0x545c5e8c1bde900a, 0x195ac7f4f97899e5, 0x113c5c77ba247ac4, 0xaa1fca98f70d813, 0x4d5182c24ff69a8b, 0x4072d9d7,
+0x81506187296ce48a, 0xe9a8d2fe16115e09, 0x6d13a1a324d573f1, 0xe6744e6ced80ace5, 0x3f082f5850052dfd, 0xdc807794a6d988b3, 0x2463d8fc5dbe8005, 0x1320ffb3cd886bb, 0x4a7b71d108dd3d6a, 0x2f56cc35,
+0x38c3364345374a95, 0xd2a88b792e5ca4c2, 0x9c825af94ae245b8, 0xac333067008d31c4, 0x679a3cd01ac6de79, 0x6478ee8354e8d900, 0xc5b5b4054f5ffeab, 0xe03100946115f429, 0x9b3632aa9d0762c1, 0xde9f69de,
+0x98325d0e52d02be2, 0xfec3aa65d3f5614f, 0x5721522731c8409d, 0x9be578e661a70026, 0x7310531a888d9934, 0x40a819eee83f1fb1, 0xdb8104fa8c2d83d4, 0x118d49d2ddef819b, 0xd8da00de6eb0c05d, 0x93d4c19d,
+0x7de7f47506614e6e, 0xdba72b11703c5d6, 0x15494b88ea5eea2, 0x389204ad17840f43, 0xc701940a76ca7f8a, 0x97689c159328de1f, 0xc018924712e65fad, 0x3e788ff58b963e70, 0xe6236103391f26c1, 0x1d5ac024f,
+0xcd9d8b3ffc218ef8, 0x3eb97a213d0c2e13, 0x48e63cb04e5d6859, 0x686d70c2ebdb7a7, 0x17392948ce09aca9, 0x3d24b160f585f53b, 0xa5ca658e81bfa277, 0x6d41b2dce3a0a202, 0x6a9c2d85ac9dd866, 0x22c10e066,
+0xaeef58b1dcdfeb4c, 0xbe6c294988411fbe, 0x72cd6184ee10bd2c, 0xa12084a04772ab39, 0x30e295ca76c151c2, 0x925d50e0d35603f1, 0x3747d47a06c180c0, 0x5e67b4c8a5a99ca8, 0x94f933e475433929, 0x70e24287,
+0x89e01487d904998c, 0x523f0b37ea60e2cc, 0xce9f8c709a552636, 0xc28893010aaf315e, 0x912c89b30a75cff6, 0xbf812ae60104b2d1, 0xf338e3d9fc43f0d8, 0xb8124d5969445e05, 0x47ec9ebb594552b3, 0x18406dc60,
+0x110bfad800d0c0eb, 0x4b23d885af54946f, 0x287927f6b9f79a93, 0x8bf51aca23252a80, 0xd2133644066077ff, 0x91d3466fddfcbc38, 0xcdb8be29a09a69bf, 0x84e2e52aa6f4eeaf, 0xf538aa5bea8e50ea, 0x157aafa82,
+0xb5239633cd90f074, 0x9ccc576db0fd395b, 0xd20cf8741b3f54d7, 0x99c3f58d6e83cd18, 0xa6f8b3d9e2a4af4, 0xfe8a12dfe1a41fce, 0x1c057e5d28eee744, 0x6707222f715aed6d, 0xcf06fbcfc7438dc2, 0xfd3cfbcf,
+0xaba68e9eeb0245c1, 0x96086a7e9a790330, 0x60447189ebc08807, 0x8e911bb32a4593f9, 0xfaec3125d45fe024, 0x5a8d872a204defc, 0x709e24cfc7975984, 0xa833434edd5cc2af, 0x3fad65e971850185, 0x201bf1247,
+0xa429ad810aa36f97, 0xf9c010401351febd, 0x217cbbf28266d01e, 0xed8052d179d71296, 0xa395b911323f6e60, 0x3c4d61fd16fbfab9, 0x956f461957502d2a, 0x1b85356f702d70df, 0x9a9613408f1cbaf3, 0x778a7533,
+0xa1e7275c3705988d, 0xc4c007356916e186, 0x4a6d968637d0202, 0x1b4e7b1a18e683eb, 0x82c0766222de8238, 0xf31cac65de3f7cb7, 0x69214ae9db86db80, 0xcfd8d4307997720e, 0x48568d0539932253, 0x839c4a22,
+0xe8cd506db6f5b3be, 0x67644b937952ca4e, 0xda34447d62b77552, 0xeeac09b765c8e293, 0xd876fbd5b77c7164, 0xfba7fa89ae208fd3, 0xfe6e228fa49158ed, 0xe9c773181d422241, 0xc1e70d5f46db91c4, 0x16c7357ed,
+0xdc9425afa5a0a522, 0xb04a84a0b47145c0, 0x36304502b06591f0, 0x95a6b99d032c49b3, 0x2494ec0e4abacb1a, 0xdc9be4d76a335d32, 0xefb53eaefcdda821, 0x67e4925396436f56, 0xaec2e6e819ceb4d4, 0x24d5cfc9a,
+0xb06adb7055ee45c6, 0xc335eb1c4b56aae7, 0x6313af5b10414d54, 0xca7b520b8471066f, 0x2a8a22ff61969f3e, 0x1580316a7fd1c00c, 0xe347df14b0ceaf68, 0x8073fee251abf01, 0x3454db7b5ecbe8d9, 0x16f258f7,
+0x3a128f4b8eded5a0, 0xcc4dd76a6ea8bfc3, 0x22f7aeaa8cb86658, 0xf050f0ef9635aca1, 0x759863e237e1161a, 0x8352034f99ca0695, 0xa2de913e9d605c, 0x7ba889dd2b270b19, 0xb7ccf8c4e4d3bfcf, 0x33434af6,
+0xdb897b075114a666, 0xdfc3b78673830585, 0x6591269d6433d3f0, 0x1b48f79fc6283f48, 0x67a94208014832b9, 0x2b8d25abbd43c656, 0x659bd79f8a839aec, 0x642b1ec233ad0a4c, 0xbdf43d46d7df7cba, 0x269a140e9,
+0xc852f48060f94760, 0x5e912f848daf9f6a, 0xedfe885ac3d5cd2, 0xa1afa065cd62ae5d, 0x3e6a8ba68f6a41cf, 0xfc472be032d91824, 0xea874169b3f606f1, 0xc739fdfdb6246097, 0xaaba79854e8ac08e, 0x214dbbf80,
+0x82419a59b3db3e98, 0xd8bb04808ad5cc7c, 0x50e367b1ebfb51d5, 0x808b6589ce1ea610, 0xf1d7432726321200, 0xdbac1d97f1482016, 0xf3751a86e4ecf7db, 0xe4b56f7fa568d092, 0xe16d155a401adfee, 0x280e4e3c,
+0x9881e73eecdcf27d, 0x821e41f0907af8da, 0x9f5c004cd6b468b7, 0x74c4b28218fab, 0xe5024605550a3496, 0x2e0207092f825797, 0x7903cf0443d3a9f4, 0xca75f7b8ad87bc90, 0xa6e8de025183cf0e, 0xc1912b02,
+0x4a60cb42e4427a0c, 0xbc9cc966444bb50a, 0xc0ec797af065b90e, 0x728edb20476e8788, 0x8cdd5c6b5af67f44, 0xc9a8e34f21b34e96, 0x8f866bc180f6ec7, 0xbb416f50d5c52e2, 0x64b1236cb32b843a, 0x21315320f,
+0xdda42b038b061da1, 0xf6f752cb6af4be19, 0x868b4168fa0b3d6b, 0xe4be87f256d5569f, 0xb6cafe6482cb4131, 0x5f2f345150af4539, 0x5fc27f1778728413, 0xbbf1bfbeaf80c4b5, 0x9b17b1e16b9af330, 0x26f3fafad,
+0xf749d925ba2d27d3, 0xc30fdc8f0fb850fb, 0xbb86b99045d9851b, 0xf3a6f3e61af2d306, 0xa4c928eb5ec97576, 0x9e1536ac03a79152, 0x3b85c5b95a34a5df, 0x8c90b2535b91c4c8, 0xab9780cb3839a2c7, 0x14390fedf,
+0x4794e774e5b45064, 0x51a639cb6cf1d527, 0x15daa8d4c29568b4, 0xdbff0faed9388b16, 0xf4f35207c5466cdc, 0xe804436a5c30b652, 0x775c05549ba98aa3, 0x4a06762738372731, 0xa0d8a6cc9035ec0, 0xf5370601,
+0xa1ebd68d325c7dd7, 0xbe76e5d188760f7, 0x268248fe79be8b, 0xbeb7dc943b9e9a0b, 0xa6ceab237e78018c, 0xe5bbbd61ee3b5812, 0xba942a2800592516, 0x5b9bb0b28044b1f5, 0x18e8fad263e991fe, 0x2707a96c3,
+0x8403911cb54ddfed, 0x8cd41d1f602831d4, 0xc76325ec86333192, 0x6ec52c59b4b7f68a, 0x625a900b98563d02, 0x714e20676ded2440, 0x3224bb1995919e8f, 0x3f6dc62b58503ffd, 0x31c0c27fb36eef00, 0x25d3be6de,
+0x72a1b1d36d26fe36, 0xed8ecd017596096a, 0x2feee0781a391dc1, 0xc8c3e0375af307a3, 0xa7d312d1270c3d08, 0x67a567ad6a94cd9a, 0xd333c3a49c834d1f, 0x913d4a98be7dfad9, 0x25884dda328fd7c0, 0x8a6237bf,
+0x3a21113027dfa574, 0x6a255c9ad0d6871f, 0x241deeb31c80a503, 0xc2ee6400aaa4c703, 0x7c0ca1c38c4ab9b7, 0x2f29ebecfacb0ef4, 0xaa6e0445a9363029, 0x3a34bf8a345eaae6, 0xe1ac875df7641105, 0x2610180c7,
+0x76c4dc7cd375966f, 0xefc959f018559b0a, 0x91240cebc03084d6, 0xd63246dc865aa9d8, 0xb86ebadbb0e7bdf2, 0x38a57994a0087ec2, 0x4e9f557c043a9380, 0xfb3af3d4b590bf0d, 0xdfb4d8694bc4db9d, 0x12e9c179e,
+0x40d44ef8f1af187f, 0x52c5da08c5e707bd, 0x31df109ce8f505e0, 0x8d46c580a31a2230, 0xca0fd78484ea783, 0x6dfd4569eeb401f, 0xd030570f9bb02b00, 0x94935f282b27558a, 0x3c057377697ecec, 0x241b00fce,
+0xda7181c3056e5ee5, 0xb37d6b68a8ca7413, 0x2b7c09eb0c0c0045, 0x2d92e8b39fbd7ca3, 0xb1cc3ef33c5fe5cc, 0xf503a31afff6f533, 0x3d379dcc9b739833, 0xb807ba459e33364a, 0xcd5402cbe8d11c82, 0x2064b6944,
+0x91b265aec28e0522, 0x2fe077e8b55e3fb2, 0xb1e54118e45d108d, 0xd494c97a5b39fe66, 0x78e15b736d21044a, 0xa61161a2977e0c5c, 0xb9ab453ca1266cd8, 0xfa47b78a7a8af936, 0x85cf4c66bee1fa63, 0x24d84030a,
+0xf3ff9b454fa69e96, 0x282fa5851a530635, 0xe879a08dc26f5f66, 0x855a5ec152567020, 0x289c461020a76887, 0x14079b7464f42975, 0x2c9f545174a12fcf, 0xb2c1cfe0812e2d73, 0x35364627811b01e4, 0x195164a7c,
+0x367357aa36163861, 0xeec19d6111f1f517, 0x71f207f9778c2b7b, 0x683033d0dce9fff7, 0x8620e75a62837e6, 0xd240076580902cfc, 0x9fb1f72232891ec7, 0xb1fcdd0d266f91ec, 0xf1b43e2c84b215aa, 0x1d57a84a1,
+0xd1ca5535d43b59a1, 0xd818cbe7d0b3b863, 0xbb16bc18800605ce, 0x9c179086b1c0011b, 0x94b3457360ee56f2, 0x20f4ccc11cff277d, 0x2fc77740217960e0, 0x188b84a54326543e, 0xd02f6f2d7314d582, 0x255b5fdcd,
+0x429fa8ce4d45609a, 0xbfadd1db0df1bbbd, 0xa8e7742fd2186e74, 0x2878c5ac6857a57, 0x51740843d254dfa4, 0xda7aa37bde9b15ef, 0xc16d905839e90127, 0x5a658dd347345f7c, 0x23acae790aaa6296, 0x1f2b4564d,
+0x8a2f72b7de4def7, 0x7dfc993075f2bded, 0xf50f7e56e6667800, 0xbd0c545b1b28d829, 0x9b3bcf996f8be16, 0xc544c2c09723b6d4, 0x8f95b49d2e37e707, 0x48818ce351067943, 0x369a3eba9e9a4080, 0x1384b7055,
+0x76d302f214db03cf, 0x9cee33e6829f546a, 0x44d537fd109229f4, 0x31f0934104ba9bbb, 0x796a262657dae7c8, 0x9b5f4d1ae1c3a608, 0xaa25b23df40fa66d, 0xe0aee32df9e1b8d9, 0x69fefe2069ab25b8, 0x174343d24,
+0xc4120280bfdcc77b, 0xf62bbfdffe5c92f3, 0xb83ac7033b25f930, 0x9f05d6c6f981252b, 0xe1d03993cf49c9b, 0xd803cde2f049612, 0x21ce24b51cf62bb9, 0x6c82cd1225810e15, 0x497005819b21cd13, 0x1133574b0,
+0xb2ef687e08c1eb67, 0xc97e24cae096a2bc, 0xc0084bf601e8d0e9, 0x66f7f1f9558eaf26, 0xfda1b96c51e9888, 0x675fb656c5262a, 0x5b562bec08c4a94c, 0x1f1f2cd188a9c75c, 0x7db9ca21c29c1f10, 0x47329c66,
+0x1a03ce6369c2de08, 0x87b049852332aa7c, 0x441c64c9441d13ec, 0x41e644eefc59e612, 0x55d2cb89210175de, 0x7906df785d63bc64, 0xd03c2a6bbcb04fe5, 0xb4746f77e887b979, 0x422f1f3744334dfb, 0x17bd63cf7,
+0x31eb835334f389ce, 0x61c65ba89f03a773, 0xd0740588108e4ee7, 0xef051d503646648c, 0x6fb6925f734ef14, 0xc3a9c52888587562, 0x48b75e970194ecc5, 0xbc76a547777eb891, 0x77435d9b6422fecd, 0xe495c2e5,
+0xf8f76fa906ab9d90, 0x6760e23e905aefa3, 0xe6ffbc992d1119c6, 0xde840bd3812a8ae9, 0x507980c306025bd8, 0x5aa3fcaa0d954489, 0xe148bb49a5bf5f55, 0xcf8ac77ea20702fd, 0xfe133009bda3cc, 0x96a0cd67,
+0x788df73fc0e7c4df, 0xdbebd7ab4dc14383, 0xe6c0c095eb9c61d9, 0xb8a1a858bc131f99, 0xd40b44d01523f5ef, 0x5035e267e97b7de8, 0x163b568995e72d9f, 0x4c294dcd201b1874, 0x40549f6c4bf36e26, 0x1c4a34f84,
+0x9bac0c3d78679fdd, 0x3d065d575d0d62e1, 0x90666761ebc1b1bf, 0xf3dd2d867879aa67, 0x847a980d96793946, 0xc7111ef1c1fd1e2d, 0x93379f2fdf476aae, 0x375a737beddb5530, 0xc104c935bdd7a24, 0x21d018936,
+0x72320185199118dd, 0xbc2fa39c24c18583, 0x19b6a6962f1acae9, 0xf9c077a6798757eb, 0x3f5fa56c960368b9, 0xda22ec5acd1098c, 0x95daa602987dfb07, 0x6c5baf8bb5cf18db, 0xc107f1bd42c56e8f, 0x242b2632d,
+0xf8df317586961708, 0xf617aa119624c855, 0x18e742988bae72e3, 0x11175f245ec70a40, 0xc9b23de0446b73ed, 0x24a5d80c00374630, 0x2d865510c716b2af, 0x21d6f8ecc3dc7ce8, 0x6f00c82fa8e570b9, 0x1756b82e6,
+0xe4eb91ca66f5a111, 0x3a786888c57aec52, 0x3074ad0a863ad11e, 0x5abbafea5c7ad707, 0x72d64199089b0e2f, 0x94013b2644c7e98e, 0x3abc31c8f342efa0, 0xf112524510145c8c, 0x7eb91be2eb4bf1b, 0x27a60996,
+0x2190d7c96790617, 0x282201a22868cfb0, 0x43044a6bdde7a8c8, 0x505582a1d535ce16, 0x313667565e244e69, 0x98bf58dfbfcd1184, 0xccf6c20bd11e51f6, 0x45512f0443fd3af3, 0x70ad6b85b68b3bc3, 0x71d37f8e,
+0xce3d7f1e99bda446, 0x1b08f6784581b8f3, 0x1552d36d795e61db, 0xd05ebe2f9ee61dcc, 0x44dd0c93b4cd665e, 0xa9811b611f976257, 0x755920fa82d6b3a7, 0xb6ab81b7aec55cc4, 0x1be1452d34eb517c, 0x17d87dfa8,
+0xb1178c0b2d0bfc7a, 0x516022756aa2bbab, 0x657e612f203eb05b, 0xb4bf7d84cab3f63d, 0x52a79541b53995f0, 0x431ef00c7dddf09, 0x3621904839a513c0, 0x4fc0de025287a4c9, 0x1b09fc7fda458865, 0x2207b66f2,
+0x8906844ce9d979ce, 0xd8bc449351a3f14, 0xbce41ae6cc78fcba, 0xf65aca6d0102cbb7, 0xa624445cb42d414f, 0x59a58ceb6a09a8cb, 0xb01a252403e7ca39, 0xdc5235c28966f1e9, 0xa2460d8f03031dc3, 0xe24338c6,
+0xf19de6afee1ccfdd, 0x33931d06eeaf0363, 0x30fffd68bb28c601, 0x3a3ec83d70a97cbb, 0x48f485ba605ed586, 0x8200ac3306965f37, 0xdd68e95a045418fa, 0x2ebf2ebd5e125b05, 0x605973f4036ebec3, 0x1b817dc10,
+0xb61440377bf2e64f, 0x1ea61452aaf3e725, 0xc1e68541496066f1, 0xf95aba67bcf472ab, 0x3455b6e844a85b13, 0xc7a8eda94a21a3a8, 0x3858221be16f5808, 0x491ced69c09f1474, 0xf26ec473823c3033, 0x10d827503,
+0x44c776574152a652, 0x3fa8a16ecd4b898b, 0xeaefdb21000299dd, 0x6d3892d16234264d, 0x19feca3327e9ef5d, 0x3931efacb1ea1072, 0xfd6bdd2c8f623d9c, 0xcc5fbcaa1f718974, 0xde22b3f961f0f920, 0xa4fc5fb7,
+0x642b90a71d812bce, 0x4500cc060cad0b8d, 0x845154be8002ec2a, 0x1f8945c4854d3271, 0x418e32a6d33d09fa, 0x8246249c0ef6d438, 0x574b5aa98780cce6, 0xe6f49ea21aac7855, 0x21dc9cb9165f026c, 0x1b350c512,
+0x9d45c4cb5da0b6eb, 0x75e542ce32eaa6df, 0x4bfcc3f04e5de4a8, 0xd3ecfd477529b3b1, 0x2a81b759260fc973, 0x5046473487a8870a, 0xdd11bf0bb08716a6, 0xade3fe89d1cb9d7a, 0x73b7904d14994405, 0xf80b1cc5,
+0x1f741029e3b5a666, 0x1e8f65a147bcdf45, 0xa29498f89eab584c, 0xdc6bb775d4fdaf8e, 0xfe68fde1d42a22ff, 0x5162f4ba980817b8, 0x88ddfc680b5c5fef, 0x9d517d047fa2dd92, 0xf1e02af790a1ea7a, 0x1bf127161,
+0xc584194bdc30180, 0x7a231964e62cdf7a, 0x13abe65b498a8c11, 0xddd0ec8f478e1c79, 0x164ecdb22cba7055, 0x6a0277d6b54a1f33, 0xc6e4c34038895043, 0xd4be5969f025e3c9, 0x2352f35209ae4d55, 0xbb365e50,
+0x5ee8994c2dd350f1, 0xe2d7d979aba03e85, 0xf3e6cb5eec08c49f, 0x9f8b2c091847b005, 0x4ab38a19ff5e3007, 0x5305d085ee3fb86b, 0x43439fa387479ec8, 0x263e30bac9bab064, 0xb5790fe6e496a15d, 0x1e087c601,
+0xe14aeed112e08d49, 0xa5f5e52535801a04, 0x3e7947598d5c7abe, 0xece8962a61c44e4, 0xb0bbf7e2684a9424, 0x376ee9ad040ce919, 0xa32437120faddb93, 0x5b91e42f6a3ef395, 0xfed1aed87be47ff9, 0x115b4ae05,
+0x8e010e1932d51c80, 0xd25845eadb24649, 0x31de2c2a6c2a019b, 0x19f3b33d32c8eab3, 0xdb8c640eb303560f, 0x5bda1de66b81f8fb, 0x4e243a75769331a5, 0x5d15339bf87460c7, 0x9343c36a6a0c9798, 0x21a42bf1b,
+0xbc94af99d4c2ac27, 0x4971deb1e5c04dca, 0x8c2aa93a773e944d, 0x4cc8bf4b3fb492c2, 0x3a80738f54482257, 0x2ccc69faa8afef5b, 0x621a562bba305137, 0xb5c4dbd9eed3282b, 0x611105de7167d9c3, 0xede45220,
+0x58fbff5da0bd77e6, 0xfb69237619b4b71b, 0x8456edf3fc557e3c, 0x6e8b6753e4213ec3, 0x1997b489b8383e4, 0x385bc11c8c892467, 0x71ef26008c815e43, 0x4e82965574968030, 0x47748f5e8c108aa, 0xe82abc21,
+0x3321e247860c1c43, 0xc20093bf21e83d50, 0x14f99edc61dc4341, 0x9e1cefc8ed85d3b2, 0xa514bf269c7256b9, 0xdc8695577b268e63, 0xcbbfd9ab19ea2193, 0xac653c10ea8bf882, 0x93d6e76dd49b5bf4, 0x1cb414503,
+0x9987143cd012af55, 0xa35c037b81982cc5, 0xc04b73a23c64dfb, 0x44ac1c646f10cd82, 0x990d299be93bda5d, 0x88d0a67b0c0c6043, 0xebc7aadd83ab0b3c, 0x3694042bb04dd4fd, 0xc0e3d892d134cdf3, 0xed479e15,
+0x6621be072a52f09b, 0x64af1866cd11b480, 0x13ec795a44b7a63, 0x37a4c48b2b907f60, 0xd1db9e42d7d7eb03, 0xbe9d3493a67dc149, 0x367445f857569523, 0x92f6901d55505e3a, 0x44aab996edfb650a, 0x108bee242,
+0x917b0bccadb15cd1, 0x9dd48be99ab34872, 0x45b2abd0093a2c29, 0x6987ae2929720f0b, 0x6e97bd8d76d3a417, 0xfc6cdf0f9febd7f2, 0x6f93b0c09a083101, 0xd80ead6a644d38e5, 0xc82a3d266927ce96, 0x1954fa6c3,
+0xea641c956d9ae60c, 0x907335c21fafbec1, 0xc33ddaf21ce084dd, 0xf56f882127803626, 0xea0efdd0702706ff, 0xaed88948ba3f95e1, 0x3be3a7eb1fae292f, 0x7fe7361284bd9efc, 0x8534587b75f09f22, 0x3701c7b3,
+0x3bf1dbc5fc0022d7, 0x7f47c014b03f5b5a, 0x6920058a2da1ab57, 0x8d791f0faf007a14, 0x4659409258f520d4, 0x7c2b42fb2f4a43b4, 0x287561c7d8842a95, 0x7152bbefee6e4bb0, 0xed0515e3b4d199, 0x1ef64d632,
+0xaedb56f2034ad894, 0xb60acf9b827838dc, 0x6978e0c515aada5c, 0x9ab157fed880a8b3, 0xc82bd6d2fe8dc8bb, 0x959a2e29ae35cd8d, 0xecd9747c6b8e6dc, 0x7184c30c70113570, 0xa97e813b485c887d, 0xbc7221b1,
+0xdd31e61810f7980c, 0x795492d95f7b4e84, 0x37b7779b2058a5b7, 0x95d60f0b5b00535a, 0x68d98b0d7dcf1e03, 0xa696d5df9476701c, 0xa3368dba61c4f282, 0x7d483d0417669e8b, 0x7b8dee8fbeab6690, 0x693561a7,
+0x53be284fb65942d6, 0x8ad8e9b44fd4f4cd, 0x8eb5f5148c9af53d, 0x4abba616b949a216, 0xaee27881ef21ea75, 0xeff04fe8810e9119, 0xbb4c000da6fde0f, 0x937579659915f660, 0xd31bd5715fef70d1, 0xbf4dec5f,
+0xfade23db0d38e656, 0xf519811a1d047f8e, 0x47d77a1522ca998d, 0x9203bd9061256c7b, 0xb121172572d35836, 0xa8c5ab3379dc07eb, 0x8ca7d87c825fea83, 0x1f31246a0185db1a, 0xaa808887a0bb7481, 0x7b6ef86a,
+0xbbf9140a3e2fd473, 0xab3655292c819772, 0x5eb5d6a9e66615b, 0xb51d48bdc7e65177, 0xf8708da038711491, 0x831c265351180039, 0x68686c0fcdedbf04, 0xf57fa067f4b01ecc, 0x5e6ea56968060675, 0x782f1a05,
+0x27dede8a8bc35d45, 0x962788bf95ededae, 0xdd42235e31fd5587, 0xfae33b0cf7d33760, 0x79e26e2dd3bb7f84, 0xd13b35e87ea5a77e, 0x216d9b51a1907e8a, 0x467e0472d8e0b98d, 0x746f9a5984fac6c, 0xc170a492,
+0x7d6358407c5c7b07, 0xf2dfb1e1c806fe69, 0x69cf0ab90d507d21, 0xfb0dc9455e03892b, 0xb5cd2fae8e13a118, 0x5e980fadf152a26e, 0xb8a369baeaffdec8, 0x19e18f4c405d3e97, 0xef2d5093671a6f59, 0x31d61577,
+0xa6052039d0eca194, 0x7fbee01c1412213b, 0xeeef510bb946a807, 0x2ac448dc5ef97d60, 0x79cc1e66932990b5, 0xe4e9f1dc755e7ddc, 0xf29490011330f00d, 0x53a7bf5b7110d705, 0xcb0782476083a9ae, 0x53bbaafb,
+0x3f4201efa6bf17d1, 0xc65f22ff6663f391, 0x5ff7a276c82d1ff6, 0x36c249f64bec6bc5, 0x5177b6a882feb4dd, 0x681e0fa4c53aa8fc, 0x21501e0e793a8c53, 0x66b788d49c537daf, 0x9c2578cd9b28a5f7, 0x1a610a543,
+0xfde7a768855328be, 0x469ece606e38d310, 0x462551c63542719f, 0x6b6cb09eb5529ccd, 0xfff237036f50c419, 0x7fc03f8cfd4a355f, 0x51ceb39e45120e74, 0x21229a71401595a4, 0xb5d42d727a2aefab, 0x23cc0c1e0,
+0x5d7bb98ed7d01781, 0x45d6bcc9a19731c2, 0x69240aa1cb9f0d96, 0xcb0348cde1fbe41, 0xb061876cc59418eb, 0xd5e96290b27d2b2f, 0x46111a8441faa6a, 0xdbc995d048126d34, 0x666ee22015ca781a, 0x99f73c9d,
+0xd0a2b7c32393156, 0xf1627b075fe48036, 0x9ceccbf0cc6740b6, 0x64ad781bea2a8752, 0xfcbaecdd40e647dc, 0x9546dbd95b12e983, 0x169edb8ef26ec756, 0xdbefc52eeb3c8512, 0x8ad71e76011ee07c, 0x1b0b285a3,
+0xca70e5842b428258, 0x7e3547ae7befdd1a, 0xce6819c84a9928d2, 0x9a33a25ed3278dbe, 0x859477e7f428aa7, 0xc0753d2a7292c05e, 0x32e22bc86b7b46ee, 0xf419d8cf825ba9ad, 0xf51af4835dd5b7b7, 0x1bbb682a8,
+0x9ba8b9ea3c81aab, 0x1476323dc8b90c6b, 0xaf1546448864f38f, 0xfb4b4b2bd0ad3a8c, 0x1e42cdca797ca271, 0xbe09a48fec6fc4a5, 0xbf5bd1cff731e59b, 0x524d5f710d63ae1, 0x5ba8dc4040a85069, 0xd1f759fa,
+0x8d09b2b93aadbf3d, 0xf5e060e026a6a56e, 0x3a9f851025a61139, 0x9156f064536afaf3, 0x58fa3e849bac0675, 0x470ef268b0e47d16, 0x1491b49000c043a, 0x9033955968aae6a7, 0xf95d5c7d86679953, 0x234192f41,
+0xafc7aabf8b65a9a8, 0x42eb084d003adcb2, 0xf4222f014f8153a6, 0x23b9be97a7db46c, 0xca55aa9819a734f8, 0xbca8d0f5f7bd5046, 0xa0eb1800beabd636, 0xfd23ecbd95b9cb3e, 0x114639aab6865038, 0x49452c2d,
+0x95d864af79222a6a, 0x4300745be6c77553, 0xab7e0d7502265add, 0xc5aa3865566a967b, 0xf1440d5934c3ffc9, 0x19a73ac80924a768, 0xc4a53cc7540f8ea2, 0x915fcbf5f87ef7de, 0x1c20d0f093e5cdac, 0x18df08912,
+0xa6f81a2827be8757, 0xb9af8493503fb453, 0x2b88ceab774bbc67, 0xe7167728f2f7f7b1, 0xe17dab3caa65b6fb, 0x3cbf868f5c8edb58, 0xbd2f5bd5acae598f, 0xc4d26be3909d32f2, 0x5124edf1316521b5, 0x5df1df67,
+0x41b8be6260d509e0, 0xcc287414c35a4ca8, 0xdc985ea42d230ccd, 0x719a0e561cb6560f, 0xcf473f05bb234395, 0xe3610491462f7d92, 0x5ee95d7c61d312c4, 0xe166b14a2274e4ec, 0xf7a08c72a6597ef1, 0x1aaae2989,
+0x92e766712f67e49a, 0xec20207f924b27c9, 0x9441b6fb9652bf6d, 0xbf7de3b9d069e302, 0x27a60a13d43720a7, 0x4ad60bfea68c1d85, 0x56607ac03553880f, 0x9549fa6a3ac769a5, 0x62055be4ccffffe9, 0x533e4d79,
+0xb0c2fc78326308b7, 0xbf69db3c3c166db8, 0x7a2b5d97f964789b, 0xb3ea1576afe5726c, 0x9a5f5d82045c9df2, 0x1c278d8c1b734b30, 0x9dde8f87866a6ae6, 0x5a297aef727c17c9, 0x88a404aedd1d6ae8, 0x7f8da0b6,
+0x89fbdf29ee92187a, 0xb53d9844fc4facb, 0x12661c8d2c0a71da, 0xcfdce85f64975cc3, 0xf83ba1b9bcf5ab57, 0xc10327d30cf54508, 0x23a885417b94609f, 0x54584a90cc21e9ea, 0x61b0a3c811ce76d0, 0x5c238306,
+0xe085cc0e62748dc3, 0x5d7f805ad24abd8b, 0x6d4ad4c49b6da996, 0x61bbdba3c8daa3c4, 0xfb2208eb3792f596, 0x169fcbab1fe8566, 0x396cabbaf9615f0a, 0x1d7e9d52a301fc4d, 0x5272fd69ff7d372, 0x2a728a09,
+0xf211a14017f9cec5, 0x568f7264f27188ee, 0x8afef19882771fd1, 0xf31871111e72e0b3, 0x1116b104cb6c81f, 0x6d9f564f75cf1952, 0x8da12a545143dbe0, 0xd049629123cdd106, 0x81286e6b46eb212f, 0x1a8dbea8c,
+0x1c501e37ca7b916, 0xd541b8bed038f991, 0xa876cdcbd0cf684, 0xf5ad74848be03b57, 0xd9551fc4d0e0b375, 0xeb7bdce8ab155bf9, 0x7c9c46750edc100a, 0x790995f0d3e3c4, 0xeb16e03420cbf1d5, 0xa2813a78,
+0xe021916abe32618b, 0x92c6a03a4f307a2b, 0x9af7894bd8af08ad, 0xddcad50f2b7fb6c5, 0x9bd73de6278abdec, 0xdbe004313f02db8, 0x403ba67a62d5a593, 0x179f1d1431d787a6, 0x9eceae7def7bf3ad, 0x91701515,
+0x955318a5402148e3, 0xf0735a42eabe14aa, 0xa5edc5f7d77aece8, 0x97bd8ecd9329d059, 0xd657348ab7ec00d1, 0x5ecf717e7f6ae9e2, 0x6216d6a37ed44e28, 0xbf19b043c319e79d, 0xc4a308806c0ccf26, 0x11d9abdd2,
+0x9e7ac14307358d3b, 0xf6657c59ed312d96, 0xa0878de6b31e40b9, 0x4f9c36e0b18b63e7, 0x9386cefc1ac53d2e, 0x2a8fd643e29bd1e9, 0xcbadecea8b12f4bb, 0x372caa508cc7a8b2, 0x9b0b96b9aad91046, 0x256dbaf45,
+0x26e7a8f3db6dbceb, 0xd9122b7efebd942c, 0x3e98bafe83c570, 0xd92a3cfe45adbd02, 0x22240c77bed30634, 0x235f3ba1bec112c7, 0x88afd451e0a59696, 0x45e988d2b9840009, 0xe0db9db6edb1306b, 0x9ca80260,
+0x143198ce5ff65c9, 0x5858ff700a1f5b63, 0xe2d4f96ffa449f3, 0x8ca0d8bcde601d51, 0xbc9fbfb64dd05716, 0x232db825c8a2dfa3, 0x67a959e593811658, 0x7e0c380d7f622598, 0xed748c3785711358, 0x7975f7df,
+0x116b7c15c36d9d41, 0xa21ca595dfaf188f, 0xf4e5bdd7ab8fba9f, 0x28a34106315e81e0, 0x7a1e87705ad53a4b, 0x6eaeba07b82396f2, 0xe71dbb889d9641a4, 0x1b81ed9194b75eb6, 0x7efcb1a46fac154e, 0xa6906466,
+0x4526bb3218e92556, 0x1c1966938f30e18b, 0xf0e7c808968b1322, 0x358163e7380eeece, 0x7626b9f81454a2da, 0x10fd407e25e8f4da, 0x6f2bbcc41a06f4bb, 0xb6a529e6a065613c, 0x9df0900354a24271, 0x1818f9ccf,
+0x8c116582b55e74be, 0xcebc8da76be7aa89, 0x4b983509a4dd017c, 0xbfd5235844352df1, 0xa0ca9fb539d045e5, 0x9cf00f9415f64ecc, 0xf109300fc00b8235, 0x250944018787df7a, 0xe84d5615a420ce64, 0x2735ef50,
+0x4745f3117bb13554, 0xbb40d3940a0931b6, 0xf0f856f742f6400b, 0x9f74f78ddd75a296, 0x870e9d22a5574b7, 0xec47f7f51e225dc6, 0x43f6e35ed41f3518, 0x18136b3c00ef8c82, 0x63eed7988365fe7f, 0xa77954b3,
+0x197c617abc086cb1, 0x33c30e260ea14ff3, 0x539c07ef983f9400, 0x50cbaa2bf925ad48, 0xbd8858ceaf3b8b2, 0x6593816c9112ea21, 0x40d751c3e75d2a89, 0xf4716f7724a14212, 0x97b9030d6135abdf, 0x22372c044,
+0xb26de859a599434, 0x7b8eb6c533c5fd13, 0xdfc21c2fabad288d, 0x9f9fbbde077df73, 0xac91e2e83aecd0b9, 0xde576cf8be34e817, 0x88bcac1f3893634d, 0xc6ee3e97a62b6f33, 0xd2d8322cda9fc419, 0x1360e9710,
+0xca289a72f4b76bbb, 0xf1959b57fd44c0e4, 0x555148902c4ea497, 0xd6e7e2a335bb986, 0xdb305f8c0cff9900, 0xed3fa3fbbb0828d0, 0x7f9ac79e3b5aae49, 0xee3b678b94180919, 0xba2060c8461169f4, 0x634c2247,
+0x67f7ab879906a6cc, 0xbb8089082be80603, 0x9199366a001b9c7a, 0x613a07c50737f4c8, 0x9262939429f9a606, 0xb1a92e72fa6013b9, 0xa92048271b4b5f8a, 0xa64b164434a96984, 0x2a2248b7df7c07cc, 0xac86dbed,
+0x639668564834e66, 0x7adeb83b2a4a435b, 0x35e761615d14b4d4, 0x7a977d2df24a500a, 0x3ca26e267b518cc8, 0xa32a377d061dd0bd, 0x624c939298c45cf, 0x7f22adb0be535e1e, 0x481860307f835394, 0x1653124c5,
+0x478093d8190c21b8, 0xa2078b358fe8a0c3, 0xe0591311c8edffcc, 0xa7e5931bc817ae32, 0xd8e55cc81b4e9031, 0x9157b8566d08d6cb, 0x6ac847bb05a8d34d, 0x837e2e77930b5ab0, 0x97088f40b40caba7, 0xb7c420aa,
+0x7d2b9b0eea9b7410, 0x1fd6d1b0a36598c3, 0xfa76a3661764f805, 0x8d1eeec58211f230, 0xed2fffb7426a4cb2, 0x28cc802f1eedfb1d, 0x725749abf17dae77, 0x6b5b286b81238eda, 0xb9570ce8e2e64bc, 0xc68c8dea,
+0x16390a30b2b109e1, 0xb03aaf18adbc71c4, 0x8aea1470d3d410b0, 0x251d58035742eb1e, 0x95fb4c63c46be0b5, 0x279e7267af83f711, 0x15867d2a4f9c46bb, 0x3862e25c71eb0b98, 0xd786ecbff7b9d93d, 0xace9b057,
+0x3362f20089748468, 0x2ce0f35599eb339f, 0x7ebc6e6593283116, 0x4d758c8e209648f9, 0x15bdaa3d55a55b7e, 0x95f394e1c38bc714, 0x1cbd606cffe9298a, 0xe831dfa09f44b0a4, 0xbfe7f6dabd4d68a5, 0x5a72a014,
+0x108cdab80661b0f8, 0xc4fcb709d1381d7b, 0x64c2747975e01359, 0xef51ddcbf0a192ff, 0x3fd0422ede8c20bf, 0x43e790d97f8361e3, 0xe748ce6f16f8e497, 0xa38d357cc035ed24, 0xd672373a8476f99c, 0x618d9ecf,
+0x5c1f5d83a09238a8, 0x5f338e0b89d3fac, 0x31848fcc0f89ba1b, 0x17dc4a59a938acd6, 0x935974f7bad801c7, 0x19f2fe0147031e1f, 0x72ac341aecda70fd, 0x45da1eeda8eac754, 0x7ac7525461e7f068, 0x1d28faea,
+0x362b1e46e1f5d8db, 0x5698f9b3119ac0ea, 0x60e066332ee8f84b, 0x832928b62ded0e07, 0x5db3609b9db2f14f, 0x6b96c1044d17c917, 0xacbf131e3c1acb0c, 0xab46359029c77f8b, 0x506c7a7e529262e7, 0x27128270c,
+0x25d618260189b389, 0xb9ec4de6ff11d8a6, 0xf68f4883acffa20e, 0xd6b600899364a969, 0xa594201ce0fdd27d, 0x1dc69e1ab70f3480, 0x42e7c62a9d24047d, 0x23d5732eb964f903, 0x709ce7009697b9ec, 0x1f9abfe0e,
+0x4d7674fb6473abd, 0x3d4ed64342824451, 0x99db117ea3f5936, 0xf59758e68c34ad7c, 0x1f7cc04f94a3735, 0x564af0124aac68ad, 0x29b95eca13bf6461, 0x96381006cf0dc8c6, 0x35ea47dcc8a145db, 0xd98055dd,
+0xb55278a96ee2dfde, 0x71fdba1fb1d0665d, 0x6b12c12e51965487, 0x9e662561c8b0ce96, 0x25c9dc238b343741, 0x7f2163b675162944, 0xecea8df28b852ad4, 0x2429fcfc560489fc, 0x5df7cc871efc0679, 0x23dbb036c,
+0x3776292261ad5141, 0xa10e53ab6266158a, 0xbe7899818c4f037f, 0x73b3e47f6ba78f71, 0xb117e0d6b6290e7d, 0x583b9e19822d53de, 0x82b1892e7f8be2b7, 0xa54c8cf2cda0cdeb, 0x83cbb4ef152f8f90, 0x116795bc6,
+0x6cfbe8c01b3dd12e, 0x6f7d1cb7d324cfd1, 0xdd47158fa4bead17, 0xbe77a30f13009e21, 0x56b4d2a39cda08ed, 0xe68f6f7c16d21824, 0xdc09b8c1a4c1fff7, 0x8bccbc9b0e797ffe, 0x6d55b3b2c6dd9ac9, 0x1166fddb2,
+0xcb4f5444a60531d2, 0x738529d8ff799fb1, 0xc75a6395711dfaf4, 0x48a2f75daccbf9cd, 0xf02ad9fcbfcc50ef, 0x40252cda13bd2ad, 0x8f3106ebb4d0bad, 0xc58a324c3982c8b3, 0xab8cab83544a852, 0x1e87b8094,
+0x85342121012fbfc7, 0x4da2953920b4f43a, 0x6cd453d5417a01bd, 0x19e0dc94d3bc2785, 0x25dddd2b32da36fc, 0xa1f4d69e6fc4f334, 0xd5ba7837e74851eb, 0x52f9551fe47967e3, 0x3a18125dd4d02fbe, 0x1f50e938a,
+0xc86677b9026568f, 0x92343c23c0ac40ee, 0xa26e599188e40e5d, 0x73d80b13fe614769, 0x29b8ac2224e7cd57, 0x500ecc740d01e88a, 0xc138b7816b43af83, 0xdb97e0f8c8fabb38, 0x97d4fb84a6c35dc6, 0x16b413a21,
+0x87fb47dfd67284ff, 0x336ab95cc9cdb177, 0xddeeeb6e623d7b55, 0xc6a63543d4318ad4, 0xefe5e8609df80c98, 0xa281360b56c850db, 0x695b730b4ecf878f, 0x5ed725ff4c58c841, 0x3fb92b84f2bff29, 0x13d16cf27,
+0xbcaed108e57855a7, 0xf64ab4e2cedab85e, 0xd057a78c66775741, 0x677fa5f380142028, 0xad81966466cb5109, 0x437c5da839bcff2f, 0xae34c8d1a8b1b6f, 0xa40660e07f3e0e7, 0x715367c6832d057a, 0x1292c1c2d,
+0x69a877069cf11259, 0xc855a6f4f9e461c2, 0x42cd4d2be71d6745, 0xc5ae85ecfed6c515, 0xd56f731e4a38ace5, 0x414dc8b90f2e1d22, 0x885e399ffd18423b, 0x536fb07659111478, 0x589ffbbe37ba4842, 0x725ea1b,
+0xd1862034c8b7f2b5, 0x99a921c41985e94f, 0x5dbaa7a0e02c07d7, 0x10abf4a4cb2640b2, 0x777c3a0be38683bf, 0x995ad1f4e3e87e0f, 0xd12aebcda896a9ef, 0x773c578ca1ce3f8b, 0x69f168c1ae8d4c19, 0x255cbaec6,
+0x7512dcc2c77aff98, 0x98add010e4d928b0, 0xf0552474de91039, 0xaf73e5c694d61df7, 0x4f1c2ab5ce7fb657, 0x9fbb51e19624897, 0x61673fa4a379b529, 0x3eaf1e885db0fa61, 0x2b7c3d3e4fbf096, 0x123e316b1,
+0xd45dfb53fa0474b1, 0x647b416363197261, 0x94653f7eb803d8de, 0xdb059a9cdcaccaa8, 0x39e661bb3562f2fa, 0x53bfe7711d224348, 0x80f84d1434916bb2, 0xc0fc41ada9207f16, 0xb221d620a05010e, 0xf3d337b5,
+0x31191bab9d6bfb1c, 0xcf81f7ad820108ca, 0x99d1d469cf191574, 0x3d309ff4bf497a81, 0x4a6899d194d3c98f, 0x675bf1cd41b2b622, 0xcdeeadc085e3af24, 0xe6faa0dbac8a4780, 0xc7e4b0cd372bfc1f, 0x1ed3cc173,
+0x9fd54bf1d6d6647b, 0x536f732609dcf354, 0x9c6f708e722456f7, 0x1fc7222af13311df, 0x48a63704517ea54c, 0xc0e7015564adba1b, 0x2ce3f7a2aa9f11b7, 0x160c4232a1522111, 0x5bc3f61254b6aab9, 0xa71e9b4b,
+0x2a8b2411c9b80d86, 0x6649034a6c7d6b33, 0x560285b030237520, 0x151b45ba25c34bc2, 0x557343278e4dd330, 0x3d53de27d757e271, 0xf972d071f4d11d6b, 0x245e37af181eac59, 0xac131c9f843c1992, 0x111b98b0,
+0xe7d792e9c9d8d024, 0x9ea3f65ee64289a, 0xef7e70c65d8a3554, 0xede9bdaf38feae44, 0x6139c5d023a96a98, 0xb910f5780c7953d4, 0x2ef763b1894eb378, 0x332fd4ba4424b41c, 0xeb4f4d855f3990f1, 0x25440daa5,
+0x4f82b7fb5dfa2283, 0xaa7863dfa8e4bcc5, 0xd6ea9d1fbd9ce73a, 0xa7c408371ca5653f, 0x4836466cbc91b8b1, 0x56a3cd410ed4ba68, 0xbed3067bbdc2d347, 0x175e917764fa0a73, 0x71a21a4935156141, 0xd025d7bc,
+0x8cf6bbe9b58f4132, 0xac0a9d7a91c57160, 0x326fd2eb1240a879, 0x4146ab0cd79c703a, 0xc157bd6549c23cc6, 0x47e1fd509ba9a158, 0xa23d1877fa7decfe, 0x9257f99c21d7a8ab, 0x56cbe7aced4b83c, 0x9bc3da8e,
+0x8b1476e36479beaa, 0xf75ebe022b4e1575, 0x3815c5778b41bb68, 0x33a0e986350bbc12, 0x32b52ccd9834d5a7, 0x124af525dee73bea, 0x97e7b94807ee0ec3, 0x21445b3c1ccedbab, 0x4e25ea390cd6c922, 0x10ae7988b,
+0x24ce36de33caebf4, 0x6d4bd5f568e06c42, 0x54c450df5805a4eb, 0x2b5c9a0c42a9f47f, 0xfc2174c3824599f8, 0x5820d6eb2591678f, 0x20dbaa3dcb25dc3b, 0xf2f3d5f2f62f997b, 0xabea81cec1e1320d, 0x12c60582e,
+0xd64d9f1a6e2f3dfc, 0xf22f4d984b993c78, 0xb6c52c9d2cbe1f90, 0x4f16a100ba40a2dc, 0x3662c19237fdd808, 0x3285dcf5865e38c8, 0x6fb236b5f6bc455, 0xb30b98339a0e67d5, 0x2180794a5dcb1043, 0x9e50423e,
+0x1d3a2fbe40c3dc2a, 0x22f8b8516cc9bce1, 0xe884765e74616241, 0x85437782aa50c9ae, 0xc74ddcc00d3aa6a9, 0xc746a3e29cbe3051, 0x2f655a530fb77c9c, 0x5e9535a4d5a0d086, 0xbd0b1ddedfd40d14, 0x257036e5b,
+0xb4462300566a537, 0x60c908f946642962, 0x86c45d4355f940bd, 0x89e66dc6633de9fb, 0xad6b4774616708a9, 0x74ec51e78d3b794d, 0x48456b8ec9e2dcd1, 0xde9a9b16bfee09be, 0x87bed796c5a821a2, 0x18ae28926,
+0x3b1bc63174433e69, 0x39323399d08ef6c4, 0x3fdaea5d6946492f, 0xfde377ff4a33b9e4, 0x5ed72abd1ecc04f, 0x114b1c3d7447fac2, 0xdae3790052abf975, 0xf2590ba4e2b47d0c, 0x68aae3436556fe14, 0xd678d5cf,
+0x78f7476d7aa761c, 0xf24447e61d59cb17, 0xa2b8d6da826121ac, 0x174de8f695e38531, 0xc8805ac788113d87, 0x14e6dd0757759242, 0xd154c3f232c35021, 0xfd13cf73c821ce08, 0x2ad8d5cdd2b60a15, 0x2550be8c5,
+0xdf2e9f63d736ac51, 0x2af0d816ea23f957, 0x116bc95e132754fd, 0xf798255b4b578db6, 0x123fcde6c24a08d3, 0xbaa70cd36f471c86, 0xfcd994fa2bd6d01d, 0x5eaf5b757c62f044, 0xe8408b21aab08085, 0x1a1b04948,
+0xda1cbca87d0db417, 0xad480782f166875c, 0x4eef876b0a86b155, 0x7bba4cdefbbdee75, 0xbc598747f73700df, 0x8b78404322f33574, 0x833c370987a98f10, 0x7f3fe6e95f462fab, 0xfe0bdebafdc78808, 0x16f0859d6,
+0xc1dccbb0768a4301, 0xc65627e7994d6227, 0xa0483056621216af, 0x741822b3be059dc3, 0xc6609caea25441db, 0x45c25499efe12b66, 0x32d70010139ba612, 0x13ff4525cc41214e, 0x4a4324d5973977ce, 0x16bde113d,
+0xcfc03ae9b355d65c, 0xd3eb7feead272526, 0xb9273f2104870701, 0x171ebc4de0c8bc42, 0x1ec2dd326a5f9a2e, 0xe7064bc8e7791f9d, 0xc52702a97885e1de, 0x7c06134e996a484, 0xc208a0084afbf791, 0x1f04273e6,
+0xa1969dd7e1043483, 0x5997bdaa54564e56, 0x16ae7d246238a4fe, 0xe2daf065a6eb13af, 0xd0206ace99419e7f, 0x8fc524d19e7b7fae, 0x5f4cf59f795e9a3e, 0x9b490a0c67466eda, 0x434891201f383156, 0x159dadf64,
+0x4eb9f6c004fbc5d2, 0xbd987574e5347f37, 0x4750a8fd312440a2, 0x446bc2a73abe10ef, 0x3fa20134d5337b0, 0x9c615bc516371708, 0x6837b993ea227a53, 0x98293feac9bce45c, 0x7e9b9258b1c85799, 0x35e47b5f,
+0xdea4353aab2a7ef7, 0x2059e2b57a003e79, 0x4f5fe80bc288fe90, 0x4f2d2383a671d8cc, 0xe4f52e5c3f898139, 0x6998aecc5d4ebb64, 0x64be151e73ec26a7, 0xdda2f84ba52aaa0, 0x96526922bc5c72dd, 0xcc1d292b,
+0x84fd3f9e60fbb5ff, 0xb872123b7bf0a661, 0x1345d9a7b74a9cd7, 0x93d9b75a5234afd9, 0x3ae978f074c9b53f, 0x3dee3a3f6117c24f, 0x1852608b23bc1077, 0x1e62c0a4a5c1d52a, 0xe11b1f0878af694e, 0x30d23446,
+0xb82cf6f63bf4a426, 0xb958b8e597a684be, 0xfe470da7a51d9b3e, 0x147ce45e950b8e2c, 0x504ce4779092e22e, 0xa603310433dc1e5f, 0x9b68541f5bece886, 0xbd25e390daff1c6c, 0xfe78c1ed71d95bf1, 0xac9a63f6,
+0x24aa7ecb2a8915b7, 0xce1a212bdbb85191, 0xececda32eb0e232b, 0x930d19c52d7ce111, 0x44a1ae9158515634, 0x3717702efdca6ba6, 0x4d2b238183726079, 0x1418055ea1d62422, 0x840bc66877cd346, 0x24f22f3a7,
+0x3666c2c8322016c, 0x29dc4a522880896e, 0xfb5fbd181e9383a0, 0x104c9226ca75b34f, 0x68257f0ef3264f1d, 0xa849808d6d361678, 0x22c16d94d56fcb17, 0x557f4722df87586e, 0x737de557707050dd, 0xcbd61280,
+0xcd234df010108d2d, 0x22abe1fb6a07790b, 0xff8bd4f89ed9a45c, 0x1a78e755f9e4c2b1, 0x62e063f3d26f05ad, 0xeab16535d344c71c, 0x8efdc440e33da6c0, 0x3e668aa1758ed961, 0x5a62534079371d7e, 0x22db2f6d8,
+0x917649c64ceae666, 0xe2288ca1b7be7fc0, 0x363ab47c69efbe23, 0xe26dc6ae45530b38, 0x2d18901ccf7cec16, 0x8c6e3e356baad35, 0x5fa32242e8042596, 0x9d7a9cba7ffcf0b6, 0x1607dbd2388625e4, 0x216fc511e,
+0xe83c3eb20bd77032, 0x2cc730d3d94a3f38, 0x1797d776a4983cb4, 0xbd4fa8b49502ba38, 0x5f66903a95596c40, 0x64b246b272b8b681, 0x5e41bfb0cb3a227, 0xc6af814c16af41c9, 0xcfa8dd8ffa59a0ec, 0xe12830e,
+0xf6c7b566a3f158e1, 0x8e936e712a31e990, 0x91637aafffab3485, 0x77d6be5cfd22bcb1, 0xe74a0975703efc65, 0xf1b03cf114a14fac, 0xe83bc2f133c4a319, 0x6f320edfd9aa70fe, 0x9d2bd3ddbc5f42a6, 0x240535f01,
+0x3572c4b336be8361, 0xf02a574f357ad364, 0x9d839bbe93bdb7df, 0x3b09c8cb0f26ad0d, 0x7c59c3a91af3f54c, 0x295fda0689661b1c, 0x2162b1d34a711745, 0x358f0fac3b768d3b, 0xacb4815899052631, 0x2628608de,
+0xf004465b92ad3da7, 0x9303e70b3c66e653, 0x15dedaf7df33bf55, 0x784cadf0dbe2014e, 0x3b212984bf378d26, 0xc36e9e466455518f, 0xa0a032ced822d3b0, 0x894884e826551771, 0x7a945141e3fed847, 0x196992565,
+0xc174b7ea8f71db8, 0xe3466e72162c6727, 0xf0d1d7cd8ac85da9, 0xb96225a4baf299bb, 0x69002ff1c0d4ab77, 0xc33ccf7308cc8d1c, 0x514fc926f2548c4b, 0xd96188e4267d468d, 0x934c20b0f0f787c8, 0x1b9a45990,
+0x16f3f6ff51cffa82, 0xe5582ec111181bb1, 0xf599cad959e72390, 0x8d468131e2c460d2, 0xf890c502875d7050, 0x1ec8bbd17a915471, 0xcd0eb54b0bad053, 0x38a84f8e0d38c39d, 0xe32c83ca6d6141fd, 0x25ac229eb,
+0xae6c570f7f08d90a, 0x1929e0abc2928376, 0x2ac82117b45657ed, 0x236767e9afed3593, 0xefa6b6923115c02a, 0x5b85db3cf2fafd7a, 0xb16cde610303924b, 0x8514ef956a4a4780, 0x952e562455164975, 0x13f301669,
+0x97a842dd75705c85, 0x439a7c88c6375641, 0xed569520668ccd02, 0xe253bc502d030898, 0x36aa3ad37a3537ea, 0xd85e22c6e1d8d687, 0x62532ae967fc5de9, 0xff6ab6d87d4ad33f, 0x823eceff66ec43d1, 0x9ce421e4,
+0xd6c333af6e7d57d0, 0xdf916a59db845aa1, 0x495e486fd10fab2a, 0x5c918e5f7396b050, 0x58782d93857aab8e, 0xdd6c576ad16c36de, 0x922d85079e465ac4, 0x6d9c88118cabe645, 0x89734c96308d4039, 0x6fcb6613,
+0xd2710df523f4019c, 0xe8e50ad6fb7c30b0, 0xd9d23828918eb8bc, 0x5c7502411caad623, 0xfe02b2f16c34b4d6, 0xee3c874ad540ea36, 0x11c36a5c10f13343, 0x44d28f8d28ac8cba, 0x29fe41f66c0cc66e, 0x240e6c959,
+0xbcb8c606e06742ec, 0x60f3063b9a7216c8, 0x4b849e05d78962a8, 0x13c6ef40c8bee6e2, 0xabf768ad443cfdf2, 0x344e892362a9f0a9, 0x1328797a55a0d43d, 0x1cfdfa16ee8a9654, 0x81d195b44d7a3f0b, 0x175ea884c,
+0x290745347bd5170e, 0xf7573ba817f8c4b, 0xa0282a434f3e31d0, 0xaee90611244953e9, 0x9a5b361f56a57ef3, 0x33e84059f0e8fa22, 0xfcaee655803c5599, 0x99ef28b1b66424b0, 0x4f79f8265ce5b00e, 0x24d345a38,
+0x54efd37194690fef, 0xb7081022dc5fdac8, 0xcfdee5167188a0d5, 0x98f01967fb1842b1, 0xd3185192217795cd, 0x6597c60cd2f8bf7d, 0x707184b100aa6e51, 0x109f1a48389778f2, 0x26b0047818f5d58e, 0x1b0524c3a,
+0xdd41cd3b5ffdca7b, 0xf1e8f73bdcd9786a, 0xd2f599d637bf0464, 0x2bcdcfeb2911324f, 0xbc455c05259ade11, 0x78335b5c6693db8e, 0x454e52d0b271364, 0x175dd00726039d16, 0x285347d2391a9c44, 0x4f92ca75,
+0x79385fe5eb22ca67, 0xa192557c1ba51200, 0x71d0abf655d9200d, 0x91d11b4d4504e3db, 0xb34c869627aab175, 0xcced2a3a62c4f07c, 0xd9b895d62f17a558, 0x5a55224632087f40, 0x1a7aac957e85cd09, 0xb559fed8,
+0x412f697fba85e277, 0xfa7c65cc57ba4ee2, 0x214bb6069a0bb514, 0x775c9ced5b4eee05, 0xe39615f87c054fd7, 0x166b71473cb8c359, 0x947fe4dd4483d4ee, 0x252c6dd291142553, 0xb38c5abaf5877620, 0xd4039385,
+0xe7dbaaaf8d6daabf, 0x721214b8158a73d4, 0xe06045e54ff7ced3, 0xe45231c020f15079, 0x48eebec6fc7ada38, 0x2fd72019b3199f9c, 0x40540641e3535784, 0xf383b4e7ce862f87, 0xdd78cff51b848745, 0x59432ce1,
+0xb5412515dfcdc6d1, 0x41a946ce02a46875, 0x19b2b8d27cddeef1, 0x671d0f2730f36143, 0x7e3e4b4d2010097c, 0xd00a1fdd31978fcf, 0xe8c4b539505422c5, 0x1451837ff46e016d, 0xdb49a5cd73a9f13b, 0x77aca527,
+0xd436b2b73bf8544b, 0x46d6871198602a, 0xfd8647bae72d4531, 0x748aee8f1780b832, 0x55b7c7c605885d4e, 0x773efb0bab0a4014, 0x5e62a0efa46d45d8, 0xa864c96f1e61f377, 0x248c90624ad4fd45, 0x7363c9a9,
+0x60a2d6b5568eea99, 0xb2bb5c2b2c3ba62, 0x5aca02f03b52eeac, 0x8950fd259890d208, 0x14858e72348b30d8, 0xba50f1482ce5d41, 0xe5802a83237de099, 0xcc1a7eed0fed95aa, 0x79d260a06e1b6368, 0x186abec1e,
+0xe397c09cbc8698f4, 0x1e231db9f80321f, 0x3c14ed63a0f5dd74, 0x3263f51fb0d047ca, 0x7a2991a3a79b0d4a, 0x70ed352d480026e8, 0xe67553d74d511cd8, 0xa69334e1b628444c, 0x151a88794aabe45d, 0x18c6627b1,
+0x6568867200f9af09, 0x387b4fbe8029c23, 0xbc0c3835e332ba40, 0x365aaa11e316a39e, 0x8501966fdbc56e8c, 0xc205c4e55639f500, 0xbb943c11f17024fa, 0xc82b13ad00f64e1e, 0xc80b9904830a1a00, 0x1dc6ff93e,
+0xb9a6a66836be9250, 0x465ab6b811538e4e, 0x67349f0fab132229, 0xc0989658a8e3fa48, 0x24d274bfd908a447, 0xa4fd34123f9c21e0, 0x6e20c7af769d99c3, 0x7b205886f3c0144e, 0x14fffb52ae745b7d, 0x2536eb82c,
+0xf4e41253eb969559, 0x32b6007bae1883d6, 0x678227a828dfe5aa, 0x6d57ea336b5ea1e6, 0x49358c1dfa92aaf6, 0xdd1e1f3f10d3a4fd, 0xbfe4456776f8c570, 0xda9d03f83f81404c, 0xdc103368a33a54d7, 0x239231c80,
+0xa489a5af7ba3289e, 0x771fc84ad66709f3, 0x5af6cc5115917f28, 0xfb8022fbacf36065, 0x6ea516797211e2bd, 0x21a0211130a77008, 0xaba26e0c15fd191c, 0x8d23f50108ba9709, 0x718e3400a7ee99fb, 0x1dbd2f83f,
+0x73968d8ae23f8081, 0x40ae1cd53221765c, 0xf595e9dff8debe7d, 0x1616cc0b0cce9240, 0x2db50b195760611e, 0xd319e5957c5325d7, 0xacb9232a3b5af4d7, 0xd2aa514d59959969, 0xec37a55e82bd60d1, 0x130dd8eb4,
+0x70567f25d168f0e, 0x493acacec8ea02f, 0x2f5b4c68b2eeb706, 0xc96b56b33564646f, 0xf86cffe8387d6f27, 0x34429a442297868e, 0x5f2cb317b346fdd8, 0x857256655242d6d, 0xe615a1d0e85cb1e1, 0xc75ad71e,
+0x529d020041a6166a, 0x22905943fc477b31, 0xe88b55721a52ba1f, 0xe34db5554349d54e, 0x83c03b2e0c26680b, 0xc40dbe88793af896, 0x1fee22304f832f9d, 0x51e0b39fe7cd6b17, 0x692922aa2a33774c, 0x4eca563,
+0x60ee7b88431f0c99, 0x5efd5d783c1ae626, 0x2cb30f82bdc21ba5, 0x786905aec7cb2b63, 0x7db7c1764d224b10, 0x149fbcf42d19058, 0xc8c1f5151671d9fc, 0x428455df0d963c76, 0xa95798e02443a78d, 0xa7b1ebce,
+0xb3d6a0df89cd0ab8, 0x6c41b57917c2b1b6, 0x6248dcfe6fb65cdd, 0x19e42f514c80956f, 0xf3b46a15db100d45, 0x922d074f3eb48fce, 0xb41092c6c014ac84, 0x2f8423a358772e64, 0xf023a6445b7e3775, 0x11c373fac,
+0xc573d53d5c88a900, 0xb763bca9c5f54a04, 0xac2183bd2f5562d5, 0xc4e909f4f2018313, 0xa74c17353564c3c6, 0xf89b21621de60759, 0x9d31f5aab95ad114, 0x76c8bc0e0be63a76, 0xb46117ee30c92b1c, 0x13677f9a5,
+0xb16133d99a713cd5, 0xab893bf7c30349c, 0x1ebbd5c6617b1a32, 0xba45e82a8fb79d64, 0x9b4711a57224a8dc, 0x1e42ba52a28164e3, 0xa7eea3dc67abd769, 0xa4e3cd367a0ac53e, 0xc7de24e12ee3bc5f, 0x186873ae8,
+0xd2fd79f9a464e686, 0x745709474ca06f41, 0x6121defb3295b014, 0xfbadeed39e74d2ba, 0x5cb76c4b631b96ea, 0x8bd6f15b45ec4dc5, 0x5b991181fc4dc751, 0xa3d4402c1f01c78a, 0xb284e299678df88, 0xa4d93489,
+0xe833959341c0e8f7, 0x7e0a66128de72c39, 0x143590c33147108b, 0xf0eb78293b93d562, 0x6412722d339b05f3, 0x54414c6befcc529, 0xeb5c81ac2df56c15, 0x3c8817311644f781, 0x16fe3f2d820b72a, 0x1a591251a,
+0x3d587026919d7e8d, 0x20e2442003b92828, 0x82313c0756d0da95, 0x63e9f53ba72bf38d, 0x17b1e3fdce0b25d2, 0x2c4fd0e611f45a30, 0xe4ce22ad6243b1d5, 0x31477f4ee4db203d, 0xee8a80951d3d74f5, 0x248d8c892,
+0x94914aa02bf616a, 0xfb615b1b550e1f14, 0x87bfa7f9a42cca5c, 0x27f89cc56f635882, 0x56dc75b2c293ea36, 0x82e661906011106a, 0xce8c2ac84ea1fb7b, 0xe8632a166e1a95c5, 0x57c2daadc6d8b73a, 0x1dd45f164,
+0x75cb219057c66c7b, 0xa41b5e85e831bada, 0xa8bb12c131a47faa, 0x779fa269a3f5dd7a, 0xd1450dd99ada3b31, 0x11c834f41515861e, 0x4fab0ada49c6f40a, 0xd8bde6bea4613700, 0x5916342806da7549, 0x8bb94bb9,
+0xae1bba6e74766d15, 0x89a59de8911f20ad, 0x9db7953dd0c2737e, 0xedd47d22fe4e5568, 0xbeb927c5ab5a2ba0, 0x40b5b03e15c95c55, 0x1ae3bc809a894f13, 0x27fda4fef947498e, 0x61a4b8dd247afe9d, 0x26e361942,
+0xf89524e179d419ea, 0x214e40a8dc2177ef, 0x223449384d14c011, 0xff1c1f0ad01b202c, 0xb2eadbb6783aae3b, 0x2393f7d95eff7eae, 0x43ea593f4fdafceb, 0x265d86261c6555a3, 0xc3284324dc66cfff, 0xbfb26b0a,
+0x6ae534b3d10cb3ac, 0xa58cc1dbf41a37cb, 0x67045f4ee477b331, 0x58bfe4efc059036, 0x31db345fe5aafda4, 0x132bdf73f8dfc7b4, 0x5c56e580b7780bd2, 0xc80a8e093f3972be, 0xd9518063c1564c4d, 0x21acc9664,
+0xe7265c2ef5b84828, 0x23f34df07704b1f7, 0x372f8b9ba2e2788a, 0x5dc77d871fede2cf, 0xfd7efac76f7f7373, 0x56f7c05c4112f580, 0x91e35d544c12a000, 0xde76282f72826800, 0x77f303d26ad0dbdc, 0x2109b300a,
+0xc730cc40bb653343, 0x6d1fe51d5ed02939, 0x4069987136e8185, 0x586c78376e11516b, 0x61c098aef1ee2a29, 0x80651301bd42e4b9, 0x2c0d27c51f3c58c3, 0x76d148df53c7e122, 0x734b4cf7fe88eb30, 0xc6f1a494,
+0x6062d858e8d3f4a5, 0xd1ef62340526df1d, 0x9f31677c33b74d82, 0xc5b94aada9de420f, 0xa9f327b25ff64128, 0x5c6fd136837f8b9c, 0x5c316364ed3161e0, 0x967ddd2eb98c6e34, 0x84e7a8a8752f052c, 0x16cb62637,
+0x66b695e2d6f51612, 0xe5e49e4242c641e9, 0xa4062f3973b4b64c, 0x5be11e8d552e7620, 0x47a1dd1984323f9b, 0x70bebbffb298055c, 0xc53907961bc5db23, 0x7d491eb5f1f1a389, 0x31851d997a1eb5a4, 0x1925a1a3e,
+0xf93ee90a80eb0162, 0x9b38c801377322eb, 0xfa08bdc70f2aa74, 0x6b7747715be9434a, 0xf2505ef33f7e0407, 0xe837186ef63b3536, 0xb0d13811ddbc76e4, 0x387b9e177822da68, 0x910a4c84084c3e32, 0x9a640b6b,
+0x3310d0e3aa02280, 0x25af20b064f64607, 0x72e79b8638e56e3d, 0xdf053ef355d41605, 0x972f2834a7c447d6, 0x6abeb316ad345620, 0xeb561c9fdbb8af03, 0x8791f2fbca8423cc, 0xc52b08e5d0e5dbb7, 0x1a4533e6d,
+0x3f43ff54b82795f2, 0xe49599fa5b884f53, 0xe6c0bab6cd3d8e63, 0xa022f84a5987f8e8, 0x2216e245eaa75b12, 0x5cf9e5990dbe81d2, 0x8069f0b8ca55fb1, 0x84fe3ecaaffcc14b, 0xdb5c409cac2348f, 0x19b33d77,
+0x7a55d6259fb0a50f, 0x15eb2aa90cb7539, 0x9b9f261d7eecec49, 0x5015c95fa9bda271, 0x7a958069d9572995, 0xede51a1bfc4c6e0b, 0xaba1b9eba143db9b, 0xee348b99bf640f7, 0x2f22a34274f0a147, 0xb3b08ff9,
+0x35fbfe520a93220c, 0x254db2329b9835bf, 0xfb806dfb7aca4a17, 0x29c334f933036825, 0xc3f4e28d9f9137bb, 0xad2daadf0a2c3323, 0xbcbb7204de86fc18, 0x3fc78e2518240c6b, 0xd770aa03131d46a, 0x259f0597,
+0x194128cb593c7c67, 0x5087d76a0d73e89b, 0x8ea11aaa689f36be, 0xf9e1d84048d7c6d4, 0x6fcdb0aee9a0bcfd, 0x9b3d1912d3ffea38, 0x7265c087fc5f63f2, 0x8a731fa45ae7d56c, 0xde1adb48c2cf00bc, 0x8b00bf63,
+0x73f9772f5eefbde4, 0x66a6ef4bff7ec174, 0xd2225e013bf72ba7, 0x76c791bee1d06142, 0xf76c40d912201bf0, 0xcd4091ff9a93d742, 0xe0aa2f015a48bd9b, 0x7158eb23c1577791, 0x7f4eecc984125ac2, 0xfbbce192,
+0x467b0857db46487, 0x4c051f5858f1ab16, 0x333964973ea2a208, 0x56d091aed1f47d39, 0x30a8fb4efe30b9eb, 0xd6627ae36d0fa740, 0xfa7dfaa723b097ff, 0x97295e528e5d560b, 0x8b84e8cebaf2a42e, 0x1f018c0b9,
+0xca0cbafbcac291ae, 0xd12b0d1437cb4c88, 0xd4868dd314108466, 0x746429b1406589cf, 0x47c2f27cdcd4fcbc, 0xc48c54c44d968fda, 0x47556e5d40cc04ae, 0x6ccdcfcc7ca044c6, 0x41977ea07cf159a5, 0x143fd07e2,
+0x5e55499e8ae52d0e, 0x12d5fe62109c510f, 0x7aae5d998ac7dad0, 0xbe8f1b76dd03c634, 0x8c790dfbeced863e, 0x850641693602a8e2, 0x206ccdf97107a2e0, 0x5aac2eea3d57fedf, 0xb2ed2afa536e50be, 0x190912dd2,
+0xa7ae26c3c91eff94, 0x6f5d04a290f610cc, 0x8242bd648cf6874e, 0x8eafd88f65b1b610, 0xf18ed7f4ffa984a2, 0x3d0fdd457bc66a9f, 0xc48d16a3f445824b, 0xb35b82de4a0521b3, 0x2078a7670d2a2a48, 0x16463e128,
+0x1220282eb0d306d1, 0x4b3c5b9bf221bc18, 0x2c08445119264e44, 0x96eb13e9968bb61d, 0xc273857a76083c70, 0xbc177581866ba97d, 0x71e9c1dac65c0d7b, 0x857b46a0c1afd758, 0xf1b07f1c1dc98af5, 0x673a0024,
+0xf60e21ee212eca47, 0x99fa3c4907e08140, 0x7afebb621191603d, 0x2591498f1c512fea, 0xdf87ccfc4a7f4c3b, 0x7ddf8166acf17618, 0x364254ffa8e517d2, 0xf706a4b06e3471cb, 0x18eb1cfe6f3a893b, 0x22c19eb3,
+0xfdfc307b023721ff, 0x1bc29bc71f43deca, 0x29296e43faf8cce2, 0x4dae1b98c92b4774, 0x64e166ce0268b31c, 0x5d1b089f78b5d089, 0x88bd2ef73e1aabaf, 0x93196b525bfece1, 0x2066da601a7df5cf, 0x26dd046c7,
+0xc47ade73a0de35ca, 0xdd2fc930313a4d54, 0x8ac105fdf482c5a8, 0x380122ab29151310, 0xfc9b460f3cab7f6e, 0xc8a1a029ad191f93, 0x845009afe48585e2, 0x584aaf5d237e44a8, 0x891d4e3a71685a7, 0xb2346cd6,
+0xac09a9554ed6d87b, 0xe1d43af18eeb214c, 0x17a1adb1eabd9ea6, 0xdac4d32556e5ed59, 0xe19907f95fe2b19c, 0xb15327f11f7da2f3, 0xf02b9bf6667ad07e, 0x10123531a187b474, 0x8078037fbb355797, 0x2586f1fb8,
+0x289df585272f3ed9, 0x5af9316526094bce, 0xb14f253ed50a7deb, 0x266294a820b3b72e, 0xe36ebfbd105e851f, 0x4d8d46351c480921, 0xf2b14b7812a6107, 0x9be5ba4653cae86f, 0x5063c39d419cb508, 0x11c275438,
+0x92fa85a877762f06, 0x1ef317807319bd01, 0x35be3b42863d0fb8, 0x6b9b5cddd03b8df, 0x33c732d4ea51d7e7, 0xba4734e5c6efcc30, 0xfc975aae67d572c1, 0xd33ee92b435f604b, 0xf7bce9c961437b98, 0x567d3fcf,
+0x8d98bdcc38388f7b, 0x7d4211a0c41b9955, 0xa22b4496dbae4c61, 0x4a53299217f1ccb4, 0x26246a8e160bfa74, 0xf758c751ba789d10, 0xd5c9014c54b60824, 0xb1db41944a3bffef, 0x2048237482f2e613, 0x1318e8dc1,
+0x8c86053549260ac9, 0x7458c5132c5e43d3, 0x4ac71a246798d309, 0xb4caca600f515578, 0x96dae9eb21a152ea, 0x4dff246987359f93, 0x49efa3903ac15adb, 0x26d01adb6e5bd3f5, 0xca27db8316d798fe, 0x1fd1cf4f,
+0x7873fec6b2a53d8, 0x26b384243cf53a49, 0x72d12c7a758b2388, 0x451f314eaf202858, 0x126398bda07de1bb, 0xca72ae3e4f05fb7f, 0xda08b010293c0d94, 0x20094bb89c7950b3, 0x2f2661d76a622c3d, 0x10f3c416e,
+0xe9c465f892ddb236, 0xa3c20543d46dbb5a, 0x58377e57feed5dbf, 0x93658388f3a19182, 0xa752e82a83f53789, 0xd42b836dc5555423, 0x8d7fa0534e992659, 0x9e69deaf5bd67975, 0x95c2055c0abbd7a8, 0x25323ca41,
+0x9ff2f774d0544424, 0x6b2e9125df10257a, 0xc51620a880001bd1, 0xfd970077fb92c025, 0xc558030fa090bf8a, 0xd83fc6993c280a8d, 0xd7764c45eee80dc7, 0x104ceb390de91e3c, 0xdbd801b8317bac6f, 0xa48d42d7,
+0x29b9076e715ef110, 0x9d05323147821eb3, 0xa2b5b0f8a5099505, 0xcf2ab0941cb0571e, 0x1f76a6c5dcc50fbb, 0xf11003e07d947184, 0xfa64b6ddc5475d5c, 0xab4653109abe3431, 0xc706993c640fa5e1, 0x93d37529,
+0xcc61863e98403757, 0xd73025a3cab2c039, 0x3a67b6cd01883774, 0x22b9e83512a66a94, 0xed90d25ba80a7a26, 0xde3f92cd1416964f, 0x64ed4a3ec4788cbc, 0x31ed2e0137c7c2c5, 0xd4ce195c6c8f54f4, 0x508f0587,
+0x4a3bedab95eadbdb, 0x93684e9d8d2f4172, 0xa3d3b4bb2369eb69, 0x3d886447864a6a30, 0x9f45a6b7a7fae18d, 0xcf6f11410ce0d7a3, 0xeba17eb8fddb85df, 0x5f43407fc614f79d, 0x5b4bccb7690dcbc4, 0x18de5db4c,
+0x1e5ee1e86ce10dbf, 0x768202b21986bf99, 0x6131f30c4d6a0bd6, 0x38e27398e402e9a4, 0x88e4b5d6c401def9, 0xa5d5284f49cbbde7, 0x358601ed05441bac, 0x1e68d30de56c6cad, 0x3c881d7148c5c6c, 0x3cceb1a9,
+0x31de0dad87347dcd, 0x1c9cf35167b071f6, 0xc6f4f84b694ec243, 0x3fd2bf954eb6e658, 0xb1f3062e049bb1c6, 0x11c743f634ba588, 0xeddb5299d3a78f8, 0xe4781fa0d525512, 0x74e775a717928348, 0x24ea11fcb,
+0x250419d74c307e43, 0x507715761c782497, 0x7fef350f3c08c840, 0xb23f177195b54280, 0x6d82aef3584f78d2, 0xea97af52c104d7e2, 0x6bc744fe916a1d07, 0x3a45225de47c5429, 0x79b067e6418800cb, 0x453269eb,
+0x86aa5b3aa2b5819f, 0xc954337ba28352c2, 0xc261902a55e7a9b1, 0xdd42d0ae2be6a38c, 0x35879a4de06428d, 0xf51eb0fb55f71bfb, 0xf4f6b2996e506e9, 0xec871d9cc3beb154, 0x7347bec9564af6a6, 0xef866c9d,
+0xe9020fef5d4641c0, 0x8b561ac8bcbb99cb, 0x6767151663b1a28c, 0x248f583a8f8ddb7e, 0xdfe3cca9d982a654, 0x7986bffb39290340, 0x61184be264e6c4c0, 0xfb23900c8a73e7ef, 0x837cd21824fed62d, 0xdaa8159,
+0xa8cbda2d217f63c5, 0xafed4cbbddd25569, 0xa98fd6db2d08c02d, 0xbb033f4cc6984d66, 0xbc49ffa7a86267a4, 0x22bc5df08b3f7245, 0xa1609719a08ff2a4, 0xf51721327c3222c2, 0xf4a3b11e4b981c89, 0x34cd62b0,
+0x6a0ab58120a836d, 0xb696165ca4efa033, 0x23cc9deff97ad5dc, 0x47974255407fd369, 0xe0f3bb52e0dbc4d6, 0xd260b41af51fcc8a, 0x61bf4ce59029cc75, 0x6a6d09d3f09005a0, 0x263f712c7ee05c41, 0xc1fb681b,
+0x46cb10d61f17a81f, 0x91d534b852856571, 0x25e21e74fb8b090e, 0xd0ca7ca61f7789f0, 0x5f795011c0078a6b, 0xb31c317b9df0cb39, 0x5d109ccbc305ed3, 0xccb673bed522c5c0, 0xe6e64626e2ef5837, 0x19ed2923,
+0xb2adf00361f0b0f4, 0x3436a60f58643412, 0x79272d01fe443f2b, 0x21f176f0734d84de, 0xcf077d9ed321ee41, 0xfd5844f0a520fc2b, 0xed451159133761ed, 0x292935526fb76ce, 0xe8864226eac58f8d, 0x1edf4f193,
+0xe501e8696c77a45c, 0x62d5c308db3b28aa, 0x2d75c724530e237b, 0xd6bd6ea0dd5e1316, 0xe91fb6e1649621de, 0xb80f14e5a0c5d963, 0x3efec936d9af4ea9, 0x7d6c58cf5212cc15, 0x3c74af6dc31f1e52, 0xcf8f53b4,
+0x1250c5f960e2373a, 0xe8568e7736f57e2b, 0xbe8483a05093cb95, 0x711ea421a9d13e78, 0x2bc69a37d66a3c61, 0x8886de034c5fcca9, 0xfe1656bafd7e9dc, 0x9b375324f0f56701, 0x5d42a13f5d47fef6, 0x26495f453,
+0x7ad230d17adaad4, 0x6f0afcbf80699900, 0xf71d4a805aaea60d, 0xea28d1f2f82270c9, 0x1c019025bf60da64, 0xb8a09c08441b2d1a, 0xf992abc022c8838a, 0x1b736863666afc1, 0x46b36a6c897a3944, 0x2004aa434,
+0xc02c7c37571b97a5, 0x308697478099ed11, 0x1648e67d48ed05bc, 0x6a2a2514fd376d5, 0xec5439cfac99ec3a, 0x9d9bfc281b828613, 0xf2b2189cc9089d78, 0xcc7a5de6c9a3a352, 0x4910860bb62fdd4a, 0x1acd96559,
+0x86b670489eb63922, 0x276eae7ed007b459, 0xadadc3c8b3fd69, 0x2f07efef8ccea706, 0x8db4a5ee677e67d3, 0xf2d42919aebbf077, 0x9701f0b99d5e5626, 0x206640db374457de, 0x1e246e8b98a6c908, 0x1614b1e8c,
+0xf99f293bd0a62e60, 0x68b6c52c43322d95, 0x398d49c41e6b0035, 0x61d4ae53fe21f965, 0x4196ec1bc33119ae, 0xd409da61b29da63a, 0x688697f80e3e70d6, 0xb2b9e73d8ebdf089, 0x28e748f683f34500, 0x3e0f9b75,
+0x9df88637f93e9640, 0x7afe66d005d3b046, 0xa17201ab9e33165e, 0x8cb3159ae7a218d9, 0x39fae0304ca3ea3c, 0x1a4f74f1f208b78c, 0x7ab872fb40c7f5ff, 0x12232a55aa1a3f56, 0x1e3bab373d221e98, 0xcbed9f62,
+0x6e62776974f1d6ee, 0x7ee6aaa7f2c299bc, 0x2e80bdab0592a799, 0xa832c430c1fa3915, 0xc220ad344e9392e4, 0x4c72f206961dfa1d, 0x7756720adb08947b, 0x5cd2dcde092cede8, 0xd2a0e97917e2a50d, 0x879cee2,
+0x599774f54cd0fc5, 0x4147f3996b90991d, 0x7b3d11ffa1a06673, 0x6cab7089170a9c2a, 0x299e87a6672eac05, 0xd26d65ce5fa9340b, 0xe7452345a410fd8b, 0xdc871f79e65153f6, 0x9b20ad5221d7b89a, 0x3a816cb4,
+0xc237ca24c45f43ad, 0xedfeef52d63268fb, 0x798f95efa5ed7ba9, 0x2a6db2ad3a4a7312, 0x837052df0eca5736, 0x2d7f5be98a0dffd8, 0x81b63cb4f391d172, 0x30f13d0af1c49fc7, 0x28aaa3986726cb1c, 0x4b749e82,
+0x28d4cb7892de2e0c, 0x4becfc710f355de6, 0x70d5037fb0340fcb, 0x706d6c0a83429818, 0xb2c59c08587b0fc5, 0x87e6be0c75868454, 0xbeb0afab8c4b6986, 0x2b5c8d21ab9393fa, 0x49f37e584d63bb41, 0x204e1beef,
+0xd7c2c0498ac020ab, 0xdf1d0cd5c1e6785b, 0xfac7823748d5f320, 0xb16a5df03096491, 0x1297ba3bfa6ab7f0, 0x6e7f695729dac286, 0xe2ae59cf004da709, 0xa8905fdb35993f28, 0x3dd4ec7fd8f75381, 0x271fee5db,
+0x3eab0a85adcab265, 0xbb3a513ab2f394a6, 0x9b4e95c3ab573407, 0x88c383a0a725dd5d, 0xad9b1e81084d7eca, 0xe02db0baacc78737, 0xc484e7d4cec268bc, 0x3583eda3054c47b1, 0xe944e44a02604d7b, 0x1470d35f5,
+0x34232b6d673a1708, 0x1ec2e0aedf17475e, 0x301c71d2fdf49497, 0xe16745f02c69ca46, 0x3c39864c866b7698, 0x8c1ff6a7335b43fd, 0xc7997574b3c8142c, 0xbed33793e433a760, 0x6ecfbc4895ae6b2e, 0x5366320c,
+0x4177618a417912c2, 0x718f812785f3ac91, 0x97313c0f7fa707c, 0x604e065e362c0c02, 0x46f3d026b396e04c, 0x98b5661791abde8f, 0xe7e83be7ac9e6426, 0x645dac6027c90a45, 0x8f39ad7b8627b2a8, 0x3af7f2f0,
+0x25108a927f32566b, 0x8b3c6e80de483474, 0x2deaee7e6edf4b27, 0x494eb50a535ef7e, 0x9bfba3170a69ff32, 0xc5196896a9ae512, 0x7821e69feedd1763, 0x86fff0db0190f0b7, 0x774e7a719b909f15, 0x616e66bd,
+0xb66a2b02717d6b1e, 0x1b35ddd833a7d69c, 0xff6ced6d1e28ab64, 0x94236c95cdb388fc, 0xb485a36b766ca112, 0x43513ab7adb03993, 0xfe6b509a9b225ce5, 0xf8afeabab0a7d73c, 0xb089c8a8e74a53d5, 0x17a5c6058,
+0x3b3ace2fd90bf7ce, 0xe52f1dbd0a9748cb, 0x9b27644e7fa0f43d, 0xc50cf4c3fe505921, 0x21aeb6f7cae764e1, 0x85d12119b16d41d, 0x96f785da23cb07a8, 0x5676f727352a6530, 0xea4dbaa320ce9b08, 0xde0bcaf8,
+0xb468f18c5dd8c4f7, 0x42333a78feb3bc83, 0x1e580e33c1ffd6f4, 0x6911d044766ec938, 0x9ecefb2cdd855c8d, 0xfa2a0d031e78ec46, 0xfa0ba4e80275e795, 0x61b43fd2d7314715, 0xbddb44ac2363479b, 0x768683d9,
+0xdb4aa005e31dd484, 0xb9d215cad8fa18fa, 0xe8e043cbbfbd5131, 0x1c6a41ebd336bb2b, 0x66c7979210716458, 0x5761c47bd6f9eeb1, 0x6729116b3558195e, 0xfe9e5c5132f1111f, 0xf51d92d469afd2ad, 0x23adb34b8,
+0xf5a5e228702aed3, 0x7431cbfa0e8b7275, 0xa198bf38f07ed521, 0x8b8b45581d75821f, 0xcef215b05f01da99, 0x623803cd7bd23f13, 0xbfc181b006057e05, 0x3b29068c4d02f7a6, 0xb36c712f077dd978, 0xa0bf121c,
+0x2de22dab94d45144, 0xdcf43fa1221eef44, 0x5e8033887b0e249e, 0xe0edb4fbad2a6802, 0xd321dfd0d495989f, 0x98ea3cb3b4cb6e68, 0x9b61dd92743e98f7, 0xcf0037bb4b02fbfe, 0xbc8e6ff4faf95fb8, 0x2667ab445,
+0x72889e868e1a3d9b, 0x438aa5ff2b96ee2c, 0xadf52735f4028509, 0x647327c4db987777, 0x1c4cf6f42216587b, 0xd6be562faa1006af, 0x70fe19551bc1b25b, 0x119835729a5b2e6b, 0x70b27cd66d00ae7c, 0x8d26408b,
+0xde2da4d09749070e, 0x2d248191a48e17c8, 0x72de4ffc829f851e, 0x2c9915fba797dbdc, 0x221d8514bd46c76b, 0xfe430fae0d8f2209, 0x41a85b256a3282f1, 0x3de417e57025db, 0x3639349161140f02, 0x18b6db3ad,
+0xe5af09dd26ef94f0, 0x4f37aecfc94fe4b7, 0xd64ff4fa5609f8f5, 0x7abe4cbf335fcc17, 0x1d9036ba28844656, 0x8fe8218ac37e71e7, 0x2b255aff49b5eab4, 0x57832f0682adfd89, 0xd0a53290c1a34200, 0xbc10b248,
+0xbac3e24688ead17d, 0x345c9c4192312303, 0xf5537d2f70d6bc01, 0x1cd0f26be8cabb11, 0xa11b7ff3d0c440e8, 0xbb376a6fbba4c056, 0x25d38040dbc36396, 0x840064a7542f37a4, 0x11d1120ced0b4123, 0xc44b78af,
+0xb2f859de62759343, 0x9bbd7cfa4db4f500, 0x58f9f915b7e26947, 0x4f6cba7168270c20, 0x8073c3140f4404e6, 0x8048af74cec308eb, 0xd16ea8c42b46e737, 0xee06fe8f185d8fee, 0xe3dfb6f67d142939, 0x15cc512d6,
+0x2a6c846fbd5e4733, 0xd6faaa2b41b542c6, 0x29148be2711d32c7, 0x88c8a1c9b15137a8, 0xb57e69fc98389b93, 0xcc3531de28403268, 0x2241cd629ad61d8f, 0x6e1363ea531e8f86, 0x550f338f90c71a94, 0x1d6f3885f,
+0xbeb75680b8c4b7a, 0xf0af8161c46383b2, 0x351d6b1f5967e38e, 0x1eae7b4e802675b, 0x574b6e118774c00, 0x38f8c72ed93a8cdb, 0x30ec6d061a8c109b, 0x75a6bbe46e22d65a, 0x44b9471c2e3c4a75, 0x187189920,
+0x3c84ae08e0d8ee76, 0x4e84bd3efd661dd3, 0x67d8fc7872430cda, 0xfcca292d54ff4c02, 0xf73f6e47acbea605, 0xe9fb1c0ccdccc99c, 0xa8bf62810d57f478, 0xf20adc219c7806bf, 0xf4ea940086ccb153, 0x149de8f64,
+0x456061695c76415e, 0x38ff6d7fd21da717, 0x9f2e278114d0cbd6, 0x76e2f9937f6e5a36, 0x5b67333155992fc8, 0x2dadd2a10854990c, 0xc5cec85935ab68ff, 0x8bbbdd26379f00e2, 0xd6e99afd74de9e68, 0x64db32d6,
+0xc176f2132bb3beef, 0x4a1223b2e0fe998e, 0xf38c65edbef1770a, 0x2e4cfe5b0fd32f94, 0x1f23907e9c8697a7, 0xab140f68839d2797, 0x34354eab2020ae2, 0x834ff80f326385d4, 0x8d81aad899715fc5, 0x26c123214,
+0x31e2db12c9812759, 0x27cea89c2f4f6f8a, 0x7d8cadc71dc4d171, 0xe5285603a8bfe7be, 0xb54a665ea8d42b7f, 0x451f24f74853e677, 0x7c9fca16375c6dbe, 0x3abed95a04d70f45, 0xba4f1503d8d525b6, 0x1ec1e652c,
+0x6ca539bbd0874f05, 0x3ad4c21713d1fa2e, 0xeae878e971652c07, 0x795618125c14233f, 0x2853e9bf4e74fb4a, 0x1db81c713b44c4c2, 0xc9b09e08e1266a3b, 0x696925be0c7e465c, 0x9cb04f2567820cab, 0x20aa454a1,
+0x184dbe49d23fbfbf, 0xbd8f85b1e986246b, 0x114a103ee4bbb1b2, 0x34b604fbe544b436, 0xd997ac96bfa80671, 0xd9c27feeb8389e11, 0xb0c953b18d24b1cf, 0x8a43ce11ed9d24b, 0x29cd3d3f64f08807, 0x25757446f,
+0x9cda288318a3fbe6, 0x6d73a8a70c912ccd, 0x97796aa1da611918, 0xab059407dad01802, 0xdc0cf9faf782b651, 0xd87cb5883db3ad8e, 0x6fdd85eccc978587, 0x40690efb3d15d459, 0x1f07a6e6ac47b5e4, 0x4f3922b5,
+0xd24680d5786c1797, 0xe7188b952ff1c846, 0x3e81942206fdcfa9, 0x222ff1cfd137726b, 0x4244f6b50d1b333d, 0x7ab5848e607558fc, 0xef7253accb37757d, 0x7fa6df4a5c55a64c, 0x6babece4980f5acc, 0x44e8e38a,
+0xada2c23220d792f0, 0xf437afc0ccc2e391, 0xcd1cda6c9f0d6aa4, 0xcc855bcaec4973a3, 0x4a5a2c9d133f7b1d, 0xf39b91b976e35a97, 0xa3a6f865fde17dd3, 0x9d628ca4038fc2c4, 0x3db7f20b7bc8dc3b, 0x2211cedc6,
+0x9c8423cb24a6ce62, 0xdc22047d10c1fa11, 0xcbece8e5f4ade501, 0x1802a907a993b6cf, 0xfb03c93ab40fef0c, 0x89869c82d24e4d78, 0x772cdd8de696e326, 0xf7040e3fd8ec1b7, 0x159ec9f0c0e66ed6, 0x1e1493179,
+0x660fa5710173cf3a, 0xccb6001528607ba, 0xb67d077b0d929696, 0x8809786e90f3166a, 0xce6fa78ba1f6f965, 0xc8dd65a57f007905, 0xb221f73041ab6a9d, 0xedd3b0f0c672d63b, 0x68176066ec9e7251, 0x13e862d69,
+0x95de3d73f5e9add7, 0x44726344c4b16f6, 0x9191726cbbed08f2, 0x1b82de276d77d812, 0xee0d2b71935c72ca, 0xc23e1d91e9f70e1f, 0xbe2d2ec3423cd203, 0x966470f7c0ef48f, 0xfa73fdae9ff74d3b, 0x426d2158,
+0xe9ecaab51409ecb2, 0x9b2812e2a6b0b591, 0x68c0cb46fa96f780, 0x592b81f0c5de5f81, 0xe796b02f8b636a95, 0xaed4fac0dbd4db32, 0xa6e559bf9a84185e, 0x8e4d9e63d92b3ce4, 0x9e1d0c994a0d1aec, 0x17797909f,
+0x95bd482c2d989ef4, 0xcb499699a3aef38d, 0xb854bc3cbf082039, 0xa319ab46fc0ea170, 0xc23ff78cb15ed371, 0x23f66854dacac7f7, 0x6a33b9645fa7c65, 0x4161bdae2d1e21d, 0x373c592bbe598701, 0x97716076,
+0xaca08b1d9f9d5b0c, 0x286be3ccfef3780d, 0x5cc17ce253cfeed8, 0xd4a8ae51c5fdad6d, 0xe99a635a7f9711c3, 0xbe327f975572d741, 0xbc94d4699b870dc2, 0xb24a2f1bd474996a, 0x36bfe7f309553ef2, 0x92160800,
+0xef62b5b9c7e2530e, 0x311659a8fe41064f, 0x1795cd7c99c0df68, 0xc7878f404b6665e8, 0x247e134d60ce85a9, 0x9d0383318b2c362, 0xcf86805e17d18489, 0x69c8e62768698be2, 0x56dc232270d39b47, 0xbdcba6ee,
+0xb9febc461b17f5af, 0xd27ab875e892e6cc, 0x783b84d0038c0122, 0x2a5164e7e4293645, 0x3e6c45624df86d8, 0x1b3f08c3b38d3654, 0xb0081fa349121541, 0xccf99545dc83a20e, 0x3b420277f5f9fa86, 0x22bec16ba,
+0x326b7e1e9338ffee, 0x4c7670a56a53c85f, 0xe5d57e78a48c082c, 0xbc8898c5bd51099b, 0x2e8eb69b169994c5, 0x7aa6c41d536a5760, 0x3e9f364370106842, 0xc0e67a3f0663093, 0x23610f7cfd67dfef, 0x1476c94bb,
+0xc9c014cafd6fb543, 0x6ea2eca7fdd04138, 0x6113ac721bd9f2c1, 0xc4815e6794f5a475, 0xe25e490292a34839, 0x7e2af4ec4f77c4d2, 0x2414e2bed66a7c78, 0x99496291dd536246, 0x2357e882d2c90b2f, 0x251d8ce34,
+0x37ad0ebde807774d, 0x307f9d12a8fe2fe1, 0x9cd1573125093da6, 0x90abf8357ba296e2, 0x9a45926283a70ebc, 0x89fff8c662c94751, 0x9a6fc6971031eeb8, 0xedf73c2c9758ae49, 0x2393b700e7f17e58, 0x199003aff,
+0x24b15dd785b9283a, 0x331ca95f1bc8a1aa, 0xf30a8bdd0ea98614, 0xbcc81e3a4178de39, 0x4bd65ac8d2d2362c, 0x5eea3b985be0cad9, 0x5c51558c60599650, 0x72c625e33df68302, 0x794d505d695b5dea, 0x23865f82a,
+0x87818241d777e023, 0x85cb59ead97d7fd5, 0x34bad8c1a2d07362, 0x44d135977e68b140, 0xec1c570eb8b97e34, 0x9f9afa277a262546, 0x2147dafe45a01408, 0x1d08b9b45ffd9fd7, 0xc1c6f67dbc4f4fff, 0xcbb445c2,
+0x494e737f331031f3, 0x8a7327f67be6cd48, 0x133d539c75cd08f8, 0xe9ea1b8988a40999, 0xb29e1f9c25eb4c70, 0x28c272184ec461d5, 0xb5cd2a57e22fb6f5, 0xc74fd966d61c46b2, 0x6598e17e8edf9de4, 0x2662f83b3,
+0x61e7ae35f74c2d28, 0x21bffa9d049db150, 0x95a5c1391956851, 0x48afa0f1e741ed77, 0x190604e24b3a29bd, 0xf85f7770421eb163, 0xa0a32677b7b5f197, 0xb1a6af8231945ac6, 0xc4d3485c56bc7801, 0x444fef94,
+0xf739e4d1072221dc, 0x15e67dc4c6319747, 0x16de58623496e910, 0x337a781cf2315d36, 0x76e4d04a097832ed, 0x7161476073d24aa9, 0x7b6bf845415f79cf, 0x166dd360df4b6957, 0x8ea326ca4b288042, 0x5e537752,
+0x3ee713ac7c97397b, 0x2c5e87cc3b02cedd, 0x42e5f976ca13ac62, 0x501a882b44d00d1c, 0x3524699e70d78d79, 0x481037c769c2d169, 0x25ce1e579a69f24d, 0x2b52b5c99bbb6eaa, 0xdc7330d76089afd2, 0x175c019ae,
+0x8f0f3c0b955623d0, 0x52461f5555d05b05, 0x84cf5e34e578ee6f, 0xada042b9941ce834, 0x838fe7dd561fa5df, 0x7f04f5f1a50b9d8, 0xae061f653a19a6f7, 0xf5836bd9ac25887f, 0x83f36b452febb7d7, 0x17f01beef,
+0x3df1f2d843c2e0c, 0xcf2ab1d902c90370, 0x94370b4c595365a8, 0x275e5581387ac9ca, 0xe28e677b5b9a7440, 0x2b98d56216a700e1, 0xef57d9a927bbe487, 0xe4dfc485bc23124f, 0xea1774341cca520c, 0x49887ccf,
+0x3d659bccc024e0f4, 0x8b52e163245d9e19, 0x377f41c62c905fbd, 0xdcbe452dd8ee8196, 0x5751ca494f02bbd6, 0xf075bed87bfb5f5f, 0x72a085a6ba13ee36, 0x1e46d4bc91afda65, 0xf29e769dbc85107a, 0xe29e22db,
+0xc75409170783b23d, 0x3b26518aca73fa56, 0x864ee2a839d30065, 0x7739d2e8fcd9780, 0x31c277c0c15845b, 0xa2042d660a41b121, 0x7ecbd7e6d4c1f055, 0x41d71695f1a5939e, 0x694ccc57a59cd1b, 0x1b1c0f69b,
+0x4c590475667741be, 0xfe3cbd587845d0c6, 0xa6cc906b3d691842, 0xbb981aefd9d46de8, 0x76db2923c49896ce, 0xe05418b431f9f7c8, 0x1c795a8b97ad52cc, 0x85008e788b15d655, 0x2807665eea1f8d21, 0x19d4f3e96,
+0xbd95750851a59839, 0xc69266aea38424da, 0x9cdd4e4ad145936e, 0xa1b24c23c90a0e5e, 0xe7655636c76bedc1, 0xd802b387430e3324, 0x80504b9c762b12b7, 0xcb05da8620bce704, 0x794235bc8d501fa1, 0x4259bea2,
+0x796fc36211444fe5, 0xa39355288cff0e4e, 0x145e0b55de71eb41, 0x2b6645242b8c7f81, 0xcfc8bf80df402cc6, 0x9141384c88408051, 0xb672e07084c1fb3e, 0xe592dc3de6fd9e4d, 0x19a717dd4fa2b352, 0x263ad8458,
+0x8c1b66d012fba5dc, 0xf5c7d8abc392c593, 0x4ca0fef89d6a5d1, 0x31d6a008544ee8b0, 0x74512ca9801db613, 0xc2628bae2e6b60ca, 0xb6564db1d41b329b, 0x5fe924d27f51e4ec, 0xb23e089103ec189e, 0x113668355,
+0x354a8720cb004463, 0x102936670806561d, 0x6211a44fcb889a38, 0x7975060b1fff09fd, 0x1cb717d85c3e5729, 0xb30d4128a57ae34c, 0x4d9fa1ffacc97174, 0x4864ac1a8a8780ba, 0xf57ac528200e4062, 0x2558bfdcc,
+0xf559b2dd911e674f, 0x912c6434a69f55f3, 0xc6861cf351aeeedd, 0x3b43883fd42bbb07, 0x880bd56ba49d484e, 0x957c3ef78db7c1b5, 0x88a90ba44cf65dcd, 0xd3f10e8bb855d156, 0x2dc5f3e1fb5266f1, 0x12a6f935e,
+0x86fb30d0c5a38500, 0xa9fc90273a545cc0, 0xdff7fd5772809272, 0xc66dd01ce25ceda7, 0x5e3546946db5ec98, 0xf9e38e3e4c9c902d, 0xa5e8ce4f68199694, 0x74dbdac706946c23, 0x8fe61878a828367b, 0x1766af912,
+0xe48d729fff6641e0, 0x7c9bb9aa9007d276, 0x7e41333a75db3022, 0xbe843869c30c7807, 0x9ffab3dfb5724751, 0x3de4c462432d5c37, 0x6983782c722fc290, 0xfaf4e027211c7de1, 0xcfeda66d14aee268, 0xb3608d,
+0x16d54e5322c3d1fc, 0x5a14f172302641cb, 0xb64c00820abb23f, 0x73fbeae6c19826c9, 0xebfb54d2926ac37d, 0xdb7b8ee6be0a3ae, 0xd029275dcded1335, 0x887a2692598f8560, 0x74482a19ae434e20, 0x24485bf00,
+0xc4f63b2a7f56222e, 0xd462152b9f18595, 0xfe400159ded6a5ca, 0x362322f043e4c6d0, 0x26c2798fed5ea918, 0xeddb9350df20204, 0x1fe4ff9b24f0bf2e, 0x26f2381a5906fe1f, 0x68cce0bc6ac3e5bb, 0x12e474856,
+0x54cd580448bf30e9, 0x6931d576086e6705, 0x99de872ca7d39c57, 0x88b6a25210f6b40b, 0xe9cdd1473d6e196, 0xfecbd3be53e9225c, 0xd60940643d4146d8, 0x59c509f8c149d62, 0x6b63e2f7bc3844ac, 0xeeaaa1ce,
+0xb06ad1d523079dc3, 0xc1fc579f1621515c, 0x6dd9429a2cd8d558, 0x5bc0c7e2cd70c5f3, 0x5b079862a2b06a6b, 0x1001b0e16a6b0ff6, 0x24b496419a14bbf0, 0x3123169bf989f028, 0x8e709b1f4fdf60e5, 0xaec3060e,
+0x8a114b40d8d0050d, 0x1bdac1bd8bef19a2, 0x303fc46d0ebabf7e, 0xfe5b0eba34a860de, 0x5b44a748beb4b7db, 0xa5117ff6720d086c, 0x5f41a23c7f76a88b, 0x2de3563f3d080f20, 0x3612a5b37e99de96, 0x1d027598d,
+0x89f98a7eba770932, 0x635a5885ab51b134, 0xbd25dfc3d7e412f3, 0xb93b73b28e6070c9, 0x130c35093724cb7a, 0xe5eaf3977bf43105, 0x6fbd60f78a3b4bff, 0x6d5dd3b9abad8ddd, 0xee6fe58782c89da1, 0x22abbf71e,
+0x5dd377d9a868b822, 0x49137f4d51584e45, 0x706f917b95194d2c, 0xf1e8a46cc52e9299, 0x5617bd576dbbd8cf, 0x6c57ee83d5852ab6, 0xf2da4711aeafb3f2, 0x53b1c7490ec7473e, 0x6292d509c5d59fec, 0x1abb32ffd,
+0xa68124f19af2f03c, 0xb7af519f42dfbe30, 0x635d21f5df0372a7, 0x87ad2e69b400d8a1, 0x972410fd5440bbad, 0x7e71bf096b7d0987, 0x96a519e8e6798bc8, 0x80e10a6ab370ca44, 0x3e5a492d707f8c3b, 0x512cb356,
+0x5a5f54d0a48f02b1, 0xee5bbc25d9804f97, 0x370fa0f71302e032, 0x91ba057fdf0386ed, 0x561ef87173897ca, 0x9c3c2b9c60ce9070, 0xbb8e803510e217c9, 0x3c835b1a37b8f806, 0x90bb81ad5c743823, 0x1ac7eb645,
+0xb3a90df9a62f59a4, 0xf557a3ff2e990201, 0xd30a9de539eaa9b9, 0xeb7d67c99c44599e, 0x68d7713013b10e8f, 0x50fec516f17e896, 0x17a1ef4f6e792642, 0x9c3c3b8e9c707d9c, 0x83354c290f1f1cf, 0x234da8b7e,
+0xfc3dc2721adbb487, 0x10036c1237aafd89, 0xfe00596da13562b7, 0x9a9ce41ef685abee, 0xb2c2c50aec803cab, 0xaa256509b7fc2a78, 0xd2d702c622e7f147, 0xd55c064adbb8ccac, 0x4f04bc955c7db8d2, 0xcaff675,
+0xa3019d2e9e9e3809, 0xf058999bc1eb771, 0xd1759d8b027acb29, 0x6e3dddf6926805e, 0x5402d901d0ff570, 0xbd612261d5d08b06, 0xc2c9d916d4edda9, 0x4f7d67f989ba742c, 0x61e18f449bda924d, 0x1fb243b17,
+0xf19fa9a6d7fbf6fa, 0xdbd8929c87bb72da, 0xda084c768ebcecf, 0x39f86131ec17669e, 0x5b3dd1dbff25423d, 0x60ccaa2092b6411e, 0x49607573b1a45473, 0x851e59f93b7607a7, 0xea1646f5a92c48f3, 0x24493034a,
+0x76a2b0891d397898, 0xda5230d0ec7506fe, 0x90b1f66af53ca46e, 0x1ce731d9d8aba070, 0x536d0044db5de5c5, 0x61375af2e263eb04, 0x4efff24576841031, 0xd9bf97a3db6891e8, 0xcaf0f1c2ad3c4516, 0xa76d186d,
+0x69102ce718a44d0f, 0xc4766161982034e6, 0xf04a591cf3dfb7ab, 0x54803e5b0e539119, 0xd6ea1f5f7eb92230, 0x7e468168e2ccdcd8, 0x9dc4eae3818bdf4, 0x4e910040da51b960, 0xf2531531f20274d3, 0xd6fb3126,
+0x99255081bb46793, 0x7e2b4141b0faaf64, 0xf0161c164840674d, 0x2d99a51b1465c6fb, 0x58b2f5310576d1e5, 0x99e95545e598faf9, 0x6257b918e58f9902, 0x16f29bb22b13da15, 0x79e8e64f950097ad, 0x1ec84bc61 };
+
+#else
+    #error -- "No window tables for this PRECOMP_WINDOW, generate them with precomp_gen -w"
+#endif
+#endif
@@ -50,6 +50,7 @@ const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x2584350E0C33C304, 0x51E9C
                                                      0x398686FBB343398A, 0x20331307B470DA54, 0x964FA62AD10005C5, 0x9EA5CC4D64E5D9EE, 0xC84675CF9B96060F, 0x1DECCB78CFAC, // XRA0
                                                      0x6B20FF684759DDC2, 0xD50EB91730DEAFBF, 0xAA5CA048E2DAF488, 0xE29708E28654FC18, 0x542928AD1F445359, 0xA311B83D79E73FF6,
                                                      0x850B7F5926826B22, 0x2D46731863BDB99D, 0x467A80CD8320B69D, 0xC046B12F05BFD513, 0x35D9B2FF794BDB40, 0x633276495B85 }; // XRA1
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x1b213e928c8fb40c, 0xc0e84f586daf407d, 0xb9b29ffce5a886ce, 0x9f40598c83c9e94b, 0x88700a62c4dd37f3, 0xe92e93cb588d2d9a, 0x4f9ea2da4fc1fdff, 0x6e29efbc8f30dc5d, 0x6e58fb6a5b80f133, 0xfc84f1255b401697, 0x3a4b6f5213b017d4, 0x28ad45dc5826 ,
 0x2576ab20e6407b24, 0x2daeb81cb6e15e86, 0xd2c3e91780bc932e, 0xc9b766c5c2c697d, 0x331bdcb7c5fbf2db, 0x9d427c81b7f7599c, 0x3c17ef7599d6fae4, 0x5e0c3161085292b8, 0xab0363eb0ca6c312, 0xab73e3cb0eb3710d, 0xe64e24a61aefe7c8, 0x12c8a88a9555 ,
@@ -422,6 +423,7 @@ const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD] = {
 0x79675b252773024d, 0xb77199c826eaef54, 0xd8ac5c7bfdc2516c, 0x203b5abbb23af29a, 0xad5a40a2e6769d3b, 0xed2a0f6f125561a8, 0xa2133a9f41ff1516, 0xff2eab7471155a32, 0x3a4a69dfadf792de, 0x7940d695b34d9aa8, 0x61970ca47359f66d, 0x4613cc916914 ,
 0x522e39e1c50809d5, 0x1ed45164c487a964, 0x79d6ada91784db1b, 0x989b421ae5662fb2, 0x3df10cbd8e406ef1, 0x5a8a5142753c17c5, 0x4a82ae458bff639d, 0xdbd6d2c37fcc66ca, 0xb08d84cb47d7564f, 0x9cbec735b8587bf6, 0xa13bfb64f7de33b9, 0x4c497a6bc57e ,
 0x78dbb2e6f9272d00, 0x859fba47cd77babf, 0xdce166ecd8d462c0, 0x1c85515f2c63dfca, 0x7f548fce752c0285, 0xd22c9fb32c4d5fc, 0x567a9a51717ddf1a, 0x84fe301c837a15d0, 0xc0f6c85c014d65a3, 0xd0d9fd883d9e324a, 0x2c3495468587f428, 0x361ed5fbbe29};
+#endif
 const uint64_t YQA4[NWORDS64_FIELD]              = { 0x2afd75a913ecf8df, 0x2918fba06f88c9ab, 0xa4ac4dc7cb526f05, 0x2d19e9391a607300, 0x7a79e2b34091b54, 0xa05809dcb42f1792,
                                                      0xb8d6fa0b2fb9739f, 0xb92947307436ad45, 0xa478488aa072d9c3, 0x76ef5de652478b48, 0x21b5b2d9a016385e, 0x36fb1719882d };
 const uint64_t DBL_QA[2 * NWORDS64_FIELD]        = { 0xac2b2d74f883dfe4, 0xda9b5d82caa27d78, 0xf8656ebc40d57f4c, 0x5e1cd5bdbf041897, 0x1a30c6a718d110c8, 0x3c8def0dc70d6806,
@@ -453,6 +455,7 @@ const uint64_t B_gen[6 * NWORDS64_FIELD]         = { 0x110F4508C6634CCB, 0x31910
                                                      0x73A274E4A6908387, 0x88D1B207BBE8E2DC, 0xA6D0583233DC71F, 0xCF7F2ECC609DE5BE, 0xB8AF0669FBD1CF01, 0x1F3EF25DD512, // XRB0
                                                      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }; // XRB1
 
+#if !defined(TABLE_BUNDLE)
 const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0xF1A8C9ED7B96C4AB, 0x299429DA5178486E, 0xEF4926F20CD5C2F4, 0x683B2E2858B4716A, 0xDDA2FBCC3CAC3EEB, 0xEC055F9F3A600460, 0xD5A5A17A58C3848B, 0x4652D836F42EAED5, 0x2F2E71ED78B3A3B3, 0xA771C057180ADD1D, 0xC780A5D2D835F512, 0x114EA3B55AC1,
 0x2E1EB8ED8C1C8C94, 0x6CFE456B25DBE01, 0x1EB54C3E8010F57A, 0x4B222D95FC81619D, 0xF99EBD204D501496, 0xC18348F9B629361,0xC29E9A16BEDE6F96, 0x3B39F30163DAD41D, 0x807D3D1ECF2AC04E, 0xE088443F222A4988, 0x61B49A7524F1EA12, 0x41BF31133104,
@@ -839,6 +842,7 @@ const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD] = {
 0x1827c239b0ed1d46, 0x91166086a0e56dcc, 0xbeb2d5ca7b1be889, 0xbffba3edab5d050a, 0x89dcda2b466bf1f4, 0x69062cd6ccf72d8c, 0xdb30b89ee29d7170, 0xaf9a6423b3737d7a, 0x17289019c2a59bc4, 0xc6bc5dbd2bddd5e4, 0xd72761e787c5945, 0x4e9b22da5758 ,
 0x649c4220dc572954, 0x7af81067892dead6, 0x9a4a55d7d9b9fc47, 0x1088d8ba9eebb1d8, 0x7cefd297e1571129, 0xa062161ea25b0712, 0x163f00b337478492, 0x7e7ecb08f7aafb3a, 0xb45bd73348434a07, 0xc22e8036a1ee60c2, 0xe433d634e26ab3b9, 0x3e1e09d93302 ,
 };
+#endif
 
 // Montgomery constant Montgomery_R2 = (2^768)^2 mod p751
 const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x233046449DAD4058, 0xDB010161A696452A, 0x5E36941472E3FD8E, 0xF40BFE2082A2E706, 0x4932CCA8904F8751 ,0x1F735F1F1EE7FC81, 
@@ -848,6 +852,41 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000249ad, 0x00000
                                                      0x5527b1e4375c6c66, 0x697797bf3f4f24d0, 0xc89db7b2ac5c4e2e, 0x4ca4b439d2076956, 0x10f7926c7512c7e9, 0x00002d5b24bce5e2 };
 
 
+#if defined(LANES_AVX512IFMA)
+// Constants of the lane-parallel arithmetic (fpx_x8.c) in limbs of 52 bits: p751, 2*p751, 4*p751, p751 + 1, and p751*2^51, which is
+// added from limb NWORDS52_FIELD-1 of the products to keep them positive
+const uint64_t p751_r52[NWORDS52_FIELD]            = { 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0x49F878A8EEAFF,
+                                                       0x7CC76E3EC9685, 0x76DA959B1A13F, 0x84E9867D6EBE8, 0xB5045CB257480,
+                                                       0xF97BADC668562, 0x41F71C0E12909, 0x00000006FE5D5 };
+const uint64_t p751x2_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFE, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0x93F0F151DD5FF,
+                                                       0xF98EDC7D92D0A, 0xEDB52B363427E, 0x09D30CFADD7D0, 0x6A08B964AE901,
+                                                       0xF2F75B8CD0AC5, 0x83EE381C25213, 0x0000000DFCBAA };
+const uint64_t p751x4_r52[NWORDS52_FIELD]          = { 0xFFFFFFFFFFFFC, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0x27E1E2A3BABFF,
+                                                       0xF31DB8FB25A15, 0xDB6A566C684FD, 0x13A619F5BAFA1, 0xD41172C95D202,
+                                                       0xE5EEB719A158A, 0x07DC70384A427, 0x0000001BF9755 };
+const uint64_t p751p1_r52[NWORDS52_FIELD]          = { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x0000000000000, 0x0000000000000, 0x0000000000000, 0x49F878A8EEB00,
+                                                       0x7CC76E3EC9685, 0x76DA959B1A13F, 0x84E9867D6EBE8, 0xB5045CB257480,
+                                                       0xF97BADC668562, 0x41F71C0E12909, 0x00000006FE5D5 };
+const uint64_t p751x2e51_r52[NWORDS52_FIELD+1]     = { 0x8000000000000, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF, 0xFFFFFFFFFFFFF,
+                                                       0xA4FC3C547757F, 0xBE63B71F64B42, 0x3B6D4ACD8D09F, 0x4274C33EB75F4,
+                                                       0x5A822E592BA40, 0xFCBDD6E3342B1, 0xA0FB8E0709484, 0x000000037F2EA };
+// Montgomery constants of the lane-parallel arithmetic: Montgomery_R2_r52 = (2^780)^2 mod p751 and Montgomery_one_r52 = 2^780 mod p751
+const uint64_t Montgomery_R2_r52[NWORDS52_FIELD]   = { 0xDAD40589641FD, 0x452A233046449, 0xEDB010161A696, 0x36941472E3FD8,
+                                                       0xE2082A2E7065E, 0x904F8751F40BF, 0x7FC814932CCA8, 0x33F174B08B2EE,
+                                                       0x9814EFB9F1375, 0x99594A1AFE512, 0x43C75310DE66D, 0x197021A5B37B0,
+                                                       0xCC1A272E73959, 0xA733D7C97CD76, 0x0000000292EE8 };
+const uint64_t Montgomery_one_r52[NWORDS52_FIELD]  = { 0x00000249AD67C, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+                                                       0x0000000000000, 0x0000000000000, 0x0000000000000, 0x1F9800C542C00,
+                                                       0xB326488FE3B2A, 0xE6176236DB777, 0xDD6E970232B83, 0xD4D762277573F,
+                                                       0x54CD16C015F35, 0x9FC72438C4FC7, 0x00000001BF8F6 };
+#endif
+
+
 // Fixed parameters for isogeny tree computation
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
@@ -869,6 +908,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
 
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(pre_for_Alice,        (OALICE_BITS - 1) * NWORDS64_FIELD)                 \
+    X(pre_for_Bob,          (OBOB_BITS + 5) * NWORDS64_FIELD)                   \
+    WINDOW_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy751
 #define fpzero                        fpzero751
@@ -893,24 +938,65 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2div2                       fp2div2_751
 #define fp2correction                 fp2correction751
 #define fp2mul_mont                   fp2mul751_mont
+#define fp2mul_add_mont               fp2mul_add751_mont
+#define fp2mulsub_mont                fp2mulsub751_mont
 #define fp2sqr_mont                   fp2sqr751_mont
 #define fp2inv_mont                   fp2inv751_mont
 #define fp2inv_mont_bingcd            fp2inv751_mont_bingcd
 #define fpequal_non_constant_time     fpequal751_non_constant_time
 #define mp_add_asm                    mp_add751_asm
+#define mp_addx2_asm                  mp_add751x2_asm
 #define mp_subaddx2_asm               mp_subadd751x2_asm
 #define mp_dblsubx2_asm               mp_dblsub751x2_asm
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751
+#define crypto_kem_keypair_x8         crypto_kem_keypair_x8_SIKEp751
+#define crypto_kem_enc_x8             crypto_kem_enc_x8_SIKEp751
+#define crypto_kem_dec_x8             crypto_kem_dec_x8_SIKEp751
+#define crypto_kem_enc_concurrent     crypto_kem_enc_concurrent_SIKEp751
 #define random_mod_order_A            random_mod_order_A_SIDHp751
 #define random_mod_order_B            random_mod_order_B_SIDHp751
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp751
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp751
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp751
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751
+#define tables_load                   tables_load_p751
+#define tables_unload                 tables_unload_p751
+#define sidh_set_ladder               sidh_set_ladder_p751
+#define sidh_get_ladder               sidh_get_ladder_p751
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp751
+#define EphemeralKeyGeneration_B_ladder EphemeralKeyGeneration_B_ladder_SIDHp751
+#define EphemeralKeyGenerationAgreement_A EphemeralKeyGenerationAgreement_A_SIDHp751
+#define crypto_kem_keypair_ladder     crypto_kem_keypair_ladder_SIKEp751
+#define crypto_kem_enc_ladder         crypto_kem_enc_ladder_SIKEp751
+#define crypto_kem_dec_ladder         crypto_kem_dec_ladder_SIKEp751
+#define sidh_opcount                  sidh_opcount_p751
+#define keypool_start                 keypool_start_p751
+#define keypool_stop                  keypool_stop_p751
+#define keypool_stats                 keypool_stats_p751
+#define sidh_workers_stop             sidh_workers_stop_p751
+#define crypto_kem_keypair_pooled     crypto_kem_keypair_pooled_SIKEp751
+#define EphemeralKeyPair_A_pooled     EphemeralKeyPair_A_pooled_SIDHp751
+#define EphemeralKeyPair_B_pooled     EphemeralKeyPair_B_pooled_SIDHp751
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#else
+    #include "P751_window_tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
+#include "../isogeny_mt.c"
 #include "../sidh.c"
-#include "../sike.c"
\ No newline at end of file
+#if defined(LANES_AVX512IFMA)
+    #include "../fpx_x8.c"
+    #include "../ec_isogeny_x8.c"
+    #include "../sidh_x8.c"
+#endif
+#include "../fpx_x2.c"
+#include "../ec_isogeny_x2.c"
+#include "../sidh_x2.c"
+#include "../sike.c"
+#include "../keypool.c"
\ No newline at end of file
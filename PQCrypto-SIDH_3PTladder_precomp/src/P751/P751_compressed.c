@@ -950,28 +950,6 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
 
-// Fixed traversal strategies for Pohlig-Hellman discrete logs
-const unsigned int ph2_path[PLEN_2] = {
-  #ifdef COMPRESSED_TABLES
-      #ifdef ELL2_TORUS
-          #if W_2 == 4
-            0, 0, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 13, 13, 13, 14, 14, 15, 16, 17, 18, 19, 19, 19, 19, 20, 21, 22, 22, 23, 24, 25, 26, 27, 27, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 34, 34, 35, 36, 37, 38, 39, 40, 40, 40, 40, 41, 42, 42, 42, 42, 42, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 52, 53, 54, 55, 56, 57, 58, 59, 59, 59, 59, 59, 59, 59
-          #endif
-     #endif
-  #endif
-};
-
-const unsigned int ph3_path[PLEN_3] = {
-  #ifdef COMPRESSED_TABLES
-    #ifdef ELL3_FULL_SIGNED
-        #if W_3 == 3
-          0, 0, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 13, 13, 13, 13, 14, 15, 16, 17, 18, 19, 19, 19, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 28, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52
-        #endif
-    #endif 
-  #endif
-};
-
-
 // Entangled bases related static tables and parameters
 
 // Constants u and u0 where u = u0^2 in F_{p^2} \ F_p used in entagled basis generation
@@ -1127,6 +1105,26 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 {0x95B9273E98BEE101,0x6CF2C2CC7C2F0D29,0xEFE3B76E594AA11B,0x3DDEDCDD1FE42241,0xF7E15F986E39CC89,0x3CF9E152B6FD333B,0xE7F2CF0844AD69DD,0xB792DFF3C762D02E,0x3888F4A332FD9030,0x8A4CC0E4C437575A,0x833E2BA7BAF41403,0x135FE5EBD4BB,0x657D9769E52DAD91,0x84951CC10B514173,0x7678CDEC0CC5511B,0xD4E7DB99FC763848,0xC6ADD473DF8087CE,0x842DE2D06829FA76,0xD086DB2A4651BE48,0xD0399255E5DAD344,0x6B2EAEB21B8BB524,0xF6DE9148F0694AEF,0x5A85093194755805,0x2570D86C9FCF},
 {0xD665CD614A703CBD,0x7251A4FFE04E2B30,0x8AD6A13EAA0B07BC,0x2AB5112D91260BE2,0xF31D78441E75FDE5,0x981D1D465A8768E6,0x7AD08CCEE352CCDD,0x31C6C60ACD409AC7,0xDFC10AD642C330AA,0x16DA3C495AE40C44,0x89AB4B294D700C6D,0x13081265A555,0xB649623190FAD2EC,0x9E0A9F4A626C11FD,0xEF8A6A8092D66371,0xEB9370EA38CC1EED,0x74BF8D8667FFF12C,0xF931EE21E90FE5CA,0x5E180EC10EC59AE0,0xBA6729A7EF221E52,0xAEAB0D0AC6ED85F9,0x2401EAF62859B015,0xD309B49CD60C1B34,0x2CBA9B452CC8}};
 
+// The ell=3 Pohlig-Hellman tables depend on whether W_3 divides eB
+#if (OBOB_EXPON % W_3 == 0)
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T,                DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#else
+#define PH3_TABLE_LIST(X)                                                       \
+    X(ph3_T1,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)        \
+    X(ph3_T2,               DLEN_3 * (ELL3_W >> 1) * 2 * NWORDS64_FIELD)
+#endif
+
+// Tables read from a table bundle at runtime when the library is built with TABLE_BUNDLE, see tables.c
+#define TABLE_BUNDLE_LIST(X)                                                    \
+    X(T_tate3,              (6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD)        \
+    X(T_tate2_firststep_P,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_P,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(T_tate2_firststep_Q,  4 * NWORDS64_FIELD)                                 \
+    X(T_tate2_Q,            3 * (OALICE_BITS - 2) * NWORDS64_FIELD)             \
+    X(ph2_CT,               DLEN_2 * (ELL2_W >> 1) * NWORDS64_FIELD)            \
+    PH3_TABLE_LIST(X)
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy751
 #define fpzero                        fpzero751
@@ -1151,11 +1149,14 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2div2                       fp2div2_751
 #define fp2correction                 fp2correction751
 #define fp2mul_mont                   fp2mul751_mont
+#define fp2mul_add_mont               fp2mul_add751_mont
+#define fp2mulsub_mont                fp2mulsub751_mont
 #define fp2sqr_mont                   fp2sqr751_mont
 #define fp2inv_mont                   fp2inv751_mont
 #define fp2inv_mont_bingcd            fp2inv751_mont_bingcd
 #define fpequal_non_constant_time     fpequal751_non_constant_time
 #define mp_add_asm                    mp_add751_asm
+#define mp_addx2_asm                  mp_add751x2_asm
 #define mp_subaddx2_asm               mp_subadd751x2_asm
 #define mp_dblsubx2_asm               mp_dblsub751x2_asm
 #define random_mod_order_A            random_mod_order_A_SIDHp751
@@ -1167,12 +1168,30 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751_compressed
+#define tables_load                   tables_load_p751_compressed
+#define tables_unload                 tables_unload_p751_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp751_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp751_Compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp751_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp751_compressed
+#define sidh_workspace_size           sidh_workspace_size_p751_compressed
+#define sidh_set_checkpoint           sidh_set_checkpoint_p751_compressed
+#define sidh_get_checkpoint           sidh_get_checkpoint_p751_compressed
+#define sidh_set_dlog_threads         sidh_set_dlog_threads_p751_compressed
+#define sidh_get_dlog_threads         sidh_get_dlog_threads_p751_compressed
+#define sidh_workers_stop             sidh_workers_stop_p751_compressed
 
 
 #include "../fpx.c"
+#if defined(TABLE_BUNDLE)
+    #include "../tables.c"
+#endif
 #include "../ec_isogeny.c"
+#include "../workers.c"
 #include "../compression/torsion_basis.c"
-#include "P751_compressed_pair_tables.c"
+#if !defined(TABLE_BUNDLE)
+    #include "P751_compressed_pair_tables.c"
+#endif
 #include "../compression/pairing.c"
 #include "P751_compressed_dlog_tables.c"
 #include "../compression/dlog.c"
@@ -27,6 +27,7 @@ inline void mp_sub751_p2(const digit_t* a, const digit_t* b, digit_t* c)
     for (i = 0; i < NWORDS_FIELD; i++) {
         ADDC(borrow, c[i], ((digit_t*)p751x2)[i], borrow, c[i]); 
     }
+    OPCOUNT(SUB, 1);
 } 
 
 
@@ -42,6 +43,7 @@ inline void mp_sub751_p4(const digit_t* a, const digit_t* b, digit_t* c)
     for (i = 0; i < NWORDS_FIELD; i++) {
         ADDC(borrow, c[i], ((digit_t*)p751x4)[i], borrow, c[i]); 
     }
+    OPCOUNT(SUB, 1);
 }   
 
 
@@ -66,6 +68,7 @@ inline void fpadd751(const digit_t* a, const digit_t* b, digit_t* c)
     for (i = 0; i < NWORDS_FIELD; i++) {
         ADDC(carry, c[i], ((digit_t*)p751x2)[i] & mask, carry, c[i]); 
     }
+    OPCOUNT(ADD, 1);
 } 
 
 
@@ -85,6 +88,7 @@ inline void fpsub751(const digit_t* a, const digit_t* b, digit_t* c)
     for (i = 0; i < NWORDS_FIELD; i++) {
         ADDC(borrow, c[i], ((digit_t*)p751x2)[i] & mask, borrow, c[i]); 
     }
+    OPCOUNT(SUB, 1);
 }
 
 
@@ -200,6 +204,39 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
     c[2*nwords-1] = v; 
 }
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = nwords.
+  // Each cross product a[j]*a[i-j], j < i-j, is computed once and accumulated twice.
+    unsigned int i, j;
+    digit_t t = 0, u = 0, v = 0, UV[2];
+    unsigned int carry = 0;
+    
+    for (i = 0; i < 2*nwords-1; i++) {
+        j = (i < nwords) ? 0 : i-nwords+1;
+        for (; j < i-j; j++) {
+            MUL(a[j], a[i-j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        if (j == i-j) {
+            MUL(a[j], a[j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        c[i] = v;
+        v = u; 
+        u = t;
+        t = 0;
+    }
+    c[2*nwords-1] = v; 
+}
+
+
 
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Efficient Montgomery reduction using comba and exploiting the special form of the prime p751.
@@ -2,8 +2,16 @@
 * SIDH: an efficient supersingular isogeny cryptography library
 *
 * Abstract: Pohlig-Hellman with optimal strategy
+*           The four discrete logs of a compressed public key are independent. With _PARALLEL_, solve_dlogs() 
+*           spreads them over the calling thread and up to DLOG_THREADS_MAX-1 threads of the worker pool 
+*           (see workers.c): every thread takes the next log left until none remains. The two subtrees 
+*           of a traversal are not independent (the right one starts from r multiplied by the digits found in 
+*           the left one), so each log is solved by a single thread.
 *********************************************************************************************/
 
+#if defined(_PARALLEL_)
+    #include <stdatomic.h>
+#endif
 
 
 void from_base(int *D, digit_t *r, int Dlen, int base) 
@@ -410,17 +418,107 @@ void solve_dlog(const f2elm_t r, int *D, digit_t* d, int ell)
     if (ell == 2) {
         felm_t rproj[2];
         toproj(r, rproj);  
-        Traverse_w_div_e_torus(rproj, 0, 0, PLEN_2 - 1, ph2_path, (const felm_t *)&ph2_CT, D, DLEN_2, ELL2_W, W_2);
+        Traverse_w_div_e_torus(rproj, 0, 0, PLEN_2 - 1, ph2_path, (const felm_t *)ph2_CT, D, DLEN_2, ELL2_W, W_2);
 
         from_base(D, d, DLEN_2, ELL2_W);
     } else if (ell == 3) {
         #if (OBOB_EXPON % W_3 == 0)
-            Traverse_w_div_e_fullsigned(r, 0, 0, PLEN_3 - 1, ph3_path, (const felm_t *)&ph3_T, D, DLEN_3, ELL3_W, W_3);
+            Traverse_w_div_e_fullsigned(r, 0, 0, PLEN_3 - 1, ph3_path, (const felm_t *)ph3_T, D, DLEN_3, ELL3_W, W_3);
         #else          
-            Traverse_w_notdiv_e_fullsigned(r, 0, 0, PLEN_3 - 1, ph3_path, (const felm_t *)&ph3_T1, (const felm_t *)&ph3_T2, D, DLEN_3, ell, ELL3_W, ELL3_EMODW, W_3, OBOB_EXPON);                    
+            Traverse_w_notdiv_e_fullsigned(r, 0, 0, PLEN_3 - 1, ph3_path, (const felm_t *)ph3_T1, (const felm_t *)ph3_T2, D, DLEN_3, ell, ELL3_W, ELL3_EMODW, W_3, OBOB_EXPON);                    
         #endif     
         from_base(D, d, DLEN_3, ELL3_W);
     }    
 }
 
 
+#define DLOG_LOGS          4                      // Discrete logs of a compressed public key
+#define DLOG_DLEN          ((DLEN_2 > DLEN_3) ? DLEN_2 : DLEN_3)
+
+static setting_t dlog_threads = DLOG_THREADS_AUTO;
+
+
+int sidh_set_dlog_threads(unsigned int n)
+{ // Sets the number of threads solving the discrete logs of a compressed public key
+    if (n > DLOG_THREADS_MAX) return -1;
+    setting_store(&dlog_threads, n);
+    return 0;
+}
+
+
+unsigned int sidh_get_dlog_threads(void)
+{ // Returns the number of threads solving the discrete logs of a compressed public key
+    return setting_load(&dlog_threads);
+}
+
+
+#if defined(_PARALLEL_)
+
+typedef struct {
+    const felm_t** r;
+    digit_t** d;
+    int ell;
+    atomic_uint next;                             // Next log to be taken
+} dlog_job_t;
+
+
+static void dlog_run(dlog_job_t* J)
+{ // Takes the logs of the job left, one at a time, until none remains
+    int D[DLOG_DLEN];
+    unsigned int i;
+
+    while ((i = atomic_fetch_add_explicit(&J->next, 1, memory_order_relaxed)) < DLOG_LOGS) {
+        solve_dlog(J->r[i], D, J->d[i], J->ell);
+    }
+}
+
+
+static void dlog_worker(void* arg, unsigned int id, unsigned int nworkers)
+{ // Worker job: solves logs of the job along with the calling thread
+    (void)id; (void)nworkers;
+    dlog_run((dlog_job_t*)arg);
+}
+
+
+static bool dlog_pool_solve(const felm_t** r, digit_t** d, const int ell)
+{ // Solves the logs on the calling thread and up to n-1 workers, for the number of threads n set. Returns false if a single 
+  // thread is asked for or if no worker is available.
+    dlog_job_t J;
+    worker_job_t job;
+    unsigned int n = setting_load(&dlog_threads), ncpus;
+
+    if (n == DLOG_THREADS_AUTO) {          // One thread per online processor
+        ncpus = workers_cpus();
+        n = (ncpus < DLOG_THREADS_MAX) ? ncpus : DLOG_THREADS_MAX;
+    }
+    if (n < 2) return false;
+
+    J.r = r;
+    J.d = d;
+    J.ell = ell;
+    atomic_init(&J.next, 0);
+    if (workers_post(&job, dlog_worker, &J, n-1) == 0) return false;
+    dlog_run(&J);
+    workers_wait(&job);
+    return true;
+}
+
+#endif
+
+
+void solve_dlogs(const f2elm_t* f, digit_t* d0, digit_t* c0, digit_t* d1, digit_t* c1, int ell)
+{ // Computes the discrete logs d0, c0, d1 and c1 of f[0], f[2], f[1] and f[3] as in solve_dlog()
+    const felm_t* r[DLOG_LOGS] = { f[0], f[2], f[1], f[3] };
+    digit_t* d[DLOG_LOGS] = { d0, c0, d1, c1 };
+    int D[DLOG_DLEN];
+    unsigned int i;
+
+#if defined(_PARALLEL_)
+    if (dlog_pool_solve(r, d, ell)) return;
+#endif
+    for (i = 0; i < DLOG_LOGS; i++) {
+        solve_dlog(r[i], D, d[i], ell);
+    }
+}
+
+
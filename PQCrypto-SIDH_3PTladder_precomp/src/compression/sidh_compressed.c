@@ -6,8 +6,71 @@
 
 #include "../random/random.h"
 #include <string.h>
+#include <stdint.h>
 
 
+// Checkpoint interval of Alice's key generation by default: 0 keeps the whole isogeny path, k >= 2 keeps one checkpoint
+// every k steps and recomputes the steps in between when the dual isogeny is evaluated (see eval_full_dual_4_isog)
+#if !defined(DUAL_CHECKPOINT)
+    #define DUAL_CHECKPOINT    0
+#elif (DUAL_CHECKPOINT > MAX_Alice)
+    #error -- "DUAL_CHECKPOINT is larger than the number of 4-isogenies"
+#endif
+
+// Rows of 5 elements in GF(p^2) of Alice's path with checkpoint interval k: the whole path, or the checkpoints, the 
+// 2-isogeny and k+1 rows for the recomputed steps
+#define DUAL_ROWS(k)         (((k) <= 1) ? MAX_Alice+1 : (MAX_Alice+(k)-1)/(k) + (k) + 2)
+
+// Workspaces of the key generations: the curves (Alice) or the kernels of the dual isogenies (Bob) along the isogeny path, 
+// kept for the torsion basis generation. The _ws functions read them from a caller-provided buffer instead of the stack, 
+// after checking its size against the checkpoint interval they use.
+#define WORKSPACE_A_BYTES(k) (sizeof(f2elm_t)*DUAL_ROWS(k)*5)
+#define WORKSPACE_B_BYTES    (sizeof(f2elm_t)*MAX_Bob*2)
+
+static setting_t sidh_checkpoint = DUAL_CHECKPOINT;
+
+
+int sidh_set_checkpoint(unsigned int k)
+{ // Sets the checkpoint interval of Alice's key generation
+    if (k == 1 || k > MAX_Alice) return -1;
+    setting_store(&sidh_checkpoint, k);
+    return 0;
+}
+
+
+unsigned int sidh_get_checkpoint(void)
+{
+    return setting_load(&sidh_checkpoint);
+}
+
+
+static unsigned int checkpoint_on_stack(void)
+{ // Checkpoint interval of the functions without workspace, whose stack holds DUAL_ROWS(DUAL_CHECKPOINT) rows
+    unsigned int k = setting_load(&sidh_checkpoint);
+
+    return (DUAL_ROWS(k) <= DUAL_ROWS(DUAL_CHECKPOINT)) ? k : DUAL_CHECKPOINT;
+}
+
+
+unsigned int sidh_workspace_size(unsigned int op)
+{ // Bytes of the workspace of op with the current checkpoint interval, or 0 if op is not a valid operation
+    switch (op) {
+        case WORKSPACE_KEYGEN_A:
+        case WORKSPACE_KEM_KEYPAIR:
+            return (unsigned int)WORKSPACE_A_BYTES(setting_load(&sidh_checkpoint));
+        case WORKSPACE_KEYGEN_B:
+        case WORKSPACE_KEM_ENC:
+            return (unsigned int)WORKSPACE_B_BYTES;
+        default:
+            return 0;
+    }
+}
+
+
+static bool workspace_valid(const void* workspace, unsigned int size, size_t needed)
+{ // Checks that the workspace of size bytes is aligned and holds at least needed bytes
+    return (workspace != NULL && ((uintptr_t)workspace & (WORKSPACE_ALIGN-1)) == 0 && size >= needed);
+}
 
 
 static void init_basis(digit_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
@@ -41,22 +104,27 @@ void random_mod_order_A(unsigned char* random_digits)
 }
 
 
-void random_mod_order_B(unsigned char* random_digits)
+int random_mod_order_B(unsigned char* random_digits)
 {  // Generation of Bob's secret key  
    // Outputs random value in [0, 2^Floor(Log(2, oB)) - 1]
+   // Returns the status of randombytes(): 0, or -1 if the random bytes could not be obtained
+    int status;
     
-    randombytes(random_digits, SECRETKEY_B_BYTES);
+    status = randombytes(random_digits, SECRETKEY_B_BYTES);
     FormatPrivKey_B(random_digits);
+    return status;
 }
 
 
-static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2elm_t a24, unsigned int sike)
+static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2elm_t a24, unsigned int sike, const unsigned int k)
 {
   // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
   // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+  // As receives the whole isogeny path if k <= 1, otherwise a checkpoint every k steps (see eval_full_dual_4_isog)
     point_proj_t R, pts[MAX_INT_POINTS_ALICE];
     f2elm_t XPA, XQA, XRA, coeff[5], A24 = {0}, C24 = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+    unsigned int i, c, t, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+    unsigned int aux = (k <= 1) ? MAX_Alice : (MAX_Alice+k-1)/k;    // Row of the 2-isogeny, after the checkpoints
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
 
     // Initialize basis points
@@ -85,8 +153,8 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
     xDBLe(R, S, A24, C24, (int)(OALICE_BITS-1));
     get_2_isog(S, A24, C24);
     eval_2_isog(R, S);
-    fp2copy(S->X, As[MAX_Alice][2]);
-    fp2copy(S->Z, As[MAX_Alice][3]);
+    fp2copy(S->X, As[aux][2]);
+    fp2copy(S->Z, As[aux][3]);
 #endif
 
     // Traverse tree
@@ -101,13 +169,26 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
             index += m;
         }
 
-        fp2copy(A24, As[row-1][0]);
-        fp2copy(C24, As[row-1][1]);
+        if (k <= 1) {
+            fp2copy(A24, As[row-1][0]);
+            fp2copy(C24, As[row-1][1]);
+        } else if ((row-1) % k == 0) {
+            // Checkpoint c: the curve and the kernel of the next n steps, 4^t times the generator of the rest of the path with 
+            // t = MAX_Alice-row+1-n, doubled from the point of the stack (index 0 at least) with the largest index up to t
+            c = (row-1)/k;
+            t = MAX_Alice - row + 1 - ((c == aux-1) ? MAX_Alice - c*k : k);
+            for (i = npts; pts_index[i-1] > t; i--);
+            fp2copy(A24, As[c][0]);
+            fp2copy(C24, As[c][1]);
+            xDBLe(pts[i-1], (point_proj*)(As[c]+2), A24, C24, (int)(2*(t - pts_index[i-1])));
+        }
         get_4_isog_dual(R, A24, C24, coeff);
         for (i = 0; i < npts; i++) {
             eval_4_isog(pts[i], coeff);
         }
-        eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+row-1)+2);
+        if (k <= 1) {
+            eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+row-1)+2);
+        }
 
         fp2copy(pts[npts-1]->X, R->X);
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -115,23 +196,30 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
         npts -= 1;
     }
 
-    fp2copy(A24, As[MAX_Alice-1][0]);
-    fp2copy(C24, As[MAX_Alice-1][1]);
-    get_4_isog_dual(R, A24, C24, coeff);
-    eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+MAX_Alice-1)+2);
-    fp2copy(A24, As[MAX_Alice][0]);
-    fp2copy(C24, As[MAX_Alice][1]);
+    if (k <= 1) {
+        fp2copy(A24, As[MAX_Alice-1][0]);
+        fp2copy(C24, As[MAX_Alice-1][1]);
+        get_4_isog_dual(R, A24, C24, coeff);
+        eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+MAX_Alice-1)+2);
+        fp2copy(A24, As[MAX_Alice][0]);
+        fp2copy(C24, As[MAX_Alice][1]);
+    } else {
+        if ((MAX_Alice-1) % k == 0) {    // Checkpoint of the last step alone
+            fp2copy(A24, As[aux-1][0]);
+            fp2copy(C24, As[aux-1][1]);
+            fp2copy(R->X, As[aux-1][2]);
+            fp2copy(R->Z, As[aux-1][3]);
+        }
+        get_4_isog_dual(R, A24, C24, coeff);
+    }
     fp2inv_mont_bingcd(C24);
     fp2mul_mont(A24, C24, a24);
 }
 
 
-static void Dlogs3_dual(const f2elm_t *f, int *D, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1)
+static void Dlogs3_dual(const f2elm_t *f, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1)
 {
-    solve_dlog(f[0], D, d0, 3);    
-    solve_dlog(f[2], D, c0, 3);
-    solve_dlog(f[1], D, d1, 3);     
-    solve_dlog(f[3], D, c1, 3);    
+    solve_dlogs(f, d0, c0, d1, c1, 3);
     mp_sub((digit_t*)Bob_order, c0, c0, NWORDS_ORDER);    
     mp_sub((digit_t*)Bob_order, c1, c1, NWORDS_ORDER);  
 }
@@ -249,19 +337,18 @@ static void Compress_PKA_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
 }
 
 
-static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
-{ // Alice's ephemeral public key generation using compression -- SIKE protocol
-  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
+static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigned char* CompressedPKA, unsigned int sike, f2elm_t As[][5], const unsigned int k)
+{ // Alice's ephemeral public key generation using compression, with the workspace As of DUAL_ROWS(k) rows
+  // If sike = 1, output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
     unsigned int rs[3];
-    int D[DLEN_3];
-    f2elm_t a24, As[MAX_Alice+1][5], f[4];
+    f2elm_t a24, f[4];
     digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
     point_full_proj_t Rs[2];
 
-    FullIsogeny_A_dual(PrivateKeyA, As, a24, 1);
-    BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2]);
+    FullIsogeny_A_dual(PrivateKeyA, As, a24, sike, k);
+    BuildOrdinary3nBasis_dual(a24, As, k, Rs, rs, &rs[2]);
     Tate3_pairings(Rs, f);
-    Dlogs3_dual(f, D, d0, c0, d1, c1);
+    Dlogs3_dual(f, d0, c0, d1, c1);
     Compress_PKA_dual(d0, c0, d1, c1, a24, rs, CompressedPKA);
     return 0;
 }
@@ -269,19 +356,19 @@ static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigne
 
 int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
 { // Alice's ephemeral public key generation using compression -- SIDH protocol
-  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
-    unsigned int rs[3];
-    int D[DLEN_3];
-    f2elm_t a24, As[MAX_Alice+1][5], f[4];
-    digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
-    point_full_proj_t Rs[2];
+    f2elm_t As[DUAL_ROWS(DUAL_CHECKPOINT)][5];
 
-    FullIsogeny_A_dual((unsigned char*)PrivateKeyA, As, a24, 0);
-    BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2]);
-    Tate3_pairings(Rs, f);
-    Dlogs3_dual(f, D, d0, c0, d1, c1);
-    Compress_PKA_dual(d0, c0, d1, c1, a24, rs, CompressedPKA);
-    return 0;
+    return EphemeralKeyGeneration_A_extended((unsigned char*)PrivateKeyA, CompressedPKA, 0, As, checkpoint_on_stack());
+}
+
+
+int EphemeralKeyGeneration_A_ws(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA, void* workspace, unsigned int size)
+{ // Alice's ephemeral public key generation using compression -- SIDH protocol, in a workspace of size >= sidh_workspace_size(WORKSPACE_KEYGEN_A) bytes
+    unsigned int k = setting_load(&sidh_checkpoint);    // Read once: the interval may change meanwhile
+
+    if (!workspace_valid(workspace, size, WORKSPACE_A_BYTES(k))) return -1;
+
+    return EphemeralKeyGeneration_A_extended((unsigned char*)PrivateKeyA, CompressedPKA, 0, (f2elm_t(*)[5])workspace, k);
 }
 
 
@@ -401,12 +488,9 @@ static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2]
 }
 
 
-static void Dlogs2_dual(const f2elm_t *f, int *D, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1)
+static void Dlogs2_dual(const f2elm_t *f, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1)
 {
-    solve_dlog(f[0], D, d0, 2);
-    solve_dlog(f[2], D, c0, 2);
-    solve_dlog(f[1], D, d1, 2);
-    solve_dlog(f[3], D, c1, 2);
+    solve_dlogs(f, d0, c0, d1, c1, 2);
     mp_sub((digit_t*)Alice_order, c0, c0, NWORDS_ORDER);
     mp_sub((digit_t*)Alice_order, c1, c1, NWORDS_ORDER);
 }
@@ -617,12 +701,11 @@ static void Compress_PKB_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
 }
 
 
-static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, unsigned int sike)
-{ // Bob's ephemeral public key generation using compression -- SIKE protocol
+static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, unsigned int sike, f2elm_t Ds[][2])
+{ // Bob's ephemeral public key generation using compression -- SIKE protocol if sike = 1, with the workspace Ds of MAX_Bob rows
     unsigned char qnr, ind;
-    int D[DLEN_2] = {0};
     digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
-    f2elm_t Ds[MAX_Bob][2] = {0}, f[4] = {0}, A = {0};
+    f2elm_t f[4] = {0}, A = {0};
     point_full_proj_t Rs[2] = {0};
     point_t Pw, Qw;
 
@@ -649,7 +732,7 @@ static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, u
     fp2correction(f[2]);
     fp2correction(f[3]);
 
-    Dlogs2_dual(f, D, d0, c0, d1, c1);
+    Dlogs2_dual(f, d0, c0, d1, c1);
     if (sike == 1)
         Compress_PKB_dual_extended(d0, c0, d1, c1, A, qnr, ind, CompressedPKB);  
     else
@@ -661,8 +744,17 @@ static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, u
 
 int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB)
 { // Bob's ephemeral public key generation using compression -- SIDH protocol
+    f2elm_t Ds[MAX_Bob][2];
+
+    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0, Ds);
+}
+
+
+int EphemeralKeyGeneration_B_ws(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, void* workspace, unsigned int size)
+{ // Bob's ephemeral public key generation using compression -- SIDH protocol, in a workspace of size >= sidh_workspace_size(WORKSPACE_KEYGEN_B) bytes
+    if (!workspace_valid(workspace, size, WORKSPACE_B_BYTES)) return -1;
 
-    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0);
+    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0, (f2elm_t(*)[2])workspace);
 }
 
 
@@ -8,8 +8,8 @@
 #include "../sha3/fips202.h"
 
 
-int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
-{ // SIKE's key generation using compression
+static int kem_keypair(unsigned char *pk, unsigned char *sk, f2elm_t As[][5], const unsigned int k)
+{ // SIKE's key generation using compression, with the workspace As of Alice's key generation with checkpoint interval k
   // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES + FP2_ENCODED_BYTES bytes)
   //          public key pk_comp (CRYPTO_PUBLICKEYBYTES bytes) 
     
@@ -18,7 +18,7 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
     random_mod_order_A(sk + MSG_BYTES);    // Even random number
 
     // Generate public key pk
-    EphemeralKeyGeneration_A_extended(sk + MSG_BYTES, pk);
+    EphemeralKeyGeneration_A_extended(sk + MSG_BYTES, pk, 1, As, k);
 
     // Append public key pk to secret key sk
     memcpy(&sk[MSG_BYTES + SECRETKEY_A_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
@@ -27,38 +27,79 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
 }
 
 
-int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
-{ // SIKE's encapsulation using compression
+int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation using compression
+    f2elm_t As[DUAL_ROWS(DUAL_CHECKPOINT)][5];
+
+    return kem_keypair(pk, sk, As, checkpoint_on_stack());
+}
+
+
+int crypto_kem_keypair_ws(unsigned char *pk, unsigned char *sk, void* workspace, unsigned int size)
+{ // SIKE's key generation using compression, in a workspace of size >= sidh_workspace_size(WORKSPACE_KEM_KEYPAIR) bytes
+    unsigned int k = setting_load(&sidh_checkpoint);
+
+    if (!workspace_valid(workspace, size, WORKSPACE_A_BYTES(k))) return -1;
+
+    return kem_keypair(pk, sk, (f2elm_t(*)[5])workspace, k);
+}
+
+
+static int kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, f2elm_t Ds[][2])
+{ // SIKE's encapsulation using compression, with the workspace Ds of Bob's key generation
   // Input:   public key pk              (CRYPTO_PUBLICKEYBYTES bytes)
   // Outputs: shared secret ss           (CRYPTO_BYTES bytes)
   //          ciphertext message ct      (CRYPTO_CIPHERTEXTBYTES = PARTIALLY_COMPRESSED_CHUNK_CT + MSG_BYTES bytes)
     unsigned char ephemeralsk[SECRETKEY_B_BYTES] = {0};
     unsigned char jinvariant[FP2_ENCODED_BYTES] = {0};
     unsigned char h[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};
+    unsigned char m[MSG_BYTES];
+    shake256incctx shake;
 
     // Generate ephemeralsk <- G(m||pk) mod oB 
-    randombytes(temp, MSG_BYTES);    
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);        
-    shake256(ephemeralsk, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    randombytes(m, MSG_BYTES);    
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m, MSG_BYTES);
+    shake256_inc_absorb(&shake, pk, CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ephemeralsk, SECRETKEY_B_BYTES, &shake);
     FormatPrivKey_B(ephemeralsk);
     
     // Encrypt
-    EphemeralKeyGeneration_B_extended(ephemeralsk, ct, 1); 
+    EphemeralKeyGeneration_B_extended(ephemeralsk, ct, 1, Ds); 
     EphemeralSecretAgreement_B(ephemeralsk, pk, jinvariant);  
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);          
     for (int i = 0; i < MSG_BYTES; i++) {
-        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = temp[i] ^ h[i];
+        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = m[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);      
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m, MSG_BYTES);
+    shake256_inc_absorb(&shake, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &shake);
 
     return 0;
 }
 
 
+int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using compression
+    f2elm_t Ds[MAX_Bob][2];
+
+    return kem_enc(ct, ss, pk, Ds);
+}
+
+
+int crypto_kem_enc_ws(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void* workspace, unsigned int size)
+{ // SIKE's encapsulation using compression, in a workspace of size >= sidh_workspace_size(WORKSPACE_KEM_ENC) bytes
+    if (!workspace_valid(workspace, size, WORKSPACE_B_BYTES)) return -1;
+
+    return kem_enc(ct, ss, pk, (f2elm_t(*)[2])workspace);
+}
+
+
 int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
 { // SIKE's decapsulation using compression 
   // Input:   secret key sk                         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES + FP2_ENCODED_BYTES bytes)
@@ -66,7 +107,8 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
   // Outputs: shared secret ss                      (CRYPTO_BYTES bytes)
     unsigned char ephemeralsk_[SECRETKEY_B_BYTES] = {0};
     unsigned char jinvariant_[FP2_ENCODED_BYTES + 2*FP2_ENCODED_BYTES + SECRETKEY_A_BYTES] = {0}, h_[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};   
+    unsigned char m_[MSG_BYTES];
+    shake256incctx shake;
     unsigned char* tphiBKA_t = &jinvariant_[FP2_ENCODED_BYTES];
     
     // Decrypt 
@@ -74,21 +116,27 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);   
     
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
+        m_[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
     }     
     
     // Generate ephemeralsk_ <- G(m||pk) mod oB
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);            
-    shake256(ephemeralsk_, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m_, MSG_BYTES);
+    shake256_inc_absorb(&shake, &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ephemeralsk_, SECRETKEY_B_BYTES, &shake);
     FormatPrivKey_B(ephemeralsk_);
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
     // No need to recompress, just check if x(phi(P) + t*phi(Q)) == x((a0 + t*a1)*R1 + (b0 + t*b1)*R2)    
     int8_t selector = validate_ciphertext(ephemeralsk_, ct, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], tphiBKA_t);
     // If ct validation passes (selector = 0) then do ss = H(m||ct), otherwise (selector = -1) load s to do ss = H(s||ct)
-    ct_cmov(temp, sk, MSG_BYTES, selector);
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);  
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    ct_cmov(m_, sk, MSG_BYTES, selector);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m_, MSG_BYTES);
+    shake256_inc_absorb(&shake, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &shake);
 
     return 0;
 }
@@ -237,7 +237,7 @@ static bool SecondPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned
 }
 
 
-static void FirstPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, point_full_proj_t R, unsigned int *r, unsigned char *ind, unsigned char *bitEll)
+static void FirstPoint3n(const f2elm_t a24, f2elm_t As[][5], const unsigned int k, f2elm_t x, point_full_proj_t R, unsigned int *r, unsigned char *ind, unsigned char *bitEll)
 {
     bool b = false;
     point_proj_t P;
@@ -251,7 +251,7 @@ static void FirstPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, po
         fp2copy(x, P->X);
         fpcopy((digit_t*)&Montgomery_one, (P->Z)[0]);
         fpcopy(zero, (P->Z)[1]);
-        eval_full_dual_4_isog(As, P);    // Move x over to A = 0
+        eval_full_dual_4_isog(As, k, &P, 1);    // Move x over to A = 0
 
         b = FirstPoint_dual(P, R, ind);  // Compute DLog with 3-torsion points
         *r = *r + 1;
@@ -259,7 +259,7 @@ static void FirstPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, po
 }
 
 
-static void SecondPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, point_full_proj_t R, unsigned int *r, unsigned char ind, unsigned char *bitEll)
+static void SecondPoint3n(const f2elm_t a24, f2elm_t As[][5], const unsigned int k, f2elm_t x, point_full_proj_t R, unsigned int *r, unsigned char ind, unsigned char *bitEll)
 {
     bool b = false;
     point_proj_t P;
@@ -272,7 +272,7 @@ static void SecondPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, p
         fp2copy(x, P->X);
         fpcopy((digit_t*)&Montgomery_one, (P->Z)[0]);
         fpcopy(zero, (P->Z)[1]);
-        eval_full_dual_4_isog(As, P);    // Move x over to A = 0
+        eval_full_dual_4_isog(As, k, &P, 1);    // Move x over to A = 0
 
         b = SecondPoint_dual(P, R, ind);
         *r = *r + 1;
@@ -280,6 +280,44 @@ static void SecondPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, p
 }
 
 
+#define BASIS_CANDIDATES    4    // Elligator candidates moved over to A = 0 together when the isogeny path is checkpointed
+
+static void BothPoints3n(const f2elm_t a24, f2elm_t As[][5], const unsigned int k, f2elm_t *xs, point_full_proj_t *R, unsigned int *r, unsigned int *bitsEll)
+{ // Same outputs as FirstPoint3n and SecondPoint3n, but the candidates are moved over to A = 0 BASIS_CANDIDATES at a time, so 
+  // that each walk of a checkpointed isogeny path, which recomputes it, serves several of them
+    bool b;
+    point_proj_t P[BASIS_CANDIDATES];
+    f2elm_t x[BASIS_CANDIDATES];
+    unsigned char bit[BASIS_CANDIDATES], ind = 0;
+    unsigned int i, next = 0, found = 0;
+    felm_t zero = {0};
+
+    *bitsEll = 0;
+    while (found < 2) {
+        for (i = 0; i < BASIS_CANDIDATES; i++) {
+            bit[i] = 0;
+            Elligator2(a24, next + i, x[i], &bit[i], COMPRESSION);
+            fp2copy(x[i], P[i]->X);
+            fpcopy((digit_t*)&Montgomery_one, (P[i]->Z)[0]);
+            fpcopy(zero, (P[i]->Z)[1]);
+        }
+        eval_full_dual_4_isog(As, k, P, BASIS_CANDIDATES);    // Move x over to A = 0
+
+        for (i = 0; i < BASIS_CANDIDATES && found < 2; i++) {
+            if (found == 0) b = FirstPoint_dual(P[i], R[0], &ind);
+            else b = SecondPoint_dual(P[i], R[1], ind);
+            if (b) {
+                fp2copy(x[i], xs[found]);
+                r[found] = next + i + 1;
+                *bitsEll |= (unsigned int)bit[i] << found;
+                found++;
+            }
+        }
+        next += BASIS_CANDIDATES;
+    }
+}
+
+
 static void makeDiff(const point_full_proj_t R, point_full_proj_t S, const point_proj_t D)
 {
     f2elm_t t0, t1, t2;
@@ -342,21 +380,25 @@ static void BiQuad_affine(const f2elm_t a24, const f2elm_t x0, const f2elm_t x1,
 }
 
 
-static void BuildOrdinary3nBasis_dual(const f2elm_t a24, const f2elm_t As[][5], point_full_proj_t *R, unsigned int *r, unsigned int *bitsEll)
+static void BuildOrdinary3nBasis_dual(const f2elm_t a24, f2elm_t As[][5], const unsigned int k, point_full_proj_t *R, unsigned int *r, unsigned int *bitsEll)
 {
     point_proj_t D;
     f2elm_t xs[2];
     unsigned char ind, bit;
 
-    FirstPoint3n(a24, As, xs[0], R[0], r, &ind, &bit);
-    *bitsEll = (unsigned int)bit;
-    *(r+1) = *r;
-    SecondPoint3n(a24, As, xs[1], R[1], r+1, ind, &bit);
-    *bitsEll |= ((unsigned int)bit << 1);
+    if (k > 1) {
+        BothPoints3n(a24, As, k, xs, R, r, bitsEll);
+    } else {
+        FirstPoint3n(a24, As, k, xs[0], R[0], r, &ind, &bit);
+        *bitsEll = (unsigned int)bit;
+        *(r+1) = *r;
+        SecondPoint3n(a24, As, k, xs[1], R[1], r+1, ind, &bit);
+        *bitsEll |= ((unsigned int)bit << 1);
+    }
 
     // Get x-coordinate of difference
     BiQuad_affine(a24, xs[0], xs[1], D);
-    eval_full_dual_4_isog(As, D);    // Move x over to A = 0
+    eval_full_dual_4_isog(As, k, &D, 1);    // Move x over to A = 0
     makeDiff(R[0], R[1], D);
 }
 
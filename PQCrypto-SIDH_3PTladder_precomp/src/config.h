@@ -97,6 +97,14 @@
 #endif
 
 
+// Lane-parallel field arithmetic of the multi-buffer SIKE functions (crypto_kem_*_x8), used when the compiler targets AVX-512 IFMA
+// (e.g., -march=native on Ice Lake or later processors). Otherwise these functions process their lanes one after the other.
+
+#if (TARGET == TARGET_AMD64) && defined(FAST_IMPLEMENTATION) && defined(__AVX512F__) && defined(__AVX512IFMA__)
+    #define LANES_AVX512IFMA
+#endif
+
+
 // Extended datatype support
 
 #if defined(GENERIC_IMPLEMENTATION)                       
@@ -269,4 +277,57 @@ static inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
 #endif
 
 
+// Operation counters
+// With SIDH_OPCOUNT, the field and curve primitives count their calls in per-thread counters, see sidh_opcount_pXXX() in
+// PXXX_api.h. Otherwise OPCOUNT() expands to nothing.
+
+#define OPC_MUL             0       // Integer multiplications (mp_mul), 1 per GF(p) and 3 per GF(p^2) multiplication
+#define OPC_SQR             1       // Integer squarings (mp_sqr)
+#define OPC_RDC             2       // Montgomery reductions (rdc_mont)
+#define OPC_ADD             3       // GF(p) additions, with or without correction
+#define OPC_SUB             4       // GF(p) subtractions, with or without correction
+#define OPC_INV             5       // GF(p) inversions
+#define OPC_XDBL            6       // x-only doublings
+#define OPC_XTPL            7       // x-only triplings
+#define OPC_XDBLADD         8       // Montgomery ladder steps (simultaneous doubling and differential addition)
+#define OPC_XADD            9       // Differential and mixed additions of the 3-point ladders and the windowed comb
+#define OPC_GET_2_ISOG      10
+#define OPC_EVAL_2_ISOG     11
+#define OPC_GET_3_ISOG      12
+#define OPC_EVAL_3_ISOG     13
+#define OPC_GET_4_ISOG      14
+#define OPC_EVAL_4_ISOG     15
+#define OPC_COUNTERS        16
+
+#if (OS_TARGET == OS_WIN)
+    #define THREAD_LOCAL    __declspec(thread)
+#else
+    #define THREAD_LOCAL    __thread
+#endif
+
+// Library settings read and changed by any thread, e.g. the engine of sidh_set_ladder_pXXX()
+#if (COMPILER == COMPILER_VC)
+    #include <intrin.h>
+    typedef volatile long setting_t;
+
+static inline unsigned int setting_load(setting_t* s) { return (unsigned int)_InterlockedCompareExchange(s, 0, 0); }
+static inline void setting_store(setting_t* s, unsigned int v) { _InterlockedExchange(s, (long)v); }
+static inline bool setting_cas(setting_t* s, unsigned int expected, unsigned int v) { return _InterlockedCompareExchange(s, (long)v, (long)expected) == (long)expected; }
+#else
+    #include <stdatomic.h>
+    typedef atomic_uint setting_t;
+
+static inline unsigned int setting_load(setting_t* s) { return atomic_load(s); }
+static inline void setting_store(setting_t* s, unsigned int v) { atomic_store(s, v); }
+static inline bool setting_cas(setting_t* s, unsigned int expected, unsigned int v) { return atomic_compare_exchange_strong(s, &expected, v); }
+#endif
+
+#if defined(SIDH_OPCOUNT)
+    extern THREAD_LOCAL uint64_t opcounters[OPC_COUNTERS];
+    #define OPCOUNT(counter, n)    (opcounters[OPC_##counter] += (n))
+#else
+    #define OPCOUNT(counter, n)
+#endif
+
+
 #endif
@@ -21,6 +21,7 @@ void xDBL(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2e
     fp2mul_mont(A24plus, t1, t0);                   // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
     mp2_add(Q->Z, t0, Q->Z);                        // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
     fp2mul_mont(Q->Z, t1, Q->Z);                    // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+    OPCOUNT(XDBL, 1);
 }
 
 
@@ -47,6 +48,7 @@ void get_2_isog(const point_proj_t P, f2elm_t A, f2elm_t C)
     fp2sqr_mont(P->X, A);                           // A = X2^2
     fp2sqr_mont(P->Z, C);                           // C = Z2^2
     mp2_sub_p2(C, A, A);                            // A = Z2^2 - X2^2
+    OPCOUNT(GET_2_ISOG, 1);
 }
 
 
@@ -66,6 +68,7 @@ void eval_2_isog(point_proj_t P, point_proj_t Q)
     mp2_sub_p2(t0, t1, t3);                         // t3 = (X2+Z2)*(X-Z) - (X2-Z2)*(X+Z)
     fp2mul_mont(P->X, t2, P->X);                    // Xfinal
     fp2mul_mont(P->Z, t3, P->Z);                    // Zfinal
+    OPCOUNT(EVAL_2_ISOG, 1);
 }
 
 #endif
@@ -85,6 +88,7 @@ void get_4_isog(const point_proj_t P, f2elm_t A24plus, f2elm_t C24, f2elm_t* coe
     fp2sqr_mont(P->X, A24plus);                     // A24plus = X4^2
     mp2_add(A24plus, A24plus, A24plus);             // A24plus = 2*X4^2
     fp2sqr_mont(A24plus, A24plus);                  // A24plus = 4*X4^4
+    OPCOUNT(GET_4_ISOG, 1);
 }
 
 
@@ -109,6 +113,7 @@ void eval_4_isog(point_proj_t P, f2elm_t* coeff)
     mp2_sub_p2(P->Z, t0, t0);                       // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
     fp2mul_mont(P->X, t1, P->X);                    // Xfinal
     fp2mul_mont(P->Z, t0, P->Z);                    // Zfinal
+    OPCOUNT(EVAL_4_ISOG, 1);
 }
 
 
@@ -128,10 +133,8 @@ void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2
     mp2_sub_p2(t1, t3, t1);                         // t1 = 4*X^2 - (X+Z)^2 
     mp2_sub_p2(t1, t2, t1);                         // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
     fp2mul_mont(A24plus, t3, t5);                   // t5 = A24plus*(X+Z)^2 
-    fp2mul_mont(t3, t5, t3);                        // t3 = A24plus*(X+Z)^4
     fp2mul_mont(A24minus, t2, t6);                  // t6 = A24minus*(X-Z)^2
-    fp2mul_mont(t2, t6, t2);                        // t2 = A24minus*(X-Z)^4
-    mp2_sub_p2(t2, t3, t3);                         // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    fp2mulsub_mont(t2, t6, t3, t5, t3);             // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
     mp2_sub_p2(t5, t6, t2);                         // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
     fp2mul_mont(t1, t2, t1);                        // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
     fp2add(t3, t1, t2);                             // t2 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2] + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
@@ -140,6 +143,7 @@ void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2
     fp2sub(t3, t1, t1);                             // t1 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4 - [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
     fp2sqr_mont(t1, t1);                            // t1 = t1^2
     fp2mul_mont(t0, t1, Q->Z);                      // Z3 = 2*Z*t1
+    OPCOUNT(XTPL, 1);
 }
 
 
@@ -179,6 +183,7 @@ void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t
     mp2_add(t4, t4, t4);                            // t4 = 2(4*X^2 + (X+Z)^2 - (X-Z)^2) 
     mp2_add(t0, t4, t4);                            // t4 = 8*X^2 + 2*(X+Z)^2 - (X-Z)^2
     fp2mul_mont(t3, t4, A24plus);                   // A24plus = [4*X^2 - (X+Z)^2]*[8*X^2 + 2*(X+Z)^2 - (X-Z)^2]
+    OPCOUNT(GET_3_ISOG, 1);
 }
 
 
@@ -199,6 +204,7 @@ void eval_3_isog(point_proj_t Q, const f2elm_t* coeff)
     fp2sqr_mont(t0, t0);                          // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2
     fp2mul_mont(Q->X, t2, Q->X);                  // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2        
     fp2mul_mont(Q->Z, t0, Q->Z);                  // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+    OPCOUNT(EVAL_3_ISOG, 1);
 }
 
 
@@ -292,6 +298,7 @@ void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZP
     fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
     fp2mul_mont(Q->Z, XPQ, Q->Z);                   // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
     fp2mul_mont(Q->X, ZPQ, Q->X);                   // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2            
+    OPCOUNT(XDBLADD, 1);
 }
 
 
@@ -308,6 +315,7 @@ void xADD1(const felm_t xpre, point_proj_t Q, const f2elm_t XPQ, const f2elm_t Z
     fpsqr_mont(Q->X[0], Q->X[0]);
     fpmul_mont(Q->Z[0], XPQ[0], Q->Z[0]);
     fpmul_mont(Q->X[0], ZPQ[0], Q->X[0]);
+    OPCOUNT(XADD, 1);
 }
 
 
@@ -330,6 +338,7 @@ void xADD2(const felm_t xQ2, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZP
     fp2sqr_mont(Q->X, Q->X);
     fp2mul_mont(Q->Z, XPQ, Q->Z);
     fp2mul_mont(Q->X, ZPQ, Q->X);
+    OPCOUNT(XADD, 1);
 }
 
 
@@ -430,6 +439,7 @@ static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, con
 }
 
 
+#if !defined(PRECOMP_WINDOW)
 static void LADDER3PT_for_Alice(const felm_t xQ2, const digit_t* m, point_proj_t R, point_proj_t R2)
 {
     felm_t* pre;
@@ -496,6 +506,214 @@ static void LADDER3PT_for_Bob(const felm_t xP, const digit_t* m, point_proj_t R,
     mask = 0 - (digit_t)swap;
     swap_points(R, R2, mask);
 }
+#endif
+
+#if !defined(COMPRESS)
+// Montgomery ladder engine of the key generation (SIDH_LADDER_MONTGOMERY), it reads no precomputed table
+
+static void xDBLADD_for_Alice(point_proj_t P, point_proj_t Q, const felm_t XPQ, const felm_t A24)
+{ // Simultaneous doubling and differential addition.
+  // Input: projective Montgomery points P=(XP:ZP) and Q=(XQ:ZQ) such that xP=XP/ZP and xQ=XQ/ZQ, affine difference xPQ=x(P-Q) and Montgomery curve constant A24=(A+2)/4.
+  // Output: projective Montgomery points P <- 2*P = (X2P:Z2P) such that x(2P)=X2P/Z2P, and Q <- P+Q = (XQP:ZQP) such that = x(Q+P)=XQP/ZQP. 
+    felm_t t0, t1, t2;
+    fpadd(P->X[0], P->Z[0], t0);                        // t0 = XP+ZP
+    mp_sub_p2(P->X[0], P->Z[0], t1);                    // t1 = XP-ZP
+    fpsqr_mont(t0, P->X[0]);                            // XP = (XP+ZP)^2
+    mp_sub_p2(Q->X[0], Q->Z[0], t2);                    // t2 = XQ-ZQ
+    fpadd(Q->X[0], Q->Z[0], Q->X[0]);                   // XQ = XQ+ZQ
+    fpmul_mont(t0, t2, t0);                             // t0 = (XP+ZP)*(XQ-ZQ)
+    fpsqr_mont(t1, P->Z[0]);                            // ZP = (XP-ZP)^2
+    fpmul_mont(t1, Q->X[0], t1);                        // t1 = (XP-ZP)*(XQ+ZQ)
+    mp_sub_p2(P->X[0], P->Z[0], t2);                    // t2 = (XP+ZP)^2-(XP-ZP)^2
+    fpmul_mont(P->X[0], P->Z[0], P->X[0]);              // XP = (XP+ZP)^2*(XP-ZP)^2
+    fpmul_mont(A24, t2, Q->X[0]);                       // XQ = A24*[(XP+ZP)^2-(XP-ZP)^2]
+    mp_sub_p2(t0, t1, Q->Z[0]);                         // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+    fpadd(Q->X[0], P->Z[0], P->Z[0]);                   // ZP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2
+    fpadd(t0, t1, Q->X[0]);                             // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+    fpmul_mont(P->Z[0], t2, P->Z[0]);                   // ZP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+    fpsqr_mont(Q->Z[0], Q->Z[0]);                       // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fpsqr_mont(Q->X[0], Q->X[0]);                       // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    fpmul_mont(Q->Z[0], XPQ, Q->Z[0]);                  // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    OPCOUNT(XDBLADD, 1);
+}
+
+
+static void xDBLADD_for_Bob(point_proj_t P, point_proj_t Q, const felm_t XPQ)
+{ // Simultaneous doubling and differential addition.
+  // Input: projective Montgomery points P=(XP:ZP) and Q=(XQ:ZQ) such that xP=XP/ZP and xQ=XQ/ZQ, affine difference xPQ=x(P-Q) and Montgomery curve constant A24=(A+2)/4.
+  // Output: projective Montgomery points P <- 2*P = (X2P:Z2P) such that x(2P)=X2P/Z2P, and Q <- P+Q = (XQP:ZQP) such that = x(Q+P)=XQP/ZQP. 
+
+    felm_t t0, t1, t2, t3;
+    mp_addfast((P->X)[0], (P->Z)[0], t0);               // t0 = XP+ZP                   
+    mp_sub_p2((P->X)[0], (P->Z)[0], t1);                // t1 = XP-ZP
+    fpsqr_mont(t0, (P->X)[0]);                          // XP = (XP+ZP)^2
+    mp_sub_p2((Q->X)[0], (Q->Z)[0], t2);                // t2 = XQ-ZQ
+    mp_addfast((Q->X)[0], (Q->Z)[0], (Q->X)[0]);        // XQ = XQ+ZQ
+    fpmul_mont(t0, t2, t0);                             // t0 = (XP+ZP)*(XQ-ZQ)
+    fpsqr_mont(t1, (P->Z)[0]);                          // ZP = (XP-ZP)^2
+    mp_addfast((P->Z)[0], (P->Z)[0], t3);               // t3 = 2*(XP-ZP)^2
+    mp_addfast(t3, t3, t3);                             // t3 = 4*(XP-ZP)^2
+    fpmul_mont(t1, (Q->X)[0], t1);                      // t1 = (XP-ZP)*(XQ+ZQ)
+    mp_sub_p2((P->X)[0], (P->Z)[0], t2);                // t2 = (XP+ZP)^2-(XP-ZP)^2
+    fpmul_mont((P->X)[0], t3, (P->X)[0]);               // XP = 4*(XP+ZP)^2*(XP-ZP)^2
+    mp_addfast(t2, t2, (Q->X[0]));                      // XQ = 2*[(XP+ZP)^2-(XP-ZP)^2]
+    mp_sub_p2(t0, t1, (Q->Z)[0]);                       // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+    mp_addfast((Q->X)[0], t3, (P->Z)[0]);               // ZP = 2*[(XP+ZP)^2-(XP-ZP)^2]+4*(XP-ZP)^2
+    mp_addfast(t0, t1, (Q->X)[0]);                      // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+    fpmul_mont((P->Z)[0], t2, (P->Z)[0]);               // ZP = [2*[(XP+ZP)^2-(XP-ZP)^2]+4*(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+    fpsqr_mont((Q->Z)[0], (Q->Z)[0]);                   // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fpsqr_mont((Q->X)[0], (Q->X)[0]);                   // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    fpmul_mont((Q->Z)[0], XPQ, (Q->Z)[0]);              // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    OPCOUNT(XDBLADD, 1);
+}
+
+
+static void LADDERM_for_Alice(const digit_t* m, point_proj_t R0, point_proj_t R2, const f2elm_t A24plus, const f2elm_t C24)
+{
+    point_proj_t R = { 0 }, S0 = { 0 }, S2 = { 0 };
+    felm_t A24;
+    digit_t mask, masksign;
+    int i, nbits, bit, swap, prevbit = 0, sign = 0, prevsign = 0, swapsign;
+    nbits = OALICE_BITS;
+    fpcopy((digit_t*)&Montgomery_one, A24);
+    fpadd(A24, A24, A24);
+
+    // Initializing points
+    fpcopy((digit_t*)&DBL_QA[0], (R0->X)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)(R0->Z)[0]);
+    fpcopy((digit_t*)&DBL_QA[0], (R->X)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)(R->Z)[0]);
+    xDBL(R, R2, A24plus, C24);
+    fpcopy((R0->X)[0], (S0->X)[0]);
+    fpcopy((R0->Z)[0], (S0->Z)[0]);
+    fp2copy(R2->X, S2->X);
+    fp2copy(R2->Z, S2->Z);
+
+    // Main loop
+    for (i = nbits - 1; i > 0; i--) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX - 1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit & sign;
+        mask = 0 - (digit_t)swap;
+        swap_points(R0, R2, mask);
+        xDBLADD_for_Alice(R0, R2, (R->X)[0], A24);
+        prevsign = sign;
+        sign = bit | sign;
+        swapsign = prevsign ^ sign;
+        masksign = 0 - (digit_t)swapsign;
+        swap_points(S0, R0, masksign);
+        swap_points(S2, R2, masksign);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R0, R2, mask);
+}
+
+
+static void LADDERM_for_Bob(const felm_t xP, const digit_t* m, point_proj_t R0, point_proj_t R2)
+{
+    point_proj_t  R = { 0 }, S0 = { 0 }, S2 = { 0 };
+    digit_t mask, masksign;
+    f2elm_t A24plus = { 0 }, C24 = { 0 };
+    int i, nbits, bit, swap, prevbit = 0, sign = 0, prevsign = 0, swapsign;
+    nbits = OBOB_BITS + 1;                              // m = 4*SecretKeyB, see kernel_point_B()
+    fpcopy((digit_t*)&Montgomery_one, A24plus[0]);
+    fpadd(A24plus[0], A24plus[0], A24plus[0]);
+    fpadd(A24plus[0], A24plus[0], C24[0]);
+
+    // Initializing points
+    fpcopy(xP, (R0->X)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)(R0->Z)[0]);
+    fpcopy(xP, (R->X)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)(R->Z)[0]);
+    xDBL(R, R2, A24plus, C24);
+    fpcopy(xP, (S0->X)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)(S0->Z)[0]);
+    fp2copy(R2->X, S2->X);
+    fp2copy(R2->Z, S2->Z);
+
+    // Main loop
+    for (i = nbits - 1; i > -1; i--) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX - 1))) & 1;
+
+        swap = bit ^ prevbit;
+        prevbit = bit & sign;
+        mask = 0 - (digit_t)swap;
+        swap_points(R0, R2, mask);
+
+        xDBLADD_for_Bob(R0, R2, (R->X)[0]);
+
+        prevsign = sign;
+        sign = bit | sign;
+        swapsign = prevsign ^ sign;
+        masksign = 0 - (digit_t)swapsign;
+        swap_points(S0, R0, masksign);
+        swap_points(S2, R2, masksign);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R0, R2, mask);
+}
+
+
+static void plus_for_Alice(point_full_proj_t tR, point_full_proj_t tR0, point_proj_t R)
+{
+    felm_t tx = { 0 };
+    f2elm_t tx0 = { 0 }, u = { 0 }, u2 = { 0 }, v = { 0 }, v2 = { 0 }, v3 = { 0 }, a = { 0 }, r = { 0 };
+    fpadd((tR->X)[0], (tR->Z)[0], tx);
+    fpadd(tx, (tR->Z)[0], tx);
+    fp2add(tR0->X, tR0->Z, tx0);
+    fp2add(tx0, tR0->Z, tx0);
+    fpmul_mont((tR0->Y)[0], (tR->Z)[0], u[0]);
+    fpmul_mont((tR0->Y)[1], (tR->Z)[0], u[1]);
+    fpsub(u[0], (tR->Y)[0], u[0]);
+    fp2sqr_mont(u, u2);
+    fpmul_mont(tx0[0], (tR->Z)[0], v[0]);
+    fpmul_mont(tx0[1], (tR->Z)[0], v[1]);
+    fpsub(v[0], tx, v[0]);
+    fp2sqr_mont(v, v2);
+    fp2mul_mont(v, v2, v3);
+    fpmul_mont(v2[0], tx, r[0]);
+    fpmul_mont(v2[1], tx, r[1]);
+    fpmul_mont(u2[0], (tR->Z)[0], a[0]);
+    fpmul_mont(u2[1], (tR->Z)[0], a[1]);
+    fp2sub(a, v3, a);
+    fp2sub(a, r, a);
+    fp2sub(a, r, a);
+    fp2mul_mont(v, a, R->X);
+    fpmul_mont(v3[0], (tR->Z)[0], (R->Z)[0]);
+    fpmul_mont(v3[1], (tR->Z)[0], (R->Z)[1]);
+    fp2sub(R->X, R->Z, R->X);
+    fp2sub(R->X, R->Z, R->X);
+}
+
+
+static void RecoverY_for_Bob(point_proj_t R0, point_proj_t R1, felm_t XPB, felm_t YPB, point_full_proj_t R)
+{
+    felm_t t0, t1, t2, t3, x, y;
+    fpcopy(XPB, x);
+    fpcopy(YPB, y);
+    
+    fpmul_mont(x, (R0->Z)[0], t0);                      
+    mp_addfast(t0, (R0->X)[0], t1);                     
+    mp_sub_p2((R0->X)[0], t0, t2);                      
+    fpsqr_mont(t2, t2);                                 
+    fpmul_mont(t2, (R1->X)[0], t2);                     
+    fpmul_mont(x, (R0->X)[0], t3);                      
+    mp_addfast(t3, (R0->Z)[0], t3);                     
+    fpmul_mont(t1, t3, t1);                             
+    fpmul_mont(t1, (R1->Z)[0], t1);                     
+    mp_sub_p2(t1, t2, (R->Y)[0]);                       
+    mp_addfast(y, y, t0);                               
+    fpmul_mont(t0, (R0->Z)[0], t0);                     
+    fpmul_mont(t0, (R1->Z)[0], t0);                     
+    fpmul_mont(t0, (R0->X)[0], (R->X)[0]);              
+    fpmul_mont(t0, (R0->Z)[0], (R->Z)[0]);              
+    fpzero((R->X)[1]);
+    fpzero((R->Y)[1]);
+    fpzero((R->Z)[1]);
+}
+#endif
 
 
 static void LADDER3PT2(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A)
@@ -575,6 +793,7 @@ static void RecoverY_for_Alice(point_proj_t R0, point_proj_t R1, felm_t XQ, felm
 }
 
 
+#if !defined(PRECOMP_WINDOW)
 static void RecoverY3PT(point_proj_t R0, point_proj_t R1, point_proj_t R2, point_full_proj_t tR)
 {
     felm_t t0, t1, x, y;
@@ -595,6 +814,7 @@ static void RecoverY3PT(point_proj_t R0, point_proj_t R1, point_proj_t R2, point
     fpsqr_mont(t1, t1);
     fpmul_mont(t0, t1, tR->Y[0]);
 }
+#endif
 
 
 static void plus_for_Alice3(point_full_proj_t tR, point_full_proj_t tR0, point_proj_t R)
@@ -717,6 +937,136 @@ static void iso_for_Bob(point_proj_t R1, point_proj_t R2)
     fp2mul_mont(R1->Z, t3, R2->Z);
 }
 
+#if defined(PRECOMP_WINDOW) && !defined(COMPRESS)
+
+static void xyADD_mixed(const point_full_proj_t tR, const felm_t x, const felm_t y, point_full_proj_t R)
+{ // Mixed addition R = tR+(x, y) over GF(p) in homogeneous coordinates, on a curve y^2 = x^3+a*x+b. Requires tR != +-(x, y).
+  // Only the GF(p) parts of tR and R are used. Cost: 9M+2S
+    felm_t u, u2, v, v2, v3, a, r;
+
+    fpmul_mont(y, (tR->Z)[0], u);
+    fpsub(u, (tR->Y)[0], u);                            // u = y*Z1-Y1
+    fpsqr_mont(u, u2);
+    fpmul_mont(x, (tR->Z)[0], v);
+    fpsub(v, (tR->X)[0], v);                            // v = x*Z1-X1
+    fpsqr_mont(v, v2);
+    fpmul_mont(v, v2, v3);
+    fpmul_mont(v2, (tR->X)[0], r);
+    fpmul_mont(u2, (tR->Z)[0], a);
+    fpsub(a, v3, a);
+    fpsub(a, r, a);
+    fpsub(a, r, a);                                     // a = u^2*Z1-v^3-2*v^2*X1
+    fpmul_mont(v, a, (R->X)[0]);
+    fpsub(r, a, r);
+    fpmul_mont(u, r, r);
+    fpmul_mont(v3, (tR->Y)[0], u);
+    fpsub(r, u, (R->Y)[0]);
+    fpmul_mont(v3, (tR->Z)[0], (R->Z)[0]);
+    OPCOUNT(XADD, 1);
+}
+
+
+static unsigned int window_digit(const digit_t* m, const unsigned int first, const unsigned int last)
+{ // Returns the window of bits first, first+1, ..., min(first+PRECOMP_WINDOW, last)-1 of m
+    unsigned int i, bit, digit = 0;
+
+    for (i = 0; i < PRECOMP_WINDOW && first+i < last; i++) {
+        bit = (m[(first+i) >> LOG2RADIX] >> ((first+i) & (RADIX-1))) & 1;
+        digit |= bit << i;
+    }
+    return digit;
+}
+
+
+static void window_lookup(const felm_t* table, const unsigned int digit, felm_t x, felm_t y)
+{ // Constant-time lookup of the point (x, y) = table[digit-1] in a window of WINDOW_POINTS points stored as (x, y) pairs.
+  // digit = 0 returns table[0], the caller discards the result in that case
+    digit_t mask;
+    unsigned int i, j;
+
+    fpcopy(table[0], x);
+    fpcopy(table[1], y);
+    for (i = 1; i < WINDOW_POINTS; i++) {
+        mask = (((digit_t)((i+1) ^ digit) - 1) >> (RADIX-1));
+        mask = 0 - mask;                                // mask = 0xFF...FF if digit = i+1, else 0
+        for (j = 0; j < NWORDS_FIELD; j++) {
+            x[j] ^= mask & (x[j] ^ table[2*i][j]);
+            y[j] ^= mask & (y[j] ^ table[2*i+1][j]);
+        }
+    }
+}
+
+
+static void COMB_for_Alice(const digit_t* m, point_full_proj_t tR)
+{ // Windowed fixed-base replacement for LADDER3PT_for_Alice followed by RecoverY3PT: tR = S3+[m']Q2 on E6, where m' consists of
+  // bits 1..eA-3 of m. Each window of PRECOMP_WINDOW bits adds one point [v*2^(j*PRECOMP_WINDOW)]Q2 from window_for_Alice.
+  // The table stores x+2, i.e., the points on the short Weierstrass model y^2 = x^3-11x+14 of E6. The order-3 component of
+  // the accumulator rules out the exceptional cases of the addition, it is cleared later by xTPL as in the ladder.
+    felm_t* pre = (felm_t*)window_for_Alice;
+    point_full_proj_t tR2 = { 0 };
+    felm_t x, y;
+    digit_t mask;
+    unsigned int j, digit;
+
+    fp2zero(tR->X);
+    fp2zero(tR->Y);
+    fp2zero(tR->Z);
+    fpcopy(pre[0], (tR->X)[0]);
+    fpcopy(pre[1], (tR->Y)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (tR->Z)[0]);
+    pre = pre + 2;
+
+    for (j = 0; j < WINDOW_LEN_ALICE; j++) {
+        digit = window_digit(m, 1 + j*PRECOMP_WINDOW, OALICE_BITS - 2);
+        window_lookup(pre, digit, x, y);
+        xyADD_mixed(tR, x, y, tR2);
+        mask = (((digit_t)digit - 1) >> (RADIX-1)) - 1;   // mask = 0xFF...FF if digit != 0, else 0
+        swap_points2(tR, tR2, mask);
+        pre = pre + 2*WINDOW_POINTS;
+    }
+    fpsub((tR->X)[0], (tR->Z)[0], (tR->X)[0]);
+    fpsub((tR->X)[0], (tR->Z)[0], (tR->X)[0]);          // Back to the Montgomery model, x-2
+}
+
+
+static void COMB_for_Bob(const digit_t* m, point_full_proj_t tR)
+{ // Windowed fixed-base replacement for LADDER3PT_for_Bob followed by two doublings and RecoverY3PT: tR = [4m]PB0 on E0.
+  // Each window of PRECOMP_WINDOW bits adds one point [4v*2^(j*PRECOMP_WINDOW)]PB0 from window_for_Bob.
+  // The accumulator starts at T = (1, sqrt(2)) of order 4 which is subtracted at the end, so that only m = 0 hits an
+  // exceptional case, as in the ladder.
+    felm_t* pre = (felm_t*)window_for_Bob;
+    point_full_proj_t tR2 = { 0 };
+    felm_t x, y;
+    digit_t mask;
+    unsigned int j, digit;
+
+    fp2zero(tR->X);
+    fp2zero(tR->Y);
+    fp2zero(tR->Z);
+    fpcopy(pre[0], (tR->X)[0]);
+    fpcopy(pre[1], (tR->Y)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (tR->Z)[0]);
+    pre = pre + 2;
+
+    for (j = 0; j < WINDOW_LEN_BOB; j++) {
+        digit = window_digit(m, j*PRECOMP_WINDOW, OBOB_BITS - 1);
+        window_lookup(pre, digit, x, y);
+        xyADD_mixed(tR, x, y, tR2);
+        mask = (((digit_t)digit - 1) >> (RADIX-1)) - 1;   // mask = 0xFF...FF if digit != 0, else 0
+        swap_points2(tR, tR2, mask);
+        pre = pre + 2*WINDOW_POINTS;
+    }
+    fpcopy((digit_t*)window_for_Bob, x);
+    fpcopy((digit_t*)window_for_Bob + NWORDS_FIELD, y);
+    fpneg(y);
+    xyADD_mixed(tR, x, y, tR2);                         // tR = tR-T
+    fp2copy(tR2->X, tR->X);
+    fp2copy(tR2->Y, tR->Y);
+    fp2copy(tR2->Z, tR->Z);
+}
+
+#endif
+
 #ifdef COMPRESS
 
 
@@ -829,6 +1179,7 @@ void Double(point_proj_t P, point_proj_t Q, f2elm_t A24, const int k)
         fp2add(temp, bb, temp);
         fp2mul_mont(c, temp, Q->Z);
     }
+    OPCOUNT(XDBL, k);
 }
 
 
@@ -858,6 +1209,7 @@ void xTPL_fast(const point_proj_t P, point_proj_t Q, const f2elm_t A2)
        fp2sqr_mont(t2, t2);          // t2 = t2^2
        fp2mul_mont(P->X, t2, Q->X);  // x = x*t2
        fp2mul_mont(P->Z, t1, Q->Z);  // z = z*t1    
+    OPCOUNT(XTPL, 1);
 }
 
 
@@ -895,6 +1247,7 @@ void xDBL_e(const point_proj_t P, point_proj_t Q, const f2elm_t A24, const int e
         fp2add(temp, bb, temp);          // temp = A24 * ((xQ + zQ)^2 - (xQ - zQ)^2) + (xQ - zQ)^2
         fp2mul_mont(c, temp, Q->Z);      // temp =  (A24 * ((xQ + zQ)^2 - (xQ - zQ)^2) + (xQ - zQ)^2) * ((xQ + zQ)^2 - (xQ - zQ)^2)
     }
+    OPCOUNT(XDBL, e);
 }
 
 
@@ -922,9 +1275,7 @@ static void eval_dual_4_isog(const f2elm_t A24, const f2elm_t C24, const f2elm_t
     fp2sub(t2, t3, t2);
     fp2mul_mont(t2, t0, P->X);
     fp2mul_mont(t3, t1, P->Z);
-    fp2mul_mont(coeff[0], P->X, P->X);
-    fp2mul_mont(coeff[1], P->Z, t0);
-    fp2add(P->X, t0, P->X);
+    fp2mul_add_mont(coeff[0], P->X, coeff[1], P->Z, P->X);
     fp2mul_mont(coeff[2], P->Z, P->Z);
 }
 
@@ -978,16 +1329,82 @@ static void eval_final_dual_2_isog(point_proj_t P)
 }
 
 
-static void eval_full_dual_4_isog(const f2elm_t As[][5], point_proj_t P)
-{
-    // First all 4-isogenies
-    for(unsigned int i = 0; i < MAX_Alice; i++) {
-        eval_dual_4_isog(As[MAX_Alice-i][0], As[MAX_Alice-i][1], *(As+MAX_Alice-i-1)+2, P);
+#define DUAL_SEGMENT_POINTS    8    // Points kept by the balanced strategy of a segment of up to 256 steps
+
+static void get_dual_4_isog_segment(const f2elm_t* checkpoint, const unsigned int n, f2elm_t As[][5])
+{ // Recomputes n steps of Alice's isogeny path from a checkpoint [A24, C24, X, Z], where (X:Z) generates their kernel of order 4^n
+  // Output: As[0..n-1] = [A24, C24, dual coefficients] of the n steps, and As[n] = [A24, C24] of the last curve
+  // The kernels are found with a balanced strategy, which needs ceil(log2(n)) intermediate points
+    point_proj_t R, pts[DUAL_SEGMENT_POINTS];
+    f2elm_t A24, C24, coeff[5];
+    unsigned int i, row, m, index = 0, pts_index[DUAL_SEGMENT_POINTS], npts = 0;
+
+    fp2copy(checkpoint[0], A24);
+    fp2copy(checkpoint[1], C24);
+    fp2copy(checkpoint[2], R->X);
+    fp2copy(checkpoint[3], R->Z);
+
+    for (row = 1; row <= n; row++) {
+        while (index < n-row) {
+            fp2copy(R->X, pts[npts]->X);
+            fp2copy(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = (n-row-index+1)/2;
+            xDBLe(R, R, A24, C24, (int)(2*m));
+            index += m;
+        }
+
+        fp2copy(A24, As[row-1][0]);
+        fp2copy(C24, As[row-1][1]);
+        get_4_isog_dual(R, A24, C24, coeff);
+        for (i = 0; i < npts; i++) {
+            eval_4_isog(pts[i], coeff);
+        }
+        eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+row-1)+2);
+
+        if (npts > 0) {
+            fp2copy(pts[npts-1]->X, R->X);
+            fp2copy(pts[npts-1]->Z, R->Z);
+            index = pts_index[npts-1];
+            npts -= 1;
+        }
+    }
+    fp2copy(A24, As[n][0]);
+    fp2copy(C24, As[n][1]);
+}
+
+
+static void eval_full_dual_4_isog(f2elm_t As[][5], const unsigned int k, point_proj_t *P, const unsigned int npts)
+{ // Evaluates the dual of Alice's isogeny path at the npts points P, from the workspace As filled by FullIsogeny_A_dual with 
+  // checkpoint interval k. If k <= 1, As holds the whole path. Otherwise it holds ceil(MAX_Alice/k) checkpoints, the 2-isogeny 
+  // and k+1 rows in which the segments between checkpoints are recomputed, from the last one to the first one
+    unsigned int c, i, j, n, aux = MAX_Alice;
+
+    if (k <= 1) {
+        // First all 4-isogenies
+        for(i = 0; i < MAX_Alice; i++) {
+            for (j = 0; j < npts; j++) {
+                eval_dual_4_isog(As[MAX_Alice-i][0], As[MAX_Alice-i][1], *(As+MAX_Alice-i-1)+2, P[j]);
+            }
+        }
+    } else {
+        aux = (MAX_Alice+k-1)/k;
+        for (c = aux; c > 0; c--) {
+            n = (c == aux) ? MAX_Alice - (c-1)*k : k;
+            get_dual_4_isog_segment(As[c-1], n, As+aux+1);
+            for (i = n; i > 0; i--) {
+                for (j = 0; j < npts; j++) {
+                    eval_dual_4_isog(As[aux+1+i][0], As[aux+1+i][1], *(As+aux+i)+2, P[j]);
+                }
+            }
+        }
     }
+    for (j = 0; j < npts; j++) {
 #if (OALICE_BITS % 2 == 1)
-    eval_dual_2_isog(As[MAX_Alice][2], As[MAX_Alice][3], P);
+        eval_dual_2_isog(As[aux][2], As[aux][3], P[j]);
 #endif
-    eval_final_dual_2_isog(P);    // to A = 0
+        eval_final_dual_2_isog(P[j]);    // to A = 0
+    }
 }
 
 
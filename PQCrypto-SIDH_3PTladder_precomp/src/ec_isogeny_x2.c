@@ -0,0 +1,106 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: two-lane elliptic curve and isogeny functions for the fused key generation and shared secret of the encapsulation
+*********************************************************************************************/
+
+// Same formulas as ec_isogeny.c on two independent curves and points, one per lane (see fpx_x2.c). Only the functions of Alice's
+// tree traversal are provided. With SIDH_OPCOUNT, each call counts one operation per lane.
+
+
+static void xDBL_x2(const point_proj_x2_t P, point_proj_x2_t Q, const f2elm_x2_t A24plus, const f2elm_x2_t C24)
+{ // Doubling of Montgomery points in projective coordinates (X:Z), Q = 2*P, with Montgomery curve constants A+2C and 4C
+    f2elm_x2_t t0, t1;
+
+    mp2_sub_p2_x2(P->X, P->Z, t0);                  // t0 = X1-Z1
+    mp2_add_x2(P->X, P->Z, t1);                     // t1 = X1+Z1
+    fp2sqr_mont_x2(t0, t0);                         // t0 = (X1-Z1)^2
+    fp2sqr_mont_x2(t1, t1);                         // t1 = (X1+Z1)^2
+    fp2mul_mont_x2(C24, t0, Q->Z);                  // Z2 = C24*(X1-Z1)^2
+    fp2mul_mont_x2(t1, Q->Z, Q->X);                 // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+    mp2_sub_p2_x2(t1, t0, t1);                      // t1 = (X1+Z1)^2-(X1-Z1)^2
+    fp2mul_mont_x2(A24plus, t1, t0);                // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+    mp2_add_x2(Q->Z, t0, Q->Z);                     // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+    fp2mul_mont_x2(Q->Z, t1, Q->Z);                 // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+    OPCOUNT(XDBL, 2);
+}
+
+
+static void xDBLe_x2(const point_proj_x2_t P, point_proj_x2_t Q, const f2elm_x2_t A24plus, const f2elm_x2_t C24, const int e)
+{ // Computes [2^e](X:Z) in the lanes via e repeated doublings
+    int i;
+
+    fp2copy_x2(P->X, Q->X);
+    fp2copy_x2(P->Z, Q->Z);
+    for (i = 0; i < e; i++) {
+        xDBL_x2(Q, Q, A24plus, C24);
+    }
+}
+
+#if (OALICE_BITS % 2 == 1)
+
+static void get_2_isog_x2(const point_proj_x2_t P, f2elm_x2_t A, f2elm_x2_t C)
+{ // Computes the 2-isogenous Montgomery curves with projective coefficients A/C of the points of order two P = (X2:Z2)
+
+    fp2sqr_mont_x2(P->X, A);                        // A = X2^2
+    fp2sqr_mont_x2(P->Z, C);                        // C = Z2^2
+    mp2_sub_p2_x2(C, A, A);                         // A = Z2^2 - X2^2
+    OPCOUNT(GET_2_ISOG, 2);
+}
+
+
+static void eval_2_isog_x2(point_proj_x2_t P, const point_proj_x2_t Q)
+{ // Evaluates the 2-isogenies with kernel points Q = (X2:Z2) at the points P = (X:Z)
+    f2elm_x2_t t0, t1, t2, t3;
+
+    mp2_add_x2(Q->X, Q->Z, t0);                     // t0 = X2+Z2
+    mp2_sub_p2_x2(Q->X, Q->Z, t1);                  // t1 = X2-Z2
+    mp2_add_x2(P->X, P->Z, t2);                     // t2 = X+Z
+    mp2_sub_p2_x2(P->X, P->Z, t3);                  // t3 = X-Z
+    fp2mul_mont_x2(t0, t3, t0);                     // t0 = (X2+Z2)*(X-Z)
+    fp2mul_mont_x2(t1, t2, t1);                     // t1 = (X2-Z2)*(X+Z)
+    mp2_add_x2(t0, t1, t2);                         // t2 = (X2+Z2)*(X-Z) + (X2-Z2)*(X+Z)
+    mp2_sub_p2_x2(t0, t1, t3);                      // t3 = (X2+Z2)*(X-Z) - (X2-Z2)*(X+Z)
+    fp2mul_mont_x2(P->X, t2, P->X);                 // Xfinal
+    fp2mul_mont_x2(P->Z, t3, P->Z);                 // Zfinal
+    OPCOUNT(EVAL_2_ISOG, 2);
+}
+
+#endif
+
+static void get_4_isog_x2(const point_proj_x2_t P, f2elm_x2_t A24plus, f2elm_x2_t C24, f2elm_x2_t* coeff)
+{ // Computes the 4-isogenous curves A+2C/4C of the points of order four P = (X4:Z4), and the coefficients used by eval_4_isog_x2()
+
+    mp2_sub_p2_x2(P->X, P->Z, coeff[1]);            // coeff[1] = X4-Z4
+    mp2_add_x2(P->X, P->Z, coeff[2]);               // coeff[2] = X4+Z4
+    fp2sqr_mont_x2(P->Z, coeff[0]);                 // coeff[0] = Z4^2
+    mp2_add_x2(coeff[0], coeff[0], coeff[0]);       // coeff[0] = 2*Z4^2
+    fp2sqr_mont_x2(coeff[0], C24);                  // C24 = 4*Z4^4
+    mp2_add_x2(coeff[0], coeff[0], coeff[0]);       // coeff[0] = 4*Z4^2
+    fp2sqr_mont_x2(P->X, A24plus);                  // A24plus = X4^2
+    mp2_add_x2(A24plus, A24plus, A24plus);          // A24plus = 2*X4^2
+    fp2sqr_mont_x2(A24plus, A24plus);               // A24plus = 4*X4^4
+    OPCOUNT(GET_4_ISOG, 2);
+}
+
+
+static void eval_4_isog_x2(point_proj_x2_t P, f2elm_x2_t* coeff)
+{ // Evaluates the 4-isogenies given by the coefficients of get_4_isog_x2() at the points P = (X:Z)
+    f2elm_x2_t t0, t1;
+
+    mp2_add_x2(P->X, P->Z, t0);                     // t0 = X+Z
+    mp2_sub_p2_x2(P->X, P->Z, t1);                  // t1 = X-Z
+    fp2mul_mont_x2(t0, coeff[1], P->X);             // X = (X+Z)*coeff[1]
+    fp2mul_mont_x2(t1, coeff[2], P->Z);             // Z = (X-Z)*coeff[2]
+    fp2mul_mont_x2(t0, t1, t0);                     // t0 = (X+Z)*(X-Z)
+    fp2mul_mont_x2(coeff[0], t0, t0);               // t0 = coeff[0]*(X+Z)*(X-Z)
+    mp2_add_x2(P->X, P->Z, t1);                     // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+    mp2_sub_p2_x2(P->X, P->Z, P->Z);                // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    fp2sqr_mont_x2(t1, t1);                         // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sqr_mont_x2(P->Z, P->Z);                     // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+    mp2_add_x2(t1, t0, P->X);                       // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    mp2_sub_p2_x2(P->Z, t0, t0);                    // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+    fp2mul_mont_x2(P->X, t1, P->X);                 // Xfinal
+    fp2mul_mont_x2(P->Z, t0, P->Z);                 // Zfinal
+    OPCOUNT(EVAL_4_ISOG, 2);
+}
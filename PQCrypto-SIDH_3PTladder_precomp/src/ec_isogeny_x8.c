@@ -0,0 +1,334 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: lane-parallel elliptic curve and isogeny functions for the multi-buffer SIKE functions
+*********************************************************************************************/
+
+// Same formulas as ec_isogeny.c on SIKE_LANES independent curves and points, one per 64-bit lane (see fpx_x8.c).
+// With SIDH_OPCOUNT, each call counts one operation per lane.
+
+
+static void xDBL_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24plus, const f2elm_x8_t C24)
+{ // Doubling of Montgomery points in projective coordinates (X:Z), Q = 2*P, with Montgomery curve constants A+2C and 4C
+    f2elm_x8_t t0, t1;
+
+    mp2_sub_p2_x8(P->X, P->Z, t0);                  // t0 = X1-Z1
+    mp2_add_x8(P->X, P->Z, t1);                     // t1 = X1+Z1
+    fp2sqr_mont_x8(t0, t0);                         // t0 = (X1-Z1)^2
+    fp2sqr_mont_x8(t1, t1);                         // t1 = (X1+Z1)^2
+    fp2mul_mont_x8(C24, t0, Q->Z);                  // Z2 = C24*(X1-Z1)^2
+    fp2mul_mont_x8(t1, Q->Z, Q->X);                 // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+    mp2_sub_p2_x8(t1, t0, t1);                      // t1 = (X1+Z1)^2-(X1-Z1)^2
+    fp2mul_mont_x8(A24plus, t1, t0);                // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+    mp2_add_x8(Q->Z, t0, Q->Z);                     // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+    fp2mul_mont_x8(Q->Z, t1, Q->Z);                 // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+    OPCOUNT(XDBL, SIKE_LANES);
+}
+
+
+static void xDBLe_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24plus, const f2elm_x8_t C24, const int e)
+{ // Computes [2^e](X:Z) in the lanes via e repeated doublings
+    int i;
+
+    fp2copy_x8(P->X, Q->X);
+    fp2copy_x8(P->Z, Q->Z);
+    for (i = 0; i < e; i++) {
+        xDBL_x8(Q, Q, A24plus, C24);
+    }
+}
+
+#if (OALICE_BITS % 2 == 1)
+
+static void get_2_isog_x8(const point_proj_x8_t P, f2elm_x8_t A, f2elm_x8_t C)
+{ // Computes the 2-isogenous Montgomery curves with projective coefficients A/C of the points of order two P = (X2:Z2)
+
+    fp2sqr_mont_x8(P->X, A);                        // A = X2^2
+    fp2sqr_mont_x8(P->Z, C);                        // C = Z2^2
+    mp2_sub_p2_x8(C, A, A);                         // A = Z2^2 - X2^2
+    OPCOUNT(GET_2_ISOG, SIKE_LANES);
+}
+
+
+static void eval_2_isog_x8(point_proj_x8_t P, const point_proj_x8_t Q)
+{ // Evaluates the 2-isogenies with kernel points Q = (X2:Z2) at the points P = (X:Z)
+    f2elm_x8_t t0, t1, t2, t3;
+
+    mp2_add_x8(Q->X, Q->Z, t0);                     // t0 = X2+Z2
+    mp2_sub_p2_x8(Q->X, Q->Z, t1);                  // t1 = X2-Z2
+    mp2_add_x8(P->X, P->Z, t2);                     // t2 = X+Z
+    mp2_sub_p2_x8(P->X, P->Z, t3);                  // t3 = X-Z
+    fp2mul_mont_x8(t0, t3, t0);                     // t0 = (X2+Z2)*(X-Z)
+    fp2mul_mont_x8(t1, t2, t1);                     // t1 = (X2-Z2)*(X+Z)
+    mp2_add_x8(t0, t1, t2);                         // t2 = (X2+Z2)*(X-Z) + (X2-Z2)*(X+Z)
+    mp2_sub_p2_x8(t0, t1, t3);                      // t3 = (X2+Z2)*(X-Z) - (X2-Z2)*(X+Z)
+    fp2mul_mont_x8(P->X, t2, P->X);                 // Xfinal
+    fp2mul_mont_x8(P->Z, t3, P->Z);                 // Zfinal
+    OPCOUNT(EVAL_2_ISOG, SIKE_LANES);
+}
+
+#endif
+
+static void get_4_isog_x8(const point_proj_x8_t P, f2elm_x8_t A24plus, f2elm_x8_t C24, f2elm_x8_t* coeff)
+{ // Computes the 4-isogenous curves A+2C/4C of the points of order four P = (X4:Z4), and the coefficients used by eval_4_isog_x8()
+
+    mp2_sub_p2_x8(P->X, P->Z, coeff[1]);            // coeff[1] = X4-Z4
+    mp2_add_x8(P->X, P->Z, coeff[2]);               // coeff[2] = X4+Z4
+    fp2sqr_mont_x8(P->Z, coeff[0]);                 // coeff[0] = Z4^2
+    mp2_add_x8(coeff[0], coeff[0], coeff[0]);       // coeff[0] = 2*Z4^2
+    fp2sqr_mont_x8(coeff[0], C24);                  // C24 = 4*Z4^4
+    mp2_add_x8(coeff[0], coeff[0], coeff[0]);       // coeff[0] = 4*Z4^2
+    fp2sqr_mont_x8(P->X, A24plus);                  // A24plus = X4^2
+    mp2_add_x8(A24plus, A24plus, A24plus);          // A24plus = 2*X4^2
+    fp2sqr_mont_x8(A24plus, A24plus);               // A24plus = 4*X4^4
+    OPCOUNT(GET_4_ISOG, SIKE_LANES);
+}
+
+
+static void eval_4_isog_x8(point_proj_x8_t P, f2elm_x8_t* coeff)
+{ // Evaluates the 4-isogenies given by the coefficients of get_4_isog_x8() at the points P = (X:Z)
+    f2elm_x8_t t0, t1;
+
+    mp2_add_x8(P->X, P->Z, t0);                     // t0 = X+Z
+    mp2_sub_p2_x8(P->X, P->Z, t1);                  // t1 = X-Z
+    fp2mul_mont_x8(t0, coeff[1], P->X);             // X = (X+Z)*coeff[1]
+    fp2mul_mont_x8(t1, coeff[2], P->Z);             // Z = (X-Z)*coeff[2]
+    fp2mul_mont_x8(t0, t1, t0);                     // t0 = (X+Z)*(X-Z)
+    fp2mul_mont_x8(coeff[0], t0, t0);               // t0 = coeff[0]*(X+Z)*(X-Z)
+    mp2_add_x8(P->X, P->Z, t1);                     // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+    mp2_sub_p2_x8(P->X, P->Z, P->Z);                // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    fp2sqr_mont_x8(t1, t1);                         // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sqr_mont_x8(P->Z, P->Z);                     // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+    mp2_add_x8(t1, t0, P->X);                       // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    mp2_sub_p2_x8(P->Z, t0, t0);                    // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+    fp2mul_mont_x8(P->X, t1, P->X);                 // Xfinal
+    fp2mul_mont_x8(P->Z, t0, P->Z);                 // Zfinal
+    OPCOUNT(EVAL_4_ISOG, SIKE_LANES);
+}
+
+
+static void xTPL_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24minus, const f2elm_x8_t A24plus)
+{ // Tripling of Montgomery points in projective coordinates (X:Z), Q = 3*P, with Montgomery curve constants A+2C and A-2C
+    f2elm_x8_t t0, t1, t2, t3, t4, t5, t6;
+
+    mp2_sub_p2_x8(P->X, P->Z, t0);                  // t0 = X-Z
+    fp2sqr_mont_x8(t0, t2);                         // t2 = (X-Z)^2
+    mp2_add_x8(P->X, P->Z, t1);                     // t1 = X+Z
+    fp2sqr_mont_x8(t1, t3);                         // t3 = (X+Z)^2
+    mp2_add_x8(P->X, P->X, t4);                     // t4 = 2*X
+    mp2_add_x8(P->Z, P->Z, t0);                     // t0 = 2*Z
+    fp2sqr_mont_x8(t4, t1);                         // t1 = 4*X^2
+    mp2_sub_p2_x8(t1, t3, t1);                      // t1 = 4*X^2 - (X+Z)^2
+    mp2_sub_p2_x8(t1, t2, t1);                      // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
+    fp2mul_mont_x8(A24plus, t3, t5);                // t5 = A24plus*(X+Z)^2
+    fp2mul_mont_x8(A24minus, t2, t6);               // t6 = A24minus*(X-Z)^2
+    fp2mulsub_mont_x8(t2, t6, t3, t5, t3);          // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    mp2_sub_p2_x8(t5, t6, t2);                      // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
+    fp2mul_mont_x8(t1, t2, t1);                     // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+    fp2add_x8(t3, t1, t2);                          // t2 = t1 + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    fp2sqr_mont_x8(t2, t2);                         // t2 = t2^2
+    fp2mul_mont_x8(t4, t2, Q->X);                   // X3 = 2*X*t2
+    fp2sub_x8(t3, t1, t1);                          // t1 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4 - t1
+    fp2sqr_mont_x8(t1, t1);                         // t1 = t1^2
+    fp2mul_mont_x8(t0, t1, Q->Z);                   // Z3 = 2*Z*t1
+    OPCOUNT(XTPL, SIKE_LANES);
+}
+
+
+static void xTPLe_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24minus, const f2elm_x8_t A24plus, const int e)
+{ // Computes [3^e](X:Z) in the lanes via e repeated triplings
+    int i;
+
+    fp2copy_x8(P->X, Q->X);
+    fp2copy_x8(P->Z, Q->Z);
+    for (i = 0; i < e; i++) {
+        xTPL_x8(Q, Q, A24minus, A24plus);
+    }
+}
+
+
+static void get_3_isog_x8(const point_proj_x8_t P, f2elm_x8_t A24minus, f2elm_x8_t A24plus, f2elm_x8_t* coeff)
+{ // Computes the 3-isogenous curves A+2C/A-2C of the points of order three P = (X3:Z3), and the coefficients used by eval_3_isog_x8()
+    f2elm_x8_t t0, t1, t2, t3, t4;
+
+    mp2_sub_p2_x8(P->X, P->Z, coeff[0]);            // coeff0 = X-Z
+    fp2sqr_mont_x8(coeff[0], t0);                   // t0 = (X-Z)^2
+    mp2_add_x8(P->X, P->Z, coeff[1]);               // coeff1 = X+Z
+    fp2sqr_mont_x8(coeff[1], t1);                   // t1 = (X+Z)^2
+    mp2_add_x8(P->X, P->X, t3);                     // t3 = 2*X
+    fp2sqr_mont_x8(t3, t3);                         // t3 = 4*X^2
+    fp2sub_x8(t3, t0, t2);                          // t2 = 4*X^2 - (X-Z)^2
+    fp2sub_x8(t3, t1, t3);                          // t3 = 4*X^2 - (X+Z)^2
+    mp2_add_x8(t0, t3, t4);                         // t4 = 4*X^2 - (X+Z)^2 + (X-Z)^2
+    mp2_add_x8(t4, t4, t4);                         // t4 = 2(4*X^2 - (X+Z)^2 + (X-Z)^2)
+    mp2_add_x8(t1, t4, t4);                         // t4 = 8*X^2 - (X+Z)^2 + 2*(X-Z)^2
+    fp2mul_mont_x8(t2, t4, A24minus);               // A24minus = [4*X^2 - (X-Z)^2]*[8*X^2 - (X+Z)^2 + 2*(X-Z)^2]
+    mp2_add_x8(t1, t2, t4);                         // t4 = 4*X^2 + (X+Z)^2 - (X-Z)^2
+    mp2_add_x8(t4, t4, t4);                         // t4 = 2(4*X^2 + (X+Z)^2 - (X-Z)^2)
+    mp2_add_x8(t0, t4, t4);                         // t4 = 8*X^2 + 2*(X+Z)^2 - (X-Z)^2
+    fp2mul_mont_x8(t3, t4, A24plus);                // A24plus = [4*X^2 - (X+Z)^2]*[8*X^2 + 2*(X+Z)^2 - (X-Z)^2]
+    OPCOUNT(GET_3_ISOG, SIKE_LANES);
+}
+
+
+static void eval_3_isog_x8(point_proj_x8_t Q, const f2elm_x8_t* coeff)
+{ // Evaluates the 3-isogenies given by the coefficients of get_3_isog_x8() at the points Q = (X:Z)
+    f2elm_x8_t t0, t1, t2;
+
+    mp2_add_x8(Q->X, Q->Z, t0);                     // t0 = X+Z
+    mp2_sub_p2_x8(Q->X, Q->Z, t1);                  // t1 = X-Z
+    fp2mul_mont_x8(coeff[0], t0, t0);               // t0 = coeff0*(X+Z)
+    fp2mul_mont_x8(coeff[1], t1, t1);               // t1 = coeff1*(X-Z)
+    mp2_add_x8(t0, t1, t2);                         // t2 = coeff0*(X+Z) + coeff1*(X-Z)
+    mp2_sub_p2_x8(t1, t0, t0);                      // t0 = coeff1*(X-Z) - coeff0*(X+Z)
+    fp2sqr_mont_x8(t2, t2);                         // t2 = [coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2sqr_mont_x8(t0, t0);                         // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2
+    fp2mul_mont_x8(Q->X, t2, Q->X);                 // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2mul_mont_x8(Q->Z, t0, Q->Z);                 // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+    OPCOUNT(EVAL_3_ISOG, SIKE_LANES);
+}
+
+
+static void inv_3_way_x8(f2elm_x8_t z1, f2elm_x8_t z2, f2elm_x8_t z3)
+{ // 3-way simultaneous inversion in the lanes, z1,z2,z3 <- 1/z1,1/z2,1/z3
+    f2elm_x8_t t0, t1, t2;
+
+    fp2mul_mont_x8(z1, z2, t0);                     // t0 = z1*z2
+    fp2mul_mont_x8(z3, t0, t1);                     // t1 = z1*z2*z3
+    fp2inv_mont_x8(t1);                             // t1 = 1/(z1*z2*z3)
+    fp2mul_mont_x8(z3, t1, t2);                     // t2 = 1/(z1*z2)
+    fp2mul_mont_x8(t0, t1, z3);                     // z3 = 1/z3
+    fp2mul_mont_x8(t2, z2, t0);                     // z1 = 1/z1
+    fp2mul_mont_x8(t2, z1, z2);                     // z2 = 1/z2
+    fp2copy_x8(t0, z1);
+}
+
+
+static void get_A_x8(const f2elm_x8_t xP, const f2elm_x8_t xQ, const f2elm_x8_t xR, f2elm_x8_t A)
+{ // Coefficients A of the Montgomery curves y^2=x^3+A*x^2+x such that R=Q-P, given the x-coordinates of P, Q and R
+    f2elm_x8_t t0, t1, one;
+
+    fpone_x8(one[0]);
+    fpzero_x8(one[1]);
+    fp2add_x8(xP, xQ, t1);                          // t1 = xP+xQ
+    fp2mul_mont_x8(xP, xQ, t0);                     // t0 = xP*xQ
+    fp2mul_mont_x8(xR, t1, A);                      // A = xR*t1
+    fp2add_x8(t0, A, A);                            // A = A+t0
+    fp2mul_mont_x8(t0, xR, t0);                     // t0 = t0*xR
+    fp2sub_x8(A, one, A);                           // A = A-1
+    fp2add_x8(t0, t0, t0);                          // t0 = t0+t0
+    fp2add_x8(t1, xR, t1);                          // t1 = t1+xR
+    fp2add_x8(t0, t0, t0);                          // t0 = t0+t0
+    fp2sqr_mont_x8(A, A);                           // A = A^2
+    fp2inv_mont_x8(t0);                             // t0 = 1/t0
+    fp2mul_mont_x8(A, t0, A);                       // A = A*t0
+    fp2sub_x8(A, t1, A);                            // Afinal = A-t1
+}
+
+
+static void j_inv_x8(const f2elm_x8_t A, const f2elm_x8_t C, f2elm_x8_t jinv)
+{ // j-invariants 256*(A^2-3*C^2)^3/(C^4*(A^2-4*C^2)) of the Montgomery curves with projective constants A/C
+    f2elm_x8_t t0, t1;
+
+    fp2sqr_mont_x8(A, jinv);                        // jinv = A^2
+    fp2sqr_mont_x8(C, t1);                          // t1 = C^2
+    fp2add_x8(t1, t1, t0);                          // t0 = t1+t1
+    fp2sub_x8(jinv, t0, t0);                        // t0 = jinv-t0
+    fp2sub_x8(t0, t1, t0);                          // t0 = t0-t1
+    fp2sub_x8(t0, t1, jinv);                        // jinv = t0-t1
+    fp2sqr_mont_x8(t1, t1);                         // t1 = t1^2
+    fp2mul_mont_x8(jinv, t1, jinv);                 // jinv = jinv*t1
+    fp2add_x8(t0, t0, t0);                          // t0 = t0+t0
+    fp2add_x8(t0, t0, t0);                          // t0 = t0+t0
+    fp2sqr_mont_x8(t0, t1);                         // t1 = t0^2
+    fp2mul_mont_x8(t0, t1, t0);                     // t0 = t0*t1
+    fp2add_x8(t0, t0, t0);                          // t0 = t0+t0
+    fp2add_x8(t0, t0, t0);                          // t0 = t0+t0
+    fp2inv_mont_x8(jinv);                           // jinv = 1/jinv
+    fp2mul_mont_x8(jinv, t0, jinv);                 // jinv = t0*jinv
+}
+
+
+static void xDBLADD_x8(point_proj_x8_t P, point_proj_x8_t Q, const felm_x8_t* XPQ, const felm_x8_t* ZPQ, const felm_x8_t* A24)
+{ // Simultaneous doubling and differential addition in the lanes, P <- 2*P and Q <- P+Q, with x(P-Q) = XPQ/ZPQ and A24 = (A+2)/4
+    f2elm_x8_t t0, t1, t2;
+
+    mp2_add_x8(P->X, P->Z, t0);                     // t0 = XP+ZP
+    mp2_sub_p2_x8(P->X, P->Z, t1);                  // t1 = XP-ZP
+    fp2sqr_mont_x8(t0, P->X);                       // XP = (XP+ZP)^2
+    mp2_sub_p2_x8(Q->X, Q->Z, t2);                  // t2 = XQ-ZQ
+    mp2_add_x8(Q->X, Q->Z, Q->X);                   // XQ = XQ+ZQ
+    fp2mul_mont_x8(t0, t2, t0);                     // t0 = (XP+ZP)*(XQ-ZQ)
+    fp2sqr_mont_x8(t1, P->Z);                       // ZP = (XP-ZP)^2
+    fp2mul_mont_x8(t1, Q->X, t1);                   // t1 = (XP-ZP)*(XQ+ZQ)
+    mp2_sub_p2_x8(P->X, P->Z, t2);                  // t2 = (XP+ZP)^2-(XP-ZP)^2
+    fp2mul_mont_x8(P->X, P->Z, P->X);               // XP = (XP+ZP)^2*(XP-ZP)^2
+    fp2mul_mont_x8(A24, t2, Q->X);                  // XQ = A24*[(XP+ZP)^2-(XP-ZP)^2]
+    mp2_sub_p2_x8(t0, t1, Q->Z);                    // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+    mp2_add_x8(Q->X, P->Z, P->Z);                   // ZP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2
+    mp2_add_x8(t0, t1, Q->X);                       // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+    fp2mul_mont_x8(P->Z, t2, P->Z);                 // ZP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+    fp2sqr_mont_x8(Q->Z, Q->Z);                     // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fp2sqr_mont_x8(Q->X, Q->X);                     // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    fp2mul_mont_x8(Q->Z, XPQ, Q->Z);                // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fp2mul_mont_x8(Q->X, ZPQ, Q->X);                // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    OPCOUNT(XDBLADD, SIKE_LANES);
+}
+
+
+static void swap_points_x8(point_proj_x8_t P, point_proj_x8_t Q, const __m512i option)
+{ // Swap of the points of the lanes where option = 0xFF...FF, the lanes where option = 0 are left unchanged
+    __m512i temp;
+    unsigned int i, j;
+
+    for (j = 0; j < 2; j++) {
+        for (i = 0; i < NWORDS52_FIELD; i++) {
+            temp = _mm512_and_si512(option, _mm512_xor_si512(P->X[j][i], Q->X[j][i]));
+            P->X[j][i] = _mm512_xor_si512(temp, P->X[j][i]);
+            Q->X[j][i] = _mm512_xor_si512(temp, Q->X[j][i]);
+            temp = _mm512_and_si512(option, _mm512_xor_si512(P->Z[j][i], Q->Z[j][i]));
+            P->Z[j][i] = _mm512_xor_si512(temp, P->Z[j][i]);
+            Q->Z[j][i] = _mm512_xor_si512(temp, Q->Z[j][i]);
+        }
+    }
+}
+
+
+static void LADDER3PT_x8(const f2elm_x8_t xP, const f2elm_x8_t xQ, const f2elm_x8_t xPQ, const __m512i* m, const int nbits, point_proj_x8_t R, const f2elm_x8_t A)
+{ // 3-point ladder of the lanes, R = P+[m]Q over the nbits least significant bits of the scalars m (one per lane, see sk_to_lanes_x8())
+    point_proj_x8_t R0, R2;
+    f2elm_x8_t A24;
+    __m512i bit, swap, mask, prevbit = _mm512_setzero_si512();
+    int i;
+
+    // Initializing constant
+    fpone_x8(A24[0]);
+    fpzero_x8(A24[1]);
+    mp2_add_x8(A24, A24, A24);
+    mp2_add_x8(A, A24, A24);
+    fp2div2_x8(A24, A24);
+    fp2div2_x8(A24, A24);  // A24 = (A+2)/4
+
+    // Initializing points
+    fp2copy_x8(xQ, R0->X);
+    fpone_x8(R0->Z[0]);
+    fpzero_x8(R0->Z[1]);
+    fp2copy_x8(xPQ, R2->X);
+    fpone_x8(R2->Z[0]);
+    fpzero_x8(R2->Z[1]);
+    fp2copy_x8(xP, R->X);
+    fpone_x8(R->Z[0]);
+    fpzero_x8(R->Z[1]);
+
+    // Main loop
+    for (i = 0; i < nbits; i++) {
+        bit = _mm512_and_si512(_mm512_srli_epi64(m[i >> LOG2RADIX], (unsigned int)(i & (RADIX-1))), _mm512_set1_epi64(1));
+        swap = _mm512_xor_si512(bit, prevbit);
+        prevbit = bit;
+        mask = _mm512_sub_epi64(_mm512_setzero_si512(), swap);
+
+        swap_points_x8(R, R2, mask);
+        xDBLADD_x8(R0, R2, R->X, R->Z, A24);
+    }
+    mask = _mm512_sub_epi64(_mm512_setzero_si512(), prevbit);
+    swap_points_x8(R, R2, mask);
+}
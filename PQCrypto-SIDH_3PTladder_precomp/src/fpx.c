@@ -6,6 +6,10 @@
 
 #include <string.h>
 
+#if defined(SIDH_OPCOUNT)
+    THREAD_LOCAL uint64_t opcounters[OPC_COUNTERS];
+#endif
+
 
 void clear_words(void* mem, digit_t nwords)
 { // Clear digits from memory. "nwords" indicates the number of digits to be zeroed.
@@ -140,6 +144,8 @@ void fpmul_mont(const digit_t* ma, const digit_t* mb, digit_t* mc)
 
     mp_mul(ma, mb, temp, NWORDS_FIELD);
     rdc_mont(temp, mc);
+    OPCOUNT(MUL, 1);
+    OPCOUNT(RDC, 1);
 }
 
 
@@ -147,8 +153,10 @@ void fpsqr_mont(const digit_t* ma, digit_t* mc)
 { // Multiprecision squaring, c = a^2 mod p.
     dfelm_t temp = {0};
 
-    mp_mul(ma, ma, temp, NWORDS_FIELD);
+    mp_sqr(ma, temp, NWORDS_FIELD);
     rdc_mont(temp, mc);
+    OPCOUNT(SQR, 1);
+    OPCOUNT(RDC, 1);
 }
 
 
@@ -161,6 +169,7 @@ void fpinv_mont(digit_t* a)
     fpsqr_mont(tt, tt);
     fpsqr_mont(tt, tt);
     fpmul_mont(a, tt, a);
+    OPCOUNT(INV, 1);
 }
 
 
@@ -224,6 +233,7 @@ inline static void mp_addfast(const digit_t* a, const digit_t* b, digit_t* c)
     mp_add_asm(a, b, c);    
 
 #endif
+    OPCOUNT(ADD, 1);
 }
 
 
@@ -293,6 +303,7 @@ inline static void mp_subaddfast(const digit_t* a, const digit_t* b, digit_t* c)
     mp_subaddx2_asm(a, b, c);     
 
 #endif
+    OPCOUNT(SUB, 1);
 }
 
 
@@ -308,6 +319,7 @@ inline static void mp_dblsubfast(const digit_t* a, const digit_t* b, digit_t* c)
     mp_dblsubx2_asm(a, b, c);
 
 #endif
+    OPCOUNT(SUB, 2);
 }
 
 
@@ -327,6 +339,78 @@ void fp2mul_mont(const f2elm_t a, const f2elm_t b, f2elm_t c)
     mp_subaddfast(tt1, tt2, tt1);                    // tt1 = a0*b0 - a1*b1 + p*2^MAXBITS_FIELD if a0*b0 - a1*b1 < 0, else tt1 = a0*b0 - a1*b1
     rdc_mont(tt3, c[1]);                             // c[1] = (a0+a1)*(b0+b1) - a0*b0 - a1*b1 
     rdc_mont(tt1, c[0]);                             // c[0] = a0*b0 - a1*b1
+    OPCOUNT(MUL, 3);
+    OPCOUNT(RDC, 2);
+}
+
+
+inline static void mp_addx2fast(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision addition, c = a+b, where lng(a) = lng(b) = 2*NWORDS_FIELD.
+#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+
+    mp_add(a, b, c, 2*NWORDS_FIELD);
+    
+#elif (OS_TARGET == OS_NIX)                 
+    
+    mp_addx2_asm(a, b, c);    
+
+#endif
+    OPCOUNT(ADD, 1);
+}
+
+
+inline static void fp2mul_unr(const f2elm_t a, const f2elm_t b, dfelm_t tt1, dfelm_t tt2, dfelm_t tt3)
+{ // Unreduced GF(p^2) multiplication, tt1 = a0*b0, tt2 = a1*b1 and tt3 = (a0+a1)*(b0+b1).
+  // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2*p-1] 
+  // Output: tt1, tt2 in [0, 4*p^2-1] and tt3 in [0, 16*p^2-1]
+    felm_t t1, t2;
+    
+    mp_addfast(a[0], a[1], t1);                      // t1 = a0+a1
+    mp_addfast(b[0], b[1], t2);                      // t2 = b0+b1
+    mp_mul(a[0], b[0], tt1, NWORDS_FIELD);           // tt1 = a0*b0
+    mp_mul(a[1], b[1], tt2, NWORDS_FIELD);           // tt2 = a1*b1
+    mp_mul(t1, t2, tt3, NWORDS_FIELD);               // tt3 = (a0+a1)*(b0+b1)
+    OPCOUNT(MUL, 3);
+}
+
+
+void fp2mul_add_mont(const f2elm_t a, const f2elm_t b, const f2elm_t c, const f2elm_t d, f2elm_t e)
+{ // GF(p^2) sum of products using Montgomery arithmetic with a single reduction per coefficient, e = a*b+c*d in GF(p^2).
+  // Inputs: a, b, c, d in GF(p^2), with coefficients in [0, 2*p-1] 
+  // Output: e = e0+e1*i, where e0, e1 are in [0, 2*p-1] 
+    dfelm_t tt1, tt2, tt3, uu1, uu2, uu3;
+    
+    fp2mul_unr(a, b, tt1, tt2, tt3);
+    fp2mul_unr(c, d, uu1, uu2, uu3);
+    mp_dblsubfast(tt1, tt2, tt3);                    // tt3 = a0*b1 + a1*b0
+    mp_dblsubfast(uu1, uu2, uu3);                    // uu3 = c0*d1 + c1*d0
+    mp_addx2fast(tt3, uu3, tt3);                     // tt3 = a0*b1 + a1*b0 + c0*d1 + c1*d0 < 16*p^2
+    mp_addx2fast(tt1, uu1, tt1);                     // tt1 = a0*b0 + c0*d0
+    mp_addx2fast(tt2, uu2, tt2);                     // tt2 = a1*b1 + c1*d1
+    mp_subaddfast(tt1, tt2, tt1);                    // tt1 = a0*b0 + c0*d0 - a1*b1 - c1*d1 (+ p*2^MAXBITS_FIELD if negative)
+    rdc_mont(tt3, e[1]);
+    rdc_mont(tt1, e[0]);
+    OPCOUNT(RDC, 2);
+}
+
+
+void fp2mulsub_mont(const f2elm_t a, const f2elm_t b, const f2elm_t c, const f2elm_t d, f2elm_t e)
+{ // GF(p^2) difference of products using Montgomery arithmetic with a single reduction per coefficient, e = a*b-c*d in GF(p^2).
+  // Inputs: a, b, c, d in GF(p^2), with coefficients in [0, 2*p-1] 
+  // Output: e = e0+e1*i, where e0, e1 are in [0, 2*p-1] 
+    dfelm_t tt1, tt2, tt3, uu1, uu2, uu3;
+    
+    fp2mul_unr(a, b, tt1, tt2, tt3);
+    fp2mul_unr(c, d, uu1, uu2, uu3);
+    mp_dblsubfast(tt1, tt2, tt3);                    // tt3 = a0*b1 + a1*b0
+    mp_dblsubfast(uu1, uu2, uu3);                    // uu3 = c0*d1 + c1*d0
+    mp_subaddfast(tt3, uu3, tt3);                    // tt3 = a0*b1 + a1*b0 - c0*d1 - c1*d0 (+ p*2^MAXBITS_FIELD if negative)
+    mp_addx2fast(tt1, uu2, tt1);                     // tt1 = a0*b0 + c1*d1
+    mp_addx2fast(tt2, uu1, tt2);                     // tt2 = a1*b1 + c0*d0
+    mp_subaddfast(tt1, tt2, tt1);                    // tt1 = a0*b0 + c1*d1 - a1*b1 - c0*d0 (+ p*2^MAXBITS_FIELD if negative)
+    rdc_mont(tt3, e[1]);
+    rdc_mont(tt1, e[0]);
+    OPCOUNT(RDC, 2);
 }
 
 
@@ -1155,6 +1239,7 @@ void fpinv_mont_bingcd(digit_t* a)
     fpmul_mont(x, (digit_t*)&Montgomery_R2, x);
     power2_setup(t, 2*MAXBITS_FIELD - k, NWORDS_FIELD);
     fpmul_mont(x, t, a);
+    OPCOUNT(INV, 1);
 }
 
 
@@ -0,0 +1,314 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: two-lane GF(p^2) arithmetic for the fused key generation and shared secret of the encapsulation
+*********************************************************************************************/
+
+#if defined(LANES_AVX512IFMA)
+// Each 256-bit vector holds one limb of an element of GF(p^2) in two independent computations: the real and imaginary parts of
+// lane 0 in the 64-bit slots 0 and 1, those of lane 1 in the slots 2 and 3. Limbs, Montgomery representation and reduction are
+// those of fpx_x8.c. Since a vector carries both parts, a GF(p^2) multiplication of the two lanes accumulates a0*b0 - a1*b1 and
+// a0*b1 + a1*b0 in the 8 slots of a 512-bit product and reduces them with a single 4-slot reduction, and a squaring is one 4-slot
+// product (a0+a1)*(a0-a1), 2a0*a1. The negated operand is taken as 8p-b1, so the inputs of the multiplications must be below 8p,
+// as in fpx_x8.c. With SIDH_OPCOUNT, each call counts the operations of both lanes.
+
+#define LIMB_X2(c, i)       _mm256_set1_epi64x((long long)(c)[i])     // Limb i of the constant c in all the slots
+#define EVEN_X2             0x5                                       // Slots of the real parts
+#define ODD_X2              0xA                                       // Slots of the imaginary parts
+
+typedef __m256i f2elm_x2_t[NWORDS52_FIELD];                               // Datatype for 2 elements of GF(p^2), one per lane
+typedef __m256i df2elm_x2_t[2*NWORDS52_FIELD];                            // Datatype for the double-precision coefficients of 2 products
+
+typedef struct { f2elm_x2_t X; f2elm_x2_t Z; } point_proj_x2;             // 2 points in projective XZ Montgomery coordinates
+typedef point_proj_x2 point_proj_x2_t[1];
+
+
+static inline void mp_carry_x2(__m256i* a, const unsigned int nlimbs)
+{ // Carry propagation over nlimbs signed limbs. The limbs but the last one are brought to [0, 2^52).
+    const __m256i mask = _mm256_set1_epi64x(MASK52);
+    unsigned int i;
+
+    for (i = 0; i < nlimbs-1; i++) {
+        a[i+1] = _mm256_add_epi64(a[i+1], _mm256_srai_epi64(a[i], 52));
+        a[i] = _mm256_and_si256(a[i], mask);
+    }
+}
+
+
+static inline void fp2copy_x2(const f2elm_x2_t a, f2elm_x2_t c)
+{ // Copy of the lanes in GF(p^2), c = a
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = a[i];
+}
+
+
+static inline void mp2_add_x2(const f2elm_x2_t a, const f2elm_x2_t b, f2elm_x2_t c)
+{ // GF(p^2) addition of the lanes without correction, c = a+b
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm256_add_epi64(a[i], b[i]);
+    mp_carry_x2(c, NWORDS52_FIELD);
+    OPCOUNT(ADD, 2*2);
+}
+
+
+static inline void mp2_sub_p2_x2(const f2elm_x2_t a, const f2elm_x2_t b, f2elm_x2_t c)
+{ // GF(p^2) subtraction of the lanes with correction with 2*p, c = a-b+2p
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm256_add_epi64(_mm256_sub_epi64(a[i], b[i]), LIMB_X2(PRIMEx2_R52, i));
+    mp_carry_x2(c, NWORDS52_FIELD);
+    OPCOUNT(SUB, 2*2);
+}
+
+
+static void fpcorrection_x2(f2elm_x2_t a)
+{ // Modular correction of the 4 slots to [0, p-1], for a in [0, 2p)
+    __mmask8 neg;
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm256_sub_epi64(a[i], LIMB_X2(PRIME_R52, i));
+    mp_carry_x2(a, NWORDS52_FIELD);
+    neg = _mm256_cmplt_epi64_mask(a[NWORDS52_FIELD-1], _mm256_setzero_si256());
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm256_mask_add_epi64(a[i], neg, a[i], LIMB_X2(PRIME_R52, i));
+    mp_carry_x2(a, NWORDS52_FIELD);
+}
+
+
+static void mp_mul_x2(const f2elm_x2_t a, const f2elm_x2_t b, df2elm_x2_t c)
+{ // Integer multiplication of the 4 slots, c = a*b in 2*NWORDS52_FIELD columns. The limbs of a and b are in [0, 2^52).
+    unsigned int i, j;
+
+    for (i = 0; i < 2*NWORDS52_FIELD; i++)
+        c[i] = _mm256_setzero_si256();
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        for (j = 0; j < NWORDS52_FIELD; j++) {
+            c[i+j]   = _mm256_madd52lo_epu64(c[i+j], a[i], b[j]);
+            c[i+j+1] = _mm256_madd52hi_epu64(c[i+j+1], a[i], b[j]);
+        }
+    }
+}
+
+
+static void rdc_mont_x2(df2elm_x2_t ma, f2elm_x2_t mc)
+{ // Montgomery reduction of the 4 slots, mc = ma*R^-1 mod p, for signed columns ma holding a nonnegative value below 2^14*p^2.
+  // Output in [0, 2p). ma is overwritten.
+    const __m256i mask = _mm256_set1_epi64x(MASK52);
+    __m256i m;
+    unsigned int i, j;
+
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        m = _mm256_and_si256(ma[i], mask);                                           // -p^-1 = 1 mod 2^52, the digit is the low limb
+        ma[i+1] = _mm256_add_epi64(ma[i+1], _mm256_srai_epi64(ma[i], 52));           // ma[i]-m = carry*2^52
+        for (j = ZERO_LIMBS52_FIELD; j < NWORDS52_FIELD; j++) {                      // ma += m*(p+1)*2^(52*i)
+            ma[i+j]   = _mm256_madd52lo_epu64(ma[i+j], m, LIMB_X2(PRIMEp1_R52, j));
+            ma[i+j+1] = _mm256_madd52hi_epu64(ma[i+j+1], m, LIMB_X2(PRIMEp1_R52, j));
+        }
+    }
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        mc[i] = ma[NWORDS52_FIELD+i];
+    mp_carry_x2(mc, NWORDS52_FIELD);
+}
+
+
+static void fpmul_mont_x2(const f2elm_x2_t ma, const f2elm_x2_t mb, f2elm_x2_t mc)
+{ // Field multiplication of the 4 slots using Montgomery arithmetic, mc = ma*mb*R^-1 mod p, used by the conversions
+    df2elm_x2_t temp;
+
+    mp_mul_x2(ma, mb, temp);
+    rdc_mont_x2(temp, mc);
+}
+
+
+static void fp2mul_mont_x2(const f2elm_x2_t a, const f2elm_x2_t b, f2elm_x2_t c)
+{ // GF(p^2) multiplication of the lanes using Montgomery arithmetic, c = a*b in GF(p^2). The lower half of the 512-bit product
+  // accumulates (a0*b0, a0*b1) and the upper half (a1*(8p-b1), a1*b0), the halves are added before the reduction.
+    __m512i u[NWORDS52_FIELD], v[NWORDS52_FIELD], tt[2*NWORDS52_FIELD];
+    f2elm_x2_t nb;
+    df2elm_x2_t t;
+    unsigned int i, j;
+
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        nb[i] = _mm256_shuffle_epi32(b[i], 0x4E);                                    // nb = (b1, b0)
+        nb[i] = _mm256_mask_sub_epi64(nb[i], EVEN_X2, _mm256_slli_epi64(LIMB_X2(PRIMEx4_R52, i), 1), nb[i]);   // nb = (8p-b1, b0)
+    }
+    mp_carry_x2(nb, NWORDS52_FIELD);
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        u[i] = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_shuffle_epi32(a[i], 0x44)), _mm256_shuffle_epi32(a[i], 0xEE), 1);   // u = (a0, a0, a1, a1)
+        v[i] = _mm512_inserti64x4(_mm512_castsi256_si512(b[i]), nb[i], 1);                                                            // v = (b0, b1, 8p-b1, b0)
+    }
+
+    for (i = 0; i < 2*NWORDS52_FIELD; i++)
+        tt[i] = _mm512_setzero_si512();
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        for (j = 0; j < NWORDS52_FIELD; j++) {
+            tt[i+j]   = _mm512_madd52lo_epu64(tt[i+j], u[i], v[j]);
+            tt[i+j+1] = _mm512_madd52hi_epu64(tt[i+j+1], u[i], v[j]);
+        }
+    }
+    for (i = 0; i < 2*NWORDS52_FIELD; i++)
+        t[i] = _mm256_add_epi64(_mm512_castsi512_si256(tt[i]), _mm512_extracti64x4_epi64(tt[i], 1));
+    rdc_mont_x2(t, c);
+    OPCOUNT(MUL, 4*2);
+    OPCOUNT(RDC, 2*2);
+}
+
+
+static void fp2sqr_mont_x2(const f2elm_x2_t a, f2elm_x2_t c)
+{ // GF(p^2) squaring of the lanes using Montgomery arithmetic, c = a^2 in GF(p^2), with the 4-slot product (a0+a1, 2a0)*(a0-a1+8p, a1)
+    f2elm_x2_t t1, t2;
+    df2elm_x2_t t;
+    __m256i s;
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        s = _mm256_shuffle_epi32(a[i], 0x4E);                                                          // s = (a1, a0)
+        t1[i] = _mm256_add_epi64(_mm256_mask_blend_epi64(ODD_X2, a[i], s), s);                         // t1 = (a0+a1, 2a0)
+        t2[i] = _mm256_mask_add_epi64(a[i], EVEN_X2, _mm256_sub_epi64(a[i], s), _mm256_slli_epi64(LIMB_X2(PRIMEx4_R52, i), 1));   // t2 = (a0-a1+8p, a1)
+    }
+    mp_carry_x2(t1, NWORDS52_FIELD);
+    mp_carry_x2(t2, NWORDS52_FIELD);
+    mp_mul_x2(t1, t2, t);
+    rdc_mont_x2(t, c);
+    OPCOUNT(MUL, 2*2);
+    OPCOUNT(RDC, 2*2);
+}
+
+
+static void fp2one_x2(f2elm_x2_t a)
+{ // Value one of GF(p^2) in Montgomery representation in both lanes
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm256_maskz_mov_epi64(EVEN_X2, LIMB_X2(Montgomery_one_r52, i));
+}
+
+
+/********************* Conversions between the lanes and the scalar representation *********************/
+
+static void fp2_load_x2(const f2elm_t a0, const f2elm_t a1, f2elm_x2_t c)
+{ // Conversion of a0 (lane 0) and a1 (lane 1), in Montgomery representation with 64-bit words, to the lanes
+    unsigned char bytes[FP2_ENCODED_BYTES / 2];
+    uint64_t limbs[4][NWORDS52_FIELD];
+    f2elm_x2_t R2;
+    felm_t t;
+    unsigned int i, j;
+
+    for (j = 0; j < 4; j++) {
+        from_mont((j < 2) ? a0[j] : a1[j-2], t);
+        encode_to_bytes(t, bytes, FP2_ENCODED_BYTES / 2);
+        fp_from_bytes_r52(bytes, limbs[j]);
+    }
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        c[i] = _mm256_set_epi64x((long long)limbs[3][i], (long long)limbs[2][i], (long long)limbs[1][i], (long long)limbs[0][i]);
+        R2[i] = LIMB_X2(Montgomery_R2_r52, i);
+    }
+    fpmul_mont_x2(c, R2, c);                                                         // c = a*R
+}
+
+
+static void fp2_store_x2(const f2elm_x2_t a, f2elm_t c0, f2elm_t c1)
+{ // Conversion of the lanes to lane 0 in c0 and lane 1 in c1, in Montgomery representation with 64-bit words
+    unsigned char bytes[FP2_ENCODED_BYTES / 2];
+    uint64_t slots[4], limbs[4][NWORDS52_FIELD];
+    f2elm_x2_t one, t;
+    felm_t u;
+    unsigned int i, j;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        one[i] = _mm256_setzero_si256();
+    one[0] = _mm256_set1_epi64x(1);
+    fpmul_mont_x2(a, one, t);                                                        // t = a*R^-1
+    fpcorrection_x2(t);
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        _mm256_storeu_si256((__m256i*)slots, t[i]);
+        for (j = 0; j < 4; j++)
+            limbs[j][i] = slots[j];
+    }
+    for (j = 0; j < 4; j++) {
+        fp_to_bytes_r52(limbs[j], bytes);
+        decode_to_digits(bytes, u, FP2_ENCODED_BYTES / 2, NWORDS_FIELD);
+        to_mont(u, (j < 2) ? c0[j] : c1[j-2]);
+    }
+}
+#else
+// Without AVX-512 IFMA, the lanes are two elements of GF(p^2) in the representation of fpx.c and each function applies the
+// scalar function to both of them. The operations are counted by the scalar functions.
+
+typedef f2elm_t f2elm_x2_t[2];                                            // Datatype for 2 elements of GF(p^2), one per lane
+
+typedef struct { f2elm_x2_t X; f2elm_x2_t Z; } point_proj_x2;             // 2 points in projective XZ Montgomery coordinates
+typedef point_proj_x2 point_proj_x2_t[1];
+
+
+static inline void fp2copy_x2(const f2elm_x2_t a, f2elm_x2_t c)
+{ // Copy of the lanes in GF(p^2), c = a
+
+    fp2copy(a[0], c[0]);
+    fp2copy(a[1], c[1]);
+}
+
+
+static inline void mp2_add_x2(const f2elm_x2_t a, const f2elm_x2_t b, f2elm_x2_t c)
+{ // GF(p^2) addition of the lanes without correction, c = a+b
+
+    mp2_add(a[0], b[0], c[0]);
+    mp2_add(a[1], b[1], c[1]);
+}
+
+
+static inline void mp2_sub_p2_x2(const f2elm_x2_t a, const f2elm_x2_t b, f2elm_x2_t c)
+{ // GF(p^2) subtraction of the lanes with correction with 2*p, c = a-b+2p
+
+    mp2_sub_p2(a[0], b[0], c[0]);
+    mp2_sub_p2(a[1], b[1], c[1]);
+}
+
+
+static inline void fp2mul_mont_x2(const f2elm_x2_t a, const f2elm_x2_t b, f2elm_x2_t c)
+{ // GF(p^2) multiplication of the lanes using Montgomery arithmetic, c = a*b
+
+    fp2mul_mont(a[0], b[0], c[0]);
+    fp2mul_mont(a[1], b[1], c[1]);
+}
+
+
+static inline void fp2sqr_mont_x2(const f2elm_x2_t a, f2elm_x2_t c)
+{ // GF(p^2) squaring of the lanes using Montgomery arithmetic, c = a^2
+
+    fp2sqr_mont(a[0], c[0]);
+    fp2sqr_mont(a[1], c[1]);
+}
+
+
+static void fp2one_x2(f2elm_x2_t a)
+{ // Value one of GF(p^2) in Montgomery representation in both lanes
+
+    fp2zero(a[0]);
+    fp2zero(a[1]);
+    fpcopy((digit_t*)&Montgomery_one, a[0][0]);
+    fpcopy((digit_t*)&Montgomery_one, a[1][0]);
+}
+
+
+static void fp2_load_x2(const f2elm_t a0, const f2elm_t a1, f2elm_x2_t c)
+{ // Copy of a0 to lane 0 and a1 to lane 1
+
+    fp2copy(a0, c[0]);
+    fp2copy(a1, c[1]);
+}
+
+
+static void fp2_store_x2(const f2elm_x2_t a, f2elm_t c0, f2elm_t c1)
+{ // Copy of lane 0 to c0 and lane 1 to c1
+
+    fp2copy(a[0], c0);
+    fp2copy(a[1], c1);
+}
+#endif
@@ -0,0 +1,521 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: lane-parallel GF(p) and GF(p^2) arithmetic with AVX-512 IFMA for the multi-buffer SIKE functions
+*********************************************************************************************/
+
+// Each 512-bit vector holds one limb of the same variable in SIKE_LANES = 8 independent computations, one per 64-bit lane.
+// Elements of GF(p) have NWORDS52_FIELD limbs of 52 bits and are kept in Montgomery representation with R = 2^(52*NWORDS52_FIELD).
+// Products are accumulated with vpmadd52luq/vpmadd52huq in signed 64-bit columns. Since p+1 = 2^eA*3^eB, the digit of each
+// reduction step is the low limb itself and only the nonzero limbs of p+1 are multiplied. R is larger than 2^14*p for the four
+// primes, so a reduction returns a value in [0, 2p) for products of inputs below 8p: as in fpx.c, the additions without
+// correction can feed the multiplications.
+
+#include <immintrin.h>
+
+#define MASK52              0xFFFFFFFFFFFFFULL
+#define LIMB_X8(c, i)       _mm512_set1_epi64((long long)(c)[i])      // Limb i of the constant c in all the lanes
+
+typedef __m512i felm_x8_t[NWORDS52_FIELD];                                // Datatype for 8 field elements, one per lane
+typedef __m512i dfelm_x8_t[2*NWORDS52_FIELD];                             // Datatype for 8 double-precision products in signed columns
+typedef felm_x8_t f2elm_x8_t[2];                                          // Datatype for 8 elements of GF(p^2)
+
+typedef struct { f2elm_x8_t X; f2elm_x8_t Z; } point_proj_x8;             // 8 points in projective XZ Montgomery coordinates
+typedef point_proj_x8 point_proj_x8_t[1];
+
+
+static inline void mp_carry_x8(__m512i* a, const unsigned int nlimbs)
+{ // Carry propagation over nlimbs signed limbs. The limbs but the last one are brought to [0, 2^52).
+    const __m512i mask = _mm512_set1_epi64(MASK52);
+    unsigned int i;
+
+    for (i = 0; i < nlimbs-1; i++) {
+        a[i+1] = _mm512_add_epi64(a[i+1], _mm512_srai_epi64(a[i], 52));
+        a[i] = _mm512_and_si512(a[i], mask);
+    }
+}
+
+
+static inline void fpcopy_x8(const felm_x8_t a, felm_x8_t c)
+{ // Copy of the lanes, c = a
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = a[i];
+}
+
+
+static inline void fpzero_x8(felm_x8_t a)
+{ // Zeroing of the lanes, a = 0
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm512_setzero_si512();
+}
+
+
+static inline void fpone_x8(felm_x8_t a)
+{ // Value one in Montgomery representation in all the lanes
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = LIMB_X8(Montgomery_one_r52, i);
+}
+
+
+static inline void mp_addfast_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Addition without correction, c = a+b
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_add_epi64(a[i], b[i]);
+    mp_carry_x8(c, NWORDS52_FIELD);
+    OPCOUNT(ADD, SIKE_LANES);
+}
+
+
+static inline void mp_sub_p2_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Subtraction with correction with 2*p, c = a-b+2p
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_add_epi64(_mm512_sub_epi64(a[i], b[i]), LIMB_X8(PRIMEx2_R52, i));
+    mp_carry_x8(c, NWORDS52_FIELD);
+    OPCOUNT(SUB, SIKE_LANES);
+}
+
+
+static inline void mp_sub_p4_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Subtraction with correction with 4*p, c = a-b+4p
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_add_epi64(_mm512_sub_epi64(a[i], b[i]), LIMB_X8(PRIMEx4_R52, i));
+    mp_carry_x8(c, NWORDS52_FIELD);
+    OPCOUNT(SUB, SIKE_LANES);
+}
+
+
+static void fpadd_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Modular addition of the lanes, c = a+b mod p, for a and b in [0, 2p). Output in [0, 2p).
+    __mmask8 neg;
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_sub_epi64(_mm512_add_epi64(a[i], b[i]), LIMB_X8(PRIMEx2_R52, i));
+    mp_carry_x8(c, NWORDS52_FIELD);
+    neg = _mm512_cmplt_epi64_mask(c[NWORDS52_FIELD-1], _mm512_setzero_si512());
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_mask_add_epi64(c[i], neg, c[i], LIMB_X8(PRIMEx2_R52, i));
+    mp_carry_x8(c, NWORDS52_FIELD);
+    OPCOUNT(ADD, SIKE_LANES);
+}
+
+
+static void fpsub_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Modular subtraction of the lanes, c = a-b mod p, for a and b in [0, 2p). Output in [0, 2p).
+    __mmask8 neg;
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_sub_epi64(a[i], b[i]);
+    mp_carry_x8(c, NWORDS52_FIELD);
+    neg = _mm512_cmplt_epi64_mask(c[NWORDS52_FIELD-1], _mm512_setzero_si512());
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        c[i] = _mm512_mask_add_epi64(c[i], neg, c[i], LIMB_X8(PRIMEx2_R52, i));
+    mp_carry_x8(c, NWORDS52_FIELD);
+    OPCOUNT(SUB, SIKE_LANES);
+}
+
+
+static void fpneg_x8(felm_x8_t a)
+{ // Modular negation of the lanes, a = 2p-a, for a in [0, 2p]
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm512_sub_epi64(LIMB_X8(PRIMEx2_R52, i), a[i]);
+    mp_carry_x8(a, NWORDS52_FIELD);
+}
+
+
+static void fpdiv2_x8(const felm_x8_t a, felm_x8_t c)
+{ // Modular division by two of the lanes, c = a/2 mod p, for a in [0, 2p). Output in [0, 2p).
+    felm_x8_t t;
+    __mmask8 odd = _mm512_test_epi64_mask(a[0], _mm512_set1_epi64(1));
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        t[i] = _mm512_mask_add_epi64(a[i], odd, a[i], LIMB_X8(PRIME_R52, i));      // t = a+p if a is odd
+    mp_carry_x8(t, NWORDS52_FIELD);
+    for (i = 0; i < NWORDS52_FIELD-1; i++)
+        c[i] = _mm512_or_si512(_mm512_srli_epi64(t[i], 1), _mm512_and_si512(_mm512_slli_epi64(t[i+1], 51), _mm512_set1_epi64(MASK52)));
+    c[NWORDS52_FIELD-1] = _mm512_srli_epi64(t[NWORDS52_FIELD-1], 1);
+}
+
+
+static void fpcorrection_x8(felm_x8_t a)
+{ // Modular correction of the lanes to [0, p-1], for a in [0, 2p)
+    __mmask8 neg;
+    unsigned int i;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm512_sub_epi64(a[i], LIMB_X8(PRIME_R52, i));
+    mp_carry_x8(a, NWORDS52_FIELD);
+    neg = _mm512_cmplt_epi64_mask(a[NWORDS52_FIELD-1], _mm512_setzero_si512());
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = _mm512_mask_add_epi64(a[i], neg, a[i], LIMB_X8(PRIME_R52, i));
+    mp_carry_x8(a, NWORDS52_FIELD);
+}
+
+
+static void mp_mul_x8(const felm_x8_t a, const felm_x8_t b, dfelm_x8_t c)
+{ // Integer multiplication of the lanes, c = a*b in 2*NWORDS52_FIELD columns. The limbs of a and b are in [0, 2^52).
+    unsigned int i, j;
+
+    for (i = 0; i < 2*NWORDS52_FIELD; i++)
+        c[i] = _mm512_setzero_si512();
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        for (j = 0; j < NWORDS52_FIELD; j++) {
+            c[i+j]   = _mm512_madd52lo_epu64(c[i+j], a[i], b[j]);
+            c[i+j+1] = _mm512_madd52hi_epu64(c[i+j+1], a[i], b[j]);
+        }
+    }
+    OPCOUNT(MUL, SIKE_LANES);
+}
+
+
+static void mp_sqr_x8(const felm_x8_t a, dfelm_x8_t c)
+{ // Integer squaring of the lanes, c = a^2 in 2*NWORDS52_FIELD columns, with the cross products computed once
+    unsigned int i, j;
+
+    for (i = 0; i < 2*NWORDS52_FIELD; i++)
+        c[i] = _mm512_setzero_si512();
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        for (j = i+1; j < NWORDS52_FIELD; j++) {
+            c[i+j]   = _mm512_madd52lo_epu64(c[i+j], a[i], a[j]);
+            c[i+j+1] = _mm512_madd52hi_epu64(c[i+j+1], a[i], a[j]);
+        }
+    }
+    for (i = 0; i < 2*NWORDS52_FIELD; i++)
+        c[i] = _mm512_add_epi64(c[i], c[i]);
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        c[2*i]   = _mm512_madd52lo_epu64(c[2*i], a[i], a[i]);
+        c[2*i+1] = _mm512_madd52hi_epu64(c[2*i+1], a[i], a[i]);
+    }
+    OPCOUNT(SQR, SIKE_LANES);
+}
+
+
+static void rdc_mont_x8(dfelm_x8_t ma, felm_x8_t mc)
+{ // Montgomery reduction of the lanes, mc = ma*R^-1 mod p, for signed columns ma holding a nonnegative value below 2^14*p^2.
+  // Output in [0, 2p). ma is overwritten.
+    const __m512i mask = _mm512_set1_epi64(MASK52);
+    __m512i m;
+    unsigned int i, j;
+
+    for (i = 0; i < NWORDS52_FIELD; i++) {
+        m = _mm512_and_si512(ma[i], mask);                                           // -p^-1 = 1 mod 2^52, the digit is the low limb
+        ma[i+1] = _mm512_add_epi64(ma[i+1], _mm512_srai_epi64(ma[i], 52));           // ma[i]-m = carry*2^52
+        for (j = ZERO_LIMBS52_FIELD; j < NWORDS52_FIELD; j++) {                      // ma += m*(p+1)*2^(52*i)
+            ma[i+j]   = _mm512_madd52lo_epu64(ma[i+j], m, LIMB_X8(PRIMEp1_R52, j));
+            ma[i+j+1] = _mm512_madd52hi_epu64(ma[i+j+1], m, LIMB_X8(PRIMEp1_R52, j));
+        }
+    }
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        mc[i] = ma[NWORDS52_FIELD+i];
+    mp_carry_x8(mc, NWORDS52_FIELD);
+    OPCOUNT(RDC, SIKE_LANES);
+}
+
+
+static void fpmul_mont_x8(const felm_x8_t ma, const felm_x8_t mb, felm_x8_t mc)
+{ // Field multiplication of the lanes using Montgomery arithmetic, mc = ma*mb*R^-1 mod p
+    dfelm_x8_t temp;
+
+    mp_mul_x8(ma, mb, temp);
+    rdc_mont_x8(temp, mc);
+}
+
+
+static void fpsqr_mont_x8(const felm_x8_t ma, felm_x8_t mc)
+{ // Field squaring of the lanes using Montgomery arithmetic, mc = ma^2*R^-1 mod p
+    dfelm_x8_t temp;
+
+    mp_sqr_x8(ma, temp);
+    rdc_mont_x8(temp, mc);
+}
+
+
+static void fpinv_mont_x8(felm_x8_t a)
+{ // Field inversion of the lanes using Montgomery arithmetic, a = a^(p-2) = a^-1*R mod p.
+  // Fixed windows of 4 bits over the public exponent p-2.
+    felm_x8_t t[16];
+    digit_t e[NWORDS_FIELD];
+    int i, j, w;
+
+    fpcopy((digit_t*)PRIME, e);
+    e[0] -= 2;                                                                       // e = p-2, the low word of p is odd and above 2
+    fpcopy_x8(a, t[1]);
+    fpsqr_mont_x8(a, t[2]);
+    for (i = 3; i < 16; i++)
+        fpmul_mont_x8(t[i-1], a, t[i]);                                              // t[i] = a^i
+
+    i = (NBITS_FIELD + 3) / 4 - 1;
+    fpcopy_x8(t[(e[(4*i) / RADIX] >> ((4*i) % RADIX)) & 0xF], a);                   // The top window is nonzero
+    for (i = i-1; i >= 0; i--) {
+        for (j = 0; j < 4; j++)
+            fpsqr_mont_x8(a, a);
+        w = (int)((e[(4*i) / RADIX] >> ((4*i) % RADIX)) & 0xF);
+        if (w != 0)
+            fpmul_mont_x8(a, t[w], a);
+    }
+    OPCOUNT(INV, SIKE_LANES);
+}
+
+
+static inline void fp2copy_x8(const f2elm_x8_t a, f2elm_x8_t c)
+{ // Copy of the lanes in GF(p^2), c = a
+    fpcopy_x8(a[0], c[0]);
+    fpcopy_x8(a[1], c[1]);
+}
+
+
+static inline void mp2_add_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) addition of the lanes without correction, c = a+b
+    mp_addfast_x8(a[0], b[0], c[0]);
+    mp_addfast_x8(a[1], b[1], c[1]);
+}
+
+
+static inline void mp2_sub_p2_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) subtraction of the lanes with correction with 2*p, c = a-b+2p
+    mp_sub_p2_x8(a[0], b[0], c[0]);
+    mp_sub_p2_x8(a[1], b[1], c[1]);
+}
+
+
+static void fp2add_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) addition of the lanes, c = a+b in GF(p^2)
+    fpadd_x8(a[0], b[0], c[0]);
+    fpadd_x8(a[1], b[1], c[1]);
+}
+
+
+static void fp2sub_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) subtraction of the lanes, c = a-b in GF(p^2)
+    fpsub_x8(a[0], b[0], c[0]);
+    fpsub_x8(a[1], b[1], c[1]);
+}
+
+
+static void fp2div2_x8(const f2elm_x8_t a, f2elm_x8_t c)
+{ // GF(p^2) division by two of the lanes, c = a/2 in GF(p^2)
+    fpdiv2_x8(a[0], c[0]);
+    fpdiv2_x8(a[1], c[1]);
+}
+
+
+static inline void mp_offset_x8(dfelm_x8_t c)
+{ // Adds p*2^(52*NWORDS52_FIELD-1) to the columns of c, which keeps a difference of products of inputs below 8p positive
+    unsigned int i;
+
+    for (i = 0; i <= NWORDS52_FIELD; i++)
+        c[NWORDS52_FIELD-1+i] = _mm512_add_epi64(c[NWORDS52_FIELD-1+i], LIMB_X8(PRIMEx2e51_R52, i));
+}
+
+
+static void fp2mul_unr_x8(const f2elm_x8_t a, const f2elm_x8_t b, dfelm_x8_t tt1, dfelm_x8_t tt2, dfelm_x8_t tt3)
+{ // Unreduced GF(p^2) multiplication of the lanes, tt1 = a0*b0, tt2 = a1*b1 and tt3 = (a0+a1)*(b0+b1)
+    felm_x8_t t1, t2;
+
+    mp_addfast_x8(a[0], a[1], t1);                  // t1 = a0+a1
+    mp_addfast_x8(b[0], b[1], t2);                  // t2 = b0+b1
+    mp_mul_x8(a[0], b[0], tt1);                     // tt1 = a0*b0
+    mp_mul_x8(a[1], b[1], tt2);                     // tt2 = a1*b1
+    mp_mul_x8(t1, t2, tt3);                         // tt3 = (a0+a1)*(b0+b1)
+}
+
+
+static void fp2mul_mont_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) multiplication of the lanes using Montgomery arithmetic, c = a*b in GF(p^2), with 3 products and 2 reductions
+    dfelm_x8_t tt1, tt2, tt3;
+    unsigned int i;
+
+    fp2mul_unr_x8(a, b, tt1, tt2, tt3);
+    for (i = 0; i < 2*NWORDS52_FIELD; i++) {
+        tt3[i] = _mm512_sub_epi64(_mm512_sub_epi64(tt3[i], tt1[i]), tt2[i]);     // tt3 = a0*b1 + a1*b0
+        tt1[i] = _mm512_sub_epi64(tt1[i], tt2[i]);                                  // tt1 = a0*b0 - a1*b1
+    }
+    mp_offset_x8(tt1);
+    rdc_mont_x8(tt3, c[1]);
+    rdc_mont_x8(tt1, c[0]);
+}
+
+
+static void fp2mulsub_mont_x8(const f2elm_x8_t a, const f2elm_x8_t b, const f2elm_x8_t c, const f2elm_x8_t d, f2elm_x8_t e)
+{ // GF(p^2) difference of products of the lanes with a single reduction per coefficient, e = a*b-c*d in GF(p^2)
+    dfelm_x8_t tt1, tt2, tt3, uu1, uu2, uu3;
+    unsigned int i;
+
+    fp2mul_unr_x8(a, b, tt1, tt2, tt3);
+    fp2mul_unr_x8(c, d, uu1, uu2, uu3);
+    for (i = 0; i < 2*NWORDS52_FIELD; i++) {
+        tt3[i] = _mm512_sub_epi64(_mm512_sub_epi64(tt3[i], tt1[i]), tt2[i]);     // tt3 = a0*b1 + a1*b0
+        uu3[i] = _mm512_sub_epi64(_mm512_sub_epi64(uu3[i], uu1[i]), uu2[i]);     // uu3 = c0*d1 + c1*d0
+        tt3[i] = _mm512_sub_epi64(tt3[i], uu3[i]);                                  // tt3 = a0*b1 + a1*b0 - c0*d1 - c1*d0
+        tt1[i] = _mm512_sub_epi64(_mm512_add_epi64(tt1[i], uu2[i]), _mm512_add_epi64(tt2[i], uu1[i]));   // tt1 = a0*b0 + c1*d1 - a1*b1 - c0*d0
+    }
+    mp_offset_x8(tt3);
+    mp_offset_x8(tt1);
+    rdc_mont_x8(tt3, e[1]);
+    rdc_mont_x8(tt1, e[0]);
+}
+
+
+static void fp2sqr_mont_x8(const f2elm_x8_t a, f2elm_x8_t c)
+{ // GF(p^2) squaring of the lanes using Montgomery arithmetic, c = a^2 in GF(p^2)
+    felm_x8_t t1, t2, t3;
+
+    mp_addfast_x8(a[0], a[1], t1);                  // t1 = a0+a1
+    mp_sub_p4_x8(a[0], a[1], t2);                   // t2 = a0-a1
+    mp_addfast_x8(a[0], a[0], t3);                  // t3 = 2a0
+    fpmul_mont_x8(t1, t2, c[0]);                    // c0 = (a0+a1)(a0-a1)
+    fpmul_mont_x8(t3, a[1], c[1]);                  // c1 = 2a0*a1
+}
+
+
+static void fp2inv_mont_x8(f2elm_x8_t a)
+{ // GF(p^2) inversion of the lanes using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2)
+    f2elm_x8_t t1;
+
+    fpsqr_mont_x8(a[0], t1[0]);                     // t10 = a0^2
+    fpsqr_mont_x8(a[1], t1[1]);                     // t11 = a1^2
+    fpadd_x8(t1[0], t1[1], t1[0]);                  // t10 = a0^2+a1^2
+    fpinv_mont_x8(t1[0]);                           // t10 = (a0^2+a1^2)^-1
+    fpneg_x8(a[1]);                                 // a = a0-i*a1
+    fpmul_mont_x8(a[0], t1[0], a[0]);
+    fpmul_mont_x8(a[1], t1[0], a[1]);               // a = (a0-i*a1)*(a0^2+a1^2)^-1
+}
+
+
+/*********************** Conversions between the lanes and the byte encodings ***********************/
+
+static void fp_from_bytes_r52(const unsigned char* x, uint64_t* a)
+{ // Decoding of an element of GF(p) of FP2_ENCODED_BYTES/2 bytes (little endian) into limbs of 52 bits
+    unsigned int i, k, s;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        a[i] = 0;
+    for (i = 0; i < FP2_ENCODED_BYTES / 2; i++) {
+        k = (8*i) / 52;
+        s = (8*i) % 52;
+        a[k] |= ((uint64_t)x[i] << s) & MASK52;
+        if (s > 44)
+            a[k+1] |= (uint64_t)x[i] >> (52 - s);
+    }
+}
+
+
+static void fp_to_bytes_r52(const uint64_t* a, unsigned char* x)
+{ // Encoding of an element of GF(p) in [0, p-1], given in limbs of 52 bits, into FP2_ENCODED_BYTES/2 bytes (little endian)
+    unsigned int i, k, s;
+    uint64_t v;
+
+    for (i = 0; i < FP2_ENCODED_BYTES / 2; i++) {
+        k = (8*i) / 52;
+        s = (8*i) % 52;
+        v = a[k] >> s;
+        if (s > 44)
+            v |= a[k+1] << (52 - s);
+        x[i] = (unsigned char)v;
+    }
+}
+
+
+static void fp2_decode_x8(const unsigned char* x, const size_t stride, f2elm_x8_t dec)
+{ // Parse the elements of GF(p^2) at x + i*stride into lane i, and conversion to Montgomery representation
+    uint64_t a[SIKE_LANES][NWORDS52_FIELD], limb[SIKE_LANES];
+    felm_x8_t R2;
+    unsigned int i, j, k;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        R2[i] = LIMB_X8(Montgomery_R2_r52, i);
+    for (j = 0; j < 2; j++) {
+        for (i = 0; i < SIKE_LANES; i++)
+            fp_from_bytes_r52(x + i*stride + j*(FP2_ENCODED_BYTES / 2), a[i]);
+        for (k = 0; k < NWORDS52_FIELD; k++) {
+            for (i = 0; i < SIKE_LANES; i++)
+                limb[i] = a[i][k];
+            dec[j][k] = _mm512_loadu_si512((const void*)limb);
+        }
+        fpmul_mont_x8(dec[j], R2, dec[j]);                                           // dec = a*R
+    }
+}
+
+
+static void fp2_encode_x8(const f2elm_x8_t x, unsigned char* enc, const size_t stride)
+{ // Conversion of the lanes from Montgomery to standard representation, and encoding of lane i at enc + i*stride
+    uint64_t a[SIKE_LANES][NWORDS52_FIELD], limb[SIKE_LANES];
+    felm_x8_t one, t;
+    unsigned int i, j, k;
+
+    fpzero_x8(one);
+    one[0] = _mm512_set1_epi64(1);
+    for (j = 0; j < 2; j++) {
+        fpmul_mont_x8(x[j], one, t);                                                 // t = x*R^-1
+        fpcorrection_x8(t);
+        for (k = 0; k < NWORDS52_FIELD; k++) {
+            _mm512_storeu_si512((void*)limb, t[k]);
+            for (i = 0; i < SIKE_LANES; i++)
+                a[i][k] = limb[i];
+        }
+        for (i = 0; i < SIKE_LANES; i++)
+            fp_to_bytes_r52(a[i], enc + i*stride + j*(FP2_ENCODED_BYTES / 2));
+    }
+    clear_words((void*)a, SIKE_LANES*NWORDS52_FIELD);                               // The lanes may hold shared secrets
+    clear_words((void*)limb, SIKE_LANES);
+    clear_words((void*)t, sizeof(t)/sizeof(digit_t));
+}
+
+
+static void fp2_load_x8(const digit_t* a, f2elm_x8_t c)
+{ // Element of GF(p^2) of a table, in Montgomery representation with 64-bit words, copied to all the lanes
+    unsigned char bytes[FP2_ENCODED_BYTES / 2];
+    uint64_t limbs[NWORDS52_FIELD];
+    felm_x8_t R2;
+    felm_t t;
+    unsigned int i, j;
+
+    for (i = 0; i < NWORDS52_FIELD; i++)
+        R2[i] = LIMB_X8(Montgomery_R2_r52, i);
+    for (j = 0; j < 2; j++) {
+        from_mont(a + j*NWORDS_FIELD, t);
+        encode_to_bytes(t, bytes, FP2_ENCODED_BYTES / 2);
+        fp_from_bytes_r52(bytes, limbs);
+        for (i = 0; i < NWORDS52_FIELD; i++)
+            c[j][i] = LIMB_X8(limbs, i);
+        fpmul_mont_x8(c[j], R2, c[j]);
+    }
+}
+
+
+static void sk_to_lanes_x8(const unsigned char* sk, const size_t stride, const int nbytes, const bool times4, __m512i* k)
+{ // Secret keys of nbytes bytes at sk + i*stride in lane i of NWORDS_ORDER words, multiplied by 4 if times4 = true
+    digit_t d[SIKE_LANES][NWORDS_ORDER] = {{0}}, word[SIKE_LANES];
+    unsigned int i, j;
+
+    for (i = 0; i < SIKE_LANES; i++) {
+        decode_to_digits(sk + i*stride, d[i], nbytes, NWORDS_ORDER);
+        if (times4) {
+            mp_add(d[i], d[i], d[i], NWORDS_ORDER);
+            mp_add(d[i], d[i], d[i], NWORDS_ORDER);
+        }
+    }
+    for (j = 0; j < NWORDS_ORDER; j++) {
+        for (i = 0; i < SIKE_LANES; i++)
+            word[i] = d[i][j];
+        k[j] = _mm512_loadu_si512((const void*)word);
+    }
+    clear_words((void*)d, SIKE_LANES*NWORDS_ORDER);
+    clear_words((void*)word, SIKE_LANES);
+}
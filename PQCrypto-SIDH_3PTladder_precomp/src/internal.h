@@ -44,11 +44,24 @@ void digit_x_digit(const digit_t a, const digit_t b, digit_t* c);
 // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
 
+// Multiprecision comba squaring, c = a^2, where lng(a) = nwords.
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords);
+
 /************ Montgomery reduction and conversion functions *************/
 
 // Montgomery reduction, c = a mod p
 void rdc_mont(digit_t* a, digit_t* c);
 
+#if defined(_DISPATCH_)
+// Field arithmetic kernels selectable at runtime
+#define FP_IMPL_AUTO    0           // Fastest variant supported by the processor
+#define FP_IMPL_BASE    1           // Portable comba implementation
+#define FP_IMPL_MULX    2           // Assembly using MULX (and ADX if enabled)
+
+// Installs the kernels used by mp_mul, mp_sqr and rdc_mont. Returns the installed variant
+int fp_select_impl(int impl);
+#endif
+
 // Conversion to Montgomery representation
 void to_mont(const digit_t* a, digit_t* mc);
     
@@ -105,5 +118,9 @@ void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
 // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
 
+// Optimal strategy for an isogeny tree with n leaves storing at most maxpts <= STRATEGY_MAX_POINTS points, given the costs of one step and one evaluation. Returns its cost.
+#define STRATEGY_MAX_POINTS    32
+unsigned long long strategy_optimal(unsigned int n, unsigned int maxpts, unsigned long long step, unsigned long long eval, unsigned int* strat);
+
 
 #endif
@@ -0,0 +1,90 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: isogeny tree traversals of the lane engines
+*********************************************************************************************/
+
+// Included by sidh_x8.c and sidh_x2.c after their lane arithmetic, with LANES(f) and LANES_T(t) naming the function f and the type
+// t of the engine, e.g. xDBLe_x8 and f2elm_x8_t. Bob's traversal is defined only with LANES_TRAVERSE_B. The macros are undefined
+// at the end of the file.
+
+
+static void LANES(traverse_A)(LANES_T(point_proj) R, LANES_T(f2elm) A24plus, LANES_T(f2elm) C24, LANES(point_proj)* phi, const unsigned int nphi)
+{ // Alice's isogeny trees from the kernel points R, evaluated at the nphi points phi. A24plus and C24 end as the constants of the
+  // curves before the last 4-isogeny, whose coefficients are left in A24plus and C24 by get_4_isog.
+    LANES_T(point_proj) pts[MAX_INT_POINTS_ALICE];
+    LANES_T(f2elm) coeff[3];
+    unsigned int row, m, i, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+
+    for (row = 1; row < MAX_Alice; row++) {
+        while (index < MAX_Alice-row) {
+            LANES(fp2copy)(R->X, pts[npts]->X);
+            LANES(fp2copy)(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Alice[ii++];
+            LANES(xDBLe)(R, R, A24plus, C24, (int)(2*m));
+            index += m;
+        }
+        LANES(get_4_isog)(R, A24plus, C24, coeff);
+        for (i = 0; i < npts; i++) {
+            LANES(eval_4_isog)(pts[i], coeff);
+        }
+        for (i = 0; i < nphi; i++) {
+            LANES(eval_4_isog)(&phi[i], coeff);
+        }
+
+        LANES(fp2copy)(pts[npts-1]->X, R->X);
+        LANES(fp2copy)(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    LANES(get_4_isog)(R, A24plus, C24, coeff);
+    for (i = 0; i < nphi; i++) {
+        LANES(eval_4_isog)(&phi[i], coeff);
+    }
+}
+
+
+#if defined(LANES_TRAVERSE_B)
+static void LANES(traverse_B)(LANES_T(point_proj) R, LANES_T(f2elm) A24minus, LANES_T(f2elm) A24plus, LANES(point_proj)* phi, const unsigned int nphi)
+{ // Bob's isogeny trees from the kernel points R, evaluated at the nphi points phi. A24minus and A24plus end as the constants of the
+  // codomain curves.
+    LANES_T(point_proj) pts[MAX_INT_POINTS_BOB];
+    LANES_T(f2elm) coeff[3];
+    unsigned int row, m, i, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+
+    for (row = 1; row < MAX_Bob; row++) {
+        while (index < MAX_Bob-row) {
+            LANES(fp2copy)(R->X, pts[npts]->X);
+            LANES(fp2copy)(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Bob[ii++];
+            LANES(xTPLe)(R, R, A24minus, A24plus, (int)m);
+            index += m;
+        }
+        LANES(get_3_isog)(R, A24minus, A24plus, coeff);
+        for (i = 0; i < npts; i++) {
+            LANES(eval_3_isog)(pts[i], coeff);
+        }
+        for (i = 0; i < nphi; i++) {
+            LANES(eval_3_isog)(&phi[i], coeff);
+        }
+
+        LANES(fp2copy)(pts[npts-1]->X, R->X);
+        LANES(fp2copy)(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    LANES(get_3_isog)(R, A24minus, A24plus, coeff);
+    for (i = 0; i < nphi; i++) {
+        LANES(eval_3_isog)(&phi[i], coeff);
+    }
+}
+#endif
+
+
+#undef LANES
+#undef LANES_T
+#undef LANES_TRAVERSE_B
@@ -0,0 +1,281 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: isogeny tree traversal engine
+*           With _PARALLEL_, the point evaluations that follow each get_4_isog/get_3_isog are handed
+*           to up to SIDH_THREADS threads of the worker pool (see workers.c), while the calling thread
+*           continues with the xDBLe/xTPLe chain on the next kernel point. Otherwise, the evaluations
+*           are computed in place. The optimal strategies are computed by strategy_optimal(), which
+*           is shared with the strategy generator tests/strategy_opt.c.
+*********************************************************************************************/
+
+#define STRATEGY_MAX_LEAVES     (MAX_Bob > MAX_Alice ? MAX_Bob : MAX_Alice)
+
+static unsigned short strategy_split[STRATEGY_MAX_POINTS+1][STRATEGY_MAX_LEAVES+1];
+
+
+static unsigned int strategy_emit(unsigned int d, unsigned int leaves, unsigned int* strat, unsigned int k)
+{ // Writes the strategy for a tree with the given number of leaves in traversal order: S(n) = [b] + S(n-b) + S(b)
+    unsigned int b;
+
+    if (leaves <= 1) return k;
+    b = strategy_split[d][leaves];
+    strat[k++] = b;
+    k = strategy_emit(d-1, leaves-b, strat, k);
+    return strategy_emit(d, b, strat, k);
+}
+
+
+unsigned long long strategy_optimal(unsigned int n, unsigned int maxpts, unsigned long long step, unsigned long long eval, unsigned int* strat)
+{ // Computes an optimal strategy for a tree with n leaves that stores at most maxpts points, given the costs of one step and one evaluation.
+  // C[d][i] is the cost of a tree with i leaves storing at most d points: C[d][i] = min_b { C[d-1][i-b] + C[d][b] + b*step + (i-b)*eval }.
+  // Only rows d-1 and d of C are kept. Not reentrant.
+    static unsigned long long C[2][STRATEGY_MAX_LEAVES+1];
+    const unsigned long long inf = (unsigned long long)-1;
+    unsigned long long c, *prev, *cur;
+    unsigned int d, i, b;
+
+    for (d = 0; d <= maxpts; d++) {
+        prev = C[(d+1) & 1];
+        cur = C[d & 1];
+        cur[1] = 0;
+        for (i = 2; i <= n; i++) {
+            cur[i] = inf;
+            if (d == 0) continue;
+            for (b = 1; b < i; b++) {
+                if (prev[i-b] == inf) continue;
+                c = prev[i-b] + cur[b] + b*step + (i-b)*eval;
+                if (c < cur[i]) {
+                    cur[i] = c;
+                    strategy_split[d][i] = (unsigned short)b;
+                }
+            }
+        }
+    }
+    strategy_emit(maxpts, n, strat, 0);
+    return C[maxpts & 1][n];
+}
+
+
+#if defined(_PARALLEL_)
+
+#include <sched.h>
+#include <stdatomic.h>
+#if (TARGET == TARGET_AMD64) || (TARGET == TARGET_x86)
+    #include <immintrin.h>
+#endif
+
+#if !defined(SIDH_THREADS)
+    #define SIDH_THREADS        3                 // Largest number of workers of a traversal
+#endif
+#if (SIDH_THREADS < 2) || (SIDH_THREADS > 4)
+    #error -- "SIDH_THREADS must be between 2 and 4"
+#endif
+#define ISOG_SPINS              4096              // Number of spins before a waiting thread yields the processor
+
+// The evaluations are cheaper on the critical path, so the parallel strategies keep more points in flight
+#define ISOG_POINTS_ALICE       (2*MAX_INT_POINTS_ALICE)
+#define ISOG_POINTS_BOB         (2*MAX_INT_POINTS_BOB)
+#define ISOG_MAX_POINTS         (ISOG_POINTS_BOB > ISOG_POINTS_ALICE ? ISOG_POINTS_BOB : ISOG_POINTS_ALICE)
+
+// Relative costs of one step down the tree (2 doublings or 1 tripling) and of one point evaluation.
+// Without workers they reproduce the sequential strategies strat_Alice and strat_Bob of P503 and P751.
+#define ISOG_COST_STEP          25
+#define ISOG_COST_EVAL          22
+
+typedef struct {
+    atomic_uint seq;                              // Sequence number of the last job submitted
+    atomic_uint done;                             // Number of workers that finished the last job
+    atomic_int stop;
+    unsigned int degree;                          // Degree of the isogeny of the last job, 3 or 4
+    const f2elm_t* coeff;
+    point_proj* pts[ISOG_MAX_POINTS+3];
+    unsigned int npts;
+    unsigned int nworkers;                        // Number of workers actually running
+    const unsigned int* strat;                    // Strategy to be used with this engine
+    worker_job_t job;                             // Job of the workers taken from the pool
+} isog_engine_t;
+
+static unsigned int strat_Alice_par[SIDH_THREADS][MAX_Alice-1], strat_Bob_par[SIDH_THREADS][MAX_Bob-1];
+static unsigned int isog_max_workers;            // Workers of a traversal: SIDH_THREADS, at most one less than the number of processors
+static pthread_once_t strat_par_once = PTHREAD_ONCE_INIT;
+static THREAD_LOCAL bool isog_sequential = false;    // Set by threads that must not start workers, e.g. the caller of a concurrent encapsulation
+
+
+static inline void isog_relax(unsigned int* spins)
+{ // Busy-waiting step, yields the processor after ISOG_SPINS consecutive spins
+
+    if (++(*spins) < ISOG_SPINS) {
+#if (TARGET == TARGET_AMD64) || (TARGET == TARGET_x86)
+        _mm_pause();
+#endif
+    } else {
+        *spins = 0;
+        sched_yield();
+    }
+}
+
+
+static void strategy_parallel_init(void)
+{ // Parallel-aware strategies for 1 to SIDH_THREADS workers: the calling thread only evaluates the next kernel point, the 
+  // remaining evaluations are spread across the workers and run concurrently with the next chain of doublings or triplings.
+  // Spinning workers must not compete for a core, so a traversal takes at most one less than the number of online processors.
+    unsigned int w, ncpus = workers_cpus();
+
+    isog_max_workers = (ncpus <= SIDH_THREADS) ? ncpus-1 : SIDH_THREADS;
+    for (w = 1; w <= SIDH_THREADS; w++) {
+        strategy_optimal(MAX_Alice, ISOG_POINTS_ALICE, (w+1)*ISOG_COST_STEP, ISOG_COST_EVAL, strat_Alice_par[w-1]);
+        strategy_optimal(MAX_Bob, ISOG_POINTS_BOB, (w+1)*ISOG_COST_STEP, ISOG_COST_EVAL, strat_Bob_par[w-1]);
+    }
+}
+
+
+static void isog_engine_run(isog_engine_t* E, unsigned int first, unsigned int stride)
+{ // Evaluates the isogeny of the current job at points first, first+stride, first+2*stride, ...
+    unsigned int i;
+
+    if (E->degree == 4) {
+        for (i = first; i < E->npts; i += stride) {
+            eval_4_isog(E->pts[i], (f2elm_t*)E->coeff);
+        }
+    } else {
+        for (i = first; i < E->npts; i += stride) {
+            eval_3_isog(E->pts[i], E->coeff);
+        }
+    }
+}
+
+
+static void isog_worker(void* arg, unsigned int id, unsigned int nworkers)
+{ // Pool job: waits for a new batch of evaluations, evaluates its share of the points and reports completion, until the engine is stopped
+    isog_engine_t* E = (isog_engine_t*)arg;
+    unsigned int seen = 0, seq, spins = 0;
+
+    while (true) {
+        while ((seq = atomic_load_explicit(&E->seq, memory_order_acquire)) == seen) {
+            if (atomic_load_explicit(&E->stop, memory_order_acquire)) return;
+            isog_relax(&spins);
+        }
+        seen = seq;
+        isog_engine_run(E, id, nworkers);
+        atomic_fetch_add_explicit(&E->done, 1, memory_order_release);
+    }
+}
+
+
+static void isog_engine_start(isog_engine_t* E, unsigned int party)
+{ // Takes up to isog_max_workers workers from the pool. If no worker is available the engine falls back to the sequential traversal.
+    unsigned int nworkers;
+
+    pthread_once(&strat_par_once, strategy_parallel_init);
+    nworkers = isog_sequential ? 0 : isog_max_workers;
+    atomic_init(&E->seq, 0);
+    atomic_init(&E->done, 0);
+    atomic_init(&E->stop, 0);
+    E->npts = 0;
+    E->nworkers = workers_post(&E->job, isog_worker, E, nworkers);
+    atomic_store_explicit(&E->done, E->nworkers, memory_order_relaxed);    // No job pending
+
+    if (E->nworkers == 0) {
+        E->strat = (party == ALICE) ? strat_Alice : strat_Bob;
+    } else {
+        E->strat = (party == ALICE) ? strat_Alice_par[E->nworkers-1] : strat_Bob_par[E->nworkers-1];
+    }
+}
+
+
+static void isog_engine_wait(isog_engine_t* E)
+{ // Waits until the workers are done with the last job
+    unsigned int spins = 0;
+
+    if (E->nworkers == 0) return;
+    while (atomic_load_explicit(&E->done, memory_order_acquire) != E->nworkers) {
+        isog_relax(&spins);
+    }
+}
+
+
+static void isog_engine_stop(isog_engine_t* E)
+{ // Stops the workers and hands them back to the pool
+
+    if (E->nworkers == 0) return;
+    isog_engine_wait(E);
+    atomic_store_explicit(&E->stop, 1, memory_order_release);
+    workers_wait(&E->job);
+    E->nworkers = 0;
+}
+
+
+static void isog_engine_eval(isog_engine_t* E, unsigned int degree, const f2elm_t* coeff, point_proj_t* pts, unsigned int npts, point_proj* phiP, point_proj* phiQ, point_proj* phiR)
+{ // Evaluates the isogeny at pts[0..npts) and at phiP, phiQ and phiR (if not NULL).
+  // The call returns immediately: the points and coeff must not be accessed before isog_engine_wait().
+    unsigned int i, n = 0;
+
+    for (i = 0; i < npts; i++) {
+        E->pts[n++] = pts[i];
+    }
+    if (phiP != NULL) {
+        E->pts[n++] = phiP;
+        E->pts[n++] = phiQ;
+        E->pts[n++] = phiR;
+    }
+    E->degree = degree;
+    E->coeff = coeff;
+    E->npts = n;
+
+    if (E->nworkers == 0) {
+        isog_engine_run(E, 0, 1);
+    } else {
+        atomic_store_explicit(&E->done, 0, memory_order_relaxed);
+        atomic_fetch_add_explicit(&E->seq, 1, memory_order_release);
+    }
+}
+
+#else
+
+#define ISOG_POINTS_ALICE       MAX_INT_POINTS_ALICE
+#define ISOG_POINTS_BOB         MAX_INT_POINTS_BOB
+
+typedef struct {
+    const unsigned int* strat;                    // Strategy to be used with this engine
+} isog_engine_t;
+
+
+static void isog_engine_start(isog_engine_t* E, unsigned int party)
+{ // Sequential traversal
+
+    E->strat = (party == ALICE) ? strat_Alice : strat_Bob;
+}
+
+
+static void isog_engine_eval(isog_engine_t* E, unsigned int degree, const f2elm_t* coeff, point_proj_t* pts, unsigned int npts, point_proj* phiP, point_proj* phiQ, point_proj* phiR)
+{ // Evaluates the isogeny at pts[0..npts) and at phiP, phiQ and phiR (if not NULL)
+    unsigned int i;
+
+    (void)E;
+    if (degree == 4) {
+        for (i = 0; i < npts; i++) {
+            eval_4_isog(pts[i], (f2elm_t*)coeff);
+        }
+        if (phiP != NULL) {
+            eval_4_isog(phiP, (f2elm_t*)coeff);
+            eval_4_isog(phiQ, (f2elm_t*)coeff);
+            eval_4_isog(phiR, (f2elm_t*)coeff);
+        }
+    } else {
+        for (i = 0; i < npts; i++) {
+            eval_3_isog(pts[i], coeff);
+        }
+        if (phiP != NULL) {
+            eval_3_isog(phiP, coeff);
+            eval_3_isog(phiQ, coeff);
+            eval_3_isog(phiR, coeff);
+        }
+    }
+}
+
+
+#define isog_engine_wait(E)
+#define isog_engine_stop(E)
+
+#endif
@@ -0,0 +1,338 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: background key pair pools
+*           With _PARALLEL_, keypool_start() runs jobs on the worker pool (see workers.c) that generate SIKE
+*           key pairs or SIDH ephemeral key pairs ahead of time into a bounded lock-free ring. The pooled key generations
+*           pop a ready pair, or generate it inline if the pool is empty or not running. Otherwise, the
+*           pooled key generations always generate inline.
+*********************************************************************************************/
+
+#if defined(_PARALLEL_)
+    #include <sched.h>
+    #include <stdatomic.h>
+    #include <stdlib.h>
+#endif
+
+#define KEYPOOLS    3
+
+// States of a pool: keypool_start() and keypool_stop() claim it with a CAS, so that only one of them sets it up or tears it down
+#define KEYPOOL_IDLE        0
+#define KEYPOOL_STARTING    1
+#define KEYPOOL_RUNNING     2
+#define KEYPOOL_STOPPING    3
+
+#if defined(_PARALLEL_)
+typedef struct {
+    atomic_size_t seq;                            // Position of the ring this slot is ready for: pos to push, pos+1 to pop
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+    unsigned char sk[CRYPTO_SECRETKEYBYTES];
+} keypool_slot_t;
+#endif
+
+typedef struct {
+#if defined(_PARALLEL_)
+    atomic_ullong hits;                           // Pairs popped from the ring
+    atomic_ullong misses;                         // Pairs generated inline
+    keypool_slot_t* slots;
+    size_t mask;                                  // Number of slots - 1, a power of two minus one
+    atomic_size_t head, tail;                     // Next positions to pop and to push
+    atomic_uint ready;                            // Pairs in the ring, counted before they are published so that a pop never sees it at 0
+    atomic_int filling;                           // Set when ready is down to low, cleared when it reaches high, both under the mutex
+    atomic_uint state;                            // KEYPOOL_IDLE, KEYPOOL_STARTING, KEYPOOL_RUNNING or KEYPOOL_STOPPING
+    atomic_uint takers;                           // Pooled key generations that found the pool running and may still use the ring
+    int stop;
+    unsigned int low, high;
+    pthread_mutex_t mutex;                        // Guards the sleep and wake-up of the workers and the changes of filling
+    pthread_cond_t cond;
+    worker_job_t job;                             // Workers taken from the worker pool
+#else
+    unsigned long long hits, misses;
+#endif
+} keypool_t;
+
+static keypool_t keypools[KEYPOOLS];
+static const unsigned int keypool_sk_bytes[KEYPOOLS] = { CRYPTO_SECRETKEYBYTES, SECRETKEY_A_BYTES, SECRETKEY_B_BYTES };
+
+
+static void keypool_generate(const unsigned int pool, unsigned char* pk, unsigned char* sk)
+{ // Generates a key pair of the given pool inline
+
+    if (pool == KEYPOOL_SIKE) {
+        crypto_kem_keypair(pk, sk);
+    } else if (pool == KEYPOOL_SIDH_A) {
+        random_mod_order_A(sk);
+        EphemeralKeyGeneration_A(sk, pk);
+    } else {
+        random_mod_order_B(sk);
+        EphemeralKeyGeneration_B(sk, pk);
+    }
+}
+
+
+#if defined(_PARALLEL_)
+
+static unsigned int keypool_push(keypool_t* P, const unsigned char* pk, const unsigned char* sk, const unsigned int skbytes)
+{ // Copies a key pair to the ring, returns the number of pairs ready with it or 0 if the ring is full. Multi-producer, multi-consumer 
+  // bounded queue with a sequence number per slot: a producer claims position pos with a CAS on tail when the slot of pos has sequence 
+  // pos, fills it and publishes it by setting its sequence to pos+1. ready is incremented before the release, so the decrement 
+  // of the consumer that pops the pair always comes after it.
+    keypool_slot_t* slot;
+    size_t pos = atomic_load_explicit(&P->tail, memory_order_relaxed), seq;
+    unsigned int ready;
+
+    while (true) {
+        slot = &P->slots[pos & P->mask];
+        seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq == pos) {
+            if (atomic_compare_exchange_weak_explicit(&P->tail, &pos, pos+1, memory_order_relaxed, memory_order_relaxed)) break;
+        } else if ((ptrdiff_t)(seq - pos) < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&P->tail, memory_order_relaxed);
+        }
+    }
+    memcpy(slot->pk, pk, CRYPTO_PUBLICKEYBYTES);
+    memcpy(slot->sk, sk, skbytes);
+    ready = atomic_fetch_add_explicit(&P->ready, 1, memory_order_relaxed) + 1;
+    atomic_store_explicit(&slot->seq, pos+1, memory_order_release);
+    return ready;
+}
+
+
+static bool keypool_pop(keypool_t* P, unsigned char* pk, unsigned char* sk, const unsigned int skbytes)
+{ // Moves a key pair out of the ring, returns false if it is empty. A consumer claims position pos with a CAS on head when
+  // the slot of pos has sequence pos+1, empties it and hands it back to the producers by setting its sequence to pos+size.
+    keypool_slot_t* slot;
+    size_t pos = atomic_load_explicit(&P->head, memory_order_relaxed), seq;
+
+    while (true) {
+        slot = &P->slots[pos & P->mask];
+        seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq == pos+1) {
+            if (atomic_compare_exchange_weak_explicit(&P->head, &pos, pos+1, memory_order_relaxed, memory_order_relaxed)) break;
+        } else if ((ptrdiff_t)(seq - (pos+1)) < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&P->head, memory_order_relaxed);
+        }
+    }
+    memcpy(pk, slot->pk, CRYPTO_PUBLICKEYBYTES);
+    memcpy(sk, slot->sk, skbytes);
+    memset(slot->sk, 0, skbytes);
+    atomic_store_explicit(&slot->seq, pos+P->mask+1, memory_order_release);
+    return true;
+}
+
+
+static void keypool_wake(keypool_t* P)
+{ // Restarts the workers once the ring is down to the low watermark. filling is read under the mutex: a worker that clears it 
+  // afterwards sees the pops of this take, and one that cleared it before has its store seen here.
+
+    if (atomic_load_explicit(&P->ready, memory_order_relaxed) <= P->low) {
+        pthread_mutex_lock(&P->mutex);
+        if (!atomic_load_explicit(&P->filling, memory_order_relaxed)) {
+            atomic_store_explicit(&P->filling, 1, memory_order_relaxed);
+            pthread_cond_broadcast(&P->cond);
+        }
+        pthread_mutex_unlock(&P->mutex);
+    }
+}
+
+
+static void keypool_worker(void* arg, unsigned int id, unsigned int nworkers)
+{ // Worker job: generates key pairs until the ring holds high pairs, then sleeps until it is down to low. The traversals 
+  // of the worker pool threads are sequential, the workers already keep the cores busy.
+    keypool_t* P = (keypool_t*)arg;
+    const unsigned int pool = (unsigned int)(P - keypools), skbytes = keypool_sk_bytes[pool];
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES], sk[CRYPTO_SECRETKEYBYTES];
+    unsigned int ready;
+    int stop;
+
+    (void)id; (void)nworkers;
+    while (true) {
+        pthread_mutex_lock(&P->mutex);
+        while (!P->stop && !atomic_load_explicit(&P->filling, memory_order_relaxed)) {
+            pthread_cond_wait(&P->cond, &P->mutex);
+        }
+        stop = P->stop;
+        pthread_mutex_unlock(&P->mutex);
+        if (stop) break;
+
+        keypool_generate(pool, pk, sk);
+        ready = keypool_push(P, pk, sk, skbytes);
+        if (ready == 0) {                         // Ring full, the pair is dropped
+            clear_words((void*)sk, sizeof(sk)/sizeof(digit_t));
+        }
+        if (ready == 0 || ready >= P->high) {
+            // Takes may have drained the ring since the push, and another worker or a take may have changed filling: it is 
+            // only cleared if the ring is still above the low watermark, so that a wake is never lost
+            pthread_mutex_lock(&P->mutex);
+            if (atomic_load_explicit(&P->ready, memory_order_relaxed) > P->low) {
+                atomic_store_explicit(&P->filling, 0, memory_order_relaxed);
+            }
+            pthread_mutex_unlock(&P->mutex);
+        }
+    }
+    clear_words((void*)sk, sizeof(sk)/sizeof(digit_t));    // The secret part of sk is at the start
+}
+
+
+static void keypool_release(keypool_t* P)
+{ // Stops the workers of a pool claimed by keypool_start() or keypool_stop(), then erases and frees its ring
+    pthread_mutex_lock(&P->mutex);
+    P->stop = 1;
+    pthread_cond_broadcast(&P->cond);
+    pthread_mutex_unlock(&P->mutex);
+    workers_wait(&P->job);
+    clear_words((void*)P->slots, (P->mask+1)*sizeof(keypool_slot_t)/sizeof(digit_t));
+    free(P->slots);
+    P->slots = NULL;
+    pthread_cond_destroy(&P->cond);
+    pthread_mutex_destroy(&P->mutex);
+}
+
+
+int keypool_start(unsigned int pool, unsigned int low, unsigned int high, unsigned int nthreads)
+{ // Takes nthreads workers from the worker pool that keep between low and high key pairs of the given pool ready, see KEYPOOL_* in P*_api.h.
+  // If fewer than nthreads workers are idle, the ones taken are handed back and the pool is left idle.
+    keypool_t* P;
+    size_t size = 1;
+    unsigned int i, state = KEYPOOL_IDLE;
+
+    if (pool >= KEYPOOLS || low >= high || high > KEYPOOL_MAX_SIZE || nthreads == 0 || nthreads > KEYPOOL_MAX_THREADS) {
+        return -1;
+    }
+    P = &keypools[pool];
+    if (!atomic_compare_exchange_strong(&P->state, &state, KEYPOOL_STARTING)) {    // Running, or started or stopped by another thread
+        return -1;
+    }
+    while (size < high + nthreads) size <<= 1;    // Room for the pairs in flight when the high watermark is reached
+    P->slots = (keypool_slot_t*)calloc(size, sizeof(keypool_slot_t));
+    if (P->slots == NULL) {
+        atomic_store(&P->state, KEYPOOL_IDLE);
+        return -1;
+    }
+    for (i = 0; i < size; i++) {
+        atomic_init(&P->slots[i].seq, i);
+    }
+    P->mask = size - 1;
+    atomic_init(&P->head, 0);
+    atomic_init(&P->tail, 0);
+    atomic_init(&P->ready, 0);
+    atomic_init(&P->filling, 1);
+    atomic_init(&P->takers, 0);
+    P->stop = 0;
+    P->low = low;
+    P->high = high;
+    pthread_mutex_init(&P->mutex, NULL);
+    pthread_cond_init(&P->cond, NULL);
+    if (workers_post(&P->job, keypool_worker, P, nthreads) < nthreads) {
+        keypool_release(P);                       // The pool is not running yet, so no pooled key generation uses the ring
+        atomic_store(&P->state, KEYPOOL_IDLE);
+        return -1;
+    }
+    atomic_store(&P->state, KEYPOOL_RUNNING);
+    return 0;
+}
+
+
+void keypool_stop(unsigned int pool)
+{ // Stops the workers of the given pool, waits for the pooled key generations still using the ring and erases the key pairs left in it
+    keypool_t* P;
+    unsigned int state = KEYPOOL_RUNNING;
+
+    if (pool >= KEYPOOLS) return;
+    P = &keypools[pool];
+    if (!atomic_compare_exchange_strong(&P->state, &state, KEYPOOL_STOPPING)) {    // Not running, or stopped by another thread
+        return;
+    }
+    while (atomic_load(&P->takers) != 0) {        // Pooled key generations that found the pool running, the next ones generate inline
+        sched_yield();
+    }
+    keypool_release(P);
+    atomic_store(&P->state, KEYPOOL_IDLE);
+}
+
+#else
+
+int keypool_start(unsigned int pool, unsigned int low, unsigned int high, unsigned int nthreads)
+{ // Background generation needs _PARALLEL_
+    (void)pool; (void)low; (void)high; (void)nthreads;
+    return -1;
+}
+
+
+void keypool_stop(unsigned int pool)
+{
+    (void)pool;
+}
+
+#endif
+
+
+int keypool_stats(unsigned int pool, unsigned long long* hits, unsigned long long* misses, unsigned int* ready)
+{ // Number of pooled key generations served from the ring and inline, and number of key pairs in the ring
+    if (pool >= KEYPOOLS) {
+        return -1;
+    }
+#if defined(_PARALLEL_)
+    *hits = atomic_load(&keypools[pool].hits);
+    *misses = atomic_load(&keypools[pool].misses);
+    *ready = (atomic_load(&keypools[pool].state) == KEYPOOL_RUNNING) ? atomic_load(&keypools[pool].ready) : 0;
+#else
+    *hits = keypools[pool].hits;
+    *misses = keypools[pool].misses;
+    *ready = 0;
+#endif
+    return 0;
+}
+
+
+static int keypool_take(const unsigned int pool, unsigned char* pk, unsigned char* sk)
+{ // Pops a key pair of the given pool, or generates it inline if the ring is empty or the pool is not running
+    keypool_t* P = &keypools[pool];
+
+#if defined(_PARALLEL_)
+    bool hit = false;
+
+    if (atomic_load_explicit(&P->state, memory_order_acquire) == KEYPOOL_RUNNING) {
+        atomic_fetch_add(&P->takers, 1);          // Seen by keypool_stop() unless this take sees the pool stopping
+        if (atomic_load(&P->state) == KEYPOOL_RUNNING) {
+            hit = keypool_pop(P, pk, sk, keypool_sk_bytes[pool]);
+            if (hit) {
+                atomic_fetch_sub_explicit(&P->ready, 1, memory_order_relaxed);
+            }
+            keypool_wake(P);
+        }
+        atomic_fetch_sub_explicit(&P->takers, 1, memory_order_release);
+    }
+    if (hit) {
+        atomic_fetch_add_explicit(&P->hits, 1, memory_order_relaxed);
+        return 0;
+    }
+    atomic_fetch_add_explicit(&P->misses, 1, memory_order_relaxed);
+#else
+    P->misses++;
+#endif
+    keypool_generate(pool, pk, sk);
+    return 0;
+}
+
+
+int crypto_kem_keypair_pooled(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation from the pool KEYPOOL_SIKE, same outputs as crypto_kem_keypair()
+    return keypool_take(KEYPOOL_SIKE, pk, sk);
+}
+
+
+int EphemeralKeyPair_A_pooled(unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral key pair from the pool KEYPOOL_SIDH_A, same outputs as random_mod_order_A() and EphemeralKeyGeneration_A()
+    return keypool_take(KEYPOOL_SIDH_A, PublicKeyA, PrivateKeyA);
+}
+
+
+int EphemeralKeyPair_B_pooled(unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral key pair from the pool KEYPOOL_SIDH_B, same outputs as random_mod_order_B() and EphemeralKeyGeneration_B()
+    return keypool_take(KEYPOOL_SIDH_B, PublicKeyB, PrivateKeyB);
+}
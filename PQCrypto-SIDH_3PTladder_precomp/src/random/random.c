@@ -1,8 +1,10 @@
 /********************************************************************************************
 * Hardware-based random number generation function
 *
-* It uses /dev/urandom in Linux and CNG's BCryptGenRandom function in Windows
-*********************************************************************************************/ 
+* It uses CNG's BCryptGenRandom function in Windows. On Unix-like systems, each thread runs its own
+* SHAKE256-based generator, seeded and periodically reseeded with getrandom() (or /dev/urandom if
+* getrandom() is not available), so that the small requests of the KEM do not require a system call.
+*********************************************************************************************/
 
 #include "random.h"
 #include <stdlib.h>
@@ -10,12 +12,16 @@
     #include <windows.h>
     #include <bcrypt.h>
 #elif defined(__NIX__)
+    #include <string.h>
+    #include <errno.h>
     #include <unistd.h>
     #include <fcntl.h>
-    static int lock = -1;
+    #include <pthread.h>
+    #include <sys/syscall.h>
+    #include "../sha3/fips202.h"
 #endif
 
-#define passed 0 
+#define passed 0
 #define failed 1
 
 
@@ -25,37 +31,127 @@ static inline void delay(unsigned int count)
 }
 
 
+#if defined(__NIX__)
+
+#define RNG_KEY_BYTES        32                       // Key of the generator, replaced after every refill of the buffer
+#define RNG_BUFFER_BYTES     (4*SHAKE256_RATE - RNG_KEY_BYTES)
+#define RNG_RESEED_BYTES     (1 << 20)                // Output between two reseeds from the system
+
+typedef struct {
+    unsigned char key[RNG_KEY_BYTES];
+    unsigned char buffer[RNG_BUFFER_BYTES];
+    unsigned int pos;                                 // Bytes of the buffer already handed out (and erased)
+    unsigned long long output;                        // Bytes generated since the last reseed
+    int seeded;                                       // Cleared in the child process after a fork
+} rng_state_t;
+
+static __thread rng_state_t rng = { {0}, {0}, RNG_BUFFER_BYTES, 0, 0 };
+
+
+static void rng_atfork_child(void)
+{ // In the child of a fork, the only thread is the one that forked: its generator must not repeat the parent's output
+    memset(&rng, 0, sizeof(rng));
+    rng.pos = RNG_BUFFER_BYTES;
+}
+
+
+__attribute__((constructor)) static void rng_init(void)
+{
+    pthread_atfork(NULL, NULL, rng_atfork_child);
+}
+
+
+static int system_random(unsigned char* random_array, unsigned int nbytes)
+{ // Reads nbytes from the system, with getrandom() if available or from /dev/urandom
+    int r, fd;
+    unsigned int count = 0;
+
+#if defined(SYS_getrandom)
+    while (count < nbytes) {
+        r = (int)syscall(SYS_getrandom, random_array+count, nbytes-count, 0);
+        if (r == -1) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        count += r;
+    }
+    if (count == nbytes) return passed;
+#endif
+
+    do {
+        fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            delay(0xFFFFF);
+        }
+    } while (fd == -1);
+    while (count < nbytes) {
+        r = (int)read(fd, random_array+count, nbytes-count);
+        if (r == -1) {
+            delay(0xFFFF);
+            continue;
+        }
+        count += r;
+    }
+    close(fd);
+    return passed;
+}
+
+
+static void rng_reseed(void)
+{ // key <- SHAKE256(key || fresh system randomness)
+    unsigned char seed[2*RNG_KEY_BYTES];
+
+    memcpy(seed, rng.key, RNG_KEY_BYTES);
+    system_random(seed+RNG_KEY_BYTES, RNG_KEY_BYTES);
+    shake256(rng.key, RNG_KEY_BYTES, seed, sizeof(seed));
+    memset(seed, 0, sizeof(seed));
+    rng.output = 0;
+    rng.seeded = 1;
+}
+
+
+static void rng_refill(void)
+{ // (key, buffer) <- SHAKE256(key): the previous key is overwritten, so the output handed out so far cannot be recomputed
+    unsigned char out[RNG_KEY_BYTES+RNG_BUFFER_BYTES];
+
+    if (!rng.seeded || rng.output >= RNG_RESEED_BYTES) {
+        rng_reseed();
+    }
+    shake256(out, sizeof(out), rng.key, RNG_KEY_BYTES);
+    memcpy(rng.key, out, RNG_KEY_BYTES);
+    memcpy(rng.buffer, out+RNG_KEY_BYTES, RNG_BUFFER_BYTES);
+    memset(out, 0, sizeof(out));
+    rng.output += RNG_BUFFER_BYTES;
+    rng.pos = 0;
+}
+
+#endif
+
+
 int randombytes(unsigned char* random_array, unsigned long long nbytes)
 { // Generation of "nbytes" of random values
-    
-#if defined(__WINDOWS__)   
+
+#if defined(__WINDOWS__)
     if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, random_array, (unsigned long)nbytes, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
         return failed;
     }
 
 #elif defined(__NIX__)
-    int r, n = (int)nbytes, count = 0;
-    
-    if (lock == -1) {
-        do {
-            lock = open("/dev/urandom", O_RDONLY);
-            if (lock == -1) {
-                delay(0xFFFFF);
-            }
-        } while (lock == -1);
-    }
+    unsigned long long n;
 
-    while (n > 0) {
-        do {
-            r = read(lock, random_array+count, n);
-            if (r == -1) {
-                delay(0xFFFF);
-            }
-        } while (r == -1);
-        count += r;
-        n -= r;
+    while (nbytes > 0) {
+        if (rng.pos == RNG_BUFFER_BYTES) {
+            rng_refill();
+        }
+        n = RNG_BUFFER_BYTES - rng.pos;
+        if (n > nbytes) n = nbytes;
+        memcpy(random_array, rng.buffer+rng.pos, (size_t)n);
+        memset(rng.buffer+rng.pos, 0, (size_t)n);    // Bytes are handed out only once
+        rng.pos += (unsigned int)n;
+        random_array += n;
+        nbytes -= n;
     }
 #endif
 
     return passed;
-}
\ No newline at end of file
+}
@@ -453,4 +453,268 @@ void shake256(unsigned char *output, unsigned long long outlen, const unsigned c
     for (i = 0; i < outlen; i++)
       output[i] = t[i];
   }
+}
+
+
+/********** Incremental SHAKE256 ***********/
+// The input is absorbed in pieces, so that the caller does not have to concatenate them first. Until finalization, pos is the number 
+// of bytes absorbed into the current block; afterwards, it is the number of bytes of the current output block already squeezed.
+
+void shake256_inc_init(shake256incctx *state)
+{
+  size_t i;
+
+  for (i = 0; i < 25; ++i)
+    state->s[i] = 0;
+  state->pos = 0;
+}
+
+
+void shake256_inc_absorb(shake256incctx *state, const unsigned char *input, unsigned long long inlen)
+{
+  uint64_t *s = state->s;
+  unsigned int i, pos = state->pos;
+
+  /* Complete a partial block */
+  while (pos != 0 && inlen > 0)
+  {
+    s[pos >> 3] ^= (uint64_t)*input++ << (8 * (pos & 7));
+    inlen--;
+    if (++pos == SHAKE256_RATE)
+    {
+      KeccakF1600_StatePermute(s);
+      pos = 0;
+    }
+  }
+
+  /* Full blocks */
+  while (inlen >= SHAKE256_RATE)
+  {
+    for (i = 0; i < SHAKE256_RATE / 8; ++i)
+      s[i] ^= load64(input + 8 * i);
+    KeccakF1600_StatePermute(s);
+    inlen -= SHAKE256_RATE;
+    input += SHAKE256_RATE;
+  }
+
+  /* Start of the next block */
+  for (; inlen > 0; inlen--, pos++)
+    s[pos >> 3] ^= (uint64_t)*input++ << (8 * (pos & 7));
+  state->pos = pos;
+}
+
+
+void shake256_inc_finalize(shake256incctx *state)
+{
+  state->s[state->pos >> 3] ^= (uint64_t)0x1F << (8 * (state->pos & 7));
+  state->s[(SHAKE256_RATE - 1) >> 3] ^= (uint64_t)128 << 56;
+  state->pos = SHAKE256_RATE;
+}
+
+
+void shake256_inc_squeeze(unsigned char *output, unsigned long long outlen, shake256incctx *state)
+{
+  unsigned int pos = state->pos;
+
+  while (outlen > 0)
+  {
+    if (pos == SHAKE256_RATE)
+    {
+      KeccakF1600_StatePermute(state->s);
+      pos = 0;
+    }
+    for (; pos < SHAKE256_RATE && outlen > 0; pos++, outlen--)
+      *output++ = (unsigned char)(state->s[pos >> 3] >> (8 * (pos & 7)));
+  }
+  state->pos = pos;
+}
+
+/********** 4-way SHAKE256 ***********/
+// Four SHAKE256 instances on inputs of the same length. The states are interleaved word by word: s[4*i+j] is word i 
+// of instance j. With AVX2 the four states are permuted together, one instance per 64-bit lane of each register.
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+#define ROL4(a, offset) _mm256_or_si256(_mm256_slli_epi64(a, offset), _mm256_srli_epi64(a, 64-(offset)))
+
+static void KeccakF1600_StatePermute4x(uint64_t *state)
+{
+  __m256i A[25], B[25], C[5], D;
+  int i, j, round;
+
+  for (i = 0; i < 25; i++)
+    A[i] = _mm256_loadu_si256((const __m256i*)(state + 4*i));
+
+  for (round = 0; round < NROUNDS; round++)
+  {
+    // Theta
+    for (i = 0; i < 5; i++)
+      C[i] = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(A[i], A[i+5]), _mm256_xor_si256(A[i+10], A[i+15])), A[i+20]);
+    for (i = 0; i < 5; i++)
+    {
+      D = _mm256_xor_si256(C[(i+4)%5], ROL4(C[(i+1)%5], 1));
+      for (j = 0; j < 25; j += 5)
+        A[i+j] = _mm256_xor_si256(A[i+j], D);
+    }
+
+    // Rho and pi
+    B[ 0] = A[ 0];
+    B[ 1] = ROL4(A[ 6], 44);
+    B[ 2] = ROL4(A[12], 43);
+    B[ 3] = ROL4(A[18], 21);
+    B[ 4] = ROL4(A[24], 14);
+    B[ 5] = ROL4(A[ 3], 28);
+    B[ 6] = ROL4(A[ 9], 20);
+    B[ 7] = ROL4(A[10], 3);
+    B[ 8] = ROL4(A[16], 45);
+    B[ 9] = ROL4(A[22], 61);
+    B[10] = ROL4(A[ 1], 1);
+    B[11] = ROL4(A[ 7], 6);
+    B[12] = ROL4(A[13], 25);
+    B[13] = ROL4(A[19], 8);
+    B[14] = ROL4(A[20], 18);
+    B[15] = ROL4(A[ 4], 27);
+    B[16] = ROL4(A[ 5], 36);
+    B[17] = ROL4(A[11], 10);
+    B[18] = ROL4(A[17], 15);
+    B[19] = ROL4(A[23], 56);
+    B[20] = ROL4(A[ 2], 62);
+    B[21] = ROL4(A[ 8], 55);
+    B[22] = ROL4(A[14], 39);
+    B[23] = ROL4(A[15], 41);
+    B[24] = ROL4(A[21], 2);
+
+    // Chi
+    for (j = 0; j < 25; j += 5)
+      for (i = 0; i < 5; i++)
+        A[i+j] = _mm256_xor_si256(B[i+j], _mm256_andnot_si256(B[(i+1)%5+j], B[(i+2)%5+j]));
+
+    // Iota
+    A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x((long long)KeccakF_RoundConstants[round]));
+  }
+
+  for (i = 0; i < 25; i++)
+    _mm256_storeu_si256((__m256i*)(state + 4*i), A[i]);
+}
+
+#else
+
+static void KeccakF1600_StatePermute4x(uint64_t *state)
+{
+  uint64_t t[25];
+  int i, j;
+
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < 25; i++)
+      t[i] = state[4*i+j];
+    KeccakF1600_StatePermute(t);
+    for (i = 0; i < 25; i++)
+      state[4*i+j] = t[i];
+  }
+}
+
+#endif
+
+
+static void keccak_absorb4x(uint64_t *s, unsigned int r, const unsigned char *m0, const unsigned char *m1, const unsigned char *m2, 
+                            const unsigned char *m3, unsigned long long int mlen, unsigned char p)
+{
+  unsigned long long i;
+  unsigned char t[4][200];
+  const unsigned char *m[4] = { m0, m1, m2, m3 };
+  int j;
+
+  while (mlen >= r) 
+  {
+    for (i = 0; i < r / 8; ++i)
+      for (j = 0; j < 4; j++)
+        s[4*i+j] ^= load64(m[j] + 8 * i);
+    
+    KeccakF1600_StatePermute4x(s);
+    mlen -= r;
+    for (j = 0; j < 4; j++)
+      m[j] += r;
+  }
+
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < r; ++i)
+      t[j][i] = 0;
+    for (i = 0; i < mlen; ++i)
+      t[j][i] = m[j][i];
+    t[j][i] = p;
+    t[j][r - 1] |= 128;
+  }
+  for (i = 0; i < r / 8; ++i)
+    for (j = 0; j < 4; j++)
+      s[4*i+j] ^= load64(t[j] + 8 * i);
+}
+
+
+static void keccak_squeezeblocks4x(unsigned char *h0, unsigned char *h1, unsigned char *h2, unsigned char *h3, unsigned long long int nblocks, uint64_t *s, unsigned int r)
+{
+  unsigned int i;
+
+  while(nblocks > 0) 
+  {
+    KeccakF1600_StatePermute4x(s);
+    for (i = 0; i < (r>>3); i++)
+    {
+      store64(h0+8*i, s[4*i+0]);
+      store64(h1+8*i, s[4*i+1]);
+      store64(h2+8*i, s[4*i+2]);
+      store64(h3+8*i, s[4*i+3]);
+    }
+    h0 += r;
+    h1 += r;
+    h2 += r;
+    h3 += r;
+    nblocks--;
+  }
+}
+
+
+void shake256x4_absorb(uint64_t *s, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+	keccak_absorb4x(s, SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
+}
+
+
+void shake256x4_squeezeblocks(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long nblocks, uint64_t *s)
+{
+	keccak_squeezeblocks4x(out0, out1, out2, out3, nblocks, s, SHAKE256_RATE);
+}
+
+
+void shake256x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+  uint64_t s[4*25];
+  unsigned char t[4][SHAKE256_RATE];
+  unsigned long long nblocks = outlen/SHAKE256_RATE;
+  size_t i;
+
+  for (i = 0; i < 4*25; ++i)
+    s[i] = 0;
+  
+  /* Absorb input */
+  keccak_absorb4x(s, SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
+
+  /* Squeeze output */
+  keccak_squeezeblocks4x(out0, out1, out2, out3, nblocks, s, SHAKE256_RATE);
+
+  outlen -= nblocks*SHAKE256_RATE;
+  if (outlen) 
+  {
+    keccak_squeezeblocks4x(t[0], t[1], t[2], t[3], 1, s, SHAKE256_RATE);
+    for (i = 0; i < outlen; i++)
+    {
+      out0[nblocks*SHAKE256_RATE + i] = t[0][i];
+      out1[nblocks*SHAKE256_RATE + i] = t[1][i];
+      out2[nblocks*SHAKE256_RATE + i] = t[2][i];
+      out3[nblocks*SHAKE256_RATE + i] = t[3][i];
+    }
+  }
 }
\ No newline at end of file
@@ -15,5 +15,22 @@ void shake256_absorb(uint64_t *s, const unsigned char *input, unsigned int input
 void shake256_squeezeblocks(unsigned char *output, unsigned long long nblocks, uint64_t *s);
 void shake256(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen);
 
+// Incremental SHAKE256: init, any number of absorb calls, finalize, then any number of squeeze calls.
+typedef struct {
+  uint64_t s[25];
+  unsigned int pos;
+} shake256incctx;
+
+void shake256_inc_init(shake256incctx *state);
+void shake256_inc_absorb(shake256incctx *state, const unsigned char *input, unsigned long long inlen);
+void shake256_inc_finalize(shake256incctx *state);
+void shake256_inc_squeeze(unsigned char *output, unsigned long long outlen, shake256incctx *state);
+
+// 4-way SHAKE256: four instances on inputs of the same length, computed together with AVX2. The state s holds 4*25 words.
+void shake256x4_absorb(uint64_t *s, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen);
+void shake256x4_squeezeblocks(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long nblocks, uint64_t *s);
+void shake256x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen);
+
 
 #endif
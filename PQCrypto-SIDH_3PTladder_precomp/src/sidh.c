@@ -4,8 +4,57 @@
 * Abstract: ephemeral supersingular isogeny Diffie-Hellman key exchange (SIDH)
 *********************************************************************************************/ 
 
+#include <stdlib.h>
+#include <string.h>
+#if (OS_TARGET == OS_NIX)
+    #include <time.h>
+#endif
 #include "random/random.h"
 
+#define LADDER_BENCH_RUNS    3             // Runs of each engine when SIDH_LADDER_AUTO is resolved by timing
+#define LADDER_UNSET         0xFF          // No engine selected yet, the environment variable SIDH_LADDER is read on first use
+
+// Engine used by the key generation by all the threads of the process, LADDER_UNSET until it is selected or read from the 
+// environment, SIDH_LADDER_AUTO until the timing requested with it is done. Threads that resolve it at the same time at worst 
+// repeat the selection, and only the first result is kept.
+static setting_t sidh_ladder = LADDER_UNSET;
+// Faster engine on this host, LADDER_UNSET until both engines are timed for SIDH_LADDER_AUTO, selected for the process or passed 
+// to a single key generation
+static setting_t sidh_ladder_timed = LADDER_UNSET;
+
+#if defined(BENCH_STAGES)
+// Stages of the key generation, the shared secret computation and the KEM, timed by tests/bench_stages.c which includes 
+// the library sources with BENCH_STAGES. STAGE(s) adds the cycles elapsed since the previous call to stage s.
+enum { STAGE_OTHER, STAGE_LADDER, STAGE_RECOVER, STAGE_TREE, STAGE_INV, STAGE_ENCODE, STAGE_DECODE, STAGE_JINV, STAGE_SHAKE, STAGES };
+static void bench_stage(const unsigned int stage);
+    #define STAGE(s)    bench_stage(s)
+#else
+    #define STAGE(s)
+#endif
+
+#if defined(SIDH_OPCOUNT)
+// Operations counted during the last call of each top-level function on this thread, returned by sidh_opcount(). OPCOUNT_BEGIN 
+// takes a snapshot of the counters of the thread, OPCOUNT_END(op) stores the operations counted since then as those of op.
+#define SIDH_OPS    (SIKE_OP_DEC+1)
+static THREAD_LOCAL uint64_t opcount_last[SIDH_OPS][OPC_COUNTERS];
+static void opcount_end(const unsigned int op, const uint64_t* start);
+    #define OPCOUNT_BEGIN      uint64_t opcount_start[OPC_COUNTERS]; memcpy(opcount_start, opcounters, sizeof(opcounters))
+    #define OPCOUNT_END(op)    opcount_end(op, opcount_start)
+// In a function computing two operations as lanes, OPCOUNT_LANE(l) adds the operations counted since the snapshot to lane l, or half
+// of them to each lane with l = 2, and takes a new snapshot. OPCOUNT_LANES_END(op0, op1) stores the lanes as those of op0 and op1.
+static void opcount_lane(const unsigned int lane, uint64_t lanes[2][OPC_COUNTERS], uint64_t* start);
+    #define OPCOUNT_LANES_BEGIN              OPCOUNT_BEGIN; uint64_t opcount_lanes[2][OPC_COUNTERS] = {{0}}
+    #define OPCOUNT_LANE(l)                  opcount_lane(l, opcount_lanes, opcount_start)
+    #define OPCOUNT_LANES_END(op0, op1)      memcpy(opcount_last[op0], opcount_lanes[0], sizeof(opcount_lanes[0])); \
+                                             memcpy(opcount_last[op1], opcount_lanes[1], sizeof(opcount_lanes[1]))
+#else
+    #define OPCOUNT_BEGIN
+    #define OPCOUNT_END(op)
+    #define OPCOUNT_LANES_BEGIN
+    #define OPCOUNT_LANE(l)
+    #define OPCOUNT_LANES_END(op0, op1)
+#endif
+
 
 static void init_basis(digit_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
 { // Initialization of basis points
@@ -40,55 +89,61 @@ void random_mod_order_A(unsigned char* random_digits)
 }
 
 
-void random_mod_order_B(unsigned char* random_digits)
+int random_mod_order_B(unsigned char* random_digits)
 {  // Generation of Bob's secret key  
    // Outputs random value in [0, 2^Floor(Log(2, oB)) - 1]
+   // Returns the status of randombytes(): 0, or -1 if the random bytes could not be obtained
+    int status;
 
-    randombytes(random_digits, SECRETKEY_B_BYTES);
+    status = randombytes(random_digits, SECRETKEY_B_BYTES);
     random_digits[SECRETKEY_B_BYTES-1] &= MASK_BOB;     // Masking last byte 
+    return status;
 }
 
 
-int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
-{ // Alice's ephemeral public key generation
-  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
-  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, R0 = { 0 }, R1 = { 0 }, R2 = { 0 }, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 },pts[MAX_INT_POINTS_ALICE];
+static void kernel_point_A(const unsigned int ladder, const digit_t* SecretKeyA, const f2elm_t XPA, point_proj_t R)
+{ // Alice's kernel point R = P+[SecretKeyA]Q on E6, computed with the 3-point ladder over pre_for_Alice (or the windowed comb
+  // with PRECOMP_WINDOW) or, with ladder = SIDH_LADDER_MONTGOMERY, with the Montgomery ladder on the basis point Q
     point_full_proj_t tR = { 0 }, tR0 = { 0 }, tR1 = { 0 };
-    f2elm_t XPA, XQA, XRA, coeff[3], A24plus = { 0 }, A24minus = { 0 },C24 = { 0 };
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+    f2elm_t A24plus = { 0 }, A24minus = { 0 }, C24 = { 0 }, A = { 0 };
     int bit1 = 0;
-    digit_t SecretKeyA[NWORDS_ORDER] = {0};
 
-    // Initialize basis points
-    init_basis((digit_t*)A_gen, XPA, XQA, XRA);
-    init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
-    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
-    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
-    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
-
-    // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
+    // Initialize constants: A24plus = A+2C, A24minus = A-2C, C24 = 4C, where A=6, C=1
     fpcopy((digit_t*)&Montgomery_one, A24plus[0]);
     mp2_add(A24plus, A24plus, A24plus);
     mp2_add(A24plus, A24plus, C24);
+    mp2_add(A24plus, C24, A);
     fp2copy(C24, A24minus);
     mp2_add(C24, C24, A24plus);
 
-    // Retrieve kernel point
-    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
-    LADDER3PT_for_Alice((digit_t*)&DBL_QA[0], SecretKeyA, R0, R1);
-
-    fp2copy(R0->X, R2->X);
-    fp2copy(R0->Z, R2->Z);
-    fpcopy((digit_t*)&Montgomery_one, (tR->X)[0]);
-    fpzero((tR->X)[1]);
-    fpcopy((digit_t*)&YQA4, (tR->Y)[0]);
-    fpzero((tR->Y)[1]);
-    fpcopy((digit_t*)&Montgomery_one, (tR->Z)[0]);
-    fpzero((tR->Z)[1]);
-    xADD2((tR->X)[0], R2, R1->X, R1->Z);
-    RecoverY3PT(R0, R1, R2, tR);
-    plus_for_Alice2(SecretKeyA, tR);
+    if (ladder == SIDH_LADDER_MONTGOMERY) {
+        point_proj_t R0 = { 0 }, R1 = { 0 };
+
+        LADDERM_for_Alice(SecretKeyA, R0, R1, A24plus, C24);
+        STAGE(STAGE_LADDER);
+        RecoverY_for_Alice(R0, R1, (digit_t*)&DBL_QA[0], (digit_t*)&DBL_QA[NWORDS_FIELD], A, tR);
+    } else {
+#if defined(PRECOMP_WINDOW)
+        COMB_for_Alice(SecretKeyA, tR);
+        STAGE(STAGE_LADDER);
+#else
+        point_proj_t R0 = { 0 }, R1 = { 0 }, R2 = { 0 };
+
+        LADDER3PT_for_Alice((digit_t*)&DBL_QA[0], SecretKeyA, R0, R1);
+        STAGE(STAGE_LADDER);
+        fp2copy(R0->X, R2->X);
+        fp2copy(R0->Z, R2->Z);
+        fpcopy((digit_t*)&Montgomery_one, (tR->X)[0]);
+        fpzero((tR->X)[1]);
+        fpcopy((digit_t*)&YQA4, (tR->Y)[0]);
+        fpzero((tR->Y)[1]);
+        fpcopy((digit_t*)&Montgomery_one, (tR->Z)[0]);
+        fpzero((tR->Z)[1]);
+        xADD2((tR->X)[0], R2, R1->X, R1->Z);
+        RecoverY3PT(R0, R1, R2, tR);
+#endif
+        plus_for_Alice2(SecretKeyA, tR);
+    }
     bit1 = (SecretKeyA[0 >> LOG2RADIX] >> (0 & (RADIX - 1))) & 1;
     bit1 = -bit1;
     fp2copy(XPA, tR0->X);
@@ -102,8 +157,288 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     fpcopy(&Montgomery_one, tR1->Z[0]);
     fpzero(tR1->Z[1]);
     swap_points2(tR0, tR1, bit1);
-    plus_for_Alice3(tR, tR0, R);
-    xTPL(R, R, A24minus, A24plus);
+    if (ladder == SIDH_LADDER_MONTGOMERY) {
+        plus_for_Alice(tR, tR0, R);
+    } else {
+        plus_for_Alice3(tR, tR0, R);
+        xTPL(R, R, A24minus, A24plus);
+    }
+    STAGE(STAGE_RECOVER);
+}
+
+
+static void kernel_point_B(const unsigned int ladder, const digit_t* SecretKeyB, f2elm_t XPB, f2elm_t XQB, f2elm_t YQB, point_proj_t R)
+{ // Bob's kernel point R = Q+[4*SecretKeyB]P on E6, computed on E0 with the 3-point ladder over pre_for_Bob (or the windowed comb
+  // with PRECOMP_WINDOW) or, with ladder = SIDH_LADDER_MONTGOMERY, with the Montgomery ladder on the basis point P
+    point_full_proj_t tR;
+
+    if (ladder == SIDH_LADDER_MONTGOMERY) {
+        point_proj_t R0 = { 0 }, R1 = { 0 };
+        digit_t SecretKeyB4[NWORDS_ORDER];
+
+        // The 3-point ladder and EphemeralSecretAgreement_B() work with the scalar 4*SecretKeyB
+        mp_add(SecretKeyB, SecretKeyB, SecretKeyB4, NWORDS_ORDER);
+        mp_add(SecretKeyB4, SecretKeyB4, SecretKeyB4, NWORDS_ORDER);
+        LADDERM_for_Bob(XPB[0], SecretKeyB4, R0, R1);
+        STAGE(STAGE_LADDER);
+        RecoverY_for_Bob(R0, R1, XPB[0], YQB[1], tR);          // y(P) = y(Q)/i
+    } else {
+#if defined(PRECOMP_WINDOW)
+        COMB_for_Bob(SecretKeyB, tR);
+        STAGE(STAGE_LADDER);
+#else
+        point_proj_t R0 = { 0 }, R1 = { 0 }, R2 = { 0 };
+        f2elm_t A24 = { 0 }, C24 = { 0 };
+        felm_t* pre = (felm_t*)pre_for_Bob + OBOB_BITS + 2;
+
+        // Initialize constants: A24 = A+2C, C24 = 4C, where A=0, C=1
+        fpcopy((digit_t*)&Montgomery_one, A24[0]);
+        mp2_add(A24, A24, A24);
+        mp2_add(A24, A24, C24);
+
+        LADDER3PT_for_Bob(XPB[0], SecretKeyB, R0, R1);
+        STAGE(STAGE_LADDER);
+        xDBL(R0, R0, A24, C24);
+        xDBL(R0, R0, A24, C24);
+        xDBL(R1, R1, A24, C24);
+        xDBL(R1, R1, A24, C24);
+        fp2copy(R0->X, R2->X);
+        fp2copy(R0->Z, R2->Z);
+        pre = pre + 1;
+        fpcopy(*pre, (tR->X)[0]);
+        fpzero((tR->X)[1]);
+        pre = pre + 1;
+        fpcopy(*pre, (tR->Y)[0]);
+        fpzero((tR->Y)[1]);
+        fpcopy((digit_t*)&Montgomery_one, (tR->Z)[0]);
+        fpzero((tR->Z)[1]);
+        xADD2((tR->X)[0], R2, R1->X, R1->Z);
+        RecoverY3PT(R0, R1, R2, tR);
+#endif
+    }
+    plus_for_Bob(tR, XQB, YQB, R);
+    iso_for_Bob(R, R);
+    STAGE(STAGE_RECOVER);
+}
+
+
+#if (OS_TARGET == OS_NIX)
+static uint64_t ladder_time(const unsigned int ladder)
+{ // Best time in nanoseconds over LADDER_BENCH_RUNS runs of the kernel point computations of both parties with the given engine
+    point_proj_t R;
+    f2elm_t XPA, XQA, XRA, XPB, XQB, YQB;
+    digit_t SecretKeyA[NWORDS_ORDER], SecretKeyB[NWORDS_ORDER];
+    struct timespec start, stop;
+    uint64_t ns, best = (uint64_t)-1;
+    unsigned int i;
+#if defined(SIDH_OPCOUNT)
+    uint64_t saved[OPC_COUNTERS];
+
+    memcpy(saved, opcounters, sizeof(opcounters));          // The timing runs are not counted
+#endif
+
+    // Fixed scalars, the ladders run in constant time
+    memset(SecretKeyA, 0xA5, sizeof(SecretKeyA));
+    memset(SecretKeyB, 0x5A, sizeof(SecretKeyB));
+    init_basis((digit_t*)A_gen, XPA, XQA, XRA);
+    init_basis_base_for_Bob((digit_t*)pre_for_Bob, XPB, XQB, YQB);
+
+    for (i = 0; i < LADDER_BENCH_RUNS; i++) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        kernel_point_A(ladder, SecretKeyA, XPA, R);
+        kernel_point_B(ladder, SecretKeyB, XPB, XQB, YQB, R);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        ns = (uint64_t)(stop.tv_sec - start.tv_sec)*1000000000 + (uint64_t)stop.tv_nsec - (uint64_t)start.tv_nsec;
+        if (ns < best) best = ns;
+    }
+#if defined(SIDH_OPCOUNT)
+    memcpy(opcounters, saved, sizeof(opcounters));
+#endif
+    return best;
+}
+#endif
+
+
+static unsigned int ladder_fastest(void)
+{ // Returns the faster engine on this host, timed on the first call (the 3-point ladder where no timer is available)
+    unsigned int ladder = setting_load(&sidh_ladder_timed);
+
+    if (ladder == LADDER_UNSET) {
+#if (OS_TARGET == OS_NIX)
+        ladder = (ladder_time(SIDH_LADDER_MONTGOMERY) < ladder_time(SIDH_LADDER_3PT)) ? SIDH_LADDER_MONTGOMERY : SIDH_LADDER_3PT;
+#else
+        ladder = SIDH_LADDER_3PT;
+#endif
+        if (!setting_cas(&sidh_ladder_timed, LADDER_UNSET, ladder)) {  // Timed by another thread meanwhile
+            ladder = setting_load(&sidh_ladder_timed);
+        }
+    }
+    return ladder;
+}
+
+
+static unsigned int sidh_ladder_resolve(void)
+{ // Returns the engine of the key generation. If none was selected, it is read once from the environment variable SIDH_LADDER 
+  // ("3pt", "montgomery" or "auto"), by default the 3-point ladder. Only SIDH_LADDER_AUTO, set explicitly, times both engines 
+  // on this host (the 3-point ladder is used where no timer is available)
+    unsigned int ladder = setting_load(&sidh_ladder), other;
+    const char* env;
+
+    if (ladder == LADDER_UNSET) {
+        env = getenv("SIDH_LADDER");
+        if (env != NULL && strcmp(env, "montgomery") == 0) {
+            ladder = SIDH_LADDER_MONTGOMERY;
+        } else if (env != NULL && strcmp(env, "auto") == 0) {
+            ladder = SIDH_LADDER_AUTO;
+        } else {
+            ladder = SIDH_LADDER_3PT;
+        }
+        if (!setting_cas(&sidh_ladder, LADDER_UNSET, ladder)) {        // Selected by another thread meanwhile
+            ladder = setting_load(&sidh_ladder);
+        }
+    }
+    if (ladder == SIDH_LADDER_AUTO) {
+        ladder = ladder_fastest();
+        if (!setting_cas(&sidh_ladder, SIDH_LADDER_AUTO, ladder)) {    // Set or resolved by another thread meanwhile
+            other = setting_load(&sidh_ladder);
+            if (other != SIDH_LADDER_AUTO) ladder = other;
+        }
+    }
+    return ladder;
+}
+
+
+static unsigned int sidh_ladder_select(const unsigned int ladder)
+{ // Returns the engine of a key generation called with the given ladder: the engine of the process for SIDH_LADDER_DEFAULT, 
+  // the faster one on this host for SIDH_LADDER_AUTO, or LADDER_UNSET if ladder is not one of the SIDH_LADDER_* values
+    switch (ladder) {
+    case SIDH_LADDER_3PT:
+    case SIDH_LADDER_MONTGOMERY:
+        return ladder;
+    case SIDH_LADDER_AUTO:
+        return ladder_fastest();
+    case SIDH_LADDER_DEFAULT:
+        return sidh_ladder_resolve();
+    default:
+        return LADDER_UNSET;
+    }
+}
+
+
+int sidh_set_ladder(unsigned int ladder)
+{ // Selects the engine of the key generation for the whole process, see SIDH_LADDER_* in P*_api.h. With SIDH_LADDER_AUTO, 
+  // both engines are timed here rather than in the next key generation
+    if (ladder != SIDH_LADDER_AUTO && ladder != SIDH_LADDER_3PT && ladder != SIDH_LADDER_MONTGOMERY) {
+        return -1;
+    }
+    setting_store(&sidh_ladder, ladder);
+    if (ladder == SIDH_LADDER_AUTO) {
+        setting_store(&sidh_ladder_timed, LADDER_UNSET);
+        sidh_ladder_resolve();
+    }
+    return 0;
+}
+
+
+unsigned int sidh_get_ladder(void)
+{ // Returns the engine of the key generation, reading SIDH_LADDER or timing the engines if needed
+    return sidh_ladder_resolve();
+}
+
+
+#if defined(SIDH_OPCOUNT)
+static void opcount_end(const unsigned int op, const uint64_t* start)
+{ // Stores the operations counted on this thread since the snapshot start as those of the last call of op
+    unsigned int i;
+
+    for (i = 0; i < OPC_COUNTERS; i++) {
+        opcount_last[op][i] = opcounters[i] - start[i];
+    }
+}
+
+
+static void opcount_lane(const unsigned int lane, uint64_t lanes[2][OPC_COUNTERS], uint64_t* start)
+{ // Adds the operations counted on this thread since the snapshot start to lanes[lane], or half of them to each lane if lane = 2,
+  // and takes a new snapshot
+    uint64_t n;
+    unsigned int i;
+
+    for (i = 0; i < OPC_COUNTERS; i++) {
+        n = opcounters[i] - start[i];
+        if (lane < 2) {
+            lanes[lane][i] += n;
+        } else {
+            lanes[0][i] += n/2;
+            lanes[1][i] += n - n/2;
+        }
+        start[i] = opcounters[i];
+    }
+}
+
+
+int sidh_opcount(unsigned int op, sidh_opcount_t* count)
+{ // Operations of the last call of op on the calling thread, see SIDH_OP_* and SIKE_OP_* in P*_api.h
+    const uint64_t* c;
+
+    if (op >= SIDH_OPS || count == NULL) {
+        return -1;
+    }
+    c = opcount_last[op];
+    count->mul = c[OPC_MUL];
+    count->sqr = c[OPC_SQR];
+    count->rdc = c[OPC_RDC];
+    count->add = c[OPC_ADD];
+    count->sub = c[OPC_SUB];
+    count->inv = c[OPC_INV];
+    count->xdbl = c[OPC_XDBL];
+    count->xtpl = c[OPC_XTPL];
+    count->xdbladd = c[OPC_XDBLADD];
+    count->xadd = c[OPC_XADD];
+    count->get_2_isog = c[OPC_GET_2_ISOG];
+    count->eval_2_isog = c[OPC_EVAL_2_ISOG];
+    count->get_3_isog = c[OPC_GET_3_ISOG];
+    count->eval_3_isog = c[OPC_EVAL_3_ISOG];
+    count->get_4_isog = c[OPC_GET_4_ISOG];
+    count->eval_4_isog = c[OPC_EVAL_4_ISOG];
+    return 0;
+}
+#endif
+
+
+int EphemeralKeyGeneration_A_ladder(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, unsigned int ladder)
+{ // Alice's ephemeral public key generation with the kernel point computed by the given engine
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1], an engine ladder, one of the SIDH_LADDER_* values.
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+  // Returns -1 if ladder is not a SIDH_LADDER_* value.
+    point_proj_t R, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 },pts[ISOG_POINTS_ALICE];
+    f2elm_t XPA, XQA, XRA, coeff[3], A24plus = { 0 }, C24 = { 0 };
+    unsigned int row, m, index = 0, pts_index[ISOG_POINTS_ALICE], npts = 0, ii = 0;
+    isog_engine_t engine;
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+    OPCOUNT_BEGIN;
+
+    ladder = sidh_ladder_select(ladder);
+    if (ladder == LADDER_UNSET) {
+        return -1;
+    }
+
+    // Initialize basis points
+    init_basis((digit_t*)A_gen, XPA, XQA, XRA);
+    init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
+    fpcopy((digit_t*)&Montgomery_one, A24plus[0]);
+    mp2_add(A24plus, A24plus, A24plus);
+    mp2_add(A24plus, A24plus, C24);
+    mp2_add(C24, C24, A24plus);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    STAGE(STAGE_OTHER);
+    kernel_point_A(ladder, SecretKeyA, XPA, R);
 
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
@@ -117,24 +452,21 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
 #endif
 
     // Traverse tree
+    isog_engine_start(&engine, ALICE);
     index = 0;        
     for (row = 1; row < MAX_Alice; row++) {
         while (index < MAX_Alice-row) {
             fp2copy(R->X, pts[npts]->X);
             fp2copy(R->Z, pts[npts]->Z);
             pts_index[npts++] = index;
-            m = strat_Alice[ii++];
+            m = engine.strat[ii++];
             xDBLe(R, R, A24plus, C24, (int)(2*m));
             index += m;
         }
-        get_4_isog(R, A24plus, C24, coeff);        
-
-        for (i = 0; i < npts; i++) {
-            eval_4_isog(pts[i], coeff);
-        }
-        eval_4_isog(phiP, coeff);
-        eval_4_isog(phiQ, coeff);
-        eval_4_isog(phiR, coeff);
+        isog_engine_wait(&engine);
+        get_4_isog(R, A24plus, C24, coeff);
+        eval_4_isog(pts[npts-1], coeff);                    // Next kernel point, the other points may be evaluated in the background
+        isog_engine_eval(&engine, 4, coeff, pts, npts-1, phiP, phiQ, phiR);
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -142,35 +474,53 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
         npts -= 1;
     }
 
-    get_4_isog(R, A24plus, C24, coeff); 
-    eval_4_isog(phiP, coeff);
-    eval_4_isog(phiQ, coeff);
-    eval_4_isog(phiR, coeff);
+    isog_engine_wait(&engine);
+    get_4_isog(R, A24plus, C24, coeff);
+    isog_engine_eval(&engine, 4, coeff, NULL, 0, phiP, phiQ, phiR);
+    isog_engine_stop(&engine);
+    STAGE(STAGE_TREE);
 
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
     fp2mul_mont(phiP->X, phiP->Z, phiP->X);
     fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
     fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+    STAGE(STAGE_INV);
                 
     // Format public key                   
     fp2_encode(phiP->X, PublicKeyA);
     fp2_encode(phiQ->X, PublicKeyA + FP2_ENCODED_BYTES);
     fp2_encode(phiR->X, PublicKeyA + 2*FP2_ENCODED_BYTES);
+    STAGE(STAGE_ENCODE);
 
+    OPCOUNT_END(SIDH_OP_KEYGEN_A);
     return 0;
 }
 
-int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
-{ // Bob's ephemeral public key generation
-  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+
+int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral public key generation with the engine of the process
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    return EphemeralKeyGeneration_A_ladder(PrivateKeyA, PublicKeyA, SIDH_LADDER_DEFAULT);
+}
+
+
+int EphemeralKeyGeneration_B_ladder(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, unsigned int ladder)
+{ // Bob's ephemeral public key generation with the kernel point computed by the given engine
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1], an engine ladder, one of the SIDH_LADDER_* values.
   // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R = { 0 }, R0 = { 0 }, R1 = { 0 }, R2 = { 0 }, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 }, pts[MAX_INT_POINTS_BOB];
-    point_full_proj_t tR;
-    felm_t* pre = 0;
-    pre = (felm_t*)pre_for_Bob + OBOB_BITS + 2;
-    f2elm_t XPB, XQB, YQB, coeff[3], A24plus = { 0 }, A24minus = { 0 }, A24 = { 0 }, C24 = { 0 }, A = { 0 };
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+  // Returns -1 if ladder is not a SIDH_LADDER_* value.
+    point_proj_t R = { 0 }, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 }, pts[ISOG_POINTS_BOB];
+    f2elm_t XPB, XQB, YQB, coeff[3], A24plus = { 0 }, A24minus = { 0 };
+    unsigned int row, m, index = 0, pts_index[ISOG_POINTS_BOB], npts = 0, ii = 0;
+    isog_engine_t engine;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
+    OPCOUNT_BEGIN;
+
+    ladder = sidh_ladder_select(ladder);
+    if (ladder == LADDER_UNSET) {
+        return -1;
+    }
 
     // Initialize basis points
     init_basis_base_for_Bob((digit_t*)pre_for_Bob, XPB, XQB, YQB);
@@ -179,58 +529,34 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
     fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
 
-    
-    // Initialize constants: A24 = A+2C, C24 = 4C, where A=0, C=1
+
+    // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
     fpcopy((digit_t*)&Montgomery_one, A24plus[0]);
     mp2_add(A24plus, A24plus, A24plus);
-    fp2copy(A24plus, A24);
-    mp2_add(A24plus, A24plus, C24);
-    // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
     mp2_add(A24plus, A24plus, A24minus);
-    mp2_add(A24plus, A24minus, A);
     mp2_add(A24minus, A24minus, A24plus);
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
-    LADDER3PT_for_Bob(XPB[0], SecretKeyB, R0, R1);
-    xDBL(R0, R0, A24, C24);
-    xDBL(R0, R0, A24, C24);
-    xDBL(R1, R1, A24, C24);
-    xDBL(R1, R1, A24, C24);
-    fp2copy(R0->X, R2->X);
-    fp2copy(R0->Z, R2->Z);
-    pre = pre + 1;
-    fpcopy(*pre, (tR->X)[0]);
-    fpzero((tR->X)[1]);
-    pre = pre + 1;
-    fpcopy(*pre, (tR->Y)[0]);
-    fpzero((tR->Y)[1]);
-    fpcopy((digit_t*)&Montgomery_one, (tR->Z)[0]);
-    fpzero((tR->Z)[1]);
-    xADD2((tR->X)[0], R2, R1->X, R1->Z);
-    RecoverY3PT(R0, R1, R2, tR);
-    plus_for_Bob(tR, XQB, YQB, R);
-    iso_for_Bob(R, R);
+    STAGE(STAGE_OTHER);
+    kernel_point_B(ladder, SecretKeyB, XPB, XQB, YQB, R);
     
     // Traverse tree
+    isog_engine_start(&engine, BOB);
     index = 0;  
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
             fp2copy(R->X, pts[npts]->X);
             fp2copy(R->Z, pts[npts]->Z);
             pts_index[npts++] = index;
-            m = strat_Bob[ii++];
+            m = engine.strat[ii++];
             xTPLe(R, R, A24minus, A24plus, (int)m);
             index += m;
         } 
+        isog_engine_wait(&engine);
         get_3_isog(R, A24minus, A24plus, coeff);
-
-        for (i = 0; i < npts; i++) {
-            eval_3_isog(pts[i], coeff);
-        }     
-        eval_3_isog(phiP, coeff);
-        eval_3_isog(phiQ, coeff);
-        eval_3_isog(phiR, coeff);
+        eval_3_isog(pts[npts-1], coeff);                    // Next kernel point, the other points may be evaluated in the background
+        isog_engine_eval(&engine, 3, coeff, pts, npts-1, phiP, phiQ, phiR);
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -238,34 +564,48 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
         npts -= 1;
     }
     
+    isog_engine_wait(&engine);
     get_3_isog(R, A24minus, A24plus, coeff);
-    eval_3_isog(phiP, coeff);
-    eval_3_isog(phiQ, coeff);
-    eval_3_isog(phiR, coeff);
+    isog_engine_eval(&engine, 3, coeff, NULL, 0, phiP, phiQ, phiR);
+    isog_engine_stop(&engine);
+    STAGE(STAGE_TREE);
 
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
     fp2mul_mont(phiP->X, phiP->Z, phiP->X);
     fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
     fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+    STAGE(STAGE_INV);
     // Format public key
     fp2_encode(phiP->X, PublicKeyB);
     fp2_encode(phiQ->X, PublicKeyB + FP2_ENCODED_BYTES);
     fp2_encode(phiR->X, PublicKeyB + 2*FP2_ENCODED_BYTES);
+    STAGE(STAGE_ENCODE);
 
+    OPCOUNT_END(SIDH_OP_KEYGEN_B);
     return 0;
 }
 
+
+int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral public key generation with the engine of the process
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    return EphemeralKeyGeneration_B_ladder(PrivateKeyB, PublicKeyB, SIDH_LADDER_DEFAULT);
+}
+
 int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
 { // Alice's ephemeral shared secret computation
   // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
   // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
   //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
   // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
-    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
+    point_proj_t R, pts[ISOG_POINTS_ALICE];
     f2elm_t coeff[3], PKB[3], jinv;
     f2elm_t A24plus = {0}, C24 = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+    unsigned int row, m, index = 0, pts_index[ISOG_POINTS_ALICE], npts = 0, ii = 0;
+    isog_engine_t engine;
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
+    OPCOUNT_BEGIN;
       
     // Initialize images of Bob's basis
     fp2_decode(PublicKeyB, PKB[0]);
@@ -280,7 +620,9 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    STAGE(STAGE_DECODE);
     LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A);    
+    STAGE(STAGE_LADDER);
 
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
@@ -291,21 +633,21 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 #endif
 
     // Traverse tree
+    isog_engine_start(&engine, ALICE);
     index = 0;        
     for (row = 1; row < MAX_Alice; row++) {
         while (index < MAX_Alice-row) {
             fp2copy(R->X, pts[npts]->X);
             fp2copy(R->Z, pts[npts]->Z);
             pts_index[npts++] = index;
-            m = strat_Alice[ii++];
+            m = engine.strat[ii++];
             xDBLe(R, R, A24plus, C24, (int)(2*m));
             index += m;
         }
-        get_4_isog(R, A24plus, C24, coeff);        
-
-        for (i = 0; i < npts; i++) {
-            eval_4_isog(pts[i], coeff);
-        }
+        isog_engine_wait(&engine);
+        get_4_isog(R, A24plus, C24, coeff);
+        eval_4_isog(pts[npts-1], coeff);                    // Next kernel point, the other points may be evaluated in the background
+        isog_engine_eval(&engine, 4, coeff, pts, npts-1, NULL, NULL, NULL);
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -313,13 +655,18 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
         npts -= 1;
     }
 
-    get_4_isog(R, A24plus, C24, coeff); 
+    isog_engine_stop(&engine);
+    STAGE(STAGE_TREE);
+    get_4_isog(R, A24plus, C24, coeff);
     mp2_add(A24plus, A24plus, A24plus);                                                
     fp2sub(A24plus, C24, A24plus); 
     fp2add(A24plus, A24plus, A24plus);                    
     j_inv(A24plus, C24, jinv);
+    STAGE(STAGE_JINV);
     fp2_encode(jinv, SharedSecretA);    // Format shared secret
+    STAGE(STAGE_ENCODE);
 
+    OPCOUNT_END(SIDH_OP_AGREEMENT_A);
     return 0;
 }
 
@@ -329,11 +676,13 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
   // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
   //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
   // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
-    point_proj_t R, pts[MAX_INT_POINTS_BOB];
+    point_proj_t R, pts[ISOG_POINTS_BOB];
     f2elm_t coeff[3], PKB[3], jinv;
     f2elm_t A24plus = {0}, A24minus = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+    unsigned int row, m, index = 0, pts_index[ISOG_POINTS_BOB], npts = 0, ii = 0;
+    isog_engine_t engine;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
+    OPCOUNT_BEGIN;
       
     // Initialize images of Alice's basis
     fp2_decode(PublicKeyA, PKB[0]);
@@ -351,24 +700,26 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
     decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
     mp_add(SecretKeyB, SecretKeyB, SecretKeyB, NWORDS_ORDER);
     mp_add(SecretKeyB, SecretKeyB, SecretKeyB, NWORDS_ORDER);
+    STAGE(STAGE_DECODE);
     LADDER3PT2(PKB[1], PKB[0], PKB[2], SecretKeyB, BOB, R, A);
+    STAGE(STAGE_LADDER);
     
     // Traverse tree
+    isog_engine_start(&engine, BOB);
     index = 0;  
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
             fp2copy(R->X, pts[npts]->X);
             fp2copy(R->Z, pts[npts]->Z);
             pts_index[npts++] = index;
-            m = strat_Bob[ii++];
+            m = engine.strat[ii++];
             xTPLe(R, R, A24minus, A24plus, (int)m);
             index += m;
         }
+        isog_engine_wait(&engine);
         get_3_isog(R, A24minus, A24plus, coeff);
-
-        for (i = 0; i < npts; i++) {
-            eval_3_isog(pts[i], coeff);
-        } 
+        eval_3_isog(pts[npts-1], coeff);                    // Next kernel point, the other points may be evaluated in the background
+        isog_engine_eval(&engine, 3, coeff, pts, npts-1, NULL, NULL, NULL);
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -376,12 +727,17 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
         npts -= 1;
     }
      
-    get_3_isog(R, A24minus, A24plus, coeff);    
+    isog_engine_stop(&engine);
+    STAGE(STAGE_TREE);
+    get_3_isog(R, A24minus, A24plus, coeff);
     fp2add(A24plus, A24minus, A);                 
     fp2add(A, A, A);
     fp2sub(A24plus, A24minus, A24plus);                   
     j_inv(A, A24plus, jinv);
+    STAGE(STAGE_JINV);
     fp2_encode(jinv, SharedSecretB);    // Format shared secret
+    STAGE(STAGE_ENCODE);
 
+    OPCOUNT_END(SIDH_OP_AGREEMENT_B);
     return 0;
 }
@@ -0,0 +1,121 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: fused key generation and shared secret computation of Alice for the SIKE encapsulation
+*********************************************************************************************/
+
+// The encapsulation computes two isogenies of degree 2^eA with the same secret key: the key generation from E6 and the shared
+// secret from the curve of Bob's public key. Their kernel points are computed separately, then both trees are traversed in lockstep
+// with strat_Alice as the two lanes of fpx_x2.c, lane 0 for the key generation and lane 1 for the shared secret. With SIDH_OPCOUNT,
+// the operations of each lane are stored as those of SIDH_OP_KEYGEN_A and SIDH_OP_AGREEMENT_A, the two-lane steps being split
+// evenly between them.
+
+
+#define LANES(f)             f##_x2
+#define LANES_T(t)           t##_x2_t
+#include "isogeny_lanes.c"
+
+
+int EphemeralKeyGenerationAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* PublicKeyA, unsigned char* SharedSecretA, unsigned int ladder)
+{ // Alice's ephemeral public key generation and shared secret computation with the same private key, same outputs as
+  // EphemeralKeyGeneration_A_ladder() and EphemeralSecretAgreement_A(). The kernel point of the key generation is computed by the 
+  // engine ladder, one of the SIDH_LADDER_* values. Returns -1 if ladder is not a SIDH_LADDER_* value.
+    point_proj_t R0, R1, phi[3];
+    f2elm_t XPA, XQA, XRA, XPB[3], PKB[3], jinv, t;
+    f2elm_t A24plus[2] = {0}, C24[2] = {0}, A = {0};
+    point_proj_x2_t R;
+    point_proj_x2 phi_x2[3];
+    f2elm_x2_t A24plus_x2, C24_x2;
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+    unsigned int i;
+    OPCOUNT_LANES_BEGIN;
+
+    ladder = sidh_ladder_select(ladder);
+    if (ladder == LADDER_UNSET) {
+        return -1;
+    }
+
+    // Lane 0: Alice's basis and the images of Bob's basis on E6, A24plus = A+2C, C24 = 4C, where A=6, C=1
+    init_basis((digit_t*)A_gen, XPA, XQA, XRA);
+    init_basis((digit_t*)B_gen, XPB[0], XPB[1], XPB[2]);
+    fpcopy((digit_t*)&Montgomery_one, A24plus[0][0]);
+    mp2_add(A24plus[0], A24plus[0], A24plus[0]);
+    mp2_add(A24plus[0], A24plus[0], C24[0]);
+    mp2_add(C24[0], C24[0], A24plus[0]);
+    OPCOUNT_LANE(0);
+
+    // Lane 1: images of Bob's basis in PublicKeyB, A24plus = A+2C, C24 = 4C, where C=1
+    fp2_decode(PublicKeyB, PKB[0]);
+    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB[2]);
+    get_A(PKB[0], PKB[1], PKB[2], A);
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, C24[1][0], NWORDS_FIELD);
+    mp2_add(A, C24[1], A24plus[1]);
+    mp_add(C24[1][0], C24[1][0], C24[1][0], NWORDS_FIELD);
+    OPCOUNT_LANE(1);
+
+    // Retrieve kernel points
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    STAGE(STAGE_DECODE);
+    kernel_point_A(ladder, SecretKeyA, XPA, R0);
+    OPCOUNT_LANE(0);
+    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R1, A);
+    OPCOUNT_LANE(1);
+    STAGE(STAGE_LADDER);
+
+    // Lanes, the images of Bob's basis are also evaluated in lane 1 and discarded
+    fp2_load_x2(R0->X, R1->X, R->X);
+    fp2_load_x2(R0->Z, R1->Z, R->Z);
+    fp2_load_x2(A24plus[0], A24plus[1], A24plus_x2);
+    fp2_load_x2(C24[0], C24[1], C24_x2);
+    for (i = 0; i < 3; i++) {
+        fp2_load_x2(XPB[i], XPB[i], phi_x2[i].X);
+        fp2one_x2(phi_x2[i].Z);
+    }
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x2_t S;
+
+    xDBLe_x2(R, S, A24plus_x2, C24_x2, (int)(OALICE_BITS-1));
+    get_2_isog_x2(S, A24plus_x2, C24_x2);
+    for (i = 0; i < 3; i++) {
+        eval_2_isog_x2(&phi_x2[i], S);
+    }
+    eval_2_isog_x2(R, S);
+#endif
+
+    traverse_A_x2(R, A24plus_x2, C24_x2, phi_x2, 3);
+    for (i = 0; i < 3; i++) {
+        fp2_store_x2(phi_x2[i].X, phi[i]->X, t);
+        fp2_store_x2(phi_x2[i].Z, phi[i]->Z, t);
+    }
+    fp2_store_x2(A24plus_x2, t, A24plus[1]);
+    fp2_store_x2(C24_x2, t, C24[1]);
+    OPCOUNT_LANE(2);
+    STAGE(STAGE_TREE);
+
+    // Format public key
+    inv_3_way(phi[0]->Z, phi[1]->Z, phi[2]->Z);
+    for (i = 0; i < 3; i++) {
+        fp2mul_mont(phi[i]->X, phi[i]->Z, phi[i]->X);
+    }
+    STAGE(STAGE_INV);
+    for (i = 0; i < 3; i++) {
+        fp2_encode(phi[i]->X, PublicKeyA + i*FP2_ENCODED_BYTES);
+    }
+    STAGE(STAGE_ENCODE);
+    OPCOUNT_LANE(0);
+
+    // Format shared secret
+    mp2_add(A24plus[1], A24plus[1], A24plus[1]);
+    fp2sub(A24plus[1], C24[1], A24plus[1]);
+    fp2add(A24plus[1], A24plus[1], A24plus[1]);
+    j_inv(A24plus[1], C24[1], jinv);
+    STAGE(STAGE_JINV);
+    fp2_encode(jinv, SharedSecretA);
+    STAGE(STAGE_ENCODE);
+    OPCOUNT_LANE(1);
+
+    OPCOUNT_LANES_END(SIDH_OP_KEYGEN_A, SIDH_OP_AGREEMENT_A);
+    return 0;
+}
@@ -0,0 +1,190 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: lane-parallel ephemeral SIDH functions for the multi-buffer SIKE functions
+*********************************************************************************************/
+
+// The functions below run SIKE_LANES key generations or shared secret computations of the same party in lockstep, each lane with
+// its own secret key and (for the shared secrets) its own public key. Lane i reads and writes its bytes at i times the given stride.
+// All the lanes follow the same constant-time control flow: the kernel points are computed with the 3-point ladder from the
+// basis of A_gen or B_gen, and the trees are traversed with the sequential strategies strat_Alice and strat_Bob.
+
+
+static void init_basis_x8(const uint64_t* gen, f2elm_x8_t XP, f2elm_x8_t XQ, f2elm_x8_t XR)
+{ // Initialization of the basis points in all the lanes
+
+    fp2_load_x8((const digit_t*)gen, XP);
+    fp2_load_x8((const digit_t*)gen + 2*NWORDS_FIELD, XQ);
+    fp2_load_x8((const digit_t*)gen + 4*NWORDS_FIELD, XR);
+}
+
+
+static void fp2one_x8(f2elm_x8_t a)
+{ // Value one of GF(p^2) in Montgomery representation in all the lanes
+
+    fpone_x8(a[0]);
+    fpzero_x8(a[1]);
+}
+
+
+#define LANES(f)             f##_x8
+#define LANES_T(t)           t##_x8_t
+#define LANES_TRAVERSE_B
+#include "isogeny_lanes.c"
+
+
+static void encode_public_key_x8(point_proj_x8* phi, unsigned char* PublicKey, const size_t pkstride)
+{ // Affine x-coordinates of the three images phi, encoded as the public keys of the lanes
+    unsigned int i;
+
+    inv_3_way_x8(phi[0].Z, phi[1].Z, phi[2].Z);
+    for (i = 0; i < 3; i++) {
+        fp2mul_mont_x8(phi[i].X, phi[i].Z, phi[i].X);
+        fp2_encode_x8(phi[i].X, PublicKey + i*FP2_ENCODED_BYTES, pkstride);
+    }
+}
+
+
+static void EphemeralKeyGeneration_A_x8(const unsigned char* PrivateKeyA, const size_t skstride, unsigned char* PublicKeyA, const size_t pkstride)
+{ // Alice's ephemeral public key generation in the lanes, see EphemeralKeyGeneration_A()
+    point_proj_x8_t R;
+    point_proj_x8 phi[3];
+    f2elm_x8_t XPA, XQA, XRA, A24plus, C24, A;
+    __m512i SecretKeyA[NWORDS_ORDER];
+    unsigned int i;
+
+    // Initialize basis points
+    init_basis_x8(A_gen, XPA, XQA, XRA);
+    init_basis_x8(B_gen, phi[0].X, phi[1].X, phi[2].X);
+    for (i = 0; i < 3; i++) {
+        fp2one_x8(phi[i].Z);
+    }
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
+    fp2one_x8(A24plus);
+    mp2_add_x8(A24plus, A24plus, A24plus);
+    mp2_add_x8(A24plus, A24plus, C24);
+    mp2_add_x8(A24plus, C24, A);
+    mp2_add_x8(C24, C24, A24plus);
+
+    // Retrieve kernel points
+    sk_to_lanes_x8(PrivateKeyA, skstride, SECRETKEY_A_BYTES, false, SecretKeyA);
+    LADDER3PT_x8(XPA, XQA, XRA, SecretKeyA, OALICE_BITS, R, A);
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x8_t S;
+
+    xDBLe_x8(R, S, A24plus, C24, (int)(OALICE_BITS-1));
+    get_2_isog_x8(S, A24plus, C24);
+    for (i = 0; i < 3; i++) {
+        eval_2_isog_x8(&phi[i], S);
+    }
+    eval_2_isog_x8(R, S);
+#endif
+
+    traverse_A_x8(R, A24plus, C24, phi, 3);
+    encode_public_key_x8(phi, PublicKeyA, pkstride);
+}
+
+
+static void EphemeralKeyGeneration_B_x8(const unsigned char* PrivateKeyB, const size_t skstride, unsigned char* PublicKeyB, const size_t pkstride)
+{ // Bob's ephemeral public key generation in the lanes, see EphemeralKeyGeneration_B()
+    point_proj_x8_t R;
+    point_proj_x8 phi[3];
+    f2elm_x8_t XPB, XQB, XRB, A24plus, A24minus, A;
+    __m512i SecretKeyB[NWORDS_ORDER];
+    unsigned int i;
+
+    // Initialize basis points
+    init_basis_x8(B_gen, XPB, XQB, XRB);
+    init_basis_x8(A_gen, phi[0].X, phi[1].X, phi[2].X);
+    for (i = 0; i < 3; i++) {
+        fp2one_x8(phi[i].Z);
+    }
+
+    // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
+    fp2one_x8(A24plus);
+    mp2_add_x8(A24plus, A24plus, A24plus);
+    mp2_add_x8(A24plus, A24plus, A24minus);
+    mp2_add_x8(A24plus, A24minus, A);
+    mp2_add_x8(A24minus, A24minus, A24plus);
+
+    // Retrieve kernel points Q+[4*SecretKeyB]P, the scalar used by EphemeralSecretAgreement_B()
+    sk_to_lanes_x8(PrivateKeyB, skstride, SECRETKEY_B_BYTES, true, SecretKeyB);
+    LADDER3PT_x8(XQB, XPB, XRB, SecretKeyB, OBOB_BITS + 2, R, A);
+
+    traverse_B_x8(R, A24minus, A24plus, phi, 3);
+    encode_public_key_x8(phi, PublicKeyB, pkstride);
+}
+
+
+static void EphemeralSecretAgreement_A_x8(const unsigned char* PrivateKeyA, const size_t skstride, const unsigned char* PublicKeyB, const size_t pkstride, unsigned char* SharedSecretA, const size_t ssstride)
+{ // Alice's ephemeral shared secret computation in the lanes, see EphemeralSecretAgreement_A()
+    point_proj_x8_t R;
+    f2elm_x8_t PKB[3], jinv, A24plus, C24, A;
+    __m512i SecretKeyA[NWORDS_ORDER];
+    unsigned int i;
+
+    // Initialize images of Bob's basis
+    for (i = 0; i < 3; i++) {
+        fp2_decode_x8(PublicKeyB + i*FP2_ENCODED_BYTES, pkstride, PKB[i]);
+    }
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
+    get_A_x8(PKB[0], PKB[1], PKB[2], A);
+    fp2one_x8(C24);
+    mp2_add_x8(C24, C24, C24);
+    mp2_add_x8(A, C24, A24plus);
+    mp2_add_x8(C24, C24, C24);
+
+    // Retrieve kernel points
+    sk_to_lanes_x8(PrivateKeyA, skstride, SECRETKEY_A_BYTES, false, SecretKeyA);
+    LADDER3PT_x8(PKB[0], PKB[1], PKB[2], SecretKeyA, OALICE_BITS, R, A);
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x8_t S;
+
+    xDBLe_x8(R, S, A24plus, C24, (int)(OALICE_BITS-1));
+    get_2_isog_x8(S, A24plus, C24);
+    eval_2_isog_x8(R, S);
+#endif
+
+    traverse_A_x8(R, A24plus, C24, NULL, 0);
+    mp2_add_x8(A24plus, A24plus, A24plus);
+    fp2sub_x8(A24plus, C24, A24plus);
+    fp2add_x8(A24plus, A24plus, A24plus);
+    j_inv_x8(A24plus, C24, jinv);
+    fp2_encode_x8(jinv, SharedSecretA, ssstride);    // Format shared secrets
+}
+
+
+static void EphemeralSecretAgreement_B_x8(const unsigned char* PrivateKeyB, const size_t skstride, const unsigned char* PublicKeyA, const size_t pkstride, unsigned char* SharedSecretB, const size_t ssstride)
+{ // Bob's ephemeral shared secret computation in the lanes, see EphemeralSecretAgreement_B()
+    point_proj_x8_t R;
+    f2elm_x8_t PKB[3], jinv, A24plus, A24minus, A;
+    __m512i SecretKeyB[NWORDS_ORDER];
+    unsigned int i;
+
+    // Initialize images of Alice's basis
+    for (i = 0; i < 3; i++) {
+        fp2_decode_x8(PublicKeyA + i*FP2_ENCODED_BYTES, pkstride, PKB[i]);
+    }
+
+    // Initialize constants: A24plus = A+2C, A24minus = A-2C, where C=1
+    get_A_x8(PKB[0], PKB[1], PKB[2], A);
+    fp2one_x8(A24minus);
+    mp2_add_x8(A24minus, A24minus, A24minus);
+    mp2_add_x8(A, A24minus, A24plus);
+    mp2_sub_p2_x8(A, A24minus, A24minus);
+
+    // Retrieve kernel points
+    sk_to_lanes_x8(PrivateKeyB, skstride, SECRETKEY_B_BYTES, true, SecretKeyB);
+    LADDER3PT_x8(PKB[1], PKB[0], PKB[2], SecretKeyB, OBOB_BITS + 2, R, A);
+
+    traverse_B_x8(R, A24minus, A24plus, NULL, 0);
+    fp2add_x8(A24plus, A24minus, A);
+    fp2add_x8(A, A, A);
+    fp2sub_x8(A24plus, A24minus, A24plus);
+    j_inv_x8(A, A24plus, jinv);
+    fp2_encode_x8(jinv, SharedSecretB, ssstride);    // Format shared secrets
+}
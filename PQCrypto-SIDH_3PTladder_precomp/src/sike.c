@@ -11,11 +11,73 @@
 #include <valgrind/memcheck.h>
 #endif
 
+#if defined(_PARALLEL_)
+// Concurrent encapsulation: Alice's shared secret computation is handed to a thread of the worker pool (see workers.c) while 
+// the calling thread computes Alice's public key. At most SIKE_ENC_HELPERS encapsulations use a worker at the same time.
+typedef struct {
+    const unsigned char* sk;
+    const unsigned char* pk;
+    unsigned char* jinvariant;
+} enc_job_t;
 
-int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
-{ // SIKE's key generation
+static atomic_uint enc_helpers_busy;              // Encapsulations using a worker
+
+
+static void enc_helper(void* arg, unsigned int id, unsigned int nworkers)
+{ // Worker job: computes Alice's shared secret. Its traversal is sequential, the two computations already use two cores.
+    enc_job_t* J = (enc_job_t*)arg;
+
+    (void)id; (void)nworkers;
+    EphemeralSecretAgreement_A(J->sk, J->pk, J->jinvariant);
+}
+
+
+static bool encrypt_concurrent(const unsigned char* ephemeralsk, const unsigned char* pk, unsigned char* ct, unsigned char* jinvariant, const unsigned int ladder)
+{ // Computes Alice's public key ct with the engine ladder and, on a worker, the shared secret jinvariant. Returns false if no 
+  // worker can be used.
+    enc_job_t J = { ephemeralsk, pk, jinvariant };
+    worker_job_t job;
+    bool sequential = isog_sequential;
+
+    if (workers_cpus() < 2) return false;
+    if (atomic_fetch_add(&enc_helpers_busy, 1) >= SIKE_ENC_HELPERS || workers_post(&job, enc_helper, &J, 1) == 0) {
+        atomic_fetch_sub(&enc_helpers_busy, 1);
+        return false;
+    }
+
+    isog_sequential = true;
+    EphemeralKeyGeneration_A_ladder(ephemeralsk, ct, ladder);
+    isog_sequential = sequential;
+
+    workers_wait(&job);
+    atomic_fetch_sub(&enc_helpers_busy, 1);
+    return true;
+}
+#endif
+
+
+static bool enc_fused(void)
+{ // Returns true if Alice's key generation and shared secret computation of an encapsulation are run in lockstep with 
+  // EphemeralKeyGenerationAgreement_A(), i.e., if their tree traversals would not use the workers of the isogeny engine
+#if defined(_PARALLEL_)
+    return isog_sequential || workers_cpus() < 2;
+#else
+    return true;
+#endif
+}
+
+
+int crypto_kem_keypair_ladder(unsigned char *pk, unsigned char *sk, unsigned int ladder)
+{ // SIKE's key generation with the kernel point computed by the engine ladder, one of the SIDH_LADDER_* values
   // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
   //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
+  // Returns -1 if ladder is not a SIDH_LADDER_* value.
+    OPCOUNT_BEGIN;
+
+    ladder = sidh_ladder_select(ladder);
+    if (ladder == LADDER_UNSET) {
+        return -1;
+    }
 
     // Generate lower portion of secret key sk <- s||SK
     randombytes(sk, MSG_BYTES);
@@ -25,7 +87,7 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
 #endif
 
     // Generate public key pk
-    EphemeralKeyGeneration_B(sk + MSG_BYTES, pk);
+    EphemeralKeyGeneration_B_ladder(sk + MSG_BYTES, pk, ladder);
 
     // Append public key pk to secret key sk
     memcpy(&sk[MSG_BYTES + SECRETKEY_B_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
@@ -33,58 +95,129 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_DEFINED(sk, MSG_BYTES + SECRETKEY_B_BYTES);
 #endif
+    OPCOUNT_END(SIKE_OP_KEYPAIR);
     return 0;
 }
 
 
-int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
-{ // SIKE's encapsulation
+int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation with the engine of the process
+  // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
+    return crypto_kem_keypair_ladder(pk, sk, SIDH_LADDER_DEFAULT);
+}
+
+
+static int kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const bool concurrent, unsigned int ladder)
+{ // SIKE's encapsulation, with Alice's key generation and shared secret computation run concurrently if concurrent = true, 
+  // and the kernel point of the key generation computed by the engine ladder. Returns -1 if ladder is not a SIDH_LADDER_* value.
   // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
   // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
   //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
     unsigned char ephemeralsk[SECRETKEY_A_BYTES];
     unsigned char jinvariant[FP2_ENCODED_BYTES];
     unsigned char h[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char m[MSG_BYTES];
+    shake256incctx shake;
+    OPCOUNT_BEGIN;
+
+    ladder = sidh_ladder_select(ladder);
+    if (ladder == LADDER_UNSET) {
+        return -1;
+    }
 
     // Generate ephemeralsk <- G(m||pk) mod oA 
-    randombytes(temp, MSG_BYTES);
+    randombytes(m, MSG_BYTES);
 #ifdef DO_VALGRIND_CHECK
-    VALGRIND_MAKE_MEM_UNDEFINED(temp, MSG_BYTES);
+    VALGRIND_MAKE_MEM_UNDEFINED(m, MSG_BYTES);
 #endif
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    STAGE(STAGE_OTHER);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m, MSG_BYTES);
+    shake256_inc_absorb(&shake, pk, CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ephemeralsk, SECRETKEY_A_BYTES, &shake);
+    STAGE(STAGE_SHAKE);
     ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
     // Encrypt
-    EphemeralKeyGeneration_A(ephemeralsk, ct);
-    EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
+#if defined(_PARALLEL_)
+    if (!concurrent || !encrypt_concurrent(ephemeralsk, pk, ct, jinvariant, ladder))
+#else
+    (void)concurrent;
+#endif
+    {
+        if (enc_fused()) {
+            EphemeralKeyGenerationAgreement_A(ephemeralsk, pk, ct, jinvariant, ladder);
+        } else {
+            EphemeralKeyGeneration_A_ladder(ephemeralsk, ct, ladder);
+            EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
+        }
+    }
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
+    STAGE(STAGE_SHAKE);
     for (int i = 0; i < MSG_BYTES; i++) {
-        ct[i + CRYPTO_PUBLICKEYBYTES] = temp[i] ^ h[i];
+        ct[i + CRYPTO_PUBLICKEYBYTES] = m[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    STAGE(STAGE_OTHER);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m, MSG_BYTES);
+    shake256_inc_absorb(&shake, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &shake);
+    STAGE(STAGE_SHAKE);
 
 #ifdef DO_VALGRIND_CHECK
-    VALGRIND_MAKE_MEM_DEFINED(temp, MSG_BYTES);
+    VALGRIND_MAKE_MEM_DEFINED(m, MSG_BYTES);
 #endif
+    OPCOUNT_END(SIKE_OP_ENC);
     return 0;
 }
 
 
-int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
-{ // SIKE's decapsulation
+int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    return kem_enc(ct, ss, pk, false, SIDH_LADDER_DEFAULT);
+}
+
+
+int crypto_kem_enc_ladder(unsigned char *ct, unsigned char *ss, const unsigned char *pk, unsigned int ladder)
+{ // SIKE's encapsulation with the kernel point of Alice's key generation computed by the engine ladder, same inputs and outputs 
+  // as crypto_kem_enc(). Returns -1 if ladder is not a SIDH_LADDER_* value.
+    return kem_enc(ct, ss, pk, false, ladder);
+}
+
+
+int crypto_kem_enc_concurrent(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation with Alice's key generation and shared secret computation run on two threads, same inputs and outputs 
+  // as crypto_kem_enc(). It runs sequentially without _PARALLEL_, on a single processor or when all the helpers are busy.
+    return kem_enc(ct, ss, pk, true, SIDH_LADDER_DEFAULT);
+}
+
+
+int crypto_kem_dec_ladder(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, unsigned int ladder)
+{ // SIKE's decapsulation with the kernel point of the re-encryption computed by the engine ladder, one of the SIDH_LADDER_* values
   // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
   //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes) 
   // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  // Returns -1 if ladder is not a SIDH_LADDER_* value.
     unsigned char ephemeralsk_[SECRETKEY_A_BYTES];
     unsigned char jinvariant_[FP2_ENCODED_BYTES];
     unsigned char h_[MSG_BYTES];
     unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char m_[MSG_BYTES];
+    shake256incctx shake;
+    OPCOUNT_BEGIN;
+
+    ladder = sidh_ladder_select(ladder);
+    if (ladder == LADDER_UNSET) {
+        return -1;
+    }
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_UNDEFINED(sk, CRYPTO_SECRETKEYBYTES);
 #endif
@@ -92,25 +225,282 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     // Decrypt
     EphemeralSecretAgreement_B(sk + MSG_BYTES, ct, jinvariant_);
     shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+    STAGE(STAGE_SHAKE);
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+        m_[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
     }
 
     // Generate ephemeralsk_ <- G(m||pk) mod oA
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    STAGE(STAGE_OTHER);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m_, MSG_BYTES);
+    shake256_inc_absorb(&shake, &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ephemeralsk_, SECRETKEY_A_BYTES, &shake);
+    STAGE(STAGE_SHAKE);
     ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
-    EphemeralKeyGeneration_A(ephemeralsk_, c0_);
+    EphemeralKeyGeneration_A_ladder(ephemeralsk_, c0_, ladder);
     // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
     int8_t selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES);
-    ct_cmov(temp, sk, MSG_BYTES, selector);
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    ct_cmov(m_, sk, MSG_BYTES, selector);
+    STAGE(STAGE_OTHER);
+    shake256_inc_init(&shake);
+    shake256_inc_absorb(&shake, m_, MSG_BYTES);
+    shake256_inc_absorb(&shake, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&shake);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &shake);
+    STAGE(STAGE_SHAKE);
     
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_DEFINED(sk, CRYPTO_SECRETKEYBYTES);
 #endif
+    OPCOUNT_END(SIKE_OP_DEC);
     return 0;
-}
\ No newline at end of file
+}
+
+
+int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation with the engine of the process
+  // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes) 
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+    return crypto_kem_dec_ladder(ss, ct, sk, SIDH_LADDER_DEFAULT);
+}
+
+
+#if defined(SIKE_LANES)
+/*************** Multi-buffer API: SIKE_LANES independent operations per call ***************/
+// With LANES_AVX512IFMA (see config.h), the isogeny computations of the lanes run in lockstep on the lane-parallel arithmetic of
+// sidh_x8.c. Otherwise the lanes are processed one after the other with the functions above. The SHAKE256 calls are computed four
+// lanes at a time with shake256x4(). A lane fails if its random bytes cannot be obtained, or if its public key encodes a coordinate
+// that is not reduced mod p: its outputs are zeroed and bit i of the returned value is set for lane i. The other lanes are not
+// affected. As in crypto_kem_dec(), such a ciphertext is not a failure of decapsulation: its lane outputs H(s||ct).
+
+static void keygen_A_lanes(const unsigned char* sk, const size_t skstride, unsigned char* pk, const size_t pkstride)
+{ // Alice's public keys of the lanes
+#if defined(LANES_AVX512IFMA)
+    EphemeralKeyGeneration_A_x8(sk, skstride, pk, pkstride);
+#else
+    for (unsigned int i = 0; i < SIKE_LANES; i++) {
+        EphemeralKeyGeneration_A(sk + i*skstride, pk + i*pkstride);
+    }
+#endif
+}
+
+
+static void keygen_B_lanes(const unsigned char* sk, const size_t skstride, unsigned char* pk, const size_t pkstride)
+{ // Bob's public keys of the lanes
+#if defined(LANES_AVX512IFMA)
+    EphemeralKeyGeneration_B_x8(sk, skstride, pk, pkstride);
+#else
+    for (unsigned int i = 0; i < SIKE_LANES; i++) {
+        EphemeralKeyGeneration_B(sk + i*skstride, pk + i*pkstride);
+    }
+#endif
+}
+
+
+static void agreement_A_lanes(const unsigned char* sk, const size_t skstride, const unsigned char* pk, const size_t pkstride, unsigned char* ss, const size_t ssstride)
+{ // Alice's shared secrets of the lanes
+#if defined(LANES_AVX512IFMA)
+    EphemeralSecretAgreement_A_x8(sk, skstride, pk, pkstride, ss, ssstride);
+#else
+    for (unsigned int i = 0; i < SIKE_LANES; i++) {
+        EphemeralSecretAgreement_A(sk + i*skstride, pk + i*pkstride, ss + i*ssstride);
+    }
+#endif
+}
+
+
+static void agreement_B_lanes(const unsigned char* sk, const size_t skstride, const unsigned char* pk, const size_t pkstride, unsigned char* ss, const size_t ssstride)
+{ // Bob's shared secrets of the lanes
+#if defined(LANES_AVX512IFMA)
+    EphemeralSecretAgreement_B_x8(sk, skstride, pk, pkstride, ss, ssstride);
+#else
+    for (unsigned int i = 0; i < SIKE_LANES; i++) {
+        EphemeralSecretAgreement_B(sk + i*skstride, pk + i*pkstride, ss + i*ssstride);
+    }
+#endif
+}
+
+
+static unsigned int lanes_invalid_pk(const unsigned char* pk, const size_t stride)
+{ // Lanes whose public key, at pk + i*stride, has a GF(p) coordinate that is not in [0, p-1]
+    digit_t a[NWORDS_FIELD], t[NWORDS_FIELD];
+    unsigned int i, j, invalid = 0;
+
+    for (i = 0; i < SIKE_LANES; i++) {
+        for (j = 0; j < 6; j++) {
+            decode_to_digits(pk + i*stride + j*(FP2_ENCODED_BYTES / 2), a, FP2_ENCODED_BYTES / 2, NWORDS_FIELD);
+            if (mp_sub(a, (digit_t*)PRIME, t, NWORDS_FIELD) == 0) {        // No borrow: a >= p
+                invalid |= 1 << i;
+            }
+        }
+    }
+    return invalid;
+}
+
+
+static void lanes_clear(const unsigned int failed, unsigned char* out, const size_t stride, const size_t nbytes)
+{ // Zeroes the nbytes bytes at out + i*stride of the failed lanes
+    for (unsigned int i = 0; i < SIKE_LANES; i++) {
+        if (failed & (1 << i)) {
+            memset(out + i*stride, 0, nbytes);
+        }
+    }
+}
+
+
+static void shake256_lanes(unsigned char *out, const size_t outstride, const unsigned long long outlen, const unsigned char *in, const size_t instride, const unsigned long long inlen)
+{ // SHAKE256 of the SIKE_LANES inputs in + i*instride of inlen bytes into out + i*outstride, four lanes at a time
+    for (unsigned int i = 0; i < SIKE_LANES; i += 4) {
+        shake256x4(out + i*outstride, out + (i+1)*outstride, out + (i+2)*outstride, out + (i+3)*outstride, outlen, 
+                   in + i*instride, in + (i+1)*instride, in + (i+2)*instride, in + (i+3)*instride, inlen);
+    }
+}
+
+
+int crypto_kem_keypair_x8(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation for SIKE_LANES independent key pairs
+  // Outputs: secret keys sk (SIKE_LANES consecutive keys of CRYPTO_SECRETKEYBYTES bytes)
+  //          public keys pk (SIKE_LANES consecutive keys of CRYPTO_PUBLICKEYBYTES bytes)
+  // Returns 0, or the failed lanes (bit i for lane i)
+    unsigned char *sk_i;
+    unsigned int i, failed = 0;
+
+    // Generate lower portions of secret keys sk <- s||SK
+    for (i = 0; i < SIKE_LANES; i++) {
+        sk_i = sk + i*CRYPTO_SECRETKEYBYTES;
+        if (randombytes(sk_i, MSG_BYTES) != 0 || random_mod_order_B(sk_i + MSG_BYTES) != 0) {
+            failed |= 1 << i;
+        }
+    }
+#ifdef DO_VALGRIND_CHECK
+    for (i = 0; i < SIKE_LANES; i++) {
+        VALGRIND_MAKE_MEM_UNDEFINED(sk + i*CRYPTO_SECRETKEYBYTES, MSG_BYTES + SECRETKEY_B_BYTES);
+    }
+#endif
+
+    // Generate public keys pk and append them to the secret keys sk
+    keygen_B_lanes(sk + MSG_BYTES, CRYPTO_SECRETKEYBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+    for (i = 0; i < SIKE_LANES; i++) {
+        memcpy(sk + i*CRYPTO_SECRETKEYBYTES + MSG_BYTES + SECRETKEY_B_BYTES, pk + i*CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES);
+    }
+
+#ifdef DO_VALGRIND_CHECK
+    for (i = 0; i < SIKE_LANES; i++) {
+        VALGRIND_MAKE_MEM_DEFINED(sk + i*CRYPTO_SECRETKEYBYTES, MSG_BYTES + SECRETKEY_B_BYTES);
+    }
+#endif
+    lanes_clear(failed, sk, CRYPTO_SECRETKEYBYTES, CRYPTO_SECRETKEYBYTES);
+    lanes_clear(failed, pk, CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES);
+    return (int)failed;
+}
+
+
+int crypto_kem_enc_x8(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation for SIKE_LANES independent public keys
+  // Input:   public keys pk         (SIKE_LANES consecutive keys of CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: shared secrets ss      (SIKE_LANES consecutive secrets of CRYPTO_BYTES bytes)
+  //          ciphertext messages ct (SIKE_LANES consecutive ciphertexts of CRYPTO_CIPHERTEXTBYTES bytes)
+  // Returns 0, or the failed lanes (bit i for lane i)
+    unsigned char ephemeralsk[SIKE_LANES][SECRETKEY_A_BYTES];
+    unsigned char jinvariant[SIKE_LANES][FP2_ENCODED_BYTES];
+    unsigned char h[SIKE_LANES][MSG_BYTES];
+    unsigned char temp[SIKE_LANES][CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];     // m||pk, then m||ct
+    unsigned char *ct_i;
+    unsigned int i, j, failed = lanes_invalid_pk(pk, CRYPTO_PUBLICKEYBYTES);
+
+    // Generate ephemeralsk <- G(m||pk) mod oA
+    for (i = 0; i < SIKE_LANES; i++) {
+        if (randombytes(temp[i], MSG_BYTES) != 0) {
+            failed |= 1 << i;
+        }
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_UNDEFINED(temp[i], MSG_BYTES);
+#endif
+        memcpy(&temp[i][MSG_BYTES], pk + i*CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES);
+    }
+    shake256_lanes(ephemeralsk[0], SECRETKEY_A_BYTES, SECRETKEY_A_BYTES, temp[0], sizeof(temp[0]), CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    for (i = 0; i < SIKE_LANES; i++) {
+        ephemeralsk[i][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+    }
+
+    // Encrypt
+    keygen_A_lanes(ephemeralsk[0], SECRETKEY_A_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
+    agreement_A_lanes(ephemeralsk[0], SECRETKEY_A_BYTES, pk, CRYPTO_PUBLICKEYBYTES, jinvariant[0], FP2_ENCODED_BYTES);
+    shake256_lanes(h[0], MSG_BYTES, MSG_BYTES, jinvariant[0], FP2_ENCODED_BYTES, FP2_ENCODED_BYTES);
+    for (i = 0; i < SIKE_LANES; i++) {
+        ct_i = ct + i*CRYPTO_CIPHERTEXTBYTES;
+        for (j = 0; j < MSG_BYTES; j++) {
+            ct_i[j + CRYPTO_PUBLICKEYBYTES] = temp[i][j] ^ h[i][j];
+        }
+        memcpy(&temp[i][MSG_BYTES], ct_i, CRYPTO_CIPHERTEXTBYTES);
+    }
+
+    // Generate shared secrets ss <- H(m||ct)
+    shake256_lanes(ss, CRYPTO_BYTES, CRYPTO_BYTES, temp[0], sizeof(temp[0]), CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(temp, sizeof(temp));
+#endif
+    lanes_clear(failed, ct, CRYPTO_CIPHERTEXTBYTES, CRYPTO_CIPHERTEXTBYTES);
+    lanes_clear(failed, ss, CRYPTO_BYTES, CRYPTO_BYTES);
+    return (int)failed;
+}
+
+
+int crypto_kem_dec_x8(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation for SIKE_LANES independent ciphertexts
+  // Input:   secret keys sk         (SIKE_LANES consecutive keys of CRYPTO_SECRETKEYBYTES bytes)
+  //          ciphertext messages ct (SIKE_LANES consecutive ciphertexts of CRYPTO_CIPHERTEXTBYTES bytes)
+  // Outputs: shared secrets ss      (SIKE_LANES consecutive secrets of CRYPTO_BYTES bytes)
+    unsigned char ephemeralsk_[SIKE_LANES][SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[SIKE_LANES][FP2_ENCODED_BYTES];
+    unsigned char h_[SIKE_LANES][MSG_BYTES];
+    unsigned char c0_[SIKE_LANES][CRYPTO_PUBLICKEYBYTES];
+    unsigned char temp[SIKE_LANES][CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];     // m||pk, then m||ct
+    const unsigned char *ct_i, *sk_i;
+    unsigned int i, j;
+    int8_t selector;
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_UNDEFINED(sk, SIKE_LANES*CRYPTO_SECRETKEYBYTES);
+#endif
+
+    // Decrypt
+    agreement_B_lanes(sk + MSG_BYTES, CRYPTO_SECRETKEYBYTES, ct, CRYPTO_CIPHERTEXTBYTES, jinvariant_[0], FP2_ENCODED_BYTES);
+    shake256_lanes(h_[0], MSG_BYTES, MSG_BYTES, jinvariant_[0], FP2_ENCODED_BYTES, FP2_ENCODED_BYTES);
+    for (i = 0; i < SIKE_LANES; i++) {
+        ct_i = ct + i*CRYPTO_CIPHERTEXTBYTES;
+        sk_i = sk + i*CRYPTO_SECRETKEYBYTES;
+        for (j = 0; j < MSG_BYTES; j++) {
+            temp[i][j] = ct_i[j + CRYPTO_PUBLICKEYBYTES] ^ h_[i][j];
+        }
+        memcpy(&temp[i][MSG_BYTES], &sk_i[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+    }
+
+    // Generate ephemeralsk_ <- G(m||pk) mod oA
+    shake256_lanes(ephemeralsk_[0], SECRETKEY_A_BYTES, SECRETKEY_A_BYTES, temp[0], sizeof(temp[0]), CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    for (i = 0; i < SIKE_LANES; i++) {
+        ephemeralsk_[i][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+    }
+
+    // Generate shared secrets ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+    keygen_A_lanes(ephemeralsk_[0], SECRETKEY_A_BYTES, c0_[0], CRYPTO_PUBLICKEYBYTES);
+    for (i = 0; i < SIKE_LANES; i++) {
+        ct_i = ct + i*CRYPTO_CIPHERTEXTBYTES;
+        sk_i = sk + i*CRYPTO_SECRETKEYBYTES;
+        selector = ct_compare(c0_[i], ct_i, CRYPTO_PUBLICKEYBYTES);
+        ct_cmov(temp[i], sk_i, MSG_BYTES, selector);
+        memcpy(&temp[i][MSG_BYTES], ct_i, CRYPTO_CIPHERTEXTBYTES);
+    }
+    shake256_lanes(ss, CRYPTO_BYTES, CRYPTO_BYTES, temp[0], sizeof(temp[0]), CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(sk, SIKE_LANES*CRYPTO_SECRETKEYBYTES);
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,173 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables read from a table bundle
+*           With TABLE_BUNDLE, the tables in TABLE_BUNDLE_LIST are not compiled into the library. tables_load() maps a
+*           bundle file (see tables.h) read-only, so that its pages are shared by all the processes using the same file.
+*********************************************************************************************/
+
+#if (OS_TARGET != OS_NIX)
+    #error -- "TABLE_BUNDLE is only supported on Unix-like systems"
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "tables.h"
+
+#define TABLES_HUGEPAGE_BYTES   (2*1024*1024)
+#if defined(COMPRESS)
+    #define TABLES_COMPRESSED   1
+#else
+    #define TABLES_COMPRESSED   0
+#endif
+
+typedef struct {
+    const char* name;
+    const uint64_t** table;
+    uint64_t nwords;
+} table_slot_t;
+
+#define TABLE_POINTER(name, nwords)   static const uint64_t* name;
+#define TABLE_SLOT(name, nwords)      { #name, &name, nwords },
+
+TABLE_BUNDLE_LIST(TABLE_POINTER)
+static const table_slot_t table_slots[] = { TABLE_BUNDLE_LIST(TABLE_SLOT) { NULL, NULL, 0 } };
+
+static unsigned char* tables_base = NULL;  // Mapping of the current bundle
+static size_t tables_mapped = 0;
+
+
+void tables_unload(void)
+{ // Unmaps the current table bundle, the tables cannot be used until the next tables_load()
+    const table_slot_t* slot;
+
+    for (slot = table_slots; slot->name != NULL; slot++) {
+        *slot->table = NULL;
+    }
+    if (tables_base != NULL) {
+        munmap(tables_base, tables_mapped);
+        tables_base = NULL;
+        tables_mapped = 0;
+    }
+}
+
+
+static unsigned char* tables_map_hugetlb(int fd, size_t bytes, size_t* mapped)
+{ // Copies the bundle to private memory backed by explicit huge pages. Returns NULL if no huge page is available.
+#if defined(MAP_HUGETLB)
+    size_t length = (bytes + TABLES_HUGEPAGE_BYTES - 1) & ~(size_t)(TABLES_HUGEPAGE_BYTES - 1), done = 0;
+    unsigned char* base;
+    ssize_t n;
+
+    base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (base == MAP_FAILED) return NULL;
+    while (done < bytes) {
+        n = pread(fd, base + done, bytes - done, (off_t)done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += (size_t)n;
+    }
+    if (done < bytes || mprotect(base, length, PROT_READ) != 0) {
+        munmap(base, length);
+        return NULL;
+    }
+    *mapped = length;
+    return base;
+#else
+    (void)fd; (void)bytes; (void)mapped;
+    return NULL;
+#endif
+}
+
+
+static const tables_entry_t* tables_find(const unsigned char* base, size_t bytes, const table_slot_t* slot)
+{ // Returns the entry of the bundle that holds the table of the given slot, or NULL if the bundle has no valid entry for it
+    const tables_header_t* header = (const tables_header_t*)base;
+    const tables_entry_t* entry = (const tables_entry_t*)(base + sizeof(tables_header_t));
+    uint32_t i;
+
+    for (i = 0; i < header->count; i++) {
+        if (strncmp(entry[i].name, slot->name, TABLES_NAME_BYTES) == 0) {
+            if (entry[i].nwords != slot->nwords || (entry[i].offset % TABLES_ALIGN) != 0 || entry[i].offset > bytes ||
+                entry[i].nwords > (bytes - entry[i].offset) / sizeof(uint64_t)) {
+                return NULL;
+            }
+            return &entry[i];
+        }
+    }
+    return NULL;
+}
+
+
+static int tables_check(const unsigned char* base, size_t bytes)
+{ // Checks that the bundle was generated for this library and holds all the tables it needs
+    const tables_header_t* header = (const tables_header_t*)base;
+    const table_slot_t* slot;
+
+    if (memcmp(header->magic, TABLES_MAGIC, sizeof(header->magic)) != 0 || header->version != TABLES_VERSION ||
+        header->nbits_field != NBITS_FIELD || header->compressed != TABLES_COMPRESSED ||
+        header->count > (bytes - sizeof(tables_header_t)) / sizeof(tables_entry_t)) {
+        return -1;
+    }
+    for (slot = table_slots; slot->name != NULL; slot++) {
+        if (tables_find(base, bytes, slot) == NULL) return -1;
+    }
+    return 0;
+}
+
+
+int tables_load(const char* path, unsigned int flags)
+{ // Maps the table bundle at path and points the tables at it. Returns 0 on success, or -1 if the file cannot be mapped or
+  // was not generated for this library, in which case no table is available.
+  // With TABLES_HUGEPAGES the tables are copied to explicit huge pages if the system has some reserved, otherwise the mapping
+  // of the file is advised to use transparent huge pages. With TABLES_PREFAULT all the pages are mapped before returning.
+    const table_slot_t* slot;
+    unsigned char* base = NULL;
+    size_t bytes, mapped = 0;
+    struct stat st;
+    int fd, mflags = MAP_SHARED;
+
+    tables_unload();
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return -1;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(tables_header_t)) {
+        close(fd);
+        return -1;
+    }
+    bytes = (size_t)st.st_size;
+
+    if (flags & TABLES_HUGEPAGES) {
+        base = tables_map_hugetlb(fd, bytes, &mapped);
+    }
+    if (base == NULL) {
+#if defined(MAP_POPULATE)
+        if (flags & TABLES_PREFAULT) mflags |= MAP_POPULATE;
+#endif
+        base = mmap(NULL, bytes, PROT_READ, mflags, fd, 0);
+        if (base == MAP_FAILED) {
+            close(fd);
+            return -1;
+        }
+        mapped = bytes;
+#if defined(MADV_HUGEPAGE)
+        if (flags & TABLES_HUGEPAGES) madvise(base, bytes, MADV_HUGEPAGE);
+#endif
+        madvise(base, bytes, MADV_WILLNEED);
+    }
+    close(fd);
+
+    if (tables_check(base, bytes) != 0) {
+        munmap(base, mapped);
+        return -1;
+    }
+    for (slot = table_slots; slot->name != NULL; slot++) {
+        *slot->table = (const uint64_t*)(base + tables_find(base, bytes, slot)->offset);
+    }
+    tables_base = base;
+    tables_mapped = mapped;
+    return 0;
+}
@@ -0,0 +1,39 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: file format of the table bundles
+*********************************************************************************************/
+
+#ifndef TABLES_H
+#define TABLES_H
+
+#include <stdint.h>
+
+
+// A table bundle holds the tables listed in TABLE_BUNDLE_LIST of one library (P*.c or P*_compressed.c), as 64-bit words
+// in the byte order of the machine that uses it:
+//   header     tables_header_t
+//   entries    tables_entry_t[count], one per table
+//   data       the tables, each one starting at a multiple of TABLES_ALIGN bytes from the beginning of the file
+
+#define TABLES_MAGIC            "SIDHTBLS"
+#define TABLES_VERSION          1
+#define TABLES_ALIGN            64         // Cache line size
+#define TABLES_NAME_BYTES       32
+
+typedef struct {
+    char magic[8];                         // TABLES_MAGIC, without the terminating zero
+    uint32_t version;                      // TABLES_VERSION
+    uint32_t nbits_field;                  // NBITS_FIELD of the library
+    uint32_t compressed;                   // 1 for the libraries with key compression, 0 otherwise
+    uint32_t count;                        // Number of entries
+} tables_header_t;
+
+typedef struct {
+    char name[TABLES_NAME_BYTES];          // Name of the table, padded with zeros
+    uint64_t offset;                       // Offset of the table in bytes from the beginning of the file
+    uint64_t nwords;                       // Size of the table in 64-bit words
+} tables_entry_t;
+
+
+#endif
@@ -0,0 +1,213 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: persistent worker threads
+*           With _PARALLEL_, the isogeny engine, the key pair pools, the concurrent encapsulation and the
+*           discrete logarithms all run their jobs on one pool of threads that are started on first use
+*           and kept until sidh_workers_stop(). Otherwise, sidh_workers_stop() does nothing.
+*           The number of online processors, which caps the workers of each job, is read once.
+*********************************************************************************************/
+
+#if defined(_PARALLEL_)
+
+#include <pthread.h>
+#include <unistd.h>
+
+#define WORKERS_MAX     32                        // Largest number of threads of the pool
+
+typedef void (*worker_fn_t)(void* arg, unsigned int id, unsigned int nworkers);
+
+typedef struct {
+    worker_fn_t fn;
+    void* arg;
+    unsigned int nworkers;                        // Number of workers that took the job
+    unsigned int running;                         // Number of workers still running it, guarded by the pool mutex
+#if defined(SIDH_OPCOUNT)
+    uint64_t opcounters[OPC_COUNTERS];            // Operations counted by the workers, added to the caller's by workers_wait()
+#endif
+} worker_job_t;
+
+typedef struct worker worker_t;
+
+struct worker {
+    pthread_t thread;
+    pthread_cond_t wake;
+    worker_job_t* job;                            // Job to run, NULL when idle
+    unsigned int id;                              // Index of the worker within the job
+    worker_t* next;                               // Next idle worker
+};
+
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t finished;                      // Broadcast whenever a job is finished by its last worker
+    worker_t worker[WORKERS_MAX];
+    worker_t* idle;                               // Stack of idle workers
+    unsigned int nthreads;                        // Number of threads started
+    bool stop;
+} workers = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+static THREAD_LOCAL bool worker_thread = false;   // Set on the threads of the pool, which must not post jobs that wait for other workers
+static unsigned int workers_ncpus;                // Number of online processors, see workers_cpus()
+static pthread_once_t workers_ncpus_once = PTHREAD_ONCE_INIT;
+
+
+static void workers_ncpus_init(void)
+{
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    workers_ncpus = (ncpus > 1) ? (unsigned int)ncpus : 1;
+}
+
+
+static unsigned int workers_cpus(void)
+{ // Number of online processors, read once by the first caller since sysconf() reads it from /sys on every call
+
+    pthread_once(&workers_ncpus_once, workers_ncpus_init);
+    return workers_ncpus;
+}
+
+
+static void* worker_main(void* arg)
+{ // Worker thread: runs the jobs handed to it until the pool is stopped
+    worker_t* W = (worker_t*)arg;
+    worker_job_t* job;
+
+    worker_thread = true;
+    pthread_mutex_lock(&workers.mutex);
+    while (true) {
+        while (W->job == NULL && !workers.stop) {
+            pthread_cond_wait(&W->wake, &workers.mutex);
+        }
+        if ((job = W->job) == NULL) break;
+        pthread_mutex_unlock(&workers.mutex);
+#if defined(SIDH_OPCOUNT)
+        memset(opcounters, 0, sizeof(opcounters));
+#endif
+        job->fn(job->arg, W->id, job->nworkers);
+
+        pthread_mutex_lock(&workers.mutex);
+#if defined(SIDH_OPCOUNT)
+        for (unsigned int i = 0; i < OPC_COUNTERS; i++) {
+            job->opcounters[i] += opcounters[i];
+        }
+#endif
+        W->job = NULL;
+        W->next = workers.idle;
+        workers.idle = W;
+        if (--job->running == 0) {
+            pthread_cond_broadcast(&workers.finished);
+        }
+    }
+    pthread_mutex_unlock(&workers.mutex);
+    return NULL;
+}
+
+
+static unsigned int workers_post(worker_job_t* job, worker_fn_t fn, void* arg, unsigned int n)
+{ // Hands the job fn(arg, id, nworkers) to up to n idle workers, starting new threads as needed, and returns the number of
+  // workers nworkers that took it, with ids 0 to nworkers-1. The job must be waited for with workers_wait() if nworkers > 0.
+    worker_t* W;
+    unsigned int i;
+
+    job->fn = fn;
+    job->arg = arg;
+    job->nworkers = 0;
+    job->running = 0;
+#if defined(SIDH_OPCOUNT)
+    memset(job->opcounters, 0, sizeof(job->opcounters));
+#endif
+    if (n == 0 || worker_thread) return 0;
+
+    pthread_mutex_lock(&workers.mutex);
+    if (workers.stop) {
+        pthread_mutex_unlock(&workers.mutex);
+        return 0;
+    }
+    for (i = 0; i < n; i++) {
+        if (workers.idle != NULL) {
+            W = workers.idle;
+            workers.idle = W->next;
+        } else if (workers.nthreads < WORKERS_MAX) {
+            W = &workers.worker[workers.nthreads];
+            W->job = NULL;
+            if (pthread_cond_init(&W->wake, NULL) != 0) break;
+            if (pthread_create(&W->thread, NULL, worker_main, W) != 0) {
+                pthread_cond_destroy(&W->wake);
+                break;
+            }
+            workers.nthreads++;
+        } else {
+            break;
+        }
+        W->job = job;
+        W->id = i;
+        pthread_cond_signal(&W->wake);
+    }
+    job->nworkers = job->running = i;             // The workers only read nworkers once they reacquire the mutex
+    pthread_mutex_unlock(&workers.mutex);
+    return i;
+}
+
+
+static void workers_wait(worker_job_t* job)
+{ // Waits until all the workers of the job are done with it and adds the operations they counted to the caller's
+
+    if (job->nworkers == 0) return;
+    pthread_mutex_lock(&workers.mutex);
+    while (job->running != 0) {
+        pthread_cond_wait(&workers.finished, &workers.mutex);
+    }
+    pthread_mutex_unlock(&workers.mutex);
+#if defined(SIDH_OPCOUNT)
+    for (unsigned int i = 0; i < OPC_COUNTERS; i++) {
+        opcounters[i] += job->opcounters[i];
+    }
+#endif
+}
+
+
+int sidh_workers_stop(void)
+{ // Joins the workers if none of them runs a job, and returns -1 otherwise: a key pair pool keeps its workers until keypool_stop(). 
+  // The pool is started again by the next job.
+    unsigned int i, nthreads;
+
+    if (worker_thread) return -1;
+    pthread_mutex_lock(&workers.mutex);
+    if (workers.stop) {                           // Another thread is already stopping the pool
+        pthread_mutex_unlock(&workers.mutex);
+        return -1;
+    }
+    for (i = 0; i < workers.nthreads; i++) {
+        if (workers.worker[i].job != NULL) {
+            pthread_mutex_unlock(&workers.mutex);
+            return -1;
+        }
+    }
+    workers.stop = true;                          // No job can be posted from here on
+    nthreads = workers.nthreads;
+    for (i = 0; i < nthreads; i++) {
+        pthread_cond_signal(&workers.worker[i].wake);
+    }
+    pthread_mutex_unlock(&workers.mutex);
+
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(workers.worker[i].thread, NULL);
+        pthread_cond_destroy(&workers.worker[i].wake);
+    }
+
+    pthread_mutex_lock(&workers.mutex);
+    workers.idle = NULL;
+    workers.nthreads = 0;
+    workers.stop = false;
+    pthread_mutex_unlock(&workers.mutex);
+    return 0;
+}
+
+#else
+
+int sidh_workers_stop(void)
+{ // No workers without _PARALLEL_
+    return 0;
+}
+
+#endif
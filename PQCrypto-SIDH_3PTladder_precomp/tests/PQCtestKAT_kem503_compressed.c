@@ -36,6 +36,12 @@ main()
     unsigned char       pk[CRYPTO_PUBLICKEYBYTES], sk[CRYPTO_SECRETKEYBYTES], pk_rsp[CRYPTO_PUBLICKEYBYTES], sk_rsp[CRYPTO_SECRETKEYBYTES];
     int                 ret_val;
     
+#if defined(TABLE_BUNDLE)
+    if (tables_load_p503_compressed("lib503comp/p503_compressed.tables", TABLES_PREFAULT) != 0) {
+        printf("Couldn't load the table bundle <lib503comp/p503_compressed.tables>\n");
+        return KAT_FILE_OPEN_ERROR;
+    }
+#endif
     sprintf(fn_rsp, "KAT/PQCkemKAT_%d.rsp", CRYPTO_SECRETKEYBYTES);
     if ( (fp_rsp = fopen(fn_rsp, "r")) == NULL ) {
         printf("Couldn't open <%s> for read\n", fn_rsp);
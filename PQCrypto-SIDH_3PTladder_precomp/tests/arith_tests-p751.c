@@ -9,6 +9,7 @@
 #include "../src/internal.h"
 #include "test_extras.h"
 #include <stdio.h>
+#include <string.h>
 
 
 // Benchmark and test parameters  
@@ -22,12 +23,18 @@
     #define TEST_LOOPS            100  
 #endif
 
+#if defined(_DISPATCH_)
+static int fp_impl = FP_IMPL_AUTO;          // Field arithmetic kernels in use
+#endif
+
 
 bool fp_test()
 { // Tests for the field arithmetic
     bool OK = true;
     int n, passed;
     felm_t a, b, c, d, e, f, ma, mb, mc, md, me, mf;
+    dfelm_t aa, bb;
+    unsigned int i;
 
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
     printf("Testing field arithmetic over GF(p751): \n\n"); 
@@ -163,6 +170,17 @@ bool fp_test()
         fpzero751(a); to_mont(a, ma);
         fpsqr751_mont(ma, md);                                 // d = 0^2 
         if (compare_words(ma, md, NWORDS_FIELD)!=0) { passed=0; break; }
+
+        fprandom751_test(a);
+        mp_sqr(a, aa, NWORDS_FIELD);                           // aa = a^2 
+        mp_mul(a, a, bb, NWORDS_FIELD);                        // bb = a*a 
+        if (compare_words(aa, bb, 2*NWORDS_FIELD)!=0) { passed=0; break; }
+
+        for (i = 0; i < NWORDS_FIELD; i++) a[i] = (digit_t)(-1);
+        a[NWORDS_FIELD-1] >>= (NWORDS_FIELD*RADIX - NBITS_FIELD);
+        mp_sqr(a, aa, NWORDS_FIELD);                           // aa = (2^NBITS_FIELD-1)^2 
+        mp_mul(a, a, bb, NWORDS_FIELD);                        
+        if (compare_words(aa, bb, 2*NWORDS_FIELD)!=0) { passed=0; break; }
     }
     if (passed==1) printf("  GF(p) squaring tests............................................. PASSED");
     else { printf("  GF(p) squaring tests... FAILED"); printf("\n"); return false; }
@@ -301,6 +319,43 @@ bool fp2_test()
     else { printf("  GF(p^2) multiplication tests... FAILED"); printf("\n"); return false; }
     printf("\n");
 
+    // Sum and difference of products over GF(p751^2) with a single reduction
+    passed = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {    
+        fp2random751_test((digit_t*)a); fp2random751_test((digit_t*)b); fp2random751_test((digit_t*)c); fp2random751_test((digit_t*)d);  
+
+        to_fp2mont(a, ma); to_fp2mont(b, mb); to_fp2mont(c, mc); to_fp2mont(d, md); 
+        if (n == 0) {                                                                    // Largest inputs, 2*p-1
+            fp2zero751(e); e[0][0] = 1; fp2zero751(f);
+            mp_sub751_p2(f[0], e[0], ma[0]);
+            fp2copy751(ma, mb); fp2copy751(ma, mc); fp2copy751(ma, md);
+            fpcopy751(ma[0], ma[1]); fpcopy751(ma[0], mb[1]); fpcopy751(ma[0], mc[1]); fpcopy751(ma[0], md[1]);
+        }
+        fp2mul_add751_mont(ma, mb, mc, md, me);                                          // e = a*b+c*d
+        fp2mul751_mont(ma, mb, mf); fp2mul751_mont(mc, md, mb); fp2add751(mf, mb, mf);   // f = a*b+c*d
+        from_fp2mont(me, e);
+        from_fp2mont(mf, f);
+        if (compare_words((digit_t*)e, (digit_t*)f, 2*NWORDS_FIELD)!=0) { passed=0; break; }
+        
+        to_fp2mont(b, mb);
+        fp2mulsub751_mont(ma, mb, mc, md, me);                                           // e = a*b-c*d
+        fp2mul751_mont(ma, mb, mf); fp2mul751_mont(mc, md, mb); fp2sub751(mf, mb, mf);   // f = a*b-c*d
+        from_fp2mont(me, e);
+        from_fp2mont(mf, f);
+        if (compare_words((digit_t*)e, (digit_t*)f, 2*NWORDS_FIELD)!=0) { passed=0; break; }
+
+        fp2zero751(mb);
+        fp2mulsub751_mont(ma, mb, mc, md, me);                                           // e = 0-c*d
+        fp2mul751_mont(mc, md, mf); fp2neg751(mf);                                       // f = -c*d
+        from_fp2mont(me, e);
+        from_fp2mont(mf, f);
+        if (compare_words((digit_t*)e, (digit_t*)f, 2*NWORDS_FIELD)!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p^2) sum/difference of products tests ........................ PASSED");
+    else { printf("  GF(p^2) sum/difference of products tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+
     // Squaring over GF(p751^2)
     passed = 1;
     for (n=0; n<TEST_LOOPS; n++)
@@ -394,6 +449,58 @@ bool fp_run()
     printf("  GF(p) multiplication runs in .................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+#if defined(_DISPATCH_)
+    if (fp_impl == FP_IMPL_MULX) {
+        // GF(p) multiplication calling the assembly kernels directly, to measure the dispatch overhead
+        cycles = 0;
+        for (n=0; n<BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            mul751_asm(a, b, aa);
+            rdc751_asm(aa, c);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  GF(p) multiplication (direct call) runs in ...................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+        printf("\n");
+    }
+#endif
+
+    // GF(p) squaring using p751
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpsqr751_mont(a, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) squaring runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Multiprecision squaring and multiplication using p751
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        mp_sqr(a, aa, NWORDS_FIELD);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Integer squaring runs in ........................................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        mp_mul(a, a, aa, NWORDS_FIELD);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Integer multiplication runs in .................................. %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) reduction using p751
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -428,13 +535,13 @@ bool fp2_run()
 {
     bool OK = true;
     int n;
-    unsigned long long cycles, cycles1, cycles2;
-    f2elm_t a, b, c;
+    unsigned long long cycles, cycles_unfused, cycles1, cycles2;
+    f2elm_t a, b, c, d, e, f;
         
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
     printf("Benchmarking quadratic extension arithmetic over GF(p751^2): \n\n"); 
     
-    fp2random751_test((digit_t*)a); fp2random751_test((digit_t*)b); fp2random751_test((digit_t*)c);
+    fp2random751_test((digit_t*)a); fp2random751_test((digit_t*)b); fp2random751_test((digit_t*)c); fp2random751_test((digit_t*)d);
 
     // GF(p^2) addition
     cycles = 0;
@@ -472,6 +579,49 @@ bool fp2_run()
     printf("  GF(p^2) multiplication runs in .................................. %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // GF(p^2) sum of products with two multiplications and an addition, then with a single reduction. The two variants alternate, so
+    // that they are timed under the same conditions.
+    cycles = 0; cycles_unfused = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fp2mul751_mont(a, b, e);
+        fp2mul751_mont(c, d, f);
+        fp2add751(e, f, e);
+        cycles2 = cpucycles();
+        cycles_unfused = cycles_unfused+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        fp2mul_add751_mont(a, b, c, d, e);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p^2) a*b+c*d with 2 multiplications runs in .................. %7lld ", cycles_unfused/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  GF(p^2) sum of products (a*b+c*d) runs in ....................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // GF(p^2) difference of products with two multiplications and a subtraction, then with a single reduction
+    cycles = 0; cycles_unfused = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fp2mul751_mont(a, b, e);
+        fp2mul751_mont(c, d, f);
+        fp2sub751(e, f, e);
+        cycles2 = cpucycles();
+        cycles_unfused = cycles_unfused+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        fp2mulsub751_mont(a, b, c, d, e);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p^2) a*b-c*d with 2 multiplications runs in .................. %7lld ", cycles_unfused/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  GF(p^2) difference of products (a*b-c*d) runs in ................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p^2) squaring
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -500,13 +650,77 @@ bool fp2_run()
 }
 
 
+// The formulas of ec_isogeny.c that use the single-reduction products, written with the exported GF(p^2) functions. With fused = false,
+// a*b-c*d or a*b+c*d is computed as before with two fp2mul_mont and a subtraction or an addition. Both variants run the same other
+// operations, so their difference is the gain of the lazy reduction in the formula.
+
+static void xTPL_products(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const bool fused)
+{ // Point tripling of xTPL()
+    f2elm_t t0, t1, t2, t3, t4, t5, t6;
+                                    
+    fp2sub751(P->X, P->Z, t0);                     // t0 = X-Z 
+    fp2sqr751_mont(t0, t2);                        // t2 = (X-Z)^2           
+    fp2add751(P->X, P->Z, t1);                     // t1 = X+Z 
+    fp2sqr751_mont(t1, t3);                        // t3 = (X+Z)^2
+    fp2add751(P->X, P->X, t4);                     // t4 = 2*X
+    fp2add751(P->Z, P->Z, t0);                     // t0 = 2*Z 
+    fp2sqr751_mont(t4, t1);                        // t1 = 4*X^2
+    fp2sub751(t1, t3, t1);                         // t1 = 4*X^2 - (X+Z)^2 
+    fp2sub751(t1, t2, t1);                         // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
+    fp2mul751_mont(A24plus, t3, t5);               // t5 = A24plus*(X+Z)^2 
+    fp2mul751_mont(A24minus, t2, t6);              // t6 = A24minus*(X-Z)^2
+    if (fused) {
+        fp2mulsub751_mont(t2, t6, t3, t5, t3);     // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    } else {
+        fp2mul751_mont(t3, t5, t3);                // t3 = A24plus*(X+Z)^4
+        fp2mul751_mont(t2, t6, t2);                // t2 = A24minus*(X-Z)^4
+        fp2sub751(t2, t3, t3);                     // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    }
+    fp2sub751(t5, t6, t2);                         // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
+    fp2mul751_mont(t1, t2, t1);                    // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+    fp2add751(t3, t1, t2);
+    fp2sqr751_mont(t2, t2);
+    fp2mul751_mont(t4, t2, Q->X);                  // X3 = 2*X*t2
+    fp2sub751(t3, t1, t1);
+    fp2sqr751_mont(t1, t1);
+    fp2mul751_mont(t0, t1, Q->Z);                  // Z3 = 2*Z*t1
+}
+
+
+static void eval_dual_4_isog_products(const f2elm_t A24, const f2elm_t C24, const f2elm_t* coeff, point_proj_t P, const bool fused)
+{ // Evaluation of the dual 4-isogenies of the compressed key generation, see eval_dual_4_isog() in ec_isogeny.c
+    f2elm_t t0, t1, t2, t3;
+
+    fp2add751(P->X, P->Z, t0);
+    fp2sub751(P->X, P->Z, t1);
+    fp2sqr751_mont(t0, t0);
+    fp2sqr751_mont(t1, t1);
+    fp2sub751(t0, t1, t2);
+    fp2sub751(C24, A24, t3);
+    fp2mul751_mont(t2, t3, t3);
+    fp2mul751_mont(C24, t0, t2);
+    fp2sub751(t2, t3, t2);
+    fp2mul751_mont(t2, t0, P->X);
+    fp2mul751_mont(t3, t1, P->Z);
+    if (fused) {
+        fp2mul_add751_mont(coeff[0], P->X, coeff[1], P->Z, P->X);
+    } else {
+        fp2mul751_mont(coeff[0], P->X, P->X);
+        fp2mul751_mont(coeff[1], P->Z, t0);
+        fp2add751(P->X, t0, P->X);
+    }
+    fp2mul751_mont(coeff[2], P->Z, P->Z);
+}
+
+
 bool ecisog_run()
 {
     bool OK = true;
     int n;
-    unsigned long long cycles, cycles1, cycles2;
+    unsigned long long cycles, cycles_unfused, cycles1, cycles2;
     f2elm_t A24, C24, A4, A, C, coeff[5];
-    point_proj_t P, Q;
+    point_proj_t P, Q, R[2];
+    unsigned int i;
         
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
     printf("Benchmarking elliptic curve and isogeny functions: \n\n"); 
@@ -567,6 +781,77 @@ bool ecisog_run()
     printf("  Point tripling runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // Point tripling before and after the single-reduction a*b-c*d, checked against xTPL()
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A4); fp2random751_test((digit_t*)C); fp2random751_test((digit_t*)P->X); fp2random751_test((digit_t*)P->Z);
+
+        xTPL(P, Q, A4, C);
+        xTPL_products(P, R[0], A4, C, false);
+        xTPL_products(P, R[1], A4, C, true);
+        fp2correction751(Q->X); fp2correction751(Q->Z);
+        for (i = 0; i < 2; i++) {
+            fp2correction751(R[i]->X); fp2correction751(R[i]->Z);
+            if (compare_words((digit_t*)Q, (digit_t*)R[i], 4*NWORDS_FIELD)!=0) OK = false;
+        }
+    }
+
+    // Point tripling with A24minus*(X-Z)^4 - A24plus*(X+Z)^4 computed with two multiplications, then with fp2mulsub_mont
+    cycles = 0; cycles_unfused = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A4); fp2random751_test((digit_t*)C);
+
+        cycles1 = cpucycles(); 
+        xTPL_products(P, Q, A4, C, false);
+        cycles2 = cpucycles();
+        cycles_unfused = cycles_unfused+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        xTPL_products(P, Q, A4, C, true);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Point tripling, a*b-c*d unfused runs in ......................... %7lld ", cycles_unfused/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Point tripling, a*b-c*d fused runs in ........................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Dual 4-isogeny evaluation before and after the single-reduction a*b+c*d
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A); fp2random751_test((digit_t*)C); fp2random751_test((digit_t*)P->X); fp2random751_test((digit_t*)P->Z);
+        fp2random751_test((digit_t*)coeff[0]); fp2random751_test((digit_t*)coeff[1]); fp2random751_test((digit_t*)coeff[2]);
+
+        for (i = 0; i < 2; i++) {
+            fp2copy751(P->X, R[i]->X); fp2copy751(P->Z, R[i]->Z);
+            eval_dual_4_isog_products(A, C, (const f2elm_t*)coeff, R[i], (i == 1));
+            fp2correction751(R[i]->X); fp2correction751(R[i]->Z);
+        }
+        if (compare_words((digit_t*)R[0], (digit_t*)R[1], 4*NWORDS_FIELD)!=0) OK = false;
+    }
+
+    // Dual 4-isogeny evaluation with coeff[0]*X + coeff[1]*Z computed with two multiplications, then with fp2mul_add_mont
+    cycles = 0; cycles_unfused = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A); fp2random751_test((digit_t*)C);
+
+        cycles1 = cpucycles(); 
+        eval_dual_4_isog_products(A, C, (const f2elm_t*)coeff, Q, false);
+        cycles2 = cpucycles();
+        cycles_unfused = cycles_unfused+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        eval_dual_4_isog_products(A, C, (const f2elm_t*)coeff, Q, true);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Dual 4-isogeny evaluation, a*b+c*d unfused runs in .............. %7lld ", cycles_unfused/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Dual 4-isogeny evaluation, a*b+c*d fused runs in ................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // 3-isogeny of a projective point
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -597,10 +882,21 @@ bool ecisog_run()
 }
 
 
-int main()
+int main(int argc, char* argv[])
 {
     bool OK = true;
 
+#if defined(_DISPATCH_)
+    int impl = FP_IMPL_AUTO;
+
+    if (argc == 3 && strcmp(argv[1], "-impl") == 0) {      // Force the field arithmetic kernels: -impl [base/mulx]
+        if (strcmp(argv[2], "base") == 0) impl = FP_IMPL_BASE;
+        else if (strcmp(argv[2], "mulx") == 0) impl = FP_IMPL_MULX;
+    }
+    fp_impl = fp_select_impl(impl);
+    printf("\nField arithmetic kernels: %s\n", (fp_impl == FP_IMPL_MULX) ? "MULX/ADX assembly" : "portable C");
+#endif
+
     OK = OK && fp_test();          // Test field operations using p751
     OK = OK && fp_run();           // Benchmark field operations using p751
 
@@ -0,0 +1,18 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: per-stage cycle breakdown of SIDHp434 and SIKEp434
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#define BENCH_STAGES
+#include "../src/P434/P434.c"
+
+
+#define SIDH_NAME      "SIDHp434"
+#define SIKE_NAME      "SIKEp434"
+#define TABLES_FILE    "lib434/p434.tables"
+
+#include "bench_stages.c"
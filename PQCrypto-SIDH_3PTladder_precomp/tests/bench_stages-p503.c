@@ -0,0 +1,18 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: per-stage cycle breakdown of SIDHp503 and SIKEp503
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#define BENCH_STAGES
+#include "../src/P503/P503.c"
+
+
+#define SIDH_NAME      "SIDHp503"
+#define SIKE_NAME      "SIKEp503"
+#define TABLES_FILE    "lib503/p503.tables"
+
+#include "bench_stages.c"
@@ -0,0 +1,18 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: per-stage cycle breakdown of SIDHp610 and SIKEp610
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#define BENCH_STAGES
+#include "../src/P610/P610.c"
+
+
+#define SIDH_NAME      "SIDHp610"
+#define SIKE_NAME      "SIKEp610"
+#define TABLES_FILE    "lib610/p610.tables"
+
+#include "bench_stages.c"
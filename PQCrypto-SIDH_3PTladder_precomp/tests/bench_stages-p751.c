@@ -0,0 +1,18 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: per-stage cycle breakdown of SIDHp751 and SIKEp751
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#define BENCH_STAGES
+#include "../src/P751/P751.c"
+
+
+#define SIDH_NAME      "SIDHp751"
+#define SIKE_NAME      "SIKEp751"
+#define TABLES_FILE    "lib751/p751.tables"
+
+#include "bench_stages.c"
@@ -0,0 +1,146 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: per-stage cycle breakdown of SIDH and SIKE with both key generation engines
+*           The library sources are included with BENCH_STAGES, which makes the operations stamp
+*           the end of each stage (see STAGE() in src/sidh.c). Every operation is run BENCH_LOOPS
+*           times and the cycles of each stage are reported as median and 90th/99th percentiles.
+*
+*           Usage: bench_stages-pXXX
+*********************************************************************************************/
+
+#include <stdlib.h>
+
+
+#if defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define BENCH_LOOPS        10      // Number of runs per operation
+#else
+    #define BENCH_LOOPS       200
+#endif
+
+#define STAGE_TOTAL    STAGES          // Index of the whole operation in the measurements
+
+static const char* stage_names[STAGES] = { "other", "ladder", "RecoverY/plus", "isogeny tree", "inv_3_way", "encoding", "decoding/get_A", "j_inv", "SHAKE" };
+
+static int64_t stage_last;
+static unsigned long long stage_cycles[STAGES];
+static unsigned long long cycles[STAGES+1][BENCH_LOOPS];
+
+
+static void bench_stage(const unsigned int stage)
+{ // End of a stage: the cycles since the previous stamp are added to stage
+    int64_t now = cpucycles();
+
+    stage_cycles[stage] += (unsigned long long)(now - stage_last);
+    stage_last = now;
+}
+
+
+static void run_start(void)
+{
+    memset(stage_cycles, 0, sizeof(stage_cycles));
+    stage_last = cpucycles();
+}
+
+
+static void run_stop(unsigned int n, int64_t start)
+{ // Stores the measurements of run n, the cycles after the last stamp of the operation go to STAGE_OTHER
+    unsigned int s;
+
+    bench_stage(STAGE_OTHER);
+    for (s = 0; s < STAGES; s++) {
+        cycles[s][n] = stage_cycles[s];
+    }
+    cycles[STAGE_TOTAL][n] = (unsigned long long)(stage_last - start);
+}
+
+
+static int cmp_cycles(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a, y = *(const unsigned long long*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static unsigned long long percentile(const unsigned long long* sorted, unsigned int p)
+{ // p-th percentile of BENCH_LOOPS sorted measurements
+    return sorted[(p*(BENCH_LOOPS-1) + 50)/100];
+}
+
+
+static void report(const char* operation)
+{ // Prints the median and the 90th/99th percentiles of each stage that was reached
+    unsigned int s;
+    unsigned long long* c;
+
+    printf("\n  %s\n    %-16s %12s %12s %12s\n", operation, "", "median", "90%", "99%");
+    for (s = 0; s <= STAGE_TOTAL; s++) {
+        c = cycles[s];
+        qsort(c, BENCH_LOOPS, sizeof(unsigned long long), cmp_cycles);
+        if (s != STAGE_TOTAL && c[BENCH_LOOPS-1] == 0) continue;
+        printf("    %-16s %12llu %12llu %12llu\n", (s == STAGE_TOTAL) ? "total" : stage_names[s], percentile(c, 50), percentile(c, 90), percentile(c, 99));
+    }
+}
+
+
+#define BENCH_OP(operation, call)                          \
+    do {                                                   \
+        unsigned int n;                                    \
+        int64_t start;                                     \
+        for (n = 0; n < BENCH_LOOPS; n++) {                \
+            start = cpucycles();                           \
+            run_start();                                   \
+            call;                                          \
+            run_stop(n, start);                            \
+        }                                                  \
+        report(operation);                                 \
+    } while (0)
+
+
+int main()
+{
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0}, pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0}, ss[CRYPTO_BYTES] = {0};
+    const unsigned int ladders[2] = { SIDH_LADDER_3PT, SIDH_LADDER_MONTGOMERY };
+    unsigned int i;
+
+#if defined(TABLE_BUNDLE)
+    if (tables_load(TABLES_FILE, TABLES_PREFAULT) != 0) {
+        printf("\n\n   Error detected: cannot load the table bundle %s \n\n", TABLES_FILE);
+        return FAILED;
+    }
+#endif
+
+    printf("\n\nBENCHMARKING THE STAGES OF %s AND %s\n", SIDH_NAME, SIKE_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n");
+    printf("\n  %d runs per operation, in ", BENCH_LOOPS); print_unit;
+    printf(": median, 90th and 99th percentile\n");
+
+    sidh_set_ladder(SIDH_LADDER_3PT);
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+    EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+
+    BENCH_OP("Alice's shared key (both engines)", EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA));
+    BENCH_OP("Bob's shared key (both engines)", EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA, SharedSecretB));
+
+    for (i = 0; i < 2; i++) {
+        sidh_set_ladder(ladders[i]);
+        printf("\n\n  KEY GENERATION ENGINE: %s\n", (ladders[i] == SIDH_LADDER_MONTGOMERY) ? "Montgomery ladder" : "3-point ladder");
+
+        BENCH_OP("Alice's key generation", EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA));
+        BENCH_OP("Bob's key generation", EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB));
+        BENCH_OP("SIKE key generation", crypto_kem_keypair(pk, sk));
+        BENCH_OP("SIKE encapsulation", crypto_kem_enc(ct, ss, pk));
+        BENCH_OP("SIKE decapsulation", crypto_kem_dec(ss, ct, sk));
+    }
+    sidh_set_ladder(SIDH_LADDER_3PT);
+    printf("\n");
+
+    return PASSED;
+}
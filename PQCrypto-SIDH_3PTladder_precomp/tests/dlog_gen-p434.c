@@ -0,0 +1,33 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the Pohlig-Hellman tables of SIDHp434_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P434/P434_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp434_compressed"
+
+#define fpcopy                        fpcopy434
+#define fpzero                        fpzero434
+#define fpadd                         fpadd434
+#define fpsub                         fpsub434
+#define fpneg                         fpneg434
+#define fpcorrection                  fpcorrection434
+#define fpmul_mont                    fpmul434_mont
+#define fpinv_mont                    fpinv434_mont
+#define fp2copy                       fp2copy434
+#define fp2sub                        fp2sub434
+#define fp2correction                 fp2correction434
+#define fp2mul_mont                   fp2mul434_mont
+#define fp2sqr_mont                   fp2sqr434_mont
+#define fp2inv_mont                   fp2inv434_mont
+#define random_mod_order_A            random_mod_order_A_SIDHp434
+#define random_mod_order_B            random_mod_order_B_SIDHp434
+
+#include "../src/internal.h"
+#include "dlog_gen.c"
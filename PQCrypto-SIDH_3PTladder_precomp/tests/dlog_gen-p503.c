@@ -0,0 +1,33 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the Pohlig-Hellman tables of SIDHp503_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P503/P503_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp503_compressed"
+
+#define fpcopy                        fpcopy503
+#define fpzero                        fpzero503
+#define fpadd                         fpadd503
+#define fpsub                         fpsub503
+#define fpneg                         fpneg503
+#define fpcorrection                  fpcorrection503
+#define fpmul_mont                    fpmul503_mont
+#define fpinv_mont                    fpinv503_mont
+#define fp2copy                       fp2copy503
+#define fp2sub                        fp2sub503
+#define fp2correction                 fp2correction503
+#define fp2mul_mont                   fp2mul503_mont
+#define fp2sqr_mont                   fp2sqr503_mont
+#define fp2inv_mont                   fp2inv503_mont
+#define random_mod_order_A            random_mod_order_A_SIDHp503
+#define random_mod_order_B            random_mod_order_B_SIDHp503
+
+#include "../src/internal.h"
+#include "dlog_gen.c"
@@ -0,0 +1,33 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the Pohlig-Hellman tables of SIDHp610_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P610/P610_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp610_compressed"
+
+#define fpcopy                        fpcopy610
+#define fpzero                        fpzero610
+#define fpadd                         fpadd610
+#define fpsub                         fpsub610
+#define fpneg                         fpneg610
+#define fpcorrection                  fpcorrection610
+#define fpmul_mont                    fpmul610_mont
+#define fpinv_mont                    fpinv610_mont
+#define fp2copy                       fp2copy610
+#define fp2sub                        fp2sub610
+#define fp2correction                 fp2correction610
+#define fp2mul_mont                   fp2mul610_mont
+#define fp2sqr_mont                   fp2sqr610_mont
+#define fp2inv_mont                   fp2inv610_mont
+#define random_mod_order_A            random_mod_order_A_SIDHp610
+#define random_mod_order_B            random_mod_order_B_SIDHp610
+
+#include "../src/internal.h"
+#include "dlog_gen.c"
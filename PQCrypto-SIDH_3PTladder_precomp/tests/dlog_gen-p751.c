@@ -0,0 +1,33 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the Pohlig-Hellman tables of SIDHp751_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P751/P751_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp751_compressed"
+
+#define fpcopy                        fpcopy751
+#define fpzero                        fpzero751
+#define fpadd                         fpadd751
+#define fpsub                         fpsub751
+#define fpneg                         fpneg751
+#define fpcorrection                  fpcorrection751
+#define fpmul_mont                    fpmul751_mont
+#define fpinv_mont                    fpinv751_mont
+#define fp2copy                       fp2copy751
+#define fp2sub                        fp2sub751
+#define fp2correction                 fp2correction751
+#define fp2mul_mont                   fp2mul751_mont
+#define fp2sqr_mont                   fp2sqr751_mont
+#define fp2inv_mont                   fp2inv751_mont
+#define random_mod_order_A            random_mod_order_A_SIDHp751
+#define random_mod_order_B            random_mod_order_B_SIDHp751
+
+#include "../src/internal.h"
+#include "dlog_gen.c"
@@ -0,0 +1,750 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the Pohlig-Hellman tables of the compressed variants
+*           The discrete logs are taken in base g2 and g3, the reduced Tate pairings of the fixed bases A_basis_zero
+*           and B_basis_zero computed by the library's Tate2_pairings and Tate3_pairings (with the points P+Q and 2P+Q).
+*           For windows of w2 and w3 digits, with g = 1/g2, rho = g^(2^(eA-w2)) of order 2^w2 and the torus coordinate
+*           alpha(a) = (a0+1)/a1 of dlog.c (a = [alpha:1]):
+*              ph2_CT[j][D-1] = alpha(g^(D*2^(w2*j))) for j = 0..DLEN_2-1 and D = 1..2^(w2-1), the last row is never read
+*              ph2_G = { alpha(rho^(-2^(w2-2))), alpha(rho^(-2^(w2-2-m)*(1+4*rev(i)))) for m = 1..w2-2 and i = 0..2^(m-1)-1 }
+*                 where rev(i) reverses the m-1 bits of i
+*              ph2_Texp[2^k-1+m] = 1/a1(e(k,m)) for the leaves of order 2^(w2-1) handled by ord2w_dlog(), which rebuild
+*                 alpha(h) = +/-(1 +/- 1/a1(h^(2^(j-2))) +/- ... +/- 1/a1(h)): e(0,0) is a square root of i = [1:1] and
+*                 e(k,m) a square root of e(k-1,m/2), negated if m is odd
+*              ph2_Log[n] = the digit of the leaf that ord2w_dlog() finds at position n, found by running it on all of them
+*              ph3_T[j][t-1] = ph3_T1[j][t-1] = g3^(-t*3^(w3*j)) for j = 0..DLEN_3-1 and t = 1..(3^w3-1)/2
+*              ph3_T2[j][t-1] = g3^(-t*3^(w3*j-w3+(eB mod w3))) for j >= 1 and row 0 as ph3_T1, when w3 does not divide eB
+*           ph2_path and ph3_path are optimal strategies for the traversal of the tree of digits, where moving left over
+*           a digit costs w squarings (or cubings) and moving right one multiplication per digit found. The relative
+*           costs PH2_SQR_COST:PH2_MUL_COST and PH3_CUBE_COST:PH3_MUL_COST reproduce the shipped paths.
+*
+*           Any square root gives ph2_Texp tables that work with the matching ph2_Log, and the shipped ones use other
+*           roots for some entries: -c checks ph2_Texp and ph2_Log as a pair, on all the leaves, and the rest of the
+*           tables word for word.
+*
+*           Usage: dlog_gen-pXXX [-c | -b | -w <w2> <w3>]
+*              -c:      compare the generated tables with the ones compiled into the library and solve random logs
+*              -b:      print the table sizes and the cycles of the discrete logs with the compiled tables
+*              -w:      print PXXX_compressed_dlog_tables.c for windows w2 (4 to PH2_WMAX, dividing eA) and w3
+*                       (1 to PH3_WMAX)
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define PH2_WMAX           10           // Largest windows accepted by -w
+#define PH3_WMAX            6
+#define PH2_SQR_COST        2           // Relative costs of the steps of the traversals
+#define PH2_MUL_COST        3
+#define PH3_CUBE_COST       1
+#define PH3_MUL_COST        1
+#define DLOG_CHECKS        16           // Random logs solved by -c
+#if defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define DLOG_BENCH     10           // Logs timed by -b
+#else
+    #define DLOG_BENCH    200
+#endif
+
+#define FELM_BYTES         NBITS_TO_NBYTES(NBITS_FIELD)
+#define FELM_BYTES64       (NWORDS64_FIELD * 8)
+
+extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+extern const uint64_t A_basis_zero[8*NWORDS64_FIELD];
+extern const uint64_t B_basis_zero[8*NWORDS64_FIELD];
+extern const unsigned int ph2_path[PLEN_2];
+extern const unsigned int ph3_path[PLEN_3];
+extern const uint64_t ph2_Texp[((1<<(W_2_1-2))-1)*NWORDS64_FIELD];
+extern const int ph2_Log[(1<<(W_2_1))-1];
+extern const uint64_t ph2_G[(1<<(W_2-2))*NWORDS64_FIELD];
+extern const uint64_t ph2_CT[DLEN_2*(ELL2_W >> 1)*NWORDS64_FIELD];
+#if (OBOB_EXPON % W_3 == 0)
+extern const uint64_t ph3_T[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD];
+#else
+extern const uint64_t ph3_T1[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD];
+extern const uint64_t ph3_T2[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD];
+#endif
+
+void sqr_Fp2_cycl(f2elm_t a, const felm_t one);
+void cube_Fp2_cycl(f2elm_t a, const felm_t one);
+void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2elm_t* f);
+void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f);
+int ord2w_dlog(const felm_t *r, const int *logT, const felm_t *Texp);
+void solve_dlog(const f2elm_t r, int *D, digit_t* d, int ell);
+void random_mod_order_A(unsigned char* random_digits);
+int random_mod_order_B(unsigned char* random_digits);
+
+typedef struct {
+    unsigned int w, dlen, half;          // Window, number of digits and entries per row (2^(w-1), or (3^w-1)/2 for ell = 3)
+    unsigned int* path;                  // dlen+1 entries
+    felm_t* CT;                          // ell = 2: dlen*half elements of GF(p)
+    felm_t* Texp;                        // 2^(w-3)-1 elements
+    int* Log;                            // 2^(w-1)-1 digits
+    felm_t* G;                           // 2^(w-2) elements
+    f2elm_t* T1;                         // ell = 3: dlen*half elements of GF(p^2)
+    f2elm_t* T2;                         // Only when w does not divide eB
+} ph_tables_t;
+
+static f2elm_t g2, g3;                   // Bases of the logs
+
+
+static bool fpequal(const felm_t a, const felm_t b)
+{ // Non constant-time comparison of two GF(p) elements
+    felm_t t0, t1;
+
+    fpcopy(a, t0);
+    fpcopy(b, t1);
+    fpcorrection(t0);
+    fpcorrection(t1);
+    return (memcmp(t0, t1, FELM_BYTES) == 0);
+}
+
+
+static bool fpiszero(const felm_t a)
+{
+    felm_t zero = {0};
+
+    return fpequal(a, zero);
+}
+
+
+static void fp2one(f2elm_t a)
+{
+    fpcopy((digit_t*)&Montgomery_one, a[0]);
+    fpzero(a[1]);
+}
+
+
+static void fp2conj(const f2elm_t a, f2elm_t c)
+{ // c = a^p, which is 1/a for a of norm 1
+    fp2copy(a, c);
+    fpneg(c[1]);
+}
+
+
+static void cycl_pow(const f2elm_t a, const int k, f2elm_t c)
+{ // c = a^k for small k and a of norm 1
+    f2elm_t t;
+    int i;
+
+    fp2one(c);
+    if (k < 0) {
+        fp2conj(a, t);
+    } else {
+        fp2copy(a, t);
+    }
+    for (i = 0; i < abs(k); i++) {
+        fp2mul_mont(c, t, c);
+    }
+}
+
+
+static void cycl_pow_ell(const f2elm_t a, const unsigned int ell, const unsigned int e, f2elm_t c)
+{ // c = a^(ell^e) for ell = 2 or 3 and a of norm 1
+    unsigned int i;
+
+    fp2copy(a, c);
+    for (i = 0; i < e; i++) {
+        if (ell == 2) {
+            sqr_Fp2_cycl(c, (digit_t*)&Montgomery_one);
+        } else {
+            cube_Fp2_cycl(c, (digit_t*)&Montgomery_one);
+        }
+    }
+}
+
+
+static void cycl_exp(const f2elm_t a, const digit_t* k, const unsigned int nbits, f2elm_t c)
+{ // c = a^k for a of norm 1, left-to-right over the nbits bits of k
+    int i;
+
+    fp2one(c);
+    for (i = (int)nbits-1; i >= 0; i--) {
+        sqr_Fp2_cycl(c, (digit_t*)&Montgomery_one);
+        if ((k[i/RADIX] >> (i%RADIX)) & 1) {
+            fp2mul_mont(c, a, c);
+        }
+    }
+}
+
+
+static void torus_alpha(const f2elm_t a, felm_t alpha)
+{ // alpha = (a0+1)/a1, so that a = [alpha:1] in the representation of dlog.c
+    felm_t t;
+
+    fpadd(a[0], (digit_t*)&Montgomery_one, alpha);
+    fpcopy(a[1], t);
+    fpinv_mont(t);
+    fpmul_mont(alpha, t, alpha);
+    fpcorrection(alpha);
+}
+
+
+static void torus_proj(const f2elm_t a, felm_t* r)
+{ // r = [x:y] = [alpha(a):1], or [1:0] for a = 1 and [0:1] for a = -1, which toproj() does not handle
+    felm_t one;
+
+    fpcopy((digit_t*)&Montgomery_one, one);
+    if (fpiszero(a[1])) {
+        fpzero(r[0]);
+        fpzero(r[1]);
+        fpcopy(one, fpequal(a[0], one) ? r[0] : r[1]);
+    } else {
+        torus_alpha(a, r[0]);
+        fpcopy(one, r[1]);
+    }
+}
+
+
+static unsigned int reverse(unsigned int i, const unsigned int nbits)
+{ // Reverses the nbits bits of i
+    unsigned int r = 0, j;
+
+    for (j = 0; j < nbits; j++) {
+        r = (r << 1) | ((i >> j) & 1);
+    }
+    return r;
+}
+
+
+static void load_point(const uint64_t* xy, point_full_proj_t P)
+{ // P = (x, y, 1) from the affine coordinates xy
+    fpcopy((digit_t*)xy + 0*NWORDS_FIELD, P->X[0]);
+    fpcopy((digit_t*)xy + 1*NWORDS_FIELD, P->X[1]);
+    fpcopy((digit_t*)xy + 2*NWORDS_FIELD, P->Y[0]);
+    fpcopy((digit_t*)xy + 3*NWORDS_FIELD, P->Y[1]);
+    fp2one(P->Z);
+}
+
+
+static void point_add(const point_full_proj_t P, const point_full_proj_t Q, point_full_proj_t R)
+{ // Affine addition R = P+Q of points with Z = 1 on a curve y^2 = x^3+a*x+b, for P != +/-Q
+    f2elm_t l, t, x;
+
+    fp2sub(Q->Y, P->Y, l);
+    fp2sub(Q->X, P->X, t);
+    fp2inv_mont(t);
+    fp2mul_mont(l, t, l);
+    fp2sqr_mont(l, x);
+    fp2sub(x, P->X, x);
+    fp2sub(x, Q->X, x);
+    fp2sub(P->X, x, t);
+    fp2mul_mont(l, t, t);
+    fp2sub(t, P->Y, R->Y);
+    fp2copy(x, R->X);
+    fp2correction(R->X);
+    fp2correction(R->Y);
+    fp2one(R->Z);
+}
+
+
+static void gen_bases(void)
+{ // g2 = e2(PA, QA) and g3 = e3(PB, QB), as computed for the public keys. Both have discrete log 1
+    point_full_proj_t P, Q, Qj[2];
+    point_t P2, Q2;
+    f2elm_t f[4];
+
+    load_point(A_basis_zero, P);
+    load_point(A_basis_zero + 4*NWORDS64_FIELD, Q);
+    point_add(P, Q, Qj[0]);
+    point_add(P, Qj[0], Qj[1]);
+    fp2copy(P->X, P2->x);
+    fp2copy(P->Y, P2->y);
+    fp2copy(Q->X, Q2->x);
+    fp2copy(Q->Y, Q2->y);
+    Tate2_pairings(P2, Q2, Qj, f);
+    fp2copy(f[0], g2);
+    fp2correction(g2);
+
+    load_point(B_basis_zero, P);
+    load_point(B_basis_zero + 4*NWORDS64_FIELD, Q);
+    point_add(P, Q, Qj[0]);
+    point_add(P, Qj[0], Qj[1]);
+    Tate3_pairings(Qj, f);
+    fp2copy(f[0], g3);
+    fp2correction(g3);
+}
+
+
+static void gen_path(unsigned int* P, const unsigned int n, const unsigned int step, const unsigned int mul)
+{ // Optimal traversal of a tree with n leaves: P[z] is the first split t of the least cost for a subtree of z leaves,
+  // when going down left past z-t digits costs (z-t)*step and going right costs t*mul
+    unsigned long long* C = calloc(n+1, sizeof(unsigned long long));
+    unsigned long long c;
+    unsigned int z, t;
+
+    P[0] = 0;
+    P[1] = 0;
+    for (z = 2; z <= n; z++) {
+        C[z] = (unsigned long long)-1;
+        for (t = 1; t < z; t++) {
+            c = C[t] + C[z-t] + (unsigned long long)(z-t)*step + (unsigned long long)t*mul;
+            if (c < C[z]) {
+                C[z] = c;
+                P[z] = t;
+            }
+        }
+    }
+    free(C);
+}
+
+
+static int leaf2(const felm_t* r, const int* logT, const felm_t* Texp, const unsigned int w1)
+{ // ord2w_dlog() of dlog.c for leaves of order 2^w1 given at run time
+    felm_t x, y, sum, prods[1 << (PH2_WMAX-3)];
+    unsigned int i, j, k, idx;
+
+    fpcopy(r[0], x);
+    fpcopy(r[1], y);
+    fpcorrection(x);
+    fpcorrection(y);
+    if (fpiszero(y)) return 0;
+    if (fpiszero(x)) return logT[0];
+    if (fpequal(x, y)) return logT[1];
+    fpcopy(y, sum);
+    fpneg(sum);
+    if (fpequal(x, sum)) return logT[2];
+    for (j = 2; j < w1; j++) {
+        for (i = 0; i < (1u << (j-1)); i++) {
+            if ((i % 2) == 0) {
+                idx = (1 << (j-2)) + (i/2) - 1;
+                fpmul_mont(y, Texp[idx], prods[idx]);
+            }
+            fpcopy(y, sum);
+            for (k = 0; k <= j-2; k++) {
+                idx = (1 << k) + (i >> (j-k-1)) - 1;
+                if (((i >> (j-k-2)) % 2) == 0) {
+                    fpadd(sum, prods[idx], sum);
+                } else {
+                    fpsub(sum, prods[idx], sum);
+                }
+            }
+            if (fpequal(x, sum)) return logT[(1 << j) + i - 1];
+            fpneg(sum);
+            if (fpequal(x, sum)) return logT[(1 << (j+1)) - i - 2];
+        }
+    }
+    return 0;
+}
+
+
+static void ph_free(ph_tables_t* T)
+{
+    free(T->path);
+    free(T->CT);
+    free(T->Texp);
+    free(T->Log);
+    free(T->G);
+    free(T->T1);
+    free(T->T2);
+    memset(T, 0, sizeof(ph_tables_t));
+}
+
+
+static bool gen_ph2(ph_tables_t* T, const unsigned int w)
+{ // Tables of the discrete logs in base g2 for windows of w bits, w dividing eA
+    unsigned int w1 = w - 1, nTexp = (1 << (w1-2)) - 1, nLog = (1 << w1) - 1, nG = 1 << (w-2), order = 1 << w1;
+    unsigned int i, j, k, m, D, parent, root, *E;
+    int *ident, n;
+    f2elm_t g, b, t, rho, rho2;
+    felm_t r[2];
+    bool OK = true;
+
+    memset(T, 0, sizeof(ph_tables_t));
+    T->w = w;
+    T->dlen = OALICE_BITS / w;
+    T->half = 1 << w1;
+    T->path = calloc(T->dlen+1, sizeof(unsigned int));
+    T->CT = calloc(T->dlen*T->half, sizeof(felm_t));
+    T->Texp = calloc(nTexp, sizeof(felm_t));
+    T->Log = calloc(nLog, sizeof(int));
+    T->G = calloc(nG, sizeof(felm_t));
+    E = calloc(nTexp+1, sizeof(unsigned int));
+    ident = calloc(nLog, sizeof(int));
+    if (T->path == NULL || T->CT == NULL || T->Texp == NULL || T->Log == NULL || T->G == NULL || E == NULL || ident == NULL) {
+        OK = false;
+        goto cleanup;
+    }
+
+    gen_path(T->path, T->dlen, PH2_SQR_COST*w, PH2_MUL_COST);
+
+    fp2conj(g2, g);
+    fp2copy(g, b);
+    for (j = 0; j < T->dlen; j++) {                           // b = g^(2^(w*j))
+        fp2copy(b, t);
+        for (D = 1; D <= T->half; D++) {
+            torus_alpha(t, T->CT[j*T->half + D-1]);
+            fp2mul_mont(t, b, t);
+        }
+        cycl_pow_ell(b, 2, w, b);
+    }
+
+    cycl_pow_ell(g, 2, OALICE_BITS-w, rho);
+    cycl_pow_ell(g2, 2, OALICE_BITS-w1, rho2);                // The leaves are powers of rho2 = 1/rho^2, of order 2^w1
+    cycl_pow(rho, -(1 << (w-2)), t);
+    torus_alpha(t, T->G[0]);
+    for (m = 1; m <= w-2; m++) {
+        for (i = 0; i < (1u << (m-1)); i++) {
+            cycl_pow(rho, -(int)((1 << (w-2-m))*(1 + 4*reverse(i, m-1))), t);
+            torus_alpha(t, T->G[(1 << (m-1)) + i]);
+        }
+    }
+
+    cycl_pow(rho2, 1 << (w1-2), t);                           // i = rho2^(2^(w1-2)) or rho2^(3*2^(w1-2))
+    fp2correction(t);
+    root = fpequal(t[1], (digit_t*)&Montgomery_one) ? (1 << (w1-2)) : (3 << (w1-2));
+    for (k = 0; k + 3 <= w1; k++) {                           // Exponents of e(k,m) in base rho2
+        for (m = 0; m < (1u << k); m++) {
+            if (k == 0) {
+                parent = root;
+            } else {
+                parent = E[(1 << (k-1)) - 1 + (m >> 1)] + ((m & 1) << (w1-1));
+            }
+            E[(1 << k) - 1 + m] = (parent % order) / 2;
+        }
+    }
+    for (i = 0; i < nTexp; i++) {
+        cycl_pow(rho2, (int)E[i], t);
+        fpcopy(t[1], T->Texp[i]);
+        fpinv_mont(T->Texp[i]);
+        fpcorrection(T->Texp[i]);
+    }
+
+    for (i = 0; i < nLog; i++) ident[i] = (int)i + 1;
+    for (k = 1; k < order; k++) {                             // Positions of the leaves rho2^k
+        cycl_pow(rho2, (int)k, t);
+        torus_proj(t, r);
+        n = leaf2((const felm_t*)r, ident, (const felm_t*)T->Texp, w1) - 1;
+        if (n < 0 || T->Log[n] != 0) {
+            OK = false;
+            break;
+        }
+        T->Log[n] = (k <= order/2) ? (int)k : (int)k - (int)order;
+    }
+
+cleanup:
+    free(E);
+    free(ident);
+    if (!OK) ph_free(T);
+    return OK;
+}
+
+
+static void gen_ph3_rows(f2elm_t* T, const unsigned int half, const unsigned int row, const unsigned int e)
+{ // Row row of a table for ell = 3: T[row][t-1] = g3^(-t*3^e) for t = 1..half
+    f2elm_t b, t;
+    unsigned int i;
+
+    cycl_pow_ell(g3, 3, e, b);
+    fp2conj(b, b);
+    fp2copy(b, t);
+    for (i = 0; i < half; i++) {
+        fp2copy(t, T[row*half + i]);
+        fp2correction(T[row*half + i]);
+        fp2mul_mont(t, b, t);
+    }
+}
+
+
+static bool gen_ph3(ph_tables_t* T, const unsigned int w)
+{ // Tables of the discrete logs in base g3 for windows of w trits
+    unsigned int r = OBOB_EXPON % w, j, ellw = 1;
+
+    memset(T, 0, sizeof(ph_tables_t));
+    for (j = 0; j < w; j++) ellw *= 3;
+    T->w = w;
+    T->dlen = (OBOB_EXPON + w - 1) / w;
+    T->half = ellw / 2;
+    T->path = calloc(T->dlen+1, sizeof(unsigned int));
+    T->T1 = calloc(T->dlen*T->half, sizeof(f2elm_t));
+    if (r != 0) T->T2 = calloc(T->dlen*T->half, sizeof(f2elm_t));
+    if (T->path == NULL || T->T1 == NULL || (r != 0 && T->T2 == NULL)) {
+        ph_free(T);
+        return false;
+    }
+
+    gen_path(T->path, T->dlen, PH3_CUBE_COST*w, PH3_MUL_COST);
+    for (j = 0; j < T->dlen; j++) {
+        gen_ph3_rows(T->T1, T->half, j, w*j);
+        if (r != 0) {
+            gen_ph3_rows(T->T2, T->half, j, (j == 0) ? 0 : w*j - w + r);
+        }
+    }
+    return true;
+}
+
+
+static bool check_words(const char* name, const void* new_table, const void* table, const unsigned int nbytes)
+{ // Compares nbytes of the generated and the compiled tables
+    int dots = 30 - (int)strlen(name);
+
+    printf("  Table %s ", name);
+    while (dots-- > 0) printf(".");
+    if (memcmp(new_table, table, nbytes) == 0) {
+        printf(" PASSED\n");
+        return true;
+    }
+    printf(" FAILED\n");
+    return false;
+}
+
+
+static bool check_felms(const char* name, const felm_t* new_table, const uint64_t* table, const unsigned int n)
+{ // Compares n GF(p) elements of the generated and the compiled tables, in the 64-bit word layout of the latter
+    uint64_t* words = calloc(n, FELM_BYTES64);
+    unsigned int i;
+    bool OK;
+
+    if (words == NULL) return false;
+    for (i = 0; i < n; i++) {
+        felm_t a;
+        fpcopy(new_table[i], a);
+        fpcorrection(a);
+        memcpy((unsigned char*)words + i*FELM_BYTES64, a, FELM_BYTES64);
+    }
+    OK = check_words(name, words, table, n*FELM_BYTES64);
+    free(words);
+    return OK;
+}
+
+
+static bool check_leaves(const ph_tables_t* T)
+{ // ord2w_dlog() must give the digits of all the leaves with both the generated and the compiled ph2_Texp and ph2_Log
+    unsigned int order = 1 << W_2_1, k;
+    int d, dots = 30 - (int)strlen("ph2_Texp/ph2_Log");
+    f2elm_t rho2, t;
+    felm_t r[2];
+    bool OK = true;
+
+    cycl_pow_ell(g2, 2, OALICE_BITS-W_2_1, rho2);
+    for (k = 0; k < order; k++) {
+        cycl_pow(rho2, (int)k, t);
+        torus_proj(t, r);
+        d = (k <= order/2) ? (int)k : (int)k - (int)order;
+        OK = OK && (ord2w_dlog((const felm_t*)r, T->Log, (const felm_t*)T->Texp) == d);
+        OK = OK && (ord2w_dlog((const felm_t*)r, ph2_Log, (const felm_t*)ph2_Texp) == d);
+    }
+    printf("  Table ph2_Texp/ph2_Log ");
+    while (dots-- > 0) printf(".");
+    printf("%s\n", OK ? " PASSED" : " FAILED");
+    return OK;
+}
+
+
+static bool check_logs(const unsigned int ell)
+{ // Solves DLOG_CHECKS logs of random powers of g2 or g3 with the compiled tables
+    unsigned char key[(SECRETKEY_A_BYTES > SECRETKEY_B_BYTES) ? SECRETKEY_A_BYTES : SECRETKEY_B_BYTES];
+    digit_t k[NWORDS_ORDER], d[NWORDS_ORDER];
+    int D[(DLEN_2 > DLEN_3) ? DLEN_2 : DLEN_3];
+    unsigned int n;
+    f2elm_t h;
+    bool OK = true;
+
+    for (n = 0; n < DLOG_CHECKS; n++) {
+        memset(k, 0, sizeof(k));
+        memset(d, 0, sizeof(d));
+        if (ell == 2) {
+            random_mod_order_A(key);
+            key[0] |= (unsigned char)(n & 1);
+            memcpy(k, key, SECRETKEY_A_BYTES);
+            cycl_exp(g2, k, OALICE_BITS, h);
+        } else {
+            random_mod_order_B(key);
+            memcpy(k, key, SECRETKEY_B_BYTES);
+            cycl_exp(g3, k, OBOB_BITS, h);
+        }
+        fp2correction(h);
+        solve_dlog(h, D, d, (int)ell);
+        if (ell == 2 && (OALICE_BITS % RADIX) != 0) {          // Digits above 2^eA are not reduced
+            d[OALICE_BITS/RADIX] &= ((digit_t)1 << (OALICE_BITS % RADIX)) - 1;
+            memset(&d[OALICE_BITS/RADIX+1], 0, (NWORDS_ORDER-OALICE_BITS/RADIX-1)*sizeof(digit_t));
+        }
+        OK = OK && (memcmp(k, d, sizeof(k)) == 0);
+    }
+    printf("  Random logs for ell = %u ............... %s\n", ell, OK ? "PASSED" : "FAILED");
+    return OK;
+}
+
+
+static void print_felms(const char* decl, const felm_t* table, const unsigned int n)
+{ // Prints n GF(p) elements as a C array, one element per line
+    felm_t a;
+    uint64_t* w = (uint64_t*)a;
+    unsigned int i, j;
+
+    printf("%s = {\n", decl);
+    for (i = 0; i < n; i++) {
+        fpcopy(table[i], a);
+        fpcorrection(a);
+        for (j = 0; j < NWORDS64_FIELD; j++) {
+            printf("0x%llx%s", (unsigned long long)w[j], (j < NWORDS64_FIELD-1) ? ", " : "");
+        }
+        printf("%s\n", (i < n-1) ? "," : " };");
+    }
+}
+
+
+static void print_ints(const char* decl, const char* format, const void* table, const unsigned int n)
+{ // Prints n unsigned or signed integers as a C array
+    unsigned int i;
+
+    printf("%s = {\n", decl);
+    for (i = 0; i < n; i++) {
+        printf(format, ((const int*)table)[i]);
+        printf("%s", (i == n-1) ? " };\n" : ((i % 24) == 23) ? ",\n" : ", ");
+    }
+}
+
+
+static void print_tables(const ph_tables_t* T2, const ph_tables_t* T3)
+{ // Prints PXXX_compressed_dlog_tables.c for W_2 = T2->w and W_3 = T3->w
+    printf("/********************************************************************************************\n");
+    printf("* SIDH: an efficient supersingular isogeny cryptography library\n");
+    printf("*\n");
+    printf("* Abstract: precomputed tables for Pohlig-Hellman when using compression in %s\n", SCHEME_NAME);
+    printf("*           Generated by dlog_gen -w %u %u, see tests/dlog_gen.c for their contents\n", T2->w, T3->w);
+    printf("*********************************************************************************************/\n\n");
+
+    printf("// Tables for ell=2, W_2 = %u: %u digits\n", T2->w, T2->dlen);
+    printf("#if (W_2 == %u)\n\n", T2->w);
+    print_ints("const unsigned int ph2_path[PLEN_2]", "%u", T2->path, T2->dlen+1);
+    printf("\n");
+    print_felms("const uint64_t ph2_Texp[((1<<(W_2_1-2))-1)*NWORDS64_FIELD]", (const felm_t*)T2->Texp, (1 << (T2->w-3)) - 1);
+    printf("\n");
+    print_ints("const int ph2_Log[(1<<(W_2_1))-1]", "%d", T2->Log, (1 << (T2->w-1)) - 1);
+    printf("\n");
+    print_felms("const uint64_t ph2_G[(1<<(W_2-2))*NWORDS64_FIELD]", (const felm_t*)T2->G, 1 << (T2->w-2));
+    printf("\n#if !defined(TABLE_BUNDLE)\n");
+    print_felms("const uint64_t ph2_CT[DLEN_2*(ELL2_W >> 1)*NWORDS64_FIELD]", (const felm_t*)T2->CT, T2->dlen*T2->half);
+    printf("#endif\n\n");
+    printf("#else\n");
+    printf("    #error -- \"No Pohlig-Hellman tables for this W_2, generate them with dlog_gen -w\"\n");
+    printf("#endif\n\n");
+
+    printf("// Tables for ell=3, W_3 = %u: %u digits\n", T3->w, T3->dlen);
+    printf("#if (W_3 == %u)\n\n", T3->w);
+    print_ints("const unsigned int ph3_path[PLEN_3]", "%u", T3->path, T3->dlen+1);
+    printf("\n#if !defined(TABLE_BUNDLE)\n");
+    if (T3->T2 == NULL) {
+        print_felms("const uint64_t ph3_T[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD]", (const felm_t*)T3->T1, 2*T3->dlen*T3->half);
+        printf("#endif\n");
+        printf("const uint64_t *ph3_T1 = {0};\n");
+        printf("const uint64_t *ph3_T2 = {0};\n\n");
+    } else {
+        print_felms("const uint64_t ph3_T1[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD]", (const felm_t*)T3->T1, 2*T3->dlen*T3->half);
+        printf("\n");
+        print_felms("const uint64_t ph3_T2[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD]", (const felm_t*)T3->T2, 2*T3->dlen*T3->half);
+        printf("#endif\n");
+        printf("const uint64_t *ph3_T = {0};\n\n");
+    }
+    printf("#else\n");
+    printf("    #error -- \"No Pohlig-Hellman tables for this W_3, generate them with dlog_gen -w\"\n");
+    printf("#endif\n");
+}
+
+
+static int cmp_cycles(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a, y = *(const unsigned long long*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static void bench_logs(void)
+{ // Median cycles of solve_dlog() on random powers of g2 and g3, and sizes of the compiled tables
+    unsigned long long cycles[2][DLOG_BENCH], bytes2, bytes3;
+    unsigned char key[SECRETKEY_A_BYTES];
+    digit_t k[NWORDS_ORDER], d[NWORDS_ORDER];
+    int D[(DLEN_2 > DLEN_3) ? DLEN_2 : DLEN_3];
+    f2elm_t h[2];
+    unsigned int n, i;
+    int64_t t;
+
+    for (n = 0; n < DLOG_BENCH; n++) {
+        memset(k, 0, sizeof(k));
+        random_mod_order_A(key);
+        memcpy(k, key, SECRETKEY_A_BYTES);
+        cycl_exp(g2, k, OALICE_BITS, h[0]);
+        cycl_exp(g3, k, OALICE_BITS, h[1]);
+        for (i = 0; i < 2; i++) {
+            fp2correction(h[i]);
+            memset(d, 0, sizeof(d));
+            t = cpucycles();
+            solve_dlog(h[i], D, d, (int)i + 2);
+            cycles[i][n] = (unsigned long long)(cpucycles() - t);
+        }
+    }
+    qsort(cycles[0], DLOG_BENCH, sizeof(unsigned long long), cmp_cycles);
+    qsort(cycles[1], DLOG_BENCH, sizeof(unsigned long long), cmp_cycles);
+
+    bytes2 = (unsigned long long)(DLEN_2*(ELL2_W >> 1) + ((1 << (W_2_1-2)) - 1) + (1 << (W_2-2)))*FELM_BYTES64 + ((1 << W_2_1) - 1)*sizeof(int);
+    bytes3 = (unsigned long long)DLEN_3*(ELL3_W >> 1)*2*FELM_BYTES64*((OBOB_EXPON % W_3 == 0) ? 1 : 2);
+    printf("  ell = 2, W_2 = %2d: %9.1f KB, %10llu ", W_2, bytes2/1024.0, cycles[0][DLOG_BENCH/2]); print_unit;
+    printf("\n  ell = 3, W_3 = %2d: %9.1f KB, %10llu ", W_3, bytes3/1024.0, cycles[1][DLOG_BENCH/2]); print_unit;
+    printf("\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    ph_tables_t T2, T3;
+    int w2 = W_2, w3 = W_3;
+    bool check = false, bench = false, OK = true;
+
+    if (argc == 2 && strcmp(argv[1], "-c") == 0) {
+        check = true;
+    } else if (argc == 2 && strcmp(argv[1], "-b") == 0) {
+        bench = true;
+    } else if (argc == 4 && strcmp(argv[1], "-w") == 0) {
+        w2 = atoi(argv[2]);
+        w3 = atoi(argv[3]);
+        if (w2 < 4 || w2 > PH2_WMAX || (OALICE_BITS % w2) != 0 || w3 < 1 || w3 > PH3_WMAX) {
+            printf("Windows must be 4 to %d dividing %d for ell=2, and 1 to %d for ell=3\n", PH2_WMAX, OALICE_BITS, PH3_WMAX);
+            return 1;
+        }
+    } else {
+        printf("Usage: %s [-c | -b | -w <w2> <w3>]\n", argv[0]);
+        return 1;
+    }
+
+    gen_bases();
+    if (bench) {
+        printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+        printf("Benchmarking the discrete logs of %s: \n\n", SCHEME_NAME);
+        bench_logs();
+        printf("\n");
+        return 0;
+    }
+    if (!gen_ph2(&T2, (unsigned int)w2) || !gen_ph3(&T3, (unsigned int)w3)) {
+        printf("  Could not generate the tables\n");
+        return 1;
+    }
+
+    if (!check) {
+        print_tables(&T2, &T3);
+    } else {
+        printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+        printf("Testing the Pohlig-Hellman tables for %s: \n\n", SCHEME_NAME);
+        OK = check_words("ph2_path", T2.path, ph2_path, PLEN_2*sizeof(unsigned int)) && OK;
+        OK = check_words("ph3_path", T3.path, ph3_path, PLEN_3*sizeof(unsigned int)) && OK;
+        OK = check_felms("ph2_CT", (const felm_t*)T2.CT, ph2_CT, (DLEN_2-1)*(ELL2_W >> 1)) && OK;
+        OK = check_felms("ph2_G", (const felm_t*)T2.G, ph2_G, 1 << (W_2-2)) && OK;
+        OK = check_leaves(&T2) && OK;
+#if (OBOB_EXPON % W_3 == 0)
+        OK = check_felms("ph3_T", (const felm_t*)T3.T1, ph3_T, 2*DLEN_3*(ELL3_W >> 1)) && OK;
+#else
+        OK = check_felms("ph3_T1", (const felm_t*)T3.T1, ph3_T1, 2*DLEN_3*(ELL3_W >> 1)) && OK;
+        OK = check_felms("ph3_T2", (const felm_t*)T3.T2, ph3_T2, 2*DLEN_3*(ELL3_W >> 1)) && OK;
+#endif
+        OK = check_logs(2) && OK;
+        OK = check_logs(3) && OK;
+        printf("\n");
+    }
+    ph_free(&T2);
+    ph_free(&T3);
+
+    return (OK == true) ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the pairing tables of SIDHp434_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P434/P434_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp434_compressed"
+
+// Line layout of src/P434/P434_compressed_pair_tables.c, reproduced by print_tables()
+#define T_TATE3_GROUP                 (6 * NWORDS64_FIELD)
+#define T_TATE2_GROUP                 (3 * NWORDS64_FIELD)
+#define T_TATE2_P_TAIL                { 7, 6, 4 }
+#define T_TATE2_Q_TAIL                { 6, 4, 4, 4, 3, 6, 9, 4, 2 }
+#define T_TATE2_P_COMMENT_END         ""
+#define T_TATE2_Q_COMMENT_END         ""
+
+#define fpcopy                        fpcopy434
+#define fpzero                        fpzero434
+#define fpadd                         fpadd434
+#define fpneg                         fpneg434
+#define fpcorrection                  fpcorrection434
+#define fp2copy                       fp2copy434
+#define fp2add                        fp2add434
+#define fp2sub                        fp2sub434
+#define fp2mul_mont                   fp2mul434_mont
+#define fp2sqr_mont                   fp2sqr434_mont
+#define fp2inv_mont                   fp2inv434_mont
+
+#include "../src/internal.h"
+#include "pairing_gen.c"
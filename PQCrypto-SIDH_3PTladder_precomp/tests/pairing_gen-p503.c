@@ -0,0 +1,36 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the pairing tables of SIDHp503_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P503/P503_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp503_compressed"
+
+// Line layout of src/P503/P503_compressed_pair_tables.c, reproduced by print_tables()
+#define T_TATE3_GROUP                 0
+#define T_TATE2_GROUP                 0
+#define T_TATE2_P_TAIL                { 10, 4, 2 }
+#define T_TATE2_Q_TAIL                { 6, 4, 4, 4, 4, 2, 6, 10, 4, 4 }
+#define T_TATE2_P_COMMENT_END         " "
+#define T_TATE2_Q_COMMENT_END         " "
+
+#define fpcopy                        fpcopy503
+#define fpzero                        fpzero503
+#define fpadd                         fpadd503
+#define fpneg                         fpneg503
+#define fpcorrection                  fpcorrection503
+#define fp2copy                       fp2copy503
+#define fp2add                        fp2add503
+#define fp2sub                        fp2sub503
+#define fp2mul_mont                   fp2mul503_mont
+#define fp2sqr_mont                   fp2sqr503_mont
+#define fp2inv_mont                   fp2inv503_mont
+
+#include "../src/internal.h"
+#include "pairing_gen.c"
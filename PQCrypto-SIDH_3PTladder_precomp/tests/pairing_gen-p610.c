@@ -0,0 +1,36 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the pairing tables of SIDHp610_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P610/P610_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp610_compressed"
+
+// Line layout of src/P610/P610_compressed_pair_tables.c, reproduced by print_tables()
+#define T_TATE3_GROUP                 0
+#define T_TATE2_GROUP                 (3 * NWORDS64_FIELD)
+#define T_TATE2_P_TAIL                { 11, 4, 4, 3 }
+#define T_TATE2_Q_TAIL                { 6, 4, 4, 4, 4, 4, 4, 6, 5, 10, 4, 4, 1 }
+#define T_TATE2_P_COMMENT_END         " "
+#define T_TATE2_Q_COMMENT_END         ""
+
+#define fpcopy                        fpcopy610
+#define fpzero                        fpzero610
+#define fpadd                         fpadd610
+#define fpneg                         fpneg610
+#define fpcorrection                  fpcorrection610
+#define fp2copy                       fp2copy610
+#define fp2add                        fp2add610
+#define fp2sub                        fp2sub610
+#define fp2mul_mont                   fp2mul610_mont
+#define fp2sqr_mont                   fp2sqr610_mont
+#define fp2inv_mont                   fp2inv610_mont
+
+#include "../src/internal.h"
+#include "pairing_gen.c"
@@ -0,0 +1,36 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the pairing tables of SIDHp751_compressed
+*********************************************************************************************/
+
+#include "../src/config.h"
+#define COMPRESS
+#include "../src/P751/P751_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp751_compressed"
+
+// Line layout of src/P751/P751_compressed_pair_tables.c, reproduced by print_tables()
+#define T_TATE3_GROUP                 0
+#define T_TATE2_GROUP                 0
+#define T_TATE2_P_TAIL                { 5, 12, 4, 4, 3 }
+#define T_TATE2_Q_TAIL                { 7, 4, 4, 4, 4, 4, 4, 4, 1, 7, 4, 13, 4, 4, 4 }
+#define T_TATE2_P_COMMENT_END         ""
+#define T_TATE2_Q_COMMENT_END         ""
+
+#define fpcopy                        fpcopy751
+#define fpzero                        fpzero751
+#define fpadd                         fpadd751
+#define fpneg                         fpneg751
+#define fpcorrection                  fpcorrection751
+#define fp2copy                       fp2copy751
+#define fp2add                        fp2add751
+#define fp2sub                        fp2sub751
+#define fp2mul_mont                   fp2mul751_mont
+#define fp2sqr_mont                   fp2sqr751_mont
+#define fp2inv_mont                   fp2inv751_mont
+
+#include "../src/internal.h"
+#include "pairing_gen.c"
@@ -0,0 +1,374 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the Miller-loop tables of the Tate pairings of the compressed variants
+*           The lines of the Miller loops only depend on the fixed bases, so Tate3_pairings and Tate2_pairings read
+*           them from tables derived here from B_basis_zero and A_basis_zero with affine doublings and triplings.
+*
+*           Tate3_pairings runs over E0: y^2 = x^3+x with the point PB of B_basis_zero. For T = [3^k]PB, k = 0..eB-2:
+*              T_tate3[k] = { l1, l2, n1, n2, x(2T)*x(3T), x(2T)+x(3T) }
+*           where l1 is the slope of the tangent at T, l2 the slope of the line through T and 2T, and ni = y(T)-li*x(T),
+*           followed by { x(T), y(T), l1, x(2T) } for T = [3^(eB-1)]PB of order 3.
+*           Tate2_pairings runs over the short Weierstrass model y^2 = x^3-11x+14 of E6 with the points P and Q of
+*           A_basis_zero. T_tate2_firststep_P = { x(2P), y(2P), l } where l in GF(p^2) is the slope of the tangent at P,
+*           and for T = [2^(k+1)]P, k = 0..eA-3:
+*              T_tate2_P[k] = { x(2T), y(2T), l }
+*           with l the slope of the tangent at T. The multiples of P have y in i*GF(p): the table holds y/i and -l*i.
+*           T_tate2_firststep_Q and T_tate2_Q are the same for Q.
+*
+*           Usage: pairing_gen-pXXX [-c | -b]
+*              (none):  print PXXX_compressed_pair_tables.c, byte for byte as in the repository (with LF line endings)
+*              -c:      compare the generated tables with the ones compiled into the library
+*              -b:      print the table sizes and the cycles of Tate3_pairings and Tate2_pairings
+*
+*           The tables are packed, one word after the other. Padding each Miller step to whole cache lines was measured with -b: 
+*           it made no difference to the pairings and grew the tables by up to 14%, so the packed layout was kept.
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#if defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define PAIR_BENCH     10           // Pairings timed by -b
+#else
+    #define PAIR_BENCH    200
+#endif
+
+#define FELM_BYTES         NBITS_TO_NBYTES(NBITS_FIELD)
+#define FELM_BYTES64       (NWORDS64_FIELD * 8)
+#define T_TATE3_WORDS      ((6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD)
+#define T_TATE2_WORDS      (3 * (OALICE_BITS - 2) * NWORDS64_FIELD)
+
+extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+extern const uint64_t A_basis_zero[8*NWORDS64_FIELD];
+extern const uint64_t B_basis_zero[8*NWORDS64_FIELD];
+extern const uint64_t T_tate3[T_TATE3_WORDS];
+extern const uint64_t T_tate2_firststep_P[4*NWORDS64_FIELD];
+extern const uint64_t T_tate2_P[T_TATE2_WORDS];
+extern const uint64_t T_tate2_firststep_Q[4*NWORDS64_FIELD];
+extern const uint64_t T_tate2_Q[T_TATE2_WORDS];
+
+void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2elm_t* f);
+void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f);
+
+static uint64_t new_tate3[T_TATE3_WORDS], new_first_P[4*NWORDS64_FIELD], new_tate2_P[T_TATE2_WORDS], new_first_Q[4*NWORDS64_FIELD], new_tate2_Q[T_TATE2_WORDS];
+
+
+static bool fpiszero(const felm_t a)
+{ // Non constant-time test of a GF(p) element
+    felm_t t, zero = {0};
+
+    fpcopy(a, t);
+    fpcorrection(t);
+    return (memcmp(t, zero, FELM_BYTES) == 0);
+}
+
+
+static void fpsmall(const int k, felm_t c)
+{ // c = k in Montgomery representation, for small k
+    int i;
+
+    fpzero(c);
+    for (i = 0; i < abs(k); i++) {
+        fpadd(c, (digit_t*)&Montgomery_one, c);
+    }
+    if (k < 0) fpneg(c);
+}
+
+
+static void store(const felm_t a, uint64_t* words)
+{ // Writes a GF(p) element in the 64-bit word layout of the tables
+    felm_t t;
+
+    fpcopy(a, t);
+    fpcorrection(t);
+    memcpy(words, t, FELM_BYTES64);
+}
+
+
+static void load_point(const uint64_t* xy, f2elm_t x, f2elm_t y)
+{ // (x, y) from the affine coordinates xy
+    fpcopy((digit_t*)xy + 0*NWORDS_FIELD, x[0]);
+    fpcopy((digit_t*)xy + 1*NWORDS_FIELD, x[1]);
+    fpcopy((digit_t*)xy + 2*NWORDS_FIELD, y[0]);
+    fpcopy((digit_t*)xy + 3*NWORDS_FIELD, y[1]);
+}
+
+
+static void tangent(const f2elm_t x, const f2elm_t y, const felm_t a, f2elm_t l)
+{ // Slope l = (3x^2+a)/(2y) of the tangent at (x, y) on y^2 = x^3+a*x+b
+    f2elm_t t, u;
+
+    fp2sqr_mont(x, t);
+    fp2add(t, t, u);
+    fp2add(u, t, u);
+    fpadd(u[0], a, u[0]);
+    fp2add(y, y, t);
+    fp2inv_mont(t);
+    fp2mul_mont(u, t, l);
+}
+
+
+static void add_slope(const f2elm_t x, const f2elm_t y, const f2elm_t l, const f2elm_t x2, f2elm_t x3, f2elm_t y3)
+{ // (x3, y3) = (x, y) + (x2, y2) given the slope l of the line through both points, or of the tangent if they are equal
+    f2elm_t t, u;
+
+    fp2sqr_mont(l, t);
+    fp2sub(t, x, t);
+    fp2sub(t, x2, t);
+    fp2sub(x, t, u);
+    fp2mul_mont(l, u, u);
+    fp2sub(u, y, y3);
+    fp2copy(t, x3);
+}
+
+
+static void add(const f2elm_t x, const f2elm_t y, const f2elm_t x2, const f2elm_t y2, f2elm_t x3, f2elm_t y3)
+{ // (x3, y3) = (x, y) + (x2, y2) for x != x2
+    f2elm_t l, t;
+
+    fp2sub(y2, y, l);
+    fp2sub(x2, x, t);
+    fp2inv_mont(t);
+    fp2mul_mont(l, t, l);
+    add_slope(x, y, l, x2, x3, y3);
+}
+
+
+static bool gen_tate3(void)
+{ // T_tate3 from PB = (x, y) in E0(GF(p))
+    f2elm_t x, y, x2, y2, x3, y3, l1, l2, t;
+    felm_t a;
+    uint64_t* row;
+    int k;
+
+    fpsmall(1, a);
+    load_point(B_basis_zero, x, y);
+    for (k = 0; k < OBOB_EXPON - 1; k++) {
+        row = new_tate3 + 6*k*NWORDS64_FIELD;
+        tangent(x, y, a, l1);
+        add_slope(x, y, l1, x, x2, y2);                 // 2T
+        fp2sub(y2, y, t);
+        fp2sub(x2, x, l2);
+        fp2inv_mont(l2);
+        fp2mul_mont(t, l2, l2);
+        add_slope(x, y, l2, x2, x3, y3);                // 3T
+        store(l1[0], row + 0*NWORDS64_FIELD);
+        store(l2[0], row + 1*NWORDS64_FIELD);
+        fp2mul_mont(l1, x, t);
+        fp2sub(y, t, t);
+        store(t[0], row + 2*NWORDS64_FIELD);
+        fp2mul_mont(l2, x, t);
+        fp2sub(y, t, t);
+        store(t[0], row + 3*NWORDS64_FIELD);
+        fp2mul_mont(x2, x3, t);
+        store(t[0], row + 4*NWORDS64_FIELD);
+        fp2add(x2, x3, t);
+        store(t[0], row + 5*NWORDS64_FIELD);
+        fp2copy(x3, x);
+        fp2copy(y3, y);
+        if (!fpiszero(x[1]) || !fpiszero(y[1]) || fpiszero(y[0])) return false;
+    }
+
+    row = new_tate3 + 6*(OBOB_EXPON - 1)*NWORDS64_FIELD;    // T of order 3: 2T = -T
+    tangent(x, y, a, l1);
+    add_slope(x, y, l1, x, x2, y2);
+    store(x[0], row + 0*NWORDS64_FIELD);
+    store(y[0], row + 1*NWORDS64_FIELD);
+    store(l1[0], row + 2*NWORDS64_FIELD);
+    store(x2[0], row + 3*NWORDS64_FIELD);
+    fp2sub(x2, x, t);
+    return fpiszero(t[0]);
+}
+
+
+static bool gen_tate2_point(const uint64_t* xy, const unsigned int imag, uint64_t* first, uint64_t* table)
+{ // The firststep table and the table of P (imag = 1, y in i*GF(p)) or Q (imag = 0)
+    f2elm_t x, y, l;
+    felm_t a;
+    uint64_t* row;
+    int k;
+
+    fpsmall(-11, a);
+    load_point(xy, x, y);
+    tangent(x, y, a, l);
+    add_slope(x, y, l, x, x, y);
+    store(x[0], first + 0*NWORDS64_FIELD);
+    store(y[imag], first + 1*NWORDS64_FIELD);
+    store(l[0], first + 2*NWORDS64_FIELD);
+    store(l[1], first + 3*NWORDS64_FIELD);
+    if (!fpiszero(x[1]) || !fpiszero(y[1-imag])) return false;
+
+    for (k = 0; k < OALICE_BITS - 2; k++) {
+        row = table + 3*k*NWORDS64_FIELD;
+        tangent(x, y, a, l);
+        add_slope(x, y, l, x, x, y);
+        if (imag) fpneg(l[1]);
+        store(x[0], row + 0*NWORDS64_FIELD);
+        store(y[imag], row + 1*NWORDS64_FIELD);
+        store(l[imag], row + 2*NWORDS64_FIELD);
+        if (!fpiszero(x[1]) || !fpiszero(y[1-imag]) || !fpiszero(l[1-imag])) return false;
+    }
+    return fpiszero(y[imag]);                              // [2^(eA-1)]P has order 2
+}
+
+
+static bool check_words(const char* name, const uint64_t* new_table, const uint64_t* table, const unsigned int nwords)
+{ // Compares nwords of the generated and the compiled tables
+    int dots = 30 - (int)strlen(name);
+
+    printf("  Table %s ", name);
+    while (dots-- > 0) printf(".");
+    if (memcmp(new_table, table, nwords*sizeof(uint64_t)) == 0) {
+        printf(" PASSED\n");
+        return true;
+    }
+    printf(" FAILED\n");
+    return false;
+}
+
+
+static void print_words(const char* comment, const char* decl, const uint64_t* table, const unsigned int nwords, const char* end, 
+                        const unsigned int group, const unsigned int* tail, const unsigned int ntail)
+{ // Prints a table as a C array followed by end, 4 words per line. A line also ends after each group of words (unless group = 0), 
+  // and the last ntail lines hold tail[0], ..., tail[ntail-1] words
+    unsigned int i, j, k = 0, stop, body = nwords;
+
+    for (j = 0; j < ntail; j++) body -= tail[j];
+    printf("%s\n\n", comment);
+    printf("const uint64_t %s = { \n", decl);
+    for (i = 0; i < nwords; i = stop) {
+        if (i < body) {
+            stop = i + 4;
+            if (group != 0 && stop > (i/group + 1)*group) stop = (i/group + 1)*group;
+            if (stop > body) stop = body;
+        } else {
+            stop = i + tail[k++];
+        }
+        for (j = i; j < stop; j++) {
+            printf("0x%llX%s", (unsigned long long)table[j], (j == nwords-1) ? "\n};\n" : (j == stop-1) ? ", \n" : ", ");
+        }
+    }
+    printf("%s", end);
+}
+
+
+static void print_tables(void)
+{ // Prints PXXX_compressed_pair_tables.c with the line layout of the file in the repository, see T_TATE*_GROUP and T_TATE2_*_TAIL
+    const unsigned int tail_P[] = T_TATE2_P_TAIL, tail_Q[] = T_TATE2_Q_TAIL;
+
+    printf("/**************************************************************************************************\n");
+    printf("* SIDH: an efficient supersingular isogeny cryptography library\n");
+    printf("*\n");
+    printf("* Abstract: precomputed tables for pairing computation on E0: y^2 = x^3 + x when using compression\n");
+    printf("***************************************************************************************************/  \n\n\n");
+
+    print_words("// T_tate3 contains 6*(eB-1)+4 elements from Fp. There are (eB-1) 6-tuples (l1,l2,n1,n2,x23,x2p3), each corresponding to a single step in the Miller loop. \n"
+                "// The values l1 and l2 are the slopes of the doubling and point addition to compute the tripling, n1 and n2 are coefficients of the corresponding lines and \n"
+                "// x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four \n"
+                "// precomputed values.",
+                "T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD]", new_tate3, T_TATE3_WORDS, "\n\n", T_TATE3_GROUP, NULL, 0);
+    print_words("// Precomputed values for the first Miller iteration of the Tate pairing on the \n"
+                "// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the \n"
+                "// coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.",
+                "T_tate2_firststep_P[4 * NWORDS64_FIELD]", new_first_P, 4*NWORDS64_FIELD, "\n\n", 0, NULL, 0);
+    print_words("// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1)." T_TATE2_P_COMMENT_END,
+                "T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD]", new_tate2_P, T_TATE2_WORDS, "\n\n", 
+                T_TATE2_GROUP, tail_P, sizeof(tail_P)/sizeof(tail_P[0]));
+    print_words("// Precomputed values for the first Miller iteration of the Tate pairing on the \n"
+                "// 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the \n"
+                "// coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.",
+                "T_tate2_firststep_Q[4 * NWORDS64_FIELD]", new_first_Q, 4*NWORDS64_FIELD, "\n\n", 0, NULL, 0);
+    print_words("// From here on all values are in Fp. The table contains eA-2 triples (x,y,l1)." T_TATE2_Q_COMMENT_END,
+                "T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD]", new_tate2_Q, T_TATE2_WORDS, "\n", 
+                T_TATE2_GROUP, tail_Q, sizeof(tail_Q)/sizeof(tail_Q[0]));
+}
+
+
+static int cmp_cycles(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a, y = *(const unsigned long long*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static void bench_pairings(void)
+{ // Median cycles of the pairings computed for the public keys, on the points P+Q and 2P+Q of the fixed bases
+    unsigned long long cycles[2][PAIR_BENCH], bytes3, bytes2;
+    point_full_proj_t Qj[2];
+    point_t P2, Q2;
+    f2elm_t x, y, f[4];
+    unsigned int n, i;
+    int64_t t;
+
+    load_point(A_basis_zero, P2->x, P2->y);
+    load_point(A_basis_zero + 4*NWORDS64_FIELD, Q2->x, Q2->y);
+    for (i = 0; i < 2; i++) {
+        load_point((i == 0) ? B_basis_zero : A_basis_zero, x, y);
+        load_point(((i == 0) ? B_basis_zero : A_basis_zero) + 4*NWORDS64_FIELD, Qj[1]->X, Qj[1]->Y);
+        add(x, y, Qj[1]->X, Qj[1]->Y, Qj[0]->X, Qj[0]->Y);
+        add(x, y, Qj[0]->X, Qj[0]->Y, Qj[1]->X, Qj[1]->Y);
+        fpcopy((digit_t*)&Montgomery_one, Qj[0]->Z[0]);
+        fpzero(Qj[0]->Z[1]);
+        fpcopy((digit_t*)&Montgomery_one, Qj[1]->Z[0]);
+        fpzero(Qj[1]->Z[1]);
+        for (n = 0; n < PAIR_BENCH; n++) {
+            t = cpucycles();
+            if (i == 0) {
+                Tate3_pairings(Qj, f);
+            } else {
+                Tate2_pairings(P2, Q2, Qj, f);
+            }
+            cycles[i][n] = (unsigned long long)(cpucycles() - t);
+        }
+        qsort(cycles[i], PAIR_BENCH, sizeof(unsigned long long), cmp_cycles);
+    }
+
+    bytes3 = T_TATE3_WORDS*sizeof(uint64_t);
+    bytes2 = (2*T_TATE2_WORDS + 8*NWORDS64_FIELD)*sizeof(uint64_t);
+    printf("  Tate3_pairings: %9.1f KB, %10llu ", bytes3/1024.0, cycles[0][PAIR_BENCH/2]); print_unit;
+    printf("\n  Tate2_pairings: %9.1f KB, %10llu ", bytes2/1024.0, cycles[1][PAIR_BENCH/2]); print_unit;
+    printf("\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    bool check = false, OK = true;
+
+    if (argc == 2 && strcmp(argv[1], "-c") == 0) {
+        check = true;
+    } else if (argc == 2 && strcmp(argv[1], "-b") == 0) {
+        printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+        printf("Benchmarking the Tate pairings of %s: \n\n", SCHEME_NAME);
+        bench_pairings();
+        printf("\n");
+        return 0;
+    } else if (argc != 1) {
+        printf("Usage: %s [-c | -b]\n", argv[0]);
+        return 1;
+    }
+
+    if (!gen_tate3() || !gen_tate2_point(A_basis_zero, 1, new_first_P, new_tate2_P) || !gen_tate2_point(A_basis_zero + 4*NWORDS64_FIELD, 0, new_first_Q, new_tate2_Q)) {
+        printf("  Could not generate the tables\n");
+        return 1;
+    }
+
+    if (!check) {
+        print_tables();
+    } else {
+        printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+        printf("Testing the pairing tables for %s: \n\n", SCHEME_NAME);
+        OK = check_words("T_tate3", new_tate3, T_tate3, T_TATE3_WORDS) && OK;
+        OK = check_words("T_tate2_firststep_P", new_first_P, T_tate2_firststep_P, 4*NWORDS64_FIELD) && OK;
+        OK = check_words("T_tate2_P", new_tate2_P, T_tate2_P, T_TATE2_WORDS) && OK;
+        OK = check_words("T_tate2_firststep_Q", new_first_Q, T_tate2_firststep_Q, 4*NWORDS64_FIELD) && OK;
+        OK = check_words("T_tate2_Q", new_tate2_Q, T_tate2_Q, T_TATE2_WORDS) && OK;
+        printf("\n");
+    }
+
+    return (OK == true) ? 0 : 1;
+}
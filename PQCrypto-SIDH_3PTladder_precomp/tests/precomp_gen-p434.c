@@ -0,0 +1,42 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the precomputed 3-point ladder tables of SIDHp434
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P434/P434_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp434"
+
+// Signs of the square roots y(PA), y(S3) and y(PB0) used by the shipped tables: 0 = root as computed, 1 = negated
+#define SIGN_YPA       1
+#define SIGN_S3        0
+#define SIGN_PB0       0
+
+#define fpcopy                        fpcopy434
+#define fpzero                        fpzero434
+#define fpadd                         fpadd434
+#define fpsub                         fpsub434
+#define fpneg                         fpneg434
+#define fpdiv2                        fpdiv2_434
+#define fpcorrection                  fpcorrection434
+#define fpmul_mont                    fpmul434_mont
+#define fpsqr_mont                    fpsqr434_mont
+#define fpinv_mont                    fpinv434_mont
+#define fpinv_chain_mont              fpinv434_chain_mont
+#define fp2copy                       fp2copy434
+#define fp2zero                       fp2zero434
+#define fp2add                        fp2add434
+#define fp2sub                        fp2sub434
+#define fp2neg                        fp2neg434
+#define fp2div2                       fp2div2_434
+#define fp2correction                 fp2correction434
+#define fp2mul_mont                   fp2mul434_mont
+#define fp2sqr_mont                   fp2sqr434_mont
+#define fp2inv_mont                   fp2inv434_mont
+
+#include "../src/internal.h"
+#include "precomp_gen.c"
@@ -0,0 +1,42 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the precomputed 3-point ladder tables of SIDHp503
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P503/P503_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp503"
+
+// Signs of the square roots y(PA), y(S3) and y(PB0) used by the shipped tables: 0 = root as computed, 1 = negated
+#define SIGN_YPA       0
+#define SIGN_S3        1
+#define SIGN_PB0       1
+
+#define fpcopy                        fpcopy503
+#define fpzero                        fpzero503
+#define fpadd                         fpadd503
+#define fpsub                         fpsub503
+#define fpneg                         fpneg503
+#define fpdiv2                        fpdiv2_503
+#define fpcorrection                  fpcorrection503
+#define fpmul_mont                    fpmul503_mont
+#define fpsqr_mont                    fpsqr503_mont
+#define fpinv_mont                    fpinv503_mont
+#define fpinv_chain_mont              fpinv503_chain_mont
+#define fp2copy                       fp2copy503
+#define fp2zero                       fp2zero503
+#define fp2add                        fp2add503
+#define fp2sub                        fp2sub503
+#define fp2neg                        fp2neg503
+#define fp2div2                       fp2div2_503
+#define fp2correction                 fp2correction503
+#define fp2mul_mont                   fp2mul503_mont
+#define fp2sqr_mont                   fp2sqr503_mont
+#define fp2inv_mont                   fp2inv503_mont
+
+#include "../src/internal.h"
+#include "precomp_gen.c"
@@ -0,0 +1,42 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the precomputed 3-point ladder tables of SIDHp610
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P610/P610_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp610"
+
+// Signs of the square roots y(PA), y(S3) and y(PB0) used by the shipped tables: 0 = root as computed, 1 = negated
+#define SIGN_YPA       1
+#define SIGN_S3        0
+#define SIGN_PB0       0
+
+#define fpcopy                        fpcopy610
+#define fpzero                        fpzero610
+#define fpadd                         fpadd610
+#define fpsub                         fpsub610
+#define fpneg                         fpneg610
+#define fpdiv2                        fpdiv2_610
+#define fpcorrection                  fpcorrection610
+#define fpmul_mont                    fpmul610_mont
+#define fpsqr_mont                    fpsqr610_mont
+#define fpinv_mont                    fpinv610_mont
+#define fpinv_chain_mont              fpinv610_chain_mont
+#define fp2copy                       fp2copy610
+#define fp2zero                       fp2zero610
+#define fp2add                        fp2add610
+#define fp2sub                        fp2sub610
+#define fp2neg                        fp2neg610
+#define fp2div2                       fp2div2_610
+#define fp2correction                 fp2correction610
+#define fp2mul_mont                   fp2mul610_mont
+#define fp2sqr_mont                   fp2sqr610_mont
+#define fp2inv_mont                   fp2inv610_mont
+
+#include "../src/internal.h"
+#include "precomp_gen.c"
@@ -0,0 +1,42 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the precomputed 3-point ladder tables of SIDHp751
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P751/P751_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp751"
+
+// Signs of the square roots y(PA), y(S3) and y(PB0) used by the shipped tables: 0 = root as computed, 1 = negated
+#define SIGN_YPA       0
+#define SIGN_S3        0
+#define SIGN_PB0       1
+
+#define fpcopy                        fpcopy751
+#define fpzero                        fpzero751
+#define fpadd                         fpadd751
+#define fpsub                         fpsub751
+#define fpneg                         fpneg751
+#define fpdiv2                        fpdiv2_751
+#define fpcorrection                  fpcorrection751
+#define fpmul_mont                    fpmul751_mont
+#define fpsqr_mont                    fpsqr751_mont
+#define fpinv_mont                    fpinv751_mont
+#define fpinv_chain_mont              fpinv751_chain_mont
+#define fp2copy                       fp2copy751
+#define fp2zero                       fp2zero751
+#define fp2add                        fp2add751
+#define fp2sub                        fp2sub751
+#define fp2neg                        fp2neg751
+#define fp2div2                       fp2div2_751
+#define fp2correction                 fp2correction751
+#define fp2mul_mont                   fp2mul751_mont
+#define fp2sqr_mont                   fp2sqr751_mont
+#define fp2inv_mont                   fp2inv751_mont
+
+#include "../src/internal.h"
+#include "precomp_gen.c"
@@ -0,0 +1,489 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generator for the precomputed tables of the 3-point ladders
+*           The tables pre_for_Alice, pre_for_Bob, YQA4, DBL_QA, YPA and PplusQA are derived from
+*           A_gen, B_gen and the starting curve E6: y^2 = x^3+6x^2+x with the library's xDBL, xDBLADD
+*           and xTPLe, plus a few affine additions for the entries that need a y-coordinate.
+*
+*           Alice's ladder runs over GF(p) on E6 with the point Q2 = [2]QA, starting from the point S3 of
+*           order 3 in E6(GF(p)) which is later cleared by a tripling:
+*              pre_for_Alice = { x(S3), x(S3-Q2), xpre(Q2), xpre([2]Q2), ..., xpre([2^(eA-4)]Q2) }
+*              YQA4 = y([2^(eA-3)]Q2), the point of order 4 with x = 1,  DBL_QA = (x, y) of Q2,
+*              YPA = y(PA),  PplusQA = (x, y) of PA+QA,  where QA is lifted so that x(PA-QA) = XRA,
+*           with xpre(T) = (x(T)+1)/(x(T)-1) and S3 = [3^(eB-1)](PB+QB).
+*           Bob's ladder runs over GF(p) on E0: y^2 = x^3+x with the point PB0 that is mapped to PB by the
+*           2-isogeny x -> x(ix-1)/(x-i) of iso_for_Bob, starting from T = (1, sqrt(2)) of order 4:
+*              pre_for_Bob = { x(PB0), y(PB0), x(T-PB0), xpre(PB0), ..., xpre([2^(nB-1)]PB0), (x, y) of [2^(nB+2)]PB0 }
+*           where nB = OBOB_BITS.
+*
+*           The signs of y(PA), y(S3) and y(PB0) are free choices, any of them gives working tables.
+*           SIGN_YPA, SIGN_S3 and SIGN_PB0 select the negated square roots where the shipped tables do.
+*
+*           With -w, it instead prints the tables of the windowed fixed-base key generation enabled by PRECOMP_WINDOW:
+*              window_for_Alice = { (x(S3)+2, y(S3)), (x+2, y) of [v*2^(j*w)]Q2 for j = 0..ceil((eA-3)/w)-1, v = 1..2^w-1 }
+*              window_for_Bob = { (1, sqrt(2)) = T, (x, y) of [4*v*2^(j*w)]PB0 for j = 0..ceil((nB-1)/w)-1, v = 1..2^w-1 }
+*           Alice's points are shifted to the short Weierstrass model y^2 = x^3-11x+14 of E6, E0 already is one.
+*
+*           Usage: precomp_gen-pXXX [-c | -w <window>]
+*              -c:      compare the generated tables with the ones compiled into the library
+*              -w:      print PXXX_window_tables.c for windows of 1 to 8 bits
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+extern const uint64_t A_gen[6*NWORDS64_FIELD];
+extern const uint64_t B_gen[6*NWORDS64_FIELD];
+extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+extern const uint64_t pre_for_Alice[(OALICE_BITS-1)*NWORDS64_FIELD];
+extern const uint64_t pre_for_Bob[(OBOB_BITS+5)*NWORDS64_FIELD];
+extern const uint64_t YQA4[NWORDS64_FIELD];
+extern const uint64_t DBL_QA[2*NWORDS64_FIELD];
+extern const uint64_t YPA[2*NWORDS64_FIELD];
+extern const uint64_t PplusQA[4*NWORDS64_FIELD];
+
+typedef struct { f2elm_t x; f2elm_t y; } point_xy;                      // Point representation in affine coordinates
+typedef point_xy point_xy_t[1];
+
+static felm_t new_pre_for_Alice[OALICE_BITS-1], new_pre_for_Bob[OBOB_BITS+5], new_YQA4[1], new_DBL_QA[2], new_YPA[2], new_PplusQA[4];
+static point_xy_t base_Q2, base_S3, base_PB0;                           // Points kept by gen_tables() for the window tables
+
+
+static bool fp2equal(const f2elm_t a, const f2elm_t b)
+{ // Non constant-time comparison of two GF(p^2) elements
+    f2elm_t t0, t1;
+
+    fp2copy(a, t0);
+    fp2copy(b, t1);
+    fp2correction(t0);
+    fp2correction(t1);
+    return (memcmp(t0, t1, sizeof(f2elm_t)) == 0);
+}
+
+
+static bool fp_sqrt(const felm_t a, felm_t r)
+{ // r = a^((p+1)/4), the square root of a in GF(p) if there is one. Returns false otherwise
+    felm_t t0, t1;
+
+    fpcopy(a, t0);
+    fpinv_chain_mont(t0);                // t0 = a^((p-3)/4)
+    fpmul_mont(a, t0, r);
+    fpsqr_mont(r, t0);
+    fpcopy(a, t1);
+    fpcorrection(t0);
+    fpcorrection(t1);
+    return (memcmp(t0, t1, sizeof(felm_t)) == 0);
+}
+
+
+static bool fp2_sqrt(const f2elm_t u, f2elm_t y)
+{ // Square root of u = a+b*i in GF(p^2) using Hamburg's trick, as sqrt_Fp2() of the compressed library. Returns false if u is not a square
+    felm_t t0, t1, t2, t3;
+    f2elm_t t;
+
+    fpsqr_mont(u[0], t0);
+    fpsqr_mont(u[1], t1);
+    fpadd(t0, t1, t0);
+    fp_sqrt(t0, t1);                     // t1 = (a^2+b^2)^((p+1)/4)
+    fpadd(u[0], t1, t0);
+    fpdiv2(t0, t0);                      // t0 = (a+t1)/2
+    fpcopy(t0, t2);
+    fpinv_chain_mont(t2);                // t2 = t0^((p-3)/4)
+    fpmul_mont(t0, t2, t1);              // t1 = t0^((p+1)/4)
+    fpmul_mont(t2, u[1], t2);
+    fpdiv2(t2, t2);                      // t2 = b*t0^((p-3)/4)/2
+    fpsqr_mont(t1, t3);
+    fpcorrection(t0);
+    fpcorrection(t3);
+
+    if (memcmp(t0, t3, sizeof(felm_t)) == 0) {
+        fpcopy(t1, y[0]);
+        fpcopy(t2, y[1]);
+    } else {
+        fpneg(t1);
+        fpcopy(t2, y[0]);
+        fpcopy(t1, y[1]);
+    }
+    fp2sqr_mont(y, t);
+    return fp2equal(t, u);
+}
+
+
+static void curve_const(unsigned int A, f2elm_t A24plus, f2elm_t A24minus, f2elm_t C24, f2elm_t Aelm)
+{ // Constants of the curve y^2 = x^3+A*x^2+x for A = 0 or 6: A24plus = A+2, A24minus = A-2, C24 = 4 and Aelm = A
+    f2elm_t one = {0};
+    unsigned int i;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2zero(Aelm);
+    for (i = 0; i < A; i++) fp2add(Aelm, one, Aelm);
+    fp2add(one, one, C24);
+    fp2add(Aelm, C24, A24plus);
+    fp2sub(Aelm, C24, A24minus);
+    fp2add(C24, C24, C24);
+}
+
+
+static bool point_lift(const f2elm_t x, const f2elm_t A, const int sign, point_xy_t P)
+{ // P = (x, y) on y^2 = x^3+A*x^2+x. y is the square root computed by fp_sqrt() over GF(p) or by fp2_sqrt() over GF(p^2), negated if sign = 1.
+  // Returns false if there is no such point over GF(p^2), or over GF(p) for x in GF(p)
+    f2elm_t t0, t1;
+    felm_t zero = {0};
+    bool OK;
+
+    fp2sqr_mont(x, t0);
+    fp2mul_mont(A, x, t1);
+    fp2add(t0, t1, t1);
+    fpadd(t1[0], (digit_t*)&Montgomery_one, t1[0]);
+    fp2mul_mont(x, t1, t0);              // t0 = x^3+A*x^2+x
+    fp2copy(x, P->x);
+    fp2zero(P->y);
+    fpcorrection(t0[1]);
+    if (memcmp(t0[1], zero, sizeof(felm_t)) == 0) {
+        OK = fp_sqrt(t0[0], P->y[0]);
+    } else {
+        OK = fp2_sqrt(t0, P->y);
+    }
+    if (sign) fp2neg(P->y);
+    return OK;
+}
+
+
+static void point_add(const point_xy_t P, const point_xy_t Q, const f2elm_t A, point_xy_t R)
+{ // Affine addition R = P+Q on y^2 = x^3+A*x^2+x. P = Q is computed as a doubling, P = -Q is not supported
+    f2elm_t t0, t1, l, x3, one = {0};
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    if (fp2equal(P->x, Q->x)) {
+        fp2sqr_mont(P->x, t0);
+        fp2add(t0, t0, t1);
+        fp2add(t0, t1, t0);              // t0 = 3*x^2
+        fp2mul_mont(A, P->x, t1);
+        fp2add(t1, t1, t1);
+        fp2add(t0, t1, t0);
+        fp2add(t0, one, t0);             // t0 = 3*x^2+2*A*x+1
+        fp2add(P->y, P->y, t1);          // t1 = 2*y
+    } else {
+        fp2sub(Q->y, P->y, t0);
+        fp2sub(Q->x, P->x, t1);
+    }
+    fp2inv_mont(t1);
+    fp2mul_mont(t0, t1, l);              // l = t0/t1
+    fp2sqr_mont(l, x3);
+    fp2sub(x3, A, x3);
+    fp2sub(x3, P->x, x3);
+    fp2sub(x3, Q->x, x3);                // x3 = l^2-A-x1-x2
+    fp2sub(P->x, x3, t0);
+    fp2mul_mont(l, t0, t0);
+    fp2sub(t0, P->y, R->y);              // y3 = l*(x1-x3)-y1
+    fp2copy(x3, R->x);
+}
+
+
+static void point_sub(const point_xy_t P, const point_xy_t Q, const f2elm_t A, point_xy_t R)
+{ // Affine subtraction R = P-Q
+    point_xy_t T;
+
+    fp2copy(Q->x, T->x);
+    fp2copy(Q->y, T->y);
+    fp2neg(T->y);
+    point_add(P, T, A, R);
+}
+
+
+static void proj_to_x(const point_proj_t P, f2elm_t x)
+{ // x = X/Z
+    f2elm_t t;
+
+    fp2copy(P->Z, t);
+    fp2inv_mont(t);
+    fp2mul_mont(P->X, t, x);
+}
+
+
+static void xpre(const point_proj_t P, felm_t r)
+{ // r = (x+1)/(x-1) for x = X/Z in GF(p), the value consumed by xADD1 for the added point P: (X+Z)/(X-Z)
+    felm_t t0, t1;
+
+    fpadd(P->X[0], P->Z[0], t0);
+    fpsub(P->X[0], P->Z[0], t1);
+    fpinv_mont(t1);
+    fpmul_mont(t0, t1, r);
+}
+
+
+static bool gen_tables()
+{ // Derives the precomputed tables from A_gen, B_gen and the curve constants. Returns false if a point cannot be lifted
+    point_proj_t R, S;
+    point_xy_t PA, QA, Q2, T, S3, PB0;
+    f2elm_t xPA, xQA, xRA, xPB, xQB, xRB, x, A6, A0, A24plus, A24minus, C24, A24, one = {0};
+    unsigned int i;
+    bool OK = true;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2copy(((f2elm_t*)A_gen)[0], xPA);
+    fp2copy(((f2elm_t*)A_gen)[1], xQA);
+    fp2copy(((f2elm_t*)A_gen)[2], xRA);
+    fp2copy(((f2elm_t*)B_gen)[0], xPB);
+    fp2copy(((f2elm_t*)B_gen)[1], xQB);
+    fp2copy(((f2elm_t*)B_gen)[2], xRB);
+
+    // Alice's basis on E6, QA is lifted so that x(PA-QA) = XRA
+    curve_const(6, A24plus, A24minus, C24, A6);
+    OK = point_lift(xPA, A6, SIGN_YPA, PA) && OK;
+    OK = point_lift(xQA, A6, 0, QA) && OK;
+    point_sub(PA, QA, A6, T);
+    if (!fp2equal(T->x, xRA)) fp2neg(QA->y);
+    fpcopy(PA->y[0], new_YPA[0]);
+    fpcopy(PA->y[1], new_YPA[1]);
+    point_add(PA, QA, A6, T);
+    fpcopy(T->x[0], new_PplusQA[0]);
+    fpcopy(T->x[1], new_PplusQA[1]);
+    fpcopy(T->y[0], new_PplusQA[2]);
+    fpcopy(T->y[1], new_PplusQA[3]);
+    point_add(QA, QA, A6, Q2);
+    fpcopy(Q2->x[0], new_DBL_QA[0]);
+    fpcopy(Q2->y[0], new_DBL_QA[1]);
+    fp2copy(Q2->x, T->x);
+    fp2copy(Q2->y, T->y);
+    for (i = 0; i < OALICE_BITS-3; i++) {
+        point_add(T, T, A6, T);
+    }
+    fpcopy(T->y[0], new_YQA4[0]);
+
+    // Starting point S3 = [3^(eB-1)](PB+QB) of Alice's ladder
+    fp2copy(xPB, R->X);
+    fp2copy(one, R->Z);
+    fp2copy(xQB, S->X);
+    fp2copy(one, S->Z);
+    fp2add(C24, A24plus, A24);
+    fp2div2(A24, A24);
+    fp2div2(A24, A24);                   // A24 = (A+2)/4
+    xDBLADD(R, S, xRB, one, A24);        // S = PB+QB
+    xTPLe(S, S, A24minus, A24plus, OBOB_EXPON-1);
+    proj_to_x(S, x);
+    OK = point_lift(x, A6, SIGN_S3, S3) && OK;
+    fpcopy(S3->x[0], new_pre_for_Alice[0]);
+    fp2copy(S3->x, base_S3->x);
+    fp2copy(S3->y, base_S3->y);
+    fp2copy(Q2->x, base_Q2->x);
+    fp2copy(Q2->y, base_Q2->y);
+    point_sub(S3, Q2, A6, T);
+    fpcopy(T->x[0], new_pre_for_Alice[1]);
+
+    fp2copy(Q2->x, R->X);
+    fp2copy(one, R->Z);
+    for (i = 2; i < OALICE_BITS-1; i++) {
+        xpre(R, new_pre_for_Alice[i]);
+        xDBL(R, R, A24plus, C24);
+    }
+
+    // Bob's point PB0 on E0, x(PB0) = -XPB1/(XPB0+1) inverts x -> x(ix-1)/(x-i) for GF(p) values
+    curve_const(0, A24plus, A24minus, C24, A0);
+    fp2zero(x);
+    fpadd(xPB[0], one[0], x[0]);
+    fpinv_mont(x[0]);
+    fpmul_mont(xPB[1], x[0], x[0]);
+    fpneg(x[0]);
+    OK = point_lift(x, A0, SIGN_PB0, PB0) && OK;
+    fpcopy(PB0->x[0], new_pre_for_Bob[0]);
+    fpcopy(PB0->y[0], new_pre_for_Bob[1]);
+    fp2copy(PB0->x, base_PB0->x);
+    fp2copy(PB0->y, base_PB0->y);
+    OK = point_lift(one, A0, 0, T) && OK;
+    point_sub(T, PB0, A0, T);
+    fpcopy(T->x[0], new_pre_for_Bob[2]);
+
+    fp2copy(PB0->x, R->X);
+    fp2copy(one, R->Z);
+    for (i = 0; i < OBOB_BITS; i++) {
+        xpre(R, new_pre_for_Bob[3+i]);
+        xDBL(R, R, A24plus, C24);
+    }
+    fp2copy(PB0->x, T->x);
+    fp2copy(PB0->y, T->y);
+    for (i = 0; i < OBOB_BITS+2; i++) {
+        point_add(T, T, A0, T);
+    }
+    fpcopy(T->x[0], new_pre_for_Bob[OBOB_BITS+3]);
+    fpcopy(T->y[0], new_pre_for_Bob[OBOB_BITS+4]);
+
+    return OK;
+}
+
+
+static bool check_table(const char* name, const felm_t* table, const uint64_t* shipped, unsigned int n)
+{ // Compares n field elements with the shipped table, both are reduced before the comparison
+    felm_t a, b;
+    unsigned int i;
+    int dots = 50 - (int)strlen(name);
+
+    for (i = 0; i < n; i++) {
+        fpcopy(table[i], a);
+        fpcopy((digit_t*)shipped + i*NWORDS_FIELD, b);
+        fpcorrection(a);
+        fpcorrection(b);
+        if (memcmp(a, b, sizeof(felm_t)) != 0) break;
+    }
+    printf("  Table %s ", name);
+    while (dots-- > 0) printf(".");
+    if (i == n) {
+        printf(" PASSED\n");
+        return true;
+    }
+    printf(" FAILED at element %d\n", i);
+    return false;
+}
+
+
+static void print_table(const char* decl, const felm_t* table, unsigned int n)
+{ // Prints n field elements as a C array, one element per line
+    felm_t a;
+    uint64_t* w = (uint64_t*)a;
+    unsigned int i, j;
+
+    printf("%s = {\n", decl);
+    for (i = 0; i < n; i++) {
+        fpcopy(table[i], a);
+        fpcorrection(a);
+        for (j = 0; j < NWORDS64_FIELD; j++) {
+            printf("0x%llx%s", (unsigned long long)w[j], (j < NWORDS64_FIELD-1) ? ", " : "");
+        }
+        printf("%s\n", (i < n-1) ? "," : " };");
+    }
+}
+
+
+static felm_t* gen_window_table(const point_xy_t start, const point_xy_t P, const f2elm_t A, const unsigned int shift, const unsigned int nbits, const unsigned int w, unsigned int* n)
+{ // Table of a comb over nbits bits with windows of w bits: start followed by [v*2^(j*w)]P for j = 0..ceil(nbits/w)-1 and v = 1..2^w-1,
+  // all of them as pairs (x+shift, y) over GF(p). Returns the table, which holds n field elements
+    unsigned int len = (nbits+w-1)/w, npoints = (1 << w) - 1, i, j, v, k = 0;
+    felm_t* table = calloc(2*(1 + len*npoints), sizeof(felm_t));
+    felm_t s = {0};
+    point_xy_t B, V;
+
+    if (table == NULL) return NULL;
+    for (i = 0; i < shift; i++) {
+        fpadd(s, (digit_t*)&Montgomery_one, s);
+    }
+    fpadd(start->x[0], s, table[k++]);
+    fpcopy(start->y[0], table[k++]);
+    fp2copy(P->x, B->x);
+    fp2copy(P->y, B->y);
+    for (j = 0; j < len; j++) {
+        fp2copy(B->x, V->x);
+        fp2copy(B->y, V->y);
+        for (v = 1; v <= npoints; v++) {
+            fpadd(V->x[0], s, table[k++]);
+            fpcopy(V->y[0], table[k++]);
+            point_add(V, B, A, V);
+        }
+        for (i = 0; i < w; i++) {
+            point_add(B, B, A, B);
+        }
+    }
+    *n = k;
+    return table;
+}
+
+
+static bool print_window_tables(const unsigned int w)
+{ // Prints PXXX_window_tables.c for PRECOMP_WINDOW = w
+    f2elm_t A6, A0, A24plus, A24minus, C24, one = {0};
+    point_xy_t T, P;
+    felm_t *table_A, *table_B;
+    unsigned int nA, nB;
+    bool OK;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    curve_const(6, A24plus, A24minus, C24, A6);
+    curve_const(0, A24plus, A24minus, C24, A0);
+    OK = point_lift(one, A0, 0, T);
+    point_add(base_PB0, base_PB0, A0, P);
+    point_add(P, P, A0, P);                                   // P = [4]PB0
+    table_A = gen_window_table(base_S3, base_Q2, A6, 2, OALICE_BITS-3, w, &nA);
+    table_B = gen_window_table(T, P, A0, 0, OBOB_BITS-1, w, &nB);
+    if (!OK || table_A == NULL || table_B == NULL) {
+        free(table_A);
+        free(table_B);
+        return false;
+    }
+
+    printf("/********************************************************************************************\n");
+    printf("* SIDH: an efficient supersingular isogeny cryptography library\n");
+    printf("*\n");
+    printf("* Abstract: precomputed tables for the windowed fixed-base key generation of %s\n", SCHEME_NAME);
+    printf("*           Generated by precomp_gen -w %d, see tests/precomp_gen.c for their contents\n", w);
+    printf("*********************************************************************************************/\n\n");
+    printf("#if defined(PRECOMP_WINDOW)\n");
+    printf("#if (PRECOMP_WINDOW == %d)\n\n", w);
+    print_table("const uint64_t window_for_Alice[(1 + WINDOW_LEN_ALICE * WINDOW_POINTS) * 2 * NWORDS64_FIELD]", table_A, nA);
+    printf("\n");
+    print_table("const uint64_t window_for_Bob[(1 + WINDOW_LEN_BOB * WINDOW_POINTS) * 2 * NWORDS64_FIELD]", table_B, nB);
+    printf("\n#else\n");
+    printf("    #error -- \"No window tables for this PRECOMP_WINDOW, generate them with precomp_gen -w\"\n");
+    printf("#endif\n");
+    printf("#endif\n");
+
+    free(table_A);
+    free(table_B);
+    return true;
+}
+
+
+int main(int argc, char* argv[])
+{
+    bool check = false, OK = true;
+    int w = 0;
+
+    if (argc == 2 && strcmp(argv[1], "-c") == 0) {
+        check = true;
+    } else if (argc == 3 && strcmp(argv[1], "-w") == 0) {
+        w = atoi(argv[2]);
+        if (w < 1 || w > 8) {
+            printf("Window size must be between 1 and 8\n");
+            return 1;
+        }
+    } else if (argc != 1) {
+        printf("Usage: %s [-c | -w <window>]\n", argv[0]);
+        return 1;
+    }
+
+    if (!gen_tables()) {
+        printf("  Could not lift the basis points, the tables are not valid\n");
+        return 1;
+    }
+
+    if (w != 0) {
+        if (!print_window_tables((unsigned int)w)) {
+            printf("  Could not generate the window tables\n");
+            return 1;
+        }
+        return 0;
+    }
+
+    if (!check) {
+        print_table("const uint64_t pre_for_Alice[(OALICE_BITS - 1) * NWORDS64_FIELD]", new_pre_for_Alice, OALICE_BITS-1);
+        print_table("const uint64_t YQA4[NWORDS64_FIELD]", new_YQA4, 1);
+        print_table("const uint64_t DBL_QA[2 * NWORDS64_FIELD]", new_DBL_QA, 2);
+        print_table("const uint64_t YPA[2 * NWORDS64_FIELD]", new_YPA, 2);
+        print_table("const uint64_t PplusQA[4 * NWORDS64_FIELD]", new_PplusQA, 4);
+        print_table("const uint64_t pre_for_Bob[(OBOB_BITS + 5) * NWORDS64_FIELD]", new_pre_for_Bob, OBOB_BITS+5);
+        return 0;
+    }
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing the precomputed 3-point ladder tables for %s: \n\n", SCHEME_NAME);
+    OK = check_table("pre_for_Alice", new_pre_for_Alice, pre_for_Alice, OALICE_BITS-1) && OK;
+    OK = check_table("YQA4", new_YQA4, YQA4, 1) && OK;
+    OK = check_table("DBL_QA", new_DBL_QA, DBL_QA, 2) && OK;
+    OK = check_table("YPA", new_YPA, YPA, 2) && OK;
+    OK = check_table("PplusQA", new_PplusQA, PplusQA, 4) && OK;
+    OK = check_table("pre_for_Bob", new_pre_for_Bob, pre_for_Bob, OBOB_BITS+5) && OK;
+    printf("\n");
+
+    return (OK == true) ? 0 : 1;
+}
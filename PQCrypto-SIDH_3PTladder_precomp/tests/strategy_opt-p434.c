@@ -0,0 +1,19 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: optimal isogeny tree strategies for SIDHp434
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P434/P434_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp434"
+#define STRAT_FILE     "src/P434/P434.c"
+
+#define fp2copy                       fp2copy434
+#define fp2random_test                fp2random434_test
+
+#include "../src/internal.h"
+#include "strategy_opt.c"
@@ -0,0 +1,19 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: optimal isogeny tree strategies for SIDHp503
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P503/P503_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp503"
+#define STRAT_FILE     "src/P503/P503.c"
+
+#define fp2copy                       fp2copy503
+#define fp2random_test                fp2random503_test
+
+#include "../src/internal.h"
+#include "strategy_opt.c"
@@ -0,0 +1,19 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: optimal isogeny tree strategies for SIDHp610
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P610/P610_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp610"
+#define STRAT_FILE     "src/P610/P610.c"
+
+#define fp2copy                       fp2copy610
+#define fp2random_test                fp2random610_test
+
+#include "../src/internal.h"
+#include "strategy_opt.c"
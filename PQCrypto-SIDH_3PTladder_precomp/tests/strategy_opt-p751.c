@@ -0,0 +1,19 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: optimal isogeny tree strategies for SIDHp751
+*********************************************************************************************/
+
+#include "../src/config.h"
+#include "../src/P751/P751_internal.h"
+#include "test_extras.h"
+
+
+#define SCHEME_NAME    "SIDHp751"
+#define STRAT_FILE     "src/P751/P751.c"
+
+#define fp2copy                       fp2copy751
+#define fp2random_test                fp2random751_test
+
+#include "../src/internal.h"
+#include "strategy_opt.c"
@@ -0,0 +1,331 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: optimal isogeny tree strategies for the build host
+*           The costs of the tree steps and of the isogeny evaluations are measured on the host,
+*           and the strategies are computed by the library's strategy_optimal() under a bound on
+*           the number of stored points. The generated and the shipped strategies are then
+*           benchmarked on a full tree traversal.
+*
+*           Usage: strategy_opt-pXXX [-a points] [-b points] [-w]
+*              -a, -b:  bounds on the number of points stored by Alice's and Bob's traversals
+*                       (default and maximum: MAX_INT_POINTS_ALICE and MAX_INT_POINTS_BOB)
+*              -w:      replace strat_Alice and strat_Bob in STRAT_FILE (run from the library root)
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#if defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define COST_LOOPS             25       // Number of measurements per primitive
+    #define TRAVERSAL_LOOPS         3       // Number of tree traversals per strategy
+#else
+    #define COST_LOOPS           1000
+    #define TRAVERSAL_LOOPS        25
+#endif
+#define MAX_POINTS             STRATEGY_MAX_POINTS    // Largest bound accepted for the number of stored points
+#define MAX_LEAVES             (MAX_Bob > MAX_Alice ? MAX_Bob : MAX_Alice)
+
+extern const unsigned int strat_Alice[MAX_Alice-1];
+extern const unsigned int strat_Bob[MAX_Bob-1];
+
+
+static int cmp_cycles(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a, y = *(const unsigned long long*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static unsigned long long quartile(unsigned long long* cycles, unsigned int n)
+{ // Lower quartile of the measurements, which filters out the interrupted runs
+    qsort(cycles, n, sizeof(unsigned long long), cmp_cycles);
+    return cycles[n/4];
+}
+
+
+static void random_point(point_proj_t P)
+{
+    fp2random_test((digit_t*)P->X);
+    fp2random_test((digit_t*)P->Z);
+}
+
+
+static void measure_costs(unsigned long long* step_A, unsigned long long* eval_A, unsigned long long* step_B, unsigned long long* eval_B)
+{ // Cost of a step of each tree (2 doublings or 1 tripling) and of the corresponding isogeny evaluation
+    static unsigned long long cycles[4][COST_LOOPS];
+    unsigned long long cycles1;
+    f2elm_t A24plus, C24, A24minus, coeff[3];
+    point_proj_t P, Q;
+    unsigned int n;
+
+    for (n = 0; n < COST_LOOPS; n++) {
+        random_point(P);
+        fp2random_test((digit_t*)A24plus); fp2random_test((digit_t*)C24); fp2random_test((digit_t*)A24minus);
+        fp2random_test((digit_t*)coeff[0]); fp2random_test((digit_t*)coeff[1]); fp2random_test((digit_t*)coeff[2]);
+
+        cycles1 = cpucycles();
+        xDBLe(P, Q, A24plus, C24, 2);
+        cycles[0][n] = cpucycles() - cycles1;
+
+        cycles1 = cpucycles();
+        eval_4_isog(P, coeff);
+        cycles[1][n] = cpucycles() - cycles1;
+
+        cycles1 = cpucycles();
+        xTPLe(P, Q, A24minus, A24plus, 1);
+        cycles[2][n] = cpucycles() - cycles1;
+
+        cycles1 = cpucycles();
+        eval_3_isog(P, coeff);
+        cycles[3][n] = cpucycles() - cycles1;
+    }
+    *step_A = quartile(cycles[0], COST_LOOPS);
+    *eval_A = quartile(cycles[1], COST_LOOPS);
+    *step_B = quartile(cycles[2], COST_LOOPS);
+    *eval_B = quartile(cycles[3], COST_LOOPS);
+}
+
+
+static unsigned long long strategy_cost(const unsigned int* strat, unsigned int n, unsigned long long step, unsigned long long eval, unsigned int* maxpts)
+{ // Cost of a strategy under the model of strategy_optimal() and number of points it stores
+    unsigned int row, m, index = 0, npts = 0, ii = 0, pts_index[MAX_LEAVES];
+    unsigned long long cost = 0;
+
+    *maxpts = 0;
+    for (row = 1; row < n; row++) {
+        while (index < n-row) {
+            pts_index[npts++] = index;
+            if (npts > *maxpts) *maxpts = npts;
+            m = strat[ii++];
+            cost += m*step;
+            index += m;
+        }
+        cost += npts*eval;
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    return cost;
+}
+
+
+static unsigned long long traverse(const unsigned int* strat, unsigned int party)
+{ // Tree traversal of a key generation with the given strategy, on random inputs. Returns its cost in cycles.
+    point_proj_t R, phiP, phiQ, phiR, pts[MAX_POINTS];
+    f2elm_t K0, K1, coeff[3];                   // Curve constants: (A24plus, C24) for Alice, (A24minus, A24plus) for Bob
+    unsigned int i, row, m, index = 0, pts_index[MAX_POINTS], npts = 0, ii = 0;
+    unsigned int nleaves = (party == ALICE) ? MAX_Alice : MAX_Bob;
+    unsigned long long cycles1;
+
+    random_point(R); random_point(phiP); random_point(phiQ); random_point(phiR);
+    fp2random_test((digit_t*)K0); fp2random_test((digit_t*)K1);
+
+    cycles1 = cpucycles();
+    for (row = 1; row < nleaves; row++) {
+        while (index < nleaves-row) {
+            fp2copy(R->X, pts[npts]->X);
+            fp2copy(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat[ii++];
+            if (party == ALICE) {
+                xDBLe(R, R, K0, K1, (int)(2*m));
+            } else {
+                xTPLe(R, R, K0, K1, (int)m);
+            }
+            index += m;
+        }
+        if (party == ALICE) {
+            get_4_isog(R, K0, K1, coeff);
+            for (i = 0; i < npts; i++) {
+                eval_4_isog(pts[i], coeff);
+            }
+            eval_4_isog(phiP, coeff);
+            eval_4_isog(phiQ, coeff);
+            eval_4_isog(phiR, coeff);
+        } else {
+            get_3_isog(R, K0, K1, coeff);
+            for (i = 0; i < npts; i++) {
+                eval_3_isog(pts[i], coeff);
+            }
+            eval_3_isog(phiP, coeff);
+            eval_3_isog(phiQ, coeff);
+            eval_3_isog(phiR, coeff);
+        }
+
+        fp2copy(pts[npts-1]->X, R->X);
+        fp2copy(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    return cpucycles() - cycles1;
+}
+
+
+static void traverse_bench(const unsigned int* strat1, const unsigned int* strat2, unsigned int party, unsigned long long* cycles1, unsigned long long* cycles2)
+{ // Benchmarks the traversals with two strategies. The runs are interleaved so that both see the same system load.
+    unsigned long long cycles[2][TRAVERSAL_LOOPS];
+    unsigned int n;
+
+    for (n = 0; n < TRAVERSAL_LOOPS; n++) {
+        cycles[0][n] = traverse(strat1, party);
+        cycles[1][n] = traverse(strat2, party);
+    }
+    *cycles1 = quartile(cycles[0], TRAVERSAL_LOOPS);
+    *cycles2 = quartile(cycles[1], TRAVERSAL_LOOPS);
+}
+
+
+static int print_strategy(char* out, const char* name, const unsigned int* strat, unsigned int len, const char* nl)
+{ // Writes a strategy table in the format of the PXXX.c files, returns the number of characters written
+    int k, line;
+    unsigned int i;
+
+    k = sprintf(out, "const unsigned int %s[%s-1] = { %s", name, (strcmp(name, "strat_Alice") == 0) ? "MAX_Alice" : "MAX_Bob", nl);
+    line = 0;
+    for (i = 0; i < len; i++) {
+        if (i == len-1) {
+            line += sprintf(out + k + line, "%u };", strat[i]);
+        } else {
+            line += sprintf(out + k + line, "%u, ", strat[i]);
+            if (line >= 78) {
+                k += line + sprintf(out + k + line, "%s", nl);
+                line = 0;
+            }
+        }
+    }
+    return k + line;
+}
+
+
+static bool replace_table(char** text, const char* name, const unsigned int* strat, unsigned int len, const char* nl)
+{ // Replaces the initialization of the given table in text
+    char decl[64], *start, *end, *out;
+    size_t n = strlen(*text);
+
+    sprintf(decl, "const unsigned int %s[", name);
+    start = strstr(*text, decl);
+    if (start == NULL) return false;
+    end = strstr(start, "};");
+    if (end == NULL) return false;
+    end += 2;
+
+    out = malloc(n + 8*len + 256);
+    if (out == NULL) return false;
+    memcpy(out, *text, start - *text);
+    n = (start - *text) + print_strategy(out + (start - *text), name, strat, len, nl);
+    strcpy(out + n, end);
+    free(*text);
+    *text = out;
+    return true;
+}
+
+
+static bool write_tables(const char* file, const unsigned int* strat_A, const unsigned int* strat_B)
+{ // Replaces strat_Alice and strat_Bob in the given source file
+    FILE* f;
+    char* text;
+    const char* nl;
+    long size;
+    bool OK = false;
+
+    f = fopen(file, "rb");
+    if (f == NULL) return false;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    text = malloc(size + 1);
+    if (text != NULL && fread(text, 1, size, f) == (size_t)size) {
+        text[size] = 0;
+        OK = true;
+    }
+    fclose(f);
+    if (!OK) goto cleanup;
+
+    nl = (strstr(text, "\r\n") != NULL) ? "\r\n" : "\n";
+    OK = replace_table(&text, "strat_Alice", strat_A, MAX_Alice-1, nl) && replace_table(&text, "strat_Bob", strat_B, MAX_Bob-1, nl);
+    if (!OK) goto cleanup;
+
+    f = fopen(file, "wb");
+    if (f == NULL) {
+        OK = false;
+        goto cleanup;
+    }
+    OK = (fwrite(text, 1, strlen(text), f) == strlen(text));
+    fclose(f);
+
+cleanup:
+    free(text);
+    return OK;
+}
+
+
+int main(int argc, char* argv[])
+{
+    static unsigned int new_Alice[MAX_Alice-1], new_Bob[MAX_Bob-1];
+    static char table[16*MAX_LEAVES];
+    unsigned long long step_A, eval_A, step_B, eval_B, cost, cost_shipped, cycles, cycles_shipped;
+    unsigned int maxpts_A = MAX_INT_POINTS_ALICE, maxpts_B = MAX_INT_POINTS_BOB, pts_shipped;
+    bool write = false;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-a") == 0 && i+1 < argc) {
+            maxpts_A = (unsigned int)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0 && i+1 < argc) {
+            maxpts_B = (unsigned int)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-w") == 0) {
+            write = true;
+        } else {
+            printf("Usage: %s [-a points] [-b points] [-w]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (maxpts_A < 1 || maxpts_B < 1 || maxpts_A > MAX_POINTS || maxpts_B > MAX_POINTS) {
+        printf("The bounds on the number of stored points must be between 1 and %d\n", MAX_POINTS);
+        return 1;
+    }
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Optimal isogeny tree strategies for %s: \n\n", SCHEME_NAME);
+
+    measure_costs(&step_A, &eval_A, &step_B, &eval_B);
+    printf("  Alice: step (2 doublings) %lld, 4-isogeny evaluation %lld ", step_A, eval_A); print_unit;
+    printf("\n  Bob:   step (1 tripling) %lld, 3-isogeny evaluation %lld ", step_B, eval_B); print_unit;
+    printf("\n\n");
+
+    cost = strategy_optimal(MAX_Alice, maxpts_A, step_A, eval_A, new_Alice);
+    cost_shipped = strategy_cost(strat_Alice, MAX_Alice, step_A, eval_A, &pts_shipped);
+    traverse_bench(new_Alice, strat_Alice, ALICE, &cycles, &cycles_shipped);
+    printf("  Alice's generated strategy (%2d points): model %10lld, traversal runs in %10lld ", maxpts_A, cost, cycles); print_unit;
+    printf("\n  Alice's shipped strategy   (%2d points): model %10lld, traversal runs in %10lld ", pts_shipped, cost_shipped, cycles_shipped); print_unit;
+    printf("\n");
+
+    cost = strategy_optimal(MAX_Bob, maxpts_B, step_B, eval_B, new_Bob);
+    cost_shipped = strategy_cost(strat_Bob, MAX_Bob, step_B, eval_B, &pts_shipped);
+    traverse_bench(new_Bob, strat_Bob, BOB, &cycles, &cycles_shipped);
+    printf("  Bob's generated strategy   (%2d points): model %10lld, traversal runs in %10lld ", maxpts_B, cost, cycles); print_unit;
+    printf("\n  Bob's shipped strategy     (%2d points): model %10lld, traversal runs in %10lld ", pts_shipped, cost_shipped, cycles_shipped); print_unit;
+    printf("\n\n");
+
+    print_strategy(table, "strat_Alice", new_Alice, MAX_Alice-1, "\n");
+    printf("%s\n\n", table);
+    print_strategy(table, "strat_Bob", new_Bob, MAX_Bob-1, "\n");
+    printf("%s\n\n", table);
+
+    if (write) {
+        if (maxpts_A > MAX_INT_POINTS_ALICE || maxpts_B > MAX_INT_POINTS_BOB) {
+            printf("  Not writing %s: the bounds exceed MAX_INT_POINTS_ALICE/BOB, raise them in the internal header first\n", STRAT_FILE);
+            return 1;
+        }
+        if (!write_tables(STRAT_FILE, new_Alice, new_Bob)) {
+            printf("  Could not update %s\n", STRAT_FILE);
+            return 1;
+        }
+        printf("  Updated %s\n", STRAT_FILE);
+    }
+
+    return 0;
+}
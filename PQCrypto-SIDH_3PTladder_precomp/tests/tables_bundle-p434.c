@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp434/SIKEp434
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P434/P434.c"
+
+
+#define TABLES_NAME    "p434"
+
+#include "tables_bundle.c"
@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp434_compressed/SIKEp434_compressed
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P434/P434_compressed.c"
+
+
+#define TABLES_NAME    "p434_compressed"
+
+#include "tables_bundle.c"
@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp503/SIKEp503
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P503/P503.c"
+
+
+#define TABLES_NAME    "p503"
+
+#include "tables_bundle.c"
@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp503_compressed/SIKEp503_compressed
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P503/P503_compressed.c"
+
+
+#define TABLES_NAME    "p503_compressed"
+
+#include "tables_bundle.c"
@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp610/SIKEp610
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P610/P610.c"
+
+
+#define TABLES_NAME    "p610"
+
+#include "tables_bundle.c"
@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp610_compressed/SIKEp610_compressed
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P610/P610_compressed.c"
+
+
+#define TABLES_NAME    "p610_compressed"
+
+#include "tables_bundle.c"
@@ -0,0 +1,13 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of the table bundle of SIDHp751_compressed/SIKEp751_compressed
+*********************************************************************************************/ 
+
+#undef TABLE_BUNDLE                    // The tables are compiled into this program
+#include "../src/P751/P751_compressed.c"
+
+
+#define TABLES_NAME    "p751_compressed"
+
+#include "tables_bundle.c"
@@ -0,0 +1,109 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: generation of table bundles
+*           Writes the tables in TABLE_BUNDLE_LIST, as compiled into this program, to a bundle file (see src/tables.h)
+*           that the library built with TABLE_BUNDLE loads at runtime with tables_load()
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "../src/tables.h"
+
+#if defined(COMPRESS)
+    #define TABLES_COMPRESSED   1
+#else
+    #define TABLES_COMPRESSED   0
+#endif
+
+typedef struct {
+    const char* name;
+    const uint64_t* table;
+    uint64_t nwords;
+} bundle_table_t;
+
+#define BUNDLE_TABLE(name, nwords)    { #name, name, nwords },
+
+static const bundle_table_t bundle_tables[] = { TABLE_BUNDLE_LIST(BUNDLE_TABLE) { NULL, NULL, 0 } };
+
+
+static uint64_t bundle_align(uint64_t offset)
+{ // Rounds offset up to a multiple of TABLES_ALIGN
+
+    return (offset + TABLES_ALIGN - 1) & ~(uint64_t)(TABLES_ALIGN - 1);
+}
+
+
+static int bundle_pad(FILE* fp, uint64_t* pos, uint64_t offset)
+{ // Writes zeros from the current position up to offset
+    static const unsigned char zero[TABLES_ALIGN] = {0};
+    size_t n = (size_t)(offset - *pos);
+
+    if (n > 0 && fwrite(zero, 1, n, fp) != n) return 1;
+    *pos = offset;
+    return 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+    tables_header_t header;
+    tables_entry_t entry;
+    uint64_t offset, pos = 0;
+    unsigned int i, count = 0;
+    FILE* fp;
+
+    if (argc != 2) {
+        printf("\n  Usage: %s <file>\n", argv[0]);
+        printf("  Writes the table bundle of the %s library to <file>\n\n", TABLES_NAME);
+        return 1;
+    }
+    while (bundle_tables[count].name != NULL) {
+        if (strlen(bundle_tables[count].name) >= TABLES_NAME_BYTES) {
+            printf("\n  Table name %s is too long\n\n", bundle_tables[count].name);
+            return 1;
+        }
+        count++;
+    }
+    if ((fp = fopen(argv[1], "wb")) == NULL) {
+        printf("\n  Couldn't open <%s> for write\n\n", argv[1]);
+        return 1;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TABLES_MAGIC, sizeof(header.magic));
+    header.version = TABLES_VERSION;
+    header.nbits_field = NBITS_FIELD;
+    header.compressed = TABLES_COMPRESSED;
+    header.count = count;
+    if (fwrite(&header, sizeof(header), 1, fp) != 1) goto error;
+    pos += sizeof(header);
+
+    offset = bundle_align(sizeof(header) + count*sizeof(entry));
+    for (i = 0; i < count; i++) {
+        memset(&entry, 0, sizeof(entry));
+        strcpy(entry.name, bundle_tables[i].name);
+        entry.offset = offset;
+        entry.nwords = bundle_tables[i].nwords;
+        if (fwrite(&entry, sizeof(entry), 1, fp) != 1) goto error;
+        pos += sizeof(entry);
+        offset = bundle_align(offset + entry.nwords*sizeof(uint64_t));
+    }
+
+    for (i = 0; i < count; i++) {
+        if (bundle_pad(fp, &pos, bundle_align(pos)) != 0) goto error;
+        if (fwrite(bundle_tables[i].table, sizeof(uint64_t), (size_t)bundle_tables[i].nwords, fp) != bundle_tables[i].nwords) goto error;
+        pos += bundle_tables[i].nwords*sizeof(uint64_t);
+    }
+    if (fclose(fp) != 0) {
+        printf("\n  Error writing <%s>\n\n", argv[1]);
+        return 1;
+    }
+    printf("  %s: %u tables, %llu bytes\n", argv[1], count, (unsigned long long)pos);
+    return 0;
+
+error:
+    fclose(fp);
+    printf("\n  Error writing <%s>\n\n", argv[1]);
+    return 1;
+}
@@ -11,6 +11,7 @@
 
 
 #define SCHEME_NAME    "SIDHp434"
+#define TABLES_FILE    "lib434/p434.tables"
 
 #define random_mod_order_A            random_mod_order_A_SIDHp434
 #define random_mod_order_B            random_mod_order_B_SIDHp434
@@ -18,5 +19,17 @@
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp434
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp434
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp434
+#define tables_load                   tables_load_p434
+#define sidh_set_ladder               sidh_set_ladder_p434
+#define sidh_get_ladder               sidh_get_ladder_p434
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp434
+#define EphemeralKeyGeneration_B_ladder EphemeralKeyGeneration_B_ladder_SIDHp434
+#define sidh_opcount                  sidh_opcount_p434
+#define sidh_workers_stop             sidh_workers_stop_p434
+#define keypool_start                 keypool_start_p434
+#define keypool_stop                  keypool_stop_p434
+#define keypool_stats                 keypool_stats_p434
+#define EphemeralKeyPair_A_pooled     EphemeralKeyPair_A_pooled_SIDHp434
+#define EphemeralKeyPair_B_pooled     EphemeralKeyPair_B_pooled_SIDHp434
 
 #include "test_sidh.c"
\ No newline at end of file
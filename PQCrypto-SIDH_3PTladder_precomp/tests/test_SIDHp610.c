@@ -11,6 +11,7 @@
 
 
 #define SCHEME_NAME    "SIDHp610"
+#define TABLES_FILE    "lib610/p610.tables"
 
 #define random_mod_order_A            random_mod_order_A_SIDHp610
 #define random_mod_order_B            random_mod_order_B_SIDHp610
@@ -18,5 +19,17 @@
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp610
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp610
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp610
+#define tables_load                   tables_load_p610
+#define sidh_set_ladder               sidh_set_ladder_p610
+#define sidh_get_ladder               sidh_get_ladder_p610
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp610
+#define EphemeralKeyGeneration_B_ladder EphemeralKeyGeneration_B_ladder_SIDHp610
+#define sidh_opcount                  sidh_opcount_p610
+#define sidh_workers_stop             sidh_workers_stop_p610
+#define keypool_start                 keypool_start_p610
+#define keypool_stop                  keypool_stop_p610
+#define keypool_stats                 keypool_stats_p610
+#define EphemeralKeyPair_A_pooled     EphemeralKeyPair_A_pooled_SIDHp610
+#define EphemeralKeyPair_B_pooled     EphemeralKeyPair_B_pooled_SIDHp610
 
 #include "test_sidh.c"
\ No newline at end of file
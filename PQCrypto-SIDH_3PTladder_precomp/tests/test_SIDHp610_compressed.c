@@ -11,6 +11,7 @@
 
 
 #define SCHEME_NAME    "SIDHp610_compressed"
+#define TABLES_FILE    "lib610comp/p610_compressed.tables"
 
 #define random_mod_order_A            random_mod_order_A_SIDHp610
 #define random_mod_order_B            random_mod_order_B_SIDHp610
@@ -18,5 +19,14 @@
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp610_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp610_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp610_Compressed
+#define tables_load                   tables_load_p610_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp610_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp610_Compressed
+#define sidh_workspace_size           sidh_workspace_size_p610_compressed
+#define sidh_set_checkpoint           sidh_set_checkpoint_p610_compressed
+#define sidh_get_checkpoint           sidh_get_checkpoint_p610_compressed
+#define sidh_set_dlog_threads         sidh_set_dlog_threads_p610_compressed
+#define sidh_get_dlog_threads         sidh_get_dlog_threads_p610_compressed
+#define sidh_workers_stop             sidh_workers_stop_p610_compressed
 
 #include "test_sidh.c"
\ No newline at end of file
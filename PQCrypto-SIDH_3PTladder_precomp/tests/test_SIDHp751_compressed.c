@@ -11,6 +11,7 @@
 
 
 #define SCHEME_NAME    "SIDHp751_compressed"
+#define TABLES_FILE    "lib751comp/p751_compressed.tables"
 
 #define random_mod_order_A            random_mod_order_A_SIDHp751
 #define random_mod_order_B            random_mod_order_B_SIDHp751
@@ -18,5 +19,14 @@
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp751_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp751_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751_Compressed
+#define tables_load                   tables_load_p751_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp751_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp751_Compressed
+#define sidh_workspace_size           sidh_workspace_size_p751_compressed
+#define sidh_set_checkpoint           sidh_set_checkpoint_p751_compressed
+#define sidh_get_checkpoint           sidh_get_checkpoint_p751_compressed
+#define sidh_set_dlog_threads         sidh_set_dlog_threads_p751_compressed
+#define sidh_get_dlog_threads         sidh_get_dlog_threads_p751_compressed
+#define sidh_workers_stop             sidh_workers_stop_p751_compressed
 
 #include "test_sidh.c"
\ No newline at end of file
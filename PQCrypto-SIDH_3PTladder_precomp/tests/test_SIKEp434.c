@@ -11,9 +11,28 @@
 
 
 #define SCHEME_NAME    "SIKEp434"
+#define TABLES_FILE    "lib434/p434.tables"
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp434
 #define crypto_kem_enc                crypto_kem_enc_SIKEp434
 #define crypto_kem_dec                crypto_kem_dec_SIKEp434
+#define crypto_kem_keypair_x8         crypto_kem_keypair_x8_SIKEp434
+#define crypto_kem_enc_x8             crypto_kem_enc_x8_SIKEp434
+#define crypto_kem_dec_x8             crypto_kem_dec_x8_SIKEp434
+#define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp434
+#define random_mod_order_A            random_mod_order_A_SIDHp434
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp434
+#define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp434
+#define EphemeralKeyGenerationAgreement_A EphemeralKeyGenerationAgreement_A_SIDHp434
+#define crypto_kem_enc_concurrent     crypto_kem_enc_concurrent_SIKEp434
+#define crypto_kem_keypair_ladder     crypto_kem_keypair_ladder_SIKEp434
+#define crypto_kem_enc_ladder         crypto_kem_enc_ladder_SIKEp434
+#define crypto_kem_dec_ladder         crypto_kem_dec_ladder_SIKEp434
+#define sidh_get_ladder               sidh_get_ladder_p434
+#define tables_load                   tables_load_p434
+#define keypool_start                 keypool_start_p434
+#define keypool_stop                  keypool_stop_p434
+#define keypool_stats                 keypool_stats_p434
+#define crypto_kem_keypair_pooled     crypto_kem_keypair_pooled_SIKEp434
 
 #include "test_sike.c"
\ No newline at end of file
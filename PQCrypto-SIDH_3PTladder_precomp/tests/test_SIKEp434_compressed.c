@@ -11,9 +11,14 @@
 
 
 #define SCHEME_NAME    "SIKEp434_compressed"
+#define TABLES_FILE    "lib434comp/p434_compressed.tables"
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp434_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp434_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp434_compressed
+#define tables_load                   tables_load_p434_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp434_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp434_compressed
+#define sidh_workspace_size           sidh_workspace_size_p434_compressed
 
 #include "test_sike.c"
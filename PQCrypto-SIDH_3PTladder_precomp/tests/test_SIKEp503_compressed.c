@@ -11,9 +11,14 @@
 
 
 #define SCHEME_NAME    "SIKEp503_compressed"
+#define TABLES_FILE    "lib503comp/p503_compressed.tables"
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp503_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp503_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp503_compressed
+#define tables_load                   tables_load_p503_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp503_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp503_compressed
+#define sidh_workspace_size           sidh_workspace_size_p503_compressed
 
 #include "test_sike.c"
@@ -11,9 +11,28 @@
 
 
 #define SCHEME_NAME    "SIKEp610"
+#define TABLES_FILE    "lib610/p610.tables"
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610
+#define crypto_kem_keypair_x8         crypto_kem_keypair_x8_SIKEp610
+#define crypto_kem_enc_x8             crypto_kem_enc_x8_SIKEp610
+#define crypto_kem_dec_x8             crypto_kem_dec_x8_SIKEp610
+#define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp610
+#define random_mod_order_A            random_mod_order_A_SIDHp610
+#define EphemeralKeyGeneration_A_ladder EphemeralKeyGeneration_A_ladder_SIDHp610
+#define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp610
+#define EphemeralKeyGenerationAgreement_A EphemeralKeyGenerationAgreement_A_SIDHp610
+#define crypto_kem_enc_concurrent     crypto_kem_enc_concurrent_SIKEp610
+#define crypto_kem_keypair_ladder     crypto_kem_keypair_ladder_SIKEp610
+#define crypto_kem_enc_ladder         crypto_kem_enc_ladder_SIKEp610
+#define crypto_kem_dec_ladder         crypto_kem_dec_ladder_SIKEp610
+#define sidh_get_ladder               sidh_get_ladder_p610
+#define tables_load                   tables_load_p610
+#define keypool_start                 keypool_start_p610
+#define keypool_stop                  keypool_stop_p610
+#define keypool_stats                 keypool_stats_p610
+#define crypto_kem_keypair_pooled     crypto_kem_keypair_pooled_SIKEp610
 
 #include "test_sike.c"
\ No newline at end of file
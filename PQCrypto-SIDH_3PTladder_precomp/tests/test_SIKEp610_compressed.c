@@ -11,9 +11,14 @@
 
 
 #define SCHEME_NAME    "SIKEp610_compressed"
+#define TABLES_FILE    "lib610comp/p610_compressed.tables"
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610_compressed
+#define tables_load                   tables_load_p610_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp610_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp610_compressed
+#define sidh_workspace_size           sidh_workspace_size_p610_compressed
 
 #include "test_sike.c"
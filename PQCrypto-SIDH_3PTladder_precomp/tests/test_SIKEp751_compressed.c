@@ -11,9 +11,14 @@
 
 
 #define SCHEME_NAME    "SIKEp751_compressed"
+#define TABLES_FILE    "lib751comp/p751_compressed.tables"
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751_compressed
+#define tables_load                   tables_load_p751_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp751_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp751_compressed
+#define sidh_workspace_size           sidh_workspace_size_p751_compressed
 
 #include "test_sike.c"
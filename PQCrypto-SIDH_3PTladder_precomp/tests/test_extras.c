@@ -11,6 +11,10 @@
 #if (OS_TARGET == OS_NIX) && (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
     #include <time.h>
 #endif
+#if (OS_TARGET == OS_NIX)
+    #include <pthread.h>
+    #include <string.h>
+#endif
 #include <stdlib.h>
 
 
@@ -187,4 +191,45 @@ void fp2random751_test(digit_t* a)
 
     fprandom751_test(a);
     fprandom751_test(a+NBITS_TO_NWORDS(751));
-}
\ No newline at end of file
+}
+
+
+#if (OS_TARGET == OS_NIX)
+#define STACK_PAINT    0xA5
+
+typedef struct {
+    void (*fn)(void*);
+    void* arg;
+} stack_job_t;
+
+
+static void* stack_job(void* job)
+{
+    ((stack_job_t*)job)->fn(((stack_job_t*)job)->arg);
+    return NULL;
+}
+
+
+size_t stack_usage(void (*fn)(void*), void* arg, size_t stack_bytes)
+{ // Runs fn(arg) on a thread with a stack of stack_bytes filled with a pattern, and returns the bytes of that stack written by 
+  // the thread, including the thread descriptor and thread-local storage that the C library places on it. Returns 0 on error.
+    pthread_attr_t attr;
+    pthread_t thread;
+    stack_job_t job = { fn, arg };
+    unsigned char* stack;
+    size_t i = 0;
+
+    if (posix_memalign((void**)&stack, 4096, stack_bytes) != 0) return 0;
+    memset(stack, STACK_PAINT, stack_bytes);
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstack(&attr, stack, stack_bytes) == 0 && pthread_create(&thread, &attr, stack_job, &job) == 0) {
+        pthread_join(thread, NULL);
+        while (i < stack_bytes && stack[i] == STACK_PAINT) i++;    // The stack grows down from stack + stack_bytes
+    } else {
+        i = stack_bytes;
+    }
+    pthread_attr_destroy(&attr);
+    free(stack);
+    return stack_bytes - i;
+}
+#endif
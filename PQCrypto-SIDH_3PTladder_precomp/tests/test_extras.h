@@ -50,5 +50,10 @@ void fprandom751_test(digit_t* a);
 // Generating a pseudo-random element in GF(p751^2)
 void fp2random751_test(digit_t* a);
 
+#if (OS_TARGET == OS_NIX)
+// Runs fn(arg) on a thread with a stack of stack_bytes and returns the peak stack usage in bytes, or 0 on error
+size_t stack_usage(void (*fn)(void*), void* arg, size_t stack_bytes);
+#endif
+
 
 #endif
\ No newline at end of file
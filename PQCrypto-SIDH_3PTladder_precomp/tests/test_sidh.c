@@ -14,6 +14,32 @@
     #define TEST_LOOPS        10      
 #endif
 
+#if defined(WORKSPACE_KEYGEN_A) && (OS_TARGET == OS_NIX)
+    #include <stdlib.h>
+    #define STACK_BYTES      (1 << 20)      // Stack of the threads of the stack usage tests
+    #define STACK_LIMIT_WS   (48 << 10)     // Largest stack usage accepted for the functions with a workspace
+#endif
+
+#if defined(CHECKPOINT_NONE) && (OS_TARGET == OS_NIX)
+    #define CHECKPOINT_TESTS       3      // Private keys per checkpoint interval of the tests
+    #define CHECKPOINT_LOOPS      10      // Iterations per checkpoint interval of the benchmark
+    static const unsigned int checkpoints[] = { CHECKPOINT_NONE, 2, 3, 5, 8, 12, 16, 24, 32 };
+    #define NCHECKPOINTS    (sizeof(checkpoints)/sizeof(checkpoints[0]))
+#endif
+
+#if defined(KEYPOOL_SIDH_A) && defined(_PARALLEL_)
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <unistd.h>
+    #define KEYPOOL_STARTERS       4      // Threads starting and stopping the same pool
+    #define KEYPOOL_RACES         20      // Starts and stops per thread
+#endif
+
+#if defined(DLOG_THREADS_MAX)
+    #define DLOG_TESTS             3      // Private keys per number of threads of the tests
+    #define DLOG_LOOPS            10      // Iterations per number of threads of the benchmark
+#endif
+
 
 int cryptotest_kex()
 { // Testing key exchange
@@ -50,6 +76,530 @@ int cryptotest_kex()
 }
 
 
+#ifdef sidh_workers_stop
+int cryptotest_workers()
+{ // Testing that the key exchange still agrees after the worker threads are joined, which the next operations start again
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS && passed == true; i++) 
+    {
+        if (sidh_workers_stop() != 0) passed = false;                                 // No job runs between two key exchanges
+
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA);
+        EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA, SharedSecretB);
+        
+        if (memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0) {
+            passed = false;
+        }
+    }
+    if (sidh_workers_stop() != 0 || sidh_workers_stop() != 0) passed = false;      // Stopping a stopped pool does nothing
+
+    if (passed == true) printf("  Worker pool restart tests .................................... PASSED");
+    else { printf("  Worker pool restart tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
+#ifdef SIDH_LADDER_AUTO
+int cryptotest_ladders()
+{ // Testing that both key generation engines compute the same public keys, selected for the process or for a single call
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char PublicKeyA_M[SIDH_PUBLICKEYBYTES], PublicKeyB_M[SIDH_PUBLICKEYBYTES];
+    unsigned int ladder = sidh_get_ladder();
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        sidh_set_ladder(SIDH_LADDER_3PT);
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        sidh_set_ladder(SIDH_LADDER_MONTGOMERY);
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA_M);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB_M);
+        
+        if (memcmp(PublicKeyA, PublicKeyA_M, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyB_M, SIDH_PUBLICKEYBYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // The engine of a single call, the engine of the process stays the Montgomery ladder
+        if (EphemeralKeyGeneration_A_ladder(PrivateKeyA, PublicKeyA_M, SIDH_LADDER_3PT) != 0 || 
+            EphemeralKeyGeneration_B_ladder(PrivateKeyB, PublicKeyB_M, SIDH_LADDER_3PT) != 0 || 
+            memcmp(PublicKeyA, PublicKeyA_M, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyB_M, SIDH_PUBLICKEYBYTES) != 0 || 
+            sidh_get_ladder() != SIDH_LADDER_MONTGOMERY) {
+            passed = false;
+            break;
+        }
+        sidh_set_ladder(SIDH_LADDER_3PT);
+        if (EphemeralKeyGeneration_A_ladder(PrivateKeyA, PublicKeyA_M, SIDH_LADDER_MONTGOMERY) != 0 || 
+            EphemeralKeyGeneration_B_ladder(PrivateKeyB, PublicKeyB_M, SIDH_LADDER_AUTO) != 0 || 
+            memcmp(PublicKeyA, PublicKeyA_M, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyB_M, SIDH_PUBLICKEYBYTES) != 0 || 
+            sidh_get_ladder() != SIDH_LADDER_3PT) {
+            passed = false;
+            break;
+        }
+        sidh_set_ladder(SIDH_LADDER_MONTGOMERY);
+    }
+    if (sidh_get_ladder() != SIDH_LADDER_MONTGOMERY || sidh_set_ladder(SIDH_LADDER_DEFAULT) == 0) passed = false;
+    if (EphemeralKeyGeneration_A_ladder(PrivateKeyA, PublicKeyA_M, SIDH_LADDER_DEFAULT+1) == 0 || 
+        EphemeralKeyGeneration_B_ladder(PrivateKeyB, PublicKeyB_M, SIDH_LADDER_DEFAULT+1) == 0) passed = false;
+
+    if (passed == true) printf("  Key generation engine tests .................................. PASSED");
+    else { printf("  Key generation engine tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+    sidh_set_ladder(SIDH_LADDER_AUTO);     // Explicit request, times both engines
+    printf("  Key generation engine on this host ........................... %s\n", (sidh_get_ladder() == SIDH_LADDER_MONTGOMERY) ? "Montgomery ladder" : "3-point ladder");
+    sidh_set_ladder(ladder);
+
+    return PASSED;
+}
+#endif
+
+
+#ifdef SIDH_OP_KEYGEN_A
+int cryptotest_opcount()
+{ // Testing the operation counts: the key exchange runs in constant time, so two runs with different keys must count the same operations
+    unsigned int i, op;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    sidh_opcount_t count[2][4];
+    unsigned int ladder = sidh_get_ladder();
+    bool passed = true;
+
+    sidh_set_ladder(SIDH_LADDER_3PT);
+    for (i = 0; i < 2; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA);
+        EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA, SharedSecretB);
+        for (op = SIDH_OP_KEYGEN_A; op <= SIDH_OP_AGREEMENT_B; op++) {
+            if (sidh_opcount(op, &count[i][op]) != 0) passed = false;
+        }
+    }
+    sidh_set_ladder(ladder);
+
+    if (memcmp(count[0], count[1], sizeof(count[0])) != 0 || sidh_opcount(SIKE_OP_DEC+1, &count[0][0]) == 0) passed = false;
+    for (op = SIDH_OP_KEYGEN_A; op <= SIDH_OP_AGREEMENT_B; op++) {
+        if (count[1][op].mul == 0 || count[1][op].rdc == 0 || count[1][op].add == 0 || count[1][op].sub == 0 || count[1][op].inv == 0) passed = false;
+    }
+    if (count[1][SIDH_OP_KEYGEN_A].eval_4_isog == 0 || count[1][SIDH_OP_AGREEMENT_A].get_4_isog == 0 || count[1][SIDH_OP_KEYGEN_A].xtpl != 1) passed = false;
+    if (count[1][SIDH_OP_KEYGEN_B].eval_3_isog == 0 || count[1][SIDH_OP_AGREEMENT_B].get_3_isog == 0 || count[1][SIDH_OP_KEYGEN_B].get_4_isog != 0) passed = false;
+
+    if (passed == true) printf("  Operation count tests ........................................ PASSED");
+    else { printf("  Operation count tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+    printf("  Alice's key generation counts ................................ %llu mul, %llu sqr, %llu rdc, %llu add, %llu sub\n", 
+           count[1][SIDH_OP_KEYGEN_A].mul, count[1][SIDH_OP_KEYGEN_A].sqr, count[1][SIDH_OP_KEYGEN_A].rdc, count[1][SIDH_OP_KEYGEN_A].add, count[1][SIDH_OP_KEYGEN_A].sub);
+    printf("  Bob's key generation counts .................................. %llu mul, %llu sqr, %llu rdc, %llu add, %llu sub\n", 
+           count[1][SIDH_OP_KEYGEN_B].mul, count[1][SIDH_OP_KEYGEN_B].sqr, count[1][SIDH_OP_KEYGEN_B].rdc, count[1][SIDH_OP_KEYGEN_B].add, count[1][SIDH_OP_KEYGEN_B].sub);
+
+    return PASSED;
+}
+#endif
+
+
+#ifdef KEYPOOL_SIDH_A
+static bool keypool_pair_valid(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyA, const unsigned char* PrivateKeyB, const unsigned char* PublicKeyB)
+{ // Alice's and Bob's pairs must agree on the shared secret
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+
+    EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA);
+    EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA, SharedSecretB);
+    return memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) == 0;
+}
+
+
+#if defined(_PARALLEL_)
+typedef struct {
+    const unsigned char* PrivateKeyB;      // Bob's pair the pairs taken from KEYPOOL_SIDH_A are checked against
+    const unsigned char* PublicKeyB;
+    atomic_uint count;                     // Pairs taken
+    atomic_int stop;
+    bool passed;
+} keypool_taker_t;
+
+
+static void* keypool_taker(void* arg)
+{ // Takes Alice's pairs until stopped, while the pool is stopped under it
+    keypool_taker_t* T = (keypool_taker_t*)arg;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PublicKeyA[SIDH_PUBLICKEYBYTES];
+
+    while (!atomic_load(&T->stop)) {
+        EphemeralKeyPair_A_pooled(PrivateKeyA, PublicKeyA);
+        if (!keypool_pair_valid(PrivateKeyA, PublicKeyA, T->PrivateKeyB, T->PublicKeyB)) T->passed = false;
+        atomic_fetch_add(&T->count, 1);
+    }
+    return NULL;
+}
+
+
+static void* keypool_starter(void* arg)
+{ // Starts and stops Bob's pool, racing with the other starters
+    atomic_int* started = (atomic_int*)arg;
+    unsigned int i;
+
+    for (i = 0; i < KEYPOOL_RACES; i++) {
+        if (keypool_start(KEYPOOL_SIDH_B, 1, 2, 1) == 0) atomic_fetch_add(started, 1);
+        keypool_stop(KEYPOOL_SIDH_B);
+    }
+    return NULL;
+}
+#endif
+
+
+int cryptotest_keypool()
+{ // Testing Alice's and Bob's key pair pools: the pooled pairs must be valid and, with _PARALLEL_, served from the pools once they 
+  // are filled. Stopping a pool must wait for the pooled key generations in flight, and concurrent starts and stops must not clash.
+    unsigned int i, pool, ready[2] = {0};
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned long long hits = 0, misses = 0;
+    bool passed = true;
+
+    if (keypool_start(KEYPOOL_SIDH_A, 2, 1, 1) == 0 || keypool_start(KEYPOOL_SIDH_B, 1, 2, KEYPOOL_MAX_THREADS+1) == 0) passed = false;
+#if defined(_PARALLEL_)
+    if (keypool_start(KEYPOOL_SIDH_A, 1, TEST_LOOPS, 1) != 0 || keypool_start(KEYPOOL_SIDH_B, 1, TEST_LOOPS, 1) != 0) passed = false;
+    for (i = 0; i < 6000 && (ready[0] < TEST_LOOPS || ready[1] < TEST_LOOPS); i++) {      // Waits up to a minute for the pools to be filled
+        usleep(10000);
+        keypool_stats(KEYPOOL_SIDH_A, &hits, &misses, &ready[0]);
+        keypool_stats(KEYPOOL_SIDH_B, &hits, &misses, &ready[1]);
+    }
+    if (sidh_workers_stop() != -1) passed = false;                                  // The workers of the pools are busy
+#endif
+
+    for (i = 0; i < TEST_LOOPS && passed == true; i++) 
+    {
+        EphemeralKeyPair_A_pooled(PrivateKeyA, PublicKeyA);
+        EphemeralKeyPair_B_pooled(PrivateKeyB, PublicKeyB);
+        if (!keypool_pair_valid(PrivateKeyA, PublicKeyA, PrivateKeyB, PublicKeyB)) passed = false;
+    }
+    keypool_stop(KEYPOOL_SIDH_A);
+    keypool_stop(KEYPOOL_SIDH_B);
+    if (sidh_workers_stop() != 0) passed = false;
+
+    for (pool = KEYPOOL_SIDH_A; pool <= KEYPOOL_SIDH_B; pool++) {
+        if (keypool_stats(pool, &hits, &misses, &ready[0]) != 0 || hits + misses != TEST_LOOPS || ready[0] != 0) passed = false;
+#if defined(_PARALLEL_)
+        if (hits != TEST_LOOPS) passed = false;
+#else
+        if (hits != 0) passed = false;
+#endif
+    }
+
+#if defined(_PARALLEL_)
+    {
+        keypool_taker_t taker = { PrivateKeyB, PublicKeyB };
+        pthread_t thread;
+
+        atomic_init(&taker.count, 0);
+        atomic_init(&taker.stop, 0);
+        taker.passed = true;
+        if (keypool_start(KEYPOOL_SIDH_A, 1, 2, 1) != 0 || pthread_create(&thread, NULL, keypool_taker, &taker) != 0) {
+            passed = false;
+        } else {
+            for (i = 0; i < 6000 && atomic_load(&taker.count) == 0; i++) usleep(10000);
+            keypool_stop(KEYPOOL_SIDH_A);                               // Races with the pooled key generations of the taker
+            atomic_store(&taker.stop, 1);
+            pthread_join(thread, NULL);
+            if (!taker.passed || atomic_load(&taker.count) == 0) passed = false;
+        }
+        keypool_stop(KEYPOOL_SIDH_A);
+    }
+    {
+        pthread_t threads[KEYPOOL_STARTERS];
+        atomic_int started;
+        unsigned int n = 0;
+
+        atomic_init(&started, 0);
+        for (i = 0; i < KEYPOOL_STARTERS; i++) {
+            if (pthread_create(&threads[n], NULL, keypool_starter, &started) == 0) n++;
+        }
+        for (i = 0; i < n; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        keypool_stats(KEYPOOL_SIDH_B, &hits, &misses, &ready[0]);
+        if (n != KEYPOOL_STARTERS || atomic_load(&started) == 0 || ready[0] != 0) passed = false;
+        if (keypool_start(KEYPOOL_SIDH_B, 1, 2, 1) != 0) passed = false;           // Left idle by the last stop
+        keypool_stop(KEYPOOL_SIDH_B);
+        if (sidh_workers_stop() != 0) passed = false;
+    }
+#endif
+
+    if (passed == true) printf("  Key pair pool tests .......................................... PASSED");
+    else { printf("  Key pair pool tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
+#if defined(WORKSPACE_KEYGEN_A) && (OS_TARGET == OS_NIX)
+typedef struct {
+    unsigned int op;                       // WORKSPACE_KEYGEN_A or WORKSPACE_KEYGEN_B
+    const unsigned char* PrivateKey;
+    unsigned char* PublicKey;
+    void* workspace;                       // NULL to run the function without workspace
+    unsigned int size;                     // Bytes of the workspace
+    int status;
+} keygen_job_t;
+
+
+static void keygen_job(void* arg)
+{
+    keygen_job_t* job = (keygen_job_t*)arg;
+
+    if (job->op == WORKSPACE_KEYGEN_A) {
+        if (job->workspace == NULL) job->status = EphemeralKeyGeneration_A(job->PrivateKey, job->PublicKey);
+        else job->status = EphemeralKeyGeneration_A_ws(job->PrivateKey, job->PublicKey, job->workspace, job->size);
+    } else {
+        if (job->workspace == NULL) job->status = EphemeralKeyGeneration_B(job->PrivateKey, job->PublicKey);
+        else job->status = EphemeralKeyGeneration_B_ws(job->PrivateKey, job->PublicKey, job->workspace, job->size);
+    }
+}
+
+
+int cryptotest_workspace()
+{ // Testing the key generations with a workspace: same public keys as without it, on a stack of at most STACK_LIMIT_WS bytes
+    unsigned int op;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKey[SIDH_PUBLICKEYBYTES], PublicKey_ws[SIDH_PUBLICKEYBYTES];
+    size_t stack[2][2] = {0}, size;
+    unsigned char* workspace;
+    keygen_job_t job;
+    bool passed = true;
+
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    for (op = WORKSPACE_KEYGEN_A; op <= WORKSPACE_KEYGEN_B && passed == true; op++) {
+        size = sidh_workspace_size(op);
+        if (size == 0 || posix_memalign((void**)&workspace, WORKSPACE_ALIGN, size) != 0) {
+            passed = false;
+            break;
+        }
+        job.op = op;
+        job.PrivateKey = (op == WORKSPACE_KEYGEN_A) ? PrivateKeyA : PrivateKeyB;
+
+        job.PublicKey = PublicKey;
+        job.workspace = NULL;
+        stack[op][0] = stack_usage(keygen_job, &job, STACK_BYTES);
+        if (job.status != 0) passed = false;
+
+        job.PublicKey = PublicKey_ws;
+        job.workspace = workspace;
+        job.size = (unsigned int)size;
+        stack[op][1] = stack_usage(keygen_job, &job, STACK_BYTES);
+        if (job.status != 0 || memcmp(PublicKey, PublicKey_ws, SIDH_PUBLICKEYBYTES) != 0) passed = false;
+        if (stack[op][1] == 0 || stack[op][1] > STACK_LIMIT_WS) passed = false;
+
+        job.workspace = workspace + 8;     // Misaligned, rejected before it is used
+        keygen_job(&job);
+        if (job.status != -1) passed = false;
+        job.workspace = workspace;         // Too small, rejected before it is used
+        job.size = (unsigned int)size - 1;
+        keygen_job(&job);
+        if (job.status != -1) passed = false;
+        free(workspace);
+    }
+    if (sidh_workspace_size(WORKSPACE_KEM_ENC+1) != 0) passed = false;
+
+    if (passed == true) printf("  Workspace tests .............................................. PASSED");
+    else { printf("  Workspace tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+    printf("  Alice's key generation stack usage ........................... %zu bytes, %zu bytes with a workspace of %u bytes\n", 
+           stack[WORKSPACE_KEYGEN_A][0], stack[WORKSPACE_KEYGEN_A][1], sidh_workspace_size(WORKSPACE_KEYGEN_A));
+    printf("  Bob's key generation stack usage ............................. %zu bytes, %zu bytes with a workspace of %u bytes\n", 
+           stack[WORKSPACE_KEYGEN_B][0], stack[WORKSPACE_KEYGEN_B][1], sidh_workspace_size(WORKSPACE_KEYGEN_B));
+
+    return PASSED;
+}
+#endif
+
+
+#if defined(CHECKPOINT_NONE) && (OS_TARGET == OS_NIX)
+static unsigned char* checkpoint_workspace(unsigned int k, unsigned int* size)
+{ // Workspace of size bytes of Alice's key generation with checkpoint interval k, which becomes the current one
+    unsigned char* workspace;
+
+    if (sidh_set_checkpoint(k) != 0) return NULL;
+    *size = sidh_workspace_size(WORKSPACE_KEYGEN_A);
+    if (posix_memalign((void**)&workspace, WORKSPACE_ALIGN, *size) != 0) return NULL;
+    return workspace;
+}
+
+
+int cryptotest_checkpoints()
+{ // Testing Alice's key generation with checkpoints: same public keys with every interval, with and without workspace
+    unsigned int i, n, size, k = sidh_get_checkpoint();
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyA_ck[SIDH_PUBLICKEYBYTES], PublicKeyA_ws[SIDH_PUBLICKEYBYTES];
+    unsigned char* workspace;
+    bool passed = true;
+
+    if (sidh_set_checkpoint(1) != -1 || sidh_set_checkpoint(1000) != -1 || sidh_get_checkpoint() != k) passed = false;
+
+    for (n = 0; n < CHECKPOINT_TESTS && passed == true; n++) {
+        random_mod_order_A(PrivateKeyA);
+        sidh_set_checkpoint(CHECKPOINT_NONE);
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+
+        for (i = 1; i < NCHECKPOINTS; i++) {
+            workspace = checkpoint_workspace(checkpoints[i], &size);
+            if (workspace == NULL) {
+                passed = false;
+                break;
+            }
+            EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA_ck);
+            if (EphemeralKeyGeneration_A_ws(PrivateKeyA, PublicKeyA_ws, workspace, size) != 0) passed = false;
+            sidh_set_checkpoint(CHECKPOINT_NONE);    // The whole path does not fit in the workspace sized for checkpoints[i]
+            if (EphemeralKeyGeneration_A_ws(PrivateKeyA, PublicKeyA_ck, workspace, size) != -1) passed = false;
+            free(workspace);
+            if (memcmp(PublicKeyA, PublicKeyA_ck, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyA, PublicKeyA_ws, SIDH_PUBLICKEYBYTES) != 0) {
+                passed = false;
+                break;
+            }
+        }
+    }
+    sidh_set_checkpoint(k);
+
+    if (passed == true) printf("  Checkpoint tests ............................................. PASSED");
+    else { printf("  Checkpoint tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_checkpoints()
+{ // Benchmarking Alice's key generation with a workspace for several checkpoint intervals
+    unsigned int i, n, size, k = sidh_get_checkpoint();
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PublicKeyA[SIDH_PUBLICKEYBYTES];
+    unsigned char* workspace;
+    unsigned long long cycles, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING ALICE'S KEY GENERATION WITH CHECKPOINTS %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    random_mod_order_A(PrivateKeyA);
+    for (i = 0; i < NCHECKPOINTS; i++) {
+        workspace = checkpoint_workspace(checkpoints[i], &size);
+        if (workspace == NULL) return FAILED;
+        cycles = 0;
+        for (n = 0; n < CHECKPOINT_LOOPS; n++) {
+            cycles1 = cpucycles();
+            EphemeralKeyGeneration_A_ws(PrivateKeyA, PublicKeyA, workspace, size);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        free(workspace);
+        if (checkpoints[i] == CHECKPOINT_NONE) printf("  Whole isogeny path ..... ");
+        else printf("  Checkpoint every %2u ..... ", checkpoints[i]);
+        printf("workspace of %6u bytes, key generation runs in %10lld ", size, cycles/CHECKPOINT_LOOPS); print_unit;
+        printf("\n");
+    }
+    sidh_set_checkpoint(k);
+
+    return PASSED;
+}
+#endif
+
+
+#if defined(DLOG_THREADS_MAX)
+int cryptotest_dlog_threads()
+{ // Testing the key generations with the discrete logs solved by 1 to DLOG_THREADS_MAX threads: same public keys
+    unsigned int i, n, t = sidh_get_dlog_threads();
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char PublicKeyA_t[SIDH_PUBLICKEYBYTES], PublicKeyB_t[SIDH_PUBLICKEYBYTES];
+    bool passed = true;
+
+    if (sidh_set_dlog_threads(DLOG_THREADS_MAX+1) != -1 || sidh_get_dlog_threads() != t) passed = false;
+
+    for (n = 0; n < DLOG_TESTS && passed == true; n++) {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+        sidh_set_dlog_threads(1);
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+
+        for (i = 2; i <= DLOG_THREADS_MAX; i++) {
+            sidh_set_dlog_threads(i);
+            EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA_t);
+            EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB_t);
+            if (memcmp(PublicKeyA, PublicKeyA_t, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyB_t, SIDH_PUBLICKEYBYTES) != 0) {
+                passed = false;
+                break;
+            }
+        }
+    }
+    sidh_set_dlog_threads(t);
+
+    if (passed == true) printf("  Discrete log threads tests ................................... PASSED");
+    else { printf("  Discrete log threads tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_dlog_threads()
+{ // Benchmarking the key generations with the discrete logs solved by 1 to DLOG_THREADS_MAX threads
+    unsigned int i, n, t = sidh_get_dlog_threads();
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned long long cycles_A, cycles_B, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING THE KEY GENERATIONS WITH DISCRETE LOG THREADS %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    for (i = 1; i <= DLOG_THREADS_MAX; i++) {
+        sidh_set_dlog_threads(i);
+        cycles_A = 0;
+        cycles_B = 0;
+        for (n = 0; n < DLOG_LOOPS; n++) {
+            cycles1 = cpucycles();
+            EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+            cycles2 = cpucycles();
+            cycles_A = cycles_A+(cycles2-cycles1);
+            cycles1 = cpucycles();
+            EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+            cycles2 = cpucycles();
+            cycles_B = cycles_B+(cycles2-cycles1);
+        }
+        printf("  %u thread(s) ..... Alice's key generation runs in %10lld, Bob's in %10lld ", i, cycles_A/DLOG_LOOPS, cycles_B/DLOG_LOOPS); print_unit;
+        printf("\n");
+    }
+    sidh_set_dlog_threads(t);
+
+    return PASSED;
+}
+#endif
+
+
 int cryptorun_kex()
 { // Benchmarking key exchange
     unsigned int n;
@@ -108,17 +658,87 @@ int main()
 {
     int Status = PASSED;
     
+#if defined(TABLE_BUNDLE)
+    if (tables_load(TABLES_FILE, TABLES_PREFAULT) != 0) {
+        printf("\n\n   Error detected: cannot load the table bundle %s \n\n", TABLES_FILE);
+        return FAILED;
+    }
+#endif
+    
     Status = cryptotest_kex();             // Test key exchange
     if (Status != PASSED) {
         printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
+#ifdef sidh_workers_stop
+    Status = cryptotest_workers();         // Test key exchange across restarts of the worker threads
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#ifdef SIDH_LADDER_AUTO
+    Status = cryptotest_ladders();         // Test key generation engines
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_PUBLIC_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#ifdef SIDH_OP_KEYGEN_A
+    Status = cryptotest_opcount();         // Test operation counts
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_OPCOUNT \n\n");
+        return FAILED;
+    }
+#endif
+#ifdef KEYPOOL_SIDH_A
+    Status = cryptotest_keypool();         // Test key pair pools
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_KEYPOOL \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(WORKSPACE_KEYGEN_A) && (OS_TARGET == OS_NIX)
+    Status = cryptotest_workspace();       // Test key generations with a workspace
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_WORKSPACE \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(CHECKPOINT_NONE) && (OS_TARGET == OS_NIX)
+    Status = cryptotest_checkpoints();     // Test key generations with checkpoints
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_CHECKPOINT \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(DLOG_THREADS_MAX)
+    Status = cryptotest_dlog_threads();    // Test key generations with several discrete log threads
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_PUBLIC_KEY \n\n");
+        return FAILED;
+    }
+#endif
 
     Status = cryptorun_kex();              // Benchmark key exchange
     if (Status != PASSED) {
         printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
+#if defined(CHECKPOINT_NONE) && (OS_TARGET == OS_NIX)
+    Status = cryptorun_checkpoints();      // Benchmark key generations with checkpoints
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_CHECKPOINT \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(DLOG_THREADS_MAX)
+    Status = cryptorun_dlog_threads();     // Benchmark key generations with several discrete log threads
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_PUBLIC_KEY \n\n");
+        return FAILED;
+    }
+#endif
     
     return Status;
 }
\ No newline at end of file
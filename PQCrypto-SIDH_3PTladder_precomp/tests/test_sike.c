@@ -5,6 +5,10 @@
 *********************************************************************************************/ 
 
 #include "../src/random/random.h"
+#include "../src/sha3/fips202.h"
+#if defined(_PARALLEL_)
+    #include <unistd.h>
+#endif
 
 #ifdef DO_VALGRIND_CHECK
 #include <valgrind/memcheck.h>
@@ -26,6 +30,12 @@
     #define BENCH_LOOPS      100    
 #endif
 
+#if defined(WORKSPACE_KEM_KEYPAIR) && (OS_TARGET == OS_NIX)
+    #include <stdlib.h>
+    #define STACK_BYTES      (1 << 20)      // Stack of the threads of the stack usage tests
+    #define STACK_LIMIT_WS   (48 << 10)     // Largest stack usage accepted for the functions with a workspace
+#endif
+
 
 int cryptotest_kem()
 { // Testing KEM
@@ -134,15 +144,467 @@ int cryptorun_kem()
 }
 
 
+#ifdef SIKE_LANES
+int shake256x4_test()
+{ // Testing each lane of the 4-way SHAKE256 against SHAKE256, with input and output lengths around the rate
+    const unsigned long long inlens[] = { 0, 1, 32, 135, 136, 137, 300, 700 };
+    const unsigned long long outlens[] = { 1, 16, 135, 136, 137, 300 };
+    unsigned char in[4][700], out[4][300], out1[300];
+    uint64_t s[4*25], s1[25];
+    unsigned int i, j, k;
+    bool passed = true;
+
+    for (i = 0; i < sizeof(inlens)/sizeof(inlens[0]); i++) {
+        randombytes(in[0], sizeof(in));
+        for (j = 0; j < sizeof(outlens)/sizeof(outlens[0]); j++) {
+            shake256x4(out[0], out[1], out[2], out[3], outlens[j], in[0], in[1], in[2], in[3], inlens[i]);
+            for (k = 0; k < 4; k++) {
+                shake256(out1, outlens[j], in[k], inlens[i]);
+                if (memcmp(out[k], out1, outlens[j]) != 0) {
+                    passed = false;
+                }
+            }
+        }
+
+        // Absorb and squeeze blocks separately
+        memset(s, 0, sizeof(s));
+        shake256x4_absorb(s, in[0], in[1], in[2], in[3], inlens[i]);
+        shake256x4_squeezeblocks(out[0], out[1], out[2], out[3], 2, s);
+        for (k = 0; k < 4; k++) {
+            memset(s1, 0, sizeof(s1));
+            shake256_absorb(s1, in[k], (unsigned int)inlens[i]);
+            shake256_squeezeblocks(out1, 2, s1);
+            if (memcmp(out[k], out1, 2*SHAKE256_RATE) != 0) {
+                passed = false;
+            }
+        }
+    }
+    if (passed == true) printf("  SHAKE256 4-way tests ......................................... PASSED");
+    else { printf("  SHAKE256 4-way tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptotest_kem_x8()
+{ // Testing the multi-buffer KEM API against the single-operation functions, and its per-lane error reporting
+    unsigned int i, n, bad;
+    unsigned char sk[SIKE_LANES*CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[SIKE_LANES*CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[SIKE_LANES*CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[SIKE_LANES*CRYPTO_BYTES] = {0};
+    unsigned char ss_[SIKE_LANES*CRYPTO_BYTES] = {0};
+    unsigned char pk1[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ss1[CRYPTO_BYTES] = {0};
+    unsigned char zero[CRYPTO_CIPHERTEXTBYTES] = {0};
+    const unsigned int msg_bytes = CRYPTO_CIPHERTEXTBYTES - CRYPTO_PUBLICKEYBYTES;     // Bytes of s in the secret key
+    const unsigned int fp_bytes = CRYPTO_PUBLICKEYBYTES / 6;                          // Bytes of an encoded element of GF(p)
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS && passed == true; n++) 
+    {
+        if (crypto_kem_keypair_x8(pk, sk) != 0 || crypto_kem_enc_x8(ct, ss, pk) != 0 || crypto_kem_dec_x8(ss_, ct, sk) != 0) {
+            passed = false;
+            break;
+        }
+        if (memcmp(ss, ss_, SIKE_LANES*CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+
+        for (i = 0; i < SIKE_LANES && passed == true; i++) {
+            // Each public key must be the one of its secret key, and each lane must match the single-operation decapsulation
+            EphemeralKeyGeneration_B(sk + i*CRYPTO_SECRETKEYBYTES + msg_bytes, pk1);
+            crypto_kem_dec(ss1, ct + i*CRYPTO_CIPHERTEXTBYTES, sk + i*CRYPTO_SECRETKEYBYTES);
+            if (memcmp(pk1, pk + i*CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES) != 0 || memcmp(ss1, ss + i*CRYPTO_BYTES, CRYPTO_BYTES) != 0) {
+                passed = false;
+            }
+        }
+
+        // Single-operation encapsulations must be decapsulated by the multi-buffer decapsulation
+        for (i = 0; i < SIKE_LANES; i++) {
+            crypto_kem_enc(ct + i*CRYPTO_CIPHERTEXTBYTES, ss + i*CRYPTO_BYTES, pk + i*CRYPTO_PUBLICKEYBYTES);
+        }
+        ct[CRYPTO_CIPHERTEXTBYTES + 1] ^= 1;               // Lane 1 must output H(s||ct)
+        crypto_kem_dec_x8(ss_, ct, sk);
+        crypto_kem_dec(ss1, ct + CRYPTO_CIPHERTEXTBYTES, sk + CRYPTO_SECRETKEYBYTES);
+        if (memcmp(ss1, ss_ + CRYPTO_BYTES, CRYPTO_BYTES) != 0 || memcmp(ss, ss_ + CRYPTO_BYTES, CRYPTO_BYTES) == 0) {
+            passed = false;
+        }
+        for (i = 0; i < SIKE_LANES; i++) {
+            if (i != 1 && memcmp(ss + i*CRYPTO_BYTES, ss_ + i*CRYPTO_BYTES, CRYPTO_BYTES) != 0) {
+                passed = false;
+            }
+        }
+
+        // A public key with a coordinate that is not reduced mod p fails its lane only, and a ciphertext with such a coordinate is
+        // implicitly rejected as by the single-operation decapsulation
+        bad = n % SIKE_LANES;
+        memset(pk + bad*CRYPTO_PUBLICKEYBYTES + fp_bytes, 0xFF, fp_bytes);
+        if (crypto_kem_enc_x8(ct, ss, pk) != (1 << bad) || memcmp(ct + bad*CRYPTO_CIPHERTEXTBYTES, zero, CRYPTO_CIPHERTEXTBYTES) != 0 ||
+            memcmp(ss + bad*CRYPTO_BYTES, zero, CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+        memset(ct + bad*CRYPTO_CIPHERTEXTBYTES + fp_bytes, 0xFF, fp_bytes);
+        crypto_kem_dec(ss1, ct + bad*CRYPTO_CIPHERTEXTBYTES, sk + bad*CRYPTO_SECRETKEYBYTES);
+        if (crypto_kem_dec_x8(ss_, ct, sk) != 0 || memcmp(ss_ + bad*CRYPTO_BYTES, ss1, CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+        for (i = 0; i < SIKE_LANES; i++) {
+            if (i != bad && memcmp(ss + i*CRYPTO_BYTES, ss_ + i*CRYPTO_BYTES, CRYPTO_BYTES) != 0) {
+                passed = false;
+            }
+        }
+    }
+
+    if (passed == true) printf("  KEM multi-buffer (x%d) tests .................................. PASSED", SIKE_LANES);
+    else { printf("  KEM multi-buffer (x%d) tests ... FAILED", SIKE_LANES); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_x8()
+{ // Benchmarking the multi-buffer KEM API, reported per operation
+    unsigned int n;
+    unsigned char sk[SIKE_LANES*CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[SIKE_LANES*CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[SIKE_LANES*CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[SIKE_LANES*CRYPTO_BYTES] = {0};
+    unsigned char ss_[SIKE_LANES*CRYPTO_BYTES] = {0};
+    unsigned long long cycles_keygen = 0, cycles_encaps = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    printf("\n");
+    for (n = 0; n < (BENCH_LOOPS+SIKE_LANES-1)/SIKE_LANES; n++)
+    {
+        cycles1 = cpucycles();
+        crypto_kem_keypair_x8(pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+        
+        cycles1 = cpucycles();
+        crypto_kem_enc_x8(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        crypto_kem_dec_x8(ss_, ct, sk);   
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+    n *= SIKE_LANES;
+
+    printf("  Key generation (x%d, per key) runs in ......................... %10lld ", SIKE_LANES, cycles_keygen/n); print_unit;
+    printf("\n");
+    printf("  Encapsulation (x%d, per ciphertext) runs in ................... %10lld ", SIKE_LANES, cycles_encaps/n); print_unit;
+    printf("\n");        
+    printf("  Decapsulation (x%d, per ciphertext) runs in ................... %10lld ", SIKE_LANES, cycles_decaps/n); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+#endif
+
+
+#ifdef KEYPOOL_SIKE
+int cryptotest_keypool()
+{ // Testing the key pair pool: the pooled key pairs must be valid and, with _PARALLEL_, served from the pool once it is filled
+    unsigned int i, ready = 0;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned long long hits = 0, misses = 0, cycles = 0, cycles1, cycles2;
+    bool passed = true;
+
+    if (keypool_start(KEYPOOL_SIKE, 2, 1, 1) == 0 || keypool_start(KEYPOOL_SIDH_B+1, 1, 2, 1) == 0) passed = false;
+#if defined(_PARALLEL_)
+    if (keypool_start(KEYPOOL_SIKE, 1, TEST_LOOPS, 1) != 0 || keypool_start(KEYPOOL_SIKE, 1, TEST_LOOPS, 1) == 0) passed = false;
+    for (i = 0; i < 6000 && ready < TEST_LOOPS; i++) {      // Waits up to a minute for the pool to be filled
+        usleep(10000);
+        keypool_stats(KEYPOOL_SIKE, &hits, &misses, &ready);
+    }
+#endif
+
+    for (i = 0; i < TEST_LOOPS && passed == true; i++) 
+    {
+        cycles1 = cpucycles();
+        crypto_kem_keypair_pooled(pk, sk);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+        crypto_kem_enc(ct, ss, pk);
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+    }
+    keypool_stop(KEYPOOL_SIKE);
+
+    if (keypool_stats(KEYPOOL_SIKE, &hits, &misses, &ready) != 0 || hits + misses != TEST_LOOPS || ready != 0) passed = false;
+#if defined(_PARALLEL_)
+    if (hits != TEST_LOOPS) passed = false;
+#else
+    if (hits != 0) passed = false;
+#endif
+
+    if (passed == true) printf("  KEM key pair pool tests ...................................... PASSED");
+    else { printf("  KEM key pair pool tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+    printf("  Pooled key generation runs in ................................ %10lld ", cycles/TEST_LOOPS); print_unit;
+    printf(" (%llu hits, %llu misses)\n", hits, misses);
+
+    return PASSED;
+}
+#endif
+
+
+#ifdef SIKE_ENC_HELPERS
+int cryptotest_kem_concurrent()
+{ // Testing the concurrent encapsulation: its ciphertexts must decapsulate to its shared secrets
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned long long cycles = 0, cycles1, cycles2;
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS && passed == true; n++) 
+    {
+        crypto_kem_keypair(pk, sk);
+        cycles1 = cpucycles();
+        crypto_kem_enc_concurrent(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+    }
+
+    if (passed == true) printf("  KEM concurrent encapsulation tests ........................... PASSED");
+    else { printf("  KEM concurrent encapsulation tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+    printf("  Concurrent encapsulation runs in ............................. %10lld ", cycles/TEST_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+#endif
+
+
+#ifdef SIDH_LADDER_DEFAULT
+int cryptotest_kem_ladders()
+{ // Testing the KEM with the key generation engine of each call: the engines of the key pair, the encapsulation and the 
+  // decapsulation can differ, and the engine of the process is left unchanged
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned int ladder = sidh_get_ladder();
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS && passed == true; n++) 
+    {
+        if (crypto_kem_keypair_ladder(pk, sk, SIDH_LADDER_MONTGOMERY) != 0 || crypto_kem_enc_ladder(ct, ss, pk, SIDH_LADDER_3PT) != 0) {
+            passed = false;
+            break;
+        }
+        if (crypto_kem_dec_ladder(ss_, ct, sk, SIDH_LADDER_MONTGOMERY) != 0 || memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+        if (crypto_kem_dec_ladder(ss_, ct, sk, SIDH_LADDER_DEFAULT) != 0 || memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+    }
+    if (sidh_get_ladder() != ladder) passed = false;
+    if (crypto_kem_keypair_ladder(pk, sk, SIDH_LADDER_DEFAULT+1) == 0 || crypto_kem_enc_ladder(ct, ss, pk, SIDH_LADDER_DEFAULT+1) == 0 || 
+        crypto_kem_dec_ladder(ss_, ct, sk, SIDH_LADDER_DEFAULT+1) == 0) passed = false;
+
+    if (passed == true) printf("  KEM key generation engine tests .............................. PASSED");
+    else { printf("  KEM key generation engine tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptotest_kem_fused()
+{ // Testing Alice's fused key generation and shared secret computation of the encapsulation against the separate functions,
+  // with random keys and both key generation engines
+    unsigned int n, e;
+    const unsigned int ladders[2] = { SIDH_LADDER_3PT, SIDH_LADDER_MONTGOMERY };
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A] = {0};
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyA_[SIDH_PUBLICKEYBYTES] = {0};
+    unsigned char SharedSecretA[SIDH_BYTES] = {0}, SharedSecretA_[SIDH_BYTES] = {0};
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS && passed == true; n++) 
+    {
+        crypto_kem_keypair(pk, sk);
+        random_mod_order_A(PrivateKeyA);
+        for (e = 0; e < 2; e++) {
+            if (EphemeralKeyGenerationAgreement_A(PrivateKeyA, pk, PublicKeyA, SharedSecretA, ladders[e]) != 0 || 
+                EphemeralKeyGeneration_A_ladder(PrivateKeyA, PublicKeyA_, ladders[e]) != 0 || 
+                EphemeralSecretAgreement_A(PrivateKeyA, pk, SharedSecretA_) != 0) {
+                passed = false;
+                break;
+            }
+            if (memcmp(PublicKeyA, PublicKeyA_, SIDH_PUBLICKEYBYTES) != 0 || memcmp(SharedSecretA, SharedSecretA_, SIDH_BYTES) != 0) passed = false;
+        }
+    }
+    if (EphemeralKeyGenerationAgreement_A(PrivateKeyA, pk, PublicKeyA, SharedSecretA, SIDH_LADDER_DEFAULT+1) == 0) passed = false;
+
+    if (passed == true) printf("  KEM fused key generation and shared secret tests ............. PASSED");
+    else { printf("  KEM fused key generation and shared secret tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
+#if defined(WORKSPACE_KEM_KEYPAIR) && (OS_TARGET == OS_NIX)
+typedef struct {
+    unsigned int op;                       // WORKSPACE_KEM_KEYPAIR or WORKSPACE_KEM_ENC
+    unsigned char *pk, *sk, *ct, *ss;
+    void* workspace;                       // NULL to run the function without workspace
+    unsigned int size;                     // Bytes of the workspace
+    int status;
+} kem_job_t;
+
+
+static void kem_job(void* arg)
+{
+    kem_job_t* job = (kem_job_t*)arg;
+
+    if (job->op == WORKSPACE_KEM_KEYPAIR) {
+        if (job->workspace == NULL) job->status = crypto_kem_keypair(job->pk, job->sk);
+        else job->status = crypto_kem_keypair_ws(job->pk, job->sk, job->workspace, job->size);
+    } else {
+        if (job->workspace == NULL) job->status = crypto_kem_enc(job->ct, job->ss, job->pk);
+        else job->status = crypto_kem_enc_ws(job->ct, job->ss, job->pk, job->workspace, job->size);
+    }
+}
+
+
+int cryptotest_kem_workspace()
+{ // Testing the KEM with a workspace: its ciphertexts must decapsulate to its shared secrets, on a stack of at most STACK_LIMIT_WS bytes
+    unsigned int op;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    size_t stack[2][2] = {0}, size;
+    unsigned char* workspace;
+    kem_job_t job = { 0, pk, sk, ct, ss, NULL, 0, 0 };
+    bool passed = true;
+
+    size = sidh_workspace_size(WORKSPACE_KEM_KEYPAIR);    // One workspace for both operations, of the larger size
+    if (sidh_workspace_size(WORKSPACE_KEM_ENC) > size) size = sidh_workspace_size(WORKSPACE_KEM_ENC);
+    if (posix_memalign((void**)&workspace, WORKSPACE_ALIGN, size) != 0) return FAILED;
+
+    for (op = WORKSPACE_KEM_KEYPAIR; op <= WORKSPACE_KEM_ENC; op++) {
+        job.op = op;
+        job.workspace = NULL;
+        stack[op-WORKSPACE_KEM_KEYPAIR][0] = stack_usage(kem_job, &job, STACK_BYTES);
+        if (job.status != 0) passed = false;
+    }
+    for (op = WORKSPACE_KEM_KEYPAIR; op <= WORKSPACE_KEM_ENC; op++) {
+        job.op = op;
+        job.workspace = workspace;
+        job.size = (unsigned int)size;
+        stack[op-WORKSPACE_KEM_KEYPAIR][1] = stack_usage(kem_job, &job, STACK_BYTES);
+        if (job.status != 0 || stack[op-WORKSPACE_KEM_KEYPAIR][1] == 0 || stack[op-WORKSPACE_KEM_KEYPAIR][1] > STACK_LIMIT_WS) passed = false;
+    }
+    crypto_kem_dec(ss_, ct, sk);
+    if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+
+    if (crypto_kem_enc_ws(ct, ss, pk, workspace + 8, (unsigned int)size) != -1 || crypto_kem_keypair_ws(pk, sk, NULL, (unsigned int)size) != -1) passed = false;
+    if (crypto_kem_keypair_ws(pk, sk, workspace, sidh_workspace_size(WORKSPACE_KEM_KEYPAIR) - 1) != -1 || 
+        crypto_kem_enc_ws(ct, ss, pk, workspace, sidh_workspace_size(WORKSPACE_KEM_ENC) - 1) != -1) passed = false;
+    free(workspace);
+
+    if (passed == true) printf("  KEM workspace tests .......................................... PASSED");
+    else { printf("  KEM workspace tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+    printf("  Key generation stack usage ................................... %zu bytes, %zu bytes with a workspace of %u bytes\n", 
+           stack[0][0], stack[0][1], sidh_workspace_size(WORKSPACE_KEM_KEYPAIR));
+    printf("  Encapsulation stack usage .................................... %zu bytes, %zu bytes with a workspace of %u bytes\n", 
+           stack[1][0], stack[1][1], sidh_workspace_size(WORKSPACE_KEM_ENC));
+
+    return PASSED;
+}
+#endif
+
+
 int main(int argc, char **argv)
 {
     int Status = PASSED;
     
+#if defined(TABLE_BUNDLE)
+    if (tables_load(TABLES_FILE, TABLES_PREFAULT) != 0) {
+        printf("\n\n   Error detected: cannot load the table bundle %s \n\n", TABLES_FILE);
+        return FAILED;
+    }
+#endif
+    
     Status = cryptotest_kem();     // Test key encapsulation mechanism
     if (Status != PASSED) {
         printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
+#ifdef SIDH_LADDER_DEFAULT
+    Status = cryptotest_kem_ladders();     // Test key encapsulation mechanism with the engine of each call
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+    Status = cryptotest_kem_fused();       // Test Alice's fused computations of the encapsulation
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#ifdef SIKE_LANES
+    Status = shake256x4_test();    // Test 4-way SHAKE256
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: SHAKE256_ERROR \n\n");
+        return FAILED;
+    }
+    Status = cryptotest_kem_x8();  // Test multi-buffer key encapsulation mechanism
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#ifdef KEYPOOL_SIKE
+    Status = cryptotest_keypool(); // Test key pair pool
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_KEYPOOL \n\n");
+        return FAILED;
+    }
+#endif
+#ifdef SIKE_ENC_HELPERS
+    Status = cryptotest_kem_concurrent();  // Test concurrent encapsulation
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(WORKSPACE_KEM_KEYPAIR) && (OS_TARGET == OS_NIX)
+    Status = cryptotest_kem_workspace();   // Test key encapsulation mechanism with a workspace
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_WORKSPACE \n\n");
+        return FAILED;
+    }
+#endif
     
     if ((argc > 1) && (strcmp("nobench", argv[1]) == 0)) {}
     else {
@@ -151,6 +613,9 @@ int main(int argc, char **argv)
             printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
             return FAILED;
         }
+#ifdef SIKE_LANES
+        Status = cryptorun_kem_x8();  // Benchmark multi-buffer key encapsulation mechanism
+#endif
     }
 
     return Status;